@@ -0,0 +1,2227 @@
+      .sub '__onload' :load :init
+          .local pmc optable
+          ## namespace JSON
+          .local pmc p6meta
+          p6meta = get_root_global ['parrot'], 'P6metaclass'
+          $P0 = p6meta.'get_proto'('JSON')
+          unless null $P0 goto onload_371
+          p6meta.'new_class'('JSON', 'parent'=>'PGE::Grammar')
+        onload_371:
+          .return ()
+      .end
+
+## <JSON::object>
+.namespace ["JSON"]
+      .sub "object" :method :nsentry 
+          .param pmc adverbs      :slurpy :named
+          .local pmc mob
+          .local string target
+          .local pmc mfrom, mpos
+          .local int cpos, iscont
+          $P0 = get_hll_global ['PGE'], '$!MATCH'
+          (mob, cpos, target, mfrom, mpos, iscont) = $P0.'new'(self, adverbs :flat :named)
+          .local int lastpos
+          lastpos = length target
+          if cpos > lastpos goto fail_rule
+          .local pmc cstack
+          cstack = root_new ['parrot';'ResizableIntegerArray']
+          .local pmc ustack
+          ustack = root_new ['parrot';'ResizablePMCArray']
+          .local pmc gpad
+          gpad = root_new ['parrot';'ResizablePMCArray']
+          .local pmc captscope, captob
+          captscope = mob
+          .local int pos, rep, cutmark
+        try_match:
+          if cpos > lastpos goto fail_rule
+          mfrom = cpos
+          pos = cpos
+          cutmark = 0
+          local_branch cstack, R
+          if cutmark <= -2 goto fail_cut
+          inc cpos
+          if iscont goto try_match
+        fail_rule:
+          cutmark = -2
+        fail_cut:
+          mob.'_failcut'(cutmark)
+          .return (mob)
+          goto fail_cut
+        succeed:
+          mpos = pos
+          .return (mob)
+        fail:
+          local_return cstack
+        fail_match:
+          cutmark = -3
+          goto fail_cut
+        R: # concat
+        R244: # subrule ws
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'ws'
+          if $I0 == 0 goto R244_1
+          $P0 = find_method mob, 'ws'
+          goto R244_2
+        R244_1:
+          $P0 = find_name 'ws'
+          unless null $P0 goto R244_2
+          die "Unable to find regex 'ws'"
+        R244_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          
+          pos = $P1
+          local_branch cstack, R245
+          
+          goto fail
+        R245: # literal
+          $I0 = pos + 1
+          if $I0 > lastpos goto fail
+          $S0 = substr target, pos, 1
+          
+          if $S0 != "{" goto fail
+          pos += 1
+          goto R246
+
+        R246: # subrule ws
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'ws'
+          if $I0 == 0 goto R246_1
+          $P0 = find_method mob, 'ws'
+          goto R246_2
+        R246_1:
+          $P0 = find_name 'ws'
+          unless null $P0 goto R246_2
+          die "Unable to find regex 'ws'"
+        R246_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          
+          pos = $P1
+          local_branch cstack, R247
+          
+          goto fail
+        R247:  # quant 0..1 (3) greedy/none
+          push gpad, 0
+          local_branch cstack, R247_repeat
+          $I0 = pop gpad
+          if cutmark != 250 goto fail
+          cutmark = 0
+          goto fail
+        R247_repeat:
+          rep = gpad[-1]
+          if rep >= 1 goto R247_1
+          inc rep
+          gpad[-1] = rep
+          push ustack, pos
+          push ustack, rep
+          local_branch cstack, R249
+          rep = pop ustack
+          pos = pop ustack
+          if cutmark != 0 goto fail
+          dec rep
+        R247_1:
+          ### if rep < 0 goto fail
+          $I0 = pop gpad
+          push ustack, rep
+          local_branch cstack, R248
+          rep = pop ustack
+          push gpad, rep
+          if cutmark != 0 goto fail
+          cutmark = 250
+          goto fail
+
+        R249: # subrule members
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'members'
+          if $I0 == 0 goto R249_1
+          $P0 = find_method mob, 'members'
+          goto R249_2
+        R249_1:
+          $P0 = find_name 'members'
+          unless null $P0 goto R249_2
+          die "Unable to find regex 'members'"
+        R249_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'dba'=>"", 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          $I0 = defined captscope["members"]
+if $I0 goto R249_cgen
+$P0 = root_new ['parrot';'ResizablePMCArray']
+captscope["members"] = $P0
+local_branch cstack, R249_cgen
+delete captscope["members"]
+goto fail
+R249_cgen:
+
+          $P2 = captscope["members"]
+push $P2, captob
+          pos = $P1
+          local_branch cstack, R247_repeat
+          $P2 = captscope["members"]
+$P2 = pop $P2
+          goto fail
+        R248: # subrule ws
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'ws'
+          if $I0 == 0 goto R248_1
+          $P0 = find_method mob, 'ws'
+          goto R248_2
+        R248_1:
+          $P0 = find_name 'ws'
+          unless null $P0 goto R248_2
+          die "Unable to find regex 'ws'"
+        R248_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          
+          pos = $P1
+          local_branch cstack, R251
+          
+          goto fail
+        R251: # literal
+          $I0 = pos + 1
+          if $I0 > lastpos goto fail
+          $S0 = substr target, pos, 1
+          
+          if $S0 != "}" goto fail
+          pos += 1
+          goto R252
+
+        R252: # subrule ws
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'ws'
+          if $I0 == 0 goto R252_1
+          $P0 = find_method mob, 'ws'
+          goto R252_2
+        R252_1:
+          $P0 = find_name 'ws'
+          unless null $P0 goto R252_2
+          die "Unable to find regex 'ws'"
+        R252_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          
+          pos = $P1
+          local_branch cstack, succeed
+          
+          goto fail
+      .end
+
+## <JSON::array>
+.namespace ["JSON"]
+      .sub "array" :method :nsentry 
+          .param pmc adverbs      :slurpy :named
+          .local pmc mob
+          .local string target
+          .local pmc mfrom, mpos
+          .local int cpos, iscont
+          $P0 = get_hll_global ['PGE'], '$!MATCH'
+          (mob, cpos, target, mfrom, mpos, iscont) = $P0.'new'(self, adverbs :flat :named)
+          .local int lastpos
+          lastpos = length target
+          if cpos > lastpos goto fail_rule
+          .local pmc cstack
+          cstack = root_new ['parrot';'ResizableIntegerArray']
+          .local pmc ustack
+          ustack = root_new ['parrot';'ResizablePMCArray']
+          .local pmc captscope, captob
+          captscope = mob
+          .local int pos, rep, cutmark
+        try_match:
+          if cpos > lastpos goto fail_rule
+          mfrom = cpos
+          pos = cpos
+          cutmark = 0
+          local_branch cstack, R
+          if cutmark <= -2 goto fail_cut
+          inc cpos
+          if iscont goto try_match
+        fail_rule:
+          cutmark = -2
+        fail_cut:
+          mob.'_failcut'(cutmark)
+          .return (mob)
+          goto fail_cut
+        succeed:
+          mpos = pos
+          .return (mob)
+        fail:
+          local_return cstack
+        fail_match:
+          cutmark = -3
+          goto fail_cut
+        R:  # alt R253, R254
+          push ustack, pos
+          local_branch cstack, R253
+          pos = pop ustack
+          if cutmark != 0 goto fail
+          goto R254
+
+        R253: # concat
+        R255: # subrule ws
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'ws'
+          if $I0 == 0 goto R255_1
+          $P0 = find_method mob, 'ws'
+          goto R255_2
+        R255_1:
+          $P0 = find_name 'ws'
+          unless null $P0 goto R255_2
+          die "Unable to find regex 'ws'"
+        R255_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          
+          pos = $P1
+          local_branch cstack, R256
+          
+          goto fail
+        R256: # literal
+          $I0 = pos + 1
+          if $I0 > lastpos goto fail
+          $S0 = substr target, pos, 1
+          
+          if $S0 != "[" goto fail
+          pos += 1
+          goto R257
+
+        R257: # subrule ws
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'ws'
+          if $I0 == 0 goto R257_1
+          $P0 = find_method mob, 'ws'
+          goto R257_2
+        R257_1:
+          $P0 = find_name 'ws'
+          unless null $P0 goto R257_2
+          die "Unable to find regex 'ws'"
+        R257_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          
+          pos = $P1
+          local_branch cstack, R258
+          
+          goto fail
+        R258: # literal
+          $I0 = pos + 1
+          if $I0 > lastpos goto fail
+          $S0 = substr target, pos, 1
+          
+          if $S0 != "]" goto fail
+          pos += 1
+          goto R259
+
+        R259: # subrule ws
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'ws'
+          if $I0 == 0 goto R259_1
+          $P0 = find_method mob, 'ws'
+          goto R259_2
+        R259_1:
+          $P0 = find_name 'ws'
+          unless null $P0 goto R259_2
+          die "Unable to find regex 'ws'"
+        R259_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          
+          pos = $P1
+          local_branch cstack, succeed
+          
+          goto fail
+        R254: # concat
+        R260: # subrule ws
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'ws'
+          if $I0 == 0 goto R260_1
+          $P0 = find_method mob, 'ws'
+          goto R260_2
+        R260_1:
+          $P0 = find_name 'ws'
+          unless null $P0 goto R260_2
+          die "Unable to find regex 'ws'"
+        R260_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          
+          pos = $P1
+          local_branch cstack, R261
+          
+          goto fail
+        R261: # literal
+          $I0 = pos + 1
+          if $I0 > lastpos goto fail
+          $S0 = substr target, pos, 1
+          
+          if $S0 != "[" goto fail
+          pos += 1
+          goto R262
+
+        R262: # subrule ws
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'ws'
+          if $I0 == 0 goto R262_1
+          $P0 = find_method mob, 'ws'
+          goto R262_2
+        R262_1:
+          $P0 = find_name 'ws'
+          unless null $P0 goto R262_2
+          die "Unable to find regex 'ws'"
+        R262_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          
+          pos = $P1
+          local_branch cstack, R263
+          
+          goto fail
+        R263: # subrule elements
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'elements'
+          if $I0 == 0 goto R263_1
+          $P0 = find_method mob, 'elements'
+          goto R263_2
+        R263_1:
+          $P0 = find_name 'elements'
+          unless null $P0 goto R263_2
+          die "Unable to find regex 'elements'"
+        R263_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'dba'=>"", 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          captscope["elements"] = captob
+
+          pos = $P1
+          local_branch cstack, R264
+          delete captscope["elements"]
+
+          goto fail
+        R264: # subrule ws
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'ws'
+          if $I0 == 0 goto R264_1
+          $P0 = find_method mob, 'ws'
+          goto R264_2
+        R264_1:
+          $P0 = find_name 'ws'
+          unless null $P0 goto R264_2
+          die "Unable to find regex 'ws'"
+        R264_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          
+          pos = $P1
+          local_branch cstack, R265
+          
+          goto fail
+        R265: # literal
+          $I0 = pos + 1
+          if $I0 > lastpos goto fail
+          $S0 = substr target, pos, 1
+          
+          if $S0 != "]" goto fail
+          pos += 1
+          goto R266
+
+        R266: # subrule ws
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'ws'
+          if $I0 == 0 goto R266_1
+          $P0 = find_method mob, 'ws'
+          goto R266_2
+        R266_1:
+          $P0 = find_name 'ws'
+          unless null $P0 goto R266_2
+          die "Unable to find regex 'ws'"
+        R266_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          
+          pos = $P1
+          local_branch cstack, succeed
+          
+          goto fail
+      .end
+
+## <JSON::string>
+.namespace ["JSON"]
+      .sub "string" :method :nsentry 
+          .param pmc adverbs      :slurpy :named
+          .local pmc mob
+          .local string target
+          .local pmc mfrom, mpos
+          .local int cpos, iscont
+          $P0 = get_hll_global ['PGE'], '$!MATCH'
+          (mob, cpos, target, mfrom, mpos, iscont) = $P0.'new'(self, adverbs :flat :named)
+          .local int lastpos
+          lastpos = length target
+          if cpos > lastpos goto fail_rule
+          .local pmc cstack
+          cstack = root_new ['parrot';'ResizableIntegerArray']
+          .local pmc ustack
+          ustack = root_new ['parrot';'ResizablePMCArray']
+          .local pmc captscope, captob
+          captscope = mob
+          .local int pos, rep, cutmark
+        try_match:
+          if cpos > lastpos goto fail_rule
+          mfrom = cpos
+          pos = cpos
+          cutmark = 0
+          local_branch cstack, R
+          if cutmark <= -2 goto fail_cut
+          inc cpos
+          if iscont goto try_match
+        fail_rule:
+          cutmark = -2
+        fail_cut:
+          mob.'_failcut'(cutmark)
+          .return (mob)
+          goto fail_cut
+        succeed:
+          mpos = pos
+          .return (mob)
+        fail:
+          local_return cstack
+        fail_match:
+          cutmark = -3
+          goto fail_cut
+        R: # concat
+        R267: # subrule ws
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'ws'
+          if $I0 == 0 goto R267_1
+          $P0 = find_method mob, 'ws'
+          goto R267_2
+        R267_1:
+          $P0 = find_name 'ws'
+          unless null $P0 goto R267_2
+          die "Unable to find regex 'ws'"
+        R267_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          
+          pos = $P1
+          local_branch cstack, R268
+          
+          goto fail
+        R268: # literal
+          $I0 = pos + 1
+          if $I0 > lastpos goto fail
+          $S0 = substr target, pos, 1
+          
+          if $S0 != "\"" goto fail
+          pos += 1
+          goto R269
+
+        R269:  # quant 0..Inf none
+          local_branch cstack, R269_repeat
+          if cutmark != 272 goto fail
+          cutmark = 0
+          goto fail
+        R269_repeat:
+          push ustack, pos
+          local_branch cstack, R271
+          pos = pop ustack
+          if cutmark != 0 goto fail
+          local_branch cstack, R270
+          if cutmark != 0 goto fail
+          cutmark = 272
+          goto fail
+        R271: # subrule char
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'char'
+          if $I0 == 0 goto R271_1
+          $P0 = find_method mob, 'char'
+          goto R271_2
+        R271_1:
+          $P0 = find_name 'char'
+          unless null $P0 goto R271_2
+          die "Unable to find regex 'char'"
+        R271_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'dba'=>"", 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          $I0 = defined captscope["char"]
+if $I0 goto R271_cgen
+$P0 = root_new ['parrot';'ResizablePMCArray']
+captscope["char"] = $P0
+local_branch cstack, R271_cgen
+delete captscope["char"]
+goto fail
+R271_cgen:
+
+          $P2 = captscope["char"]
+push $P2, captob
+          pos = $P1
+          local_branch cstack, R271_3
+          $P2 = captscope["char"]
+$P2 = pop $P2
+          goto fail
+        R271_3:
+          pos = $P1
+          $P1 = getattribute captob, '&!corou'
+          if null $P1 goto R269_repeat
+          push ustack, captob
+          local_branch cstack, R269_repeat
+          captob = pop ustack
+          if cutmark != 0 goto fail
+          captob.'next'()
+          $P1 = getattribute captob, '$.pos'
+          if $P1 >= 0 goto R271_3
+          if $P1 <= -3 goto fail_match
+          goto fail
+
+        R270: # literal
+          $I0 = pos + 1
+          if $I0 > lastpos goto fail
+          $S0 = substr target, pos, 1
+          
+          if $S0 != "\"" goto fail
+          pos += 1
+          goto R273
+
+        R273: # subrule ws
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'ws'
+          if $I0 == 0 goto R273_1
+          $P0 = find_method mob, 'ws'
+          goto R273_2
+        R273_1:
+          $P0 = find_name 'ws'
+          unless null $P0 goto R273_2
+          die "Unable to find regex 'ws'"
+        R273_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          
+          pos = $P1
+          local_branch cstack, succeed
+          
+          goto fail
+      .end
+
+## <JSON::members>
+.namespace ["JSON"]
+      .sub "members" :method :nsentry 
+          .param pmc adverbs      :slurpy :named
+          .local pmc mob
+          .local string target
+          .local pmc mfrom, mpos
+          .local int cpos, iscont
+          $P0 = get_hll_global ['PGE'], '$!MATCH'
+          (mob, cpos, target, mfrom, mpos, iscont) = $P0.'new'(self, adverbs :flat :named)
+          .local int lastpos
+          lastpos = length target
+          if cpos > lastpos goto fail_rule
+          .local pmc cstack
+          cstack = root_new ['parrot';'ResizableIntegerArray']
+          .local pmc ustack
+          ustack = root_new ['parrot';'ResizablePMCArray']
+          .local pmc captscope, captob
+          captscope = mob
+          .local int pos, rep, cutmark
+        try_match:
+          if cpos > lastpos goto fail_rule
+          mfrom = cpos
+          pos = cpos
+          cutmark = 0
+          local_branch cstack, R
+          if cutmark <= -2 goto fail_cut
+          inc cpos
+          if iscont goto try_match
+        fail_rule:
+          cutmark = -2
+        fail_cut:
+          mob.'_failcut'(cutmark)
+          .return (mob)
+          goto fail_cut
+        succeed:
+          mpos = pos
+          .return (mob)
+        fail:
+          local_return cstack
+        fail_match:
+          cutmark = -3
+          goto fail_cut
+        R: # concat
+        R274: # subrule ws
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'ws'
+          if $I0 == 0 goto R274_1
+          $P0 = find_method mob, 'ws'
+          goto R274_2
+        R274_1:
+          $P0 = find_name 'ws'
+          unless null $P0 goto R274_2
+          die "Unable to find regex 'ws'"
+        R274_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          
+          pos = $P1
+          local_branch cstack, R275
+          
+          goto fail
+        R275: # subrule string
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'string'
+          if $I0 == 0 goto R275_1
+          $P0 = find_method mob, 'string'
+          goto R275_2
+        R275_1:
+          $P0 = find_name 'string'
+          unless null $P0 goto R275_2
+          die "Unable to find regex 'string'"
+        R275_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'dba'=>"", 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          $I0 = defined captscope["string"]
+if $I0 goto R275_cgen
+$P0 = root_new ['parrot';'ResizablePMCArray']
+captscope["string"] = $P0
+local_branch cstack, R275_cgen
+delete captscope["string"]
+goto fail
+R275_cgen:
+
+          $P2 = captscope["string"]
+push $P2, captob
+          pos = $P1
+          local_branch cstack, R276
+          $P2 = captscope["string"]
+$P2 = pop $P2
+          goto fail
+        R276: # subrule ws
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'ws'
+          if $I0 == 0 goto R276_1
+          $P0 = find_method mob, 'ws'
+          goto R276_2
+        R276_1:
+          $P0 = find_name 'ws'
+          unless null $P0 goto R276_2
+          die "Unable to find regex 'ws'"
+        R276_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          
+          pos = $P1
+          local_branch cstack, R277
+          
+          goto fail
+        R277: # literal
+          $I0 = pos + 1
+          if $I0 > lastpos goto fail
+          $S0 = substr target, pos, 1
+          
+          if $S0 != ":" goto fail
+          pos += 1
+          goto R278
+
+        R278: # subrule ws
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'ws'
+          if $I0 == 0 goto R278_1
+          $P0 = find_method mob, 'ws'
+          goto R278_2
+        R278_1:
+          $P0 = find_name 'ws'
+          unless null $P0 goto R278_2
+          die "Unable to find regex 'ws'"
+        R278_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          
+          pos = $P1
+          local_branch cstack, R279
+          
+          goto fail
+        R279: # subrule value
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'value'
+          if $I0 == 0 goto R279_1
+          $P0 = find_method mob, 'value'
+          goto R279_2
+        R279_1:
+          $P0 = find_name 'value'
+          unless null $P0 goto R279_2
+          die "Unable to find regex 'value'"
+        R279_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'dba'=>"", 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          $I0 = defined captscope["value"]
+if $I0 goto R279_cgen
+$P0 = root_new ['parrot';'ResizablePMCArray']
+captscope["value"] = $P0
+local_branch cstack, R279_cgen
+delete captscope["value"]
+goto fail
+R279_cgen:
+
+          $P2 = captscope["value"]
+push $P2, captob
+          pos = $P1
+          local_branch cstack, R280
+          $P2 = captscope["value"]
+$P2 = pop $P2
+          goto fail
+        R280: # subrule ws
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'ws'
+          if $I0 == 0 goto R280_1
+          $P0 = find_method mob, 'ws'
+          goto R280_2
+        R280_1:
+          $P0 = find_name 'ws'
+          unless null $P0 goto R280_2
+          die "Unable to find regex 'ws'"
+        R280_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          
+          pos = $P1
+          local_branch cstack, R281
+          
+          goto fail
+        R281:  # quant 0..Inf none
+          local_branch cstack, R281_repeat
+          if cutmark != 284 goto fail
+          cutmark = 0
+          goto fail
+        R281_repeat:
+          push ustack, pos
+          local_branch cstack, R283
+          pos = pop ustack
+          if cutmark != 0 goto fail
+          local_branch cstack, R282
+          if cutmark != 0 goto fail
+          cutmark = 284
+          goto fail
+        R283: # concat
+        R285: # literal
+          $I0 = pos + 1
+          if $I0 > lastpos goto fail
+          $S0 = substr target, pos, 1
+          
+          if $S0 != "," goto fail
+          pos += 1
+          goto R286
+
+        R286: # subrule ws
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'ws'
+          if $I0 == 0 goto R286_1
+          $P0 = find_method mob, 'ws'
+          goto R286_2
+        R286_1:
+          $P0 = find_name 'ws'
+          unless null $P0 goto R286_2
+          die "Unable to find regex 'ws'"
+        R286_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          
+          pos = $P1
+          local_branch cstack, R287
+          
+          goto fail
+        R287: # subrule string
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'string'
+          if $I0 == 0 goto R287_1
+          $P0 = find_method mob, 'string'
+          goto R287_2
+        R287_1:
+          $P0 = find_name 'string'
+          unless null $P0 goto R287_2
+          die "Unable to find regex 'string'"
+        R287_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'dba'=>"", 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          $I0 = defined captscope["string"]
+if $I0 goto R287_cgen
+$P0 = root_new ['parrot';'ResizablePMCArray']
+captscope["string"] = $P0
+local_branch cstack, R287_cgen
+delete captscope["string"]
+goto fail
+R287_cgen:
+
+          $P2 = captscope["string"]
+push $P2, captob
+          pos = $P1
+          local_branch cstack, R288
+          $P2 = captscope["string"]
+$P2 = pop $P2
+          goto fail
+        R288: # subrule ws
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'ws'
+          if $I0 == 0 goto R288_1
+          $P0 = find_method mob, 'ws'
+          goto R288_2
+        R288_1:
+          $P0 = find_name 'ws'
+          unless null $P0 goto R288_2
+          die "Unable to find regex 'ws'"
+        R288_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          
+          pos = $P1
+          local_branch cstack, R289
+          
+          goto fail
+        R289: # literal
+          $I0 = pos + 1
+          if $I0 > lastpos goto fail
+          $S0 = substr target, pos, 1
+          
+          if $S0 != ":" goto fail
+          pos += 1
+          goto R290
+
+        R290: # subrule ws
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'ws'
+          if $I0 == 0 goto R290_1
+          $P0 = find_method mob, 'ws'
+          goto R290_2
+        R290_1:
+          $P0 = find_name 'ws'
+          unless null $P0 goto R290_2
+          die "Unable to find regex 'ws'"
+        R290_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          
+          pos = $P1
+          local_branch cstack, R291
+          
+          goto fail
+        R291: # subrule value
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'value'
+          if $I0 == 0 goto R291_1
+          $P0 = find_method mob, 'value'
+          goto R291_2
+        R291_1:
+          $P0 = find_name 'value'
+          unless null $P0 goto R291_2
+          die "Unable to find regex 'value'"
+        R291_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'dba'=>"", 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          $I0 = defined captscope["value"]
+if $I0 goto R291_cgen
+$P0 = root_new ['parrot';'ResizablePMCArray']
+captscope["value"] = $P0
+local_branch cstack, R291_cgen
+delete captscope["value"]
+goto fail
+R291_cgen:
+
+          $P2 = captscope["value"]
+push $P2, captob
+          pos = $P1
+          local_branch cstack, R292
+          $P2 = captscope["value"]
+$P2 = pop $P2
+          goto fail
+        R292: # subrule ws
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'ws'
+          if $I0 == 0 goto R292_1
+          $P0 = find_method mob, 'ws'
+          goto R292_2
+        R292_1:
+          $P0 = find_name 'ws'
+          unless null $P0 goto R292_2
+          die "Unable to find regex 'ws'"
+        R292_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          
+          pos = $P1
+          local_branch cstack, R281_repeat
+          
+          goto fail
+        R282: # subrule ws
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'ws'
+          if $I0 == 0 goto R282_1
+          $P0 = find_method mob, 'ws'
+          goto R282_2
+        R282_1:
+          $P0 = find_name 'ws'
+          unless null $P0 goto R282_2
+          die "Unable to find regex 'ws'"
+        R282_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          
+          pos = $P1
+          local_branch cstack, succeed
+          
+          goto fail
+      .end
+
+## <JSON::elements>
+.namespace ["JSON"]
+      .sub "elements" :method :nsentry 
+          .param pmc adverbs      :slurpy :named
+          .local pmc mob
+          .local string target
+          .local pmc mfrom, mpos
+          .local int cpos, iscont
+          $P0 = get_hll_global ['PGE'], '$!MATCH'
+          (mob, cpos, target, mfrom, mpos, iscont) = $P0.'new'(self, adverbs :flat :named)
+          .local int lastpos
+          lastpos = length target
+          if cpos > lastpos goto fail_rule
+          .local pmc cstack
+          cstack = root_new ['parrot';'ResizableIntegerArray']
+          .local pmc ustack
+          ustack = root_new ['parrot';'ResizablePMCArray']
+          .local pmc captscope, captob
+          captscope = mob
+          .local int pos, rep, cutmark
+        try_match:
+          if cpos > lastpos goto fail_rule
+          mfrom = cpos
+          pos = cpos
+          cutmark = 0
+          local_branch cstack, R
+          if cutmark <= -2 goto fail_cut
+          inc cpos
+          if iscont goto try_match
+        fail_rule:
+          cutmark = -2
+        fail_cut:
+          mob.'_failcut'(cutmark)
+          .return (mob)
+          goto fail_cut
+        succeed:
+          mpos = pos
+          .return (mob)
+        fail:
+          local_return cstack
+        fail_match:
+          cutmark = -3
+          goto fail_cut
+        R: # concat
+        R293: # subrule ws
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'ws'
+          if $I0 == 0 goto R293_1
+          $P0 = find_method mob, 'ws'
+          goto R293_2
+        R293_1:
+          $P0 = find_name 'ws'
+          unless null $P0 goto R293_2
+          die "Unable to find regex 'ws'"
+        R293_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          
+          pos = $P1
+          local_branch cstack, R294
+          
+          goto fail
+        R294: # subrule value
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'value'
+          if $I0 == 0 goto R294_1
+          $P0 = find_method mob, 'value'
+          goto R294_2
+        R294_1:
+          $P0 = find_name 'value'
+          unless null $P0 goto R294_2
+          die "Unable to find regex 'value'"
+        R294_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'dba'=>"", 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          $I0 = defined captscope["value"]
+if $I0 goto R294_cgen
+$P0 = root_new ['parrot';'ResizablePMCArray']
+captscope["value"] = $P0
+local_branch cstack, R294_cgen
+delete captscope["value"]
+goto fail
+R294_cgen:
+
+          $P2 = captscope["value"]
+push $P2, captob
+          pos = $P1
+          local_branch cstack, R295
+          $P2 = captscope["value"]
+$P2 = pop $P2
+          goto fail
+        R295: # subrule ws
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'ws'
+          if $I0 == 0 goto R295_1
+          $P0 = find_method mob, 'ws'
+          goto R295_2
+        R295_1:
+          $P0 = find_name 'ws'
+          unless null $P0 goto R295_2
+          die "Unable to find regex 'ws'"
+        R295_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          
+          pos = $P1
+          local_branch cstack, R296
+          
+          goto fail
+        R296:  # quant 0..Inf none
+          local_branch cstack, R296_repeat
+          if cutmark != 299 goto fail
+          cutmark = 0
+          goto fail
+        R296_repeat:
+          push ustack, pos
+          local_branch cstack, R298
+          pos = pop ustack
+          if cutmark != 0 goto fail
+          local_branch cstack, R297
+          if cutmark != 0 goto fail
+          cutmark = 299
+          goto fail
+        R298: # concat
+        R300: # literal
+          $I0 = pos + 1
+          if $I0 > lastpos goto fail
+          $S0 = substr target, pos, 1
+          
+          if $S0 != "," goto fail
+          pos += 1
+          goto R301
+
+        R301: # subrule ws
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'ws'
+          if $I0 == 0 goto R301_1
+          $P0 = find_method mob, 'ws'
+          goto R301_2
+        R301_1:
+          $P0 = find_name 'ws'
+          unless null $P0 goto R301_2
+          die "Unable to find regex 'ws'"
+        R301_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          
+          pos = $P1
+          local_branch cstack, R302
+          
+          goto fail
+        R302: # subrule value
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'value'
+          if $I0 == 0 goto R302_1
+          $P0 = find_method mob, 'value'
+          goto R302_2
+        R302_1:
+          $P0 = find_name 'value'
+          unless null $P0 goto R302_2
+          die "Unable to find regex 'value'"
+        R302_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'dba'=>"", 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          $I0 = defined captscope["value"]
+if $I0 goto R302_cgen
+$P0 = root_new ['parrot';'ResizablePMCArray']
+captscope["value"] = $P0
+local_branch cstack, R302_cgen
+delete captscope["value"]
+goto fail
+R302_cgen:
+
+          $P2 = captscope["value"]
+push $P2, captob
+          pos = $P1
+          local_branch cstack, R303
+          $P2 = captscope["value"]
+$P2 = pop $P2
+          goto fail
+        R303: # subrule ws
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'ws'
+          if $I0 == 0 goto R303_1
+          $P0 = find_method mob, 'ws'
+          goto R303_2
+        R303_1:
+          $P0 = find_name 'ws'
+          unless null $P0 goto R303_2
+          die "Unable to find regex 'ws'"
+        R303_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          
+          pos = $P1
+          local_branch cstack, R296_repeat
+          
+          goto fail
+        R297: # subrule ws
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'ws'
+          if $I0 == 0 goto R297_1
+          $P0 = find_method mob, 'ws'
+          goto R297_2
+        R297_1:
+          $P0 = find_name 'ws'
+          unless null $P0 goto R297_2
+          die "Unable to find regex 'ws'"
+        R297_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          
+          pos = $P1
+          local_branch cstack, succeed
+          
+          goto fail
+      .end
+
+## <JSON::value>
+.namespace ["JSON"]
+      .sub "value" :method :nsentry 
+          .param pmc adverbs      :slurpy :named
+          .local pmc mob
+          .local string target
+          .local pmc mfrom, mpos
+          .local int cpos, iscont
+          $P0 = get_hll_global ['PGE'], '$!MATCH'
+          (mob, cpos, target, mfrom, mpos, iscont) = $P0.'new'(self, adverbs :flat :named)
+          .local int lastpos
+          lastpos = length target
+          if cpos > lastpos goto fail_rule
+          .local pmc cstack
+          cstack = root_new ['parrot';'ResizableIntegerArray']
+          .local pmc ustack
+          ustack = root_new ['parrot';'ResizablePMCArray']
+          .local pmc captscope, captob
+          captscope = mob
+          .local int pos, rep, cutmark
+        try_match:
+          if cpos > lastpos goto fail_rule
+          mfrom = cpos
+          pos = cpos
+          cutmark = 0
+          local_branch cstack, R
+          if cutmark <= -2 goto fail_cut
+          inc cpos
+          if iscont goto try_match
+        fail_rule:
+          cutmark = -2
+        fail_cut:
+          mob.'_failcut'(cutmark)
+          .return (mob)
+          goto fail_cut
+        succeed:
+          mpos = pos
+          .return (mob)
+        fail:
+          local_return cstack
+        fail_match:
+          cutmark = -3
+          goto fail_cut
+        R:  # alt R304, R305
+          push ustack, pos
+          local_branch cstack, R304
+          pos = pop ustack
+          if cutmark != 0 goto fail
+          goto R305
+
+        R304:  # alt R306, R307
+          push ustack, pos
+          local_branch cstack, R306
+          pos = pop ustack
+          if cutmark != 0 goto fail
+          goto R307
+
+        R306:  # alt R308, R309
+          push ustack, pos
+          local_branch cstack, R308
+          pos = pop ustack
+          if cutmark != 0 goto fail
+          goto R309
+
+        R308:  # alt R310, R311
+          push ustack, pos
+          local_branch cstack, R310
+          pos = pop ustack
+          if cutmark != 0 goto fail
+          goto R311
+
+        R310:  # alt R312, R313
+          push ustack, pos
+          local_branch cstack, R312
+          pos = pop ustack
+          if cutmark != 0 goto fail
+          goto R313
+
+        R312:  # alt R314, R315
+          push ustack, pos
+          local_branch cstack, R314
+          pos = pop ustack
+          if cutmark != 0 goto fail
+          goto R315
+
+        R314:  # alt R316, R317
+          push ustack, pos
+          local_branch cstack, R316
+          pos = pop ustack
+          if cutmark != 0 goto fail
+          goto R317
+
+        R316: # subrule object
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'object'
+          if $I0 == 0 goto R316_1
+          $P0 = find_method mob, 'object'
+          goto R316_2
+        R316_1:
+          $P0 = find_name 'object'
+          unless null $P0 goto R316_2
+          die "Unable to find regex 'object'"
+        R316_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'dba'=>"", 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          captscope["object"] = captob
+
+          pos = $P1
+          local_branch cstack, succeed
+          delete captscope["object"]
+
+          goto fail
+        R317: # subrule array
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'array'
+          if $I0 == 0 goto R317_1
+          $P0 = find_method mob, 'array'
+          goto R317_2
+        R317_1:
+          $P0 = find_name 'array'
+          unless null $P0 goto R317_2
+          die "Unable to find regex 'array'"
+        R317_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'dba'=>"", 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          captscope["array"] = captob
+
+          pos = $P1
+          local_branch cstack, succeed
+          delete captscope["array"]
+
+          goto fail
+        R315: # subrule string
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'string'
+          if $I0 == 0 goto R315_1
+          $P0 = find_method mob, 'string'
+          goto R315_2
+        R315_1:
+          $P0 = find_name 'string'
+          unless null $P0 goto R315_2
+          die "Unable to find regex 'string'"
+        R315_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'dba'=>"", 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          captscope["string"] = captob
+
+          pos = $P1
+          local_branch cstack, succeed
+          delete captscope["string"]
+
+          goto fail
+        R313: # subrule number
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'number'
+          if $I0 == 0 goto R313_1
+          $P0 = find_method mob, 'number'
+          goto R313_2
+        R313_1:
+          $P0 = find_name 'number'
+          unless null $P0 goto R313_2
+          die "Unable to find regex 'number'"
+        R313_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'dba'=>"", 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          captscope["number"] = captob
+
+          pos = $P1
+          local_branch cstack, succeed
+          delete captscope["number"]
+
+          goto fail
+        R311: # literal
+          $I0 = pos + 4
+          if $I0 > lastpos goto fail
+          $S0 = substr target, pos, 4
+          
+          if $S0 != "true" goto fail
+          pos += 4
+          goto succeed
+
+        R309: # literal
+          $I0 = pos + 5
+          if $I0 > lastpos goto fail
+          $S0 = substr target, pos, 5
+          
+          if $S0 != "false" goto fail
+          pos += 5
+          goto succeed
+
+        R307: # literal
+          $I0 = pos + 4
+          if $I0 > lastpos goto fail
+          $S0 = substr target, pos, 4
+          
+          if $S0 != "null" goto fail
+          pos += 4
+          goto succeed
+
+        R305: # grammar subrule PGE::Util::die
+          captob = captscope.'new'(captscope, 'grammar'=>'PGE::Util')
+          captob.'to'(pos)
+          $P0 = get_hll_global ["PGE";"Util"], 'die'
+          captob = $P0(captob, "'not a valid JSON value'", 'dba'=>"")
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          $P1 = pos
+          $P1 = getattribute captob, '$.from'
+          $P1 = pos
+          goto succeed
+      .end
+
+## <JSON::char>
+.namespace ["JSON"]
+      .sub "char" :method :nsentry 
+          .param pmc adverbs      :slurpy :named
+          .local pmc mob
+          .local string target
+          .local pmc mfrom, mpos
+          .local int cpos, iscont
+          $P0 = get_hll_global ['PGE'], '$!MATCH'
+          (mob, cpos, target, mfrom, mpos, iscont) = $P0.'new'(self, adverbs :flat :named)
+          .local int lastpos
+          lastpos = length target
+          if cpos > lastpos goto fail_rule
+          .local pmc cstack
+          cstack = root_new ['parrot';'ResizableIntegerArray']
+          .local pmc ustack
+          ustack = root_new ['parrot';'ResizablePMCArray']
+          .local pmc gpad
+          gpad = root_new ['parrot';'ResizablePMCArray']
+          .local pmc captscope, captob
+          captscope = mob
+          .local int pos, rep, cutmark
+        try_match:
+          if cpos > lastpos goto fail_rule
+          mfrom = cpos
+          pos = cpos
+          cutmark = 0
+          local_branch cstack, R
+          if cutmark <= -2 goto fail_cut
+          inc cpos
+          if iscont goto try_match
+        fail_rule:
+          cutmark = -2
+        fail_cut:
+          mob.'_failcut'(cutmark)
+          .return (mob)
+          goto fail_cut
+        succeed:
+          mpos = pos
+          .return (mob)
+        fail:
+          local_return cstack
+        fail_match:
+          cutmark = -3
+          goto fail_cut
+        R:  # alt R318, R319
+          push ustack, pos
+          local_branch cstack, R318
+          pos = pop ustack
+          if cutmark != 0 goto fail
+          goto R319
+
+        R318:  # alt R320, R321
+          push ustack, pos
+          local_branch cstack, R320
+          pos = pop ustack
+          if cutmark != 0 goto fail
+          goto R321
+
+        R320: # concat
+        R322: # literal
+          $I0 = pos + 1
+          if $I0 > lastpos goto fail
+          $S0 = substr target, pos, 1
+          
+          if $S0 != "\\" goto fail
+          pos += 1
+          goto R323
+
+        R323: # enumcharlist "\"\\/bfnrt"
+          if pos >= lastpos goto fail
+          $S0 = substr target, pos, 1
+          $I0 = index "\"\\/bfnrt", $S0
+          if $I0 < 0 goto fail
+          inc pos
+          goto succeed
+        R321: # concat
+        R324: # literal
+          $I0 = pos + 2
+          if $I0 > lastpos goto fail
+          $S0 = substr target, pos, 2
+          
+          if $S0 != unicode:"\\u" goto fail
+          pos += 2
+          goto R325
+
+        R325:  # quant 4..4 (3) greedy/none
+          push gpad, 0
+          local_branch cstack, R325_repeat
+          $I0 = pop gpad
+          if cutmark != 327 goto fail
+          cutmark = 0
+          goto fail
+        R325_repeat:
+          rep = gpad[-1]
+          if rep >= 4 goto R325_1
+          inc rep
+          gpad[-1] = rep
+          push ustack, pos
+          push ustack, rep
+          local_branch cstack, R326
+          rep = pop ustack
+          pos = pop ustack
+          if cutmark != 0 goto fail
+          dec rep
+        R325_1:
+          if rep < 4 goto fail
+          $I0 = pop gpad
+          push ustack, rep
+          local_branch cstack, succeed
+          rep = pop ustack
+          push gpad, rep
+          if cutmark != 0 goto fail
+          cutmark = 327
+          goto fail
+
+        R326: # subrule xdigit
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'xdigit'
+          if $I0 == 0 goto R326_1
+          $P0 = find_method mob, 'xdigit'
+          goto R326_2
+        R326_1:
+          $P0 = find_name 'xdigit'
+          unless null $P0 goto R326_2
+          die "Unable to find regex 'xdigit'"
+        R326_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'dba'=>"", 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          $I0 = defined captscope["xdigit"]
+if $I0 goto R326_cgen
+$P0 = root_new ['parrot';'ResizablePMCArray']
+captscope["xdigit"] = $P0
+local_branch cstack, R326_cgen
+delete captscope["xdigit"]
+goto fail
+R326_cgen:
+
+          $P2 = captscope["xdigit"]
+push $P2, captob
+          pos = $P1
+          local_branch cstack, R326_3
+          $P2 = captscope["xdigit"]
+$P2 = pop $P2
+          goto fail
+        R326_3:
+          pos = $P1
+          $P1 = getattribute captob, '&!corou'
+          if null $P1 goto R325_repeat
+          push ustack, captob
+          local_branch cstack, R325_repeat
+          captob = pop ustack
+          if cutmark != 0 goto fail
+          captob.'next'()
+          $P1 = getattribute captob, '$.pos'
+          if $P1 >= 0 goto R326_3
+          if $P1 <= -3 goto fail_match
+          goto fail
+
+        R319: # concat
+        R328: # enumcharlist "\\\""
+          if pos >= lastpos goto fail
+          $S0 = substr target, pos, 1
+          $I0 = index "\\\"", $S0
+          if $I0 >= 0 goto fail
+          ###   zero width
+          goto R329
+        R329: # cclass .
+          if pos >= lastpos goto fail
+          inc pos
+          goto succeed
+      .end
+
+## <JSON::number>
+.namespace ["JSON"]
+      .sub "number" :method :nsentry 
+          .param pmc adverbs      :slurpy :named
+          .local pmc mob
+          .local string target
+          .local pmc mfrom, mpos
+          .local int cpos, iscont
+          $P0 = get_hll_global ['PGE'], '$!MATCH'
+          (mob, cpos, target, mfrom, mpos, iscont) = $P0.'new'(self, adverbs :flat :named)
+          .local int lastpos
+          lastpos = length target
+          if cpos > lastpos goto fail_rule
+          .local pmc cstack
+          cstack = root_new ['parrot';'ResizableIntegerArray']
+          .local pmc ustack
+          ustack = root_new ['parrot';'ResizablePMCArray']
+          .local pmc gpad
+          gpad = root_new ['parrot';'ResizablePMCArray']
+          .local pmc captscope, captob
+          captscope = mob
+          .local int pos, rep, cutmark
+        try_match:
+          if cpos > lastpos goto fail_rule
+          mfrom = cpos
+          pos = cpos
+          cutmark = 0
+          local_branch cstack, R
+          if cutmark <= -2 goto fail_cut
+          inc cpos
+          if iscont goto try_match
+        fail_rule:
+          cutmark = -2
+        fail_cut:
+          mob.'_failcut'(cutmark)
+          .return (mob)
+          goto fail_cut
+        succeed:
+          mpos = pos
+          .return (mob)
+        fail:
+          local_return cstack
+        fail_match:
+          cutmark = -3
+          goto fail_cut
+        R: # concat
+        R333: # subrule ws
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'ws'
+          if $I0 == 0 goto R333_1
+          $P0 = find_method mob, 'ws'
+          goto R333_2
+        R333_1:
+          $P0 = find_name 'ws'
+          unless null $P0 goto R333_2
+          die "Unable to find regex 'ws'"
+        R333_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'dba'=>"", 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          
+          pos = $P1
+          local_branch cstack, R334
+          
+          goto fail
+        R334:  # quant 0..1 (3) greedy/none
+          push gpad, 0
+          local_branch cstack, R334_repeat
+          $I0 = pop gpad
+          if cutmark != 337 goto fail
+          cutmark = 0
+          goto fail
+        R334_repeat:
+          rep = gpad[-1]
+          if rep >= 1 goto R334_1
+          inc rep
+          gpad[-1] = rep
+          push ustack, pos
+          push ustack, rep
+          local_branch cstack, R336
+          rep = pop ustack
+          pos = pop ustack
+          if cutmark != 0 goto fail
+          dec rep
+        R334_1:
+          ### if rep < 0 goto fail
+          $I0 = pop gpad
+          push ustack, rep
+          local_branch cstack, R335
+          rep = pop ustack
+          push gpad, rep
+          if cutmark != 0 goto fail
+          cutmark = 337
+          goto fail
+
+        R336: # literal
+          $I0 = pos + 1
+          if $I0 > lastpos goto fail
+          $S0 = substr target, pos, 1
+          
+          if $S0 != "-" goto fail
+          pos += 1
+          goto R334_repeat
+
+        R335:  # group 332
+          local_branch cstack, R339
+          if cutmark != 332 goto fail
+          cutmark = 0
+          goto fail
+
+        R339: # concat
+        R340:  # alt R342, R343
+          push ustack, pos
+          local_branch cstack, R342
+          pos = pop ustack
+          if cutmark != 0 goto fail
+          goto R343
+
+        R342: # concat
+        R344: # enumcharlist "123456789"
+          if pos >= lastpos goto fail
+          $S0 = substr target, pos, 1
+          $I0 = index "123456789", $S0
+          if $I0 < 0 goto fail
+          inc pos
+          goto R345
+        R345:  # quant 1..2147483647 (3) greedy/none
+          push gpad, 0
+          local_branch cstack, R345_repeat
+          $I0 = pop gpad
+          if cutmark != 347 goto fail
+          cutmark = 0
+          goto fail
+        R345_repeat:
+          rep = gpad[-1]
+          ### if rep >= 2147483647 goto R345_1
+          inc rep
+          gpad[-1] = rep
+          push ustack, pos
+          push ustack, rep
+          local_branch cstack, R346
+          rep = pop ustack
+          pos = pop ustack
+          if cutmark != 0 goto fail
+          dec rep
+        R345_1:
+          if rep < 1 goto fail
+          $I0 = pop gpad
+          push ustack, rep
+          local_branch cstack, R341
+          rep = pop ustack
+          push gpad, rep
+          if cutmark != 0 goto fail
+          cutmark = 347
+          goto fail
+
+        R346: # enumcharlist "0123456789"
+          if pos >= lastpos goto fail
+          $S0 = substr target, pos, 1
+          $I0 = index "0123456789", $S0
+          if $I0 < 0 goto fail
+          inc pos
+          goto R345_repeat
+        R343: # enumcharlist "0123456789"
+          if pos >= lastpos goto fail
+          $S0 = substr target, pos, 1
+          $I0 = index "0123456789", $S0
+          if $I0 < 0 goto fail
+          inc pos
+          goto R341
+        R341: # cut 332
+          local_branch cstack, R338
+          cutmark = 332
+          goto fail
+
+        R338:  # quant 0..1 (3) greedy/none
+          push gpad, 0
+          local_branch cstack, R338_repeat
+          $I0 = pop gpad
+          if cutmark != 350 goto fail
+          cutmark = 0
+          goto fail
+        R338_repeat:
+          rep = gpad[-1]
+          if rep >= 1 goto R338_1
+          inc rep
+          gpad[-1] = rep
+          push ustack, pos
+          push ustack, rep
+          local_branch cstack, R349
+          rep = pop ustack
+          pos = pop ustack
+          if cutmark != 0 goto fail
+          dec rep
+        R338_1:
+          ### if rep < 0 goto fail
+          $I0 = pop gpad
+          push ustack, rep
+          local_branch cstack, R348
+          rep = pop ustack
+          push gpad, rep
+          if cutmark != 0 goto fail
+          cutmark = 350
+          goto fail
+
+        R349:  # group 331
+          local_branch cstack, R351
+          if cutmark != 331 goto fail
+          cutmark = 0
+          goto fail
+
+        R351: # concat
+        R352: # concat
+        R354: # literal
+          $I0 = pos + 1
+          if $I0 > lastpos goto fail
+          $S0 = substr target, pos, 1
+          
+          if $S0 != "." goto fail
+          pos += 1
+          goto R355
+
+        R355:  # quant 1..2147483647 (3) greedy/none
+          push gpad, 0
+          local_branch cstack, R355_repeat
+          $I0 = pop gpad
+          if cutmark != 357 goto fail
+          cutmark = 0
+          goto fail
+        R355_repeat:
+          rep = gpad[-1]
+          ### if rep >= 2147483647 goto R355_1
+          inc rep
+          gpad[-1] = rep
+          push ustack, pos
+          push ustack, rep
+          local_branch cstack, R356
+          rep = pop ustack
+          pos = pop ustack
+          if cutmark != 0 goto fail
+          dec rep
+        R355_1:
+          if rep < 1 goto fail
+          $I0 = pop gpad
+          push ustack, rep
+          local_branch cstack, R353
+          rep = pop ustack
+          push gpad, rep
+          if cutmark != 0 goto fail
+          cutmark = 357
+          goto fail
+
+        R356: # enumcharlist "0123456789"
+          if pos >= lastpos goto fail
+          $S0 = substr target, pos, 1
+          $I0 = index "0123456789", $S0
+          if $I0 < 0 goto fail
+          inc pos
+          goto R355_repeat
+        R353: # cut 331
+          local_branch cstack, R338_repeat
+          cutmark = 331
+          goto fail
+
+        R348:  # quant 0..1 (3) greedy/none
+          push gpad, 0
+          local_branch cstack, R348_repeat
+          $I0 = pop gpad
+          if cutmark != 360 goto fail
+          cutmark = 0
+          goto fail
+        R348_repeat:
+          rep = gpad[-1]
+          if rep >= 1 goto R348_1
+          inc rep
+          gpad[-1] = rep
+          push ustack, pos
+          push ustack, rep
+          local_branch cstack, R359
+          rep = pop ustack
+          pos = pop ustack
+          if cutmark != 0 goto fail
+          dec rep
+        R348_1:
+          ### if rep < 0 goto fail
+          $I0 = pop gpad
+          push ustack, rep
+          local_branch cstack, R358
+          rep = pop ustack
+          push gpad, rep
+          if cutmark != 0 goto fail
+          cutmark = 360
+          goto fail
+
+        R359:  # group 330
+          local_branch cstack, R361
+          if cutmark != 330 goto fail
+          cutmark = 0
+          goto fail
+
+        R361: # concat
+        R362: # concat
+        R364: # enumcharlist "Ee"
+          if pos >= lastpos goto fail
+          $S0 = substr target, pos, 1
+          $I0 = index "Ee", $S0
+          if $I0 < 0 goto fail
+          inc pos
+          goto R365
+        R365:  # quant 0..1 (3) greedy/none
+          push gpad, 0
+          local_branch cstack, R365_repeat
+          $I0 = pop gpad
+          if cutmark != 368 goto fail
+          cutmark = 0
+          goto fail
+        R365_repeat:
+          rep = gpad[-1]
+          if rep >= 1 goto R365_1
+          inc rep
+          gpad[-1] = rep
+          push ustack, pos
+          push ustack, rep
+          local_branch cstack, R367
+          rep = pop ustack
+          pos = pop ustack
+          if cutmark != 0 goto fail
+          dec rep
+        R365_1:
+          ### if rep < 0 goto fail
+          $I0 = pop gpad
+          push ustack, rep
+          local_branch cstack, R366
+          rep = pop ustack
+          push gpad, rep
+          if cutmark != 0 goto fail
+          cutmark = 368
+          goto fail
+
+        R367: # enumcharlist "+-"
+          if pos >= lastpos goto fail
+          $S0 = substr target, pos, 1
+          $I0 = index "+-", $S0
+          if $I0 < 0 goto fail
+          inc pos
+          goto R365_repeat
+        R366:  # quant 1..2147483647 (3) greedy/none
+          push gpad, 0
+          local_branch cstack, R366_repeat
+          $I0 = pop gpad
+          if cutmark != 370 goto fail
+          cutmark = 0
+          goto fail
+        R366_repeat:
+          rep = gpad[-1]
+          ### if rep >= 2147483647 goto R366_1
+          inc rep
+          gpad[-1] = rep
+          push ustack, pos
+          push ustack, rep
+          local_branch cstack, R369
+          rep = pop ustack
+          pos = pop ustack
+          if cutmark != 0 goto fail
+          dec rep
+        R366_1:
+          if rep < 1 goto fail
+          $I0 = pop gpad
+          push ustack, rep
+          local_branch cstack, R363
+          rep = pop ustack
+          push gpad, rep
+          if cutmark != 0 goto fail
+          cutmark = 370
+          goto fail
+
+        R369: # enumcharlist "0123456789"
+          if pos >= lastpos goto fail
+          $S0 = substr target, pos, 1
+          $I0 = index "0123456789", $S0
+          if $I0 < 0 goto fail
+          inc pos
+          goto R366_repeat
+        R363: # cut 330
+          local_branch cstack, R348_repeat
+          cutmark = 330
+          goto fail
+
+        R358: # subrule ws
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'ws'
+          if $I0 == 0 goto R358_1
+          $P0 = find_method mob, 'ws'
+          goto R358_2
+        R358_1:
+          $P0 = find_name 'ws'
+          unless null $P0 goto R358_2
+          die "Unable to find regex 'ws'"
+        R358_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'dba'=>"", 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          
+          pos = $P1
+          local_branch cstack, succeed
+          
+          goto fail
+      .end
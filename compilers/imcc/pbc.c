@@ -1176,6 +1176,7 @@ add_const_str(ARGMOD(imc_info_t * imcc), ARGIN(STRING *s),
         ct->string_hash = Parrot_hash_create(imcc->interp, enum_type_INTVAL,
                 Hash_key_type_STRING_enc);
 
+    s = Parrot_str_intern(imcc->interp, s);
     ct->str.constants[ct->str.const_count] = s;
 
     Parrot_hash_put(imcc->interp, ct->string_hash, s,
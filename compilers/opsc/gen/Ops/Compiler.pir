@@ -0,0 +1,123 @@
+
+.namespace []
+.sub "_block1000"  :anon :subid("10_1792415671.34917")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler.pm"
+.annotate 'line', 0
+    .const 'Sub' $P1003 = "11_1792415671.34917" 
+    capture_lex $P1003
+.annotate 'line', 1
+    $P0 = find_dynamic_lex "$*CTXSAVE"
+    if null $P0 goto ctxsave_done
+    $I0 = can $P0, "ctxsave"
+    unless $I0 goto ctxsave_done
+    $P0."ctxsave"()
+  ctxsave_done:
+.annotate 'line', 6
+    .const 'Sub' $P1003 = "11_1792415671.34917" 
+    capture_lex $P1003
+    $P101 = $P1003()
+.annotate 'line', 1
+    .return ($P101)
+    .const 'Sub' $P1013 = "14_1792415671.34917" 
+    .return ($P1013)
+.end
+
+
+.namespace []
+.sub "" :load :init :subid("post15") :outer("10_1792415671.34917")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler.pm"
+.annotate 'line', 0
+    .const 'Sub' $P1001 = "10_1792415671.34917" 
+    .local pmc block
+    set block, $P1001
+    $P1015 = get_root_global ["parrot"], "P6metaclass"
+    $P1015."new_class"("Ops::Compiler", "HLL::Compiler" :named("parent"))
+.end
+
+
+.namespace ["Ops";"Compiler"]
+.sub "_block1002"  :subid("11_1792415671.34917") :outer("10_1792415671.34917")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler.pm"
+.annotate 'line', 6
+    .const 'Sub' $P1004 = "12_1792415671.34917" 
+    capture_lex $P1004
+    $P0 = find_dynamic_lex "$*CTXSAVE"
+    if null $P0 goto ctxsave_done
+    $I0 = can $P0, "ctxsave"
+    unless $I0 goto ctxsave_done
+    $P0."ctxsave"()
+  ctxsave_done:
+.annotate 'line', 12
+    .const 'Sub' $P1004 = "12_1792415671.34917" 
+    newclosure $P1008, $P1004
+.annotate 'line', 6
+    .return ($P1008)
+    .const 'Sub' $P1010 = "13_1792415671.34917" 
+    .return ($P1010)
+.end
+
+
+.namespace ["Ops";"Compiler"]
+.sub "" :load :init :subid("post16") :outer("11_1792415671.34917")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler.pm"
+.annotate 'line', 6
+    .const 'Sub' $P1003 = "11_1792415671.34917" 
+    .local pmc block
+    set block, $P1003
+.annotate 'line', 7
+    get_hll_global $P101, ["Ops"], "Compiler"
+    $P101."language"("Ops")
+.annotate 'line', 8
+    get_hll_global $P101, ["Ops"], "Compiler"
+    get_hll_global $P102, ["Ops";"Compiler"], "Grammar"
+    $P101."parsegrammar"($P102)
+.annotate 'line', 9
+    get_hll_global $P101, ["Ops"], "Compiler"
+    get_hll_global $P102, ["Ops";"Compiler"], "Actions"
+    $P101."parseactions"($P102)
+.end
+
+
+.namespace ["Ops";"Compiler"]
+.include "except_types.pasm"
+.sub "set_oplib"  :subid("12_1792415671.34917") :method :outer("11_1792415671.34917")
+    .param pmc param_1007
+.annotate 'file', "compilers/opsc/src/Ops/Compiler.pm"
+.annotate 'line', 12
+    new $P1006, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1006, control_1005
+    push_eh $P1006
+    .lex "self", self
+    .lex "$oplib", param_1007
+.annotate 'line', 13
+    find_lex $P100, "$oplib"
+    set_hll_global ["Ops";"Compiler";"Actions"], "$OPLIB", $P100
+.annotate 'line', 12
+    .return ($P100)
+  control_1005:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler"]
+.sub "_block1009" :load :anon :subid("13_1792415671.34917")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler.pm"
+.annotate 'line', 6
+    .const '' $P1011 = "11_1792415671.34917" 
+    $P100 = $P1011()
+    .return ($P100)
+.end
+
+
+.namespace []
+.sub "_block1012" :load :anon :subid("14_1792415671.34917")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler.pm"
+.annotate 'line', 1
+    .const '' $P1014 = "10_1792415671.34917" 
+    $P100 = $P1014()
+    .return ($P100)
+.end
+
@@ -0,0 +1,4190 @@
+
+.namespace []
+.sub "_block1000"  :anon :subid("10_1792415686.05651")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 0
+    .const 'Sub' $P1003 = "11_1792415686.05651" 
+    capture_lex $P1003
+.annotate 'line', 1
+    $P0 = find_dynamic_lex "$*CTXSAVE"
+    if null $P0 goto ctxsave_done
+    $I0 = can $P0, "ctxsave"
+    unless $I0 goto ctxsave_done
+    $P0."ctxsave"()
+  ctxsave_done:
+.annotate 'line', 6
+    .const 'Sub' $P1003 = "11_1792415686.05651" 
+    capture_lex $P1003
+    $P108 = $P1003()
+.annotate 'line', 1
+    .return ($P108)
+    .const 'Sub' $P1527 = "80_1792415686.05651" 
+    .return ($P1527)
+.end
+
+
+.namespace []
+.sub "" :load :init :subid("post81") :outer("10_1792415686.05651")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 0
+    .const 'Sub' $P1001 = "10_1792415686.05651" 
+    .local pmc block
+    set block, $P1001
+    $P1529 = get_root_global ["parrot"], "P6metaclass"
+    $P1529."new_class"("Ops::Compiler::Actions", "HLL::Actions" :named("parent"))
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.sub "_block1002"  :subid("11_1792415686.05651") :outer("10_1792415686.05651")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 6
+    .const 'Sub' $P1519 = "78_1792415686.05651" 
+    capture_lex $P1519
+    .const 'Sub' $P1516 = "77_1792415686.05651" 
+    capture_lex $P1516
+    .const 'Sub' $P1511 = "76_1792415686.05651" 
+    capture_lex $P1511
+    .const 'Sub' $P1506 = "75_1792415686.05651" 
+    capture_lex $P1506
+    .const 'Sub' $P1499 = "74_1792415686.05651" 
+    capture_lex $P1499
+    .const 'Sub' $P1491 = "73_1792415686.05651" 
+    capture_lex $P1491
+    .const 'Sub' $P1485 = "72_1792415686.05651" 
+    capture_lex $P1485
+    .const 'Sub' $P1479 = "71_1792415686.05651" 
+    capture_lex $P1479
+    .const 'Sub' $P1472 = "70_1792415686.05651" 
+    capture_lex $P1472
+    .const 'Sub' $P1454 = "69_1792415686.05651" 
+    capture_lex $P1454
+    .const 'Sub' $P1447 = "68_1792415686.05651" 
+    capture_lex $P1447
+    .const 'Sub' $P1440 = "67_1792415686.05651" 
+    capture_lex $P1440
+    .const 'Sub' $P1429 = "66_1792415686.05651" 
+    capture_lex $P1429
+    .const 'Sub' $P1423 = "65_1792415686.05651" 
+    capture_lex $P1423
+    .const 'Sub' $P1418 = "64_1792415686.05651" 
+    capture_lex $P1418
+    .const 'Sub' $P1413 = "63_1792415686.05651" 
+    capture_lex $P1413
+    .const 'Sub' $P1409 = "62_1792415686.05651" 
+    capture_lex $P1409
+    .const 'Sub' $P1404 = "61_1792415686.05651" 
+    capture_lex $P1404
+    .const 'Sub' $P1399 = "60_1792415686.05651" 
+    capture_lex $P1399
+    .const 'Sub' $P1391 = "59_1792415686.05651" 
+    capture_lex $P1391
+    .const 'Sub' $P1376 = "57_1792415686.05651" 
+    capture_lex $P1376
+    .const 'Sub' $P1372 = "56_1792415686.05651" 
+    capture_lex $P1372
+    .const 'Sub' $P1366 = "55_1792415686.05651" 
+    capture_lex $P1366
+    .const 'Sub' $P1355 = "54_1792415686.05651" 
+    capture_lex $P1355
+    .const 'Sub' $P1344 = "53_1792415686.05651" 
+    capture_lex $P1344
+    .const 'Sub' $P1328 = "52_1792415686.05651" 
+    capture_lex $P1328
+    .const 'Sub' $P1311 = "51_1792415686.05651" 
+    capture_lex $P1311
+    .const 'Sub' $P1299 = "50_1792415686.05651" 
+    capture_lex $P1299
+    .const 'Sub' $P1285 = "48_1792415686.05651" 
+    capture_lex $P1285
+    .const 'Sub' $P1260 = "46_1792415686.05651" 
+    capture_lex $P1260
+    .const 'Sub' $P1241 = "42_1792415686.05651" 
+    capture_lex $P1241
+    .const 'Sub' $P1231 = "40_1792415686.05651" 
+    capture_lex $P1231
+    .const 'Sub' $P1225 = "39_1792415686.05651" 
+    capture_lex $P1225
+    .const 'Sub' $P1219 = "38_1792415686.05651" 
+    capture_lex $P1219
+    .const 'Sub' $P1215 = "37_1792415686.05651" 
+    capture_lex $P1215
+    .const 'Sub' $P1208 = "36_1792415686.05651" 
+    capture_lex $P1208
+    .const 'Sub' $P1203 = "35_1792415686.05651" 
+    capture_lex $P1203
+    .const 'Sub' $P1196 = "34_1792415686.05651" 
+    capture_lex $P1196
+    .const 'Sub' $P1191 = "33_1792415686.05651" 
+    capture_lex $P1191
+    .const 'Sub' $P1186 = "32_1792415686.05651" 
+    capture_lex $P1186
+    .const 'Sub' $P1177 = "31_1792415686.05651" 
+    capture_lex $P1177
+    .const 'Sub' $P1167 = "29_1792415686.05651" 
+    capture_lex $P1167
+    .const 'Sub' $P1114 = "23_1792415686.05651" 
+    capture_lex $P1114
+    .const 'Sub' $P1109 = "22_1792415686.05651" 
+    capture_lex $P1109
+    .const 'Sub' $P1079 = "18_1792415686.05651" 
+    capture_lex $P1079
+    .const 'Sub' $P1074 = "17_1792415686.05651" 
+    capture_lex $P1074
+    .const 'Sub' $P1045 = "14_1792415686.05651" 
+    capture_lex $P1045
+    .const 'Sub' $P1005 = "12_1792415686.05651" 
+    capture_lex $P1005
+    get_global $P100, "$OP"
+    unless_null $P100, vivify_83
+    new $P100, "Undef"
+    set_global "$OP", $P100
+  vivify_83:
+.annotate 'line', 7
+    get_global $P101, "$OPLIB"
+    unless_null $P101, vivify_84
+    new $P101, "Undef"
+    set_global "$OPLIB", $P101
+  vivify_84:
+.annotate 'line', 128
+    .const 'Sub' $P1005 = "12_1792415686.05651" 
+    newclosure $P1043, $P1005
+    set $P1004, $P1043
+    .lex "normalize_args", $P1004
+.annotate 'line', 183
+    .const 'Sub' $P1045 = "14_1792415686.05651" 
+    newclosure $P1073, $P1045
+    set $P1044, $P1073
+    .lex "expand_args", $P1044
+.annotate 'line', 6
+    $P0 = find_dynamic_lex "$*CTXSAVE"
+    if null $P0 goto ctxsave_done
+    $I0 = can $P0, "ctxsave"
+    unless $I0 goto ctxsave_done
+    $P0."ctxsave"()
+  ctxsave_done:
+    get_global $P107, "$OP"
+    get_global $P107, "$OPLIB"
+    find_lex $P107, "normalize_args"
+    find_lex $P107, "expand_args"
+.annotate 'line', 647
+    .const 'Sub' $P1519 = "78_1792415686.05651" 
+    newclosure $P1522, $P1519
+.annotate 'line', 6
+    .return ($P1522)
+    .const 'Sub' $P1524 = "79_1792415686.05651" 
+    .return ($P1524)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.sub "" :load :init :subid("post82") :outer("11_1792415686.05651")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 6
+    .const 'Sub' $P1003 = "11_1792415686.05651" 
+    .local pmc block
+    set block, $P1003
+.annotate 'line', 10
+    load_bytecode "nqp-setting.pbc"
+.annotate 'line', 11
+    new $P108, "Integer"
+    assign $P108, 0
+    set_global "$OPLIB", $P108
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "normalize_args"  :subid("12_1792415686.05651") :outer("11_1792415686.05651")
+    .param pmc param_1008
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 128
+    .const 'Sub' $P1012 = "13_1792415686.05651" 
+    capture_lex $P1012
+    new $P1007, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1007, control_1006
+    push_eh $P1007
+    .lex "@args", param_1008
+.annotate 'line', 129
+    $P1010 = root_new ['parrot';'ResizablePMCArray']
+    set $P1009, $P1010
+    .lex "@result", $P1009
+.annotate 'line', 128
+    find_lex $P102, "@result"
+.annotate 'line', 130
+    find_lex $P103, "@args"
+    defined $I100, $P103
+    unless $I100, for_undef_85
+    iter $P102, $P103
+    new $P107, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P107, loop1042_handler
+    push_eh $P107
+  loop1042_test:
+    unless $P102, loop1042_done
+    shift $P104, $P102
+  loop1042_redo:
+    .const 'Sub' $P1012 = "13_1792415686.05651" 
+    capture_lex $P1012
+    $P1012($P104)
+  loop1042_next:
+    goto loop1042_test
+  loop1042_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P108, exception, 'type'
+    eq $P108, .CONTROL_LOOP_NEXT, loop1042_next
+    eq $P108, .CONTROL_LOOP_REDO, loop1042_redo
+  loop1042_done:
+    pop_eh 
+  for_undef_85:
+.annotate 'line', 128
+    find_lex $P102, "@result"
+    .return ($P102)
+  control_1006:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P103, exception, "payload"
+    .return ($P103)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.sub "_block1011"  :anon :subid("13_1792415686.05651") :outer("12_1792415686.05651")
+    .param pmc param_1013
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 130
+    .lex "$arg", param_1013
+.annotate 'line', 131
+    new $P105, "Undef"
+    set $P1014, $P105
+    .lex "$res", $P1014
+.annotate 'line', 150
+    new $P106, "Undef"
+    set $P1015, $P106
+    .lex "$use", $P1015
+.annotate 'line', 131
+    get_hll_global $P107, ["PAST"], "Var"
+    $P108 = $P107."new"(1 :named("isdecl"))
+    store_lex "$res", $P108
+.annotate 'line', 135
+    find_lex $P1017, "$arg"
+    unless_null $P1017, vivify_86
+    $P1017 = root_new ['parrot';'Hash']
+  vivify_86:
+    set $P107, $P1017["type"]
+    unless_null $P107, vivify_87
+    new $P107, "Undef"
+  vivify_87:
+    set $S100, $P107
+    iseq $I101, $S100, "LABEL"
+    if $I101, if_1016
+.annotate 'line', 140
+    new $P108, "Integer"
+    assign $P108, 0
+    find_lex $P1020, "$res"
+    unless_null $P1020, vivify_88
+    $P1020 = root_new ['parrot';'Hash']
+    store_lex "$res", $P1020
+  vivify_88:
+    set $P1020["is_label"], $P108
+.annotate 'line', 139
+    goto if_1016_end
+  if_1016:
+.annotate 'line', 136
+    new $P108, "String"
+    assign $P108, "i"
+    find_lex $P1018, "$res"
+    unless_null $P1018, vivify_89
+    $P1018 = root_new ['parrot';'Hash']
+    store_lex "$res", $P1018
+  vivify_89:
+    set $P1018["type"], $P108
+.annotate 'line', 137
+    new $P108, "Integer"
+    assign $P108, 1
+    find_lex $P1019, "$res"
+    unless_null $P1019, vivify_90
+    $P1019 = root_new ['parrot';'Hash']
+    store_lex "$res", $P1019
+  vivify_90:
+    set $P1019["is_label"], $P108
+  if_1016_end:
+.annotate 'line', 143
+    find_lex $P1022, "$arg"
+    unless_null $P1022, vivify_91
+    $P1022 = root_new ['parrot';'Hash']
+  vivify_91:
+    set $P107, $P1022["type"]
+    unless_null $P107, vivify_92
+    new $P107, "Undef"
+  vivify_92:
+    set $S100, $P107
+    iseq $I101, $S100, "INTKEY"
+    if $I101, if_1021
+.annotate 'line', 146
+    find_lex $P1025, "$arg"
+    unless_null $P1025, vivify_93
+    $P1025 = root_new ['parrot';'Hash']
+  vivify_93:
+    set $P108, $P1025["type"]
+    unless_null $P108, vivify_94
+    new $P108, "Undef"
+  vivify_94:
+    set $S101, $P108
+    isne $I102, $S101, "LABEL"
+    unless $I102, if_1024_end
+.annotate 'line', 147
+    find_lex $P1026, "$arg"
+    unless_null $P1026, vivify_95
+    $P1026 = root_new ['parrot';'Hash']
+  vivify_95:
+    set $P109, $P1026["type"]
+    unless_null $P109, vivify_96
+    new $P109, "Undef"
+  vivify_96:
+    $P110 = "substr"($P109, 0, 1)
+    $P111 = "lc"($P110)
+    find_lex $P1027, "$res"
+    unless_null $P1027, vivify_97
+    $P1027 = root_new ['parrot';'Hash']
+    store_lex "$res", $P1027
+  vivify_97:
+    set $P1027["type"], $P111
+  if_1024_end:
+.annotate 'line', 146
+    goto if_1021_end
+  if_1021:
+.annotate 'line', 144
+    new $P108, "String"
+    assign $P108, "ki"
+    find_lex $P1023, "$res"
+    unless_null $P1023, vivify_98
+    $P1023 = root_new ['parrot';'Hash']
+    store_lex "$res", $P1023
+  vivify_98:
+    set $P1023["type"], $P108
+  if_1021_end:
+.annotate 'line', 150
+    find_lex $P1028, "$arg"
+    unless_null $P1028, vivify_99
+    $P1028 = root_new ['parrot';'Hash']
+  vivify_99:
+    set $P107, $P1028["direction"]
+    unless_null $P107, vivify_100
+    new $P107, "Undef"
+  vivify_100:
+    store_lex "$use", $P107
+.annotate 'line', 152
+    find_lex $P107, "$use"
+    set $S100, $P107
+    iseq $I101, $S100, "in"
+    if $I101, if_1029
+.annotate 'line', 156
+    find_lex $P108, "$use"
+    set $S101, $P108
+    iseq $I102, $S101, "invar"
+    if $I102, if_1033
+.annotate 'line', 159
+    find_lex $P109, "$use"
+    set $S102, $P109
+    iseq $I103, $S102, "inconst"
+    if $I103, if_1035
+.annotate 'line', 163
+    find_lex $P110, "$use"
+    set $S103, $P110
+    iseq $I104, $S103, "inout"
+    if $I104, if_1039
+.annotate 'line', 167
+    new $P111, "String"
+    assign $P111, "o"
+    find_lex $P1041, "$res"
+    unless_null $P1041, vivify_101
+    $P1041 = root_new ['parrot';'Hash']
+    store_lex "$res", $P1041
+  vivify_101:
+    set $P1041["direction"], $P111
+.annotate 'line', 166
+    goto if_1039_end
+  if_1039:
+.annotate 'line', 164
+    new $P111, "String"
+    assign $P111, "io"
+    find_lex $P1040, "$res"
+    unless_null $P1040, vivify_102
+    $P1040 = root_new ['parrot';'Hash']
+    store_lex "$res", $P1040
+  vivify_102:
+    set $P1040["direction"], $P111
+  if_1039_end:
+.annotate 'line', 163
+    goto if_1035_end
+  if_1035:
+.annotate 'line', 160
+    find_lex $P1036, "$res"
+    unless_null $P1036, vivify_103
+    $P1036 = root_new ['parrot';'Hash']
+  vivify_103:
+    set $P110, $P1036["type"]
+    unless_null $P110, vivify_104
+    new $P110, "Undef"
+  vivify_104:
+    concat $P111, $P110, "c"
+    find_lex $P1037, "$res"
+    unless_null $P1037, vivify_105
+    $P1037 = root_new ['parrot';'Hash']
+    store_lex "$res", $P1037
+  vivify_105:
+    set $P1037["type"], $P111
+.annotate 'line', 161
+    new $P110, "String"
+    assign $P110, "i"
+    find_lex $P1038, "$res"
+    unless_null $P1038, vivify_106
+    $P1038 = root_new ['parrot';'Hash']
+    store_lex "$res", $P1038
+  vivify_106:
+    set $P1038["direction"], $P110
+  if_1035_end:
+.annotate 'line', 159
+    goto if_1033_end
+  if_1033:
+.annotate 'line', 157
+    new $P109, "String"
+    assign $P109, "i"
+    find_lex $P1034, "$res"
+    unless_null $P1034, vivify_107
+    $P1034 = root_new ['parrot';'Hash']
+    store_lex "$res", $P1034
+  vivify_107:
+    set $P1034["direction"], $P109
+  if_1033_end:
+.annotate 'line', 156
+    goto if_1029_end
+  if_1029:
+.annotate 'line', 153
+    find_lex $P1030, "$res"
+    unless_null $P1030, vivify_108
+    $P1030 = root_new ['parrot';'Hash']
+  vivify_108:
+    set $P108, $P1030["type"]
+    unless_null $P108, vivify_109
+    new $P108, "Undef"
+  vivify_109:
+    concat $P109, $P108, "c"
+    find_lex $P1031, "$res"
+    unless_null $P1031, vivify_110
+    $P1031 = root_new ['parrot';'Hash']
+    store_lex "$res", $P1031
+  vivify_110:
+    set $P1031["variant"], $P109
+.annotate 'line', 154
+    new $P108, "String"
+    assign $P108, "i"
+    find_lex $P1032, "$res"
+    unless_null $P1032, vivify_111
+    $P1032 = root_new ['parrot';'Hash']
+    store_lex "$res", $P1032
+  vivify_111:
+    set $P1032["direction"], $P108
+  if_1029_end:
+.annotate 'line', 170
+    find_lex $P107, "@result"
+    find_lex $P108, "$res"
+    $P109 = $P107."push"($P108)
+.annotate 'line', 130
+    .return ($P109)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "expand_args"  :subid("14_1792415686.05651") :outer("11_1792415686.05651")
+    .param pmc param_1048
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 183
+    .const 'Sub' $P1063 = "15_1792415686.05651" 
+    capture_lex $P1063
+    new $P1047, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1047, control_1046
+    push_eh $P1047
+    .lex "@args", param_1048
+.annotate 'line', 187
+    new $P104, "Undef"
+    set $P1049, $P104
+    .lex "$arg", $P1049
+.annotate 'line', 189
+    $P1051 = root_new ['parrot';'ResizablePMCArray']
+    set $P1050, $P1051
+    .lex "@var", $P1050
+.annotate 'line', 194
+    $P1053 = root_new ['parrot';'ResizablePMCArray']
+    set $P1052, $P1053
+    .lex "@list", $P1052
+.annotate 'line', 199
+    $P1055 = root_new ['parrot';'ResizablePMCArray']
+    set $P1054, $P1055
+    .lex "@results", $P1054
+.annotate 'line', 185
+    find_lex $P105, "@args"
+    if $P105, unless_1056_end
+    new $P106, "Exception"
+    set $P106['type'], .CONTROL_RETURN
+    $P107 = "list"()
+    setattribute $P106, 'payload', $P107
+    throw $P106
+  unless_1056_end:
+.annotate 'line', 187
+    find_lex $P105, "@args"
+    $P106 = $P105."shift"()
+    store_lex "$arg", $P106
+.annotate 'line', 189
+    find_lex $P1057, "$arg"
+    unless_null $P1057, vivify_112
+    $P1057 = root_new ['parrot';'Hash']
+  vivify_112:
+    set $P105, $P1057["type"]
+    unless_null $P105, vivify_113
+    new $P105, "Undef"
+  vivify_113:
+    $P106 = "list"($P105)
+    store_lex "@var", $P106
+.annotate 'line', 190
+    find_lex $P1059, "$arg"
+    unless_null $P1059, vivify_114
+    $P1059 = root_new ['parrot';'Hash']
+  vivify_114:
+    set $P105, $P1059["variant"]
+    unless_null $P105, vivify_115
+    new $P105, "Undef"
+  vivify_115:
+    unless $P105, if_1058_end
+.annotate 'line', 191
+    find_lex $P106, "@var"
+    find_lex $P1060, "$arg"
+    unless_null $P1060, vivify_116
+    $P1060 = root_new ['parrot';'Hash']
+  vivify_116:
+    set $P107, $P1060["variant"]
+    unless_null $P107, vivify_117
+    new $P107, "Undef"
+  vivify_117:
+    $P106."push"($P107)
+  if_1058_end:
+.annotate 'line', 194
+    find_lex $P105, "@args"
+    $P106 = "expand_args"($P105)
+    store_lex "@list", $P106
+.annotate 'line', 195
+    find_lex $P105, "@list"
+    set $N100, $P105
+    if $N100, unless_1061_end
+.annotate 'line', 196
+    new $P106, "Exception"
+    set $P106['type'], .CONTROL_RETURN
+    find_lex $P107, "@var"
+    setattribute $P106, 'payload', $P107
+    throw $P106
+  unless_1061_end:
+.annotate 'line', 183
+    find_lex $P105, "@results"
+.annotate 'line', 200
+    find_lex $P106, "@list"
+    defined $I100, $P106
+    unless $I100, for_undef_118
+    iter $P105, $P106
+    new $P109, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P109, loop1072_handler
+    push_eh $P109
+  loop1072_test:
+    unless $P105, loop1072_done
+    shift $P107, $P105
+  loop1072_redo:
+    .const 'Sub' $P1063 = "15_1792415686.05651" 
+    capture_lex $P1063
+    $P1063($P107)
+  loop1072_next:
+    goto loop1072_test
+  loop1072_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P110, exception, 'type'
+    eq $P110, .CONTROL_LOOP_NEXT, loop1072_next
+    eq $P110, .CONTROL_LOOP_REDO, loop1072_redo
+  loop1072_done:
+    pop_eh 
+  for_undef_118:
+.annotate 'line', 183
+    find_lex $P105, "@results"
+    .return ($P105)
+  control_1046:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P106, exception, "payload"
+    .return ($P106)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "_block1062"  :anon :subid("15_1792415686.05651") :outer("14_1792415686.05651")
+    .param pmc param_1064
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 200
+    .const 'Sub' $P1066 = "16_1792415686.05651" 
+    capture_lex $P1066
+    .lex "$l", param_1064
+.annotate 'line', 201
+    find_lex $P109, "@var"
+    defined $I101, $P109
+    unless $I101, for_undef_119
+    iter $P108, $P109
+    new $P111, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P111, loop1071_handler
+    push_eh $P111
+  loop1071_test:
+    unless $P108, loop1071_done
+    shift $P110, $P108
+  loop1071_redo:
+    .const 'Sub' $P1066 = "16_1792415686.05651" 
+    capture_lex $P1066
+    $P1066($P110)
+  loop1071_next:
+    goto loop1071_test
+  loop1071_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P112, exception, 'type'
+    eq $P112, .CONTROL_LOOP_NEXT, loop1071_next
+    eq $P112, .CONTROL_LOOP_REDO, loop1071_redo
+  loop1071_done:
+    pop_eh 
+  for_undef_119:
+.annotate 'line', 200
+    .return ($P108)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.sub "_block1065"  :anon :subid("16_1792415686.05651") :outer("15_1792415686.05651")
+    .param pmc param_1067
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 201
+    .lex "$v", param_1067
+.annotate 'line', 203
+    $P1069 = root_new ['parrot';'ResizablePMCArray']
+    set $P1068, $P1069
+    .lex "@l", $P1068
+    find_lex $P112, "$l"
+    new $P113, "String"
+    assign $P113, "array"
+    set $S100, $P113
+    does $I102, $P112, $S100
+    if $I102, if_1070
+    find_lex $P115, "$l"
+    $P116 = "list"($P115)
+    set $P111, $P116
+    goto if_1070_end
+  if_1070:
+    find_lex $P114, "$l"
+    set $P111, $P114
+  if_1070_end:
+    store_lex "@l", $P111
+.annotate 'line', 204
+    find_lex $P111, "@results"
+    find_lex $P112, "$v"
+    find_lex $P113, "@l"
+    $P114 = "list"($P112, $P113 :flat)
+    $P115 = $P111."push"($P114)
+.annotate 'line', 201
+    .return ($P115)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "TOP"  :subid("17_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1077
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 14
+    new $P1076, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1076, control_1075
+    push_eh $P1076
+    .lex "self", self
+    .lex "$/", param_1077
+.annotate 'line', 15
+    find_lex $P107, "$/"
+    find_lex $P1078, "$/"
+    unless_null $P1078, vivify_120
+    $P1078 = root_new ['parrot';'Hash']
+  vivify_120:
+    set $P108, $P1078["body"]
+    unless_null $P108, vivify_121
+    new $P108, "Undef"
+  vivify_121:
+    $P109 = $P108."ast"()
+    $P110 = $P107."!make"($P109)
+.annotate 'line', 14
+    .return ($P110)
+  control_1075:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P107, exception, "payload"
+    .return ($P107)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "body"  :subid("18_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1082
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 18
+    .const 'Sub' $P1095 = "20_1792415686.05651" 
+    capture_lex $P1095
+    .const 'Sub' $P1088 = "19_1792415686.05651" 
+    capture_lex $P1088
+    new $P1081, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1081, control_1080
+    push_eh $P1081
+    .lex "self", self
+    .lex "$/", param_1082
+.annotate 'line', 19
+    new $P107, "Undef"
+    set $P1083, $P107
+    .lex "$past", $P1083
+    get_hll_global $P108, ["PAST"], "Stmts"
+    find_lex $P109, "$/"
+    $P110 = $P108."new"($P109 :named("node"))
+    store_lex "$past", $P110
+.annotate 'line', 23
+    get_hll_global $P108, ["PAST"], "Stmts"
+    find_lex $P109, "$/"
+    $P110 = $P108."new"($P109 :named("node"))
+    find_lex $P1084, "$past"
+    unless_null $P1084, vivify_122
+    $P1084 = root_new ['parrot';'Hash']
+    store_lex "$past", $P1084
+  vivify_122:
+    set $P1084["preamble"], $P110
+.annotate 'line', 26
+    get_hll_global $P108, ["PAST"], "Stmts"
+    find_lex $P109, "$/"
+    $P110 = $P108."new"($P109 :named("node"))
+    find_lex $P1085, "$past"
+    unless_null $P1085, vivify_123
+    $P1085 = root_new ['parrot';'Hash']
+    store_lex "$past", $P1085
+  vivify_123:
+    set $P1085["ops"], $P110
+.annotate 'line', 30
+    find_lex $P1086, "$/"
+    unless_null $P1086, vivify_124
+    $P1086 = root_new ['parrot';'Hash']
+  vivify_124:
+    set $P109, $P1086["preamble"]
+    unless_null $P109, vivify_125
+    new $P109, "Undef"
+  vivify_125:
+    defined $I100, $P109
+    unless $I100, for_undef_126
+    iter $P108, $P109
+    new $P111, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P111, loop1092_handler
+    push_eh $P111
+  loop1092_test:
+    unless $P108, loop1092_done
+    shift $P110, $P108
+  loop1092_redo:
+    .const 'Sub' $P1088 = "19_1792415686.05651" 
+    capture_lex $P1088
+    $P1088($P110)
+  loop1092_next:
+    goto loop1092_test
+  loop1092_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P112, exception, 'type'
+    eq $P112, .CONTROL_LOOP_NEXT, loop1092_next
+    eq $P112, .CONTROL_LOOP_REDO, loop1092_redo
+  loop1092_done:
+    pop_eh 
+  for_undef_126:
+.annotate 'line', 34
+    find_lex $P1093, "$/"
+    unless_null $P1093, vivify_131
+    $P1093 = root_new ['parrot';'Hash']
+  vivify_131:
+    set $P109, $P1093["op"]
+    unless_null $P109, vivify_132
+    new $P109, "Undef"
+  vivify_132:
+    defined $I100, $P109
+    unless $I100, for_undef_133
+    iter $P108, $P109
+    new $P114, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P114, loop1108_handler
+    push_eh $P114
+  loop1108_test:
+    unless $P108, loop1108_done
+    shift $P110, $P108
+  loop1108_redo:
+    .const 'Sub' $P1095 = "20_1792415686.05651" 
+    capture_lex $P1095
+    $P1095($P110)
+  loop1108_next:
+    goto loop1108_test
+  loop1108_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P115, exception, 'type'
+    eq $P115, .CONTROL_LOOP_NEXT, loop1108_next
+    eq $P115, .CONTROL_LOOP_REDO, loop1108_redo
+  loop1108_done:
+    pop_eh 
+  for_undef_133:
+.annotate 'line', 47
+    find_lex $P108, "$/"
+    find_lex $P109, "$past"
+    $P110 = $P108."!make"($P109)
+.annotate 'line', 18
+    .return ($P110)
+  control_1080:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P108, exception, "payload"
+    .return ($P108)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.sub "_block1087"  :anon :subid("19_1792415686.05651") :outer("18_1792415686.05651")
+    .param pmc param_1089
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 30
+    .lex "$_", param_1089
+.annotate 'line', 31
+    find_lex $P1090, "$past"
+    unless_null $P1090, vivify_127
+    $P1090 = root_new ['parrot';'Hash']
+  vivify_127:
+    set $P111, $P1090["preamble"]
+    unless_null $P111, vivify_128
+    new $P111, "Undef"
+  vivify_128:
+    find_lex $P1091, "$_"
+    unless_null $P1091, vivify_129
+    $P1091 = root_new ['parrot';'Hash']
+  vivify_129:
+    set $P112, $P1091["preamble_guts"]
+    unless_null $P112, vivify_130
+    new $P112, "Undef"
+  vivify_130:
+    $P113 = $P111."push"($P112)
+.annotate 'line', 30
+    .return ($P113)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "_block1094"  :anon :subid("20_1792415686.05651") :outer("18_1792415686.05651")
+    .param pmc param_1098
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 34
+    .const 'Sub' $P1101 = "21_1792415686.05651" 
+    capture_lex $P1101
+.annotate 'line', 35
+    new $P111, "Undef"
+    set $P1096, $P111
+    .lex "$ops", $P1096
+.annotate 'line', 36
+    new $P112, "Undef"
+    set $P1097, $P112
+    .lex "$op_skip_table", $P1097
+    .lex "$_", param_1098
+.annotate 'line', 35
+    find_lex $P113, "$_"
+    $P114 = $P113."ast"()
+    store_lex "$ops", $P114
+.annotate 'line', 34
+    find_lex $P113, "$op_skip_table"
+.annotate 'line', 37
+    get_global $P113, "$OPLIB"
+    unless $P113, if_1099_end
+.annotate 'line', 38
+    get_global $P114, "$OPLIB"
+    $P115 = $P114."op_skip_table"()
+    store_lex "$op_skip_table", $P115
+  if_1099_end:
+.annotate 'line', 40
+    find_lex $P114, "$ops"
+    $P115 = $P114."list"()
+    defined $I101, $P115
+    unless $I101, for_undef_134
+    iter $P113, $P115
+    new $P118, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P118, loop1107_handler
+    push_eh $P118
+  loop1107_test:
+    unless $P113, loop1107_done
+    shift $P116, $P113
+  loop1107_redo:
+    .const 'Sub' $P1101 = "21_1792415686.05651" 
+    capture_lex $P1101
+    $P1101($P116)
+  loop1107_next:
+    goto loop1107_test
+  loop1107_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P119, exception, 'type'
+    eq $P119, .CONTROL_LOOP_NEXT, loop1107_next
+    eq $P119, .CONTROL_LOOP_REDO, loop1107_redo
+  loop1107_done:
+    pop_eh 
+  for_undef_134:
+.annotate 'line', 34
+    .return ($P113)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.sub "_block1100"  :anon :subid("21_1792415686.05651") :outer("20_1792415686.05651")
+    .param pmc param_1102
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 40
+    .lex "$op", param_1102
+.annotate 'line', 41
+    get_global $P120, "$OPLIB"
+    if $P120, if_1105
+    set $P119, $P120
+    goto if_1105_end
+  if_1105:
+    find_lex $P121, "$op_skip_table"
+    find_lex $P122, "$op"
+    $P123 = $P122."full_name"()
+    $P124 = $P121."exists"($P123)
+    isfalse $I102, $P124
+    new $P119, 'Integer'
+    set $P119, $I102
+  if_1105_end:
+    unless $P119, unless_1104
+    set $P118, $P119
+    goto unless_1104_end
+  unless_1104:
+    get_global $P125, "$OPLIB"
+    isfalse $I103, $P125
+    new $P118, 'Integer'
+    set $P118, $I103
+  unless_1104_end:
+    if $P118, if_1103
+    set $P117, $P118
+    goto if_1103_end
+  if_1103:
+.annotate 'line', 42
+    find_lex $P1106, "$past"
+    unless_null $P1106, vivify_135
+    $P1106 = root_new ['parrot';'Hash']
+  vivify_135:
+    set $P126, $P1106["ops"]
+    unless_null $P126, vivify_136
+    new $P126, "Undef"
+  vivify_136:
+    find_lex $P127, "$op"
+    $P128 = $P126."push"($P127)
+.annotate 'line', 41
+    set $P117, $P128
+  if_1103_end:
+.annotate 'line', 40
+    .return ($P117)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "preamble"  :subid("22_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1112
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 50
+    new $P1111, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1111, control_1110
+    push_eh $P1111
+    .lex "self", self
+    .lex "$/", param_1112
+.annotate 'line', 51
+    find_lex $P107, "$/"
+    get_hll_global $P108, ["PAST"], "Op"
+    find_lex $P109, "$/"
+.annotate 'line', 54
+    find_lex $P1113, "$/"
+    unless_null $P1113, vivify_137
+    $P1113 = root_new ['parrot';'Hash']
+  vivify_137:
+    set $P110, $P1113["preamble_guts"]
+    unless_null $P110, vivify_138
+    new $P110, "Undef"
+  vivify_138:
+    set $S100, $P110
+    $P111 = $P108."new"($S100, $P109 :named("node"), "preamble" :named("pasttype"))
+.annotate 'line', 51
+    $P112 = $P107."!make"($P111)
+.annotate 'line', 50
+    .return ($P112)
+  control_1110:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P107, exception, "payload"
+    .return ($P107)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "op"  :subid("23_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1117
+    .param pmc param_1118 :optional
+    .param int has_param_1118 :opt_flag
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 58
+    .const 'Sub' $P1145 = "26_1792415686.05651" 
+    capture_lex $P1145
+    .const 'Sub' $P1121 = "24_1792415686.05651" 
+    capture_lex $P1121
+    new $P1116, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1116, control_1115
+    push_eh $P1116
+    .lex "self", self
+    .lex "$/", param_1117
+    if has_param_1118, optparam_139
+    new $P107, "Undef"
+    set param_1118, $P107
+  optparam_139:
+    .lex "$key", param_1118
+.annotate 'line', 60
+    find_lex $P109, "$key"
+    set $S100, $P109
+    iseq $I100, $S100, "start"
+    if $I100, if_1119
+.annotate 'line', 83
+    .const 'Sub' $P1145 = "26_1792415686.05651" 
+    capture_lex $P1145
+    $P113 = $P1145()
+    set $P108, $P113
+.annotate 'line', 60
+    goto if_1119_end
+  if_1119:
+    .const 'Sub' $P1121 = "24_1792415686.05651" 
+    capture_lex $P1121
+    $P111 = $P1121()
+    set $P108, $P111
+  if_1119_end:
+.annotate 'line', 58
+    .return ($P108)
+  control_1115:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P109, exception, "payload"
+    .return ($P109)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "_block1144"  :anon :subid("26_1792415686.05651") :outer("23_1792415686.05651")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 83
+    .const 'Sub' $P1162 = "28_1792415686.05651" 
+    capture_lex $P1162
+    .const 'Sub' $P1154 = "27_1792415686.05651" 
+    capture_lex $P1154
+.annotate 'line', 99
+    new $P112, "Undef"
+    set $P1146, $P112
+    .lex "$past", $P1146
+.annotate 'line', 104
+    $P1148 = root_new ['parrot';'ResizablePMCArray']
+    set $P1147, $P1148
+    .lex "@variants", $P1147
+.annotate 'line', 85
+    get_global $P113, "$OP"
+    find_lex $P1149, "$/"
+    unless_null $P1149, vivify_140
+    $P1149 = root_new ['parrot';'Hash']
+  vivify_140:
+    set $P114, $P1149["op_body"]
+    unless_null $P114, vivify_141
+    new $P114, "Undef"
+  vivify_141:
+    $P115 = $P114."ast"()
+    $P113."push"($P115)
+.annotate 'line', 87
+    get_global $P1151, "$OP"
+    unless_null $P1151, vivify_142
+    $P1151 = root_new ['parrot';'Hash']
+  vivify_142:
+    set $P1152, $P1151["flags"]
+    unless_null $P1152, vivify_143
+    $P1152 = root_new ['parrot';'Hash']
+  vivify_143:
+    set $P113, $P1152["flow"]
+    unless_null $P113, vivify_144
+    new $P113, "Undef"
+  vivify_144:
+    isfalse $I101, $P113
+    unless $I101, if_1150_end
+    .const 'Sub' $P1154 = "27_1792415686.05651" 
+    capture_lex $P1154
+    $P1154()
+  if_1150_end:
+.annotate 'line', 99
+    get_hll_global $P113, ["PAST"], "Stmts"
+    find_lex $P114, "$/"
+    $P115 = $P113."new"($P114 :named("node"))
+    store_lex "$past", $P115
+.annotate 'line', 104
+    get_global $P1159, "$OP"
+    unless_null $P1159, vivify_149
+    $P1159 = root_new ['parrot';'Hash']
+  vivify_149:
+    set $P113, $P1159["normalized_args"]
+    unless_null $P113, vivify_150
+    new $P113, "Undef"
+  vivify_150:
+    clone $P114, $P113
+    $P115 = "expand_args"($P114)
+    store_lex "@variants", $P115
+.annotate 'line', 105
+    find_lex $P113, "@variants"
+    if $P113, if_1160
+.annotate 'line', 113
+    find_lex $P114, "$past"
+    get_global $P115, "$OP"
+    $P114."push"($P115)
+.annotate 'line', 112
+    goto if_1160_end
+  if_1160:
+.annotate 'line', 106
+    find_lex $P115, "@variants"
+    defined $I101, $P115
+    unless $I101, for_undef_151
+    iter $P114, $P115
+    new $P118, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P118, loop1166_handler
+    push_eh $P118
+  loop1166_test:
+    unless $P114, loop1166_done
+    shift $P116, $P114
+  loop1166_redo:
+    .const 'Sub' $P1162 = "28_1792415686.05651" 
+    capture_lex $P1162
+    $P1162($P116)
+  loop1166_next:
+    goto loop1166_test
+  loop1166_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P119, exception, 'type'
+    eq $P119, .CONTROL_LOOP_NEXT, loop1166_next
+    eq $P119, .CONTROL_LOOP_REDO, loop1166_redo
+  loop1166_done:
+    pop_eh 
+  for_undef_151:
+  if_1160_end:
+.annotate 'line', 116
+    find_dynamic_lex $P113, "$/"
+    find_lex $P114, "$past"
+    $P115 = $P113."!make"($P114)
+.annotate 'line', 83
+    .return ($P115)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.sub "_block1153"  :anon :subid("27_1792415686.05651") :outer("26_1792415686.05651")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 90
+    new $P114, "Undef"
+    set $P1155, $P114
+    .lex "$goto_next", $P1155
+.annotate 'line', 88
+    get_global $P115, "$OP"
+    $P116 = $P115."need_write_barrier"()
+    unless $P116, if_1156_end
+    get_global $P1157, "$OP"
+    unless_null $P1157, vivify_145
+    $P1157 = root_new ['parrot';'ResizablePMCArray']
+  vivify_145:
+    set $P117, $P1157[0]
+    unless_null $P117, vivify_146
+    new $P117, "Undef"
+  vivify_146:
+    find_lex $P118, "self"
+    $P119 = $P118."make_write_barrier"()
+    $P117."push"($P119)
+  if_1156_end:
+.annotate 'line', 90
+    get_hll_global $P115, ["PAST"], "Op"
+.annotate 'line', 93
+    find_lex $P116, "self"
+    $P117 = $P116."opsize"()
+    $P118 = $P115."new"($P117, "macro" :named("pasttype"), "goto_offset" :named("name"))
+.annotate 'line', 90
+    store_lex "$goto_next", $P118
+.annotate 'line', 96
+    get_global $P1158, "$OP"
+    unless_null $P1158, vivify_147
+    $P1158 = root_new ['parrot';'ResizablePMCArray']
+  vivify_147:
+    set $P115, $P1158[0]
+    unless_null $P115, vivify_148
+    new $P115, "Undef"
+  vivify_148:
+    find_lex $P116, "$goto_next"
+    $P117 = $P115."push"($P116)
+.annotate 'line', 87
+    .return ($P117)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.sub "_block1161"  :anon :subid("28_1792415686.05651") :outer("26_1792415686.05651")
+    .param pmc param_1164
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 107
+    new $P117, "Undef"
+    set $P1163, $P117
+    .lex "$new_op", $P1163
+    .lex "$_", param_1164
+    get_global $P118, "$OP"
+    clone $P119, $P118
+    store_lex "$new_op", $P119
+.annotate 'line', 108
+    find_lex $P118, "$_"
+    find_lex $P1165, "$new_op"
+    unless_null $P1165, vivify_152
+    $P1165 = root_new ['parrot';'Hash']
+    store_lex "$new_op", $P1165
+  vivify_152:
+    set $P1165["arg_types"], $P118
+.annotate 'line', 109
+    find_lex $P118, "$past"
+    find_lex $P119, "$new_op"
+    $P120 = $P118."push"($P119)
+.annotate 'line', 106
+    .return ($P120)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "_block1120"  :anon :subid("24_1792415686.05651") :outer("23_1792415686.05651")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 60
+    .const 'Sub' $P1130 = "25_1792415686.05651" 
+    capture_lex $P1130
+.annotate 'line', 62
+    $P1123 = root_new ['parrot';'Hash']
+    set $P1122, $P1123
+    .lex "%flags", $P1122
+.annotate 'line', 67
+    $P1125 = root_new ['parrot';'ResizablePMCArray']
+    set $P1124, $P1125
+    .lex "@args", $P1124
+.annotate 'line', 68
+    $P1127 = root_new ['parrot';'ResizablePMCArray']
+    set $P1126, $P1127
+    .lex "@norm_args", $P1126
+.annotate 'line', 62
+    $P110 = "hash"()
+    store_lex "%flags", $P110
+.annotate 'line', 63
+    find_lex $P1128, "$/"
+    unless_null $P1128, vivify_153
+    $P1128 = root_new ['parrot';'Hash']
+  vivify_153:
+    set $P111, $P1128["op_flag"]
+    unless_null $P111, vivify_154
+    new $P111, "Undef"
+  vivify_154:
+    defined $I101, $P111
+    unless $I101, for_undef_155
+    iter $P110, $P111
+    new $P114, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P114, loop1134_handler
+    push_eh $P114
+  loop1134_test:
+    unless $P110, loop1134_done
+    shift $P112, $P110
+  loop1134_redo:
+    .const 'Sub' $P1130 = "25_1792415686.05651" 
+    capture_lex $P1130
+    $P1130($P112)
+  loop1134_next:
+    goto loop1134_test
+  loop1134_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P115, exception, 'type'
+    eq $P115, .CONTROL_LOOP_NEXT, loop1134_next
+    eq $P115, .CONTROL_LOOP_REDO, loop1134_redo
+  loop1134_done:
+    pop_eh 
+  for_undef_155:
+.annotate 'line', 67
+    find_lex $P1135, "$/"
+    unless_null $P1135, vivify_159
+    $P1135 = root_new ['parrot';'Hash']
+  vivify_159:
+    set $P110, $P1135["signature"]
+    unless_null $P110, vivify_160
+    new $P110, "Undef"
+  vivify_160:
+    $P111 = $P110."ast"()
+    $P112 = $P111."list"()
+    store_lex "@args", $P112
+.annotate 'line', 68
+    find_lex $P110, "@args"
+    $P111 = "normalize_args"($P110)
+    store_lex "@norm_args", $P111
+.annotate 'line', 70
+    get_hll_global $P110, ["Ops"], "Op"
+.annotate 'line', 71
+    find_lex $P1136, "$/"
+    unless_null $P1136, vivify_161
+    $P1136 = root_new ['parrot';'Hash']
+  vivify_161:
+    set $P111, $P1136["op_name"]
+    unless_null $P111, vivify_162
+    new $P111, "Undef"
+  vivify_162:
+    set $S101, $P111
+.annotate 'line', 70
+    $P112 = $P110."new"($S101 :named("name"))
+    set_global "$OP", $P112
+.annotate 'line', 74
+    find_lex $P1138, "$/"
+    unless_null $P1138, vivify_163
+    $P1138 = root_new ['parrot';'Hash']
+  vivify_163:
+    set $P110, $P1138["op_name"]
+    unless_null $P110, vivify_164
+    new $P110, "Undef"
+  vivify_164:
+    set $S101, $P110
+    iseq $I101, $S101, "runinterp"
+    unless $I101, if_1137_end
+.annotate 'line', 75
+    get_global $P111, "$OP"
+    $P111."add_jump"("PARROT_JUMP_RELATIVE")
+  if_1137_end:
+.annotate 'line', 78
+    find_lex $P110, "%flags"
+    get_global $P1139, "$OP"
+    unless_null $P1139, vivify_165
+    $P1139 = root_new ['parrot';'Hash']
+    set_global "$OP", $P1139
+  vivify_165:
+    set $P1139["flags"], $P110
+.annotate 'line', 79
+    find_lex $P110, "@args"
+    get_global $P1140, "$OP"
+    unless_null $P1140, vivify_166
+    $P1140 = root_new ['parrot';'Hash']
+    set_global "$OP", $P1140
+  vivify_166:
+    set $P1140["args"], $P110
+.annotate 'line', 80
+    find_lex $P1141, "$/"
+    unless_null $P1141, vivify_167
+    $P1141 = root_new ['parrot';'Hash']
+  vivify_167:
+    set $P110, $P1141["op_type"]
+    unless_null $P110, vivify_168
+    new $P110, "Undef"
+  vivify_168:
+    set $S101, $P110
+    new $P111, 'String'
+    set $P111, $S101
+    get_global $P1142, "$OP"
+    unless_null $P1142, vivify_169
+    $P1142 = root_new ['parrot';'Hash']
+    set_global "$OP", $P1142
+  vivify_169:
+    set $P1142["type"], $P111
+.annotate 'line', 81
+    find_lex $P110, "@norm_args"
+    get_global $P1143, "$OP"
+    unless_null $P1143, vivify_170
+    $P1143 = root_new ['parrot';'Hash']
+    set_global "$OP", $P1143
+  vivify_170:
+    set $P1143["normalized_args"], $P110
+.annotate 'line', 60
+    .return ($P110)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.sub "_block1129"  :anon :subid("25_1792415686.05651") :outer("24_1792415686.05651")
+    .param pmc param_1131
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 63
+    .lex "$_", param_1131
+.annotate 'line', 64
+    new $P113, "Integer"
+    assign $P113, 1
+    find_lex $P1132, "$_"
+    unless_null $P1132, vivify_156
+    $P1132 = root_new ['parrot';'Hash']
+  vivify_156:
+    set $P114, $P1132["identifier"]
+    unless_null $P114, vivify_157
+    new $P114, "Undef"
+  vivify_157:
+    set $S101, $P114
+    find_lex $P1133, "%flags"
+    unless_null $P1133, vivify_158
+    $P1133 = root_new ['parrot';'Hash']
+    store_lex "%flags", $P1133
+  vivify_158:
+    set $P1133[$S101], $P113
+.annotate 'line', 63
+    .return ($P113)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "signature"  :subid("29_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1170
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 212
+    .const 'Sub' $P1174 = "30_1792415686.05651" 
+    capture_lex $P1174
+    new $P1169, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1169, control_1168
+    push_eh $P1169
+    .lex "self", self
+    .lex "$/", param_1170
+.annotate 'line', 213
+    new $P107, "Undef"
+    set $P1171, $P107
+    .lex "$past", $P1171
+    get_hll_global $P108, ["PAST"], "Stmts"
+    find_lex $P109, "$/"
+    $P110 = $P108."new"($P109 :named("node"))
+    store_lex "$past", $P110
+.annotate 'line', 217
+    find_lex $P1172, "$/"
+    unless_null $P1172, vivify_171
+    $P1172 = root_new ['parrot';'Hash']
+  vivify_171:
+    set $P109, $P1172["op_param"]
+    unless_null $P109, vivify_172
+    new $P109, "Undef"
+  vivify_172:
+    defined $I100, $P109
+    unless $I100, for_undef_173
+    iter $P108, $P109
+    new $P111, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P111, loop1176_handler
+    push_eh $P111
+  loop1176_test:
+    unless $P108, loop1176_done
+    shift $P110, $P108
+  loop1176_redo:
+    .const 'Sub' $P1174 = "30_1792415686.05651" 
+    capture_lex $P1174
+    $P1174($P110)
+  loop1176_next:
+    goto loop1176_test
+  loop1176_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P112, exception, 'type'
+    eq $P112, .CONTROL_LOOP_NEXT, loop1176_next
+    eq $P112, .CONTROL_LOOP_REDO, loop1176_redo
+  loop1176_done:
+    pop_eh 
+  for_undef_173:
+.annotate 'line', 221
+    find_lex $P108, "$/"
+    find_lex $P109, "$past"
+    $P110 = $P108."!make"($P109)
+.annotate 'line', 212
+    .return ($P110)
+  control_1168:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P108, exception, "payload"
+    .return ($P108)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.sub "_block1173"  :anon :subid("30_1792415686.05651") :outer("29_1792415686.05651")
+    .param pmc param_1175
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 217
+    .lex "$_", param_1175
+.annotate 'line', 218
+    find_lex $P111, "$past"
+    find_lex $P112, "$_"
+    $P113 = $P112."ast"()
+    $P114 = $P111."push"($P113)
+.annotate 'line', 217
+    .return ($P114)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "op_param"  :subid("31_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1180
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 224
+    new $P1179, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1179, control_1178
+    push_eh $P1179
+    .lex "self", self
+    .lex "$/", param_1180
+.annotate 'line', 225
+    new $P107, "Undef"
+    set $P1181, $P107
+    .lex "$past", $P1181
+    get_hll_global $P108, ["PAST"], "Var"
+    find_lex $P109, "$/"
+    $P110 = $P108."new"($P109 :named("node"), 1 :named("isdecl"))
+    store_lex "$past", $P110
+.annotate 'line', 231
+    find_lex $P1182, "$/"
+    unless_null $P1182, vivify_174
+    $P1182 = root_new ['parrot';'Hash']
+  vivify_174:
+    set $P108, $P1182["op_param_direction"]
+    unless_null $P108, vivify_175
+    new $P108, "Undef"
+  vivify_175:
+    set $S100, $P108
+    new $P109, 'String'
+    set $P109, $S100
+    find_lex $P1183, "$past"
+    unless_null $P1183, vivify_176
+    $P1183 = root_new ['parrot';'Hash']
+    store_lex "$past", $P1183
+  vivify_176:
+    set $P1183["direction"], $P109
+.annotate 'line', 232
+    find_lex $P1184, "$/"
+    unless_null $P1184, vivify_177
+    $P1184 = root_new ['parrot';'Hash']
+  vivify_177:
+    set $P108, $P1184["op_param_type"]
+    unless_null $P108, vivify_178
+    new $P108, "Undef"
+  vivify_178:
+    set $S100, $P108
+    new $P109, 'String'
+    set $P109, $S100
+    find_lex $P1185, "$past"
+    unless_null $P1185, vivify_179
+    $P1185 = root_new ['parrot';'Hash']
+    store_lex "$past", $P1185
+  vivify_179:
+    set $P1185["type"], $P109
+.annotate 'line', 234
+    find_lex $P108, "$/"
+    find_lex $P109, "$past"
+    $P110 = $P108."!make"($P109)
+.annotate 'line', 224
+    .return ($P110)
+  control_1178:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P108, exception, "payload"
+    .return ($P108)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "op_body"  :subid("32_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1189
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 237
+    new $P1188, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1188, control_1187
+    push_eh $P1188
+    .lex "self", self
+    .lex "$/", param_1189
+.annotate 'line', 238
+    find_lex $P107, "$/"
+    find_lex $P1190, "$/"
+    unless_null $P1190, vivify_180
+    $P1190 = root_new ['parrot';'Hash']
+  vivify_180:
+    set $P108, $P1190["blockoid"]
+    unless_null $P108, vivify_181
+    new $P108, "Undef"
+  vivify_181:
+    $P109 = $P108."ast"()
+    $P110 = $P107."!make"($P109)
+.annotate 'line', 237
+    .return ($P110)
+  control_1187:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P107, exception, "payload"
+    .return ($P107)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "op_macro:sym<expr offset>"  :subid("33_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1194
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 241
+    new $P1193, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1193, control_1192
+    push_eh $P1193
+    .lex "self", self
+    .lex "$/", param_1194
+.annotate 'line', 242
+    find_lex $P107, "$/"
+    get_hll_global $P108, ["PAST"], "Op"
+.annotate 'line', 245
+    find_lex $P1195, "$/"
+    unless_null $P1195, vivify_182
+    $P1195 = root_new ['parrot';'Hash']
+  vivify_182:
+    set $P109, $P1195["arg"]
+    unless_null $P109, vivify_183
+    new $P109, "Undef"
+  vivify_183:
+    $P110 = $P109."ast"()
+    $P111 = $P108."new"($P110, "macro" :named("pasttype"), "expr_offset" :named("name"))
+.annotate 'line', 242
+    $P112 = $P107."!make"($P111)
+.annotate 'line', 241
+    .return ($P112)
+  control_1192:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P107, exception, "payload"
+    .return ($P107)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "op_macro:sym<goto offset>"  :subid("34_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1199
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 249
+    new $P1198, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1198, control_1197
+    push_eh $P1198
+    .lex "self", self
+    .lex "$/", param_1199
+.annotate 'line', 252
+    new $P107, "Undef"
+    set $P1200, $P107
+    .lex "$past", $P1200
+.annotate 'line', 250
+    get_global $P108, "$OP"
+    $P108."add_jump"("PARROT_JUMP_RELATIVE")
+.annotate 'line', 252
+    get_hll_global $P108, ["PAST"], "Op"
+.annotate 'line', 255
+    find_lex $P1201, "$/"
+    unless_null $P1201, vivify_184
+    $P1201 = root_new ['parrot';'Hash']
+  vivify_184:
+    set $P109, $P1201["arg"]
+    unless_null $P109, vivify_185
+    new $P109, "Undef"
+  vivify_185:
+    $P110 = $P109."ast"()
+    $P111 = $P108."new"($P110, "macro" :named("pasttype"), "goto_offset" :named("name"))
+.annotate 'line', 252
+    store_lex "$past", $P111
+.annotate 'line', 258
+    get_global $P108, "$OP"
+    $P109 = $P108."need_write_barrier"()
+    unless $P109, if_1202_end
+.annotate 'line', 259
+    get_hll_global $P110, ["PAST"], "Block"
+.annotate 'line', 260
+    find_lex $P111, "self"
+    $P112 = $P111."make_write_barrier"()
+    find_lex $P113, "$past"
+    $P114 = $P110."new"($P112, $P113)
+.annotate 'line', 259
+    store_lex "$past", $P114
+  if_1202_end:
+.annotate 'line', 265
+    find_lex $P108, "$/"
+    find_lex $P109, "$past"
+    $P110 = $P108."!make"($P109)
+.annotate 'line', 249
+    .return ($P110)
+  control_1197:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P108, exception, "payload"
+    .return ($P108)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "op_macro:sym<expr address>"  :subid("35_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1206
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 268
+    new $P1205, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1205, control_1204
+    push_eh $P1205
+    .lex "self", self
+    .lex "$/", param_1206
+.annotate 'line', 269
+    find_lex $P107, "$/"
+    get_hll_global $P108, ["PAST"], "Op"
+.annotate 'line', 272
+    find_lex $P1207, "$/"
+    unless_null $P1207, vivify_186
+    $P1207 = root_new ['parrot';'Hash']
+  vivify_186:
+    set $P109, $P1207["arg"]
+    unless_null $P109, vivify_187
+    new $P109, "Undef"
+  vivify_187:
+    $P110 = $P109."ast"()
+    $P111 = $P108."new"($P110, "macro" :named("pasttype"), "expr_address" :named("name"))
+.annotate 'line', 269
+    $P112 = $P107."!make"($P111)
+.annotate 'line', 268
+    .return ($P112)
+  control_1204:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P107, exception, "payload"
+    .return ($P107)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "op_macro:sym<goto address>"  :subid("36_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1211
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 276
+    new $P1210, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1210, control_1209
+    push_eh $P1210
+    .lex "self", self
+    .lex "$/", param_1211
+.annotate 'line', 277
+    new $P107, "Undef"
+    set $P1212, $P107
+    .lex "$past", $P1212
+    get_hll_global $P108, ["PAST"], "Op"
+.annotate 'line', 280
+    find_lex $P1213, "$/"
+    unless_null $P1213, vivify_188
+    $P1213 = root_new ['parrot';'Hash']
+  vivify_188:
+    set $P109, $P1213["arg"]
+    unless_null $P109, vivify_189
+    new $P109, "Undef"
+  vivify_189:
+    $P110 = $P109."ast"()
+    $P111 = $P108."new"($P110, "macro" :named("pasttype"), "goto_address" :named("name"))
+.annotate 'line', 277
+    store_lex "$past", $P111
+.annotate 'line', 283
+    get_global $P108, "$OP"
+    $P109 = $P108."need_write_barrier"()
+    unless $P109, if_1214_end
+.annotate 'line', 284
+    get_hll_global $P110, ["PAST"], "Block"
+.annotate 'line', 285
+    find_lex $P111, "self"
+    $P112 = $P111."make_write_barrier"()
+    find_lex $P113, "$past"
+    $P114 = $P110."new"($P112, $P113)
+.annotate 'line', 284
+    store_lex "$past", $P114
+  if_1214_end:
+.annotate 'line', 290
+    find_lex $P108, "$/"
+    find_lex $P109, "$past"
+    $P110 = $P108."!make"($P109)
+.annotate 'line', 276
+    .return ($P110)
+  control_1209:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P108, exception, "payload"
+    .return ($P108)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "op_macro:sym<expr next>"  :subid("37_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1218
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 293
+    new $P1217, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1217, control_1216
+    push_eh $P1217
+    .lex "self", self
+    .lex "$/", param_1218
+.annotate 'line', 294
+    find_lex $P107, "$/"
+    get_hll_global $P108, ["PAST"], "Op"
+.annotate 'line', 297
+    find_lex $P109, "self"
+    $P110 = $P109."opsize"()
+    $P111 = $P108."new"($P110, "macro" :named("pasttype"), "expr_offset" :named("name"))
+.annotate 'line', 294
+    $P112 = $P107."!make"($P111)
+.annotate 'line', 293
+    .return ($P112)
+  control_1216:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P107, exception, "payload"
+    .return ($P107)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "op_macro:sym<goto next>"  :subid("38_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1222
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 301
+    new $P1221, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1221, control_1220
+    push_eh $P1221
+    .lex "self", self
+    .lex "$/", param_1222
+.annotate 'line', 304
+    new $P107, "Undef"
+    set $P1223, $P107
+    .lex "$past", $P1223
+.annotate 'line', 302
+    get_global $P108, "$OP"
+    $P108."add_jump"("PARROT_JUMP_RELATIVE")
+.annotate 'line', 304
+    get_hll_global $P108, ["PAST"], "Op"
+.annotate 'line', 307
+    find_lex $P109, "self"
+    $P110 = $P109."opsize"()
+    $P111 = $P108."new"($P110, "macro" :named("pasttype"), "goto_offset" :named("name"))
+.annotate 'line', 304
+    store_lex "$past", $P111
+.annotate 'line', 310
+    get_global $P108, "$OP"
+    $P109 = $P108."need_write_barrier"()
+    unless $P109, if_1224_end
+.annotate 'line', 311
+    get_hll_global $P110, ["PAST"], "Block"
+.annotate 'line', 312
+    find_lex $P111, "self"
+    $P112 = $P111."make_write_barrier"()
+    find_lex $P113, "$past"
+    $P114 = $P110."new"($P112, $P113)
+.annotate 'line', 311
+    store_lex "$past", $P114
+  if_1224_end:
+.annotate 'line', 317
+    find_lex $P108, "$/"
+    find_lex $P109, "$past"
+    $P110 = $P108."!make"($P109)
+.annotate 'line', 301
+    .return ($P110)
+  control_1220:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P108, exception, "payload"
+    .return ($P108)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "op_macro:sym<restart next>"  :subid("39_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1228
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 321
+    new $P1227, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1227, control_1226
+    push_eh $P1227
+    .lex "self", self
+    .lex "$/", param_1228
+.annotate 'line', 324
+    new $P107, "Undef"
+    set $P1229, $P107
+    .lex "$past", $P1229
+    get_hll_global $P108, ["PAST"], "Stmts"
+.annotate 'line', 325
+    get_hll_global $P109, ["PAST"], "Op"
+.annotate 'line', 328
+    find_lex $P110, "self"
+    $P111 = $P110."opsize"()
+    $P112 = $P109."new"($P111, "macro" :named("pasttype"), "restart_offset" :named("name"))
+.annotate 'line', 330
+    get_hll_global $P113, ["PAST"], "Op"
+.annotate 'line', 333
+    get_hll_global $P114, ["PAST"], "Val"
+    $P115 = $P114."new"("0" :named("value"))
+    $P116 = $P113."new"($P115, "macro" :named("pasttype"), "goto_address" :named("name"))
+.annotate 'line', 330
+    $P117 = $P108."new"($P112, $P116)
+.annotate 'line', 324
+    store_lex "$past", $P117
+.annotate 'line', 339
+    get_global $P108, "$OP"
+    $P109 = $P108."need_write_barrier"()
+    unless $P109, if_1230_end
+    find_lex $P110, "$past"
+    find_lex $P111, "self"
+    $P112 = $P111."make_write_barrier"()
+    $P110."unshift"($P112)
+  if_1230_end:
+.annotate 'line', 341
+    find_lex $P108, "$/"
+    find_lex $P109, "$past"
+    $P110 = $P108."!make"($P109)
+.annotate 'line', 321
+    .return ($P110)
+  control_1226:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P108, exception, "payload"
+    .return ($P108)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "blockoid"  :subid("40_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1234
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 344
+    .const 'Sub' $P1238 = "41_1792415686.05651" 
+    capture_lex $P1238
+    new $P1233, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1233, control_1232
+    push_eh $P1233
+    .lex "self", self
+    .lex "$/", param_1234
+.annotate 'line', 345
+    new $P107, "Undef"
+    set $P1235, $P107
+    .lex "$past", $P1235
+    get_hll_global $P108, ["PAST"], "Block"
+    find_lex $P109, "$/"
+    $P110 = $P108."new"($P109 :named("node"))
+    store_lex "$past", $P110
+.annotate 'line', 347
+    find_lex $P1236, "$/"
+    unless_null $P1236, vivify_190
+    $P1236 = root_new ['parrot';'Hash']
+  vivify_190:
+    set $P109, $P1236["mixed_content"]
+    unless_null $P109, vivify_191
+    new $P109, "Undef"
+  vivify_191:
+    $P110 = $P109."ast"()
+    $P111 = $P110."list"()
+    defined $I100, $P111
+    unless $I100, for_undef_192
+    iter $P108, $P111
+    new $P116, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P116, loop1240_handler
+    push_eh $P116
+  loop1240_test:
+    unless $P108, loop1240_done
+    shift $P112, $P108
+  loop1240_redo:
+    .const 'Sub' $P1238 = "41_1792415686.05651" 
+    capture_lex $P1238
+    $P1238($P112)
+  loop1240_next:
+    goto loop1240_test
+  loop1240_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P117, exception, 'type'
+    eq $P117, .CONTROL_LOOP_NEXT, loop1240_next
+    eq $P117, .CONTROL_LOOP_REDO, loop1240_redo
+  loop1240_done:
+    pop_eh 
+  for_undef_192:
+.annotate 'line', 349
+    find_lex $P108, "$/"
+    find_lex $P109, "$past"
+    $P110 = $P108."!make"($P109)
+.annotate 'line', 344
+    .return ($P110)
+  control_1232:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P108, exception, "payload"
+    .return ($P108)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.sub "_block1237"  :anon :subid("41_1792415686.05651") :outer("40_1792415686.05651")
+    .param pmc param_1239
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 347
+    .lex "$_", param_1239
+    find_lex $P113, "$past"
+    find_lex $P114, "$_"
+    $P115 = $P113."push"($P114)
+    .return ($P115)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "mixed_content"  :subid("42_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1244
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 352
+    .const 'Sub' $P1257 = "45_1792415686.05651" 
+    capture_lex $P1257
+    .const 'Sub' $P1248 = "43_1792415686.05651" 
+    capture_lex $P1248
+    new $P1243, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1243, control_1242
+    push_eh $P1243
+    .lex "self", self
+    .lex "$/", param_1244
+.annotate 'line', 353
+    new $P107, "Undef"
+    set $P1245, $P107
+    .lex "$past", $P1245
+    get_hll_global $P108, ["PAST"], "Stmts"
+    find_lex $P109, "$/"
+    $P110 = $P108."new"($P109 :named("node"))
+    store_lex "$past", $P110
+.annotate 'line', 355
+    find_lex $P1246, "$/"
+    unless_null $P1246, vivify_193
+    $P1246 = root_new ['parrot';'Hash']
+  vivify_193:
+    set $P109, $P1246["declarator"]
+    unless_null $P109, vivify_194
+    new $P109, "Undef"
+  vivify_194:
+    defined $I100, $P109
+    unless $I100, for_undef_195
+    iter $P108, $P109
+    new $P115, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P115, loop1254_handler
+    push_eh $P115
+  loop1254_test:
+    unless $P108, loop1254_done
+    shift $P110, $P108
+  loop1254_redo:
+    .const 'Sub' $P1248 = "43_1792415686.05651" 
+    capture_lex $P1248
+    $P1248($P110)
+  loop1254_next:
+    goto loop1254_test
+  loop1254_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P117, exception, 'type'
+    eq $P117, .CONTROL_LOOP_NEXT, loop1254_next
+    eq $P117, .CONTROL_LOOP_REDO, loop1254_redo
+  loop1254_done:
+    pop_eh 
+  for_undef_195:
+.annotate 'line', 356
+    find_lex $P1255, "$/"
+    unless_null $P1255, vivify_196
+    $P1255 = root_new ['parrot';'Hash']
+  vivify_196:
+    set $P109, $P1255["statement_list"]
+    unless_null $P109, vivify_197
+    new $P109, "Undef"
+  vivify_197:
+    $P110 = $P109."ast"()
+    $P111 = $P110."list"()
+    defined $I100, $P111
+    unless $I100, for_undef_198
+    iter $P108, $P111
+    new $P116, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P116, loop1259_handler
+    push_eh $P116
+  loop1259_test:
+    unless $P108, loop1259_done
+    shift $P112, $P108
+  loop1259_redo:
+    .const 'Sub' $P1257 = "45_1792415686.05651" 
+    capture_lex $P1257
+    $P1257($P112)
+  loop1259_next:
+    goto loop1259_test
+  loop1259_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P117, exception, 'type'
+    eq $P117, .CONTROL_LOOP_NEXT, loop1259_next
+    eq $P117, .CONTROL_LOOP_REDO, loop1259_redo
+  loop1259_done:
+    pop_eh 
+  for_undef_198:
+.annotate 'line', 358
+    find_lex $P108, "$/"
+    find_lex $P109, "$past"
+    $P110 = $P108."!make"($P109)
+.annotate 'line', 352
+    .return ($P110)
+  control_1242:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P108, exception, "payload"
+    .return ($P108)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.sub "_block1247"  :anon :subid("43_1792415686.05651") :outer("42_1792415686.05651")
+    .param pmc param_1249
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 355
+    .const 'Sub' $P1251 = "44_1792415686.05651" 
+    capture_lex $P1251
+    .lex "$_", param_1249
+    find_lex $P111, "$_"
+    $P112 = $P111."ast"()
+    $P113 = $P112."list"()
+    .const 'Sub' $P1251 = "44_1792415686.05651" 
+    newclosure $P1253, $P1251
+    $P114 = $P113."map"($P1253)
+    .return ($P114)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.sub "_block1250"  :anon :subid("44_1792415686.05651") :outer("43_1792415686.05651")
+    .param pmc param_1252
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 355
+    .lex "$_", param_1252
+    find_lex $P114, "$past"
+    find_lex $P115, "$_"
+    $P116 = $P114."push"($P115)
+    .return ($P116)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.sub "_block1256"  :anon :subid("45_1792415686.05651") :outer("42_1792415686.05651")
+    .param pmc param_1258
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 356
+    .lex "$_", param_1258
+    find_lex $P113, "$past"
+    find_lex $P114, "$_"
+    $P115 = $P113."push"($P114)
+    .return ($P115)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "declarator"  :subid("46_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1263
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 361
+    .const 'Sub' $P1267 = "47_1792415686.05651" 
+    capture_lex $P1267
+    new $P1262, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1262, control_1261
+    push_eh $P1262
+    .lex "self", self
+    .lex "$/", param_1263
+.annotate 'line', 362
+    new $P107, "Undef"
+    set $P1264, $P107
+    .lex "$past", $P1264
+    get_hll_global $P108, ["PAST"], "Stmts"
+    find_lex $P109, "$/"
+    $P110 = $P108."new"($P109 :named("node"))
+    store_lex "$past", $P110
+.annotate 'line', 363
+    find_lex $P1265, "$/"
+    unless_null $P1265, vivify_199
+    $P1265 = root_new ['parrot';'Hash']
+  vivify_199:
+    set $P109, $P1265["declarator_name"]
+    unless_null $P109, vivify_200
+    new $P109, "Undef"
+  vivify_200:
+    defined $I100, $P109
+    unless $I100, for_undef_201
+    iter $P108, $P109
+    new $P112, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P112, loop1284_handler
+    push_eh $P112
+  loop1284_test:
+    unless $P108, loop1284_done
+    shift $P110, $P108
+  loop1284_redo:
+    .const 'Sub' $P1267 = "47_1792415686.05651" 
+    capture_lex $P1267
+    $P1267($P110)
+  loop1284_next:
+    goto loop1284_test
+  loop1284_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P113, exception, 'type'
+    eq $P113, .CONTROL_LOOP_NEXT, loop1284_next
+    eq $P113, .CONTROL_LOOP_REDO, loop1284_redo
+  loop1284_done:
+    pop_eh 
+  for_undef_201:
+.annotate 'line', 378
+    find_lex $P108, "$/"
+    find_lex $P109, "$past"
+    $P110 = $P108."!make"($P109)
+.annotate 'line', 361
+    .return ($P110)
+  control_1261:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P108, exception, "payload"
+    .return ($P108)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.sub "_block1266"  :anon :subid("47_1792415686.05651") :outer("46_1792415686.05651")
+    .param pmc param_1269
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 364
+    new $P111, "Undef"
+    set $P1268, $P111
+    .lex "$decl", $P1268
+    .lex "$_", param_1269
+    get_hll_global $P112, ["PAST"], "Var"
+    find_lex $P113, "$_"
+.annotate 'line', 367
+    find_lex $P1270, "$_"
+    unless_null $P1270, vivify_202
+    $P1270 = root_new ['parrot';'Hash']
+  vivify_202:
+    set $P114, $P1270["variable"]
+    unless_null $P114, vivify_203
+    new $P114, "Undef"
+  vivify_203:
+    set $S100, $P114
+.annotate 'line', 368
+    find_lex $P1271, "$/"
+    unless_null $P1271, vivify_204
+    $P1271 = root_new ['parrot';'Hash']
+  vivify_204:
+    set $P115, $P1271["type_declarator"]
+    unless_null $P115, vivify_205
+    new $P115, "Undef"
+  vivify_205:
+    set $S101, $P115
+.annotate 'line', 364
+    $P116 = $P112."new"($P113 :named("node"), 1 :named("isdecl"), $S100 :named("name"), $S101 :named("vivibase"))
+    store_lex "$decl", $P116
+.annotate 'line', 371
+    find_lex $P1273, "$_"
+    unless_null $P1273, vivify_206
+    $P1273 = root_new ['parrot';'Hash']
+  vivify_206:
+    set $P1274, $P1273["EXPR"]
+    unless_null $P1274, vivify_207
+    $P1274 = root_new ['parrot';'ResizablePMCArray']
+  vivify_207:
+    set $P112, $P1274[0]
+    unless_null $P112, vivify_208
+    new $P112, "Undef"
+  vivify_208:
+    unless $P112, if_1272_end
+    find_lex $P113, "$decl"
+    find_lex $P1275, "$_"
+    unless_null $P1275, vivify_209
+    $P1275 = root_new ['parrot';'Hash']
+  vivify_209:
+    set $P1276, $P1275["EXPR"]
+    unless_null $P1276, vivify_210
+    $P1276 = root_new ['parrot';'ResizablePMCArray']
+  vivify_210:
+    set $P114, $P1276[0]
+    unless_null $P114, vivify_211
+    new $P114, "Undef"
+  vivify_211:
+    $P115 = $P114."ast"()
+    $P113."viviself"($P115)
+  if_1272_end:
+.annotate 'line', 373
+    find_lex $P1278, "$_"
+    unless_null $P1278, vivify_212
+    $P1278 = root_new ['parrot';'Hash']
+  vivify_212:
+    set $P112, $P1278["array_size"]
+    unless_null $P112, vivify_213
+    new $P112, "Undef"
+  vivify_213:
+    unless $P112, if_1277_end
+    find_lex $P1279, "$_"
+    unless_null $P1279, vivify_214
+    $P1279 = root_new ['parrot';'Hash']
+  vivify_214:
+    set $P1280, $P1279["array_size"]
+    unless_null $P1280, vivify_215
+    $P1280 = root_new ['parrot';'Hash']
+  vivify_215:
+    set $P113, $P1280["VALUE"]
+    unless_null $P113, vivify_216
+    new $P113, "Undef"
+  vivify_216:
+    set $S100, $P113
+    new $P114, 'String'
+    set $P114, $S100
+    find_lex $P1281, "$decl"
+    unless_null $P1281, vivify_217
+    $P1281 = root_new ['parrot';'Hash']
+    store_lex "$decl", $P1281
+  vivify_217:
+    set $P1281["array_size"], $P114
+  if_1277_end:
+.annotate 'line', 374
+    find_lex $P1282, "$_"
+    unless_null $P1282, vivify_218
+    $P1282 = root_new ['parrot';'Hash']
+  vivify_218:
+    set $P112, $P1282["pointer"]
+    unless_null $P112, vivify_219
+    new $P112, "Undef"
+  vivify_219:
+    $P113 = $P112."join"("")
+    find_lex $P1283, "$decl"
+    unless_null $P1283, vivify_220
+    $P1283 = root_new ['parrot';'Hash']
+    store_lex "$decl", $P1283
+  vivify_220:
+    set $P1283["pointer"], $P113
+.annotate 'line', 375
+    find_lex $P112, "$past"
+    find_lex $P113, "$decl"
+    $P114 = $P112."push"($P113)
+.annotate 'line', 363
+    .return ($P114)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "statement_list"  :subid("48_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1288
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 381
+    .const 'Sub' $P1292 = "49_1792415686.05651" 
+    capture_lex $P1292
+    new $P1287, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1287, control_1286
+    push_eh $P1287
+    .lex "self", self
+    .lex "$/", param_1288
+.annotate 'line', 382
+    new $P107, "Undef"
+    set $P1289, $P107
+    .lex "$past", $P1289
+    get_hll_global $P108, ["PAST"], "Stmts"
+    find_lex $P109, "$/"
+    $P110 = $P108."new"($P109 :named("node"))
+    store_lex "$past", $P110
+.annotate 'line', 384
+    find_lex $P1290, "$/"
+    unless_null $P1290, vivify_221
+    $P1290 = root_new ['parrot';'Hash']
+  vivify_221:
+    set $P109, $P1290["labeled_statement"]
+    unless_null $P109, vivify_222
+    new $P109, "Undef"
+  vivify_222:
+    defined $I100, $P109
+    unless $I100, for_undef_223
+    iter $P108, $P109
+    new $P115, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P115, loop1294_handler
+    push_eh $P115
+  loop1294_test:
+    unless $P108, loop1294_done
+    shift $P110, $P108
+  loop1294_redo:
+    .const 'Sub' $P1292 = "49_1792415686.05651" 
+    capture_lex $P1292
+    $P1292($P110)
+  loop1294_next:
+    goto loop1294_test
+  loop1294_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P116, exception, 'type'
+    eq $P116, .CONTROL_LOOP_NEXT, loop1294_next
+    eq $P116, .CONTROL_LOOP_REDO, loop1294_redo
+  loop1294_done:
+    pop_eh 
+  for_undef_223:
+.annotate 'line', 387
+    find_lex $P108, "$/"
+    find_lex $P111, "$past"
+    $P112 = $P111."list"()
+    set $N100, $P112
+    iseq $I100, $N100, 1.0
+    if $I100, if_1296
+    new $P110, 'Integer'
+    set $P110, $I100
+    goto if_1296_end
+  if_1296:
+    get_hll_global $P113, ["PAST"], "Block"
+    find_lex $P1297, "$past"
+    unless_null $P1297, vivify_224
+    $P1297 = root_new ['parrot';'ResizablePMCArray']
+  vivify_224:
+    set $P114, $P1297[0]
+    unless_null $P114, vivify_225
+    new $P114, "Undef"
+  vivify_225:
+    $P115 = $P113."ACCEPTS"($P114)
+    set $P110, $P115
+  if_1296_end:
+    if $P110, if_1295
+    find_lex $P117, "$past"
+    set $P109, $P117
+    goto if_1295_end
+  if_1295:
+    find_lex $P1298, "$past"
+    unless_null $P1298, vivify_226
+    $P1298 = root_new ['parrot';'ResizablePMCArray']
+  vivify_226:
+    set $P116, $P1298[0]
+    unless_null $P116, vivify_227
+    new $P116, "Undef"
+  vivify_227:
+    set $P109, $P116
+  if_1295_end:
+.annotate 'line', 388
+    $P118 = $P108."!make"($P109)
+.annotate 'line', 381
+    .return ($P118)
+  control_1286:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P108, exception, "payload"
+    .return ($P108)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.sub "_block1291"  :anon :subid("49_1792415686.05651") :outer("48_1792415686.05651")
+    .param pmc param_1293
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 384
+    .lex "$_", param_1293
+    find_lex $P111, "$past"
+    find_lex $P112, "$_"
+    $P113 = $P112."ast"()
+    $P114 = $P111."push"($P113)
+    .return ($P114)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "labeled_statement"  :subid("50_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1302
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 392
+    new $P1301, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1301, control_1300
+    push_eh $P1301
+    .lex "self", self
+    .lex "$/", param_1302
+.annotate 'line', 394
+    new $P107, "Undef"
+    set $P1303, $P107
+    .lex "$past", $P1303
+.annotate 'line', 395
+    find_lex $P1305, "$/"
+    unless_null $P1305, vivify_228
+    $P1305 = root_new ['parrot';'Hash']
+  vivify_228:
+    set $P109, $P1305["statement"]
+    unless_null $P109, vivify_229
+    new $P109, "Undef"
+  vivify_229:
+    if $P109, if_1304
+.annotate 'line', 396
+    get_hll_global $P112, ["PAST"], "Op"
+    $P113 = $P112."new"()
+    set $P108, $P113
+.annotate 'line', 395
+    goto if_1304_end
+  if_1304:
+    find_lex $P1306, "$/"
+    unless_null $P1306, vivify_230
+    $P1306 = root_new ['parrot';'Hash']
+  vivify_230:
+    set $P110, $P1306["statement"]
+    unless_null $P110, vivify_231
+    new $P110, "Undef"
+  vivify_231:
+    $P111 = $P110."ast"()
+    set $P108, $P111
+  if_1304_end:
+    store_lex "$past", $P108
+.annotate 'line', 399
+    find_lex $P1308, "$/"
+    unless_null $P1308, vivify_232
+    $P1308 = root_new ['parrot';'Hash']
+  vivify_232:
+    set $P108, $P1308["label"]
+    unless_null $P108, vivify_233
+    new $P108, "Undef"
+  vivify_233:
+    unless $P108, if_1307_end
+    find_lex $P1309, "$/"
+    unless_null $P1309, vivify_234
+    $P1309 = root_new ['parrot';'Hash']
+  vivify_234:
+    set $P109, $P1309["label"]
+    unless_null $P109, vivify_235
+    new $P109, "Undef"
+  vivify_235:
+    set $S100, $P109
+    new $P110, 'String'
+    set $P110, $S100
+    find_lex $P1310, "$past"
+    unless_null $P1310, vivify_236
+    $P1310 = root_new ['parrot';'Hash']
+    store_lex "$past", $P1310
+  vivify_236:
+    set $P1310["label"], $P110
+  if_1307_end:
+.annotate 'line', 401
+    find_lex $P108, "$/"
+    find_lex $P109, "$past"
+    $P110 = $P108."!make"($P109)
+.annotate 'line', 392
+    .return ($P110)
+  control_1300:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P108, exception, "payload"
+    .return ($P108)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "statement"  :subid("51_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1314
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 404
+    new $P1313, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1313, control_1312
+    push_eh $P1313
+    .lex "self", self
+    .lex "$/", param_1314
+.annotate 'line', 405
+    new $P107, "Undef"
+    set $P1315, $P107
+    .lex "$past", $P1315
+.annotate 'line', 404
+    find_lex $P108, "$past"
+.annotate 'line', 407
+    find_lex $P1317, "$/"
+    unless_null $P1317, vivify_237
+    $P1317 = root_new ['parrot';'Hash']
+  vivify_237:
+    set $P108, $P1317["statement_control"]
+    unless_null $P108, vivify_238
+    new $P108, "Undef"
+  vivify_238:
+    if $P108, if_1316
+.annotate 'line', 410
+    find_lex $P1320, "$/"
+    unless_null $P1320, vivify_239
+    $P1320 = root_new ['parrot';'Hash']
+  vivify_239:
+    set $P109, $P1320["blockoid"]
+    unless_null $P109, vivify_240
+    new $P109, "Undef"
+  vivify_240:
+    if $P109, if_1319
+.annotate 'line', 413
+    find_lex $P1323, "$/"
+    unless_null $P1323, vivify_241
+    $P1323 = root_new ['parrot';'Hash']
+  vivify_241:
+    set $P110, $P1323["EXPR"]
+    unless_null $P110, vivify_242
+    new $P110, "Undef"
+  vivify_242:
+    if $P110, if_1322
+.annotate 'line', 416
+    find_lex $P1326, "$/"
+    unless_null $P1326, vivify_243
+    $P1326 = root_new ['parrot';'Hash']
+  vivify_243:
+    set $P111, $P1326["c_macro"]
+    unless_null $P111, vivify_244
+    new $P111, "Undef"
+  vivify_244:
+    if $P111, if_1325
+.annotate 'line', 420
+    find_lex $P112, "$/"
+    $P113 = $P112."CURSOR"()
+    $P113."panic"("Unknown content in statement")
+.annotate 'line', 419
+    goto if_1325_end
+  if_1325:
+.annotate 'line', 417
+    find_lex $P1327, "$/"
+    unless_null $P1327, vivify_245
+    $P1327 = root_new ['parrot';'Hash']
+  vivify_245:
+    set $P112, $P1327["c_macro"]
+    unless_null $P112, vivify_246
+    new $P112, "Undef"
+  vivify_246:
+    $P113 = $P112."ast"()
+    store_lex "$past", $P113
+  if_1325_end:
+.annotate 'line', 416
+    goto if_1322_end
+  if_1322:
+.annotate 'line', 414
+    find_lex $P1324, "$/"
+    unless_null $P1324, vivify_247
+    $P1324 = root_new ['parrot';'Hash']
+  vivify_247:
+    set $P111, $P1324["EXPR"]
+    unless_null $P111, vivify_248
+    new $P111, "Undef"
+  vivify_248:
+    $P112 = $P111."ast"()
+    store_lex "$past", $P112
+  if_1322_end:
+.annotate 'line', 413
+    goto if_1319_end
+  if_1319:
+.annotate 'line', 411
+    find_lex $P1321, "$/"
+    unless_null $P1321, vivify_249
+    $P1321 = root_new ['parrot';'Hash']
+  vivify_249:
+    set $P110, $P1321["blockoid"]
+    unless_null $P110, vivify_250
+    new $P110, "Undef"
+  vivify_250:
+    $P111 = $P110."ast"()
+    store_lex "$past", $P111
+  if_1319_end:
+.annotate 'line', 410
+    goto if_1316_end
+  if_1316:
+.annotate 'line', 408
+    find_lex $P1318, "$/"
+    unless_null $P1318, vivify_251
+    $P1318 = root_new ['parrot';'Hash']
+  vivify_251:
+    set $P109, $P1318["statement_control"]
+    unless_null $P109, vivify_252
+    new $P109, "Undef"
+  vivify_252:
+    $P110 = $P109."ast"()
+    store_lex "$past", $P110
+  if_1316_end:
+.annotate 'line', 423
+    find_lex $P108, "$/"
+    find_lex $P109, "$past"
+    $P110 = $P108."!make"($P109)
+.annotate 'line', 404
+    .return ($P110)
+  control_1312:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P108, exception, "payload"
+    .return ($P108)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "c_macro:sym<define>"  :subid("52_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1331
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 426
+    new $P1330, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1330, control_1329
+    push_eh $P1330
+    .lex "self", self
+    .lex "$/", param_1331
+.annotate 'line', 427
+    new $P107, "Undef"
+    set $P1332, $P107
+    .lex "$past", $P1332
+    get_hll_global $P108, ["PAST"], "Op"
+    find_lex $P1333, "$/"
+    unless_null $P1333, vivify_253
+    $P1333 = root_new ['parrot';'Hash']
+  vivify_253:
+    set $P109, $P1333["name"]
+    unless_null $P109, vivify_254
+    new $P109, "Undef"
+  vivify_254:
+    $P110 = $P108."new"($P109, "macro_define" :named("pasttype"))
+    store_lex "$past", $P110
+.annotate 'line', 432
+    find_lex $P1335, "$/"
+    unless_null $P1335, vivify_255
+    $P1335 = root_new ['parrot';'Hash']
+  vivify_255:
+    set $P108, $P1335["c_macro_args"]
+    unless_null $P108, vivify_256
+    new $P108, "Undef"
+  vivify_256:
+    unless $P108, if_1334_end
+    find_lex $P1336, "$/"
+    unless_null $P1336, vivify_257
+    $P1336 = root_new ['parrot';'Hash']
+  vivify_257:
+    set $P1337, $P1336["c_macro_args"]
+    unless_null $P1337, vivify_258
+    $P1337 = root_new ['parrot';'ResizablePMCArray']
+  vivify_258:
+    set $P109, $P1337[0]
+    unless_null $P109, vivify_259
+    new $P109, "Undef"
+  vivify_259:
+    $P110 = $P109."ast"()
+    find_lex $P1338, "$past"
+    unless_null $P1338, vivify_260
+    $P1338 = root_new ['parrot';'Hash']
+    store_lex "$past", $P1338
+  vivify_260:
+    set $P1338["macro_args"], $P110
+  if_1334_end:
+.annotate 'line', 433
+    find_lex $P1340, "$/"
+    unless_null $P1340, vivify_261
+    $P1340 = root_new ['parrot';'Hash']
+  vivify_261:
+    set $P108, $P1340["body"]
+    unless_null $P108, vivify_262
+    new $P108, "Undef"
+  vivify_262:
+    unless $P108, if_1339_end
+    find_lex $P1341, "$/"
+    unless_null $P1341, vivify_263
+    $P1341 = root_new ['parrot';'Hash']
+  vivify_263:
+    set $P1342, $P1341["body"]
+    unless_null $P1342, vivify_264
+    $P1342 = root_new ['parrot';'ResizablePMCArray']
+  vivify_264:
+    set $P109, $P1342[0]
+    unless_null $P109, vivify_265
+    new $P109, "Undef"
+  vivify_265:
+    $P110 = $P109."ast"()
+    find_lex $P1343, "$past"
+    unless_null $P1343, vivify_266
+    $P1343 = root_new ['parrot';'Hash']
+    store_lex "$past", $P1343
+  vivify_266:
+    set $P1343["body"], $P110
+  if_1339_end:
+.annotate 'line', 435
+    find_lex $P108, "$/"
+    find_lex $P109, "$past"
+    $P110 = $P108."!make"($P109)
+.annotate 'line', 426
+    .return ($P110)
+  control_1329:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P108, exception, "payload"
+    .return ($P108)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "c_macro:sym<if>"  :subid("53_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1347
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 438
+    new $P1346, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1346, control_1345
+    push_eh $P1346
+    .lex "self", self
+    .lex "$/", param_1347
+.annotate 'line', 439
+    new $P107, "Undef"
+    set $P1348, $P107
+    .lex "$past", $P1348
+    get_hll_global $P108, ["PAST"], "Op"
+.annotate 'line', 442
+    find_lex $P1349, "$/"
+    unless_null $P1349, vivify_267
+    $P1349 = root_new ['parrot';'Hash']
+  vivify_267:
+    set $P109, $P1349["condition"]
+    unless_null $P109, vivify_268
+    new $P109, "Undef"
+  vivify_268:
+    set $S100, $P109
+.annotate 'line', 443
+    find_lex $P1350, "$/"
+    unless_null $P1350, vivify_269
+    $P1350 = root_new ['parrot';'Hash']
+  vivify_269:
+    set $P110, $P1350["then"]
+    unless_null $P110, vivify_270
+    new $P110, "Undef"
+  vivify_270:
+    $P111 = $P110."ast"()
+    $P112 = $P108."new"($S100, $P111, "macro_if" :named("pasttype"))
+.annotate 'line', 439
+    store_lex "$past", $P112
+.annotate 'line', 446
+    find_lex $P1352, "$/"
+    unless_null $P1352, vivify_271
+    $P1352 = root_new ['parrot';'Hash']
+  vivify_271:
+    set $P108, $P1352["else"]
+    unless_null $P108, vivify_272
+    new $P108, "Undef"
+  vivify_272:
+    unless $P108, if_1351_end
+    find_lex $P109, "$past"
+    find_lex $P1353, "$/"
+    unless_null $P1353, vivify_273
+    $P1353 = root_new ['parrot';'Hash']
+  vivify_273:
+    set $P1354, $P1353["else"]
+    unless_null $P1354, vivify_274
+    $P1354 = root_new ['parrot';'ResizablePMCArray']
+  vivify_274:
+    set $P110, $P1354[0]
+    unless_null $P110, vivify_275
+    new $P110, "Undef"
+  vivify_275:
+    $P111 = $P110."ast"()
+    $P109."push"($P111)
+  if_1351_end:
+.annotate 'line', 448
+    find_lex $P108, "$/"
+    find_lex $P109, "$past"
+    $P110 = $P108."!make"($P109)
+.annotate 'line', 438
+    .return ($P110)
+  control_1345:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P108, exception, "payload"
+    .return ($P108)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "c_macro:sym<ifdef>"  :subid("54_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1358
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 451
+    new $P1357, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1357, control_1356
+    push_eh $P1357
+    .lex "self", self
+    .lex "$/", param_1358
+.annotate 'line', 452
+    new $P107, "Undef"
+    set $P1359, $P107
+    .lex "$past", $P1359
+    get_hll_global $P108, ["PAST"], "Op"
+.annotate 'line', 455
+    new $P109, "String"
+    assign $P109, "defined("
+    find_lex $P1360, "$/"
+    unless_null $P1360, vivify_276
+    $P1360 = root_new ['parrot';'Hash']
+  vivify_276:
+    set $P110, $P1360["name"]
+    unless_null $P110, vivify_277
+    new $P110, "Undef"
+  vivify_277:
+    set $S100, $P110
+    concat $P111, $P109, $S100
+    concat $P112, $P111, ")"
+.annotate 'line', 456
+    find_lex $P1361, "$/"
+    unless_null $P1361, vivify_278
+    $P1361 = root_new ['parrot';'Hash']
+  vivify_278:
+    set $P113, $P1361["then"]
+    unless_null $P113, vivify_279
+    new $P113, "Undef"
+  vivify_279:
+    $P114 = $P113."ast"()
+    $P115 = $P108."new"($P112, $P114, "macro_if" :named("pasttype"))
+.annotate 'line', 452
+    store_lex "$past", $P115
+.annotate 'line', 459
+    find_lex $P1363, "$/"
+    unless_null $P1363, vivify_280
+    $P1363 = root_new ['parrot';'Hash']
+  vivify_280:
+    set $P108, $P1363["else"]
+    unless_null $P108, vivify_281
+    new $P108, "Undef"
+  vivify_281:
+    unless $P108, if_1362_end
+    find_lex $P109, "$past"
+    find_lex $P1364, "$/"
+    unless_null $P1364, vivify_282
+    $P1364 = root_new ['parrot';'Hash']
+  vivify_282:
+    set $P1365, $P1364["else"]
+    unless_null $P1365, vivify_283
+    $P1365 = root_new ['parrot';'ResizablePMCArray']
+  vivify_283:
+    set $P110, $P1365[0]
+    unless_null $P110, vivify_284
+    new $P110, "Undef"
+  vivify_284:
+    $P111 = $P110."ast"()
+    $P109."push"($P111)
+  if_1362_end:
+.annotate 'line', 461
+    find_lex $P108, "$/"
+    find_lex $P109, "$past"
+    $P110 = $P108."!make"($P109)
+.annotate 'line', 451
+    .return ($P110)
+  control_1356:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P108, exception, "payload"
+    .return ($P108)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "term:sym<concatenate_strings>"  :subid("55_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1369
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 464
+    new $P1368, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1368, control_1367
+    push_eh $P1368
+    .lex "self", self
+    .lex "$/", param_1369
+.annotate 'line', 465
+    find_lex $P107, "$/"
+    find_lex $P1370, "$/"
+    unless_null $P1370, vivify_285
+    $P1370 = root_new ['parrot';'Hash']
+  vivify_285:
+    set $P108, $P1370["identifier"]
+    unless_null $P108, vivify_286
+    new $P108, "Undef"
+  vivify_286:
+    set $S100, $P108
+    new $P109, 'String'
+    set $P109, $S100
+    concat $P110, $P109, " "
+    find_lex $P1371, "$/"
+    unless_null $P1371, vivify_287
+    $P1371 = root_new ['parrot';'Hash']
+  vivify_287:
+    set $P111, $P1371["quote"]
+    unless_null $P111, vivify_288
+    new $P111, "Undef"
+  vivify_288:
+    set $S101, $P111
+    concat $P112, $P110, $S101
+    $P113 = $P107."!make"($P112)
+.annotate 'line', 464
+    .return ($P113)
+  control_1367:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P107, exception, "payload"
+    .return ($P107)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "term:sym<identifier>"  :subid("56_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1375
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 468
+    new $P1374, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1374, control_1373
+    push_eh $P1374
+    .lex "self", self
+    .lex "$/", param_1375
+.annotate 'line', 470
+    find_lex $P107, "$/"
+    get_hll_global $P108, ["PAST"], "Var"
+.annotate 'line', 471
+    find_lex $P109, "$/"
+    set $S100, $P109
+.annotate 'line', 470
+    $P110 = $P108."new"($S100 :named("name"))
+    $P111 = $P107."!make"($P110)
+.annotate 'line', 468
+    .return ($P111)
+  control_1373:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P107, exception, "payload"
+    .return ($P107)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "term:sym<call>"  :subid("57_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1379
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 475
+    .const 'Sub' $P1388 = "58_1792415686.05651" 
+    capture_lex $P1388
+    new $P1378, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1378, control_1377
+    push_eh $P1378
+    .lex "self", self
+    .lex "$/", param_1379
+.annotate 'line', 476
+    new $P107, "Undef"
+    set $P1380, $P107
+    .lex "$past", $P1380
+    get_hll_global $P108, ["PAST"], "Op"
+.annotate 'line', 478
+    find_lex $P1381, "$/"
+    unless_null $P1381, vivify_289
+    $P1381 = root_new ['parrot';'Hash']
+  vivify_289:
+    set $P109, $P1381["identifier"]
+    unless_null $P109, vivify_290
+    new $P109, "Undef"
+  vivify_290:
+    set $S100, $P109
+.annotate 'line', 476
+    $P110 = $P108."new"("call" :named("pasttype"), $S100 :named("name"))
+    store_lex "$past", $P110
+.annotate 'line', 481
+    find_lex $P1383, "$/"
+    unless_null $P1383, vivify_291
+    $P1383 = root_new ['parrot';'Hash']
+  vivify_291:
+    set $P1384, $P1383["arglist"]
+    unless_null $P1384, vivify_292
+    $P1384 = root_new ['parrot';'Hash']
+  vivify_292:
+    set $P108, $P1384["arg"]
+    unless_null $P108, vivify_293
+    new $P108, "Undef"
+  vivify_293:
+    unless $P108, if_1382_end
+.annotate 'line', 482
+    find_lex $P1385, "$/"
+    unless_null $P1385, vivify_294
+    $P1385 = root_new ['parrot';'Hash']
+  vivify_294:
+    set $P1386, $P1385["arglist"]
+    unless_null $P1386, vivify_295
+    $P1386 = root_new ['parrot';'Hash']
+  vivify_295:
+    set $P110, $P1386["arg"]
+    unless_null $P110, vivify_296
+    new $P110, "Undef"
+  vivify_296:
+    defined $I100, $P110
+    unless $I100, for_undef_297
+    iter $P109, $P110
+    new $P116, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P116, loop1390_handler
+    push_eh $P116
+  loop1390_test:
+    unless $P109, loop1390_done
+    shift $P111, $P109
+  loop1390_redo:
+    .const 'Sub' $P1388 = "58_1792415686.05651" 
+    capture_lex $P1388
+    $P1388($P111)
+  loop1390_next:
+    goto loop1390_test
+  loop1390_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P117, exception, 'type'
+    eq $P117, .CONTROL_LOOP_NEXT, loop1390_next
+    eq $P117, .CONTROL_LOOP_REDO, loop1390_redo
+  loop1390_done:
+    pop_eh 
+  for_undef_297:
+  if_1382_end:
+.annotate 'line', 485
+    find_lex $P108, "$/"
+    find_lex $P109, "$past"
+    $P110 = $P108."!make"($P109)
+.annotate 'line', 475
+    .return ($P110)
+  control_1377:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P108, exception, "payload"
+    .return ($P108)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.sub "_block1387"  :anon :subid("58_1792415686.05651") :outer("57_1792415686.05651")
+    .param pmc param_1389
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 482
+    .lex "$_", param_1389
+    find_lex $P112, "$past"
+    find_lex $P113, "$_"
+    $P114 = $P113."ast"()
+    $P115 = $P112."push"($P114)
+    .return ($P115)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "arg"  :subid("59_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1394
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 488
+    new $P1393, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1393, control_1392
+    push_eh $P1393
+    .lex "self", self
+    .lex "$/", param_1394
+.annotate 'line', 489
+    find_lex $P107, "$/"
+.annotate 'line', 490
+    find_lex $P1396, "$/"
+    unless_null $P1396, vivify_298
+    $P1396 = root_new ['parrot';'Hash']
+  vivify_298:
+    set $P109, $P1396["type_declarator"]
+    unless_null $P109, vivify_299
+    new $P109, "Undef"
+  vivify_299:
+    if $P109, if_1395
+.annotate 'line', 491
+    find_lex $P1398, "$/"
+    unless_null $P1398, vivify_300
+    $P1398 = root_new ['parrot';'Hash']
+  vivify_300:
+    set $P111, $P1398["EXPR"]
+    unless_null $P111, vivify_301
+    new $P111, "Undef"
+  vivify_301:
+    $P112 = $P111."ast"()
+    set $P108, $P112
+.annotate 'line', 490
+    goto if_1395_end
+  if_1395:
+    find_lex $P1397, "$/"
+    unless_null $P1397, vivify_302
+    $P1397 = root_new ['parrot';'Hash']
+  vivify_302:
+    set $P110, $P1397["type_declarator"]
+    unless_null $P110, vivify_303
+    new $P110, "Undef"
+  vivify_303:
+    set $S100, $P110
+    new $P108, 'String'
+    set $P108, $S100
+  if_1395_end:
+    $P113 = $P107."!make"($P108)
+.annotate 'line', 488
+    .return ($P113)
+  control_1392:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P107, exception, "payload"
+    .return ($P107)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "term:sym<reg>"  :subid("60_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1402
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 494
+    new $P1401, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1401, control_1400
+    push_eh $P1401
+    .lex "self", self
+    .lex "$/", param_1402
+.annotate 'line', 495
+    find_lex $P107, "$/"
+    get_hll_global $P108, ["PAST"], "Var"
+.annotate 'line', 496
+    find_lex $P1403, "$/"
+    unless_null $P1403, vivify_304
+    $P1403 = root_new ['parrot';'Hash']
+  vivify_304:
+    set $P109, $P1403["num"]
+    unless_null $P109, vivify_305
+    new $P109, "Undef"
+  vivify_305:
+    set $N100, $P109
+.annotate 'line', 495
+    find_lex $P110, "$/"
+    $P111 = $P108."new"($N100 :named("name"), $P110 :named("node"), "register" :named("scope"))
+    $P112 = $P107."!make"($P111)
+.annotate 'line', 494
+    .return ($P112)
+  control_1400:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P107, exception, "payload"
+    .return ($P107)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "term:sym<macro>"  :subid("61_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1407
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 502
+    new $P1406, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1406, control_1405
+    push_eh $P1406
+    .lex "self", self
+    .lex "$/", param_1407
+.annotate 'line', 503
+    find_lex $P107, "$/"
+    find_lex $P1408, "$/"
+    unless_null $P1408, vivify_306
+    $P1408 = root_new ['parrot';'Hash']
+  vivify_306:
+    set $P108, $P1408["op_macro"]
+    unless_null $P108, vivify_307
+    new $P108, "Undef"
+  vivify_307:
+    $P109 = $P108."ast"()
+    $P110 = $P107."!make"($P109)
+.annotate 'line', 502
+    .return ($P110)
+  control_1405:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P107, exception, "payload"
+    .return ($P107)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "term:sym<int>"  :subid("62_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1412
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 506
+    new $P1411, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1411, control_1410
+    push_eh $P1411
+    .lex "self", self
+    .lex "$/", param_1412
+.annotate 'line', 508
+    find_lex $P107, "$/"
+    get_hll_global $P108, ["PAST"], "Val"
+.annotate 'line', 509
+    find_lex $P109, "$/"
+    set $S100, $P109
+.annotate 'line', 508
+    $P110 = $P108."new"($S100 :named("value"), "int" :named("returns"))
+    $P111 = $P107."!make"($P110)
+.annotate 'line', 506
+    .return ($P111)
+  control_1410:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P107, exception, "payload"
+    .return ($P107)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "term:sym<str>"  :subid("63_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1416
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 514
+    new $P1415, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1415, control_1414
+    push_eh $P1415
+    .lex "self", self
+    .lex "$/", param_1416
+.annotate 'line', 515
+    find_lex $P107, "$/"
+    get_hll_global $P108, ["PAST"], "Val"
+.annotate 'line', 516
+    find_lex $P1417, "$/"
+    unless_null $P1417, vivify_308
+    $P1417 = root_new ['parrot';'Hash']
+  vivify_308:
+    set $P109, $P1417["quote"]
+    unless_null $P109, vivify_309
+    new $P109, "Undef"
+  vivify_309:
+    set $S100, $P109
+.annotate 'line', 515
+    $P110 = $P108."new"($S100 :named("value"), "string" :named("returns"))
+    $P111 = $P107."!make"($P110)
+.annotate 'line', 514
+    .return ($P111)
+  control_1414:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P107, exception, "payload"
+    .return ($P107)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "term:sym<float_constant_long>"  :subid("64_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1421
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 521
+    new $P1420, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1420, control_1419
+    push_eh $P1420
+    .lex "self", self
+    .lex "$/", param_1421
+.annotate 'line', 522
+    find_lex $P107, "$/"
+    get_hll_global $P108, ["PAST"], "Val"
+.annotate 'line', 523
+    find_lex $P1422, "$/"
+    unless_null $P1422, vivify_310
+    $P1422 = root_new ['parrot';'ResizablePMCArray']
+  vivify_310:
+    set $P109, $P1422[0]
+    unless_null $P109, vivify_311
+    new $P109, "Undef"
+  vivify_311:
+    set $S100, $P109
+.annotate 'line', 522
+    $P110 = $P108."new"($S100 :named("value"), "float" :named("returns"))
+    $P111 = $P107."!make"($P110)
+.annotate 'line', 521
+    .return ($P111)
+  control_1419:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P107, exception, "payload"
+    .return ($P107)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "infix:sym<?:>"  :subid("65_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1426
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 528
+    new $P1425, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1425, control_1424
+    push_eh $P1425
+    .lex "self", self
+    .lex "$/", param_1426
+.annotate 'line', 529
+    new $P107, "Undef"
+    set $P1427, $P107
+    .lex "$past", $P1427
+    get_hll_global $P108, ["PAST"], "Op"
+    $P109 = $P108."new"("if" :named("pasttype"))
+    store_lex "$past", $P109
+.annotate 'line', 533
+    new $P108, "Integer"
+    assign $P108, 1
+    find_lex $P1428, "$past"
+    unless_null $P1428, vivify_312
+    $P1428 = root_new ['parrot';'Hash']
+    store_lex "$past", $P1428
+  vivify_312:
+    set $P1428["ternary"], $P108
+.annotate 'line', 534
+    find_lex $P108, "$/"
+    find_lex $P109, "$past"
+    $P110 = $P108."!make"($P109)
+.annotate 'line', 528
+    .return ($P110)
+  control_1424:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P108, exception, "payload"
+    .return ($P108)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "statement_control:sym<if>"  :subid("66_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1432
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 537
+    new $P1431, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1431, control_1430
+    push_eh $P1431
+    .lex "self", self
+    .lex "$/", param_1432
+.annotate 'line', 538
+    new $P107, "Undef"
+    set $P1433, $P107
+    .lex "$past", $P1433
+    get_hll_global $P108, ["PAST"], "Op"
+.annotate 'line', 541
+    find_lex $P1434, "$/"
+    unless_null $P1434, vivify_313
+    $P1434 = root_new ['parrot';'Hash']
+  vivify_313:
+    set $P109, $P1434["EXPR"]
+    unless_null $P109, vivify_314
+    new $P109, "Undef"
+  vivify_314:
+    $P110 = $P109."ast"()
+.annotate 'line', 542
+    find_lex $P1435, "$/"
+    unless_null $P1435, vivify_315
+    $P1435 = root_new ['parrot';'Hash']
+  vivify_315:
+    set $P111, $P1435["then"]
+    unless_null $P111, vivify_316
+    new $P111, "Undef"
+  vivify_316:
+    $P112 = $P111."ast"()
+    $P113 = $P108."new"($P110, $P112, "if" :named("pasttype"))
+.annotate 'line', 538
+    store_lex "$past", $P113
+.annotate 'line', 545
+    find_lex $P1437, "$/"
+    unless_null $P1437, vivify_317
+    $P1437 = root_new ['parrot';'Hash']
+  vivify_317:
+    set $P108, $P1437["else"]
+    unless_null $P108, vivify_318
+    new $P108, "Undef"
+  vivify_318:
+    unless $P108, if_1436_end
+    find_lex $P109, "$past"
+    find_lex $P1438, "$/"
+    unless_null $P1438, vivify_319
+    $P1438 = root_new ['parrot';'Hash']
+  vivify_319:
+    set $P1439, $P1438["else"]
+    unless_null $P1439, vivify_320
+    $P1439 = root_new ['parrot';'ResizablePMCArray']
+  vivify_320:
+    set $P110, $P1439[0]
+    unless_null $P110, vivify_321
+    new $P110, "Undef"
+  vivify_321:
+    $P111 = $P110."ast"()
+    $P109."push"($P111)
+  if_1436_end:
+.annotate 'line', 547
+    find_lex $P108, "$/"
+    find_lex $P109, "$past"
+    $P110 = $P108."!make"($P109)
+.annotate 'line', 537
+    .return ($P110)
+  control_1430:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P108, exception, "payload"
+    .return ($P108)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "statement_control:sym<while>"  :subid("67_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1443
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 550
+    new $P1442, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1442, control_1441
+    push_eh $P1442
+    .lex "self", self
+    .lex "$/", param_1443
+.annotate 'line', 551
+    new $P107, "Undef"
+    set $P1444, $P107
+    .lex "$past", $P1444
+    get_hll_global $P108, ["PAST"], "Op"
+.annotate 'line', 554
+    find_lex $P1445, "$/"
+    unless_null $P1445, vivify_322
+    $P1445 = root_new ['parrot';'Hash']
+  vivify_322:
+    set $P109, $P1445["condition"]
+    unless_null $P109, vivify_323
+    new $P109, "Undef"
+  vivify_323:
+    $P110 = $P109."ast"()
+.annotate 'line', 555
+    find_lex $P1446, "$/"
+    unless_null $P1446, vivify_324
+    $P1446 = root_new ['parrot';'Hash']
+  vivify_324:
+    set $P111, $P1446["statement_list"]
+    unless_null $P111, vivify_325
+    new $P111, "Undef"
+  vivify_325:
+    $P112 = $P111."ast"()
+    $P113 = $P108."new"($P110, $P112, "while" :named("pasttype"))
+.annotate 'line', 551
+    store_lex "$past", $P113
+.annotate 'line', 558
+    find_lex $P108, "$/"
+    find_lex $P109, "$past"
+    $P110 = $P108."!make"($P109)
+.annotate 'line', 550
+    .return ($P110)
+  control_1441:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P108, exception, "payload"
+    .return ($P108)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "statement_control:sym<do-while>"  :subid("68_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1450
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 561
+    new $P1449, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1449, control_1448
+    push_eh $P1449
+    .lex "self", self
+    .lex "$/", param_1450
+.annotate 'line', 562
+    new $P107, "Undef"
+    set $P1451, $P107
+    .lex "$past", $P1451
+    get_hll_global $P108, ["PAST"], "Op"
+.annotate 'line', 565
+    find_lex $P1452, "$/"
+    unless_null $P1452, vivify_326
+    $P1452 = root_new ['parrot';'Hash']
+  vivify_326:
+    set $P109, $P1452["blockoid"]
+    unless_null $P109, vivify_327
+    new $P109, "Undef"
+  vivify_327:
+    $P110 = $P109."ast"()
+.annotate 'line', 566
+    find_lex $P1453, "$/"
+    unless_null $P1453, vivify_328
+    $P1453 = root_new ['parrot';'Hash']
+  vivify_328:
+    set $P111, $P1453["condition"]
+    unless_null $P111, vivify_329
+    new $P111, "Undef"
+  vivify_329:
+    $P112 = $P111."ast"()
+    $P113 = $P108."new"($P110, $P112, "do-while" :named("pasttype"))
+.annotate 'line', 562
+    store_lex "$past", $P113
+.annotate 'line', 569
+    find_lex $P108, "$/"
+    find_lex $P109, "$past"
+    $P110 = $P108."!make"($P109)
+.annotate 'line', 561
+    .return ($P110)
+  control_1448:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P108, exception, "payload"
+    .return ($P108)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "statement_control:sym<for>"  :subid("69_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1457
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 572
+    new $P1456, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1456, control_1455
+    push_eh $P1456
+    .lex "self", self
+    .lex "$/", param_1457
+.annotate 'line', 573
+    new $P107, "Undef"
+    set $P1458, $P107
+    .lex "$past", $P1458
+    get_hll_global $P108, ["PAST"], "Op"
+.annotate 'line', 576
+    find_lex $P1460, "$/"
+    unless_null $P1460, vivify_330
+    $P1460 = root_new ['parrot';'Hash']
+  vivify_330:
+    set $P110, $P1460["init"]
+    unless_null $P110, vivify_331
+    new $P110, "Undef"
+  vivify_331:
+    if $P110, if_1459
+    get_hll_global $P113, "undef"
+    set $P109, $P113
+    goto if_1459_end
+  if_1459:
+    find_lex $P1461, "$/"
+    unless_null $P1461, vivify_332
+    $P1461 = root_new ['parrot';'Hash']
+  vivify_332:
+    set $P1462, $P1461["init"]
+    unless_null $P1462, vivify_333
+    $P1462 = root_new ['parrot';'ResizablePMCArray']
+  vivify_333:
+    set $P111, $P1462[0]
+    unless_null $P111, vivify_334
+    new $P111, "Undef"
+  vivify_334:
+    $P112 = $P111."ast"()
+    set $P109, $P112
+  if_1459_end:
+.annotate 'line', 577
+    find_lex $P1464, "$/"
+    unless_null $P1464, vivify_335
+    $P1464 = root_new ['parrot';'Hash']
+  vivify_335:
+    set $P115, $P1464["test"]
+    unless_null $P115, vivify_336
+    new $P115, "Undef"
+  vivify_336:
+    if $P115, if_1463
+    get_hll_global $P118, "undef"
+    set $P114, $P118
+    goto if_1463_end
+  if_1463:
+    find_lex $P1465, "$/"
+    unless_null $P1465, vivify_337
+    $P1465 = root_new ['parrot';'Hash']
+  vivify_337:
+    set $P1466, $P1465["test"]
+    unless_null $P1466, vivify_338
+    $P1466 = root_new ['parrot';'ResizablePMCArray']
+  vivify_338:
+    set $P116, $P1466[0]
+    unless_null $P116, vivify_339
+    new $P116, "Undef"
+  vivify_339:
+    $P117 = $P116."ast"()
+    set $P114, $P117
+  if_1463_end:
+.annotate 'line', 578
+    find_lex $P1468, "$/"
+    unless_null $P1468, vivify_340
+    $P1468 = root_new ['parrot';'Hash']
+  vivify_340:
+    set $P120, $P1468["step"]
+    unless_null $P120, vivify_341
+    new $P120, "Undef"
+  vivify_341:
+    if $P120, if_1467
+    get_hll_global $P123, "undef"
+    set $P119, $P123
+    goto if_1467_end
+  if_1467:
+    find_lex $P1469, "$/"
+    unless_null $P1469, vivify_342
+    $P1469 = root_new ['parrot';'Hash']
+  vivify_342:
+    set $P1470, $P1469["step"]
+    unless_null $P1470, vivify_343
+    $P1470 = root_new ['parrot';'ResizablePMCArray']
+  vivify_343:
+    set $P121, $P1470[0]
+    unless_null $P121, vivify_344
+    new $P121, "Undef"
+  vivify_344:
+    $P122 = $P121."ast"()
+    set $P119, $P122
+  if_1467_end:
+.annotate 'line', 579
+    find_lex $P1471, "$/"
+    unless_null $P1471, vivify_345
+    $P1471 = root_new ['parrot';'Hash']
+  vivify_345:
+    set $P124, $P1471["statement_list"]
+    unless_null $P124, vivify_346
+    new $P124, "Undef"
+  vivify_346:
+    $P125 = $P124."ast"()
+    $P126 = $P108."new"($P109, $P114, $P119, $P125, "for" :named("pasttype"))
+.annotate 'line', 573
+    store_lex "$past", $P126
+.annotate 'line', 582
+    find_lex $P108, "$/"
+    find_lex $P109, "$past"
+    $P110 = $P108."!make"($P109)
+.annotate 'line', 572
+    .return ($P110)
+  control_1455:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P108, exception, "payload"
+    .return ($P108)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "statement_control:sym<switch>"  :subid("70_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1475
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 586
+    new $P1474, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1474, control_1473
+    push_eh $P1474
+    .lex "self", self
+    .lex "$/", param_1475
+.annotate 'line', 587
+    new $P107, "Undef"
+    set $P1476, $P107
+    .lex "$past", $P1476
+    get_hll_global $P108, ["PAST"], "Op"
+.annotate 'line', 589
+    find_lex $P1477, "$/"
+    unless_null $P1477, vivify_347
+    $P1477 = root_new ['parrot';'Hash']
+  vivify_347:
+    set $P109, $P1477["test"]
+    unless_null $P109, vivify_348
+    new $P109, "Undef"
+  vivify_348:
+    $P110 = $P109."ast"()
+.annotate 'line', 590
+    find_lex $P1478, "$/"
+    unless_null $P1478, vivify_349
+    $P1478 = root_new ['parrot';'Hash']
+  vivify_349:
+    set $P111, $P1478["statement_list"]
+    unless_null $P111, vivify_350
+    new $P111, "Undef"
+  vivify_350:
+    $P112 = $P111."ast"()
+    $P113 = $P108."new"($P110, $P112, "switch" :named("pasttype"))
+.annotate 'line', 587
+    store_lex "$past", $P113
+.annotate 'line', 592
+    find_lex $P108, "$/"
+    find_lex $P109, "$past"
+    $P110 = $P108."!make"($P109)
+.annotate 'line', 586
+    .return ($P110)
+  control_1473:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P108, exception, "payload"
+    .return ($P108)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "statement_control:sym<break>"  :subid("71_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1482
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 595
+    new $P1481, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1481, control_1480
+    push_eh $P1481
+    .lex "self", self
+    .lex "$/", param_1482
+.annotate 'line', 596
+    new $P107, "Undef"
+    set $P1483, $P107
+    .lex "$past", $P1483
+    get_hll_global $P108, ["PAST"], "Op"
+    $P109 = $P108."new"()
+    store_lex "$past", $P109
+.annotate 'line', 597
+    new $P108, "String"
+    assign $P108, "break"
+    find_lex $P1484, "$past"
+    unless_null $P1484, vivify_351
+    $P1484 = root_new ['parrot';'Hash']
+    store_lex "$past", $P1484
+  vivify_351:
+    set $P1484["control"], $P108
+.annotate 'line', 598
+    find_lex $P108, "$/"
+    find_lex $P109, "$past"
+    $P110 = $P108."!make"($P109)
+.annotate 'line', 595
+    .return ($P110)
+  control_1480:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P108, exception, "payload"
+    .return ($P108)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "statement_control:sym<continue>"  :subid("72_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1488
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 601
+    new $P1487, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1487, control_1486
+    push_eh $P1487
+    .lex "self", self
+    .lex "$/", param_1488
+.annotate 'line', 602
+    new $P107, "Undef"
+    set $P1489, $P107
+    .lex "$past", $P1489
+    get_hll_global $P108, ["PAST"], "Op"
+    $P109 = $P108."new"()
+    store_lex "$past", $P109
+.annotate 'line', 603
+    new $P108, "String"
+    assign $P108, "continue"
+    find_lex $P1490, "$past"
+    unless_null $P1490, vivify_352
+    $P1490 = root_new ['parrot';'Hash']
+    store_lex "$past", $P1490
+  vivify_352:
+    set $P1490["control"], $P108
+.annotate 'line', 604
+    find_lex $P108, "$/"
+    find_lex $P109, "$past"
+    $P110 = $P108."!make"($P109)
+.annotate 'line', 601
+    .return ($P110)
+  control_1486:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P108, exception, "payload"
+    .return ($P108)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "statement_or_block"  :subid("73_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1494
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 607
+    new $P1493, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1493, control_1492
+    push_eh $P1493
+    .lex "self", self
+    .lex "$/", param_1494
+.annotate 'line', 609
+    find_lex $P1496, "$/"
+    unless_null $P1496, vivify_353
+    $P1496 = root_new ['parrot';'Hash']
+  vivify_353:
+    set $P108, $P1496["labeled_statement"]
+    unless_null $P108, vivify_354
+    new $P108, "Undef"
+  vivify_354:
+    if $P108, if_1495
+.annotate 'line', 612
+    find_lex $P115, "$/"
+    find_lex $P1498, "$/"
+    unless_null $P1498, vivify_355
+    $P1498 = root_new ['parrot';'Hash']
+  vivify_355:
+    set $P116, $P1498["blockoid"]
+    unless_null $P116, vivify_356
+    new $P116, "Undef"
+  vivify_356:
+    $P117 = $P116."ast"()
+    $P118 = $P115."!make"($P117)
+    set $P107, $P118
+.annotate 'line', 609
+    goto if_1495_end
+  if_1495:
+    find_lex $P109, "$/"
+    get_hll_global $P110, ["PAST"], "Block"
+.annotate 'line', 610
+    find_lex $P1497, "$/"
+    unless_null $P1497, vivify_357
+    $P1497 = root_new ['parrot';'Hash']
+  vivify_357:
+    set $P111, $P1497["labeled_statement"]
+    unless_null $P111, vivify_358
+    new $P111, "Undef"
+  vivify_358:
+    $P112 = $P111."ast"()
+    $P113 = $P110."new"($P112)
+.annotate 'line', 609
+    $P114 = $P109."!make"($P113)
+    set $P107, $P114
+  if_1495_end:
+.annotate 'line', 607
+    .return ($P107)
+  control_1492:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P108, exception, "payload"
+    .return ($P108)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "circumfix:sym<( )>"  :subid("74_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1502
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 615
+    new $P1501, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1501, control_1500
+    push_eh $P1501
+    .lex "self", self
+    .lex "$/", param_1502
+.annotate 'line', 616
+    new $P107, "Undef"
+    set $P1503, $P107
+    .lex "$past", $P1503
+    find_lex $P1504, "$/"
+    unless_null $P1504, vivify_359
+    $P1504 = root_new ['parrot';'Hash']
+  vivify_359:
+    set $P108, $P1504["EXPR"]
+    unless_null $P108, vivify_360
+    new $P108, "Undef"
+  vivify_360:
+    $P109 = $P108."ast"()
+    store_lex "$past", $P109
+.annotate 'line', 619
+    new $P108, "Integer"
+    assign $P108, 1
+    find_lex $P1505, "$past"
+    unless_null $P1505, vivify_361
+    $P1505 = root_new ['parrot';'Hash']
+    store_lex "$past", $P1505
+  vivify_361:
+    set $P1505["wrap"], $P108
+.annotate 'line', 621
+    find_lex $P108, "$/"
+    find_lex $P109, "$past"
+    $P110 = $P108."!make"($P109)
+.annotate 'line', 615
+    .return ($P110)
+  control_1500:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P108, exception, "payload"
+    .return ($P108)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "postcircumfix:sym<[ ]>"  :subid("75_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1509
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 624
+    new $P1508, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1508, control_1507
+    push_eh $P1508
+    .lex "self", self
+    .lex "$/", param_1509
+.annotate 'line', 625
+    find_lex $P107, "$/"
+    get_hll_global $P108, ["PAST"], "Var"
+.annotate 'line', 626
+    find_lex $P1510, "$/"
+    unless_null $P1510, vivify_362
+    $P1510 = root_new ['parrot';'Hash']
+  vivify_362:
+    set $P109, $P1510["EXPR"]
+    unless_null $P109, vivify_363
+    new $P109, "Undef"
+  vivify_363:
+    $P110 = $P109."ast"()
+    $P111 = $P108."new"($P110, "keyed" :named("scope"))
+.annotate 'line', 625
+    $P112 = $P107."!make"($P111)
+.annotate 'line', 624
+    .return ($P112)
+  control_1507:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P107, exception, "payload"
+    .return ($P107)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "prefix:sym<( )>"  :subid("76_1792415686.05651") :method :outer("11_1792415686.05651")
+    .param pmc param_1514
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 633
+    new $P1513, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1513, control_1512
+    push_eh $P1513
+    .lex "self", self
+    .lex "$/", param_1514
+.annotate 'line', 634
+    find_lex $P107, "$/"
+    get_hll_global $P108, ["PAST"], "Op"
+.annotate 'line', 635
+    find_lex $P1515, "$/"
+    unless_null $P1515, vivify_364
+    $P1515 = root_new ['parrot';'Hash']
+  vivify_364:
+    set $P109, $P1515["type_declarator"]
+    unless_null $P109, vivify_365
+    new $P109, "Undef"
+  vivify_365:
+    set $S100, $P109
+.annotate 'line', 634
+    $P110 = $P108."new"($S100 :named("returns"))
+    $P111 = $P107."!make"($P110)
+.annotate 'line', 633
+    .return ($P111)
+  control_1512:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P107, exception, "payload"
+    .return ($P107)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "opsize"  :subid("77_1792415686.05651") :method :outer("11_1792415686.05651")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 640
+    new $P1518, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1518, control_1517
+    push_eh $P1518
+    .lex "self", self
+.annotate 'line', 641
+    find_dynamic_lex $P107, "$/"
+    get_hll_global $P108, ["PAST"], "Val"
+.annotate 'line', 642
+    get_global $P109, "$OP"
+    $P110 = $P109."size"()
+.annotate 'line', 641
+    $P111 = $P108."new"($P110 :named("value"), "int" :named("returns"))
+    $P112 = $P107."!make"($P111)
+.annotate 'line', 640
+    .return ($P112)
+  control_1517:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P107, exception, "payload"
+    .return ($P107)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.include "except_types.pasm"
+.sub "make_write_barrier"  :subid("78_1792415686.05651") :method :outer("11_1792415686.05651")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 647
+    new $P1521, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1521, control_1520
+    push_eh $P1521
+    .lex "self", self
+.annotate 'line', 648
+    find_dynamic_lex $P107, "$/"
+    get_hll_global $P108, ["PAST"], "Op"
+.annotate 'line', 651
+    get_hll_global $P109, ["PAST"], "Var"
+    $P110 = $P109."new"("interp" :named("name"))
+.annotate 'line', 654
+    get_hll_global $P111, ["PAST"], "Op"
+.annotate 'line', 657
+    get_hll_global $P112, ["PAST"], "Var"
+    $P113 = $P112."new"("interp" :named("name"))
+    $P114 = $P111."new"($P113, "call" :named("pasttype"), "CURRENT_CONTEXT" :named("name"))
+.annotate 'line', 654
+    $P115 = $P108."new"($P110, $P114, "call" :named("pasttype"), "PARROT_GC_WRITE_BARRIER" :named("name"))
+.annotate 'line', 648
+    $P116 = $P107."!make"($P115)
+.annotate 'line', 647
+    .return ($P116)
+  control_1520:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P107, exception, "payload"
+    .return ($P107)
+.end
+
+
+.namespace ["Ops";"Compiler";"Actions"]
+.sub "_block1523" :load :anon :subid("79_1792415686.05651")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 6
+    .const '' $P1525 = "11_1792415686.05651" 
+    $P107 = $P1525()
+    .return ($P107)
+.end
+
+
+.namespace []
+.sub "_block1526" :load :anon :subid("80_1792415686.05651")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Actions.pm"
+.annotate 'line', 1
+    .const '' $P1528 = "10_1792415686.05651" 
+    $P100 = $P1528()
+    .return ($P100)
+.end
+
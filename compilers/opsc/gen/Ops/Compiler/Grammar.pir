@@ -0,0 +1,14362 @@
+
+.namespace []
+.sub "_block1000"  :anon :subid("10_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 0
+    .const 'Sub' $P1003 = "11_1792415686.23593" 
+    capture_lex $P1003
+.annotate 'line', 1
+    $P0 = find_dynamic_lex "$*CTXSAVE"
+    if null $P0 goto ctxsave_done
+    $I0 = can $P0, "ctxsave"
+    unless $I0 goto ctxsave_done
+    $P0."ctxsave"()
+  ctxsave_done:
+.annotate 'line', 8
+    .const 'Sub' $P1003 = "11_1792415686.23593" 
+    capture_lex $P1003
+    $P101 = $P1003()
+.annotate 'line', 1
+    .return ($P101)
+    .const 'Sub' $P1626 = "241_1792415686.23593" 
+    .return ($P1626)
+.end
+
+
+.namespace []
+.sub "" :load :init :subid("post242") :outer("10_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 0
+    .const 'Sub' $P1001 = "10_1792415686.23593" 
+    .local pmc block
+    set block, $P1001
+.annotate 'line', 4
+    load_bytecode "HLL.pbc"
+    $P1628 = get_root_global ["parrot"], "P6metaclass"
+    $P1628."new_class"("Ops::Compiler::Grammar", "HLL::Grammar" :named("parent"))
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "_block1002"  :subid("11_1792415686.23593") :outer("10_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .const 'Sub' $P1614 = "238_1792415686.23593" 
+    capture_lex $P1614
+    .const 'Sub' $P1605 = "236_1792415686.23593" 
+    capture_lex $P1605
+    .const 'Sub' $P1600 = "234_1792415686.23593" 
+    capture_lex $P1600
+    .const 'Sub' $P1591 = "232_1792415686.23593" 
+    capture_lex $P1591
+    .const 'Sub' $P1584 = "230_1792415686.23593" 
+    capture_lex $P1584
+    .const 'Sub' $P1580 = "228_1792415686.23593" 
+    capture_lex $P1580
+    .const 'Sub' $P1575 = "226_1792415686.23593" 
+    capture_lex $P1575
+    .const 'Sub' $P1567 = "224_1792415686.23593" 
+    capture_lex $P1567
+    .const 'Sub' $P1559 = "222_1792415686.23593" 
+    capture_lex $P1559
+    .const 'Sub' $P1553 = "220_1792415686.23593" 
+    capture_lex $P1553
+    .const 'Sub' $P1547 = "218_1792415686.23593" 
+    capture_lex $P1547
+    .const 'Sub' $P1542 = "216_1792415686.23593" 
+    capture_lex $P1542
+    .const 'Sub' $P1537 = "214_1792415686.23593" 
+    capture_lex $P1537
+    .const 'Sub' $P1532 = "212_1792415686.23593" 
+    capture_lex $P1532
+    .const 'Sub' $P1527 = "210_1792415686.23593" 
+    capture_lex $P1527
+    .const 'Sub' $P1522 = "208_1792415686.23593" 
+    capture_lex $P1522
+    .const 'Sub' $P1517 = "206_1792415686.23593" 
+    capture_lex $P1517
+    .const 'Sub' $P1512 = "204_1792415686.23593" 
+    capture_lex $P1512
+    .const 'Sub' $P1507 = "202_1792415686.23593" 
+    capture_lex $P1507
+    .const 'Sub' $P1503 = "200_1792415686.23593" 
+    capture_lex $P1503
+    .const 'Sub' $P1499 = "198_1792415686.23593" 
+    capture_lex $P1499
+    .const 'Sub' $P1494 = "196_1792415686.23593" 
+    capture_lex $P1494
+    .const 'Sub' $P1485 = "194_1792415686.23593" 
+    capture_lex $P1485
+    .const 'Sub' $P1480 = "192_1792415686.23593" 
+    capture_lex $P1480
+    .const 'Sub' $P1475 = "190_1792415686.23593" 
+    capture_lex $P1475
+    .const 'Sub' $P1470 = "188_1792415686.23593" 
+    capture_lex $P1470
+    .const 'Sub' $P1465 = "186_1792415686.23593" 
+    capture_lex $P1465
+    .const 'Sub' $P1461 = "184_1792415686.23593" 
+    capture_lex $P1461
+    .const 'Sub' $P1457 = "182_1792415686.23593" 
+    capture_lex $P1457
+    .const 'Sub' $P1452 = "180_1792415686.23593" 
+    capture_lex $P1452
+    .const 'Sub' $P1447 = "178_1792415686.23593" 
+    capture_lex $P1447
+    .const 'Sub' $P1442 = "176_1792415686.23593" 
+    capture_lex $P1442
+    .const 'Sub' $P1437 = "174_1792415686.23593" 
+    capture_lex $P1437
+    .const 'Sub' $P1432 = "172_1792415686.23593" 
+    capture_lex $P1432
+    .const 'Sub' $P1427 = "170_1792415686.23593" 
+    capture_lex $P1427
+    .const 'Sub' $P1422 = "168_1792415686.23593" 
+    capture_lex $P1422
+    .const 'Sub' $P1417 = "166_1792415686.23593" 
+    capture_lex $P1417
+    .const 'Sub' $P1412 = "164_1792415686.23593" 
+    capture_lex $P1412
+    .const 'Sub' $P1407 = "162_1792415686.23593" 
+    capture_lex $P1407
+    .const 'Sub' $P1402 = "160_1792415686.23593" 
+    capture_lex $P1402
+    .const 'Sub' $P1397 = "158_1792415686.23593" 
+    capture_lex $P1397
+    .const 'Sub' $P1392 = "156_1792415686.23593" 
+    capture_lex $P1392
+    .const 'Sub' $P1383 = "153_1792415686.23593" 
+    capture_lex $P1383
+    .const 'Sub' $P1378 = "151_1792415686.23593" 
+    capture_lex $P1378
+    .const 'Sub' $P1373 = "149_1792415686.23593" 
+    capture_lex $P1373
+    .const 'Sub' $P1368 = "147_1792415686.23593" 
+    capture_lex $P1368
+    .const 'Sub' $P1363 = "145_1792415686.23593" 
+    capture_lex $P1363
+    .const 'Sub' $P1358 = "143_1792415686.23593" 
+    capture_lex $P1358
+    .const 'Sub' $P1353 = "141_1792415686.23593" 
+    capture_lex $P1353
+    .const 'Sub' $P1348 = "139_1792415686.23593" 
+    capture_lex $P1348
+    .const 'Sub' $P1343 = "137_1792415686.23593" 
+    capture_lex $P1343
+    .const 'Sub' $P1338 = "135_1792415686.23593" 
+    capture_lex $P1338
+    .const 'Sub' $P1333 = "133_1792415686.23593" 
+    capture_lex $P1333
+    .const 'Sub' $P1328 = "131_1792415686.23593" 
+    capture_lex $P1328
+    .const 'Sub' $P1323 = "129_1792415686.23593" 
+    capture_lex $P1323
+    .const 'Sub' $P1318 = "127_1792415686.23593" 
+    capture_lex $P1318
+    .const 'Sub' $P1313 = "125_1792415686.23593" 
+    capture_lex $P1313
+    .const 'Sub' $P1308 = "123_1792415686.23593" 
+    capture_lex $P1308
+    .const 'Sub' $P1300 = "120_1792415686.23593" 
+    capture_lex $P1300
+    .const 'Sub' $P1296 = "118_1792415686.23593" 
+    capture_lex $P1296
+    .const 'Sub' $P1292 = "116_1792415686.23593" 
+    capture_lex $P1292
+    .const 'Sub' $P1282 = "113_1792415686.23593" 
+    capture_lex $P1282
+    .const 'Sub' $P1278 = "111_1792415686.23593" 
+    capture_lex $P1278
+    .const 'Sub' $P1267 = "108_1792415686.23593" 
+    capture_lex $P1267
+    .const 'Sub' $P1261 = "106_1792415686.23593" 
+    capture_lex $P1261
+    .const 'Sub' $P1257 = "104_1792415686.23593" 
+    capture_lex $P1257
+    .const 'Sub' $P1252 = "102_1792415686.23593" 
+    capture_lex $P1252
+    .const 'Sub' $P1247 = "100_1792415686.23593" 
+    capture_lex $P1247
+    .const 'Sub' $P1242 = "98_1792415686.23593" 
+    capture_lex $P1242
+    .const 'Sub' $P1235 = "96_1792415686.23593" 
+    capture_lex $P1235
+    .const 'Sub' $P1229 = "94_1792415686.23593" 
+    capture_lex $P1229
+    .const 'Sub' $P1216 = "92_1792415686.23593" 
+    capture_lex $P1216
+    .const 'Sub' $P1209 = "90_1792415686.23593" 
+    capture_lex $P1209
+    .const 'Sub' $P1203 = "88_1792415686.23593" 
+    capture_lex $P1203
+    .const 'Sub' $P1195 = "84_1792415686.23593" 
+    capture_lex $P1195
+    .const 'Sub' $P1190 = "82_1792415686.23593" 
+    capture_lex $P1190
+    .const 'Sub' $P1185 = "80_1792415686.23593" 
+    capture_lex $P1185
+    .const 'Sub' $P1180 = "78_1792415686.23593" 
+    capture_lex $P1180
+    .const 'Sub' $P1175 = "76_1792415686.23593" 
+    capture_lex $P1175
+    .const 'Sub' $P1171 = "74_1792415686.23593" 
+    capture_lex $P1171
+    .const 'Sub' $P1167 = "72_1792415686.23593" 
+    capture_lex $P1167
+    .const 'Sub' $P1156 = "70_1792415686.23593" 
+    capture_lex $P1156
+    .const 'Sub' $P1145 = "68_1792415686.23593" 
+    capture_lex $P1145
+    .const 'Sub' $P1134 = "66_1792415686.23593" 
+    capture_lex $P1134
+    .const 'Sub' $P1122 = "64_1792415686.23593" 
+    capture_lex $P1122
+    .const 'Sub' $P1116 = "60_1792415686.23593" 
+    capture_lex $P1116
+    .const 'Sub' $P1112 = "58_1792415686.23593" 
+    capture_lex $P1112
+    .const 'Sub' $P1108 = "56_1792415686.23593" 
+    capture_lex $P1108
+    .const 'Sub' $P1104 = "54_1792415686.23593" 
+    capture_lex $P1104
+    .const 'Sub' $P1100 = "52_1792415686.23593" 
+    capture_lex $P1100
+    .const 'Sub' $P1096 = "50_1792415686.23593" 
+    capture_lex $P1096
+    .const 'Sub' $P1092 = "48_1792415686.23593" 
+    capture_lex $P1092
+    .const 'Sub' $P1086 = "44_1792415686.23593" 
+    capture_lex $P1086
+    .const 'Sub' $P1082 = "42_1792415686.23593" 
+    capture_lex $P1082
+    .const 'Sub' $P1076 = "38_1792415686.23593" 
+    capture_lex $P1076
+    .const 'Sub' $P1072 = "36_1792415686.23593" 
+    capture_lex $P1072
+    .const 'Sub' $P1067 = "34_1792415686.23593" 
+    capture_lex $P1067
+    .const 'Sub' $P1062 = "32_1792415686.23593" 
+    capture_lex $P1062
+    .const 'Sub' $P1058 = "30_1792415686.23593" 
+    capture_lex $P1058
+    .const 'Sub' $P1050 = "28_1792415686.23593" 
+    capture_lex $P1050
+    .const 'Sub' $P1045 = "26_1792415686.23593" 
+    capture_lex $P1045
+    .const 'Sub' $P1035 = "24_1792415686.23593" 
+    capture_lex $P1035
+    .const 'Sub' $P1030 = "22_1792415686.23593" 
+    capture_lex $P1030
+    .const 'Sub' $P1025 = "20_1792415686.23593" 
+    capture_lex $P1025
+    .const 'Sub' $P1019 = "18_1792415686.23593" 
+    capture_lex $P1019
+    .const 'Sub' $P1015 = "16_1792415686.23593" 
+    capture_lex $P1015
+    .const 'Sub' $P1009 = "14_1792415686.23593" 
+    capture_lex $P1009
+    .const 'Sub' $P1004 = "12_1792415686.23593" 
+    capture_lex $P1004
+    $P0 = find_dynamic_lex "$*CTXSAVE"
+    if null $P0 goto ctxsave_done
+    $I0 = can $P0, "ctxsave"
+    unless $I0 goto ctxsave_done
+    $P0."ctxsave"()
+  ctxsave_done:
+    .return ()
+    .const 'Sub' $P1623 = "240_1792415686.23593" 
+    .return ($P1623)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "" :load :init :subid("post243") :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .const 'Sub' $P1003 = "11_1792415686.23593" 
+    .local pmc block
+    set block, $P1003
+.annotate 'line', 405
+    get_hll_global $P101, ["Ops";"Compiler"], "Grammar"
+    $P101."O"(":prec<z=>, :assoc<unary>", "%methodop")
+.annotate 'line', 406
+    get_hll_global $P101, ["Ops";"Compiler"], "Grammar"
+    $P101."O"(":prec<y=>, :assoc<left>", "%dotty")
+.annotate 'line', 407
+    get_hll_global $P101, ["Ops";"Compiler"], "Grammar"
+    $P101."O"(":prec<x=>, :assoc<unary>", "%autoincrement")
+.annotate 'line', 408
+    get_hll_global $P101, ["Ops";"Compiler"], "Grammar"
+    $P101."O"(":prec<w=>, :assoc<unary>", "%casting")
+.annotate 'line', 409
+    get_hll_global $P101, ["Ops";"Compiler"], "Grammar"
+    $P101."O"(":prec<v=>, :assoc<unary>", "%symbolic_unary")
+.annotate 'line', 410
+    get_hll_global $P101, ["Ops";"Compiler"], "Grammar"
+    $P101."O"(":prec<u=>, :assoc<left>", "%multiplicative")
+.annotate 'line', 411
+    get_hll_global $P101, ["Ops";"Compiler"], "Grammar"
+    $P101."O"(":prec<t=>, :assoc<left>", "%additive")
+.annotate 'line', 412
+    get_hll_global $P101, ["Ops";"Compiler"], "Grammar"
+    $P101."O"(":prec<r=>, :assoc<left>", "%concatenation")
+.annotate 'line', 413
+    get_hll_global $P101, ["Ops";"Compiler"], "Grammar"
+    $P101."O"(":prec<m=>, :assoc<left>", "%relational")
+.annotate 'line', 414
+    get_hll_global $P101, ["Ops";"Compiler"], "Grammar"
+    $P101."O"(":prec<l=>, :assoc<left>", "%tight_and")
+.annotate 'line', 415
+    get_hll_global $P101, ["Ops";"Compiler"], "Grammar"
+    $P101."O"(":prec<k=>, :assoc<left>", "%tight_or")
+.annotate 'line', 416
+    get_hll_global $P101, ["Ops";"Compiler"], "Grammar"
+    $P101."O"(":prec<j=>, :assoc<right>", "%conditional")
+.annotate 'line', 417
+    get_hll_global $P101, ["Ops";"Compiler"], "Grammar"
+    $P101."O"(":prec<i=>, :assoc<right>", "%assignment")
+.annotate 'line', 418
+    get_hll_global $P101, ["Ops";"Compiler"], "Grammar"
+    $P101."O"(":prec<g=>, :assoc<list>, :nextterm<nulltermish>", "%comma")
+.annotate 'line', 419
+    get_hll_global $P101, ["Ops";"Compiler"], "Grammar"
+    $P101."O"(":prec<f=>, :assoc<list>", "%list_infix")
+.annotate 'line', 420
+    get_hll_global $P101, ["Ops";"Compiler"], "Grammar"
+    $P101."O"(":prec<e=>, :assoc<unary>", "%list_prefix")
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "TOP"  :subid("12_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1005_tgt
+    .local int rx1005_pos
+    .local int rx1005_off
+    .local int rx1005_eos
+    .local int rx1005_rep
+    .local pmc rx1005_cur
+    .local pmc rx1005_debug
+    (rx1005_cur, rx1005_pos, rx1005_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1005_debug, rx1005_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1005_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1005_eos, rx1005_tgt
+    gt rx1005_pos, rx1005_eos, rx1005_done
+    set rx1005_off, 0
+    lt rx1005_pos, 2, rx1005_start
+    sub rx1005_off, rx1005_pos, 1
+    substr rx1005_tgt, rx1005_tgt, rx1005_off
+  rx1005_start:
+    eq $I10, 1, rx1005_restart
+    if_null rx1005_debug, debug_244
+    rx1005_cur."!cursor_debug"("START", "TOP")
+  debug_244:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1007_done
+    goto rxscan1007_scan
+  rxscan1007_loop:
+    ($P10) = rx1005_cur."from"()
+    inc $P10
+    set rx1005_pos, $P10
+    ge rx1005_pos, rx1005_eos, rxscan1007_done
+  rxscan1007_scan:
+    set_addr $I10, rxscan1007_loop
+    rx1005_cur."!mark_push"(0, rx1005_pos, $I10)
+  rxscan1007_done:
+  # rx subrule "ws" subtype=method negate=
+    rx1005_cur."!cursor_pos"(rx1005_pos)
+    $P10 = rx1005_cur."ws"()
+    unless $P10, rx1005_fail
+    rx1005_pos = $P10."pos"()
+.annotate 'line', 9
+  # rx subrule "body" subtype=capture negate=
+    rx1005_cur."!cursor_pos"(rx1005_pos)
+    $P10 = rx1005_cur."body"()
+    unless $P10, rx1005_fail
+    rx1005_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("body")
+    rx1005_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1005_cur."!cursor_pos"(rx1005_pos)
+    $P10 = rx1005_cur."ws"()
+    unless $P10, rx1005_fail
+    rx1005_pos = $P10."pos"()
+.annotate 'line', 10
+  # rx subrule "pod_ws" subtype=method negate=
+    rx1005_cur."!cursor_pos"(rx1005_pos)
+    $P10 = rx1005_cur."pod_ws"()
+    unless $P10, rx1005_fail
+    rx1005_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1005_cur."!cursor_pos"(rx1005_pos)
+    $P10 = rx1005_cur."ws"()
+    unless $P10, rx1005_fail
+    rx1005_pos = $P10."pos"()
+  alt1008_0:
+.annotate 'line', 11
+    set_addr $I10, alt1008_1
+    rx1005_cur."!mark_push"(0, rx1005_pos, $I10)
+  # rx subrule "ws" subtype=method negate=
+    rx1005_cur."!cursor_pos"(rx1005_pos)
+    $P10 = rx1005_cur."ws"()
+    unless $P10, rx1005_fail
+    rx1005_pos = $P10."pos"()
+  # rxanchor eos
+    ne rx1005_pos, rx1005_eos, rx1005_fail
+  # rx subrule "ws" subtype=method negate=
+    rx1005_cur."!cursor_pos"(rx1005_pos)
+    $P10 = rx1005_cur."ws"()
+    unless $P10, rx1005_fail
+    rx1005_pos = $P10."pos"()
+    goto alt1008_end
+  alt1008_1:
+  # rx subrule "ws" subtype=method negate=
+    rx1005_cur."!cursor_pos"(rx1005_pos)
+    $P10 = rx1005_cur."ws"()
+    unless $P10, rx1005_fail
+    rx1005_pos = $P10."pos"()
+  # rx subrule "panic" subtype=method negate=
+    rx1005_cur."!cursor_pos"(rx1005_pos)
+    $P10 = rx1005_cur."panic"("Syntax error")
+    unless $P10, rx1005_fail
+    rx1005_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1005_cur."!cursor_pos"(rx1005_pos)
+    $P10 = rx1005_cur."ws"()
+    unless $P10, rx1005_fail
+    rx1005_pos = $P10."pos"()
+  alt1008_end:
+  # rx subrule "ws" subtype=method negate=
+    rx1005_cur."!cursor_pos"(rx1005_pos)
+    $P10 = rx1005_cur."ws"()
+    unless $P10, rx1005_fail
+    rx1005_pos = $P10."pos"()
+.annotate 'line', 8
+  # rx pass
+    rx1005_cur."!cursor_pass"(rx1005_pos, "TOP")
+    if_null rx1005_debug, debug_245
+    rx1005_cur."!cursor_debug"("PASS", "TOP", " at pos=", rx1005_pos)
+  debug_245:
+    .return (rx1005_cur)
+  rx1005_restart:
+    if_null rx1005_debug, debug_246
+    rx1005_cur."!cursor_debug"("NEXT", "TOP")
+  debug_246:
+  rx1005_fail:
+    (rx1005_rep, rx1005_pos, $I10, $P10) = rx1005_cur."!mark_fail"(0)
+    lt rx1005_pos, -1, rx1005_done
+    eq rx1005_pos, -1, rx1005_fail
+    jump $I10
+  rx1005_done:
+    rx1005_cur."!cursor_fail"()
+    if_null rx1005_debug, debug_247
+    rx1005_cur."!cursor_debug"("FAIL", "TOP")
+  debug_247:
+    .return (rx1005_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__TOP"  :subid("13_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("ws", "")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "body"  :subid("14_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1010_tgt
+    .local int rx1010_pos
+    .local int rx1010_off
+    .local int rx1010_eos
+    .local int rx1010_rep
+    .local pmc rx1010_cur
+    .local pmc rx1010_debug
+    (rx1010_cur, rx1010_pos, rx1010_tgt, $I10) = self."!cursor_start"()
+    rx1010_cur."!cursor_caparray"("preamble", "op")
+    getattribute rx1010_debug, rx1010_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1010_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1010_eos, rx1010_tgt
+    gt rx1010_pos, rx1010_eos, rx1010_done
+    set rx1010_off, 0
+    lt rx1010_pos, 2, rx1010_start
+    sub rx1010_off, rx1010_pos, 1
+    substr rx1010_tgt, rx1010_tgt, rx1010_off
+  rx1010_start:
+    eq $I10, 1, rx1010_restart
+    if_null rx1010_debug, debug_248
+    rx1010_cur."!cursor_debug"("START", "body")
+  debug_248:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1012_done
+    goto rxscan1012_scan
+  rxscan1012_loop:
+    ($P10) = rx1010_cur."from"()
+    inc $P10
+    set rx1010_pos, $P10
+    ge rx1010_pos, rx1010_eos, rxscan1012_done
+  rxscan1012_scan:
+    set_addr $I10, rxscan1012_loop
+    rx1010_cur."!mark_push"(0, rx1010_pos, $I10)
+  rxscan1012_done:
+.annotate 'line', 14
+  # rx subrule "ws" subtype=method negate=
+    rx1010_cur."!cursor_pos"(rx1010_pos)
+    $P10 = rx1010_cur."ws"()
+    unless $P10, rx1010_fail
+    rx1010_pos = $P10."pos"()
+.annotate 'line', 21
+  # rx rxquantr1013 ** 0..*
+    set_addr $I10, rxquantr1013_done
+    rx1010_cur."!mark_push"(0, rx1010_pos, $I10)
+  rxquantr1013_loop:
+.annotate 'line', 15
+  # rx subrule "ws" subtype=method negate=
+    rx1010_cur."!cursor_pos"(rx1010_pos)
+    $P10 = rx1010_cur."ws"()
+    unless $P10, rx1010_fail
+    rx1010_pos = $P10."pos"()
+.annotate 'line', 16
+  # rx subrule "pod_ws" subtype=method negate=
+    rx1010_cur."!cursor_pos"(rx1010_pos)
+    $P10 = rx1010_cur."pod_ws"()
+    unless $P10, rx1010_fail
+    rx1010_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1010_cur."!cursor_pos"(rx1010_pos)
+    $P10 = rx1010_cur."ws"()
+    unless $P10, rx1010_fail
+    rx1010_pos = $P10."pos"()
+  alt1014_0:
+.annotate 'line', 17
+    set_addr $I10, alt1014_1
+    rx1010_cur."!mark_push"(0, rx1010_pos, $I10)
+.annotate 'line', 18
+  # rx subrule "ws" subtype=method negate=
+    rx1010_cur."!cursor_pos"(rx1010_pos)
+    $P10 = rx1010_cur."ws"()
+    unless $P10, rx1010_fail
+    rx1010_pos = $P10."pos"()
+  # rx subrule "preamble" subtype=capture negate=
+    rx1010_cur."!cursor_pos"(rx1010_pos)
+    $P10 = rx1010_cur."preamble"()
+    unless $P10, rx1010_fail
+    rx1010_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("preamble")
+    rx1010_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1010_cur."!cursor_pos"(rx1010_pos)
+    $P10 = rx1010_cur."ws"()
+    unless $P10, rx1010_fail
+    rx1010_pos = $P10."pos"()
+    goto alt1014_end
+  alt1014_1:
+.annotate 'line', 19
+  # rx subrule "ws" subtype=method negate=
+    rx1010_cur."!cursor_pos"(rx1010_pos)
+    $P10 = rx1010_cur."ws"()
+    unless $P10, rx1010_fail
+    rx1010_pos = $P10."pos"()
+  # rx subrule "op" subtype=capture negate=
+    rx1010_cur."!cursor_pos"(rx1010_pos)
+    $P10 = rx1010_cur."op"()
+    unless $P10, rx1010_fail
+    rx1010_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("op")
+    rx1010_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1010_cur."!cursor_pos"(rx1010_pos)
+    $P10 = rx1010_cur."ws"()
+    unless $P10, rx1010_fail
+    rx1010_pos = $P10."pos"()
+  alt1014_end:
+.annotate 'line', 20
+  # rx subrule "ws" subtype=method negate=
+    rx1010_cur."!cursor_pos"(rx1010_pos)
+    $P10 = rx1010_cur."ws"()
+    unless $P10, rx1010_fail
+    rx1010_pos = $P10."pos"()
+.annotate 'line', 21
+    set_addr $I10, rxquantr1013_done
+    (rx1010_rep) = rx1010_cur."!mark_commit"($I10)
+    set_addr $I10, rxquantr1013_done
+    rx1010_cur."!mark_push"(rx1010_rep, rx1010_pos, $I10)
+    goto rxquantr1013_loop
+  rxquantr1013_done:
+  # rx subrule "ws" subtype=method negate=
+    rx1010_cur."!cursor_pos"(rx1010_pos)
+    $P10 = rx1010_cur."ws"()
+    unless $P10, rx1010_fail
+    rx1010_pos = $P10."pos"()
+.annotate 'line', 14
+  # rx pass
+    rx1010_cur."!cursor_pass"(rx1010_pos, "body")
+    if_null rx1010_debug, debug_249
+    rx1010_cur."!cursor_debug"("PASS", "body", " at pos=", rx1010_pos)
+  debug_249:
+    .return (rx1010_cur)
+  rx1010_restart:
+.annotate 'line', 8
+    if_null rx1010_debug, debug_250
+    rx1010_cur."!cursor_debug"("NEXT", "body")
+  debug_250:
+  rx1010_fail:
+    (rx1010_rep, rx1010_pos, $I10, $P10) = rx1010_cur."!mark_fail"(0)
+    lt rx1010_pos, -1, rx1010_done
+    eq rx1010_pos, -1, rx1010_fail
+    jump $I10
+  rx1010_done:
+    rx1010_cur."!cursor_fail"()
+    if_null rx1010_debug, debug_251
+    rx1010_cur."!cursor_debug"("FAIL", "body")
+  debug_251:
+    .return (rx1010_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__body"  :subid("15_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("ws", "")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "preamble"  :subid("16_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1016_tgt
+    .local int rx1016_pos
+    .local int rx1016_off
+    .local int rx1016_eos
+    .local int rx1016_rep
+    .local pmc rx1016_cur
+    .local pmc rx1016_debug
+    (rx1016_cur, rx1016_pos, rx1016_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1016_debug, rx1016_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1016_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1016_eos, rx1016_tgt
+    gt rx1016_pos, rx1016_eos, rx1016_done
+    set rx1016_off, 0
+    lt rx1016_pos, 2, rx1016_start
+    sub rx1016_off, rx1016_pos, 1
+    substr rx1016_tgt, rx1016_tgt, rx1016_off
+  rx1016_start:
+    eq $I10, 1, rx1016_restart
+    if_null rx1016_debug, debug_252
+    rx1016_cur."!cursor_debug"("START", "preamble")
+  debug_252:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1018_done
+    goto rxscan1018_scan
+  rxscan1018_loop:
+    ($P10) = rx1016_cur."from"()
+    inc $P10
+    set rx1016_pos, $P10
+    ge rx1016_pos, rx1016_eos, rxscan1018_done
+  rxscan1018_scan:
+    set_addr $I10, rxscan1018_loop
+    rx1016_cur."!mark_push"(0, rx1016_pos, $I10)
+  rxscan1018_done:
+.annotate 'line', 25
+  # rx subrule "begin_preamble" subtype=capture negate=
+    rx1016_cur."!cursor_pos"(rx1016_pos)
+    $P10 = rx1016_cur."begin_preamble"()
+    unless $P10, rx1016_fail
+    rx1016_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("begin_preamble")
+    rx1016_pos = $P10."pos"()
+.annotate 'line', 26
+  # rx subrule "preamble_guts" subtype=capture negate=
+    rx1016_cur."!cursor_pos"(rx1016_pos)
+    $P10 = rx1016_cur."preamble_guts"()
+    unless $P10, rx1016_fail
+    rx1016_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("preamble_guts")
+    rx1016_pos = $P10."pos"()
+.annotate 'line', 27
+  # rx subrule "end_preamble" subtype=capture negate=
+    rx1016_cur."!cursor_pos"(rx1016_pos)
+    $P10 = rx1016_cur."end_preamble"()
+    unless $P10, rx1016_fail
+    rx1016_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("end_preamble")
+    rx1016_pos = $P10."pos"()
+.annotate 'line', 24
+  # rx pass
+    rx1016_cur."!cursor_pass"(rx1016_pos, "preamble")
+    if_null rx1016_debug, debug_253
+    rx1016_cur."!cursor_debug"("PASS", "preamble", " at pos=", rx1016_pos)
+  debug_253:
+    .return (rx1016_cur)
+  rx1016_restart:
+.annotate 'line', 8
+    if_null rx1016_debug, debug_254
+    rx1016_cur."!cursor_debug"("NEXT", "preamble")
+  debug_254:
+  rx1016_fail:
+    (rx1016_rep, rx1016_pos, $I10, $P10) = rx1016_cur."!mark_fail"(0)
+    lt rx1016_pos, -1, rx1016_done
+    eq rx1016_pos, -1, rx1016_fail
+    jump $I10
+  rx1016_done:
+    rx1016_cur."!cursor_fail"()
+    if_null rx1016_debug, debug_255
+    rx1016_cur."!cursor_debug"("FAIL", "preamble")
+  debug_255:
+    .return (rx1016_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__preamble"  :subid("17_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("begin_preamble", "")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "preamble_guts"  :subid("18_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1020_tgt
+    .local int rx1020_pos
+    .local int rx1020_off
+    .local int rx1020_eos
+    .local int rx1020_rep
+    .local pmc rx1020_cur
+    .local pmc rx1020_debug
+    (rx1020_cur, rx1020_pos, rx1020_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1020_debug, rx1020_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1020_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1020_eos, rx1020_tgt
+    gt rx1020_pos, rx1020_eos, rx1020_done
+    set rx1020_off, 0
+    lt rx1020_pos, 2, rx1020_start
+    sub rx1020_off, rx1020_pos, 1
+    substr rx1020_tgt, rx1020_tgt, rx1020_off
+  rx1020_start:
+    eq $I10, 1, rx1020_restart
+    if_null rx1020_debug, debug_256
+    rx1020_cur."!cursor_debug"("START", "preamble_guts")
+  debug_256:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1022_done
+    goto rxscan1022_scan
+  rxscan1022_loop:
+    ($P10) = rx1020_cur."from"()
+    inc $P10
+    set rx1020_pos, $P10
+    ge rx1020_pos, rx1020_eos, rxscan1022_done
+  rxscan1022_scan:
+    set_addr $I10, rxscan1022_loop
+    rx1020_cur."!mark_push"(0, rx1020_pos, $I10)
+  rxscan1022_done:
+.annotate 'line', 31
+  # rx rxquantf1023 ** 0..*
+    set_addr $I10, rxquantf1023_loop
+    rx1020_cur."!mark_push"(0, rx1020_pos, $I10)
+    goto rxquantf1023_done
+  rxquantf1023_loop:
+  # rx charclass .
+    ge rx1020_pos, rx1020_eos, rx1020_fail
+    inc rx1020_pos
+    set_addr $I10, rxquantf1023_loop
+    rx1020_cur."!mark_push"(rx1020_rep, rx1020_pos, $I10)
+  rxquantf1023_done:
+  # rx subrule "end_preamble" subtype=zerowidth negate=
+    rx1020_cur."!cursor_pos"(rx1020_pos)
+    $P10 = rx1020_cur."end_preamble"()
+    unless $P10, rx1020_fail
+.annotate 'line', 30
+  # rx pass
+    rx1020_cur."!cursor_pass"(rx1020_pos, "preamble_guts")
+    if_null rx1020_debug, debug_257
+    rx1020_cur."!cursor_debug"("PASS", "preamble_guts", " at pos=", rx1020_pos)
+  debug_257:
+    rx1020_cur."!cursor_backtrack"()
+    .return (rx1020_cur)
+  rx1020_restart:
+.annotate 'line', 8
+    if_null rx1020_debug, debug_258
+    rx1020_cur."!cursor_debug"("NEXT", "preamble_guts")
+  debug_258:
+  rx1020_fail:
+    (rx1020_rep, rx1020_pos, $I10, $P10) = rx1020_cur."!mark_fail"(0)
+    lt rx1020_pos, -1, rx1020_done
+    eq rx1020_pos, -1, rx1020_fail
+    jump $I10
+  rx1020_done:
+    rx1020_cur."!cursor_fail"()
+    if_null rx1020_debug, debug_259
+    rx1020_cur."!cursor_debug"("FAIL", "preamble_guts")
+  debug_259:
+    .return (rx1020_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__preamble_guts"  :subid("19_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    new $P100, "ResizablePMCArray"
+    push $P100, ""
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "begin_preamble"  :subid("20_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1026_tgt
+    .local int rx1026_pos
+    .local int rx1026_off
+    .local int rx1026_eos
+    .local int rx1026_rep
+    .local pmc rx1026_cur
+    .local pmc rx1026_debug
+    (rx1026_cur, rx1026_pos, rx1026_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1026_debug, rx1026_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1026_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1026_eos, rx1026_tgt
+    gt rx1026_pos, rx1026_eos, rx1026_done
+    set rx1026_off, 0
+    lt rx1026_pos, 2, rx1026_start
+    sub rx1026_off, rx1026_pos, 1
+    substr rx1026_tgt, rx1026_tgt, rx1026_off
+  rx1026_start:
+    eq $I10, 1, rx1026_restart
+    if_null rx1026_debug, debug_260
+    rx1026_cur."!cursor_debug"("START", "begin_preamble")
+  debug_260:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1028_done
+    goto rxscan1028_scan
+  rxscan1028_loop:
+    ($P10) = rx1026_cur."from"()
+    inc $P10
+    set rx1026_pos, $P10
+    ge rx1026_pos, rx1026_eos, rxscan1028_done
+  rxscan1028_scan:
+    set_addr $I10, rxscan1028_loop
+    rx1026_cur."!mark_push"(0, rx1026_pos, $I10)
+  rxscan1028_done:
+.annotate 'line', 35
+  # rxanchor bol
+    eq rx1026_pos, 0, rxanchor1029_done
+    ge rx1026_pos, rx1026_eos, rx1026_fail
+    sub $I10, rx1026_pos, rx1026_off
+    dec $I10
+    is_cclass $I11, 4096, rx1026_tgt, $I10
+    unless $I11, rx1026_fail
+  rxanchor1029_done:
+  # rx literal  "BEGIN_OPS_PREAMBLE"
+    add $I11, rx1026_pos, 18
+    gt $I11, rx1026_eos, rx1026_fail
+    sub $I11, rx1026_pos, rx1026_off
+    substr $S10, rx1026_tgt, $I11, 18
+    ne $S10, "BEGIN_OPS_PREAMBLE", rx1026_fail
+    add rx1026_pos, 18
+.annotate 'line', 34
+  # rx pass
+    rx1026_cur."!cursor_pass"(rx1026_pos, "begin_preamble")
+    if_null rx1026_debug, debug_261
+    rx1026_cur."!cursor_debug"("PASS", "begin_preamble", " at pos=", rx1026_pos)
+  debug_261:
+    .return (rx1026_cur)
+  rx1026_restart:
+.annotate 'line', 8
+    if_null rx1026_debug, debug_262
+    rx1026_cur."!cursor_debug"("NEXT", "begin_preamble")
+  debug_262:
+  rx1026_fail:
+    (rx1026_rep, rx1026_pos, $I10, $P10) = rx1026_cur."!mark_fail"(0)
+    lt rx1026_pos, -1, rx1026_done
+    eq rx1026_pos, -1, rx1026_fail
+    jump $I10
+  rx1026_done:
+    rx1026_cur."!cursor_fail"()
+    if_null rx1026_debug, debug_263
+    rx1026_cur."!cursor_debug"("FAIL", "begin_preamble")
+  debug_263:
+    .return (rx1026_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__begin_preamble"  :subid("21_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    new $P100, "ResizablePMCArray"
+    push $P100, "BEGIN_OPS_PREAMBLE"
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "end_preamble"  :subid("22_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1031_tgt
+    .local int rx1031_pos
+    .local int rx1031_off
+    .local int rx1031_eos
+    .local int rx1031_rep
+    .local pmc rx1031_cur
+    .local pmc rx1031_debug
+    (rx1031_cur, rx1031_pos, rx1031_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1031_debug, rx1031_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1031_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1031_eos, rx1031_tgt
+    gt rx1031_pos, rx1031_eos, rx1031_done
+    set rx1031_off, 0
+    lt rx1031_pos, 2, rx1031_start
+    sub rx1031_off, rx1031_pos, 1
+    substr rx1031_tgt, rx1031_tgt, rx1031_off
+  rx1031_start:
+    eq $I10, 1, rx1031_restart
+    if_null rx1031_debug, debug_264
+    rx1031_cur."!cursor_debug"("START", "end_preamble")
+  debug_264:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1033_done
+    goto rxscan1033_scan
+  rxscan1033_loop:
+    ($P10) = rx1031_cur."from"()
+    inc $P10
+    set rx1031_pos, $P10
+    ge rx1031_pos, rx1031_eos, rxscan1033_done
+  rxscan1033_scan:
+    set_addr $I10, rxscan1033_loop
+    rx1031_cur."!mark_push"(0, rx1031_pos, $I10)
+  rxscan1033_done:
+.annotate 'line', 39
+  # rxanchor bol
+    eq rx1031_pos, 0, rxanchor1034_done
+    ge rx1031_pos, rx1031_eos, rx1031_fail
+    sub $I10, rx1031_pos, rx1031_off
+    dec $I10
+    is_cclass $I11, 4096, rx1031_tgt, $I10
+    unless $I11, rx1031_fail
+  rxanchor1034_done:
+  # rx literal  "END_OPS_PREAMBLE"
+    add $I11, rx1031_pos, 16
+    gt $I11, rx1031_eos, rx1031_fail
+    sub $I11, rx1031_pos, rx1031_off
+    substr $S10, rx1031_tgt, $I11, 16
+    ne $S10, "END_OPS_PREAMBLE", rx1031_fail
+    add rx1031_pos, 16
+.annotate 'line', 38
+  # rx pass
+    rx1031_cur."!cursor_pass"(rx1031_pos, "end_preamble")
+    if_null rx1031_debug, debug_265
+    rx1031_cur."!cursor_debug"("PASS", "end_preamble", " at pos=", rx1031_pos)
+  debug_265:
+    .return (rx1031_cur)
+  rx1031_restart:
+.annotate 'line', 8
+    if_null rx1031_debug, debug_266
+    rx1031_cur."!cursor_debug"("NEXT", "end_preamble")
+  debug_266:
+  rx1031_fail:
+    (rx1031_rep, rx1031_pos, $I10, $P10) = rx1031_cur."!mark_fail"(0)
+    lt rx1031_pos, -1, rx1031_done
+    eq rx1031_pos, -1, rx1031_fail
+    jump $I10
+  rx1031_done:
+    rx1031_cur."!cursor_fail"()
+    if_null rx1031_debug, debug_267
+    rx1031_cur."!cursor_debug"("FAIL", "end_preamble")
+  debug_267:
+    .return (rx1031_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__end_preamble"  :subid("23_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    new $P100, "ResizablePMCArray"
+    push $P100, "END_OPS_PREAMBLE"
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "op"  :subid("24_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1036_tgt
+    .local int rx1036_pos
+    .local int rx1036_off
+    .local int rx1036_eos
+    .local int rx1036_rep
+    .local pmc rx1036_cur
+    .local pmc rx1036_debug
+    (rx1036_cur, rx1036_pos, rx1036_tgt, $I10) = self."!cursor_start"()
+    rx1036_cur."!cursor_caparray"("op_type", "op_flag")
+    getattribute rx1036_debug, rx1036_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1036_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1036_eos, rx1036_tgt
+    gt rx1036_pos, rx1036_eos, rx1036_done
+    set rx1036_off, 0
+    lt rx1036_pos, 2, rx1036_start
+    sub rx1036_off, rx1036_pos, 1
+    substr rx1036_tgt, rx1036_tgt, rx1036_off
+  rx1036_start:
+    eq $I10, 1, rx1036_restart
+    if_null rx1036_debug, debug_268
+    rx1036_cur."!cursor_debug"("START", "op")
+  debug_268:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1038_done
+    goto rxscan1038_scan
+  rxscan1038_loop:
+    ($P10) = rx1036_cur."from"()
+    inc $P10
+    set rx1036_pos, $P10
+    ge rx1036_pos, rx1036_eos, rxscan1038_done
+  rxscan1038_scan:
+    set_addr $I10, rxscan1038_loop
+    rx1036_cur."!mark_push"(0, rx1036_pos, $I10)
+  rxscan1038_done:
+.annotate 'line', 42
+  # rx subrule "ws" subtype=method negate=
+    rx1036_cur."!cursor_pos"(rx1036_pos)
+    $P10 = rx1036_cur."ws"()
+    unless $P10, rx1036_fail
+    rx1036_pos = $P10."pos"()
+.annotate 'line', 43
+  # rx rxquantr1039 ** 0..1
+    set_addr $I10, rxquantr1039_done
+    rx1036_cur."!mark_push"(0, rx1036_pos, $I10)
+  rxquantr1039_loop:
+  # rx subrule "op_type" subtype=capture negate=
+    rx1036_cur."!cursor_pos"(rx1036_pos)
+    $P10 = rx1036_cur."op_type"()
+    unless $P10, rx1036_fail
+    goto rxsubrule1040_pass
+  rxsubrule1040_back:
+    $P10 = $P10."!cursor_next"()
+    unless $P10, rx1036_fail
+  rxsubrule1040_pass:
+    set_addr $I10, rxsubrule1040_back
+    rx1036_cur."!mark_push"(0, rx1036_pos, $I10, $P10)
+    $P10."!cursor_names"("op_type")
+    rx1036_pos = $P10."pos"()
+    set_addr $I10, rxquantr1039_done
+    (rx1036_rep) = rx1036_cur."!mark_commit"($I10)
+  rxquantr1039_done:
+  # rx subrule "ws" subtype=method negate=
+    rx1036_cur."!cursor_pos"(rx1036_pos)
+    $P10 = rx1036_cur."ws"()
+    unless $P10, rx1036_fail
+    rx1036_pos = $P10."pos"()
+  # rx literal  "op"
+    add $I11, rx1036_pos, 2
+    gt $I11, rx1036_eos, rx1036_fail
+    sub $I11, rx1036_pos, rx1036_off
+    substr $S10, rx1036_tgt, $I11, 2
+    ne $S10, "op", rx1036_fail
+    add rx1036_pos, 2
+  # rx subrule "ws" subtype=method negate=
+    rx1036_cur."!cursor_pos"(rx1036_pos)
+    $P10 = rx1036_cur."ws"()
+    unless $P10, rx1036_fail
+    rx1036_pos = $P10."pos"()
+  # rx subrule "ident" subtype=capture negate=
+    rx1036_cur."!cursor_pos"(rx1036_pos)
+    $P10 = rx1036_cur."ident"()
+    unless $P10, rx1036_fail
+    rx1036_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("op_name=ident")
+    rx1036_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1036_cur."!cursor_pos"(rx1036_pos)
+    $P10 = rx1036_cur."ws"()
+    unless $P10, rx1036_fail
+    rx1036_pos = $P10."pos"()
+  alt1041_0:
+.annotate 'line', 44
+    set_addr $I10, alt1041_1
+    rx1036_cur."!mark_push"(0, rx1036_pos, $I10)
+  # rx subrule "ws" subtype=method negate=
+    rx1036_cur."!cursor_pos"(rx1036_pos)
+    $P10 = rx1036_cur."ws"()
+    unless $P10, rx1036_fail
+    rx1036_pos = $P10."pos"()
+  # rx literal  "("
+    add $I11, rx1036_pos, 1
+    gt $I11, rx1036_eos, rx1036_fail
+    sub $I11, rx1036_pos, rx1036_off
+    ord $I11, rx1036_tgt, $I11
+    ne $I11, 40, rx1036_fail
+    add rx1036_pos, 1
+  # rx subrule "ws" subtype=method negate=
+    rx1036_cur."!cursor_pos"(rx1036_pos)
+    $P10 = rx1036_cur."ws"()
+    unless $P10, rx1036_fail
+    rx1036_pos = $P10."pos"()
+  # rx subrule "signature" subtype=capture negate=
+    rx1036_cur."!cursor_pos"(rx1036_pos)
+    $P10 = rx1036_cur."signature"()
+    unless $P10, rx1036_fail
+    rx1036_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("signature")
+    rx1036_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1036_cur."!cursor_pos"(rx1036_pos)
+    $P10 = rx1036_cur."ws"()
+    unless $P10, rx1036_fail
+    rx1036_pos = $P10."pos"()
+  # rx literal  ")"
+    add $I11, rx1036_pos, 1
+    gt $I11, rx1036_eos, rx1036_fail
+    sub $I11, rx1036_pos, rx1036_off
+    ord $I11, rx1036_tgt, $I11
+    ne $I11, 41, rx1036_fail
+    add rx1036_pos, 1
+  # rx subrule "ws" subtype=method negate=
+    rx1036_cur."!cursor_pos"(rx1036_pos)
+    $P10 = rx1036_cur."ws"()
+    unless $P10, rx1036_fail
+    rx1036_pos = $P10."pos"()
+    goto alt1041_end
+  alt1041_1:
+  # rx subrule "ws" subtype=method negate=
+    rx1036_cur."!cursor_pos"(rx1036_pos)
+    $P10 = rx1036_cur."ws"()
+    unless $P10, rx1036_fail
+    rx1036_pos = $P10."pos"()
+  # rx subrule "panic" subtype=method negate=
+    rx1036_cur."!cursor_pos"(rx1036_pos)
+    $P10 = rx1036_cur."panic"("Fail to parse signature")
+    unless $P10, rx1036_fail
+    rx1036_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1036_cur."!cursor_pos"(rx1036_pos)
+    $P10 = rx1036_cur."ws"()
+    unless $P10, rx1036_fail
+    rx1036_pos = $P10."pos"()
+  alt1041_end:
+  # rx subrule "ws" subtype=method negate=
+    rx1036_cur."!cursor_pos"(rx1036_pos)
+    $P10 = rx1036_cur."ws"()
+    unless $P10, rx1036_fail
+    rx1036_pos = $P10."pos"()
+.annotate 'line', 45
+  # rx rxquantr1042 ** 0..*
+    set_addr $I10, rxquantr1042_done
+    rx1036_cur."!mark_push"(0, rx1036_pos, $I10)
+  rxquantr1042_loop:
+  # rx subrule "op_flag" subtype=capture negate=
+    rx1036_cur."!cursor_pos"(rx1036_pos)
+    $P10 = rx1036_cur."op_flag"()
+    unless $P10, rx1036_fail
+    goto rxsubrule1043_pass
+  rxsubrule1043_back:
+    $P10 = $P10."!cursor_next"()
+    unless $P10, rx1036_fail
+  rxsubrule1043_pass:
+    set_addr $I10, rxsubrule1043_back
+    rx1036_cur."!mark_push"(0, rx1036_pos, $I10, $P10)
+    $P10."!cursor_names"("op_flag")
+    rx1036_pos = $P10."pos"()
+    set_addr $I10, rxquantr1042_done
+    (rx1036_rep) = rx1036_cur."!mark_commit"($I10)
+    set_addr $I10, rxquantr1042_done
+    rx1036_cur."!mark_push"(rx1036_rep, rx1036_pos, $I10)
+    goto rxquantr1042_loop
+  rxquantr1042_done:
+  # rx subrule "ws" subtype=method negate=
+    rx1036_cur."!cursor_pos"(rx1036_pos)
+    $P10 = rx1036_cur."ws"()
+    unless $P10, rx1036_fail
+    rx1036_pos = $P10."pos"()
+.annotate 'line', 46
+  # rx reduce name="op" key="start"
+    rx1036_cur."!cursor_pos"(rx1036_pos)
+    rx1036_cur."!reduce"("op", "start")
+  # rx subrule "ws" subtype=method negate=
+    rx1036_cur."!cursor_pos"(rx1036_pos)
+    $P10 = rx1036_cur."ws"()
+    unless $P10, rx1036_fail
+    rx1036_pos = $P10."pos"()
+  alt1044_0:
+.annotate 'line', 47
+    set_addr $I10, alt1044_1
+    rx1036_cur."!mark_push"(0, rx1036_pos, $I10)
+  # rx subrule "ws" subtype=method negate=
+    rx1036_cur."!cursor_pos"(rx1036_pos)
+    $P10 = rx1036_cur."ws"()
+    unless $P10, rx1036_fail
+    rx1036_pos = $P10."pos"()
+  # rx subrule "op_body" subtype=capture negate=
+    rx1036_cur."!cursor_pos"(rx1036_pos)
+    $P10 = rx1036_cur."op_body"()
+    unless $P10, rx1036_fail
+    rx1036_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("op_body")
+    rx1036_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1036_cur."!cursor_pos"(rx1036_pos)
+    $P10 = rx1036_cur."ws"()
+    unless $P10, rx1036_fail
+    rx1036_pos = $P10."pos"()
+    goto alt1044_end
+  alt1044_1:
+  # rx subrule "ws" subtype=method negate=
+    rx1036_cur."!cursor_pos"(rx1036_pos)
+    $P10 = rx1036_cur."ws"()
+    unless $P10, rx1036_fail
+    rx1036_pos = $P10."pos"()
+  # rx subrule "panic" subtype=method negate=
+    rx1036_cur."!cursor_pos"(rx1036_pos)
+    $P10 = rx1036_cur."panic"("Fail to parse op body")
+    unless $P10, rx1036_fail
+    rx1036_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1036_cur."!cursor_pos"(rx1036_pos)
+    $P10 = rx1036_cur."ws"()
+    unless $P10, rx1036_fail
+    rx1036_pos = $P10."pos"()
+  alt1044_end:
+  # rx subrule "ws" subtype=method negate=
+    rx1036_cur."!cursor_pos"(rx1036_pos)
+    $P10 = rx1036_cur."ws"()
+    unless $P10, rx1036_fail
+    rx1036_pos = $P10."pos"()
+.annotate 'line', 42
+  # rx pass
+    rx1036_cur."!cursor_pass"(rx1036_pos, "op")
+    if_null rx1036_debug, debug_269
+    rx1036_cur."!cursor_debug"("PASS", "op", " at pos=", rx1036_pos)
+  debug_269:
+    .return (rx1036_cur)
+  rx1036_restart:
+.annotate 'line', 8
+    if_null rx1036_debug, debug_270
+    rx1036_cur."!cursor_debug"("NEXT", "op")
+  debug_270:
+  rx1036_fail:
+    (rx1036_rep, rx1036_pos, $I10, $P10) = rx1036_cur."!mark_fail"(0)
+    lt rx1036_pos, -1, rx1036_done
+    eq rx1036_pos, -1, rx1036_fail
+    jump $I10
+  rx1036_done:
+    rx1036_cur."!cursor_fail"()
+    if_null rx1036_debug, debug_271
+    rx1036_cur."!cursor_debug"("FAIL", "op")
+  debug_271:
+    .return (rx1036_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__op"  :subid("25_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("ws", "")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "op_type"  :subid("26_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1046_tgt
+    .local int rx1046_pos
+    .local int rx1046_off
+    .local int rx1046_eos
+    .local int rx1046_rep
+    .local pmc rx1046_cur
+    .local pmc rx1046_debug
+    (rx1046_cur, rx1046_pos, rx1046_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1046_debug, rx1046_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1046_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1046_eos, rx1046_tgt
+    gt rx1046_pos, rx1046_eos, rx1046_done
+    set rx1046_off, 0
+    lt rx1046_pos, 2, rx1046_start
+    sub rx1046_off, rx1046_pos, 1
+    substr rx1046_tgt, rx1046_tgt, rx1046_off
+  rx1046_start:
+    eq $I10, 1, rx1046_restart
+    if_null rx1046_debug, debug_272
+    rx1046_cur."!cursor_debug"("START", "op_type")
+  debug_272:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1048_done
+    goto rxscan1048_scan
+  rxscan1048_loop:
+    ($P10) = rx1046_cur."from"()
+    inc $P10
+    set rx1046_pos, $P10
+    ge rx1046_pos, rx1046_eos, rxscan1048_done
+  rxscan1048_scan:
+    set_addr $I10, rxscan1048_loop
+    rx1046_cur."!mark_push"(0, rx1046_pos, $I10)
+  rxscan1048_done:
+  alt1049_0:
+.annotate 'line', 51
+    set_addr $I10, alt1049_1
+    rx1046_cur."!mark_push"(0, rx1046_pos, $I10)
+  # rx literal  "inline"
+    add $I11, rx1046_pos, 6
+    gt $I11, rx1046_eos, rx1046_fail
+    sub $I11, rx1046_pos, rx1046_off
+    substr $S10, rx1046_tgt, $I11, 6
+    ne $S10, "inline", rx1046_fail
+    add rx1046_pos, 6
+    goto alt1049_end
+  alt1049_1:
+  # rx literal  "function"
+    add $I11, rx1046_pos, 8
+    gt $I11, rx1046_eos, rx1046_fail
+    sub $I11, rx1046_pos, rx1046_off
+    substr $S10, rx1046_tgt, $I11, 8
+    ne $S10, "function", rx1046_fail
+    add rx1046_pos, 8
+  alt1049_end:
+.annotate 'line', 50
+  # rx pass
+    rx1046_cur."!cursor_pass"(rx1046_pos, "op_type")
+    if_null rx1046_debug, debug_273
+    rx1046_cur."!cursor_debug"("PASS", "op_type", " at pos=", rx1046_pos)
+  debug_273:
+    .return (rx1046_cur)
+  rx1046_restart:
+.annotate 'line', 8
+    if_null rx1046_debug, debug_274
+    rx1046_cur."!cursor_debug"("NEXT", "op_type")
+  debug_274:
+  rx1046_fail:
+    (rx1046_rep, rx1046_pos, $I10, $P10) = rx1046_cur."!mark_fail"(0)
+    lt rx1046_pos, -1, rx1046_done
+    eq rx1046_pos, -1, rx1046_fail
+    jump $I10
+  rx1046_done:
+    rx1046_cur."!cursor_fail"()
+    if_null rx1046_debug, debug_275
+    rx1046_cur."!cursor_debug"("FAIL", "op_type")
+  debug_275:
+    .return (rx1046_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__op_type"  :subid("27_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    new $P100, "ResizablePMCArray"
+    push $P100, "function"
+    push $P100, "inline"
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "signature"  :subid("28_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1051_tgt
+    .local int rx1051_pos
+    .local int rx1051_off
+    .local int rx1051_eos
+    .local int rx1051_rep
+    .local pmc rx1051_cur
+    .local pmc rx1051_debug
+    (rx1051_cur, rx1051_pos, rx1051_tgt, $I10) = self."!cursor_start"()
+    rx1051_cur."!cursor_caparray"("op_param")
+    getattribute rx1051_debug, rx1051_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1051_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1051_eos, rx1051_tgt
+    gt rx1051_pos, rx1051_eos, rx1051_done
+    set rx1051_off, 0
+    lt rx1051_pos, 2, rx1051_start
+    sub rx1051_off, rx1051_pos, 1
+    substr rx1051_tgt, rx1051_tgt, rx1051_off
+  rx1051_start:
+    eq $I10, 1, rx1051_restart
+    if_null rx1051_debug, debug_276
+    rx1051_cur."!cursor_debug"("START", "signature")
+  debug_276:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1053_done
+    goto rxscan1053_scan
+  rxscan1053_loop:
+    ($P10) = rx1051_cur."from"()
+    inc $P10
+    set rx1051_pos, $P10
+    ge rx1051_pos, rx1051_eos, rxscan1053_done
+  rxscan1053_scan:
+    set_addr $I10, rxscan1053_loop
+    rx1051_cur."!mark_push"(0, rx1051_pos, $I10)
+  rxscan1053_done:
+.annotate 'line', 54
+  # rx subrule "ws" subtype=method negate=
+    rx1051_cur."!cursor_pos"(rx1051_pos)
+    $P10 = rx1051_cur."ws"()
+    unless $P10, rx1051_fail
+    rx1051_pos = $P10."pos"()
+  # rx rxquantr1054 ** 0..1
+    set_addr $I10, rxquantr1054_done
+    rx1051_cur."!mark_push"(0, rx1051_pos, $I10)
+  rxquantr1054_loop:
+  # rx subrule "ws" subtype=method negate=
+    rx1051_cur."!cursor_pos"(rx1051_pos)
+    $P10 = rx1051_cur."ws"()
+    unless $P10, rx1051_fail
+    rx1051_pos = $P10."pos"()
+  # rx rxquantr1055 ** 1..*
+    set_addr $I10, rxquantr1055_done
+    rx1051_cur."!mark_push"(0, -1, $I10)
+  rxquantr1055_loop:
+  # rx subrule "ws" subtype=method negate=
+    rx1051_cur."!cursor_pos"(rx1051_pos)
+    $P10 = rx1051_cur."ws"()
+    unless $P10, rx1051_fail
+    rx1051_pos = $P10."pos"()
+  # rx subrule "op_param" subtype=capture negate=
+    rx1051_cur."!cursor_pos"(rx1051_pos)
+    $P10 = rx1051_cur."op_param"()
+    unless $P10, rx1051_fail
+    rx1051_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("op_param")
+    rx1051_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1051_cur."!cursor_pos"(rx1051_pos)
+    $P10 = rx1051_cur."ws"()
+    unless $P10, rx1051_fail
+    rx1051_pos = $P10."pos"()
+    set_addr $I10, rxquantr1055_done
+    (rx1051_rep) = rx1051_cur."!mark_commit"($I10)
+    set_addr $I10, rxquantr1055_done
+    rx1051_cur."!mark_push"(rx1051_rep, rx1051_pos, $I10)
+  # rx subrule "ws" subtype=method negate=
+    rx1051_cur."!cursor_pos"(rx1051_pos)
+    $P10 = rx1051_cur."ws"()
+    unless $P10, rx1051_fail
+    goto rxsubrule1056_pass
+  rxsubrule1056_back:
+    $P10 = $P10."!cursor_next"()
+    unless $P10, rx1051_fail
+  rxsubrule1056_pass:
+    set_addr $I10, rxsubrule1056_back
+    rx1051_cur."!mark_push"(0, rx1051_pos, $I10, $P10)
+    rx1051_pos = $P10."pos"()
+  # rx literal  ","
+    add $I11, rx1051_pos, 1
+    gt $I11, rx1051_eos, rx1051_fail
+    sub $I11, rx1051_pos, rx1051_off
+    ord $I11, rx1051_tgt, $I11
+    ne $I11, 44, rx1051_fail
+    add rx1051_pos, 1
+  # rx subrule "ws" subtype=method negate=
+    rx1051_cur."!cursor_pos"(rx1051_pos)
+    $P10 = rx1051_cur."ws"()
+    unless $P10, rx1051_fail
+    goto rxsubrule1057_pass
+  rxsubrule1057_back:
+    $P10 = $P10."!cursor_next"()
+    unless $P10, rx1051_fail
+  rxsubrule1057_pass:
+    set_addr $I10, rxsubrule1057_back
+    rx1051_cur."!mark_push"(0, rx1051_pos, $I10, $P10)
+    rx1051_pos = $P10."pos"()
+    goto rxquantr1055_loop
+  rxquantr1055_done:
+  # rx subrule "ws" subtype=method negate=
+    rx1051_cur."!cursor_pos"(rx1051_pos)
+    $P10 = rx1051_cur."ws"()
+    unless $P10, rx1051_fail
+    rx1051_pos = $P10."pos"()
+    set_addr $I10, rxquantr1054_done
+    (rx1051_rep) = rx1051_cur."!mark_commit"($I10)
+  rxquantr1054_done:
+  # rx subrule "ws" subtype=method negate=
+    rx1051_cur."!cursor_pos"(rx1051_pos)
+    $P10 = rx1051_cur."ws"()
+    unless $P10, rx1051_fail
+    rx1051_pos = $P10."pos"()
+  # rx pass
+    rx1051_cur."!cursor_pass"(rx1051_pos, "signature")
+    if_null rx1051_debug, debug_277
+    rx1051_cur."!cursor_debug"("PASS", "signature", " at pos=", rx1051_pos)
+  debug_277:
+    .return (rx1051_cur)
+  rx1051_restart:
+.annotate 'line', 8
+    if_null rx1051_debug, debug_278
+    rx1051_cur."!cursor_debug"("NEXT", "signature")
+  debug_278:
+  rx1051_fail:
+    (rx1051_rep, rx1051_pos, $I10, $P10) = rx1051_cur."!mark_fail"(0)
+    lt rx1051_pos, -1, rx1051_done
+    eq rx1051_pos, -1, rx1051_fail
+    jump $I10
+  rx1051_done:
+    rx1051_cur."!cursor_fail"()
+    if_null rx1051_debug, debug_279
+    rx1051_cur."!cursor_debug"("FAIL", "signature")
+  debug_279:
+    .return (rx1051_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__signature"  :subid("29_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("ws", "")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "op_param"  :subid("30_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1059_tgt
+    .local int rx1059_pos
+    .local int rx1059_off
+    .local int rx1059_eos
+    .local int rx1059_rep
+    .local pmc rx1059_cur
+    .local pmc rx1059_debug
+    (rx1059_cur, rx1059_pos, rx1059_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1059_debug, rx1059_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1059_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1059_eos, rx1059_tgt
+    gt rx1059_pos, rx1059_eos, rx1059_done
+    set rx1059_off, 0
+    lt rx1059_pos, 2, rx1059_start
+    sub rx1059_off, rx1059_pos, 1
+    substr rx1059_tgt, rx1059_tgt, rx1059_off
+  rx1059_start:
+    eq $I10, 1, rx1059_restart
+    if_null rx1059_debug, debug_280
+    rx1059_cur."!cursor_debug"("START", "op_param")
+  debug_280:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1061_done
+    goto rxscan1061_scan
+  rxscan1061_loop:
+    ($P10) = rx1059_cur."from"()
+    inc $P10
+    set rx1059_pos, $P10
+    ge rx1059_pos, rx1059_eos, rxscan1061_done
+  rxscan1061_scan:
+    set_addr $I10, rxscan1061_loop
+    rx1059_cur."!mark_push"(0, rx1059_pos, $I10)
+  rxscan1061_done:
+.annotate 'line', 56
+  # rx subrule "ws" subtype=method negate=
+    rx1059_cur."!cursor_pos"(rx1059_pos)
+    $P10 = rx1059_cur."ws"()
+    unless $P10, rx1059_fail
+    rx1059_pos = $P10."pos"()
+.annotate 'line', 57
+  # rx subrule "op_param_direction" subtype=capture negate=
+    rx1059_cur."!cursor_pos"(rx1059_pos)
+    $P10 = rx1059_cur."op_param_direction"()
+    unless $P10, rx1059_fail
+    rx1059_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("op_param_direction")
+    rx1059_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1059_cur."!cursor_pos"(rx1059_pos)
+    $P10 = rx1059_cur."ws"()
+    unless $P10, rx1059_fail
+    rx1059_pos = $P10."pos"()
+  # rx subrule "op_param_type" subtype=capture negate=
+    rx1059_cur."!cursor_pos"(rx1059_pos)
+    $P10 = rx1059_cur."op_param_type"()
+    unless $P10, rx1059_fail
+    rx1059_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("op_param_type")
+    rx1059_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1059_cur."!cursor_pos"(rx1059_pos)
+    $P10 = rx1059_cur."ws"()
+    unless $P10, rx1059_fail
+    rx1059_pos = $P10."pos"()
+.annotate 'line', 56
+  # rx pass
+    rx1059_cur."!cursor_pass"(rx1059_pos, "op_param")
+    if_null rx1059_debug, debug_281
+    rx1059_cur."!cursor_debug"("PASS", "op_param", " at pos=", rx1059_pos)
+  debug_281:
+    .return (rx1059_cur)
+  rx1059_restart:
+.annotate 'line', 8
+    if_null rx1059_debug, debug_282
+    rx1059_cur."!cursor_debug"("NEXT", "op_param")
+  debug_282:
+  rx1059_fail:
+    (rx1059_rep, rx1059_pos, $I10, $P10) = rx1059_cur."!mark_fail"(0)
+    lt rx1059_pos, -1, rx1059_done
+    eq rx1059_pos, -1, rx1059_fail
+    jump $I10
+  rx1059_done:
+    rx1059_cur."!cursor_fail"()
+    if_null rx1059_debug, debug_283
+    rx1059_cur."!cursor_debug"("FAIL", "op_param")
+  debug_283:
+    .return (rx1059_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__op_param"  :subid("31_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("ws", "")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "op_param_direction"  :subid("32_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1063_tgt
+    .local int rx1063_pos
+    .local int rx1063_off
+    .local int rx1063_eos
+    .local int rx1063_rep
+    .local pmc rx1063_cur
+    .local pmc rx1063_debug
+    (rx1063_cur, rx1063_pos, rx1063_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1063_debug, rx1063_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1063_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1063_eos, rx1063_tgt
+    gt rx1063_pos, rx1063_eos, rx1063_done
+    set rx1063_off, 0
+    lt rx1063_pos, 2, rx1063_start
+    sub rx1063_off, rx1063_pos, 1
+    substr rx1063_tgt, rx1063_tgt, rx1063_off
+  rx1063_start:
+    eq $I10, 1, rx1063_restart
+    if_null rx1063_debug, debug_284
+    rx1063_cur."!cursor_debug"("START", "op_param_direction")
+  debug_284:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1065_done
+    goto rxscan1065_scan
+  rxscan1065_loop:
+    ($P10) = rx1063_cur."from"()
+    inc $P10
+    set rx1063_pos, $P10
+    ge rx1063_pos, rx1063_eos, rxscan1065_done
+  rxscan1065_scan:
+    set_addr $I10, rxscan1065_loop
+    rx1063_cur."!mark_push"(0, rx1063_pos, $I10)
+  rxscan1065_done:
+  alt1066_0:
+.annotate 'line', 62
+    set_addr $I10, alt1066_1
+    rx1063_cur."!mark_push"(0, rx1063_pos, $I10)
+.annotate 'line', 63
+  # rx literal  "inout"
+    add $I11, rx1063_pos, 5
+    gt $I11, rx1063_eos, rx1063_fail
+    sub $I11, rx1063_pos, rx1063_off
+    substr $S10, rx1063_tgt, $I11, 5
+    ne $S10, "inout", rx1063_fail
+    add rx1063_pos, 5
+    goto alt1066_end
+  alt1066_1:
+    set_addr $I10, alt1066_2
+    rx1063_cur."!mark_push"(0, rx1063_pos, $I10)
+.annotate 'line', 64
+  # rx literal  "inconst"
+    add $I11, rx1063_pos, 7
+    gt $I11, rx1063_eos, rx1063_fail
+    sub $I11, rx1063_pos, rx1063_off
+    substr $S10, rx1063_tgt, $I11, 7
+    ne $S10, "inconst", rx1063_fail
+    add rx1063_pos, 7
+    goto alt1066_end
+  alt1066_2:
+    set_addr $I10, alt1066_3
+    rx1063_cur."!mark_push"(0, rx1063_pos, $I10)
+.annotate 'line', 65
+  # rx literal  "invar"
+    add $I11, rx1063_pos, 5
+    gt $I11, rx1063_eos, rx1063_fail
+    sub $I11, rx1063_pos, rx1063_off
+    substr $S10, rx1063_tgt, $I11, 5
+    ne $S10, "invar", rx1063_fail
+    add rx1063_pos, 5
+    goto alt1066_end
+  alt1066_3:
+    set_addr $I10, alt1066_4
+    rx1063_cur."!mark_push"(0, rx1063_pos, $I10)
+.annotate 'line', 66
+  # rx literal  "in"
+    add $I11, rx1063_pos, 2
+    gt $I11, rx1063_eos, rx1063_fail
+    sub $I11, rx1063_pos, rx1063_off
+    substr $S10, rx1063_tgt, $I11, 2
+    ne $S10, "in", rx1063_fail
+    add rx1063_pos, 2
+    goto alt1066_end
+  alt1066_4:
+.annotate 'line', 67
+  # rx literal  "out"
+    add $I11, rx1063_pos, 3
+    gt $I11, rx1063_eos, rx1063_fail
+    sub $I11, rx1063_pos, rx1063_off
+    substr $S10, rx1063_tgt, $I11, 3
+    ne $S10, "out", rx1063_fail
+    add rx1063_pos, 3
+  alt1066_end:
+.annotate 'line', 60
+  # rx pass
+    rx1063_cur."!cursor_pass"(rx1063_pos, "op_param_direction")
+    if_null rx1063_debug, debug_285
+    rx1063_cur."!cursor_debug"("PASS", "op_param_direction", " at pos=", rx1063_pos)
+  debug_285:
+    .return (rx1063_cur)
+  rx1063_restart:
+.annotate 'line', 8
+    if_null rx1063_debug, debug_286
+    rx1063_cur."!cursor_debug"("NEXT", "op_param_direction")
+  debug_286:
+  rx1063_fail:
+    (rx1063_rep, rx1063_pos, $I10, $P10) = rx1063_cur."!mark_fail"(0)
+    lt rx1063_pos, -1, rx1063_done
+    eq rx1063_pos, -1, rx1063_fail
+    jump $I10
+  rx1063_done:
+    rx1063_cur."!cursor_fail"()
+    if_null rx1063_debug, debug_287
+    rx1063_cur."!cursor_debug"("FAIL", "op_param_direction")
+  debug_287:
+    .return (rx1063_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__op_param_direction"  :subid("33_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    new $P100, "ResizablePMCArray"
+    push $P100, "out"
+    push $P100, "in"
+    push $P100, "invar"
+    push $P100, "inconst"
+    push $P100, "inout"
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "op_param_type"  :subid("34_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1068_tgt
+    .local int rx1068_pos
+    .local int rx1068_off
+    .local int rx1068_eos
+    .local int rx1068_rep
+    .local pmc rx1068_cur
+    .local pmc rx1068_debug
+    (rx1068_cur, rx1068_pos, rx1068_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1068_debug, rx1068_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1068_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1068_eos, rx1068_tgt
+    gt rx1068_pos, rx1068_eos, rx1068_done
+    set rx1068_off, 0
+    lt rx1068_pos, 2, rx1068_start
+    sub rx1068_off, rx1068_pos, 1
+    substr rx1068_tgt, rx1068_tgt, rx1068_off
+  rx1068_start:
+    eq $I10, 1, rx1068_restart
+    if_null rx1068_debug, debug_288
+    rx1068_cur."!cursor_debug"("START", "op_param_type")
+  debug_288:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1070_done
+    goto rxscan1070_scan
+  rxscan1070_loop:
+    ($P10) = rx1068_cur."from"()
+    inc $P10
+    set rx1068_pos, $P10
+    ge rx1068_pos, rx1068_eos, rxscan1070_done
+  rxscan1070_scan:
+    set_addr $I10, rxscan1070_loop
+    rx1068_cur."!mark_push"(0, rx1068_pos, $I10)
+  rxscan1070_done:
+  alt1071_0:
+.annotate 'line', 73
+    set_addr $I10, alt1071_1
+    rx1068_cur."!mark_push"(0, rx1068_pos, $I10)
+.annotate 'line', 74
+  # rx literal  "INTKEY"
+    add $I11, rx1068_pos, 6
+    gt $I11, rx1068_eos, rx1068_fail
+    sub $I11, rx1068_pos, rx1068_off
+    substr $S10, rx1068_tgt, $I11, 6
+    ne $S10, "INTKEY", rx1068_fail
+    add rx1068_pos, 6
+    goto alt1071_end
+  alt1071_1:
+    set_addr $I10, alt1071_2
+    rx1068_cur."!mark_push"(0, rx1068_pos, $I10)
+.annotate 'line', 75
+  # rx literal  "INT"
+    add $I11, rx1068_pos, 3
+    gt $I11, rx1068_eos, rx1068_fail
+    sub $I11, rx1068_pos, rx1068_off
+    substr $S10, rx1068_tgt, $I11, 3
+    ne $S10, "INT", rx1068_fail
+    add rx1068_pos, 3
+    goto alt1071_end
+  alt1071_2:
+    set_addr $I10, alt1071_3
+    rx1068_cur."!mark_push"(0, rx1068_pos, $I10)
+.annotate 'line', 76
+  # rx literal  "NUM"
+    add $I11, rx1068_pos, 3
+    gt $I11, rx1068_eos, rx1068_fail
+    sub $I11, rx1068_pos, rx1068_off
+    substr $S10, rx1068_tgt, $I11, 3
+    ne $S10, "NUM", rx1068_fail
+    add rx1068_pos, 3
+    goto alt1071_end
+  alt1071_3:
+    set_addr $I10, alt1071_4
+    rx1068_cur."!mark_push"(0, rx1068_pos, $I10)
+.annotate 'line', 77
+  # rx literal  "STR"
+    add $I11, rx1068_pos, 3
+    gt $I11, rx1068_eos, rx1068_fail
+    sub $I11, rx1068_pos, rx1068_off
+    substr $S10, rx1068_tgt, $I11, 3
+    ne $S10, "STR", rx1068_fail
+    add rx1068_pos, 3
+    goto alt1071_end
+  alt1071_4:
+    set_addr $I10, alt1071_5
+    rx1068_cur."!mark_push"(0, rx1068_pos, $I10)
+.annotate 'line', 78
+  # rx literal  "PMC"
+    add $I11, rx1068_pos, 3
+    gt $I11, rx1068_eos, rx1068_fail
+    sub $I11, rx1068_pos, rx1068_off
+    substr $S10, rx1068_tgt, $I11, 3
+    ne $S10, "PMC", rx1068_fail
+    add rx1068_pos, 3
+    goto alt1071_end
+  alt1071_5:
+    set_addr $I10, alt1071_6
+    rx1068_cur."!mark_push"(0, rx1068_pos, $I10)
+.annotate 'line', 79
+  # rx literal  "KEY"
+    add $I11, rx1068_pos, 3
+    gt $I11, rx1068_eos, rx1068_fail
+    sub $I11, rx1068_pos, rx1068_off
+    substr $S10, rx1068_tgt, $I11, 3
+    ne $S10, "KEY", rx1068_fail
+    add rx1068_pos, 3
+    goto alt1071_end
+  alt1071_6:
+.annotate 'line', 80
+  # rx literal  "LABEL"
+    add $I11, rx1068_pos, 5
+    gt $I11, rx1068_eos, rx1068_fail
+    sub $I11, rx1068_pos, rx1068_off
+    substr $S10, rx1068_tgt, $I11, 5
+    ne $S10, "LABEL", rx1068_fail
+    add rx1068_pos, 5
+  alt1071_end:
+.annotate 'line', 71
+  # rx pass
+    rx1068_cur."!cursor_pass"(rx1068_pos, "op_param_type")
+    if_null rx1068_debug, debug_289
+    rx1068_cur."!cursor_debug"("PASS", "op_param_type", " at pos=", rx1068_pos)
+  debug_289:
+    .return (rx1068_cur)
+  rx1068_restart:
+.annotate 'line', 8
+    if_null rx1068_debug, debug_290
+    rx1068_cur."!cursor_debug"("NEXT", "op_param_type")
+  debug_290:
+  rx1068_fail:
+    (rx1068_rep, rx1068_pos, $I10, $P10) = rx1068_cur."!mark_fail"(0)
+    lt rx1068_pos, -1, rx1068_done
+    eq rx1068_pos, -1, rx1068_fail
+    jump $I10
+  rx1068_done:
+    rx1068_cur."!cursor_fail"()
+    if_null rx1068_debug, debug_291
+    rx1068_cur."!cursor_debug"("FAIL", "op_param_type")
+  debug_291:
+    .return (rx1068_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__op_param_type"  :subid("35_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    new $P100, "ResizablePMCArray"
+    push $P100, "LABEL"
+    push $P100, "KEY"
+    push $P100, "PMC"
+    push $P100, "STR"
+    push $P100, "NUM"
+    push $P100, "INT"
+    push $P100, "INTKEY"
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "op_flag"  :subid("36_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1073_tgt
+    .local int rx1073_pos
+    .local int rx1073_off
+    .local int rx1073_eos
+    .local int rx1073_rep
+    .local pmc rx1073_cur
+    .local pmc rx1073_debug
+    (rx1073_cur, rx1073_pos, rx1073_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1073_debug, rx1073_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1073_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1073_eos, rx1073_tgt
+    gt rx1073_pos, rx1073_eos, rx1073_done
+    set rx1073_off, 0
+    lt rx1073_pos, 2, rx1073_start
+    sub rx1073_off, rx1073_pos, 1
+    substr rx1073_tgt, rx1073_tgt, rx1073_off
+  rx1073_start:
+    eq $I10, 1, rx1073_restart
+    if_null rx1073_debug, debug_292
+    rx1073_cur."!cursor_debug"("START", "op_flag")
+  debug_292:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1075_done
+    goto rxscan1075_scan
+  rxscan1075_loop:
+    ($P10) = rx1073_cur."from"()
+    inc $P10
+    set rx1073_pos, $P10
+    ge rx1073_pos, rx1073_eos, rxscan1075_done
+  rxscan1075_scan:
+    set_addr $I10, rxscan1075_loop
+    rx1073_cur."!mark_push"(0, rx1073_pos, $I10)
+  rxscan1075_done:
+.annotate 'line', 84
+  # rx subrule "ws" subtype=method negate=
+    rx1073_cur."!cursor_pos"(rx1073_pos)
+    $P10 = rx1073_cur."ws"()
+    unless $P10, rx1073_fail
+    rx1073_pos = $P10."pos"()
+.annotate 'line', 85
+  # rx literal  ":"
+    add $I11, rx1073_pos, 1
+    gt $I11, rx1073_eos, rx1073_fail
+    sub $I11, rx1073_pos, rx1073_off
+    ord $I11, rx1073_tgt, $I11
+    ne $I11, 58, rx1073_fail
+    add rx1073_pos, 1
+  # rx subrule "ws" subtype=method negate=
+    rx1073_cur."!cursor_pos"(rx1073_pos)
+    $P10 = rx1073_cur."ws"()
+    unless $P10, rx1073_fail
+    rx1073_pos = $P10."pos"()
+  # rx subrule "identifier" subtype=capture negate=
+    rx1073_cur."!cursor_pos"(rx1073_pos)
+    $P10 = rx1073_cur."identifier"()
+    unless $P10, rx1073_fail
+    rx1073_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("identifier")
+    rx1073_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1073_cur."!cursor_pos"(rx1073_pos)
+    $P10 = rx1073_cur."ws"()
+    unless $P10, rx1073_fail
+    rx1073_pos = $P10."pos"()
+.annotate 'line', 84
+  # rx pass
+    rx1073_cur."!cursor_pass"(rx1073_pos, "op_flag")
+    if_null rx1073_debug, debug_293
+    rx1073_cur."!cursor_debug"("PASS", "op_flag", " at pos=", rx1073_pos)
+  debug_293:
+    .return (rx1073_cur)
+  rx1073_restart:
+.annotate 'line', 8
+    if_null rx1073_debug, debug_294
+    rx1073_cur."!cursor_debug"("NEXT", "op_flag")
+  debug_294:
+  rx1073_fail:
+    (rx1073_rep, rx1073_pos, $I10, $P10) = rx1073_cur."!mark_fail"(0)
+    lt rx1073_pos, -1, rx1073_done
+    eq rx1073_pos, -1, rx1073_fail
+    jump $I10
+  rx1073_done:
+    rx1073_cur."!cursor_fail"()
+    if_null rx1073_debug, debug_295
+    rx1073_cur."!cursor_debug"("FAIL", "op_flag")
+  debug_295:
+    .return (rx1073_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__op_flag"  :subid("37_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("ws", "")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "op_body"  :subid("38_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1077_tgt
+    .local int rx1077_pos
+    .local int rx1077_off
+    .local int rx1077_eos
+    .local int rx1077_rep
+    .local pmc rx1077_cur
+    .local pmc rx1077_debug
+    (rx1077_cur, rx1077_pos, rx1077_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1077_debug, rx1077_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1077_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1077_eos, rx1077_tgt
+    gt rx1077_pos, rx1077_eos, rx1077_done
+    set rx1077_off, 0
+    lt rx1077_pos, 2, rx1077_start
+    sub rx1077_off, rx1077_pos, 1
+    substr rx1077_tgt, rx1077_tgt, rx1077_off
+  rx1077_start:
+    eq $I10, 1, rx1077_restart
+    if_null rx1077_debug, debug_296
+    rx1077_cur."!cursor_debug"("START", "op_body")
+  debug_296:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1079_done
+    goto rxscan1079_scan
+  rxscan1079_loop:
+    ($P10) = rx1077_cur."from"()
+    inc $P10
+    set rx1077_pos, $P10
+    ge rx1077_pos, rx1077_eos, rxscan1079_done
+  rxscan1079_scan:
+    set_addr $I10, rxscan1079_loop
+    rx1077_cur."!mark_push"(0, rx1077_pos, $I10)
+  rxscan1079_done:
+.annotate 'line', 91
+  # rx subrule "blockoid" subtype=capture negate=
+    rx1077_cur."!cursor_pos"(rx1077_pos)
+    $P10 = rx1077_cur."blockoid"()
+    unless $P10, rx1077_fail
+    rx1077_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("blockoid")
+    rx1077_pos = $P10."pos"()
+.annotate 'line', 89
+  # rx pass
+    rx1077_cur."!cursor_pass"(rx1077_pos, "op_body")
+    if_null rx1077_debug, debug_297
+    rx1077_cur."!cursor_debug"("PASS", "op_body", " at pos=", rx1077_pos)
+  debug_297:
+    .return (rx1077_cur)
+  rx1077_restart:
+.annotate 'line', 8
+    if_null rx1077_debug, debug_298
+    rx1077_cur."!cursor_debug"("NEXT", "op_body")
+  debug_298:
+  rx1077_fail:
+    (rx1077_rep, rx1077_pos, $I10, $P10) = rx1077_cur."!mark_fail"(0)
+    lt rx1077_pos, -1, rx1077_done
+    eq rx1077_pos, -1, rx1077_fail
+    jump $I10
+  rx1077_done:
+    rx1077_cur."!cursor_fail"()
+    if_null rx1077_debug, debug_299
+    rx1077_cur."!cursor_debug"("FAIL", "op_body")
+  debug_299:
+    .return (rx1077_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__op_body"  :subid("39_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("blockoid", "")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "quote"  :subid("40_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 94
+    $P100 = self."!protoregex"("quote")
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__quote"  :subid("41_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 94
+    $P101 = self."!PREFIX__!protoregex"("quote")
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "quote:sym<apos>"  :subid("42_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1083_tgt
+    .local int rx1083_pos
+    .local int rx1083_off
+    .local int rx1083_eos
+    .local int rx1083_rep
+    .local pmc rx1083_cur
+    .local pmc rx1083_debug
+    (rx1083_cur, rx1083_pos, rx1083_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1083_debug, rx1083_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1083_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1083_eos, rx1083_tgt
+    gt rx1083_pos, rx1083_eos, rx1083_done
+    set rx1083_off, 0
+    lt rx1083_pos, 2, rx1083_start
+    sub rx1083_off, rx1083_pos, 1
+    substr rx1083_tgt, rx1083_tgt, rx1083_off
+  rx1083_start:
+    eq $I10, 1, rx1083_restart
+    if_null rx1083_debug, debug_300
+    rx1083_cur."!cursor_debug"("START", "quote:sym<apos>")
+  debug_300:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1085_done
+    goto rxscan1085_scan
+  rxscan1085_loop:
+    ($P10) = rx1083_cur."from"()
+    inc $P10
+    set rx1083_pos, $P10
+    ge rx1083_pos, rx1083_eos, rxscan1085_done
+  rxscan1085_scan:
+    set_addr $I10, rxscan1085_loop
+    rx1083_cur."!mark_push"(0, rx1083_pos, $I10)
+  rxscan1085_done:
+.annotate 'line', 95
+  # rx enumcharlist negate=0 zerowidth
+    sub $I10, rx1083_pos, rx1083_off
+    substr $S10, rx1083_tgt, $I10, 1
+    index $I11, "'", $S10
+    lt $I11, 0, rx1083_fail
+  # rx subrule "quote_EXPR" subtype=capture negate=
+    rx1083_cur."!cursor_pos"(rx1083_pos)
+    $P10 = rx1083_cur."quote_EXPR"(":q")
+    unless $P10, rx1083_fail
+    rx1083_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("quote_EXPR")
+    rx1083_pos = $P10."pos"()
+  # rx pass
+    rx1083_cur."!cursor_pass"(rx1083_pos, "quote:sym<apos>")
+    if_null rx1083_debug, debug_301
+    rx1083_cur."!cursor_debug"("PASS", "quote:sym<apos>", " at pos=", rx1083_pos)
+  debug_301:
+    .return (rx1083_cur)
+  rx1083_restart:
+.annotate 'line', 8
+    if_null rx1083_debug, debug_302
+    rx1083_cur."!cursor_debug"("NEXT", "quote:sym<apos>")
+  debug_302:
+  rx1083_fail:
+    (rx1083_rep, rx1083_pos, $I10, $P10) = rx1083_cur."!mark_fail"(0)
+    lt rx1083_pos, -1, rx1083_done
+    eq rx1083_pos, -1, rx1083_fail
+    jump $I10
+  rx1083_done:
+    rx1083_cur."!cursor_fail"()
+    if_null rx1083_debug, debug_303
+    rx1083_cur."!cursor_debug"("FAIL", "quote:sym<apos>")
+  debug_303:
+    .return (rx1083_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__quote:sym<apos>"  :subid("43_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    new $P100, "ResizablePMCArray"
+    push $P100, "'"
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "quote:sym<dblq>"  :subid("44_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1087_tgt
+    .local int rx1087_pos
+    .local int rx1087_off
+    .local int rx1087_eos
+    .local int rx1087_rep
+    .local pmc rx1087_cur
+    .local pmc rx1087_debug
+    (rx1087_cur, rx1087_pos, rx1087_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1087_debug, rx1087_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1087_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1087_eos, rx1087_tgt
+    gt rx1087_pos, rx1087_eos, rx1087_done
+    set rx1087_off, 0
+    lt rx1087_pos, 2, rx1087_start
+    sub rx1087_off, rx1087_pos, 1
+    substr rx1087_tgt, rx1087_tgt, rx1087_off
+  rx1087_start:
+    eq $I10, 1, rx1087_restart
+    if_null rx1087_debug, debug_304
+    rx1087_cur."!cursor_debug"("START", "quote:sym<dblq>")
+  debug_304:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1089_done
+    goto rxscan1089_scan
+  rxscan1089_loop:
+    ($P10) = rx1087_cur."from"()
+    inc $P10
+    set rx1087_pos, $P10
+    ge rx1087_pos, rx1087_eos, rxscan1089_done
+  rxscan1089_scan:
+    set_addr $I10, rxscan1089_loop
+    rx1087_cur."!mark_push"(0, rx1087_pos, $I10)
+  rxscan1089_done:
+.annotate 'line', 96
+  # rx enumcharlist negate=0 zerowidth
+    sub $I10, rx1087_pos, rx1087_off
+    substr $S10, rx1087_tgt, $I10, 1
+    index $I11, "\"", $S10
+    lt $I11, 0, rx1087_fail
+  # rx subrule "quote_EXPR" subtype=capture negate=
+    rx1087_cur."!cursor_pos"(rx1087_pos)
+    $P10 = rx1087_cur."quote_EXPR"(":q")
+    unless $P10, rx1087_fail
+    rx1087_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("quote_EXPR")
+    rx1087_pos = $P10."pos"()
+  # rx pass
+    rx1087_cur."!cursor_pass"(rx1087_pos, "quote:sym<dblq>")
+    if_null rx1087_debug, debug_305
+    rx1087_cur."!cursor_debug"("PASS", "quote:sym<dblq>", " at pos=", rx1087_pos)
+  debug_305:
+    .return (rx1087_cur)
+  rx1087_restart:
+.annotate 'line', 8
+    if_null rx1087_debug, debug_306
+    rx1087_cur."!cursor_debug"("NEXT", "quote:sym<dblq>")
+  debug_306:
+  rx1087_fail:
+    (rx1087_rep, rx1087_pos, $I10, $P10) = rx1087_cur."!mark_fail"(0)
+    lt rx1087_pos, -1, rx1087_done
+    eq rx1087_pos, -1, rx1087_fail
+    jump $I10
+  rx1087_done:
+    rx1087_cur."!cursor_fail"()
+    if_null rx1087_debug, debug_307
+    rx1087_cur."!cursor_debug"("FAIL", "quote:sym<dblq>")
+  debug_307:
+    .return (rx1087_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__quote:sym<dblq>"  :subid("45_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    new $P100, "ResizablePMCArray"
+    push $P100, "\""
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "op_macro"  :subid("46_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 98
+    $P100 = self."!protoregex"("op_macro")
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__op_macro"  :subid("47_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 98
+    $P101 = self."!PREFIX__!protoregex"("op_macro")
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "op_macro:sym<goto offset>"  :subid("48_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1093_tgt
+    .local int rx1093_pos
+    .local int rx1093_off
+    .local int rx1093_eos
+    .local int rx1093_rep
+    .local pmc rx1093_cur
+    .local pmc rx1093_debug
+    (rx1093_cur, rx1093_pos, rx1093_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1093_debug, rx1093_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1093_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1093_eos, rx1093_tgt
+    gt rx1093_pos, rx1093_eos, rx1093_done
+    set rx1093_off, 0
+    lt rx1093_pos, 2, rx1093_start
+    sub rx1093_off, rx1093_pos, 1
+    substr rx1093_tgt, rx1093_tgt, rx1093_off
+  rx1093_start:
+    eq $I10, 1, rx1093_restart
+    if_null rx1093_debug, debug_308
+    rx1093_cur."!cursor_debug"("START", "op_macro:sym<goto offset>")
+  debug_308:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1095_done
+    goto rxscan1095_scan
+  rxscan1095_loop:
+    ($P10) = rx1093_cur."from"()
+    inc $P10
+    set rx1093_pos, $P10
+    ge rx1093_pos, rx1093_eos, rxscan1095_done
+  rxscan1095_scan:
+    set_addr $I10, rxscan1095_loop
+    rx1093_cur."!mark_push"(0, rx1093_pos, $I10)
+  rxscan1095_done:
+.annotate 'line', 99
+  # rx subrule "ws" subtype=method negate=
+    rx1093_cur."!cursor_pos"(rx1093_pos)
+    $P10 = rx1093_cur."ws"()
+    unless $P10, rx1093_fail
+    rx1093_pos = $P10."pos"()
+  # rx literal  "goto"
+    add $I11, rx1093_pos, 4
+    gt $I11, rx1093_eos, rx1093_fail
+    sub $I11, rx1093_pos, rx1093_off
+    substr $S10, rx1093_tgt, $I11, 4
+    ne $S10, "goto", rx1093_fail
+    add rx1093_pos, 4
+  # rx subrule "ws" subtype=method negate=
+    rx1093_cur."!cursor_pos"(rx1093_pos)
+    $P10 = rx1093_cur."ws"()
+    unless $P10, rx1093_fail
+    rx1093_pos = $P10."pos"()
+  # rx literal  "OFFSET"
+    add $I11, rx1093_pos, 6
+    gt $I11, rx1093_eos, rx1093_fail
+    sub $I11, rx1093_pos, rx1093_off
+    substr $S10, rx1093_tgt, $I11, 6
+    ne $S10, "OFFSET", rx1093_fail
+    add rx1093_pos, 6
+  # rx subrule "ws" subtype=method negate=
+    rx1093_cur."!cursor_pos"(rx1093_pos)
+    $P10 = rx1093_cur."ws"()
+    unless $P10, rx1093_fail
+    rx1093_pos = $P10."pos"()
+  # rx literal  "("
+    add $I11, rx1093_pos, 1
+    gt $I11, rx1093_eos, rx1093_fail
+    sub $I11, rx1093_pos, rx1093_off
+    ord $I11, rx1093_tgt, $I11
+    ne $I11, 40, rx1093_fail
+    add rx1093_pos, 1
+  # rx subrule "ws" subtype=method negate=
+    rx1093_cur."!cursor_pos"(rx1093_pos)
+    $P10 = rx1093_cur."ws"()
+    unless $P10, rx1093_fail
+    rx1093_pos = $P10."pos"()
+  # rx subrule "EXPR" subtype=capture negate=
+    rx1093_cur."!cursor_pos"(rx1093_pos)
+    $P10 = rx1093_cur."EXPR"()
+    unless $P10, rx1093_fail
+    rx1093_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("arg")
+    rx1093_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1093_cur."!cursor_pos"(rx1093_pos)
+    $P10 = rx1093_cur."ws"()
+    unless $P10, rx1093_fail
+    rx1093_pos = $P10."pos"()
+  # rx literal  ")"
+    add $I11, rx1093_pos, 1
+    gt $I11, rx1093_eos, rx1093_fail
+    sub $I11, rx1093_pos, rx1093_off
+    ord $I11, rx1093_tgt, $I11
+    ne $I11, 41, rx1093_fail
+    add rx1093_pos, 1
+  # rx subrule "ws" subtype=method negate=
+    rx1093_cur."!cursor_pos"(rx1093_pos)
+    $P10 = rx1093_cur."ws"()
+    unless $P10, rx1093_fail
+    rx1093_pos = $P10."pos"()
+  # rx pass
+    rx1093_cur."!cursor_pass"(rx1093_pos, "op_macro:sym<goto offset>")
+    if_null rx1093_debug, debug_309
+    rx1093_cur."!cursor_debug"("PASS", "op_macro:sym<goto offset>", " at pos=", rx1093_pos)
+  debug_309:
+    .return (rx1093_cur)
+  rx1093_restart:
+.annotate 'line', 8
+    if_null rx1093_debug, debug_310
+    rx1093_cur."!cursor_debug"("NEXT", "op_macro:sym<goto offset>")
+  debug_310:
+  rx1093_fail:
+    (rx1093_rep, rx1093_pos, $I10, $P10) = rx1093_cur."!mark_fail"(0)
+    lt rx1093_pos, -1, rx1093_done
+    eq rx1093_pos, -1, rx1093_fail
+    jump $I10
+  rx1093_done:
+    rx1093_cur."!cursor_fail"()
+    if_null rx1093_debug, debug_311
+    rx1093_cur."!cursor_debug"("FAIL", "op_macro:sym<goto offset>")
+  debug_311:
+    .return (rx1093_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__op_macro:sym<goto offset>"  :subid("49_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("ws", "")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "op_macro:sym<expr offset>"  :subid("50_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1097_tgt
+    .local int rx1097_pos
+    .local int rx1097_off
+    .local int rx1097_eos
+    .local int rx1097_rep
+    .local pmc rx1097_cur
+    .local pmc rx1097_debug
+    (rx1097_cur, rx1097_pos, rx1097_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1097_debug, rx1097_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1097_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1097_eos, rx1097_tgt
+    gt rx1097_pos, rx1097_eos, rx1097_done
+    set rx1097_off, 0
+    lt rx1097_pos, 2, rx1097_start
+    sub rx1097_off, rx1097_pos, 1
+    substr rx1097_tgt, rx1097_tgt, rx1097_off
+  rx1097_start:
+    eq $I10, 1, rx1097_restart
+    if_null rx1097_debug, debug_312
+    rx1097_cur."!cursor_debug"("START", "op_macro:sym<expr offset>")
+  debug_312:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1099_done
+    goto rxscan1099_scan
+  rxscan1099_loop:
+    ($P10) = rx1097_cur."from"()
+    inc $P10
+    set rx1097_pos, $P10
+    ge rx1097_pos, rx1097_eos, rxscan1099_done
+  rxscan1099_scan:
+    set_addr $I10, rxscan1099_loop
+    rx1097_cur."!mark_push"(0, rx1097_pos, $I10)
+  rxscan1099_done:
+.annotate 'line', 100
+  # rx subrule "ws" subtype=method negate=
+    rx1097_cur."!cursor_pos"(rx1097_pos)
+    $P10 = rx1097_cur."ws"()
+    unless $P10, rx1097_fail
+    rx1097_pos = $P10."pos"()
+  # rx literal  "expr"
+    add $I11, rx1097_pos, 4
+    gt $I11, rx1097_eos, rx1097_fail
+    sub $I11, rx1097_pos, rx1097_off
+    substr $S10, rx1097_tgt, $I11, 4
+    ne $S10, "expr", rx1097_fail
+    add rx1097_pos, 4
+  # rx subrule "ws" subtype=method negate=
+    rx1097_cur."!cursor_pos"(rx1097_pos)
+    $P10 = rx1097_cur."ws"()
+    unless $P10, rx1097_fail
+    rx1097_pos = $P10."pos"()
+  # rx literal  "OFFSET"
+    add $I11, rx1097_pos, 6
+    gt $I11, rx1097_eos, rx1097_fail
+    sub $I11, rx1097_pos, rx1097_off
+    substr $S10, rx1097_tgt, $I11, 6
+    ne $S10, "OFFSET", rx1097_fail
+    add rx1097_pos, 6
+  # rx subrule "ws" subtype=method negate=
+    rx1097_cur."!cursor_pos"(rx1097_pos)
+    $P10 = rx1097_cur."ws"()
+    unless $P10, rx1097_fail
+    rx1097_pos = $P10."pos"()
+  # rx literal  "("
+    add $I11, rx1097_pos, 1
+    gt $I11, rx1097_eos, rx1097_fail
+    sub $I11, rx1097_pos, rx1097_off
+    ord $I11, rx1097_tgt, $I11
+    ne $I11, 40, rx1097_fail
+    add rx1097_pos, 1
+  # rx subrule "ws" subtype=method negate=
+    rx1097_cur."!cursor_pos"(rx1097_pos)
+    $P10 = rx1097_cur."ws"()
+    unless $P10, rx1097_fail
+    rx1097_pos = $P10."pos"()
+  # rx subrule "EXPR" subtype=capture negate=
+    rx1097_cur."!cursor_pos"(rx1097_pos)
+    $P10 = rx1097_cur."EXPR"()
+    unless $P10, rx1097_fail
+    rx1097_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("arg")
+    rx1097_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1097_cur."!cursor_pos"(rx1097_pos)
+    $P10 = rx1097_cur."ws"()
+    unless $P10, rx1097_fail
+    rx1097_pos = $P10."pos"()
+  # rx literal  ")"
+    add $I11, rx1097_pos, 1
+    gt $I11, rx1097_eos, rx1097_fail
+    sub $I11, rx1097_pos, rx1097_off
+    ord $I11, rx1097_tgt, $I11
+    ne $I11, 41, rx1097_fail
+    add rx1097_pos, 1
+  # rx subrule "ws" subtype=method negate=
+    rx1097_cur."!cursor_pos"(rx1097_pos)
+    $P10 = rx1097_cur."ws"()
+    unless $P10, rx1097_fail
+    rx1097_pos = $P10."pos"()
+  # rx pass
+    rx1097_cur."!cursor_pass"(rx1097_pos, "op_macro:sym<expr offset>")
+    if_null rx1097_debug, debug_313
+    rx1097_cur."!cursor_debug"("PASS", "op_macro:sym<expr offset>", " at pos=", rx1097_pos)
+  debug_313:
+    .return (rx1097_cur)
+  rx1097_restart:
+.annotate 'line', 8
+    if_null rx1097_debug, debug_314
+    rx1097_cur."!cursor_debug"("NEXT", "op_macro:sym<expr offset>")
+  debug_314:
+  rx1097_fail:
+    (rx1097_rep, rx1097_pos, $I10, $P10) = rx1097_cur."!mark_fail"(0)
+    lt rx1097_pos, -1, rx1097_done
+    eq rx1097_pos, -1, rx1097_fail
+    jump $I10
+  rx1097_done:
+    rx1097_cur."!cursor_fail"()
+    if_null rx1097_debug, debug_315
+    rx1097_cur."!cursor_debug"("FAIL", "op_macro:sym<expr offset>")
+  debug_315:
+    .return (rx1097_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__op_macro:sym<expr offset>"  :subid("51_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("ws", "")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "op_macro:sym<goto address>"  :subid("52_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1101_tgt
+    .local int rx1101_pos
+    .local int rx1101_off
+    .local int rx1101_eos
+    .local int rx1101_rep
+    .local pmc rx1101_cur
+    .local pmc rx1101_debug
+    (rx1101_cur, rx1101_pos, rx1101_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1101_debug, rx1101_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1101_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1101_eos, rx1101_tgt
+    gt rx1101_pos, rx1101_eos, rx1101_done
+    set rx1101_off, 0
+    lt rx1101_pos, 2, rx1101_start
+    sub rx1101_off, rx1101_pos, 1
+    substr rx1101_tgt, rx1101_tgt, rx1101_off
+  rx1101_start:
+    eq $I10, 1, rx1101_restart
+    if_null rx1101_debug, debug_316
+    rx1101_cur."!cursor_debug"("START", "op_macro:sym<goto address>")
+  debug_316:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1103_done
+    goto rxscan1103_scan
+  rxscan1103_loop:
+    ($P10) = rx1101_cur."from"()
+    inc $P10
+    set rx1101_pos, $P10
+    ge rx1101_pos, rx1101_eos, rxscan1103_done
+  rxscan1103_scan:
+    set_addr $I10, rxscan1103_loop
+    rx1101_cur."!mark_push"(0, rx1101_pos, $I10)
+  rxscan1103_done:
+.annotate 'line', 101
+  # rx subrule "ws" subtype=method negate=
+    rx1101_cur."!cursor_pos"(rx1101_pos)
+    $P10 = rx1101_cur."ws"()
+    unless $P10, rx1101_fail
+    rx1101_pos = $P10."pos"()
+  # rx literal  "goto"
+    add $I11, rx1101_pos, 4
+    gt $I11, rx1101_eos, rx1101_fail
+    sub $I11, rx1101_pos, rx1101_off
+    substr $S10, rx1101_tgt, $I11, 4
+    ne $S10, "goto", rx1101_fail
+    add rx1101_pos, 4
+  # rx subrule "ws" subtype=method negate=
+    rx1101_cur."!cursor_pos"(rx1101_pos)
+    $P10 = rx1101_cur."ws"()
+    unless $P10, rx1101_fail
+    rx1101_pos = $P10."pos"()
+  # rx literal  "ADDRESS"
+    add $I11, rx1101_pos, 7
+    gt $I11, rx1101_eos, rx1101_fail
+    sub $I11, rx1101_pos, rx1101_off
+    substr $S10, rx1101_tgt, $I11, 7
+    ne $S10, "ADDRESS", rx1101_fail
+    add rx1101_pos, 7
+  # rx subrule "ws" subtype=method negate=
+    rx1101_cur."!cursor_pos"(rx1101_pos)
+    $P10 = rx1101_cur."ws"()
+    unless $P10, rx1101_fail
+    rx1101_pos = $P10."pos"()
+  # rx literal  "("
+    add $I11, rx1101_pos, 1
+    gt $I11, rx1101_eos, rx1101_fail
+    sub $I11, rx1101_pos, rx1101_off
+    ord $I11, rx1101_tgt, $I11
+    ne $I11, 40, rx1101_fail
+    add rx1101_pos, 1
+  # rx subrule "ws" subtype=method negate=
+    rx1101_cur."!cursor_pos"(rx1101_pos)
+    $P10 = rx1101_cur."ws"()
+    unless $P10, rx1101_fail
+    rx1101_pos = $P10."pos"()
+  # rx subrule "EXPR" subtype=capture negate=
+    rx1101_cur."!cursor_pos"(rx1101_pos)
+    $P10 = rx1101_cur."EXPR"()
+    unless $P10, rx1101_fail
+    rx1101_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("arg")
+    rx1101_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1101_cur."!cursor_pos"(rx1101_pos)
+    $P10 = rx1101_cur."ws"()
+    unless $P10, rx1101_fail
+    rx1101_pos = $P10."pos"()
+  # rx literal  ")"
+    add $I11, rx1101_pos, 1
+    gt $I11, rx1101_eos, rx1101_fail
+    sub $I11, rx1101_pos, rx1101_off
+    ord $I11, rx1101_tgt, $I11
+    ne $I11, 41, rx1101_fail
+    add rx1101_pos, 1
+  # rx subrule "ws" subtype=method negate=
+    rx1101_cur."!cursor_pos"(rx1101_pos)
+    $P10 = rx1101_cur."ws"()
+    unless $P10, rx1101_fail
+    rx1101_pos = $P10."pos"()
+  # rx pass
+    rx1101_cur."!cursor_pass"(rx1101_pos, "op_macro:sym<goto address>")
+    if_null rx1101_debug, debug_317
+    rx1101_cur."!cursor_debug"("PASS", "op_macro:sym<goto address>", " at pos=", rx1101_pos)
+  debug_317:
+    .return (rx1101_cur)
+  rx1101_restart:
+.annotate 'line', 8
+    if_null rx1101_debug, debug_318
+    rx1101_cur."!cursor_debug"("NEXT", "op_macro:sym<goto address>")
+  debug_318:
+  rx1101_fail:
+    (rx1101_rep, rx1101_pos, $I10, $P10) = rx1101_cur."!mark_fail"(0)
+    lt rx1101_pos, -1, rx1101_done
+    eq rx1101_pos, -1, rx1101_fail
+    jump $I10
+  rx1101_done:
+    rx1101_cur."!cursor_fail"()
+    if_null rx1101_debug, debug_319
+    rx1101_cur."!cursor_debug"("FAIL", "op_macro:sym<goto address>")
+  debug_319:
+    .return (rx1101_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__op_macro:sym<goto address>"  :subid("53_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("ws", "")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "op_macro:sym<expr address>"  :subid("54_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1105_tgt
+    .local int rx1105_pos
+    .local int rx1105_off
+    .local int rx1105_eos
+    .local int rx1105_rep
+    .local pmc rx1105_cur
+    .local pmc rx1105_debug
+    (rx1105_cur, rx1105_pos, rx1105_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1105_debug, rx1105_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1105_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1105_eos, rx1105_tgt
+    gt rx1105_pos, rx1105_eos, rx1105_done
+    set rx1105_off, 0
+    lt rx1105_pos, 2, rx1105_start
+    sub rx1105_off, rx1105_pos, 1
+    substr rx1105_tgt, rx1105_tgt, rx1105_off
+  rx1105_start:
+    eq $I10, 1, rx1105_restart
+    if_null rx1105_debug, debug_320
+    rx1105_cur."!cursor_debug"("START", "op_macro:sym<expr address>")
+  debug_320:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1107_done
+    goto rxscan1107_scan
+  rxscan1107_loop:
+    ($P10) = rx1105_cur."from"()
+    inc $P10
+    set rx1105_pos, $P10
+    ge rx1105_pos, rx1105_eos, rxscan1107_done
+  rxscan1107_scan:
+    set_addr $I10, rxscan1107_loop
+    rx1105_cur."!mark_push"(0, rx1105_pos, $I10)
+  rxscan1107_done:
+.annotate 'line', 102
+  # rx subrule "ws" subtype=method negate=
+    rx1105_cur."!cursor_pos"(rx1105_pos)
+    $P10 = rx1105_cur."ws"()
+    unless $P10, rx1105_fail
+    rx1105_pos = $P10."pos"()
+  # rx literal  "expr"
+    add $I11, rx1105_pos, 4
+    gt $I11, rx1105_eos, rx1105_fail
+    sub $I11, rx1105_pos, rx1105_off
+    substr $S10, rx1105_tgt, $I11, 4
+    ne $S10, "expr", rx1105_fail
+    add rx1105_pos, 4
+  # rx subrule "ws" subtype=method negate=
+    rx1105_cur."!cursor_pos"(rx1105_pos)
+    $P10 = rx1105_cur."ws"()
+    unless $P10, rx1105_fail
+    rx1105_pos = $P10."pos"()
+  # rx literal  "ADDRESS"
+    add $I11, rx1105_pos, 7
+    gt $I11, rx1105_eos, rx1105_fail
+    sub $I11, rx1105_pos, rx1105_off
+    substr $S10, rx1105_tgt, $I11, 7
+    ne $S10, "ADDRESS", rx1105_fail
+    add rx1105_pos, 7
+  # rx subrule "ws" subtype=method negate=
+    rx1105_cur."!cursor_pos"(rx1105_pos)
+    $P10 = rx1105_cur."ws"()
+    unless $P10, rx1105_fail
+    rx1105_pos = $P10."pos"()
+  # rx literal  "("
+    add $I11, rx1105_pos, 1
+    gt $I11, rx1105_eos, rx1105_fail
+    sub $I11, rx1105_pos, rx1105_off
+    ord $I11, rx1105_tgt, $I11
+    ne $I11, 40, rx1105_fail
+    add rx1105_pos, 1
+  # rx subrule "ws" subtype=method negate=
+    rx1105_cur."!cursor_pos"(rx1105_pos)
+    $P10 = rx1105_cur."ws"()
+    unless $P10, rx1105_fail
+    rx1105_pos = $P10."pos"()
+  # rx subrule "EXPR" subtype=capture negate=
+    rx1105_cur."!cursor_pos"(rx1105_pos)
+    $P10 = rx1105_cur."EXPR"()
+    unless $P10, rx1105_fail
+    rx1105_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("arg")
+    rx1105_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1105_cur."!cursor_pos"(rx1105_pos)
+    $P10 = rx1105_cur."ws"()
+    unless $P10, rx1105_fail
+    rx1105_pos = $P10."pos"()
+  # rx literal  ")"
+    add $I11, rx1105_pos, 1
+    gt $I11, rx1105_eos, rx1105_fail
+    sub $I11, rx1105_pos, rx1105_off
+    ord $I11, rx1105_tgt, $I11
+    ne $I11, 41, rx1105_fail
+    add rx1105_pos, 1
+  # rx subrule "ws" subtype=method negate=
+    rx1105_cur."!cursor_pos"(rx1105_pos)
+    $P10 = rx1105_cur."ws"()
+    unless $P10, rx1105_fail
+    rx1105_pos = $P10."pos"()
+  # rx pass
+    rx1105_cur."!cursor_pass"(rx1105_pos, "op_macro:sym<expr address>")
+    if_null rx1105_debug, debug_321
+    rx1105_cur."!cursor_debug"("PASS", "op_macro:sym<expr address>", " at pos=", rx1105_pos)
+  debug_321:
+    .return (rx1105_cur)
+  rx1105_restart:
+.annotate 'line', 8
+    if_null rx1105_debug, debug_322
+    rx1105_cur."!cursor_debug"("NEXT", "op_macro:sym<expr address>")
+  debug_322:
+  rx1105_fail:
+    (rx1105_rep, rx1105_pos, $I10, $P10) = rx1105_cur."!mark_fail"(0)
+    lt rx1105_pos, -1, rx1105_done
+    eq rx1105_pos, -1, rx1105_fail
+    jump $I10
+  rx1105_done:
+    rx1105_cur."!cursor_fail"()
+    if_null rx1105_debug, debug_323
+    rx1105_cur."!cursor_debug"("FAIL", "op_macro:sym<expr address>")
+  debug_323:
+    .return (rx1105_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__op_macro:sym<expr address>"  :subid("55_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("ws", "")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "op_macro:sym<goto next>"  :subid("56_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1109_tgt
+    .local int rx1109_pos
+    .local int rx1109_off
+    .local int rx1109_eos
+    .local int rx1109_rep
+    .local pmc rx1109_cur
+    .local pmc rx1109_debug
+    (rx1109_cur, rx1109_pos, rx1109_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1109_debug, rx1109_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1109_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1109_eos, rx1109_tgt
+    gt rx1109_pos, rx1109_eos, rx1109_done
+    set rx1109_off, 0
+    lt rx1109_pos, 2, rx1109_start
+    sub rx1109_off, rx1109_pos, 1
+    substr rx1109_tgt, rx1109_tgt, rx1109_off
+  rx1109_start:
+    eq $I10, 1, rx1109_restart
+    if_null rx1109_debug, debug_324
+    rx1109_cur."!cursor_debug"("START", "op_macro:sym<goto next>")
+  debug_324:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1111_done
+    goto rxscan1111_scan
+  rxscan1111_loop:
+    ($P10) = rx1109_cur."from"()
+    inc $P10
+    set rx1109_pos, $P10
+    ge rx1109_pos, rx1109_eos, rxscan1111_done
+  rxscan1111_scan:
+    set_addr $I10, rxscan1111_loop
+    rx1109_cur."!mark_push"(0, rx1109_pos, $I10)
+  rxscan1111_done:
+.annotate 'line', 103
+  # rx subrule "ws" subtype=method negate=
+    rx1109_cur."!cursor_pos"(rx1109_pos)
+    $P10 = rx1109_cur."ws"()
+    unless $P10, rx1109_fail
+    rx1109_pos = $P10."pos"()
+  # rx literal  "goto"
+    add $I11, rx1109_pos, 4
+    gt $I11, rx1109_eos, rx1109_fail
+    sub $I11, rx1109_pos, rx1109_off
+    substr $S10, rx1109_tgt, $I11, 4
+    ne $S10, "goto", rx1109_fail
+    add rx1109_pos, 4
+  # rx subrule "ws" subtype=method negate=
+    rx1109_cur."!cursor_pos"(rx1109_pos)
+    $P10 = rx1109_cur."ws"()
+    unless $P10, rx1109_fail
+    rx1109_pos = $P10."pos"()
+  # rx literal  "NEXT"
+    add $I11, rx1109_pos, 4
+    gt $I11, rx1109_eos, rx1109_fail
+    sub $I11, rx1109_pos, rx1109_off
+    substr $S10, rx1109_tgt, $I11, 4
+    ne $S10, "NEXT", rx1109_fail
+    add rx1109_pos, 4
+  # rx subrule "ws" subtype=method negate=
+    rx1109_cur."!cursor_pos"(rx1109_pos)
+    $P10 = rx1109_cur."ws"()
+    unless $P10, rx1109_fail
+    rx1109_pos = $P10."pos"()
+  # rx literal  "("
+    add $I11, rx1109_pos, 1
+    gt $I11, rx1109_eos, rx1109_fail
+    sub $I11, rx1109_pos, rx1109_off
+    ord $I11, rx1109_tgt, $I11
+    ne $I11, 40, rx1109_fail
+    add rx1109_pos, 1
+  # rx subrule "ws" subtype=method negate=
+    rx1109_cur."!cursor_pos"(rx1109_pos)
+    $P10 = rx1109_cur."ws"()
+    unless $P10, rx1109_fail
+    rx1109_pos = $P10."pos"()
+  # rx literal  ")"
+    add $I11, rx1109_pos, 1
+    gt $I11, rx1109_eos, rx1109_fail
+    sub $I11, rx1109_pos, rx1109_off
+    ord $I11, rx1109_tgt, $I11
+    ne $I11, 41, rx1109_fail
+    add rx1109_pos, 1
+  # rx subrule "ws" subtype=method negate=
+    rx1109_cur."!cursor_pos"(rx1109_pos)
+    $P10 = rx1109_cur."ws"()
+    unless $P10, rx1109_fail
+    rx1109_pos = $P10."pos"()
+  # rx pass
+    rx1109_cur."!cursor_pass"(rx1109_pos, "op_macro:sym<goto next>")
+    if_null rx1109_debug, debug_325
+    rx1109_cur."!cursor_debug"("PASS", "op_macro:sym<goto next>", " at pos=", rx1109_pos)
+  debug_325:
+    .return (rx1109_cur)
+  rx1109_restart:
+.annotate 'line', 8
+    if_null rx1109_debug, debug_326
+    rx1109_cur."!cursor_debug"("NEXT", "op_macro:sym<goto next>")
+  debug_326:
+  rx1109_fail:
+    (rx1109_rep, rx1109_pos, $I10, $P10) = rx1109_cur."!mark_fail"(0)
+    lt rx1109_pos, -1, rx1109_done
+    eq rx1109_pos, -1, rx1109_fail
+    jump $I10
+  rx1109_done:
+    rx1109_cur."!cursor_fail"()
+    if_null rx1109_debug, debug_327
+    rx1109_cur."!cursor_debug"("FAIL", "op_macro:sym<goto next>")
+  debug_327:
+    .return (rx1109_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__op_macro:sym<goto next>"  :subid("57_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("ws", "")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "op_macro:sym<expr next>"  :subid("58_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1113_tgt
+    .local int rx1113_pos
+    .local int rx1113_off
+    .local int rx1113_eos
+    .local int rx1113_rep
+    .local pmc rx1113_cur
+    .local pmc rx1113_debug
+    (rx1113_cur, rx1113_pos, rx1113_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1113_debug, rx1113_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1113_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1113_eos, rx1113_tgt
+    gt rx1113_pos, rx1113_eos, rx1113_done
+    set rx1113_off, 0
+    lt rx1113_pos, 2, rx1113_start
+    sub rx1113_off, rx1113_pos, 1
+    substr rx1113_tgt, rx1113_tgt, rx1113_off
+  rx1113_start:
+    eq $I10, 1, rx1113_restart
+    if_null rx1113_debug, debug_328
+    rx1113_cur."!cursor_debug"("START", "op_macro:sym<expr next>")
+  debug_328:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1115_done
+    goto rxscan1115_scan
+  rxscan1115_loop:
+    ($P10) = rx1113_cur."from"()
+    inc $P10
+    set rx1113_pos, $P10
+    ge rx1113_pos, rx1113_eos, rxscan1115_done
+  rxscan1115_scan:
+    set_addr $I10, rxscan1115_loop
+    rx1113_cur."!mark_push"(0, rx1113_pos, $I10)
+  rxscan1115_done:
+.annotate 'line', 104
+  # rx subrule "ws" subtype=method negate=
+    rx1113_cur."!cursor_pos"(rx1113_pos)
+    $P10 = rx1113_cur."ws"()
+    unless $P10, rx1113_fail
+    rx1113_pos = $P10."pos"()
+  # rx literal  "expr"
+    add $I11, rx1113_pos, 4
+    gt $I11, rx1113_eos, rx1113_fail
+    sub $I11, rx1113_pos, rx1113_off
+    substr $S10, rx1113_tgt, $I11, 4
+    ne $S10, "expr", rx1113_fail
+    add rx1113_pos, 4
+  # rx subrule "ws" subtype=method negate=
+    rx1113_cur."!cursor_pos"(rx1113_pos)
+    $P10 = rx1113_cur."ws"()
+    unless $P10, rx1113_fail
+    rx1113_pos = $P10."pos"()
+  # rx literal  "NEXT"
+    add $I11, rx1113_pos, 4
+    gt $I11, rx1113_eos, rx1113_fail
+    sub $I11, rx1113_pos, rx1113_off
+    substr $S10, rx1113_tgt, $I11, 4
+    ne $S10, "NEXT", rx1113_fail
+    add rx1113_pos, 4
+  # rx subrule "ws" subtype=method negate=
+    rx1113_cur."!cursor_pos"(rx1113_pos)
+    $P10 = rx1113_cur."ws"()
+    unless $P10, rx1113_fail
+    rx1113_pos = $P10."pos"()
+  # rx literal  "("
+    add $I11, rx1113_pos, 1
+    gt $I11, rx1113_eos, rx1113_fail
+    sub $I11, rx1113_pos, rx1113_off
+    ord $I11, rx1113_tgt, $I11
+    ne $I11, 40, rx1113_fail
+    add rx1113_pos, 1
+  # rx subrule "ws" subtype=method negate=
+    rx1113_cur."!cursor_pos"(rx1113_pos)
+    $P10 = rx1113_cur."ws"()
+    unless $P10, rx1113_fail
+    rx1113_pos = $P10."pos"()
+  # rx literal  ")"
+    add $I11, rx1113_pos, 1
+    gt $I11, rx1113_eos, rx1113_fail
+    sub $I11, rx1113_pos, rx1113_off
+    ord $I11, rx1113_tgt, $I11
+    ne $I11, 41, rx1113_fail
+    add rx1113_pos, 1
+  # rx subrule "ws" subtype=method negate=
+    rx1113_cur."!cursor_pos"(rx1113_pos)
+    $P10 = rx1113_cur."ws"()
+    unless $P10, rx1113_fail
+    rx1113_pos = $P10."pos"()
+  # rx pass
+    rx1113_cur."!cursor_pass"(rx1113_pos, "op_macro:sym<expr next>")
+    if_null rx1113_debug, debug_329
+    rx1113_cur."!cursor_debug"("PASS", "op_macro:sym<expr next>", " at pos=", rx1113_pos)
+  debug_329:
+    .return (rx1113_cur)
+  rx1113_restart:
+.annotate 'line', 8
+    if_null rx1113_debug, debug_330
+    rx1113_cur."!cursor_debug"("NEXT", "op_macro:sym<expr next>")
+  debug_330:
+  rx1113_fail:
+    (rx1113_rep, rx1113_pos, $I10, $P10) = rx1113_cur."!mark_fail"(0)
+    lt rx1113_pos, -1, rx1113_done
+    eq rx1113_pos, -1, rx1113_fail
+    jump $I10
+  rx1113_done:
+    rx1113_cur."!cursor_fail"()
+    if_null rx1113_debug, debug_331
+    rx1113_cur."!cursor_debug"("FAIL", "op_macro:sym<expr next>")
+  debug_331:
+    .return (rx1113_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__op_macro:sym<expr next>"  :subid("59_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("ws", "")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "op_macro:sym<restart next>"  :subid("60_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1117_tgt
+    .local int rx1117_pos
+    .local int rx1117_off
+    .local int rx1117_eos
+    .local int rx1117_rep
+    .local pmc rx1117_cur
+    .local pmc rx1117_debug
+    (rx1117_cur, rx1117_pos, rx1117_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1117_debug, rx1117_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1117_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1117_eos, rx1117_tgt
+    gt rx1117_pos, rx1117_eos, rx1117_done
+    set rx1117_off, 0
+    lt rx1117_pos, 2, rx1117_start
+    sub rx1117_off, rx1117_pos, 1
+    substr rx1117_tgt, rx1117_tgt, rx1117_off
+  rx1117_start:
+    eq $I10, 1, rx1117_restart
+    if_null rx1117_debug, debug_332
+    rx1117_cur."!cursor_debug"("START", "op_macro:sym<restart next>")
+  debug_332:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1119_done
+    goto rxscan1119_scan
+  rxscan1119_loop:
+    ($P10) = rx1117_cur."from"()
+    inc $P10
+    set rx1117_pos, $P10
+    ge rx1117_pos, rx1117_eos, rxscan1119_done
+  rxscan1119_scan:
+    set_addr $I10, rxscan1119_loop
+    rx1117_cur."!mark_push"(0, rx1117_pos, $I10)
+  rxscan1119_done:
+.annotate 'line', 105
+  # rx subrule "ws" subtype=method negate=
+    rx1117_cur."!cursor_pos"(rx1117_pos)
+    $P10 = rx1117_cur."ws"()
+    unless $P10, rx1117_fail
+    rx1117_pos = $P10."pos"()
+  # rx literal  "restart"
+    add $I11, rx1117_pos, 7
+    gt $I11, rx1117_eos, rx1117_fail
+    sub $I11, rx1117_pos, rx1117_off
+    substr $S10, rx1117_tgt, $I11, 7
+    ne $S10, "restart", rx1117_fail
+    add rx1117_pos, 7
+  # rx subrule "ws" subtype=method negate=
+    rx1117_cur."!cursor_pos"(rx1117_pos)
+    $P10 = rx1117_cur."ws"()
+    unless $P10, rx1117_fail
+    rx1117_pos = $P10."pos"()
+  # rx literal  "NEXT"
+    add $I11, rx1117_pos, 4
+    gt $I11, rx1117_eos, rx1117_fail
+    sub $I11, rx1117_pos, rx1117_off
+    substr $S10, rx1117_tgt, $I11, 4
+    ne $S10, "NEXT", rx1117_fail
+    add rx1117_pos, 4
+  # rx subrule "ws" subtype=method negate=
+    rx1117_cur."!cursor_pos"(rx1117_pos)
+    $P10 = rx1117_cur."ws"()
+    unless $P10, rx1117_fail
+    rx1117_pos = $P10."pos"()
+  # rx literal  "("
+    add $I11, rx1117_pos, 1
+    gt $I11, rx1117_eos, rx1117_fail
+    sub $I11, rx1117_pos, rx1117_off
+    ord $I11, rx1117_tgt, $I11
+    ne $I11, 40, rx1117_fail
+    add rx1117_pos, 1
+  # rx subrule "ws" subtype=method negate=
+    rx1117_cur."!cursor_pos"(rx1117_pos)
+    $P10 = rx1117_cur."ws"()
+    unless $P10, rx1117_fail
+    rx1117_pos = $P10."pos"()
+  # rx literal  ")"
+    add $I11, rx1117_pos, 1
+    gt $I11, rx1117_eos, rx1117_fail
+    sub $I11, rx1117_pos, rx1117_off
+    ord $I11, rx1117_tgt, $I11
+    ne $I11, 41, rx1117_fail
+    add rx1117_pos, 1
+  # rx subrule "ws" subtype=method negate=
+    rx1117_cur."!cursor_pos"(rx1117_pos)
+    $P10 = rx1117_cur."ws"()
+    unless $P10, rx1117_fail
+    rx1117_pos = $P10."pos"()
+  # rx pass
+    rx1117_cur."!cursor_pass"(rx1117_pos, "op_macro:sym<restart next>")
+    if_null rx1117_debug, debug_333
+    rx1117_cur."!cursor_debug"("PASS", "op_macro:sym<restart next>", " at pos=", rx1117_pos)
+  debug_333:
+    .return (rx1117_cur)
+  rx1117_restart:
+.annotate 'line', 8
+    if_null rx1117_debug, debug_334
+    rx1117_cur."!cursor_debug"("NEXT", "op_macro:sym<restart next>")
+  debug_334:
+  rx1117_fail:
+    (rx1117_rep, rx1117_pos, $I10, $P10) = rx1117_cur."!mark_fail"(0)
+    lt rx1117_pos, -1, rx1117_done
+    eq rx1117_pos, -1, rx1117_fail
+    jump $I10
+  rx1117_done:
+    rx1117_cur."!cursor_fail"()
+    if_null rx1117_debug, debug_335
+    rx1117_cur."!cursor_debug"("FAIL", "op_macro:sym<restart next>")
+  debug_335:
+    .return (rx1117_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__op_macro:sym<restart next>"  :subid("61_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("ws", "")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "c_macro"  :subid("62_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 107
+    $P100 = self."!protoregex"("c_macro")
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__c_macro"  :subid("63_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 107
+    $P101 = self."!PREFIX__!protoregex"("c_macro")
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "c_macro:sym<define>"  :subid("64_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1123_tgt
+    .local int rx1123_pos
+    .local int rx1123_off
+    .local int rx1123_eos
+    .local int rx1123_rep
+    .local pmc rx1123_cur
+    .local pmc rx1123_debug
+    (rx1123_cur, rx1123_pos, rx1123_tgt, $I10) = self."!cursor_start"()
+    rx1123_cur."!cursor_caparray"("c_macro_args", "body")
+    getattribute rx1123_debug, rx1123_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1123_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1123_eos, rx1123_tgt
+    gt rx1123_pos, rx1123_eos, rx1123_done
+    set rx1123_off, 0
+    lt rx1123_pos, 2, rx1123_start
+    sub rx1123_off, rx1123_pos, 1
+    substr rx1123_tgt, rx1123_tgt, rx1123_off
+  rx1123_start:
+    eq $I10, 1, rx1123_restart
+    if_null rx1123_debug, debug_336
+    rx1123_cur."!cursor_debug"("START", "c_macro:sym<define>")
+  debug_336:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1125_done
+    goto rxscan1125_scan
+  rxscan1125_loop:
+    ($P10) = rx1123_cur."from"()
+    inc $P10
+    set rx1123_pos, $P10
+    ge rx1123_pos, rx1123_eos, rxscan1125_done
+  rxscan1125_scan:
+    set_addr $I10, rxscan1125_loop
+    rx1123_cur."!mark_push"(0, rx1123_pos, $I10)
+  rxscan1125_done:
+.annotate 'line', 110
+  # rxanchor bol
+    eq rx1123_pos, 0, rxanchor1126_done
+    ge rx1123_pos, rx1123_eos, rx1123_fail
+    sub $I10, rx1123_pos, rx1123_off
+    dec $I10
+    is_cclass $I11, 4096, rx1123_tgt, $I10
+    unless $I11, rx1123_fail
+  rxanchor1126_done:
+  # rx literal  "#"
+    add $I11, rx1123_pos, 1
+    gt $I11, rx1123_eos, rx1123_fail
+    sub $I11, rx1123_pos, rx1123_off
+    ord $I11, rx1123_tgt, $I11
+    ne $I11, 35, rx1123_fail
+    add rx1123_pos, 1
+  # rx enumcharlist_q negate=0  r 0..-1
+    sub $I10, rx1123_pos, rx1123_off
+    set rx1123_rep, 0
+    sub $I12, rx1123_eos, rx1123_pos
+  rxenumcharlistq1127_loop:
+    le $I12, 0, rxenumcharlistq1127_done
+    substr $S10, rx1123_tgt, $I10, 1
+    index $I11, unicode:"\t \x{a0}\u1680\u180e\u2000\u2001\u2002\u2003\u2004\u2005\u2006\u2007\u2008\u2009\u200a\u202f\u205f\u3000", $S10
+    lt $I11, 0, rxenumcharlistq1127_done
+    inc rx1123_rep
+    inc $I10
+    dec $I12
+    goto rxenumcharlistq1127_loop
+  rxenumcharlistq1127_done:
+    add rx1123_pos, rx1123_pos, rx1123_rep
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1128_fail
+    rx1123_cur."!mark_push"(0, rx1123_pos, $I10)
+  # rx literal  "define"
+    add $I11, rx1123_pos, 6
+    gt $I11, rx1123_eos, rx1123_fail
+    sub $I11, rx1123_pos, rx1123_off
+    substr $S10, rx1123_tgt, $I11, 6
+    ne $S10, "define", rx1123_fail
+    add rx1123_pos, 6
+    set_addr $I10, rxcap_1128_fail
+    ($I12, $I11) = rx1123_cur."!mark_peek"($I10)
+    rx1123_cur."!cursor_pos"($I11)
+    ($P10) = rx1123_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1123_pos, "")
+    rx1123_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1128_done
+  rxcap_1128_fail:
+    goto rx1123_fail
+  rxcap_1128_done:
+  # rx enumcharlist_q negate=0  r 1..-1
+    sub $I10, rx1123_pos, rx1123_off
+    set rx1123_rep, 0
+    sub $I12, rx1123_eos, rx1123_pos
+  rxenumcharlistq1129_loop:
+    le $I12, 0, rxenumcharlistq1129_done
+    substr $S10, rx1123_tgt, $I10, 1
+    index $I11, unicode:"\t \x{a0}\u1680\u180e\u2000\u2001\u2002\u2003\u2004\u2005\u2006\u2007\u2008\u2009\u200a\u202f\u205f\u3000", $S10
+    lt $I11, 0, rxenumcharlistq1129_done
+    inc rx1123_rep
+    inc $I10
+    dec $I12
+    goto rxenumcharlistq1129_loop
+  rxenumcharlistq1129_done:
+    lt rx1123_rep, 1, rx1123_fail
+    add rx1123_pos, rx1123_pos, rx1123_rep
+  # rx subrule "identifier" subtype=capture negate=
+    rx1123_cur."!cursor_pos"(rx1123_pos)
+    $P10 = rx1123_cur."identifier"()
+    unless $P10, rx1123_fail
+    rx1123_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("name")
+    rx1123_pos = $P10."pos"()
+  # rx rxquantr1130 ** 0..1
+    set_addr $I10, rxquantr1130_done
+    rx1123_cur."!mark_push"(0, rx1123_pos, $I10)
+  rxquantr1130_loop:
+  # rx subrule "c_macro_args" subtype=capture negate=
+    rx1123_cur."!cursor_pos"(rx1123_pos)
+    $P10 = rx1123_cur."c_macro_args"()
+    unless $P10, rx1123_fail
+    goto rxsubrule1131_pass
+  rxsubrule1131_back:
+    $P10 = $P10."!cursor_next"()
+    unless $P10, rx1123_fail
+  rxsubrule1131_pass:
+    set_addr $I10, rxsubrule1131_back
+    rx1123_cur."!mark_push"(0, rx1123_pos, $I10, $P10)
+    $P10."!cursor_names"("c_macro_args")
+    rx1123_pos = $P10."pos"()
+    set_addr $I10, rxquantr1130_done
+    (rx1123_rep) = rx1123_cur."!mark_commit"($I10)
+  rxquantr1130_done:
+  # rx rxquantr1132 ** 0..1
+    set_addr $I10, rxquantr1132_done
+    rx1123_cur."!mark_push"(0, rx1123_pos, $I10)
+  rxquantr1132_loop:
+  # rx subrule "nonl" subtype=capture negate=
+    rx1123_cur."!cursor_pos"(rx1123_pos)
+    $P10 = rx1123_cur."nonl"()
+    unless $P10, rx1123_fail
+    goto rxsubrule1133_pass
+  rxsubrule1133_back:
+    $P10 = $P10."!cursor_next"()
+    unless $P10, rx1123_fail
+  rxsubrule1133_pass:
+    set_addr $I10, rxsubrule1133_back
+    rx1123_cur."!mark_push"(0, rx1123_pos, $I10, $P10)
+    $P10."!cursor_names"("body")
+    rx1123_pos = $P10."pos"()
+    set_addr $I10, rxquantr1132_done
+    (rx1123_rep) = rx1123_cur."!mark_commit"($I10)
+  rxquantr1132_done:
+.annotate 'line', 109
+  # rx pass
+    rx1123_cur."!cursor_pass"(rx1123_pos, "c_macro:sym<define>")
+    if_null rx1123_debug, debug_337
+    rx1123_cur."!cursor_debug"("PASS", "c_macro:sym<define>", " at pos=", rx1123_pos)
+  debug_337:
+    .return (rx1123_cur)
+  rx1123_restart:
+.annotate 'line', 8
+    if_null rx1123_debug, debug_338
+    rx1123_cur."!cursor_debug"("NEXT", "c_macro:sym<define>")
+  debug_338:
+  rx1123_fail:
+    (rx1123_rep, rx1123_pos, $I10, $P10) = rx1123_cur."!mark_fail"(0)
+    lt rx1123_pos, -1, rx1123_done
+    eq rx1123_pos, -1, rx1123_fail
+    jump $I10
+  rx1123_done:
+    rx1123_cur."!cursor_fail"()
+    if_null rx1123_debug, debug_339
+    rx1123_cur."!cursor_debug"("FAIL", "c_macro:sym<define>")
+  debug_339:
+    .return (rx1123_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__c_macro:sym<define>"  :subid("65_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    new $P100, "ResizablePMCArray"
+    push $P100, "#"
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "c_macro:sym<ifdef>"  :subid("66_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1135_tgt
+    .local int rx1135_pos
+    .local int rx1135_off
+    .local int rx1135_eos
+    .local int rx1135_rep
+    .local pmc rx1135_cur
+    .local pmc rx1135_debug
+    (rx1135_cur, rx1135_pos, rx1135_tgt, $I10) = self."!cursor_start"()
+    rx1135_cur."!cursor_caparray"("else")
+    getattribute rx1135_debug, rx1135_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1135_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1135_eos, rx1135_tgt
+    gt rx1135_pos, rx1135_eos, rx1135_done
+    set rx1135_off, 0
+    lt rx1135_pos, 2, rx1135_start
+    sub rx1135_off, rx1135_pos, 1
+    substr rx1135_tgt, rx1135_tgt, rx1135_off
+  rx1135_start:
+    eq $I10, 1, rx1135_restart
+    if_null rx1135_debug, debug_340
+    rx1135_cur."!cursor_debug"("START", "c_macro:sym<ifdef>")
+  debug_340:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1137_done
+    goto rxscan1137_scan
+  rxscan1137_loop:
+    ($P10) = rx1135_cur."from"()
+    inc $P10
+    set rx1135_pos, $P10
+    ge rx1135_pos, rx1135_eos, rxscan1137_done
+  rxscan1137_scan:
+    set_addr $I10, rxscan1137_loop
+    rx1135_cur."!mark_push"(0, rx1135_pos, $I10)
+  rxscan1137_done:
+.annotate 'line', 114
+  # rxanchor bol
+    eq rx1135_pos, 0, rxanchor1138_done
+    ge rx1135_pos, rx1135_eos, rx1135_fail
+    sub $I10, rx1135_pos, rx1135_off
+    dec $I10
+    is_cclass $I11, 4096, rx1135_tgt, $I10
+    unless $I11, rx1135_fail
+  rxanchor1138_done:
+  # rx literal  "#"
+    add $I11, rx1135_pos, 1
+    gt $I11, rx1135_eos, rx1135_fail
+    sub $I11, rx1135_pos, rx1135_off
+    ord $I11, rx1135_tgt, $I11
+    ne $I11, 35, rx1135_fail
+    add rx1135_pos, 1
+  # rx enumcharlist_q negate=0  r 0..-1
+    sub $I10, rx1135_pos, rx1135_off
+    set rx1135_rep, 0
+    sub $I12, rx1135_eos, rx1135_pos
+  rxenumcharlistq1139_loop:
+    le $I12, 0, rxenumcharlistq1139_done
+    substr $S10, rx1135_tgt, $I10, 1
+    index $I11, unicode:"\t \x{a0}\u1680\u180e\u2000\u2001\u2002\u2003\u2004\u2005\u2006\u2007\u2008\u2009\u200a\u202f\u205f\u3000", $S10
+    lt $I11, 0, rxenumcharlistq1139_done
+    inc rx1135_rep
+    inc $I10
+    dec $I12
+    goto rxenumcharlistq1139_loop
+  rxenumcharlistq1139_done:
+    add rx1135_pos, rx1135_pos, rx1135_rep
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1140_fail
+    rx1135_cur."!mark_push"(0, rx1135_pos, $I10)
+  # rx literal  "ifdef"
+    add $I11, rx1135_pos, 5
+    gt $I11, rx1135_eos, rx1135_fail
+    sub $I11, rx1135_pos, rx1135_off
+    substr $S10, rx1135_tgt, $I11, 5
+    ne $S10, "ifdef", rx1135_fail
+    add rx1135_pos, 5
+    set_addr $I10, rxcap_1140_fail
+    ($I12, $I11) = rx1135_cur."!mark_peek"($I10)
+    rx1135_cur."!cursor_pos"($I11)
+    ($P10) = rx1135_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1135_pos, "")
+    rx1135_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1140_done
+  rxcap_1140_fail:
+    goto rx1135_fail
+  rxcap_1140_done:
+  # rx enumcharlist_q negate=0  r 1..-1
+    sub $I10, rx1135_pos, rx1135_off
+    set rx1135_rep, 0
+    sub $I12, rx1135_eos, rx1135_pos
+  rxenumcharlistq1141_loop:
+    le $I12, 0, rxenumcharlistq1141_done
+    substr $S10, rx1135_tgt, $I10, 1
+    index $I11, unicode:"\t \x{a0}\u1680\u180e\u2000\u2001\u2002\u2003\u2004\u2005\u2006\u2007\u2008\u2009\u200a\u202f\u205f\u3000", $S10
+    lt $I11, 0, rxenumcharlistq1141_done
+    inc rx1135_rep
+    inc $I10
+    dec $I12
+    goto rxenumcharlistq1141_loop
+  rxenumcharlistq1141_done:
+    lt rx1135_rep, 1, rx1135_fail
+    add rx1135_pos, rx1135_pos, rx1135_rep
+  # rx subrule "identifier" subtype=capture negate=
+    rx1135_cur."!cursor_pos"(rx1135_pos)
+    $P10 = rx1135_cur."identifier"()
+    unless $P10, rx1135_fail
+    rx1135_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("name")
+    rx1135_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1135_cur."!cursor_pos"(rx1135_pos)
+    $P10 = rx1135_cur."ws"()
+    unless $P10, rx1135_fail
+    rx1135_pos = $P10."pos"()
+.annotate 'line', 115
+  # rx subrule "mixed_content" subtype=capture negate=
+    rx1135_cur."!cursor_pos"(rx1135_pos)
+    $P10 = rx1135_cur."mixed_content"()
+    unless $P10, rx1135_fail
+    rx1135_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("then")
+    rx1135_pos = $P10."pos"()
+.annotate 'line', 118
+  # rx rxquantr1142 ** 0..1
+    set_addr $I10, rxquantr1142_done
+    rx1135_cur."!mark_push"(0, rx1135_pos, $I10)
+  rxquantr1142_loop:
+.annotate 'line', 117
+  # rxanchor bol
+    eq rx1135_pos, 0, rxanchor1143_done
+    ge rx1135_pos, rx1135_eos, rx1135_fail
+    sub $I10, rx1135_pos, rx1135_off
+    dec $I10
+    is_cclass $I11, 4096, rx1135_tgt, $I10
+    unless $I11, rx1135_fail
+  rxanchor1143_done:
+  # rx literal  "#else"
+    add $I11, rx1135_pos, 5
+    gt $I11, rx1135_eos, rx1135_fail
+    sub $I11, rx1135_pos, rx1135_off
+    substr $S10, rx1135_tgt, $I11, 5
+    ne $S10, "#else", rx1135_fail
+    add rx1135_pos, 5
+  # rx subrule "mixed_content" subtype=capture negate=
+    rx1135_cur."!cursor_pos"(rx1135_pos)
+    $P10 = rx1135_cur."mixed_content"()
+    unless $P10, rx1135_fail
+    rx1135_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("else")
+    rx1135_pos = $P10."pos"()
+.annotate 'line', 118
+    set_addr $I10, rxquantr1142_done
+    (rx1135_rep) = rx1135_cur."!mark_commit"($I10)
+  rxquantr1142_done:
+.annotate 'line', 119
+  # rxanchor bol
+    eq rx1135_pos, 0, rxanchor1144_done
+    ge rx1135_pos, rx1135_eos, rx1135_fail
+    sub $I10, rx1135_pos, rx1135_off
+    dec $I10
+    is_cclass $I11, 4096, rx1135_tgt, $I10
+    unless $I11, rx1135_fail
+  rxanchor1144_done:
+  # rx literal  "#endif"
+    add $I11, rx1135_pos, 6
+    gt $I11, rx1135_eos, rx1135_fail
+    sub $I11, rx1135_pos, rx1135_off
+    substr $S10, rx1135_tgt, $I11, 6
+    ne $S10, "#endif", rx1135_fail
+    add rx1135_pos, 6
+.annotate 'line', 113
+  # rx pass
+    rx1135_cur."!cursor_pass"(rx1135_pos, "c_macro:sym<ifdef>")
+    if_null rx1135_debug, debug_341
+    rx1135_cur."!cursor_debug"("PASS", "c_macro:sym<ifdef>", " at pos=", rx1135_pos)
+  debug_341:
+    .return (rx1135_cur)
+  rx1135_restart:
+.annotate 'line', 8
+    if_null rx1135_debug, debug_342
+    rx1135_cur."!cursor_debug"("NEXT", "c_macro:sym<ifdef>")
+  debug_342:
+  rx1135_fail:
+    (rx1135_rep, rx1135_pos, $I10, $P10) = rx1135_cur."!mark_fail"(0)
+    lt rx1135_pos, -1, rx1135_done
+    eq rx1135_pos, -1, rx1135_fail
+    jump $I10
+  rx1135_done:
+    rx1135_cur."!cursor_fail"()
+    if_null rx1135_debug, debug_343
+    rx1135_cur."!cursor_debug"("FAIL", "c_macro:sym<ifdef>")
+  debug_343:
+    .return (rx1135_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__c_macro:sym<ifdef>"  :subid("67_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    new $P100, "ResizablePMCArray"
+    push $P100, "#"
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "c_macro:sym<if>"  :subid("68_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1146_tgt
+    .local int rx1146_pos
+    .local int rx1146_off
+    .local int rx1146_eos
+    .local int rx1146_rep
+    .local pmc rx1146_cur
+    .local pmc rx1146_debug
+    (rx1146_cur, rx1146_pos, rx1146_tgt, $I10) = self."!cursor_start"()
+    rx1146_cur."!cursor_caparray"("else")
+    getattribute rx1146_debug, rx1146_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1146_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1146_eos, rx1146_tgt
+    gt rx1146_pos, rx1146_eos, rx1146_done
+    set rx1146_off, 0
+    lt rx1146_pos, 2, rx1146_start
+    sub rx1146_off, rx1146_pos, 1
+    substr rx1146_tgt, rx1146_tgt, rx1146_off
+  rx1146_start:
+    eq $I10, 1, rx1146_restart
+    if_null rx1146_debug, debug_344
+    rx1146_cur."!cursor_debug"("START", "c_macro:sym<if>")
+  debug_344:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1148_done
+    goto rxscan1148_scan
+  rxscan1148_loop:
+    ($P10) = rx1146_cur."from"()
+    inc $P10
+    set rx1146_pos, $P10
+    ge rx1146_pos, rx1146_eos, rxscan1148_done
+  rxscan1148_scan:
+    set_addr $I10, rxscan1148_loop
+    rx1146_cur."!mark_push"(0, rx1146_pos, $I10)
+  rxscan1148_done:
+.annotate 'line', 123
+  # rxanchor bol
+    eq rx1146_pos, 0, rxanchor1149_done
+    ge rx1146_pos, rx1146_eos, rx1146_fail
+    sub $I10, rx1146_pos, rx1146_off
+    dec $I10
+    is_cclass $I11, 4096, rx1146_tgt, $I10
+    unless $I11, rx1146_fail
+  rxanchor1149_done:
+  # rx literal  "#"
+    add $I11, rx1146_pos, 1
+    gt $I11, rx1146_eos, rx1146_fail
+    sub $I11, rx1146_pos, rx1146_off
+    ord $I11, rx1146_tgt, $I11
+    ne $I11, 35, rx1146_fail
+    add rx1146_pos, 1
+  # rx enumcharlist_q negate=0  r 0..-1
+    sub $I10, rx1146_pos, rx1146_off
+    set rx1146_rep, 0
+    sub $I12, rx1146_eos, rx1146_pos
+  rxenumcharlistq1150_loop:
+    le $I12, 0, rxenumcharlistq1150_done
+    substr $S10, rx1146_tgt, $I10, 1
+    index $I11, unicode:"\t \x{a0}\u1680\u180e\u2000\u2001\u2002\u2003\u2004\u2005\u2006\u2007\u2008\u2009\u200a\u202f\u205f\u3000", $S10
+    lt $I11, 0, rxenumcharlistq1150_done
+    inc rx1146_rep
+    inc $I10
+    dec $I12
+    goto rxenumcharlistq1150_loop
+  rxenumcharlistq1150_done:
+    add rx1146_pos, rx1146_pos, rx1146_rep
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1151_fail
+    rx1146_cur."!mark_push"(0, rx1146_pos, $I10)
+  # rx literal  "if"
+    add $I11, rx1146_pos, 2
+    gt $I11, rx1146_eos, rx1146_fail
+    sub $I11, rx1146_pos, rx1146_off
+    substr $S10, rx1146_tgt, $I11, 2
+    ne $S10, "if", rx1146_fail
+    add rx1146_pos, 2
+    set_addr $I10, rxcap_1151_fail
+    ($I12, $I11) = rx1146_cur."!mark_peek"($I10)
+    rx1146_cur."!cursor_pos"($I11)
+    ($P10) = rx1146_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1146_pos, "")
+    rx1146_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1151_done
+  rxcap_1151_fail:
+    goto rx1146_fail
+  rxcap_1151_done:
+  # rx enumcharlist_q negate=0  r 1..-1
+    sub $I10, rx1146_pos, rx1146_off
+    set rx1146_rep, 0
+    sub $I12, rx1146_eos, rx1146_pos
+  rxenumcharlistq1152_loop:
+    le $I12, 0, rxenumcharlistq1152_done
+    substr $S10, rx1146_tgt, $I10, 1
+    index $I11, unicode:"\t \x{a0}\u1680\u180e\u2000\u2001\u2002\u2003\u2004\u2005\u2006\u2007\u2008\u2009\u200a\u202f\u205f\u3000", $S10
+    lt $I11, 0, rxenumcharlistq1152_done
+    inc rx1146_rep
+    inc $I10
+    dec $I12
+    goto rxenumcharlistq1152_loop
+  rxenumcharlistq1152_done:
+    lt rx1146_rep, 1, rx1146_fail
+    add rx1146_pos, rx1146_pos, rx1146_rep
+  # rx subrule "nonl" subtype=capture negate=
+    rx1146_cur."!cursor_pos"(rx1146_pos)
+    $P10 = rx1146_cur."nonl"()
+    unless $P10, rx1146_fail
+    rx1146_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("condition")
+    rx1146_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1146_cur."!cursor_pos"(rx1146_pos)
+    $P10 = rx1146_cur."ws"()
+    unless $P10, rx1146_fail
+    rx1146_pos = $P10."pos"()
+.annotate 'line', 124
+  # rx subrule "mixed_content" subtype=capture negate=
+    rx1146_cur."!cursor_pos"(rx1146_pos)
+    $P10 = rx1146_cur."mixed_content"()
+    unless $P10, rx1146_fail
+    rx1146_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("then")
+    rx1146_pos = $P10."pos"()
+.annotate 'line', 127
+  # rx rxquantr1153 ** 0..1
+    set_addr $I10, rxquantr1153_done
+    rx1146_cur."!mark_push"(0, rx1146_pos, $I10)
+  rxquantr1153_loop:
+.annotate 'line', 126
+  # rxanchor bol
+    eq rx1146_pos, 0, rxanchor1154_done
+    ge rx1146_pos, rx1146_eos, rx1146_fail
+    sub $I10, rx1146_pos, rx1146_off
+    dec $I10
+    is_cclass $I11, 4096, rx1146_tgt, $I10
+    unless $I11, rx1146_fail
+  rxanchor1154_done:
+  # rx literal  "#else"
+    add $I11, rx1146_pos, 5
+    gt $I11, rx1146_eos, rx1146_fail
+    sub $I11, rx1146_pos, rx1146_off
+    substr $S10, rx1146_tgt, $I11, 5
+    ne $S10, "#else", rx1146_fail
+    add rx1146_pos, 5
+  # rx subrule "mixed_content" subtype=capture negate=
+    rx1146_cur."!cursor_pos"(rx1146_pos)
+    $P10 = rx1146_cur."mixed_content"()
+    unless $P10, rx1146_fail
+    rx1146_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("else")
+    rx1146_pos = $P10."pos"()
+.annotate 'line', 127
+    set_addr $I10, rxquantr1153_done
+    (rx1146_rep) = rx1146_cur."!mark_commit"($I10)
+  rxquantr1153_done:
+.annotate 'line', 128
+  # rxanchor bol
+    eq rx1146_pos, 0, rxanchor1155_done
+    ge rx1146_pos, rx1146_eos, rx1146_fail
+    sub $I10, rx1146_pos, rx1146_off
+    dec $I10
+    is_cclass $I11, 4096, rx1146_tgt, $I10
+    unless $I11, rx1146_fail
+  rxanchor1155_done:
+  # rx literal  "#endif"
+    add $I11, rx1146_pos, 6
+    gt $I11, rx1146_eos, rx1146_fail
+    sub $I11, rx1146_pos, rx1146_off
+    substr $S10, rx1146_tgt, $I11, 6
+    ne $S10, "#endif", rx1146_fail
+    add rx1146_pos, 6
+.annotate 'line', 122
+  # rx pass
+    rx1146_cur."!cursor_pass"(rx1146_pos, "c_macro:sym<if>")
+    if_null rx1146_debug, debug_345
+    rx1146_cur."!cursor_debug"("PASS", "c_macro:sym<if>", " at pos=", rx1146_pos)
+  debug_345:
+    .return (rx1146_cur)
+  rx1146_restart:
+.annotate 'line', 8
+    if_null rx1146_debug, debug_346
+    rx1146_cur."!cursor_debug"("NEXT", "c_macro:sym<if>")
+  debug_346:
+  rx1146_fail:
+    (rx1146_rep, rx1146_pos, $I10, $P10) = rx1146_cur."!mark_fail"(0)
+    lt rx1146_pos, -1, rx1146_done
+    eq rx1146_pos, -1, rx1146_fail
+    jump $I10
+  rx1146_done:
+    rx1146_cur."!cursor_fail"()
+    if_null rx1146_debug, debug_347
+    rx1146_cur."!cursor_debug"("FAIL", "c_macro:sym<if>")
+  debug_347:
+    .return (rx1146_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__c_macro:sym<if>"  :subid("69_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    new $P100, "ResizablePMCArray"
+    push $P100, "#"
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "c_macro_args"  :subid("70_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1157_tgt
+    .local int rx1157_pos
+    .local int rx1157_off
+    .local int rx1157_eos
+    .local int rx1157_rep
+    .local pmc rx1157_cur
+    .local pmc rx1157_debug
+    (rx1157_cur, rx1157_pos, rx1157_tgt, $I10) = self."!cursor_start"()
+    rx1157_cur."!cursor_caparray"("arg")
+    getattribute rx1157_debug, rx1157_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1157_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1157_eos, rx1157_tgt
+    gt rx1157_pos, rx1157_eos, rx1157_done
+    set rx1157_off, 0
+    lt rx1157_pos, 2, rx1157_start
+    sub rx1157_off, rx1157_pos, 1
+    substr rx1157_tgt, rx1157_tgt, rx1157_off
+  rx1157_start:
+    eq $I10, 1, rx1157_restart
+    if_null rx1157_debug, debug_348
+    rx1157_cur."!cursor_debug"("START", "c_macro_args")
+  debug_348:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1159_done
+    goto rxscan1159_scan
+  rxscan1159_loop:
+    ($P10) = rx1157_cur."from"()
+    inc $P10
+    set rx1157_pos, $P10
+    ge rx1157_pos, rx1157_eos, rxscan1159_done
+  rxscan1159_scan:
+    set_addr $I10, rxscan1159_loop
+    rx1157_cur."!mark_push"(0, rx1157_pos, $I10)
+  rxscan1159_done:
+.annotate 'line', 133
+  # rx literal  "("
+    add $I11, rx1157_pos, 1
+    gt $I11, rx1157_eos, rx1157_fail
+    sub $I11, rx1157_pos, rx1157_off
+    ord $I11, rx1157_tgt, $I11
+    ne $I11, 40, rx1157_fail
+    add rx1157_pos, 1
+  # rx enumcharlist_q negate=0  r 0..-1
+    sub $I10, rx1157_pos, rx1157_off
+    set rx1157_rep, 0
+    sub $I12, rx1157_eos, rx1157_pos
+  rxenumcharlistq1160_loop:
+    le $I12, 0, rxenumcharlistq1160_done
+    substr $S10, rx1157_tgt, $I10, 1
+    index $I11, unicode:"\t \x{a0}\u1680\u180e\u2000\u2001\u2002\u2003\u2004\u2005\u2006\u2007\u2008\u2009\u200a\u202f\u205f\u3000", $S10
+    lt $I11, 0, rxenumcharlistq1160_done
+    inc rx1157_rep
+    inc $I10
+    dec $I12
+    goto rxenumcharlistq1160_loop
+  rxenumcharlistq1160_done:
+    add rx1157_pos, rx1157_pos, rx1157_rep
+  # rx rxquantr1161 ** 0..1
+    set_addr $I10, rxquantr1161_done
+    rx1157_cur."!mark_push"(0, rx1157_pos, $I10)
+  rxquantr1161_loop:
+  # rx subrule "identifier" subtype=capture negate=
+    rx1157_cur."!cursor_pos"(rx1157_pos)
+    $P10 = rx1157_cur."identifier"()
+    unless $P10, rx1157_fail
+    goto rxsubrule1162_pass
+  rxsubrule1162_back:
+    $P10 = $P10."!cursor_next"()
+    unless $P10, rx1157_fail
+  rxsubrule1162_pass:
+    set_addr $I10, rxsubrule1162_back
+    rx1157_cur."!mark_push"(0, rx1157_pos, $I10, $P10)
+    $P10."!cursor_names"("arg")
+    rx1157_pos = $P10."pos"()
+    set_addr $I10, rxquantr1161_done
+    (rx1157_rep) = rx1157_cur."!mark_commit"($I10)
+  rxquantr1161_done:
+  # rx rxquantr1163 ** 0..*
+    set_addr $I10, rxquantr1163_done
+    rx1157_cur."!mark_push"(0, rx1157_pos, $I10)
+  rxquantr1163_loop:
+  # rx enumcharlist_q negate=0  r 0..-1
+    sub $I10, rx1157_pos, rx1157_off
+    set rx1157_rep, 0
+    sub $I12, rx1157_eos, rx1157_pos
+  rxenumcharlistq1164_loop:
+    le $I12, 0, rxenumcharlistq1164_done
+    substr $S10, rx1157_tgt, $I10, 1
+    index $I11, unicode:"\t \x{a0}\u1680\u180e\u2000\u2001\u2002\u2003\u2004\u2005\u2006\u2007\u2008\u2009\u200a\u202f\u205f\u3000", $S10
+    lt $I11, 0, rxenumcharlistq1164_done
+    inc rx1157_rep
+    inc $I10
+    dec $I12
+    goto rxenumcharlistq1164_loop
+  rxenumcharlistq1164_done:
+    add rx1157_pos, rx1157_pos, rx1157_rep
+  # rx literal  ","
+    add $I11, rx1157_pos, 1
+    gt $I11, rx1157_eos, rx1157_fail
+    sub $I11, rx1157_pos, rx1157_off
+    ord $I11, rx1157_tgt, $I11
+    ne $I11, 44, rx1157_fail
+    add rx1157_pos, 1
+  # rx enumcharlist_q negate=0  r 0..-1
+    sub $I10, rx1157_pos, rx1157_off
+    set rx1157_rep, 0
+    sub $I12, rx1157_eos, rx1157_pos
+  rxenumcharlistq1165_loop:
+    le $I12, 0, rxenumcharlistq1165_done
+    substr $S10, rx1157_tgt, $I10, 1
+    index $I11, unicode:"\t \x{a0}\u1680\u180e\u2000\u2001\u2002\u2003\u2004\u2005\u2006\u2007\u2008\u2009\u200a\u202f\u205f\u3000", $S10
+    lt $I11, 0, rxenumcharlistq1165_done
+    inc rx1157_rep
+    inc $I10
+    dec $I12
+    goto rxenumcharlistq1165_loop
+  rxenumcharlistq1165_done:
+    add rx1157_pos, rx1157_pos, rx1157_rep
+  # rx subrule "identifier" subtype=capture negate=
+    rx1157_cur."!cursor_pos"(rx1157_pos)
+    $P10 = rx1157_cur."identifier"()
+    unless $P10, rx1157_fail
+    rx1157_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("arg")
+    rx1157_pos = $P10."pos"()
+    set_addr $I10, rxquantr1163_done
+    (rx1157_rep) = rx1157_cur."!mark_commit"($I10)
+    set_addr $I10, rxquantr1163_done
+    rx1157_cur."!mark_push"(rx1157_rep, rx1157_pos, $I10)
+    goto rxquantr1163_loop
+  rxquantr1163_done:
+  # rx enumcharlist_q negate=0  r 0..-1
+    sub $I10, rx1157_pos, rx1157_off
+    set rx1157_rep, 0
+    sub $I12, rx1157_eos, rx1157_pos
+  rxenumcharlistq1166_loop:
+    le $I12, 0, rxenumcharlistq1166_done
+    substr $S10, rx1157_tgt, $I10, 1
+    index $I11, unicode:"\t \x{a0}\u1680\u180e\u2000\u2001\u2002\u2003\u2004\u2005\u2006\u2007\u2008\u2009\u200a\u202f\u205f\u3000", $S10
+    lt $I11, 0, rxenumcharlistq1166_done
+    inc rx1157_rep
+    inc $I10
+    dec $I12
+    goto rxenumcharlistq1166_loop
+  rxenumcharlistq1166_done:
+    add rx1157_pos, rx1157_pos, rx1157_rep
+  # rx literal  ")"
+    add $I11, rx1157_pos, 1
+    gt $I11, rx1157_eos, rx1157_fail
+    sub $I11, rx1157_pos, rx1157_off
+    ord $I11, rx1157_tgt, $I11
+    ne $I11, 41, rx1157_fail
+    add rx1157_pos, 1
+.annotate 'line', 132
+  # rx pass
+    rx1157_cur."!cursor_pass"(rx1157_pos, "c_macro_args")
+    if_null rx1157_debug, debug_349
+    rx1157_cur."!cursor_debug"("PASS", "c_macro_args", " at pos=", rx1157_pos)
+  debug_349:
+    .return (rx1157_cur)
+  rx1157_restart:
+.annotate 'line', 8
+    if_null rx1157_debug, debug_350
+    rx1157_cur."!cursor_debug"("NEXT", "c_macro_args")
+  debug_350:
+  rx1157_fail:
+    (rx1157_rep, rx1157_pos, $I10, $P10) = rx1157_cur."!mark_fail"(0)
+    lt rx1157_pos, -1, rx1157_done
+    eq rx1157_pos, -1, rx1157_fail
+    jump $I10
+  rx1157_done:
+    rx1157_cur."!cursor_fail"()
+    if_null rx1157_debug, debug_351
+    rx1157_cur."!cursor_debug"("FAIL", "c_macro_args")
+  debug_351:
+    .return (rx1157_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__c_macro_args"  :subid("71_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    new $P100, "ResizablePMCArray"
+    push $P100, "("
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "nonl"  :subid("72_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1168_tgt
+    .local int rx1168_pos
+    .local int rx1168_off
+    .local int rx1168_eos
+    .local int rx1168_rep
+    .local pmc rx1168_cur
+    .local pmc rx1168_debug
+    (rx1168_cur, rx1168_pos, rx1168_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1168_debug, rx1168_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1168_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1168_eos, rx1168_tgt
+    gt rx1168_pos, rx1168_eos, rx1168_done
+    set rx1168_off, 0
+    lt rx1168_pos, 2, rx1168_start
+    sub rx1168_off, rx1168_pos, 1
+    substr rx1168_tgt, rx1168_tgt, rx1168_off
+  rx1168_start:
+    eq $I10, 1, rx1168_restart
+    if_null rx1168_debug, debug_352
+    rx1168_cur."!cursor_debug"("START", "nonl")
+  debug_352:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1170_done
+    goto rxscan1170_scan
+  rxscan1170_loop:
+    ($P10) = rx1168_cur."from"()
+    inc $P10
+    set rx1168_pos, $P10
+    ge rx1168_pos, rx1168_eos, rxscan1170_done
+  rxscan1170_scan:
+    set_addr $I10, rxscan1170_loop
+    rx1168_cur."!mark_push"(0, rx1168_pos, $I10)
+  rxscan1170_done:
+.annotate 'line', 137
+  # rx charclass_q N r 1..-1
+    sub $I10, rx1168_pos, rx1168_off
+    find_cclass $I11, 4096, rx1168_tgt, $I10, rx1168_eos
+    add $I12, $I10, 1
+    lt $I11, $I12, rx1168_fail
+    add rx1168_pos, rx1168_off, $I11
+.annotate 'line', 136
+  # rx pass
+    rx1168_cur."!cursor_pass"(rx1168_pos, "nonl")
+    if_null rx1168_debug, debug_353
+    rx1168_cur."!cursor_debug"("PASS", "nonl", " at pos=", rx1168_pos)
+  debug_353:
+    .return (rx1168_cur)
+  rx1168_restart:
+.annotate 'line', 8
+    if_null rx1168_debug, debug_354
+    rx1168_cur."!cursor_debug"("NEXT", "nonl")
+  debug_354:
+  rx1168_fail:
+    (rx1168_rep, rx1168_pos, $I10, $P10) = rx1168_cur."!mark_fail"(0)
+    lt rx1168_pos, -1, rx1168_done
+    eq rx1168_pos, -1, rx1168_fail
+    jump $I10
+  rx1168_done:
+    rx1168_cur."!cursor_fail"()
+    if_null rx1168_debug, debug_355
+    rx1168_cur."!cursor_debug"("FAIL", "nonl")
+  debug_355:
+    .return (rx1168_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__nonl"  :subid("73_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    new $P100, "ResizablePMCArray"
+    push $P100, ""
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "identifier"  :subid("74_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1172_tgt
+    .local int rx1172_pos
+    .local int rx1172_off
+    .local int rx1172_eos
+    .local int rx1172_rep
+    .local pmc rx1172_cur
+    .local pmc rx1172_debug
+    (rx1172_cur, rx1172_pos, rx1172_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1172_debug, rx1172_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1172_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1172_eos, rx1172_tgt
+    gt rx1172_pos, rx1172_eos, rx1172_done
+    set rx1172_off, 0
+    lt rx1172_pos, 2, rx1172_start
+    sub rx1172_off, rx1172_pos, 1
+    substr rx1172_tgt, rx1172_tgt, rx1172_off
+  rx1172_start:
+    eq $I10, 1, rx1172_restart
+    if_null rx1172_debug, debug_356
+    rx1172_cur."!cursor_debug"("START", "identifier")
+  debug_356:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1174_done
+    goto rxscan1174_scan
+  rxscan1174_loop:
+    ($P10) = rx1172_cur."from"()
+    inc $P10
+    set rx1172_pos, $P10
+    ge rx1172_pos, rx1172_eos, rxscan1174_done
+  rxscan1174_scan:
+    set_addr $I10, rxscan1174_loop
+    rx1172_cur."!mark_push"(0, rx1172_pos, $I10)
+  rxscan1174_done:
+.annotate 'line', 142
+  # rx subrule "keyword" subtype=zerowidth negate=1
+    rx1172_cur."!cursor_pos"(rx1172_pos)
+    $P10 = rx1172_cur."keyword"()
+    if $P10, rx1172_fail
+  # rx subrule "ident" subtype=capture negate=
+    rx1172_cur."!cursor_pos"(rx1172_pos)
+    $P10 = rx1172_cur."ident"()
+    unless $P10, rx1172_fail
+    rx1172_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("ident")
+    rx1172_pos = $P10."pos"()
+.annotate 'line', 141
+  # rx pass
+    rx1172_cur."!cursor_pass"(rx1172_pos, "identifier")
+    if_null rx1172_debug, debug_357
+    rx1172_cur."!cursor_debug"("PASS", "identifier", " at pos=", rx1172_pos)
+  debug_357:
+    .return (rx1172_cur)
+  rx1172_restart:
+.annotate 'line', 8
+    if_null rx1172_debug, debug_358
+    rx1172_cur."!cursor_debug"("NEXT", "identifier")
+  debug_358:
+  rx1172_fail:
+    (rx1172_rep, rx1172_pos, $I10, $P10) = rx1172_cur."!mark_fail"(0)
+    lt rx1172_pos, -1, rx1172_done
+    eq rx1172_pos, -1, rx1172_fail
+    jump $I10
+  rx1172_done:
+    rx1172_cur."!cursor_fail"()
+    if_null rx1172_debug, debug_359
+    rx1172_cur."!cursor_debug"("FAIL", "identifier")
+  debug_359:
+    .return (rx1172_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__identifier"  :subid("75_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    new $P100, "ResizablePMCArray"
+    push $P100, ""
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "keyword"  :subid("76_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1176_tgt
+    .local int rx1176_pos
+    .local int rx1176_off
+    .local int rx1176_eos
+    .local int rx1176_rep
+    .local pmc rx1176_cur
+    .local pmc rx1176_debug
+    (rx1176_cur, rx1176_pos, rx1176_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1176_debug, rx1176_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1176_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1176_eos, rx1176_tgt
+    gt rx1176_pos, rx1176_eos, rx1176_done
+    set rx1176_off, 0
+    lt rx1176_pos, 2, rx1176_start
+    sub rx1176_off, rx1176_pos, 1
+    substr rx1176_tgt, rx1176_tgt, rx1176_off
+  rx1176_start:
+    eq $I10, 1, rx1176_restart
+    if_null rx1176_debug, debug_360
+    rx1176_cur."!cursor_debug"("START", "keyword")
+  debug_360:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1178_done
+    goto rxscan1178_scan
+  rxscan1178_loop:
+    ($P10) = rx1176_cur."from"()
+    inc $P10
+    set rx1176_pos, $P10
+    ge rx1176_pos, rx1176_eos, rxscan1178_done
+  rxscan1178_scan:
+    set_addr $I10, rxscan1178_loop
+    rx1176_cur."!mark_push"(0, rx1176_pos, $I10)
+  rxscan1178_done:
+  alt1179_0:
+.annotate 'line', 146
+    set_addr $I10, alt1179_1
+    rx1176_cur."!mark_push"(0, rx1176_pos, $I10)
+.annotate 'line', 147
+  # rx literal  "for"
+    add $I11, rx1176_pos, 3
+    gt $I11, rx1176_eos, rx1176_fail
+    sub $I11, rx1176_pos, rx1176_off
+    substr $S10, rx1176_tgt, $I11, 3
+    ne $S10, "for", rx1176_fail
+    add rx1176_pos, 3
+    goto alt1179_end
+  alt1179_1:
+    set_addr $I10, alt1179_2
+    rx1176_cur."!mark_push"(0, rx1176_pos, $I10)
+  # rx literal  "while"
+    add $I11, rx1176_pos, 5
+    gt $I11, rx1176_eos, rx1176_fail
+    sub $I11, rx1176_pos, rx1176_off
+    substr $S10, rx1176_tgt, $I11, 5
+    ne $S10, "while", rx1176_fail
+    add rx1176_pos, 5
+    goto alt1179_end
+  alt1179_2:
+    set_addr $I10, alt1179_3
+    rx1176_cur."!mark_push"(0, rx1176_pos, $I10)
+  # rx literal  "do"
+    add $I11, rx1176_pos, 2
+    gt $I11, rx1176_eos, rx1176_fail
+    sub $I11, rx1176_pos, rx1176_off
+    substr $S10, rx1176_tgt, $I11, 2
+    ne $S10, "do", rx1176_fail
+    add rx1176_pos, 2
+    goto alt1179_end
+  alt1179_3:
+    set_addr $I10, alt1179_4
+    rx1176_cur."!mark_push"(0, rx1176_pos, $I10)
+.annotate 'line', 148
+  # rx literal  "if"
+    add $I11, rx1176_pos, 2
+    gt $I11, rx1176_eos, rx1176_fail
+    sub $I11, rx1176_pos, rx1176_off
+    substr $S10, rx1176_tgt, $I11, 2
+    ne $S10, "if", rx1176_fail
+    add rx1176_pos, 2
+    goto alt1179_end
+  alt1179_4:
+    set_addr $I10, alt1179_5
+    rx1176_cur."!mark_push"(0, rx1176_pos, $I10)
+  # rx literal  "else"
+    add $I11, rx1176_pos, 4
+    gt $I11, rx1176_eos, rx1176_fail
+    sub $I11, rx1176_pos, rx1176_off
+    substr $S10, rx1176_tgt, $I11, 4
+    ne $S10, "else", rx1176_fail
+    add rx1176_pos, 4
+    goto alt1179_end
+  alt1179_5:
+    set_addr $I10, alt1179_6
+    rx1176_cur."!mark_push"(0, rx1176_pos, $I10)
+.annotate 'line', 149
+  # rx literal  "case"
+    add $I11, rx1176_pos, 4
+    gt $I11, rx1176_eos, rx1176_fail
+    sub $I11, rx1176_pos, rx1176_off
+    substr $S10, rx1176_tgt, $I11, 4
+    ne $S10, "case", rx1176_fail
+    add rx1176_pos, 4
+    goto alt1179_end
+  alt1179_6:
+    set_addr $I10, alt1179_7
+    rx1176_cur."!mark_push"(0, rx1176_pos, $I10)
+  # rx literal  "default"
+    add $I11, rx1176_pos, 7
+    gt $I11, rx1176_eos, rx1176_fail
+    sub $I11, rx1176_pos, rx1176_off
+    substr $S10, rx1176_tgt, $I11, 7
+    ne $S10, "default", rx1176_fail
+    add rx1176_pos, 7
+    goto alt1179_end
+  alt1179_7:
+    set_addr $I10, alt1179_8
+    rx1176_cur."!mark_push"(0, rx1176_pos, $I10)
+.annotate 'line', 150
+  # rx literal  "break"
+    add $I11, rx1176_pos, 5
+    gt $I11, rx1176_eos, rx1176_fail
+    sub $I11, rx1176_pos, rx1176_off
+    substr $S10, rx1176_tgt, $I11, 5
+    ne $S10, "break", rx1176_fail
+    add rx1176_pos, 5
+    goto alt1179_end
+  alt1179_8:
+    set_addr $I10, alt1179_9
+    rx1176_cur."!mark_push"(0, rx1176_pos, $I10)
+  # rx literal  "return"
+    add $I11, rx1176_pos, 6
+    gt $I11, rx1176_eos, rx1176_fail
+    sub $I11, rx1176_pos, rx1176_off
+    substr $S10, rx1176_tgt, $I11, 6
+    ne $S10, "return", rx1176_fail
+    add rx1176_pos, 6
+    goto alt1179_end
+  alt1179_9:
+    set_addr $I10, alt1179_10
+    rx1176_cur."!mark_push"(0, rx1176_pos, $I10)
+  # rx literal  "continue"
+    add $I11, rx1176_pos, 8
+    gt $I11, rx1176_eos, rx1176_fail
+    sub $I11, rx1176_pos, rx1176_off
+    substr $S10, rx1176_tgt, $I11, 8
+    ne $S10, "continue", rx1176_fail
+    add rx1176_pos, 8
+    goto alt1179_end
+  alt1179_10:
+    set_addr $I10, alt1179_11
+    rx1176_cur."!mark_push"(0, rx1176_pos, $I10)
+.annotate 'line', 151
+  # rx literal  "goto"
+    add $I11, rx1176_pos, 4
+    gt $I11, rx1176_eos, rx1176_fail
+    sub $I11, rx1176_pos, rx1176_off
+    substr $S10, rx1176_tgt, $I11, 4
+    ne $S10, "goto", rx1176_fail
+    add rx1176_pos, 4
+    goto alt1179_end
+  alt1179_11:
+    set_addr $I10, alt1179_12
+    rx1176_cur."!mark_push"(0, rx1176_pos, $I10)
+  # rx literal  "expr"
+    add $I11, rx1176_pos, 4
+    gt $I11, rx1176_eos, rx1176_fail
+    sub $I11, rx1176_pos, rx1176_off
+    substr $S10, rx1176_tgt, $I11, 4
+    ne $S10, "expr", rx1176_fail
+    add rx1176_pos, 4
+    goto alt1179_end
+  alt1179_12:
+    set_addr $I10, alt1179_13
+    rx1176_cur."!mark_push"(0, rx1176_pos, $I10)
+  # rx literal  "restart"
+    add $I11, rx1176_pos, 7
+    gt $I11, rx1176_eos, rx1176_fail
+    sub $I11, rx1176_pos, rx1176_off
+    substr $S10, rx1176_tgt, $I11, 7
+    ne $S10, "restart", rx1176_fail
+    add rx1176_pos, 7
+    goto alt1179_end
+  alt1179_13:
+    set_addr $I10, alt1179_14
+    rx1176_cur."!mark_push"(0, rx1176_pos, $I10)
+.annotate 'line', 152
+  # rx literal  "OFFSET"
+    add $I11, rx1176_pos, 6
+    gt $I11, rx1176_eos, rx1176_fail
+    sub $I11, rx1176_pos, rx1176_off
+    substr $S10, rx1176_tgt, $I11, 6
+    ne $S10, "OFFSET", rx1176_fail
+    add rx1176_pos, 6
+    goto alt1179_end
+  alt1179_14:
+    set_addr $I10, alt1179_15
+    rx1176_cur."!mark_push"(0, rx1176_pos, $I10)
+  # rx literal  "ADDRESS"
+    add $I11, rx1176_pos, 7
+    gt $I11, rx1176_eos, rx1176_fail
+    sub $I11, rx1176_pos, rx1176_off
+    substr $S10, rx1176_tgt, $I11, 7
+    ne $S10, "ADDRESS", rx1176_fail
+    add rx1176_pos, 7
+    goto alt1179_end
+  alt1179_15:
+  # rx literal  "NEXT"
+    add $I11, rx1176_pos, 4
+    gt $I11, rx1176_eos, rx1176_fail
+    sub $I11, rx1176_pos, rx1176_off
+    substr $S10, rx1176_tgt, $I11, 4
+    ne $S10, "NEXT", rx1176_fail
+    add rx1176_pos, 4
+  alt1179_end:
+.annotate 'line', 153
+  # rxanchor rwb
+    le rx1176_pos, 0, rx1176_fail
+    sub $I10, rx1176_pos, rx1176_off
+    is_cclass $I11, 8192, rx1176_tgt, $I10
+    if $I11, rx1176_fail
+    dec $I10
+    is_cclass $I11, 8192, rx1176_tgt, $I10
+    unless $I11, rx1176_fail
+.annotate 'line', 145
+  # rx pass
+    rx1176_cur."!cursor_pass"(rx1176_pos, "keyword")
+    if_null rx1176_debug, debug_361
+    rx1176_cur."!cursor_debug"("PASS", "keyword", " at pos=", rx1176_pos)
+  debug_361:
+    .return (rx1176_cur)
+  rx1176_restart:
+.annotate 'line', 8
+    if_null rx1176_debug, debug_362
+    rx1176_cur."!cursor_debug"("NEXT", "keyword")
+  debug_362:
+  rx1176_fail:
+    (rx1176_rep, rx1176_pos, $I10, $P10) = rx1176_cur."!mark_fail"(0)
+    lt rx1176_pos, -1, rx1176_done
+    eq rx1176_pos, -1, rx1176_fail
+    jump $I10
+  rx1176_done:
+    rx1176_cur."!cursor_fail"()
+    if_null rx1176_debug, debug_363
+    rx1176_cur."!cursor_debug"("FAIL", "keyword")
+  debug_363:
+    .return (rx1176_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__keyword"  :subid("77_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    new $P100, "ResizablePMCArray"
+    push $P100, "NEXT"
+    push $P100, "ADDRESS"
+    push $P100, "OFFSET"
+    push $P100, "restart"
+    push $P100, "expr"
+    push $P100, "goto"
+    push $P100, "continue"
+    push $P100, "return"
+    push $P100, "break"
+    push $P100, "default"
+    push $P100, "case"
+    push $P100, "else"
+    push $P100, "if"
+    push $P100, "do"
+    push $P100, "while"
+    push $P100, "for"
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "statement_list"  :subid("78_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1181_tgt
+    .local int rx1181_pos
+    .local int rx1181_off
+    .local int rx1181_eos
+    .local int rx1181_rep
+    .local pmc rx1181_cur
+    .local pmc rx1181_debug
+    (rx1181_cur, rx1181_pos, rx1181_tgt, $I10) = self."!cursor_start"()
+    rx1181_cur."!cursor_caparray"("labeled_statement")
+    getattribute rx1181_debug, rx1181_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1181_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1181_eos, rx1181_tgt
+    gt rx1181_pos, rx1181_eos, rx1181_done
+    set rx1181_off, 0
+    lt rx1181_pos, 2, rx1181_start
+    sub rx1181_off, rx1181_pos, 1
+    substr rx1181_tgt, rx1181_tgt, rx1181_off
+  rx1181_start:
+    eq $I10, 1, rx1181_restart
+    if_null rx1181_debug, debug_364
+    rx1181_cur."!cursor_debug"("START", "statement_list")
+  debug_364:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1183_done
+    goto rxscan1183_scan
+  rxscan1183_loop:
+    ($P10) = rx1181_cur."from"()
+    inc $P10
+    set rx1181_pos, $P10
+    ge rx1181_pos, rx1181_eos, rxscan1183_done
+  rxscan1183_scan:
+    set_addr $I10, rxscan1183_loop
+    rx1181_cur."!mark_push"(0, rx1181_pos, $I10)
+  rxscan1183_done:
+.annotate 'line', 159
+  # rx subrule "ws" subtype=method negate=
+    rx1181_cur."!cursor_pos"(rx1181_pos)
+    $P10 = rx1181_cur."ws"()
+    unless $P10, rx1181_fail
+    rx1181_pos = $P10."pos"()
+.annotate 'line', 160
+  # rx rxquantr1184 ** 0..*
+    set_addr $I10, rxquantr1184_done
+    rx1181_cur."!mark_push"(0, rx1181_pos, $I10)
+  rxquantr1184_loop:
+  # rx subrule "ws" subtype=method negate=
+    rx1181_cur."!cursor_pos"(rx1181_pos)
+    $P10 = rx1181_cur."ws"()
+    unless $P10, rx1181_fail
+    rx1181_pos = $P10."pos"()
+  # rx subrule "labeled_statement" subtype=capture negate=
+    rx1181_cur."!cursor_pos"(rx1181_pos)
+    $P10 = rx1181_cur."labeled_statement"()
+    unless $P10, rx1181_fail
+    rx1181_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("labeled_statement")
+    rx1181_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1181_cur."!cursor_pos"(rx1181_pos)
+    $P10 = rx1181_cur."ws"()
+    unless $P10, rx1181_fail
+    rx1181_pos = $P10."pos"()
+  # rx subrule "eat_terminator" subtype=method negate=
+    rx1181_cur."!cursor_pos"(rx1181_pos)
+    $P10 = rx1181_cur."eat_terminator"()
+    unless $P10, rx1181_fail
+    rx1181_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1181_cur."!cursor_pos"(rx1181_pos)
+    $P10 = rx1181_cur."ws"()
+    unless $P10, rx1181_fail
+    rx1181_pos = $P10."pos"()
+    set_addr $I10, rxquantr1184_done
+    (rx1181_rep) = rx1181_cur."!mark_commit"($I10)
+    set_addr $I10, rxquantr1184_done
+    rx1181_cur."!mark_push"(rx1181_rep, rx1181_pos, $I10)
+    goto rxquantr1184_loop
+  rxquantr1184_done:
+  # rx subrule "ws" subtype=method negate=
+    rx1181_cur."!cursor_pos"(rx1181_pos)
+    $P10 = rx1181_cur."ws"()
+    unless $P10, rx1181_fail
+    rx1181_pos = $P10."pos"()
+.annotate 'line', 159
+  # rx pass
+    rx1181_cur."!cursor_pass"(rx1181_pos, "statement_list")
+    if_null rx1181_debug, debug_365
+    rx1181_cur."!cursor_debug"("PASS", "statement_list", " at pos=", rx1181_pos)
+  debug_365:
+    .return (rx1181_cur)
+  rx1181_restart:
+.annotate 'line', 8
+    if_null rx1181_debug, debug_366
+    rx1181_cur."!cursor_debug"("NEXT", "statement_list")
+  debug_366:
+  rx1181_fail:
+    (rx1181_rep, rx1181_pos, $I10, $P10) = rx1181_cur."!mark_fail"(0)
+    lt rx1181_pos, -1, rx1181_done
+    eq rx1181_pos, -1, rx1181_fail
+    jump $I10
+  rx1181_done:
+    rx1181_cur."!cursor_fail"()
+    if_null rx1181_debug, debug_367
+    rx1181_cur."!cursor_debug"("FAIL", "statement_list")
+  debug_367:
+    .return (rx1181_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__statement_list"  :subid("79_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("ws", "")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "labeled_statement"  :subid("80_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1186_tgt
+    .local int rx1186_pos
+    .local int rx1186_off
+    .local int rx1186_eos
+    .local int rx1186_rep
+    .local pmc rx1186_cur
+    .local pmc rx1186_debug
+    (rx1186_cur, rx1186_pos, rx1186_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1186_debug, rx1186_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1186_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1186_eos, rx1186_tgt
+    gt rx1186_pos, rx1186_eos, rx1186_done
+    set rx1186_off, 0
+    lt rx1186_pos, 2, rx1186_start
+    sub rx1186_off, rx1186_pos, 1
+    substr rx1186_tgt, rx1186_tgt, rx1186_off
+  rx1186_start:
+    eq $I10, 1, rx1186_restart
+    if_null rx1186_debug, debug_368
+    rx1186_cur."!cursor_debug"("START", "labeled_statement")
+  debug_368:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1188_done
+    goto rxscan1188_scan
+  rxscan1188_loop:
+    ($P10) = rx1186_cur."from"()
+    inc $P10
+    set rx1186_pos, $P10
+    ge rx1186_pos, rx1186_eos, rxscan1188_done
+  rxscan1188_scan:
+    set_addr $I10, rxscan1188_loop
+    rx1186_cur."!mark_push"(0, rx1186_pos, $I10)
+  rxscan1188_done:
+  alt1189_0:
+.annotate 'line', 164
+    set_addr $I10, alt1189_1
+    rx1186_cur."!mark_push"(0, rx1186_pos, $I10)
+.annotate 'line', 165
+  # rx subrule "label" subtype=capture negate=
+    rx1186_cur."!cursor_pos"(rx1186_pos)
+    $P10 = rx1186_cur."label"()
+    unless $P10, rx1186_fail
+    rx1186_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("label")
+    rx1186_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1186_cur."!cursor_pos"(rx1186_pos)
+    $P10 = rx1186_cur."ws"()
+    unless $P10, rx1186_fail
+    rx1186_pos = $P10."pos"()
+  # rx subrule "statement" subtype=capture negate=
+    rx1186_cur."!cursor_pos"(rx1186_pos)
+    $P10 = rx1186_cur."statement"()
+    unless $P10, rx1186_fail
+    rx1186_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("statement")
+    rx1186_pos = $P10."pos"()
+    goto alt1189_end
+  alt1189_1:
+    set_addr $I10, alt1189_2
+    rx1186_cur."!mark_push"(0, rx1186_pos, $I10)
+.annotate 'line', 166
+  # rx subrule "label" subtype=capture negate=
+    rx1186_cur."!cursor_pos"(rx1186_pos)
+    $P10 = rx1186_cur."label"()
+    unless $P10, rx1186_fail
+    rx1186_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("label")
+    rx1186_pos = $P10."pos"()
+    goto alt1189_end
+  alt1189_2:
+.annotate 'line', 167
+  # rx subrule "statement" subtype=capture negate=
+    rx1186_cur."!cursor_pos"(rx1186_pos)
+    $P10 = rx1186_cur."statement"()
+    unless $P10, rx1186_fail
+    rx1186_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("statement")
+    rx1186_pos = $P10."pos"()
+  alt1189_end:
+.annotate 'line', 169
+  # rx subrule "ws" subtype=method negate=
+    rx1186_cur."!cursor_pos"(rx1186_pos)
+    $P10 = rx1186_cur."ws"()
+    unless $P10, rx1186_fail
+    rx1186_pos = $P10."pos"()
+.annotate 'line', 170
+  # rx subrule "MARKER" subtype=zerowidth negate=
+    rx1186_cur."!cursor_pos"(rx1186_pos)
+    $P10 = rx1186_cur."MARKER"("endstmt")
+    unless $P10, rx1186_fail
+.annotate 'line', 163
+  # rx pass
+    rx1186_cur."!cursor_pass"(rx1186_pos, "labeled_statement")
+    if_null rx1186_debug, debug_369
+    rx1186_cur."!cursor_debug"("PASS", "labeled_statement", " at pos=", rx1186_pos)
+  debug_369:
+    .return (rx1186_cur)
+  rx1186_restart:
+.annotate 'line', 8
+    if_null rx1186_debug, debug_370
+    rx1186_cur."!cursor_debug"("NEXT", "labeled_statement")
+  debug_370:
+  rx1186_fail:
+    (rx1186_rep, rx1186_pos, $I10, $P10) = rx1186_cur."!mark_fail"(0)
+    lt rx1186_pos, -1, rx1186_done
+    eq rx1186_pos, -1, rx1186_fail
+    jump $I10
+  rx1186_done:
+    rx1186_cur."!cursor_fail"()
+    if_null rx1186_debug, debug_371
+    rx1186_cur."!cursor_debug"("FAIL", "labeled_statement")
+  debug_371:
+    .return (rx1186_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__labeled_statement"  :subid("81_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("statement", "")
+    $P101 = self."!PREFIX__!subrule"("label", "")
+    $P102 = self."!PREFIX__!subrule"("label", "")
+    new $P103, "ResizablePMCArray"
+    push $P103, $P100
+    push $P103, $P101
+    push $P103, $P102
+    .return ($P103)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "statement"  :subid("82_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1191_tgt
+    .local int rx1191_pos
+    .local int rx1191_off
+    .local int rx1191_eos
+    .local int rx1191_rep
+    .local pmc rx1191_cur
+    .local pmc rx1191_debug
+    (rx1191_cur, rx1191_pos, rx1191_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1191_debug, rx1191_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1191_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1191_eos, rx1191_tgt
+    gt rx1191_pos, rx1191_eos, rx1191_done
+    set rx1191_off, 0
+    lt rx1191_pos, 2, rx1191_start
+    sub rx1191_off, rx1191_pos, 1
+    substr rx1191_tgt, rx1191_tgt, rx1191_off
+  rx1191_start:
+    eq $I10, 1, rx1191_restart
+    if_null rx1191_debug, debug_372
+    rx1191_cur."!cursor_debug"("START", "statement")
+  debug_372:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1193_done
+    goto rxscan1193_scan
+  rxscan1193_loop:
+    ($P10) = rx1191_cur."from"()
+    inc $P10
+    set rx1191_pos, $P10
+    ge rx1191_pos, rx1191_eos, rxscan1193_done
+  rxscan1193_scan:
+    set_addr $I10, rxscan1193_loop
+    rx1191_cur."!mark_push"(0, rx1191_pos, $I10)
+  rxscan1193_done:
+  alt1194_0:
+.annotate 'line', 174
+    set_addr $I10, alt1194_1
+    rx1191_cur."!mark_push"(0, rx1191_pos, $I10)
+.annotate 'line', 175
+  # rx subrule "c_macro" subtype=capture negate=
+    rx1191_cur."!cursor_pos"(rx1191_pos)
+    $P10 = rx1191_cur."c_macro"()
+    unless $P10, rx1191_fail
+    rx1191_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("c_macro")
+    rx1191_pos = $P10."pos"()
+    goto alt1194_end
+  alt1194_1:
+    set_addr $I10, alt1194_2
+    rx1191_cur."!mark_push"(0, rx1191_pos, $I10)
+.annotate 'line', 176
+  # rx subrule "statement_control" subtype=capture negate=
+    rx1191_cur."!cursor_pos"(rx1191_pos)
+    $P10 = rx1191_cur."statement_control"()
+    unless $P10, rx1191_fail
+    rx1191_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("statement_control")
+    rx1191_pos = $P10."pos"()
+    goto alt1194_end
+  alt1194_2:
+    set_addr $I10, alt1194_3
+    rx1191_cur."!mark_push"(0, rx1191_pos, $I10)
+.annotate 'line', 177
+  # rx subrule "blockoid" subtype=capture negate=
+    rx1191_cur."!cursor_pos"(rx1191_pos)
+    $P10 = rx1191_cur."blockoid"()
+    unless $P10, rx1191_fail
+    rx1191_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("blockoid")
+    rx1191_pos = $P10."pos"()
+    goto alt1194_end
+  alt1194_3:
+.annotate 'line', 178
+  # rx subrule "EXPR" subtype=capture negate=
+    rx1191_cur."!cursor_pos"(rx1191_pos)
+    $P10 = rx1191_cur."EXPR"()
+    unless $P10, rx1191_fail
+    rx1191_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("EXPR")
+    rx1191_pos = $P10."pos"()
+  alt1194_end:
+.annotate 'line', 180
+  # rx subrule "ws" subtype=method negate=
+    rx1191_cur."!cursor_pos"(rx1191_pos)
+    $P10 = rx1191_cur."ws"()
+    unless $P10, rx1191_fail
+    rx1191_pos = $P10."pos"()
+.annotate 'line', 181
+  # rx subrule "MARKER" subtype=zerowidth negate=
+    rx1191_cur."!cursor_pos"(rx1191_pos)
+    $P10 = rx1191_cur."MARKER"("endstmt")
+    unless $P10, rx1191_fail
+.annotate 'line', 173
+  # rx pass
+    rx1191_cur."!cursor_pass"(rx1191_pos, "statement")
+    if_null rx1191_debug, debug_373
+    rx1191_cur."!cursor_debug"("PASS", "statement", " at pos=", rx1191_pos)
+  debug_373:
+    .return (rx1191_cur)
+  rx1191_restart:
+.annotate 'line', 8
+    if_null rx1191_debug, debug_374
+    rx1191_cur."!cursor_debug"("NEXT", "statement")
+  debug_374:
+  rx1191_fail:
+    (rx1191_rep, rx1191_pos, $I10, $P10) = rx1191_cur."!mark_fail"(0)
+    lt rx1191_pos, -1, rx1191_done
+    eq rx1191_pos, -1, rx1191_fail
+    jump $I10
+  rx1191_done:
+    rx1191_cur."!cursor_fail"()
+    if_null rx1191_debug, debug_375
+    rx1191_cur."!cursor_debug"("FAIL", "statement")
+  debug_375:
+    .return (rx1191_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__statement"  :subid("83_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("EXPR", "")
+    $P101 = self."!PREFIX__!subrule"("blockoid", "")
+    $P102 = self."!PREFIX__!subrule"("statement_control", "")
+    $P103 = self."!PREFIX__!subrule"("c_macro", "")
+    new $P104, "ResizablePMCArray"
+    push $P104, $P100
+    push $P104, $P101
+    push $P104, $P102
+    push $P104, $P103
+    .return ($P104)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "label"  :subid("84_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1196_tgt
+    .local int rx1196_pos
+    .local int rx1196_off
+    .local int rx1196_eos
+    .local int rx1196_rep
+    .local pmc rx1196_cur
+    .local pmc rx1196_debug
+    (rx1196_cur, rx1196_pos, rx1196_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1196_debug, rx1196_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1196_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1196_eos, rx1196_tgt
+    gt rx1196_pos, rx1196_eos, rx1196_done
+    set rx1196_off, 0
+    lt rx1196_pos, 2, rx1196_start
+    sub rx1196_off, rx1196_pos, 1
+    substr rx1196_tgt, rx1196_tgt, rx1196_off
+  rx1196_start:
+    eq $I10, 1, rx1196_restart
+    if_null rx1196_debug, debug_376
+    rx1196_cur."!cursor_debug"("START", "label")
+  debug_376:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1198_done
+    goto rxscan1198_scan
+  rxscan1198_loop:
+    ($P10) = rx1196_cur."from"()
+    inc $P10
+    set rx1196_pos, $P10
+    ge rx1196_pos, rx1196_eos, rxscan1198_done
+  rxscan1198_scan:
+    set_addr $I10, rxscan1198_loop
+    rx1196_cur."!mark_push"(0, rx1196_pos, $I10)
+  rxscan1198_done:
+  alt1199_0:
+.annotate 'line', 185
+    set_addr $I10, alt1199_1
+    rx1196_cur."!mark_push"(0, rx1196_pos, $I10)
+.annotate 'line', 186
+  # rx literal  "case"
+    add $I11, rx1196_pos, 4
+    gt $I11, rx1196_eos, rx1196_fail
+    sub $I11, rx1196_pos, rx1196_off
+    substr $S10, rx1196_tgt, $I11, 4
+    ne $S10, "case", rx1196_fail
+    add rx1196_pos, 4
+  # rx subrule "ws" subtype=method negate=
+    rx1196_cur."!cursor_pos"(rx1196_pos)
+    $P10 = rx1196_cur."ws"()
+    unless $P10, rx1196_fail
+    rx1196_pos = $P10."pos"()
+  alt1200_0:
+    set_addr $I10, alt1200_1
+    rx1196_cur."!mark_push"(0, rx1196_pos, $I10)
+  # rx subrule "integer" subtype=capture negate=
+    rx1196_cur."!cursor_pos"(rx1196_pos)
+    $P10 = rx1196_cur."integer"()
+    unless $P10, rx1196_fail
+    rx1196_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("integer")
+    rx1196_pos = $P10."pos"()
+    goto alt1200_end
+  alt1200_1:
+    set_addr $I10, alt1200_2
+    rx1196_cur."!mark_push"(0, rx1196_pos, $I10)
+  # rx subrule "identifier" subtype=capture negate=
+    rx1196_cur."!cursor_pos"(rx1196_pos)
+    $P10 = rx1196_cur."identifier"()
+    unless $P10, rx1196_fail
+    rx1196_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("identifier")
+    rx1196_pos = $P10."pos"()
+    goto alt1200_end
+  alt1200_2:
+  # rx literal  "'"
+    add $I11, rx1196_pos, 1
+    gt $I11, rx1196_eos, rx1196_fail
+    sub $I11, rx1196_pos, rx1196_off
+    ord $I11, rx1196_tgt, $I11
+    ne $I11, 39, rx1196_fail
+    add rx1196_pos, 1
+  # rx subrule "alnum" subtype=capture negate=
+    rx1196_cur."!cursor_pos"(rx1196_pos)
+    $P10 = rx1196_cur."alnum"()
+    unless $P10, rx1196_fail
+    rx1196_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("alnum")
+    rx1196_pos = $P10."pos"()
+  # rx literal  "'"
+    add $I11, rx1196_pos, 1
+    gt $I11, rx1196_eos, rx1196_fail
+    sub $I11, rx1196_pos, rx1196_off
+    ord $I11, rx1196_tgt, $I11
+    ne $I11, 39, rx1196_fail
+    add rx1196_pos, 1
+  alt1200_end:
+  # rx literal  ":"
+    add $I11, rx1196_pos, 1
+    gt $I11, rx1196_eos, rx1196_fail
+    sub $I11, rx1196_pos, rx1196_off
+    ord $I11, rx1196_tgt, $I11
+    ne $I11, 58, rx1196_fail
+    add rx1196_pos, 1
+    goto alt1199_end
+  alt1199_1:
+    set_addr $I10, alt1199_2
+    rx1196_cur."!mark_push"(0, rx1196_pos, $I10)
+.annotate 'line', 187
+  # rx literal  "default:"
+    add $I11, rx1196_pos, 8
+    gt $I11, rx1196_eos, rx1196_fail
+    sub $I11, rx1196_pos, rx1196_off
+    substr $S10, rx1196_tgt, $I11, 8
+    ne $S10, "default:", rx1196_fail
+    add rx1196_pos, 8
+    goto alt1199_end
+  alt1199_2:
+.annotate 'line', 188
+  # rx subrule "identifier" subtype=capture negate=
+    rx1196_cur."!cursor_pos"(rx1196_pos)
+    $P10 = rx1196_cur."identifier"()
+    unless $P10, rx1196_fail
+    rx1196_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("identifier")
+    rx1196_pos = $P10."pos"()
+  # rx literal  ":"
+    add $I11, rx1196_pos, 1
+    gt $I11, rx1196_eos, rx1196_fail
+    sub $I11, rx1196_pos, rx1196_off
+    ord $I11, rx1196_tgt, $I11
+    ne $I11, 58, rx1196_fail
+    add rx1196_pos, 1
+  alt1199_end:
+.annotate 'line', 184
+  # rx pass
+    rx1196_cur."!cursor_pass"(rx1196_pos, "label")
+    if_null rx1196_debug, debug_377
+    rx1196_cur."!cursor_debug"("PASS", "label", " at pos=", rx1196_pos)
+  debug_377:
+    .return (rx1196_cur)
+  rx1196_restart:
+.annotate 'line', 8
+    if_null rx1196_debug, debug_378
+    rx1196_cur."!cursor_debug"("NEXT", "label")
+  debug_378:
+  rx1196_fail:
+    (rx1196_rep, rx1196_pos, $I10, $P10) = rx1196_cur."!mark_fail"(0)
+    lt rx1196_pos, -1, rx1196_done
+    eq rx1196_pos, -1, rx1196_fail
+    jump $I10
+  rx1196_done:
+    rx1196_cur."!cursor_fail"()
+    if_null rx1196_debug, debug_379
+    rx1196_cur."!cursor_debug"("FAIL", "label")
+  debug_379:
+    .return (rx1196_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__label"  :subid("85_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("identifier", "")
+    $P101 = self."!PREFIX__!subrule"("ws", "case")
+    new $P102, "ResizablePMCArray"
+    push $P102, $P100
+    push $P102, "default:"
+    push $P102, $P101
+    .return ($P102)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "statement_control"  :subid("86_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 192
+    $P100 = self."!protoregex"("statement_control")
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__statement_control"  :subid("87_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 192
+    $P101 = self."!PREFIX__!protoregex"("statement_control")
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "statement_control:sym<if>"  :subid("88_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1204_tgt
+    .local int rx1204_pos
+    .local int rx1204_off
+    .local int rx1204_eos
+    .local int rx1204_rep
+    .local pmc rx1204_cur
+    .local pmc rx1204_debug
+    (rx1204_cur, rx1204_pos, rx1204_tgt, $I10) = self."!cursor_start"()
+    rx1204_cur."!cursor_caparray"("else")
+    getattribute rx1204_debug, rx1204_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1204_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1204_eos, rx1204_tgt
+    gt rx1204_pos, rx1204_eos, rx1204_done
+    set rx1204_off, 0
+    lt rx1204_pos, 2, rx1204_start
+    sub rx1204_off, rx1204_pos, 1
+    substr rx1204_tgt, rx1204_tgt, rx1204_off
+  rx1204_start:
+    eq $I10, 1, rx1204_restart
+    if_null rx1204_debug, debug_380
+    rx1204_cur."!cursor_debug"("START", "statement_control:sym<if>")
+  debug_380:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1206_done
+    goto rxscan1206_scan
+  rxscan1206_loop:
+    ($P10) = rx1204_cur."from"()
+    inc $P10
+    set rx1204_pos, $P10
+    ge rx1204_pos, rx1204_eos, rxscan1206_done
+  rxscan1206_scan:
+    set_addr $I10, rxscan1206_loop
+    rx1204_cur."!mark_push"(0, rx1204_pos, $I10)
+  rxscan1206_done:
+.annotate 'line', 194
+  # rx subrule "ws" subtype=method negate=
+    rx1204_cur."!cursor_pos"(rx1204_pos)
+    $P10 = rx1204_cur."ws"()
+    unless $P10, rx1204_fail
+    rx1204_pos = $P10."pos"()
+.annotate 'line', 195
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1207_fail
+    rx1204_cur."!mark_push"(0, rx1204_pos, $I10)
+  # rx literal  "if"
+    add $I11, rx1204_pos, 2
+    gt $I11, rx1204_eos, rx1204_fail
+    sub $I11, rx1204_pos, rx1204_off
+    substr $S10, rx1204_tgt, $I11, 2
+    ne $S10, "if", rx1204_fail
+    add rx1204_pos, 2
+    set_addr $I10, rxcap_1207_fail
+    ($I12, $I11) = rx1204_cur."!mark_peek"($I10)
+    rx1204_cur."!cursor_pos"($I11)
+    ($P10) = rx1204_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1204_pos, "")
+    rx1204_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1207_done
+  rxcap_1207_fail:
+    goto rx1204_fail
+  rxcap_1207_done:
+  # rx subrule "ws" subtype=method negate=
+    rx1204_cur."!cursor_pos"(rx1204_pos)
+    $P10 = rx1204_cur."ws"()
+    unless $P10, rx1204_fail
+    rx1204_pos = $P10."pos"()
+  # rx literal  "("
+    add $I11, rx1204_pos, 1
+    gt $I11, rx1204_eos, rx1204_fail
+    sub $I11, rx1204_pos, rx1204_off
+    ord $I11, rx1204_tgt, $I11
+    ne $I11, 40, rx1204_fail
+    add rx1204_pos, 1
+  # rx subrule "ws" subtype=method negate=
+    rx1204_cur."!cursor_pos"(rx1204_pos)
+    $P10 = rx1204_cur."ws"()
+    unless $P10, rx1204_fail
+    rx1204_pos = $P10."pos"()
+  # rx subrule "EXPR" subtype=capture negate=
+    rx1204_cur."!cursor_pos"(rx1204_pos)
+    $P10 = rx1204_cur."EXPR"()
+    unless $P10, rx1204_fail
+    rx1204_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("EXPR")
+    rx1204_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1204_cur."!cursor_pos"(rx1204_pos)
+    $P10 = rx1204_cur."ws"()
+    unless $P10, rx1204_fail
+    rx1204_pos = $P10."pos"()
+  # rx literal  ")"
+    add $I11, rx1204_pos, 1
+    gt $I11, rx1204_eos, rx1204_fail
+    sub $I11, rx1204_pos, rx1204_off
+    ord $I11, rx1204_tgt, $I11
+    ne $I11, 41, rx1204_fail
+    add rx1204_pos, 1
+  # rx subrule "ws" subtype=method negate=
+    rx1204_cur."!cursor_pos"(rx1204_pos)
+    $P10 = rx1204_cur."ws"()
+    unless $P10, rx1204_fail
+    rx1204_pos = $P10."pos"()
+.annotate 'line', 196
+  # rx subrule "statement_or_block" subtype=capture negate=
+    rx1204_cur."!cursor_pos"(rx1204_pos)
+    $P10 = rx1204_cur."statement_or_block"()
+    unless $P10, rx1204_fail
+    rx1204_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("then")
+    rx1204_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1204_cur."!cursor_pos"(rx1204_pos)
+    $P10 = rx1204_cur."ws"()
+    unless $P10, rx1204_fail
+    rx1204_pos = $P10."pos"()
+.annotate 'line', 197
+  # rx rxquantr1208 ** 0..1
+    set_addr $I10, rxquantr1208_done
+    rx1204_cur."!mark_push"(0, rx1204_pos, $I10)
+  rxquantr1208_loop:
+  # rx subrule "ws" subtype=method negate=
+    rx1204_cur."!cursor_pos"(rx1204_pos)
+    $P10 = rx1204_cur."ws"()
+    unless $P10, rx1204_fail
+    rx1204_pos = $P10."pos"()
+  # rx literal  "else"
+    add $I11, rx1204_pos, 4
+    gt $I11, rx1204_eos, rx1204_fail
+    sub $I11, rx1204_pos, rx1204_off
+    substr $S10, rx1204_tgt, $I11, 4
+    ne $S10, "else", rx1204_fail
+    add rx1204_pos, 4
+  # rx subrule "ws" subtype=method negate=
+    rx1204_cur."!cursor_pos"(rx1204_pos)
+    $P10 = rx1204_cur."ws"()
+    unless $P10, rx1204_fail
+    rx1204_pos = $P10."pos"()
+  # rx subrule "statement_or_block" subtype=capture negate=
+    rx1204_cur."!cursor_pos"(rx1204_pos)
+    $P10 = rx1204_cur."statement_or_block"()
+    unless $P10, rx1204_fail
+    rx1204_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("else")
+    rx1204_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1204_cur."!cursor_pos"(rx1204_pos)
+    $P10 = rx1204_cur."ws"()
+    unless $P10, rx1204_fail
+    rx1204_pos = $P10."pos"()
+    set_addr $I10, rxquantr1208_done
+    (rx1204_rep) = rx1204_cur."!mark_commit"($I10)
+  rxquantr1208_done:
+  # rx subrule "ws" subtype=method negate=
+    rx1204_cur."!cursor_pos"(rx1204_pos)
+    $P10 = rx1204_cur."ws"()
+    unless $P10, rx1204_fail
+    rx1204_pos = $P10."pos"()
+.annotate 'line', 194
+  # rx pass
+    rx1204_cur."!cursor_pass"(rx1204_pos, "statement_control:sym<if>")
+    if_null rx1204_debug, debug_381
+    rx1204_cur."!cursor_debug"("PASS", "statement_control:sym<if>", " at pos=", rx1204_pos)
+  debug_381:
+    .return (rx1204_cur)
+  rx1204_restart:
+.annotate 'line', 8
+    if_null rx1204_debug, debug_382
+    rx1204_cur."!cursor_debug"("NEXT", "statement_control:sym<if>")
+  debug_382:
+  rx1204_fail:
+    (rx1204_rep, rx1204_pos, $I10, $P10) = rx1204_cur."!mark_fail"(0)
+    lt rx1204_pos, -1, rx1204_done
+    eq rx1204_pos, -1, rx1204_fail
+    jump $I10
+  rx1204_done:
+    rx1204_cur."!cursor_fail"()
+    if_null rx1204_debug, debug_383
+    rx1204_cur."!cursor_debug"("FAIL", "statement_control:sym<if>")
+  debug_383:
+    .return (rx1204_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__statement_control:sym<if>"  :subid("89_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("ws", "")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "statement_control:sym<while>"  :subid("90_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1210_tgt
+    .local int rx1210_pos
+    .local int rx1210_off
+    .local int rx1210_eos
+    .local int rx1210_rep
+    .local pmc rx1210_cur
+    .local pmc rx1210_debug
+    (rx1210_cur, rx1210_pos, rx1210_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1210_debug, rx1210_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1210_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1210_eos, rx1210_tgt
+    gt rx1210_pos, rx1210_eos, rx1210_done
+    set rx1210_off, 0
+    lt rx1210_pos, 2, rx1210_start
+    sub rx1210_off, rx1210_pos, 1
+    substr rx1210_tgt, rx1210_tgt, rx1210_off
+  rx1210_start:
+    eq $I10, 1, rx1210_restart
+    if_null rx1210_debug, debug_384
+    rx1210_cur."!cursor_debug"("START", "statement_control:sym<while>")
+  debug_384:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1212_done
+    goto rxscan1212_scan
+  rxscan1212_loop:
+    ($P10) = rx1210_cur."from"()
+    inc $P10
+    set rx1210_pos, $P10
+    ge rx1210_pos, rx1210_eos, rxscan1212_done
+  rxscan1212_scan:
+    set_addr $I10, rxscan1212_loop
+    rx1210_cur."!mark_push"(0, rx1210_pos, $I10)
+  rxscan1212_done:
+.annotate 'line', 200
+  # rx subrule "ws" subtype=method negate=
+    rx1210_cur."!cursor_pos"(rx1210_pos)
+    $P10 = rx1210_cur."ws"()
+    unless $P10, rx1210_fail
+    rx1210_pos = $P10."pos"()
+.annotate 'line', 201
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1213_fail
+    rx1210_cur."!mark_push"(0, rx1210_pos, $I10)
+  # rx literal  "while"
+    add $I11, rx1210_pos, 5
+    gt $I11, rx1210_eos, rx1210_fail
+    sub $I11, rx1210_pos, rx1210_off
+    substr $S10, rx1210_tgt, $I11, 5
+    ne $S10, "while", rx1210_fail
+    add rx1210_pos, 5
+    set_addr $I10, rxcap_1213_fail
+    ($I12, $I11) = rx1210_cur."!mark_peek"($I10)
+    rx1210_cur."!cursor_pos"($I11)
+    ($P10) = rx1210_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1210_pos, "")
+    rx1210_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1213_done
+  rxcap_1213_fail:
+    goto rx1210_fail
+  rxcap_1213_done:
+  # rx subrule "ws" subtype=method negate=
+    rx1210_cur."!cursor_pos"(rx1210_pos)
+    $P10 = rx1210_cur."ws"()
+    unless $P10, rx1210_fail
+    rx1210_pos = $P10."pos"()
+  # rx literal  "("
+    add $I11, rx1210_pos, 1
+    gt $I11, rx1210_eos, rx1210_fail
+    sub $I11, rx1210_pos, rx1210_off
+    ord $I11, rx1210_tgt, $I11
+    ne $I11, 40, rx1210_fail
+    add rx1210_pos, 1
+  # rx subrule "ws" subtype=method negate=
+    rx1210_cur."!cursor_pos"(rx1210_pos)
+    $P10 = rx1210_cur."ws"()
+    unless $P10, rx1210_fail
+    rx1210_pos = $P10."pos"()
+  # rx subrule "EXPR" subtype=capture negate=
+    rx1210_cur."!cursor_pos"(rx1210_pos)
+    $P10 = rx1210_cur."EXPR"()
+    unless $P10, rx1210_fail
+    rx1210_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("condition")
+    rx1210_pos = $P10."pos"()
+  alt1214_0:
+    set_addr $I10, alt1214_1
+    rx1210_cur."!mark_push"(0, rx1210_pos, $I10)
+  # rx literal  ")"
+    add $I11, rx1210_pos, 1
+    gt $I11, rx1210_eos, rx1210_fail
+    sub $I11, rx1210_pos, rx1210_off
+    ord $I11, rx1210_tgt, $I11
+    ne $I11, 41, rx1210_fail
+    add rx1210_pos, 1
+    goto alt1214_end
+  alt1214_1:
+  # rx subrule "FAILGOAL" subtype=method negate=
+    rx1210_cur."!cursor_pos"(rx1210_pos)
+    $P10 = rx1210_cur."FAILGOAL"("')'")
+    unless $P10, rx1210_fail
+    goto rxsubrule1215_pass
+  rxsubrule1215_back:
+    $P10 = $P10."!cursor_next"()
+    unless $P10, rx1210_fail
+  rxsubrule1215_pass:
+    set_addr $I10, rxsubrule1215_back
+    rx1210_cur."!mark_push"(0, rx1210_pos, $I10, $P10)
+    rx1210_pos = $P10."pos"()
+  alt1214_end:
+  # rx subrule "ws" subtype=method negate=
+    rx1210_cur."!cursor_pos"(rx1210_pos)
+    $P10 = rx1210_cur."ws"()
+    unless $P10, rx1210_fail
+    rx1210_pos = $P10."pos"()
+.annotate 'line', 202
+  # rx subrule "statement_or_block" subtype=capture negate=
+    rx1210_cur."!cursor_pos"(rx1210_pos)
+    $P10 = rx1210_cur."statement_or_block"()
+    unless $P10, rx1210_fail
+    rx1210_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("statement_list")
+    rx1210_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1210_cur."!cursor_pos"(rx1210_pos)
+    $P10 = rx1210_cur."ws"()
+    unless $P10, rx1210_fail
+    rx1210_pos = $P10."pos"()
+.annotate 'line', 200
+  # rx pass
+    rx1210_cur."!cursor_pass"(rx1210_pos, "statement_control:sym<while>")
+    if_null rx1210_debug, debug_385
+    rx1210_cur."!cursor_debug"("PASS", "statement_control:sym<while>", " at pos=", rx1210_pos)
+  debug_385:
+    .return (rx1210_cur)
+  rx1210_restart:
+.annotate 'line', 8
+    if_null rx1210_debug, debug_386
+    rx1210_cur."!cursor_debug"("NEXT", "statement_control:sym<while>")
+  debug_386:
+  rx1210_fail:
+    (rx1210_rep, rx1210_pos, $I10, $P10) = rx1210_cur."!mark_fail"(0)
+    lt rx1210_pos, -1, rx1210_done
+    eq rx1210_pos, -1, rx1210_fail
+    jump $I10
+  rx1210_done:
+    rx1210_cur."!cursor_fail"()
+    if_null rx1210_debug, debug_387
+    rx1210_cur."!cursor_debug"("FAIL", "statement_control:sym<while>")
+  debug_387:
+    .return (rx1210_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__statement_control:sym<while>"  :subid("91_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("ws", "")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "statement_control:sym<for>"  :subid("92_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1217_tgt
+    .local int rx1217_pos
+    .local int rx1217_off
+    .local int rx1217_eos
+    .local int rx1217_rep
+    .local pmc rx1217_cur
+    .local pmc rx1217_debug
+    (rx1217_cur, rx1217_pos, rx1217_tgt, $I10) = self."!cursor_start"()
+    rx1217_cur."!cursor_caparray"("init", "test", "step")
+    getattribute rx1217_debug, rx1217_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1217_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1217_eos, rx1217_tgt
+    gt rx1217_pos, rx1217_eos, rx1217_done
+    set rx1217_off, 0
+    lt rx1217_pos, 2, rx1217_start
+    sub rx1217_off, rx1217_pos, 1
+    substr rx1217_tgt, rx1217_tgt, rx1217_off
+  rx1217_start:
+    eq $I10, 1, rx1217_restart
+    if_null rx1217_debug, debug_388
+    rx1217_cur."!cursor_debug"("START", "statement_control:sym<for>")
+  debug_388:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1219_done
+    goto rxscan1219_scan
+  rxscan1219_loop:
+    ($P10) = rx1217_cur."from"()
+    inc $P10
+    set rx1217_pos, $P10
+    ge rx1217_pos, rx1217_eos, rxscan1219_done
+  rxscan1219_scan:
+    set_addr $I10, rxscan1219_loop
+    rx1217_cur."!mark_push"(0, rx1217_pos, $I10)
+  rxscan1219_done:
+.annotate 'line', 205
+  # rx subrule "ws" subtype=method negate=
+    rx1217_cur."!cursor_pos"(rx1217_pos)
+    $P10 = rx1217_cur."ws"()
+    unless $P10, rx1217_fail
+    rx1217_pos = $P10."pos"()
+.annotate 'line', 206
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1220_fail
+    rx1217_cur."!mark_push"(0, rx1217_pos, $I10)
+  # rx literal  "for"
+    add $I11, rx1217_pos, 3
+    gt $I11, rx1217_eos, rx1217_fail
+    sub $I11, rx1217_pos, rx1217_off
+    substr $S10, rx1217_tgt, $I11, 3
+    ne $S10, "for", rx1217_fail
+    add rx1217_pos, 3
+    set_addr $I10, rxcap_1220_fail
+    ($I12, $I11) = rx1217_cur."!mark_peek"($I10)
+    rx1217_cur."!cursor_pos"($I11)
+    ($P10) = rx1217_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1217_pos, "")
+    rx1217_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1220_done
+  rxcap_1220_fail:
+    goto rx1217_fail
+  rxcap_1220_done:
+  # rx subrule "ws" subtype=method negate=
+    rx1217_cur."!cursor_pos"(rx1217_pos)
+    $P10 = rx1217_cur."ws"()
+    unless $P10, rx1217_fail
+    rx1217_pos = $P10."pos"()
+  # rx literal  "("
+    add $I11, rx1217_pos, 1
+    gt $I11, rx1217_eos, rx1217_fail
+    sub $I11, rx1217_pos, rx1217_off
+    ord $I11, rx1217_tgt, $I11
+    ne $I11, 40, rx1217_fail
+    add rx1217_pos, 1
+  # rx subrule "ws" subtype=method negate=
+    rx1217_cur."!cursor_pos"(rx1217_pos)
+    $P10 = rx1217_cur."ws"()
+    unless $P10, rx1217_fail
+    rx1217_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1217_cur."!cursor_pos"(rx1217_pos)
+    $P10 = rx1217_cur."ws"()
+    unless $P10, rx1217_fail
+    rx1217_pos = $P10."pos"()
+  # rx rxquantr1221 ** 0..1
+    set_addr $I10, rxquantr1221_done
+    rx1217_cur."!mark_push"(0, rx1217_pos, $I10)
+  rxquantr1221_loop:
+  # rx subrule "EXPR" subtype=capture negate=
+    rx1217_cur."!cursor_pos"(rx1217_pos)
+    $P10 = rx1217_cur."EXPR"()
+    unless $P10, rx1217_fail
+    goto rxsubrule1222_pass
+  rxsubrule1222_back:
+    $P10 = $P10."!cursor_next"()
+    unless $P10, rx1217_fail
+  rxsubrule1222_pass:
+    set_addr $I10, rxsubrule1222_back
+    rx1217_cur."!mark_push"(0, rx1217_pos, $I10, $P10)
+    $P10."!cursor_names"("init")
+    rx1217_pos = $P10."pos"()
+    set_addr $I10, rxquantr1221_done
+    (rx1217_rep) = rx1217_cur."!mark_commit"($I10)
+  rxquantr1221_done:
+  # rx subrule "ws" subtype=method negate=
+    rx1217_cur."!cursor_pos"(rx1217_pos)
+    $P10 = rx1217_cur."ws"()
+    unless $P10, rx1217_fail
+    rx1217_pos = $P10."pos"()
+  # rx literal  ";"
+    add $I11, rx1217_pos, 1
+    gt $I11, rx1217_eos, rx1217_fail
+    sub $I11, rx1217_pos, rx1217_off
+    ord $I11, rx1217_tgt, $I11
+    ne $I11, 59, rx1217_fail
+    add rx1217_pos, 1
+  # rx subrule "ws" subtype=method negate=
+    rx1217_cur."!cursor_pos"(rx1217_pos)
+    $P10 = rx1217_cur."ws"()
+    unless $P10, rx1217_fail
+    rx1217_pos = $P10."pos"()
+  # rx rxquantr1223 ** 0..1
+    set_addr $I10, rxquantr1223_done
+    rx1217_cur."!mark_push"(0, rx1217_pos, $I10)
+  rxquantr1223_loop:
+  # rx subrule "EXPR" subtype=capture negate=
+    rx1217_cur."!cursor_pos"(rx1217_pos)
+    $P10 = rx1217_cur."EXPR"()
+    unless $P10, rx1217_fail
+    goto rxsubrule1224_pass
+  rxsubrule1224_back:
+    $P10 = $P10."!cursor_next"()
+    unless $P10, rx1217_fail
+  rxsubrule1224_pass:
+    set_addr $I10, rxsubrule1224_back
+    rx1217_cur."!mark_push"(0, rx1217_pos, $I10, $P10)
+    $P10."!cursor_names"("test")
+    rx1217_pos = $P10."pos"()
+    set_addr $I10, rxquantr1223_done
+    (rx1217_rep) = rx1217_cur."!mark_commit"($I10)
+  rxquantr1223_done:
+  # rx subrule "ws" subtype=method negate=
+    rx1217_cur."!cursor_pos"(rx1217_pos)
+    $P10 = rx1217_cur."ws"()
+    unless $P10, rx1217_fail
+    rx1217_pos = $P10."pos"()
+  # rx literal  ";"
+    add $I11, rx1217_pos, 1
+    gt $I11, rx1217_eos, rx1217_fail
+    sub $I11, rx1217_pos, rx1217_off
+    ord $I11, rx1217_tgt, $I11
+    ne $I11, 59, rx1217_fail
+    add rx1217_pos, 1
+  # rx subrule "ws" subtype=method negate=
+    rx1217_cur."!cursor_pos"(rx1217_pos)
+    $P10 = rx1217_cur."ws"()
+    unless $P10, rx1217_fail
+    rx1217_pos = $P10."pos"()
+  # rx rxquantr1225 ** 0..1
+    set_addr $I10, rxquantr1225_done
+    rx1217_cur."!mark_push"(0, rx1217_pos, $I10)
+  rxquantr1225_loop:
+  # rx subrule "EXPR" subtype=capture negate=
+    rx1217_cur."!cursor_pos"(rx1217_pos)
+    $P10 = rx1217_cur."EXPR"()
+    unless $P10, rx1217_fail
+    goto rxsubrule1226_pass
+  rxsubrule1226_back:
+    $P10 = $P10."!cursor_next"()
+    unless $P10, rx1217_fail
+  rxsubrule1226_pass:
+    set_addr $I10, rxsubrule1226_back
+    rx1217_cur."!mark_push"(0, rx1217_pos, $I10, $P10)
+    $P10."!cursor_names"("step")
+    rx1217_pos = $P10."pos"()
+    set_addr $I10, rxquantr1225_done
+    (rx1217_rep) = rx1217_cur."!mark_commit"($I10)
+  rxquantr1225_done:
+  # rx subrule "ws" subtype=method negate=
+    rx1217_cur."!cursor_pos"(rx1217_pos)
+    $P10 = rx1217_cur."ws"()
+    unless $P10, rx1217_fail
+    rx1217_pos = $P10."pos"()
+  alt1227_0:
+    set_addr $I10, alt1227_1
+    rx1217_cur."!mark_push"(0, rx1217_pos, $I10)
+  # rx literal  ")"
+    add $I11, rx1217_pos, 1
+    gt $I11, rx1217_eos, rx1217_fail
+    sub $I11, rx1217_pos, rx1217_off
+    ord $I11, rx1217_tgt, $I11
+    ne $I11, 41, rx1217_fail
+    add rx1217_pos, 1
+    goto alt1227_end
+  alt1227_1:
+  # rx subrule "FAILGOAL" subtype=method negate=
+    rx1217_cur."!cursor_pos"(rx1217_pos)
+    $P10 = rx1217_cur."FAILGOAL"("')'")
+    unless $P10, rx1217_fail
+    goto rxsubrule1228_pass
+  rxsubrule1228_back:
+    $P10 = $P10."!cursor_next"()
+    unless $P10, rx1217_fail
+  rxsubrule1228_pass:
+    set_addr $I10, rxsubrule1228_back
+    rx1217_cur."!mark_push"(0, rx1217_pos, $I10, $P10)
+    rx1217_pos = $P10."pos"()
+  alt1227_end:
+  # rx subrule "ws" subtype=method negate=
+    rx1217_cur."!cursor_pos"(rx1217_pos)
+    $P10 = rx1217_cur."ws"()
+    unless $P10, rx1217_fail
+    rx1217_pos = $P10."pos"()
+.annotate 'line', 207
+  # rx subrule "statement_or_block" subtype=capture negate=
+    rx1217_cur."!cursor_pos"(rx1217_pos)
+    $P10 = rx1217_cur."statement_or_block"()
+    unless $P10, rx1217_fail
+    rx1217_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("statement_list")
+    rx1217_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1217_cur."!cursor_pos"(rx1217_pos)
+    $P10 = rx1217_cur."ws"()
+    unless $P10, rx1217_fail
+    rx1217_pos = $P10."pos"()
+.annotate 'line', 205
+  # rx pass
+    rx1217_cur."!cursor_pass"(rx1217_pos, "statement_control:sym<for>")
+    if_null rx1217_debug, debug_389
+    rx1217_cur."!cursor_debug"("PASS", "statement_control:sym<for>", " at pos=", rx1217_pos)
+  debug_389:
+    .return (rx1217_cur)
+  rx1217_restart:
+.annotate 'line', 8
+    if_null rx1217_debug, debug_390
+    rx1217_cur."!cursor_debug"("NEXT", "statement_control:sym<for>")
+  debug_390:
+  rx1217_fail:
+    (rx1217_rep, rx1217_pos, $I10, $P10) = rx1217_cur."!mark_fail"(0)
+    lt rx1217_pos, -1, rx1217_done
+    eq rx1217_pos, -1, rx1217_fail
+    jump $I10
+  rx1217_done:
+    rx1217_cur."!cursor_fail"()
+    if_null rx1217_debug, debug_391
+    rx1217_cur."!cursor_debug"("FAIL", "statement_control:sym<for>")
+  debug_391:
+    .return (rx1217_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__statement_control:sym<for>"  :subid("93_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("ws", "")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "statement_control:sym<do-while>"  :subid("94_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1230_tgt
+    .local int rx1230_pos
+    .local int rx1230_off
+    .local int rx1230_eos
+    .local int rx1230_rep
+    .local pmc rx1230_cur
+    .local pmc rx1230_debug
+    (rx1230_cur, rx1230_pos, rx1230_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1230_debug, rx1230_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1230_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1230_eos, rx1230_tgt
+    gt rx1230_pos, rx1230_eos, rx1230_done
+    set rx1230_off, 0
+    lt rx1230_pos, 2, rx1230_start
+    sub rx1230_off, rx1230_pos, 1
+    substr rx1230_tgt, rx1230_tgt, rx1230_off
+  rx1230_start:
+    eq $I10, 1, rx1230_restart
+    if_null rx1230_debug, debug_392
+    rx1230_cur."!cursor_debug"("START", "statement_control:sym<do-while>")
+  debug_392:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1232_done
+    goto rxscan1232_scan
+  rxscan1232_loop:
+    ($P10) = rx1230_cur."from"()
+    inc $P10
+    set rx1230_pos, $P10
+    ge rx1230_pos, rx1230_eos, rxscan1232_done
+  rxscan1232_scan:
+    set_addr $I10, rxscan1232_loop
+    rx1230_cur."!mark_push"(0, rx1230_pos, $I10)
+  rxscan1232_done:
+.annotate 'line', 210
+  # rx subrule "ws" subtype=method negate=
+    rx1230_cur."!cursor_pos"(rx1230_pos)
+    $P10 = rx1230_cur."ws"()
+    unless $P10, rx1230_fail
+    rx1230_pos = $P10."pos"()
+.annotate 'line', 211
+  # rx literal  "do"
+    add $I11, rx1230_pos, 2
+    gt $I11, rx1230_eos, rx1230_fail
+    sub $I11, rx1230_pos, rx1230_off
+    substr $S10, rx1230_tgt, $I11, 2
+    ne $S10, "do", rx1230_fail
+    add rx1230_pos, 2
+  # rx subrule "ws" subtype=method negate=
+    rx1230_cur."!cursor_pos"(rx1230_pos)
+    $P10 = rx1230_cur."ws"()
+    unless $P10, rx1230_fail
+    rx1230_pos = $P10."pos"()
+  # rx subrule "blockoid" subtype=capture negate=
+    rx1230_cur."!cursor_pos"(rx1230_pos)
+    $P10 = rx1230_cur."blockoid"()
+    unless $P10, rx1230_fail
+    rx1230_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("blockoid")
+    rx1230_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1230_cur."!cursor_pos"(rx1230_pos)
+    $P10 = rx1230_cur."ws"()
+    unless $P10, rx1230_fail
+    rx1230_pos = $P10."pos"()
+  # rx literal  "while"
+    add $I11, rx1230_pos, 5
+    gt $I11, rx1230_eos, rx1230_fail
+    sub $I11, rx1230_pos, rx1230_off
+    substr $S10, rx1230_tgt, $I11, 5
+    ne $S10, "while", rx1230_fail
+    add rx1230_pos, 5
+  # rx subrule "ws" subtype=method negate=
+    rx1230_cur."!cursor_pos"(rx1230_pos)
+    $P10 = rx1230_cur."ws"()
+    unless $P10, rx1230_fail
+    rx1230_pos = $P10."pos"()
+  # rx literal  "("
+    add $I11, rx1230_pos, 1
+    gt $I11, rx1230_eos, rx1230_fail
+    sub $I11, rx1230_pos, rx1230_off
+    ord $I11, rx1230_tgt, $I11
+    ne $I11, 40, rx1230_fail
+    add rx1230_pos, 1
+  # rx subrule "ws" subtype=method negate=
+    rx1230_cur."!cursor_pos"(rx1230_pos)
+    $P10 = rx1230_cur."ws"()
+    unless $P10, rx1230_fail
+    rx1230_pos = $P10."pos"()
+  # rx subrule "EXPR" subtype=capture negate=
+    rx1230_cur."!cursor_pos"(rx1230_pos)
+    $P10 = rx1230_cur."EXPR"()
+    unless $P10, rx1230_fail
+    rx1230_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("condition")
+    rx1230_pos = $P10."pos"()
+  alt1233_0:
+    set_addr $I10, alt1233_1
+    rx1230_cur."!mark_push"(0, rx1230_pos, $I10)
+  # rx literal  ")"
+    add $I11, rx1230_pos, 1
+    gt $I11, rx1230_eos, rx1230_fail
+    sub $I11, rx1230_pos, rx1230_off
+    ord $I11, rx1230_tgt, $I11
+    ne $I11, 41, rx1230_fail
+    add rx1230_pos, 1
+    goto alt1233_end
+  alt1233_1:
+  # rx subrule "FAILGOAL" subtype=method negate=
+    rx1230_cur."!cursor_pos"(rx1230_pos)
+    $P10 = rx1230_cur."FAILGOAL"("')'")
+    unless $P10, rx1230_fail
+    goto rxsubrule1234_pass
+  rxsubrule1234_back:
+    $P10 = $P10."!cursor_next"()
+    unless $P10, rx1230_fail
+  rxsubrule1234_pass:
+    set_addr $I10, rxsubrule1234_back
+    rx1230_cur."!mark_push"(0, rx1230_pos, $I10, $P10)
+    rx1230_pos = $P10."pos"()
+  alt1233_end:
+  # rx subrule "ws" subtype=method negate=
+    rx1230_cur."!cursor_pos"(rx1230_pos)
+    $P10 = rx1230_cur."ws"()
+    unless $P10, rx1230_fail
+    rx1230_pos = $P10."pos"()
+.annotate 'line', 210
+  # rx pass
+    rx1230_cur."!cursor_pass"(rx1230_pos, "statement_control:sym<do-while>")
+    if_null rx1230_debug, debug_393
+    rx1230_cur."!cursor_debug"("PASS", "statement_control:sym<do-while>", " at pos=", rx1230_pos)
+  debug_393:
+    .return (rx1230_cur)
+  rx1230_restart:
+.annotate 'line', 8
+    if_null rx1230_debug, debug_394
+    rx1230_cur."!cursor_debug"("NEXT", "statement_control:sym<do-while>")
+  debug_394:
+  rx1230_fail:
+    (rx1230_rep, rx1230_pos, $I10, $P10) = rx1230_cur."!mark_fail"(0)
+    lt rx1230_pos, -1, rx1230_done
+    eq rx1230_pos, -1, rx1230_fail
+    jump $I10
+  rx1230_done:
+    rx1230_cur."!cursor_fail"()
+    if_null rx1230_debug, debug_395
+    rx1230_cur."!cursor_debug"("FAIL", "statement_control:sym<do-while>")
+  debug_395:
+    .return (rx1230_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__statement_control:sym<do-while>"  :subid("95_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("ws", "")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "statement_control:sym<switch>"  :subid("96_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1236_tgt
+    .local int rx1236_pos
+    .local int rx1236_off
+    .local int rx1236_eos
+    .local int rx1236_rep
+    .local pmc rx1236_cur
+    .local pmc rx1236_debug
+    (rx1236_cur, rx1236_pos, rx1236_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1236_debug, rx1236_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1236_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1236_eos, rx1236_tgt
+    gt rx1236_pos, rx1236_eos, rx1236_done
+    set rx1236_off, 0
+    lt rx1236_pos, 2, rx1236_start
+    sub rx1236_off, rx1236_pos, 1
+    substr rx1236_tgt, rx1236_tgt, rx1236_off
+  rx1236_start:
+    eq $I10, 1, rx1236_restart
+    if_null rx1236_debug, debug_396
+    rx1236_cur."!cursor_debug"("START", "statement_control:sym<switch>")
+  debug_396:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1238_done
+    goto rxscan1238_scan
+  rxscan1238_loop:
+    ($P10) = rx1236_cur."from"()
+    inc $P10
+    set rx1236_pos, $P10
+    ge rx1236_pos, rx1236_eos, rxscan1238_done
+  rxscan1238_scan:
+    set_addr $I10, rxscan1238_loop
+    rx1236_cur."!mark_push"(0, rx1236_pos, $I10)
+  rxscan1238_done:
+.annotate 'line', 215
+  # rx subrule "ws" subtype=method negate=
+    rx1236_cur."!cursor_pos"(rx1236_pos)
+    $P10 = rx1236_cur."ws"()
+    unless $P10, rx1236_fail
+    rx1236_pos = $P10."pos"()
+.annotate 'line', 216
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1239_fail
+    rx1236_cur."!mark_push"(0, rx1236_pos, $I10)
+  # rx literal  "switch"
+    add $I11, rx1236_pos, 6
+    gt $I11, rx1236_eos, rx1236_fail
+    sub $I11, rx1236_pos, rx1236_off
+    substr $S10, rx1236_tgt, $I11, 6
+    ne $S10, "switch", rx1236_fail
+    add rx1236_pos, 6
+    set_addr $I10, rxcap_1239_fail
+    ($I12, $I11) = rx1236_cur."!mark_peek"($I10)
+    rx1236_cur."!cursor_pos"($I11)
+    ($P10) = rx1236_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1236_pos, "")
+    rx1236_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1239_done
+  rxcap_1239_fail:
+    goto rx1236_fail
+  rxcap_1239_done:
+  # rx subrule "ws" subtype=method negate=
+    rx1236_cur."!cursor_pos"(rx1236_pos)
+    $P10 = rx1236_cur."ws"()
+    unless $P10, rx1236_fail
+    rx1236_pos = $P10."pos"()
+  # rx literal  "("
+    add $I11, rx1236_pos, 1
+    gt $I11, rx1236_eos, rx1236_fail
+    sub $I11, rx1236_pos, rx1236_off
+    ord $I11, rx1236_tgt, $I11
+    ne $I11, 40, rx1236_fail
+    add rx1236_pos, 1
+  # rx subrule "ws" subtype=method negate=
+    rx1236_cur."!cursor_pos"(rx1236_pos)
+    $P10 = rx1236_cur."ws"()
+    unless $P10, rx1236_fail
+    rx1236_pos = $P10."pos"()
+  # rx subrule "EXPR" subtype=capture negate=
+    rx1236_cur."!cursor_pos"(rx1236_pos)
+    $P10 = rx1236_cur."EXPR"()
+    unless $P10, rx1236_fail
+    rx1236_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("test")
+    rx1236_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1236_cur."!cursor_pos"(rx1236_pos)
+    $P10 = rx1236_cur."ws"()
+    unless $P10, rx1236_fail
+    rx1236_pos = $P10."pos"()
+  # rx literal  ")"
+    add $I11, rx1236_pos, 1
+    gt $I11, rx1236_eos, rx1236_fail
+    sub $I11, rx1236_pos, rx1236_off
+    ord $I11, rx1236_tgt, $I11
+    ne $I11, 41, rx1236_fail
+    add rx1236_pos, 1
+  # rx subrule "ws" subtype=method negate=
+    rx1236_cur."!cursor_pos"(rx1236_pos)
+    $P10 = rx1236_cur."ws"()
+    unless $P10, rx1236_fail
+    rx1236_pos = $P10."pos"()
+  # rx literal  "{"
+    add $I11, rx1236_pos, 1
+    gt $I11, rx1236_eos, rx1236_fail
+    sub $I11, rx1236_pos, rx1236_off
+    ord $I11, rx1236_tgt, $I11
+    ne $I11, 123, rx1236_fail
+    add rx1236_pos, 1
+  # rx subrule "ws" subtype=method negate=
+    rx1236_cur."!cursor_pos"(rx1236_pos)
+    $P10 = rx1236_cur."ws"()
+    unless $P10, rx1236_fail
+    rx1236_pos = $P10."pos"()
+.annotate 'line', 217
+  # rx subrule "statement_list" subtype=capture negate=
+    rx1236_cur."!cursor_pos"(rx1236_pos)
+    $P10 = rx1236_cur."statement_list"()
+    unless $P10, rx1236_fail
+    rx1236_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("statement_list")
+    rx1236_pos = $P10."pos"()
+  alt1240_0:
+    set_addr $I10, alt1240_1
+    rx1236_cur."!mark_push"(0, rx1236_pos, $I10)
+.annotate 'line', 216
+  # rx literal  "}"
+    add $I11, rx1236_pos, 1
+    gt $I11, rx1236_eos, rx1236_fail
+    sub $I11, rx1236_pos, rx1236_off
+    ord $I11, rx1236_tgt, $I11
+    ne $I11, 125, rx1236_fail
+    add rx1236_pos, 1
+    goto alt1240_end
+  alt1240_1:
+  # rx subrule "FAILGOAL" subtype=method negate=
+    rx1236_cur."!cursor_pos"(rx1236_pos)
+    $P10 = rx1236_cur."FAILGOAL"("'}'")
+    unless $P10, rx1236_fail
+    goto rxsubrule1241_pass
+  rxsubrule1241_back:
+    $P10 = $P10."!cursor_next"()
+    unless $P10, rx1236_fail
+  rxsubrule1241_pass:
+    set_addr $I10, rxsubrule1241_back
+    rx1236_cur."!mark_push"(0, rx1236_pos, $I10, $P10)
+    rx1236_pos = $P10."pos"()
+  alt1240_end:
+.annotate 'line', 217
+  # rx subrule "ws" subtype=method negate=
+    rx1236_cur."!cursor_pos"(rx1236_pos)
+    $P10 = rx1236_cur."ws"()
+    unless $P10, rx1236_fail
+    rx1236_pos = $P10."pos"()
+.annotate 'line', 215
+  # rx pass
+    rx1236_cur."!cursor_pass"(rx1236_pos, "statement_control:sym<switch>")
+    if_null rx1236_debug, debug_397
+    rx1236_cur."!cursor_debug"("PASS", "statement_control:sym<switch>", " at pos=", rx1236_pos)
+  debug_397:
+    .return (rx1236_cur)
+  rx1236_restart:
+.annotate 'line', 8
+    if_null rx1236_debug, debug_398
+    rx1236_cur."!cursor_debug"("NEXT", "statement_control:sym<switch>")
+  debug_398:
+  rx1236_fail:
+    (rx1236_rep, rx1236_pos, $I10, $P10) = rx1236_cur."!mark_fail"(0)
+    lt rx1236_pos, -1, rx1236_done
+    eq rx1236_pos, -1, rx1236_fail
+    jump $I10
+  rx1236_done:
+    rx1236_cur."!cursor_fail"()
+    if_null rx1236_debug, debug_399
+    rx1236_cur."!cursor_debug"("FAIL", "statement_control:sym<switch>")
+  debug_399:
+    .return (rx1236_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__statement_control:sym<switch>"  :subid("97_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("ws", "")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "statement_control:sym<break>"  :subid("98_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1243_tgt
+    .local int rx1243_pos
+    .local int rx1243_off
+    .local int rx1243_eos
+    .local int rx1243_rep
+    .local pmc rx1243_cur
+    .local pmc rx1243_debug
+    (rx1243_cur, rx1243_pos, rx1243_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1243_debug, rx1243_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1243_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1243_eos, rx1243_tgt
+    gt rx1243_pos, rx1243_eos, rx1243_done
+    set rx1243_off, 0
+    lt rx1243_pos, 2, rx1243_start
+    sub rx1243_off, rx1243_pos, 1
+    substr rx1243_tgt, rx1243_tgt, rx1243_off
+  rx1243_start:
+    eq $I10, 1, rx1243_restart
+    if_null rx1243_debug, debug_400
+    rx1243_cur."!cursor_debug"("START", "statement_control:sym<break>")
+  debug_400:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1245_done
+    goto rxscan1245_scan
+  rxscan1245_loop:
+    ($P10) = rx1243_cur."from"()
+    inc $P10
+    set rx1243_pos, $P10
+    ge rx1243_pos, rx1243_eos, rxscan1245_done
+  rxscan1245_scan:
+    set_addr $I10, rxscan1245_loop
+    rx1243_cur."!mark_push"(0, rx1243_pos, $I10)
+  rxscan1245_done:
+.annotate 'line', 220
+  # rx subrule "ws" subtype=method negate=
+    rx1243_cur."!cursor_pos"(rx1243_pos)
+    $P10 = rx1243_cur."ws"()
+    unless $P10, rx1243_fail
+    rx1243_pos = $P10."pos"()
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1246_fail
+    rx1243_cur."!mark_push"(0, rx1243_pos, $I10)
+  # rx literal  "break"
+    add $I11, rx1243_pos, 5
+    gt $I11, rx1243_eos, rx1243_fail
+    sub $I11, rx1243_pos, rx1243_off
+    substr $S10, rx1243_tgt, $I11, 5
+    ne $S10, "break", rx1243_fail
+    add rx1243_pos, 5
+    set_addr $I10, rxcap_1246_fail
+    ($I12, $I11) = rx1243_cur."!mark_peek"($I10)
+    rx1243_cur."!cursor_pos"($I11)
+    ($P10) = rx1243_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1243_pos, "")
+    rx1243_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1246_done
+  rxcap_1246_fail:
+    goto rx1243_fail
+  rxcap_1246_done:
+  # rx subrule "ws" subtype=method negate=
+    rx1243_cur."!cursor_pos"(rx1243_pos)
+    $P10 = rx1243_cur."ws"()
+    unless $P10, rx1243_fail
+    rx1243_pos = $P10."pos"()
+  # rx pass
+    rx1243_cur."!cursor_pass"(rx1243_pos, "statement_control:sym<break>")
+    if_null rx1243_debug, debug_401
+    rx1243_cur."!cursor_debug"("PASS", "statement_control:sym<break>", " at pos=", rx1243_pos)
+  debug_401:
+    .return (rx1243_cur)
+  rx1243_restart:
+.annotate 'line', 8
+    if_null rx1243_debug, debug_402
+    rx1243_cur."!cursor_debug"("NEXT", "statement_control:sym<break>")
+  debug_402:
+  rx1243_fail:
+    (rx1243_rep, rx1243_pos, $I10, $P10) = rx1243_cur."!mark_fail"(0)
+    lt rx1243_pos, -1, rx1243_done
+    eq rx1243_pos, -1, rx1243_fail
+    jump $I10
+  rx1243_done:
+    rx1243_cur."!cursor_fail"()
+    if_null rx1243_debug, debug_403
+    rx1243_cur."!cursor_debug"("FAIL", "statement_control:sym<break>")
+  debug_403:
+    .return (rx1243_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__statement_control:sym<break>"  :subid("99_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("ws", "")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "statement_control:sym<continue>"  :subid("100_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1248_tgt
+    .local int rx1248_pos
+    .local int rx1248_off
+    .local int rx1248_eos
+    .local int rx1248_rep
+    .local pmc rx1248_cur
+    .local pmc rx1248_debug
+    (rx1248_cur, rx1248_pos, rx1248_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1248_debug, rx1248_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1248_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1248_eos, rx1248_tgt
+    gt rx1248_pos, rx1248_eos, rx1248_done
+    set rx1248_off, 0
+    lt rx1248_pos, 2, rx1248_start
+    sub rx1248_off, rx1248_pos, 1
+    substr rx1248_tgt, rx1248_tgt, rx1248_off
+  rx1248_start:
+    eq $I10, 1, rx1248_restart
+    if_null rx1248_debug, debug_404
+    rx1248_cur."!cursor_debug"("START", "statement_control:sym<continue>")
+  debug_404:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1250_done
+    goto rxscan1250_scan
+  rxscan1250_loop:
+    ($P10) = rx1248_cur."from"()
+    inc $P10
+    set rx1248_pos, $P10
+    ge rx1248_pos, rx1248_eos, rxscan1250_done
+  rxscan1250_scan:
+    set_addr $I10, rxscan1250_loop
+    rx1248_cur."!mark_push"(0, rx1248_pos, $I10)
+  rxscan1250_done:
+.annotate 'line', 221
+  # rx subrule "ws" subtype=method negate=
+    rx1248_cur."!cursor_pos"(rx1248_pos)
+    $P10 = rx1248_cur."ws"()
+    unless $P10, rx1248_fail
+    rx1248_pos = $P10."pos"()
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1251_fail
+    rx1248_cur."!mark_push"(0, rx1248_pos, $I10)
+  # rx literal  "continue"
+    add $I11, rx1248_pos, 8
+    gt $I11, rx1248_eos, rx1248_fail
+    sub $I11, rx1248_pos, rx1248_off
+    substr $S10, rx1248_tgt, $I11, 8
+    ne $S10, "continue", rx1248_fail
+    add rx1248_pos, 8
+    set_addr $I10, rxcap_1251_fail
+    ($I12, $I11) = rx1248_cur."!mark_peek"($I10)
+    rx1248_cur."!cursor_pos"($I11)
+    ($P10) = rx1248_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1248_pos, "")
+    rx1248_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1251_done
+  rxcap_1251_fail:
+    goto rx1248_fail
+  rxcap_1251_done:
+  # rx subrule "ws" subtype=method negate=
+    rx1248_cur."!cursor_pos"(rx1248_pos)
+    $P10 = rx1248_cur."ws"()
+    unless $P10, rx1248_fail
+    rx1248_pos = $P10."pos"()
+  # rx pass
+    rx1248_cur."!cursor_pass"(rx1248_pos, "statement_control:sym<continue>")
+    if_null rx1248_debug, debug_405
+    rx1248_cur."!cursor_debug"("PASS", "statement_control:sym<continue>", " at pos=", rx1248_pos)
+  debug_405:
+    .return (rx1248_cur)
+  rx1248_restart:
+.annotate 'line', 8
+    if_null rx1248_debug, debug_406
+    rx1248_cur."!cursor_debug"("NEXT", "statement_control:sym<continue>")
+  debug_406:
+  rx1248_fail:
+    (rx1248_rep, rx1248_pos, $I10, $P10) = rx1248_cur."!mark_fail"(0)
+    lt rx1248_pos, -1, rx1248_done
+    eq rx1248_pos, -1, rx1248_fail
+    jump $I10
+  rx1248_done:
+    rx1248_cur."!cursor_fail"()
+    if_null rx1248_debug, debug_407
+    rx1248_cur."!cursor_debug"("FAIL", "statement_control:sym<continue>")
+  debug_407:
+    .return (rx1248_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__statement_control:sym<continue>"  :subid("101_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("ws", "")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "statement_or_block"  :subid("102_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1253_tgt
+    .local int rx1253_pos
+    .local int rx1253_off
+    .local int rx1253_eos
+    .local int rx1253_rep
+    .local pmc rx1253_cur
+    .local pmc rx1253_debug
+    (rx1253_cur, rx1253_pos, rx1253_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1253_debug, rx1253_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1253_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1253_eos, rx1253_tgt
+    gt rx1253_pos, rx1253_eos, rx1253_done
+    set rx1253_off, 0
+    lt rx1253_pos, 2, rx1253_start
+    sub rx1253_off, rx1253_pos, 1
+    substr rx1253_tgt, rx1253_tgt, rx1253_off
+  rx1253_start:
+    eq $I10, 1, rx1253_restart
+    if_null rx1253_debug, debug_408
+    rx1253_cur."!cursor_debug"("START", "statement_or_block")
+  debug_408:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1255_done
+    goto rxscan1255_scan
+  rxscan1255_loop:
+    ($P10) = rx1253_cur."from"()
+    inc $P10
+    set rx1253_pos, $P10
+    ge rx1253_pos, rx1253_eos, rxscan1255_done
+  rxscan1255_scan:
+    set_addr $I10, rxscan1255_loop
+    rx1253_cur."!mark_push"(0, rx1253_pos, $I10)
+  rxscan1255_done:
+  alt1256_0:
+.annotate 'line', 223
+    set_addr $I10, alt1256_1
+    rx1253_cur."!mark_push"(0, rx1253_pos, $I10)
+.annotate 'line', 224
+  # rx subrule "blockoid" subtype=capture negate=
+    rx1253_cur."!cursor_pos"(rx1253_pos)
+    $P10 = rx1253_cur."blockoid"()
+    unless $P10, rx1253_fail
+    rx1253_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("blockoid")
+    rx1253_pos = $P10."pos"()
+    goto alt1256_end
+  alt1256_1:
+.annotate 'line', 225
+  # rx subrule "labeled_statement" subtype=capture negate=
+    rx1253_cur."!cursor_pos"(rx1253_pos)
+    $P10 = rx1253_cur."labeled_statement"()
+    unless $P10, rx1253_fail
+    rx1253_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("labeled_statement")
+    rx1253_pos = $P10."pos"()
+  # rx subrule "eat_terminator" subtype=method negate=
+    rx1253_cur."!cursor_pos"(rx1253_pos)
+    $P10 = rx1253_cur."eat_terminator"()
+    unless $P10, rx1253_fail
+    rx1253_pos = $P10."pos"()
+  alt1256_end:
+.annotate 'line', 223
+  # rx pass
+    rx1253_cur."!cursor_pass"(rx1253_pos, "statement_or_block")
+    if_null rx1253_debug, debug_409
+    rx1253_cur."!cursor_debug"("PASS", "statement_or_block", " at pos=", rx1253_pos)
+  debug_409:
+    .return (rx1253_cur)
+  rx1253_restart:
+.annotate 'line', 8
+    if_null rx1253_debug, debug_410
+    rx1253_cur."!cursor_debug"("NEXT", "statement_or_block")
+  debug_410:
+  rx1253_fail:
+    (rx1253_rep, rx1253_pos, $I10, $P10) = rx1253_cur."!mark_fail"(0)
+    lt rx1253_pos, -1, rx1253_done
+    eq rx1253_pos, -1, rx1253_fail
+    jump $I10
+  rx1253_done:
+    rx1253_cur."!cursor_fail"()
+    if_null rx1253_debug, debug_411
+    rx1253_cur."!cursor_debug"("FAIL", "statement_or_block")
+  debug_411:
+    .return (rx1253_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__statement_or_block"  :subid("103_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("labeled_statement", "")
+    $P101 = self."!PREFIX__!subrule"("blockoid", "")
+    new $P102, "ResizablePMCArray"
+    push $P102, $P100
+    push $P102, $P101
+    .return ($P102)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "term:sym<concatenate_strings>"  :subid("104_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1258_tgt
+    .local int rx1258_pos
+    .local int rx1258_off
+    .local int rx1258_eos
+    .local int rx1258_rep
+    .local pmc rx1258_cur
+    .local pmc rx1258_debug
+    (rx1258_cur, rx1258_pos, rx1258_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1258_debug, rx1258_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1258_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1258_eos, rx1258_tgt
+    gt rx1258_pos, rx1258_eos, rx1258_done
+    set rx1258_off, 0
+    lt rx1258_pos, 2, rx1258_start
+    sub rx1258_off, rx1258_pos, 1
+    substr rx1258_tgt, rx1258_tgt, rx1258_off
+  rx1258_start:
+    eq $I10, 1, rx1258_restart
+    if_null rx1258_debug, debug_412
+    rx1258_cur."!cursor_debug"("START", "term:sym<concatenate_strings>")
+  debug_412:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1260_done
+    goto rxscan1260_scan
+  rxscan1260_loop:
+    ($P10) = rx1258_cur."from"()
+    inc $P10
+    set rx1258_pos, $P10
+    ge rx1258_pos, rx1258_eos, rxscan1260_done
+  rxscan1260_scan:
+    set_addr $I10, rxscan1260_loop
+    rx1258_cur."!mark_push"(0, rx1258_pos, $I10)
+  rxscan1260_done:
+.annotate 'line', 230
+  # rx subrule "identifier" subtype=capture negate=
+    rx1258_cur."!cursor_pos"(rx1258_pos)
+    $P10 = rx1258_cur."identifier"()
+    unless $P10, rx1258_fail
+    rx1258_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("identifier")
+    rx1258_pos = $P10."pos"()
+  # rx charclass_q s r 1..-1
+    sub $I10, rx1258_pos, rx1258_off
+    find_not_cclass $I11, 32, rx1258_tgt, $I10, rx1258_eos
+    add $I12, $I10, 1
+    lt $I11, $I12, rx1258_fail
+    add rx1258_pos, rx1258_off, $I11
+  # rx subrule "quote" subtype=capture negate=
+    rx1258_cur."!cursor_pos"(rx1258_pos)
+    $P10 = rx1258_cur."quote"()
+    unless $P10, rx1258_fail
+    rx1258_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("quote")
+    rx1258_pos = $P10."pos"()
+.annotate 'line', 229
+  # rx pass
+    rx1258_cur."!cursor_pass"(rx1258_pos, "term:sym<concatenate_strings>")
+    if_null rx1258_debug, debug_413
+    rx1258_cur."!cursor_debug"("PASS", "term:sym<concatenate_strings>", " at pos=", rx1258_pos)
+  debug_413:
+    .return (rx1258_cur)
+  rx1258_restart:
+.annotate 'line', 8
+    if_null rx1258_debug, debug_414
+    rx1258_cur."!cursor_debug"("NEXT", "term:sym<concatenate_strings>")
+  debug_414:
+  rx1258_fail:
+    (rx1258_rep, rx1258_pos, $I10, $P10) = rx1258_cur."!mark_fail"(0)
+    lt rx1258_pos, -1, rx1258_done
+    eq rx1258_pos, -1, rx1258_fail
+    jump $I10
+  rx1258_done:
+    rx1258_cur."!cursor_fail"()
+    if_null rx1258_debug, debug_415
+    rx1258_cur."!cursor_debug"("FAIL", "term:sym<concatenate_strings>")
+  debug_415:
+    .return (rx1258_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__term:sym<concatenate_strings>"  :subid("105_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("identifier", "")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "term:sym<call>"  :subid("106_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1262_tgt
+    .local int rx1262_pos
+    .local int rx1262_off
+    .local int rx1262_eos
+    .local int rx1262_rep
+    .local pmc rx1262_cur
+    .local pmc rx1262_debug
+    (rx1262_cur, rx1262_pos, rx1262_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1262_debug, rx1262_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1262_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1262_eos, rx1262_tgt
+    gt rx1262_pos, rx1262_eos, rx1262_done
+    set rx1262_off, 0
+    lt rx1262_pos, 2, rx1262_start
+    sub rx1262_off, rx1262_pos, 1
+    substr rx1262_tgt, rx1262_tgt, rx1262_off
+  rx1262_start:
+    eq $I10, 1, rx1262_restart
+    if_null rx1262_debug, debug_416
+    rx1262_cur."!cursor_debug"("START", "term:sym<call>")
+  debug_416:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1264_done
+    goto rxscan1264_scan
+  rxscan1264_loop:
+    ($P10) = rx1262_cur."from"()
+    inc $P10
+    set rx1262_pos, $P10
+    ge rx1262_pos, rx1262_eos, rxscan1264_done
+  rxscan1264_scan:
+    set_addr $I10, rxscan1264_loop
+    rx1262_cur."!mark_push"(0, rx1262_pos, $I10)
+  rxscan1264_done:
+.annotate 'line', 234
+  # rx subrule "identifier" subtype=capture negate=
+    rx1262_cur."!cursor_pos"(rx1262_pos)
+    $P10 = rx1262_cur."identifier"()
+    unless $P10, rx1262_fail
+    rx1262_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("identifier")
+    rx1262_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1262_cur."!cursor_pos"(rx1262_pos)
+    $P10 = rx1262_cur."ws"()
+    unless $P10, rx1262_fail
+    rx1262_pos = $P10."pos"()
+  # rx literal  "("
+    add $I11, rx1262_pos, 1
+    gt $I11, rx1262_eos, rx1262_fail
+    sub $I11, rx1262_pos, rx1262_off
+    ord $I11, rx1262_tgt, $I11
+    ne $I11, 40, rx1262_fail
+    add rx1262_pos, 1
+  # rx subrule "arglist" subtype=capture negate=
+    rx1262_cur."!cursor_pos"(rx1262_pos)
+    $P10 = rx1262_cur."arglist"()
+    unless $P10, rx1262_fail
+    rx1262_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("arglist")
+    rx1262_pos = $P10."pos"()
+  alt1265_0:
+    set_addr $I10, alt1265_1
+    rx1262_cur."!mark_push"(0, rx1262_pos, $I10)
+  # rx literal  ")"
+    add $I11, rx1262_pos, 1
+    gt $I11, rx1262_eos, rx1262_fail
+    sub $I11, rx1262_pos, rx1262_off
+    ord $I11, rx1262_tgt, $I11
+    ne $I11, 41, rx1262_fail
+    add rx1262_pos, 1
+    goto alt1265_end
+  alt1265_1:
+  # rx subrule "FAILGOAL" subtype=method negate=
+    rx1262_cur."!cursor_pos"(rx1262_pos)
+    $P10 = rx1262_cur."FAILGOAL"("')'")
+    unless $P10, rx1262_fail
+    goto rxsubrule1266_pass
+  rxsubrule1266_back:
+    $P10 = $P10."!cursor_next"()
+    unless $P10, rx1262_fail
+  rxsubrule1266_pass:
+    set_addr $I10, rxsubrule1266_back
+    rx1262_cur."!mark_push"(0, rx1262_pos, $I10, $P10)
+    rx1262_pos = $P10."pos"()
+  alt1265_end:
+.annotate 'line', 233
+  # rx pass
+    rx1262_cur."!cursor_pass"(rx1262_pos, "term:sym<call>")
+    if_null rx1262_debug, debug_417
+    rx1262_cur."!cursor_debug"("PASS", "term:sym<call>", " at pos=", rx1262_pos)
+  debug_417:
+    .return (rx1262_cur)
+  rx1262_restart:
+.annotate 'line', 8
+    if_null rx1262_debug, debug_418
+    rx1262_cur."!cursor_debug"("NEXT", "term:sym<call>")
+  debug_418:
+  rx1262_fail:
+    (rx1262_rep, rx1262_pos, $I10, $P10) = rx1262_cur."!mark_fail"(0)
+    lt rx1262_pos, -1, rx1262_done
+    eq rx1262_pos, -1, rx1262_fail
+    jump $I10
+  rx1262_done:
+    rx1262_cur."!cursor_fail"()
+    if_null rx1262_debug, debug_419
+    rx1262_cur."!cursor_debug"("FAIL", "term:sym<call>")
+  debug_419:
+    .return (rx1262_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__term:sym<call>"  :subid("107_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("identifier", "")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "term:sym<int>"  :subid("108_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .const 'Sub' $P1273 = "110_1792415686.23593" 
+    capture_lex $P1273
+    .local string rx1268_tgt
+    .local int rx1268_pos
+    .local int rx1268_off
+    .local int rx1268_eos
+    .local int rx1268_rep
+    .local pmc rx1268_cur
+    .local pmc rx1268_debug
+    (rx1268_cur, rx1268_pos, rx1268_tgt, $I10) = self."!cursor_start"()
+    rx1268_cur."!cursor_caparray"("0")
+    getattribute rx1268_debug, rx1268_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1268_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1268_eos, rx1268_tgt
+    gt rx1268_pos, rx1268_eos, rx1268_done
+    set rx1268_off, 0
+    lt rx1268_pos, 2, rx1268_start
+    sub rx1268_off, rx1268_pos, 1
+    substr rx1268_tgt, rx1268_tgt, rx1268_off
+  rx1268_start:
+    eq $I10, 1, rx1268_restart
+    if_null rx1268_debug, debug_420
+    rx1268_cur."!cursor_debug"("START", "term:sym<int>")
+  debug_420:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1270_done
+    goto rxscan1270_scan
+  rxscan1270_loop:
+    ($P10) = rx1268_cur."from"()
+    inc $P10
+    set rx1268_pos, $P10
+    ge rx1268_pos, rx1268_eos, rxscan1270_done
+  rxscan1270_scan:
+    set_addr $I10, rxscan1270_loop
+    rx1268_cur."!mark_push"(0, rx1268_pos, $I10)
+  rxscan1270_done:
+.annotate 'line', 237
+  # rx subrule "integer" subtype=capture negate=
+    rx1268_cur."!cursor_pos"(rx1268_pos)
+    $P10 = rx1268_cur."integer"()
+    unless $P10, rx1268_fail
+    rx1268_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("integer")
+    rx1268_pos = $P10."pos"()
+  # rx rxquantr1271 ** 0..*
+    set_addr $I10, rxquantr1271_done
+    rx1268_cur."!mark_push"(0, rx1268_pos, $I10)
+  rxquantr1271_loop:
+  # rx subrule $P1273 subtype=capture negate=
+    rx1268_cur."!cursor_pos"(rx1268_pos)
+    .const 'Sub' $P1273 = "110_1792415686.23593" 
+    capture_lex $P1273
+    $P10 = rx1268_cur.$P1273()
+    unless $P10, rx1268_fail
+    goto rxsubrule1277_pass
+  rxsubrule1277_back:
+    $P10 = $P10."!cursor_next"()
+    unless $P10, rx1268_fail
+  rxsubrule1277_pass:
+    set_addr $I10, rxsubrule1277_back
+    rx1268_cur."!mark_push"(0, rx1268_pos, $I10, $P10)
+    $P10."!cursor_names"(0)
+    rx1268_pos = $P10."pos"()
+    set_addr $I10, rxquantr1271_done
+    (rx1268_rep) = rx1268_cur."!mark_commit"($I10)
+    set_addr $I10, rxquantr1271_done
+    rx1268_cur."!mark_push"(rx1268_rep, rx1268_pos, $I10)
+    goto rxquantr1271_loop
+  rxquantr1271_done:
+  # rx pass
+    rx1268_cur."!cursor_pass"(rx1268_pos, "term:sym<int>")
+    if_null rx1268_debug, debug_425
+    rx1268_cur."!cursor_debug"("PASS", "term:sym<int>", " at pos=", rx1268_pos)
+  debug_425:
+    .return (rx1268_cur)
+  rx1268_restart:
+.annotate 'line', 8
+    if_null rx1268_debug, debug_426
+    rx1268_cur."!cursor_debug"("NEXT", "term:sym<int>")
+  debug_426:
+  rx1268_fail:
+    (rx1268_rep, rx1268_pos, $I10, $P10) = rx1268_cur."!mark_fail"(0)
+    lt rx1268_pos, -1, rx1268_done
+    eq rx1268_pos, -1, rx1268_fail
+    jump $I10
+  rx1268_done:
+    rx1268_cur."!cursor_fail"()
+    if_null rx1268_debug, debug_427
+    rx1268_cur."!cursor_debug"("FAIL", "term:sym<int>")
+  debug_427:
+    .return (rx1268_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__term:sym<int>"  :subid("109_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("integer", "")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "_block1272"  :anon :subid("110_1792415686.23593") :method :outer("108_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 237
+    .local string rx1274_tgt
+    .local int rx1274_pos
+    .local int rx1274_off
+    .local int rx1274_eos
+    .local int rx1274_rep
+    .local pmc rx1274_cur
+    .local pmc rx1274_debug
+    (rx1274_cur, rx1274_pos, rx1274_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1274_debug, rx1274_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1274_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1274_eos, rx1274_tgt
+    gt rx1274_pos, rx1274_eos, rx1274_done
+    set rx1274_off, 0
+    lt rx1274_pos, 2, rx1274_start
+    sub rx1274_off, rx1274_pos, 1
+    substr rx1274_tgt, rx1274_tgt, rx1274_off
+  rx1274_start:
+    eq $I10, 1, rx1274_restart
+    if_null rx1274_debug, debug_421
+    rx1274_cur."!cursor_debug"("START", "")
+  debug_421:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1275_done
+    goto rxscan1275_scan
+  rxscan1275_loop:
+    ($P10) = rx1274_cur."from"()
+    inc $P10
+    set rx1274_pos, $P10
+    ge rx1274_pos, rx1274_eos, rxscan1275_done
+  rxscan1275_scan:
+    set_addr $I10, rxscan1275_loop
+    rx1274_cur."!mark_push"(0, rx1274_pos, $I10)
+  rxscan1275_done:
+  alt1276_0:
+    set_addr $I10, alt1276_1
+    rx1274_cur."!mark_push"(0, rx1274_pos, $I10)
+  # rx literal  "u"
+    add $I11, rx1274_pos, 1
+    gt $I11, rx1274_eos, rx1274_fail
+    sub $I11, rx1274_pos, rx1274_off
+    ord $I11, rx1274_tgt, $I11
+    ne $I11, 117, rx1274_fail
+    add rx1274_pos, 1
+    goto alt1276_end
+  alt1276_1:
+    set_addr $I10, alt1276_2
+    rx1274_cur."!mark_push"(0, rx1274_pos, $I10)
+  # rx literal  "U"
+    add $I11, rx1274_pos, 1
+    gt $I11, rx1274_eos, rx1274_fail
+    sub $I11, rx1274_pos, rx1274_off
+    ord $I11, rx1274_tgt, $I11
+    ne $I11, 85, rx1274_fail
+    add rx1274_pos, 1
+    goto alt1276_end
+  alt1276_2:
+    set_addr $I10, alt1276_3
+    rx1274_cur."!mark_push"(0, rx1274_pos, $I10)
+  # rx literal  "l"
+    add $I11, rx1274_pos, 1
+    gt $I11, rx1274_eos, rx1274_fail
+    sub $I11, rx1274_pos, rx1274_off
+    ord $I11, rx1274_tgt, $I11
+    ne $I11, 108, rx1274_fail
+    add rx1274_pos, 1
+    goto alt1276_end
+  alt1276_3:
+  # rx literal  "L"
+    add $I11, rx1274_pos, 1
+    gt $I11, rx1274_eos, rx1274_fail
+    sub $I11, rx1274_pos, rx1274_off
+    ord $I11, rx1274_tgt, $I11
+    ne $I11, 76, rx1274_fail
+    add rx1274_pos, 1
+  alt1276_end:
+  # rx pass
+    rx1274_cur."!cursor_pass"(rx1274_pos, "")
+    if_null rx1274_debug, debug_422
+    rx1274_cur."!cursor_debug"("PASS", "", " at pos=", rx1274_pos)
+  debug_422:
+    .return (rx1274_cur)
+  rx1274_restart:
+    if_null rx1274_debug, debug_423
+    rx1274_cur."!cursor_debug"("NEXT", "")
+  debug_423:
+  rx1274_fail:
+    (rx1274_rep, rx1274_pos, $I10, $P10) = rx1274_cur."!mark_fail"(0)
+    lt rx1274_pos, -1, rx1274_done
+    eq rx1274_pos, -1, rx1274_fail
+    jump $I10
+  rx1274_done:
+    rx1274_cur."!cursor_fail"()
+    if_null rx1274_debug, debug_424
+    rx1274_cur."!cursor_debug"("FAIL", "")
+  debug_424:
+    .return (rx1274_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "term:sym<str>"  :subid("111_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1279_tgt
+    .local int rx1279_pos
+    .local int rx1279_off
+    .local int rx1279_eos
+    .local int rx1279_rep
+    .local pmc rx1279_cur
+    .local pmc rx1279_debug
+    (rx1279_cur, rx1279_pos, rx1279_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1279_debug, rx1279_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1279_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1279_eos, rx1279_tgt
+    gt rx1279_pos, rx1279_eos, rx1279_done
+    set rx1279_off, 0
+    lt rx1279_pos, 2, rx1279_start
+    sub rx1279_off, rx1279_pos, 1
+    substr rx1279_tgt, rx1279_tgt, rx1279_off
+  rx1279_start:
+    eq $I10, 1, rx1279_restart
+    if_null rx1279_debug, debug_428
+    rx1279_cur."!cursor_debug"("START", "term:sym<str>")
+  debug_428:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1281_done
+    goto rxscan1281_scan
+  rxscan1281_loop:
+    ($P10) = rx1279_cur."from"()
+    inc $P10
+    set rx1279_pos, $P10
+    ge rx1279_pos, rx1279_eos, rxscan1281_done
+  rxscan1281_scan:
+    set_addr $I10, rxscan1281_loop
+    rx1279_cur."!mark_push"(0, rx1279_pos, $I10)
+  rxscan1281_done:
+.annotate 'line', 238
+  # rx subrule "quote" subtype=capture negate=
+    rx1279_cur."!cursor_pos"(rx1279_pos)
+    $P10 = rx1279_cur."quote"()
+    unless $P10, rx1279_fail
+    rx1279_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("quote")
+    rx1279_pos = $P10."pos"()
+  # rx pass
+    rx1279_cur."!cursor_pass"(rx1279_pos, "term:sym<str>")
+    if_null rx1279_debug, debug_429
+    rx1279_cur."!cursor_debug"("PASS", "term:sym<str>", " at pos=", rx1279_pos)
+  debug_429:
+    .return (rx1279_cur)
+  rx1279_restart:
+.annotate 'line', 8
+    if_null rx1279_debug, debug_430
+    rx1279_cur."!cursor_debug"("NEXT", "term:sym<str>")
+  debug_430:
+  rx1279_fail:
+    (rx1279_rep, rx1279_pos, $I10, $P10) = rx1279_cur."!mark_fail"(0)
+    lt rx1279_pos, -1, rx1279_done
+    eq rx1279_pos, -1, rx1279_fail
+    jump $I10
+  rx1279_done:
+    rx1279_cur."!cursor_fail"()
+    if_null rx1279_debug, debug_431
+    rx1279_cur."!cursor_debug"("FAIL", "term:sym<str>")
+  debug_431:
+    .return (rx1279_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__term:sym<str>"  :subid("112_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("quote", "")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "term:sym<float_constant_long>"  :subid("113_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .const 'Sub' $P1287 = "115_1792415686.23593" 
+    capture_lex $P1287
+    .local string rx1283_tgt
+    .local int rx1283_pos
+    .local int rx1283_off
+    .local int rx1283_eos
+    .local int rx1283_rep
+    .local pmc rx1283_cur
+    .local pmc rx1283_debug
+    (rx1283_cur, rx1283_pos, rx1283_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1283_debug, rx1283_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1283_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1283_eos, rx1283_tgt
+    gt rx1283_pos, rx1283_eos, rx1283_done
+    set rx1283_off, 0
+    lt rx1283_pos, 2, rx1283_start
+    sub rx1283_off, rx1283_pos, 1
+    substr rx1283_tgt, rx1283_tgt, rx1283_off
+  rx1283_start:
+    eq $I10, 1, rx1283_restart
+    if_null rx1283_debug, debug_432
+    rx1283_cur."!cursor_debug"("START", "term:sym<float_constant_long>")
+  debug_432:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1285_done
+    goto rxscan1285_scan
+  rxscan1285_loop:
+    ($P10) = rx1283_cur."from"()
+    inc $P10
+    set rx1283_pos, $P10
+    ge rx1283_pos, rx1283_eos, rxscan1285_done
+  rxscan1285_scan:
+    set_addr $I10, rxscan1285_loop
+    rx1283_cur."!mark_push"(0, rx1283_pos, $I10)
+  rxscan1285_done:
+.annotate 'line', 240
+  # rx subrule $P1287 subtype=capture negate=
+    rx1283_cur."!cursor_pos"(rx1283_pos)
+    .const 'Sub' $P1287 = "115_1792415686.23593" 
+    capture_lex $P1287
+    $P10 = rx1283_cur.$P1287()
+    unless $P10, rx1283_fail
+    rx1283_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"(0)
+    rx1283_pos = $P10."pos"()
+.annotate 'line', 244
+  # rx enumcharlist_q negate=0  r 0..1
+    sub $I10, rx1283_pos, rx1283_off
+    set rx1283_rep, 0
+    sub $I12, rx1283_eos, rx1283_pos
+    le $I12, 1, rxenumcharlistq1291_loop
+    set $I12, 1
+  rxenumcharlistq1291_loop:
+    le $I12, 0, rxenumcharlistq1291_done
+    substr $S10, rx1283_tgt, $I10, 1
+    index $I11, "fF", $S10
+    lt $I11, 0, rxenumcharlistq1291_done
+    inc rx1283_rep
+  rxenumcharlistq1291_done:
+    add rx1283_pos, rx1283_pos, rx1283_rep
+.annotate 'line', 239
+  # rx pass
+    rx1283_cur."!cursor_pass"(rx1283_pos, "term:sym<float_constant_long>")
+    if_null rx1283_debug, debug_437
+    rx1283_cur."!cursor_debug"("PASS", "term:sym<float_constant_long>", " at pos=", rx1283_pos)
+  debug_437:
+    .return (rx1283_cur)
+  rx1283_restart:
+.annotate 'line', 8
+    if_null rx1283_debug, debug_438
+    rx1283_cur."!cursor_debug"("NEXT", "term:sym<float_constant_long>")
+  debug_438:
+  rx1283_fail:
+    (rx1283_rep, rx1283_pos, $I10, $P10) = rx1283_cur."!mark_fail"(0)
+    lt rx1283_pos, -1, rx1283_done
+    eq rx1283_pos, -1, rx1283_fail
+    jump $I10
+  rx1283_done:
+    rx1283_cur."!cursor_fail"()
+    if_null rx1283_debug, debug_439
+    rx1283_cur."!cursor_debug"("FAIL", "term:sym<float_constant_long>")
+  debug_439:
+    .return (rx1283_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__term:sym<float_constant_long>"  :subid("114_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    new $P100, "ResizablePMCArray"
+    push $P100, ""
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "_block1286"  :anon :subid("115_1792415686.23593") :method :outer("113_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 240
+    .local string rx1288_tgt
+    .local int rx1288_pos
+    .local int rx1288_off
+    .local int rx1288_eos
+    .local int rx1288_rep
+    .local pmc rx1288_cur
+    .local pmc rx1288_debug
+    (rx1288_cur, rx1288_pos, rx1288_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1288_debug, rx1288_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1288_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1288_eos, rx1288_tgt
+    gt rx1288_pos, rx1288_eos, rx1288_done
+    set rx1288_off, 0
+    lt rx1288_pos, 2, rx1288_start
+    sub rx1288_off, rx1288_pos, 1
+    substr rx1288_tgt, rx1288_tgt, rx1288_off
+  rx1288_start:
+    eq $I10, 1, rx1288_restart
+    if_null rx1288_debug, debug_433
+    rx1288_cur."!cursor_debug"("START", "")
+  debug_433:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1289_done
+    goto rxscan1289_scan
+  rxscan1289_loop:
+    ($P10) = rx1288_cur."from"()
+    inc $P10
+    set rx1288_pos, $P10
+    ge rx1288_pos, rx1288_eos, rxscan1289_done
+  rxscan1289_scan:
+    set_addr $I10, rxscan1289_loop
+    rx1288_cur."!mark_push"(0, rx1288_pos, $I10)
+  rxscan1289_done:
+  alt1290_0:
+    set_addr $I10, alt1290_1
+    rx1288_cur."!mark_push"(0, rx1288_pos, $I10)
+.annotate 'line', 241
+  # rx charclass_q d r 1..-1
+    sub $I10, rx1288_pos, rx1288_off
+    find_not_cclass $I11, 8, rx1288_tgt, $I10, rx1288_eos
+    add $I12, $I10, 1
+    lt $I11, $I12, rx1288_fail
+    add rx1288_pos, rx1288_off, $I11
+  # rx literal  "."
+    add $I11, rx1288_pos, 1
+    gt $I11, rx1288_eos, rx1288_fail
+    sub $I11, rx1288_pos, rx1288_off
+    ord $I11, rx1288_tgt, $I11
+    ne $I11, 46, rx1288_fail
+    add rx1288_pos, 1
+  # rx charclass_q d r 0..-1
+    sub $I10, rx1288_pos, rx1288_off
+    find_not_cclass $I11, 8, rx1288_tgt, $I10, rx1288_eos
+    add rx1288_pos, rx1288_off, $I11
+    goto alt1290_end
+  alt1290_1:
+.annotate 'line', 242
+  # rx charclass_q d r 0..-1
+    sub $I10, rx1288_pos, rx1288_off
+    find_not_cclass $I11, 8, rx1288_tgt, $I10, rx1288_eos
+    add rx1288_pos, rx1288_off, $I11
+  # rx literal  "."
+    add $I11, rx1288_pos, 1
+    gt $I11, rx1288_eos, rx1288_fail
+    sub $I11, rx1288_pos, rx1288_off
+    ord $I11, rx1288_tgt, $I11
+    ne $I11, 46, rx1288_fail
+    add rx1288_pos, 1
+  # rx charclass_q d r 1..-1
+    sub $I10, rx1288_pos, rx1288_off
+    find_not_cclass $I11, 8, rx1288_tgt, $I10, rx1288_eos
+    add $I12, $I10, 1
+    lt $I11, $I12, rx1288_fail
+    add rx1288_pos, rx1288_off, $I11
+  alt1290_end:
+.annotate 'line', 240
+  # rx pass
+    rx1288_cur."!cursor_pass"(rx1288_pos, "")
+    if_null rx1288_debug, debug_434
+    rx1288_cur."!cursor_debug"("PASS", "", " at pos=", rx1288_pos)
+  debug_434:
+    .return (rx1288_cur)
+  rx1288_restart:
+    if_null rx1288_debug, debug_435
+    rx1288_cur."!cursor_debug"("NEXT", "")
+  debug_435:
+  rx1288_fail:
+    (rx1288_rep, rx1288_pos, $I10, $P10) = rx1288_cur."!mark_fail"(0)
+    lt rx1288_pos, -1, rx1288_done
+    eq rx1288_pos, -1, rx1288_fail
+    jump $I10
+  rx1288_done:
+    rx1288_cur."!cursor_fail"()
+    if_null rx1288_debug, debug_436
+    rx1288_cur."!cursor_debug"("FAIL", "")
+  debug_436:
+    .return (rx1288_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "term:sym<reg>"  :subid("116_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1293_tgt
+    .local int rx1293_pos
+    .local int rx1293_off
+    .local int rx1293_eos
+    .local int rx1293_rep
+    .local pmc rx1293_cur
+    .local pmc rx1293_debug
+    (rx1293_cur, rx1293_pos, rx1293_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1293_debug, rx1293_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1293_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1293_eos, rx1293_tgt
+    gt rx1293_pos, rx1293_eos, rx1293_done
+    set rx1293_off, 0
+    lt rx1293_pos, 2, rx1293_start
+    sub rx1293_off, rx1293_pos, 1
+    substr rx1293_tgt, rx1293_tgt, rx1293_off
+  rx1293_start:
+    eq $I10, 1, rx1293_restart
+    if_null rx1293_debug, debug_440
+    rx1293_cur."!cursor_debug"("START", "term:sym<reg>")
+  debug_440:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1295_done
+    goto rxscan1295_scan
+  rxscan1295_loop:
+    ($P10) = rx1293_cur."from"()
+    inc $P10
+    set rx1293_pos, $P10
+    ge rx1293_pos, rx1293_eos, rxscan1295_done
+  rxscan1295_scan:
+    set_addr $I10, rxscan1295_loop
+    rx1293_cur."!mark_push"(0, rx1293_pos, $I10)
+  rxscan1295_done:
+.annotate 'line', 248
+  # rx literal  "$"
+    add $I11, rx1293_pos, 1
+    gt $I11, rx1293_eos, rx1293_fail
+    sub $I11, rx1293_pos, rx1293_off
+    ord $I11, rx1293_tgt, $I11
+    ne $I11, 36, rx1293_fail
+    add rx1293_pos, 1
+  # rx subrule "integer" subtype=capture negate=
+    rx1293_cur."!cursor_pos"(rx1293_pos)
+    $P10 = rx1293_cur."integer"()
+    unless $P10, rx1293_fail
+    rx1293_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("num=integer")
+    rx1293_pos = $P10."pos"()
+.annotate 'line', 247
+  # rx pass
+    rx1293_cur."!cursor_pass"(rx1293_pos, "term:sym<reg>")
+    if_null rx1293_debug, debug_441
+    rx1293_cur."!cursor_debug"("PASS", "term:sym<reg>", " at pos=", rx1293_pos)
+  debug_441:
+    .return (rx1293_cur)
+  rx1293_restart:
+.annotate 'line', 8
+    if_null rx1293_debug, debug_442
+    rx1293_cur."!cursor_debug"("NEXT", "term:sym<reg>")
+  debug_442:
+  rx1293_fail:
+    (rx1293_rep, rx1293_pos, $I10, $P10) = rx1293_cur."!mark_fail"(0)
+    lt rx1293_pos, -1, rx1293_done
+    eq rx1293_pos, -1, rx1293_fail
+    jump $I10
+  rx1293_done:
+    rx1293_cur."!cursor_fail"()
+    if_null rx1293_debug, debug_443
+    rx1293_cur."!cursor_debug"("FAIL", "term:sym<reg>")
+  debug_443:
+    .return (rx1293_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__term:sym<reg>"  :subid("117_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("integer", "$")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "term:sym<macro>"  :subid("118_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1297_tgt
+    .local int rx1297_pos
+    .local int rx1297_off
+    .local int rx1297_eos
+    .local int rx1297_rep
+    .local pmc rx1297_cur
+    .local pmc rx1297_debug
+    (rx1297_cur, rx1297_pos, rx1297_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1297_debug, rx1297_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1297_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1297_eos, rx1297_tgt
+    gt rx1297_pos, rx1297_eos, rx1297_done
+    set rx1297_off, 0
+    lt rx1297_pos, 2, rx1297_start
+    sub rx1297_off, rx1297_pos, 1
+    substr rx1297_tgt, rx1297_tgt, rx1297_off
+  rx1297_start:
+    eq $I10, 1, rx1297_restart
+    if_null rx1297_debug, debug_444
+    rx1297_cur."!cursor_debug"("START", "term:sym<macro>")
+  debug_444:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1299_done
+    goto rxscan1299_scan
+  rxscan1299_loop:
+    ($P10) = rx1297_cur."from"()
+    inc $P10
+    set rx1297_pos, $P10
+    ge rx1297_pos, rx1297_eos, rxscan1299_done
+  rxscan1299_scan:
+    set_addr $I10, rxscan1299_loop
+    rx1297_cur."!mark_push"(0, rx1297_pos, $I10)
+  rxscan1299_done:
+.annotate 'line', 251
+  # rx subrule "op_macro" subtype=capture negate=
+    rx1297_cur."!cursor_pos"(rx1297_pos)
+    $P10 = rx1297_cur."op_macro"()
+    unless $P10, rx1297_fail
+    rx1297_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("op_macro")
+    rx1297_pos = $P10."pos"()
+  # rx pass
+    rx1297_cur."!cursor_pass"(rx1297_pos, "term:sym<macro>")
+    if_null rx1297_debug, debug_445
+    rx1297_cur."!cursor_debug"("PASS", "term:sym<macro>", " at pos=", rx1297_pos)
+  debug_445:
+    .return (rx1297_cur)
+  rx1297_restart:
+.annotate 'line', 8
+    if_null rx1297_debug, debug_446
+    rx1297_cur."!cursor_debug"("NEXT", "term:sym<macro>")
+  debug_446:
+  rx1297_fail:
+    (rx1297_rep, rx1297_pos, $I10, $P10) = rx1297_cur."!mark_fail"(0)
+    lt rx1297_pos, -1, rx1297_done
+    eq rx1297_pos, -1, rx1297_fail
+    jump $I10
+  rx1297_done:
+    rx1297_cur."!cursor_fail"()
+    if_null rx1297_debug, debug_447
+    rx1297_cur."!cursor_debug"("FAIL", "term:sym<macro>")
+  debug_447:
+    .return (rx1297_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__term:sym<macro>"  :subid("119_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("op_macro", "")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "term:sym<identifier>"  :subid("120_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .const 'Sub' $P1305 = "122_1792415686.23593" 
+    capture_lex $P1305
+    .local string rx1301_tgt
+    .local int rx1301_pos
+    .local int rx1301_off
+    .local int rx1301_eos
+    .local int rx1301_rep
+    .local pmc rx1301_cur
+    .local pmc rx1301_debug
+    (rx1301_cur, rx1301_pos, rx1301_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1301_debug, rx1301_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1301_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1301_eos, rx1301_tgt
+    gt rx1301_pos, rx1301_eos, rx1301_done
+    set rx1301_off, 0
+    lt rx1301_pos, 2, rx1301_start
+    sub rx1301_off, rx1301_pos, 1
+    substr rx1301_tgt, rx1301_tgt, rx1301_off
+  rx1301_start:
+    eq $I10, 1, rx1301_restart
+    if_null rx1301_debug, debug_448
+    rx1301_cur."!cursor_debug"("START", "term:sym<identifier>")
+  debug_448:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1303_done
+    goto rxscan1303_scan
+  rxscan1303_loop:
+    ($P10) = rx1301_cur."from"()
+    inc $P10
+    set rx1301_pos, $P10
+    ge rx1301_pos, rx1301_eos, rxscan1303_done
+  rxscan1303_scan:
+    set_addr $I10, rxscan1303_loop
+    rx1301_cur."!mark_push"(0, rx1301_pos, $I10)
+  rxscan1303_done:
+.annotate 'line', 255
+  # rx subrule "identifier" subtype=capture negate=
+    rx1301_cur."!cursor_pos"(rx1301_pos)
+    $P10 = rx1301_cur."identifier"()
+    unless $P10, rx1301_fail
+    rx1301_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("identifier")
+    rx1301_pos = $P10."pos"()
+  # rx subrule "before" subtype=zerowidth negate=1
+    rx1301_cur."!cursor_pos"(rx1301_pos)
+    .const 'Sub' $P1305 = "122_1792415686.23593" 
+    capture_lex $P1305
+    $P10 = rx1301_cur."before"($P1305)
+    if $P10, rx1301_fail
+.annotate 'line', 254
+  # rx pass
+    rx1301_cur."!cursor_pass"(rx1301_pos, "term:sym<identifier>")
+    if_null rx1301_debug, debug_453
+    rx1301_cur."!cursor_debug"("PASS", "term:sym<identifier>", " at pos=", rx1301_pos)
+  debug_453:
+    .return (rx1301_cur)
+  rx1301_restart:
+.annotate 'line', 8
+    if_null rx1301_debug, debug_454
+    rx1301_cur."!cursor_debug"("NEXT", "term:sym<identifier>")
+  debug_454:
+  rx1301_fail:
+    (rx1301_rep, rx1301_pos, $I10, $P10) = rx1301_cur."!mark_fail"(0)
+    lt rx1301_pos, -1, rx1301_done
+    eq rx1301_pos, -1, rx1301_fail
+    jump $I10
+  rx1301_done:
+    rx1301_cur."!cursor_fail"()
+    if_null rx1301_debug, debug_455
+    rx1301_cur."!cursor_debug"("FAIL", "term:sym<identifier>")
+  debug_455:
+    .return (rx1301_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__term:sym<identifier>"  :subid("121_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("identifier", "")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "_block1304"  :anon :subid("122_1792415686.23593") :method :outer("120_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 255
+    .local string rx1306_tgt
+    .local int rx1306_pos
+    .local int rx1306_off
+    .local int rx1306_eos
+    .local int rx1306_rep
+    .local pmc rx1306_cur
+    .local pmc rx1306_debug
+    (rx1306_cur, rx1306_pos, rx1306_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1306_debug, rx1306_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1306_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1306_eos, rx1306_tgt
+    gt rx1306_pos, rx1306_eos, rx1306_done
+    set rx1306_off, 0
+    lt rx1306_pos, 2, rx1306_start
+    sub rx1306_off, rx1306_pos, 1
+    substr rx1306_tgt, rx1306_tgt, rx1306_off
+  rx1306_start:
+    eq $I10, 1, rx1306_restart
+    if_null rx1306_debug, debug_449
+    rx1306_cur."!cursor_debug"("START", "")
+  debug_449:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1307_done
+    goto rxscan1307_scan
+  rxscan1307_loop:
+    ($P10) = rx1306_cur."from"()
+    inc $P10
+    set rx1306_pos, $P10
+    ge rx1306_pos, rx1306_eos, rxscan1307_done
+  rxscan1307_scan:
+    set_addr $I10, rxscan1307_loop
+    rx1306_cur."!mark_push"(0, rx1306_pos, $I10)
+  rxscan1307_done:
+  # rx subrule "ws" subtype=capture negate=
+    rx1306_cur."!cursor_pos"(rx1306_pos)
+    $P10 = rx1306_cur."ws"()
+    unless $P10, rx1306_fail
+    rx1306_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("ws")
+    rx1306_pos = $P10."pos"()
+  # rx literal  "("
+    add $I11, rx1306_pos, 1
+    gt $I11, rx1306_eos, rx1306_fail
+    sub $I11, rx1306_pos, rx1306_off
+    ord $I11, rx1306_tgt, $I11
+    ne $I11, 40, rx1306_fail
+    add rx1306_pos, 1
+  # rx pass
+    rx1306_cur."!cursor_pass"(rx1306_pos, "")
+    if_null rx1306_debug, debug_450
+    rx1306_cur."!cursor_debug"("PASS", "", " at pos=", rx1306_pos)
+  debug_450:
+    .return (rx1306_cur)
+  rx1306_restart:
+    if_null rx1306_debug, debug_451
+    rx1306_cur."!cursor_debug"("NEXT", "")
+  debug_451:
+  rx1306_fail:
+    (rx1306_rep, rx1306_pos, $I10, $P10) = rx1306_cur."!mark_fail"(0)
+    lt rx1306_pos, -1, rx1306_done
+    eq rx1306_pos, -1, rx1306_fail
+    jump $I10
+  rx1306_done:
+    rx1306_cur."!cursor_fail"()
+    if_null rx1306_debug, debug_452
+    rx1306_cur."!cursor_debug"("FAIL", "")
+  debug_452:
+    .return (rx1306_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "infix:sym<=>"  :subid("123_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1309_tgt
+    .local int rx1309_pos
+    .local int rx1309_off
+    .local int rx1309_eos
+    .local int rx1309_rep
+    .local pmc rx1309_cur
+    .local pmc rx1309_debug
+    (rx1309_cur, rx1309_pos, rx1309_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1309_debug, rx1309_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1309_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1309_eos, rx1309_tgt
+    gt rx1309_pos, rx1309_eos, rx1309_done
+    set rx1309_off, 0
+    lt rx1309_pos, 2, rx1309_start
+    sub rx1309_off, rx1309_pos, 1
+    substr rx1309_tgt, rx1309_tgt, rx1309_off
+  rx1309_start:
+    eq $I10, 1, rx1309_restart
+    if_null rx1309_debug, debug_456
+    rx1309_cur."!cursor_debug"("START", "infix:sym<=>")
+  debug_456:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1311_done
+    goto rxscan1311_scan
+  rxscan1311_loop:
+    ($P10) = rx1309_cur."from"()
+    inc $P10
+    set rx1309_pos, $P10
+    ge rx1309_pos, rx1309_eos, rxscan1311_done
+  rxscan1311_scan:
+    set_addr $I10, rxscan1311_loop
+    rx1309_cur."!mark_push"(0, rx1309_pos, $I10)
+  rxscan1311_done:
+.annotate 'line', 260
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1312_fail
+    rx1309_cur."!mark_push"(0, rx1309_pos, $I10)
+  # rx literal  "="
+    add $I11, rx1309_pos, 1
+    gt $I11, rx1309_eos, rx1309_fail
+    sub $I11, rx1309_pos, rx1309_off
+    ord $I11, rx1309_tgt, $I11
+    ne $I11, 61, rx1309_fail
+    add rx1309_pos, 1
+    set_addr $I10, rxcap_1312_fail
+    ($I12, $I11) = rx1309_cur."!mark_peek"($I10)
+    rx1309_cur."!cursor_pos"($I11)
+    ($P10) = rx1309_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1309_pos, "")
+    rx1309_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1312_done
+  rxcap_1312_fail:
+    goto rx1309_fail
+  rxcap_1312_done:
+  # rx subrule "O" subtype=capture negate=
+    rx1309_cur."!cursor_pos"(rx1309_pos)
+    $P10 = rx1309_cur."O"("%assignment :pirop<=>")
+    unless $P10, rx1309_fail
+    rx1309_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1309_pos = $P10."pos"()
+  # rx pass
+    rx1309_cur."!cursor_pass"(rx1309_pos, "infix:sym<=>")
+    if_null rx1309_debug, debug_457
+    rx1309_cur."!cursor_debug"("PASS", "infix:sym<=>", " at pos=", rx1309_pos)
+  debug_457:
+    .return (rx1309_cur)
+  rx1309_restart:
+.annotate 'line', 8
+    if_null rx1309_debug, debug_458
+    rx1309_cur."!cursor_debug"("NEXT", "infix:sym<=>")
+  debug_458:
+  rx1309_fail:
+    (rx1309_rep, rx1309_pos, $I10, $P10) = rx1309_cur."!mark_fail"(0)
+    lt rx1309_pos, -1, rx1309_done
+    eq rx1309_pos, -1, rx1309_fail
+    jump $I10
+  rx1309_done:
+    rx1309_cur."!cursor_fail"()
+    if_null rx1309_debug, debug_459
+    rx1309_cur."!cursor_debug"("FAIL", "infix:sym<=>")
+  debug_459:
+    .return (rx1309_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__infix:sym<=>"  :subid("124_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("O", "=")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "infix:sym<|=>"  :subid("125_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1314_tgt
+    .local int rx1314_pos
+    .local int rx1314_off
+    .local int rx1314_eos
+    .local int rx1314_rep
+    .local pmc rx1314_cur
+    .local pmc rx1314_debug
+    (rx1314_cur, rx1314_pos, rx1314_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1314_debug, rx1314_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1314_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1314_eos, rx1314_tgt
+    gt rx1314_pos, rx1314_eos, rx1314_done
+    set rx1314_off, 0
+    lt rx1314_pos, 2, rx1314_start
+    sub rx1314_off, rx1314_pos, 1
+    substr rx1314_tgt, rx1314_tgt, rx1314_off
+  rx1314_start:
+    eq $I10, 1, rx1314_restart
+    if_null rx1314_debug, debug_460
+    rx1314_cur."!cursor_debug"("START", "infix:sym<|=>")
+  debug_460:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1316_done
+    goto rxscan1316_scan
+  rxscan1316_loop:
+    ($P10) = rx1314_cur."from"()
+    inc $P10
+    set rx1314_pos, $P10
+    ge rx1314_pos, rx1314_eos, rxscan1316_done
+  rxscan1316_scan:
+    set_addr $I10, rxscan1316_loop
+    rx1314_cur."!mark_push"(0, rx1314_pos, $I10)
+  rxscan1316_done:
+.annotate 'line', 261
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1317_fail
+    rx1314_cur."!mark_push"(0, rx1314_pos, $I10)
+  # rx literal  "|="
+    add $I11, rx1314_pos, 2
+    gt $I11, rx1314_eos, rx1314_fail
+    sub $I11, rx1314_pos, rx1314_off
+    substr $S10, rx1314_tgt, $I11, 2
+    ne $S10, "|=", rx1314_fail
+    add rx1314_pos, 2
+    set_addr $I10, rxcap_1317_fail
+    ($I12, $I11) = rx1314_cur."!mark_peek"($I10)
+    rx1314_cur."!cursor_pos"($I11)
+    ($P10) = rx1314_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1314_pos, "")
+    rx1314_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1317_done
+  rxcap_1317_fail:
+    goto rx1314_fail
+  rxcap_1317_done:
+  # rx subrule "O" subtype=capture negate=
+    rx1314_cur."!cursor_pos"(rx1314_pos)
+    $P10 = rx1314_cur."O"("%assignment :pirop<|=>")
+    unless $P10, rx1314_fail
+    rx1314_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1314_pos = $P10."pos"()
+  # rx pass
+    rx1314_cur."!cursor_pass"(rx1314_pos, "infix:sym<|=>")
+    if_null rx1314_debug, debug_461
+    rx1314_cur."!cursor_debug"("PASS", "infix:sym<|=>", " at pos=", rx1314_pos)
+  debug_461:
+    .return (rx1314_cur)
+  rx1314_restart:
+.annotate 'line', 8
+    if_null rx1314_debug, debug_462
+    rx1314_cur."!cursor_debug"("NEXT", "infix:sym<|=>")
+  debug_462:
+  rx1314_fail:
+    (rx1314_rep, rx1314_pos, $I10, $P10) = rx1314_cur."!mark_fail"(0)
+    lt rx1314_pos, -1, rx1314_done
+    eq rx1314_pos, -1, rx1314_fail
+    jump $I10
+  rx1314_done:
+    rx1314_cur."!cursor_fail"()
+    if_null rx1314_debug, debug_463
+    rx1314_cur."!cursor_debug"("FAIL", "infix:sym<|=>")
+  debug_463:
+    .return (rx1314_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__infix:sym<|=>"  :subid("126_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("O", "|=")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "infix:sym<&=>"  :subid("127_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1319_tgt
+    .local int rx1319_pos
+    .local int rx1319_off
+    .local int rx1319_eos
+    .local int rx1319_rep
+    .local pmc rx1319_cur
+    .local pmc rx1319_debug
+    (rx1319_cur, rx1319_pos, rx1319_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1319_debug, rx1319_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1319_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1319_eos, rx1319_tgt
+    gt rx1319_pos, rx1319_eos, rx1319_done
+    set rx1319_off, 0
+    lt rx1319_pos, 2, rx1319_start
+    sub rx1319_off, rx1319_pos, 1
+    substr rx1319_tgt, rx1319_tgt, rx1319_off
+  rx1319_start:
+    eq $I10, 1, rx1319_restart
+    if_null rx1319_debug, debug_464
+    rx1319_cur."!cursor_debug"("START", "infix:sym<&=>")
+  debug_464:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1321_done
+    goto rxscan1321_scan
+  rxscan1321_loop:
+    ($P10) = rx1319_cur."from"()
+    inc $P10
+    set rx1319_pos, $P10
+    ge rx1319_pos, rx1319_eos, rxscan1321_done
+  rxscan1321_scan:
+    set_addr $I10, rxscan1321_loop
+    rx1319_cur."!mark_push"(0, rx1319_pos, $I10)
+  rxscan1321_done:
+.annotate 'line', 262
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1322_fail
+    rx1319_cur."!mark_push"(0, rx1319_pos, $I10)
+  # rx literal  "&="
+    add $I11, rx1319_pos, 2
+    gt $I11, rx1319_eos, rx1319_fail
+    sub $I11, rx1319_pos, rx1319_off
+    substr $S10, rx1319_tgt, $I11, 2
+    ne $S10, "&=", rx1319_fail
+    add rx1319_pos, 2
+    set_addr $I10, rxcap_1322_fail
+    ($I12, $I11) = rx1319_cur."!mark_peek"($I10)
+    rx1319_cur."!cursor_pos"($I11)
+    ($P10) = rx1319_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1319_pos, "")
+    rx1319_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1322_done
+  rxcap_1322_fail:
+    goto rx1319_fail
+  rxcap_1322_done:
+  # rx subrule "O" subtype=capture negate=
+    rx1319_cur."!cursor_pos"(rx1319_pos)
+    $P10 = rx1319_cur."O"("%assignment :pirop<&=>")
+    unless $P10, rx1319_fail
+    rx1319_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1319_pos = $P10."pos"()
+  # rx pass
+    rx1319_cur."!cursor_pass"(rx1319_pos, "infix:sym<&=>")
+    if_null rx1319_debug, debug_465
+    rx1319_cur."!cursor_debug"("PASS", "infix:sym<&=>", " at pos=", rx1319_pos)
+  debug_465:
+    .return (rx1319_cur)
+  rx1319_restart:
+.annotate 'line', 8
+    if_null rx1319_debug, debug_466
+    rx1319_cur."!cursor_debug"("NEXT", "infix:sym<&=>")
+  debug_466:
+  rx1319_fail:
+    (rx1319_rep, rx1319_pos, $I10, $P10) = rx1319_cur."!mark_fail"(0)
+    lt rx1319_pos, -1, rx1319_done
+    eq rx1319_pos, -1, rx1319_fail
+    jump $I10
+  rx1319_done:
+    rx1319_cur."!cursor_fail"()
+    if_null rx1319_debug, debug_467
+    rx1319_cur."!cursor_debug"("FAIL", "infix:sym<&=>")
+  debug_467:
+    .return (rx1319_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__infix:sym<&=>"  :subid("128_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("O", "&=")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "infix:sym<^=>"  :subid("129_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1324_tgt
+    .local int rx1324_pos
+    .local int rx1324_off
+    .local int rx1324_eos
+    .local int rx1324_rep
+    .local pmc rx1324_cur
+    .local pmc rx1324_debug
+    (rx1324_cur, rx1324_pos, rx1324_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1324_debug, rx1324_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1324_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1324_eos, rx1324_tgt
+    gt rx1324_pos, rx1324_eos, rx1324_done
+    set rx1324_off, 0
+    lt rx1324_pos, 2, rx1324_start
+    sub rx1324_off, rx1324_pos, 1
+    substr rx1324_tgt, rx1324_tgt, rx1324_off
+  rx1324_start:
+    eq $I10, 1, rx1324_restart
+    if_null rx1324_debug, debug_468
+    rx1324_cur."!cursor_debug"("START", "infix:sym<^=>")
+  debug_468:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1326_done
+    goto rxscan1326_scan
+  rxscan1326_loop:
+    ($P10) = rx1324_cur."from"()
+    inc $P10
+    set rx1324_pos, $P10
+    ge rx1324_pos, rx1324_eos, rxscan1326_done
+  rxscan1326_scan:
+    set_addr $I10, rxscan1326_loop
+    rx1324_cur."!mark_push"(0, rx1324_pos, $I10)
+  rxscan1326_done:
+.annotate 'line', 263
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1327_fail
+    rx1324_cur."!mark_push"(0, rx1324_pos, $I10)
+  # rx literal  "^="
+    add $I11, rx1324_pos, 2
+    gt $I11, rx1324_eos, rx1324_fail
+    sub $I11, rx1324_pos, rx1324_off
+    substr $S10, rx1324_tgt, $I11, 2
+    ne $S10, "^=", rx1324_fail
+    add rx1324_pos, 2
+    set_addr $I10, rxcap_1327_fail
+    ($I12, $I11) = rx1324_cur."!mark_peek"($I10)
+    rx1324_cur."!cursor_pos"($I11)
+    ($P10) = rx1324_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1324_pos, "")
+    rx1324_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1327_done
+  rxcap_1327_fail:
+    goto rx1324_fail
+  rxcap_1327_done:
+  # rx subrule "O" subtype=capture negate=
+    rx1324_cur."!cursor_pos"(rx1324_pos)
+    $P10 = rx1324_cur."O"("%assignment :pirop<^=>")
+    unless $P10, rx1324_fail
+    rx1324_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1324_pos = $P10."pos"()
+  # rx pass
+    rx1324_cur."!cursor_pass"(rx1324_pos, "infix:sym<^=>")
+    if_null rx1324_debug, debug_469
+    rx1324_cur."!cursor_debug"("PASS", "infix:sym<^=>", " at pos=", rx1324_pos)
+  debug_469:
+    .return (rx1324_cur)
+  rx1324_restart:
+.annotate 'line', 8
+    if_null rx1324_debug, debug_470
+    rx1324_cur."!cursor_debug"("NEXT", "infix:sym<^=>")
+  debug_470:
+  rx1324_fail:
+    (rx1324_rep, rx1324_pos, $I10, $P10) = rx1324_cur."!mark_fail"(0)
+    lt rx1324_pos, -1, rx1324_done
+    eq rx1324_pos, -1, rx1324_fail
+    jump $I10
+  rx1324_done:
+    rx1324_cur."!cursor_fail"()
+    if_null rx1324_debug, debug_471
+    rx1324_cur."!cursor_debug"("FAIL", "infix:sym<^=>")
+  debug_471:
+    .return (rx1324_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__infix:sym<^=>"  :subid("130_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("O", "^=")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "infix:sym<+=>"  :subid("131_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1329_tgt
+    .local int rx1329_pos
+    .local int rx1329_off
+    .local int rx1329_eos
+    .local int rx1329_rep
+    .local pmc rx1329_cur
+    .local pmc rx1329_debug
+    (rx1329_cur, rx1329_pos, rx1329_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1329_debug, rx1329_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1329_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1329_eos, rx1329_tgt
+    gt rx1329_pos, rx1329_eos, rx1329_done
+    set rx1329_off, 0
+    lt rx1329_pos, 2, rx1329_start
+    sub rx1329_off, rx1329_pos, 1
+    substr rx1329_tgt, rx1329_tgt, rx1329_off
+  rx1329_start:
+    eq $I10, 1, rx1329_restart
+    if_null rx1329_debug, debug_472
+    rx1329_cur."!cursor_debug"("START", "infix:sym<+=>")
+  debug_472:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1331_done
+    goto rxscan1331_scan
+  rxscan1331_loop:
+    ($P10) = rx1329_cur."from"()
+    inc $P10
+    set rx1329_pos, $P10
+    ge rx1329_pos, rx1329_eos, rxscan1331_done
+  rxscan1331_scan:
+    set_addr $I10, rxscan1331_loop
+    rx1329_cur."!mark_push"(0, rx1329_pos, $I10)
+  rxscan1331_done:
+.annotate 'line', 265
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1332_fail
+    rx1329_cur."!mark_push"(0, rx1329_pos, $I10)
+  # rx literal  "+="
+    add $I11, rx1329_pos, 2
+    gt $I11, rx1329_eos, rx1329_fail
+    sub $I11, rx1329_pos, rx1329_off
+    substr $S10, rx1329_tgt, $I11, 2
+    ne $S10, "+=", rx1329_fail
+    add rx1329_pos, 2
+    set_addr $I10, rxcap_1332_fail
+    ($I12, $I11) = rx1329_cur."!mark_peek"($I10)
+    rx1329_cur."!cursor_pos"($I11)
+    ($P10) = rx1329_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1329_pos, "")
+    rx1329_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1332_done
+  rxcap_1332_fail:
+    goto rx1329_fail
+  rxcap_1332_done:
+  # rx subrule "O" subtype=capture negate=
+    rx1329_cur."!cursor_pos"(rx1329_pos)
+    $P10 = rx1329_cur."O"("%assignment :pirop<+=>")
+    unless $P10, rx1329_fail
+    rx1329_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1329_pos = $P10."pos"()
+  # rx pass
+    rx1329_cur."!cursor_pass"(rx1329_pos, "infix:sym<+=>")
+    if_null rx1329_debug, debug_473
+    rx1329_cur."!cursor_debug"("PASS", "infix:sym<+=>", " at pos=", rx1329_pos)
+  debug_473:
+    .return (rx1329_cur)
+  rx1329_restart:
+.annotate 'line', 8
+    if_null rx1329_debug, debug_474
+    rx1329_cur."!cursor_debug"("NEXT", "infix:sym<+=>")
+  debug_474:
+  rx1329_fail:
+    (rx1329_rep, rx1329_pos, $I10, $P10) = rx1329_cur."!mark_fail"(0)
+    lt rx1329_pos, -1, rx1329_done
+    eq rx1329_pos, -1, rx1329_fail
+    jump $I10
+  rx1329_done:
+    rx1329_cur."!cursor_fail"()
+    if_null rx1329_debug, debug_475
+    rx1329_cur."!cursor_debug"("FAIL", "infix:sym<+=>")
+  debug_475:
+    .return (rx1329_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__infix:sym<+=>"  :subid("132_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("O", "+=")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "infix:sym<-=>"  :subid("133_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1334_tgt
+    .local int rx1334_pos
+    .local int rx1334_off
+    .local int rx1334_eos
+    .local int rx1334_rep
+    .local pmc rx1334_cur
+    .local pmc rx1334_debug
+    (rx1334_cur, rx1334_pos, rx1334_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1334_debug, rx1334_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1334_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1334_eos, rx1334_tgt
+    gt rx1334_pos, rx1334_eos, rx1334_done
+    set rx1334_off, 0
+    lt rx1334_pos, 2, rx1334_start
+    sub rx1334_off, rx1334_pos, 1
+    substr rx1334_tgt, rx1334_tgt, rx1334_off
+  rx1334_start:
+    eq $I10, 1, rx1334_restart
+    if_null rx1334_debug, debug_476
+    rx1334_cur."!cursor_debug"("START", "infix:sym<-=>")
+  debug_476:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1336_done
+    goto rxscan1336_scan
+  rxscan1336_loop:
+    ($P10) = rx1334_cur."from"()
+    inc $P10
+    set rx1334_pos, $P10
+    ge rx1334_pos, rx1334_eos, rxscan1336_done
+  rxscan1336_scan:
+    set_addr $I10, rxscan1336_loop
+    rx1334_cur."!mark_push"(0, rx1334_pos, $I10)
+  rxscan1336_done:
+.annotate 'line', 266
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1337_fail
+    rx1334_cur."!mark_push"(0, rx1334_pos, $I10)
+  # rx literal  "-="
+    add $I11, rx1334_pos, 2
+    gt $I11, rx1334_eos, rx1334_fail
+    sub $I11, rx1334_pos, rx1334_off
+    substr $S10, rx1334_tgt, $I11, 2
+    ne $S10, "-=", rx1334_fail
+    add rx1334_pos, 2
+    set_addr $I10, rxcap_1337_fail
+    ($I12, $I11) = rx1334_cur."!mark_peek"($I10)
+    rx1334_cur."!cursor_pos"($I11)
+    ($P10) = rx1334_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1334_pos, "")
+    rx1334_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1337_done
+  rxcap_1337_fail:
+    goto rx1334_fail
+  rxcap_1337_done:
+  # rx subrule "O" subtype=capture negate=
+    rx1334_cur."!cursor_pos"(rx1334_pos)
+    $P10 = rx1334_cur."O"("%assignment :pirop<-=>")
+    unless $P10, rx1334_fail
+    rx1334_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1334_pos = $P10."pos"()
+  # rx pass
+    rx1334_cur."!cursor_pass"(rx1334_pos, "infix:sym<-=>")
+    if_null rx1334_debug, debug_477
+    rx1334_cur."!cursor_debug"("PASS", "infix:sym<-=>", " at pos=", rx1334_pos)
+  debug_477:
+    .return (rx1334_cur)
+  rx1334_restart:
+.annotate 'line', 8
+    if_null rx1334_debug, debug_478
+    rx1334_cur."!cursor_debug"("NEXT", "infix:sym<-=>")
+  debug_478:
+  rx1334_fail:
+    (rx1334_rep, rx1334_pos, $I10, $P10) = rx1334_cur."!mark_fail"(0)
+    lt rx1334_pos, -1, rx1334_done
+    eq rx1334_pos, -1, rx1334_fail
+    jump $I10
+  rx1334_done:
+    rx1334_cur."!cursor_fail"()
+    if_null rx1334_debug, debug_479
+    rx1334_cur."!cursor_debug"("FAIL", "infix:sym<-=>")
+  debug_479:
+    .return (rx1334_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__infix:sym<-=>"  :subid("134_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("O", "-=")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "infix:sym<*=>"  :subid("135_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1339_tgt
+    .local int rx1339_pos
+    .local int rx1339_off
+    .local int rx1339_eos
+    .local int rx1339_rep
+    .local pmc rx1339_cur
+    .local pmc rx1339_debug
+    (rx1339_cur, rx1339_pos, rx1339_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1339_debug, rx1339_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1339_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1339_eos, rx1339_tgt
+    gt rx1339_pos, rx1339_eos, rx1339_done
+    set rx1339_off, 0
+    lt rx1339_pos, 2, rx1339_start
+    sub rx1339_off, rx1339_pos, 1
+    substr rx1339_tgt, rx1339_tgt, rx1339_off
+  rx1339_start:
+    eq $I10, 1, rx1339_restart
+    if_null rx1339_debug, debug_480
+    rx1339_cur."!cursor_debug"("START", "infix:sym<*=>")
+  debug_480:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1341_done
+    goto rxscan1341_scan
+  rxscan1341_loop:
+    ($P10) = rx1339_cur."from"()
+    inc $P10
+    set rx1339_pos, $P10
+    ge rx1339_pos, rx1339_eos, rxscan1341_done
+  rxscan1341_scan:
+    set_addr $I10, rxscan1341_loop
+    rx1339_cur."!mark_push"(0, rx1339_pos, $I10)
+  rxscan1341_done:
+.annotate 'line', 267
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1342_fail
+    rx1339_cur."!mark_push"(0, rx1339_pos, $I10)
+  # rx literal  "*="
+    add $I11, rx1339_pos, 2
+    gt $I11, rx1339_eos, rx1339_fail
+    sub $I11, rx1339_pos, rx1339_off
+    substr $S10, rx1339_tgt, $I11, 2
+    ne $S10, "*=", rx1339_fail
+    add rx1339_pos, 2
+    set_addr $I10, rxcap_1342_fail
+    ($I12, $I11) = rx1339_cur."!mark_peek"($I10)
+    rx1339_cur."!cursor_pos"($I11)
+    ($P10) = rx1339_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1339_pos, "")
+    rx1339_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1342_done
+  rxcap_1342_fail:
+    goto rx1339_fail
+  rxcap_1342_done:
+  # rx subrule "O" subtype=capture negate=
+    rx1339_cur."!cursor_pos"(rx1339_pos)
+    $P10 = rx1339_cur."O"("%assignment :pirop<*=>")
+    unless $P10, rx1339_fail
+    rx1339_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1339_pos = $P10."pos"()
+  # rx pass
+    rx1339_cur."!cursor_pass"(rx1339_pos, "infix:sym<*=>")
+    if_null rx1339_debug, debug_481
+    rx1339_cur."!cursor_debug"("PASS", "infix:sym<*=>", " at pos=", rx1339_pos)
+  debug_481:
+    .return (rx1339_cur)
+  rx1339_restart:
+.annotate 'line', 8
+    if_null rx1339_debug, debug_482
+    rx1339_cur."!cursor_debug"("NEXT", "infix:sym<*=>")
+  debug_482:
+  rx1339_fail:
+    (rx1339_rep, rx1339_pos, $I10, $P10) = rx1339_cur."!mark_fail"(0)
+    lt rx1339_pos, -1, rx1339_done
+    eq rx1339_pos, -1, rx1339_fail
+    jump $I10
+  rx1339_done:
+    rx1339_cur."!cursor_fail"()
+    if_null rx1339_debug, debug_483
+    rx1339_cur."!cursor_debug"("FAIL", "infix:sym<*=>")
+  debug_483:
+    .return (rx1339_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__infix:sym<*=>"  :subid("136_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("O", "*=")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "infix:sym</=>"  :subid("137_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1344_tgt
+    .local int rx1344_pos
+    .local int rx1344_off
+    .local int rx1344_eos
+    .local int rx1344_rep
+    .local pmc rx1344_cur
+    .local pmc rx1344_debug
+    (rx1344_cur, rx1344_pos, rx1344_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1344_debug, rx1344_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1344_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1344_eos, rx1344_tgt
+    gt rx1344_pos, rx1344_eos, rx1344_done
+    set rx1344_off, 0
+    lt rx1344_pos, 2, rx1344_start
+    sub rx1344_off, rx1344_pos, 1
+    substr rx1344_tgt, rx1344_tgt, rx1344_off
+  rx1344_start:
+    eq $I10, 1, rx1344_restart
+    if_null rx1344_debug, debug_484
+    rx1344_cur."!cursor_debug"("START", "infix:sym</=>")
+  debug_484:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1346_done
+    goto rxscan1346_scan
+  rxscan1346_loop:
+    ($P10) = rx1344_cur."from"()
+    inc $P10
+    set rx1344_pos, $P10
+    ge rx1344_pos, rx1344_eos, rxscan1346_done
+  rxscan1346_scan:
+    set_addr $I10, rxscan1346_loop
+    rx1344_cur."!mark_push"(0, rx1344_pos, $I10)
+  rxscan1346_done:
+.annotate 'line', 268
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1347_fail
+    rx1344_cur."!mark_push"(0, rx1344_pos, $I10)
+  # rx literal  "/="
+    add $I11, rx1344_pos, 2
+    gt $I11, rx1344_eos, rx1344_fail
+    sub $I11, rx1344_pos, rx1344_off
+    substr $S10, rx1344_tgt, $I11, 2
+    ne $S10, "/=", rx1344_fail
+    add rx1344_pos, 2
+    set_addr $I10, rxcap_1347_fail
+    ($I12, $I11) = rx1344_cur."!mark_peek"($I10)
+    rx1344_cur."!cursor_pos"($I11)
+    ($P10) = rx1344_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1344_pos, "")
+    rx1344_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1347_done
+  rxcap_1347_fail:
+    goto rx1344_fail
+  rxcap_1347_done:
+  # rx subrule "O" subtype=capture negate=
+    rx1344_cur."!cursor_pos"(rx1344_pos)
+    $P10 = rx1344_cur."O"("%assignment :pirop</=>")
+    unless $P10, rx1344_fail
+    rx1344_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1344_pos = $P10."pos"()
+  # rx pass
+    rx1344_cur."!cursor_pass"(rx1344_pos, "infix:sym</=>")
+    if_null rx1344_debug, debug_485
+    rx1344_cur."!cursor_debug"("PASS", "infix:sym</=>", " at pos=", rx1344_pos)
+  debug_485:
+    .return (rx1344_cur)
+  rx1344_restart:
+.annotate 'line', 8
+    if_null rx1344_debug, debug_486
+    rx1344_cur."!cursor_debug"("NEXT", "infix:sym</=>")
+  debug_486:
+  rx1344_fail:
+    (rx1344_rep, rx1344_pos, $I10, $P10) = rx1344_cur."!mark_fail"(0)
+    lt rx1344_pos, -1, rx1344_done
+    eq rx1344_pos, -1, rx1344_fail
+    jump $I10
+  rx1344_done:
+    rx1344_cur."!cursor_fail"()
+    if_null rx1344_debug, debug_487
+    rx1344_cur."!cursor_debug"("FAIL", "infix:sym</=>")
+  debug_487:
+    .return (rx1344_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__infix:sym</=>"  :subid("138_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("O", "/=")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "infix:sym<>>=>"  :subid("139_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1349_tgt
+    .local int rx1349_pos
+    .local int rx1349_off
+    .local int rx1349_eos
+    .local int rx1349_rep
+    .local pmc rx1349_cur
+    .local pmc rx1349_debug
+    (rx1349_cur, rx1349_pos, rx1349_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1349_debug, rx1349_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1349_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1349_eos, rx1349_tgt
+    gt rx1349_pos, rx1349_eos, rx1349_done
+    set rx1349_off, 0
+    lt rx1349_pos, 2, rx1349_start
+    sub rx1349_off, rx1349_pos, 1
+    substr rx1349_tgt, rx1349_tgt, rx1349_off
+  rx1349_start:
+    eq $I10, 1, rx1349_restart
+    if_null rx1349_debug, debug_488
+    rx1349_cur."!cursor_debug"("START", "infix:sym<>>=>")
+  debug_488:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1351_done
+    goto rxscan1351_scan
+  rxscan1351_loop:
+    ($P10) = rx1349_cur."from"()
+    inc $P10
+    set rx1349_pos, $P10
+    ge rx1349_pos, rx1349_eos, rxscan1351_done
+  rxscan1351_scan:
+    set_addr $I10, rxscan1351_loop
+    rx1349_cur."!mark_push"(0, rx1349_pos, $I10)
+  rxscan1351_done:
+.annotate 'line', 270
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1352_fail
+    rx1349_cur."!mark_push"(0, rx1349_pos, $I10)
+  # rx literal  ">>="
+    add $I11, rx1349_pos, 3
+    gt $I11, rx1349_eos, rx1349_fail
+    sub $I11, rx1349_pos, rx1349_off
+    substr $S10, rx1349_tgt, $I11, 3
+    ne $S10, ">>=", rx1349_fail
+    add rx1349_pos, 3
+    set_addr $I10, rxcap_1352_fail
+    ($I12, $I11) = rx1349_cur."!mark_peek"($I10)
+    rx1349_cur."!cursor_pos"($I11)
+    ($P10) = rx1349_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1349_pos, "")
+    rx1349_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1352_done
+  rxcap_1352_fail:
+    goto rx1349_fail
+  rxcap_1352_done:
+  # rx subrule "O" subtype=capture negate=
+    rx1349_cur."!cursor_pos"(rx1349_pos)
+    $P10 = rx1349_cur."O"("%assignment :pirop<shr_assign>")
+    unless $P10, rx1349_fail
+    rx1349_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1349_pos = $P10."pos"()
+  # rx pass
+    rx1349_cur."!cursor_pass"(rx1349_pos, "infix:sym<>>=>")
+    if_null rx1349_debug, debug_489
+    rx1349_cur."!cursor_debug"("PASS", "infix:sym<>>=>", " at pos=", rx1349_pos)
+  debug_489:
+    .return (rx1349_cur)
+  rx1349_restart:
+.annotate 'line', 8
+    if_null rx1349_debug, debug_490
+    rx1349_cur."!cursor_debug"("NEXT", "infix:sym<>>=>")
+  debug_490:
+  rx1349_fail:
+    (rx1349_rep, rx1349_pos, $I10, $P10) = rx1349_cur."!mark_fail"(0)
+    lt rx1349_pos, -1, rx1349_done
+    eq rx1349_pos, -1, rx1349_fail
+    jump $I10
+  rx1349_done:
+    rx1349_cur."!cursor_fail"()
+    if_null rx1349_debug, debug_491
+    rx1349_cur."!cursor_debug"("FAIL", "infix:sym<>>=>")
+  debug_491:
+    .return (rx1349_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__infix:sym<>>=>"  :subid("140_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("O", ">>=")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "infix:sym<<<=>"  :subid("141_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1354_tgt
+    .local int rx1354_pos
+    .local int rx1354_off
+    .local int rx1354_eos
+    .local int rx1354_rep
+    .local pmc rx1354_cur
+    .local pmc rx1354_debug
+    (rx1354_cur, rx1354_pos, rx1354_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1354_debug, rx1354_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1354_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1354_eos, rx1354_tgt
+    gt rx1354_pos, rx1354_eos, rx1354_done
+    set rx1354_off, 0
+    lt rx1354_pos, 2, rx1354_start
+    sub rx1354_off, rx1354_pos, 1
+    substr rx1354_tgt, rx1354_tgt, rx1354_off
+  rx1354_start:
+    eq $I10, 1, rx1354_restart
+    if_null rx1354_debug, debug_492
+    rx1354_cur."!cursor_debug"("START", "infix:sym<<<=>")
+  debug_492:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1356_done
+    goto rxscan1356_scan
+  rxscan1356_loop:
+    ($P10) = rx1354_cur."from"()
+    inc $P10
+    set rx1354_pos, $P10
+    ge rx1354_pos, rx1354_eos, rxscan1356_done
+  rxscan1356_scan:
+    set_addr $I10, rxscan1356_loop
+    rx1354_cur."!mark_push"(0, rx1354_pos, $I10)
+  rxscan1356_done:
+.annotate 'line', 271
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1357_fail
+    rx1354_cur."!mark_push"(0, rx1354_pos, $I10)
+  # rx literal  "<<="
+    add $I11, rx1354_pos, 3
+    gt $I11, rx1354_eos, rx1354_fail
+    sub $I11, rx1354_pos, rx1354_off
+    substr $S10, rx1354_tgt, $I11, 3
+    ne $S10, "<<=", rx1354_fail
+    add rx1354_pos, 3
+    set_addr $I10, rxcap_1357_fail
+    ($I12, $I11) = rx1354_cur."!mark_peek"($I10)
+    rx1354_cur."!cursor_pos"($I11)
+    ($P10) = rx1354_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1354_pos, "")
+    rx1354_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1357_done
+  rxcap_1357_fail:
+    goto rx1354_fail
+  rxcap_1357_done:
+  # rx subrule "O" subtype=capture negate=
+    rx1354_cur."!cursor_pos"(rx1354_pos)
+    $P10 = rx1354_cur."O"("%assignment :pirop<shl_assign>")
+    unless $P10, rx1354_fail
+    rx1354_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1354_pos = $P10."pos"()
+  # rx pass
+    rx1354_cur."!cursor_pass"(rx1354_pos, "infix:sym<<<=>")
+    if_null rx1354_debug, debug_493
+    rx1354_cur."!cursor_debug"("PASS", "infix:sym<<<=>", " at pos=", rx1354_pos)
+  debug_493:
+    .return (rx1354_cur)
+  rx1354_restart:
+.annotate 'line', 8
+    if_null rx1354_debug, debug_494
+    rx1354_cur."!cursor_debug"("NEXT", "infix:sym<<<=>")
+  debug_494:
+  rx1354_fail:
+    (rx1354_rep, rx1354_pos, $I10, $P10) = rx1354_cur."!mark_fail"(0)
+    lt rx1354_pos, -1, rx1354_done
+    eq rx1354_pos, -1, rx1354_fail
+    jump $I10
+  rx1354_done:
+    rx1354_cur."!cursor_fail"()
+    if_null rx1354_debug, debug_495
+    rx1354_cur."!cursor_debug"("FAIL", "infix:sym<<<=>")
+  debug_495:
+    .return (rx1354_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__infix:sym<<<=>"  :subid("142_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("O", "<<=")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "infix:sym<,>"  :subid("143_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1359_tgt
+    .local int rx1359_pos
+    .local int rx1359_off
+    .local int rx1359_eos
+    .local int rx1359_rep
+    .local pmc rx1359_cur
+    .local pmc rx1359_debug
+    (rx1359_cur, rx1359_pos, rx1359_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1359_debug, rx1359_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1359_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1359_eos, rx1359_tgt
+    gt rx1359_pos, rx1359_eos, rx1359_done
+    set rx1359_off, 0
+    lt rx1359_pos, 2, rx1359_start
+    sub rx1359_off, rx1359_pos, 1
+    substr rx1359_tgt, rx1359_tgt, rx1359_off
+  rx1359_start:
+    eq $I10, 1, rx1359_restart
+    if_null rx1359_debug, debug_496
+    rx1359_cur."!cursor_debug"("START", "infix:sym<,>")
+  debug_496:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1361_done
+    goto rxscan1361_scan
+  rxscan1361_loop:
+    ($P10) = rx1359_cur."from"()
+    inc $P10
+    set rx1359_pos, $P10
+    ge rx1359_pos, rx1359_eos, rxscan1361_done
+  rxscan1361_scan:
+    set_addr $I10, rxscan1361_loop
+    rx1359_cur."!mark_push"(0, rx1359_pos, $I10)
+  rxscan1361_done:
+.annotate 'line', 273
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1362_fail
+    rx1359_cur."!mark_push"(0, rx1359_pos, $I10)
+  # rx literal  ","
+    add $I11, rx1359_pos, 1
+    gt $I11, rx1359_eos, rx1359_fail
+    sub $I11, rx1359_pos, rx1359_off
+    ord $I11, rx1359_tgt, $I11
+    ne $I11, 44, rx1359_fail
+    add rx1359_pos, 1
+    set_addr $I10, rxcap_1362_fail
+    ($I12, $I11) = rx1359_cur."!mark_peek"($I10)
+    rx1359_cur."!cursor_pos"($I11)
+    ($P10) = rx1359_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1359_pos, "")
+    rx1359_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1362_done
+  rxcap_1362_fail:
+    goto rx1359_fail
+  rxcap_1362_done:
+  # rx subrule "O" subtype=capture negate=
+    rx1359_cur."!cursor_pos"(rx1359_pos)
+    $P10 = rx1359_cur."O"("%comma :pirop<,>")
+    unless $P10, rx1359_fail
+    rx1359_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1359_pos = $P10."pos"()
+  # rx pass
+    rx1359_cur."!cursor_pass"(rx1359_pos, "infix:sym<,>")
+    if_null rx1359_debug, debug_497
+    rx1359_cur."!cursor_debug"("PASS", "infix:sym<,>", " at pos=", rx1359_pos)
+  debug_497:
+    .return (rx1359_cur)
+  rx1359_restart:
+.annotate 'line', 8
+    if_null rx1359_debug, debug_498
+    rx1359_cur."!cursor_debug"("NEXT", "infix:sym<,>")
+  debug_498:
+  rx1359_fail:
+    (rx1359_rep, rx1359_pos, $I10, $P10) = rx1359_cur."!mark_fail"(0)
+    lt rx1359_pos, -1, rx1359_done
+    eq rx1359_pos, -1, rx1359_fail
+    jump $I10
+  rx1359_done:
+    rx1359_cur."!cursor_fail"()
+    if_null rx1359_debug, debug_499
+    rx1359_cur."!cursor_debug"("FAIL", "infix:sym<,>")
+  debug_499:
+    .return (rx1359_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__infix:sym<,>"  :subid("144_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("O", ",")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "infix:sym<*>"  :subid("145_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1364_tgt
+    .local int rx1364_pos
+    .local int rx1364_off
+    .local int rx1364_eos
+    .local int rx1364_rep
+    .local pmc rx1364_cur
+    .local pmc rx1364_debug
+    (rx1364_cur, rx1364_pos, rx1364_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1364_debug, rx1364_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1364_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1364_eos, rx1364_tgt
+    gt rx1364_pos, rx1364_eos, rx1364_done
+    set rx1364_off, 0
+    lt rx1364_pos, 2, rx1364_start
+    sub rx1364_off, rx1364_pos, 1
+    substr rx1364_tgt, rx1364_tgt, rx1364_off
+  rx1364_start:
+    eq $I10, 1, rx1364_restart
+    if_null rx1364_debug, debug_500
+    rx1364_cur."!cursor_debug"("START", "infix:sym<*>")
+  debug_500:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1366_done
+    goto rxscan1366_scan
+  rxscan1366_loop:
+    ($P10) = rx1364_cur."from"()
+    inc $P10
+    set rx1364_pos, $P10
+    ge rx1364_pos, rx1364_eos, rxscan1366_done
+  rxscan1366_scan:
+    set_addr $I10, rxscan1366_loop
+    rx1364_cur."!mark_push"(0, rx1364_pos, $I10)
+  rxscan1366_done:
+.annotate 'line', 275
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1367_fail
+    rx1364_cur."!mark_push"(0, rx1364_pos, $I10)
+  # rx literal  "*"
+    add $I11, rx1364_pos, 1
+    gt $I11, rx1364_eos, rx1364_fail
+    sub $I11, rx1364_pos, rx1364_off
+    ord $I11, rx1364_tgt, $I11
+    ne $I11, 42, rx1364_fail
+    add rx1364_pos, 1
+    set_addr $I10, rxcap_1367_fail
+    ($I12, $I11) = rx1364_cur."!mark_peek"($I10)
+    rx1364_cur."!cursor_pos"($I11)
+    ($P10) = rx1364_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1364_pos, "")
+    rx1364_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1367_done
+  rxcap_1367_fail:
+    goto rx1364_fail
+  rxcap_1367_done:
+  # rx subrule "O" subtype=capture negate=
+    rx1364_cur."!cursor_pos"(rx1364_pos)
+    $P10 = rx1364_cur."O"("%multiplicative :pirop<*>")
+    unless $P10, rx1364_fail
+    rx1364_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1364_pos = $P10."pos"()
+  # rx pass
+    rx1364_cur."!cursor_pass"(rx1364_pos, "infix:sym<*>")
+    if_null rx1364_debug, debug_501
+    rx1364_cur."!cursor_debug"("PASS", "infix:sym<*>", " at pos=", rx1364_pos)
+  debug_501:
+    .return (rx1364_cur)
+  rx1364_restart:
+.annotate 'line', 8
+    if_null rx1364_debug, debug_502
+    rx1364_cur."!cursor_debug"("NEXT", "infix:sym<*>")
+  debug_502:
+  rx1364_fail:
+    (rx1364_rep, rx1364_pos, $I10, $P10) = rx1364_cur."!mark_fail"(0)
+    lt rx1364_pos, -1, rx1364_done
+    eq rx1364_pos, -1, rx1364_fail
+    jump $I10
+  rx1364_done:
+    rx1364_cur."!cursor_fail"()
+    if_null rx1364_debug, debug_503
+    rx1364_cur."!cursor_debug"("FAIL", "infix:sym<*>")
+  debug_503:
+    .return (rx1364_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__infix:sym<*>"  :subid("146_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("O", "*")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "infix:sym</>"  :subid("147_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1369_tgt
+    .local int rx1369_pos
+    .local int rx1369_off
+    .local int rx1369_eos
+    .local int rx1369_rep
+    .local pmc rx1369_cur
+    .local pmc rx1369_debug
+    (rx1369_cur, rx1369_pos, rx1369_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1369_debug, rx1369_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1369_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1369_eos, rx1369_tgt
+    gt rx1369_pos, rx1369_eos, rx1369_done
+    set rx1369_off, 0
+    lt rx1369_pos, 2, rx1369_start
+    sub rx1369_off, rx1369_pos, 1
+    substr rx1369_tgt, rx1369_tgt, rx1369_off
+  rx1369_start:
+    eq $I10, 1, rx1369_restart
+    if_null rx1369_debug, debug_504
+    rx1369_cur."!cursor_debug"("START", "infix:sym</>")
+  debug_504:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1371_done
+    goto rxscan1371_scan
+  rxscan1371_loop:
+    ($P10) = rx1369_cur."from"()
+    inc $P10
+    set rx1369_pos, $P10
+    ge rx1369_pos, rx1369_eos, rxscan1371_done
+  rxscan1371_scan:
+    set_addr $I10, rxscan1371_loop
+    rx1369_cur."!mark_push"(0, rx1369_pos, $I10)
+  rxscan1371_done:
+.annotate 'line', 276
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1372_fail
+    rx1369_cur."!mark_push"(0, rx1369_pos, $I10)
+  # rx literal  "/"
+    add $I11, rx1369_pos, 1
+    gt $I11, rx1369_eos, rx1369_fail
+    sub $I11, rx1369_pos, rx1369_off
+    ord $I11, rx1369_tgt, $I11
+    ne $I11, 47, rx1369_fail
+    add rx1369_pos, 1
+    set_addr $I10, rxcap_1372_fail
+    ($I12, $I11) = rx1369_cur."!mark_peek"($I10)
+    rx1369_cur."!cursor_pos"($I11)
+    ($P10) = rx1369_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1369_pos, "")
+    rx1369_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1372_done
+  rxcap_1372_fail:
+    goto rx1369_fail
+  rxcap_1372_done:
+  # rx subrule "O" subtype=capture negate=
+    rx1369_cur."!cursor_pos"(rx1369_pos)
+    $P10 = rx1369_cur."O"("%multiplicative :pirop</>")
+    unless $P10, rx1369_fail
+    rx1369_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1369_pos = $P10."pos"()
+  # rx pass
+    rx1369_cur."!cursor_pass"(rx1369_pos, "infix:sym</>")
+    if_null rx1369_debug, debug_505
+    rx1369_cur."!cursor_debug"("PASS", "infix:sym</>", " at pos=", rx1369_pos)
+  debug_505:
+    .return (rx1369_cur)
+  rx1369_restart:
+.annotate 'line', 8
+    if_null rx1369_debug, debug_506
+    rx1369_cur."!cursor_debug"("NEXT", "infix:sym</>")
+  debug_506:
+  rx1369_fail:
+    (rx1369_rep, rx1369_pos, $I10, $P10) = rx1369_cur."!mark_fail"(0)
+    lt rx1369_pos, -1, rx1369_done
+    eq rx1369_pos, -1, rx1369_fail
+    jump $I10
+  rx1369_done:
+    rx1369_cur."!cursor_fail"()
+    if_null rx1369_debug, debug_507
+    rx1369_cur."!cursor_debug"("FAIL", "infix:sym</>")
+  debug_507:
+    .return (rx1369_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__infix:sym</>"  :subid("148_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("O", "/")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "infix:sym<%>"  :subid("149_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1374_tgt
+    .local int rx1374_pos
+    .local int rx1374_off
+    .local int rx1374_eos
+    .local int rx1374_rep
+    .local pmc rx1374_cur
+    .local pmc rx1374_debug
+    (rx1374_cur, rx1374_pos, rx1374_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1374_debug, rx1374_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1374_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1374_eos, rx1374_tgt
+    gt rx1374_pos, rx1374_eos, rx1374_done
+    set rx1374_off, 0
+    lt rx1374_pos, 2, rx1374_start
+    sub rx1374_off, rx1374_pos, 1
+    substr rx1374_tgt, rx1374_tgt, rx1374_off
+  rx1374_start:
+    eq $I10, 1, rx1374_restart
+    if_null rx1374_debug, debug_508
+    rx1374_cur."!cursor_debug"("START", "infix:sym<%>")
+  debug_508:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1376_done
+    goto rxscan1376_scan
+  rxscan1376_loop:
+    ($P10) = rx1374_cur."from"()
+    inc $P10
+    set rx1374_pos, $P10
+    ge rx1374_pos, rx1374_eos, rxscan1376_done
+  rxscan1376_scan:
+    set_addr $I10, rxscan1376_loop
+    rx1374_cur."!mark_push"(0, rx1374_pos, $I10)
+  rxscan1376_done:
+.annotate 'line', 277
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1377_fail
+    rx1374_cur."!mark_push"(0, rx1374_pos, $I10)
+  # rx literal  "%"
+    add $I11, rx1374_pos, 1
+    gt $I11, rx1374_eos, rx1374_fail
+    sub $I11, rx1374_pos, rx1374_off
+    ord $I11, rx1374_tgt, $I11
+    ne $I11, 37, rx1374_fail
+    add rx1374_pos, 1
+    set_addr $I10, rxcap_1377_fail
+    ($I12, $I11) = rx1374_cur."!mark_peek"($I10)
+    rx1374_cur."!cursor_pos"($I11)
+    ($P10) = rx1374_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1374_pos, "")
+    rx1374_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1377_done
+  rxcap_1377_fail:
+    goto rx1374_fail
+  rxcap_1377_done:
+  # rx subrule "O" subtype=capture negate=
+    rx1374_cur."!cursor_pos"(rx1374_pos)
+    $P10 = rx1374_cur."O"("%multiplicative :pirop<%>")
+    unless $P10, rx1374_fail
+    rx1374_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1374_pos = $P10."pos"()
+  # rx pass
+    rx1374_cur."!cursor_pass"(rx1374_pos, "infix:sym<%>")
+    if_null rx1374_debug, debug_509
+    rx1374_cur."!cursor_debug"("PASS", "infix:sym<%>", " at pos=", rx1374_pos)
+  debug_509:
+    .return (rx1374_cur)
+  rx1374_restart:
+.annotate 'line', 8
+    if_null rx1374_debug, debug_510
+    rx1374_cur."!cursor_debug"("NEXT", "infix:sym<%>")
+  debug_510:
+  rx1374_fail:
+    (rx1374_rep, rx1374_pos, $I10, $P10) = rx1374_cur."!mark_fail"(0)
+    lt rx1374_pos, -1, rx1374_done
+    eq rx1374_pos, -1, rx1374_fail
+    jump $I10
+  rx1374_done:
+    rx1374_cur."!cursor_fail"()
+    if_null rx1374_debug, debug_511
+    rx1374_cur."!cursor_debug"("FAIL", "infix:sym<%>")
+  debug_511:
+    .return (rx1374_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__infix:sym<%>"  :subid("150_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("O", "%")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "infix:sym<+>"  :subid("151_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1379_tgt
+    .local int rx1379_pos
+    .local int rx1379_off
+    .local int rx1379_eos
+    .local int rx1379_rep
+    .local pmc rx1379_cur
+    .local pmc rx1379_debug
+    (rx1379_cur, rx1379_pos, rx1379_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1379_debug, rx1379_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1379_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1379_eos, rx1379_tgt
+    gt rx1379_pos, rx1379_eos, rx1379_done
+    set rx1379_off, 0
+    lt rx1379_pos, 2, rx1379_start
+    sub rx1379_off, rx1379_pos, 1
+    substr rx1379_tgt, rx1379_tgt, rx1379_off
+  rx1379_start:
+    eq $I10, 1, rx1379_restart
+    if_null rx1379_debug, debug_512
+    rx1379_cur."!cursor_debug"("START", "infix:sym<+>")
+  debug_512:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1381_done
+    goto rxscan1381_scan
+  rxscan1381_loop:
+    ($P10) = rx1379_cur."from"()
+    inc $P10
+    set rx1379_pos, $P10
+    ge rx1379_pos, rx1379_eos, rxscan1381_done
+  rxscan1381_scan:
+    set_addr $I10, rxscan1381_loop
+    rx1379_cur."!mark_push"(0, rx1379_pos, $I10)
+  rxscan1381_done:
+.annotate 'line', 279
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1382_fail
+    rx1379_cur."!mark_push"(0, rx1379_pos, $I10)
+  # rx literal  "+"
+    add $I11, rx1379_pos, 1
+    gt $I11, rx1379_eos, rx1379_fail
+    sub $I11, rx1379_pos, rx1379_off
+    ord $I11, rx1379_tgt, $I11
+    ne $I11, 43, rx1379_fail
+    add rx1379_pos, 1
+    set_addr $I10, rxcap_1382_fail
+    ($I12, $I11) = rx1379_cur."!mark_peek"($I10)
+    rx1379_cur."!cursor_pos"($I11)
+    ($P10) = rx1379_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1379_pos, "")
+    rx1379_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1382_done
+  rxcap_1382_fail:
+    goto rx1379_fail
+  rxcap_1382_done:
+  # rx subrule "O" subtype=capture negate=
+    rx1379_cur."!cursor_pos"(rx1379_pos)
+    $P10 = rx1379_cur."O"("%additive :pirop<+>")
+    unless $P10, rx1379_fail
+    rx1379_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1379_pos = $P10."pos"()
+  # rx pass
+    rx1379_cur."!cursor_pass"(rx1379_pos, "infix:sym<+>")
+    if_null rx1379_debug, debug_513
+    rx1379_cur."!cursor_debug"("PASS", "infix:sym<+>", " at pos=", rx1379_pos)
+  debug_513:
+    .return (rx1379_cur)
+  rx1379_restart:
+.annotate 'line', 8
+    if_null rx1379_debug, debug_514
+    rx1379_cur."!cursor_debug"("NEXT", "infix:sym<+>")
+  debug_514:
+  rx1379_fail:
+    (rx1379_rep, rx1379_pos, $I10, $P10) = rx1379_cur."!mark_fail"(0)
+    lt rx1379_pos, -1, rx1379_done
+    eq rx1379_pos, -1, rx1379_fail
+    jump $I10
+  rx1379_done:
+    rx1379_cur."!cursor_fail"()
+    if_null rx1379_debug, debug_515
+    rx1379_cur."!cursor_debug"("FAIL", "infix:sym<+>")
+  debug_515:
+    .return (rx1379_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__infix:sym<+>"  :subid("152_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("O", "+")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "infix:sym<->"  :subid("153_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .const 'Sub' $P1389 = "155_1792415686.23593" 
+    capture_lex $P1389
+    .local string rx1384_tgt
+    .local int rx1384_pos
+    .local int rx1384_off
+    .local int rx1384_eos
+    .local int rx1384_rep
+    .local pmc rx1384_cur
+    .local pmc rx1384_debug
+    (rx1384_cur, rx1384_pos, rx1384_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1384_debug, rx1384_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1384_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1384_eos, rx1384_tgt
+    gt rx1384_pos, rx1384_eos, rx1384_done
+    set rx1384_off, 0
+    lt rx1384_pos, 2, rx1384_start
+    sub rx1384_off, rx1384_pos, 1
+    substr rx1384_tgt, rx1384_tgt, rx1384_off
+  rx1384_start:
+    eq $I10, 1, rx1384_restart
+    if_null rx1384_debug, debug_516
+    rx1384_cur."!cursor_debug"("START", "infix:sym<->")
+  debug_516:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1386_done
+    goto rxscan1386_scan
+  rxscan1386_loop:
+    ($P10) = rx1384_cur."from"()
+    inc $P10
+    set rx1384_pos, $P10
+    ge rx1384_pos, rx1384_eos, rxscan1386_done
+  rxscan1386_scan:
+    set_addr $I10, rxscan1386_loop
+    rx1384_cur."!mark_push"(0, rx1384_pos, $I10)
+  rxscan1386_done:
+.annotate 'line', 280
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1387_fail
+    rx1384_cur."!mark_push"(0, rx1384_pos, $I10)
+  # rx literal  "-"
+    add $I11, rx1384_pos, 1
+    gt $I11, rx1384_eos, rx1384_fail
+    sub $I11, rx1384_pos, rx1384_off
+    ord $I11, rx1384_tgt, $I11
+    ne $I11, 45, rx1384_fail
+    add rx1384_pos, 1
+    set_addr $I10, rxcap_1387_fail
+    ($I12, $I11) = rx1384_cur."!mark_peek"($I10)
+    rx1384_cur."!cursor_pos"($I11)
+    ($P10) = rx1384_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1384_pos, "")
+    rx1384_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1387_done
+  rxcap_1387_fail:
+    goto rx1384_fail
+  rxcap_1387_done:
+  # rx subrule "before" subtype=zerowidth negate=1
+    rx1384_cur."!cursor_pos"(rx1384_pos)
+    .const 'Sub' $P1389 = "155_1792415686.23593" 
+    capture_lex $P1389
+    $P10 = rx1384_cur."before"($P1389)
+    if $P10, rx1384_fail
+  # rx subrule "O" subtype=capture negate=
+    rx1384_cur."!cursor_pos"(rx1384_pos)
+    $P10 = rx1384_cur."O"("%additive :pirop<->")
+    unless $P10, rx1384_fail
+    rx1384_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1384_pos = $P10."pos"()
+  # rx pass
+    rx1384_cur."!cursor_pass"(rx1384_pos, "infix:sym<->")
+    if_null rx1384_debug, debug_521
+    rx1384_cur."!cursor_debug"("PASS", "infix:sym<->", " at pos=", rx1384_pos)
+  debug_521:
+    .return (rx1384_cur)
+  rx1384_restart:
+.annotate 'line', 8
+    if_null rx1384_debug, debug_522
+    rx1384_cur."!cursor_debug"("NEXT", "infix:sym<->")
+  debug_522:
+  rx1384_fail:
+    (rx1384_rep, rx1384_pos, $I10, $P10) = rx1384_cur."!mark_fail"(0)
+    lt rx1384_pos, -1, rx1384_done
+    eq rx1384_pos, -1, rx1384_fail
+    jump $I10
+  rx1384_done:
+    rx1384_cur."!cursor_fail"()
+    if_null rx1384_debug, debug_523
+    rx1384_cur."!cursor_debug"("FAIL", "infix:sym<->")
+  debug_523:
+    .return (rx1384_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__infix:sym<->"  :subid("154_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    new $P100, "ResizablePMCArray"
+    push $P100, "-"
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "_block1388"  :anon :subid("155_1792415686.23593") :method :outer("153_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 280
+    .local string rx1390_tgt
+    .local int rx1390_pos
+    .local int rx1390_off
+    .local int rx1390_eos
+    .local int rx1390_rep
+    .local pmc rx1390_cur
+    .local pmc rx1390_debug
+    (rx1390_cur, rx1390_pos, rx1390_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1390_debug, rx1390_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1390_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1390_eos, rx1390_tgt
+    gt rx1390_pos, rx1390_eos, rx1390_done
+    set rx1390_off, 0
+    lt rx1390_pos, 2, rx1390_start
+    sub rx1390_off, rx1390_pos, 1
+    substr rx1390_tgt, rx1390_tgt, rx1390_off
+  rx1390_start:
+    eq $I10, 1, rx1390_restart
+    if_null rx1390_debug, debug_517
+    rx1390_cur."!cursor_debug"("START", "")
+  debug_517:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1391_done
+    goto rxscan1391_scan
+  rxscan1391_loop:
+    ($P10) = rx1390_cur."from"()
+    inc $P10
+    set rx1390_pos, $P10
+    ge rx1390_pos, rx1390_eos, rxscan1391_done
+  rxscan1391_scan:
+    set_addr $I10, rxscan1391_loop
+    rx1390_cur."!mark_push"(0, rx1390_pos, $I10)
+  rxscan1391_done:
+  # rx literal  ">"
+    add $I11, rx1390_pos, 1
+    gt $I11, rx1390_eos, rx1390_fail
+    sub $I11, rx1390_pos, rx1390_off
+    ord $I11, rx1390_tgt, $I11
+    ne $I11, 62, rx1390_fail
+    add rx1390_pos, 1
+  # rx pass
+    rx1390_cur."!cursor_pass"(rx1390_pos, "")
+    if_null rx1390_debug, debug_518
+    rx1390_cur."!cursor_debug"("PASS", "", " at pos=", rx1390_pos)
+  debug_518:
+    .return (rx1390_cur)
+  rx1390_restart:
+    if_null rx1390_debug, debug_519
+    rx1390_cur."!cursor_debug"("NEXT", "")
+  debug_519:
+  rx1390_fail:
+    (rx1390_rep, rx1390_pos, $I10, $P10) = rx1390_cur."!mark_fail"(0)
+    lt rx1390_pos, -1, rx1390_done
+    eq rx1390_pos, -1, rx1390_fail
+    jump $I10
+  rx1390_done:
+    rx1390_cur."!cursor_fail"()
+    if_null rx1390_debug, debug_520
+    rx1390_cur."!cursor_debug"("FAIL", "")
+  debug_520:
+    .return (rx1390_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "infix:sym<==>"  :subid("156_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1393_tgt
+    .local int rx1393_pos
+    .local int rx1393_off
+    .local int rx1393_eos
+    .local int rx1393_rep
+    .local pmc rx1393_cur
+    .local pmc rx1393_debug
+    (rx1393_cur, rx1393_pos, rx1393_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1393_debug, rx1393_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1393_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1393_eos, rx1393_tgt
+    gt rx1393_pos, rx1393_eos, rx1393_done
+    set rx1393_off, 0
+    lt rx1393_pos, 2, rx1393_start
+    sub rx1393_off, rx1393_pos, 1
+    substr rx1393_tgt, rx1393_tgt, rx1393_off
+  rx1393_start:
+    eq $I10, 1, rx1393_restart
+    if_null rx1393_debug, debug_524
+    rx1393_cur."!cursor_debug"("START", "infix:sym<==>")
+  debug_524:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1395_done
+    goto rxscan1395_scan
+  rxscan1395_loop:
+    ($P10) = rx1393_cur."from"()
+    inc $P10
+    set rx1393_pos, $P10
+    ge rx1393_pos, rx1393_eos, rxscan1395_done
+  rxscan1395_scan:
+    set_addr $I10, rxscan1395_loop
+    rx1393_cur."!mark_push"(0, rx1393_pos, $I10)
+  rxscan1395_done:
+.annotate 'line', 282
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1396_fail
+    rx1393_cur."!mark_push"(0, rx1393_pos, $I10)
+  # rx literal  "=="
+    add $I11, rx1393_pos, 2
+    gt $I11, rx1393_eos, rx1393_fail
+    sub $I11, rx1393_pos, rx1393_off
+    substr $S10, rx1393_tgt, $I11, 2
+    ne $S10, "==", rx1393_fail
+    add rx1393_pos, 2
+    set_addr $I10, rxcap_1396_fail
+    ($I12, $I11) = rx1393_cur."!mark_peek"($I10)
+    rx1393_cur."!cursor_pos"($I11)
+    ($P10) = rx1393_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1393_pos, "")
+    rx1393_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1396_done
+  rxcap_1396_fail:
+    goto rx1393_fail
+  rxcap_1396_done:
+  # rx subrule "O" subtype=capture negate=
+    rx1393_cur."!cursor_pos"(rx1393_pos)
+    $P10 = rx1393_cur."O"("%relational :pirop<==>")
+    unless $P10, rx1393_fail
+    rx1393_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1393_pos = $P10."pos"()
+  # rx pass
+    rx1393_cur."!cursor_pass"(rx1393_pos, "infix:sym<==>")
+    if_null rx1393_debug, debug_525
+    rx1393_cur."!cursor_debug"("PASS", "infix:sym<==>", " at pos=", rx1393_pos)
+  debug_525:
+    .return (rx1393_cur)
+  rx1393_restart:
+.annotate 'line', 8
+    if_null rx1393_debug, debug_526
+    rx1393_cur."!cursor_debug"("NEXT", "infix:sym<==>")
+  debug_526:
+  rx1393_fail:
+    (rx1393_rep, rx1393_pos, $I10, $P10) = rx1393_cur."!mark_fail"(0)
+    lt rx1393_pos, -1, rx1393_done
+    eq rx1393_pos, -1, rx1393_fail
+    jump $I10
+  rx1393_done:
+    rx1393_cur."!cursor_fail"()
+    if_null rx1393_debug, debug_527
+    rx1393_cur."!cursor_debug"("FAIL", "infix:sym<==>")
+  debug_527:
+    .return (rx1393_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__infix:sym<==>"  :subid("157_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("O", "==")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "infix:sym<!=>"  :subid("158_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1398_tgt
+    .local int rx1398_pos
+    .local int rx1398_off
+    .local int rx1398_eos
+    .local int rx1398_rep
+    .local pmc rx1398_cur
+    .local pmc rx1398_debug
+    (rx1398_cur, rx1398_pos, rx1398_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1398_debug, rx1398_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1398_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1398_eos, rx1398_tgt
+    gt rx1398_pos, rx1398_eos, rx1398_done
+    set rx1398_off, 0
+    lt rx1398_pos, 2, rx1398_start
+    sub rx1398_off, rx1398_pos, 1
+    substr rx1398_tgt, rx1398_tgt, rx1398_off
+  rx1398_start:
+    eq $I10, 1, rx1398_restart
+    if_null rx1398_debug, debug_528
+    rx1398_cur."!cursor_debug"("START", "infix:sym<!=>")
+  debug_528:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1400_done
+    goto rxscan1400_scan
+  rxscan1400_loop:
+    ($P10) = rx1398_cur."from"()
+    inc $P10
+    set rx1398_pos, $P10
+    ge rx1398_pos, rx1398_eos, rxscan1400_done
+  rxscan1400_scan:
+    set_addr $I10, rxscan1400_loop
+    rx1398_cur."!mark_push"(0, rx1398_pos, $I10)
+  rxscan1400_done:
+.annotate 'line', 283
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1401_fail
+    rx1398_cur."!mark_push"(0, rx1398_pos, $I10)
+  # rx literal  "!="
+    add $I11, rx1398_pos, 2
+    gt $I11, rx1398_eos, rx1398_fail
+    sub $I11, rx1398_pos, rx1398_off
+    substr $S10, rx1398_tgt, $I11, 2
+    ne $S10, "!=", rx1398_fail
+    add rx1398_pos, 2
+    set_addr $I10, rxcap_1401_fail
+    ($I12, $I11) = rx1398_cur."!mark_peek"($I10)
+    rx1398_cur."!cursor_pos"($I11)
+    ($P10) = rx1398_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1398_pos, "")
+    rx1398_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1401_done
+  rxcap_1401_fail:
+    goto rx1398_fail
+  rxcap_1401_done:
+  # rx subrule "O" subtype=capture negate=
+    rx1398_cur."!cursor_pos"(rx1398_pos)
+    $P10 = rx1398_cur."O"("%relational :pirop<!=>")
+    unless $P10, rx1398_fail
+    rx1398_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1398_pos = $P10."pos"()
+  # rx pass
+    rx1398_cur."!cursor_pass"(rx1398_pos, "infix:sym<!=>")
+    if_null rx1398_debug, debug_529
+    rx1398_cur."!cursor_debug"("PASS", "infix:sym<!=>", " at pos=", rx1398_pos)
+  debug_529:
+    .return (rx1398_cur)
+  rx1398_restart:
+.annotate 'line', 8
+    if_null rx1398_debug, debug_530
+    rx1398_cur."!cursor_debug"("NEXT", "infix:sym<!=>")
+  debug_530:
+  rx1398_fail:
+    (rx1398_rep, rx1398_pos, $I10, $P10) = rx1398_cur."!mark_fail"(0)
+    lt rx1398_pos, -1, rx1398_done
+    eq rx1398_pos, -1, rx1398_fail
+    jump $I10
+  rx1398_done:
+    rx1398_cur."!cursor_fail"()
+    if_null rx1398_debug, debug_531
+    rx1398_cur."!cursor_debug"("FAIL", "infix:sym<!=>")
+  debug_531:
+    .return (rx1398_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__infix:sym<!=>"  :subid("159_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("O", "!=")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "infix:sym<<=>"  :subid("160_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1403_tgt
+    .local int rx1403_pos
+    .local int rx1403_off
+    .local int rx1403_eos
+    .local int rx1403_rep
+    .local pmc rx1403_cur
+    .local pmc rx1403_debug
+    (rx1403_cur, rx1403_pos, rx1403_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1403_debug, rx1403_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1403_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1403_eos, rx1403_tgt
+    gt rx1403_pos, rx1403_eos, rx1403_done
+    set rx1403_off, 0
+    lt rx1403_pos, 2, rx1403_start
+    sub rx1403_off, rx1403_pos, 1
+    substr rx1403_tgt, rx1403_tgt, rx1403_off
+  rx1403_start:
+    eq $I10, 1, rx1403_restart
+    if_null rx1403_debug, debug_532
+    rx1403_cur."!cursor_debug"("START", "infix:sym<<=>")
+  debug_532:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1405_done
+    goto rxscan1405_scan
+  rxscan1405_loop:
+    ($P10) = rx1403_cur."from"()
+    inc $P10
+    set rx1403_pos, $P10
+    ge rx1403_pos, rx1403_eos, rxscan1405_done
+  rxscan1405_scan:
+    set_addr $I10, rxscan1405_loop
+    rx1403_cur."!mark_push"(0, rx1403_pos, $I10)
+  rxscan1405_done:
+.annotate 'line', 284
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1406_fail
+    rx1403_cur."!mark_push"(0, rx1403_pos, $I10)
+  # rx literal  "<="
+    add $I11, rx1403_pos, 2
+    gt $I11, rx1403_eos, rx1403_fail
+    sub $I11, rx1403_pos, rx1403_off
+    substr $S10, rx1403_tgt, $I11, 2
+    ne $S10, "<=", rx1403_fail
+    add rx1403_pos, 2
+    set_addr $I10, rxcap_1406_fail
+    ($I12, $I11) = rx1403_cur."!mark_peek"($I10)
+    rx1403_cur."!cursor_pos"($I11)
+    ($P10) = rx1403_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1403_pos, "")
+    rx1403_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1406_done
+  rxcap_1406_fail:
+    goto rx1403_fail
+  rxcap_1406_done:
+  # rx subrule "O" subtype=capture negate=
+    rx1403_cur."!cursor_pos"(rx1403_pos)
+    $P10 = rx1403_cur."O"("%relational :pirop<le>")
+    unless $P10, rx1403_fail
+    rx1403_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1403_pos = $P10."pos"()
+  # rx pass
+    rx1403_cur."!cursor_pass"(rx1403_pos, "infix:sym<<=>")
+    if_null rx1403_debug, debug_533
+    rx1403_cur."!cursor_debug"("PASS", "infix:sym<<=>", " at pos=", rx1403_pos)
+  debug_533:
+    .return (rx1403_cur)
+  rx1403_restart:
+.annotate 'line', 8
+    if_null rx1403_debug, debug_534
+    rx1403_cur."!cursor_debug"("NEXT", "infix:sym<<=>")
+  debug_534:
+  rx1403_fail:
+    (rx1403_rep, rx1403_pos, $I10, $P10) = rx1403_cur."!mark_fail"(0)
+    lt rx1403_pos, -1, rx1403_done
+    eq rx1403_pos, -1, rx1403_fail
+    jump $I10
+  rx1403_done:
+    rx1403_cur."!cursor_fail"()
+    if_null rx1403_debug, debug_535
+    rx1403_cur."!cursor_debug"("FAIL", "infix:sym<<=>")
+  debug_535:
+    .return (rx1403_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__infix:sym<<=>"  :subid("161_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("O", "<=")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "infix:sym<>=>"  :subid("162_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1408_tgt
+    .local int rx1408_pos
+    .local int rx1408_off
+    .local int rx1408_eos
+    .local int rx1408_rep
+    .local pmc rx1408_cur
+    .local pmc rx1408_debug
+    (rx1408_cur, rx1408_pos, rx1408_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1408_debug, rx1408_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1408_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1408_eos, rx1408_tgt
+    gt rx1408_pos, rx1408_eos, rx1408_done
+    set rx1408_off, 0
+    lt rx1408_pos, 2, rx1408_start
+    sub rx1408_off, rx1408_pos, 1
+    substr rx1408_tgt, rx1408_tgt, rx1408_off
+  rx1408_start:
+    eq $I10, 1, rx1408_restart
+    if_null rx1408_debug, debug_536
+    rx1408_cur."!cursor_debug"("START", "infix:sym<>=>")
+  debug_536:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1410_done
+    goto rxscan1410_scan
+  rxscan1410_loop:
+    ($P10) = rx1408_cur."from"()
+    inc $P10
+    set rx1408_pos, $P10
+    ge rx1408_pos, rx1408_eos, rxscan1410_done
+  rxscan1410_scan:
+    set_addr $I10, rxscan1410_loop
+    rx1408_cur."!mark_push"(0, rx1408_pos, $I10)
+  rxscan1410_done:
+.annotate 'line', 285
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1411_fail
+    rx1408_cur."!mark_push"(0, rx1408_pos, $I10)
+  # rx literal  ">="
+    add $I11, rx1408_pos, 2
+    gt $I11, rx1408_eos, rx1408_fail
+    sub $I11, rx1408_pos, rx1408_off
+    substr $S10, rx1408_tgt, $I11, 2
+    ne $S10, ">=", rx1408_fail
+    add rx1408_pos, 2
+    set_addr $I10, rxcap_1411_fail
+    ($I12, $I11) = rx1408_cur."!mark_peek"($I10)
+    rx1408_cur."!cursor_pos"($I11)
+    ($P10) = rx1408_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1408_pos, "")
+    rx1408_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1411_done
+  rxcap_1411_fail:
+    goto rx1408_fail
+  rxcap_1411_done:
+  # rx subrule "O" subtype=capture negate=
+    rx1408_cur."!cursor_pos"(rx1408_pos)
+    $P10 = rx1408_cur."O"("%relational :pirop<ge>")
+    unless $P10, rx1408_fail
+    rx1408_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1408_pos = $P10."pos"()
+  # rx pass
+    rx1408_cur."!cursor_pass"(rx1408_pos, "infix:sym<>=>")
+    if_null rx1408_debug, debug_537
+    rx1408_cur."!cursor_debug"("PASS", "infix:sym<>=>", " at pos=", rx1408_pos)
+  debug_537:
+    .return (rx1408_cur)
+  rx1408_restart:
+.annotate 'line', 8
+    if_null rx1408_debug, debug_538
+    rx1408_cur."!cursor_debug"("NEXT", "infix:sym<>=>")
+  debug_538:
+  rx1408_fail:
+    (rx1408_rep, rx1408_pos, $I10, $P10) = rx1408_cur."!mark_fail"(0)
+    lt rx1408_pos, -1, rx1408_done
+    eq rx1408_pos, -1, rx1408_fail
+    jump $I10
+  rx1408_done:
+    rx1408_cur."!cursor_fail"()
+    if_null rx1408_debug, debug_539
+    rx1408_cur."!cursor_debug"("FAIL", "infix:sym<>=>")
+  debug_539:
+    .return (rx1408_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__infix:sym<>=>"  :subid("163_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("O", ">=")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "infix:sym<<>"  :subid("164_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1413_tgt
+    .local int rx1413_pos
+    .local int rx1413_off
+    .local int rx1413_eos
+    .local int rx1413_rep
+    .local pmc rx1413_cur
+    .local pmc rx1413_debug
+    (rx1413_cur, rx1413_pos, rx1413_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1413_debug, rx1413_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1413_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1413_eos, rx1413_tgt
+    gt rx1413_pos, rx1413_eos, rx1413_done
+    set rx1413_off, 0
+    lt rx1413_pos, 2, rx1413_start
+    sub rx1413_off, rx1413_pos, 1
+    substr rx1413_tgt, rx1413_tgt, rx1413_off
+  rx1413_start:
+    eq $I10, 1, rx1413_restart
+    if_null rx1413_debug, debug_540
+    rx1413_cur."!cursor_debug"("START", "infix:sym<<>")
+  debug_540:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1415_done
+    goto rxscan1415_scan
+  rxscan1415_loop:
+    ($P10) = rx1413_cur."from"()
+    inc $P10
+    set rx1413_pos, $P10
+    ge rx1413_pos, rx1413_eos, rxscan1415_done
+  rxscan1415_scan:
+    set_addr $I10, rxscan1415_loop
+    rx1413_cur."!mark_push"(0, rx1413_pos, $I10)
+  rxscan1415_done:
+.annotate 'line', 286
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1416_fail
+    rx1413_cur."!mark_push"(0, rx1413_pos, $I10)
+  # rx literal  "<"
+    add $I11, rx1413_pos, 1
+    gt $I11, rx1413_eos, rx1413_fail
+    sub $I11, rx1413_pos, rx1413_off
+    ord $I11, rx1413_tgt, $I11
+    ne $I11, 60, rx1413_fail
+    add rx1413_pos, 1
+    set_addr $I10, rxcap_1416_fail
+    ($I12, $I11) = rx1413_cur."!mark_peek"($I10)
+    rx1413_cur."!cursor_pos"($I11)
+    ($P10) = rx1413_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1413_pos, "")
+    rx1413_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1416_done
+  rxcap_1416_fail:
+    goto rx1413_fail
+  rxcap_1416_done:
+  # rx subrule "O" subtype=capture negate=
+    rx1413_cur."!cursor_pos"(rx1413_pos)
+    $P10 = rx1413_cur."O"("%relational :pirop<lt>")
+    unless $P10, rx1413_fail
+    rx1413_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1413_pos = $P10."pos"()
+  # rx pass
+    rx1413_cur."!cursor_pass"(rx1413_pos, "infix:sym<<>")
+    if_null rx1413_debug, debug_541
+    rx1413_cur."!cursor_debug"("PASS", "infix:sym<<>", " at pos=", rx1413_pos)
+  debug_541:
+    .return (rx1413_cur)
+  rx1413_restart:
+.annotate 'line', 8
+    if_null rx1413_debug, debug_542
+    rx1413_cur."!cursor_debug"("NEXT", "infix:sym<<>")
+  debug_542:
+  rx1413_fail:
+    (rx1413_rep, rx1413_pos, $I10, $P10) = rx1413_cur."!mark_fail"(0)
+    lt rx1413_pos, -1, rx1413_done
+    eq rx1413_pos, -1, rx1413_fail
+    jump $I10
+  rx1413_done:
+    rx1413_cur."!cursor_fail"()
+    if_null rx1413_debug, debug_543
+    rx1413_cur."!cursor_debug"("FAIL", "infix:sym<<>")
+  debug_543:
+    .return (rx1413_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__infix:sym<<>"  :subid("165_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("O", "<")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "infix:sym<>>"  :subid("166_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1418_tgt
+    .local int rx1418_pos
+    .local int rx1418_off
+    .local int rx1418_eos
+    .local int rx1418_rep
+    .local pmc rx1418_cur
+    .local pmc rx1418_debug
+    (rx1418_cur, rx1418_pos, rx1418_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1418_debug, rx1418_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1418_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1418_eos, rx1418_tgt
+    gt rx1418_pos, rx1418_eos, rx1418_done
+    set rx1418_off, 0
+    lt rx1418_pos, 2, rx1418_start
+    sub rx1418_off, rx1418_pos, 1
+    substr rx1418_tgt, rx1418_tgt, rx1418_off
+  rx1418_start:
+    eq $I10, 1, rx1418_restart
+    if_null rx1418_debug, debug_544
+    rx1418_cur."!cursor_debug"("START", "infix:sym<>>")
+  debug_544:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1420_done
+    goto rxscan1420_scan
+  rxscan1420_loop:
+    ($P10) = rx1418_cur."from"()
+    inc $P10
+    set rx1418_pos, $P10
+    ge rx1418_pos, rx1418_eos, rxscan1420_done
+  rxscan1420_scan:
+    set_addr $I10, rxscan1420_loop
+    rx1418_cur."!mark_push"(0, rx1418_pos, $I10)
+  rxscan1420_done:
+.annotate 'line', 287
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1421_fail
+    rx1418_cur."!mark_push"(0, rx1418_pos, $I10)
+  # rx literal  ">"
+    add $I11, rx1418_pos, 1
+    gt $I11, rx1418_eos, rx1418_fail
+    sub $I11, rx1418_pos, rx1418_off
+    ord $I11, rx1418_tgt, $I11
+    ne $I11, 62, rx1418_fail
+    add rx1418_pos, 1
+    set_addr $I10, rxcap_1421_fail
+    ($I12, $I11) = rx1418_cur."!mark_peek"($I10)
+    rx1418_cur."!cursor_pos"($I11)
+    ($P10) = rx1418_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1418_pos, "")
+    rx1418_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1421_done
+  rxcap_1421_fail:
+    goto rx1418_fail
+  rxcap_1421_done:
+  # rx subrule "O" subtype=capture negate=
+    rx1418_cur."!cursor_pos"(rx1418_pos)
+    $P10 = rx1418_cur."O"("%relational :pirop<gt>")
+    unless $P10, rx1418_fail
+    rx1418_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1418_pos = $P10."pos"()
+  # rx pass
+    rx1418_cur."!cursor_pass"(rx1418_pos, "infix:sym<>>")
+    if_null rx1418_debug, debug_545
+    rx1418_cur."!cursor_debug"("PASS", "infix:sym<>>", " at pos=", rx1418_pos)
+  debug_545:
+    .return (rx1418_cur)
+  rx1418_restart:
+.annotate 'line', 8
+    if_null rx1418_debug, debug_546
+    rx1418_cur."!cursor_debug"("NEXT", "infix:sym<>>")
+  debug_546:
+  rx1418_fail:
+    (rx1418_rep, rx1418_pos, $I10, $P10) = rx1418_cur."!mark_fail"(0)
+    lt rx1418_pos, -1, rx1418_done
+    eq rx1418_pos, -1, rx1418_fail
+    jump $I10
+  rx1418_done:
+    rx1418_cur."!cursor_fail"()
+    if_null rx1418_debug, debug_547
+    rx1418_cur."!cursor_debug"("FAIL", "infix:sym<>>")
+  debug_547:
+    .return (rx1418_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__infix:sym<>>"  :subid("167_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("O", ">")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "infix:sym<&>"  :subid("168_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1423_tgt
+    .local int rx1423_pos
+    .local int rx1423_off
+    .local int rx1423_eos
+    .local int rx1423_rep
+    .local pmc rx1423_cur
+    .local pmc rx1423_debug
+    (rx1423_cur, rx1423_pos, rx1423_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1423_debug, rx1423_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1423_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1423_eos, rx1423_tgt
+    gt rx1423_pos, rx1423_eos, rx1423_done
+    set rx1423_off, 0
+    lt rx1423_pos, 2, rx1423_start
+    sub rx1423_off, rx1423_pos, 1
+    substr rx1423_tgt, rx1423_tgt, rx1423_off
+  rx1423_start:
+    eq $I10, 1, rx1423_restart
+    if_null rx1423_debug, debug_548
+    rx1423_cur."!cursor_debug"("START", "infix:sym<&>")
+  debug_548:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1425_done
+    goto rxscan1425_scan
+  rxscan1425_loop:
+    ($P10) = rx1423_cur."from"()
+    inc $P10
+    set rx1423_pos, $P10
+    ge rx1423_pos, rx1423_eos, rxscan1425_done
+  rxscan1425_scan:
+    set_addr $I10, rxscan1425_loop
+    rx1423_cur."!mark_push"(0, rx1423_pos, $I10)
+  rxscan1425_done:
+.annotate 'line', 289
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1426_fail
+    rx1423_cur."!mark_push"(0, rx1423_pos, $I10)
+  # rx literal  "&"
+    add $I11, rx1423_pos, 1
+    gt $I11, rx1423_eos, rx1423_fail
+    sub $I11, rx1423_pos, rx1423_off
+    ord $I11, rx1423_tgt, $I11
+    ne $I11, 38, rx1423_fail
+    add rx1423_pos, 1
+    set_addr $I10, rxcap_1426_fail
+    ($I12, $I11) = rx1423_cur."!mark_peek"($I10)
+    rx1423_cur."!cursor_pos"($I11)
+    ($P10) = rx1423_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1423_pos, "")
+    rx1423_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1426_done
+  rxcap_1426_fail:
+    goto rx1423_fail
+  rxcap_1426_done:
+  # rx subrule "O" subtype=capture negate=
+    rx1423_cur."!cursor_pos"(rx1423_pos)
+    $P10 = rx1423_cur."O"("%tight_and :pirop<&>")
+    unless $P10, rx1423_fail
+    rx1423_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1423_pos = $P10."pos"()
+  # rx pass
+    rx1423_cur."!cursor_pass"(rx1423_pos, "infix:sym<&>")
+    if_null rx1423_debug, debug_549
+    rx1423_cur."!cursor_debug"("PASS", "infix:sym<&>", " at pos=", rx1423_pos)
+  debug_549:
+    .return (rx1423_cur)
+  rx1423_restart:
+.annotate 'line', 8
+    if_null rx1423_debug, debug_550
+    rx1423_cur."!cursor_debug"("NEXT", "infix:sym<&>")
+  debug_550:
+  rx1423_fail:
+    (rx1423_rep, rx1423_pos, $I10, $P10) = rx1423_cur."!mark_fail"(0)
+    lt rx1423_pos, -1, rx1423_done
+    eq rx1423_pos, -1, rx1423_fail
+    jump $I10
+  rx1423_done:
+    rx1423_cur."!cursor_fail"()
+    if_null rx1423_debug, debug_551
+    rx1423_cur."!cursor_debug"("FAIL", "infix:sym<&>")
+  debug_551:
+    .return (rx1423_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__infix:sym<&>"  :subid("169_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("O", "&")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "infix:sym<^>"  :subid("170_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1428_tgt
+    .local int rx1428_pos
+    .local int rx1428_off
+    .local int rx1428_eos
+    .local int rx1428_rep
+    .local pmc rx1428_cur
+    .local pmc rx1428_debug
+    (rx1428_cur, rx1428_pos, rx1428_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1428_debug, rx1428_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1428_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1428_eos, rx1428_tgt
+    gt rx1428_pos, rx1428_eos, rx1428_done
+    set rx1428_off, 0
+    lt rx1428_pos, 2, rx1428_start
+    sub rx1428_off, rx1428_pos, 1
+    substr rx1428_tgt, rx1428_tgt, rx1428_off
+  rx1428_start:
+    eq $I10, 1, rx1428_restart
+    if_null rx1428_debug, debug_552
+    rx1428_cur."!cursor_debug"("START", "infix:sym<^>")
+  debug_552:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1430_done
+    goto rxscan1430_scan
+  rxscan1430_loop:
+    ($P10) = rx1428_cur."from"()
+    inc $P10
+    set rx1428_pos, $P10
+    ge rx1428_pos, rx1428_eos, rxscan1430_done
+  rxscan1430_scan:
+    set_addr $I10, rxscan1430_loop
+    rx1428_cur."!mark_push"(0, rx1428_pos, $I10)
+  rxscan1430_done:
+.annotate 'line', 290
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1431_fail
+    rx1428_cur."!mark_push"(0, rx1428_pos, $I10)
+  # rx literal  "^"
+    add $I11, rx1428_pos, 1
+    gt $I11, rx1428_eos, rx1428_fail
+    sub $I11, rx1428_pos, rx1428_off
+    ord $I11, rx1428_tgt, $I11
+    ne $I11, 94, rx1428_fail
+    add rx1428_pos, 1
+    set_addr $I10, rxcap_1431_fail
+    ($I12, $I11) = rx1428_cur."!mark_peek"($I10)
+    rx1428_cur."!cursor_pos"($I11)
+    ($P10) = rx1428_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1428_pos, "")
+    rx1428_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1431_done
+  rxcap_1431_fail:
+    goto rx1428_fail
+  rxcap_1431_done:
+  # rx subrule "O" subtype=capture negate=
+    rx1428_cur."!cursor_pos"(rx1428_pos)
+    $P10 = rx1428_cur."O"("%tight_and :pirop<^>")
+    unless $P10, rx1428_fail
+    rx1428_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1428_pos = $P10."pos"()
+  # rx pass
+    rx1428_cur."!cursor_pass"(rx1428_pos, "infix:sym<^>")
+    if_null rx1428_debug, debug_553
+    rx1428_cur."!cursor_debug"("PASS", "infix:sym<^>", " at pos=", rx1428_pos)
+  debug_553:
+    .return (rx1428_cur)
+  rx1428_restart:
+.annotate 'line', 8
+    if_null rx1428_debug, debug_554
+    rx1428_cur."!cursor_debug"("NEXT", "infix:sym<^>")
+  debug_554:
+  rx1428_fail:
+    (rx1428_rep, rx1428_pos, $I10, $P10) = rx1428_cur."!mark_fail"(0)
+    lt rx1428_pos, -1, rx1428_done
+    eq rx1428_pos, -1, rx1428_fail
+    jump $I10
+  rx1428_done:
+    rx1428_cur."!cursor_fail"()
+    if_null rx1428_debug, debug_555
+    rx1428_cur."!cursor_debug"("FAIL", "infix:sym<^>")
+  debug_555:
+    .return (rx1428_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__infix:sym<^>"  :subid("171_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("O", "^")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "infix:sym<|>"  :subid("172_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1433_tgt
+    .local int rx1433_pos
+    .local int rx1433_off
+    .local int rx1433_eos
+    .local int rx1433_rep
+    .local pmc rx1433_cur
+    .local pmc rx1433_debug
+    (rx1433_cur, rx1433_pos, rx1433_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1433_debug, rx1433_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1433_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1433_eos, rx1433_tgt
+    gt rx1433_pos, rx1433_eos, rx1433_done
+    set rx1433_off, 0
+    lt rx1433_pos, 2, rx1433_start
+    sub rx1433_off, rx1433_pos, 1
+    substr rx1433_tgt, rx1433_tgt, rx1433_off
+  rx1433_start:
+    eq $I10, 1, rx1433_restart
+    if_null rx1433_debug, debug_556
+    rx1433_cur."!cursor_debug"("START", "infix:sym<|>")
+  debug_556:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1435_done
+    goto rxscan1435_scan
+  rxscan1435_loop:
+    ($P10) = rx1433_cur."from"()
+    inc $P10
+    set rx1433_pos, $P10
+    ge rx1433_pos, rx1433_eos, rxscan1435_done
+  rxscan1435_scan:
+    set_addr $I10, rxscan1435_loop
+    rx1433_cur."!mark_push"(0, rx1433_pos, $I10)
+  rxscan1435_done:
+.annotate 'line', 291
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1436_fail
+    rx1433_cur."!mark_push"(0, rx1433_pos, $I10)
+  # rx literal  "|"
+    add $I11, rx1433_pos, 1
+    gt $I11, rx1433_eos, rx1433_fail
+    sub $I11, rx1433_pos, rx1433_off
+    ord $I11, rx1433_tgt, $I11
+    ne $I11, 124, rx1433_fail
+    add rx1433_pos, 1
+    set_addr $I10, rxcap_1436_fail
+    ($I12, $I11) = rx1433_cur."!mark_peek"($I10)
+    rx1433_cur."!cursor_pos"($I11)
+    ($P10) = rx1433_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1433_pos, "")
+    rx1433_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1436_done
+  rxcap_1436_fail:
+    goto rx1433_fail
+  rxcap_1436_done:
+  # rx subrule "O" subtype=capture negate=
+    rx1433_cur."!cursor_pos"(rx1433_pos)
+    $P10 = rx1433_cur."O"("%tight_or :pirop<|>")
+    unless $P10, rx1433_fail
+    rx1433_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1433_pos = $P10."pos"()
+  # rx pass
+    rx1433_cur."!cursor_pass"(rx1433_pos, "infix:sym<|>")
+    if_null rx1433_debug, debug_557
+    rx1433_cur."!cursor_debug"("PASS", "infix:sym<|>", " at pos=", rx1433_pos)
+  debug_557:
+    .return (rx1433_cur)
+  rx1433_restart:
+.annotate 'line', 8
+    if_null rx1433_debug, debug_558
+    rx1433_cur."!cursor_debug"("NEXT", "infix:sym<|>")
+  debug_558:
+  rx1433_fail:
+    (rx1433_rep, rx1433_pos, $I10, $P10) = rx1433_cur."!mark_fail"(0)
+    lt rx1433_pos, -1, rx1433_done
+    eq rx1433_pos, -1, rx1433_fail
+    jump $I10
+  rx1433_done:
+    rx1433_cur."!cursor_fail"()
+    if_null rx1433_debug, debug_559
+    rx1433_cur."!cursor_debug"("FAIL", "infix:sym<|>")
+  debug_559:
+    .return (rx1433_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__infix:sym<|>"  :subid("173_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("O", "|")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "infix:sym<&&>"  :subid("174_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1438_tgt
+    .local int rx1438_pos
+    .local int rx1438_off
+    .local int rx1438_eos
+    .local int rx1438_rep
+    .local pmc rx1438_cur
+    .local pmc rx1438_debug
+    (rx1438_cur, rx1438_pos, rx1438_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1438_debug, rx1438_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1438_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1438_eos, rx1438_tgt
+    gt rx1438_pos, rx1438_eos, rx1438_done
+    set rx1438_off, 0
+    lt rx1438_pos, 2, rx1438_start
+    sub rx1438_off, rx1438_pos, 1
+    substr rx1438_tgt, rx1438_tgt, rx1438_off
+  rx1438_start:
+    eq $I10, 1, rx1438_restart
+    if_null rx1438_debug, debug_560
+    rx1438_cur."!cursor_debug"("START", "infix:sym<&&>")
+  debug_560:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1440_done
+    goto rxscan1440_scan
+  rxscan1440_loop:
+    ($P10) = rx1438_cur."from"()
+    inc $P10
+    set rx1438_pos, $P10
+    ge rx1438_pos, rx1438_eos, rxscan1440_done
+  rxscan1440_scan:
+    set_addr $I10, rxscan1440_loop
+    rx1438_cur."!mark_push"(0, rx1438_pos, $I10)
+  rxscan1440_done:
+.annotate 'line', 293
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1441_fail
+    rx1438_cur."!mark_push"(0, rx1438_pos, $I10)
+  # rx literal  "&&"
+    add $I11, rx1438_pos, 2
+    gt $I11, rx1438_eos, rx1438_fail
+    sub $I11, rx1438_pos, rx1438_off
+    substr $S10, rx1438_tgt, $I11, 2
+    ne $S10, "&&", rx1438_fail
+    add rx1438_pos, 2
+    set_addr $I10, rxcap_1441_fail
+    ($I12, $I11) = rx1438_cur."!mark_peek"($I10)
+    rx1438_cur."!cursor_pos"($I11)
+    ($P10) = rx1438_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1438_pos, "")
+    rx1438_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1441_done
+  rxcap_1441_fail:
+    goto rx1438_fail
+  rxcap_1441_done:
+  # rx subrule "O" subtype=capture negate=
+    rx1438_cur."!cursor_pos"(rx1438_pos)
+    $P10 = rx1438_cur."O"("%tight_and :pirop<&&>")
+    unless $P10, rx1438_fail
+    rx1438_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1438_pos = $P10."pos"()
+  # rx pass
+    rx1438_cur."!cursor_pass"(rx1438_pos, "infix:sym<&&>")
+    if_null rx1438_debug, debug_561
+    rx1438_cur."!cursor_debug"("PASS", "infix:sym<&&>", " at pos=", rx1438_pos)
+  debug_561:
+    .return (rx1438_cur)
+  rx1438_restart:
+.annotate 'line', 8
+    if_null rx1438_debug, debug_562
+    rx1438_cur."!cursor_debug"("NEXT", "infix:sym<&&>")
+  debug_562:
+  rx1438_fail:
+    (rx1438_rep, rx1438_pos, $I10, $P10) = rx1438_cur."!mark_fail"(0)
+    lt rx1438_pos, -1, rx1438_done
+    eq rx1438_pos, -1, rx1438_fail
+    jump $I10
+  rx1438_done:
+    rx1438_cur."!cursor_fail"()
+    if_null rx1438_debug, debug_563
+    rx1438_cur."!cursor_debug"("FAIL", "infix:sym<&&>")
+  debug_563:
+    .return (rx1438_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__infix:sym<&&>"  :subid("175_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("O", "&&")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "infix:sym<||>"  :subid("176_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1443_tgt
+    .local int rx1443_pos
+    .local int rx1443_off
+    .local int rx1443_eos
+    .local int rx1443_rep
+    .local pmc rx1443_cur
+    .local pmc rx1443_debug
+    (rx1443_cur, rx1443_pos, rx1443_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1443_debug, rx1443_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1443_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1443_eos, rx1443_tgt
+    gt rx1443_pos, rx1443_eos, rx1443_done
+    set rx1443_off, 0
+    lt rx1443_pos, 2, rx1443_start
+    sub rx1443_off, rx1443_pos, 1
+    substr rx1443_tgt, rx1443_tgt, rx1443_off
+  rx1443_start:
+    eq $I10, 1, rx1443_restart
+    if_null rx1443_debug, debug_564
+    rx1443_cur."!cursor_debug"("START", "infix:sym<||>")
+  debug_564:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1445_done
+    goto rxscan1445_scan
+  rxscan1445_loop:
+    ($P10) = rx1443_cur."from"()
+    inc $P10
+    set rx1443_pos, $P10
+    ge rx1443_pos, rx1443_eos, rxscan1445_done
+  rxscan1445_scan:
+    set_addr $I10, rxscan1445_loop
+    rx1443_cur."!mark_push"(0, rx1443_pos, $I10)
+  rxscan1445_done:
+.annotate 'line', 294
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1446_fail
+    rx1443_cur."!mark_push"(0, rx1443_pos, $I10)
+  # rx literal  "||"
+    add $I11, rx1443_pos, 2
+    gt $I11, rx1443_eos, rx1443_fail
+    sub $I11, rx1443_pos, rx1443_off
+    substr $S10, rx1443_tgt, $I11, 2
+    ne $S10, "||", rx1443_fail
+    add rx1443_pos, 2
+    set_addr $I10, rxcap_1446_fail
+    ($I12, $I11) = rx1443_cur."!mark_peek"($I10)
+    rx1443_cur."!cursor_pos"($I11)
+    ($P10) = rx1443_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1443_pos, "")
+    rx1443_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1446_done
+  rxcap_1446_fail:
+    goto rx1443_fail
+  rxcap_1446_done:
+  # rx subrule "O" subtype=capture negate=
+    rx1443_cur."!cursor_pos"(rx1443_pos)
+    $P10 = rx1443_cur."O"("%tight_or :pirop<||>")
+    unless $P10, rx1443_fail
+    rx1443_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1443_pos = $P10."pos"()
+  # rx pass
+    rx1443_cur."!cursor_pass"(rx1443_pos, "infix:sym<||>")
+    if_null rx1443_debug, debug_565
+    rx1443_cur."!cursor_debug"("PASS", "infix:sym<||>", " at pos=", rx1443_pos)
+  debug_565:
+    .return (rx1443_cur)
+  rx1443_restart:
+.annotate 'line', 8
+    if_null rx1443_debug, debug_566
+    rx1443_cur."!cursor_debug"("NEXT", "infix:sym<||>")
+  debug_566:
+  rx1443_fail:
+    (rx1443_rep, rx1443_pos, $I10, $P10) = rx1443_cur."!mark_fail"(0)
+    lt rx1443_pos, -1, rx1443_done
+    eq rx1443_pos, -1, rx1443_fail
+    jump $I10
+  rx1443_done:
+    rx1443_cur."!cursor_fail"()
+    if_null rx1443_debug, debug_567
+    rx1443_cur."!cursor_debug"("FAIL", "infix:sym<||>")
+  debug_567:
+    .return (rx1443_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__infix:sym<||>"  :subid("177_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("O", "||")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "infix:sym<<<>"  :subid("178_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1448_tgt
+    .local int rx1448_pos
+    .local int rx1448_off
+    .local int rx1448_eos
+    .local int rx1448_rep
+    .local pmc rx1448_cur
+    .local pmc rx1448_debug
+    (rx1448_cur, rx1448_pos, rx1448_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1448_debug, rx1448_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1448_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1448_eos, rx1448_tgt
+    gt rx1448_pos, rx1448_eos, rx1448_done
+    set rx1448_off, 0
+    lt rx1448_pos, 2, rx1448_start
+    sub rx1448_off, rx1448_pos, 1
+    substr rx1448_tgt, rx1448_tgt, rx1448_off
+  rx1448_start:
+    eq $I10, 1, rx1448_restart
+    if_null rx1448_debug, debug_568
+    rx1448_cur."!cursor_debug"("START", "infix:sym<<<>")
+  debug_568:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1450_done
+    goto rxscan1450_scan
+  rxscan1450_loop:
+    ($P10) = rx1448_cur."from"()
+    inc $P10
+    set rx1448_pos, $P10
+    ge rx1448_pos, rx1448_eos, rxscan1450_done
+  rxscan1450_scan:
+    set_addr $I10, rxscan1450_loop
+    rx1448_cur."!mark_push"(0, rx1448_pos, $I10)
+  rxscan1450_done:
+.annotate 'line', 296
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1451_fail
+    rx1448_cur."!mark_push"(0, rx1448_pos, $I10)
+  # rx literal  "<<"
+    add $I11, rx1448_pos, 2
+    gt $I11, rx1448_eos, rx1448_fail
+    sub $I11, rx1448_pos, rx1448_off
+    substr $S10, rx1448_tgt, $I11, 2
+    ne $S10, "<<", rx1448_fail
+    add rx1448_pos, 2
+    set_addr $I10, rxcap_1451_fail
+    ($I12, $I11) = rx1448_cur."!mark_peek"($I10)
+    rx1448_cur."!cursor_pos"($I11)
+    ($P10) = rx1448_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1448_pos, "")
+    rx1448_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1451_done
+  rxcap_1451_fail:
+    goto rx1448_fail
+  rxcap_1451_done:
+  # rx subrule "O" subtype=capture negate=
+    rx1448_cur."!cursor_pos"(rx1448_pos)
+    $P10 = rx1448_cur."O"("%multiplicative :pirop<shl>")
+    unless $P10, rx1448_fail
+    rx1448_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1448_pos = $P10."pos"()
+  # rx pass
+    rx1448_cur."!cursor_pass"(rx1448_pos, "infix:sym<<<>")
+    if_null rx1448_debug, debug_569
+    rx1448_cur."!cursor_debug"("PASS", "infix:sym<<<>", " at pos=", rx1448_pos)
+  debug_569:
+    .return (rx1448_cur)
+  rx1448_restart:
+.annotate 'line', 8
+    if_null rx1448_debug, debug_570
+    rx1448_cur."!cursor_debug"("NEXT", "infix:sym<<<>")
+  debug_570:
+  rx1448_fail:
+    (rx1448_rep, rx1448_pos, $I10, $P10) = rx1448_cur."!mark_fail"(0)
+    lt rx1448_pos, -1, rx1448_done
+    eq rx1448_pos, -1, rx1448_fail
+    jump $I10
+  rx1448_done:
+    rx1448_cur."!cursor_fail"()
+    if_null rx1448_debug, debug_571
+    rx1448_cur."!cursor_debug"("FAIL", "infix:sym<<<>")
+  debug_571:
+    .return (rx1448_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__infix:sym<<<>"  :subid("179_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("O", "<<")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "infix:sym<>>>"  :subid("180_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1453_tgt
+    .local int rx1453_pos
+    .local int rx1453_off
+    .local int rx1453_eos
+    .local int rx1453_rep
+    .local pmc rx1453_cur
+    .local pmc rx1453_debug
+    (rx1453_cur, rx1453_pos, rx1453_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1453_debug, rx1453_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1453_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1453_eos, rx1453_tgt
+    gt rx1453_pos, rx1453_eos, rx1453_done
+    set rx1453_off, 0
+    lt rx1453_pos, 2, rx1453_start
+    sub rx1453_off, rx1453_pos, 1
+    substr rx1453_tgt, rx1453_tgt, rx1453_off
+  rx1453_start:
+    eq $I10, 1, rx1453_restart
+    if_null rx1453_debug, debug_572
+    rx1453_cur."!cursor_debug"("START", "infix:sym<>>>")
+  debug_572:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1455_done
+    goto rxscan1455_scan
+  rxscan1455_loop:
+    ($P10) = rx1453_cur."from"()
+    inc $P10
+    set rx1453_pos, $P10
+    ge rx1453_pos, rx1453_eos, rxscan1455_done
+  rxscan1455_scan:
+    set_addr $I10, rxscan1455_loop
+    rx1453_cur."!mark_push"(0, rx1453_pos, $I10)
+  rxscan1455_done:
+.annotate 'line', 297
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1456_fail
+    rx1453_cur."!mark_push"(0, rx1453_pos, $I10)
+  # rx literal  ">>"
+    add $I11, rx1453_pos, 2
+    gt $I11, rx1453_eos, rx1453_fail
+    sub $I11, rx1453_pos, rx1453_off
+    substr $S10, rx1453_tgt, $I11, 2
+    ne $S10, ">>", rx1453_fail
+    add rx1453_pos, 2
+    set_addr $I10, rxcap_1456_fail
+    ($I12, $I11) = rx1453_cur."!mark_peek"($I10)
+    rx1453_cur."!cursor_pos"($I11)
+    ($P10) = rx1453_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1453_pos, "")
+    rx1453_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1456_done
+  rxcap_1456_fail:
+    goto rx1453_fail
+  rxcap_1456_done:
+  # rx subrule "O" subtype=capture negate=
+    rx1453_cur."!cursor_pos"(rx1453_pos)
+    $P10 = rx1453_cur."O"("%multiplicative :pirop<shr>")
+    unless $P10, rx1453_fail
+    rx1453_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1453_pos = $P10."pos"()
+  # rx pass
+    rx1453_cur."!cursor_pass"(rx1453_pos, "infix:sym<>>>")
+    if_null rx1453_debug, debug_573
+    rx1453_cur."!cursor_debug"("PASS", "infix:sym<>>>", " at pos=", rx1453_pos)
+  debug_573:
+    .return (rx1453_cur)
+  rx1453_restart:
+.annotate 'line', 8
+    if_null rx1453_debug, debug_574
+    rx1453_cur."!cursor_debug"("NEXT", "infix:sym<>>>")
+  debug_574:
+  rx1453_fail:
+    (rx1453_rep, rx1453_pos, $I10, $P10) = rx1453_cur."!mark_fail"(0)
+    lt rx1453_pos, -1, rx1453_done
+    eq rx1453_pos, -1, rx1453_fail
+    jump $I10
+  rx1453_done:
+    rx1453_cur."!cursor_fail"()
+    if_null rx1453_debug, debug_575
+    rx1453_cur."!cursor_debug"("FAIL", "infix:sym<>>>")
+  debug_575:
+    .return (rx1453_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__infix:sym<>>>"  :subid("181_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("O", ">>")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "infix:sym<?:>"  :subid("182_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1458_tgt
+    .local int rx1458_pos
+    .local int rx1458_off
+    .local int rx1458_eos
+    .local int rx1458_rep
+    .local pmc rx1458_cur
+    .local pmc rx1458_debug
+    (rx1458_cur, rx1458_pos, rx1458_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1458_debug, rx1458_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1458_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1458_eos, rx1458_tgt
+    gt rx1458_pos, rx1458_eos, rx1458_done
+    set rx1458_off, 0
+    lt rx1458_pos, 2, rx1458_start
+    sub rx1458_off, rx1458_pos, 1
+    substr rx1458_tgt, rx1458_tgt, rx1458_off
+  rx1458_start:
+    eq $I10, 1, rx1458_restart
+    if_null rx1458_debug, debug_576
+    rx1458_cur."!cursor_debug"("START", "infix:sym<?:>")
+  debug_576:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1460_done
+    goto rxscan1460_scan
+  rxscan1460_loop:
+    ($P10) = rx1458_cur."from"()
+    inc $P10
+    set rx1458_pos, $P10
+    ge rx1458_pos, rx1458_eos, rxscan1460_done
+  rxscan1460_scan:
+    set_addr $I10, rxscan1460_loop
+    rx1458_cur."!mark_push"(0, rx1458_pos, $I10)
+  rxscan1460_done:
+.annotate 'line', 300
+  # rx literal  "?"
+    add $I11, rx1458_pos, 1
+    gt $I11, rx1458_eos, rx1458_fail
+    sub $I11, rx1458_pos, rx1458_off
+    ord $I11, rx1458_tgt, $I11
+    ne $I11, 63, rx1458_fail
+    add rx1458_pos, 1
+.annotate 'line', 301
+  # rx subrule "ws" subtype=method negate=
+    rx1458_cur."!cursor_pos"(rx1458_pos)
+    $P10 = rx1458_cur."ws"()
+    unless $P10, rx1458_fail
+    rx1458_pos = $P10."pos"()
+.annotate 'line', 302
+  # rx subrule "EXPR" subtype=capture negate=
+    rx1458_cur."!cursor_pos"(rx1458_pos)
+    $P10 = rx1458_cur."EXPR"("i=")
+    unless $P10, rx1458_fail
+    rx1458_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("EXPR")
+    rx1458_pos = $P10."pos"()
+.annotate 'line', 303
+  # rx literal  ":"
+    add $I11, rx1458_pos, 1
+    gt $I11, rx1458_eos, rx1458_fail
+    sub $I11, rx1458_pos, rx1458_off
+    ord $I11, rx1458_tgt, $I11
+    ne $I11, 58, rx1458_fail
+    add rx1458_pos, 1
+.annotate 'line', 304
+  # rx subrule "O" subtype=capture negate=
+    rx1458_cur."!cursor_pos"(rx1458_pos)
+    $P10 = rx1458_cur."O"("%conditional, :reducecheck<ternary>")
+    unless $P10, rx1458_fail
+    rx1458_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1458_pos = $P10."pos"()
+.annotate 'line', 299
+  # rx pass
+    rx1458_cur."!cursor_pass"(rx1458_pos, "infix:sym<?:>")
+    if_null rx1458_debug, debug_577
+    rx1458_cur."!cursor_debug"("PASS", "infix:sym<?:>", " at pos=", rx1458_pos)
+  debug_577:
+    .return (rx1458_cur)
+  rx1458_restart:
+.annotate 'line', 8
+    if_null rx1458_debug, debug_578
+    rx1458_cur."!cursor_debug"("NEXT", "infix:sym<?:>")
+  debug_578:
+  rx1458_fail:
+    (rx1458_rep, rx1458_pos, $I10, $P10) = rx1458_cur."!mark_fail"(0)
+    lt rx1458_pos, -1, rx1458_done
+    eq rx1458_pos, -1, rx1458_fail
+    jump $I10
+  rx1458_done:
+    rx1458_cur."!cursor_fail"()
+    if_null rx1458_debug, debug_579
+    rx1458_cur."!cursor_debug"("FAIL", "infix:sym<?:>")
+  debug_579:
+    .return (rx1458_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__infix:sym<?:>"  :subid("183_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("ws", "?")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "postcircumfix:sym<[ ]>"  :subid("184_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1462_tgt
+    .local int rx1462_pos
+    .local int rx1462_off
+    .local int rx1462_eos
+    .local int rx1462_rep
+    .local pmc rx1462_cur
+    .local pmc rx1462_debug
+    (rx1462_cur, rx1462_pos, rx1462_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1462_debug, rx1462_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1462_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1462_eos, rx1462_tgt
+    gt rx1462_pos, rx1462_eos, rx1462_done
+    set rx1462_off, 0
+    lt rx1462_pos, 2, rx1462_start
+    sub rx1462_off, rx1462_pos, 1
+    substr rx1462_tgt, rx1462_tgt, rx1462_off
+  rx1462_start:
+    eq $I10, 1, rx1462_restart
+    if_null rx1462_debug, debug_580
+    rx1462_cur."!cursor_debug"("START", "postcircumfix:sym<[ ]>")
+  debug_580:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1464_done
+    goto rxscan1464_scan
+  rxscan1464_loop:
+    ($P10) = rx1462_cur."from"()
+    inc $P10
+    set rx1462_pos, $P10
+    ge rx1462_pos, rx1462_eos, rxscan1464_done
+  rxscan1464_scan:
+    set_addr $I10, rxscan1464_loop
+    rx1462_cur."!mark_push"(0, rx1462_pos, $I10)
+  rxscan1464_done:
+.annotate 'line', 308
+  # rx literal  "["
+    add $I11, rx1462_pos, 1
+    gt $I11, rx1462_eos, rx1462_fail
+    sub $I11, rx1462_pos, rx1462_off
+    ord $I11, rx1462_tgt, $I11
+    ne $I11, 91, rx1462_fail
+    add rx1462_pos, 1
+  # rx subrule "ws" subtype=method negate=
+    rx1462_cur."!cursor_pos"(rx1462_pos)
+    $P10 = rx1462_cur."ws"()
+    unless $P10, rx1462_fail
+    rx1462_pos = $P10."pos"()
+  # rx subrule "EXPR" subtype=capture negate=
+    rx1462_cur."!cursor_pos"(rx1462_pos)
+    $P10 = rx1462_cur."EXPR"()
+    unless $P10, rx1462_fail
+    rx1462_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("EXPR")
+    rx1462_pos = $P10."pos"()
+  # rx literal  "]"
+    add $I11, rx1462_pos, 1
+    gt $I11, rx1462_eos, rx1462_fail
+    sub $I11, rx1462_pos, rx1462_off
+    ord $I11, rx1462_tgt, $I11
+    ne $I11, 93, rx1462_fail
+    add rx1462_pos, 1
+.annotate 'line', 309
+  # rx subrule "O" subtype=capture negate=
+    rx1462_cur."!cursor_pos"(rx1462_pos)
+    $P10 = rx1462_cur."O"("%methodop")
+    unless $P10, rx1462_fail
+    rx1462_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1462_pos = $P10."pos"()
+.annotate 'line', 307
+  # rx pass
+    rx1462_cur."!cursor_pass"(rx1462_pos, "postcircumfix:sym<[ ]>")
+    if_null rx1462_debug, debug_581
+    rx1462_cur."!cursor_debug"("PASS", "postcircumfix:sym<[ ]>", " at pos=", rx1462_pos)
+  debug_581:
+    .return (rx1462_cur)
+  rx1462_restart:
+.annotate 'line', 8
+    if_null rx1462_debug, debug_582
+    rx1462_cur."!cursor_debug"("NEXT", "postcircumfix:sym<[ ]>")
+  debug_582:
+  rx1462_fail:
+    (rx1462_rep, rx1462_pos, $I10, $P10) = rx1462_cur."!mark_fail"(0)
+    lt rx1462_pos, -1, rx1462_done
+    eq rx1462_pos, -1, rx1462_fail
+    jump $I10
+  rx1462_done:
+    rx1462_cur."!cursor_fail"()
+    if_null rx1462_debug, debug_583
+    rx1462_cur."!cursor_debug"("FAIL", "postcircumfix:sym<[ ]>")
+  debug_583:
+    .return (rx1462_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__postcircumfix:sym<[ ]>"  :subid("185_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("ws", "[")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "infix:sym<->>"  :subid("186_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1466_tgt
+    .local int rx1466_pos
+    .local int rx1466_off
+    .local int rx1466_eos
+    .local int rx1466_rep
+    .local pmc rx1466_cur
+    .local pmc rx1466_debug
+    (rx1466_cur, rx1466_pos, rx1466_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1466_debug, rx1466_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1466_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1466_eos, rx1466_tgt
+    gt rx1466_pos, rx1466_eos, rx1466_done
+    set rx1466_off, 0
+    lt rx1466_pos, 2, rx1466_start
+    sub rx1466_off, rx1466_pos, 1
+    substr rx1466_tgt, rx1466_tgt, rx1466_off
+  rx1466_start:
+    eq $I10, 1, rx1466_restart
+    if_null rx1466_debug, debug_584
+    rx1466_cur."!cursor_debug"("START", "infix:sym<->>")
+  debug_584:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1468_done
+    goto rxscan1468_scan
+  rxscan1468_loop:
+    ($P10) = rx1466_cur."from"()
+    inc $P10
+    set rx1466_pos, $P10
+    ge rx1466_pos, rx1466_eos, rxscan1468_done
+  rxscan1468_scan:
+    set_addr $I10, rxscan1468_loop
+    rx1466_cur."!mark_push"(0, rx1466_pos, $I10)
+  rxscan1468_done:
+.annotate 'line', 314
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1469_fail
+    rx1466_cur."!mark_push"(0, rx1466_pos, $I10)
+  # rx literal  "->"
+    add $I11, rx1466_pos, 2
+    gt $I11, rx1466_eos, rx1466_fail
+    sub $I11, rx1466_pos, rx1466_off
+    substr $S10, rx1466_tgt, $I11, 2
+    ne $S10, "->", rx1466_fail
+    add rx1466_pos, 2
+    set_addr $I10, rxcap_1469_fail
+    ($I12, $I11) = rx1466_cur."!mark_peek"($I10)
+    rx1466_cur."!cursor_pos"($I11)
+    ($P10) = rx1466_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1466_pos, "")
+    rx1466_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1469_done
+  rxcap_1469_fail:
+    goto rx1466_fail
+  rxcap_1469_done:
+  # rx subrule "O" subtype=capture negate=
+    rx1466_cur."!cursor_pos"(rx1466_pos)
+    $P10 = rx1466_cur."O"("%dotty :pirop<arrow>")
+    unless $P10, rx1466_fail
+    rx1466_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1466_pos = $P10."pos"()
+  # rx pass
+    rx1466_cur."!cursor_pass"(rx1466_pos, "infix:sym<->>")
+    if_null rx1466_debug, debug_585
+    rx1466_cur."!cursor_debug"("PASS", "infix:sym<->>", " at pos=", rx1466_pos)
+  debug_585:
+    .return (rx1466_cur)
+  rx1466_restart:
+.annotate 'line', 8
+    if_null rx1466_debug, debug_586
+    rx1466_cur."!cursor_debug"("NEXT", "infix:sym<->>")
+  debug_586:
+  rx1466_fail:
+    (rx1466_rep, rx1466_pos, $I10, $P10) = rx1466_cur."!mark_fail"(0)
+    lt rx1466_pos, -1, rx1466_done
+    eq rx1466_pos, -1, rx1466_fail
+    jump $I10
+  rx1466_done:
+    rx1466_cur."!cursor_fail"()
+    if_null rx1466_debug, debug_587
+    rx1466_cur."!cursor_debug"("FAIL", "infix:sym<->>")
+  debug_587:
+    .return (rx1466_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__infix:sym<->>"  :subid("187_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("O", "->")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "infix:sym<.>"  :subid("188_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1471_tgt
+    .local int rx1471_pos
+    .local int rx1471_off
+    .local int rx1471_eos
+    .local int rx1471_rep
+    .local pmc rx1471_cur
+    .local pmc rx1471_debug
+    (rx1471_cur, rx1471_pos, rx1471_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1471_debug, rx1471_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1471_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1471_eos, rx1471_tgt
+    gt rx1471_pos, rx1471_eos, rx1471_done
+    set rx1471_off, 0
+    lt rx1471_pos, 2, rx1471_start
+    sub rx1471_off, rx1471_pos, 1
+    substr rx1471_tgt, rx1471_tgt, rx1471_off
+  rx1471_start:
+    eq $I10, 1, rx1471_restart
+    if_null rx1471_debug, debug_588
+    rx1471_cur."!cursor_debug"("START", "infix:sym<.>")
+  debug_588:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1473_done
+    goto rxscan1473_scan
+  rxscan1473_loop:
+    ($P10) = rx1471_cur."from"()
+    inc $P10
+    set rx1471_pos, $P10
+    ge rx1471_pos, rx1471_eos, rxscan1473_done
+  rxscan1473_scan:
+    set_addr $I10, rxscan1473_loop
+    rx1471_cur."!mark_push"(0, rx1471_pos, $I10)
+  rxscan1473_done:
+.annotate 'line', 315
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1474_fail
+    rx1471_cur."!mark_push"(0, rx1471_pos, $I10)
+  # rx literal  "."
+    add $I11, rx1471_pos, 1
+    gt $I11, rx1471_eos, rx1471_fail
+    sub $I11, rx1471_pos, rx1471_off
+    ord $I11, rx1471_tgt, $I11
+    ne $I11, 46, rx1471_fail
+    add rx1471_pos, 1
+    set_addr $I10, rxcap_1474_fail
+    ($I12, $I11) = rx1471_cur."!mark_peek"($I10)
+    rx1471_cur."!cursor_pos"($I11)
+    ($P10) = rx1471_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1471_pos, "")
+    rx1471_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1474_done
+  rxcap_1474_fail:
+    goto rx1471_fail
+  rxcap_1474_done:
+  # rx subrule "O" subtype=capture negate=
+    rx1471_cur."!cursor_pos"(rx1471_pos)
+    $P10 = rx1471_cur."O"("%dotty :pirop<dotty>")
+    unless $P10, rx1471_fail
+    rx1471_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1471_pos = $P10."pos"()
+  # rx pass
+    rx1471_cur."!cursor_pass"(rx1471_pos, "infix:sym<.>")
+    if_null rx1471_debug, debug_589
+    rx1471_cur."!cursor_debug"("PASS", "infix:sym<.>", " at pos=", rx1471_pos)
+  debug_589:
+    .return (rx1471_cur)
+  rx1471_restart:
+.annotate 'line', 8
+    if_null rx1471_debug, debug_590
+    rx1471_cur."!cursor_debug"("NEXT", "infix:sym<.>")
+  debug_590:
+  rx1471_fail:
+    (rx1471_rep, rx1471_pos, $I10, $P10) = rx1471_cur."!mark_fail"(0)
+    lt rx1471_pos, -1, rx1471_done
+    eq rx1471_pos, -1, rx1471_fail
+    jump $I10
+  rx1471_done:
+    rx1471_cur."!cursor_fail"()
+    if_null rx1471_debug, debug_591
+    rx1471_cur."!cursor_debug"("FAIL", "infix:sym<.>")
+  debug_591:
+    .return (rx1471_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__infix:sym<.>"  :subid("189_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("O", ".")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "postfix:sym<-->"  :subid("190_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1476_tgt
+    .local int rx1476_pos
+    .local int rx1476_off
+    .local int rx1476_eos
+    .local int rx1476_rep
+    .local pmc rx1476_cur
+    .local pmc rx1476_debug
+    (rx1476_cur, rx1476_pos, rx1476_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1476_debug, rx1476_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1476_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1476_eos, rx1476_tgt
+    gt rx1476_pos, rx1476_eos, rx1476_done
+    set rx1476_off, 0
+    lt rx1476_pos, 2, rx1476_start
+    sub rx1476_off, rx1476_pos, 1
+    substr rx1476_tgt, rx1476_tgt, rx1476_off
+  rx1476_start:
+    eq $I10, 1, rx1476_restart
+    if_null rx1476_debug, debug_592
+    rx1476_cur."!cursor_debug"("START", "postfix:sym<-->")
+  debug_592:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1478_done
+    goto rxscan1478_scan
+  rxscan1478_loop:
+    ($P10) = rx1476_cur."from"()
+    inc $P10
+    set rx1476_pos, $P10
+    ge rx1476_pos, rx1476_eos, rxscan1478_done
+  rxscan1478_scan:
+    set_addr $I10, rxscan1478_loop
+    rx1476_cur."!mark_push"(0, rx1476_pos, $I10)
+  rxscan1478_done:
+.annotate 'line', 318
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1479_fail
+    rx1476_cur."!mark_push"(0, rx1476_pos, $I10)
+  # rx literal  "--"
+    add $I11, rx1476_pos, 2
+    gt $I11, rx1476_eos, rx1476_fail
+    sub $I11, rx1476_pos, rx1476_off
+    substr $S10, rx1476_tgt, $I11, 2
+    ne $S10, "--", rx1476_fail
+    add rx1476_pos, 2
+    set_addr $I10, rxcap_1479_fail
+    ($I12, $I11) = rx1476_cur."!mark_peek"($I10)
+    rx1476_cur."!cursor_pos"($I11)
+    ($P10) = rx1476_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1476_pos, "")
+    rx1476_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1479_done
+  rxcap_1479_fail:
+    goto rx1476_fail
+  rxcap_1479_done:
+  # rx subrule "O" subtype=capture negate=
+    rx1476_cur."!cursor_pos"(rx1476_pos)
+    $P10 = rx1476_cur."O"("%autoincrement :pirop<-->")
+    unless $P10, rx1476_fail
+    rx1476_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1476_pos = $P10."pos"()
+  # rx pass
+    rx1476_cur."!cursor_pass"(rx1476_pos, "postfix:sym<-->")
+    if_null rx1476_debug, debug_593
+    rx1476_cur."!cursor_debug"("PASS", "postfix:sym<-->", " at pos=", rx1476_pos)
+  debug_593:
+    .return (rx1476_cur)
+  rx1476_restart:
+.annotate 'line', 8
+    if_null rx1476_debug, debug_594
+    rx1476_cur."!cursor_debug"("NEXT", "postfix:sym<-->")
+  debug_594:
+  rx1476_fail:
+    (rx1476_rep, rx1476_pos, $I10, $P10) = rx1476_cur."!mark_fail"(0)
+    lt rx1476_pos, -1, rx1476_done
+    eq rx1476_pos, -1, rx1476_fail
+    jump $I10
+  rx1476_done:
+    rx1476_cur."!cursor_fail"()
+    if_null rx1476_debug, debug_595
+    rx1476_cur."!cursor_debug"("FAIL", "postfix:sym<-->")
+  debug_595:
+    .return (rx1476_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__postfix:sym<-->"  :subid("191_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("O", "--")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "postfix:sym<++>"  :subid("192_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1481_tgt
+    .local int rx1481_pos
+    .local int rx1481_off
+    .local int rx1481_eos
+    .local int rx1481_rep
+    .local pmc rx1481_cur
+    .local pmc rx1481_debug
+    (rx1481_cur, rx1481_pos, rx1481_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1481_debug, rx1481_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1481_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1481_eos, rx1481_tgt
+    gt rx1481_pos, rx1481_eos, rx1481_done
+    set rx1481_off, 0
+    lt rx1481_pos, 2, rx1481_start
+    sub rx1481_off, rx1481_pos, 1
+    substr rx1481_tgt, rx1481_tgt, rx1481_off
+  rx1481_start:
+    eq $I10, 1, rx1481_restart
+    if_null rx1481_debug, debug_596
+    rx1481_cur."!cursor_debug"("START", "postfix:sym<++>")
+  debug_596:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1483_done
+    goto rxscan1483_scan
+  rxscan1483_loop:
+    ($P10) = rx1481_cur."from"()
+    inc $P10
+    set rx1481_pos, $P10
+    ge rx1481_pos, rx1481_eos, rxscan1483_done
+  rxscan1483_scan:
+    set_addr $I10, rxscan1483_loop
+    rx1481_cur."!mark_push"(0, rx1481_pos, $I10)
+  rxscan1483_done:
+.annotate 'line', 319
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1484_fail
+    rx1481_cur."!mark_push"(0, rx1481_pos, $I10)
+  # rx literal  "++"
+    add $I11, rx1481_pos, 2
+    gt $I11, rx1481_eos, rx1481_fail
+    sub $I11, rx1481_pos, rx1481_off
+    substr $S10, rx1481_tgt, $I11, 2
+    ne $S10, "++", rx1481_fail
+    add rx1481_pos, 2
+    set_addr $I10, rxcap_1484_fail
+    ($I12, $I11) = rx1481_cur."!mark_peek"($I10)
+    rx1481_cur."!cursor_pos"($I11)
+    ($P10) = rx1481_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1481_pos, "")
+    rx1481_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1484_done
+  rxcap_1484_fail:
+    goto rx1481_fail
+  rxcap_1484_done:
+  # rx subrule "O" subtype=capture negate=
+    rx1481_cur."!cursor_pos"(rx1481_pos)
+    $P10 = rx1481_cur."O"("%autoincrement :pirop<++>")
+    unless $P10, rx1481_fail
+    rx1481_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1481_pos = $P10."pos"()
+  # rx pass
+    rx1481_cur."!cursor_pass"(rx1481_pos, "postfix:sym<++>")
+    if_null rx1481_debug, debug_597
+    rx1481_cur."!cursor_debug"("PASS", "postfix:sym<++>", " at pos=", rx1481_pos)
+  debug_597:
+    .return (rx1481_cur)
+  rx1481_restart:
+.annotate 'line', 8
+    if_null rx1481_debug, debug_598
+    rx1481_cur."!cursor_debug"("NEXT", "postfix:sym<++>")
+  debug_598:
+  rx1481_fail:
+    (rx1481_rep, rx1481_pos, $I10, $P10) = rx1481_cur."!mark_fail"(0)
+    lt rx1481_pos, -1, rx1481_done
+    eq rx1481_pos, -1, rx1481_fail
+    jump $I10
+  rx1481_done:
+    rx1481_cur."!cursor_fail"()
+    if_null rx1481_debug, debug_599
+    rx1481_cur."!cursor_debug"("FAIL", "postfix:sym<++>")
+  debug_599:
+    .return (rx1481_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__postfix:sym<++>"  :subid("193_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("O", "++")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "arglist"  :subid("194_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1486_tgt
+    .local int rx1486_pos
+    .local int rx1486_off
+    .local int rx1486_eos
+    .local int rx1486_rep
+    .local pmc rx1486_cur
+    .local pmc rx1486_debug
+    (rx1486_cur, rx1486_pos, rx1486_tgt, $I10) = self."!cursor_start"()
+    rx1486_cur."!cursor_caparray"("arg")
+    getattribute rx1486_debug, rx1486_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1486_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1486_eos, rx1486_tgt
+    gt rx1486_pos, rx1486_eos, rx1486_done
+    set rx1486_off, 0
+    lt rx1486_pos, 2, rx1486_start
+    sub rx1486_off, rx1486_pos, 1
+    substr rx1486_tgt, rx1486_tgt, rx1486_off
+  rx1486_start:
+    eq $I10, 1, rx1486_restart
+    if_null rx1486_debug, debug_600
+    rx1486_cur."!cursor_debug"("START", "arglist")
+  debug_600:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1488_done
+    goto rxscan1488_scan
+  rxscan1488_loop:
+    ($P10) = rx1486_cur."from"()
+    inc $P10
+    set rx1486_pos, $P10
+    ge rx1486_pos, rx1486_eos, rxscan1488_done
+  rxscan1488_scan:
+    set_addr $I10, rxscan1488_loop
+    rx1486_cur."!mark_push"(0, rx1486_pos, $I10)
+  rxscan1488_done:
+  alt1489_0:
+.annotate 'line', 321
+    set_addr $I10, alt1489_1
+    rx1486_cur."!mark_push"(0, rx1486_pos, $I10)
+.annotate 'line', 322
+  # rx subrule "ws" subtype=method negate=
+    rx1486_cur."!cursor_pos"(rx1486_pos)
+    $P10 = rx1486_cur."ws"()
+    unless $P10, rx1486_fail
+    rx1486_pos = $P10."pos"()
+  # rx rxquantr1490 ** 1..*
+    set_addr $I10, rxquantr1490_done
+    rx1486_cur."!mark_push"(0, -1, $I10)
+  rxquantr1490_loop:
+  # rx subrule "arg" subtype=capture negate=
+    rx1486_cur."!cursor_pos"(rx1486_pos)
+    $P10 = rx1486_cur."arg"()
+    unless $P10, rx1486_fail
+    goto rxsubrule1491_pass
+  rxsubrule1491_back:
+    $P10 = $P10."!cursor_next"()
+    unless $P10, rx1486_fail
+  rxsubrule1491_pass:
+    set_addr $I10, rxsubrule1491_back
+    rx1486_cur."!mark_push"(0, rx1486_pos, $I10, $P10)
+    $P10."!cursor_names"("arg")
+    rx1486_pos = $P10."pos"()
+    set_addr $I10, rxquantr1490_done
+    (rx1486_rep) = rx1486_cur."!mark_commit"($I10)
+    set_addr $I10, rxquantr1490_done
+    rx1486_cur."!mark_push"(rx1486_rep, rx1486_pos, $I10)
+  # rx subrule "ws" subtype=method negate=
+    rx1486_cur."!cursor_pos"(rx1486_pos)
+    $P10 = rx1486_cur."ws"()
+    unless $P10, rx1486_fail
+    goto rxsubrule1492_pass
+  rxsubrule1492_back:
+    $P10 = $P10."!cursor_next"()
+    unless $P10, rx1486_fail
+  rxsubrule1492_pass:
+    set_addr $I10, rxsubrule1492_back
+    rx1486_cur."!mark_push"(0, rx1486_pos, $I10, $P10)
+    rx1486_pos = $P10."pos"()
+  # rx literal  ","
+    add $I11, rx1486_pos, 1
+    gt $I11, rx1486_eos, rx1486_fail
+    sub $I11, rx1486_pos, rx1486_off
+    ord $I11, rx1486_tgt, $I11
+    ne $I11, 44, rx1486_fail
+    add rx1486_pos, 1
+  # rx subrule "ws" subtype=method negate=
+    rx1486_cur."!cursor_pos"(rx1486_pos)
+    $P10 = rx1486_cur."ws"()
+    unless $P10, rx1486_fail
+    goto rxsubrule1493_pass
+  rxsubrule1493_back:
+    $P10 = $P10."!cursor_next"()
+    unless $P10, rx1486_fail
+  rxsubrule1493_pass:
+    set_addr $I10, rxsubrule1493_back
+    rx1486_cur."!mark_push"(0, rx1486_pos, $I10, $P10)
+    rx1486_pos = $P10."pos"()
+    goto rxquantr1490_loop
+  rxquantr1490_done:
+  # rx subrule "ws" subtype=method negate=
+    rx1486_cur."!cursor_pos"(rx1486_pos)
+    $P10 = rx1486_cur."ws"()
+    unless $P10, rx1486_fail
+    rx1486_pos = $P10."pos"()
+    goto alt1489_end
+  alt1489_1:
+.annotate 'line', 323
+  # rx subrule "ws" subtype=method negate=
+    rx1486_cur."!cursor_pos"(rx1486_pos)
+    $P10 = rx1486_cur."ws"()
+    unless $P10, rx1486_fail
+    rx1486_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1486_cur."!cursor_pos"(rx1486_pos)
+    $P10 = rx1486_cur."ws"()
+    unless $P10, rx1486_fail
+    rx1486_pos = $P10."pos"()
+  alt1489_end:
+.annotate 'line', 321
+  # rx pass
+    rx1486_cur."!cursor_pass"(rx1486_pos, "arglist")
+    if_null rx1486_debug, debug_601
+    rx1486_cur."!cursor_debug"("PASS", "arglist", " at pos=", rx1486_pos)
+  debug_601:
+    .return (rx1486_cur)
+  rx1486_restart:
+.annotate 'line', 8
+    if_null rx1486_debug, debug_602
+    rx1486_cur."!cursor_debug"("NEXT", "arglist")
+  debug_602:
+  rx1486_fail:
+    (rx1486_rep, rx1486_pos, $I10, $P10) = rx1486_cur."!mark_fail"(0)
+    lt rx1486_pos, -1, rx1486_done
+    eq rx1486_pos, -1, rx1486_fail
+    jump $I10
+  rx1486_done:
+    rx1486_cur."!cursor_fail"()
+    if_null rx1486_debug, debug_603
+    rx1486_cur."!cursor_debug"("FAIL", "arglist")
+  debug_603:
+    .return (rx1486_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__arglist"  :subid("195_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("ws", "")
+    $P101 = self."!PREFIX__!subrule"("ws", "")
+    new $P102, "ResizablePMCArray"
+    push $P102, $P100
+    push $P102, $P101
+    .return ($P102)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "arg"  :subid("196_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1495_tgt
+    .local int rx1495_pos
+    .local int rx1495_off
+    .local int rx1495_eos
+    .local int rx1495_rep
+    .local pmc rx1495_cur
+    .local pmc rx1495_debug
+    (rx1495_cur, rx1495_pos, rx1495_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1495_debug, rx1495_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1495_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1495_eos, rx1495_tgt
+    gt rx1495_pos, rx1495_eos, rx1495_done
+    set rx1495_off, 0
+    lt rx1495_pos, 2, rx1495_start
+    sub rx1495_off, rx1495_pos, 1
+    substr rx1495_tgt, rx1495_tgt, rx1495_off
+  rx1495_start:
+    eq $I10, 1, rx1495_restart
+    if_null rx1495_debug, debug_604
+    rx1495_cur."!cursor_debug"("START", "arg")
+  debug_604:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1497_done
+    goto rxscan1497_scan
+  rxscan1497_loop:
+    ($P10) = rx1495_cur."from"()
+    inc $P10
+    set rx1495_pos, $P10
+    ge rx1495_pos, rx1495_eos, rxscan1497_done
+  rxscan1497_scan:
+    set_addr $I10, rxscan1497_loop
+    rx1495_cur."!mark_push"(0, rx1495_pos, $I10)
+  rxscan1497_done:
+  alt1498_0:
+.annotate 'line', 326
+    set_addr $I10, alt1498_1
+    rx1495_cur."!mark_push"(0, rx1495_pos, $I10)
+.annotate 'line', 327
+  # rx subrule "EXPR" subtype=capture negate=
+    rx1495_cur."!cursor_pos"(rx1495_pos)
+    $P10 = rx1495_cur."EXPR"("i=")
+    unless $P10, rx1495_fail
+    rx1495_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("EXPR")
+    rx1495_pos = $P10."pos"()
+    goto alt1498_end
+  alt1498_1:
+.annotate 'line', 328
+  # rx subrule "type_declarator" subtype=capture negate=
+    rx1495_cur."!cursor_pos"(rx1495_pos)
+    $P10 = rx1495_cur."type_declarator"()
+    unless $P10, rx1495_fail
+    rx1495_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("type_declarator")
+    rx1495_pos = $P10."pos"()
+  alt1498_end:
+.annotate 'line', 326
+  # rx pass
+    rx1495_cur."!cursor_pass"(rx1495_pos, "arg")
+    if_null rx1495_debug, debug_605
+    rx1495_cur."!cursor_debug"("PASS", "arg", " at pos=", rx1495_pos)
+  debug_605:
+    .return (rx1495_cur)
+  rx1495_restart:
+.annotate 'line', 8
+    if_null rx1495_debug, debug_606
+    rx1495_cur."!cursor_debug"("NEXT", "arg")
+  debug_606:
+  rx1495_fail:
+    (rx1495_rep, rx1495_pos, $I10, $P10) = rx1495_cur."!mark_fail"(0)
+    lt rx1495_pos, -1, rx1495_done
+    eq rx1495_pos, -1, rx1495_fail
+    jump $I10
+  rx1495_done:
+    rx1495_cur."!cursor_fail"()
+    if_null rx1495_debug, debug_607
+    rx1495_cur."!cursor_debug"("FAIL", "arg")
+  debug_607:
+    .return (rx1495_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__arg"  :subid("197_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("type_declarator", "")
+    $P101 = self."!PREFIX__!subrule"("EXPR", "")
+    new $P102, "ResizablePMCArray"
+    push $P102, $P100
+    push $P102, $P101
+    .return ($P102)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "prefix:sym<( )>"  :subid("198_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1500_tgt
+    .local int rx1500_pos
+    .local int rx1500_off
+    .local int rx1500_eos
+    .local int rx1500_rep
+    .local pmc rx1500_cur
+    .local pmc rx1500_debug
+    (rx1500_cur, rx1500_pos, rx1500_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1500_debug, rx1500_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1500_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1500_eos, rx1500_tgt
+    gt rx1500_pos, rx1500_eos, rx1500_done
+    set rx1500_off, 0
+    lt rx1500_pos, 2, rx1500_start
+    sub rx1500_off, rx1500_pos, 1
+    substr rx1500_tgt, rx1500_tgt, rx1500_off
+  rx1500_start:
+    eq $I10, 1, rx1500_restart
+    if_null rx1500_debug, debug_608
+    rx1500_cur."!cursor_debug"("START", "prefix:sym<( )>")
+  debug_608:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1502_done
+    goto rxscan1502_scan
+  rxscan1502_loop:
+    ($P10) = rx1500_cur."from"()
+    inc $P10
+    set rx1500_pos, $P10
+    ge rx1500_pos, rx1500_eos, rxscan1502_done
+  rxscan1502_scan:
+    set_addr $I10, rxscan1502_loop
+    rx1500_cur."!mark_push"(0, rx1500_pos, $I10)
+  rxscan1502_done:
+.annotate 'line', 333
+  # rx literal  "("
+    add $I11, rx1500_pos, 1
+    gt $I11, rx1500_eos, rx1500_fail
+    sub $I11, rx1500_pos, rx1500_off
+    ord $I11, rx1500_tgt, $I11
+    ne $I11, 40, rx1500_fail
+    add rx1500_pos, 1
+  # rx subrule "type_declarator" subtype=capture negate=
+    rx1500_cur."!cursor_pos"(rx1500_pos)
+    $P10 = rx1500_cur."type_declarator"()
+    unless $P10, rx1500_fail
+    rx1500_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("type_declarator")
+    rx1500_pos = $P10."pos"()
+  # rx literal  ")"
+    add $I11, rx1500_pos, 1
+    gt $I11, rx1500_eos, rx1500_fail
+    sub $I11, rx1500_pos, rx1500_off
+    ord $I11, rx1500_tgt, $I11
+    ne $I11, 41, rx1500_fail
+    add rx1500_pos, 1
+.annotate 'line', 334
+  # rx subrule "O" subtype=capture negate=
+    rx1500_cur."!cursor_pos"(rx1500_pos)
+    $P10 = rx1500_cur."O"("%casting")
+    unless $P10, rx1500_fail
+    rx1500_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1500_pos = $P10."pos"()
+.annotate 'line', 332
+  # rx pass
+    rx1500_cur."!cursor_pass"(rx1500_pos, "prefix:sym<( )>")
+    if_null rx1500_debug, debug_609
+    rx1500_cur."!cursor_debug"("PASS", "prefix:sym<( )>", " at pos=", rx1500_pos)
+  debug_609:
+    .return (rx1500_cur)
+  rx1500_restart:
+.annotate 'line', 8
+    if_null rx1500_debug, debug_610
+    rx1500_cur."!cursor_debug"("NEXT", "prefix:sym<( )>")
+  debug_610:
+  rx1500_fail:
+    (rx1500_rep, rx1500_pos, $I10, $P10) = rx1500_cur."!mark_fail"(0)
+    lt rx1500_pos, -1, rx1500_done
+    eq rx1500_pos, -1, rx1500_fail
+    jump $I10
+  rx1500_done:
+    rx1500_cur."!cursor_fail"()
+    if_null rx1500_debug, debug_611
+    rx1500_cur."!cursor_debug"("FAIL", "prefix:sym<( )>")
+  debug_611:
+    .return (rx1500_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__prefix:sym<( )>"  :subid("199_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("type_declarator", "(")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "circumfix:sym<( )>"  :subid("200_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1504_tgt
+    .local int rx1504_pos
+    .local int rx1504_off
+    .local int rx1504_eos
+    .local int rx1504_rep
+    .local pmc rx1504_cur
+    .local pmc rx1504_debug
+    (rx1504_cur, rx1504_pos, rx1504_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1504_debug, rx1504_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1504_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1504_eos, rx1504_tgt
+    gt rx1504_pos, rx1504_eos, rx1504_done
+    set rx1504_off, 0
+    lt rx1504_pos, 2, rx1504_start
+    sub rx1504_off, rx1504_pos, 1
+    substr rx1504_tgt, rx1504_tgt, rx1504_off
+  rx1504_start:
+    eq $I10, 1, rx1504_restart
+    if_null rx1504_debug, debug_612
+    rx1504_cur."!cursor_debug"("START", "circumfix:sym<( )>")
+  debug_612:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1506_done
+    goto rxscan1506_scan
+  rxscan1506_loop:
+    ($P10) = rx1504_cur."from"()
+    inc $P10
+    set rx1504_pos, $P10
+    ge rx1504_pos, rx1504_eos, rxscan1506_done
+  rxscan1506_scan:
+    set_addr $I10, rxscan1506_loop
+    rx1504_cur."!mark_push"(0, rx1504_pos, $I10)
+  rxscan1506_done:
+.annotate 'line', 338
+  # rx literal  "("
+    add $I11, rx1504_pos, 1
+    gt $I11, rx1504_eos, rx1504_fail
+    sub $I11, rx1504_pos, rx1504_off
+    ord $I11, rx1504_tgt, $I11
+    ne $I11, 40, rx1504_fail
+    add rx1504_pos, 1
+  # rx subrule "ws" subtype=method negate=
+    rx1504_cur."!cursor_pos"(rx1504_pos)
+    $P10 = rx1504_cur."ws"()
+    unless $P10, rx1504_fail
+    rx1504_pos = $P10."pos"()
+  # rx subrule "EXPR" subtype=capture negate=
+    rx1504_cur."!cursor_pos"(rx1504_pos)
+    $P10 = rx1504_cur."EXPR"()
+    unless $P10, rx1504_fail
+    rx1504_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("EXPR")
+    rx1504_pos = $P10."pos"()
+  # rx literal  ")"
+    add $I11, rx1504_pos, 1
+    gt $I11, rx1504_eos, rx1504_fail
+    sub $I11, rx1504_pos, rx1504_off
+    ord $I11, rx1504_tgt, $I11
+    ne $I11, 41, rx1504_fail
+    add rx1504_pos, 1
+.annotate 'line', 339
+  # rx subrule "O" subtype=capture negate=
+    rx1504_cur."!cursor_pos"(rx1504_pos)
+    $P10 = rx1504_cur."O"("%methodop")
+    unless $P10, rx1504_fail
+    rx1504_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1504_pos = $P10."pos"()
+.annotate 'line', 337
+  # rx pass
+    rx1504_cur."!cursor_pass"(rx1504_pos, "circumfix:sym<( )>")
+    if_null rx1504_debug, debug_613
+    rx1504_cur."!cursor_debug"("PASS", "circumfix:sym<( )>", " at pos=", rx1504_pos)
+  debug_613:
+    .return (rx1504_cur)
+  rx1504_restart:
+.annotate 'line', 8
+    if_null rx1504_debug, debug_614
+    rx1504_cur."!cursor_debug"("NEXT", "circumfix:sym<( )>")
+  debug_614:
+  rx1504_fail:
+    (rx1504_rep, rx1504_pos, $I10, $P10) = rx1504_cur."!mark_fail"(0)
+    lt rx1504_pos, -1, rx1504_done
+    eq rx1504_pos, -1, rx1504_fail
+    jump $I10
+  rx1504_done:
+    rx1504_cur."!cursor_fail"()
+    if_null rx1504_debug, debug_615
+    rx1504_cur."!cursor_debug"("FAIL", "circumfix:sym<( )>")
+  debug_615:
+    .return (rx1504_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__circumfix:sym<( )>"  :subid("201_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("ws", "(")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "prefix:sym<+>"  :subid("202_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1508_tgt
+    .local int rx1508_pos
+    .local int rx1508_off
+    .local int rx1508_eos
+    .local int rx1508_rep
+    .local pmc rx1508_cur
+    .local pmc rx1508_debug
+    (rx1508_cur, rx1508_pos, rx1508_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1508_debug, rx1508_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1508_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1508_eos, rx1508_tgt
+    gt rx1508_pos, rx1508_eos, rx1508_done
+    set rx1508_off, 0
+    lt rx1508_pos, 2, rx1508_start
+    sub rx1508_off, rx1508_pos, 1
+    substr rx1508_tgt, rx1508_tgt, rx1508_off
+  rx1508_start:
+    eq $I10, 1, rx1508_restart
+    if_null rx1508_debug, debug_616
+    rx1508_cur."!cursor_debug"("START", "prefix:sym<+>")
+  debug_616:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1510_done
+    goto rxscan1510_scan
+  rxscan1510_loop:
+    ($P10) = rx1508_cur."from"()
+    inc $P10
+    set rx1508_pos, $P10
+    ge rx1508_pos, rx1508_eos, rxscan1510_done
+  rxscan1510_scan:
+    set_addr $I10, rxscan1510_loop
+    rx1508_cur."!mark_push"(0, rx1508_pos, $I10)
+  rxscan1510_done:
+.annotate 'line', 342
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1511_fail
+    rx1508_cur."!mark_push"(0, rx1508_pos, $I10)
+  # rx literal  "+"
+    add $I11, rx1508_pos, 1
+    gt $I11, rx1508_eos, rx1508_fail
+    sub $I11, rx1508_pos, rx1508_off
+    ord $I11, rx1508_tgt, $I11
+    ne $I11, 43, rx1508_fail
+    add rx1508_pos, 1
+    set_addr $I10, rxcap_1511_fail
+    ($I12, $I11) = rx1508_cur."!mark_peek"($I10)
+    rx1508_cur."!cursor_pos"($I11)
+    ($P10) = rx1508_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1508_pos, "")
+    rx1508_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1511_done
+  rxcap_1511_fail:
+    goto rx1508_fail
+  rxcap_1511_done:
+  # rx enumcharlist negate=1 zerowidth
+    sub $I10, rx1508_pos, rx1508_off
+    substr $S10, rx1508_tgt, $I10, 1
+    index $I11, "+", $S10
+    ge $I11, 0, rx1508_fail
+  # rx subrule "O" subtype=capture negate=
+    rx1508_cur."!cursor_pos"(rx1508_pos)
+    $P10 = rx1508_cur."O"("%symbolic_unary :pirop<+>")
+    unless $P10, rx1508_fail
+    rx1508_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1508_pos = $P10."pos"()
+  # rx pass
+    rx1508_cur."!cursor_pass"(rx1508_pos, "prefix:sym<+>")
+    if_null rx1508_debug, debug_617
+    rx1508_cur."!cursor_debug"("PASS", "prefix:sym<+>", " at pos=", rx1508_pos)
+  debug_617:
+    .return (rx1508_cur)
+  rx1508_restart:
+.annotate 'line', 8
+    if_null rx1508_debug, debug_618
+    rx1508_cur."!cursor_debug"("NEXT", "prefix:sym<+>")
+  debug_618:
+  rx1508_fail:
+    (rx1508_rep, rx1508_pos, $I10, $P10) = rx1508_cur."!mark_fail"(0)
+    lt rx1508_pos, -1, rx1508_done
+    eq rx1508_pos, -1, rx1508_fail
+    jump $I10
+  rx1508_done:
+    rx1508_cur."!cursor_fail"()
+    if_null rx1508_debug, debug_619
+    rx1508_cur."!cursor_debug"("FAIL", "prefix:sym<+>")
+  debug_619:
+    .return (rx1508_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__prefix:sym<+>"  :subid("203_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("O", "+")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "prefix:sym<->"  :subid("204_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1513_tgt
+    .local int rx1513_pos
+    .local int rx1513_off
+    .local int rx1513_eos
+    .local int rx1513_rep
+    .local pmc rx1513_cur
+    .local pmc rx1513_debug
+    (rx1513_cur, rx1513_pos, rx1513_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1513_debug, rx1513_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1513_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1513_eos, rx1513_tgt
+    gt rx1513_pos, rx1513_eos, rx1513_done
+    set rx1513_off, 0
+    lt rx1513_pos, 2, rx1513_start
+    sub rx1513_off, rx1513_pos, 1
+    substr rx1513_tgt, rx1513_tgt, rx1513_off
+  rx1513_start:
+    eq $I10, 1, rx1513_restart
+    if_null rx1513_debug, debug_620
+    rx1513_cur."!cursor_debug"("START", "prefix:sym<->")
+  debug_620:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1515_done
+    goto rxscan1515_scan
+  rxscan1515_loop:
+    ($P10) = rx1513_cur."from"()
+    inc $P10
+    set rx1513_pos, $P10
+    ge rx1513_pos, rx1513_eos, rxscan1515_done
+  rxscan1515_scan:
+    set_addr $I10, rxscan1515_loop
+    rx1513_cur."!mark_push"(0, rx1513_pos, $I10)
+  rxscan1515_done:
+.annotate 'line', 343
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1516_fail
+    rx1513_cur."!mark_push"(0, rx1513_pos, $I10)
+  # rx literal  "-"
+    add $I11, rx1513_pos, 1
+    gt $I11, rx1513_eos, rx1513_fail
+    sub $I11, rx1513_pos, rx1513_off
+    ord $I11, rx1513_tgt, $I11
+    ne $I11, 45, rx1513_fail
+    add rx1513_pos, 1
+    set_addr $I10, rxcap_1516_fail
+    ($I12, $I11) = rx1513_cur."!mark_peek"($I10)
+    rx1513_cur."!cursor_pos"($I11)
+    ($P10) = rx1513_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1513_pos, "")
+    rx1513_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1516_done
+  rxcap_1516_fail:
+    goto rx1513_fail
+  rxcap_1516_done:
+  # rx enumcharlist negate=1 zerowidth
+    sub $I10, rx1513_pos, rx1513_off
+    substr $S10, rx1513_tgt, $I10, 1
+    index $I11, ">-", $S10
+    ge $I11, 0, rx1513_fail
+  # rx subrule "O" subtype=capture negate=
+    rx1513_cur."!cursor_pos"(rx1513_pos)
+    $P10 = rx1513_cur."O"("%symbolic_unary :pirop<->")
+    unless $P10, rx1513_fail
+    rx1513_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1513_pos = $P10."pos"()
+  # rx pass
+    rx1513_cur."!cursor_pass"(rx1513_pos, "prefix:sym<->")
+    if_null rx1513_debug, debug_621
+    rx1513_cur."!cursor_debug"("PASS", "prefix:sym<->", " at pos=", rx1513_pos)
+  debug_621:
+    .return (rx1513_cur)
+  rx1513_restart:
+.annotate 'line', 8
+    if_null rx1513_debug, debug_622
+    rx1513_cur."!cursor_debug"("NEXT", "prefix:sym<->")
+  debug_622:
+  rx1513_fail:
+    (rx1513_rep, rx1513_pos, $I10, $P10) = rx1513_cur."!mark_fail"(0)
+    lt rx1513_pos, -1, rx1513_done
+    eq rx1513_pos, -1, rx1513_fail
+    jump $I10
+  rx1513_done:
+    rx1513_cur."!cursor_fail"()
+    if_null rx1513_debug, debug_623
+    rx1513_cur."!cursor_debug"("FAIL", "prefix:sym<->")
+  debug_623:
+    .return (rx1513_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__prefix:sym<->"  :subid("205_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("O", "-")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "prefix:sym<!>"  :subid("206_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1518_tgt
+    .local int rx1518_pos
+    .local int rx1518_off
+    .local int rx1518_eos
+    .local int rx1518_rep
+    .local pmc rx1518_cur
+    .local pmc rx1518_debug
+    (rx1518_cur, rx1518_pos, rx1518_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1518_debug, rx1518_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1518_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1518_eos, rx1518_tgt
+    gt rx1518_pos, rx1518_eos, rx1518_done
+    set rx1518_off, 0
+    lt rx1518_pos, 2, rx1518_start
+    sub rx1518_off, rx1518_pos, 1
+    substr rx1518_tgt, rx1518_tgt, rx1518_off
+  rx1518_start:
+    eq $I10, 1, rx1518_restart
+    if_null rx1518_debug, debug_624
+    rx1518_cur."!cursor_debug"("START", "prefix:sym<!>")
+  debug_624:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1520_done
+    goto rxscan1520_scan
+  rxscan1520_loop:
+    ($P10) = rx1518_cur."from"()
+    inc $P10
+    set rx1518_pos, $P10
+    ge rx1518_pos, rx1518_eos, rxscan1520_done
+  rxscan1520_scan:
+    set_addr $I10, rxscan1520_loop
+    rx1518_cur."!mark_push"(0, rx1518_pos, $I10)
+  rxscan1520_done:
+.annotate 'line', 344
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1521_fail
+    rx1518_cur."!mark_push"(0, rx1518_pos, $I10)
+  # rx literal  "!"
+    add $I11, rx1518_pos, 1
+    gt $I11, rx1518_eos, rx1518_fail
+    sub $I11, rx1518_pos, rx1518_off
+    ord $I11, rx1518_tgt, $I11
+    ne $I11, 33, rx1518_fail
+    add rx1518_pos, 1
+    set_addr $I10, rxcap_1521_fail
+    ($I12, $I11) = rx1518_cur."!mark_peek"($I10)
+    rx1518_cur."!cursor_pos"($I11)
+    ($P10) = rx1518_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1518_pos, "")
+    rx1518_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1521_done
+  rxcap_1521_fail:
+    goto rx1518_fail
+  rxcap_1521_done:
+  # rx subrule "O" subtype=capture negate=
+    rx1518_cur."!cursor_pos"(rx1518_pos)
+    $P10 = rx1518_cur."O"("%symbolic_unary :pirop<!>")
+    unless $P10, rx1518_fail
+    rx1518_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1518_pos = $P10."pos"()
+  # rx pass
+    rx1518_cur."!cursor_pass"(rx1518_pos, "prefix:sym<!>")
+    if_null rx1518_debug, debug_625
+    rx1518_cur."!cursor_debug"("PASS", "prefix:sym<!>", " at pos=", rx1518_pos)
+  debug_625:
+    .return (rx1518_cur)
+  rx1518_restart:
+.annotate 'line', 8
+    if_null rx1518_debug, debug_626
+    rx1518_cur."!cursor_debug"("NEXT", "prefix:sym<!>")
+  debug_626:
+  rx1518_fail:
+    (rx1518_rep, rx1518_pos, $I10, $P10) = rx1518_cur."!mark_fail"(0)
+    lt rx1518_pos, -1, rx1518_done
+    eq rx1518_pos, -1, rx1518_fail
+    jump $I10
+  rx1518_done:
+    rx1518_cur."!cursor_fail"()
+    if_null rx1518_debug, debug_627
+    rx1518_cur."!cursor_debug"("FAIL", "prefix:sym<!>")
+  debug_627:
+    .return (rx1518_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__prefix:sym<!>"  :subid("207_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("O", "!")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "prefix:sym<|>"  :subid("208_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1523_tgt
+    .local int rx1523_pos
+    .local int rx1523_off
+    .local int rx1523_eos
+    .local int rx1523_rep
+    .local pmc rx1523_cur
+    .local pmc rx1523_debug
+    (rx1523_cur, rx1523_pos, rx1523_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1523_debug, rx1523_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1523_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1523_eos, rx1523_tgt
+    gt rx1523_pos, rx1523_eos, rx1523_done
+    set rx1523_off, 0
+    lt rx1523_pos, 2, rx1523_start
+    sub rx1523_off, rx1523_pos, 1
+    substr rx1523_tgt, rx1523_tgt, rx1523_off
+  rx1523_start:
+    eq $I10, 1, rx1523_restart
+    if_null rx1523_debug, debug_628
+    rx1523_cur."!cursor_debug"("START", "prefix:sym<|>")
+  debug_628:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1525_done
+    goto rxscan1525_scan
+  rxscan1525_loop:
+    ($P10) = rx1523_cur."from"()
+    inc $P10
+    set rx1523_pos, $P10
+    ge rx1523_pos, rx1523_eos, rxscan1525_done
+  rxscan1525_scan:
+    set_addr $I10, rxscan1525_loop
+    rx1523_cur."!mark_push"(0, rx1523_pos, $I10)
+  rxscan1525_done:
+.annotate 'line', 345
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1526_fail
+    rx1523_cur."!mark_push"(0, rx1523_pos, $I10)
+  # rx literal  "|"
+    add $I11, rx1523_pos, 1
+    gt $I11, rx1523_eos, rx1523_fail
+    sub $I11, rx1523_pos, rx1523_off
+    ord $I11, rx1523_tgt, $I11
+    ne $I11, 124, rx1523_fail
+    add rx1523_pos, 1
+    set_addr $I10, rxcap_1526_fail
+    ($I12, $I11) = rx1523_cur."!mark_peek"($I10)
+    rx1523_cur."!cursor_pos"($I11)
+    ($P10) = rx1523_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1523_pos, "")
+    rx1523_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1526_done
+  rxcap_1526_fail:
+    goto rx1523_fail
+  rxcap_1526_done:
+  # rx subrule "O" subtype=capture negate=
+    rx1523_cur."!cursor_pos"(rx1523_pos)
+    $P10 = rx1523_cur."O"("%symbolic_unary :pirop<|>")
+    unless $P10, rx1523_fail
+    rx1523_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1523_pos = $P10."pos"()
+  # rx pass
+    rx1523_cur."!cursor_pass"(rx1523_pos, "prefix:sym<|>")
+    if_null rx1523_debug, debug_629
+    rx1523_cur."!cursor_debug"("PASS", "prefix:sym<|>", " at pos=", rx1523_pos)
+  debug_629:
+    .return (rx1523_cur)
+  rx1523_restart:
+.annotate 'line', 8
+    if_null rx1523_debug, debug_630
+    rx1523_cur."!cursor_debug"("NEXT", "prefix:sym<|>")
+  debug_630:
+  rx1523_fail:
+    (rx1523_rep, rx1523_pos, $I10, $P10) = rx1523_cur."!mark_fail"(0)
+    lt rx1523_pos, -1, rx1523_done
+    eq rx1523_pos, -1, rx1523_fail
+    jump $I10
+  rx1523_done:
+    rx1523_cur."!cursor_fail"()
+    if_null rx1523_debug, debug_631
+    rx1523_cur."!cursor_debug"("FAIL", "prefix:sym<|>")
+  debug_631:
+    .return (rx1523_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__prefix:sym<|>"  :subid("209_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("O", "|")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "prefix:sym<&>"  :subid("210_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1528_tgt
+    .local int rx1528_pos
+    .local int rx1528_off
+    .local int rx1528_eos
+    .local int rx1528_rep
+    .local pmc rx1528_cur
+    .local pmc rx1528_debug
+    (rx1528_cur, rx1528_pos, rx1528_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1528_debug, rx1528_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1528_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1528_eos, rx1528_tgt
+    gt rx1528_pos, rx1528_eos, rx1528_done
+    set rx1528_off, 0
+    lt rx1528_pos, 2, rx1528_start
+    sub rx1528_off, rx1528_pos, 1
+    substr rx1528_tgt, rx1528_tgt, rx1528_off
+  rx1528_start:
+    eq $I10, 1, rx1528_restart
+    if_null rx1528_debug, debug_632
+    rx1528_cur."!cursor_debug"("START", "prefix:sym<&>")
+  debug_632:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1530_done
+    goto rxscan1530_scan
+  rxscan1530_loop:
+    ($P10) = rx1528_cur."from"()
+    inc $P10
+    set rx1528_pos, $P10
+    ge rx1528_pos, rx1528_eos, rxscan1530_done
+  rxscan1530_scan:
+    set_addr $I10, rxscan1530_loop
+    rx1528_cur."!mark_push"(0, rx1528_pos, $I10)
+  rxscan1530_done:
+.annotate 'line', 346
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1531_fail
+    rx1528_cur."!mark_push"(0, rx1528_pos, $I10)
+  # rx literal  "&"
+    add $I11, rx1528_pos, 1
+    gt $I11, rx1528_eos, rx1528_fail
+    sub $I11, rx1528_pos, rx1528_off
+    ord $I11, rx1528_tgt, $I11
+    ne $I11, 38, rx1528_fail
+    add rx1528_pos, 1
+    set_addr $I10, rxcap_1531_fail
+    ($I12, $I11) = rx1528_cur."!mark_peek"($I10)
+    rx1528_cur."!cursor_pos"($I11)
+    ($P10) = rx1528_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1528_pos, "")
+    rx1528_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1531_done
+  rxcap_1531_fail:
+    goto rx1528_fail
+  rxcap_1531_done:
+  # rx subrule "O" subtype=capture negate=
+    rx1528_cur."!cursor_pos"(rx1528_pos)
+    $P10 = rx1528_cur."O"("%symbolic_unary :pirop<&>")
+    unless $P10, rx1528_fail
+    rx1528_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1528_pos = $P10."pos"()
+  # rx pass
+    rx1528_cur."!cursor_pass"(rx1528_pos, "prefix:sym<&>")
+    if_null rx1528_debug, debug_633
+    rx1528_cur."!cursor_debug"("PASS", "prefix:sym<&>", " at pos=", rx1528_pos)
+  debug_633:
+    .return (rx1528_cur)
+  rx1528_restart:
+.annotate 'line', 8
+    if_null rx1528_debug, debug_634
+    rx1528_cur."!cursor_debug"("NEXT", "prefix:sym<&>")
+  debug_634:
+  rx1528_fail:
+    (rx1528_rep, rx1528_pos, $I10, $P10) = rx1528_cur."!mark_fail"(0)
+    lt rx1528_pos, -1, rx1528_done
+    eq rx1528_pos, -1, rx1528_fail
+    jump $I10
+  rx1528_done:
+    rx1528_cur."!cursor_fail"()
+    if_null rx1528_debug, debug_635
+    rx1528_cur."!cursor_debug"("FAIL", "prefix:sym<&>")
+  debug_635:
+    .return (rx1528_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__prefix:sym<&>"  :subid("211_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("O", "&")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "prefix:sym<*>"  :subid("212_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1533_tgt
+    .local int rx1533_pos
+    .local int rx1533_off
+    .local int rx1533_eos
+    .local int rx1533_rep
+    .local pmc rx1533_cur
+    .local pmc rx1533_debug
+    (rx1533_cur, rx1533_pos, rx1533_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1533_debug, rx1533_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1533_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1533_eos, rx1533_tgt
+    gt rx1533_pos, rx1533_eos, rx1533_done
+    set rx1533_off, 0
+    lt rx1533_pos, 2, rx1533_start
+    sub rx1533_off, rx1533_pos, 1
+    substr rx1533_tgt, rx1533_tgt, rx1533_off
+  rx1533_start:
+    eq $I10, 1, rx1533_restart
+    if_null rx1533_debug, debug_636
+    rx1533_cur."!cursor_debug"("START", "prefix:sym<*>")
+  debug_636:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1535_done
+    goto rxscan1535_scan
+  rxscan1535_loop:
+    ($P10) = rx1533_cur."from"()
+    inc $P10
+    set rx1533_pos, $P10
+    ge rx1533_pos, rx1533_eos, rxscan1535_done
+  rxscan1535_scan:
+    set_addr $I10, rxscan1535_loop
+    rx1533_cur."!mark_push"(0, rx1533_pos, $I10)
+  rxscan1535_done:
+.annotate 'line', 347
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1536_fail
+    rx1533_cur."!mark_push"(0, rx1533_pos, $I10)
+  # rx literal  "*"
+    add $I11, rx1533_pos, 1
+    gt $I11, rx1533_eos, rx1533_fail
+    sub $I11, rx1533_pos, rx1533_off
+    ord $I11, rx1533_tgt, $I11
+    ne $I11, 42, rx1533_fail
+    add rx1533_pos, 1
+    set_addr $I10, rxcap_1536_fail
+    ($I12, $I11) = rx1533_cur."!mark_peek"($I10)
+    rx1533_cur."!cursor_pos"($I11)
+    ($P10) = rx1533_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1533_pos, "")
+    rx1533_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1536_done
+  rxcap_1536_fail:
+    goto rx1533_fail
+  rxcap_1536_done:
+  # rx subrule "O" subtype=capture negate=
+    rx1533_cur."!cursor_pos"(rx1533_pos)
+    $P10 = rx1533_cur."O"("%symbolic_unary :pirop<*>")
+    unless $P10, rx1533_fail
+    rx1533_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1533_pos = $P10."pos"()
+  # rx pass
+    rx1533_cur."!cursor_pass"(rx1533_pos, "prefix:sym<*>")
+    if_null rx1533_debug, debug_637
+    rx1533_cur."!cursor_debug"("PASS", "prefix:sym<*>", " at pos=", rx1533_pos)
+  debug_637:
+    .return (rx1533_cur)
+  rx1533_restart:
+.annotate 'line', 8
+    if_null rx1533_debug, debug_638
+    rx1533_cur."!cursor_debug"("NEXT", "prefix:sym<*>")
+  debug_638:
+  rx1533_fail:
+    (rx1533_rep, rx1533_pos, $I10, $P10) = rx1533_cur."!mark_fail"(0)
+    lt rx1533_pos, -1, rx1533_done
+    eq rx1533_pos, -1, rx1533_fail
+    jump $I10
+  rx1533_done:
+    rx1533_cur."!cursor_fail"()
+    if_null rx1533_debug, debug_639
+    rx1533_cur."!cursor_debug"("FAIL", "prefix:sym<*>")
+  debug_639:
+    .return (rx1533_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__prefix:sym<*>"  :subid("213_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("O", "*")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "prefix:sym<~>"  :subid("214_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1538_tgt
+    .local int rx1538_pos
+    .local int rx1538_off
+    .local int rx1538_eos
+    .local int rx1538_rep
+    .local pmc rx1538_cur
+    .local pmc rx1538_debug
+    (rx1538_cur, rx1538_pos, rx1538_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1538_debug, rx1538_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1538_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1538_eos, rx1538_tgt
+    gt rx1538_pos, rx1538_eos, rx1538_done
+    set rx1538_off, 0
+    lt rx1538_pos, 2, rx1538_start
+    sub rx1538_off, rx1538_pos, 1
+    substr rx1538_tgt, rx1538_tgt, rx1538_off
+  rx1538_start:
+    eq $I10, 1, rx1538_restart
+    if_null rx1538_debug, debug_640
+    rx1538_cur."!cursor_debug"("START", "prefix:sym<~>")
+  debug_640:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1540_done
+    goto rxscan1540_scan
+  rxscan1540_loop:
+    ($P10) = rx1538_cur."from"()
+    inc $P10
+    set rx1538_pos, $P10
+    ge rx1538_pos, rx1538_eos, rxscan1540_done
+  rxscan1540_scan:
+    set_addr $I10, rxscan1540_loop
+    rx1538_cur."!mark_push"(0, rx1538_pos, $I10)
+  rxscan1540_done:
+.annotate 'line', 348
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1541_fail
+    rx1538_cur."!mark_push"(0, rx1538_pos, $I10)
+  # rx literal  "~"
+    add $I11, rx1538_pos, 1
+    gt $I11, rx1538_eos, rx1538_fail
+    sub $I11, rx1538_pos, rx1538_off
+    ord $I11, rx1538_tgt, $I11
+    ne $I11, 126, rx1538_fail
+    add rx1538_pos, 1
+    set_addr $I10, rxcap_1541_fail
+    ($I12, $I11) = rx1538_cur."!mark_peek"($I10)
+    rx1538_cur."!cursor_pos"($I11)
+    ($P10) = rx1538_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1538_pos, "")
+    rx1538_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1541_done
+  rxcap_1541_fail:
+    goto rx1538_fail
+  rxcap_1541_done:
+  # rx subrule "O" subtype=capture negate=
+    rx1538_cur."!cursor_pos"(rx1538_pos)
+    $P10 = rx1538_cur."O"("%symbolic_unary :pirop<~>")
+    unless $P10, rx1538_fail
+    rx1538_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1538_pos = $P10."pos"()
+  # rx pass
+    rx1538_cur."!cursor_pass"(rx1538_pos, "prefix:sym<~>")
+    if_null rx1538_debug, debug_641
+    rx1538_cur."!cursor_debug"("PASS", "prefix:sym<~>", " at pos=", rx1538_pos)
+  debug_641:
+    .return (rx1538_cur)
+  rx1538_restart:
+.annotate 'line', 8
+    if_null rx1538_debug, debug_642
+    rx1538_cur."!cursor_debug"("NEXT", "prefix:sym<~>")
+  debug_642:
+  rx1538_fail:
+    (rx1538_rep, rx1538_pos, $I10, $P10) = rx1538_cur."!mark_fail"(0)
+    lt rx1538_pos, -1, rx1538_done
+    eq rx1538_pos, -1, rx1538_fail
+    jump $I10
+  rx1538_done:
+    rx1538_cur."!cursor_fail"()
+    if_null rx1538_debug, debug_643
+    rx1538_cur."!cursor_debug"("FAIL", "prefix:sym<~>")
+  debug_643:
+    .return (rx1538_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__prefix:sym<~>"  :subid("215_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("O", "~")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "prefix:sym<return>"  :subid("216_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1543_tgt
+    .local int rx1543_pos
+    .local int rx1543_off
+    .local int rx1543_eos
+    .local int rx1543_rep
+    .local pmc rx1543_cur
+    .local pmc rx1543_debug
+    (rx1543_cur, rx1543_pos, rx1543_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1543_debug, rx1543_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1543_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1543_eos, rx1543_tgt
+    gt rx1543_pos, rx1543_eos, rx1543_done
+    set rx1543_off, 0
+    lt rx1543_pos, 2, rx1543_start
+    sub rx1543_off, rx1543_pos, 1
+    substr rx1543_tgt, rx1543_tgt, rx1543_off
+  rx1543_start:
+    eq $I10, 1, rx1543_restart
+    if_null rx1543_debug, debug_644
+    rx1543_cur."!cursor_debug"("START", "prefix:sym<return>")
+  debug_644:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1545_done
+    goto rxscan1545_scan
+  rxscan1545_loop:
+    ($P10) = rx1543_cur."from"()
+    inc $P10
+    set rx1543_pos, $P10
+    ge rx1543_pos, rx1543_eos, rxscan1545_done
+  rxscan1545_scan:
+    set_addr $I10, rxscan1545_loop
+    rx1543_cur."!mark_push"(0, rx1543_pos, $I10)
+  rxscan1545_done:
+.annotate 'line', 350
+  # rx subcapture "sym"
+    set_addr $I10, rxcap_1546_fail
+    rx1543_cur."!mark_push"(0, rx1543_pos, $I10)
+  # rx literal  "return"
+    add $I11, rx1543_pos, 6
+    gt $I11, rx1543_eos, rx1543_fail
+    sub $I11, rx1543_pos, rx1543_off
+    substr $S10, rx1543_tgt, $I11, 6
+    ne $S10, "return", rx1543_fail
+    add rx1543_pos, 6
+    set_addr $I10, rxcap_1546_fail
+    ($I12, $I11) = rx1543_cur."!mark_peek"($I10)
+    rx1543_cur."!cursor_pos"($I11)
+    ($P10) = rx1543_cur."!cursor_start"()
+    $P10."!cursor_pass"(rx1543_pos, "")
+    rx1543_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("sym")
+    goto rxcap_1546_done
+  rxcap_1546_fail:
+    goto rx1543_fail
+  rxcap_1546_done:
+  # rx subrule "O" subtype=capture negate=
+    rx1543_cur."!cursor_pos"(rx1543_pos)
+    $P10 = rx1543_cur."O"("%symbolic_unary :pirop<return>")
+    unless $P10, rx1543_fail
+    rx1543_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("O")
+    rx1543_pos = $P10."pos"()
+  # rx pass
+    rx1543_cur."!cursor_pass"(rx1543_pos, "prefix:sym<return>")
+    if_null rx1543_debug, debug_645
+    rx1543_cur."!cursor_debug"("PASS", "prefix:sym<return>", " at pos=", rx1543_pos)
+  debug_645:
+    .return (rx1543_cur)
+  rx1543_restart:
+.annotate 'line', 8
+    if_null rx1543_debug, debug_646
+    rx1543_cur."!cursor_debug"("NEXT", "prefix:sym<return>")
+  debug_646:
+  rx1543_fail:
+    (rx1543_rep, rx1543_pos, $I10, $P10) = rx1543_cur."!mark_fail"(0)
+    lt rx1543_pos, -1, rx1543_done
+    eq rx1543_pos, -1, rx1543_fail
+    jump $I10
+  rx1543_done:
+    rx1543_cur."!cursor_fail"()
+    if_null rx1543_debug, debug_647
+    rx1543_cur."!cursor_debug"("FAIL", "prefix:sym<return>")
+  debug_647:
+    .return (rx1543_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__prefix:sym<return>"  :subid("217_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("O", "return")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "blockoid"  :subid("218_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1548_tgt
+    .local int rx1548_pos
+    .local int rx1548_off
+    .local int rx1548_eos
+    .local int rx1548_rep
+    .local pmc rx1548_cur
+    .local pmc rx1548_debug
+    (rx1548_cur, rx1548_pos, rx1548_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1548_debug, rx1548_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1548_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1548_eos, rx1548_tgt
+    gt rx1548_pos, rx1548_eos, rx1548_done
+    set rx1548_off, 0
+    lt rx1548_pos, 2, rx1548_start
+    sub rx1548_off, rx1548_pos, 1
+    substr rx1548_tgt, rx1548_tgt, rx1548_off
+  rx1548_start:
+    eq $I10, 1, rx1548_restart
+    if_null rx1548_debug, debug_648
+    rx1548_cur."!cursor_debug"("START", "blockoid")
+  debug_648:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1550_done
+    goto rxscan1550_scan
+  rxscan1550_loop:
+    ($P10) = rx1548_cur."from"()
+    inc $P10
+    set rx1548_pos, $P10
+    ge rx1548_pos, rx1548_eos, rxscan1550_done
+  rxscan1550_scan:
+    set_addr $I10, rxscan1550_loop
+    rx1548_cur."!mark_push"(0, rx1548_pos, $I10)
+  rxscan1550_done:
+.annotate 'line', 352
+  # rx subrule "ws" subtype=method negate=
+    rx1548_cur."!cursor_pos"(rx1548_pos)
+    $P10 = rx1548_cur."ws"()
+    unless $P10, rx1548_fail
+    rx1548_pos = $P10."pos"()
+.annotate 'line', 353
+  # rx literal  "{"
+    add $I11, rx1548_pos, 1
+    gt $I11, rx1548_eos, rx1548_fail
+    sub $I11, rx1548_pos, rx1548_off
+    ord $I11, rx1548_tgt, $I11
+    ne $I11, 123, rx1548_fail
+    add rx1548_pos, 1
+  # rx subrule "ws" subtype=method negate=
+    rx1548_cur."!cursor_pos"(rx1548_pos)
+    $P10 = rx1548_cur."ws"()
+    unless $P10, rx1548_fail
+    rx1548_pos = $P10."pos"()
+  # rx subrule "mixed_content" subtype=capture negate=
+    rx1548_cur."!cursor_pos"(rx1548_pos)
+    $P10 = rx1548_cur."mixed_content"()
+    unless $P10, rx1548_fail
+    rx1548_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("mixed_content")
+    rx1548_pos = $P10."pos"()
+  alt1551_0:
+    set_addr $I10, alt1551_1
+    rx1548_cur."!mark_push"(0, rx1548_pos, $I10)
+  # rx literal  "}"
+    add $I11, rx1548_pos, 1
+    gt $I11, rx1548_eos, rx1548_fail
+    sub $I11, rx1548_pos, rx1548_off
+    ord $I11, rx1548_tgt, $I11
+    ne $I11, 125, rx1548_fail
+    add rx1548_pos, 1
+    goto alt1551_end
+  alt1551_1:
+  # rx subrule "FAILGOAL" subtype=method negate=
+    rx1548_cur."!cursor_pos"(rx1548_pos)
+    $P10 = rx1548_cur."FAILGOAL"("'}'")
+    unless $P10, rx1548_fail
+    goto rxsubrule1552_pass
+  rxsubrule1552_back:
+    $P10 = $P10."!cursor_next"()
+    unless $P10, rx1548_fail
+  rxsubrule1552_pass:
+    set_addr $I10, rxsubrule1552_back
+    rx1548_cur."!mark_push"(0, rx1548_pos, $I10, $P10)
+    rx1548_pos = $P10."pos"()
+  alt1551_end:
+  # rx subrule "ws" subtype=method negate=
+    rx1548_cur."!cursor_pos"(rx1548_pos)
+    $P10 = rx1548_cur."ws"()
+    unless $P10, rx1548_fail
+    rx1548_pos = $P10."pos"()
+.annotate 'line', 352
+  # rx pass
+    rx1548_cur."!cursor_pass"(rx1548_pos, "blockoid")
+    if_null rx1548_debug, debug_649
+    rx1548_cur."!cursor_debug"("PASS", "blockoid", " at pos=", rx1548_pos)
+  debug_649:
+    .return (rx1548_cur)
+  rx1548_restart:
+.annotate 'line', 8
+    if_null rx1548_debug, debug_650
+    rx1548_cur."!cursor_debug"("NEXT", "blockoid")
+  debug_650:
+  rx1548_fail:
+    (rx1548_rep, rx1548_pos, $I10, $P10) = rx1548_cur."!mark_fail"(0)
+    lt rx1548_pos, -1, rx1548_done
+    eq rx1548_pos, -1, rx1548_fail
+    jump $I10
+  rx1548_done:
+    rx1548_cur."!cursor_fail"()
+    if_null rx1548_debug, debug_651
+    rx1548_cur."!cursor_debug"("FAIL", "blockoid")
+  debug_651:
+    .return (rx1548_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__blockoid"  :subid("219_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("ws", "")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "mixed_content"  :subid("220_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1554_tgt
+    .local int rx1554_pos
+    .local int rx1554_off
+    .local int rx1554_eos
+    .local int rx1554_rep
+    .local pmc rx1554_cur
+    .local pmc rx1554_debug
+    (rx1554_cur, rx1554_pos, rx1554_tgt, $I10) = self."!cursor_start"()
+    rx1554_cur."!cursor_caparray"("declarator")
+    getattribute rx1554_debug, rx1554_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1554_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1554_eos, rx1554_tgt
+    gt rx1554_pos, rx1554_eos, rx1554_done
+    set rx1554_off, 0
+    lt rx1554_pos, 2, rx1554_start
+    sub rx1554_off, rx1554_pos, 1
+    substr rx1554_tgt, rx1554_tgt, rx1554_off
+  rx1554_start:
+    eq $I10, 1, rx1554_restart
+    if_null rx1554_debug, debug_652
+    rx1554_cur."!cursor_debug"("START", "mixed_content")
+  debug_652:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1556_done
+    goto rxscan1556_scan
+  rxscan1556_loop:
+    ($P10) = rx1554_cur."from"()
+    inc $P10
+    set rx1554_pos, $P10
+    ge rx1554_pos, rx1554_eos, rxscan1556_done
+  rxscan1556_scan:
+    set_addr $I10, rxscan1556_loop
+    rx1554_cur."!mark_push"(0, rx1554_pos, $I10)
+  rxscan1556_done:
+.annotate 'line', 356
+  # rx subrule "ws" subtype=method negate=
+    rx1554_cur."!cursor_pos"(rx1554_pos)
+    $P10 = rx1554_cur."ws"()
+    unless $P10, rx1554_fail
+    rx1554_pos = $P10."pos"()
+.annotate 'line', 357
+  # rx rxquantr1557 ** 0..*
+    set_addr $I10, rxquantr1557_done
+    rx1554_cur."!mark_push"(0, rx1554_pos, $I10)
+  rxquantr1557_loop:
+  # rx subrule "declarator" subtype=capture negate=
+    rx1554_cur."!cursor_pos"(rx1554_pos)
+    $P10 = rx1554_cur."declarator"()
+    unless $P10, rx1554_fail
+    goto rxsubrule1558_pass
+  rxsubrule1558_back:
+    $P10 = $P10."!cursor_next"()
+    unless $P10, rx1554_fail
+  rxsubrule1558_pass:
+    set_addr $I10, rxsubrule1558_back
+    rx1554_cur."!mark_push"(0, rx1554_pos, $I10, $P10)
+    $P10."!cursor_names"("declarator")
+    rx1554_pos = $P10."pos"()
+    set_addr $I10, rxquantr1557_done
+    (rx1554_rep) = rx1554_cur."!mark_commit"($I10)
+    set_addr $I10, rxquantr1557_done
+    rx1554_cur."!mark_push"(rx1554_rep, rx1554_pos, $I10)
+    goto rxquantr1557_loop
+  rxquantr1557_done:
+  # rx subrule "ws" subtype=method negate=
+    rx1554_cur."!cursor_pos"(rx1554_pos)
+    $P10 = rx1554_cur."ws"()
+    unless $P10, rx1554_fail
+    rx1554_pos = $P10."pos"()
+.annotate 'line', 358
+  # rx subrule "statement_list" subtype=capture negate=
+    rx1554_cur."!cursor_pos"(rx1554_pos)
+    $P10 = rx1554_cur."statement_list"()
+    unless $P10, rx1554_fail
+    rx1554_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("statement_list")
+    rx1554_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1554_cur."!cursor_pos"(rx1554_pos)
+    $P10 = rx1554_cur."ws"()
+    unless $P10, rx1554_fail
+    rx1554_pos = $P10."pos"()
+.annotate 'line', 356
+  # rx pass
+    rx1554_cur."!cursor_pass"(rx1554_pos, "mixed_content")
+    if_null rx1554_debug, debug_653
+    rx1554_cur."!cursor_debug"("PASS", "mixed_content", " at pos=", rx1554_pos)
+  debug_653:
+    .return (rx1554_cur)
+  rx1554_restart:
+.annotate 'line', 8
+    if_null rx1554_debug, debug_654
+    rx1554_cur."!cursor_debug"("NEXT", "mixed_content")
+  debug_654:
+  rx1554_fail:
+    (rx1554_rep, rx1554_pos, $I10, $P10) = rx1554_cur."!mark_fail"(0)
+    lt rx1554_pos, -1, rx1554_done
+    eq rx1554_pos, -1, rx1554_fail
+    jump $I10
+  rx1554_done:
+    rx1554_cur."!cursor_fail"()
+    if_null rx1554_debug, debug_655
+    rx1554_cur."!cursor_debug"("FAIL", "mixed_content")
+  debug_655:
+    .return (rx1554_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__mixed_content"  :subid("221_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("ws", "")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "declarator"  :subid("222_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1560_tgt
+    .local int rx1560_pos
+    .local int rx1560_off
+    .local int rx1560_eos
+    .local int rx1560_rep
+    .local pmc rx1560_cur
+    .local pmc rx1560_debug
+    (rx1560_cur, rx1560_pos, rx1560_tgt, $I10) = self."!cursor_start"()
+    rx1560_cur."!cursor_caparray"("declarator_name")
+    getattribute rx1560_debug, rx1560_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1560_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1560_eos, rx1560_tgt
+    gt rx1560_pos, rx1560_eos, rx1560_done
+    set rx1560_off, 0
+    lt rx1560_pos, 2, rx1560_start
+    sub rx1560_off, rx1560_pos, 1
+    substr rx1560_tgt, rx1560_tgt, rx1560_off
+  rx1560_start:
+    eq $I10, 1, rx1560_restart
+    if_null rx1560_debug, debug_656
+    rx1560_cur."!cursor_debug"("START", "declarator")
+  debug_656:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1562_done
+    goto rxscan1562_scan
+  rxscan1562_loop:
+    ($P10) = rx1560_cur."from"()
+    inc $P10
+    set rx1560_pos, $P10
+    ge rx1560_pos, rx1560_eos, rxscan1562_done
+  rxscan1562_scan:
+    set_addr $I10, rxscan1562_loop
+    rx1560_cur."!mark_push"(0, rx1560_pos, $I10)
+  rxscan1562_done:
+.annotate 'line', 362
+  # rx subrule "ws" subtype=method negate=
+    rx1560_cur."!cursor_pos"(rx1560_pos)
+    $P10 = rx1560_cur."ws"()
+    unless $P10, rx1560_fail
+    rx1560_pos = $P10."pos"()
+.annotate 'line', 363
+  # rx subrule "pointerless_type" subtype=capture negate=
+    rx1560_cur."!cursor_pos"(rx1560_pos)
+    $P10 = rx1560_cur."pointerless_type"()
+    unless $P10, rx1560_fail
+    rx1560_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("type_declarator")
+    rx1560_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1560_cur."!cursor_pos"(rx1560_pos)
+    $P10 = rx1560_cur."ws"()
+    unless $P10, rx1560_fail
+    rx1560_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1560_cur."!cursor_pos"(rx1560_pos)
+    $P10 = rx1560_cur."ws"()
+    unless $P10, rx1560_fail
+    rx1560_pos = $P10."pos"()
+  # rx rxquantr1563 ** 1..*
+    set_addr $I10, rxquantr1563_done
+    rx1560_cur."!mark_push"(0, -1, $I10)
+  rxquantr1563_loop:
+  # rx subrule "declarator_name" subtype=capture negate=
+    rx1560_cur."!cursor_pos"(rx1560_pos)
+    $P10 = rx1560_cur."declarator_name"()
+    unless $P10, rx1560_fail
+    goto rxsubrule1564_pass
+  rxsubrule1564_back:
+    $P10 = $P10."!cursor_next"()
+    unless $P10, rx1560_fail
+  rxsubrule1564_pass:
+    set_addr $I10, rxsubrule1564_back
+    rx1560_cur."!mark_push"(0, rx1560_pos, $I10, $P10)
+    $P10."!cursor_names"("declarator_name")
+    rx1560_pos = $P10."pos"()
+    set_addr $I10, rxquantr1563_done
+    (rx1560_rep) = rx1560_cur."!mark_commit"($I10)
+    set_addr $I10, rxquantr1563_done
+    rx1560_cur."!mark_push"(rx1560_rep, rx1560_pos, $I10)
+  # rx subrule "ws" subtype=method negate=
+    rx1560_cur."!cursor_pos"(rx1560_pos)
+    $P10 = rx1560_cur."ws"()
+    unless $P10, rx1560_fail
+    goto rxsubrule1565_pass
+  rxsubrule1565_back:
+    $P10 = $P10."!cursor_next"()
+    unless $P10, rx1560_fail
+  rxsubrule1565_pass:
+    set_addr $I10, rxsubrule1565_back
+    rx1560_cur."!mark_push"(0, rx1560_pos, $I10, $P10)
+    rx1560_pos = $P10."pos"()
+  # rx literal  ","
+    add $I11, rx1560_pos, 1
+    gt $I11, rx1560_eos, rx1560_fail
+    sub $I11, rx1560_pos, rx1560_off
+    ord $I11, rx1560_tgt, $I11
+    ne $I11, 44, rx1560_fail
+    add rx1560_pos, 1
+  # rx subrule "ws" subtype=method negate=
+    rx1560_cur."!cursor_pos"(rx1560_pos)
+    $P10 = rx1560_cur."ws"()
+    unless $P10, rx1560_fail
+    goto rxsubrule1566_pass
+  rxsubrule1566_back:
+    $P10 = $P10."!cursor_next"()
+    unless $P10, rx1560_fail
+  rxsubrule1566_pass:
+    set_addr $I10, rxsubrule1566_back
+    rx1560_cur."!mark_push"(0, rx1560_pos, $I10, $P10)
+    rx1560_pos = $P10."pos"()
+    goto rxquantr1563_loop
+  rxquantr1563_done:
+  # rx subrule "ws" subtype=method negate=
+    rx1560_cur."!cursor_pos"(rx1560_pos)
+    $P10 = rx1560_cur."ws"()
+    unless $P10, rx1560_fail
+    rx1560_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1560_cur."!cursor_pos"(rx1560_pos)
+    $P10 = rx1560_cur."ws"()
+    unless $P10, rx1560_fail
+    rx1560_pos = $P10."pos"()
+  # rx literal  ";"
+    add $I11, rx1560_pos, 1
+    gt $I11, rx1560_eos, rx1560_fail
+    sub $I11, rx1560_pos, rx1560_off
+    ord $I11, rx1560_tgt, $I11
+    ne $I11, 59, rx1560_fail
+    add rx1560_pos, 1
+  # rx subrule "ws" subtype=method negate=
+    rx1560_cur."!cursor_pos"(rx1560_pos)
+    $P10 = rx1560_cur."ws"()
+    unless $P10, rx1560_fail
+    rx1560_pos = $P10."pos"()
+.annotate 'line', 362
+  # rx pass
+    rx1560_cur."!cursor_pass"(rx1560_pos, "declarator")
+    if_null rx1560_debug, debug_657
+    rx1560_cur."!cursor_debug"("PASS", "declarator", " at pos=", rx1560_pos)
+  debug_657:
+    .return (rx1560_cur)
+  rx1560_restart:
+.annotate 'line', 8
+    if_null rx1560_debug, debug_658
+    rx1560_cur."!cursor_debug"("NEXT", "declarator")
+  debug_658:
+  rx1560_fail:
+    (rx1560_rep, rx1560_pos, $I10, $P10) = rx1560_cur."!mark_fail"(0)
+    lt rx1560_pos, -1, rx1560_done
+    eq rx1560_pos, -1, rx1560_fail
+    jump $I10
+  rx1560_done:
+    rx1560_cur."!cursor_fail"()
+    if_null rx1560_debug, debug_659
+    rx1560_cur."!cursor_debug"("FAIL", "declarator")
+  debug_659:
+    .return (rx1560_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__declarator"  :subid("223_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("ws", "")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "declarator_name"  :subid("224_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1568_tgt
+    .local int rx1568_pos
+    .local int rx1568_off
+    .local int rx1568_eos
+    .local int rx1568_rep
+    .local pmc rx1568_cur
+    .local pmc rx1568_debug
+    (rx1568_cur, rx1568_pos, rx1568_tgt, $I10) = self."!cursor_start"()
+    rx1568_cur."!cursor_caparray"("pointer", "array_size", "EXPR")
+    getattribute rx1568_debug, rx1568_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1568_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1568_eos, rx1568_tgt
+    gt rx1568_pos, rx1568_eos, rx1568_done
+    set rx1568_off, 0
+    lt rx1568_pos, 2, rx1568_start
+    sub rx1568_off, rx1568_pos, 1
+    substr rx1568_tgt, rx1568_tgt, rx1568_off
+  rx1568_start:
+    eq $I10, 1, rx1568_restart
+    if_null rx1568_debug, debug_660
+    rx1568_cur."!cursor_debug"("START", "declarator_name")
+  debug_660:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1570_done
+    goto rxscan1570_scan
+  rxscan1570_loop:
+    ($P10) = rx1568_cur."from"()
+    inc $P10
+    set rx1568_pos, $P10
+    ge rx1568_pos, rx1568_eos, rxscan1570_done
+  rxscan1570_scan:
+    set_addr $I10, rxscan1570_loop
+    rx1568_cur."!mark_push"(0, rx1568_pos, $I10)
+  rxscan1570_done:
+.annotate 'line', 366
+  # rx subrule "ws" subtype=method negate=
+    rx1568_cur."!cursor_pos"(rx1568_pos)
+    $P10 = rx1568_cur."ws"()
+    unless $P10, rx1568_fail
+    rx1568_pos = $P10."pos"()
+.annotate 'line', 367
+  # rx rxquantr1571 ** 0..*
+    set_addr $I10, rxquantr1571_done
+    rx1568_cur."!mark_push"(0, rx1568_pos, $I10)
+  rxquantr1571_loop:
+  # rx subrule "pointer" subtype=capture negate=
+    rx1568_cur."!cursor_pos"(rx1568_pos)
+    $P10 = rx1568_cur."pointer"()
+    unless $P10, rx1568_fail
+    goto rxsubrule1572_pass
+  rxsubrule1572_back:
+    $P10 = $P10."!cursor_next"()
+    unless $P10, rx1568_fail
+  rxsubrule1572_pass:
+    set_addr $I10, rxsubrule1572_back
+    rx1568_cur."!mark_push"(0, rx1568_pos, $I10, $P10)
+    $P10."!cursor_names"("pointer")
+    rx1568_pos = $P10."pos"()
+    set_addr $I10, rxquantr1571_done
+    (rx1568_rep) = rx1568_cur."!mark_commit"($I10)
+    set_addr $I10, rxquantr1571_done
+    rx1568_cur."!mark_push"(rx1568_rep, rx1568_pos, $I10)
+    goto rxquantr1571_loop
+  rxquantr1571_done:
+  # rx subrule "ws" subtype=method negate=
+    rx1568_cur."!cursor_pos"(rx1568_pos)
+    $P10 = rx1568_cur."ws"()
+    unless $P10, rx1568_fail
+    rx1568_pos = $P10."pos"()
+  # rx subrule "ident" subtype=capture negate=
+    rx1568_cur."!cursor_pos"(rx1568_pos)
+    $P10 = rx1568_cur."ident"()
+    unless $P10, rx1568_fail
+    rx1568_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("variable")
+    rx1568_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1568_cur."!cursor_pos"(rx1568_pos)
+    $P10 = rx1568_cur."ws"()
+    unless $P10, rx1568_fail
+    rx1568_pos = $P10."pos"()
+  # rx rxquantr1573 ** 0..1
+    set_addr $I10, rxquantr1573_done
+    rx1568_cur."!mark_push"(0, rx1568_pos, $I10)
+  rxquantr1573_loop:
+  # rx subrule "ws" subtype=method negate=
+    rx1568_cur."!cursor_pos"(rx1568_pos)
+    $P10 = rx1568_cur."ws"()
+    unless $P10, rx1568_fail
+    rx1568_pos = $P10."pos"()
+  # rx literal  "["
+    add $I11, rx1568_pos, 1
+    gt $I11, rx1568_eos, rx1568_fail
+    sub $I11, rx1568_pos, rx1568_off
+    ord $I11, rx1568_tgt, $I11
+    ne $I11, 91, rx1568_fail
+    add rx1568_pos, 1
+  # rx subrule "ws" subtype=method negate=
+    rx1568_cur."!cursor_pos"(rx1568_pos)
+    $P10 = rx1568_cur."ws"()
+    unless $P10, rx1568_fail
+    rx1568_pos = $P10."pos"()
+  # rx subrule "integer" subtype=capture negate=
+    rx1568_cur."!cursor_pos"(rx1568_pos)
+    $P10 = rx1568_cur."integer"()
+    unless $P10, rx1568_fail
+    rx1568_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("array_size")
+    rx1568_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1568_cur."!cursor_pos"(rx1568_pos)
+    $P10 = rx1568_cur."ws"()
+    unless $P10, rx1568_fail
+    rx1568_pos = $P10."pos"()
+  # rx literal  "]"
+    add $I11, rx1568_pos, 1
+    gt $I11, rx1568_eos, rx1568_fail
+    sub $I11, rx1568_pos, rx1568_off
+    ord $I11, rx1568_tgt, $I11
+    ne $I11, 93, rx1568_fail
+    add rx1568_pos, 1
+  # rx subrule "ws" subtype=method negate=
+    rx1568_cur."!cursor_pos"(rx1568_pos)
+    $P10 = rx1568_cur."ws"()
+    unless $P10, rx1568_fail
+    rx1568_pos = $P10."pos"()
+    set_addr $I10, rxquantr1573_done
+    (rx1568_rep) = rx1568_cur."!mark_commit"($I10)
+  rxquantr1573_done:
+  # rx subrule "ws" subtype=method negate=
+    rx1568_cur."!cursor_pos"(rx1568_pos)
+    $P10 = rx1568_cur."ws"()
+    unless $P10, rx1568_fail
+    rx1568_pos = $P10."pos"()
+  # rx rxquantr1574 ** 0..1
+    set_addr $I10, rxquantr1574_done
+    rx1568_cur."!mark_push"(0, rx1568_pos, $I10)
+  rxquantr1574_loop:
+  # rx subrule "ws" subtype=method negate=
+    rx1568_cur."!cursor_pos"(rx1568_pos)
+    $P10 = rx1568_cur."ws"()
+    unless $P10, rx1568_fail
+    rx1568_pos = $P10."pos"()
+  # rx literal  "="
+    add $I11, rx1568_pos, 1
+    gt $I11, rx1568_eos, rx1568_fail
+    sub $I11, rx1568_pos, rx1568_off
+    ord $I11, rx1568_tgt, $I11
+    ne $I11, 61, rx1568_fail
+    add rx1568_pos, 1
+  # rx subrule "ws" subtype=method negate=
+    rx1568_cur."!cursor_pos"(rx1568_pos)
+    $P10 = rx1568_cur."ws"()
+    unless $P10, rx1568_fail
+    rx1568_pos = $P10."pos"()
+  # rx subrule "EXPR" subtype=capture negate=
+    rx1568_cur."!cursor_pos"(rx1568_pos)
+    $P10 = rx1568_cur."EXPR"("i=")
+    unless $P10, rx1568_fail
+    rx1568_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("EXPR")
+    rx1568_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1568_cur."!cursor_pos"(rx1568_pos)
+    $P10 = rx1568_cur."ws"()
+    unless $P10, rx1568_fail
+    rx1568_pos = $P10."pos"()
+    set_addr $I10, rxquantr1574_done
+    (rx1568_rep) = rx1568_cur."!mark_commit"($I10)
+  rxquantr1574_done:
+  # rx subrule "ws" subtype=method negate=
+    rx1568_cur."!cursor_pos"(rx1568_pos)
+    $P10 = rx1568_cur."ws"()
+    unless $P10, rx1568_fail
+    rx1568_pos = $P10."pos"()
+.annotate 'line', 366
+  # rx pass
+    rx1568_cur."!cursor_pass"(rx1568_pos, "declarator_name")
+    if_null rx1568_debug, debug_661
+    rx1568_cur."!cursor_debug"("PASS", "declarator_name", " at pos=", rx1568_pos)
+  debug_661:
+    .return (rx1568_cur)
+  rx1568_restart:
+.annotate 'line', 8
+    if_null rx1568_debug, debug_662
+    rx1568_cur."!cursor_debug"("NEXT", "declarator_name")
+  debug_662:
+  rx1568_fail:
+    (rx1568_rep, rx1568_pos, $I10, $P10) = rx1568_cur."!mark_fail"(0)
+    lt rx1568_pos, -1, rx1568_done
+    eq rx1568_pos, -1, rx1568_fail
+    jump $I10
+  rx1568_done:
+    rx1568_cur."!cursor_fail"()
+    if_null rx1568_debug, debug_663
+    rx1568_cur."!cursor_debug"("FAIL", "declarator_name")
+  debug_663:
+    .return (rx1568_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__declarator_name"  :subid("225_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("ws", "")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "pointer"  :subid("226_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1576_tgt
+    .local int rx1576_pos
+    .local int rx1576_off
+    .local int rx1576_eos
+    .local int rx1576_rep
+    .local pmc rx1576_cur
+    .local pmc rx1576_debug
+    (rx1576_cur, rx1576_pos, rx1576_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1576_debug, rx1576_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1576_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1576_eos, rx1576_tgt
+    gt rx1576_pos, rx1576_eos, rx1576_done
+    set rx1576_off, 0
+    lt rx1576_pos, 2, rx1576_start
+    sub rx1576_off, rx1576_pos, 1
+    substr rx1576_tgt, rx1576_tgt, rx1576_off
+  rx1576_start:
+    eq $I10, 1, rx1576_restart
+    if_null rx1576_debug, debug_664
+    rx1576_cur."!cursor_debug"("START", "pointer")
+  debug_664:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1578_done
+    goto rxscan1578_scan
+  rxscan1578_loop:
+    ($P10) = rx1576_cur."from"()
+    inc $P10
+    set rx1576_pos, $P10
+    ge rx1576_pos, rx1576_eos, rxscan1578_done
+  rxscan1578_scan:
+    set_addr $I10, rxscan1578_loop
+    rx1576_cur."!mark_push"(0, rx1576_pos, $I10)
+  rxscan1578_done:
+.annotate 'line', 370
+  # rx subrule "ws" subtype=method negate=
+    rx1576_cur."!cursor_pos"(rx1576_pos)
+    $P10 = rx1576_cur."ws"()
+    unless $P10, rx1576_fail
+    rx1576_pos = $P10."pos"()
+  # rx subrule "star" subtype=capture negate=
+    rx1576_cur."!cursor_pos"(rx1576_pos)
+    $P10 = rx1576_cur."star"()
+    unless $P10, rx1576_fail
+    rx1576_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("star")
+    rx1576_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1576_cur."!cursor_pos"(rx1576_pos)
+    $P10 = rx1576_cur."ws"()
+    unless $P10, rx1576_fail
+    rx1576_pos = $P10."pos"()
+  # rx rxquantr1579 ** 0..1
+    set_addr $I10, rxquantr1579_done
+    rx1576_cur."!mark_push"(0, rx1576_pos, $I10)
+  rxquantr1579_loop:
+  # rx literal  "const"
+    add $I11, rx1576_pos, 5
+    gt $I11, rx1576_eos, rx1576_fail
+    sub $I11, rx1576_pos, rx1576_off
+    substr $S10, rx1576_tgt, $I11, 5
+    ne $S10, "const", rx1576_fail
+    add rx1576_pos, 5
+    set_addr $I10, rxquantr1579_done
+    (rx1576_rep) = rx1576_cur."!mark_commit"($I10)
+  rxquantr1579_done:
+  # rx subrule "ws" subtype=method negate=
+    rx1576_cur."!cursor_pos"(rx1576_pos)
+    $P10 = rx1576_cur."ws"()
+    unless $P10, rx1576_fail
+    rx1576_pos = $P10."pos"()
+  # rx pass
+    rx1576_cur."!cursor_pass"(rx1576_pos, "pointer")
+    if_null rx1576_debug, debug_665
+    rx1576_cur."!cursor_debug"("PASS", "pointer", " at pos=", rx1576_pos)
+  debug_665:
+    .return (rx1576_cur)
+  rx1576_restart:
+.annotate 'line', 8
+    if_null rx1576_debug, debug_666
+    rx1576_cur."!cursor_debug"("NEXT", "pointer")
+  debug_666:
+  rx1576_fail:
+    (rx1576_rep, rx1576_pos, $I10, $P10) = rx1576_cur."!mark_fail"(0)
+    lt rx1576_pos, -1, rx1576_done
+    eq rx1576_pos, -1, rx1576_fail
+    jump $I10
+  rx1576_done:
+    rx1576_cur."!cursor_fail"()
+    if_null rx1576_debug, debug_667
+    rx1576_cur."!cursor_debug"("FAIL", "pointer")
+  debug_667:
+    .return (rx1576_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__pointer"  :subid("227_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("ws", "")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "star"  :subid("228_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1581_tgt
+    .local int rx1581_pos
+    .local int rx1581_off
+    .local int rx1581_eos
+    .local int rx1581_rep
+    .local pmc rx1581_cur
+    .local pmc rx1581_debug
+    (rx1581_cur, rx1581_pos, rx1581_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1581_debug, rx1581_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1581_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1581_eos, rx1581_tgt
+    gt rx1581_pos, rx1581_eos, rx1581_done
+    set rx1581_off, 0
+    lt rx1581_pos, 2, rx1581_start
+    sub rx1581_off, rx1581_pos, 1
+    substr rx1581_tgt, rx1581_tgt, rx1581_off
+  rx1581_start:
+    eq $I10, 1, rx1581_restart
+    if_null rx1581_debug, debug_668
+    rx1581_cur."!cursor_debug"("START", "star")
+  debug_668:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1583_done
+    goto rxscan1583_scan
+  rxscan1583_loop:
+    ($P10) = rx1581_cur."from"()
+    inc $P10
+    set rx1581_pos, $P10
+    ge rx1581_pos, rx1581_eos, rxscan1583_done
+  rxscan1583_scan:
+    set_addr $I10, rxscan1583_loop
+    rx1581_cur."!mark_push"(0, rx1581_pos, $I10)
+  rxscan1583_done:
+.annotate 'line', 371
+  # rx literal  "*"
+    add $I11, rx1581_pos, 1
+    gt $I11, rx1581_eos, rx1581_fail
+    sub $I11, rx1581_pos, rx1581_off
+    ord $I11, rx1581_tgt, $I11
+    ne $I11, 42, rx1581_fail
+    add rx1581_pos, 1
+  # rx pass
+    rx1581_cur."!cursor_pass"(rx1581_pos, "star")
+    if_null rx1581_debug, debug_669
+    rx1581_cur."!cursor_debug"("PASS", "star", " at pos=", rx1581_pos)
+  debug_669:
+    .return (rx1581_cur)
+  rx1581_restart:
+.annotate 'line', 8
+    if_null rx1581_debug, debug_670
+    rx1581_cur."!cursor_debug"("NEXT", "star")
+  debug_670:
+  rx1581_fail:
+    (rx1581_rep, rx1581_pos, $I10, $P10) = rx1581_cur."!mark_fail"(0)
+    lt rx1581_pos, -1, rx1581_done
+    eq rx1581_pos, -1, rx1581_fail
+    jump $I10
+  rx1581_done:
+    rx1581_cur."!cursor_fail"()
+    if_null rx1581_debug, debug_671
+    rx1581_cur."!cursor_debug"("FAIL", "star")
+  debug_671:
+    .return (rx1581_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__star"  :subid("229_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    new $P100, "ResizablePMCArray"
+    push $P100, "*"
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "pointerless_type"  :subid("230_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1585_tgt
+    .local int rx1585_pos
+    .local int rx1585_off
+    .local int rx1585_eos
+    .local int rx1585_rep
+    .local pmc rx1585_cur
+    .local pmc rx1585_debug
+    (rx1585_cur, rx1585_pos, rx1585_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1585_debug, rx1585_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1585_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1585_eos, rx1585_tgt
+    gt rx1585_pos, rx1585_eos, rx1585_done
+    set rx1585_off, 0
+    lt rx1585_pos, 2, rx1585_start
+    sub rx1585_off, rx1585_pos, 1
+    substr rx1585_tgt, rx1585_tgt, rx1585_off
+  rx1585_start:
+    eq $I10, 1, rx1585_restart
+    if_null rx1585_debug, debug_672
+    rx1585_cur."!cursor_debug"("START", "pointerless_type")
+  debug_672:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1587_done
+    goto rxscan1587_scan
+  rxscan1587_loop:
+    ($P10) = rx1585_cur."from"()
+    inc $P10
+    set rx1585_pos, $P10
+    ge rx1585_pos, rx1585_eos, rxscan1587_done
+  rxscan1587_scan:
+    set_addr $I10, rxscan1587_loop
+    rx1585_cur."!mark_push"(0, rx1585_pos, $I10)
+  rxscan1587_done:
+.annotate 'line', 373
+  # rx subrule "ws" subtype=method negate=
+    rx1585_cur."!cursor_pos"(rx1585_pos)
+    $P10 = rx1585_cur."ws"()
+    unless $P10, rx1585_fail
+    rx1585_pos = $P10."pos"()
+.annotate 'line', 374
+  # rx rxquantr1588 ** 0..1
+    set_addr $I10, rxquantr1588_done
+    rx1585_cur."!mark_push"(0, rx1585_pos, $I10)
+  rxquantr1588_loop:
+  # rx literal  "struct"
+    add $I11, rx1585_pos, 6
+    gt $I11, rx1585_eos, rx1585_fail
+    sub $I11, rx1585_pos, rx1585_off
+    substr $S10, rx1585_tgt, $I11, 6
+    ne $S10, "struct", rx1585_fail
+    add rx1585_pos, 6
+    set_addr $I10, rxquantr1588_done
+    (rx1585_rep) = rx1585_cur."!mark_commit"($I10)
+  rxquantr1588_done:
+  # rx subrule "ws" subtype=method negate=
+    rx1585_cur."!cursor_pos"(rx1585_pos)
+    $P10 = rx1585_cur."ws"()
+    unless $P10, rx1585_fail
+    rx1585_pos = $P10."pos"()
+  # rx rxquantr1589 ** 0..1
+    set_addr $I10, rxquantr1589_done
+    rx1585_cur."!mark_push"(0, rx1585_pos, $I10)
+  rxquantr1589_loop:
+  # rx literal  "const"
+    add $I11, rx1585_pos, 5
+    gt $I11, rx1585_eos, rx1585_fail
+    sub $I11, rx1585_pos, rx1585_off
+    substr $S10, rx1585_tgt, $I11, 5
+    ne $S10, "const", rx1585_fail
+    add rx1585_pos, 5
+    set_addr $I10, rxquantr1589_done
+    (rx1585_rep) = rx1585_cur."!mark_commit"($I10)
+  rxquantr1589_done:
+  # rx subrule "ws" subtype=method negate=
+    rx1585_cur."!cursor_pos"(rx1585_pos)
+    $P10 = rx1585_cur."ws"()
+    unless $P10, rx1585_fail
+    rx1585_pos = $P10."pos"()
+  # rx rxquantr1590 ** 0..1
+    set_addr $I10, rxquantr1590_done
+    rx1585_cur."!mark_push"(0, rx1585_pos, $I10)
+  rxquantr1590_loop:
+  # rx literal  "unsigned"
+    add $I11, rx1585_pos, 8
+    gt $I11, rx1585_eos, rx1585_fail
+    sub $I11, rx1585_pos, rx1585_off
+    substr $S10, rx1585_tgt, $I11, 8
+    ne $S10, "unsigned", rx1585_fail
+    add rx1585_pos, 8
+    set_addr $I10, rxquantr1590_done
+    (rx1585_rep) = rx1585_cur."!mark_commit"($I10)
+  rxquantr1590_done:
+  # rx subrule "ws" subtype=method negate=
+    rx1585_cur."!cursor_pos"(rx1585_pos)
+    $P10 = rx1585_cur."ws"()
+    unless $P10, rx1585_fail
+    rx1585_pos = $P10."pos"()
+  # rx subrule "identifier" subtype=capture negate=
+    rx1585_cur."!cursor_pos"(rx1585_pos)
+    $P10 = rx1585_cur."identifier"()
+    unless $P10, rx1585_fail
+    rx1585_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("identifier")
+    rx1585_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1585_cur."!cursor_pos"(rx1585_pos)
+    $P10 = rx1585_cur."ws"()
+    unless $P10, rx1585_fail
+    rx1585_pos = $P10."pos"()
+.annotate 'line', 373
+  # rx pass
+    rx1585_cur."!cursor_pass"(rx1585_pos, "pointerless_type")
+    if_null rx1585_debug, debug_673
+    rx1585_cur."!cursor_debug"("PASS", "pointerless_type", " at pos=", rx1585_pos)
+  debug_673:
+    .return (rx1585_cur)
+  rx1585_restart:
+.annotate 'line', 8
+    if_null rx1585_debug, debug_674
+    rx1585_cur."!cursor_debug"("NEXT", "pointerless_type")
+  debug_674:
+  rx1585_fail:
+    (rx1585_rep, rx1585_pos, $I10, $P10) = rx1585_cur."!mark_fail"(0)
+    lt rx1585_pos, -1, rx1585_done
+    eq rx1585_pos, -1, rx1585_fail
+    jump $I10
+  rx1585_done:
+    rx1585_cur."!cursor_fail"()
+    if_null rx1585_debug, debug_675
+    rx1585_cur."!cursor_debug"("FAIL", "pointerless_type")
+  debug_675:
+    .return (rx1585_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__pointerless_type"  :subid("231_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("ws", "")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "type_declarator"  :subid("232_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1592_tgt
+    .local int rx1592_pos
+    .local int rx1592_off
+    .local int rx1592_eos
+    .local int rx1592_rep
+    .local pmc rx1592_cur
+    .local pmc rx1592_debug
+    (rx1592_cur, rx1592_pos, rx1592_tgt, $I10) = self."!cursor_start"()
+    rx1592_cur."!cursor_caparray"("pointer")
+    getattribute rx1592_debug, rx1592_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1592_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1592_eos, rx1592_tgt
+    gt rx1592_pos, rx1592_eos, rx1592_done
+    set rx1592_off, 0
+    lt rx1592_pos, 2, rx1592_start
+    sub rx1592_off, rx1592_pos, 1
+    substr rx1592_tgt, rx1592_tgt, rx1592_off
+  rx1592_start:
+    eq $I10, 1, rx1592_restart
+    if_null rx1592_debug, debug_676
+    rx1592_cur."!cursor_debug"("START", "type_declarator")
+  debug_676:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1594_done
+    goto rxscan1594_scan
+  rxscan1594_loop:
+    ($P10) = rx1592_cur."from"()
+    inc $P10
+    set rx1592_pos, $P10
+    ge rx1592_pos, rx1592_eos, rxscan1594_done
+  rxscan1594_scan:
+    set_addr $I10, rxscan1594_loop
+    rx1592_cur."!mark_push"(0, rx1592_pos, $I10)
+  rxscan1594_done:
+.annotate 'line', 377
+  # rx subrule "ws" subtype=method negate=
+    rx1592_cur."!cursor_pos"(rx1592_pos)
+    $P10 = rx1592_cur."ws"()
+    unless $P10, rx1592_fail
+    rx1592_pos = $P10."pos"()
+.annotate 'line', 378
+  # rx rxquantr1595 ** 0..1
+    set_addr $I10, rxquantr1595_done
+    rx1592_cur."!mark_push"(0, rx1592_pos, $I10)
+  rxquantr1595_loop:
+  # rx literal  "struct"
+    add $I11, rx1592_pos, 6
+    gt $I11, rx1592_eos, rx1592_fail
+    sub $I11, rx1592_pos, rx1592_off
+    substr $S10, rx1592_tgt, $I11, 6
+    ne $S10, "struct", rx1592_fail
+    add rx1592_pos, 6
+    set_addr $I10, rxquantr1595_done
+    (rx1592_rep) = rx1592_cur."!mark_commit"($I10)
+  rxquantr1595_done:
+  # rx subrule "ws" subtype=method negate=
+    rx1592_cur."!cursor_pos"(rx1592_pos)
+    $P10 = rx1592_cur."ws"()
+    unless $P10, rx1592_fail
+    rx1592_pos = $P10."pos"()
+  # rx rxquantr1596 ** 0..1
+    set_addr $I10, rxquantr1596_done
+    rx1592_cur."!mark_push"(0, rx1592_pos, $I10)
+  rxquantr1596_loop:
+  # rx literal  "const"
+    add $I11, rx1592_pos, 5
+    gt $I11, rx1592_eos, rx1592_fail
+    sub $I11, rx1592_pos, rx1592_off
+    substr $S10, rx1592_tgt, $I11, 5
+    ne $S10, "const", rx1592_fail
+    add rx1592_pos, 5
+    set_addr $I10, rxquantr1596_done
+    (rx1592_rep) = rx1592_cur."!mark_commit"($I10)
+  rxquantr1596_done:
+  # rx subrule "ws" subtype=method negate=
+    rx1592_cur."!cursor_pos"(rx1592_pos)
+    $P10 = rx1592_cur."ws"()
+    unless $P10, rx1592_fail
+    rx1592_pos = $P10."pos"()
+  # rx rxquantr1597 ** 0..1
+    set_addr $I10, rxquantr1597_done
+    rx1592_cur."!mark_push"(0, rx1592_pos, $I10)
+  rxquantr1597_loop:
+  # rx literal  "unsigned"
+    add $I11, rx1592_pos, 8
+    gt $I11, rx1592_eos, rx1592_fail
+    sub $I11, rx1592_pos, rx1592_off
+    substr $S10, rx1592_tgt, $I11, 8
+    ne $S10, "unsigned", rx1592_fail
+    add rx1592_pos, 8
+    set_addr $I10, rxquantr1597_done
+    (rx1592_rep) = rx1592_cur."!mark_commit"($I10)
+  rxquantr1597_done:
+  # rx subrule "ws" subtype=method negate=
+    rx1592_cur."!cursor_pos"(rx1592_pos)
+    $P10 = rx1592_cur."ws"()
+    unless $P10, rx1592_fail
+    rx1592_pos = $P10."pos"()
+  # rx subrule "identifier" subtype=capture negate=
+    rx1592_cur."!cursor_pos"(rx1592_pos)
+    $P10 = rx1592_cur."identifier"()
+    unless $P10, rx1592_fail
+    rx1592_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("identifier")
+    rx1592_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1592_cur."!cursor_pos"(rx1592_pos)
+    $P10 = rx1592_cur."ws"()
+    unless $P10, rx1592_fail
+    rx1592_pos = $P10."pos"()
+  # rx rxquantr1598 ** 0..*
+    set_addr $I10, rxquantr1598_done
+    rx1592_cur."!mark_push"(0, rx1592_pos, $I10)
+  rxquantr1598_loop:
+  # rx subrule "pointer" subtype=capture negate=
+    rx1592_cur."!cursor_pos"(rx1592_pos)
+    $P10 = rx1592_cur."pointer"()
+    unless $P10, rx1592_fail
+    goto rxsubrule1599_pass
+  rxsubrule1599_back:
+    $P10 = $P10."!cursor_next"()
+    unless $P10, rx1592_fail
+  rxsubrule1599_pass:
+    set_addr $I10, rxsubrule1599_back
+    rx1592_cur."!mark_push"(0, rx1592_pos, $I10, $P10)
+    $P10."!cursor_names"("pointer")
+    rx1592_pos = $P10."pos"()
+    set_addr $I10, rxquantr1598_done
+    (rx1592_rep) = rx1592_cur."!mark_commit"($I10)
+    set_addr $I10, rxquantr1598_done
+    rx1592_cur."!mark_push"(rx1592_rep, rx1592_pos, $I10)
+    goto rxquantr1598_loop
+  rxquantr1598_done:
+  # rx subrule "ws" subtype=method negate=
+    rx1592_cur."!cursor_pos"(rx1592_pos)
+    $P10 = rx1592_cur."ws"()
+    unless $P10, rx1592_fail
+    rx1592_pos = $P10."pos"()
+.annotate 'line', 377
+  # rx pass
+    rx1592_cur."!cursor_pass"(rx1592_pos, "type_declarator")
+    if_null rx1592_debug, debug_677
+    rx1592_cur."!cursor_debug"("PASS", "type_declarator", " at pos=", rx1592_pos)
+  debug_677:
+    .return (rx1592_cur)
+  rx1592_restart:
+.annotate 'line', 8
+    if_null rx1592_debug, debug_678
+    rx1592_cur."!cursor_debug"("NEXT", "type_declarator")
+  debug_678:
+  rx1592_fail:
+    (rx1592_rep, rx1592_pos, $I10, $P10) = rx1592_cur."!mark_fail"(0)
+    lt rx1592_pos, -1, rx1592_done
+    eq rx1592_pos, -1, rx1592_fail
+    jump $I10
+  rx1592_done:
+    rx1592_cur."!cursor_fail"()
+    if_null rx1592_debug, debug_679
+    rx1592_cur."!cursor_debug"("FAIL", "type_declarator")
+  debug_679:
+    .return (rx1592_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__type_declarator"  :subid("233_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("ws", "")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "eat_terminator"  :subid("234_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1601_tgt
+    .local int rx1601_pos
+    .local int rx1601_off
+    .local int rx1601_eos
+    .local int rx1601_rep
+    .local pmc rx1601_cur
+    .local pmc rx1601_debug
+    (rx1601_cur, rx1601_pos, rx1601_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1601_debug, rx1601_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1601_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1601_eos, rx1601_tgt
+    gt rx1601_pos, rx1601_eos, rx1601_done
+    set rx1601_off, 0
+    lt rx1601_pos, 2, rx1601_start
+    sub rx1601_off, rx1601_pos, 1
+    substr rx1601_tgt, rx1601_tgt, rx1601_off
+  rx1601_start:
+    eq $I10, 1, rx1601_restart
+    if_null rx1601_debug, debug_680
+    rx1601_cur."!cursor_debug"("START", "eat_terminator")
+  debug_680:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1603_done
+    goto rxscan1603_scan
+  rxscan1603_loop:
+    ($P10) = rx1601_cur."from"()
+    inc $P10
+    set rx1601_pos, $P10
+    ge rx1601_pos, rx1601_eos, rxscan1603_done
+  rxscan1603_scan:
+    set_addr $I10, rxscan1603_loop
+    rx1601_cur."!mark_push"(0, rx1601_pos, $I10)
+  rxscan1603_done:
+  alt1604_0:
+.annotate 'line', 381
+    set_addr $I10, alt1604_1
+    rx1601_cur."!mark_push"(0, rx1601_pos, $I10)
+.annotate 'line', 382
+  # rx literal  ";"
+    add $I11, rx1601_pos, 1
+    gt $I11, rx1601_eos, rx1601_fail
+    sub $I11, rx1601_pos, rx1601_off
+    ord $I11, rx1601_tgt, $I11
+    ne $I11, 59, rx1601_fail
+    add rx1601_pos, 1
+    goto alt1604_end
+  alt1604_1:
+    set_addr $I10, alt1604_2
+    rx1601_cur."!mark_push"(0, rx1601_pos, $I10)
+.annotate 'line', 383
+  # rx subrule "MARKED" subtype=zerowidth negate=
+    rx1601_cur."!cursor_pos"(rx1601_pos)
+    $P10 = rx1601_cur."MARKED"("endstmt")
+    unless $P10, rx1601_fail
+    goto alt1604_end
+  alt1604_2:
+    set_addr $I10, alt1604_3
+    rx1601_cur."!mark_push"(0, rx1601_pos, $I10)
+.annotate 'line', 384
+  # rxanchor eos
+    ne rx1601_pos, rx1601_eos, rx1601_fail
+    goto alt1604_end
+  alt1604_3:
+.annotate 'line', 385
+  # rx subrule "panic" subtype=method negate=
+    rx1601_cur."!cursor_pos"(rx1601_pos)
+    $P10 = rx1601_cur."panic"("Statement not properly terminated")
+    unless $P10, rx1601_fail
+    rx1601_pos = $P10."pos"()
+  alt1604_end:
+.annotate 'line', 381
+  # rx pass
+    rx1601_cur."!cursor_pass"(rx1601_pos, "eat_terminator")
+    if_null rx1601_debug, debug_681
+    rx1601_cur."!cursor_debug"("PASS", "eat_terminator", " at pos=", rx1601_pos)
+  debug_681:
+    .return (rx1601_cur)
+  rx1601_restart:
+.annotate 'line', 8
+    if_null rx1601_debug, debug_682
+    rx1601_cur."!cursor_debug"("NEXT", "eat_terminator")
+  debug_682:
+  rx1601_fail:
+    (rx1601_rep, rx1601_pos, $I10, $P10) = rx1601_cur."!mark_fail"(0)
+    lt rx1601_pos, -1, rx1601_done
+    eq rx1601_pos, -1, rx1601_fail
+    jump $I10
+  rx1601_done:
+    rx1601_cur."!cursor_fail"()
+    if_null rx1601_debug, debug_683
+    rx1601_cur."!cursor_debug"("FAIL", "eat_terminator")
+  debug_683:
+    .return (rx1601_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__eat_terminator"  :subid("235_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    $P100 = self."!PREFIX__!subrule"("panic", "")
+    new $P101, "ResizablePMCArray"
+    push $P101, $P100
+    push $P101, ""
+    push $P101, ""
+    push $P101, ";"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "pod_ws"  :subid("236_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1606_tgt
+    .local int rx1606_pos
+    .local int rx1606_off
+    .local int rx1606_eos
+    .local int rx1606_rep
+    .local pmc rx1606_cur
+    .local pmc rx1606_debug
+    (rx1606_cur, rx1606_pos, rx1606_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1606_debug, rx1606_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1606_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1606_eos, rx1606_tgt
+    gt rx1606_pos, rx1606_eos, rx1606_done
+    set rx1606_off, 0
+    lt rx1606_pos, 2, rx1606_start
+    sub rx1606_off, rx1606_pos, 1
+    substr rx1606_tgt, rx1606_tgt, rx1606_off
+  rx1606_start:
+    eq $I10, 1, rx1606_restart
+    if_null rx1606_debug, debug_684
+    rx1606_cur."!cursor_debug"("START", "pod_ws")
+  debug_684:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1608_done
+    goto rxscan1608_scan
+  rxscan1608_loop:
+    ($P10) = rx1606_cur."from"()
+    inc $P10
+    set rx1606_pos, $P10
+    ge rx1606_pos, rx1606_eos, rxscan1608_done
+  rxscan1608_scan:
+    set_addr $I10, rxscan1608_loop
+    rx1606_cur."!mark_push"(0, rx1606_pos, $I10)
+  rxscan1608_done:
+.annotate 'line', 393
+  # rx rxquantr1609 ** 0..*
+    set_addr $I10, rxquantr1609_done
+    rx1606_cur."!mark_push"(0, rx1606_pos, $I10)
+  rxquantr1609_loop:
+  alt1610_0:
+.annotate 'line', 389
+    set_addr $I10, alt1610_1
+    rx1606_cur."!mark_push"(0, rx1606_pos, $I10)
+.annotate 'line', 390
+  # rx charclass_q s r 1..-1
+    sub $I10, rx1606_pos, rx1606_off
+    find_not_cclass $I11, 32, rx1606_tgt, $I10, rx1606_eos
+    add $I12, $I10, 1
+    lt $I11, $I12, rx1606_fail
+    add rx1606_pos, rx1606_off, $I11
+    goto alt1610_end
+  alt1610_1:
+    set_addr $I10, alt1610_2
+    rx1606_cur."!mark_push"(0, rx1606_pos, $I10)
+.annotate 'line', 391
+  # rx literal  "#"
+    add $I11, rx1606_pos, 1
+    gt $I11, rx1606_eos, rx1606_fail
+    sub $I11, rx1606_pos, rx1606_off
+    ord $I11, rx1606_tgt, $I11
+    ne $I11, 35, rx1606_fail
+    add rx1606_pos, 1
+  # rx charclass_q N r 0..-1
+    sub $I10, rx1606_pos, rx1606_off
+    find_cclass $I11, 4096, rx1606_tgt, $I10, rx1606_eos
+    add rx1606_pos, rx1606_off, $I11
+    goto alt1610_end
+  alt1610_2:
+.annotate 'line', 392
+  # rxanchor bol
+    eq rx1606_pos, 0, rxanchor1611_done
+    ge rx1606_pos, rx1606_eos, rx1606_fail
+    sub $I10, rx1606_pos, rx1606_off
+    dec $I10
+    is_cclass $I11, 4096, rx1606_tgt, $I10
+    unless $I11, rx1606_fail
+  rxanchor1611_done:
+  # rx literal  "="
+    add $I11, rx1606_pos, 1
+    gt $I11, rx1606_eos, rx1606_fail
+    sub $I11, rx1606_pos, rx1606_off
+    ord $I11, rx1606_tgt, $I11
+    ne $I11, 61, rx1606_fail
+    add rx1606_pos, 1
+  # rx rxquantf1612 ** 0..*
+    set_addr $I10, rxquantf1612_loop
+    rx1606_cur."!mark_push"(0, rx1606_pos, $I10)
+    goto rxquantf1612_done
+  rxquantf1612_loop:
+  # rx charclass .
+    ge rx1606_pos, rx1606_eos, rx1606_fail
+    inc rx1606_pos
+    set_addr $I10, rxquantf1612_loop
+    rx1606_cur."!mark_push"(rx1606_rep, rx1606_pos, $I10)
+  rxquantf1612_done:
+  # rx charclass nl
+    ge rx1606_pos, rx1606_eos, rx1606_fail
+    sub $I10, rx1606_pos, rx1606_off
+    is_cclass $I11, 4096, rx1606_tgt, $I10
+    unless $I11, rx1606_fail
+    substr $S10, rx1606_tgt, $I10, 2
+    iseq $I11, $S10, "\r\n"
+    add rx1606_pos, $I11
+    inc rx1606_pos
+  # rx literal  "=cut"
+    add $I11, rx1606_pos, 4
+    gt $I11, rx1606_eos, rx1606_fail
+    sub $I11, rx1606_pos, rx1606_off
+    substr $S10, rx1606_tgt, $I11, 4
+    ne $S10, "=cut", rx1606_fail
+    add rx1606_pos, 4
+  alt1610_end:
+.annotate 'line', 393
+    set_addr $I10, rxquantr1609_done
+    (rx1606_rep) = rx1606_cur."!mark_commit"($I10)
+    set_addr $I10, rxquantr1609_done
+    rx1606_cur."!mark_push"(rx1606_rep, rx1606_pos, $I10)
+    goto rxquantr1609_loop
+  rxquantr1609_done:
+.annotate 'line', 388
+  # rx pass
+    rx1606_cur."!cursor_pass"(rx1606_pos, "pod_ws")
+    if_null rx1606_debug, debug_685
+    rx1606_cur."!cursor_debug"("PASS", "pod_ws", " at pos=", rx1606_pos)
+  debug_685:
+    .return (rx1606_cur)
+  rx1606_restart:
+.annotate 'line', 8
+    if_null rx1606_debug, debug_686
+    rx1606_cur."!cursor_debug"("NEXT", "pod_ws")
+  debug_686:
+  rx1606_fail:
+    (rx1606_rep, rx1606_pos, $I10, $P10) = rx1606_cur."!mark_fail"(0)
+    lt rx1606_pos, -1, rx1606_done
+    eq rx1606_pos, -1, rx1606_fail
+    jump $I10
+  rx1606_done:
+    rx1606_cur."!cursor_fail"()
+    if_null rx1606_debug, debug_687
+    rx1606_cur."!cursor_debug"("FAIL", "pod_ws")
+  debug_687:
+    .return (rx1606_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__pod_ws"  :subid("237_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    new $P100, "ResizablePMCArray"
+    push $P100, ""
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "ws"  :subid("238_1792415686.23593") :method :outer("11_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .local string rx1615_tgt
+    .local int rx1615_pos
+    .local int rx1615_off
+    .local int rx1615_eos
+    .local int rx1615_rep
+    .local pmc rx1615_cur
+    .local pmc rx1615_debug
+    (rx1615_cur, rx1615_pos, rx1615_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1615_debug, rx1615_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1615_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1615_eos, rx1615_tgt
+    gt rx1615_pos, rx1615_eos, rx1615_done
+    set rx1615_off, 0
+    lt rx1615_pos, 2, rx1615_start
+    sub rx1615_off, rx1615_pos, 1
+    substr rx1615_tgt, rx1615_tgt, rx1615_off
+  rx1615_start:
+    eq $I10, 1, rx1615_restart
+    if_null rx1615_debug, debug_688
+    rx1615_cur."!cursor_debug"("START", "ws")
+  debug_688:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1617_done
+    goto rxscan1617_scan
+  rxscan1617_loop:
+    ($P10) = rx1615_cur."from"()
+    inc $P10
+    set rx1615_pos, $P10
+    ge rx1615_pos, rx1615_eos, rxscan1617_done
+  rxscan1617_scan:
+    set_addr $I10, rxscan1617_loop
+    rx1615_cur."!mark_push"(0, rx1615_pos, $I10)
+  rxscan1617_done:
+.annotate 'line', 401
+  # rx rxquantr1618 ** 0..*
+    set_addr $I10, rxquantr1618_done
+    rx1615_cur."!mark_push"(0, rx1615_pos, $I10)
+  rxquantr1618_loop:
+  alt1619_0:
+.annotate 'line', 398
+    set_addr $I10, alt1619_1
+    rx1615_cur."!mark_push"(0, rx1615_pos, $I10)
+.annotate 'line', 399
+  # rx charclass_q s r 1..-1
+    sub $I10, rx1615_pos, rx1615_off
+    find_not_cclass $I11, 32, rx1615_tgt, $I10, rx1615_eos
+    add $I12, $I10, 1
+    lt $I11, $I12, rx1615_fail
+    add rx1615_pos, rx1615_off, $I11
+    goto alt1619_end
+  alt1619_1:
+.annotate 'line', 400
+  # rx literal  "/*"
+    add $I11, rx1615_pos, 2
+    gt $I11, rx1615_eos, rx1615_fail
+    sub $I11, rx1615_pos, rx1615_off
+    substr $S10, rx1615_tgt, $I11, 2
+    ne $S10, "/*", rx1615_fail
+    add rx1615_pos, 2
+  # rx rxquantf1620 ** 0..*
+    set_addr $I10, rxquantf1620_loop
+    rx1615_cur."!mark_push"(0, rx1615_pos, $I10)
+    goto rxquantf1620_done
+  rxquantf1620_loop:
+  # rx charclass .
+    ge rx1615_pos, rx1615_eos, rx1615_fail
+    inc rx1615_pos
+    set_addr $I10, rxquantf1620_loop
+    rx1615_cur."!mark_push"(rx1615_rep, rx1615_pos, $I10)
+  rxquantf1620_done:
+  # rx literal  "*/"
+    add $I11, rx1615_pos, 2
+    gt $I11, rx1615_eos, rx1615_fail
+    sub $I11, rx1615_pos, rx1615_off
+    substr $S10, rx1615_tgt, $I11, 2
+    ne $S10, "*/", rx1615_fail
+    add rx1615_pos, 2
+  alt1619_end:
+.annotate 'line', 401
+    set_addr $I10, rxquantr1618_done
+    (rx1615_rep) = rx1615_cur."!mark_commit"($I10)
+    set_addr $I10, rxquantr1618_done
+    rx1615_cur."!mark_push"(rx1615_rep, rx1615_pos, $I10)
+    goto rxquantr1618_loop
+  rxquantr1618_done:
+.annotate 'line', 397
+  # rx pass
+    rx1615_cur."!cursor_pass"(rx1615_pos, "ws")
+    if_null rx1615_debug, debug_689
+    rx1615_cur."!cursor_debug"("PASS", "ws", " at pos=", rx1615_pos)
+  debug_689:
+    .return (rx1615_cur)
+  rx1615_restart:
+.annotate 'line', 8
+    if_null rx1615_debug, debug_690
+    rx1615_cur."!cursor_debug"("NEXT", "ws")
+  debug_690:
+  rx1615_fail:
+    (rx1615_rep, rx1615_pos, $I10, $P10) = rx1615_cur."!mark_fail"(0)
+    lt rx1615_pos, -1, rx1615_done
+    eq rx1615_pos, -1, rx1615_fail
+    jump $I10
+  rx1615_done:
+    rx1615_cur."!cursor_fail"()
+    if_null rx1615_debug, debug_691
+    rx1615_cur."!cursor_debug"("FAIL", "ws")
+  debug_691:
+    .return (rx1615_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "!PREFIX__ws"  :subid("239_1792415686.23593") :method
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    new $P100, "ResizablePMCArray"
+    push $P100, ""
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Compiler";"Grammar"]
+.sub "_block1622" :load :anon :subid("240_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 8
+    .const '' $P1624 = "11_1792415686.23593" 
+    $P100 = $P1624()
+    .return ($P100)
+.end
+
+
+.namespace []
+.sub "_block1625" :load :anon :subid("241_1792415686.23593")
+.annotate 'file', "compilers/opsc/src/Ops/Compiler/Grammar.pm"
+.annotate 'line', 1
+    .const '' $P1627 = "10_1792415686.23593" 
+    $P100 = $P1627()
+    .return ($P100)
+.end
+
@@ -0,0 +1,2749 @@
+
+.namespace []
+.sub "_block1000"  :anon :subid("10_1792415682.41389")
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 0
+    .const 'Sub' $P1003 = "11_1792415682.41389" 
+    capture_lex $P1003
+.annotate 'line', 1
+    $P0 = find_dynamic_lex "$*CTXSAVE"
+    if null $P0 goto ctxsave_done
+    $I0 = can $P0, "ctxsave"
+    unless $I0 goto ctxsave_done
+    $P0."ctxsave"()
+  ctxsave_done:
+.annotate 'line', 12
+    .const 'Sub' $P1003 = "11_1792415682.41389" 
+    capture_lex $P1003
+    $P101 = $P1003()
+.annotate 'line', 1
+    .return ($P101)
+    .const 'Sub' $P1269 = "53_1792415682.41389" 
+    .return ($P1269)
+.end
+
+
+.namespace []
+.sub "" :load :init :subid("post54") :outer("10_1792415682.41389")
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 0
+    .const 'Sub' $P1001 = "10_1792415682.41389" 
+    .local pmc block
+    set block, $P1001
+    $P1271 = get_root_global ["parrot"], "P6metaclass"
+    $P1271."new_class"("Ops::Emitter", "Hash" :named("parent"))
+.end
+
+
+.namespace ["Ops";"Emitter"]
+.sub "_block1002"  :subid("11_1792415682.41389") :outer("10_1792415682.41389")
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 12
+    .const 'Sub' $P1257 = "51_1792415682.41389" 
+    capture_lex $P1257
+    .const 'Sub' $P1252 = "50_1792415682.41389" 
+    capture_lex $P1252
+    .const 'Sub' $P1248 = "49_1792415682.41389" 
+    capture_lex $P1248
+    .const 'Sub' $P1242 = "48_1792415682.41389" 
+    capture_lex $P1242
+    .const 'Sub' $P1236 = "47_1792415682.41389" 
+    capture_lex $P1236
+    .const 'Sub' $P1210 = "44_1792415682.41389" 
+    capture_lex $P1210
+    .const 'Sub' $P1204 = "43_1792415682.41389" 
+    capture_lex $P1204
+    .const 'Sub' $P1197 = "42_1792415682.41389" 
+    capture_lex $P1197
+    .const 'Sub' $P1192 = "41_1792415682.41389" 
+    capture_lex $P1192
+    .const 'Sub' $P1187 = "40_1792415682.41389" 
+    capture_lex $P1187
+    .const 'Sub' $P1176 = "38_1792415682.41389" 
+    capture_lex $P1176
+    .const 'Sub' $P1172 = "37_1792415682.41389" 
+    capture_lex $P1172
+    .const 'Sub' $P1164 = "36_1792415682.41389" 
+    capture_lex $P1164
+    .const 'Sub' $P1149 = "33_1792415682.41389" 
+    capture_lex $P1149
+    .const 'Sub' $P1144 = "32_1792415682.41389" 
+    capture_lex $P1144
+    .const 'Sub' $P1137 = "31_1792415682.41389" 
+    capture_lex $P1137
+    .const 'Sub' $P1131 = "30_1792415682.41389" 
+    capture_lex $P1131
+    .const 'Sub' $P1125 = "29_1792415682.41389" 
+    capture_lex $P1125
+    .const 'Sub' $P1114 = "28_1792415682.41389" 
+    capture_lex $P1114
+    .const 'Sub' $P1110 = "27_1792415682.41389" 
+    capture_lex $P1110
+    .const 'Sub' $P1106 = "26_1792415682.41389" 
+    capture_lex $P1106
+    .const 'Sub' $P1102 = "25_1792415682.41389" 
+    capture_lex $P1102
+    .const 'Sub' $P1098 = "24_1792415682.41389" 
+    capture_lex $P1098
+    .const 'Sub' $P1094 = "23_1792415682.41389" 
+    capture_lex $P1094
+    .const 'Sub' $P1090 = "22_1792415682.41389" 
+    capture_lex $P1090
+    .const 'Sub' $P1086 = "21_1792415682.41389" 
+    capture_lex $P1086
+    .const 'Sub' $P1082 = "20_1792415682.41389" 
+    capture_lex $P1082
+    .const 'Sub' $P1078 = "19_1792415682.41389" 
+    capture_lex $P1078
+    .const 'Sub' $P1074 = "18_1792415682.41389" 
+    capture_lex $P1074
+    .const 'Sub' $P1004 = "12_1792415682.41389" 
+    capture_lex $P1004
+    $P0 = find_dynamic_lex "$*CTXSAVE"
+    if null $P0 goto ctxsave_done
+    $I0 = can $P0, "ctxsave"
+    unless $I0 goto ctxsave_done
+    $P0."ctxsave"()
+  ctxsave_done:
+    load_bytecode "config.pbc"
+.annotate 'line', 372
+    .const 'Sub' $P1257 = "51_1792415682.41389" 
+    newclosure $P1264, $P1257
+.annotate 'line', 12
+    .return ($P1264)
+    .const 'Sub' $P1266 = "52_1792415682.41389" 
+    .return ($P1266)
+.end
+
+
+.namespace ["Ops";"Emitter"]
+.include "except_types.pasm"
+.sub "new"  :subid("12_1792415682.41389") :method :outer("11_1792415682.41389")
+    .param pmc param_1007 :named("ops_file")
+    .param pmc param_1008 :named("trans")
+    .param pmc param_1009 :named("script")
+    .param pmc param_1011 :named("flags")
+    .param pmc param_1010 :optional :named("file")
+    .param int has_param_1010 :opt_flag
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 14
+    .const 'Sub' $P1058 = "16_1792415682.41389" 
+    capture_lex $P1058
+    .const 'Sub' $P1039 = "15_1792415682.41389" 
+    capture_lex $P1039
+    .const 'Sub' $P1034 = "14_1792415682.41389" 
+    capture_lex $P1034
+    .const 'Sub' $P1029 = "13_1792415682.41389" 
+    capture_lex $P1029
+    new $P1006, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1006, control_1005
+    push_eh $P1006
+    .lex "self", self
+    .lex "$ops_file", param_1007
+    .lex "$trans", param_1008
+    .lex "$script", param_1009
+    if has_param_1010, optparam_55
+    new $P100, "Undef"
+    set param_1010, $P100
+  optparam_55:
+    .lex "$file", param_1010
+    .lex "%flags", param_1011
+.annotate 'line', 23
+    new $P101, "Undef"
+    set $P1012, $P101
+    .lex "$suffix", $P1012
+.annotate 'line', 24
+    new $P102, "Undef"
+    set $P1013, $P102
+    .lex "$base", $P1013
+.annotate 'line', 32
+    new $P103, "Undef"
+    set $P1014, $P103
+    .lex "$base_ops_stub", $P1014
+.annotate 'line', 33
+    new $P104, "Undef"
+    set $P1015, $P104
+    .lex "$base_ops_h", $P1015
+.annotate 'line', 15
+    find_lex $P105, "$ops_file"
+    find_lex $P1016, "self"
+    unless_null $P1016, vivify_56
+    $P1016 = root_new ['parrot';'Hash']
+    store_lex "self", $P1016
+  vivify_56:
+    set $P1016["ops_file"], $P105
+.annotate 'line', 16
+    find_lex $P105, "$trans"
+    find_lex $P1017, "self"
+    unless_null $P1017, vivify_57
+    $P1017 = root_new ['parrot';'Hash']
+    store_lex "self", $P1017
+  vivify_57:
+    set $P1017["trans"], $P105
+.annotate 'line', 17
+    find_lex $P105, "$script"
+    find_lex $P1018, "self"
+    unless_null $P1018, vivify_58
+    $P1018 = root_new ['parrot';'Hash']
+    store_lex "self", $P1018
+  vivify_58:
+    set $P1018["script"], $P105
+.annotate 'line', 18
+    find_lex $P105, "$file"
+    find_lex $P1019, "self"
+    unless_null $P1019, vivify_59
+    $P1019 = root_new ['parrot';'Hash']
+    store_lex "self", $P1019
+  vivify_59:
+    set $P1019["file"], $P105
+.annotate 'line', 19
+    find_lex $P105, "%flags"
+    find_lex $P1020, "self"
+    unless_null $P1020, vivify_60
+    $P1020 = root_new ['parrot';'Hash']
+    store_lex "self", $P1020
+  vivify_60:
+    set $P1020["flags"], $P105
+.annotate 'line', 20
+    find_lex $P1022, "%flags"
+    unless_null $P1022, vivify_61
+    $P1022 = root_new ['parrot';'Hash']
+  vivify_61:
+    set $P105, $P1022["quiet"]
+    unless_null $P105, vivify_62
+    new $P105, "Undef"
+  vivify_62:
+    set $P1021, $P105
+    defined $I1024, $P1021
+    if $I1024, default_1023
+    new $P106, "Integer"
+    assign $P106, 0
+    set $P1021, $P106
+  default_1023:
+    find_lex $P1025, "self"
+    unless_null $P1025, vivify_63
+    $P1025 = root_new ['parrot';'Hash']
+    store_lex "self", $P1025
+  vivify_63:
+    set $P1025["quiet"], $P1021
+.annotate 'line', 23
+    find_lex $P105, "$trans"
+    $P106 = $P105."suffix"()
+    store_lex "$suffix", $P106
+.annotate 'line', 24
+    new $P105, "String"
+    assign $P105, "core"
+    store_lex "$base", $P105
+.annotate 'line', 26
+    find_lex $P1027, "%flags"
+    unless_null $P1027, vivify_64
+    $P1027 = root_new ['parrot';'Hash']
+  vivify_64:
+    set $P105, $P1027["core"]
+    unless_null $P105, vivify_65
+    new $P105, "Undef"
+  vivify_65:
+    isfalse $I100, $P105
+    unless $I100, if_1026_end
+.annotate 'line', 27
+    find_lex $P106, "$file"
+    get_hll_global $P107, ["Regex"], "Regex"
+    .const 'Sub' $P1029 = "13_1792415682.41389" 
+    capture_lex $P1029
+    $P108 = $P107."new"($P1029)
+    $P109 = "subst"($P106, $P108, "")
+    store_lex "$base", $P109
+.annotate 'line', 28
+    find_lex $P106, "$base"
+    get_hll_global $P107, ["Regex"], "Regex"
+    .const 'Sub' $P1034 = "14_1792415682.41389" 
+    capture_lex $P1034
+    $P108 = $P107."new"($P1034)
+    $P109 = "subst"($P106, $P108, "")
+    store_lex "$base", $P109
+.annotate 'line', 29
+    find_lex $P106, "$base"
+    get_hll_global $P107, ["Regex"], "Regex"
+    .const 'Sub' $P1039 = "15_1792415682.41389" 
+    capture_lex $P1039
+    $P108 = $P107."new"($P1039)
+    $P109 = "subst"($P106, $P108, "")
+    store_lex "$base", $P109
+  if_1026_end:
+.annotate 'line', 32
+    find_lex $P105, "$base"
+    concat $P106, $P105, "_ops"
+    find_lex $P107, "$suffix"
+    concat $P108, $P106, $P107
+    store_lex "$base_ops_stub", $P108
+.annotate 'line', 33
+    find_lex $P105, "$base_ops_stub"
+    concat $P106, $P105, ".h"
+    store_lex "$base_ops_h", $P106
+.annotate 'line', 35
+    find_lex $P105, "$base"
+    find_lex $P1043, "self"
+    unless_null $P1043, vivify_78
+    $P1043 = root_new ['parrot';'Hash']
+    store_lex "self", $P1043
+  vivify_78:
+    set $P1043["base"], $P105
+.annotate 'line', 36
+    find_lex $P105, "$suffix"
+    find_lex $P1044, "self"
+    unless_null $P1044, vivify_79
+    $P1044 = root_new ['parrot';'Hash']
+    store_lex "self", $P1044
+  vivify_79:
+    set $P1044["suffix"], $P105
+.annotate 'line', 37
+    find_lex $P105, "$base"
+    find_lex $P106, "$suffix"
+    concat $P107, $P105, $P106
+    concat $P108, $P107, "_"
+    find_lex $P1045, "self"
+    unless_null $P1045, vivify_80
+    $P1045 = root_new ['parrot';'Hash']
+    store_lex "self", $P1045
+  vivify_80:
+    set $P1045["bs"], $P108
+.annotate 'line', 39
+    find_lex $P1047, "%flags"
+    unless_null $P1047, vivify_81
+    $P1047 = root_new ['parrot';'Hash']
+  vivify_81:
+    set $P105, $P1047["core"]
+    unless_null $P105, vivify_82
+    new $P105, "Undef"
+  vivify_82:
+    if $P105, if_1046
+.annotate 'line', 46
+    .const 'Sub' $P1058 = "16_1792415682.41389" 
+    capture_lex $P1058
+    $P1058()
+    goto if_1046_end
+  if_1046:
+.annotate 'line', 40
+    new $P106, 'String'
+    set $P106, "parrot/oplib/"
+    find_lex $P107, "$base_ops_h"
+    concat $P108, $P106, $P107
+    find_lex $P1048, "self"
+    unless_null $P1048, vivify_93
+    $P1048 = root_new ['parrot';'Hash']
+    store_lex "self", $P1048
+  vivify_93:
+    set $P1048["include"], $P108
+.annotate 'line', 41
+    find_lex $P1049, "%flags"
+    unless_null $P1049, vivify_94
+    $P1049 = root_new ['parrot';'Hash']
+  vivify_94:
+    set $P106, $P1049["dir"]
+    unless_null $P106, vivify_95
+    new $P106, "Undef"
+  vivify_95:
+    set $S100, $P106
+    new $P107, 'String'
+    set $P107, $S100
+    concat $P108, $P107, "include/"
+    find_lex $P1050, "self"
+    unless_null $P1050, vivify_96
+    $P1050 = root_new ['parrot';'Hash']
+  vivify_96:
+    set $P109, $P1050["include"]
+    unless_null $P109, vivify_97
+    new $P109, "Undef"
+  vivify_97:
+    concat $P110, $P108, $P109
+    find_lex $P1051, "self"
+    unless_null $P1051, vivify_98
+    $P1051 = root_new ['parrot';'Hash']
+    store_lex "self", $P1051
+  vivify_98:
+    set $P1051["func_header"], $P110
+.annotate 'line', 42
+    find_lex $P1052, "%flags"
+    unless_null $P1052, vivify_99
+    $P1052 = root_new ['parrot';'Hash']
+  vivify_99:
+    set $P106, $P1052["dir"]
+    unless_null $P106, vivify_100
+    new $P106, "Undef"
+  vivify_100:
+    set $S100, $P106
+    new $P107, 'String'
+    set $P107, $S100
+    concat $P108, $P107, "include/parrot/oplib/ops.h"
+    find_lex $P1053, "self"
+    unless_null $P1053, vivify_101
+    $P1053 = root_new ['parrot';'Hash']
+    store_lex "self", $P1053
+  vivify_101:
+    set $P1053["enum_header"], $P108
+.annotate 'line', 43
+    find_lex $P1054, "%flags"
+    unless_null $P1054, vivify_102
+    $P1054 = root_new ['parrot';'Hash']
+  vivify_102:
+    set $P106, $P1054["dir"]
+    unless_null $P106, vivify_103
+    new $P106, "Undef"
+  vivify_103:
+    set $S100, $P106
+    new $P107, 'String'
+    set $P107, $S100
+    new $P108, 'String'
+    set $P108, "src/ops/"
+    find_lex $P109, "$base_ops_stub"
+    concat $P110, $P108, $P109
+    concat $P111, $P110, ".c"
+    concat $P112, $P107, $P111
+    find_lex $P1055, "self"
+    unless_null $P1055, vivify_104
+    $P1055 = root_new ['parrot';'Hash']
+    store_lex "self", $P1055
+  vivify_104:
+    set $P1055["source"], $P112
+.annotate 'line', 44
+    $P106 = "join"("_", "PARROT", "CORE", "OPLIB", "INIT")
+    find_lex $P1056, "self"
+    unless_null $P1056, vivify_105
+    $P1056 = root_new ['parrot';'Hash']
+    store_lex "self", $P1056
+  vivify_105:
+    set $P1056["init_func"], $P106
+  if_1046_end:
+.annotate 'line', 55
+    find_lex $P1072, "%flags"
+    unless_null $P1072, vivify_106
+    $P1072 = root_new ['parrot';'Hash']
+  vivify_106:
+    set $P106, $P1072["core"]
+    unless_null $P106, vivify_107
+    new $P106, "Undef"
+  vivify_107:
+    if $P106, if_1071
+    new $P108, "String"
+    assign $P108, "PARROT_DYNEXT_EXPORT"
+    set $P105, $P108
+    goto if_1071_end
+  if_1071:
+    new $P107, "String"
+    assign $P107, ""
+    set $P105, $P107
+  if_1071_end:
+    find_lex $P1073, "self"
+    unless_null $P1073, vivify_108
+    $P1073 = root_new ['parrot';'Hash']
+    store_lex "self", $P1073
+  vivify_108:
+    set $P1073["sym_export"], $P105
+.annotate 'line', 60
+    find_lex $P105, "$trans"
+    find_lex $P106, "self"
+    find_lex $P107, "$ops_file"
+    $P105."prepare_ops"($P106, $P107)
+.annotate 'line', 14
+    find_lex $P105, "self"
+    .return ($P105)
+  control_1005:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P106, exception, "payload"
+    .return ($P106)
+.end
+
+
+.namespace ["Ops";"Emitter"]
+.sub "_block1028"  :anon :subid("13_1792415682.41389") :method :outer("12_1792415682.41389")
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 27
+    .local string rx1030_tgt
+    .local int rx1030_pos
+    .local int rx1030_off
+    .local int rx1030_eos
+    .local int rx1030_rep
+    .local pmc rx1030_cur
+    .local pmc rx1030_debug
+    (rx1030_cur, rx1030_pos, rx1030_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1030_debug, rx1030_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1030_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1030_eos, rx1030_tgt
+    gt rx1030_pos, rx1030_eos, rx1030_done
+    set rx1030_off, 0
+    lt rx1030_pos, 2, rx1030_start
+    sub rx1030_off, rx1030_pos, 1
+    substr rx1030_tgt, rx1030_tgt, rx1030_off
+  rx1030_start:
+    eq $I10, 1, rx1030_restart
+    if_null rx1030_debug, debug_66
+    rx1030_cur."!cursor_debug"("START", "")
+  debug_66:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1031_done
+    goto rxscan1031_scan
+  rxscan1031_loop:
+    ($P10) = rx1030_cur."from"()
+    inc $P10
+    set rx1030_pos, $P10
+    ge rx1030_pos, rx1030_eos, rxscan1031_done
+  rxscan1031_scan:
+    set_addr $I10, rxscan1031_loop
+    rx1030_cur."!mark_push"(0, rx1030_pos, $I10)
+  rxscan1031_done:
+  # rx charclass .
+    ge rx1030_pos, rx1030_eos, rx1030_fail
+    inc rx1030_pos
+  # rx literal  "ops"
+    add $I11, rx1030_pos, 3
+    gt $I11, rx1030_eos, rx1030_fail
+    sub $I11, rx1030_pos, rx1030_off
+    substr $S10, rx1030_tgt, $I11, 3
+    ne $S10, "ops", rx1030_fail
+    add rx1030_pos, 3
+  # rxanchor eol
+    sub $I10, rx1030_pos, rx1030_off
+    is_cclass $I11, 4096, rx1030_tgt, $I10
+    if $I11, rxanchor1032_done
+    ne rx1030_pos, rx1030_eos, rx1030_fail
+    eq rx1030_pos, 0, rxanchor1032_done
+    dec $I10
+    is_cclass $I11, 4096, rx1030_tgt, $I10
+    if $I11, rx1030_fail
+  rxanchor1032_done:
+  # rx pass
+    rx1030_cur."!cursor_pass"(rx1030_pos, "")
+    if_null rx1030_debug, debug_67
+    rx1030_cur."!cursor_debug"("PASS", "", " at pos=", rx1030_pos)
+  debug_67:
+    rx1030_cur."!cursor_backtrack"()
+    .return (rx1030_cur)
+  rx1030_restart:
+    if_null rx1030_debug, debug_68
+    rx1030_cur."!cursor_debug"("NEXT", "")
+  debug_68:
+  rx1030_fail:
+    (rx1030_rep, rx1030_pos, $I10, $P10) = rx1030_cur."!mark_fail"(0)
+    lt rx1030_pos, -1, rx1030_done
+    eq rx1030_pos, -1, rx1030_fail
+    jump $I10
+  rx1030_done:
+    rx1030_cur."!cursor_fail"()
+    if_null rx1030_debug, debug_69
+    rx1030_cur."!cursor_debug"("FAIL", "")
+  debug_69:
+    .return (rx1030_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Emitter"]
+.sub "_block1033"  :anon :subid("14_1792415682.41389") :method :outer("12_1792415682.41389")
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 28
+    .local string rx1035_tgt
+    .local int rx1035_pos
+    .local int rx1035_off
+    .local int rx1035_eos
+    .local int rx1035_rep
+    .local pmc rx1035_cur
+    .local pmc rx1035_debug
+    (rx1035_cur, rx1035_pos, rx1035_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1035_debug, rx1035_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1035_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1035_eos, rx1035_tgt
+    gt rx1035_pos, rx1035_eos, rx1035_done
+    set rx1035_off, 0
+    lt rx1035_pos, 2, rx1035_start
+    sub rx1035_off, rx1035_pos, 1
+    substr rx1035_tgt, rx1035_tgt, rx1035_off
+  rx1035_start:
+    eq $I10, 1, rx1035_restart
+    if_null rx1035_debug, debug_70
+    rx1035_cur."!cursor_debug"("START", "")
+  debug_70:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1036_done
+    goto rxscan1036_scan
+  rxscan1036_loop:
+    ($P10) = rx1035_cur."from"()
+    inc $P10
+    set rx1035_pos, $P10
+    ge rx1035_pos, rx1035_eos, rxscan1036_done
+  rxscan1036_scan:
+    set_addr $I10, rxscan1036_loop
+    rx1035_cur."!mark_push"(0, rx1035_pos, $I10)
+  rxscan1036_done:
+  # rx rxquantg1037 ** 0..*
+    set_addr $I10, rxquantg1037_done
+    rx1035_cur."!mark_push"(0, rx1035_pos, $I10)
+  rxquantg1037_loop:
+  # rx charclass .
+    ge rx1035_pos, rx1035_eos, rx1035_fail
+    inc rx1035_pos
+    set_addr $I10, rxquantg1037_done
+    rx1035_cur."!mark_push"(rx1035_rep, rx1035_pos, $I10)
+    goto rxquantg1037_loop
+  rxquantg1037_done:
+  # rx literal  "/"
+    add $I11, rx1035_pos, 1
+    gt $I11, rx1035_eos, rx1035_fail
+    sub $I11, rx1035_pos, rx1035_off
+    ord $I11, rx1035_tgt, $I11
+    ne $I11, 47, rx1035_fail
+    add rx1035_pos, 1
+  # rx pass
+    rx1035_cur."!cursor_pass"(rx1035_pos, "")
+    if_null rx1035_debug, debug_71
+    rx1035_cur."!cursor_debug"("PASS", "", " at pos=", rx1035_pos)
+  debug_71:
+    rx1035_cur."!cursor_backtrack"()
+    .return (rx1035_cur)
+  rx1035_restart:
+    if_null rx1035_debug, debug_72
+    rx1035_cur."!cursor_debug"("NEXT", "")
+  debug_72:
+  rx1035_fail:
+    (rx1035_rep, rx1035_pos, $I10, $P10) = rx1035_cur."!mark_fail"(0)
+    lt rx1035_pos, -1, rx1035_done
+    eq rx1035_pos, -1, rx1035_fail
+    jump $I10
+  rx1035_done:
+    rx1035_cur."!cursor_fail"()
+    if_null rx1035_debug, debug_73
+    rx1035_cur."!cursor_debug"("FAIL", "")
+  debug_73:
+    .return (rx1035_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Emitter"]
+.sub "_block1038"  :anon :subid("15_1792415682.41389") :method :outer("12_1792415682.41389")
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 29
+    .local string rx1040_tgt
+    .local int rx1040_pos
+    .local int rx1040_off
+    .local int rx1040_eos
+    .local int rx1040_rep
+    .local pmc rx1040_cur
+    .local pmc rx1040_debug
+    (rx1040_cur, rx1040_pos, rx1040_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1040_debug, rx1040_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1040_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1040_eos, rx1040_tgt
+    gt rx1040_pos, rx1040_eos, rx1040_done
+    set rx1040_off, 0
+    lt rx1040_pos, 2, rx1040_start
+    sub rx1040_off, rx1040_pos, 1
+    substr rx1040_tgt, rx1040_tgt, rx1040_off
+  rx1040_start:
+    eq $I10, 1, rx1040_restart
+    if_null rx1040_debug, debug_74
+    rx1040_cur."!cursor_debug"("START", "")
+  debug_74:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1041_done
+    goto rxscan1041_scan
+  rxscan1041_loop:
+    ($P10) = rx1040_cur."from"()
+    inc $P10
+    set rx1040_pos, $P10
+    ge rx1040_pos, rx1040_eos, rxscan1041_done
+  rxscan1041_scan:
+    set_addr $I10, rxscan1041_loop
+    rx1040_cur."!mark_push"(0, rx1040_pos, $I10)
+  rxscan1041_done:
+  # rx rxquantg1042 ** 0..*
+    set_addr $I10, rxquantg1042_done
+    rx1040_cur."!mark_push"(0, rx1040_pos, $I10)
+  rxquantg1042_loop:
+  # rx charclass .
+    ge rx1040_pos, rx1040_eos, rx1040_fail
+    inc rx1040_pos
+    set_addr $I10, rxquantg1042_done
+    rx1040_cur."!mark_push"(rx1040_rep, rx1040_pos, $I10)
+    goto rxquantg1042_loop
+  rxquantg1042_done:
+  # rx literal  "\\"
+    add $I11, rx1040_pos, 1
+    gt $I11, rx1040_eos, rx1040_fail
+    sub $I11, rx1040_pos, rx1040_off
+    ord $I11, rx1040_tgt, $I11
+    ne $I11, 92, rx1040_fail
+    add rx1040_pos, 1
+  # rx pass
+    rx1040_cur."!cursor_pass"(rx1040_pos, "")
+    if_null rx1040_debug, debug_75
+    rx1040_cur."!cursor_debug"("PASS", "", " at pos=", rx1040_pos)
+  debug_75:
+    rx1040_cur."!cursor_backtrack"()
+    .return (rx1040_cur)
+  rx1040_restart:
+    if_null rx1040_debug, debug_76
+    rx1040_cur."!cursor_debug"("NEXT", "")
+  debug_76:
+  rx1040_fail:
+    (rx1040_rep, rx1040_pos, $I10, $P10) = rx1040_cur."!mark_fail"(0)
+    lt rx1040_pos, -1, rx1040_done
+    eq rx1040_pos, -1, rx1040_fail
+    jump $I10
+  rx1040_done:
+    rx1040_cur."!cursor_fail"()
+    if_null rx1040_debug, debug_77
+    rx1040_cur."!cursor_debug"("FAIL", "")
+  debug_77:
+    .return (rx1040_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Emitter"]
+.sub "_block1057"  :anon :subid("16_1792415682.41389") :outer("12_1792415682.41389")
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 46
+    .const 'Sub' $P1061 = "17_1792415682.41389" 
+    capture_lex $P1061
+.annotate 'line', 47
+    new $P106, "Undef"
+    set $P1059, $P106
+    .lex "$dynops_dir", $P1059
+    find_lex $P107, "$file"
+    get_hll_global $P108, ["Regex"], "Regex"
+    .const 'Sub' $P1061 = "17_1792415682.41389" 
+    capture_lex $P1061
+    $P109 = $P108."new"($P1061)
+    $P110 = "subst"($P107, $P109, "")
+    store_lex "$dynops_dir", $P110
+.annotate 'line', 48
+    find_lex $P107, "$base"
+    concat $P108, $P107, "_ops.h"
+    find_lex $P1066, "self"
+    unless_null $P1066, vivify_87
+    $P1066 = root_new ['parrot';'Hash']
+    store_lex "self", $P1066
+  vivify_87:
+    set $P1066["include"], $P108
+.annotate 'line', 49
+    find_lex $P107, "$dynops_dir"
+    find_lex $P1067, "self"
+    unless_null $P1067, vivify_88
+    $P1067 = root_new ['parrot';'Hash']
+  vivify_88:
+    set $P108, $P1067["include"]
+    unless_null $P108, vivify_89
+    new $P108, "Undef"
+  vivify_89:
+    concat $P109, $P107, $P108
+    find_lex $P1068, "self"
+    unless_null $P1068, vivify_90
+    $P1068 = root_new ['parrot';'Hash']
+    store_lex "self", $P1068
+  vivify_90:
+    set $P1068["func_header"], $P109
+.annotate 'line', 50
+    find_lex $P107, "$dynops_dir"
+    find_lex $P108, "$base"
+    concat $P109, $P107, $P108
+    concat $P110, $P109, "_ops.c"
+    find_lex $P1069, "self"
+    unless_null $P1069, vivify_91
+    $P1069 = root_new ['parrot';'Hash']
+    store_lex "self", $P1069
+  vivify_91:
+    set $P1069["source"], $P110
+.annotate 'line', 51
+    find_lex $P107, "$base"
+    find_lex $P108, "$suffix"
+    concat $P109, $P107, $P108
+    $P110 = "uc"($P109)
+    $P111 = "join"("_", "PARROT", "DYNOP", $P110, "INIT")
+    find_lex $P1070, "self"
+    unless_null $P1070, vivify_92
+    $P1070 = root_new ['parrot';'Hash']
+    store_lex "self", $P1070
+  vivify_92:
+    set $P1070["init_func"], $P111
+.annotate 'line', 46
+    .return ($P111)
+.end
+
+
+.namespace ["Ops";"Emitter"]
+.sub "_block1060"  :anon :subid("17_1792415682.41389") :method :outer("16_1792415682.41389")
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 47
+    .local string rx1062_tgt
+    .local int rx1062_pos
+    .local int rx1062_off
+    .local int rx1062_eos
+    .local int rx1062_rep
+    .local pmc rx1062_cur
+    .local pmc rx1062_debug
+    (rx1062_cur, rx1062_pos, rx1062_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1062_debug, rx1062_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1062_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1062_eos, rx1062_tgt
+    gt rx1062_pos, rx1062_eos, rx1062_done
+    set rx1062_off, 0
+    lt rx1062_pos, 2, rx1062_start
+    sub rx1062_off, rx1062_pos, 1
+    substr rx1062_tgt, rx1062_tgt, rx1062_off
+  rx1062_start:
+    eq $I10, 1, rx1062_restart
+    if_null rx1062_debug, debug_83
+    rx1062_cur."!cursor_debug"("START", "")
+  debug_83:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1063_done
+    goto rxscan1063_scan
+  rxscan1063_loop:
+    ($P10) = rx1062_cur."from"()
+    inc $P10
+    set rx1062_pos, $P10
+    ge rx1062_pos, rx1062_eos, rxscan1063_done
+  rxscan1063_scan:
+    set_addr $I10, rxscan1063_loop
+    rx1062_cur."!mark_push"(0, rx1062_pos, $I10)
+  rxscan1063_done:
+  # rx rxquantg1064 ** 1..*
+  rxquantg1064_loop:
+  # rx charclass w
+    ge rx1062_pos, rx1062_eos, rx1062_fail
+    sub $I10, rx1062_pos, rx1062_off
+    is_cclass $I11, 8192, rx1062_tgt, $I10
+    unless $I11, rx1062_fail
+    inc rx1062_pos
+    set_addr $I10, rxquantg1064_done
+    rx1062_cur."!mark_push"(rx1062_rep, rx1062_pos, $I10)
+    goto rxquantg1064_loop
+  rxquantg1064_done:
+  # rx literal  ".ops"
+    add $I11, rx1062_pos, 4
+    gt $I11, rx1062_eos, rx1062_fail
+    sub $I11, rx1062_pos, rx1062_off
+    substr $S10, rx1062_tgt, $I11, 4
+    ne $S10, ".ops", rx1062_fail
+    add rx1062_pos, 4
+  # rxanchor eol
+    sub $I10, rx1062_pos, rx1062_off
+    is_cclass $I11, 4096, rx1062_tgt, $I10
+    if $I11, rxanchor1065_done
+    ne rx1062_pos, rx1062_eos, rx1062_fail
+    eq rx1062_pos, 0, rxanchor1065_done
+    dec $I10
+    is_cclass $I11, 4096, rx1062_tgt, $I10
+    if $I11, rx1062_fail
+  rxanchor1065_done:
+  # rx pass
+    rx1062_cur."!cursor_pass"(rx1062_pos, "")
+    if_null rx1062_debug, debug_84
+    rx1062_cur."!cursor_debug"("PASS", "", " at pos=", rx1062_pos)
+  debug_84:
+    rx1062_cur."!cursor_backtrack"()
+    .return (rx1062_cur)
+  rx1062_restart:
+    if_null rx1062_debug, debug_85
+    rx1062_cur."!cursor_debug"("NEXT", "")
+  debug_85:
+  rx1062_fail:
+    (rx1062_rep, rx1062_pos, $I10, $P10) = rx1062_cur."!mark_fail"(0)
+    lt rx1062_pos, -1, rx1062_done
+    eq rx1062_pos, -1, rx1062_fail
+    jump $I10
+  rx1062_done:
+    rx1062_cur."!cursor_fail"()
+    if_null rx1062_debug, debug_86
+    rx1062_cur."!cursor_debug"("FAIL", "")
+  debug_86:
+    .return (rx1062_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Emitter"]
+.include "except_types.pasm"
+.sub "ops_file"  :subid("18_1792415682.41389") :method :outer("11_1792415682.41389")
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 65
+    new $P1076, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1076, control_1075
+    push_eh $P1076
+    .lex "self", self
+    find_lex $P1077, "self"
+    unless_null $P1077, vivify_109
+    $P1077 = root_new ['parrot';'Hash']
+  vivify_109:
+    set $P100, $P1077["ops_file"]
+    unless_null $P100, vivify_110
+    new $P100, "Undef"
+  vivify_110:
+    .return ($P100)
+  control_1075:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Emitter"]
+.include "except_types.pasm"
+.sub "trans"  :subid("19_1792415682.41389") :method :outer("11_1792415682.41389")
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 66
+    new $P1080, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1080, control_1079
+    push_eh $P1080
+    .lex "self", self
+    find_lex $P1081, "self"
+    unless_null $P1081, vivify_111
+    $P1081 = root_new ['parrot';'Hash']
+  vivify_111:
+    set $P100, $P1081["trans"]
+    unless_null $P100, vivify_112
+    new $P100, "Undef"
+  vivify_112:
+    .return ($P100)
+  control_1079:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Emitter"]
+.include "except_types.pasm"
+.sub "script"  :subid("20_1792415682.41389") :method :outer("11_1792415682.41389")
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 67
+    new $P1084, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1084, control_1083
+    push_eh $P1084
+    .lex "self", self
+    find_lex $P1085, "self"
+    unless_null $P1085, vivify_113
+    $P1085 = root_new ['parrot';'Hash']
+  vivify_113:
+    set $P100, $P1085["script"]
+    unless_null $P100, vivify_114
+    new $P100, "Undef"
+  vivify_114:
+    .return ($P100)
+  control_1083:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Emitter"]
+.include "except_types.pasm"
+.sub "file"  :subid("21_1792415682.41389") :method :outer("11_1792415682.41389")
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 68
+    new $P1088, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1088, control_1087
+    push_eh $P1088
+    .lex "self", self
+    find_lex $P1089, "self"
+    unless_null $P1089, vivify_115
+    $P1089 = root_new ['parrot';'Hash']
+  vivify_115:
+    set $P100, $P1089["file"]
+    unless_null $P100, vivify_116
+    new $P100, "Undef"
+  vivify_116:
+    .return ($P100)
+  control_1087:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Emitter"]
+.include "except_types.pasm"
+.sub "flags"  :subid("22_1792415682.41389") :method :outer("11_1792415682.41389")
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 69
+    new $P1092, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1092, control_1091
+    push_eh $P1092
+    .lex "self", self
+    find_lex $P1093, "self"
+    unless_null $P1093, vivify_117
+    $P1093 = root_new ['parrot';'Hash']
+  vivify_117:
+    set $P100, $P1093["flags"]
+    unless_null $P100, vivify_118
+    new $P100, "Undef"
+  vivify_118:
+    .return ($P100)
+  control_1091:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Emitter"]
+.include "except_types.pasm"
+.sub "sym_export"  :subid("23_1792415682.41389") :method :outer("11_1792415682.41389")
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 70
+    new $P1096, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1096, control_1095
+    push_eh $P1096
+    .lex "self", self
+    find_lex $P1097, "self"
+    unless_null $P1097, vivify_119
+    $P1097 = root_new ['parrot';'Hash']
+  vivify_119:
+    set $P100, $P1097["sym_export"]
+    unless_null $P100, vivify_120
+    new $P100, "Undef"
+  vivify_120:
+    .return ($P100)
+  control_1095:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Emitter"]
+.include "except_types.pasm"
+.sub "init_func"  :subid("24_1792415682.41389") :method :outer("11_1792415682.41389")
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 71
+    new $P1100, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1100, control_1099
+    push_eh $P1100
+    .lex "self", self
+    find_lex $P1101, "self"
+    unless_null $P1101, vivify_121
+    $P1101 = root_new ['parrot';'Hash']
+  vivify_121:
+    set $P100, $P1101["init_func"]
+    unless_null $P100, vivify_122
+    new $P100, "Undef"
+  vivify_122:
+    .return ($P100)
+  control_1099:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Emitter"]
+.include "except_types.pasm"
+.sub "base"  :subid("25_1792415682.41389") :method :outer("11_1792415682.41389")
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 73
+    new $P1104, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1104, control_1103
+    push_eh $P1104
+    .lex "self", self
+    find_lex $P1105, "self"
+    unless_null $P1105, vivify_123
+    $P1105 = root_new ['parrot';'Hash']
+  vivify_123:
+    set $P100, $P1105["base"]
+    unless_null $P100, vivify_124
+    new $P100, "Undef"
+  vivify_124:
+    .return ($P100)
+  control_1103:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Emitter"]
+.include "except_types.pasm"
+.sub "suffix"  :subid("26_1792415682.41389") :method :outer("11_1792415682.41389")
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 74
+    new $P1108, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1108, control_1107
+    push_eh $P1108
+    .lex "self", self
+    find_lex $P1109, "self"
+    unless_null $P1109, vivify_125
+    $P1109 = root_new ['parrot';'Hash']
+  vivify_125:
+    set $P100, $P1109["suffix"]
+    unless_null $P100, vivify_126
+    new $P100, "Undef"
+  vivify_126:
+    .return ($P100)
+  control_1107:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Emitter"]
+.include "except_types.pasm"
+.sub "bs"  :subid("27_1792415682.41389") :method :outer("11_1792415682.41389")
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 75
+    new $P1112, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1112, control_1111
+    push_eh $P1112
+    .lex "self", self
+    find_lex $P1113, "self"
+    unless_null $P1113, vivify_127
+    $P1113 = root_new ['parrot';'Hash']
+  vivify_127:
+    set $P100, $P1113["bs"]
+    unless_null $P100, vivify_128
+    new $P100, "Undef"
+  vivify_128:
+    .return ($P100)
+  control_1111:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Emitter"]
+.include "except_types.pasm"
+.sub "print_c_header_files"  :subid("28_1792415682.41389") :method :outer("11_1792415682.41389")
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 77
+    new $P1116, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1116, control_1115
+    push_eh $P1116
+    .lex "self", self
+.annotate 'line', 79
+    new $P100, "Undef"
+    set $P1117, $P100
+    .lex "$fh", $P1117
+    new $P101, "FileHandle"
+    store_lex "$fh", $P101
+.annotate 'line', 80
+    find_lex $P101, "$fh"
+    find_lex $P1119, "self"
+    unless_null $P1119, vivify_129
+    $P1119 = root_new ['parrot';'Hash']
+  vivify_129:
+    set $P102, $P1119["func_header"]
+    unless_null $P102, vivify_130
+    new $P102, "Undef"
+  vivify_130:
+    $P103 = $P101."open"($P102, "w")
+    if $P103, unless_1118_end
+.annotate 'line', 81
+    new $P104, "String"
+    assign $P104, "Can't open "
+    find_lex $P1120, "self"
+    unless_null $P1120, vivify_131
+    $P1120 = root_new ['parrot';'Hash']
+  vivify_131:
+    set $P105, $P1120["func_header"]
+    unless_null $P105, vivify_132
+    new $P105, "Undef"
+  vivify_132:
+    concat $P106, $P104, $P105
+    "die"($P106)
+  unless_1118_end:
+.annotate 'line', 82
+    find_lex $P101, "self"
+    find_lex $P102, "$fh"
+    $P101."emit_c_op_func_header"($P102)
+.annotate 'line', 83
+    find_lex $P101, "$fh"
+    $P101."close"()
+.annotate 'line', 85
+    find_lex $P102, "self"
+    $P103 = $P102."ops_file"()
+    set $P104, $P103["core"]
+    unless_null $P104, vivify_133
+    new $P104, "Undef"
+  vivify_133:
+    if $P104, if_1121
+    set $P101, $P104
+    goto if_1121_end
+  if_1121:
+.annotate 'line', 86
+    new $P105, "FileHandle"
+    store_lex "$fh", $P105
+.annotate 'line', 87
+    find_lex $P105, "$fh"
+    find_lex $P1123, "self"
+    unless_null $P1123, vivify_134
+    $P1123 = root_new ['parrot';'Hash']
+  vivify_134:
+    set $P106, $P1123["enum_header"]
+    unless_null $P106, vivify_135
+    new $P106, "Undef"
+  vivify_135:
+    $P107 = $P105."open"($P106, "w")
+    if $P107, unless_1122_end
+.annotate 'line', 88
+    new $P108, "String"
+    assign $P108, "Can't open "
+    find_lex $P1124, "self"
+    unless_null $P1124, vivify_136
+    $P1124 = root_new ['parrot';'Hash']
+  vivify_136:
+    set $P109, $P1124["enum_header"]
+    unless_null $P109, vivify_137
+    new $P109, "Undef"
+  vivify_137:
+    concat $P110, $P108, $P109
+    "die"($P110)
+  unless_1122_end:
+.annotate 'line', 89
+    find_lex $P105, "self"
+    find_lex $P106, "$fh"
+    $P105."emit_c_op_enum_header"($P106)
+.annotate 'line', 90
+    find_lex $P105, "$fh"
+    $P106 = $P105."close"()
+.annotate 'line', 85
+    set $P101, $P106
+  if_1121_end:
+.annotate 'line', 77
+    .return ($P101)
+  control_1115:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P102, exception, "payload"
+    .return ($P102)
+.end
+
+
+.namespace ["Ops";"Emitter"]
+.include "except_types.pasm"
+.sub "emit_c_op_func_header"  :subid("29_1792415682.41389") :method :outer("11_1792415682.41389")
+    .param pmc param_1128
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 94
+    new $P1127, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1127, control_1126
+    push_eh $P1127
+    .lex "self", self
+    .lex "$fh", param_1128
+.annotate 'line', 96
+    find_lex $P100, "self"
+    find_lex $P101, "$fh"
+    find_lex $P1129, "self"
+    unless_null $P1129, vivify_138
+    $P1129 = root_new ['parrot';'Hash']
+  vivify_138:
+    set $P102, $P1129["func_header"]
+    unless_null $P102, vivify_139
+    new $P102, "Undef"
+  vivify_139:
+    $P100."_emit_guard_prefix"($P101, $P102)
+.annotate 'line', 98
+    find_lex $P100, "self"
+    find_lex $P101, "$fh"
+    $P100."_emit_preamble"($P101)
+.annotate 'line', 100
+    find_lex $P100, "self"
+    find_lex $P101, "$fh"
+    $P100."_emit_includes"($P101)
+.annotate 'line', 103
+    find_lex $P100, "self"
+    $P101 = $P100."trans"()
+    find_lex $P102, "$fh"
+    $P101."emit_c_op_funcs_header_part"($P102)
+.annotate 'line', 105
+    find_lex $P100, "self"
+    find_lex $P101, "$fh"
+    find_lex $P1130, "self"
+    unless_null $P1130, vivify_140
+    $P1130 = root_new ['parrot';'Hash']
+  vivify_140:
+    set $P102, $P1130["func_header"]
+    unless_null $P102, vivify_141
+    new $P102, "Undef"
+  vivify_141:
+    $P100."_emit_guard_suffix"($P101, $P102)
+.annotate 'line', 107
+    find_lex $P100, "self"
+    find_lex $P101, "$fh"
+    $P102 = $P100."_emit_coda"($P101)
+.annotate 'line', 94
+    .return ($P102)
+  control_1126:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P100, exception, "payload"
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Emitter"]
+.include "except_types.pasm"
+.sub "emit_c_op_enum_header"  :subid("30_1792415682.41389") :method :outer("11_1792415682.41389")
+    .param pmc param_1134
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 110
+    new $P1133, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1133, control_1132
+    push_eh $P1133
+    .lex "self", self
+    .lex "$fh", param_1134
+.annotate 'line', 112
+    find_lex $P100, "self"
+    find_lex $P101, "$fh"
+    find_lex $P1135, "self"
+    unless_null $P1135, vivify_142
+    $P1135 = root_new ['parrot';'Hash']
+  vivify_142:
+    set $P102, $P1135["enum_header"]
+    unless_null $P102, vivify_143
+    new $P102, "Undef"
+  vivify_143:
+    $P100."_emit_guard_prefix"($P101, $P102)
+.annotate 'line', 114
+    find_lex $P100, "self"
+    find_lex $P101, "$fh"
+    $P100."_emit_preamble"($P101)
+.annotate 'line', 116
+    find_lex $P100, "self"
+    find_lex $P101, "$fh"
+    $P100."_emit_c_op_enum_header_part"($P101)
+.annotate 'line', 118
+    find_lex $P100, "self"
+    find_lex $P101, "$fh"
+    find_lex $P1136, "self"
+    unless_null $P1136, vivify_144
+    $P1136 = root_new ['parrot';'Hash']
+  vivify_144:
+    set $P102, $P1136["enum_header"]
+    unless_null $P102, vivify_145
+    new $P102, "Undef"
+  vivify_145:
+    $P100."_emit_guard_suffix"($P101, $P102)
+.annotate 'line', 120
+    find_lex $P100, "self"
+    find_lex $P101, "$fh"
+    $P102 = $P100."_emit_coda"($P101)
+.annotate 'line', 110
+    .return ($P102)
+  control_1132:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P100, exception, "payload"
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Emitter"]
+.include "except_types.pasm"
+.sub "print_ops_num_files"  :subid("31_1792415682.41389") :method :outer("11_1792415682.41389")
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 123
+    new $P1139, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1139, control_1138
+    push_eh $P1139
+    .lex "self", self
+.annotate 'line', 125
+    new $P100, "Undef"
+    set $P1140, $P100
+    .lex "$file", $P1140
+.annotate 'line', 126
+    new $P101, "Undef"
+    set $P1141, $P101
+    .lex "$fh", $P1141
+.annotate 'line', 125
+    find_lex $P1142, "self"
+    unless_null $P1142, vivify_146
+    $P1142 = root_new ['parrot';'Hash']
+  vivify_146:
+    set $P102, $P1142["dir"]
+    unless_null $P102, vivify_147
+    new $P102, "Undef"
+  vivify_147:
+    set $S100, $P102
+    new $P103, 'String'
+    set $P103, $S100
+    concat $P104, $P103, "include/parrot/opsenum.h"
+    store_lex "$file", $P104
+.annotate 'line', 126
+    new $P102, "FileHandle"
+    store_lex "$fh", $P102
+.annotate 'line', 127
+    find_lex $P102, "$fh"
+    find_lex $P103, "$file"
+    $P104 = $P102."open"($P103, "w")
+    if $P104, unless_1143_end
+.annotate 'line', 128
+    new $P105, 'String'
+    set $P105, "Can't open "
+    find_lex $P106, "$file"
+    concat $P107, $P105, $P106
+    concat $P108, $P107, " for writing: "
+    err $S100
+    set $S101, $S100
+    concat $P109, $P108, $S101
+    "die"($P109)
+  unless_1143_end:
+.annotate 'line', 129
+    find_lex $P102, "self"
+    find_lex $P103, "$fh"
+    find_lex $P104, "$file"
+    $P102."emit_c_opsenum_header"($P103, $P104)
+.annotate 'line', 130
+    find_lex $P102, "$fh"
+    $P103 = $P102."close"()
+.annotate 'line', 123
+    .return ($P103)
+  control_1138:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P102, exception, "payload"
+    .return ($P102)
+.end
+
+
+.namespace ["Ops";"Emitter"]
+.include "except_types.pasm"
+.sub "emit_c_opsenum_header"  :subid("32_1792415682.41389") :method :outer("11_1792415682.41389")
+    .param pmc param_1147
+    .param pmc param_1148
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 133
+    new $P1146, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1146, control_1145
+    push_eh $P1146
+    .lex "self", self
+    .lex "$fh", param_1147
+    .lex "$file", param_1148
+.annotate 'line', 135
+    find_lex $P100, "self"
+    find_lex $P101, "$fh"
+    find_lex $P102, "$file"
+    $P100."_emit_guard_prefix"($P101, $P102)
+.annotate 'line', 137
+    find_lex $P100, "self"
+    find_lex $P101, "$fh"
+    $P100."_emit_preamble"($P101)
+.annotate 'line', 139
+    find_lex $P100, "self"
+    find_lex $P101, "$fh"
+    $P100."emit_opsenum_h_body"($P101)
+.annotate 'line', 141
+    find_lex $P100, "self"
+    find_lex $P101, "$fh"
+    find_lex $P102, "$file"
+    $P100."_emit_guard_suffix"($P101, $P102)
+.annotate 'line', 143
+    find_lex $P100, "self"
+    find_lex $P101, "$fh"
+    $P102 = $P100."_emit_coda"($P101)
+.annotate 'line', 133
+    .return ($P102)
+  control_1145:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P100, exception, "payload"
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Emitter"]
+.include "except_types.pasm"
+.sub "emit_opsenum_h_body"  :subid("33_1792415682.41389") :method :outer("11_1792415682.41389")
+    .param pmc param_1152
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 146
+    .const 'Sub' $P1155 = "34_1792415682.41389" 
+    capture_lex $P1155
+    new $P1151, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1151, control_1150
+    push_eh $P1151
+    .lex "self", self
+    .lex "$fh", param_1152
+.annotate 'line', 150
+    new $P100, "Undef"
+    set $P1153, $P100
+    .lex "$max_op_num", $P1153
+.annotate 'line', 148
+    find_lex $P101, "$fh"
+    $P101."print"("enum OPS_ENUM {\n")
+.annotate 'line', 150
+    new $P101, "Integer"
+    assign $P101, 0
+    store_lex "$max_op_num", $P101
+.annotate 'line', 151
+    find_lex $P102, "self"
+    $P103 = $P102."ops_file"()
+    $P104 = $P103."ops"()
+    defined $I100, $P104
+    unless $I100, for_undef_148
+    iter $P101, $P104
+    new $P107, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P107, loop1163_handler
+    push_eh $P107
+  loop1163_test:
+    unless $P101, loop1163_done
+    shift $P105, $P101
+  loop1163_redo:
+    .const 'Sub' $P1155 = "34_1792415682.41389" 
+    capture_lex $P1155
+    $P1155($P105)
+  loop1163_next:
+    goto loop1163_test
+  loop1163_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P108, exception, 'type'
+    eq $P108, .CONTROL_LOOP_NEXT, loop1163_next
+    eq $P108, .CONTROL_LOOP_REDO, loop1163_redo
+  loop1163_done:
+    pop_eh 
+  for_undef_148:
+.annotate 'line', 161
+    find_lex $P101, "$fh"
+    $P102 = $P101."print"("};\n")
+.annotate 'line', 146
+    .return ($P102)
+  control_1150:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Emitter"]
+.sub "_block1154"  :anon :subid("34_1792415682.41389") :outer("33_1792415682.41389")
+    .param pmc param_1156
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 151
+    .const 'Sub' $P1160 = "35_1792415682.41389" 
+    capture_lex $P1160
+    .lex "$op", param_1156
+.annotate 'line', 152
+    find_lex $P108, "self"
+    $P109 = $P108."ops_file"()
+    set $P110, $P109["core"]
+    unless_null $P110, vivify_149
+    new $P110, "Undef"
+  vivify_149:
+    isfalse $I101, $P110
+    unless $I101, unless_1158
+    new $P107, 'Integer'
+    set $P107, $I101
+    goto unless_1158_end
+  unless_1158:
+    find_lex $P111, "self"
+    $P112 = $P111."ops_file"()
+    $P113 = $P112."oplib"()
+    $P114 = $P113."op_skip_table"()
+    find_lex $P115, "$op"
+    $P116 = $P115."full_name"()
+    $P117 = $P114."exists"($P116)
+    isfalse $I102, $P117
+    new $P107, 'Integer'
+    set $P107, $I102
+  unless_1158_end:
+    if $P107, if_1157
+    set $P106, $P107
+    goto if_1157_end
+  if_1157:
+    .const 'Sub' $P1160 = "35_1792415682.41389" 
+    capture_lex $P1160
+    $P119 = $P1160()
+    set $P106, $P119
+  if_1157_end:
+.annotate 'line', 151
+    .return ($P106)
+.end
+
+
+.namespace ["Ops";"Emitter"]
+.sub "_block1159"  :anon :subid("35_1792415682.41389") :outer("34_1792415682.41389")
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 153
+    new $P118, "Undef"
+    set $P1161, $P118
+    .lex "$space", $P1161
+    new $P119, "Integer"
+    assign $P119, 30
+    find_lex $P120, "$op"
+    $S100 = $P120."full_name"()
+    length $I103, $S100
+    sub $P121, $P119, $I103
+    set $I104, $P121
+    repeat $S101, " ", $I104
+    new $P122, 'String'
+    set $P122, $S101
+    store_lex "$space", $P122
+.annotate 'line', 154
+    find_lex $P119, "$fh"
+    new $P120, "String"
+    assign $P120, "    enum_ops_"
+    find_lex $P121, "$op"
+    $S100 = $P121."full_name"()
+    concat $P122, $P120, $S100
+    find_lex $P123, "$space"
+    concat $P124, $P122, $P123
+    concat $P125, $P124, "="
+    $P119."print"($P125)
+.annotate 'line', 155
+    new $P119, "Integer"
+    assign $P119, 5
+    find_lex $P120, "$max_op_num"
+    set $S100, $P120
+    length $I103, $S100
+    sub $P121, $P119, $I103
+    set $I104, $P121
+    repeat $S101, " ", $I104
+    new $P122, 'String'
+    set $P122, $S101
+    store_lex "$space", $P122
+.annotate 'line', 156
+    find_lex $P119, "$fh"
+    find_lex $P120, "$space"
+    find_lex $P121, "$max_op_num"
+    concat $P122, $P120, $P121
+    concat $P123, $P122, ",\n"
+    $P119."print"($P123)
+.annotate 'line', 152
+    find_lex $P119, "$max_op_num"
+    clone $P1162, $P119
+    inc $P119
+    .return ($P1162)
+.end
+
+
+.namespace ["Ops";"Emitter"]
+.include "except_types.pasm"
+.sub "print_c_source_file"  :subid("36_1792415682.41389") :method :outer("11_1792415682.41389")
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 164
+    new $P1166, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1166, control_1165
+    push_eh $P1166
+    .lex "self", self
+.annotate 'line', 166
+    new $P100, "Undef"
+    set $P1167, $P100
+    .lex "$fh", $P1167
+.annotate 'line', 172
+    new $P101, "Undef"
+    set $P1168, $P101
+    .lex "$final", $P1168
+.annotate 'line', 166
+    new $P102, "StringHandle"
+    store_lex "$fh", $P102
+.annotate 'line', 167
+    find_lex $P102, "$fh"
+    $P102."open"("dummy.c", "w")
+.annotate 'line', 168
+    find_lex $P102, "self"
+    find_lex $P103, "$fh"
+    $P102."emit_c_source_file"($P103)
+.annotate 'line', 169
+    find_lex $P102, "$fh"
+    $P102."close"()
+.annotate 'line', 172
+    new $P102, "FileHandle"
+    store_lex "$final", $P102
+.annotate 'line', 173
+    find_lex $P102, "$final"
+    find_lex $P1170, "self"
+    unless_null $P1170, vivify_150
+    $P1170 = root_new ['parrot';'Hash']
+  vivify_150:
+    set $P103, $P1170["source"]
+    unless_null $P103, vivify_151
+    new $P103, "Undef"
+  vivify_151:
+    $P104 = $P102."open"($P103, "w")
+    if $P104, unless_1169_end
+    "die"("Can't open filehandle")
+  unless_1169_end:
+.annotate 'line', 174
+    find_lex $P102, "$final"
+    find_lex $P103, "$fh"
+    $P104 = $P103."readall"()
+    $P102."print"($P104)
+.annotate 'line', 175
+    find_lex $P102, "$final"
+    $P102."close"()
+.annotate 'line', 176
+    new $P102, "Exception"
+    set $P102['type'], .CONTROL_RETURN
+    find_lex $P1171, "self"
+    unless_null $P1171, vivify_152
+    $P1171 = root_new ['parrot';'Hash']
+  vivify_152:
+    set $P103, $P1171["source"]
+    unless_null $P103, vivify_153
+    new $P103, "Undef"
+  vivify_153:
+    setattribute $P102, 'payload', $P103
+    throw $P102
+.annotate 'line', 164
+    .return ()
+  control_1165:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P102, exception, "payload"
+    .return ($P102)
+.end
+
+
+.namespace ["Ops";"Emitter"]
+.include "except_types.pasm"
+.sub "emit_c_source_file"  :subid("37_1792415682.41389") :method :outer("11_1792415682.41389")
+    .param pmc param_1175
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 179
+    new $P1174, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1174, control_1173
+    push_eh $P1174
+    .lex "self", self
+    .lex "$fh", param_1175
+.annotate 'line', 180
+    find_lex $P100, "self"
+    find_lex $P101, "$fh"
+    $P100."_emit_source_preamble"($P101)
+.annotate 'line', 182
+    find_lex $P100, "self"
+    $P101 = $P100."trans"()
+    find_lex $P102, "self"
+    find_lex $P103, "$fh"
+    $P101."emit_source_part"($P102, $P103)
+.annotate 'line', 184
+    find_lex $P100, "self"
+    find_lex $P101, "$fh"
+    $P100."_emit_op_lib_descriptor"($P101)
+.annotate 'line', 186
+    find_lex $P100, "self"
+    $P101 = $P100."trans"()
+    find_lex $P102, "self"
+    find_lex $P103, "$fh"
+    $P101."emit_op_lookup"($P102, $P103)
+.annotate 'line', 188
+    find_lex $P100, "self"
+    find_lex $P101, "$fh"
+    $P100."_emit_init_func"($P101)
+.annotate 'line', 189
+    find_lex $P100, "self"
+    find_lex $P101, "$fh"
+    $P100."_emit_dymanic_lib_load"($P101)
+.annotate 'line', 190
+    find_lex $P100, "self"
+    find_lex $P101, "$fh"
+    $P102 = $P100."_emit_coda"($P101)
+.annotate 'line', 179
+    .return ($P102)
+  control_1173:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P100, exception, "payload"
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Emitter"]
+.include "except_types.pasm"
+.sub "_emit_c_op_enum_header_part"  :subid("38_1792415682.41389") :method :outer("11_1792415682.41389")
+    .param pmc param_1179
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 193
+    .const 'Sub' $P1183 = "39_1792415682.41389" 
+    capture_lex $P1183
+    new $P1178, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1178, control_1177
+    push_eh $P1178
+    .lex "self", self
+    .lex "$fh", param_1179
+.annotate 'line', 194
+    new $P100, "Undef"
+    set $P1180, $P100
+    .lex "$sb", $P1180
+.annotate 'line', 195
+    new $P101, "Undef"
+    set $P1181, $P101
+    .lex "$last_op_code", $P1181
+.annotate 'line', 194
+    new $P102, "StringBuilder"
+    store_lex "$sb", $P102
+.annotate 'line', 195
+    find_lex $P102, "self"
+    $P103 = $P102."ops_file"()
+    $P104 = $P103."ops"()
+    set $N100, $P104
+    new $P105, 'Float'
+    set $P105, $N100
+    sub $P106, $P105, 1
+    store_lex "$last_op_code", $P106
+.annotate 'line', 196
+    find_lex $P103, "self"
+    $P104 = $P103."ops_file"()
+    $P105 = $P104."ops"()
+    defined $I100, $P105
+    unless $I100, for_undef_154
+    iter $P102, $P105
+    new $P107, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P107, loop1186_handler
+    push_eh $P107
+  loop1186_test:
+    unless $P102, loop1186_done
+    shift $P106, $P102
+  loop1186_redo:
+    .const 'Sub' $P1183 = "39_1792415682.41389" 
+    capture_lex $P1183
+    $P1183($P106)
+  loop1186_next:
+    goto loop1186_test
+  loop1186_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P108, exception, 'type'
+    eq $P108, .CONTROL_LOOP_NEXT, loop1186_next
+    eq $P108, .CONTROL_LOOP_REDO, loop1186_redo
+  loop1186_done:
+    pop_eh 
+  for_undef_154:
+.annotate 'line', 203
+    find_lex $P102, "$fh"
+    $P102."print"("\ntypedef enum {\n")
+.annotate 'line', 206
+    find_lex $P102, "$fh"
+    find_lex $P103, "$sb"
+    set $S100, $P103
+    $P102."print"($S100)
+.annotate 'line', 207
+    find_lex $P102, "$fh"
+    $P103 = $P102."print"("\n} parrot_opcode_enums;\n")
+.annotate 'line', 193
+    .return ($P103)
+  control_1177:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P102, exception, "payload"
+    .return ($P102)
+.end
+
+
+.namespace ["Ops";"Emitter"]
+.sub "_block1182"  :anon :subid("39_1792415682.41389") :outer("38_1792415682.41389")
+    .param pmc param_1184
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 196
+    .lex "$op", param_1184
+.annotate 'line', 197
+    find_lex $P107, "$sb"
+.annotate 'line', 198
+    find_lex $P108, "$op"
+    $P109 = $P108."full_name"()
+.annotate 'line', 199
+    find_lex $P111, "$op"
+    $N100 = $P111."code"()
+    find_lex $P112, "$last_op_code"
+    set $N101, $P112
+    iseq $I101, $N100, $N101
+    if $I101, if_1185
+    new $P114, "String"
+    assign $P114, ","
+    set $P110, $P114
+    goto if_1185_end
+  if_1185:
+    new $P113, "String"
+    assign $P113, " "
+    set $P110, $P113
+  if_1185_end:
+.annotate 'line', 200
+    new $P115, "Integer"
+    assign $P115, 30
+    find_lex $P116, "$op"
+    $S100 = $P116."full_name"()
+    length $I102, $S100
+    sub $P117, $P115, $I102
+    set $I103, $P117
+    repeat $S101, " ", $I103
+.annotate 'line', 201
+    find_lex $P118, "$op"
+    $P119 = $P118."code"()
+    $P120 = $P107."append_format"("    PARROT_OP_%0%1 %2 /* %3 */\n", $P109, $P110, $S101, $P119)
+.annotate 'line', 196
+    .return ($P120)
+.end
+
+
+.namespace ["Ops";"Emitter"]
+.include "except_types.pasm"
+.sub "_emit_source_preamble"  :subid("40_1792415682.41389") :method :outer("11_1792415682.41389")
+    .param pmc param_1190
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 212
+    new $P1189, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1189, control_1188
+    push_eh $P1189
+    .lex "self", self
+    .lex "$fh", param_1190
+.annotate 'line', 214
+    find_lex $P100, "self"
+    find_lex $P101, "$fh"
+    $P100."_emit_preamble"($P101)
+.annotate 'line', 215
+    find_lex $P100, "$fh"
+    new $P101, 'String'
+    set $P101, "\n#include \""
+.annotate 'line', 216
+    find_lex $P1191, "self"
+    unless_null $P1191, vivify_155
+    $P1191 = root_new ['parrot';'Hash']
+  vivify_155:
+    set $P102, $P1191["include"]
+    unless_null $P102, vivify_156
+    new $P102, "Undef"
+  vivify_156:
+    set $S100, $P102
+    concat $P103, $P101, $S100
+.annotate 'line', 215
+    concat $P104, $P103, "\"\n#include \"parrot/pbcversion.h\"\n#include \"pmc/pmc_parrotlibrary.h\"\n#include \"pmc/pmc_callcontext.h\"\n\n"
+.annotate 'line', 221
+    find_lex $P105, "self"
+    $P106 = $P105."trans"()
+    find_lex $P107, "self"
+    $P108 = $P106."defines"($P107)
+    set $S101, $P108
+    concat $P105, $P104, $S101
+.annotate 'line', 215
+    concat $P106, $P105, "\n\n/* XXX should be static, but C++ doesn't want to play ball */\nextern op_lib_t "
+.annotate 'line', 224
+    find_lex $P107, "self"
+    $P109 = $P107."bs"()
+    set $S102, $P109
+    concat $P107, $P106, $S102
+.annotate 'line', 215
+    concat $P110, $P107, "op_lib;\n\n"
+    $P100."print"($P110)
+.annotate 'line', 228
+    find_lex $P100, "$fh"
+    find_lex $P101, "self"
+    $P102 = $P101."ops_file"()
+    $P103 = $P102."preamble"()
+    $P104 = $P100."print"($P103)
+.annotate 'line', 212
+    .return ($P104)
+  control_1188:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P100, exception, "payload"
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Emitter"]
+.include "except_types.pasm"
+.sub "_emit_op_lib_descriptor"  :subid("41_1792415682.41389") :method :outer("11_1792415682.41389")
+    .param pmc param_1195
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 231
+    new $P1194, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1194, control_1193
+    push_eh $P1194
+    .lex "self", self
+    .lex "$fh", param_1195
+.annotate 'line', 233
+    new $P100, "Undef"
+    set $P1196, $P100
+    .lex "$core_type", $P1196
+    find_lex $P101, "self"
+    $P102 = $P101."trans"()
+    $P103 = $P102."core_type"()
+    store_lex "$core_type", $P103
+.annotate 'line', 234
+    find_lex $P101, "$fh"
+.annotate 'line', 240
+    new $P102, "String"
+    assign $P102, "\n/*\n** op lib descriptor:\n*/\n\n/* XXX should be static, but C++ doesn't want to play ball */\nop_lib_t "
+    find_lex $P103, "self"
+    $S100 = $P103."bs"()
+    concat $P104, $P102, $S100
+    concat $P105, $P104, "op_lib = {"
+    new $P106, 'String'
+    set $P106, "\n  \""
+.annotate 'line', 241
+    find_lex $P107, "self"
+    $P108 = $P107."base"()
+    set $S101, $P108
+    concat $P107, $P106, $S101
+.annotate 'line', 240
+    concat $P109, $P107, "_ops\",                /* name */\n  \""
+.annotate 'line', 242
+    find_lex $P110, "self"
+    $P111 = $P110."suffix"()
+    set $S102, $P111
+    concat $P110, $P109, $S102
+.annotate 'line', 240
+    concat $P112, $P110, "\",                  /* suffix */\n  "
+    find_lex $P113, "$core_type"
+    concat $P114, $P112, $P113
+    concat $P115, $P114, ",                       /* core_type = PARROT_XX_CORE */\n  0,                                /* flags */\n  PARROT_PBC_MAJOR,\n  PARROT_PBC_MINOR,\n  "
+.annotate 'line', 247
+    find_lex $P116, "self"
+    $P117 = $P116."ops_file"()
+    $P118 = $P117."ops"()
+    set $N100, $P118
+    set $S103, $N100
+    concat $P116, $P115, $S103
+.annotate 'line', 240
+    concat $P117, $P116, ",             /* op_count */\n  "
+.annotate 'line', 248
+    find_lex $P118, "self"
+    $P119 = $P118."trans"()
+    find_lex $P120, "self"
+    $P121 = $P119."op_info"($P120)
+    set $S104, $P121
+    concat $P118, $P117, $S104
+.annotate 'line', 240
+    concat $P119, $P118, ",       /* op_info_table */\n  "
+.annotate 'line', 249
+    find_lex $P120, "self"
+    $P122 = $P120."trans"()
+    find_lex $P123, "self"
+    $P124 = $P122."op_func"($P123)
+    set $S105, $P124
+    concat $P120, $P119, $S105
+.annotate 'line', 240
+    concat $P122, $P120, ",       /* op_func_table */\n  "
+.annotate 'line', 250
+    find_lex $P123, "self"
+    $P125 = $P123."trans"()
+    find_lex $P126, "self"
+    $P127 = $P125."getop"($P126)
+    set $S106, $P127
+    concat $P123, $P122, $S106
+.annotate 'line', 240
+    concat $P125, $P123, "          /* op_code() */ "
+    concat $P126, $P105, $P125
+    concat $P128, $P126, "\n};\n"
+.annotate 'line', 250
+    $P129 = $P101."print"($P128)
+.annotate 'line', 231
+    .return ($P129)
+  control_1193:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Emitter"]
+.include "except_types.pasm"
+.sub "_emit_init_func"  :subid("42_1792415682.41389") :method :outer("11_1792415682.41389")
+    .param pmc param_1200
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 255
+    new $P1199, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1199, control_1198
+    push_eh $P1199
+    .lex "self", self
+    .lex "$fh", param_1200
+.annotate 'line', 257
+    new $P100, "Undef"
+    set $P1201, $P100
+    .lex "$init1", $P1201
+.annotate 'line', 258
+    new $P101, "Undef"
+    set $P1202, $P101
+    .lex "$dispatch", $P1202
+.annotate 'line', 257
+    find_lex $P102, "self"
+    $P103 = $P102."trans"()
+    $P104 = $P103."init_func_init1"()
+    store_lex "$init1", $P104
+.annotate 'line', 258
+    find_lex $P102, "self"
+    $P103 = $P102."trans"()
+    $P104 = $P103."init_func_disaptch"()
+    store_lex "$dispatch", $P104
+.annotate 'line', 261
+    find_lex $P102, "$fh"
+    new $P103, "String"
+    assign $P103, "\n\n"
+    find_lex $P104, "self"
+    $P105 = $P104."flags"()
+    set $P106, $P105["core"]
+    unless_null $P106, vivify_157
+    new $P106, "Undef"
+  vivify_157:
+    if $P106, if_1203
+    set $S100, ""
+    goto if_1203_end
+  if_1203:
+    set $S100, "PARROT_EXPORT\n"
+  if_1203_end:
+    concat $P107, $P103, $S100
+    concat $P108, $P107, "op_lib_t *\n"
+.annotate 'line', 263
+    find_lex $P109, "self"
+    $S101 = $P109."init_func"()
+    concat $P110, $P108, $S101
+    concat $P111, $P110, "(PARROT_INTERP, long init) {\n    /* initialize and return op_lib ptr */\n    if (init == 1) {\n"
+    find_lex $P112, "$init1"
+    concat $P113, $P111, $P112
+.annotate 'line', 266
+    concat $P114, $P113, "\n        return &"
+.annotate 'line', 267
+    find_lex $P115, "self"
+    $S102 = $P115."bs"()
+    concat $P116, $P114, $S102
+    concat $P117, $P116, "op_lib;\n    }\n    /* set op_lib to the passed ptr (in init) */\n    else if (init) {\n"
+    find_lex $P118, "$dispatch"
+    concat $P119, $P117, $P118
+.annotate 'line', 271
+    concat $P120, $P119, "\n    }\n    /* deinit - free resources */\n    else {\n        hop_deinit(interp);\n    }\n    return NULL;\n}\n\n"
+    $P121 = $P102."print"($P120)
+.annotate 'line', 255
+    .return ($P121)
+  control_1198:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P102, exception, "payload"
+    .return ($P102)
+.end
+
+
+.namespace ["Ops";"Emitter"]
+.include "except_types.pasm"
+.sub "_emit_dymanic_lib_load"  :subid("43_1792415682.41389") :method :outer("11_1792415682.41389")
+    .param pmc param_1207
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 283
+    new $P1206, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1206, control_1205
+    push_eh $P1206
+    .lex "self", self
+    .lex "$fh", param_1207
+.annotate 'line', 289
+    new $P100, "Undef"
+    set $P1208, $P100
+    .lex "$load_func", $P1208
+.annotate 'line', 285
+    find_lex $P101, "self"
+    $P102 = $P101."flags"()
+    set $P103, $P102["core"]
+    unless_null $P103, vivify_158
+    new $P103, "Undef"
+  vivify_158:
+    unless $P103, if_1209_end
+    get_hll_global $P104, "return"
+  if_1209_end:
+.annotate 'line', 290
+    find_lex $P101, "self"
+    $P102 = $P101."base"()
+    new $P103, "String"
+    assign $P103, "ops"
+    find_lex $P104, "self"
+    $S100 = $P104."suffix"()
+    concat $P105, $P103, $S100
+    $P106 = "join"("_", "Parrot", "lib", $P102, $P105, "load")
+.annotate 'line', 289
+    store_lex "$load_func", $P106
+.annotate 'line', 291
+    find_lex $P101, "$fh"
+.annotate 'line', 300
+    new $P102, 'String'
+    set $P102, "\n/*\n * dynamic lib load function - called once\n */\n"
+.annotate 'line', 295
+    find_lex $P103, "self"
+    $P104 = $P103."sym_export"()
+    set $S100, $P104
+    concat $P103, $P102, $S100
+.annotate 'line', 300
+    concat $P105, $P103, " PMC*\n"
+    find_lex $P106, "$load_func"
+    concat $P107, $P105, $P106
+    concat $P108, $P107, "(PARROT_INTERP);\n\n"
+.annotate 'line', 298
+    find_lex $P109, "self"
+    $P110 = $P109."sym_export"()
+    set $S101, $P110
+    concat $P109, $P108, $S101
+.annotate 'line', 300
+    concat $P111, $P109, " PMC*\n"
+    find_lex $P112, "$load_func"
+    concat $P113, $P111, $P112
+    concat $P114, $P113, "(PARROT_INTERP)\n"
+    concat $P115, $P114, "\n{\n    PMC *const lib = Parrot_pmc_new(interp, enum_class_ParrotLibrary);\n    ((Parrot_ParrotLibrary_attributes*)PMC_data(lib))->oplib_init = (void *) "
+.annotate 'line', 303
+    find_lex $P116, "self"
+    $S102 = $P116."init_func"()
+    concat $P117, $P115, $S102
+    concat $P118, $P117, ";\n    dynop_register(interp, lib);\n    return lib;\n}\n"
+    $P119 = $P101."print"($P118)
+.annotate 'line', 283
+    .return ($P119)
+  control_1205:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Emitter"]
+.include "except_types.pasm"
+.sub "_generate_guard_macro_name"  :subid("44_1792415682.41389") :method :outer("11_1792415682.41389")
+    .param pmc param_1213
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 312
+    .const 'Sub' $P1225 = "46_1792415682.41389" 
+    capture_lex $P1225
+    .const 'Sub' $P1219 = "45_1792415682.41389" 
+    capture_lex $P1219
+    new $P1212, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1212, control_1211
+    push_eh $P1212
+    .lex "self", self
+    .lex "$filename", param_1213
+.annotate 'line', 314
+    new $P100, "Undef"
+    set $P1214, $P100
+    .lex "$config", $P1214
+.annotate 'line', 315
+    new $P101, "Undef"
+    set $P1215, $P101
+    .lex "$osname", $P1215
+.annotate 'line', 320
+    $P1217 = root_new ['parrot';'ResizablePMCArray']
+    set $P1216, $P1217
+    .lex "@path", $P1216
+.annotate 'line', 313
+    find_lex $P102, "$filename"
+    get_hll_global $P103, ["Regex"], "Regex"
+    .const 'Sub' $P1219 = "45_1792415682.41389" 
+    capture_lex $P1219
+    $P104 = $P103."new"($P1219)
+    $P105 = "subst"($P102, $P104, "")
+    store_lex "$filename", $P105
+.annotate 'line', 314
+    $P102 = "_config"()
+    store_lex "$config", $P102
+.annotate 'line', 315
+    find_lex $P1222, "$config"
+    unless_null $P1222, vivify_163
+    $P1222 = root_new ['parrot';'Hash']
+  vivify_163:
+    set $P102, $P1222["osname"]
+    unless_null $P102, vivify_164
+    new $P102, "Undef"
+  vivify_164:
+    store_lex "$osname", $P102
+.annotate 'line', 316
+    find_lex $P102, "$osname"
+    set $S100, $P102
+    iseq $I100, $S100, "MSWin32"
+    unless $I100, if_1223_end
+.annotate 'line', 317
+    find_lex $P103, "$filename"
+    get_hll_global $P104, ["Regex"], "Regex"
+    .const 'Sub' $P1225 = "46_1792415682.41389" 
+    capture_lex $P1225
+    $P105 = $P104."new"($P1225)
+    $P106 = "subst"($P103, $P105, "/", 1 :named("global"))
+    store_lex "$filename", $P106
+  if_1223_end:
+.annotate 'line', 320
+    find_lex $P102, "$filename"
+    $P103 = "split"("/", $P102)
+    store_lex "@path", $P103
+.annotate 'line', 321
+    find_lex $P1229, "@path"
+    unless_null $P1229, vivify_169
+    $P1229 = root_new ['parrot';'ResizablePMCArray']
+  vivify_169:
+    set $P102, $P1229[0]
+    unless_null $P102, vivify_170
+    new $P102, "Undef"
+  vivify_170:
+    concat $P103, $P102, "/"
+    set $S100, $P103
+    find_lex $P1230, "self"
+    unless_null $P1230, vivify_171
+    $P1230 = root_new ['parrot';'Hash']
+  vivify_171:
+    set $P1231, $P1230["flags"]
+    unless_null $P1231, vivify_172
+    $P1231 = root_new ['parrot';'Hash']
+  vivify_172:
+    set $P104, $P1231["dir"]
+    unless_null $P104, vivify_173
+    new $P104, "Undef"
+  vivify_173:
+    set $S101, $P104
+    iseq $I100, $S100, $S101
+    unless $I100, if_1228_end
+    find_lex $P105, "@path"
+    $P105."shift"()
+  if_1228_end:
+.annotate 'line', 322
+    find_lex $P1233, "@path"
+    unless_null $P1233, vivify_174
+    $P1233 = root_new ['parrot';'ResizablePMCArray']
+  vivify_174:
+    set $P102, $P1233[0]
+    unless_null $P102, vivify_175
+    new $P102, "Undef"
+  vivify_175:
+    set $S100, $P102
+    iseq $I100, $S100, "include"
+    unless $I100, if_1232_end
+    find_lex $P103, "@path"
+    $P103."shift"()
+  if_1232_end:
+.annotate 'line', 323
+    find_lex $P1235, "@path"
+    unless_null $P1235, vivify_176
+    $P1235 = root_new ['parrot';'ResizablePMCArray']
+  vivify_176:
+    set $P102, $P1235[0]
+    unless_null $P102, vivify_177
+    new $P102, "Undef"
+  vivify_177:
+    set $S100, $P102
+    iseq $I100, $S100, "parrot"
+    unless $I100, if_1234_end
+    find_lex $P103, "@path"
+    $P103."shift"()
+  if_1234_end:
+.annotate 'line', 324
+    find_lex $P102, "@path"
+    $P103 = "join"("_", "parrot", $P102 :flat, "h", "guard")
+    $P104 = "uc"($P103)
+.annotate 'line', 312
+    .return ($P104)
+  control_1211:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P102, exception, "payload"
+    .return ($P102)
+.end
+
+
+.namespace ["Ops";"Emitter"]
+.sub "_block1218"  :anon :subid("45_1792415682.41389") :method :outer("44_1792415682.41389")
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 313
+    .local string rx1220_tgt
+    .local int rx1220_pos
+    .local int rx1220_off
+    .local int rx1220_eos
+    .local int rx1220_rep
+    .local pmc rx1220_cur
+    .local pmc rx1220_debug
+    (rx1220_cur, rx1220_pos, rx1220_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1220_debug, rx1220_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1220_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1220_eos, rx1220_tgt
+    gt rx1220_pos, rx1220_eos, rx1220_done
+    set rx1220_off, 0
+    lt rx1220_pos, 2, rx1220_start
+    sub rx1220_off, rx1220_pos, 1
+    substr rx1220_tgt, rx1220_tgt, rx1220_off
+  rx1220_start:
+    eq $I10, 1, rx1220_restart
+    if_null rx1220_debug, debug_159
+    rx1220_cur."!cursor_debug"("START", "")
+  debug_159:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1221_done
+    goto rxscan1221_scan
+  rxscan1221_loop:
+    ($P10) = rx1220_cur."from"()
+    inc $P10
+    set rx1220_pos, $P10
+    ge rx1220_pos, rx1220_eos, rxscan1221_done
+  rxscan1221_scan:
+    set_addr $I10, rxscan1221_loop
+    rx1220_cur."!mark_push"(0, rx1220_pos, $I10)
+  rxscan1221_done:
+  # rx charclass .
+    ge rx1220_pos, rx1220_eos, rx1220_fail
+    inc rx1220_pos
+  # rx literal  "h"
+    add $I11, rx1220_pos, 1
+    gt $I11, rx1220_eos, rx1220_fail
+    sub $I11, rx1220_pos, rx1220_off
+    ord $I11, rx1220_tgt, $I11
+    ne $I11, 104, rx1220_fail
+    add rx1220_pos, 1
+  # rxanchor eos
+    ne rx1220_pos, rx1220_eos, rx1220_fail
+  # rx pass
+    rx1220_cur."!cursor_pass"(rx1220_pos, "")
+    if_null rx1220_debug, debug_160
+    rx1220_cur."!cursor_debug"("PASS", "", " at pos=", rx1220_pos)
+  debug_160:
+    rx1220_cur."!cursor_backtrack"()
+    .return (rx1220_cur)
+  rx1220_restart:
+    if_null rx1220_debug, debug_161
+    rx1220_cur."!cursor_debug"("NEXT", "")
+  debug_161:
+  rx1220_fail:
+    (rx1220_rep, rx1220_pos, $I10, $P10) = rx1220_cur."!mark_fail"(0)
+    lt rx1220_pos, -1, rx1220_done
+    eq rx1220_pos, -1, rx1220_fail
+    jump $I10
+  rx1220_done:
+    rx1220_cur."!cursor_fail"()
+    if_null rx1220_debug, debug_162
+    rx1220_cur."!cursor_debug"("FAIL", "")
+  debug_162:
+    .return (rx1220_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Emitter"]
+.sub "_block1224"  :anon :subid("46_1792415682.41389") :method :outer("44_1792415682.41389")
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 317
+    .local string rx1226_tgt
+    .local int rx1226_pos
+    .local int rx1226_off
+    .local int rx1226_eos
+    .local int rx1226_rep
+    .local pmc rx1226_cur
+    .local pmc rx1226_debug
+    (rx1226_cur, rx1226_pos, rx1226_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1226_debug, rx1226_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1226_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1226_eos, rx1226_tgt
+    gt rx1226_pos, rx1226_eos, rx1226_done
+    set rx1226_off, 0
+    lt rx1226_pos, 2, rx1226_start
+    sub rx1226_off, rx1226_pos, 1
+    substr rx1226_tgt, rx1226_tgt, rx1226_off
+  rx1226_start:
+    eq $I10, 1, rx1226_restart
+    if_null rx1226_debug, debug_165
+    rx1226_cur."!cursor_debug"("START", "")
+  debug_165:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1227_done
+    goto rxscan1227_scan
+  rxscan1227_loop:
+    ($P10) = rx1226_cur."from"()
+    inc $P10
+    set rx1226_pos, $P10
+    ge rx1226_pos, rx1226_eos, rxscan1227_done
+  rxscan1227_scan:
+    set_addr $I10, rxscan1227_loop
+    rx1226_cur."!mark_push"(0, rx1226_pos, $I10)
+  rxscan1227_done:
+  # rx literal  "\\"
+    add $I11, rx1226_pos, 1
+    gt $I11, rx1226_eos, rx1226_fail
+    sub $I11, rx1226_pos, rx1226_off
+    ord $I11, rx1226_tgt, $I11
+    ne $I11, 92, rx1226_fail
+    add rx1226_pos, 1
+  # rx pass
+    rx1226_cur."!cursor_pass"(rx1226_pos, "")
+    if_null rx1226_debug, debug_166
+    rx1226_cur."!cursor_debug"("PASS", "", " at pos=", rx1226_pos)
+  debug_166:
+    rx1226_cur."!cursor_backtrack"()
+    .return (rx1226_cur)
+  rx1226_restart:
+    if_null rx1226_debug, debug_167
+    rx1226_cur."!cursor_debug"("NEXT", "")
+  debug_167:
+  rx1226_fail:
+    (rx1226_rep, rx1226_pos, $I10, $P10) = rx1226_cur."!mark_fail"(0)
+    lt rx1226_pos, -1, rx1226_done
+    eq rx1226_pos, -1, rx1226_fail
+    jump $I10
+  rx1226_done:
+    rx1226_cur."!cursor_fail"()
+    if_null rx1226_debug, debug_168
+    rx1226_cur."!cursor_debug"("FAIL", "")
+  debug_168:
+    .return (rx1226_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Emitter"]
+.include "except_types.pasm"
+.sub "_emit_guard_prefix"  :subid("47_1792415682.41389") :method :outer("11_1792415682.41389")
+    .param pmc param_1239
+    .param pmc param_1240
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 328
+    new $P1238, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1238, control_1237
+    push_eh $P1238
+    .lex "self", self
+    .lex "$fh", param_1239
+    .lex "$filename", param_1240
+.annotate 'line', 329
+    new $P100, "Undef"
+    set $P1241, $P100
+    .lex "$guardname", $P1241
+    find_lex $P101, "self"
+    find_lex $P102, "$filename"
+    $P103 = $P101."_generate_guard_macro_name"($P102)
+    store_lex "$guardname", $P103
+.annotate 'line', 330
+    find_lex $P101, "$fh"
+    new $P102, 'String'
+    set $P102, "\n#ifndef "
+    find_lex $P103, "$guardname"
+    concat $P104, $P102, $P103
+    concat $P105, $P104, "\n#define "
+    find_lex $P106, "$guardname"
+    concat $P107, $P105, $P106
+    concat $P108, $P107, "\n\n"
+    $P109 = $P101."print"($P108)
+.annotate 'line', 328
+    .return ($P109)
+  control_1237:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Emitter"]
+.include "except_types.pasm"
+.sub "_emit_guard_suffix"  :subid("48_1792415682.41389") :method :outer("11_1792415682.41389")
+    .param pmc param_1245
+    .param pmc param_1246
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 337
+    new $P1244, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1244, control_1243
+    push_eh $P1244
+    .lex "self", self
+    .lex "$fh", param_1245
+    .lex "$filename", param_1246
+.annotate 'line', 338
+    new $P100, "Undef"
+    set $P1247, $P100
+    .lex "$guardname", $P1247
+    find_lex $P101, "self"
+    find_lex $P102, "$filename"
+    $P103 = $P101."_generate_guard_macro_name"($P102)
+    store_lex "$guardname", $P103
+.annotate 'line', 339
+    find_lex $P101, "$fh"
+    new $P102, 'String'
+    set $P102, "\n\n#endif /* "
+    find_lex $P103, "$guardname"
+    concat $P104, $P102, $P103
+    concat $P105, $P104, " */\n"
+    $P106 = $P101."print"($P105)
+.annotate 'line', 337
+    .return ($P106)
+  control_1243:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Emitter"]
+.include "except_types.pasm"
+.sub "_emit_coda"  :subid("49_1792415682.41389") :method :outer("11_1792415682.41389")
+    .param pmc param_1251
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 346
+    new $P1250, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1250, control_1249
+    push_eh $P1250
+    .lex "self", self
+    .lex "$fh", param_1251
+.annotate 'line', 347
+    find_lex $P100, "$fh"
+    $P101 = $P100."print"("\n\n/*\n * Local variables:\n *   c-file-style: \"parrot\"\n *   buffer-read-only: t\n * End:\n * vim: expandtab shiftwidth=4:\n */\n")
+.annotate 'line', 346
+    .return ($P101)
+  control_1249:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P100, exception, "payload"
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Emitter"]
+.include "except_types.pasm"
+.sub "_emit_includes"  :subid("50_1792415682.41389") :method :outer("11_1792415682.41389")
+    .param pmc param_1255
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 359
+    new $P1254, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1254, control_1253
+    push_eh $P1254
+    .lex "self", self
+    .lex "$fh", param_1255
+.annotate 'line', 361
+    find_lex $P100, "$fh"
+.annotate 'line', 366
+    new $P101, "String"
+    assign $P101, "\n#include \"parrot/parrot.h\"\n#include \"parrot/oplib.h\"\n#include \"parrot/runcore_api.h\"\n\n"
+    find_lex $P102, "self"
+    $P103 = $P102."flags"()
+    set $P104, $P103["core"]
+    unless_null $P104, vivify_178
+    new $P104, "Undef"
+  vivify_178:
+    if $P104, if_1256
+    set $S100, ""
+    goto if_1256_end
+  if_1256:
+    set $S100, "PARROT_EXPORT"
+  if_1256_end:
+    concat $P105, $P101, $S100
+    new $P106, 'String'
+    set $P106, "\nop_lib_t *"
+.annotate 'line', 367
+    find_lex $P107, "self"
+    $P108 = $P107."init_func"()
+    set $S101, $P108
+    concat $P107, $P106, $S101
+.annotate 'line', 366
+    concat $P109, $P107, "(PARROT_INTERP, long init);\n\n"
+    concat $P110, $P105, $P109
+    $P111 = $P100."print"($P110)
+.annotate 'line', 359
+    .return ($P111)
+  control_1253:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P100, exception, "payload"
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Emitter"]
+.include "except_types.pasm"
+.sub "_emit_preamble"  :subid("51_1792415682.41389") :method :outer("11_1792415682.41389")
+    .param pmc param_1260
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 372
+    new $P1259, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1259, control_1258
+    push_eh $P1259
+    .lex "self", self
+    .lex "$fh", param_1260
+.annotate 'line', 374
+    find_lex $P100, "$fh"
+    new $P101, 'String'
+    set $P101, "/* ex: set ro:\n * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!\n *\n * This file is generated automatically from '"
+.annotate 'line', 377
+    find_lex $P1261, "self"
+    unless_null $P1261, vivify_179
+    $P1261 = root_new ['parrot';'Hash']
+  vivify_179:
+    set $P102, $P1261["file"]
+    unless_null $P102, vivify_180
+    new $P102, "Undef"
+  vivify_180:
+    set $S100, $P102
+    concat $P103, $P101, $S100
+.annotate 'line', 374
+    concat $P104, $P103, "' (and possibly other\n * .ops files). by "
+.annotate 'line', 378
+    find_lex $P1262, "self"
+    unless_null $P1262, vivify_181
+    $P1262 = root_new ['parrot';'Hash']
+  vivify_181:
+    set $P105, $P1262["script"]
+    unless_null $P105, vivify_182
+    new $P105, "Undef"
+  vivify_182:
+    set $S101, $P105
+    concat $P106, $P104, $S101
+.annotate 'line', 374
+    concat $P107, $P106, ".\n *\n * Any changes made here will be lost!  To regenerate this file after making\n * changes to any ops, use the bootstrap-ops makefile target.\n *\n */\n"
+    $P100."print"($P107)
+.annotate 'line', 386
+    find_lex $P101, "self"
+    $P102 = $P101."flags"()
+    set $P103, $P102["core"]
+    unless_null $P103, vivify_183
+    new $P103, "Undef"
+  vivify_183:
+    isfalse $I100, $P103
+    if $I100, if_1263
+    new $P100, 'Integer'
+    set $P100, $I100
+    goto if_1263_end
+  if_1263:
+.annotate 'line', 387
+    find_lex $P104, "$fh"
+    $P105 = $P104."print"("#define PARROT_IN_EXTENSION\n")
+.annotate 'line', 386
+    set $P100, $P105
+  if_1263_end:
+.annotate 'line', 372
+    .return ($P100)
+  control_1258:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Emitter"]
+.sub "_block1265" :load :anon :subid("52_1792415682.41389")
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 12
+    .const '' $P1267 = "11_1792415682.41389" 
+    $P100 = $P1267()
+    .return ($P100)
+.end
+
+
+.namespace []
+.sub "_block1268" :load :anon :subid("53_1792415682.41389")
+.annotate 'file', "compilers/opsc/src/Ops/Emitter.pm"
+.annotate 'line', 1
+    .const '' $P1270 = "10_1792415682.41389" 
+    $P100 = $P1270()
+    .return ($P100)
+.end
+
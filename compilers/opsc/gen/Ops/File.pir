@@ -0,0 +1,1181 @@
+
+.namespace []
+.sub "_block1000"  :anon :subid("10_1792415677.14453")
+.annotate 'file', "compilers/opsc/src/Ops/File.pm"
+.annotate 'line', 0
+    .const 'Sub' $P1003 = "11_1792415677.14453" 
+    capture_lex $P1003
+.annotate 'line', 1
+    $P0 = find_dynamic_lex "$*CTXSAVE"
+    if null $P0 goto ctxsave_done
+    $I0 = can $P0, "ctxsave"
+    unless $I0 goto ctxsave_done
+    $P0."ctxsave"()
+  ctxsave_done:
+.annotate 'line', 168
+    .const 'Sub' $P1003 = "11_1792415677.14453" 
+    capture_lex $P1003
+    $P101 = $P1003()
+.annotate 'line', 1
+    .return ($P101)
+    .const 'Sub' $P1139 = "31_1792415677.14453" 
+    .return ($P1139)
+.end
+
+
+.namespace []
+.sub "" :load :init :subid("post32") :outer("10_1792415677.14453")
+.annotate 'file', "compilers/opsc/src/Ops/File.pm"
+.annotate 'line', 0
+    .const 'Sub' $P1001 = "10_1792415677.14453" 
+    .local pmc block
+    set block, $P1001
+    $P1141 = get_root_global ["parrot"], "P6metaclass"
+    $P1141."new_class"("Ops::File", "Hash" :named("parent"))
+.end
+
+
+.namespace ["Ops";"File"]
+.sub "_block1002"  :subid("11_1792415677.14453") :outer("10_1792415677.14453")
+.annotate 'file', "compilers/opsc/src/Ops/File.pm"
+.annotate 'line', 168
+    .const 'Sub' $P1123 = "29_1792415677.14453" 
+    capture_lex $P1123
+    .const 'Sub' $P1112 = "27_1792415677.14453" 
+    capture_lex $P1112
+    .const 'Sub' $P1108 = "26_1792415677.14453" 
+    capture_lex $P1108
+    .const 'Sub' $P1104 = "25_1792415677.14453" 
+    capture_lex $P1104
+    .const 'Sub' $P1100 = "24_1792415677.14453" 
+    capture_lex $P1100
+    .const 'Sub' $P1096 = "23_1792415677.14453" 
+    capture_lex $P1096
+    .const 'Sub' $P1092 = "22_1792415677.14453" 
+    capture_lex $P1092
+    .const 'Sub' $P1088 = "21_1792415677.14453" 
+    capture_lex $P1088
+    .const 'Sub' $P1083 = "20_1792415677.14453" 
+    capture_lex $P1083
+    .const 'Sub' $P1059 = "17_1792415677.14453" 
+    capture_lex $P1059
+    .const 'Sub' $P1038 = "15_1792415677.14453" 
+    capture_lex $P1038
+    .const 'Sub' $P1028 = "14_1792415677.14453" 
+    capture_lex $P1028
+    .const 'Sub' $P1004 = "12_1792415677.14453" 
+    capture_lex $P1004
+    $P0 = find_dynamic_lex "$*CTXSAVE"
+    if null $P0 goto ctxsave_done
+    $I0 = can $P0, "ctxsave"
+    unless $I0 goto ctxsave_done
+    $P0."ctxsave"()
+  ctxsave_done:
+    load_bytecode "config.pbc"
+.annotate 'line', 295
+    .const 'Sub' $P1123 = "29_1792415677.14453" 
+    newclosure $P1134, $P1123
+.annotate 'line', 168
+    .return ($P1134)
+    .const 'Sub' $P1136 = "30_1792415677.14453" 
+    .return ($P1136)
+.end
+
+
+.namespace ["Ops";"File"]
+.include "except_types.pasm"
+.sub "new"  :subid("12_1792415677.14453") :method :outer("11_1792415677.14453")
+    .param pmc param_1007 :slurpy
+    .param pmc param_1009 :named("core")
+    .param pmc param_1008 :optional :named("oplib")
+    .param int has_param_1008 :opt_flag
+    .param pmc param_1010 :optional :named("nolines")
+    .param int has_param_1010 :opt_flag
+    .param pmc param_1011 :optional :named("quiet")
+    .param int has_param_1011 :opt_flag
+.annotate 'file', "compilers/opsc/src/Ops/File.pm"
+.annotate 'line', 184
+    .const 'Sub' $P1025 = "13_1792415677.14453" 
+    capture_lex $P1025
+    new $P1006, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1006, control_1005
+    push_eh $P1006
+    .lex "self", self
+    .lex "@files", param_1007
+    if has_param_1008, optparam_33
+    new $P100, "Undef"
+    set param_1008, $P100
+  optparam_33:
+    .lex "$oplib", param_1008
+    .lex "$core", param_1009
+    if has_param_1010, optparam_34
+    new $P101, "Undef"
+    set param_1010, $P101
+  optparam_34:
+    .lex "$nolines", param_1010
+    if has_param_1011, optparam_35
+    new $P102, "Integer"
+    assign $P102, 0
+    set param_1011, $P102
+  optparam_35:
+    .lex "$quiet", param_1011
+.annotate 'line', 185
+    find_lex $P103, "@files"
+    find_lex $P1012, "self"
+    unless_null $P1012, vivify_36
+    $P1012 = root_new ['parrot';'Hash']
+    store_lex "self", $P1012
+  vivify_36:
+    set $P1012["files"], $P103
+.annotate 'line', 186
+    find_lex $P103, "$core"
+    find_lex $P1013, "self"
+    unless_null $P1013, vivify_37
+    $P1013 = root_new ['parrot';'Hash']
+    store_lex "self", $P1013
+  vivify_37:
+    set $P1013["core"], $P103
+.annotate 'line', 187
+    $P103 = "list"()
+    find_lex $P1014, "self"
+    unless_null $P1014, vivify_38
+    $P1014 = root_new ['parrot';'Hash']
+    store_lex "self", $P1014
+  vivify_38:
+    set $P1014["ops"], $P103
+.annotate 'line', 188
+    new $P103, "String"
+    assign $P103, ""
+    find_lex $P1015, "self"
+    unless_null $P1015, vivify_39
+    $P1015 = root_new ['parrot';'Hash']
+    store_lex "self", $P1015
+  vivify_39:
+    set $P1015["preamble"], $P103
+.annotate 'line', 189
+    compreg $P103, "Ops"
+    find_lex $P1016, "self"
+    unless_null $P1016, vivify_40
+    $P1016 = root_new ['parrot';'Hash']
+    store_lex "self", $P1016
+  vivify_40:
+    set $P1016["compiler"], $P103
+.annotate 'line', 190
+    new $P103, "Integer"
+    assign $P103, 0
+    find_lex $P1017, "self"
+    unless_null $P1017, vivify_41
+    $P1017 = root_new ['parrot';'Hash']
+    store_lex "self", $P1017
+  vivify_41:
+    set $P1017["op_order"], $P103
+.annotate 'line', 191
+    find_lex $P103, "$quiet"
+    find_lex $P1018, "self"
+    unless_null $P1018, vivify_42
+    $P1018 = root_new ['parrot';'Hash']
+    store_lex "self", $P1018
+  vivify_42:
+    set $P1018["quiet"], $P103
+.annotate 'line', 193
+    find_lex $P103, "$core"
+    if $P103, if_1019
+.annotate 'line', 198
+    find_lex $P1022, "@files"
+    unless_null $P1022, vivify_43
+    $P1022 = root_new ['parrot';'ResizablePMCArray']
+  vivify_43:
+    set $P104, $P1022[0]
+    unless_null $P104, vivify_44
+    new $P104, "Undef"
+  vivify_44:
+    find_lex $P1023, "self"
+    unless_null $P1023, vivify_45
+    $P1023 = root_new ['parrot';'Hash']
+    store_lex "self", $P1023
+  vivify_45:
+    set $P1023["file"], $P104
+.annotate 'line', 197
+    goto if_1019_end
+  if_1019:
+.annotate 'line', 194
+    find_lex $P104, "$oplib"
+    find_lex $P1020, "self"
+    unless_null $P1020, vivify_46
+    $P1020 = root_new ['parrot';'Hash']
+    store_lex "self", $P1020
+  vivify_46:
+    set $P1020["oplib"], $P104
+.annotate 'line', 195
+    find_lex $P1021, "self"
+    unless_null $P1021, vivify_47
+    $P1021 = root_new ['parrot';'Hash']
+  vivify_47:
+    set $P104, $P1021["compiler"]
+    unless_null $P104, vivify_48
+    new $P104, "Undef"
+  vivify_48:
+    find_lex $P105, "$oplib"
+    $P104."set_oplib"($P105)
+  if_1019_end:
+.annotate 'line', 201
+    find_lex $P103, "self"
+    $P103."_set_version"()
+.annotate 'line', 203
+    find_lex $P104, "@files"
+    defined $I100, $P104
+    unless $I100, for_undef_49
+    iter $P103, $P104
+    new $P106, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P106, loop1027_handler
+    push_eh $P106
+  loop1027_test:
+    unless $P103, loop1027_done
+    shift $P105, $P103
+  loop1027_redo:
+    .const 'Sub' $P1025 = "13_1792415677.14453" 
+    capture_lex $P1025
+    $P1025($P105)
+  loop1027_next:
+    goto loop1027_test
+  loop1027_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P107, exception, 'type'
+    eq $P107, .CONTROL_LOOP_NEXT, loop1027_next
+    eq $P107, .CONTROL_LOOP_REDO, loop1027_redo
+  loop1027_done:
+    pop_eh 
+  for_undef_49:
+.annotate 'line', 205
+    find_lex $P103, "self"
+    $P103."_calculate_op_codes"()
+.annotate 'line', 184
+    find_lex $P103, "self"
+    .return ($P103)
+  control_1005:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P104, exception, "payload"
+    .return ($P104)
+.end
+
+
+.namespace ["Ops";"File"]
+.sub "_block1024"  :anon :subid("13_1792415677.14453") :outer("12_1792415677.14453")
+    .param pmc param_1026
+.annotate 'file', "compilers/opsc/src/Ops/File.pm"
+.annotate 'line', 203
+    .lex "$_", param_1026
+    find_lex $P106, "self"
+    find_lex $P107, "$_"
+    find_lex $P108, "$nolines"
+    $P109 = $P106."read_ops"($P107, $P108)
+    .return ($P109)
+.end
+
+
+.namespace ["Ops";"File"]
+.include "except_types.pasm"
+.sub "new_str"  :subid("14_1792415677.14453") :method :outer("11_1792415677.14453")
+    .param pmc param_1031
+    .param pmc param_1032 :optional :named("oplib")
+    .param int has_param_1032 :opt_flag
+.annotate 'file', "compilers/opsc/src/Ops/File.pm"
+.annotate 'line', 210
+    new $P1030, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1030, control_1029
+    push_eh $P1030
+    .lex "self", self
+    .lex "$str", param_1031
+    if has_param_1032, optparam_50
+    new $P100, "Undef"
+    set param_1032, $P100
+  optparam_50:
+    .lex "$oplib", param_1032
+.annotate 'line', 211
+    $P101 = "list"()
+    find_lex $P1033, "self"
+    unless_null $P1033, vivify_51
+    $P1033 = root_new ['parrot';'Hash']
+    store_lex "self", $P1033
+  vivify_51:
+    set $P1033["ops"], $P101
+.annotate 'line', 212
+    new $P101, "String"
+    assign $P101, ""
+    find_lex $P1034, "self"
+    unless_null $P1034, vivify_52
+    $P1034 = root_new ['parrot';'Hash']
+    store_lex "self", $P1034
+  vivify_52:
+    set $P1034["preamble"], $P101
+.annotate 'line', 214
+    compreg $P101, "Ops"
+    find_lex $P1035, "self"
+    unless_null $P1035, vivify_53
+    $P1035 = root_new ['parrot';'Hash']
+    store_lex "self", $P1035
+  vivify_53:
+    set $P1035["compiler"], $P101
+.annotate 'line', 215
+    find_lex $P101, "$oplib"
+    find_lex $P1036, "self"
+    unless_null $P1036, vivify_54
+    $P1036 = root_new ['parrot';'Hash']
+    store_lex "self", $P1036
+  vivify_54:
+    set $P1036["oplib"], $P101
+.annotate 'line', 216
+    find_lex $P1037, "self"
+    unless_null $P1037, vivify_55
+    $P1037 = root_new ['parrot';'Hash']
+  vivify_55:
+    set $P101, $P1037["compiler"]
+    unless_null $P101, vivify_56
+    new $P101, "Undef"
+  vivify_56:
+    find_lex $P102, "$oplib"
+    $P101."set_oplib"($P102)
+.annotate 'line', 218
+    find_lex $P101, "self"
+    $P101."_set_version"()
+.annotate 'line', 220
+    find_lex $P101, "self"
+    find_lex $P102, "$str"
+    $P101."compile_ops"($P102)
+.annotate 'line', 210
+    find_lex $P101, "self"
+    .return ($P101)
+  control_1029:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P102, exception, "payload"
+    .return ($P102)
+.end
+
+
+.namespace ["Ops";"File"]
+.include "except_types.pasm"
+.sub "read_ops"  :subid("15_1792415677.14453") :method :outer("11_1792415677.14453")
+    .param pmc param_1041
+    .param pmc param_1042
+.annotate 'file', "compilers/opsc/src/Ops/File.pm"
+.annotate 'line', 240
+    .const 'Sub' $P1053 = "16_1792415677.14453" 
+    capture_lex $P1053
+    new $P1040, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1040, control_1039
+    push_eh $P1040
+    .lex "self", self
+    .lex "$file", param_1041
+    .lex "$nolines", param_1042
+.annotate 'line', 244
+    new $P100, "Undef"
+    set $P1043, $P100
+    .lex "$start_time", $P1043
+.annotate 'line', 245
+    new $P101, "Undef"
+    set $P1044, $P101
+    .lex "$buffer", $P1044
+.annotate 'line', 246
+    new $P102, "Undef"
+    set $P1045, $P102
+    .lex "$start_ops", $P1045
+.annotate 'line', 248
+    new $P103, "Undef"
+    set $P1046, $P103
+    .lex "$end_ops", $P1046
+.annotate 'line', 249
+    new $P104, "Undef"
+    set $P1047, $P104
+    .lex "$time", $P1047
+.annotate 'line', 241
+    find_lex $P1048, "self"
+    unless_null $P1048, vivify_57
+    $P1048 = root_new ['parrot';'Hash']
+  vivify_57:
+    set $P105, $P1048["oplib"]
+    unless_null $P105, vivify_58
+    new $P105, "Undef"
+  vivify_58:
+    set_hll_global ["Ops";"Compiler";"Actions"], "$OPLIB", $P105
+.annotate 'line', 243
+    find_lex $P1050, "self"
+    unless_null $P1050, vivify_59
+    $P1050 = root_new ['parrot';'Hash']
+  vivify_59:
+    set $P105, $P1050["quiet"]
+    unless_null $P105, vivify_60
+    new $P105, "Undef"
+  vivify_60:
+    if $P105, unless_1049_end
+    new $P106, 'String'
+    set $P106, "# Parsing "
+    find_lex $P107, "$file"
+    concat $P108, $P106, $P107
+    concat $P109, $P108, "..."
+    "say"($P109)
+  unless_1049_end:
+.annotate 'line', 244
+    time $N100
+    new $P105, 'Float'
+    set $P105, $N100
+    store_lex "$start_time", $P105
+.annotate 'line', 245
+    find_lex $P105, "$file"
+    $P106 = "transcode_slurp"($P105)
+    store_lex "$buffer", $P106
+.annotate 'line', 246
+    find_lex $P1051, "self"
+    unless_null $P1051, vivify_61
+    $P1051 = root_new ['parrot';'Hash']
+  vivify_61:
+    set $P105, $P1051["ops"]
+    unless_null $P105, vivify_62
+    new $P105, "Undef"
+  vivify_62:
+    set $N100, $P105
+    new $P106, 'Float'
+    set $P106, $N100
+    store_lex "$start_ops", $P106
+.annotate 'line', 247
+    find_lex $P105, "self"
+    find_lex $P106, "$buffer"
+    get_hll_global $P107, ["Regex"], "Regex"
+    .const 'Sub' $P1053 = "16_1792415677.14453" 
+    capture_lex $P1053
+    $P108 = $P107."new"($P1053)
+    find_lex $P109, "$file"
+    $P110 = $P108."ACCEPTS"($P109)
+    $P105."compile_ops"($P106, $P110 :named("experimental"))
+.annotate 'line', 248
+    find_lex $P1056, "self"
+    unless_null $P1056, vivify_67
+    $P1056 = root_new ['parrot';'Hash']
+  vivify_67:
+    set $P105, $P1056["ops"]
+    unless_null $P105, vivify_68
+    new $P105, "Undef"
+  vivify_68:
+    set $N100, $P105
+    new $P106, 'Float'
+    set $P106, $N100
+    store_lex "$end_ops", $P106
+.annotate 'line', 249
+    find_lex $P105, "$time"
+    new $P106, "String"
+    assign $P106, "%.3f"
+    time $N100
+    new $P107, 'Float'
+    set $P107, $N100
+    find_lex $P108, "$start_time"
+    sub $P109, $P107, $P108
+    new $P110, "ResizablePMCArray"
+    push $P110, $P109
+    sprintf $P105, $P106, $P110
+.annotate 'line', 250
+    find_lex $P1058, "self"
+    unless_null $P1058, vivify_69
+    $P1058 = root_new ['parrot';'Hash']
+  vivify_69:
+    set $P106, $P1058["quiet"]
+    unless_null $P106, vivify_70
+    new $P106, "Undef"
+  vivify_70:
+    unless $P106, unless_1057
+    set $P105, $P106
+    goto unless_1057_end
+  unless_1057:
+    new $P107, 'String'
+    set $P107, "# Parsed "
+    find_lex $P108, "$file"
+    concat $P109, $P107, $P108
+    concat $P110, $P109, " in "
+    find_lex $P111, "$time"
+    concat $P112, $P110, $P111
+    concat $P113, $P112, " seconds; found "
+.annotate 'line', 251
+    find_lex $P114, "$end_ops"
+    find_lex $P115, "$start_ops"
+    sub $P116, $P114, $P115
+    concat $P117, $P113, $P116
+.annotate 'line', 250
+    concat $P118, $P117, " ops."
+.annotate 'line', 251
+    $P119 = "say"($P118)
+.annotate 'line', 250
+    set $P105, $P119
+  unless_1057_end:
+.annotate 'line', 240
+    .return ($P105)
+  control_1039:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P106, exception, "payload"
+    .return ($P106)
+.end
+
+
+.namespace ["Ops";"File"]
+.sub "_block1052"  :anon :subid("16_1792415677.14453") :method :outer("15_1792415677.14453")
+.annotate 'file', "compilers/opsc/src/Ops/File.pm"
+.annotate 'line', 247
+    .local string rx1054_tgt
+    .local int rx1054_pos
+    .local int rx1054_off
+    .local int rx1054_eos
+    .local int rx1054_rep
+    .local pmc rx1054_cur
+    .local pmc rx1054_debug
+    (rx1054_cur, rx1054_pos, rx1054_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1054_debug, rx1054_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1054_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1054_eos, rx1054_tgt
+    gt rx1054_pos, rx1054_eos, rx1054_done
+    set rx1054_off, 0
+    lt rx1054_pos, 2, rx1054_start
+    sub rx1054_off, rx1054_pos, 1
+    substr rx1054_tgt, rx1054_tgt, rx1054_off
+  rx1054_start:
+    eq $I10, 1, rx1054_restart
+    if_null rx1054_debug, debug_63
+    rx1054_cur."!cursor_debug"("START", "")
+  debug_63:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1055_done
+    goto rxscan1055_scan
+  rxscan1055_loop:
+    ($P10) = rx1054_cur."from"()
+    inc $P10
+    set rx1054_pos, $P10
+    ge rx1054_pos, rx1054_eos, rxscan1055_done
+  rxscan1055_scan:
+    set_addr $I10, rxscan1055_loop
+    rx1054_cur."!mark_push"(0, rx1054_pos, $I10)
+  rxscan1055_done:
+  # rx literal  "experimental.ops"
+    add $I11, rx1054_pos, 16
+    gt $I11, rx1054_eos, rx1054_fail
+    sub $I11, rx1054_pos, rx1054_off
+    substr $S10, rx1054_tgt, $I11, 16
+    ne $S10, "experimental.ops", rx1054_fail
+    add rx1054_pos, 16
+  # rx pass
+    rx1054_cur."!cursor_pass"(rx1054_pos, "")
+    if_null rx1054_debug, debug_64
+    rx1054_cur."!cursor_debug"("PASS", "", " at pos=", rx1054_pos)
+  debug_64:
+    rx1054_cur."!cursor_backtrack"()
+    .return (rx1054_cur)
+  rx1054_restart:
+    if_null rx1054_debug, debug_65
+    rx1054_cur."!cursor_debug"("NEXT", "")
+  debug_65:
+  rx1054_fail:
+    (rx1054_rep, rx1054_pos, $I10, $P10) = rx1054_cur."!mark_fail"(0)
+    lt rx1054_pos, -1, rx1054_done
+    eq rx1054_pos, -1, rx1054_fail
+    jump $I10
+  rx1054_done:
+    rx1054_cur."!cursor_fail"()
+    if_null rx1054_debug, debug_66
+    rx1054_cur."!cursor_debug"("FAIL", "")
+  debug_66:
+    .return (rx1054_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"File"]
+.include "except_types.pasm"
+.sub "compile_ops"  :subid("17_1792415677.14453") :method :outer("11_1792415677.14453")
+    .param pmc param_1062
+    .param pmc param_1063 :optional :named("experimental")
+    .param int has_param_1063 :opt_flag
+.annotate 'file', "compilers/opsc/src/Ops/File.pm"
+.annotate 'line', 254
+    .const 'Sub' $P1078 = "19_1792415677.14453" 
+    capture_lex $P1078
+    .const 'Sub' $P1069 = "18_1792415677.14453" 
+    capture_lex $P1069
+    new $P1061, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1061, control_1060
+    push_eh $P1061
+    .lex "self", self
+    .lex "$str", param_1062
+    if has_param_1063, optparam_71
+    new $P100, "Integer"
+    assign $P100, 0
+    set param_1063, $P100
+  optparam_71:
+    .lex "$experimental", param_1063
+.annotate 'line', 255
+    new $P101, "Undef"
+    set $P1064, $P101
+    .lex "$compiler", $P1064
+.annotate 'line', 256
+    new $P102, "Undef"
+    set $P1065, $P102
+    .lex "$past", $P1065
+.annotate 'line', 255
+    find_lex $P1066, "self"
+    unless_null $P1066, vivify_72
+    $P1066 = root_new ['parrot';'Hash']
+  vivify_72:
+    set $P103, $P1066["compiler"]
+    unless_null $P103, vivify_73
+    new $P103, "Undef"
+  vivify_73:
+    store_lex "$compiler", $P103
+.annotate 'line', 256
+    find_lex $P103, "$compiler"
+    find_lex $P104, "$str"
+    $P105 = $P103."compile"($P104, "past" :named("target"))
+    store_lex "$past", $P105
+.annotate 'line', 258
+    find_lex $P1067, "$past"
+    unless_null $P1067, vivify_74
+    $P1067 = root_new ['parrot';'Hash']
+  vivify_74:
+    set $P104, $P1067["ops"]
+    unless_null $P104, vivify_75
+    new $P104, "Undef"
+  vivify_75:
+    $P105 = $P104."list"()
+    defined $I100, $P105
+    unless $I100, for_undef_76
+    iter $P103, $P105
+    new $P107, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P107, loop1075_handler
+    push_eh $P107
+  loop1075_test:
+    unless $P103, loop1075_done
+    shift $P106, $P103
+  loop1075_redo:
+    .const 'Sub' $P1069 = "18_1792415677.14453" 
+    capture_lex $P1069
+    $P1069($P106)
+  loop1075_next:
+    goto loop1075_test
+  loop1075_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P108, exception, 'type'
+    eq $P108, .CONTROL_LOOP_NEXT, loop1075_next
+    eq $P108, .CONTROL_LOOP_REDO, loop1075_redo
+  loop1075_done:
+    pop_eh 
+  for_undef_76:
+.annotate 'line', 266
+    find_lex $P1076, "$past"
+    unless_null $P1076, vivify_82
+    $P1076 = root_new ['parrot';'Hash']
+  vivify_82:
+    set $P104, $P1076["preamble"]
+    unless_null $P104, vivify_83
+    new $P104, "Undef"
+  vivify_83:
+    $P105 = $P104."list"()
+    defined $I100, $P105
+    unless $I100, for_undef_84
+    iter $P103, $P105
+    new $P107, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P107, loop1082_handler
+    push_eh $P107
+  loop1082_test:
+    unless $P103, loop1082_done
+    shift $P106, $P103
+  loop1082_redo:
+    .const 'Sub' $P1078 = "19_1792415677.14453" 
+    capture_lex $P1078
+    $P1078($P106)
+  loop1082_next:
+    goto loop1082_test
+  loop1082_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P108, exception, 'type'
+    eq $P108, .CONTROL_LOOP_NEXT, loop1082_next
+    eq $P108, .CONTROL_LOOP_REDO, loop1082_redo
+  loop1082_done:
+    pop_eh 
+  for_undef_84:
+.annotate 'line', 254
+    find_lex $P103, "$past"
+    .return ($P103)
+  control_1060:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P104, exception, "payload"
+    .return ($P104)
+.end
+
+
+.namespace ["Ops";"File"]
+.sub "_block1068"  :anon :subid("18_1792415677.14453") :outer("17_1792415677.14453")
+    .param pmc param_1070
+.annotate 'file', "compilers/opsc/src/Ops/File.pm"
+.annotate 'line', 258
+    .lex "$_", param_1070
+.annotate 'line', 259
+    find_lex $P107, "$_"
+    find_lex $P108, "$experimental"
+    $P107."experimental"($P108)
+.annotate 'line', 260
+    find_lex $P107, "$_"
+    find_lex $P109, "$_"
+    $P110 = $P109."flags"()
+    set $P111, $P110["deprecated"]
+    unless_null $P111, vivify_77
+    new $P111, "Undef"
+  vivify_77:
+    if $P111, if_1071
+    new $P113, "Integer"
+    assign $P113, 0
+    set $P108, $P113
+    goto if_1071_end
+  if_1071:
+    new $P112, "Integer"
+    assign $P112, 1
+    set $P108, $P112
+  if_1071_end:
+    $P107."deprecated"($P108)
+.annotate 'line', 261
+    find_lex $P1072, "self"
+    unless_null $P1072, vivify_78
+    $P1072 = root_new ['parrot';'Hash']
+  vivify_78:
+    set $P107, $P1072["ops"]
+    unless_null $P107, vivify_79
+    new $P107, "Undef"
+  vivify_79:
+    find_lex $P108, "$_"
+    $P107."push"($P108)
+.annotate 'line', 258
+    find_lex $P1073, "self"
+    unless_null $P1073, vivify_80
+    $P1073 = root_new ['parrot';'Hash']
+  vivify_80:
+    set $P107, $P1073["op_order"]
+    unless_null $P107, vivify_81
+    new $P107, "Undef"
+  vivify_81:
+    clone $P1074, $P107
+    inc $P107
+    .return ($P1074)
+.end
+
+
+.namespace ["Ops";"File"]
+.sub "_block1077"  :anon :subid("19_1792415677.14453") :outer("17_1792415677.14453")
+    .param pmc param_1079
+.annotate 'file', "compilers/opsc/src/Ops/File.pm"
+.annotate 'line', 266
+    .lex "$_", param_1079
+.annotate 'line', 267
+    find_lex $P1080, "self"
+    unless_null $P1080, vivify_85
+    $P1080 = root_new ['parrot';'Hash']
+  vivify_85:
+    set $P107, $P1080["preamble"]
+    unless_null $P107, vivify_86
+    new $P107, "Undef"
+  vivify_86:
+    find_lex $P108, "$_"
+    concat $P109, $P107, $P108
+    find_lex $P1081, "self"
+    unless_null $P1081, vivify_87
+    $P1081 = root_new ['parrot';'Hash']
+    store_lex "self", $P1081
+  vivify_87:
+    set $P1081["preamble"], $P109
+.annotate 'line', 266
+    .return ($P109)
+.end
+
+
+.namespace ["Ops";"File"]
+.include "except_types.pasm"
+.sub "get_parse_tree"  :subid("20_1792415677.14453") :method :outer("11_1792415677.14453")
+    .param pmc param_1086
+.annotate 'file', "compilers/opsc/src/Ops/File.pm"
+.annotate 'line', 272
+    new $P1085, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1085, control_1084
+    push_eh $P1085
+    .lex "self", self
+    .lex "$str", param_1086
+.annotate 'line', 273
+    new $P100, "Undef"
+    set $P1087, $P100
+    .lex "$compiler", $P1087
+    compreg $P101, "Ops"
+    store_lex "$compiler", $P101
+.annotate 'line', 274
+    find_lex $P101, "$compiler"
+    find_lex $P102, "$str"
+    $P103 = $P101."compile"($P102, "parse" :named("target"))
+.annotate 'line', 272
+    .return ($P103)
+  control_1084:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"File"]
+.include "except_types.pasm"
+.sub "preamble"  :subid("21_1792415677.14453") :method :outer("11_1792415677.14453")
+.annotate 'file', "compilers/opsc/src/Ops/File.pm"
+.annotate 'line', 277
+    new $P1090, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1090, control_1089
+    push_eh $P1090
+    .lex "self", self
+    find_lex $P1091, "self"
+    unless_null $P1091, vivify_88
+    $P1091 = root_new ['parrot';'Hash']
+  vivify_88:
+    set $P100, $P1091["preamble"]
+    unless_null $P100, vivify_89
+    new $P100, "Undef"
+  vivify_89:
+    .return ($P100)
+  control_1089:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"File"]
+.include "except_types.pasm"
+.sub "ops"  :subid("22_1792415677.14453") :method :outer("11_1792415677.14453")
+.annotate 'file', "compilers/opsc/src/Ops/File.pm"
+.annotate 'line', 278
+    new $P1094, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1094, control_1093
+    push_eh $P1094
+    .lex "self", self
+    find_lex $P1095, "self"
+    unless_null $P1095, vivify_90
+    $P1095 = root_new ['parrot';'Hash']
+  vivify_90:
+    set $P100, $P1095["ops"]
+    unless_null $P100, vivify_91
+    new $P100, "Undef"
+  vivify_91:
+    .return ($P100)
+  control_1093:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"File"]
+.include "except_types.pasm"
+.sub "oplib"  :subid("23_1792415677.14453") :method :outer("11_1792415677.14453")
+.annotate 'file', "compilers/opsc/src/Ops/File.pm"
+.annotate 'line', 279
+    new $P1098, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1098, control_1097
+    push_eh $P1098
+    .lex "self", self
+    find_lex $P1099, "self"
+    unless_null $P1099, vivify_92
+    $P1099 = root_new ['parrot';'Hash']
+  vivify_92:
+    set $P100, $P1099["oplib"]
+    unless_null $P100, vivify_93
+    new $P100, "Undef"
+  vivify_93:
+    .return ($P100)
+  control_1097:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"File"]
+.include "except_types.pasm"
+.sub "version"  :subid("24_1792415677.14453") :method :outer("11_1792415677.14453")
+.annotate 'file', "compilers/opsc/src/Ops/File.pm"
+.annotate 'line', 280
+    new $P1102, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1102, control_1101
+    push_eh $P1102
+    .lex "self", self
+    find_lex $P1103, "self"
+    unless_null $P1103, vivify_94
+    $P1103 = root_new ['parrot';'Hash']
+  vivify_94:
+    set $P100, $P1103["version"]
+    unless_null $P100, vivify_95
+    new $P100, "Undef"
+  vivify_95:
+    .return ($P100)
+  control_1101:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"File"]
+.include "except_types.pasm"
+.sub "bytecode_major"  :subid("25_1792415677.14453") :method :outer("11_1792415677.14453")
+.annotate 'file', "compilers/opsc/src/Ops/File.pm"
+.annotate 'line', 283
+    new $P1106, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1106, control_1105
+    push_eh $P1106
+    .lex "self", self
+    find_lex $P1107, "self"
+    unless_null $P1107, vivify_96
+    $P1107 = root_new ['parrot';'Hash']
+  vivify_96:
+    set $P100, $P1107["bytecode_major"]
+    unless_null $P100, vivify_97
+    new $P100, "Undef"
+  vivify_97:
+    .return ($P100)
+  control_1105:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"File"]
+.include "except_types.pasm"
+.sub "bytecode_minor"  :subid("26_1792415677.14453") :method :outer("11_1792415677.14453")
+.annotate 'file', "compilers/opsc/src/Ops/File.pm"
+.annotate 'line', 284
+    new $P1110, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1110, control_1109
+    push_eh $P1110
+    .lex "self", self
+    find_lex $P1111, "self"
+    unless_null $P1111, vivify_98
+    $P1111 = root_new ['parrot';'Hash']
+  vivify_98:
+    set $P100, $P1111["bytecode_minor"]
+    unless_null $P100, vivify_99
+    new $P100, "Undef"
+  vivify_99:
+    .return ($P100)
+  control_1109:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"File"]
+.include "except_types.pasm"
+.sub "_calculate_op_codes"  :subid("27_1792415677.14453") :method :outer("11_1792415677.14453")
+.annotate 'file', "compilers/opsc/src/Ops/File.pm"
+.annotate 'line', 286
+    .const 'Sub' $P1118 = "28_1792415677.14453" 
+    capture_lex $P1118
+    new $P1114, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1114, control_1113
+    push_eh $P1114
+    .lex "self", self
+.annotate 'line', 288
+    new $P100, "Undef"
+    set $P1115, $P100
+    .lex "$code", $P1115
+    new $P101, "Integer"
+    assign $P101, 0
+    store_lex "$code", $P101
+.annotate 'line', 290
+    find_lex $P1116, "self"
+    unless_null $P1116, vivify_100
+    $P1116 = root_new ['parrot';'Hash']
+  vivify_100:
+    set $P102, $P1116["ops"]
+    unless_null $P102, vivify_101
+    new $P102, "Undef"
+  vivify_101:
+    defined $I100, $P102
+    unless $I100, for_undef_102
+    iter $P101, $P102
+    new $P104, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P104, loop1122_handler
+    push_eh $P104
+  loop1122_test:
+    unless $P101, loop1122_done
+    shift $P103, $P101
+  loop1122_redo:
+    .const 'Sub' $P1118 = "28_1792415677.14453" 
+    capture_lex $P1118
+    $P1118($P103)
+  loop1122_next:
+    goto loop1122_test
+  loop1122_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P105, exception, 'type'
+    eq $P105, .CONTROL_LOOP_NEXT, loop1122_next
+    eq $P105, .CONTROL_LOOP_REDO, loop1122_redo
+  loop1122_done:
+    pop_eh 
+  for_undef_102:
+.annotate 'line', 286
+    .return ($P101)
+  control_1113:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P102, exception, "payload"
+    .return ($P102)
+.end
+
+
+.namespace ["Ops";"File"]
+.sub "_block1117"  :anon :subid("28_1792415677.14453") :outer("27_1792415677.14453")
+    .param pmc param_1119
+.annotate 'file', "compilers/opsc/src/Ops/File.pm"
+.annotate 'line', 290
+    .lex "$op", param_1119
+.annotate 'line', 291
+    find_lex $P104, "$code"
+    clone $P1120, $P104
+    inc $P104
+    find_lex $P1121, "$op"
+    unless_null $P1121, vivify_103
+    $P1121 = root_new ['parrot';'Hash']
+    store_lex "$op", $P1121
+  vivify_103:
+    set $P1121["code"], $P1120
+.annotate 'line', 290
+    .return ($P1120)
+.end
+
+
+.namespace ["Ops";"File"]
+.include "except_types.pasm"
+.sub "_set_version"  :subid("29_1792415677.14453") :method :outer("11_1792415677.14453")
+.annotate 'file', "compilers/opsc/src/Ops/File.pm"
+.annotate 'line', 295
+    new $P1125, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1125, control_1124
+    push_eh $P1125
+    .lex "self", self
+.annotate 'line', 296
+    new $P100, "Undef"
+    set $P1126, $P100
+    .lex "$config", $P1126
+    $P101 = "_config"()
+    store_lex "$config", $P101
+.annotate 'line', 297
+    find_lex $P1127, "$config"
+    unless_null $P1127, vivify_104
+    $P1127 = root_new ['parrot';'Hash']
+  vivify_104:
+    set $P101, $P1127["PBC_MAJOR"]
+    unless_null $P101, vivify_105
+    new $P101, "Undef"
+  vivify_105:
+    set $N100, $P101
+    new $P102, 'Float'
+    set $P102, $N100
+    find_lex $P1128, "self"
+    unless_null $P1128, vivify_106
+    $P1128 = root_new ['parrot';'Hash']
+    store_lex "self", $P1128
+  vivify_106:
+    set $P1128["bytecode_major"], $P102
+.annotate 'line', 298
+    find_lex $P1129, "$config"
+    unless_null $P1129, vivify_107
+    $P1129 = root_new ['parrot';'Hash']
+  vivify_107:
+    set $P101, $P1129["PBC_MINOR"]
+    unless_null $P101, vivify_108
+    new $P101, "Undef"
+  vivify_108:
+    set $N100, $P101
+    new $P102, 'Float'
+    set $P102, $N100
+    find_lex $P1130, "self"
+    unless_null $P1130, vivify_109
+    $P1130 = root_new ['parrot';'Hash']
+    store_lex "self", $P1130
+  vivify_109:
+    set $P1130["bytecode_minor"], $P102
+.annotate 'line', 300
+    find_lex $P1131, "self"
+    unless_null $P1131, vivify_110
+    $P1131 = root_new ['parrot';'Hash']
+  vivify_110:
+    set $P101, $P1131["bytecode_major"]
+    unless_null $P101, vivify_111
+    new $P101, "Undef"
+  vivify_111:
+    set $N100, $P101
+.annotate 'line', 301
+    find_lex $P1132, "self"
+    unless_null $P1132, vivify_112
+    $P1132 = root_new ['parrot';'Hash']
+  vivify_112:
+    set $P102, $P1132["bytecode_minor"]
+    unless_null $P102, vivify_113
+    new $P102, "Undef"
+  vivify_113:
+    set $N101, $P102
+    new $P103, "ResizablePMCArray"
+    push $P103, $N100
+    push $P103, $N101
+    find_lex $P1133, "self"
+    unless_null $P1133, vivify_114
+    $P1133 = root_new ['parrot';'Hash']
+    store_lex "self", $P1133
+  vivify_114:
+    set $P1133["version"], $P103
+.annotate 'line', 295
+    .return ($P103)
+  control_1124:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"File"]
+.sub "_block1135" :load :anon :subid("30_1792415677.14453")
+.annotate 'file', "compilers/opsc/src/Ops/File.pm"
+.annotate 'line', 168
+    .const '' $P1137 = "11_1792415677.14453" 
+    $P100 = $P1137()
+    .return ($P100)
+.end
+
+
+.namespace []
+.sub "_block1138" :load :anon :subid("31_1792415677.14453")
+.annotate 'file', "compilers/opsc/src/Ops/File.pm"
+.annotate 'line', 1
+    .const '' $P1140 = "10_1792415677.14453" 
+    $P100 = $P1140()
+    .return ($P100)
+.end
+
@@ -0,0 +1,3547 @@
+
+.namespace []
+.sub "_block1000"  :anon :subid("10_1792415685.75359")
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 0
+    .const 'Sub' $P1003 = "11_1792415685.75359" 
+    capture_lex $P1003
+.annotate 'line', 1
+    $P0 = find_dynamic_lex "$*CTXSAVE"
+    if null $P0 goto ctxsave_done
+    $I0 = can $P0, "ctxsave"
+    unless $I0 goto ctxsave_done
+    $P0."ctxsave"()
+  ctxsave_done:
+.annotate 'line', 68
+    .const 'Sub' $P1003 = "11_1792415685.75359" 
+    capture_lex $P1003
+    $P106 = $P1003()
+.annotate 'line', 1
+    .return ($P106)
+    .const 'Sub' $P1427 = "66_1792415685.75359" 
+    .return ($P1427)
+.end
+
+
+.namespace []
+.sub "" :load :init :subid("post67") :outer("10_1792415685.75359")
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 0
+    .const 'Sub' $P1001 = "10_1792415685.75359" 
+    .local pmc block
+    set block, $P1001
+    $P1429 = get_root_global ["parrot"], "P6metaclass"
+    $P1429."new_class"("Ops::Op", "PAST::Block" :named("parent"))
+.end
+
+
+.namespace ["Ops";"Op"]
+.sub "_block1002"  :subid("11_1792415685.75359") :outer("10_1792415685.75359")
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 68
+    .const 'Sub' $P1418 = "64_1792415685.75359" 
+    capture_lex $P1418
+    .const 'Sub' $P1410 = "63_1792415685.75359" 
+    capture_lex $P1410
+    .const 'Sub' $P1397 = "61_1792415685.75359" 
+    capture_lex $P1397
+    .const 'Sub' $P1393 = "60_1792415685.75359" 
+    capture_lex $P1393
+    .const 'Sub' $P1388 = "59_1792415685.75359" 
+    capture_lex $P1388
+    .const 'Sub' $P1365 = "57_1792415685.75359" 
+    capture_lex $P1365
+    .const 'Sub' $P1344 = "55_1792415685.75359" 
+    capture_lex $P1344
+    .const 'Sub' $P1325 = "54_1792415685.75359" 
+    capture_lex $P1325
+    .const 'Sub' $P1271 = "50_1792415685.75359" 
+    capture_lex $P1271
+    .const 'Sub' $P1264 = "49_1792415685.75359" 
+    capture_lex $P1264
+    .const 'Sub' $P1249 = "48_1792415685.75359" 
+    capture_lex $P1249
+    .const 'Sub' $P1242 = "47_1792415685.75359" 
+    capture_lex $P1242
+    .const 'Sub' $P1235 = "46_1792415685.75359" 
+    capture_lex $P1235
+    .const 'Sub' $P1218 = "45_1792415685.75359" 
+    capture_lex $P1218
+    .const 'Sub' $P1213 = "44_1792415685.75359" 
+    capture_lex $P1213
+    .const 'Sub' $P1201 = "43_1792415685.75359" 
+    capture_lex $P1201
+    .const 'Sub' $P1187 = "42_1792415685.75359" 
+    capture_lex $P1187
+    .const 'Sub' $P1176 = "41_1792415685.75359" 
+    capture_lex $P1176
+    .const 'Sub' $P1171 = "40_1792415685.75359" 
+    capture_lex $P1171
+    .const 'Sub' $P1148 = "37_1792415685.75359" 
+    capture_lex $P1148
+    .const 'Sub' $P1143 = "36_1792415685.75359" 
+    capture_lex $P1143
+    .const 'Sub' $P1137 = "35_1792415685.75359" 
+    capture_lex $P1137
+    .const 'Sub' $P1132 = "34_1792415685.75359" 
+    capture_lex $P1132
+    .const 'Sub' $P1128 = "33_1792415685.75359" 
+    capture_lex $P1128
+    .const 'Sub' $P1116 = "31_1792415685.75359" 
+    capture_lex $P1116
+    .const 'Sub' $P1112 = "30_1792415685.75359" 
+    capture_lex $P1112
+    .const 'Sub' $P1102 = "28_1792415685.75359" 
+    capture_lex $P1102
+    .const 'Sub' $P1095 = "27_1792415685.75359" 
+    capture_lex $P1095
+    .const 'Sub' $P1091 = "26_1792415685.75359" 
+    capture_lex $P1091
+    .const 'Sub' $P1085 = "25_1792415685.75359" 
+    capture_lex $P1085
+    .const 'Sub' $P1078 = "24_1792415685.75359" 
+    capture_lex $P1078
+    .const 'Sub' $P1074 = "23_1792415685.75359" 
+    capture_lex $P1074
+    .const 'Sub' $P1067 = "22_1792415685.75359" 
+    capture_lex $P1067
+    .const 'Sub' $P1051 = "20_1792415685.75359" 
+    capture_lex $P1051
+    .const 'Sub' $P1047 = "19_1792415685.75359" 
+    capture_lex $P1047
+    .const 'Sub' $P1043 = "18_1792415685.75359" 
+    capture_lex $P1043
+    .const 'Sub' $P1039 = "17_1792415685.75359" 
+    capture_lex $P1039
+    .const 'Sub' $P1035 = "16_1792415685.75359" 
+    capture_lex $P1035
+    .const 'Sub' $P1031 = "15_1792415685.75359" 
+    capture_lex $P1031
+    .const 'Sub' $P1027 = "14_1792415685.75359" 
+    capture_lex $P1027
+    .const 'Sub' $P1013 = "13_1792415685.75359" 
+    capture_lex $P1013
+    .const 'Sub' $P1006 = "12_1792415685.75359" 
+    capture_lex $P1006
+.annotate 'line', 342
+    get_global $P1004, "%PIROP_MAPPING"
+    unless_null $P1004, vivify_69
+    $P1004 = root_new ['parrot';'Hash']
+    set_global "%PIROP_MAPPING", $P1004
+  vivify_69:
+.annotate 'line', 627
+    .const 'Sub' $P1006 = "12_1792415685.75359" 
+    newclosure $P1011, $P1006
+    set $P1005, $P1011
+    .lex "need_space", $P1005
+.annotate 'line', 631
+    .const 'Sub' $P1013 = "13_1792415685.75359" 
+    newclosure $P1026, $P1013
+    set $P1012, $P1026
+    .lex "need_semicolon", $P1012
+.annotate 'line', 68
+    $P0 = find_dynamic_lex "$*CTXSAVE"
+    if null $P0 goto ctxsave_done
+    $I0 = can $P0, "ctxsave"
+    unless $I0 goto ctxsave_done
+    $P0."ctxsave"()
+  ctxsave_done:
+.annotate 'line', 342
+    $P104 = "hash"(">>" :named("shr"), "<<" :named("shl"), ">>=" :named("shr_assign"), "<<=" :named("shl_assign"), "<=" :named("le"), ">=" :named("ge"), "<" :named("lt"), ">" :named("gt"), "->" :named("arrow"), "." :named("dotty"))
+    set_global "%PIROP_MAPPING", $P104
+.annotate 'line', 68
+    find_lex $P104, "need_space"
+    find_lex $P104, "need_semicolon"
+    new $P104, "Integer"
+    assign $P104, 1
+    .return ($P104)
+    .const 'Sub' $P1424 = "65_1792415685.75359" 
+    .return ($P1424)
+.end
+
+
+.namespace ["Ops";"Op"]
+.sub "" :load :init :subid("post68") :outer("11_1792415685.75359")
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 68
+    .const 'Sub' $P1003 = "11_1792415685.75359" 
+    .local pmc block
+    set block, $P1003
+.annotate 'line', 69
+    load_bytecode "dumper.pbc"
+.end
+
+
+.namespace ["Ops";"Op"]
+.include "except_types.pasm"
+.sub "need_space"  :subid("12_1792415685.75359") :outer("11_1792415685.75359")
+    .param pmc param_1009
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 627
+    new $P1008, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1008, control_1007
+    push_eh $P1008
+    .lex "$past", param_1009
+.annotate 'line', 628
+    get_hll_global $P101, ["PAST"], "Var"
+    find_lex $P102, "$past"
+    $P103 = $P101."ACCEPTS"($P102)
+    if $P103, if_1010
+    set $P100, $P103
+    goto if_1010_end
+  if_1010:
+    find_lex $P104, "$past"
+    $P105 = $P104."isdecl"()
+    set $P100, $P105
+  if_1010_end:
+.annotate 'line', 627
+    .return ($P100)
+  control_1007:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Op"]
+.include "except_types.pasm"
+.sub "need_semicolon"  :subid("13_1792415685.75359") :outer("11_1792415685.75359")
+    .param pmc param_1016
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 631
+    new $P1015, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1015, control_1014
+    push_eh $P1015
+    .lex "$past", param_1016
+.annotate 'line', 635
+    new $P102, "Undef"
+    set $P1017, $P102
+    .lex "$pasttype", $P1017
+.annotate 'line', 632
+    get_hll_global $P103, ["PAST"], "Block"
+    find_lex $P104, "$past"
+    $P105 = $P103."ACCEPTS"($P104)
+    unless $P105, if_1018_end
+    new $P106, "Exception"
+    set $P106['type'], .CONTROL_RETURN
+    new $P107, "Integer"
+    assign $P107, 0
+    setattribute $P106, 'payload', $P107
+    throw $P106
+  if_1018_end:
+.annotate 'line', 633
+    get_hll_global $P103, ["PAST"], "Op"
+    find_lex $P104, "$past"
+    $P105 = $P103."ACCEPTS"($P104)
+    if $P105, unless_1019_end
+    new $P106, "Exception"
+    set $P106['type'], .CONTROL_RETURN
+    new $P107, "Integer"
+    assign $P107, 1
+    setattribute $P106, 'payload', $P107
+    throw $P106
+  unless_1019_end:
+.annotate 'line', 635
+    find_lex $P103, "$past"
+    $P104 = $P103."pasttype"()
+    store_lex "$pasttype", $P104
+.annotate 'line', 636
+    find_lex $P103, "$pasttype"
+    if $P103, unless_1020_end
+    new $P104, "Exception"
+    set $P104['type'], .CONTROL_RETURN
+    new $P105, "Integer"
+    assign $P105, 1
+    setattribute $P104, 'payload', $P105
+    throw $P104
+  unless_1020_end:
+.annotate 'line', 637
+    find_lex $P103, "$pasttype"
+    set $S100, $P103
+    iseq $I100, $S100, "if"
+    unless $I100, if_1021_end
+    new $P104, "Exception"
+    set $P104['type'], .CONTROL_RETURN
+    new $P105, "Integer"
+    assign $P105, 0
+    setattribute $P104, 'payload', $P105
+    throw $P104
+  if_1021_end:
+.annotate 'line', 638
+    find_lex $P103, "$pasttype"
+    set $S100, $P103
+    iseq $I100, $S100, "for"
+    unless $I100, if_1022_end
+    new $P104, "Exception"
+    set $P104['type'], .CONTROL_RETURN
+    new $P105, "Integer"
+    assign $P105, 0
+    setattribute $P104, 'payload', $P105
+    throw $P104
+  if_1022_end:
+.annotate 'line', 639
+    find_lex $P103, "$pasttype"
+    set $S100, $P103
+    iseq $I100, $S100, "while"
+    unless $I100, if_1023_end
+    new $P104, "Exception"
+    set $P104['type'], .CONTROL_RETURN
+    new $P105, "Integer"
+    assign $P105, 0
+    setattribute $P104, 'payload', $P105
+    throw $P104
+  if_1023_end:
+.annotate 'line', 640
+    find_lex $P103, "$pasttype"
+    set $S100, $P103
+    iseq $I100, $S100, "do-while"
+    unless $I100, if_1024_end
+    new $P104, "Exception"
+    set $P104['type'], .CONTROL_RETURN
+    new $P105, "Integer"
+    assign $P105, 0
+    setattribute $P104, 'payload', $P105
+    throw $P104
+  if_1024_end:
+.annotate 'line', 641
+    find_lex $P103, "$pasttype"
+    set $S100, $P103
+    iseq $I100, $S100, "switch"
+    unless $I100, if_1025_end
+    new $P104, "Exception"
+    set $P104['type'], .CONTROL_RETURN
+    new $P105, "Integer"
+    assign $P105, 0
+    setattribute $P104, 'payload', $P105
+    throw $P104
+  if_1025_end:
+.annotate 'line', 643
+    new $P103, "Exception"
+    set $P103['type'], .CONTROL_RETURN
+    new $P104, "Integer"
+    assign $P104, 1
+    setattribute $P103, 'payload', $P104
+    throw $P103
+.annotate 'line', 631
+    .return ()
+  control_1014:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P103, exception, "payload"
+    .return ($P103)
+.end
+
+
+.namespace ["Ops";"Op"]
+.include "except_types.pasm"
+.sub "code"  :subid("14_1792415685.75359") :method :outer("11_1792415685.75359")
+    .param pmc param_1030 :optional
+    .param int has_param_1030 :opt_flag
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 129
+    new $P1029, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1029, control_1028
+    push_eh $P1029
+    .lex "self", self
+    if has_param_1030, optparam_70
+    new $P104, "Undef"
+    set param_1030, $P104
+  optparam_70:
+    .lex "$code", param_1030
+    find_lex $P105, "self"
+    find_lex $P106, "$code"
+    find_lex $P107, "$code"
+    $P108 = "defined"($P107)
+    $P109 = $P105."attr"("code", $P106, $P108)
+    .return ($P109)
+  control_1028:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P105, exception, "payload"
+    .return ($P105)
+.end
+
+
+.namespace ["Ops";"Op"]
+.include "except_types.pasm"
+.sub "type"  :subid("15_1792415685.75359") :method :outer("11_1792415685.75359")
+    .param pmc param_1034 :optional
+    .param int has_param_1034 :opt_flag
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 131
+    new $P1033, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1033, control_1032
+    push_eh $P1033
+    .lex "self", self
+    if has_param_1034, optparam_71
+    new $P104, "Undef"
+    set param_1034, $P104
+  optparam_71:
+    .lex "$type", param_1034
+    find_lex $P105, "self"
+    find_lex $P106, "$type"
+    find_lex $P107, "$type"
+    $P108 = "defined"($P107)
+    $P109 = $P105."attr"("type", $P106, $P108)
+    .return ($P109)
+  control_1032:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P105, exception, "payload"
+    .return ($P105)
+.end
+
+
+.namespace ["Ops";"Op"]
+.include "except_types.pasm"
+.sub "name"  :subid("16_1792415685.75359") :method :outer("11_1792415685.75359")
+    .param pmc param_1038 :optional
+    .param int has_param_1038 :opt_flag
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 133
+    new $P1037, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1037, control_1036
+    push_eh $P1037
+    .lex "self", self
+    if has_param_1038, optparam_72
+    new $P104, "Undef"
+    set param_1038, $P104
+  optparam_72:
+    .lex "$name", param_1038
+    find_lex $P105, "self"
+    find_lex $P106, "$name"
+    find_lex $P107, "$name"
+    $P108 = "defined"($P107)
+    $P109 = $P105."attr"("name", $P106, $P108)
+    .return ($P109)
+  control_1036:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P105, exception, "payload"
+    .return ($P105)
+.end
+
+
+.namespace ["Ops";"Op"]
+.include "except_types.pasm"
+.sub "args"  :subid("17_1792415685.75359") :method :outer("11_1792415685.75359")
+    .param pmc param_1042 :optional
+    .param int has_param_1042 :opt_flag
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 135
+    new $P1041, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1041, control_1040
+    push_eh $P1041
+    .lex "self", self
+    if has_param_1042, optparam_73
+    new $P104, "Undef"
+    set param_1042, $P104
+  optparam_73:
+    .lex "$args", param_1042
+    find_lex $P105, "self"
+    find_lex $P106, "$args"
+    find_lex $P107, "$args"
+    $P108 = "defined"($P107)
+    $P109 = $P105."attr"("args", $P106, $P108)
+    .return ($P109)
+  control_1040:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P105, exception, "payload"
+    .return ($P105)
+.end
+
+
+.namespace ["Ops";"Op"]
+.include "except_types.pasm"
+.sub "experimental"  :subid("18_1792415685.75359") :method :outer("11_1792415685.75359")
+    .param pmc param_1046 :optional
+    .param int has_param_1046 :opt_flag
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 137
+    new $P1045, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1045, control_1044
+    push_eh $P1045
+    .lex "self", self
+    if has_param_1046, optparam_74
+    new $P104, "Undef"
+    set param_1046, $P104
+  optparam_74:
+    .lex "$args", param_1046
+    find_lex $P105, "self"
+    find_lex $P106, "$args"
+    find_lex $P107, "$args"
+    $P108 = "defined"($P107)
+    $P109 = $P105."attr"("experimental", $P106, $P108)
+    .return ($P109)
+  control_1044:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P105, exception, "payload"
+    .return ($P105)
+.end
+
+
+.namespace ["Ops";"Op"]
+.include "except_types.pasm"
+.sub "deprecated"  :subid("19_1792415685.75359") :method :outer("11_1792415685.75359")
+    .param pmc param_1050 :optional
+    .param int has_param_1050 :opt_flag
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 139
+    new $P1049, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1049, control_1048
+    push_eh $P1049
+    .lex "self", self
+    if has_param_1050, optparam_75
+    new $P104, "Undef"
+    set param_1050, $P104
+  optparam_75:
+    .lex "$args", param_1050
+    find_lex $P105, "self"
+    find_lex $P106, "$args"
+    find_lex $P107, "$args"
+    $P108 = "defined"($P107)
+    $P109 = $P105."attr"("deprecated", $P106, $P108)
+    .return ($P109)
+  control_1048:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P105, exception, "payload"
+    .return ($P105)
+.end
+
+
+.namespace ["Ops";"Op"]
+.include "except_types.pasm"
+.sub "need_write_barrier"  :subid("20_1792415685.75359") :method :outer("11_1792415685.75359")
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 141
+    .const 'Sub' $P1056 = "21_1792415685.75359" 
+    capture_lex $P1056
+    new $P1053, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1053, control_1052
+    push_eh $P1053
+    .lex "self", self
+.annotate 'line', 142
+    new $P104, "Undef"
+    set $P1054, $P104
+    .lex "$need", $P1054
+    new $P105, "Integer"
+    assign $P105, 0
+    store_lex "$need", $P105
+.annotate 'line', 144
+    find_lex $P106, "self"
+    $P107 = $P106."args"()
+    defined $I100, $P107
+    unless $I100, for_undef_76
+    iter $P105, $P107
+    new $P110, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P110, loop1066_handler
+    push_eh $P110
+  loop1066_test:
+    unless $P105, loop1066_done
+    shift $P108, $P105
+  loop1066_redo:
+    .const 'Sub' $P1056 = "21_1792415685.75359" 
+    capture_lex $P1056
+    $P1056($P108)
+  loop1066_next:
+    goto loop1066_test
+  loop1066_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P111, exception, 'type'
+    eq $P111, .CONTROL_LOOP_NEXT, loop1066_next
+    eq $P111, .CONTROL_LOOP_REDO, loop1066_redo
+  loop1066_done:
+    pop_eh 
+  for_undef_76:
+.annotate 'line', 141
+    find_lex $P105, "$need"
+    .return ($P105)
+  control_1052:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P106, exception, "payload"
+    .return ($P106)
+.end
+
+
+.namespace ["Ops";"Op"]
+.include "except_types.pasm"
+.sub "_block1055"  :anon :subid("21_1792415685.75359") :outer("20_1792415685.75359")
+    .param pmc param_1057
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 144
+    .lex "$a", param_1057
+.annotate 'line', 145
+    find_lex $P1060, "$a"
+    unless_null $P1060, vivify_77
+    $P1060 = root_new ['parrot';'Hash']
+  vivify_77:
+    set $P111, $P1060["type"]
+    unless_null $P111, vivify_78
+    new $P111, "Undef"
+  vivify_78:
+    set $S100, $P111
+    iseq $I101, $S100, "STR"
+    unless $I101, unless_1059
+    new $P110, 'Integer'
+    set $P110, $I101
+    goto unless_1059_end
+  unless_1059:
+    find_lex $P1061, "$a"
+    unless_null $P1061, vivify_79
+    $P1061 = root_new ['parrot';'Hash']
+  vivify_79:
+    set $P112, $P1061["type"]
+    unless_null $P112, vivify_80
+    new $P112, "Undef"
+  vivify_80:
+    set $S101, $P112
+    iseq $I102, $S101, "PMC"
+    new $P110, 'Integer'
+    set $P110, $I102
+  unless_1059_end:
+    if $P110, if_1058
+    set $P109, $P110
+    goto if_1058_end
+  if_1058:
+.annotate 'line', 146
+    find_lex $P1063, "$a"
+    unless_null $P1063, vivify_81
+    $P1063 = root_new ['parrot';'Hash']
+  vivify_81:
+    set $P114, $P1063["direction"]
+    unless_null $P114, vivify_82
+    new $P114, "Undef"
+  vivify_82:
+    set $S102, $P114
+    iseq $I103, $S102, "out"
+    unless $I103, unless_1062
+    new $P113, 'Integer'
+    set $P113, $I103
+    goto unless_1062_end
+  unless_1062:
+    find_lex $P1064, "$a"
+    unless_null $P1064, vivify_83
+    $P1064 = root_new ['parrot';'Hash']
+  vivify_83:
+    set $P115, $P1064["direction"]
+    unless_null $P115, vivify_84
+    new $P115, "Undef"
+  vivify_84:
+    set $S103, $P115
+    iseq $I104, $S103, "inout"
+    new $P113, 'Integer'
+    set $P113, $I104
+  unless_1062_end:
+    set $P109, $P113
+  if_1058_end:
+    store_lex "$need", $P109
+.annotate 'line', 147
+    find_lex $P110, "$need"
+    if $P110, if_1065
+    set $P109, $P110
+    goto if_1065_end
+  if_1065:
+    new $P111, "Exception"
+    set $P111['type'], .CONTROL_RETURN
+    find_lex $P112, "$need"
+    setattribute $P111, 'payload', $P112
+    throw $P111
+  if_1065_end:
+.annotate 'line', 144
+    .return ($P109)
+.end
+
+
+.namespace ["Ops";"Op"]
+.include "except_types.pasm"
+.sub "arg_types"  :subid("22_1792415685.75359") :method :outer("11_1792415685.75359")
+    .param pmc param_1070 :optional
+    .param int has_param_1070 :opt_flag
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 152
+    new $P1069, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1069, control_1068
+    push_eh $P1069
+    .lex "self", self
+    if has_param_1070, optparam_85
+    new $P104, "Undef"
+    set param_1070, $P104
+  optparam_85:
+    .lex "$args", param_1070
+.annotate 'line', 153
+    new $P105, "Undef"
+    set $P1071, $P105
+    .lex "$res", $P1071
+    find_lex $P106, "self"
+    find_lex $P107, "$args"
+    find_lex $P108, "$args"
+    $P109 = "defined"($P108)
+    $P110 = $P106."attr"("arg_types", $P107, $P109)
+    store_lex "$res", $P110
+.annotate 'line', 155
+    find_lex $P106, "$res"
+    $P107 = "defined"($P106)
+    isfalse $I100, $P107
+    unless $I100, if_1072_end
+    new $P108, "Exception"
+    set $P108['type'], .CONTROL_RETURN
+    $P109 = "list"()
+    setattribute $P108, 'payload', $P109
+    throw $P108
+  if_1072_end:
+.annotate 'line', 156
+    find_lex $P107, "$res"
+    new $P108, "String"
+    assign $P108, "array"
+    set $S100, $P108
+    does $I100, $P107, $S100
+    if $I100, if_1073
+    find_lex $P110, "$res"
+    $P111 = "list"($P110)
+    set $P106, $P111
+    goto if_1073_end
+  if_1073:
+    find_lex $P109, "$res"
+    set $P106, $P109
+  if_1073_end:
+.annotate 'line', 152
+    .return ($P106)
+  control_1068:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P107, exception, "payload"
+    .return ($P107)
+.end
+
+
+.namespace ["Ops";"Op"]
+.include "except_types.pasm"
+.sub "arg_dirs"  :subid("23_1792415685.75359") :method :outer("11_1792415685.75359")
+    .param pmc param_1077 :optional
+    .param int has_param_1077 :opt_flag
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 159
+    new $P1076, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1076, control_1075
+    push_eh $P1076
+    .lex "self", self
+    if has_param_1077, optparam_86
+    new $P104, "Undef"
+    set param_1077, $P104
+  optparam_86:
+    .lex "$args", param_1077
+    find_lex $P105, "self"
+    find_lex $P106, "$args"
+    find_lex $P107, "$args"
+    $P108 = "defined"($P107)
+    $P109 = $P105."attr"("arg_dirs", $P106, $P108)
+    .return ($P109)
+  control_1075:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P105, exception, "payload"
+    .return ($P105)
+.end
+
+
+.namespace ["Ops";"Op"]
+.include "except_types.pasm"
+.sub "arg_type"  :subid("24_1792415685.75359") :method :outer("11_1792415685.75359")
+    .param pmc param_1081
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 161
+    new $P1080, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1080, control_1079
+    push_eh $P1080
+    .lex "self", self
+    .lex "$arg_num", param_1081
+.annotate 'line', 162
+    $P1083 = root_new ['parrot';'ResizablePMCArray']
+    set $P1082, $P1083
+    .lex "@arg_types", $P1082
+    find_lex $P104, "self"
+    $P105 = $P104."arg_types"()
+    store_lex "@arg_types", $P105
+.annotate 'line', 161
+    find_lex $P104, "$arg_num"
+    set $I100, $P104
+    find_lex $P1084, "@arg_types"
+    unless_null $P1084, vivify_87
+    $P1084 = root_new ['parrot';'ResizablePMCArray']
+  vivify_87:
+    set $P105, $P1084[$I100]
+    unless_null $P105, vivify_88
+    new $P105, "Undef"
+  vivify_88:
+    .return ($P105)
+  control_1079:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P104, exception, "payload"
+    .return ($P104)
+.end
+
+
+.namespace ["Ops";"Op"]
+.include "except_types.pasm"
+.sub "full_name"  :subid("25_1792415685.75359") :method :outer("11_1792415685.75359")
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 166
+    new $P1087, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1087, control_1086
+    push_eh $P1087
+    .lex "self", self
+.annotate 'line', 167
+    new $P104, "Undef"
+    set $P1088, $P104
+    .lex "$name", $P1088
+.annotate 'line', 168
+    $P1090 = root_new ['parrot';'ResizablePMCArray']
+    set $P1089, $P1090
+    .lex "@arg_types", $P1089
+.annotate 'line', 167
+    find_lex $P105, "self"
+    $P106 = $P105."name"()
+    store_lex "$name", $P106
+.annotate 'line', 168
+    find_lex $P105, "self"
+    $P106 = $P105."arg_types"()
+    store_lex "@arg_types", $P106
+.annotate 'line', 171
+    find_lex $P105, "$name"
+    find_lex $P106, "@arg_types"
+    $P107 = "join"("_", $P105, $P106 :flat)
+.annotate 'line', 166
+    .return ($P107)
+  control_1086:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P105, exception, "payload"
+    .return ($P105)
+.end
+
+
+.namespace ["Ops";"Op"]
+.include "except_types.pasm"
+.sub "func_name"  :subid("26_1792415685.75359") :method :outer("11_1792415685.75359")
+    .param pmc param_1094
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 174
+    new $P1093, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1093, control_1092
+    push_eh $P1093
+    .lex "self", self
+    .lex "$trans", param_1094
+.annotate 'line', 175
+    new $P104, "Exception"
+    set $P104['type'], .CONTROL_RETURN
+    find_lex $P105, "$trans"
+    $P106 = $P105."prefix"()
+    find_lex $P107, "self"
+    $S100 = $P107."full_name"()
+    concat $P108, $P106, $S100
+    setattribute $P104, 'payload', $P108
+    throw $P104
+.annotate 'line', 174
+    .return ()
+  control_1092:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P104, exception, "payload"
+    .return ($P104)
+.end
+
+
+.namespace ["Ops";"Op"]
+.include "except_types.pasm"
+.sub "flags"  :subid("27_1792415685.75359") :method :outer("11_1792415685.75359")
+    .param pmc param_1098 :optional
+    .param int has_param_1098 :opt_flag
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 188
+    new $P1097, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1097, control_1096
+    push_eh $P1097
+    .lex "self", self
+    if has_param_1098, optparam_89
+    $P1099 = root_new ['parrot';'Hash']
+    set param_1098, $P1099
+  optparam_89:
+    .lex "%flags", param_1098
+.annotate 'line', 189
+    find_lex $P104, "self"
+    find_lex $P105, "%flags"
+    find_lex $P106, "%flags"
+    $P107 = "defined"($P106)
+    $P108 = $P104."attr"("flags", $P105, $P107)
+    store_lex "%flags", $P108
+.annotate 'line', 190
+    find_lex $P104, "self"
+    find_lex $P1101, "%flags"
+    unless_null $P1101, vivify_90
+    $P1101 = root_new ['parrot';'Hash']
+  vivify_90:
+    set $P106, $P1101["deprecated"]
+    unless_null $P106, vivify_91
+    new $P106, "Undef"
+  vivify_91:
+    if $P106, if_1100
+    new $P108, "Integer"
+    assign $P108, 0
+    set $P105, $P108
+    goto if_1100_end
+  if_1100:
+    new $P107, "Integer"
+    assign $P107, 1
+    set $P105, $P107
+  if_1100_end:
+    $P104."deprecated"($P105)
+.annotate 'line', 188
+    find_lex $P104, "%flags"
+    .return ($P104)
+  control_1096:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P105, exception, "payload"
+    .return ($P105)
+.end
+
+
+.namespace ["Ops";"Op"]
+.include "except_types.pasm"
+.sub "body"  :subid("28_1792415685.75359") :method :outer("11_1792415685.75359")
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 204
+    .const 'Sub' $P1107 = "29_1792415685.75359" 
+    capture_lex $P1107
+    new $P1104, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1104, control_1103
+    push_eh $P1104
+    .lex "self", self
+.annotate 'line', 205
+    new $P104, "Undef"
+    set $P1105, $P104
+    .lex "$res", $P1105
+    new $P105, "String"
+    assign $P105, ""
+    store_lex "$res", $P105
+.annotate 'line', 206
+    find_lex $P106, "self"
+    $P107 = $P106."list"()
+    defined $I100, $P107
+    unless $I100, for_undef_92
+    iter $P105, $P107
+    new $P110, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P110, loop1111_handler
+    push_eh $P110
+  loop1111_test:
+    unless $P105, loop1111_done
+    shift $P108, $P105
+  loop1111_redo:
+    .const 'Sub' $P1107 = "29_1792415685.75359" 
+    capture_lex $P1107
+    $P1107($P108)
+  loop1111_next:
+    goto loop1111_test
+  loop1111_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P111, exception, 'type'
+    eq $P111, .CONTROL_LOOP_NEXT, loop1111_next
+    eq $P111, .CONTROL_LOOP_REDO, loop1111_redo
+  loop1111_done:
+    pop_eh 
+  for_undef_92:
+.annotate 'line', 204
+    find_lex $P105, "$res"
+    .return ($P105)
+  control_1103:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P106, exception, "payload"
+    .return ($P106)
+.end
+
+
+.namespace ["Ops";"Op"]
+.sub "_block1106"  :anon :subid("29_1792415685.75359") :outer("28_1792415685.75359")
+    .param pmc param_1108
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 206
+    .lex "$part", param_1108
+.annotate 'line', 207
+    find_lex $P110, "$part"
+    defined $I101, $P110
+    if $I101, if_1109
+    new $P109, 'Integer'
+    set $P109, $I101
+    goto if_1109_end
+  if_1109:
+.annotate 'line', 208
+    find_lex $P111, "$res"
+    find_lex $P1110, "$part"
+    unless_null $P1110, vivify_93
+    $P1110 = root_new ['parrot';'Hash']
+  vivify_93:
+    set $P112, $P1110["inline"]
+    unless_null $P112, vivify_94
+    new $P112, "Undef"
+  vivify_94:
+    concat $P113, $P111, $P112
+    store_lex "$res", $P113
+.annotate 'line', 207
+    set $P109, $P113
+  if_1109_end:
+.annotate 'line', 206
+    .return ($P109)
+.end
+
+
+.namespace ["Ops";"Op"]
+.include "except_types.pasm"
+.sub "jump"  :subid("30_1792415685.75359") :method :outer("11_1792415685.75359")
+    .param pmc param_1115 :optional
+    .param int has_param_1115 :opt_flag
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 226
+    new $P1114, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1114, control_1113
+    push_eh $P1114
+    .lex "self", self
+    if has_param_1115, optparam_95
+    new $P104, "Undef"
+    set param_1115, $P104
+  optparam_95:
+    .lex "$jump", param_1115
+    find_lex $P105, "self"
+    find_lex $P106, "$jump"
+    find_lex $P107, "$jump"
+    $P108 = "defined"($P107)
+    $P109 = $P105."attr"("jump", $P106, $P108)
+    .return ($P109)
+  control_1113:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P105, exception, "payload"
+    .return ($P105)
+.end
+
+
+.namespace ["Ops";"Op"]
+.include "except_types.pasm"
+.sub "add_jump"  :subid("31_1792415685.75359") :method :outer("11_1792415685.75359")
+    .param pmc param_1119
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 238
+    .const 'Sub' $P1123 = "32_1792415685.75359" 
+    capture_lex $P1123
+    new $P1118, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1118, control_1117
+    push_eh $P1118
+    .lex "self", self
+    .lex "$jump", param_1119
+.annotate 'line', 239
+    new $P104, "Undef"
+    set $P1120, $P104
+    .lex "$found_jump", $P1120
+    new $P105, "Integer"
+    assign $P105, 0
+    store_lex "$found_jump", $P105
+.annotate 'line', 241
+    find_lex $P105, "self"
+    $P106 = $P105."jump"()
+    if $P106, unless_1121_end
+    find_lex $P107, "self"
+    $P108 = "list"()
+    $P107."jump"($P108)
+  unless_1121_end:
+.annotate 'line', 243
+    find_lex $P106, "self"
+    $P107 = $P106."jump"()
+    defined $I100, $P107
+    unless $I100, for_undef_96
+    iter $P105, $P107
+    new $P110, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P110, loop1126_handler
+    push_eh $P110
+  loop1126_test:
+    unless $P105, loop1126_done
+    shift $P108, $P105
+  loop1126_redo:
+    .const 'Sub' $P1123 = "32_1792415685.75359" 
+    capture_lex $P1123
+    $P1123($P108)
+  loop1126_next:
+    goto loop1126_test
+  loop1126_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P111, exception, 'type'
+    eq $P111, .CONTROL_LOOP_NEXT, loop1126_next
+    eq $P111, .CONTROL_LOOP_REDO, loop1126_redo
+  loop1126_done:
+    pop_eh 
+  for_undef_96:
+.annotate 'line', 247
+    find_lex $P106, "$found_jump"
+    unless $P106, unless_1127
+    set $P105, $P106
+    goto unless_1127_end
+  unless_1127:
+.annotate 'line', 248
+    find_lex $P107, "self"
+    $P108 = $P107."jump"()
+    find_lex $P109, "$jump"
+    $P110 = $P108."push"($P109)
+.annotate 'line', 247
+    set $P105, $P110
+  unless_1127_end:
+.annotate 'line', 238
+    .return ($P105)
+  control_1117:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P106, exception, "payload"
+    .return ($P106)
+.end
+
+
+.namespace ["Ops";"Op"]
+.sub "_block1122"  :anon :subid("32_1792415685.75359") :outer("31_1792415685.75359")
+    .param pmc param_1124
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 243
+    .lex "$_", param_1124
+.annotate 'line', 244
+    find_lex $P110, "$_"
+    set $S100, $P110
+    find_lex $P111, "$jump"
+    set $S101, $P111
+    iseq $I101, $S100, $S101
+    if $I101, if_1125
+    new $P109, 'Integer'
+    set $P109, $I101
+    goto if_1125_end
+  if_1125:
+    new $P112, "Integer"
+    assign $P112, 1
+    store_lex "$found_jump", $P112
+    set $P109, $P112
+  if_1125_end:
+.annotate 'line', 243
+    .return ($P109)
+.end
+
+
+.namespace ["Ops";"Op"]
+.include "except_types.pasm"
+.sub "get_jump"  :subid("33_1792415685.75359") :method :outer("11_1792415685.75359")
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 262
+    new $P1130, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1130, control_1129
+    push_eh $P1130
+    .lex "self", self
+.annotate 'line', 264
+    find_lex $P105, "self"
+    $P106 = $P105."jump"()
+    if $P106, if_1131
+.annotate 'line', 268
+    new $P107, "Exception"
+    set $P107['type'], .CONTROL_RETURN
+    new $P108, "String"
+    assign $P108, "0"
+    setattribute $P107, 'payload', $P108
+    throw $P107
+.annotate 'line', 267
+    goto if_1131_end
+  if_1131:
+.annotate 'line', 265
+    new $P107, "Exception"
+    set $P107['type'], .CONTROL_RETURN
+    find_lex $P108, "self"
+    $P109 = $P108."jump"()
+    $P110 = "join"("|", $P109 :flat)
+    setattribute $P107, 'payload', $P110
+    throw $P107
+  if_1131_end:
+.annotate 'line', 262
+    .return ($P104)
+  control_1129:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P105, exception, "payload"
+    .return ($P105)
+.end
+
+
+.namespace ["Ops";"Op"]
+.include "except_types.pasm"
+.sub "source"  :subid("34_1792415685.75359") :method :outer("11_1792415685.75359")
+    .param pmc param_1135
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 281
+    new $P1134, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1134, control_1133
+    push_eh $P1134
+    .lex "self", self
+    .lex "$trans", param_1135
+.annotate 'line', 283
+    new $P104, "Undef"
+    set $P1136, $P104
+    .lex "$prelude", $P1136
+    find_lex $P105, "$trans"
+    $P106 = $P105."body_prelude"()
+    store_lex "$prelude", $P106
+.annotate 'line', 284
+    new $P105, "Exception"
+    set $P105['type'], .CONTROL_RETURN
+    find_lex $P106, "$prelude"
+    find_lex $P107, "self"
+    find_lex $P108, "$trans"
+    $S100 = $P107."get_body"($P108)
+    concat $P109, $P106, $S100
+    setattribute $P105, 'payload', $P109
+    throw $P105
+.annotate 'line', 281
+    .return ()
+  control_1133:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P105, exception, "payload"
+    .return ($P105)
+.end
+
+
+.namespace ["Ops";"Op"]
+.include "except_types.pasm"
+.sub "get_body"  :subid("35_1792415685.75359") :method :outer("11_1792415685.75359")
+    .param pmc param_1140
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 300
+    new $P1139, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1139, control_1138
+    push_eh $P1139
+    .lex "self", self
+    .lex "$trans", param_1140
+.annotate 'line', 302
+    $P1142 = root_new ['parrot';'Hash']
+    set $P1141, $P1142
+    .lex "%context", $P1141
+    find_lex $P104, "$trans"
+    $P105 = "hash"($P104 :named("trans"), 0 :named("level"))
+    store_lex "%context", $P105
+.annotate 'line', 308
+    find_lex $P104, "self"
+    find_lex $P105, "self"
+    find_lex $P106, "%context"
+    $P107 = $P104."join_children"($P105, $P106)
+.annotate 'line', 300
+    .return ($P107)
+  control_1138:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P104, exception, "payload"
+    .return ($P104)
+.end
+
+
+.namespace ["Ops";"Op"]
+.include "except_types.pasm"
+.sub "to_c" :nsentry :subid("36_1792415685.75359") :method :outer("11_1792415685.75359") :multi(_,["PAST";"Val"],_)
+    .param pmc param_1146
+    .param pmc param_1147
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 312
+    new $P1145, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1145, control_1144
+    push_eh $P1145
+    .lex "self", self
+    .lex "$val", param_1146
+    .lex "%c", param_1147
+.annotate 'line', 313
+    find_lex $P104, "$val"
+    $P105 = $P104."value"()
+.annotate 'line', 312
+    .return ($P105)
+  control_1144:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P104, exception, "payload"
+    .return ($P104)
+.end
+
+
+.namespace ["Ops";"Op"]
+.include "except_types.pasm"
+.sub "to_c" :nsentry :subid("37_1792415685.75359") :method :outer("11_1792415685.75359") :multi(_,["PAST";"Var"],_)
+    .param pmc param_1151
+    .param pmc param_1152
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 316
+    .const 'Sub' $P1168 = "39_1792415685.75359" 
+    capture_lex $P1168
+    .const 'Sub' $P1155 = "38_1792415685.75359" 
+    capture_lex $P1155
+    new $P1150, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1150, control_1149
+    push_eh $P1150
+    .lex "self", self
+    .lex "$var", param_1151
+    .lex "%c", param_1152
+.annotate 'line', 317
+    find_lex $P105, "$var"
+    $P106 = $P105."isdecl"()
+    if $P106, if_1153
+.annotate 'line', 329
+    find_lex $P113, "$var"
+    $S100 = $P113."scope"()
+    iseq $I100, $S100, "keyed"
+    if $I100, if_1163
+.annotate 'line', 332
+    find_lex $P115, "$var"
+    $S101 = $P115."scope"()
+    iseq $I101, $S101, "register"
+    if $I101, if_1166
+.annotate 'line', 338
+    find_lex $P118, "$var"
+    $P119 = $P118."name"()
+.annotate 'line', 336
+    set $P114, $P119
+.annotate 'line', 332
+    goto if_1166_end
+  if_1166:
+    .const 'Sub' $P1168 = "39_1792415685.75359" 
+    capture_lex $P1168
+    $P117 = $P1168()
+    set $P114, $P117
+  if_1166_end:
+    set $P112, $P114
+.annotate 'line', 329
+    goto if_1163_end
+  if_1163:
+.annotate 'line', 330
+    find_lex $P114, "self"
+    find_lex $P1164, "$var"
+    unless_null $P1164, vivify_99
+    $P1164 = root_new ['parrot';'ResizablePMCArray']
+  vivify_99:
+    set $P115, $P1164[0]
+    unless_null $P115, vivify_100
+    new $P115, "Undef"
+  vivify_100:
+    find_lex $P116, "%c"
+    $P117 = $P114."to_c"($P115, $P116)
+    concat $P118, $P117, "["
+    find_lex $P119, "self"
+    find_lex $P1165, "$var"
+    unless_null $P1165, vivify_101
+    $P1165 = root_new ['parrot';'ResizablePMCArray']
+  vivify_101:
+    set $P120, $P1165[1]
+    unless_null $P120, vivify_102
+    new $P120, "Undef"
+  vivify_102:
+    find_lex $P121, "%c"
+    $S101 = $P119."to_c"($P120, $P121)
+    concat $P122, $P118, $S101
+    concat $P123, $P122, "]"
+.annotate 'line', 329
+    set $P112, $P123
+  if_1163_end:
+    set $P104, $P112
+.annotate 'line', 317
+    goto if_1153_end
+  if_1153:
+    .const 'Sub' $P1155 = "38_1792415685.75359" 
+    capture_lex $P1155
+    $P111 = $P1155()
+    set $P104, $P111
+  if_1153_end:
+.annotate 'line', 316
+    .return ($P104)
+  control_1149:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P105, exception, "payload"
+    .return ($P105)
+.end
+
+
+.namespace ["Ops";"Op"]
+.sub "_block1167"  :anon :subid("39_1792415685.75359") :outer("37_1792415685.75359")
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 333
+    new $P116, "Undef"
+    set $P1169, $P116
+    .lex "$n", $P1169
+    find_lex $P117, "$var"
+    $P118 = $P117."name"()
+    set $N100, $P118
+    new $P119, 'Float'
+    set $P119, $N100
+    store_lex "$n", $P119
+.annotate 'line', 334
+    find_lex $P1170, "%c"
+    unless_null $P1170, vivify_97
+    $P1170 = root_new ['parrot';'Hash']
+  vivify_97:
+    set $P117, $P1170["trans"]
+    unless_null $P117, vivify_98
+    new $P117, "Undef"
+  vivify_98:
+    find_lex $P118, "self"
+    find_lex $P119, "$n"
+    sub $P120, $P119, 1
+    $P121 = $P118."arg_type"($P120)
+    find_lex $P122, "$n"
+    $P124 = $P117."access_arg"($P121, $P122)
+.annotate 'line', 332
+    .return ($P124)
+.end
+
+
+.namespace ["Ops";"Op"]
+.sub "_block1154"  :anon :subid("38_1792415685.75359") :outer("37_1792415685.75359")
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 318
+    new $P107, "Undef"
+    set $P1156, $P107
+    .lex "$res", $P1156
+.annotate 'line', 320
+    new $P108, "Undef"
+    set $P1157, $P108
+    .lex "$arr", $P1157
+.annotate 'line', 324
+    new $P109, "Undef"
+    set $P1158, $P109
+    .lex "$expr", $P1158
+.annotate 'line', 318
+    find_lex $P110, "$var"
+    $P111 = $P110."vivibase"()
+    concat $P112, $P111, " "
+    find_lex $P1159, "$var"
+    unless_null $P1159, vivify_103
+    $P1159 = root_new ['parrot';'Hash']
+  vivify_103:
+    set $P113, $P1159["pointer"]
+    unless_null $P113, vivify_104
+    new $P113, "Undef"
+  vivify_104:
+    concat $P114, $P112, $P113
+    concat $P115, $P114, " "
+    find_lex $P116, "$var"
+    $S100 = $P116."name"()
+    concat $P117, $P115, $S100
+    store_lex "$res", $P117
+.annotate 'line', 320
+    find_lex $P1161, "$var"
+    unless_null $P1161, vivify_105
+    $P1161 = root_new ['parrot';'Hash']
+  vivify_105:
+    set $P110, $P1161["array_size"]
+    unless_null $P110, vivify_106
+    new $P110, "Undef"
+  vivify_106:
+    store_lex "$arr", $P110
+    unless $P110, if_1160_end
+.annotate 'line', 321
+    find_lex $P111, "$res"
+    concat $P112, $P111, "["
+    find_lex $P113, "$arr"
+    concat $P114, $P112, $P113
+    concat $P115, $P114, "]"
+    store_lex "$res", $P115
+  if_1160_end:
+.annotate 'line', 324
+    find_lex $P110, "$var"
+    $P111 = $P110."viviself"()
+    store_lex "$expr", $P111
+    unless $P111, if_1162_end
+.annotate 'line', 325
+    find_lex $P112, "$res"
+    concat $P113, $P112, " = "
+    find_lex $P114, "self"
+    find_lex $P115, "$expr"
+    find_lex $P116, "%c"
+    $S100 = $P114."to_c"($P115, $P116)
+    concat $P117, $P113, $S100
+    store_lex "$res", $P117
+  if_1162_end:
+.annotate 'line', 317
+    find_lex $P110, "$res"
+    .return ($P110)
+.end
+
+
+.namespace ["Ops";"Op"]
+.include "except_types.pasm"
+.sub "to_c:pasttype<inline>" :nsentry :subid("40_1792415685.75359") :method :outer("11_1792415685.75359")
+    .param pmc param_1174
+    .param pmc param_1175
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 358
+    new $P1173, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1173, control_1172
+    push_eh $P1173
+    .lex "self", self
+    .lex "$chunk", param_1174
+    .lex "%c", param_1175
+.annotate 'line', 359
+    new $P104, "Exception"
+    set $P104['type'], .CONTROL_RETURN
+    find_lex $P105, "$chunk"
+    $P106 = $P105."inline"()
+    setattribute $P104, 'payload', $P106
+    throw $P104
+.annotate 'line', 358
+    .return ()
+  control_1172:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P104, exception, "payload"
+    .return ($P104)
+.end
+
+
+.namespace ["Ops";"Op"]
+.include "except_types.pasm"
+.sub "to_c:pasttype<macro>" :nsentry :subid("41_1792415685.75359") :method :outer("11_1792415685.75359")
+    .param pmc param_1179
+    .param pmc param_1180
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 362
+    new $P1178, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1178, control_1177
+    push_eh $P1178
+    .lex "self", self
+    .lex "$chunk", param_1179
+    .lex "%c", param_1180
+.annotate 'line', 363
+    new $P104, "Undef"
+    set $P1181, $P104
+    .lex "$name", $P1181
+.annotate 'line', 364
+    new $P105, "Undef"
+    set $P1182, $P105
+    .lex "$children", $P1182
+.annotate 'line', 366
+    new $P106, "Undef"
+    set $P1183, $P106
+    .lex "$trans", $P1183
+.annotate 'line', 369
+    new $P107, "Undef"
+    set $P1184, $P107
+    .lex "$ret", $P1184
+.annotate 'line', 363
+    find_lex $P108, "$chunk"
+    $P109 = $P108."name"()
+    store_lex "$name", $P109
+.annotate 'line', 364
+    find_lex $P108, "self"
+    find_lex $P109, "$chunk"
+    find_lex $P110, "%c"
+    $P111 = $P108."join_children"($P109, $P110)
+    store_lex "$children", $P111
+.annotate 'line', 366
+    find_lex $P1185, "%c"
+    unless_null $P1185, vivify_107
+    $P1185 = root_new ['parrot';'Hash']
+  vivify_107:
+    set $P108, $P1185["trans"]
+    unless_null $P108, vivify_108
+    new $P108, "Undef"
+  vivify_108:
+    store_lex "$trans", $P108
+.annotate 'line', 369
+
+        $P0 = find_lex '$trans'
+        $P1 = find_lex '$name'
+        $S0 = $P1
+        $P1 = find_lex '$children'
+        $P1186  = $P0.$S0($P1)
+    
+    store_lex "$ret", $P1186
+.annotate 'line', 377
+    new $P108, "Exception"
+    set $P108['type'], .CONTROL_RETURN
+    find_lex $P109, "$ret"
+    setattribute $P108, 'payload', $P109
+    throw $P108
+.annotate 'line', 362
+    .return ()
+  control_1177:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P108, exception, "payload"
+    .return ($P108)
+.end
+
+
+.namespace ["Ops";"Op"]
+.include "except_types.pasm"
+.sub "to_c:pasttype<macro_define>" :nsentry :subid("42_1792415685.75359") :method :outer("11_1792415685.75359")
+    .param pmc param_1190
+    .param pmc param_1191
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 380
+    new $P1189, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1189, control_1188
+    push_eh $P1189
+    .lex "self", self
+    .lex "$chunk", param_1190
+    .lex "%c", param_1191
+.annotate 'line', 381
+    $P1193 = root_new ['parrot';'ResizablePMCArray']
+    set $P1192, $P1193
+    .lex "@res", $P1192
+.annotate 'line', 380
+    find_lex $P104, "@res"
+.annotate 'line', 382
+    find_lex $P104, "@res"
+    $P104."push"("#define ")
+.annotate 'line', 384
+    find_lex $P104, "@res"
+    find_lex $P1194, "$chunk"
+    unless_null $P1194, vivify_109
+    $P1194 = root_new ['parrot';'ResizablePMCArray']
+  vivify_109:
+    set $P105, $P1194[0]
+    unless_null $P105, vivify_110
+    new $P105, "Undef"
+  vivify_110:
+    $P104."push"($P105)
+.annotate 'line', 386
+    find_lex $P1196, "$chunk"
+    unless_null $P1196, vivify_111
+    $P1196 = root_new ['parrot';'Hash']
+  vivify_111:
+    set $P104, $P1196["macro_args"]
+    unless_null $P104, vivify_112
+    new $P104, "Undef"
+  vivify_112:
+    unless $P104, if_1195_end
+    find_lex $P105, "@res"
+    find_lex $P106, "self"
+    find_lex $P1197, "$chunk"
+    unless_null $P1197, vivify_113
+    $P1197 = root_new ['parrot';'Hash']
+  vivify_113:
+    set $P107, $P1197["macro_args"]
+    unless_null $P107, vivify_114
+    new $P107, "Undef"
+  vivify_114:
+    find_lex $P108, "%c"
+    $P109 = $P106."to_c"($P107, $P108)
+    $P105."push"($P109)
+  if_1195_end:
+.annotate 'line', 387
+    find_lex $P1199, "$chunk"
+    unless_null $P1199, vivify_115
+    $P1199 = root_new ['parrot';'Hash']
+  vivify_115:
+    set $P104, $P1199["body"]
+    unless_null $P104, vivify_116
+    new $P104, "Undef"
+  vivify_116:
+    unless $P104, if_1198_end
+    find_lex $P105, "@res"
+    find_lex $P106, "self"
+    find_lex $P1200, "$chunk"
+    unless_null $P1200, vivify_117
+    $P1200 = root_new ['parrot';'Hash']
+  vivify_117:
+    set $P107, $P1200["body"]
+    unless_null $P107, vivify_118
+    new $P107, "Undef"
+  vivify_118:
+    find_lex $P108, "%c"
+    $P109 = $P106."to_c"($P107, $P108)
+    $P105."push"($P109)
+  if_1198_end:
+.annotate 'line', 389
+    find_lex $P104, "@res"
+    $P105 = $P104."join"("")
+.annotate 'line', 380
+    .return ($P105)
+  control_1188:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P104, exception, "payload"
+    .return ($P104)
+.end
+
+
+.namespace ["Ops";"Op"]
+.include "except_types.pasm"
+.sub "to_c:pasttype<macro_if>" :nsentry :subid("43_1792415685.75359") :method :outer("11_1792415685.75359")
+    .param pmc param_1204
+    .param pmc param_1205
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 393
+    new $P1203, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1203, control_1202
+    push_eh $P1203
+    .lex "self", self
+    .lex "$chunk", param_1204
+    .lex "%c", param_1205
+.annotate 'line', 394
+    $P1207 = root_new ['parrot';'ResizablePMCArray']
+    set $P1206, $P1207
+    .lex "@res", $P1206
+.annotate 'line', 393
+    find_lex $P104, "@res"
+.annotate 'line', 396
+    find_lex $P104, "@res"
+    $P104."push"("#if ")
+.annotate 'line', 398
+    find_lex $P104, "@res"
+    find_lex $P1208, "$chunk"
+    unless_null $P1208, vivify_119
+    $P1208 = root_new ['parrot';'ResizablePMCArray']
+  vivify_119:
+    set $P105, $P1208[0]
+    unless_null $P105, vivify_120
+    new $P105, "Undef"
+  vivify_120:
+    $P104."push"($P105)
+.annotate 'line', 400
+    find_lex $P104, "@res"
+    $P104."push"("\n")
+.annotate 'line', 403
+    find_lex $P104, "@res"
+    find_lex $P105, "self"
+    find_lex $P1209, "$chunk"
+    unless_null $P1209, vivify_121
+    $P1209 = root_new ['parrot';'ResizablePMCArray']
+  vivify_121:
+    set $P106, $P1209[1]
+    unless_null $P106, vivify_122
+    new $P106, "Undef"
+  vivify_122:
+    find_lex $P107, "%c"
+    $P108 = $P105."to_c"($P106, $P107)
+    $P104."push"($P108)
+.annotate 'line', 406
+    find_lex $P1211, "$chunk"
+    unless_null $P1211, vivify_123
+    $P1211 = root_new ['parrot';'ResizablePMCArray']
+  vivify_123:
+    set $P104, $P1211[2]
+    unless_null $P104, vivify_124
+    new $P104, "Undef"
+  vivify_124:
+    unless $P104, if_1210_end
+    find_lex $P105, "@res"
+    new $P106, "String"
+    assign $P106, "\n#else\n"
+    find_lex $P107, "self"
+    find_lex $P1212, "$chunk"
+    unless_null $P1212, vivify_125
+    $P1212 = root_new ['parrot';'ResizablePMCArray']
+  vivify_125:
+    set $P108, $P1212[2]
+    unless_null $P108, vivify_126
+    new $P108, "Undef"
+  vivify_126:
+    find_lex $P109, "%c"
+    $S100 = $P107."to_c"($P108, $P109)
+    concat $P110, $P106, $S100
+    $P105."push"($P110)
+  if_1210_end:
+.annotate 'line', 408
+    find_lex $P104, "@res"
+    $P104."push"("\n#endif\n")
+.annotate 'line', 410
+    find_lex $P104, "@res"
+    $P105 = $P104."join"("")
+.annotate 'line', 393
+    .return ($P105)
+  control_1202:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P104, exception, "payload"
+    .return ($P104)
+.end
+
+
+.namespace ["Ops";"Op"]
+.include "except_types.pasm"
+.sub "to_c:pasttype<call>" :nsentry :subid("44_1792415685.75359") :method :outer("11_1792415685.75359")
+    .param pmc param_1216
+    .param pmc param_1217
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 412
+    new $P1215, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1215, control_1214
+    push_eh $P1215
+    .lex "self", self
+    .lex "$chunk", param_1216
+    .lex "%c", param_1217
+.annotate 'line', 414
+    find_lex $P104, "$chunk"
+    $P105 = $P104."name"()
+.annotate 'line', 417
+    find_lex $P106, "self"
+    find_lex $P107, "$chunk"
+    find_lex $P108, "%c"
+    $P109 = $P106."join_children"($P107, $P108, ", ")
+    $P110 = "join"("", $P105, "(", $P109, ")")
+.annotate 'line', 412
+    .return ($P110)
+  control_1214:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P104, exception, "payload"
+    .return ($P104)
+.end
+
+
+.namespace ["Ops";"Op"]
+.include "except_types.pasm"
+.sub "to_c:pasttype<if>" :nsentry :subid("45_1792415685.75359") :method :outer("11_1792415685.75359")
+    .param pmc param_1221
+    .param pmc param_1222
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 422
+    new $P1220, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1220, control_1219
+    push_eh $P1220
+    .lex "self", self
+    .lex "$chunk", param_1221
+    .lex "%c", param_1222
+.annotate 'line', 423
+    $P1224 = root_new ['parrot';'ResizablePMCArray']
+    set $P1223, $P1224
+    .lex "@res", $P1223
+.annotate 'line', 422
+    find_lex $P104, "@res"
+.annotate 'line', 425
+    find_lex $P1226, "$chunk"
+    unless_null $P1226, vivify_127
+    $P1226 = root_new ['parrot';'Hash']
+  vivify_127:
+    set $P104, $P1226["ternary"]
+    unless_null $P104, vivify_128
+    new $P104, "Undef"
+  vivify_128:
+    if $P104, if_1225
+.annotate 'line', 435
+    find_lex $P105, "@res"
+    $P105."push"("if (")
+.annotate 'line', 436
+    find_lex $P105, "@res"
+    find_lex $P106, "self"
+    find_lex $P1230, "$chunk"
+    unless_null $P1230, vivify_129
+    $P1230 = root_new ['parrot';'ResizablePMCArray']
+  vivify_129:
+    set $P107, $P1230[0]
+    unless_null $P107, vivify_130
+    new $P107, "Undef"
+  vivify_130:
+    find_lex $P108, "%c"
+    $P109 = $P106."to_c"($P107, $P108)
+    $P105."push"($P109)
+.annotate 'line', 437
+    find_lex $P105, "@res"
+    $P105."push"(") ")
+.annotate 'line', 442
+    find_lex $P105, "@res"
+    find_lex $P106, "self"
+    find_lex $P1231, "$chunk"
+    unless_null $P1231, vivify_131
+    $P1231 = root_new ['parrot';'ResizablePMCArray']
+  vivify_131:
+    set $P107, $P1231[1]
+    unless_null $P107, vivify_132
+    new $P107, "Undef"
+  vivify_132:
+    find_lex $P108, "%c"
+    $P109 = $P106."to_c"($P107, $P108)
+    $P105."push"($P109)
+.annotate 'line', 445
+    find_lex $P1233, "$chunk"
+    unless_null $P1233, vivify_133
+    $P1233 = root_new ['parrot';'ResizablePMCArray']
+  vivify_133:
+    set $P105, $P1233[2]
+    unless_null $P105, vivify_134
+    new $P105, "Undef"
+  vivify_134:
+    unless $P105, if_1232_end
+.annotate 'line', 446
+    find_lex $P106, "@res"
+    $P106."push"("\n")
+.annotate 'line', 447
+    find_lex $P106, "@res"
+    find_lex $P107, "%c"
+    $P108 = "indent"($P107)
+    $P106."push"($P108)
+.annotate 'line', 448
+    find_lex $P106, "@res"
+    $P106."push"("else ")
+.annotate 'line', 449
+    find_lex $P106, "@res"
+    find_lex $P107, "self"
+    find_lex $P1234, "$chunk"
+    unless_null $P1234, vivify_135
+    $P1234 = root_new ['parrot';'ResizablePMCArray']
+  vivify_135:
+    set $P108, $P1234[2]
+    unless_null $P108, vivify_136
+    new $P108, "Undef"
+  vivify_136:
+    find_lex $P109, "%c"
+    $P110 = $P107."to_c"($P108, $P109)
+    $P106."push"($P110)
+  if_1232_end:
+.annotate 'line', 434
+    goto if_1225_end
+  if_1225:
+.annotate 'line', 426
+    find_lex $P105, "@res"
+    find_lex $P106, "self"
+    find_lex $P1227, "$chunk"
+    unless_null $P1227, vivify_137
+    $P1227 = root_new ['parrot';'ResizablePMCArray']
+  vivify_137:
+    set $P107, $P1227[0]
+    unless_null $P107, vivify_138
+    new $P107, "Undef"
+  vivify_138:
+    find_lex $P108, "%c"
+    $P109 = $P106."to_c"($P107, $P108)
+    $P105."push"($P109)
+.annotate 'line', 427
+    find_lex $P105, "@res"
+    $P105."push"(" ? ")
+.annotate 'line', 429
+    find_lex $P105, "@res"
+    find_lex $P106, "self"
+    find_lex $P1228, "$chunk"
+    unless_null $P1228, vivify_139
+    $P1228 = root_new ['parrot';'ResizablePMCArray']
+  vivify_139:
+    set $P107, $P1228[1]
+    unless_null $P107, vivify_140
+    new $P107, "Undef"
+  vivify_140:
+    find_lex $P108, "%c"
+    $P109 = $P106."to_c"($P107, $P108)
+    $P105."push"($P109)
+.annotate 'line', 431
+    find_lex $P105, "@res"
+    $P105."push"(" : ")
+.annotate 'line', 432
+    find_lex $P105, "@res"
+    find_lex $P106, "self"
+    find_lex $P1229, "$chunk"
+    unless_null $P1229, vivify_141
+    $P1229 = root_new ['parrot';'ResizablePMCArray']
+  vivify_141:
+    set $P107, $P1229[2]
+    unless_null $P107, vivify_142
+    new $P107, "Undef"
+  vivify_142:
+    find_lex $P108, "%c"
+    $P109 = $P106."to_c"($P107, $P108)
+    $P105."push"($P109)
+  if_1225_end:
+.annotate 'line', 453
+    find_lex $P104, "@res"
+    $P105 = $P104."join"("")
+.annotate 'line', 422
+    .return ($P105)
+  control_1219:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P104, exception, "payload"
+    .return ($P104)
+.end
+
+
+.namespace ["Ops";"Op"]
+.include "except_types.pasm"
+.sub "to_c:pasttype<while>" :nsentry :subid("46_1792415685.75359") :method :outer("11_1792415685.75359")
+    .param pmc param_1238
+    .param pmc param_1239
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 456
+    new $P1237, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1237, control_1236
+    push_eh $P1237
+    .lex "self", self
+    .lex "$chunk", param_1238
+    .lex "%c", param_1239
+.annotate 'line', 459
+    find_lex $P104, "self"
+    find_lex $P1240, "$chunk"
+    unless_null $P1240, vivify_143
+    $P1240 = root_new ['parrot';'ResizablePMCArray']
+  vivify_143:
+    set $P105, $P1240[0]
+    unless_null $P105, vivify_144
+    new $P105, "Undef"
+  vivify_144:
+    find_lex $P106, "%c"
+    $P107 = $P104."to_c"($P105, $P106)
+.annotate 'line', 461
+    find_lex $P108, "self"
+    find_lex $P1241, "$chunk"
+    unless_null $P1241, vivify_145
+    $P1241 = root_new ['parrot';'ResizablePMCArray']
+  vivify_145:
+    set $P109, $P1241[1]
+    unless_null $P109, vivify_146
+    new $P109, "Undef"
+  vivify_146:
+    find_lex $P110, "%c"
+    $P111 = $P108."to_c"($P109, $P110)
+    $P112 = "join"("", "while (", $P107, ") ", $P111)
+.annotate 'line', 456
+    .return ($P112)
+  control_1236:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P104, exception, "payload"
+    .return ($P104)
+.end
+
+
+.namespace ["Ops";"Op"]
+.include "except_types.pasm"
+.sub "to_c:pasttype<do-while>" :nsentry :subid("47_1792415685.75359") :method :outer("11_1792415685.75359")
+    .param pmc param_1245
+    .param pmc param_1246
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 465
+    new $P1244, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1244, control_1243
+    push_eh $P1244
+    .lex "self", self
+    .lex "$chunk", param_1245
+    .lex "%c", param_1246
+.annotate 'line', 468
+    find_lex $P104, "self"
+    find_lex $P1247, "$chunk"
+    unless_null $P1247, vivify_147
+    $P1247 = root_new ['parrot';'ResizablePMCArray']
+  vivify_147:
+    set $P105, $P1247[0]
+    unless_null $P105, vivify_148
+    new $P105, "Undef"
+  vivify_148:
+    find_lex $P106, "%c"
+    $P107 = $P104."to_c"($P105, $P106)
+.annotate 'line', 470
+    find_lex $P108, "self"
+    find_lex $P1248, "$chunk"
+    unless_null $P1248, vivify_149
+    $P1248 = root_new ['parrot';'ResizablePMCArray']
+  vivify_149:
+    set $P109, $P1248[1]
+    unless_null $P109, vivify_150
+    new $P109, "Undef"
+  vivify_150:
+    find_lex $P110, "%c"
+    $P111 = $P108."to_c"($P109, $P110)
+    $P112 = "join"("", "do ", $P107, " while (", $P111, ");")
+.annotate 'line', 465
+    .return ($P112)
+  control_1243:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P104, exception, "payload"
+    .return ($P104)
+.end
+
+
+.namespace ["Ops";"Op"]
+.include "except_types.pasm"
+.sub "to_c:pasttype<for>" :nsentry :subid("48_1792415685.75359") :method :outer("11_1792415685.75359")
+    .param pmc param_1252
+    .param pmc param_1253
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 475
+    new $P1251, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1251, control_1250
+    push_eh $P1251
+    .lex "self", self
+    .lex "$chunk", param_1252
+    .lex "%c", param_1253
+.annotate 'line', 478
+    find_lex $P1255, "$chunk"
+    unless_null $P1255, vivify_151
+    $P1255 = root_new ['parrot';'ResizablePMCArray']
+  vivify_151:
+    set $P105, $P1255[0]
+    unless_null $P105, vivify_152
+    new $P105, "Undef"
+  vivify_152:
+    if $P105, if_1254
+    new $P110, "String"
+    assign $P110, ""
+    set $P104, $P110
+    goto if_1254_end
+  if_1254:
+    find_lex $P106, "self"
+    find_lex $P1256, "$chunk"
+    unless_null $P1256, vivify_153
+    $P1256 = root_new ['parrot';'ResizablePMCArray']
+  vivify_153:
+    set $P107, $P1256[0]
+    unless_null $P107, vivify_154
+    new $P107, "Undef"
+  vivify_154:
+    find_lex $P108, "%c"
+    $P109 = $P106."to_c"($P107, $P108)
+    set $P104, $P109
+  if_1254_end:
+.annotate 'line', 480
+    find_lex $P1258, "$chunk"
+    unless_null $P1258, vivify_155
+    $P1258 = root_new ['parrot';'ResizablePMCArray']
+  vivify_155:
+    set $P112, $P1258[1]
+    unless_null $P112, vivify_156
+    new $P112, "Undef"
+  vivify_156:
+    if $P112, if_1257
+    new $P117, "String"
+    assign $P117, ""
+    set $P111, $P117
+    goto if_1257_end
+  if_1257:
+    find_lex $P113, "self"
+    find_lex $P1259, "$chunk"
+    unless_null $P1259, vivify_157
+    $P1259 = root_new ['parrot';'ResizablePMCArray']
+  vivify_157:
+    set $P114, $P1259[1]
+    unless_null $P114, vivify_158
+    new $P114, "Undef"
+  vivify_158:
+    find_lex $P115, "%c"
+    $P116 = $P113."to_c"($P114, $P115)
+    set $P111, $P116
+  if_1257_end:
+.annotate 'line', 482
+    find_lex $P1261, "$chunk"
+    unless_null $P1261, vivify_159
+    $P1261 = root_new ['parrot';'ResizablePMCArray']
+  vivify_159:
+    set $P119, $P1261[2]
+    unless_null $P119, vivify_160
+    new $P119, "Undef"
+  vivify_160:
+    if $P119, if_1260
+    new $P124, "String"
+    assign $P124, ""
+    set $P118, $P124
+    goto if_1260_end
+  if_1260:
+    find_lex $P120, "self"
+    find_lex $P1262, "$chunk"
+    unless_null $P1262, vivify_161
+    $P1262 = root_new ['parrot';'ResizablePMCArray']
+  vivify_161:
+    set $P121, $P1262[2]
+    unless_null $P121, vivify_162
+    new $P121, "Undef"
+  vivify_162:
+    find_lex $P122, "%c"
+    $P123 = $P120."to_c"($P121, $P122)
+    set $P118, $P123
+  if_1260_end:
+.annotate 'line', 484
+    find_lex $P125, "self"
+    find_lex $P1263, "$chunk"
+    unless_null $P1263, vivify_163
+    $P1263 = root_new ['parrot';'ResizablePMCArray']
+  vivify_163:
+    set $P126, $P1263[3]
+    unless_null $P126, vivify_164
+    new $P126, "Undef"
+  vivify_164:
+    find_lex $P127, "%c"
+    $P128 = $P125."to_c"($P126, $P127)
+    $P129 = "join"("", "for (", $P104, "; ", $P111, "; ", $P118, ") ", $P128)
+.annotate 'line', 475
+    .return ($P129)
+  control_1250:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P104, exception, "payload"
+    .return ($P104)
+.end
+
+
+.namespace ["Ops";"Op"]
+.include "except_types.pasm"
+.sub "to_c:pasttype<switch>" :nsentry :subid("49_1792415685.75359") :method :outer("11_1792415685.75359")
+    .param pmc param_1267
+    .param pmc param_1268
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 488
+    new $P1266, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1266, control_1265
+    push_eh $P1266
+    .lex "self", self
+    .lex "$chunk", param_1267
+    .lex "%c", param_1268
+.annotate 'line', 491
+    find_lex $P104, "self"
+    find_lex $P1269, "$chunk"
+    unless_null $P1269, vivify_165
+    $P1269 = root_new ['parrot';'ResizablePMCArray']
+  vivify_165:
+    set $P105, $P1269[0]
+    unless_null $P105, vivify_166
+    new $P105, "Undef"
+  vivify_166:
+    find_lex $P106, "%c"
+    $P107 = $P104."to_c"($P105, $P106)
+.annotate 'line', 494
+    find_lex $P108, "self"
+    find_lex $P1270, "$chunk"
+    unless_null $P1270, vivify_167
+    $P1270 = root_new ['parrot';'ResizablePMCArray']
+  vivify_167:
+    set $P109, $P1270[1]
+    unless_null $P109, vivify_168
+    new $P109, "Undef"
+  vivify_168:
+    find_lex $P110, "%c"
+    $P111 = $P108."to_c"($P109, $P110)
+.annotate 'line', 496
+    find_lex $P112, "%c"
+    $P113 = "indent"($P112)
+    $P114 = "join"("", "switch (", $P107, ") {", "\n", $P111, "\n", $P113, "}")
+.annotate 'line', 488
+    .return ($P114)
+  control_1265:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P104, exception, "payload"
+    .return ($P104)
+.end
+
+
+.namespace ["Ops";"Op"]
+.include "except_types.pasm"
+.sub "to_c:pasttype<undef>" :nsentry :subid("50_1792415685.75359") :method :outer("11_1792415685.75359")
+    .param pmc param_1274
+    .param pmc param_1275
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 501
+    .const 'Sub' $P1310 = "53_1792415685.75359" 
+    capture_lex $P1310
+    .const 'Sub' $P1300 = "52_1792415685.75359" 
+    capture_lex $P1300
+    .const 'Sub' $P1289 = "51_1792415685.75359" 
+    capture_lex $P1289
+    new $P1273, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1273, control_1272
+    push_eh $P1273
+    .lex "self", self
+    .lex "$chunk", param_1274
+    .lex "%c", param_1275
+.annotate 'line', 502
+    new $P104, "Undef"
+    set $P1276, $P104
+    .lex "$pirop", $P1276
+    find_lex $P105, "$chunk"
+    $P106 = $P105."pirop"()
+    store_lex "$pirop", $P106
+.annotate 'line', 504
+    find_lex $P106, "$pirop"
+    if $P106, if_1277
+.annotate 'line', 543
+    find_lex $P109, "$chunk"
+    $P110 = $P109."returns"()
+    if $P110, if_1318
+.annotate 'line', 552
+    find_lex $P1321, "$chunk"
+    unless_null $P1321, vivify_169
+    $P1321 = root_new ['parrot';'Hash']
+  vivify_169:
+    set $P112, $P1321["control"]
+    unless_null $P112, vivify_170
+    new $P112, "Undef"
+  vivify_170:
+    if $P112, if_1320
+.annotate 'line', 555
+    find_lex $P1324, "$chunk"
+    unless_null $P1324, vivify_171
+    $P1324 = root_new ['parrot';'Hash']
+  vivify_171:
+    set $P115, $P1324["label"]
+    unless_null $P115, vivify_172
+    new $P115, "Undef"
+  vivify_172:
+    if $P115, if_1323
+.annotate 'line', 560
+    find_lex $P118, "$chunk"
+    "_dumper"($P118)
+.annotate 'line', 561
+    die "Unhandled chunk"
+.annotate 'line', 559
+    goto if_1323_end
+  if_1323:
+.annotate 'line', 555
+    new $P116, "String"
+    assign $P116, ""
+    set $P114, $P116
+  if_1323_end:
+    set $P111, $P114
+.annotate 'line', 552
+    goto if_1320_end
+  if_1320:
+    find_lex $P1322, "$chunk"
+    unless_null $P1322, vivify_173
+    $P1322 = root_new ['parrot';'Hash']
+  vivify_173:
+    set $P113, $P1322["control"]
+    unless_null $P113, vivify_174
+    new $P113, "Undef"
+  vivify_174:
+    set $P111, $P113
+  if_1320_end:
+    set $P108, $P111
+.annotate 'line', 543
+    goto if_1318_end
+  if_1318:
+.annotate 'line', 547
+    find_lex $P111, "$chunk"
+    $P112 = $P111."returns"()
+.annotate 'line', 549
+    find_lex $P113, "self"
+    find_lex $P1319, "$chunk"
+    unless_null $P1319, vivify_175
+    $P1319 = root_new ['parrot';'ResizablePMCArray']
+  vivify_175:
+    set $P114, $P1319[0]
+    unless_null $P114, vivify_176
+    new $P114, "Undef"
+  vivify_176:
+    find_lex $P115, "%c"
+    $P116 = $P113."to_c"($P114, $P115)
+    $P117 = "join"("", "(", $P112, ")", $P116)
+.annotate 'line', 543
+    set $P108, $P117
+  if_1318_end:
+    set $P105, $P108
+.annotate 'line', 504
+    goto if_1277_end
+  if_1277:
+.annotate 'line', 506
+    find_lex $P108, "$pirop"
+    set $S100, $P108
+    iseq $I100, $S100, ","
+    if $I100, if_1278
+.annotate 'line', 509
+    find_lex $P110, "$pirop"
+    set $S101, $P110
+    iseq $I101, $S101, "="
+    if $I101, if_1279
+.annotate 'line', 514
+    find_lex $P114, "$pirop"
+    set $S102, $P114
+    iseq $I102, $S102, "arrow"
+    unless $I102, unless_1283
+    new $P113, 'Integer'
+    set $P113, $I102
+    goto unless_1283_end
+  unless_1283:
+    find_lex $P115, "$pirop"
+    set $S103, $P115
+    iseq $I103, $S103, "dotty"
+    new $P113, 'Integer'
+    set $P113, $I103
+  unless_1283_end:
+    if $P113, if_1282
+.annotate 'line', 519
+    get_hll_global $P117, ["Regex"], "Regex"
+    .const 'Sub' $P1289 = "51_1792415685.75359" 
+    capture_lex $P1289
+    $P118 = $P117."new"($P1289)
+    find_lex $P119, "$chunk"
+    $P121 = $P119."name"()
+    $P122 = $P118."ACCEPTS"($P121)
+    if $P122, if_1287
+.annotate 'line', 526
+    get_hll_global $P124, ["Regex"], "Regex"
+    .const 'Sub' $P1300 = "52_1792415685.75359" 
+    capture_lex $P1300
+    $P125 = $P124."new"($P1300)
+    find_lex $P126, "$chunk"
+    $P128 = $P126."name"()
+    $P129 = $P125."ACCEPTS"($P128)
+    if $P129, if_1298
+.annotate 'line', 532
+    get_hll_global $P131, ["Regex"], "Regex"
+    .const 'Sub' $P1310 = "53_1792415685.75359" 
+    capture_lex $P1310
+    $P132 = $P131."new"($P1310)
+    find_lex $P133, "$chunk"
+    $P134 = $P133."name"()
+    $P135 = $P132."ACCEPTS"($P134)
+    if $P135, if_1308
+.annotate 'line', 539
+    find_lex $P136, "$chunk"
+    "_dumper"($P136)
+.annotate 'line', 540
+    die "Unhandled chunk for pirop"
+.annotate 'line', 538
+    goto if_1308_end
+  if_1308:
+.annotate 'line', 534
+    new $P136, "String"
+    assign $P136, "("
+    find_lex $P137, "self"
+    find_lex $P1313, "$chunk"
+    unless_null $P1313, vivify_189
+    $P1313 = root_new ['parrot';'ResizablePMCArray']
+  vivify_189:
+    set $P138, $P1313[0]
+    unless_null $P138, vivify_190
+    new $P138, "Undef"
+  vivify_190:
+    find_lex $P141, "%c"
+    $S104 = $P137."to_c"($P138, $P141)
+    concat $P142, $P136, $S104
+.annotate 'line', 535
+    find_lex $P143, "$pirop"
+    get_global $P1315, "%PIROP_MAPPING"
+    unless_null $P1315, vivify_191
+    $P1315 = root_new ['parrot';'Hash']
+  vivify_191:
+    set $P144, $P1315[$P143]
+    unless_null $P144, vivify_192
+    new $P144, "Undef"
+  vivify_192:
+    set $P1314, $P144
+    defined $I1317, $P1314
+    if $I1317, default_1316
+    find_lex $P145, "$pirop"
+    set $P1314, $P145
+  default_1316:
+    concat $P146, $P142, $P1314
+    concat $P147, $P146, ")"
+.annotate 'line', 532
+    set $P130, $P147
+  if_1308_end:
+    set $P123, $P130
+.annotate 'line', 526
+    goto if_1298_end
+  if_1298:
+.annotate 'line', 528
+    new $P130, "String"
+    assign $P130, "("
+    find_lex $P131, "$pirop"
+    get_global $P1304, "%PIROP_MAPPING"
+    unless_null $P1304, vivify_193
+    $P1304 = root_new ['parrot';'Hash']
+  vivify_193:
+    set $P132, $P1304[$P131]
+    unless_null $P132, vivify_194
+    new $P132, "Undef"
+  vivify_194:
+    set $P1303, $P132
+    defined $I1306, $P1303
+    if $I1306, default_1305
+    find_lex $P133, "$pirop"
+    set $P1303, $P133
+  default_1305:
+    concat $P134, $P130, $P1303
+.annotate 'line', 529
+    find_lex $P135, "self"
+    find_lex $P1307, "$chunk"
+    unless_null $P1307, vivify_195
+    $P1307 = root_new ['parrot';'ResizablePMCArray']
+  vivify_195:
+    set $P136, $P1307[0]
+    unless_null $P136, vivify_196
+    new $P136, "Undef"
+  vivify_196:
+    find_lex $P137, "%c"
+    $S104 = $P135."to_c"($P136, $P137)
+    concat $P138, $P134, $S104
+    concat $P140, $P138, ")"
+.annotate 'line', 526
+    set $P123, $P140
+  if_1298_end:
+    set $P116, $P123
+.annotate 'line', 519
+    goto if_1287_end
+  if_1287:
+.annotate 'line', 521
+    new $P123, "String"
+    assign $P123, "("
+    find_lex $P124, "self"
+    find_lex $P1292, "$chunk"
+    unless_null $P1292, vivify_197
+    $P1292 = root_new ['parrot';'ResizablePMCArray']
+  vivify_197:
+    set $P125, $P1292[0]
+    unless_null $P125, vivify_198
+    new $P125, "Undef"
+  vivify_198:
+    find_lex $P126, "%c"
+    $S104 = $P124."to_c"($P125, $P126)
+    concat $P128, $P123, $S104
+    concat $P129, $P128, " "
+.annotate 'line', 522
+    find_lex $P130, "$pirop"
+    get_global $P1294, "%PIROP_MAPPING"
+    unless_null $P1294, vivify_199
+    $P1294 = root_new ['parrot';'Hash']
+  vivify_199:
+    set $P131, $P1294[$P130]
+    unless_null $P131, vivify_200
+    new $P131, "Undef"
+  vivify_200:
+    set $P1293, $P131
+    defined $I1296, $P1293
+    if $I1296, default_1295
+    find_lex $P132, "$pirop"
+    set $P1293, $P132
+  default_1295:
+    concat $P133, $P129, $P1293
+    concat $P134, $P133, " "
+.annotate 'line', 523
+    find_lex $P135, "self"
+    find_lex $P1297, "$chunk"
+    unless_null $P1297, vivify_201
+    $P1297 = root_new ['parrot';'ResizablePMCArray']
+  vivify_201:
+    set $P136, $P1297[1]
+    unless_null $P136, vivify_202
+    new $P136, "Undef"
+  vivify_202:
+    find_lex $P137, "%c"
+    $S105 = $P135."to_c"($P136, $P137)
+    concat $P138, $P134, $S105
+    concat $P139, $P138, ")"
+.annotate 'line', 519
+    set $P116, $P139
+  if_1287_end:
+    set $P111, $P116
+.annotate 'line', 514
+    goto if_1282_end
+  if_1282:
+.annotate 'line', 515
+    find_lex $P116, "self"
+    find_lex $P1284, "$chunk"
+    unless_null $P1284, vivify_203
+    $P1284 = root_new ['parrot';'ResizablePMCArray']
+  vivify_203:
+    set $P117, $P1284[0]
+    unless_null $P117, vivify_204
+    new $P117, "Undef"
+  vivify_204:
+    find_lex $P118, "%c"
+    $P119 = $P116."to_c"($P117, $P118)
+    find_lex $P121, "$pirop"
+    get_global $P1285, "%PIROP_MAPPING"
+    unless_null $P1285, vivify_205
+    $P1285 = root_new ['parrot';'Hash']
+  vivify_205:
+    set $P122, $P1285[$P121]
+    unless_null $P122, vivify_206
+    new $P122, "Undef"
+  vivify_206:
+    concat $P123, $P119, $P122
+.annotate 'line', 517
+    find_lex $P124, "self"
+    find_lex $P1286, "$chunk"
+    unless_null $P1286, vivify_207
+    $P1286 = root_new ['parrot';'ResizablePMCArray']
+  vivify_207:
+    set $P125, $P1286[1]
+    unless_null $P125, vivify_208
+    new $P125, "Undef"
+  vivify_208:
+    find_lex $P126, "%c"
+    $S104 = $P124."to_c"($P125, $P126)
+    concat $P127, $P123, $S104
+.annotate 'line', 514
+    set $P111, $P127
+  if_1282_end:
+    set $P109, $P111
+.annotate 'line', 509
+    goto if_1279_end
+  if_1279:
+.annotate 'line', 510
+    find_lex $P111, "self"
+    find_lex $P1280, "$chunk"
+    unless_null $P1280, vivify_209
+    $P1280 = root_new ['parrot';'ResizablePMCArray']
+  vivify_209:
+    set $P113, $P1280[0]
+    unless_null $P113, vivify_210
+    new $P113, "Undef"
+  vivify_210:
+    find_lex $P114, "%c"
+    $P115 = $P111."to_c"($P113, $P114)
+    concat $P116, $P115, " = "
+.annotate 'line', 512
+    find_lex $P117, "self"
+    find_lex $P1281, "$chunk"
+    unless_null $P1281, vivify_211
+    $P1281 = root_new ['parrot';'ResizablePMCArray']
+  vivify_211:
+    set $P118, $P1281[1]
+    unless_null $P118, vivify_212
+    new $P118, "Undef"
+  vivify_212:
+    find_lex $P119, "%c"
+    $S102 = $P117."to_c"($P118, $P119)
+    concat $P120, $P116, $S102
+.annotate 'line', 509
+    set $P109, $P120
+  if_1279_end:
+    set $P107, $P109
+.annotate 'line', 506
+    goto if_1278_end
+  if_1278:
+.annotate 'line', 507
+    find_lex $P109, "self"
+    find_lex $P110, "$chunk"
+    find_lex $P111, "%c"
+    $P112 = $P109."join_children"($P110, $P111, ", ")
+.annotate 'line', 506
+    set $P107, $P112
+  if_1278_end:
+.annotate 'line', 504
+    set $P105, $P107
+  if_1277_end:
+.annotate 'line', 501
+    .return ($P105)
+  control_1272:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P106, exception, "payload"
+    .return ($P106)
+.end
+
+
+.namespace ["Ops";"Op"]
+.sub "_block1288"  :anon :subid("51_1792415685.75359") :method :outer("50_1792415685.75359")
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 519
+    .local string rx1290_tgt
+    .local int rx1290_pos
+    .local int rx1290_off
+    .local int rx1290_eos
+    .local int rx1290_rep
+    .local pmc rx1290_cur
+    .local pmc rx1290_debug
+    (rx1290_cur, rx1290_pos, rx1290_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1290_debug, rx1290_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1290_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1290_eos, rx1290_tgt
+    gt rx1290_pos, rx1290_eos, rx1290_done
+    set rx1290_off, 0
+    lt rx1290_pos, 2, rx1290_start
+    sub rx1290_off, rx1290_pos, 1
+    substr rx1290_tgt, rx1290_tgt, rx1290_off
+  rx1290_start:
+    eq $I10, 1, rx1290_restart
+    if_null rx1290_debug, debug_177
+    rx1290_cur."!cursor_debug"("START", "")
+  debug_177:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1291_done
+    goto rxscan1291_scan
+  rxscan1291_loop:
+    ($P10) = rx1290_cur."from"()
+    inc $P10
+    set rx1290_pos, $P10
+    ge rx1290_pos, rx1290_eos, rxscan1291_done
+  rxscan1291_scan:
+    set_addr $I10, rxscan1291_loop
+    rx1290_cur."!mark_push"(0, rx1290_pos, $I10)
+  rxscan1291_done:
+  # rx literal  "infix"
+    add $I11, rx1290_pos, 5
+    gt $I11, rx1290_eos, rx1290_fail
+    sub $I11, rx1290_pos, rx1290_off
+    substr $S10, rx1290_tgt, $I11, 5
+    ne $S10, "infix", rx1290_fail
+    add rx1290_pos, 5
+  # rx pass
+    rx1290_cur."!cursor_pass"(rx1290_pos, "")
+    if_null rx1290_debug, debug_178
+    rx1290_cur."!cursor_debug"("PASS", "", " at pos=", rx1290_pos)
+  debug_178:
+    rx1290_cur."!cursor_backtrack"()
+    .return (rx1290_cur)
+  rx1290_restart:
+    if_null rx1290_debug, debug_179
+    rx1290_cur."!cursor_debug"("NEXT", "")
+  debug_179:
+  rx1290_fail:
+    (rx1290_rep, rx1290_pos, $I10, $P10) = rx1290_cur."!mark_fail"(0)
+    lt rx1290_pos, -1, rx1290_done
+    eq rx1290_pos, -1, rx1290_fail
+    jump $I10
+  rx1290_done:
+    rx1290_cur."!cursor_fail"()
+    if_null rx1290_debug, debug_180
+    rx1290_cur."!cursor_debug"("FAIL", "")
+  debug_180:
+    .return (rx1290_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Op"]
+.sub "_block1299"  :anon :subid("52_1792415685.75359") :method :outer("50_1792415685.75359")
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 526
+    .local string rx1301_tgt
+    .local int rx1301_pos
+    .local int rx1301_off
+    .local int rx1301_eos
+    .local int rx1301_rep
+    .local pmc rx1301_cur
+    .local pmc rx1301_debug
+    (rx1301_cur, rx1301_pos, rx1301_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1301_debug, rx1301_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1301_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1301_eos, rx1301_tgt
+    gt rx1301_pos, rx1301_eos, rx1301_done
+    set rx1301_off, 0
+    lt rx1301_pos, 2, rx1301_start
+    sub rx1301_off, rx1301_pos, 1
+    substr rx1301_tgt, rx1301_tgt, rx1301_off
+  rx1301_start:
+    eq $I10, 1, rx1301_restart
+    if_null rx1301_debug, debug_181
+    rx1301_cur."!cursor_debug"("START", "")
+  debug_181:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1302_done
+    goto rxscan1302_scan
+  rxscan1302_loop:
+    ($P10) = rx1301_cur."from"()
+    inc $P10
+    set rx1301_pos, $P10
+    ge rx1301_pos, rx1301_eos, rxscan1302_done
+  rxscan1302_scan:
+    set_addr $I10, rxscan1302_loop
+    rx1301_cur."!mark_push"(0, rx1301_pos, $I10)
+  rxscan1302_done:
+  # rx literal  "prefix"
+    add $I11, rx1301_pos, 6
+    gt $I11, rx1301_eos, rx1301_fail
+    sub $I11, rx1301_pos, rx1301_off
+    substr $S10, rx1301_tgt, $I11, 6
+    ne $S10, "prefix", rx1301_fail
+    add rx1301_pos, 6
+  # rx pass
+    rx1301_cur."!cursor_pass"(rx1301_pos, "")
+    if_null rx1301_debug, debug_182
+    rx1301_cur."!cursor_debug"("PASS", "", " at pos=", rx1301_pos)
+  debug_182:
+    rx1301_cur."!cursor_backtrack"()
+    .return (rx1301_cur)
+  rx1301_restart:
+    if_null rx1301_debug, debug_183
+    rx1301_cur."!cursor_debug"("NEXT", "")
+  debug_183:
+  rx1301_fail:
+    (rx1301_rep, rx1301_pos, $I10, $P10) = rx1301_cur."!mark_fail"(0)
+    lt rx1301_pos, -1, rx1301_done
+    eq rx1301_pos, -1, rx1301_fail
+    jump $I10
+  rx1301_done:
+    rx1301_cur."!cursor_fail"()
+    if_null rx1301_debug, debug_184
+    rx1301_cur."!cursor_debug"("FAIL", "")
+  debug_184:
+    .return (rx1301_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Op"]
+.sub "_block1309"  :anon :subid("53_1792415685.75359") :method :outer("50_1792415685.75359")
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 532
+    .local string rx1311_tgt
+    .local int rx1311_pos
+    .local int rx1311_off
+    .local int rx1311_eos
+    .local int rx1311_rep
+    .local pmc rx1311_cur
+    .local pmc rx1311_debug
+    (rx1311_cur, rx1311_pos, rx1311_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1311_debug, rx1311_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1311_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1311_eos, rx1311_tgt
+    gt rx1311_pos, rx1311_eos, rx1311_done
+    set rx1311_off, 0
+    lt rx1311_pos, 2, rx1311_start
+    sub rx1311_off, rx1311_pos, 1
+    substr rx1311_tgt, rx1311_tgt, rx1311_off
+  rx1311_start:
+    eq $I10, 1, rx1311_restart
+    if_null rx1311_debug, debug_185
+    rx1311_cur."!cursor_debug"("START", "")
+  debug_185:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1312_done
+    goto rxscan1312_scan
+  rxscan1312_loop:
+    ($P10) = rx1311_cur."from"()
+    inc $P10
+    set rx1311_pos, $P10
+    ge rx1311_pos, rx1311_eos, rxscan1312_done
+  rxscan1312_scan:
+    set_addr $I10, rxscan1312_loop
+    rx1311_cur."!mark_push"(0, rx1311_pos, $I10)
+  rxscan1312_done:
+  # rx literal  "postfix"
+    add $I11, rx1311_pos, 7
+    gt $I11, rx1311_eos, rx1311_fail
+    sub $I11, rx1311_pos, rx1311_off
+    substr $S10, rx1311_tgt, $I11, 7
+    ne $S10, "postfix", rx1311_fail
+    add rx1311_pos, 7
+  # rx pass
+    rx1311_cur."!cursor_pass"(rx1311_pos, "")
+    if_null rx1311_debug, debug_186
+    rx1311_cur."!cursor_debug"("PASS", "", " at pos=", rx1311_pos)
+  debug_186:
+    rx1311_cur."!cursor_backtrack"()
+    .return (rx1311_cur)
+  rx1311_restart:
+    if_null rx1311_debug, debug_187
+    rx1311_cur."!cursor_debug"("NEXT", "")
+  debug_187:
+  rx1311_fail:
+    (rx1311_rep, rx1311_pos, $I10, $P10) = rx1311_cur."!mark_fail"(0)
+    lt rx1311_pos, -1, rx1311_done
+    eq rx1311_pos, -1, rx1311_fail
+    jump $I10
+  rx1311_done:
+    rx1311_cur."!cursor_fail"()
+    if_null rx1311_debug, debug_188
+    rx1311_cur."!cursor_debug"("FAIL", "")
+  debug_188:
+    .return (rx1311_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Op"]
+.include "except_types.pasm"
+.sub "to_c" :nsentry :subid("54_1792415685.75359") :method :outer("11_1792415685.75359") :multi(_,["PAST";"Op"],_)
+    .param pmc param_1328
+    .param pmc param_1329
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 565
+    new $P1327, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1327, control_1326
+    push_eh $P1327
+    .lex "self", self
+    .lex "$chunk", param_1328
+    .lex "%c", param_1329
+.annotate 'line', 566
+    $P1331 = root_new ['parrot';'ResizablePMCArray']
+    set $P1330, $P1331
+    .lex "@res", $P1330
+.annotate 'line', 570
+    new $P104, "Undef"
+    set $P1332, $P104
+    .lex "$type", $P1332
+.annotate 'line', 571
+    new $P105, "Undef"
+    set $P1333, $P105
+    .lex "$sub", $P1333
+.annotate 'line', 565
+    find_lex $P106, "@res"
+.annotate 'line', 568
+    find_lex $P1335, "$chunk"
+    unless_null $P1335, vivify_213
+    $P1335 = root_new ['parrot';'Hash']
+  vivify_213:
+    set $P106, $P1335["label"]
+    unless_null $P106, vivify_214
+    new $P106, "Undef"
+  vivify_214:
+    unless $P106, if_1334_end
+    find_lex $P107, "@res"
+    find_lex $P1336, "$chunk"
+    unless_null $P1336, vivify_215
+    $P1336 = root_new ['parrot';'Hash']
+  vivify_215:
+    set $P108, $P1336["label"]
+    unless_null $P108, vivify_216
+    new $P108, "Undef"
+  vivify_216:
+    concat $P109, $P108, "\n"
+    find_lex $P110, "%c"
+    $S100 = "indent"($P110)
+    concat $P111, $P109, $S100
+    $P107."push"($P111)
+  if_1334_end:
+.annotate 'line', 570
+    find_lex $P106, "$chunk"
+    $P107 = $P106."pasttype"()
+    set $P1337, $P107
+    defined $I1339, $P1337
+    if $I1339, default_1338
+    new $P108, "String"
+    assign $P108, "undef"
+    set $P1337, $P108
+  default_1338:
+    store_lex "$type", $P1337
+.annotate 'line', 571
+    new $P106, "String"
+    assign $P106, "to_c:pasttype<"
+    find_lex $P107, "$type"
+    concat $P108, $P106, $P107
+    concat $P109, $P108, ">"
+    set $S100, $P109
+    find_sub_not_null $P110, $S100
+    store_lex "$sub", $P110
+.annotate 'line', 573
+    find_lex $P1341, "$chunk"
+    unless_null $P1341, vivify_217
+    $P1341 = root_new ['parrot';'Hash']
+  vivify_217:
+    set $P106, $P1341["wrap"]
+    unless_null $P106, vivify_218
+    new $P106, "Undef"
+  vivify_218:
+    unless $P106, if_1340_end
+    find_lex $P107, "@res"
+    $P107."push"("(")
+  if_1340_end:
+.annotate 'line', 574
+    find_lex $P106, "@res"
+    find_lex $P107, "$sub"
+    find_lex $P108, "self"
+    find_lex $P109, "$chunk"
+    find_lex $P110, "%c"
+    $P111 = $P107($P108, $P109, $P110)
+    $P106."push"($P111)
+.annotate 'line', 575
+    find_lex $P1343, "$chunk"
+    unless_null $P1343, vivify_219
+    $P1343 = root_new ['parrot';'Hash']
+  vivify_219:
+    set $P106, $P1343["wrap"]
+    unless_null $P106, vivify_220
+    new $P106, "Undef"
+  vivify_220:
+    unless $P106, if_1342_end
+    find_lex $P107, "@res"
+    $P107."push"(")")
+  if_1342_end:
+.annotate 'line', 577
+    find_lex $P106, "@res"
+    $P107 = $P106."join"("")
+.annotate 'line', 565
+    .return ($P107)
+  control_1326:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P106, exception, "payload"
+    .return ($P106)
+.end
+
+
+.namespace ["Ops";"Op"]
+.include "except_types.pasm"
+.sub "to_c" :nsentry :subid("55_1792415685.75359") :method :outer("11_1792415685.75359") :multi(_,["PAST";"Stmts"],_)
+    .param pmc param_1347
+    .param pmc param_1348
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 580
+    .const 'Sub' $P1356 = "56_1792415685.75359" 
+    capture_lex $P1356
+    new $P1346, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1346, control_1345
+    push_eh $P1346
+    .lex "self", self
+    .lex "$chunk", param_1347
+    .lex "%c", param_1348
+.annotate 'line', 583
+    $P1350 = root_new ['parrot';'ResizablePMCArray']
+    set $P1349, $P1350
+    .lex "@res", $P1349
+.annotate 'line', 581
+    get_hll_global $P104, ["PAST"], "Block"
+    find_lex $P1352, "$chunk"
+    unless_null $P1352, vivify_221
+    $P1352 = root_new ['parrot';'ResizablePMCArray']
+  vivify_221:
+    set $P105, $P1352[0]
+    unless_null $P105, vivify_222
+    new $P105, "Undef"
+  vivify_222:
+    $P106 = $P104."ACCEPTS"($P105)
+    if $P106, unless_1351_end
+    find_lex $P1353, "%c"
+    unless_null $P1353, vivify_223
+    $P1353 = root_new ['parrot';'Hash']
+  vivify_223:
+    set $P107, $P1353["level"]
+    unless_null $P107, vivify_224
+    new $P107, "Undef"
+  vivify_224:
+    clone $P1354, $P107
+    inc $P107
+  unless_1351_end:
+.annotate 'line', 580
+    find_lex $P104, "@res"
+.annotate 'line', 584
+    find_lex $P105, "$chunk"
+    $P106 = $P105."list"()
+    defined $I100, $P106
+    unless $I100, for_undef_225
+    iter $P104, $P106
+    new $P108, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P108, loop1360_handler
+    push_eh $P108
+  loop1360_test:
+    unless $P104, loop1360_done
+    shift $P107, $P104
+  loop1360_redo:
+    .const 'Sub' $P1356 = "56_1792415685.75359" 
+    capture_lex $P1356
+    $P1356($P107)
+  loop1360_next:
+    goto loop1360_test
+  loop1360_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P110, exception, 'type'
+    eq $P110, .CONTROL_LOOP_NEXT, loop1360_next
+    eq $P110, .CONTROL_LOOP_REDO, loop1360_redo
+  loop1360_done:
+    pop_eh 
+  for_undef_225:
+.annotate 'line', 591
+    get_hll_global $P104, ["PAST"], "Block"
+    find_lex $P1362, "$chunk"
+    unless_null $P1362, vivify_226
+    $P1362 = root_new ['parrot';'ResizablePMCArray']
+  vivify_226:
+    set $P105, $P1362[0]
+    unless_null $P105, vivify_227
+    new $P105, "Undef"
+  vivify_227:
+    $P106 = $P104."ACCEPTS"($P105)
+    if $P106, unless_1361_end
+    find_lex $P1363, "%c"
+    unless_null $P1363, vivify_228
+    $P1363 = root_new ['parrot';'Hash']
+  vivify_228:
+    set $P107, $P1363["level"]
+    unless_null $P107, vivify_229
+    new $P107, "Undef"
+  vivify_229:
+    clone $P1364, $P107
+    dec $P107
+  unless_1361_end:
+.annotate 'line', 593
+    find_lex $P104, "@res"
+    $P105 = $P104."join"("")
+.annotate 'line', 580
+    .return ($P105)
+  control_1345:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P104, exception, "payload"
+    .return ($P104)
+.end
+
+
+.namespace ["Ops";"Op"]
+.sub "_block1355"  :anon :subid("56_1792415685.75359") :outer("55_1792415685.75359")
+    .param pmc param_1357
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 584
+    .lex "$_", param_1357
+.annotate 'line', 585
+    get_hll_global $P108, ["PAST"], "Block"
+    find_lex $P109, "$_"
+    $P110 = $P108."ACCEPTS"($P109)
+    if $P110, unless_1358_end
+    find_lex $P111, "@res"
+    find_lex $P112, "$_"
+    find_lex $P113, "%c"
+    $P114 = "indent"($P112, $P113)
+    $P111."push"($P114)
+  unless_1358_end:
+.annotate 'line', 587
+    find_lex $P108, "@res"
+    find_lex $P109, "self"
+    find_lex $P110, "$_"
+    find_lex $P111, "%c"
+    $P112 = $P109."to_c"($P110, $P111)
+    $P108."push"($P112)
+.annotate 'line', 588
+    find_lex $P108, "$_"
+    $P109 = "need_semicolon"($P108)
+    unless $P109, if_1359_end
+    find_lex $P110, "@res"
+    $P110."push"(";")
+  if_1359_end:
+.annotate 'line', 589
+    find_lex $P108, "@res"
+    $P109 = $P108."push"("\n")
+.annotate 'line', 584
+    .return ($P109)
+.end
+
+
+.namespace ["Ops";"Op"]
+.include "except_types.pasm"
+.sub "to_c" :nsentry :subid("57_1792415685.75359") :method :outer("11_1792415685.75359") :multi(_,["PAST";"Block"],_)
+    .param pmc param_1368
+    .param pmc param_1369
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 596
+    .const 'Sub' $P1380 = "58_1792415685.75359" 
+    capture_lex $P1380
+    new $P1367, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1367, control_1366
+    push_eh $P1367
+    .lex "self", self
+    .lex "$chunk", param_1368
+    .lex "%c", param_1369
+.annotate 'line', 598
+    new $P104, "Undef"
+    set $P1370, $P104
+    .lex "$need_space", $P1370
+.annotate 'line', 600
+    $P1372 = root_new ['parrot';'ResizablePMCArray']
+    set $P1371, $P1372
+    .lex "@res", $P1371
+.annotate 'line', 598
+    find_lex $P1373, "$chunk"
+    unless_null $P1373, vivify_230
+    $P1373 = root_new ['parrot';'ResizablePMCArray']
+  vivify_230:
+    set $P105, $P1373[0]
+    unless_null $P105, vivify_231
+    new $P105, "Undef"
+  vivify_231:
+    $P106 = "need_space"($P105)
+    store_lex "$need_space", $P106
+.annotate 'line', 596
+    find_lex $P105, "@res"
+.annotate 'line', 601
+    find_lex $P1375, "$chunk"
+    unless_null $P1375, vivify_232
+    $P1375 = root_new ['parrot';'Hash']
+  vivify_232:
+    set $P105, $P1375["label"]
+    unless_null $P105, vivify_233
+    new $P105, "Undef"
+  vivify_233:
+    unless $P105, if_1374_end
+    find_lex $P106, "@res"
+    find_lex $P107, "$chunk"
+    find_lex $P108, "%c"
+    $P109 = "indent"($P107, $P108)
+    find_lex $P1376, "$chunk"
+    unless_null $P1376, vivify_234
+    $P1376 = root_new ['parrot';'Hash']
+  vivify_234:
+    set $P110, $P1376["label"]
+    unless_null $P110, vivify_235
+    new $P110, "Undef"
+  vivify_235:
+    concat $P111, $P109, $P110
+    concat $P112, $P111, "\n"
+    find_lex $P113, "%c"
+    $S100 = "indent"($P113)
+    concat $P114, $P112, $S100
+    $P106."push"($P114)
+  if_1374_end:
+.annotate 'line', 596
+    find_lex $P1377, "%c"
+    unless_null $P1377, vivify_236
+    $P1377 = root_new ['parrot';'Hash']
+  vivify_236:
+    set $P105, $P1377["level"]
+    unless_null $P105, vivify_237
+    new $P105, "Undef"
+  vivify_237:
+    clone $P1378, $P105
+    inc $P105
+.annotate 'line', 605
+    find_lex $P105, "@res"
+    $P105."push"("{\n")
+.annotate 'line', 607
+    find_lex $P106, "$chunk"
+    $P107 = $P106."list"()
+    defined $I100, $P107
+    unless $I100, for_undef_238
+    iter $P105, $P107
+    new $P109, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P109, loop1385_handler
+    push_eh $P109
+  loop1385_test:
+    unless $P105, loop1385_done
+    shift $P108, $P105
+  loop1385_redo:
+    .const 'Sub' $P1380 = "58_1792415685.75359" 
+    capture_lex $P1380
+    $P1380($P108)
+  loop1385_next:
+    goto loop1385_test
+  loop1385_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P111, exception, 'type'
+    eq $P111, .CONTROL_LOOP_NEXT, loop1385_next
+    eq $P111, .CONTROL_LOOP_REDO, loop1385_redo
+  loop1385_done:
+    pop_eh 
+  for_undef_238:
+.annotate 'line', 596
+    find_lex $P1386, "%c"
+    unless_null $P1386, vivify_239
+    $P1386 = root_new ['parrot';'Hash']
+  vivify_239:
+    set $P105, $P1386["level"]
+    unless_null $P105, vivify_240
+    new $P105, "Undef"
+  vivify_240:
+    clone $P1387, $P105
+    dec $P105
+.annotate 'line', 621
+    find_lex $P105, "@res"
+    find_lex $P106, "%c"
+    $P107 = "indent"($P106)
+    $P105."push"($P107)
+.annotate 'line', 622
+    find_lex $P105, "@res"
+    $P105."push"("}")
+.annotate 'line', 624
+    find_lex $P105, "@res"
+    $P106 = $P105."join"("")
+.annotate 'line', 596
+    .return ($P106)
+  control_1366:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P105, exception, "payload"
+    .return ($P105)
+.end
+
+
+.namespace ["Ops";"Op"]
+.sub "_block1379"  :anon :subid("58_1792415685.75359") :outer("57_1792415685.75359")
+    .param pmc param_1381
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 607
+    .lex "$_", param_1381
+.annotate 'line', 608
+    find_lex $P110, "$need_space"
+    if $P110, if_1383
+    set $P109, $P110
+    goto if_1383_end
+  if_1383:
+    find_lex $P111, "$_"
+    $P112 = "need_space"($P111)
+    isfalse $I101, $P112
+    new $P109, 'Integer'
+    set $P109, $I101
+  if_1383_end:
+    unless $P109, if_1382_end
+.annotate 'line', 610
+    find_lex $P113, "@res"
+    $P113."push"("\n")
+.annotate 'line', 611
+    new $P113, "Integer"
+    assign $P113, 0
+    store_lex "$need_space", $P113
+  if_1382_end:
+.annotate 'line', 614
+    find_lex $P109, "@res"
+    find_lex $P110, "$_"
+    find_lex $P111, "%c"
+    $P112 = "indent"($P110, $P111)
+    $P109."push"($P112)
+.annotate 'line', 615
+    find_lex $P109, "@res"
+    find_lex $P110, "self"
+    find_lex $P111, "$_"
+    find_lex $P112, "%c"
+    $P113 = $P110."to_c"($P111, $P112)
+    $P109."push"($P113)
+.annotate 'line', 616
+    find_lex $P109, "@res"
+    find_lex $P111, "$_"
+    $P112 = "need_semicolon"($P111)
+    if $P112, if_1384
+    new $P114, "String"
+    assign $P114, "\n"
+    set $P110, $P114
+    goto if_1384_end
+  if_1384:
+    new $P113, "String"
+    assign $P113, ";"
+    set $P110, $P113
+  if_1384_end:
+    $P109."push"($P110)
+.annotate 'line', 617
+    find_lex $P109, "@res"
+    $P110 = $P109."push"("\n")
+.annotate 'line', 607
+    .return ($P110)
+.end
+
+
+.namespace ["Ops";"Op"]
+.include "except_types.pasm"
+.sub "to_c" :nsentry :subid("59_1792415685.75359") :method :outer("11_1792415685.75359") :multi(_,["String"],_)
+    .param pmc param_1391
+    .param pmc param_1392
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 648
+    new $P1390, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1390, control_1389
+    push_eh $P1390
+    .lex "self", self
+    .lex "$str", param_1391
+    .lex "%c", param_1392
+    find_lex $P104, "$str"
+    .return ($P104)
+  control_1389:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P105, exception, "payload"
+    .return ($P105)
+.end
+
+
+.namespace ["Ops";"Op"]
+.include "except_types.pasm"
+.sub "size"  :subid("60_1792415685.75359") :method :outer("11_1792415685.75359")
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 661
+    new $P1395, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1395, control_1394
+    push_eh $P1395
+    .lex "self", self
+.annotate 'line', 662
+    new $P104, "Exception"
+    set $P104['type'], .CONTROL_RETURN
+    find_lex $P106, "self"
+    $P107 = $P106."args"()
+    does $I100, $P107, "array"
+    if $I100, if_1396
+    new $P112, "Integer"
+    assign $P112, 2
+    set $P105, $P112
+    goto if_1396_end
+  if_1396:
+    find_lex $P108, "self"
+    $P109 = $P108."args"()
+    set $N100, $P109
+    new $P110, 'Float'
+    set $P110, $N100
+    add $P111, $P110, 1
+    set $P105, $P111
+  if_1396_end:
+    setattribute $P104, 'payload', $P105
+    throw $P104
+.annotate 'line', 661
+    .return ()
+  control_1394:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P104, exception, "payload"
+    .return ($P104)
+.end
+
+
+.namespace ["Ops";"Op"]
+.include "except_types.pasm"
+.sub "join_children"  :subid("61_1792415685.75359") :method :outer("11_1792415685.75359")
+    .param pmc param_1400
+    .param pmc param_1401
+    .param pmc param_1402 :optional
+    .param int has_param_1402 :opt_flag
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 665
+    .const 'Sub' $P1404 = "62_1792415685.75359" 
+    capture_lex $P1404
+    new $P1399, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1399, control_1398
+    push_eh $P1399
+    .lex "self", self
+    .lex "$node", param_1400
+    .lex "%c", param_1401
+    if has_param_1402, optparam_241
+    new $P104, "Undef"
+    set param_1402, $P104
+  optparam_241:
+    .lex "$joiner", param_1402
+.annotate 'line', 666
+    find_lex $P105, "$node"
+    $P106 = $P105."list"()
+    .const 'Sub' $P1404 = "62_1792415685.75359" 
+    newclosure $P1406, $P1404
+    $P107 = $P106."map"($P1406)
+    find_lex $P108, "$joiner"
+    set $P1407, $P108
+    defined $I1409, $P1407
+    if $I1409, default_1408
+    new $P109, "String"
+    assign $P109, ""
+    set $P1407, $P109
+  default_1408:
+    $P111 = $P107."join"($P1407)
+.annotate 'line', 665
+    .return ($P111)
+  control_1398:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P105, exception, "payload"
+    .return ($P105)
+.end
+
+
+.namespace ["Ops";"Op"]
+.sub "_block1403"  :anon :subid("62_1792415685.75359") :outer("61_1792415685.75359")
+    .param pmc param_1405
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 666
+    .lex "$_", param_1405
+    find_lex $P107, "self"
+    find_lex $P108, "$_"
+    find_lex $P109, "%c"
+    $P110 = $P107."to_c"($P108, $P109)
+    .return ($P110)
+.end
+
+
+.namespace ["Ops";"Op"]
+.include "except_types.pasm"
+.sub "indent"  :subid("63_1792415685.75359") :outer("11_1792415685.75359") :multi(_,_)
+    .param pmc param_1413
+    .param pmc param_1414
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 669
+    new $P1412, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1412, control_1411
+    push_eh $P1412
+    .lex "$chunk", param_1413
+    .lex "%c", param_1414
+.annotate 'line', 670
+    find_lex $P1415, "%c"
+    unless_null $P1415, vivify_242
+    $P1415 = root_new ['parrot';'Hash']
+  vivify_242:
+    set $P104, $P1415["level"]
+    unless_null $P104, vivify_243
+    new $P104, "Undef"
+  vivify_243:
+    mul $P105, $P104, 4
+    find_lex $P1417, "$chunk"
+    unless_null $P1417, vivify_244
+    $P1417 = root_new ['parrot';'Hash']
+  vivify_244:
+    set $P106, $P1417["label"]
+    unless_null $P106, vivify_245
+    new $P106, "Undef"
+  vivify_245:
+    if $P106, if_1416
+    set $N100, 0
+    goto if_1416_end
+  if_1416:
+    set $N100, 2
+  if_1416_end:
+    sub $P107, $P105, $N100
+    set $I100, $P107
+    repeat $S100, " ", $I100
+.annotate 'line', 669
+    .return ($S100)
+  control_1411:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P104, exception, "payload"
+    .return ($P104)
+.end
+
+
+.namespace ["Ops";"Op"]
+.include "except_types.pasm"
+.sub "indent"  :subid("64_1792415685.75359") :outer("11_1792415685.75359") :multi(_)
+    .param pmc param_1421
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 673
+    new $P1420, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1420, control_1419
+    push_eh $P1420
+    .lex "%c", param_1421
+.annotate 'line', 674
+    find_lex $P1422, "%c"
+    unless_null $P1422, vivify_246
+    $P1422 = root_new ['parrot';'Hash']
+  vivify_246:
+    set $P104, $P1422["level"]
+    unless_null $P104, vivify_247
+    new $P104, "Undef"
+  vivify_247:
+    mul $P105, $P104, 4
+    set $I100, $P105
+    repeat $S100, " ", $I100
+.annotate 'line', 673
+    .return ($S100)
+  control_1419:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P104, exception, "payload"
+    .return ($P104)
+.end
+
+
+.namespace ["Ops";"Op"]
+.sub "_block1423" :load :anon :subid("65_1792415685.75359")
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 68
+    .const '' $P1425 = "11_1792415685.75359" 
+    $P105 = $P1425()
+    .return ($P105)
+.end
+
+
+.namespace []
+.sub "_block1426" :load :anon :subid("66_1792415685.75359")
+.annotate 'file', "compilers/opsc/src/Ops/Op.pm"
+.annotate 'line', 1
+    .const '' $P1428 = "10_1792415685.75359" 
+    $P100 = $P1428()
+    .return ($P100)
+.end
+
@@ -0,0 +1,760 @@
+
+.namespace []
+.sub "_block1000"  :anon :subid("10_1792415672.95368")
+.annotate 'file', "compilers/opsc/src/Ops/OpLib.pm"
+.annotate 'line', 0
+    .const 'Sub' $P1003 = "11_1792415672.95368" 
+    capture_lex $P1003
+.annotate 'line', 1
+    $P0 = find_dynamic_lex "$*CTXSAVE"
+    if null $P0 goto ctxsave_done
+    $I0 = can $P0, "ctxsave"
+    unless $I0 goto ctxsave_done
+    $P0."ctxsave"()
+  ctxsave_done:
+.annotate 'line', 67
+    .const 'Sub' $P1003 = "11_1792415672.95368" 
+    capture_lex $P1003
+    $P101 = $P1003()
+.annotate 'line', 1
+    .return ($P101)
+    .const 'Sub' $P1066 = "26_1792415672.95368" 
+    .return ($P1066)
+.end
+
+
+.namespace []
+.sub "" :load :init :subid("post27") :outer("10_1792415672.95368")
+.annotate 'file', "compilers/opsc/src/Ops/OpLib.pm"
+.annotate 'line', 0
+    .const 'Sub' $P1001 = "10_1792415672.95368" 
+    .local pmc block
+    set block, $P1001
+.annotate 'line', 5
+    load_bytecode "dumper.pbc"
+.annotate 'line', 4
+    $P1068 = get_root_global ["parrot"], "P6metaclass"
+    $P1068."new_class"("Ops::OpLib", "Hash" :named("parent"))
+.end
+
+
+.namespace ["Ops";"OpLib"]
+.sub "_block1002"  :subid("11_1792415672.95368") :outer("10_1792415672.95368")
+.annotate 'file', "compilers/opsc/src/Ops/OpLib.pm"
+.annotate 'line', 67
+    .const 'Sub' $P1057 = "24_1792415672.95368" 
+    capture_lex $P1057
+    .const 'Sub' $P1020 = "14_1792415672.95368" 
+    capture_lex $P1020
+    .const 'Sub' $P1017 = "13_1792415672.95368" 
+    capture_lex $P1017
+    .const 'Sub' $P1004 = "12_1792415672.95368" 
+    capture_lex $P1004
+    $P0 = find_dynamic_lex "$*CTXSAVE"
+    if null $P0 goto ctxsave_done
+    $I0 = can $P0, "ctxsave"
+    unless $I0 goto ctxsave_done
+    $P0."ctxsave"()
+  ctxsave_done:
+.annotate 'line', 125
+    .const 'Sub' $P1057 = "24_1792415672.95368" 
+    newclosure $P1061, $P1057
+.annotate 'line', 67
+    .return ($P1061)
+    .const 'Sub' $P1063 = "25_1792415672.95368" 
+    .return ($P1063)
+.end
+
+
+.namespace ["Ops";"OpLib"]
+.include "except_types.pasm"
+.sub "new"  :subid("12_1792415672.95368") :method :outer("11_1792415672.95368")
+    .param pmc param_1007 :optional :named("skip_file")
+    .param int has_param_1007 :opt_flag
+    .param pmc param_1008 :optional :named("quiet")
+    .param int has_param_1008 :opt_flag
+.annotate 'file', "compilers/opsc/src/Ops/OpLib.pm"
+.annotate 'line', 67
+    new $P1006, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1006, control_1005
+    push_eh $P1006
+    .lex "self", self
+    if has_param_1007, optparam_28
+    new $P100, "Undef"
+    set param_1007, $P100
+  optparam_28:
+    .lex "$skip_file", param_1007
+    if has_param_1008, optparam_29
+    new $P101, "Integer"
+    assign $P101, 0
+    set param_1008, $P101
+  optparam_29:
+    .lex "$quiet", param_1008
+.annotate 'line', 68
+    find_lex $P102, "$skip_file"
+    set $P1009, $P102
+    defined $I1011, $P1009
+    if $I1011, default_1010
+    new $P103, "String"
+    assign $P103, "./src/ops/ops.skip"
+    set $P1009, $P103
+  default_1010:
+    find_lex $P1012, "self"
+    unless_null $P1012, vivify_30
+    $P1012 = root_new ['parrot';'Hash']
+    store_lex "self", $P1012
+  vivify_30:
+    set $P1012["skip_file"], $P1009
+.annotate 'line', 69
+    find_lex $P102, "$quiet"
+    find_lex $P1013, "self"
+    unless_null $P1013, vivify_31
+    $P1013 = root_new ['parrot';'Hash']
+    store_lex "self", $P1013
+  vivify_31:
+    set $P1013["quiet"], $P102
+.annotate 'line', 72
+    $P102 = "hash"()
+    find_lex $P1014, "self"
+    unless_null $P1014, vivify_32
+    $P1014 = root_new ['parrot';'Hash']
+    store_lex "self", $P1014
+  vivify_32:
+    set $P1014["op_skip_table"], $P102
+.annotate 'line', 73
+    $P102 = "list"()
+    find_lex $P1015, "self"
+    unless_null $P1015, vivify_33
+    $P1015 = root_new ['parrot';'Hash']
+    store_lex "self", $P1015
+  vivify_33:
+    set $P1015["ops_past"], $P102
+.annotate 'line', 74
+    new $P102, "Integer"
+    assign $P102, 0
+    find_lex $P1016, "self"
+    unless_null $P1016, vivify_34
+    $P1016 = root_new ['parrot';'Hash']
+    store_lex "self", $P1016
+  vivify_34:
+    set $P1016["regen_ops_num"], $P102
+.annotate 'line', 76
+    find_lex $P102, "self"
+    $P102."load_op_map_files"()
+.annotate 'line', 67
+    find_lex $P102, "self"
+    .return ($P102)
+  control_1005:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P103, exception, "payload"
+    .return ($P103)
+.end
+
+
+.namespace ["Ops";"OpLib"]
+.include "except_types.pasm"
+.sub "load_op_map_files"  :subid("13_1792415672.95368") :method :outer("11_1792415672.95368")
+.annotate 'file', "compilers/opsc/src/Ops/OpLib.pm"
+.annotate 'line', 89
+    new $P1019, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1019, control_1018
+    push_eh $P1019
+    .lex "self", self
+.annotate 'line', 90
+    find_lex $P100, "self"
+    $P101 = $P100."_load_skip_file"()
+.annotate 'line', 89
+    .return ($P101)
+  control_1018:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P100, exception, "payload"
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"OpLib"]
+.include "except_types.pasm"
+.sub "_load_skip_file"  :subid("14_1792415672.95368") :method :outer("11_1792415672.95368")
+.annotate 'file', "compilers/opsc/src/Ops/OpLib.pm"
+.annotate 'line', 93
+    .const 'Sub' $P1050 = "23_1792415672.95368" 
+    capture_lex $P1050
+    .const 'Sub' $P1027 = "15_1792415672.95368" 
+    capture_lex $P1027
+    new $P1022, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1022, control_1021
+    push_eh $P1022
+    .lex "self", self
+.annotate 'line', 94
+    new $P100, "Undef"
+    set $P1023, $P100
+    .lex "$buf", $P1023
+.annotate 'line', 107
+    new $P101, "Undef"
+    set $P1024, $P101
+    .lex "$lines", $P1024
+.annotate 'line', 94
+    find_lex $P1025, "self"
+    unless_null $P1025, vivify_36
+    $P1025 = root_new ['parrot';'Hash']
+  vivify_36:
+    set $P102, $P1025["skip_file"]
+    unless_null $P102, vivify_37
+    new $P102, "Undef"
+  vivify_37:
+    $P103 = "slurp"($P102)
+    store_lex "$buf", $P103
+.annotate 'line', 95
+    .const 'Sub' $P1027 = "15_1792415672.95368" 
+    capture_lex $P1027
+    $P1027()
+.annotate 'line', 107
+    get_hll_global $P102, "SKIP"
+    find_lex $P103, "$buf"
+    $P104 = $P102."parse"($P103)
+    store_lex "$lines", $P104
+.annotate 'line', 109
+    find_lex $P1048, "$lines"
+    unless_null $P1048, vivify_54
+    $P1048 = root_new ['parrot';'Hash']
+  vivify_54:
+    set $P103, $P1048["op"]
+    unless_null $P103, vivify_55
+    new $P103, "Undef"
+  vivify_55:
+    defined $I100, $P103
+    unless $I100, for_undef_56
+    iter $P102, $P103
+    new $P106, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P106, loop1055_handler
+    push_eh $P106
+  loop1055_test:
+    unless $P102, loop1055_done
+    shift $P104, $P102
+  loop1055_redo:
+    .const 'Sub' $P1050 = "23_1792415672.95368" 
+    capture_lex $P1050
+    $P1050($P104)
+  loop1055_next:
+    goto loop1055_test
+  loop1055_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P107, exception, 'type'
+    eq $P107, .CONTROL_LOOP_NEXT, loop1055_next
+    eq $P107, .CONTROL_LOOP_REDO, loop1055_redo
+  loop1055_done:
+    pop_eh 
+  for_undef_56:
+.annotate 'line', 93
+    .return ($P102)
+  control_1021:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P103, exception, "payload"
+    .return ($P103)
+.end
+
+
+.namespace ["Ops";"OpLib"]
+.sub "" :load :init :subid("post35") :outer("14_1792415672.95368")
+.annotate 'file', "compilers/opsc/src/Ops/OpLib.pm"
+.annotate 'line', 93
+    .const 'Sub' $P1020 = "14_1792415672.95368" 
+    .local pmc block
+    set block, $P1020
+    $P1056 = get_root_global ["parrot"], "P6metaclass"
+    $P1056."new_class"("SKIP", "Regex::Cursor" :named("parent"))
+.end
+
+
+.namespace ["SKIP"]
+.sub "_block1026"  :subid("15_1792415672.95368") :outer("14_1792415672.95368")
+.annotate 'file', "compilers/opsc/src/Ops/OpLib.pm"
+.annotate 'line', 95
+    .const 'Sub' $P1042 = "21_1792415672.95368" 
+    capture_lex $P1042
+    .const 'Sub' $P1034 = "18_1792415672.95368" 
+    capture_lex $P1034
+    .const 'Sub' $P1028 = "16_1792415672.95368" 
+    capture_lex $P1028
+    .const 'Sub' $P1042 = "21_1792415672.95368" 
+    capture_lex $P1042
+    .return ($P1042)
+.end
+
+
+.namespace ["SKIP"]
+.sub "TOP"  :subid("16_1792415672.95368") :method :outer("15_1792415672.95368")
+.annotate 'file', "compilers/opsc/src/Ops/OpLib.pm"
+.annotate 'line', 95
+    .local string rx1029_tgt
+    .local int rx1029_pos
+    .local int rx1029_off
+    .local int rx1029_eos
+    .local int rx1029_rep
+    .local pmc rx1029_cur
+    .local pmc rx1029_debug
+    (rx1029_cur, rx1029_pos, rx1029_tgt, $I10) = self."!cursor_start"()
+    rx1029_cur."!cursor_caparray"("op")
+    getattribute rx1029_debug, rx1029_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1029_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1029_eos, rx1029_tgt
+    gt rx1029_pos, rx1029_eos, rx1029_done
+    set rx1029_off, 0
+    lt rx1029_pos, 2, rx1029_start
+    sub rx1029_off, rx1029_pos, 1
+    substr rx1029_tgt, rx1029_tgt, rx1029_off
+  rx1029_start:
+    eq $I10, 1, rx1029_restart
+    if_null rx1029_debug, debug_38
+    rx1029_cur."!cursor_debug"("START", "TOP")
+  debug_38:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1031_done
+    goto rxscan1031_scan
+  rxscan1031_loop:
+    ($P10) = rx1029_cur."from"()
+    inc $P10
+    set rx1029_pos, $P10
+    ge rx1029_pos, rx1029_eos, rxscan1031_done
+  rxscan1031_scan:
+    set_addr $I10, rxscan1031_loop
+    rx1029_cur."!mark_push"(0, rx1029_pos, $I10)
+  rxscan1031_done:
+.annotate 'line', 96
+  # rx subrule "ws" subtype=method negate=
+    rx1029_cur."!cursor_pos"(rx1029_pos)
+    $P10 = rx1029_cur."ws"()
+    unless $P10, rx1029_fail
+    rx1029_pos = $P10."pos"()
+  # rx rxquantr1032 ** 1..*
+    set_addr $I10, rxquantr1032_done
+    rx1029_cur."!mark_push"(0, -1, $I10)
+  rxquantr1032_loop:
+  # rx subrule "op" subtype=capture negate=
+    rx1029_cur."!cursor_pos"(rx1029_pos)
+    $P10 = rx1029_cur."op"()
+    unless $P10, rx1029_fail
+    goto rxsubrule1033_pass
+  rxsubrule1033_back:
+    $P10 = $P10."!cursor_next"()
+    unless $P10, rx1029_fail
+  rxsubrule1033_pass:
+    set_addr $I10, rxsubrule1033_back
+    rx1029_cur."!mark_push"(0, rx1029_pos, $I10, $P10)
+    $P10."!cursor_names"("op")
+    rx1029_pos = $P10."pos"()
+    set_addr $I10, rxquantr1032_done
+    (rx1029_rep) = rx1029_cur."!mark_commit"($I10)
+    set_addr $I10, rxquantr1032_done
+    rx1029_cur."!mark_push"(rx1029_rep, rx1029_pos, $I10)
+    goto rxquantr1032_loop
+  rxquantr1032_done:
+  # rx subrule "ws" subtype=method negate=
+    rx1029_cur."!cursor_pos"(rx1029_pos)
+    $P10 = rx1029_cur."ws"()
+    unless $P10, rx1029_fail
+    rx1029_pos = $P10."pos"()
+  # rx pass
+    rx1029_cur."!cursor_pass"(rx1029_pos, "TOP")
+    if_null rx1029_debug, debug_39
+    rx1029_cur."!cursor_debug"("PASS", "TOP", " at pos=", rx1029_pos)
+  debug_39:
+    .return (rx1029_cur)
+  rx1029_restart:
+.annotate 'line', 95
+    if_null rx1029_debug, debug_40
+    rx1029_cur."!cursor_debug"("NEXT", "TOP")
+  debug_40:
+  rx1029_fail:
+    (rx1029_rep, rx1029_pos, $I10, $P10) = rx1029_cur."!mark_fail"(0)
+    lt rx1029_pos, -1, rx1029_done
+    eq rx1029_pos, -1, rx1029_fail
+    jump $I10
+  rx1029_done:
+    rx1029_cur."!cursor_fail"()
+    if_null rx1029_debug, debug_41
+    rx1029_cur."!cursor_debug"("FAIL", "TOP")
+  debug_41:
+    .return (rx1029_cur)
+    .return ()
+.end
+
+
+.namespace ["SKIP"]
+.sub "!PREFIX__TOP"  :subid("17_1792415672.95368") :method
+.annotate 'file', "compilers/opsc/src/Ops/OpLib.pm"
+.annotate 'line', 95
+    $P102 = self."!PREFIX__!subrule"("ws", "")
+    new $P103, "ResizablePMCArray"
+    push $P103, $P102
+    .return ($P103)
+.end
+
+
+.namespace ["SKIP"]
+.sub "op"  :subid("18_1792415672.95368") :method :outer("15_1792415672.95368")
+.annotate 'file', "compilers/opsc/src/Ops/OpLib.pm"
+.annotate 'line', 95
+    .const 'Sub' $P1039 = "20_1792415672.95368" 
+    capture_lex $P1039
+    .local string rx1035_tgt
+    .local int rx1035_pos
+    .local int rx1035_off
+    .local int rx1035_eos
+    .local int rx1035_rep
+    .local pmc rx1035_cur
+    .local pmc rx1035_debug
+    (rx1035_cur, rx1035_pos, rx1035_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1035_debug, rx1035_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1035_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1035_eos, rx1035_tgt
+    gt rx1035_pos, rx1035_eos, rx1035_done
+    set rx1035_off, 0
+    lt rx1035_pos, 2, rx1035_start
+    sub rx1035_off, rx1035_pos, 1
+    substr rx1035_tgt, rx1035_tgt, rx1035_off
+  rx1035_start:
+    eq $I10, 1, rx1035_restart
+    if_null rx1035_debug, debug_42
+    rx1035_cur."!cursor_debug"("START", "op")
+  debug_42:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1037_done
+    goto rxscan1037_scan
+  rxscan1037_loop:
+    ($P10) = rx1035_cur."from"()
+    inc $P10
+    set rx1035_pos, $P10
+    ge rx1035_pos, rx1035_eos, rxscan1037_done
+  rxscan1037_scan:
+    set_addr $I10, rxscan1037_loop
+    rx1035_cur."!mark_push"(0, rx1035_pos, $I10)
+  rxscan1037_done:
+.annotate 'line', 98
+  # rx subrule "ws" subtype=method negate=
+    rx1035_cur."!cursor_pos"(rx1035_pos)
+    $P10 = rx1035_cur."ws"()
+    unless $P10, rx1035_fail
+    rx1035_pos = $P10."pos"()
+  # rx subrule $P1039 subtype=capture negate=
+    rx1035_cur."!cursor_pos"(rx1035_pos)
+    .const 'Sub' $P1039 = "20_1792415672.95368" 
+    capture_lex $P1039
+    $P10 = rx1035_cur.$P1039()
+    unless $P10, rx1035_fail
+    rx1035_cur."!mark_push"(0, -1, 0, $P10)
+    $P10."!cursor_names"("name")
+    rx1035_pos = $P10."pos"()
+  # rx subrule "ws" subtype=method negate=
+    rx1035_cur."!cursor_pos"(rx1035_pos)
+    $P10 = rx1035_cur."ws"()
+    unless $P10, rx1035_fail
+    rx1035_pos = $P10."pos"()
+  # rx pass
+    rx1035_cur."!cursor_pass"(rx1035_pos, "op")
+    if_null rx1035_debug, debug_47
+    rx1035_cur."!cursor_debug"("PASS", "op", " at pos=", rx1035_pos)
+  debug_47:
+    .return (rx1035_cur)
+  rx1035_restart:
+.annotate 'line', 95
+    if_null rx1035_debug, debug_48
+    rx1035_cur."!cursor_debug"("NEXT", "op")
+  debug_48:
+  rx1035_fail:
+    (rx1035_rep, rx1035_pos, $I10, $P10) = rx1035_cur."!mark_fail"(0)
+    lt rx1035_pos, -1, rx1035_done
+    eq rx1035_pos, -1, rx1035_fail
+    jump $I10
+  rx1035_done:
+    rx1035_cur."!cursor_fail"()
+    if_null rx1035_debug, debug_49
+    rx1035_cur."!cursor_debug"("FAIL", "op")
+  debug_49:
+    .return (rx1035_cur)
+    .return ()
+.end
+
+
+.namespace ["SKIP"]
+.sub "!PREFIX__op"  :subid("19_1792415672.95368") :method
+.annotate 'file', "compilers/opsc/src/Ops/OpLib.pm"
+.annotate 'line', 95
+    $P102 = self."!PREFIX__!subrule"("ws", "")
+    new $P103, "ResizablePMCArray"
+    push $P103, $P102
+    .return ($P103)
+.end
+
+
+.namespace ["SKIP"]
+.sub "_block1038"  :anon :subid("20_1792415672.95368") :method :outer("18_1792415672.95368")
+.annotate 'file', "compilers/opsc/src/Ops/OpLib.pm"
+.annotate 'line', 98
+    .local string rx1040_tgt
+    .local int rx1040_pos
+    .local int rx1040_off
+    .local int rx1040_eos
+    .local int rx1040_rep
+    .local pmc rx1040_cur
+    .local pmc rx1040_debug
+    (rx1040_cur, rx1040_pos, rx1040_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1040_debug, rx1040_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1040_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1040_eos, rx1040_tgt
+    gt rx1040_pos, rx1040_eos, rx1040_done
+    set rx1040_off, 0
+    lt rx1040_pos, 2, rx1040_start
+    sub rx1040_off, rx1040_pos, 1
+    substr rx1040_tgt, rx1040_tgt, rx1040_off
+  rx1040_start:
+    eq $I10, 1, rx1040_restart
+    if_null rx1040_debug, debug_43
+    rx1040_cur."!cursor_debug"("START", "")
+  debug_43:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1041_done
+    goto rxscan1041_scan
+  rxscan1041_loop:
+    ($P10) = rx1040_cur."from"()
+    inc $P10
+    set rx1040_pos, $P10
+    ge rx1040_pos, rx1040_eos, rxscan1041_done
+  rxscan1041_scan:
+    set_addr $I10, rxscan1041_loop
+    rx1040_cur."!mark_push"(0, rx1040_pos, $I10)
+  rxscan1041_done:
+  # rx charclass_q w r 1..-1
+    sub $I10, rx1040_pos, rx1040_off
+    find_not_cclass $I11, 8192, rx1040_tgt, $I10, rx1040_eos
+    add $I12, $I10, 1
+    lt $I11, $I12, rx1040_fail
+    add rx1040_pos, rx1040_off, $I11
+  # rx pass
+    rx1040_cur."!cursor_pass"(rx1040_pos, "")
+    if_null rx1040_debug, debug_44
+    rx1040_cur."!cursor_debug"("PASS", "", " at pos=", rx1040_pos)
+  debug_44:
+    .return (rx1040_cur)
+  rx1040_restart:
+    if_null rx1040_debug, debug_45
+    rx1040_cur."!cursor_debug"("NEXT", "")
+  debug_45:
+  rx1040_fail:
+    (rx1040_rep, rx1040_pos, $I10, $P10) = rx1040_cur."!mark_fail"(0)
+    lt rx1040_pos, -1, rx1040_done
+    eq rx1040_pos, -1, rx1040_fail
+    jump $I10
+  rx1040_done:
+    rx1040_cur."!cursor_fail"()
+    if_null rx1040_debug, debug_46
+    rx1040_cur."!cursor_debug"("FAIL", "")
+  debug_46:
+    .return (rx1040_cur)
+    .return ()
+.end
+
+
+.namespace ["SKIP"]
+.sub "ws"  :subid("21_1792415672.95368") :method :outer("15_1792415672.95368")
+.annotate 'file', "compilers/opsc/src/Ops/OpLib.pm"
+.annotate 'line', 95
+    .local string rx1043_tgt
+    .local int rx1043_pos
+    .local int rx1043_off
+    .local int rx1043_eos
+    .local int rx1043_rep
+    .local pmc rx1043_cur
+    .local pmc rx1043_debug
+    (rx1043_cur, rx1043_pos, rx1043_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1043_debug, rx1043_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1043_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1043_eos, rx1043_tgt
+    gt rx1043_pos, rx1043_eos, rx1043_done
+    set rx1043_off, 0
+    lt rx1043_pos, 2, rx1043_start
+    sub rx1043_off, rx1043_pos, 1
+    substr rx1043_tgt, rx1043_tgt, rx1043_off
+  rx1043_start:
+    eq $I10, 1, rx1043_restart
+    if_null rx1043_debug, debug_50
+    rx1043_cur."!cursor_debug"("START", "ws")
+  debug_50:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1045_done
+    goto rxscan1045_scan
+  rxscan1045_loop:
+    ($P10) = rx1043_cur."from"()
+    inc $P10
+    set rx1043_pos, $P10
+    ge rx1043_pos, rx1043_eos, rxscan1045_done
+  rxscan1045_scan:
+    set_addr $I10, rxscan1045_loop
+    rx1043_cur."!mark_push"(0, rx1043_pos, $I10)
+  rxscan1045_done:
+.annotate 'line', 103
+  # rx rxquantr1046 ** 0..*
+    set_addr $I10, rxquantr1046_done
+    rx1043_cur."!mark_push"(0, rx1043_pos, $I10)
+  rxquantr1046_loop:
+  alt1047_0:
+.annotate 'line', 100
+    set_addr $I10, alt1047_1
+    rx1043_cur."!mark_push"(0, rx1043_pos, $I10)
+.annotate 'line', 101
+  # rx charclass_q s r 1..-1
+    sub $I10, rx1043_pos, rx1043_off
+    find_not_cclass $I11, 32, rx1043_tgt, $I10, rx1043_eos
+    add $I12, $I10, 1
+    lt $I11, $I12, rx1043_fail
+    add rx1043_pos, rx1043_off, $I11
+    goto alt1047_end
+  alt1047_1:
+.annotate 'line', 102
+  # rx literal  "#"
+    add $I11, rx1043_pos, 1
+    gt $I11, rx1043_eos, rx1043_fail
+    sub $I11, rx1043_pos, rx1043_off
+    ord $I11, rx1043_tgt, $I11
+    ne $I11, 35, rx1043_fail
+    add rx1043_pos, 1
+  # rx charclass_q N r 0..-1
+    sub $I10, rx1043_pos, rx1043_off
+    find_cclass $I11, 4096, rx1043_tgt, $I10, rx1043_eos
+    add rx1043_pos, rx1043_off, $I11
+  alt1047_end:
+.annotate 'line', 103
+    set_addr $I10, rxquantr1046_done
+    (rx1043_rep) = rx1043_cur."!mark_commit"($I10)
+    set_addr $I10, rxquantr1046_done
+    rx1043_cur."!mark_push"(rx1043_rep, rx1043_pos, $I10)
+    goto rxquantr1046_loop
+  rxquantr1046_done:
+.annotate 'line', 99
+  # rx pass
+    rx1043_cur."!cursor_pass"(rx1043_pos, "ws")
+    if_null rx1043_debug, debug_51
+    rx1043_cur."!cursor_debug"("PASS", "ws", " at pos=", rx1043_pos)
+  debug_51:
+    .return (rx1043_cur)
+  rx1043_restart:
+.annotate 'line', 95
+    if_null rx1043_debug, debug_52
+    rx1043_cur."!cursor_debug"("NEXT", "ws")
+  debug_52:
+  rx1043_fail:
+    (rx1043_rep, rx1043_pos, $I10, $P10) = rx1043_cur."!mark_fail"(0)
+    lt rx1043_pos, -1, rx1043_done
+    eq rx1043_pos, -1, rx1043_fail
+    jump $I10
+  rx1043_done:
+    rx1043_cur."!cursor_fail"()
+    if_null rx1043_debug, debug_53
+    rx1043_cur."!cursor_debug"("FAIL", "ws")
+  debug_53:
+    .return (rx1043_cur)
+    .return ()
+.end
+
+
+.namespace ["SKIP"]
+.sub "!PREFIX__ws"  :subid("22_1792415672.95368") :method
+.annotate 'file', "compilers/opsc/src/Ops/OpLib.pm"
+.annotate 'line', 95
+    new $P102, "ResizablePMCArray"
+    push $P102, ""
+    .return ($P102)
+.end
+
+
+.namespace ["Ops";"OpLib"]
+.sub "_block1049"  :anon :subid("23_1792415672.95368") :outer("14_1792415672.95368")
+    .param pmc param_1051
+.annotate 'file', "compilers/opsc/src/Ops/OpLib.pm"
+.annotate 'line', 109
+    .lex "$_", param_1051
+.annotate 'line', 110
+    new $P105, "Integer"
+    assign $P105, 1
+    find_lex $P1052, "$_"
+    unless_null $P1052, vivify_57
+    $P1052 = root_new ['parrot';'Hash']
+  vivify_57:
+    set $P106, $P1052["name"]
+    unless_null $P106, vivify_58
+    new $P106, "Undef"
+  vivify_58:
+    find_lex $P1053, "self"
+    unless_null $P1053, vivify_59
+    $P1053 = root_new ['parrot';'Hash']
+    store_lex "self", $P1053
+  vivify_59:
+    set $P1054, $P1053["op_skip_table"]
+    unless_null $P1054, vivify_60
+    $P1054 = root_new ['parrot';'Hash']
+    set $P1053["op_skip_table"], $P1054
+  vivify_60:
+    set $P1054[$P106], $P105
+.annotate 'line', 109
+    .return ($P105)
+.end
+
+
+.namespace ["Ops";"OpLib"]
+.include "except_types.pasm"
+.sub "op_skip_table"  :subid("24_1792415672.95368") :method :outer("11_1792415672.95368")
+.annotate 'file', "compilers/opsc/src/Ops/OpLib.pm"
+.annotate 'line', 125
+    new $P1059, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1059, control_1058
+    push_eh $P1059
+    .lex "self", self
+    find_lex $P1060, "self"
+    unless_null $P1060, vivify_61
+    $P1060 = root_new ['parrot';'Hash']
+  vivify_61:
+    set $P100, $P1060["op_skip_table"]
+    unless_null $P100, vivify_62
+    new $P100, "Undef"
+  vivify_62:
+    .return ($P100)
+  control_1058:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"OpLib"]
+.sub "_block1062" :load :anon :subid("25_1792415672.95368")
+.annotate 'file', "compilers/opsc/src/Ops/OpLib.pm"
+.annotate 'line', 67
+    .const '' $P1064 = "11_1792415672.95368" 
+    $P100 = $P1064()
+    .return ($P100)
+.end
+
+
+.namespace []
+.sub "_block1065" :load :anon :subid("26_1792415672.95368")
+.annotate 'file', "compilers/opsc/src/Ops/OpLib.pm"
+.annotate 'line', 1
+    .const '' $P1067 = "10_1792415672.95368" 
+    $P100 = $P1067()
+    .return ($P100)
+.end
+
@@ -0,0 +1,559 @@
+
+.namespace []
+.sub "_block1000"  :anon :subid("10_1792415672.71073")
+.annotate 'file', "compilers/opsc/src/Ops/Trans.pm"
+.annotate 'line', 0
+    .const 'Sub' $P1003 = "11_1792415672.71073" 
+    capture_lex $P1003
+.annotate 'line', 1
+    $P0 = find_dynamic_lex "$*CTXSAVE"
+    if null $P0 goto ctxsave_done
+    $I0 = can $P0, "ctxsave"
+    unless $I0 goto ctxsave_done
+    $P0."ctxsave"()
+  ctxsave_done:
+.annotate 'line', 12
+    .const 'Sub' $P1003 = "11_1792415672.71073" 
+    capture_lex $P1003
+    $P101 = $P1003()
+.annotate 'line', 1
+    .return ($P101)
+    .const 'Sub' $P1092 = "34_1792415672.71073" 
+    .return ($P1092)
+.end
+
+
+.namespace []
+.sub "" :load :init :subid("post35") :outer("10_1792415672.71073")
+.annotate 'file', "compilers/opsc/src/Ops/Trans.pm"
+.annotate 'line', 0
+    .const 'Sub' $P1001 = "10_1792415672.71073" 
+    .local pmc block
+    set block, $P1001
+    $P1094 = get_root_global ["parrot"], "P6metaclass"
+    $P1094."new_class"("Ops::Trans", "Hash" :named("parent"))
+.end
+
+
+.namespace ["Ops";"Trans"]
+.sub "_block1002"  :subid("11_1792415672.71073") :outer("10_1792415672.71073")
+.annotate 'file', "compilers/opsc/src/Ops/Trans.pm"
+.annotate 'line', 12
+    .const 'Sub' $P1083 = "32_1792415672.71073" 
+    capture_lex $P1083
+    .const 'Sub' $P1079 = "31_1792415672.71073" 
+    capture_lex $P1079
+    .const 'Sub' $P1075 = "30_1792415672.71073" 
+    capture_lex $P1075
+    .const 'Sub' $P1071 = "29_1792415672.71073" 
+    capture_lex $P1071
+    .const 'Sub' $P1067 = "28_1792415672.71073" 
+    capture_lex $P1067
+    .const 'Sub' $P1063 = "27_1792415672.71073" 
+    capture_lex $P1063
+    .const 'Sub' $P1058 = "26_1792415672.71073" 
+    capture_lex $P1058
+    .const 'Sub' $P1053 = "25_1792415672.71073" 
+    capture_lex $P1053
+    .const 'Sub' $P1049 = "24_1792415672.71073" 
+    capture_lex $P1049
+    .const 'Sub' $P1045 = "23_1792415672.71073" 
+    capture_lex $P1045
+    .const 'Sub' $P1042 = "22_1792415672.71073" 
+    capture_lex $P1042
+    .const 'Sub' $P1039 = "21_1792415672.71073" 
+    capture_lex $P1039
+    .const 'Sub' $P1035 = "20_1792415672.71073" 
+    capture_lex $P1035
+    .const 'Sub' $P1030 = "19_1792415672.71073" 
+    capture_lex $P1030
+    .const 'Sub' $P1026 = "18_1792415672.71073" 
+    capture_lex $P1026
+    .const 'Sub' $P1023 = "17_1792415672.71073" 
+    capture_lex $P1023
+    .const 'Sub' $P1019 = "16_1792415672.71073" 
+    capture_lex $P1019
+    .const 'Sub' $P1014 = "15_1792415672.71073" 
+    capture_lex $P1014
+    .const 'Sub' $P1011 = "14_1792415672.71073" 
+    capture_lex $P1011
+    .const 'Sub' $P1008 = "13_1792415672.71073" 
+    capture_lex $P1008
+    .const 'Sub' $P1005 = "12_1792415672.71073" 
+    capture_lex $P1005
+.annotate 'line', 44
+    get_global $P1004, "%arg_maps"
+    unless_null $P1004, vivify_36
+    $P1004 = root_new ['parrot';'Hash']
+    set_global "%arg_maps", $P1004
+  vivify_36:
+.annotate 'line', 12
+    $P0 = find_dynamic_lex "$*CTXSAVE"
+    if null $P0 goto ctxsave_done
+    $I0 = can $P0, "ctxsave"
+    unless $I0 goto ctxsave_done
+    $P0."ctxsave"()
+  ctxsave_done:
+.annotate 'line', 44
+    $P1057 = root_new ['parrot';'Hash']
+    set_global "%arg_maps", $P1057
+.annotate 'line', 55
+    .const 'Sub' $P1083 = "32_1792415672.71073" 
+    newclosure $P1087, $P1083
+.annotate 'line', 12
+    .return ($P1087)
+    .const 'Sub' $P1089 = "33_1792415672.71073" 
+    .return ($P1089)
+.end
+
+
+.namespace ["Ops";"Trans"]
+.include "except_types.pasm"
+.sub "prefix"  :subid("12_1792415672.71073") :method :outer("11_1792415672.71073")
+.annotate 'file', "compilers/opsc/src/Ops/Trans.pm"
+.annotate 'line', 12
+    new $P1007, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1007, control_1006
+    push_eh $P1007
+    .lex "self", self
+    .return ("Parrot_")
+  control_1006:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P100, exception, "payload"
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Trans"]
+.include "except_types.pasm"
+.sub "suffix"  :subid("13_1792415672.71073") :method :outer("11_1792415672.71073")
+.annotate 'file', "compilers/opsc/src/Ops/Trans.pm"
+.annotate 'line', 15
+    new $P1010, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1010, control_1009
+    push_eh $P1010
+    .lex "self", self
+    $P100 = "die"("...")
+    .return ($P100)
+  control_1009:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Trans"]
+.include "except_types.pasm"
+.sub "core_type"  :subid("14_1792415672.71073") :method :outer("11_1792415672.71073")
+.annotate 'file', "compilers/opsc/src/Ops/Trans.pm"
+.annotate 'line', 17
+    new $P1013, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1013, control_1012
+    push_eh $P1013
+    .lex "self", self
+    $P100 = "die"("...")
+    .return ($P100)
+  control_1012:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Trans"]
+.include "except_types.pasm"
+.sub "prepare_ops"  :subid("15_1792415672.71073") :method :outer("11_1792415672.71073")
+    .param pmc param_1017
+    .param pmc param_1018
+.annotate 'file', "compilers/opsc/src/Ops/Trans.pm"
+.annotate 'line', 20
+    new $P1016, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1016, control_1015
+    push_eh $P1016
+    .lex "self", self
+    .lex "$emitter", param_1017
+    .lex "$ops_file", param_1018
+    $P100 = "die"("...")
+    .return ($P100)
+  control_1015:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Trans"]
+.include "except_types.pasm"
+.sub "emit_c_op_funcs_header_part"  :subid("16_1792415672.71073") :method :outer("11_1792415672.71073")
+    .param pmc param_1022
+.annotate 'file', "compilers/opsc/src/Ops/Trans.pm"
+.annotate 'line', 23
+    new $P1021, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1021, control_1020
+    push_eh $P1021
+    .lex "self", self
+    .lex "$fh", param_1022
+    $P100 = "die"("...")
+    .return ($P100)
+  control_1020:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Trans"]
+.include "except_types.pasm"
+.sub "body_prelude"  :subid("17_1792415672.71073") :method :outer("11_1792415672.71073")
+.annotate 'file', "compilers/opsc/src/Ops/Trans.pm"
+.annotate 'line', 26
+    new $P1025, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1025, control_1024
+    push_eh $P1025
+    .lex "self", self
+    .return ("")
+  control_1024:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P100, exception, "payload"
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Trans"]
+.include "except_types.pasm"
+.sub "defines"  :subid("18_1792415672.71073") :method :outer("11_1792415672.71073")
+    .param pmc param_1029
+.annotate 'file', "compilers/opsc/src/Ops/Trans.pm"
+.annotate 'line', 28
+    new $P1028, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1028, control_1027
+    push_eh $P1028
+    .lex "self", self
+    .lex "$emitter", param_1029
+    $P100 = "die"("...")
+    .return ($P100)
+  control_1027:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Trans"]
+.include "except_types.pasm"
+.sub "emit_source_part"  :subid("19_1792415672.71073") :method :outer("11_1792415672.71073")
+    .param pmc param_1033
+    .param pmc param_1034
+.annotate 'file', "compilers/opsc/src/Ops/Trans.pm"
+.annotate 'line', 30
+    new $P1032, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1032, control_1031
+    push_eh $P1032
+    .lex "self", self
+    .lex "$emitter", param_1033
+    .lex "$fh", param_1034
+    $P100 = "die"("...")
+    .return ($P100)
+  control_1031:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Trans"]
+.include "except_types.pasm"
+.sub "emit_op_lookup"  :subid("20_1792415672.71073") :method :outer("11_1792415672.71073")
+    .param pmc param_1038
+.annotate 'file', "compilers/opsc/src/Ops/Trans.pm"
+.annotate 'line', 33
+    new $P1037, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1037, control_1036
+    push_eh $P1037
+    .lex "self", self
+    .lex "$fh", param_1038
+.annotate 'line', 34
+    find_lex $P100, "$fh"
+    $P101 = $P100."print"("static void hop_deinit(SHIM_INTERP) {}")
+.annotate 'line', 33
+    .return ($P101)
+  control_1036:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P100, exception, "payload"
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Trans"]
+.include "except_types.pasm"
+.sub "init_func_init1"  :subid("21_1792415672.71073") :method :outer("11_1792415672.71073")
+.annotate 'file', "compilers/opsc/src/Ops/Trans.pm"
+.annotate 'line', 37
+    new $P1041, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1041, control_1040
+    push_eh $P1041
+    .lex "self", self
+    .return ("")
+  control_1040:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P100, exception, "payload"
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Trans"]
+.include "except_types.pasm"
+.sub "init_func_disaptch"  :subid("22_1792415672.71073") :method :outer("11_1792415672.71073")
+.annotate 'file', "compilers/opsc/src/Ops/Trans.pm"
+.annotate 'line', 38
+    new $P1044, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1044, control_1043
+    push_eh $P1044
+    .lex "self", self
+    .return ("")
+  control_1043:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P100, exception, "payload"
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Trans"]
+.include "except_types.pasm"
+.sub "op_info"  :subid("23_1792415672.71073") :method :outer("11_1792415672.71073")
+    .param pmc param_1048
+.annotate 'file', "compilers/opsc/src/Ops/Trans.pm"
+.annotate 'line', 40
+    new $P1047, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1047, control_1046
+    push_eh $P1047
+    .lex "self", self
+    .lex "$emitter", param_1048
+    .return ("NULL")
+  control_1046:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P100, exception, "payload"
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Trans"]
+.include "except_types.pasm"
+.sub "op_func"  :subid("24_1792415672.71073") :method :outer("11_1792415672.71073")
+    .param pmc param_1052
+.annotate 'file', "compilers/opsc/src/Ops/Trans.pm"
+.annotate 'line', 41
+    new $P1051, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1051, control_1050
+    push_eh $P1051
+    .lex "self", self
+    .lex "$emitter", param_1052
+    .return ("NULL")
+  control_1050:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P100, exception, "payload"
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Trans"]
+.include "except_types.pasm"
+.sub "getop"  :subid("25_1792415672.71073") :method :outer("11_1792415672.71073")
+    .param pmc param_1056
+.annotate 'file', "compilers/opsc/src/Ops/Trans.pm"
+.annotate 'line', 42
+    new $P1055, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1055, control_1054
+    push_eh $P1055
+    .lex "self", self
+    .lex "$emitter", param_1056
+    .return ("( int (*)(PARROT_INTERP, const char *, int) )NULL")
+  control_1054:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P100, exception, "payload"
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Trans"]
+.include "except_types.pasm"
+.sub "access_arg"  :subid("26_1792415672.71073") :method :outer("11_1792415672.71073")
+    .param pmc param_1061
+    .param pmc param_1062
+.annotate 'file', "compilers/opsc/src/Ops/Trans.pm"
+.annotate 'line', 46
+    new $P1060, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1060, control_1059
+    push_eh $P1060
+    .lex "self", self
+    .lex "$type", param_1061
+    .lex "$num", param_1062
+    $P100 = "die"("...")
+    .return ($P100)
+  control_1059:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Trans"]
+.include "except_types.pasm"
+.sub "restart_address"  :subid("27_1792415672.71073") :method :outer("11_1792415672.71073")
+    .param pmc param_1066
+.annotate 'file', "compilers/opsc/src/Ops/Trans.pm"
+.annotate 'line', 48
+    new $P1065, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1065, control_1064
+    push_eh $P1065
+    .lex "self", self
+    .lex "$addr", param_1066
+    $P100 = "die"("...")
+    .return ($P100)
+  control_1064:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Trans"]
+.include "except_types.pasm"
+.sub "restart_offset"  :subid("28_1792415672.71073") :method :outer("11_1792415672.71073")
+    .param pmc param_1070
+.annotate 'file', "compilers/opsc/src/Ops/Trans.pm"
+.annotate 'line', 49
+    new $P1069, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1069, control_1068
+    push_eh $P1069
+    .lex "self", self
+    .lex "$offset", param_1070
+    $P100 = "die"("...")
+    .return ($P100)
+  control_1068:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Trans"]
+.include "except_types.pasm"
+.sub "goto_address"  :subid("29_1792415672.71073") :method :outer("11_1792415672.71073")
+    .param pmc param_1074
+.annotate 'file', "compilers/opsc/src/Ops/Trans.pm"
+.annotate 'line', 51
+    new $P1073, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1073, control_1072
+    push_eh $P1073
+    .lex "self", self
+    .lex "$addr", param_1074
+    $P100 = "die"("...")
+    .return ($P100)
+  control_1072:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Trans"]
+.include "except_types.pasm"
+.sub "goto_offset"  :subid("30_1792415672.71073") :method :outer("11_1792415672.71073")
+    .param pmc param_1078
+.annotate 'file', "compilers/opsc/src/Ops/Trans.pm"
+.annotate 'line', 52
+    new $P1077, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1077, control_1076
+    push_eh $P1077
+    .lex "self", self
+    .lex "$offset", param_1078
+    $P100 = "die"("...")
+    .return ($P100)
+  control_1076:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Trans"]
+.include "except_types.pasm"
+.sub "expr_address"  :subid("31_1792415672.71073") :method :outer("11_1792415672.71073")
+    .param pmc param_1082
+.annotate 'file', "compilers/opsc/src/Ops/Trans.pm"
+.annotate 'line', 54
+    new $P1081, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1081, control_1080
+    push_eh $P1081
+    .lex "self", self
+    .lex "$addr", param_1082
+    $P100 = "die"("...")
+    .return ($P100)
+  control_1080:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Trans"]
+.include "except_types.pasm"
+.sub "expr_offset"  :subid("32_1792415672.71073") :method :outer("11_1792415672.71073")
+    .param pmc param_1086
+.annotate 'file', "compilers/opsc/src/Ops/Trans.pm"
+.annotate 'line', 55
+    new $P1085, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1085, control_1084
+    push_eh $P1085
+    .lex "self", self
+    .lex "$offset", param_1086
+    $P100 = "die"("...")
+    .return ($P100)
+  control_1084:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Trans"]
+.sub "_block1088" :load :anon :subid("33_1792415672.71073")
+.annotate 'file', "compilers/opsc/src/Ops/Trans.pm"
+.annotate 'line', 12
+    .const '' $P1090 = "11_1792415672.71073" 
+    $P100 = $P1090()
+    .return ($P100)
+.end
+
+
+.namespace []
+.sub "_block1091" :load :anon :subid("34_1792415672.71073")
+.annotate 'file', "compilers/opsc/src/Ops/Trans.pm"
+.annotate 'line', 1
+    .const '' $P1093 = "10_1792415672.71073" 
+    $P100 = $P1093()
+    .return ($P100)
+.end
+
@@ -0,0 +1,1703 @@
+
+.namespace []
+.sub "_block1000"  :anon :subid("10_1792415680.1021")
+.annotate 'file', "compilers/opsc/src/Ops/Trans/C.pm"
+.annotate 'line', 0
+    .const 'Sub' $P1003 = "11_1792415680.1021" 
+    capture_lex $P1003
+.annotate 'line', 1
+    $P0 = find_dynamic_lex "$*CTXSAVE"
+    if null $P0 goto ctxsave_done
+    $I0 = can $P0, "ctxsave"
+    unless $I0 goto ctxsave_done
+    $P0."ctxsave"()
+  ctxsave_done:
+.annotate 'line', 6
+    .const 'Sub' $P1003 = "11_1792415680.1021" 
+    capture_lex $P1003
+    $P101 = $P1003()
+.annotate 'line', 1
+    .return ($P101)
+    .const 'Sub' $P1206 = "45_1792415680.1021" 
+    .return ($P1206)
+.end
+
+
+.namespace []
+.sub "" :load :init :subid("post46") :outer("10_1792415680.1021")
+.annotate 'file', "compilers/opsc/src/Ops/Trans/C.pm"
+.annotate 'line', 0
+    .const 'Sub' $P1001 = "10_1792415680.1021" 
+    .local pmc block
+    set block, $P1001
+    $P1208 = get_root_global ["parrot"], "P6metaclass"
+    $P1208."new_class"("Ops::Trans::C", "Ops::Trans" :named("parent"))
+.end
+
+
+.namespace ["Ops";"Trans";"C"]
+.sub "_block1002"  :subid("11_1792415680.1021") :outer("10_1792415680.1021")
+.annotate 'file', "compilers/opsc/src/Ops/Trans/C.pm"
+.annotate 'line', 6
+    .const 'Sub' $P1189 = "42_1792415680.1021" 
+    capture_lex $P1189
+    .const 'Sub' $P1179 = "40_1792415680.1021" 
+    capture_lex $P1179
+    .const 'Sub' $P1126 = "35_1792415680.1021" 
+    capture_lex $P1126
+    .const 'Sub' $P1114 = "33_1792415680.1021" 
+    capture_lex $P1114
+    .const 'Sub' $P1109 = "32_1792415680.1021" 
+    capture_lex $P1109
+    .const 'Sub' $P1106 = "31_1792415680.1021" 
+    capture_lex $P1106
+    .const 'Sub' $P1102 = "30_1792415680.1021" 
+    capture_lex $P1102
+    .const 'Sub' $P1098 = "29_1792415680.1021" 
+    capture_lex $P1098
+    .const 'Sub' $P1094 = "28_1792415680.1021" 
+    capture_lex $P1094
+    .const 'Sub' $P1090 = "27_1792415680.1021" 
+    capture_lex $P1090
+    .const 'Sub' $P1086 = "26_1792415680.1021" 
+    capture_lex $P1086
+    .const 'Sub' $P1082 = "25_1792415680.1021" 
+    capture_lex $P1082
+    .const 'Sub' $P1078 = "24_1792415680.1021" 
+    capture_lex $P1078
+    .const 'Sub' $P1074 = "23_1792415680.1021" 
+    capture_lex $P1074
+    .const 'Sub' $P1070 = "22_1792415680.1021" 
+    capture_lex $P1070
+    .const 'Sub' $P1066 = "21_1792415680.1021" 
+    capture_lex $P1066
+    .const 'Sub' $P1053 = "19_1792415680.1021" 
+    capture_lex $P1053
+    .const 'Sub' $P1044 = "17_1792415680.1021" 
+    capture_lex $P1044
+    .const 'Sub' $P1018 = "15_1792415680.1021" 
+    capture_lex $P1018
+    .const 'Sub' $P1015 = "14_1792415680.1021" 
+    capture_lex $P1015
+    .const 'Sub' $P1012 = "13_1792415680.1021" 
+    capture_lex $P1012
+    .const 'Sub' $P1004 = "12_1792415680.1021" 
+    capture_lex $P1004
+    $P0 = find_dynamic_lex "$*CTXSAVE"
+    if null $P0 goto ctxsave_done
+    $I0 = can $P0, "ctxsave"
+    unless $I0 goto ctxsave_done
+    $P0."ctxsave"()
+  ctxsave_done:
+.annotate 'line', 249
+    .const 'Sub' $P1189 = "42_1792415680.1021" 
+    newclosure $P1201, $P1189
+.annotate 'line', 6
+    .return ($P1201)
+    .const 'Sub' $P1203 = "44_1792415680.1021" 
+    .return ($P1203)
+.end
+
+
+.namespace ["Ops";"Trans";"C"]
+.include "except_types.pasm"
+.sub "new"  :subid("12_1792415680.1021") :method :outer("11_1792415680.1021")
+.annotate 'file', "compilers/opsc/src/Ops/Trans/C.pm"
+.annotate 'line', 6
+    new $P1006, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1006, control_1005
+    push_eh $P1006
+    .lex "self", self
+.annotate 'line', 8
+    $P100 = "list"()
+    find_lex $P1007, "self"
+    unless_null $P1007, vivify_47
+    $P1007 = root_new ['parrot';'Hash']
+    store_lex "self", $P1007
+  vivify_47:
+    set $P1007["op_funcs"], $P100
+.annotate 'line', 10
+    $P100 = "list"()
+    find_lex $P1008, "self"
+    unless_null $P1008, vivify_48
+    $P1008 = root_new ['parrot';'Hash']
+    store_lex "self", $P1008
+  vivify_48:
+    set $P1008["op_protos"], $P100
+.annotate 'line', 12
+    $P100 = "hash"()
+    find_lex $P1009, "self"
+    unless_null $P1009, vivify_49
+    $P1009 = root_new ['parrot';'Hash']
+    store_lex "self", $P1009
+  vivify_49:
+    set $P1009["names"], $P100
+.annotate 'line', 14
+    new $P100, "Integer"
+    assign $P100, 0
+    find_lex $P1010, "self"
+    unless_null $P1010, vivify_50
+    $P1010 = root_new ['parrot';'Hash']
+    store_lex "self", $P1010
+  vivify_50:
+    set $P1010["num_entries"], $P100
+.annotate 'line', 16
+    $P100 = "hash"("cur_opcode[NUM]" :named("op"), "IREG(NUM)" :named("i"), "NREG(NUM)" :named("n"), "PREG(NUM)" :named("p"), "SREG(NUM)" :named("s"), "PREG(NUM)" :named("k"), "IREG(NUM)" :named("ki"), "ICONST(NUM)" :named("ic"), "NCONST(NUM)" :named("nc"), "PCONST(NUM)" :named("pc"), "SCONST(NUM)" :named("sc"), "PCONST(NUM)" :named("kc"), "ICONST(NUM)" :named("kic"))
+    find_lex $P1011, "self"
+    unless_null $P1011, vivify_51
+    $P1011 = root_new ['parrot';'Hash']
+    store_lex "self", $P1011
+  vivify_51:
+    set $P1011["arg_maps"], $P100
+.annotate 'line', 6
+    find_lex $P100, "self"
+    .return ($P100)
+  control_1005:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Trans";"C"]
+.include "except_types.pasm"
+.sub "suffix"  :subid("13_1792415680.1021") :method :outer("11_1792415680.1021")
+.annotate 'file', "compilers/opsc/src/Ops/Trans/C.pm"
+.annotate 'line', 37
+    new $P1014, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1014, control_1013
+    push_eh $P1014
+    .lex "self", self
+    .return ("")
+  control_1013:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P100, exception, "payload"
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Trans";"C"]
+.include "except_types.pasm"
+.sub "core_type"  :subid("14_1792415680.1021") :method :outer("11_1792415680.1021")
+.annotate 'file', "compilers/opsc/src/Ops/Trans/C.pm"
+.annotate 'line', 39
+    new $P1017, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1017, control_1016
+    push_eh $P1017
+    .lex "self", self
+    .return ("PARROT_FUNCTION_CORE")
+  control_1016:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P100, exception, "payload"
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Trans";"C"]
+.include "except_types.pasm"
+.sub "prepare_ops"  :subid("15_1792415680.1021") :method :outer("11_1792415680.1021")
+    .param pmc param_1021
+    .param pmc param_1022
+.annotate 'file', "compilers/opsc/src/Ops/Trans/C.pm"
+.annotate 'line', 41
+    .const 'Sub' $P1031 = "16_1792415680.1021" 
+    capture_lex $P1031
+    new $P1020, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1020, control_1019
+    push_eh $P1020
+    .lex "self", self
+    .lex "$emitter", param_1021
+    .lex "$ops_file", param_1022
+.annotate 'line', 43
+    new $P100, "Undef"
+    set $P1023, $P100
+    .lex "$index", $P1023
+.annotate 'line', 44
+    $P1025 = root_new ['parrot';'ResizablePMCArray']
+    set $P1024, $P1025
+    .lex "@op_protos", $P1024
+.annotate 'line', 45
+    $P1027 = root_new ['parrot';'ResizablePMCArray']
+    set $P1026, $P1027
+    .lex "@op_funcs", $P1026
+.annotate 'line', 46
+    $P1029 = root_new ['parrot';'ResizablePMCArray']
+    set $P1028, $P1029
+    .lex "@op_func_table", $P1028
+.annotate 'line', 43
+    new $P101, "Integer"
+    assign $P101, 0
+    store_lex "$index", $P101
+.annotate 'line', 41
+    find_lex $P101, "@op_protos"
+    find_lex $P101, "@op_funcs"
+    find_lex $P101, "@op_func_table"
+.annotate 'line', 48
+    find_lex $P102, "$ops_file"
+    $P103 = $P102."ops"()
+    defined $I100, $P103
+    unless $I100, for_undef_52
+    iter $P101, $P103
+    new $P110, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P110, loop1039_handler
+    push_eh $P110
+  loop1039_test:
+    unless $P101, loop1039_done
+    shift $P104, $P101
+  loop1039_redo:
+    .const 'Sub' $P1031 = "16_1792415680.1021" 
+    capture_lex $P1031
+    $P1031($P104)
+  loop1039_next:
+    goto loop1039_test
+  loop1039_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P111, exception, 'type'
+    eq $P111, .CONTROL_LOOP_NEXT, loop1039_next
+    eq $P111, .CONTROL_LOOP_REDO, loop1039_redo
+  loop1039_done:
+    pop_eh 
+  for_undef_52:
+.annotate 'line', 65
+    find_lex $P101, "@op_funcs"
+    find_lex $P1040, "self"
+    unless_null $P1040, vivify_53
+    $P1040 = root_new ['parrot';'Hash']
+    store_lex "self", $P1040
+  vivify_53:
+    set $P1040["op_funcs"], $P101
+.annotate 'line', 66
+    find_lex $P101, "@op_protos"
+    find_lex $P1041, "self"
+    unless_null $P1041, vivify_54
+    $P1041 = root_new ['parrot';'Hash']
+    store_lex "self", $P1041
+  vivify_54:
+    set $P1041["op_protos"], $P101
+.annotate 'line', 67
+    find_lex $P101, "@op_func_table"
+    find_lex $P1042, "self"
+    unless_null $P1042, vivify_55
+    $P1042 = root_new ['parrot';'Hash']
+    store_lex "self", $P1042
+  vivify_55:
+    set $P1042["op_func_table"], $P101
+.annotate 'line', 68
+    find_lex $P101, "@op_funcs"
+    set $N100, $P101
+    new $P102, 'Float'
+    set $P102, $N100
+    add $P103, $P102, 1
+    find_lex $P1043, "self"
+    unless_null $P1043, vivify_56
+    $P1043 = root_new ['parrot';'Hash']
+    store_lex "self", $P1043
+  vivify_56:
+    set $P1043["num_entries"], $P103
+.annotate 'line', 41
+    .return ($P103)
+  control_1019:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Trans";"C"]
+.sub "_block1030"  :anon :subid("16_1792415680.1021") :outer("15_1792415680.1021")
+    .param pmc param_1032
+.annotate 'file', "compilers/opsc/src/Ops/Trans/C.pm"
+.annotate 'line', 48
+    .lex "$op", param_1032
+.annotate 'line', 50
+    new $P105, "Undef"
+    set $P1033, $P105
+    .lex "$func_name", $P1033
+.annotate 'line', 51
+    new $P106, "Undef"
+    set $P1034, $P106
+    .lex "$definition", $P1034
+.annotate 'line', 52
+    new $P107, "Undef"
+    set $P1035, $P107
+    .lex "$prototype", $P1035
+.annotate 'line', 55
+    new $P108, "Undef"
+    set $P1036, $P108
+    .lex "$src", $P1036
+.annotate 'line', 59
+    new $P109, "Undef"
+    set $P1037, $P109
+    .lex "$body", $P1037
+.annotate 'line', 50
+    find_lex $P110, "$op"
+    find_lex $P111, "self"
+    $P112 = $P110."func_name"($P111)
+    store_lex "$func_name", $P112
+.annotate 'line', 51
+    new $P110, 'String'
+    set $P110, "opcode_t *\n"
+    find_lex $P111, "$func_name"
+    concat $P112, $P110, $P111
+    concat $P113, $P112, "(opcode_t *cur_opcode, PARROT_INTERP)"
+    store_lex "$definition", $P113
+.annotate 'line', 52
+    find_lex $P110, "$emitter"
+    $P111 = $P110."sym_export"()
+    new $P112, 'String'
+    set $P112, " opcode_t * "
+    find_lex $P113, "$func_name"
+    concat $P114, $P112, $P113
+    concat $P115, $P114, "(opcode_t *, PARROT_INTERP);\n"
+    concat $P116, $P111, $P115
+.annotate 'line', 53
+    store_lex "$prototype", $P116
+.annotate 'line', 55
+    find_lex $P110, "$op"
+    find_lex $P111, "self"
+    $P112 = $P110."source"($P111)
+    store_lex "$src", $P112
+.annotate 'line', 57
+    find_lex $P110, "@op_func_table"
+    find_lex $P111, "$func_name"
+    concat $P112, $P111, ","
+    find_lex $P113, "$index"
+    $P114 = "sprintf"("  %-50s /* %6ld */\n", $P112, $P113)
+    $P110."push"($P114)
+.annotate 'line', 59
+    find_lex $P110, "$definition"
+    find_lex $P111, "$src"
+    $P112 = "join"("", $P110, " ", $P111, "\n\n")
+    store_lex "$body", $P112
+.annotate 'line', 60
+    find_lex $P110, "@op_funcs"
+    find_lex $P111, "$body"
+    $P110."push"($P111)
+.annotate 'line', 61
+    find_lex $P110, "@op_protos"
+    find_lex $P111, "$prototype"
+    $P110."push"($P111)
+.annotate 'line', 48
+    find_lex $P110, "$index"
+    clone $P1038, $P110
+    inc $P110
+    .return ($P1038)
+.end
+
+
+.namespace ["Ops";"Trans";"C"]
+.include "except_types.pasm"
+.sub "emit_c_op_funcs_header_part"  :subid("17_1792415680.1021") :method :outer("11_1792415680.1021")
+    .param pmc param_1047
+.annotate 'file', "compilers/opsc/src/Ops/Trans/C.pm"
+.annotate 'line', 71
+    .const 'Sub' $P1050 = "18_1792415680.1021" 
+    capture_lex $P1050
+    new $P1046, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1046, control_1045
+    push_eh $P1046
+    .lex "self", self
+    .lex "$fh", param_1047
+.annotate 'line', 72
+    find_lex $P1048, "self"
+    unless_null $P1048, vivify_57
+    $P1048 = root_new ['parrot';'Hash']
+  vivify_57:
+    set $P101, $P1048["op_protos"]
+    unless_null $P101, vivify_58
+    new $P101, "Undef"
+  vivify_58:
+    defined $I100, $P101
+    unless $I100, for_undef_59
+    iter $P100, $P101
+    new $P103, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P103, loop1052_handler
+    push_eh $P103
+  loop1052_test:
+    unless $P100, loop1052_done
+    shift $P102, $P100
+  loop1052_redo:
+    .const 'Sub' $P1050 = "18_1792415680.1021" 
+    capture_lex $P1050
+    $P1050($P102)
+  loop1052_next:
+    goto loop1052_test
+  loop1052_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P104, exception, 'type'
+    eq $P104, .CONTROL_LOOP_NEXT, loop1052_next
+    eq $P104, .CONTROL_LOOP_REDO, loop1052_redo
+  loop1052_done:
+    pop_eh 
+  for_undef_59:
+.annotate 'line', 71
+    .return ($P100)
+  control_1045:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Trans";"C"]
+.sub "_block1049"  :anon :subid("18_1792415680.1021") :outer("17_1792415680.1021")
+    .param pmc param_1051
+.annotate 'file', "compilers/opsc/src/Ops/Trans/C.pm"
+.annotate 'line', 72
+    .lex "$proto", param_1051
+.annotate 'line', 73
+    find_lex $P103, "$fh"
+    find_lex $P104, "$proto"
+    $P105 = $P103."print"($P104)
+.annotate 'line', 72
+    .return ($P105)
+.end
+
+
+.namespace ["Ops";"Trans";"C"]
+.include "except_types.pasm"
+.sub "access_arg"  :subid("19_1792415680.1021") :method :outer("11_1792415680.1021")
+    .param pmc param_1056
+    .param pmc param_1057
+.annotate 'file', "compilers/opsc/src/Ops/Trans/C.pm"
+.annotate 'line', 77
+    .const 'Sub' $P1063 = "20_1792415680.1021" 
+    capture_lex $P1063
+    new $P1055, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1055, control_1054
+    push_eh $P1055
+    .lex "self", self
+    .lex "$type", param_1056
+    .lex "$num", param_1057
+.annotate 'line', 78
+    new $P100, "Undef"
+    set $P1058, $P100
+    .lex "$access", $P1058
+    find_lex $P101, "$type"
+    find_lex $P1059, "self"
+    unless_null $P1059, vivify_60
+    $P1059 = root_new ['parrot';'Hash']
+  vivify_60:
+    set $P1060, $P1059["arg_maps"]
+    unless_null $P1060, vivify_61
+    $P1060 = root_new ['parrot';'Hash']
+  vivify_61:
+    set $P102, $P1060[$P101]
+    unless_null $P102, vivify_62
+    new $P102, "Undef"
+  vivify_62:
+    store_lex "$access", $P102
+.annotate 'line', 79
+    find_lex $P101, "$access"
+    if $P101, unless_1061_end
+    new $P102, 'String'
+    set $P102, "unrecognized arg type '"
+    find_lex $P103, "$type"
+    concat $P104, $P102, $P103
+    concat $P105, $P104, "' (register $"
+    find_lex $P106, "$num"
+    concat $P107, $P105, $P106
+    concat $P108, $P107, ")"
+    "die"($P108)
+  unless_1061_end:
+.annotate 'line', 80
+    find_lex $P101, "$access"
+    get_hll_global $P102, ["Regex"], "Regex"
+    .const 'Sub' $P1063 = "20_1792415680.1021" 
+    capture_lex $P1063
+    $P103 = $P102."new"($P1063)
+    find_lex $P104, "$num"
+    $P105 = "subst"($P101, $P103, $P104)
+.annotate 'line', 77
+    .return ($P105)
+  control_1054:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Trans";"C"]
+.sub "_block1062"  :anon :subid("20_1792415680.1021") :method :outer("19_1792415680.1021")
+.annotate 'file', "compilers/opsc/src/Ops/Trans/C.pm"
+.annotate 'line', 80
+    .local string rx1064_tgt
+    .local int rx1064_pos
+    .local int rx1064_off
+    .local int rx1064_eos
+    .local int rx1064_rep
+    .local pmc rx1064_cur
+    .local pmc rx1064_debug
+    (rx1064_cur, rx1064_pos, rx1064_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1064_debug, rx1064_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1064_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1064_eos, rx1064_tgt
+    gt rx1064_pos, rx1064_eos, rx1064_done
+    set rx1064_off, 0
+    lt rx1064_pos, 2, rx1064_start
+    sub rx1064_off, rx1064_pos, 1
+    substr rx1064_tgt, rx1064_tgt, rx1064_off
+  rx1064_start:
+    eq $I10, 1, rx1064_restart
+    if_null rx1064_debug, debug_63
+    rx1064_cur."!cursor_debug"("START", "")
+  debug_63:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1065_done
+    goto rxscan1065_scan
+  rxscan1065_loop:
+    ($P10) = rx1064_cur."from"()
+    inc $P10
+    set rx1064_pos, $P10
+    ge rx1064_pos, rx1064_eos, rxscan1065_done
+  rxscan1065_scan:
+    set_addr $I10, rxscan1065_loop
+    rx1064_cur."!mark_push"(0, rx1064_pos, $I10)
+  rxscan1065_done:
+  # rx literal  "NUM"
+    add $I11, rx1064_pos, 3
+    gt $I11, rx1064_eos, rx1064_fail
+    sub $I11, rx1064_pos, rx1064_off
+    substr $S10, rx1064_tgt, $I11, 3
+    ne $S10, "NUM", rx1064_fail
+    add rx1064_pos, 3
+  # rx pass
+    rx1064_cur."!cursor_pass"(rx1064_pos, "")
+    if_null rx1064_debug, debug_64
+    rx1064_cur."!cursor_debug"("PASS", "", " at pos=", rx1064_pos)
+  debug_64:
+    rx1064_cur."!cursor_backtrack"()
+    .return (rx1064_cur)
+  rx1064_restart:
+    if_null rx1064_debug, debug_65
+    rx1064_cur."!cursor_debug"("NEXT", "")
+  debug_65:
+  rx1064_fail:
+    (rx1064_rep, rx1064_pos, $I10, $P10) = rx1064_cur."!mark_fail"(0)
+    lt rx1064_pos, -1, rx1064_done
+    eq rx1064_pos, -1, rx1064_fail
+    jump $I10
+  rx1064_done:
+    rx1064_cur."!cursor_fail"()
+    if_null rx1064_debug, debug_66
+    rx1064_cur."!cursor_debug"("FAIL", "")
+  debug_66:
+    .return (rx1064_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Trans";"C"]
+.include "except_types.pasm"
+.sub "restart_address"  :subid("21_1792415680.1021") :method :outer("11_1792415680.1021")
+    .param pmc param_1069
+.annotate 'file', "compilers/opsc/src/Ops/Trans/C.pm"
+.annotate 'line', 83
+    new $P1068, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1068, control_1067
+    push_eh $P1068
+    .lex "self", self
+    .lex "$addr", param_1069
+    new $P100, 'String'
+    set $P100, "interp->resume_offset = "
+    find_lex $P101, "$addr"
+    concat $P102, $P100, $P101
+    concat $P103, $P102, "; interp->resume_flag = 1;"
+    .return ($P103)
+  control_1067:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P100, exception, "payload"
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Trans";"C"]
+.include "except_types.pasm"
+.sub "restart_offset"  :subid("22_1792415680.1021") :method :outer("11_1792415680.1021")
+    .param pmc param_1073
+.annotate 'file', "compilers/opsc/src/Ops/Trans/C.pm"
+.annotate 'line', 87
+    new $P1072, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1072, control_1071
+    push_eh $P1072
+    .lex "self", self
+    .lex "$offset", param_1073
+    new $P100, 'String'
+    set $P100, "interp->resume_offset = REL_PC + "
+    find_lex $P101, "$offset"
+    concat $P102, $P100, $P101
+    concat $P103, $P102, "; interp->resume_flag = 1;"
+    .return ($P103)
+  control_1071:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P100, exception, "payload"
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Trans";"C"]
+.include "except_types.pasm"
+.sub "goto_address"  :subid("23_1792415680.1021") :method :outer("11_1792415680.1021")
+    .param pmc param_1077
+.annotate 'file', "compilers/opsc/src/Ops/Trans/C.pm"
+.annotate 'line', 91
+    new $P1076, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1076, control_1075
+    push_eh $P1076
+    .lex "self", self
+    .lex "$addr", param_1077
+    new $P100, 'String'
+    set $P100, "return (opcode_t *)"
+    find_lex $P101, "$addr"
+    concat $P102, $P100, $P101
+    .return ($P102)
+  control_1075:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P100, exception, "payload"
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Trans";"C"]
+.include "except_types.pasm"
+.sub "goto_offset"  :subid("24_1792415680.1021") :method :outer("11_1792415680.1021")
+    .param pmc param_1081
+.annotate 'file', "compilers/opsc/src/Ops/Trans/C.pm"
+.annotate 'line', 93
+    new $P1080, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1080, control_1079
+    push_eh $P1080
+    .lex "self", self
+    .lex "$offset", param_1081
+    new $P100, 'String'
+    set $P100, "return cur_opcode + "
+    find_lex $P101, "$offset"
+    concat $P102, $P100, $P101
+    .return ($P102)
+  control_1079:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P100, exception, "payload"
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Trans";"C"]
+.include "except_types.pasm"
+.sub "expr_address"  :subid("25_1792415680.1021") :method :outer("11_1792415680.1021")
+    .param pmc param_1085
+.annotate 'file', "compilers/opsc/src/Ops/Trans/C.pm"
+.annotate 'line', 95
+    new $P1084, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1084, control_1083
+    push_eh $P1084
+    .lex "self", self
+    .lex "$addr", param_1085
+    find_lex $P100, "$addr"
+    .return ($P100)
+  control_1083:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Trans";"C"]
+.include "except_types.pasm"
+.sub "expr_offset"  :subid("26_1792415680.1021") :method :outer("11_1792415680.1021")
+    .param pmc param_1089
+.annotate 'file', "compilers/opsc/src/Ops/Trans/C.pm"
+.annotate 'line', 97
+    new $P1088, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1088, control_1087
+    push_eh $P1088
+    .lex "self", self
+    .lex "$offset", param_1089
+    new $P100, 'String'
+    set $P100, " cur_opcode + "
+    find_lex $P101, "$offset"
+    concat $P102, $P100, $P101
+    .return ($P102)
+  control_1087:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P100, exception, "payload"
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Trans";"C"]
+.include "except_types.pasm"
+.sub "defines"  :subid("27_1792415680.1021") :method :outer("11_1792415680.1021")
+    .param pmc param_1093
+.annotate 'file', "compilers/opsc/src/Ops/Trans/C.pm"
+.annotate 'line', 107
+    new $P1092, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1092, control_1091
+    push_eh $P1092
+    .lex "self", self
+    .lex "$emitter", param_1093
+.annotate 'line', 108
+    new $P100, "Exception"
+    set $P100['type'], .CONTROL_RETURN
+    new $P101, "String"
+    assign $P101, "\n/* defines - Ops::Trans::C */\n#define REL_PC     ((size_t)(cur_opcode - (opcode_t *)interp->code->base.data))\n#define CUR_OPCODE cur_opcode\n#define IREG(i) REG_INT(interp, cur_opcode[i])\n#define NREG(i) REG_NUM(interp, cur_opcode[i])\n#define PREG(i) REG_PMC(interp, cur_opcode[i])\n#define SREG(i) REG_STR(interp, cur_opcode[i])\n#define ICONST(i) cur_opcode[i]\n#define NCONST(i) Parrot_pcc_get_num_constants(interp, interp->ctx)[cur_opcode[i]]\n#define SCONST(i) Parrot_pcc_get_str_constants(interp, interp->ctx)[cur_opcode[i]]\n#undef  PCONST\n#define PCONST(i) Parrot_pcc_get_pmc_constants(interp, interp->ctx)[cur_opcode[i]]\n\nstatic int get_op(PARROT_INTERP, const char * name, int full);\n"
+    setattribute $P100, 'payload', $P101
+    throw $P100
+.annotate 'line', 107
+    .return ()
+  control_1091:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P100, exception, "payload"
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Trans";"C"]
+.include "except_types.pasm"
+.sub "op_info"  :subid("28_1792415680.1021") :method :outer("11_1792415680.1021")
+    .param pmc param_1097
+.annotate 'file', "compilers/opsc/src/Ops/Trans/C.pm"
+.annotate 'line', 126
+    new $P1096, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1096, control_1095
+    push_eh $P1096
+    .lex "self", self
+    .lex "$emitter", param_1097
+    find_lex $P100, "$emitter"
+    $P101 = $P100."bs"()
+    concat $P102, $P101, "op_info_table"
+    .return ($P102)
+  control_1095:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P100, exception, "payload"
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Trans";"C"]
+.include "except_types.pasm"
+.sub "op_func"  :subid("29_1792415680.1021") :method :outer("11_1792415680.1021")
+    .param pmc param_1101
+.annotate 'file', "compilers/opsc/src/Ops/Trans/C.pm"
+.annotate 'line', 127
+    new $P1100, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1100, control_1099
+    push_eh $P1100
+    .lex "self", self
+    .lex "$emitter", param_1101
+    find_lex $P100, "$emitter"
+    $P101 = $P100."bs"()
+    concat $P102, $P101, "op_func_table"
+    .return ($P102)
+  control_1099:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P100, exception, "payload"
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Trans";"C"]
+.include "except_types.pasm"
+.sub "getop"  :subid("30_1792415680.1021") :method :outer("11_1792415680.1021")
+    .param pmc param_1105
+.annotate 'file', "compilers/opsc/src/Ops/Trans/C.pm"
+.annotate 'line', 128
+    new $P1104, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1104, control_1103
+    push_eh $P1104
+    .lex "self", self
+    .lex "$emitter", param_1105
+    .return ("get_op")
+  control_1103:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P100, exception, "payload"
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Trans";"C"]
+.include "except_types.pasm"
+.sub "body_prelude"  :subid("31_1792415680.1021") :method :outer("11_1792415680.1021")
+.annotate 'file', "compilers/opsc/src/Ops/Trans/C.pm"
+.annotate 'line', 130
+    new $P1108, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1108, control_1107
+    push_eh $P1108
+    .lex "self", self
+    .return ("")
+  control_1107:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P100, exception, "payload"
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Trans";"C"]
+.include "except_types.pasm"
+.sub "emit_source_part"  :subid("32_1792415680.1021") :method :outer("11_1792415680.1021")
+    .param pmc param_1112
+    .param pmc param_1113
+.annotate 'file', "compilers/opsc/src/Ops/Trans/C.pm"
+.annotate 'line', 132
+    new $P1111, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1111, control_1110
+    push_eh $P1111
+    .lex "self", self
+    .lex "$emitter", param_1112
+    .lex "$fh", param_1113
+.annotate 'line', 133
+    find_lex $P100, "self"
+    find_lex $P101, "$emitter"
+    find_lex $P102, "$fh"
+    $P100."_emit_op_func_table"($P101, $P102)
+.annotate 'line', 134
+    find_lex $P100, "self"
+    find_lex $P101, "$emitter"
+    find_lex $P102, "$fh"
+    $P100."_emit_op_info_table"($P101, $P102)
+.annotate 'line', 135
+    find_lex $P100, "self"
+    find_lex $P101, "$emitter"
+    find_lex $P102, "$fh"
+    $P103 = $P100."_emit_op_function_definitions"($P101, $P102)
+.annotate 'line', 132
+    .return ($P103)
+  control_1110:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P100, exception, "payload"
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Trans";"C"]
+.include "except_types.pasm"
+.sub "_emit_op_func_table"  :subid("33_1792415680.1021") :method :outer("11_1792415680.1021")
+    .param pmc param_1117
+    .param pmc param_1118
+.annotate 'file', "compilers/opsc/src/Ops/Trans/C.pm"
+.annotate 'line', 138
+    .const 'Sub' $P1123 = "34_1792415680.1021" 
+    capture_lex $P1123
+    new $P1116, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1116, control_1115
+    push_eh $P1116
+    .lex "self", self
+    .lex "$emitter", param_1117
+    .lex "$fh", param_1118
+.annotate 'line', 140
+    find_lex $P100, "$fh"
+.annotate 'line', 148
+    new $P101, 'String'
+    set $P101, "\n\nINTVAL "
+.annotate 'line', 142
+    find_lex $P102, "$emitter"
+    $P103 = $P102."bs"()
+    set $S100, $P103
+    concat $P102, $P101, $S100
+.annotate 'line', 148
+    concat $P104, $P102, "numops"
+.annotate 'line', 142
+    find_lex $P105, "self"
+    $P106 = $P105."suffix"()
+    set $S101, $P106
+    concat $P105, $P104, $S101
+.annotate 'line', 148
+    concat $P107, $P105, " = "
+.annotate 'line', 142
+    find_lex $P1119, "self"
+    unless_null $P1119, vivify_67
+    $P1119 = root_new ['parrot';'Hash']
+  vivify_67:
+    set $P108, $P1119["num_entries"]
+    unless_null $P108, vivify_68
+    new $P108, "Undef"
+  vivify_68:
+    set $S102, $P108
+    concat $P109, $P107, $S102
+.annotate 'line', 148
+    concat $P110, $P109, ";\n\n/*\n** Op Function Table:\n*/\n\nstatic op_func"
+    find_lex $P111, "self"
+    $P112 = $P111."suffix"()
+    set $S103, $P112
+    concat $P111, $P110, $S103
+    concat $P113, $P111, "_t "
+    find_lex $P114, "self"
+    find_lex $P115, "$emitter"
+    $P116 = $P114."op_func"($P115)
+    set $S104, $P116
+    concat $P114, $P113, $S104
+    concat $P115, $P114, "["
+    find_lex $P1120, "self"
+    unless_null $P1120, vivify_69
+    $P1120 = root_new ['parrot';'Hash']
+  vivify_69:
+    set $P117, $P1120["num_entries"]
+    unless_null $P117, vivify_70
+    new $P117, "Undef"
+  vivify_70:
+    set $S105, $P117
+    concat $P118, $P115, $S105
+    concat $P119, $P118, "] = "
+    concat $P120, $P119, "{"
+    concat $P121, $P120, "\n"
+    $P100."print"($P121)
+.annotate 'line', 151
+    find_lex $P1121, "self"
+    unless_null $P1121, vivify_71
+    $P1121 = root_new ['parrot';'Hash']
+  vivify_71:
+    set $P101, $P1121["op_func_table"]
+    unless_null $P101, vivify_72
+    new $P101, "Undef"
+  vivify_72:
+    defined $I100, $P101
+    unless $I100, for_undef_73
+    iter $P100, $P101
+    new $P103, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P103, loop1125_handler
+    push_eh $P103
+  loop1125_test:
+    unless $P100, loop1125_done
+    shift $P102, $P100
+  loop1125_redo:
+    .const 'Sub' $P1123 = "34_1792415680.1021" 
+    capture_lex $P1123
+    $P1123($P102)
+  loop1125_next:
+    goto loop1125_test
+  loop1125_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P104, exception, 'type'
+    eq $P104, .CONTROL_LOOP_NEXT, loop1125_next
+    eq $P104, .CONTROL_LOOP_REDO, loop1125_redo
+  loop1125_done:
+    pop_eh 
+  for_undef_73:
+.annotate 'line', 155
+    find_lex $P100, "$fh"
+    $P101 = $P100."print"("\n  NULL /* NULL function pointer */\n};\n\n")
+.annotate 'line', 138
+    .return ($P101)
+  control_1115:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P100, exception, "payload"
+    .return ($P100)
+.end
+
+
+.namespace ["Ops";"Trans";"C"]
+.sub "_block1122"  :anon :subid("34_1792415680.1021") :outer("33_1792415680.1021")
+    .param pmc param_1124
+.annotate 'file', "compilers/opsc/src/Ops/Trans/C.pm"
+.annotate 'line', 151
+    .lex "$_", param_1124
+.annotate 'line', 152
+    find_lex $P103, "$fh"
+    find_lex $P104, "$_"
+    $P105 = $P103."print"($P104)
+.annotate 'line', 151
+    .return ($P105)
+.end
+
+
+.namespace ["Ops";"Trans";"C"]
+.include "except_types.pasm"
+.sub "_emit_op_info_table"  :subid("35_1792415680.1021") :method :outer("11_1792415680.1021")
+    .param pmc param_1129
+    .param pmc param_1130
+.annotate 'file', "compilers/opsc/src/Ops/Trans/C.pm"
+.annotate 'line', 163
+    .const 'Sub' $P1140 = "36_1792415680.1021" 
+    capture_lex $P1140
+    new $P1128, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1128, control_1127
+    push_eh $P1128
+    .lex "self", self
+    .lex "$emitter", param_1129
+    .lex "$fh", param_1130
+.annotate 'line', 165
+    $P1132 = root_new ['parrot';'Hash']
+    set $P1131, $P1132
+    .lex "%names", $P1131
+.annotate 'line', 166
+    $P1134 = root_new ['parrot';'Hash']
+    set $P1133, $P1134
+    .lex "%arg_dir_mapping", $P1133
+.annotate 'line', 184
+    new $P100, "Undef"
+    set $P1135, $P100
+    .lex "$index", $P1135
+.annotate 'line', 185
+    new $P101, "Undef"
+    set $P1136, $P101
+    .lex "$op_lib_ref", $P1136
+.annotate 'line', 165
+    find_lex $P1137, "self"
+    unless_null $P1137, vivify_74
+    $P1137 = root_new ['parrot';'Hash']
+  vivify_74:
+    set $P102, $P1137["names"]
+    unless_null $P102, vivify_75
+    new $P102, "Undef"
+  vivify_75:
+    store_lex "%names", $P102
+.annotate 'line', 166
+    $P102 = "hash"("PARROT_ARGDIR_IN" :named("i"), "PARROT_ARGDIR_OUT" :named("o"), "PARROT_ARGDIR_INOUT" :named("io"))
+    store_lex "%arg_dir_mapping", $P102
+.annotate 'line', 175
+    find_lex $P102, "$fh"
+.annotate 'line', 181
+    new $P103, 'String'
+    set $P103, "\n\n/*\n** Op Info Table:\n*/\n\nstatic op_info_t "
+    find_lex $P104, "self"
+    find_lex $P105, "$emitter"
+    $P106 = $P104."op_info"($P105)
+    set $S100, $P106
+    concat $P104, $P103, $S100
+    concat $P105, $P104, "["
+    find_lex $P1138, "self"
+    unless_null $P1138, vivify_76
+    $P1138 = root_new ['parrot';'Hash']
+  vivify_76:
+    set $P107, $P1138["num_entries"]
+    unless_null $P107, vivify_77
+    new $P107, "Undef"
+  vivify_77:
+    set $S101, $P107
+    concat $P108, $P105, $S101
+    concat $P109, $P108, "] = "
+    concat $P110, $P109, "{\n"
+    $P102."print"($P110)
+.annotate 'line', 184
+    new $P102, "Integer"
+    assign $P102, 0
+    store_lex "$index", $P102
+.annotate 'line', 185
+    new $P102, "String"
+    assign $P102, "&"
+    find_lex $P103, "$emitter"
+    $S100 = $P103."bs"()
+    concat $P104, $P102, $S100
+    concat $P105, $P104, "op_lib"
+    store_lex "$op_lib_ref", $P105
+.annotate 'line', 187
+    find_lex $P103, "$emitter"
+    $P104 = $P103."ops_file"()
+    $P105 = $P104."ops"()
+    defined $I100, $P105
+    unless $I100, for_undef_78
+    iter $P102, $P105
+    new $P117, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P117, loop1178_handler
+    push_eh $P117
+  loop1178_test:
+    unless $P102, loop1178_done
+    shift $P106, $P102
+  loop1178_redo:
+    .const 'Sub' $P1140 = "36_1792415680.1021" 
+    capture_lex $P1140
+    $P1140($P106)
+  loop1178_next:
+    goto loop1178_test
+  loop1178_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P118, exception, 'type'
+    eq $P118, .CONTROL_LOOP_NEXT, loop1178_next
+    eq $P118, .CONTROL_LOOP_REDO, loop1178_redo
+  loop1178_done:
+    pop_eh 
+  for_undef_78:
+.annotate 'line', 230
+    find_lex $P102, "$fh"
+    $P103 = $P102."print"("\n};\n\n")
+.annotate 'line', 163
+    .return ($P103)
+  control_1127:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P102, exception, "payload"
+    .return ($P102)
+.end
+
+
+.namespace ["Ops";"Trans";"C"]
+.sub "_block1139"  :anon :subid("36_1792415680.1021") :outer("35_1792415680.1021")
+    .param pmc param_1141
+.annotate 'file', "compilers/opsc/src/Ops/Trans/C.pm"
+.annotate 'line', 187
+    .const 'Sub' $P1171 = "39_1792415680.1021" 
+    capture_lex $P1171
+    .const 'Sub' $P1162 = "38_1792415680.1021" 
+    capture_lex $P1162
+    .const 'Sub' $P1156 = "37_1792415680.1021" 
+    capture_lex $P1156
+    .lex "$op", param_1141
+.annotate 'line', 188
+    new $P107, "Undef"
+    set $P1142, $P107
+    .lex "$type", $P1142
+.annotate 'line', 189
+    new $P108, "Undef"
+    set $P1143, $P108
+    .lex "$name", $P1143
+.annotate 'line', 191
+    new $P109, "Undef"
+    set $P1144, $P109
+    .lex "$full_name", $P1144
+.annotate 'line', 192
+    new $P110, "Undef"
+    set $P1145, $P110
+    .lex "$func_name", $P1145
+.annotate 'line', 193
+    new $P111, "Undef"
+    set $P1146, $P111
+    .lex "$body", $P1146
+.annotate 'line', 194
+    new $P112, "Undef"
+    set $P1147, $P112
+    .lex "$jump", $P1147
+.annotate 'line', 195
+    new $P113, "Undef"
+    set $P1148, $P113
+    .lex "$arg_count", $P1148
+.annotate 'line', 198
+    new $P114, "Undef"
+    set $P1149, $P114
+    .lex "$arg_types", $P1149
+.annotate 'line', 203
+    new $P115, "Undef"
+    set $P1150, $P115
+    .lex "$arg_dirs", $P1150
+.annotate 'line', 208
+    new $P116, "Undef"
+    set $P1151, $P116
+    .lex "$labels", $P1151
+.annotate 'line', 188
+    find_lex $P118, "$op"
+    $P119 = $P118."type"()
+    if $P119, if_1152
+    new $P121, "String"
+    assign $P121, "FUNCTION"
+    set $P117, $P121
+    goto if_1152_end
+  if_1152:
+    new $P120, "String"
+    assign $P120, "INLINE"
+    set $P117, $P120
+  if_1152_end:
+    $P122 = "uc"($P117)
+    $P123 = "sprintf"("PARROT_%s_OP", $P122)
+    store_lex "$type", $P123
+.annotate 'line', 189
+    find_lex $P117, "$op"
+    $P118 = $P117."name"()
+    store_lex "$name", $P118
+.annotate 'line', 190
+    new $P117, "Integer"
+    assign $P117, 1
+    find_lex $P118, "$name"
+    find_lex $P1153, "%names"
+    unless_null $P1153, vivify_79
+    $P1153 = root_new ['parrot';'Hash']
+    store_lex "%names", $P1153
+  vivify_79:
+    set $P1153[$P118], $P117
+.annotate 'line', 191
+    find_lex $P117, "$op"
+    $P118 = $P117."full_name"()
+    store_lex "$full_name", $P118
+.annotate 'line', 192
+    find_lex $P117, "$op"
+    find_lex $P118, "self"
+    $P119 = $P117."func_name"($P118)
+    store_lex "$func_name", $P119
+.annotate 'line', 193
+    find_lex $P117, "$op"
+    $P118 = $P117."body"()
+    store_lex "$body", $P118
+.annotate 'line', 194
+    find_lex $P117, "$op"
+    $P118 = $P117."get_jump"()
+    store_lex "$jump", $P118
+.annotate 'line', 195
+    find_lex $P117, "$op"
+    $P118 = $P117."size"()
+    store_lex "$arg_count", $P118
+.annotate 'line', 198
+    find_lex $P118, "$op"
+    $P119 = $P118."arg_types"()
+    set $N100, $P119
+    if $N100, if_1154
+    new $P127, "String"
+    assign $P127, "{ (arg_type_t) 0 }"
+    set $P117, $P127
+    goto if_1154_end
+  if_1154:
+.annotate 'line', 199
+    new $P120, "String"
+    assign $P120, "{ "
+.annotate 'line', 200
+    .const 'Sub' $P1156 = "37_1792415680.1021" 
+    newclosure $P1158, $P1156
+    find_lex $P121, "$op"
+    $P122 = $P121."arg_types"()
+    $P124 = "map"($P1158, $P122 :flat)
+    $S100 = "join"(", ", $P124 :flat)
+.annotate 'line', 199
+    concat $P125, $P120, $S100
+    concat $P126, $P125, " }"
+.annotate 'line', 201
+    set $P117, $P126
+  if_1154_end:
+.annotate 'line', 199
+    store_lex "$arg_types", $P117
+.annotate 'line', 204
+    find_lex $P1160, "$op"
+    unless_null $P1160, vivify_80
+    $P1160 = root_new ['parrot';'Hash']
+  vivify_80:
+    set $P118, $P1160["normalized_args"]
+    unless_null $P118, vivify_81
+    new $P118, "Undef"
+  vivify_81:
+    if $P118, if_1159
+    new $P125, "String"
+    assign $P125, "{ (arg_dir_t) 0 }"
+    set $P117, $P125
+    goto if_1159_end
+  if_1159:
+    new $P119, "String"
+    assign $P119, "{ "
+.annotate 'line', 205
+    .const 'Sub' $P1162 = "38_1792415680.1021" 
+    newclosure $P1166, $P1162
+    find_lex $P1167, "$op"
+    unless_null $P1167, vivify_86
+    $P1167 = root_new ['parrot';'Hash']
+  vivify_86:
+    set $P120, $P1167["normalized_args"]
+    unless_null $P120, vivify_87
+    new $P120, "Undef"
+  vivify_87:
+    $P122 = "map"($P1166, $P120 :flat)
+    $S100 = "join"(", ", $P122 :flat)
+.annotate 'line', 204
+    concat $P123, $P119, $S100
+    concat $P124, $P123, " }"
+.annotate 'line', 206
+    set $P117, $P124
+  if_1159_end:
+.annotate 'line', 204
+    store_lex "$arg_dirs", $P117
+.annotate 'line', 209
+    find_lex $P1169, "$op"
+    unless_null $P1169, vivify_88
+    $P1169 = root_new ['parrot';'Hash']
+  vivify_88:
+    set $P118, $P1169["normalized_args"]
+    unless_null $P118, vivify_89
+    new $P118, "Undef"
+  vivify_89:
+    if $P118, if_1168
+    new $P125, "String"
+    assign $P125, "{ 0 }"
+    set $P117, $P125
+    goto if_1168_end
+  if_1168:
+    new $P119, "String"
+    assign $P119, "{ "
+.annotate 'line', 210
+    .const 'Sub' $P1171 = "39_1792415680.1021" 
+    newclosure $P1175, $P1171
+    find_lex $P1176, "$op"
+    unless_null $P1176, vivify_92
+    $P1176 = root_new ['parrot';'Hash']
+  vivify_92:
+    set $P121, $P1176["normalized_args"]
+    unless_null $P121, vivify_93
+    new $P121, "Undef"
+  vivify_93:
+    $P122 = "map"($P1175, $P121 :flat)
+    $S100 = "join"(", ", $P122 :flat)
+.annotate 'line', 209
+    concat $P123, $P119, $S100
+    concat $P124, $P123, " }"
+.annotate 'line', 211
+    set $P117, $P124
+  if_1168_end:
+.annotate 'line', 209
+    store_lex "$labels", $P117
+.annotate 'line', 214
+    find_lex $P117, "$fh"
+    new $P118, "String"
+    assign $P118, "  { "
+    new $P119, 'String'
+    set $P119, "/* "
+    find_lex $P120, "$index"
+    concat $P121, $P119, $P120
+    concat $P122, $P121, " */\n    \""
+    find_lex $P123, "$name"
+    concat $P124, $P122, $P123
+    concat $P125, $P124, "\",\n    \""
+    find_lex $P126, "$full_name"
+    concat $P127, $P125, $P126
+    concat $P128, $P127, "\",\n    \""
+    find_lex $P129, "$func_name"
+    concat $P130, $P128, $P129
+    concat $P131, $P130, "\",\n    "
+    find_lex $P132, "$jump"
+    concat $P133, $P131, $P132
+    concat $P134, $P133, ",\n    "
+    find_lex $P135, "$arg_count"
+    concat $P136, $P134, $P135
+    concat $P137, $P136, ",\n    "
+    find_lex $P138, "$arg_types"
+    concat $P139, $P137, $P138
+    concat $P140, $P139, ",\n    "
+    find_lex $P141, "$arg_dirs"
+    concat $P142, $P140, $P141
+    concat $P143, $P142, ",\n    "
+    find_lex $P144, "$labels"
+    concat $P145, $P143, $P144
+    concat $P146, $P145, ",\n    "
+    find_lex $P147, "$op_lib_ref"
+    concat $P148, $P146, $P147
+    concat $P149, $P148, "\n  "
+    concat $P150, $P118, $P149
+    concat $P151, $P150, "},\n"
+.annotate 'line', 224
+    $P117."print"($P151)
+.annotate 'line', 187
+    find_lex $P117, "$index"
+    clone $P1177, $P117
+    inc $P117
+    .return ($P1177)
+.end
+
+
+.namespace ["Ops";"Trans";"C"]
+.sub "_block1155"  :anon :subid("37_1792415680.1021") :outer("36_1792415680.1021")
+    .param pmc param_1157
+.annotate 'file', "compilers/opsc/src/Ops/Trans/C.pm"
+.annotate 'line', 200
+    .lex "$t", param_1157
+    find_lex $P121, "$t"
+    $P122 = "uc"($P121)
+    $P123 = "sprintf"("PARROT_ARG_%s", $P122)
+    .return ($P123)
+.end
+
+
+.namespace ["Ops";"Trans";"C"]
+.sub "_block1161"  :anon :subid("38_1792415680.1021") :outer("36_1792415680.1021")
+    .param pmc param_1163
+.annotate 'file', "compilers/opsc/src/Ops/Trans/C.pm"
+.annotate 'line', 205
+    .lex "$d", param_1163
+    find_lex $P1164, "$d"
+    unless_null $P1164, vivify_82
+    $P1164 = root_new ['parrot';'Hash']
+  vivify_82:
+    set $P120, $P1164["direction"]
+    unless_null $P120, vivify_83
+    new $P120, "Undef"
+  vivify_83:
+    find_lex $P1165, "%arg_dir_mapping"
+    unless_null $P1165, vivify_84
+    $P1165 = root_new ['parrot';'Hash']
+  vivify_84:
+    set $P121, $P1165[$P120]
+    unless_null $P121, vivify_85
+    new $P121, "Undef"
+  vivify_85:
+    .return ($P121)
+.end
+
+
+.namespace ["Ops";"Trans";"C"]
+.sub "_block1170"  :anon :subid("39_1792415680.1021") :outer("36_1792415680.1021")
+    .param pmc param_1172
+.annotate 'file', "compilers/opsc/src/Ops/Trans/C.pm"
+.annotate 'line', 210
+    .lex "$d", param_1172
+    find_lex $P1174, "$d"
+    unless_null $P1174, vivify_90
+    $P1174 = root_new ['parrot';'Hash']
+  vivify_90:
+    set $P121, $P1174["is_label"]
+    unless_null $P121, vivify_91
+    new $P121, "Undef"
+  vivify_91:
+    if $P121, if_1173
+    new $P123, "Integer"
+    assign $P123, 0
+    set $P120, $P123
+    goto if_1173_end
+  if_1173:
+    new $P122, "Integer"
+    assign $P122, 1
+    set $P120, $P122
+  if_1173_end:
+    .return ($P120)
+.end
+
+
+.namespace ["Ops";"Trans";"C"]
+.include "except_types.pasm"
+.sub "_emit_op_function_definitions"  :subid("40_1792415680.1021") :method :outer("11_1792415680.1021")
+    .param pmc param_1182
+    .param pmc param_1183
+.annotate 'file', "compilers/opsc/src/Ops/Trans/C.pm"
+.annotate 'line', 236
+    .const 'Sub' $P1186 = "41_1792415680.1021" 
+    capture_lex $P1186
+    new $P1181, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1181, control_1180
+    push_eh $P1181
+    .lex "self", self
+    .lex "$emitter", param_1182
+    .lex "$fh", param_1183
+.annotate 'line', 237
+    find_lex $P100, "$fh"
+    $P100."print"("\n/*\n** Op Function Definitions:\n*/\n\n")
+.annotate 'line', 244
+    find_lex $P1184, "self"
+    unless_null $P1184, vivify_94
+    $P1184 = root_new ['parrot';'Hash']
+  vivify_94:
+    set $P101, $P1184["op_funcs"]
+    unless_null $P101, vivify_95
+    new $P101, "Undef"
+  vivify_95:
+    defined $I100, $P101
+    unless $I100, for_undef_96
+    iter $P100, $P101
+    new $P103, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P103, loop1188_handler
+    push_eh $P103
+  loop1188_test:
+    unless $P100, loop1188_done
+    shift $P102, $P100
+  loop1188_redo:
+    .const 'Sub' $P1186 = "41_1792415680.1021" 
+    capture_lex $P1186
+    $P1186($P102)
+  loop1188_next:
+    goto loop1188_test
+  loop1188_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P104, exception, 'type'
+    eq $P104, .CONTROL_LOOP_NEXT, loop1188_next
+    eq $P104, .CONTROL_LOOP_REDO, loop1188_redo
+  loop1188_done:
+    pop_eh 
+  for_undef_96:
+.annotate 'line', 236
+    .return ($P100)
+  control_1180:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["Ops";"Trans";"C"]
+.sub "_block1185"  :anon :subid("41_1792415680.1021") :outer("40_1792415680.1021")
+    .param pmc param_1187
+.annotate 'file', "compilers/opsc/src/Ops/Trans/C.pm"
+.annotate 'line', 244
+    .lex "$op", param_1187
+.annotate 'line', 245
+    find_lex $P103, "$fh"
+    find_lex $P104, "$op"
+    $P105 = $P103."print"($P104)
+.annotate 'line', 244
+    .return ($P105)
+.end
+
+
+.namespace ["Ops";"Trans";"C"]
+.include "except_types.pasm"
+.sub "emit_op_lookup"  :subid("42_1792415680.1021") :method :outer("11_1792415680.1021")
+    .param pmc param_1192
+    .param pmc param_1193
+.annotate 'file', "compilers/opsc/src/Ops/Trans/C.pm"
+.annotate 'line', 249
+    .const 'Sub' $P1198 = "43_1792415680.1021" 
+    capture_lex $P1198
+    new $P1191, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1191, control_1190
+    push_eh $P1191
+    .lex "self", self
+    .lex "$emitter", param_1192
+    .lex "$fh", param_1193
+.annotate 'line', 255
+    new $P100, "Undef"
+    set $P1194, $P100
+    .lex "$hash_size", $P1194
+.annotate 'line', 262
+    new $P101, "Undef"
+    set $P1195, $P101
+    .lex "$res", $P1195
+.annotate 'line', 251
+    find_lex $P102, "$emitter"
+    $P103 = $P102."flags"()
+    set $P104, $P103["core"]
+    unless_null $P104, vivify_97
+    new $P104, "Undef"
+  vivify_97:
+    isfalse $I100, $P104
+    unless $I100, if_1196_end
+    get_hll_global $P105, "return"
+  if_1196_end:
+.annotate 'line', 255
+    new $P102, "Integer"
+    assign $P102, 3041
+    store_lex "$hash_size", $P102
+.annotate 'line', 262
+    new $P102, "String"
+    assign $P102, "\n/*\n** Op lookup function:\n*/\n\n#define OP_HASH_SIZE 3041\n\n/* we could calculate a prime somewhat bigger than\n * n of fullnames + n of names\n * for now this should be ok\n *\n * look up an op_code: at first call to op_code() a hash\n * of short and full opcode names is created\n * hash functions are from imcc, thanks to Melvin.\n */\n\n\ntypedef struct hop {\n    op_info_t * info;\n    struct hop *next;\n} HOP;\n\nstatic HOP *hop_buckets;\nstatic HOP **hop;\n\nstatic void hop_init(PARROT_INTERP);\nstatic size_t hash_str(ARGIN(const char *str));\nstatic void store_op(ARGIN(op_info_t *info), ARGMOD(HOP *p), ARGIN(const char *name));\n\n/* XXX on changing interpreters, this should be called,\n   through a hook */\n\nstatic void hop_deinit(PARROT_INTERP);\n\n/*\n * find a short or full opcode\n * usage:\n *\n * interp->op_lib->op_code(\"set\", 0)\n * interp->op_lib->op_code(\"set_i_i\", 1)\n *\n * returns >= 0 (found idx into info_table), -1 if not\n */\n\nPARROT_PURE_FUNCTION\nstatic\nsize_t hash_str(ARGIN(const char *str))\n{\n    size_t      key = 0;\n    const char *s   = str;\n\n    while (*s) {\n        key *= 65599;\n        key += *s++;\n    }\n\n    return key;\n}\n\n\nstatic void store_op(ARGIN(op_info_t *info), ARGMOD(HOP *p), ARGIN(const char *name))\n{\n    const size_t hidx = hash_str(name) % OP_HASH_SIZE;\n\n    p->info           = info;\n    p->next           = hop[hidx];\n    hop[hidx]         = p;\n}\n\nstatic int get_op(PARROT_INTERP, ARGIN(const char *name), int full)\n{\n    const HOP   *p;\n    const size_t hidx = hash_str(name) % OP_HASH_SIZE;\n\n    if (!hop) {\n        hop = mem_gc_allocate_n_zeroed_typed(interp, OP_HASH_SIZE,HOP *);\n        hop_init(interp);\n    }\n\n    for (p = hop[hidx]; p; p = p->next) {\n        if (STREQ(name, full ? p->info->full_name : p->info->name))\n            return p->info - [[BS]]op_lib.op_info_table;\n    }\n\n    return -1;\n}\n\n\nstatic void hop_init(PARROT_INTERP)\n{\n    op_info_t * const info = [[BS]]op_lib.op_info_table;\n    opcode_t i;\n\n    /* allocate the storage all in one chunk\n     * yes, this is profligate, but we can tighten it later */\n    HOP *hops;\n\n    hop_buckets = mem_gc_allocate_n_zeroed_typed(interp, [[BS]]op_lib.op_count * 2, HOP );\n    hops        = hop_buckets;\n\n\n    /* store full names */\n    for (i = 0; i < [[BS]]op_lib.op_count; i++) {\n        store_op(info + i, hops++, info[i].full_name);\n\n        /* plus one short name */\n        if (i && info[i - 1].name != info[i].name)\n            store_op(info + i, hops++, info[i].name);\n    }\n}\n\nstatic void hop_deinit(PARROT_INTERP)\n{\n    if (hop)\n        mem_sys_free(hop);\n    if (hop_buckets)\n        mem_gc_free(interp, hop_buckets);\n\n    hop         = NULL;\n    hop_buckets = NULL;\n}"
+    store_lex "$res", $P102
+.annotate 'line', 384
+    find_lex $P102, "$fh"
+    find_lex $P103, "$res"
+    get_hll_global $P104, ["Regex"], "Regex"
+    .const 'Sub' $P1198 = "43_1792415680.1021" 
+    capture_lex $P1198
+    $P105 = $P104."new"($P1198)
+    find_lex $P106, "$emitter"
+    $P107 = $P106."bs"()
+    $P108 = "subst"($P103, $P105, $P107, 1 :named("global"))
+    $P109 = $P102."print"($P108)
+.annotate 'line', 249
+    .return ($P109)
+  control_1190:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P102, exception, "payload"
+    .return ($P102)
+.end
+
+
+.namespace ["Ops";"Trans";"C"]
+.sub "_block1197"  :anon :subid("43_1792415680.1021") :method :outer("42_1792415680.1021")
+.annotate 'file', "compilers/opsc/src/Ops/Trans/C.pm"
+.annotate 'line', 384
+    .local string rx1199_tgt
+    .local int rx1199_pos
+    .local int rx1199_off
+    .local int rx1199_eos
+    .local int rx1199_rep
+    .local pmc rx1199_cur
+    .local pmc rx1199_debug
+    (rx1199_cur, rx1199_pos, rx1199_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1199_debug, rx1199_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1199_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1199_eos, rx1199_tgt
+    gt rx1199_pos, rx1199_eos, rx1199_done
+    set rx1199_off, 0
+    lt rx1199_pos, 2, rx1199_start
+    sub rx1199_off, rx1199_pos, 1
+    substr rx1199_tgt, rx1199_tgt, rx1199_off
+  rx1199_start:
+    eq $I10, 1, rx1199_restart
+    if_null rx1199_debug, debug_98
+    rx1199_cur."!cursor_debug"("START", "")
+  debug_98:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1200_done
+    goto rxscan1200_scan
+  rxscan1200_loop:
+    ($P10) = rx1199_cur."from"()
+    inc $P10
+    set rx1199_pos, $P10
+    ge rx1199_pos, rx1199_eos, rxscan1200_done
+  rxscan1200_scan:
+    set_addr $I10, rxscan1200_loop
+    rx1199_cur."!mark_push"(0, rx1199_pos, $I10)
+  rxscan1200_done:
+  # rx literal  "[[BS]]"
+    add $I11, rx1199_pos, 6
+    gt $I11, rx1199_eos, rx1199_fail
+    sub $I11, rx1199_pos, rx1199_off
+    substr $S10, rx1199_tgt, $I11, 6
+    ne $S10, "[[BS]]", rx1199_fail
+    add rx1199_pos, 6
+  # rx pass
+    rx1199_cur."!cursor_pass"(rx1199_pos, "")
+    if_null rx1199_debug, debug_99
+    rx1199_cur."!cursor_debug"("PASS", "", " at pos=", rx1199_pos)
+  debug_99:
+    rx1199_cur."!cursor_backtrack"()
+    .return (rx1199_cur)
+  rx1199_restart:
+    if_null rx1199_debug, debug_100
+    rx1199_cur."!cursor_debug"("NEXT", "")
+  debug_100:
+  rx1199_fail:
+    (rx1199_rep, rx1199_pos, $I10, $P10) = rx1199_cur."!mark_fail"(0)
+    lt rx1199_pos, -1, rx1199_done
+    eq rx1199_pos, -1, rx1199_fail
+    jump $I10
+  rx1199_done:
+    rx1199_cur."!cursor_fail"()
+    if_null rx1199_debug, debug_101
+    rx1199_cur."!cursor_debug"("FAIL", "")
+  debug_101:
+    .return (rx1199_cur)
+    .return ()
+.end
+
+
+.namespace ["Ops";"Trans";"C"]
+.sub "_block1202" :load :anon :subid("44_1792415680.1021")
+.annotate 'file', "compilers/opsc/src/Ops/Trans/C.pm"
+.annotate 'line', 6
+    .const '' $P1204 = "11_1792415680.1021" 
+    $P100 = $P1204()
+    .return ($P100)
+.end
+
+
+.namespace []
+.sub "_block1205" :load :anon :subid("45_1792415680.1021")
+.annotate 'file', "compilers/opsc/src/Ops/Trans/C.pm"
+.annotate 'line', 1
+    .const '' $P1207 = "10_1792415680.1021" 
+    $P100 = $P1207()
+    .return ($P100)
+.end
+
@@ -0,0 +1,138 @@
+
+## <PGE::Grammar::name>
+.namespace ["PGE";"Grammar"]
+      .sub "name" :method :nsentry 
+          .param pmc adverbs      :slurpy :named
+          .local pmc mob
+          .local string target
+          .local pmc mfrom, mpos
+          .local int cpos, iscont
+          $P0 = get_hll_global ['PGE'], '$!MATCH'
+          (mob, cpos, target, mfrom, mpos, iscont) = $P0.'new'(self, adverbs :flat :named)
+          .local int lastpos
+          lastpos = length target
+          if cpos > lastpos goto fail_rule
+          .local pmc cstack
+          cstack = root_new ['parrot';'ResizableIntegerArray']
+          .local pmc ustack
+          ustack = root_new ['parrot';'ResizablePMCArray']
+          .local pmc captscope, captob
+          captscope = mob
+          .local int pos, rep, cutmark
+        try_match:
+          if cpos > lastpos goto fail_rule
+          mfrom = cpos
+          pos = cpos
+          cutmark = 0
+          local_branch cstack, R
+          if cutmark <= -2 goto fail_cut
+          inc cpos
+          if iscont goto try_match
+        fail_rule:
+          cutmark = -2
+        fail_cut:
+          mob.'_failcut'(cutmark)
+          .return (mob)
+          goto fail_cut
+        succeed:
+          mpos = pos
+          .return (mob)
+        fail:
+          local_return cstack
+        fail_match:
+          cutmark = -3
+          goto fail_cut
+        R: # concat
+        R244: # subrule ident
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'ident'
+          if $I0 == 0 goto R244_1
+          $P0 = find_method mob, 'ident'
+          goto R244_2
+        R244_1:
+          $P0 = find_name 'ident'
+          unless null $P0 goto R244_2
+          die "Unable to find regex 'ident'"
+        R244_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'dba'=>"", 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          $I0 = defined captscope["ident"]
+if $I0 goto R244_cgen
+$P0 = root_new ['parrot';'ResizablePMCArray']
+captscope["ident"] = $P0
+local_branch cstack, R244_cgen
+delete captscope["ident"]
+goto fail
+R244_cgen:
+
+          $P2 = captscope["ident"]
+push $P2, captob
+          pos = $P1
+          local_branch cstack, R245
+          $P2 = captscope["ident"]
+$P2 = pop $P2
+          goto fail
+        R245:  # quant 0..Inf none
+          local_branch cstack, R245_repeat
+          if cutmark != 247 goto fail
+          cutmark = 0
+          goto fail
+        R245_repeat:
+          push ustack, pos
+          local_branch cstack, R246
+          pos = pop ustack
+          if cutmark != 0 goto fail
+          local_branch cstack, succeed
+          if cutmark != 0 goto fail
+          cutmark = 247
+          goto fail
+        R246: # concat
+        R248: # literal
+          $I0 = pos + 2
+          if $I0 > lastpos goto fail
+          $S0 = substr target, pos, 2
+          
+          if $S0 != "::" goto fail
+          pos += 2
+          goto R249
+
+        R249: # subrule ident
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'ident'
+          if $I0 == 0 goto R249_1
+          $P0 = find_method mob, 'ident'
+          goto R249_2
+        R249_1:
+          $P0 = find_name 'ident'
+          unless null $P0 goto R249_2
+          die "Unable to find regex 'ident'"
+        R249_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'dba'=>"", 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          $I0 = defined captscope["ident"]
+if $I0 goto R249_cgen
+$P0 = root_new ['parrot';'ResizablePMCArray']
+captscope["ident"] = $P0
+local_branch cstack, R249_cgen
+delete captscope["ident"]
+goto fail
+R249_cgen:
+
+          $P2 = captscope["ident"]
+push $P2, captob
+          pos = $P1
+          local_branch cstack, R245_repeat
+          $P2 = captscope["ident"]
+$P2 = pop $P2
+          goto fail
+      .end
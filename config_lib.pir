@@ -0,0 +1,320 @@
+# ex: set ro: -*- buffer-read-only:t -*-
+# DO NOT EDIT THIS FILE
+# Generated by gen::config_pm from config/gen/config_pm/config_lib_pir.in and %PConfig
+# This file should be the last thing run during
+# the make process, after Parrot is built.
+
+# Copyright (C) 2004-2014, Parrot Foundation.
+
+.include 'datatypes.pasm'
+.include 'parrot_version.pir'
+
+.sub 'main' :main
+    get_params "(0)", $P5
+    set $I10, $P5     # argv
+    set $I11, 0      # flag
+    le $I10, 1, no_arg
+    set $S10, $P5[1]
+    ne $S10, "--install", no_arg
+    set $I11, 1      # install flag
+no_arg:
+    new $P0, 'Hash'
+    $P0.'set_value_type'(.DATATYPE_STRING)
+    $S2 = null
+
+    set $P0["git_describe"], .PARROT_GIT_DESCRIBE
+    set $P0["sha1"], .PARROT_SHA1
+    set $P0["a"], ".a"
+    set $P0["ar"], "ar"
+    set $P0["ar_extra"], ""
+    set $P0["ar_out"], ""
+    set $P0["archname"], "x86_64-linux-gnu-thread-multi"
+    set $P0["arflags"], "cr"
+    set $P0["as"], "as"
+    set $P0["backtrace"], "1"
+    set $P0["bigendian"], "0"
+    set $P0["bindir"], "/usr/local/bin"
+    set $P0["bison_version"], $S2
+    set $P0["blib_dir"], "blib/lib"
+    set $P0["build_dir"], "/root/repo"
+    set $P0["byteorder"], "12345678"
+    set $P0["cat"], "$(PERL) -MExtUtils::Command -e cat"
+    set $P0["cc"], "x86_64-linux-gnu-gcc"
+    set $P0["cc_debug"], ""
+    set $P0["cc_exe_out"], "-o "
+    set $P0["cc_inc"], "-I./include -I./include/pmc"
+    set $P0["cc_ldflags"], ""
+    set $P0["cc_o_out"], "-o "
+    set $P0["cc_shared"], "-fPIC"
+    set $P0["ccflags"], "-D_REENTRANT -D_GNU_SOURCE -DDEBIAN -fwrapv  -pipe -I/usr/local/include -D_LARGEFILE_SOURCE -D_FILE_OFFSET_BITS=64 -DHASATTRIBUTE_CONST  -DHASATTRIBUTE_DEPRECATED  -DHASATTRIBUTE_MALLOC  -DHASATTRIBUTE_NONNULL  -DHASATTRIBUTE_PURE  -DHASATTRIBUTE_UNUSED  -DHASATTRIBUTE_WARN_UNUSED_RESULT  -DHASATTRIBUTE_HOT  -DHASATTRIBUTE_COLD  -DHAS_GETTEXT "
+    set $P0["ccwarn"], "-falign-functions=16 -funit-at-a-time -fexcess-precision=standard -maccumulate-outgoing-args -Wall -Wextra -Waggregate-return -Wcast-qual -Wdisabled-optimization -Wdiv-by-zero -Wendif-labels -Wformat-extra-args -Wformat-nonliteral -Wformat-security -Wformat-y2k -Wimplicit -Wimport -Winit-self -Winline -Winvalid-pch -Wjump-misses-init -Wlogical-op -Werror=missing-braces -Werror=missing-declarations -Wno-missing-format-attribute -Wmissing-include-dirs -Wmultichar -Wpacked -Wpointer-arith -Wreturn-type -Wsequence-point -Wsign-compare -Wstrict-aliasing -Wstrict-aliasing=2 -Wswitch -Wswitch-default -Werror=undef -Wno-unused -Wvariadic-macros -Wwrite-strings -Wstack-usage=500 -Wc++-compat -Werror=declaration-after-statement -Werror=implicit-function-declaration -Werror=missing-prototypes -Werror=nested-externs -Werror=old-style-definition -Werror=strict-prototypes -fvisibility=hidden"
+    set $P0["ccwarn::compilers/imcc/imclexer.c"], "-falign-functions=16 -funit-at-a-time -fexcess-precision=standard -maccumulate-outgoing-args -Wall -Wextra -Waggregate-return -Wcast-qual -Wdisabled-optimization -Wdiv-by-zero -Wendif-labels -Wformat-extra-args -Wformat-security -Wformat-y2k -Wimplicit -Wimport -Winit-self -Winline -Winvalid-pch -Wjump-misses-init -Wlogical-op -Werror=missing-braces -Werror=missing-declarations -Wno-missing-format-attribute -Wmissing-include-dirs -Wmultichar -Wpacked -Wpointer-arith -Wreturn-type -Wsequence-point -Wsign-compare -Wstrict-aliasing -Wstrict-aliasing=2 -Wswitch -Werror=undef -Wno-unused -Wvariadic-macros -Wwrite-strings -Wstack-usage=500 -Wc++-compat -Werror=declaration-after-statement -Werror=implicit-function-declaration -Werror=missing-prototypes -Werror=nested-externs -Werror=old-style-definition -Werror=strict-prototypes -fvisibility=hidden -Wno-unused-parameter"
+    set $P0["ccwarn::compilers/imcc/imcparser.c"], "-falign-functions=16 -funit-at-a-time -fexcess-precision=standard -maccumulate-outgoing-args -Wall -Wextra -Waggregate-return -Wdisabled-optimization -Wdiv-by-zero -Wendif-labels -Wformat-extra-args -Wformat-nonliteral -Wformat-security -Wformat-y2k -Wimplicit -Wimport -Winit-self -Winline -Winvalid-pch -Wjump-misses-init -Wlogical-op -Werror=missing-braces -Werror=missing-declarations -Wno-missing-format-attribute -Wmissing-include-dirs -Wmultichar -Wpacked -Wpointer-arith -Wreturn-type -Wsequence-point -Wsign-compare -Wstrict-aliasing -Wstrict-aliasing=2 -Wswitch -Wswitch-default -Werror=undef -Wno-unused -Wvariadic-macros -Wwrite-strings -Wstack-usage=500 -Wc++-compat -Werror=declaration-after-statement -Werror=implicit-function-declaration -Werror=missing-prototypes -Werror=nested-externs -Werror=old-style-definition -Werror=strict-prototypes -fvisibility=hidden"
+    set $P0["ccwarn::compilers/imcc/optimizer.c"], "-falign-functions=16 -funit-at-a-time -fexcess-precision=standard -maccumulate-outgoing-args -Wall -Wextra -Waggregate-return -Wcast-qual -Wdisabled-optimization -Wdiv-by-zero -Wendif-labels -Wformat-extra-args -Wformat-security -Wformat-y2k -Wimplicit -Wimport -Winit-self -Winline -Winvalid-pch -Wjump-misses-init -Wlogical-op -Werror=missing-braces -Werror=missing-declarations -Wno-missing-format-attribute -Wmissing-include-dirs -Wmultichar -Wpacked -Wpointer-arith -Wreturn-type -Wsequence-point -Wsign-compare -Wstrict-aliasing -Wstrict-aliasing=2 -Wswitch -Wswitch-default -Werror=undef -Wno-unused -Wvariadic-macros -Wwrite-strings -Wstack-usage=500 -Wc++-compat -Werror=declaration-after-statement -Werror=implicit-function-declaration -Werror=missing-prototypes -Werror=nested-externs -Werror=old-style-definition -Werror=strict-prototypes -fvisibility=hidden"
+    set $P0["ccwarn::src/extra_nci_thunks.c"], "-falign-functions=16 -funit-at-a-time -fexcess-precision=standard -maccumulate-outgoing-args -Wall -Wextra -Waggregate-return -Wcast-qual -Wdisabled-optimization -Wdiv-by-zero -Wendif-labels -Wformat-extra-args -Wformat-nonliteral -Wformat-security -Wformat-y2k -Wimplicit -Wimport -Winit-self -Winline -Winvalid-pch -Wjump-misses-init -Wlogical-op -Werror=missing-braces -Werror=missing-declarations -Wno-missing-format-attribute -Wmissing-include-dirs -Wmultichar -Wpacked -Wpointer-arith -Wreturn-type -Wsequence-point -Wsign-compare -Wstrict-aliasing -Wstrict-aliasing=2 -Wswitch -Wswitch-default -Werror=undef -Wno-unused -Wvariadic-macros -Wwrite-strings -Wstack-usage=500 -Wc++-compat -Werror=declaration-after-statement -Werror=implicit-function-declaration -Werror=missing-prototypes -Werror=nested-externs -Werror=old-style-definition -Werror=strict-prototypes -fvisibility=hidden"
+    set $P0["ccwarn::src/nci/extra_thunks.c"], "-falign-functions=16 -funit-at-a-time -fexcess-precision=standard -maccumulate-outgoing-args -Wall -Wextra -Waggregate-return -Wcast-qual -Wdisabled-optimization -Wdiv-by-zero -Wendif-labels -Wformat-extra-args -Wformat-nonliteral -Wformat-security -Wformat-y2k -Wimplicit -Wimport -Winit-self -Winline -Winvalid-pch -Wjump-misses-init -Wlogical-op -Werror=missing-braces -Werror=missing-declarations -Wno-missing-format-attribute -Wmissing-include-dirs -Wmultichar -Wpacked -Wpointer-arith -Wreturn-type -Wsequence-point -Wsign-compare -Wstrict-aliasing -Wstrict-aliasing=2 -Wswitch -Wswitch-default -Werror=undef -Wno-unused -Wvariadic-macros -Wwrite-strings -Wstack-usage=500 -Wc++-compat -Werror=declaration-after-statement -Werror=implicit-function-declaration -Werror=missing-prototypes -Werror=nested-externs -Werror=old-style-definition -Werror=strict-prototypes -fvisibility=hidden"
+    set $P0["ccwarn::src/ops/core_ops.c"], "-falign-functions=16 -funit-at-a-time -fexcess-precision=standard -maccumulate-outgoing-args -Wall -Wextra -Waggregate-return -Wcast-qual -Wdisabled-optimization -Wdiv-by-zero -Wendif-labels -Wformat-extra-args -Wformat-nonliteral -Wformat-security -Wformat-y2k -Wimplicit -Wimport -Winit-self -Winline -Winvalid-pch -Wjump-misses-init -Wlogical-op -Werror=missing-braces -Werror=missing-declarations -Wno-missing-format-attribute -Wmissing-include-dirs -Wmultichar -Wpacked -Wpointer-arith -Wreturn-type -Wsequence-point -Wsign-compare -Wstrict-aliasing -Wstrict-aliasing=2 -Wswitch -Wswitch-default -Werror=undef -Wno-unused -Wvariadic-macros -Wwrite-strings -Wstack-usage=500 -Wc++-compat -Werror=declaration-after-statement -Werror=implicit-function-declaration -Werror=missing-prototypes -Werror=nested-externs -Werror=old-style-definition -Werror=strict-prototypes -fvisibility=hidden -Wno-parentheses-equality"
+    set $P0["ccwarn::src/spf_render.c"], "-falign-functions=16 -funit-at-a-time -fexcess-precision=standard -maccumulate-outgoing-args -Wall -Wextra -Waggregate-return -Wcast-qual -Wdisabled-optimization -Wdiv-by-zero -Wendif-labels -Wformat-extra-args -Wformat-security -Wformat-y2k -Wimplicit -Wimport -Winit-self -Winline -Winvalid-pch -Wjump-misses-init -Wlogical-op -Werror=missing-braces -Werror=missing-declarations -Wno-missing-format-attribute -Wmissing-include-dirs -Wmultichar -Wpacked -Wpointer-arith -Wreturn-type -Wsequence-point -Wsign-compare -Wstrict-aliasing -Wstrict-aliasing=2 -Wswitch -Wswitch-default -Werror=undef -Wno-unused -Wvariadic-macros -Wwrite-strings -Wstack-usage=500 -Wc++-compat -Werror=declaration-after-statement -Werror=implicit-function-declaration -Werror=missing-prototypes -Werror=nested-externs -Werror=old-style-definition -Werror=strict-prototypes -fvisibility=hidden"
+    set $P0["ccwarn::src/string/spf_render.c"], "-falign-functions=16 -funit-at-a-time -fexcess-precision=standard -maccumulate-outgoing-args -Wall -Wextra -Waggregate-return -Wcast-qual -Wdisabled-optimization -Wdiv-by-zero -Wendif-labels -Wformat-extra-args -Wformat-nonliteral -Wformat-security -Wformat-y2k -Wimplicit -Wimport -Winit-self -Winline -Winvalid-pch -Wjump-misses-init -Wlogical-op -Werror=missing-braces -Werror=missing-declarations -Wno-missing-format-attribute -Wmissing-include-dirs -Wmultichar -Wpacked -Wpointer-arith -Wreturn-type -Wsequence-point -Wsign-compare -Wstrict-aliasing -Wstrict-aliasing=2 -Wswitch -Wswitch-default -Werror=undef -Wno-unused -Wvariadic-macros -Wwrite-strings -Wstack-usage=500 -Wc++-compat -Werror=declaration-after-statement -Werror=implicit-function-declaration -Werror=missing-prototypes -Werror=nested-externs -Werror=old-style-definition -Werror=strict-prototypes -fvisibility=hidden -Wno-format-nonliteral"
+    set $P0["ccwarn::src/string/sprintf.c"], "-falign-functions=16 -funit-at-a-time -fexcess-precision=standard -maccumulate-outgoing-args -Wall -Wextra -Waggregate-return -Wcast-qual -Wdisabled-optimization -Wdiv-by-zero -Wendif-labels -Wformat-extra-args -Wformat-nonliteral -Wformat-security -Wformat-y2k -Wimplicit -Wimport -Winit-self -Winline -Winvalid-pch -Wjump-misses-init -Wlogical-op -Werror=missing-braces -Werror=missing-declarations -Wno-missing-format-attribute -Wmissing-include-dirs -Wmultichar -Wpacked -Wpointer-arith -Wreturn-type -Wsequence-point -Wsign-compare -Wstrict-aliasing -Wstrict-aliasing=2 -Wswitch -Wswitch-default -Werror=undef -Wno-unused -Wvariadic-macros -Wwrite-strings -Wstack-usage=500 -Wc++-compat -Werror=declaration-after-statement -Werror=implicit-function-declaration -Werror=missing-prototypes -Werror=nested-externs -Werror=old-style-definition -Werror=strict-prototypes -fvisibility=hidden -Wno-format-nonliteral"
+    set $P0["chmod"], "$(PERL) -MExtUtils::Command -e chmod"
+    set $P0["clang"], "0"
+    set $P0["clock_best"], ""
+    set $P0["configdate"], "Mon Oct 19 10:19:09 2026 GMT"
+    set $P0["configuration_steps"], "init::manifest init::defaults init::install init::hints inter::progs inter::make inter::lex inter::yacc auto::gcc auto::glibc auto::backtrace auto::msvc auto::attributes auto::arch auto::cpu init::optimize inter::shlibs inter::libparrot inter::types auto::ops auto::pmc auto::headers auto::sizes auto::byteorder auto::va_ptr auto::format auto::isreg auto::llvm auto::inline auto::gc auto::memalign auto::signal auto::socklen_t auto::stat auto::neg_0 auto::env auto::timespec auto::infnan auto::thread auto::gmp auto::readline auto::pcre auto::opengl auto::zlib auto::gettext auto::snprintf auto::labs auto::perldoc auto::coverage auto::pod2man auto::ctags auto::icu auto::libffi auto::ipv6 auto::platform auto::alignof auto::expect auto::warnings gen::config_h gen::core_pmcs gen::opengl gen::makefiles gen::config_pm"
+    set $P0["configure_args"], ""
+    set $P0["configure_tests"], "t/configure/*.t t/steps/*.t t/postconfigure/*.t"
+    set $P0["configured_from_file"], ""
+    set $P0["core_tests"], "t/src/*.t t/src/embed/*.t t/run/*.t t/perl/*.t"
+    set $P0["cover"], "$(PERL) -e \"print \"cover needed but not found.\\n\"; exit 1;\""
+    set $P0["coveragedir"], "/root/repo"
+    set $P0["cp"], "$(PERL) -MExtUtils::Command -e cp"
+    set $P0["cpuarch"], "amd64"
+    set $P0["cputype"], "Intel(R) Xeon(R) Processor"
+    set $P0["ctags"], "ctags"
+    set $P0["cxx"], "c++"
+    set $P0["datadir"], "/usr/local/share"
+    set $P0["debugging"], "0"
+    set $P0["DEVEL"], "-devel"
+    set $P0["developing_tests"], "t/codingstd/c_arg_assert.t t/codingstd/c_code_coda.t t/codingstd/c_cppcomments.t t/codingstd/c_enum.t t/codingstd/c_function_docs.t t/codingstd/c_header_guards.t t/codingstd/c_indent.t t/codingstd/c_macro_args.t t/codingstd/c_operator.t t/codingstd/c_parens.t t/codingstd/c_returns.t t/codingstd/c_struct.t t/codingstd/c_todo.t t/codingstd/case_sensitive_files.t t/codingstd/check_isxxx.t t/codingstd/check_toxxx.t t/codingstd/copyright.t t/codingstd/cuddled_else.t t/codingstd/filenames.t t/codingstd/gmt_utc.t t/codingstd/linelength.t t/codingstd/make_code_coda.t t/codingstd/opcode_doc.t t/codingstd/pbc_compat.t t/codingstd/pccmethod_deps.t t/codingstd/pdd_format.t t/codingstd/perlcritic.t t/codingstd/pir_code_coda.t t/codingstd/pmc_docs.t t/codingstd/pod_description.t t/codingstd/pod_syntax.t t/codingstd/pod_todo.t t/codingstd/tabs.t t/codingstd/trailing_space.t"
+    set $P0["docdir"], "/usr/local/share/doc"
+    set $P0["doublesize"], "8"
+    set $P0["dquote"], "\""
+    set $P0["embed-cflags"], "-I/usr/local/include/parrot/6.9.0-devel"
+    set $P0["embed-ldflags"], "-L/usr/local/lib -lparrot -ldl -lm -lpthread -lcrypt -lrt -lgmp -lreadline -lffi"
+    set $P0["exe"], ""
+    set $P0["exec_prefix"], "/usr/local"
+    set $P0["flex_version"], $S2
+    set $P0["float4_t"], "float"
+    set $P0["float8_t"], "double"
+    set $P0["floatsize"], "4"
+    set $P0["floatvalfmt"], "%.15g"
+    set $P0["floatvalmax"], "DBL_MAX"
+    set $P0["floatvalmin"], "DBL_MIN"
+    set $P0["g++"], "0"
+    set $P0["gc_flag"], ""
+    set $P0["gc_type"], "GMS"
+    set $P0["gccversion"], "12.2"
+    set $P0["gcov"], "/usr/bin/gcov"
+    set $P0["gcov2perl"], "$(PERL) -e \"print \"gcov2perl needed but not found.\\n\"; exit 1;\""
+    set $P0["glibc"], "2"
+    set $P0["gmake_version"], "4.3"
+    set $P0["gmp"], "define"
+    set $P0["has___sighandler_t"], "define"
+    set $P0["HAS_BSD_STAT_EXTN"], "1"
+    set $P0["HAS_BUILTIN_EXPECT"], "1"
+    set $P0["HAS_C99_SNPRINTF"], "1"
+    set $P0["HAS_COMPILER_OFFSETOF_ALIGNOF"], "1"
+    set $P0["HAS_CORE_NCI_THUNKS"], "1"
+    set $P0["has_core_nci_thunks"], "1"
+    set $P0["has_coverage_tools"], "0"
+    set $P0["has_dynamic_linking"], "1"
+    set $P0["HAS_EXTRA_NCI_THUNKS"], "1"
+    set $P0["has_extra_nci_thunks"], "1"
+    set $P0["HAS_GETTEXT"], "1"
+    set $P0["HAS_GLUT"], "0"
+    set $P0["has_glut"], "0"
+    set $P0["HAS_GMP"], "1"
+    set $P0["has_icu"], "0"
+    set $P0["HAS_INF_NAN"], "1"
+    set $P0["HAS_INT64"], "1"
+    set $P0["HAS_IPV6"], "1"
+    set $P0["HAS_LABS"], "1"
+    set $P0["HAS_LIBFFI"], "1"
+    set $P0["has_libffi"], "1"
+    set $P0["has_llvm"], ""
+    set $P0["HAS_LONGLONG"], "1"
+    set $P0["has_negative_zero"], "1"
+    set $P0["HAS_OPENGL"], "0"
+    set $P0["has_opengl"], "0"
+    set $P0["has_perldoc"], "0"
+    set $P0["has_pod2man"], "1"
+    set $P0["HAS_READLINE"], "1"
+    set $P0["has_setitimer"], "define"
+    set $P0["has_sig_atomic_t"], "define"
+    set $P0["has_sigaction"], "define"
+    set $P0["has_sigatomic_t"], $S2
+    set $P0["HAS_SNPRINTF"], "1"
+    set $P0["has_socklen_t"], "1"
+    set $P0["HAS_STAT_ATIM"], "1"
+    set $P0["HAS_STAT_ATIMESPEC"], "0"
+    set $P0["has_static_linking"], "1"
+    set $P0["HAS_THREADS"], "1"
+    set $P0["HAS_TIMESPEC"], "1"
+    set $P0["has_zlib"], "1"
+    set $P0["HASATTRIBUTE_COLD"], "1"
+    set $P0["HASATTRIBUTE_CONST"], "1"
+    set $P0["HASATTRIBUTE_DEPRECATED"], "1"
+    set $P0["HASATTRIBUTE_FORMAT"], "0"
+    set $P0["HASATTRIBUTE_HOT"], "1"
+    set $P0["HASATTRIBUTE_MALLOC"], "1"
+    set $P0["HASATTRIBUTE_NEVER_WORKS"], "0"
+    set $P0["HASATTRIBUTE_NONNULL"], "1"
+    set $P0["HASATTRIBUTE_NORETURN"], "1"
+    set $P0["HASATTRIBUTE_PURE"], "1"
+    set $P0["HASATTRIBUTE_UNUSED"], "1"
+    set $P0["HASATTRIBUTE_WARN_UNUSED_RESULT"], "1"
+    set $P0["have_cover"], "$(PERL) -e \"print \"The following tools are needed for coverage testing: cover, gcov2perl\\n\"; print \"Please install Devel::Cover.\\n\"; exit 1;\""
+    set $P0["hugefloatval"], "long double"
+    set $P0["hugefloatvalsize"], "16"
+    set $P0["hugeintval"], "long long"
+    set $P0["hugeintvalsize"], "8"
+    set $P0["i_libcpuid"], $S2
+    set $P0["i_netinetin"], "define"
+    set $P0["i_setjmp"], "define"
+    set $P0["i_signal"], "define"
+    set $P0["i_sysexit"], $S2
+    set $P0["i_sysresource"], "define"
+    set $P0["i_syssocket"], "define"
+    set $P0["i_syssysctl"], $S2
+    set $P0["icu_dir"], ""
+    set $P0["icu_shared"], ""
+    set $P0["includedir"], "/usr/local/include"
+    set $P0["infodir"], "/usr/local/info"
+    set $P0["inline"], ""
+    set $P0["inst_libparrot_ldflags"], ""
+    set $P0["inst_libparrot_linkflags"], "-L\"/usr/local/lib\" -lparrot"
+    set $P0["int2_t"], "short"
+    set $P0["int4_t"], "int"
+    set $P0["int8_t"], "long"
+    set $P0["intsize"], "4"
+    set $P0["intvalfmt"], "%ld"
+    set $P0["intvalmax"], "LONG_MAX"
+    set $P0["intvalmin"], "LONG_MIN"
+    set $P0["intvalsize"], "8"
+    set $P0["isreg"], "1"
+    set $P0["iv"], "long"
+    set $P0["ld"], "x86_64-linux-gnu-gcc"
+    set $P0["ld_debug"], ""
+    set $P0["ld_load_flags"], "-shared -L/usr/local/lib -fstack-protector-strong -fPIC"
+    set $P0["ld_out"], "-o "
+    set $P0["ld_share_flags"], "-shared -L/usr/local/lib -fstack-protector-strong -fPIC"
+    set $P0["ldflags"], " -fstack-protector-strong -L/usr/local/lib"
+    set $P0["lex"], "echo"
+    set $P0["libdir"], "/usr/local/lib"
+    set $P0["libexecdir"], "/usr/local/libexec"
+    set $P0["libparrot_for_makefile_only"], "$(LIBPARROT_SHARED)"
+    set $P0["libparrot_ldflags"], ""
+    set $P0["libparrot_linkflags"], "-L\"/root/repo/blib/lib\" -lparrot"
+    set $P0["libparrot_shared"], "libparrot.so.6.9.0"
+    set $P0["libparrot_shared_alias"], "libparrot.so"
+    set $P0["libparrot_soname"], "-Wl,-soname=libparrot.so.6.9.0"
+    set $P0["libparrot_static"], "libparrot.a"
+    set $P0["library_tests"], "t/compilers/pct/*.t t/compilers/pge/*.t t/compilers/pge/p5regex/*.t t/compilers/pge/perl6regex/*.t t/compilers/tge/*.t t/compilers/opsc/*.t t/compilers/data_json/*.t ext/nqp-rx/t/nqp/*.t t/dynoplibs/*.t t/dynpmc/*.t t/library/*.t t/ext/winxed/*.t t/tools/*.t t/profiling/*.t"
+    set $P0["libs"], "-ldl -lm -lpthread -lcrypt -lrt -lgmp -lreadline  -lffi "
+    set $P0["link"], "x86_64-linux-gnu-gcc"
+    set $P0["link_debug"], ""
+    set $P0["link_dynamic"], "-Wl,-E"
+    set $P0["linkflags"], " -fstack-protector-strong -L/usr/local/lib -Wl,-E "
+    set $P0["lns"], "ln -s"
+    set $P0["load_ext"], ".so"
+    set $P0["localstatedir"], "/usr/local/var"
+    set $P0["longdoublesize"], "16"
+    set $P0["longlongsize"], "8"
+    set $P0["longsize"], "8"
+    set $P0["MAJOR"], "6"
+    set $P0["make"], "gmake"
+    set $P0["make_and"], "&&"
+    set $P0["make_c"], "+gmake -C"
+    set $P0["make_set_make"], "#"
+    set $P0["malloc_header"], $S2
+    set $P0["mandir"], "/usr/local/man"
+    set $P0["memalign"], "posix_memalign"
+    set $P0["MINOR"], "9"
+    set $P0["mkpath"], "$(PERL) -MExtUtils::Command -e mkpath"
+    set $P0["msvcversion"], $S2
+    set $P0["mv"], "$(PERL) -MExtUtils::Command -e mv"
+    set $P0["ncilib_link_extra"], ""
+    set $P0["new_perldoc"], "0"
+    set $P0["no_lines_flag"], ""
+    set $P0["noinline"], "__attribute__ ((noinline))"
+    set $P0["numvalsize"], "8"
+    set $P0["nv"], "double"
+    set $P0["nvsize"], "8"
+    set $P0["o"], ".o"
+    set $P0["oldincludedir"], "/usr/include"
+    set $P0["opcode_t"], "long"
+    set $P0["opcodesize"], "8"
+    set $P0["opengl_lib"], ""
+    set $P0["ops"], "src/ops/core.ops src/ops/bit.ops src/ops/cmp.ops src/ops/experimental.ops src/ops/io.ops src/ops/math.ops src/ops/object.ops src/ops/pmc.ops src/ops/set.ops src/ops/string.ops src/ops/sys.ops src/ops/var.ops"
+    set $P0["ops2c"], "parrot-ops2c"
+    set $P0["optimize"], ""
+    set $P0["osname"], "linux"
+    set $P0["osvers"], "6.18.44-fc-v139"
+    set $P0["PARROT_HAS_DLINFO"], "1"
+    set $P0["parrot_is_shared"], "1"
+    set $P0["PATCH"], "0"
+    set $P0["perl"], "/usr/bin/perl"
+    set $P0["perldoc"], "echo"
+    set $P0["platform"], "generic"
+    set $P0["platform_asm"], "0"
+    set $P0["pmc"], "default.pmc null.pmc env.pmc key.pmc unmanagedstruct.pmc managedstruct.pmc exception.pmc parrotlibrary.pmc parrotinterpreter.pmc lexpad.pmc timer.pmc pointer.pmc sub.pmc continuation.pmc coroutine.pmc nci.pmc float.pmc integer.pmc bigint.pmc bignum.pmc complex.pmc string.pmc boolean.pmc fixedintegerarray.pmc iterator.pmc fixedstringarray.pmc hash.pmc orderedhash.pmc oplib.pmc opcode.pmc callcontext.pmc addrregistry.pmc alarm.pmc arrayiterator.pmc bytebuffer.pmc callback.pmc capture.pmc channel.pmc class.pmc eventhandler.pmc exceptionhandler.pmc exporter.pmc filehandle.pmc fixedbooleanarray.pmc fixedfloatarray.pmc fixedpmcarray.pmc handle.pmc hashiterator.pmc hashiteratorkey.pmc imageiofreeze.pmc imageiosize.pmc imageiostrings.pmc imageiothaw.pmc imccompiler.pmc lexinfo.pmc mappedbytearray.pmc multisub.pmc namespace.pmc nativepccmethod.pmc object.pmc orderedhashiterator.pmc os.pmc packfile.pmc packfileannotation.pmc packfileannotations.pmc packfilebytecodesegment.pmc packfileconstanttable.pmc packfiledebug.pmc packfiledirectory.pmc packfileopmap.pmc packfilerawsegment.pmc packfilesegment.pmc packfileview.pmc pmclist.pmc pmcproxy.pmc proxy.pmc ptr.pmc ptrbuf.pmc ptrobj.pmc resizablebooleanarray.pmc resizablefloatarray.pmc resizableintegerarray.pmc resizablepmcarray.pmc resizablestringarray.pmc role.pmc scalar.pmc scheduler.pmc schedulermessage.pmc sockaddr.pmc socket.pmc stringbuilder.pmc stringhandle.pmc stringiterator.pmc structview.pmc task.pmc undef.pmc"
+    set $P0["pmc_names"], "default Null Env Key UnManagedStruct ManagedStruct Exception ParrotLibrary ParrotInterpreter LexPad Timer Pointer Sub Coroutine EventHandler Continuation ExceptionHandler NCI BigInt BigNum Complex FixedIntegerArray ResizableIntegerArray Iterator ArrayIterator HashIterator OrderedHashIterator StringIterator FixedStringArray ResizableStringArray Hash LexInfo NameSpace OrderedHash OpLib Opcode CallContext AddrRegistry Alarm ByteBuffer Capture Channel Class PMCProxy Exporter FixedBooleanArray ResizableBooleanArray FixedFloatArray ResizableFloatArray FixedPMCArray ResizablePMCArray MultiSub Handle FileHandle Socket StringHandle HashIteratorKey ImageIOFreeze ImageIOSize ImageIOStrings ImageIOThaw IMCCompiler MappedByteArray NativePCCMethod Object OS Packfile PackfileAnnotation PackfileOpMap PackfileSegment PackfileAnnotations PackfileConstantTable PackfileDirectory PackfileRawSegment PackfileBytecodeSegment PackfileDebug PackfileView PMCList Proxy Ptr PtrBuf PtrObj Role scalar Float Integer String Boolean Scheduler SchedulerMessage Sockaddr StringBuilder StructView Task Callback Undef"
+    set $P0["pod2man"], "/usr/bin/pod2man"
+    set $P0["PQ"], "'"
+    set $P0["prefix"], "/usr/local"
+    set $P0["ptrcast"], "unsigned long"
+    set $P0["ptrsize"], "8"
+    set $P0["ranlib"], ":"
+    set $P0["readline"], "define"
+    set $P0["rm_f"], "$(PERL) -MExtUtils::Command -e rm_f"
+    set $P0["rm_rf"], "$(PERL) -MExtUtils::Command -e rm_rf"
+    set $P0["rpath"], "-Wl,-rpath="
+    set $P0["rpath_blib"], "\"-Wl,-rpath=/root/repo/blib/lib\""
+    set $P0["rpath_lib"], "-Wl,-rpath=\"/usr/local/lib\""
+    set $P0["runcore_tests"], "t/compilers/imcc/*/*.t t/op/*.t t/pmc/*.t t/oo/*.t t/pir/*.t t/native_pbc/*.t"
+    set $P0["sbindir"], "/usr/local/sbin"
+    set $P0["setenv"], "1"
+    set $P0["share_ext"], ".so"
+    set $P0["sharedstatedir"], "/usr/local/com"
+    set $P0["shortsize"], "2"
+    set $P0["slash"], "/"
+    set $P0["srcdir"], "/usr/local/src"
+    set $P0["sym_export"], "__attribute__ ((visibility(\"default\")))"
+    set $P0["sym_import"], ""
+    set $P0["sysconfdir"], "/usr/local/etc"
+    set $P0["tar"], "/usr/bin/tar"
+    set $P0["tempdir"], "/tmp"
+    set $P0["test_prog"], "parrot"
+    set $P0["touch"], "$(PERL) -MExtUtils::Command -e touch"
+    set $P0["uintvalfmt"], "%lu"
+    set $P0["unsetenv"], "1"
+    set $P0["va_ptr_type"], "register"
+    set $P0["verbose"], $S2
+    set $P0["VERSION"], "6.9.0"
+    set $P0["versiondir"], "/parrot/6.9.0-devel"
+    set $P0["yacc"], "echo"
+
+    if $I11, is_install
+    set $S1, "/root/repo"
+    set $P0["prefix"], $S1
+    set $P0["installed"], "0"
+    branch freeze_config
+is_install:
+    set $P0["installed"], "1"
+    delete $P0["ccwarn::src/spf_render.c"]
+    delete $P0["developing_tests"]
+    delete $P0["ccwarn::compilers/imcc/imcparser.c"]
+    delete $P0["ccwarn::compilers/imcc/optimizer.c"]
+    delete $P0["ccwarn::src/string/spf_render.c"]
+    delete $P0["runcore_tests"]
+    delete $P0["ccwarn::src/ops/core_ops.c"]
+    delete $P0["configure_tests"]
+    delete $P0["core_tests"]
+    delete $P0["ccwarn::compilers/imcc/imclexer.c"]
+    delete $P0["coveragedir"]
+    delete $P0["ccwarn::src/nci/extra_thunks.c"]
+    delete $P0["library_tests"]
+    delete $P0["ccwarn::src/extra_nci_thunks.c"]
+    delete $P0["ccwarn::src/string/sprintf.c"]
+
+freeze_config:
+    freeze $S0, $P0
+    print $S0
+.end
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
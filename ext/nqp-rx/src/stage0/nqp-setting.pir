@@ -0,0 +1,1585 @@
+
+.namespace []
+.sub "_block1000"  :anon :subid("10_1792415667.6691")
+.annotate 'file', "ext/nqp-rx/src/stage0/nqp-setting.nqp"
+.annotate 'line', 0
+    .const 'Sub' $P1205 = "48_1792415667.6691" 
+    capture_lex $P1205
+    .const 'Sub' $P1199 = "47_1792415667.6691" 
+    capture_lex $P1199
+    .const 'Sub' $P1188 = "45_1792415667.6691" 
+    capture_lex $P1188
+    .const 'Sub' $P1165 = "41_1792415667.6691" 
+    capture_lex $P1165
+    .const 'Sub' $P1143 = "39_1792415667.6691" 
+    capture_lex $P1143
+    .const 'Sub' $P1130 = "37_1792415667.6691" 
+    capture_lex $P1130
+    .const 'Sub' $P1126 = "36_1792415667.6691" 
+    capture_lex $P1126
+    .const 'Sub' $P1088 = "27_1792415667.6691" 
+    capture_lex $P1088
+    .const 'Sub' $P1083 = "26_1792415667.6691" 
+    capture_lex $P1083
+    .const 'Sub' $P1078 = "25_1792415667.6691" 
+    capture_lex $P1078
+    .const 'Sub' $P1073 = "24_1792415667.6691" 
+    capture_lex $P1073
+    .const 'Sub' $P1068 = "23_1792415667.6691" 
+    capture_lex $P1068
+    .const 'Sub' $P1024 = "13_1792415667.6691" 
+    capture_lex $P1024
+    .const 'Sub' $P1018 = "12_1792415667.6691" 
+    capture_lex $P1018
+    .const 'Sub' $P1003 = "11_1792415667.6691" 
+    capture_lex $P1003
+.annotate 'line', 279
+    .const 'Sub' $P1003 = "11_1792415667.6691" 
+    newclosure $P1016, $P1003
+    set $P1002, $P1016
+    .lex "open", $P1002
+.annotate 'line', 291
+    .const 'Sub' $P1018 = "12_1792415667.6691" 
+    newclosure $P1022, $P1018
+    set $P1017, $P1022
+    .lex "close", $P1017
+.annotate 'line', 1
+    $P0 = find_dynamic_lex "$*CTXSAVE"
+    if null $P0 goto ctxsave_done
+    $I0 = can $P0, "ctxsave"
+    unless $I0 goto ctxsave_done
+    $P0."ctxsave"()
+  ctxsave_done:
+.annotate 'line', 18
+    .const 'Sub' $P1024 = "13_1792415667.6691" 
+    capture_lex $P1024
+    $P1024()
+.annotate 'line', 98
+    .const 'Sub' $P1088 = "27_1792415667.6691" 
+    capture_lex $P1088
+    $P1088()
+.annotate 'line', 1
+    find_lex $P110, "open"
+    find_lex $P110, "close"
+.annotate 'line', 311
+    .const 'Sub' $P1205 = "48_1792415667.6691" 
+    newclosure $P1211, $P1205
+.annotate 'line', 1
+    .return ($P1211)
+    .const 'Sub' $P1213 = "49_1792415667.6691" 
+    .return ($P1213)
+.end
+
+
+.namespace []
+.include "except_types.pasm"
+.sub "open"  :subid("11_1792415667.6691") :outer("10_1792415667.6691")
+    .param pmc param_1006
+    .param pmc param_1007 :optional :named("r")
+    .param int has_param_1007 :opt_flag
+    .param pmc param_1008 :optional :named("w")
+    .param int has_param_1008 :opt_flag
+    .param pmc param_1009 :optional :named("a")
+    .param int has_param_1009 :opt_flag
+    .param pmc param_1010 :optional :named("bin")
+    .param int has_param_1010 :opt_flag
+.annotate 'file', "ext/nqp-rx/src/stage0/nqp-setting.nqp"
+.annotate 'line', 279
+    new $P1005, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1005, control_1004
+    push_eh $P1005
+    .lex "$filename", param_1006
+    if has_param_1007, optparam_50
+    new $P100, "Undef"
+    set param_1007, $P100
+  optparam_50:
+    .lex "$r", param_1007
+    if has_param_1008, optparam_51
+    new $P101, "Undef"
+    set param_1008, $P101
+  optparam_51:
+    .lex "$w", param_1008
+    if has_param_1009, optparam_52
+    new $P102, "Undef"
+    set param_1009, $P102
+  optparam_52:
+    .lex "$a", param_1009
+    if has_param_1010, optparam_53
+    new $P103, "Undef"
+    set param_1010, $P103
+  optparam_53:
+    .lex "$bin", param_1010
+.annotate 'line', 280
+    new $P104, "Undef"
+    set $P1011, $P104
+    .lex "$mode", $P1011
+.annotate 'line', 281
+    new $P105, "Undef"
+    set $P1012, $P105
+    .lex "$handle", $P1012
+.annotate 'line', 280
+    find_lex $P107, "$w"
+    if $P107, if_1013
+    find_lex $P110, "$a"
+    if $P110, if_1014
+    new $P112, "String"
+    assign $P112, "r"
+    set $P109, $P112
+    goto if_1014_end
+  if_1014:
+    new $P111, "String"
+    assign $P111, "wa"
+    set $P109, $P111
+  if_1014_end:
+    set $P106, $P109
+    goto if_1013_end
+  if_1013:
+    new $P108, "String"
+    assign $P108, "w"
+    set $P106, $P108
+  if_1013_end:
+    store_lex "$mode", $P106
+.annotate 'line', 281
+    new $P106, "FileHandle"
+    store_lex "$handle", $P106
+.annotate 'line', 282
+    find_lex $P106, "$handle"
+    find_lex $P107, "$filename"
+    find_lex $P108, "$mode"
+    $P106."open"($P107, $P108)
+.annotate 'line', 283
+    find_lex $P106, "$handle"
+    find_lex $P108, "$bin"
+    if $P108, if_1015
+    new $P110, "String"
+    assign $P110, "utf8"
+    set $P107, $P110
+    goto if_1015_end
+  if_1015:
+    new $P109, "String"
+    assign $P109, "binary"
+    set $P107, $P109
+  if_1015_end:
+    $P106."encoding"($P107)
+.annotate 'line', 279
+    find_lex $P106, "$handle"
+    .return ($P106)
+  control_1004:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P107, exception, "payload"
+    .return ($P107)
+.end
+
+
+.namespace []
+.include "except_types.pasm"
+.sub "close"  :subid("12_1792415667.6691") :outer("10_1792415667.6691")
+    .param pmc param_1021
+.annotate 'file', "ext/nqp-rx/src/stage0/nqp-setting.nqp"
+.annotate 'line', 291
+    new $P1020, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1020, control_1019
+    push_eh $P1020
+    .lex "$handle", param_1021
+.annotate 'line', 292
+    find_lex $P108, "$handle"
+    $P109 = $P108."close"()
+.annotate 'line', 291
+    .return ($P109)
+  control_1019:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P108, exception, "payload"
+    .return ($P108)
+.end
+
+
+.namespace ["ResizablePMCArray"]
+.sub "_block1023"  :subid("13_1792415667.6691") :outer("10_1792415667.6691")
+.annotate 'file', "ext/nqp-rx/src/stage0/nqp-setting.nqp"
+.annotate 'line', 18
+    .const 'Sub' $P1058 = "21_1792415667.6691" 
+    capture_lex $P1058
+    .const 'Sub' $P1047 = "19_1792415667.6691" 
+    capture_lex $P1047
+    .const 'Sub' $P1037 = "17_1792415667.6691" 
+    capture_lex $P1037
+    .const 'Sub' $P1033 = "16_1792415667.6691" 
+    capture_lex $P1033
+    .const 'Sub' $P1029 = "15_1792415667.6691" 
+    capture_lex $P1029
+    .const 'Sub' $P1025 = "14_1792415667.6691" 
+    capture_lex $P1025
+.annotate 'line', 71
+    .const 'Sub' $P1058 = "21_1792415667.6691" 
+    newclosure $P1067, $P1058
+.annotate 'line', 18
+    .return ($P1067)
+.end
+
+
+.namespace ["ResizablePMCArray"]
+.include "except_types.pasm"
+.sub "delete"  :subid("14_1792415667.6691") :method :outer("13_1792415667.6691")
+    .param pmc param_1028
+.annotate 'file', "ext/nqp-rx/src/stage0/nqp-setting.nqp"
+.annotate 'line', 24
+    new $P1027, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1027, control_1026
+    push_eh $P1027
+    .lex "self", self
+    .lex "$pos", param_1028
+.annotate 'line', 25
+    find_lex $P111, "$pos"
+    find_lex $P110, "self"
+    delete $P110[$P111]
+.annotate 'line', 24
+    .return ()
+  control_1026:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P110, exception, "payload"
+    .return ($P110)
+.end
+
+
+.namespace ["ResizablePMCArray"]
+.include "except_types.pasm"
+.sub "exists"  :subid("15_1792415667.6691") :method :outer("13_1792415667.6691")
+    .param pmc param_1032
+.annotate 'file', "ext/nqp-rx/src/stage0/nqp-setting.nqp"
+.annotate 'line', 32
+    new $P1031, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1031, control_1030
+    push_eh $P1031
+    .lex "self", self
+    .lex "$pos", param_1032
+.annotate 'line', 33
+    find_lex $P111, "$pos"
+    find_lex $P110, "self"
+    exists $I100, $P110[$P111]
+.annotate 'line', 32
+    .return ($I100)
+  control_1030:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P110, exception, "payload"
+    .return ($P110)
+.end
+
+
+.namespace ["ResizablePMCArray"]
+.include "except_types.pasm"
+.sub "join"  :subid("16_1792415667.6691") :method :outer("13_1792415667.6691")
+    .param pmc param_1036 :optional
+    .param int has_param_1036 :opt_flag
+.annotate 'file', "ext/nqp-rx/src/stage0/nqp-setting.nqp"
+.annotate 'line', 40
+    new $P1035, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1035, control_1034
+    push_eh $P1035
+    .lex "self", self
+    if has_param_1036, optparam_54
+    new $P110, "String"
+    assign $P110, ""
+    set param_1036, $P110
+  optparam_54:
+    .lex "$separator", param_1036
+.annotate 'line', 41
+    find_lex $P111, "$separator"
+    set $S100, $P111
+    find_lex $P112, "self"
+    join $S101, $S100, $P112
+.annotate 'line', 40
+    .return ($S101)
+  control_1034:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P111, exception, "payload"
+    .return ($P111)
+.end
+
+
+.namespace ["ResizablePMCArray"]
+.include "except_types.pasm"
+.sub "map"  :subid("17_1792415667.6691") :method :outer("13_1792415667.6691")
+    .param pmc param_1040
+.annotate 'file', "ext/nqp-rx/src/stage0/nqp-setting.nqp"
+.annotate 'line', 51
+    .const 'Sub' $P1044 = "18_1792415667.6691" 
+    capture_lex $P1044
+    new $P1039, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1039, control_1038
+    push_eh $P1039
+    .lex "self", self
+    .lex "&code", param_1040
+.annotate 'line', 52
+    $P1042 = root_new ['parrot';'ResizablePMCArray']
+    set $P1041, $P1042
+    .lex "@mapped", $P1041
+.annotate 'line', 51
+    find_lex $P110, "@mapped"
+.annotate 'line', 53
+    find_lex $P111, "self"
+    defined $I100, $P111
+    unless $I100, for_undef_55
+    iter $P110, $P111
+    new $P113, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P113, loop1046_handler
+    push_eh $P113
+  loop1046_test:
+    unless $P110, loop1046_done
+    shift $P112, $P110
+  loop1046_redo:
+    .const 'Sub' $P1044 = "18_1792415667.6691" 
+    capture_lex $P1044
+    $P1044($P112)
+  loop1046_next:
+    goto loop1046_test
+  loop1046_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P114, exception, 'type'
+    eq $P114, .CONTROL_LOOP_NEXT, loop1046_next
+    eq $P114, .CONTROL_LOOP_REDO, loop1046_redo
+  loop1046_done:
+    pop_eh 
+  for_undef_55:
+.annotate 'line', 51
+    find_lex $P110, "@mapped"
+    .return ($P110)
+  control_1038:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P111, exception, "payload"
+    .return ($P111)
+.end
+
+
+.namespace ["ResizablePMCArray"]
+.sub "_block1043"  :anon :subid("18_1792415667.6691") :outer("17_1792415667.6691")
+    .param pmc param_1045
+.annotate 'file', "ext/nqp-rx/src/stage0/nqp-setting.nqp"
+.annotate 'line', 53
+    .lex "$_", param_1045
+    find_lex $P113, "@mapped"
+    find_lex $P114, "&code"
+    find_lex $P115, "$_"
+    $P116 = $P114($P115)
+    $P117 = $P113."push"($P116)
+    .return ($P117)
+.end
+
+
+.namespace ["ResizablePMCArray"]
+.include "except_types.pasm"
+.sub "grep"  :subid("19_1792415667.6691") :method :outer("13_1792415667.6691")
+    .param pmc param_1050
+.annotate 'file', "ext/nqp-rx/src/stage0/nqp-setting.nqp"
+.annotate 'line', 61
+    .const 'Sub' $P1054 = "20_1792415667.6691" 
+    capture_lex $P1054
+    new $P1049, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1049, control_1048
+    push_eh $P1049
+    .lex "self", self
+    .lex "&code", param_1050
+.annotate 'line', 62
+    $P1052 = root_new ['parrot';'ResizablePMCArray']
+    set $P1051, $P1052
+    .lex "@grepped", $P1051
+.annotate 'line', 61
+    find_lex $P110, "@grepped"
+.annotate 'line', 63
+    find_lex $P111, "self"
+    defined $I100, $P111
+    unless $I100, for_undef_56
+    iter $P110, $P111
+    new $P114, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P114, loop1057_handler
+    push_eh $P114
+  loop1057_test:
+    unless $P110, loop1057_done
+    shift $P112, $P110
+  loop1057_redo:
+    .const 'Sub' $P1054 = "20_1792415667.6691" 
+    capture_lex $P1054
+    $P1054($P112)
+  loop1057_next:
+    goto loop1057_test
+  loop1057_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P115, exception, 'type'
+    eq $P115, .CONTROL_LOOP_NEXT, loop1057_next
+    eq $P115, .CONTROL_LOOP_REDO, loop1057_redo
+  loop1057_done:
+    pop_eh 
+  for_undef_56:
+.annotate 'line', 61
+    find_lex $P110, "@grepped"
+    .return ($P110)
+  control_1048:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P111, exception, "payload"
+    .return ($P111)
+.end
+
+
+.namespace ["ResizablePMCArray"]
+.sub "_block1053"  :anon :subid("20_1792415667.6691") :outer("19_1792415667.6691")
+    .param pmc param_1055
+.annotate 'file', "ext/nqp-rx/src/stage0/nqp-setting.nqp"
+.annotate 'line', 63
+    .lex "$_", param_1055
+    find_lex $P114, "&code"
+    find_lex $P115, "$_"
+    $P116 = $P114($P115)
+    if $P116, if_1056
+    set $P113, $P116
+    goto if_1056_end
+  if_1056:
+    find_lex $P117, "@grepped"
+    find_lex $P118, "$_"
+    $P119 = $P117."push"($P118)
+    set $P113, $P119
+  if_1056_end:
+    .return ($P113)
+.end
+
+
+.namespace ["ResizablePMCArray"]
+.include "except_types.pasm"
+.sub "reverse"  :subid("21_1792415667.6691") :method :outer("13_1792415667.6691")
+.annotate 'file', "ext/nqp-rx/src/stage0/nqp-setting.nqp"
+.annotate 'line', 71
+    .const 'Sub' $P1064 = "22_1792415667.6691" 
+    capture_lex $P1064
+    new $P1060, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1060, control_1059
+    push_eh $P1060
+    .lex "self", self
+.annotate 'line', 72
+    $P1062 = root_new ['parrot';'ResizablePMCArray']
+    set $P1061, $P1062
+    .lex "@reversed", $P1061
+.annotate 'line', 71
+    find_lex $P110, "@reversed"
+.annotate 'line', 73
+    find_lex $P111, "self"
+    defined $I100, $P111
+    unless $I100, for_undef_57
+    iter $P110, $P111
+    new $P113, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P113, loop1066_handler
+    push_eh $P113
+  loop1066_test:
+    unless $P110, loop1066_done
+    shift $P112, $P110
+  loop1066_redo:
+    .const 'Sub' $P1064 = "22_1792415667.6691" 
+    capture_lex $P1064
+    $P1064($P112)
+  loop1066_next:
+    goto loop1066_test
+  loop1066_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P114, exception, 'type'
+    eq $P114, .CONTROL_LOOP_NEXT, loop1066_next
+    eq $P114, .CONTROL_LOOP_REDO, loop1066_redo
+  loop1066_done:
+    pop_eh 
+  for_undef_57:
+.annotate 'line', 71
+    find_lex $P110, "@reversed"
+    .return ($P110)
+  control_1059:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P111, exception, "payload"
+    .return ($P111)
+.end
+
+
+.namespace ["ResizablePMCArray"]
+.sub "_block1063"  :anon :subid("22_1792415667.6691") :outer("21_1792415667.6691")
+    .param pmc param_1065
+.annotate 'file', "ext/nqp-rx/src/stage0/nqp-setting.nqp"
+.annotate 'line', 73
+    .lex "$_", param_1065
+    find_lex $P113, "@reversed"
+    find_lex $P114, "$_"
+    $P115 = $P113."unshift"($P114)
+    .return ($P115)
+.end
+
+
+.namespace []
+.include "except_types.pasm"
+.sub "join"  :subid("23_1792415667.6691") :outer("10_1792415667.6691")
+    .param pmc param_1071
+    .param pmc param_1072 :slurpy
+.annotate 'file', "ext/nqp-rx/src/stage0/nqp-setting.nqp"
+.annotate 'line', 79
+    new $P1070, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1070, control_1069
+    push_eh $P1070
+    .lex "$separator", param_1071
+    .lex "@values", param_1072
+    find_lex $P110, "@values"
+    find_lex $P111, "$separator"
+    $P112 = $P110."join"($P111)
+    .return ($P112)
+  control_1069:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P110, exception, "payload"
+    .return ($P110)
+.end
+
+
+.namespace []
+.include "except_types.pasm"
+.sub "map"  :subid("24_1792415667.6691") :outer("10_1792415667.6691")
+    .param pmc param_1076
+    .param pmc param_1077 :slurpy
+.annotate 'file', "ext/nqp-rx/src/stage0/nqp-setting.nqp"
+.annotate 'line', 80
+    new $P1075, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1075, control_1074
+    push_eh $P1075
+    .lex "&code", param_1076
+    .lex "@values", param_1077
+    find_lex $P110, "@values"
+    find_lex $P111, "&code"
+    $P112 = $P110."map"($P111)
+    .return ($P112)
+  control_1074:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P110, exception, "payload"
+    .return ($P110)
+.end
+
+
+.namespace []
+.include "except_types.pasm"
+.sub "grep"  :subid("25_1792415667.6691") :outer("10_1792415667.6691")
+    .param pmc param_1081
+    .param pmc param_1082 :slurpy
+.annotate 'file', "ext/nqp-rx/src/stage0/nqp-setting.nqp"
+.annotate 'line', 81
+    new $P1080, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1080, control_1079
+    push_eh $P1080
+    .lex "&code", param_1081
+    .lex "@values", param_1082
+    find_lex $P110, "@values"
+    find_lex $P111, "&code"
+    $P112 = $P110."grep"($P111)
+    .return ($P112)
+  control_1079:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P110, exception, "payload"
+    .return ($P110)
+.end
+
+
+.namespace []
+.include "except_types.pasm"
+.sub "list"  :subid("26_1792415667.6691") :outer("10_1792415667.6691")
+    .param pmc param_1086 :slurpy
+.annotate 'file', "ext/nqp-rx/src/stage0/nqp-setting.nqp"
+.annotate 'line', 82
+    new $P1085, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1085, control_1084
+    push_eh $P1085
+    .lex "@values", param_1086
+    find_lex $P110, "@values"
+    .return ($P110)
+  control_1084:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P111, exception, "payload"
+    .return ($P111)
+.end
+
+
+.namespace ["Hash"]
+.sub "_block1087"  :subid("27_1792415667.6691") :outer("10_1792415667.6691")
+.annotate 'file', "ext/nqp-rx/src/stage0/nqp-setting.nqp"
+.annotate 'line', 98
+    .const 'Sub' $P1116 = "34_1792415667.6691" 
+    capture_lex $P1116
+    .const 'Sub' $P1107 = "32_1792415667.6691" 
+    capture_lex $P1107
+    .const 'Sub' $P1098 = "30_1792415667.6691" 
+    capture_lex $P1098
+    .const 'Sub' $P1093 = "29_1792415667.6691" 
+    capture_lex $P1093
+    .const 'Sub' $P1089 = "28_1792415667.6691" 
+    capture_lex $P1089
+.annotate 'line', 151
+    .const 'Sub' $P1116 = "34_1792415667.6691" 
+    newclosure $P1125, $P1116
+.annotate 'line', 98
+    .return ($P1125)
+.end
+
+
+.namespace ["Hash"]
+.include "except_types.pasm"
+.sub "delete"  :subid("28_1792415667.6691") :method :outer("27_1792415667.6691")
+    .param pmc param_1092
+.annotate 'file', "ext/nqp-rx/src/stage0/nqp-setting.nqp"
+.annotate 'line', 104
+    new $P1091, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1091, control_1090
+    push_eh $P1091
+    .lex "self", self
+    .lex "$key", param_1092
+.annotate 'line', 105
+
+            $P1 = find_lex '$key'
+            delete self[$P1]
+        
+.annotate 'line', 104
+    .return ()
+  control_1090:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P110, exception, "payload"
+    .return ($P110)
+.end
+
+
+.namespace ["Hash"]
+.include "except_types.pasm"
+.sub "exists"  :subid("29_1792415667.6691") :method :outer("27_1792415667.6691")
+    .param pmc param_1096
+.annotate 'file', "ext/nqp-rx/src/stage0/nqp-setting.nqp"
+.annotate 'line', 116
+    new $P1095, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1095, control_1094
+    push_eh $P1095
+    .lex "self", self
+    .lex "$key", param_1096
+.annotate 'line', 117
+
+            $P1 = find_lex '$key'
+            $I0 = exists self[$P1]
+            $P1097  = box $I0
+        
+.annotate 'line', 116
+    .return ($P1097)
+  control_1094:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P110, exception, "payload"
+    .return ($P110)
+.end
+
+
+.namespace ["Hash"]
+.include "except_types.pasm"
+.sub "keys"  :subid("30_1792415667.6691") :method :outer("27_1792415667.6691")
+.annotate 'file', "ext/nqp-rx/src/stage0/nqp-setting.nqp"
+.annotate 'line', 129
+    .const 'Sub' $P1104 = "31_1792415667.6691" 
+    capture_lex $P1104
+    new $P1100, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1100, control_1099
+    push_eh $P1100
+    .lex "self", self
+.annotate 'line', 130
+    $P1102 = root_new ['parrot';'ResizablePMCArray']
+    set $P1101, $P1102
+    .lex "@keys", $P1101
+.annotate 'line', 129
+    find_lex $P110, "@keys"
+.annotate 'line', 131
+    find_lex $P111, "self"
+    defined $I100, $P111
+    unless $I100, for_undef_58
+    iter $P110, $P111
+    new $P113, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P113, loop1106_handler
+    push_eh $P113
+  loop1106_test:
+    unless $P110, loop1106_done
+    shift $P112, $P110
+  loop1106_redo:
+    .const 'Sub' $P1104 = "31_1792415667.6691" 
+    capture_lex $P1104
+    $P1104($P112)
+  loop1106_next:
+    goto loop1106_test
+  loop1106_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P114, exception, 'type'
+    eq $P114, .CONTROL_LOOP_NEXT, loop1106_next
+    eq $P114, .CONTROL_LOOP_REDO, loop1106_redo
+  loop1106_done:
+    pop_eh 
+  for_undef_58:
+.annotate 'line', 129
+    find_lex $P110, "@keys"
+    .return ($P110)
+  control_1099:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P111, exception, "payload"
+    .return ($P111)
+.end
+
+
+.namespace ["Hash"]
+.sub "_block1103"  :anon :subid("31_1792415667.6691") :outer("30_1792415667.6691")
+    .param pmc param_1105
+.annotate 'file', "ext/nqp-rx/src/stage0/nqp-setting.nqp"
+.annotate 'line', 131
+    .lex "$_", param_1105
+    find_lex $P113, "@keys"
+    find_lex $P114, "$_"
+    $P115 = $P114."key"()
+    $P116 = $P113."push"($P115)
+    .return ($P116)
+.end
+
+
+.namespace ["Hash"]
+.include "except_types.pasm"
+.sub "kv"  :subid("32_1792415667.6691") :method :outer("27_1792415667.6691")
+.annotate 'file', "ext/nqp-rx/src/stage0/nqp-setting.nqp"
+.annotate 'line', 140
+    .const 'Sub' $P1113 = "33_1792415667.6691" 
+    capture_lex $P1113
+    new $P1109, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1109, control_1108
+    push_eh $P1109
+    .lex "self", self
+.annotate 'line', 141
+    $P1111 = root_new ['parrot';'ResizablePMCArray']
+    set $P1110, $P1111
+    .lex "@kv", $P1110
+.annotate 'line', 140
+    find_lex $P110, "@kv"
+.annotate 'line', 142
+    find_lex $P111, "self"
+    defined $I100, $P111
+    unless $I100, for_undef_59
+    iter $P110, $P111
+    new $P113, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P113, loop1115_handler
+    push_eh $P113
+  loop1115_test:
+    unless $P110, loop1115_done
+    shift $P112, $P110
+  loop1115_redo:
+    .const 'Sub' $P1113 = "33_1792415667.6691" 
+    capture_lex $P1113
+    $P1113($P112)
+  loop1115_next:
+    goto loop1115_test
+  loop1115_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P114, exception, 'type'
+    eq $P114, .CONTROL_LOOP_NEXT, loop1115_next
+    eq $P114, .CONTROL_LOOP_REDO, loop1115_redo
+  loop1115_done:
+    pop_eh 
+  for_undef_59:
+.annotate 'line', 140
+    find_lex $P110, "@kv"
+    .return ($P110)
+  control_1108:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P111, exception, "payload"
+    .return ($P111)
+.end
+
+
+.namespace ["Hash"]
+.sub "_block1112"  :anon :subid("33_1792415667.6691") :outer("32_1792415667.6691")
+    .param pmc param_1114
+.annotate 'file', "ext/nqp-rx/src/stage0/nqp-setting.nqp"
+.annotate 'line', 142
+    .lex "$_", param_1114
+    find_lex $P113, "@kv"
+    find_lex $P114, "$_"
+    $P115 = $P114."key"()
+    $P113."push"($P115)
+    find_lex $P113, "@kv"
+    find_lex $P114, "$_"
+    $P115 = $P114."value"()
+    $P116 = $P113."push"($P115)
+    .return ($P116)
+.end
+
+
+.namespace ["Hash"]
+.include "except_types.pasm"
+.sub "values"  :subid("34_1792415667.6691") :method :outer("27_1792415667.6691")
+.annotate 'file', "ext/nqp-rx/src/stage0/nqp-setting.nqp"
+.annotate 'line', 151
+    .const 'Sub' $P1122 = "35_1792415667.6691" 
+    capture_lex $P1122
+    new $P1118, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1118, control_1117
+    push_eh $P1118
+    .lex "self", self
+.annotate 'line', 152
+    $P1120 = root_new ['parrot';'ResizablePMCArray']
+    set $P1119, $P1120
+    .lex "@values", $P1119
+.annotate 'line', 151
+    find_lex $P110, "@values"
+.annotate 'line', 153
+    find_lex $P111, "self"
+    defined $I100, $P111
+    unless $I100, for_undef_60
+    iter $P110, $P111
+    new $P113, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P113, loop1124_handler
+    push_eh $P113
+  loop1124_test:
+    unless $P110, loop1124_done
+    shift $P112, $P110
+  loop1124_redo:
+    .const 'Sub' $P1122 = "35_1792415667.6691" 
+    capture_lex $P1122
+    $P1122($P112)
+  loop1124_next:
+    goto loop1124_test
+  loop1124_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P114, exception, 'type'
+    eq $P114, .CONTROL_LOOP_NEXT, loop1124_next
+    eq $P114, .CONTROL_LOOP_REDO, loop1124_redo
+  loop1124_done:
+    pop_eh 
+  for_undef_60:
+.annotate 'line', 151
+    find_lex $P110, "@values"
+    .return ($P110)
+  control_1117:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P111, exception, "payload"
+    .return ($P111)
+.end
+
+
+.namespace ["Hash"]
+.sub "_block1121"  :anon :subid("35_1792415667.6691") :outer("34_1792415667.6691")
+    .param pmc param_1123
+.annotate 'file', "ext/nqp-rx/src/stage0/nqp-setting.nqp"
+.annotate 'line', 153
+    .lex "$_", param_1123
+    find_lex $P113, "@values"
+    find_lex $P114, "$_"
+    $P115 = $P114."value"()
+    $P116 = $P113."push"($P115)
+    .return ($P116)
+.end
+
+
+.namespace []
+.include "except_types.pasm"
+.sub "hash"  :subid("36_1792415667.6691") :outer("10_1792415667.6691")
+    .param pmc param_1129 :slurpy :named
+.annotate 'file', "ext/nqp-rx/src/stage0/nqp-setting.nqp"
+.annotate 'line', 164
+    new $P1128, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1128, control_1127
+    push_eh $P1128
+    .lex "%h", param_1129
+    find_lex $P110, "%h"
+    .return ($P110)
+  control_1127:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P111, exception, "payload"
+    .return ($P111)
+.end
+
+
+.namespace []
+.include "except_types.pasm"
+.sub "match"  :subid("37_1792415667.6691") :outer("10_1792415667.6691")
+    .param pmc param_1133
+    .param pmc param_1134
+    .param pmc param_1135 :optional :named("global")
+    .param int has_param_1135 :opt_flag
+.annotate 'file', "ext/nqp-rx/src/stage0/nqp-setting.nqp"
+.annotate 'line', 182
+    .const 'Sub' $P1139 = "38_1792415667.6691" 
+    capture_lex $P1139
+    new $P1132, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1132, control_1131
+    push_eh $P1132
+    .lex "$text", param_1133
+    .lex "$regex", param_1134
+    if has_param_1135, optparam_61
+    new $P110, "Undef"
+    set param_1135, $P110
+  optparam_61:
+    .lex "$global", param_1135
+.annotate 'line', 183
+    new $P111, "Undef"
+    set $P1136, $P111
+    .lex "$match", $P1136
+    find_lex $P112, "$regex"
+    find_lex $P113, "$text"
+    $P114 = $P112."ACCEPTS"($P113)
+    store_lex "$match", $P114
+.annotate 'line', 184
+    find_lex $P113, "$global"
+    if $P113, if_1137
+.annotate 'line', 192
+    find_lex $P116, "$match"
+    set $P112, $P116
+.annotate 'line', 184
+    goto if_1137_end
+  if_1137:
+    .const 'Sub' $P1139 = "38_1792415667.6691" 
+    capture_lex $P1139
+    $P115 = $P1139()
+    set $P112, $P115
+  if_1137_end:
+.annotate 'line', 182
+    .return ($P112)
+  control_1131:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P113, exception, "payload"
+    .return ($P113)
+.end
+
+
+.namespace []
+.include "except_types.pasm"
+.sub "_block1138"  :anon :subid("38_1792415667.6691") :outer("37_1792415667.6691")
+.annotate 'file', "ext/nqp-rx/src/stage0/nqp-setting.nqp"
+.annotate 'line', 185
+    $P1141 = root_new ['parrot';'ResizablePMCArray']
+    set $P1140, $P1141
+    .lex "@matches", $P1140
+.annotate 'line', 184
+    find_lex $P114, "@matches"
+.annotate 'line', 186
+    new $P115, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P115, loop1142_handler
+    push_eh $P115
+  loop1142_test:
+    find_lex $P114, "$match"
+    unless $P114, loop1142_done
+  loop1142_redo:
+.annotate 'line', 187
+    find_lex $P115, "@matches"
+    find_lex $P116, "$match"
+    $P115."push"($P116)
+.annotate 'line', 188
+    find_lex $P115, "$match"
+    $P116 = $P115."CURSOR"()
+    find_lex $P117, "$text"
+    find_lex $P118, "$regex"
+    find_lex $P119, "$match"
+    $P120 = $P119."to"()
+    $P121 = $P116."parse"($P117, $P118 :named("rule"), $P120 :named("c"))
+    store_lex "$match", $P121
+  loop1142_next:
+.annotate 'line', 186
+    goto loop1142_test
+  loop1142_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P116, exception, 'type'
+    eq $P116, .CONTROL_LOOP_NEXT, loop1142_next
+    eq $P116, .CONTROL_LOOP_REDO, loop1142_redo
+  loop1142_done:
+    pop_eh 
+.annotate 'line', 184
+    find_lex $P114, "@matches"
+    .return ($P114)
+.end
+
+
+.namespace []
+.include "except_types.pasm"
+.sub "subst"  :subid("39_1792415667.6691") :outer("10_1792415667.6691")
+    .param pmc param_1146
+    .param pmc param_1147
+    .param pmc param_1148
+    .param pmc param_1149 :optional :named("global")
+    .param int has_param_1149 :opt_flag
+.annotate 'file', "ext/nqp-rx/src/stage0/nqp-setting.nqp"
+.annotate 'line', 204
+    .const 'Sub' $P1158 = "40_1792415667.6691" 
+    capture_lex $P1158
+    new $P1145, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1145, control_1144
+    push_eh $P1145
+    .lex "$text", param_1146
+    .lex "$regex", param_1147
+    .lex "$repl", param_1148
+    if has_param_1149, optparam_62
+    new $P110, "Undef"
+    set param_1149, $P110
+  optparam_62:
+    .lex "$global", param_1149
+.annotate 'line', 205
+    $P1151 = root_new ['parrot';'ResizablePMCArray']
+    set $P1150, $P1151
+    .lex "@matches", $P1150
+.annotate 'line', 207
+    new $P111, "Undef"
+    set $P1152, $P111
+    .lex "$is_code", $P1152
+.annotate 'line', 208
+    new $P112, "Undef"
+    set $P1153, $P112
+    .lex "$offset", $P1153
+.annotate 'line', 209
+    new $P113, "Undef"
+    set $P1154, $P113
+    .lex "$result", $P1154
+.annotate 'line', 220
+    new $P114, "Undef"
+    set $P1155, $P114
+    .lex "$chars", $P1155
+.annotate 'line', 205
+    find_lex $P116, "$global"
+    if $P116, if_1156
+.annotate 'line', 206
+    find_lex $P120, "$regex"
+    find_lex $P121, "$text"
+    $P122 = $P120."ACCEPTS"($P121)
+    new $P123, "ResizablePMCArray"
+    push $P123, $P122
+.annotate 'line', 205
+    set $P115, $P123
+    goto if_1156_end
+  if_1156:
+    find_lex $P117, "$text"
+    find_lex $P118, "$regex"
+    $P119 = "match"($P117, $P118, 1 :named("global"))
+    set $P115, $P119
+  if_1156_end:
+    store_lex "@matches", $P115
+.annotate 'line', 207
+    find_lex $P115, "$repl"
+    isa $I100, $P115, "Sub"
+    new $P116, 'Integer'
+    set $P116, $I100
+    store_lex "$is_code", $P116
+.annotate 'line', 208
+    new $P115, "Integer"
+    assign $P115, 0
+    store_lex "$offset", $P115
+.annotate 'line', 209
+    new $P115, "StringBuilder"
+    store_lex "$result", $P115
+.annotate 'line', 211
+    find_lex $P116, "@matches"
+    defined $I100, $P116
+    unless $I100, for_undef_63
+    iter $P115, $P116
+    new $P119, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P119, loop1163_handler
+    push_eh $P119
+  loop1163_test:
+    unless $P115, loop1163_done
+    shift $P117, $P115
+  loop1163_redo:
+    .const 'Sub' $P1158 = "40_1792415667.6691" 
+    capture_lex $P1158
+    $P1158($P117)
+  loop1163_next:
+    goto loop1163_test
+  loop1163_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P120, exception, 'type'
+    eq $P120, .CONTROL_LOOP_NEXT, loop1163_next
+    eq $P120, .CONTROL_LOOP_REDO, loop1163_redo
+  loop1163_done:
+    pop_eh 
+  for_undef_63:
+.annotate 'line', 220
+    find_lex $P115, "$text"
+    set $S100, $P115
+    length $I100, $S100
+    new $P116, 'Integer'
+    set $P116, $I100
+    store_lex "$chars", $P116
+.annotate 'line', 222
+    find_lex $P115, "$chars"
+    set $N100, $P115
+    find_lex $P116, "$offset"
+    set $N101, $P116
+    isgt $I100, $N100, $N101
+    unless $I100, if_1164_end
+.annotate 'line', 221
+    find_lex $P117, "$result"
+    find_lex $P118, "$text"
+    set $S100, $P118
+    find_lex $P119, "$offset"
+    set $I101, $P119
+    find_lex $P120, "$chars"
+    set $I102, $P120
+    substr $S101, $S100, $I101, $I102
+    push $P117, $S101
+  if_1164_end:
+.annotate 'line', 224
+    find_lex $P115, "$result"
+    set $S100, $P115
+.annotate 'line', 204
+    .return ($S100)
+  control_1144:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P115, exception, "payload"
+    .return ($P115)
+.end
+
+
+.namespace []
+.sub "_block1157"  :anon :subid("40_1792415667.6691") :outer("39_1792415667.6691")
+    .param pmc param_1159
+.annotate 'file', "ext/nqp-rx/src/stage0/nqp-setting.nqp"
+.annotate 'line', 211
+    .lex "$match", param_1159
+.annotate 'line', 212
+    find_lex $P119, "$match"
+    if $P119, if_1160
+    set $P118, $P119
+    goto if_1160_end
+  if_1160:
+.annotate 'line', 214
+    find_lex $P120, "$match"
+    $N100 = $P120."from"()
+    find_lex $P121, "$offset"
+    set $N101, $P121
+    isgt $I101, $N100, $N101
+    unless $I101, if_1161_end
+.annotate 'line', 213
+    find_lex $P122, "$result"
+    find_lex $P123, "$text"
+    set $S100, $P123
+    find_lex $P124, "$offset"
+    set $I102, $P124
+    find_lex $P125, "$match"
+    $P126 = $P125."from"()
+    find_lex $P127, "$offset"
+    sub $P128, $P126, $P127
+    set $I103, $P128
+    substr $S101, $S100, $I102, $I103
+    push $P122, $S101
+  if_1161_end:
+.annotate 'line', 215
+    find_lex $P120, "$result"
+    find_lex $P122, "$is_code"
+    if $P122, if_1162
+    find_lex $P126, "$repl"
+    set $P121, $P126
+    goto if_1162_end
+  if_1162:
+    find_lex $P123, "$repl"
+    find_lex $P124, "$match"
+    $P125 = $P123($P124)
+    set $P121, $P125
+  if_1162_end:
+    push $P120, $P121
+.annotate 'line', 216
+    find_lex $P120, "$match"
+    $P121 = $P120."to"()
+    store_lex "$offset", $P121
+.annotate 'line', 212
+    set $P118, $P121
+  if_1160_end:
+.annotate 'line', 211
+    .return ($P118)
+.end
+
+
+.namespace []
+.include "except_types.pasm"
+.sub "split"  :subid("41_1792415667.6691") :outer("10_1792415667.6691") :multi(["Regex";"Regex"],_)
+    .param pmc param_1168
+    .param pmc param_1169
+.annotate 'file', "ext/nqp-rx/src/stage0/nqp-setting.nqp"
+.annotate 'line', 231
+    .const 'Sub' $P1175 = "42_1792415667.6691" 
+    capture_lex $P1175
+    new $P1167, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1167, control_1166
+    push_eh $P1167
+    .lex "$regex", param_1168
+    .lex "$text", param_1169
+.annotate 'line', 232
+    new $P110, "Undef"
+    set $P1170, $P110
+    .lex "$pos", $P1170
+.annotate 'line', 233
+    $P1172 = root_new ['parrot';'ResizablePMCArray']
+    set $P1171, $P1172
+    .lex "@result", $P1171
+.annotate 'line', 234
+    new $P111, "Undef"
+    set $P1173, $P111
+    .lex "$looking", $P1173
+.annotate 'line', 232
+    new $P112, "Integer"
+    assign $P112, 0
+    store_lex "$pos", $P112
+.annotate 'line', 231
+    find_lex $P112, "@result"
+.annotate 'line', 234
+    new $P112, "Integer"
+    assign $P112, 1
+    store_lex "$looking", $P112
+.annotate 'line', 235
+    new $P115, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P115, loop1187_handler
+    push_eh $P115
+  loop1187_test:
+    find_lex $P112, "$looking"
+    unless $P112, loop1187_done
+  loop1187_redo:
+    .const 'Sub' $P1175 = "42_1792415667.6691" 
+    capture_lex $P1175
+    $P1175()
+  loop1187_next:
+    goto loop1187_test
+  loop1187_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P116, exception, 'type'
+    eq $P116, .CONTROL_LOOP_NEXT, loop1187_next
+    eq $P116, .CONTROL_LOOP_REDO, loop1187_redo
+  loop1187_done:
+    pop_eh 
+.annotate 'line', 253
+    new $P112, "Exception"
+    set $P112['type'], .CONTROL_RETURN
+    find_lex $P113, "@result"
+    setattribute $P112, 'payload', $P113
+    throw $P112
+.annotate 'line', 231
+    .return ()
+  control_1166:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P112, exception, "payload"
+    .return ($P112)
+.end
+
+
+.namespace []
+.sub "_block1174"  :anon :subid("42_1792415667.6691") :outer("41_1792415667.6691")
+.annotate 'file', "ext/nqp-rx/src/stage0/nqp-setting.nqp"
+.annotate 'line', 235
+    .const 'Sub' $P1184 = "44_1792415667.6691" 
+    capture_lex $P1184
+    .const 'Sub' $P1179 = "43_1792415667.6691" 
+    capture_lex $P1179
+.annotate 'line', 236
+    new $P113, "Undef"
+    set $P1176, $P113
+    .lex "$match", $P1176
+.annotate 'line', 237
+    get_hll_global $P114, ["Regex"], "Cursor"
+    find_lex $P115, "$text"
+    find_lex $P116, "$regex"
+    find_lex $P117, "$pos"
+    $P118 = $P114."parse"($P115, $P116 :named("rule"), $P117 :named("c"))
+    store_lex "$match", $P118
+.annotate 'line', 239
+    find_lex $P115, "$match"
+    istrue $I100, $P115
+    if $I100, if_1177
+.annotate 'line', 245
+    .const 'Sub' $P1184 = "44_1792415667.6691" 
+    capture_lex $P1184
+    $P123 = $P1184()
+    set $P114, $P123
+.annotate 'line', 239
+    goto if_1177_end
+  if_1177:
+    .const 'Sub' $P1179 = "43_1792415667.6691" 
+    capture_lex $P1179
+    $P119 = $P1179()
+    set $P114, $P119
+  if_1177_end:
+.annotate 'line', 235
+    .return ($P114)
+.end
+
+
+.namespace []
+.sub "_block1183"  :anon :subid("44_1792415667.6691") :outer("42_1792415667.6691")
+.annotate 'file', "ext/nqp-rx/src/stage0/nqp-setting.nqp"
+.annotate 'line', 246
+    new $P121, "Undef"
+    set $P1185, $P121
+    .lex "$len", $P1185
+    find_lex $P122, "$text"
+    set $S100, $P122
+    length $I101, $S100
+    new $P123, 'Integer'
+    set $P123, $I101
+    store_lex "$len", $P123
+.annotate 'line', 247
+    find_lex $P122, "$pos"
+    set $N100, $P122
+    find_lex $P123, "$len"
+    set $N101, $P123
+    islt $I101, $N100, $N101
+    unless $I101, if_1186_end
+.annotate 'line', 248
+    find_lex $P124, "@result"
+    find_lex $P125, "$text"
+    set $S100, $P125
+    find_lex $P126, "$pos"
+    set $I102, $P126
+    substr $S101, $S100, $I102
+    $P124."push"($S101)
+  if_1186_end:
+.annotate 'line', 250
+    new $P122, "Integer"
+    assign $P122, 0
+    store_lex "$looking", $P122
+.annotate 'line', 245
+    .return ($P122)
+.end
+
+
+.namespace []
+.sub "_block1178"  :anon :subid("43_1792415667.6691") :outer("42_1792415667.6691")
+.annotate 'file', "ext/nqp-rx/src/stage0/nqp-setting.nqp"
+.annotate 'line', 240
+    new $P116, "Undef"
+    set $P1180, $P116
+    .lex "$from", $P1180
+.annotate 'line', 241
+    new $P117, "Undef"
+    set $P1181, $P117
+    .lex "$to", $P1181
+.annotate 'line', 242
+    new $P118, "Undef"
+    set $P1182, $P118
+    .lex "$prefix", $P1182
+.annotate 'line', 240
+    find_lex $P119, "$match"
+    $P120 = $P119."from"()
+    store_lex "$from", $P120
+.annotate 'line', 241
+    find_lex $P119, "$match"
+    $P120 = $P119."to"()
+    store_lex "$to", $P120
+.annotate 'line', 242
+    find_lex $P119, "$text"
+    find_lex $P120, "$pos"
+    set $I101, $P120
+    find_lex $P121, "$from"
+    find_lex $P122, "$pos"
+    sub $P123, $P121, $P122
+    set $I102, $P123
+    substr $S100, $P119, $I101, $I102
+    new $P124, 'String'
+    set $P124, $S100
+    store_lex "$prefix", $P124
+.annotate 'line', 243
+    find_lex $P119, "@result"
+    find_lex $P120, "$prefix"
+    $P119."push"($P120)
+.annotate 'line', 244
+    find_lex $P119, "$match"
+    $P120 = $P119."to"()
+    store_lex "$pos", $P120
+.annotate 'line', 239
+    .return ($P120)
+.end
+
+
+.namespace []
+.include "except_types.pasm"
+.sub "split"  :subid("45_1792415667.6691") :outer("10_1792415667.6691") :multi(_,_)
+    .param pmc param_1191
+    .param pmc param_1192
+.annotate 'file', "ext/nqp-rx/src/stage0/nqp-setting.nqp"
+.annotate 'line', 257
+    .const 'Sub' $P1196 = "46_1792415667.6691" 
+    capture_lex $P1196
+    new $P1190, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1190, control_1189
+    push_eh $P1190
+    .lex "$string", param_1191
+    .lex "$text", param_1192
+.annotate 'line', 259
+    $P1194 = root_new ['parrot';'ResizablePMCArray']
+    set $P1193, $P1194
+    .lex "@res", $P1193
+.annotate 'line', 257
+    find_lex $P110, "@res"
+.annotate 'line', 260
+    find_lex $P111, "$string"
+    set $S100, $P111
+    find_lex $P112, "$text"
+    set $S101, $P112
+    split $P113, $S100, $S101
+    defined $I100, $P113
+    unless $I100, for_undef_64
+    iter $P110, $P113
+    new $P118, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P118, loop1198_handler
+    push_eh $P118
+  loop1198_test:
+    unless $P110, loop1198_done
+    shift $P114, $P110
+  loop1198_redo:
+    .const 'Sub' $P1196 = "46_1792415667.6691" 
+    capture_lex $P1196
+    $P1196($P114)
+  loop1198_next:
+    goto loop1198_test
+  loop1198_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P119, exception, 'type'
+    eq $P119, .CONTROL_LOOP_NEXT, loop1198_next
+    eq $P119, .CONTROL_LOOP_REDO, loop1198_redo
+  loop1198_done:
+    pop_eh 
+  for_undef_64:
+.annotate 'line', 257
+    find_lex $P110, "@res"
+    .return ($P110)
+  control_1189:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P111, exception, "payload"
+    .return ($P111)
+.end
+
+
+.namespace []
+.sub "_block1195"  :anon :subid("46_1792415667.6691") :outer("45_1792415667.6691")
+    .param pmc param_1197
+.annotate 'file', "ext/nqp-rx/src/stage0/nqp-setting.nqp"
+.annotate 'line', 260
+    .lex "$_", param_1197
+    find_lex $P115, "@res"
+    find_lex $P116, "$_"
+    $P117 = $P115."push"($P116)
+    .return ($P117)
+.end
+
+
+.namespace []
+.include "except_types.pasm"
+.sub "slurp"  :subid("47_1792415667.6691") :outer("10_1792415667.6691")
+    .param pmc param_1202
+.annotate 'file', "ext/nqp-rx/src/stage0/nqp-setting.nqp"
+.annotate 'line', 299
+    new $P1201, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1201, control_1200
+    push_eh $P1201
+    .lex "$filename", param_1202
+.annotate 'line', 300
+    new $P110, "Undef"
+    set $P1203, $P110
+    .lex "$handle", $P1203
+.annotate 'line', 301
+    new $P111, "Undef"
+    set $P1204, $P111
+    .lex "$contents", $P1204
+.annotate 'line', 300
+    find_lex $P112, "$filename"
+    $P113 = "open"($P112, 1 :named("r"))
+    store_lex "$handle", $P113
+.annotate 'line', 301
+    find_lex $P112, "$handle"
+    $P113 = $P112."readall"()
+    store_lex "$contents", $P113
+.annotate 'line', 302
+    find_lex $P112, "$handle"
+    $P112."close"()
+.annotate 'line', 299
+    find_lex $P112, "$contents"
+    .return ($P112)
+  control_1200:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P113, exception, "payload"
+    .return ($P113)
+.end
+
+
+.namespace []
+.include "except_types.pasm"
+.sub "spew"  :subid("48_1792415667.6691") :outer("10_1792415667.6691")
+    .param pmc param_1208
+    .param pmc param_1209
+.annotate 'file', "ext/nqp-rx/src/stage0/nqp-setting.nqp"
+.annotate 'line', 311
+    new $P1207, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1207, control_1206
+    push_eh $P1207
+    .lex "$filename", param_1208
+    .lex "$contents", param_1209
+.annotate 'line', 312
+    new $P110, "Undef"
+    set $P1210, $P110
+    .lex "$handle", $P1210
+    new $P111, "FileHandle"
+    store_lex "$handle", $P111
+.annotate 'line', 313
+    find_lex $P111, "$handle"
+    find_lex $P112, "$filename"
+    $P111."open"($P112, "w")
+.annotate 'line', 314
+    find_lex $P111, "$handle"
+    find_lex $P112, "$contents"
+    $P111."print"($P112)
+.annotate 'line', 315
+    find_lex $P111, "$handle"
+    $P112 = $P111."close"()
+.annotate 'line', 311
+    .return ($P112)
+  control_1206:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P111, exception, "payload"
+    .return ($P111)
+.end
+
+
+.namespace []
+.sub "_block1212" :load :anon :subid("49_1792415667.6691")
+.annotate 'file', "ext/nqp-rx/src/stage0/nqp-setting.nqp"
+.annotate 'line', 1
+    .const '' $P1214 = "10_1792415667.6691" 
+    $P110 = $P1214()
+    .return ($P110)
+.end
+
@@ -467,6 +467,7 @@ Parrot_cmd_options(void)
         { '\0', OPT_GC_NURSERY_SIZE, OPTION_required_FLAG, { "--gc-nursery-size" } },
         { '\0', OPT_GC_DYNAMIC_THRESHOLD, OPTION_required_FLAG, { "--gc-dynamic-threshold" } },
         { '\0', OPT_GC_MIN_THRESHOLD, OPTION_required_FLAG, { "--gc-min-threshold" } },
+        { '\0', OPT_GC_EVACUATE_THRESHOLD, OPTION_required_FLAG, { "--gc-evacuate-threshold" } },
         { '\0', OPT_GC_DEBUG, (OPTION_flags)0, { "--gc-debug" } },
         { '\0', OPT_NUMTHREADS, OPTION_required_FLAG, { "--numthreads" } },
         { 'V', 'V', (OPTION_flags)0, { "--version" } },
@@ -545,6 +546,21 @@ parseflags_minimal(ARGMOD(Parrot_Init_Args * initargs), int argc, ARGIN(const ch
                 exit(EXIT_FAILURE);
             }
             break;
+          case OPT_GC_EVACUATE_THRESHOLD:
+            if (opt.opt_arg && is_all_digits(opt.opt_arg)) {
+                initargs->gc_evacuate_threshold = strtoul(opt.opt_arg, NULL, 10);
+
+                if (initargs->gc_evacuate_threshold > 100) {
+                    fprintf(stderr, "error: maximum GC evacuate threshold is 100%%\n");
+                    exit(EXIT_FAILURE);
+                }
+            }
+            else {
+                fprintf(stderr, "error: invalid GC evacuate threshold specified:"
+                        "'%s'\n", opt.opt_arg);
+                exit(EXIT_FAILURE);
+            }
+            break;
           case OPT_GC_NURSERY_SIZE:
             if (opt.opt_arg && is_float(opt.opt_arg)) {
                 initargs->gc_nursery_size = (float)strtod(opt.opt_arg, NULL);
@@ -645,6 +661,7 @@ parseflags(Parrot_PMC interp, int argc, ARGIN(const char *argv[]),
           case OPT_GC_NURSERY_SIZE:
           case OPT_GC_DYNAMIC_THRESHOLD:
           case OPT_GC_MIN_THRESHOLD:
+          case OPT_GC_EVACUATE_THRESHOLD:
             /* Handled in parseflags_minimal */
             break;
           case 'G':
@@ -0,0 +1,536 @@
+#include <stdlib.h>
+#include "parrot/api.h"
+static const unsigned char program_code[] = {254,80,66,67,13,10,26,10,8,0,0,6,9,0,13,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+30,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+3,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,0,0,0,0,0,0,0,
+66,89,84,69,67,79,68,69,95,102,114,111,110,116,101,110,100,47,112,97,114,114,111,116,50,47,112,114,116,48,46,112,
+105,114,0,0,0,0,0,0,44,0,0,0,0,0,0,0,216,3,0,0,0,0,0,0,2,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,34,0,0,0,0,0,0,0,67,79,78,83,84,65,78,84,95,102,114,111,110,116,101,110,
+100,47,112,97,114,114,111,116,50,47,112,114,116,48,46,112,105,114,0,0,0,0,0,0,4,4,0,0,0,0,0,0,
+252,2,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,0,0,0,0,0,0,0,
+66,89,84,69,67,79,68,69,95,102,114,111,110,116,101,110,100,47,112,97,114,114,111,116,50,47,112,114,116,48,46,112,
+105,114,95,68,66,0,0,0,0,7,0,0,0,0,0,0,38,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+216,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,58,3,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+5,0,0,0,0,0,0,0,15,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,
+16,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,7,0,0,0,0,0,0,0,21,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+9,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,
+22,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,11,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,
+2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+4,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,
+7,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,95,0,0,0,0,0,0,0,
+8,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+9,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,18,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,
+9,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,34,0,0,0,0,0,0,0,
+9,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,17,0,0,0,0,0,0,0,38,0,0,0,0,0,0,0,
+9,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,42,0,0,0,0,0,0,0,
+9,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,7,0,0,0,0,0,0,0,46,0,0,0,0,0,0,0,
+9,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,
+9,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,50,0,0,0,0,0,0,0,
+10,0,0,0,0,0,0,0,52,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,
+4,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,
+10,0,0,0,0,0,0,0,49,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,
+4,0,0,0,0,0,0,0,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,
+10,0,0,0,0,0,0,0,41,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,
+4,0,0,0,0,0,0,0,11,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,
+10,0,0,0,0,0,0,0,33,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,
+4,0,0,0,0,0,0,0,11,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+10,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,
+13,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,
+12,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,13,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,
+14,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,
+13,0,0,0,0,0,0,0,7,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,
+15,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,
+4,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,160,255,255,255,255,255,255,255,16,0,0,0,0,0,0,0,
+2,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,17,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,
+7,0,0,0,0,0,0,0,18,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,19,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,
+12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,13,0,0,0,0,0,0,0,
+8,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,20,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,18,0,0,0,0,0,0,0,21,0,0,0,0,0,0,0,
+2,0,0,0,0,0,0,0,11,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,
+2,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,22,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,
+14,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,23,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,
+12,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,13,0,0,0,0,0,0,0,
+9,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,
+24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,17,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,
+15,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+6,0,0,0,0,0,0,0,13,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,
+6,0,0,0,0,0,0,0,20,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,
+54,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+13,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,
+2,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,
+2,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,
+2,0,0,0,0,0,0,0,21,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,11,0,0,0,0,0,0,0,
+12,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+22,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,
+2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+12,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,7,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+6,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,29,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,0,0,0,0,0,0,0,11,0,0,0,0,0,0,0,
+14,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,
+2,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+12,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,23,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+13,0,0,0,0,0,0,0,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,
+14,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,
+2,0,0,0,0,0,0,0,23,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,
+2,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+33,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,34,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,
+13,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,
+10,0,0,0,0,0,0,0,244,255,255,255,255,255,255,255,35,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,
+4,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,37,0,0,0,0,0,0,0,
+3,0,0,0,0,0,0,0,23,0,0,0,0,0,0,0,38,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,
+30,0,0,0,0,0,0,0,39,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,
+2,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,13,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,
+14,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,
+2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+24,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+12,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,41,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,15,0,0,0,0,0,0,0,
+14,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,42,0,0,0,0,0,0,0,
+2,0,0,0,0,0,0,0,41,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,
+2,0,0,0,0,0,0,0,13,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,
+6,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,36,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,
+43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,
+43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,33,0,0,0,0,0,0,0,
+10,0,0,0,0,0,0,0,45,0,0,0,0,0,0,0,21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+11,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,
+14,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,
+2,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,36,0,0,0,0,0,0,0,21,0,0,0,0,0,0,0,
+2,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,
+2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,44,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,
+16,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,7,0,0,0,0,0,0,0,
+12,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+22,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,
+6,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,
+36,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,
+2,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,36,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,
+6,0,0,0,0,0,0,0,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,45,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+46,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,
+47,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,
+48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+10,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,
+8,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,11,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,
+36,0,0,0,0,0,0,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+8,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,11,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,
+36,0,0,0,0,0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+20,0,0,0,0,0,0,0,46,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,
+8,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,11,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+36,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,11,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,
+36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,
+51,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,43,0,0,0,0,0,0,0,
+24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,20,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,13,0,0,0,0,0,0,0,51,0,0,0,0,0,0,0,
+4,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,
+3,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,52,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,
+53,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,
+3,0,0,0,0,0,0,0,45,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+26,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,17,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,7,0,0,0,0,0,0,0,
+18,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+19,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,49,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,37,0,0,0,0,0,0,0,54,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,
+13,0,0,0,0,0,0,0,55,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+57,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,41,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,
+12,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,
+22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,
+6,0,0,0,0,0,0,0,49,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+12,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,22,0,0,0,0,0,0,0,
+3,0,0,0,0,0,0,0,36,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+46,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+47,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,76,0,0,0,0,0,0,0,
+58,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+59,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,46,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,
+26,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,57,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,
+5,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,33,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,
+3,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,
+3,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,43,0,0,0,0,0,0,0,
+3,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,6,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,
+242,255,255,255,255,255,255,255,54,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,13,0,0,0,0,0,0,0,
+55,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+4,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,57,0,0,0,0,0,0,0,
+4,0,0,0,0,0,0,0,44,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,
+5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,22,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,
+49,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,46,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,
+210,255,255,255,255,255,255,255,49,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,
+61,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,182,255,255,255,255,255,255,255,
+51,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,
+24,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,17,0,0,0,0,0,0,0,
+2,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,11,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,52,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,62,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,
+63,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+64,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,65,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+55,0,0,0,0,0,0,0,54,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,13,0,0,0,0,0,0,0,
+55,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,66,0,0,0,0,0,0,0,
+3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,0,0,0,0,0,0,0,67,0,0,0,0,0,0,0,
+2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,66,0,0,0,0,0,0,0,
+4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,18,0,0,0,0,0,0,0,67,0,0,0,0,0,0,0,
+2,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,66,0,0,0,0,0,0,0,
+5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,19,0,0,0,0,0,0,0,67,0,0,0,0,0,0,0,
+2,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,66,0,0,0,0,0,0,0,
+6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,20,0,0,0,0,0,0,0,67,0,0,0,0,0,0,0,
+2,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,68,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,69,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,70,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+23,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+57,0,0,0,0,0,0,0,63,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+71,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+35,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,23,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+53,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+16,0,0,0,0,0,0,0,71,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+46,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,0,
+14,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+39,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,
+3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,63,0,0,0,0,0,0,0,22,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,
+23,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+72,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,99,111,114,101,95,111,112,115,0,0,0,0,0,0,0,0,
+13,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,72,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+33,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,224,2,0,0,0,0,0,0,2,0,0,0,0,0,0,0,
+36,3,0,0,0,0,0,0,3,0,0,0,0,0,0,0,165,2,0,0,0,0,0,0,4,0,0,0,0,0,0,0,
+37,3,0,0,0,0,0,0,5,0,0,0,0,0,0,0,38,3,0,0,0,0,0,0,6,0,0,0,0,0,0,0,
+144,2,0,0,0,0,0,0,7,0,0,0,0,0,0,0,223,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,
+7,3,0,0,0,0,0,0,9,0,0,0,0,0,0,0,165,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,
+11,0,0,0,0,0,0,0,11,0,0,0,0,0,0,0,205,2,0,0,0,0,0,0,12,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,13,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,
+35,0,0,0,0,0,0,0,15,0,0,0,0,0,0,0,218,2,0,0,0,0,0,0,16,0,0,0,0,0,0,0,
+38,1,0,0,0,0,0,0,17,0,0,0,0,0,0,0,17,0,0,0,0,0,0,0,18,0,0,0,0,0,0,0,
+70,1,0,0,0,0,0,0,19,0,0,0,0,0,0,0,21,0,0,0,0,0,0,0,20,0,0,0,0,0,0,0,
+182,0,0,0,0,0,0,0,21,0,0,0,0,0,0,0,121,0,0,0,0,0,0,0,22,0,0,0,0,0,0,0,
+16,2,0,0,0,0,0,0,23,0,0,0,0,0,0,0,62,0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,
+232,2,0,0,0,0,0,0,25,0,0,0,0,0,0,0,56,3,0,0,0,0,0,0,26,0,0,0,0,0,0,0,
+1,1,0,0,0,0,0,0,27,0,0,0,0,0,0,0,217,2,0,0,0,0,0,0,28,0,0,0,0,0,0,0,
+115,2,0,0,0,0,0,0,29,0,0,0,0,0,0,0,3,1,0,0,0,0,0,0,30,0,0,0,0,0,0,0,
+2,1,0,0,0,0,0,0,31,0,0,0,0,0,0,0,199,2,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+227,2,0,0,0,0,0,0,33,0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,34,0,0,0,0,0,0,0,
+166,2,0,0,0,0,0,0,35,0,0,0,0,0,0,0,34,0,0,0,0,0,0,0,36,0,0,0,0,0,0,0,
+29,0,0,0,0,0,0,0,37,0,0,0,0,0,0,0,109,2,0,0,0,0,0,0,38,0,0,0,0,0,0,0,
+43,4,0,0,0,0,0,0,39,0,0,0,0,0,0,0,47,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,
+28,0,0,0,0,0,0,0,41,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,42,0,0,0,0,0,0,0,
+63,0,0,0,0,0,0,0,43,0,0,0,0,0,0,0,159,0,0,0,0,0,0,0,44,0,0,0,0,0,0,0,
+22,2,0,0,0,0,0,0,45,0,0,0,0,0,0,0,71,3,0,0,0,0,0,0,46,0,0,0,0,0,0,0,
+3,2,0,0,0,0,0,0,47,0,0,0,0,0,0,0,205,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,
+77,3,0,0,0,0,0,0,49,0,0,0,0,0,0,0,219,2,0,0,0,0,0,0,50,0,0,0,0,0,0,0,
+188,0,0,0,0,0,0,0,51,0,0,0,0,0,0,0,73,2,0,0,0,0,0,0,52,0,0,0,0,0,0,0,
+61,0,0,0,0,0,0,0,53,0,0,0,0,0,0,0,121,1,0,0,0,0,0,0,54,0,0,0,0,0,0,0,
+121,2,0,0,0,0,0,0,55,0,0,0,0,0,0,0,235,2,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+253,2,0,0,0,0,0,0,57,0,0,0,0,0,0,0,134,3,0,0,0,0,0,0,58,0,0,0,0,0,0,0,
+6,3,0,0,0,0,0,0,59,0,0,0,0,0,0,0,150,3,0,0,0,0,0,0,60,0,0,0,0,0,0,0,
+111,3,0,0,0,0,0,0,61,0,0,0,0,0,0,0,148,1,0,0,0,0,0,0,62,0,0,0,0,0,0,0,
+83,0,0,0,0,0,0,0,63,0,0,0,0,0,0,0,109,1,0,0,0,0,0,0,64,0,0,0,0,0,0,0,
+96,0,0,0,0,0,0,0,65,0,0,0,0,0,0,0,9,3,0,0,0,0,0,0,66,0,0,0,0,0,0,0,
+31,3,0,0,0,0,0,0,67,0,0,0,0,0,0,0,1,3,0,0,0,0,0,0,68,0,0,0,0,0,0,0,
+133,3,0,0,0,0,0,0,69,0,0,0,0,0,0,0,197,2,0,0,0,0,0,0,70,0,0,0,0,0,0,0,
+111,1,0,0,0,0,0,0,71,0,0,0,0,0,0,0,57,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+252,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,67,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,45,104,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,80,97,99,107,102,105,108,101,86,105,101,119,0,0,0,0,
+1,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,45,99,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+11,0,0,0,0,0,0,0,115,117,98,115,95,98,121,95,116,97,103,0,0,0,0,0,1,0,0,0,0,0,0,0,
+2,0,0,0,0,0,0,0,45,86,0,0,0,0,0,0,1,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,
+114,101,97,100,95,102,114,111,109,95,102,105,108,101,0,0,1,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,
+45,45,114,117,110,116,105,109,101,45,112,114,101,102,105,120,1,0,0,0,0,0,0,0,20,0,0,0,0,0,0,0,
+77,105,115,115,105,110,103,32,112,114,111,103,114,97,109,32,110,97,109,101,0,0,0,0,1,0,0,0,0,0,0,0,
+8,0,0,0,0,0,0,0,87,83,117,98,73,100,95,56,1,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,
+45,69,0,0,0,0,0,0,1,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,80,73,82,0,0,0,0,0,
+1,0,0,0,0,0,0,0,13,0,0,0,0,0,0,0,119,114,105,116,101,95,116,111,95,102,105,108,101,0,0,0,
+1,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,105,110,105,116,0,0,0,0,1,0,0,0,0,0,0,0,
+10,0,0,0,0,0,0,0,112,114,101,112,114,111,99,101,115,115,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+18,0,0,0,0,0,0,0,73,110,118,97,108,105,100,32,102,105,108,101,32,116,121,112,101,32,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,99,111,109,112,105,108,101,95,102,105,108,101,0,0,0,0,
+1,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,45,114,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+2,0,0,0,0,0,0,0,45,111,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,
+102,114,111,110,116,101,110,100,47,112,97,114,114,111,116,50,47,112,114,116,48,46,112,105,114,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,95,95,80,65,82,82,79,84,95,69,78,84,82,89,95,77,
+65,73,78,95,95,97,114,103,115,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,1,0,0,0,0,0,0,0,
+6,0,0,0,0,0,0,0,112,97,114,114,111,116,0,0,1,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,
+69,120,99,101,112,116,105,111,110,72,97,110,100,108,101,114,1,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,
+109,97,105,110,95,115,117,98,1,0,0,0,0,0,0,0,21,0,0,0,0,0,0,0,95,95,80,65,82,82,79,84,
+95,69,78,84,82,89,95,77,65,73,78,95,95,0,0,0,1,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,
+80,65,83,77,0,0,0,0,1,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,87,83,117,98,73,100,95,55,
+1,0,0,0,0,0,0,0,22,0,0,0,0,0,0,0,95,95,100,101,102,97,117,108,116,95,103,101,116,95,112,97,
+99,107,102,105,108,101,0,0,1,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,87,83,117,98,73,100,95,53,
+1,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,46,112,97,115,109,0,0,0,1,0,0,0,0,0,0,0,
+4,0,0,0,0,0,0,0,46,112,105,114,0,0,0,0,1,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,
+46,112,98,99,0,0,0,0,1,0,0,0,0,0,0,0,21,0,0,0,0,0,0,0,95,95,103,101,116,95,105,110,
+112,117,116,95,102,105,108,101,95,116,121,112,101,0,0,0,255,255,255,255,255,255,255,255,1,0,0,0,0,0,0,0,
+13,0,0,0,0,0,0,0,10,116,104,114,111,119,110,32,102,114,111,109,10,0,0,0,1,0,0,0,0,0,0,0,
+17,0,0,0,0,0,0,0,98,97,99,107,116,114,97,99,101,95,115,116,114,105,110,103,115,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,78,111,32,101,120,99,101,112,116,105,111,110,32,104,97,110,
+100,108,101,114,32,97,110,100,32,110,111,32,109,101,115,115,97,103,101,0,0,0,0,0,1,0,0,0,0,0,0,0,
+17,0,0,0,0,0,0,0,82,101,115,105,122,97,98,108,101,80,77,67,65,114,114,97,121,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,112,114,105,110,116,0,0,0,1,0,0,0,0,0,0,0,
+9,0,0,0,0,0,0,0,101,120,105,116,95,99,111,100,101,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+3,0,0,0,0,0,0,0,37,115,10,0,0,0,0,0,1,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,
+87,83,117,98,73,100,95,57,1,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,115,101,118,101,114,105,116,121,
+1,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,37,115,37,115,0,0,0,0,1,0,0,0,0,0,0,0,
+7,0,0,0,0,0,0,0,109,101,115,115,97,103,101,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+10,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,23,0,0,0,0,0,0,0,95,95,104,97,110,100,108,101,
+95,101,114,114,111,114,95,97,110,100,95,101,120,105,116,0,1,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,
+87,83,117,98,73,100,95,49,1,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,95,95,115,104,111,119,95,114,
+117,110,116,105,109,101,95,112,114,101,102,105,120,95,97,110,100,95,101,120,105,116,0,0,1,0,0,0,0,0,0,0,
+8,0,0,0,0,0,0,0,87,83,117,98,73,100,95,50,1,0,0,0,0,0,0,0,7,0,0,0,0,0,0,0,
+86,69,82,83,73,79,78,0,1,0,0,0,0,0,0,0,7,0,0,0,0,0,0,0,99,112,117,97,114,99,104,0,
+1,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,68,69,86,69,76,0,0,0,1,0,0,0,0,0,0,0,
+8,0,0,0,0,0,0,0,112,108,97,116,102,111,114,109,1,0,0,0,0,0,0,0,9,1,0,0,0,0,0,0,
+84,104,105,115,32,105,115,32,80,97,114,114,111,116,32,118,101,114,115,105,111,110,32,37,115,37,115,32,98,117,105,108,
+116,32,102,111,114,32,37,115,45,37,115,10,67,111,112,121,114,105,103,104,116,32,40,67,41,32,50,48,48,49,45,50,
+48,49,52,44,32,80,97,114,114,111,116,32,70,111,117,110,100,97,116,105,111,110,46,10,10,84,104,105,115,32,99,111,
+100,101,32,105,115,32,100,105,115,116,114,105,98,117,116,101,100,32,117,110,100,101,114,32,116,104,101,32,116,101,114,109,
+115,32,111,102,32,116,104,101,32,65,114,116,105,115,116,105,99,32,76,105,99,101,110,115,101,32,50,46,48,46,10,70,
+111,114,32,109,111,114,101,32,100,101,116,97,105,108,115,44,32,115,101,101,32,116,104,101,32,102,117,108,108,32,116,101,
+120,116,32,111,102,32,116,104,101,32,108,105,99,101,110,115,101,32,105,110,32,116,104,101,32,76,73,67,69,78,83,69,
+32,102,105,108,101,10,105,110,99,108,117,100,101,100,32,105,110,32,116,104,101,32,80,97,114,114,111,116,32,115,111,117,
+114,99,101,32,116,114,101,101,10,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,23,0,0,0,0,0,0,0,
+95,95,115,104,111,119,95,118,101,114,115,105,111,110,95,97,110,100,95,101,120,105,116,0,1,0,0,0,0,0,0,0,
+171,4,0,0,0,0,0,0,112,97,114,114,111,116,32,91,79,112,116,105,111,110,115,93,32,60,102,105,108,101,62,32,
+91,60,112,114,111,103,114,97,109,32,111,112,116,105,111,110,115,46,46,46,62,93,10,32,32,79,112,116,105,111,110,115,
+58,10,32,32,32,32,45,104,32,45,45,104,101,108,112,10,32,32,32,32,45,86,32,45,45,118,101,114,115,105,111,110,
+10,32,32,32,32,45,73,32,45,45,105,110,99,108,117,100,101,32,97,100,100,32,112,97,116,104,32,116,111,32,105,110,
+99,108,117,100,101,32,115,101,97,114,99,104,10,32,32,32,32,45,76,32,45,45,108,105,98,114,97,114,121,32,97,100,
+100,32,112,97,116,104,32,116,111,32,108,105,98,114,97,114,121,32,115,101,97,114,99,104,10,32,32,32,32,32,32,32,
+45,45,104,97,115,104,45,115,101,101,100,32,70,48,48,70,32,32,115,112,101,99,105,102,121,32,104,101,120,32,118,97,
+108,117,101,32,116,111,32,117,115,101,32,97,115,32,104,97,115,104,32,115,101,101,100,10,32,32,32,32,45,88,32,45,
+45,100,121,110,101,120,116,32,97,100,100,32,112,97,116,104,32,116,111,32,100,121,110,97,109,105,99,32,101,120,116,101,
+110,115,105,111,110,32,115,101,97,114,99,104,10,32,32,32,60,82,117,110,32,99,111,114,101,32,111,112,116,105,111,110,
+115,62,10,32,32,32,32,45,82,32,45,45,114,117,110,99,111,114,101,32,102,97,115,116,124,115,108,111,119,124,98,111,
+117,110,100,115,10,32,32,32,32,45,82,32,45,45,114,117,110,99,111,114,101,32,116,114,97,99,101,124,112,114,111,102,
+105,108,105,110,103,124,115,117,98,112,114,111,102,10,32,32,32,32,45,116,32,45,45,116,114,97,99,101,32,91,102,108,
+97,103,115,93,10,32,32,32,60,86,77,32,111,112,116,105,111,110,115,62,10,32,32,32,32,45,68,32,45,45,112,97,
+114,114,111,116,45,100,101,98,117,103,91,61,72,69,88,70,76,65,71,83,93,10,32,32,32,32,32,32,32,45,45,104,
+101,108,112,45,100,101,98,117,103,10,32,32,32,32,45,119,32,45,45,119,97,114,110,105,110,103,115,10,32,32,32,32,
+45,71,32,45,45,110,111,45,103,99,10,32,32,32,32,45,103,32,45,45,103,99,32,109,115,50,124,103,109,115,124,109,
+115,124,105,110,102,32,115,101,116,32,71,67,32,116,121,112,101,10,32,32,32,32,32,32,32,60,71,67,32,77,83,50,
+32,111,112,116,105,111,110,115,62,10,32,32,32,32,32,32,32,45,45,103,99,45,100,121,110,97,109,105,99,45,116,104,
+114,101,115,104,111,108,100,61,112,101,114,99,101,110,116,97,103,101,32,32,32,32,109,97,120,105,109,117,109,32,109,101,
+109,111,114,121,32,119,97,115,116,101,100,32,98,121,32,71,67,10,32,32,32,32,32,32,32,45,45,103,99,45,109,105,
+110,45,116,104,114,101,115,104,111,108,100,61,75,66,10,32,32,32,32,32,32,32,60,71,67,32,71,77,83,32,111,112,
+116,105,111,110,115,62,10,32,32,32,32,32,32,32,45,45,103,99,45,110,117,114,115,101,114,121,45,115,105,122,101,61,
+112,101,114,99,101,110,116,32,111,102,32,115,121,115,109,101,109,32,32,115,105,122,101,32,111,102,32,103,101,110,48,32,
+40,100,101,102,97,117,108,116,32,50,41,10,32,32,32,32,32,32,32,45,45,103,99,45,100,101,98,117,103,10,32,32,
+32,32,32,32,32,45,45,108,101,97,107,45,116,101,115,116,124,45,45,100,101,115,116,114,111,121,45,97,116,45,101,110,
+100,10,32,32,32,32,45,46,32,45,45,119,97,105,116,32,32,32,32,82,101,97,100,32,97,32,107,101,121,115,116,114,
+111,107,101,32,98,101,102,111,114,101,32,115,116,97,114,116,105,110,103,10,32,32,32,32,32,32,32,45,45,114,117,110,
+116,105,109,101,45,112,114,101,102,105,120,10,32,32,32,60,67,111,109,112,105,108,101,114,32,111,112,116,105,111,110,115,
+62,10,32,32,32,32,45,118,32,45,45,118,101,114,98,111,115,101,10,32,32,32,32,45,69,32,45,45,112,114,101,45,
+112,114,111,99,101,115,115,45,111,110,108,121,10,32,32,32,32,45,111,32,45,45,111,117,116,112,117,116,61,70,73,76,
+69,10,32,32,32,32,32,32,32,45,45,111,117,116,112,117,116,45,112,98,99,10,32,32,32,32,45,79,32,45,45,111,
+112,116,105,109,105,122,101,91,61,76,69,86,69,76,93,10,32,32,32,32,45,97,32,45,45,112,97,115,109,10,32,32,
+32,32,45,99,32,45,45,112,98,99,10,32,32,32,32,45,114,32,45,45,114,117,110,45,112,98,99,10,32,32,32,32,
+45,121,32,45,45,121,121,100,101,98,117,103,10,32,32,32,32,45,100,32,45,45,105,109,99,99,45,100,101,98,117,103,
+91,61,72,69,88,70,76,65,71,83,93,32,40,115,101,101,32,45,45,104,101,108,112,45,100,101,98,117,103,41,10,32,
+32,32,60,76,97,110,103,117,97,103,101,32,111,112,116,105,111,110,115,62,10,115,101,101,32,100,111,99,115,47,114,117,
+110,110,105,110,103,46,112,111,100,32,102,111,114,32,109,111,114,101,10,0,0,0,0,0,1,0,0,0,0,0,0,0,
+8,0,0,0,0,0,0,0,87,83,117,98,73,100,95,51,1,0,0,0,0,0,0,0,20,0,0,0,0,0,0,0,
+95,95,115,104,111,119,95,104,101,108,112,95,97,110,100,95,101,120,105,116,0,0,0,0,1,0,0,0,0,0,0,0,
+8,0,0,0,0,0,0,0,87,83,117,98,73,100,95,54,1,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,
+95,95,103,101,116,95,116,101,109,112,111,114,97,114,121,95,111,117,116,112,117,116,95,102,105,108,101,0,0,0,0,0,
+1,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,87,83,117,98,73,100,95,52,1,0,0,0,0,0,0,0,
+51,0,0,0,0,0,0,0,91,45,91,76,73,88,93,32,112,97,116,104,93,32,91,45,82,32,114,117,110,99,111,114,
+101,93,32,91,45,111,32,70,73,76,69,93,32,60,102,105,108,101,62,32,60,97,114,103,115,62,10,0,0,0,0,0,
+1,0,0,0,0,0,0,0,51,0,0,0,0,0,0,0,112,97,114,114,111,116,32,45,91,97,99,69,71,104,114,116,
+118,86,119,121,46,93,32,45,91,68,100,116,93,91,72,69,88,70,76,65,71,83,93,32,91,45,79,91,108,101,118,101,
+108,93,32,0,0,0,0,0,1,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,95,95,117,115,97,103,101,95,
+97,110,100,95,101,120,105,116,255,255,255,255,255,255,255,255,40,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,
+21,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,17,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+40,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,21,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,
+21,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+48,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,21,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,
+2,0,0,0,0,0,0,0,17,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,
+4,0,0,0,0,0,0,0,21,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,
+21,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,21,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,
+3,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,168,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,66,1,0,0,0,0,0,0,8,0,0,0,0,0,0,0,20,0,0,0,0,0,0,0,
+66,0,0,0,0,0,0,0,20,0,0,0,0,0,0,0,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+255,255,255,255,255,255,255,255,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,0,0,0,0,0,0,0,
+12,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,168,0,0,0,0,0,0,0,
+4,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,66,1,0,0,0,0,0,0,124,1,0,0,0,0,0,0,
+8,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,66,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,
+22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,168,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,
+124,1,0,0,0,0,0,0,194,1,0,0,0,0,0,0,8,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,
+66,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+255,255,255,255,255,255,255,255,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+5,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,
+4,0,0,0,0,0,0,0,21,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,168,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,
+194,1,0,0,0,0,0,0,1,2,0,0,0,0,0,0,8,0,0,0,0,0,0,0,33,0,0,0,0,0,0,0,
+66,0,0,0,0,0,0,0,33,0,0,0,0,0,0,0,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+255,255,255,255,255,255,255,255,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,29,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,
+4,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,
+22,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,38,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+168,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,1,2,0,0,0,0,0,0,
+187,2,0,0,0,0,0,0,8,0,0,0,0,0,0,0,47,0,0,0,0,0,0,0,66,0,0,0,0,0,0,0,
+47,0,0,0,0,0,0,0,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,
+4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,
+42,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,168,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,
+12,0,0,0,0,0,0,0,187,2,0,0,0,0,0,0,196,2,0,0,0,0,0,0,8,0,0,0,0,0,0,0,
+49,0,0,0,0,0,0,0,66,0,0,0,0,0,0,0,49,0,0,0,0,0,0,0,22,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+168,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,196,2,0,0,0,0,0,0,
+254,2,0,0,0,0,0,0,8,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,66,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,7,0,0,0,0,0,0,0,
+50,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,
+3,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,51,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,53,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+48,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+4,0,0,0,0,0,0,0,52,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,
+4,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,
+54,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,168,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,
+12,0,0,0,0,0,0,0,254,2,0,0,0,0,0,0,5,3,0,0,0,0,0,0,8,0,0,0,0,0,0,0,
+59,0,0,0,0,0,0,0,66,0,0,0,0,0,0,0,59,0,0,0,0,0,0,0,22,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,58,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+168,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,5,3,0,0,0,0,0,0,
+16,3,0,0,0,0,0,0,8,0,0,0,0,0,0,0,61,0,0,0,0,0,0,0,66,0,0,0,0,0,0,0,
+61,0,0,0,0,0,0,0,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+60,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,
+21,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,129,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,168,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,
+16,3,0,0,0,0,0,0,58,3,0,0,0,0,0,0,8,0,0,0,0,0,0,0,65,0,0,0,0,0,0,0,
+66,0,0,0,0,0,0,0,65,0,0,0,0,0,0,0,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+255,255,255,255,255,255,255,255,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,62,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+38,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,1,0,0,0,0,0,0,
+8,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,
+9,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,
+17,0,0,0,0,0,0,0,18,0,0,0,0,0,0,0,19,0,0,0,0,0,0,0,20,0,0,0,0,0,0,0,
+21,0,0,0,0,0,0,0,22,0,0,0,0,0,0,0,23,0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,
+26,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,29,0,0,0,0,0,0,0,
+30,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,33,0,0,0,0,0,0,0,
+34,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,36,0,0,0,0,0,0,0,38,0,0,0,0,0,0,0,
+39,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,42,0,0,0,0,0,0,0,43,0,0,0,0,0,0,0,
+44,0,0,0,0,0,0,0,46,0,0,0,0,0,0,0,47,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,
+50,0,0,0,0,0,0,0,51,0,0,0,0,0,0,0,52,0,0,0,0,0,0,0,54,0,0,0,0,0,0,0,
+54,0,0,0,0,0,0,0,54,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,58,0,0,0,0,0,0,0,58,0,0,0,0,0,0,0,58,0,0,0,0,0,0,0,
+60,0,0,0,0,0,0,0,61,0,0,0,0,0,0,0,63,0,0,0,0,0,0,0,66,0,0,0,0,0,0,0,
+67,0,0,0,0,0,0,0,68,0,0,0,0,0,0,0,70,0,0,0,0,0,0,0,71,0,0,0,0,0,0,0,
+71,0,0,0,0,0,0,0,71,0,0,0,0,0,0,0,73,0,0,0,0,0,0,0,74,0,0,0,0,0,0,0,
+75,0,0,0,0,0,0,0,75,0,0,0,0,0,0,0,75,0,0,0,0,0,0,0,76,0,0,0,0,0,0,0,
+78,0,0,0,0,0,0,0,79,0,0,0,0,0,0,0,79,0,0,0,0,0,0,0,79,0,0,0,0,0,0,0,
+80,0,0,0,0,0,0,0,81,0,0,0,0,0,0,0,82,0,0,0,0,0,0,0,83,0,0,0,0,0,0,0,
+83,0,0,0,0,0,0,0,83,0,0,0,0,0,0,0,86,0,0,0,0,0,0,0,87,0,0,0,0,0,0,0,
+87,0,0,0,0,0,0,0,87,0,0,0,0,0,0,0,88,0,0,0,0,0,0,0,89,0,0,0,0,0,0,0,
+90,0,0,0,0,0,0,0,92,0,0,0,0,0,0,0,93,0,0,0,0,0,0,0,93,0,0,0,0,0,0,0,
+93,0,0,0,0,0,0,0,94,0,0,0,0,0,0,0,94,0,0,0,0,0,0,0,94,0,0,0,0,0,0,0,
+95,0,0,0,0,0,0,0,96,0,0,0,0,0,0,0,96,0,0,0,0,0,0,0,96,0,0,0,0,0,0,0,
+98,0,0,0,0,0,0,0,99,0,0,0,0,0,0,0,99,0,0,0,0,0,0,0,99,0,0,0,0,0,0,0,
+101,0,0,0,0,0,0,0,102,0,0,0,0,0,0,0,102,0,0,0,0,0,0,0,102,0,0,0,0,0,0,0,
+103,0,0,0,0,0,0,0,105,0,0,0,0,0,0,0,105,0,0,0,0,0,0,0,105,0,0,0,0,0,0,0,
+106,0,0,0,0,0,0,0,107,0,0,0,0,0,0,0,108,0,0,0,0,0,0,0,110,0,0,0,0,0,0,0,
+111,0,0,0,0,0,0,0,112,0,0,0,0,0,0,0,112,0,0,0,0,0,0,0,112,0,0,0,0,0,0,0,
+113,0,0,0,0,0,0,0,115,0,0,0,0,0,0,0,115,0,0,0,0,0,0,0,120,0,0,0,0,0,0,0,
+121,0,0,0,0,0,0,0,121,0,0,0,0,0,0,0,124,0,0,0,0,0,0,0,125,0,0,0,0,0,0,0,
+126,0,0,0,0,0,0,0,127,0,0,0,0,0,0,0,127,0,0,0,0,0,0,0,127,0,0,0,0,0,0,0,
+128,0,0,0,0,0,0,0,128,0,0,0,0,0,0,0,128,0,0,0,0,0,0,0,129,0,0,0,0,0,0,0,
+129,0,0,0,0,0,0,0,130,0,0,0,0,0,0,0,131,0,0,0,0,0,0,0,133,0,0,0,0,0,0,0,
+134,0,0,0,0,0,0,0,135,0,0,0,0,0,0,0,136,0,0,0,0,0,0,0,136,0,0,0,0,0,0,0,
+136,0,0,0,0,0,0,0,137,0,0,0,0,0,0,0,137,0,0,0,0,0,0,0,142,0,0,0,0,0,0,0,
+145,0,0,0,0,0,0,0,146,0,0,0,0,0,0,0,147,0,0,0,0,0,0,0,148,0,0,0,0,0,0,0,
+150,0,0,0,0,0,0,0,151,0,0,0,0,0,0,0,151,0,0,0,0,0,0,0,151,0,0,0,0,0,0,0,
+152,0,0,0,0,0,0,0,152,0,0,0,0,0,0,0,154,0,0,0,0,0,0,0,155,0,0,0,0,0,0,0,
+155,0,0,0,0,0,0,0,157,0,0,0,0,0,0,0,158,0,0,0,0,0,0,0,158,0,0,0,0,0,0,0,
+158,0,0,0,0,0,0,0,159,0,0,0,0,0,0,0,159,0,0,0,0,0,0,0,161,0,0,0,0,0,0,0,
+162,0,0,0,0,0,0,0,162,0,0,0,0,0,0,0,163,0,0,0,0,0,0,0,163,0,0,0,0,0,0,0,
+168,0,0,0,0,0,0,0,170,0,0,0,0,0,0,0,171,0,0,0,0,0,0,0,172,0,0,0,0,0,0,0,
+173,0,0,0,0,0,0,0,174,0,0,0,0,0,0,0,176,0,0,0,0,0,0,0,178,0,0,0,0,0,0,0,
+179,0,0,0,0,0,0,0,179,0,0,0,0,0,0,0,181,0,0,0,0,0,0,0,182,0,0,0,0,0,0,0,
+182,0,0,0,0,0,0,0,184,0,0,0,0,0,0,0,185,0,0,0,0,0,0,0,186,0,0,0,0,0,0,0,
+187,0,0,0,0,0,0,0,188,0,0,0,0,0,0,0,188,0,0,0,0,0,0,0,191,0,0,0,0,0,0,0,
+191,0,0,0,0,0,0,0,196,0,0,0,0,0,0,0,198,0,0,0,0,0,0,0,199,0,0,0,0,0,0,0,
+200,0,0,0,0,0,0,0,201,0,0,0,0,0,0,0,202,0,0,0,0,0,0,0,203,0,0,0,0,0,0,0,
+205,0,0,0,0,0,0,0,206,0,0,0,0,0,0,0,207,0,0,0,0,0,0,0,208,0,0,0,0,0,0,0,
+209,0,0,0,0,0,0,0,211,0,0,0,0,0,0,0,212,0,0,0,0,0,0,0,213,0,0,0,0,0,0,0,
+215,0,0,0,0,0,0,0,216,0,0,0,0,0,0,0,218,0,0,0,0,0,0,0,219,0,0,0,0,0,0,0,
+220,0,0,0,0,0,0,0,221,0,0,0,0,0,0,0,222,0,0,0,0,0,0,0,222,0,0,0,0,0,0,0,
+222,0,0,0,0,0,0,0,223,0,0,0,0,0,0,0,224,0,0,0,0,0,0,0,224,0,0,0,0,0,0,0,
+224,0,0,0,0,0,0,0,225,0,0,0,0,0,0,0,226,0,0,0,0,0,0,0,228,0,0,0,0,0,0,0,
+229,0,0,0,0,0,0,0,230,0,0,0,0,0,0,0,231,0,0,0,0,0,0,0,232,0,0,0,0,0,0,0,
+233,0,0,0,0,0,0,0,235,0,0,0,0,0,0,0,236,0,0,0,0,0,0,0,237,0,0,0,0,0,0,0,
+238,0,0,0,0,0,0,0,239,0,0,0,0,0,0,0,241,0,0,0,0,0,0,0,242,0,0,0,0,0,0,0,
+243,0,0,0,0,0,0,0,244,0,0,0,0,0,0,0,245,0,0,0,0,0,0,0,246,0,0,0,0,0,0,0,
+246,0,0,0,0,0,0,0,246,0,0,0,0,0,0,0,247,0,0,0,0,0,0,0,248,0,0,0,0,0,0,0,
+250,0,0,0,0,0,0,0,252,0,0,0,0,0,0,0,253,0,0,0,0,0,0,0,255,0,0,0,0,0,0,0,
+0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,2,1,0,0,0,0,0,0,4,1,0,0,0,0,0,0,
+10,1,0,0,0,0,0,0,11,1,0,0,0,0,0,0,12,1,0,0,0,0,0,0,13,1,0,0,0,0,0,0,
+19,1,0,0,0,0,0,0,20,1,0,0,0,0,0,0,21,1,0,0,0,0,0,0,22,1,0,0,0,0,0,0,
+23,1,0,0,0,0,0,0,24,1,0,0,0,0,0,0,25,1,0,0,0,0,0,0,26,1,0,0,0,0,0,0,
+27,1,0,0,0,0,0,0,28,1,0,0,0,0,0,0,29,1,0,0,0,0,0,0,30,1,0,0,0,0,0,0,
+31,1,0,0,0,0,0,0,32,1,0,0,0,0,0,0,33,1,0,0,0,0,0,0,34,1,0,0,0,0,0,0,
+35,1,0,0,0,0,0,0,41,1,0,0,0,0,0,0,42,1,0,0,0,0,0,0,43,1,0,0,0,0,0,0,
+48,1,0,0,0,0,0,0,50,1,0,0,0,0,0,0,51,1,0,0,0,0,0,0,51,1,0,0,0,0,0,0,
+56,1,0,0,0,0,0,0,59,1,0,0,0,0,0,0,60,1,0,0,0,0,0,0,61,1,0,0,0,0,0,0,
+62,1,0,0,0,0,0,0,62,1,0,0,0,0,0,0,62,1,0,0,0,0,0,0,64,1,0,0,0,0,0,0,
+64,1,0,0,0,0,0,0,64,1,0,0,0,0,0,0,65,1,0,0,0,0,0,0,65,1,0,0,0,0,0,0,
+65,1,0,0,0,0,0,0,66,1,0,0,0,0,0,0,3,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,19,0,0,0,0,0,0,0,
+};
+
+static const size_t bytecode_size = 16688;
+        const unsigned char * get_program_code(void)
+        {
+            return program_code;
+        }
+
+        size_t get_program_code_size(void)
+        {
+            return bytecode_size;
+        }
@@ -79,6 +79,7 @@ typedef struct _Parrot_Init_Args {
     Parrot_UInt hash_seed;
     Parrot_UInt numthreads;
     Parrot_UInt debug_flags;
+    Parrot_Int gc_evacuate_threshold;
 } Parrot_Init_Args;
 
 #define GET_INIT_STRUCT(i) do {\
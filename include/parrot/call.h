@@ -36,7 +36,8 @@ typedef struct parrot_runloop_t {
 typedef parrot_runloop_t Parrot_runloop;
 
 typedef enum {
-    CALLSIGNATURE_is_exception_FLAG      = PObj_private0_FLAG /* last element */
+    CALLSIGNATURE_is_exception_FLAG      = PObj_private0_FLAG,
+    CALLSIGNATURE_escaped_FLAG           = PObj_private1_FLAG /* last element */
 } callsignature_flags_enum;
 
 #define CALLSIGNATURE_get_FLAGS(o) (PObj_get_FLAGS(o))
@@ -52,6 +53,11 @@ typedef enum {
 #define CALLSIGNATURE_is_exception_SET(o)   CALLSIGNATURE_flag_SET(is_exception, (o))
 #define CALLSIGNATURE_is_exception_CLEAR(o) CALLSIGNATURE_flag_CLEAR(is_exception, (o))
 
+/* Mark if something captured the context, so it may be used after it returns */
+#define CALLSIGNATURE_escaped_TEST(o)  CALLSIGNATURE_flag_TEST(escaped, (o))
+#define CALLSIGNATURE_escaped_SET(o)   CALLSIGNATURE_flag_SET(escaped, (o))
+#define CALLSIGNATURE_escaped_CLEAR(o) CALLSIGNATURE_flag_CLEAR(escaped, (o))
+
 /* HEADERIZER BEGIN: src/call/pcc.c */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
@@ -60,6 +66,18 @@ INTVAL Parrot_pcc_do_run_ops(PARROT_INTERP, ARGIN(PMC *sub_obj))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+INTVAL Parrot_pcc_frame_escaped(PARROT_INTERP, ARGIN(PMC *call_object))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+INTVAL Parrot_pcc_frame_reusable(PARROT_INTERP, ARGIN(PMC *sub_obj))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 PARROT_EXPORT
 void Parrot_pcc_invoke_from_sig_object(PARROT_INTERP,
     ARGIN(PMC *sub_obj),
@@ -95,9 +113,23 @@ PARROT_WARN_UNUSED_RESULT
 PMC * Parrot_pcc_new_call_object(PARROT_INTERP)
         __attribute__nonnull__(1);
 
+PARROT_EXPORT
+void Parrot_pcc_reinvoke_from_sig_object(PARROT_INTERP,
+    ARGIN(PMC *sub_obj),
+    ARGIN(PMC *call_object))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
 #define ASSERT_ARGS_Parrot_pcc_do_run_ops __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(sub_obj))
+#define ASSERT_ARGS_Parrot_pcc_frame_escaped __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(call_object))
+#define ASSERT_ARGS_Parrot_pcc_frame_reusable __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(sub_obj))
 #define ASSERT_ARGS_Parrot_pcc_invoke_from_sig_object \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
@@ -116,6 +148,11 @@ PMC * Parrot_pcc_new_call_object(PARROT_INTERP)
     , PARROT_ASSERT_ARG(sig))
 #define ASSERT_ARGS_Parrot_pcc_new_call_object __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_pcc_reinvoke_from_sig_object \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(sub_obj) \
+    , PARROT_ASSERT_ARG(call_object))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: src/call/pcc.c */
 
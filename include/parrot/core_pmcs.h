@@ -0,0 +1,119 @@
+/* DO NOT EDIT THIS FILE
+ *
+ * Automatically generated by config/gen/core_pmcs.pm
+ */
+
+#ifndef PARROT_CORE_PMCS_H_GUARD
+#define PARROT_CORE_PMCS_H_GUARD
+
+/* &gen_from_enum(pmctypes.pasm) subst(s/enum_class_(\w+)/$1/e) */
+enum {
+    enum_class_default,			/* 0 */
+    enum_class_Null,			/* 1 */
+    enum_class_Env,			/* 2 */
+    enum_class_Key,			/* 3 */
+    enum_class_UnManagedStruct,		/* 4 */
+    enum_class_ManagedStruct,		/* 5 */
+    enum_class_Exception,		/* 6 */
+    enum_class_ParrotLibrary,		/* 7 */
+    enum_class_ParrotInterpreter,	/* 8 */
+    enum_class_LexPad,			/* 9 */
+    enum_class_Timer,			/* 10 */
+    enum_class_Pointer,			/* 11 */
+    enum_class_Sub,			/* 12 */
+    enum_class_Coroutine,		/* 13 */
+    enum_class_EventHandler,		/* 14 */
+    enum_class_Continuation,		/* 15 */
+    enum_class_ExceptionHandler,	/* 16 */
+    enum_class_NCI,			/* 17 */
+    enum_class_BigInt,			/* 18 */
+    enum_class_BigNum,			/* 19 */
+    enum_class_Complex,			/* 20 */
+    enum_class_FixedIntegerArray,	/* 21 */
+    enum_class_ResizableIntegerArray,	/* 22 */
+    enum_class_Iterator,		/* 23 */
+    enum_class_ArrayIterator,		/* 24 */
+    enum_class_HashIterator,		/* 25 */
+    enum_class_OrderedHashIterator,	/* 26 */
+    enum_class_StringIterator,		/* 27 */
+    enum_class_FixedStringArray,	/* 28 */
+    enum_class_ResizableStringArray,	/* 29 */
+    enum_class_Hash,			/* 30 */
+    enum_class_LexInfo,			/* 31 */
+    enum_class_NameSpace,		/* 32 */
+    enum_class_OrderedHash,		/* 33 */
+    enum_class_OpLib,			/* 34 */
+    enum_class_Opcode,			/* 35 */
+    enum_class_CallContext,		/* 36 */
+    enum_class_AddrRegistry,		/* 37 */
+    enum_class_Alarm,			/* 38 */
+    enum_class_ByteBuffer,		/* 39 */
+    enum_class_Capture,			/* 40 */
+    enum_class_Channel,			/* 41 */
+    enum_class_Class,			/* 42 */
+    enum_class_PMCProxy,		/* 43 */
+    enum_class_Exporter,		/* 44 */
+    enum_class_FixedBooleanArray,	/* 45 */
+    enum_class_ResizableBooleanArray,	/* 46 */
+    enum_class_FixedFloatArray,		/* 47 */
+    enum_class_ResizableFloatArray,	/* 48 */
+    enum_class_FixedPMCArray,		/* 49 */
+    enum_class_ResizablePMCArray,	/* 50 */
+    enum_class_MultiSub,		/* 51 */
+    enum_class_Handle,			/* 52 */
+    enum_class_FileHandle,		/* 53 */
+    enum_class_Socket,			/* 54 */
+    enum_class_StringHandle,		/* 55 */
+    enum_class_HashIteratorKey,		/* 56 */
+    enum_class_ImageIOFreeze,		/* 57 */
+    enum_class_ImageIOSize,		/* 58 */
+    enum_class_ImageIOStrings,		/* 59 */
+    enum_class_ImageIOThaw,		/* 60 */
+    enum_class_IMCCompiler,		/* 61 */
+    enum_class_MappedByteArray,		/* 62 */
+    enum_class_NativePCCMethod,		/* 63 */
+    enum_class_Object,			/* 64 */
+    enum_class_OS,			/* 65 */
+    enum_class_Packfile,		/* 66 */
+    enum_class_PackfileAnnotation,	/* 67 */
+    enum_class_PackfileOpMap,		/* 68 */
+    enum_class_PackfileSegment,		/* 69 */
+    enum_class_PackfileAnnotations,	/* 70 */
+    enum_class_PackfileConstantTable,	/* 71 */
+    enum_class_PackfileDirectory,	/* 72 */
+    enum_class_PackfileRawSegment,	/* 73 */
+    enum_class_PackfileBytecodeSegment,	/* 74 */
+    enum_class_PackfileDebug,		/* 75 */
+    enum_class_PackfileView,		/* 76 */
+    enum_class_PMCList,			/* 77 */
+    enum_class_Proxy,			/* 78 */
+    enum_class_Ptr,			/* 79 */
+    enum_class_PtrBuf,			/* 80 */
+    enum_class_PtrObj,			/* 81 */
+    enum_class_Role,			/* 82 */
+    enum_class_scalar,			/* 83 */
+    enum_class_Float,			/* 84 */
+    enum_class_Integer,			/* 85 */
+    enum_class_String,			/* 86 */
+    enum_class_Boolean,			/* 87 */
+    enum_class_Scheduler,		/* 88 */
+    enum_class_SchedulerMessage,	/* 89 */
+    enum_class_Sockaddr,		/* 90 */
+    enum_class_StringBuilder,		/* 91 */
+    enum_class_StructView,		/* 92 */
+    enum_class_Task,			/* 93 */
+    enum_class_Callback,		/* 94 */
+    enum_class_Undef,			/* 95 */
+    enum_class_core_max
+};
+
+/* &end_gen */
+
+#endif /* PARROT_CORE_PMCS_H_GUARD */
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ *   buffer-read-only: t
+ * End:
+ * vim: readonly expandtab shiftwidth=4:
+ */
@@ -0,0 +1,197 @@
+/* ex: set ro:
+** !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+**
+** This file is generated automatically from src/vtable.tbl by
+** tools/build/vtable_extend.pl
+*/
+
+/*
+Copyright (C) 2005-2011, Parrot Foundation.
+*/
+#ifndef PARROT_EXTEND_VTABLE_H_GUARD
+#define PARROT_EXTEND_VTABLE_H_GUARD
+
+/* Need size_t  */
+#include <stddef.h>
+
+PARROT_EXPORT Parrot_PMC Parrot_PMC_absolute( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC dest );
+PARROT_EXPORT Parrot_PMC Parrot_PMC_add( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC value, Parrot_PMC dest );
+PARROT_EXPORT void Parrot_PMC_add_attribute( PARROT_INTERP, Parrot_PMC pmc, Parrot_String name, Parrot_PMC type );
+PARROT_EXPORT Parrot_PMC Parrot_PMC_add_float( PARROT_INTERP, Parrot_PMC pmc, Parrot_Float value, Parrot_PMC dest );
+PARROT_EXPORT Parrot_PMC Parrot_PMC_add_int( PARROT_INTERP, Parrot_PMC pmc, Parrot_Int value, Parrot_PMC dest );
+PARROT_EXPORT void Parrot_PMC_add_method( PARROT_INTERP, Parrot_PMC pmc, Parrot_String method_name, Parrot_PMC sub_pmc );
+PARROT_EXPORT void Parrot_PMC_add_parent( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC parent );
+PARROT_EXPORT void Parrot_PMC_add_role( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC role );
+PARROT_EXPORT void Parrot_PMC_add_vtable_override( PARROT_INTERP, Parrot_PMC pmc, Parrot_String vtable_name, Parrot_PMC sub_pmc );
+PARROT_EXPORT void Parrot_PMC_assign_pmc( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC value );
+PARROT_EXPORT void Parrot_PMC_assign_string_native( PARROT_INTERP, Parrot_PMC pmc, Parrot_String value );
+PARROT_EXPORT Parrot_PMC Parrot_PMC_clone( PARROT_INTERP, Parrot_PMC pmc );
+PARROT_EXPORT Parrot_PMC Parrot_PMC_clone_pmc( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC args );
+PARROT_EXPORT Parrot_Int Parrot_PMC_cmp( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC value );
+PARROT_EXPORT Parrot_Int Parrot_PMC_cmp_num( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC value );
+PARROT_EXPORT Parrot_PMC Parrot_PMC_cmp_pmc( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC value );
+PARROT_EXPORT Parrot_Int Parrot_PMC_cmp_string( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC value );
+PARROT_EXPORT Parrot_PMC Parrot_PMC_concatenate( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC value, Parrot_PMC dest );
+PARROT_EXPORT Parrot_PMC Parrot_PMC_concatenate_str( PARROT_INTERP, Parrot_PMC pmc, Parrot_String value, Parrot_PMC dest );
+PARROT_EXPORT void Parrot_PMC_decrement( PARROT_INTERP, Parrot_PMC pmc );
+PARROT_EXPORT Parrot_Int Parrot_PMC_defined( PARROT_INTERP, Parrot_PMC pmc );
+PARROT_EXPORT Parrot_Int Parrot_PMC_defined_keyed( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC key );
+PARROT_EXPORT Parrot_Int Parrot_PMC_defined_keyed_int( PARROT_INTERP, Parrot_PMC pmc, Parrot_Int key );
+PARROT_EXPORT Parrot_Int Parrot_PMC_defined_keyed_str( PARROT_INTERP, Parrot_PMC pmc, Parrot_String key );
+PARROT_EXPORT void Parrot_PMC_delete_keyed( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC key );
+PARROT_EXPORT void Parrot_PMC_delete_keyed_int( PARROT_INTERP, Parrot_PMC pmc, Parrot_Int key );
+PARROT_EXPORT void Parrot_PMC_delete_keyed_str( PARROT_INTERP, Parrot_PMC pmc, Parrot_String key );
+PARROT_EXPORT Parrot_PMC Parrot_PMC_divide( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC value, Parrot_PMC dest );
+PARROT_EXPORT Parrot_PMC Parrot_PMC_divide_float( PARROT_INTERP, Parrot_PMC pmc, Parrot_Float value, Parrot_PMC dest );
+PARROT_EXPORT Parrot_PMC Parrot_PMC_divide_int( PARROT_INTERP, Parrot_PMC pmc, Parrot_Int value, Parrot_PMC dest );
+PARROT_EXPORT Parrot_Int Parrot_PMC_does( PARROT_INTERP, Parrot_PMC pmc, Parrot_String role );
+PARROT_EXPORT Parrot_Int Parrot_PMC_does_pmc( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC role );
+PARROT_EXPORT Parrot_Int Parrot_PMC_elements( PARROT_INTERP, Parrot_PMC pmc );
+PARROT_EXPORT Parrot_Int Parrot_PMC_exists_keyed( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC key );
+PARROT_EXPORT Parrot_Int Parrot_PMC_exists_keyed_int( PARROT_INTERP, Parrot_PMC pmc, Parrot_Int key );
+PARROT_EXPORT Parrot_Int Parrot_PMC_exists_keyed_str( PARROT_INTERP, Parrot_PMC pmc, Parrot_String key );
+PARROT_EXPORT Parrot_PMC Parrot_PMC_find_method( PARROT_INTERP, Parrot_PMC pmc, Parrot_String method_name );
+PARROT_EXPORT Parrot_PMC Parrot_PMC_floor_divide( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC value, Parrot_PMC dest );
+PARROT_EXPORT Parrot_PMC Parrot_PMC_floor_divide_float( PARROT_INTERP, Parrot_PMC pmc, Parrot_Float value, Parrot_PMC dest );
+PARROT_EXPORT Parrot_PMC Parrot_PMC_floor_divide_int( PARROT_INTERP, Parrot_PMC pmc, Parrot_Int value, Parrot_PMC dest );
+PARROT_EXPORT void Parrot_PMC_freeze( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC info );
+PARROT_EXPORT Parrot_PMC Parrot_PMC_get_attr_keyed( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC key, Parrot_String idx );
+PARROT_EXPORT Parrot_PMC Parrot_PMC_get_attr_str( PARROT_INTERP, Parrot_PMC pmc, Parrot_String idx );
+PARROT_EXPORT Parrot_Int Parrot_PMC_get_bool( PARROT_INTERP, Parrot_PMC pmc );
+PARROT_EXPORT Parrot_PMC Parrot_PMC_get_class( PARROT_INTERP, Parrot_PMC pmc );
+PARROT_EXPORT Parrot_Int Parrot_PMC_get_integer( PARROT_INTERP, Parrot_PMC pmc );
+PARROT_EXPORT Parrot_Int Parrot_PMC_get_integer_keyed( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC key );
+PARROT_EXPORT Parrot_Int Parrot_PMC_get_integer_keyed_int( PARROT_INTERP, Parrot_PMC pmc, Parrot_Int key );
+PARROT_EXPORT Parrot_Int Parrot_PMC_get_integer_keyed_str( PARROT_INTERP, Parrot_PMC pmc, Parrot_String key );
+PARROT_EXPORT Parrot_PMC Parrot_PMC_get_iter( PARROT_INTERP, Parrot_PMC pmc );
+PARROT_EXPORT Parrot_PMC Parrot_PMC_get_namespace( PARROT_INTERP, Parrot_PMC pmc );
+PARROT_EXPORT Parrot_Float Parrot_PMC_get_number( PARROT_INTERP, Parrot_PMC pmc );
+PARROT_EXPORT Parrot_Float Parrot_PMC_get_number_keyed( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC key );
+PARROT_EXPORT Parrot_Float Parrot_PMC_get_number_keyed_int( PARROT_INTERP, Parrot_PMC pmc, Parrot_Int key );
+PARROT_EXPORT Parrot_Float Parrot_PMC_get_number_keyed_str( PARROT_INTERP, Parrot_PMC pmc, Parrot_String key );
+PARROT_EXPORT Parrot_PMC Parrot_PMC_get_pmc( PARROT_INTERP, Parrot_PMC pmc );
+PARROT_EXPORT Parrot_PMC Parrot_PMC_get_pmc_keyed( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC key );
+PARROT_EXPORT Parrot_PMC Parrot_PMC_get_pmc_keyed_int( PARROT_INTERP, Parrot_PMC pmc, Parrot_Int key );
+PARROT_EXPORT Parrot_PMC Parrot_PMC_get_pmc_keyed_str( PARROT_INTERP, Parrot_PMC pmc, Parrot_String key );
+PARROT_EXPORT void* Parrot_PMC_get_pointer( PARROT_INTERP, Parrot_PMC pmc );
+PARROT_EXPORT void* Parrot_PMC_get_pointer_keyed( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC key );
+PARROT_EXPORT void* Parrot_PMC_get_pointer_keyed_int( PARROT_INTERP, Parrot_PMC pmc, Parrot_Int key );
+PARROT_EXPORT void* Parrot_PMC_get_pointer_keyed_str( PARROT_INTERP, Parrot_PMC pmc, Parrot_String key );
+PARROT_EXPORT Parrot_String Parrot_PMC_get_repr( PARROT_INTERP, Parrot_PMC pmc );
+PARROT_EXPORT Parrot_String Parrot_PMC_get_string( PARROT_INTERP, Parrot_PMC pmc );
+PARROT_EXPORT Parrot_String Parrot_PMC_get_string_keyed( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC key );
+PARROT_EXPORT Parrot_String Parrot_PMC_get_string_keyed_int( PARROT_INTERP, Parrot_PMC pmc, Parrot_Int key );
+PARROT_EXPORT Parrot_String Parrot_PMC_get_string_keyed_str( PARROT_INTERP, Parrot_PMC pmc, Parrot_String key );
+PARROT_EXPORT Parrot_Int Parrot_PMC_hashvalue( PARROT_INTERP, Parrot_PMC pmc );
+PARROT_EXPORT void Parrot_PMC_i_absolute( PARROT_INTERP, Parrot_PMC pmc );
+PARROT_EXPORT void Parrot_PMC_i_add( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC value );
+PARROT_EXPORT void Parrot_PMC_i_add_float( PARROT_INTERP, Parrot_PMC pmc, Parrot_Float value );
+PARROT_EXPORT void Parrot_PMC_i_add_int( PARROT_INTERP, Parrot_PMC pmc, Parrot_Int value );
+PARROT_EXPORT void Parrot_PMC_i_concatenate( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC value );
+PARROT_EXPORT void Parrot_PMC_i_concatenate_str( PARROT_INTERP, Parrot_PMC pmc, Parrot_String value );
+PARROT_EXPORT void Parrot_PMC_i_divide( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC value );
+PARROT_EXPORT void Parrot_PMC_i_divide_float( PARROT_INTERP, Parrot_PMC pmc, Parrot_Float value );
+PARROT_EXPORT void Parrot_PMC_i_divide_int( PARROT_INTERP, Parrot_PMC pmc, Parrot_Int value );
+PARROT_EXPORT void Parrot_PMC_i_floor_divide( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC value );
+PARROT_EXPORT void Parrot_PMC_i_floor_divide_float( PARROT_INTERP, Parrot_PMC pmc, Parrot_Float value );
+PARROT_EXPORT void Parrot_PMC_i_floor_divide_int( PARROT_INTERP, Parrot_PMC pmc, Parrot_Int value );
+PARROT_EXPORT void Parrot_PMC_i_modulus( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC value );
+PARROT_EXPORT void Parrot_PMC_i_modulus_float( PARROT_INTERP, Parrot_PMC pmc, Parrot_Float value );
+PARROT_EXPORT void Parrot_PMC_i_modulus_int( PARROT_INTERP, Parrot_PMC pmc, Parrot_Int value );
+PARROT_EXPORT void Parrot_PMC_i_multiply( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC value );
+PARROT_EXPORT void Parrot_PMC_i_multiply_float( PARROT_INTERP, Parrot_PMC pmc, Parrot_Float value );
+PARROT_EXPORT void Parrot_PMC_i_multiply_int( PARROT_INTERP, Parrot_PMC pmc, Parrot_Int value );
+PARROT_EXPORT void Parrot_PMC_i_neg( PARROT_INTERP, Parrot_PMC pmc );
+PARROT_EXPORT void Parrot_PMC_i_repeat( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC value );
+PARROT_EXPORT void Parrot_PMC_i_repeat_int( PARROT_INTERP, Parrot_PMC pmc, Parrot_Int value );
+PARROT_EXPORT void Parrot_PMC_i_subtract( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC value );
+PARROT_EXPORT void Parrot_PMC_i_subtract_float( PARROT_INTERP, Parrot_PMC pmc, Parrot_Float value );
+PARROT_EXPORT void Parrot_PMC_i_subtract_int( PARROT_INTERP, Parrot_PMC pmc, Parrot_Int value );
+PARROT_EXPORT void Parrot_PMC_increment( PARROT_INTERP, Parrot_PMC pmc );
+PARROT_EXPORT void Parrot_PMC_init( PARROT_INTERP, Parrot_PMC pmc );
+PARROT_EXPORT void Parrot_PMC_init_int( PARROT_INTERP, Parrot_PMC pmc, Parrot_Int initializer );
+PARROT_EXPORT void Parrot_PMC_init_pmc( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC initializer );
+PARROT_EXPORT Parrot_PMC Parrot_PMC_inspect( PARROT_INTERP, Parrot_PMC pmc );
+PARROT_EXPORT Parrot_PMC Parrot_PMC_inspect_str( PARROT_INTERP, Parrot_PMC pmc, Parrot_String what );
+PARROT_EXPORT Parrot_PMC Parrot_PMC_instantiate( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC sig );
+PARROT_EXPORT Parrot_Int Parrot_PMC_is_equal( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC value );
+PARROT_EXPORT Parrot_Int Parrot_PMC_is_equal_num( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC value );
+PARROT_EXPORT Parrot_Int Parrot_PMC_is_equal_string( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC value );
+PARROT_EXPORT Parrot_Int Parrot_PMC_is_same( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC value );
+PARROT_EXPORT Parrot_Int Parrot_PMC_isa( PARROT_INTERP, Parrot_PMC pmc, Parrot_String _class );
+PARROT_EXPORT Parrot_Int Parrot_PMC_isa_pmc( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC _class );
+PARROT_EXPORT Parrot_PMC Parrot_PMC_modulus( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC value, Parrot_PMC dest );
+PARROT_EXPORT Parrot_PMC Parrot_PMC_modulus_float( PARROT_INTERP, Parrot_PMC pmc, Parrot_Float value, Parrot_PMC dest );
+PARROT_EXPORT Parrot_PMC Parrot_PMC_modulus_int( PARROT_INTERP, Parrot_PMC pmc, Parrot_Int value, Parrot_PMC dest );
+PARROT_EXPORT void Parrot_PMC_morph( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC type );
+PARROT_EXPORT Parrot_PMC Parrot_PMC_multiply( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC value, Parrot_PMC dest );
+PARROT_EXPORT Parrot_PMC Parrot_PMC_multiply_float( PARROT_INTERP, Parrot_PMC pmc, Parrot_Float value, Parrot_PMC dest );
+PARROT_EXPORT Parrot_PMC Parrot_PMC_multiply_int( PARROT_INTERP, Parrot_PMC pmc, Parrot_Int value, Parrot_PMC dest );
+PARROT_EXPORT Parrot_String Parrot_PMC_name( PARROT_INTERP, Parrot_PMC pmc );
+PARROT_EXPORT Parrot_PMC Parrot_PMC_neg( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC dest );
+PARROT_EXPORT Parrot_Float Parrot_PMC_pop_float( PARROT_INTERP, Parrot_PMC pmc );
+PARROT_EXPORT Parrot_Int Parrot_PMC_pop_integer( PARROT_INTERP, Parrot_PMC pmc );
+PARROT_EXPORT Parrot_PMC Parrot_PMC_pop_pmc( PARROT_INTERP, Parrot_PMC pmc );
+PARROT_EXPORT Parrot_String Parrot_PMC_pop_string( PARROT_INTERP, Parrot_PMC pmc );
+PARROT_EXPORT void Parrot_PMC_push_float( PARROT_INTERP, Parrot_PMC pmc, Parrot_Float value );
+PARROT_EXPORT void Parrot_PMC_push_integer( PARROT_INTERP, Parrot_PMC pmc, Parrot_Int value );
+PARROT_EXPORT void Parrot_PMC_push_pmc( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC value );
+PARROT_EXPORT void Parrot_PMC_push_string( PARROT_INTERP, Parrot_PMC pmc, Parrot_String value );
+PARROT_EXPORT void Parrot_PMC_remove_attribute( PARROT_INTERP, Parrot_PMC pmc, Parrot_String name );
+PARROT_EXPORT void Parrot_PMC_remove_method( PARROT_INTERP, Parrot_PMC pmc, Parrot_String method_name );
+PARROT_EXPORT void Parrot_PMC_remove_parent( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC parent );
+PARROT_EXPORT void Parrot_PMC_remove_role( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC role );
+PARROT_EXPORT void Parrot_PMC_remove_vtable_override( PARROT_INTERP, Parrot_PMC pmc, Parrot_String vtable_name );
+PARROT_EXPORT Parrot_PMC Parrot_PMC_repeat( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC value, Parrot_PMC dest );
+PARROT_EXPORT Parrot_PMC Parrot_PMC_repeat_int( PARROT_INTERP, Parrot_PMC pmc, Parrot_Int value, Parrot_PMC dest );
+PARROT_EXPORT void Parrot_PMC_set_attr_keyed( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC key, Parrot_String idx, Parrot_PMC value );
+PARROT_EXPORT void Parrot_PMC_set_attr_str( PARROT_INTERP, Parrot_PMC pmc, Parrot_String idx, Parrot_PMC value );
+PARROT_EXPORT void Parrot_PMC_set_bool( PARROT_INTERP, Parrot_PMC pmc, Parrot_Int value );
+PARROT_EXPORT void Parrot_PMC_set_integer_keyed( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC key, Parrot_Int value );
+PARROT_EXPORT void Parrot_PMC_set_integer_keyed_int( PARROT_INTERP, Parrot_PMC pmc, Parrot_Int key, Parrot_Int value );
+PARROT_EXPORT void Parrot_PMC_set_integer_keyed_str( PARROT_INTERP, Parrot_PMC pmc, Parrot_String key, Parrot_Int value );
+PARROT_EXPORT void Parrot_PMC_set_integer_native( PARROT_INTERP, Parrot_PMC pmc, Parrot_Int value );
+PARROT_EXPORT void Parrot_PMC_set_number_keyed( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC key, Parrot_Float value );
+PARROT_EXPORT void Parrot_PMC_set_number_keyed_int( PARROT_INTERP, Parrot_PMC pmc, Parrot_Int key, Parrot_Float value );
+PARROT_EXPORT void Parrot_PMC_set_number_keyed_str( PARROT_INTERP, Parrot_PMC pmc, Parrot_String key, Parrot_Float value );
+PARROT_EXPORT void Parrot_PMC_set_number_native( PARROT_INTERP, Parrot_PMC pmc, Parrot_Float value );
+PARROT_EXPORT void Parrot_PMC_set_pmc( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC value );
+PARROT_EXPORT void Parrot_PMC_set_pmc_keyed( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC key, Parrot_PMC value );
+PARROT_EXPORT void Parrot_PMC_set_pmc_keyed_int( PARROT_INTERP, Parrot_PMC pmc, Parrot_Int key, Parrot_PMC value );
+PARROT_EXPORT void Parrot_PMC_set_pmc_keyed_str( PARROT_INTERP, Parrot_PMC pmc, Parrot_String key, Parrot_PMC value );
+PARROT_EXPORT void Parrot_PMC_set_pointer( PARROT_INTERP, Parrot_PMC pmc, void* value );
+PARROT_EXPORT void Parrot_PMC_set_pointer_keyed( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC key, void* value );
+PARROT_EXPORT void Parrot_PMC_set_pointer_keyed_int( PARROT_INTERP, Parrot_PMC pmc, Parrot_Int key, void* value );
+PARROT_EXPORT void Parrot_PMC_set_pointer_keyed_str( PARROT_INTERP, Parrot_PMC pmc, Parrot_String key, void* value );
+PARROT_EXPORT void Parrot_PMC_set_string_keyed( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC key, Parrot_String value );
+PARROT_EXPORT void Parrot_PMC_set_string_keyed_int( PARROT_INTERP, Parrot_PMC pmc, Parrot_Int key, Parrot_String value );
+PARROT_EXPORT void Parrot_PMC_set_string_keyed_str( PARROT_INTERP, Parrot_PMC pmc, Parrot_String key, Parrot_String value );
+PARROT_EXPORT void Parrot_PMC_set_string_native( PARROT_INTERP, Parrot_PMC pmc, Parrot_String value );
+PARROT_EXPORT void Parrot_PMC_share( PARROT_INTERP, Parrot_PMC pmc );
+PARROT_EXPORT Parrot_Float Parrot_PMC_shift_float( PARROT_INTERP, Parrot_PMC pmc );
+PARROT_EXPORT Parrot_Int Parrot_PMC_shift_integer( PARROT_INTERP, Parrot_PMC pmc );
+PARROT_EXPORT Parrot_PMC Parrot_PMC_shift_pmc( PARROT_INTERP, Parrot_PMC pmc );
+PARROT_EXPORT Parrot_String Parrot_PMC_shift_string( PARROT_INTERP, Parrot_PMC pmc );
+PARROT_EXPORT void Parrot_PMC_splice( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC value, Parrot_Int offset, Parrot_Int count );
+PARROT_EXPORT Parrot_String Parrot_PMC_substr( PARROT_INTERP, Parrot_PMC pmc, Parrot_Int offset, Parrot_Int length );
+PARROT_EXPORT Parrot_PMC Parrot_PMC_subtract( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC value, Parrot_PMC dest );
+PARROT_EXPORT Parrot_PMC Parrot_PMC_subtract_float( PARROT_INTERP, Parrot_PMC pmc, Parrot_Float value, Parrot_PMC dest );
+PARROT_EXPORT Parrot_PMC Parrot_PMC_subtract_int( PARROT_INTERP, Parrot_PMC pmc, Parrot_Int value, Parrot_PMC dest );
+PARROT_EXPORT void Parrot_PMC_thaw( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC info );
+PARROT_EXPORT void Parrot_PMC_thawfinish( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC info );
+PARROT_EXPORT Parrot_Int Parrot_PMC_type( PARROT_INTERP, Parrot_PMC pmc );
+PARROT_EXPORT void Parrot_PMC_unshift_float( PARROT_INTERP, Parrot_PMC pmc, Parrot_Float value );
+PARROT_EXPORT void Parrot_PMC_unshift_integer( PARROT_INTERP, Parrot_PMC pmc, Parrot_Int value );
+PARROT_EXPORT void Parrot_PMC_unshift_pmc( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC value );
+PARROT_EXPORT void Parrot_PMC_unshift_string( PARROT_INTERP, Parrot_PMC pmc, Parrot_String value );
+PARROT_EXPORT void Parrot_PMC_visit( PARROT_INTERP, Parrot_PMC pmc, Parrot_PMC info );
+
+#endif /* PARROT_EXTEND_VTABLE_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ *   buffer-read-only: t
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
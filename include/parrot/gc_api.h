@@ -34,6 +34,11 @@
 #define PARROT_GC_WRITE_BARRIER(i, p) \
     do { if (PObj_GC_need_write_barrier_TEST((p))) Parrot_gc_write_barrier((i), (p)); } while (0)
 
+/* Called for every new PMC; samples its allocation site every Nth time */
+#define PARROT_GC_SAMPLE_ALLOCATION(i, p) \
+    do { if ((i)->gc_alloc_countdown && !--(i)->gc_alloc_countdown) \
+        Parrot_gc_sample_allocation((i), (p)); } while (0)
+
 typedef struct _Parrot_GC_Init_Args {
     void *stacktop;
     const char *system;
@@ -42,6 +47,7 @@ typedef struct _Parrot_GC_Init_Args {
     Parrot_Int min_threshold;
     Parrot_UInt numthreads;
     Parrot_UInt debug_flags;
+    Parrot_Int evacuate_threshold;
 } Parrot_GC_Init_Args;
 
 typedef enum _gc_sys_type_enum {
@@ -122,7 +128,18 @@ typedef enum {
     PARROT_OS_VERSION,
     PARROT_OS_VERSION_NUMBER,
     CPU_ARCH,
-    CPU_TYPE
+    CPU_TYPE,
+
+    /* interpinfo constants added later. Keep them at the end, so existing
+       bytecode using literal values stays valid */
+    FIXED_SIZE_ARENAS,
+    FIXED_SIZE_FREE_MEM,
+    TOTAL_EVACUATED,
+    ARENAS_RELEASED,
+    SHARED_BUFFERS_MOVED,
+    TOTAL_SHARED,
+    GC_EVENTS,
+    GC_ALLOCATION_SITES
 } Interpinfo_enum;
 
 /* &end_gen */
@@ -198,6 +215,10 @@ void Parrot_gc_allocate_string_storage(PARROT_INTERP,
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*str);
 
+PARROT_EXPORT
+size_t Parrot_gc_arenas_released(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
 PARROT_EXPORT
 void Parrot_gc_compact_memory_pool(PARROT_INTERP)
         __attribute__nonnull__(1);
@@ -230,6 +251,14 @@ PARROT_EXPORT
 void Parrot_gc_finalize(PARROT_INTERP)
         __attribute__nonnull__(1);
 
+PARROT_EXPORT
+size_t Parrot_gc_fixed_size_arenas(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+PARROT_EXPORT
+size_t Parrot_gc_fixed_size_free_memory(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
 PARROT_EXPORT
 void Parrot_gc_free_bufferlike_header(PARROT_INTERP,
     ARGMOD(Parrot_Buffer *obj),
@@ -360,6 +389,10 @@ void Parrot_gc_reallocate_string_storage(PARROT_INTERP,
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*str);
 
+PARROT_EXPORT
+size_t Parrot_gc_shared_buffers_moved(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
 PARROT_EXPORT
 PARROT_CANNOT_RETURN_NULL
 STRING * Parrot_gc_sys_name(PARROT_INTERP)
@@ -369,6 +402,10 @@ PARROT_EXPORT
 UINTVAL Parrot_gc_total_copied(PARROT_INTERP)
         __attribute__nonnull__(1);
 
+PARROT_EXPORT
+size_t Parrot_gc_total_evacuated(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
 PARROT_EXPORT
 size_t Parrot_gc_total_memory_allocated(PARROT_INTERP)
         __attribute__nonnull__(1);
@@ -381,6 +418,10 @@ PARROT_EXPORT
 int Parrot_gc_total_pmcs(PARROT_INTERP)
         __attribute__nonnull__(1);
 
+PARROT_EXPORT
+UINTVAL Parrot_gc_total_shared(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
 PARROT_EXPORT
 int Parrot_gc_total_sized_buffers(PARROT_INTERP)
         __attribute__nonnull__(1);
@@ -442,6 +483,8 @@ void Parrot_unblock_GC_sweep(PARROT_INTERP)
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(str))
+#define ASSERT_ARGS_Parrot_gc_arenas_released __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_gc_compact_memory_pool __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_gc_completely_unblock __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -459,6 +502,11 @@ void Parrot_unblock_GC_sweep(PARROT_INTERP)
     , PARROT_ASSERT_ARG(source_interp))
 #define ASSERT_ARGS_Parrot_gc_finalize __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_gc_fixed_size_arenas __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_gc_fixed_size_free_memory \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_gc_free_bufferlike_header \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
@@ -523,10 +571,15 @@ void Parrot_unblock_GC_sweep(PARROT_INTERP)
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(str))
+#define ASSERT_ARGS_Parrot_gc_shared_buffers_moved \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_gc_sys_name __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_gc_total_copied __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_gc_total_evacuated __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_gc_total_memory_allocated \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
@@ -534,6 +587,8 @@ void Parrot_unblock_GC_sweep(PARROT_INTERP)
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_gc_total_pmcs __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_gc_total_shared __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_gc_total_sized_buffers __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_gc_write_barrier __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -552,6 +607,67 @@ void Parrot_unblock_GC_sweep(PARROT_INTERP)
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: src/gc/api.c */
 
+/* HEADERIZER BEGIN: src/gc/gc_events.c */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+PMC * Parrot_gc_allocation_sites(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+PMC * Parrot_gc_event_log(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+PARROT_EXPORT
+void Parrot_gc_sample_allocations(PARROT_INTERP, INTVAL interval)
+        __attribute__nonnull__(1);
+
+PARROT_EXPORT
+void Parrot_gc_trace_events(PARROT_INTERP, ARGIN_NULLOK(STRING *filename))
+        __attribute__nonnull__(1);
+
+void Parrot_gc_event_begin(PARROT_INTERP, INTVAL generation)
+        __attribute__nonnull__(1);
+
+void Parrot_gc_event_end(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+void Parrot_gc_events_finish(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+void Parrot_gc_events_init(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+void Parrot_gc_sample_allocation(PARROT_INTERP, ARGIN(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+#define ASSERT_ARGS_Parrot_gc_allocation_sites __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_gc_event_log __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_gc_sample_allocations __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_gc_trace_events __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_gc_event_begin __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_gc_event_end __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_gc_events_finish __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_gc_events_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_gc_sample_allocation __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmc))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: src/gc/gc_events.c */
+
 # define Parrot_gc_mark_STRING_alive(interp, obj) Parrot_gc_mark_STRING_alive_fun((interp), (obj))
 
 #if defined(PARROT_IN_CORE)
@@ -0,0 +1,155 @@
+/*
+ * ex: set ro: -*- buffer-read-only:t -*-
+ * DO NOT EDIT THIS FILE
+ * Generated by Parrot::Configure::Compiler from config/gen/config_h/has_header_h.in
+ */
+
+/* Copyright (C) 2009, Parrot Foundation.
+ */
+
+#ifndef PARROT_HAS_HEADER_H_GUARD
+#define PARROT_HAS_HEADER_H_GUARD
+
+/*
+ * i_\w+ header includes
+ */
+
+#define PARROT_HAS_HEADER_ARPAINET 1
+#undef  PARROT_HAS_HEADER_BFD
+#undef  PARROT_HAS_HEADER_BSDIOCTL
+#define PARROT_HAS_HEADER_CRYPT 1
+#define PARROT_HAS_HEADER_DB 1
+#define PARROT_HAS_HEADER_DBM 1
+#define PARROT_HAS_HEADER_DIRENT 1
+#define PARROT_HAS_HEADER_DLFCN 1
+#define PARROT_HAS_HEADER_EXECINFO 1
+#define PARROT_HAS_HEADER_FCNTL 1
+#define PARROT_HAS_HEADER_FENV 1
+#undef  PARROT_HAS_HEADER_FP
+#undef  PARROT_HAS_HEADER_FP_CLASS
+#define PARROT_HAS_HEADER_GDBM 1
+#define PARROT_HAS_HEADER_GDBM_NDBM 1
+#undef  PARROT_HAS_HEADER_GDBMNDBM
+#define PARROT_HAS_HEADER_GRP 1
+#undef  PARROT_HAS_HEADER_IEEEFP
+#define PARROT_HAS_HEADER_INTTYPES 1
+#define PARROT_HAS_HEADER_LANGINFO 1
+#undef  PARROT_HAS_HEADER_LIBCPUID
+#undef  PARROT_HAS_HEADER_LIBUTIL
+#define PARROT_HAS_HEADER_LIMITS 1
+#define PARROT_HAS_HEADER_LOCALE 1
+#undef  PARROT_HAS_HEADER_MACHCTHR
+#define PARROT_HAS_HEADER_MALLOC 1
+#undef  PARROT_HAS_HEADER_MALLOCMALLOC
+#define PARROT_HAS_HEADER_MNTENT 1
+#define PARROT_HAS_HEADER_NDBM 1
+#define PARROT_HAS_HEADER_NETDB 1
+#undef  PARROT_HAS_HEADER_NETERRNO
+#define PARROT_HAS_HEADER_NETINETIN 1
+#define PARROT_HAS_HEADER_NETINETTCP 1
+#define PARROT_HAS_HEADER_POLL 1
+#undef  PARROT_HAS_HEADER_PROT
+#define PARROT_HAS_HEADER_PTHREAD 1
+#define PARROT_HAS_HEADER_PWD 1
+#define PARROT_HAS_HEADER_QUADMATH 1
+#undef  PARROT_HAS_HEADER_RPCSVCDBM
+#define PARROT_HAS_HEADER_SETJMP 1
+#undef  PARROT_HAS_HEADER_SGTTY
+#define PARROT_HAS_HEADER_SHADOW 1
+#define PARROT_HAS_HEADER_SIGNAL 1
+#undef  PARROT_HAS_HEADER_SOCKS
+#define PARROT_HAS_HEADER_STDBOOL 1
+#define PARROT_HAS_HEADER_STDINT 1
+#define PARROT_HAS_HEADER_STDLIB 1
+#define PARROT_HAS_HEADER_STRING 1
+#undef  PARROT_HAS_HEADER_SUNMATH
+#undef  PARROT_HAS_HEADER_SYSACCESS
+#define PARROT_HAS_HEADER_SYSDIR 1
+#undef  PARROT_HAS_HEADER_SYSEXIT
+#define PARROT_HAS_HEADER_SYSFILE 1
+#undef  PARROT_HAS_HEADER_SYSFILIO
+#undef  PARROT_HAS_HEADER_SYSIN
+#define PARROT_HAS_HEADER_SYSIOCTL 1
+#define PARROT_HAS_HEADER_SYSLOG 1
+#define PARROT_HAS_HEADER_SYSMMAN 1
+#undef  PARROT_HAS_HEADER_SYSMODE
+#define PARROT_HAS_HEADER_SYSMOUNT 1
+#undef  PARROT_HAS_HEADER_SYSNDIR
+#define PARROT_HAS_HEADER_SYSPARAM 1
+#define PARROT_HAS_HEADER_SYSPOLL 1
+#define PARROT_HAS_HEADER_SYSRESOURCE 1
+#define PARROT_HAS_HEADER_SYSRESRC 1
+#undef  PARROT_HAS_HEADER_SYSSECRT
+#define PARROT_HAS_HEADER_SYSSELCT 1
+#define PARROT_HAS_HEADER_SYSSOCKET 1
+#undef  PARROT_HAS_HEADER_SYSSOCKIO
+#define PARROT_HAS_HEADER_SYSSTAT 1
+#define PARROT_HAS_HEADER_SYSSTATFS 1
+#define PARROT_HAS_HEADER_SYSSTATVFS 1
+#undef  PARROT_HAS_HEADER_SYSSYSCTL
+#define PARROT_HAS_HEADER_SYSTIME 1
+#undef  PARROT_HAS_HEADER_SYSTIMEK
+#define PARROT_HAS_HEADER_SYSTIMES 1
+#define PARROT_HAS_HEADER_SYSTYPES 1
+#define PARROT_HAS_HEADER_SYSUIO 1
+#define PARROT_HAS_HEADER_SYSUN 1
+#define PARROT_HAS_HEADER_SYSUTSNAME 1
+#define PARROT_HAS_HEADER_SYSVFS 1
+#define PARROT_HAS_HEADER_SYSWAIT 1
+#undef  PARROT_HAS_HEADER_TERMIO
+#define PARROT_HAS_HEADER_TERMIOS 1
+#define PARROT_HAS_HEADER_TIME 1
+#define PARROT_HAS_HEADER_UNISTD 1
+#undef  PARROT_HAS_HEADER_USTAT
+#define PARROT_HAS_HEADER_UTIME 1
+#undef  PARROT_HAS_HEADER_VFORK
+#define PARROT_HAS_HEADER_WCHAR 1
+#define PARROT_HAS_HEADER_WCTYPE 1
+#undef  PARROT_HAS_HEADER_XLOCALE
+
+#define BUILD_OS_NAME "linux"
+
+/*
+ * defines from commandline
+ */
+
+
+
+/*
+ * HAS_\w+ config entries
+ */
+
+#define PARROT_HAS_BSD_STAT_EXTN 1
+#define PARROT_HAS_BUILTIN_EXPECT 1
+#define PARROT_HAS_C99_SNPRINTF 1
+#define PARROT_HAS_COMPILER_OFFSETOF_ALIGNOF 1
+#define PARROT_HAS_CORE_NCI_THUNKS 1
+#define PARROT_HAS_EXTRA_NCI_THUNKS 1
+#define PARROT_HAS_GETTEXT 1
+#define PARROT_HAS_GMP 1
+#define PARROT_HAS_INF_NAN 1
+#define PARROT_HAS_INT64 1
+#define PARROT_HAS_IPV6 1
+#define PARROT_HAS_LABS 1
+#define PARROT_HAS_LIBFFI 1
+#define PARROT_HAS_LONGLONG 1
+#define PARROT_HAS_READLINE 1
+#define PARROT_HAS_SNPRINTF 1
+#define PARROT_HAS_STAT_ATIM 1
+#define PARROT_HAS_THREADS 1
+#define PARROT_HAS_TIMESPEC 1
+
+/*
+ * D_\w+ config entries
+ */
+
+
+
+#endif /* PARROT_HAS_HEADER_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -23,6 +23,28 @@ enum {
     enum_PackID_pbc_backref = 2
 };
 
+/* Streaming images, written to and read from an IO handle.
+ *
+ * The stream starts with an 8 byte header: the magic bytes, the format
+ * version, the stream flags, sizeof (FLOATVAL) and the byte order of the
+ * writer.  Then follow frames, each a varint byte count and that many bytes
+ * of payload, terminated by an empty frame.  No single item ever straddles
+ * a frame boundary, so the reader refills only between items.
+ *
+ * Integers and lengths are zigzag LEB128 varints, floats are stored raw.
+ * A string is a varint 0 for STRINGNULL, or 1 + (encoding << 2 | flags)
+ * followed by its byte length and bytes.  A PMC is a varint tag: 0 for
+ * PMCNULL, (id << 1) | 1 for a reference to an already seen PMC, or
+ * type << 1 for a new PMC whose contents follow later in the stream. */
+#define FREEZE_STREAM_MAGIC         "PFZS"
+#define FREEZE_STREAM_VERSION       1
+#define FREEZE_STREAM_HEADER_BYTES  8
+#define FREEZE_STREAM_FRAME_SIZE    8192
+#define FREEZE_STREAM_VARINT_MAX    (sizeof (UINTVAL) * 8 / 7 + 1)
+
+#define FREEZE_STREAM_ZIGZAG(i)     (((UINTVAL)(i) << 1) ^ (UINTVAL)((i) < 0 ? -1 : 0))
+#define FREEZE_STREAM_UNZIGZAG(u)   ((INTVAL)((u) >> 1) ^ -(INTVAL)((u) & 1))
+
 #endif /* PARROT_IMAGEIO_H_GUARD */
 
 /*
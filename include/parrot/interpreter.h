@@ -196,6 +196,9 @@ struct parrot_interp_t {
                                                  to current GC subsystem*/
 
     PMC     *gc_registry;                     /* root set of registered PMCs */
+    UINTVAL  gc_alloc_countdown;              /* PMC allocations until the next
+                                                 allocation site sample;
+                                                 0 if not sampling */
 
     PMC     *class_hash;                      /* Hash of classes */
     VTABLE **vtables;                         /* array of vtable ptrs */
@@ -222,6 +225,9 @@ struct parrot_interp_t {
 
     INTVAL             resume_flag;
     size_t             resume_offset;
+    volatile int       sample_requested;      /* set by the sampling profiler's
+                                               * timer, served before the next
+                                               * op */
 
     PackFile_ByteCode  *code;                 /* The code we are executing */
 
@@ -266,6 +272,9 @@ struct parrot_interp_t {
 
     STRING     **const_cstring_table;         /* CONST_STRING(x) items */
     Hash        *const_cstring_hash;          /* cache of const_string items */
+    Hash        *intern_hash;                 /* interned strings, weak */
+    Hash        *sprintf_cache;               /* compiled sprintf formats,
+                                               * see string/spf_render.c */
 
     struct _handler_node_t *exit_handler_list;/* exit.c */
     int sleeping;                             /* used during sleep in events */
@@ -279,6 +288,7 @@ struct parrot_interp_t {
 
     UINTVAL              last_alarm;          /* has an alarm triggered? */
     FLOATVAL             quantum_done;        /* expiration of current quantum */
+    UINTVAL              quantum_ticks;       /* branches left in a green thread quantum */
 
     struct _Thread_data *thread_data;         /* thread specific items */
     int                  wake_up;
@@ -320,6 +330,7 @@ typedef enum {
     IGLOBALS_PBC_LIBS,          /* Hash of load_bytecode cde */
     IGLOBALS_EXECUTABLE,        /* How Parrot was invoked (from argv[0]) */
     IGLOBALS_LOADED_PBCS,       /* Hash of .pbc file -> PackfileView */
+    IGLOBALS_LIB_CACHE,         /* located runtime files, see library.c */
 
     IGLOBALS_SIZE
 } iglobals_enum;
@@ -64,10 +64,45 @@ PARROT_EXPORT
 PARROT_WARN_UNUSED_RESULT
 INTVAL Parrot_util_int_rand(INTVAL how_random);
 
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+PARROT_PURE_FUNCTION
+const char * Parrot_util_memmem(
+    ARGIN(const char *hay),
+    size_t hay_len,
+    ARGIN(const char *needle),
+    size_t needle_len)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(3);
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+PARROT_PURE_FUNCTION
+const char * Parrot_util_memrmem(
+    ARGIN(const char *hay),
+    size_t hay_len,
+    ARGIN(const char *needle),
+    size_t needle_len)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(3);
+
 PARROT_EXPORT
 PARROT_WARN_UNUSED_RESULT
 INTVAL Parrot_util_range_rand(INTVAL from, INTVAL to, INTVAL how_random);
 
+PARROT_EXPORT
+void Parrot_util_sort(PARROT_INTERP,
+    INTVAL type,
+    ARGMOD(void *items),
+    UINTVAL n,
+    ARGIN_NULLOK(PMC *cmp),
+    ARGIN_NULLOK(PMC *key))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*items);
+
 PARROT_EXPORT
 void Parrot_util_srand(INTVAL seed);
 
@@ -90,17 +125,6 @@ PARROT_CONST_FUNCTION
 PARROT_WARN_UNUSED_RESULT
 INTVAL Parrot_util_intval_mod(INTVAL i2, INTVAL i3);
 
-void Parrot_util_quicksort(PARROT_INTERP,
-    ARGMOD(void **data),
-    UINTVAL n,
-    ARGIN(PMC *cmp),
-    ARGIN(const char * cmp_signature))
-        __attribute__nonnull__(1)
-        __attribute__nonnull__(2)
-        __attribute__nonnull__(4)
-        __attribute__nonnull__(5)
-        FUNC_MODIFIES(*data);
-
 #define ASSERT_ARGS_Parrot_util_byte_index __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(base) \
     , PARROT_ASSERT_ARG(search))
@@ -109,7 +133,16 @@ void Parrot_util_quicksort(PARROT_INTERP,
     , PARROT_ASSERT_ARG(search))
 #define ASSERT_ARGS_Parrot_util_float_rand __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS_Parrot_util_int_rand __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_Parrot_util_memmem __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(hay) \
+    , PARROT_ASSERT_ARG(needle))
+#define ASSERT_ARGS_Parrot_util_memrmem __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(hay) \
+    , PARROT_ASSERT_ARG(needle))
 #define ASSERT_ARGS_Parrot_util_range_rand __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_Parrot_util_sort __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(items))
 #define ASSERT_ARGS_Parrot_util_srand __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS_Parrot_util_tm_to_array __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
@@ -117,11 +150,6 @@ void Parrot_util_quicksort(PARROT_INTERP,
 #define ASSERT_ARGS_Parrot_util_uint_rand __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS_Parrot_util_floatval_mod __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS_Parrot_util_intval_mod __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
-#define ASSERT_ARGS_Parrot_util_quicksort __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
-       PARROT_ASSERT_ARG(interp) \
-    , PARROT_ASSERT_ARG(data) \
-    , PARROT_ASSERT_ARG(cmp) \
-    , PARROT_ASSERT_ARG(cmp_signature))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: src/utils.c */
 
@@ -34,6 +34,17 @@ typedef enum {
         ((PMC **)(x))[(y)] = (z); \
     } while (0)
 
+/*
+ * An Object attribute slot. Attributes declared with a native type hold
+ * their value unboxed; the kind of each slot is recorded in the class.
+ */
+typedef union Parrot_Object_slot {
+    PMC      *pmc;
+    STRING   *str;
+    INTVAL    ival;
+    FLOATVAL  nval;
+} Parrot_Object_slot;
+
 /*
  * class macros
  */
@@ -121,6 +132,40 @@ PMC * Parrot_oo_find_vtable_override_for_class(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+PARROT_EXPORT
+INTVAL Parrot_oo_get_attr_int_cached(PARROT_INTERP,
+    ARGIN(PMC *obj),
+    ARGIN(STRING * const *name))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+PARROT_EXPORT
+FLOATVAL Parrot_oo_get_attr_num_cached(PARROT_INTERP,
+    ARGIN(PMC *obj),
+    ARGIN(STRING * const *name))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
+PMC * Parrot_oo_get_attr_str_cached(PARROT_INTERP,
+    ARGIN(PMC *obj),
+    ARGIN(STRING * const *name))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
+STRING * Parrot_oo_get_attr_string_cached(PARROT_INTERP,
+    ARGIN(PMC *obj),
+    ARGIN(STRING * const *name))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
 PARROT_EXPORT
 PARROT_CANNOT_RETURN_NULL
 PARROT_WARN_UNUSED_RESULT
@@ -140,6 +185,42 @@ PMC * Parrot_oo_new_class_pmc(PARROT_INTERP, ARGIN(PMC *classtype))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+PARROT_EXPORT
+void Parrot_oo_set_attr_int_cached(PARROT_INTERP,
+    ARGIN(PMC *obj),
+    ARGIN(STRING * const *name),
+    INTVAL value)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+PARROT_EXPORT
+void Parrot_oo_set_attr_num_cached(PARROT_INTERP,
+    ARGIN(PMC *obj),
+    ARGIN(STRING * const *name),
+    FLOATVAL value)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+PARROT_EXPORT
+void Parrot_oo_set_attr_str_cached(PARROT_INTERP,
+    ARGIN(PMC *obj),
+    ARGIN(STRING * const *name),
+    ARGIN_NULLOK(PMC *value))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+PARROT_EXPORT
+void Parrot_oo_set_attr_string_cached(PARROT_INTERP,
+    ARGIN(PMC *obj),
+    ARGIN(STRING * const *name),
+    ARGIN_NULLOK(STRING *value))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
 void destroy_object_cache(PARROT_INTERP)
         __attribute__nonnull__(1);
 
@@ -149,6 +230,14 @@ void init_object_cache(PARROT_INTERP)
 void mark_object_cache(PARROT_INTERP)
         __attribute__nonnull__(1);
 
+void Parrot_oo_alloc_attrib_store(PARROT_INTERP,
+    ARGMOD(PMC *obj),
+    INTVAL num_attribs,
+    ARGIN_NULLOK(STRING *kinds))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*obj);
+
 PARROT_CANNOT_RETURN_NULL
 PMC * Parrot_oo_clone_object(PARROT_INTERP,
     ARGIN(PMC *pmc),
@@ -164,6 +253,15 @@ void Parrot_oo_extract_methods_from_namespace(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+PARROT_CANNOT_RETURN_NULL
+PMC * Parrot_oo_get_attrib_slot(PARROT_INTERP,
+    ARGIN(PMC *obj),
+    INTVAL index)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+void Parrot_oo_init_shapes(void);
+UINTVAL Parrot_oo_new_shape(void);
 PARROT_CANNOT_RETURN_NULL
 PARROT_WARN_UNUSED_RESULT
 PMC * Parrot_oo_newclass_from_str(PARROT_INTERP, ARGIN(STRING *name))
@@ -178,6 +276,14 @@ INTVAL Parrot_oo_register_type(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+void Parrot_oo_set_attrib_slot(PARROT_INTERP,
+    ARGMOD(PMC *obj),
+    INTVAL index,
+    ARGIN_NULLOK(PMC *value))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*obj);
+
 #define ASSERT_ARGS_Parrot_ComposeRole __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(role) \
@@ -213,6 +319,23 @@ INTVAL Parrot_oo_register_type(PARROT_INTERP,
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(classobj) \
     , PARROT_ASSERT_ARG(name))
+#define ASSERT_ARGS_Parrot_oo_get_attr_int_cached __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(obj) \
+    , PARROT_ASSERT_ARG(name))
+#define ASSERT_ARGS_Parrot_oo_get_attr_num_cached __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(obj) \
+    , PARROT_ASSERT_ARG(name))
+#define ASSERT_ARGS_Parrot_oo_get_attr_str_cached __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(obj) \
+    , PARROT_ASSERT_ARG(name))
+#define ASSERT_ARGS_Parrot_oo_get_attr_string_cached \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(obj) \
+    , PARROT_ASSERT_ARG(name))
 #define ASSERT_ARGS_Parrot_oo_get_class __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(key))
@@ -221,12 +344,32 @@ INTVAL Parrot_oo_register_type(PARROT_INTERP,
 #define ASSERT_ARGS_Parrot_oo_new_class_pmc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(classtype))
+#define ASSERT_ARGS_Parrot_oo_set_attr_int_cached __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(obj) \
+    , PARROT_ASSERT_ARG(name))
+#define ASSERT_ARGS_Parrot_oo_set_attr_num_cached __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(obj) \
+    , PARROT_ASSERT_ARG(name))
+#define ASSERT_ARGS_Parrot_oo_set_attr_str_cached __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(obj) \
+    , PARROT_ASSERT_ARG(name))
+#define ASSERT_ARGS_Parrot_oo_set_attr_string_cached \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(obj) \
+    , PARROT_ASSERT_ARG(name))
 #define ASSERT_ARGS_destroy_object_cache __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_init_object_cache __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_mark_object_cache __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_oo_alloc_attrib_store __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(obj))
 #define ASSERT_ARGS_Parrot_oo_clone_object __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pmc))
@@ -235,6 +378,11 @@ INTVAL Parrot_oo_register_type(PARROT_INTERP,
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(self) \
     , PARROT_ASSERT_ARG(ns))
+#define ASSERT_ARGS_Parrot_oo_get_attrib_slot __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(obj))
+#define ASSERT_ARGS_Parrot_oo_init_shapes __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_Parrot_oo_new_shape __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS_Parrot_oo_newclass_from_str __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(name))
@@ -242,6 +390,9 @@ INTVAL Parrot_oo_register_type(PARROT_INTERP,
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(name) \
     , PARROT_ASSERT_ARG(_namespace))
+#define ASSERT_ARGS_Parrot_oo_set_attrib_slot __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(obj))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: src/oo.c */
 
@@ -44,6 +44,21 @@ typedef enum {
 #define CLASS_has_alien_parents_SET(o)   CLASS_flag_SET(has_alien_parents, (o))
 #define CLASS_has_alien_parents_CLEAR(o) CLASS_flag_CLEAR(has_alien_parents, (o))
 
+/*
+ * Object attribute slot kinds, named after the register types. A class
+ * lists them in attrib_kinds, one byte per slot, or has no attrib_kinds
+ * when every slot holds a PMC.
+ */
+typedef enum {
+    ATTRIB_KIND_PMC    = 'P',
+    ATTRIB_KIND_INT    = 'I',
+    ATTRIB_KIND_NUM    = 'N',
+    ATTRIB_KIND_STRING = 'S'
+} attrib_kind_enum;
+
+#define ATTRIB_KIND(kinds, i) \
+    ((kinds) ? (INTVAL)((const char *)(kinds)->strstart)[(i)] : (INTVAL)ATTRIB_KIND_PMC)
+
 #endif /* PARROT_OO_PRIVATE_H_GUARD */
 
 /*
@@ -606,12 +606,30 @@ op_lib_t *PARROT_CORE_OPLIB_INIT(PARROT_INTERP, long init);
  opcode_t * Parrot_removeattribute_p_sc(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_getattribute_p_p_s(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_getattribute_p_p_sc(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_getattribute_i_p_s(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_getattribute_i_p_sc(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_getattribute_n_p_s(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_getattribute_n_p_sc(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_getattribute_s_p_s(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_getattribute_s_p_sc(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_getattribute_p_p_p_s(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_getattribute_p_p_pc_s(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_getattribute_p_p_p_sc(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_getattribute_p_p_pc_sc(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_setattribute_p_s_p(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_setattribute_p_sc_p(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_setattribute_p_s_i(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_setattribute_p_sc_i(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_setattribute_p_s_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_setattribute_p_sc_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_setattribute_p_s_n(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_setattribute_p_sc_n(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_setattribute_p_s_nc(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_setattribute_p_sc_nc(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_setattribute_p_s_s(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_setattribute_p_sc_s(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_setattribute_p_s_sc(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_setattribute_p_sc_sc(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_setattribute_p_p_s_p(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_setattribute_p_pc_s_p(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_setattribute_p_p_sc_p(opcode_t *, PARROT_INTERP);
@@ -1148,7 +1166,11 @@ op_lib_t *PARROT_CORE_OPLIB_INIT(PARROT_INTERP, long init);
  opcode_t * Parrot_pass(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_disable_preemption(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_enable_preemption(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_green_threads_i(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_green_threads_ic(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_terminate(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_intern_s_s(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_intern_s_sc(opcode_t *, PARROT_INTERP);
 
 
 #endif /* PARROT_OPLIB_CORE_OPS_H_GUARD */
@@ -600,549 +600,571 @@ typedef enum {
     PARROT_OP_removeattribute_p_sc,            /* 583 */
     PARROT_OP_getattribute_p_p_s,              /* 584 */
     PARROT_OP_getattribute_p_p_sc,             /* 585 */
-    PARROT_OP_getattribute_p_p_p_s,            /* 586 */
-    PARROT_OP_getattribute_p_p_pc_s,           /* 587 */
-    PARROT_OP_getattribute_p_p_p_sc,           /* 588 */
-    PARROT_OP_getattribute_p_p_pc_sc,          /* 589 */
-    PARROT_OP_setattribute_p_s_p,              /* 590 */
-    PARROT_OP_setattribute_p_sc_p,             /* 591 */
-    PARROT_OP_setattribute_p_p_s_p,            /* 592 */
-    PARROT_OP_setattribute_p_pc_s_p,           /* 593 */
-    PARROT_OP_setattribute_p_p_sc_p,           /* 594 */
-    PARROT_OP_setattribute_p_pc_sc_p,          /* 595 */
-    PARROT_OP_inspect_p_p,                     /* 596 */
-    PARROT_OP_inspect_p_pc,                    /* 597 */
-    PARROT_OP_inspect_p_p_s,                   /* 598 */
-    PARROT_OP_inspect_p_pc_s,                  /* 599 */
-    PARROT_OP_inspect_p_p_sc,                  /* 600 */
-    PARROT_OP_inspect_p_pc_sc,                 /* 601 */
-    PARROT_OP_new_p_s,                         /* 602 */
-    PARROT_OP_new_p_sc,                        /* 603 */
-    PARROT_OP_new_p_s_p,                       /* 604 */
-    PARROT_OP_new_p_sc_p,                      /* 605 */
-    PARROT_OP_new_p_s_pc,                      /* 606 */
-    PARROT_OP_new_p_sc_pc,                     /* 607 */
-    PARROT_OP_new_p_p,                         /* 608 */
-    PARROT_OP_new_p_pc,                        /* 609 */
-    PARROT_OP_new_p_p_p,                       /* 610 */
-    PARROT_OP_new_p_pc_p,                      /* 611 */
-    PARROT_OP_new_p_p_pc,                      /* 612 */
-    PARROT_OP_new_p_pc_pc,                     /* 613 */
-    PARROT_OP_root_new_p_p,                    /* 614 */
-    PARROT_OP_root_new_p_pc,                   /* 615 */
-    PARROT_OP_root_new_p_p_p,                  /* 616 */
-    PARROT_OP_root_new_p_pc_p,                 /* 617 */
-    PARROT_OP_root_new_p_p_pc,                 /* 618 */
-    PARROT_OP_root_new_p_pc_pc,                /* 619 */
-    PARROT_OP_typeof_s_p,                      /* 620 */
-    PARROT_OP_typeof_p_p,                      /* 621 */
-    PARROT_OP_get_repr_s_p,                    /* 622 */
-    PARROT_OP_find_method_p_p_s,               /* 623 */
-    PARROT_OP_find_method_p_p_sc,              /* 624 */
-    PARROT_OP_defined_i_p,                     /* 625 */
-    PARROT_OP_defined_i_p_ki,                  /* 626 */
-    PARROT_OP_defined_i_p_kic,                 /* 627 */
-    PARROT_OP_defined_i_p_k,                   /* 628 */
-    PARROT_OP_defined_i_p_kc,                  /* 629 */
-    PARROT_OP_exists_i_p_ki,                   /* 630 */
-    PARROT_OP_exists_i_p_kic,                  /* 631 */
-    PARROT_OP_exists_i_p_k,                    /* 632 */
-    PARROT_OP_exists_i_p_kc,                   /* 633 */
-    PARROT_OP_delete_p_k,                      /* 634 */
-    PARROT_OP_delete_p_kc,                     /* 635 */
-    PARROT_OP_delete_p_ki,                     /* 636 */
-    PARROT_OP_delete_p_kic,                    /* 637 */
-    PARROT_OP_elements_i_p,                    /* 638 */
-    PARROT_OP_push_p_i,                        /* 639 */
-    PARROT_OP_push_p_ic,                       /* 640 */
-    PARROT_OP_push_p_n,                        /* 641 */
-    PARROT_OP_push_p_nc,                       /* 642 */
-    PARROT_OP_push_p_s,                        /* 643 */
-    PARROT_OP_push_p_sc,                       /* 644 */
-    PARROT_OP_push_p_p,                        /* 645 */
-    PARROT_OP_pop_i_p,                         /* 646 */
-    PARROT_OP_pop_n_p,                         /* 647 */
-    PARROT_OP_pop_s_p,                         /* 648 */
-    PARROT_OP_pop_p_p,                         /* 649 */
-    PARROT_OP_unshift_p_i,                     /* 650 */
-    PARROT_OP_unshift_p_ic,                    /* 651 */
-    PARROT_OP_unshift_p_n,                     /* 652 */
-    PARROT_OP_unshift_p_nc,                    /* 653 */
-    PARROT_OP_unshift_p_s,                     /* 654 */
-    PARROT_OP_unshift_p_sc,                    /* 655 */
-    PARROT_OP_unshift_p_p,                     /* 656 */
-    PARROT_OP_shift_i_p,                       /* 657 */
-    PARROT_OP_shift_n_p,                       /* 658 */
-    PARROT_OP_shift_s_p,                       /* 659 */
-    PARROT_OP_shift_p_p,                       /* 660 */
-    PARROT_OP_splice_p_p_i_i,                  /* 661 */
-    PARROT_OP_splice_p_p_ic_i,                 /* 662 */
-    PARROT_OP_splice_p_p_i_ic,                 /* 663 */
-    PARROT_OP_splice_p_p_ic_ic,                /* 664 */
-    PARROT_OP_setprop_p_s_p,                   /* 665 */
-    PARROT_OP_setprop_p_sc_p,                  /* 666 */
-    PARROT_OP_getprop_p_s_p,                   /* 667 */
-    PARROT_OP_getprop_p_sc_p,                  /* 668 */
-    PARROT_OP_getprop_p_p_s,                   /* 669 */
-    PARROT_OP_getprop_p_p_sc,                  /* 670 */
-    PARROT_OP_delprop_p_s,                     /* 671 */
-    PARROT_OP_delprop_p_sc,                    /* 672 */
-    PARROT_OP_prophash_p_p,                    /* 673 */
-    PARROT_OP_freeze_s_p,                      /* 674 */
-    PARROT_OP_thaw_p_s,                        /* 675 */
-    PARROT_OP_thaw_p_sc,                       /* 676 */
-    PARROT_OP_add_multi_s_s_p,                 /* 677 */
-    PARROT_OP_add_multi_sc_s_p,                /* 678 */
-    PARROT_OP_add_multi_s_sc_p,                /* 679 */
-    PARROT_OP_add_multi_sc_sc_p,               /* 680 */
-    PARROT_OP_find_multi_p_s_s,                /* 681 */
-    PARROT_OP_find_multi_p_sc_s,               /* 682 */
-    PARROT_OP_find_multi_p_s_sc,               /* 683 */
-    PARROT_OP_find_multi_p_sc_sc,              /* 684 */
-    PARROT_OP_register_p,                      /* 685 */
-    PARROT_OP_unregister_p,                    /* 686 */
-    PARROT_OP_box_p_i,                         /* 687 */
-    PARROT_OP_box_p_ic,                        /* 688 */
-    PARROT_OP_box_p_n,                         /* 689 */
-    PARROT_OP_box_p_nc,                        /* 690 */
-    PARROT_OP_box_p_s,                         /* 691 */
-    PARROT_OP_box_p_sc,                        /* 692 */
-    PARROT_OP_iter_p_p,                        /* 693 */
-    PARROT_OP_morph_p_p,                       /* 694 */
-    PARROT_OP_morph_p_pc,                      /* 695 */
-    PARROT_OP_clone_s_s,                       /* 696 */
-    PARROT_OP_clone_s_sc,                      /* 697 */
-    PARROT_OP_set_i_i,                         /* 698 */
-    PARROT_OP_set_i_ic,                        /* 699 */
-    PARROT_OP_set_i_n,                         /* 700 */
-    PARROT_OP_set_i_nc,                        /* 701 */
-    PARROT_OP_set_i_s,                         /* 702 */
-    PARROT_OP_set_i_sc,                        /* 703 */
-    PARROT_OP_set_n_n,                         /* 704 */
-    PARROT_OP_set_n_nc,                        /* 705 */
-    PARROT_OP_set_n_i,                         /* 706 */
-    PARROT_OP_set_n_ic,                        /* 707 */
-    PARROT_OP_set_n_s,                         /* 708 */
-    PARROT_OP_set_n_sc,                        /* 709 */
-    PARROT_OP_set_n_p,                         /* 710 */
-    PARROT_OP_set_s_p,                         /* 711 */
-    PARROT_OP_set_s_s,                         /* 712 */
-    PARROT_OP_set_s_sc,                        /* 713 */
-    PARROT_OP_set_s_i,                         /* 714 */
-    PARROT_OP_set_s_ic,                        /* 715 */
-    PARROT_OP_set_s_n,                         /* 716 */
-    PARROT_OP_set_s_nc,                        /* 717 */
-    PARROT_OP_set_p_pc,                        /* 718 */
-    PARROT_OP_set_p_p,                         /* 719 */
-    PARROT_OP_set_p_i,                         /* 720 */
-    PARROT_OP_set_p_ic,                        /* 721 */
-    PARROT_OP_set_p_n,                         /* 722 */
-    PARROT_OP_set_p_nc,                        /* 723 */
-    PARROT_OP_set_p_s,                         /* 724 */
-    PARROT_OP_set_p_sc,                        /* 725 */
-    PARROT_OP_set_i_p,                         /* 726 */
-    PARROT_OP_assign_p_p,                      /* 727 */
-    PARROT_OP_assign_p_i,                      /* 728 */
-    PARROT_OP_assign_p_ic,                     /* 729 */
-    PARROT_OP_assign_p_n,                      /* 730 */
-    PARROT_OP_assign_p_nc,                     /* 731 */
-    PARROT_OP_assign_p_s,                      /* 732 */
-    PARROT_OP_assign_p_sc,                     /* 733 */
-    PARROT_OP_assign_s_s,                      /* 734 */
-    PARROT_OP_assign_s_sc,                     /* 735 */
-    PARROT_OP_setref_p_p,                      /* 736 */
-    PARROT_OP_deref_p_p,                       /* 737 */
-    PARROT_OP_set_p_ki_i,                      /* 738 */
-    PARROT_OP_set_p_kic_i,                     /* 739 */
-    PARROT_OP_set_p_ki_ic,                     /* 740 */
-    PARROT_OP_set_p_kic_ic,                    /* 741 */
-    PARROT_OP_set_p_ki_n,                      /* 742 */
-    PARROT_OP_set_p_kic_n,                     /* 743 */
-    PARROT_OP_set_p_ki_nc,                     /* 744 */
-    PARROT_OP_set_p_kic_nc,                    /* 745 */
-    PARROT_OP_set_p_ki_s,                      /* 746 */
-    PARROT_OP_set_p_kic_s,                     /* 747 */
-    PARROT_OP_set_p_ki_sc,                     /* 748 */
-    PARROT_OP_set_p_kic_sc,                    /* 749 */
-    PARROT_OP_set_p_ki_p,                      /* 750 */
-    PARROT_OP_set_p_kic_p,                     /* 751 */
-    PARROT_OP_set_i_p_ki,                      /* 752 */
-    PARROT_OP_set_i_p_kic,                     /* 753 */
-    PARROT_OP_set_n_p_ki,                      /* 754 */
-    PARROT_OP_set_n_p_kic,                     /* 755 */
-    PARROT_OP_set_s_p_ki,                      /* 756 */
-    PARROT_OP_set_s_p_kic,                     /* 757 */
-    PARROT_OP_set_p_p_ki,                      /* 758 */
-    PARROT_OP_set_p_p_kic,                     /* 759 */
-    PARROT_OP_set_p_k_i,                       /* 760 */
-    PARROT_OP_set_p_kc_i,                      /* 761 */
-    PARROT_OP_set_p_k_ic,                      /* 762 */
-    PARROT_OP_set_p_kc_ic,                     /* 763 */
-    PARROT_OP_set_p_k_n,                       /* 764 */
-    PARROT_OP_set_p_kc_n,                      /* 765 */
-    PARROT_OP_set_p_k_nc,                      /* 766 */
-    PARROT_OP_set_p_kc_nc,                     /* 767 */
-    PARROT_OP_set_p_k_s,                       /* 768 */
-    PARROT_OP_set_p_kc_s,                      /* 769 */
-    PARROT_OP_set_p_k_sc,                      /* 770 */
-    PARROT_OP_set_p_kc_sc,                     /* 771 */
-    PARROT_OP_set_p_k_p,                       /* 772 */
-    PARROT_OP_set_p_kc_p,                      /* 773 */
-    PARROT_OP_set_i_p_k,                       /* 774 */
-    PARROT_OP_set_i_p_kc,                      /* 775 */
-    PARROT_OP_set_n_p_k,                       /* 776 */
-    PARROT_OP_set_n_p_kc,                      /* 777 */
-    PARROT_OP_set_s_p_k,                       /* 778 */
-    PARROT_OP_set_s_p_kc,                      /* 779 */
-    PARROT_OP_set_p_p_k,                       /* 780 */
-    PARROT_OP_set_p_p_kc,                      /* 781 */
-    PARROT_OP_clone_p_p,                       /* 782 */
-    PARROT_OP_clone_p_p_p,                     /* 783 */
-    PARROT_OP_clone_p_p_pc,                    /* 784 */
-    PARROT_OP_copy_p_p,                        /* 785 */
-    PARROT_OP_null_s,                          /* 786 */
-    PARROT_OP_null_i,                          /* 787 */
-    PARROT_OP_null_p,                          /* 788 */
-    PARROT_OP_null_n,                          /* 789 */
-    PARROT_OP_ord_i_s,                         /* 790 */
-    PARROT_OP_ord_i_sc,                        /* 791 */
-    PARROT_OP_ord_i_s_i,                       /* 792 */
-    PARROT_OP_ord_i_sc_i,                      /* 793 */
-    PARROT_OP_ord_i_s_ic,                      /* 794 */
-    PARROT_OP_ord_i_sc_ic,                     /* 795 */
-    PARROT_OP_chr_s_i,                         /* 796 */
-    PARROT_OP_chr_s_ic,                        /* 797 */
-    PARROT_OP_chopn_s_s_i,                     /* 798 */
-    PARROT_OP_chopn_s_sc_i,                    /* 799 */
-    PARROT_OP_chopn_s_s_ic,                    /* 800 */
-    PARROT_OP_chopn_s_sc_ic,                   /* 801 */
-    PARROT_OP_concat_p_p,                      /* 802 */
-    PARROT_OP_concat_p_s,                      /* 803 */
-    PARROT_OP_concat_p_sc,                     /* 804 */
-    PARROT_OP_concat_s_s_s,                    /* 805 */
-    PARROT_OP_concat_s_sc_s,                   /* 806 */
-    PARROT_OP_concat_s_s_sc,                   /* 807 */
-    PARROT_OP_concat_p_p_s,                    /* 808 */
-    PARROT_OP_concat_p_p_sc,                   /* 809 */
-    PARROT_OP_concat_p_p_p,                    /* 810 */
-    PARROT_OP_repeat_s_s_i,                    /* 811 */
-    PARROT_OP_repeat_s_sc_i,                   /* 812 */
-    PARROT_OP_repeat_s_s_ic,                   /* 813 */
-    PARROT_OP_repeat_s_sc_ic,                  /* 814 */
-    PARROT_OP_repeat_p_p_i,                    /* 815 */
-    PARROT_OP_repeat_p_p_ic,                   /* 816 */
-    PARROT_OP_repeat_p_p_p,                    /* 817 */
-    PARROT_OP_repeat_p_i,                      /* 818 */
-    PARROT_OP_repeat_p_ic,                     /* 819 */
-    PARROT_OP_repeat_p_p,                      /* 820 */
-    PARROT_OP_length_i_s,                      /* 821 */
-    PARROT_OP_length_i_sc,                     /* 822 */
-    PARROT_OP_bytelength_i_s,                  /* 823 */
-    PARROT_OP_bytelength_i_sc,                 /* 824 */
-    PARROT_OP_pin_s,                           /* 825 */
-    PARROT_OP_unpin_s,                         /* 826 */
-    PARROT_OP_substr_s_s_i,                    /* 827 */
-    PARROT_OP_substr_s_sc_i,                   /* 828 */
-    PARROT_OP_substr_s_s_ic,                   /* 829 */
-    PARROT_OP_substr_s_sc_ic,                  /* 830 */
-    PARROT_OP_substr_s_s_i_i,                  /* 831 */
-    PARROT_OP_substr_s_sc_i_i,                 /* 832 */
-    PARROT_OP_substr_s_s_ic_i,                 /* 833 */
-    PARROT_OP_substr_s_sc_ic_i,                /* 834 */
-    PARROT_OP_substr_s_s_i_ic,                 /* 835 */
-    PARROT_OP_substr_s_sc_i_ic,                /* 836 */
-    PARROT_OP_substr_s_s_ic_ic,                /* 837 */
-    PARROT_OP_substr_s_sc_ic_ic,               /* 838 */
-    PARROT_OP_substr_s_p_i_i,                  /* 839 */
-    PARROT_OP_substr_s_p_ic_i,                 /* 840 */
-    PARROT_OP_substr_s_p_i_ic,                 /* 841 */
-    PARROT_OP_substr_s_p_ic_ic,                /* 842 */
-    PARROT_OP_replace_s_s_i_i_s,               /* 843 */
-    PARROT_OP_replace_s_sc_i_i_s,              /* 844 */
-    PARROT_OP_replace_s_s_ic_i_s,              /* 845 */
-    PARROT_OP_replace_s_sc_ic_i_s,             /* 846 */
-    PARROT_OP_replace_s_s_i_ic_s,              /* 847 */
-    PARROT_OP_replace_s_sc_i_ic_s,             /* 848 */
-    PARROT_OP_replace_s_s_ic_ic_s,             /* 849 */
-    PARROT_OP_replace_s_sc_ic_ic_s,            /* 850 */
-    PARROT_OP_replace_s_s_i_i_sc,              /* 851 */
-    PARROT_OP_replace_s_sc_i_i_sc,             /* 852 */
-    PARROT_OP_replace_s_s_ic_i_sc,             /* 853 */
-    PARROT_OP_replace_s_sc_ic_i_sc,            /* 854 */
-    PARROT_OP_replace_s_s_i_ic_sc,             /* 855 */
-    PARROT_OP_replace_s_sc_i_ic_sc,            /* 856 */
-    PARROT_OP_replace_s_s_ic_ic_sc,            /* 857 */
-    PARROT_OP_replace_s_sc_ic_ic_sc,           /* 858 */
-    PARROT_OP_index_i_s_s,                     /* 859 */
-    PARROT_OP_index_i_sc_s,                    /* 860 */
-    PARROT_OP_index_i_s_sc,                    /* 861 */
-    PARROT_OP_index_i_sc_sc,                   /* 862 */
-    PARROT_OP_index_i_s_s_i,                   /* 863 */
-    PARROT_OP_index_i_sc_s_i,                  /* 864 */
-    PARROT_OP_index_i_s_sc_i,                  /* 865 */
-    PARROT_OP_index_i_sc_sc_i,                 /* 866 */
-    PARROT_OP_index_i_s_s_ic,                  /* 867 */
-    PARROT_OP_index_i_sc_s_ic,                 /* 868 */
-    PARROT_OP_index_i_s_sc_ic,                 /* 869 */
-    PARROT_OP_index_i_sc_sc_ic,                /* 870 */
-    PARROT_OP_rindex_i_s_s,                    /* 871 */
-    PARROT_OP_rindex_i_sc_s,                   /* 872 */
-    PARROT_OP_rindex_i_s_sc,                   /* 873 */
-    PARROT_OP_rindex_i_sc_sc,                  /* 874 */
-    PARROT_OP_rindex_i_s_s_i,                  /* 875 */
-    PARROT_OP_rindex_i_sc_s_i,                 /* 876 */
-    PARROT_OP_rindex_i_s_sc_i,                 /* 877 */
-    PARROT_OP_rindex_i_sc_sc_i,                /* 878 */
-    PARROT_OP_rindex_i_s_s_ic,                 /* 879 */
-    PARROT_OP_rindex_i_sc_s_ic,                /* 880 */
-    PARROT_OP_rindex_i_s_sc_ic,                /* 881 */
-    PARROT_OP_rindex_i_sc_sc_ic,               /* 882 */
-    PARROT_OP_sprintf_s_s_p,                   /* 883 */
-    PARROT_OP_sprintf_s_sc_p,                  /* 884 */
-    PARROT_OP_sprintf_p_p_p,                   /* 885 */
-    PARROT_OP_new_s,                           /* 886 */
-    PARROT_OP_stringinfo_i_s_i,                /* 887 */
-    PARROT_OP_stringinfo_i_sc_i,               /* 888 */
-    PARROT_OP_stringinfo_i_s_ic,               /* 889 */
-    PARROT_OP_stringinfo_i_sc_ic,              /* 890 */
-    PARROT_OP_upcase_s_s,                      /* 891 */
-    PARROT_OP_upcase_s_sc,                     /* 892 */
-    PARROT_OP_downcase_s_s,                    /* 893 */
-    PARROT_OP_downcase_s_sc,                   /* 894 */
-    PARROT_OP_titlecase_s_s,                   /* 895 */
-    PARROT_OP_titlecase_s_sc,                  /* 896 */
-    PARROT_OP_join_s_s_p,                      /* 897 */
-    PARROT_OP_join_s_sc_p,                     /* 898 */
-    PARROT_OP_split_p_s_s,                     /* 899 */
-    PARROT_OP_split_p_sc_s,                    /* 900 */
-    PARROT_OP_split_p_s_sc,                    /* 901 */
-    PARROT_OP_split_p_sc_sc,                   /* 902 */
-    PARROT_OP_encoding_i_s,                    /* 903 */
-    PARROT_OP_encoding_i_sc,                   /* 904 */
-    PARROT_OP_encodingname_s_i,                /* 905 */
-    PARROT_OP_encodingname_s_ic,               /* 906 */
-    PARROT_OP_find_encoding_i_s,               /* 907 */
-    PARROT_OP_find_encoding_i_sc,              /* 908 */
-    PARROT_OP_trans_encoding_s_s_i,            /* 909 */
-    PARROT_OP_trans_encoding_s_sc_i,           /* 910 */
-    PARROT_OP_trans_encoding_s_s_ic,           /* 911 */
-    PARROT_OP_trans_encoding_s_sc_ic,          /* 912 */
-    PARROT_OP_is_cclass_i_i_s_i,               /* 913 */
-    PARROT_OP_is_cclass_i_ic_s_i,              /* 914 */
-    PARROT_OP_is_cclass_i_i_sc_i,              /* 915 */
-    PARROT_OP_is_cclass_i_ic_sc_i,             /* 916 */
-    PARROT_OP_is_cclass_i_i_s_ic,              /* 917 */
-    PARROT_OP_is_cclass_i_ic_s_ic,             /* 918 */
-    PARROT_OP_is_cclass_i_i_sc_ic,             /* 919 */
-    PARROT_OP_is_cclass_i_ic_sc_ic,            /* 920 */
-    PARROT_OP_find_cclass_i_i_s_i_i,           /* 921 */
-    PARROT_OP_find_cclass_i_ic_s_i_i,          /* 922 */
-    PARROT_OP_find_cclass_i_i_sc_i_i,          /* 923 */
-    PARROT_OP_find_cclass_i_ic_sc_i_i,         /* 924 */
-    PARROT_OP_find_cclass_i_i_s_ic_i,          /* 925 */
-    PARROT_OP_find_cclass_i_ic_s_ic_i,         /* 926 */
-    PARROT_OP_find_cclass_i_i_sc_ic_i,         /* 927 */
-    PARROT_OP_find_cclass_i_ic_sc_ic_i,        /* 928 */
-    PARROT_OP_find_cclass_i_i_s_i_ic,          /* 929 */
-    PARROT_OP_find_cclass_i_ic_s_i_ic,         /* 930 */
-    PARROT_OP_find_cclass_i_i_sc_i_ic,         /* 931 */
-    PARROT_OP_find_cclass_i_ic_sc_i_ic,        /* 932 */
-    PARROT_OP_find_cclass_i_i_s_ic_ic,         /* 933 */
-    PARROT_OP_find_cclass_i_ic_s_ic_ic,        /* 934 */
-    PARROT_OP_find_cclass_i_i_sc_ic_ic,        /* 935 */
-    PARROT_OP_find_cclass_i_ic_sc_ic_ic,       /* 936 */
-    PARROT_OP_find_not_cclass_i_i_s_i_i,       /* 937 */
-    PARROT_OP_find_not_cclass_i_ic_s_i_i,      /* 938 */
-    PARROT_OP_find_not_cclass_i_i_sc_i_i,      /* 939 */
-    PARROT_OP_find_not_cclass_i_ic_sc_i_i,     /* 940 */
-    PARROT_OP_find_not_cclass_i_i_s_ic_i,      /* 941 */
-    PARROT_OP_find_not_cclass_i_ic_s_ic_i,     /* 942 */
-    PARROT_OP_find_not_cclass_i_i_sc_ic_i,     /* 943 */
-    PARROT_OP_find_not_cclass_i_ic_sc_ic_i,    /* 944 */
-    PARROT_OP_find_not_cclass_i_i_s_i_ic,      /* 945 */
-    PARROT_OP_find_not_cclass_i_ic_s_i_ic,     /* 946 */
-    PARROT_OP_find_not_cclass_i_i_sc_i_ic,     /* 947 */
-    PARROT_OP_find_not_cclass_i_ic_sc_i_ic,    /* 948 */
-    PARROT_OP_find_not_cclass_i_i_s_ic_ic,     /* 949 */
-    PARROT_OP_find_not_cclass_i_ic_s_ic_ic,    /* 950 */
-    PARROT_OP_find_not_cclass_i_i_sc_ic_ic,    /* 951 */
-    PARROT_OP_find_not_cclass_i_ic_sc_ic_ic,   /* 952 */
-    PARROT_OP_escape_s_s,                      /* 953 */
-    PARROT_OP_compose_s_s,                     /* 954 */
-    PARROT_OP_compose_s_sc,                    /* 955 */
-    PARROT_OP_find_codepoint_i_s,              /* 956 */
-    PARROT_OP_find_codepoint_i_sc,             /* 957 */
-    PARROT_OP_spawnw_i_s,                      /* 958 */
-    PARROT_OP_spawnw_i_sc,                     /* 959 */
-    PARROT_OP_spawnw_i_p,                      /* 960 */
-    PARROT_OP_err_i,                           /* 961 */
-    PARROT_OP_err_s,                           /* 962 */
-    PARROT_OP_err_s_i,                         /* 963 */
-    PARROT_OP_err_s_ic,                        /* 964 */
-    PARROT_OP_time_i,                          /* 965 */
-    PARROT_OP_time_n,                          /* 966 */
-    PARROT_OP_sleep_i,                         /* 967 */
-    PARROT_OP_sleep_ic,                        /* 968 */
-    PARROT_OP_sleep_n,                         /* 969 */
-    PARROT_OP_sleep_nc,                        /* 970 */
-    PARROT_OP_store_lex_s_p,                   /* 971 */
-    PARROT_OP_store_lex_sc_p,                  /* 972 */
-    PARROT_OP_store_lex_s_s,                   /* 973 */
-    PARROT_OP_store_lex_sc_s,                  /* 974 */
-    PARROT_OP_store_lex_s_sc,                  /* 975 */
-    PARROT_OP_store_lex_sc_sc,                 /* 976 */
-    PARROT_OP_store_lex_s_i,                   /* 977 */
-    PARROT_OP_store_lex_sc_i,                  /* 978 */
-    PARROT_OP_store_lex_s_ic,                  /* 979 */
-    PARROT_OP_store_lex_sc_ic,                 /* 980 */
-    PARROT_OP_store_lex_s_n,                   /* 981 */
-    PARROT_OP_store_lex_sc_n,                  /* 982 */
-    PARROT_OP_store_lex_s_nc,                  /* 983 */
-    PARROT_OP_store_lex_sc_nc,                 /* 984 */
-    PARROT_OP_store_dynamic_lex_s_p,           /* 985 */
-    PARROT_OP_store_dynamic_lex_sc_p,          /* 986 */
-    PARROT_OP_find_lex_p_s,                    /* 987 */
-    PARROT_OP_find_lex_p_sc,                   /* 988 */
-    PARROT_OP_find_lex_s_s,                    /* 989 */
-    PARROT_OP_find_lex_s_sc,                   /* 990 */
-    PARROT_OP_find_lex_i_s,                    /* 991 */
-    PARROT_OP_find_lex_i_sc,                   /* 992 */
-    PARROT_OP_find_lex_n_s,                    /* 993 */
-    PARROT_OP_find_lex_n_sc,                   /* 994 */
-    PARROT_OP_find_dynamic_lex_p_s,            /* 995 */
-    PARROT_OP_find_dynamic_lex_p_sc,           /* 996 */
-    PARROT_OP_find_caller_lex_p_s,             /* 997 */
-    PARROT_OP_find_caller_lex_p_sc,            /* 998 */
-    PARROT_OP_get_namespace_p,                 /* 999 */
-    PARROT_OP_get_namespace_p_p,               /* 1000 */
-    PARROT_OP_get_namespace_p_pc,              /* 1001 */
-    PARROT_OP_get_hll_namespace_p,             /* 1002 */
-    PARROT_OP_get_hll_namespace_p_p,           /* 1003 */
-    PARROT_OP_get_hll_namespace_p_pc,          /* 1004 */
-    PARROT_OP_get_root_namespace_p,            /* 1005 */
-    PARROT_OP_get_root_namespace_p_p,          /* 1006 */
-    PARROT_OP_get_root_namespace_p_pc,         /* 1007 */
-    PARROT_OP_get_global_p_s,                  /* 1008 */
-    PARROT_OP_get_global_p_sc,                 /* 1009 */
-    PARROT_OP_get_global_p_p_s,                /* 1010 */
-    PARROT_OP_get_global_p_pc_s,               /* 1011 */
-    PARROT_OP_get_global_p_p_sc,               /* 1012 */
-    PARROT_OP_get_global_p_pc_sc,              /* 1013 */
-    PARROT_OP_get_hll_global_p_s,              /* 1014 */
-    PARROT_OP_get_hll_global_p_sc,             /* 1015 */
-    PARROT_OP_get_hll_global_p_p_s,            /* 1016 */
-    PARROT_OP_get_hll_global_p_pc_s,           /* 1017 */
-    PARROT_OP_get_hll_global_p_p_sc,           /* 1018 */
-    PARROT_OP_get_hll_global_p_pc_sc,          /* 1019 */
-    PARROT_OP_get_root_global_p_s,             /* 1020 */
-    PARROT_OP_get_root_global_p_sc,            /* 1021 */
-    PARROT_OP_get_root_global_p_p_s,           /* 1022 */
-    PARROT_OP_get_root_global_p_pc_s,          /* 1023 */
-    PARROT_OP_get_root_global_p_p_sc,          /* 1024 */
-    PARROT_OP_get_root_global_p_pc_sc,         /* 1025 */
-    PARROT_OP_set_global_s_p,                  /* 1026 */
-    PARROT_OP_set_global_sc_p,                 /* 1027 */
-    PARROT_OP_set_global_p_s_p,                /* 1028 */
-    PARROT_OP_set_global_pc_s_p,               /* 1029 */
-    PARROT_OP_set_global_p_sc_p,               /* 1030 */
-    PARROT_OP_set_global_pc_sc_p,              /* 1031 */
-    PARROT_OP_set_hll_global_s_p,              /* 1032 */
-    PARROT_OP_set_hll_global_sc_p,             /* 1033 */
-    PARROT_OP_set_hll_global_p_s_p,            /* 1034 */
-    PARROT_OP_set_hll_global_pc_s_p,           /* 1035 */
-    PARROT_OP_set_hll_global_p_sc_p,           /* 1036 */
-    PARROT_OP_set_hll_global_pc_sc_p,          /* 1037 */
-    PARROT_OP_set_root_global_s_p,             /* 1038 */
-    PARROT_OP_set_root_global_sc_p,            /* 1039 */
-    PARROT_OP_set_root_global_p_s_p,           /* 1040 */
-    PARROT_OP_set_root_global_pc_s_p,          /* 1041 */
-    PARROT_OP_set_root_global_p_sc_p,          /* 1042 */
-    PARROT_OP_set_root_global_pc_sc_p,         /* 1043 */
-    PARROT_OP_find_name_p_s,                   /* 1044 */
-    PARROT_OP_find_name_p_sc,                  /* 1045 */
-    PARROT_OP_find_sub_not_null_p_s,           /* 1046 */
-    PARROT_OP_find_sub_not_null_p_sc,          /* 1047 */
-    PARROT_OP_trap,                            /* 1048 */
-    PARROT_OP_set_label_p_ic,                  /* 1049 */
-    PARROT_OP_get_label_i_p,                   /* 1050 */
-    PARROT_OP_get_id_i_p,                      /* 1051 */
-    PARROT_OP_get_id_i_pc,                     /* 1052 */
-    PARROT_OP_fetch_p_p_p_p,                   /* 1053 */
-    PARROT_OP_fetch_p_pc_p_p,                  /* 1054 */
-    PARROT_OP_fetch_p_p_pc_p,                  /* 1055 */
-    PARROT_OP_fetch_p_pc_pc_p,                 /* 1056 */
-    PARROT_OP_fetch_p_p_p_pc,                  /* 1057 */
-    PARROT_OP_fetch_p_pc_p_pc,                 /* 1058 */
-    PARROT_OP_fetch_p_p_pc_pc,                 /* 1059 */
-    PARROT_OP_fetch_p_pc_pc_pc,                /* 1060 */
-    PARROT_OP_fetch_p_p_i_p,                   /* 1061 */
-    PARROT_OP_fetch_p_pc_i_p,                  /* 1062 */
-    PARROT_OP_fetch_p_p_ic_p,                  /* 1063 */
-    PARROT_OP_fetch_p_pc_ic_p,                 /* 1064 */
-    PARROT_OP_fetch_p_p_i_pc,                  /* 1065 */
-    PARROT_OP_fetch_p_pc_i_pc,                 /* 1066 */
-    PARROT_OP_fetch_p_p_ic_pc,                 /* 1067 */
-    PARROT_OP_fetch_p_pc_ic_pc,                /* 1068 */
-    PARROT_OP_fetch_p_p_s_p,                   /* 1069 */
-    PARROT_OP_fetch_p_pc_s_p,                  /* 1070 */
-    PARROT_OP_fetch_p_p_sc_p,                  /* 1071 */
-    PARROT_OP_fetch_p_pc_sc_p,                 /* 1072 */
-    PARROT_OP_fetch_p_p_s_pc,                  /* 1073 */
-    PARROT_OP_fetch_p_pc_s_pc,                 /* 1074 */
-    PARROT_OP_fetch_p_p_sc_pc,                 /* 1075 */
-    PARROT_OP_fetch_p_pc_sc_pc,                /* 1076 */
-    PARROT_OP_vivify_p_p_p_p,                  /* 1077 */
-    PARROT_OP_vivify_p_pc_p_p,                 /* 1078 */
-    PARROT_OP_vivify_p_p_pc_p,                 /* 1079 */
-    PARROT_OP_vivify_p_pc_pc_p,                /* 1080 */
-    PARROT_OP_vivify_p_p_p_pc,                 /* 1081 */
-    PARROT_OP_vivify_p_pc_p_pc,                /* 1082 */
-    PARROT_OP_vivify_p_p_pc_pc,                /* 1083 */
-    PARROT_OP_vivify_p_pc_pc_pc,               /* 1084 */
-    PARROT_OP_vivify_p_p_i_p,                  /* 1085 */
-    PARROT_OP_vivify_p_pc_i_p,                 /* 1086 */
-    PARROT_OP_vivify_p_p_ic_p,                 /* 1087 */
-    PARROT_OP_vivify_p_pc_ic_p,                /* 1088 */
-    PARROT_OP_vivify_p_p_i_pc,                 /* 1089 */
-    PARROT_OP_vivify_p_pc_i_pc,                /* 1090 */
-    PARROT_OP_vivify_p_p_ic_pc,                /* 1091 */
-    PARROT_OP_vivify_p_pc_ic_pc,               /* 1092 */
-    PARROT_OP_vivify_p_p_s_p,                  /* 1093 */
-    PARROT_OP_vivify_p_pc_s_p,                 /* 1094 */
-    PARROT_OP_vivify_p_p_sc_p,                 /* 1095 */
-    PARROT_OP_vivify_p_pc_sc_p,                /* 1096 */
-    PARROT_OP_vivify_p_p_s_pc,                 /* 1097 */
-    PARROT_OP_vivify_p_pc_s_pc,                /* 1098 */
-    PARROT_OP_vivify_p_p_sc_pc,                /* 1099 */
-    PARROT_OP_vivify_p_pc_sc_pc,               /* 1100 */
-    PARROT_OP_new_p_s_i,                       /* 1101 */
-    PARROT_OP_new_p_sc_i,                      /* 1102 */
-    PARROT_OP_new_p_s_ic,                      /* 1103 */
-    PARROT_OP_new_p_sc_ic,                     /* 1104 */
-    PARROT_OP_new_p_p_i,                       /* 1105 */
-    PARROT_OP_new_p_pc_i,                      /* 1106 */
-    PARROT_OP_new_p_p_ic,                      /* 1107 */
-    PARROT_OP_new_p_pc_ic,                     /* 1108 */
-    PARROT_OP_root_new_p_p_i,                  /* 1109 */
-    PARROT_OP_root_new_p_pc_i,                 /* 1110 */
-    PARROT_OP_root_new_p_p_ic,                 /* 1111 */
-    PARROT_OP_root_new_p_pc_ic,                /* 1112 */
-    PARROT_OP_get_context_p,                   /* 1113 */
-    PARROT_OP_new_call_context_p,              /* 1114 */
-    PARROT_OP_invokecc_p_p,                    /* 1115 */
-    PARROT_OP_flatten_array_into_p_p_i,        /* 1116 */
-    PARROT_OP_flatten_array_into_p_p_ic,       /* 1117 */
-    PARROT_OP_flatten_hash_into_p_p_i,         /* 1118 */
-    PARROT_OP_flatten_hash_into_p_p_ic,        /* 1119 */
-    PARROT_OP_slurp_array_from_p_p_i,          /* 1120 */
-    PARROT_OP_slurp_array_from_p_p_ic,         /* 1121 */
-    PARROT_OP_receive_p,                       /* 1122 */
-    PARROT_OP_wait_p,                          /* 1123 */
-    PARROT_OP_wait_pc,                         /* 1124 */
-    PARROT_OP_pass,                            /* 1125 */
-    PARROT_OP_disable_preemption,              /* 1126 */
-    PARROT_OP_enable_preemption,               /* 1127 */
-    PARROT_OP_terminate                        /* 1128 */
+    PARROT_OP_getattribute_i_p_s,              /* 586 */
+    PARROT_OP_getattribute_i_p_sc,             /* 587 */
+    PARROT_OP_getattribute_n_p_s,              /* 588 */
+    PARROT_OP_getattribute_n_p_sc,             /* 589 */
+    PARROT_OP_getattribute_s_p_s,              /* 590 */
+    PARROT_OP_getattribute_s_p_sc,             /* 591 */
+    PARROT_OP_getattribute_p_p_p_s,            /* 592 */
+    PARROT_OP_getattribute_p_p_pc_s,           /* 593 */
+    PARROT_OP_getattribute_p_p_p_sc,           /* 594 */
+    PARROT_OP_getattribute_p_p_pc_sc,          /* 595 */
+    PARROT_OP_setattribute_p_s_p,              /* 596 */
+    PARROT_OP_setattribute_p_sc_p,             /* 597 */
+    PARROT_OP_setattribute_p_s_i,              /* 598 */
+    PARROT_OP_setattribute_p_sc_i,             /* 599 */
+    PARROT_OP_setattribute_p_s_ic,             /* 600 */
+    PARROT_OP_setattribute_p_sc_ic,            /* 601 */
+    PARROT_OP_setattribute_p_s_n,              /* 602 */
+    PARROT_OP_setattribute_p_sc_n,             /* 603 */
+    PARROT_OP_setattribute_p_s_nc,             /* 604 */
+    PARROT_OP_setattribute_p_sc_nc,            /* 605 */
+    PARROT_OP_setattribute_p_s_s,              /* 606 */
+    PARROT_OP_setattribute_p_sc_s,             /* 607 */
+    PARROT_OP_setattribute_p_s_sc,             /* 608 */
+    PARROT_OP_setattribute_p_sc_sc,            /* 609 */
+    PARROT_OP_setattribute_p_p_s_p,            /* 610 */
+    PARROT_OP_setattribute_p_pc_s_p,           /* 611 */
+    PARROT_OP_setattribute_p_p_sc_p,           /* 612 */
+    PARROT_OP_setattribute_p_pc_sc_p,          /* 613 */
+    PARROT_OP_inspect_p_p,                     /* 614 */
+    PARROT_OP_inspect_p_pc,                    /* 615 */
+    PARROT_OP_inspect_p_p_s,                   /* 616 */
+    PARROT_OP_inspect_p_pc_s,                  /* 617 */
+    PARROT_OP_inspect_p_p_sc,                  /* 618 */
+    PARROT_OP_inspect_p_pc_sc,                 /* 619 */
+    PARROT_OP_new_p_s,                         /* 620 */
+    PARROT_OP_new_p_sc,                        /* 621 */
+    PARROT_OP_new_p_s_p,                       /* 622 */
+    PARROT_OP_new_p_sc_p,                      /* 623 */
+    PARROT_OP_new_p_s_pc,                      /* 624 */
+    PARROT_OP_new_p_sc_pc,                     /* 625 */
+    PARROT_OP_new_p_p,                         /* 626 */
+    PARROT_OP_new_p_pc,                        /* 627 */
+    PARROT_OP_new_p_p_p,                       /* 628 */
+    PARROT_OP_new_p_pc_p,                      /* 629 */
+    PARROT_OP_new_p_p_pc,                      /* 630 */
+    PARROT_OP_new_p_pc_pc,                     /* 631 */
+    PARROT_OP_root_new_p_p,                    /* 632 */
+    PARROT_OP_root_new_p_pc,                   /* 633 */
+    PARROT_OP_root_new_p_p_p,                  /* 634 */
+    PARROT_OP_root_new_p_pc_p,                 /* 635 */
+    PARROT_OP_root_new_p_p_pc,                 /* 636 */
+    PARROT_OP_root_new_p_pc_pc,                /* 637 */
+    PARROT_OP_typeof_s_p,                      /* 638 */
+    PARROT_OP_typeof_p_p,                      /* 639 */
+    PARROT_OP_get_repr_s_p,                    /* 640 */
+    PARROT_OP_find_method_p_p_s,               /* 641 */
+    PARROT_OP_find_method_p_p_sc,              /* 642 */
+    PARROT_OP_defined_i_p,                     /* 643 */
+    PARROT_OP_defined_i_p_ki,                  /* 644 */
+    PARROT_OP_defined_i_p_kic,                 /* 645 */
+    PARROT_OP_defined_i_p_k,                   /* 646 */
+    PARROT_OP_defined_i_p_kc,                  /* 647 */
+    PARROT_OP_exists_i_p_ki,                   /* 648 */
+    PARROT_OP_exists_i_p_kic,                  /* 649 */
+    PARROT_OP_exists_i_p_k,                    /* 650 */
+    PARROT_OP_exists_i_p_kc,                   /* 651 */
+    PARROT_OP_delete_p_k,                      /* 652 */
+    PARROT_OP_delete_p_kc,                     /* 653 */
+    PARROT_OP_delete_p_ki,                     /* 654 */
+    PARROT_OP_delete_p_kic,                    /* 655 */
+    PARROT_OP_elements_i_p,                    /* 656 */
+    PARROT_OP_push_p_i,                        /* 657 */
+    PARROT_OP_push_p_ic,                       /* 658 */
+    PARROT_OP_push_p_n,                        /* 659 */
+    PARROT_OP_push_p_nc,                       /* 660 */
+    PARROT_OP_push_p_s,                        /* 661 */
+    PARROT_OP_push_p_sc,                       /* 662 */
+    PARROT_OP_push_p_p,                        /* 663 */
+    PARROT_OP_pop_i_p,                         /* 664 */
+    PARROT_OP_pop_n_p,                         /* 665 */
+    PARROT_OP_pop_s_p,                         /* 666 */
+    PARROT_OP_pop_p_p,                         /* 667 */
+    PARROT_OP_unshift_p_i,                     /* 668 */
+    PARROT_OP_unshift_p_ic,                    /* 669 */
+    PARROT_OP_unshift_p_n,                     /* 670 */
+    PARROT_OP_unshift_p_nc,                    /* 671 */
+    PARROT_OP_unshift_p_s,                     /* 672 */
+    PARROT_OP_unshift_p_sc,                    /* 673 */
+    PARROT_OP_unshift_p_p,                     /* 674 */
+    PARROT_OP_shift_i_p,                       /* 675 */
+    PARROT_OP_shift_n_p,                       /* 676 */
+    PARROT_OP_shift_s_p,                       /* 677 */
+    PARROT_OP_shift_p_p,                       /* 678 */
+    PARROT_OP_splice_p_p_i_i,                  /* 679 */
+    PARROT_OP_splice_p_p_ic_i,                 /* 680 */
+    PARROT_OP_splice_p_p_i_ic,                 /* 681 */
+    PARROT_OP_splice_p_p_ic_ic,                /* 682 */
+    PARROT_OP_setprop_p_s_p,                   /* 683 */
+    PARROT_OP_setprop_p_sc_p,                  /* 684 */
+    PARROT_OP_getprop_p_s_p,                   /* 685 */
+    PARROT_OP_getprop_p_sc_p,                  /* 686 */
+    PARROT_OP_getprop_p_p_s,                   /* 687 */
+    PARROT_OP_getprop_p_p_sc,                  /* 688 */
+    PARROT_OP_delprop_p_s,                     /* 689 */
+    PARROT_OP_delprop_p_sc,                    /* 690 */
+    PARROT_OP_prophash_p_p,                    /* 691 */
+    PARROT_OP_freeze_s_p,                      /* 692 */
+    PARROT_OP_thaw_p_s,                        /* 693 */
+    PARROT_OP_thaw_p_sc,                       /* 694 */
+    PARROT_OP_add_multi_s_s_p,                 /* 695 */
+    PARROT_OP_add_multi_sc_s_p,                /* 696 */
+    PARROT_OP_add_multi_s_sc_p,                /* 697 */
+    PARROT_OP_add_multi_sc_sc_p,               /* 698 */
+    PARROT_OP_find_multi_p_s_s,                /* 699 */
+    PARROT_OP_find_multi_p_sc_s,               /* 700 */
+    PARROT_OP_find_multi_p_s_sc,               /* 701 */
+    PARROT_OP_find_multi_p_sc_sc,              /* 702 */
+    PARROT_OP_register_p,                      /* 703 */
+    PARROT_OP_unregister_p,                    /* 704 */
+    PARROT_OP_box_p_i,                         /* 705 */
+    PARROT_OP_box_p_ic,                        /* 706 */
+    PARROT_OP_box_p_n,                         /* 707 */
+    PARROT_OP_box_p_nc,                        /* 708 */
+    PARROT_OP_box_p_s,                         /* 709 */
+    PARROT_OP_box_p_sc,                        /* 710 */
+    PARROT_OP_iter_p_p,                        /* 711 */
+    PARROT_OP_morph_p_p,                       /* 712 */
+    PARROT_OP_morph_p_pc,                      /* 713 */
+    PARROT_OP_clone_s_s,                       /* 714 */
+    PARROT_OP_clone_s_sc,                      /* 715 */
+    PARROT_OP_set_i_i,                         /* 716 */
+    PARROT_OP_set_i_ic,                        /* 717 */
+    PARROT_OP_set_i_n,                         /* 718 */
+    PARROT_OP_set_i_nc,                        /* 719 */
+    PARROT_OP_set_i_s,                         /* 720 */
+    PARROT_OP_set_i_sc,                        /* 721 */
+    PARROT_OP_set_n_n,                         /* 722 */
+    PARROT_OP_set_n_nc,                        /* 723 */
+    PARROT_OP_set_n_i,                         /* 724 */
+    PARROT_OP_set_n_ic,                        /* 725 */
+    PARROT_OP_set_n_s,                         /* 726 */
+    PARROT_OP_set_n_sc,                        /* 727 */
+    PARROT_OP_set_n_p,                         /* 728 */
+    PARROT_OP_set_s_p,                         /* 729 */
+    PARROT_OP_set_s_s,                         /* 730 */
+    PARROT_OP_set_s_sc,                        /* 731 */
+    PARROT_OP_set_s_i,                         /* 732 */
+    PARROT_OP_set_s_ic,                        /* 733 */
+    PARROT_OP_set_s_n,                         /* 734 */
+    PARROT_OP_set_s_nc,                        /* 735 */
+    PARROT_OP_set_p_pc,                        /* 736 */
+    PARROT_OP_set_p_p,                         /* 737 */
+    PARROT_OP_set_p_i,                         /* 738 */
+    PARROT_OP_set_p_ic,                        /* 739 */
+    PARROT_OP_set_p_n,                         /* 740 */
+    PARROT_OP_set_p_nc,                        /* 741 */
+    PARROT_OP_set_p_s,                         /* 742 */
+    PARROT_OP_set_p_sc,                        /* 743 */
+    PARROT_OP_set_i_p,                         /* 744 */
+    PARROT_OP_assign_p_p,                      /* 745 */
+    PARROT_OP_assign_p_i,                      /* 746 */
+    PARROT_OP_assign_p_ic,                     /* 747 */
+    PARROT_OP_assign_p_n,                      /* 748 */
+    PARROT_OP_assign_p_nc,                     /* 749 */
+    PARROT_OP_assign_p_s,                      /* 750 */
+    PARROT_OP_assign_p_sc,                     /* 751 */
+    PARROT_OP_assign_s_s,                      /* 752 */
+    PARROT_OP_assign_s_sc,                     /* 753 */
+    PARROT_OP_setref_p_p,                      /* 754 */
+    PARROT_OP_deref_p_p,                       /* 755 */
+    PARROT_OP_set_p_ki_i,                      /* 756 */
+    PARROT_OP_set_p_kic_i,                     /* 757 */
+    PARROT_OP_set_p_ki_ic,                     /* 758 */
+    PARROT_OP_set_p_kic_ic,                    /* 759 */
+    PARROT_OP_set_p_ki_n,                      /* 760 */
+    PARROT_OP_set_p_kic_n,                     /* 761 */
+    PARROT_OP_set_p_ki_nc,                     /* 762 */
+    PARROT_OP_set_p_kic_nc,                    /* 763 */
+    PARROT_OP_set_p_ki_s,                      /* 764 */
+    PARROT_OP_set_p_kic_s,                     /* 765 */
+    PARROT_OP_set_p_ki_sc,                     /* 766 */
+    PARROT_OP_set_p_kic_sc,                    /* 767 */
+    PARROT_OP_set_p_ki_p,                      /* 768 */
+    PARROT_OP_set_p_kic_p,                     /* 769 */
+    PARROT_OP_set_i_p_ki,                      /* 770 */
+    PARROT_OP_set_i_p_kic,                     /* 771 */
+    PARROT_OP_set_n_p_ki,                      /* 772 */
+    PARROT_OP_set_n_p_kic,                     /* 773 */
+    PARROT_OP_set_s_p_ki,                      /* 774 */
+    PARROT_OP_set_s_p_kic,                     /* 775 */
+    PARROT_OP_set_p_p_ki,                      /* 776 */
+    PARROT_OP_set_p_p_kic,                     /* 777 */
+    PARROT_OP_set_p_k_i,                       /* 778 */
+    PARROT_OP_set_p_kc_i,                      /* 779 */
+    PARROT_OP_set_p_k_ic,                      /* 780 */
+    PARROT_OP_set_p_kc_ic,                     /* 781 */
+    PARROT_OP_set_p_k_n,                       /* 782 */
+    PARROT_OP_set_p_kc_n,                      /* 783 */
+    PARROT_OP_set_p_k_nc,                      /* 784 */
+    PARROT_OP_set_p_kc_nc,                     /* 785 */
+    PARROT_OP_set_p_k_s,                       /* 786 */
+    PARROT_OP_set_p_kc_s,                      /* 787 */
+    PARROT_OP_set_p_k_sc,                      /* 788 */
+    PARROT_OP_set_p_kc_sc,                     /* 789 */
+    PARROT_OP_set_p_k_p,                       /* 790 */
+    PARROT_OP_set_p_kc_p,                      /* 791 */
+    PARROT_OP_set_i_p_k,                       /* 792 */
+    PARROT_OP_set_i_p_kc,                      /* 793 */
+    PARROT_OP_set_n_p_k,                       /* 794 */
+    PARROT_OP_set_n_p_kc,                      /* 795 */
+    PARROT_OP_set_s_p_k,                       /* 796 */
+    PARROT_OP_set_s_p_kc,                      /* 797 */
+    PARROT_OP_set_p_p_k,                       /* 798 */
+    PARROT_OP_set_p_p_kc,                      /* 799 */
+    PARROT_OP_clone_p_p,                       /* 800 */
+    PARROT_OP_clone_p_p_p,                     /* 801 */
+    PARROT_OP_clone_p_p_pc,                    /* 802 */
+    PARROT_OP_copy_p_p,                        /* 803 */
+    PARROT_OP_null_s,                          /* 804 */
+    PARROT_OP_null_i,                          /* 805 */
+    PARROT_OP_null_p,                          /* 806 */
+    PARROT_OP_null_n,                          /* 807 */
+    PARROT_OP_ord_i_s,                         /* 808 */
+    PARROT_OP_ord_i_sc,                        /* 809 */
+    PARROT_OP_ord_i_s_i,                       /* 810 */
+    PARROT_OP_ord_i_sc_i,                      /* 811 */
+    PARROT_OP_ord_i_s_ic,                      /* 812 */
+    PARROT_OP_ord_i_sc_ic,                     /* 813 */
+    PARROT_OP_chr_s_i,                         /* 814 */
+    PARROT_OP_chr_s_ic,                        /* 815 */
+    PARROT_OP_chopn_s_s_i,                     /* 816 */
+    PARROT_OP_chopn_s_sc_i,                    /* 817 */
+    PARROT_OP_chopn_s_s_ic,                    /* 818 */
+    PARROT_OP_chopn_s_sc_ic,                   /* 819 */
+    PARROT_OP_concat_p_p,                      /* 820 */
+    PARROT_OP_concat_p_s,                      /* 821 */
+    PARROT_OP_concat_p_sc,                     /* 822 */
+    PARROT_OP_concat_s_s_s,                    /* 823 */
+    PARROT_OP_concat_s_sc_s,                   /* 824 */
+    PARROT_OP_concat_s_s_sc,                   /* 825 */
+    PARROT_OP_concat_p_p_s,                    /* 826 */
+    PARROT_OP_concat_p_p_sc,                   /* 827 */
+    PARROT_OP_concat_p_p_p,                    /* 828 */
+    PARROT_OP_repeat_s_s_i,                    /* 829 */
+    PARROT_OP_repeat_s_sc_i,                   /* 830 */
+    PARROT_OP_repeat_s_s_ic,                   /* 831 */
+    PARROT_OP_repeat_s_sc_ic,                  /* 832 */
+    PARROT_OP_repeat_p_p_i,                    /* 833 */
+    PARROT_OP_repeat_p_p_ic,                   /* 834 */
+    PARROT_OP_repeat_p_p_p,                    /* 835 */
+    PARROT_OP_repeat_p_i,                      /* 836 */
+    PARROT_OP_repeat_p_ic,                     /* 837 */
+    PARROT_OP_repeat_p_p,                      /* 838 */
+    PARROT_OP_length_i_s,                      /* 839 */
+    PARROT_OP_length_i_sc,                     /* 840 */
+    PARROT_OP_bytelength_i_s,                  /* 841 */
+    PARROT_OP_bytelength_i_sc,                 /* 842 */
+    PARROT_OP_pin_s,                           /* 843 */
+    PARROT_OP_unpin_s,                         /* 844 */
+    PARROT_OP_substr_s_s_i,                    /* 845 */
+    PARROT_OP_substr_s_sc_i,                   /* 846 */
+    PARROT_OP_substr_s_s_ic,                   /* 847 */
+    PARROT_OP_substr_s_sc_ic,                  /* 848 */
+    PARROT_OP_substr_s_s_i_i,                  /* 849 */
+    PARROT_OP_substr_s_sc_i_i,                 /* 850 */
+    PARROT_OP_substr_s_s_ic_i,                 /* 851 */
+    PARROT_OP_substr_s_sc_ic_i,                /* 852 */
+    PARROT_OP_substr_s_s_i_ic,                 /* 853 */
+    PARROT_OP_substr_s_sc_i_ic,                /* 854 */
+    PARROT_OP_substr_s_s_ic_ic,                /* 855 */
+    PARROT_OP_substr_s_sc_ic_ic,               /* 856 */
+    PARROT_OP_substr_s_p_i_i,                  /* 857 */
+    PARROT_OP_substr_s_p_ic_i,                 /* 858 */
+    PARROT_OP_substr_s_p_i_ic,                 /* 859 */
+    PARROT_OP_substr_s_p_ic_ic,                /* 860 */
+    PARROT_OP_replace_s_s_i_i_s,               /* 861 */
+    PARROT_OP_replace_s_sc_i_i_s,              /* 862 */
+    PARROT_OP_replace_s_s_ic_i_s,              /* 863 */
+    PARROT_OP_replace_s_sc_ic_i_s,             /* 864 */
+    PARROT_OP_replace_s_s_i_ic_s,              /* 865 */
+    PARROT_OP_replace_s_sc_i_ic_s,             /* 866 */
+    PARROT_OP_replace_s_s_ic_ic_s,             /* 867 */
+    PARROT_OP_replace_s_sc_ic_ic_s,            /* 868 */
+    PARROT_OP_replace_s_s_i_i_sc,              /* 869 */
+    PARROT_OP_replace_s_sc_i_i_sc,             /* 870 */
+    PARROT_OP_replace_s_s_ic_i_sc,             /* 871 */
+    PARROT_OP_replace_s_sc_ic_i_sc,            /* 872 */
+    PARROT_OP_replace_s_s_i_ic_sc,             /* 873 */
+    PARROT_OP_replace_s_sc_i_ic_sc,            /* 874 */
+    PARROT_OP_replace_s_s_ic_ic_sc,            /* 875 */
+    PARROT_OP_replace_s_sc_ic_ic_sc,           /* 876 */
+    PARROT_OP_index_i_s_s,                     /* 877 */
+    PARROT_OP_index_i_sc_s,                    /* 878 */
+    PARROT_OP_index_i_s_sc,                    /* 879 */
+    PARROT_OP_index_i_sc_sc,                   /* 880 */
+    PARROT_OP_index_i_s_s_i,                   /* 881 */
+    PARROT_OP_index_i_sc_s_i,                  /* 882 */
+    PARROT_OP_index_i_s_sc_i,                  /* 883 */
+    PARROT_OP_index_i_sc_sc_i,                 /* 884 */
+    PARROT_OP_index_i_s_s_ic,                  /* 885 */
+    PARROT_OP_index_i_sc_s_ic,                 /* 886 */
+    PARROT_OP_index_i_s_sc_ic,                 /* 887 */
+    PARROT_OP_index_i_sc_sc_ic,                /* 888 */
+    PARROT_OP_rindex_i_s_s,                    /* 889 */
+    PARROT_OP_rindex_i_sc_s,                   /* 890 */
+    PARROT_OP_rindex_i_s_sc,                   /* 891 */
+    PARROT_OP_rindex_i_sc_sc,                  /* 892 */
+    PARROT_OP_rindex_i_s_s_i,                  /* 893 */
+    PARROT_OP_rindex_i_sc_s_i,                 /* 894 */
+    PARROT_OP_rindex_i_s_sc_i,                 /* 895 */
+    PARROT_OP_rindex_i_sc_sc_i,                /* 896 */
+    PARROT_OP_rindex_i_s_s_ic,                 /* 897 */
+    PARROT_OP_rindex_i_sc_s_ic,                /* 898 */
+    PARROT_OP_rindex_i_s_sc_ic,                /* 899 */
+    PARROT_OP_rindex_i_sc_sc_ic,               /* 900 */
+    PARROT_OP_sprintf_s_s_p,                   /* 901 */
+    PARROT_OP_sprintf_s_sc_p,                  /* 902 */
+    PARROT_OP_sprintf_p_p_p,                   /* 903 */
+    PARROT_OP_new_s,                           /* 904 */
+    PARROT_OP_stringinfo_i_s_i,                /* 905 */
+    PARROT_OP_stringinfo_i_sc_i,               /* 906 */
+    PARROT_OP_stringinfo_i_s_ic,               /* 907 */
+    PARROT_OP_stringinfo_i_sc_ic,              /* 908 */
+    PARROT_OP_upcase_s_s,                      /* 909 */
+    PARROT_OP_upcase_s_sc,                     /* 910 */
+    PARROT_OP_downcase_s_s,                    /* 911 */
+    PARROT_OP_downcase_s_sc,                   /* 912 */
+    PARROT_OP_titlecase_s_s,                   /* 913 */
+    PARROT_OP_titlecase_s_sc,                  /* 914 */
+    PARROT_OP_join_s_s_p,                      /* 915 */
+    PARROT_OP_join_s_sc_p,                     /* 916 */
+    PARROT_OP_split_p_s_s,                     /* 917 */
+    PARROT_OP_split_p_sc_s,                    /* 918 */
+    PARROT_OP_split_p_s_sc,                    /* 919 */
+    PARROT_OP_split_p_sc_sc,                   /* 920 */
+    PARROT_OP_encoding_i_s,                    /* 921 */
+    PARROT_OP_encoding_i_sc,                   /* 922 */
+    PARROT_OP_encodingname_s_i,                /* 923 */
+    PARROT_OP_encodingname_s_ic,               /* 924 */
+    PARROT_OP_find_encoding_i_s,               /* 925 */
+    PARROT_OP_find_encoding_i_sc,              /* 926 */
+    PARROT_OP_trans_encoding_s_s_i,            /* 927 */
+    PARROT_OP_trans_encoding_s_sc_i,           /* 928 */
+    PARROT_OP_trans_encoding_s_s_ic,           /* 929 */
+    PARROT_OP_trans_encoding_s_sc_ic,          /* 930 */
+    PARROT_OP_is_cclass_i_i_s_i,               /* 931 */
+    PARROT_OP_is_cclass_i_ic_s_i,              /* 932 */
+    PARROT_OP_is_cclass_i_i_sc_i,              /* 933 */
+    PARROT_OP_is_cclass_i_ic_sc_i,             /* 934 */
+    PARROT_OP_is_cclass_i_i_s_ic,              /* 935 */
+    PARROT_OP_is_cclass_i_ic_s_ic,             /* 936 */
+    PARROT_OP_is_cclass_i_i_sc_ic,             /* 937 */
+    PARROT_OP_is_cclass_i_ic_sc_ic,            /* 938 */
+    PARROT_OP_find_cclass_i_i_s_i_i,           /* 939 */
+    PARROT_OP_find_cclass_i_ic_s_i_i,          /* 940 */
+    PARROT_OP_find_cclass_i_i_sc_i_i,          /* 941 */
+    PARROT_OP_find_cclass_i_ic_sc_i_i,         /* 942 */
+    PARROT_OP_find_cclass_i_i_s_ic_i,          /* 943 */
+    PARROT_OP_find_cclass_i_ic_s_ic_i,         /* 944 */
+    PARROT_OP_find_cclass_i_i_sc_ic_i,         /* 945 */
+    PARROT_OP_find_cclass_i_ic_sc_ic_i,        /* 946 */
+    PARROT_OP_find_cclass_i_i_s_i_ic,          /* 947 */
+    PARROT_OP_find_cclass_i_ic_s_i_ic,         /* 948 */
+    PARROT_OP_find_cclass_i_i_sc_i_ic,         /* 949 */
+    PARROT_OP_find_cclass_i_ic_sc_i_ic,        /* 950 */
+    PARROT_OP_find_cclass_i_i_s_ic_ic,         /* 951 */
+    PARROT_OP_find_cclass_i_ic_s_ic_ic,        /* 952 */
+    PARROT_OP_find_cclass_i_i_sc_ic_ic,        /* 953 */
+    PARROT_OP_find_cclass_i_ic_sc_ic_ic,       /* 954 */
+    PARROT_OP_find_not_cclass_i_i_s_i_i,       /* 955 */
+    PARROT_OP_find_not_cclass_i_ic_s_i_i,      /* 956 */
+    PARROT_OP_find_not_cclass_i_i_sc_i_i,      /* 957 */
+    PARROT_OP_find_not_cclass_i_ic_sc_i_i,     /* 958 */
+    PARROT_OP_find_not_cclass_i_i_s_ic_i,      /* 959 */
+    PARROT_OP_find_not_cclass_i_ic_s_ic_i,     /* 960 */
+    PARROT_OP_find_not_cclass_i_i_sc_ic_i,     /* 961 */
+    PARROT_OP_find_not_cclass_i_ic_sc_ic_i,    /* 962 */
+    PARROT_OP_find_not_cclass_i_i_s_i_ic,      /* 963 */
+    PARROT_OP_find_not_cclass_i_ic_s_i_ic,     /* 964 */
+    PARROT_OP_find_not_cclass_i_i_sc_i_ic,     /* 965 */
+    PARROT_OP_find_not_cclass_i_ic_sc_i_ic,    /* 966 */
+    PARROT_OP_find_not_cclass_i_i_s_ic_ic,     /* 967 */
+    PARROT_OP_find_not_cclass_i_ic_s_ic_ic,    /* 968 */
+    PARROT_OP_find_not_cclass_i_i_sc_ic_ic,    /* 969 */
+    PARROT_OP_find_not_cclass_i_ic_sc_ic_ic,   /* 970 */
+    PARROT_OP_escape_s_s,                      /* 971 */
+    PARROT_OP_compose_s_s,                     /* 972 */
+    PARROT_OP_compose_s_sc,                    /* 973 */
+    PARROT_OP_find_codepoint_i_s,              /* 974 */
+    PARROT_OP_find_codepoint_i_sc,             /* 975 */
+    PARROT_OP_spawnw_i_s,                      /* 976 */
+    PARROT_OP_spawnw_i_sc,                     /* 977 */
+    PARROT_OP_spawnw_i_p,                      /* 978 */
+    PARROT_OP_err_i,                           /* 979 */
+    PARROT_OP_err_s,                           /* 980 */
+    PARROT_OP_err_s_i,                         /* 981 */
+    PARROT_OP_err_s_ic,                        /* 982 */
+    PARROT_OP_time_i,                          /* 983 */
+    PARROT_OP_time_n,                          /* 984 */
+    PARROT_OP_sleep_i,                         /* 985 */
+    PARROT_OP_sleep_ic,                        /* 986 */
+    PARROT_OP_sleep_n,                         /* 987 */
+    PARROT_OP_sleep_nc,                        /* 988 */
+    PARROT_OP_store_lex_s_p,                   /* 989 */
+    PARROT_OP_store_lex_sc_p,                  /* 990 */
+    PARROT_OP_store_lex_s_s,                   /* 991 */
+    PARROT_OP_store_lex_sc_s,                  /* 992 */
+    PARROT_OP_store_lex_s_sc,                  /* 993 */
+    PARROT_OP_store_lex_sc_sc,                 /* 994 */
+    PARROT_OP_store_lex_s_i,                   /* 995 */
+    PARROT_OP_store_lex_sc_i,                  /* 996 */
+    PARROT_OP_store_lex_s_ic,                  /* 997 */
+    PARROT_OP_store_lex_sc_ic,                 /* 998 */
+    PARROT_OP_store_lex_s_n,                   /* 999 */
+    PARROT_OP_store_lex_sc_n,                  /* 1000 */
+    PARROT_OP_store_lex_s_nc,                  /* 1001 */
+    PARROT_OP_store_lex_sc_nc,                 /* 1002 */
+    PARROT_OP_store_dynamic_lex_s_p,           /* 1003 */
+    PARROT_OP_store_dynamic_lex_sc_p,          /* 1004 */
+    PARROT_OP_find_lex_p_s,                    /* 1005 */
+    PARROT_OP_find_lex_p_sc,                   /* 1006 */
+    PARROT_OP_find_lex_s_s,                    /* 1007 */
+    PARROT_OP_find_lex_s_sc,                   /* 1008 */
+    PARROT_OP_find_lex_i_s,                    /* 1009 */
+    PARROT_OP_find_lex_i_sc,                   /* 1010 */
+    PARROT_OP_find_lex_n_s,                    /* 1011 */
+    PARROT_OP_find_lex_n_sc,                   /* 1012 */
+    PARROT_OP_find_dynamic_lex_p_s,            /* 1013 */
+    PARROT_OP_find_dynamic_lex_p_sc,           /* 1014 */
+    PARROT_OP_find_caller_lex_p_s,             /* 1015 */
+    PARROT_OP_find_caller_lex_p_sc,            /* 1016 */
+    PARROT_OP_get_namespace_p,                 /* 1017 */
+    PARROT_OP_get_namespace_p_p,               /* 1018 */
+    PARROT_OP_get_namespace_p_pc,              /* 1019 */
+    PARROT_OP_get_hll_namespace_p,             /* 1020 */
+    PARROT_OP_get_hll_namespace_p_p,           /* 1021 */
+    PARROT_OP_get_hll_namespace_p_pc,          /* 1022 */
+    PARROT_OP_get_root_namespace_p,            /* 1023 */
+    PARROT_OP_get_root_namespace_p_p,          /* 1024 */
+    PARROT_OP_get_root_namespace_p_pc,         /* 1025 */
+    PARROT_OP_get_global_p_s,                  /* 1026 */
+    PARROT_OP_get_global_p_sc,                 /* 1027 */
+    PARROT_OP_get_global_p_p_s,                /* 1028 */
+    PARROT_OP_get_global_p_pc_s,               /* 1029 */
+    PARROT_OP_get_global_p_p_sc,               /* 1030 */
+    PARROT_OP_get_global_p_pc_sc,              /* 1031 */
+    PARROT_OP_get_hll_global_p_s,              /* 1032 */
+    PARROT_OP_get_hll_global_p_sc,             /* 1033 */
+    PARROT_OP_get_hll_global_p_p_s,            /* 1034 */
+    PARROT_OP_get_hll_global_p_pc_s,           /* 1035 */
+    PARROT_OP_get_hll_global_p_p_sc,           /* 1036 */
+    PARROT_OP_get_hll_global_p_pc_sc,          /* 1037 */
+    PARROT_OP_get_root_global_p_s,             /* 1038 */
+    PARROT_OP_get_root_global_p_sc,            /* 1039 */
+    PARROT_OP_get_root_global_p_p_s,           /* 1040 */
+    PARROT_OP_get_root_global_p_pc_s,          /* 1041 */
+    PARROT_OP_get_root_global_p_p_sc,          /* 1042 */
+    PARROT_OP_get_root_global_p_pc_sc,         /* 1043 */
+    PARROT_OP_set_global_s_p,                  /* 1044 */
+    PARROT_OP_set_global_sc_p,                 /* 1045 */
+    PARROT_OP_set_global_p_s_p,                /* 1046 */
+    PARROT_OP_set_global_pc_s_p,               /* 1047 */
+    PARROT_OP_set_global_p_sc_p,               /* 1048 */
+    PARROT_OP_set_global_pc_sc_p,              /* 1049 */
+    PARROT_OP_set_hll_global_s_p,              /* 1050 */
+    PARROT_OP_set_hll_global_sc_p,             /* 1051 */
+    PARROT_OP_set_hll_global_p_s_p,            /* 1052 */
+    PARROT_OP_set_hll_global_pc_s_p,           /* 1053 */
+    PARROT_OP_set_hll_global_p_sc_p,           /* 1054 */
+    PARROT_OP_set_hll_global_pc_sc_p,          /* 1055 */
+    PARROT_OP_set_root_global_s_p,             /* 1056 */
+    PARROT_OP_set_root_global_sc_p,            /* 1057 */
+    PARROT_OP_set_root_global_p_s_p,           /* 1058 */
+    PARROT_OP_set_root_global_pc_s_p,          /* 1059 */
+    PARROT_OP_set_root_global_p_sc_p,          /* 1060 */
+    PARROT_OP_set_root_global_pc_sc_p,         /* 1061 */
+    PARROT_OP_find_name_p_s,                   /* 1062 */
+    PARROT_OP_find_name_p_sc,                  /* 1063 */
+    PARROT_OP_find_sub_not_null_p_s,           /* 1064 */
+    PARROT_OP_find_sub_not_null_p_sc,          /* 1065 */
+    PARROT_OP_trap,                            /* 1066 */
+    PARROT_OP_set_label_p_ic,                  /* 1067 */
+    PARROT_OP_get_label_i_p,                   /* 1068 */
+    PARROT_OP_get_id_i_p,                      /* 1069 */
+    PARROT_OP_get_id_i_pc,                     /* 1070 */
+    PARROT_OP_fetch_p_p_p_p,                   /* 1071 */
+    PARROT_OP_fetch_p_pc_p_p,                  /* 1072 */
+    PARROT_OP_fetch_p_p_pc_p,                  /* 1073 */
+    PARROT_OP_fetch_p_pc_pc_p,                 /* 1074 */
+    PARROT_OP_fetch_p_p_p_pc,                  /* 1075 */
+    PARROT_OP_fetch_p_pc_p_pc,                 /* 1076 */
+    PARROT_OP_fetch_p_p_pc_pc,                 /* 1077 */
+    PARROT_OP_fetch_p_pc_pc_pc,                /* 1078 */
+    PARROT_OP_fetch_p_p_i_p,                   /* 1079 */
+    PARROT_OP_fetch_p_pc_i_p,                  /* 1080 */
+    PARROT_OP_fetch_p_p_ic_p,                  /* 1081 */
+    PARROT_OP_fetch_p_pc_ic_p,                 /* 1082 */
+    PARROT_OP_fetch_p_p_i_pc,                  /* 1083 */
+    PARROT_OP_fetch_p_pc_i_pc,                 /* 1084 */
+    PARROT_OP_fetch_p_p_ic_pc,                 /* 1085 */
+    PARROT_OP_fetch_p_pc_ic_pc,                /* 1086 */
+    PARROT_OP_fetch_p_p_s_p,                   /* 1087 */
+    PARROT_OP_fetch_p_pc_s_p,                  /* 1088 */
+    PARROT_OP_fetch_p_p_sc_p,                  /* 1089 */
+    PARROT_OP_fetch_p_pc_sc_p,                 /* 1090 */
+    PARROT_OP_fetch_p_p_s_pc,                  /* 1091 */
+    PARROT_OP_fetch_p_pc_s_pc,                 /* 1092 */
+    PARROT_OP_fetch_p_p_sc_pc,                 /* 1093 */
+    PARROT_OP_fetch_p_pc_sc_pc,                /* 1094 */
+    PARROT_OP_vivify_p_p_p_p,                  /* 1095 */
+    PARROT_OP_vivify_p_pc_p_p,                 /* 1096 */
+    PARROT_OP_vivify_p_p_pc_p,                 /* 1097 */
+    PARROT_OP_vivify_p_pc_pc_p,                /* 1098 */
+    PARROT_OP_vivify_p_p_p_pc,                 /* 1099 */
+    PARROT_OP_vivify_p_pc_p_pc,                /* 1100 */
+    PARROT_OP_vivify_p_p_pc_pc,                /* 1101 */
+    PARROT_OP_vivify_p_pc_pc_pc,               /* 1102 */
+    PARROT_OP_vivify_p_p_i_p,                  /* 1103 */
+    PARROT_OP_vivify_p_pc_i_p,                 /* 1104 */
+    PARROT_OP_vivify_p_p_ic_p,                 /* 1105 */
+    PARROT_OP_vivify_p_pc_ic_p,                /* 1106 */
+    PARROT_OP_vivify_p_p_i_pc,                 /* 1107 */
+    PARROT_OP_vivify_p_pc_i_pc,                /* 1108 */
+    PARROT_OP_vivify_p_p_ic_pc,                /* 1109 */
+    PARROT_OP_vivify_p_pc_ic_pc,               /* 1110 */
+    PARROT_OP_vivify_p_p_s_p,                  /* 1111 */
+    PARROT_OP_vivify_p_pc_s_p,                 /* 1112 */
+    PARROT_OP_vivify_p_p_sc_p,                 /* 1113 */
+    PARROT_OP_vivify_p_pc_sc_p,                /* 1114 */
+    PARROT_OP_vivify_p_p_s_pc,                 /* 1115 */
+    PARROT_OP_vivify_p_pc_s_pc,                /* 1116 */
+    PARROT_OP_vivify_p_p_sc_pc,                /* 1117 */
+    PARROT_OP_vivify_p_pc_sc_pc,               /* 1118 */
+    PARROT_OP_new_p_s_i,                       /* 1119 */
+    PARROT_OP_new_p_sc_i,                      /* 1120 */
+    PARROT_OP_new_p_s_ic,                      /* 1121 */
+    PARROT_OP_new_p_sc_ic,                     /* 1122 */
+    PARROT_OP_new_p_p_i,                       /* 1123 */
+    PARROT_OP_new_p_pc_i,                      /* 1124 */
+    PARROT_OP_new_p_p_ic,                      /* 1125 */
+    PARROT_OP_new_p_pc_ic,                     /* 1126 */
+    PARROT_OP_root_new_p_p_i,                  /* 1127 */
+    PARROT_OP_root_new_p_pc_i,                 /* 1128 */
+    PARROT_OP_root_new_p_p_ic,                 /* 1129 */
+    PARROT_OP_root_new_p_pc_ic,                /* 1130 */
+    PARROT_OP_get_context_p,                   /* 1131 */
+    PARROT_OP_new_call_context_p,              /* 1132 */
+    PARROT_OP_invokecc_p_p,                    /* 1133 */
+    PARROT_OP_flatten_array_into_p_p_i,        /* 1134 */
+    PARROT_OP_flatten_array_into_p_p_ic,       /* 1135 */
+    PARROT_OP_flatten_hash_into_p_p_i,         /* 1136 */
+    PARROT_OP_flatten_hash_into_p_p_ic,        /* 1137 */
+    PARROT_OP_slurp_array_from_p_p_i,          /* 1138 */
+    PARROT_OP_slurp_array_from_p_p_ic,         /* 1139 */
+    PARROT_OP_receive_p,                       /* 1140 */
+    PARROT_OP_wait_p,                          /* 1141 */
+    PARROT_OP_wait_pc,                         /* 1142 */
+    PARROT_OP_pass,                            /* 1143 */
+    PARROT_OP_disable_preemption,              /* 1144 */
+    PARROT_OP_enable_preemption,               /* 1145 */
+    PARROT_OP_green_threads_i,                 /* 1146 */
+    PARROT_OP_green_threads_ic,                /* 1147 */
+    PARROT_OP_terminate,                       /* 1148 */
+    PARROT_OP_intern_s_s,                      /* 1149 */
+    PARROT_OP_intern_s_sc                      /* 1150 */
 
 } parrot_opcode_enums;
 
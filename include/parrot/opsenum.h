@@ -599,549 +599,571 @@ enum OPS_ENUM {
     enum_ops_removeattribute_p_sc          =  583,
     enum_ops_getattribute_p_p_s            =  584,
     enum_ops_getattribute_p_p_sc           =  585,
-    enum_ops_getattribute_p_p_p_s          =  586,
-    enum_ops_getattribute_p_p_pc_s         =  587,
-    enum_ops_getattribute_p_p_p_sc         =  588,
-    enum_ops_getattribute_p_p_pc_sc        =  589,
-    enum_ops_setattribute_p_s_p            =  590,
-    enum_ops_setattribute_p_sc_p           =  591,
-    enum_ops_setattribute_p_p_s_p          =  592,
-    enum_ops_setattribute_p_pc_s_p         =  593,
-    enum_ops_setattribute_p_p_sc_p         =  594,
-    enum_ops_setattribute_p_pc_sc_p        =  595,
-    enum_ops_inspect_p_p                   =  596,
-    enum_ops_inspect_p_pc                  =  597,
-    enum_ops_inspect_p_p_s                 =  598,
-    enum_ops_inspect_p_pc_s                =  599,
-    enum_ops_inspect_p_p_sc                =  600,
-    enum_ops_inspect_p_pc_sc               =  601,
-    enum_ops_new_p_s                       =  602,
-    enum_ops_new_p_sc                      =  603,
-    enum_ops_new_p_s_p                     =  604,
-    enum_ops_new_p_sc_p                    =  605,
-    enum_ops_new_p_s_pc                    =  606,
-    enum_ops_new_p_sc_pc                   =  607,
-    enum_ops_new_p_p                       =  608,
-    enum_ops_new_p_pc                      =  609,
-    enum_ops_new_p_p_p                     =  610,
-    enum_ops_new_p_pc_p                    =  611,
-    enum_ops_new_p_p_pc                    =  612,
-    enum_ops_new_p_pc_pc                   =  613,
-    enum_ops_root_new_p_p                  =  614,
-    enum_ops_root_new_p_pc                 =  615,
-    enum_ops_root_new_p_p_p                =  616,
-    enum_ops_root_new_p_pc_p               =  617,
-    enum_ops_root_new_p_p_pc               =  618,
-    enum_ops_root_new_p_pc_pc              =  619,
-    enum_ops_typeof_s_p                    =  620,
-    enum_ops_typeof_p_p                    =  621,
-    enum_ops_get_repr_s_p                  =  622,
-    enum_ops_find_method_p_p_s             =  623,
-    enum_ops_find_method_p_p_sc            =  624,
-    enum_ops_defined_i_p                   =  625,
-    enum_ops_defined_i_p_ki                =  626,
-    enum_ops_defined_i_p_kic               =  627,
-    enum_ops_defined_i_p_k                 =  628,
-    enum_ops_defined_i_p_kc                =  629,
-    enum_ops_exists_i_p_ki                 =  630,
-    enum_ops_exists_i_p_kic                =  631,
-    enum_ops_exists_i_p_k                  =  632,
-    enum_ops_exists_i_p_kc                 =  633,
-    enum_ops_delete_p_k                    =  634,
-    enum_ops_delete_p_kc                   =  635,
-    enum_ops_delete_p_ki                   =  636,
-    enum_ops_delete_p_kic                  =  637,
-    enum_ops_elements_i_p                  =  638,
-    enum_ops_push_p_i                      =  639,
-    enum_ops_push_p_ic                     =  640,
-    enum_ops_push_p_n                      =  641,
-    enum_ops_push_p_nc                     =  642,
-    enum_ops_push_p_s                      =  643,
-    enum_ops_push_p_sc                     =  644,
-    enum_ops_push_p_p                      =  645,
-    enum_ops_pop_i_p                       =  646,
-    enum_ops_pop_n_p                       =  647,
-    enum_ops_pop_s_p                       =  648,
-    enum_ops_pop_p_p                       =  649,
-    enum_ops_unshift_p_i                   =  650,
-    enum_ops_unshift_p_ic                  =  651,
-    enum_ops_unshift_p_n                   =  652,
-    enum_ops_unshift_p_nc                  =  653,
-    enum_ops_unshift_p_s                   =  654,
-    enum_ops_unshift_p_sc                  =  655,
-    enum_ops_unshift_p_p                   =  656,
-    enum_ops_shift_i_p                     =  657,
-    enum_ops_shift_n_p                     =  658,
-    enum_ops_shift_s_p                     =  659,
-    enum_ops_shift_p_p                     =  660,
-    enum_ops_splice_p_p_i_i                =  661,
-    enum_ops_splice_p_p_ic_i               =  662,
-    enum_ops_splice_p_p_i_ic               =  663,
-    enum_ops_splice_p_p_ic_ic              =  664,
-    enum_ops_setprop_p_s_p                 =  665,
-    enum_ops_setprop_p_sc_p                =  666,
-    enum_ops_getprop_p_s_p                 =  667,
-    enum_ops_getprop_p_sc_p                =  668,
-    enum_ops_getprop_p_p_s                 =  669,
-    enum_ops_getprop_p_p_sc                =  670,
-    enum_ops_delprop_p_s                   =  671,
-    enum_ops_delprop_p_sc                  =  672,
-    enum_ops_prophash_p_p                  =  673,
-    enum_ops_freeze_s_p                    =  674,
-    enum_ops_thaw_p_s                      =  675,
-    enum_ops_thaw_p_sc                     =  676,
-    enum_ops_add_multi_s_s_p               =  677,
-    enum_ops_add_multi_sc_s_p              =  678,
-    enum_ops_add_multi_s_sc_p              =  679,
-    enum_ops_add_multi_sc_sc_p             =  680,
-    enum_ops_find_multi_p_s_s              =  681,
-    enum_ops_find_multi_p_sc_s             =  682,
-    enum_ops_find_multi_p_s_sc             =  683,
-    enum_ops_find_multi_p_sc_sc            =  684,
-    enum_ops_register_p                    =  685,
-    enum_ops_unregister_p                  =  686,
-    enum_ops_box_p_i                       =  687,
-    enum_ops_box_p_ic                      =  688,
-    enum_ops_box_p_n                       =  689,
-    enum_ops_box_p_nc                      =  690,
-    enum_ops_box_p_s                       =  691,
-    enum_ops_box_p_sc                      =  692,
-    enum_ops_iter_p_p                      =  693,
-    enum_ops_morph_p_p                     =  694,
-    enum_ops_morph_p_pc                    =  695,
-    enum_ops_clone_s_s                     =  696,
-    enum_ops_clone_s_sc                    =  697,
-    enum_ops_set_i_i                       =  698,
-    enum_ops_set_i_ic                      =  699,
-    enum_ops_set_i_n                       =  700,
-    enum_ops_set_i_nc                      =  701,
-    enum_ops_set_i_s                       =  702,
-    enum_ops_set_i_sc                      =  703,
-    enum_ops_set_n_n                       =  704,
-    enum_ops_set_n_nc                      =  705,
-    enum_ops_set_n_i                       =  706,
-    enum_ops_set_n_ic                      =  707,
-    enum_ops_set_n_s                       =  708,
-    enum_ops_set_n_sc                      =  709,
-    enum_ops_set_n_p                       =  710,
-    enum_ops_set_s_p                       =  711,
-    enum_ops_set_s_s                       =  712,
-    enum_ops_set_s_sc                      =  713,
-    enum_ops_set_s_i                       =  714,
-    enum_ops_set_s_ic                      =  715,
-    enum_ops_set_s_n                       =  716,
-    enum_ops_set_s_nc                      =  717,
-    enum_ops_set_p_pc                      =  718,
-    enum_ops_set_p_p                       =  719,
-    enum_ops_set_p_i                       =  720,
-    enum_ops_set_p_ic                      =  721,
-    enum_ops_set_p_n                       =  722,
-    enum_ops_set_p_nc                      =  723,
-    enum_ops_set_p_s                       =  724,
-    enum_ops_set_p_sc                      =  725,
-    enum_ops_set_i_p                       =  726,
-    enum_ops_assign_p_p                    =  727,
-    enum_ops_assign_p_i                    =  728,
-    enum_ops_assign_p_ic                   =  729,
-    enum_ops_assign_p_n                    =  730,
-    enum_ops_assign_p_nc                   =  731,
-    enum_ops_assign_p_s                    =  732,
-    enum_ops_assign_p_sc                   =  733,
-    enum_ops_assign_s_s                    =  734,
-    enum_ops_assign_s_sc                   =  735,
-    enum_ops_setref_p_p                    =  736,
-    enum_ops_deref_p_p                     =  737,
-    enum_ops_set_p_ki_i                    =  738,
-    enum_ops_set_p_kic_i                   =  739,
-    enum_ops_set_p_ki_ic                   =  740,
-    enum_ops_set_p_kic_ic                  =  741,
-    enum_ops_set_p_ki_n                    =  742,
-    enum_ops_set_p_kic_n                   =  743,
-    enum_ops_set_p_ki_nc                   =  744,
-    enum_ops_set_p_kic_nc                  =  745,
-    enum_ops_set_p_ki_s                    =  746,
-    enum_ops_set_p_kic_s                   =  747,
-    enum_ops_set_p_ki_sc                   =  748,
-    enum_ops_set_p_kic_sc                  =  749,
-    enum_ops_set_p_ki_p                    =  750,
-    enum_ops_set_p_kic_p                   =  751,
-    enum_ops_set_i_p_ki                    =  752,
-    enum_ops_set_i_p_kic                   =  753,
-    enum_ops_set_n_p_ki                    =  754,
-    enum_ops_set_n_p_kic                   =  755,
-    enum_ops_set_s_p_ki                    =  756,
-    enum_ops_set_s_p_kic                   =  757,
-    enum_ops_set_p_p_ki                    =  758,
-    enum_ops_set_p_p_kic                   =  759,
-    enum_ops_set_p_k_i                     =  760,
-    enum_ops_set_p_kc_i                    =  761,
-    enum_ops_set_p_k_ic                    =  762,
-    enum_ops_set_p_kc_ic                   =  763,
-    enum_ops_set_p_k_n                     =  764,
-    enum_ops_set_p_kc_n                    =  765,
-    enum_ops_set_p_k_nc                    =  766,
-    enum_ops_set_p_kc_nc                   =  767,
-    enum_ops_set_p_k_s                     =  768,
-    enum_ops_set_p_kc_s                    =  769,
-    enum_ops_set_p_k_sc                    =  770,
-    enum_ops_set_p_kc_sc                   =  771,
-    enum_ops_set_p_k_p                     =  772,
-    enum_ops_set_p_kc_p                    =  773,
-    enum_ops_set_i_p_k                     =  774,
-    enum_ops_set_i_p_kc                    =  775,
-    enum_ops_set_n_p_k                     =  776,
-    enum_ops_set_n_p_kc                    =  777,
-    enum_ops_set_s_p_k                     =  778,
-    enum_ops_set_s_p_kc                    =  779,
-    enum_ops_set_p_p_k                     =  780,
-    enum_ops_set_p_p_kc                    =  781,
-    enum_ops_clone_p_p                     =  782,
-    enum_ops_clone_p_p_p                   =  783,
-    enum_ops_clone_p_p_pc                  =  784,
-    enum_ops_copy_p_p                      =  785,
-    enum_ops_null_s                        =  786,
-    enum_ops_null_i                        =  787,
-    enum_ops_null_p                        =  788,
-    enum_ops_null_n                        =  789,
-    enum_ops_ord_i_s                       =  790,
-    enum_ops_ord_i_sc                      =  791,
-    enum_ops_ord_i_s_i                     =  792,
-    enum_ops_ord_i_sc_i                    =  793,
-    enum_ops_ord_i_s_ic                    =  794,
-    enum_ops_ord_i_sc_ic                   =  795,
-    enum_ops_chr_s_i                       =  796,
-    enum_ops_chr_s_ic                      =  797,
-    enum_ops_chopn_s_s_i                   =  798,
-    enum_ops_chopn_s_sc_i                  =  799,
-    enum_ops_chopn_s_s_ic                  =  800,
-    enum_ops_chopn_s_sc_ic                 =  801,
-    enum_ops_concat_p_p                    =  802,
-    enum_ops_concat_p_s                    =  803,
-    enum_ops_concat_p_sc                   =  804,
-    enum_ops_concat_s_s_s                  =  805,
-    enum_ops_concat_s_sc_s                 =  806,
-    enum_ops_concat_s_s_sc                 =  807,
-    enum_ops_concat_p_p_s                  =  808,
-    enum_ops_concat_p_p_sc                 =  809,
-    enum_ops_concat_p_p_p                  =  810,
-    enum_ops_repeat_s_s_i                  =  811,
-    enum_ops_repeat_s_sc_i                 =  812,
-    enum_ops_repeat_s_s_ic                 =  813,
-    enum_ops_repeat_s_sc_ic                =  814,
-    enum_ops_repeat_p_p_i                  =  815,
-    enum_ops_repeat_p_p_ic                 =  816,
-    enum_ops_repeat_p_p_p                  =  817,
-    enum_ops_repeat_p_i                    =  818,
-    enum_ops_repeat_p_ic                   =  819,
-    enum_ops_repeat_p_p                    =  820,
-    enum_ops_length_i_s                    =  821,
-    enum_ops_length_i_sc                   =  822,
-    enum_ops_bytelength_i_s                =  823,
-    enum_ops_bytelength_i_sc               =  824,
-    enum_ops_pin_s                         =  825,
-    enum_ops_unpin_s                       =  826,
-    enum_ops_substr_s_s_i                  =  827,
-    enum_ops_substr_s_sc_i                 =  828,
-    enum_ops_substr_s_s_ic                 =  829,
-    enum_ops_substr_s_sc_ic                =  830,
-    enum_ops_substr_s_s_i_i                =  831,
-    enum_ops_substr_s_sc_i_i               =  832,
-    enum_ops_substr_s_s_ic_i               =  833,
-    enum_ops_substr_s_sc_ic_i              =  834,
-    enum_ops_substr_s_s_i_ic               =  835,
-    enum_ops_substr_s_sc_i_ic              =  836,
-    enum_ops_substr_s_s_ic_ic              =  837,
-    enum_ops_substr_s_sc_ic_ic             =  838,
-    enum_ops_substr_s_p_i_i                =  839,
-    enum_ops_substr_s_p_ic_i               =  840,
-    enum_ops_substr_s_p_i_ic               =  841,
-    enum_ops_substr_s_p_ic_ic              =  842,
-    enum_ops_replace_s_s_i_i_s             =  843,
-    enum_ops_replace_s_sc_i_i_s            =  844,
-    enum_ops_replace_s_s_ic_i_s            =  845,
-    enum_ops_replace_s_sc_ic_i_s           =  846,
-    enum_ops_replace_s_s_i_ic_s            =  847,
-    enum_ops_replace_s_sc_i_ic_s           =  848,
-    enum_ops_replace_s_s_ic_ic_s           =  849,
-    enum_ops_replace_s_sc_ic_ic_s          =  850,
-    enum_ops_replace_s_s_i_i_sc            =  851,
-    enum_ops_replace_s_sc_i_i_sc           =  852,
-    enum_ops_replace_s_s_ic_i_sc           =  853,
-    enum_ops_replace_s_sc_ic_i_sc          =  854,
-    enum_ops_replace_s_s_i_ic_sc           =  855,
-    enum_ops_replace_s_sc_i_ic_sc          =  856,
-    enum_ops_replace_s_s_ic_ic_sc          =  857,
-    enum_ops_replace_s_sc_ic_ic_sc         =  858,
-    enum_ops_index_i_s_s                   =  859,
-    enum_ops_index_i_sc_s                  =  860,
-    enum_ops_index_i_s_sc                  =  861,
-    enum_ops_index_i_sc_sc                 =  862,
-    enum_ops_index_i_s_s_i                 =  863,
-    enum_ops_index_i_sc_s_i                =  864,
-    enum_ops_index_i_s_sc_i                =  865,
-    enum_ops_index_i_sc_sc_i               =  866,
-    enum_ops_index_i_s_s_ic                =  867,
-    enum_ops_index_i_sc_s_ic               =  868,
-    enum_ops_index_i_s_sc_ic               =  869,
-    enum_ops_index_i_sc_sc_ic              =  870,
-    enum_ops_rindex_i_s_s                  =  871,
-    enum_ops_rindex_i_sc_s                 =  872,
-    enum_ops_rindex_i_s_sc                 =  873,
-    enum_ops_rindex_i_sc_sc                =  874,
-    enum_ops_rindex_i_s_s_i                =  875,
-    enum_ops_rindex_i_sc_s_i               =  876,
-    enum_ops_rindex_i_s_sc_i               =  877,
-    enum_ops_rindex_i_sc_sc_i              =  878,
-    enum_ops_rindex_i_s_s_ic               =  879,
-    enum_ops_rindex_i_sc_s_ic              =  880,
-    enum_ops_rindex_i_s_sc_ic              =  881,
-    enum_ops_rindex_i_sc_sc_ic             =  882,
-    enum_ops_sprintf_s_s_p                 =  883,
-    enum_ops_sprintf_s_sc_p                =  884,
-    enum_ops_sprintf_p_p_p                 =  885,
-    enum_ops_new_s                         =  886,
-    enum_ops_stringinfo_i_s_i              =  887,
-    enum_ops_stringinfo_i_sc_i             =  888,
-    enum_ops_stringinfo_i_s_ic             =  889,
-    enum_ops_stringinfo_i_sc_ic            =  890,
-    enum_ops_upcase_s_s                    =  891,
-    enum_ops_upcase_s_sc                   =  892,
-    enum_ops_downcase_s_s                  =  893,
-    enum_ops_downcase_s_sc                 =  894,
-    enum_ops_titlecase_s_s                 =  895,
-    enum_ops_titlecase_s_sc                =  896,
-    enum_ops_join_s_s_p                    =  897,
-    enum_ops_join_s_sc_p                   =  898,
-    enum_ops_split_p_s_s                   =  899,
-    enum_ops_split_p_sc_s                  =  900,
-    enum_ops_split_p_s_sc                  =  901,
-    enum_ops_split_p_sc_sc                 =  902,
-    enum_ops_encoding_i_s                  =  903,
-    enum_ops_encoding_i_sc                 =  904,
-    enum_ops_encodingname_s_i              =  905,
-    enum_ops_encodingname_s_ic             =  906,
-    enum_ops_find_encoding_i_s             =  907,
-    enum_ops_find_encoding_i_sc            =  908,
-    enum_ops_trans_encoding_s_s_i          =  909,
-    enum_ops_trans_encoding_s_sc_i         =  910,
-    enum_ops_trans_encoding_s_s_ic         =  911,
-    enum_ops_trans_encoding_s_sc_ic        =  912,
-    enum_ops_is_cclass_i_i_s_i             =  913,
-    enum_ops_is_cclass_i_ic_s_i            =  914,
-    enum_ops_is_cclass_i_i_sc_i            =  915,
-    enum_ops_is_cclass_i_ic_sc_i           =  916,
-    enum_ops_is_cclass_i_i_s_ic            =  917,
-    enum_ops_is_cclass_i_ic_s_ic           =  918,
-    enum_ops_is_cclass_i_i_sc_ic           =  919,
-    enum_ops_is_cclass_i_ic_sc_ic          =  920,
-    enum_ops_find_cclass_i_i_s_i_i         =  921,
-    enum_ops_find_cclass_i_ic_s_i_i        =  922,
-    enum_ops_find_cclass_i_i_sc_i_i        =  923,
-    enum_ops_find_cclass_i_ic_sc_i_i       =  924,
-    enum_ops_find_cclass_i_i_s_ic_i        =  925,
-    enum_ops_find_cclass_i_ic_s_ic_i       =  926,
-    enum_ops_find_cclass_i_i_sc_ic_i       =  927,
-    enum_ops_find_cclass_i_ic_sc_ic_i      =  928,
-    enum_ops_find_cclass_i_i_s_i_ic        =  929,
-    enum_ops_find_cclass_i_ic_s_i_ic       =  930,
-    enum_ops_find_cclass_i_i_sc_i_ic       =  931,
-    enum_ops_find_cclass_i_ic_sc_i_ic      =  932,
-    enum_ops_find_cclass_i_i_s_ic_ic       =  933,
-    enum_ops_find_cclass_i_ic_s_ic_ic      =  934,
-    enum_ops_find_cclass_i_i_sc_ic_ic      =  935,
-    enum_ops_find_cclass_i_ic_sc_ic_ic     =  936,
-    enum_ops_find_not_cclass_i_i_s_i_i     =  937,
-    enum_ops_find_not_cclass_i_ic_s_i_i    =  938,
-    enum_ops_find_not_cclass_i_i_sc_i_i    =  939,
-    enum_ops_find_not_cclass_i_ic_sc_i_i   =  940,
-    enum_ops_find_not_cclass_i_i_s_ic_i    =  941,
-    enum_ops_find_not_cclass_i_ic_s_ic_i   =  942,
-    enum_ops_find_not_cclass_i_i_sc_ic_i   =  943,
-    enum_ops_find_not_cclass_i_ic_sc_ic_i  =  944,
-    enum_ops_find_not_cclass_i_i_s_i_ic    =  945,
-    enum_ops_find_not_cclass_i_ic_s_i_ic   =  946,
-    enum_ops_find_not_cclass_i_i_sc_i_ic   =  947,
-    enum_ops_find_not_cclass_i_ic_sc_i_ic  =  948,
-    enum_ops_find_not_cclass_i_i_s_ic_ic   =  949,
-    enum_ops_find_not_cclass_i_ic_s_ic_ic  =  950,
-    enum_ops_find_not_cclass_i_i_sc_ic_ic  =  951,
-    enum_ops_find_not_cclass_i_ic_sc_ic_ic =  952,
-    enum_ops_escape_s_s                    =  953,
-    enum_ops_compose_s_s                   =  954,
-    enum_ops_compose_s_sc                  =  955,
-    enum_ops_find_codepoint_i_s            =  956,
-    enum_ops_find_codepoint_i_sc           =  957,
-    enum_ops_spawnw_i_s                    =  958,
-    enum_ops_spawnw_i_sc                   =  959,
-    enum_ops_spawnw_i_p                    =  960,
-    enum_ops_err_i                         =  961,
-    enum_ops_err_s                         =  962,
-    enum_ops_err_s_i                       =  963,
-    enum_ops_err_s_ic                      =  964,
-    enum_ops_time_i                        =  965,
-    enum_ops_time_n                        =  966,
-    enum_ops_sleep_i                       =  967,
-    enum_ops_sleep_ic                      =  968,
-    enum_ops_sleep_n                       =  969,
-    enum_ops_sleep_nc                      =  970,
-    enum_ops_store_lex_s_p                 =  971,
-    enum_ops_store_lex_sc_p                =  972,
-    enum_ops_store_lex_s_s                 =  973,
-    enum_ops_store_lex_sc_s                =  974,
-    enum_ops_store_lex_s_sc                =  975,
-    enum_ops_store_lex_sc_sc               =  976,
-    enum_ops_store_lex_s_i                 =  977,
-    enum_ops_store_lex_sc_i                =  978,
-    enum_ops_store_lex_s_ic                =  979,
-    enum_ops_store_lex_sc_ic               =  980,
-    enum_ops_store_lex_s_n                 =  981,
-    enum_ops_store_lex_sc_n                =  982,
-    enum_ops_store_lex_s_nc                =  983,
-    enum_ops_store_lex_sc_nc               =  984,
-    enum_ops_store_dynamic_lex_s_p         =  985,
-    enum_ops_store_dynamic_lex_sc_p        =  986,
-    enum_ops_find_lex_p_s                  =  987,
-    enum_ops_find_lex_p_sc                 =  988,
-    enum_ops_find_lex_s_s                  =  989,
-    enum_ops_find_lex_s_sc                 =  990,
-    enum_ops_find_lex_i_s                  =  991,
-    enum_ops_find_lex_i_sc                 =  992,
-    enum_ops_find_lex_n_s                  =  993,
-    enum_ops_find_lex_n_sc                 =  994,
-    enum_ops_find_dynamic_lex_p_s          =  995,
-    enum_ops_find_dynamic_lex_p_sc         =  996,
-    enum_ops_find_caller_lex_p_s           =  997,
-    enum_ops_find_caller_lex_p_sc          =  998,
-    enum_ops_get_namespace_p               =  999,
-    enum_ops_get_namespace_p_p             = 1000,
-    enum_ops_get_namespace_p_pc            = 1001,
-    enum_ops_get_hll_namespace_p           = 1002,
-    enum_ops_get_hll_namespace_p_p         = 1003,
-    enum_ops_get_hll_namespace_p_pc        = 1004,
-    enum_ops_get_root_namespace_p          = 1005,
-    enum_ops_get_root_namespace_p_p        = 1006,
-    enum_ops_get_root_namespace_p_pc       = 1007,
-    enum_ops_get_global_p_s                = 1008,
-    enum_ops_get_global_p_sc               = 1009,
-    enum_ops_get_global_p_p_s              = 1010,
-    enum_ops_get_global_p_pc_s             = 1011,
-    enum_ops_get_global_p_p_sc             = 1012,
-    enum_ops_get_global_p_pc_sc            = 1013,
-    enum_ops_get_hll_global_p_s            = 1014,
-    enum_ops_get_hll_global_p_sc           = 1015,
-    enum_ops_get_hll_global_p_p_s          = 1016,
-    enum_ops_get_hll_global_p_pc_s         = 1017,
-    enum_ops_get_hll_global_p_p_sc         = 1018,
-    enum_ops_get_hll_global_p_pc_sc        = 1019,
-    enum_ops_get_root_global_p_s           = 1020,
-    enum_ops_get_root_global_p_sc          = 1021,
-    enum_ops_get_root_global_p_p_s         = 1022,
-    enum_ops_get_root_global_p_pc_s        = 1023,
-    enum_ops_get_root_global_p_p_sc        = 1024,
-    enum_ops_get_root_global_p_pc_sc       = 1025,
-    enum_ops_set_global_s_p                = 1026,
-    enum_ops_set_global_sc_p               = 1027,
-    enum_ops_set_global_p_s_p              = 1028,
-    enum_ops_set_global_pc_s_p             = 1029,
-    enum_ops_set_global_p_sc_p             = 1030,
-    enum_ops_set_global_pc_sc_p            = 1031,
-    enum_ops_set_hll_global_s_p            = 1032,
-    enum_ops_set_hll_global_sc_p           = 1033,
-    enum_ops_set_hll_global_p_s_p          = 1034,
-    enum_ops_set_hll_global_pc_s_p         = 1035,
-    enum_ops_set_hll_global_p_sc_p         = 1036,
-    enum_ops_set_hll_global_pc_sc_p        = 1037,
-    enum_ops_set_root_global_s_p           = 1038,
-    enum_ops_set_root_global_sc_p          = 1039,
-    enum_ops_set_root_global_p_s_p         = 1040,
-    enum_ops_set_root_global_pc_s_p        = 1041,
-    enum_ops_set_root_global_p_sc_p        = 1042,
-    enum_ops_set_root_global_pc_sc_p       = 1043,
-    enum_ops_find_name_p_s                 = 1044,
-    enum_ops_find_name_p_sc                = 1045,
-    enum_ops_find_sub_not_null_p_s         = 1046,
-    enum_ops_find_sub_not_null_p_sc        = 1047,
-    enum_ops_trap                          = 1048,
-    enum_ops_set_label_p_ic                = 1049,
-    enum_ops_get_label_i_p                 = 1050,
-    enum_ops_get_id_i_p                    = 1051,
-    enum_ops_get_id_i_pc                   = 1052,
-    enum_ops_fetch_p_p_p_p                 = 1053,
-    enum_ops_fetch_p_pc_p_p                = 1054,
-    enum_ops_fetch_p_p_pc_p                = 1055,
-    enum_ops_fetch_p_pc_pc_p               = 1056,
-    enum_ops_fetch_p_p_p_pc                = 1057,
-    enum_ops_fetch_p_pc_p_pc               = 1058,
-    enum_ops_fetch_p_p_pc_pc               = 1059,
-    enum_ops_fetch_p_pc_pc_pc              = 1060,
-    enum_ops_fetch_p_p_i_p                 = 1061,
-    enum_ops_fetch_p_pc_i_p                = 1062,
-    enum_ops_fetch_p_p_ic_p                = 1063,
-    enum_ops_fetch_p_pc_ic_p               = 1064,
-    enum_ops_fetch_p_p_i_pc                = 1065,
-    enum_ops_fetch_p_pc_i_pc               = 1066,
-    enum_ops_fetch_p_p_ic_pc               = 1067,
-    enum_ops_fetch_p_pc_ic_pc              = 1068,
-    enum_ops_fetch_p_p_s_p                 = 1069,
-    enum_ops_fetch_p_pc_s_p                = 1070,
-    enum_ops_fetch_p_p_sc_p                = 1071,
-    enum_ops_fetch_p_pc_sc_p               = 1072,
-    enum_ops_fetch_p_p_s_pc                = 1073,
-    enum_ops_fetch_p_pc_s_pc               = 1074,
-    enum_ops_fetch_p_p_sc_pc               = 1075,
-    enum_ops_fetch_p_pc_sc_pc              = 1076,
-    enum_ops_vivify_p_p_p_p                = 1077,
-    enum_ops_vivify_p_pc_p_p               = 1078,
-    enum_ops_vivify_p_p_pc_p               = 1079,
-    enum_ops_vivify_p_pc_pc_p              = 1080,
-    enum_ops_vivify_p_p_p_pc               = 1081,
-    enum_ops_vivify_p_pc_p_pc              = 1082,
-    enum_ops_vivify_p_p_pc_pc              = 1083,
-    enum_ops_vivify_p_pc_pc_pc             = 1084,
-    enum_ops_vivify_p_p_i_p                = 1085,
-    enum_ops_vivify_p_pc_i_p               = 1086,
-    enum_ops_vivify_p_p_ic_p               = 1087,
-    enum_ops_vivify_p_pc_ic_p              = 1088,
-    enum_ops_vivify_p_p_i_pc               = 1089,
-    enum_ops_vivify_p_pc_i_pc              = 1090,
-    enum_ops_vivify_p_p_ic_pc              = 1091,
-    enum_ops_vivify_p_pc_ic_pc             = 1092,
-    enum_ops_vivify_p_p_s_p                = 1093,
-    enum_ops_vivify_p_pc_s_p               = 1094,
-    enum_ops_vivify_p_p_sc_p               = 1095,
-    enum_ops_vivify_p_pc_sc_p              = 1096,
-    enum_ops_vivify_p_p_s_pc               = 1097,
-    enum_ops_vivify_p_pc_s_pc              = 1098,
-    enum_ops_vivify_p_p_sc_pc              = 1099,
-    enum_ops_vivify_p_pc_sc_pc             = 1100,
-    enum_ops_new_p_s_i                     = 1101,
-    enum_ops_new_p_sc_i                    = 1102,
-    enum_ops_new_p_s_ic                    = 1103,
-    enum_ops_new_p_sc_ic                   = 1104,
-    enum_ops_new_p_p_i                     = 1105,
-    enum_ops_new_p_pc_i                    = 1106,
-    enum_ops_new_p_p_ic                    = 1107,
-    enum_ops_new_p_pc_ic                   = 1108,
-    enum_ops_root_new_p_p_i                = 1109,
-    enum_ops_root_new_p_pc_i               = 1110,
-    enum_ops_root_new_p_p_ic               = 1111,
-    enum_ops_root_new_p_pc_ic              = 1112,
-    enum_ops_get_context_p                 = 1113,
-    enum_ops_new_call_context_p            = 1114,
-    enum_ops_invokecc_p_p                  = 1115,
-    enum_ops_flatten_array_into_p_p_i      = 1116,
-    enum_ops_flatten_array_into_p_p_ic     = 1117,
-    enum_ops_flatten_hash_into_p_p_i       = 1118,
-    enum_ops_flatten_hash_into_p_p_ic      = 1119,
-    enum_ops_slurp_array_from_p_p_i        = 1120,
-    enum_ops_slurp_array_from_p_p_ic       = 1121,
-    enum_ops_receive_p                     = 1122,
-    enum_ops_wait_p                        = 1123,
-    enum_ops_wait_pc                       = 1124,
-    enum_ops_pass                          = 1125,
-    enum_ops_disable_preemption            = 1126,
-    enum_ops_enable_preemption             = 1127,
-    enum_ops_terminate                     = 1128,
+    enum_ops_getattribute_i_p_s            =  586,
+    enum_ops_getattribute_i_p_sc           =  587,
+    enum_ops_getattribute_n_p_s            =  588,
+    enum_ops_getattribute_n_p_sc           =  589,
+    enum_ops_getattribute_s_p_s            =  590,
+    enum_ops_getattribute_s_p_sc           =  591,
+    enum_ops_getattribute_p_p_p_s          =  592,
+    enum_ops_getattribute_p_p_pc_s         =  593,
+    enum_ops_getattribute_p_p_p_sc         =  594,
+    enum_ops_getattribute_p_p_pc_sc        =  595,
+    enum_ops_setattribute_p_s_p            =  596,
+    enum_ops_setattribute_p_sc_p           =  597,
+    enum_ops_setattribute_p_s_i            =  598,
+    enum_ops_setattribute_p_sc_i           =  599,
+    enum_ops_setattribute_p_s_ic           =  600,
+    enum_ops_setattribute_p_sc_ic          =  601,
+    enum_ops_setattribute_p_s_n            =  602,
+    enum_ops_setattribute_p_sc_n           =  603,
+    enum_ops_setattribute_p_s_nc           =  604,
+    enum_ops_setattribute_p_sc_nc          =  605,
+    enum_ops_setattribute_p_s_s            =  606,
+    enum_ops_setattribute_p_sc_s           =  607,
+    enum_ops_setattribute_p_s_sc           =  608,
+    enum_ops_setattribute_p_sc_sc          =  609,
+    enum_ops_setattribute_p_p_s_p          =  610,
+    enum_ops_setattribute_p_pc_s_p         =  611,
+    enum_ops_setattribute_p_p_sc_p         =  612,
+    enum_ops_setattribute_p_pc_sc_p        =  613,
+    enum_ops_inspect_p_p                   =  614,
+    enum_ops_inspect_p_pc                  =  615,
+    enum_ops_inspect_p_p_s                 =  616,
+    enum_ops_inspect_p_pc_s                =  617,
+    enum_ops_inspect_p_p_sc                =  618,
+    enum_ops_inspect_p_pc_sc               =  619,
+    enum_ops_new_p_s                       =  620,
+    enum_ops_new_p_sc                      =  621,
+    enum_ops_new_p_s_p                     =  622,
+    enum_ops_new_p_sc_p                    =  623,
+    enum_ops_new_p_s_pc                    =  624,
+    enum_ops_new_p_sc_pc                   =  625,
+    enum_ops_new_p_p                       =  626,
+    enum_ops_new_p_pc                      =  627,
+    enum_ops_new_p_p_p                     =  628,
+    enum_ops_new_p_pc_p                    =  629,
+    enum_ops_new_p_p_pc                    =  630,
+    enum_ops_new_p_pc_pc                   =  631,
+    enum_ops_root_new_p_p                  =  632,
+    enum_ops_root_new_p_pc                 =  633,
+    enum_ops_root_new_p_p_p                =  634,
+    enum_ops_root_new_p_pc_p               =  635,
+    enum_ops_root_new_p_p_pc               =  636,
+    enum_ops_root_new_p_pc_pc              =  637,
+    enum_ops_typeof_s_p                    =  638,
+    enum_ops_typeof_p_p                    =  639,
+    enum_ops_get_repr_s_p                  =  640,
+    enum_ops_find_method_p_p_s             =  641,
+    enum_ops_find_method_p_p_sc            =  642,
+    enum_ops_defined_i_p                   =  643,
+    enum_ops_defined_i_p_ki                =  644,
+    enum_ops_defined_i_p_kic               =  645,
+    enum_ops_defined_i_p_k                 =  646,
+    enum_ops_defined_i_p_kc                =  647,
+    enum_ops_exists_i_p_ki                 =  648,
+    enum_ops_exists_i_p_kic                =  649,
+    enum_ops_exists_i_p_k                  =  650,
+    enum_ops_exists_i_p_kc                 =  651,
+    enum_ops_delete_p_k                    =  652,
+    enum_ops_delete_p_kc                   =  653,
+    enum_ops_delete_p_ki                   =  654,
+    enum_ops_delete_p_kic                  =  655,
+    enum_ops_elements_i_p                  =  656,
+    enum_ops_push_p_i                      =  657,
+    enum_ops_push_p_ic                     =  658,
+    enum_ops_push_p_n                      =  659,
+    enum_ops_push_p_nc                     =  660,
+    enum_ops_push_p_s                      =  661,
+    enum_ops_push_p_sc                     =  662,
+    enum_ops_push_p_p                      =  663,
+    enum_ops_pop_i_p                       =  664,
+    enum_ops_pop_n_p                       =  665,
+    enum_ops_pop_s_p                       =  666,
+    enum_ops_pop_p_p                       =  667,
+    enum_ops_unshift_p_i                   =  668,
+    enum_ops_unshift_p_ic                  =  669,
+    enum_ops_unshift_p_n                   =  670,
+    enum_ops_unshift_p_nc                  =  671,
+    enum_ops_unshift_p_s                   =  672,
+    enum_ops_unshift_p_sc                  =  673,
+    enum_ops_unshift_p_p                   =  674,
+    enum_ops_shift_i_p                     =  675,
+    enum_ops_shift_n_p                     =  676,
+    enum_ops_shift_s_p                     =  677,
+    enum_ops_shift_p_p                     =  678,
+    enum_ops_splice_p_p_i_i                =  679,
+    enum_ops_splice_p_p_ic_i               =  680,
+    enum_ops_splice_p_p_i_ic               =  681,
+    enum_ops_splice_p_p_ic_ic              =  682,
+    enum_ops_setprop_p_s_p                 =  683,
+    enum_ops_setprop_p_sc_p                =  684,
+    enum_ops_getprop_p_s_p                 =  685,
+    enum_ops_getprop_p_sc_p                =  686,
+    enum_ops_getprop_p_p_s                 =  687,
+    enum_ops_getprop_p_p_sc                =  688,
+    enum_ops_delprop_p_s                   =  689,
+    enum_ops_delprop_p_sc                  =  690,
+    enum_ops_prophash_p_p                  =  691,
+    enum_ops_freeze_s_p                    =  692,
+    enum_ops_thaw_p_s                      =  693,
+    enum_ops_thaw_p_sc                     =  694,
+    enum_ops_add_multi_s_s_p               =  695,
+    enum_ops_add_multi_sc_s_p              =  696,
+    enum_ops_add_multi_s_sc_p              =  697,
+    enum_ops_add_multi_sc_sc_p             =  698,
+    enum_ops_find_multi_p_s_s              =  699,
+    enum_ops_find_multi_p_sc_s             =  700,
+    enum_ops_find_multi_p_s_sc             =  701,
+    enum_ops_find_multi_p_sc_sc            =  702,
+    enum_ops_register_p                    =  703,
+    enum_ops_unregister_p                  =  704,
+    enum_ops_box_p_i                       =  705,
+    enum_ops_box_p_ic                      =  706,
+    enum_ops_box_p_n                       =  707,
+    enum_ops_box_p_nc                      =  708,
+    enum_ops_box_p_s                       =  709,
+    enum_ops_box_p_sc                      =  710,
+    enum_ops_iter_p_p                      =  711,
+    enum_ops_morph_p_p                     =  712,
+    enum_ops_morph_p_pc                    =  713,
+    enum_ops_clone_s_s                     =  714,
+    enum_ops_clone_s_sc                    =  715,
+    enum_ops_set_i_i                       =  716,
+    enum_ops_set_i_ic                      =  717,
+    enum_ops_set_i_n                       =  718,
+    enum_ops_set_i_nc                      =  719,
+    enum_ops_set_i_s                       =  720,
+    enum_ops_set_i_sc                      =  721,
+    enum_ops_set_n_n                       =  722,
+    enum_ops_set_n_nc                      =  723,
+    enum_ops_set_n_i                       =  724,
+    enum_ops_set_n_ic                      =  725,
+    enum_ops_set_n_s                       =  726,
+    enum_ops_set_n_sc                      =  727,
+    enum_ops_set_n_p                       =  728,
+    enum_ops_set_s_p                       =  729,
+    enum_ops_set_s_s                       =  730,
+    enum_ops_set_s_sc                      =  731,
+    enum_ops_set_s_i                       =  732,
+    enum_ops_set_s_ic                      =  733,
+    enum_ops_set_s_n                       =  734,
+    enum_ops_set_s_nc                      =  735,
+    enum_ops_set_p_pc                      =  736,
+    enum_ops_set_p_p                       =  737,
+    enum_ops_set_p_i                       =  738,
+    enum_ops_set_p_ic                      =  739,
+    enum_ops_set_p_n                       =  740,
+    enum_ops_set_p_nc                      =  741,
+    enum_ops_set_p_s                       =  742,
+    enum_ops_set_p_sc                      =  743,
+    enum_ops_set_i_p                       =  744,
+    enum_ops_assign_p_p                    =  745,
+    enum_ops_assign_p_i                    =  746,
+    enum_ops_assign_p_ic                   =  747,
+    enum_ops_assign_p_n                    =  748,
+    enum_ops_assign_p_nc                   =  749,
+    enum_ops_assign_p_s                    =  750,
+    enum_ops_assign_p_sc                   =  751,
+    enum_ops_assign_s_s                    =  752,
+    enum_ops_assign_s_sc                   =  753,
+    enum_ops_setref_p_p                    =  754,
+    enum_ops_deref_p_p                     =  755,
+    enum_ops_set_p_ki_i                    =  756,
+    enum_ops_set_p_kic_i                   =  757,
+    enum_ops_set_p_ki_ic                   =  758,
+    enum_ops_set_p_kic_ic                  =  759,
+    enum_ops_set_p_ki_n                    =  760,
+    enum_ops_set_p_kic_n                   =  761,
+    enum_ops_set_p_ki_nc                   =  762,
+    enum_ops_set_p_kic_nc                  =  763,
+    enum_ops_set_p_ki_s                    =  764,
+    enum_ops_set_p_kic_s                   =  765,
+    enum_ops_set_p_ki_sc                   =  766,
+    enum_ops_set_p_kic_sc                  =  767,
+    enum_ops_set_p_ki_p                    =  768,
+    enum_ops_set_p_kic_p                   =  769,
+    enum_ops_set_i_p_ki                    =  770,
+    enum_ops_set_i_p_kic                   =  771,
+    enum_ops_set_n_p_ki                    =  772,
+    enum_ops_set_n_p_kic                   =  773,
+    enum_ops_set_s_p_ki                    =  774,
+    enum_ops_set_s_p_kic                   =  775,
+    enum_ops_set_p_p_ki                    =  776,
+    enum_ops_set_p_p_kic                   =  777,
+    enum_ops_set_p_k_i                     =  778,
+    enum_ops_set_p_kc_i                    =  779,
+    enum_ops_set_p_k_ic                    =  780,
+    enum_ops_set_p_kc_ic                   =  781,
+    enum_ops_set_p_k_n                     =  782,
+    enum_ops_set_p_kc_n                    =  783,
+    enum_ops_set_p_k_nc                    =  784,
+    enum_ops_set_p_kc_nc                   =  785,
+    enum_ops_set_p_k_s                     =  786,
+    enum_ops_set_p_kc_s                    =  787,
+    enum_ops_set_p_k_sc                    =  788,
+    enum_ops_set_p_kc_sc                   =  789,
+    enum_ops_set_p_k_p                     =  790,
+    enum_ops_set_p_kc_p                    =  791,
+    enum_ops_set_i_p_k                     =  792,
+    enum_ops_set_i_p_kc                    =  793,
+    enum_ops_set_n_p_k                     =  794,
+    enum_ops_set_n_p_kc                    =  795,
+    enum_ops_set_s_p_k                     =  796,
+    enum_ops_set_s_p_kc                    =  797,
+    enum_ops_set_p_p_k                     =  798,
+    enum_ops_set_p_p_kc                    =  799,
+    enum_ops_clone_p_p                     =  800,
+    enum_ops_clone_p_p_p                   =  801,
+    enum_ops_clone_p_p_pc                  =  802,
+    enum_ops_copy_p_p                      =  803,
+    enum_ops_null_s                        =  804,
+    enum_ops_null_i                        =  805,
+    enum_ops_null_p                        =  806,
+    enum_ops_null_n                        =  807,
+    enum_ops_ord_i_s                       =  808,
+    enum_ops_ord_i_sc                      =  809,
+    enum_ops_ord_i_s_i                     =  810,
+    enum_ops_ord_i_sc_i                    =  811,
+    enum_ops_ord_i_s_ic                    =  812,
+    enum_ops_ord_i_sc_ic                   =  813,
+    enum_ops_chr_s_i                       =  814,
+    enum_ops_chr_s_ic                      =  815,
+    enum_ops_chopn_s_s_i                   =  816,
+    enum_ops_chopn_s_sc_i                  =  817,
+    enum_ops_chopn_s_s_ic                  =  818,
+    enum_ops_chopn_s_sc_ic                 =  819,
+    enum_ops_concat_p_p                    =  820,
+    enum_ops_concat_p_s                    =  821,
+    enum_ops_concat_p_sc                   =  822,
+    enum_ops_concat_s_s_s                  =  823,
+    enum_ops_concat_s_sc_s                 =  824,
+    enum_ops_concat_s_s_sc                 =  825,
+    enum_ops_concat_p_p_s                  =  826,
+    enum_ops_concat_p_p_sc                 =  827,
+    enum_ops_concat_p_p_p                  =  828,
+    enum_ops_repeat_s_s_i                  =  829,
+    enum_ops_repeat_s_sc_i                 =  830,
+    enum_ops_repeat_s_s_ic                 =  831,
+    enum_ops_repeat_s_sc_ic                =  832,
+    enum_ops_repeat_p_p_i                  =  833,
+    enum_ops_repeat_p_p_ic                 =  834,
+    enum_ops_repeat_p_p_p                  =  835,
+    enum_ops_repeat_p_i                    =  836,
+    enum_ops_repeat_p_ic                   =  837,
+    enum_ops_repeat_p_p                    =  838,
+    enum_ops_length_i_s                    =  839,
+    enum_ops_length_i_sc                   =  840,
+    enum_ops_bytelength_i_s                =  841,
+    enum_ops_bytelength_i_sc               =  842,
+    enum_ops_pin_s                         =  843,
+    enum_ops_unpin_s                       =  844,
+    enum_ops_substr_s_s_i                  =  845,
+    enum_ops_substr_s_sc_i                 =  846,
+    enum_ops_substr_s_s_ic                 =  847,
+    enum_ops_substr_s_sc_ic                =  848,
+    enum_ops_substr_s_s_i_i                =  849,
+    enum_ops_substr_s_sc_i_i               =  850,
+    enum_ops_substr_s_s_ic_i               =  851,
+    enum_ops_substr_s_sc_ic_i              =  852,
+    enum_ops_substr_s_s_i_ic               =  853,
+    enum_ops_substr_s_sc_i_ic              =  854,
+    enum_ops_substr_s_s_ic_ic              =  855,
+    enum_ops_substr_s_sc_ic_ic             =  856,
+    enum_ops_substr_s_p_i_i                =  857,
+    enum_ops_substr_s_p_ic_i               =  858,
+    enum_ops_substr_s_p_i_ic               =  859,
+    enum_ops_substr_s_p_ic_ic              =  860,
+    enum_ops_replace_s_s_i_i_s             =  861,
+    enum_ops_replace_s_sc_i_i_s            =  862,
+    enum_ops_replace_s_s_ic_i_s            =  863,
+    enum_ops_replace_s_sc_ic_i_s           =  864,
+    enum_ops_replace_s_s_i_ic_s            =  865,
+    enum_ops_replace_s_sc_i_ic_s           =  866,
+    enum_ops_replace_s_s_ic_ic_s           =  867,
+    enum_ops_replace_s_sc_ic_ic_s          =  868,
+    enum_ops_replace_s_s_i_i_sc            =  869,
+    enum_ops_replace_s_sc_i_i_sc           =  870,
+    enum_ops_replace_s_s_ic_i_sc           =  871,
+    enum_ops_replace_s_sc_ic_i_sc          =  872,
+    enum_ops_replace_s_s_i_ic_sc           =  873,
+    enum_ops_replace_s_sc_i_ic_sc          =  874,
+    enum_ops_replace_s_s_ic_ic_sc          =  875,
+    enum_ops_replace_s_sc_ic_ic_sc         =  876,
+    enum_ops_index_i_s_s                   =  877,
+    enum_ops_index_i_sc_s                  =  878,
+    enum_ops_index_i_s_sc                  =  879,
+    enum_ops_index_i_sc_sc                 =  880,
+    enum_ops_index_i_s_s_i                 =  881,
+    enum_ops_index_i_sc_s_i                =  882,
+    enum_ops_index_i_s_sc_i                =  883,
+    enum_ops_index_i_sc_sc_i               =  884,
+    enum_ops_index_i_s_s_ic                =  885,
+    enum_ops_index_i_sc_s_ic               =  886,
+    enum_ops_index_i_s_sc_ic               =  887,
+    enum_ops_index_i_sc_sc_ic              =  888,
+    enum_ops_rindex_i_s_s                  =  889,
+    enum_ops_rindex_i_sc_s                 =  890,
+    enum_ops_rindex_i_s_sc                 =  891,
+    enum_ops_rindex_i_sc_sc                =  892,
+    enum_ops_rindex_i_s_s_i                =  893,
+    enum_ops_rindex_i_sc_s_i               =  894,
+    enum_ops_rindex_i_s_sc_i               =  895,
+    enum_ops_rindex_i_sc_sc_i              =  896,
+    enum_ops_rindex_i_s_s_ic               =  897,
+    enum_ops_rindex_i_sc_s_ic              =  898,
+    enum_ops_rindex_i_s_sc_ic              =  899,
+    enum_ops_rindex_i_sc_sc_ic             =  900,
+    enum_ops_sprintf_s_s_p                 =  901,
+    enum_ops_sprintf_s_sc_p                =  902,
+    enum_ops_sprintf_p_p_p                 =  903,
+    enum_ops_new_s                         =  904,
+    enum_ops_stringinfo_i_s_i              =  905,
+    enum_ops_stringinfo_i_sc_i             =  906,
+    enum_ops_stringinfo_i_s_ic             =  907,
+    enum_ops_stringinfo_i_sc_ic            =  908,
+    enum_ops_upcase_s_s                    =  909,
+    enum_ops_upcase_s_sc                   =  910,
+    enum_ops_downcase_s_s                  =  911,
+    enum_ops_downcase_s_sc                 =  912,
+    enum_ops_titlecase_s_s                 =  913,
+    enum_ops_titlecase_s_sc                =  914,
+    enum_ops_join_s_s_p                    =  915,
+    enum_ops_join_s_sc_p                   =  916,
+    enum_ops_split_p_s_s                   =  917,
+    enum_ops_split_p_sc_s                  =  918,
+    enum_ops_split_p_s_sc                  =  919,
+    enum_ops_split_p_sc_sc                 =  920,
+    enum_ops_encoding_i_s                  =  921,
+    enum_ops_encoding_i_sc                 =  922,
+    enum_ops_encodingname_s_i              =  923,
+    enum_ops_encodingname_s_ic             =  924,
+    enum_ops_find_encoding_i_s             =  925,
+    enum_ops_find_encoding_i_sc            =  926,
+    enum_ops_trans_encoding_s_s_i          =  927,
+    enum_ops_trans_encoding_s_sc_i         =  928,
+    enum_ops_trans_encoding_s_s_ic         =  929,
+    enum_ops_trans_encoding_s_sc_ic        =  930,
+    enum_ops_is_cclass_i_i_s_i             =  931,
+    enum_ops_is_cclass_i_ic_s_i            =  932,
+    enum_ops_is_cclass_i_i_sc_i            =  933,
+    enum_ops_is_cclass_i_ic_sc_i           =  934,
+    enum_ops_is_cclass_i_i_s_ic            =  935,
+    enum_ops_is_cclass_i_ic_s_ic           =  936,
+    enum_ops_is_cclass_i_i_sc_ic           =  937,
+    enum_ops_is_cclass_i_ic_sc_ic          =  938,
+    enum_ops_find_cclass_i_i_s_i_i         =  939,
+    enum_ops_find_cclass_i_ic_s_i_i        =  940,
+    enum_ops_find_cclass_i_i_sc_i_i        =  941,
+    enum_ops_find_cclass_i_ic_sc_i_i       =  942,
+    enum_ops_find_cclass_i_i_s_ic_i        =  943,
+    enum_ops_find_cclass_i_ic_s_ic_i       =  944,
+    enum_ops_find_cclass_i_i_sc_ic_i       =  945,
+    enum_ops_find_cclass_i_ic_sc_ic_i      =  946,
+    enum_ops_find_cclass_i_i_s_i_ic        =  947,
+    enum_ops_find_cclass_i_ic_s_i_ic       =  948,
+    enum_ops_find_cclass_i_i_sc_i_ic       =  949,
+    enum_ops_find_cclass_i_ic_sc_i_ic      =  950,
+    enum_ops_find_cclass_i_i_s_ic_ic       =  951,
+    enum_ops_find_cclass_i_ic_s_ic_ic      =  952,
+    enum_ops_find_cclass_i_i_sc_ic_ic      =  953,
+    enum_ops_find_cclass_i_ic_sc_ic_ic     =  954,
+    enum_ops_find_not_cclass_i_i_s_i_i     =  955,
+    enum_ops_find_not_cclass_i_ic_s_i_i    =  956,
+    enum_ops_find_not_cclass_i_i_sc_i_i    =  957,
+    enum_ops_find_not_cclass_i_ic_sc_i_i   =  958,
+    enum_ops_find_not_cclass_i_i_s_ic_i    =  959,
+    enum_ops_find_not_cclass_i_ic_s_ic_i   =  960,
+    enum_ops_find_not_cclass_i_i_sc_ic_i   =  961,
+    enum_ops_find_not_cclass_i_ic_sc_ic_i  =  962,
+    enum_ops_find_not_cclass_i_i_s_i_ic    =  963,
+    enum_ops_find_not_cclass_i_ic_s_i_ic   =  964,
+    enum_ops_find_not_cclass_i_i_sc_i_ic   =  965,
+    enum_ops_find_not_cclass_i_ic_sc_i_ic  =  966,
+    enum_ops_find_not_cclass_i_i_s_ic_ic   =  967,
+    enum_ops_find_not_cclass_i_ic_s_ic_ic  =  968,
+    enum_ops_find_not_cclass_i_i_sc_ic_ic  =  969,
+    enum_ops_find_not_cclass_i_ic_sc_ic_ic =  970,
+    enum_ops_escape_s_s                    =  971,
+    enum_ops_compose_s_s                   =  972,
+    enum_ops_compose_s_sc                  =  973,
+    enum_ops_find_codepoint_i_s            =  974,
+    enum_ops_find_codepoint_i_sc           =  975,
+    enum_ops_spawnw_i_s                    =  976,
+    enum_ops_spawnw_i_sc                   =  977,
+    enum_ops_spawnw_i_p                    =  978,
+    enum_ops_err_i                         =  979,
+    enum_ops_err_s                         =  980,
+    enum_ops_err_s_i                       =  981,
+    enum_ops_err_s_ic                      =  982,
+    enum_ops_time_i                        =  983,
+    enum_ops_time_n                        =  984,
+    enum_ops_sleep_i                       =  985,
+    enum_ops_sleep_ic                      =  986,
+    enum_ops_sleep_n                       =  987,
+    enum_ops_sleep_nc                      =  988,
+    enum_ops_store_lex_s_p                 =  989,
+    enum_ops_store_lex_sc_p                =  990,
+    enum_ops_store_lex_s_s                 =  991,
+    enum_ops_store_lex_sc_s                =  992,
+    enum_ops_store_lex_s_sc                =  993,
+    enum_ops_store_lex_sc_sc               =  994,
+    enum_ops_store_lex_s_i                 =  995,
+    enum_ops_store_lex_sc_i                =  996,
+    enum_ops_store_lex_s_ic                =  997,
+    enum_ops_store_lex_sc_ic               =  998,
+    enum_ops_store_lex_s_n                 =  999,
+    enum_ops_store_lex_sc_n                = 1000,
+    enum_ops_store_lex_s_nc                = 1001,
+    enum_ops_store_lex_sc_nc               = 1002,
+    enum_ops_store_dynamic_lex_s_p         = 1003,
+    enum_ops_store_dynamic_lex_sc_p        = 1004,
+    enum_ops_find_lex_p_s                  = 1005,
+    enum_ops_find_lex_p_sc                 = 1006,
+    enum_ops_find_lex_s_s                  = 1007,
+    enum_ops_find_lex_s_sc                 = 1008,
+    enum_ops_find_lex_i_s                  = 1009,
+    enum_ops_find_lex_i_sc                 = 1010,
+    enum_ops_find_lex_n_s                  = 1011,
+    enum_ops_find_lex_n_sc                 = 1012,
+    enum_ops_find_dynamic_lex_p_s          = 1013,
+    enum_ops_find_dynamic_lex_p_sc         = 1014,
+    enum_ops_find_caller_lex_p_s           = 1015,
+    enum_ops_find_caller_lex_p_sc          = 1016,
+    enum_ops_get_namespace_p               = 1017,
+    enum_ops_get_namespace_p_p             = 1018,
+    enum_ops_get_namespace_p_pc            = 1019,
+    enum_ops_get_hll_namespace_p           = 1020,
+    enum_ops_get_hll_namespace_p_p         = 1021,
+    enum_ops_get_hll_namespace_p_pc        = 1022,
+    enum_ops_get_root_namespace_p          = 1023,
+    enum_ops_get_root_namespace_p_p        = 1024,
+    enum_ops_get_root_namespace_p_pc       = 1025,
+    enum_ops_get_global_p_s                = 1026,
+    enum_ops_get_global_p_sc               = 1027,
+    enum_ops_get_global_p_p_s              = 1028,
+    enum_ops_get_global_p_pc_s             = 1029,
+    enum_ops_get_global_p_p_sc             = 1030,
+    enum_ops_get_global_p_pc_sc            = 1031,
+    enum_ops_get_hll_global_p_s            = 1032,
+    enum_ops_get_hll_global_p_sc           = 1033,
+    enum_ops_get_hll_global_p_p_s          = 1034,
+    enum_ops_get_hll_global_p_pc_s         = 1035,
+    enum_ops_get_hll_global_p_p_sc         = 1036,
+    enum_ops_get_hll_global_p_pc_sc        = 1037,
+    enum_ops_get_root_global_p_s           = 1038,
+    enum_ops_get_root_global_p_sc          = 1039,
+    enum_ops_get_root_global_p_p_s         = 1040,
+    enum_ops_get_root_global_p_pc_s        = 1041,
+    enum_ops_get_root_global_p_p_sc        = 1042,
+    enum_ops_get_root_global_p_pc_sc       = 1043,
+    enum_ops_set_global_s_p                = 1044,
+    enum_ops_set_global_sc_p               = 1045,
+    enum_ops_set_global_p_s_p              = 1046,
+    enum_ops_set_global_pc_s_p             = 1047,
+    enum_ops_set_global_p_sc_p             = 1048,
+    enum_ops_set_global_pc_sc_p            = 1049,
+    enum_ops_set_hll_global_s_p            = 1050,
+    enum_ops_set_hll_global_sc_p           = 1051,
+    enum_ops_set_hll_global_p_s_p          = 1052,
+    enum_ops_set_hll_global_pc_s_p         = 1053,
+    enum_ops_set_hll_global_p_sc_p         = 1054,
+    enum_ops_set_hll_global_pc_sc_p        = 1055,
+    enum_ops_set_root_global_s_p           = 1056,
+    enum_ops_set_root_global_sc_p          = 1057,
+    enum_ops_set_root_global_p_s_p         = 1058,
+    enum_ops_set_root_global_pc_s_p        = 1059,
+    enum_ops_set_root_global_p_sc_p        = 1060,
+    enum_ops_set_root_global_pc_sc_p       = 1061,
+    enum_ops_find_name_p_s                 = 1062,
+    enum_ops_find_name_p_sc                = 1063,
+    enum_ops_find_sub_not_null_p_s         = 1064,
+    enum_ops_find_sub_not_null_p_sc        = 1065,
+    enum_ops_trap                          = 1066,
+    enum_ops_set_label_p_ic                = 1067,
+    enum_ops_get_label_i_p                 = 1068,
+    enum_ops_get_id_i_p                    = 1069,
+    enum_ops_get_id_i_pc                   = 1070,
+    enum_ops_fetch_p_p_p_p                 = 1071,
+    enum_ops_fetch_p_pc_p_p                = 1072,
+    enum_ops_fetch_p_p_pc_p                = 1073,
+    enum_ops_fetch_p_pc_pc_p               = 1074,
+    enum_ops_fetch_p_p_p_pc                = 1075,
+    enum_ops_fetch_p_pc_p_pc               = 1076,
+    enum_ops_fetch_p_p_pc_pc               = 1077,
+    enum_ops_fetch_p_pc_pc_pc              = 1078,
+    enum_ops_fetch_p_p_i_p                 = 1079,
+    enum_ops_fetch_p_pc_i_p                = 1080,
+    enum_ops_fetch_p_p_ic_p                = 1081,
+    enum_ops_fetch_p_pc_ic_p               = 1082,
+    enum_ops_fetch_p_p_i_pc                = 1083,
+    enum_ops_fetch_p_pc_i_pc               = 1084,
+    enum_ops_fetch_p_p_ic_pc               = 1085,
+    enum_ops_fetch_p_pc_ic_pc              = 1086,
+    enum_ops_fetch_p_p_s_p                 = 1087,
+    enum_ops_fetch_p_pc_s_p                = 1088,
+    enum_ops_fetch_p_p_sc_p                = 1089,
+    enum_ops_fetch_p_pc_sc_p               = 1090,
+    enum_ops_fetch_p_p_s_pc                = 1091,
+    enum_ops_fetch_p_pc_s_pc               = 1092,
+    enum_ops_fetch_p_p_sc_pc               = 1093,
+    enum_ops_fetch_p_pc_sc_pc              = 1094,
+    enum_ops_vivify_p_p_p_p                = 1095,
+    enum_ops_vivify_p_pc_p_p               = 1096,
+    enum_ops_vivify_p_p_pc_p               = 1097,
+    enum_ops_vivify_p_pc_pc_p              = 1098,
+    enum_ops_vivify_p_p_p_pc               = 1099,
+    enum_ops_vivify_p_pc_p_pc              = 1100,
+    enum_ops_vivify_p_p_pc_pc              = 1101,
+    enum_ops_vivify_p_pc_pc_pc             = 1102,
+    enum_ops_vivify_p_p_i_p                = 1103,
+    enum_ops_vivify_p_pc_i_p               = 1104,
+    enum_ops_vivify_p_p_ic_p               = 1105,
+    enum_ops_vivify_p_pc_ic_p              = 1106,
+    enum_ops_vivify_p_p_i_pc               = 1107,
+    enum_ops_vivify_p_pc_i_pc              = 1108,
+    enum_ops_vivify_p_p_ic_pc              = 1109,
+    enum_ops_vivify_p_pc_ic_pc             = 1110,
+    enum_ops_vivify_p_p_s_p                = 1111,
+    enum_ops_vivify_p_pc_s_p               = 1112,
+    enum_ops_vivify_p_p_sc_p               = 1113,
+    enum_ops_vivify_p_pc_sc_p              = 1114,
+    enum_ops_vivify_p_p_s_pc               = 1115,
+    enum_ops_vivify_p_pc_s_pc              = 1116,
+    enum_ops_vivify_p_p_sc_pc              = 1117,
+    enum_ops_vivify_p_pc_sc_pc             = 1118,
+    enum_ops_new_p_s_i                     = 1119,
+    enum_ops_new_p_sc_i                    = 1120,
+    enum_ops_new_p_s_ic                    = 1121,
+    enum_ops_new_p_sc_ic                   = 1122,
+    enum_ops_new_p_p_i                     = 1123,
+    enum_ops_new_p_pc_i                    = 1124,
+    enum_ops_new_p_p_ic                    = 1125,
+    enum_ops_new_p_pc_ic                   = 1126,
+    enum_ops_root_new_p_p_i                = 1127,
+    enum_ops_root_new_p_pc_i               = 1128,
+    enum_ops_root_new_p_p_ic               = 1129,
+    enum_ops_root_new_p_pc_ic              = 1130,
+    enum_ops_get_context_p                 = 1131,
+    enum_ops_new_call_context_p            = 1132,
+    enum_ops_invokecc_p_p                  = 1133,
+    enum_ops_flatten_array_into_p_p_i      = 1134,
+    enum_ops_flatten_array_into_p_p_ic     = 1135,
+    enum_ops_flatten_hash_into_p_p_i       = 1136,
+    enum_ops_flatten_hash_into_p_p_ic      = 1137,
+    enum_ops_slurp_array_from_p_p_i        = 1138,
+    enum_ops_slurp_array_from_p_p_ic       = 1139,
+    enum_ops_receive_p                     = 1140,
+    enum_ops_wait_p                        = 1141,
+    enum_ops_wait_pc                       = 1142,
+    enum_ops_pass                          = 1143,
+    enum_ops_disable_preemption            = 1144,
+    enum_ops_enable_preemption             = 1145,
+    enum_ops_green_threads_i               = 1146,
+    enum_ops_green_threads_ic              = 1147,
+    enum_ops_terminate                     = 1148,
+    enum_ops_intern_s_s                    = 1149,
+    enum_ops_intern_s_sc                   = 1150,
 };
 
 
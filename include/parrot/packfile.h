@@ -175,6 +175,13 @@ typedef struct PackFile_ConstTagPair {
     opcode_t const_idx;
 } PackFile_ConstTagPair;
 
+/* Attribute slot last found for a string constant, see src/oo.c */
+typedef struct PackFile_AttribCacheEntry {
+    UINTVAL shape;  /* shape of the class the slot belongs to, 0 if unused */
+    INTVAL  slot;   /* index into the object's attribute store */
+    INTVAL  kind;   /* slot kind, see ATTRIB_KIND in oo_private.h */
+} PackFile_AttribCacheEntry;
+
 typedef struct PackFile_ConstTable {
     PackFile_Segment           base;
     struct {
@@ -194,6 +201,8 @@ typedef struct PackFile_ConstTable {
     Hash                  *pmc_hash;    /* Hash for lookup of pmc indices */
     PackFile_ConstTagPair *tag_map;     /* n-m Mapping pmc constants to string tags */
     opcode_t               ntags;       /* Number of tags */
+    PackFile_AttribCacheEntry *attrib_cache; /* parallel to str.constants */
+    opcode_t               attrib_cache_size;
 } PackFile_ConstTable;
 
 typedef struct PackFile_ByteCode_OpMappingEntry {
@@ -208,6 +217,9 @@ typedef struct PackFile_ByteCode_OpMapping {
     PackFile_ByteCode_OpMappingEntry *libs;   /* opcode libraries used by this segment */
 } PackFile_ByteCode_OpMapping;
 
+/* native code compiled by the exec runcore, see src/runcore/exec.c */
+typedef struct Parrot_exec_code Parrot_exec_code;
+
 struct PackFile_ByteCode {
     PackFile_Segment              base;
     struct PackFile_Debug        *debugs;
@@ -221,6 +233,7 @@ struct PackFile_ByteCode {
     op_info_t                   **op_info_table;
     size_t                        n_libdeps;       /* number of library dependancies */
     STRING                      **libdeps;         /* names of prerequisite libraries */
+    Parrot_exec_code             *exec_code;       /* native code for the exec core */
 };
 
 typedef struct PackFile_DebugFilenameMapping {
@@ -233,6 +246,9 @@ typedef struct PackFile_Debug {
     opcode_t                num_mappings;
     PackFile_DebugFilenameMapping *mappings;
     PackFile_ByteCode      *code;   /* where this segment belongs to */
+    opcode_t               *op_offsets;     /* code offset of each op, built lazily */
+    size_t                  op_offsets_size; /* allocated entries, base.size when built */
+    size_t                  num_op_offsets; /* entries filled in so far */
 } PackFile_Debug;
 
 #define ANN_ENTRY_OFF 0
@@ -619,6 +635,15 @@ PackFile_ByteCode * Parrot_pf_create_default_segments(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+INTVAL Parrot_pf_debug_op_index(PARROT_INTERP,
+    ARGMOD(PackFile_Debug *debug),
+    opcode_t offset)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*debug);
+
 PARROT_EXPORT
 PARROT_CANNOT_RETURN_NULL
 PackFile * Parrot_pf_deserialize(PARROT_INTERP, ARGIN(STRING *str))
@@ -848,6 +873,9 @@ void Parrot_pf_mark_packfile(PARROT_INTERP, ARGMOD_NULLOK(PackFile * pf))
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pf_pmc) \
     , PARROT_ASSERT_ARG(file_name))
+#define ASSERT_ARGS_Parrot_pf_debug_op_index __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(debug))
 #define ASSERT_ARGS_Parrot_pf_deserialize __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(str))
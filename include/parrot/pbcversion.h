@@ -0,0 +1,25 @@
+/* ex: set ro:
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from 'PBC_COMPAT'
+ * by tools/build/pbcversion_h.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+#ifndef PARROT_PBCVERSION_H_GUARD
+#define PARROT_PBCVERSION_H_GUARD
+
+#define PARROT_PBC_MAJOR 13
+#define PARROT_PBC_MINOR 5
+
+#endif /* PARROT_PBCVERSION_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ *   buffer-read-only: t
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
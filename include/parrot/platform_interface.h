@@ -198,6 +198,9 @@ void Parrot_file_fstat(PARROT_INTERP, PIOHANDLE handle, ARGOUT(Parrot_Stat_Buf *
 PARROT_EXPORT
 INTVAL Parrot_file_stat_intval(PARROT_INTERP, ARGIN(STRING *path), INTVAL thing);
 
+PARROT_EXPORT
+INTVAL Parrot_file_modify_time(PARROT_INTERP, ARGIN(STRING *path));
+
 PARROT_EXPORT
 INTVAL Parrot_file_lstat_intval(PARROT_INTERP, ARGIN(STRING * path), INTVAL thing);
 
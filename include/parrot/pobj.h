@@ -31,7 +31,9 @@ typedef struct buffer_t {
 
 typedef enum Forward_flag {
     Buffer_moved_FLAG   = 1 << 0,
-    Buffer_shared_FLAG  = 1 << 1
+    Buffer_shared_FLAG  = 1 << 1,
+    /* Live size already counted by a compaction survey */
+    Buffer_counted_FLAG = 1 << 2
 } Forward_flags;
 
 /* Use these macros to access the two buffer header slots. */
@@ -56,8 +58,8 @@ typedef enum Forward_flag {
                                          +------------------------+
 
    The buffer prolog consists of possible padding and a pointer to the
-   Memory_Block containing the buffer. There are two flags in the low-order
-   bits of the pointer (see string.h). Padding is only required if the
+   Memory_Block containing the buffer. There are three flags in the low-order
+   bits of the pointer (see Forward_flags above). Padding is only required if the
    alignment of the data portion is higher than that of a pointer.
    This was not the case as of 8/2010.
 */
@@ -75,7 +77,7 @@ typedef enum Forward_flag {
 /* These macros give us the Memory_Block pointer and pointer-pointer,
    eliminating the flags. */
 
-#define Buffer_pool(b) ((Memory_Block *)( *(INTVAL*)(Buffer_bufprolog(b)) & ~3 ))
+#define Buffer_pool(b) ((Memory_Block *)( *(INTVAL*)(Buffer_bufprolog(b)) & ~7 ))
 #define Buffer_poolptr(b) ((Memory_Block **)Buffer_bufprolog(b))
 
 
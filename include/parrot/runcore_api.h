@@ -134,9 +134,6 @@ oplib_init_f get_core_op_lib_init(PARROT_INTERP,
 void Parrot_runcore_debugger_init(PARROT_INTERP)
         __attribute__nonnull__(1);
 
-void Parrot_runcore_exec_init(PARROT_INTERP)
-        __attribute__nonnull__(1);
-
 void Parrot_runcore_fast_init(PARROT_INTERP)
         __attribute__nonnull__(1);
 
@@ -150,8 +147,6 @@ void Parrot_runcore_slow_init(PARROT_INTERP)
        PARROT_ASSERT_ARG(runcore))
 #define ASSERT_ARGS_Parrot_runcore_debugger_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
-#define ASSERT_ARGS_Parrot_runcore_exec_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
-       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_runcore_fast_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_runcore_gc_debug_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -161,6 +156,62 @@ void Parrot_runcore_slow_init(PARROT_INTERP)
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: src/runcore/cores.c */
 
+/* HEADERIZER BEGIN: src/runcore/exec.c */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+void Parrot_runcore_exec_free_code(PARROT_INTERP,
+    ARGMOD(PackFile_ByteCode *cs))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*cs);
+
+void Parrot_runcore_exec_init(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+#define ASSERT_ARGS_Parrot_runcore_exec_free_code __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(cs))
+#define ASSERT_ARGS_Parrot_runcore_exec_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: src/runcore/exec.c */
+
+/* HEADERIZER BEGIN: src/runcore/sampler.c */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+PARROT_EXPORT
+void Parrot_runcore_sampler_sample(PARROT_INTERP, ARGIN(opcode_t *pc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_EXPORT
+void Parrot_runcore_sampler_start(PARROT_INTERP,
+    INTVAL frequency,
+    ARGIN(STRING *filename),
+    ARGIN_NULLOK(STRING *pprof_filename))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(3);
+
+PARROT_EXPORT
+void Parrot_runcore_sampler_stop(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+void Parrot_runcore_sampler_init(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+#define ASSERT_ARGS_Parrot_runcore_sampler_sample __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pc))
+#define ASSERT_ARGS_Parrot_runcore_sampler_start __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(filename))
+#define ASSERT_ARGS_Parrot_runcore_sampler_stop __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_runcore_sampler_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: src/runcore/sampler.c */
+
 #endif /* PARROT_RUNCORE_API_H_GUARD */
 
 
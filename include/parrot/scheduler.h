@@ -15,6 +15,14 @@
 
 #define PARROT_TASK_SWITCH_QUANTUM 0.02
 
+/* Branches a green thread may take before it is preempted */
+#define PARROT_TASK_SWITCH_TICKS 10000
+
+/* Does a taken conditional branch by OFFSET have to poll the green thread
+   quantum? Only backward branches do, so every loop can be preempted. */
+#define PARROT_CX_BRANCH_POLLS_QUANTUM(interp, offset) \
+    ((offset) <= 0 && (interp)->quantum_ticks)
+
 /* HEADERIZER BEGIN: src/scheduler.c */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
@@ -66,12 +74,26 @@ void Parrot_cx_send_message(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+PARROT_EXPORT
+void Parrot_cx_set_green_threads(PARROT_INTERP, INTVAL enable)
+        __attribute__nonnull__(1);
+
 PARROT_EXPORT
 PARROT_CANNOT_RETURN_NULL
 PMC* Parrot_cx_stop_task(PARROT_INTERP, ARGIN(opcode_t *next))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
+opcode_t* Parrot_cx_switch_task(PARROT_INTERP, ARGIN(PMC *scheduler))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+void Parrot_cx_activate_task(PARROT_INTERP, ARGIN(PMC *task))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 void Parrot_cx_check_quantum(PARROT_INTERP, ARGIN(PMC *scheduler))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
@@ -144,9 +166,17 @@ void Parrot_cx_set_scheduler_alarm(PARROT_INTERP)
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(messagetype) \
     , PARROT_ASSERT_ARG(payload_unused))
+#define ASSERT_ARGS_Parrot_cx_set_green_threads __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_cx_stop_task __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(next))
+#define ASSERT_ARGS_Parrot_cx_switch_task __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(scheduler))
+#define ASSERT_ARGS_Parrot_cx_activate_task __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(task))
 #define ASSERT_ARGS_Parrot_cx_check_quantum __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(scheduler))
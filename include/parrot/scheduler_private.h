@@ -19,7 +19,8 @@ typedef enum {
     SCHEDULER_wake_requested_FLAG    = PObj_private1_FLAG,
     SCHEDULER_enable_preemption_FLAG = PObj_private2_FLAG,
     SCHEDULER_in_handler_FLAG        = PObj_private3_FLAG,
-    SCHEDULER_enable_scheduler_FLAG  = PObj_private4_FLAG
+    SCHEDULER_enable_scheduler_FLAG  = PObj_private4_FLAG,
+    SCHEDULER_green_threads_FLAG     = PObj_private5_FLAG
 } scheduler_flags_enum;
 
 #define SCHEDULER_get_FLAGS(o) (PObj_get_FLAGS(o))
@@ -53,6 +54,11 @@ typedef enum {
 #define SCHEDULER_enable_scheduler_SET(o)   SCHEDULER_flag_SET(enable_scheduler, o)
 #define SCHEDULER_enable_scheduler_CLEAR(o) SCHEDULER_flag_CLEAR(enable_scheduler, o)
 
+/* Are tasks switched inside the current runloop instead of on other threads? */
+#define SCHEDULER_green_threads_TEST(o)  SCHEDULER_flag_TEST(green_threads, o)
+#define SCHEDULER_green_threads_SET(o)   SCHEDULER_flag_SET(green_threads, o)
+#define SCHEDULER_green_threads_CLEAR(o) SCHEDULER_flag_CLEAR(green_threads, o)
+
 /*
  * Task private flags
  *
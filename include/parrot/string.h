@@ -84,6 +84,20 @@
 
 typedef struct parrot_string_t STRING;
 
+/* Set on the STRING entered in the intern table for its contents */
+#define STRING_interned_SET(s)   PObj_flag_SET(private6, (s))
+#define STRING_interned_TEST(s)  PObj_flag_TEST(private6, (s))
+#define STRING_interned_CLEAR(s) PObj_flag_CLEAR(private6, (s))
+
+/* A slice of less than 1/STRING_SLICE_SHARE_RATIO of a buffer of at least
+ * STRING_SLICE_PIN_SIZE bytes gets a buffer of its own, rather than sharing
+ * the larger one and keeping it alive */
+#define STRING_SLICE_PIN_SIZE    1024
+#define STRING_SLICE_SHARE_RATIO 8
+#define STRING_slice_pins(bytes, buflen) \
+    ((buflen) >= STRING_SLICE_PIN_SIZE && \
+     (bytes) * STRING_SLICE_SHARE_RATIO < (buflen))
+
 /* String iterator */
 typedef struct string_iterator_t {
     UINTVAL bytepos;
@@ -249,6 +249,65 @@ void Parrot_thread_wait_for_notification(PARROT_INTERP)
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: src/thread.c */
 
+/* HEADERIZER BEGIN: src/parallel.c */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+PARROT_EXPORT
+void Parrot_parallel_each(PARROT_INTERP,
+    INTVAL type,
+    ARGIN_NULLOK(void *items),
+    INTVAL size,
+    ARGIN(PMC *sub))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(5);
+
+PARROT_EXPORT
+void Parrot_parallel_map(PARROT_INTERP,
+    INTVAL type,
+    ARGMOD_NULLOK(void *items),
+    INTVAL size,
+    ARGIN(PMC *sub))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(5)
+        FUNC_MODIFIES(*items);
+
+PARROT_EXPORT
+void Parrot_parallel_reduce(PARROT_INTERP,
+    INTVAL type,
+    ARGIN_NULLOK(void *items),
+    INTVAL size,
+    ARGIN(PMC *sub),
+    ARGMOD(void *acc),
+    INTVAL has_acc)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(5)
+        __attribute__nonnull__(6)
+        FUNC_MODIFIES(*acc);
+
+PARROT_EXPORT
+void Parrot_parallel_sort(PARROT_INTERP,
+    INTVAL type,
+    ARGMOD_NULLOK(void *items),
+    INTVAL size,
+    ARGIN_NULLOK(PMC *cmp))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*items);
+
+#define ASSERT_ARGS_Parrot_parallel_each __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(sub))
+#define ASSERT_ARGS_Parrot_parallel_map __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(sub))
+#define ASSERT_ARGS_Parrot_parallel_reduce __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(sub) \
+    , PARROT_ASSERT_ARG(acc))
+#define ASSERT_ARGS_Parrot_parallel_sort __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: src/parallel.c */
+
 #define Parrot_thread_maybe_create_proxy(i, thread, pmc) ( \
         (pmc)->vtable->base_type == enum_class_Proxy \
         ? (PARROT_PROXY(pmc)->interp == (thread) ? PARROT_PROXY(pmc)->target : (pmc)) \
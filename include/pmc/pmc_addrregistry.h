@@ -0,0 +1,91 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/addrregistry.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_ADDRREGISTRY_H_GUARD
+#define PARROT_PMC_ADDRREGISTRY_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_AddrRegistry_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_AddrRegistry_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_AddrRegistry_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_AddrRegistry_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_AddrRegistry_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_AddrRegistry_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* AddrRegistry PMC's underlying struct. */
+typedef struct Parrot_AddrRegistry_attributes {
+    Hash * pmc_registry;
+    Hash * str_registry;
+} Parrot_AddrRegistry_attributes;
+
+/* Macro to access underlying structure of a AddrRegistry PMC. */
+#define PARROT_ADDRREGISTRY(o) ((Parrot_AddrRegistry_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'pmc_registry' attribute of AddrRegistry PMC. */
+#define GETATTR_AddrRegistry_pmc_registry(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_AddrRegistry_attributes *)PMC_data(pmc))->pmc_registry; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'Hash *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_AddrRegistry_pmc_registry(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'Hash *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_AddrRegistry_attributes *)PMC_data(pmc))->pmc_registry = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'str_registry' attribute of AddrRegistry PMC. */
+#define GETATTR_AddrRegistry_str_registry(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_AddrRegistry_attributes *)PMC_data(pmc))->str_registry; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'Hash *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_AddrRegistry_str_registry(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'Hash *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_AddrRegistry_attributes *)PMC_data(pmc))->str_registry = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_ADDRREGISTRY_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
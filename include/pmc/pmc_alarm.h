@@ -0,0 +1,90 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/alarm.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_ALARM_H_GUARD
+#define PARROT_PMC_ALARM_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_Alarm_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_Alarm_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_Alarm_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_Alarm_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_Alarm_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_Alarm_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* Alarm PMC's underlying struct. */
+typedef struct Parrot_Alarm_attributes {
+    FLOATVAL alarm_time;
+    PMC     * alarm_task;
+} Parrot_Alarm_attributes;
+
+/* Macro to access underlying structure of a Alarm PMC. */
+#define PARROT_ALARM(o) ((Parrot_Alarm_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'alarm_time' attribute of Alarm PMC. */
+#define GETATTR_Alarm_alarm_time(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Alarm_attributes *)PMC_data(pmc))->alarm_time; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "alarm_time")); \
+            (dest) =  (PMC_IS_NULL(attr_value) ? (FLOATVAL) 0.0: VTABLE_get_number(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_Alarm_alarm_time(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new(interp, enum_class_Float); \
+            VTABLE_set_number_native(interp, attr_value, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "alarm_time"), attr_value); \
+        } \
+        else \
+            ((Parrot_Alarm_attributes *)PMC_data(pmc))->alarm_time = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'alarm_task' attribute of Alarm PMC. */
+#define GETATTR_Alarm_alarm_task(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Alarm_attributes *)PMC_data(pmc))->alarm_task; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "alarm_task")); \
+        } \
+    } while (0)
+#define SETATTR_Alarm_alarm_task(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "alarm_task"), value); \
+        } \
+        else \
+            ((Parrot_Alarm_attributes *)PMC_data(pmc))->alarm_task = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_ALARM_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
@@ -0,0 +1,66 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/bigint.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_BIGINT_H_GUARD
+#define PARROT_PMC_BIGINT_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_BigInt_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_BigInt_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_BigInt_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_BigInt_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_BigInt_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_BigInt_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* BigInt PMC's underlying struct. */
+typedef struct Parrot_BigInt_attributes {
+    struct BIGINT * bi;
+} Parrot_BigInt_attributes;
+
+/* Macro to access underlying structure of a BigInt PMC. */
+#define PARROT_BIGINT(o) ((Parrot_BigInt_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'bi' attribute of BigInt PMC. */
+#define GETATTR_BigInt_bi(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_BigInt_attributes *)PMC_data(pmc))->bi; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'struct BIGINT *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_BigInt_bi(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'struct BIGINT *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_BigInt_attributes *)PMC_data(pmc))->bi = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_BIGINT_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
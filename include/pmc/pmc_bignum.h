@@ -0,0 +1,66 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/bignum.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_BIGNUM_H_GUARD
+#define PARROT_PMC_BIGNUM_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_BigNum_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_BigNum_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_BigNum_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_BigNum_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_BigNum_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_BigNum_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* BigNum PMC's underlying struct. */
+typedef struct Parrot_BigNum_attributes {
+    struct BIGNUM * bn;
+} Parrot_BigNum_attributes;
+
+/* Macro to access underlying structure of a BigNum PMC. */
+#define PARROT_BIGNUM(o) ((Parrot_BigNum_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'bn' attribute of BigNum PMC. */
+#define GETATTR_BigNum_bn(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_BigNum_attributes *)PMC_data(pmc))->bn; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'struct BIGNUM *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_BigNum_bn(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'struct BIGNUM *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_BigNum_attributes *)PMC_data(pmc))->bn = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_BIGNUM_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
@@ -0,0 +1,142 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/bytebuffer.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_BYTEBUFFER_H_GUARD
+#define PARROT_PMC_BYTEBUFFER_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_ByteBuffer_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_ByteBuffer_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_ByteBuffer_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_ByteBuffer_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_ByteBuffer_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_ByteBuffer_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* ByteBuffer PMC's underlying struct. */
+typedef struct Parrot_ByteBuffer_attributes {
+    INTVAL allocated_size;
+    INTVAL size;
+    STRING * source;
+    unsigned char * content;
+} Parrot_ByteBuffer_attributes;
+
+/* Macro to access underlying structure of a ByteBuffer PMC. */
+#define PARROT_BYTEBUFFER(o) ((Parrot_ByteBuffer_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'allocated_size' attribute of ByteBuffer PMC. */
+#define GETATTR_ByteBuffer_allocated_size(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ByteBuffer_attributes *)PMC_data(pmc))->allocated_size; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "allocated_size")); \
+            (dest) = (PMC_IS_NULL(attr_value) ? (INTVAL) 0: VTABLE_get_integer(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_ByteBuffer_allocated_size(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new_init_int(interp, enum_class_Integer, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "allocated_size"), attr_value); \
+        } \
+        else \
+            ((Parrot_ByteBuffer_attributes *)PMC_data(pmc))->allocated_size = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'size' attribute of ByteBuffer PMC. */
+#define GETATTR_ByteBuffer_size(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ByteBuffer_attributes *)PMC_data(pmc))->size; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "size")); \
+            (dest) = (PMC_IS_NULL(attr_value) ? (INTVAL) 0: VTABLE_get_integer(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_ByteBuffer_size(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new_init_int(interp, enum_class_Integer, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "size"), attr_value); \
+        } \
+        else \
+            ((Parrot_ByteBuffer_attributes *)PMC_data(pmc))->size = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'source' attribute of ByteBuffer PMC. */
+#define GETATTR_ByteBuffer_source(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ByteBuffer_attributes *)PMC_data(pmc))->source; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "source")); \
+            (dest) =  (PMC_IS_NULL(attr_value) ? (STRING *)NULL : VTABLE_get_string(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_ByteBuffer_source(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new(interp, enum_class_String); \
+            VTABLE_set_string_native(interp, attr_value, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "source"), attr_value); \
+        } \
+        else \
+            ((Parrot_ByteBuffer_attributes *)PMC_data(pmc))->source = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'content' attribute of ByteBuffer PMC. */
+#define GETATTR_ByteBuffer_content(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ByteBuffer_attributes *)PMC_data(pmc))->content; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'unsigned char *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_ByteBuffer_content(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'unsigned char *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_ByteBuffer_attributes *)PMC_data(pmc))->content = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_BYTEBUFFER_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
@@ -0,0 +1,87 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/capture.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_CAPTURE_H_GUARD
+#define PARROT_PMC_CAPTURE_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_Capture_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_Capture_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_Capture_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_Capture_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_Capture_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_Capture_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* Capture PMC's underlying struct. */
+typedef struct Parrot_Capture_attributes {
+    PMC    * array;
+    PMC    * hash;
+} Parrot_Capture_attributes;
+
+/* Macro to access underlying structure of a Capture PMC. */
+#define PARROT_CAPTURE(o) ((Parrot_Capture_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'array' attribute of Capture PMC. */
+#define GETATTR_Capture_array(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Capture_attributes *)PMC_data(pmc))->array; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "array")); \
+        } \
+    } while (0)
+#define SETATTR_Capture_array(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "array"), value); \
+        } \
+        else \
+            ((Parrot_Capture_attributes *)PMC_data(pmc))->array = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'hash' attribute of Capture PMC. */
+#define GETATTR_Capture_hash(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Capture_attributes *)PMC_data(pmc))->hash; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "hash")); \
+        } \
+    } while (0)
+#define SETATTR_Capture_hash(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "hash"), value); \
+        } \
+        else \
+            ((Parrot_Capture_attributes *)PMC_data(pmc))->hash = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_CAPTURE_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
@@ -0,0 +1,66 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/channel.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_CHANNEL_H_GUARD
+#define PARROT_PMC_CHANNEL_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_Channel_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_Channel_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_Channel_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_Channel_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_Channel_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_Channel_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* Channel PMC's underlying struct. */
+typedef struct Parrot_Channel_attributes {
+    struct Parrot_Channel * queue;
+} Parrot_Channel_attributes;
+
+/* Macro to access underlying structure of a Channel PMC. */
+#define PARROT_CHANNEL(o) ((Parrot_Channel_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'queue' attribute of Channel PMC. */
+#define GETATTR_Channel_queue(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Channel_attributes *)PMC_data(pmc))->queue; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'struct Parrot_Channel *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_Channel_queue(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'struct Parrot_Channel *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_Channel_attributes *)PMC_data(pmc))->queue = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_CHANNEL_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
@@ -0,0 +1,93 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/complex.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_COMPLEX_H_GUARD
+#define PARROT_PMC_COMPLEX_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_Complex_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_Complex_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_Complex_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_Complex_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_Complex_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_Complex_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* Complex PMC's underlying struct. */
+typedef struct Parrot_Complex_attributes {
+    FLOATVAL re;
+    FLOATVAL im;
+} Parrot_Complex_attributes;
+
+/* Macro to access underlying structure of a Complex PMC. */
+#define PARROT_COMPLEX(o) ((Parrot_Complex_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 're' attribute of Complex PMC. */
+#define GETATTR_Complex_re(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Complex_attributes *)PMC_data(pmc))->re; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "re")); \
+            (dest) =  (PMC_IS_NULL(attr_value) ? (FLOATVAL) 0.0: VTABLE_get_number(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_Complex_re(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new(interp, enum_class_Float); \
+            VTABLE_set_number_native(interp, attr_value, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "re"), attr_value); \
+        } \
+        else \
+            ((Parrot_Complex_attributes *)PMC_data(pmc))->re = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'im' attribute of Complex PMC. */
+#define GETATTR_Complex_im(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Complex_attributes *)PMC_data(pmc))->im; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "im")); \
+            (dest) =  (PMC_IS_NULL(attr_value) ? (FLOATVAL) 0.0: VTABLE_get_number(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_Complex_im(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new(interp, enum_class_Float); \
+            VTABLE_set_number_native(interp, attr_value, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "im"), attr_value); \
+        } \
+        else \
+            ((Parrot_Complex_attributes *)PMC_data(pmc))->im = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_COMPLEX_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
@@ -0,0 +1,110 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/exporter.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_EXPORTER_H_GUARD
+#define PARROT_PMC_EXPORTER_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_Exporter_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_Exporter_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_Exporter_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_Exporter_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_Exporter_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_Exporter_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* Exporter PMC's underlying struct. */
+typedef struct Parrot_Exporter_attributes {
+    PMC * ns_src;
+    PMC * ns_dest;
+    PMC * globals;
+} Parrot_Exporter_attributes;
+
+/* Macro to access underlying structure of a Exporter PMC. */
+#define PARROT_EXPORTER(o) ((Parrot_Exporter_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'ns_src' attribute of Exporter PMC. */
+#define GETATTR_Exporter_ns_src(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Exporter_attributes *)PMC_data(pmc))->ns_src; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "ns_src")); \
+        } \
+    } while (0)
+#define SETATTR_Exporter_ns_src(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "ns_src"), value); \
+        } \
+        else \
+            ((Parrot_Exporter_attributes *)PMC_data(pmc))->ns_src = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'ns_dest' attribute of Exporter PMC. */
+#define GETATTR_Exporter_ns_dest(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Exporter_attributes *)PMC_data(pmc))->ns_dest; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "ns_dest")); \
+        } \
+    } while (0)
+#define SETATTR_Exporter_ns_dest(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "ns_dest"), value); \
+        } \
+        else \
+            ((Parrot_Exporter_attributes *)PMC_data(pmc))->ns_dest = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'globals' attribute of Exporter PMC. */
+#define GETATTR_Exporter_globals(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Exporter_attributes *)PMC_data(pmc))->globals; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "globals")); \
+        } \
+    } while (0)
+#define SETATTR_Exporter_globals(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "globals"), value); \
+        } \
+        else \
+            ((Parrot_Exporter_attributes *)PMC_data(pmc))->globals = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_EXPORTER_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
@@ -0,0 +1,91 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/fixedstringarray.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_FIXEDSTRINGARRAY_H_GUARD
+#define PARROT_PMC_FIXEDSTRINGARRAY_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_FixedStringArray_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_FixedStringArray_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_FixedStringArray_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_FixedStringArray_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_FixedStringArray_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_FixedStringArray_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* FixedStringArray PMC's underlying struct. */
+typedef struct Parrot_FixedStringArray_attributes {
+    STRING ** str_array;
+    UINTVAL size;
+} Parrot_FixedStringArray_attributes;
+
+/* Macro to access underlying structure of a FixedStringArray PMC. */
+#define PARROT_FIXEDSTRINGARRAY(o) ((Parrot_FixedStringArray_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'str_array' attribute of FixedStringArray PMC. */
+#define GETATTR_FixedStringArray_str_array(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_FixedStringArray_attributes *)PMC_data(pmc))->str_array; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'STRING **' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_FixedStringArray_str_array(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'STRING **' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_FixedStringArray_attributes *)PMC_data(pmc))->str_array = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'size' attribute of FixedStringArray PMC. */
+#define GETATTR_FixedStringArray_size(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_FixedStringArray_attributes *)PMC_data(pmc))->size; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'UINTVAL' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_FixedStringArray_size(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'UINTVAL' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_FixedStringArray_attributes *)PMC_data(pmc))->size = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_FIXEDSTRINGARRAY_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
@@ -0,0 +1,67 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/float.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_FLOAT_H_GUARD
+#define PARROT_PMC_FLOAT_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_Float_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_Float_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_Float_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_Float_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_Float_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_Float_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* Float PMC's underlying struct. */
+typedef struct Parrot_Float_attributes {
+    FLOATVAL fv;
+} Parrot_Float_attributes;
+
+/* Macro to access underlying structure of a Float PMC. */
+#define PARROT_FLOAT(o) ((Parrot_Float_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'fv' attribute of Float PMC. */
+#define GETATTR_Float_fv(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Float_attributes *)PMC_data(pmc))->fv; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "fv")); \
+            (dest) =  (PMC_IS_NULL(attr_value) ? (FLOATVAL) 0.0: VTABLE_get_number(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_Float_fv(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new(interp, enum_class_Float); \
+            VTABLE_set_number_native(interp, attr_value, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "fv"), attr_value); \
+        } \
+        else \
+            ((Parrot_Float_attributes *)PMC_data(pmc))->fv = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_FLOAT_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
@@ -0,0 +1,193 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/handle.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_HANDLE_H_GUARD
+#define PARROT_PMC_HANDLE_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_Handle_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_Handle_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_Handle_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_Handle_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_Handle_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_Handle_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* Handle PMC's underlying struct. */
+typedef struct Parrot_Handle_attributes {
+    PIOHANDLE os_handle;
+    STRING    * record_separator;
+    IO_VTABLE * io_vtable;
+    IO_BUFFER * read_buffer;
+    IO_BUFFER * write_buffer;
+    STRING * encoding;
+} Parrot_Handle_attributes;
+
+/* Macro to access underlying structure of a Handle PMC. */
+#define PARROT_HANDLE(o) ((Parrot_Handle_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'os_handle' attribute of Handle PMC. */
+#define GETATTR_Handle_os_handle(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Handle_attributes *)PMC_data(pmc))->os_handle; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'PIOHANDLE' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_Handle_os_handle(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'PIOHANDLE' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_Handle_attributes *)PMC_data(pmc))->os_handle = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'record_separator' attribute of Handle PMC. */
+#define GETATTR_Handle_record_separator(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Handle_attributes *)PMC_data(pmc))->record_separator; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "record_separator")); \
+            (dest) =  (PMC_IS_NULL(attr_value) ? (STRING *)NULL : VTABLE_get_string(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_Handle_record_separator(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new(interp, enum_class_String); \
+            VTABLE_set_string_native(interp, attr_value, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "record_separator"), attr_value); \
+        } \
+        else \
+            ((Parrot_Handle_attributes *)PMC_data(pmc))->record_separator = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'io_vtable' attribute of Handle PMC. */
+#define GETATTR_Handle_io_vtable(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Handle_attributes *)PMC_data(pmc))->io_vtable; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'IO_VTABLE *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_Handle_io_vtable(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'IO_VTABLE *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_Handle_attributes *)PMC_data(pmc))->io_vtable = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'read_buffer' attribute of Handle PMC. */
+#define GETATTR_Handle_read_buffer(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Handle_attributes *)PMC_data(pmc))->read_buffer; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'IO_BUFFER *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_Handle_read_buffer(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'IO_BUFFER *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_Handle_attributes *)PMC_data(pmc))->read_buffer = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'write_buffer' attribute of Handle PMC. */
+#define GETATTR_Handle_write_buffer(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Handle_attributes *)PMC_data(pmc))->write_buffer; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'IO_BUFFER *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_Handle_write_buffer(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'IO_BUFFER *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_Handle_attributes *)PMC_data(pmc))->write_buffer = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'encoding' attribute of Handle PMC. */
+#define GETATTR_Handle_encoding(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Handle_attributes *)PMC_data(pmc))->encoding; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "encoding")); \
+            (dest) =  (PMC_IS_NULL(attr_value) ? (STRING *)NULL : VTABLE_get_string(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_Handle_encoding(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new(interp, enum_class_String); \
+            VTABLE_set_string_native(interp, attr_value, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "encoding"), attr_value); \
+        } \
+        else \
+            ((Parrot_Handle_attributes *)PMC_data(pmc))->encoding = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_HANDLE_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
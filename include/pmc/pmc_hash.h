@@ -0,0 +1,66 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/hash.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_HASH_H_GUARD
+#define PARROT_PMC_HASH_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_Hash_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_Hash_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_Hash_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_Hash_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_Hash_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_Hash_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* Hash PMC's underlying struct. */
+typedef struct Parrot_Hash_attributes {
+    Hash * hash;
+} Parrot_Hash_attributes;
+
+/* Macro to access underlying structure of a Hash PMC. */
+#define PARROT_HASH(o) ((Parrot_Hash_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'hash' attribute of Hash PMC. */
+#define GETATTR_Hash_hash(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Hash_attributes *)PMC_data(pmc))->hash; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'Hash *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_Hash_hash(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'Hash *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_Hash_attributes *)PMC_data(pmc))->hash = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_HASH_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
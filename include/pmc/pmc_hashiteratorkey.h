@@ -0,0 +1,91 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/hashiteratorkey.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_HASHITERATORKEY_H_GUARD
+#define PARROT_PMC_HASHITERATORKEY_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_HashIteratorKey_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_HashIteratorKey_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_HashIteratorKey_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_HashIteratorKey_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_HashIteratorKey_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_HashIteratorKey_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* HashIteratorKey PMC's underlying struct. */
+typedef struct Parrot_HashIteratorKey_attributes {
+    Hash        * parrot_hash;
+    HashBucket  * bucket;
+} Parrot_HashIteratorKey_attributes;
+
+/* Macro to access underlying structure of a HashIteratorKey PMC. */
+#define PARROT_HASHITERATORKEY(o) ((Parrot_HashIteratorKey_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'parrot_hash' attribute of HashIteratorKey PMC. */
+#define GETATTR_HashIteratorKey_parrot_hash(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_HashIteratorKey_attributes *)PMC_data(pmc))->parrot_hash; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'Hash        *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_HashIteratorKey_parrot_hash(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'Hash        *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_HashIteratorKey_attributes *)PMC_data(pmc))->parrot_hash = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'bucket' attribute of HashIteratorKey PMC. */
+#define GETATTR_HashIteratorKey_bucket(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_HashIteratorKey_attributes *)PMC_data(pmc))->bucket; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'HashBucket  *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_HashIteratorKey_bucket(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'HashBucket  *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_HashIteratorKey_attributes *)PMC_data(pmc))->bucket = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_HASHITERATORKEY_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
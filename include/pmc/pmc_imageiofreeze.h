@@ -0,0 +1,310 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/imageiofreeze.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_IMAGEIOFREEZE_H_GUARD
+#define PARROT_PMC_IMAGEIOFREEZE_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_ImageIOFreeze_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_ImageIOFreeze_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_ImageIOFreeze_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_ImageIOFreeze_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_ImageIOFreeze_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_ImageIOFreeze_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* ImageIOFreeze PMC's underlying struct. */
+typedef struct Parrot_ImageIOFreeze_attributes {
+    Parrot_Buffer       * buffer;
+    size_t pos;
+    PMC                 * seen;
+    PMC                 * todo;
+    UINTVAL id;
+    struct PackFile     * pf;
+    PackFile_ConstTable * pf_ct;
+    PMC                 * handle;
+    INTVAL stream_flags;
+    unsigned char       * chunk;
+    size_t chunk_pos;
+} Parrot_ImageIOFreeze_attributes;
+
+/* Macro to access underlying structure of a ImageIOFreeze PMC. */
+#define PARROT_IMAGEIOFREEZE(o) ((Parrot_ImageIOFreeze_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'buffer' attribute of ImageIOFreeze PMC. */
+#define GETATTR_ImageIOFreeze_buffer(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ImageIOFreeze_attributes *)PMC_data(pmc))->buffer; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'Parrot_Buffer       *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_ImageIOFreeze_buffer(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'Parrot_Buffer       *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_ImageIOFreeze_attributes *)PMC_data(pmc))->buffer = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'pos' attribute of ImageIOFreeze PMC. */
+#define GETATTR_ImageIOFreeze_pos(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ImageIOFreeze_attributes *)PMC_data(pmc))->pos; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'size_t' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_ImageIOFreeze_pos(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'size_t' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_ImageIOFreeze_attributes *)PMC_data(pmc))->pos = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'seen' attribute of ImageIOFreeze PMC. */
+#define GETATTR_ImageIOFreeze_seen(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ImageIOFreeze_attributes *)PMC_data(pmc))->seen; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "seen")); \
+        } \
+    } while (0)
+#define SETATTR_ImageIOFreeze_seen(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "seen"), value); \
+        } \
+        else \
+            ((Parrot_ImageIOFreeze_attributes *)PMC_data(pmc))->seen = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'todo' attribute of ImageIOFreeze PMC. */
+#define GETATTR_ImageIOFreeze_todo(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ImageIOFreeze_attributes *)PMC_data(pmc))->todo; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "todo")); \
+        } \
+    } while (0)
+#define SETATTR_ImageIOFreeze_todo(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "todo"), value); \
+        } \
+        else \
+            ((Parrot_ImageIOFreeze_attributes *)PMC_data(pmc))->todo = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'id' attribute of ImageIOFreeze PMC. */
+#define GETATTR_ImageIOFreeze_id(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ImageIOFreeze_attributes *)PMC_data(pmc))->id; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'UINTVAL' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_ImageIOFreeze_id(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'UINTVAL' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_ImageIOFreeze_attributes *)PMC_data(pmc))->id = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'pf' attribute of ImageIOFreeze PMC. */
+#define GETATTR_ImageIOFreeze_pf(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ImageIOFreeze_attributes *)PMC_data(pmc))->pf; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'struct PackFile     *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_ImageIOFreeze_pf(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'struct PackFile     *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_ImageIOFreeze_attributes *)PMC_data(pmc))->pf = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'pf_ct' attribute of ImageIOFreeze PMC. */
+#define GETATTR_ImageIOFreeze_pf_ct(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ImageIOFreeze_attributes *)PMC_data(pmc))->pf_ct; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'PackFile_ConstTable *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_ImageIOFreeze_pf_ct(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'PackFile_ConstTable *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_ImageIOFreeze_attributes *)PMC_data(pmc))->pf_ct = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'handle' attribute of ImageIOFreeze PMC. */
+#define GETATTR_ImageIOFreeze_handle(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ImageIOFreeze_attributes *)PMC_data(pmc))->handle; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "handle")); \
+        } \
+    } while (0)
+#define SETATTR_ImageIOFreeze_handle(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "handle"), value); \
+        } \
+        else \
+            ((Parrot_ImageIOFreeze_attributes *)PMC_data(pmc))->handle = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'stream_flags' attribute of ImageIOFreeze PMC. */
+#define GETATTR_ImageIOFreeze_stream_flags(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ImageIOFreeze_attributes *)PMC_data(pmc))->stream_flags; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "stream_flags")); \
+            (dest) = (PMC_IS_NULL(attr_value) ? (INTVAL) 0: VTABLE_get_integer(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_ImageIOFreeze_stream_flags(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new_init_int(interp, enum_class_Integer, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "stream_flags"), attr_value); \
+        } \
+        else \
+            ((Parrot_ImageIOFreeze_attributes *)PMC_data(pmc))->stream_flags = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'chunk' attribute of ImageIOFreeze PMC. */
+#define GETATTR_ImageIOFreeze_chunk(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ImageIOFreeze_attributes *)PMC_data(pmc))->chunk; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'unsigned char       *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_ImageIOFreeze_chunk(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'unsigned char       *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_ImageIOFreeze_attributes *)PMC_data(pmc))->chunk = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'chunk_pos' attribute of ImageIOFreeze PMC. */
+#define GETATTR_ImageIOFreeze_chunk_pos(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ImageIOFreeze_attributes *)PMC_data(pmc))->chunk_pos; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'size_t' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_ImageIOFreeze_chunk_pos(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'size_t' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_ImageIOFreeze_attributes *)PMC_data(pmc))->chunk_pos = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_IMAGEIOFREEZE_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
@@ -0,0 +1,137 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/imageiosize.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_IMAGEIOSIZE_H_GUARD
+#define PARROT_PMC_IMAGEIOSIZE_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_ImageIOSize_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_ImageIOSize_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_ImageIOSize_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_ImageIOSize_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_ImageIOSize_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_ImageIOSize_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* ImageIOSize PMC's underlying struct. */
+typedef struct Parrot_ImageIOSize_attributes {
+    PMC                        * seen;
+    PMC                        * todo;
+    struct PackFile_ConstTable * pf_ct;
+    INTVAL size;
+} Parrot_ImageIOSize_attributes;
+
+/* Macro to access underlying structure of a ImageIOSize PMC. */
+#define PARROT_IMAGEIOSIZE(o) ((Parrot_ImageIOSize_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'seen' attribute of ImageIOSize PMC. */
+#define GETATTR_ImageIOSize_seen(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ImageIOSize_attributes *)PMC_data(pmc))->seen; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "seen")); \
+        } \
+    } while (0)
+#define SETATTR_ImageIOSize_seen(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "seen"), value); \
+        } \
+        else \
+            ((Parrot_ImageIOSize_attributes *)PMC_data(pmc))->seen = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'todo' attribute of ImageIOSize PMC. */
+#define GETATTR_ImageIOSize_todo(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ImageIOSize_attributes *)PMC_data(pmc))->todo; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "todo")); \
+        } \
+    } while (0)
+#define SETATTR_ImageIOSize_todo(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "todo"), value); \
+        } \
+        else \
+            ((Parrot_ImageIOSize_attributes *)PMC_data(pmc))->todo = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'pf_ct' attribute of ImageIOSize PMC. */
+#define GETATTR_ImageIOSize_pf_ct(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ImageIOSize_attributes *)PMC_data(pmc))->pf_ct; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'struct PackFile_ConstTable *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_ImageIOSize_pf_ct(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'struct PackFile_ConstTable *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_ImageIOSize_attributes *)PMC_data(pmc))->pf_ct = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'size' attribute of ImageIOSize PMC. */
+#define GETATTR_ImageIOSize_size(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ImageIOSize_attributes *)PMC_data(pmc))->size; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "size")); \
+            (dest) = (PMC_IS_NULL(attr_value) ? (INTVAL) 0: VTABLE_get_integer(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_ImageIOSize_size(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new_init_int(interp, enum_class_Integer, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "size"), attr_value); \
+        } \
+        else \
+            ((Parrot_ImageIOSize_attributes *)PMC_data(pmc))->size = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_IMAGEIOSIZE_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
@@ -0,0 +1,110 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/imageiostrings.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_IMAGEIOSTRINGS_H_GUARD
+#define PARROT_PMC_IMAGEIOSTRINGS_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_ImageIOStrings_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_ImageIOStrings_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_ImageIOStrings_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_ImageIOStrings_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_ImageIOStrings_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_ImageIOStrings_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* ImageIOStrings PMC's underlying struct. */
+typedef struct Parrot_ImageIOStrings_attributes {
+    PMC * seen;
+    PMC * todo;
+    PMC * list;
+} Parrot_ImageIOStrings_attributes;
+
+/* Macro to access underlying structure of a ImageIOStrings PMC. */
+#define PARROT_IMAGEIOSTRINGS(o) ((Parrot_ImageIOStrings_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'seen' attribute of ImageIOStrings PMC. */
+#define GETATTR_ImageIOStrings_seen(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ImageIOStrings_attributes *)PMC_data(pmc))->seen; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "seen")); \
+        } \
+    } while (0)
+#define SETATTR_ImageIOStrings_seen(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "seen"), value); \
+        } \
+        else \
+            ((Parrot_ImageIOStrings_attributes *)PMC_data(pmc))->seen = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'todo' attribute of ImageIOStrings PMC. */
+#define GETATTR_ImageIOStrings_todo(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ImageIOStrings_attributes *)PMC_data(pmc))->todo; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "todo")); \
+        } \
+    } while (0)
+#define SETATTR_ImageIOStrings_todo(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "todo"), value); \
+        } \
+        else \
+            ((Parrot_ImageIOStrings_attributes *)PMC_data(pmc))->todo = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'list' attribute of ImageIOStrings PMC. */
+#define GETATTR_ImageIOStrings_list(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ImageIOStrings_attributes *)PMC_data(pmc))->list; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "list")); \
+        } \
+    } while (0)
+#define SETATTR_ImageIOStrings_list(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "list"), value); \
+        } \
+        else \
+            ((Parrot_ImageIOStrings_attributes *)PMC_data(pmc))->list = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_IMAGEIOSTRINGS_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
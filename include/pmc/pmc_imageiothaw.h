@@ -0,0 +1,336 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/imageiothaw.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_IMAGEIOTHAW_H_GUARD
+#define PARROT_PMC_IMAGEIOTHAW_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_ImageIOThaw_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_ImageIOThaw_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_ImageIOThaw_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_ImageIOThaw_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_ImageIOThaw_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_ImageIOThaw_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* ImageIOThaw PMC's underlying struct. */
+typedef struct Parrot_ImageIOThaw_attributes {
+    STRING              * img;
+    opcode_t            * curs;
+    PMC                 * seen;
+    PMC                 * todo;
+    PackFile            * pf;
+    PackFile_ConstTable * pf_ct;
+    PMC                 * handle;
+    INTVAL stream_flags;
+    unsigned char       * chunk;
+    size_t chunk_pos;
+    size_t chunk_len;
+    size_t chunk_size;
+} Parrot_ImageIOThaw_attributes;
+
+/* Macro to access underlying structure of a ImageIOThaw PMC. */
+#define PARROT_IMAGEIOTHAW(o) ((Parrot_ImageIOThaw_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'img' attribute of ImageIOThaw PMC. */
+#define GETATTR_ImageIOThaw_img(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ImageIOThaw_attributes *)PMC_data(pmc))->img; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "img")); \
+            (dest) =  (PMC_IS_NULL(attr_value) ? (STRING *)NULL : VTABLE_get_string(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_ImageIOThaw_img(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new(interp, enum_class_String); \
+            VTABLE_set_string_native(interp, attr_value, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "img"), attr_value); \
+        } \
+        else \
+            ((Parrot_ImageIOThaw_attributes *)PMC_data(pmc))->img = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'curs' attribute of ImageIOThaw PMC. */
+#define GETATTR_ImageIOThaw_curs(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ImageIOThaw_attributes *)PMC_data(pmc))->curs; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'opcode_t            *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_ImageIOThaw_curs(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'opcode_t            *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_ImageIOThaw_attributes *)PMC_data(pmc))->curs = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'seen' attribute of ImageIOThaw PMC. */
+#define GETATTR_ImageIOThaw_seen(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ImageIOThaw_attributes *)PMC_data(pmc))->seen; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "seen")); \
+        } \
+    } while (0)
+#define SETATTR_ImageIOThaw_seen(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "seen"), value); \
+        } \
+        else \
+            ((Parrot_ImageIOThaw_attributes *)PMC_data(pmc))->seen = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'todo' attribute of ImageIOThaw PMC. */
+#define GETATTR_ImageIOThaw_todo(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ImageIOThaw_attributes *)PMC_data(pmc))->todo; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "todo")); \
+        } \
+    } while (0)
+#define SETATTR_ImageIOThaw_todo(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "todo"), value); \
+        } \
+        else \
+            ((Parrot_ImageIOThaw_attributes *)PMC_data(pmc))->todo = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'pf' attribute of ImageIOThaw PMC. */
+#define GETATTR_ImageIOThaw_pf(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ImageIOThaw_attributes *)PMC_data(pmc))->pf; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'PackFile            *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_ImageIOThaw_pf(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'PackFile            *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_ImageIOThaw_attributes *)PMC_data(pmc))->pf = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'pf_ct' attribute of ImageIOThaw PMC. */
+#define GETATTR_ImageIOThaw_pf_ct(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ImageIOThaw_attributes *)PMC_data(pmc))->pf_ct; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'PackFile_ConstTable *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_ImageIOThaw_pf_ct(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'PackFile_ConstTable *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_ImageIOThaw_attributes *)PMC_data(pmc))->pf_ct = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'handle' attribute of ImageIOThaw PMC. */
+#define GETATTR_ImageIOThaw_handle(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ImageIOThaw_attributes *)PMC_data(pmc))->handle; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "handle")); \
+        } \
+    } while (0)
+#define SETATTR_ImageIOThaw_handle(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "handle"), value); \
+        } \
+        else \
+            ((Parrot_ImageIOThaw_attributes *)PMC_data(pmc))->handle = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'stream_flags' attribute of ImageIOThaw PMC. */
+#define GETATTR_ImageIOThaw_stream_flags(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ImageIOThaw_attributes *)PMC_data(pmc))->stream_flags; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "stream_flags")); \
+            (dest) = (PMC_IS_NULL(attr_value) ? (INTVAL) 0: VTABLE_get_integer(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_ImageIOThaw_stream_flags(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new_init_int(interp, enum_class_Integer, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "stream_flags"), attr_value); \
+        } \
+        else \
+            ((Parrot_ImageIOThaw_attributes *)PMC_data(pmc))->stream_flags = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'chunk' attribute of ImageIOThaw PMC. */
+#define GETATTR_ImageIOThaw_chunk(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ImageIOThaw_attributes *)PMC_data(pmc))->chunk; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'unsigned char       *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_ImageIOThaw_chunk(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'unsigned char       *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_ImageIOThaw_attributes *)PMC_data(pmc))->chunk = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'chunk_pos' attribute of ImageIOThaw PMC. */
+#define GETATTR_ImageIOThaw_chunk_pos(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ImageIOThaw_attributes *)PMC_data(pmc))->chunk_pos; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'size_t' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_ImageIOThaw_chunk_pos(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'size_t' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_ImageIOThaw_attributes *)PMC_data(pmc))->chunk_pos = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'chunk_len' attribute of ImageIOThaw PMC. */
+#define GETATTR_ImageIOThaw_chunk_len(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ImageIOThaw_attributes *)PMC_data(pmc))->chunk_len; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'size_t' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_ImageIOThaw_chunk_len(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'size_t' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_ImageIOThaw_attributes *)PMC_data(pmc))->chunk_len = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'chunk_size' attribute of ImageIOThaw PMC. */
+#define GETATTR_ImageIOThaw_chunk_size(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ImageIOThaw_attributes *)PMC_data(pmc))->chunk_size; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'size_t' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_ImageIOThaw_chunk_size(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'size_t' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_ImageIOThaw_attributes *)PMC_data(pmc))->chunk_size = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_IMAGEIOTHAW_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
@@ -0,0 +1,116 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/imccompiler.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_IMCCOMPILER_H_GUARD
+#define PARROT_PMC_IMCCOMPILER_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_IMCCompiler_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_IMCCompiler_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_IMCCompiler_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_IMCCompiler_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_IMCCompiler_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_IMCCompiler_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* IMCCompiler PMC's underlying struct. */
+typedef struct Parrot_IMCCompiler_attributes {
+    void * imcc_info;
+    INTVAL is_pasm;
+    INTVAL current_eval;
+} Parrot_IMCCompiler_attributes;
+
+/* Macro to access underlying structure of a IMCCompiler PMC. */
+#define PARROT_IMCCOMPILER(o) ((Parrot_IMCCompiler_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'imcc_info' attribute of IMCCompiler PMC. */
+#define GETATTR_IMCCompiler_imcc_info(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_IMCCompiler_attributes *)PMC_data(pmc))->imcc_info; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'void *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_IMCCompiler_imcc_info(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'void *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_IMCCompiler_attributes *)PMC_data(pmc))->imcc_info = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'is_pasm' attribute of IMCCompiler PMC. */
+#define GETATTR_IMCCompiler_is_pasm(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_IMCCompiler_attributes *)PMC_data(pmc))->is_pasm; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "is_pasm")); \
+            (dest) = (PMC_IS_NULL(attr_value) ? (INTVAL) 0: VTABLE_get_integer(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_IMCCompiler_is_pasm(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new_init_int(interp, enum_class_Integer, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "is_pasm"), attr_value); \
+        } \
+        else \
+            ((Parrot_IMCCompiler_attributes *)PMC_data(pmc))->is_pasm = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'current_eval' attribute of IMCCompiler PMC. */
+#define GETATTR_IMCCompiler_current_eval(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_IMCCompiler_attributes *)PMC_data(pmc))->current_eval; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "current_eval")); \
+            (dest) = (PMC_IS_NULL(attr_value) ? (INTVAL) 0: VTABLE_get_integer(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_IMCCompiler_current_eval(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new_init_int(interp, enum_class_Integer, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "current_eval"), attr_value); \
+        } \
+        else \
+            ((Parrot_IMCCompiler_attributes *)PMC_data(pmc))->current_eval = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_IMCCOMPILER_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
@@ -0,0 +1,66 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/integer.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_INTEGER_H_GUARD
+#define PARROT_PMC_INTEGER_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_Integer_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_Integer_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_Integer_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_Integer_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_Integer_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_Integer_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* Integer PMC's underlying struct. */
+typedef struct Parrot_Integer_attributes {
+    INTVAL iv;
+} Parrot_Integer_attributes;
+
+/* Macro to access underlying structure of a Integer PMC. */
+#define PARROT_INTEGER(o) ((Parrot_Integer_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'iv' attribute of Integer PMC. */
+#define GETATTR_Integer_iv(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Integer_attributes *)PMC_data(pmc))->iv; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "iv")); \
+            (dest) = (PMC_IS_NULL(attr_value) ? (INTVAL) 0: VTABLE_get_integer(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_Integer_iv(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new_init_int(interp, enum_class_Integer, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "iv"), attr_value); \
+        } \
+        else \
+            ((Parrot_Integer_attributes *)PMC_data(pmc))->iv = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_INTEGER_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
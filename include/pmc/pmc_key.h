@@ -0,0 +1,115 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/key.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_KEY_H_GUARD
+#define PARROT_PMC_KEY_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_Key_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_Key_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_Key_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_Key_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_Key_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_Key_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* Key PMC's underlying struct. */
+typedef struct Parrot_Key_attributes {
+    PMC      * next_key;
+    INTVAL int_key;
+    STRING   * str_key;
+} Parrot_Key_attributes;
+
+/* Macro to access underlying structure of a Key PMC. */
+#define PARROT_KEY(o) ((Parrot_Key_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'next_key' attribute of Key PMC. */
+#define GETATTR_Key_next_key(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Key_attributes *)PMC_data(pmc))->next_key; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "next_key")); \
+        } \
+    } while (0)
+#define SETATTR_Key_next_key(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "next_key"), value); \
+        } \
+        else \
+            ((Parrot_Key_attributes *)PMC_data(pmc))->next_key = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'int_key' attribute of Key PMC. */
+#define GETATTR_Key_int_key(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Key_attributes *)PMC_data(pmc))->int_key; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "int_key")); \
+            (dest) = (PMC_IS_NULL(attr_value) ? (INTVAL) 0: VTABLE_get_integer(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_Key_int_key(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new_init_int(interp, enum_class_Integer, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "int_key"), attr_value); \
+        } \
+        else \
+            ((Parrot_Key_attributes *)PMC_data(pmc))->int_key = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'str_key' attribute of Key PMC. */
+#define GETATTR_Key_str_key(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Key_attributes *)PMC_data(pmc))->str_key; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "str_key")); \
+            (dest) =  (PMC_IS_NULL(attr_value) ? (STRING *)NULL : VTABLE_get_string(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_Key_str_key(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new(interp, enum_class_String); \
+            VTABLE_set_string_native(interp, attr_value, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "str_key"), attr_value); \
+        } \
+        else \
+            ((Parrot_Key_attributes *)PMC_data(pmc))->str_key = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_KEY_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
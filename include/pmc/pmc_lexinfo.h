@@ -0,0 +1,66 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/lexinfo.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_LEXINFO_H_GUARD
+#define PARROT_PMC_LEXINFO_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_LexInfo_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_LexInfo_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_LexInfo_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_LexInfo_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_LexInfo_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_LexInfo_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* LexInfo PMC's underlying struct. */
+typedef struct Parrot_LexInfo_attributes {
+    Hash * hash;
+} Parrot_LexInfo_attributes;
+
+/* Macro to access underlying structure of a LexInfo PMC. */
+#define PARROT_LEXINFO(o) ((Parrot_LexInfo_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'hash' attribute of LexInfo PMC. */
+#define GETATTR_LexInfo_hash(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_LexInfo_attributes *)PMC_data(pmc))->hash; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'Hash *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_LexInfo_hash(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'Hash *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_LexInfo_attributes *)PMC_data(pmc))->hash = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_LEXINFO_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
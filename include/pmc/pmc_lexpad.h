@@ -0,0 +1,87 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/lexpad.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_LEXPAD_H_GUARD
+#define PARROT_PMC_LEXPAD_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_LexPad_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_LexPad_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_LexPad_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_LexPad_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_LexPad_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_LexPad_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* LexPad PMC's underlying struct. */
+typedef struct Parrot_LexPad_attributes {
+    PMC * lexinfo;
+    PMC * ctx;
+} Parrot_LexPad_attributes;
+
+/* Macro to access underlying structure of a LexPad PMC. */
+#define PARROT_LEXPAD(o) ((Parrot_LexPad_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'lexinfo' attribute of LexPad PMC. */
+#define GETATTR_LexPad_lexinfo(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_LexPad_attributes *)PMC_data(pmc))->lexinfo; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "lexinfo")); \
+        } \
+    } while (0)
+#define SETATTR_LexPad_lexinfo(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "lexinfo"), value); \
+        } \
+        else \
+            ((Parrot_LexPad_attributes *)PMC_data(pmc))->lexinfo = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'ctx' attribute of LexPad PMC. */
+#define GETATTR_LexPad_ctx(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_LexPad_attributes *)PMC_data(pmc))->ctx; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "ctx")); \
+        } \
+    } while (0)
+#define SETATTR_LexPad_ctx(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "ctx"), value); \
+        } \
+        else \
+            ((Parrot_LexPad_attributes *)PMC_data(pmc))->ctx = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_LEXPAD_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
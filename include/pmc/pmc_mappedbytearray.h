@@ -0,0 +1,91 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/mappedbytearray.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_MAPPEDBYTEARRAY_H_GUARD
+#define PARROT_PMC_MAPPEDBYTEARRAY_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_MappedByteArray_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_MappedByteArray_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_MappedByteArray_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_MappedByteArray_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_MappedByteArray_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_MappedByteArray_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* MappedByteArray PMC's underlying struct. */
+typedef struct Parrot_MappedByteArray_attributes {
+    unsigned char * buffer;
+    UINTVAL size;
+} Parrot_MappedByteArray_attributes;
+
+/* Macro to access underlying structure of a MappedByteArray PMC. */
+#define PARROT_MAPPEDBYTEARRAY(o) ((Parrot_MappedByteArray_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'buffer' attribute of MappedByteArray PMC. */
+#define GETATTR_MappedByteArray_buffer(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_MappedByteArray_attributes *)PMC_data(pmc))->buffer; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'unsigned char *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_MappedByteArray_buffer(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'unsigned char *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_MappedByteArray_attributes *)PMC_data(pmc))->buffer = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'size' attribute of MappedByteArray PMC. */
+#define GETATTR_MappedByteArray_size(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_MappedByteArray_attributes *)PMC_data(pmc))->size; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'UINTVAL' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_MappedByteArray_size(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'UINTVAL' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_MappedByteArray_attributes *)PMC_data(pmc))->size = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_MAPPEDBYTEARRAY_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
@@ -0,0 +1,184 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/namespace.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_NAMESPACE_H_GUARD
+#define PARROT_PMC_NAMESPACE_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_NameSpace_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_NameSpace_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_NameSpace_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_NameSpace_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_NameSpace_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_NameSpace_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* NameSpace PMC's underlying struct. */
+typedef struct Parrot_NameSpace_attributes {
+    Hash * hash;
+    STRING * name;
+    PMC    * _class;
+    PMC    * methods;
+    PMC    * vtable;
+    PMC    * parent;
+} Parrot_NameSpace_attributes;
+
+/* Macro to access underlying structure of a NameSpace PMC. */
+#define PARROT_NAMESPACE(o) ((Parrot_NameSpace_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'hash' attribute of NameSpace PMC. */
+#define GETATTR_NameSpace_hash(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_NameSpace_attributes *)PMC_data(pmc))->hash; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'Hash *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_NameSpace_hash(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'Hash *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_NameSpace_attributes *)PMC_data(pmc))->hash = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'name' attribute of NameSpace PMC. */
+#define GETATTR_NameSpace_name(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_NameSpace_attributes *)PMC_data(pmc))->name; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "name")); \
+            (dest) =  (PMC_IS_NULL(attr_value) ? (STRING *)NULL : VTABLE_get_string(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_NameSpace_name(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new(interp, enum_class_String); \
+            VTABLE_set_string_native(interp, attr_value, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "name"), attr_value); \
+        } \
+        else \
+            ((Parrot_NameSpace_attributes *)PMC_data(pmc))->name = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for '_class' attribute of NameSpace PMC. */
+#define GETATTR_NameSpace__class(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_NameSpace_attributes *)PMC_data(pmc))->_class; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "_class")); \
+        } \
+    } while (0)
+#define SETATTR_NameSpace__class(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "_class"), value); \
+        } \
+        else \
+            ((Parrot_NameSpace_attributes *)PMC_data(pmc))->_class = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'methods' attribute of NameSpace PMC. */
+#define GETATTR_NameSpace_methods(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_NameSpace_attributes *)PMC_data(pmc))->methods; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "methods")); \
+        } \
+    } while (0)
+#define SETATTR_NameSpace_methods(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "methods"), value); \
+        } \
+        else \
+            ((Parrot_NameSpace_attributes *)PMC_data(pmc))->methods = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'vtable' attribute of NameSpace PMC. */
+#define GETATTR_NameSpace_vtable(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_NameSpace_attributes *)PMC_data(pmc))->vtable; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "vtable")); \
+        } \
+    } while (0)
+#define SETATTR_NameSpace_vtable(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "vtable"), value); \
+        } \
+        else \
+            ((Parrot_NameSpace_attributes *)PMC_data(pmc))->vtable = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'parent' attribute of NameSpace PMC. */
+#define GETATTR_NameSpace_parent(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_NameSpace_attributes *)PMC_data(pmc))->parent; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "parent")); \
+        } \
+    } while (0)
+#define SETATTR_NameSpace_parent(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "parent"), value); \
+        } \
+        else \
+            ((Parrot_NameSpace_attributes *)PMC_data(pmc))->parent = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_NAMESPACE_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
@@ -0,0 +1,141 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/nativepccmethod.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_NATIVEPCCMETHOD_H_GUARD
+#define PARROT_PMC_NATIVEPCCMETHOD_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_NativePCCMethod_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_NativePCCMethod_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_NativePCCMethod_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_NativePCCMethod_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_NativePCCMethod_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_NativePCCMethod_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* NativePCCMethod PMC's underlying struct. */
+typedef struct Parrot_NativePCCMethod_attributes {
+    STRING * signature;
+    void   * func;
+    STRING * mmd_long_signature;
+    PMC    * mmd_multi_sig;
+} Parrot_NativePCCMethod_attributes;
+
+/* Macro to access underlying structure of a NativePCCMethod PMC. */
+#define PARROT_NATIVEPCCMETHOD(o) ((Parrot_NativePCCMethod_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'signature' attribute of NativePCCMethod PMC. */
+#define GETATTR_NativePCCMethod_signature(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_NativePCCMethod_attributes *)PMC_data(pmc))->signature; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "signature")); \
+            (dest) =  (PMC_IS_NULL(attr_value) ? (STRING *)NULL : VTABLE_get_string(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_NativePCCMethod_signature(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new(interp, enum_class_String); \
+            VTABLE_set_string_native(interp, attr_value, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "signature"), attr_value); \
+        } \
+        else \
+            ((Parrot_NativePCCMethod_attributes *)PMC_data(pmc))->signature = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'func' attribute of NativePCCMethod PMC. */
+#define GETATTR_NativePCCMethod_func(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_NativePCCMethod_attributes *)PMC_data(pmc))->func; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'void   *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_NativePCCMethod_func(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'void   *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_NativePCCMethod_attributes *)PMC_data(pmc))->func = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'mmd_long_signature' attribute of NativePCCMethod PMC. */
+#define GETATTR_NativePCCMethod_mmd_long_signature(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_NativePCCMethod_attributes *)PMC_data(pmc))->mmd_long_signature; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "mmd_long_signature")); \
+            (dest) =  (PMC_IS_NULL(attr_value) ? (STRING *)NULL : VTABLE_get_string(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_NativePCCMethod_mmd_long_signature(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new(interp, enum_class_String); \
+            VTABLE_set_string_native(interp, attr_value, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "mmd_long_signature"), attr_value); \
+        } \
+        else \
+            ((Parrot_NativePCCMethod_attributes *)PMC_data(pmc))->mmd_long_signature = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'mmd_multi_sig' attribute of NativePCCMethod PMC. */
+#define GETATTR_NativePCCMethod_mmd_multi_sig(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_NativePCCMethod_attributes *)PMC_data(pmc))->mmd_multi_sig; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "mmd_multi_sig")); \
+        } \
+    } while (0)
+#define SETATTR_NativePCCMethod_mmd_multi_sig(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "mmd_multi_sig"), value); \
+        } \
+        else \
+            ((Parrot_NativePCCMethod_attributes *)PMC_data(pmc))->mmd_multi_sig = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_NATIVEPCCMETHOD_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
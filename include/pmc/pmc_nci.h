@@ -0,0 +1,263 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/nci.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_NCI_H_GUARD
+#define PARROT_PMC_NCI_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_NCI_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_NCI_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_NCI_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_NCI_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_NCI_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_NCI_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* NCI PMC's underlying struct. */
+typedef struct Parrot_NCI_attributes {
+    PMC       * signature;
+    void      * func;
+    PMC       * fb_info;
+    void      * orig_func;
+    STRING    * pcc_params_signature;
+    STRING    * pcc_return_signature;
+    INTVAL arity;
+    STRING    * long_signature;
+    PMC       * multi_sig;
+} Parrot_NCI_attributes;
+
+/* Macro to access underlying structure of a NCI PMC. */
+#define PARROT_NCI(o) ((Parrot_NCI_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'signature' attribute of NCI PMC. */
+#define GETATTR_NCI_signature(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_NCI_attributes *)PMC_data(pmc))->signature; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "signature")); \
+        } \
+    } while (0)
+#define SETATTR_NCI_signature(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "signature"), value); \
+        } \
+        else \
+            ((Parrot_NCI_attributes *)PMC_data(pmc))->signature = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'func' attribute of NCI PMC. */
+#define GETATTR_NCI_func(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_NCI_attributes *)PMC_data(pmc))->func; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'void      *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_NCI_func(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'void      *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_NCI_attributes *)PMC_data(pmc))->func = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'fb_info' attribute of NCI PMC. */
+#define GETATTR_NCI_fb_info(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_NCI_attributes *)PMC_data(pmc))->fb_info; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "fb_info")); \
+        } \
+    } while (0)
+#define SETATTR_NCI_fb_info(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "fb_info"), value); \
+        } \
+        else \
+            ((Parrot_NCI_attributes *)PMC_data(pmc))->fb_info = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'orig_func' attribute of NCI PMC. */
+#define GETATTR_NCI_orig_func(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_NCI_attributes *)PMC_data(pmc))->orig_func; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'void      *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_NCI_orig_func(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'void      *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_NCI_attributes *)PMC_data(pmc))->orig_func = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'pcc_params_signature' attribute of NCI PMC. */
+#define GETATTR_NCI_pcc_params_signature(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_NCI_attributes *)PMC_data(pmc))->pcc_params_signature; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "pcc_params_signature")); \
+            (dest) =  (PMC_IS_NULL(attr_value) ? (STRING *)NULL : VTABLE_get_string(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_NCI_pcc_params_signature(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new(interp, enum_class_String); \
+            VTABLE_set_string_native(interp, attr_value, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "pcc_params_signature"), attr_value); \
+        } \
+        else \
+            ((Parrot_NCI_attributes *)PMC_data(pmc))->pcc_params_signature = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'pcc_return_signature' attribute of NCI PMC. */
+#define GETATTR_NCI_pcc_return_signature(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_NCI_attributes *)PMC_data(pmc))->pcc_return_signature; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "pcc_return_signature")); \
+            (dest) =  (PMC_IS_NULL(attr_value) ? (STRING *)NULL : VTABLE_get_string(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_NCI_pcc_return_signature(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new(interp, enum_class_String); \
+            VTABLE_set_string_native(interp, attr_value, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "pcc_return_signature"), attr_value); \
+        } \
+        else \
+            ((Parrot_NCI_attributes *)PMC_data(pmc))->pcc_return_signature = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'arity' attribute of NCI PMC. */
+#define GETATTR_NCI_arity(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_NCI_attributes *)PMC_data(pmc))->arity; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "arity")); \
+            (dest) = (PMC_IS_NULL(attr_value) ? (INTVAL) 0: VTABLE_get_integer(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_NCI_arity(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new_init_int(interp, enum_class_Integer, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "arity"), attr_value); \
+        } \
+        else \
+            ((Parrot_NCI_attributes *)PMC_data(pmc))->arity = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'long_signature' attribute of NCI PMC. */
+#define GETATTR_NCI_long_signature(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_NCI_attributes *)PMC_data(pmc))->long_signature; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "long_signature")); \
+            (dest) =  (PMC_IS_NULL(attr_value) ? (STRING *)NULL : VTABLE_get_string(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_NCI_long_signature(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new(interp, enum_class_String); \
+            VTABLE_set_string_native(interp, attr_value, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "long_signature"), attr_value); \
+        } \
+        else \
+            ((Parrot_NCI_attributes *)PMC_data(pmc))->long_signature = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'multi_sig' attribute of NCI PMC. */
+#define GETATTR_NCI_multi_sig(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_NCI_attributes *)PMC_data(pmc))->multi_sig; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "multi_sig")); \
+        } \
+    } while (0)
+#define SETATTR_NCI_multi_sig(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "multi_sig"), value); \
+        } \
+        else \
+            ((Parrot_NCI_attributes *)PMC_data(pmc))->multi_sig = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_NCI_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
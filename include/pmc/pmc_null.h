@@ -0,0 +1,33 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/null.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_NULL_H_GUARD
+#define PARROT_PMC_NULL_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_Null_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_Null_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_Null_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_Null_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_Null_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_Null_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+#endif /* PARROT_PMC_NULL_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
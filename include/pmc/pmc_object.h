@@ -0,0 +1,140 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/object.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_OBJECT_H_GUARD
+#define PARROT_PMC_OBJECT_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_Object_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_Object_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_Object_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_Object_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_Object_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_Object_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* Object PMC's underlying struct. */
+typedef struct Parrot_Object_attributes {
+    PMC    * _class;
+    Parrot_Object_slot * attrib_store;
+    INTVAL num_attribs;
+    STRING             * attrib_kinds;
+} Parrot_Object_attributes;
+
+/* Macro to access underlying structure of a Object PMC. */
+#define PARROT_OBJECT(o) ((Parrot_Object_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for '_class' attribute of Object PMC. */
+#define GETATTR_Object__class(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Object_attributes *)PMC_data(pmc))->_class; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "_class")); \
+        } \
+    } while (0)
+#define SETATTR_Object__class(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "_class"), value); \
+        } \
+        else \
+            ((Parrot_Object_attributes *)PMC_data(pmc))->_class = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'attrib_store' attribute of Object PMC. */
+#define GETATTR_Object_attrib_store(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Object_attributes *)PMC_data(pmc))->attrib_store; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'Parrot_Object_slot *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_Object_attrib_store(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'Parrot_Object_slot *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_Object_attributes *)PMC_data(pmc))->attrib_store = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'num_attribs' attribute of Object PMC. */
+#define GETATTR_Object_num_attribs(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Object_attributes *)PMC_data(pmc))->num_attribs; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "num_attribs")); \
+            (dest) = (PMC_IS_NULL(attr_value) ? (INTVAL) 0: VTABLE_get_integer(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_Object_num_attribs(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new_init_int(interp, enum_class_Integer, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "num_attribs"), attr_value); \
+        } \
+        else \
+            ((Parrot_Object_attributes *)PMC_data(pmc))->num_attribs = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'attrib_kinds' attribute of Object PMC. */
+#define GETATTR_Object_attrib_kinds(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Object_attributes *)PMC_data(pmc))->attrib_kinds; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "attrib_kinds")); \
+            (dest) =  (PMC_IS_NULL(attr_value) ? (STRING *)NULL : VTABLE_get_string(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_Object_attrib_kinds(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new(interp, enum_class_String); \
+            VTABLE_set_string_native(interp, attr_value, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "attrib_kinds"), attr_value); \
+        } \
+        else \
+            ((Parrot_Object_attributes *)PMC_data(pmc))->attrib_kinds = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_OBJECT_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
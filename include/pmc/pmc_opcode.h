@@ -0,0 +1,91 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/opcode.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_OPCODE_H_GUARD
+#define PARROT_PMC_OPCODE_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_Opcode_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_Opcode_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_Opcode_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_Opcode_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_Opcode_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_Opcode_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* Opcode PMC's underlying struct. */
+typedef struct Parrot_Opcode_attributes {
+    op_info_t * info;
+    INTVAL op_number;
+} Parrot_Opcode_attributes;
+
+/* Macro to access underlying structure of a Opcode PMC. */
+#define PARROT_OPCODE(o) ((Parrot_Opcode_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'info' attribute of Opcode PMC. */
+#define GETATTR_Opcode_info(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Opcode_attributes *)PMC_data(pmc))->info; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'op_info_t *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_Opcode_info(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'op_info_t *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_Opcode_attributes *)PMC_data(pmc))->info = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'op_number' attribute of Opcode PMC. */
+#define GETATTR_Opcode_op_number(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Opcode_attributes *)PMC_data(pmc))->op_number; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "op_number")); \
+            (dest) = (PMC_IS_NULL(attr_value) ? (INTVAL) 0: VTABLE_get_integer(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_Opcode_op_number(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new_init_int(interp, enum_class_Integer, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "op_number"), attr_value); \
+        } \
+        else \
+            ((Parrot_Opcode_attributes *)PMC_data(pmc))->op_number = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_OPCODE_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
@@ -0,0 +1,66 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/oplib.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_OPLIB_H_GUARD
+#define PARROT_PMC_OPLIB_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_OpLib_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_OpLib_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_OpLib_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_OpLib_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_OpLib_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_OpLib_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* OpLib PMC's underlying struct. */
+typedef struct Parrot_OpLib_attributes {
+    op_lib_t * oplib;
+} Parrot_OpLib_attributes;
+
+/* Macro to access underlying structure of a OpLib PMC. */
+#define PARROT_OPLIB(o) ((Parrot_OpLib_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'oplib' attribute of OpLib PMC. */
+#define GETATTR_OpLib_oplib(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_OpLib_attributes *)PMC_data(pmc))->oplib; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'op_lib_t *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_OpLib_oplib(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'op_lib_t *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_OpLib_attributes *)PMC_data(pmc))->oplib = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_OPLIB_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
@@ -0,0 +1,110 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/orderedhash.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_ORDEREDHASH_H_GUARD
+#define PARROT_PMC_ORDEREDHASH_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_OrderedHash_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_OrderedHash_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_OrderedHash_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_OrderedHash_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_OrderedHash_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_OrderedHash_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* OrderedHash PMC's underlying struct. */
+typedef struct Parrot_OrderedHash_attributes {
+    PMC    * hash;
+    PMC    * first;
+    PMC    * last;
+} Parrot_OrderedHash_attributes;
+
+/* Macro to access underlying structure of a OrderedHash PMC. */
+#define PARROT_ORDEREDHASH(o) ((Parrot_OrderedHash_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'hash' attribute of OrderedHash PMC. */
+#define GETATTR_OrderedHash_hash(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_OrderedHash_attributes *)PMC_data(pmc))->hash; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "hash")); \
+        } \
+    } while (0)
+#define SETATTR_OrderedHash_hash(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "hash"), value); \
+        } \
+        else \
+            ((Parrot_OrderedHash_attributes *)PMC_data(pmc))->hash = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'first' attribute of OrderedHash PMC. */
+#define GETATTR_OrderedHash_first(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_OrderedHash_attributes *)PMC_data(pmc))->first; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "first")); \
+        } \
+    } while (0)
+#define SETATTR_OrderedHash_first(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "first"), value); \
+        } \
+        else \
+            ((Parrot_OrderedHash_attributes *)PMC_data(pmc))->first = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'last' attribute of OrderedHash PMC. */
+#define GETATTR_OrderedHash_last(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_OrderedHash_attributes *)PMC_data(pmc))->last; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "last")); \
+        } \
+    } while (0)
+#define SETATTR_OrderedHash_last(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "last"), value); \
+        } \
+        else \
+            ((Parrot_OrderedHash_attributes *)PMC_data(pmc))->last = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_ORDEREDHASH_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
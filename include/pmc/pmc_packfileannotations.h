@@ -0,0 +1,110 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/packfileannotations.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_PACKFILEANNOTATIONS_H_GUARD
+#define PARROT_PMC_PACKFILEANNOTATIONS_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_PackfileAnnotations_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_PackfileAnnotations_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_PackfileAnnotations_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_PackfileAnnotations_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_PackfileAnnotations_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_PackfileAnnotations_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* PackfileAnnotations PMC's underlying struct. */
+typedef struct Parrot_PackfileAnnotations_attributes {
+    PMC * directory;
+    PMC * const_table;
+    PMC * annotations;
+} Parrot_PackfileAnnotations_attributes;
+
+/* Macro to access underlying structure of a PackfileAnnotations PMC. */
+#define PARROT_PACKFILEANNOTATIONS(o) ((Parrot_PackfileAnnotations_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'directory' attribute of PackfileAnnotations PMC. */
+#define GETATTR_PackfileAnnotations_directory(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PackfileAnnotations_attributes *)PMC_data(pmc))->directory; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "directory")); \
+        } \
+    } while (0)
+#define SETATTR_PackfileAnnotations_directory(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "directory"), value); \
+        } \
+        else \
+            ((Parrot_PackfileAnnotations_attributes *)PMC_data(pmc))->directory = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'const_table' attribute of PackfileAnnotations PMC. */
+#define GETATTR_PackfileAnnotations_const_table(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PackfileAnnotations_attributes *)PMC_data(pmc))->const_table; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "const_table")); \
+        } \
+    } while (0)
+#define SETATTR_PackfileAnnotations_const_table(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "const_table"), value); \
+        } \
+        else \
+            ((Parrot_PackfileAnnotations_attributes *)PMC_data(pmc))->const_table = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'annotations' attribute of PackfileAnnotations PMC. */
+#define GETATTR_PackfileAnnotations_annotations(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PackfileAnnotations_attributes *)PMC_data(pmc))->annotations; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "annotations")); \
+        } \
+    } while (0)
+#define SETATTR_PackfileAnnotations_annotations(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "annotations"), value); \
+        } \
+        else \
+            ((Parrot_PackfileAnnotations_attributes *)PMC_data(pmc))->annotations = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_PACKFILEANNOTATIONS_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
@@ -0,0 +1,160 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/packfilebytecodesegment.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_PACKFILEBYTECODESEGMENT_H_GUARD
+#define PARROT_PMC_PACKFILEBYTECODESEGMENT_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_PackfileBytecodeSegment_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_PackfileBytecodeSegment_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_PackfileBytecodeSegment_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_PackfileBytecodeSegment_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_PackfileBytecodeSegment_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_PackfileBytecodeSegment_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* PackfileBytecodeSegment PMC's underlying struct. */
+typedef struct Parrot_PackfileBytecodeSegment_attributes {
+    PMC * directory;
+    INTVAL type;
+    PMC    * opcodes;
+    PMC    * op_map;
+    INTVAL main_sub;
+} Parrot_PackfileBytecodeSegment_attributes;
+
+/* Macro to access underlying structure of a PackfileBytecodeSegment PMC. */
+#define PARROT_PACKFILEBYTECODESEGMENT(o) ((Parrot_PackfileBytecodeSegment_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'directory' attribute of PackfileBytecodeSegment PMC. */
+#define GETATTR_PackfileBytecodeSegment_directory(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PackfileBytecodeSegment_attributes *)PMC_data(pmc))->directory; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "directory")); \
+        } \
+    } while (0)
+#define SETATTR_PackfileBytecodeSegment_directory(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "directory"), value); \
+        } \
+        else \
+            ((Parrot_PackfileBytecodeSegment_attributes *)PMC_data(pmc))->directory = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'type' attribute of PackfileBytecodeSegment PMC. */
+#define GETATTR_PackfileBytecodeSegment_type(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PackfileBytecodeSegment_attributes *)PMC_data(pmc))->type; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "type")); \
+            (dest) = (PMC_IS_NULL(attr_value) ? (INTVAL) 0: VTABLE_get_integer(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_PackfileBytecodeSegment_type(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new_init_int(interp, enum_class_Integer, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "type"), attr_value); \
+        } \
+        else \
+            ((Parrot_PackfileBytecodeSegment_attributes *)PMC_data(pmc))->type = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'opcodes' attribute of PackfileBytecodeSegment PMC. */
+#define GETATTR_PackfileBytecodeSegment_opcodes(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PackfileBytecodeSegment_attributes *)PMC_data(pmc))->opcodes; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "opcodes")); \
+        } \
+    } while (0)
+#define SETATTR_PackfileBytecodeSegment_opcodes(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "opcodes"), value); \
+        } \
+        else \
+            ((Parrot_PackfileBytecodeSegment_attributes *)PMC_data(pmc))->opcodes = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'op_map' attribute of PackfileBytecodeSegment PMC. */
+#define GETATTR_PackfileBytecodeSegment_op_map(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PackfileBytecodeSegment_attributes *)PMC_data(pmc))->op_map; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "op_map")); \
+        } \
+    } while (0)
+#define SETATTR_PackfileBytecodeSegment_op_map(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "op_map"), value); \
+        } \
+        else \
+            ((Parrot_PackfileBytecodeSegment_attributes *)PMC_data(pmc))->op_map = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'main_sub' attribute of PackfileBytecodeSegment PMC. */
+#define GETATTR_PackfileBytecodeSegment_main_sub(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PackfileBytecodeSegment_attributes *)PMC_data(pmc))->main_sub; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "main_sub")); \
+            (dest) = (PMC_IS_NULL(attr_value) ? (INTVAL) 0: VTABLE_get_integer(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_PackfileBytecodeSegment_main_sub(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new_init_int(interp, enum_class_Integer, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "main_sub"), attr_value); \
+        } \
+        else \
+            ((Parrot_PackfileBytecodeSegment_attributes *)PMC_data(pmc))->main_sub = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_PACKFILEBYTECODESEGMENT_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
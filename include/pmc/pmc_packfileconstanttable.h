@@ -0,0 +1,156 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/packfileconstanttable.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_PACKFILECONSTANTTABLE_H_GUARD
+#define PARROT_PMC_PACKFILECONSTANTTABLE_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_PackfileConstantTable_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_PackfileConstantTable_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_PackfileConstantTable_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_PackfileConstantTable_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_PackfileConstantTable_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_PackfileConstantTable_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* PackfileConstantTable PMC's underlying struct. */
+typedef struct Parrot_PackfileConstantTable_attributes {
+    PMC * directory;
+    PMC * num_constants;
+    PMC * str_constants;
+    PMC * pmc_constants;
+    PMC * tag_map;
+} Parrot_PackfileConstantTable_attributes;
+
+/* Macro to access underlying structure of a PackfileConstantTable PMC. */
+#define PARROT_PACKFILECONSTANTTABLE(o) ((Parrot_PackfileConstantTable_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'directory' attribute of PackfileConstantTable PMC. */
+#define GETATTR_PackfileConstantTable_directory(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PackfileConstantTable_attributes *)PMC_data(pmc))->directory; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "directory")); \
+        } \
+    } while (0)
+#define SETATTR_PackfileConstantTable_directory(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "directory"), value); \
+        } \
+        else \
+            ((Parrot_PackfileConstantTable_attributes *)PMC_data(pmc))->directory = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'num_constants' attribute of PackfileConstantTable PMC. */
+#define GETATTR_PackfileConstantTable_num_constants(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PackfileConstantTable_attributes *)PMC_data(pmc))->num_constants; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "num_constants")); \
+        } \
+    } while (0)
+#define SETATTR_PackfileConstantTable_num_constants(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "num_constants"), value); \
+        } \
+        else \
+            ((Parrot_PackfileConstantTable_attributes *)PMC_data(pmc))->num_constants = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'str_constants' attribute of PackfileConstantTable PMC. */
+#define GETATTR_PackfileConstantTable_str_constants(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PackfileConstantTable_attributes *)PMC_data(pmc))->str_constants; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "str_constants")); \
+        } \
+    } while (0)
+#define SETATTR_PackfileConstantTable_str_constants(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "str_constants"), value); \
+        } \
+        else \
+            ((Parrot_PackfileConstantTable_attributes *)PMC_data(pmc))->str_constants = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'pmc_constants' attribute of PackfileConstantTable PMC. */
+#define GETATTR_PackfileConstantTable_pmc_constants(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PackfileConstantTable_attributes *)PMC_data(pmc))->pmc_constants; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "pmc_constants")); \
+        } \
+    } while (0)
+#define SETATTR_PackfileConstantTable_pmc_constants(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "pmc_constants"), value); \
+        } \
+        else \
+            ((Parrot_PackfileConstantTable_attributes *)PMC_data(pmc))->pmc_constants = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'tag_map' attribute of PackfileConstantTable PMC. */
+#define GETATTR_PackfileConstantTable_tag_map(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PackfileConstantTable_attributes *)PMC_data(pmc))->tag_map; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "tag_map")); \
+        } \
+    } while (0)
+#define SETATTR_PackfileConstantTable_tag_map(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "tag_map"), value); \
+        } \
+        else \
+            ((Parrot_PackfileConstantTable_attributes *)PMC_data(pmc))->tag_map = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_PACKFILECONSTANTTABLE_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
@@ -0,0 +1,87 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/packfiledirectory.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_PACKFILEDIRECTORY_H_GUARD
+#define PARROT_PMC_PACKFILEDIRECTORY_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_PackfileDirectory_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_PackfileDirectory_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_PackfileDirectory_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_PackfileDirectory_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_PackfileDirectory_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_PackfileDirectory_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* PackfileDirectory PMC's underlying struct. */
+typedef struct Parrot_PackfileDirectory_attributes {
+    PMC * directory;
+    PMC * hash;
+} Parrot_PackfileDirectory_attributes;
+
+/* Macro to access underlying structure of a PackfileDirectory PMC. */
+#define PARROT_PACKFILEDIRECTORY(o) ((Parrot_PackfileDirectory_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'directory' attribute of PackfileDirectory PMC. */
+#define GETATTR_PackfileDirectory_directory(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PackfileDirectory_attributes *)PMC_data(pmc))->directory; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "directory")); \
+        } \
+    } while (0)
+#define SETATTR_PackfileDirectory_directory(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "directory"), value); \
+        } \
+        else \
+            ((Parrot_PackfileDirectory_attributes *)PMC_data(pmc))->directory = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'hash' attribute of PackfileDirectory PMC. */
+#define GETATTR_PackfileDirectory_hash(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PackfileDirectory_attributes *)PMC_data(pmc))->hash; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "hash")); \
+        } \
+    } while (0)
+#define SETATTR_PackfileDirectory_hash(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "hash"), value); \
+        } \
+        else \
+            ((Parrot_PackfileDirectory_attributes *)PMC_data(pmc))->hash = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_PACKFILEDIRECTORY_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
@@ -0,0 +1,110 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/packfileopmap.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_PACKFILEOPMAP_H_GUARD
+#define PARROT_PMC_PACKFILEOPMAP_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_PackfileOpMap_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_PackfileOpMap_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_PackfileOpMap_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_PackfileOpMap_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_PackfileOpMap_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_PackfileOpMap_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* PackfileOpMap PMC's underlying struct. */
+typedef struct Parrot_PackfileOpMap_attributes {
+    PMC    * op_maps;
+    PMC    * map_cache;
+    PMC    * ops;
+} Parrot_PackfileOpMap_attributes;
+
+/* Macro to access underlying structure of a PackfileOpMap PMC. */
+#define PARROT_PACKFILEOPMAP(o) ((Parrot_PackfileOpMap_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'op_maps' attribute of PackfileOpMap PMC. */
+#define GETATTR_PackfileOpMap_op_maps(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PackfileOpMap_attributes *)PMC_data(pmc))->op_maps; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "op_maps")); \
+        } \
+    } while (0)
+#define SETATTR_PackfileOpMap_op_maps(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "op_maps"), value); \
+        } \
+        else \
+            ((Parrot_PackfileOpMap_attributes *)PMC_data(pmc))->op_maps = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'map_cache' attribute of PackfileOpMap PMC. */
+#define GETATTR_PackfileOpMap_map_cache(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PackfileOpMap_attributes *)PMC_data(pmc))->map_cache; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "map_cache")); \
+        } \
+    } while (0)
+#define SETATTR_PackfileOpMap_map_cache(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "map_cache"), value); \
+        } \
+        else \
+            ((Parrot_PackfileOpMap_attributes *)PMC_data(pmc))->map_cache = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'ops' attribute of PackfileOpMap PMC. */
+#define GETATTR_PackfileOpMap_ops(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PackfileOpMap_attributes *)PMC_data(pmc))->ops; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "ops")); \
+        } \
+    } while (0)
+#define SETATTR_PackfileOpMap_ops(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "ops"), value); \
+        } \
+        else \
+            ((Parrot_PackfileOpMap_attributes *)PMC_data(pmc))->ops = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_PACKFILEOPMAP_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
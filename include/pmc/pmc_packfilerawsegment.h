@@ -0,0 +1,112 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/packfilerawsegment.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_PACKFILERAWSEGMENT_H_GUARD
+#define PARROT_PMC_PACKFILERAWSEGMENT_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_PackfileRawSegment_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_PackfileRawSegment_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_PackfileRawSegment_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_PackfileRawSegment_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_PackfileRawSegment_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_PackfileRawSegment_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* PackfileRawSegment PMC's underlying struct. */
+typedef struct Parrot_PackfileRawSegment_attributes {
+    PMC * directory;
+    INTVAL type;
+    PMC    * opcodes;
+} Parrot_PackfileRawSegment_attributes;
+
+/* Macro to access underlying structure of a PackfileRawSegment PMC. */
+#define PARROT_PACKFILERAWSEGMENT(o) ((Parrot_PackfileRawSegment_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'directory' attribute of PackfileRawSegment PMC. */
+#define GETATTR_PackfileRawSegment_directory(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PackfileRawSegment_attributes *)PMC_data(pmc))->directory; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "directory")); \
+        } \
+    } while (0)
+#define SETATTR_PackfileRawSegment_directory(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "directory"), value); \
+        } \
+        else \
+            ((Parrot_PackfileRawSegment_attributes *)PMC_data(pmc))->directory = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'type' attribute of PackfileRawSegment PMC. */
+#define GETATTR_PackfileRawSegment_type(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PackfileRawSegment_attributes *)PMC_data(pmc))->type; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "type")); \
+            (dest) = (PMC_IS_NULL(attr_value) ? (INTVAL) 0: VTABLE_get_integer(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_PackfileRawSegment_type(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new_init_int(interp, enum_class_Integer, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "type"), attr_value); \
+        } \
+        else \
+            ((Parrot_PackfileRawSegment_attributes *)PMC_data(pmc))->type = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'opcodes' attribute of PackfileRawSegment PMC. */
+#define GETATTR_PackfileRawSegment_opcodes(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PackfileRawSegment_attributes *)PMC_data(pmc))->opcodes; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "opcodes")); \
+        } \
+    } while (0)
+#define SETATTR_PackfileRawSegment_opcodes(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "opcodes"), value); \
+        } \
+        else \
+            ((Parrot_PackfileRawSegment_attributes *)PMC_data(pmc))->opcodes = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_PACKFILERAWSEGMENT_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
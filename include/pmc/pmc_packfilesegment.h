@@ -0,0 +1,64 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/packfilesegment.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_PACKFILESEGMENT_H_GUARD
+#define PARROT_PMC_PACKFILESEGMENT_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_PackfileSegment_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_PackfileSegment_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_PackfileSegment_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_PackfileSegment_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_PackfileSegment_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_PackfileSegment_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* PackfileSegment PMC's underlying struct. */
+typedef struct Parrot_PackfileSegment_attributes {
+    PMC * directory;
+} Parrot_PackfileSegment_attributes;
+
+/* Macro to access underlying structure of a PackfileSegment PMC. */
+#define PARROT_PACKFILESEGMENT(o) ((Parrot_PackfileSegment_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'directory' attribute of PackfileSegment PMC. */
+#define GETATTR_PackfileSegment_directory(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PackfileSegment_attributes *)PMC_data(pmc))->directory; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "directory")); \
+        } \
+    } while (0)
+#define SETATTR_PackfileSegment_directory(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "directory"), value); \
+        } \
+        else \
+            ((Parrot_PackfileSegment_attributes *)PMC_data(pmc))->directory = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_PACKFILESEGMENT_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
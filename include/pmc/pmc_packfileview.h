@@ -0,0 +1,115 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/packfileview.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_PACKFILEVIEW_H_GUARD
+#define PARROT_PMC_PACKFILEVIEW_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_PackfileView_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_PackfileView_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_PackfileView_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_PackfileView_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_PackfileView_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_PackfileView_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* PackfileView PMC's underlying struct. */
+typedef struct Parrot_PackfileView_attributes {
+    PackFile * pf;
+    STRING * path;
+    PMC * called_tags;
+} Parrot_PackfileView_attributes;
+
+/* Macro to access underlying structure of a PackfileView PMC. */
+#define PARROT_PACKFILEVIEW(o) ((Parrot_PackfileView_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'pf' attribute of PackfileView PMC. */
+#define GETATTR_PackfileView_pf(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PackfileView_attributes *)PMC_data(pmc))->pf; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'PackFile *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_PackfileView_pf(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'PackFile *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_PackfileView_attributes *)PMC_data(pmc))->pf = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'path' attribute of PackfileView PMC. */
+#define GETATTR_PackfileView_path(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PackfileView_attributes *)PMC_data(pmc))->path; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "path")); \
+            (dest) =  (PMC_IS_NULL(attr_value) ? (STRING *)NULL : VTABLE_get_string(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_PackfileView_path(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new(interp, enum_class_String); \
+            VTABLE_set_string_native(interp, attr_value, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "path"), attr_value); \
+        } \
+        else \
+            ((Parrot_PackfileView_attributes *)PMC_data(pmc))->path = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'called_tags' attribute of PackfileView PMC. */
+#define GETATTR_PackfileView_called_tags(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PackfileView_attributes *)PMC_data(pmc))->called_tags; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "called_tags")); \
+        } \
+    } while (0)
+#define SETATTR_PackfileView_called_tags(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "called_tags"), value); \
+        } \
+        else \
+            ((Parrot_PackfileView_attributes *)PMC_data(pmc))->called_tags = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_PACKFILEVIEW_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
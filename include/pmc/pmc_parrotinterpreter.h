@@ -0,0 +1,137 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/parrotinterpreter.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_PARROTINTERPRETER_H_GUARD
+#define PARROT_PMC_PARROTINTERPRETER_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_ParrotInterpreter_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_ParrotInterpreter_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_ParrotInterpreter_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_ParrotInterpreter_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_ParrotInterpreter_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_ParrotInterpreter_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* ParrotInterpreter PMC's underlying struct. */
+typedef struct Parrot_ParrotInterpreter_attributes {
+    struct parrot_interp_t * interp;
+    INTVAL tid;
+    PMC                    * args;
+    PMC                    * sub;
+} Parrot_ParrotInterpreter_attributes;
+
+/* Macro to access underlying structure of a ParrotInterpreter PMC. */
+#define PARROT_PARROTINTERPRETER(o) ((Parrot_ParrotInterpreter_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'interp' attribute of ParrotInterpreter PMC. */
+#define GETATTR_ParrotInterpreter_interp(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ParrotInterpreter_attributes *)PMC_data(pmc))->interp; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'struct parrot_interp_t *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_ParrotInterpreter_interp(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'struct parrot_interp_t *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_ParrotInterpreter_attributes *)PMC_data(pmc))->interp = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'tid' attribute of ParrotInterpreter PMC. */
+#define GETATTR_ParrotInterpreter_tid(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ParrotInterpreter_attributes *)PMC_data(pmc))->tid; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "tid")); \
+            (dest) = (PMC_IS_NULL(attr_value) ? (INTVAL) 0: VTABLE_get_integer(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_ParrotInterpreter_tid(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new_init_int(interp, enum_class_Integer, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "tid"), attr_value); \
+        } \
+        else \
+            ((Parrot_ParrotInterpreter_attributes *)PMC_data(pmc))->tid = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'args' attribute of ParrotInterpreter PMC. */
+#define GETATTR_ParrotInterpreter_args(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ParrotInterpreter_attributes *)PMC_data(pmc))->args; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "args")); \
+        } \
+    } while (0)
+#define SETATTR_ParrotInterpreter_args(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "args"), value); \
+        } \
+        else \
+            ((Parrot_ParrotInterpreter_attributes *)PMC_data(pmc))->args = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'sub' attribute of ParrotInterpreter PMC. */
+#define GETATTR_ParrotInterpreter_sub(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ParrotInterpreter_attributes *)PMC_data(pmc))->sub; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "sub")); \
+        } \
+    } while (0)
+#define SETATTR_ParrotInterpreter_sub(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "sub"), value); \
+        } \
+        else \
+            ((Parrot_ParrotInterpreter_attributes *)PMC_data(pmc))->sub = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_PARROTINTERPRETER_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
@@ -0,0 +1,91 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/parrotlibrary.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_PARROTLIBRARY_H_GUARD
+#define PARROT_PMC_PARROTLIBRARY_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_ParrotLibrary_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_ParrotLibrary_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_ParrotLibrary_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_ParrotLibrary_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_ParrotLibrary_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_ParrotLibrary_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* ParrotLibrary PMC's underlying struct. */
+typedef struct Parrot_ParrotLibrary_attributes {
+    void * dl_handle;
+    void * oplib_init;
+} Parrot_ParrotLibrary_attributes;
+
+/* Macro to access underlying structure of a ParrotLibrary PMC. */
+#define PARROT_PARROTLIBRARY(o) ((Parrot_ParrotLibrary_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'dl_handle' attribute of ParrotLibrary PMC. */
+#define GETATTR_ParrotLibrary_dl_handle(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ParrotLibrary_attributes *)PMC_data(pmc))->dl_handle; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'void *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_ParrotLibrary_dl_handle(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'void *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_ParrotLibrary_attributes *)PMC_data(pmc))->dl_handle = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'oplib_init' attribute of ParrotLibrary PMC. */
+#define GETATTR_ParrotLibrary_oplib_init(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ParrotLibrary_attributes *)PMC_data(pmc))->oplib_init; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'void *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_ParrotLibrary_oplib_init(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'void *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_ParrotLibrary_attributes *)PMC_data(pmc))->oplib_init = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_PARROTLIBRARY_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
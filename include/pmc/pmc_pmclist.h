@@ -0,0 +1,120 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/pmclist.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_PMCLIST_H_GUARD
+#define PARROT_PMC_PMCLIST_H_GUARD
+
+PARROT_EXPORT
+void
+Parrot_pmc_list_insert_by_number(PARROT_INTERP, PMC *list, PMC *value);
+
+PARROT_EXPORT VTABLE* Parrot_PMCList_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_PMCList_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_PMCList_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_PMCList_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_PMCList_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_PMCList_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* PMCList PMC's underlying struct. */
+typedef struct Parrot_PMCList_attributes {
+    void * head;
+    void * foot;
+    INTVAL size;
+} Parrot_PMCList_attributes;
+
+/* Macro to access underlying structure of a PMCList PMC. */
+#define PARROT_PMCLIST(o) ((Parrot_PMCList_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'head' attribute of PMCList PMC. */
+#define GETATTR_PMCList_head(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PMCList_attributes *)PMC_data(pmc))->head; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'void *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_PMCList_head(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'void *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_PMCList_attributes *)PMC_data(pmc))->head = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'foot' attribute of PMCList PMC. */
+#define GETATTR_PMCList_foot(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PMCList_attributes *)PMC_data(pmc))->foot; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'void *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_PMCList_foot(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'void *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_PMCList_attributes *)PMC_data(pmc))->foot = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'size' attribute of PMCList PMC. */
+#define GETATTR_PMCList_size(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PMCList_attributes *)PMC_data(pmc))->size; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "size")); \
+            (dest) = (PMC_IS_NULL(attr_value) ? (INTVAL) 0: VTABLE_get_integer(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_PMCList_size(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new_init_int(interp, enum_class_Integer, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "size"), attr_value); \
+        } \
+        else \
+            ((Parrot_PMCList_attributes *)PMC_data(pmc))->size = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_PMCLIST_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
@@ -0,0 +1,495 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/pmcproxy.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_PMCPROXY_H_GUARD
+#define PARROT_PMC_PMCPROXY_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_PMCProxy_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_PMCProxy_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_PMCProxy_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_PMCProxy_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_PMCProxy_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_PMCProxy_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* PMCProxy PMC's underlying struct. */
+typedef struct Parrot_PMCProxy_attributes {
+    INTVAL id;
+    STRING * name;
+    STRING * fullname;
+    PMC * _namespace;
+    INTVAL instantiated;
+    PMC * parents;
+    PMC * all_parents;
+    PMC * roles;
+    PMC * methods;
+    PMC * vtable_overrides;
+    PMC * attrib_metadata;
+    PMC * attrib_index;
+    PMC * attrib_cache;
+    STRING * attrib_kinds;
+    UINTVAL shape;
+    PMC * resolve_method;
+    PMC  * parent_overrides;
+    PMC  * meth_cache;
+    Hash * isa_cache;
+} Parrot_PMCProxy_attributes;
+
+/* Macro to access underlying structure of a PMCProxy PMC. */
+#define PARROT_PMCPROXY(o) ((Parrot_PMCProxy_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'id' attribute of PMCProxy PMC. */
+#define GETATTR_PMCProxy_id(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PMCProxy_attributes *)PMC_data(pmc))->id; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "id")); \
+            (dest) = (PMC_IS_NULL(attr_value) ? (INTVAL) 0: VTABLE_get_integer(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_PMCProxy_id(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new_init_int(interp, enum_class_Integer, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "id"), attr_value); \
+        } \
+        else \
+            ((Parrot_PMCProxy_attributes *)PMC_data(pmc))->id = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'name' attribute of PMCProxy PMC. */
+#define GETATTR_PMCProxy_name(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PMCProxy_attributes *)PMC_data(pmc))->name; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "name")); \
+            (dest) =  (PMC_IS_NULL(attr_value) ? (STRING *)NULL : VTABLE_get_string(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_PMCProxy_name(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new(interp, enum_class_String); \
+            VTABLE_set_string_native(interp, attr_value, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "name"), attr_value); \
+        } \
+        else \
+            ((Parrot_PMCProxy_attributes *)PMC_data(pmc))->name = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'fullname' attribute of PMCProxy PMC. */
+#define GETATTR_PMCProxy_fullname(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PMCProxy_attributes *)PMC_data(pmc))->fullname; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "fullname")); \
+            (dest) =  (PMC_IS_NULL(attr_value) ? (STRING *)NULL : VTABLE_get_string(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_PMCProxy_fullname(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new(interp, enum_class_String); \
+            VTABLE_set_string_native(interp, attr_value, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "fullname"), attr_value); \
+        } \
+        else \
+            ((Parrot_PMCProxy_attributes *)PMC_data(pmc))->fullname = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for '_namespace' attribute of PMCProxy PMC. */
+#define GETATTR_PMCProxy__namespace(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PMCProxy_attributes *)PMC_data(pmc))->_namespace; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "_namespace")); \
+        } \
+    } while (0)
+#define SETATTR_PMCProxy__namespace(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "_namespace"), value); \
+        } \
+        else \
+            ((Parrot_PMCProxy_attributes *)PMC_data(pmc))->_namespace = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'instantiated' attribute of PMCProxy PMC. */
+#define GETATTR_PMCProxy_instantiated(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PMCProxy_attributes *)PMC_data(pmc))->instantiated; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "instantiated")); \
+            (dest) = (PMC_IS_NULL(attr_value) ? (INTVAL) 0: VTABLE_get_integer(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_PMCProxy_instantiated(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new_init_int(interp, enum_class_Integer, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "instantiated"), attr_value); \
+        } \
+        else \
+            ((Parrot_PMCProxy_attributes *)PMC_data(pmc))->instantiated = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'parents' attribute of PMCProxy PMC. */
+#define GETATTR_PMCProxy_parents(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PMCProxy_attributes *)PMC_data(pmc))->parents; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "parents")); \
+        } \
+    } while (0)
+#define SETATTR_PMCProxy_parents(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "parents"), value); \
+        } \
+        else \
+            ((Parrot_PMCProxy_attributes *)PMC_data(pmc))->parents = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'all_parents' attribute of PMCProxy PMC. */
+#define GETATTR_PMCProxy_all_parents(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PMCProxy_attributes *)PMC_data(pmc))->all_parents; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "all_parents")); \
+        } \
+    } while (0)
+#define SETATTR_PMCProxy_all_parents(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "all_parents"), value); \
+        } \
+        else \
+            ((Parrot_PMCProxy_attributes *)PMC_data(pmc))->all_parents = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'roles' attribute of PMCProxy PMC. */
+#define GETATTR_PMCProxy_roles(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PMCProxy_attributes *)PMC_data(pmc))->roles; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "roles")); \
+        } \
+    } while (0)
+#define SETATTR_PMCProxy_roles(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "roles"), value); \
+        } \
+        else \
+            ((Parrot_PMCProxy_attributes *)PMC_data(pmc))->roles = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'methods' attribute of PMCProxy PMC. */
+#define GETATTR_PMCProxy_methods(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PMCProxy_attributes *)PMC_data(pmc))->methods; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "methods")); \
+        } \
+    } while (0)
+#define SETATTR_PMCProxy_methods(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "methods"), value); \
+        } \
+        else \
+            ((Parrot_PMCProxy_attributes *)PMC_data(pmc))->methods = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'vtable_overrides' attribute of PMCProxy PMC. */
+#define GETATTR_PMCProxy_vtable_overrides(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PMCProxy_attributes *)PMC_data(pmc))->vtable_overrides; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "vtable_overrides")); \
+        } \
+    } while (0)
+#define SETATTR_PMCProxy_vtable_overrides(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "vtable_overrides"), value); \
+        } \
+        else \
+            ((Parrot_PMCProxy_attributes *)PMC_data(pmc))->vtable_overrides = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'attrib_metadata' attribute of PMCProxy PMC. */
+#define GETATTR_PMCProxy_attrib_metadata(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PMCProxy_attributes *)PMC_data(pmc))->attrib_metadata; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "attrib_metadata")); \
+        } \
+    } while (0)
+#define SETATTR_PMCProxy_attrib_metadata(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "attrib_metadata"), value); \
+        } \
+        else \
+            ((Parrot_PMCProxy_attributes *)PMC_data(pmc))->attrib_metadata = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'attrib_index' attribute of PMCProxy PMC. */
+#define GETATTR_PMCProxy_attrib_index(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PMCProxy_attributes *)PMC_data(pmc))->attrib_index; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "attrib_index")); \
+        } \
+    } while (0)
+#define SETATTR_PMCProxy_attrib_index(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "attrib_index"), value); \
+        } \
+        else \
+            ((Parrot_PMCProxy_attributes *)PMC_data(pmc))->attrib_index = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'attrib_cache' attribute of PMCProxy PMC. */
+#define GETATTR_PMCProxy_attrib_cache(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PMCProxy_attributes *)PMC_data(pmc))->attrib_cache; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "attrib_cache")); \
+        } \
+    } while (0)
+#define SETATTR_PMCProxy_attrib_cache(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "attrib_cache"), value); \
+        } \
+        else \
+            ((Parrot_PMCProxy_attributes *)PMC_data(pmc))->attrib_cache = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'attrib_kinds' attribute of PMCProxy PMC. */
+#define GETATTR_PMCProxy_attrib_kinds(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PMCProxy_attributes *)PMC_data(pmc))->attrib_kinds; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "attrib_kinds")); \
+            (dest) =  (PMC_IS_NULL(attr_value) ? (STRING *)NULL : VTABLE_get_string(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_PMCProxy_attrib_kinds(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new(interp, enum_class_String); \
+            VTABLE_set_string_native(interp, attr_value, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "attrib_kinds"), attr_value); \
+        } \
+        else \
+            ((Parrot_PMCProxy_attributes *)PMC_data(pmc))->attrib_kinds = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'shape' attribute of PMCProxy PMC. */
+#define GETATTR_PMCProxy_shape(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PMCProxy_attributes *)PMC_data(pmc))->shape; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'UINTVAL' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_PMCProxy_shape(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'UINTVAL' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_PMCProxy_attributes *)PMC_data(pmc))->shape = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'resolve_method' attribute of PMCProxy PMC. */
+#define GETATTR_PMCProxy_resolve_method(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PMCProxy_attributes *)PMC_data(pmc))->resolve_method; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "resolve_method")); \
+        } \
+    } while (0)
+#define SETATTR_PMCProxy_resolve_method(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "resolve_method"), value); \
+        } \
+        else \
+            ((Parrot_PMCProxy_attributes *)PMC_data(pmc))->resolve_method = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'parent_overrides' attribute of PMCProxy PMC. */
+#define GETATTR_PMCProxy_parent_overrides(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PMCProxy_attributes *)PMC_data(pmc))->parent_overrides; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "parent_overrides")); \
+        } \
+    } while (0)
+#define SETATTR_PMCProxy_parent_overrides(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "parent_overrides"), value); \
+        } \
+        else \
+            ((Parrot_PMCProxy_attributes *)PMC_data(pmc))->parent_overrides = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'meth_cache' attribute of PMCProxy PMC. */
+#define GETATTR_PMCProxy_meth_cache(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PMCProxy_attributes *)PMC_data(pmc))->meth_cache; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "meth_cache")); \
+        } \
+    } while (0)
+#define SETATTR_PMCProxy_meth_cache(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "meth_cache"), value); \
+        } \
+        else \
+            ((Parrot_PMCProxy_attributes *)PMC_data(pmc))->meth_cache = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'isa_cache' attribute of PMCProxy PMC. */
+#define GETATTR_PMCProxy_isa_cache(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PMCProxy_attributes *)PMC_data(pmc))->isa_cache; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'Hash *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_PMCProxy_isa_cache(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'Hash *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_PMCProxy_attributes *)PMC_data(pmc))->isa_cache = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_PMCPROXY_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
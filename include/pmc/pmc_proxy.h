@@ -0,0 +1,89 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/proxy.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_PROXY_H_GUARD
+#define PARROT_PMC_PROXY_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_Proxy_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_Proxy_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_Proxy_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_Proxy_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_Proxy_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_Proxy_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* Proxy PMC's underlying struct. */
+typedef struct Parrot_Proxy_attributes {
+    PMC          * target;
+    Parrot_Interp interp;
+} Parrot_Proxy_attributes;
+
+/* Macro to access underlying structure of a Proxy PMC. */
+#define PARROT_PROXY(o) ((Parrot_Proxy_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'target' attribute of Proxy PMC. */
+#define GETATTR_Proxy_target(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Proxy_attributes *)PMC_data(pmc))->target; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "target")); \
+        } \
+    } while (0)
+#define SETATTR_Proxy_target(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "target"), value); \
+        } \
+        else \
+            ((Parrot_Proxy_attributes *)PMC_data(pmc))->target = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'interp' attribute of Proxy PMC. */
+#define GETATTR_Proxy_interp(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Proxy_attributes *)PMC_data(pmc))->interp; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'Parrot_Interp' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_Proxy_interp(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'Parrot_Interp' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_Proxy_attributes *)PMC_data(pmc))->interp = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_PROXY_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
@@ -0,0 +1,69 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/ptr.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_PTR_H_GUARD
+#define PARROT_PMC_PTR_H_GUARD
+
+#define PTR_FAT_TEST(i, s)  PObj_flag_TEST(private1, (s))
+#define PTR_FAT_SET(i, s)   PObj_flag_SET(private1, (s))
+#define PTR_FAT_CLEAR(i, s) PObj_flag_CLEAR(private1, (s))
+PARROT_EXPORT VTABLE* Parrot_Ptr_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_Ptr_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_Ptr_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_Ptr_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_Ptr_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_Ptr_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* Ptr PMC's underlying struct. */
+typedef struct Parrot_Ptr_attributes {
+    void * ptr;
+} Parrot_Ptr_attributes;
+
+/* Macro to access underlying structure of a Ptr PMC. */
+#define PARROT_PTR(o) ((Parrot_Ptr_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'ptr' attribute of Ptr PMC. */
+#define GETATTR_Ptr_ptr(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Ptr_attributes *)PMC_data(pmc))->ptr; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'void *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_Ptr_ptr(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'void *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_Ptr_attributes *)PMC_data(pmc))->ptr = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_PTR_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
@@ -0,0 +1,91 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/ptrbuf.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_PTRBUF_H_GUARD
+#define PARROT_PMC_PTRBUF_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_PtrBuf_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_PtrBuf_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_PtrBuf_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_PtrBuf_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_PtrBuf_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_PtrBuf_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* PtrBuf PMC's underlying struct. */
+typedef struct Parrot_PtrBuf_attributes {
+    void * ptr;
+    UINTVAL size;
+} Parrot_PtrBuf_attributes;
+
+/* Macro to access underlying structure of a PtrBuf PMC. */
+#define PARROT_PTRBUF(o) ((Parrot_PtrBuf_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'ptr' attribute of PtrBuf PMC. */
+#define GETATTR_PtrBuf_ptr(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PtrBuf_attributes *)PMC_data(pmc))->ptr; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'void *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_PtrBuf_ptr(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'void *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_PtrBuf_attributes *)PMC_data(pmc))->ptr = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'size' attribute of PtrBuf PMC. */
+#define GETATTR_PtrBuf_size(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_PtrBuf_attributes *)PMC_data(pmc))->size; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'UINTVAL' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_PtrBuf_size(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'UINTVAL' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_PtrBuf_attributes *)PMC_data(pmc))->size = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_PTRBUF_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
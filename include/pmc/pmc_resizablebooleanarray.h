@@ -0,0 +1,116 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/resizablebooleanarray.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_RESIZABLEBOOLEANARRAY_H_GUARD
+#define PARROT_PMC_RESIZABLEBOOLEANARRAY_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_ResizableBooleanArray_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_ResizableBooleanArray_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_ResizableBooleanArray_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_ResizableBooleanArray_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_ResizableBooleanArray_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_ResizableBooleanArray_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* ResizableBooleanArray PMC's underlying struct. */
+typedef struct Parrot_ResizableBooleanArray_attributes {
+    UINTVAL size;
+    UINTVAL resize_threshold;
+    unsigned char * bit_array;
+} Parrot_ResizableBooleanArray_attributes;
+
+/* Macro to access underlying structure of a ResizableBooleanArray PMC. */
+#define PARROT_RESIZABLEBOOLEANARRAY(o) ((Parrot_ResizableBooleanArray_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'size' attribute of ResizableBooleanArray PMC. */
+#define GETATTR_ResizableBooleanArray_size(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ResizableBooleanArray_attributes *)PMC_data(pmc))->size; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'UINTVAL' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_ResizableBooleanArray_size(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'UINTVAL' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_ResizableBooleanArray_attributes *)PMC_data(pmc))->size = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'resize_threshold' attribute of ResizableBooleanArray PMC. */
+#define GETATTR_ResizableBooleanArray_resize_threshold(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ResizableBooleanArray_attributes *)PMC_data(pmc))->resize_threshold; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'UINTVAL' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_ResizableBooleanArray_resize_threshold(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'UINTVAL' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_ResizableBooleanArray_attributes *)PMC_data(pmc))->resize_threshold = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'bit_array' attribute of ResizableBooleanArray PMC. */
+#define GETATTR_ResizableBooleanArray_bit_array(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ResizableBooleanArray_attributes *)PMC_data(pmc))->bit_array; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'unsigned char *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_ResizableBooleanArray_bit_array(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'unsigned char *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_ResizableBooleanArray_attributes *)PMC_data(pmc))->bit_array = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_RESIZABLEBOOLEANARRAY_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
@@ -0,0 +1,116 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/resizablepmcarray.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_RESIZABLEPMCARRAY_H_GUARD
+#define PARROT_PMC_RESIZABLEPMCARRAY_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_ResizablePMCArray_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_ResizablePMCArray_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_ResizablePMCArray_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_ResizablePMCArray_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_ResizablePMCArray_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_ResizablePMCArray_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* ResizablePMCArray PMC's underlying struct. */
+typedef struct Parrot_ResizablePMCArray_attributes {
+    INTVAL size;
+    PMC    ** pmc_array;
+    INTVAL resize_threshold;
+} Parrot_ResizablePMCArray_attributes;
+
+/* Macro to access underlying structure of a ResizablePMCArray PMC. */
+#define PARROT_RESIZABLEPMCARRAY(o) ((Parrot_ResizablePMCArray_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'size' attribute of ResizablePMCArray PMC. */
+#define GETATTR_ResizablePMCArray_size(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ResizablePMCArray_attributes *)PMC_data(pmc))->size; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "size")); \
+            (dest) = (PMC_IS_NULL(attr_value) ? (INTVAL) 0: VTABLE_get_integer(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_ResizablePMCArray_size(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new_init_int(interp, enum_class_Integer, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "size"), attr_value); \
+        } \
+        else \
+            ((Parrot_ResizablePMCArray_attributes *)PMC_data(pmc))->size = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'pmc_array' attribute of ResizablePMCArray PMC. */
+#define GETATTR_ResizablePMCArray_pmc_array(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ResizablePMCArray_attributes *)PMC_data(pmc))->pmc_array; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'PMC    **' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_ResizablePMCArray_pmc_array(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'PMC    **' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_ResizablePMCArray_attributes *)PMC_data(pmc))->pmc_array = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'resize_threshold' attribute of ResizablePMCArray PMC. */
+#define GETATTR_ResizablePMCArray_resize_threshold(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_ResizablePMCArray_attributes *)PMC_data(pmc))->resize_threshold; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "resize_threshold")); \
+            (dest) = (PMC_IS_NULL(attr_value) ? (INTVAL) 0: VTABLE_get_integer(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_ResizablePMCArray_resize_threshold(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new_init_int(interp, enum_class_Integer, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "resize_threshold"), attr_value); \
+        } \
+        else \
+            ((Parrot_ResizablePMCArray_attributes *)PMC_data(pmc))->resize_threshold = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_RESIZABLEPMCARRAY_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
@@ -0,0 +1,159 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/role.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_ROLE_H_GUARD
+#define PARROT_PMC_ROLE_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_Role_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_Role_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_Role_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_Role_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_Role_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_Role_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* Role PMC's underlying struct. */
+typedef struct Parrot_Role_attributes {
+    STRING * name;
+    PMC    * _namespace;
+    PMC    * roles;
+    PMC    * methods;
+    PMC    * attrib_metadata;
+} Parrot_Role_attributes;
+
+/* Macro to access underlying structure of a Role PMC. */
+#define PARROT_ROLE(o) ((Parrot_Role_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'name' attribute of Role PMC. */
+#define GETATTR_Role_name(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Role_attributes *)PMC_data(pmc))->name; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "name")); \
+            (dest) =  (PMC_IS_NULL(attr_value) ? (STRING *)NULL : VTABLE_get_string(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_Role_name(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new(interp, enum_class_String); \
+            VTABLE_set_string_native(interp, attr_value, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "name"), attr_value); \
+        } \
+        else \
+            ((Parrot_Role_attributes *)PMC_data(pmc))->name = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for '_namespace' attribute of Role PMC. */
+#define GETATTR_Role__namespace(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Role_attributes *)PMC_data(pmc))->_namespace; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "_namespace")); \
+        } \
+    } while (0)
+#define SETATTR_Role__namespace(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "_namespace"), value); \
+        } \
+        else \
+            ((Parrot_Role_attributes *)PMC_data(pmc))->_namespace = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'roles' attribute of Role PMC. */
+#define GETATTR_Role_roles(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Role_attributes *)PMC_data(pmc))->roles; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "roles")); \
+        } \
+    } while (0)
+#define SETATTR_Role_roles(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "roles"), value); \
+        } \
+        else \
+            ((Parrot_Role_attributes *)PMC_data(pmc))->roles = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'methods' attribute of Role PMC. */
+#define GETATTR_Role_methods(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Role_attributes *)PMC_data(pmc))->methods; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "methods")); \
+        } \
+    } while (0)
+#define SETATTR_Role_methods(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "methods"), value); \
+        } \
+        else \
+            ((Parrot_Role_attributes *)PMC_data(pmc))->methods = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'attrib_metadata' attribute of Role PMC. */
+#define GETATTR_Role_attrib_metadata(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Role_attributes *)PMC_data(pmc))->attrib_metadata; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "attrib_metadata")); \
+        } \
+    } while (0)
+#define SETATTR_Role_attrib_metadata(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "attrib_metadata"), value); \
+        } \
+        else \
+            ((Parrot_Role_attributes *)PMC_data(pmc))->attrib_metadata = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_ROLE_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
@@ -0,0 +1,166 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/sockaddr.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_SOCKADDR_H_GUARD
+#define PARROT_PMC_SOCKADDR_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_Sockaddr_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_Sockaddr_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_Sockaddr_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_Sockaddr_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_Sockaddr_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_Sockaddr_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* Sockaddr PMC's underlying struct. */
+typedef struct Parrot_Sockaddr_attributes {
+    INTVAL family;
+    INTVAL type;
+    INTVAL protocol;
+    INTVAL len;
+    void   * pointer;
+} Parrot_Sockaddr_attributes;
+
+/* Macro to access underlying structure of a Sockaddr PMC. */
+#define PARROT_SOCKADDR(o) ((Parrot_Sockaddr_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'family' attribute of Sockaddr PMC. */
+#define GETATTR_Sockaddr_family(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Sockaddr_attributes *)PMC_data(pmc))->family; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "family")); \
+            (dest) = (PMC_IS_NULL(attr_value) ? (INTVAL) 0: VTABLE_get_integer(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_Sockaddr_family(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new_init_int(interp, enum_class_Integer, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "family"), attr_value); \
+        } \
+        else \
+            ((Parrot_Sockaddr_attributes *)PMC_data(pmc))->family = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'type' attribute of Sockaddr PMC. */
+#define GETATTR_Sockaddr_type(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Sockaddr_attributes *)PMC_data(pmc))->type; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "type")); \
+            (dest) = (PMC_IS_NULL(attr_value) ? (INTVAL) 0: VTABLE_get_integer(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_Sockaddr_type(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new_init_int(interp, enum_class_Integer, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "type"), attr_value); \
+        } \
+        else \
+            ((Parrot_Sockaddr_attributes *)PMC_data(pmc))->type = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'protocol' attribute of Sockaddr PMC. */
+#define GETATTR_Sockaddr_protocol(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Sockaddr_attributes *)PMC_data(pmc))->protocol; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "protocol")); \
+            (dest) = (PMC_IS_NULL(attr_value) ? (INTVAL) 0: VTABLE_get_integer(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_Sockaddr_protocol(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new_init_int(interp, enum_class_Integer, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "protocol"), attr_value); \
+        } \
+        else \
+            ((Parrot_Sockaddr_attributes *)PMC_data(pmc))->protocol = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'len' attribute of Sockaddr PMC. */
+#define GETATTR_Sockaddr_len(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Sockaddr_attributes *)PMC_data(pmc))->len; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "len")); \
+            (dest) = (PMC_IS_NULL(attr_value) ? (INTVAL) 0: VTABLE_get_integer(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_Sockaddr_len(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new_init_int(interp, enum_class_Integer, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "len"), attr_value); \
+        } \
+        else \
+            ((Parrot_Sockaddr_attributes *)PMC_data(pmc))->len = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'pointer' attribute of Sockaddr PMC. */
+#define GETATTR_Sockaddr_pointer(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Sockaddr_attributes *)PMC_data(pmc))->pointer; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'void   *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_Sockaddr_pointer(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'void   *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_Sockaddr_attributes *)PMC_data(pmc))->pointer = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_SOCKADDR_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
@@ -0,0 +1,67 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/string.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_STRING_H_GUARD
+#define PARROT_PMC_STRING_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_String_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_String_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_String_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_String_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_String_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_String_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* String PMC's underlying struct. */
+typedef struct Parrot_String_attributes {
+    STRING * str_val;
+} Parrot_String_attributes;
+
+/* Macro to access underlying structure of a String PMC. */
+#define PARROT_STRING(o) ((Parrot_String_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'str_val' attribute of String PMC. */
+#define GETATTR_String_str_val(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_String_attributes *)PMC_data(pmc))->str_val; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "str_val")); \
+            (dest) =  (PMC_IS_NULL(attr_value) ? (STRING *)NULL : VTABLE_get_string(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_String_str_val(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new(interp, enum_class_String); \
+            VTABLE_set_string_native(interp, attr_value, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "str_val"), attr_value); \
+        } \
+        else \
+            ((Parrot_String_attributes *)PMC_data(pmc))->str_val = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_STRING_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
@@ -0,0 +1,242 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/stringbuilder.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_STRINGBUILDER_H_GUARD
+#define PARROT_PMC_STRINGBUILDER_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_StringBuilder_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_StringBuilder_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_StringBuilder_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_StringBuilder_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_StringBuilder_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_StringBuilder_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* StringBuilder PMC's underlying struct. */
+typedef struct Parrot_StringBuilder_attributes {
+    STRING  * buffer;
+    STRING ** chunks;
+    INTVAL chunk_count;
+    INTVAL chunk_slots;
+    INTVAL chunk_threshold;
+    INTVAL chunk_encoding;
+    UINTVAL chunk_bytes;
+    UINTVAL chunk_chars;
+} Parrot_StringBuilder_attributes;
+
+/* Macro to access underlying structure of a StringBuilder PMC. */
+#define PARROT_STRINGBUILDER(o) ((Parrot_StringBuilder_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'buffer' attribute of StringBuilder PMC. */
+#define GETATTR_StringBuilder_buffer(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_StringBuilder_attributes *)PMC_data(pmc))->buffer; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "buffer")); \
+            (dest) =  (PMC_IS_NULL(attr_value) ? (STRING *)NULL : VTABLE_get_string(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_StringBuilder_buffer(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new(interp, enum_class_String); \
+            VTABLE_set_string_native(interp, attr_value, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "buffer"), attr_value); \
+        } \
+        else \
+            ((Parrot_StringBuilder_attributes *)PMC_data(pmc))->buffer = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'chunks' attribute of StringBuilder PMC. */
+#define GETATTR_StringBuilder_chunks(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_StringBuilder_attributes *)PMC_data(pmc))->chunks; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'STRING **' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_StringBuilder_chunks(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'STRING **' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_StringBuilder_attributes *)PMC_data(pmc))->chunks = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'chunk_count' attribute of StringBuilder PMC. */
+#define GETATTR_StringBuilder_chunk_count(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_StringBuilder_attributes *)PMC_data(pmc))->chunk_count; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "chunk_count")); \
+            (dest) = (PMC_IS_NULL(attr_value) ? (INTVAL) 0: VTABLE_get_integer(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_StringBuilder_chunk_count(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new_init_int(interp, enum_class_Integer, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "chunk_count"), attr_value); \
+        } \
+        else \
+            ((Parrot_StringBuilder_attributes *)PMC_data(pmc))->chunk_count = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'chunk_slots' attribute of StringBuilder PMC. */
+#define GETATTR_StringBuilder_chunk_slots(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_StringBuilder_attributes *)PMC_data(pmc))->chunk_slots; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "chunk_slots")); \
+            (dest) = (PMC_IS_NULL(attr_value) ? (INTVAL) 0: VTABLE_get_integer(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_StringBuilder_chunk_slots(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new_init_int(interp, enum_class_Integer, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "chunk_slots"), attr_value); \
+        } \
+        else \
+            ((Parrot_StringBuilder_attributes *)PMC_data(pmc))->chunk_slots = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'chunk_threshold' attribute of StringBuilder PMC. */
+#define GETATTR_StringBuilder_chunk_threshold(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_StringBuilder_attributes *)PMC_data(pmc))->chunk_threshold; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "chunk_threshold")); \
+            (dest) = (PMC_IS_NULL(attr_value) ? (INTVAL) 0: VTABLE_get_integer(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_StringBuilder_chunk_threshold(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new_init_int(interp, enum_class_Integer, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "chunk_threshold"), attr_value); \
+        } \
+        else \
+            ((Parrot_StringBuilder_attributes *)PMC_data(pmc))->chunk_threshold = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'chunk_encoding' attribute of StringBuilder PMC. */
+#define GETATTR_StringBuilder_chunk_encoding(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_StringBuilder_attributes *)PMC_data(pmc))->chunk_encoding; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "chunk_encoding")); \
+            (dest) = (PMC_IS_NULL(attr_value) ? (INTVAL) 0: VTABLE_get_integer(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_StringBuilder_chunk_encoding(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new_init_int(interp, enum_class_Integer, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "chunk_encoding"), attr_value); \
+        } \
+        else \
+            ((Parrot_StringBuilder_attributes *)PMC_data(pmc))->chunk_encoding = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'chunk_bytes' attribute of StringBuilder PMC. */
+#define GETATTR_StringBuilder_chunk_bytes(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_StringBuilder_attributes *)PMC_data(pmc))->chunk_bytes; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'UINTVAL' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_StringBuilder_chunk_bytes(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'UINTVAL' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_StringBuilder_attributes *)PMC_data(pmc))->chunk_bytes = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'chunk_chars' attribute of StringBuilder PMC. */
+#define GETATTR_StringBuilder_chunk_chars(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_StringBuilder_attributes *)PMC_data(pmc))->chunk_chars; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'UINTVAL' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_StringBuilder_chunk_chars(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'UINTVAL' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_StringBuilder_attributes *)PMC_data(pmc))->chunk_chars = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_STRINGBUILDER_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
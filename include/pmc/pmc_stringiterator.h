@@ -0,0 +1,117 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/stringiterator.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_STRINGITERATOR_H_GUARD
+#define PARROT_PMC_STRINGITERATOR_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_StringIterator_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_StringIterator_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_StringIterator_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_StringIterator_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_StringIterator_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_StringIterator_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* StringIterator PMC's underlying struct. */
+typedef struct Parrot_StringIterator_attributes {
+    STRING      * str_val;
+    String_iter iter;
+    INTVAL reverse;
+} Parrot_StringIterator_attributes;
+
+/* Macro to access underlying structure of a StringIterator PMC. */
+#define PARROT_STRINGITERATOR(o) ((Parrot_StringIterator_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'str_val' attribute of StringIterator PMC. */
+#define GETATTR_StringIterator_str_val(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_StringIterator_attributes *)PMC_data(pmc))->str_val; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "str_val")); \
+            (dest) =  (PMC_IS_NULL(attr_value) ? (STRING *)NULL : VTABLE_get_string(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_StringIterator_str_val(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new(interp, enum_class_String); \
+            VTABLE_set_string_native(interp, attr_value, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "str_val"), attr_value); \
+        } \
+        else \
+            ((Parrot_StringIterator_attributes *)PMC_data(pmc))->str_val = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'iter' attribute of StringIterator PMC. */
+#define GETATTR_StringIterator_iter(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_StringIterator_attributes *)PMC_data(pmc))->iter; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'String_iter' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_StringIterator_iter(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'String_iter' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_StringIterator_attributes *)PMC_data(pmc))->iter = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'reverse' attribute of StringIterator PMC. */
+#define GETATTR_StringIterator_reverse(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_StringIterator_attributes *)PMC_data(pmc))->reverse; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "reverse")); \
+            (dest) = (PMC_IS_NULL(attr_value) ? (INTVAL) 0: VTABLE_get_integer(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_StringIterator_reverse(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new_init_int(interp, enum_class_Integer, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "reverse"), attr_value); \
+        } \
+        else \
+            ((Parrot_StringIterator_attributes *)PMC_data(pmc))->reverse = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_STRINGITERATOR_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
@@ -0,0 +1,217 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/timer.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_TIMER_H_GUARD
+#define PARROT_PMC_TIMER_H_GUARD
+
+PARROT_EXPORT VTABLE* Parrot_Timer_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_Timer_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_EXPORT VTABLE* Parrot_Timer_get_vtable(PARROT_INTERP);
+PARROT_EXPORT VTABLE* Parrot_Timer_ro_get_vtable(PARROT_INTERP);
+PARROT_EXPORT PMC*    Parrot_Timer_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_EXPORT Hash*   Parrot_Timer_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* Timer PMC's underlying struct. */
+typedef struct Parrot_Timer_attributes {
+    PMC     * code;
+    FLOATVAL birthtime;
+    FLOATVAL duration;
+    FLOATVAL interval;
+    INTVAL repeat;
+    INTVAL started;
+    INTVAL running;
+} Parrot_Timer_attributes;
+
+/* Macro to access underlying structure of a Timer PMC. */
+#define PARROT_TIMER(o) ((Parrot_Timer_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'code' attribute of Timer PMC. */
+#define GETATTR_Timer_code(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Timer_attributes *)PMC_data(pmc))->code; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "code")); \
+        } \
+    } while (0)
+#define SETATTR_Timer_code(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "code"), value); \
+        } \
+        else \
+            ((Parrot_Timer_attributes *)PMC_data(pmc))->code = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'birthtime' attribute of Timer PMC. */
+#define GETATTR_Timer_birthtime(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Timer_attributes *)PMC_data(pmc))->birthtime; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "birthtime")); \
+            (dest) =  (PMC_IS_NULL(attr_value) ? (FLOATVAL) 0.0: VTABLE_get_number(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_Timer_birthtime(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new(interp, enum_class_Float); \
+            VTABLE_set_number_native(interp, attr_value, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "birthtime"), attr_value); \
+        } \
+        else \
+            ((Parrot_Timer_attributes *)PMC_data(pmc))->birthtime = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'duration' attribute of Timer PMC. */
+#define GETATTR_Timer_duration(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Timer_attributes *)PMC_data(pmc))->duration; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "duration")); \
+            (dest) =  (PMC_IS_NULL(attr_value) ? (FLOATVAL) 0.0: VTABLE_get_number(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_Timer_duration(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new(interp, enum_class_Float); \
+            VTABLE_set_number_native(interp, attr_value, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "duration"), attr_value); \
+        } \
+        else \
+            ((Parrot_Timer_attributes *)PMC_data(pmc))->duration = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'interval' attribute of Timer PMC. */
+#define GETATTR_Timer_interval(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Timer_attributes *)PMC_data(pmc))->interval; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "interval")); \
+            (dest) =  (PMC_IS_NULL(attr_value) ? (FLOATVAL) 0.0: VTABLE_get_number(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_Timer_interval(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new(interp, enum_class_Float); \
+            VTABLE_set_number_native(interp, attr_value, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "interval"), attr_value); \
+        } \
+        else \
+            ((Parrot_Timer_attributes *)PMC_data(pmc))->interval = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'repeat' attribute of Timer PMC. */
+#define GETATTR_Timer_repeat(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Timer_attributes *)PMC_data(pmc))->repeat; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "repeat")); \
+            (dest) = (PMC_IS_NULL(attr_value) ? (INTVAL) 0: VTABLE_get_integer(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_Timer_repeat(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new_init_int(interp, enum_class_Integer, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "repeat"), attr_value); \
+        } \
+        else \
+            ((Parrot_Timer_attributes *)PMC_data(pmc))->repeat = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'started' attribute of Timer PMC. */
+#define GETATTR_Timer_started(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Timer_attributes *)PMC_data(pmc))->started; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "started")); \
+            (dest) = (PMC_IS_NULL(attr_value) ? (INTVAL) 0: VTABLE_get_integer(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_Timer_started(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new_init_int(interp, enum_class_Integer, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "started"), attr_value); \
+        } \
+        else \
+            ((Parrot_Timer_attributes *)PMC_data(pmc))->started = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'running' attribute of Timer PMC. */
+#define GETATTR_Timer_running(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Timer_attributes *)PMC_data(pmc))->running; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "running")); \
+            (dest) = (PMC_IS_NULL(attr_value) ? (INTVAL) 0: VTABLE_get_integer(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_Timer_running(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new_init_int(interp, enum_class_Integer, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "running"), attr_value); \
+        } \
+        else \
+            ((Parrot_Timer_attributes *)PMC_data(pmc))->running = (value); \
+    } while (0)
+
+
+#endif /* PARROT_PMC_TIMER_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
@@ -0,0 +1,7131 @@
+# ex: set ro: -*- buffer-read-only:t -*-
+# DO NOT EDIT THIS FILE
+# Generated by gen::config_pm from config/gen/config_pm/Config_pm.in
+
+# Copyright (C) 2002-2009, Parrot Foundation.
+
+=head1 NAME
+
+Parrot::Config::Generated - Parrot Generated Configuration Data
+
+=head1 DESCRIPTION
+
+This file is generated by F<config/gen/config_pm.pm> from
+F<config/gen/config_pm/Config_pm.in>. It contains the C<%PConfig> hash which
+is used by F<lib/Parrot/Config.pm>.
+
+=cut
+
+package Parrot::Config::Generated;
+
+use strict;
+use warnings;
+use vars qw(%PConfig %PConfig_Temp);
+
+
+%PConfig = (
+  'DEVEL' => '-devel',
+  'HASATTRIBUTE_COLD' => 1,
+  'HASATTRIBUTE_CONST' => 1,
+  'HASATTRIBUTE_DEPRECATED' => 1,
+  'HASATTRIBUTE_FORMAT' => 0,
+  'HASATTRIBUTE_HOT' => 1,
+  'HASATTRIBUTE_MALLOC' => 1,
+  'HASATTRIBUTE_NEVER_WORKS' => 0,
+  'HASATTRIBUTE_NONNULL' => 1,
+  'HASATTRIBUTE_NORETURN' => 1,
+  'HASATTRIBUTE_PURE' => 1,
+  'HASATTRIBUTE_UNUSED' => 1,
+  'HASATTRIBUTE_WARN_UNUSED_RESULT' => 1,
+  'HAS_BSD_STAT_EXTN' => 1,
+  'HAS_BUILTIN_EXPECT' => 1,
+  'HAS_C99_SNPRINTF' => 1,
+  'HAS_COMPILER_OFFSETOF_ALIGNOF' => 1,
+  'HAS_CORE_NCI_THUNKS' => 1,
+  'HAS_EXTRA_NCI_THUNKS' => 1,
+  'HAS_GETTEXT' => 1,
+  'HAS_GLUT' => 0,
+  'HAS_GMP' => 1,
+  'HAS_INF_NAN' => 1,
+  'HAS_INT64' => 1,
+  'HAS_IPV6' => 1,
+  'HAS_LABS' => 1,
+  'HAS_LIBFFI' => 1,
+  'HAS_LONGLONG' => 1,
+  'HAS_OPENGL' => 0,
+  'HAS_READLINE' => 1,
+  'HAS_SNPRINTF' => 1,
+  'HAS_STAT_ATIM' => 1,
+  'HAS_STAT_ATIMESPEC' => 0,
+  'HAS_THREADS' => 1,
+  'HAS_TIMESPEC' => 1,
+  'MAJOR' => '6',
+  'MINOR' => '9',
+  'OSNAME_provisional' => 'linux',
+  'PARROT_HAS_DLINFO' => 1,
+  'PATCH' => '0',
+  'PQ' => '\'',
+  'VERSION' => '6.9.0',
+  'a' => '.a',
+  'ar' => 'ar',
+  'ar_extra' => '',
+  'ar_out' => '',
+  'archname' => 'x86_64-linux-gnu-thread-multi',
+  'archname_provisional' => 'x86_64-linux-gnu-thread-multi',
+  'arflags' => 'cr',
+  'as' => 'as',
+  'backtrace' => 1,
+  'bigendian' => 0,
+  'bindir' => '/usr/local/bin',
+  'bison_version' => undef,
+  'blib_dir' => 'blib/lib',
+  'build_dir' => '/root/repo',
+  'byteorder' => '12345678',
+  'cat' => '$(PERL) -MExtUtils::Command -e cat',
+  'cc' => 'x86_64-linux-gnu-gcc',
+  'cc_debug' => '',
+  'cc_exe_out' => '-o ',
+  'cc_inc' => '-I./include -I./include/pmc',
+  'cc_ldflags' => '',
+  'cc_o_out' => '-o ',
+  'cc_shared' => '-fPIC',
+  'ccflags' => '-D_REENTRANT -D_GNU_SOURCE -DDEBIAN -fwrapv  -pipe -I/usr/local/include -D_LARGEFILE_SOURCE -D_FILE_OFFSET_BITS=64 -DHASATTRIBUTE_CONST  -DHASATTRIBUTE_DEPRECATED  -DHASATTRIBUTE_MALLOC  -DHASATTRIBUTE_NONNULL  -DHASATTRIBUTE_PURE  -DHASATTRIBUTE_UNUSED  -DHASATTRIBUTE_WARN_UNUSED_RESULT  -DHASATTRIBUTE_HOT  -DHASATTRIBUTE_COLD  -DHAS_GETTEXT ',
+  'ccflags_provisional' => '-D_REENTRANT -D_GNU_SOURCE -DDEBIAN -fwrapv -fno-strict-aliasing -pipe -I/usr/local/include -D_LARGEFILE_SOURCE -D_FILE_OFFSET_BITS=64',
+  'ccwarn' => '-falign-functions=16 -funit-at-a-time -fexcess-precision=standard -maccumulate-outgoing-args -Wall -Wextra -Waggregate-return -Wcast-qual -Wdisabled-optimization -Wdiv-by-zero -Wendif-labels -Wformat-extra-args -Wformat-nonliteral -Wformat-security -Wformat-y2k -Wimplicit -Wimport -Winit-self -Winline -Winvalid-pch -Wjump-misses-init -Wlogical-op -Werror=missing-braces -Werror=missing-declarations -Wno-missing-format-attribute -Wmissing-include-dirs -Wmultichar -Wpacked -Wpointer-arith -Wreturn-type -Wsequence-point -Wsign-compare -Wstrict-aliasing -Wstrict-aliasing=2 -Wswitch -Wswitch-default -Werror=undef -Wno-unused -Wvariadic-macros -Wwrite-strings -Wstack-usage=500 -Wc++-compat -Werror=declaration-after-statement -Werror=implicit-function-declaration -Werror=missing-prototypes -Werror=nested-externs -Werror=old-style-definition -Werror=strict-prototypes -fvisibility=hidden',
+  'ccwarn::compilers/imcc/imclexer.c' => '-falign-functions=16 -funit-at-a-time -fexcess-precision=standard -maccumulate-outgoing-args -Wall -Wextra -Waggregate-return -Wcast-qual -Wdisabled-optimization -Wdiv-by-zero -Wendif-labels -Wformat-extra-args -Wformat-security -Wformat-y2k -Wimplicit -Wimport -Winit-self -Winline -Winvalid-pch -Wjump-misses-init -Wlogical-op -Werror=missing-braces -Werror=missing-declarations -Wno-missing-format-attribute -Wmissing-include-dirs -Wmultichar -Wpacked -Wpointer-arith -Wreturn-type -Wsequence-point -Wsign-compare -Wstrict-aliasing -Wstrict-aliasing=2 -Wswitch -Werror=undef -Wno-unused -Wvariadic-macros -Wwrite-strings -Wstack-usage=500 -Wc++-compat -Werror=declaration-after-statement -Werror=implicit-function-declaration -Werror=missing-prototypes -Werror=nested-externs -Werror=old-style-definition -Werror=strict-prototypes -fvisibility=hidden -Wno-unused-parameter',
+  'ccwarn::compilers/imcc/imcparser.c' => '-falign-functions=16 -funit-at-a-time -fexcess-precision=standard -maccumulate-outgoing-args -Wall -Wextra -Waggregate-return -Wdisabled-optimization -Wdiv-by-zero -Wendif-labels -Wformat-extra-args -Wformat-nonliteral -Wformat-security -Wformat-y2k -Wimplicit -Wimport -Winit-self -Winline -Winvalid-pch -Wjump-misses-init -Wlogical-op -Werror=missing-braces -Werror=missing-declarations -Wno-missing-format-attribute -Wmissing-include-dirs -Wmultichar -Wpacked -Wpointer-arith -Wreturn-type -Wsequence-point -Wsign-compare -Wstrict-aliasing -Wstrict-aliasing=2 -Wswitch -Wswitch-default -Werror=undef -Wno-unused -Wvariadic-macros -Wwrite-strings -Wstack-usage=500 -Wc++-compat -Werror=declaration-after-statement -Werror=implicit-function-declaration -Werror=missing-prototypes -Werror=nested-externs -Werror=old-style-definition -Werror=strict-prototypes -fvisibility=hidden',
+  'ccwarn::compilers/imcc/optimizer.c' => '-falign-functions=16 -funit-at-a-time -fexcess-precision=standard -maccumulate-outgoing-args -Wall -Wextra -Waggregate-return -Wcast-qual -Wdisabled-optimization -Wdiv-by-zero -Wendif-labels -Wformat-extra-args -Wformat-security -Wformat-y2k -Wimplicit -Wimport -Winit-self -Winline -Winvalid-pch -Wjump-misses-init -Wlogical-op -Werror=missing-braces -Werror=missing-declarations -Wno-missing-format-attribute -Wmissing-include-dirs -Wmultichar -Wpacked -Wpointer-arith -Wreturn-type -Wsequence-point -Wsign-compare -Wstrict-aliasing -Wstrict-aliasing=2 -Wswitch -Wswitch-default -Werror=undef -Wno-unused -Wvariadic-macros -Wwrite-strings -Wstack-usage=500 -Wc++-compat -Werror=declaration-after-statement -Werror=implicit-function-declaration -Werror=missing-prototypes -Werror=nested-externs -Werror=old-style-definition -Werror=strict-prototypes -fvisibility=hidden',
+  'ccwarn::src/extra_nci_thunks.c' => '-falign-functions=16 -funit-at-a-time -fexcess-precision=standard -maccumulate-outgoing-args -Wall -Wextra -Waggregate-return -Wcast-qual -Wdisabled-optimization -Wdiv-by-zero -Wendif-labels -Wformat-extra-args -Wformat-nonliteral -Wformat-security -Wformat-y2k -Wimplicit -Wimport -Winit-self -Winline -Winvalid-pch -Wjump-misses-init -Wlogical-op -Werror=missing-braces -Werror=missing-declarations -Wno-missing-format-attribute -Wmissing-include-dirs -Wmultichar -Wpacked -Wpointer-arith -Wreturn-type -Wsequence-point -Wsign-compare -Wstrict-aliasing -Wstrict-aliasing=2 -Wswitch -Wswitch-default -Werror=undef -Wno-unused -Wvariadic-macros -Wwrite-strings -Wstack-usage=500 -Wc++-compat -Werror=declaration-after-statement -Werror=implicit-function-declaration -Werror=missing-prototypes -Werror=nested-externs -Werror=old-style-definition -Werror=strict-prototypes -fvisibility=hidden',
+  'ccwarn::src/nci/extra_thunks.c' => '-falign-functions=16 -funit-at-a-time -fexcess-precision=standard -maccumulate-outgoing-args -Wall -Wextra -Waggregate-return -Wcast-qual -Wdisabled-optimization -Wdiv-by-zero -Wendif-labels -Wformat-extra-args -Wformat-nonliteral -Wformat-security -Wformat-y2k -Wimplicit -Wimport -Winit-self -Winline -Winvalid-pch -Wjump-misses-init -Wlogical-op -Werror=missing-braces -Werror=missing-declarations -Wno-missing-format-attribute -Wmissing-include-dirs -Wmultichar -Wpacked -Wpointer-arith -Wreturn-type -Wsequence-point -Wsign-compare -Wstrict-aliasing -Wstrict-aliasing=2 -Wswitch -Wswitch-default -Werror=undef -Wno-unused -Wvariadic-macros -Wwrite-strings -Wstack-usage=500 -Wc++-compat -Werror=declaration-after-statement -Werror=implicit-function-declaration -Werror=missing-prototypes -Werror=nested-externs -Werror=old-style-definition -Werror=strict-prototypes -fvisibility=hidden',
+  'ccwarn::src/ops/core_ops.c' => '-falign-functions=16 -funit-at-a-time -fexcess-precision=standard -maccumulate-outgoing-args -Wall -Wextra -Waggregate-return -Wcast-qual -Wdisabled-optimization -Wdiv-by-zero -Wendif-labels -Wformat-extra-args -Wformat-nonliteral -Wformat-security -Wformat-y2k -Wimplicit -Wimport -Winit-self -Winline -Winvalid-pch -Wjump-misses-init -Wlogical-op -Werror=missing-braces -Werror=missing-declarations -Wno-missing-format-attribute -Wmissing-include-dirs -Wmultichar -Wpacked -Wpointer-arith -Wreturn-type -Wsequence-point -Wsign-compare -Wstrict-aliasing -Wstrict-aliasing=2 -Wswitch -Wswitch-default -Werror=undef -Wno-unused -Wvariadic-macros -Wwrite-strings -Wstack-usage=500 -Wc++-compat -Werror=declaration-after-statement -Werror=implicit-function-declaration -Werror=missing-prototypes -Werror=nested-externs -Werror=old-style-definition -Werror=strict-prototypes -fvisibility=hidden -Wno-parentheses-equality',
+  'ccwarn::src/spf_render.c' => '-falign-functions=16 -funit-at-a-time -fexcess-precision=standard -maccumulate-outgoing-args -Wall -Wextra -Waggregate-return -Wcast-qual -Wdisabled-optimization -Wdiv-by-zero -Wendif-labels -Wformat-extra-args -Wformat-security -Wformat-y2k -Wimplicit -Wimport -Winit-self -Winline -Winvalid-pch -Wjump-misses-init -Wlogical-op -Werror=missing-braces -Werror=missing-declarations -Wno-missing-format-attribute -Wmissing-include-dirs -Wmultichar -Wpacked -Wpointer-arith -Wreturn-type -Wsequence-point -Wsign-compare -Wstrict-aliasing -Wstrict-aliasing=2 -Wswitch -Wswitch-default -Werror=undef -Wno-unused -Wvariadic-macros -Wwrite-strings -Wstack-usage=500 -Wc++-compat -Werror=declaration-after-statement -Werror=implicit-function-declaration -Werror=missing-prototypes -Werror=nested-externs -Werror=old-style-definition -Werror=strict-prototypes -fvisibility=hidden',
+  'ccwarn::src/string/spf_render.c' => '-falign-functions=16 -funit-at-a-time -fexcess-precision=standard -maccumulate-outgoing-args -Wall -Wextra -Waggregate-return -Wcast-qual -Wdisabled-optimization -Wdiv-by-zero -Wendif-labels -Wformat-extra-args -Wformat-nonliteral -Wformat-security -Wformat-y2k -Wimplicit -Wimport -Winit-self -Winline -Winvalid-pch -Wjump-misses-init -Wlogical-op -Werror=missing-braces -Werror=missing-declarations -Wno-missing-format-attribute -Wmissing-include-dirs -Wmultichar -Wpacked -Wpointer-arith -Wreturn-type -Wsequence-point -Wsign-compare -Wstrict-aliasing -Wstrict-aliasing=2 -Wswitch -Wswitch-default -Werror=undef -Wno-unused -Wvariadic-macros -Wwrite-strings -Wstack-usage=500 -Wc++-compat -Werror=declaration-after-statement -Werror=implicit-function-declaration -Werror=missing-prototypes -Werror=nested-externs -Werror=old-style-definition -Werror=strict-prototypes -fvisibility=hidden -Wno-format-nonliteral',
+  'ccwarn::src/string/sprintf.c' => '-falign-functions=16 -funit-at-a-time -fexcess-precision=standard -maccumulate-outgoing-args -Wall -Wextra -Waggregate-return -Wcast-qual -Wdisabled-optimization -Wdiv-by-zero -Wendif-labels -Wformat-extra-args -Wformat-nonliteral -Wformat-security -Wformat-y2k -Wimplicit -Wimport -Winit-self -Winline -Winvalid-pch -Wjump-misses-init -Wlogical-op -Werror=missing-braces -Werror=missing-declarations -Wno-missing-format-attribute -Wmissing-include-dirs -Wmultichar -Wpacked -Wpointer-arith -Wreturn-type -Wsequence-point -Wsign-compare -Wstrict-aliasing -Wstrict-aliasing=2 -Wswitch -Wswitch-default -Werror=undef -Wno-unused -Wvariadic-macros -Wwrite-strings -Wstack-usage=500 -Wc++-compat -Werror=declaration-after-statement -Werror=implicit-function-declaration -Werror=missing-prototypes -Werror=nested-externs -Werror=old-style-definition -Werror=strict-prototypes -fvisibility=hidden -Wno-format-nonliteral',
+  'chmod' => '$(PERL) -MExtUtils::Command -e chmod',
+  'clang' => 0,
+  'clock_best' => '',
+  'configdate' => 'Mon Oct 19 10:19:09 2026 GMT',
+  'configuration_steps' => 'init::manifest init::defaults init::install init::hints inter::progs inter::make inter::lex inter::yacc auto::gcc auto::glibc auto::backtrace auto::msvc auto::attributes auto::arch auto::cpu init::optimize inter::shlibs inter::libparrot inter::types auto::ops auto::pmc auto::headers auto::sizes auto::byteorder auto::va_ptr auto::format auto::isreg auto::llvm auto::inline auto::gc auto::memalign auto::signal auto::socklen_t auto::stat auto::neg_0 auto::env auto::timespec auto::infnan auto::thread auto::gmp auto::readline auto::pcre auto::opengl auto::zlib auto::gettext auto::snprintf auto::labs auto::perldoc auto::coverage auto::pod2man auto::ctags auto::icu auto::libffi auto::ipv6 auto::platform auto::alignof auto::expect auto::warnings gen::config_h gen::core_pmcs gen::opengl gen::makefiles gen::config_pm',
+  'configure_args' => '',
+  'configure_tests' => 't/configure/*.t t/steps/*.t t/postconfigure/*.t',
+  'configured_from_file' => '',
+  'core_tests' => 't/src/*.t t/src/embed/*.t t/run/*.t t/perl/*.t',
+  'cover' => '$(PERL) -e "print \\"cover needed but not found.\\n\\"; exit 1;"',
+  'coveragedir' => '/root/repo',
+  'cp' => '$(PERL) -MExtUtils::Command -e cp',
+  'cpuarch' => 'amd64',
+  'cputype' => 'Intel(R) Xeon(R) Processor',
+  'ctags' => 'ctags',
+  'cxx' => 'c++',
+  'd_socklen_t_provisional' => 'define',
+  'datadir' => '/usr/local/share',
+  'debugging' => 0,
+  'developing_tests' => 't/codingstd/c_arg_assert.t t/codingstd/c_code_coda.t t/codingstd/c_cppcomments.t t/codingstd/c_enum.t t/codingstd/c_function_docs.t t/codingstd/c_header_guards.t t/codingstd/c_indent.t t/codingstd/c_macro_args.t t/codingstd/c_operator.t t/codingstd/c_parens.t t/codingstd/c_returns.t t/codingstd/c_struct.t t/codingstd/c_todo.t t/codingstd/case_sensitive_files.t t/codingstd/check_isxxx.t t/codingstd/check_toxxx.t t/codingstd/copyright.t t/codingstd/cuddled_else.t t/codingstd/filenames.t t/codingstd/gmt_utc.t t/codingstd/linelength.t t/codingstd/make_code_coda.t t/codingstd/opcode_doc.t t/codingstd/pbc_compat.t t/codingstd/pccmethod_deps.t t/codingstd/pdd_format.t t/codingstd/perlcritic.t t/codingstd/pir_code_coda.t t/codingstd/pmc_docs.t t/codingstd/pod_description.t t/codingstd/pod_syntax.t t/codingstd/pod_todo.t t/codingstd/tabs.t t/codingstd/trailing_space.t',
+  'docdir' => '/usr/local/share/doc',
+  'doublesize' => 8,
+  'dquote' => '\\"',
+  'embed-cflags' => '-I/usr/local/include/parrot/6.9.0-devel',
+  'embed-ldflags' => '-L/usr/local/lib -lparrot -ldl -lm -lpthread -lcrypt -lrt -lgmp -lreadline -lffi',
+  'exe' => '',
+  'exec_prefix' => '/usr/local',
+  'flex_version' => undef,
+  'float4_t' => 'float',
+  'float8_t' => 'double',
+  'floatsize' => 4,
+  'floatvalfmt' => '%.15g',
+  'floatvalmax' => 'DBL_MAX',
+  'floatvalmin' => 'DBL_MIN',
+  'g++' => 0,
+  'gc_flag' => '',
+  'gc_type' => 'GMS',
+  'gccversion' => '12.2',
+  'gcov' => '/usr/bin/gcov',
+  'gcov2perl' => '$(PERL) -e "print \\"gcov2perl needed but not found.\\n\\"; exit 1;"',
+  'glibc' => 2,
+  'gmake_version' => '4.3',
+  'gmp' => 'define',
+  'has___sighandler_t' => 'define',
+  'has_core_nci_thunks' => 1,
+  'has_coverage_tools' => 0,
+  'has_dynamic_linking' => 1,
+  'has_extra_nci_thunks' => 1,
+  'has_glut' => 0,
+  'has_icu' => 0,
+  'has_libffi' => 1,
+  'has_llvm' => '',
+  'has_negative_zero' => 1,
+  'has_opengl' => 0,
+  'has_perldoc' => 0,
+  'has_pod2man' => 1,
+  'has_setitimer' => 'define',
+  'has_sig_atomic_t' => 'define',
+  'has_sigaction' => 'define',
+  'has_sigatomic_t' => undef,
+  'has_socklen_t' => 1,
+  'has_static_linking' => 1,
+  'has_zlib' => 1,
+  'have_cover' => '$(PERL) -e "print \\"The following tools are needed for coverage testing: cover, gcov2perl\\n\\"; print \\"Please install Devel::Cover.\\n\\"; exit 1;"',
+  'hugefloatval' => 'long double',
+  'hugefloatvalsize' => 16,
+  'hugeintval' => 'long long',
+  'hugeintvalsize' => 8,
+  'i_arpainet' => 'define',
+  'i_bfd' => undef,
+  'i_bsdioctl' => '',
+  'i_crypt' => 'define',
+  'i_db' => 'define',
+  'i_dbm' => 'define',
+  'i_dirent' => 'define',
+  'i_dlfcn' => 'define',
+  'i_execinfo' => 'define',
+  'i_fcntl' => 'define',
+  'i_fenv' => 'define',
+  'i_fp' => undef,
+  'i_fp_class' => undef,
+  'i_gdbm' => 'define',
+  'i_gdbm_ndbm' => 'define',
+  'i_gdbmndbm' => undef,
+  'i_grp' => 'define',
+  'i_ieeefp' => undef,
+  'i_inttypes' => 'define',
+  'i_langinfo' => 'define',
+  'i_libcpuid' => undef,
+  'i_libutil' => undef,
+  'i_limits' => 'define',
+  'i_locale' => 'define',
+  'i_machcthr' => undef,
+  'i_malloc' => 'define',
+  'i_mallocmalloc' => undef,
+  'i_mntent' => 'define',
+  'i_ndbm' => 'define',
+  'i_netdb' => 'define',
+  'i_neterrno' => undef,
+  'i_netinetin' => 'define',
+  'i_netinettcp' => 'define',
+  'i_poll' => 'define',
+  'i_prot' => undef,
+  'i_pthread' => 'define',
+  'i_pwd' => 'define',
+  'i_quadmath' => 'define',
+  'i_rpcsvcdbm' => undef,
+  'i_setjmp' => 'define',
+  'i_sgtty' => undef,
+  'i_shadow' => 'define',
+  'i_signal' => 'define',
+  'i_socks' => undef,
+  'i_stdbool' => 'define',
+  'i_stdint' => 'define',
+  'i_stdlib' => 'define',
+  'i_string' => 'define',
+  'i_sunmath' => undef,
+  'i_sysaccess' => undef,
+  'i_sysdir' => 'define',
+  'i_sysexit' => undef,
+  'i_sysfile' => 'define',
+  'i_sysfilio' => undef,
+  'i_sysin' => undef,
+  'i_sysioctl' => 'define',
+  'i_syslog' => 'define',
+  'i_sysmman' => 'define',
+  'i_sysmode' => undef,
+  'i_sysmount' => 'define',
+  'i_sysndir' => undef,
+  'i_sysparam' => 'define',
+  'i_syspoll' => 'define',
+  'i_sysresource' => 'define',
+  'i_sysresrc' => 'define',
+  'i_syssecrt' => undef,
+  'i_sysselct' => 'define',
+  'i_syssocket' => 'define',
+  'i_syssockio' => undef,
+  'i_sysstat' => 'define',
+  'i_sysstatfs' => 'define',
+  'i_sysstatvfs' => 'define',
+  'i_syssysctl' => undef,
+  'i_systime' => 'define',
+  'i_systimek' => undef,
+  'i_systimes' => 'define',
+  'i_systypes' => 'define',
+  'i_sysuio' => 'define',
+  'i_sysun' => 'define',
+  'i_sysutsname' => 'define',
+  'i_sysvfs' => 'define',
+  'i_syswait' => 'define',
+  'i_termio' => undef,
+  'i_termios' => 'define',
+  'i_time' => 'define',
+  'i_unistd' => 'define',
+  'i_ustat' => undef,
+  'i_utime' => 'define',
+  'i_vfork' => undef,
+  'i_wchar' => 'define',
+  'i_wctype' => 'define',
+  'i_xlocale' => undef,
+  'icu_dir' => '',
+  'icu_shared' => '',
+  'includedir' => '/usr/local/include',
+  'infodir' => '/usr/local/info',
+  'inline' => '',
+  'inst_libparrot_ldflags' => '',
+  'inst_libparrot_linkflags' => '-L"/usr/local/lib" -lparrot',
+  'int2_t' => 'short',
+  'int4_t' => 'int',
+  'int8_t' => 'long',
+  'intsize' => 4,
+  'intvalfmt' => '%ld',
+  'intvalmax' => 'LONG_MAX',
+  'intvalmin' => 'LONG_MIN',
+  'intvalsize' => 8,
+  'isreg' => 1,
+  'iv' => 'long',
+  'ld' => 'x86_64-linux-gnu-gcc',
+  'ld_debug' => '',
+  'ld_load_flags' => '-shared -L/usr/local/lib -fstack-protector-strong -fPIC',
+  'ld_out' => '-o ',
+  'ld_share_flags' => '-shared -L/usr/local/lib -fstack-protector-strong -fPIC',
+  'ldflags' => ' -fstack-protector-strong -L/usr/local/lib',
+  'lex' => 'echo',
+  'libdir' => '/usr/local/lib',
+  'libexecdir' => '/usr/local/libexec',
+  'libparrot_for_makefile_only' => '$(LIBPARROT_SHARED)',
+  'libparrot_ldflags' => '',
+  'libparrot_linkflags' => '-L"/root/repo/blib/lib" -lparrot',
+  'libparrot_shared' => 'libparrot.so.6.9.0',
+  'libparrot_shared_alias' => 'libparrot.so',
+  'libparrot_soname' => '-Wl,-soname=libparrot.so.6.9.0',
+  'libparrot_static' => 'libparrot.a',
+  'library_tests' => 't/compilers/pct/*.t t/compilers/pge/*.t t/compilers/pge/p5regex/*.t t/compilers/pge/perl6regex/*.t t/compilers/tge/*.t t/compilers/opsc/*.t t/compilers/data_json/*.t ext/nqp-rx/t/nqp/*.t t/dynoplibs/*.t t/dynpmc/*.t t/library/*.t t/ext/winxed/*.t t/tools/*.t t/profiling/*.t',
+  'libs' => '-ldl -lm -lpthread -lcrypt -lrt -lgmp -lreadline  -lffi ',
+  'link' => 'x86_64-linux-gnu-gcc',
+  'link_debug' => '',
+  'link_dynamic' => '-Wl,-E',
+  'linkflags' => ' -fstack-protector-strong -L/usr/local/lib -Wl,-E ',
+  'lns' => 'ln -s',
+  'load_ext' => '.so',
+  'localstatedir' => '/usr/local/var',
+  'longdoublesize' => 16,
+  'longlongsize' => 8,
+  'longsize' => 8,
+  'make' => 'gmake',
+  'make_and' => '&&',
+  'make_c' => '+gmake -C',
+  'make_set_make' => '#',
+  'malloc_header' => undef,
+  'mandir' => '/usr/local/man',
+  'memalign' => 'posix_memalign',
+  'mkpath' => '$(PERL) -MExtUtils::Command -e mkpath',
+  'msvcversion' => undef,
+  'mv' => '$(PERL) -MExtUtils::Command -e mv',
+  'ncilib_link_extra' => '',
+  'new_perldoc' => 0,
+  'no_lines_flag' => '',
+  'noinline' => '__attribute__ ((noinline))',
+  'numvalsize' => 8,
+  'nv' => 'double',
+  'nvsize' => 8,
+  'o' => '.o',
+  'oldincludedir' => '/usr/include',
+  'opcode_t' => 'long',
+  'opcodesize' => 8,
+  'opengl_lib' => '',
+  'ops' => 'src/ops/core.ops src/ops/bit.ops src/ops/cmp.ops src/ops/experimental.ops src/ops/io.ops src/ops/math.ops src/ops/object.ops src/ops/pmc.ops src/ops/set.ops src/ops/string.ops src/ops/sys.ops src/ops/var.ops',
+  'ops2c' => 'parrot-ops2c',
+  'optimize' => '',
+  'optimize_provisional' => '-O2 -g',
+  'osname' => 'linux',
+  'osvers' => '6.18.44-fc-v139',
+  'osvers_provisional' => '4.19.0',
+  'parrot_is_shared' => 1,
+  'perl' => '/usr/bin/perl',
+  'perldoc' => 'echo',
+  'platform' => 'generic',
+  'platform_asm' => 0,
+  'pmc' => 'default.pmc null.pmc env.pmc key.pmc unmanagedstruct.pmc managedstruct.pmc exception.pmc parrotlibrary.pmc parrotinterpreter.pmc lexpad.pmc timer.pmc pointer.pmc sub.pmc continuation.pmc coroutine.pmc nci.pmc float.pmc integer.pmc bigint.pmc bignum.pmc complex.pmc string.pmc boolean.pmc fixedintegerarray.pmc iterator.pmc fixedstringarray.pmc hash.pmc orderedhash.pmc oplib.pmc opcode.pmc callcontext.pmc addrregistry.pmc alarm.pmc arrayiterator.pmc bytebuffer.pmc callback.pmc capture.pmc channel.pmc class.pmc eventhandler.pmc exceptionhandler.pmc exporter.pmc filehandle.pmc fixedbooleanarray.pmc fixedfloatarray.pmc fixedpmcarray.pmc handle.pmc hashiterator.pmc hashiteratorkey.pmc imageiofreeze.pmc imageiosize.pmc imageiostrings.pmc imageiothaw.pmc imccompiler.pmc lexinfo.pmc mappedbytearray.pmc multisub.pmc namespace.pmc nativepccmethod.pmc object.pmc orderedhashiterator.pmc os.pmc packfile.pmc packfileannotation.pmc packfileannotations.pmc packfilebytecodesegment.pmc packfileconstanttable.pmc packfiledebug.pmc packfiledirectory.pmc packfileopmap.pmc packfilerawsegment.pmc packfilesegment.pmc packfileview.pmc pmclist.pmc pmcproxy.pmc proxy.pmc ptr.pmc ptrbuf.pmc ptrobj.pmc resizablebooleanarray.pmc resizablefloatarray.pmc resizableintegerarray.pmc resizablepmcarray.pmc resizablestringarray.pmc role.pmc scalar.pmc scheduler.pmc schedulermessage.pmc sockaddr.pmc socket.pmc stringbuilder.pmc stringhandle.pmc stringiterator.pmc structview.pmc task.pmc undef.pmc',
+  'pmc_names' => 'default Null Env Key UnManagedStruct ManagedStruct Exception ParrotLibrary ParrotInterpreter LexPad Timer Pointer Sub Coroutine EventHandler Continuation ExceptionHandler NCI BigInt BigNum Complex FixedIntegerArray ResizableIntegerArray Iterator ArrayIterator HashIterator OrderedHashIterator StringIterator FixedStringArray ResizableStringArray Hash LexInfo NameSpace OrderedHash OpLib Opcode CallContext AddrRegistry Alarm ByteBuffer Capture Channel Class PMCProxy Exporter FixedBooleanArray ResizableBooleanArray FixedFloatArray ResizableFloatArray FixedPMCArray ResizablePMCArray MultiSub Handle FileHandle Socket StringHandle HashIteratorKey ImageIOFreeze ImageIOSize ImageIOStrings ImageIOThaw IMCCompiler MappedByteArray NativePCCMethod Object OS Packfile PackfileAnnotation PackfileOpMap PackfileSegment PackfileAnnotations PackfileConstantTable PackfileDirectory PackfileRawSegment PackfileBytecodeSegment PackfileDebug PackfileView PMCList Proxy Ptr PtrBuf PtrObj Role scalar Float Integer String Boolean Scheduler SchedulerMessage Sockaddr StringBuilder StructView Task Callback Undef',
+  'pod2man' => '/usr/bin/pod2man',
+  'prefix' => '/usr/local',
+  'ptrcast' => 'unsigned long',
+  'ptrsize' => 8,
+  'ranlib' => ':',
+  'readline' => 'define',
+  'rm_f' => '$(PERL) -MExtUtils::Command -e rm_f',
+  'rm_rf' => '$(PERL) -MExtUtils::Command -e rm_rf',
+  'rpath' => '-Wl,-rpath=',
+  'rpath_blib' => '"-Wl,-rpath=/root/repo/blib/lib"',
+  'rpath_lib' => '-Wl,-rpath="/usr/local/lib"',
+  'runcore_tests' => 't/compilers/imcc/*/*.t t/op/*.t t/pmc/*.t t/oo/*.t t/pir/*.t t/native_pbc/*.t',
+  'sPRIgldbl_provisional' => '"Lg"',
+  'sbindir' => '/usr/local/sbin',
+  'scriptdirexp_provisional' => '/usr/bin',
+  'setenv' => 1,
+  'share_ext' => '.so',
+  'sharedstatedir' => '/usr/local/com',
+  'shortsize' => 2,
+  'sig_name_provisional' => 'ZERO HUP INT QUIT ILL TRAP ABRT BUS FPE KILL USR1 SEGV USR2 PIPE ALRM TERM STKFLT CHLD CONT STOP TSTP TTIN TTOU URG XCPU XFSZ VTALRM PROF WINCH IO PWR SYS NUM32 NUM33 RTMIN NUM35 NUM36 NUM37 NUM38 NUM39 NUM40 NUM41 NUM42 NUM43 NUM44 NUM45 NUM46 NUM47 NUM48 NUM49 NUM50 NUM51 NUM52 NUM53 NUM54 NUM55 NUM56 NUM57 NUM58 NUM59 NUM60 NUM61 NUM62 NUM63 RTMAX IOT CLD POLL ',
+  'slash' => '/',
+  'srcdir' => '/usr/local/src',
+  'sym_export' => '__attribute__ ((visibility("default")))',
+  'sym_import' => '',
+  'sysconfdir' => '/usr/local/etc',
+  'tar' => '/usr/bin/tar',
+  'tempdir' => '/tmp',
+  'test_prog' => 'parrot',
+  'touch' => '$(PERL) -MExtUtils::Command -e touch',
+  'uintvalfmt' => '%lu',
+  'unsetenv' => 1,
+  'va_ptr_type' => 'register',
+  'verbose' => undef,
+  'versiondir' => '/parrot/6.9.0-devel',
+  'yacc' => 'echo'
+);
+
+
+%PConfig_Temp = (
+  'TEMP_atomic_o' => '',
+  'TEMP_cli_define' => '',
+  'TEMP_d_config' => '',
+  'TEMP_has_config' => '#define PARROT_HAS_BSD_STAT_EXTN 1
+#define PARROT_HAS_BUILTIN_EXPECT 1
+#define PARROT_HAS_C99_SNPRINTF 1
+#define PARROT_HAS_COMPILER_OFFSETOF_ALIGNOF 1
+#define PARROT_HAS_CORE_NCI_THUNKS 1
+#define PARROT_HAS_EXTRA_NCI_THUNKS 1
+#define PARROT_HAS_GETTEXT 1
+#define PARROT_HAS_GMP 1
+#define PARROT_HAS_INF_NAN 1
+#define PARROT_HAS_INT64 1
+#define PARROT_HAS_IPV6 1
+#define PARROT_HAS_LABS 1
+#define PARROT_HAS_LIBFFI 1
+#define PARROT_HAS_LONGLONG 1
+#define PARROT_HAS_READLINE 1
+#define PARROT_HAS_SNPRINTF 1
+#define PARROT_HAS_STAT_ATIM 1
+#define PARROT_HAS_THREADS 1
+#define PARROT_HAS_TIMESPEC 1',
+  'TEMP_header' => '#define PARROT_HAS_HEADER_ARPAINET 1
+#undef  PARROT_HAS_HEADER_BFD
+#undef  PARROT_HAS_HEADER_BSDIOCTL
+#define PARROT_HAS_HEADER_CRYPT 1
+#define PARROT_HAS_HEADER_DB 1
+#define PARROT_HAS_HEADER_DBM 1
+#define PARROT_HAS_HEADER_DIRENT 1
+#define PARROT_HAS_HEADER_DLFCN 1
+#define PARROT_HAS_HEADER_EXECINFO 1
+#define PARROT_HAS_HEADER_FCNTL 1
+#define PARROT_HAS_HEADER_FENV 1
+#undef  PARROT_HAS_HEADER_FP
+#undef  PARROT_HAS_HEADER_FP_CLASS
+#define PARROT_HAS_HEADER_GDBM 1
+#define PARROT_HAS_HEADER_GDBM_NDBM 1
+#undef  PARROT_HAS_HEADER_GDBMNDBM
+#define PARROT_HAS_HEADER_GRP 1
+#undef  PARROT_HAS_HEADER_IEEEFP
+#define PARROT_HAS_HEADER_INTTYPES 1
+#define PARROT_HAS_HEADER_LANGINFO 1
+#undef  PARROT_HAS_HEADER_LIBCPUID
+#undef  PARROT_HAS_HEADER_LIBUTIL
+#define PARROT_HAS_HEADER_LIMITS 1
+#define PARROT_HAS_HEADER_LOCALE 1
+#undef  PARROT_HAS_HEADER_MACHCTHR
+#define PARROT_HAS_HEADER_MALLOC 1
+#undef  PARROT_HAS_HEADER_MALLOCMALLOC
+#define PARROT_HAS_HEADER_MNTENT 1
+#define PARROT_HAS_HEADER_NDBM 1
+#define PARROT_HAS_HEADER_NETDB 1
+#undef  PARROT_HAS_HEADER_NETERRNO
+#define PARROT_HAS_HEADER_NETINETIN 1
+#define PARROT_HAS_HEADER_NETINETTCP 1
+#define PARROT_HAS_HEADER_POLL 1
+#undef  PARROT_HAS_HEADER_PROT
+#define PARROT_HAS_HEADER_PTHREAD 1
+#define PARROT_HAS_HEADER_PWD 1
+#define PARROT_HAS_HEADER_QUADMATH 1
+#undef  PARROT_HAS_HEADER_RPCSVCDBM
+#define PARROT_HAS_HEADER_SETJMP 1
+#undef  PARROT_HAS_HEADER_SGTTY
+#define PARROT_HAS_HEADER_SHADOW 1
+#define PARROT_HAS_HEADER_SIGNAL 1
+#undef  PARROT_HAS_HEADER_SOCKS
+#define PARROT_HAS_HEADER_STDBOOL 1
+#define PARROT_HAS_HEADER_STDINT 1
+#define PARROT_HAS_HEADER_STDLIB 1
+#define PARROT_HAS_HEADER_STRING 1
+#undef  PARROT_HAS_HEADER_SUNMATH
+#undef  PARROT_HAS_HEADER_SYSACCESS
+#define PARROT_HAS_HEADER_SYSDIR 1
+#undef  PARROT_HAS_HEADER_SYSEXIT
+#define PARROT_HAS_HEADER_SYSFILE 1
+#undef  PARROT_HAS_HEADER_SYSFILIO
+#undef  PARROT_HAS_HEADER_SYSIN
+#define PARROT_HAS_HEADER_SYSIOCTL 1
+#define PARROT_HAS_HEADER_SYSLOG 1
+#define PARROT_HAS_HEADER_SYSMMAN 1
+#undef  PARROT_HAS_HEADER_SYSMODE
+#define PARROT_HAS_HEADER_SYSMOUNT 1
+#undef  PARROT_HAS_HEADER_SYSNDIR
+#define PARROT_HAS_HEADER_SYSPARAM 1
+#define PARROT_HAS_HEADER_SYSPOLL 1
+#define PARROT_HAS_HEADER_SYSRESOURCE 1
+#define PARROT_HAS_HEADER_SYSRESRC 1
+#undef  PARROT_HAS_HEADER_SYSSECRT
+#define PARROT_HAS_HEADER_SYSSELCT 1
+#define PARROT_HAS_HEADER_SYSSOCKET 1
+#undef  PARROT_HAS_HEADER_SYSSOCKIO
+#define PARROT_HAS_HEADER_SYSSTAT 1
+#define PARROT_HAS_HEADER_SYSSTATFS 1
+#define PARROT_HAS_HEADER_SYSSTATVFS 1
+#undef  PARROT_HAS_HEADER_SYSSYSCTL
+#define PARROT_HAS_HEADER_SYSTIME 1
+#undef  PARROT_HAS_HEADER_SYSTIMEK
+#define PARROT_HAS_HEADER_SYSTIMES 1
+#define PARROT_HAS_HEADER_SYSTYPES 1
+#define PARROT_HAS_HEADER_SYSUIO 1
+#define PARROT_HAS_HEADER_SYSUN 1
+#define PARROT_HAS_HEADER_SYSUTSNAME 1
+#define PARROT_HAS_HEADER_SYSVFS 1
+#define PARROT_HAS_HEADER_SYSWAIT 1
+#undef  PARROT_HAS_HEADER_TERMIO
+#define PARROT_HAS_HEADER_TERMIOS 1
+#define PARROT_HAS_HEADER_TIME 1
+#define PARROT_HAS_HEADER_UNISTD 1
+#undef  PARROT_HAS_HEADER_USTAT
+#define PARROT_HAS_HEADER_UTIME 1
+#undef  PARROT_HAS_HEADER_VFORK
+#define PARROT_HAS_HEADER_WCHAR 1
+#define PARROT_HAS_HEADER_WCTYPE 1
+#undef  PARROT_HAS_HEADER_XLOCALE',
+  'TEMP_platform_o' => 'src/platform/generic/io$(O) src/platform/generic/socket$(O) src/platform/generic/file$(O) src/platform/generic/time$(O) src/platform/generic/encoding$(O) src/platform/generic/env$(O) src/platform/generic/cpu_type$(O) src/platform/generic/num_cpus$(O) src/platform/generic/dl$(O) src/platform/generic/math$(O) src/platform/generic/itimer$(O) src/platform/generic/exec$(O) src/platform/generic/misc$(O) src/platform/generic/hires_timer$(O) src/platform/generic/sysmem$(O) src/platform/generic/uid$(O) src/platform/generic/error$(O) src/platform/generic/entropy$(O)',
+  'TEMP_pmc_build' => '
+# the following part of the Makefile was built by \'config/auto/pmc.pm\'
+
+PMC2C_FILES = \\
+    lib/Parrot/Pmc2c/Pmc2cMain.pm \\
+    lib/Parrot/Pmc2c/Parser.pm \\
+    lib/Parrot/Pmc2c/Dumper.pm \\
+    lib/Parrot/Pmc2c/PMC.pm \\
+    lib/Parrot/Pmc2c/Method.pm \\
+    lib/Parrot/Pmc2c/PCCMETHOD.pm \\
+    lib/Parrot/Pmc2c/Library.pm \\
+    lib/Parrot/Pmc2c/UtilFunctions.pm \\
+    lib/Parrot/Pmc2c/PMC/RO.pm
+
+include/pmc/pmc_default.h src/pmc/default.c : src/pmc/default.dump
+	$(PMC2CC) src/pmc/default.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_default.h" "[devel]" include
+
+src/pmc/default.dump : vtable.dump  src/pmc/default.pmc $(PMC2C_FILES) 
+	$(PMC2CD) src/pmc/default.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/default$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    lib/Parrot/Pmc2c/PMC/default.pm \\
+    src/pmc/default.c \\
+    src/pmc/default.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/default.c
+
+include/pmc/pmc_null.h src/pmc/null.c : src/pmc/null.dump
+	$(PMC2CC) src/pmc/null.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_null.h" "[devel]" include
+
+src/pmc/null.dump : vtable.dump src/pmc/default.dump  src/pmc/null.pmc $(PMC2C_FILES) 
+	$(PMC2CD) src/pmc/null.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/null$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_null.h \\
+    lib/Parrot/Pmc2c/PMC/Null.pm \\
+    src/pmc/null.c \\
+    src/pmc/null.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/null.c
+
+include/pmc/pmc_env.h src/pmc/env.c : src/pmc/env.dump
+	$(PMC2CC) src/pmc/env.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_env.h" "[devel]" include
+
+src/pmc/env.dump : vtable.dump src/pmc/default.dump  src/pmc/env.pmc $(PMC2C_FILES) 
+	$(PMC2CD) src/pmc/env.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/env$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_env.h \\
+    src/pmc/env.c \\
+    src/pmc/env.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/env.c
+
+include/pmc/pmc_key.h src/pmc/key.c : src/pmc/key.dump
+	$(PMC2CC) src/pmc/key.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_key.h" "[devel]" include
+
+src/pmc/key.dump : vtable.dump src/pmc/default.dump  src/pmc/key.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/key.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/key$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_key.h \\
+    src/pmc/key.c \\
+    src/pmc/key.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/key.c
+
+include/pmc/pmc_unmanagedstruct.h src/pmc/unmanagedstruct.c : src/pmc/unmanagedstruct.dump
+	$(PMC2CC) src/pmc/unmanagedstruct.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_unmanagedstruct.h" "[devel]" include
+
+src/pmc/unmanagedstruct.dump : vtable.dump src/pmc/default.dump  src/pmc/unmanagedstruct.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/unmanagedstruct.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/unmanagedstruct$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_unmanagedstruct.h \\
+    src/pmc/unmanagedstruct.c \\
+    src/pmc/unmanagedstruct.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/unmanagedstruct.c
+
+include/pmc/pmc_managedstruct.h src/pmc/managedstruct.c : src/pmc/managedstruct.dump
+	$(PMC2CC) src/pmc/managedstruct.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_managedstruct.h" "[devel]" include
+
+src/pmc/managedstruct.dump : vtable.dump src/pmc/default.dump src/pmc/unmanagedstruct.dump  src/pmc/managedstruct.pmc $(PMC2C_FILES) 
+	$(PMC2CD) src/pmc/managedstruct.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/managedstruct$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_managedstruct.h \\
+    include/pmc/pmc_unmanagedstruct.h \\
+    src/pmc/managedstruct.c \\
+    src/pmc/managedstruct.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/managedstruct.c
+
+include/pmc/pmc_exception.h src/pmc/exception.c : src/pmc/exception.dump
+	$(PMC2CC) src/pmc/exception.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_exception.h" "[devel]" include
+
+src/pmc/exception.dump : vtable.dump src/pmc/default.dump  src/pmc/exception.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/exception.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/exception$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_exception.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_sub.h \\
+    src/pmc/exception.c \\
+    src/pmc/exception.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/exception.c
+
+include/pmc/pmc_parrotlibrary.h src/pmc/parrotlibrary.c : src/pmc/parrotlibrary.dump
+	$(PMC2CC) src/pmc/parrotlibrary.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_parrotlibrary.h" "[devel]" include
+
+src/pmc/parrotlibrary.dump : vtable.dump src/pmc/default.dump  src/pmc/parrotlibrary.pmc $(PMC2C_FILES) 
+	$(PMC2CD) src/pmc/parrotlibrary.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/parrotlibrary$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_parrotlibrary.h \\
+    src/pmc/parrotlibrary.c \\
+    src/pmc/parrotlibrary.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/parrotlibrary.c
+
+include/pmc/pmc_parrotinterpreter.h src/pmc/parrotinterpreter.c : src/pmc/parrotinterpreter.dump
+	$(PMC2CC) src/pmc/parrotinterpreter.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_parrotinterpreter.h" "[devel]" include
+
+src/pmc/parrotinterpreter.dump : vtable.dump src/pmc/default.dump  src/pmc/parrotinterpreter.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/parrotinterpreter.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/parrotinterpreter$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/runcore_api.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/thread.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_class.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_parrotinterpreter.h \\
+    include/pmc/pmc_proxy.h \\
+    include/pmc/pmc_sub.h \\
+    include/pmc/pmc_task.h \\
+    src/pmc/parrotinterpreter.c \\
+    src/pmc/parrotinterpreter.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/parrotinterpreter.c
+
+include/pmc/pmc_lexpad.h src/pmc/lexpad.c : src/pmc/lexpad.dump
+	$(PMC2CC) src/pmc/lexpad.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_lexpad.h" "[devel]" include
+
+src/pmc/lexpad.dump : vtable.dump src/pmc/default.dump  src/pmc/lexpad.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/lexpad.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/lexpad$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_lexpad.h \\
+    src/pmc/lexpad.c \\
+    src/pmc/lexpad.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/lexpad.c
+
+include/pmc/pmc_timer.h src/pmc/timer.c : src/pmc/timer.dump
+	$(PMC2CC) src/pmc/timer.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_timer.h" "[devel]" include
+
+src/pmc/timer.dump : vtable.dump src/pmc/default.dump  src/pmc/timer.pmc $(PMC2C_FILES) 
+	$(PMC2CD) src/pmc/timer.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/timer$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/scheduler_private.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_task.h \\
+    include/pmc/pmc_timer.h \\
+    src/pmc/timer.c \\
+    src/pmc/timer.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/timer.c
+
+include/pmc/pmc_pointer.h src/pmc/pointer.c : src/pmc/pointer.dump
+	$(PMC2CC) src/pmc/pointer.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_pointer.h" "[devel]" include
+
+src/pmc/pointer.dump : vtable.dump src/pmc/default.dump  src/pmc/pointer.pmc $(PMC2C_FILES) 
+	$(PMC2CD) src/pmc/pointer.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/pointer$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_pointer.h \\
+    src/pmc/pointer.c \\
+    src/pmc/pointer.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/pointer.c
+
+include/pmc/pmc_sub.h src/pmc/sub.c : src/pmc/sub.dump
+	$(PMC2CC) src/pmc/sub.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_sub.h" "[devel]" include
+
+src/pmc/sub.dump : vtable.dump src/pmc/default.dump  src/pmc/sub.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/sub.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/sub$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/oplib/core_ops.h \\
+    include/parrot/oplib/ops.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/runcore_api.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_sub.h \\
+    src/pmc/sub.c \\
+    src/pmc/sub.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/sub.c
+
+include/pmc/pmc_continuation.h src/pmc/continuation.c : src/pmc/continuation.dump
+	$(PMC2CC) src/pmc/continuation.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_continuation.h" "[devel]" include
+
+src/pmc/continuation.dump : vtable.dump src/pmc/default.dump  src/pmc/continuation.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/continuation.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/continuation$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/oplib/ops.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_sub.h \\
+    src/pmc/continuation.c \\
+    src/pmc/continuation.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/continuation.c
+
+include/pmc/pmc_coroutine.h src/pmc/coroutine.c : src/pmc/coroutine.dump
+	$(PMC2CC) src/pmc/coroutine.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_coroutine.h" "[devel]" include
+
+src/pmc/coroutine.dump : vtable.dump src/pmc/default.dump src/pmc/sub.dump  src/pmc/coroutine.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/coroutine.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/coroutine$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/oplib/ops.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_coroutine.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_sub.h \\
+    src/pmc/coroutine.c \\
+    src/pmc/coroutine.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/coroutine.c
+
+include/pmc/pmc_nci.h src/pmc/nci.c : src/pmc/nci.dump
+	$(PMC2CC) src/pmc/nci.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_nci.h" "[devel]" include
+
+src/pmc/nci.dump : vtable.dump src/pmc/default.dump  src/pmc/nci.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/nci.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/nci$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_nci.h \\
+    src/pmc/nci.c \\
+    src/pmc/nci.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/nci.c
+
+include/pmc/pmc_float.h src/pmc/float.c : src/pmc/float.dump
+	$(PMC2CC) src/pmc/float.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_float.h" "[devel]" include
+
+src/pmc/float.dump : vtable.dump src/pmc/default.dump src/pmc/scalar.dump  src/pmc/float.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/float.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/float$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_float.h \\
+    include/pmc/pmc_scalar.h \\
+    src/pmc/float.c \\
+    src/pmc/float.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/float.c
+
+include/pmc/pmc_integer.h src/pmc/integer.c : src/pmc/integer.dump
+	$(PMC2CC) src/pmc/integer.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_integer.h" "[devel]" include
+
+src/pmc/integer.dump : vtable.dump src/pmc/default.dump src/pmc/scalar.dump  src/pmc/integer.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/integer.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/integer$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_bigint.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_integer.h \\
+    include/pmc/pmc_scalar.h \\
+    src/pmc/integer.c \\
+    src/pmc/integer.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/integer.c
+
+include/pmc/pmc_bigint.h src/pmc/bigint.c : src/pmc/bigint.dump
+	$(PMC2CC) src/pmc/bigint.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_bigint.h" "[devel]" include
+
+src/pmc/bigint.dump : vtable.dump src/pmc/default.dump  src/pmc/bigint.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/bigint.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/bigint$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_bigint.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    src/pmc/bigint.c \\
+    src/pmc/bigint.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/bigint.c
+
+include/pmc/pmc_bignum.h src/pmc/bignum.c : src/pmc/bignum.dump
+	$(PMC2CC) src/pmc/bignum.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_bignum.h" "[devel]" include
+
+src/pmc/bignum.dump : vtable.dump src/pmc/default.dump  src/pmc/bignum.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/bignum.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/bignum$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_bigint.h \\
+    include/pmc/pmc_bignum.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    src/pmc/bignum.c \\
+    src/pmc/bignum.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/bignum.c
+
+include/pmc/pmc_complex.h src/pmc/complex.c : src/pmc/complex.dump
+	$(PMC2CC) src/pmc/complex.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_complex.h" "[devel]" include
+
+src/pmc/complex.dump : vtable.dump src/pmc/default.dump  src/pmc/complex.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/complex.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/complex$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_complex.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    src/pmc/complex.c \\
+    src/pmc/complex.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/complex.c
+
+include/pmc/pmc_string.h src/pmc/string.c : src/pmc/string.dump
+	$(PMC2CC) src/pmc/string.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_string.h" "[devel]" include
+
+src/pmc/string.dump : vtable.dump src/pmc/default.dump src/pmc/scalar.dump  src/pmc/string.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/string.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/string$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_scalar.h \\
+    include/pmc/pmc_string.h \\
+    src/pmc/string.c \\
+    src/pmc/string.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/string.c
+
+include/pmc/pmc_boolean.h src/pmc/boolean.c : src/pmc/boolean.dump
+	$(PMC2CC) src/pmc/boolean.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_boolean.h" "[devel]" include
+
+src/pmc/boolean.dump : vtable.dump src/pmc/default.dump src/pmc/scalar.dump  src/pmc/boolean.pmc $(PMC2C_FILES) 
+	$(PMC2CD) src/pmc/boolean.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/boolean$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_boolean.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_scalar.h \\
+    src/pmc/boolean.c \\
+    src/pmc/boolean.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/boolean.c
+
+include/pmc/pmc_fixedintegerarray.h src/pmc/fixedintegerarray.c : src/pmc/fixedintegerarray.dump
+	$(PMC2CC) src/pmc/fixedintegerarray.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_fixedintegerarray.h" "[devel]" include
+
+src/pmc/fixedintegerarray.dump : vtable.dump src/pmc/default.dump  src/pmc/fixedintegerarray.pmc $(PMC2C_FILES) 
+	$(PMC2CD) src/pmc/fixedintegerarray.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/fixedintegerarray$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    src/pmc/fixedintegerarray.c \\
+    src/pmc/fixedintegerarray.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/fixedintegerarray.c
+
+include/pmc/pmc_iterator.h src/pmc/iterator.c : src/pmc/iterator.dump
+	$(PMC2CC) src/pmc/iterator.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_iterator.h" "[devel]" include
+
+src/pmc/iterator.dump : vtable.dump src/pmc/default.dump  src/pmc/iterator.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/iterator.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/iterator$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_iterator.h \\
+    src/pmc/iterator.c \\
+    src/pmc/iterator.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/iterator.c
+
+include/pmc/pmc_fixedstringarray.h src/pmc/fixedstringarray.c : src/pmc/fixedstringarray.dump
+	$(PMC2CC) src/pmc/fixedstringarray.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_fixedstringarray.h" "[devel]" include
+
+src/pmc/fixedstringarray.dump : vtable.dump src/pmc/default.dump  src/pmc/fixedstringarray.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/fixedstringarray.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/fixedstringarray$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_fixedstringarray.h \\
+    src/pmc/fixedstringarray.c \\
+    src/pmc/fixedstringarray.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/fixedstringarray.c
+
+include/pmc/pmc_hash.h src/pmc/hash.c : src/pmc/hash.dump
+	$(PMC2CC) src/pmc/hash.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_hash.h" "[devel]" include
+
+src/pmc/hash.dump : vtable.dump src/pmc/default.dump  src/pmc/hash.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/hash.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/hash$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_hash.h \\
+    include/pmc/pmc_hashiteratorkey.h \\
+    include/pmc/pmc_iterator.h \\
+    include/pmc/pmc_key.h \\
+    src/pmc/hash.c \\
+    src/pmc/hash.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/hash.c
+
+include/pmc/pmc_orderedhash.h src/pmc/orderedhash.c : src/pmc/orderedhash.dump
+	$(PMC2CC) src/pmc/orderedhash.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_orderedhash.h" "[devel]" include
+
+src/pmc/orderedhash.dump : vtable.dump src/pmc/default.dump  src/pmc/orderedhash.pmc $(PMC2C_FILES) 
+	$(PMC2CD) src/pmc/orderedhash.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/orderedhash$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_orderedhash.h \\
+    src/pmc/orderedhash.c \\
+    src/pmc/orderedhash.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/orderedhash.c
+
+include/pmc/pmc_oplib.h src/pmc/oplib.c : src/pmc/oplib.dump
+	$(PMC2CC) src/pmc/oplib.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_oplib.h" "[devel]" include
+
+src/pmc/oplib.dump : vtable.dump src/pmc/default.dump  src/pmc/oplib.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/oplib.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/oplib$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/oplib/core_ops.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/runcore_api.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_oplib.h \\
+    src/pmc/oplib.c \\
+    src/pmc/oplib.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/oplib.c
+
+include/pmc/pmc_opcode.h src/pmc/opcode.c : src/pmc/opcode.dump
+	$(PMC2CC) src/pmc/opcode.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_opcode.h" "[devel]" include
+
+src/pmc/opcode.dump : vtable.dump src/pmc/default.dump  src/pmc/opcode.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/opcode.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/opcode$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_opcode.h \\
+    src/pmc/opcode.c \\
+    src/pmc/opcode.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/opcode.c
+
+include/pmc/pmc_callcontext.h src/pmc/callcontext.c : src/pmc/callcontext.dump
+	$(PMC2CC) src/pmc/callcontext.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_callcontext.h" "[devel]" include
+
+src/pmc/callcontext.dump : vtable.dump src/pmc/default.dump  src/pmc/callcontext.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/callcontext.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/callcontext$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_sub.h \\
+    src/pmc/callcontext.c \\
+    src/pmc/callcontext.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/callcontext.c
+
+include/pmc/pmc_addrregistry.h src/pmc/addrregistry.c : src/pmc/addrregistry.dump
+	$(PMC2CC) src/pmc/addrregistry.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_addrregistry.h" "[devel]" include
+
+src/pmc/addrregistry.dump : vtable.dump src/pmc/default.dump  src/pmc/addrregistry.pmc $(PMC2C_FILES) 
+	$(PMC2CD) src/pmc/addrregistry.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/addrregistry$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_addrregistry.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_hash.h \\
+    src/pmc/addrregistry.c \\
+    src/pmc/addrregistry.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/addrregistry.c
+
+include/pmc/pmc_alarm.h src/pmc/alarm.c : src/pmc/alarm.dump
+	$(PMC2CC) src/pmc/alarm.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_alarm.h" "[devel]" include
+
+src/pmc/alarm.dump : vtable.dump src/pmc/default.dump  src/pmc/alarm.pmc $(PMC2C_FILES) 
+	$(PMC2CD) src/pmc/alarm.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/alarm$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/scheduler_private.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_alarm.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    src/pmc/alarm.c \\
+    src/pmc/alarm.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/alarm.c
+
+include/pmc/pmc_arrayiterator.h src/pmc/arrayiterator.c : src/pmc/arrayiterator.dump
+	$(PMC2CC) src/pmc/arrayiterator.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_arrayiterator.h" "[devel]" include
+
+src/pmc/arrayiterator.dump : vtable.dump src/pmc/default.dump src/pmc/iterator.dump  src/pmc/arrayiterator.pmc $(PMC2C_FILES) 
+	$(PMC2CD) src/pmc/arrayiterator.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/arrayiterator$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_arrayiterator.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_iterator.h \\
+    src/pmc/arrayiterator.c \\
+    src/pmc/arrayiterator.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/arrayiterator.c
+
+include/pmc/pmc_bytebuffer.h src/pmc/bytebuffer.c : src/pmc/bytebuffer.dump
+	$(PMC2CC) src/pmc/bytebuffer.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_bytebuffer.h" "[devel]" include
+
+src/pmc/bytebuffer.dump : vtable.dump src/pmc/default.dump  src/pmc/bytebuffer.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/bytebuffer.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/bytebuffer$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_bytebuffer.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    src/pmc/bytebuffer.c \\
+    src/pmc/bytebuffer.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/bytebuffer.c
+
+include/pmc/pmc_callback.h src/pmc/callback.c : src/pmc/callback.dump
+	$(PMC2CC) src/pmc/callback.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_callback.h" "[devel]" include
+
+src/pmc/callback.dump : vtable.dump src/pmc/default.dump src/pmc/task.dump  src/pmc/callback.pmc $(PMC2C_FILES) 
+	$(PMC2CD) src/pmc/callback.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/callback$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/scheduler_private.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callback.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_task.h \\
+    src/pmc/callback.c \\
+    src/pmc/callback.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/callback.c
+
+include/pmc/pmc_capture.h src/pmc/capture.c : src/pmc/capture.dump
+	$(PMC2CC) src/pmc/capture.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_capture.h" "[devel]" include
+
+src/pmc/capture.dump : vtable.dump src/pmc/default.dump  src/pmc/capture.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/capture.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/capture$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_capture.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    src/pmc/capture.c \\
+    src/pmc/capture.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/capture.c
+
+include/pmc/pmc_channel.h src/pmc/channel.c : src/pmc/channel.dump
+	$(PMC2CC) src/pmc/channel.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_channel.h" "[devel]" include
+
+src/pmc/channel.dump : vtable.dump src/pmc/default.dump  src/pmc/channel.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/channel.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/channel$(O): \\
+    include/parrot/atomic.h \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_channel.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    src/pmc/channel.c \\
+    src/pmc/channel.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/channel.c
+
+include/pmc/pmc_class.h src/pmc/class.c : src/pmc/class.dump
+	$(PMC2CC) src/pmc/class.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_class.h" "[devel]" include
+
+src/pmc/class.dump : vtable.dump src/pmc/default.dump  src/pmc/class.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/class.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/class$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/oo_private.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_class.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_namespace.h \\
+    include/pmc/pmc_object.h \\
+    src/pmc/class.c \\
+    src/pmc/class.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/class.c
+
+include/pmc/pmc_eventhandler.h src/pmc/eventhandler.c : src/pmc/eventhandler.dump
+	$(PMC2CC) src/pmc/eventhandler.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_eventhandler.h" "[devel]" include
+
+src/pmc/eventhandler.dump : vtable.dump src/pmc/default.dump src/pmc/sub.dump  src/pmc/eventhandler.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/eventhandler.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/eventhandler$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_eventhandler.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_sub.h \\
+    src/pmc/eventhandler.c \\
+    src/pmc/eventhandler.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/eventhandler.c
+
+include/pmc/pmc_exceptionhandler.h src/pmc/exceptionhandler.c : src/pmc/exceptionhandler.dump
+	$(PMC2CC) src/pmc/exceptionhandler.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_exceptionhandler.h" "[devel]" include
+
+src/pmc/exceptionhandler.dump : vtable.dump src/pmc/default.dump src/pmc/continuation.dump  src/pmc/exceptionhandler.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/exceptionhandler.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/exceptionhandler$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/oplib/ops.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_exception.h \\
+    include/pmc/pmc_exceptionhandler.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    src/pmc/exceptionhandler.c \\
+    src/pmc/exceptionhandler.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/exceptionhandler.c
+
+include/pmc/pmc_exporter.h src/pmc/exporter.c : src/pmc/exporter.dump
+	$(PMC2CC) src/pmc/exporter.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_exporter.h" "[devel]" include
+
+src/pmc/exporter.dump : vtable.dump src/pmc/default.dump  src/pmc/exporter.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/exporter.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/exporter$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_exporter.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    src/pmc/exporter.c \\
+    src/pmc/exporter.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/exporter.c
+
+include/pmc/pmc_filehandle.h src/pmc/filehandle.c : src/pmc/filehandle.dump
+	$(PMC2CC) src/pmc/filehandle.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_filehandle.h" "[devel]" include
+
+src/pmc/filehandle.dump : vtable.dump src/pmc/default.dump src/pmc/handle.dump  src/pmc/filehandle.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/filehandle.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/filehandle$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_bytebuffer.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_filehandle.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_handle.h \\
+    src/io/io_private.h \\
+    src/pmc/filehandle.c \\
+    src/pmc/filehandle.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/filehandle.c
+
+include/pmc/pmc_fixedbooleanarray.h src/pmc/fixedbooleanarray.c : src/pmc/fixedbooleanarray.dump
+	$(PMC2CC) src/pmc/fixedbooleanarray.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_fixedbooleanarray.h" "[devel]" include
+
+src/pmc/fixedbooleanarray.dump : vtable.dump src/pmc/default.dump  src/pmc/fixedbooleanarray.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/fixedbooleanarray.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/fixedbooleanarray$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedbooleanarray.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    src/pmc/fixedbooleanarray.c \\
+    src/pmc/fixedbooleanarray.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/fixedbooleanarray.c
+
+include/pmc/pmc_fixedfloatarray.h src/pmc/fixedfloatarray.c : src/pmc/fixedfloatarray.dump
+	$(PMC2CC) src/pmc/fixedfloatarray.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_fixedfloatarray.h" "[devel]" include
+
+src/pmc/fixedfloatarray.dump : vtable.dump src/pmc/default.dump  src/pmc/fixedfloatarray.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/fixedfloatarray.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/fixedfloatarray$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedfloatarray.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    src/pmc/fixedfloatarray.c \\
+    src/pmc/fixedfloatarray.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/fixedfloatarray.c
+
+include/pmc/pmc_fixedpmcarray.h src/pmc/fixedpmcarray.c : src/pmc/fixedpmcarray.dump
+	$(PMC2CC) src/pmc/fixedpmcarray.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_fixedpmcarray.h" "[devel]" include
+
+src/pmc/fixedpmcarray.dump : vtable.dump src/pmc/default.dump  src/pmc/fixedpmcarray.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/fixedpmcarray.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/fixedpmcarray$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_fixedpmcarray.h \\
+    src/pmc/fixedpmcarray.c \\
+    src/pmc/fixedpmcarray.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/fixedpmcarray.c
+
+include/pmc/pmc_handle.h src/pmc/handle.c : src/pmc/handle.dump
+	$(PMC2CC) src/pmc/handle.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_handle.h" "[devel]" include
+
+src/pmc/handle.dump : vtable.dump src/pmc/default.dump  src/pmc/handle.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/handle.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/handle$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_handle.h \\
+    src/io/io_private.h \\
+    src/pmc/handle.c \\
+    src/pmc/handle.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/handle.c
+
+include/pmc/pmc_hashiterator.h src/pmc/hashiterator.c : src/pmc/hashiterator.dump
+	$(PMC2CC) src/pmc/hashiterator.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_hashiterator.h" "[devel]" include
+
+src/pmc/hashiterator.dump : vtable.dump src/pmc/default.dump src/pmc/iterator.dump  src/pmc/hashiterator.pmc $(PMC2C_FILES) 
+	$(PMC2CD) src/pmc/hashiterator.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/hashiterator$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_hash.h \\
+    include/pmc/pmc_hashiterator.h \\
+    include/pmc/pmc_hashiteratorkey.h \\
+    include/pmc/pmc_iterator.h \\
+    src/pmc/hashiterator.c \\
+    src/pmc/hashiterator.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/hashiterator.c
+
+include/pmc/pmc_hashiteratorkey.h src/pmc/hashiteratorkey.c : src/pmc/hashiteratorkey.dump
+	$(PMC2CC) src/pmc/hashiteratorkey.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_hashiteratorkey.h" "[devel]" include
+
+src/pmc/hashiteratorkey.dump : vtable.dump src/pmc/default.dump  src/pmc/hashiteratorkey.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/hashiteratorkey.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/hashiteratorkey$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_hashiteratorkey.h \\
+    src/pmc/hashiteratorkey.c \\
+    src/pmc/hashiteratorkey.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/hashiteratorkey.c
+
+include/pmc/pmc_imageiofreeze.h src/pmc/imageiofreeze.c : src/pmc/imageiofreeze.dump
+	$(PMC2CC) src/pmc/imageiofreeze.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_imageiofreeze.h" "[devel]" include
+
+src/pmc/imageiofreeze.dump : vtable.dump src/pmc/default.dump  src/pmc/imageiofreeze.pmc $(PMC2C_FILES) 
+	$(PMC2CD) src/pmc/imageiofreeze.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/imageiofreeze$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/imageio.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_imageiofreeze.h \\
+    src/pmc/imageiofreeze.c \\
+    src/pmc/imageiofreeze.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/imageiofreeze.c
+
+include/pmc/pmc_imageiosize.h src/pmc/imageiosize.c : src/pmc/imageiosize.dump
+	$(PMC2CC) src/pmc/imageiosize.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_imageiosize.h" "[devel]" include
+
+src/pmc/imageiosize.dump : vtable.dump src/pmc/default.dump  src/pmc/imageiosize.pmc $(PMC2C_FILES) 
+	$(PMC2CD) src/pmc/imageiosize.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/imageiosize$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_imageiosize.h \\
+    src/pmc/imageiosize.c \\
+    src/pmc/imageiosize.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/imageiosize.c
+
+include/pmc/pmc_imageiostrings.h src/pmc/imageiostrings.c : src/pmc/imageiostrings.dump
+	$(PMC2CC) src/pmc/imageiostrings.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_imageiostrings.h" "[devel]" include
+
+src/pmc/imageiostrings.dump : vtable.dump src/pmc/default.dump  src/pmc/imageiostrings.pmc $(PMC2C_FILES) 
+	$(PMC2CD) src/pmc/imageiostrings.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/imageiostrings$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_imageiostrings.h \\
+    src/pmc/imageiostrings.c \\
+    src/pmc/imageiostrings.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/imageiostrings.c
+
+include/pmc/pmc_imageiothaw.h src/pmc/imageiothaw.c : src/pmc/imageiothaw.dump
+	$(PMC2CC) src/pmc/imageiothaw.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_imageiothaw.h" "[devel]" include
+
+src/pmc/imageiothaw.dump : vtable.dump src/pmc/default.dump  src/pmc/imageiothaw.pmc $(PMC2C_FILES) 
+	$(PMC2CD) src/pmc/imageiothaw.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/imageiothaw$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/imageio.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_imageiothaw.h \\
+    src/pmc/imageiothaw.c \\
+    src/pmc/imageiothaw.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/imageiothaw.c
+
+include/pmc/pmc_imccompiler.h src/pmc/imccompiler.c : src/pmc/imccompiler.dump
+	$(PMC2CC) src/pmc/imccompiler.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_imccompiler.h" "[devel]" include
+
+src/pmc/imccompiler.dump : vtable.dump src/pmc/default.dump  src/pmc/imccompiler.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/imccompiler.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/imccompiler$(O): \\
+    include/imcc/embed.h \\
+    include/imcc/yyscanner.h \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_imccompiler.h \\
+    include/pmc/pmc_sub.h \\
+    src/pmc/imccompiler.c \\
+    src/pmc/imccompiler.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/imccompiler.c
+
+include/pmc/pmc_lexinfo.h src/pmc/lexinfo.c : src/pmc/lexinfo.dump
+	$(PMC2CC) src/pmc/lexinfo.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_lexinfo.h" "[devel]" include
+
+src/pmc/lexinfo.dump : vtable.dump src/pmc/default.dump src/pmc/hash.dump  src/pmc/lexinfo.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/lexinfo.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/lexinfo$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_hash.h \\
+    include/pmc/pmc_lexinfo.h \\
+    src/pmc/lexinfo.c \\
+    src/pmc/lexinfo.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/lexinfo.c
+
+include/pmc/pmc_mappedbytearray.h src/pmc/mappedbytearray.c : src/pmc/mappedbytearray.dump
+	$(PMC2CC) src/pmc/mappedbytearray.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_mappedbytearray.h" "[devel]" include
+
+src/pmc/mappedbytearray.dump : vtable.dump src/pmc/default.dump  src/pmc/mappedbytearray.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/mappedbytearray.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/mappedbytearray$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_mappedbytearray.h \\
+    src/io/io_private.h \\
+    src/pmc/mappedbytearray.c \\
+    src/pmc/mappedbytearray.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/mappedbytearray.c
+
+include/pmc/pmc_multisub.h src/pmc/multisub.c : src/pmc/multisub.dump
+	$(PMC2CC) src/pmc/multisub.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_multisub.h" "[devel]" include
+
+src/pmc/multisub.dump : vtable.dump src/pmc/default.dump src/pmc/fixedpmcarray.dump src/pmc/resizablepmcarray.dump  src/pmc/multisub.pmc $(PMC2C_FILES) 
+	$(PMC2CD) src/pmc/multisub.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/multisub$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedpmcarray.h \\
+    include/pmc/pmc_multisub.h \\
+    include/pmc/pmc_resizablepmcarray.h \\
+    src/pmc/multisub.c \\
+    src/pmc/multisub.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/multisub.c
+
+include/pmc/pmc_namespace.h src/pmc/namespace.c : src/pmc/namespace.dump
+	$(PMC2CC) src/pmc/namespace.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_namespace.h" "[devel]" include
+
+src/pmc/namespace.dump : vtable.dump src/pmc/default.dump src/pmc/hash.dump  src/pmc/namespace.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/namespace.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/namespace$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_hash.h \\
+    include/pmc/pmc_namespace.h \\
+    include/pmc/pmc_sub.h \\
+    src/pmc/namespace.c \\
+    src/pmc/namespace.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/namespace.c
+
+include/pmc/pmc_nativepccmethod.h src/pmc/nativepccmethod.c : src/pmc/nativepccmethod.dump
+	$(PMC2CC) src/pmc/nativepccmethod.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_nativepccmethod.h" "[devel]" include
+
+src/pmc/nativepccmethod.dump : vtable.dump src/pmc/default.dump  src/pmc/nativepccmethod.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/nativepccmethod.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/nativepccmethod$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_nativepccmethod.h \\
+    src/pmc/nativepccmethod.c \\
+    src/pmc/nativepccmethod.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/nativepccmethod.c
+
+include/pmc/pmc_object.h src/pmc/object.c : src/pmc/object.dump
+	$(PMC2CC) src/pmc/object.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_object.h" "[devel]" include
+
+src/pmc/object.dump : vtable.dump src/pmc/default.dump  src/pmc/object.pmc $(PMC2C_FILES) 
+	$(PMC2CD) src/pmc/object.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/object$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/oo_private.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_class.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_object.h \\
+    lib/Parrot/Pmc2c/PMC/Object.pm \\
+    src/pmc/object.c \\
+    src/pmc/object.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/object.c
+
+include/pmc/pmc_orderedhashiterator.h src/pmc/orderedhashiterator.c : src/pmc/orderedhashiterator.dump
+	$(PMC2CC) src/pmc/orderedhashiterator.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_orderedhashiterator.h" "[devel]" include
+
+src/pmc/orderedhashiterator.dump : vtable.dump src/pmc/default.dump src/pmc/iterator.dump  src/pmc/orderedhashiterator.pmc $(PMC2C_FILES) 
+	$(PMC2CD) src/pmc/orderedhashiterator.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/orderedhashiterator$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_hashiteratorkey.h \\
+    include/pmc/pmc_iterator.h \\
+    include/pmc/pmc_orderedhash.h \\
+    include/pmc/pmc_orderedhashiterator.h \\
+    src/pmc/orderedhashiterator.c \\
+    src/pmc/orderedhashiterator.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/orderedhashiterator.c
+
+include/pmc/pmc_os.h src/pmc/os.c : src/pmc/os.dump
+	$(PMC2CC) src/pmc/os.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_os.h" "[devel]" include
+
+src/pmc/os.dump : vtable.dump src/pmc/default.dump  src/pmc/os.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/os.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/os$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_os.h \\
+    src/pmc/os.c \\
+    src/pmc/os.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/os.c
+
+include/pmc/pmc_packfile.h src/pmc/packfile.c : src/pmc/packfile.dump
+	$(PMC2CC) src/pmc/packfile.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_packfile.h" "[devel]" include
+
+src/pmc/packfile.dump : vtable.dump src/pmc/default.dump  src/pmc/packfile.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/packfile.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/packfile$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_packfile.h \\
+    include/pmc/pmc_packfiledirectory.h \\
+    src/pmc/packfile.c \\
+    src/pmc/packfile.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/packfile.c
+
+include/pmc/pmc_packfileannotation.h src/pmc/packfileannotation.c : src/pmc/packfileannotation.dump
+	$(PMC2CC) src/pmc/packfileannotation.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_packfileannotation.h" "[devel]" include
+
+src/pmc/packfileannotation.dump : vtable.dump src/pmc/default.dump  src/pmc/packfileannotation.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/packfileannotation.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/packfileannotation$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_packfileannotation.h \\
+    src/pmc/packfileannotation.c \\
+    src/pmc/packfileannotation.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/packfileannotation.c
+
+include/pmc/pmc_packfileannotations.h src/pmc/packfileannotations.c : src/pmc/packfileannotations.dump
+	$(PMC2CC) src/pmc/packfileannotations.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_packfileannotations.h" "[devel]" include
+
+src/pmc/packfileannotations.dump : vtable.dump src/pmc/default.dump src/pmc/packfilesegment.dump  src/pmc/packfileannotations.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/packfileannotations.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/packfileannotations$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_packfileannotation.h \\
+    include/pmc/pmc_packfileannotations.h \\
+    include/pmc/pmc_packfilesegment.h \\
+    src/pmc/packfileannotations.c \\
+    src/pmc/packfileannotations.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/packfileannotations.c
+
+include/pmc/pmc_packfilebytecodesegment.h src/pmc/packfilebytecodesegment.c : src/pmc/packfilebytecodesegment.dump
+	$(PMC2CC) src/pmc/packfilebytecodesegment.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_packfilebytecodesegment.h" "[devel]" include
+
+src/pmc/packfilebytecodesegment.dump : vtable.dump src/pmc/default.dump src/pmc/packfilesegment.dump src/pmc/packfilerawsegment.dump  src/pmc/packfilebytecodesegment.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/packfilebytecodesegment.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/packfilebytecodesegment$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_packfilebytecodesegment.h \\
+    include/pmc/pmc_packfileopmap.h \\
+    include/pmc/pmc_packfilerawsegment.h \\
+    include/pmc/pmc_packfilesegment.h \\
+    src/pmc/packfilebytecodesegment.c \\
+    src/pmc/packfilebytecodesegment.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/packfilebytecodesegment.c
+
+include/pmc/pmc_packfileconstanttable.h src/pmc/packfileconstanttable.c : src/pmc/packfileconstanttable.dump
+	$(PMC2CC) src/pmc/packfileconstanttable.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_packfileconstanttable.h" "[devel]" include
+
+src/pmc/packfileconstanttable.dump : vtable.dump src/pmc/default.dump src/pmc/packfilesegment.dump  src/pmc/packfileconstanttable.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/packfileconstanttable.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/packfileconstanttable$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_packfileconstanttable.h \\
+    include/pmc/pmc_packfilesegment.h \\
+    src/pmc/packfileconstanttable.c \\
+    src/pmc/packfileconstanttable.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/packfileconstanttable.c
+
+include/pmc/pmc_packfiledebug.h src/pmc/packfiledebug.c : src/pmc/packfiledebug.dump
+	$(PMC2CC) src/pmc/packfiledebug.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_packfiledebug.h" "[devel]" include
+
+src/pmc/packfiledebug.dump : vtable.dump src/pmc/default.dump src/pmc/packfilesegment.dump src/pmc/packfilerawsegment.dump  src/pmc/packfiledebug.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/packfiledebug.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/packfiledebug$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_packfiledebug.h \\
+    include/pmc/pmc_packfilerawsegment.h \\
+    include/pmc/pmc_packfilesegment.h \\
+    src/pmc/packfiledebug.c \\
+    src/pmc/packfiledebug.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/packfiledebug.c
+
+include/pmc/pmc_packfiledirectory.h src/pmc/packfiledirectory.c : src/pmc/packfiledirectory.dump
+	$(PMC2CC) src/pmc/packfiledirectory.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_packfiledirectory.h" "[devel]" include
+
+src/pmc/packfiledirectory.dump : vtable.dump src/pmc/default.dump src/pmc/packfilesegment.dump  src/pmc/packfiledirectory.pmc $(PMC2C_FILES) 
+	$(PMC2CD) src/pmc/packfiledirectory.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/packfiledirectory$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_packfiledirectory.h \\
+    include/pmc/pmc_packfilesegment.h \\
+    src/pmc/packfiledirectory.c \\
+    src/pmc/packfiledirectory.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/packfiledirectory.c
+
+include/pmc/pmc_packfileopmap.h src/pmc/packfileopmap.c : src/pmc/packfileopmap.dump
+	$(PMC2CC) src/pmc/packfileopmap.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_packfileopmap.h" "[devel]" include
+
+src/pmc/packfileopmap.dump : vtable.dump src/pmc/default.dump  src/pmc/packfileopmap.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/packfileopmap.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/packfileopmap$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_packfileopmap.h \\
+    include/pmc/pmc_parrotlibrary.h \\
+    src/pmc/packfileopmap.c \\
+    src/pmc/packfileopmap.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/packfileopmap.c
+
+include/pmc/pmc_packfilerawsegment.h src/pmc/packfilerawsegment.c : src/pmc/packfilerawsegment.dump
+	$(PMC2CC) src/pmc/packfilerawsegment.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_packfilerawsegment.h" "[devel]" include
+
+src/pmc/packfilerawsegment.dump : vtable.dump src/pmc/default.dump src/pmc/packfilesegment.dump  src/pmc/packfilerawsegment.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/packfilerawsegment.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/packfilerawsegment$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_packfilerawsegment.h \\
+    include/pmc/pmc_packfilesegment.h \\
+    src/pmc/packfilerawsegment.c \\
+    src/pmc/packfilerawsegment.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/packfilerawsegment.c
+
+include/pmc/pmc_packfilesegment.h src/pmc/packfilesegment.c : src/pmc/packfilesegment.dump
+	$(PMC2CC) src/pmc/packfilesegment.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_packfilesegment.h" "[devel]" include
+
+src/pmc/packfilesegment.dump : vtable.dump src/pmc/default.dump  src/pmc/packfilesegment.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/packfilesegment.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/packfilesegment$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_packfilesegment.h \\
+    src/pmc/packfilesegment.c \\
+    src/pmc/packfilesegment.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/packfilesegment.c
+
+include/pmc/pmc_packfileview.h src/pmc/packfileview.c : src/pmc/packfileview.dump
+	$(PMC2CC) src/pmc/packfileview.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_packfileview.h" "[devel]" include
+
+src/pmc/packfileview.dump : vtable.dump src/pmc/default.dump  src/pmc/packfileview.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/packfileview.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/packfileview$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_packfileview.h \\
+    src/pmc/packfileview.c \\
+    src/pmc/packfileview.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/packfileview.c
+
+include/pmc/pmc_pmclist.h src/pmc/pmclist.c : src/pmc/pmclist.dump
+	$(PMC2CC) src/pmc/pmclist.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_pmclist.h" "[devel]" include
+
+src/pmc/pmclist.dump : vtable.dump src/pmc/default.dump  src/pmc/pmclist.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/pmclist.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/pmclist$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_pmclist.h \\
+    src/pmc/pmclist.c \\
+    src/pmc/pmclist.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/pmclist.c
+
+include/pmc/pmc_pmcproxy.h src/pmc/pmcproxy.c : src/pmc/pmcproxy.dump
+	$(PMC2CC) src/pmc/pmcproxy.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_pmcproxy.h" "[devel]" include
+
+src/pmc/pmcproxy.dump : vtable.dump src/pmc/default.dump src/pmc/class.dump  src/pmc/pmcproxy.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/pmcproxy.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/pmcproxy$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/oo_private.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_class.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_pmcproxy.h \\
+    src/pmc/pmcproxy.c \\
+    src/pmc/pmcproxy.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/pmcproxy.c
+
+include/pmc/pmc_proxy.h src/pmc/proxy.c : src/pmc/proxy.dump
+	$(PMC2CC) src/pmc/proxy.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_proxy.h" "[devel]" include
+
+src/pmc/proxy.dump : vtable.dump src/pmc/default.dump  src/pmc/proxy.pmc $(PMC2C_FILES) 
+	$(PMC2CD) src/pmc/proxy.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/proxy$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_proxy.h \\
+    lib/Parrot/Pmc2c/PMC/Proxy.pm \\
+    src/pmc/proxy.c \\
+    src/pmc/proxy.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/proxy.c
+
+include/pmc/pmc_ptr.h src/pmc/ptr.c : src/pmc/ptr.dump
+	$(PMC2CC) src/pmc/ptr.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_ptr.h" "[devel]" include
+
+src/pmc/ptr.dump : vtable.dump src/pmc/default.dump  src/pmc/ptr.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/ptr.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/ptr$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_ptr.h \\
+    src/pmc/ptr.c \\
+    src/pmc/ptr.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/ptr.c
+
+include/pmc/pmc_ptrbuf.h src/pmc/ptrbuf.c : src/pmc/ptrbuf.dump
+	$(PMC2CC) src/pmc/ptrbuf.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_ptrbuf.h" "[devel]" include
+
+src/pmc/ptrbuf.dump : vtable.dump src/pmc/default.dump src/pmc/ptr.dump  src/pmc/ptrbuf.pmc $(PMC2C_FILES) 
+	$(PMC2CD) src/pmc/ptrbuf.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/ptrbuf$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_ptr.h \\
+    include/pmc/pmc_ptrbuf.h \\
+    src/pmc/ptrbuf.c \\
+    src/pmc/ptrbuf.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/ptrbuf.c
+
+include/pmc/pmc_ptrobj.h src/pmc/ptrobj.c : src/pmc/ptrobj.dump
+	$(PMC2CC) src/pmc/ptrobj.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_ptrobj.h" "[devel]" include
+
+src/pmc/ptrobj.dump : vtable.dump src/pmc/default.dump src/pmc/ptr.dump src/pmc/ptrbuf.dump  src/pmc/ptrobj.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/ptrobj.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/ptrobj$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_ptr.h \\
+    include/pmc/pmc_ptrbuf.h \\
+    include/pmc/pmc_ptrobj.h \\
+    src/pmc/ptrobj.c \\
+    src/pmc/ptrobj.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/ptrobj.c
+
+include/pmc/pmc_resizablebooleanarray.h src/pmc/resizablebooleanarray.c : src/pmc/resizablebooleanarray.dump
+	$(PMC2CC) src/pmc/resizablebooleanarray.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_resizablebooleanarray.h" "[devel]" include
+
+src/pmc/resizablebooleanarray.dump : vtable.dump src/pmc/default.dump src/pmc/fixedbooleanarray.dump  src/pmc/resizablebooleanarray.pmc $(PMC2C_FILES) 
+	$(PMC2CD) src/pmc/resizablebooleanarray.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/resizablebooleanarray$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedbooleanarray.h \\
+    include/pmc/pmc_resizablebooleanarray.h \\
+    src/pmc/resizablebooleanarray.c \\
+    src/pmc/resizablebooleanarray.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/resizablebooleanarray.c
+
+include/pmc/pmc_resizablefloatarray.h src/pmc/resizablefloatarray.c : src/pmc/resizablefloatarray.dump
+	$(PMC2CC) src/pmc/resizablefloatarray.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_resizablefloatarray.h" "[devel]" include
+
+src/pmc/resizablefloatarray.dump : vtable.dump src/pmc/default.dump src/pmc/fixedfloatarray.dump  src/pmc/resizablefloatarray.pmc $(PMC2C_FILES) 
+	$(PMC2CD) src/pmc/resizablefloatarray.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/resizablefloatarray$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedfloatarray.h \\
+    include/pmc/pmc_resizablefloatarray.h \\
+    src/pmc/resizablefloatarray.c \\
+    src/pmc/resizablefloatarray.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/resizablefloatarray.c
+
+include/pmc/pmc_resizableintegerarray.h src/pmc/resizableintegerarray.c : src/pmc/resizableintegerarray.dump
+	$(PMC2CC) src/pmc/resizableintegerarray.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_resizableintegerarray.h" "[devel]" include
+
+src/pmc/resizableintegerarray.dump : vtable.dump src/pmc/default.dump src/pmc/fixedintegerarray.dump  src/pmc/resizableintegerarray.pmc $(PMC2C_FILES) 
+	$(PMC2CD) src/pmc/resizableintegerarray.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/resizableintegerarray$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_resizableintegerarray.h \\
+    src/pmc/resizableintegerarray.c \\
+    src/pmc/resizableintegerarray.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/resizableintegerarray.c
+
+include/pmc/pmc_resizablepmcarray.h src/pmc/resizablepmcarray.c : src/pmc/resizablepmcarray.dump
+	$(PMC2CC) src/pmc/resizablepmcarray.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_resizablepmcarray.h" "[devel]" include
+
+src/pmc/resizablepmcarray.dump : vtable.dump src/pmc/default.dump src/pmc/fixedpmcarray.dump  src/pmc/resizablepmcarray.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/resizablepmcarray.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/resizablepmcarray$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_fixedpmcarray.h \\
+    include/pmc/pmc_resizablepmcarray.h \\
+    src/pmc/resizablepmcarray.c \\
+    src/pmc/resizablepmcarray.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/resizablepmcarray.c
+
+include/pmc/pmc_resizablestringarray.h src/pmc/resizablestringarray.c : src/pmc/resizablestringarray.dump
+	$(PMC2CC) src/pmc/resizablestringarray.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_resizablestringarray.h" "[devel]" include
+
+src/pmc/resizablestringarray.dump : vtable.dump src/pmc/default.dump src/pmc/fixedstringarray.dump  src/pmc/resizablestringarray.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/resizablestringarray.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/resizablestringarray$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_fixedstringarray.h \\
+    include/pmc/pmc_resizablestringarray.h \\
+    src/pmc/resizablestringarray.c \\
+    src/pmc/resizablestringarray.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/resizablestringarray.c
+
+include/pmc/pmc_role.h src/pmc/role.c : src/pmc/role.dump
+	$(PMC2CC) src/pmc/role.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_role.h" "[devel]" include
+
+src/pmc/role.dump : vtable.dump src/pmc/default.dump  src/pmc/role.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/role.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/role$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_namespace.h \\
+    include/pmc/pmc_role.h \\
+    src/pmc/role.c \\
+    src/pmc/role.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/role.c
+
+include/pmc/pmc_scalar.h src/pmc/scalar.c : src/pmc/scalar.dump
+	$(PMC2CC) src/pmc/scalar.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_scalar.h" "[devel]" include
+
+src/pmc/scalar.dump : vtable.dump src/pmc/default.dump  src/pmc/scalar.pmc $(PMC2C_FILES) 
+	$(PMC2CD) src/pmc/scalar.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/scalar$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_bigint.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_scalar.h \\
+    src/pmc/scalar.c \\
+    src/pmc/scalar.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/scalar.c
+
+include/pmc/pmc_scheduler.h src/pmc/scheduler.c : src/pmc/scheduler.dump
+	$(PMC2CC) src/pmc/scheduler.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_scheduler.h" "[devel]" include
+
+src/pmc/scheduler.dump : vtable.dump src/pmc/default.dump  src/pmc/scheduler.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/scheduler.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/scheduler$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/scheduler_private.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_scheduler.h \\
+    src/pmc/scheduler.c \\
+    src/pmc/scheduler.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/scheduler.c
+
+include/pmc/pmc_schedulermessage.h src/pmc/schedulermessage.c : src/pmc/schedulermessage.dump
+	$(PMC2CC) src/pmc/schedulermessage.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_schedulermessage.h" "[devel]" include
+
+src/pmc/schedulermessage.dump : vtable.dump src/pmc/default.dump  src/pmc/schedulermessage.pmc $(PMC2C_FILES) 
+	$(PMC2CD) src/pmc/schedulermessage.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/schedulermessage$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/scheduler_private.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_schedulermessage.h \\
+    src/pmc/schedulermessage.c \\
+    src/pmc/schedulermessage.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/schedulermessage.c
+
+include/pmc/pmc_sockaddr.h src/pmc/sockaddr.c : src/pmc/sockaddr.dump
+	$(PMC2CC) src/pmc/sockaddr.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_sockaddr.h" "[devel]" include
+
+src/pmc/sockaddr.dump : vtable.dump src/pmc/default.dump  src/pmc/sockaddr.pmc $(PMC2C_FILES) 
+	$(PMC2CD) src/pmc/sockaddr.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/sockaddr$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_sockaddr.h \\
+    src/pmc/sockaddr.c \\
+    src/pmc/sockaddr.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/sockaddr.c
+
+include/pmc/pmc_socket.h src/pmc/socket.c : src/pmc/socket.dump
+	$(PMC2CC) src/pmc/socket.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_socket.h" "[devel]" include
+
+src/pmc/socket.dump : vtable.dump src/pmc/default.dump src/pmc/handle.dump  src/pmc/socket.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/socket.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/socket$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_handle.h \\
+    include/pmc/pmc_sockaddr.h \\
+    include/pmc/pmc_socket.h \\
+    src/io/io_private.h \\
+    src/pmc/socket.c \\
+    src/pmc/socket.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/socket.c
+
+include/pmc/pmc_stringbuilder.h src/pmc/stringbuilder.c : src/pmc/stringbuilder.dump
+	$(PMC2CC) src/pmc/stringbuilder.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_stringbuilder.h" "[devel]" include
+
+src/pmc/stringbuilder.dump : vtable.dump src/pmc/default.dump  src/pmc/stringbuilder.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/stringbuilder.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/stringbuilder$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_stringbuilder.h \\
+    src/pmc/stringbuilder.c \\
+    src/pmc/stringbuilder.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/stringbuilder.c
+
+include/pmc/pmc_stringhandle.h src/pmc/stringhandle.c : src/pmc/stringhandle.dump
+	$(PMC2CC) src/pmc/stringhandle.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_stringhandle.h" "[devel]" include
+
+src/pmc/stringhandle.dump : vtable.dump src/pmc/default.dump src/pmc/handle.dump  src/pmc/stringhandle.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/stringhandle.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/stringhandle$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_handle.h \\
+    include/pmc/pmc_stringhandle.h \\
+    src/io/io_private.h \\
+    src/pmc/stringhandle.c \\
+    src/pmc/stringhandle.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/stringhandle.c
+
+include/pmc/pmc_stringiterator.h src/pmc/stringiterator.c : src/pmc/stringiterator.dump
+	$(PMC2CC) src/pmc/stringiterator.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_stringiterator.h" "[devel]" include
+
+src/pmc/stringiterator.dump : vtable.dump src/pmc/default.dump src/pmc/iterator.dump  src/pmc/stringiterator.pmc $(PMC2C_FILES) 
+	$(PMC2CD) src/pmc/stringiterator.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/stringiterator$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_iterator.h \\
+    include/pmc/pmc_stringiterator.h \\
+    src/pmc/stringiterator.c \\
+    src/pmc/stringiterator.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/stringiterator.c
+
+include/pmc/pmc_structview.h src/pmc/structview.c : src/pmc/structview.dump
+	$(PMC2CC) src/pmc/structview.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_structview.h" "[devel]" include
+
+src/pmc/structview.dump : vtable.dump src/pmc/default.dump  src/pmc/structview.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/structview.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/structview$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_ptrobj.h \\
+    include/pmc/pmc_structview.h \\
+    src/pmc/structview.c \\
+    src/pmc/structview.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/structview.c
+
+include/pmc/pmc_task.h src/pmc/task.c : src/pmc/task.dump
+	$(PMC2CC) src/pmc/task.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_task.h" "[devel]" include
+
+src/pmc/task.dump : vtable.dump src/pmc/default.dump  src/pmc/task.pmc $(PMC2C_FILES)  include/pmc/pmc_fixedintegerarray.h
+	$(PMC2CD) src/pmc/task.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/task$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/scheduler_private.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_fixedintegerarray.h \\
+    include/pmc/pmc_proxy.h \\
+    include/pmc/pmc_scheduler.h \\
+    include/pmc/pmc_task.h \\
+    src/pmc/task.c \\
+    src/pmc/task.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/task.c
+
+include/pmc/pmc_undef.h src/pmc/undef.c : src/pmc/undef.dump
+	$(PMC2CC) src/pmc/undef.pmc
+	@$(ADDGENERATED) "include/pmc/pmc_undef.h" "[devel]" include
+
+src/pmc/undef.dump : vtable.dump src/pmc/default.dump  src/pmc/undef.pmc $(PMC2C_FILES) 
+	$(PMC2CD) src/pmc/undef.pmc
+
+## SUFFIX OVERRIDE -Warnings
+src/pmc/undef$(O): \\
+    include/parrot/caches.h \\
+    include/parrot/call.h \\
+    include/parrot/cclass.h \\
+    include/parrot/compiler.h \\
+    include/parrot/config.h \\
+    include/parrot/context.h \\
+    include/parrot/core_pmcs.h \\
+    include/parrot/core_types.h \\
+    include/parrot/datatypes.h \\
+    include/parrot/debugger.h \\
+    include/parrot/dynext.h \\
+    include/parrot/encoding.h \\
+    include/parrot/enums.h \\
+    include/parrot/exceptions.h \\
+    include/parrot/exit.h \\
+    include/parrot/extend.h \\
+    include/parrot/extend_vtable.h \\
+    include/parrot/feature.h \\
+    include/parrot/gc_api.h \\
+    include/parrot/global_setup.h \\
+    include/parrot/has_header.h \\
+    include/parrot/hash.h \\
+    include/parrot/hll.h \\
+    include/parrot/interpreter.h \\
+    include/parrot/io.h \\
+    include/parrot/key.h \\
+    include/parrot/library.h \\
+    include/parrot/memory.h \\
+    include/parrot/misc.h \\
+    include/parrot/multidispatch.h \\
+    include/parrot/namespace.h \\
+    include/parrot/nci.h \\
+    include/parrot/oo.h \\
+    include/parrot/op.h \\
+    include/parrot/oplib.h \\
+    include/parrot/packfile.h \\
+    include/parrot/parrot.h \\
+    include/parrot/pbcversion.h \\
+    include/parrot/platform_interface.h \\
+    include/parrot/pmc.h \\
+    include/parrot/pmc_freeze.h \\
+    include/parrot/pobj.h \\
+    include/parrot/scheduler.h \\
+    include/parrot/settings.h \\
+    include/parrot/string.h \\
+    include/parrot/string_funcs.h \\
+    include/parrot/sub.h \\
+    include/parrot/vtable.h \\
+    include/parrot/vtables.h \\
+    include/parrot/warnings.h \\
+    include/pmc/pmc_callcontext.h \\
+    include/pmc/pmc_continuation.h \\
+    include/pmc/pmc_default.h \\
+    include/pmc/pmc_object.h \\
+    include/pmc/pmc_undef.h \\
+    src/pmc/undef.c \\
+    src/pmc/undef.str
+	$(CC) $(CFLAGS)  -fPIC  -I$(@D)/. -o $@ -c src/pmc/undef.c
+
+',
+  'TEMP_pmc_classes_o' => ' src/pmc/default$(O) src/pmc/null$(O) src/pmc/env$(O) src/pmc/key$(O) src/pmc/unmanagedstruct$(O) src/pmc/managedstruct$(O) src/pmc/exception$(O) src/pmc/parrotlibrary$(O) src/pmc/parrotinterpreter$(O) src/pmc/lexpad$(O) src/pmc/timer$(O) src/pmc/pointer$(O) src/pmc/sub$(O) src/pmc/continuation$(O) src/pmc/coroutine$(O) src/pmc/nci$(O) src/pmc/float$(O) src/pmc/integer$(O) src/pmc/bigint$(O) src/pmc/bignum$(O) src/pmc/complex$(O) src/pmc/string$(O) src/pmc/boolean$(O) src/pmc/fixedintegerarray$(O) src/pmc/iterator$(O) src/pmc/fixedstringarray$(O) src/pmc/hash$(O) src/pmc/orderedhash$(O) src/pmc/oplib$(O) src/pmc/opcode$(O) src/pmc/callcontext$(O) src/pmc/addrregistry$(O) src/pmc/alarm$(O) src/pmc/arrayiterator$(O) src/pmc/bytebuffer$(O) src/pmc/callback$(O) src/pmc/capture$(O) src/pmc/channel$(O) src/pmc/class$(O) src/pmc/eventhandler$(O) src/pmc/exceptionhandler$(O) src/pmc/exporter$(O) src/pmc/filehandle$(O) src/pmc/fixedbooleanarray$(O) src/pmc/fixedfloatarray$(O) src/pmc/fixedpmcarray$(O) src/pmc/handle$(O) src/pmc/hashiterator$(O) src/pmc/hashiteratorkey$(O) src/pmc/imageiofreeze$(O) src/pmc/imageiosize$(O) src/pmc/imageiostrings$(O) src/pmc/imageiothaw$(O) src/pmc/imccompiler$(O) src/pmc/lexinfo$(O) src/pmc/mappedbytearray$(O) src/pmc/multisub$(O) src/pmc/namespace$(O) src/pmc/nativepccmethod$(O) src/pmc/object$(O) src/pmc/orderedhashiterator$(O) src/pmc/os$(O) src/pmc/packfile$(O) src/pmc/packfileannotation$(O) src/pmc/packfileannotations$(O) src/pmc/packfilebytecodesegment$(O) src/pmc/packfileconstanttable$(O) src/pmc/packfiledebug$(O) src/pmc/packfiledirectory$(O) src/pmc/packfileopmap$(O) src/pmc/packfilerawsegment$(O) src/pmc/packfilesegment$(O) src/pmc/packfileview$(O) src/pmc/pmclist$(O) src/pmc/pmcproxy$(O) src/pmc/proxy$(O) src/pmc/ptr$(O) src/pmc/ptrbuf$(O) src/pmc/ptrobj$(O) src/pmc/resizablebooleanarray$(O) src/pmc/resizablefloatarray$(O) src/pmc/resizableintegerarray$(O) src/pmc/resizablepmcarray$(O) src/pmc/resizablestringarray$(O) src/pmc/role$(O) src/pmc/scalar$(O) src/pmc/scheduler$(O) src/pmc/schedulermessage$(O) src/pmc/sockaddr$(O) src/pmc/socket$(O) src/pmc/stringbuilder$(O) src/pmc/stringhandle$(O) src/pmc/stringiterator$(O) src/pmc/structview$(O) src/pmc/task$(O) src/pmc/undef$(O)',
+  'TEMP_pmc_classes_pmc' => ' src/pmc/default.pmc src/pmc/null.pmc src/pmc/env.pmc src/pmc/key.pmc src/pmc/unmanagedstruct.pmc src/pmc/managedstruct.pmc src/pmc/exception.pmc src/pmc/parrotlibrary.pmc src/pmc/parrotinterpreter.pmc src/pmc/lexpad.pmc src/pmc/timer.pmc src/pmc/pointer.pmc src/pmc/sub.pmc src/pmc/continuation.pmc src/pmc/coroutine.pmc src/pmc/nci.pmc src/pmc/float.pmc src/pmc/integer.pmc src/pmc/bigint.pmc src/pmc/bignum.pmc src/pmc/complex.pmc src/pmc/string.pmc src/pmc/boolean.pmc src/pmc/fixedintegerarray.pmc src/pmc/iterator.pmc src/pmc/fixedstringarray.pmc src/pmc/hash.pmc src/pmc/orderedhash.pmc src/pmc/oplib.pmc src/pmc/opcode.pmc src/pmc/callcontext.pmc src/pmc/addrregistry.pmc src/pmc/alarm.pmc src/pmc/arrayiterator.pmc src/pmc/bytebuffer.pmc src/pmc/callback.pmc src/pmc/capture.pmc src/pmc/channel.pmc src/pmc/class.pmc src/pmc/eventhandler.pmc src/pmc/exceptionhandler.pmc src/pmc/exporter.pmc src/pmc/filehandle.pmc src/pmc/fixedbooleanarray.pmc src/pmc/fixedfloatarray.pmc src/pmc/fixedpmcarray.pmc src/pmc/handle.pmc src/pmc/hashiterator.pmc src/pmc/hashiteratorkey.pmc src/pmc/imageiofreeze.pmc src/pmc/imageiosize.pmc src/pmc/imageiostrings.pmc src/pmc/imageiothaw.pmc src/pmc/imccompiler.pmc src/pmc/lexinfo.pmc src/pmc/mappedbytearray.pmc src/pmc/multisub.pmc src/pmc/namespace.pmc src/pmc/nativepccmethod.pmc src/pmc/object.pmc src/pmc/orderedhashiterator.pmc src/pmc/os.pmc src/pmc/packfile.pmc src/pmc/packfileannotation.pmc src/pmc/packfileannotations.pmc src/pmc/packfilebytecodesegment.pmc src/pmc/packfileconstanttable.pmc src/pmc/packfiledebug.pmc src/pmc/packfiledirectory.pmc src/pmc/packfileopmap.pmc src/pmc/packfilerawsegment.pmc src/pmc/packfilesegment.pmc src/pmc/packfileview.pmc src/pmc/pmclist.pmc src/pmc/pmcproxy.pmc src/pmc/proxy.pmc src/pmc/ptr.pmc src/pmc/ptrbuf.pmc src/pmc/ptrobj.pmc src/pmc/resizablebooleanarray.pmc src/pmc/resizablefloatarray.pmc src/pmc/resizableintegerarray.pmc src/pmc/resizablepmcarray.pmc src/pmc/resizablestringarray.pmc src/pmc/role.pmc src/pmc/scalar.pmc src/pmc/scheduler.pmc src/pmc/schedulermessage.pmc src/pmc/sockaddr.pmc src/pmc/socket.pmc src/pmc/stringbuilder.pmc src/pmc/stringhandle.pmc src/pmc/stringiterator.pmc src/pmc/structview.pmc src/pmc/task.pmc src/pmc/undef.pmc',
+  'TEMP_pmc_classes_str' => ' src/pmc/default.str src/pmc/null.str src/pmc/env.str src/pmc/key.str src/pmc/unmanagedstruct.str src/pmc/managedstruct.str src/pmc/exception.str src/pmc/parrotlibrary.str src/pmc/parrotinterpreter.str src/pmc/lexpad.str src/pmc/timer.str src/pmc/pointer.str src/pmc/sub.str src/pmc/continuation.str src/pmc/coroutine.str src/pmc/nci.str src/pmc/float.str src/pmc/integer.str src/pmc/bigint.str src/pmc/bignum.str src/pmc/complex.str src/pmc/string.str src/pmc/boolean.str src/pmc/fixedintegerarray.str src/pmc/iterator.str src/pmc/fixedstringarray.str src/pmc/hash.str src/pmc/orderedhash.str src/pmc/oplib.str src/pmc/opcode.str src/pmc/callcontext.str src/pmc/addrregistry.str src/pmc/alarm.str src/pmc/arrayiterator.str src/pmc/bytebuffer.str src/pmc/callback.str src/pmc/capture.str src/pmc/channel.str src/pmc/class.str src/pmc/eventhandler.str src/pmc/exceptionhandler.str src/pmc/exporter.str src/pmc/filehandle.str src/pmc/fixedbooleanarray.str src/pmc/fixedfloatarray.str src/pmc/fixedpmcarray.str src/pmc/handle.str src/pmc/hashiterator.str src/pmc/hashiteratorkey.str src/pmc/imageiofreeze.str src/pmc/imageiosize.str src/pmc/imageiostrings.str src/pmc/imageiothaw.str src/pmc/imccompiler.str src/pmc/lexinfo.str src/pmc/mappedbytearray.str src/pmc/multisub.str src/pmc/namespace.str src/pmc/nativepccmethod.str src/pmc/object.str src/pmc/orderedhashiterator.str src/pmc/os.str src/pmc/packfile.str src/pmc/packfileannotation.str src/pmc/packfileannotations.str src/pmc/packfilebytecodesegment.str src/pmc/packfileconstanttable.str src/pmc/packfiledebug.str src/pmc/packfiledirectory.str src/pmc/packfileopmap.str src/pmc/packfilerawsegment.str src/pmc/packfilesegment.str src/pmc/packfileview.str src/pmc/pmclist.str src/pmc/pmcproxy.str src/pmc/proxy.str src/pmc/ptr.str src/pmc/ptrbuf.str src/pmc/ptrobj.str src/pmc/resizablebooleanarray.str src/pmc/resizablefloatarray.str src/pmc/resizableintegerarray.str src/pmc/resizablepmcarray.str src/pmc/resizablestringarray.str src/pmc/role.str src/pmc/scalar.str src/pmc/scheduler.str src/pmc/schedulermessage.str src/pmc/sockaddr.str src/pmc/socket.str src/pmc/stringbuilder.str src/pmc/stringhandle.str src/pmc/stringiterator.str src/pmc/structview.str src/pmc/task.str src/pmc/undef.str',
+  'TEMP_pmc_o' => 'default$(O) null$(O) env$(O) key$(O) unmanagedstruct$(O) managedstruct$(O) exception$(O) parrotlibrary$(O) parrotinterpreter$(O) lexpad$(O) timer$(O) pointer$(O) sub$(O) continuation$(O) coroutine$(O) nci$(O) float$(O) integer$(O) bigint$(O) bignum$(O) complex$(O) string$(O) boolean$(O) fixedintegerarray$(O) iterator$(O) fixedstringarray$(O) hash$(O) orderedhash$(O) oplib$(O) opcode$(O) callcontext$(O) addrregistry$(O) alarm$(O) arrayiterator$(O) bytebuffer$(O) callback$(O) capture$(O) channel$(O) class$(O) eventhandler$(O) exceptionhandler$(O) exporter$(O) filehandle$(O) fixedbooleanarray$(O) fixedfloatarray$(O) fixedpmcarray$(O) handle$(O) hashiterator$(O) hashiteratorkey$(O) imageiofreeze$(O) imageiosize$(O) imageiostrings$(O) imageiothaw$(O) imccompiler$(O) lexinfo$(O) mappedbytearray$(O) multisub$(O) namespace$(O) nativepccmethod$(O) object$(O) orderedhashiterator$(O) os$(O) packfile$(O) packfileannotation$(O) packfileannotations$(O) packfilebytecodesegment$(O) packfileconstanttable$(O) packfiledebug$(O) packfiledirectory$(O) packfileopmap$(O) packfilerawsegment$(O) packfilesegment$(O) packfileview$(O) pmclist$(O) pmcproxy$(O) proxy$(O) ptr$(O) ptrbuf$(O) ptrobj$(O) resizablebooleanarray$(O) resizablefloatarray$(O) resizableintegerarray$(O) resizablepmcarray$(O) resizablestringarray$(O) role$(O) scalar$(O) scheduler$(O) schedulermessage$(O) sockaddr$(O) socket$(O) stringbuilder$(O) stringhandle$(O) stringiterator$(O) structview$(O) task$(O) undef$(O)',
+  'TEMP_pod' => '',
+  'TEMP_pod_build' => '',
+  'TEMP_testheader' => undef,
+  'TEMP_testheaders' => undef,
+  'TEMP_type' => 'int'
+);
+
+
+
+1;
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4:
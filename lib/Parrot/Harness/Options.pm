@@ -84,6 +84,7 @@ sub remap_runcore_opts
         'f' => '-runcore=fast',
         'b' => '-runcore=bounds',
         's' => '-runcore=bounds', # =slow
+        'e' => '-runcore=exec',
         #'G' => '-runcore=gcdebug',
         'r' => '-run-pbc',
     );
@@ -101,7 +102,6 @@ sub remap_runcore_opts
 }
 
 sub Usage {
-    #--run-exec ... run exec core
     print <<"EOF";
 perl t/harness [options] [testfiles]
     -w         ... warnings on
@@ -109,6 +109,7 @@ perl t/harness [options] [testfiles]
     -j         ... run fast core
     -b         ... run bounds checked
     -s         ... run slow (bounds checked) core
+    -e         ... run exec (native code) core
     -r         ... run the compiled pbc
     -v         ... run parrot with -v : This is NOT the same as prove -v
                    All tests run with this option will probably fail
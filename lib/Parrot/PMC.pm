@@ -0,0 +1,115 @@
+# ex: set ro ft=perl: -*- buffer-read-only:t -*-
+# DO NOT EDIT THIS FILE
+#
+# Automatically generated by config/gen/core_pmcs.pm
+
+package Parrot::PMC;
+
+use strict;
+use warnings;
+
+use vars qw(@ISA %pmc_types @EXPORT_OK);
+
+@ISA = qw( Exporter );
+@EXPORT_OK = qw( %pmc_types);
+
+%pmc_types = (
+    default => 1,
+    Null => 2,
+    Env => 3,
+    Key => 4,
+    UnManagedStruct => 5,
+    ManagedStruct => 6,
+    Exception => 7,
+    ParrotLibrary => 8,
+    ParrotInterpreter => 9,
+    LexPad => 10,
+    Timer => 11,
+    Pointer => 12,
+    Sub => 13,
+    Coroutine => 14,
+    EventHandler => 15,
+    Continuation => 16,
+    ExceptionHandler => 17,
+    NCI => 18,
+    BigInt => 19,
+    BigNum => 20,
+    Complex => 21,
+    FixedIntegerArray => 22,
+    ResizableIntegerArray => 23,
+    Iterator => 24,
+    ArrayIterator => 25,
+    HashIterator => 26,
+    OrderedHashIterator => 27,
+    StringIterator => 28,
+    FixedStringArray => 29,
+    ResizableStringArray => 30,
+    Hash => 31,
+    LexInfo => 32,
+    NameSpace => 33,
+    OrderedHash => 34,
+    OpLib => 35,
+    Opcode => 36,
+    CallContext => 37,
+    AddrRegistry => 38,
+    Alarm => 39,
+    ByteBuffer => 40,
+    Capture => 41,
+    Channel => 42,
+    Class => 43,
+    PMCProxy => 44,
+    Exporter => 45,
+    FixedBooleanArray => 46,
+    ResizableBooleanArray => 47,
+    FixedFloatArray => 48,
+    ResizableFloatArray => 49,
+    FixedPMCArray => 50,
+    ResizablePMCArray => 51,
+    MultiSub => 52,
+    Handle => 53,
+    FileHandle => 54,
+    Socket => 55,
+    StringHandle => 56,
+    HashIteratorKey => 57,
+    ImageIOFreeze => 58,
+    ImageIOSize => 59,
+    ImageIOStrings => 60,
+    ImageIOThaw => 61,
+    IMCCompiler => 62,
+    MappedByteArray => 63,
+    NativePCCMethod => 64,
+    Object => 65,
+    OS => 66,
+    Packfile => 67,
+    PackfileAnnotation => 68,
+    PackfileOpMap => 69,
+    PackfileSegment => 70,
+    PackfileAnnotations => 71,
+    PackfileConstantTable => 72,
+    PackfileDirectory => 73,
+    PackfileRawSegment => 74,
+    PackfileBytecodeSegment => 75,
+    PackfileDebug => 76,
+    PackfileView => 77,
+    PMCList => 78,
+    Proxy => 79,
+    Ptr => 80,
+    PtrBuf => 81,
+    PtrObj => 82,
+    Role => 83,
+    scalar => 84,
+    Float => 85,
+    Integer => 86,
+    String => 87,
+    Boolean => 88,
+    Scheduler => 89,
+    SchedulerMessage => 90,
+    Sockaddr => 91,
+    StringBuilder => 92,
+    StructView => 93,
+    Task => 94,
+    Callback => 95,
+    Undef => 96,
+);
+
+1;
@@ -0,0 +1,30 @@
+# ex: set ro ft=c:
+# DO NOT EDIT THIS FILE.
+#
+# This file is generated automatically from
+# include/parrot/enums.h by tools/build/h2inc.pl
+#
+# Any changes made here will be lost.
+#
+use constant PARROT_ARG_INTVAL       => 0;
+use constant PARROT_ARG_STRING       => 1;
+use constant PARROT_ARG_PMC          => 2;
+use constant PARROT_ARG_FLOATVAL     => 3;
+use constant PARROT_ARG_TYPE_MASK    => 15;
+use constant PARROT_ARG_CONSTANT     => 16;
+use constant PARROT_ARG_FLATTEN      => 32;
+use constant PARROT_ARG_SLURPY_ARRAY => 32;
+use constant PARROT_ARG_OPTIONAL     => 128;
+use constant PARROT_ARG_OPT_FLAG     => 256;
+use constant PARROT_ARG_NAME         => 512;
+use constant PARROT_ARG_LOOKAHEAD    => 1024;
+use constant PARROT_ARG_INVOCANT     => 2048;
+use constant PARROT_ARG_CALL_SIG     => 4096;
+1;
+
+# Local Variables:
+#   mode: pir
+#   buffer-read-only: t
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
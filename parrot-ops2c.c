@@ -0,0 +1,915 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifndef _WIN32
+#  include <unistd.h> /* for readlink() */
+#endif
+#ifdef __APPLE__
+#  include <mach-o/dyld.h> /* for _NSGetExecutablePath() */
+#endif
+#ifdef __FreeBSD__
+#  include <sys/sysctl.h>
+#endif
+#include "parrot/api.h"
+
+int Parrot_set_config_hash(Parrot_PMC interp_pmc);
+static void show_last_error_and_exit(Parrot_PMC interp);
+static void print_parrot_string(Parrot_PMC interp, FILE *vector, Parrot_String str, int newline);
+static void setup_pir_compregs(Parrot_PMC interp);
+static PMC * get_class_pmc(Parrot_PMC interp, const char *name);
+static void get_imcc_compiler_pmc(Parrot_PMC interp, Parrot_PMC class_pmc, Parrot_Int is_pasm);
+
+#define TRACE 0
+
+const unsigned char program_code[] =
+"\376\120\102\103\15\12\32\12\10\0\0\6\11\0\15\5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\46\13\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\31\0\0\0\0\0\0\0"
+"\102\131\124\105\103\117\104\105\137\160\141\162\162\157\164\55\157\160\163\62\143\56\160\151\162\0\0\0\0\0\0\0"
+"\62\0\0\0\0\0\0\0\370\4\0\0\0\0\0\0\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\31\0\0\0\0\0\0\0\103\117\116\123\124\101\116\124\137\160\141\162\162\157\164\55\157\160\163\62\143\56\160\151"
+"\162\0\0\0\0\0\0\0\52\5\0\0\0\0\0\0\306\3\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\34\0\0\0\0\0\0\0\102\131\124\105\103\117\104\105\137\160\141\162\162\157\164\55"
+"\157\160\163\62\143\56\160\151\162\137\104\102\0\0\0\0\360\10\0\0\0\0\0\0\212\1\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\35\0\0\0\0\0\0\0\102\131\124\105\103\117\104\105"
+"\137\160\141\162\162\157\164\55\157\160\163\62\143\56\160\151\162\137\101\116\116\0\0\0\172\12\0\0\0\0\0\0"
+"\264\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\370\4\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\177\4\0\0\0\0\0\0\0\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0"
+"\36\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\34\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\32\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\10\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0"
+"\17\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\10\0\0\0\0\0\0\0\32\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\10\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\34\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\22\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\12\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\14\0\0\0\0\0\0\0\65\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0"
+"\10\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\16\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\36\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\17\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\14\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\41\0\0\0\0\0\0\0"
+"\13\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0"
+"\20\0\0\0\0\0\0\0\47\0\0\0\0\0\0\0\63\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0"
+"\21\0\0\0\0\0\0\0\47\0\0\0\0\0\0\0\256\2\0\0\0\0\0\0\22\0\0\0\0\0\0\0"
+"\47\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\34\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\51\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\34\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\34\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\53\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\34\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\54\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\34\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0"
+"\16\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0"
+"\16\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\34\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0"
+"\6\0\0\0\0\0\0\0\34\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\20\0\0\0\0\0\0\0"
+"\6\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\34\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0"
+"\10\0\0\0\0\0\0\0\34\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\22\0\0\0\0\0\0\0"
+"\10\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\34\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0"
+"\41\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\57\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\65\0\0\0\0\0\0\0\36\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0"
+"\17\0\0\0\0\0\0\0\36\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\25\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\50\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0"
+"\16\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0\50\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0"
+"\24\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0"
+"\13\0\0\0\0\0\0\0\30\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0"
+"\20\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0"
+"\23\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\34\0\0\0\0\0\0\0\31\0\0\0\0\0\0\0"
+"\25\0\0\0\0\0\0\0\32\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0"
+"\104\0\0\0\0\0\0\0\32\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0"
+"\0\0\1\0\0\0\0\0\10\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\65\0\0\0\0\0\0\0"
+"\37\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0\37\0\0\0\0\0\0\0"
+"\12\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0\33\0\0\0\0\0\0\0"
+"\26\0\0\0\0\0\0\0\33\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0\34\0\0\0\0\0\0\0"
+"\26\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\42\0\0\0\0\0\0\0\50\0\0\0\0\0\0\0"
+"\27\0\0\0\0\0\0\0\42\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0"
+"\42\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0\30\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0"
+"\42\0\0\0\0\0\0\0\22\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0"
+"\6\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\34\0\0\0\0\0\0\0"
+"\35\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0"
+"\26\0\0\0\0\0\0\0\113\0\0\0\0\0\0\0\36\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\37\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0"
+"\23\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0\113\0\0\0\0\0\0\0\36\0\0\0\0\0\0\0"
+"\27\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0"
+"\27\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\43\0\0\0\0\0\0\0\50\0\0\0\0\0\0\0"
+"\27\0\0\0\0\0\0\0\43\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0"
+"\43\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0\30\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0"
+"\43\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0"
+"\6\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\34\0\0\0\0\0\0\0"
+"\35\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0"
+"\26\0\0\0\0\0\0\0\113\0\0\0\0\0\0\0\36\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\47\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0"
+"\16\0\0\0\0\0\0\0\44\0\0\0\0\0\0\0\50\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0"
+"\44\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0\44\0\0\0\0\0\0\0"
+"\13\0\0\0\0\0\0\0\30\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\44\0\0\0\0\0\0\0"
+"\24\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0"
+"\23\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\34\0\0\0\0\0\0\0\35\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0"
+"\113\0\0\0\0\0\0\0\36\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\26\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0"
+"\45\0\0\0\0\0\0\0\50\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0\45\0\0\0\0\0\0\0"
+"\6\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0\45\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0"
+"\30\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\45\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0"
+"\27\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0"
+"\25\0\0\0\0\0\0\0\34\0\0\0\0\0\0\0\35\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\25\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\113\0\0\0\0\0\0\0"
+"\36\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0"
+"\71\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0"
+"\21\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\47\0\0\0\0\0\0\0"
+"\40\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\123\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0"
+"\46\0\0\0\0\0\0\0\50\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0\46\0\0\0\0\0\0\0"
+"\6\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0\46\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0"
+"\30\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\46\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0"
+"\27\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0"
+"\26\0\0\0\0\0\0\0\34\0\0\0\0\0\0\0\40\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0"
+"\34\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0\104\0\0\0\0\0\0\0"
+"\32\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0\0\0\1\0\0\0\0\0"
+"\10\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\65\0\0\0\0\0\0\0\40\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0\40\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\30\0\0\0\0\0\0\0\33\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0"
+"\33\0\0\0\0\0\0\0\30\0\0\0\0\0\0\0\34\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0"
+"\41\0\0\0\0\0\0\0\41\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0"
+"\21\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\50\0\0\0\0\0\0\0\50\0\0\0\0\0\0\0"
+"\27\0\0\0\0\0\0\0\50\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0"
+"\50\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0\30\0\0\0\0\0\0\0\30\0\0\0\0\0\0\0"
+"\50\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0\30\0\0\0\0\0\0\0"
+"\6\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0\30\0\0\0\0\0\0\0\34\0\0\0\0\0\0\0"
+"\10\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0\30\0\0\0\0\0\0\0"
+"\11\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0\101\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\41\0\0\0\0\0\0\0\54\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0"
+"\26\0\0\0\0\0\0\0\20\0\0\0\0\0\0\0\42\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0"
+"\32\0\0\0\0\0\0\0\42\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0"
+"\42\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\107\0\0\0\0\0\0\0\42\0\0\0\0\0\0\0"
+"\26\0\0\0\0\0\0\0\112\0\0\0\0\0\0\0\42\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0"
+"\64\0\0\0\0\0\0\0\42\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\116\0\0\0\0\0\0\0"
+"\42\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\46\0\0\0\0\0\0\0\42\0\0\0\0\0\0\0"
+"\26\0\0\0\0\0\0\0\102\0\0\0\0\0\0\0\42\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0"
+"\76\0\0\0\0\0\0\0\42\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\66\0\0\0\0\0\0\0"
+"\42\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\61\0\0\0\0\0\0\0\42\0\0\0\0\0\0\0"
+"\26\0\0\0\0\0\0\0\111\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0"
+"\26\0\0\0\0\0\0\0\43\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0"
+"\75\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0"
+"\11\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\62\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\74\0\0\0\0\0\0\0"
+"\26\0\0\0\0\0\0\0\44\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0"
+"\25\0\0\0\0\0\0\0\73\0\0\0\0\0\0\0\45\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\42\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0"
+"\16\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\47\0\0\0\0\0\0\0\40\0\0\0\0\0\0\0"
+"\26\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0\46\0\0\0\0\0\0\0\32\0\0\0\0\0\0\0"
+"\25\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\32\0\0\0\0\0\0\0"
+"\41\0\0\0\0\0\0\0\31\0\0\0\0\0\0\0\43\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0"
+"\15\0\0\0\0\0\0\0\106\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\30\0\0\0\0\0\0\0"
+"\71\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0"
+"\30\0\0\0\0\0\0\0\117\0\0\0\0\0\0\0\43\0\0\0\0\0\0\0\30\0\0\0\0\0\0\0"
+"\11\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0\62\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\31\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0"
+"\31\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\36\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0"
+"\43\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0\51\0\0\0\0\0\0\0"
+"\16\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0"
+"\27\0\0\0\0\0\0\0\36\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\30\0\0\0\0\0\0\0"
+"\47\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\31\0\0\0\0\0\0\0\71\0\0\0\0\0\0\0"
+"\10\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0"
+"\67\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0\30\0\0\0\0\0\0\0"
+"\43\0\0\0\0\0\0\0\31\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0"
+"\62\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\32\0\0\0\0\0\0\0"
+"\26\0\0\0\0\0\0\0\37\0\0\0\0\0\0\0\32\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0"
+"\25\0\0\0\0\0\0\0\71\0\0\0\0\0\0\0\40\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0"
+"\67\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\31\0\0\0\0\0\0\0"
+"\47\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\22\0\0\0\0\0\0\0\44\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0\73\0\0\0\0\0\0\0"
+"\45\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0"
+"\30\0\0\0\0\0\0\0\42\0\0\0\0\0\0\0\50\0\0\0\0\0\0\0\31\0\0\0\0\0\0\0"
+"\27\0\0\0\0\0\0\0\30\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0\32\0\0\0\0\0\0\0"
+"\20\0\0\0\0\0\0\0\51\0\0\0\0\0\0\0\32\0\0\0\0\0\0\0\31\0\0\0\0\0\0\0"
+"\52\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\77\0\0\0\0\0\0\0\32\0\0\0\0\0\0\0"
+"\53\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\54\0\0\0\0\0\0\0"
+"\27\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\55\0\0\0\0\0\0\0"
+"\30\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0\55\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\30\0\0\0\0\0\0\0\65\0\0\0\0\0\0\0\41\0\0\0\0\0\0\0"
+"\155\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0\41\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\43\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0"
+"\56\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\37\0\0\0\0\0\0\0"
+"\16\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0\74\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0"
+"\13\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0"
+"\6\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0"
+"\56\0\0\0\0\0\0\0\30\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\27\0\0\0\0\0\0\0\30\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0"
+"\30\0\0\0\0\0\0\0\34\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\31\0\0\0\0\0\0\0"
+"\47\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\32\0\0\0\0\0\0\0\71\0\0\0\0\0\0\0"
+"\10\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0\31\0\0\0\0\0\0\0"
+"\43\0\0\0\0\0\0\0\32\0\0\0\0\0\0\0\65\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0"
+"\156\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\33\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0"
+"\25\0\0\0\0\0\0\0\105\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\44\0\0\0\0\0\0\0"
+"\27\0\0\0\0\0\0\0\65\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\30\0\0\0\0\0\0\0\45\0\0\0\0\0\0\0\33\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0"
+"\25\0\0\0\0\0\0\0\62\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\34\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\40\0\0\0\0\0\0\0\34\0\0\0\0\0\0\0"
+"\16\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0\31\0\0\0\0\0\0\0"
+"\26\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0"
+"\26\0\0\0\0\0\0\0\41\0\0\0\0\0\0\0\55\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0"
+"\27\0\0\0\0\0\0\0\47\0\0\0\0\0\0\0\31\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0"
+"\16\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\30\0\0\0\0\0\0\0\40\0\0\0\0\0\0\0"
+"\10\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\30\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0"
+"\30\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\16\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0\40\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0"
+"\54\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0"
+"\27\0\0\0\0\0\0\0\40\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\27\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0\103\0\0\0\0\0\0\0"
+"\12\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\30\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\25\0\0\0\0\0\0\0\30\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\25\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\35\0\0\0\0\0\0\0\57\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\35\0\0\0\0\0\0\0"
+"\33\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0"
+"\14\0\0\0\0\0\0\0\20\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\63\0\0\0\0\0\0\0"
+"\14\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\214\0\0\0\0\0\0\0"
+"\22\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\34\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\43\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\31\0\0\0\0\0\0\0\130\0\0\0\0\0\0\0"
+"\60\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0"
+"\122\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\122\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\11\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\134\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\122\0\0\0\0\0\0\0"
+"\10\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0"
+"\127\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\125\0\0\0\0\0\0\0"
+"\12\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\122\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\30\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\110\0\0\0\0\0\0\0\132\0\0\0\0\0\0\0\31\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\125\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\16\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\122\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0"
+"\27\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\72\0\0\0\0\0\0\0\126\0\0\0\0\0\0\0"
+"\11\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\125\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\122\0\0\0\0\0\0\0"
+"\10\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\70\0\0\0\0\0\0\0"
+"\123\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\125\0\0\0\0\0\0\0"
+"\12\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\122\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\35\0\0\0\0\0\0\0\131\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\125\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\122\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\43\0\0\0\0\0\0\0\121\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\125\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\16\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\122\0\0\0\0\0\0\0\61\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\56\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0"
+"\23\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\34\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0"
+"\11\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\14\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0"
+"\57\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\33\0\0\0\0\0\0\0"
+"\13\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0"
+"\20\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\63\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0"
+"\21\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0\22\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\33\0\0\0\0\0\0\0\135\0\0\0\0\0\0\0"
+"\65\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\155\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\62\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0"
+"\12\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\57\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\33\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\40\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\40\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\63\0\0\0\0\0\0\0\37\0\0\0\0\0\0\0"
+"\7\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\20\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0\63\0\0\0\0\0\0\0"
+"\14\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0\143\0\0\0\0\0\0\0"
+"\22\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0\64\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\11\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\34\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\34\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\151\0\0\0\0\0\0\0"
+"\10\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0"
+"\10\0\0\0\0\0\0\0\150\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\12\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\145\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0"
+"\16\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\145\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0"
+"\12\0\0\0\0\0\0\0\141\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0"
+"\10\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0"
+"\146\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0"
+"\10\0\0\0\0\0\0\0\145\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0"
+"\143\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0"
+"\12\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\152\0\0\0\0\0\0\0"
+"\12\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0"
+"\142\0\0\0\0\0\0\0\40\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\41\0\0\0\0\0\0\0"
+"\25\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\145\0\0\0\0\0\0\0"
+"\16\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\142\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0"
+"\11\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\100\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\13\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0"
+"\12\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\57\0\0\0\0\0\0\0"
+"\12\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\33\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\17\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\14\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\66\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\143\157\162\145\137\157\160\163\0\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\66\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\340\2\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\36\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\37\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\341\2\0\0\0\0\0\0\4\0\0\0\0\0\0\0\366\3\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\1\1\0\0\0\0\0\0\6\0\0\0\0\0\0\0\33\2\0\0\0\0\0\0"
+"\7\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\40\0\0\0\0\0\0\0"
+"\11\0\0\0\0\0\0\0\20\2\0\0\0\0\0\0\12\0\0\0\0\0\0\0\43\0\0\0\0\0\0\0"
+"\13\0\0\0\0\0\0\0\42\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\35\0\0\0\0\0\0\0"
+"\15\0\0\0\0\0\0\0\34\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\356\3\0\0\0\0\0\0"
+"\17\0\0\0\0\0\0\0\31\0\0\0\0\0\0\0\20\0\0\0\0\0\0\0\161\2\0\0\0\0\0\0"
+"\21\0\0\0\0\0\0\0\53\4\0\0\0\0\0\0\22\0\0\0\0\0\0\0\57\0\0\0\0\0\0\0"
+"\23\0\0\0\0\0\0\0\155\2\0\0\0\0\0\0\24\0\0\0\0\0\0\0\171\2\0\0\0\0\0\0"
+"\25\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\336\3\0\0\0\0\0\0"
+"\27\0\0\0\0\0\0\0\3\1\0\0\0\0\0\0\30\0\0\0\0\0\0\0\37\3\0\0\0\0\0\0"
+"\31\0\0\0\0\0\0\0\30\0\0\0\0\0\0\0\32\0\0\0\0\0\0\0\15\3\0\0\0\0\0\0"
+"\33\0\0\0\0\0\0\0\125\2\0\0\0\0\0\0\34\0\0\0\0\0\0\0\61\0\0\0\0\0\0\0"
+"\35\0\0\0\0\0\0\0\42\1\0\0\0\0\0\0\36\0\0\0\0\0\0\0\342\2\0\0\0\0\0\0"
+"\37\0\0\0\0\0\0\0\43\1\0\0\0\0\0\0\40\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0"
+"\41\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0\42\0\0\0\0\0\0\0\226\2\0\0\0\0\0\0"
+"\43\0\0\0\0\0\0\0\15\4\0\0\0\0\0\0\44\0\0\0\0\0\0\0\330\3\0\0\0\0\0\0"
+"\45\0\0\0\0\0\0\0\344\2\0\0\0\0\0\0\46\0\0\0\0\0\0\0\11\4\0\0\0\0\0\0"
+"\47\0\0\0\0\0\0\0\347\2\0\0\0\0\0\0\50\0\0\0\0\0\0\0\7\2\0\0\0\0\0\0"
+"\51\0\0\0\0\0\0\0\227\2\0\0\0\0\0\0\52\0\0\0\0\0\0\0\206\3\0\0\0\0\0\0"
+"\53\0\0\0\0\0\0\0\332\2\0\0\0\0\0\0\54\0\0\0\0\0\0\0\72\3\0\0\0\0\0\0"
+"\55\0\0\0\0\0\0\0\73\3\0\0\0\0\0\0\56\0\0\0\0\0\0\0\11\3\0\0\0\0\0\0"
+"\57\0\0\0\0\0\0\0\111\2\0\0\0\0\0\0\60\0\0\0\0\0\0\0\162\2\0\0\0\0\0\0"
+"\61\0\0\0\0\0\0\0\140\0\0\0\0\0\0\0\62\0\0\0\0\0\0\0\76\0\0\0\0\0\0\0"
+"\63\0\0\0\0\0\0\0\41\0\0\0\0\0\0\0\64\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0"
+"\65\0\0\0\0\0\0\0\51\4\0\0\0\0\0\0\306\3\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\157\0\0\0\0\0\0\0"
+"\42\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\143\164\170\163\141\166\145\0"
+"\1\0\0\0\0\0\0\0\30\0\0\0\0\0\0\0\143\157\155\160\151\154\145\162\163\57\157\160\163\143\57\157"
+"\160\163\62\143\56\156\161\160\1\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\165\163\141\147\145\0\0\0"
+"\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\146\151\154\145\0\0\0\0\1\0\0\0\0\0\0\0"
+"\11\0\0\0\0\0\0\0\44\52\103\124\130\123\101\126\105\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\23\0\0\0\0\0\0\0\61\60\137\61\67\71\62\64\61\65\66\71\60\56\62\61\64\67\66\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\154\151\156\145\0\0\0\0\1\0\0\0\0\0\0\0"
+"\13\0\0\0\0\0\0\0\147\145\164\137\157\160\164\151\157\156\163\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\115\101\111\116\0\0\0\0\0\0\0\0\0\0\0\0\20\0\0\0\0\0\0\0"
+"\160\141\162\162\157\164\55\157\160\163\62\143\56\160\151\162\1\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0"
+"\137\142\154\157\143\153\61\60\60\60\0\0\0\0\0\0\377\377\377\377\377\377\377\377\1\0\0\0\0\0\0\0"
+"\6\0\0\0\0\0\0\0\160\141\162\162\157\164\0\0\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\155\141\151\156\0\0\0\0\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\143\157\162\145\0\0\0\0\1\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0"
+"\122\145\163\151\172\141\142\154\145\120\115\103\101\162\162\141\171\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\6\0\0\0\0\0\0\0\100\146\151\154\145\163\0\0\1\0\0\0\0\0\0\0\20\0\0\0\0\0\0\0"
+"\43\40\117\160\163\40\160\141\162\163\145\144\40\151\156\40\1\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0"
+"\44\144\145\142\165\147\0\0\1\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0\44\145\155\151\164\137\154\151"
+"\156\145\163\0\0\0\0\0\1\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\165\156\144\145\146\0\0\0"
+"\1\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0\163\162\143\57\157\160\163\57\142\151\164\56\157\160\163\0"
+"\1\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\157\160\163\62\143\56\156\161\160\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\163\153\151\160\137\146\151\154\145\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\123\164\162\151\156\147\0\0\1\0\0\0\0\0\0\0"
+"\20\0\0\0\0\0\0\0\163\162\143\57\157\160\163\57\143\157\162\145\56\157\160\163\1\0\0\0\0\0\0\0"
+"\7\0\0\0\0\0\0\0\160\141\171\154\157\141\144\0\1\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0"
+"\125\156\144\145\146\0\0\0\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\150\145\154\160\0\0\0\0"
+"\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\44\154\151\142\0\0\0\0\1\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\44\146\0\0\0\0\0\0\1\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0"
+"\44\145\155\151\164\164\145\162\1\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\157\160\163\143\56\160\142\143"
+"\1\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0\44\163\164\141\162\164\137\164\151\155\145\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\161\165\151\145\164\0\0\0\1\0\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\164\162\141\156\163\0\0\0\1\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0"
+"\146\154\141\147\163\0\0\0\1\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0\163\162\143\57\157\160\163\57"
+"\160\155\143\56\157\160\163\0\1\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\44\143\157\162\145\0\0\0"
+"\1\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\44\157\160\164\163\0\0\0\1\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\106\151\154\145\0\0\0\0\1\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0"
+"\160\162\151\156\164\137\157\160\163\137\156\165\155\137\146\151\154\145\163\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\23\0\0\0\0\0\0\0\61\61\137\61\67\71\62\64\61\65\66\71\60\56\62\61\64\67\66\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0\160\162\151\156\164\137\143\137\150\145\141\144\145\162\137\146"
+"\151\154\145\163\0\0\0\0\1\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\40\163\145\143\157\156\144\163"
+"\56\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\105\155\151\164\164\145\162\0"
+"\1\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\107\145\164\157\160\164\57\117\142\152\56\160\142\143\0\0"
+"\1\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\124\162\141\156\163\0\0\0\1\0\0\0\0\0\0\0"
+"\17\0\0\0\0\0\0\0\163\162\143\57\157\160\163\57\166\141\162\56\157\160\163\0\1\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\156\145\167\0\0\0\0\0\1\0\0\0\0\0\0\0\20\0\0\0\0\0\0\0"
+"\105\170\143\145\160\164\151\157\156\110\141\156\144\154\145\162\1\0\0\0\0\0\0\0\20\0\0\0\0\0\0\0"
+"\163\162\143\57\157\160\163\57\155\141\164\150\56\157\160\163\1\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0"
+"\163\143\162\151\160\164\0\0\1\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0\163\162\143\57\157\160\163\57"
+"\163\171\163\56\157\160\163\0\1\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\157\160\154\151\142\0\0\0"
+"\1\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\156\157\55\154\151\156\145\163\1\0\0\0\0\0\0\0"
+"\6\0\0\0\0\0\0\0\44\161\165\151\145\164\0\0\1\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0"
+"\144\145\142\165\147\0\0\0\1\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\106\154\157\141\164\0\0\0"
+"\1\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\44\164\162\141\156\163\0\0\1\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\103\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\22\0\0\0\0\0\0\0"
+"\163\162\143\57\157\160\163\57\163\164\162\151\156\147\56\157\160\163\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\45\56\63\146\0\0\0\0\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\164\171\160\145\0\0\0\0\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\160\165\163\150\0\0\0\0"
+"\1\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0\163\162\143\57\157\160\163\57\163\145\164\56\157\160\163\0"
+"\1\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0\160\162\151\156\164\137\143\137\163\157\165\162\143\145\137\146"
+"\151\154\145\0\0\0\0\0\1\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\105\170\143\145\160\164\151\157"
+"\156\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\157\160\163\137\146\151\154\145"
+"\1\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\117\160\114\151\142\0\0\0\1\0\0\0\0\0\0\0"
+"\17\0\0\0\0\0\0\0\163\162\143\57\157\160\163\57\143\155\160\56\157\160\163\0\1\0\0\0\0\0\0\0"
+"\7\0\0\0\0\0\0\0\144\171\156\141\155\151\143\0\1\0\0\0\0\0\0\0\30\0\0\0\0\0\0\0"
+"\163\162\143\57\157\160\163\57\145\170\160\145\162\151\155\145\156\164\141\154\56\157\160\163\1\0\0\0\0\0\0\0"
+"\16\0\0\0\0\0\0\0\163\162\143\57\157\160\163\57\151\157\56\157\160\163\0\0\1\0\0\0\0\0\0\0"
+"\7\0\0\0\0\0\0\0\111\156\164\145\147\145\162\0\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\110\141\163\150\0\0\0\0\1\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\117\160\163\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\22\0\0\0\0\0\0\0\163\162\143\57\157\160\163\57\157\142\152\145\143\164\56\157"
+"\160\163\0\0\0\0\0\0\1\0\0\0\0\0\0\0\20\0\0\0\0\0\0\0\163\162\143\57\157\160\163\57"
+"\157\160\163\56\163\153\151\160\377\377\377\377\377\377\377\377\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\161\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\44\147\145\164\157\160\164\163"
+"\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\156\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\6\0\0\0\0\0\0\0\107\145\164\157\160\164\0\0\1\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0"
+"\141\144\144\137\157\160\164\151\157\156\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\147\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\143\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\117\142\152\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\150\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\144\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0\61\62\137\61\67\71\62\64"
+"\61\65\66\71\60\56\62\61\64\67\66\0\0\0\0\0\1\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0"
+"\156\157\164\117\160\164\123\164\157\160\0\0\0\0\0\0\1\0\0\0\0\0\0\0\207\2\0\0\0\0\0\0"
+"\124\150\151\163\40\151\163\40\160\141\162\162\157\164\55\157\160\163\62\143\54\40\160\141\162\164\40\157\146\40\164\150"
+"\145\40\120\141\162\162\157\164\40\126\115\47\163\40\142\165\151\154\144\40\151\156\146\162\141\163\164\162\165\143\164\165"
+"\162\145\56\12\40\40\40\40\156\157\162\155\141\154\40\157\160\164\151\157\156\163\72\12\40\40\40\40\55\143\40\55"
+"\55\143\157\162\145\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\147\145\156\145\162\141\164\145\40\164\150"
+"\145\40\103\40\143\157\144\145\40\146\157\162\40\143\157\162\145\40\157\160\163\40\50\155\165\163\164\40\142\145\40\162"
+"\165\156\40\146\162\157\155\40\167\151\164\150\151\156\40\120\141\162\162\157\164\47\163\40\142\165\151\154\144\40\144\151"
+"\162\145\143\164\157\162\171\51\12\40\40\40\40\55\144\40\55\55\144\171\156\141\155\151\143\40\74\146\151\154\145\56"
+"\157\160\163\76\40\40\147\145\156\145\162\141\164\145\40\164\150\145\40\103\40\143\157\144\145\40\146\157\162\40\164\150"
+"\145\40\144\171\156\141\155\151\143\40\157\160\163\40\151\156\40\141\40\163\151\156\147\154\145\40\56\157\160\163\40\146"
+"\151\154\145\12\40\40\40\40\55\161\40\55\55\161\165\151\145\164\40\40\40\40\40\40\40\40\40\40\40\40\40\40"
+"\40\144\157\156\47\164\40\162\145\160\157\162\164\40\141\156\171\40\156\157\156\55\145\162\162\157\162\40\155\145\163\163"
+"\141\147\145\163\12\40\40\40\40\55\150\40\55\55\150\145\154\160\40\40\40\40\40\40\40\40\40\40\40\40\40\40"
+"\40\40\160\162\151\156\164\40\164\150\151\163\40\165\163\141\147\145\40\151\156\146\157\162\155\141\164\151\157\156\12\40"
+"\40\40\40\55\156\40\55\55\156\157\55\154\151\156\145\163\40\40\40\40\40\40\40\40\40\40\40\40\144\157\40\156"
+"\157\164\40\160\162\151\156\164\40\43\154\151\156\145\40\144\151\162\145\143\164\151\166\145\163\40\151\156\40\147\145\156"
+"\145\162\141\164\145\144\40\103\40\143\157\144\145\40\50\154\151\156\145\40\156\165\155\142\145\162\163\40\141\162\145\40"
+"\156\157\164\40\143\165\162\162\145\156\164\154\171\40\163\165\160\160\157\162\164\145\144\51\12\12\40\40\40\40\144\145"
+"\142\165\147\147\151\156\147\40\157\160\164\151\157\156\163\72\12\40\40\40\40\55\147\40\55\55\144\145\142\165\147\40"
+"\40\40\40\40\40\40\40\40\40\40\40\40\40\40\160\145\162\146\157\162\155\40\141\154\154\40\160\162\157\143\145\163"
+"\163\151\156\147\40\142\165\164\40\144\157\40\156\157\164\40\167\162\151\164\145\40\164\157\40\141\156\171\40\146\151\154"
+"\145\163\12\40\40\40\40\0\1\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0\61\63\137\61\67\71\62\64"
+"\61\65\66\71\60\56\62\61\64\67\66\0\0\0\0\0\1\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0"
+"\61\64\137\61\67\71\62\64\61\65\66\71\60\56\62\61\64\67\66\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\12\0\0\0\0\0\0\0\137\142\154\157\143\153\61\60\64\65\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\44\154\157\156\147\0\0\0\1\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0"
+"\44\164\171\160\145\0\0\0\1\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\44\163\150\157\162\164\0\0"
+"\1\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0\61\65\137\61\67\71\62\64\61\65\66\71\60\56\62\61"
+"\64\67\66\0\0\0\0\0\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\44\157\160\164\0\0\0\0"
+"\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\154\157\156\147\0\0\0\0\1\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\120\115\103\0\0\0\0\0\1\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\141\144\144\0\0\0\0\0\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\163\145\154\146\0\0\0\0"
+"\1\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\163\150\157\162\164\0\0\0\1\0\0\0\0\0\0\0"
+"\23\0\0\0\0\0\0\0\61\66\137\61\67\71\62\64\61\65\66\71\60\56\62\61\64\67\66\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\137\142\154\157\143\153\61\60\65\66\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\163\141\171\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\150\141\163\150\0\0\0\0\50\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\25\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\40\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\0\1\0\0\0\0\0\0\4\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\107\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0"
+"\120\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\377\377\377\377\377\377\377\377\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\13\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\37\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\13\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\33\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0"
+"\37\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\250\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\14\0\0\0\0\0\0\0\107\0\0\0\0\0\0\0\116\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\15\0\0\0\0\0\0\0\120\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\250\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\116\0\0\0\0\0\0\0"
+"\156\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\120\0\0\0\0\0\0\0"
+"\16\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377"
+"\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\16\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\140\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\25\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\42\0\0\0\0\0\0\0"
+"\21\2\0\0\0\0\0\0\2\0\0\0\0\0\0\0\21\2\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\21\2\0\0\0\0\0\0\2\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\170\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\21\2\0\0\0\0\0\0\2\0\0\0\0\0\0\0\21\2\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\21\2\0\0\0\0\0\0\21\0\0\0\0\0\0\0\21\2\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\21\2\0\0\0\0\0\0\2\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\110\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\21\2\0\0\0\0\0\0\21\0\0\0\0\0\0\0\21\2\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\100\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\21\2\0\0\0\0\0\0\2\0\0\0\0\0\0\0\21\2\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\25\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\100\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\20\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\100\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\114\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\0\0\1\0\0\0\0\0\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\115\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\100\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\115\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\60\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\220\1\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\14\0\0\0\0\0\0\0\156\0\0\0\0\0\0\0\53\3\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\10\0\0\0\0\0\0\0\120\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\2\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\55\0\0\0\0\0\0\0\53\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\14\0\0\0\0\0\0\0\37\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\71\0\0\0\0\0\0\0\63\0\0\0\0\0\0\0"
+"\21\0\0\0\0\0\0\0\67\0\0\0\0\0\0\0\74\0\0\0\0\0\0\0\77\0\0\0\0\0\0\0"
+"\42\0\0\0\0\0\0\0\103\0\0\0\0\0\0\0\36\0\0\0\0\0\0\0\107\0\0\0\0\0\0\0"
+"\37\0\0\0\0\0\0\0\113\0\0\0\0\0\0\0\40\0\0\0\0\0\0\0\117\0\0\0\0\0\0\0"
+"\50\0\0\0\0\0\0\0\247\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0\253\0\0\0\0\0\0\0"
+"\47\0\0\0\0\0\0\0\257\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0\263\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\35\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\100\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\70\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\72\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\43\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\110\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\70\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\25\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0"
+"\21\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\100\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\25\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0"
+"\21\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\124\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\360\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\14\0\0\0\0\0\0\0\53\3\0\0\0\0\0\0\306\3\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\7\0\0\0\0\0\0\0\120\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\133\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\14\0\0\0\0\0\0\0\37\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\122\0\0\0\0\0\0\0\37\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\50\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\270\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\306\3\0\0\0\0\0\0\351\3\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\120\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\14\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\136\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\100\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\124\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\130\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\310\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\351\3\0\0\0\0\0\0"
+"\370\3\0\0\0\0\0\0\0\0\0\0\0\0\0\0\140\0\0\0\0\0\0\0\120\0\0\0\0\0\0\0"
+"\140\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377"
+"\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\137\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\35\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\110\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\25\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\202\0\0\0\0\0\0\0\0\1\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\270\1\0\0\0\0\0\0\4\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\370\3\0\0\0\0\0\0"
+"\161\4\0\0\0\0\0\0\0\0\0\0\0\0\0\0\125\0\0\0\0\0\0\0\125\0\0\0\0\0\0\0"
+"\125\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377"
+"\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0"
+"\144\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\35\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\14\0\0\0\0\0\0\0\61\0\0\0\0\0\0\0\22\0\0\0\0\0\0\0\36\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0\37\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\30\0\0\0\0\0\0\0\125\0\0\0\0\0\0\0\34\0\0\0\0\0\0\0"
+"\125\0\0\0\0\0\0\0\40\0\0\0\0\0\0\0\125\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\145\0\0\0\0\0\0\0"
+"\23\0\0\0\0\0\0\0\141\0\0\0\0\0\0\0\33\0\0\0\0\0\0\0\151\0\0\0\0\0\0\0"
+"\37\0\0\0\0\0\0\0\143\0\0\0\0\0\0\0\47\0\0\0\0\0\0\0\142\0\0\0\0\0\0\0"
+"\57\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\374\377\377\377\377\377\377\377\1\0\0\0\0\0\0\0"
+"\374\377\377\377\377\377\377\377\1\0\0\0\0\0\0\0\374\377\377\377\377\377\377\377\1\0\0\0\0\0\0\0"
+"\250\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\161\4\0\0\0\0\0\0"
+"\177\4\0\0\0\0\0\0\50\0\0\0\0\0\0\0\154\0\0\0\0\0\0\0\120\0\0\0\0\0\0\0"
+"\154\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377"
+"\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\153\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\212\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\202\1\0\0\0\0\0\0"
+"\6\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0"
+"\12\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0"
+"\17\0\0\0\0\0\0\0\20\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0"
+"\25\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\31\0\0\0\0\0\0\0\32\0\0\0\0\0\0\0"
+"\33\0\0\0\0\0\0\0\36\0\0\0\0\0\0\0\37\0\0\0\0\0\0\0\40\0\0\0\0\0\0\0"
+"\41\0\0\0\0\0\0\0\42\0\0\0\0\0\0\0\42\0\0\0\0\0\0\0\42\0\0\0\0\0\0\0"
+"\43\0\0\0\0\0\0\0\43\0\0\0\0\0\0\0\50\0\0\0\0\0\0\0\51\0\0\0\0\0\0\0"
+"\51\0\0\0\0\0\0\0\56\0\0\0\0\0\0\0\57\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0"
+"\62\0\0\0\0\0\0\0\63\0\0\0\0\0\0\0\64\0\0\0\0\0\0\0\64\0\0\0\0\0\0\0"
+"\64\0\0\0\0\0\0\0\66\0\0\0\0\0\0\0\66\0\0\0\0\0\0\0\67\0\0\0\0\0\0\0"
+"\70\0\0\0\0\0\0\0\70\0\0\0\0\0\0\0\101\0\0\0\0\0\0\0\102\0\0\0\0\0\0\0"
+"\103\0\0\0\0\0\0\0\105\0\0\0\0\0\0\0\106\0\0\0\0\0\0\0\111\0\0\0\0\0\0\0"
+"\112\0\0\0\0\0\0\0\115\0\0\0\0\0\0\0\116\0\0\0\0\0\0\0\121\0\0\0\0\0\0\0"
+"\122\0\0\0\0\0\0\0\125\0\0\0\0\0\0\0\126\0\0\0\0\0\0\0\131\0\0\0\0\0\0\0"
+"\132\0\0\0\0\0\0\0\135\0\0\0\0\0\0\0\136\0\0\0\0\0\0\0\141\0\0\0\0\0\0\0"
+"\142\0\0\0\0\0\0\0\145\0\0\0\0\0\0\0\146\0\0\0\0\0\0\0\151\0\0\0\0\0\0\0"
+"\152\0\0\0\0\0\0\0\155\0\0\0\0\0\0\0\156\0\0\0\0\0\0\0\161\0\0\0\0\0\0\0"
+"\163\0\0\0\0\0\0\0\165\0\0\0\0\0\0\0\165\0\0\0\0\0\0\0\165\0\0\0\0\0\0\0"
+"\165\0\0\0\0\0\0\0\166\0\0\0\0\0\0\0\170\0\0\0\0\0\0\0\171\0\0\0\0\0\0\0"
+"\172\0\0\0\0\0\0\0\174\0\0\0\0\0\0\0\175\0\0\0\0\0\0\0\176\0\0\0\0\0\0\0"
+"\200\0\0\0\0\0\0\0\201\0\0\0\0\0\0\0\202\0\0\0\0\0\0\0\203\0\0\0\0\0\0\0"
+"\203\0\0\0\0\0\0\0\203\0\0\0\0\0\0\0\203\0\0\0\0\0\0\0\204\0\0\0\0\0\0\0"
+"\205\0\0\0\0\0\0\0\210\0\0\0\0\0\0\0\211\0\0\0\0\0\0\0\212\0\0\0\0\0\0\0"
+"\214\0\0\0\0\0\0\0\215\0\0\0\0\0\0\0\216\0\0\0\0\0\0\0\220\0\0\0\0\0\0\0"
+"\221\0\0\0\0\0\0\0\222\0\0\0\0\0\0\0\223\0\0\0\0\0\0\0\224\0\0\0\0\0\0\0"
+"\225\0\0\0\0\0\0\0\226\0\0\0\0\0\0\0\230\0\0\0\0\0\0\0\231\0\0\0\0\0\0\0"
+"\232\0\0\0\0\0\0\0\234\0\0\0\0\0\0\0\235\0\0\0\0\0\0\0\236\0\0\0\0\0\0\0"
+"\240\0\0\0\0\0\0\0\241\0\0\0\0\0\0\0\242\0\0\0\0\0\0\0\243\0\0\0\0\0\0\0"
+"\245\0\0\0\0\0\0\0\246\0\0\0\0\0\0\0\247\0\0\0\0\0\0\0\251\0\0\0\0\0\0\0"
+"\252\0\0\0\0\0\0\0\253\0\0\0\0\0\0\0\255\0\0\0\0\0\0\0\256\0\0\0\0\0\0\0"
+"\257\0\0\0\0\0\0\0\260\0\0\0\0\0\0\0\262\0\0\0\0\0\0\0\263\0\0\0\0\0\0\0"
+"\264\0\0\0\0\0\0\0\266\0\0\0\0\0\0\0\267\0\0\0\0\0\0\0\270\0\0\0\0\0\0\0"
+"\272\0\0\0\0\0\0\0\273\0\0\0\0\0\0\0\274\0\0\0\0\0\0\0\275\0\0\0\0\0\0\0"
+"\277\0\0\0\0\0\0\0\301\0\0\0\0\0\0\0\302\0\0\0\0\0\0\0\304\0\0\0\0\0\0\0"
+"\305\0\0\0\0\0\0\0\306\0\0\0\0\0\0\0\310\0\0\0\0\0\0\0\311\0\0\0\0\0\0\0"
+"\312\0\0\0\0\0\0\0\314\0\0\0\0\0\0\0\316\0\0\0\0\0\0\0\317\0\0\0\0\0\0\0"
+"\320\0\0\0\0\0\0\0\320\0\0\0\0\0\0\0\320\0\0\0\0\0\0\0\320\0\0\0\0\0\0\0"
+"\321\0\0\0\0\0\0\0\322\0\0\0\0\0\0\0\324\0\0\0\0\0\0\0\327\0\0\0\0\0\0\0"
+"\330\0\0\0\0\0\0\0\331\0\0\0\0\0\0\0\332\0\0\0\0\0\0\0\334\0\0\0\0\0\0\0"
+"\335\0\0\0\0\0\0\0\336\0\0\0\0\0\0\0\340\0\0\0\0\0\0\0\340\0\0\0\0\0\0\0"
+"\340\0\0\0\0\0\0\0\343\0\0\0\0\0\0\0\346\0\0\0\0\0\0\0\347\0\0\0\0\0\0\0"
+"\350\0\0\0\0\0\0\0\351\0\0\0\0\0\0\0\352\0\0\0\0\0\0\0\353\0\0\0\0\0\0\0"
+"\354\0\0\0\0\0\0\0\355\0\0\0\0\0\0\0\356\0\0\0\0\0\0\0\357\0\0\0\0\0\0\0"
+"\360\0\0\0\0\0\0\0\361\0\0\0\0\0\0\0\362\0\0\0\0\0\0\0\363\0\0\0\0\0\0\0"
+"\366\0\0\0\0\0\0\0\367\0\0\0\0\0\0\0\367\0\0\0\0\0\0\0\367\0\0\0\0\0\0\0"
+"\370\0\0\0\0\0\0\0\372\0\0\0\0\0\0\0\373\0\0\0\0\0\0\0\374\0\0\0\0\0\0\0"
+"\375\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\1\0\0\0\0\0\0\1\1\0\0\0\0\0\0"
+"\2\1\0\0\0\0\0\0\3\1\0\0\0\0\0\0\5\1\0\0\0\0\0\0\6\1\0\0\0\0\0\0"
+"\7\1\0\0\0\0\0\0\7\1\0\0\0\0\0\0\7\1\0\0\0\0\0\0\10\1\0\0\0\0\0\0"
+"\12\1\0\0\0\0\0\0\14\1\0\0\0\0\0\0\15\1\0\0\0\0\0\0\16\1\0\0\0\0\0\0"
+"\17\1\0\0\0\0\0\0\20\1\0\0\0\0\0\0\21\1\0\0\0\0\0\0\21\1\0\0\0\0\0\0"
+"\21\1\0\0\0\0\0\0\22\1\0\0\0\0\0\0\24\1\0\0\0\0\0\0\25\1\0\0\0\0\0\0"
+"\26\1\0\0\0\0\0\0\27\1\0\0\0\0\0\0\30\1\0\0\0\0\0\0\31\1\0\0\0\0\0\0"
+"\32\1\0\0\0\0\0\0\33\1\0\0\0\0\0\0\34\1\0\0\0\0\0\0\35\1\0\0\0\0\0\0"
+"\36\1\0\0\0\0\0\0\37\1\0\0\0\0\0\0\40\1\0\0\0\0\0\0\41\1\0\0\0\0\0\0"
+"\42\1\0\0\0\0\0\0\43\1\0\0\0\0\0\0\43\1\0\0\0\0\0\0\43\1\0\0\0\0\0\0"
+"\43\1\0\0\0\0\0\0\46\1\0\0\0\0\0\0\47\1\0\0\0\0\0\0\50\1\0\0\0\0\0\0"
+"\51\1\0\0\0\0\0\0\52\1\0\0\0\0\0\0\53\1\0\0\0\0\0\0\55\1\0\0\0\0\0\0"
+"\56\1\0\0\0\0\0\0\57\1\0\0\0\0\0\0\62\1\0\0\0\0\0\0\63\1\0\0\0\0\0\0"
+"\64\1\0\0\0\0\0\0\64\1\0\0\0\0\0\0\64\1\0\0\0\0\0\0\64\1\0\0\0\0\0\0"
+"\66\1\0\0\0\0\0\0\66\1\0\0\0\0\0\0\66\1\0\0\0\0\0\0\67\1\0\0\0\0\0\0"
+"\71\1\0\0\0\0\0\0\72\1\0\0\0\0\0\0\73\1\0\0\0\0\0\0\74\1\0\0\0\0\0\0"
+"\77\1\0\0\0\0\0\0\100\1\0\0\0\0\0\0\101\1\0\0\0\0\0\0\102\1\0\0\0\0\0\0"
+"\102\1\0\0\0\0\0\0\102\1\0\0\0\0\0\0\105\1\0\0\0\0\0\0\106\1\0\0\0\0\0\0"
+"\106\1\0\0\0\0\0\0\106\1\0\0\0\0\0\0\110\1\0\0\0\0\0\0\111\1\0\0\0\0\0\0"
+"\111\1\0\0\0\0\0\0\111\1\0\0\0\0\0\0\113\1\0\0\0\0\0\0\116\1\0\0\0\0\0\0"
+"\116\1\0\0\0\0\0\0\121\1\0\0\0\0\0\0\122\1\0\0\0\0\0\0\123\1\0\0\0\0\0\0"
+"\123\1\0\0\0\0\0\0\134\1\0\0\0\0\0\0\135\1\0\0\0\0\0\0\136\1\0\0\0\0\0\0"
+"\140\1\0\0\0\0\0\0\141\1\0\0\0\0\0\0\143\1\0\0\0\0\0\0\144\1\0\0\0\0\0\0"
+"\145\1\0\0\0\0\0\0\147\1\0\0\0\0\0\0\150\1\0\0\0\0\0\0\150\1\0\0\0\0\0\0"
+"\150\1\0\0\0\0\0\0\152\1\0\0\0\0\0\0\153\1\0\0\0\0\0\0\153\1\0\0\0\0\0\0"
+"\153\1\0\0\0\0\0\0\155\1\0\0\0\0\0\0\156\1\0\0\0\0\0\0\156\1\0\0\0\0\0\0"
+"\156\1\0\0\0\0\0\0\160\1\0\0\0\0\0\0\161\1\0\0\0\0\0\0\161\1\0\0\0\0\0\0"
+"\161\1\0\0\0\0\0\0\163\1\0\0\0\0\0\0\164\1\0\0\0\0\0\0\164\1\0\0\0\0\0\0"
+"\164\1\0\0\0\0\0\0\166\1\0\0\0\0\0\0\167\1\0\0\0\0\0\0\167\1\0\0\0\0\0\0"
+"\167\1\0\0\0\0\0\0\171\1\0\0\0\0\0\0\172\1\0\0\0\0\0\0\172\1\0\0\0\0\0\0"
+"\172\1\0\0\0\0\0\0\174\1\0\0\0\0\0\0\175\1\0\0\0\0\0\0\176\1\0\0\0\0\0\0"
+"\177\1\0\0\0\0\0\0\200\1\0\0\0\0\0\0\202\1\0\0\0\0\0\0\202\1\0\0\0\0\0\0"
+"\202\1\0\0\0\0\0\0\204\1\0\0\0\0\0\0\204\1\0\0\0\0\0\0\207\1\0\0\0\0\0\0"
+"\210\1\0\0\0\0\0\0\211\1\0\0\0\0\0\0\211\1\0\0\0\0\0\0\222\1\0\0\0\0\0\0"
+"\223\1\0\0\0\0\0\0\224\1\0\0\0\0\0\0\226\1\0\0\0\0\0\0\226\1\0\0\0\0\0\0"
+"\226\1\0\0\0\0\0\0\226\1\0\0\0\0\0\0\230\1\0\0\0\0\0\0\232\1\0\0\0\0\0\0"
+"\232\1\0\0\0\0\0\0\235\1\0\0\0\0\0\0\236\1\0\0\0\0\0\0\237\1\0\0\0\0\0\0"
+"\237\1\0\0\0\0\0\0\247\1\0\0\0\0\0\0\250\1\0\0\0\0\0\0\252\1\0\0\0\0\0\0"
+"\253\1\0\0\0\0\0\0\255\1\0\0\0\0\0\0\255\1\0\0\0\0\0\0\263\1\0\0\0\0\0\0"
+"\272\1\0\0\0\0\0\0\273\1\0\0\0\0\0\0\274\1\0\0\0\0\0\0\300\1\0\0\0\0\0\0"
+"\301\1\0\0\0\0\0\0\302\1\0\0\0\0\0\0\306\1\0\0\0\0\0\0\307\1\0\0\0\0\0\0"
+"\311\1\0\0\0\0\0\0\312\1\0\0\0\0\0\0\312\1\0\0\0\0\0\0\312\1\0\0\0\0\0\0"
+"\313\1\0\0\0\0\0\0\315\1\0\0\0\0\0\0\316\1\0\0\0\0\0\0\317\1\0\0\0\0\0\0"
+"\317\1\0\0\0\0\0\0\317\1\0\0\0\0\0\0\321\1\0\0\0\0\0\0\322\1\0\0\0\0\0\0"
+"\323\1\0\0\0\0\0\0\323\1\0\0\0\0\0\0\323\1\0\0\0\0\0\0\325\1\0\0\0\0\0\0"
+"\326\1\0\0\0\0\0\0\327\1\0\0\0\0\0\0\330\1\0\0\0\0\0\0\332\1\0\0\0\0\0\0"
+"\333\1\0\0\0\0\0\0\334\1\0\0\0\0\0\0\334\1\0\0\0\0\0\0\334\1\0\0\0\0\0\0"
+"\335\1\0\0\0\0\0\0\340\1\0\0\0\0\0\0\340\1\0\0\0\0\0\0\343\1\0\0\0\0\0\0"
+"\344\1\0\0\0\0\0\0\345\1\0\0\0\0\0\0\345\1\0\0\0\0\0\0\355\1\0\0\0\0\0\0"
+"\356\1\0\0\0\0\0\0\356\1\0\0\0\0\0\0\356\1\0\0\0\0\0\0\357\1\0\0\0\0\0\0"
+"\357\1\0\0\0\0\0\0\47\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\11\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\264\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\246\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\156\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\53\3\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\306\3\0\0\0\0\0\0\1\0\0\0\0\0\0\0\351\3\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\377\3\0\0\0\0\0\0\1\0\0\0\0\0\0\0\161\4\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0"
+"\35\0\0\0\0\0\0\0\116\0\0\0\0\0\0\0\46\0\0\0\0\0\0\0\150\0\0\0\0\0\0\0"
+"\57\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\104\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\116\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\127\0\0\0\0\0\0\0\170\0\0\0\0\0\0\0"
+"\143\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\156\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0"
+"\167\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0\175\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0"
+"\203\0\0\0\0\0\0\0\30\0\0\0\0\0\0\0\211\0\0\0\0\0\0\0\31\0\0\0\0\0\0\0"
+"\217\0\0\0\0\0\0\0\32\0\0\0\0\0\0\0\225\0\0\0\0\0\0\0\34\0\0\0\0\0\0\0"
+"\233\0\0\0\0\0\0\0\64\0\0\0\0\0\0\0\241\0\0\0\0\0\0\0\65\0\0\0\0\0\0\0"
+"\247\0\0\0\0\0\0\0\66\0\0\0\0\0\0\0\255\0\0\0\0\0\0\0\75\0\0\0\0\0\0\0"
+"\263\0\0\0\0\0\0\0\101\0\0\0\0\0\0\0\271\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0"
+"\273\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0\275\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0"
+"\312\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0\367\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0"
+"\37\1\0\0\0\0\0\0\30\0\0\0\0\0\0\0\76\1\0\0\0\0\0\0\31\0\0\0\0\0\0\0"
+"\135\1\0\0\0\0\0\0\32\0\0\0\0\0\0\0\174\1\0\0\0\0\0\0\15\0\0\0\0\0\0\0"
+"\177\1\0\0\0\0\0\0\35\0\0\0\0\0\0\0\205\1\0\0\0\0\0\0\55\0\0\0\0\0\0\0"
+"\233\1\0\0\0\0\0\0\61\0\0\0\0\0\0\0\262\1\0\0\0\0\0\0\60\0\0\0\0\0\0\0"
+"\264\1\0\0\0\0\0\0\56\0\0\0\0\0\0\0\323\1\0\0\0\0\0\0\55\0\0\0\0\0\0\0"
+"\325\1\0\0\0\0\0\0\36\0\0\0\0\0\0\0\377\1\0\0\0\0\0\0\64\0\0\0\0\0\0\0"
+"\17\2\0\0\0\0\0\0\65\0\0\0\0\0\0\0\32\2\0\0\0\0\0\0\67\0\0\0\0\0\0\0"
+"\102\2\0\0\0\0\0\0\75\0\0\0\0\0\0\0\145\2\0\0\0\0\0\0\77\0\0\0\0\0\0\0"
+"\237\2\0\0\0\0\0\0\101\0\0\0\0\0\0\0\274\2\0\0\0\0\0\0\104\0\0\0\0\0\0\0"
+"\320\2\0\0\0\0\0\0\101\0\0\0\0\0\0\0\346\2\0\0\0\0\0\0\107\0\0\0\0\0\0\0"
+"\361\2\0\0\0\0\0\0\110\0\0\0\0\0\0\0\2\3\0\0\0\0\0\0\111\0\0\0\0\0\0\0"
+"\15\3\0\0\0\0\0\0\112\0\0\0\0\0\0\0\31\3\0\0\0\0\0\0\107\0\0\0\0\0\0\0"
+"\34\3\0\0\0\0\0\0\15\0\0\0\0\0\0\0\53\3\0\0\0\0\0\0\116\0\0\0\0\0\0\0"
+"\64\3\0\0\0\0\0\0\117\0\0\0\0\0\0\0\104\3\0\0\0\0\0\0\121\0\0\0\0\0\0\0"
+"\117\3\0\0\0\0\0\0\124\0\0\0\0\0\0\0\134\3\0\0\0\0\0\0\127\0\0\0\0\0\0\0"
+"\152\3\0\0\0\0\0\0\132\0\0\0\0\0\0\0\167\3\0\0\0\0\0\0\135\0\0\0\0\0\0\0"
+"\204\3\0\0\0\0\0\0\140\0\0\0\0\0\0\0\221\3\0\0\0\0\0\0\143\0\0\0\0\0\0\0"
+"\236\3\0\0\0\0\0\0\145\0\0\0\0\0\0\0\267\3\0\0\0\0\0\0\116\0\0\0\0\0\0\0"
+"\306\3\0\0\0\0\0\0\150\0\0\0\0\0\0\0\317\3\0\0\0\0\0\0\151\0\0\0\0\0\0\0"
+"\331\3\0\0\0\0\0\0\164\0\0\0\0\0\0\0\333\3\0\0\0\0\0\0\150\0\0\0\0\0\0\0"
+"\351\3\0\0\0\0\0\0\170\0\0\0\0\0\0\0\356\3\0\0\0\0\0\0\171\0\0\0\0\0\0\0"
+"\364\3\0\0\0\0\0\0\170\0\0\0\0\0\0\0\377\3\0\0\0\0\0\0\171\0\0\0\0\0\0\0"
+"\21\4\0\0\0\0\0\0\172\0\0\0\0\0\0\0\46\4\0\0\0\0\0\0\173\0\0\0\0\0\0\0"
+"\65\4\0\0\0\0\0\0\174\0\0\0\0\0\0\0\104\4\0\0\0\0\0\0\175\0\0\0\0\0\0\0"
+"\142\4\0\0\0\0\0\0\171\0\0\0\0\0\0\0\161\4\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\7\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0"
+"\114\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+;
+
+const size_t bytecode_size = 22896;
+        const unsigned char * get_program_code(void)
+        {
+            return program_code;
+        }
+#define RUNCORE "fast"
+#define GCCORE NULL
+        int main(int argc, const char *argv[])
+        {
+            PMC                 *interp;
+            PMC                 *pbc;
+            PMC                 *argsarray;
+            const unsigned char *program_code_addr;
+            Parrot_Init_Args    *initargs;
+
+            static char         execname[1024];
+            size_t execname_size = sizeof(execname);
+            memset(execname, 0, execname_size);
+#if defined(__APPLE__)
+            if (_NSGetExecutablePath(execname, (unsigned int*)&execname_size) != 0)
+                memcpy(execname, argv[0], strlen(argv[0]));
+#elif defined(sun) || defined(__sun)
+            const char *_execname = getexecname();
+            if (_execname)
+                memcpy(execname, _execname, strlen(_execname));
+            else
+                memcpy(execname, argv[0], strlen(argv[0]));
+#elif defined(__FreeBSD__)
+            int mib[4];
+            mib[0] = CTL_KERN;
+            mib[1] = KERN_PROC;
+            mib[2] = KERN_PROC_PATHNAME;
+            mib[3] = -1;
+            sysctl(mib, 4, execname, &execname_size, NULL, 0);
+#elif defined(__NetBSD__)
+            if (readlink("/proc/curproc/exe", execname, execname_size-1) <= 0)
+                memcpy(execname, argv[0], strlen(argv[0]));
+#elif defined(__DragonFly__)
+            if (readlink("/proc/curproc/file", execname, execname_size-1) <= 0)
+                memcpy(execname, argv[0], strlen(argv[0]));
+#elif defined(_WIN32)
+            if (GetModuleFileName(NULL, execname, (DWORD)execname_size) == 0)
+                memcpy(execname, argv[0], strlen(argv[0]));
+#elif defined(__unix__) || defined(__linux__)
+            if (readlink("/proc/self/exe", execname, execname_size-1) <= 0)
+                memcpy(execname, argv[0], strlen(argv[0]));
+#else
+            memcpy(execname, argv[0], strlen(argv[0]));
+#endif
+
+            GET_INIT_STRUCT(initargs);
+
+            initargs->gc_system = GCCORE;
+
+            program_code_addr = get_program_code();
+
+            if (!program_code_addr)
+                exit(EXIT_FAILURE);
+
+            if (!(Parrot_api_make_interpreter(NULL, 0, initargs, &interp) &&
+                  Parrot_set_config_hash(interp) &&
+                  Parrot_api_set_executable_name(interp, execname) &&
+                  Parrot_api_set_runcore(interp, RUNCORE, TRACE))) {
+                fprintf(stderr, "PARROT VM: Could not initialize new interpreter\n");
+                show_last_error_and_exit(interp);
+            }
+
+            setup_pir_compregs(interp);
+
+            if (!Parrot_api_pmc_wrap_string_array(interp, argc, argv, &argsarray)) {
+                fprintf(stderr, "PARROT VM: Could not build args array");
+                show_last_error_and_exit(interp);
+            }
+
+            if (!Parrot_api_load_bytecode_bytes(interp,
+                                                program_code_addr,
+                                                (Parrot_Int) bytecode_size,
+                                                &pbc)) {
+                fprintf(stderr, "PARROT VM: Could not load bytecode\n");
+                show_last_error_and_exit(interp);
+            }
+
+            if (!Parrot_api_run_bytecode(interp, pbc, argsarray)) {
+                show_last_error_and_exit(interp);
+            }
+
+            if (!Parrot_api_destroy_interpreter(interp)) {
+                fprintf(stderr, "PARROT VM: Could not destroy interpreter\n");
+                show_last_error_and_exit(interp);
+            }
+
+            exit(EXIT_SUCCESS);
+        }
+
+        static void
+        show_last_error_and_exit(Parrot_PMC interp)
+        {
+            Parrot_String errmsg, backtrace;
+            Parrot_Int exit_code, is_error;
+            Parrot_PMC exception;
+
+            if (!Parrot_api_get_result(interp, &is_error, &exception, &exit_code, &errmsg))
+                exit(EXIT_FAILURE);
+
+            if (is_error) {
+                if (!Parrot_api_get_exception_backtrace(interp, exception, &backtrace))
+                    exit(EXIT_FAILURE);
+                print_parrot_string(interp, stderr, errmsg, 1);
+                print_parrot_string(interp, stderr, backtrace, 0);
+            }
+
+            exit(exit_code);
+        }
+
+        static void
+        print_parrot_string(Parrot_PMC interp, FILE *vector, Parrot_String str, int newline)
+        {
+            char *msg_raw;
+
+            if (!str)
+                return;
+
+            if (!Parrot_api_string_export_ascii(interp, str, &msg_raw))
+                show_last_error_and_exit(interp);
+
+            if (msg_raw) {
+                fprintf(vector, "%s%s", msg_raw, newline ? "\n" : "");
+
+                if (!Parrot_api_string_free_exported_ascii(interp, msg_raw))
+                    show_last_error_and_exit(interp);
+            }
+        }
+
+        static void
+        setup_pir_compregs(Parrot_PMC interp)
+        {
+            Parrot_PMC class_pmc = get_class_pmc(interp, "IMCCompiler");
+            get_imcc_compiler_pmc(interp, class_pmc, 0);
+            get_imcc_compiler_pmc(interp, class_pmc, 1);
+        }
+
+        PARROT_CANNOT_RETURN_NULL
+        static PMC *
+        get_class_pmc(Parrot_PMC interp, ARGIN(const char *name))
+        {
+            Parrot_String name_s = NULL;
+            Parrot_PMC name_pmc = NULL;
+            Parrot_PMC class_pmc = NULL;
+            if (!(Parrot_api_string_import_ascii(interp, name, &name_s) &&
+                  Parrot_api_pmc_box_string(interp, name_s, &name_pmc) &&
+                  Parrot_api_pmc_get_class(interp, name_pmc, &class_pmc)))
+                show_last_error_and_exit(interp);
+            return class_pmc;
+        }
+
+        PARROT_CANNOT_RETURN_NULL
+        static void
+        get_imcc_compiler_pmc(Parrot_PMC interp, Parrot_PMC class_pmc, Parrot_Int is_pasm)
+        {
+            Parrot_PMC is_pasm_pmc = NULL;
+            Parrot_PMC compiler_pmc = NULL;
+            const char * const name = is_pasm ? "PASM" : "PIR";
+            Parrot_String name_s = NULL;
+
+            if (!Parrot_api_pmc_box_integer(interp, is_pasm, &is_pasm_pmc))
+                show_last_error_and_exit(interp);
+            if (!Parrot_api_pmc_new_from_class(interp, class_pmc, is_pasm_pmc, &compiler_pmc))
+                show_last_error_and_exit(interp);
+            if (!(Parrot_api_string_import_ascii(interp, name, &name_s) &&
+                  Parrot_api_set_compiler(interp, name_s, compiler_pmc)))
+                show_last_error_and_exit(interp);
+        }
+
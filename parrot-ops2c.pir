@@ -0,0 +1,497 @@
+
+.namespace []
+.sub "_block1000"  :anon :subid("10_1792415690.21476")
+.annotate 'file', "compilers/opsc/ops2c.nqp"
+.annotate 'line', 0
+    .const 'Sub' $P1046 = "14_1792415690.21476" 
+    capture_lex $P1046
+    .const 'Sub' $P1041 = "13_1792415690.21476" 
+    capture_lex $P1041
+    .const 'Sub' $P1035 = "12_1792415690.21476" 
+    capture_lex $P1035
+    .const 'Sub' $P1003 = "11_1792415690.21476" 
+    capture_lex $P1003
+.annotate 'line', 13
+    .const 'Sub' $P1003 = "11_1792415690.21476" 
+    newclosure $P1033, $P1003
+    set $P1002, $P1033
+    .lex "MAIN", $P1002
+.annotate 'line', 78
+    .const 'Sub' $P1035 = "12_1792415690.21476" 
+    newclosure $P1039, $P1035
+    set $P1034, $P1039
+    .lex "get_options", $P1034
+.annotate 'line', 104
+    .const 'Sub' $P1041 = "13_1792415690.21476" 
+    newclosure $P1044, $P1041
+    set $P1040, $P1044
+    .lex "usage", $P1040
+.annotate 'line', 1
+    $P0 = find_dynamic_lex "$*CTXSAVE"
+    if null $P0 goto ctxsave_done
+    $I0 = can $P0, "ctxsave"
+    unless $I0 goto ctxsave_done
+    $P0."ctxsave"()
+  ctxsave_done:
+.annotate 'line', 4
+
+.end
+.sub 'main' :main
+    .const "Sub" $P0 = "MAIN"
+    .tailcall $P0()
+.end
+.sub '' :anon
+
+.annotate 'line', 1
+    find_lex $P115, "MAIN"
+    find_lex $P115, "get_options"
+    find_lex $P115, "usage"
+.annotate 'line', 120
+    .const 'Sub' $P1046 = "14_1792415690.21476" 
+    capture_lex $P1046
+    $P115 = $P1046()
+.annotate 'line', 1
+    .return ($P115)
+    .const 'Sub' $P1057 = "16_1792415690.21476" 
+    .return ($P1057)
+.end
+
+
+.namespace []
+.include "except_types.pasm"
+.sub "MAIN"  :subid("11_1792415690.21476") :outer("10_1792415690.21476")
+.annotate 'file', "compilers/opsc/ops2c.nqp"
+.annotate 'line', 13
+    new $P1005, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1005, control_1004
+    push_eh $P1005
+.annotate 'line', 17
+    new $P100, "Undef"
+    set $P1006, $P100
+    .lex "$opts", $P1006
+.annotate 'line', 23
+    new $P101, "Undef"
+    set $P1007, $P101
+    .lex "$emit_lines", $P1007
+.annotate 'line', 24
+    new $P102, "Undef"
+    set $P1008, $P102
+    .lex "$core", $P1008
+.annotate 'line', 25
+    new $P103, "Undef"
+    set $P1009, $P103
+    .lex "$debug", $P1009
+.annotate 'line', 26
+    new $P104, "Undef"
+    set $P1010, $P104
+    .lex "$quiet", $P1010
+.annotate 'line', 28
+    $P1012 = root_new ['parrot';'ResizablePMCArray']
+    set $P1011, $P1012
+    .lex "@files", $P1011
+.annotate 'line', 52
+    new $P105, "Undef"
+    set $P1013, $P105
+    .lex "$trans", $P1013
+.annotate 'line', 53
+    new $P106, "Undef"
+    set $P1014, $P106
+    .lex "$start_time", $P1014
+.annotate 'line', 54
+    new $P107, "Undef"
+    set $P1015, $P107
+    .lex "$lib", $P1015
+.annotate 'line', 61
+    new $P108, "Undef"
+    set $P1016, $P108
+    .lex "$f", $P1016
+.annotate 'line', 65
+    new $P109, "Undef"
+    set $P1017, $P109
+    .lex "$emitter", $P1017
+.annotate 'line', 14
+    load_bytecode "opsc.pbc"
+.annotate 'line', 15
+    load_bytecode "Getopt/Obj.pbc"
+.annotate 'line', 17
+    $P110 = "get_options"()
+    store_lex "$opts", $P110
+.annotate 'line', 19
+    find_lex $P1019, "$opts"
+    unless_null $P1019, vivify_17
+    $P1019 = root_new ['parrot';'Hash']
+  vivify_17:
+    set $P110, $P1019["help"]
+    unless_null $P110, vivify_18
+    new $P110, "Undef"
+  vivify_18:
+    unless $P110, if_1018_end
+    new $P111, "Exception"
+    set $P111['type'], .CONTROL_RETURN
+    $P112 = "usage"()
+    setattribute $P111, 'payload', $P112
+    throw $P111
+  if_1018_end:
+.annotate 'line', 23
+    find_lex $P1020, "$opts"
+    unless_null $P1020, vivify_19
+    $P1020 = root_new ['parrot';'Hash']
+  vivify_19:
+    set $P110, $P1020["no-lines"]
+    unless_null $P110, vivify_20
+    new $P110, "Undef"
+  vivify_20:
+    istrue $I100, $P110
+    new $P111, 'Integer'
+    set $P111, $I100
+    isfalse $I101, $P111
+    new $P112, 'Integer'
+    set $P112, $I101
+    store_lex "$emit_lines", $P112
+.annotate 'line', 24
+    find_lex $P1021, "$opts"
+    unless_null $P1021, vivify_21
+    $P1021 = root_new ['parrot';'Hash']
+  vivify_21:
+    set $P110, $P1021["core"]
+    unless_null $P110, vivify_22
+    new $P110, "Undef"
+  vivify_22:
+    istrue $I100, $P110
+    new $P111, 'Integer'
+    set $P111, $I100
+    store_lex "$core", $P111
+.annotate 'line', 25
+    find_lex $P1022, "$opts"
+    unless_null $P1022, vivify_23
+    $P1022 = root_new ['parrot';'Hash']
+  vivify_23:
+    set $P110, $P1022["debug"]
+    unless_null $P110, vivify_24
+    new $P110, "Undef"
+  vivify_24:
+    istrue $I100, $P110
+    new $P111, 'Integer'
+    set $P111, $I100
+    store_lex "$debug", $P111
+.annotate 'line', 26
+    find_lex $P1023, "$opts"
+    unless_null $P1023, vivify_25
+    $P1023 = root_new ['parrot';'Hash']
+  vivify_25:
+    set $P110, $P1023["quiet"]
+    unless_null $P110, vivify_26
+    new $P110, "Undef"
+  vivify_26:
+    istrue $I100, $P110
+    new $P111, 'Integer'
+    set $P111, $I100
+    store_lex "$quiet", $P111
+.annotate 'line', 13
+    find_lex $P110, "@files"
+.annotate 'line', 29
+    find_lex $P110, "$core"
+    if $P110, if_1024
+.annotate 'line', 45
+    find_lex $P1026, "$opts"
+    unless_null $P1026, vivify_27
+    $P1026 = root_new ['parrot';'Hash']
+  vivify_27:
+    set $P111, $P1026["dynamic"]
+    unless_null $P111, vivify_28
+    new $P111, "Undef"
+  vivify_28:
+    if $P111, if_1025
+.annotate 'line', 49
+    new $P112, "Exception"
+    set $P112['type'], .CONTROL_RETURN
+    $P113 = "usage"()
+    setattribute $P112, 'payload', $P113
+    throw $P112
+.annotate 'line', 48
+    goto if_1025_end
+  if_1025:
+.annotate 'line', 46
+    find_lex $P112, "@files"
+    find_lex $P1027, "$opts"
+    unless_null $P1027, vivify_29
+    $P1027 = root_new ['parrot';'Hash']
+  vivify_29:
+    set $P113, $P1027["dynamic"]
+    unless_null $P113, vivify_30
+    new $P113, "Undef"
+  vivify_30:
+    $P112."push"($P113)
+  if_1025_end:
+.annotate 'line', 45
+    goto if_1024_end
+  if_1024:
+.annotate 'line', 30
+    new $P111, "ResizablePMCArray"
+    push $P111, "src/ops/core.ops"
+    push $P111, "src/ops/bit.ops"
+    push $P111, "src/ops/cmp.ops"
+    push $P111, "src/ops/io.ops"
+    push $P111, "src/ops/math.ops"
+    push $P111, "src/ops/object.ops"
+    push $P111, "src/ops/pmc.ops"
+    push $P111, "src/ops/set.ops"
+    push $P111, "src/ops/string.ops"
+    push $P111, "src/ops/sys.ops"
+    push $P111, "src/ops/var.ops"
+    push $P111, "src/ops/experimental.ops"
+    store_lex "@files", $P111
+  if_1024_end:
+.annotate 'line', 52
+    get_hll_global $P110, ["Ops";"Trans"], "C"
+    $P111 = $P110."new"()
+    store_lex "$trans", $P111
+.annotate 'line', 53
+    time $N100
+    new $P110, 'Float'
+    set $P110, $N100
+    store_lex "$start_time", $P110
+.annotate 'line', 55
+    find_lex $P111, "$core"
+    if $P111, if_1028
+    get_hll_global $P115, "undef"
+    set $P110, $P115
+    goto if_1028_end
+  if_1028:
+    get_hll_global $P112, ["Ops"], "OpLib"
+    find_lex $P113, "$quiet"
+    $P114 = $P112."new"("src/ops/ops.skip" :named("skip_file"), $P113 :named("quiet"))
+    set $P110, $P114
+  if_1028_end:
+    store_lex "$lib", $P110
+.annotate 'line', 61
+    get_hll_global $P110, ["Ops"], "File"
+    find_lex $P111, "@files"
+    find_lex $P112, "$lib"
+    find_lex $P113, "$core"
+    find_lex $P114, "$quiet"
+    $P115 = $P110."new"($P111 :flat, $P112 :named("oplib"), $P113 :named("core"), $P114 :named("quiet"))
+    store_lex "$f", $P115
+.annotate 'line', 63
+    find_lex $P110, "$quiet"
+    if $P110, unless_1029_end
+    new $P111, 'String'
+    set $P111, "# Ops parsed in "
+    time $N100
+    new $P112, 'Float'
+    set $P112, $N100
+    find_lex $P113, "$start_time"
+    sub $P114, $P112, $P113
+    new $P115, "ResizablePMCArray"
+    push $P115, $P114
+    sprintf $S100, "%.3f", $P115
+    set $S101, $S100
+    concat $P112, $P111, $S101
+    concat $P113, $P112, " seconds."
+    "say"($P113)
+  unless_1029_end:
+.annotate 'line', 65
+    get_hll_global $P110, ["Ops"], "Emitter"
+    find_lex $P111, "$f"
+    find_lex $P112, "$trans"
+    find_lex $P1030, "@files"
+    unless_null $P1030, vivify_31
+    $P1030 = root_new ['parrot';'ResizablePMCArray']
+  vivify_31:
+    set $P113, $P1030[0]
+    unless_null $P113, vivify_32
+    new $P113, "Undef"
+  vivify_32:
+.annotate 'line', 68
+    find_lex $P114, "$core"
+    find_lex $P115, "$quiet"
+    $P116 = "hash"($P114 :named("core"), $P115 :named("quiet"))
+.annotate 'line', 65
+    $P117 = $P110."new"($P111 :named("ops_file"), $P112 :named("trans"), "ops2c.nqp" :named("script"), $P113 :named("file"), $P116 :named("flags"))
+    store_lex "$emitter", $P117
+.annotate 'line', 71
+    find_lex $P111, "$debug"
+    unless $P111, unless_1031
+    set $P110, $P111
+    goto unless_1031_end
+  unless_1031:
+.annotate 'line', 72
+    find_lex $P112, "$core"
+    unless $P112, if_1032_end
+    find_lex $P113, "$emitter"
+    $P113."print_ops_num_files"()
+  if_1032_end:
+.annotate 'line', 73
+    find_lex $P112, "$emitter"
+    $P112."print_c_header_files"()
+.annotate 'line', 74
+    find_lex $P112, "$emitter"
+    $P113 = $P112."print_c_source_file"()
+.annotate 'line', 71
+    set $P110, $P113
+  unless_1031_end:
+.annotate 'line', 13
+    .return ($P110)
+  control_1004:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P111, exception, "payload"
+    .return ($P111)
+.end
+
+
+.namespace []
+.include "except_types.pasm"
+.sub "get_options"  :subid("12_1792415690.21476") :outer("10_1792415690.21476")
+.annotate 'file', "compilers/opsc/ops2c.nqp"
+.annotate 'line', 78
+    new $P1037, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1037, control_1036
+    push_eh $P1037
+.annotate 'line', 79
+    new $P112, "Undef"
+    set $P1038, $P112
+    .lex "$getopts", $P1038
+    get_hll_global $P113, ["Getopt"], "Obj"
+    new $P114, $P113
+    store_lex "$getopts", $P114
+.annotate 'line', 81
+    find_lex $P113, "$getopts"
+    $P113."notOptStop"()
+.annotate 'line', 84
+    find_lex $P113, "$getopts"
+    $P113."add_option"("core", "c")
+.annotate 'line', 87
+    find_lex $P113, "$getopts"
+    $P113."add_option"("dynamic", "d", "String")
+.annotate 'line', 90
+    find_lex $P113, "$getopts"
+    $P113."add_option"("debug", "g")
+.annotate 'line', 93
+    find_lex $P113, "$getopts"
+    $P113."add_option"("no-lines", "n")
+.annotate 'line', 96
+    find_lex $P113, "$getopts"
+    $P113."add_option"("help", "h")
+.annotate 'line', 99
+    find_lex $P113, "$getopts"
+    $P113."add_option"("quiet", "q")
+.annotate 'line', 101
+    find_lex $P113, "$getopts"
+    getinterp $P114
+    set $P115, $P114[2]
+    unless_null $P115, vivify_33
+    new $P115, "Undef"
+  vivify_33:
+    $P116 = $P113."get_options"($P115)
+.annotate 'line', 78
+    .return ($P116)
+  control_1036:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P113, exception, "payload"
+    .return ($P113)
+.end
+
+
+.namespace []
+.include "except_types.pasm"
+.sub "usage"  :subid("13_1792415690.21476") :outer("10_1792415690.21476")
+.annotate 'file', "compilers/opsc/ops2c.nqp"
+.annotate 'line', 104
+    new $P1043, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1043, control_1042
+    push_eh $P1043
+.annotate 'line', 105
+    "say"("This is parrot-ops2c, part of the Parrot VM's build infrastructure.\n    normal options:\n    -c --core                generate the C code for core ops (must be run from within Parrot's build directory)\n    -d --dynamic <file.ops>  generate the C code for the dynamic ops in a single .ops file\n    -q --quiet               don't report any non-error messages\n    -h --help                print this usage information\n    -n --no-lines            do not print #line directives in generated C code (line numbers are not currently supported)\n\n    debugging options:\n    -g --debug               perform all processing but do not write to any files\n    ")
+.annotate 'line', 116
+    exit 0
+.annotate 'line', 104
+    .return ()
+  control_1042:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P114, exception, "payload"
+    .return ($P114)
+.end
+
+
+.namespace ["Getopt";"Obj"]
+.sub "_block1045"  :subid("14_1792415690.21476") :outer("10_1792415690.21476")
+.annotate 'file', "compilers/opsc/ops2c.nqp"
+.annotate 'line', 120
+    .const 'Sub' $P1047 = "15_1792415690.21476" 
+    capture_lex $P1047
+.annotate 'line', 121
+    .const 'Sub' $P1047 = "15_1792415690.21476" 
+    newclosure $P1055, $P1047
+.annotate 'line', 120
+    .return ($P1055)
+.end
+
+
+.namespace ["Getopt";"Obj"]
+.include "except_types.pasm"
+.sub "add_option"  :subid("15_1792415690.21476") :method :outer("14_1792415690.21476") :multi(_,_,_)
+    .param pmc param_1050
+    .param pmc param_1051
+    .param pmc param_1052 :optional
+    .param int has_param_1052 :opt_flag
+.annotate 'file', "compilers/opsc/ops2c.nqp"
+.annotate 'line', 121
+    new $P1049, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1049, control_1048
+    push_eh $P1049
+    .lex "self", self
+    .lex "$long", param_1050
+    .lex "$short", param_1051
+    if has_param_1052, optparam_34
+    new $P115, "Undef"
+    set param_1052, $P115
+  optparam_34:
+    .lex "$type", param_1052
+.annotate 'line', 122
+    new $P117, "Undef"
+    set $P1053, $P117
+    .lex "$opt", $P1053
+    find_lex $P118, "self"
+    $P119 = $P118."add"()
+    store_lex "$opt", $P119
+.annotate 'line', 123
+    find_lex $P118, "$opt"
+    find_lex $P119, "$long"
+    $P118."long"($P119)
+.annotate 'line', 124
+    find_lex $P118, "$opt"
+    find_lex $P119, "$short"
+    $P118."short"($P119)
+.annotate 'line', 125
+    find_lex $P119, "$type"
+    if $P119, if_1054
+    set $P118, $P119
+    goto if_1054_end
+  if_1054:
+    find_lex $P120, "$opt"
+    find_lex $P121, "$type"
+    $P122 = $P120."type"($P121)
+    set $P118, $P122
+  if_1054_end:
+.annotate 'line', 121
+    .return ($P118)
+  control_1048:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P119, exception, "payload"
+    .return ($P119)
+.end
+
+
+.namespace []
+.sub "_block1056" :load :anon :subid("16_1792415690.21476")
+.annotate 'file', "compilers/opsc/ops2c.nqp"
+.annotate 'line', 1
+    .const '' $P1058 = "10_1792415690.21476" 
+    $P117 = $P1058()
+    .return ($P117)
+.end
+
@@ -0,0 +1,313 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifndef _WIN32
+#  include <unistd.h> /* for readlink() */
+#endif
+#ifdef __APPLE__
+#  include <mach-o/dyld.h> /* for _NSGetExecutablePath() */
+#endif
+#ifdef __FreeBSD__
+#  include <sys/sysctl.h>
+#endif
+#include "parrot/api.h"
+
+int Parrot_set_config_hash(Parrot_PMC interp_pmc);
+static void show_last_error_and_exit(Parrot_PMC interp);
+static void print_parrot_string(Parrot_PMC interp, FILE *vector, Parrot_String str, int newline);
+static void setup_pir_compregs(Parrot_PMC interp);
+static PMC * get_class_pmc(Parrot_PMC interp, const char *name);
+static void get_imcc_compiler_pmc(Parrot_PMC interp, Parrot_PMC class_pmc, Parrot_Int is_pasm);
+
+#define TRACE 0
+
+const unsigned char program_code[] =
+"\376\120\102\103\15\12\32\12\10\0\0\6\11\0\15\5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\276\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\44\0\0\0\0\0\0\0"
+"\102\131\124\105\103\117\104\105\137\164\157\157\154\163\57\144\145\166\57\160\141\162\162\157\164\55\143\157\156\146\151\147"
+"\56\160\151\162\0\0\0\0\54\0\0\0\0\0\0\0\340\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\44\0\0\0\0\0\0\0\103\117\116\123\124\101\116\124\137\164\157\157\154\163\57\144"
+"\145\166\57\160\141\162\162\157\164\55\143\157\156\146\151\147\56\160\151\162\0\0\0\0\14\1\0\0\0\0\0\0"
+"\172\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\47\0\0\0\0\0\0\0"
+"\102\131\124\105\103\117\104\105\137\164\157\157\154\163\57\144\145\166\57\160\141\162\162\157\164\55\143\157\156\146\151\147"
+"\56\160\151\162\137\104\102\0\206\1\0\0\0\0\0\0\100\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\340\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\233\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\162\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\141\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\105\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\66\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\13\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0"
+"\14\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0"
+"\15\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\13\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\337\377\377\377\377\377\377\377"
+"\17\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\20\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\17\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\21\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\22\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\347\377\377\377\377\377\377\377"
+"\20\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\20\0\0\0\0\0\0\0"
+"\23\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0"
+"\7\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\6\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0"
+"\10\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\356\377\377\377\377\377\377\377\20\0\0\0\0\0\0\0"
+"\27\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\30\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\31\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\32\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\30\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\31\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\32\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\30\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0"
+"\31\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\32\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\33\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\34\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\143\157\162\145\137\157\160\163"
+"\0\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\34\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\41\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\350\2\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\315\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\140\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\11\3\0\0\0\0\0\0\5\0\0\0\0\0\0\0\315\2\0\0\0\0\0\0"
+"\6\0\0\0\0\0\0\0\6\3\0\0\0\0\0\0\7\0\0\0\0\0\0\0\245\0\0\0\0\0\0\0"
+"\10\0\0\0\0\0\0\0\207\2\0\0\0\0\0\0\11\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0"
+"\12\0\0\0\0\0\0\0\224\1\0\0\0\0\0\0\13\0\0\0\0\0\0\0\313\0\0\0\0\0\0\0"
+"\14\0\0\0\0\0\0\0\35\3\0\0\0\0\0\0\15\0\0\0\0\0\0\0\146\1\0\0\0\0\0\0"
+"\16\0\0\0\0\0\0\0\307\1\0\0\0\0\0\0\17\0\0\0\0\0\0\0\147\1\0\0\0\0\0\0"
+"\20\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0\156\1\0\0\0\0\0\0"
+"\22\0\0\0\0\0\0\0\335\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0\307\2\0\0\0\0\0\0"
+"\24\0\0\0\0\0\0\0\30\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\245\2\0\0\0\0\0\0"
+"\26\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0\7\3\0\0\0\0\0\0"
+"\30\0\0\0\0\0\0\0\40\0\0\0\0\0\0\0\31\0\0\0\0\0\0\0\20\2\0\0\0\0\0\0"
+"\32\0\0\0\0\0\0\0\43\0\0\0\0\0\0\0\33\0\0\0\0\0\0\0\76\0\0\0\0\0\0\0"
+"\172\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\160\162\151\156\164\0\0\0\1\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0"
+"\40\156\157\40\163\165\143\150\40\153\145\171\72\40\47\0\1\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0"
+"\163\164\144\145\162\162\137\150\141\156\144\154\145\0\0\0\1\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\47\12\0\0\0\0\0\0\1\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\55\55\144\165\155\160\0\0"
+"\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\71\0\0\0\0\0\0\0\40\133\40\74\143\157\156\146\151\147\55\153\145\171\76\40\133\40\74\143\157\156\146\151"
+"\147\55\153\145\171\76\40\56\56\56\40\135\40\174\40\55\55\144\165\155\160\40\174\40\55\55\150\145\154\160\40\135"
+"\12\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\40\75\76\40\47\0\0\0"
+"\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\47\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\6\0\0\0\0\0\0\0\55\55\150\145\154\160\0\0\0\0\0\0\0\0\0\0\33\0\0\0\0\0\0\0"
+"\164\157\157\154\163\57\144\145\166\57\160\141\162\162\157\164\55\143\157\156\146\151\147\56\160\151\162\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\137\155\141\151\156\0\0\0\377\377\377\377\377\377\377\377"
+"\1\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\160\141\162\162\157\164\0\0\50\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\40\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\250\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\233\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0"
+"\13\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377"
+"\3\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0"
+"\13\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\100\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\71\0\0\0\0\0\0\0\37\0\0\0\0\0\0\0\42\0\0\0\0\0\0\0"
+"\43\0\0\0\0\0\0\0\47\0\0\0\0\0\0\0\50\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0"
+"\54\0\0\0\0\0\0\0\55\0\0\0\0\0\0\0\56\0\0\0\0\0\0\0\57\0\0\0\0\0\0\0"
+"\60\0\0\0\0\0\0\0\61\0\0\0\0\0\0\0\62\0\0\0\0\0\0\0\63\0\0\0\0\0\0\0"
+"\64\0\0\0\0\0\0\0\65\0\0\0\0\0\0\0\66\0\0\0\0\0\0\0\67\0\0\0\0\0\0\0"
+"\70\0\0\0\0\0\0\0\72\0\0\0\0\0\0\0\73\0\0\0\0\0\0\0\74\0\0\0\0\0\0\0"
+"\75\0\0\0\0\0\0\0\76\0\0\0\0\0\0\0\77\0\0\0\0\0\0\0\100\0\0\0\0\0\0\0"
+"\101\0\0\0\0\0\0\0\102\0\0\0\0\0\0\0\103\0\0\0\0\0\0\0\104\0\0\0\0\0\0\0"
+"\106\0\0\0\0\0\0\0\107\0\0\0\0\0\0\0\110\0\0\0\0\0\0\0\111\0\0\0\0\0\0\0"
+"\114\0\0\0\0\0\0\0\116\0\0\0\0\0\0\0\117\0\0\0\0\0\0\0\120\0\0\0\0\0\0\0"
+"\121\0\0\0\0\0\0\0\122\0\0\0\0\0\0\0\123\0\0\0\0\0\0\0\124\0\0\0\0\0\0\0"
+"\125\0\0\0\0\0\0\0\127\0\0\0\0\0\0\0\131\0\0\0\0\0\0\0\132\0\0\0\0\0\0\0"
+"\133\0\0\0\0\0\0\0\133\0\0\0\0\0\0\0\133\0\0\0\0\0\0\0\134\0\0\0\0\0\0\0"
+"\134\0\0\0\0\0\0\0\134\0\0\0\0\0\0\0\135\0\0\0\0\0\0\0\135\0\0\0\0\0\0\0"
+"\135\0\0\0\0\0\0\0\136\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0"
+;
+
+const size_t bytecode_size = 3632;
+        const unsigned char * get_program_code(void)
+        {
+            return program_code;
+        }
+#define RUNCORE "fast"
+#define GCCORE NULL
+        int main(int argc, const char *argv[])
+        {
+            PMC                 *interp;
+            PMC                 *pbc;
+            PMC                 *argsarray;
+            const unsigned char *program_code_addr;
+            Parrot_Init_Args    *initargs;
+
+            static char         execname[1024];
+            size_t execname_size = sizeof(execname);
+            memset(execname, 0, execname_size);
+#if defined(__APPLE__)
+            if (_NSGetExecutablePath(execname, (unsigned int*)&execname_size) != 0)
+                memcpy(execname, argv[0], strlen(argv[0]));
+#elif defined(sun) || defined(__sun)
+            const char *_execname = getexecname();
+            if (_execname)
+                memcpy(execname, _execname, strlen(_execname));
+            else
+                memcpy(execname, argv[0], strlen(argv[0]));
+#elif defined(__FreeBSD__)
+            int mib[4];
+            mib[0] = CTL_KERN;
+            mib[1] = KERN_PROC;
+            mib[2] = KERN_PROC_PATHNAME;
+            mib[3] = -1;
+            sysctl(mib, 4, execname, &execname_size, NULL, 0);
+#elif defined(__NetBSD__)
+            if (readlink("/proc/curproc/exe", execname, execname_size-1) <= 0)
+                memcpy(execname, argv[0], strlen(argv[0]));
+#elif defined(__DragonFly__)
+            if (readlink("/proc/curproc/file", execname, execname_size-1) <= 0)
+                memcpy(execname, argv[0], strlen(argv[0]));
+#elif defined(_WIN32)
+            if (GetModuleFileName(NULL, execname, (DWORD)execname_size) == 0)
+                memcpy(execname, argv[0], strlen(argv[0]));
+#elif defined(__unix__) || defined(__linux__)
+            if (readlink("/proc/self/exe", execname, execname_size-1) <= 0)
+                memcpy(execname, argv[0], strlen(argv[0]));
+#else
+            memcpy(execname, argv[0], strlen(argv[0]));
+#endif
+
+            GET_INIT_STRUCT(initargs);
+
+            initargs->gc_system = GCCORE;
+
+            program_code_addr = get_program_code();
+
+            if (!program_code_addr)
+                exit(EXIT_FAILURE);
+
+            if (!(Parrot_api_make_interpreter(NULL, 0, initargs, &interp) &&
+                  Parrot_set_config_hash(interp) &&
+                  Parrot_api_set_executable_name(interp, execname) &&
+                  Parrot_api_set_runcore(interp, RUNCORE, TRACE))) {
+                fprintf(stderr, "PARROT VM: Could not initialize new interpreter\n");
+                show_last_error_and_exit(interp);
+            }
+
+            setup_pir_compregs(interp);
+
+            if (!Parrot_api_pmc_wrap_string_array(interp, argc, argv, &argsarray)) {
+                fprintf(stderr, "PARROT VM: Could not build args array");
+                show_last_error_and_exit(interp);
+            }
+
+            if (!Parrot_api_load_bytecode_bytes(interp,
+                                                program_code_addr,
+                                                (Parrot_Int) bytecode_size,
+                                                &pbc)) {
+                fprintf(stderr, "PARROT VM: Could not load bytecode\n");
+                show_last_error_and_exit(interp);
+            }
+
+            if (!Parrot_api_run_bytecode(interp, pbc, argsarray)) {
+                show_last_error_and_exit(interp);
+            }
+
+            if (!Parrot_api_destroy_interpreter(interp)) {
+                fprintf(stderr, "PARROT VM: Could not destroy interpreter\n");
+                show_last_error_and_exit(interp);
+            }
+
+            exit(EXIT_SUCCESS);
+        }
+
+        static void
+        show_last_error_and_exit(Parrot_PMC interp)
+        {
+            Parrot_String errmsg, backtrace;
+            Parrot_Int exit_code, is_error;
+            Parrot_PMC exception;
+
+            if (!Parrot_api_get_result(interp, &is_error, &exception, &exit_code, &errmsg))
+                exit(EXIT_FAILURE);
+
+            if (is_error) {
+                if (!Parrot_api_get_exception_backtrace(interp, exception, &backtrace))
+                    exit(EXIT_FAILURE);
+                print_parrot_string(interp, stderr, errmsg, 1);
+                print_parrot_string(interp, stderr, backtrace, 0);
+            }
+
+            exit(exit_code);
+        }
+
+        static void
+        print_parrot_string(Parrot_PMC interp, FILE *vector, Parrot_String str, int newline)
+        {
+            char *msg_raw;
+
+            if (!str)
+                return;
+
+            if (!Parrot_api_string_export_ascii(interp, str, &msg_raw))
+                show_last_error_and_exit(interp);
+
+            if (msg_raw) {
+                fprintf(vector, "%s%s", msg_raw, newline ? "\n" : "");
+
+                if (!Parrot_api_string_free_exported_ascii(interp, msg_raw))
+                    show_last_error_and_exit(interp);
+            }
+        }
+
+        static void
+        setup_pir_compregs(Parrot_PMC interp)
+        {
+            Parrot_PMC class_pmc = get_class_pmc(interp, "IMCCompiler");
+            get_imcc_compiler_pmc(interp, class_pmc, 0);
+            get_imcc_compiler_pmc(interp, class_pmc, 1);
+        }
+
+        PARROT_CANNOT_RETURN_NULL
+        static PMC *
+        get_class_pmc(Parrot_PMC interp, ARGIN(const char *name))
+        {
+            Parrot_String name_s = NULL;
+            Parrot_PMC name_pmc = NULL;
+            Parrot_PMC class_pmc = NULL;
+            if (!(Parrot_api_string_import_ascii(interp, name, &name_s) &&
+                  Parrot_api_pmc_box_string(interp, name_s, &name_pmc) &&
+                  Parrot_api_pmc_get_class(interp, name_pmc, &class_pmc)))
+                show_last_error_and_exit(interp);
+            return class_pmc;
+        }
+
+        PARROT_CANNOT_RETURN_NULL
+        static void
+        get_imcc_compiler_pmc(Parrot_PMC interp, Parrot_PMC class_pmc, Parrot_Int is_pasm)
+        {
+            Parrot_PMC is_pasm_pmc = NULL;
+            Parrot_PMC compiler_pmc = NULL;
+            const char * const name = is_pasm ? "PASM" : "PIR";
+            Parrot_String name_s = NULL;
+
+            if (!Parrot_api_pmc_box_integer(interp, is_pasm, &is_pasm_pmc))
+                show_last_error_and_exit(interp);
+            if (!Parrot_api_pmc_new_from_class(interp, class_pmc, is_pasm_pmc, &compiler_pmc))
+                show_last_error_and_exit(interp);
+            if (!(Parrot_api_string_import_ascii(interp, name, &name_s) &&
+                  Parrot_api_set_compiler(interp, name_s, compiler_pmc)))
+                show_last_error_and_exit(interp);
+        }
+
@@ -0,0 +1,1468 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifndef _WIN32
+#  include <unistd.h> /* for readlink() */
+#endif
+#ifdef __APPLE__
+#  include <mach-o/dyld.h> /* for _NSGetExecutablePath() */
+#endif
+#ifdef __FreeBSD__
+#  include <sys/sysctl.h>
+#endif
+#include "parrot/api.h"
+
+int Parrot_set_config_hash(Parrot_PMC interp_pmc);
+static void show_last_error_and_exit(Parrot_PMC interp);
+static void print_parrot_string(Parrot_PMC interp, FILE *vector, Parrot_String str, int newline);
+static void setup_pir_compregs(Parrot_PMC interp);
+static PMC * get_class_pmc(Parrot_PMC interp, const char *name);
+static void get_imcc_compiler_pmc(Parrot_PMC interp, Parrot_PMC class_pmc, Parrot_Int is_pasm);
+
+#define TRACE 0
+
+const unsigned char program_code[] =
+"\376\120\102\103\15\12\32\12\10\0\0\6\11\0\15\5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\312\23\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\41\0\0\0\0\0\0\0"
+"\102\131\124\105\103\117\104\105\137\164\157\157\154\163\57\144\145\166\57\160\142\143\137\164\157\137\145\170\145\56\160\151"
+"\162\0\0\0\0\0\0\0\54\0\0\0\0\0\0\0\6\10\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\41\0\0\0\0\0\0\0\103\117\116\123\124\101\116\124\137\164\157\157\154\163\57\144"
+"\145\166\57\160\142\143\137\164\157\137\145\170\145\56\160\151\162\0\0\0\0\0\0\0\62\10\0\0\0\0\0\0"
+"\74\11\0\0\0\0\0\0\4\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\44\0\0\0\0\0\0\0"
+"\102\131\124\105\103\117\104\105\137\164\157\157\154\163\57\144\145\166\57\160\142\143\137\164\157\137\145\170\145\56\160\151"
+"\162\137\104\102\0\0\0\0\156\21\0\0\0\0\0\0\144\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\6\10\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\163\7\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\25\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\37\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\53\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\7\0\0\0\0\0\0\0\57\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0"
+"\47\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\55\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\13\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0"
+"\72\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\6\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\16\0\0\0\0\0\0\0\22\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\11\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0"
+"\14\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0"
+"\11\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\21\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0"
+"\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\6\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\20\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0"
+"\12\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0"
+"\20\0\0\0\0\0\0\0\22\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0"
+"\12\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0"
+"\6\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\22\0\0\0\0\0\0\0"
+"\24\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\22\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0"
+"\12\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0"
+"\10\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0"
+"\6\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\6\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\16\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0"
+"\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0"
+"\7\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\14\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0"
+"\12\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0"
+"\13\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0"
+"\10\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0"
+"\6\0\0\0\0\0\0\0\22\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0"
+"\10\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0"
+"\12\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\20\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\6\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0"
+"\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0"
+"\30\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\33\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\22\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\30\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\32\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\20\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\17\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\106\0\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\102\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0"
+"\240\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\31\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\31\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0\32\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\24\0\0\0\0\0\0\0\33\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\40\0\0\0\0\0\0\0"
+"\33\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\43\0\0\0\0\0\0\0\33\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0\33\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\57\0\0\0\0\0\0\0\33\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\42\0\0\0\0\0\0\0"
+"\33\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\41\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\56\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0"
+"\23\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\34\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\30\0\0\0\0\0\0\0\34\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\31\0\0\0\0\0\0\0\34\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\32\0\0\0\0\0\0\0\31\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\33\0\0\0\0\0\0\0\31\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\34\0\0\0\0\0\0\0\31\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\35\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0"
+"\6\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\20\0\0\0\0\0\0\0\35\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\65\0\0\0\0\0\0\0"
+"\14\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\36\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\56\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\16\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\6\0\0\0\0\0\0\0\20\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\37\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\374\377\377\377\377\377\377\377"
+"\4\0\0\0\0\0\0\0\40\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0"
+"\21\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\53\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0"
+"\11\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\64\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0"
+"\10\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\112\0\0\0\0\0\0\0\41\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\42\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\43\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\40\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0"
+"\15\0\0\0\0\0\0\0\40\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\44\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0"
+"\45\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0\51\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\46\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0\61\0\0\0\0\0\0\0"
+"\11\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\47\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\42\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\50\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\46\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\54\0\0\0\0\0\0\0\51\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0"
+"\15\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\51\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0"
+"\52\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\51\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0\22\0\0\0\0\0\0\0"
+"\53\0\0\0\0\0\0\0\53\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0"
+"\374\377\377\377\377\377\377\377\4\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\46\0\0\0\0\0\0\0"
+"\15\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\54\0\0\0\0\0\0\0\51\0\0\0\0\0\0\0"
+"\7\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\51\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0"
+"\15\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\51\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0"
+"\24\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0"
+"\22\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0"
+"\7\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\20\0\0\0\0\0\0\0"
+"\11\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0"
+"\21\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\67\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0"
+"\21\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\36\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0"
+"\21\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0"
+"\22\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0"
+"\67\0\0\0\0\0\0\0\22\0\0\0\0\0\0\0\30\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0"
+"\14\0\0\0\0\0\0\0\36\0\0\0\0\0\0\0\22\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0"
+"\45\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\44\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\46\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\61\0\0\0\0\0\0\0"
+"\11\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\47\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0"
+"\7\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\102\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\240\0\0\0\0\0\0\0"
+"\6\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\31\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\40\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0"
+"\10\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\36\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\31\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\41\0\0\0\0\0\0\0\31\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\42\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\102\0\0\0\0\0\0\0"
+"\14\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\101\0\0\0\0\0\0\0"
+"\10\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\36\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\36\0\0\0\0\0\0\0\75\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\22\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\54\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\55\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\43\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\115\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0"
+"\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\14\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0"
+"\12\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\114\0\0\0\0\0\0\0"
+"\13\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\117\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\17\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\54\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\45\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\0\100\0\0\0\0\0\0\14\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\107\0\0\0\0\0\0\0"
+"\7\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0"
+"\20\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\41\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\56\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\22\0\0\0\0\0\0\0\71\0\0\0\0\0\0\0"
+"\54\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\57\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\63\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\61\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\20\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0"
+"\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\110\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\17\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\62\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\63\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\40\0\0\0\0\0\0\0\64\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\120\0\0\0\0\0\0\0"
+"\14\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\62\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\22\0\0\0\0\0\0\0"
+"\317\377\377\377\377\377\377\377\22\0\0\0\0\0\0\0\260\377\377\377\377\377\377\377\5\0\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\25\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0"
+"\7\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\112\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\46\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\14\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\113\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0"
+"\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\111\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\17\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\65\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\51\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\65\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\50\0\0\0\0\0\0\0\0\1\0\0\0\0\0\0\54\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\66\0\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0"
+"\67\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\30\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\124\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\70\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\62\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\22\0\0\0\0\0\0\0\356\377\377\377\377\377\377\377"
+"\1\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\115\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\15\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\16\0\0\0\0\0\0\0\114\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\7\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0"
+"\7\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\131\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\54\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\45\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\0\100\0\0\0\0\0\0\14\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\107\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\16\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\6\0\0\0\0\0\0\0\20\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\41\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\56\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\22\0\0\0\0\0\0\0"
+"\61\0\0\0\0\0\0\0\54\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\57\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\53\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\71\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0"
+"\20\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\62\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\63\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\40\0\0\0\0\0\0\0\64\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\14\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\127\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0"
+"\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\62\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\22\0\0\0\0\0\0\0\327\377\377\377\377\377\377\377\22\0\0\0\0\0\0\0\270\377\377\377\377\377\377\377"
+"\5\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\132\0\0\0\0\0\0\0"
+"\14\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\46\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0"
+"\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\113\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\17\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0"
+"\7\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\111\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\54\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\72\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\374\377\377\377\377\377\377\377\40\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\53\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\14\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0"
+"\64\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\53\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\374\377\377\377\377\377\377\377\4\0\0\0\0\0\0\0"
+"\6\0\0\0\0\0\0\0\72\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0"
+"\25\0\0\0\0\0\0\0\37\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\134\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\46\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\134\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\22\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0"
+"\55\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\44\0\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\144\0\0\0\0\0\0\0"
+"\6\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\20\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0"
+"\141\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\17\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\20\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\142\0\0\0\0\0\0\0\46\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\155\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\46\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\152\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\12\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0"
+"\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\14\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0"
+"\12\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\143\0\0\0\0\0\0\0"
+"\13\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\20\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\17\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\25\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\23\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0"
+"\14\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0"
+"\150\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\32\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\56\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\20\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\140\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\73\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\147\0\0\0\0\0\0\0"
+"\14\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\20\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0"
+"\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\154\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\17\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0"
+"\46\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\113\0\0\0\0\0\0\0"
+"\14\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\153\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0"
+"\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\45\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\137\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\74\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\22\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0"
+"\6\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\23\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\14\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0"
+"\146\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\7\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\44\0\0\0\0\0\0\0\34\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\31\0\0\0\0\0\0\0\34\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\32\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\102\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\240\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\31\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\41\0\0\0\0\0\0\0"
+"\31\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\61\0\0\0\0\0\0\0"
+"\31\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\62\0\0\0\0\0\0\0"
+"\31\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\63\0\0\0\0\0\0\0"
+"\31\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\42\0\0\0\0\0\0\0"
+"\31\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\64\0\0\0\0\0\0\0"
+"\31\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\65\0\0\0\0\0\0\0"
+"\31\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\66\0\0\0\0\0\0\0"
+"\31\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\67\0\0\0\0\0\0\0"
+"\31\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\70\0\0\0\0\0\0\0"
+"\21\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\165\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0"
+"\52\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0"
+"\46\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0\167\0\0\0\0\0\0\0"
+"\51\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0\22\0\0\0\0\0\0\0"
+"\11\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0\20\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0"
+"\13\0\0\0\0\0\0\0\51\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\20\0\0\0\0\0\0\0"
+"\25\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0\163\0\0\0\0\0\0\0\46\0\0\0\0\0\0\0"
+"\16\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\172\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0"
+"\16\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0"
+"\16\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\46\0\0\0\0\0\0\0"
+"\16\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\176\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0"
+"\16\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0"
+"\16\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0"
+"\16\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0\46\0\0\0\0\0\0\0"
+"\16\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\172\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0"
+"\16\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\46\0\0\0\0\0\0\0"
+"\16\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\172\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0"
+"\16\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\46\0\0\0\0\0\0\0"
+"\16\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\164\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0"
+"\16\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\74\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\22\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\23\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\14\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0"
+"\166\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\75\0\0\0\0\0\0\0\162\0\0\0\0\0\0\0"
+"\74\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0"
+"\10\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\44\0\0\0\0\0\0\0\34\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\31\0\0\0\0\0\0\0\34\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\32\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\102\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\240\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0"
+"\6\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\31\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\41\0\0\0\0\0\0\0"
+"\31\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\73\0\0\0\0\0\0\0"
+"\31\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\74\0\0\0\0\0\0\0"
+"\31\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\75\0\0\0\0\0\0\0"
+"\31\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\76\0\0\0\0\0\0\0"
+"\31\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\77\0\0\0\0\0\0\0"
+"\31\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\100\0\0\0\0\0\0\0"
+"\31\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0"
+"\31\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\101\0\0\0\0\0\0\0"
+"\31\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\42\0\0\0\0\0\0\0"
+"\31\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\64\0\0\0\0\0\0\0"
+"\31\0\0\0\0\0\0\0\20\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\65\0\0\0\0\0\0\0"
+"\31\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\102\0\0\0\0\0\0\0"
+"\31\0\0\0\0\0\0\0\22\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\66\0\0\0\0\0\0\0"
+"\31\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\103\0\0\0\0\0\0\0"
+"\31\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\70\0\0\0\0\0\0\0"
+"\31\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\62\0\0\0\0\0\0\0"
+"\25\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\163\0\0\0\0\0\0\0\51\0\0\0\0\0\0\0"
+"\27\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0\22\0\0\0\0\0\0\0"
+"\165\0\0\0\0\0\0\0\47\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0"
+"\27\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0"
+"\27\0\0\0\0\0\0\0\20\0\0\0\0\0\0\0\46\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0"
+"\27\0\0\0\0\0\0\0\224\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0"
+"\27\0\0\0\0\0\0\0\20\0\0\0\0\0\0\0\64\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\11\0\0\0\0\0\0\0\46\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0"
+"\223\0\0\0\0\0\0\0\22\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\46\0\0\0\0\0\0\0"
+"\27\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0\231\0\0\0\0\0\0\0\31\0\0\0\0\0\0\0"
+"\13\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\104\0\0\0\0\0\0\0\22\0\0\0\0\0\0\0"
+"\32\0\0\0\0\0\0\0\31\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\104\0\0\0\0\0\0\0\31\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\105\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0"
+"\23\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0"
+"\24\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0"
+"\20\0\0\0\0\0\0\0\46\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0"
+"\223\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0"
+"\11\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0"
+"\26\0\0\0\0\0\0\0\46\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\172\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\10\0\0\0\0\0\0\0\46\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\172\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\26\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\7\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\26\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0"
+"\24\0\0\0\0\0\0\0\46\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\172\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\26\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\12\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\26\0\0\0\0\0\0\0\46\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\172\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\27\0\0\0\0\0\0\0\46\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\172\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\13\0\0\0\0\0\0\0\46\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\172\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\46\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\172\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\46\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\172\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\46\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\172\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\6\0\0\0\0\0\0\0\46\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\172\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\21\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0"
+"\74\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\22\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0"
+"\11\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\203\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\76\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\217\0\0\0\0\0\0\0"
+"\32\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\71\0\0\0\0\0\0\0\46\0\0\0\0\0\0\0"
+"\14\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\211\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0"
+"\20\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\214\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\24\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\57\0\0\0\0\0\0\0\45\0\0\0\0\0\0\0"
+"\15\0\0\0\0\0\0\0\225\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\46\0\0\0\0\0\0\0"
+"\15\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0\220\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0"
+"\15\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\46\0\0\0\0\0\0\0"
+"\15\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0\202\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\74\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\22\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\23\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\14\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0"
+"\213\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\75\0\0\0\0\0\0\0\201\0\0\0\0\0\0\0"
+"\74\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\22\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\77\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\235\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\26\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377"
+"\45\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\234\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\51\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\100\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\1\0\0\0\0\0\0\0\101\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\235\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\22\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\103\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\143\157\162\145\137\157\160\163"
+"\0\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\103\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\42\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\35\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\41\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\340\2\0\0\0\0\0\0\5\0\0\0\0\0\0\0\40\0\0\0\0\0\0\0"
+"\6\0\0\0\0\0\0\0\31\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\43\0\0\0\0\0\0\0"
+"\10\0\0\0\0\0\0\0\274\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\171\2\0\0\0\0\0\0"
+"\12\0\0\0\0\0\0\0\25\3\0\0\0\0\0\0\13\0\0\0\0\0\0\0\61\0\0\0\0\0\0\0"
+"\14\0\0\0\0\0\0\0\20\2\0\0\0\0\0\0\15\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0"
+"\16\0\0\0\0\0\0\0\44\3\0\0\0\0\0\0\17\0\0\0\0\0\0\0\1\1\0\0\0\0\0\0"
+"\20\0\0\0\0\0\0\0\331\2\0\0\0\0\0\0\21\0\0\0\0\0\0\0\245\0\0\0\0\0\0\0"
+"\22\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0\350\2\0\0\0\0\0\0"
+"\24\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\333\2\0\0\0\0\0\0"
+"\26\0\0\0\0\0\0\0\7\3\0\0\0\0\0\0\27\0\0\0\0\0\0\0\4\1\0\0\0\0\0\0"
+"\30\0\0\0\0\0\0\0\206\3\0\0\0\0\0\0\31\0\0\0\0\0\0\0\35\3\0\0\0\0\0\0"
+"\32\0\0\0\0\0\0\0\163\2\0\0\0\0\0\0\33\0\0\0\0\0\0\0\226\2\0\0\0\0\0\0"
+"\34\0\0\0\0\0\0\0\31\3\0\0\0\0\0\0\35\0\0\0\0\0\0\0\171\1\0\0\0\0\0\0"
+"\36\0\0\0\0\0\0\0\76\0\0\0\0\0\0\0\37\0\0\0\0\0\0\0\127\3\0\0\0\0\0\0"
+"\40\0\0\0\0\0\0\0\217\3\0\0\0\0\0\0\41\0\0\0\0\0\0\0\107\3\0\0\0\0\0\0"
+"\42\0\0\0\0\0\0\0\365\1\0\0\0\0\0\0\43\0\0\0\0\0\0\0\121\3\0\0\0\0\0\0"
+"\44\0\0\0\0\0\0\0\243\0\0\0\0\0\0\0\45\0\0\0\0\0\0\0\70\3\0\0\0\0\0\0"
+"\46\0\0\0\0\0\0\0\71\3\0\0\0\0\0\0\47\0\0\0\0\0\0\0\23\3\0\0\0\0\0\0"
+"\50\0\0\0\0\0\0\0\145\3\0\0\0\0\0\0\51\0\0\0\0\0\0\0\332\2\0\0\0\0\0\0"
+"\52\0\0\0\0\0\0\0\67\3\0\0\0\0\0\0\53\0\0\0\0\0\0\0\153\3\0\0\0\0\0\0"
+"\54\0\0\0\0\0\0\0\45\3\0\0\0\0\0\0\55\0\0\0\0\0\0\0\320\3\0\0\0\0\0\0"
+"\56\0\0\0\0\0\0\0\314\0\0\0\0\0\0\0\57\0\0\0\0\0\0\0\335\0\0\0\0\0\0\0"
+"\60\0\0\0\0\0\0\0\52\3\0\0\0\0\0\0\61\0\0\0\0\0\0\0\334\2\0\0\0\0\0\0"
+"\62\0\0\0\0\0\0\0\307\1\0\0\0\0\0\0\63\0\0\0\0\0\0\0\325\1\0\0\0\0\0\0"
+"\64\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0\65\0\0\0\0\0\0\0\146\4\0\0\0\0\0\0"
+"\66\0\0\0\0\0\0\0\336\0\0\0\0\0\0\0\67\0\0\0\0\0\0\0\365\2\0\0\0\0\0\0"
+"\70\0\0\0\0\0\0\0\374\2\0\0\0\0\0\0\71\0\0\0\0\0\0\0\6\3\0\0\0\0\0\0"
+"\72\0\0\0\0\0\0\0\117\3\0\0\0\0\0\0\73\0\0\0\0\0\0\0\3\3\0\0\0\0\0\0"
+"\74\0\0\0\0\0\0\0\155\1\0\0\0\0\0\0\75\0\0\0\0\0\0\0\147\1\0\0\0\0\0\0"
+"\76\0\0\0\0\0\0\0\151\0\0\0\0\0\0\0\77\0\0\0\0\0\0\0\226\3\0\0\0\0\0\0"
+"\100\0\0\0\0\0\0\0\375\2\0\0\0\0\0\0\101\0\0\0\0\0\0\0\224\3\0\0\0\0\0\0"
+"\102\0\0\0\0\0\0\0\51\4\0\0\0\0\0\0\74\11\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\241\0\0\0\0\0\0\0"
+"\107\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\107\145\164\157\160\164\57\117"
+"\142\152\56\160\142\143\0\0\1\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\143\157\156\146\151\147\56\160"
+"\142\143\0\0\0\0\0\0\0\0\0\0\0\0\0\0\30\0\0\0\0\0\0\0\164\157\157\154\163\57\144\145"
+"\166\57\160\142\143\137\164\157\137\145\170\145\56\160\151\162\1\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0"
+"\151\156\151\164\151\141\154\137\154\157\141\144\137\142\171\164\145\143\157\144\145\0\0\0\377\377\377\377\377\377\377\377"
+"\1\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\160\141\162\162\157\164\0\0\1\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\107\103\103\117\122\105\0\0"
+"\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\155\163\166\143\0\0\0\0\1\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\56\122\105\123\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\167\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\106\151\154\145\110\141\156\144"
+"\154\145\0\0\0\0\0\0\1\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\147\143\143\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\105\170\143\145\160\164\151\157\156\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\33\31\0\0\0\0\0\0\40\40\40\40\40\40\40\40\151\156\164\40\155\141\151\156"
+"\50\151\156\164\40\141\162\147\143\54\40\143\157\156\163\164\40\143\150\141\162\40\52\141\162\147\166\133\135\51\12\40"
+"\40\40\40\40\40\40\40\173\12\40\40\40\40\40\40\40\40\40\40\40\40\120\115\103\40\40\40\40\40\40\40\40"
+"\40\40\40\40\40\40\40\40\40\52\151\156\164\145\162\160\73\12\40\40\40\40\40\40\40\40\40\40\40\40\120\115"
+"\103\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\52\160\142\143\73\12\40\40\40\40\40\40\40\40"
+"\40\40\40\40\120\115\103\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\52\141\162\147\163\141\162\162"
+"\141\171\73\12\40\40\40\40\40\40\40\40\40\40\40\40\143\157\156\163\164\40\165\156\163\151\147\156\145\144\40\143"
+"\150\141\162\40\52\160\162\157\147\162\141\155\137\143\157\144\145\137\141\144\144\162\73\12\40\40\40\40\40\40\40\40"
+"\40\40\40\40\120\141\162\162\157\164\137\111\156\151\164\137\101\162\147\163\40\40\40\40\52\151\156\151\164\141\162\147"
+"\163\73\12\12\40\40\40\40\40\40\40\40\40\40\40\40\163\164\141\164\151\143\40\143\150\141\162\40\40\40\40\40"
+"\40\40\40\40\145\170\145\143\156\141\155\145\133\61\60\62\64\135\73\12\40\40\40\40\40\40\40\40\40\40\40\40"
+"\163\151\172\145\137\164\40\145\170\145\143\156\141\155\145\137\163\151\172\145\40\75\40\163\151\172\145\157\146\50\145\170"
+"\145\143\156\141\155\145\51\73\12\40\40\40\40\40\40\40\40\40\40\40\40\155\145\155\163\145\164\50\145\170\145\143"
+"\156\141\155\145\54\40\60\54\40\145\170\145\143\156\141\155\145\137\163\151\172\145\51\73\12\43\151\146\40\144\145\146"
+"\151\156\145\144\50\137\137\101\120\120\114\105\137\137\51\12\40\40\40\40\40\40\40\40\40\40\40\40\151\146\40\50"
+"\137\116\123\107\145\164\105\170\145\143\165\164\141\142\154\145\120\141\164\150\50\145\170\145\143\156\141\155\145\54\40\50"
+"\165\156\163\151\147\156\145\144\40\151\156\164\52\51\46\145\170\145\143\156\141\155\145\137\163\151\172\145\51\40\41\75"
+"\40\60\51\12\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\155\145\155\143\160\171\50\145\170\145\143\156"
+"\141\155\145\54\40\141\162\147\166\133\60\135\54\40\163\164\162\154\145\156\50\141\162\147\166\133\60\135\51\51\73\12"
+"\43\145\154\151\146\40\144\145\146\151\156\145\144\50\163\165\156\51\40\174\174\40\144\145\146\151\156\145\144\50\137\137"
+"\163\165\156\51\12\40\40\40\40\40\40\40\40\40\40\40\40\143\157\156\163\164\40\143\150\141\162\40\52\137\145\170"
+"\145\143\156\141\155\145\40\75\40\147\145\164\145\170\145\143\156\141\155\145\50\51\73\12\40\40\40\40\40\40\40\40"
+"\40\40\40\40\151\146\40\50\137\145\170\145\143\156\141\155\145\51\12\40\40\40\40\40\40\40\40\40\40\40\40\40"
+"\40\40\40\155\145\155\143\160\171\50\145\170\145\143\156\141\155\145\54\40\137\145\170\145\143\156\141\155\145\54\40\163"
+"\164\162\154\145\156\50\137\145\170\145\143\156\141\155\145\51\51\73\12\40\40\40\40\40\40\40\40\40\40\40\40\145"
+"\154\163\145\12\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\155\145\155\143\160\171\50\145\170\145\143\156"
+"\141\155\145\54\40\141\162\147\166\133\60\135\54\40\163\164\162\154\145\156\50\141\162\147\166\133\60\135\51\51\73\12"
+"\43\145\154\151\146\40\144\145\146\151\156\145\144\50\137\137\106\162\145\145\102\123\104\137\137\51\12\40\40\40\40\40"
+"\40\40\40\40\40\40\40\151\156\164\40\155\151\142\133\64\135\73\12\40\40\40\40\40\40\40\40\40\40\40\40\155"
+"\151\142\133\60\135\40\75\40\103\124\114\137\113\105\122\116\73\12\40\40\40\40\40\40\40\40\40\40\40\40\155\151"
+"\142\133\61\135\40\75\40\113\105\122\116\137\120\122\117\103\73\12\40\40\40\40\40\40\40\40\40\40\40\40\155\151"
+"\142\133\62\135\40\75\40\113\105\122\116\137\120\122\117\103\137\120\101\124\110\116\101\115\105\73\12\40\40\40\40\40"
+"\40\40\40\40\40\40\40\155\151\142\133\63\135\40\75\40\55\61\73\12\40\40\40\40\40\40\40\40\40\40\40\40"
+"\163\171\163\143\164\154\50\155\151\142\54\40\64\54\40\145\170\145\143\156\141\155\145\54\40\46\145\170\145\143\156\141"
+"\155\145\137\163\151\172\145\54\40\116\125\114\114\54\40\60\51\73\12\43\145\154\151\146\40\144\145\146\151\156\145\144"
+"\50\137\137\116\145\164\102\123\104\137\137\51\12\40\40\40\40\40\40\40\40\40\40\40\40\151\146\40\50\162\145\141"
+"\144\154\151\156\153\50\42\57\160\162\157\143\57\143\165\162\160\162\157\143\57\145\170\145\42\54\40\145\170\145\143\156"
+"\141\155\145\54\40\145\170\145\143\156\141\155\145\137\163\151\172\145\55\61\51\40\74\75\40\60\51\12\40\40\40\40"
+"\40\40\40\40\40\40\40\40\40\40\40\40\155\145\155\143\160\171\50\145\170\145\143\156\141\155\145\54\40\141\162\147"
+"\166\133\60\135\54\40\163\164\162\154\145\156\50\141\162\147\166\133\60\135\51\51\73\12\43\145\154\151\146\40\144\145"
+"\146\151\156\145\144\50\137\137\104\162\141\147\157\156\106\154\171\137\137\51\12\40\40\40\40\40\40\40\40\40\40\40"
+"\40\151\146\40\50\162\145\141\144\154\151\156\153\50\42\57\160\162\157\143\57\143\165\162\160\162\157\143\57\146\151\154"
+"\145\42\54\40\145\170\145\143\156\141\155\145\54\40\145\170\145\143\156\141\155\145\137\163\151\172\145\55\61\51\40\74"
+"\75\40\60\51\12\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\155\145\155\143\160\171\50\145\170\145\143"
+"\156\141\155\145\54\40\141\162\147\166\133\60\135\54\40\163\164\162\154\145\156\50\141\162\147\166\133\60\135\51\51\73"
+"\12\43\145\154\151\146\40\144\145\146\151\156\145\144\50\137\127\111\116\63\62\51\12\40\40\40\40\40\40\40\40\40"
+"\40\40\40\151\146\40\50\107\145\164\115\157\144\165\154\145\106\151\154\145\116\141\155\145\50\116\125\114\114\54\40\145"
+"\170\145\143\156\141\155\145\54\40\50\104\127\117\122\104\51\145\170\145\143\156\141\155\145\137\163\151\172\145\51\40\75"
+"\75\40\60\51\12\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\155\145\155\143\160\171\50\145\170\145\143"
+"\156\141\155\145\54\40\141\162\147\166\133\60\135\54\40\163\164\162\154\145\156\50\141\162\147\166\133\60\135\51\51\73"
+"\12\43\145\154\151\146\40\144\145\146\151\156\145\144\50\137\137\165\156\151\170\137\137\51\40\174\174\40\144\145\146\151"
+"\156\145\144\50\137\137\154\151\156\165\170\137\137\51\12\40\40\40\40\40\40\40\40\40\40\40\40\151\146\40\50\162"
+"\145\141\144\154\151\156\153\50\42\57\160\162\157\143\57\163\145\154\146\57\145\170\145\42\54\40\145\170\145\143\156\141"
+"\155\145\54\40\145\170\145\143\156\141\155\145\137\163\151\172\145\55\61\51\40\74\75\40\60\51\12\40\40\40\40\40"
+"\40\40\40\40\40\40\40\40\40\40\40\155\145\155\143\160\171\50\145\170\145\143\156\141\155\145\54\40\141\162\147\166"
+"\133\60\135\54\40\163\164\162\154\145\156\50\141\162\147\166\133\60\135\51\51\73\12\43\145\154\163\145\12\40\40\40"
+"\40\40\40\40\40\40\40\40\40\155\145\155\143\160\171\50\145\170\145\143\156\141\155\145\54\40\141\162\147\166\133\60"
+"\135\54\40\163\164\162\154\145\156\50\141\162\147\166\133\60\135\51\51\73\12\43\145\156\144\151\146\12\12\40\40\40"
+"\40\40\40\40\40\40\40\40\40\107\105\124\137\111\116\111\124\137\123\124\122\125\103\124\50\151\156\151\164\141\162\147"
+"\163\51\73\12\12\40\40\40\40\40\40\40\40\40\40\40\40\151\156\151\164\141\162\147\163\55\76\147\143\137\163\171"
+"\163\164\145\155\40\75\40\107\103\103\117\122\105\73\12\12\40\40\40\40\40\40\40\40\40\40\40\40\160\162\157\147"
+"\162\141\155\137\143\157\144\145\137\141\144\144\162\40\75\40\147\145\164\137\160\162\157\147\162\141\155\137\143\157\144\145"
+"\50\51\73\12\12\40\40\40\40\40\40\40\40\40\40\40\40\151\146\40\50\41\160\162\157\147\162\141\155\137\143\157"
+"\144\145\137\141\144\144\162\51\12\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\145\170\151\164\50\105\130"
+"\111\124\137\106\101\111\114\125\122\105\51\73\12\12\40\40\40\40\40\40\40\40\40\40\40\40\151\146\40\50\41\50"
+"\120\141\162\162\157\164\137\141\160\151\137\155\141\153\145\137\151\156\164\145\162\160\162\145\164\145\162\50\116\125\114\114"
+"\54\40\60\54\40\151\156\151\164\141\162\147\163\54\40\46\151\156\164\145\162\160\51\40\46\46\12\40\40\40\40\40"
+"\40\40\40\40\40\40\40\40\40\40\40\40\40\120\141\162\162\157\164\137\163\145\164\137\143\157\156\146\151\147\137\150"
+"\141\163\150\50\151\156\164\145\162\160\51\40\46\46\12\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40"
+"\40\120\141\162\162\157\164\137\141\160\151\137\163\145\164\137\145\170\145\143\165\164\141\142\154\145\137\156\141\155\145\50"
+"\151\156\164\145\162\160\54\40\145\170\145\143\156\141\155\145\51\40\46\46\12\40\40\40\40\40\40\40\40\40\40\40"
+"\40\40\40\40\40\40\40\120\141\162\162\157\164\137\141\160\151\137\163\145\164\137\162\165\156\143\157\162\145\50\151\156"
+"\164\145\162\160\54\40\122\125\116\103\117\122\105\54\40\124\122\101\103\105\51\51\51\40\173\12\40\40\40\40\40\40"
+"\40\40\40\40\40\40\40\40\40\40\146\160\162\151\156\164\146\50\163\164\144\145\162\162\54\40\42\120\101\122\122\117"
+"\124\40\126\115\72\40\103\157\165\154\144\40\156\157\164\40\151\156\151\164\151\141\154\151\172\145\40\156\145\167\40\151"
+"\156\164\145\162\160\162\145\164\145\162\134\156\42\51\73\12\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40"
+"\163\150\157\167\137\154\141\163\164\137\145\162\162\157\162\137\141\156\144\137\145\170\151\164\50\151\156\164\145\162\160\51"
+"\73\12\40\40\40\40\40\40\40\40\40\40\40\40\175\12\12\40\40\40\40\40\40\40\40\40\40\40\40\163\145\164"
+"\165\160\137\160\151\162\137\143\157\155\160\162\145\147\163\50\151\156\164\145\162\160\51\73\12\12\40\40\40\40\40\40"
+"\40\40\40\40\40\40\151\146\40\50\41\120\141\162\162\157\164\137\141\160\151\137\160\155\143\137\167\162\141\160\137\163"
+"\164\162\151\156\147\137\141\162\162\141\171\50\151\156\164\145\162\160\54\40\141\162\147\143\54\40\141\162\147\166\54\40"
+"\46\141\162\147\163\141\162\162\141\171\51\51\40\173\12\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\146"
+"\160\162\151\156\164\146\50\163\164\144\145\162\162\54\40\42\120\101\122\122\117\124\40\126\115\72\40\103\157\165\154\144"
+"\40\156\157\164\40\142\165\151\154\144\40\141\162\147\163\40\141\162\162\141\171\42\51\73\12\40\40\40\40\40\40\40"
+"\40\40\40\40\40\40\40\40\40\163\150\157\167\137\154\141\163\164\137\145\162\162\157\162\137\141\156\144\137\145\170\151"
+"\164\50\151\156\164\145\162\160\51\73\12\40\40\40\40\40\40\40\40\40\40\40\40\175\12\12\40\40\40\40\40\40"
+"\40\40\40\40\40\40\151\146\40\50\41\120\141\162\162\157\164\137\141\160\151\137\154\157\141\144\137\142\171\164\145\143"
+"\157\144\145\137\142\171\164\145\163\50\151\156\164\145\162\160\54\12\40\40\40\40\40\40\40\40\40\40\40\40\40\40"
+"\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40"
+"\40\40\160\162\157\147\162\141\155\137\143\157\144\145\137\141\144\144\162\54\12\40\40\40\40\40\40\40\40\40\40\40"
+"\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40"
+"\40\40\40\40\40\50\120\141\162\162\157\164\137\111\156\164\51\40\142\171\164\145\143\157\144\145\137\163\151\172\145\54"
+"\12\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40"
+"\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\46\160\142\143\51\51\40\173\12\40\40\40\40\40\40"
+"\40\40\40\40\40\40\40\40\40\40\146\160\162\151\156\164\146\50\163\164\144\145\162\162\54\40\42\120\101\122\122\117"
+"\124\40\126\115\72\40\103\157\165\154\144\40\156\157\164\40\154\157\141\144\40\142\171\164\145\143\157\144\145\134\156\42"
+"\51\73\12\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\163\150\157\167\137\154\141\163\164\137\145\162\162"
+"\157\162\137\141\156\144\137\145\170\151\164\50\151\156\164\145\162\160\51\73\12\40\40\40\40\40\40\40\40\40\40\40"
+"\40\175\12\12\40\40\40\40\40\40\40\40\40\40\40\40\151\146\40\50\41\120\141\162\162\157\164\137\141\160\151\137"
+"\162\165\156\137\142\171\164\145\143\157\144\145\50\151\156\164\145\162\160\54\40\160\142\143\54\40\141\162\147\163\141\162"
+"\162\141\171\51\51\40\173\12\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\163\150\157\167\137\154\141\163"
+"\164\137\145\162\162\157\162\137\141\156\144\137\145\170\151\164\50\151\156\164\145\162\160\51\73\12\40\40\40\40\40\40"
+"\40\40\40\40\40\40\175\12\12\40\40\40\40\40\40\40\40\40\40\40\40\151\146\40\50\41\120\141\162\162\157\164"
+"\137\141\160\151\137\144\145\163\164\162\157\171\137\151\156\164\145\162\160\162\145\164\145\162\50\151\156\164\145\162\160\51"
+"\51\40\173\12\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\146\160\162\151\156\164\146\50\163\164\144\145"
+"\162\162\54\40\42\120\101\122\122\117\124\40\126\115\72\40\103\157\165\154\144\40\156\157\164\40\144\145\163\164\162\157"
+"\171\40\151\156\164\145\162\160\162\145\164\145\162\134\156\42\51\73\12\40\40\40\40\40\40\40\40\40\40\40\40\40"
+"\40\40\40\163\150\157\167\137\154\141\163\164\137\145\162\162\157\162\137\141\156\144\137\145\170\151\164\50\151\156\164\145"
+"\162\160\51\73\12\40\40\40\40\40\40\40\40\40\40\40\40\175\12\12\40\40\40\40\40\40\40\40\40\40\40\40"
+"\145\170\151\164\50\105\130\111\124\137\123\125\103\103\105\123\123\51\73\12\40\40\40\40\40\40\40\40\175\12\12\40"
+"\40\40\40\40\40\40\40\163\164\141\164\151\143\40\166\157\151\144\12\40\40\40\40\40\40\40\40\163\150\157\167\137"
+"\154\141\163\164\137\145\162\162\157\162\137\141\156\144\137\145\170\151\164\50\120\141\162\162\157\164\137\120\115\103\40\151"
+"\156\164\145\162\160\51\12\40\40\40\40\40\40\40\40\173\12\40\40\40\40\40\40\40\40\40\40\40\40\120\141\162"
+"\162\157\164\137\123\164\162\151\156\147\40\145\162\162\155\163\147\54\40\142\141\143\153\164\162\141\143\145\73\12\40\40"
+"\40\40\40\40\40\40\40\40\40\40\120\141\162\162\157\164\137\111\156\164\40\145\170\151\164\137\143\157\144\145\54\40"
+"\151\163\137\145\162\162\157\162\73\12\40\40\40\40\40\40\40\40\40\40\40\40\120\141\162\162\157\164\137\120\115\103"
+"\40\145\170\143\145\160\164\151\157\156\73\12\12\40\40\40\40\40\40\40\40\40\40\40\40\151\146\40\50\41\120\141"
+"\162\162\157\164\137\141\160\151\137\147\145\164\137\162\145\163\165\154\164\50\151\156\164\145\162\160\54\40\46\151\163\137"
+"\145\162\162\157\162\54\40\46\145\170\143\145\160\164\151\157\156\54\40\46\145\170\151\164\137\143\157\144\145\54\40\46"
+"\145\162\162\155\163\147\51\51\12\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\145\170\151\164\50\105\130"
+"\111\124\137\106\101\111\114\125\122\105\51\73\12\12\40\40\40\40\40\40\40\40\40\40\40\40\151\146\40\50\151\163"
+"\137\145\162\162\157\162\51\40\173\12\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\151\146\40\50\41\120"
+"\141\162\162\157\164\137\141\160\151\137\147\145\164\137\145\170\143\145\160\164\151\157\156\137\142\141\143\153\164\162\141\143"
+"\145\50\151\156\164\145\162\160\54\40\145\170\143\145\160\164\151\157\156\54\40\46\142\141\143\153\164\162\141\143\145\51"
+"\51\12\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\145\170\151\164\50\105\130\111\124\137"
+"\106\101\111\114\125\122\105\51\73\12\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\160\162\151\156\164\137"
+"\160\141\162\162\157\164\137\163\164\162\151\156\147\50\151\156\164\145\162\160\54\40\163\164\144\145\162\162\54\40\145\162"
+"\162\155\163\147\54\40\61\51\73\12\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\160\162\151\156\164\137"
+"\160\141\162\162\157\164\137\163\164\162\151\156\147\50\151\156\164\145\162\160\54\40\163\164\144\145\162\162\54\40\142\141"
+"\143\153\164\162\141\143\145\54\40\60\51\73\12\40\40\40\40\40\40\40\40\40\40\40\40\175\12\12\40\40\40\40"
+"\40\40\40\40\40\40\40\40\145\170\151\164\50\145\170\151\164\137\143\157\144\145\51\73\12\40\40\40\40\40\40\40"
+"\40\175\12\12\40\40\40\40\40\40\40\40\163\164\141\164\151\143\40\166\157\151\144\12\40\40\40\40\40\40\40\40"
+"\160\162\151\156\164\137\160\141\162\162\157\164\137\163\164\162\151\156\147\50\120\141\162\162\157\164\137\120\115\103\40\151"
+"\156\164\145\162\160\54\40\106\111\114\105\40\52\166\145\143\164\157\162\54\40\120\141\162\162\157\164\137\123\164\162\151"
+"\156\147\40\163\164\162\54\40\151\156\164\40\156\145\167\154\151\156\145\51\12\40\40\40\40\40\40\40\40\173\12\40"
+"\40\40\40\40\40\40\40\40\40\40\40\143\150\141\162\40\52\155\163\147\137\162\141\167\73\12\12\40\40\40\40\40"
+"\40\40\40\40\40\40\40\151\146\40\50\41\163\164\162\51\12\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40"
+"\40\162\145\164\165\162\156\73\12\12\40\40\40\40\40\40\40\40\40\40\40\40\151\146\40\50\41\120\141\162\162\157"
+"\164\137\141\160\151\137\163\164\162\151\156\147\137\145\170\160\157\162\164\137\141\163\143\151\151\50\151\156\164\145\162\160"
+"\54\40\163\164\162\54\40\46\155\163\147\137\162\141\167\51\51\12\40\40\40\40\40\40\40\40\40\40\40\40\40\40"
+"\40\40\163\150\157\167\137\154\141\163\164\137\145\162\162\157\162\137\141\156\144\137\145\170\151\164\50\151\156\164\145\162"
+"\160\51\73\12\12\40\40\40\40\40\40\40\40\40\40\40\40\151\146\40\50\155\163\147\137\162\141\167\51\40\173\12"
+"\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\146\160\162\151\156\164\146\50\166\145\143\164\157\162\54\40"
+"\42\45\163\45\163\42\54\40\155\163\147\137\162\141\167\54\40\156\145\167\154\151\156\145\40\77\40\42\134\156\42\40"
+"\72\40\42\42\51\73\12\12\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\151\146\40\50\41\120\141\162"
+"\162\157\164\137\141\160\151\137\163\164\162\151\156\147\137\146\162\145\145\137\145\170\160\157\162\164\145\144\137\141\163\143"
+"\151\151\50\151\156\164\145\162\160\54\40\155\163\147\137\162\141\167\51\51\12\40\40\40\40\40\40\40\40\40\40\40"
+"\40\40\40\40\40\40\40\40\40\163\150\157\167\137\154\141\163\164\137\145\162\162\157\162\137\141\156\144\137\145\170\151"
+"\164\50\151\156\164\145\162\160\51\73\12\40\40\40\40\40\40\40\40\40\40\40\40\175\12\40\40\40\40\40\40\40"
+"\40\175\12\12\40\40\40\40\40\40\40\40\163\164\141\164\151\143\40\166\157\151\144\12\40\40\40\40\40\40\40\40"
+"\163\145\164\165\160\137\160\151\162\137\143\157\155\160\162\145\147\163\50\120\141\162\162\157\164\137\120\115\103\40\151\156"
+"\164\145\162\160\51\12\40\40\40\40\40\40\40\40\173\12\40\40\40\40\40\40\40\40\40\40\40\40\120\141\162\162"
+"\157\164\137\120\115\103\40\143\154\141\163\163\137\160\155\143\40\75\40\147\145\164\137\143\154\141\163\163\137\160\155\143"
+"\50\151\156\164\145\162\160\54\40\42\111\115\103\103\157\155\160\151\154\145\162\42\51\73\12\40\40\40\40\40\40\40"
+"\40\40\40\40\40\147\145\164\137\151\155\143\143\137\143\157\155\160\151\154\145\162\137\160\155\143\50\151\156\164\145\162"
+"\160\54\40\143\154\141\163\163\137\160\155\143\54\40\60\51\73\12\40\40\40\40\40\40\40\40\40\40\40\40\147\145"
+"\164\137\151\155\143\143\137\143\157\155\160\151\154\145\162\137\160\155\143\50\151\156\164\145\162\160\54\40\143\154\141\163"
+"\163\137\160\155\143\54\40\61\51\73\12\40\40\40\40\40\40\40\40\175\12\12\40\40\40\40\40\40\40\40\120\101"
+"\122\122\117\124\137\103\101\116\116\117\124\137\122\105\124\125\122\116\137\116\125\114\114\12\40\40\40\40\40\40\40\40"
+"\163\164\141\164\151\143\40\120\115\103\40\52\12\40\40\40\40\40\40\40\40\147\145\164\137\143\154\141\163\163\137\160"
+"\155\143\50\120\141\162\162\157\164\137\120\115\103\40\151\156\164\145\162\160\54\40\101\122\107\111\116\50\143\157\156\163"
+"\164\40\143\150\141\162\40\52\156\141\155\145\51\51\12\40\40\40\40\40\40\40\40\173\12\40\40\40\40\40\40\40"
+"\40\40\40\40\40\120\141\162\162\157\164\137\123\164\162\151\156\147\40\156\141\155\145\137\163\40\75\40\116\125\114\114"
+"\73\12\40\40\40\40\40\40\40\40\40\40\40\40\120\141\162\162\157\164\137\120\115\103\40\156\141\155\145\137\160\155"
+"\143\40\75\40\116\125\114\114\73\12\40\40\40\40\40\40\40\40\40\40\40\40\120\141\162\162\157\164\137\120\115\103"
+"\40\143\154\141\163\163\137\160\155\143\40\75\40\116\125\114\114\73\12\40\40\40\40\40\40\40\40\40\40\40\40\151"
+"\146\40\50\41\50\120\141\162\162\157\164\137\141\160\151\137\163\164\162\151\156\147\137\151\155\160\157\162\164\137\141\163"
+"\143\151\151\50\151\156\164\145\162\160\54\40\156\141\155\145\54\40\46\156\141\155\145\137\163\51\40\46\46\12\40\40"
+"\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\120\141\162\162\157\164\137\141\160\151\137\160\155\143\137\142"
+"\157\170\137\163\164\162\151\156\147\50\151\156\164\145\162\160\54\40\156\141\155\145\137\163\54\40\46\156\141\155\145\137"
+"\160\155\143\51\40\46\46\12\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\120\141\162\162\157\164"
+"\137\141\160\151\137\160\155\143\137\147\145\164\137\143\154\141\163\163\50\151\156\164\145\162\160\54\40\156\141\155\145\137"
+"\160\155\143\54\40\46\143\154\141\163\163\137\160\155\143\51\51\51\12\40\40\40\40\40\40\40\40\40\40\40\40\40"
+"\40\40\40\163\150\157\167\137\154\141\163\164\137\145\162\162\157\162\137\141\156\144\137\145\170\151\164\50\151\156\164\145"
+"\162\160\51\73\12\40\40\40\40\40\40\40\40\40\40\40\40\162\145\164\165\162\156\40\143\154\141\163\163\137\160\155"
+"\143\73\12\40\40\40\40\40\40\40\40\175\12\12\40\40\40\40\40\40\40\40\120\101\122\122\117\124\137\103\101\116"
+"\116\117\124\137\122\105\124\125\122\116\137\116\125\114\114\12\40\40\40\40\40\40\40\40\163\164\141\164\151\143\40\166"
+"\157\151\144\12\40\40\40\40\40\40\40\40\147\145\164\137\151\155\143\143\137\143\157\155\160\151\154\145\162\137\160\155"
+"\143\50\120\141\162\162\157\164\137\120\115\103\40\151\156\164\145\162\160\54\40\120\141\162\162\157\164\137\120\115\103\40"
+"\143\154\141\163\163\137\160\155\143\54\40\120\141\162\162\157\164\137\111\156\164\40\151\163\137\160\141\163\155\51\12\40"
+"\40\40\40\40\40\40\40\173\12\40\40\40\40\40\40\40\40\40\40\40\40\120\141\162\162\157\164\137\120\115\103\40"
+"\151\163\137\160\141\163\155\137\160\155\143\40\75\40\116\125\114\114\73\12\40\40\40\40\40\40\40\40\40\40\40\40"
+"\120\141\162\162\157\164\137\120\115\103\40\143\157\155\160\151\154\145\162\137\160\155\143\40\75\40\116\125\114\114\73\12"
+"\40\40\40\40\40\40\40\40\40\40\40\40\143\157\156\163\164\40\143\150\141\162\40\52\40\143\157\156\163\164\40\156"
+"\141\155\145\40\75\40\151\163\137\160\141\163\155\40\77\40\42\120\101\123\115\42\40\72\40\42\120\111\122\42\73\12"
+"\40\40\40\40\40\40\40\40\40\40\40\40\120\141\162\162\157\164\137\123\164\162\151\156\147\40\156\141\155\145\137\163"
+"\40\75\40\116\125\114\114\73\12\12\40\40\40\40\40\40\40\40\40\40\40\40\151\146\40\50\41\120\141\162\162\157"
+"\164\137\141\160\151\137\160\155\143\137\142\157\170\137\151\156\164\145\147\145\162\50\151\156\164\145\162\160\54\40\151\163"
+"\137\160\141\163\155\54\40\46\151\163\137\160\141\163\155\137\160\155\143\51\51\12\40\40\40\40\40\40\40\40\40\40"
+"\40\40\40\40\40\40\163\150\157\167\137\154\141\163\164\137\145\162\162\157\162\137\141\156\144\137\145\170\151\164\50\151"
+"\156\164\145\162\160\51\73\12\40\40\40\40\40\40\40\40\40\40\40\40\151\146\40\50\41\120\141\162\162\157\164\137"
+"\141\160\151\137\160\155\143\137\156\145\167\137\146\162\157\155\137\143\154\141\163\163\50\151\156\164\145\162\160\54\40\143"
+"\154\141\163\163\137\160\155\143\54\40\151\163\137\160\141\163\155\137\160\155\143\54\40\46\143\157\155\160\151\154\145\162"
+"\137\160\155\143\51\51\12\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\163\150\157\167\137\154\141\163\164"
+"\137\145\162\162\157\162\137\141\156\144\137\145\170\151\164\50\151\156\164\145\162\160\51\73\12\40\40\40\40\40\40\40"
+"\40\40\40\40\40\151\146\40\50\41\50\120\141\162\162\157\164\137\141\160\151\137\163\164\162\151\156\147\137\151\155\160"
+"\157\162\164\137\141\163\143\151\151\50\151\156\164\145\162\160\54\40\156\141\155\145\54\40\46\156\141\155\145\137\163\51"
+"\40\46\46\12\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\120\141\162\162\157\164\137\141\160\151"
+"\137\163\145\164\137\143\157\155\160\151\154\145\162\50\151\156\164\145\162\160\54\40\156\141\155\145\137\163\54\40\143\157"
+"\155\160\151\154\145\162\137\160\155\143\51\51\51\12\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\163\150"
+"\157\167\137\154\141\163\164\137\145\162\162\157\162\137\141\156\144\137\145\170\151\164\50\151\156\164\145\162\160\51\73\12"
+"\40\40\40\40\40\40\40\40\175\12\12\0\0\0\0\0\1\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0"
+"\160\162\151\156\164\0\0\0\1\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\155\145\163\163\141\147\145\0"
+"\1\0\0\0\0\0\0\0\321\2\0\0\0\0\0\0\43\151\156\143\154\165\144\145\40\74\163\164\144\151\157\56"
+"\150\76\12\43\151\156\143\154\165\144\145\40\74\163\164\144\154\151\142\56\150\76\12\43\151\156\143\154\165\144\145\40"
+"\74\163\164\162\151\156\147\56\150\76\12\43\151\146\156\144\145\146\40\137\127\111\116\63\62\12\43\40\40\151\156\143"
+"\154\165\144\145\40\74\165\156\151\163\164\144\56\150\76\40\57\52\40\146\157\162\40\162\145\141\144\154\151\156\153\50"
+"\51\40\52\57\12\43\145\156\144\151\146\12\43\151\146\144\145\146\40\137\137\101\120\120\114\105\137\137\12\43\40\40"
+"\151\156\143\154\165\144\145\40\74\155\141\143\150\55\157\57\144\171\154\144\56\150\76\40\57\52\40\146\157\162\40\137"
+"\116\123\107\145\164\105\170\145\143\165\164\141\142\154\145\120\141\164\150\50\51\40\52\57\12\43\145\156\144\151\146\12"
+"\43\151\146\144\145\146\40\137\137\106\162\145\145\102\123\104\137\137\12\43\40\40\151\156\143\154\165\144\145\40\74\163"
+"\171\163\57\163\171\163\143\164\154\56\150\76\12\43\145\156\144\151\146\12\43\151\156\143\154\165\144\145\40\42\160\141"
+"\162\162\157\164\57\141\160\151\56\150\42\12\12\151\156\164\40\120\141\162\162\157\164\137\163\145\164\137\143\157\156\146"
+"\151\147\137\150\141\163\150\50\120\141\162\162\157\164\137\120\115\103\40\151\156\164\145\162\160\137\160\155\143\51\73\12"
+"\163\164\141\164\151\143\40\166\157\151\144\40\163\150\157\167\137\154\141\163\164\137\145\162\162\157\162\137\141\156\144\137"
+"\145\170\151\164\50\120\141\162\162\157\164\137\120\115\103\40\151\156\164\145\162\160\51\73\12\163\164\141\164\151\143\40"
+"\166\157\151\144\40\160\162\151\156\164\137\160\141\162\162\157\164\137\163\164\162\151\156\147\50\120\141\162\162\157\164\137"
+"\120\115\103\40\151\156\164\145\162\160\54\40\106\111\114\105\40\52\166\145\143\164\157\162\54\40\120\141\162\162\157\164"
+"\137\123\164\162\151\156\147\40\163\164\162\54\40\151\156\164\40\156\145\167\154\151\156\145\51\73\12\163\164\141\164\151"
+"\143\40\166\157\151\144\40\163\145\164\165\160\137\160\151\162\137\143\157\155\160\162\145\147\163\50\120\141\162\162\157\164"
+"\137\120\115\103\40\151\156\164\145\162\160\51\73\12\163\164\141\164\151\143\40\120\115\103\40\52\40\147\145\164\137\143"
+"\154\141\163\163\137\160\155\143\50\120\141\162\162\157\164\137\120\115\103\40\151\156\164\145\162\160\54\40\143\157\156\163"
+"\164\40\143\150\141\162\40\52\156\141\155\145\51\73\12\163\164\141\164\151\143\40\166\157\151\144\40\147\145\164\137\151"
+"\155\143\143\137\143\157\155\160\151\154\145\162\137\160\155\143\50\120\141\162\162\157\164\137\120\115\103\40\151\156\164\145"
+"\162\160\54\40\120\141\162\162\157\164\137\120\115\103\40\143\154\141\163\163\137\160\155\143\54\40\120\141\162\162\157\164"
+"\137\111\156\164\40\151\163\137\160\141\163\155\51\73\12\12\43\144\145\146\151\156\145\40\124\122\101\103\105\40\60\12"
+"\12\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\22\0\0\0\0\0\0\0\143\141\156\156\157\164\40\162"
+"\145\141\144\40\151\156\146\151\154\145\0\0\0\0\0\0\1\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0"
+"\143\141\156\156\157\164\40\167\162\151\164\145\40\157\165\164\146\151\154\145\0\0\0\0\1\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\157\160\145\156\0\0\0\0\1\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0"
+"\143\154\157\163\145\0\0\0\1\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\122\125\116\103\117\122\105\0"
+"\1\0\0\0\0\0\0\0\24\0\0\0\0\0\0\0\143\141\156\156\157\164\40\143\154\157\163\145\40\157\165\164"
+"\146\151\154\145\0\0\0\0\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\155\141\151\156\0\0\0\0"
+"\377\377\377\377\377\377\377\377\1\0\0\0\0\0\0\0\20\0\0\0\0\0\0\0\43\144\145\146\151\156\145\40"
+"\45\163\40\42\45\163\42\12\1\0\0\0\0\0\0\0\20\0\0\0\0\0\0\0\43\144\145\146\151\156\145\40"
+"\45\163\40\116\125\114\114\12\1\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\127\123\165\142\111\144\137\66"
+"\1\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\160\162\151\156\164\137\144\145\146\151\156\145\0\0\0\0"
+"\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\146\141\163\164\0\0\0\0\1\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\147\143\0\0\0\0\0\0\1\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0"
+"\151\156\163\164\141\154\154\174\151\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\147\143\72\163\0\0\0\0\1\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\150\145\154\160\174\150\0\0"
+"\1\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0\162\165\156\143\157\162\145\174\122\72\163\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\26\0\0\0\0\0\0\0\125\156\163\165\160\160\157\162\164\145\144\40\162\165\156\143"
+"\157\162\145\72\40\47\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\157\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\107\145\164\157\160\164\0\0\1\0\0\0\0\0\0\0"
+"\7\0\0\0\0\0\0\0\151\156\163\164\141\154\154\0\1\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\117\142\152\0\0\0\0\0\1\0\0\0\0\0\0\0\50\0\0\0\0\0\0\0\157\165\164\160\165\164\40\145"
+"\170\145\143\165\164\141\142\154\145\40\156\141\155\145\40\144\157\145\163\40\156\157\164\40\145\156\144\40\151\156\40\47"
+"\1\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0\147\145\164\137\157\160\164\151\157\156\163\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\56\160\142\143\0\0\0\0\1\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\56\143\0\0\0\0\0\0\1\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0"
+"\166\145\162\142\157\163\145\0\1\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\163\150\151\146\164\0\0\0"
+"\1\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\166\145\162\142\157\163\145\174\166\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\157\165\164\160\165\164\174\157\72\163\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\47\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\7\0\0\0\0\0\0\0\162\165\156\143\157\162\145\0\1\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0"
+"\127\123\165\142\111\144\137\61\1\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0\151\156\160\165\164\40\160\142"
+"\143\40\146\151\154\145\40\156\141\155\145\40\144\157\145\163\40\156\157\164\40\145\156\144\40\151\156\40\47\56\160\142"
+"\143\47\0\0\0\0\0\0\1\0\0\0\0\0\0\0\233\0\0\0\0\0\0\0\160\142\143\137\164\157\137\145"
+"\170\145\40\133\157\160\164\151\157\156\163\135\40\74\146\151\154\145\76\12\40\40\117\160\164\151\157\156\163\72\12\40"
+"\40\40\40\55\150\40\55\55\150\145\154\160\12\40\40\40\40\55\151\40\55\55\151\156\163\164\141\154\154\12\40\40"
+"\40\40\55\166\40\55\55\166\145\162\142\157\163\145\12\40\40\40\40\55\122\40\55\55\162\165\156\143\157\162\145\75"
+"\163\154\157\167\174\146\141\163\164\12\40\40\40\40\55\157\40\55\55\157\165\164\160\165\164\75\106\111\114\105\12\40"
+"\40\40\40\40\40\40\55\55\147\143\75\155\163\62\174\147\155\163\12\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\145\170\145\0\0\0\0\0\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\163\154\157\167\0\0\0\0\1\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\157\165\164\160\165\164\0\0"
+"\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\150\145\154\160\0\0\0\0\1\0\0\0\0\0\0\0"
+"\13\0\0\0\0\0\0\0\150\141\156\144\154\145\137\141\162\147\163\0\0\0\0\0\377\377\377\377\377\377\377\377"
+"\1\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\143\143\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\7\0\0\0\0\0\0\0\144\145\146\141\165\154\164\0\1\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0"
+"\157\163\156\141\155\145\0\0\1\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\127\123\165\142\111\144\137\62"
+"\1\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\147\143\143\166\145\162\163\151\157\156\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\143\154\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\7\0\0\0\0\0\0\0\115\123\127\151\156\63\62\0\1\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0"
+"\144\145\164\145\162\155\151\156\145\137\143\157\144\145\137\164\171\160\145\0\0\0\0\0\377\377\377\377\377\377\377\377"
+"\1\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\127\123\165\142\111\144\137\61\62\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\163\160\141\167\156\167\137\143\155\144\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\162\145\141\144\0\0\0\0\1\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\54\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\152\0\0\0\0\0\0\0"
+"\40\40\40\40\40\40\40\40\143\157\156\163\164\40\165\156\163\151\147\156\145\144\40\143\150\141\162\40\52\40\147\145"
+"\164\137\160\162\157\147\162\141\155\137\143\157\144\145\50\166\157\151\144\51\12\40\40\40\40\40\40\40\40\173\12\40"
+"\40\40\40\40\40\40\40\40\40\40\40\162\145\164\165\162\156\40\160\162\157\147\162\141\155\137\143\157\144\145\73\12"
+"\40\40\40\40\40\40\40\40\175\12\0\0\0\0\0\0\1\0\0\0\0\0\0\0\42\0\0\0\0\0\0\0"
+"\12\175\73\12\12\143\157\156\163\164\40\163\151\172\145\137\164\40\142\171\164\145\143\157\144\145\137\163\151\172\145\40"
+"\75\40\0\0\0\0\0\0\1\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\73\12\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\22\0\0\0\0\0\0\0\143\141\156\156\157\164\40\157\160\145\156\40\151\156\146\151"
+"\154\145\0\0\0\0\0\0\1\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\162\142\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\127\123\165\142\111\144\137\65\1\0\0\0\0\0\0\0"
+"\45\0\0\0\0\0\0\0\143\157\156\163\164\40\120\141\162\162\157\164\137\125\111\156\164\61\40\160\162\157\147\162"
+"\141\155\137\143\157\144\145\133\135\40\75\40\173\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\12\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0\147\145\156\145\162\141\164\145"
+"\137\143\157\144\145\0\0\0\1\0\0\0\0\0\0\0\20\0\0\0\0\0\0\0\106\151\170\145\144\123\164\162"
+"\151\156\147\101\162\162\141\171\1\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\127\123\165\142\111\144\137\61"
+"\61\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\134\45\157\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0\106\151\170\145\144\111\156\164\145\147\145\162\101\162\162\141"
+"\171\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\27\0\0\0\0\0\0\0\147\145\156\145\162\141\164\145"
+"\137\145\156\143\157\144\151\156\147\137\164\141\142\154\145\0\1\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\42\12\42\0\0\0\0\0\1\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\127\123\165\142\111\144\137\63"
+"\1\0\0\0\0\0\0\0\46\0\0\0\0\0\0\0\143\157\156\163\164\40\165\156\163\151\147\156\145\144\40\143"
+"\150\141\162\40\160\162\157\147\162\141\155\137\143\157\144\145\133\135\40\75\12\42\0\0\1\0\0\0\0\0\0\0"
+"\42\0\0\0\0\0\0\0\42\12\73\12\12\143\157\156\163\164\40\163\151\172\145\137\164\40\142\171\164\145\143\157"
+"\144\145\137\163\151\172\145\40\75\40\0\0\0\0\0\0\1\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0"
+"\147\145\156\145\162\141\164\145\137\143\157\144\145\137\147\143\143\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\56\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0"
+"\127\123\165\142\111\144\137\67\1\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\162\145\160\154\141\143\145\137"
+"\160\142\143\137\145\170\164\145\156\163\151\157\156\0\0\0\1\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\162\143\40\0\0\0\0\0\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\163\164\141\164\0\0\0\0"
+"\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\56\162\145\163\0\0\0\0\1\0\0\0\0\0\0\0"
+"\116\0\0\0\0\0\0\0\43\144\145\146\151\156\145\40\122\105\123\117\125\122\103\105\137\116\101\115\105\137\111\104"
+"\137\127\110\117\114\105\137\120\102\103\40\63\63\63\12\43\144\145\146\151\156\145\40\122\105\123\117\125\122\103\105\137"
+"\124\131\120\105\137\111\104\137\127\110\117\114\105\137\120\102\103\40\64\64\64\12\0\0\1\0\0\0\0\0\0\0"
+"\24\0\0\0\0\0\0\0\143\141\156\156\157\164\40\157\160\145\156\40\56\162\143\40\146\151\154\145\0\0\0\0"
+"\1\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\56\162\143\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\117\123\0\0\0\0\0\0\1\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0"
+"\122\103\40\143\157\155\155\141\156\144\40\146\141\151\154\145\144\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\25\0\0\0\0\0\0\0\43\151\156\143\154\165\144\145\40\74\167\151\156\144\157\167\163\56\150\76\12\0\0\0"
+"\1\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\143\141\156\156\157\164\40\143\154\157\163\145\40\56\162\143"
+"\40\146\151\154\145\0\0\0\1\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\127\123\165\142\111\144\137\64"
+"\1\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\42\12\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\174\3\0\0\0\0\0\0\40\40\40\40\40\40\40\40\143\157\156\163\164\40\165\156\163\151\147\156\145\144\40\143"
+"\150\141\162\40\52\40\147\145\164\137\160\162\157\147\162\141\155\137\143\157\144\145\50\166\157\151\144\51\12\40\40\40"
+"\40\40\40\40\40\173\12\40\40\40\40\40\40\40\40\40\40\40\40\110\122\123\122\103\40\40\40\150\122\145\163\157"
+"\165\162\143\145\73\12\40\40\40\40\40\40\40\40\40\40\40\40\104\127\117\122\104\40\40\40\163\151\172\145\73\12"
+"\40\40\40\40\40\40\40\40\40\40\40\40\110\107\114\117\102\101\114\40\150\120\102\103\73\12\40\40\40\40\40\40"
+"\40\40\40\40\40\40\114\120\126\117\111\104\40\40\141\143\164\165\141\154\137\160\157\151\156\164\145\162\137\164\157\137"
+"\160\142\143\137\151\156\137\155\145\155\157\162\171\73\12\12\40\40\40\40\40\40\40\40\40\40\40\40\150\122\145\163"
+"\157\165\162\143\145\40\75\40\106\151\156\144\122\145\163\157\165\162\143\145\50\12\40\40\40\40\40\40\40\40\40\40"
+"\40\40\40\40\40\40\116\125\114\114\54\12\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\115\101\113\105"
+"\111\116\124\122\105\123\117\125\122\103\105\50\122\105\123\117\125\122\103\105\137\116\101\115\105\137\111\104\137\127\110\117"
+"\114\105\137\120\102\103\51\54\12\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\115\101\113\105\111\116\124"
+"\122\105\123\117\125\122\103\105\50\122\105\123\117\125\122\103\105\137\124\131\120\105\137\111\104\137\127\110\117\114\105\137"
+"\120\102\103\51\12\40\40\40\40\40\40\40\40\40\40\40\40\51\73\12\40\40\40\40\40\40\40\40\40\40\40\40"
+"\151\146\40\50\41\150\122\145\163\157\165\162\143\145\51\12\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40"
+"\162\145\164\165\162\156\40\116\125\114\114\73\12\12\40\40\40\40\40\40\40\40\40\40\40\40\163\151\172\145\40\75"
+"\40\123\151\172\145\157\146\122\145\163\157\165\162\143\145\50\40\116\125\114\114\54\40\150\122\145\163\157\165\162\143\145"
+"\40\51\73\12\40\40\40\40\40\40\40\40\40\40\40\40\151\146\40\50\163\151\172\145\40\41\75\40\142\171\164\145"
+"\143\157\144\145\137\163\151\172\145\51\12\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\162\145\164\165\162"
+"\156\40\116\125\114\114\73\12\12\40\40\40\40\40\40\40\40\40\40\40\40\150\120\102\103\40\75\40\114\157\141\144"
+"\122\145\163\157\165\162\143\145\50\40\116\125\114\114\54\40\150\122\145\163\157\165\162\143\145\40\51\73\12\40\40\40"
+"\40\40\40\40\40\40\40\40\40\151\146\40\50\41\150\120\102\103\51\12\40\40\40\40\40\40\40\40\40\40\40\40"
+"\40\40\40\40\162\145\164\165\162\156\40\116\125\114\114\73\12\12\40\40\40\40\40\40\40\40\40\40\40\40\141\143"
+"\164\165\141\154\137\160\157\151\156\164\145\162\137\164\157\137\160\142\143\137\151\156\137\155\145\155\157\162\171\40\75\40"
+"\114\157\143\153\122\145\163\157\165\162\143\145\50\40\150\120\102\103\40\51\73\12\40\40\40\40\40\40\40\40\40\40"
+"\40\40\151\146\40\50\41\141\143\164\165\141\154\137\160\157\151\156\164\145\162\137\164\157\137\160\142\143\137\151\156\137"
+"\155\145\155\157\162\171\51\12\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\40\162\145\164\165\162\156\40\116"
+"\125\114\114\73\12\12\40\40\40\40\40\40\40\40\40\40\40\40\162\145\164\165\162\156\40\141\143\164\165\141\154\137"
+"\160\157\151\156\164\145\162\137\164\157\137\160\142\143\137\151\156\137\155\145\155\157\162\171\73\12\40\40\40\40\40\40"
+"\40\40\175\12\0\0\0\0\1\0\0\0\0\0\0\0\43\0\0\0\0\0\0\0\143\157\156\163\164\40\165\156"
+"\163\151\147\156\145\144\40\151\156\164\40\142\171\164\145\143\157\144\145\137\163\151\172\145\40\75\40\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\67\0\0\0\0\0\0\0\122\105\123\117\125\122\103\105\137\116\101\115\105\137\111\104"
+"\137\127\110\117\114\105\137\120\102\103\40\122\105\123\117\125\122\103\105\137\124\131\120\105\137\111\104\137\127\110\117\114"
+"\105\137\120\102\103\40\42\0\1\0\0\0\0\0\0\0\22\0\0\0\0\0\0\0\147\145\156\145\162\141\164\145"
+"\137\143\157\144\145\137\155\163\166\143\0\0\0\0\0\0\1\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0"
+"\166\145\162\163\151\157\156\144\151\162\0\0\0\0\0\0\1\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0"
+"\157\160\164\151\155\151\172\145\1\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\143\143\146\154\141\147\163\0"
+"\1\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\103\157\155\160\151\154\145\144\72\40\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\42\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\40\55\143\40\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\61\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\22\0\0\0\0\0\0\0\143\157\155\160\151\154\141\164"
+"\151\157\156\40\146\141\151\154\145\144\0\0\0\0\0\0\1\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0"
+"\151\156\143\154\165\144\145\0\1\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\163\154\141\163\150\0\0\0"
+"\1\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\127\123\165\142\111\144\137\70\1\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\40\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0"
+"\142\165\151\154\144\137\144\151\162\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0"
+"\151\156\163\164\141\154\154\145\144\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0"
+"\151\156\143\154\165\144\145\144\151\162\0\0\0\0\0\0\1\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\40\55\111\0\0\0\0\0\1\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\143\143\137\157\137\157\165\164"
+"\1\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\143\157\155\160\151\154\145\137\146\151\154\145\0\0\0\0"
+"\1\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\114\151\156\153\145\144\72\40\1\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\73\61\0\0\0\0\0\0\1\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0"
+"\154\151\156\153\151\156\147\40\146\141\151\154\145\144\0\0\1\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0"
+"\154\151\142\160\141\162\162\157\164\137\154\151\156\153\146\154\141\147\163\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\154\151\142\163\0\0\0\0\1\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0"
+"\154\151\156\153\137\144\171\156\141\155\151\143\0\0\0\0\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\154\151\156\153\0\0\0\0\1\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\151\143\165\137\163\150\141\162"
+"\145\144\0\0\0\0\0\0\1\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\56\155\141\156\151\146\145\163"
+"\164\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\154\151\142\144\151\162\0\0"
+"\1\0\0\0\0\0\0\0\31\0\0\0\0\0\0\0\155\141\156\151\146\145\163\164\40\145\155\142\145\144\144\151"
+"\156\147\40\146\141\151\154\145\144\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0"
+"\145\170\151\163\164\163\0\0\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\106\151\154\145\0\0\0\0"
+"\1\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\162\160\141\164\150\137\154\151\142\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\146\151\154\145\0\0\0\0\1\0\0\0\0\0\0\0"
+"\21\0\0\0\0\0\0\0\40\55\157\165\164\160\165\164\162\145\163\157\165\162\143\145\72\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\154\151\156\153\146\154\141\147\163\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\127\123\165\142\111\144\137\71\1\0\0\0\0\0\0\0"
+"\15\0\0\0\0\0\0\0\160\141\162\162\157\164\137\143\157\156\146\151\147\0\0\0\1\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\163\162\143\0\0\0\0\0\1\0\0\0\0\0\0\0\31\0\0\0\0\0\0\0"
+"\155\164\56\145\170\145\40\55\156\157\154\157\147\157\40\55\155\141\156\151\146\145\163\164\40\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\30\0\0\0\0\0\0\0\151\156\163\164\137\154\151\142\160\141\162\162\157\164\137\154"
+"\151\156\153\146\154\141\147\163\1\0\0\0\0\0\0\0\12\0\0\0\0\0\0\0\162\160\141\164\150\137\142\154"
+"\151\142\0\0\0\0\0\0\1\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\154\144\137\157\165\164\0\0"
+"\1\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\151\156\163\164\141\154\154\137\143\157\156\146\151\147\0\0"
+"\1\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\154\151\156\153\137\146\151\154\145\0\0\0\0\0\0\0"
+"\377\377\377\377\377\377\377\377\1\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\151\156\163\164\141\154\154\141"
+"\142\154\145\137\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\57\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\11\0\0\0\0\0\0\0\127\123\165\142\111\144\137\61\60\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\23\0\0\0\0\0\0\0\160\162\145\160\145\156\144\137\151\156\163\164\141\154\154\141"
+"\142\154\145\0\0\0\0\0\1\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\137\143\157\156\146\151\147\0"
+"\40\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\250\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\50\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\233\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\0\4\0\0\0\0\0\0"
+"\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\70\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\70\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\130\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\50\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\70\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\100\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\100\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\13\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\100\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\15\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\250\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0"
+"\7\0\0\0\0\0\0\0\365\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\30\0\0\0\0\0\0\0"
+"\233\0\0\0\0\0\0\0\30\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\377\377\377\377\377\377\377\377\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0"
+"\15\0\0\0\0\0\0\0\30\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\20\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\25\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\42\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\250\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\365\0\0\0\0\0\0\0"
+"\26\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\35\0\0\0\0\0\0\0\233\0\0\0\0\0\0\0"
+"\35\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377"
+"\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\34\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\50\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\25\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\100\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\46\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\50\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\250\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\26\1\0\0\0\0\0\0"
+"\127\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0\72\0\0\0\0\0\0\0\233\0\0\0\0\0\0\0"
+"\72\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377"
+"\5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0"
+"\63\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\45\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\66\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\71\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\55\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\47\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\62\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\70\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\37\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\50\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\25\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\250\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\127\2\0\0\0\0\0\0"
+"\205\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0\103\0\0\0\0\0\0\0\233\0\0\0\0\0\0\0"
+"\103\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377"
+"\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\77\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\100\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\74\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\76\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\50\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\250\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0"
+"\205\2\0\0\0\0\0\0\221\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0\106\0\0\0\0\0\0\0"
+"\233\0\0\0\0\0\0\0\106\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\377\377\377\377\377\377\377\377\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\105\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+"\20\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\25\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\250\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0"
+"\221\2\0\0\0\0\0\0\72\3\0\0\0\0\0\0\0\0\0\0\0\0\0\0\121\0\0\0\0\0\0\0"
+"\233\0\0\0\0\0\0\0\121\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\377\377\377\377\377\377\377\377\4\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\116\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\122\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\125\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\250\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0"
+"\72\3\0\0\0\0\0\0\134\3\0\0\0\0\0\0\0\0\0\0\0\0\0\0\126\0\0\0\0\0\0\0"
+"\233\0\0\0\0\0\0\0\126\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\377\377\377\377\377\377\377\377\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\123\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\250\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\134\3\0\0\0\0\0\0\7\4\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\133\0\0\0\0\0\0\0\233\0\0\0\0\0\0\0\133\0\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\4\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\130\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\25\0\0\0\0\0\0\0"
+"\2\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\250\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\7\4\0\0\0\0\0\0"
+"\102\4\0\0\0\0\0\0\0\0\0\0\0\0\0\0\136\0\0\0\0\0\0\0\233\0\0\0\0\0\0\0"
+"\136\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377"
+"\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\135\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\145\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\250\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0"
+"\102\4\0\0\0\0\0\0\36\5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\156\0\0\0\0\0\0\0"
+"\233\0\0\0\0\0\0\0\156\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\377\377\377\377\377\377\377\377\3\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\6\0\0\0\0\0\0\0"
+"\10\0\0\0\0\0\0\0\151\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\250\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\36\5\0\0\0\0\0\0\325\5\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\200\0\0\0\0\0\0\0\233\0\0\0\0\0\0\0\200\0\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\3\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\21\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\171\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\161\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\160\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\177\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\173\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\170\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\174\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\175\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\157\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\215\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\250\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\325\5\0\0\0\0\0\0"
+"\125\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\232\0\0\0\0\0\0\0\233\0\0\0\0\0\0\0"
+"\232\0\0\0\0\0\0\0\5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377"
+"\5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\30\0\0\0\0\0\0\0\7\0\0\0\0\0\0\0"
+"\222\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\207\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\206\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\221\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\230\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\204\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\205\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\227\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\210\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0"
+"\3\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\212\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\216\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\60\0\0\0\0\0\0\0\4\0\0\0\0\0\0\0\3\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\226\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\250\0\0\0\0\0\0\0"
+"\4\0\0\0\0\0\0\0\14\0\0\0\0\0\0\0\125\7\0\0\0\0\0\0\163\7\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\237\0\0\0\0\0\0\0\233\0\0\0\0\0\0\0\237\0\0\0\0\0\0\0"
+"\5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\236\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\144\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\135\2\0\0\0\0\0\0\7\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0"
+"\10\0\0\0\0\0\0\0\10\0\0\0\0\0\0\0\16\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0"
+"\17\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0"
+"\17\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0\17\0\0\0\0\0\0\0"
+"\31\0\0\0\0\0\0\0\31\0\0\0\0\0\0\0\31\0\0\0\0\0\0\0\33\0\0\0\0\0\0\0"
+"\34\0\0\0\0\0\0\0\35\0\0\0\0\0\0\0\36\0\0\0\0\0\0\0\40\0\0\0\0\0\0\0"
+"\41\0\0\0\0\0\0\0\41\0\0\0\0\0\0\0\41\0\0\0\0\0\0\0\42\0\0\0\0\0\0\0"
+"\43\0\0\0\0\0\0\0\44\0\0\0\0\0\0\0\45\0\0\0\0\0\0\0\47\0\0\0\0\0\0\0"
+"\47\0\0\0\0\0\0\0\47\0\0\0\0\0\0\0\50\0\0\0\0\0\0\0\50\0\0\0\0\0\0\0"
+"\50\0\0\0\0\0\0\0\51\0\0\0\0\0\0\0\52\0\0\0\0\0\0\0\53\0\0\0\0\0\0\0"
+"\55\0\0\0\0\0\0\0\56\0\0\0\0\0\0\0\57\0\0\0\0\0\0\0\61\0\0\0\0\0\0\0"
+"\61\0\0\0\0\0\0\0\61\0\0\0\0\0\0\0\62\0\0\0\0\0\0\0\64\0\0\0\0\0\0\0"
+"\64\0\0\0\0\0\0\0\64\0\0\0\0\0\0\0\65\0\0\0\0\0\0\0\67\0\0\0\0\0\0\0"
+"\67\0\0\0\0\0\0\0\67\0\0\0\0\0\0\0\71\0\0\0\0\0\0\0\71\0\0\0\0\0\0\0"
+"\71\0\0\0\0\0\0\0\72\0\0\0\0\0\0\0\72\0\0\0\0\0\0\0\72\0\0\0\0\0\0\0"
+"\73\0\0\0\0\0\0\0\73\0\0\0\0\0\0\0\73\0\0\0\0\0\0\0\74\0\0\0\0\0\0\0"
+"\74\0\0\0\0\0\0\0\74\0\0\0\0\0\0\0\75\0\0\0\0\0\0\0\76\0\0\0\0\0\0\0"
+"\77\0\0\0\0\0\0\0\100\0\0\0\0\0\0\0\101\0\0\0\0\0\0\0\103\0\0\0\0\0\0\0"
+"\104\0\0\0\0\0\0\0\105\0\0\0\0\0\0\0\107\0\0\0\0\0\0\0\107\0\0\0\0\0\0\0"
+"\107\0\0\0\0\0\0\0\110\0\0\0\0\0\0\0\112\0\0\0\0\0\0\0\112\0\0\0\0\0\0\0"
+"\112\0\0\0\0\0\0\0\113\0\0\0\0\0\0\0\113\0\0\0\0\0\0\0\113\0\0\0\0\0\0\0"
+"\113\0\0\0\0\0\0\0\113\0\0\0\0\0\0\0\120\0\0\0\0\0\0\0\123\0\0\0\0\0\0\0"
+"\124\0\0\0\0\0\0\0\125\0\0\0\0\0\0\0\126\0\0\0\0\0\0\0\130\0\0\0\0\0\0\0"
+"\132\0\0\0\0\0\0\0\132\0\0\0\0\0\0\0\132\0\0\0\0\0\0\0\132\0\0\0\0\0\0\0"
+"\132\0\0\0\0\0\0\0\137\0\0\0\0\0\0\0\140\0\0\0\0\0\0\0\142\0\0\0\0\0\0\0"
+"\142\0\0\0\0\0\0\0\142\0\0\0\0\0\0\0\142\0\0\0\0\0\0\0\143\0\0\0\0\0\0\0"
+"\144\0\0\0\0\0\0\0\145\0\0\0\0\0\0\0\146\0\0\0\0\0\0\0\147\0\0\0\0\0\0\0"
+"\150\0\0\0\0\0\0\0\151\0\0\0\0\0\0\0\152\0\0\0\0\0\0\0\153\0\0\0\0\0\0\0"
+"\154\0\0\0\0\0\0\0\154\0\0\0\0\0\0\0\154\0\0\0\0\0\0\0\155\0\0\0\0\0\0\0"
+"\155\0\0\0\0\0\0\0\155\0\0\0\0\0\0\0\156\0\0\0\0\0\0\0\157\0\0\0\0\0\0\0"
+"\160\0\0\0\0\0\0\0\161\0\0\0\0\0\0\0\162\0\0\0\0\0\0\0\163\0\0\0\0\0\0\0"
+"\164\0\0\0\0\0\0\0\165\0\0\0\0\0\0\0\167\0\0\0\0\0\0\0\170\0\0\0\0\0\0\0"
+"\171\0\0\0\0\0\0\0\171\0\0\0\0\0\0\0\171\0\0\0\0\0\0\0\172\0\0\0\0\0\0\0"
+"\174\0\0\0\0\0\0\0\174\0\0\0\0\0\0\0\174\0\0\0\0\0\0\0\175\0\0\0\0\0\0\0"
+"\176\0\0\0\0\0\0\0\177\0\0\0\0\0\0\0\201\0\0\0\0\0\0\0\202\0\0\0\0\0\0\0"
+"\203\0\0\0\0\0\0\0\204\0\0\0\0\0\0\0\205\0\0\0\0\0\0\0\206\0\0\0\0\0\0\0"
+"\210\0\0\0\0\0\0\0\211\0\0\0\0\0\0\0\212\0\0\0\0\0\0\0\213\0\0\0\0\0\0\0"
+"\214\0\0\0\0\0\0\0\215\0\0\0\0\0\0\0\216\0\0\0\0\0\0\0\217\0\0\0\0\0\0\0"
+"\220\0\0\0\0\0\0\0\221\0\0\0\0\0\0\0\222\0\0\0\0\0\0\0\223\0\0\0\0\0\0\0"
+"\224\0\0\0\0\0\0\0\225\0\0\0\0\0\0\0\226\0\0\0\0\0\0\0\230\0\0\0\0\0\0\0"
+"\231\0\0\0\0\0\0\0\232\0\0\0\0\0\0\0\233\0\0\0\0\0\0\0\234\0\0\0\0\0\0\0"
+"\235\0\0\0\0\0\0\0\236\0\0\0\0\0\0\0\237\0\0\0\0\0\0\0\240\0\0\0\0\0\0\0"
+"\242\0\0\0\0\0\0\0\243\0\0\0\0\0\0\0\244\0\0\0\0\0\0\0\245\0\0\0\0\0\0\0"
+"\246\0\0\0\0\0\0\0\247\0\0\0\0\0\0\0\250\0\0\0\0\0\0\0\251\0\0\0\0\0\0\0"
+"\252\0\0\0\0\0\0\0\252\0\0\0\0\0\0\0\252\0\0\0\0\0\0\0\253\0\0\0\0\0\0\0"
+"\256\0\0\0\0\0\0\0\257\0\0\0\0\0\0\0\260\0\0\0\0\0\0\0\261\0\0\0\0\0\0\0"
+"\262\0\0\0\0\0\0\0\264\0\0\0\0\0\0\0\265\0\0\0\0\0\0\0\270\0\0\0\0\0\0\0"
+"\271\0\0\0\0\0\0\0\273\0\0\0\0\0\0\0\274\0\0\0\0\0\0\0\275\0\0\0\0\0\0\0"
+"\276\0\0\0\0\0\0\0\277\0\0\0\0\0\0\0\301\0\0\0\0\0\0\0\301\0\0\0\0\0\0\0"
+"\307\0\0\0\0\0\0\0\307\0\0\0\0\0\0\0\307\0\0\0\0\0\0\0\307\0\0\0\0\0\0\0"
+"\310\0\0\0\0\0\0\0\311\0\0\0\0\0\0\0\312\0\0\0\0\0\0\0\312\0\0\0\0\0\0\0"
+"\314\0\0\0\0\0\0\0\315\0\0\0\0\0\0\0\316\0\0\0\0\0\0\0\317\0\0\0\0\0\0\0"
+"\320\0\0\0\0\0\0\0\320\0\0\0\0\0\0\0\322\0\0\0\0\0\0\0\322\0\0\0\0\0\0\0"
+"\327\0\0\0\0\0\0\0\331\0\0\0\0\0\0\0\332\0\0\0\0\0\0\0\333\0\0\0\0\0\0\0"
+"\333\0\0\0\0\0\0\0\340\0\0\0\0\0\0\0\343\0\0\0\0\0\0\0\344\0\0\0\0\0\0\0"
+"\344\0\0\0\0\0\0\0\344\0\0\0\0\0\0\0\345\0\0\0\0\0\0\0\346\0\0\0\0\0\0\0"
+"\347\0\0\0\0\0\0\0\350\0\0\0\0\0\0\0\352\0\0\0\0\0\0\0\352\0\0\0\0\0\0\0"
+"\352\0\0\0\0\0\0\0\353\0\0\0\0\0\0\0\355\0\0\0\0\0\0\0\355\0\0\0\0\0\0\0"
+"\355\0\0\0\0\0\0\0\356\0\0\0\0\0\0\0\357\0\0\0\0\0\0\0\360\0\0\0\0\0\0\0"
+"\362\0\0\0\0\0\0\0\363\0\0\0\0\0\0\0\364\0\0\0\0\0\0\0\366\0\0\0\0\0\0\0"
+"\370\0\0\0\0\0\0\0\371\0\0\0\0\0\0\0\372\0\0\0\0\0\0\0\373\0\0\0\0\0\0\0"
+"\373\0\0\0\0\0\0\0\373\0\0\0\0\0\0\0\374\0\0\0\0\0\0\0\374\0\0\0\0\0\0\0"
+"\374\0\0\0\0\0\0\0\375\0\0\0\0\0\0\0\376\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0"
+"\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\1\0\0\0\0\0\0\3\1\0\0\0\0\0\0"
+"\4\1\0\0\0\0\0\0\6\1\0\0\0\0\0\0\10\1\0\0\0\0\0\0\10\1\0\0\0\0\0\0"
+"\10\1\0\0\0\0\0\0\11\1\0\0\0\0\0\0\11\1\0\0\0\0\0\0\11\1\0\0\0\0\0\0"
+"\12\1\0\0\0\0\0\0\12\1\0\0\0\0\0\0\12\1\0\0\0\0\0\0\13\1\0\0\0\0\0\0"
+"\13\1\0\0\0\0\0\0\13\1\0\0\0\0\0\0\14\1\0\0\0\0\0\0\14\1\0\0\0\0\0\0"
+"\14\1\0\0\0\0\0\0\14\1\0\0\0\0\0\0\14\1\0\0\0\0\0\0\22\1\0\0\0\0\0\0"
+"\23\1\0\0\0\0\0\0\24\1\0\0\0\0\0\0\26\1\0\0\0\0\0\0\27\1\0\0\0\0\0\0"
+"\30\1\0\0\0\0\0\0\31\1\0\0\0\0\0\0\33\1\0\0\0\0\0\0\34\1\0\0\0\0\0\0"
+"\36\1\0\0\0\0\0\0\36\1\0\0\0\0\0\0\43\1\0\0\0\0\0\0\45\1\0\0\0\0\0\0"
+"\47\1\0\0\0\0\0\0\50\1\0\0\0\0\0\0\50\1\0\0\0\0\0\0\50\1\0\0\0\0\0\0"
+"\51\1\0\0\0\0\0\0\52\1\0\0\0\0\0\0\53\1\0\0\0\0\0\0\54\1\0\0\0\0\0\0"
+"\56\1\0\0\0\0\0\0\56\1\0\0\0\0\0\0\56\1\0\0\0\0\0\0\57\1\0\0\0\0\0\0"
+"\57\1\0\0\0\0\0\0\57\1\0\0\0\0\0\0\60\1\0\0\0\0\0\0\62\1\0\0\0\0\0\0"
+"\62\1\0\0\0\0\0\0\62\1\0\0\0\0\0\0\63\1\0\0\0\0\0\0\64\1\0\0\0\0\0\0"
+"\65\1\0\0\0\0\0\0\67\1\0\0\0\0\0\0\70\1\0\0\0\0\0\0\71\1\0\0\0\0\0\0"
+"\73\1\0\0\0\0\0\0\75\1\0\0\0\0\0\0\76\1\0\0\0\0\0\0\77\1\0\0\0\0\0\0"
+"\100\1\0\0\0\0\0\0\100\1\0\0\0\0\0\0\100\1\0\0\0\0\0\0\101\1\0\0\0\0\0\0"
+"\102\1\0\0\0\0\0\0\103\1\0\0\0\0\0\0\104\1\0\0\0\0\0\0\104\1\0\0\0\0\0\0"
+"\104\1\0\0\0\0\0\0\107\1\0\0\0\0\0\0\110\1\0\0\0\0\0\0\112\1\0\0\0\0\0\0"
+"\114\1\0\0\0\0\0\0\114\1\0\0\0\0\0\0\114\1\0\0\0\0\0\0\115\1\0\0\0\0\0\0"
+"\115\1\0\0\0\0\0\0\115\1\0\0\0\0\0\0\116\1\0\0\0\0\0\0\116\1\0\0\0\0\0\0"
+"\116\1\0\0\0\0\0\0\117\1\0\0\0\0\0\0\117\1\0\0\0\0\0\0\117\1\0\0\0\0\0\0"
+"\120\1\0\0\0\0\0\0\120\1\0\0\0\0\0\0\120\1\0\0\0\0\0\0\120\1\0\0\0\0\0\0"
+"\120\1\0\0\0\0\0\0\125\1\0\0\0\0\0\0\130\1\0\0\0\0\0\0\131\1\0\0\0\0\0\0"
+"\132\1\0\0\0\0\0\0\133\1\0\0\0\0\0\0\134\1\0\0\0\0\0\0\135\1\0\0\0\0\0\0"
+"\137\1\0\0\0\0\0\0\140\1\0\0\0\0\0\0\141\1\0\0\0\0\0\0\142\1\0\0\0\0\0\0"
+"\143\1\0\0\0\0\0\0\144\1\0\0\0\0\0\0\146\1\0\0\0\0\0\0\150\1\0\0\0\0\0\0"
+"\150\1\0\0\0\0\0\0\155\1\0\0\0\0\0\0\157\1\0\0\0\0\0\0\157\1\0\0\0\0\0\0"
+"\162\1\0\0\0\0\0\0\162\1\0\0\0\0\0\0\162\1\0\0\0\0\0\0\163\1\0\0\0\0\0\0"
+"\164\1\0\0\0\0\0\0\165\1\0\0\0\0\0\0\167\1\0\0\0\0\0\0\167\1\0\0\0\0\0\0"
+"\167\1\0\0\0\0\0\0\170\1\0\0\0\0\0\0\171\1\0\0\0\0\0\0\172\1\0\0\0\0\0\0"
+"\174\1\0\0\0\0\0\0\175\1\0\0\0\0\0\0\176\1\0\0\0\0\0\0\177\1\0\0\0\0\0\0"
+"\200\1\0\0\0\0\0\0\201\1\0\0\0\0\0\0\201\1\0\0\0\0\0\0\201\1\0\0\0\0\0\0"
+"\202\1\0\0\0\0\0\0\203\1\0\0\0\0\0\0\204\1\0\0\0\0\0\0\205\1\0\0\0\0\0\0"
+"\207\1\0\0\0\0\0\0\207\1\0\0\0\0\0\0\207\1\0\0\0\0\0\0\210\1\0\0\0\0\0\0"
+"\210\1\0\0\0\0\0\0\210\1\0\0\0\0\0\0\211\1\0\0\0\0\0\0\212\1\0\0\0\0\0\0"
+"\213\1\0\0\0\0\0\0\214\1\0\0\0\0\0\0\215\1\0\0\0\0\0\0\217\1\0\0\0\0\0\0"
+"\220\1\0\0\0\0\0\0\220\1\0\0\0\0\0\0\220\1\0\0\0\0\0\0\221\1\0\0\0\0\0\0"
+"\222\1\0\0\0\0\0\0\222\1\0\0\0\0\0\0\222\1\0\0\0\0\0\0\223\1\0\0\0\0\0\0"
+"\223\1\0\0\0\0\0\0\223\1\0\0\0\0\0\0\224\1\0\0\0\0\0\0\224\1\0\0\0\0\0\0"
+"\224\1\0\0\0\0\0\0\225\1\0\0\0\0\0\0\225\1\0\0\0\0\0\0\225\1\0\0\0\0\0\0"
+"\226\1\0\0\0\0\0\0\226\1\0\0\0\0\0\0\226\1\0\0\0\0\0\0\227\1\0\0\0\0\0\0"
+"\227\1\0\0\0\0\0\0\227\1\0\0\0\0\0\0\230\1\0\0\0\0\0\0\231\1\0\0\0\0\0\0"
+"\232\1\0\0\0\0\0\0\232\1\0\0\0\0\0\0\232\1\0\0\0\0\0\0\233\1\0\0\0\0\0\0"
+"\234\1\0\0\0\0\0\0\235\1\0\0\0\0\0\0\236\1\0\0\0\0\0\0\237\1\0\0\0\0\0\0"
+"\240\1\0\0\0\0\0\0\240\1\0\0\0\0\0\0\245\1\0\0\0\0\0\0\250\1\0\0\0\0\0\0"
+"\252\1\0\0\0\0\0\0\253\1\0\0\0\0\0\0\254\1\0\0\0\0\0\0\254\1\0\0\0\0\0\0"
+"\254\1\0\0\0\0\0\0\254\1\0\0\0\0\0\0\255\1\0\0\0\0\0\0\256\1\0\0\0\0\0\0"
+"\257\1\0\0\0\0\0\0\260\1\0\0\0\0\0\0\261\1\0\0\0\0\0\0\262\1\0\0\0\0\0\0"
+"\263\1\0\0\0\0\0\0\264\1\0\0\0\0\0\0\265\1\0\0\0\0\0\0\266\1\0\0\0\0\0\0"
+"\267\1\0\0\0\0\0\0\270\1\0\0\0\0\0\0\271\1\0\0\0\0\0\0\272\1\0\0\0\0\0\0"
+"\273\1\0\0\0\0\0\0\275\1\0\0\0\0\0\0\276\1\0\0\0\0\0\0\300\1\0\0\0\0\0\0"
+"\301\1\0\0\0\0\0\0\302\1\0\0\0\0\0\0\303\1\0\0\0\0\0\0\304\1\0\0\0\0\0\0"
+"\305\1\0\0\0\0\0\0\306\1\0\0\0\0\0\0\307\1\0\0\0\0\0\0\310\1\0\0\0\0\0\0"
+"\311\1\0\0\0\0\0\0\312\1\0\0\0\0\0\0\313\1\0\0\0\0\0\0\314\1\0\0\0\0\0\0"
+"\315\1\0\0\0\0\0\0\316\1\0\0\0\0\0\0\317\1\0\0\0\0\0\0\321\1\0\0\0\0\0\0"
+"\321\1\0\0\0\0\0\0\321\1\0\0\0\0\0\0\322\1\0\0\0\0\0\0\323\1\0\0\0\0\0\0"
+"\324\1\0\0\0\0\0\0\325\1\0\0\0\0\0\0\326\1\0\0\0\0\0\0\330\1\0\0\0\0\0\0"
+"\331\1\0\0\0\0\0\0\332\1\0\0\0\0\0\0\334\1\0\0\0\0\0\0\334\1\0\0\0\0\0\0"
+"\341\1\0\0\0\0\0\0\345\1\0\0\0\0\0\0\347\1\0\0\0\0\0\0\350\1\0\0\0\0\0\0"
+"\351\1\0\0\0\0\0\0\351\1\0\0\0\0\0\0\351\1\0\0\0\0\0\0\351\1\0\0\0\0\0\0"
+"\352\1\0\0\0\0\0\0\353\1\0\0\0\0\0\0\354\1\0\0\0\0\0\0\355\1\0\0\0\0\0\0"
+"\356\1\0\0\0\0\0\0\357\1\0\0\0\0\0\0\360\1\0\0\0\0\0\0\361\1\0\0\0\0\0\0"
+"\362\1\0\0\0\0\0\0\363\1\0\0\0\0\0\0\364\1\0\0\0\0\0\0\365\1\0\0\0\0\0\0"
+"\366\1\0\0\0\0\0\0\367\1\0\0\0\0\0\0\370\1\0\0\0\0\0\0\371\1\0\0\0\0\0\0"
+"\372\1\0\0\0\0\0\0\373\1\0\0\0\0\0\0\374\1\0\0\0\0\0\0\375\1\0\0\0\0\0\0"
+"\376\1\0\0\0\0\0\0\377\1\0\0\0\0\0\0\0\2\0\0\0\0\0\0\1\2\0\0\0\0\0\0"
+"\2\2\0\0\0\0\0\0\3\2\0\0\0\0\0\0\4\2\0\0\0\0\0\0\6\2\0\0\0\0\0\0"
+"\7\2\0\0\0\0\0\0\11\2\0\0\0\0\0\0\13\2\0\0\0\0\0\0\14\2\0\0\0\0\0\0"
+"\15\2\0\0\0\0\0\0\16\2\0\0\0\0\0\0\17\2\0\0\0\0\0\0\20\2\0\0\0\0\0\0"
+"\22\2\0\0\0\0\0\0\23\2\0\0\0\0\0\0\24\2\0\0\0\0\0\0\25\2\0\0\0\0\0\0"
+"\26\2\0\0\0\0\0\0\27\2\0\0\0\0\0\0\30\2\0\0\0\0\0\0\31\2\0\0\0\0\0\0"
+"\32\2\0\0\0\0\0\0\33\2\0\0\0\0\0\0\34\2\0\0\0\0\0\0\35\2\0\0\0\0\0\0"
+"\36\2\0\0\0\0\0\0\37\2\0\0\0\0\0\0\41\2\0\0\0\0\0\0\42\2\0\0\0\0\0\0"
+"\43\2\0\0\0\0\0\0\44\2\0\0\0\0\0\0\45\2\0\0\0\0\0\0\46\2\0\0\0\0\0\0"
+"\47\2\0\0\0\0\0\0\50\2\0\0\0\0\0\0\51\2\0\0\0\0\0\0\52\2\0\0\0\0\0\0"
+"\53\2\0\0\0\0\0\0\54\2\0\0\0\0\0\0\55\2\0\0\0\0\0\0\56\2\0\0\0\0\0\0"
+"\57\2\0\0\0\0\0\0\60\2\0\0\0\0\0\0\62\2\0\0\0\0\0\0\62\2\0\0\0\0\0\0"
+"\62\2\0\0\0\0\0\0\63\2\0\0\0\0\0\0\64\2\0\0\0\0\0\0\65\2\0\0\0\0\0\0"
+"\66\2\0\0\0\0\0\0\67\2\0\0\0\0\0\0\71\2\0\0\0\0\0\0\72\2\0\0\0\0\0\0"
+"\73\2\0\0\0\0\0\0\74\2\0\0\0\0\0\0\74\2\0\0\0\0\0\0\74\2\0\0\0\0\0\0"
+"\75\2\0\0\0\0\0\0\76\2\0\0\0\0\0\0\77\2\0\0\0\0\0\0\100\2\0\0\0\0\0\0"
+"\101\2\0\0\0\0\0\0\102\2\0\0\0\0\0\0\103\2\0\0\0\0\0\0\104\2\0\0\0\0\0\0"
+"\106\2\0\0\0\0\0\0\106\2\0\0\0\0\0\0\106\2\0\0\0\0\0\0\107\2\0\0\0\0\0\0"
+"\110\2\0\0\0\0\0\0\111\2\0\0\0\0\0\0\112\2\0\0\0\0\0\0\113\2\0\0\0\0\0\0"
+"\116\2\0\0\0\0\0\0\117\2\0\0\0\0\0\0\120\2\0\0\0\0\0\0\122\2\0\0\0\0\0\0"
+"\122\2\0\0\0\0\0\0\127\2\0\0\0\0\0\0\131\2\0\0\0\0\0\0\132\2\0\0\0\0\0\0"
+"\133\2\0\0\0\0\0\0\134\2\0\0\0\0\0\0\135\2\0\0\0\0\0\0\136\2\0\0\0\0\0\0"
+"\137\2\0\0\0\0\0\0\137\2\0\0\0\0\0\0\6\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\2\0\0\0\0\0\0\0"
+;
+
+const size_t bytecode_size = 40592;
+        const unsigned char * get_program_code(void)
+        {
+            return program_code;
+        }
+#define RUNCORE "fast"
+#define GCCORE NULL
+        int main(int argc, const char *argv[])
+        {
+            PMC                 *interp;
+            PMC                 *pbc;
+            PMC                 *argsarray;
+            const unsigned char *program_code_addr;
+            Parrot_Init_Args    *initargs;
+
+            static char         execname[1024];
+            size_t execname_size = sizeof(execname);
+            memset(execname, 0, execname_size);
+#if defined(__APPLE__)
+            if (_NSGetExecutablePath(execname, (unsigned int*)&execname_size) != 0)
+                memcpy(execname, argv[0], strlen(argv[0]));
+#elif defined(sun) || defined(__sun)
+            const char *_execname = getexecname();
+            if (_execname)
+                memcpy(execname, _execname, strlen(_execname));
+            else
+                memcpy(execname, argv[0], strlen(argv[0]));
+#elif defined(__FreeBSD__)
+            int mib[4];
+            mib[0] = CTL_KERN;
+            mib[1] = KERN_PROC;
+            mib[2] = KERN_PROC_PATHNAME;
+            mib[3] = -1;
+            sysctl(mib, 4, execname, &execname_size, NULL, 0);
+#elif defined(__NetBSD__)
+            if (readlink("/proc/curproc/exe", execname, execname_size-1) <= 0)
+                memcpy(execname, argv[0], strlen(argv[0]));
+#elif defined(__DragonFly__)
+            if (readlink("/proc/curproc/file", execname, execname_size-1) <= 0)
+                memcpy(execname, argv[0], strlen(argv[0]));
+#elif defined(_WIN32)
+            if (GetModuleFileName(NULL, execname, (DWORD)execname_size) == 0)
+                memcpy(execname, argv[0], strlen(argv[0]));
+#elif defined(__unix__) || defined(__linux__)
+            if (readlink("/proc/self/exe", execname, execname_size-1) <= 0)
+                memcpy(execname, argv[0], strlen(argv[0]));
+#else
+            memcpy(execname, argv[0], strlen(argv[0]));
+#endif
+
+            GET_INIT_STRUCT(initargs);
+
+            initargs->gc_system = GCCORE;
+
+            program_code_addr = get_program_code();
+
+            if (!program_code_addr)
+                exit(EXIT_FAILURE);
+
+            if (!(Parrot_api_make_interpreter(NULL, 0, initargs, &interp) &&
+                  Parrot_set_config_hash(interp) &&
+                  Parrot_api_set_executable_name(interp, execname) &&
+                  Parrot_api_set_runcore(interp, RUNCORE, TRACE))) {
+                fprintf(stderr, "PARROT VM: Could not initialize new interpreter\n");
+                show_last_error_and_exit(interp);
+            }
+
+            setup_pir_compregs(interp);
+
+            if (!Parrot_api_pmc_wrap_string_array(interp, argc, argv, &argsarray)) {
+                fprintf(stderr, "PARROT VM: Could not build args array");
+                show_last_error_and_exit(interp);
+            }
+
+            if (!Parrot_api_load_bytecode_bytes(interp,
+                                                program_code_addr,
+                                                (Parrot_Int) bytecode_size,
+                                                &pbc)) {
+                fprintf(stderr, "PARROT VM: Could not load bytecode\n");
+                show_last_error_and_exit(interp);
+            }
+
+            if (!Parrot_api_run_bytecode(interp, pbc, argsarray)) {
+                show_last_error_and_exit(interp);
+            }
+
+            if (!Parrot_api_destroy_interpreter(interp)) {
+                fprintf(stderr, "PARROT VM: Could not destroy interpreter\n");
+                show_last_error_and_exit(interp);
+            }
+
+            exit(EXIT_SUCCESS);
+        }
+
+        static void
+        show_last_error_and_exit(Parrot_PMC interp)
+        {
+            Parrot_String errmsg, backtrace;
+            Parrot_Int exit_code, is_error;
+            Parrot_PMC exception;
+
+            if (!Parrot_api_get_result(interp, &is_error, &exception, &exit_code, &errmsg))
+                exit(EXIT_FAILURE);
+
+            if (is_error) {
+                if (!Parrot_api_get_exception_backtrace(interp, exception, &backtrace))
+                    exit(EXIT_FAILURE);
+                print_parrot_string(interp, stderr, errmsg, 1);
+                print_parrot_string(interp, stderr, backtrace, 0);
+            }
+
+            exit(exit_code);
+        }
+
+        static void
+        print_parrot_string(Parrot_PMC interp, FILE *vector, Parrot_String str, int newline)
+        {
+            char *msg_raw;
+
+            if (!str)
+                return;
+
+            if (!Parrot_api_string_export_ascii(interp, str, &msg_raw))
+                show_last_error_and_exit(interp);
+
+            if (msg_raw) {
+                fprintf(vector, "%s%s", msg_raw, newline ? "\n" : "");
+
+                if (!Parrot_api_string_free_exported_ascii(interp, msg_raw))
+                    show_last_error_and_exit(interp);
+            }
+        }
+
+        static void
+        setup_pir_compregs(Parrot_PMC interp)
+        {
+            Parrot_PMC class_pmc = get_class_pmc(interp, "IMCCompiler");
+            get_imcc_compiler_pmc(interp, class_pmc, 0);
+            get_imcc_compiler_pmc(interp, class_pmc, 1);
+        }
+
+        PARROT_CANNOT_RETURN_NULL
+        static PMC *
+        get_class_pmc(Parrot_PMC interp, ARGIN(const char *name))
+        {
+            Parrot_String name_s = NULL;
+            Parrot_PMC name_pmc = NULL;
+            Parrot_PMC class_pmc = NULL;
+            if (!(Parrot_api_string_import_ascii(interp, name, &name_s) &&
+                  Parrot_api_pmc_box_string(interp, name_s, &name_pmc) &&
+                  Parrot_api_pmc_get_class(interp, name_pmc, &class_pmc)))
+                show_last_error_and_exit(interp);
+            return class_pmc;
+        }
+
+        PARROT_CANNOT_RETURN_NULL
+        static void
+        get_imcc_compiler_pmc(Parrot_PMC interp, Parrot_PMC class_pmc, Parrot_Int is_pasm)
+        {
+            Parrot_PMC is_pasm_pmc = NULL;
+            Parrot_PMC compiler_pmc = NULL;
+            const char * const name = is_pasm ? "PASM" : "PIR";
+            Parrot_String name_s = NULL;
+
+            if (!Parrot_api_pmc_box_integer(interp, is_pasm, &is_pasm_pmc))
+                show_last_error_and_exit(interp);
+            if (!Parrot_api_pmc_new_from_class(interp, class_pmc, is_pasm_pmc, &compiler_pmc))
+                show_last_error_and_exit(interp);
+            if (!(Parrot_api_string_import_ascii(interp, name, &name_s) &&
+                  Parrot_api_set_compiler(interp, name_s, compiler_pmc)))
+                show_last_error_and_exit(interp);
+        }
+
@@ -0,0 +1,3 @@
+# generated by tools/build/gen_version.pl
+.macro_const PARROT_SHA1 "9e3bdf82b7a82e091b4671f02102884e8f53cd32"
+.macro_const PARROT_GIT_DESCRIBE ""
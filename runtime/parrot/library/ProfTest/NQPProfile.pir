@@ -0,0 +1,126 @@
+
+.namespace []
+.sub "_block1000"  :anon :subid("10_1792415679.0402")
+.annotate 'file', "runtime/parrot/library/ProfTest/NQPProfile.nqp"
+.annotate 'line', 0
+    .const 'Sub' $P1003 = "11_1792415679.0402" 
+    capture_lex $P1003
+.annotate 'line', 1
+    $P0 = find_dynamic_lex "$*CTXSAVE"
+    if null $P0 goto ctxsave_done
+    $I0 = can $P0, "ctxsave"
+    unless $I0 goto ctxsave_done
+    $P0."ctxsave"()
+  ctxsave_done:
+.annotate 'line', 6
+    .const 'Sub' $P1003 = "11_1792415679.0402" 
+    capture_lex $P1003
+    $P101 = $P1003()
+.annotate 'line', 1
+    .return ($P101)
+    .const 'Sub' $P1016 = "14_1792415679.0402" 
+    .return ($P1016)
+.end
+
+
+.namespace []
+.sub "" :load :init :subid("post15") :outer("10_1792415679.0402")
+.annotate 'file', "runtime/parrot/library/ProfTest/NQPProfile.nqp"
+.annotate 'line', 0
+    .const 'Sub' $P1001 = "10_1792415679.0402" 
+    .local pmc block
+    set block, $P1001
+    $P1018 = get_root_global ["parrot"], "P6metaclass"
+    $P1018."new_class"("ProfTest::NQPProfile", "ProfTest::PIRProfile" :named("parent"))
+.end
+
+
+.namespace ["ProfTest";"NQPProfile"]
+.sub "_block1002"  :subid("11_1792415679.0402") :outer("10_1792415679.0402")
+.annotate 'file', "runtime/parrot/library/ProfTest/NQPProfile.nqp"
+.annotate 'line', 6
+    .const 'Sub' $P1004 = "12_1792415679.0402" 
+    capture_lex $P1004
+    $P0 = find_dynamic_lex "$*CTXSAVE"
+    if null $P0 goto ctxsave_done
+    $I0 = can $P0, "ctxsave"
+    unless $I0 goto ctxsave_done
+    $P0."ctxsave"()
+  ctxsave_done:
+    .const 'Sub' $P1004 = "12_1792415679.0402" 
+    newclosure $P1011, $P1004
+    .return ($P1011)
+    .const 'Sub' $P1013 = "13_1792415679.0402" 
+    .return ($P1013)
+.end
+
+
+.namespace ["ProfTest";"NQPProfile"]
+.include "except_types.pasm"
+.sub "new"  :subid("12_1792415679.0402") :method :outer("11_1792415679.0402")
+    .param pmc param_1007
+    .param pmc param_1008 :optional
+    .param int has_param_1008 :opt_flag
+.annotate 'file', "runtime/parrot/library/ProfTest/NQPProfile.nqp"
+.annotate 'line', 6
+    new $P1006, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1006, control_1005
+    push_eh $P1006
+    .lex "self", self
+    .lex "$nqp_code", param_1007
+    if has_param_1008, optparam_16
+    new $P100, "Integer"
+    assign $P100, 1
+    set param_1008, $P100
+  optparam_16:
+    .lex "$canonical", param_1008
+.annotate 'line', 7
+    new $P101, "Undef"
+    set $P1009, $P101
+    .lex "$nqp_compiler", $P1009
+.annotate 'line', 8
+    new $P102, "Undef"
+    set $P1010, $P102
+    .lex "$pir_code", $P1010
+.annotate 'line', 7
+    compreg $P103, "NQP-rx"
+    store_lex "$nqp_compiler", $P103
+.annotate 'line', 8
+    find_lex $P103, "$nqp_compiler"
+    find_lex $P104, "$nqp_code"
+    $P105 = $P103."compile"($P104, "pir" :named("target"))
+    store_lex "$pir_code", $P105
+.annotate 'line', 9
+    get_hll_global $P103, ["ProfTest"], "PIRProfile"
+    find_lex $P104, "$pir_code"
+    find_lex $P105, "$canonical"
+    $P106 = $P103."new"($P104, $P105)
+.annotate 'line', 6
+    .return ($P106)
+  control_1005:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P103, exception, "payload"
+    .return ($P103)
+.end
+
+
+.namespace ["ProfTest";"NQPProfile"]
+.sub "_block1012" :load :anon :subid("13_1792415679.0402")
+.annotate 'file', "runtime/parrot/library/ProfTest/NQPProfile.nqp"
+.annotate 'line', 6
+    .const '' $P1014 = "11_1792415679.0402" 
+    $P100 = $P1014()
+    .return ($P100)
+.end
+
+
+.namespace []
+.sub "_block1015" :load :anon :subid("14_1792415679.0402")
+.annotate 'file', "runtime/parrot/library/ProfTest/NQPProfile.nqp"
+.annotate 'line', 1
+    .const '' $P1017 = "10_1792415679.0402" 
+    $P100 = $P1017()
+    .return ($P100)
+.end
+
@@ -0,0 +1,852 @@
+
+.namespace []
+.sub "_block1000"  :anon :subid("10_1792415679.97755")
+.annotate 'file', "runtime/parrot/library/ProfTest/PIRProfile.nqp"
+.annotate 'line', 0
+    .const 'Sub' $P1003 = "11_1792415679.97755" 
+    capture_lex $P1003
+.annotate 'line', 1
+    $P0 = find_dynamic_lex "$*CTXSAVE"
+    if null $P0 goto ctxsave_done
+    $I0 = can $P0, "ctxsave"
+    unless $I0 goto ctxsave_done
+    $P0."ctxsave"()
+  ctxsave_done:
+.annotate 'line', 6
+    .const 'Sub' $P1003 = "11_1792415679.97755" 
+    capture_lex $P1003
+    $P101 = $P1003()
+.annotate 'line', 1
+    .return ($P101)
+    .const 'Sub' $P1098 = "23_1792415679.97755" 
+    .return ($P1098)
+.end
+
+
+.namespace []
+.sub "" :load :init :subid("post24") :outer("10_1792415679.97755")
+.annotate 'file', "runtime/parrot/library/ProfTest/PIRProfile.nqp"
+.annotate 'line', 0
+    .const 'Sub' $P1001 = "10_1792415679.97755" 
+    .local pmc block
+    set block, $P1001
+    $P1100 = get_root_global ["parrot"], "P6metaclass"
+    $P1100."new_class"("ProfTest::PIRProfile", "Hash" :named("parent"))
+.end
+
+
+.namespace ["ProfTest";"PIRProfile"]
+.sub "_block1002"  :subid("11_1792415679.97755") :outer("10_1792415679.97755")
+.annotate 'file', "runtime/parrot/library/ProfTest/PIRProfile.nqp"
+.annotate 'line', 6
+    .const 'Sub' $P1089 = "21_1792415679.97755" 
+    capture_lex $P1089
+    .const 'Sub' $P1060 = "20_1792415679.97755" 
+    capture_lex $P1060
+    .const 'Sub' $P1033 = "16_1792415679.97755" 
+    capture_lex $P1033
+    .const 'Sub' $P1015 = "14_1792415679.97755" 
+    capture_lex $P1015
+    .const 'Sub' $P1011 = "13_1792415679.97755" 
+    capture_lex $P1011
+    .const 'Sub' $P1004 = "12_1792415679.97755" 
+    capture_lex $P1004
+    $P0 = find_dynamic_lex "$*CTXSAVE"
+    if null $P0 goto ctxsave_done
+    $I0 = can $P0, "ctxsave"
+    unless $I0 goto ctxsave_done
+    $P0."ctxsave"()
+  ctxsave_done:
+.annotate 'line', 99
+    .const 'Sub' $P1089 = "21_1792415679.97755" 
+    newclosure $P1093, $P1089
+.annotate 'line', 6
+    .return ($P1093)
+    .const 'Sub' $P1095 = "22_1792415679.97755" 
+    .return ($P1095)
+.end
+
+
+.namespace ["ProfTest";"PIRProfile"]
+.include "except_types.pasm"
+.sub "new"  :subid("12_1792415679.97755") :method :outer("11_1792415679.97755")
+    .param pmc param_1007
+    .param pmc param_1008 :optional
+    .param int has_param_1008 :opt_flag
+.annotate 'file', "runtime/parrot/library/ProfTest/PIRProfile.nqp"
+.annotate 'line', 6
+    new $P1006, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1006, control_1005
+    push_eh $P1006
+    .lex "self", self
+    .lex "$pir_code", param_1007
+    if has_param_1008, optparam_25
+    new $P100, "Integer"
+    assign $P100, 1
+    set param_1008, $P100
+  optparam_25:
+    .lex "$canonical", param_1008
+.annotate 'line', 7
+    find_lex $P101, "$canonical"
+    find_lex $P1009, "self"
+    unless_null $P1009, vivify_26
+    $P1009 = root_new ['parrot';'Hash']
+    store_lex "self", $P1009
+  vivify_26:
+    set $P1009["canonical"], $P101
+.annotate 'line', 8
+    find_lex $P101, "$pir_code"
+    find_lex $P1010, "self"
+    unless_null $P1010, vivify_27
+    $P1010 = root_new ['parrot';'Hash']
+    store_lex "self", $P1010
+  vivify_27:
+    set $P1010["pir_code"], $P101
+.annotate 'line', 9
+    find_lex $P101, "self"
+    $P101."build_pir_profile"()
+.annotate 'line', 10
+    find_lex $P101, "self"
+    $P101."build_profile_array"()
+.annotate 'line', 6
+    find_lex $P101, "self"
+    .return ($P101)
+  control_1005:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P102, exception, "payload"
+    .return ($P102)
+.end
+
+
+.namespace ["ProfTest";"PIRProfile"]
+.include "except_types.pasm"
+.sub "profile_array"  :subid("13_1792415679.97755") :method :outer("11_1792415679.97755")
+.annotate 'file', "runtime/parrot/library/ProfTest/PIRProfile.nqp"
+.annotate 'line', 14
+    new $P1013, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1013, control_1012
+    push_eh $P1013
+    .lex "self", self
+    find_lex $P1014, "self"
+    unless_null $P1014, vivify_28
+    $P1014 = root_new ['parrot';'Hash']
+  vivify_28:
+    set $P100, $P1014["profile_array"]
+    unless_null $P100, vivify_29
+    new $P100, "Undef"
+  vivify_29:
+    .return ($P100)
+  control_1012:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["ProfTest";"PIRProfile"]
+.include "except_types.pasm"
+.sub "build_profile_array"  :subid("14_1792415679.97755") :method :outer("11_1792415679.97755")
+.annotate 'file', "runtime/parrot/library/ProfTest/PIRProfile.nqp"
+.annotate 'line', 18
+    .const 'Sub' $P1028 = "15_1792415679.97755" 
+    capture_lex $P1028
+    new $P1017, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1017, control_1016
+    push_eh $P1017
+    .lex "self", self
+.annotate 'line', 19
+    $P1019 = root_new ['parrot';'Hash']
+    set $P1018, $P1019
+    .lex "%config", $P1018
+.annotate 'line', 20
+    new $P100, "Undef"
+    set $P1020, $P100
+    .lex "$newline", $P1020
+.annotate 'line', 21
+    $P1022 = root_new ['parrot';'ResizablePMCArray']
+    set $P1021, $P1022
+    .lex "@pprof_lines", $P1021
+.annotate 'line', 19
+    find_lex $P101, "self"
+    $P102 = $P101."get_config"()
+    store_lex "%config", $P102
+.annotate 'line', 20
+    find_lex $P1024, "%config"
+    unless_null $P1024, vivify_30
+    $P1024 = root_new ['parrot';'Hash']
+  vivify_30:
+    set $P102, $P1024["win32"]
+    unless_null $P102, vivify_31
+    new $P102, "Undef"
+  vivify_31:
+    if $P102, if_1023
+    new $P104, "String"
+    assign $P104, "\n"
+    set $P101, $P104
+    goto if_1023_end
+  if_1023:
+    new $P103, "String"
+    assign $P103, "\r\n"
+    set $P101, $P103
+  if_1023_end:
+    store_lex "$newline", $P101
+.annotate 'line', 21
+    find_lex $P101, "$newline"
+    set $S100, $P101
+    find_lex $P1025, "self"
+    unless_null $P1025, vivify_32
+    $P1025 = root_new ['parrot';'Hash']
+  vivify_32:
+    set $P102, $P1025["profile"]
+    unless_null $P102, vivify_33
+    new $P102, "Undef"
+  vivify_33:
+    set $S101, $P102
+    split $P103, $S100, $S101
+    store_lex "@pprof_lines", $P103
+.annotate 'line', 22
+    new $P101, "ResizablePMCArray"
+    find_lex $P1026, "self"
+    unless_null $P1026, vivify_34
+    $P1026 = root_new ['parrot';'Hash']
+    store_lex "self", $P1026
+  vivify_34:
+    set $P1026["profile_array"], $P101
+.annotate 'line', 24
+    find_lex $P102, "@pprof_lines"
+    defined $I100, $P102
+    unless $I100, for_undef_35
+    iter $P101, $P102
+    new $P105, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P105, loop1032_handler
+    push_eh $P105
+  loop1032_test:
+    unless $P101, loop1032_done
+    shift $P103, $P101
+  loop1032_redo:
+    .const 'Sub' $P1028 = "15_1792415679.97755" 
+    capture_lex $P1028
+    $P1028($P103)
+  loop1032_next:
+    goto loop1032_test
+  loop1032_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P106, exception, 'type'
+    eq $P106, .CONTROL_LOOP_NEXT, loop1032_next
+    eq $P106, .CONTROL_LOOP_REDO, loop1032_redo
+  loop1032_done:
+    pop_eh 
+  for_undef_35:
+.annotate 'line', 18
+    .return ($P101)
+  control_1016:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P102, exception, "payload"
+    .return ($P102)
+.end
+
+
+.namespace ["ProfTest";"PIRProfile"]
+.sub "_block1027"  :anon :subid("15_1792415679.97755") :outer("14_1792415679.97755")
+    .param pmc param_1029
+.annotate 'file', "runtime/parrot/library/ProfTest/PIRProfile.nqp"
+.annotate 'line', 24
+    .lex "$line", param_1029
+.annotate 'line', 25
+    new $P104, "Undef"
+    set $P1030, $P104
+    .lex "$line_match", $P1030
+    find_lex $P105, "self"
+    find_lex $P106, "$line"
+    $P107 = $P105."make_line_hash"($P106)
+    store_lex "$line_match", $P107
+.annotate 'line', 28
+    find_lex $P1031, "self"
+    unless_null $P1031, vivify_36
+    $P1031 = root_new ['parrot';'Hash']
+  vivify_36:
+    set $P105, $P1031["profile_array"]
+    unless_null $P105, vivify_37
+    new $P105, "Undef"
+  vivify_37:
+    find_lex $P106, "$line_match"
+    $P107 = $P105."push"($P106)
+.annotate 'line', 24
+    .return ($P107)
+.end
+
+
+.namespace ["ProfTest";"PIRProfile"]
+.include "except_types.pasm"
+.sub "make_line_hash"  :subid("16_1792415679.97755") :method :outer("11_1792415679.97755")
+    .param pmc param_1036
+.annotate 'file', "runtime/parrot/library/ProfTest/PIRProfile.nqp"
+.annotate 'line', 32
+    .const 'Sub' $P1049 = "18_1792415679.97755" 
+    capture_lex $P1049
+    .const 'Sub' $P1043 = "17_1792415679.97755" 
+    capture_lex $P1043
+    new $P1035, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1035, control_1034
+    push_eh $P1035
+    .lex "self", self
+    .lex "$line", param_1036
+.annotate 'line', 34
+    $P1038 = root_new ['parrot';'Hash']
+    set $P1037, $P1038
+    .lex "%line_hash", $P1037
+.annotate 'line', 36
+    new $P100, "Undef"
+    set $P1039, $P100
+    .lex "$colon_idx", $P1039
+.annotate 'line', 34
+    $P1040 = root_new ['parrot';'Hash']
+    store_lex "%line_hash", $P1040
+.annotate 'line', 36
+    find_lex $P101, "$line"
+    set $S100, $P101
+    index $I100, $S100, ":"
+    new $P102, 'Integer'
+    set $P102, $I100
+    store_lex "$colon_idx", $P102
+.annotate 'line', 38
+    find_lex $P101, "$colon_idx"
+    set $N100, $P101
+    isge $I100, $N100, 3.0
+    if $I100, if_1041
+.annotate 'line', 44
+    .const 'Sub' $P1049 = "18_1792415679.97755" 
+    capture_lex $P1049
+    $P1049()
+    goto if_1041_end
+  if_1041:
+.annotate 'line', 38
+    .const 'Sub' $P1043 = "17_1792415679.97755" 
+    capture_lex $P1043
+    $P1043()
+  if_1041_end:
+.annotate 'line', 32
+    find_lex $P101, "%line_hash"
+    .return ($P101)
+  control_1034:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P102, exception, "payload"
+    .return ($P102)
+.end
+
+
+.namespace ["ProfTest";"PIRProfile"]
+.include "except_types.pasm"
+.sub "_block1048"  :anon :subid("18_1792415679.97755") :outer("16_1792415679.97755")
+.annotate 'file', "runtime/parrot/library/ProfTest/PIRProfile.nqp"
+.annotate 'line', 44
+    .const 'Sub' $P1053 = "19_1792415679.97755" 
+    capture_lex $P1053
+.annotate 'line', 45
+    new $P105, "Undef"
+    set $P1050, $P105
+    .lex "$type", $P1050
+    find_lex $P106, "$line"
+    set $S100, $P106
+    find_lex $P107, "$colon_idx"
+    set $I101, $P107
+    substr $S101, $S100, 0, $I101
+    new $P108, 'String'
+    set $P108, $S101
+    store_lex "$type", $P108
+.annotate 'line', 46
+    find_lex $P106, "$type"
+    find_lex $P1051, "%line_hash"
+    unless_null $P1051, vivify_38
+    $P1051 = root_new ['parrot';'Hash']
+    store_lex "%line_hash", $P1051
+  vivify_38:
+    set $P1051["type"], $P106
+.annotate 'line', 47
+    find_lex $P106, "$line"
+    set $S100, $P106
+    find_lex $P107, "$colon_idx"
+    add $P108, $P107, 1
+    set $I101, $P108
+    substr $S101, $S100, $I101
+    new $P109, 'String'
+    set $P109, $S101
+    store_lex "$line", $P109
+.annotate 'line', 48
+    new $P111, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P111, loop1059_handler
+    push_eh $P111
+  loop1059_test:
+    find_lex $P106, "$line"
+    unless $P106, loop1059_done
+  loop1059_redo:
+    .const 'Sub' $P1053 = "19_1792415679.97755" 
+    capture_lex $P1053
+    $P1053()
+  loop1059_next:
+    goto loop1059_test
+  loop1059_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P112, exception, 'type'
+    eq $P112, .CONTROL_LOOP_NEXT, loop1059_next
+    eq $P112, .CONTROL_LOOP_REDO, loop1059_redo
+  loop1059_done:
+    pop_eh 
+.annotate 'line', 44
+    .return ($P106)
+.end
+
+
+.namespace ["ProfTest";"PIRProfile"]
+.sub "_block1052"  :anon :subid("19_1792415679.97755") :outer("18_1792415679.97755")
+.annotate 'file', "runtime/parrot/library/ProfTest/PIRProfile.nqp"
+.annotate 'line', 50
+    new $P107, "Undef"
+    set $P1054, $P107
+    .lex "$colon_idx", $P1054
+.annotate 'line', 51
+    new $P108, "Undef"
+    set $P1055, $P108
+    .lex "$split_idx", $P1055
+.annotate 'line', 52
+    new $P109, "Undef"
+    set $P1056, $P109
+    .lex "$name", $P1056
+.annotate 'line', 53
+    new $P110, "Undef"
+    set $P1057, $P110
+    .lex "$value", $P1057
+.annotate 'line', 49
+    find_lex $P111, "$line"
+    set $S100, $P111
+    substr $S101, $S100, 3
+    new $P112, 'String'
+    set $P112, $S101
+    store_lex "$line", $P112
+.annotate 'line', 50
+    find_lex $P111, "$line"
+    set $S100, $P111
+    index $I101, $S100, ":"
+    new $P112, 'Integer'
+    set $P112, $I101
+    store_lex "$colon_idx", $P112
+.annotate 'line', 51
+    find_lex $P111, "$line"
+    set $S100, $P111
+    index $I101, $S100, "}x}"
+    new $P112, 'Integer'
+    set $P112, $I101
+    store_lex "$split_idx", $P112
+.annotate 'line', 52
+    find_lex $P111, "$line"
+    set $S100, $P111
+    find_lex $P112, "$colon_idx"
+    set $I101, $P112
+    substr $S101, $S100, 0, $I101
+    new $P113, 'String'
+    set $P113, $S101
+    store_lex "$name", $P113
+.annotate 'line', 53
+    find_lex $P111, "$line"
+    set $S100, $P111
+    find_lex $P112, "$colon_idx"
+    add $P113, $P112, 1
+    set $I101, $P113
+    find_lex $P114, "$split_idx"
+    find_lex $P115, "$colon_idx"
+    sub $P116, $P114, $P115
+    sub $P117, $P116, 1
+    set $I102, $P117
+    substr $S101, $S100, $I101, $I102
+    new $P118, 'String'
+    set $P118, $S101
+    store_lex "$value", $P118
+.annotate 'line', 54
+    find_lex $P111, "$value"
+    find_lex $P112, "$name"
+    find_lex $P1058, "%line_hash"
+    unless_null $P1058, vivify_39
+    $P1058 = root_new ['parrot';'Hash']
+    store_lex "%line_hash", $P1058
+  vivify_39:
+    set $P1058[$P112], $P111
+.annotate 'line', 55
+    find_lex $P111, "$line"
+    set $S100, $P111
+    find_lex $P112, "$split_idx"
+    add $P113, $P112, 3
+    set $I101, $P113
+    substr $S101, $S100, $I101
+    new $P114, 'String'
+    set $P114, $S101
+    store_lex "$line", $P114
+.annotate 'line', 48
+    .return ($P114)
+.end
+
+
+.namespace ["ProfTest";"PIRProfile"]
+.sub "_block1042"  :anon :subid("17_1792415679.97755") :outer("16_1792415679.97755")
+.annotate 'file', "runtime/parrot/library/ProfTest/PIRProfile.nqp"
+.annotate 'line', 39
+    new $P102, "Undef"
+    set $P1044, $P102
+    .lex "$type", $P1044
+.annotate 'line', 40
+    new $P103, "Undef"
+    set $P1045, $P103
+    .lex "$data", $P1045
+.annotate 'line', 39
+    find_lex $P104, "$line"
+    set $S100, $P104
+    find_lex $P105, "$colon_idx"
+    set $I101, $P105
+    substr $S101, $S100, 0, $I101
+    new $P106, 'String'
+    set $P106, $S101
+    store_lex "$type", $P106
+.annotate 'line', 40
+    find_lex $P104, "$line"
+    set $S100, $P104
+    find_lex $P105, "$colon_idx"
+    add $P106, $P105, 1
+    set $I101, $P106
+    substr $S101, $S100, $I101
+    new $P107, 'String'
+    set $P107, $S101
+    store_lex "$data", $P107
+.annotate 'line', 41
+    find_lex $P104, "$type"
+    find_lex $P1046, "%line_hash"
+    unless_null $P1046, vivify_40
+    $P1046 = root_new ['parrot';'Hash']
+    store_lex "%line_hash", $P1046
+  vivify_40:
+    set $P1046["type"], $P104
+.annotate 'line', 42
+    find_lex $P104, "$data"
+    find_lex $P1047, "%line_hash"
+    unless_null $P1047, vivify_41
+    $P1047 = root_new ['parrot';'Hash']
+    store_lex "%line_hash", $P1047
+  vivify_41:
+    set $P1047["data"], $P104
+.annotate 'line', 38
+    .return ($P104)
+.end
+
+
+.namespace ["ProfTest";"PIRProfile"]
+.include "except_types.pasm"
+.sub "build_pir_profile"  :subid("20_1792415679.97755") :method :outer("11_1792415679.97755")
+.annotate 'file', "runtime/parrot/library/ProfTest/PIRProfile.nqp"
+.annotate 'line', 62
+    new $P1062, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1062, control_1061
+    push_eh $P1062
+    .lex "self", self
+.annotate 'line', 64
+    $P1064 = root_new ['parrot';'Hash']
+    set $P1063, $P1064
+    .lex "%config", $P1063
+.annotate 'line', 66
+    new $P100, "Undef"
+    set $P1065, $P100
+    .lex "$tmp_pir", $P1065
+.annotate 'line', 67
+    new $P101, "Undef"
+    set $P1066, $P101
+    .lex "$tmp_pprof", $P1066
+.annotate 'line', 69
+    new $P102, "Undef"
+    set $P1067, $P102
+    .lex "$fh", $P1067
+.annotate 'line', 74
+    new $P103, "Undef"
+    set $P1068, $P103
+    .lex "$parrot_exe", $P1068
+.annotate 'line', 75
+    new $P104, "Undef"
+    set $P1069, $P104
+    .lex "$hash_seed_opt", $P1069
+.annotate 'line', 77
+    $P1071 = root_new ['parrot';'Hash']
+    set $P1070, $P1071
+    .lex "%env", $P1070
+.annotate 'line', 84
+    new $P105, "Undef"
+    set $P1072, $P105
+    .lex "$cli", $P1072
+.annotate 'line', 86
+    new $P106, "Undef"
+    set $P1073, $P106
+    .lex "$pipe", $P1073
+.annotate 'line', 91
+    new $P107, "Undef"
+    set $P1074, $P107
+    .lex "$pprof_fh", $P1074
+.annotate 'line', 64
+    find_lex $P108, "self"
+    $P109 = $P108."get_config"()
+    store_lex "%config", $P109
+.annotate 'line', 66
+    find_lex $P1075, "%config"
+    unless_null $P1075, vivify_42
+    $P1075 = root_new ['parrot';'Hash']
+  vivify_42:
+    set $P108, $P1075["tempdir"]
+    unless_null $P108, vivify_43
+    new $P108, "Undef"
+  vivify_43:
+    find_lex $P1076, "%config"
+    unless_null $P1076, vivify_44
+    $P1076 = root_new ['parrot';'Hash']
+  vivify_44:
+    set $P109, $P1076["slash"]
+    unless_null $P109, vivify_45
+    new $P109, "Undef"
+  vivify_45:
+    concat $P110, $P108, $P109
+    concat $P111, $P110, "test.pir"
+    store_lex "$tmp_pir", $P111
+.annotate 'line', 67
+    find_lex $P1077, "%config"
+    unless_null $P1077, vivify_46
+    $P1077 = root_new ['parrot';'Hash']
+  vivify_46:
+    set $P108, $P1077["tempdir"]
+    unless_null $P108, vivify_47
+    new $P108, "Undef"
+  vivify_47:
+    find_lex $P1078, "%config"
+    unless_null $P1078, vivify_48
+    $P1078 = root_new ['parrot';'Hash']
+  vivify_48:
+    set $P109, $P1078["slash"]
+    unless_null $P109, vivify_49
+    new $P109, "Undef"
+  vivify_49:
+    concat $P110, $P108, $P109
+    concat $P111, $P110, "test.pprof"
+    store_lex "$tmp_pprof", $P111
+.annotate 'line', 69
+    new $P108, "String"
+    assign $P108, "FileHandle"
+    new $P109, $P108
+    store_lex "$fh", $P109
+.annotate 'line', 70
+    find_lex $P108, "$fh"
+    find_lex $P109, "$tmp_pir"
+    $P108."open"($P109, "w")
+.annotate 'line', 71
+    find_lex $P108, "$fh"
+    find_lex $P1079, "self"
+    unless_null $P1079, vivify_50
+    $P1079 = root_new ['parrot';'Hash']
+  vivify_50:
+    set $P109, $P1079["pir_code"]
+    unless_null $P109, vivify_51
+    new $P109, "Undef"
+  vivify_51:
+    $P108."print"($P109)
+.annotate 'line', 72
+    find_lex $P108, "$fh"
+    $P108."close"()
+.annotate 'line', 74
+    find_lex $P1080, "%config"
+    unless_null $P1080, vivify_52
+    $P1080 = root_new ['parrot';'Hash']
+  vivify_52:
+    set $P108, $P1080["prefix"]
+    unless_null $P108, vivify_53
+    new $P108, "Undef"
+  vivify_53:
+    find_lex $P1081, "%config"
+    unless_null $P1081, vivify_54
+    $P1081 = root_new ['parrot';'Hash']
+  vivify_54:
+    set $P109, $P1081["slash"]
+    unless_null $P109, vivify_55
+    new $P109, "Undef"
+  vivify_55:
+    concat $P110, $P108, $P109
+    find_lex $P1082, "%config"
+    unless_null $P1082, vivify_56
+    $P1082 = root_new ['parrot';'Hash']
+  vivify_56:
+    set $P111, $P1082["test_prog"]
+    unless_null $P111, vivify_57
+    new $P111, "Undef"
+  vivify_57:
+    concat $P112, $P110, $P111
+    store_lex "$parrot_exe", $P112
+.annotate 'line', 75
+    new $P108, "String"
+    assign $P108, ""
+    store_lex "$hash_seed_opt", $P108
+.annotate 'line', 77
+    new $P108, "String"
+    assign $P108, "Env"
+    new $P109, $P108
+    store_lex "%env", $P109
+.annotate 'line', 78
+    find_lex $P108, "$tmp_pprof"
+    find_lex $P1083, "%env"
+    unless_null $P1083, vivify_58
+    $P1083 = root_new ['parrot';'Hash']
+    store_lex "%env", $P1083
+  vivify_58:
+    set $P1083["PARROT_PROFILING_FILENAME"], $P108
+.annotate 'line', 79
+    find_lex $P1085, "self"
+    unless_null $P1085, vivify_59
+    $P1085 = root_new ['parrot';'Hash']
+  vivify_59:
+    set $P108, $P1085["canonical"]
+    unless_null $P108, vivify_60
+    new $P108, "Undef"
+  vivify_60:
+    unless $P108, if_1084_end
+.annotate 'line', 80
+    new $P109, "Integer"
+    assign $P109, 1
+    find_lex $P1086, "%env"
+    unless_null $P1086, vivify_61
+    $P1086 = root_new ['parrot';'Hash']
+    store_lex "%env", $P1086
+  vivify_61:
+    set $P1086["PARROT_PROFILING_CANONICAL_OUTPUT"], $P109
+.annotate 'line', 81
+    new $P109, "String"
+    assign $P109, "--hash-seed=1234"
+    store_lex "$hash_seed_opt", $P109
+  if_1084_end:
+.annotate 'line', 84
+    new $P108, 'String'
+    set $P108, "\""
+    find_lex $P109, "$parrot_exe"
+    concat $P110, $P108, $P109
+    concat $P111, $P110, "\" "
+    find_lex $P112, "$hash_seed_opt"
+    concat $P113, $P111, $P112
+    concat $P114, $P113, " --runcore profiling "
+    find_lex $P115, "$tmp_pir"
+    concat $P116, $P114, $P115
+    store_lex "$cli", $P116
+.annotate 'line', 86
+    new $P108, "String"
+    assign $P108, "FileHandle"
+    new $P109, $P108
+    store_lex "$pipe", $P109
+.annotate 'line', 87
+    find_lex $P108, "$pipe"
+    find_lex $P109, "$cli"
+    $P108."open"($P109, "rp")
+.annotate 'line', 88
+    find_lex $P108, "$pipe"
+    $P108."readall"()
+.annotate 'line', 89
+    find_lex $P108, "$pipe"
+    $P109 = $P108."exit_status"()
+    find_lex $P1087, "self"
+    unless_null $P1087, vivify_62
+    $P1087 = root_new ['parrot';'Hash']
+    store_lex "self", $P1087
+  vivify_62:
+    set $P1087["exit_status"], $P109
+.annotate 'line', 91
+    new $P108, "String"
+    assign $P108, "FileHandle"
+    new $P109, $P108
+    store_lex "$pprof_fh", $P109
+.annotate 'line', 92
+    find_lex $P108, "$pprof_fh"
+    find_lex $P109, "$tmp_pprof"
+    $P110 = $P108."readall"($P109)
+    find_lex $P1088, "self"
+    unless_null $P1088, vivify_63
+    $P1088 = root_new ['parrot';'Hash']
+    store_lex "self", $P1088
+  vivify_63:
+    set $P1088["profile"], $P110
+.annotate 'line', 94
+    loadlib $P108, "os"
+.annotate 'line', 95
+    new $P108, "String"
+    assign $P108, "OS"
+    new $P109, $P108
+    find_lex $P110, "$tmp_pir"
+    $P109."rm"($P110)
+.annotate 'line', 96
+    new $P108, "String"
+    assign $P108, "OS"
+    new $P109, $P108
+    find_lex $P110, "$tmp_pprof"
+    $P111 = $P109."rm"($P110)
+.annotate 'line', 62
+    .return ($P111)
+  control_1061:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P108, exception, "payload"
+    .return ($P108)
+.end
+
+
+.namespace ["ProfTest";"PIRProfile"]
+.include "except_types.pasm"
+.sub "get_config"  :subid("21_1792415679.97755") :method :outer("11_1792415679.97755")
+.annotate 'file', "runtime/parrot/library/ProfTest/PIRProfile.nqp"
+.annotate 'line', 99
+    new $P1091, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1091, control_1090
+    push_eh $P1091
+    .lex "self", self
+.annotate 'line', 100
+    new $P100, "Exception"
+    set $P100['type'], .CONTROL_RETURN
+
+        .include 'iglobals.pasm'
+        .local pmc i
+        i = getinterp
+        $P1092 = i[.IGLOBALS_CONFIG_HASH]
+    
+    setattribute $P100, 'payload', $P1092
+    throw $P100
+.annotate 'line', 99
+    .return ()
+  control_1090:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P100, exception, "payload"
+    .return ($P100)
+.end
+
+
+.namespace ["ProfTest";"PIRProfile"]
+.sub "_block1094" :load :anon :subid("22_1792415679.97755")
+.annotate 'file', "runtime/parrot/library/ProfTest/PIRProfile.nqp"
+.annotate 'line', 6
+    .const '' $P1096 = "11_1792415679.97755" 
+    $P100 = $P1096()
+    .return ($P100)
+.end
+
+
+.namespace []
+.sub "_block1097" :load :anon :subid("23_1792415679.97755")
+.annotate 'file', "runtime/parrot/library/ProfTest/PIRProfile.nqp"
+.annotate 'line', 1
+    .const '' $P1099 = "10_1792415679.97755" 
+    $P100 = $P1099()
+    .return ($P100)
+.end
+
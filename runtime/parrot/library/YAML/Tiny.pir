@@ -0,0 +1,7103 @@
+
+.namespace []
+.sub "_block1000"  :anon :subid("10_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 0
+    .const 'Sub' $P1003 = "11_1792415686.17671" 
+    capture_lex $P1003
+.annotate 'line', 1
+    $P0 = find_dynamic_lex "$*CTXSAVE"
+    if null $P0 goto ctxsave_done
+    $I0 = can $P0, "ctxsave"
+    unless $I0 goto ctxsave_done
+    $P0."ctxsave"()
+  ctxsave_done:
+.annotate 'line', 12
+    .const 'Sub' $P1003 = "11_1792415686.17671" 
+    capture_lex $P1003
+    $P105 = $P1003()
+.annotate 'line', 1
+    .return ($P105)
+    .const 'Sub' $P1529 = "87_1792415686.17671" 
+    .return ($P1529)
+.end
+
+
+.namespace []
+.sub "" :load :init :subid("post88") :outer("10_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 0
+    .const 'Sub' $P1001 = "10_1792415686.17671" 
+    .local pmc block
+    set block, $P1001
+    $P1531 = get_root_global ["parrot"], "P6metaclass"
+    new $P101, "ResizablePMCArray"
+    push $P101, "@UNPRINTABLE"
+    push $P101, "%UNESCAPES"
+    $P1531."new_class"("YAML::Tiny", $P101 :named("attr"))
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1002"  :subid("11_1792415686.17671") :outer("10_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 12
+    .const 'Sub' $P1520 = "85_1792415686.17671" 
+    capture_lex $P1520
+    .const 'Sub' $P1511 = "83_1792415686.17671" 
+    capture_lex $P1511
+    .const 'Sub' $P1501 = "81_1792415686.17671" 
+    capture_lex $P1501
+    .const 'Sub' $P1490 = "79_1792415686.17671" 
+    capture_lex $P1490
+    .const 'Sub' $P1486 = "78_1792415686.17671" 
+    capture_lex $P1486
+    .const 'Sub' $P1353 = "62_1792415686.17671" 
+    capture_lex $P1353
+    .const 'Sub' $P1213 = "43_1792415686.17671" 
+    capture_lex $P1213
+    .const 'Sub' $P1121 = "29_1792415686.17671" 
+    capture_lex $P1121
+    .const 'Sub' $P1018 = "14_1792415686.17671" 
+    capture_lex $P1018
+    .const 'Sub' $P1013 = "13_1792415686.17671" 
+    capture_lex $P1013
+    .const 'Sub' $P1005 = "12_1792415686.17671" 
+    capture_lex $P1005
+.annotate 'line', 402
+    get_global $P100, "$DEBUG"
+    unless_null $P100, vivify_90
+    new $P100, "Undef"
+    set_global "$DEBUG", $P100
+  vivify_90:
+.annotate 'line', 403
+    .const 'Sub' $P1005 = "12_1792415686.17671" 
+    newclosure $P1011, $P1005
+    set $P1004, $P1011
+    .lex "debug", $P1004
+.annotate 'line', 410
+    .const 'Sub' $P1013 = "13_1792415686.17671" 
+    newclosure $P1017, $P1013
+    set $P1012, $P1017
+    .lex "length", $P1012
+.annotate 'line', 12
+    $P0 = find_dynamic_lex "$*CTXSAVE"
+    if null $P0 goto ctxsave_done
+    $I0 = can $P0, "ctxsave"
+    unless $I0 goto ctxsave_done
+    $P0."ctxsave"()
+  ctxsave_done:
+    new $P104, "ResizablePMCArray"
+    push $P104, "z"
+    push $P104, "x01"
+    push $P104, "x02"
+    push $P104, "x03"
+    push $P104, "x04"
+    push $P104, "x05"
+    push $P104, "x06"
+    push $P104, "a"
+    push $P104, "x08"
+    push $P104, "t"
+    push $P104, "n"
+    push $P104, "v"
+    push $P104, "f"
+    push $P104, "r"
+    push $P104, "x0e"
+    push $P104, "x0f"
+    push $P104, "x10"
+    push $P104, "x11"
+    push $P104, "x12"
+    push $P104, "x13"
+    push $P104, "x14"
+    push $P104, "x15"
+    push $P104, "x16"
+    push $P104, "x17"
+    push $P104, "x18"
+    push $P104, "x19"
+    push $P104, "x1a"
+    push $P104, "e"
+    push $P104, "x1c"
+    push $P104, "x1d"
+    push $P104, "x1e"
+    push $P104, "x1f"
+.annotate 'line', 20
+    $P104 = "hash"(unicode:"\x{0}" :named("z"), "\a" :named("a"), "\t" :named("t"), "\n" :named("n"), unicode:"\x{b}" :named("v"), "\f" :named("f"), "\r" :named("r"), "\e" :named("e"))
+.annotate 'line', 12
+    get_global $P104, "$DEBUG"
+    find_lex $P104, "debug"
+    find_lex $P104, "length"
+    .return ()
+    .const 'Sub' $P1526 = "86_1792415686.17671" 
+    .return ($P1526)
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "" :load :init :subid("post89") :outer("11_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 12
+    .const 'Sub' $P1003 = "11_1792415686.17671" 
+    .local pmc block
+    set block, $P1003
+.annotate 'line', 413
+    load_bytecode "nqp-setting.pbc"
+.annotate 'line', 414
+    load_bytecode "dumper.pbc"
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.include "except_types.pasm"
+.sub "debug"  :subid("12_1792415686.17671") :outer("11_1792415686.17671")
+    .param pmc param_1008
+    .param pmc param_1009 :slurpy
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 403
+    new $P1007, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1007, control_1006
+    push_eh $P1007
+    .lex "$message", param_1008
+    .lex "@params", param_1009
+.annotate 'line', 404
+    get_global $P102, "$DEBUG"
+    if $P102, if_1010
+    set $P101, $P102
+    goto if_1010_end
+  if_1010:
+.annotate 'line', 405
+    find_lex $P103, "$message"
+    concat $P104, $P103, ": "
+    "print"($P104)
+.annotate 'line', 406
+    find_lex $P103, "@params"
+    $P104 = "_dumper"($P103)
+.annotate 'line', 404
+    set $P101, $P104
+  if_1010_end:
+.annotate 'line', 403
+    .return ($P101)
+  control_1006:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P102, exception, "payload"
+    .return ($P102)
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.include "except_types.pasm"
+.sub "length"  :subid("13_1792415686.17671") :outer("11_1792415686.17671")
+    .param pmc param_1016
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 410
+    new $P1015, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1015, control_1014
+    push_eh $P1015
+    .lex "$s", param_1016
+    find_lex $P103, "$s"
+    set $S100, $P103
+    length $I100, $S100
+    .return ($I100)
+  control_1014:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P103, exception, "payload"
+    .return ($P103)
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.include "except_types.pasm"
+.sub "read_string"  :subid("14_1792415686.17671") :method :outer("11_1792415686.17671")
+    .param pmc param_1021
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 36
+    .const 'Sub' $P1052 = "19_1792415686.17671" 
+    capture_lex $P1052
+    .const 'Sub' $P1045 = "18_1792415686.17671" 
+    capture_lex $P1045
+    .const 'Sub' $P1031 = "16_1792415686.17671" 
+    capture_lex $P1031
+    .const 'Sub' $P1027 = "15_1792415686.17671" 
+    capture_lex $P1027
+    new $P1020, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1020, control_1019
+    push_eh $P1020
+    .lex "self", self
+    .lex "$string", param_1021
+.annotate 'line', 38
+    $P1023 = root_new ['parrot';'ResizablePMCArray']
+    set $P1022, $P1023
+    .lex "@result", $P1022
+.annotate 'line', 72
+    $P1025 = root_new ['parrot';'ResizablePMCArray']
+    set $P1024, $P1025
+    .lex "@lines", $P1024
+.annotate 'line', 36
+    find_lex $P104, "@result"
+.annotate 'line', 73
+    get_hll_global $P104, ["Regex"], "Regex"
+    .const 'Sub' $P1027 = "15_1792415686.17671" 
+    capture_lex $P1027
+    $P105 = $P104."new"($P1027)
+    find_lex $P106, "$string"
+    $P107 = "split"($P105, $P106)
+    .const 'Sub' $P1031 = "16_1792415686.17671" 
+    newclosure $P1041, $P1031
+    $P108 = $P107."grep"($P1041)
+    store_lex "@lines", $P108
+.annotate 'line', 77
+    find_lex $P105, "@lines"
+    set $N100, $P105
+    if $N100, if_1043
+    new $P104, 'Float'
+    set $P104, $N100
+    goto if_1043_end
+  if_1043:
+    get_hll_global $P106, ["Regex"], "Regex"
+    .const 'Sub' $P1045 = "18_1792415686.17671" 
+    capture_lex $P1045
+    $P107 = $P106."new"($P1045)
+    find_lex $P1050, "@lines"
+    unless_null $P1050, vivify_103
+    $P1050 = root_new ['parrot';'ResizablePMCArray']
+  vivify_103:
+    set $P108, $P1050[0]
+    unless_null $P108, vivify_104
+    new $P108, "Undef"
+  vivify_104:
+    $P109 = $P107."ACCEPTS"($P108)
+    set $P104, $P109
+  if_1043_end:
+    unless $P104, if_1042_end
+    find_lex $P110, "@lines"
+    $P110."shift"()
+  if_1042_end:
+.annotate 'line', 80
+    new $P108, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P108, loop1120_handler
+    push_eh $P108
+  loop1120_test:
+    find_lex $P104, "@lines"
+    set $N100, $P104
+    unless $N100, loop1120_done
+  loop1120_redo:
+    .const 'Sub' $P1052 = "19_1792415686.17671" 
+    capture_lex $P1052
+    $P1052()
+  loop1120_next:
+    goto loop1120_test
+  loop1120_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P109, exception, 'type'
+    eq $P109, .CONTROL_LOOP_NEXT, loop1120_next
+    eq $P109, .CONTROL_LOOP_REDO, loop1120_redo
+  loop1120_done:
+    pop_eh 
+.annotate 'line', 137
+    find_lex $P104, "@result"
+    "debug"("RESULT", $P104 :flat)
+.annotate 'line', 36
+    find_lex $P104, "@result"
+    .return ($P104)
+  control_1019:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P105, exception, "payload"
+    .return ($P105)
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1026"  :anon :subid("15_1792415686.17671") :method :outer("14_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 73
+    .local string rx1028_tgt
+    .local int rx1028_pos
+    .local int rx1028_off
+    .local int rx1028_eos
+    .local int rx1028_rep
+    .local pmc rx1028_cur
+    .local pmc rx1028_debug
+    (rx1028_cur, rx1028_pos, rx1028_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1028_debug, rx1028_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1028_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1028_eos, rx1028_tgt
+    gt rx1028_pos, rx1028_eos, rx1028_done
+    set rx1028_off, 0
+    lt rx1028_pos, 2, rx1028_start
+    sub rx1028_off, rx1028_pos, 1
+    substr rx1028_tgt, rx1028_tgt, rx1028_off
+  rx1028_start:
+    eq $I10, 1, rx1028_restart
+    if_null rx1028_debug, debug_91
+    rx1028_cur."!cursor_debug"("START", "")
+  debug_91:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1029_done
+    goto rxscan1029_scan
+  rxscan1029_loop:
+    ($P10) = rx1028_cur."from"()
+    inc $P10
+    set rx1028_pos, $P10
+    ge rx1028_pos, rx1028_eos, rxscan1029_done
+  rxscan1029_scan:
+    set_addr $I10, rxscan1029_loop
+    rx1028_cur."!mark_push"(0, rx1028_pos, $I10)
+  rxscan1029_done:
+  # rx charclass nl
+    ge rx1028_pos, rx1028_eos, rx1028_fail
+    sub $I10, rx1028_pos, rx1028_off
+    is_cclass $I11, 4096, rx1028_tgt, $I10
+    unless $I11, rx1028_fail
+    substr $S10, rx1028_tgt, $I10, 2
+    iseq $I11, $S10, "\r\n"
+    add rx1028_pos, $I11
+    inc rx1028_pos
+  # rx pass
+    rx1028_cur."!cursor_pass"(rx1028_pos, "")
+    if_null rx1028_debug, debug_92
+    rx1028_cur."!cursor_debug"("PASS", "", " at pos=", rx1028_pos)
+  debug_92:
+    rx1028_cur."!cursor_backtrack"()
+    .return (rx1028_cur)
+  rx1028_restart:
+    if_null rx1028_debug, debug_93
+    rx1028_cur."!cursor_debug"("NEXT", "")
+  debug_93:
+  rx1028_fail:
+    (rx1028_rep, rx1028_pos, $I10, $P10) = rx1028_cur."!mark_fail"(0)
+    lt rx1028_pos, -1, rx1028_done
+    eq rx1028_pos, -1, rx1028_fail
+    jump $I10
+  rx1028_done:
+    rx1028_cur."!cursor_fail"()
+    if_null rx1028_debug, debug_94
+    rx1028_cur."!cursor_debug"("FAIL", "")
+  debug_94:
+    .return (rx1028_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1030"  :anon :subid("16_1792415686.17671") :outer("14_1792415686.17671")
+    .param pmc param_1032
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 73
+    .const 'Sub' $P1034 = "17_1792415686.17671" 
+    capture_lex $P1034
+    .lex "$a", param_1032
+    get_hll_global $P108, ["Regex"], "Regex"
+    .const 'Sub' $P1034 = "17_1792415686.17671" 
+    capture_lex $P1034
+    $P109 = $P108."new"($P1034)
+    find_lex $P110, "$a"
+    $P111 = $P109."ACCEPTS"($P110)
+    isfalse $I101, $P111
+    .return ($I101)
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1033"  :anon :subid("17_1792415686.17671") :method :outer("16_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 73
+    .local string rx1035_tgt
+    .local int rx1035_pos
+    .local int rx1035_off
+    .local int rx1035_eos
+    .local int rx1035_rep
+    .local pmc rx1035_cur
+    .local pmc rx1035_debug
+    (rx1035_cur, rx1035_pos, rx1035_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1035_debug, rx1035_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1035_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1035_eos, rx1035_tgt
+    gt rx1035_pos, rx1035_eos, rx1035_done
+    set rx1035_off, 0
+    lt rx1035_pos, 2, rx1035_start
+    sub rx1035_off, rx1035_pos, 1
+    substr rx1035_tgt, rx1035_tgt, rx1035_off
+  rx1035_start:
+    eq $I10, 1, rx1035_restart
+    if_null rx1035_debug, debug_95
+    rx1035_cur."!cursor_debug"("START", "")
+  debug_95:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1036_done
+    goto rxscan1036_scan
+  rxscan1036_loop:
+    ($P10) = rx1035_cur."from"()
+    inc $P10
+    set rx1035_pos, $P10
+    ge rx1035_pos, rx1035_eos, rxscan1036_done
+  rxscan1036_scan:
+    set_addr $I10, rxscan1036_loop
+    rx1035_cur."!mark_push"(0, rx1035_pos, $I10)
+  rxscan1036_done:
+  # rxanchor bol
+    eq rx1035_pos, 0, rxanchor1037_done
+    ge rx1035_pos, rx1035_eos, rx1035_fail
+    sub $I10, rx1035_pos, rx1035_off
+    dec $I10
+    is_cclass $I11, 4096, rx1035_tgt, $I10
+    unless $I11, rx1035_fail
+  rxanchor1037_done:
+  # rx rxquantg1038 ** 0..*
+    set_addr $I10, rxquantg1038_done
+    rx1035_cur."!mark_push"(0, rx1035_pos, $I10)
+  rxquantg1038_loop:
+  # rx charclass s
+    ge rx1035_pos, rx1035_eos, rx1035_fail
+    sub $I10, rx1035_pos, rx1035_off
+    is_cclass $I11, 32, rx1035_tgt, $I10
+    unless $I11, rx1035_fail
+    inc rx1035_pos
+    set_addr $I10, rxquantg1038_done
+    rx1035_cur."!mark_push"(rx1035_rep, rx1035_pos, $I10)
+    goto rxquantg1038_loop
+  rxquantg1038_done:
+  # rx rxquantg1039 ** 0..1
+    set_addr $I10, rxquantg1039_done
+    rx1035_cur."!mark_push"(0, rx1035_pos, $I10)
+  rxquantg1039_loop:
+  # rx literal  "#"
+    add $I11, rx1035_pos, 1
+    gt $I11, rx1035_eos, rx1035_fail
+    sub $I11, rx1035_pos, rx1035_off
+    ord $I11, rx1035_tgt, $I11
+    ne $I11, 35, rx1035_fail
+    add rx1035_pos, 1
+  # rx rxquantg1040 ** 0..*
+    set_addr $I10, rxquantg1040_done
+    rx1035_cur."!mark_push"(0, rx1035_pos, $I10)
+  rxquantg1040_loop:
+  # rx charclass .
+    ge rx1035_pos, rx1035_eos, rx1035_fail
+    inc rx1035_pos
+    set_addr $I10, rxquantg1040_done
+    rx1035_cur."!mark_push"(rx1035_rep, rx1035_pos, $I10)
+    goto rxquantg1040_loop
+  rxquantg1040_done:
+  rxquantg1039_done:
+  # rxanchor eos
+    ne rx1035_pos, rx1035_eos, rx1035_fail
+  # rx pass
+    rx1035_cur."!cursor_pass"(rx1035_pos, "")
+    if_null rx1035_debug, debug_96
+    rx1035_cur."!cursor_debug"("PASS", "", " at pos=", rx1035_pos)
+  debug_96:
+    rx1035_cur."!cursor_backtrack"()
+    .return (rx1035_cur)
+  rx1035_restart:
+    if_null rx1035_debug, debug_97
+    rx1035_cur."!cursor_debug"("NEXT", "")
+  debug_97:
+  rx1035_fail:
+    (rx1035_rep, rx1035_pos, $I10, $P10) = rx1035_cur."!mark_fail"(0)
+    lt rx1035_pos, -1, rx1035_done
+    eq rx1035_pos, -1, rx1035_fail
+    jump $I10
+  rx1035_done:
+    rx1035_cur."!cursor_fail"()
+    if_null rx1035_debug, debug_98
+    rx1035_cur."!cursor_debug"("FAIL", "")
+  debug_98:
+    .return (rx1035_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1044"  :anon :subid("18_1792415686.17671") :method :outer("14_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 77
+    .local string rx1046_tgt
+    .local int rx1046_pos
+    .local int rx1046_off
+    .local int rx1046_eos
+    .local int rx1046_rep
+    .local pmc rx1046_cur
+    .local pmc rx1046_debug
+    (rx1046_cur, rx1046_pos, rx1046_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1046_debug, rx1046_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1046_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1046_eos, rx1046_tgt
+    gt rx1046_pos, rx1046_eos, rx1046_done
+    set rx1046_off, 0
+    lt rx1046_pos, 2, rx1046_start
+    sub rx1046_off, rx1046_pos, 1
+    substr rx1046_tgt, rx1046_tgt, rx1046_off
+  rx1046_start:
+    eq $I10, 1, rx1046_restart
+    if_null rx1046_debug, debug_99
+    rx1046_cur."!cursor_debug"("START", "")
+  debug_99:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1047_done
+    goto rxscan1047_scan
+  rxscan1047_loop:
+    ($P10) = rx1046_cur."from"()
+    inc $P10
+    set rx1046_pos, $P10
+    ge rx1046_pos, rx1046_eos, rxscan1047_done
+  rxscan1047_scan:
+    set_addr $I10, rxscan1047_loop
+    rx1046_cur."!mark_push"(0, rx1046_pos, $I10)
+  rxscan1047_done:
+  # rxanchor bol
+    eq rx1046_pos, 0, rxanchor1048_done
+    ge rx1046_pos, rx1046_eos, rx1046_fail
+    sub $I10, rx1046_pos, rx1046_off
+    dec $I10
+    is_cclass $I11, 4096, rx1046_tgt, $I10
+    unless $I11, rx1046_fail
+  rxanchor1048_done:
+  # rx literal  "%YAML"
+    add $I11, rx1046_pos, 5
+    gt $I11, rx1046_eos, rx1046_fail
+    sub $I11, rx1046_pos, rx1046_off
+    substr $S10, rx1046_tgt, $I11, 5
+    ne $S10, "%YAML", rx1046_fail
+    add rx1046_pos, 5
+  # rx enumcharlist negate=0 
+    ge rx1046_pos, rx1046_eos, rx1046_fail
+    sub $I10, rx1046_pos, rx1046_off
+    substr $S10, rx1046_tgt, $I10, 1
+    index $I11, ":", $S10
+    lt $I11, 0, rx1046_fail
+    inc rx1046_pos
+  # rx rxquantg1049 ** 0..*
+    set_addr $I10, rxquantg1049_done
+    rx1046_cur."!mark_push"(0, rx1046_pos, $I10)
+  rxquantg1049_loop:
+  # rx charclass .
+    ge rx1046_pos, rx1046_eos, rx1046_fail
+    inc rx1046_pos
+    set_addr $I10, rxquantg1049_done
+    rx1046_cur."!mark_push"(rx1046_rep, rx1046_pos, $I10)
+    goto rxquantg1049_loop
+  rxquantg1049_done:
+  # rxanchor eos
+    ne rx1046_pos, rx1046_eos, rx1046_fail
+  # rx pass
+    rx1046_cur."!cursor_pass"(rx1046_pos, "")
+    if_null rx1046_debug, debug_100
+    rx1046_cur."!cursor_debug"("PASS", "", " at pos=", rx1046_pos)
+  debug_100:
+    rx1046_cur."!cursor_backtrack"()
+    .return (rx1046_cur)
+  rx1046_restart:
+    if_null rx1046_debug, debug_101
+    rx1046_cur."!cursor_debug"("NEXT", "")
+  debug_101:
+  rx1046_fail:
+    (rx1046_rep, rx1046_pos, $I10, $P10) = rx1046_cur."!mark_fail"(0)
+    lt rx1046_pos, -1, rx1046_done
+    eq rx1046_pos, -1, rx1046_fail
+    jump $I10
+  rx1046_done:
+    rx1046_cur."!cursor_fail"()
+    if_null rx1046_debug, debug_102
+    rx1046_cur."!cursor_debug"("FAIL", "")
+  debug_102:
+    .return (rx1046_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.include "except_types.pasm"
+.sub "_block1051"  :anon :subid("19_1792415686.17671") :outer("14_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 80
+    .const 'Sub' $P1114 = "28_1792415686.17671" 
+    capture_lex $P1114
+    .const 'Sub' $P1103 = "26_1792415686.17671" 
+    capture_lex $P1103
+    .const 'Sub' $P1099 = "25_1792415686.17671" 
+    capture_lex $P1099
+    .const 'Sub' $P1093 = "24_1792415686.17671" 
+    capture_lex $P1093
+    .const 'Sub' $P1086 = "23_1792415686.17671" 
+    capture_lex $P1086
+    .const 'Sub' $P1079 = "22_1792415686.17671" 
+    capture_lex $P1079
+    .const 'Sub' $P1058 = "20_1792415686.17671" 
+    capture_lex $P1058
+.annotate 'line', 85
+    new $P105, "Undef"
+    set $P1053, $P105
+    .lex "$match", $P1053
+.annotate 'line', 116
+    new $P106, "Undef"
+    set $P1054, $P106
+    .lex "$m", $P1054
+.annotate 'line', 81
+    find_lex $P107, "@result"
+    "debug"("Current result", $P107 :flat)
+.annotate 'line', 82
+    find_lex $P1055, "@lines"
+    unless_null $P1055, vivify_105
+    $P1055 = root_new ['parrot';'ResizablePMCArray']
+  vivify_105:
+    set $P107, $P1055[0]
+    unless_null $P107, vivify_106
+    new $P107, "Undef"
+  vivify_106:
+    "debug"("Handling", $P107)
+.annotate 'line', 85
+    get_hll_global $P107, ["Regex"], "Regex"
+    .const 'Sub' $P1058 = "20_1792415686.17671" 
+    capture_lex $P1058
+    $P108 = $P107."new"($P1058)
+    find_lex $P1071, "@lines"
+    unless_null $P1071, vivify_115
+    $P1071 = root_new ['parrot';'ResizablePMCArray']
+  vivify_115:
+    set $P109, $P1071[0]
+    unless_null $P109, vivify_116
+    new $P109, "Undef"
+  vivify_116:
+    $P110 = $P108."ACCEPTS"($P109)
+    store_lex "$match", $P110
+    unless $P110, if_1056_end
+.annotate 'line', 86
+    find_lex $P111, "$match"
+    "debug"("Header", $P111)
+.annotate 'line', 88
+    find_lex $P111, "@lines"
+    $P111."shift"()
+.annotate 'line', 91
+    find_lex $P1073, "$match"
+    unless_null $P1073, vivify_117
+    $P1073 = root_new ['parrot';'ResizablePMCArray']
+  vivify_117:
+    set $P111, $P1073[0]
+    unless_null $P111, vivify_118
+    new $P111, "Undef"
+  vivify_118:
+    set $N101, $P111
+    unless $N101, if_1072_end
+.annotate 'line', 92
+    find_lex $P112, "@result"
+    find_lex $P113, "self"
+    find_lex $P1074, "$match"
+    unless_null $P1074, vivify_119
+    $P1074 = root_new ['parrot';'ResizablePMCArray']
+  vivify_119:
+    set $P1075, $P1074[0]
+    unless_null $P1075, vivify_120
+    $P1075 = root_new ['parrot';'ResizablePMCArray']
+  vivify_120:
+    set $P114, $P1075[0]
+    unless_null $P114, vivify_121
+    new $P114, "Undef"
+  vivify_121:
+    set $S100, $P114
+    get_hll_global $P115, "undef"
+    new $P116, "ResizablePMCArray"
+    push $P116, $P115
+    find_lex $P117, "@lines"
+    $P118 = $P113."_read_scalar"($S100, $P116, $P117)
+    $P112."push"($P118)
+.annotate 'line', 93
+    die 0, .CONTROL_LOOP_NEXT
+  if_1072_end:
+  if_1056_end:
+.annotate 'line', 97
+    find_lex $P107, "@lines"
+    "debug"("Lines", $P107)
+.annotate 'line', 99
+    find_lex $P109, "@lines"
+    isfalse $I101, $P109
+    unless $I101, unless_1077
+    new $P108, 'Integer'
+    set $P108, $I101
+    goto unless_1077_end
+  unless_1077:
+    get_hll_global $P110, ["Regex"], "Regex"
+    .const 'Sub' $P1079 = "22_1792415686.17671" 
+    capture_lex $P1079
+    $P111 = $P110."new"($P1079)
+    find_lex $P1083, "@lines"
+    unless_null $P1083, vivify_126
+    $P1083 = root_new ['parrot';'ResizablePMCArray']
+  vivify_126:
+    set $P112, $P1083[0]
+    unless_null $P112, vivify_127
+    new $P112, "Undef"
+  vivify_127:
+    $P113 = $P111."ACCEPTS"($P112)
+    set $P108, $P113
+  unless_1077_end:
+    if $P108, if_1076
+.annotate 'line', 108
+    get_hll_global $P116, ["Regex"], "Regex"
+    .const 'Sub' $P1093 = "24_1792415686.17671" 
+    capture_lex $P1093
+    $P117 = $P116."new"($P1093)
+    find_lex $P1097, "@lines"
+    unless_null $P1097, vivify_132
+    $P1097 = root_new ['parrot';'ResizablePMCArray']
+  vivify_132:
+    set $P118, $P1097[0]
+    unless_null $P118, vivify_133
+    new $P118, "Undef"
+  vivify_133:
+    $P119 = $P117."ACCEPTS"($P118)
+    if $P119, if_1091
+.annotate 'line', 116
+    get_hll_global $P123, ["Regex"], "Regex"
+    .const 'Sub' $P1103 = "26_1792415686.17671" 
+    capture_lex $P1103
+    $P124 = $P123."new"($P1103)
+    find_lex $P1112, "@lines"
+    unless_null $P1112, vivify_142
+    $P1112 = root_new ['parrot';'ResizablePMCArray']
+  vivify_142:
+    set $P126, $P1112[0]
+    unless_null $P126, vivify_143
+    new $P126, "Undef"
+  vivify_143:
+    $P127 = $P124."ACCEPTS"($P126)
+    store_lex "$m", $P127
+    if $P127, if_1101
+.annotate 'line', 125
+    new $P130, 'String'
+    set $P130, "YAML::Tiny failed to classify the line '"
+    find_lex $P1119, "@lines"
+    unless_null $P1119, vivify_144
+    $P1119 = root_new ['parrot';'ResizablePMCArray']
+  vivify_144:
+    set $P131, $P1119[0]
+    unless_null $P131, vivify_145
+    new $P131, "Undef"
+  vivify_145:
+    set $S100, $P131
+    concat $P132, $P130, $S100
+    concat $P133, $P132, "'"
+    die $P133
+.annotate 'line', 124
+    goto if_1101_end
+  if_1101:
+.annotate 'line', 116
+    .const 'Sub' $P1114 = "28_1792415686.17671" 
+    capture_lex $P1114
+    $P128 = $P1114()
+    set $P122, $P128
+  if_1101_end:
+    set $P115, $P122
+.annotate 'line', 108
+    goto if_1091_end
+  if_1091:
+    .const 'Sub' $P1099 = "25_1792415686.17671" 
+    capture_lex $P1099
+    $P121 = $P1099()
+    set $P115, $P121
+  if_1091_end:
+    set $P107, $P115
+.annotate 'line', 99
+    goto if_1076_end
+  if_1076:
+.annotate 'line', 100
+    find_lex $P114, "@lines"
+    "debug"("Naked", $P114)
+.annotate 'line', 102
+    find_lex $P114, "@result"
+    get_hll_global $P115, "undef"
+    $P114."push"($P115)
+.annotate 'line', 103
+    new $P120, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P120, loop1090_handler
+    push_eh $P120
+  loop1090_test:
+    find_lex $P115, "@lines"
+    if $P115, if_1084
+    set $P114, $P115
+    goto if_1084_end
+  if_1084:
+    get_hll_global $P116, ["Regex"], "Regex"
+    .const 'Sub' $P1086 = "23_1792415686.17671" 
+    capture_lex $P1086
+    $P117 = $P116."new"($P1086)
+    find_lex $P1089, "@lines"
+    unless_null $P1089, vivify_153
+    $P1089 = root_new ['parrot';'ResizablePMCArray']
+  vivify_153:
+    set $P118, $P1089[0]
+    unless_null $P118, vivify_154
+    new $P118, "Undef"
+  vivify_154:
+    $P119 = $P117."ACCEPTS"($P118)
+    isfalse $I102, $P119
+    new $P114, 'Integer'
+    set $P114, $I102
+  if_1084_end:
+    unless $P114, loop1090_done
+  loop1090_redo:
+.annotate 'line', 104
+    find_lex $P120, "@lines"
+    $P120."shift"()
+  loop1090_next:
+.annotate 'line', 103
+    goto loop1090_test
+  loop1090_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P121, exception, 'type'
+    eq $P121, .CONTROL_LOOP_NEXT, loop1090_next
+    eq $P121, .CONTROL_LOOP_REDO, loop1090_redo
+  loop1090_done:
+    pop_eh 
+.annotate 'line', 99
+    set $P107, $P114
+  if_1076_end:
+.annotate 'line', 80
+    .return ($P107)
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1057"  :anon :subid("20_1792415686.17671") :method :outer("19_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 85
+    .const 'Sub' $P1065 = "21_1792415686.17671" 
+    capture_lex $P1065
+    .local string rx1059_tgt
+    .local int rx1059_pos
+    .local int rx1059_off
+    .local int rx1059_eos
+    .local int rx1059_rep
+    .local pmc rx1059_cur
+    .local pmc rx1059_debug
+    (rx1059_cur, rx1059_pos, rx1059_tgt, $I10) = self."!cursor_start"()
+    rx1059_cur."!cursor_caparray"("0")
+    getattribute rx1059_debug, rx1059_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1059_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1059_eos, rx1059_tgt
+    gt rx1059_pos, rx1059_eos, rx1059_done
+    set rx1059_off, 0
+    lt rx1059_pos, 2, rx1059_start
+    sub rx1059_off, rx1059_pos, 1
+    substr rx1059_tgt, rx1059_tgt, rx1059_off
+  rx1059_start:
+    eq $I10, 1, rx1059_restart
+    if_null rx1059_debug, debug_107
+    rx1059_cur."!cursor_debug"("START", "")
+  debug_107:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1060_done
+    goto rxscan1060_scan
+  rxscan1060_loop:
+    ($P10) = rx1059_cur."from"()
+    inc $P10
+    set rx1059_pos, $P10
+    ge rx1059_pos, rx1059_eos, rxscan1060_done
+  rxscan1060_scan:
+    set_addr $I10, rxscan1060_loop
+    rx1059_cur."!mark_push"(0, rx1059_pos, $I10)
+  rxscan1060_done:
+  # rxanchor bol
+    eq rx1059_pos, 0, rxanchor1061_done
+    ge rx1059_pos, rx1059_eos, rx1059_fail
+    sub $I10, rx1059_pos, rx1059_off
+    dec $I10
+    is_cclass $I11, 4096, rx1059_tgt, $I10
+    unless $I11, rx1059_fail
+  rxanchor1061_done:
+  # rx literal  "---"
+    add $I11, rx1059_pos, 3
+    gt $I11, rx1059_eos, rx1059_fail
+    sub $I11, rx1059_pos, rx1059_off
+    substr $S10, rx1059_tgt, $I11, 3
+    ne $S10, "---", rx1059_fail
+    add rx1059_pos, 3
+  # rx rxquantg1062 ** 0..*
+    set_addr $I10, rxquantg1062_done
+    rx1059_cur."!mark_push"(0, rx1059_pos, $I10)
+  rxquantg1062_loop:
+  # rx charclass s
+    ge rx1059_pos, rx1059_eos, rx1059_fail
+    sub $I10, rx1059_pos, rx1059_off
+    is_cclass $I11, 32, rx1059_tgt, $I10
+    unless $I11, rx1059_fail
+    inc rx1059_pos
+    set_addr $I10, rxquantg1062_done
+    rx1059_cur."!mark_push"(rx1059_rep, rx1059_pos, $I10)
+    goto rxquantg1062_loop
+  rxquantg1062_done:
+  # rx rxquantg1063 ** 0..1
+    set_addr $I10, rxquantg1063_done
+    rx1059_cur."!mark_push"(0, rx1059_pos, $I10)
+  rxquantg1063_loop:
+  # rx subrule $P1065 subtype=capture negate=
+    rx1059_cur."!cursor_pos"(rx1059_pos)
+    .const 'Sub' $P1065 = "21_1792415686.17671" 
+    capture_lex $P1065
+    $P10 = rx1059_cur.$P1065()
+    unless $P10, rx1059_fail
+    goto rxsubrule1069_pass
+  rxsubrule1069_back:
+    $P10 = $P10."!cursor_next"()
+    unless $P10, rx1059_fail
+  rxsubrule1069_pass:
+    set_addr $I10, rxsubrule1069_back
+    rx1059_cur."!mark_push"(0, rx1059_pos, $I10, $P10)
+    $P10."!cursor_names"(0)
+    rx1059_pos = $P10."pos"()
+  # rx rxquantg1070 ** 0..*
+    set_addr $I10, rxquantg1070_done
+    rx1059_cur."!mark_push"(0, rx1059_pos, $I10)
+  rxquantg1070_loop:
+  # rx charclass s
+    ge rx1059_pos, rx1059_eos, rx1059_fail
+    sub $I10, rx1059_pos, rx1059_off
+    is_cclass $I11, 32, rx1059_tgt, $I10
+    unless $I11, rx1059_fail
+    inc rx1059_pos
+    set_addr $I10, rxquantg1070_done
+    rx1059_cur."!mark_push"(rx1059_rep, rx1059_pos, $I10)
+    goto rxquantg1070_loop
+  rxquantg1070_done:
+  rxquantg1063_done:
+  # rxanchor eos
+    ne rx1059_pos, rx1059_eos, rx1059_fail
+  # rx pass
+    rx1059_cur."!cursor_pass"(rx1059_pos, "")
+    if_null rx1059_debug, debug_112
+    rx1059_cur."!cursor_debug"("PASS", "", " at pos=", rx1059_pos)
+  debug_112:
+    rx1059_cur."!cursor_backtrack"()
+    .return (rx1059_cur)
+  rx1059_restart:
+    if_null rx1059_debug, debug_113
+    rx1059_cur."!cursor_debug"("NEXT", "")
+  debug_113:
+  rx1059_fail:
+    (rx1059_rep, rx1059_pos, $I10, $P10) = rx1059_cur."!mark_fail"(0)
+    lt rx1059_pos, -1, rx1059_done
+    eq rx1059_pos, -1, rx1059_fail
+    jump $I10
+  rx1059_done:
+    rx1059_cur."!cursor_fail"()
+    if_null rx1059_debug, debug_114
+    rx1059_cur."!cursor_debug"("FAIL", "")
+  debug_114:
+    .return (rx1059_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1064"  :anon :subid("21_1792415686.17671") :method :outer("20_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 85
+    .local string rx1066_tgt
+    .local int rx1066_pos
+    .local int rx1066_off
+    .local int rx1066_eos
+    .local int rx1066_rep
+    .local pmc rx1066_cur
+    .local pmc rx1066_debug
+    (rx1066_cur, rx1066_pos, rx1066_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1066_debug, rx1066_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1066_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1066_eos, rx1066_tgt
+    gt rx1066_pos, rx1066_eos, rx1066_done
+    set rx1066_off, 0
+    lt rx1066_pos, 2, rx1066_start
+    sub rx1066_off, rx1066_pos, 1
+    substr rx1066_tgt, rx1066_tgt, rx1066_off
+  rx1066_start:
+    eq $I10, 1, rx1066_restart
+    if_null rx1066_debug, debug_108
+    rx1066_cur."!cursor_debug"("START", "")
+  debug_108:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1067_done
+    goto rxscan1067_scan
+  rxscan1067_loop:
+    ($P10) = rx1066_cur."from"()
+    inc $P10
+    set rx1066_pos, $P10
+    ge rx1066_pos, rx1066_eos, rxscan1067_done
+  rxscan1067_scan:
+    set_addr $I10, rxscan1067_loop
+    rx1066_cur."!mark_push"(0, rx1066_pos, $I10)
+  rxscan1067_done:
+  # rx rxquantg1068 ** 1..*
+  rxquantg1068_loop:
+  # rx charclass .
+    ge rx1066_pos, rx1066_eos, rx1066_fail
+    inc rx1066_pos
+    set_addr $I10, rxquantg1068_done
+    rx1066_cur."!mark_push"(rx1066_rep, rx1066_pos, $I10)
+    goto rxquantg1068_loop
+  rxquantg1068_done:
+  # rx pass
+    rx1066_cur."!cursor_pass"(rx1066_pos, "")
+    if_null rx1066_debug, debug_109
+    rx1066_cur."!cursor_debug"("PASS", "", " at pos=", rx1066_pos)
+  debug_109:
+    rx1066_cur."!cursor_backtrack"()
+    .return (rx1066_cur)
+  rx1066_restart:
+    if_null rx1066_debug, debug_110
+    rx1066_cur."!cursor_debug"("NEXT", "")
+  debug_110:
+  rx1066_fail:
+    (rx1066_rep, rx1066_pos, $I10, $P10) = rx1066_cur."!mark_fail"(0)
+    lt rx1066_pos, -1, rx1066_done
+    eq rx1066_pos, -1, rx1066_fail
+    jump $I10
+  rx1066_done:
+    rx1066_cur."!cursor_fail"()
+    if_null rx1066_debug, debug_111
+    rx1066_cur."!cursor_debug"("FAIL", "")
+  debug_111:
+    .return (rx1066_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1078"  :anon :subid("22_1792415686.17671") :method :outer("19_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 99
+    .local string rx1080_tgt
+    .local int rx1080_pos
+    .local int rx1080_off
+    .local int rx1080_eos
+    .local int rx1080_rep
+    .local pmc rx1080_cur
+    .local pmc rx1080_debug
+    (rx1080_cur, rx1080_pos, rx1080_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1080_debug, rx1080_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1080_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1080_eos, rx1080_tgt
+    gt rx1080_pos, rx1080_eos, rx1080_done
+    set rx1080_off, 0
+    lt rx1080_pos, 2, rx1080_start
+    sub rx1080_off, rx1080_pos, 1
+    substr rx1080_tgt, rx1080_tgt, rx1080_off
+  rx1080_start:
+    eq $I10, 1, rx1080_restart
+    if_null rx1080_debug, debug_122
+    rx1080_cur."!cursor_debug"("START", "")
+  debug_122:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1081_done
+    goto rxscan1081_scan
+  rxscan1081_loop:
+    ($P10) = rx1080_cur."from"()
+    inc $P10
+    set rx1080_pos, $P10
+    ge rx1080_pos, rx1080_eos, rxscan1081_done
+  rxscan1081_scan:
+    set_addr $I10, rxscan1081_loop
+    rx1080_cur."!mark_push"(0, rx1080_pos, $I10)
+  rxscan1081_done:
+  # rxanchor bos
+    ne rx1080_pos, 0, rx1080_fail
+  alt1082_0:
+    set_addr $I10, alt1082_1
+    rx1080_cur."!mark_push"(0, rx1080_pos, $I10)
+  # rx literal  "---"
+    add $I11, rx1080_pos, 3
+    gt $I11, rx1080_eos, rx1080_fail
+    sub $I11, rx1080_pos, rx1080_off
+    substr $S10, rx1080_tgt, $I11, 3
+    ne $S10, "---", rx1080_fail
+    add rx1080_pos, 3
+    goto alt1082_end
+  alt1082_1:
+  # rx literal  "..."
+    add $I11, rx1080_pos, 3
+    gt $I11, rx1080_eos, rx1080_fail
+    sub $I11, rx1080_pos, rx1080_off
+    substr $S10, rx1080_tgt, $I11, 3
+    ne $S10, "...", rx1080_fail
+    add rx1080_pos, 3
+  alt1082_end:
+  # rx pass
+    rx1080_cur."!cursor_pass"(rx1080_pos, "")
+    if_null rx1080_debug, debug_123
+    rx1080_cur."!cursor_debug"("PASS", "", " at pos=", rx1080_pos)
+  debug_123:
+    rx1080_cur."!cursor_backtrack"()
+    .return (rx1080_cur)
+  rx1080_restart:
+    if_null rx1080_debug, debug_124
+    rx1080_cur."!cursor_debug"("NEXT", "")
+  debug_124:
+  rx1080_fail:
+    (rx1080_rep, rx1080_pos, $I10, $P10) = rx1080_cur."!mark_fail"(0)
+    lt rx1080_pos, -1, rx1080_done
+    eq rx1080_pos, -1, rx1080_fail
+    jump $I10
+  rx1080_done:
+    rx1080_cur."!cursor_fail"()
+    if_null rx1080_debug, debug_125
+    rx1080_cur."!cursor_debug"("FAIL", "")
+  debug_125:
+    .return (rx1080_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1092"  :anon :subid("24_1792415686.17671") :method :outer("19_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 108
+    .local string rx1094_tgt
+    .local int rx1094_pos
+    .local int rx1094_off
+    .local int rx1094_eos
+    .local int rx1094_rep
+    .local pmc rx1094_cur
+    .local pmc rx1094_debug
+    (rx1094_cur, rx1094_pos, rx1094_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1094_debug, rx1094_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1094_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1094_eos, rx1094_tgt
+    gt rx1094_pos, rx1094_eos, rx1094_done
+    set rx1094_off, 0
+    lt rx1094_pos, 2, rx1094_start
+    sub rx1094_off, rx1094_pos, 1
+    substr rx1094_tgt, rx1094_tgt, rx1094_off
+  rx1094_start:
+    eq $I10, 1, rx1094_restart
+    if_null rx1094_debug, debug_128
+    rx1094_cur."!cursor_debug"("START", "")
+  debug_128:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1095_done
+    goto rxscan1095_scan
+  rxscan1095_loop:
+    ($P10) = rx1094_cur."from"()
+    inc $P10
+    set rx1094_pos, $P10
+    ge rx1094_pos, rx1094_eos, rxscan1095_done
+  rxscan1095_scan:
+    set_addr $I10, rxscan1095_loop
+    rx1094_cur."!mark_push"(0, rx1094_pos, $I10)
+  rxscan1095_done:
+  # rxanchor bos
+    ne rx1094_pos, 0, rx1094_fail
+  # rx rxquantg1096 ** 0..*
+    set_addr $I10, rxquantg1096_done
+    rx1094_cur."!mark_push"(0, rx1094_pos, $I10)
+  rxquantg1096_loop:
+  # rx charclass s
+    ge rx1094_pos, rx1094_eos, rx1094_fail
+    sub $I10, rx1094_pos, rx1094_off
+    is_cclass $I11, 32, rx1094_tgt, $I10
+    unless $I11, rx1094_fail
+    inc rx1094_pos
+    set_addr $I10, rxquantg1096_done
+    rx1094_cur."!mark_push"(rx1094_rep, rx1094_pos, $I10)
+    goto rxquantg1096_loop
+  rxquantg1096_done:
+  # rx literal  "-"
+    add $I11, rx1094_pos, 1
+    gt $I11, rx1094_eos, rx1094_fail
+    sub $I11, rx1094_pos, rx1094_off
+    ord $I11, rx1094_tgt, $I11
+    ne $I11, 45, rx1094_fail
+    add rx1094_pos, 1
+  # rx pass
+    rx1094_cur."!cursor_pass"(rx1094_pos, "")
+    if_null rx1094_debug, debug_129
+    rx1094_cur."!cursor_debug"("PASS", "", " at pos=", rx1094_pos)
+  debug_129:
+    rx1094_cur."!cursor_backtrack"()
+    .return (rx1094_cur)
+  rx1094_restart:
+    if_null rx1094_debug, debug_130
+    rx1094_cur."!cursor_debug"("NEXT", "")
+  debug_130:
+  rx1094_fail:
+    (rx1094_rep, rx1094_pos, $I10, $P10) = rx1094_cur."!mark_fail"(0)
+    lt rx1094_pos, -1, rx1094_done
+    eq rx1094_pos, -1, rx1094_fail
+    jump $I10
+  rx1094_done:
+    rx1094_cur."!cursor_fail"()
+    if_null rx1094_debug, debug_131
+    rx1094_cur."!cursor_debug"("FAIL", "")
+  debug_131:
+    .return (rx1094_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1102"  :anon :subid("26_1792415686.17671") :method :outer("19_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 116
+    .const 'Sub' $P1107 = "27_1792415686.17671" 
+    capture_lex $P1107
+    .local string rx1104_tgt
+    .local int rx1104_pos
+    .local int rx1104_off
+    .local int rx1104_eos
+    .local int rx1104_rep
+    .local pmc rx1104_cur
+    .local pmc rx1104_debug
+    (rx1104_cur, rx1104_pos, rx1104_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1104_debug, rx1104_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1104_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1104_eos, rx1104_tgt
+    gt rx1104_pos, rx1104_eos, rx1104_done
+    set rx1104_off, 0
+    lt rx1104_pos, 2, rx1104_start
+    sub rx1104_off, rx1104_pos, 1
+    substr rx1104_tgt, rx1104_tgt, rx1104_off
+  rx1104_start:
+    eq $I10, 1, rx1104_restart
+    if_null rx1104_debug, debug_134
+    rx1104_cur."!cursor_debug"("START", "")
+  debug_134:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1105_done
+    goto rxscan1105_scan
+  rxscan1105_loop:
+    ($P10) = rx1104_cur."from"()
+    inc $P10
+    set rx1104_pos, $P10
+    ge rx1104_pos, rx1104_eos, rxscan1105_done
+  rxscan1105_scan:
+    set_addr $I10, rxscan1105_loop
+    rx1104_cur."!mark_push"(0, rx1104_pos, $I10)
+  rxscan1105_done:
+  # rxanchor bos
+    ne rx1104_pos, 0, rx1104_fail
+  # rx subrule $P1107 subtype=capture negate=
+    rx1104_cur."!cursor_pos"(rx1104_pos)
+    .const 'Sub' $P1107 = "27_1792415686.17671" 
+    capture_lex $P1107
+    $P10 = rx1104_cur.$P1107()
+    unless $P10, rx1104_fail
+    goto rxsubrule1111_pass
+  rxsubrule1111_back:
+    $P10 = $P10."!cursor_next"()
+    unless $P10, rx1104_fail
+  rxsubrule1111_pass:
+    set_addr $I10, rxsubrule1111_back
+    rx1104_cur."!mark_push"(0, rx1104_pos, $I10, $P10)
+    $P10."!cursor_names"(0)
+    rx1104_pos = $P10."pos"()
+  # rx charclass S
+    ge rx1104_pos, rx1104_eos, rx1104_fail
+    sub $I10, rx1104_pos, rx1104_off
+    is_cclass $I11, 32, rx1104_tgt, $I10
+    if $I11, rx1104_fail
+    inc rx1104_pos
+  # rx pass
+    rx1104_cur."!cursor_pass"(rx1104_pos, "")
+    if_null rx1104_debug, debug_139
+    rx1104_cur."!cursor_debug"("PASS", "", " at pos=", rx1104_pos)
+  debug_139:
+    rx1104_cur."!cursor_backtrack"()
+    .return (rx1104_cur)
+  rx1104_restart:
+    if_null rx1104_debug, debug_140
+    rx1104_cur."!cursor_debug"("NEXT", "")
+  debug_140:
+  rx1104_fail:
+    (rx1104_rep, rx1104_pos, $I10, $P10) = rx1104_cur."!mark_fail"(0)
+    lt rx1104_pos, -1, rx1104_done
+    eq rx1104_pos, -1, rx1104_fail
+    jump $I10
+  rx1104_done:
+    rx1104_cur."!cursor_fail"()
+    if_null rx1104_debug, debug_141
+    rx1104_cur."!cursor_debug"("FAIL", "")
+  debug_141:
+    .return (rx1104_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1106"  :anon :subid("27_1792415686.17671") :method :outer("26_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 116
+    .local string rx1108_tgt
+    .local int rx1108_pos
+    .local int rx1108_off
+    .local int rx1108_eos
+    .local int rx1108_rep
+    .local pmc rx1108_cur
+    .local pmc rx1108_debug
+    (rx1108_cur, rx1108_pos, rx1108_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1108_debug, rx1108_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1108_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1108_eos, rx1108_tgt
+    gt rx1108_pos, rx1108_eos, rx1108_done
+    set rx1108_off, 0
+    lt rx1108_pos, 2, rx1108_start
+    sub rx1108_off, rx1108_pos, 1
+    substr rx1108_tgt, rx1108_tgt, rx1108_off
+  rx1108_start:
+    eq $I10, 1, rx1108_restart
+    if_null rx1108_debug, debug_135
+    rx1108_cur."!cursor_debug"("START", "")
+  debug_135:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1109_done
+    goto rxscan1109_scan
+  rxscan1109_loop:
+    ($P10) = rx1108_cur."from"()
+    inc $P10
+    set rx1108_pos, $P10
+    ge rx1108_pos, rx1108_eos, rxscan1109_done
+  rxscan1109_scan:
+    set_addr $I10, rxscan1109_loop
+    rx1108_cur."!mark_push"(0, rx1108_pos, $I10)
+  rxscan1109_done:
+  # rx rxquantg1110 ** 0..*
+    set_addr $I10, rxquantg1110_done
+    rx1108_cur."!mark_push"(0, rx1108_pos, $I10)
+  rxquantg1110_loop:
+  # rx charclass s
+    ge rx1108_pos, rx1108_eos, rx1108_fail
+    sub $I10, rx1108_pos, rx1108_off
+    is_cclass $I11, 32, rx1108_tgt, $I10
+    unless $I11, rx1108_fail
+    inc rx1108_pos
+    set_addr $I10, rxquantg1110_done
+    rx1108_cur."!mark_push"(rx1108_rep, rx1108_pos, $I10)
+    goto rxquantg1110_loop
+  rxquantg1110_done:
+  # rx pass
+    rx1108_cur."!cursor_pass"(rx1108_pos, "")
+    if_null rx1108_debug, debug_136
+    rx1108_cur."!cursor_debug"("PASS", "", " at pos=", rx1108_pos)
+  debug_136:
+    rx1108_cur."!cursor_backtrack"()
+    .return (rx1108_cur)
+  rx1108_restart:
+    if_null rx1108_debug, debug_137
+    rx1108_cur."!cursor_debug"("NEXT", "")
+  debug_137:
+  rx1108_fail:
+    (rx1108_rep, rx1108_pos, $I10, $P10) = rx1108_cur."!mark_fail"(0)
+    lt rx1108_pos, -1, rx1108_done
+    eq rx1108_pos, -1, rx1108_fail
+    jump $I10
+  rx1108_done:
+    rx1108_cur."!cursor_fail"()
+    if_null rx1108_debug, debug_138
+    rx1108_cur."!cursor_debug"("FAIL", "")
+  debug_138:
+    .return (rx1108_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1113"  :anon :subid("28_1792415686.17671") :outer("19_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 119
+    $P1116 = root_new ['parrot';'Hash']
+    set $P1115, $P1116
+    .lex "%document", $P1115
+.annotate 'line', 117
+    find_lex $P128, "$match"
+    "debug"("Hash", $P128)
+.annotate 'line', 116
+    find_lex $P128, "%document"
+.annotate 'line', 120
+    find_lex $P128, "@result"
+    find_lex $P129, "%document"
+    $P128."push"($P129)
+.annotate 'line', 121
+    find_lex $P128, "self"
+    find_lex $P129, "%document"
+    find_lex $P1117, "$m"
+    unless_null $P1117, vivify_146
+    $P1117 = root_new ['parrot';'ResizablePMCArray']
+  vivify_146:
+    set $P1118, $P1117[0]
+    unless_null $P1118, vivify_147
+    $P1118 = root_new ['parrot';'ResizablePMCArray']
+  vivify_147:
+    set $P130, $P1118[0]
+    unless_null $P130, vivify_148
+    new $P130, "Undef"
+  vivify_148:
+    $P131 = "length"($P130)
+    new $P132, "ResizablePMCArray"
+    push $P132, $P131
+    find_lex $P133, "@lines"
+    $P128."_read_hash"($P129, $P132, $P133)
+.annotate 'line', 122
+    find_lex $P128, "%document"
+    $P129 = "debug"("Got hash", $P128)
+.annotate 'line', 116
+    .return ($P129)
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1098"  :anon :subid("25_1792415686.17671") :outer("19_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 111
+    new $P120, "Undef"
+    set $P1100, $P120
+    .lex "$document", $P1100
+.annotate 'line', 109
+    find_lex $P121, "$match"
+    "debug"("Array", $P121)
+.annotate 'line', 111
+    new $P121, "ResizablePMCArray"
+    store_lex "$document", $P121
+.annotate 'line', 112
+    find_lex $P121, "@result"
+    find_lex $P122, "$document"
+    $P121."push"($P122)
+.annotate 'line', 113
+    find_lex $P121, "self"
+    find_lex $P122, "$document"
+    new $P123, "ResizablePMCArray"
+    push $P123, 0
+    find_lex $P124, "@lines"
+    $P125 = $P121."_read_array"($P122, $P123, $P124)
+.annotate 'line', 108
+    .return ($P125)
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1085"  :anon :subid("23_1792415686.17671") :method :outer("19_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 103
+    .local string rx1087_tgt
+    .local int rx1087_pos
+    .local int rx1087_off
+    .local int rx1087_eos
+    .local int rx1087_rep
+    .local pmc rx1087_cur
+    .local pmc rx1087_debug
+    (rx1087_cur, rx1087_pos, rx1087_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1087_debug, rx1087_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1087_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1087_eos, rx1087_tgt
+    gt rx1087_pos, rx1087_eos, rx1087_done
+    set rx1087_off, 0
+    lt rx1087_pos, 2, rx1087_start
+    sub rx1087_off, rx1087_pos, 1
+    substr rx1087_tgt, rx1087_tgt, rx1087_off
+  rx1087_start:
+    eq $I10, 1, rx1087_restart
+    if_null rx1087_debug, debug_149
+    rx1087_cur."!cursor_debug"("START", "")
+  debug_149:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1088_done
+    goto rxscan1088_scan
+  rxscan1088_loop:
+    ($P10) = rx1087_cur."from"()
+    inc $P10
+    set rx1087_pos, $P10
+    ge rx1087_pos, rx1087_eos, rxscan1088_done
+  rxscan1088_scan:
+    set_addr $I10, rxscan1088_loop
+    rx1087_cur."!mark_push"(0, rx1087_pos, $I10)
+  rxscan1088_done:
+  # rxanchor bos
+    ne rx1087_pos, 0, rx1087_fail
+  # rx literal  "---"
+    add $I11, rx1087_pos, 3
+    gt $I11, rx1087_eos, rx1087_fail
+    sub $I11, rx1087_pos, rx1087_off
+    substr $S10, rx1087_tgt, $I11, 3
+    ne $S10, "---", rx1087_fail
+    add rx1087_pos, 3
+  # rx pass
+    rx1087_cur."!cursor_pass"(rx1087_pos, "")
+    if_null rx1087_debug, debug_150
+    rx1087_cur."!cursor_debug"("PASS", "", " at pos=", rx1087_pos)
+  debug_150:
+    rx1087_cur."!cursor_backtrack"()
+    .return (rx1087_cur)
+  rx1087_restart:
+    if_null rx1087_debug, debug_151
+    rx1087_cur."!cursor_debug"("NEXT", "")
+  debug_151:
+  rx1087_fail:
+    (rx1087_rep, rx1087_pos, $I10, $P10) = rx1087_cur."!mark_fail"(0)
+    lt rx1087_pos, -1, rx1087_done
+    eq rx1087_pos, -1, rx1087_fail
+    jump $I10
+  rx1087_done:
+    rx1087_cur."!cursor_fail"()
+    if_null rx1087_debug, debug_152
+    rx1087_cur."!cursor_debug"("FAIL", "")
+  debug_152:
+    .return (rx1087_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.include "except_types.pasm"
+.sub "_read_scalar"  :subid("29_1792415686.17671") :method :outer("11_1792415686.17671")
+    .param pmc param_1124
+    .param pmc param_1125
+    .param pmc param_1126
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 143
+    .const 'Sub' $P1208 = "42_1792415686.17671" 
+    capture_lex $P1208
+    .const 'Sub' $P1203 = "41_1792415686.17671" 
+    capture_lex $P1203
+    .const 'Sub' $P1195 = "40_1792415686.17671" 
+    capture_lex $P1195
+    .const 'Sub' $P1184 = "38_1792415686.17671" 
+    capture_lex $P1184
+    .const 'Sub' $P1179 = "37_1792415686.17671" 
+    capture_lex $P1179
+    .const 'Sub' $P1174 = "36_1792415686.17671" 
+    capture_lex $P1174
+    .const 'Sub' $P1159 = "34_1792415686.17671" 
+    capture_lex $P1159
+    .const 'Sub' $P1154 = "33_1792415686.17671" 
+    capture_lex $P1154
+    .const 'Sub' $P1136 = "31_1792415686.17671" 
+    capture_lex $P1136
+    .const 'Sub' $P1130 = "30_1792415686.17671" 
+    capture_lex $P1130
+    new $P1123, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1123, control_1122
+    push_eh $P1123
+    .lex "self", self
+    .lex "$string", param_1124
+    .lex "$indent", param_1125
+    .lex "@lines", param_1126
+.annotate 'line', 152
+    new $P104, "Undef"
+    set $P1127, $P104
+    .lex "$match", $P1127
+.annotate 'line', 165
+    new $P105, "Undef"
+    set $P1128, $P105
+    .lex "$m", $P1128
+.annotate 'line', 144
+    find_lex $P106, "$string"
+    "debug"("_read_scalar", $P106)
+.annotate 'line', 146
+    find_lex $P106, "$string"
+    get_hll_global $P107, ["Regex"], "Regex"
+    .const 'Sub' $P1130 = "30_1792415686.17671" 
+    capture_lex $P1130
+    $P108 = $P107."new"($P1130)
+    $P109 = "subst"($P106, $P108, "")
+    store_lex "$string", $P109
+.annotate 'line', 149
+    find_lex $P106, "$string"
+    set $S100, $P106
+    iseq $I101, $S100, "~"
+    unless $I101, if_1134_end
+    new $P107, "Exception"
+    set $P107['type'], .CONTROL_RETURN
+    get_hll_global $P108, "undef"
+    setattribute $P107, 'payload', $P108
+    throw $P107
+  if_1134_end:
+.annotate 'line', 152
+    get_hll_global $P106, ["Regex"], "Regex"
+    .const 'Sub' $P1136 = "31_1792415686.17671" 
+    capture_lex $P1136
+    $P107 = $P106."new"($P1136)
+    find_lex $P108, "$string"
+    $P109 = $P107."ACCEPTS"($P108)
+    store_lex "$match", $P109
+.annotate 'line', 153
+    find_lex $P106, "$match"
+    unless $P106, if_1149_end
+.annotate 'line', 154
+    find_lex $P107, "$match"
+    "debug"("Match", $P107)
+.annotate 'line', 155
+    find_lex $P1151, "$match"
+    unless_null $P1151, vivify_167
+    $P1151 = root_new ['parrot';'ResizablePMCArray']
+  vivify_167:
+    set $P107, $P1151[0]
+    unless_null $P107, vivify_168
+    new $P107, "Undef"
+  vivify_168:
+    defined $I101, $P107
+    if $I101, unless_1150_end
+    new $P108, "Exception"
+    set $P108['type'], .CONTROL_RETURN
+    new $P109, "String"
+    assign $P109, ""
+    setattribute $P108, 'payload', $P109
+    throw $P108
+  unless_1150_end:
+.annotate 'line', 156
+    find_lex $P1152, "$match"
+    unless_null $P1152, vivify_169
+    $P1152 = root_new ['parrot';'ResizablePMCArray']
+  vivify_169:
+    set $P107, $P1152[0]
+    unless_null $P107, vivify_170
+    new $P107, "Undef"
+  vivify_170:
+    set $S100, $P107
+    new $P108, 'String'
+    set $P108, $S100
+    store_lex "$string", $P108
+.annotate 'line', 157
+    find_lex $P107, "$string"
+    get_hll_global $P108, ["Regex"], "Regex"
+    .const 'Sub' $P1154 = "33_1792415686.17671" 
+    capture_lex $P1154
+    $P109 = $P108."new"($P1154)
+    $P110 = "subst"($P107, $P109, "'", "1" :named("global"))
+    store_lex "$string", $P110
+.annotate 'line', 158
+    new $P107, "Exception"
+    set $P107['type'], .CONTROL_RETURN
+    find_lex $P108, "$string"
+    setattribute $P107, 'payload', $P108
+    throw $P107
+  if_1149_end:
+.annotate 'line', 165
+    get_hll_global $P106, ["Regex"], "Regex"
+    .const 'Sub' $P1159 = "34_1792415686.17671" 
+    capture_lex $P1159
+    $P107 = $P106."new"($P1159)
+    find_lex $P108, "$string"
+    $P109 = $P107."ACCEPTS"($P108)
+    store_lex "$m", $P109
+    unless $P109, if_1157_end
+.annotate 'line', 169
+    find_lex $P110, "$m"
+    "debug"("Double match", $P110)
+.annotate 'line', 170
+    find_lex $P1172, "$m"
+    unless_null $P1172, vivify_183
+    $P1172 = root_new ['parrot';'ResizablePMCArray']
+  vivify_183:
+    set $P110, $P1172[0]
+    unless_null $P110, vivify_184
+    new $P110, "Undef"
+  vivify_184:
+    set $S100, $P110
+    new $P111, 'String'
+    set $P111, $S100
+    store_lex "$string", $P111
+.annotate 'line', 171
+    find_lex $P110, "$string"
+    get_hll_global $P111, ["Regex"], "Regex"
+    .const 'Sub' $P1174 = "36_1792415686.17671" 
+    capture_lex $P1174
+    $P112 = $P111."new"($P1174)
+    $P113 = "subst"($P110, $P112, "\"", "1" :named("global"))
+    store_lex "$string", $P113
+.annotate 'line', 173
+    new $P110, "Exception"
+    set $P110['type'], .CONTROL_RETURN
+    find_lex $P111, "$string"
+    setattribute $P110, 'payload', $P111
+    throw $P110
+  if_1157_end:
+.annotate 'line', 177
+    get_hll_global $P106, ["Regex"], "Regex"
+    .const 'Sub' $P1179 = "37_1792415686.17671" 
+    capture_lex $P1179
+    $P107 = $P106."new"($P1179)
+    find_lex $P108, "$string"
+    $P109 = $P107."ACCEPTS"($P108)
+    unless $P109, if_1177_end
+.annotate 'line', 178
+    new $P110, 'String'
+    set $P110, "YAML::Tiny does not support a feature in line '"
+    find_lex $P111, "$string"
+    concat $P112, $P110, $P111
+    concat $P113, $P112, "'"
+    die $P113
+  if_1177_end:
+.annotate 'line', 180
+    get_hll_global $P106, ["Regex"], "Regex"
+    .const 'Sub' $P1184 = "38_1792415686.17671" 
+    capture_lex $P1184
+    $P110 = $P106."new"($P1184)
+    find_lex $P111, "$string"
+    $P112 = $P110."ACCEPTS"($P111)
+    unless $P112, if_1182_end
+    new $P113, "Exception"
+    set $P113['type'], .CONTROL_RETURN
+    $P1192 = root_new ['parrot';'Hash']
+    setattribute $P113, 'payload', $P1192
+    throw $P113
+  if_1182_end:
+.annotate 'line', 181
+    get_hll_global $P106, ["Regex"], "Regex"
+    .const 'Sub' $P1195 = "40_1792415686.17671" 
+    capture_lex $P1195
+    $P107 = $P106."new"($P1195)
+    find_lex $P108, "$string"
+    $P109 = $P107."ACCEPTS"($P108)
+    unless $P109, if_1193_end
+    new $P110, "Exception"
+    set $P110['type'], .CONTROL_RETURN
+    new $P111, "ResizablePMCArray"
+    setattribute $P110, 'payload', $P111
+    throw $P110
+  if_1193_end:
+.annotate 'line', 184
+    get_hll_global $P106, ["Regex"], "Regex"
+    .const 'Sub' $P1203 = "41_1792415686.17671" 
+    capture_lex $P1203
+    $P107 = $P106."new"($P1203)
+    find_lex $P108, "$string"
+    $P109 = $P107."ACCEPTS"($P108)
+    isfalse $I101, $P109
+    unless $I101, if_1201_end
+.annotate 'line', 192
+    find_lex $P110, "$string"
+    get_hll_global $P111, ["Regex"], "Regex"
+    .const 'Sub' $P1208 = "42_1792415686.17671" 
+    capture_lex $P1208
+    $P112 = $P111."new"($P1208)
+    $P113 = "subst"($P110, $P112, "")
+    store_lex "$string", $P113
+.annotate 'line', 193
+    new $P110, "Exception"
+    set $P110['type'], .CONTROL_RETURN
+    find_lex $P111, "$string"
+    setattribute $P110, 'payload', $P111
+    throw $P110
+  if_1201_end:
+.annotate 'line', 218
+    new $P106, 'String'
+    set $P106, "_read_scalar not implemented for '"
+    find_lex $P107, "$string"
+    set $S100, $P107
+    concat $P108, $P106, $S100
+    concat $P109, $P108, "' string"
+    die $P109
+.annotate 'line', 143
+    .return ()
+  control_1122:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P106, exception, "payload"
+    .return ($P106)
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1129"  :anon :subid("30_1792415686.17671") :method :outer("29_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 146
+    .local string rx1131_tgt
+    .local int rx1131_pos
+    .local int rx1131_off
+    .local int rx1131_eos
+    .local int rx1131_rep
+    .local pmc rx1131_cur
+    .local pmc rx1131_debug
+    (rx1131_cur, rx1131_pos, rx1131_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1131_debug, rx1131_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1131_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1131_eos, rx1131_tgt
+    gt rx1131_pos, rx1131_eos, rx1131_done
+    set rx1131_off, 0
+    lt rx1131_pos, 2, rx1131_start
+    sub rx1131_off, rx1131_pos, 1
+    substr rx1131_tgt, rx1131_tgt, rx1131_off
+  rx1131_start:
+    eq $I10, 1, rx1131_restart
+    if_null rx1131_debug, debug_155
+    rx1131_cur."!cursor_debug"("START", "")
+  debug_155:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1132_done
+    goto rxscan1132_scan
+  rxscan1132_loop:
+    ($P10) = rx1131_cur."from"()
+    inc $P10
+    set rx1131_pos, $P10
+    ge rx1131_pos, rx1131_eos, rxscan1132_done
+  rxscan1132_scan:
+    set_addr $I10, rxscan1132_loop
+    rx1131_cur."!mark_push"(0, rx1131_pos, $I10)
+  rxscan1132_done:
+  # rx rxquantg1133 ** 0..*
+    set_addr $I10, rxquantg1133_done
+    rx1131_cur."!mark_push"(0, rx1131_pos, $I10)
+  rxquantg1133_loop:
+  # rx charclass s
+    ge rx1131_pos, rx1131_eos, rx1131_fail
+    sub $I10, rx1131_pos, rx1131_off
+    is_cclass $I11, 32, rx1131_tgt, $I10
+    unless $I11, rx1131_fail
+    inc rx1131_pos
+    set_addr $I10, rxquantg1133_done
+    rx1131_cur."!mark_push"(rx1131_rep, rx1131_pos, $I10)
+    goto rxquantg1133_loop
+  rxquantg1133_done:
+  # rxanchor eos
+    ne rx1131_pos, rx1131_eos, rx1131_fail
+  # rx pass
+    rx1131_cur."!cursor_pass"(rx1131_pos, "")
+    if_null rx1131_debug, debug_156
+    rx1131_cur."!cursor_debug"("PASS", "", " at pos=", rx1131_pos)
+  debug_156:
+    rx1131_cur."!cursor_backtrack"()
+    .return (rx1131_cur)
+  rx1131_restart:
+    if_null rx1131_debug, debug_157
+    rx1131_cur."!cursor_debug"("NEXT", "")
+  debug_157:
+  rx1131_fail:
+    (rx1131_rep, rx1131_pos, $I10, $P10) = rx1131_cur."!mark_fail"(0)
+    lt rx1131_pos, -1, rx1131_done
+    eq rx1131_pos, -1, rx1131_fail
+    jump $I10
+  rx1131_done:
+    rx1131_cur."!cursor_fail"()
+    if_null rx1131_debug, debug_158
+    rx1131_cur."!cursor_debug"("FAIL", "")
+  debug_158:
+    .return (rx1131_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1135"  :anon :subid("31_1792415686.17671") :method :outer("29_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 152
+    .const 'Sub' $P1140 = "32_1792415686.17671" 
+    capture_lex $P1140
+    .local string rx1137_tgt
+    .local int rx1137_pos
+    .local int rx1137_off
+    .local int rx1137_eos
+    .local int rx1137_rep
+    .local pmc rx1137_cur
+    .local pmc rx1137_debug
+    (rx1137_cur, rx1137_pos, rx1137_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1137_debug, rx1137_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1137_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1137_eos, rx1137_tgt
+    gt rx1137_pos, rx1137_eos, rx1137_done
+    set rx1137_off, 0
+    lt rx1137_pos, 2, rx1137_start
+    sub rx1137_off, rx1137_pos, 1
+    substr rx1137_tgt, rx1137_tgt, rx1137_off
+  rx1137_start:
+    eq $I10, 1, rx1137_restart
+    if_null rx1137_debug, debug_159
+    rx1137_cur."!cursor_debug"("START", "")
+  debug_159:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1138_done
+    goto rxscan1138_scan
+  rxscan1138_loop:
+    ($P10) = rx1137_cur."from"()
+    inc $P10
+    set rx1137_pos, $P10
+    ge rx1137_pos, rx1137_eos, rxscan1138_done
+  rxscan1138_scan:
+    set_addr $I10, rxscan1138_loop
+    rx1137_cur."!mark_push"(0, rx1137_pos, $I10)
+  rxscan1138_done:
+  # rxanchor bos
+    ne rx1137_pos, 0, rx1137_fail
+  # rx literal  "'"
+    add $I11, rx1137_pos, 1
+    gt $I11, rx1137_eos, rx1137_fail
+    sub $I11, rx1137_pos, rx1137_off
+    ord $I11, rx1137_tgt, $I11
+    ne $I11, 39, rx1137_fail
+    add rx1137_pos, 1
+  # rx subrule $P1140 subtype=capture negate=
+    rx1137_cur."!cursor_pos"(rx1137_pos)
+    .const 'Sub' $P1140 = "32_1792415686.17671" 
+    capture_lex $P1140
+    $P10 = rx1137_cur.$P1140()
+    unless $P10, rx1137_fail
+    goto rxsubrule1145_pass
+  rxsubrule1145_back:
+    $P10 = $P10."!cursor_next"()
+    unless $P10, rx1137_fail
+  rxsubrule1145_pass:
+    set_addr $I10, rxsubrule1145_back
+    rx1137_cur."!mark_push"(0, rx1137_pos, $I10, $P10)
+    $P10."!cursor_names"(0)
+    rx1137_pos = $P10."pos"()
+  # rx literal  "'"
+    add $I11, rx1137_pos, 1
+    gt $I11, rx1137_eos, rx1137_fail
+    sub $I11, rx1137_pos, rx1137_off
+    ord $I11, rx1137_tgt, $I11
+    ne $I11, 39, rx1137_fail
+    add rx1137_pos, 1
+  # rx rxquantg1146 ** 0..1
+    set_addr $I10, rxquantg1146_done
+    rx1137_cur."!mark_push"(0, rx1137_pos, $I10)
+  rxquantg1146_loop:
+  # rx rxquantg1147 ** 1..*
+  rxquantg1147_loop:
+  # rx charclass s
+    ge rx1137_pos, rx1137_eos, rx1137_fail
+    sub $I10, rx1137_pos, rx1137_off
+    is_cclass $I11, 32, rx1137_tgt, $I10
+    unless $I11, rx1137_fail
+    inc rx1137_pos
+    set_addr $I10, rxquantg1147_done
+    rx1137_cur."!mark_push"(rx1137_rep, rx1137_pos, $I10)
+    goto rxquantg1147_loop
+  rxquantg1147_done:
+  # rx literal  "#"
+    add $I11, rx1137_pos, 1
+    gt $I11, rx1137_eos, rx1137_fail
+    sub $I11, rx1137_pos, rx1137_off
+    ord $I11, rx1137_tgt, $I11
+    ne $I11, 35, rx1137_fail
+    add rx1137_pos, 1
+  # rx rxquantg1148 ** 0..*
+    set_addr $I10, rxquantg1148_done
+    rx1137_cur."!mark_push"(0, rx1137_pos, $I10)
+  rxquantg1148_loop:
+  # rx charclass .
+    ge rx1137_pos, rx1137_eos, rx1137_fail
+    inc rx1137_pos
+    set_addr $I10, rxquantg1148_done
+    rx1137_cur."!mark_push"(rx1137_rep, rx1137_pos, $I10)
+    goto rxquantg1148_loop
+  rxquantg1148_done:
+  rxquantg1146_done:
+  # rxanchor eos
+    ne rx1137_pos, rx1137_eos, rx1137_fail
+  # rx pass
+    rx1137_cur."!cursor_pass"(rx1137_pos, "")
+    if_null rx1137_debug, debug_164
+    rx1137_cur."!cursor_debug"("PASS", "", " at pos=", rx1137_pos)
+  debug_164:
+    rx1137_cur."!cursor_backtrack"()
+    .return (rx1137_cur)
+  rx1137_restart:
+    if_null rx1137_debug, debug_165
+    rx1137_cur."!cursor_debug"("NEXT", "")
+  debug_165:
+  rx1137_fail:
+    (rx1137_rep, rx1137_pos, $I10, $P10) = rx1137_cur."!mark_fail"(0)
+    lt rx1137_pos, -1, rx1137_done
+    eq rx1137_pos, -1, rx1137_fail
+    jump $I10
+  rx1137_done:
+    rx1137_cur."!cursor_fail"()
+    if_null rx1137_debug, debug_166
+    rx1137_cur."!cursor_debug"("FAIL", "")
+  debug_166:
+    .return (rx1137_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1139"  :anon :subid("32_1792415686.17671") :method :outer("31_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 152
+    .local string rx1141_tgt
+    .local int rx1141_pos
+    .local int rx1141_off
+    .local int rx1141_eos
+    .local int rx1141_rep
+    .local pmc rx1141_cur
+    .local pmc rx1141_debug
+    (rx1141_cur, rx1141_pos, rx1141_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1141_debug, rx1141_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1141_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1141_eos, rx1141_tgt
+    gt rx1141_pos, rx1141_eos, rx1141_done
+    set rx1141_off, 0
+    lt rx1141_pos, 2, rx1141_start
+    sub rx1141_off, rx1141_pos, 1
+    substr rx1141_tgt, rx1141_tgt, rx1141_off
+  rx1141_start:
+    eq $I10, 1, rx1141_restart
+    if_null rx1141_debug, debug_160
+    rx1141_cur."!cursor_debug"("START", "")
+  debug_160:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1142_done
+    goto rxscan1142_scan
+  rxscan1142_loop:
+    ($P10) = rx1141_cur."from"()
+    inc $P10
+    set rx1141_pos, $P10
+    ge rx1141_pos, rx1141_eos, rxscan1142_done
+  rxscan1142_scan:
+    set_addr $I10, rxscan1142_loop
+    rx1141_cur."!mark_push"(0, rx1141_pos, $I10)
+  rxscan1142_done:
+  # rx rxquantf1143 ** 0..*
+    set_addr $I10, rxquantf1143_loop
+    rx1141_cur."!mark_push"(0, rx1141_pos, $I10)
+    goto rxquantf1143_done
+  rxquantf1143_loop:
+  # rx charclass .
+    ge rx1141_pos, rx1141_eos, rx1141_fail
+    inc rx1141_pos
+    set_addr $I10, rxquantf1143_loop
+    rx1141_cur."!mark_push"(rx1141_rep, rx1141_pos, $I10)
+  rxquantf1143_done:
+  # rx pass
+    rx1141_cur."!cursor_pass"(rx1141_pos, "")
+    if_null rx1141_debug, debug_161
+    rx1141_cur."!cursor_debug"("PASS", "", " at pos=", rx1141_pos)
+  debug_161:
+    rx1141_cur."!cursor_backtrack"()
+    .return (rx1141_cur)
+  rx1141_restart:
+    if_null rx1141_debug, debug_162
+    rx1141_cur."!cursor_debug"("NEXT", "")
+  debug_162:
+  rx1141_fail:
+    (rx1141_rep, rx1141_pos, $I10, $P10) = rx1141_cur."!mark_fail"(0)
+    lt rx1141_pos, -1, rx1141_done
+    eq rx1141_pos, -1, rx1141_fail
+    jump $I10
+  rx1141_done:
+    rx1141_cur."!cursor_fail"()
+    if_null rx1141_debug, debug_163
+    rx1141_cur."!cursor_debug"("FAIL", "")
+  debug_163:
+    .return (rx1141_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1153"  :anon :subid("33_1792415686.17671") :method :outer("29_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 157
+    .local string rx1155_tgt
+    .local int rx1155_pos
+    .local int rx1155_off
+    .local int rx1155_eos
+    .local int rx1155_rep
+    .local pmc rx1155_cur
+    .local pmc rx1155_debug
+    (rx1155_cur, rx1155_pos, rx1155_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1155_debug, rx1155_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1155_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1155_eos, rx1155_tgt
+    gt rx1155_pos, rx1155_eos, rx1155_done
+    set rx1155_off, 0
+    lt rx1155_pos, 2, rx1155_start
+    sub rx1155_off, rx1155_pos, 1
+    substr rx1155_tgt, rx1155_tgt, rx1155_off
+  rx1155_start:
+    eq $I10, 1, rx1155_restart
+    if_null rx1155_debug, debug_171
+    rx1155_cur."!cursor_debug"("START", "")
+  debug_171:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1156_done
+    goto rxscan1156_scan
+  rxscan1156_loop:
+    ($P10) = rx1155_cur."from"()
+    inc $P10
+    set rx1155_pos, $P10
+    ge rx1155_pos, rx1155_eos, rxscan1156_done
+  rxscan1156_scan:
+    set_addr $I10, rxscan1156_loop
+    rx1155_cur."!mark_push"(0, rx1155_pos, $I10)
+  rxscan1156_done:
+  # rx literal  "''"
+    add $I11, rx1155_pos, 2
+    gt $I11, rx1155_eos, rx1155_fail
+    sub $I11, rx1155_pos, rx1155_off
+    substr $S10, rx1155_tgt, $I11, 2
+    ne $S10, "''", rx1155_fail
+    add rx1155_pos, 2
+  # rx pass
+    rx1155_cur."!cursor_pass"(rx1155_pos, "")
+    if_null rx1155_debug, debug_172
+    rx1155_cur."!cursor_debug"("PASS", "", " at pos=", rx1155_pos)
+  debug_172:
+    rx1155_cur."!cursor_backtrack"()
+    .return (rx1155_cur)
+  rx1155_restart:
+    if_null rx1155_debug, debug_173
+    rx1155_cur."!cursor_debug"("NEXT", "")
+  debug_173:
+  rx1155_fail:
+    (rx1155_rep, rx1155_pos, $I10, $P10) = rx1155_cur."!mark_fail"(0)
+    lt rx1155_pos, -1, rx1155_done
+    eq rx1155_pos, -1, rx1155_fail
+    jump $I10
+  rx1155_done:
+    rx1155_cur."!cursor_fail"()
+    if_null rx1155_debug, debug_174
+    rx1155_cur."!cursor_debug"("FAIL", "")
+  debug_174:
+    .return (rx1155_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1158"  :anon :subid("34_1792415686.17671") :method :outer("29_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 165
+    .const 'Sub' $P1163 = "35_1792415686.17671" 
+    capture_lex $P1163
+    .local string rx1160_tgt
+    .local int rx1160_pos
+    .local int rx1160_off
+    .local int rx1160_eos
+    .local int rx1160_rep
+    .local pmc rx1160_cur
+    .local pmc rx1160_debug
+    (rx1160_cur, rx1160_pos, rx1160_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1160_debug, rx1160_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1160_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1160_eos, rx1160_tgt
+    gt rx1160_pos, rx1160_eos, rx1160_done
+    set rx1160_off, 0
+    lt rx1160_pos, 2, rx1160_start
+    sub rx1160_off, rx1160_pos, 1
+    substr rx1160_tgt, rx1160_tgt, rx1160_off
+  rx1160_start:
+    eq $I10, 1, rx1160_restart
+    if_null rx1160_debug, debug_175
+    rx1160_cur."!cursor_debug"("START", "")
+  debug_175:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1161_done
+    goto rxscan1161_scan
+  rxscan1161_loop:
+    ($P10) = rx1160_cur."from"()
+    inc $P10
+    set rx1160_pos, $P10
+    ge rx1160_pos, rx1160_eos, rxscan1161_done
+  rxscan1161_scan:
+    set_addr $I10, rxscan1161_loop
+    rx1160_cur."!mark_push"(0, rx1160_pos, $I10)
+  rxscan1161_done:
+  # rxanchor bos
+    ne rx1160_pos, 0, rx1160_fail
+  # rx literal  "\""
+    add $I11, rx1160_pos, 1
+    gt $I11, rx1160_eos, rx1160_fail
+    sub $I11, rx1160_pos, rx1160_off
+    ord $I11, rx1160_tgt, $I11
+    ne $I11, 34, rx1160_fail
+    add rx1160_pos, 1
+  # rx subrule $P1163 subtype=capture negate=
+    rx1160_cur."!cursor_pos"(rx1160_pos)
+    .const 'Sub' $P1163 = "35_1792415686.17671" 
+    capture_lex $P1163
+    $P10 = rx1160_cur.$P1163()
+    unless $P10, rx1160_fail
+    goto rxsubrule1168_pass
+  rxsubrule1168_back:
+    $P10 = $P10."!cursor_next"()
+    unless $P10, rx1160_fail
+  rxsubrule1168_pass:
+    set_addr $I10, rxsubrule1168_back
+    rx1160_cur."!mark_push"(0, rx1160_pos, $I10, $P10)
+    $P10."!cursor_names"(0)
+    rx1160_pos = $P10."pos"()
+  # rx literal  "\""
+    add $I11, rx1160_pos, 1
+    gt $I11, rx1160_eos, rx1160_fail
+    sub $I11, rx1160_pos, rx1160_off
+    ord $I11, rx1160_tgt, $I11
+    ne $I11, 34, rx1160_fail
+    add rx1160_pos, 1
+  # rx rxquantg1169 ** 0..1
+    set_addr $I10, rxquantg1169_done
+    rx1160_cur."!mark_push"(0, rx1160_pos, $I10)
+  rxquantg1169_loop:
+  # rx rxquantg1170 ** 1..*
+  rxquantg1170_loop:
+  # rx charclass s
+    ge rx1160_pos, rx1160_eos, rx1160_fail
+    sub $I10, rx1160_pos, rx1160_off
+    is_cclass $I11, 32, rx1160_tgt, $I10
+    unless $I11, rx1160_fail
+    inc rx1160_pos
+    set_addr $I10, rxquantg1170_done
+    rx1160_cur."!mark_push"(rx1160_rep, rx1160_pos, $I10)
+    goto rxquantg1170_loop
+  rxquantg1170_done:
+  # rx literal  "#"
+    add $I11, rx1160_pos, 1
+    gt $I11, rx1160_eos, rx1160_fail
+    sub $I11, rx1160_pos, rx1160_off
+    ord $I11, rx1160_tgt, $I11
+    ne $I11, 35, rx1160_fail
+    add rx1160_pos, 1
+  # rx rxquantg1171 ** 0..*
+    set_addr $I10, rxquantg1171_done
+    rx1160_cur."!mark_push"(0, rx1160_pos, $I10)
+  rxquantg1171_loop:
+  # rx charclass .
+    ge rx1160_pos, rx1160_eos, rx1160_fail
+    inc rx1160_pos
+    set_addr $I10, rxquantg1171_done
+    rx1160_cur."!mark_push"(rx1160_rep, rx1160_pos, $I10)
+    goto rxquantg1171_loop
+  rxquantg1171_done:
+  rxquantg1169_done:
+  # rxanchor eos
+    ne rx1160_pos, rx1160_eos, rx1160_fail
+  # rx pass
+    rx1160_cur."!cursor_pass"(rx1160_pos, "")
+    if_null rx1160_debug, debug_180
+    rx1160_cur."!cursor_debug"("PASS", "", " at pos=", rx1160_pos)
+  debug_180:
+    rx1160_cur."!cursor_backtrack"()
+    .return (rx1160_cur)
+  rx1160_restart:
+    if_null rx1160_debug, debug_181
+    rx1160_cur."!cursor_debug"("NEXT", "")
+  debug_181:
+  rx1160_fail:
+    (rx1160_rep, rx1160_pos, $I10, $P10) = rx1160_cur."!mark_fail"(0)
+    lt rx1160_pos, -1, rx1160_done
+    eq rx1160_pos, -1, rx1160_fail
+    jump $I10
+  rx1160_done:
+    rx1160_cur."!cursor_fail"()
+    if_null rx1160_debug, debug_182
+    rx1160_cur."!cursor_debug"("FAIL", "")
+  debug_182:
+    .return (rx1160_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1162"  :anon :subid("35_1792415686.17671") :method :outer("34_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 165
+    .local string rx1164_tgt
+    .local int rx1164_pos
+    .local int rx1164_off
+    .local int rx1164_eos
+    .local int rx1164_rep
+    .local pmc rx1164_cur
+    .local pmc rx1164_debug
+    (rx1164_cur, rx1164_pos, rx1164_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1164_debug, rx1164_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1164_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1164_eos, rx1164_tgt
+    gt rx1164_pos, rx1164_eos, rx1164_done
+    set rx1164_off, 0
+    lt rx1164_pos, 2, rx1164_start
+    sub rx1164_off, rx1164_pos, 1
+    substr rx1164_tgt, rx1164_tgt, rx1164_off
+  rx1164_start:
+    eq $I10, 1, rx1164_restart
+    if_null rx1164_debug, debug_176
+    rx1164_cur."!cursor_debug"("START", "")
+  debug_176:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1165_done
+    goto rxscan1165_scan
+  rxscan1165_loop:
+    ($P10) = rx1164_cur."from"()
+    inc $P10
+    set rx1164_pos, $P10
+    ge rx1164_pos, rx1164_eos, rxscan1165_done
+  rxscan1165_scan:
+    set_addr $I10, rxscan1165_loop
+    rx1164_cur."!mark_push"(0, rx1164_pos, $I10)
+  rxscan1165_done:
+  # rx rxquantg1166 ** 0..*
+    set_addr $I10, rxquantg1166_done
+    rx1164_cur."!mark_push"(0, rx1164_pos, $I10)
+  rxquantg1166_loop:
+  alt1167_0:
+    set_addr $I10, alt1167_1
+    rx1164_cur."!mark_push"(0, rx1164_pos, $I10)
+  # rx literal  "\\"
+    add $I11, rx1164_pos, 1
+    gt $I11, rx1164_eos, rx1164_fail
+    sub $I11, rx1164_pos, rx1164_off
+    ord $I11, rx1164_tgt, $I11
+    ne $I11, 92, rx1164_fail
+    add rx1164_pos, 1
+  # rx charclass .
+    ge rx1164_pos, rx1164_eos, rx1164_fail
+    inc rx1164_pos
+    goto alt1167_end
+  alt1167_1:
+  # rx enumcharlist negate=1 
+    ge rx1164_pos, rx1164_eos, rx1164_fail
+    sub $I10, rx1164_pos, rx1164_off
+    substr $S10, rx1164_tgt, $I10, 1
+    index $I11, "\"", $S10
+    ge $I11, 0, rx1164_fail
+    inc rx1164_pos
+  alt1167_end:
+    set_addr $I10, rxquantg1166_done
+    rx1164_cur."!mark_push"(rx1164_rep, rx1164_pos, $I10)
+    goto rxquantg1166_loop
+  rxquantg1166_done:
+  # rx pass
+    rx1164_cur."!cursor_pass"(rx1164_pos, "")
+    if_null rx1164_debug, debug_177
+    rx1164_cur."!cursor_debug"("PASS", "", " at pos=", rx1164_pos)
+  debug_177:
+    rx1164_cur."!cursor_backtrack"()
+    .return (rx1164_cur)
+  rx1164_restart:
+    if_null rx1164_debug, debug_178
+    rx1164_cur."!cursor_debug"("NEXT", "")
+  debug_178:
+  rx1164_fail:
+    (rx1164_rep, rx1164_pos, $I10, $P10) = rx1164_cur."!mark_fail"(0)
+    lt rx1164_pos, -1, rx1164_done
+    eq rx1164_pos, -1, rx1164_fail
+    jump $I10
+  rx1164_done:
+    rx1164_cur."!cursor_fail"()
+    if_null rx1164_debug, debug_179
+    rx1164_cur."!cursor_debug"("FAIL", "")
+  debug_179:
+    .return (rx1164_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1173"  :anon :subid("36_1792415686.17671") :method :outer("29_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 171
+    .local string rx1175_tgt
+    .local int rx1175_pos
+    .local int rx1175_off
+    .local int rx1175_eos
+    .local int rx1175_rep
+    .local pmc rx1175_cur
+    .local pmc rx1175_debug
+    (rx1175_cur, rx1175_pos, rx1175_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1175_debug, rx1175_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1175_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1175_eos, rx1175_tgt
+    gt rx1175_pos, rx1175_eos, rx1175_done
+    set rx1175_off, 0
+    lt rx1175_pos, 2, rx1175_start
+    sub rx1175_off, rx1175_pos, 1
+    substr rx1175_tgt, rx1175_tgt, rx1175_off
+  rx1175_start:
+    eq $I10, 1, rx1175_restart
+    if_null rx1175_debug, debug_185
+    rx1175_cur."!cursor_debug"("START", "")
+  debug_185:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1176_done
+    goto rxscan1176_scan
+  rxscan1176_loop:
+    ($P10) = rx1175_cur."from"()
+    inc $P10
+    set rx1175_pos, $P10
+    ge rx1175_pos, rx1175_eos, rxscan1176_done
+  rxscan1176_scan:
+    set_addr $I10, rxscan1176_loop
+    rx1175_cur."!mark_push"(0, rx1175_pos, $I10)
+  rxscan1176_done:
+  # rx literal  "\\\""
+    add $I11, rx1175_pos, 2
+    gt $I11, rx1175_eos, rx1175_fail
+    sub $I11, rx1175_pos, rx1175_off
+    substr $S10, rx1175_tgt, $I11, 2
+    ne $S10, "\\\"", rx1175_fail
+    add rx1175_pos, 2
+  # rx pass
+    rx1175_cur."!cursor_pass"(rx1175_pos, "")
+    if_null rx1175_debug, debug_186
+    rx1175_cur."!cursor_debug"("PASS", "", " at pos=", rx1175_pos)
+  debug_186:
+    rx1175_cur."!cursor_backtrack"()
+    .return (rx1175_cur)
+  rx1175_restart:
+    if_null rx1175_debug, debug_187
+    rx1175_cur."!cursor_debug"("NEXT", "")
+  debug_187:
+  rx1175_fail:
+    (rx1175_rep, rx1175_pos, $I10, $P10) = rx1175_cur."!mark_fail"(0)
+    lt rx1175_pos, -1, rx1175_done
+    eq rx1175_pos, -1, rx1175_fail
+    jump $I10
+  rx1175_done:
+    rx1175_cur."!cursor_fail"()
+    if_null rx1175_debug, debug_188
+    rx1175_cur."!cursor_debug"("FAIL", "")
+  debug_188:
+    .return (rx1175_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1178"  :anon :subid("37_1792415686.17671") :method :outer("29_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 177
+    .local string rx1180_tgt
+    .local int rx1180_pos
+    .local int rx1180_off
+    .local int rx1180_eos
+    .local int rx1180_rep
+    .local pmc rx1180_cur
+    .local pmc rx1180_debug
+    (rx1180_cur, rx1180_pos, rx1180_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1180_debug, rx1180_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1180_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1180_eos, rx1180_tgt
+    gt rx1180_pos, rx1180_eos, rx1180_done
+    set rx1180_off, 0
+    lt rx1180_pos, 2, rx1180_start
+    sub rx1180_off, rx1180_pos, 1
+    substr rx1180_tgt, rx1180_tgt, rx1180_off
+  rx1180_start:
+    eq $I10, 1, rx1180_restart
+    if_null rx1180_debug, debug_189
+    rx1180_cur."!cursor_debug"("START", "")
+  debug_189:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1181_done
+    goto rxscan1181_scan
+  rxscan1181_loop:
+    ($P10) = rx1180_cur."from"()
+    inc $P10
+    set rx1180_pos, $P10
+    ge rx1180_pos, rx1180_eos, rxscan1181_done
+  rxscan1181_scan:
+    set_addr $I10, rxscan1181_loop
+    rx1180_cur."!mark_push"(0, rx1180_pos, $I10)
+  rxscan1181_done:
+  # rxanchor bos
+    ne rx1180_pos, 0, rx1180_fail
+  # rx enumcharlist negate=0 
+    ge rx1180_pos, rx1180_eos, rx1180_fail
+    sub $I10, rx1180_pos, rx1180_off
+    substr $S10, rx1180_tgt, $I10, 1
+    index $I11, "'\"!&", $S10
+    lt $I11, 0, rx1180_fail
+    inc rx1180_pos
+  # rx pass
+    rx1180_cur."!cursor_pass"(rx1180_pos, "")
+    if_null rx1180_debug, debug_190
+    rx1180_cur."!cursor_debug"("PASS", "", " at pos=", rx1180_pos)
+  debug_190:
+    rx1180_cur."!cursor_backtrack"()
+    .return (rx1180_cur)
+  rx1180_restart:
+    if_null rx1180_debug, debug_191
+    rx1180_cur."!cursor_debug"("NEXT", "")
+  debug_191:
+  rx1180_fail:
+    (rx1180_rep, rx1180_pos, $I10, $P10) = rx1180_cur."!mark_fail"(0)
+    lt rx1180_pos, -1, rx1180_done
+    eq rx1180_pos, -1, rx1180_fail
+    jump $I10
+  rx1180_done:
+    rx1180_cur."!cursor_fail"()
+    if_null rx1180_debug, debug_192
+    rx1180_cur."!cursor_debug"("FAIL", "")
+  debug_192:
+    .return (rx1180_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1183"  :anon :subid("38_1792415686.17671") :method :outer("29_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 180
+    .const 'Sub' $P1188 = "39_1792415686.17671" 
+    capture_lex $P1188
+    .local string rx1185_tgt
+    .local int rx1185_pos
+    .local int rx1185_off
+    .local int rx1185_eos
+    .local int rx1185_rep
+    .local pmc rx1185_cur
+    .local pmc rx1185_debug
+    (rx1185_cur, rx1185_pos, rx1185_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1185_debug, rx1185_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1185_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1185_eos, rx1185_tgt
+    gt rx1185_pos, rx1185_eos, rx1185_done
+    set rx1185_off, 0
+    lt rx1185_pos, 2, rx1185_start
+    sub rx1185_off, rx1185_pos, 1
+    substr rx1185_tgt, rx1185_tgt, rx1185_off
+  rx1185_start:
+    eq $I10, 1, rx1185_restart
+    if_null rx1185_debug, debug_193
+    rx1185_cur."!cursor_debug"("START", "")
+  debug_193:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1186_done
+    goto rxscan1186_scan
+  rxscan1186_loop:
+    ($P10) = rx1185_cur."from"()
+    inc $P10
+    set rx1185_pos, $P10
+    ge rx1185_pos, rx1185_eos, rxscan1186_done
+  rxscan1186_scan:
+    set_addr $I10, rxscan1186_loop
+    rx1185_cur."!mark_push"(0, rx1185_pos, $I10)
+  rxscan1186_done:
+  # rxanchor bos
+    ne rx1185_pos, 0, rx1185_fail
+    rx1185_cur."!cursor_pos"(rx1185_pos)
+    find_lex $P107, unicode:"$\x{a2}"
+    $P108 = $P107."MATCH"()
+    store_lex "$/", $P108
+    .const 'Sub' $P1188 = "39_1792415686.17671" 
+    capture_lex $P1188
+    $P109 = $P1188()
+  # rx rxquantg1189 ** 0..1
+    set_addr $I10, rxquantg1189_done
+    rx1185_cur."!mark_push"(0, rx1185_pos, $I10)
+  rxquantg1189_loop:
+  # rx rxquantg1190 ** 1..*
+  rxquantg1190_loop:
+  # rx charclass s
+    ge rx1185_pos, rx1185_eos, rx1185_fail
+    sub $I10, rx1185_pos, rx1185_off
+    is_cclass $I11, 32, rx1185_tgt, $I10
+    unless $I11, rx1185_fail
+    inc rx1185_pos
+    set_addr $I10, rxquantg1190_done
+    rx1185_cur."!mark_push"(rx1185_rep, rx1185_pos, $I10)
+    goto rxquantg1190_loop
+  rxquantg1190_done:
+  # rx literal  "#"
+    add $I11, rx1185_pos, 1
+    gt $I11, rx1185_eos, rx1185_fail
+    sub $I11, rx1185_pos, rx1185_off
+    ord $I11, rx1185_tgt, $I11
+    ne $I11, 35, rx1185_fail
+    add rx1185_pos, 1
+  # rx rxquantg1191 ** 0..*
+    set_addr $I10, rxquantg1191_done
+    rx1185_cur."!mark_push"(0, rx1185_pos, $I10)
+  rxquantg1191_loop:
+  # rx charclass .
+    ge rx1185_pos, rx1185_eos, rx1185_fail
+    inc rx1185_pos
+    set_addr $I10, rxquantg1191_done
+    rx1185_cur."!mark_push"(rx1185_rep, rx1185_pos, $I10)
+    goto rxquantg1191_loop
+  rxquantg1191_done:
+  rxquantg1189_done:
+  # rxanchor eos
+    ne rx1185_pos, rx1185_eos, rx1185_fail
+  # rx pass
+    rx1185_cur."!cursor_pass"(rx1185_pos, "")
+    if_null rx1185_debug, debug_194
+    rx1185_cur."!cursor_debug"("PASS", "", " at pos=", rx1185_pos)
+  debug_194:
+    rx1185_cur."!cursor_backtrack"()
+    .return (rx1185_cur)
+  rx1185_restart:
+    if_null rx1185_debug, debug_195
+    rx1185_cur."!cursor_debug"("NEXT", "")
+  debug_195:
+  rx1185_fail:
+    (rx1185_rep, rx1185_pos, $I10, $P10) = rx1185_cur."!mark_fail"(0)
+    lt rx1185_pos, -1, rx1185_done
+    eq rx1185_pos, -1, rx1185_fail
+    jump $I10
+  rx1185_done:
+    rx1185_cur."!cursor_fail"()
+    if_null rx1185_debug, debug_196
+    rx1185_cur."!cursor_debug"("FAIL", "")
+  debug_196:
+    .return (rx1185_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1187"  :anon :subid("39_1792415686.17671") :outer("38_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 180
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1194"  :anon :subid("40_1792415686.17671") :method :outer("29_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 181
+    .local string rx1196_tgt
+    .local int rx1196_pos
+    .local int rx1196_off
+    .local int rx1196_eos
+    .local int rx1196_rep
+    .local pmc rx1196_cur
+    .local pmc rx1196_debug
+    (rx1196_cur, rx1196_pos, rx1196_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1196_debug, rx1196_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1196_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1196_eos, rx1196_tgt
+    gt rx1196_pos, rx1196_eos, rx1196_done
+    set rx1196_off, 0
+    lt rx1196_pos, 2, rx1196_start
+    sub rx1196_off, rx1196_pos, 1
+    substr rx1196_tgt, rx1196_tgt, rx1196_off
+  rx1196_start:
+    eq $I10, 1, rx1196_restart
+    if_null rx1196_debug, debug_197
+    rx1196_cur."!cursor_debug"("START", "")
+  debug_197:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1197_done
+    goto rxscan1197_scan
+  rxscan1197_loop:
+    ($P10) = rx1196_cur."from"()
+    inc $P10
+    set rx1196_pos, $P10
+    ge rx1196_pos, rx1196_eos, rxscan1197_done
+  rxscan1197_scan:
+    set_addr $I10, rxscan1197_loop
+    rx1196_cur."!mark_push"(0, rx1196_pos, $I10)
+  rxscan1197_done:
+  # rxanchor bos
+    ne rx1196_pos, 0, rx1196_fail
+  # rx literal  "[]"
+    add $I11, rx1196_pos, 2
+    gt $I11, rx1196_eos, rx1196_fail
+    sub $I11, rx1196_pos, rx1196_off
+    substr $S10, rx1196_tgt, $I11, 2
+    ne $S10, "[]", rx1196_fail
+    add rx1196_pos, 2
+  # rx rxquantg1198 ** 0..1
+    set_addr $I10, rxquantg1198_done
+    rx1196_cur."!mark_push"(0, rx1196_pos, $I10)
+  rxquantg1198_loop:
+  # rx rxquantg1199 ** 1..*
+  rxquantg1199_loop:
+  # rx charclass s
+    ge rx1196_pos, rx1196_eos, rx1196_fail
+    sub $I10, rx1196_pos, rx1196_off
+    is_cclass $I11, 32, rx1196_tgt, $I10
+    unless $I11, rx1196_fail
+    inc rx1196_pos
+    set_addr $I10, rxquantg1199_done
+    rx1196_cur."!mark_push"(rx1196_rep, rx1196_pos, $I10)
+    goto rxquantg1199_loop
+  rxquantg1199_done:
+  # rx literal  "#"
+    add $I11, rx1196_pos, 1
+    gt $I11, rx1196_eos, rx1196_fail
+    sub $I11, rx1196_pos, rx1196_off
+    ord $I11, rx1196_tgt, $I11
+    ne $I11, 35, rx1196_fail
+    add rx1196_pos, 1
+  # rx rxquantg1200 ** 0..*
+    set_addr $I10, rxquantg1200_done
+    rx1196_cur."!mark_push"(0, rx1196_pos, $I10)
+  rxquantg1200_loop:
+  # rx charclass .
+    ge rx1196_pos, rx1196_eos, rx1196_fail
+    inc rx1196_pos
+    set_addr $I10, rxquantg1200_done
+    rx1196_cur."!mark_push"(rx1196_rep, rx1196_pos, $I10)
+    goto rxquantg1200_loop
+  rxquantg1200_done:
+  rxquantg1198_done:
+  # rxanchor eos
+    ne rx1196_pos, rx1196_eos, rx1196_fail
+  # rx pass
+    rx1196_cur."!cursor_pass"(rx1196_pos, "")
+    if_null rx1196_debug, debug_198
+    rx1196_cur."!cursor_debug"("PASS", "", " at pos=", rx1196_pos)
+  debug_198:
+    rx1196_cur."!cursor_backtrack"()
+    .return (rx1196_cur)
+  rx1196_restart:
+    if_null rx1196_debug, debug_199
+    rx1196_cur."!cursor_debug"("NEXT", "")
+  debug_199:
+  rx1196_fail:
+    (rx1196_rep, rx1196_pos, $I10, $P10) = rx1196_cur."!mark_fail"(0)
+    lt rx1196_pos, -1, rx1196_done
+    eq rx1196_pos, -1, rx1196_fail
+    jump $I10
+  rx1196_done:
+    rx1196_cur."!cursor_fail"()
+    if_null rx1196_debug, debug_200
+    rx1196_cur."!cursor_debug"("FAIL", "")
+  debug_200:
+    .return (rx1196_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1202"  :anon :subid("41_1792415686.17671") :method :outer("29_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 184
+    .local string rx1204_tgt
+    .local int rx1204_pos
+    .local int rx1204_off
+    .local int rx1204_eos
+    .local int rx1204_rep
+    .local pmc rx1204_cur
+    .local pmc rx1204_debug
+    (rx1204_cur, rx1204_pos, rx1204_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1204_debug, rx1204_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1204_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1204_eos, rx1204_tgt
+    gt rx1204_pos, rx1204_eos, rx1204_done
+    set rx1204_off, 0
+    lt rx1204_pos, 2, rx1204_start
+    sub rx1204_off, rx1204_pos, 1
+    substr rx1204_tgt, rx1204_tgt, rx1204_off
+  rx1204_start:
+    eq $I10, 1, rx1204_restart
+    if_null rx1204_debug, debug_201
+    rx1204_cur."!cursor_debug"("START", "")
+  debug_201:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1205_done
+    goto rxscan1205_scan
+  rxscan1205_loop:
+    ($P10) = rx1204_cur."from"()
+    inc $P10
+    set rx1204_pos, $P10
+    ge rx1204_pos, rx1204_eos, rxscan1205_done
+  rxscan1205_scan:
+    set_addr $I10, rxscan1205_loop
+    rx1204_cur."!mark_push"(0, rx1204_pos, $I10)
+  rxscan1205_done:
+  # rxanchor bos
+    ne rx1204_pos, 0, rx1204_fail
+  alt1206_0:
+    set_addr $I10, alt1206_1
+    rx1204_cur."!mark_push"(0, rx1204_pos, $I10)
+  # rx literal  ">"
+    add $I11, rx1204_pos, 1
+    gt $I11, rx1204_eos, rx1204_fail
+    sub $I11, rx1204_pos, rx1204_off
+    ord $I11, rx1204_tgt, $I11
+    ne $I11, 62, rx1204_fail
+    add rx1204_pos, 1
+    goto alt1206_end
+  alt1206_1:
+  # rx literal  "|"
+    add $I11, rx1204_pos, 1
+    gt $I11, rx1204_eos, rx1204_fail
+    sub $I11, rx1204_pos, rx1204_off
+    ord $I11, rx1204_tgt, $I11
+    ne $I11, 124, rx1204_fail
+    add rx1204_pos, 1
+  alt1206_end:
+  # rx pass
+    rx1204_cur."!cursor_pass"(rx1204_pos, "")
+    if_null rx1204_debug, debug_202
+    rx1204_cur."!cursor_debug"("PASS", "", " at pos=", rx1204_pos)
+  debug_202:
+    rx1204_cur."!cursor_backtrack"()
+    .return (rx1204_cur)
+  rx1204_restart:
+    if_null rx1204_debug, debug_203
+    rx1204_cur."!cursor_debug"("NEXT", "")
+  debug_203:
+  rx1204_fail:
+    (rx1204_rep, rx1204_pos, $I10, $P10) = rx1204_cur."!mark_fail"(0)
+    lt rx1204_pos, -1, rx1204_done
+    eq rx1204_pos, -1, rx1204_fail
+    jump $I10
+  rx1204_done:
+    rx1204_cur."!cursor_fail"()
+    if_null rx1204_debug, debug_204
+    rx1204_cur."!cursor_debug"("FAIL", "")
+  debug_204:
+    .return (rx1204_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1207"  :anon :subid("42_1792415686.17671") :method :outer("29_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 192
+    .local string rx1209_tgt
+    .local int rx1209_pos
+    .local int rx1209_off
+    .local int rx1209_eos
+    .local int rx1209_rep
+    .local pmc rx1209_cur
+    .local pmc rx1209_debug
+    (rx1209_cur, rx1209_pos, rx1209_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1209_debug, rx1209_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1209_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1209_eos, rx1209_tgt
+    gt rx1209_pos, rx1209_eos, rx1209_done
+    set rx1209_off, 0
+    lt rx1209_pos, 2, rx1209_start
+    sub rx1209_off, rx1209_pos, 1
+    substr rx1209_tgt, rx1209_tgt, rx1209_off
+  rx1209_start:
+    eq $I10, 1, rx1209_restart
+    if_null rx1209_debug, debug_205
+    rx1209_cur."!cursor_debug"("START", "")
+  debug_205:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1210_done
+    goto rxscan1210_scan
+  rxscan1210_loop:
+    ($P10) = rx1209_cur."from"()
+    inc $P10
+    set rx1209_pos, $P10
+    ge rx1209_pos, rx1209_eos, rxscan1210_done
+  rxscan1210_scan:
+    set_addr $I10, rxscan1210_loop
+    rx1209_cur."!mark_push"(0, rx1209_pos, $I10)
+  rxscan1210_done:
+  # rx rxquantg1211 ** 1..*
+  rxquantg1211_loop:
+  # rx charclass s
+    ge rx1209_pos, rx1209_eos, rx1209_fail
+    sub $I10, rx1209_pos, rx1209_off
+    is_cclass $I11, 32, rx1209_tgt, $I10
+    unless $I11, rx1209_fail
+    inc rx1209_pos
+    set_addr $I10, rxquantg1211_done
+    rx1209_cur."!mark_push"(rx1209_rep, rx1209_pos, $I10)
+    goto rxquantg1211_loop
+  rxquantg1211_done:
+  # rx literal  "#"
+    add $I11, rx1209_pos, 1
+    gt $I11, rx1209_eos, rx1209_fail
+    sub $I11, rx1209_pos, rx1209_off
+    ord $I11, rx1209_tgt, $I11
+    ne $I11, 35, rx1209_fail
+    add rx1209_pos, 1
+  # rx rxquantg1212 ** 0..*
+    set_addr $I10, rxquantg1212_done
+    rx1209_cur."!mark_push"(0, rx1209_pos, $I10)
+  rxquantg1212_loop:
+  # rx charclass .
+    ge rx1209_pos, rx1209_eos, rx1209_fail
+    inc rx1209_pos
+    set_addr $I10, rxquantg1212_done
+    rx1209_cur."!mark_push"(rx1209_rep, rx1209_pos, $I10)
+    goto rxquantg1212_loop
+  rxquantg1212_done:
+  # rxanchor eos
+    ne rx1209_pos, rx1209_eos, rx1209_fail
+  # rx pass
+    rx1209_cur."!cursor_pass"(rx1209_pos, "")
+    if_null rx1209_debug, debug_206
+    rx1209_cur."!cursor_debug"("PASS", "", " at pos=", rx1209_pos)
+  debug_206:
+    rx1209_cur."!cursor_backtrack"()
+    .return (rx1209_cur)
+  rx1209_restart:
+    if_null rx1209_debug, debug_207
+    rx1209_cur."!cursor_debug"("NEXT", "")
+  debug_207:
+  rx1209_fail:
+    (rx1209_rep, rx1209_pos, $I10, $P10) = rx1209_cur."!mark_fail"(0)
+    lt rx1209_pos, -1, rx1209_done
+    eq rx1209_pos, -1, rx1209_fail
+    jump $I10
+  rx1209_done:
+    rx1209_cur."!cursor_fail"()
+    if_null rx1209_debug, debug_208
+    rx1209_cur."!cursor_debug"("FAIL", "")
+  debug_208:
+    .return (rx1209_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.include "except_types.pasm"
+.sub "_read_array"  :subid("43_1792415686.17671") :method :outer("11_1792415686.17671")
+    .param pmc param_1216
+    .param pmc param_1217
+    .param pmc param_1218
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 222
+    .const 'Sub' $P1220 = "44_1792415686.17671" 
+    capture_lex $P1220
+    new $P1215, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1215, control_1214
+    push_eh $P1215
+    .lex "self", self
+    .lex "@array", param_1216
+    .lex "@indent", param_1217
+    .lex "@lines", param_1218
+.annotate 'line', 224
+    new $P107, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P107, loop1352_handler
+    push_eh $P107
+  loop1352_test:
+    find_lex $P104, "@lines"
+    unless $P104, loop1352_done
+  loop1352_redo:
+    .const 'Sub' $P1220 = "44_1792415686.17671" 
+    capture_lex $P1220
+    $P1220()
+  loop1352_next:
+    goto loop1352_test
+  loop1352_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P108, exception, 'type'
+    eq $P108, .CONTROL_LOOP_NEXT, loop1352_next
+    eq $P108, .CONTROL_LOOP_REDO, loop1352_redo
+  loop1352_done:
+    pop_eh 
+.annotate 'line', 222
+    .return (1)
+  control_1214:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P104, exception, "payload"
+    .return ($P104)
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.include "except_types.pasm"
+.sub "_block1219"  :anon :subid("44_1792415686.17671") :outer("43_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 224
+    .const 'Sub' $P1334 = "60_1792415686.17671" 
+    capture_lex $P1334
+    .const 'Sub' $P1326 = "59_1792415686.17671" 
+    capture_lex $P1326
+    .const 'Sub' $P1315 = "57_1792415686.17671" 
+    capture_lex $P1315
+    .const 'Sub' $P1306 = "56_1792415686.17671" 
+    capture_lex $P1306
+    .const 'Sub' $P1284 = "53_1792415686.17671" 
+    capture_lex $P1284
+    .const 'Sub' $P1273 = "51_1792415686.17671" 
+    capture_lex $P1273
+    .const 'Sub' $P1257 = "49_1792415686.17671" 
+    capture_lex $P1257
+    .const 'Sub' $P1238 = "47_1792415686.17671" 
+    capture_lex $P1238
+    .const 'Sub' $P1232 = "46_1792415686.17671" 
+    capture_lex $P1232
+    .const 'Sub' $P1225 = "45_1792415686.17671" 
+    capture_lex $P1225
+.annotate 'line', 236
+    new $P105, "Undef"
+    set $P1221, $P105
+    .lex "$m", $P1221
+.annotate 'line', 225
+    find_lex $P1222, "@lines"
+    unless_null $P1222, vivify_209
+    $P1222 = root_new ['parrot';'ResizablePMCArray']
+  vivify_209:
+    set $P106, $P1222[0]
+    unless_null $P106, vivify_210
+    new $P106, "Undef"
+  vivify_210:
+    "debug"("_read_array", $P106)
+.annotate 'line', 228
+    get_hll_global $P106, ["Regex"], "Regex"
+    .const 'Sub' $P1225 = "45_1792415686.17671" 
+    capture_lex $P1225
+    $P107 = $P106."new"($P1225)
+    find_lex $P1229, "@lines"
+    unless_null $P1229, vivify_215
+    $P1229 = root_new ['parrot';'ResizablePMCArray']
+  vivify_215:
+    set $P108, $P1229[0]
+    unless_null $P108, vivify_216
+    new $P108, "Undef"
+  vivify_216:
+    $P109 = $P107."ACCEPTS"($P108)
+    unless $P109, if_1223_end
+.annotate 'line', 229
+    new $P116, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P116, loop1236_handler
+    push_eh $P116
+  loop1236_test:
+    find_lex $P111, "@lines"
+    if $P111, if_1230
+    set $P110, $P111
+    goto if_1230_end
+  if_1230:
+    get_hll_global $P112, ["Regex"], "Regex"
+    .const 'Sub' $P1232 = "46_1792415686.17671" 
+    capture_lex $P1232
+    $P113 = $P112."new"($P1232)
+    find_lex $P1235, "@lines"
+    unless_null $P1235, vivify_221
+    $P1235 = root_new ['parrot';'ResizablePMCArray']
+  vivify_221:
+    set $P114, $P1235[0]
+    unless_null $P114, vivify_222
+    new $P114, "Undef"
+  vivify_222:
+    $P115 = $P113."ACCEPTS"($P114)
+    isfalse $I101, $P115
+    new $P110, 'Integer'
+    set $P110, $I101
+  if_1230_end:
+    unless $P110, loop1236_done
+  loop1236_redo:
+.annotate 'line', 230
+    find_lex $P116, "@lines"
+    $P116."shift"()
+  loop1236_next:
+.annotate 'line', 229
+    goto loop1236_test
+  loop1236_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P117, exception, 'type'
+    eq $P117, .CONTROL_LOOP_NEXT, loop1236_next
+    eq $P117, .CONTROL_LOOP_REDO, loop1236_redo
+  loop1236_done:
+    pop_eh 
+.annotate 'line', 232
+    new $P110, "Exception"
+    set $P110['type'], .CONTROL_RETURN
+    new $P111, "Integer"
+    assign $P111, 1
+    setattribute $P110, 'payload', $P111
+    throw $P110
+  if_1223_end:
+.annotate 'line', 236
+    get_hll_global $P106, ["Regex"], "Regex"
+    .const 'Sub' $P1238 = "47_1792415686.17671" 
+    capture_lex $P1238
+    $P107 = $P106."new"($P1238)
+    find_lex $P1247, "@lines"
+    unless_null $P1247, vivify_231
+    $P1247 = root_new ['parrot';'ResizablePMCArray']
+  vivify_231:
+    set $P108, $P1247[0]
+    unless_null $P108, vivify_232
+    new $P108, "Undef"
+  vivify_232:
+    $P109 = $P107."ACCEPTS"($P108)
+    store_lex "$m", $P109
+.annotate 'line', 237
+    find_lex $P106, "$m"
+    find_lex $P107, "@indent"
+    "debug"("Indenting", $P106, $P107)
+.annotate 'line', 238
+    find_lex $P1249, "$m"
+    unless_null $P1249, vivify_233
+    $P1249 = root_new ['parrot';'ResizablePMCArray']
+  vivify_233:
+    set $P106, $P1249[0]
+    unless_null $P106, vivify_234
+    new $P106, "Undef"
+  vivify_234:
+    $N100 = "length"($P106)
+    find_lex $P1250, "@indent"
+    unless_null $P1250, vivify_235
+    $P1250 = root_new ['parrot';'ResizablePMCArray']
+  vivify_235:
+    set $P107, $P1250[-1]
+    unless_null $P107, vivify_236
+    new $P107, "Undef"
+  vivify_236:
+    set $N101, $P107
+    islt $I101, $N100, $N101
+    if $I101, if_1248
+.annotate 'line', 240
+    find_lex $P1252, "$m"
+    unless_null $P1252, vivify_237
+    $P1252 = root_new ['parrot';'ResizablePMCArray']
+  vivify_237:
+    set $P108, $P1252[0]
+    unless_null $P108, vivify_238
+    new $P108, "Undef"
+  vivify_238:
+    $N102 = "length"($P108)
+    find_lex $P1253, "@indent"
+    unless_null $P1253, vivify_239
+    $P1253 = root_new ['parrot';'ResizablePMCArray']
+  vivify_239:
+    set $P109, $P1253[-1]
+    unless_null $P109, vivify_240
+    new $P109, "Undef"
+  vivify_240:
+    set $N103, $P109
+    isgt $I102, $N102, $N103
+    unless $I102, if_1251_end
+.annotate 'line', 241
+    new $P110, 'String'
+    set $P110, "YAML::Tiny found bad indenting in line '"
+    find_lex $P1254, "@lines"
+    unless_null $P1254, vivify_241
+    $P1254 = root_new ['parrot';'ResizablePMCArray']
+  vivify_241:
+    set $P111, $P1254[0]
+    unless_null $P111, vivify_242
+    new $P111, "Undef"
+  vivify_242:
+    set $S100, $P111
+    concat $P112, $P110, $S100
+    concat $P113, $P112, "'"
+    die $P113
+  if_1251_end:
+.annotate 'line', 240
+    goto if_1248_end
+  if_1248:
+.annotate 'line', 239
+    new $P108, "Exception"
+    set $P108['type'], .CONTROL_RETURN
+    new $P109, "Integer"
+    assign $P109, 1
+    setattribute $P108, 'payload', $P109
+    throw $P108
+  if_1248_end:
+.annotate 'line', 244
+    get_hll_global $P107, ["Regex"], "Regex"
+    .const 'Sub' $P1257 = "49_1792415686.17671" 
+    capture_lex $P1257
+    $P108 = $P107."new"($P1257)
+    find_lex $P1271, "@lines"
+    unless_null $P1271, vivify_251
+    $P1271 = root_new ['parrot';'ResizablePMCArray']
+  vivify_251:
+    set $P109, $P1271[0]
+    unless_null $P109, vivify_252
+    new $P109, "Undef"
+  vivify_252:
+    $P110 = $P108."ACCEPTS"($P109)
+    store_lex "$m", $P110
+    if $P110, if_1255
+.annotate 'line', 252
+    get_hll_global $P114, ["Regex"], "Regex"
+    .const 'Sub' $P1284 = "53_1792415686.17671" 
+    capture_lex $P1284
+    $P115 = $P114."new"($P1284)
+    find_lex $P1302, "@lines"
+    unless_null $P1302, vivify_265
+    $P1302 = root_new ['parrot';'ResizablePMCArray']
+  vivify_265:
+    set $P116, $P1302[0]
+    unless_null $P116, vivify_266
+    new $P116, "Undef"
+  vivify_266:
+    $P117 = $P115."ACCEPTS"($P116)
+    store_lex "$m", $P117
+    if $P117, if_1282
+.annotate 'line', 257
+    get_hll_global $P120, ["Regex"], "Regex"
+    .const 'Sub' $P1306 = "56_1792415686.17671" 
+    capture_lex $P1306
+    $P121 = $P120."new"($P1306)
+    find_lex $P1311, "@lines"
+    unless_null $P1311, vivify_271
+    $P1311 = root_new ['parrot';'ResizablePMCArray']
+  vivify_271:
+    set $P122, $P1311[0]
+    unless_null $P122, vivify_272
+    new $P122, "Undef"
+  vivify_272:
+    $P123 = $P121."ACCEPTS"($P122)
+    store_lex "$m", $P123
+    if $P123, if_1304
+.annotate 'line', 286
+    find_lex $P128, "@indent"
+    set $N100, $P128
+    isgt $I101, $N100, 1.0
+    if $I101, if_1348
+    new $P126, 'Integer'
+    set $P126, $I101
+    goto if_1348_end
+  if_1348:
+    find_lex $P1349, "@indent"
+    unless_null $P1349, vivify_273
+    $P1349 = root_new ['parrot';'ResizablePMCArray']
+  vivify_273:
+    set $P129, $P1349[-1]
+    unless_null $P129, vivify_274
+    new $P129, "Undef"
+  vivify_274:
+    set $N101, $P129
+    find_lex $P1350, "@indent"
+    unless_null $P1350, vivify_275
+    $P1350 = root_new ['parrot';'ResizablePMCArray']
+  vivify_275:
+    set $P130, $P1350[-2]
+    unless_null $P130, vivify_276
+    new $P130, "Undef"
+  vivify_276:
+    set $N102, $P130
+    iseq $I102, $N101, $N102
+    new $P126, 'Integer'
+    set $P126, $I102
+  if_1348_end:
+    if $P126, if_1347
+.annotate 'line', 297
+    new $P131, 'String'
+    set $P131, "YAML::Tiny failed to classify line '"
+    find_lex $P1351, "@lines"
+    unless_null $P1351, vivify_277
+    $P1351 = root_new ['parrot';'ResizablePMCArray']
+  vivify_277:
+    set $P132, $P1351[0]
+    unless_null $P132, vivify_278
+    new $P132, "Undef"
+  vivify_278:
+    set $S100, $P132
+    concat $P133, $P131, $S100
+    concat $P134, $P133, "'"
+    die $P134
+.annotate 'line', 296
+    goto if_1347_end
+  if_1347:
+.annotate 'line', 294
+    new $P131, "Exception"
+    set $P131['type'], .CONTROL_RETURN
+    new $P132, "Integer"
+    assign $P132, 1
+    setattribute $P131, 'payload', $P132
+    throw $P131
+  if_1347_end:
+.annotate 'line', 286
+    set $P119, $P125
+.annotate 'line', 257
+    goto if_1304_end
+  if_1304:
+.annotate 'line', 258
+    find_lex $P124, "@lines"
+    $P124."shift"()
+.annotate 'line', 259
+    find_lex $P124, "@lines"
+    if $P124, unless_1312_end
+.annotate 'line', 260
+    find_lex $P125, "@array"
+    get_hll_global $P126, "undef"
+    $P125."push"($P126)
+.annotate 'line', 261
+    new $P125, "Exception"
+    set $P125['type'], .CONTROL_RETURN
+    new $P126, "Integer"
+    assign $P126, 1
+    setattribute $P125, 'payload', $P126
+    throw $P125
+  unless_1312_end:
+.annotate 'line', 264
+    get_hll_global $P125, ["Regex"], "Regex"
+    .const 'Sub' $P1315 = "57_1792415686.17671" 
+    capture_lex $P1315
+    $P126 = $P125."new"($P1315)
+    find_lex $P1324, "@lines"
+    unless_null $P1324, vivify_287
+    $P1324 = root_new ['parrot';'ResizablePMCArray']
+  vivify_287:
+    set $P128, $P1324[0]
+    unless_null $P128, vivify_288
+    new $P128, "Undef"
+  vivify_288:
+    $P129 = $P126."ACCEPTS"($P128)
+    store_lex "$m", $P129
+    if $P129, if_1313
+.annotate 'line', 277
+    get_hll_global $P134, ["Regex"], "Regex"
+    .const 'Sub' $P1334 = "60_1792415686.17671" 
+    capture_lex $P1334
+    $P135 = $P134."new"($P1334)
+    find_lex $P1343, "@lines"
+    unless_null $P1343, vivify_297
+    $P1343 = root_new ['parrot';'ResizablePMCArray']
+  vivify_297:
+    set $P136, $P1343[0]
+    unless_null $P136, vivify_298
+    new $P136, "Undef"
+  vivify_298:
+    $P137 = $P135."ACCEPTS"($P136)
+    store_lex "$m", $P137
+    if $P137, if_1332
+.annotate 'line', 283
+    new $P138, 'String'
+    set $P138, "YAML::Tiny failed to classify line '"
+    find_lex $P1346, "@lines"
+    unless_null $P1346, vivify_299
+    $P1346 = root_new ['parrot';'ResizablePMCArray']
+  vivify_299:
+    set $P139, $P1346[0]
+    unless_null $P139, vivify_300
+    new $P139, "Undef"
+  vivify_300:
+    set $S100, $P139
+    concat $P140, $P138, $S100
+    concat $P141, $P140, "'"
+    die $P141
+.annotate 'line', 282
+    goto if_1332_end
+  if_1332:
+.annotate 'line', 278
+    find_lex $P138, "@array"
+    $P139 = "hash"()
+    $P138."push"($P139)
+.annotate 'line', 279
+    find_lex $P138, "self"
+    find_lex $P1344, "@array"
+    unless_null $P1344, vivify_301
+    $P1344 = root_new ['parrot';'ResizablePMCArray']
+  vivify_301:
+    set $P139, $P1344[-1]
+    unless_null $P139, vivify_302
+    new $P139, "Undef"
+  vivify_302:
+    find_lex $P140, "@indent"
+    find_lex $P1345, "$m"
+    unless_null $P1345, vivify_303
+    $P1345 = root_new ['parrot';'ResizablePMCArray']
+  vivify_303:
+    set $P141, $P1345[0]
+    unless_null $P141, vivify_304
+    new $P141, "Undef"
+  vivify_304:
+    $P142 = "length"($P141)
+    new $P143, "ResizablePMCArray"
+    push $P143, $P140
+    push $P143, $P142
+    find_lex $P144, "@lines"
+    $P145 = $P138."_read_hash"($P139, $P143, $P144)
+.annotate 'line', 277
+    set $P133, $P145
+  if_1332_end:
+    set $P124, $P133
+.annotate 'line', 264
+    goto if_1313_end
+  if_1313:
+    .const 'Sub' $P1326 = "59_1792415686.17671" 
+    capture_lex $P1326
+    $P132 = $P1326()
+    set $P124, $P132
+  if_1313_end:
+.annotate 'line', 257
+    set $P119, $P124
+  if_1304_end:
+    set $P113, $P119
+.annotate 'line', 252
+    goto if_1282_end
+  if_1282:
+.annotate 'line', 254
+    find_lex $P119, "@lines"
+    $P119."shift"()
+.annotate 'line', 255
+    find_lex $P119, "@array"
+    find_lex $P120, "self"
+    find_lex $P1303, "$m"
+    unless_null $P1303, vivify_311
+    $P1303 = root_new ['parrot';'ResizablePMCArray']
+  vivify_311:
+    set $P121, $P1303[1]
+    unless_null $P121, vivify_312
+    new $P121, "Undef"
+  vivify_312:
+    set $S100, $P121
+    find_lex $P122, "@indent"
+    get_hll_global $P123, "undef"
+    new $P124, "ResizablePMCArray"
+    push $P124, $P122
+    push $P124, $P123
+    find_lex $P125, "@lines"
+    $P126 = $P120."_read_scalar"($S100, $P124, $P125)
+    $P127 = $P119."push"($P126)
+.annotate 'line', 252
+    set $P113, $P127
+  if_1282_end:
+    set $P106, $P113
+.annotate 'line', 244
+    goto if_1255_end
+  if_1255:
+    .const 'Sub' $P1273 = "51_1792415686.17671" 
+    capture_lex $P1273
+    $P112 = $P1273()
+    set $P106, $P112
+  if_1255_end:
+.annotate 'line', 224
+    .return ($P106)
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1224"  :anon :subid("45_1792415686.17671") :method :outer("44_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 228
+    .local string rx1226_tgt
+    .local int rx1226_pos
+    .local int rx1226_off
+    .local int rx1226_eos
+    .local int rx1226_rep
+    .local pmc rx1226_cur
+    .local pmc rx1226_debug
+    (rx1226_cur, rx1226_pos, rx1226_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1226_debug, rx1226_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1226_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1226_eos, rx1226_tgt
+    gt rx1226_pos, rx1226_eos, rx1226_done
+    set rx1226_off, 0
+    lt rx1226_pos, 2, rx1226_start
+    sub rx1226_off, rx1226_pos, 1
+    substr rx1226_tgt, rx1226_tgt, rx1226_off
+  rx1226_start:
+    eq $I10, 1, rx1226_restart
+    if_null rx1226_debug, debug_211
+    rx1226_cur."!cursor_debug"("START", "")
+  debug_211:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1227_done
+    goto rxscan1227_scan
+  rxscan1227_loop:
+    ($P10) = rx1226_cur."from"()
+    inc $P10
+    set rx1226_pos, $P10
+    ge rx1226_pos, rx1226_eos, rxscan1227_done
+  rxscan1227_scan:
+    set_addr $I10, rxscan1227_loop
+    rx1226_cur."!mark_push"(0, rx1226_pos, $I10)
+  rxscan1227_done:
+  # rxanchor bos
+    ne rx1226_pos, 0, rx1226_fail
+  alt1228_0:
+    set_addr $I10, alt1228_1
+    rx1226_cur."!mark_push"(0, rx1226_pos, $I10)
+  # rx literal  "---"
+    add $I11, rx1226_pos, 3
+    gt $I11, rx1226_eos, rx1226_fail
+    sub $I11, rx1226_pos, rx1226_off
+    substr $S10, rx1226_tgt, $I11, 3
+    ne $S10, "---", rx1226_fail
+    add rx1226_pos, 3
+    goto alt1228_end
+  alt1228_1:
+  # rx literal  "..."
+    add $I11, rx1226_pos, 3
+    gt $I11, rx1226_eos, rx1226_fail
+    sub $I11, rx1226_pos, rx1226_off
+    substr $S10, rx1226_tgt, $I11, 3
+    ne $S10, "...", rx1226_fail
+    add rx1226_pos, 3
+  alt1228_end:
+  # rx pass
+    rx1226_cur."!cursor_pass"(rx1226_pos, "")
+    if_null rx1226_debug, debug_212
+    rx1226_cur."!cursor_debug"("PASS", "", " at pos=", rx1226_pos)
+  debug_212:
+    rx1226_cur."!cursor_backtrack"()
+    .return (rx1226_cur)
+  rx1226_restart:
+    if_null rx1226_debug, debug_213
+    rx1226_cur."!cursor_debug"("NEXT", "")
+  debug_213:
+  rx1226_fail:
+    (rx1226_rep, rx1226_pos, $I10, $P10) = rx1226_cur."!mark_fail"(0)
+    lt rx1226_pos, -1, rx1226_done
+    eq rx1226_pos, -1, rx1226_fail
+    jump $I10
+  rx1226_done:
+    rx1226_cur."!cursor_fail"()
+    if_null rx1226_debug, debug_214
+    rx1226_cur."!cursor_debug"("FAIL", "")
+  debug_214:
+    .return (rx1226_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1231"  :anon :subid("46_1792415686.17671") :method :outer("44_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 229
+    .local string rx1233_tgt
+    .local int rx1233_pos
+    .local int rx1233_off
+    .local int rx1233_eos
+    .local int rx1233_rep
+    .local pmc rx1233_cur
+    .local pmc rx1233_debug
+    (rx1233_cur, rx1233_pos, rx1233_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1233_debug, rx1233_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1233_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1233_eos, rx1233_tgt
+    gt rx1233_pos, rx1233_eos, rx1233_done
+    set rx1233_off, 0
+    lt rx1233_pos, 2, rx1233_start
+    sub rx1233_off, rx1233_pos, 1
+    substr rx1233_tgt, rx1233_tgt, rx1233_off
+  rx1233_start:
+    eq $I10, 1, rx1233_restart
+    if_null rx1233_debug, debug_217
+    rx1233_cur."!cursor_debug"("START", "")
+  debug_217:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1234_done
+    goto rxscan1234_scan
+  rxscan1234_loop:
+    ($P10) = rx1233_cur."from"()
+    inc $P10
+    set rx1233_pos, $P10
+    ge rx1233_pos, rx1233_eos, rxscan1234_done
+  rxscan1234_scan:
+    set_addr $I10, rxscan1234_loop
+    rx1233_cur."!mark_push"(0, rx1233_pos, $I10)
+  rxscan1234_done:
+  # rxanchor bos
+    ne rx1233_pos, 0, rx1233_fail
+  # rx literal  "---"
+    add $I11, rx1233_pos, 3
+    gt $I11, rx1233_eos, rx1233_fail
+    sub $I11, rx1233_pos, rx1233_off
+    substr $S10, rx1233_tgt, $I11, 3
+    ne $S10, "---", rx1233_fail
+    add rx1233_pos, 3
+  # rx pass
+    rx1233_cur."!cursor_pass"(rx1233_pos, "")
+    if_null rx1233_debug, debug_218
+    rx1233_cur."!cursor_debug"("PASS", "", " at pos=", rx1233_pos)
+  debug_218:
+    rx1233_cur."!cursor_backtrack"()
+    .return (rx1233_cur)
+  rx1233_restart:
+    if_null rx1233_debug, debug_219
+    rx1233_cur."!cursor_debug"("NEXT", "")
+  debug_219:
+  rx1233_fail:
+    (rx1233_rep, rx1233_pos, $I10, $P10) = rx1233_cur."!mark_fail"(0)
+    lt rx1233_pos, -1, rx1233_done
+    eq rx1233_pos, -1, rx1233_fail
+    jump $I10
+  rx1233_done:
+    rx1233_cur."!cursor_fail"()
+    if_null rx1233_debug, debug_220
+    rx1233_cur."!cursor_debug"("FAIL", "")
+  debug_220:
+    .return (rx1233_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1237"  :anon :subid("47_1792415686.17671") :method :outer("44_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 236
+    .const 'Sub' $P1242 = "48_1792415686.17671" 
+    capture_lex $P1242
+    .local string rx1239_tgt
+    .local int rx1239_pos
+    .local int rx1239_off
+    .local int rx1239_eos
+    .local int rx1239_rep
+    .local pmc rx1239_cur
+    .local pmc rx1239_debug
+    (rx1239_cur, rx1239_pos, rx1239_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1239_debug, rx1239_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1239_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1239_eos, rx1239_tgt
+    gt rx1239_pos, rx1239_eos, rx1239_done
+    set rx1239_off, 0
+    lt rx1239_pos, 2, rx1239_start
+    sub rx1239_off, rx1239_pos, 1
+    substr rx1239_tgt, rx1239_tgt, rx1239_off
+  rx1239_start:
+    eq $I10, 1, rx1239_restart
+    if_null rx1239_debug, debug_223
+    rx1239_cur."!cursor_debug"("START", "")
+  debug_223:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1240_done
+    goto rxscan1240_scan
+  rxscan1240_loop:
+    ($P10) = rx1239_cur."from"()
+    inc $P10
+    set rx1239_pos, $P10
+    ge rx1239_pos, rx1239_eos, rxscan1240_done
+  rxscan1240_scan:
+    set_addr $I10, rxscan1240_loop
+    rx1239_cur."!mark_push"(0, rx1239_pos, $I10)
+  rxscan1240_done:
+  # rxanchor bos
+    ne rx1239_pos, 0, rx1239_fail
+  # rx subrule $P1242 subtype=capture negate=
+    rx1239_cur."!cursor_pos"(rx1239_pos)
+    .const 'Sub' $P1242 = "48_1792415686.17671" 
+    capture_lex $P1242
+    $P10 = rx1239_cur.$P1242()
+    unless $P10, rx1239_fail
+    goto rxsubrule1246_pass
+  rxsubrule1246_back:
+    $P10 = $P10."!cursor_next"()
+    unless $P10, rx1239_fail
+  rxsubrule1246_pass:
+    set_addr $I10, rxsubrule1246_back
+    rx1239_cur."!mark_push"(0, rx1239_pos, $I10, $P10)
+    $P10."!cursor_names"(0)
+    rx1239_pos = $P10."pos"()
+  # rx pass
+    rx1239_cur."!cursor_pass"(rx1239_pos, "")
+    if_null rx1239_debug, debug_228
+    rx1239_cur."!cursor_debug"("PASS", "", " at pos=", rx1239_pos)
+  debug_228:
+    rx1239_cur."!cursor_backtrack"()
+    .return (rx1239_cur)
+  rx1239_restart:
+    if_null rx1239_debug, debug_229
+    rx1239_cur."!cursor_debug"("NEXT", "")
+  debug_229:
+  rx1239_fail:
+    (rx1239_rep, rx1239_pos, $I10, $P10) = rx1239_cur."!mark_fail"(0)
+    lt rx1239_pos, -1, rx1239_done
+    eq rx1239_pos, -1, rx1239_fail
+    jump $I10
+  rx1239_done:
+    rx1239_cur."!cursor_fail"()
+    if_null rx1239_debug, debug_230
+    rx1239_cur."!cursor_debug"("FAIL", "")
+  debug_230:
+    .return (rx1239_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1241"  :anon :subid("48_1792415686.17671") :method :outer("47_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 236
+    .local string rx1243_tgt
+    .local int rx1243_pos
+    .local int rx1243_off
+    .local int rx1243_eos
+    .local int rx1243_rep
+    .local pmc rx1243_cur
+    .local pmc rx1243_debug
+    (rx1243_cur, rx1243_pos, rx1243_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1243_debug, rx1243_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1243_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1243_eos, rx1243_tgt
+    gt rx1243_pos, rx1243_eos, rx1243_done
+    set rx1243_off, 0
+    lt rx1243_pos, 2, rx1243_start
+    sub rx1243_off, rx1243_pos, 1
+    substr rx1243_tgt, rx1243_tgt, rx1243_off
+  rx1243_start:
+    eq $I10, 1, rx1243_restart
+    if_null rx1243_debug, debug_224
+    rx1243_cur."!cursor_debug"("START", "")
+  debug_224:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1244_done
+    goto rxscan1244_scan
+  rxscan1244_loop:
+    ($P10) = rx1243_cur."from"()
+    inc $P10
+    set rx1243_pos, $P10
+    ge rx1243_pos, rx1243_eos, rxscan1244_done
+  rxscan1244_scan:
+    set_addr $I10, rxscan1244_loop
+    rx1243_cur."!mark_push"(0, rx1243_pos, $I10)
+  rxscan1244_done:
+  # rx rxquantg1245 ** 0..*
+    set_addr $I10, rxquantg1245_done
+    rx1243_cur."!mark_push"(0, rx1243_pos, $I10)
+  rxquantg1245_loop:
+  # rx charclass s
+    ge rx1243_pos, rx1243_eos, rx1243_fail
+    sub $I10, rx1243_pos, rx1243_off
+    is_cclass $I11, 32, rx1243_tgt, $I10
+    unless $I11, rx1243_fail
+    inc rx1243_pos
+    set_addr $I10, rxquantg1245_done
+    rx1243_cur."!mark_push"(rx1243_rep, rx1243_pos, $I10)
+    goto rxquantg1245_loop
+  rxquantg1245_done:
+  # rx pass
+    rx1243_cur."!cursor_pass"(rx1243_pos, "")
+    if_null rx1243_debug, debug_225
+    rx1243_cur."!cursor_debug"("PASS", "", " at pos=", rx1243_pos)
+  debug_225:
+    rx1243_cur."!cursor_backtrack"()
+    .return (rx1243_cur)
+  rx1243_restart:
+    if_null rx1243_debug, debug_226
+    rx1243_cur."!cursor_debug"("NEXT", "")
+  debug_226:
+  rx1243_fail:
+    (rx1243_rep, rx1243_pos, $I10, $P10) = rx1243_cur."!mark_fail"(0)
+    lt rx1243_pos, -1, rx1243_done
+    eq rx1243_pos, -1, rx1243_fail
+    jump $I10
+  rx1243_done:
+    rx1243_cur."!cursor_fail"()
+    if_null rx1243_debug, debug_227
+    rx1243_cur."!cursor_debug"("FAIL", "")
+  debug_227:
+    .return (rx1243_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1256"  :anon :subid("49_1792415686.17671") :method :outer("44_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 244
+    .const 'Sub' $P1261 = "50_1792415686.17671" 
+    capture_lex $P1261
+    .local string rx1258_tgt
+    .local int rx1258_pos
+    .local int rx1258_off
+    .local int rx1258_eos
+    .local int rx1258_rep
+    .local pmc rx1258_cur
+    .local pmc rx1258_debug
+    (rx1258_cur, rx1258_pos, rx1258_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1258_debug, rx1258_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1258_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1258_eos, rx1258_tgt
+    gt rx1258_pos, rx1258_eos, rx1258_done
+    set rx1258_off, 0
+    lt rx1258_pos, 2, rx1258_start
+    sub rx1258_off, rx1258_pos, 1
+    substr rx1258_tgt, rx1258_tgt, rx1258_off
+  rx1258_start:
+    eq $I10, 1, rx1258_restart
+    if_null rx1258_debug, debug_243
+    rx1258_cur."!cursor_debug"("START", "")
+  debug_243:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1259_done
+    goto rxscan1259_scan
+  rxscan1259_loop:
+    ($P10) = rx1258_cur."from"()
+    inc $P10
+    set rx1258_pos, $P10
+    ge rx1258_pos, rx1258_eos, rxscan1259_done
+  rxscan1259_scan:
+    set_addr $I10, rxscan1259_loop
+    rx1258_cur."!mark_push"(0, rx1258_pos, $I10)
+  rxscan1259_done:
+  # rxanchor bos
+    ne rx1258_pos, 0, rx1258_fail
+  # rx subrule $P1261 subtype=capture negate=
+    rx1258_cur."!cursor_pos"(rx1258_pos)
+    .const 'Sub' $P1261 = "50_1792415686.17671" 
+    capture_lex $P1261
+    $P10 = rx1258_cur.$P1261()
+    unless $P10, rx1258_fail
+    goto rxsubrule1266_pass
+  rxsubrule1266_back:
+    $P10 = $P10."!cursor_next"()
+    unless $P10, rx1258_fail
+  rxsubrule1266_pass:
+    set_addr $I10, rxsubrule1266_back
+    rx1258_cur."!mark_push"(0, rx1258_pos, $I10, $P10)
+    $P10."!cursor_names"(0)
+    rx1258_pos = $P10."pos"()
+  # rx enumcharlist negate=1 
+    ge rx1258_pos, rx1258_eos, rx1258_fail
+    sub $I10, rx1258_pos, rx1258_off
+    substr $S10, rx1258_tgt, $I10, 1
+    index $I11, "'\"", $S10
+    ge $I11, 0, rx1258_fail
+    inc rx1258_pos
+  # rx rxquantg1267 ** 0..*
+    set_addr $I10, rxquantg1267_done
+    rx1258_cur."!mark_push"(0, rx1258_pos, $I10)
+  rxquantg1267_loop:
+  # rx charclass S
+    ge rx1258_pos, rx1258_eos, rx1258_fail
+    sub $I10, rx1258_pos, rx1258_off
+    is_cclass $I11, 32, rx1258_tgt, $I10
+    if $I11, rx1258_fail
+    inc rx1258_pos
+    set_addr $I10, rxquantg1267_done
+    rx1258_cur."!mark_push"(rx1258_rep, rx1258_pos, $I10)
+    goto rxquantg1267_loop
+  rxquantg1267_done:
+  # rx rxquantg1268 ** 0..*
+    set_addr $I10, rxquantg1268_done
+    rx1258_cur."!mark_push"(0, rx1258_pos, $I10)
+  rxquantg1268_loop:
+  # rx charclass s
+    ge rx1258_pos, rx1258_eos, rx1258_fail
+    sub $I10, rx1258_pos, rx1258_off
+    is_cclass $I11, 32, rx1258_tgt, $I10
+    unless $I11, rx1258_fail
+    inc rx1258_pos
+    set_addr $I10, rxquantg1268_done
+    rx1258_cur."!mark_push"(rx1258_rep, rx1258_pos, $I10)
+    goto rxquantg1268_loop
+  rxquantg1268_done:
+  # rx literal  ":"
+    add $I11, rx1258_pos, 1
+    gt $I11, rx1258_eos, rx1258_fail
+    sub $I11, rx1258_pos, rx1258_off
+    ord $I11, rx1258_tgt, $I11
+    ne $I11, 58, rx1258_fail
+    add rx1258_pos, 1
+  alt1269_0:
+    set_addr $I10, alt1269_1
+    rx1258_cur."!mark_push"(0, rx1258_pos, $I10)
+  # rx rxquantg1270 ** 1..*
+  rxquantg1270_loop:
+  # rx charclass s
+    ge rx1258_pos, rx1258_eos, rx1258_fail
+    sub $I10, rx1258_pos, rx1258_off
+    is_cclass $I11, 32, rx1258_tgt, $I10
+    unless $I11, rx1258_fail
+    inc rx1258_pos
+    set_addr $I10, rxquantg1270_done
+    rx1258_cur."!mark_push"(rx1258_rep, rx1258_pos, $I10)
+    goto rxquantg1270_loop
+  rxquantg1270_done:
+    goto alt1269_end
+  alt1269_1:
+  # rxanchor eos
+    ne rx1258_pos, rx1258_eos, rx1258_fail
+  alt1269_end:
+  # rx pass
+    rx1258_cur."!cursor_pass"(rx1258_pos, "")
+    if_null rx1258_debug, debug_248
+    rx1258_cur."!cursor_debug"("PASS", "", " at pos=", rx1258_pos)
+  debug_248:
+    rx1258_cur."!cursor_backtrack"()
+    .return (rx1258_cur)
+  rx1258_restart:
+    if_null rx1258_debug, debug_249
+    rx1258_cur."!cursor_debug"("NEXT", "")
+  debug_249:
+  rx1258_fail:
+    (rx1258_rep, rx1258_pos, $I10, $P10) = rx1258_cur."!mark_fail"(0)
+    lt rx1258_pos, -1, rx1258_done
+    eq rx1258_pos, -1, rx1258_fail
+    jump $I10
+  rx1258_done:
+    rx1258_cur."!cursor_fail"()
+    if_null rx1258_debug, debug_250
+    rx1258_cur."!cursor_debug"("FAIL", "")
+  debug_250:
+    .return (rx1258_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1260"  :anon :subid("50_1792415686.17671") :method :outer("49_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 244
+    .local string rx1262_tgt
+    .local int rx1262_pos
+    .local int rx1262_off
+    .local int rx1262_eos
+    .local int rx1262_rep
+    .local pmc rx1262_cur
+    .local pmc rx1262_debug
+    (rx1262_cur, rx1262_pos, rx1262_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1262_debug, rx1262_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1262_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1262_eos, rx1262_tgt
+    gt rx1262_pos, rx1262_eos, rx1262_done
+    set rx1262_off, 0
+    lt rx1262_pos, 2, rx1262_start
+    sub rx1262_off, rx1262_pos, 1
+    substr rx1262_tgt, rx1262_tgt, rx1262_off
+  rx1262_start:
+    eq $I10, 1, rx1262_restart
+    if_null rx1262_debug, debug_244
+    rx1262_cur."!cursor_debug"("START", "")
+  debug_244:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1263_done
+    goto rxscan1263_scan
+  rxscan1263_loop:
+    ($P10) = rx1262_cur."from"()
+    inc $P10
+    set rx1262_pos, $P10
+    ge rx1262_pos, rx1262_eos, rxscan1263_done
+  rxscan1263_scan:
+    set_addr $I10, rxscan1263_loop
+    rx1262_cur."!mark_push"(0, rx1262_pos, $I10)
+  rxscan1263_done:
+  # rx rxquantg1264 ** 0..*
+    set_addr $I10, rxquantg1264_done
+    rx1262_cur."!mark_push"(0, rx1262_pos, $I10)
+  rxquantg1264_loop:
+  # rx charclass s
+    ge rx1262_pos, rx1262_eos, rx1262_fail
+    sub $I10, rx1262_pos, rx1262_off
+    is_cclass $I11, 32, rx1262_tgt, $I10
+    unless $I11, rx1262_fail
+    inc rx1262_pos
+    set_addr $I10, rxquantg1264_done
+    rx1262_cur."!mark_push"(rx1262_rep, rx1262_pos, $I10)
+    goto rxquantg1264_loop
+  rxquantg1264_done:
+  # rx literal  "-"
+    add $I11, rx1262_pos, 1
+    gt $I11, rx1262_eos, rx1262_fail
+    sub $I11, rx1262_pos, rx1262_off
+    ord $I11, rx1262_tgt, $I11
+    ne $I11, 45, rx1262_fail
+    add rx1262_pos, 1
+  # rx rxquantg1265 ** 1..*
+  rxquantg1265_loop:
+  # rx charclass s
+    ge rx1262_pos, rx1262_eos, rx1262_fail
+    sub $I10, rx1262_pos, rx1262_off
+    is_cclass $I11, 32, rx1262_tgt, $I10
+    unless $I11, rx1262_fail
+    inc rx1262_pos
+    set_addr $I10, rxquantg1265_done
+    rx1262_cur."!mark_push"(rx1262_rep, rx1262_pos, $I10)
+    goto rxquantg1265_loop
+  rxquantg1265_done:
+  # rx pass
+    rx1262_cur."!cursor_pass"(rx1262_pos, "")
+    if_null rx1262_debug, debug_245
+    rx1262_cur."!cursor_debug"("PASS", "", " at pos=", rx1262_pos)
+  debug_245:
+    rx1262_cur."!cursor_backtrack"()
+    .return (rx1262_cur)
+  rx1262_restart:
+    if_null rx1262_debug, debug_246
+    rx1262_cur."!cursor_debug"("NEXT", "")
+  debug_246:
+  rx1262_fail:
+    (rx1262_rep, rx1262_pos, $I10, $P10) = rx1262_cur."!mark_fail"(0)
+    lt rx1262_pos, -1, rx1262_done
+    eq rx1262_pos, -1, rx1262_fail
+    jump $I10
+  rx1262_done:
+    rx1262_cur."!cursor_fail"()
+    if_null rx1262_debug, debug_247
+    rx1262_cur."!cursor_debug"("FAIL", "")
+  debug_247:
+    .return (rx1262_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1283"  :anon :subid("53_1792415686.17671") :method :outer("44_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 252
+    .const 'Sub' $P1295 = "55_1792415686.17671" 
+    capture_lex $P1295
+    .const 'Sub' $P1289 = "54_1792415686.17671" 
+    capture_lex $P1289
+    .local string rx1285_tgt
+    .local int rx1285_pos
+    .local int rx1285_off
+    .local int rx1285_eos
+    .local int rx1285_rep
+    .local pmc rx1285_cur
+    .local pmc rx1285_debug
+    (rx1285_cur, rx1285_pos, rx1285_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1285_debug, rx1285_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1285_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1285_eos, rx1285_tgt
+    gt rx1285_pos, rx1285_eos, rx1285_done
+    set rx1285_off, 0
+    lt rx1285_pos, 2, rx1285_start
+    sub rx1285_off, rx1285_pos, 1
+    substr rx1285_tgt, rx1285_tgt, rx1285_off
+  rx1285_start:
+    eq $I10, 1, rx1285_restart
+    if_null rx1285_debug, debug_253
+    rx1285_cur."!cursor_debug"("START", "")
+  debug_253:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1286_done
+    goto rxscan1286_scan
+  rxscan1286_loop:
+    ($P10) = rx1285_cur."from"()
+    inc $P10
+    set rx1285_pos, $P10
+    ge rx1285_pos, rx1285_eos, rxscan1286_done
+  rxscan1286_scan:
+    set_addr $I10, rxscan1286_loop
+    rx1285_cur."!mark_push"(0, rx1285_pos, $I10)
+  rxscan1286_done:
+  # rxanchor bos
+    ne rx1285_pos, 0, rx1285_fail
+  # rx rxquantg1287 ** 0..*
+    set_addr $I10, rxquantg1287_done
+    rx1285_cur."!mark_push"(0, rx1285_pos, $I10)
+  rxquantg1287_loop:
+  # rx charclass s
+    ge rx1285_pos, rx1285_eos, rx1285_fail
+    sub $I10, rx1285_pos, rx1285_off
+    is_cclass $I11, 32, rx1285_tgt, $I10
+    unless $I11, rx1285_fail
+    inc rx1285_pos
+    set_addr $I10, rxquantg1287_done
+    rx1285_cur."!mark_push"(rx1285_rep, rx1285_pos, $I10)
+    goto rxquantg1287_loop
+  rxquantg1287_done:
+  # rx literal  "-"
+    add $I11, rx1285_pos, 1
+    gt $I11, rx1285_eos, rx1285_fail
+    sub $I11, rx1285_pos, rx1285_off
+    ord $I11, rx1285_tgt, $I11
+    ne $I11, 45, rx1285_fail
+    add rx1285_pos, 1
+  # rx subrule $P1289 subtype=capture negate=
+    rx1285_cur."!cursor_pos"(rx1285_pos)
+    .const 'Sub' $P1289 = "54_1792415686.17671" 
+    capture_lex $P1289
+    $P10 = rx1285_cur.$P1289()
+    unless $P10, rx1285_fail
+    goto rxsubrule1293_pass
+  rxsubrule1293_back:
+    $P10 = $P10."!cursor_next"()
+    unless $P10, rx1285_fail
+  rxsubrule1293_pass:
+    set_addr $I10, rxsubrule1293_back
+    rx1285_cur."!mark_push"(0, rx1285_pos, $I10, $P10)
+    $P10."!cursor_names"(0)
+    rx1285_pos = $P10."pos"()
+  # rx subrule $P1295 subtype=capture negate=
+    rx1285_cur."!cursor_pos"(rx1285_pos)
+    .const 'Sub' $P1295 = "55_1792415686.17671" 
+    capture_lex $P1295
+    $P10 = rx1285_cur.$P1295()
+    unless $P10, rx1285_fail
+    goto rxsubrule1300_pass
+  rxsubrule1300_back:
+    $P10 = $P10."!cursor_next"()
+    unless $P10, rx1285_fail
+  rxsubrule1300_pass:
+    set_addr $I10, rxsubrule1300_back
+    rx1285_cur."!mark_push"(0, rx1285_pos, $I10, $P10)
+    $P10."!cursor_names"("1")
+    rx1285_pos = $P10."pos"()
+  # rx rxquantg1301 ** 0..*
+    set_addr $I10, rxquantg1301_done
+    rx1285_cur."!mark_push"(0, rx1285_pos, $I10)
+  rxquantg1301_loop:
+  # rx charclass s
+    ge rx1285_pos, rx1285_eos, rx1285_fail
+    sub $I10, rx1285_pos, rx1285_off
+    is_cclass $I11, 32, rx1285_tgt, $I10
+    unless $I11, rx1285_fail
+    inc rx1285_pos
+    set_addr $I10, rxquantg1301_done
+    rx1285_cur."!mark_push"(rx1285_rep, rx1285_pos, $I10)
+    goto rxquantg1301_loop
+  rxquantg1301_done:
+  # rxanchor eos
+    ne rx1285_pos, rx1285_eos, rx1285_fail
+  # rx pass
+    rx1285_cur."!cursor_pass"(rx1285_pos, "")
+    if_null rx1285_debug, debug_262
+    rx1285_cur."!cursor_debug"("PASS", "", " at pos=", rx1285_pos)
+  debug_262:
+    rx1285_cur."!cursor_backtrack"()
+    .return (rx1285_cur)
+  rx1285_restart:
+    if_null rx1285_debug, debug_263
+    rx1285_cur."!cursor_debug"("NEXT", "")
+  debug_263:
+  rx1285_fail:
+    (rx1285_rep, rx1285_pos, $I10, $P10) = rx1285_cur."!mark_fail"(0)
+    lt rx1285_pos, -1, rx1285_done
+    eq rx1285_pos, -1, rx1285_fail
+    jump $I10
+  rx1285_done:
+    rx1285_cur."!cursor_fail"()
+    if_null rx1285_debug, debug_264
+    rx1285_cur."!cursor_debug"("FAIL", "")
+  debug_264:
+    .return (rx1285_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1288"  :anon :subid("54_1792415686.17671") :method :outer("53_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 252
+    .local string rx1290_tgt
+    .local int rx1290_pos
+    .local int rx1290_off
+    .local int rx1290_eos
+    .local int rx1290_rep
+    .local pmc rx1290_cur
+    .local pmc rx1290_debug
+    (rx1290_cur, rx1290_pos, rx1290_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1290_debug, rx1290_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1290_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1290_eos, rx1290_tgt
+    gt rx1290_pos, rx1290_eos, rx1290_done
+    set rx1290_off, 0
+    lt rx1290_pos, 2, rx1290_start
+    sub rx1290_off, rx1290_pos, 1
+    substr rx1290_tgt, rx1290_tgt, rx1290_off
+  rx1290_start:
+    eq $I10, 1, rx1290_restart
+    if_null rx1290_debug, debug_254
+    rx1290_cur."!cursor_debug"("START", "")
+  debug_254:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1291_done
+    goto rxscan1291_scan
+  rxscan1291_loop:
+    ($P10) = rx1290_cur."from"()
+    inc $P10
+    set rx1290_pos, $P10
+    ge rx1290_pos, rx1290_eos, rxscan1291_done
+  rxscan1291_scan:
+    set_addr $I10, rxscan1291_loop
+    rx1290_cur."!mark_push"(0, rx1290_pos, $I10)
+  rxscan1291_done:
+  # rx rxquantg1292 ** 0..*
+    set_addr $I10, rxquantg1292_done
+    rx1290_cur."!mark_push"(0, rx1290_pos, $I10)
+  rxquantg1292_loop:
+  # rx charclass s
+    ge rx1290_pos, rx1290_eos, rx1290_fail
+    sub $I10, rx1290_pos, rx1290_off
+    is_cclass $I11, 32, rx1290_tgt, $I10
+    unless $I11, rx1290_fail
+    inc rx1290_pos
+    set_addr $I10, rxquantg1292_done
+    rx1290_cur."!mark_push"(rx1290_rep, rx1290_pos, $I10)
+    goto rxquantg1292_loop
+  rxquantg1292_done:
+  # rx pass
+    rx1290_cur."!cursor_pass"(rx1290_pos, "")
+    if_null rx1290_debug, debug_255
+    rx1290_cur."!cursor_debug"("PASS", "", " at pos=", rx1290_pos)
+  debug_255:
+    rx1290_cur."!cursor_backtrack"()
+    .return (rx1290_cur)
+  rx1290_restart:
+    if_null rx1290_debug, debug_256
+    rx1290_cur."!cursor_debug"("NEXT", "")
+  debug_256:
+  rx1290_fail:
+    (rx1290_rep, rx1290_pos, $I10, $P10) = rx1290_cur."!mark_fail"(0)
+    lt rx1290_pos, -1, rx1290_done
+    eq rx1290_pos, -1, rx1290_fail
+    jump $I10
+  rx1290_done:
+    rx1290_cur."!cursor_fail"()
+    if_null rx1290_debug, debug_257
+    rx1290_cur."!cursor_debug"("FAIL", "")
+  debug_257:
+    .return (rx1290_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1294"  :anon :subid("55_1792415686.17671") :method :outer("53_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 252
+    .local string rx1296_tgt
+    .local int rx1296_pos
+    .local int rx1296_off
+    .local int rx1296_eos
+    .local int rx1296_rep
+    .local pmc rx1296_cur
+    .local pmc rx1296_debug
+    (rx1296_cur, rx1296_pos, rx1296_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1296_debug, rx1296_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1296_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1296_eos, rx1296_tgt
+    gt rx1296_pos, rx1296_eos, rx1296_done
+    set rx1296_off, 0
+    lt rx1296_pos, 2, rx1296_start
+    sub rx1296_off, rx1296_pos, 1
+    substr rx1296_tgt, rx1296_tgt, rx1296_off
+  rx1296_start:
+    eq $I10, 1, rx1296_restart
+    if_null rx1296_debug, debug_258
+    rx1296_cur."!cursor_debug"("START", "")
+  debug_258:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1297_done
+    goto rxscan1297_scan
+  rxscan1297_loop:
+    ($P10) = rx1296_cur."from"()
+    inc $P10
+    set rx1296_pos, $P10
+    ge rx1296_pos, rx1296_eos, rxscan1297_done
+  rxscan1297_scan:
+    set_addr $I10, rxscan1297_loop
+    rx1296_cur."!mark_push"(0, rx1296_pos, $I10)
+  rxscan1297_done:
+  # rx rxquantf1298 ** 1..*
+  rxquantf1298_loop:
+  # rx charclass .
+    ge rx1296_pos, rx1296_eos, rx1296_fail
+    inc rx1296_pos
+    set_addr $I10, rxquantf1298_loop
+    rx1296_cur."!mark_push"(rx1296_rep, rx1296_pos, $I10)
+  rxquantf1298_done:
+  # rx pass
+    rx1296_cur."!cursor_pass"(rx1296_pos, "")
+    if_null rx1296_debug, debug_259
+    rx1296_cur."!cursor_debug"("PASS", "", " at pos=", rx1296_pos)
+  debug_259:
+    rx1296_cur."!cursor_backtrack"()
+    .return (rx1296_cur)
+  rx1296_restart:
+    if_null rx1296_debug, debug_260
+    rx1296_cur."!cursor_debug"("NEXT", "")
+  debug_260:
+  rx1296_fail:
+    (rx1296_rep, rx1296_pos, $I10, $P10) = rx1296_cur."!mark_fail"(0)
+    lt rx1296_pos, -1, rx1296_done
+    eq rx1296_pos, -1, rx1296_fail
+    jump $I10
+  rx1296_done:
+    rx1296_cur."!cursor_fail"()
+    if_null rx1296_debug, debug_261
+    rx1296_cur."!cursor_debug"("FAIL", "")
+  debug_261:
+    .return (rx1296_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1305"  :anon :subid("56_1792415686.17671") :method :outer("44_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 257
+    .local string rx1307_tgt
+    .local int rx1307_pos
+    .local int rx1307_off
+    .local int rx1307_eos
+    .local int rx1307_rep
+    .local pmc rx1307_cur
+    .local pmc rx1307_debug
+    (rx1307_cur, rx1307_pos, rx1307_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1307_debug, rx1307_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1307_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1307_eos, rx1307_tgt
+    gt rx1307_pos, rx1307_eos, rx1307_done
+    set rx1307_off, 0
+    lt rx1307_pos, 2, rx1307_start
+    sub rx1307_off, rx1307_pos, 1
+    substr rx1307_tgt, rx1307_tgt, rx1307_off
+  rx1307_start:
+    eq $I10, 1, rx1307_restart
+    if_null rx1307_debug, debug_267
+    rx1307_cur."!cursor_debug"("START", "")
+  debug_267:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1308_done
+    goto rxscan1308_scan
+  rxscan1308_loop:
+    ($P10) = rx1307_cur."from"()
+    inc $P10
+    set rx1307_pos, $P10
+    ge rx1307_pos, rx1307_eos, rxscan1308_done
+  rxscan1308_scan:
+    set_addr $I10, rxscan1308_loop
+    rx1307_cur."!mark_push"(0, rx1307_pos, $I10)
+  rxscan1308_done:
+  # rxanchor bos
+    ne rx1307_pos, 0, rx1307_fail
+  # rx rxquantg1309 ** 0..*
+    set_addr $I10, rxquantg1309_done
+    rx1307_cur."!mark_push"(0, rx1307_pos, $I10)
+  rxquantg1309_loop:
+  # rx charclass s
+    ge rx1307_pos, rx1307_eos, rx1307_fail
+    sub $I10, rx1307_pos, rx1307_off
+    is_cclass $I11, 32, rx1307_tgt, $I10
+    unless $I11, rx1307_fail
+    inc rx1307_pos
+    set_addr $I10, rxquantg1309_done
+    rx1307_cur."!mark_push"(rx1307_rep, rx1307_pos, $I10)
+    goto rxquantg1309_loop
+  rxquantg1309_done:
+  # rx literal  "-"
+    add $I11, rx1307_pos, 1
+    gt $I11, rx1307_eos, rx1307_fail
+    sub $I11, rx1307_pos, rx1307_off
+    ord $I11, rx1307_tgt, $I11
+    ne $I11, 45, rx1307_fail
+    add rx1307_pos, 1
+  # rx rxquantg1310 ** 0..*
+    set_addr $I10, rxquantg1310_done
+    rx1307_cur."!mark_push"(0, rx1307_pos, $I10)
+  rxquantg1310_loop:
+  # rx charclass s
+    ge rx1307_pos, rx1307_eos, rx1307_fail
+    sub $I10, rx1307_pos, rx1307_off
+    is_cclass $I11, 32, rx1307_tgt, $I10
+    unless $I11, rx1307_fail
+    inc rx1307_pos
+    set_addr $I10, rxquantg1310_done
+    rx1307_cur."!mark_push"(rx1307_rep, rx1307_pos, $I10)
+    goto rxquantg1310_loop
+  rxquantg1310_done:
+  # rxanchor eos
+    ne rx1307_pos, rx1307_eos, rx1307_fail
+  # rx pass
+    rx1307_cur."!cursor_pass"(rx1307_pos, "")
+    if_null rx1307_debug, debug_268
+    rx1307_cur."!cursor_debug"("PASS", "", " at pos=", rx1307_pos)
+  debug_268:
+    rx1307_cur."!cursor_backtrack"()
+    .return (rx1307_cur)
+  rx1307_restart:
+    if_null rx1307_debug, debug_269
+    rx1307_cur."!cursor_debug"("NEXT", "")
+  debug_269:
+  rx1307_fail:
+    (rx1307_rep, rx1307_pos, $I10, $P10) = rx1307_cur."!mark_fail"(0)
+    lt rx1307_pos, -1, rx1307_done
+    eq rx1307_pos, -1, rx1307_fail
+    jump $I10
+  rx1307_done:
+    rx1307_cur."!cursor_fail"()
+    if_null rx1307_debug, debug_270
+    rx1307_cur."!cursor_debug"("FAIL", "")
+  debug_270:
+    .return (rx1307_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1314"  :anon :subid("57_1792415686.17671") :method :outer("44_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 264
+    .const 'Sub' $P1319 = "58_1792415686.17671" 
+    capture_lex $P1319
+    .local string rx1316_tgt
+    .local int rx1316_pos
+    .local int rx1316_off
+    .local int rx1316_eos
+    .local int rx1316_rep
+    .local pmc rx1316_cur
+    .local pmc rx1316_debug
+    (rx1316_cur, rx1316_pos, rx1316_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1316_debug, rx1316_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1316_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1316_eos, rx1316_tgt
+    gt rx1316_pos, rx1316_eos, rx1316_done
+    set rx1316_off, 0
+    lt rx1316_pos, 2, rx1316_start
+    sub rx1316_off, rx1316_pos, 1
+    substr rx1316_tgt, rx1316_tgt, rx1316_off
+  rx1316_start:
+    eq $I10, 1, rx1316_restart
+    if_null rx1316_debug, debug_279
+    rx1316_cur."!cursor_debug"("START", "")
+  debug_279:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1317_done
+    goto rxscan1317_scan
+  rxscan1317_loop:
+    ($P10) = rx1316_cur."from"()
+    inc $P10
+    set rx1316_pos, $P10
+    ge rx1316_pos, rx1316_eos, rxscan1317_done
+  rxscan1317_scan:
+    set_addr $I10, rxscan1317_loop
+    rx1316_cur."!mark_push"(0, rx1316_pos, $I10)
+  rxscan1317_done:
+  # rxanchor bos
+    ne rx1316_pos, 0, rx1316_fail
+  # rx subrule $P1319 subtype=capture negate=
+    rx1316_cur."!cursor_pos"(rx1316_pos)
+    .const 'Sub' $P1319 = "58_1792415686.17671" 
+    capture_lex $P1319
+    $P10 = rx1316_cur.$P1319()
+    unless $P10, rx1316_fail
+    goto rxsubrule1323_pass
+  rxsubrule1323_back:
+    $P10 = $P10."!cursor_next"()
+    unless $P10, rx1316_fail
+  rxsubrule1323_pass:
+    set_addr $I10, rxsubrule1323_back
+    rx1316_cur."!mark_push"(0, rx1316_pos, $I10, $P10)
+    $P10."!cursor_names"(0)
+    rx1316_pos = $P10."pos"()
+  # rx literal  "-"
+    add $I11, rx1316_pos, 1
+    gt $I11, rx1316_eos, rx1316_fail
+    sub $I11, rx1316_pos, rx1316_off
+    ord $I11, rx1316_tgt, $I11
+    ne $I11, 45, rx1316_fail
+    add rx1316_pos, 1
+  # rx pass
+    rx1316_cur."!cursor_pass"(rx1316_pos, "")
+    if_null rx1316_debug, debug_284
+    rx1316_cur."!cursor_debug"("PASS", "", " at pos=", rx1316_pos)
+  debug_284:
+    rx1316_cur."!cursor_backtrack"()
+    .return (rx1316_cur)
+  rx1316_restart:
+    if_null rx1316_debug, debug_285
+    rx1316_cur."!cursor_debug"("NEXT", "")
+  debug_285:
+  rx1316_fail:
+    (rx1316_rep, rx1316_pos, $I10, $P10) = rx1316_cur."!mark_fail"(0)
+    lt rx1316_pos, -1, rx1316_done
+    eq rx1316_pos, -1, rx1316_fail
+    jump $I10
+  rx1316_done:
+    rx1316_cur."!cursor_fail"()
+    if_null rx1316_debug, debug_286
+    rx1316_cur."!cursor_debug"("FAIL", "")
+  debug_286:
+    .return (rx1316_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1318"  :anon :subid("58_1792415686.17671") :method :outer("57_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 264
+    .local string rx1320_tgt
+    .local int rx1320_pos
+    .local int rx1320_off
+    .local int rx1320_eos
+    .local int rx1320_rep
+    .local pmc rx1320_cur
+    .local pmc rx1320_debug
+    (rx1320_cur, rx1320_pos, rx1320_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1320_debug, rx1320_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1320_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1320_eos, rx1320_tgt
+    gt rx1320_pos, rx1320_eos, rx1320_done
+    set rx1320_off, 0
+    lt rx1320_pos, 2, rx1320_start
+    sub rx1320_off, rx1320_pos, 1
+    substr rx1320_tgt, rx1320_tgt, rx1320_off
+  rx1320_start:
+    eq $I10, 1, rx1320_restart
+    if_null rx1320_debug, debug_280
+    rx1320_cur."!cursor_debug"("START", "")
+  debug_280:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1321_done
+    goto rxscan1321_scan
+  rxscan1321_loop:
+    ($P10) = rx1320_cur."from"()
+    inc $P10
+    set rx1320_pos, $P10
+    ge rx1320_pos, rx1320_eos, rxscan1321_done
+  rxscan1321_scan:
+    set_addr $I10, rxscan1321_loop
+    rx1320_cur."!mark_push"(0, rx1320_pos, $I10)
+  rxscan1321_done:
+  # rx rxquantg1322 ** 0..*
+    set_addr $I10, rxquantg1322_done
+    rx1320_cur."!mark_push"(0, rx1320_pos, $I10)
+  rxquantg1322_loop:
+  # rx charclass s
+    ge rx1320_pos, rx1320_eos, rx1320_fail
+    sub $I10, rx1320_pos, rx1320_off
+    is_cclass $I11, 32, rx1320_tgt, $I10
+    unless $I11, rx1320_fail
+    inc rx1320_pos
+    set_addr $I10, rxquantg1322_done
+    rx1320_cur."!mark_push"(rx1320_rep, rx1320_pos, $I10)
+    goto rxquantg1322_loop
+  rxquantg1322_done:
+  # rx pass
+    rx1320_cur."!cursor_pass"(rx1320_pos, "")
+    if_null rx1320_debug, debug_281
+    rx1320_cur."!cursor_debug"("PASS", "", " at pos=", rx1320_pos)
+  debug_281:
+    rx1320_cur."!cursor_backtrack"()
+    .return (rx1320_cur)
+  rx1320_restart:
+    if_null rx1320_debug, debug_282
+    rx1320_cur."!cursor_debug"("NEXT", "")
+  debug_282:
+  rx1320_fail:
+    (rx1320_rep, rx1320_pos, $I10, $P10) = rx1320_cur."!mark_fail"(0)
+    lt rx1320_pos, -1, rx1320_done
+    eq rx1320_pos, -1, rx1320_fail
+    jump $I10
+  rx1320_done:
+    rx1320_cur."!cursor_fail"()
+    if_null rx1320_debug, debug_283
+    rx1320_cur."!cursor_debug"("FAIL", "")
+  debug_283:
+    .return (rx1320_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1333"  :anon :subid("60_1792415686.17671") :method :outer("44_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 277
+    .const 'Sub' $P1338 = "61_1792415686.17671" 
+    capture_lex $P1338
+    .local string rx1335_tgt
+    .local int rx1335_pos
+    .local int rx1335_off
+    .local int rx1335_eos
+    .local int rx1335_rep
+    .local pmc rx1335_cur
+    .local pmc rx1335_debug
+    (rx1335_cur, rx1335_pos, rx1335_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1335_debug, rx1335_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1335_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1335_eos, rx1335_tgt
+    gt rx1335_pos, rx1335_eos, rx1335_done
+    set rx1335_off, 0
+    lt rx1335_pos, 2, rx1335_start
+    sub rx1335_off, rx1335_pos, 1
+    substr rx1335_tgt, rx1335_tgt, rx1335_off
+  rx1335_start:
+    eq $I10, 1, rx1335_restart
+    if_null rx1335_debug, debug_289
+    rx1335_cur."!cursor_debug"("START", "")
+  debug_289:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1336_done
+    goto rxscan1336_scan
+  rxscan1336_loop:
+    ($P10) = rx1335_cur."from"()
+    inc $P10
+    set rx1335_pos, $P10
+    ge rx1335_pos, rx1335_eos, rxscan1336_done
+  rxscan1336_scan:
+    set_addr $I10, rxscan1336_loop
+    rx1335_cur."!mark_push"(0, rx1335_pos, $I10)
+  rxscan1336_done:
+  # rxanchor bos
+    ne rx1335_pos, 0, rx1335_fail
+  # rx subrule $P1338 subtype=capture negate=
+    rx1335_cur."!cursor_pos"(rx1335_pos)
+    .const 'Sub' $P1338 = "61_1792415686.17671" 
+    capture_lex $P1338
+    $P10 = rx1335_cur.$P1338()
+    unless $P10, rx1335_fail
+    goto rxsubrule1342_pass
+  rxsubrule1342_back:
+    $P10 = $P10."!cursor_next"()
+    unless $P10, rx1335_fail
+  rxsubrule1342_pass:
+    set_addr $I10, rxsubrule1342_back
+    rx1335_cur."!mark_push"(0, rx1335_pos, $I10, $P10)
+    $P10."!cursor_names"(0)
+    rx1335_pos = $P10."pos"()
+  # rx charclass S
+    ge rx1335_pos, rx1335_eos, rx1335_fail
+    sub $I10, rx1335_pos, rx1335_off
+    is_cclass $I11, 32, rx1335_tgt, $I10
+    if $I11, rx1335_fail
+    inc rx1335_pos
+  # rx pass
+    rx1335_cur."!cursor_pass"(rx1335_pos, "")
+    if_null rx1335_debug, debug_294
+    rx1335_cur."!cursor_debug"("PASS", "", " at pos=", rx1335_pos)
+  debug_294:
+    rx1335_cur."!cursor_backtrack"()
+    .return (rx1335_cur)
+  rx1335_restart:
+    if_null rx1335_debug, debug_295
+    rx1335_cur."!cursor_debug"("NEXT", "")
+  debug_295:
+  rx1335_fail:
+    (rx1335_rep, rx1335_pos, $I10, $P10) = rx1335_cur."!mark_fail"(0)
+    lt rx1335_pos, -1, rx1335_done
+    eq rx1335_pos, -1, rx1335_fail
+    jump $I10
+  rx1335_done:
+    rx1335_cur."!cursor_fail"()
+    if_null rx1335_debug, debug_296
+    rx1335_cur."!cursor_debug"("FAIL", "")
+  debug_296:
+    .return (rx1335_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1337"  :anon :subid("61_1792415686.17671") :method :outer("60_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 277
+    .local string rx1339_tgt
+    .local int rx1339_pos
+    .local int rx1339_off
+    .local int rx1339_eos
+    .local int rx1339_rep
+    .local pmc rx1339_cur
+    .local pmc rx1339_debug
+    (rx1339_cur, rx1339_pos, rx1339_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1339_debug, rx1339_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1339_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1339_eos, rx1339_tgt
+    gt rx1339_pos, rx1339_eos, rx1339_done
+    set rx1339_off, 0
+    lt rx1339_pos, 2, rx1339_start
+    sub rx1339_off, rx1339_pos, 1
+    substr rx1339_tgt, rx1339_tgt, rx1339_off
+  rx1339_start:
+    eq $I10, 1, rx1339_restart
+    if_null rx1339_debug, debug_290
+    rx1339_cur."!cursor_debug"("START", "")
+  debug_290:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1340_done
+    goto rxscan1340_scan
+  rxscan1340_loop:
+    ($P10) = rx1339_cur."from"()
+    inc $P10
+    set rx1339_pos, $P10
+    ge rx1339_pos, rx1339_eos, rxscan1340_done
+  rxscan1340_scan:
+    set_addr $I10, rxscan1340_loop
+    rx1339_cur."!mark_push"(0, rx1339_pos, $I10)
+  rxscan1340_done:
+  # rx rxquantg1341 ** 0..*
+    set_addr $I10, rxquantg1341_done
+    rx1339_cur."!mark_push"(0, rx1339_pos, $I10)
+  rxquantg1341_loop:
+  # rx charclass s
+    ge rx1339_pos, rx1339_eos, rx1339_fail
+    sub $I10, rx1339_pos, rx1339_off
+    is_cclass $I11, 32, rx1339_tgt, $I10
+    unless $I11, rx1339_fail
+    inc rx1339_pos
+    set_addr $I10, rxquantg1341_done
+    rx1339_cur."!mark_push"(rx1339_rep, rx1339_pos, $I10)
+    goto rxquantg1341_loop
+  rxquantg1341_done:
+  # rx pass
+    rx1339_cur."!cursor_pass"(rx1339_pos, "")
+    if_null rx1339_debug, debug_291
+    rx1339_cur."!cursor_debug"("PASS", "", " at pos=", rx1339_pos)
+  debug_291:
+    rx1339_cur."!cursor_backtrack"()
+    .return (rx1339_cur)
+  rx1339_restart:
+    if_null rx1339_debug, debug_292
+    rx1339_cur."!cursor_debug"("NEXT", "")
+  debug_292:
+  rx1339_fail:
+    (rx1339_rep, rx1339_pos, $I10, $P10) = rx1339_cur."!mark_fail"(0)
+    lt rx1339_pos, -1, rx1339_done
+    eq rx1339_pos, -1, rx1339_fail
+    jump $I10
+  rx1339_done:
+    rx1339_cur."!cursor_fail"()
+    if_null rx1339_debug, debug_293
+    rx1339_cur."!cursor_debug"("FAIL", "")
+  debug_293:
+    .return (rx1339_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1325"  :anon :subid("59_1792415686.17671") :outer("44_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 265
+    new $P130, "Undef"
+    set $P1327, $P130
+    .lex "$indent2", $P1327
+    find_lex $P1328, "$m"
+    unless_null $P1328, vivify_305
+    $P1328 = root_new ['parrot';'ResizablePMCArray']
+  vivify_305:
+    set $P131, $P1328[0]
+    unless_null $P131, vivify_306
+    new $P131, "Undef"
+  vivify_306:
+    $P132 = "length"($P131)
+    store_lex "$indent2", $P132
+.annotate 'line', 266
+    find_lex $P1330, "@indent"
+    unless_null $P1330, vivify_307
+    $P1330 = root_new ['parrot';'ResizablePMCArray']
+  vivify_307:
+    set $P132, $P1330[-1]
+    unless_null $P132, vivify_308
+    new $P132, "Undef"
+  vivify_308:
+    set $N100, $P132
+    find_lex $P133, "$indent2"
+    set $N101, $P133
+    iseq $I101, $N100, $N101
+    if $I101, if_1329
+.annotate 'line', 272
+    find_lex $P134, "@array"
+    new $P135, "ResizablePMCArray"
+    $P134."push"($P135)
+.annotate 'line', 273
+    find_lex $P134, "self"
+    find_lex $P1331, "@array"
+    unless_null $P1331, vivify_309
+    $P1331 = root_new ['parrot';'ResizablePMCArray']
+  vivify_309:
+    set $P135, $P1331[-1]
+    unless_null $P135, vivify_310
+    new $P135, "Undef"
+  vivify_310:
+    find_lex $P137, "@indent"
+    find_lex $P138, "$indent2"
+    new $P139, "ResizablePMCArray"
+    push $P139, $P137
+    push $P139, $P138
+    find_lex $P140, "@lines"
+    $P141 = $P134."_read_array"($P135, $P139, $P140)
+.annotate 'line', 270
+    set $P131, $P141
+.annotate 'line', 266
+    goto if_1329_end
+  if_1329:
+.annotate 'line', 268
+    find_lex $P134, "@array"
+    get_hll_global $P135, "undef"
+    $P136 = $P134."push"($P135)
+.annotate 'line', 266
+    set $P131, $P136
+  if_1329_end:
+.annotate 'line', 264
+    .return ($P131)
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1272"  :anon :subid("51_1792415686.17671") :outer("44_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 244
+    .const 'Sub' $P1278 = "52_1792415686.17671" 
+    capture_lex $P1278
+.annotate 'line', 247
+    new $P111, "Undef"
+    set $P1274, $P111
+    .lex "$indent2", $P1274
+.annotate 'line', 246
+    find_lex $P112, "$m"
+    "debug"("Inline nested hash", $P112)
+.annotate 'line', 247
+    find_lex $P1275, "$m"
+    unless_null $P1275, vivify_313
+    $P1275 = root_new ['parrot';'ResizablePMCArray']
+  vivify_313:
+    set $P112, $P1275[0]
+    unless_null $P112, vivify_314
+    new $P112, "Undef"
+  vivify_314:
+    $P113 = "length"($P112)
+    store_lex "$indent2", $P113
+.annotate 'line', 248
+    find_lex $P1276, "@lines"
+    unless_null $P1276, vivify_315
+    $P1276 = root_new ['parrot';'ResizablePMCArray']
+  vivify_315:
+    set $P112, $P1276[0]
+    unless_null $P112, vivify_316
+    new $P112, "Undef"
+  vivify_316:
+    get_hll_global $P113, ["Regex"], "Regex"
+    .const 'Sub' $P1278 = "52_1792415686.17671" 
+    capture_lex $P1278
+    $P114 = $P113."new"($P1278)
+    "subst"($P112, $P114, " ")
+.annotate 'line', 249
+    find_lex $P112, "@array"
+    $P113 = "hash"()
+    $P112."push"($P113)
+.annotate 'line', 250
+    find_lex $P112, "self"
+    find_lex $P1281, "@array"
+    unless_null $P1281, vivify_321
+    $P1281 = root_new ['parrot';'ResizablePMCArray']
+  vivify_321:
+    set $P113, $P1281[-1]
+    unless_null $P113, vivify_322
+    new $P113, "Undef"
+  vivify_322:
+    find_lex $P114, "@indent"
+    find_lex $P115, "$indent2"
+    new $P116, "ResizablePMCArray"
+    push $P116, $P114
+    push $P116, $P115
+    find_lex $P117, "@lines"
+    $P118 = $P112."_read_hash"($P113, $P116, $P117)
+.annotate 'line', 244
+    .return ($P118)
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1277"  :anon :subid("52_1792415686.17671") :method :outer("51_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 248
+    .local string rx1279_tgt
+    .local int rx1279_pos
+    .local int rx1279_off
+    .local int rx1279_eos
+    .local int rx1279_rep
+    .local pmc rx1279_cur
+    .local pmc rx1279_debug
+    (rx1279_cur, rx1279_pos, rx1279_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1279_debug, rx1279_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1279_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1279_eos, rx1279_tgt
+    gt rx1279_pos, rx1279_eos, rx1279_done
+    set rx1279_off, 0
+    lt rx1279_pos, 2, rx1279_start
+    sub rx1279_off, rx1279_pos, 1
+    substr rx1279_tgt, rx1279_tgt, rx1279_off
+  rx1279_start:
+    eq $I10, 1, rx1279_restart
+    if_null rx1279_debug, debug_317
+    rx1279_cur."!cursor_debug"("START", "")
+  debug_317:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1280_done
+    goto rxscan1280_scan
+  rxscan1280_loop:
+    ($P10) = rx1279_cur."from"()
+    inc $P10
+    set rx1279_pos, $P10
+    ge rx1279_pos, rx1279_eos, rxscan1280_done
+  rxscan1280_scan:
+    set_addr $I10, rxscan1280_loop
+    rx1279_cur."!mark_push"(0, rx1279_pos, $I10)
+  rxscan1280_done:
+  # rx literal  "-"
+    add $I11, rx1279_pos, 1
+    gt $I11, rx1279_eos, rx1279_fail
+    sub $I11, rx1279_pos, rx1279_off
+    ord $I11, rx1279_tgt, $I11
+    ne $I11, 45, rx1279_fail
+    add rx1279_pos, 1
+  # rx pass
+    rx1279_cur."!cursor_pass"(rx1279_pos, "")
+    if_null rx1279_debug, debug_318
+    rx1279_cur."!cursor_debug"("PASS", "", " at pos=", rx1279_pos)
+  debug_318:
+    rx1279_cur."!cursor_backtrack"()
+    .return (rx1279_cur)
+  rx1279_restart:
+    if_null rx1279_debug, debug_319
+    rx1279_cur."!cursor_debug"("NEXT", "")
+  debug_319:
+  rx1279_fail:
+    (rx1279_rep, rx1279_pos, $I10, $P10) = rx1279_cur."!mark_fail"(0)
+    lt rx1279_pos, -1, rx1279_done
+    eq rx1279_pos, -1, rx1279_fail
+    jump $I10
+  rx1279_done:
+    rx1279_cur."!cursor_fail"()
+    if_null rx1279_debug, debug_320
+    rx1279_cur."!cursor_debug"("FAIL", "")
+  debug_320:
+    .return (rx1279_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.include "except_types.pasm"
+.sub "_read_hash"  :subid("62_1792415686.17671") :method :outer("11_1792415686.17671")
+    .param pmc param_1356
+    .param pmc param_1357
+    .param pmc param_1358
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 305
+    .const 'Sub' $P1360 = "63_1792415686.17671" 
+    capture_lex $P1360
+    new $P1355, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1355, control_1354
+    push_eh $P1355
+    .lex "self", self
+    .lex "%hash", param_1356
+    .lex "@indent", param_1357
+    .lex "@lines", param_1358
+.annotate 'line', 307
+    new $P108, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P108, loop1485_handler
+    push_eh $P108
+  loop1485_test:
+    find_lex $P104, "@lines"
+    set $N100, $P104
+    unless $N100, loop1485_done
+  loop1485_redo:
+    .const 'Sub' $P1360 = "63_1792415686.17671" 
+    capture_lex $P1360
+    $P1360()
+  loop1485_next:
+    goto loop1485_test
+  loop1485_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P109, exception, 'type'
+    eq $P109, .CONTROL_LOOP_NEXT, loop1485_next
+    eq $P109, .CONTROL_LOOP_REDO, loop1485_redo
+  loop1485_done:
+    pop_eh 
+.annotate 'line', 305
+    .return (1)
+  control_1354:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P104, exception, "payload"
+    .return ($P104)
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.include "except_types.pasm"
+.sub "_block1359"  :anon :subid("63_1792415686.17671") :outer("62_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 307
+    .const 'Sub' $P1475 = "77_1792415686.17671" 
+    capture_lex $P1475
+    .const 'Sub' $P1464 = "75_1792415686.17671" 
+    capture_lex $P1464
+    .const 'Sub' $P1449 = "73_1792415686.17671" 
+    capture_lex $P1449
+    .const 'Sub' $P1417 = "70_1792415686.17671" 
+    capture_lex $P1417
+    .const 'Sub' $P1397 = "68_1792415686.17671" 
+    capture_lex $P1397
+    .const 'Sub' $P1378 = "66_1792415686.17671" 
+    capture_lex $P1378
+    .const 'Sub' $P1372 = "65_1792415686.17671" 
+    capture_lex $P1372
+    .const 'Sub' $P1365 = "64_1792415686.17671" 
+    capture_lex $P1365
+.annotate 'line', 317
+    new $P105, "Undef"
+    set $P1361, $P105
+    .lex "$m", $P1361
+.annotate 'line', 338
+    new $P106, "Undef"
+    set $P1362, $P106
+    .lex "$key", $P1362
+.annotate 'line', 309
+    get_hll_global $P107, ["Regex"], "Regex"
+    .const 'Sub' $P1365 = "64_1792415686.17671" 
+    capture_lex $P1365
+    $P108 = $P107."new"($P1365)
+    find_lex $P1369, "@lines"
+    unless_null $P1369, vivify_327
+    $P1369 = root_new ['parrot';'ResizablePMCArray']
+  vivify_327:
+    set $P109, $P1369[0]
+    unless_null $P109, vivify_328
+    new $P109, "Undef"
+  vivify_328:
+    $P110 = $P108."ACCEPTS"($P109)
+    unless $P110, if_1363_end
+.annotate 'line', 310
+    new $P117, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P117, loop1376_handler
+    push_eh $P117
+  loop1376_test:
+    find_lex $P112, "@lines"
+    if $P112, if_1370
+    set $P111, $P112
+    goto if_1370_end
+  if_1370:
+    get_hll_global $P113, ["Regex"], "Regex"
+    .const 'Sub' $P1372 = "65_1792415686.17671" 
+    capture_lex $P1372
+    $P114 = $P113."new"($P1372)
+    find_lex $P1375, "@lines"
+    unless_null $P1375, vivify_333
+    $P1375 = root_new ['parrot';'ResizablePMCArray']
+  vivify_333:
+    set $P115, $P1375[0]
+    unless_null $P115, vivify_334
+    new $P115, "Undef"
+  vivify_334:
+    $P116 = $P114."ACCEPTS"($P115)
+    isfalse $I101, $P116
+    new $P111, 'Integer'
+    set $P111, $I101
+  if_1370_end:
+    unless $P111, loop1376_done
+  loop1376_redo:
+.annotate 'line', 311
+    find_lex $P117, "@lines"
+    $P117."shift"()
+  loop1376_next:
+.annotate 'line', 310
+    goto loop1376_test
+  loop1376_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P118, exception, 'type'
+    eq $P118, .CONTROL_LOOP_NEXT, loop1376_next
+    eq $P118, .CONTROL_LOOP_REDO, loop1376_redo
+  loop1376_done:
+    pop_eh 
+.annotate 'line', 313
+    new $P111, "Exception"
+    set $P111['type'], .CONTROL_RETURN
+    new $P112, "Integer"
+    assign $P112, 1
+    setattribute $P111, 'payload', $P112
+    throw $P111
+  if_1363_end:
+.annotate 'line', 317
+    get_hll_global $P107, ["Regex"], "Regex"
+    .const 'Sub' $P1378 = "66_1792415686.17671" 
+    capture_lex $P1378
+    $P108 = $P107."new"($P1378)
+    find_lex $P1387, "@lines"
+    unless_null $P1387, vivify_343
+    $P1387 = root_new ['parrot';'ResizablePMCArray']
+  vivify_343:
+    set $P109, $P1387[0]
+    unless_null $P109, vivify_344
+    new $P109, "Undef"
+  vivify_344:
+    $P110 = $P108."ACCEPTS"($P109)
+    store_lex "$m", $P110
+.annotate 'line', 318
+    find_lex $P107, "$m"
+    find_lex $P1388, "@indent"
+    unless_null $P1388, vivify_345
+    $P1388 = root_new ['parrot';'ResizablePMCArray']
+  vivify_345:
+    set $P108, $P1388[-1]
+    unless_null $P108, vivify_346
+    new $P108, "Undef"
+  vivify_346:
+    find_lex $P109, "@indent"
+    "debug"("Indenting", $P107, $P108, $P109)
+.annotate 'line', 319
+    find_lex $P1390, "$m"
+    unless_null $P1390, vivify_347
+    $P1390 = root_new ['parrot';'ResizablePMCArray']
+  vivify_347:
+    set $P107, $P1390[0]
+    unless_null $P107, vivify_348
+    new $P107, "Undef"
+  vivify_348:
+    $N101 = "length"($P107)
+    find_lex $P1391, "@indent"
+    unless_null $P1391, vivify_349
+    $P1391 = root_new ['parrot';'ResizablePMCArray']
+  vivify_349:
+    set $P108, $P1391[-1]
+    unless_null $P108, vivify_350
+    new $P108, "Undef"
+  vivify_350:
+    set $N102, $P108
+    islt $I101, $N101, $N102
+    if $I101, if_1389
+.annotate 'line', 322
+    find_lex $P1393, "$m"
+    unless_null $P1393, vivify_351
+    $P1393 = root_new ['parrot';'ResizablePMCArray']
+  vivify_351:
+    set $P109, $P1393[0]
+    unless_null $P109, vivify_352
+    new $P109, "Undef"
+  vivify_352:
+    $N103 = "length"($P109)
+    find_lex $P1394, "@indent"
+    unless_null $P1394, vivify_353
+    $P1394 = root_new ['parrot';'ResizablePMCArray']
+  vivify_353:
+    set $P110, $P1394[-1]
+    unless_null $P110, vivify_354
+    new $P110, "Undef"
+  vivify_354:
+    set $N104, $P110
+    isgt $I102, $N103, $N104
+    unless $I102, if_1392_end
+.annotate 'line', 323
+    new $P111, 'String'
+    set $P111, "YAML::Tiny found bad indenting in line '"
+    find_lex $P1395, "@lines"
+    unless_null $P1395, vivify_355
+    $P1395 = root_new ['parrot';'ResizablePMCArray']
+  vivify_355:
+    set $P112, $P1395[0]
+    unless_null $P112, vivify_356
+    new $P112, "Undef"
+  vivify_356:
+    set $S100, $P112
+    concat $P113, $P111, $S100
+    concat $P114, $P113, "'"
+    die $P114
+  if_1392_end:
+.annotate 'line', 322
+    goto if_1389_end
+  if_1389:
+.annotate 'line', 320
+    new $P109, "Exception"
+    set $P109['type'], .CONTROL_RETURN
+    new $P110, "Integer"
+    assign $P110, 1
+    setattribute $P109, 'payload', $P110
+    throw $P109
+  if_1389_end:
+.annotate 'line', 327
+    get_hll_global $P107, ["Regex"], "Regex"
+    .const 'Sub' $P1397 = "68_1792415686.17671" 
+    capture_lex $P1397
+    $P108 = $P107."new"($P1397)
+    find_lex $P1413, "@lines"
+    unless_null $P1413, vivify_365
+    $P1413 = root_new ['parrot';'ResizablePMCArray']
+  vivify_365:
+    set $P109, $P1413[0]
+    unless_null $P109, vivify_366
+    new $P109, "Undef"
+  vivify_366:
+    $P110 = $P108."ACCEPTS"($P109)
+    store_lex "$m", $P110
+.annotate 'line', 334
+    find_lex $P1414, "@lines"
+    unless_null $P1414, vivify_367
+    $P1414 = root_new ['parrot';'ResizablePMCArray']
+  vivify_367:
+    set $P107, $P1414[0]
+    unless_null $P107, vivify_368
+    new $P107, "Undef"
+  vivify_368:
+    find_lex $P108, "$m"
+    "debug"("Match", $P107, $P108)
+.annotate 'line', 335
+    find_lex $P1415, "@lines"
+    unless_null $P1415, vivify_369
+    $P1415 = root_new ['parrot';'ResizablePMCArray']
+  vivify_369:
+    set $P107, $P1415[0]
+    unless_null $P107, vivify_370
+    new $P107, "Undef"
+  vivify_370:
+    get_hll_global $P108, ["Regex"], "Regex"
+    .const 'Sub' $P1417 = "70_1792415686.17671" 
+    capture_lex $P1417
+    $P109 = $P108."new"($P1417)
+    $P110 = "subst"($P107, $P109, "")
+    find_lex $P1438, "@lines"
+    unless_null $P1438, vivify_383
+    $P1438 = root_new ['parrot';'ResizablePMCArray']
+    store_lex "@lines", $P1438
+  vivify_383:
+    set $P1438[0], $P110
+.annotate 'line', 336
+    find_lex $P1439, "@lines"
+    unless_null $P1439, vivify_384
+    $P1439 = root_new ['parrot';'ResizablePMCArray']
+  vivify_384:
+    set $P107, $P1439[0]
+    unless_null $P107, vivify_385
+    new $P107, "Undef"
+  vivify_385:
+    "debug"("Line", $P107)
+.annotate 'line', 338
+    find_lex $P1440, "$m"
+    unless_null $P1440, vivify_386
+    $P1440 = root_new ['parrot';'ResizablePMCArray']
+  vivify_386:
+    set $P107, $P1440[0]
+    unless_null $P107, vivify_387
+    new $P107, "Undef"
+  vivify_387:
+    set $S100, $P107
+    new $P108, 'String'
+    set $P108, $S100
+    store_lex "$key", $P108
+.annotate 'line', 341
+    find_lex $P1442, "@lines"
+    unless_null $P1442, vivify_388
+    $P1442 = root_new ['parrot';'ResizablePMCArray']
+  vivify_388:
+    set $P108, $P1442[0]
+    unless_null $P108, vivify_389
+    new $P108, "Undef"
+  vivify_389:
+    $P109 = "length"($P108)
+    if $P109, if_1441
+.annotate 'line', 349
+    find_lex $P110, "@lines"
+    $P110."shift"()
+.annotate 'line', 350
+    find_lex $P110, "@lines"
+    if $P110, unless_1445_end
+.annotate 'line', 351
+    get_hll_global $P112, "undef"
+    find_lex $P113, "$key"
+    find_lex $P1446, "%hash"
+    unless_null $P1446, vivify_390
+    $P1446 = root_new ['parrot';'Hash']
+    store_lex "%hash", $P1446
+  vivify_390:
+    set $P1446[$P113], $P112
+.annotate 'line', 352
+    new $P112, "Exception"
+    set $P112['type'], .CONTROL_RETURN
+    new $P113, "Integer"
+    assign $P113, 1
+    setattribute $P112, 'payload', $P113
+    throw $P112
+  unless_1445_end:
+.annotate 'line', 355
+    get_hll_global $P112, ["Regex"], "Regex"
+    .const 'Sub' $P1449 = "73_1792415686.17671" 
+    capture_lex $P1449
+    $P113 = $P112."new"($P1449)
+    find_lex $P1458, "@lines"
+    unless_null $P1458, vivify_399
+    $P1458 = root_new ['parrot';'ResizablePMCArray']
+  vivify_399:
+    set $P114, $P1458[0]
+    unless_null $P114, vivify_400
+    new $P114, "Undef"
+  vivify_400:
+    $P115 = $P113."ACCEPTS"($P114)
+    store_lex "$m", $P115
+    if $P115, if_1447
+.annotate 'line', 359
+    get_hll_global $P117, ["Regex"], "Regex"
+    .const 'Sub' $P1464 = "75_1792415686.17671" 
+    capture_lex $P1464
+    $P118 = $P117."new"($P1464)
+    find_lex $P1473, "@lines"
+    unless_null $P1473, vivify_409
+    $P1473 = root_new ['parrot';'ResizablePMCArray']
+  vivify_409:
+    set $P119, $P1473[0]
+    unless_null $P119, vivify_410
+    new $P119, "Undef"
+  vivify_410:
+    $P120 = $P118."ACCEPTS"($P119)
+    store_lex "$m", $P120
+    if $P120, if_1462
+    set $P116, $P120
+    goto if_1462_end
+  if_1462:
+    .const 'Sub' $P1475 = "77_1792415686.17671" 
+    capture_lex $P1475
+    $P123 = $P1475()
+    set $P116, $P123
+  if_1462_end:
+    set $P110, $P116
+.annotate 'line', 355
+    goto if_1447_end
+  if_1447:
+.annotate 'line', 356
+    $P116 = "list"()
+    find_lex $P117, "$key"
+    find_lex $P1459, "%hash"
+    unless_null $P1459, vivify_421
+    $P1459 = root_new ['parrot';'Hash']
+    store_lex "%hash", $P1459
+  vivify_421:
+    set $P1459[$P117], $P116
+.annotate 'line', 357
+    find_lex $P116, "self"
+    find_lex $P117, "$key"
+    find_lex $P1460, "%hash"
+    unless_null $P1460, vivify_422
+    $P1460 = root_new ['parrot';'Hash']
+  vivify_422:
+    set $P118, $P1460[$P117]
+    unless_null $P118, vivify_423
+    new $P118, "Undef"
+  vivify_423:
+    find_lex $P119, "@indent"
+    find_lex $P1461, "$m"
+    unless_null $P1461, vivify_424
+    $P1461 = root_new ['parrot';'ResizablePMCArray']
+  vivify_424:
+    set $P120, $P1461[0]
+    unless_null $P120, vivify_425
+    new $P120, "Undef"
+  vivify_425:
+    $P121 = "length"($P120)
+    new $P122, "ResizablePMCArray"
+    push $P122, $P119
+    push $P122, $P121
+    find_lex $P123, "@lines"
+    $P124 = $P116."_read_array"($P118, $P122, $P123)
+.annotate 'line', 355
+    set $P110, $P124
+  if_1447_end:
+.annotate 'line', 347
+    set $P107, $P110
+.annotate 'line', 341
+    goto if_1441_end
+  if_1441:
+.annotate 'line', 343
+    find_lex $P1443, "@lines"
+    unless_null $P1443, vivify_426
+    $P1443 = root_new ['parrot';'ResizablePMCArray']
+  vivify_426:
+    set $P110, $P1443[0]
+    unless_null $P110, vivify_427
+    new $P110, "Undef"
+  vivify_427:
+    "debug"("Reading scalar", $P110)
+.annotate 'line', 344
+    find_lex $P110, "self"
+    find_lex $P111, "@lines"
+    $P112 = $P111."shift"()
+    find_lex $P113, "@indent"
+    get_hll_global $P114, "undef"
+    new $P115, "ResizablePMCArray"
+    push $P115, $P113
+    push $P115, $P114
+    find_lex $P116, "@lines"
+    $P117 = $P110."_read_scalar"($P112, $P115, $P116)
+    find_lex $P118, "$key"
+    find_lex $P1444, "%hash"
+    unless_null $P1444, vivify_428
+    $P1444 = root_new ['parrot';'Hash']
+    store_lex "%hash", $P1444
+  vivify_428:
+    set $P1444[$P118], $P117
+.annotate 'line', 345
+    find_lex $P110, "%hash"
+    $P111 = "debug"("Done", $P110)
+.annotate 'line', 341
+    set $P107, $P111
+  if_1441_end:
+.annotate 'line', 307
+    .return ($P107)
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1364"  :anon :subid("64_1792415686.17671") :method :outer("63_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 309
+    .local string rx1366_tgt
+    .local int rx1366_pos
+    .local int rx1366_off
+    .local int rx1366_eos
+    .local int rx1366_rep
+    .local pmc rx1366_cur
+    .local pmc rx1366_debug
+    (rx1366_cur, rx1366_pos, rx1366_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1366_debug, rx1366_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1366_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1366_eos, rx1366_tgt
+    gt rx1366_pos, rx1366_eos, rx1366_done
+    set rx1366_off, 0
+    lt rx1366_pos, 2, rx1366_start
+    sub rx1366_off, rx1366_pos, 1
+    substr rx1366_tgt, rx1366_tgt, rx1366_off
+  rx1366_start:
+    eq $I10, 1, rx1366_restart
+    if_null rx1366_debug, debug_323
+    rx1366_cur."!cursor_debug"("START", "")
+  debug_323:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1367_done
+    goto rxscan1367_scan
+  rxscan1367_loop:
+    ($P10) = rx1366_cur."from"()
+    inc $P10
+    set rx1366_pos, $P10
+    ge rx1366_pos, rx1366_eos, rxscan1367_done
+  rxscan1367_scan:
+    set_addr $I10, rxscan1367_loop
+    rx1366_cur."!mark_push"(0, rx1366_pos, $I10)
+  rxscan1367_done:
+  # rxanchor bos
+    ne rx1366_pos, 0, rx1366_fail
+  alt1368_0:
+    set_addr $I10, alt1368_1
+    rx1366_cur."!mark_push"(0, rx1366_pos, $I10)
+  # rx literal  "---"
+    add $I11, rx1366_pos, 3
+    gt $I11, rx1366_eos, rx1366_fail
+    sub $I11, rx1366_pos, rx1366_off
+    substr $S10, rx1366_tgt, $I11, 3
+    ne $S10, "---", rx1366_fail
+    add rx1366_pos, 3
+    goto alt1368_end
+  alt1368_1:
+  # rx literal  "..."
+    add $I11, rx1366_pos, 3
+    gt $I11, rx1366_eos, rx1366_fail
+    sub $I11, rx1366_pos, rx1366_off
+    substr $S10, rx1366_tgt, $I11, 3
+    ne $S10, "...", rx1366_fail
+    add rx1366_pos, 3
+  alt1368_end:
+  # rx pass
+    rx1366_cur."!cursor_pass"(rx1366_pos, "")
+    if_null rx1366_debug, debug_324
+    rx1366_cur."!cursor_debug"("PASS", "", " at pos=", rx1366_pos)
+  debug_324:
+    rx1366_cur."!cursor_backtrack"()
+    .return (rx1366_cur)
+  rx1366_restart:
+    if_null rx1366_debug, debug_325
+    rx1366_cur."!cursor_debug"("NEXT", "")
+  debug_325:
+  rx1366_fail:
+    (rx1366_rep, rx1366_pos, $I10, $P10) = rx1366_cur."!mark_fail"(0)
+    lt rx1366_pos, -1, rx1366_done
+    eq rx1366_pos, -1, rx1366_fail
+    jump $I10
+  rx1366_done:
+    rx1366_cur."!cursor_fail"()
+    if_null rx1366_debug, debug_326
+    rx1366_cur."!cursor_debug"("FAIL", "")
+  debug_326:
+    .return (rx1366_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1371"  :anon :subid("65_1792415686.17671") :method :outer("63_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 310
+    .local string rx1373_tgt
+    .local int rx1373_pos
+    .local int rx1373_off
+    .local int rx1373_eos
+    .local int rx1373_rep
+    .local pmc rx1373_cur
+    .local pmc rx1373_debug
+    (rx1373_cur, rx1373_pos, rx1373_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1373_debug, rx1373_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1373_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1373_eos, rx1373_tgt
+    gt rx1373_pos, rx1373_eos, rx1373_done
+    set rx1373_off, 0
+    lt rx1373_pos, 2, rx1373_start
+    sub rx1373_off, rx1373_pos, 1
+    substr rx1373_tgt, rx1373_tgt, rx1373_off
+  rx1373_start:
+    eq $I10, 1, rx1373_restart
+    if_null rx1373_debug, debug_329
+    rx1373_cur."!cursor_debug"("START", "")
+  debug_329:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1374_done
+    goto rxscan1374_scan
+  rxscan1374_loop:
+    ($P10) = rx1373_cur."from"()
+    inc $P10
+    set rx1373_pos, $P10
+    ge rx1373_pos, rx1373_eos, rxscan1374_done
+  rxscan1374_scan:
+    set_addr $I10, rxscan1374_loop
+    rx1373_cur."!mark_push"(0, rx1373_pos, $I10)
+  rxscan1374_done:
+  # rxanchor bos
+    ne rx1373_pos, 0, rx1373_fail
+  # rx literal  "---"
+    add $I11, rx1373_pos, 3
+    gt $I11, rx1373_eos, rx1373_fail
+    sub $I11, rx1373_pos, rx1373_off
+    substr $S10, rx1373_tgt, $I11, 3
+    ne $S10, "---", rx1373_fail
+    add rx1373_pos, 3
+  # rx pass
+    rx1373_cur."!cursor_pass"(rx1373_pos, "")
+    if_null rx1373_debug, debug_330
+    rx1373_cur."!cursor_debug"("PASS", "", " at pos=", rx1373_pos)
+  debug_330:
+    rx1373_cur."!cursor_backtrack"()
+    .return (rx1373_cur)
+  rx1373_restart:
+    if_null rx1373_debug, debug_331
+    rx1373_cur."!cursor_debug"("NEXT", "")
+  debug_331:
+  rx1373_fail:
+    (rx1373_rep, rx1373_pos, $I10, $P10) = rx1373_cur."!mark_fail"(0)
+    lt rx1373_pos, -1, rx1373_done
+    eq rx1373_pos, -1, rx1373_fail
+    jump $I10
+  rx1373_done:
+    rx1373_cur."!cursor_fail"()
+    if_null rx1373_debug, debug_332
+    rx1373_cur."!cursor_debug"("FAIL", "")
+  debug_332:
+    .return (rx1373_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1377"  :anon :subid("66_1792415686.17671") :method :outer("63_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 317
+    .const 'Sub' $P1382 = "67_1792415686.17671" 
+    capture_lex $P1382
+    .local string rx1379_tgt
+    .local int rx1379_pos
+    .local int rx1379_off
+    .local int rx1379_eos
+    .local int rx1379_rep
+    .local pmc rx1379_cur
+    .local pmc rx1379_debug
+    (rx1379_cur, rx1379_pos, rx1379_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1379_debug, rx1379_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1379_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1379_eos, rx1379_tgt
+    gt rx1379_pos, rx1379_eos, rx1379_done
+    set rx1379_off, 0
+    lt rx1379_pos, 2, rx1379_start
+    sub rx1379_off, rx1379_pos, 1
+    substr rx1379_tgt, rx1379_tgt, rx1379_off
+  rx1379_start:
+    eq $I10, 1, rx1379_restart
+    if_null rx1379_debug, debug_335
+    rx1379_cur."!cursor_debug"("START", "")
+  debug_335:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1380_done
+    goto rxscan1380_scan
+  rxscan1380_loop:
+    ($P10) = rx1379_cur."from"()
+    inc $P10
+    set rx1379_pos, $P10
+    ge rx1379_pos, rx1379_eos, rxscan1380_done
+  rxscan1380_scan:
+    set_addr $I10, rxscan1380_loop
+    rx1379_cur."!mark_push"(0, rx1379_pos, $I10)
+  rxscan1380_done:
+  # rxanchor bos
+    ne rx1379_pos, 0, rx1379_fail
+  # rx subrule $P1382 subtype=capture negate=
+    rx1379_cur."!cursor_pos"(rx1379_pos)
+    .const 'Sub' $P1382 = "67_1792415686.17671" 
+    capture_lex $P1382
+    $P10 = rx1379_cur.$P1382()
+    unless $P10, rx1379_fail
+    goto rxsubrule1386_pass
+  rxsubrule1386_back:
+    $P10 = $P10."!cursor_next"()
+    unless $P10, rx1379_fail
+  rxsubrule1386_pass:
+    set_addr $I10, rxsubrule1386_back
+    rx1379_cur."!mark_push"(0, rx1379_pos, $I10, $P10)
+    $P10."!cursor_names"(0)
+    rx1379_pos = $P10."pos"()
+  # rx pass
+    rx1379_cur."!cursor_pass"(rx1379_pos, "")
+    if_null rx1379_debug, debug_340
+    rx1379_cur."!cursor_debug"("PASS", "", " at pos=", rx1379_pos)
+  debug_340:
+    rx1379_cur."!cursor_backtrack"()
+    .return (rx1379_cur)
+  rx1379_restart:
+    if_null rx1379_debug, debug_341
+    rx1379_cur."!cursor_debug"("NEXT", "")
+  debug_341:
+  rx1379_fail:
+    (rx1379_rep, rx1379_pos, $I10, $P10) = rx1379_cur."!mark_fail"(0)
+    lt rx1379_pos, -1, rx1379_done
+    eq rx1379_pos, -1, rx1379_fail
+    jump $I10
+  rx1379_done:
+    rx1379_cur."!cursor_fail"()
+    if_null rx1379_debug, debug_342
+    rx1379_cur."!cursor_debug"("FAIL", "")
+  debug_342:
+    .return (rx1379_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1381"  :anon :subid("67_1792415686.17671") :method :outer("66_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 317
+    .local string rx1383_tgt
+    .local int rx1383_pos
+    .local int rx1383_off
+    .local int rx1383_eos
+    .local int rx1383_rep
+    .local pmc rx1383_cur
+    .local pmc rx1383_debug
+    (rx1383_cur, rx1383_pos, rx1383_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1383_debug, rx1383_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1383_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1383_eos, rx1383_tgt
+    gt rx1383_pos, rx1383_eos, rx1383_done
+    set rx1383_off, 0
+    lt rx1383_pos, 2, rx1383_start
+    sub rx1383_off, rx1383_pos, 1
+    substr rx1383_tgt, rx1383_tgt, rx1383_off
+  rx1383_start:
+    eq $I10, 1, rx1383_restart
+    if_null rx1383_debug, debug_336
+    rx1383_cur."!cursor_debug"("START", "")
+  debug_336:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1384_done
+    goto rxscan1384_scan
+  rxscan1384_loop:
+    ($P10) = rx1383_cur."from"()
+    inc $P10
+    set rx1383_pos, $P10
+    ge rx1383_pos, rx1383_eos, rxscan1384_done
+  rxscan1384_scan:
+    set_addr $I10, rxscan1384_loop
+    rx1383_cur."!mark_push"(0, rx1383_pos, $I10)
+  rxscan1384_done:
+  # rx rxquantg1385 ** 0..*
+    set_addr $I10, rxquantg1385_done
+    rx1383_cur."!mark_push"(0, rx1383_pos, $I10)
+  rxquantg1385_loop:
+  # rx charclass s
+    ge rx1383_pos, rx1383_eos, rx1383_fail
+    sub $I10, rx1383_pos, rx1383_off
+    is_cclass $I11, 32, rx1383_tgt, $I10
+    unless $I11, rx1383_fail
+    inc rx1383_pos
+    set_addr $I10, rxquantg1385_done
+    rx1383_cur."!mark_push"(rx1383_rep, rx1383_pos, $I10)
+    goto rxquantg1385_loop
+  rxquantg1385_done:
+  # rx pass
+    rx1383_cur."!cursor_pass"(rx1383_pos, "")
+    if_null rx1383_debug, debug_337
+    rx1383_cur."!cursor_debug"("PASS", "", " at pos=", rx1383_pos)
+  debug_337:
+    rx1383_cur."!cursor_backtrack"()
+    .return (rx1383_cur)
+  rx1383_restart:
+    if_null rx1383_debug, debug_338
+    rx1383_cur."!cursor_debug"("NEXT", "")
+  debug_338:
+  rx1383_fail:
+    (rx1383_rep, rx1383_pos, $I10, $P10) = rx1383_cur."!mark_fail"(0)
+    lt rx1383_pos, -1, rx1383_done
+    eq rx1383_pos, -1, rx1383_fail
+    jump $I10
+  rx1383_done:
+    rx1383_cur."!cursor_fail"()
+    if_null rx1383_debug, debug_339
+    rx1383_cur."!cursor_debug"("FAIL", "")
+  debug_339:
+    .return (rx1383_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1396"  :anon :subid("68_1792415686.17671") :method :outer("63_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 327
+    .const 'Sub' $P1402 = "69_1792415686.17671" 
+    capture_lex $P1402
+    .local string rx1398_tgt
+    .local int rx1398_pos
+    .local int rx1398_off
+    .local int rx1398_eos
+    .local int rx1398_rep
+    .local pmc rx1398_cur
+    .local pmc rx1398_debug
+    (rx1398_cur, rx1398_pos, rx1398_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1398_debug, rx1398_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1398_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1398_eos, rx1398_tgt
+    gt rx1398_pos, rx1398_eos, rx1398_done
+    set rx1398_off, 0
+    lt rx1398_pos, 2, rx1398_start
+    sub rx1398_off, rx1398_pos, 1
+    substr rx1398_tgt, rx1398_tgt, rx1398_off
+  rx1398_start:
+    eq $I10, 1, rx1398_restart
+    if_null rx1398_debug, debug_357
+    rx1398_cur."!cursor_debug"("START", "")
+  debug_357:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1399_done
+    goto rxscan1399_scan
+  rxscan1399_loop:
+    ($P10) = rx1398_cur."from"()
+    inc $P10
+    set rx1398_pos, $P10
+    ge rx1398_pos, rx1398_eos, rxscan1399_done
+  rxscan1399_scan:
+    set_addr $I10, rxscan1399_loop
+    rx1398_cur."!mark_push"(0, rx1398_pos, $I10)
+  rxscan1399_done:
+  # rxanchor bos
+    ne rx1398_pos, 0, rx1398_fail
+  # rx rxquantg1400 ** 0..*
+    set_addr $I10, rxquantg1400_done
+    rx1398_cur."!mark_push"(0, rx1398_pos, $I10)
+  rxquantg1400_loop:
+  # rx charclass s
+    ge rx1398_pos, rx1398_eos, rx1398_fail
+    sub $I10, rx1398_pos, rx1398_off
+    is_cclass $I11, 32, rx1398_tgt, $I10
+    unless $I11, rx1398_fail
+    inc rx1398_pos
+    set_addr $I10, rxquantg1400_done
+    rx1398_cur."!mark_push"(rx1398_rep, rx1398_pos, $I10)
+    goto rxquantg1400_loop
+  rxquantg1400_done:
+  # rx subrule $P1402 subtype=capture negate=
+    rx1398_cur."!cursor_pos"(rx1398_pos)
+    .const 'Sub' $P1402 = "69_1792415686.17671" 
+    capture_lex $P1402
+    $P10 = rx1398_cur.$P1402()
+    unless $P10, rx1398_fail
+    goto rxsubrule1407_pass
+  rxsubrule1407_back:
+    $P10 = $P10."!cursor_next"()
+    unless $P10, rx1398_fail
+  rxsubrule1407_pass:
+    set_addr $I10, rxsubrule1407_back
+    rx1398_cur."!mark_push"(0, rx1398_pos, $I10, $P10)
+    $P10."!cursor_names"(0)
+    rx1398_pos = $P10."pos"()
+  # rx rxquantg1408 ** 0..*
+    set_addr $I10, rxquantg1408_done
+    rx1398_cur."!mark_push"(0, rx1398_pos, $I10)
+  rxquantg1408_loop:
+  # rx charclass s
+    ge rx1398_pos, rx1398_eos, rx1398_fail
+    sub $I10, rx1398_pos, rx1398_off
+    is_cclass $I11, 32, rx1398_tgt, $I10
+    unless $I11, rx1398_fail
+    inc rx1398_pos
+    set_addr $I10, rxquantg1408_done
+    rx1398_cur."!mark_push"(rx1398_rep, rx1398_pos, $I10)
+    goto rxquantg1408_loop
+  rxquantg1408_done:
+  # rx literal  ":"
+    add $I11, rx1398_pos, 1
+    gt $I11, rx1398_eos, rx1398_fail
+    sub $I11, rx1398_pos, rx1398_off
+    ord $I11, rx1398_tgt, $I11
+    ne $I11, 58, rx1398_fail
+    add rx1398_pos, 1
+  alt1409_0:
+    set_addr $I10, alt1409_1
+    rx1398_cur."!mark_push"(0, rx1398_pos, $I10)
+  # rx rxquantg1410 ** 1..*
+  rxquantg1410_loop:
+  # rx charclass s
+    ge rx1398_pos, rx1398_eos, rx1398_fail
+    sub $I10, rx1398_pos, rx1398_off
+    is_cclass $I11, 32, rx1398_tgt, $I10
+    unless $I11, rx1398_fail
+    inc rx1398_pos
+    set_addr $I10, rxquantg1410_done
+    rx1398_cur."!mark_push"(rx1398_rep, rx1398_pos, $I10)
+    goto rxquantg1410_loop
+  rxquantg1410_done:
+  # rx rxquantg1411 ** 0..1
+    set_addr $I10, rxquantg1411_done
+    rx1398_cur."!mark_push"(0, rx1398_pos, $I10)
+  rxquantg1411_loop:
+  # rx literal  "#"
+    add $I11, rx1398_pos, 1
+    gt $I11, rx1398_eos, rx1398_fail
+    sub $I11, rx1398_pos, rx1398_off
+    ord $I11, rx1398_tgt, $I11
+    ne $I11, 35, rx1398_fail
+    add rx1398_pos, 1
+  # rx rxquantg1412 ** 0..*
+    set_addr $I10, rxquantg1412_done
+    rx1398_cur."!mark_push"(0, rx1398_pos, $I10)
+  rxquantg1412_loop:
+  # rx charclass .
+    ge rx1398_pos, rx1398_eos, rx1398_fail
+    inc rx1398_pos
+    set_addr $I10, rxquantg1412_done
+    rx1398_cur."!mark_push"(rx1398_rep, rx1398_pos, $I10)
+    goto rxquantg1412_loop
+  rxquantg1412_done:
+  rxquantg1411_done:
+    goto alt1409_end
+  alt1409_1:
+  # rxanchor eos
+    ne rx1398_pos, rx1398_eos, rx1398_fail
+  alt1409_end:
+  # rx pass
+    rx1398_cur."!cursor_pass"(rx1398_pos, "")
+    if_null rx1398_debug, debug_362
+    rx1398_cur."!cursor_debug"("PASS", "", " at pos=", rx1398_pos)
+  debug_362:
+    rx1398_cur."!cursor_backtrack"()
+    .return (rx1398_cur)
+  rx1398_restart:
+    if_null rx1398_debug, debug_363
+    rx1398_cur."!cursor_debug"("NEXT", "")
+  debug_363:
+  rx1398_fail:
+    (rx1398_rep, rx1398_pos, $I10, $P10) = rx1398_cur."!mark_fail"(0)
+    lt rx1398_pos, -1, rx1398_done
+    eq rx1398_pos, -1, rx1398_fail
+    jump $I10
+  rx1398_done:
+    rx1398_cur."!cursor_fail"()
+    if_null rx1398_debug, debug_364
+    rx1398_cur."!cursor_debug"("FAIL", "")
+  debug_364:
+    .return (rx1398_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1401"  :anon :subid("69_1792415686.17671") :method :outer("68_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 327
+    .local string rx1403_tgt
+    .local int rx1403_pos
+    .local int rx1403_off
+    .local int rx1403_eos
+    .local int rx1403_rep
+    .local pmc rx1403_cur
+    .local pmc rx1403_debug
+    (rx1403_cur, rx1403_pos, rx1403_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1403_debug, rx1403_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1403_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1403_eos, rx1403_tgt
+    gt rx1403_pos, rx1403_eos, rx1403_done
+    set rx1403_off, 0
+    lt rx1403_pos, 2, rx1403_start
+    sub rx1403_off, rx1403_pos, 1
+    substr rx1403_tgt, rx1403_tgt, rx1403_off
+  rx1403_start:
+    eq $I10, 1, rx1403_restart
+    if_null rx1403_debug, debug_358
+    rx1403_cur."!cursor_debug"("START", "")
+  debug_358:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1404_done
+    goto rxscan1404_scan
+  rxscan1404_loop:
+    ($P10) = rx1403_cur."from"()
+    inc $P10
+    set rx1403_pos, $P10
+    ge rx1403_pos, rx1403_eos, rxscan1404_done
+  rxscan1404_scan:
+    set_addr $I10, rxscan1404_loop
+    rx1403_cur."!mark_push"(0, rx1403_pos, $I10)
+  rxscan1404_done:
+  # rx enumcharlist negate=1 
+    ge rx1403_pos, rx1403_eos, rx1403_fail
+    sub $I10, rx1403_pos, rx1403_off
+    substr $S10, rx1403_tgt, $I10, 1
+    index $I11, "'\" ", $S10
+    ge $I11, 0, rx1403_fail
+    inc rx1403_pos
+  # rx rxquantf1405 ** 0..*
+    set_addr $I10, rxquantf1405_loop
+    rx1403_cur."!mark_push"(0, rx1403_pos, $I10)
+    goto rxquantf1405_done
+  rxquantf1405_loop:
+  # rx charclass N
+    ge rx1403_pos, rx1403_eos, rx1403_fail
+    sub $I10, rx1403_pos, rx1403_off
+    is_cclass $I11, 4096, rx1403_tgt, $I10
+    if $I11, rx1403_fail
+    inc rx1403_pos
+    set_addr $I10, rxquantf1405_loop
+    rx1403_cur."!mark_push"(rx1403_rep, rx1403_pos, $I10)
+  rxquantf1405_done:
+  # rx pass
+    rx1403_cur."!cursor_pass"(rx1403_pos, "")
+    if_null rx1403_debug, debug_359
+    rx1403_cur."!cursor_debug"("PASS", "", " at pos=", rx1403_pos)
+  debug_359:
+    rx1403_cur."!cursor_backtrack"()
+    .return (rx1403_cur)
+  rx1403_restart:
+    if_null rx1403_debug, debug_360
+    rx1403_cur."!cursor_debug"("NEXT", "")
+  debug_360:
+  rx1403_fail:
+    (rx1403_rep, rx1403_pos, $I10, $P10) = rx1403_cur."!mark_fail"(0)
+    lt rx1403_pos, -1, rx1403_done
+    eq rx1403_pos, -1, rx1403_fail
+    jump $I10
+  rx1403_done:
+    rx1403_cur."!cursor_fail"()
+    if_null rx1403_debug, debug_361
+    rx1403_cur."!cursor_debug"("FAIL", "")
+  debug_361:
+    .return (rx1403_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1416"  :anon :subid("70_1792415686.17671") :method :outer("63_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 335
+    .const 'Sub' $P1430 = "72_1792415686.17671" 
+    capture_lex $P1430
+    .const 'Sub' $P1422 = "71_1792415686.17671" 
+    capture_lex $P1422
+    .local string rx1418_tgt
+    .local int rx1418_pos
+    .local int rx1418_off
+    .local int rx1418_eos
+    .local int rx1418_rep
+    .local pmc rx1418_cur
+    .local pmc rx1418_debug
+    (rx1418_cur, rx1418_pos, rx1418_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1418_debug, rx1418_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1418_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1418_eos, rx1418_tgt
+    gt rx1418_pos, rx1418_eos, rx1418_done
+    set rx1418_off, 0
+    lt rx1418_pos, 2, rx1418_start
+    sub rx1418_off, rx1418_pos, 1
+    substr rx1418_tgt, rx1418_tgt, rx1418_off
+  rx1418_start:
+    eq $I10, 1, rx1418_restart
+    if_null rx1418_debug, debug_371
+    rx1418_cur."!cursor_debug"("START", "")
+  debug_371:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1419_done
+    goto rxscan1419_scan
+  rxscan1419_loop:
+    ($P10) = rx1418_cur."from"()
+    inc $P10
+    set rx1418_pos, $P10
+    ge rx1418_pos, rx1418_eos, rxscan1419_done
+  rxscan1419_scan:
+    set_addr $I10, rxscan1419_loop
+    rx1418_cur."!mark_push"(0, rx1418_pos, $I10)
+  rxscan1419_done:
+  # rxanchor bos
+    ne rx1418_pos, 0, rx1418_fail
+  # rx rxquantg1420 ** 0..*
+    set_addr $I10, rxquantg1420_done
+    rx1418_cur."!mark_push"(0, rx1418_pos, $I10)
+  rxquantg1420_loop:
+  # rx charclass s
+    ge rx1418_pos, rx1418_eos, rx1418_fail
+    sub $I10, rx1418_pos, rx1418_off
+    is_cclass $I11, 32, rx1418_tgt, $I10
+    unless $I11, rx1418_fail
+    inc rx1418_pos
+    set_addr $I10, rxquantg1420_done
+    rx1418_cur."!mark_push"(rx1418_rep, rx1418_pos, $I10)
+    goto rxquantg1420_loop
+  rxquantg1420_done:
+  # rx subrule $P1422 subtype=capture negate=
+    rx1418_cur."!cursor_pos"(rx1418_pos)
+    .const 'Sub' $P1422 = "71_1792415686.17671" 
+    capture_lex $P1422
+    $P10 = rx1418_cur.$P1422()
+    unless $P10, rx1418_fail
+    goto rxsubrule1427_pass
+  rxsubrule1427_back:
+    $P10 = $P10."!cursor_next"()
+    unless $P10, rx1418_fail
+  rxsubrule1427_pass:
+    set_addr $I10, rxsubrule1427_back
+    rx1418_cur."!mark_push"(0, rx1418_pos, $I10, $P10)
+    $P10."!cursor_names"(0)
+    rx1418_pos = $P10."pos"()
+  # rx rxquantg1428 ** 0..*
+    set_addr $I10, rxquantg1428_done
+    rx1418_cur."!mark_push"(0, rx1418_pos, $I10)
+  rxquantg1428_loop:
+  # rx charclass s
+    ge rx1418_pos, rx1418_eos, rx1418_fail
+    sub $I10, rx1418_pos, rx1418_off
+    is_cclass $I11, 32, rx1418_tgt, $I10
+    unless $I11, rx1418_fail
+    inc rx1418_pos
+    set_addr $I10, rxquantg1428_done
+    rx1418_cur."!mark_push"(rx1418_rep, rx1418_pos, $I10)
+    goto rxquantg1428_loop
+  rxquantg1428_done:
+  # rx literal  ":"
+    add $I11, rx1418_pos, 1
+    gt $I11, rx1418_eos, rx1418_fail
+    sub $I11, rx1418_pos, rx1418_off
+    ord $I11, rx1418_tgt, $I11
+    ne $I11, 58, rx1418_fail
+    add rx1418_pos, 1
+  # rx subrule $P1430 subtype=capture negate=
+    rx1418_cur."!cursor_pos"(rx1418_pos)
+    .const 'Sub' $P1430 = "72_1792415686.17671" 
+    capture_lex $P1430
+    $P10 = rx1418_cur.$P1430()
+    unless $P10, rx1418_fail
+    goto rxsubrule1437_pass
+  rxsubrule1437_back:
+    $P10 = $P10."!cursor_next"()
+    unless $P10, rx1418_fail
+  rxsubrule1437_pass:
+    set_addr $I10, rxsubrule1437_back
+    rx1418_cur."!mark_push"(0, rx1418_pos, $I10, $P10)
+    $P10."!cursor_names"("1")
+    rx1418_pos = $P10."pos"()
+  # rx pass
+    rx1418_cur."!cursor_pass"(rx1418_pos, "")
+    if_null rx1418_debug, debug_380
+    rx1418_cur."!cursor_debug"("PASS", "", " at pos=", rx1418_pos)
+  debug_380:
+    rx1418_cur."!cursor_backtrack"()
+    .return (rx1418_cur)
+  rx1418_restart:
+    if_null rx1418_debug, debug_381
+    rx1418_cur."!cursor_debug"("NEXT", "")
+  debug_381:
+  rx1418_fail:
+    (rx1418_rep, rx1418_pos, $I10, $P10) = rx1418_cur."!mark_fail"(0)
+    lt rx1418_pos, -1, rx1418_done
+    eq rx1418_pos, -1, rx1418_fail
+    jump $I10
+  rx1418_done:
+    rx1418_cur."!cursor_fail"()
+    if_null rx1418_debug, debug_382
+    rx1418_cur."!cursor_debug"("FAIL", "")
+  debug_382:
+    .return (rx1418_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1421"  :anon :subid("71_1792415686.17671") :method :outer("70_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 335
+    .local string rx1423_tgt
+    .local int rx1423_pos
+    .local int rx1423_off
+    .local int rx1423_eos
+    .local int rx1423_rep
+    .local pmc rx1423_cur
+    .local pmc rx1423_debug
+    (rx1423_cur, rx1423_pos, rx1423_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1423_debug, rx1423_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1423_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1423_eos, rx1423_tgt
+    gt rx1423_pos, rx1423_eos, rx1423_done
+    set rx1423_off, 0
+    lt rx1423_pos, 2, rx1423_start
+    sub rx1423_off, rx1423_pos, 1
+    substr rx1423_tgt, rx1423_tgt, rx1423_off
+  rx1423_start:
+    eq $I10, 1, rx1423_restart
+    if_null rx1423_debug, debug_372
+    rx1423_cur."!cursor_debug"("START", "")
+  debug_372:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1424_done
+    goto rxscan1424_scan
+  rxscan1424_loop:
+    ($P10) = rx1423_cur."from"()
+    inc $P10
+    set rx1423_pos, $P10
+    ge rx1423_pos, rx1423_eos, rxscan1424_done
+  rxscan1424_scan:
+    set_addr $I10, rxscan1424_loop
+    rx1423_cur."!mark_push"(0, rx1423_pos, $I10)
+  rxscan1424_done:
+  # rx enumcharlist negate=1 
+    ge rx1423_pos, rx1423_eos, rx1423_fail
+    sub $I10, rx1423_pos, rx1423_off
+    substr $S10, rx1423_tgt, $I10, 1
+    index $I11, "'\"", $S10
+    ge $I11, 0, rx1423_fail
+    inc rx1423_pos
+  # rx rxquantf1425 ** 0..*
+    set_addr $I10, rxquantf1425_loop
+    rx1423_cur."!mark_push"(0, rx1423_pos, $I10)
+    goto rxquantf1425_done
+  rxquantf1425_loop:
+  # rx charclass N
+    ge rx1423_pos, rx1423_eos, rx1423_fail
+    sub $I10, rx1423_pos, rx1423_off
+    is_cclass $I11, 4096, rx1423_tgt, $I10
+    if $I11, rx1423_fail
+    inc rx1423_pos
+    set_addr $I10, rxquantf1425_loop
+    rx1423_cur."!mark_push"(rx1423_rep, rx1423_pos, $I10)
+  rxquantf1425_done:
+  # rx pass
+    rx1423_cur."!cursor_pass"(rx1423_pos, "")
+    if_null rx1423_debug, debug_373
+    rx1423_cur."!cursor_debug"("PASS", "", " at pos=", rx1423_pos)
+  debug_373:
+    rx1423_cur."!cursor_backtrack"()
+    .return (rx1423_cur)
+  rx1423_restart:
+    if_null rx1423_debug, debug_374
+    rx1423_cur."!cursor_debug"("NEXT", "")
+  debug_374:
+  rx1423_fail:
+    (rx1423_rep, rx1423_pos, $I10, $P10) = rx1423_cur."!mark_fail"(0)
+    lt rx1423_pos, -1, rx1423_done
+    eq rx1423_pos, -1, rx1423_fail
+    jump $I10
+  rx1423_done:
+    rx1423_cur."!cursor_fail"()
+    if_null rx1423_debug, debug_375
+    rx1423_cur."!cursor_debug"("FAIL", "")
+  debug_375:
+    .return (rx1423_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1429"  :anon :subid("72_1792415686.17671") :method :outer("70_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 335
+    .local string rx1431_tgt
+    .local int rx1431_pos
+    .local int rx1431_off
+    .local int rx1431_eos
+    .local int rx1431_rep
+    .local pmc rx1431_cur
+    .local pmc rx1431_debug
+    (rx1431_cur, rx1431_pos, rx1431_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1431_debug, rx1431_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1431_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1431_eos, rx1431_tgt
+    gt rx1431_pos, rx1431_eos, rx1431_done
+    set rx1431_off, 0
+    lt rx1431_pos, 2, rx1431_start
+    sub rx1431_off, rx1431_pos, 1
+    substr rx1431_tgt, rx1431_tgt, rx1431_off
+  rx1431_start:
+    eq $I10, 1, rx1431_restart
+    if_null rx1431_debug, debug_376
+    rx1431_cur."!cursor_debug"("START", "")
+  debug_376:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1432_done
+    goto rxscan1432_scan
+  rxscan1432_loop:
+    ($P10) = rx1431_cur."from"()
+    inc $P10
+    set rx1431_pos, $P10
+    ge rx1431_pos, rx1431_eos, rxscan1432_done
+  rxscan1432_scan:
+    set_addr $I10, rxscan1432_loop
+    rx1431_cur."!mark_push"(0, rx1431_pos, $I10)
+  rxscan1432_done:
+  alt1433_0:
+    set_addr $I10, alt1433_1
+    rx1431_cur."!mark_push"(0, rx1431_pos, $I10)
+  # rx rxquantg1434 ** 1..*
+  rxquantg1434_loop:
+  # rx charclass s
+    ge rx1431_pos, rx1431_eos, rx1431_fail
+    sub $I10, rx1431_pos, rx1431_off
+    is_cclass $I11, 32, rx1431_tgt, $I10
+    unless $I11, rx1431_fail
+    inc rx1431_pos
+    set_addr $I10, rxquantg1434_done
+    rx1431_cur."!mark_push"(rx1431_rep, rx1431_pos, $I10)
+    goto rxquantg1434_loop
+  rxquantg1434_done:
+  # rx rxquantg1435 ** 0..1
+    set_addr $I10, rxquantg1435_done
+    rx1431_cur."!mark_push"(0, rx1431_pos, $I10)
+  rxquantg1435_loop:
+  # rx literal  "#"
+    add $I11, rx1431_pos, 1
+    gt $I11, rx1431_eos, rx1431_fail
+    sub $I11, rx1431_pos, rx1431_off
+    ord $I11, rx1431_tgt, $I11
+    ne $I11, 35, rx1431_fail
+    add rx1431_pos, 1
+  # rx rxquantg1436 ** 0..*
+    set_addr $I10, rxquantg1436_done
+    rx1431_cur."!mark_push"(0, rx1431_pos, $I10)
+  rxquantg1436_loop:
+  # rx charclass .
+    ge rx1431_pos, rx1431_eos, rx1431_fail
+    inc rx1431_pos
+    set_addr $I10, rxquantg1436_done
+    rx1431_cur."!mark_push"(rx1431_rep, rx1431_pos, $I10)
+    goto rxquantg1436_loop
+  rxquantg1436_done:
+  rxquantg1435_done:
+    goto alt1433_end
+  alt1433_1:
+  # rxanchor eos
+    ne rx1431_pos, rx1431_eos, rx1431_fail
+  alt1433_end:
+  # rx pass
+    rx1431_cur."!cursor_pass"(rx1431_pos, "")
+    if_null rx1431_debug, debug_377
+    rx1431_cur."!cursor_debug"("PASS", "", " at pos=", rx1431_pos)
+  debug_377:
+    rx1431_cur."!cursor_backtrack"()
+    .return (rx1431_cur)
+  rx1431_restart:
+    if_null rx1431_debug, debug_378
+    rx1431_cur."!cursor_debug"("NEXT", "")
+  debug_378:
+  rx1431_fail:
+    (rx1431_rep, rx1431_pos, $I10, $P10) = rx1431_cur."!mark_fail"(0)
+    lt rx1431_pos, -1, rx1431_done
+    eq rx1431_pos, -1, rx1431_fail
+    jump $I10
+  rx1431_done:
+    rx1431_cur."!cursor_fail"()
+    if_null rx1431_debug, debug_379
+    rx1431_cur."!cursor_debug"("FAIL", "")
+  debug_379:
+    .return (rx1431_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1448"  :anon :subid("73_1792415686.17671") :method :outer("63_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 355
+    .const 'Sub' $P1453 = "74_1792415686.17671" 
+    capture_lex $P1453
+    .local string rx1450_tgt
+    .local int rx1450_pos
+    .local int rx1450_off
+    .local int rx1450_eos
+    .local int rx1450_rep
+    .local pmc rx1450_cur
+    .local pmc rx1450_debug
+    (rx1450_cur, rx1450_pos, rx1450_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1450_debug, rx1450_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1450_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1450_eos, rx1450_tgt
+    gt rx1450_pos, rx1450_eos, rx1450_done
+    set rx1450_off, 0
+    lt rx1450_pos, 2, rx1450_start
+    sub rx1450_off, rx1450_pos, 1
+    substr rx1450_tgt, rx1450_tgt, rx1450_off
+  rx1450_start:
+    eq $I10, 1, rx1450_restart
+    if_null rx1450_debug, debug_391
+    rx1450_cur."!cursor_debug"("START", "")
+  debug_391:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1451_done
+    goto rxscan1451_scan
+  rxscan1451_loop:
+    ($P10) = rx1450_cur."from"()
+    inc $P10
+    set rx1450_pos, $P10
+    ge rx1450_pos, rx1450_eos, rxscan1451_done
+  rxscan1451_scan:
+    set_addr $I10, rxscan1451_loop
+    rx1450_cur."!mark_push"(0, rx1450_pos, $I10)
+  rxscan1451_done:
+  # rxanchor bos
+    ne rx1450_pos, 0, rx1450_fail
+  # rx subrule $P1453 subtype=capture negate=
+    rx1450_cur."!cursor_pos"(rx1450_pos)
+    .const 'Sub' $P1453 = "74_1792415686.17671" 
+    capture_lex $P1453
+    $P10 = rx1450_cur.$P1453()
+    unless $P10, rx1450_fail
+    goto rxsubrule1457_pass
+  rxsubrule1457_back:
+    $P10 = $P10."!cursor_next"()
+    unless $P10, rx1450_fail
+  rxsubrule1457_pass:
+    set_addr $I10, rxsubrule1457_back
+    rx1450_cur."!mark_push"(0, rx1450_pos, $I10, $P10)
+    $P10."!cursor_names"(0)
+    rx1450_pos = $P10."pos"()
+  # rx literal  "-"
+    add $I11, rx1450_pos, 1
+    gt $I11, rx1450_eos, rx1450_fail
+    sub $I11, rx1450_pos, rx1450_off
+    ord $I11, rx1450_tgt, $I11
+    ne $I11, 45, rx1450_fail
+    add rx1450_pos, 1
+  # rx pass
+    rx1450_cur."!cursor_pass"(rx1450_pos, "")
+    if_null rx1450_debug, debug_396
+    rx1450_cur."!cursor_debug"("PASS", "", " at pos=", rx1450_pos)
+  debug_396:
+    rx1450_cur."!cursor_backtrack"()
+    .return (rx1450_cur)
+  rx1450_restart:
+    if_null rx1450_debug, debug_397
+    rx1450_cur."!cursor_debug"("NEXT", "")
+  debug_397:
+  rx1450_fail:
+    (rx1450_rep, rx1450_pos, $I10, $P10) = rx1450_cur."!mark_fail"(0)
+    lt rx1450_pos, -1, rx1450_done
+    eq rx1450_pos, -1, rx1450_fail
+    jump $I10
+  rx1450_done:
+    rx1450_cur."!cursor_fail"()
+    if_null rx1450_debug, debug_398
+    rx1450_cur."!cursor_debug"("FAIL", "")
+  debug_398:
+    .return (rx1450_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1452"  :anon :subid("74_1792415686.17671") :method :outer("73_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 355
+    .local string rx1454_tgt
+    .local int rx1454_pos
+    .local int rx1454_off
+    .local int rx1454_eos
+    .local int rx1454_rep
+    .local pmc rx1454_cur
+    .local pmc rx1454_debug
+    (rx1454_cur, rx1454_pos, rx1454_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1454_debug, rx1454_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1454_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1454_eos, rx1454_tgt
+    gt rx1454_pos, rx1454_eos, rx1454_done
+    set rx1454_off, 0
+    lt rx1454_pos, 2, rx1454_start
+    sub rx1454_off, rx1454_pos, 1
+    substr rx1454_tgt, rx1454_tgt, rx1454_off
+  rx1454_start:
+    eq $I10, 1, rx1454_restart
+    if_null rx1454_debug, debug_392
+    rx1454_cur."!cursor_debug"("START", "")
+  debug_392:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1455_done
+    goto rxscan1455_scan
+  rxscan1455_loop:
+    ($P10) = rx1454_cur."from"()
+    inc $P10
+    set rx1454_pos, $P10
+    ge rx1454_pos, rx1454_eos, rxscan1455_done
+  rxscan1455_scan:
+    set_addr $I10, rxscan1455_loop
+    rx1454_cur."!mark_push"(0, rx1454_pos, $I10)
+  rxscan1455_done:
+  # rx rxquantg1456 ** 0..*
+    set_addr $I10, rxquantg1456_done
+    rx1454_cur."!mark_push"(0, rx1454_pos, $I10)
+  rxquantg1456_loop:
+  # rx charclass s
+    ge rx1454_pos, rx1454_eos, rx1454_fail
+    sub $I10, rx1454_pos, rx1454_off
+    is_cclass $I11, 32, rx1454_tgt, $I10
+    unless $I11, rx1454_fail
+    inc rx1454_pos
+    set_addr $I10, rxquantg1456_done
+    rx1454_cur."!mark_push"(rx1454_rep, rx1454_pos, $I10)
+    goto rxquantg1456_loop
+  rxquantg1456_done:
+  # rx pass
+    rx1454_cur."!cursor_pass"(rx1454_pos, "")
+    if_null rx1454_debug, debug_393
+    rx1454_cur."!cursor_debug"("PASS", "", " at pos=", rx1454_pos)
+  debug_393:
+    rx1454_cur."!cursor_backtrack"()
+    .return (rx1454_cur)
+  rx1454_restart:
+    if_null rx1454_debug, debug_394
+    rx1454_cur."!cursor_debug"("NEXT", "")
+  debug_394:
+  rx1454_fail:
+    (rx1454_rep, rx1454_pos, $I10, $P10) = rx1454_cur."!mark_fail"(0)
+    lt rx1454_pos, -1, rx1454_done
+    eq rx1454_pos, -1, rx1454_fail
+    jump $I10
+  rx1454_done:
+    rx1454_cur."!cursor_fail"()
+    if_null rx1454_debug, debug_395
+    rx1454_cur."!cursor_debug"("FAIL", "")
+  debug_395:
+    .return (rx1454_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1463"  :anon :subid("75_1792415686.17671") :method :outer("63_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 359
+    .const 'Sub' $P1468 = "76_1792415686.17671" 
+    capture_lex $P1468
+    .local string rx1465_tgt
+    .local int rx1465_pos
+    .local int rx1465_off
+    .local int rx1465_eos
+    .local int rx1465_rep
+    .local pmc rx1465_cur
+    .local pmc rx1465_debug
+    (rx1465_cur, rx1465_pos, rx1465_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1465_debug, rx1465_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1465_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1465_eos, rx1465_tgt
+    gt rx1465_pos, rx1465_eos, rx1465_done
+    set rx1465_off, 0
+    lt rx1465_pos, 2, rx1465_start
+    sub rx1465_off, rx1465_pos, 1
+    substr rx1465_tgt, rx1465_tgt, rx1465_off
+  rx1465_start:
+    eq $I10, 1, rx1465_restart
+    if_null rx1465_debug, debug_401
+    rx1465_cur."!cursor_debug"("START", "")
+  debug_401:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1466_done
+    goto rxscan1466_scan
+  rxscan1466_loop:
+    ($P10) = rx1465_cur."from"()
+    inc $P10
+    set rx1465_pos, $P10
+    ge rx1465_pos, rx1465_eos, rxscan1466_done
+  rxscan1466_scan:
+    set_addr $I10, rxscan1466_loop
+    rx1465_cur."!mark_push"(0, rx1465_pos, $I10)
+  rxscan1466_done:
+  # rxanchor bos
+    ne rx1465_pos, 0, rx1465_fail
+  # rx subrule $P1468 subtype=capture negate=
+    rx1465_cur."!cursor_pos"(rx1465_pos)
+    .const 'Sub' $P1468 = "76_1792415686.17671" 
+    capture_lex $P1468
+    $P10 = rx1465_cur.$P1468()
+    unless $P10, rx1465_fail
+    goto rxsubrule1472_pass
+  rxsubrule1472_back:
+    $P10 = $P10."!cursor_next"()
+    unless $P10, rx1465_fail
+  rxsubrule1472_pass:
+    set_addr $I10, rxsubrule1472_back
+    rx1465_cur."!mark_push"(0, rx1465_pos, $I10, $P10)
+    $P10."!cursor_names"(0)
+    rx1465_pos = $P10."pos"()
+  # rx charclass .
+    ge rx1465_pos, rx1465_eos, rx1465_fail
+    inc rx1465_pos
+  # rx pass
+    rx1465_cur."!cursor_pass"(rx1465_pos, "")
+    if_null rx1465_debug, debug_406
+    rx1465_cur."!cursor_debug"("PASS", "", " at pos=", rx1465_pos)
+  debug_406:
+    rx1465_cur."!cursor_backtrack"()
+    .return (rx1465_cur)
+  rx1465_restart:
+    if_null rx1465_debug, debug_407
+    rx1465_cur."!cursor_debug"("NEXT", "")
+  debug_407:
+  rx1465_fail:
+    (rx1465_rep, rx1465_pos, $I10, $P10) = rx1465_cur."!mark_fail"(0)
+    lt rx1465_pos, -1, rx1465_done
+    eq rx1465_pos, -1, rx1465_fail
+    jump $I10
+  rx1465_done:
+    rx1465_cur."!cursor_fail"()
+    if_null rx1465_debug, debug_408
+    rx1465_cur."!cursor_debug"("FAIL", "")
+  debug_408:
+    .return (rx1465_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1467"  :anon :subid("76_1792415686.17671") :method :outer("75_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 359
+    .local string rx1469_tgt
+    .local int rx1469_pos
+    .local int rx1469_off
+    .local int rx1469_eos
+    .local int rx1469_rep
+    .local pmc rx1469_cur
+    .local pmc rx1469_debug
+    (rx1469_cur, rx1469_pos, rx1469_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1469_debug, rx1469_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1469_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1469_eos, rx1469_tgt
+    gt rx1469_pos, rx1469_eos, rx1469_done
+    set rx1469_off, 0
+    lt rx1469_pos, 2, rx1469_start
+    sub rx1469_off, rx1469_pos, 1
+    substr rx1469_tgt, rx1469_tgt, rx1469_off
+  rx1469_start:
+    eq $I10, 1, rx1469_restart
+    if_null rx1469_debug, debug_402
+    rx1469_cur."!cursor_debug"("START", "")
+  debug_402:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1470_done
+    goto rxscan1470_scan
+  rxscan1470_loop:
+    ($P10) = rx1469_cur."from"()
+    inc $P10
+    set rx1469_pos, $P10
+    ge rx1469_pos, rx1469_eos, rxscan1470_done
+  rxscan1470_scan:
+    set_addr $I10, rxscan1470_loop
+    rx1469_cur."!mark_push"(0, rx1469_pos, $I10)
+  rxscan1470_done:
+  # rx rxquantg1471 ** 0..*
+    set_addr $I10, rxquantg1471_done
+    rx1469_cur."!mark_push"(0, rx1469_pos, $I10)
+  rxquantg1471_loop:
+  # rx charclass s
+    ge rx1469_pos, rx1469_eos, rx1469_fail
+    sub $I10, rx1469_pos, rx1469_off
+    is_cclass $I11, 32, rx1469_tgt, $I10
+    unless $I11, rx1469_fail
+    inc rx1469_pos
+    set_addr $I10, rxquantg1471_done
+    rx1469_cur."!mark_push"(rx1469_rep, rx1469_pos, $I10)
+    goto rxquantg1471_loop
+  rxquantg1471_done:
+  # rx pass
+    rx1469_cur."!cursor_pass"(rx1469_pos, "")
+    if_null rx1469_debug, debug_403
+    rx1469_cur."!cursor_debug"("PASS", "", " at pos=", rx1469_pos)
+  debug_403:
+    rx1469_cur."!cursor_backtrack"()
+    .return (rx1469_cur)
+  rx1469_restart:
+    if_null rx1469_debug, debug_404
+    rx1469_cur."!cursor_debug"("NEXT", "")
+  debug_404:
+  rx1469_fail:
+    (rx1469_rep, rx1469_pos, $I10, $P10) = rx1469_cur."!mark_fail"(0)
+    lt rx1469_pos, -1, rx1469_done
+    eq rx1469_pos, -1, rx1469_fail
+    jump $I10
+  rx1469_done:
+    rx1469_cur."!cursor_fail"()
+    if_null rx1469_debug, debug_405
+    rx1469_cur."!cursor_debug"("FAIL", "")
+  debug_405:
+    .return (rx1469_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1474"  :anon :subid("77_1792415686.17671") :outer("63_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 361
+    new $P121, "Undef"
+    set $P1476, $P121
+    .lex "$indent2", $P1476
+.annotate 'line', 360
+    find_lex $P122, "$m"
+    "debug"("Deeper", $P122)
+.annotate 'line', 361
+    find_lex $P1477, "$m"
+    unless_null $P1477, vivify_411
+    $P1477 = root_new ['parrot';'ResizablePMCArray']
+  vivify_411:
+    set $P122, $P1477[0]
+    unless_null $P122, vivify_412
+    new $P122, "Undef"
+  vivify_412:
+    $P123 = "length"($P122)
+    store_lex "$indent2", $P123
+.annotate 'line', 362
+    find_lex $P1479, "@indent"
+    unless_null $P1479, vivify_413
+    $P1479 = root_new ['parrot';'ResizablePMCArray']
+  vivify_413:
+    set $P123, $P1479[-1]
+    unless_null $P123, vivify_414
+    new $P123, "Undef"
+  vivify_414:
+    set $N101, $P123
+    find_lex $P125, "$indent2"
+    set $N102, $P125
+    isge $I101, $N101, $N102
+    if $I101, if_1478
+.annotate 'line', 367
+    $P1481 = root_new ['parrot';'Hash']
+    find_lex $P127, "$key"
+    find_lex $P1482, "%hash"
+    unless_null $P1482, vivify_415
+    $P1482 = root_new ['parrot';'Hash']
+    store_lex "%hash", $P1482
+  vivify_415:
+    set $P1482[$P127], $P1481
+.annotate 'line', 368
+    find_lex $P127, "self"
+    find_lex $P128, "$key"
+    find_lex $P1483, "%hash"
+    unless_null $P1483, vivify_416
+    $P1483 = root_new ['parrot';'Hash']
+  vivify_416:
+    set $P129, $P1483[$P128]
+    unless_null $P129, vivify_417
+    new $P129, "Undef"
+  vivify_417:
+    find_lex $P130, "@indent"
+    find_lex $P1484, "$m"
+    unless_null $P1484, vivify_418
+    $P1484 = root_new ['parrot';'ResizablePMCArray']
+  vivify_418:
+    set $P131, $P1484[0]
+    unless_null $P131, vivify_419
+    new $P131, "Undef"
+  vivify_419:
+    $P132 = "length"($P131)
+    new $P133, "ResizablePMCArray"
+    push $P133, $P130
+    push $P133, $P132
+    find_lex $P134, "@lines"
+    $P135 = $P127."_read_hash"($P129, $P133, $P134)
+.annotate 'line', 366
+    set $P122, $P135
+.annotate 'line', 362
+    goto if_1478_end
+  if_1478:
+.annotate 'line', 364
+    get_hll_global $P126, "undef"
+    find_lex $P127, "$key"
+    find_lex $P1480, "%hash"
+    unless_null $P1480, vivify_420
+    $P1480 = root_new ['parrot';'Hash']
+    store_lex "%hash", $P1480
+  vivify_420:
+    set $P1480[$P127], $P126
+.annotate 'line', 362
+    set $P122, $P126
+  if_1478_end:
+.annotate 'line', 359
+    .return ($P122)
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.include "except_types.pasm"
+.sub "write_string"  :subid("78_1792415686.17671") :method :outer("11_1792415686.17671")
+    .param pmc param_1489
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 377
+    new $P1488, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1488, control_1487
+    push_eh $P1488
+    .lex "self", self
+    .lex "$document", param_1489
+.annotate 'line', 378
+    new $P104, "String"
+    assign $P104, "---"
+    find_lex $P105, "self"
+    find_lex $P106, "$document"
+    $S100 = $P105."_dump"("", $P106)
+    concat $P107, $P104, $S100
+.annotate 'line', 377
+    .return ($P107)
+  control_1487:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P104, exception, "payload"
+    .return ($P104)
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.include "except_types.pasm"
+.sub "_dump"  :subid("79_1792415686.17671") :method :outer("11_1792415686.17671") :multi(_,_,["ResizablePMCArray"])
+    .param pmc param_1493
+    .param pmc param_1494
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 381
+    .const 'Sub' $P1498 = "80_1792415686.17671" 
+    capture_lex $P1498
+    new $P1492, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1492, control_1491
+    push_eh $P1492
+    .lex "self", self
+    .lex "$indent", param_1493
+    .lex "@list", param_1494
+.annotate 'line', 382
+    $P1496 = root_new ['parrot';'ResizablePMCArray']
+    set $P1495, $P1496
+    .lex "@items", $P1495
+    .const 'Sub' $P1498 = "80_1792415686.17671" 
+    newclosure $P1500, $P1498
+    find_lex $P104, "@list"
+    $P105 = "map"($P1500, $P104 :flat)
+    store_lex "@items", $P105
+.annotate 'line', 386
+    new $P104, "String"
+    assign $P104, "\n"
+    find_lex $P105, "@items"
+    $S100 = "join"("\n", $P105 :flat)
+    concat $P106, $P104, $S100
+.annotate 'line', 381
+    .return ($P106)
+  control_1491:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P104, exception, "payload"
+    .return ($P104)
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1497"  :anon :subid("80_1792415686.17671") :outer("79_1792415686.17671") :multi(_)
+    .param pmc param_1499
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 382
+    .lex "$_", param_1499
+.annotate 'line', 383
+    find_lex $P104, "$indent"
+    concat $P105, $P104, "-"
+    find_lex $P106, "self"
+    new $P107, "String"
+    assign $P107, "  "
+    find_lex $P108, "$indent"
+    concat $P109, $P107, $P108
+    find_lex $P110, "$_"
+    $S100 = $P106."_dump"($P109, $P110)
+    concat $P111, $P105, $S100
+.annotate 'line', 382
+    .return ($P111)
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.include "except_types.pasm"
+.sub "_dump"  :subid("81_1792415686.17671") :method :outer("11_1792415686.17671") :multi(_,_,["Hash"])
+    .param pmc param_1504
+    .param pmc param_1505
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 389
+    .const 'Sub' $P1507 = "82_1792415686.17671" 
+    capture_lex $P1507
+    new $P1503, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1503, control_1502
+    push_eh $P1503
+    .lex "self", self
+    .lex "$indent", param_1504
+    .lex "%hash", param_1505
+.annotate 'line', 390
+    new $P104, "String"
+    assign $P104, "\n"
+    .const 'Sub' $P1507 = "82_1792415686.17671" 
+    newclosure $P1510, $P1507
+    find_lex $P105, "%hash"
+    $P106 = $P105."keys"()
+    $P107 = "map"($P1510, $P106 :flat)
+    $S100 = "join"("\n", $P107 :flat)
+    concat $P108, $P104, $S100
+.annotate 'line', 389
+    .return ($P108)
+  control_1502:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P104, exception, "payload"
+    .return ($P104)
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1506"  :anon :subid("82_1792415686.17671") :outer("81_1792415686.17671") :multi(_)
+    .param pmc param_1508
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 390
+    .lex "$k", param_1508
+    find_lex $P105, "$indent"
+    find_lex $P106, "$k"
+    concat $P107, $P105, $P106
+    concat $P108, $P107, ": "
+    find_lex $P109, "self"
+    new $P110, "String"
+    assign $P110, "  "
+    find_lex $P111, "$indent"
+    concat $P112, $P110, $P111
+    find_lex $P113, "$k"
+    find_lex $P1509, "%hash"
+    unless_null $P1509, vivify_429
+    $P1509 = root_new ['parrot';'Hash']
+  vivify_429:
+    set $P114, $P1509[$P113]
+    unless_null $P114, vivify_430
+    new $P114, "Undef"
+  vivify_430:
+    $S100 = $P109."_dump"($P112, $P114)
+    concat $P115, $P108, $S100
+    .return ($P115)
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.include "except_types.pasm"
+.sub "_dump"  :subid("83_1792415686.17671") :method :outer("11_1792415686.17671") :multi(_,_,["String"])
+    .param pmc param_1514
+    .param pmc param_1515
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 393
+    .const 'Sub' $P1517 = "84_1792415686.17671" 
+    capture_lex $P1517
+    new $P1513, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1513, control_1512
+    push_eh $P1513
+    .lex "self", self
+    .lex "$indent", param_1514
+    .lex "$value", param_1515
+.annotate 'line', 394
+    new $P104, "String"
+    assign $P104, " '"
+    find_lex $P105, "$value"
+    get_hll_global $P106, ["Regex"], "Regex"
+    .const 'Sub' $P1517 = "84_1792415686.17671" 
+    capture_lex $P1517
+    $P107 = $P106."new"($P1517)
+    $S100 = "subst"($P105, $P107, "''", 1 :named("global"))
+    concat $P108, $P104, $S100
+    concat $P109, $P108, "'"
+.annotate 'line', 393
+    .return ($P109)
+  control_1512:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P104, exception, "payload"
+    .return ($P104)
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1516"  :anon :subid("84_1792415686.17671") :method :outer("83_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 394
+    .local string rx1518_tgt
+    .local int rx1518_pos
+    .local int rx1518_off
+    .local int rx1518_eos
+    .local int rx1518_rep
+    .local pmc rx1518_cur
+    .local pmc rx1518_debug
+    (rx1518_cur, rx1518_pos, rx1518_tgt, $I10) = self."!cursor_start"()
+    getattribute rx1518_debug, rx1518_cur, "$!debug"
+    .lex unicode:"$\x{a2}", rx1518_cur
+    .local pmc match
+    .lex "$/", match
+    length rx1518_eos, rx1518_tgt
+    gt rx1518_pos, rx1518_eos, rx1518_done
+    set rx1518_off, 0
+    lt rx1518_pos, 2, rx1518_start
+    sub rx1518_off, rx1518_pos, 1
+    substr rx1518_tgt, rx1518_tgt, rx1518_off
+  rx1518_start:
+    eq $I10, 1, rx1518_restart
+    if_null rx1518_debug, debug_431
+    rx1518_cur."!cursor_debug"("START", "")
+  debug_431:
+    $I10 = self.'from'()
+    ne $I10, -1, rxscan1519_done
+    goto rxscan1519_scan
+  rxscan1519_loop:
+    ($P10) = rx1518_cur."from"()
+    inc $P10
+    set rx1518_pos, $P10
+    ge rx1518_pos, rx1518_eos, rxscan1519_done
+  rxscan1519_scan:
+    set_addr $I10, rxscan1519_loop
+    rx1518_cur."!mark_push"(0, rx1518_pos, $I10)
+  rxscan1519_done:
+  # rx literal  "'"
+    add $I11, rx1518_pos, 1
+    gt $I11, rx1518_eos, rx1518_fail
+    sub $I11, rx1518_pos, rx1518_off
+    ord $I11, rx1518_tgt, $I11
+    ne $I11, 39, rx1518_fail
+    add rx1518_pos, 1
+  # rx pass
+    rx1518_cur."!cursor_pass"(rx1518_pos, "")
+    if_null rx1518_debug, debug_432
+    rx1518_cur."!cursor_debug"("PASS", "", " at pos=", rx1518_pos)
+  debug_432:
+    rx1518_cur."!cursor_backtrack"()
+    .return (rx1518_cur)
+  rx1518_restart:
+    if_null rx1518_debug, debug_433
+    rx1518_cur."!cursor_debug"("NEXT", "")
+  debug_433:
+  rx1518_fail:
+    (rx1518_rep, rx1518_pos, $I10, $P10) = rx1518_cur."!mark_fail"(0)
+    lt rx1518_pos, -1, rx1518_done
+    eq rx1518_pos, -1, rx1518_fail
+    jump $I10
+  rx1518_done:
+    rx1518_cur."!cursor_fail"()
+    if_null rx1518_debug, debug_434
+    rx1518_cur."!cursor_debug"("FAIL", "")
+  debug_434:
+    .return (rx1518_cur)
+    .return ()
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.include "except_types.pasm"
+.sub "_dump"  :subid("85_1792415686.17671") :method :outer("11_1792415686.17671") :multi(_,_,_)
+    .param pmc param_1523
+    .param pmc param_1524
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 397
+    new $P1522, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1522, control_1521
+    push_eh $P1522
+    .lex "self", self
+    .lex "$indent", param_1523
+    .lex "$value", param_1524
+.annotate 'line', 398
+    new $P104, "String"
+    assign $P104, " "
+    find_lex $P105, "$value"
+    concat $P106, $P104, $P105
+.annotate 'line', 397
+    .return ($P106)
+  control_1521:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P104, exception, "payload"
+    .return ($P104)
+.end
+
+
+.namespace ["YAML";"Tiny"]
+.sub "_block1525" :load :anon :subid("86_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 12
+    .const '' $P1527 = "11_1792415686.17671" 
+    $P104 = $P1527()
+    .return ($P104)
+.end
+
+
+.namespace []
+.sub "_block1528" :load :anon :subid("87_1792415686.17671")
+.annotate 'file', "runtime/parrot/library/YAML/Tiny.pm"
+.annotate 'line', 1
+    .const '' $P1530 = "10_1792415686.17671" 
+    $P100 = $P1530()
+    .return ($P100)
+.end
+
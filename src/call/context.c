@@ -497,7 +497,8 @@ Parrot_pcc_allocate_registers(PARROT_INTERP, ARGIN(PMC *pmcctx),
 
 =item C<void Parrot_pcc_free_registers(PARROT_INTERP, PMC *pmcctx)>
 
-Free memory allocated for registers in Context.
+Free memory allocated for registers in Context, leaving it without
+registers.
 
 =cut
 
@@ -514,6 +515,12 @@ Parrot_pcc_free_registers(PARROT_INTERP, ARGIN(PMC *pmcctx))
 
     if (reg_size)
         Parrot_gc_free_fixed_size_storage(interp, reg_size, ctx->registers);
+
+    ctx->registers              = NULL;
+    ctx->n_regs_used[REGNO_INT] = 0;
+    ctx->n_regs_used[REGNO_NUM] = 0;
+    ctx->n_regs_used[REGNO_STR] = 0;
+    ctx->n_regs_used[REGNO_PMC] = 0;
 }
 
 
@@ -25,6 +25,7 @@ value passing to and from subroutines.
 #include "pmc/pmc_key.h"
 #include "pmc/pmc_continuation.h"
 #include "pmc/pmc_callcontext.h"
+#include "pmc/pmc_sub.h"
 
 /* HEADERIZER HFILE: include/parrot/call.h */
 
@@ -35,6 +36,15 @@ static int do_run_ops(PARROT_INTERP, ARGIN(PMC *sub_obj))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+static void invoke_with_continuation(PARROT_INTERP,
+    ARGIN(PMC *sub_obj),
+    ARGIN(PMC *call_object),
+    ARGIN(PMC *ret_cont))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4);
+
 PARROT_INLINE
 PARROT_WARN_UNUSED_RESULT
 static int is_invokable(PARROT_INTERP, ARGIN(PMC *sub_obj))
@@ -51,6 +61,11 @@ static void Parrot_pcc_add_invocant(PARROT_INTERP,
 #define ASSERT_ARGS_do_run_ops __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(sub_obj))
+#define ASSERT_ARGS_invoke_with_continuation __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(sub_obj) \
+    , PARROT_ASSERT_ARG(call_object) \
+    , PARROT_ASSERT_ARG(ret_cont))
 #define ASSERT_ARGS_is_invokable __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(sub_obj))
@@ -318,11 +333,139 @@ Parrot_pcc_invoke_from_sig_object(PARROT_INTERP, ARGIN(PMC *sub_obj),
 {
     ASSERT_ARGS(Parrot_pcc_invoke_from_sig_object)
 
-    opcode_t    *dest;
     PMC * const  ret_cont = Parrot_pmc_new(interp, enum_class_Continuation);
     if (UNLIKELY(PMC_IS_NULL(call_object)))
         call_object = Parrot_pmc_new(interp, enum_class_CallContext);
 
+    invoke_with_continuation(interp, sub_obj, call_object, ret_cont);
+}
+
+/*
+
+=item C<INTVAL Parrot_pcc_frame_reusable(PARROT_INTERP, PMC *sub_obj)>
+
+Returns true if nothing in the code of C<sub_obj> keeps its frame alive
+after it returned: it is a plain Sub without lexicals, and no other Sub has
+it as C<:outer>, so no closure can capture it.  The CallContext of such
+calls can be passed again to C<Parrot_pcc_reinvoke_from_sig_object>, unless
+C<Parrot_pcc_frame_escaped> says that a particular call let it out.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+INTVAL
+Parrot_pcc_frame_reusable(PARROT_INTERP, ARGIN(PMC *sub_obj))
+{
+    ASSERT_ARGS(Parrot_pcc_frame_reusable)
+    Parrot_Sub_attributes *sub;
+
+    if (sub_obj->vtable->base_type != enum_class_Sub
+    ||  PObj_get_FLAGS(sub_obj) & SUB_FLAG_IS_OUTER)
+        return 0;
+
+    PMC_get_sub(interp, sub_obj, sub);
+    return PMC_IS_NULL(sub->lex_info);
+}
+
+/*
+
+=item C<INTVAL Parrot_pcc_frame_escaped(PARROT_INTERP, PMC *call_object)>
+
+Returns true if the returned call C<call_object> may still be referenced, so
+it must not be reused: something fetched the context or its return
+Continuation (C<interpinfo>, C<getinterp>, C<caller_ctx>), a Continuation
+was pointed at a label in it (C<set_label>, C<push_eh>, C<die>), or it was
+left with exception handlers installed.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+INTVAL
+Parrot_pcc_frame_escaped(PARROT_INTERP, ARGIN(PMC *call_object))
+{
+    ASSERT_ARGS(Parrot_pcc_frame_escaped)
+    PMC * const handlers = Parrot_pcc_get_handlers(interp, call_object);
+
+    return CALLSIGNATURE_escaped_TEST(call_object)
+        || (!PMC_IS_NULL(handlers) && VTABLE_elements(interp, handlers) > 0);
+}
+
+/*
+
+=item C<void Parrot_pcc_reinvoke_from_sig_object(PARROT_INTERP, PMC *sub_obj,
+PMC *call_object)>
+
+Like C<Parrot_pcc_invoke_from_sig_object>, for repeated calls such as sort
+comparisons.  C<call_object> may be the CallContext of a returned call to a
+Sub for which C<Parrot_pcc_frame_reusable> is true and that did not escape
+(see C<Parrot_pcc_frame_escaped>), refilled with the new arguments: its
+registers are released before the Sub allocates them again, and its return
+Continuation is rewound instead of creating a new one.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_pcc_reinvoke_from_sig_object(PARROT_INTERP, ARGIN(PMC *sub_obj),
+        ARGIN(PMC *call_object))
+{
+    ASSERT_ARGS(Parrot_pcc_reinvoke_from_sig_object)
+    PMC   *ret_cont = Parrot_pcc_get_continuation(interp, call_object);
+    INTVAL invoked  = 0;
+
+    if (!PMC_IS_NULL(Parrot_pcc_get_sub(interp, call_object))) {
+        Parrot_pcc_free_registers(interp, call_object);
+        Parrot_pcc_set_sub(interp, call_object, PMCNULL);
+    }
+
+    if (!PMC_IS_NULL(ret_cont))
+        GETATTR_Continuation_invoked(interp, ret_cont, invoked);
+
+    if (!invoked)
+        ret_cont = Parrot_pmc_new(interp, enum_class_Continuation);
+    else {
+        PMC * const ctx = CURRENT_CONTEXT(interp);
+
+        SETATTR_Continuation_to_ctx(interp, ret_cont, ctx);
+        SETATTR_Continuation_to_call_object(interp, ret_cont,
+                Parrot_pcc_get_signature(interp, ctx));
+        SETATTR_Continuation_runloop_id(interp, ret_cont, 0);
+        SETATTR_Continuation_seg(interp, ret_cont, interp->code);
+        SETATTR_Continuation_address(interp, ret_cont, NULL);
+        SETATTR_Continuation_invoked(interp, ret_cont, 0);
+        PARROT_GC_WRITE_BARRIER(interp, ret_cont);
+    }
+
+    invoke_with_continuation(interp, sub_obj, call_object, ret_cont);
+}
+
+/*
+
+=item C<static void invoke_with_continuation(PARROT_INTERP, PMC *sub_obj, PMC
+*call_object, PMC *ret_cont)>
+
+Invokes C<sub_obj> with the arguments in C<call_object>, returning through
+C<ret_cont>.  Runs the ops of PIR Subs.
+
+=cut
+
+*/
+
+static void
+invoke_with_continuation(PARROT_INTERP, ARGIN(PMC *sub_obj),
+        ARGIN(PMC *call_object), ARGIN(PMC *ret_cont))
+{
+    ASSERT_ARGS(invoke_with_continuation)
+    opcode_t *dest;
+
     Parrot_pcc_set_signature(interp, CURRENT_CONTEXT(interp), call_object);
     PARROT_CONTINUATION(ret_cont)->from_ctx = call_object;
     Parrot_pcc_set_continuation(interp, call_object, ret_cont);
@@ -0,0 +1,325 @@
+/* DO NOT EDIT THIS FILE
+ *
+ * Automatically generated by config/gen/core_pmcs.pm
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/global_setup.h"
+
+
+extern void Parrot_default_class_init(PARROT_INTERP, int, int);
+extern void Parrot_Null_class_init(PARROT_INTERP, int, int);
+extern void Parrot_Env_class_init(PARROT_INTERP, int, int);
+extern void Parrot_Key_class_init(PARROT_INTERP, int, int);
+extern void Parrot_UnManagedStruct_class_init(PARROT_INTERP, int, int);
+extern void Parrot_ManagedStruct_class_init(PARROT_INTERP, int, int);
+extern void Parrot_Exception_class_init(PARROT_INTERP, int, int);
+extern void Parrot_ParrotLibrary_class_init(PARROT_INTERP, int, int);
+extern void Parrot_ParrotInterpreter_class_init(PARROT_INTERP, int, int);
+extern void Parrot_LexPad_class_init(PARROT_INTERP, int, int);
+extern void Parrot_Timer_class_init(PARROT_INTERP, int, int);
+extern void Parrot_Pointer_class_init(PARROT_INTERP, int, int);
+extern void Parrot_Sub_class_init(PARROT_INTERP, int, int);
+extern void Parrot_Coroutine_class_init(PARROT_INTERP, int, int);
+extern void Parrot_EventHandler_class_init(PARROT_INTERP, int, int);
+extern void Parrot_Continuation_class_init(PARROT_INTERP, int, int);
+extern void Parrot_ExceptionHandler_class_init(PARROT_INTERP, int, int);
+extern void Parrot_NCI_class_init(PARROT_INTERP, int, int);
+extern void Parrot_BigInt_class_init(PARROT_INTERP, int, int);
+extern void Parrot_BigNum_class_init(PARROT_INTERP, int, int);
+extern void Parrot_Complex_class_init(PARROT_INTERP, int, int);
+extern void Parrot_FixedIntegerArray_class_init(PARROT_INTERP, int, int);
+extern void Parrot_ResizableIntegerArray_class_init(PARROT_INTERP, int, int);
+extern void Parrot_Iterator_class_init(PARROT_INTERP, int, int);
+extern void Parrot_ArrayIterator_class_init(PARROT_INTERP, int, int);
+extern void Parrot_HashIterator_class_init(PARROT_INTERP, int, int);
+extern void Parrot_OrderedHashIterator_class_init(PARROT_INTERP, int, int);
+extern void Parrot_StringIterator_class_init(PARROT_INTERP, int, int);
+extern void Parrot_FixedStringArray_class_init(PARROT_INTERP, int, int);
+extern void Parrot_ResizableStringArray_class_init(PARROT_INTERP, int, int);
+extern void Parrot_Hash_class_init(PARROT_INTERP, int, int);
+extern void Parrot_LexInfo_class_init(PARROT_INTERP, int, int);
+extern void Parrot_NameSpace_class_init(PARROT_INTERP, int, int);
+extern void Parrot_OrderedHash_class_init(PARROT_INTERP, int, int);
+extern void Parrot_OpLib_class_init(PARROT_INTERP, int, int);
+extern void Parrot_Opcode_class_init(PARROT_INTERP, int, int);
+extern void Parrot_CallContext_class_init(PARROT_INTERP, int, int);
+extern void Parrot_AddrRegistry_class_init(PARROT_INTERP, int, int);
+extern void Parrot_Alarm_class_init(PARROT_INTERP, int, int);
+extern void Parrot_ByteBuffer_class_init(PARROT_INTERP, int, int);
+extern void Parrot_Capture_class_init(PARROT_INTERP, int, int);
+extern void Parrot_Channel_class_init(PARROT_INTERP, int, int);
+extern void Parrot_Class_class_init(PARROT_INTERP, int, int);
+extern void Parrot_PMCProxy_class_init(PARROT_INTERP, int, int);
+extern void Parrot_Exporter_class_init(PARROT_INTERP, int, int);
+extern void Parrot_FixedBooleanArray_class_init(PARROT_INTERP, int, int);
+extern void Parrot_ResizableBooleanArray_class_init(PARROT_INTERP, int, int);
+extern void Parrot_FixedFloatArray_class_init(PARROT_INTERP, int, int);
+extern void Parrot_ResizableFloatArray_class_init(PARROT_INTERP, int, int);
+extern void Parrot_FixedPMCArray_class_init(PARROT_INTERP, int, int);
+extern void Parrot_ResizablePMCArray_class_init(PARROT_INTERP, int, int);
+extern void Parrot_MultiSub_class_init(PARROT_INTERP, int, int);
+extern void Parrot_Handle_class_init(PARROT_INTERP, int, int);
+extern void Parrot_FileHandle_class_init(PARROT_INTERP, int, int);
+extern void Parrot_Socket_class_init(PARROT_INTERP, int, int);
+extern void Parrot_StringHandle_class_init(PARROT_INTERP, int, int);
+extern void Parrot_HashIteratorKey_class_init(PARROT_INTERP, int, int);
+extern void Parrot_ImageIOFreeze_class_init(PARROT_INTERP, int, int);
+extern void Parrot_ImageIOSize_class_init(PARROT_INTERP, int, int);
+extern void Parrot_ImageIOStrings_class_init(PARROT_INTERP, int, int);
+extern void Parrot_ImageIOThaw_class_init(PARROT_INTERP, int, int);
+extern void Parrot_IMCCompiler_class_init(PARROT_INTERP, int, int);
+extern void Parrot_MappedByteArray_class_init(PARROT_INTERP, int, int);
+extern void Parrot_NativePCCMethod_class_init(PARROT_INTERP, int, int);
+extern void Parrot_Object_class_init(PARROT_INTERP, int, int);
+extern void Parrot_OS_class_init(PARROT_INTERP, int, int);
+extern void Parrot_Packfile_class_init(PARROT_INTERP, int, int);
+extern void Parrot_PackfileAnnotation_class_init(PARROT_INTERP, int, int);
+extern void Parrot_PackfileOpMap_class_init(PARROT_INTERP, int, int);
+extern void Parrot_PackfileSegment_class_init(PARROT_INTERP, int, int);
+extern void Parrot_PackfileAnnotations_class_init(PARROT_INTERP, int, int);
+extern void Parrot_PackfileConstantTable_class_init(PARROT_INTERP, int, int);
+extern void Parrot_PackfileDirectory_class_init(PARROT_INTERP, int, int);
+extern void Parrot_PackfileRawSegment_class_init(PARROT_INTERP, int, int);
+extern void Parrot_PackfileBytecodeSegment_class_init(PARROT_INTERP, int, int);
+extern void Parrot_PackfileDebug_class_init(PARROT_INTERP, int, int);
+extern void Parrot_PackfileView_class_init(PARROT_INTERP, int, int);
+extern void Parrot_PMCList_class_init(PARROT_INTERP, int, int);
+extern void Parrot_Proxy_class_init(PARROT_INTERP, int, int);
+extern void Parrot_Ptr_class_init(PARROT_INTERP, int, int);
+extern void Parrot_PtrBuf_class_init(PARROT_INTERP, int, int);
+extern void Parrot_PtrObj_class_init(PARROT_INTERP, int, int);
+extern void Parrot_Role_class_init(PARROT_INTERP, int, int);
+extern void Parrot_scalar_class_init(PARROT_INTERP, int, int);
+extern void Parrot_Float_class_init(PARROT_INTERP, int, int);
+extern void Parrot_Integer_class_init(PARROT_INTERP, int, int);
+extern void Parrot_String_class_init(PARROT_INTERP, int, int);
+extern void Parrot_Boolean_class_init(PARROT_INTERP, int, int);
+extern void Parrot_Scheduler_class_init(PARROT_INTERP, int, int);
+extern void Parrot_SchedulerMessage_class_init(PARROT_INTERP, int, int);
+extern void Parrot_Sockaddr_class_init(PARROT_INTERP, int, int);
+extern void Parrot_StringBuilder_class_init(PARROT_INTERP, int, int);
+extern void Parrot_StructView_class_init(PARROT_INTERP, int, int);
+extern void Parrot_Task_class_init(PARROT_INTERP, int, int);
+extern void Parrot_Callback_class_init(PARROT_INTERP, int, int);
+extern void Parrot_Undef_class_init(PARROT_INTERP, int, int);
+
+void Parrot_gbl_initialize_core_pmcs(PARROT_INTERP, int pass)
+{
+    /* first the PMC with the highest enum
+     * this reduces MMD table resize action */
+    Parrot_Undef_class_init(interp, enum_class_Undef, pass);
+    Parrot_default_class_init(interp, enum_class_default, pass);
+    Parrot_Null_class_init(interp, enum_class_Null, pass);
+    Parrot_Env_class_init(interp, enum_class_Env, pass);
+    Parrot_Key_class_init(interp, enum_class_Key, pass);
+    Parrot_UnManagedStruct_class_init(interp, enum_class_UnManagedStruct, pass);
+    Parrot_ManagedStruct_class_init(interp, enum_class_ManagedStruct, pass);
+    Parrot_Exception_class_init(interp, enum_class_Exception, pass);
+    Parrot_ParrotLibrary_class_init(interp, enum_class_ParrotLibrary, pass);
+    Parrot_ParrotInterpreter_class_init(interp, enum_class_ParrotInterpreter, pass);
+    Parrot_LexPad_class_init(interp, enum_class_LexPad, pass);
+    Parrot_Timer_class_init(interp, enum_class_Timer, pass);
+    Parrot_Pointer_class_init(interp, enum_class_Pointer, pass);
+    Parrot_Sub_class_init(interp, enum_class_Sub, pass);
+    Parrot_Coroutine_class_init(interp, enum_class_Coroutine, pass);
+    Parrot_EventHandler_class_init(interp, enum_class_EventHandler, pass);
+    Parrot_Continuation_class_init(interp, enum_class_Continuation, pass);
+    Parrot_ExceptionHandler_class_init(interp, enum_class_ExceptionHandler, pass);
+    Parrot_NCI_class_init(interp, enum_class_NCI, pass);
+    Parrot_BigInt_class_init(interp, enum_class_BigInt, pass);
+    Parrot_BigNum_class_init(interp, enum_class_BigNum, pass);
+    Parrot_Complex_class_init(interp, enum_class_Complex, pass);
+    Parrot_FixedIntegerArray_class_init(interp, enum_class_FixedIntegerArray, pass);
+    Parrot_ResizableIntegerArray_class_init(interp, enum_class_ResizableIntegerArray, pass);
+    Parrot_Iterator_class_init(interp, enum_class_Iterator, pass);
+    Parrot_ArrayIterator_class_init(interp, enum_class_ArrayIterator, pass);
+    Parrot_HashIterator_class_init(interp, enum_class_HashIterator, pass);
+    Parrot_OrderedHashIterator_class_init(interp, enum_class_OrderedHashIterator, pass);
+    Parrot_StringIterator_class_init(interp, enum_class_StringIterator, pass);
+    Parrot_FixedStringArray_class_init(interp, enum_class_FixedStringArray, pass);
+    Parrot_ResizableStringArray_class_init(interp, enum_class_ResizableStringArray, pass);
+    Parrot_Hash_class_init(interp, enum_class_Hash, pass);
+    Parrot_LexInfo_class_init(interp, enum_class_LexInfo, pass);
+    Parrot_NameSpace_class_init(interp, enum_class_NameSpace, pass);
+    Parrot_OrderedHash_class_init(interp, enum_class_OrderedHash, pass);
+    Parrot_OpLib_class_init(interp, enum_class_OpLib, pass);
+    Parrot_Opcode_class_init(interp, enum_class_Opcode, pass);
+    Parrot_CallContext_class_init(interp, enum_class_CallContext, pass);
+    Parrot_AddrRegistry_class_init(interp, enum_class_AddrRegistry, pass);
+    Parrot_Alarm_class_init(interp, enum_class_Alarm, pass);
+    Parrot_ByteBuffer_class_init(interp, enum_class_ByteBuffer, pass);
+    Parrot_Capture_class_init(interp, enum_class_Capture, pass);
+    Parrot_Channel_class_init(interp, enum_class_Channel, pass);
+    Parrot_Class_class_init(interp, enum_class_Class, pass);
+    Parrot_PMCProxy_class_init(interp, enum_class_PMCProxy, pass);
+    Parrot_Exporter_class_init(interp, enum_class_Exporter, pass);
+    Parrot_FixedBooleanArray_class_init(interp, enum_class_FixedBooleanArray, pass);
+    Parrot_ResizableBooleanArray_class_init(interp, enum_class_ResizableBooleanArray, pass);
+    Parrot_FixedFloatArray_class_init(interp, enum_class_FixedFloatArray, pass);
+    Parrot_ResizableFloatArray_class_init(interp, enum_class_ResizableFloatArray, pass);
+    Parrot_FixedPMCArray_class_init(interp, enum_class_FixedPMCArray, pass);
+    Parrot_ResizablePMCArray_class_init(interp, enum_class_ResizablePMCArray, pass);
+    Parrot_MultiSub_class_init(interp, enum_class_MultiSub, pass);
+    Parrot_Handle_class_init(interp, enum_class_Handle, pass);
+    Parrot_FileHandle_class_init(interp, enum_class_FileHandle, pass);
+    Parrot_Socket_class_init(interp, enum_class_Socket, pass);
+    Parrot_StringHandle_class_init(interp, enum_class_StringHandle, pass);
+    Parrot_HashIteratorKey_class_init(interp, enum_class_HashIteratorKey, pass);
+    Parrot_ImageIOFreeze_class_init(interp, enum_class_ImageIOFreeze, pass);
+    Parrot_ImageIOSize_class_init(interp, enum_class_ImageIOSize, pass);
+    Parrot_ImageIOStrings_class_init(interp, enum_class_ImageIOStrings, pass);
+    Parrot_ImageIOThaw_class_init(interp, enum_class_ImageIOThaw, pass);
+    Parrot_IMCCompiler_class_init(interp, enum_class_IMCCompiler, pass);
+    Parrot_MappedByteArray_class_init(interp, enum_class_MappedByteArray, pass);
+    Parrot_NativePCCMethod_class_init(interp, enum_class_NativePCCMethod, pass);
+    Parrot_Object_class_init(interp, enum_class_Object, pass);
+    Parrot_OS_class_init(interp, enum_class_OS, pass);
+    Parrot_Packfile_class_init(interp, enum_class_Packfile, pass);
+    Parrot_PackfileAnnotation_class_init(interp, enum_class_PackfileAnnotation, pass);
+    Parrot_PackfileOpMap_class_init(interp, enum_class_PackfileOpMap, pass);
+    Parrot_PackfileSegment_class_init(interp, enum_class_PackfileSegment, pass);
+    Parrot_PackfileAnnotations_class_init(interp, enum_class_PackfileAnnotations, pass);
+    Parrot_PackfileConstantTable_class_init(interp, enum_class_PackfileConstantTable, pass);
+    Parrot_PackfileDirectory_class_init(interp, enum_class_PackfileDirectory, pass);
+    Parrot_PackfileRawSegment_class_init(interp, enum_class_PackfileRawSegment, pass);
+    Parrot_PackfileBytecodeSegment_class_init(interp, enum_class_PackfileBytecodeSegment, pass);
+    Parrot_PackfileDebug_class_init(interp, enum_class_PackfileDebug, pass);
+    Parrot_PackfileView_class_init(interp, enum_class_PackfileView, pass);
+    Parrot_PMCList_class_init(interp, enum_class_PMCList, pass);
+    Parrot_Proxy_class_init(interp, enum_class_Proxy, pass);
+    Parrot_Ptr_class_init(interp, enum_class_Ptr, pass);
+    Parrot_PtrBuf_class_init(interp, enum_class_PtrBuf, pass);
+    Parrot_PtrObj_class_init(interp, enum_class_PtrObj, pass);
+    Parrot_Role_class_init(interp, enum_class_Role, pass);
+    Parrot_scalar_class_init(interp, enum_class_scalar, pass);
+    Parrot_Float_class_init(interp, enum_class_Float, pass);
+    Parrot_Integer_class_init(interp, enum_class_Integer, pass);
+    Parrot_String_class_init(interp, enum_class_String, pass);
+    Parrot_Boolean_class_init(interp, enum_class_Boolean, pass);
+    Parrot_Scheduler_class_init(interp, enum_class_Scheduler, pass);
+    Parrot_SchedulerMessage_class_init(interp, enum_class_SchedulerMessage, pass);
+    Parrot_Sockaddr_class_init(interp, enum_class_Sockaddr, pass);
+    Parrot_StringBuilder_class_init(interp, enum_class_StringBuilder, pass);
+    Parrot_StructView_class_init(interp, enum_class_StructView, pass);
+    Parrot_Task_class_init(interp, enum_class_Task, pass);
+    Parrot_Callback_class_init(interp, enum_class_Callback, pass);
+}
+
+static void register_pmc(PARROT_INTERP, ARGIN(PMC *registry), int pmc_id)
+{
+    STRING * const key = interp->vtables[pmc_id]->whoami;
+    VTABLE_set_integer_keyed_str(interp, registry, key, pmc_id);
+}
+
+void
+Parrot_gbl_register_core_pmcs(PARROT_INTERP, ARGIN(PMC *registry))
+{
+    register_pmc(interp, registry, enum_class_default);
+    register_pmc(interp, registry, enum_class_Null);
+    register_pmc(interp, registry, enum_class_Env);
+    register_pmc(interp, registry, enum_class_Key);
+    register_pmc(interp, registry, enum_class_UnManagedStruct);
+    register_pmc(interp, registry, enum_class_ManagedStruct);
+    register_pmc(interp, registry, enum_class_Exception);
+    register_pmc(interp, registry, enum_class_ParrotLibrary);
+    register_pmc(interp, registry, enum_class_ParrotInterpreter);
+    register_pmc(interp, registry, enum_class_LexPad);
+    register_pmc(interp, registry, enum_class_Timer);
+    register_pmc(interp, registry, enum_class_Pointer);
+    register_pmc(interp, registry, enum_class_Sub);
+    register_pmc(interp, registry, enum_class_Coroutine);
+    register_pmc(interp, registry, enum_class_EventHandler);
+    register_pmc(interp, registry, enum_class_Continuation);
+    register_pmc(interp, registry, enum_class_ExceptionHandler);
+    register_pmc(interp, registry, enum_class_NCI);
+    register_pmc(interp, registry, enum_class_BigInt);
+    register_pmc(interp, registry, enum_class_BigNum);
+    register_pmc(interp, registry, enum_class_Complex);
+    register_pmc(interp, registry, enum_class_FixedIntegerArray);
+    register_pmc(interp, registry, enum_class_ResizableIntegerArray);
+    register_pmc(interp, registry, enum_class_Iterator);
+    register_pmc(interp, registry, enum_class_ArrayIterator);
+    register_pmc(interp, registry, enum_class_HashIterator);
+    register_pmc(interp, registry, enum_class_OrderedHashIterator);
+    register_pmc(interp, registry, enum_class_StringIterator);
+    register_pmc(interp, registry, enum_class_FixedStringArray);
+    register_pmc(interp, registry, enum_class_ResizableStringArray);
+    register_pmc(interp, registry, enum_class_Hash);
+    register_pmc(interp, registry, enum_class_LexInfo);
+    register_pmc(interp, registry, enum_class_NameSpace);
+    register_pmc(interp, registry, enum_class_OrderedHash);
+    register_pmc(interp, registry, enum_class_OpLib);
+    register_pmc(interp, registry, enum_class_Opcode);
+    register_pmc(interp, registry, enum_class_CallContext);
+    register_pmc(interp, registry, enum_class_AddrRegistry);
+    register_pmc(interp, registry, enum_class_Alarm);
+    register_pmc(interp, registry, enum_class_ByteBuffer);
+    register_pmc(interp, registry, enum_class_Capture);
+    register_pmc(interp, registry, enum_class_Channel);
+    register_pmc(interp, registry, enum_class_Class);
+    register_pmc(interp, registry, enum_class_PMCProxy);
+    register_pmc(interp, registry, enum_class_Exporter);
+    register_pmc(interp, registry, enum_class_FixedBooleanArray);
+    register_pmc(interp, registry, enum_class_ResizableBooleanArray);
+    register_pmc(interp, registry, enum_class_FixedFloatArray);
+    register_pmc(interp, registry, enum_class_ResizableFloatArray);
+    register_pmc(interp, registry, enum_class_FixedPMCArray);
+    register_pmc(interp, registry, enum_class_ResizablePMCArray);
+    register_pmc(interp, registry, enum_class_MultiSub);
+    register_pmc(interp, registry, enum_class_Handle);
+    register_pmc(interp, registry, enum_class_FileHandle);
+    register_pmc(interp, registry, enum_class_Socket);
+    register_pmc(interp, registry, enum_class_StringHandle);
+    register_pmc(interp, registry, enum_class_HashIteratorKey);
+    register_pmc(interp, registry, enum_class_ImageIOFreeze);
+    register_pmc(interp, registry, enum_class_ImageIOSize);
+    register_pmc(interp, registry, enum_class_ImageIOStrings);
+    register_pmc(interp, registry, enum_class_ImageIOThaw);
+    register_pmc(interp, registry, enum_class_IMCCompiler);
+    register_pmc(interp, registry, enum_class_MappedByteArray);
+    register_pmc(interp, registry, enum_class_NativePCCMethod);
+    register_pmc(interp, registry, enum_class_Object);
+    register_pmc(interp, registry, enum_class_OS);
+    register_pmc(interp, registry, enum_class_Packfile);
+    register_pmc(interp, registry, enum_class_PackfileAnnotation);
+    register_pmc(interp, registry, enum_class_PackfileOpMap);
+    register_pmc(interp, registry, enum_class_PackfileSegment);
+    register_pmc(interp, registry, enum_class_PackfileAnnotations);
+    register_pmc(interp, registry, enum_class_PackfileConstantTable);
+    register_pmc(interp, registry, enum_class_PackfileDirectory);
+    register_pmc(interp, registry, enum_class_PackfileRawSegment);
+    register_pmc(interp, registry, enum_class_PackfileBytecodeSegment);
+    register_pmc(interp, registry, enum_class_PackfileDebug);
+    register_pmc(interp, registry, enum_class_PackfileView);
+    register_pmc(interp, registry, enum_class_PMCList);
+    register_pmc(interp, registry, enum_class_Proxy);
+    register_pmc(interp, registry, enum_class_Ptr);
+    register_pmc(interp, registry, enum_class_PtrBuf);
+    register_pmc(interp, registry, enum_class_PtrObj);
+    register_pmc(interp, registry, enum_class_Role);
+    register_pmc(interp, registry, enum_class_scalar);
+    register_pmc(interp, registry, enum_class_Float);
+    register_pmc(interp, registry, enum_class_Integer);
+    register_pmc(interp, registry, enum_class_String);
+    register_pmc(interp, registry, enum_class_Boolean);
+    register_pmc(interp, registry, enum_class_Scheduler);
+    register_pmc(interp, registry, enum_class_SchedulerMessage);
+    register_pmc(interp, registry, enum_class_Sockaddr);
+    register_pmc(interp, registry, enum_class_StringBuilder);
+    register_pmc(interp, registry, enum_class_StructView);
+    register_pmc(interp, registry, enum_class_Task);
+    register_pmc(interp, registry, enum_class_Callback);
+    register_pmc(interp, registry, enum_class_Undef);
+}
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ *   buffer-read-only: t
+ * End:
+ * vim: readonly expandtab shiftwidth=4:
+ */
@@ -0,0 +1,25 @@
+# ex: set ro: -*- buffer-read-only:t -*-
+# DO NOT EDIT THIS FILE
+# Generated by Parrot::Configure::Compiler from src/dynoplibs/Defines.in
+
+# Copyright (C) 2010-2012, Parrot Foundation.
+
+DYNOPLIBS_TARGETS = \
+    $(DYNEXT_DIR)/obscure_ops$(LOAD_EXT) \
+    $(DYNEXT_DIR)/math_ops$(LOAD_EXT) \
+    $(DYNEXT_DIR)/trans_ops$(LOAD_EXT) \
+    $(DYNEXT_DIR)/bit_ops$(LOAD_EXT) \
+    $(DYNEXT_DIR)/debug_ops$(LOAD_EXT) \
+    $(DYNEXT_DIR)/sys_ops$(LOAD_EXT) \
+    $(DYNEXT_DIR)/io_ops$(LOAD_EXT)
+
+DYNOPLIBS_CLEANUPS = \
+    $(DYNOPLIBS_TARGETS) \
+    src/dynoplibs/*.c \
+    src/dynoplibs/*.h \
+    src/dynoplibs/*$(O)
+
+# Local variables:
+#   mode: makefile
+# End:
+# vim: ft=make:
@@ -0,0 +1,1966 @@
+/* ex: set ro:
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from 'src/dynoplibs/bit.ops' (and possibly other
+ * .ops files). by ops2c.nqp.
+ *
+ * Any changes made here will be lost!  To regenerate this file after making
+ * changes to any ops, use the bootstrap-ops makefile target.
+ *
+ */
+#define PARROT_IN_EXTENSION
+
+#include "bit_ops.h"
+#include "parrot/pbcversion.h"
+#include "pmc/pmc_parrotlibrary.h"
+#include "pmc/pmc_callcontext.h"
+
+
+/* defines - Ops::Trans::C */
+#define REL_PC     ((size_t)(cur_opcode - (opcode_t *)interp->code->base.data))
+#define CUR_OPCODE cur_opcode
+#define IREG(i) REG_INT(interp, cur_opcode[i])
+#define NREG(i) REG_NUM(interp, cur_opcode[i])
+#define PREG(i) REG_PMC(interp, cur_opcode[i])
+#define SREG(i) REG_STR(interp, cur_opcode[i])
+#define ICONST(i) cur_opcode[i]
+#define NCONST(i) Parrot_pcc_get_num_constants(interp, interp->ctx)[cur_opcode[i]]
+#define SCONST(i) Parrot_pcc_get_str_constants(interp, interp->ctx)[cur_opcode[i]]
+#undef  PCONST
+#define PCONST(i) Parrot_pcc_get_pmc_constants(interp, interp->ctx)[cur_opcode[i]]
+
+static int get_op(PARROT_INTERP, const char * name, int full);
+
+
+/* XXX should be static, but C++ doesn't want to play ball */
+extern op_lib_t bit_op_lib;
+
+
+ /* Signed shift operator that is compatible with PMC shifts.  This is
+  * guaranteed to produce the same result as bitwise_left_shift_internal modulo
+  * word size, ignoring the fact that Parrot integers are always signed.  This
+  * usually gives the same answer regardless whether you shift PMC operands and
+  * then assign to an I-reg, or move the operands to I-regs and do the shift
+  * there -- except when the true result is between 2^{w-1} and 2^w (where w is
+  * the word size), in which case the high order bit is taken as the sign,
+  * giving a truncated result that is 2^w lower.
+  */
+#define bit_shift_left(number, bits) \
+    ((bits) >= 8*INTVAL_SIZE     ? 0                    \
+     : (bits) >= 0               ? (number) << (bits)   \
+     : (bits) > -8*INTVAL_SIZE   ? (number) >> -(bits)   \
+     : 0)
+
+
+
+INTVAL bit_numops = 80;
+
+/*
+** Op Function Table:
+*/
+
+static op_func_t bit_op_func_table[80] = {
+  Parrot_band_p_i,                                   /*      0 */
+  Parrot_band_p_ic,                                  /*      1 */
+  Parrot_band_p_p,                                   /*      2 */
+  Parrot_band_p_p_i,                                 /*      3 */
+  Parrot_band_p_p_ic,                                /*      4 */
+  Parrot_band_p_p_p,                                 /*      5 */
+  Parrot_bands_p_s,                                  /*      6 */
+  Parrot_bands_p_sc,                                 /*      7 */
+  Parrot_bands_p_p,                                  /*      8 */
+  Parrot_bands_s_s_s,                                /*      9 */
+  Parrot_bands_s_sc_s,                               /*     10 */
+  Parrot_bands_s_s_sc,                               /*     11 */
+  Parrot_bands_s_sc_sc,                              /*     12 */
+  Parrot_bands_p_p_s,                                /*     13 */
+  Parrot_bands_p_p_sc,                               /*     14 */
+  Parrot_bands_p_p_p,                                /*     15 */
+  Parrot_bor_p_i,                                    /*     16 */
+  Parrot_bor_p_ic,                                   /*     17 */
+  Parrot_bor_p_p,                                    /*     18 */
+  Parrot_bor_p_p_i,                                  /*     19 */
+  Parrot_bor_p_p_ic,                                 /*     20 */
+  Parrot_bor_p_p_p,                                  /*     21 */
+  Parrot_bors_p_s,                                   /*     22 */
+  Parrot_bors_p_sc,                                  /*     23 */
+  Parrot_bors_p_p,                                   /*     24 */
+  Parrot_bors_s_s_s,                                 /*     25 */
+  Parrot_bors_s_sc_s,                                /*     26 */
+  Parrot_bors_s_s_sc,                                /*     27 */
+  Parrot_bors_s_sc_sc,                               /*     28 */
+  Parrot_bors_p_p_s,                                 /*     29 */
+  Parrot_bors_p_p_sc,                                /*     30 */
+  Parrot_bors_p_p_p,                                 /*     31 */
+  Parrot_shl_p_i,                                    /*     32 */
+  Parrot_shl_p_ic,                                   /*     33 */
+  Parrot_shl_p_p,                                    /*     34 */
+  Parrot_shl_p_p_i,                                  /*     35 */
+  Parrot_shl_p_p_ic,                                 /*     36 */
+  Parrot_shl_p_p_p,                                  /*     37 */
+  Parrot_shr_p_i,                                    /*     38 */
+  Parrot_shr_p_ic,                                   /*     39 */
+  Parrot_shr_p_p,                                    /*     40 */
+  Parrot_shr_p_p_i,                                  /*     41 */
+  Parrot_shr_p_p_ic,                                 /*     42 */
+  Parrot_shr_p_p_p,                                  /*     43 */
+  Parrot_bnot_i,                                     /*     44 */
+  Parrot_bnot_i_i,                                   /*     45 */
+  Parrot_bnot_i_ic,                                  /*     46 */
+  Parrot_bnot_p,                                     /*     47 */
+  Parrot_bnot_p_p,                                   /*     48 */
+  Parrot_bnots_s_s,                                  /*     49 */
+  Parrot_bnots_s_sc,                                 /*     50 */
+  Parrot_bnots_p,                                    /*     51 */
+  Parrot_bnots_p_p,                                  /*     52 */
+  Parrot_lsr_p_i,                                    /*     53 */
+  Parrot_lsr_p_ic,                                   /*     54 */
+  Parrot_lsr_p_p,                                    /*     55 */
+  Parrot_lsr_p_p_i,                                  /*     56 */
+  Parrot_lsr_p_p_ic,                                 /*     57 */
+  Parrot_lsr_p_p_p,                                  /*     58 */
+  Parrot_rot_i_i_i_ic,                               /*     59 */
+  Parrot_rot_i_ic_i_ic,                              /*     60 */
+  Parrot_rot_i_i_ic_ic,                              /*     61 */
+  Parrot_rot_i_ic_ic_ic,                             /*     62 */
+  Parrot_bxor_p_i,                                   /*     63 */
+  Parrot_bxor_p_ic,                                  /*     64 */
+  Parrot_bxor_p_p,                                   /*     65 */
+  Parrot_bxor_p_p_i,                                 /*     66 */
+  Parrot_bxor_p_p_ic,                                /*     67 */
+  Parrot_bxor_p_p_p,                                 /*     68 */
+  Parrot_bxors_p_s,                                  /*     69 */
+  Parrot_bxors_p_sc,                                 /*     70 */
+  Parrot_bxors_p_p,                                  /*     71 */
+  Parrot_bxors_s_s_s,                                /*     72 */
+  Parrot_bxors_s_sc_s,                               /*     73 */
+  Parrot_bxors_s_s_sc,                               /*     74 */
+  Parrot_bxors_s_sc_sc,                              /*     75 */
+  Parrot_bxors_p_p_s,                                /*     76 */
+  Parrot_bxors_p_p_sc,                               /*     77 */
+  Parrot_bxors_p_p_p,                                /*     78 */
+
+  NULL /* NULL function pointer */
+};
+
+
+
+/*
+** Op Info Table:
+*/
+
+static op_info_t bit_op_info_table[80] = {
+  { /* 0 */
+    "band",
+    "band_p_i",
+    "Parrot_band_p_i",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_I },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &bit_op_lib
+  },
+  { /* 1 */
+    "band",
+    "band_p_ic",
+    "Parrot_band_p_ic",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &bit_op_lib
+  },
+  { /* 2 */
+    "band",
+    "band_p_p",
+    "Parrot_band_p_p",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_P },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &bit_op_lib
+  },
+  { /* 3 */
+    "band",
+    "band_p_p_i",
+    "Parrot_band_p_p_i",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_I },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &bit_op_lib
+  },
+  { /* 4 */
+    "band",
+    "band_p_p_ic",
+    "Parrot_band_p_p_ic",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &bit_op_lib
+  },
+  { /* 5 */
+    "band",
+    "band_p_p_p",
+    "Parrot_band_p_p_p",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_P },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &bit_op_lib
+  },
+  { /* 6 */
+    "bands",
+    "bands_p_s",
+    "Parrot_bands_p_s",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_S },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &bit_op_lib
+  },
+  { /* 7 */
+    "bands",
+    "bands_p_sc",
+    "Parrot_bands_p_sc",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_SC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &bit_op_lib
+  },
+  { /* 8 */
+    "bands",
+    "bands_p_p",
+    "Parrot_bands_p_p",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_P },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &bit_op_lib
+  },
+  { /* 9 */
+    "bands",
+    "bands_s_s_s",
+    "Parrot_bands_s_s_s",
+    0,
+    4,
+    { PARROT_ARG_S, PARROT_ARG_S, PARROT_ARG_S },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &bit_op_lib
+  },
+  { /* 10 */
+    "bands",
+    "bands_s_sc_s",
+    "Parrot_bands_s_sc_s",
+    0,
+    4,
+    { PARROT_ARG_S, PARROT_ARG_SC, PARROT_ARG_S },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &bit_op_lib
+  },
+  { /* 11 */
+    "bands",
+    "bands_s_s_sc",
+    "Parrot_bands_s_s_sc",
+    0,
+    4,
+    { PARROT_ARG_S, PARROT_ARG_S, PARROT_ARG_SC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &bit_op_lib
+  },
+  { /* 12 */
+    "bands",
+    "bands_s_sc_sc",
+    "Parrot_bands_s_sc_sc",
+    0,
+    4,
+    { PARROT_ARG_S, PARROT_ARG_SC, PARROT_ARG_SC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &bit_op_lib
+  },
+  { /* 13 */
+    "bands",
+    "bands_p_p_s",
+    "Parrot_bands_p_p_s",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_S },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &bit_op_lib
+  },
+  { /* 14 */
+    "bands",
+    "bands_p_p_sc",
+    "Parrot_bands_p_p_sc",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_SC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &bit_op_lib
+  },
+  { /* 15 */
+    "bands",
+    "bands_p_p_p",
+    "Parrot_bands_p_p_p",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_P },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &bit_op_lib
+  },
+  { /* 16 */
+    "bor",
+    "bor_p_i",
+    "Parrot_bor_p_i",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_I },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &bit_op_lib
+  },
+  { /* 17 */
+    "bor",
+    "bor_p_ic",
+    "Parrot_bor_p_ic",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &bit_op_lib
+  },
+  { /* 18 */
+    "bor",
+    "bor_p_p",
+    "Parrot_bor_p_p",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_P },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &bit_op_lib
+  },
+  { /* 19 */
+    "bor",
+    "bor_p_p_i",
+    "Parrot_bor_p_p_i",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_I },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &bit_op_lib
+  },
+  { /* 20 */
+    "bor",
+    "bor_p_p_ic",
+    "Parrot_bor_p_p_ic",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &bit_op_lib
+  },
+  { /* 21 */
+    "bor",
+    "bor_p_p_p",
+    "Parrot_bor_p_p_p",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_P },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &bit_op_lib
+  },
+  { /* 22 */
+    "bors",
+    "bors_p_s",
+    "Parrot_bors_p_s",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_S },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &bit_op_lib
+  },
+  { /* 23 */
+    "bors",
+    "bors_p_sc",
+    "Parrot_bors_p_sc",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_SC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &bit_op_lib
+  },
+  { /* 24 */
+    "bors",
+    "bors_p_p",
+    "Parrot_bors_p_p",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_P },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &bit_op_lib
+  },
+  { /* 25 */
+    "bors",
+    "bors_s_s_s",
+    "Parrot_bors_s_s_s",
+    0,
+    4,
+    { PARROT_ARG_S, PARROT_ARG_S, PARROT_ARG_S },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &bit_op_lib
+  },
+  { /* 26 */
+    "bors",
+    "bors_s_sc_s",
+    "Parrot_bors_s_sc_s",
+    0,
+    4,
+    { PARROT_ARG_S, PARROT_ARG_SC, PARROT_ARG_S },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &bit_op_lib
+  },
+  { /* 27 */
+    "bors",
+    "bors_s_s_sc",
+    "Parrot_bors_s_s_sc",
+    0,
+    4,
+    { PARROT_ARG_S, PARROT_ARG_S, PARROT_ARG_SC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &bit_op_lib
+  },
+  { /* 28 */
+    "bors",
+    "bors_s_sc_sc",
+    "Parrot_bors_s_sc_sc",
+    0,
+    4,
+    { PARROT_ARG_S, PARROT_ARG_SC, PARROT_ARG_SC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &bit_op_lib
+  },
+  { /* 29 */
+    "bors",
+    "bors_p_p_s",
+    "Parrot_bors_p_p_s",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_S },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &bit_op_lib
+  },
+  { /* 30 */
+    "bors",
+    "bors_p_p_sc",
+    "Parrot_bors_p_p_sc",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_SC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &bit_op_lib
+  },
+  { /* 31 */
+    "bors",
+    "bors_p_p_p",
+    "Parrot_bors_p_p_p",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_P },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &bit_op_lib
+  },
+  { /* 32 */
+    "shl",
+    "shl_p_i",
+    "Parrot_shl_p_i",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_I },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &bit_op_lib
+  },
+  { /* 33 */
+    "shl",
+    "shl_p_ic",
+    "Parrot_shl_p_ic",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &bit_op_lib
+  },
+  { /* 34 */
+    "shl",
+    "shl_p_p",
+    "Parrot_shl_p_p",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_P },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &bit_op_lib
+  },
+  { /* 35 */
+    "shl",
+    "shl_p_p_i",
+    "Parrot_shl_p_p_i",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_I },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &bit_op_lib
+  },
+  { /* 36 */
+    "shl",
+    "shl_p_p_ic",
+    "Parrot_shl_p_p_ic",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &bit_op_lib
+  },
+  { /* 37 */
+    "shl",
+    "shl_p_p_p",
+    "Parrot_shl_p_p_p",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_P },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &bit_op_lib
+  },
+  { /* 38 */
+    "shr",
+    "shr_p_i",
+    "Parrot_shr_p_i",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_I },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &bit_op_lib
+  },
+  { /* 39 */
+    "shr",
+    "shr_p_ic",
+    "Parrot_shr_p_ic",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &bit_op_lib
+  },
+  { /* 40 */
+    "shr",
+    "shr_p_p",
+    "Parrot_shr_p_p",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_P },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &bit_op_lib
+  },
+  { /* 41 */
+    "shr",
+    "shr_p_p_i",
+    "Parrot_shr_p_p_i",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_I },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &bit_op_lib
+  },
+  { /* 42 */
+    "shr",
+    "shr_p_p_ic",
+    "Parrot_shr_p_p_ic",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &bit_op_lib
+  },
+  { /* 43 */
+    "shr",
+    "shr_p_p_p",
+    "Parrot_shr_p_p_p",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_P },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &bit_op_lib
+  },
+  { /* 44 */
+    "bnot",
+    "bnot_i",
+    "Parrot_bnot_i",
+    0,
+    2,
+    { PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT },
+    { 0 },
+    &bit_op_lib
+  },
+  { /* 45 */
+    "bnot",
+    "bnot_i_i",
+    "Parrot_bnot_i_i",
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &bit_op_lib
+  },
+  { /* 46 */
+    "bnot",
+    "bnot_i_ic",
+    "Parrot_bnot_i_ic",
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &bit_op_lib
+  },
+  { /* 47 */
+    "bnot",
+    "bnot_p",
+    "Parrot_bnot_p",
+    0,
+    2,
+    { PARROT_ARG_P },
+    { PARROT_ARGDIR_IN },
+    { 0 },
+    &bit_op_lib
+  },
+  { /* 48 */
+    "bnot",
+    "bnot_p_p",
+    "Parrot_bnot_p_p",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_P },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &bit_op_lib
+  },
+  { /* 49 */
+    "bnots",
+    "bnots_s_s",
+    "Parrot_bnots_s_s",
+    0,
+    3,
+    { PARROT_ARG_S, PARROT_ARG_S },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &bit_op_lib
+  },
+  { /* 50 */
+    "bnots",
+    "bnots_s_sc",
+    "Parrot_bnots_s_sc",
+    0,
+    3,
+    { PARROT_ARG_S, PARROT_ARG_SC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &bit_op_lib
+  },
+  { /* 51 */
+    "bnots",
+    "bnots_p",
+    "Parrot_bnots_p",
+    0,
+    2,
+    { PARROT_ARG_P },
+    { PARROT_ARGDIR_IN },
+    { 0 },
+    &bit_op_lib
+  },
+  { /* 52 */
+    "bnots",
+    "bnots_p_p",
+    "Parrot_bnots_p_p",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_P },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &bit_op_lib
+  },
+  { /* 53 */
+    "lsr",
+    "lsr_p_i",
+    "Parrot_lsr_p_i",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_I },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &bit_op_lib
+  },
+  { /* 54 */
+    "lsr",
+    "lsr_p_ic",
+    "Parrot_lsr_p_ic",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &bit_op_lib
+  },
+  { /* 55 */
+    "lsr",
+    "lsr_p_p",
+    "Parrot_lsr_p_p",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_P },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &bit_op_lib
+  },
+  { /* 56 */
+    "lsr",
+    "lsr_p_p_i",
+    "Parrot_lsr_p_p_i",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_I },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &bit_op_lib
+  },
+  { /* 57 */
+    "lsr",
+    "lsr_p_p_ic",
+    "Parrot_lsr_p_p_ic",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &bit_op_lib
+  },
+  { /* 58 */
+    "lsr",
+    "lsr_p_p_p",
+    "Parrot_lsr_p_p_p",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_P },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &bit_op_lib
+  },
+  { /* 59 */
+    "rot",
+    "rot_i_i_i_ic",
+    "Parrot_rot_i_i_i_ic",
+    0,
+    5,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0 },
+    &bit_op_lib
+  },
+  { /* 60 */
+    "rot",
+    "rot_i_ic_i_ic",
+    "Parrot_rot_i_ic_i_ic",
+    0,
+    5,
+    { PARROT_ARG_I, PARROT_ARG_IC, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0 },
+    &bit_op_lib
+  },
+  { /* 61 */
+    "rot",
+    "rot_i_i_ic_ic",
+    "Parrot_rot_i_i_ic_ic",
+    0,
+    5,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0 },
+    &bit_op_lib
+  },
+  { /* 62 */
+    "rot",
+    "rot_i_ic_ic_ic",
+    "Parrot_rot_i_ic_ic_ic",
+    0,
+    5,
+    { PARROT_ARG_I, PARROT_ARG_IC, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0 },
+    &bit_op_lib
+  },
+  { /* 63 */
+    "bxor",
+    "bxor_p_i",
+    "Parrot_bxor_p_i",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_I },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &bit_op_lib
+  },
+  { /* 64 */
+    "bxor",
+    "bxor_p_ic",
+    "Parrot_bxor_p_ic",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &bit_op_lib
+  },
+  { /* 65 */
+    "bxor",
+    "bxor_p_p",
+    "Parrot_bxor_p_p",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_P },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &bit_op_lib
+  },
+  { /* 66 */
+    "bxor",
+    "bxor_p_p_i",
+    "Parrot_bxor_p_p_i",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_I },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &bit_op_lib
+  },
+  { /* 67 */
+    "bxor",
+    "bxor_p_p_ic",
+    "Parrot_bxor_p_p_ic",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &bit_op_lib
+  },
+  { /* 68 */
+    "bxor",
+    "bxor_p_p_p",
+    "Parrot_bxor_p_p_p",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_P },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &bit_op_lib
+  },
+  { /* 69 */
+    "bxors",
+    "bxors_p_s",
+    "Parrot_bxors_p_s",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_S },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &bit_op_lib
+  },
+  { /* 70 */
+    "bxors",
+    "bxors_p_sc",
+    "Parrot_bxors_p_sc",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_SC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &bit_op_lib
+  },
+  { /* 71 */
+    "bxors",
+    "bxors_p_p",
+    "Parrot_bxors_p_p",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_P },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &bit_op_lib
+  },
+  { /* 72 */
+    "bxors",
+    "bxors_s_s_s",
+    "Parrot_bxors_s_s_s",
+    0,
+    4,
+    { PARROT_ARG_S, PARROT_ARG_S, PARROT_ARG_S },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &bit_op_lib
+  },
+  { /* 73 */
+    "bxors",
+    "bxors_s_sc_s",
+    "Parrot_bxors_s_sc_s",
+    0,
+    4,
+    { PARROT_ARG_S, PARROT_ARG_SC, PARROT_ARG_S },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &bit_op_lib
+  },
+  { /* 74 */
+    "bxors",
+    "bxors_s_s_sc",
+    "Parrot_bxors_s_s_sc",
+    0,
+    4,
+    { PARROT_ARG_S, PARROT_ARG_S, PARROT_ARG_SC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &bit_op_lib
+  },
+  { /* 75 */
+    "bxors",
+    "bxors_s_sc_sc",
+    "Parrot_bxors_s_sc_sc",
+    0,
+    4,
+    { PARROT_ARG_S, PARROT_ARG_SC, PARROT_ARG_SC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &bit_op_lib
+  },
+  { /* 76 */
+    "bxors",
+    "bxors_p_p_s",
+    "Parrot_bxors_p_p_s",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_S },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &bit_op_lib
+  },
+  { /* 77 */
+    "bxors",
+    "bxors_p_p_sc",
+    "Parrot_bxors_p_p_sc",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_SC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &bit_op_lib
+  },
+  { /* 78 */
+    "bxors",
+    "bxors_p_p_p",
+    "Parrot_bxors_p_p_p",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_P },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &bit_op_lib
+  },
+
+};
+
+
+/*
+** Op Function Definitions:
+*/
+
+opcode_t *
+Parrot_band_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    const INTVAL   a = VTABLE_get_integer(interp, PREG(1));
+    const INTVAL   b = (a & IREG(2));
+
+    VTABLE_set_integer_native(interp, PREG(1), b);
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_band_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    const INTVAL   a = VTABLE_get_integer(interp, PREG(1));
+    const INTVAL   b = (a & ICONST(2));
+
+    VTABLE_set_integer_native(interp, PREG(1), b);
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_band_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    const INTVAL   a = VTABLE_get_integer(interp, PREG(1));
+    const INTVAL   b = VTABLE_get_integer(interp, PREG(2));
+
+    VTABLE_set_integer_native(interp, PREG(1), (a & b));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_band_p_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    const INTVAL   a = VTABLE_get_integer(interp, PREG(2));
+
+    VTABLE_set_integer_native(interp, PREG(1), (a & IREG(3)));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_band_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    const INTVAL   a = VTABLE_get_integer(interp, PREG(2));
+
+    VTABLE_set_integer_native(interp, PREG(1), (a & ICONST(3)));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_band_p_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    const INTVAL   a = VTABLE_get_integer(interp, PREG(2));
+    const INTVAL   b = VTABLE_get_integer(interp, PREG(3));
+
+    VTABLE_set_integer_native(interp, PREG(1), (a & b));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_bands_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  a = VTABLE_get_string(interp, PREG(1));
+    STRING  * const  b = Parrot_str_bitwise_and(interp, a, SREG(2));
+
+    VTABLE_set_string_native(interp, PREG(1), b);
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_bands_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  a = VTABLE_get_string(interp, PREG(1));
+    STRING  * const  b = Parrot_str_bitwise_and(interp, a, SCONST(2));
+
+    VTABLE_set_string_native(interp, PREG(1), b);
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_bands_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  *  a = VTABLE_get_string(interp, PREG(1));
+    STRING  * const  b = VTABLE_get_string(interp, PREG(2));
+
+    a = Parrot_str_bitwise_and(interp, a, b);
+    VTABLE_set_string_native(interp, PREG(1), a);
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_bands_s_s_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_bitwise_and(interp, SREG(2), SREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_bands_s_sc_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_bitwise_and(interp, SCONST(2), SREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_bands_s_s_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_bitwise_and(interp, SREG(2), SCONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_bands_s_sc_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_bitwise_and(interp, SCONST(2), SCONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_bands_p_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  a = VTABLE_get_string(interp, PREG(2));
+    STRING  * const  b = Parrot_str_bitwise_and(interp, a, SREG(3));
+
+    VTABLE_set_string_native(interp, PREG(1), b);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_bands_p_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  a = VTABLE_get_string(interp, PREG(2));
+    STRING  * const  b = Parrot_str_bitwise_and(interp, a, SCONST(3));
+
+    VTABLE_set_string_native(interp, PREG(1), b);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_bands_p_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  a = VTABLE_get_string(interp, PREG(2));
+    STRING  * const  b = VTABLE_get_string(interp, PREG(3));
+    STRING  * const  c = Parrot_str_bitwise_and(interp, a, b);
+
+    VTABLE_set_string_native(interp, PREG(1), c);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_bor_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    const INTVAL   a = VTABLE_get_integer(interp, PREG(1));
+
+    VTABLE_set_integer_native(interp, PREG(1), (a | IREG(2)));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_bor_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    const INTVAL   a = VTABLE_get_integer(interp, PREG(1));
+
+    VTABLE_set_integer_native(interp, PREG(1), (a | ICONST(2)));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_bor_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    const INTVAL   a = VTABLE_get_integer(interp, PREG(1));
+    const INTVAL   b = VTABLE_get_integer(interp, PREG(2));
+
+    VTABLE_set_integer_native(interp, PREG(1), (a | b));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_bor_p_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    const INTVAL   a = VTABLE_get_integer(interp, PREG(2));
+
+    VTABLE_set_integer_native(interp, PREG(1), (a | IREG(3)));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_bor_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    const INTVAL   a = VTABLE_get_integer(interp, PREG(2));
+
+    VTABLE_set_integer_native(interp, PREG(1), (a | ICONST(3)));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_bor_p_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    const INTVAL   a = VTABLE_get_integer(interp, PREG(2));
+    const INTVAL   b = VTABLE_get_integer(interp, PREG(3));
+
+    VTABLE_set_integer_native(interp, PREG(1), (a | b));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_bors_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  a = VTABLE_get_string(interp, PREG(1));
+    STRING  * const  b = Parrot_str_bitwise_or(interp, a, SREG(2));
+
+    VTABLE_set_string_native(interp, PREG(1), b);
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_bors_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  a = VTABLE_get_string(interp, PREG(1));
+    STRING  * const  b = Parrot_str_bitwise_or(interp, a, SCONST(2));
+
+    VTABLE_set_string_native(interp, PREG(1), b);
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_bors_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  a = VTABLE_get_string(interp, PREG(1));
+    STRING  * const  b = VTABLE_get_string(interp, PREG(2));
+    STRING  * const  c = Parrot_str_bitwise_or(interp, a, b);
+
+    VTABLE_set_string_native(interp, PREG(1), c);
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_bors_s_s_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_bitwise_or(interp, SREG(2), SREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_bors_s_sc_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_bitwise_or(interp, SCONST(2), SREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_bors_s_s_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_bitwise_or(interp, SREG(2), SCONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_bors_s_sc_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_bitwise_or(interp, SCONST(2), SCONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_bors_p_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  b = VTABLE_get_string(interp, PREG(2));
+    STRING  * const  c = Parrot_str_bitwise_or(interp, b, SREG(3));
+
+    VTABLE_set_string_native(interp, PREG(1), c);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_bors_p_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  b = VTABLE_get_string(interp, PREG(2));
+    STRING  * const  c = Parrot_str_bitwise_or(interp, b, SCONST(3));
+
+    VTABLE_set_string_native(interp, PREG(1), c);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_bors_p_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  a = VTABLE_get_string(interp, PREG(2));
+    STRING  * const  b = VTABLE_get_string(interp, PREG(3));
+    STRING  * const  c = Parrot_str_bitwise_or(interp, a, b);
+
+    VTABLE_set_string_native(interp, PREG(1), c);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_shl_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    const INTVAL   a = VTABLE_get_integer(interp, PREG(1));
+    const INTVAL   b = bit_shift_left(a, IREG(2));
+
+    VTABLE_set_integer_native(interp, PREG(1), b);
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_shl_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    const INTVAL   a = VTABLE_get_integer(interp, PREG(1));
+    const INTVAL   b = bit_shift_left(a, ICONST(2));
+
+    VTABLE_set_integer_native(interp, PREG(1), b);
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_shl_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    const INTVAL   a = VTABLE_get_integer(interp, PREG(1));
+    const INTVAL   b = VTABLE_get_integer(interp, PREG(2));
+    const INTVAL   c = bit_shift_left(a, b);
+
+    VTABLE_set_integer_native(interp, PREG(1), c);
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_shl_p_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    const INTVAL   a = VTABLE_get_integer(interp, PREG(2));
+    const INTVAL   b = bit_shift_left(a, IREG(3));
+
+    VTABLE_set_integer_native(interp, PREG(1), b);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_shl_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    const INTVAL   a = VTABLE_get_integer(interp, PREG(2));
+    const INTVAL   b = bit_shift_left(a, ICONST(3));
+
+    VTABLE_set_integer_native(interp, PREG(1), b);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_shl_p_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    const INTVAL   a = VTABLE_get_integer(interp, PREG(2));
+    const INTVAL   b = VTABLE_get_integer(interp, PREG(3));
+    const INTVAL   c = bit_shift_left(a, b);
+
+    VTABLE_set_integer_native(interp, PREG(1), c);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_shr_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    const INTVAL   a = VTABLE_get_integer(interp, PREG(1));
+    const INTVAL   b = bit_shift_left(a, (-IREG(2)));
+
+    VTABLE_set_integer_native(interp, PREG(1), b);
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_shr_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    const INTVAL   a = VTABLE_get_integer(interp, PREG(1));
+    const INTVAL   b = bit_shift_left(a, (-ICONST(2)));
+
+    VTABLE_set_integer_native(interp, PREG(1), b);
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_shr_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    const INTVAL   a = VTABLE_get_integer(interp, PREG(1));
+    const INTVAL   b = VTABLE_get_integer(interp, PREG(2));
+    const INTVAL   c = bit_shift_left(a, (-b));
+
+    VTABLE_set_integer_native(interp, PREG(1), c);
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_shr_p_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    const INTVAL   a = VTABLE_get_integer(interp, PREG(2));
+    const INTVAL   c = bit_shift_left(a, (-IREG(3)));
+
+    VTABLE_set_integer_native(interp, PREG(1), c);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_shr_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    const INTVAL   a = VTABLE_get_integer(interp, PREG(2));
+    const INTVAL   c = bit_shift_left(a, (-ICONST(3)));
+
+    VTABLE_set_integer_native(interp, PREG(1), c);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_shr_p_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    const INTVAL   a = VTABLE_get_integer(interp, PREG(2));
+    const INTVAL   b = VTABLE_get_integer(interp, PREG(3));
+    const INTVAL   c = bit_shift_left(a, (-b));
+
+    VTABLE_set_integer_native(interp, PREG(1), c);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_bnot_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = (~IREG(1));
+    return cur_opcode + 2;
+}
+
+opcode_t *
+Parrot_bnot_i_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = (~IREG(2));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_bnot_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = (~ICONST(2));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_bnot_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    const INTVAL   a = VTABLE_get_integer(interp, PREG(1));
+
+    VTABLE_set_integer_native(interp, PREG(1), (~a));
+    return cur_opcode + 2;
+}
+
+opcode_t *
+Parrot_bnot_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    const INTVAL   a = VTABLE_get_integer(interp, PREG(2));
+    PMC  * const  b = Parrot_pmc_new(interp, VTABLE_type(interp, PREG(2)));
+
+    VTABLE_set_integer_native(interp, b, (~a));
+    PREG(1) = b;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_bnots_s_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_bitwise_not(interp, SREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_bnots_s_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_bitwise_not(interp, SCONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_bnots_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  a = VTABLE_get_string(interp, PREG(1));
+    STRING  * const  b = Parrot_str_bitwise_not(interp, a);
+
+    VTABLE_set_string_native(interp, PREG(1), b);
+    return cur_opcode + 2;
+}
+
+opcode_t *
+Parrot_bnots_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  a = VTABLE_get_string(interp, PREG(2));
+    STRING  * const  b = Parrot_str_bitwise_not(interp, a);
+
+    VTABLE_set_string_native(interp, PREG(1), b);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_lsr_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    const UINTVAL   a = (UINTVAL)VTABLE_get_integer(interp, PREG(1));
+    const UINTVAL   b = (a >> IREG(2));
+
+    VTABLE_set_integer_native(interp, PREG(1), (INTVAL)b);
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_lsr_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    const UINTVAL   a = (UINTVAL)VTABLE_get_integer(interp, PREG(1));
+    const UINTVAL   b = (a >> ICONST(2));
+
+    VTABLE_set_integer_native(interp, PREG(1), (INTVAL)b);
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_lsr_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    const UINTVAL   a = (UINTVAL)VTABLE_get_integer(interp, PREG(1));
+    const UINTVAL   b = (UINTVAL)VTABLE_get_integer(interp, PREG(2));
+    const UINTVAL   c = (a >> b);
+
+    VTABLE_set_integer_native(interp, PREG(1), (INTVAL)c);
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_lsr_p_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    const UINTVAL   a = (UINTVAL)VTABLE_get_integer(interp, PREG(2));
+    const UINTVAL   b = (UINTVAL)IREG(3);
+    const UINTVAL   c = (a >> b);
+
+    VTABLE_set_integer_native(interp, PREG(1), (INTVAL)c);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_lsr_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    const UINTVAL   a = (UINTVAL)VTABLE_get_integer(interp, PREG(2));
+    const UINTVAL   b = (UINTVAL)ICONST(3);
+    const UINTVAL   c = (a >> b);
+
+    VTABLE_set_integer_native(interp, PREG(1), (INTVAL)c);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_lsr_p_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    const UINTVAL   a = (UINTVAL)VTABLE_get_integer(interp, PREG(2));
+    const UINTVAL   b = (UINTVAL)VTABLE_get_integer(interp, PREG(3));
+    const UINTVAL   c = (a >> b);
+
+    VTABLE_set_integer_native(interp, PREG(1), (INTVAL)c);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_rot_i_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    const UINTVAL   r = (UINTVAL)IREG(2);
+    INTVAL   s = IREG(3);
+    const UINTVAL   w = (UINTVAL)ICONST(4);
+    UINTVAL   d;
+    UINTVAL   t;
+    UINTVAL   i;
+    UINTVAL   m;
+
+    for (i = 0, m = 0; (i < w); (i++)) {
+        (m |= ((1u << i)));
+    }
+
+    if ((s < 0)) {
+        (s += w);
+    }
+
+    d = (((r << s)) & m);
+    t = (w - (UINTVAL)s);
+    t = (((r >> t)) & m);
+    (d |= t);
+    IREG(1) = d;
+    return cur_opcode + 5;
+}
+
+opcode_t *
+Parrot_rot_i_ic_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    const UINTVAL   r = (UINTVAL)ICONST(2);
+    INTVAL   s = IREG(3);
+    const UINTVAL   w = (UINTVAL)ICONST(4);
+    UINTVAL   d;
+    UINTVAL   t;
+    UINTVAL   i;
+    UINTVAL   m;
+
+    for (i = 0, m = 0; (i < w); (i++)) {
+        (m |= ((1u << i)));
+    }
+
+    if ((s < 0)) {
+        (s += w);
+    }
+
+    d = (((r << s)) & m);
+    t = (w - (UINTVAL)s);
+    t = (((r >> t)) & m);
+    (d |= t);
+    IREG(1) = d;
+    return cur_opcode + 5;
+}
+
+opcode_t *
+Parrot_rot_i_i_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    const UINTVAL   r = (UINTVAL)IREG(2);
+    INTVAL   s = ICONST(3);
+    const UINTVAL   w = (UINTVAL)ICONST(4);
+    UINTVAL   d;
+    UINTVAL   t;
+    UINTVAL   i;
+    UINTVAL   m;
+
+    for (i = 0, m = 0; (i < w); (i++)) {
+        (m |= ((1u << i)));
+    }
+
+    if ((s < 0)) {
+        (s += w);
+    }
+
+    d = (((r << s)) & m);
+    t = (w - (UINTVAL)s);
+    t = (((r >> t)) & m);
+    (d |= t);
+    IREG(1) = d;
+    return cur_opcode + 5;
+}
+
+opcode_t *
+Parrot_rot_i_ic_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    const UINTVAL   r = (UINTVAL)ICONST(2);
+    INTVAL   s = ICONST(3);
+    const UINTVAL   w = (UINTVAL)ICONST(4);
+    UINTVAL   d;
+    UINTVAL   t;
+    UINTVAL   i;
+    UINTVAL   m;
+
+    for (i = 0, m = 0; (i < w); (i++)) {
+        (m |= ((1u << i)));
+    }
+
+    if ((s < 0)) {
+        (s += w);
+    }
+
+    d = (((r << s)) & m);
+    t = (w - (UINTVAL)s);
+    t = (((r >> t)) & m);
+    (d |= t);
+    IREG(1) = d;
+    return cur_opcode + 5;
+}
+
+opcode_t *
+Parrot_bxor_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    const UINTVAL   a = (UINTVAL)VTABLE_get_integer(interp, PREG(1));
+    const UINTVAL   b = (a ^ IREG(2));
+
+    VTABLE_set_integer_native(interp, PREG(1), (INTVAL)b);
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_bxor_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    const UINTVAL   a = (UINTVAL)VTABLE_get_integer(interp, PREG(1));
+    const UINTVAL   b = (a ^ ICONST(2));
+
+    VTABLE_set_integer_native(interp, PREG(1), (INTVAL)b);
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_bxor_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    const UINTVAL   a = (UINTVAL)VTABLE_get_integer(interp, PREG(1));
+    const UINTVAL   b = (UINTVAL)VTABLE_get_integer(interp, PREG(2));
+    const UINTVAL   c = (a ^ b);
+
+    VTABLE_set_integer_native(interp, PREG(1), (INTVAL)c);
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_bxor_p_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    const UINTVAL   a = (UINTVAL)VTABLE_get_integer(interp, PREG(2));
+    const UINTVAL   b = (a ^ IREG(3));
+
+    VTABLE_set_integer_native(interp, PREG(1), (INTVAL)b);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_bxor_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    const UINTVAL   a = (UINTVAL)VTABLE_get_integer(interp, PREG(2));
+    const UINTVAL   b = (a ^ ICONST(3));
+
+    VTABLE_set_integer_native(interp, PREG(1), (INTVAL)b);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_bxor_p_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    const UINTVAL   a = (UINTVAL)VTABLE_get_integer(interp, PREG(2));
+    const UINTVAL   b = (UINTVAL)VTABLE_get_integer(interp, PREG(3));
+    const UINTVAL   c = (a ^ b);
+
+    VTABLE_set_integer_native(interp, PREG(1), (INTVAL)c);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_bxors_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  a = VTABLE_get_string(interp, PREG(1));
+    STRING  * const  b = Parrot_str_bitwise_xor(interp, a, SREG(2));
+
+    VTABLE_set_string_native(interp, PREG(1), b);
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_bxors_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  a = VTABLE_get_string(interp, PREG(1));
+    STRING  * const  b = Parrot_str_bitwise_xor(interp, a, SCONST(2));
+
+    VTABLE_set_string_native(interp, PREG(1), b);
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_bxors_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  a = VTABLE_get_string(interp, PREG(1));
+    STRING  * const  b = VTABLE_get_string(interp, PREG(2));
+    STRING  * const  c = Parrot_str_bitwise_xor(interp, a, b);
+
+    VTABLE_set_string_native(interp, PREG(1), c);
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_bxors_s_s_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_bitwise_xor(interp, SREG(2), SREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_bxors_s_sc_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_bitwise_xor(interp, SCONST(2), SREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_bxors_s_s_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_bitwise_xor(interp, SREG(2), SCONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_bxors_s_sc_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_bitwise_xor(interp, SCONST(2), SCONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_bxors_p_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  a = VTABLE_get_string(interp, PREG(2));
+    STRING  * const  b = Parrot_str_bitwise_xor(interp, a, SREG(3));
+
+    VTABLE_set_string_native(interp, PREG(1), b);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_bxors_p_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  a = VTABLE_get_string(interp, PREG(2));
+    STRING  * const  b = Parrot_str_bitwise_xor(interp, a, SCONST(3));
+
+    VTABLE_set_string_native(interp, PREG(1), b);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_bxors_p_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  a = VTABLE_get_string(interp, PREG(2));
+    STRING  * const  b = VTABLE_get_string(interp, PREG(3));
+    STRING  * const  c = Parrot_str_bitwise_xor(interp, a, b);
+
+    VTABLE_set_string_native(interp, PREG(1), c);
+    return cur_opcode + 4;
+}
+
+
+/*
+** op lib descriptor:
+*/
+
+/* XXX should be static, but C++ doesn't want to play ball */
+op_lib_t bit_op_lib = {
+  "bit_ops",                /* name */
+  "",                  /* suffix */
+  PARROT_FUNCTION_CORE,                       /* core_type = PARROT_XX_CORE */
+  0,                                /* flags */
+  PARROT_PBC_MAJOR,
+  PARROT_PBC_MINOR,
+  79,             /* op_count */
+  bit_op_info_table,       /* op_info_table */
+  bit_op_func_table,       /* op_func_table */
+  get_op          /* op_code() */ 
+};
+
+/*
+** Op lookup function:
+*/
+
+#define OP_HASH_SIZE 3041
+
+/* we could calculate a prime somewhat bigger than
+ * n of fullnames + n of names
+ * for now this should be ok
+ *
+ * look up an op_code: at first call to op_code() a hash
+ * of short and full opcode names is created
+ * hash functions are from imcc, thanks to Melvin.
+ */
+
+
+typedef struct hop {
+    op_info_t * info;
+    struct hop *next;
+} HOP;
+
+static HOP *hop_buckets;
+static HOP **hop;
+
+static void hop_init(PARROT_INTERP);
+static size_t hash_str(ARGIN(const char *str));
+static void store_op(ARGIN(op_info_t *info), ARGMOD(HOP *p), ARGIN(const char *name));
+
+/* XXX on changing interpreters, this should be called,
+   through a hook */
+
+static void hop_deinit(PARROT_INTERP);
+
+/*
+ * find a short or full opcode
+ * usage:
+ *
+ * interp->op_lib->op_code("set", 0)
+ * interp->op_lib->op_code("set_i_i", 1)
+ *
+ * returns >= 0 (found idx into info_table), -1 if not
+ */
+
+PARROT_PURE_FUNCTION
+static
+size_t hash_str(ARGIN(const char *str))
+{
+    size_t      key = 0;
+    const char *s   = str;
+
+    while (*s) {
+        key *= 65599;
+        key += *s++;
+    }
+
+    return key;
+}
+
+
+static void store_op(ARGIN(op_info_t *info), ARGMOD(HOP *p), ARGIN(const char *name))
+{
+    const size_t hidx = hash_str(name) % OP_HASH_SIZE;
+
+    p->info           = info;
+    p->next           = hop[hidx];
+    hop[hidx]         = p;
+}
+
+static int get_op(PARROT_INTERP, ARGIN(const char *name), int full)
+{
+    const HOP   *p;
+    const size_t hidx = hash_str(name) % OP_HASH_SIZE;
+
+    if (!hop) {
+        hop = mem_gc_allocate_n_zeroed_typed(interp, OP_HASH_SIZE,HOP *);
+        hop_init(interp);
+    }
+
+    for (p = hop[hidx]; p; p = p->next) {
+        if (STREQ(name, full ? p->info->full_name : p->info->name))
+            return p->info - bit_op_lib.op_info_table;
+    }
+
+    return -1;
+}
+
+
+static void hop_init(PARROT_INTERP)
+{
+    op_info_t * const info = bit_op_lib.op_info_table;
+    opcode_t i;
+
+    /* allocate the storage all in one chunk
+     * yes, this is profligate, but we can tighten it later */
+    HOP *hops;
+
+    hop_buckets = mem_gc_allocate_n_zeroed_typed(interp, bit_op_lib.op_count * 2, HOP );
+    hops        = hop_buckets;
+
+
+    /* store full names */
+    for (i = 0; i < bit_op_lib.op_count; i++) {
+        store_op(info + i, hops++, info[i].full_name);
+
+        /* plus one short name */
+        if (i && info[i - 1].name != info[i].name)
+            store_op(info + i, hops++, info[i].name);
+    }
+}
+
+static void hop_deinit(PARROT_INTERP)
+{
+    if (hop)
+        mem_sys_free(hop);
+    if (hop_buckets)
+        mem_gc_free(interp, hop_buckets);
+
+    hop         = NULL;
+    hop_buckets = NULL;
+}
+
+op_lib_t *
+PARROT_DYNOP_BIT_INIT(PARROT_INTERP, long init) {
+    /* initialize and return op_lib ptr */
+    if (init == 1) {
+
+        return &bit_op_lib;
+    }
+    /* set op_lib to the passed ptr (in init) */
+    else if (init) {
+
+    }
+    /* deinit - free resources */
+    else {
+        hop_deinit(interp);
+    }
+    return NULL;
+}
+
+
+/*
+ * dynamic lib load function - called once
+ */
+PARROT_DYNEXT_EXPORT PMC*
+Parrot_lib_bit_ops_load(PARROT_INTERP);
+
+PARROT_DYNEXT_EXPORT PMC*
+Parrot_lib_bit_ops_load(PARROT_INTERP)
+
+{
+    PMC *const lib = Parrot_pmc_new(interp, enum_class_ParrotLibrary);
+    ((Parrot_ParrotLibrary_attributes*)PMC_data(lib))->oplib_init = (void *) PARROT_DYNOP_BIT_INIT;
+    dynop_register(interp, lib);
+    return lib;
+}
+
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ *   buffer-read-only: t
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
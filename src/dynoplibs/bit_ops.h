@@ -0,0 +1,114 @@
+
+#ifndef PARROT_SRC_DYNOPLIBS_BIT_OPS_H_GUARD
+#define PARROT_SRC_DYNOPLIBS_BIT_OPS_H_GUARD
+
+/* ex: set ro:
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from 'src/dynoplibs/bit.ops' (and possibly other
+ * .ops files). by ops2c.nqp.
+ *
+ * Any changes made here will be lost!  To regenerate this file after making
+ * changes to any ops, use the bootstrap-ops makefile target.
+ *
+ */
+#define PARROT_IN_EXTENSION
+
+#include "parrot/parrot.h"
+#include "parrot/oplib.h"
+#include "parrot/runcore_api.h"
+
+
+op_lib_t *PARROT_DYNOP_BIT_INIT(PARROT_INTERP, long init);
+
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_band_p_i(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_band_p_ic(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_band_p_p(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_band_p_p_i(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_band_p_p_ic(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_band_p_p_p(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bands_p_s(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bands_p_sc(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bands_p_p(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bands_s_s_s(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bands_s_sc_s(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bands_s_s_sc(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bands_s_sc_sc(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bands_p_p_s(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bands_p_p_sc(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bands_p_p_p(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bor_p_i(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bor_p_ic(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bor_p_p(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bor_p_p_i(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bor_p_p_ic(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bor_p_p_p(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bors_p_s(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bors_p_sc(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bors_p_p(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bors_s_s_s(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bors_s_sc_s(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bors_s_s_sc(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bors_s_sc_sc(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bors_p_p_s(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bors_p_p_sc(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bors_p_p_p(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_shl_p_i(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_shl_p_ic(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_shl_p_p(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_shl_p_p_i(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_shl_p_p_ic(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_shl_p_p_p(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_shr_p_i(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_shr_p_ic(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_shr_p_p(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_shr_p_p_i(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_shr_p_p_ic(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_shr_p_p_p(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bnot_i(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bnot_i_i(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bnot_i_ic(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bnot_p(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bnot_p_p(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bnots_s_s(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bnots_s_sc(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bnots_p(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bnots_p_p(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_lsr_p_i(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_lsr_p_ic(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_lsr_p_p(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_lsr_p_p_i(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_lsr_p_p_ic(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_lsr_p_p_p(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_rot_i_i_i_ic(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_rot_i_ic_i_ic(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_rot_i_i_ic_ic(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_rot_i_ic_ic_ic(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bxor_p_i(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bxor_p_ic(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bxor_p_p(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bxor_p_p_i(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bxor_p_p_ic(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bxor_p_p_p(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bxors_p_s(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bxors_p_sc(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bxors_p_p(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bxors_s_s_s(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bxors_s_sc_s(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bxors_s_s_sc(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bxors_s_sc_sc(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bxors_p_p_s(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bxors_p_p_sc(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_bxors_p_p_p(opcode_t *, PARROT_INTERP);
+
+
+#endif /* PARROT_SRC_DYNOPLIBS_BIT_OPS_H_GUARD */
+
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ *   buffer-read-only: t
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
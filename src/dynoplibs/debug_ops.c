@@ -0,0 +1,393 @@
+/* ex: set ro:
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from 'src/dynoplibs/debug.ops' (and possibly other
+ * .ops files). by ops2c.nqp.
+ *
+ * Any changes made here will be lost!  To regenerate this file after making
+ * changes to any ops, use the bootstrap-ops makefile target.
+ *
+ */
+#define PARROT_IN_EXTENSION
+
+#include "debug_ops.h"
+#include "parrot/pbcversion.h"
+#include "pmc/pmc_parrotlibrary.h"
+#include "pmc/pmc_callcontext.h"
+
+
+/* defines - Ops::Trans::C */
+#define REL_PC     ((size_t)(cur_opcode - (opcode_t *)interp->code->base.data))
+#define CUR_OPCODE cur_opcode
+#define IREG(i) REG_INT(interp, cur_opcode[i])
+#define NREG(i) REG_NUM(interp, cur_opcode[i])
+#define PREG(i) REG_PMC(interp, cur_opcode[i])
+#define SREG(i) REG_STR(interp, cur_opcode[i])
+#define ICONST(i) cur_opcode[i]
+#define NCONST(i) Parrot_pcc_get_num_constants(interp, interp->ctx)[cur_opcode[i]]
+#define SCONST(i) Parrot_pcc_get_str_constants(interp, interp->ctx)[cur_opcode[i]]
+#undef  PCONST
+#define PCONST(i) Parrot_pcc_get_pmc_constants(interp, interp->ctx)[cur_opcode[i]]
+
+static int get_op(PARROT_INTERP, const char * name, int full);
+
+
+/* XXX should be static, but C++ doesn't want to play ball */
+extern op_lib_t debug_op_lib;
+
+
+
+INTVAL debug_numops = 8;
+
+/*
+** Op Function Table:
+*/
+
+static op_func_t debug_op_func_table[8] = {
+  Parrot_debug_init,                                 /*      0 */
+  Parrot_debug_load_sc,                              /*      1 */
+  Parrot_debug_break,                                /*      2 */
+  Parrot_debug_print,                                /*      3 */
+  Parrot_backtrace,                                  /*      4 */
+  Parrot_getline_i,                                  /*      5 */
+  Parrot_getfile_s,                                  /*      6 */
+
+  NULL /* NULL function pointer */
+};
+
+
+
+/*
+** Op Info Table:
+*/
+
+static op_info_t debug_op_info_table[8] = {
+  { /* 0 */
+    "debug_init",
+    "debug_init",
+    "Parrot_debug_init",
+    0,
+    1,
+    { (arg_type_t) 0 },
+    { (arg_dir_t) 0 },
+    { 0 },
+    &debug_op_lib
+  },
+  { /* 1 */
+    "debug_load",
+    "debug_load_sc",
+    "Parrot_debug_load_sc",
+    0,
+    2,
+    { PARROT_ARG_SC },
+    { PARROT_ARGDIR_IN },
+    { 0 },
+    &debug_op_lib
+  },
+  { /* 2 */
+    "debug_break",
+    "debug_break",
+    "Parrot_debug_break",
+    0,
+    1,
+    { (arg_type_t) 0 },
+    { (arg_dir_t) 0 },
+    { 0 },
+    &debug_op_lib
+  },
+  { /* 3 */
+    "debug_print",
+    "debug_print",
+    "Parrot_debug_print",
+    0,
+    1,
+    { (arg_type_t) 0 },
+    { (arg_dir_t) 0 },
+    { 0 },
+    &debug_op_lib
+  },
+  { /* 4 */
+    "backtrace",
+    "backtrace",
+    "Parrot_backtrace",
+    0,
+    1,
+    { (arg_type_t) 0 },
+    { (arg_dir_t) 0 },
+    { 0 },
+    &debug_op_lib
+  },
+  { /* 5 */
+    "getline",
+    "getline_i",
+    "Parrot_getline_i",
+    0,
+    2,
+    { PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT },
+    { 0 },
+    &debug_op_lib
+  },
+  { /* 6 */
+    "getfile",
+    "getfile_s",
+    "Parrot_getfile_s",
+    0,
+    2,
+    { PARROT_ARG_S },
+    { PARROT_ARGDIR_OUT },
+    { 0 },
+    &debug_op_lib
+  },
+
+};
+
+
+/*
+** Op Function Definitions:
+*/
+
+opcode_t *
+Parrot_debug_init(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_debugger_init(interp);
+    return cur_opcode + 1;
+}
+
+opcode_t *
+Parrot_debug_load_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_debugger_load(interp, SCONST(1));
+    return cur_opcode + 2;
+}
+
+opcode_t *
+Parrot_debug_break(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_debugger_break(interp, cur_opcode);
+    return cur_opcode + 1;
+}
+
+opcode_t *
+Parrot_debug_print(opcode_t *cur_opcode, PARROT_INTERP) {
+    if ((!interp->pdb)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 1, EXCEPTION_INVALID_OPERATION, "Initialize debugger with debug_init before using debug_print");
+
+        return (opcode_t *)handler;
+    }
+
+    if ((!((interp->pdb->state & PDB_BREAK)))) {
+        PDB_print(interp, "I");
+        PDB_print(interp, "N");
+        PDB_print(interp, "S");
+        PDB_print(interp, "P");
+    }
+
+    return cur_opcode + 1;
+}
+
+opcode_t *
+Parrot_backtrace(opcode_t *cur_opcode, PARROT_INTERP) {
+    PDB_backtrace(interp);
+    return cur_opcode + 1;
+}
+
+opcode_t *
+Parrot_getline_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_Context_info   info;
+
+    Parrot_sub_context_get_info(interp, CURRENT_CONTEXT(interp), (&info));
+    IREG(1) = info.line;
+    return cur_opcode + 2;
+}
+
+opcode_t *
+Parrot_getfile_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_Context_info   info;
+
+    Parrot_sub_context_get_info(interp, CURRENT_CONTEXT(interp), (&info));
+    SREG(1) = info.file;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 2;
+}
+
+
+/*
+** op lib descriptor:
+*/
+
+/* XXX should be static, but C++ doesn't want to play ball */
+op_lib_t debug_op_lib = {
+  "debug_ops",                /* name */
+  "",                  /* suffix */
+  PARROT_FUNCTION_CORE,                       /* core_type = PARROT_XX_CORE */
+  0,                                /* flags */
+  PARROT_PBC_MAJOR,
+  PARROT_PBC_MINOR,
+  7,             /* op_count */
+  debug_op_info_table,       /* op_info_table */
+  debug_op_func_table,       /* op_func_table */
+  get_op          /* op_code() */ 
+};
+
+/*
+** Op lookup function:
+*/
+
+#define OP_HASH_SIZE 3041
+
+/* we could calculate a prime somewhat bigger than
+ * n of fullnames + n of names
+ * for now this should be ok
+ *
+ * look up an op_code: at first call to op_code() a hash
+ * of short and full opcode names is created
+ * hash functions are from imcc, thanks to Melvin.
+ */
+
+
+typedef struct hop {
+    op_info_t * info;
+    struct hop *next;
+} HOP;
+
+static HOP *hop_buckets;
+static HOP **hop;
+
+static void hop_init(PARROT_INTERP);
+static size_t hash_str(ARGIN(const char *str));
+static void store_op(ARGIN(op_info_t *info), ARGMOD(HOP *p), ARGIN(const char *name));
+
+/* XXX on changing interpreters, this should be called,
+   through a hook */
+
+static void hop_deinit(PARROT_INTERP);
+
+/*
+ * find a short or full opcode
+ * usage:
+ *
+ * interp->op_lib->op_code("set", 0)
+ * interp->op_lib->op_code("set_i_i", 1)
+ *
+ * returns >= 0 (found idx into info_table), -1 if not
+ */
+
+PARROT_PURE_FUNCTION
+static
+size_t hash_str(ARGIN(const char *str))
+{
+    size_t      key = 0;
+    const char *s   = str;
+
+    while (*s) {
+        key *= 65599;
+        key += *s++;
+    }
+
+    return key;
+}
+
+
+static void store_op(ARGIN(op_info_t *info), ARGMOD(HOP *p), ARGIN(const char *name))
+{
+    const size_t hidx = hash_str(name) % OP_HASH_SIZE;
+
+    p->info           = info;
+    p->next           = hop[hidx];
+    hop[hidx]         = p;
+}
+
+static int get_op(PARROT_INTERP, ARGIN(const char *name), int full)
+{
+    const HOP   *p;
+    const size_t hidx = hash_str(name) % OP_HASH_SIZE;
+
+    if (!hop) {
+        hop = mem_gc_allocate_n_zeroed_typed(interp, OP_HASH_SIZE,HOP *);
+        hop_init(interp);
+    }
+
+    for (p = hop[hidx]; p; p = p->next) {
+        if (STREQ(name, full ? p->info->full_name : p->info->name))
+            return p->info - debug_op_lib.op_info_table;
+    }
+
+    return -1;
+}
+
+
+static void hop_init(PARROT_INTERP)
+{
+    op_info_t * const info = debug_op_lib.op_info_table;
+    opcode_t i;
+
+    /* allocate the storage all in one chunk
+     * yes, this is profligate, but we can tighten it later */
+    HOP *hops;
+
+    hop_buckets = mem_gc_allocate_n_zeroed_typed(interp, debug_op_lib.op_count * 2, HOP );
+    hops        = hop_buckets;
+
+
+    /* store full names */
+    for (i = 0; i < debug_op_lib.op_count; i++) {
+        store_op(info + i, hops++, info[i].full_name);
+
+        /* plus one short name */
+        if (i && info[i - 1].name != info[i].name)
+            store_op(info + i, hops++, info[i].name);
+    }
+}
+
+static void hop_deinit(PARROT_INTERP)
+{
+    if (hop)
+        mem_sys_free(hop);
+    if (hop_buckets)
+        mem_gc_free(interp, hop_buckets);
+
+    hop         = NULL;
+    hop_buckets = NULL;
+}
+
+op_lib_t *
+PARROT_DYNOP_DEBUG_INIT(PARROT_INTERP, long init) {
+    /* initialize and return op_lib ptr */
+    if (init == 1) {
+
+        return &debug_op_lib;
+    }
+    /* set op_lib to the passed ptr (in init) */
+    else if (init) {
+
+    }
+    /* deinit - free resources */
+    else {
+        hop_deinit(interp);
+    }
+    return NULL;
+}
+
+
+/*
+ * dynamic lib load function - called once
+ */
+PARROT_DYNEXT_EXPORT PMC*
+Parrot_lib_debug_ops_load(PARROT_INTERP);
+
+PARROT_DYNEXT_EXPORT PMC*
+Parrot_lib_debug_ops_load(PARROT_INTERP)
+
+{
+    PMC *const lib = Parrot_pmc_new(interp, enum_class_ParrotLibrary);
+    ((Parrot_ParrotLibrary_attributes*)PMC_data(lib))->oplib_init = (void *) PARROT_DYNOP_DEBUG_INIT;
+    dynop_register(interp, lib);
+    return lib;
+}
+
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ *   buffer-read-only: t
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
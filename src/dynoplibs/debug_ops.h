@@ -0,0 +1,42 @@
+
+#ifndef PARROT_SRC_DYNOPLIBS_DEBUG_OPS_H_GUARD
+#define PARROT_SRC_DYNOPLIBS_DEBUG_OPS_H_GUARD
+
+/* ex: set ro:
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from 'src/dynoplibs/debug.ops' (and possibly other
+ * .ops files). by ops2c.nqp.
+ *
+ * Any changes made here will be lost!  To regenerate this file after making
+ * changes to any ops, use the bootstrap-ops makefile target.
+ *
+ */
+#define PARROT_IN_EXTENSION
+
+#include "parrot/parrot.h"
+#include "parrot/oplib.h"
+#include "parrot/runcore_api.h"
+
+
+op_lib_t *PARROT_DYNOP_DEBUG_INIT(PARROT_INTERP, long init);
+
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_debug_init(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_debug_load_sc(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_debug_break(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_debug_print(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_backtrace(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_getline_i(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_getfile_s(opcode_t *, PARROT_INTERP);
+
+
+#endif /* PARROT_SRC_DYNOPLIBS_DEBUG_OPS_H_GUARD */
+
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ *   buffer-read-only: t
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
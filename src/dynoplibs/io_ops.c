@@ -0,0 +1,1369 @@
+/* ex: set ro:
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from 'src/dynoplibs/io.ops' (and possibly other
+ * .ops files). by ops2c.nqp.
+ *
+ * Any changes made here will be lost!  To regenerate this file after making
+ * changes to any ops, use the bootstrap-ops makefile target.
+ *
+ */
+#define PARROT_IN_EXTENSION
+
+#include "io_ops.h"
+#include "parrot/pbcversion.h"
+#include "pmc/pmc_parrotlibrary.h"
+#include "pmc/pmc_callcontext.h"
+
+
+/* defines - Ops::Trans::C */
+#define REL_PC     ((size_t)(cur_opcode - (opcode_t *)interp->code->base.data))
+#define CUR_OPCODE cur_opcode
+#define IREG(i) REG_INT(interp, cur_opcode[i])
+#define NREG(i) REG_NUM(interp, cur_opcode[i])
+#define PREG(i) REG_PMC(interp, cur_opcode[i])
+#define SREG(i) REG_STR(interp, cur_opcode[i])
+#define ICONST(i) cur_opcode[i]
+#define NCONST(i) Parrot_pcc_get_num_constants(interp, interp->ctx)[cur_opcode[i]]
+#define SCONST(i) Parrot_pcc_get_str_constants(interp, interp->ctx)[cur_opcode[i]]
+#undef  PCONST
+#define PCONST(i) Parrot_pcc_get_pmc_constants(interp, interp->ctx)[cur_opcode[i]]
+
+static int get_op(PARROT_INTERP, const char * name, int full);
+
+
+/* XXX should be static, but C++ doesn't want to play ball */
+extern op_lib_t io_op_lib;
+
+
+#include "../io/io_private.h"
+
+
+INTVAL io_numops = 51;
+
+/*
+** Op Function Table:
+*/
+
+static op_func_t io_op_func_table[51] = {
+  Parrot_stat_i_s_i,                                 /*      0 */
+  Parrot_stat_i_sc_i,                                /*      1 */
+  Parrot_stat_i_s_ic,                                /*      2 */
+  Parrot_stat_i_sc_ic,                               /*      3 */
+  Parrot_read_s_i,                                   /*      4 */
+  Parrot_read_s_ic,                                  /*      5 */
+  Parrot_read_s_p_i,                                 /*      6 */
+  Parrot_read_s_p_ic,                                /*      7 */
+  Parrot_readline_s_p,                               /*      8 */
+  Parrot_printerr_i,                                 /*      9 */
+  Parrot_printerr_ic,                                /*     10 */
+  Parrot_printerr_n,                                 /*     11 */
+  Parrot_printerr_nc,                                /*     12 */
+  Parrot_printerr_s,                                 /*     13 */
+  Parrot_printerr_sc,                                /*     14 */
+  Parrot_printerr_p,                                 /*     15 */
+  Parrot_seek_p_i_i,                                 /*     16 */
+  Parrot_seek_p_ic_i,                                /*     17 */
+  Parrot_seek_p_i_ic,                                /*     18 */
+  Parrot_seek_p_ic_ic,                               /*     19 */
+  Parrot_seek_p_i_i_i,                               /*     20 */
+  Parrot_seek_p_ic_i_i,                              /*     21 */
+  Parrot_seek_p_i_ic_i,                              /*     22 */
+  Parrot_seek_p_ic_ic_i,                             /*     23 */
+  Parrot_seek_p_i_i_ic,                              /*     24 */
+  Parrot_seek_p_ic_i_ic,                             /*     25 */
+  Parrot_seek_p_i_ic_ic,                             /*     26 */
+  Parrot_seek_p_ic_ic_ic,                            /*     27 */
+  Parrot_tell_i_p,                                   /*     28 */
+  Parrot_tell_i_i_p,                                 /*     29 */
+  Parrot_peek_s,                                     /*     30 */
+  Parrot_peek_s_p,                                   /*     31 */
+  Parrot_open_p_s_s,                                 /*     32 */
+  Parrot_open_p_sc_s,                                /*     33 */
+  Parrot_open_p_s_sc,                                /*     34 */
+  Parrot_open_p_sc_sc,                               /*     35 */
+  Parrot_open_p_s,                                   /*     36 */
+  Parrot_open_p_sc,                                  /*     37 */
+  Parrot_close_p,                                    /*     38 */
+  Parrot_fdopen_p_i_s,                               /*     39 */
+  Parrot_fdopen_p_ic_s,                              /*     40 */
+  Parrot_fdopen_p_i_sc,                              /*     41 */
+  Parrot_fdopen_p_ic_sc,                             /*     42 */
+  Parrot_setstdin_p,                                 /*     43 */
+  Parrot_setstdout_p,                                /*     44 */
+  Parrot_setstderr_p,                                /*     45 */
+  Parrot_freeze_to_p_p,                              /*     46 */
+  Parrot_freeze_to_p_p_i,                            /*     47 */
+  Parrot_freeze_to_p_p_ic,                           /*     48 */
+  Parrot_thaw_from_p_p,                              /*     49 */
+
+  NULL /* NULL function pointer */
+};
+
+
+
+/*
+** Op Info Table:
+*/
+
+static op_info_t io_op_info_table[51] = {
+  { /* 0 */
+    "stat",
+    "stat_i_s_i",
+    "Parrot_stat_i_s_i",
+    0,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_S, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &io_op_lib
+  },
+  { /* 1 */
+    "stat",
+    "stat_i_sc_i",
+    "Parrot_stat_i_sc_i",
+    0,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_SC, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &io_op_lib
+  },
+  { /* 2 */
+    "stat",
+    "stat_i_s_ic",
+    "Parrot_stat_i_s_ic",
+    0,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_S, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &io_op_lib
+  },
+  { /* 3 */
+    "stat",
+    "stat_i_sc_ic",
+    "Parrot_stat_i_sc_ic",
+    0,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_SC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &io_op_lib
+  },
+  { /* 4 */
+    "read",
+    "read_s_i",
+    "Parrot_read_s_i",
+    0,
+    3,
+    { PARROT_ARG_S, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &io_op_lib
+  },
+  { /* 5 */
+    "read",
+    "read_s_ic",
+    "Parrot_read_s_ic",
+    0,
+    3,
+    { PARROT_ARG_S, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &io_op_lib
+  },
+  { /* 6 */
+    "read",
+    "read_s_p_i",
+    "Parrot_read_s_p_i",
+    0,
+    4,
+    { PARROT_ARG_S, PARROT_ARG_P, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &io_op_lib
+  },
+  { /* 7 */
+    "read",
+    "read_s_p_ic",
+    "Parrot_read_s_p_ic",
+    0,
+    4,
+    { PARROT_ARG_S, PARROT_ARG_P, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &io_op_lib
+  },
+  { /* 8 */
+    "readline",
+    "readline_s_p",
+    "Parrot_readline_s_p",
+    0,
+    3,
+    { PARROT_ARG_S, PARROT_ARG_P },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &io_op_lib
+  },
+  { /* 9 */
+    "printerr",
+    "printerr_i",
+    "Parrot_printerr_i",
+    0,
+    2,
+    { PARROT_ARG_I },
+    { PARROT_ARGDIR_IN },
+    { 0 },
+    &io_op_lib
+  },
+  { /* 10 */
+    "printerr",
+    "printerr_ic",
+    "Parrot_printerr_ic",
+    0,
+    2,
+    { PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN },
+    { 0 },
+    &io_op_lib
+  },
+  { /* 11 */
+    "printerr",
+    "printerr_n",
+    "Parrot_printerr_n",
+    0,
+    2,
+    { PARROT_ARG_N },
+    { PARROT_ARGDIR_IN },
+    { 0 },
+    &io_op_lib
+  },
+  { /* 12 */
+    "printerr",
+    "printerr_nc",
+    "Parrot_printerr_nc",
+    0,
+    2,
+    { PARROT_ARG_NC },
+    { PARROT_ARGDIR_IN },
+    { 0 },
+    &io_op_lib
+  },
+  { /* 13 */
+    "printerr",
+    "printerr_s",
+    "Parrot_printerr_s",
+    0,
+    2,
+    { PARROT_ARG_S },
+    { PARROT_ARGDIR_IN },
+    { 0 },
+    &io_op_lib
+  },
+  { /* 14 */
+    "printerr",
+    "printerr_sc",
+    "Parrot_printerr_sc",
+    0,
+    2,
+    { PARROT_ARG_SC },
+    { PARROT_ARGDIR_IN },
+    { 0 },
+    &io_op_lib
+  },
+  { /* 15 */
+    "printerr",
+    "printerr_p",
+    "Parrot_printerr_p",
+    0,
+    2,
+    { PARROT_ARG_P },
+    { PARROT_ARGDIR_IN },
+    { 0 },
+    &io_op_lib
+  },
+  { /* 16 */
+    "seek",
+    "seek_p_i_i",
+    "Parrot_seek_p_i_i",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &io_op_lib
+  },
+  { /* 17 */
+    "seek",
+    "seek_p_ic_i",
+    "Parrot_seek_p_ic_i",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_IC, PARROT_ARG_I },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &io_op_lib
+  },
+  { /* 18 */
+    "seek",
+    "seek_p_i_ic",
+    "Parrot_seek_p_i_ic",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &io_op_lib
+  },
+  { /* 19 */
+    "seek",
+    "seek_p_ic_ic",
+    "Parrot_seek_p_ic_ic",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &io_op_lib
+  },
+  { /* 20 */
+    "seek",
+    "seek_p_i_i_i",
+    "Parrot_seek_p_i_i_i",
+    0,
+    5,
+    { PARROT_ARG_P, PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0 },
+    &io_op_lib
+  },
+  { /* 21 */
+    "seek",
+    "seek_p_ic_i_i",
+    "Parrot_seek_p_ic_i_i",
+    0,
+    5,
+    { PARROT_ARG_P, PARROT_ARG_IC, PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0 },
+    &io_op_lib
+  },
+  { /* 22 */
+    "seek",
+    "seek_p_i_ic_i",
+    "Parrot_seek_p_i_ic_i",
+    0,
+    5,
+    { PARROT_ARG_P, PARROT_ARG_I, PARROT_ARG_IC, PARROT_ARG_I },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0 },
+    &io_op_lib
+  },
+  { /* 23 */
+    "seek",
+    "seek_p_ic_ic_i",
+    "Parrot_seek_p_ic_ic_i",
+    0,
+    5,
+    { PARROT_ARG_P, PARROT_ARG_IC, PARROT_ARG_IC, PARROT_ARG_I },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0 },
+    &io_op_lib
+  },
+  { /* 24 */
+    "seek",
+    "seek_p_i_i_ic",
+    "Parrot_seek_p_i_i_ic",
+    0,
+    5,
+    { PARROT_ARG_P, PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0 },
+    &io_op_lib
+  },
+  { /* 25 */
+    "seek",
+    "seek_p_ic_i_ic",
+    "Parrot_seek_p_ic_i_ic",
+    0,
+    5,
+    { PARROT_ARG_P, PARROT_ARG_IC, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0 },
+    &io_op_lib
+  },
+  { /* 26 */
+    "seek",
+    "seek_p_i_ic_ic",
+    "Parrot_seek_p_i_ic_ic",
+    0,
+    5,
+    { PARROT_ARG_P, PARROT_ARG_I, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0 },
+    &io_op_lib
+  },
+  { /* 27 */
+    "seek",
+    "seek_p_ic_ic_ic",
+    "Parrot_seek_p_ic_ic_ic",
+    0,
+    5,
+    { PARROT_ARG_P, PARROT_ARG_IC, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0 },
+    &io_op_lib
+  },
+  { /* 28 */
+    "tell",
+    "tell_i_p",
+    "Parrot_tell_i_p",
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_P },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &io_op_lib
+  },
+  { /* 29 */
+    "tell",
+    "tell_i_i_p",
+    "Parrot_tell_i_i_p",
+    0,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_P },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &io_op_lib
+  },
+  { /* 30 */
+    "peek",
+    "peek_s",
+    "Parrot_peek_s",
+    0,
+    2,
+    { PARROT_ARG_S },
+    { PARROT_ARGDIR_OUT },
+    { 0 },
+    &io_op_lib
+  },
+  { /* 31 */
+    "peek",
+    "peek_s_p",
+    "Parrot_peek_s_p",
+    0,
+    3,
+    { PARROT_ARG_S, PARROT_ARG_P },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &io_op_lib
+  },
+  { /* 32 */
+    "open",
+    "open_p_s_s",
+    "Parrot_open_p_s_s",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_S, PARROT_ARG_S },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &io_op_lib
+  },
+  { /* 33 */
+    "open",
+    "open_p_sc_s",
+    "Parrot_open_p_sc_s",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_SC, PARROT_ARG_S },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &io_op_lib
+  },
+  { /* 34 */
+    "open",
+    "open_p_s_sc",
+    "Parrot_open_p_s_sc",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_S, PARROT_ARG_SC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &io_op_lib
+  },
+  { /* 35 */
+    "open",
+    "open_p_sc_sc",
+    "Parrot_open_p_sc_sc",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_SC, PARROT_ARG_SC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &io_op_lib
+  },
+  { /* 36 */
+    "open",
+    "open_p_s",
+    "Parrot_open_p_s",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_S },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &io_op_lib
+  },
+  { /* 37 */
+    "open",
+    "open_p_sc",
+    "Parrot_open_p_sc",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_SC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &io_op_lib
+  },
+  { /* 38 */
+    "close",
+    "close_p",
+    "Parrot_close_p",
+    0,
+    2,
+    { PARROT_ARG_P },
+    { PARROT_ARGDIR_IN },
+    { 0 },
+    &io_op_lib
+  },
+  { /* 39 */
+    "fdopen",
+    "fdopen_p_i_s",
+    "Parrot_fdopen_p_i_s",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_I, PARROT_ARG_S },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &io_op_lib
+  },
+  { /* 40 */
+    "fdopen",
+    "fdopen_p_ic_s",
+    "Parrot_fdopen_p_ic_s",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_IC, PARROT_ARG_S },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &io_op_lib
+  },
+  { /* 41 */
+    "fdopen",
+    "fdopen_p_i_sc",
+    "Parrot_fdopen_p_i_sc",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_I, PARROT_ARG_SC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &io_op_lib
+  },
+  { /* 42 */
+    "fdopen",
+    "fdopen_p_ic_sc",
+    "Parrot_fdopen_p_ic_sc",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_IC, PARROT_ARG_SC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &io_op_lib
+  },
+  { /* 43 */
+    "setstdin",
+    "setstdin_p",
+    "Parrot_setstdin_p",
+    0,
+    2,
+    { PARROT_ARG_P },
+    { PARROT_ARGDIR_IN },
+    { 0 },
+    &io_op_lib
+  },
+  { /* 44 */
+    "setstdout",
+    "setstdout_p",
+    "Parrot_setstdout_p",
+    0,
+    2,
+    { PARROT_ARG_P },
+    { PARROT_ARGDIR_IN },
+    { 0 },
+    &io_op_lib
+  },
+  { /* 45 */
+    "setstderr",
+    "setstderr_p",
+    "Parrot_setstderr_p",
+    0,
+    2,
+    { PARROT_ARG_P },
+    { PARROT_ARGDIR_IN },
+    { 0 },
+    &io_op_lib
+  },
+  { /* 46 */
+    "freeze_to",
+    "freeze_to_p_p",
+    "Parrot_freeze_to_p_p",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_P },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &io_op_lib
+  },
+  { /* 47 */
+    "freeze_to",
+    "freeze_to_p_p_i",
+    "Parrot_freeze_to_p_p_i",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_I },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &io_op_lib
+  },
+  { /* 48 */
+    "freeze_to",
+    "freeze_to_p_p_ic",
+    "Parrot_freeze_to_p_p_ic",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &io_op_lib
+  },
+  { /* 49 */
+    "thaw_from",
+    "thaw_from_p_p",
+    "Parrot_thaw_from_p_p",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_P },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &io_op_lib
+  },
+
+};
+
+
+/*
+** Op Function Definitions:
+*/
+
+opcode_t *
+Parrot_stat_i_s_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_file_stat_intval(interp, SREG(2), IREG(3));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_stat_i_sc_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_file_stat_intval(interp, SCONST(2), IREG(3));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_stat_i_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_file_stat_intval(interp, SREG(2), ICONST(3));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_stat_i_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_file_stat_intval(interp, SCONST(2), ICONST(3));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_read_s_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_io_read_s(interp, _PIO_STDIN(interp), (size_t)IREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_read_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_io_read_s(interp, _PIO_STDIN(interp), (size_t)ICONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_read_s_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_io_read_s(interp, PREG(2), (size_t)IREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_read_s_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_io_read_s(interp, PREG(2), (size_t)ICONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_readline_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_io_readline(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_printerr_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_io_eprintf(interp, INTVAL_FMT, IREG(1));
+    return cur_opcode + 2;
+}
+
+opcode_t *
+Parrot_printerr_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_io_eprintf(interp, INTVAL_FMT, ICONST(1));
+    return cur_opcode + 2;
+}
+
+opcode_t *
+Parrot_printerr_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_io_eprintf(interp, FLOATVAL_FMT, NREG(1));
+    return cur_opcode + 2;
+}
+
+opcode_t *
+Parrot_printerr_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_io_eprintf(interp, FLOATVAL_FMT, NCONST(1));
+    return cur_opcode + 2;
+}
+
+opcode_t *
+Parrot_printerr_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  s = SREG(1);
+
+    if ((s && Parrot_str_byte_length(interp, s))) {
+        Parrot_io_write_s(interp, _PIO_STDERR(interp), s);
+    }
+
+    return cur_opcode + 2;
+}
+
+opcode_t *
+Parrot_printerr_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  s = SCONST(1);
+
+    if ((s && Parrot_str_byte_length(interp, s))) {
+        Parrot_io_write_s(interp, _PIO_STDERR(interp), s);
+    }
+
+    return cur_opcode + 2;
+}
+
+opcode_t *
+Parrot_printerr_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  p = PREG(1);
+    STRING  * const  s = (VTABLE_get_string(interp, p));
+
+    if (s) {
+        Parrot_io_write_s(interp, _PIO_STDERR(interp), s);
+    }
+
+    return cur_opcode + 2;
+}
+
+opcode_t *
+Parrot_seek_p_i_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (PREG(1)) {
+        if ((Parrot_io_seek(interp, PREG(1), Parrot_io_make_offset(IREG(2)), IREG(3)) < 0)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_PIO_ERROR, "seek failed (32bit)");
+
+            return (opcode_t *)handler;
+        }
+
+    }
+
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_seek_p_ic_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (PREG(1)) {
+        if ((Parrot_io_seek(interp, PREG(1), Parrot_io_make_offset(ICONST(2)), IREG(3)) < 0)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_PIO_ERROR, "seek failed (32bit)");
+
+            return (opcode_t *)handler;
+        }
+
+    }
+
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_seek_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (PREG(1)) {
+        if ((Parrot_io_seek(interp, PREG(1), Parrot_io_make_offset(IREG(2)), ICONST(3)) < 0)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_PIO_ERROR, "seek failed (32bit)");
+
+            return (opcode_t *)handler;
+        }
+
+    }
+
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_seek_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (PREG(1)) {
+        if ((Parrot_io_seek(interp, PREG(1), Parrot_io_make_offset(ICONST(2)), ICONST(3)) < 0)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_PIO_ERROR, "seek failed (32bit)");
+
+            return (opcode_t *)handler;
+        }
+
+    }
+
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_seek_p_i_i_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (PREG(1)) {
+        if ((Parrot_io_seek(interp, PREG(1), Parrot_io_make_offset32(IREG(2), IREG(3)), IREG(4)) < 0)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 5, EXCEPTION_PIO_ERROR, "seek failed (64bit)");
+
+            return (opcode_t *)handler;
+        }
+
+    }
+
+    return cur_opcode + 5;
+}
+
+opcode_t *
+Parrot_seek_p_ic_i_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (PREG(1)) {
+        if ((Parrot_io_seek(interp, PREG(1), Parrot_io_make_offset32(ICONST(2), IREG(3)), IREG(4)) < 0)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 5, EXCEPTION_PIO_ERROR, "seek failed (64bit)");
+
+            return (opcode_t *)handler;
+        }
+
+    }
+
+    return cur_opcode + 5;
+}
+
+opcode_t *
+Parrot_seek_p_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (PREG(1)) {
+        if ((Parrot_io_seek(interp, PREG(1), Parrot_io_make_offset32(IREG(2), ICONST(3)), IREG(4)) < 0)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 5, EXCEPTION_PIO_ERROR, "seek failed (64bit)");
+
+            return (opcode_t *)handler;
+        }
+
+    }
+
+    return cur_opcode + 5;
+}
+
+opcode_t *
+Parrot_seek_p_ic_ic_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (PREG(1)) {
+        if ((Parrot_io_seek(interp, PREG(1), Parrot_io_make_offset32(ICONST(2), ICONST(3)), IREG(4)) < 0)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 5, EXCEPTION_PIO_ERROR, "seek failed (64bit)");
+
+            return (opcode_t *)handler;
+        }
+
+    }
+
+    return cur_opcode + 5;
+}
+
+opcode_t *
+Parrot_seek_p_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (PREG(1)) {
+        if ((Parrot_io_seek(interp, PREG(1), Parrot_io_make_offset32(IREG(2), IREG(3)), ICONST(4)) < 0)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 5, EXCEPTION_PIO_ERROR, "seek failed (64bit)");
+
+            return (opcode_t *)handler;
+        }
+
+    }
+
+    return cur_opcode + 5;
+}
+
+opcode_t *
+Parrot_seek_p_ic_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (PREG(1)) {
+        if ((Parrot_io_seek(interp, PREG(1), Parrot_io_make_offset32(ICONST(2), IREG(3)), ICONST(4)) < 0)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 5, EXCEPTION_PIO_ERROR, "seek failed (64bit)");
+
+            return (opcode_t *)handler;
+        }
+
+    }
+
+    return cur_opcode + 5;
+}
+
+opcode_t *
+Parrot_seek_p_i_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (PREG(1)) {
+        if ((Parrot_io_seek(interp, PREG(1), Parrot_io_make_offset32(IREG(2), ICONST(3)), ICONST(4)) < 0)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 5, EXCEPTION_PIO_ERROR, "seek failed (64bit)");
+
+            return (opcode_t *)handler;
+        }
+
+    }
+
+    return cur_opcode + 5;
+}
+
+opcode_t *
+Parrot_seek_p_ic_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (PREG(1)) {
+        if ((Parrot_io_seek(interp, PREG(1), Parrot_io_make_offset32(ICONST(2), ICONST(3)), ICONST(4)) < 0)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 5, EXCEPTION_PIO_ERROR, "seek failed (64bit)");
+
+            return (opcode_t *)handler;
+        }
+
+    }
+
+    return cur_opcode + 5;
+}
+
+opcode_t *
+Parrot_tell_i_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (PREG(2)) {
+        IREG(1) = (INTVAL)Parrot_io_tell(interp, PREG(2));
+    }
+
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_tell_i_i_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (PREG(3)) {
+        const PIOOFF_T   pos = Parrot_io_tell(interp, PREG(3));
+
+        IREG(1) = (INTVAL)((pos >> 31));
+        IREG(2) = (INTVAL)((pos & 0xffffffff));
+    }
+
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_peek_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  ** const  s = (&SREG(1));
+
+    (*s) = Parrot_io_peek(interp, _PIO_STDIN(interp));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 2;
+}
+
+opcode_t *
+Parrot_peek_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  ** const  s = (&SREG(1));
+
+    (*s) = Parrot_io_peek(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_open_p_s_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    if ((STRING_IS_NULL(SREG(2)) || STRING_IS_NULL(SREG(3)))) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_UNEXPECTED_NULL, "Invalid open");
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        return (opcode_t *)handler;
+    }
+    else {
+        PREG(1) = Parrot_io_open(interp, PMCNULL, SREG(2), SREG(3));
+        PARROT_ASSERT((!PMC_IS_NULL(PREG(1))));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_open_p_sc_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    if ((STRING_IS_NULL(SCONST(2)) || STRING_IS_NULL(SREG(3)))) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_UNEXPECTED_NULL, "Invalid open");
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        return (opcode_t *)handler;
+    }
+    else {
+        PREG(1) = Parrot_io_open(interp, PMCNULL, SCONST(2), SREG(3));
+        PARROT_ASSERT((!PMC_IS_NULL(PREG(1))));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_open_p_s_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    if ((STRING_IS_NULL(SREG(2)) || STRING_IS_NULL(SCONST(3)))) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_UNEXPECTED_NULL, "Invalid open");
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        return (opcode_t *)handler;
+    }
+    else {
+        PREG(1) = Parrot_io_open(interp, PMCNULL, SREG(2), SCONST(3));
+        PARROT_ASSERT((!PMC_IS_NULL(PREG(1))));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_open_p_sc_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    if ((STRING_IS_NULL(SCONST(2)) || STRING_IS_NULL(SCONST(3)))) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_UNEXPECTED_NULL, "Invalid open");
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        return (opcode_t *)handler;
+    }
+    else {
+        PREG(1) = Parrot_io_open(interp, PMCNULL, SCONST(2), SCONST(3));
+        PARROT_ASSERT((!PMC_IS_NULL(PREG(1))));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_open_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (STRING_IS_NULL(SREG(2))) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_UNEXPECTED_NULL, "Invalid open");
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        return (opcode_t *)handler;
+    }
+    else {
+        PREG(1) = Parrot_io_open(interp, PMCNULL, SREG(2), STRINGNULL);
+        PARROT_ASSERT((!PMC_IS_NULL(PREG(1))));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_open_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (STRING_IS_NULL(SCONST(2))) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_UNEXPECTED_NULL, "Invalid open");
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        return (opcode_t *)handler;
+    }
+    else {
+        PREG(1) = Parrot_io_open(interp, PMCNULL, SCONST(2), STRINGNULL);
+        PARROT_ASSERT((!PMC_IS_NULL(PREG(1))));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_close_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_io_close(interp, PREG(1), (-1));
+    return cur_opcode + 2;
+}
+
+opcode_t *
+Parrot_fdopen_p_i_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = Parrot_io_fdopen(interp, PMCNULL, (PIOHANDLE)IREG(2), SREG(3));
+    if ((!PREG(1))) {
+        PREG(1) = Parrot_pmc_new(interp, enum_class_Undef);
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_fdopen_p_ic_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = Parrot_io_fdopen(interp, PMCNULL, (PIOHANDLE)ICONST(2), SREG(3));
+    if ((!PREG(1))) {
+        PREG(1) = Parrot_pmc_new(interp, enum_class_Undef);
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_fdopen_p_i_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = Parrot_io_fdopen(interp, PMCNULL, (PIOHANDLE)IREG(2), SCONST(3));
+    if ((!PREG(1))) {
+        PREG(1) = Parrot_pmc_new(interp, enum_class_Undef);
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_fdopen_p_ic_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = Parrot_io_fdopen(interp, PMCNULL, (PIOHANDLE)ICONST(2), SCONST(3));
+    if ((!PREG(1))) {
+        PREG(1) = Parrot_pmc_new(interp, enum_class_Undef);
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_setstdin_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    _PIO_STDIN(interp) = PREG(1);
+    return cur_opcode + 2;
+}
+
+opcode_t *
+Parrot_setstdout_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    _PIO_STDOUT(interp) = PREG(1);
+    return cur_opcode + 2;
+}
+
+opcode_t *
+Parrot_setstderr_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    _PIO_STDERR(interp) = PREG(1);
+    return cur_opcode + 2;
+}
+
+opcode_t *
+Parrot_freeze_to_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_freeze_to_handle(interp, PREG(2), PREG(1), 0);
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_freeze_to_p_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_freeze_to_handle(interp, PREG(2), PREG(1), IREG(3));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_freeze_to_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_freeze_to_handle(interp, PREG(2), PREG(1), ICONST(3));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_thaw_from_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = Parrot_thaw_from_handle(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
+}
+
+
+/*
+** op lib descriptor:
+*/
+
+/* XXX should be static, but C++ doesn't want to play ball */
+op_lib_t io_op_lib = {
+  "io_ops",                /* name */
+  "",                  /* suffix */
+  PARROT_FUNCTION_CORE,                       /* core_type = PARROT_XX_CORE */
+  0,                                /* flags */
+  PARROT_PBC_MAJOR,
+  PARROT_PBC_MINOR,
+  50,             /* op_count */
+  io_op_info_table,       /* op_info_table */
+  io_op_func_table,       /* op_func_table */
+  get_op          /* op_code() */ 
+};
+
+/*
+** Op lookup function:
+*/
+
+#define OP_HASH_SIZE 3041
+
+/* we could calculate a prime somewhat bigger than
+ * n of fullnames + n of names
+ * for now this should be ok
+ *
+ * look up an op_code: at first call to op_code() a hash
+ * of short and full opcode names is created
+ * hash functions are from imcc, thanks to Melvin.
+ */
+
+
+typedef struct hop {
+    op_info_t * info;
+    struct hop *next;
+} HOP;
+
+static HOP *hop_buckets;
+static HOP **hop;
+
+static void hop_init(PARROT_INTERP);
+static size_t hash_str(ARGIN(const char *str));
+static void store_op(ARGIN(op_info_t *info), ARGMOD(HOP *p), ARGIN(const char *name));
+
+/* XXX on changing interpreters, this should be called,
+   through a hook */
+
+static void hop_deinit(PARROT_INTERP);
+
+/*
+ * find a short or full opcode
+ * usage:
+ *
+ * interp->op_lib->op_code("set", 0)
+ * interp->op_lib->op_code("set_i_i", 1)
+ *
+ * returns >= 0 (found idx into info_table), -1 if not
+ */
+
+PARROT_PURE_FUNCTION
+static
+size_t hash_str(ARGIN(const char *str))
+{
+    size_t      key = 0;
+    const char *s   = str;
+
+    while (*s) {
+        key *= 65599;
+        key += *s++;
+    }
+
+    return key;
+}
+
+
+static void store_op(ARGIN(op_info_t *info), ARGMOD(HOP *p), ARGIN(const char *name))
+{
+    const size_t hidx = hash_str(name) % OP_HASH_SIZE;
+
+    p->info           = info;
+    p->next           = hop[hidx];
+    hop[hidx]         = p;
+}
+
+static int get_op(PARROT_INTERP, ARGIN(const char *name), int full)
+{
+    const HOP   *p;
+    const size_t hidx = hash_str(name) % OP_HASH_SIZE;
+
+    if (!hop) {
+        hop = mem_gc_allocate_n_zeroed_typed(interp, OP_HASH_SIZE,HOP *);
+        hop_init(interp);
+    }
+
+    for (p = hop[hidx]; p; p = p->next) {
+        if (STREQ(name, full ? p->info->full_name : p->info->name))
+            return p->info - io_op_lib.op_info_table;
+    }
+
+    return -1;
+}
+
+
+static void hop_init(PARROT_INTERP)
+{
+    op_info_t * const info = io_op_lib.op_info_table;
+    opcode_t i;
+
+    /* allocate the storage all in one chunk
+     * yes, this is profligate, but we can tighten it later */
+    HOP *hops;
+
+    hop_buckets = mem_gc_allocate_n_zeroed_typed(interp, io_op_lib.op_count * 2, HOP );
+    hops        = hop_buckets;
+
+
+    /* store full names */
+    for (i = 0; i < io_op_lib.op_count; i++) {
+        store_op(info + i, hops++, info[i].full_name);
+
+        /* plus one short name */
+        if (i && info[i - 1].name != info[i].name)
+            store_op(info + i, hops++, info[i].name);
+    }
+}
+
+static void hop_deinit(PARROT_INTERP)
+{
+    if (hop)
+        mem_sys_free(hop);
+    if (hop_buckets)
+        mem_gc_free(interp, hop_buckets);
+
+    hop         = NULL;
+    hop_buckets = NULL;
+}
+
+op_lib_t *
+PARROT_DYNOP_IO_INIT(PARROT_INTERP, long init) {
+    /* initialize and return op_lib ptr */
+    if (init == 1) {
+
+        return &io_op_lib;
+    }
+    /* set op_lib to the passed ptr (in init) */
+    else if (init) {
+
+    }
+    /* deinit - free resources */
+    else {
+        hop_deinit(interp);
+    }
+    return NULL;
+}
+
+
+/*
+ * dynamic lib load function - called once
+ */
+PARROT_DYNEXT_EXPORT PMC*
+Parrot_lib_io_ops_load(PARROT_INTERP);
+
+PARROT_DYNEXT_EXPORT PMC*
+Parrot_lib_io_ops_load(PARROT_INTERP)
+
+{
+    PMC *const lib = Parrot_pmc_new(interp, enum_class_ParrotLibrary);
+    ((Parrot_ParrotLibrary_attributes*)PMC_data(lib))->oplib_init = (void *) PARROT_DYNOP_IO_INIT;
+    dynop_register(interp, lib);
+    return lib;
+}
+
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ *   buffer-read-only: t
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
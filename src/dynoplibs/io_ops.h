@@ -0,0 +1,85 @@
+
+#ifndef PARROT_SRC_DYNOPLIBS_IO_OPS_H_GUARD
+#define PARROT_SRC_DYNOPLIBS_IO_OPS_H_GUARD
+
+/* ex: set ro:
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from 'src/dynoplibs/io.ops' (and possibly other
+ * .ops files). by ops2c.nqp.
+ *
+ * Any changes made here will be lost!  To regenerate this file after making
+ * changes to any ops, use the bootstrap-ops makefile target.
+ *
+ */
+#define PARROT_IN_EXTENSION
+
+#include "parrot/parrot.h"
+#include "parrot/oplib.h"
+#include "parrot/runcore_api.h"
+
+
+op_lib_t *PARROT_DYNOP_IO_INIT(PARROT_INTERP, long init);
+
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_stat_i_s_i(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_stat_i_sc_i(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_stat_i_s_ic(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_stat_i_sc_ic(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_read_s_i(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_read_s_ic(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_read_s_p_i(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_read_s_p_ic(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_readline_s_p(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_printerr_i(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_printerr_ic(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_printerr_n(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_printerr_nc(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_printerr_s(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_printerr_sc(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_printerr_p(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_seek_p_i_i(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_seek_p_ic_i(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_seek_p_i_ic(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_seek_p_ic_ic(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_seek_p_i_i_i(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_seek_p_ic_i_i(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_seek_p_i_ic_i(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_seek_p_ic_ic_i(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_seek_p_i_i_ic(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_seek_p_ic_i_ic(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_seek_p_i_ic_ic(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_seek_p_ic_ic_ic(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_tell_i_p(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_tell_i_i_p(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_peek_s(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_peek_s_p(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_open_p_s_s(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_open_p_sc_s(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_open_p_s_sc(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_open_p_sc_sc(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_open_p_s(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_open_p_sc(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_close_p(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_fdopen_p_i_s(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_fdopen_p_ic_s(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_fdopen_p_i_sc(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_fdopen_p_ic_sc(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_setstdin_p(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_setstdout_p(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_setstderr_p(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_freeze_to_p_p(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_freeze_to_p_p_i(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_freeze_to_p_p_ic(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_thaw_from_p_p(opcode_t *, PARROT_INTERP);
+
+
+#endif /* PARROT_SRC_DYNOPLIBS_IO_OPS_H_GUARD */
+
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ *   buffer-read-only: t
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
@@ -0,0 +1,922 @@
+/* ex: set ro:
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from 'src/dynoplibs/math.ops' (and possibly other
+ * .ops files). by ops2c.nqp.
+ *
+ * Any changes made here will be lost!  To regenerate this file after making
+ * changes to any ops, use the bootstrap-ops makefile target.
+ *
+ */
+#define PARROT_IN_EXTENSION
+
+#include "math_ops.h"
+#include "parrot/pbcversion.h"
+#include "pmc/pmc_parrotlibrary.h"
+#include "pmc/pmc_callcontext.h"
+
+
+/* defines - Ops::Trans::C */
+#define REL_PC     ((size_t)(cur_opcode - (opcode_t *)interp->code->base.data))
+#define CUR_OPCODE cur_opcode
+#define IREG(i) REG_INT(interp, cur_opcode[i])
+#define NREG(i) REG_NUM(interp, cur_opcode[i])
+#define PREG(i) REG_PMC(interp, cur_opcode[i])
+#define SREG(i) REG_STR(interp, cur_opcode[i])
+#define ICONST(i) cur_opcode[i]
+#define NCONST(i) Parrot_pcc_get_num_constants(interp, interp->ctx)[cur_opcode[i]]
+#define SCONST(i) Parrot_pcc_get_str_constants(interp, interp->ctx)[cur_opcode[i]]
+#undef  PCONST
+#define PCONST(i) Parrot_pcc_get_pmc_constants(interp, interp->ctx)[cur_opcode[i]]
+
+static int get_op(PARROT_INTERP, const char * name, int full);
+
+
+/* XXX should be static, but C++ doesn't want to play ball */
+extern op_lib_t math_op_lib;
+
+
+
+#include <math.h>
+
+
+
+INTVAL math_numops = 32;
+
+/*
+** Op Function Table:
+*/
+
+static op_func_t math_op_func_table[32] = {
+  Parrot_cmod_i_i_i,                                 /*      0 */
+  Parrot_cmod_i_ic_i,                                /*      1 */
+  Parrot_cmod_i_i_ic,                                /*      2 */
+  Parrot_cmod_i_ic_ic,                               /*      3 */
+  Parrot_cmod_p_p_i,                                 /*      4 */
+  Parrot_cmod_p_p_ic,                                /*      5 */
+  Parrot_cmod_p_p_p,                                 /*      6 */
+  Parrot_cmod_n_n_n,                                 /*      7 */
+  Parrot_cmod_n_nc_n,                                /*      8 */
+  Parrot_cmod_n_n_nc,                                /*      9 */
+  Parrot_cmod_n_nc_nc,                               /*     10 */
+  Parrot_cmod_p_p_n,                                 /*     11 */
+  Parrot_cmod_p_p_nc,                                /*     12 */
+  Parrot_rand_n,                                     /*     13 */
+  Parrot_rand_i,                                     /*     14 */
+  Parrot_rand_n_n,                                   /*     15 */
+  Parrot_rand_n_nc,                                  /*     16 */
+  Parrot_rand_i_i,                                   /*     17 */
+  Parrot_rand_i_ic,                                  /*     18 */
+  Parrot_rand_n_n_n,                                 /*     19 */
+  Parrot_rand_n_nc_n,                                /*     20 */
+  Parrot_rand_n_n_nc,                                /*     21 */
+  Parrot_rand_n_nc_nc,                               /*     22 */
+  Parrot_srand_n,                                    /*     23 */
+  Parrot_srand_nc,                                   /*     24 */
+  Parrot_srand_i,                                    /*     25 */
+  Parrot_srand_ic,                                   /*     26 */
+  Parrot_rand_i_i_i,                                 /*     27 */
+  Parrot_rand_i_ic_i,                                /*     28 */
+  Parrot_rand_i_i_ic,                                /*     29 */
+  Parrot_rand_i_ic_ic,                               /*     30 */
+
+  NULL /* NULL function pointer */
+};
+
+
+
+/*
+** Op Info Table:
+*/
+
+static op_info_t math_op_info_table[32] = {
+  { /* 0 */
+    "cmod",
+    "cmod_i_i_i",
+    "Parrot_cmod_i_i_i",
+    0,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &math_op_lib
+  },
+  { /* 1 */
+    "cmod",
+    "cmod_i_ic_i",
+    "Parrot_cmod_i_ic_i",
+    0,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_IC, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &math_op_lib
+  },
+  { /* 2 */
+    "cmod",
+    "cmod_i_i_ic",
+    "Parrot_cmod_i_i_ic",
+    0,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &math_op_lib
+  },
+  { /* 3 */
+    "cmod",
+    "cmod_i_ic_ic",
+    "Parrot_cmod_i_ic_ic",
+    0,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &math_op_lib
+  },
+  { /* 4 */
+    "cmod",
+    "cmod_p_p_i",
+    "Parrot_cmod_p_p_i",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_I },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &math_op_lib
+  },
+  { /* 5 */
+    "cmod",
+    "cmod_p_p_ic",
+    "Parrot_cmod_p_p_ic",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &math_op_lib
+  },
+  { /* 6 */
+    "cmod",
+    "cmod_p_p_p",
+    "Parrot_cmod_p_p_p",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_P },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &math_op_lib
+  },
+  { /* 7 */
+    "cmod",
+    "cmod_n_n_n",
+    "Parrot_cmod_n_n_n",
+    0,
+    4,
+    { PARROT_ARG_N, PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &math_op_lib
+  },
+  { /* 8 */
+    "cmod",
+    "cmod_n_nc_n",
+    "Parrot_cmod_n_nc_n",
+    0,
+    4,
+    { PARROT_ARG_N, PARROT_ARG_NC, PARROT_ARG_N },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &math_op_lib
+  },
+  { /* 9 */
+    "cmod",
+    "cmod_n_n_nc",
+    "Parrot_cmod_n_n_nc",
+    0,
+    4,
+    { PARROT_ARG_N, PARROT_ARG_N, PARROT_ARG_NC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &math_op_lib
+  },
+  { /* 10 */
+    "cmod",
+    "cmod_n_nc_nc",
+    "Parrot_cmod_n_nc_nc",
+    0,
+    4,
+    { PARROT_ARG_N, PARROT_ARG_NC, PARROT_ARG_NC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &math_op_lib
+  },
+  { /* 11 */
+    "cmod",
+    "cmod_p_p_n",
+    "Parrot_cmod_p_p_n",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_N },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &math_op_lib
+  },
+  { /* 12 */
+    "cmod",
+    "cmod_p_p_nc",
+    "Parrot_cmod_p_p_nc",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_NC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &math_op_lib
+  },
+  { /* 13 */
+    "rand",
+    "rand_n",
+    "Parrot_rand_n",
+    0,
+    2,
+    { PARROT_ARG_N },
+    { PARROT_ARGDIR_OUT },
+    { 0 },
+    &math_op_lib
+  },
+  { /* 14 */
+    "rand",
+    "rand_i",
+    "Parrot_rand_i",
+    0,
+    2,
+    { PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT },
+    { 0 },
+    &math_op_lib
+  },
+  { /* 15 */
+    "rand",
+    "rand_n_n",
+    "Parrot_rand_n_n",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &math_op_lib
+  },
+  { /* 16 */
+    "rand",
+    "rand_n_nc",
+    "Parrot_rand_n_nc",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_NC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &math_op_lib
+  },
+  { /* 17 */
+    "rand",
+    "rand_i_i",
+    "Parrot_rand_i_i",
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &math_op_lib
+  },
+  { /* 18 */
+    "rand",
+    "rand_i_ic",
+    "Parrot_rand_i_ic",
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &math_op_lib
+  },
+  { /* 19 */
+    "rand",
+    "rand_n_n_n",
+    "Parrot_rand_n_n_n",
+    0,
+    4,
+    { PARROT_ARG_N, PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &math_op_lib
+  },
+  { /* 20 */
+    "rand",
+    "rand_n_nc_n",
+    "Parrot_rand_n_nc_n",
+    0,
+    4,
+    { PARROT_ARG_N, PARROT_ARG_NC, PARROT_ARG_N },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &math_op_lib
+  },
+  { /* 21 */
+    "rand",
+    "rand_n_n_nc",
+    "Parrot_rand_n_n_nc",
+    0,
+    4,
+    { PARROT_ARG_N, PARROT_ARG_N, PARROT_ARG_NC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &math_op_lib
+  },
+  { /* 22 */
+    "rand",
+    "rand_n_nc_nc",
+    "Parrot_rand_n_nc_nc",
+    0,
+    4,
+    { PARROT_ARG_N, PARROT_ARG_NC, PARROT_ARG_NC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &math_op_lib
+  },
+  { /* 23 */
+    "srand",
+    "srand_n",
+    "Parrot_srand_n",
+    0,
+    2,
+    { PARROT_ARG_N },
+    { PARROT_ARGDIR_IN },
+    { 0 },
+    &math_op_lib
+  },
+  { /* 24 */
+    "srand",
+    "srand_nc",
+    "Parrot_srand_nc",
+    0,
+    2,
+    { PARROT_ARG_NC },
+    { PARROT_ARGDIR_IN },
+    { 0 },
+    &math_op_lib
+  },
+  { /* 25 */
+    "srand",
+    "srand_i",
+    "Parrot_srand_i",
+    0,
+    2,
+    { PARROT_ARG_I },
+    { PARROT_ARGDIR_IN },
+    { 0 },
+    &math_op_lib
+  },
+  { /* 26 */
+    "srand",
+    "srand_ic",
+    "Parrot_srand_ic",
+    0,
+    2,
+    { PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN },
+    { 0 },
+    &math_op_lib
+  },
+  { /* 27 */
+    "rand",
+    "rand_i_i_i",
+    "Parrot_rand_i_i_i",
+    0,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &math_op_lib
+  },
+  { /* 28 */
+    "rand",
+    "rand_i_ic_i",
+    "Parrot_rand_i_ic_i",
+    0,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_IC, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &math_op_lib
+  },
+  { /* 29 */
+    "rand",
+    "rand_i_i_ic",
+    "Parrot_rand_i_i_ic",
+    0,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &math_op_lib
+  },
+  { /* 30 */
+    "rand",
+    "rand_i_ic_ic",
+    "Parrot_rand_i_ic_ic",
+    0,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &math_op_lib
+  },
+
+};
+
+
+/*
+** Op Function Definitions:
+*/
+
+opcode_t *
+Parrot_cmod_i_i_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    const INTVAL   den = IREG(3);
+
+    if ((IREG(3) == 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        return (opcode_t *)handler;
+    }
+
+    IREG(1) = (IREG(2) % den);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_cmod_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    const INTVAL   den = IREG(3);
+
+    if ((IREG(3) == 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        return (opcode_t *)handler;
+    }
+
+    IREG(1) = (ICONST(2) % den);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_cmod_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    const INTVAL   den = ICONST(3);
+
+    if ((ICONST(3) == 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        return (opcode_t *)handler;
+    }
+
+    IREG(1) = (IREG(2) % den);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_cmod_i_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    const INTVAL   den = ICONST(3);
+
+    if ((ICONST(3) == 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        return (opcode_t *)handler;
+    }
+
+    IREG(1) = (ICONST(2) % den);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_cmod_p_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    INTVAL   result;
+
+    if ((IREG(3) == 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        return (opcode_t *)handler;
+    }
+
+    result = (VTABLE_get_integer(interp, PREG(2)) % IREG(3));
+    PREG(1) = Parrot_pmc_new_init_int(interp, VTABLE_type(interp, PREG(2)), result);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_cmod_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    INTVAL   result;
+
+    if ((ICONST(3) == 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        return (opcode_t *)handler;
+    }
+
+    result = (VTABLE_get_integer(interp, PREG(2)) % ICONST(3));
+    PREG(1) = Parrot_pmc_new_init_int(interp, VTABLE_type(interp, PREG(2)), result);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_cmod_p_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    INTVAL   result;
+    const INTVAL   value = VTABLE_get_integer(interp, PREG(3));
+
+    if ((value == 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        return (opcode_t *)handler;
+    }
+
+    result = (VTABLE_get_integer(interp, PREG(2)) % value);
+    PREG(1) = Parrot_pmc_new_init_int(interp, VTABLE_type(interp, PREG(2)), result);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_cmod_n_n_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    const FLOATVAL   den = NREG(3);
+
+    if (FLOAT_IS_ZERO(NREG(3))) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        return (opcode_t *)handler;
+    }
+
+    NREG(1) = fmod(NREG(2), den);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_cmod_n_nc_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    const FLOATVAL   den = NREG(3);
+
+    if (FLOAT_IS_ZERO(NREG(3))) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        return (opcode_t *)handler;
+    }
+
+    NREG(1) = fmod(NCONST(2), den);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_cmod_n_n_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    const FLOATVAL   den = NCONST(3);
+
+    if (FLOAT_IS_ZERO(NCONST(3))) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        return (opcode_t *)handler;
+    }
+
+    NREG(1) = fmod(NREG(2), den);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_cmod_n_nc_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    const FLOATVAL   den = NCONST(3);
+
+    if (FLOAT_IS_ZERO(NCONST(3))) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        return (opcode_t *)handler;
+    }
+
+    NREG(1) = fmod(NCONST(2), den);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_cmod_p_p_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    FLOATVAL   result;
+    const FLOATVAL   value = NREG(3);
+
+    if (FLOAT_IS_ZERO(value)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        return (opcode_t *)handler;
+    }
+
+    result = fmod(VTABLE_get_integer(interp, PREG(2)), value);
+    PREG(1) = Parrot_pmc_new_init_int(interp, VTABLE_type(interp, PREG(2)), (INTVAL)result);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_cmod_p_p_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    FLOATVAL   result;
+    const FLOATVAL   value = NCONST(3);
+
+    if (FLOAT_IS_ZERO(value)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        return (opcode_t *)handler;
+    }
+
+    result = fmod(VTABLE_get_integer(interp, PREG(2)), value);
+    PREG(1) = Parrot_pmc_new_init_int(interp, VTABLE_type(interp, PREG(2)), (INTVAL)result);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_rand_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = Parrot_util_float_rand(0);
+    return cur_opcode + 2;
+}
+
+opcode_t *
+Parrot_rand_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_util_int_rand(0);
+    return cur_opcode + 2;
+}
+
+opcode_t *
+Parrot_rand_n_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = (NREG(2) * Parrot_util_float_rand(0));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_rand_n_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = (NCONST(2) * Parrot_util_float_rand(0));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_rand_i_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_util_range_rand(0, IREG(2), 0);
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_rand_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_util_range_rand(0, ICONST(2), 0);
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_rand_n_n_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = (NREG(2) + (((NREG(3) - NREG(2))) * Parrot_util_float_rand(0)));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_rand_n_nc_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = (NCONST(2) + (((NREG(3) - NCONST(2))) * Parrot_util_float_rand(0)));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_rand_n_n_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = (NREG(2) + (((NCONST(3) - NREG(2))) * Parrot_util_float_rand(0)));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_rand_n_nc_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = (NCONST(2) + (((NCONST(3) - NCONST(2))) * Parrot_util_float_rand(0)));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_srand_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_util_srand((INTVAL)NREG(1));
+    return cur_opcode + 2;
+}
+
+opcode_t *
+Parrot_srand_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_util_srand((INTVAL)NCONST(1));
+    return cur_opcode + 2;
+}
+
+opcode_t *
+Parrot_srand_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_util_srand((INTVAL)IREG(1));
+    return cur_opcode + 2;
+}
+
+opcode_t *
+Parrot_srand_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_util_srand((INTVAL)ICONST(1));
+    return cur_opcode + 2;
+}
+
+opcode_t *
+Parrot_rand_i_i_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_util_range_rand(IREG(2), IREG(3), 0);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_rand_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_util_range_rand(ICONST(2), IREG(3), 0);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_rand_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_util_range_rand(IREG(2), ICONST(3), 0);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_rand_i_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_util_range_rand(ICONST(2), ICONST(3), 0);
+    return cur_opcode + 4;
+}
+
+
+/*
+** op lib descriptor:
+*/
+
+/* XXX should be static, but C++ doesn't want to play ball */
+op_lib_t math_op_lib = {
+  "math_ops",                /* name */
+  "",                  /* suffix */
+  PARROT_FUNCTION_CORE,                       /* core_type = PARROT_XX_CORE */
+  0,                                /* flags */
+  PARROT_PBC_MAJOR,
+  PARROT_PBC_MINOR,
+  31,             /* op_count */
+  math_op_info_table,       /* op_info_table */
+  math_op_func_table,       /* op_func_table */
+  get_op          /* op_code() */ 
+};
+
+/*
+** Op lookup function:
+*/
+
+#define OP_HASH_SIZE 3041
+
+/* we could calculate a prime somewhat bigger than
+ * n of fullnames + n of names
+ * for now this should be ok
+ *
+ * look up an op_code: at first call to op_code() a hash
+ * of short and full opcode names is created
+ * hash functions are from imcc, thanks to Melvin.
+ */
+
+
+typedef struct hop {
+    op_info_t * info;
+    struct hop *next;
+} HOP;
+
+static HOP *hop_buckets;
+static HOP **hop;
+
+static void hop_init(PARROT_INTERP);
+static size_t hash_str(ARGIN(const char *str));
+static void store_op(ARGIN(op_info_t *info), ARGMOD(HOP *p), ARGIN(const char *name));
+
+/* XXX on changing interpreters, this should be called,
+   through a hook */
+
+static void hop_deinit(PARROT_INTERP);
+
+/*
+ * find a short or full opcode
+ * usage:
+ *
+ * interp->op_lib->op_code("set", 0)
+ * interp->op_lib->op_code("set_i_i", 1)
+ *
+ * returns >= 0 (found idx into info_table), -1 if not
+ */
+
+PARROT_PURE_FUNCTION
+static
+size_t hash_str(ARGIN(const char *str))
+{
+    size_t      key = 0;
+    const char *s   = str;
+
+    while (*s) {
+        key *= 65599;
+        key += *s++;
+    }
+
+    return key;
+}
+
+
+static void store_op(ARGIN(op_info_t *info), ARGMOD(HOP *p), ARGIN(const char *name))
+{
+    const size_t hidx = hash_str(name) % OP_HASH_SIZE;
+
+    p->info           = info;
+    p->next           = hop[hidx];
+    hop[hidx]         = p;
+}
+
+static int get_op(PARROT_INTERP, ARGIN(const char *name), int full)
+{
+    const HOP   *p;
+    const size_t hidx = hash_str(name) % OP_HASH_SIZE;
+
+    if (!hop) {
+        hop = mem_gc_allocate_n_zeroed_typed(interp, OP_HASH_SIZE,HOP *);
+        hop_init(interp);
+    }
+
+    for (p = hop[hidx]; p; p = p->next) {
+        if (STREQ(name, full ? p->info->full_name : p->info->name))
+            return p->info - math_op_lib.op_info_table;
+    }
+
+    return -1;
+}
+
+
+static void hop_init(PARROT_INTERP)
+{
+    op_info_t * const info = math_op_lib.op_info_table;
+    opcode_t i;
+
+    /* allocate the storage all in one chunk
+     * yes, this is profligate, but we can tighten it later */
+    HOP *hops;
+
+    hop_buckets = mem_gc_allocate_n_zeroed_typed(interp, math_op_lib.op_count * 2, HOP );
+    hops        = hop_buckets;
+
+
+    /* store full names */
+    for (i = 0; i < math_op_lib.op_count; i++) {
+        store_op(info + i, hops++, info[i].full_name);
+
+        /* plus one short name */
+        if (i && info[i - 1].name != info[i].name)
+            store_op(info + i, hops++, info[i].name);
+    }
+}
+
+static void hop_deinit(PARROT_INTERP)
+{
+    if (hop)
+        mem_sys_free(hop);
+    if (hop_buckets)
+        mem_gc_free(interp, hop_buckets);
+
+    hop         = NULL;
+    hop_buckets = NULL;
+}
+
+op_lib_t *
+PARROT_DYNOP_MATH_INIT(PARROT_INTERP, long init) {
+    /* initialize and return op_lib ptr */
+    if (init == 1) {
+
+        return &math_op_lib;
+    }
+    /* set op_lib to the passed ptr (in init) */
+    else if (init) {
+
+    }
+    /* deinit - free resources */
+    else {
+        hop_deinit(interp);
+    }
+    return NULL;
+}
+
+
+/*
+ * dynamic lib load function - called once
+ */
+PARROT_DYNEXT_EXPORT PMC*
+Parrot_lib_math_ops_load(PARROT_INTERP);
+
+PARROT_DYNEXT_EXPORT PMC*
+Parrot_lib_math_ops_load(PARROT_INTERP)
+
+{
+    PMC *const lib = Parrot_pmc_new(interp, enum_class_ParrotLibrary);
+    ((Parrot_ParrotLibrary_attributes*)PMC_data(lib))->oplib_init = (void *) PARROT_DYNOP_MATH_INIT;
+    dynop_register(interp, lib);
+    return lib;
+}
+
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ *   buffer-read-only: t
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
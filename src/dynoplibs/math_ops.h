@@ -0,0 +1,66 @@
+
+#ifndef PARROT_SRC_DYNOPLIBS_MATH_OPS_H_GUARD
+#define PARROT_SRC_DYNOPLIBS_MATH_OPS_H_GUARD
+
+/* ex: set ro:
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from 'src/dynoplibs/math.ops' (and possibly other
+ * .ops files). by ops2c.nqp.
+ *
+ * Any changes made here will be lost!  To regenerate this file after making
+ * changes to any ops, use the bootstrap-ops makefile target.
+ *
+ */
+#define PARROT_IN_EXTENSION
+
+#include "parrot/parrot.h"
+#include "parrot/oplib.h"
+#include "parrot/runcore_api.h"
+
+
+op_lib_t *PARROT_DYNOP_MATH_INIT(PARROT_INTERP, long init);
+
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_cmod_i_i_i(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_cmod_i_ic_i(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_cmod_i_i_ic(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_cmod_i_ic_ic(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_cmod_p_p_i(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_cmod_p_p_ic(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_cmod_p_p_p(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_cmod_n_n_n(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_cmod_n_nc_n(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_cmod_n_n_nc(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_cmod_n_nc_nc(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_cmod_p_p_n(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_cmod_p_p_nc(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_rand_n(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_rand_i(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_rand_n_n(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_rand_n_nc(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_rand_i_i(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_rand_i_ic(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_rand_n_n_n(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_rand_n_nc_n(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_rand_n_n_nc(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_rand_n_nc_nc(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_srand_n(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_srand_nc(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_srand_i(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_srand_ic(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_rand_i_i_i(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_rand_i_ic_i(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_rand_i_i_ic(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_rand_i_ic_ic(opcode_t *, PARROT_INTERP);
+
+
+#endif /* PARROT_SRC_DYNOPLIBS_MATH_OPS_H_GUARD */
+
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ *   buffer-read-only: t
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
@@ -0,0 +1,980 @@
+/* ex: set ro:
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from 'src/dynoplibs/obscure.ops' (and possibly other
+ * .ops files). by ops2c.nqp.
+ *
+ * Any changes made here will be lost!  To regenerate this file after making
+ * changes to any ops, use the bootstrap-ops makefile target.
+ *
+ */
+#define PARROT_IN_EXTENSION
+
+#include "obscure_ops.h"
+#include "parrot/pbcversion.h"
+#include "pmc/pmc_parrotlibrary.h"
+#include "pmc/pmc_callcontext.h"
+
+
+/* defines - Ops::Trans::C */
+#define REL_PC     ((size_t)(cur_opcode - (opcode_t *)interp->code->base.data))
+#define CUR_OPCODE cur_opcode
+#define IREG(i) REG_INT(interp, cur_opcode[i])
+#define NREG(i) REG_NUM(interp, cur_opcode[i])
+#define PREG(i) REG_PMC(interp, cur_opcode[i])
+#define SREG(i) REG_STR(interp, cur_opcode[i])
+#define ICONST(i) cur_opcode[i]
+#define NCONST(i) Parrot_pcc_get_num_constants(interp, interp->ctx)[cur_opcode[i]]
+#define SCONST(i) Parrot_pcc_get_str_constants(interp, interp->ctx)[cur_opcode[i]]
+#undef  PCONST
+#define PCONST(i) Parrot_pcc_get_pmc_constants(interp, interp->ctx)[cur_opcode[i]]
+
+static int get_op(PARROT_INTERP, const char * name, int full);
+
+
+/* XXX should be static, but C++ doesn't want to play ball */
+extern op_lib_t obscure_op_lib;
+
+
+
+#include <math.h>
+
+
+
+INTVAL obscure_numops = 21;
+
+/*
+** Op Function Table:
+*/
+
+static op_func_t obscure_op_func_table[21] = {
+  Parrot_covers_n_n,                                 /*      0 */
+  Parrot_covers_n_nc,                                /*      1 */
+  Parrot_exsec_n_n,                                  /*      2 */
+  Parrot_exsec_n_nc,                                 /*      3 */
+  Parrot_hav_n_n,                                    /*      4 */
+  Parrot_hav_n_nc,                                   /*      5 */
+  Parrot_vers_n_n,                                   /*      6 */
+  Parrot_vers_n_nc,                                  /*      7 */
+  Parrot_gcd_i_i_i,                                  /*      8 */
+  Parrot_gcd_i_ic_i,                                 /*      9 */
+  Parrot_gcd_i_i_ic,                                 /*     10 */
+  Parrot_gcd_i_ic_ic,                                /*     11 */
+  Parrot_lcm_i_i_i,                                  /*     12 */
+  Parrot_lcm_i_ic_i,                                 /*     13 */
+  Parrot_lcm_i_i_ic,                                 /*     14 */
+  Parrot_lcm_i_ic_ic,                                /*     15 */
+  Parrot_fact_i_i,                                   /*     16 */
+  Parrot_fact_i_ic,                                  /*     17 */
+  Parrot_fact_n_i,                                   /*     18 */
+  Parrot_fact_n_ic,                                  /*     19 */
+
+  NULL /* NULL function pointer */
+};
+
+
+
+/*
+** Op Info Table:
+*/
+
+static op_info_t obscure_op_info_table[21] = {
+  { /* 0 */
+    "covers",
+    "covers_n_n",
+    "Parrot_covers_n_n",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &obscure_op_lib
+  },
+  { /* 1 */
+    "covers",
+    "covers_n_nc",
+    "Parrot_covers_n_nc",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_NC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &obscure_op_lib
+  },
+  { /* 2 */
+    "exsec",
+    "exsec_n_n",
+    "Parrot_exsec_n_n",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &obscure_op_lib
+  },
+  { /* 3 */
+    "exsec",
+    "exsec_n_nc",
+    "Parrot_exsec_n_nc",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_NC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &obscure_op_lib
+  },
+  { /* 4 */
+    "hav",
+    "hav_n_n",
+    "Parrot_hav_n_n",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &obscure_op_lib
+  },
+  { /* 5 */
+    "hav",
+    "hav_n_nc",
+    "Parrot_hav_n_nc",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_NC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &obscure_op_lib
+  },
+  { /* 6 */
+    "vers",
+    "vers_n_n",
+    "Parrot_vers_n_n",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &obscure_op_lib
+  },
+  { /* 7 */
+    "vers",
+    "vers_n_nc",
+    "Parrot_vers_n_nc",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_NC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &obscure_op_lib
+  },
+  { /* 8 */
+    "gcd",
+    "gcd_i_i_i",
+    "Parrot_gcd_i_i_i",
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &obscure_op_lib
+  },
+  { /* 9 */
+    "gcd",
+    "gcd_i_ic_i",
+    "Parrot_gcd_i_ic_i",
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_IC, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &obscure_op_lib
+  },
+  { /* 10 */
+    "gcd",
+    "gcd_i_i_ic",
+    "Parrot_gcd_i_i_ic",
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &obscure_op_lib
+  },
+  { /* 11 */
+    "gcd",
+    "gcd_i_ic_ic",
+    "Parrot_gcd_i_ic_ic",
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &obscure_op_lib
+  },
+  { /* 12 */
+    "lcm",
+    "lcm_i_i_i",
+    "Parrot_lcm_i_i_i",
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &obscure_op_lib
+  },
+  { /* 13 */
+    "lcm",
+    "lcm_i_ic_i",
+    "Parrot_lcm_i_ic_i",
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_IC, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &obscure_op_lib
+  },
+  { /* 14 */
+    "lcm",
+    "lcm_i_i_ic",
+    "Parrot_lcm_i_i_ic",
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &obscure_op_lib
+  },
+  { /* 15 */
+    "lcm",
+    "lcm_i_ic_ic",
+    "Parrot_lcm_i_ic_ic",
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &obscure_op_lib
+  },
+  { /* 16 */
+    "fact",
+    "fact_i_i",
+    "Parrot_fact_i_i",
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &obscure_op_lib
+  },
+  { /* 17 */
+    "fact",
+    "fact_i_ic",
+    "Parrot_fact_i_ic",
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &obscure_op_lib
+  },
+  { /* 18 */
+    "fact",
+    "fact_n_i",
+    "Parrot_fact_n_i",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &obscure_op_lib
+  },
+  { /* 19 */
+    "fact",
+    "fact_n_ic",
+    "Parrot_fact_n_ic",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &obscure_op_lib
+  },
+
+};
+
+
+/*
+** Op Function Definitions:
+*/
+
+opcode_t *
+Parrot_covers_n_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = (1.0 - sin(NREG(2)));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_covers_n_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = (1.0 - sin(NCONST(2)));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_exsec_n_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = (((1.0 / cos(NREG(2)))) - 1.0);
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_exsec_n_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = (((1.0 / cos(NCONST(2)))) - 1.0);
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_hav_n_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = (0.5 * ((1.0 - cos(NREG(2)))));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_hav_n_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = (0.5 * ((1.0 - cos(NCONST(2)))));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_vers_n_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = (1.0 - cos(NREG(2)));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_vers_n_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = (1.0 - cos(NCONST(2)));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_gcd_i_i_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    INTVAL   p = 0;
+    INTVAL   a = (IREG(2) < 0) ? (-IREG(2)) : IREG(2);
+    INTVAL   b = (IREG(3) < 0) ? (-IREG(3)) : IREG(3);
+
+    if ((a == 0)) {
+        IREG(1) = b;
+        return cur_opcode + 4;
+    }
+
+    if ((b == 0)) {
+        IREG(1) = a;
+        return cur_opcode + 4;
+    }
+
+    while ((!((((a | b)) & 1)))) {
+        (a >>= 1);
+        (b >>= 1);
+        (p++);
+    }
+
+    while ((a > 0)) {
+        if ((!((a & 1)))) {
+            (a >>= 1);
+        }
+        else {
+            if ((!((b & 1)))) {
+                (b >>= 1);
+            }
+            else {
+                if ((a < b)) {
+                    b = (((b - a)) >> 1);
+                }
+                else {
+                    a = (((a - b)) >> 1);
+                }
+
+            }
+
+        }
+
+    }
+
+    IREG(1) = (b << p);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_gcd_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    INTVAL   p = 0;
+    INTVAL   a = (ICONST(2) < 0) ? (-ICONST(2)) : ICONST(2);
+    INTVAL   b = (IREG(3) < 0) ? (-IREG(3)) : IREG(3);
+
+    if ((a == 0)) {
+        IREG(1) = b;
+        return cur_opcode + 4;
+    }
+
+    if ((b == 0)) {
+        IREG(1) = a;
+        return cur_opcode + 4;
+    }
+
+    while ((!((((a | b)) & 1)))) {
+        (a >>= 1);
+        (b >>= 1);
+        (p++);
+    }
+
+    while ((a > 0)) {
+        if ((!((a & 1)))) {
+            (a >>= 1);
+        }
+        else {
+            if ((!((b & 1)))) {
+                (b >>= 1);
+            }
+            else {
+                if ((a < b)) {
+                    b = (((b - a)) >> 1);
+                }
+                else {
+                    a = (((a - b)) >> 1);
+                }
+
+            }
+
+        }
+
+    }
+
+    IREG(1) = (b << p);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_gcd_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    INTVAL   p = 0;
+    INTVAL   a = (IREG(2) < 0) ? (-IREG(2)) : IREG(2);
+    INTVAL   b = (ICONST(3) < 0) ? (-ICONST(3)) : ICONST(3);
+
+    if ((a == 0)) {
+        IREG(1) = b;
+        return cur_opcode + 4;
+    }
+
+    if ((b == 0)) {
+        IREG(1) = a;
+        return cur_opcode + 4;
+    }
+
+    while ((!((((a | b)) & 1)))) {
+        (a >>= 1);
+        (b >>= 1);
+        (p++);
+    }
+
+    while ((a > 0)) {
+        if ((!((a & 1)))) {
+            (a >>= 1);
+        }
+        else {
+            if ((!((b & 1)))) {
+                (b >>= 1);
+            }
+            else {
+                if ((a < b)) {
+                    b = (((b - a)) >> 1);
+                }
+                else {
+                    a = (((a - b)) >> 1);
+                }
+
+            }
+
+        }
+
+    }
+
+    IREG(1) = (b << p);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_gcd_i_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    INTVAL   p = 0;
+    INTVAL   a = (ICONST(2) < 0) ? (-ICONST(2)) : ICONST(2);
+    INTVAL   b = (ICONST(3) < 0) ? (-ICONST(3)) : ICONST(3);
+
+    if ((a == 0)) {
+        IREG(1) = b;
+        return cur_opcode + 4;
+    }
+
+    if ((b == 0)) {
+        IREG(1) = a;
+        return cur_opcode + 4;
+    }
+
+    while ((!((((a | b)) & 1)))) {
+        (a >>= 1);
+        (b >>= 1);
+        (p++);
+    }
+
+    while ((a > 0)) {
+        if ((!((a & 1)))) {
+            (a >>= 1);
+        }
+        else {
+            if ((!((b & 1)))) {
+                (b >>= 1);
+            }
+            else {
+                if ((a < b)) {
+                    b = (((b - a)) >> 1);
+                }
+                else {
+                    a = (((a - b)) >> 1);
+                }
+
+            }
+
+        }
+
+    }
+
+    IREG(1) = (b << p);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_lcm_i_i_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    INTVAL   gcd = 0;
+    INTVAL   p = 0;
+    INTVAL   a = (IREG(2) < 0) ? (-IREG(2)) : IREG(2);
+    INTVAL   b = (IREG(3) < 0) ? (-IREG(3)) : IREG(3);
+    INTVAL   saved_var1 = a;
+    INTVAL   saved_var2 = b;
+
+    if (((a == 0) || (b == 0))) {
+        IREG(1) = 0;
+        return cur_opcode + 4;
+    }
+
+    while ((!((((a | b)) & 1)))) {
+        (a >>= 1);
+        (b >>= 1);
+        (p++);
+    }
+
+    while ((a > 0)) {
+        if ((!((a & 1)))) {
+            (a >>= 1);
+        }
+        else {
+            if ((!((b & 1)))) {
+                (b >>= 1);
+            }
+            else {
+                if ((a < b)) {
+                    b = (((b - a)) >> 1);
+                }
+                else {
+                    a = (((a - b)) >> 1);
+                }
+
+            }
+
+        }
+
+    }
+
+    gcd = (b << p);
+    (saved_var1 /= gcd);
+    IREG(1) = (saved_var1 * saved_var2);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_lcm_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    INTVAL   gcd = 0;
+    INTVAL   p = 0;
+    INTVAL   a = (ICONST(2) < 0) ? (-ICONST(2)) : ICONST(2);
+    INTVAL   b = (IREG(3) < 0) ? (-IREG(3)) : IREG(3);
+    INTVAL   saved_var1 = a;
+    INTVAL   saved_var2 = b;
+
+    if (((a == 0) || (b == 0))) {
+        IREG(1) = 0;
+        return cur_opcode + 4;
+    }
+
+    while ((!((((a | b)) & 1)))) {
+        (a >>= 1);
+        (b >>= 1);
+        (p++);
+    }
+
+    while ((a > 0)) {
+        if ((!((a & 1)))) {
+            (a >>= 1);
+        }
+        else {
+            if ((!((b & 1)))) {
+                (b >>= 1);
+            }
+            else {
+                if ((a < b)) {
+                    b = (((b - a)) >> 1);
+                }
+                else {
+                    a = (((a - b)) >> 1);
+                }
+
+            }
+
+        }
+
+    }
+
+    gcd = (b << p);
+    (saved_var1 /= gcd);
+    IREG(1) = (saved_var1 * saved_var2);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_lcm_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    INTVAL   gcd = 0;
+    INTVAL   p = 0;
+    INTVAL   a = (IREG(2) < 0) ? (-IREG(2)) : IREG(2);
+    INTVAL   b = (ICONST(3) < 0) ? (-ICONST(3)) : ICONST(3);
+    INTVAL   saved_var1 = a;
+    INTVAL   saved_var2 = b;
+
+    if (((a == 0) || (b == 0))) {
+        IREG(1) = 0;
+        return cur_opcode + 4;
+    }
+
+    while ((!((((a | b)) & 1)))) {
+        (a >>= 1);
+        (b >>= 1);
+        (p++);
+    }
+
+    while ((a > 0)) {
+        if ((!((a & 1)))) {
+            (a >>= 1);
+        }
+        else {
+            if ((!((b & 1)))) {
+                (b >>= 1);
+            }
+            else {
+                if ((a < b)) {
+                    b = (((b - a)) >> 1);
+                }
+                else {
+                    a = (((a - b)) >> 1);
+                }
+
+            }
+
+        }
+
+    }
+
+    gcd = (b << p);
+    (saved_var1 /= gcd);
+    IREG(1) = (saved_var1 * saved_var2);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_lcm_i_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    INTVAL   gcd = 0;
+    INTVAL   p = 0;
+    INTVAL   a = (ICONST(2) < 0) ? (-ICONST(2)) : ICONST(2);
+    INTVAL   b = (ICONST(3) < 0) ? (-ICONST(3)) : ICONST(3);
+    INTVAL   saved_var1 = a;
+    INTVAL   saved_var2 = b;
+
+    if (((a == 0) || (b == 0))) {
+        IREG(1) = 0;
+        return cur_opcode + 4;
+    }
+
+    while ((!((((a | b)) & 1)))) {
+        (a >>= 1);
+        (b >>= 1);
+        (p++);
+    }
+
+    while ((a > 0)) {
+        if ((!((a & 1)))) {
+            (a >>= 1);
+        }
+        else {
+            if ((!((b & 1)))) {
+                (b >>= 1);
+            }
+            else {
+                if ((a < b)) {
+                    b = (((b - a)) >> 1);
+                }
+                else {
+                    a = (((a - b)) >> 1);
+                }
+
+            }
+
+        }
+
+    }
+
+    gcd = (b << p);
+    (saved_var1 /= gcd);
+    IREG(1) = (saved_var1 * saved_var2);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_fact_i_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    INTVAL   i = IREG(2);
+    UINTVAL   q = 1;
+
+    while ((i > 0)) {
+        q = (q * i);
+        (i--);
+    }
+
+    IREG(1) = q;
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_fact_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    INTVAL   i = ICONST(2);
+    UINTVAL   q = 1;
+
+    while ((i > 0)) {
+        q = (q * i);
+        (i--);
+    }
+
+    IREG(1) = q;
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_fact_n_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    INTVAL   i = IREG(2);
+    FLOATVAL   q = 1;
+
+    while ((i > 0)) {
+        q = (q * i);
+        (i--);
+    }
+
+    NREG(1) = q;
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_fact_n_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    INTVAL   i = ICONST(2);
+    FLOATVAL   q = 1;
+
+    while ((i > 0)) {
+        q = (q * i);
+        (i--);
+    }
+
+    NREG(1) = q;
+    return cur_opcode + 3;
+}
+
+
+/*
+** op lib descriptor:
+*/
+
+/* XXX should be static, but C++ doesn't want to play ball */
+op_lib_t obscure_op_lib = {
+  "obscure_ops",                /* name */
+  "",                  /* suffix */
+  PARROT_FUNCTION_CORE,                       /* core_type = PARROT_XX_CORE */
+  0,                                /* flags */
+  PARROT_PBC_MAJOR,
+  PARROT_PBC_MINOR,
+  20,             /* op_count */
+  obscure_op_info_table,       /* op_info_table */
+  obscure_op_func_table,       /* op_func_table */
+  get_op          /* op_code() */ 
+};
+
+/*
+** Op lookup function:
+*/
+
+#define OP_HASH_SIZE 3041
+
+/* we could calculate a prime somewhat bigger than
+ * n of fullnames + n of names
+ * for now this should be ok
+ *
+ * look up an op_code: at first call to op_code() a hash
+ * of short and full opcode names is created
+ * hash functions are from imcc, thanks to Melvin.
+ */
+
+
+typedef struct hop {
+    op_info_t * info;
+    struct hop *next;
+} HOP;
+
+static HOP *hop_buckets;
+static HOP **hop;
+
+static void hop_init(PARROT_INTERP);
+static size_t hash_str(ARGIN(const char *str));
+static void store_op(ARGIN(op_info_t *info), ARGMOD(HOP *p), ARGIN(const char *name));
+
+/* XXX on changing interpreters, this should be called,
+   through a hook */
+
+static void hop_deinit(PARROT_INTERP);
+
+/*
+ * find a short or full opcode
+ * usage:
+ *
+ * interp->op_lib->op_code("set", 0)
+ * interp->op_lib->op_code("set_i_i", 1)
+ *
+ * returns >= 0 (found idx into info_table), -1 if not
+ */
+
+PARROT_PURE_FUNCTION
+static
+size_t hash_str(ARGIN(const char *str))
+{
+    size_t      key = 0;
+    const char *s   = str;
+
+    while (*s) {
+        key *= 65599;
+        key += *s++;
+    }
+
+    return key;
+}
+
+
+static void store_op(ARGIN(op_info_t *info), ARGMOD(HOP *p), ARGIN(const char *name))
+{
+    const size_t hidx = hash_str(name) % OP_HASH_SIZE;
+
+    p->info           = info;
+    p->next           = hop[hidx];
+    hop[hidx]         = p;
+}
+
+static int get_op(PARROT_INTERP, ARGIN(const char *name), int full)
+{
+    const HOP   *p;
+    const size_t hidx = hash_str(name) % OP_HASH_SIZE;
+
+    if (!hop) {
+        hop = mem_gc_allocate_n_zeroed_typed(interp, OP_HASH_SIZE,HOP *);
+        hop_init(interp);
+    }
+
+    for (p = hop[hidx]; p; p = p->next) {
+        if (STREQ(name, full ? p->info->full_name : p->info->name))
+            return p->info - obscure_op_lib.op_info_table;
+    }
+
+    return -1;
+}
+
+
+static void hop_init(PARROT_INTERP)
+{
+    op_info_t * const info = obscure_op_lib.op_info_table;
+    opcode_t i;
+
+    /* allocate the storage all in one chunk
+     * yes, this is profligate, but we can tighten it later */
+    HOP *hops;
+
+    hop_buckets = mem_gc_allocate_n_zeroed_typed(interp, obscure_op_lib.op_count * 2, HOP );
+    hops        = hop_buckets;
+
+
+    /* store full names */
+    for (i = 0; i < obscure_op_lib.op_count; i++) {
+        store_op(info + i, hops++, info[i].full_name);
+
+        /* plus one short name */
+        if (i && info[i - 1].name != info[i].name)
+            store_op(info + i, hops++, info[i].name);
+    }
+}
+
+static void hop_deinit(PARROT_INTERP)
+{
+    if (hop)
+        mem_sys_free(hop);
+    if (hop_buckets)
+        mem_gc_free(interp, hop_buckets);
+
+    hop         = NULL;
+    hop_buckets = NULL;
+}
+
+op_lib_t *
+PARROT_DYNOP_OBSCURE_INIT(PARROT_INTERP, long init) {
+    /* initialize and return op_lib ptr */
+    if (init == 1) {
+
+        return &obscure_op_lib;
+    }
+    /* set op_lib to the passed ptr (in init) */
+    else if (init) {
+
+    }
+    /* deinit - free resources */
+    else {
+        hop_deinit(interp);
+    }
+    return NULL;
+}
+
+
+/*
+ * dynamic lib load function - called once
+ */
+PARROT_DYNEXT_EXPORT PMC*
+Parrot_lib_obscure_ops_load(PARROT_INTERP);
+
+PARROT_DYNEXT_EXPORT PMC*
+Parrot_lib_obscure_ops_load(PARROT_INTERP)
+
+{
+    PMC *const lib = Parrot_pmc_new(interp, enum_class_ParrotLibrary);
+    ((Parrot_ParrotLibrary_attributes*)PMC_data(lib))->oplib_init = (void *) PARROT_DYNOP_OBSCURE_INIT;
+    dynop_register(interp, lib);
+    return lib;
+}
+
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ *   buffer-read-only: t
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
@@ -0,0 +1,55 @@
+
+#ifndef PARROT_SRC_DYNOPLIBS_OBSCURE_OPS_H_GUARD
+#define PARROT_SRC_DYNOPLIBS_OBSCURE_OPS_H_GUARD
+
+/* ex: set ro:
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from 'src/dynoplibs/obscure.ops' (and possibly other
+ * .ops files). by ops2c.nqp.
+ *
+ * Any changes made here will be lost!  To regenerate this file after making
+ * changes to any ops, use the bootstrap-ops makefile target.
+ *
+ */
+#define PARROT_IN_EXTENSION
+
+#include "parrot/parrot.h"
+#include "parrot/oplib.h"
+#include "parrot/runcore_api.h"
+
+
+op_lib_t *PARROT_DYNOP_OBSCURE_INIT(PARROT_INTERP, long init);
+
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_covers_n_n(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_covers_n_nc(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_exsec_n_n(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_exsec_n_nc(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_hav_n_n(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_hav_n_nc(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_vers_n_n(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_vers_n_nc(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_gcd_i_i_i(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_gcd_i_ic_i(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_gcd_i_i_ic(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_gcd_i_ic_ic(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_lcm_i_i_i(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_lcm_i_ic_i(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_lcm_i_i_ic(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_lcm_i_ic_ic(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_fact_i_i(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_fact_i_ic(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_fact_n_i(opcode_t *, PARROT_INTERP);
+PARROT_DYNEXT_EXPORT opcode_t * Parrot_fact_n_ic(opcode_t *, PARROT_INTERP);
+
+
+#endif /* PARROT_SRC_DYNOPLIBS_OBSCURE_OPS_H_GUARD */
+
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ *   buffer-read-only: t
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
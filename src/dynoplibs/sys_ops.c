@@ -0,0 +1,640 @@
+/* ex: set ro:
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from 'src/dynoplibs/sys.ops' (and possibly other
+ * .ops files). by ops2c.nqp.
+ *
+ * Any changes made here will be lost!  To regenerate this file after making
+ * changes to any ops, use the bootstrap-ops makefile target.
+ *
+ */
+#define PARROT_IN_EXTENSION
+
+#include "sys_ops.h"
+#include "parrot/pbcversion.h"
+#include "pmc/pmc_parrotlibrary.h"
+#include "pmc/pmc_callcontext.h"
+
+
+/* defines - Ops::Trans::C */
+#define REL_PC     ((size_t)(cur_opcode - (opcode_t *)interp->code->base.data))
+#define CUR_OPCODE cur_opcode
+#define IREG(i) REG_INT(interp, cur_opcode[i])
+#define NREG(i) REG_NUM(interp, cur_opcode[i])
+#define PREG(i) REG_PMC(interp, cur_opcode[i])
+#define SREG(i) REG_STR(interp, cur_opcode[i])
+#define ICONST(i) cur_opcode[i]
+#define NCONST(i) Parrot_pcc_get_num_constants(interp, interp->ctx)[cur_opcode[i]]
+#define SCONST(i) Parrot_pcc_get_str_constants(interp, interp->ctx)[cur_opcode[i]]
+#undef  PCONST
+#define PCONST(i) Parrot_pcc_get_pmc_constants(interp, interp->ctx)[cur_opcode[i]]
+
+static int get_op(PARROT_INTERP, const char * name, int full);
+
+
+/* XXX should be static, but C++ doesn't want to play ball */
+extern op_lib_t sys_op_lib;
+
+
+
+#ifdef PARROT_HAS_HEADER_SYSUTSNAME
+#  include <sys/utsname.h>
+#endif
+
+
+
+INTVAL sys_numops = 13;
+
+/*
+** Op Function Table:
+*/
+
+static op_func_t sys_op_func_table[13] = {
+  Parrot_gmtime_s_i,                                 /*      0 */
+  Parrot_gmtime_s_ic,                                /*      1 */
+  Parrot_localtime_s_i,                              /*      2 */
+  Parrot_localtime_s_ic,                             /*      3 */
+  Parrot_decodetime_p_i,                             /*      4 */
+  Parrot_decodetime_p_ic,                            /*      5 */
+  Parrot_decodelocaltime_p_i,                        /*      6 */
+  Parrot_decodelocaltime_p_ic,                       /*      7 */
+  Parrot_sysinfo_s_i,                                /*      8 */
+  Parrot_sysinfo_s_ic,                               /*      9 */
+  Parrot_sysinfo_i_i,                                /*     10 */
+  Parrot_sysinfo_i_ic,                               /*     11 */
+
+  NULL /* NULL function pointer */
+};
+
+
+
+/*
+** Op Info Table:
+*/
+
+static op_info_t sys_op_info_table[13] = {
+  { /* 0 */
+    "gmtime",
+    "gmtime_s_i",
+    "Parrot_gmtime_s_i",
+    0,
+    3,
+    { PARROT_ARG_S, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &sys_op_lib
+  },
+  { /* 1 */
+    "gmtime",
+    "gmtime_s_ic",
+    "Parrot_gmtime_s_ic",
+    0,
+    3,
+    { PARROT_ARG_S, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &sys_op_lib
+  },
+  { /* 2 */
+    "localtime",
+    "localtime_s_i",
+    "Parrot_localtime_s_i",
+    0,
+    3,
+    { PARROT_ARG_S, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &sys_op_lib
+  },
+  { /* 3 */
+    "localtime",
+    "localtime_s_ic",
+    "Parrot_localtime_s_ic",
+    0,
+    3,
+    { PARROT_ARG_S, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &sys_op_lib
+  },
+  { /* 4 */
+    "decodetime",
+    "decodetime_p_i",
+    "Parrot_decodetime_p_i",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &sys_op_lib
+  },
+  { /* 5 */
+    "decodetime",
+    "decodetime_p_ic",
+    "Parrot_decodetime_p_ic",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &sys_op_lib
+  },
+  { /* 6 */
+    "decodelocaltime",
+    "decodelocaltime_p_i",
+    "Parrot_decodelocaltime_p_i",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &sys_op_lib
+  },
+  { /* 7 */
+    "decodelocaltime",
+    "decodelocaltime_p_ic",
+    "Parrot_decodelocaltime_p_ic",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &sys_op_lib
+  },
+  { /* 8 */
+    "sysinfo",
+    "sysinfo_s_i",
+    "Parrot_sysinfo_s_i",
+    0,
+    3,
+    { PARROT_ARG_S, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &sys_op_lib
+  },
+  { /* 9 */
+    "sysinfo",
+    "sysinfo_s_ic",
+    "Parrot_sysinfo_s_ic",
+    0,
+    3,
+    { PARROT_ARG_S, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &sys_op_lib
+  },
+  { /* 10 */
+    "sysinfo",
+    "sysinfo_i_i",
+    "Parrot_sysinfo_i_i",
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &sys_op_lib
+  },
+  { /* 11 */
+    "sysinfo",
+    "sysinfo_i_ic",
+    "Parrot_sysinfo_i_ic",
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &sys_op_lib
+  },
+
+};
+
+
+/*
+** Op Function Definitions:
+*/
+
+opcode_t *
+Parrot_gmtime_s_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    struct tm   tm;
+    const time_t   t = (time_t)IREG(2);
+    char   resultbuffer[26];
+
+    Parrot_gmtime_r((&t), (&tm));
+    Parrot_asctime_r((&tm), resultbuffer);
+    SREG(1) = Parrot_str_new(interp, resultbuffer, 25);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_gmtime_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    struct tm   tm;
+    const time_t   t = (time_t)ICONST(2);
+    char   resultbuffer[26];
+
+    Parrot_gmtime_r((&t), (&tm));
+    Parrot_asctime_r((&tm), resultbuffer);
+    SREG(1) = Parrot_str_new(interp, resultbuffer, 25);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_localtime_s_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    struct tm   tm;
+    const time_t   t = (time_t)IREG(2);
+    char   resultbuffer[26];
+
+    Parrot_localtime_r((&t), (&tm));
+    Parrot_asctime_r((&tm), resultbuffer);
+    SREG(1) = Parrot_str_new(interp, resultbuffer, 25);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_localtime_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    struct tm   tm;
+    const time_t   t = (time_t)ICONST(2);
+    char   resultbuffer[26];
+
+    Parrot_localtime_r((&t), (&tm));
+    Parrot_asctime_r((&tm), resultbuffer);
+    SREG(1) = Parrot_str_new(interp, resultbuffer, 25);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_decodetime_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    struct tm   tm;
+    const time_t   t = (time_t)IREG(2);
+
+    Parrot_gmtime_r((&t), (&tm));
+    PREG(1) = Parrot_util_tm_to_array(interp, (&tm));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_decodetime_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    struct tm   tm;
+    const time_t   t = (time_t)ICONST(2);
+
+    Parrot_gmtime_r((&t), (&tm));
+    PREG(1) = Parrot_util_tm_to_array(interp, (&tm));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_decodelocaltime_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    struct tm   tm;
+    const time_t   t = (time_t)IREG(2);
+
+    Parrot_localtime_r((&t), (&tm));
+    PREG(1) = Parrot_util_tm_to_array(interp, (&tm));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_decodelocaltime_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    struct tm   tm;
+    const time_t   t = (time_t)ICONST(2);
+
+    Parrot_localtime_r((&t), (&tm));
+    PREG(1) = Parrot_util_tm_to_array(interp, (&tm));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_sysinfo_s_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    switch (IREG(2)) {
+      case PARROT_OS:
+        SREG(1) = Parrot_str_new_constant(interp, BUILD_OS_NAME);
+        break;
+        #if defined(PARROT_HAS_HEADER_SYSUTSNAME)
+      case PARROT_OS_VERSION:
+        {
+            struct utsname   info;
+
+            if ((uname((&info)) == 0)) {
+                SREG(1) = Parrot_str_new_init(interp, info.version, strlen(info.version), Parrot_ascii_encoding_ptr, 0);
+            }
+
+        }
+        break;
+      case PARROT_OS_VERSION_NUMBER:
+        {
+            struct utsname   info;
+
+            if ((uname((&info)) == 0)) {
+                SREG(1) = Parrot_str_new_init(interp, info.release, strlen(info.version), Parrot_ascii_encoding_ptr, 0);
+            }
+
+        }
+        break;
+
+#endif
+;
+      case CPU_ARCH:
+        SREG(1) = Parrot_str_new_init(interp, PARROT_CPU_ARCH, (sizeof(PARROT_CPU_ARCH) - 1), Parrot_ascii_encoding_ptr, 0);
+        break;
+      case CPU_TYPE:
+        SREG(1) = Parrot_str_new_init(interp, PARROT_CPU_TYPE, (sizeof(PARROT_CPU_TYPE) - 1), Parrot_ascii_encoding_ptr, 0);
+        break;
+      default:
+        SREG(1) = string_from_literal(interp, "");
+        break;
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_sysinfo_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    switch (ICONST(2)) {
+      case PARROT_OS:
+        SREG(1) = Parrot_str_new_constant(interp, BUILD_OS_NAME);
+        break;
+        #if defined(PARROT_HAS_HEADER_SYSUTSNAME)
+      case PARROT_OS_VERSION:
+        {
+            struct utsname   info;
+
+            if ((uname((&info)) == 0)) {
+                SREG(1) = Parrot_str_new_init(interp, info.version, strlen(info.version), Parrot_ascii_encoding_ptr, 0);
+            }
+
+        }
+        break;
+      case PARROT_OS_VERSION_NUMBER:
+        {
+            struct utsname   info;
+
+            if ((uname((&info)) == 0)) {
+                SREG(1) = Parrot_str_new_init(interp, info.release, strlen(info.version), Parrot_ascii_encoding_ptr, 0);
+            }
+
+        }
+        break;
+
+#endif
+;
+      case CPU_ARCH:
+        SREG(1) = Parrot_str_new_init(interp, PARROT_CPU_ARCH, (sizeof(PARROT_CPU_ARCH) - 1), Parrot_ascii_encoding_ptr, 0);
+        break;
+      case CPU_TYPE:
+        SREG(1) = Parrot_str_new_init(interp, PARROT_CPU_TYPE, (sizeof(PARROT_CPU_TYPE) - 1), Parrot_ascii_encoding_ptr, 0);
+        break;
+      default:
+        SREG(1) = string_from_literal(interp, "");
+        break;
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_sysinfo_i_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    switch (IREG(2)) {
+      case PARROT_INTSIZE:
+        IREG(1) = sizeof(INTVAL);
+        break;
+      case PARROT_FLOATSIZE:
+        IREG(1) = sizeof(FLOATVAL);
+        break;
+      case PARROT_POINTERSIZE:
+        IREG(1) = sizeof(void *);
+        break;
+      case PARROT_INTMIN:
+        IREG(1) = PARROT_INTVAL_MIN;
+        break;
+      case PARROT_INTMAX:
+        IREG(1) = PARROT_INTVAL_MAX;
+        break;
+      default:
+        IREG(1) = (-1);
+        break;
+
+    }
+
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_sysinfo_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    switch (ICONST(2)) {
+      case PARROT_INTSIZE:
+        IREG(1) = sizeof(INTVAL);
+        break;
+      case PARROT_FLOATSIZE:
+        IREG(1) = sizeof(FLOATVAL);
+        break;
+      case PARROT_POINTERSIZE:
+        IREG(1) = sizeof(void *);
+        break;
+      case PARROT_INTMIN:
+        IREG(1) = PARROT_INTVAL_MIN;
+        break;
+      case PARROT_INTMAX:
+        IREG(1) = PARROT_INTVAL_MAX;
+        break;
+      default:
+        IREG(1) = (-1);
+        break;
+
+    }
+
+    return cur_opcode + 3;
+}
+
+
+/*
+** op lib descriptor:
+*/
+
+/* XXX should be static, but C++ doesn't want to play ball */
+op_lib_t sys_op_lib = {
+  "sys_ops",                /* name */
+  "",                  /* suffix */
+  PARROT_FUNCTION_CORE,                       /* core_type = PARROT_XX_CORE */
+  0,                                /* flags */
+  PARROT_PBC_MAJOR,
+  PARROT_PBC_MINOR,
+  12,             /* op_count */
+  sys_op_info_table,       /* op_info_table */
+  sys_op_func_table,       /* op_func_table */
+  get_op          /* op_code() */ 
+};
+
+/*
+** Op lookup function:
+*/
+
+#define OP_HASH_SIZE 3041
+
+/* we could calculate a prime somewhat bigger than
+ * n of fullnames + n of names
+ * for now this should be ok
+ *
+ * look up an op_code: at first call to op_code() a hash
+ * of short and full opcode names is created
+ * hash functions are from imcc, thanks to Melvin.
+ */
+
+
+typedef struct hop {
+    op_info_t * info;
+    struct hop *next;
+} HOP;
+
+static HOP *hop_buckets;
+static HOP **hop;
+
+static void hop_init(PARROT_INTERP);
+static size_t hash_str(ARGIN(const char *str));
+static void store_op(ARGIN(op_info_t *info), ARGMOD(HOP *p), ARGIN(const char *name));
+
+/* XXX on changing interpreters, this should be called,
+   through a hook */
+
+static void hop_deinit(PARROT_INTERP);
+
+/*
+ * find a short or full opcode
+ * usage:
+ *
+ * interp->op_lib->op_code("set", 0)
+ * interp->op_lib->op_code("set_i_i", 1)
+ *
+ * returns >= 0 (found idx into info_table), -1 if not
+ */
+
+PARROT_PURE_FUNCTION
+static
+size_t hash_str(ARGIN(const char *str))
+{
+    size_t      key = 0;
+    const char *s   = str;
+
+    while (*s) {
+        key *= 65599;
+        key += *s++;
+    }
+
+    return key;
+}
+
+
+static void store_op(ARGIN(op_info_t *info), ARGMOD(HOP *p), ARGIN(const char *name))
+{
+    const size_t hidx = hash_str(name) % OP_HASH_SIZE;
+
+    p->info           = info;
+    p->next           = hop[hidx];
+    hop[hidx]         = p;
+}
+
+static int get_op(PARROT_INTERP, ARGIN(const char *name), int full)
+{
+    const HOP   *p;
+    const size_t hidx = hash_str(name) % OP_HASH_SIZE;
+
+    if (!hop) {
+        hop = mem_gc_allocate_n_zeroed_typed(interp, OP_HASH_SIZE,HOP *);
+        hop_init(interp);
+    }
+
+    for (p = hop[hidx]; p; p = p->next) {
+        if (STREQ(name, full ? p->info->full_name : p->info->name))
+            return p->info - sys_op_lib.op_info_table;
+    }
+
+    return -1;
+}
+
+
+static void hop_init(PARROT_INTERP)
+{
+    op_info_t * const info = sys_op_lib.op_info_table;
+    opcode_t i;
+
+    /* allocate the storage all in one chunk
+     * yes, this is profligate, but we can tighten it later */
+    HOP *hops;
+
+    hop_buckets = mem_gc_allocate_n_zeroed_typed(interp, sys_op_lib.op_count * 2, HOP );
+    hops        = hop_buckets;
+
+
+    /* store full names */
+    for (i = 0; i < sys_op_lib.op_count; i++) {
+        store_op(info + i, hops++, info[i].full_name);
+
+        /* plus one short name */
+        if (i && info[i - 1].name != info[i].name)
+            store_op(info + i, hops++, info[i].name);
+    }
+}
+
+static void hop_deinit(PARROT_INTERP)
+{
+    if (hop)
+        mem_sys_free(hop);
+    if (hop_buckets)
+        mem_gc_free(interp, hop_buckets);
+
+    hop         = NULL;
+    hop_buckets = NULL;
+}
+
+op_lib_t *
+PARROT_DYNOP_SYS_INIT(PARROT_INTERP, long init) {
+    /* initialize and return op_lib ptr */
+    if (init == 1) {
+
+        return &sys_op_lib;
+    }
+    /* set op_lib to the passed ptr (in init) */
+    else if (init) {
+
+    }
+    /* deinit - free resources */
+    else {
+        hop_deinit(interp);
+    }
+    return NULL;
+}
+
+
+/*
+ * dynamic lib load function - called once
+ */
+PARROT_DYNEXT_EXPORT PMC*
+Parrot_lib_sys_ops_load(PARROT_INTERP);
+
+PARROT_DYNEXT_EXPORT PMC*
+Parrot_lib_sys_ops_load(PARROT_INTERP)
+
+{
+    PMC *const lib = Parrot_pmc_new(interp, enum_class_ParrotLibrary);
+    ((Parrot_ParrotLibrary_attributes*)PMC_data(lib))->oplib_init = (void *) PARROT_DYNOP_SYS_INIT;
+    dynop_register(interp, lib);
+    return lib;
+}
+
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ *   buffer-read-only: t
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
@@ -0,0 +1,1435 @@
+/* ex: set ro:
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from 'src/dynoplibs/trans.ops' (and possibly other
+ * .ops files). by ops2c.nqp.
+ *
+ * Any changes made here will be lost!  To regenerate this file after making
+ * changes to any ops, use the bootstrap-ops makefile target.
+ *
+ */
+#define PARROT_IN_EXTENSION
+
+#include "trans_ops.h"
+#include "parrot/pbcversion.h"
+#include "pmc/pmc_parrotlibrary.h"
+#include "pmc/pmc_callcontext.h"
+
+
+/* defines - Ops::Trans::C */
+#define REL_PC     ((size_t)(cur_opcode - (opcode_t *)interp->code->base.data))
+#define CUR_OPCODE cur_opcode
+#define IREG(i) REG_INT(interp, cur_opcode[i])
+#define NREG(i) REG_NUM(interp, cur_opcode[i])
+#define PREG(i) REG_PMC(interp, cur_opcode[i])
+#define SREG(i) REG_STR(interp, cur_opcode[i])
+#define ICONST(i) cur_opcode[i]
+#define NCONST(i) Parrot_pcc_get_num_constants(interp, interp->ctx)[cur_opcode[i]]
+#define SCONST(i) Parrot_pcc_get_str_constants(interp, interp->ctx)[cur_opcode[i]]
+#undef  PCONST
+#define PCONST(i) Parrot_pcc_get_pmc_constants(interp, interp->ctx)[cur_opcode[i]]
+
+static int get_op(PARROT_INTERP, const char * name, int full);
+
+
+/* XXX should be static, but C++ doesn't want to play ball */
+extern op_lib_t trans_op_lib;
+
+
+
+INTVAL trans_numops = 58;
+
+/*
+** Op Function Table:
+*/
+
+static op_func_t trans_op_func_table[58] = {
+  Parrot_acos_n_n,                                   /*      0 */
+  Parrot_acos_n_nc,                                  /*      1 */
+  Parrot_acot_n_n,                                   /*      2 */
+  Parrot_acot_n_nc,                                  /*      3 */
+  Parrot_asec_n_n,                                   /*      4 */
+  Parrot_asec_n_nc,                                  /*      5 */
+  Parrot_asin_n_n,                                   /*      6 */
+  Parrot_asin_n_nc,                                  /*      7 */
+  Parrot_atan_n_n,                                   /*      8 */
+  Parrot_atan_n_nc,                                  /*      9 */
+  Parrot_atan_n_n_n,                                 /*     10 */
+  Parrot_atan_n_nc_n,                                /*     11 */
+  Parrot_atan_n_n_nc,                                /*     12 */
+  Parrot_atan_n_nc_nc,                               /*     13 */
+  Parrot_cos_n_n,                                    /*     14 */
+  Parrot_cos_n_nc,                                   /*     15 */
+  Parrot_cosh_n_n,                                   /*     16 */
+  Parrot_cosh_n_nc,                                  /*     17 */
+  Parrot_cot_n_n,                                    /*     18 */
+  Parrot_cot_n_nc,                                   /*     19 */
+  Parrot_coth_n_n,                                   /*     20 */
+  Parrot_coth_n_nc,                                  /*     21 */
+  Parrot_csc_n_n,                                    /*     22 */
+  Parrot_csc_n_nc,                                   /*     23 */
+  Parrot_exp_n_n,                                    /*     24 */
+  Parrot_exp_n_nc,                                   /*     25 */
+  Parrot_ln_n_n,                                     /*     26 */
+  Parrot_ln_n_nc,                                    /*     27 */
+  Parrot_log10_n_n,                                  /*     28 */
+  Parrot_log10_n_nc,                                 /*     29 */
+  Parrot_log2_n_n,                                   /*     30 */
+  Parrot_log2_n_nc,                                  /*     31 */
+  Parrot_sec_n_n,                                    /*     32 */
+  Parrot_sec_n_nc,                                   /*     33 */
+  Parrot_sech_n_n,                                   /*     34 */
+  Parrot_sech_n_nc,                                  /*     35 */
+  Parrot_sin_n_n,                                    /*     36 */
+  Parrot_sin_n_nc,                                   /*     37 */
+  Parrot_sinh_n_n,                                   /*     38 */
+  Parrot_sinh_n_nc,                                  /*     39 */
+  Parrot_tan_n_n,                                    /*     40 */
+  Parrot_tan_n_nc,                                   /*     41 */
+  Parrot_tanh_n_n,                                   /*     42 */
+  Parrot_tanh_n_nc,                                  /*     43 */
+  Parrot_pow_n_n_n,                                  /*     44 */
+  Parrot_pow_n_nc_n,                                 /*     45 */
+  Parrot_pow_n_n_nc,                                 /*     46 */
+  Parrot_pow_n_nc_nc,                                /*     47 */
+  Parrot_pow_p_p_p,                                  /*     48 */
+  Parrot_pow_p_p_i,                                  /*     49 */
+  Parrot_pow_p_p_ic,                                 /*     50 */
+  Parrot_pow_p_p_n,                                  /*     51 */
+  Parrot_pow_p_p_nc,                                 /*     52 */
+  Parrot_pow_n_n_i,                                  /*     53 */
+  Parrot_pow_n_nc_i,                                 /*     54 */
+  Parrot_pow_n_n_ic,                                 /*     55 */
+  Parrot_pow_n_nc_ic,                                /*     56 */
+
+  NULL /* NULL function pointer */
+};
+
+
+
+/*
+** Op Info Table:
+*/
+
+static op_info_t trans_op_info_table[58] = {
+  { /* 0 */
+    "acos",
+    "acos_n_n",
+    "Parrot_acos_n_n",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &trans_op_lib
+  },
+  { /* 1 */
+    "acos",
+    "acos_n_nc",
+    "Parrot_acos_n_nc",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_NC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &trans_op_lib
+  },
+  { /* 2 */
+    "acot",
+    "acot_n_n",
+    "Parrot_acot_n_n",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &trans_op_lib
+  },
+  { /* 3 */
+    "acot",
+    "acot_n_nc",
+    "Parrot_acot_n_nc",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_NC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &trans_op_lib
+  },
+  { /* 4 */
+    "asec",
+    "asec_n_n",
+    "Parrot_asec_n_n",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &trans_op_lib
+  },
+  { /* 5 */
+    "asec",
+    "asec_n_nc",
+    "Parrot_asec_n_nc",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_NC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &trans_op_lib
+  },
+  { /* 6 */
+    "asin",
+    "asin_n_n",
+    "Parrot_asin_n_n",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &trans_op_lib
+  },
+  { /* 7 */
+    "asin",
+    "asin_n_nc",
+    "Parrot_asin_n_nc",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_NC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &trans_op_lib
+  },
+  { /* 8 */
+    "atan",
+    "atan_n_n",
+    "Parrot_atan_n_n",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &trans_op_lib
+  },
+  { /* 9 */
+    "atan",
+    "atan_n_nc",
+    "Parrot_atan_n_nc",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_NC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &trans_op_lib
+  },
+  { /* 10 */
+    "atan",
+    "atan_n_n_n",
+    "Parrot_atan_n_n_n",
+    0,
+    4,
+    { PARROT_ARG_N, PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &trans_op_lib
+  },
+  { /* 11 */
+    "atan",
+    "atan_n_nc_n",
+    "Parrot_atan_n_nc_n",
+    0,
+    4,
+    { PARROT_ARG_N, PARROT_ARG_NC, PARROT_ARG_N },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &trans_op_lib
+  },
+  { /* 12 */
+    "atan",
+    "atan_n_n_nc",
+    "Parrot_atan_n_n_nc",
+    0,
+    4,
+    { PARROT_ARG_N, PARROT_ARG_N, PARROT_ARG_NC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &trans_op_lib
+  },
+  { /* 13 */
+    "atan",
+    "atan_n_nc_nc",
+    "Parrot_atan_n_nc_nc",
+    0,
+    4,
+    { PARROT_ARG_N, PARROT_ARG_NC, PARROT_ARG_NC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &trans_op_lib
+  },
+  { /* 14 */
+    "cos",
+    "cos_n_n",
+    "Parrot_cos_n_n",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &trans_op_lib
+  },
+  { /* 15 */
+    "cos",
+    "cos_n_nc",
+    "Parrot_cos_n_nc",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_NC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &trans_op_lib
+  },
+  { /* 16 */
+    "cosh",
+    "cosh_n_n",
+    "Parrot_cosh_n_n",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &trans_op_lib
+  },
+  { /* 17 */
+    "cosh",
+    "cosh_n_nc",
+    "Parrot_cosh_n_nc",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_NC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &trans_op_lib
+  },
+  { /* 18 */
+    "cot",
+    "cot_n_n",
+    "Parrot_cot_n_n",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &trans_op_lib
+  },
+  { /* 19 */
+    "cot",
+    "cot_n_nc",
+    "Parrot_cot_n_nc",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_NC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &trans_op_lib
+  },
+  { /* 20 */
+    "coth",
+    "coth_n_n",
+    "Parrot_coth_n_n",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &trans_op_lib
+  },
+  { /* 21 */
+    "coth",
+    "coth_n_nc",
+    "Parrot_coth_n_nc",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_NC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &trans_op_lib
+  },
+  { /* 22 */
+    "csc",
+    "csc_n_n",
+    "Parrot_csc_n_n",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &trans_op_lib
+  },
+  { /* 23 */
+    "csc",
+    "csc_n_nc",
+    "Parrot_csc_n_nc",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_NC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &trans_op_lib
+  },
+  { /* 24 */
+    "exp",
+    "exp_n_n",
+    "Parrot_exp_n_n",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &trans_op_lib
+  },
+  { /* 25 */
+    "exp",
+    "exp_n_nc",
+    "Parrot_exp_n_nc",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_NC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &trans_op_lib
+  },
+  { /* 26 */
+    "ln",
+    "ln_n_n",
+    "Parrot_ln_n_n",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &trans_op_lib
+  },
+  { /* 27 */
+    "ln",
+    "ln_n_nc",
+    "Parrot_ln_n_nc",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_NC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &trans_op_lib
+  },
+  { /* 28 */
+    "log10",
+    "log10_n_n",
+    "Parrot_log10_n_n",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &trans_op_lib
+  },
+  { /* 29 */
+    "log10",
+    "log10_n_nc",
+    "Parrot_log10_n_nc",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_NC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &trans_op_lib
+  },
+  { /* 30 */
+    "log2",
+    "log2_n_n",
+    "Parrot_log2_n_n",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &trans_op_lib
+  },
+  { /* 31 */
+    "log2",
+    "log2_n_nc",
+    "Parrot_log2_n_nc",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_NC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &trans_op_lib
+  },
+  { /* 32 */
+    "sec",
+    "sec_n_n",
+    "Parrot_sec_n_n",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &trans_op_lib
+  },
+  { /* 33 */
+    "sec",
+    "sec_n_nc",
+    "Parrot_sec_n_nc",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_NC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &trans_op_lib
+  },
+  { /* 34 */
+    "sech",
+    "sech_n_n",
+    "Parrot_sech_n_n",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &trans_op_lib
+  },
+  { /* 35 */
+    "sech",
+    "sech_n_nc",
+    "Parrot_sech_n_nc",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_NC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &trans_op_lib
+  },
+  { /* 36 */
+    "sin",
+    "sin_n_n",
+    "Parrot_sin_n_n",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &trans_op_lib
+  },
+  { /* 37 */
+    "sin",
+    "sin_n_nc",
+    "Parrot_sin_n_nc",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_NC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &trans_op_lib
+  },
+  { /* 38 */
+    "sinh",
+    "sinh_n_n",
+    "Parrot_sinh_n_n",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &trans_op_lib
+  },
+  { /* 39 */
+    "sinh",
+    "sinh_n_nc",
+    "Parrot_sinh_n_nc",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_NC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &trans_op_lib
+  },
+  { /* 40 */
+    "tan",
+    "tan_n_n",
+    "Parrot_tan_n_n",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &trans_op_lib
+  },
+  { /* 41 */
+    "tan",
+    "tan_n_nc",
+    "Parrot_tan_n_nc",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_NC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &trans_op_lib
+  },
+  { /* 42 */
+    "tanh",
+    "tanh_n_n",
+    "Parrot_tanh_n_n",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &trans_op_lib
+  },
+  { /* 43 */
+    "tanh",
+    "tanh_n_nc",
+    "Parrot_tanh_n_nc",
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_NC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &trans_op_lib
+  },
+  { /* 44 */
+    "pow",
+    "pow_n_n_n",
+    "Parrot_pow_n_n_n",
+    0,
+    4,
+    { PARROT_ARG_N, PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &trans_op_lib
+  },
+  { /* 45 */
+    "pow",
+    "pow_n_nc_n",
+    "Parrot_pow_n_nc_n",
+    0,
+    4,
+    { PARROT_ARG_N, PARROT_ARG_NC, PARROT_ARG_N },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &trans_op_lib
+  },
+  { /* 46 */
+    "pow",
+    "pow_n_n_nc",
+    "Parrot_pow_n_n_nc",
+    0,
+    4,
+    { PARROT_ARG_N, PARROT_ARG_N, PARROT_ARG_NC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &trans_op_lib
+  },
+  { /* 47 */
+    "pow",
+    "pow_n_nc_nc",
+    "Parrot_pow_n_nc_nc",
+    0,
+    4,
+    { PARROT_ARG_N, PARROT_ARG_NC, PARROT_ARG_NC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &trans_op_lib
+  },
+  { /* 48 */
+    "pow",
+    "pow_p_p_p",
+    "Parrot_pow_p_p_p",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_P },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &trans_op_lib
+  },
+  { /* 49 */
+    "pow",
+    "pow_p_p_i",
+    "Parrot_pow_p_p_i",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_I },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &trans_op_lib
+  },
+  { /* 50 */
+    "pow",
+    "pow_p_p_ic",
+    "Parrot_pow_p_p_ic",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &trans_op_lib
+  },
+  { /* 51 */
+    "pow",
+    "pow_p_p_n",
+    "Parrot_pow_p_p_n",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_N },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &trans_op_lib
+  },
+  { /* 52 */
+    "pow",
+    "pow_p_p_nc",
+    "Parrot_pow_p_p_nc",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_NC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &trans_op_lib
+  },
+  { /* 53 */
+    "pow",
+    "pow_n_n_i",
+    "Parrot_pow_n_n_i",
+    0,
+    4,
+    { PARROT_ARG_N, PARROT_ARG_N, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &trans_op_lib
+  },
+  { /* 54 */
+    "pow",
+    "pow_n_nc_i",
+    "Parrot_pow_n_nc_i",
+    0,
+    4,
+    { PARROT_ARG_N, PARROT_ARG_NC, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &trans_op_lib
+  },
+  { /* 55 */
+    "pow",
+    "pow_n_n_ic",
+    "Parrot_pow_n_n_ic",
+    0,
+    4,
+    { PARROT_ARG_N, PARROT_ARG_N, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &trans_op_lib
+  },
+  { /* 56 */
+    "pow",
+    "pow_n_nc_ic",
+    "Parrot_pow_n_nc_ic",
+    0,
+    4,
+    { PARROT_ARG_N, PARROT_ARG_NC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &trans_op_lib
+  },
+
+};
+
+
+/*
+** Op Function Definitions:
+*/
+
+opcode_t *
+Parrot_acos_n_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = acos((FLOATVAL)NREG(2));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_acos_n_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = acos((FLOATVAL)NCONST(2));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_acot_n_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = atan(((FLOATVAL)1 / (FLOATVAL)NREG(2)));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_acot_n_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = atan(((FLOATVAL)1 / (FLOATVAL)NCONST(2)));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_asec_n_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = acos((((FLOATVAL)1) / ((FLOATVAL)NREG(2))));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_asec_n_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = acos((((FLOATVAL)1) / ((FLOATVAL)NCONST(2))));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_asin_n_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = asin((FLOATVAL)NREG(2));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_asin_n_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = asin((FLOATVAL)NCONST(2));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_atan_n_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = atan((FLOATVAL)NREG(2));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_atan_n_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = atan((FLOATVAL)NCONST(2));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_atan_n_n_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = atan2((FLOATVAL)NREG(2), (FLOATVAL)NREG(3));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_atan_n_nc_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = atan2((FLOATVAL)NCONST(2), (FLOATVAL)NREG(3));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_atan_n_n_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = atan2((FLOATVAL)NREG(2), (FLOATVAL)NCONST(3));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_atan_n_nc_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = atan2((FLOATVAL)NCONST(2), (FLOATVAL)NCONST(3));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_cos_n_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = cos((FLOATVAL)NREG(2));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_cos_n_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = cos((FLOATVAL)NCONST(2));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_cosh_n_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = cosh((FLOATVAL)NREG(2));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_cosh_n_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = cosh((FLOATVAL)NCONST(2));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_cot_n_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = (((FLOATVAL)1) / tan((FLOATVAL)NREG(2)));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_cot_n_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = (((FLOATVAL)1) / tan((FLOATVAL)NCONST(2)));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_coth_n_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = (((FLOATVAL)1) / tanh((FLOATVAL)NREG(2)));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_coth_n_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = (((FLOATVAL)1) / tanh((FLOATVAL)NCONST(2)));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_csc_n_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = (((FLOATVAL)1) / sin((FLOATVAL)NREG(2)));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_csc_n_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = (((FLOATVAL)1) / sin((FLOATVAL)NCONST(2)));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_exp_n_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = exp((FLOATVAL)NREG(2));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_exp_n_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = exp((FLOATVAL)NCONST(2));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_ln_n_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = log((FLOATVAL)NREG(2));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_ln_n_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = log((FLOATVAL)NCONST(2));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_log10_n_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = log10((FLOATVAL)NREG(2));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_log10_n_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = log10((FLOATVAL)NCONST(2));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_log2_n_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    const FLOATVAL   temp = log((FLOATVAL)2.0);
+
+    NREG(1) = (log((FLOATVAL)NREG(2)) / temp);
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_log2_n_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    const FLOATVAL   temp = log((FLOATVAL)2.0);
+
+    NREG(1) = (log((FLOATVAL)NCONST(2)) / temp);
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_sec_n_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = (((FLOATVAL)1) / cos((FLOATVAL)NREG(2)));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_sec_n_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = (((FLOATVAL)1) / cos((FLOATVAL)NCONST(2)));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_sech_n_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = (((FLOATVAL)1) / cosh((FLOATVAL)NREG(2)));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_sech_n_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = (((FLOATVAL)1) / cosh((FLOATVAL)NCONST(2)));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_sin_n_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = sin((FLOATVAL)NREG(2));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_sin_n_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = sin((FLOATVAL)NCONST(2));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_sinh_n_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = sinh((FLOATVAL)NREG(2));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_sinh_n_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = sinh((FLOATVAL)NCONST(2));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_tan_n_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = tan((FLOATVAL)NREG(2));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_tan_n_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = tan((FLOATVAL)NCONST(2));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_tanh_n_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = tanh((FLOATVAL)NREG(2));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_tanh_n_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = tanh((FLOATVAL)NCONST(2));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_pow_n_n_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = pow((FLOATVAL)NREG(2), (FLOATVAL)NREG(3));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_pow_n_nc_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = pow((FLOATVAL)NCONST(2), (FLOATVAL)NREG(3));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_pow_n_n_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = pow((FLOATVAL)NREG(2), (FLOATVAL)NCONST(3));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_pow_n_nc_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = pow((FLOATVAL)NCONST(2), (FLOATVAL)NCONST(3));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_pow_p_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    const FLOATVAL   a = VTABLE_get_number(interp, PREG(2));
+    const FLOATVAL   b = VTABLE_get_number(interp, PREG(3));
+    const FLOATVAL   c = pow(a, b);
+
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Float));
+    }
+    else {
+        PREG(1) = Parrot_pmc_new(interp, PREG(1)->vtable->base_type);
+    }
+
+    VTABLE_set_number_native(interp, PREG(1), c);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_pow_p_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    const FLOATVAL   a = VTABLE_get_number(interp, PREG(2));
+    const FLOATVAL   b = (FLOATVAL)IREG(3);
+    const FLOATVAL   c = pow(a, b);
+
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Float));
+    }
+    else {
+        PREG(1) = Parrot_pmc_new(interp, PREG(1)->vtable->base_type);
+    }
+
+    VTABLE_set_number_native(interp, PREG(1), c);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_pow_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    const FLOATVAL   a = VTABLE_get_number(interp, PREG(2));
+    const FLOATVAL   b = (FLOATVAL)ICONST(3);
+    const FLOATVAL   c = pow(a, b);
+
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Float));
+    }
+    else {
+        PREG(1) = Parrot_pmc_new(interp, PREG(1)->vtable->base_type);
+    }
+
+    VTABLE_set_number_native(interp, PREG(1), c);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_pow_p_p_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    const FLOATVAL   a = VTABLE_get_number(interp, PREG(2));
+    const FLOATVAL   c = pow(a, NREG(3));
+
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Float));
+    }
+    else {
+        PREG(1) = Parrot_pmc_new(interp, PREG(1)->vtable->base_type);
+    }
+
+    VTABLE_set_number_native(interp, PREG(1), c);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_pow_p_p_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    const FLOATVAL   a = VTABLE_get_number(interp, PREG(2));
+    const FLOATVAL   c = pow(a, NCONST(3));
+
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Float));
+    }
+    else {
+        PREG(1) = Parrot_pmc_new(interp, PREG(1)->vtable->base_type);
+    }
+
+    VTABLE_set_number_native(interp, PREG(1), c);
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_pow_n_n_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    FLOATVAL   n2 = NREG(2);
+    FLOATVAL   res = 1.0;
+    INTVAL     e = IREG(3);
+    int   s = 1;
+
+    if ((e != 0)) {
+        if ((e < 0)) {
+            s = (-1);
+            e = (-e);
+        }
+
+    }
+
+    while (e) {
+        if ((e & 1)) {
+            (res *= n2);
+        }
+
+        (n2 *= n2);
+        (e >>= 1);
+    }
+
+    if ((s < 0)) {
+        res = (1.0 / res);
+    }
+
+    NREG(1) = res;
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_pow_n_nc_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    FLOATVAL   n2 = NCONST(2);
+    FLOATVAL   res = 1.0;
+    INTVAL     e = IREG(3);
+    int   s = 1;
+
+    if ((e != 0)) {
+        if ((e < 0)) {
+            s = (-1);
+            e = (-e);
+        }
+
+    }
+
+    while (e) {
+        if ((e & 1)) {
+            (res *= n2);
+        }
+
+        (n2 *= n2);
+        (e >>= 1);
+    }
+
+    if ((s < 0)) {
+        res = (1.0 / res);
+    }
+
+    NREG(1) = res;
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_pow_n_n_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    FLOATVAL   n2 = NREG(2);
+    FLOATVAL   res = 1.0;
+    INTVAL     e = ICONST(3);
+    int   s = 1;
+
+    if ((e != 0)) {
+        if ((e < 0)) {
+            s = (-1);
+            e = (-e);
+        }
+
+    }
+
+    while (e) {
+        if ((e & 1)) {
+            (res *= n2);
+        }
+
+        (n2 *= n2);
+        (e >>= 1);
+    }
+
+    if ((s < 0)) {
+        res = (1.0 / res);
+    }
+
+    NREG(1) = res;
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_pow_n_nc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    FLOATVAL   n2 = NCONST(2);
+    FLOATVAL   res = 1.0;
+    INTVAL     e = ICONST(3);
+    int   s = 1;
+
+    if ((e != 0)) {
+        if ((e < 0)) {
+            s = (-1);
+            e = (-e);
+        }
+
+    }
+
+    while (e) {
+        if ((e & 1)) {
+            (res *= n2);
+        }
+
+        (n2 *= n2);
+        (e >>= 1);
+    }
+
+    if ((s < 0)) {
+        res = (1.0 / res);
+    }
+
+    NREG(1) = res;
+    return cur_opcode + 4;
+}
+
+
+/*
+** op lib descriptor:
+*/
+
+/* XXX should be static, but C++ doesn't want to play ball */
+op_lib_t trans_op_lib = {
+  "trans_ops",                /* name */
+  "",                  /* suffix */
+  PARROT_FUNCTION_CORE,                       /* core_type = PARROT_XX_CORE */
+  0,                                /* flags */
+  PARROT_PBC_MAJOR,
+  PARROT_PBC_MINOR,
+  57,             /* op_count */
+  trans_op_info_table,       /* op_info_table */
+  trans_op_func_table,       /* op_func_table */
+  get_op          /* op_code() */ 
+};
+
+/*
+** Op lookup function:
+*/
+
+#define OP_HASH_SIZE 3041
+
+/* we could calculate a prime somewhat bigger than
+ * n of fullnames + n of names
+ * for now this should be ok
+ *
+ * look up an op_code: at first call to op_code() a hash
+ * of short and full opcode names is created
+ * hash functions are from imcc, thanks to Melvin.
+ */
+
+
+typedef struct hop {
+    op_info_t * info;
+    struct hop *next;
+} HOP;
+
+static HOP *hop_buckets;
+static HOP **hop;
+
+static void hop_init(PARROT_INTERP);
+static size_t hash_str(ARGIN(const char *str));
+static void store_op(ARGIN(op_info_t *info), ARGMOD(HOP *p), ARGIN(const char *name));
+
+/* XXX on changing interpreters, this should be called,
+   through a hook */
+
+static void hop_deinit(PARROT_INTERP);
+
+/*
+ * find a short or full opcode
+ * usage:
+ *
+ * interp->op_lib->op_code("set", 0)
+ * interp->op_lib->op_code("set_i_i", 1)
+ *
+ * returns >= 0 (found idx into info_table), -1 if not
+ */
+
+PARROT_PURE_FUNCTION
+static
+size_t hash_str(ARGIN(const char *str))
+{
+    size_t      key = 0;
+    const char *s   = str;
+
+    while (*s) {
+        key *= 65599;
+        key += *s++;
+    }
+
+    return key;
+}
+
+
+static void store_op(ARGIN(op_info_t *info), ARGMOD(HOP *p), ARGIN(const char *name))
+{
+    const size_t hidx = hash_str(name) % OP_HASH_SIZE;
+
+    p->info           = info;
+    p->next           = hop[hidx];
+    hop[hidx]         = p;
+}
+
+static int get_op(PARROT_INTERP, ARGIN(const char *name), int full)
+{
+    const HOP   *p;
+    const size_t hidx = hash_str(name) % OP_HASH_SIZE;
+
+    if (!hop) {
+        hop = mem_gc_allocate_n_zeroed_typed(interp, OP_HASH_SIZE,HOP *);
+        hop_init(interp);
+    }
+
+    for (p = hop[hidx]; p; p = p->next) {
+        if (STREQ(name, full ? p->info->full_name : p->info->name))
+            return p->info - trans_op_lib.op_info_table;
+    }
+
+    return -1;
+}
+
+
+static void hop_init(PARROT_INTERP)
+{
+    op_info_t * const info = trans_op_lib.op_info_table;
+    opcode_t i;
+
+    /* allocate the storage all in one chunk
+     * yes, this is profligate, but we can tighten it later */
+    HOP *hops;
+
+    hop_buckets = mem_gc_allocate_n_zeroed_typed(interp, trans_op_lib.op_count * 2, HOP );
+    hops        = hop_buckets;
+
+
+    /* store full names */
+    for (i = 0; i < trans_op_lib.op_count; i++) {
+        store_op(info + i, hops++, info[i].full_name);
+
+        /* plus one short name */
+        if (i && info[i - 1].name != info[i].name)
+            store_op(info + i, hops++, info[i].name);
+    }
+}
+
+static void hop_deinit(PARROT_INTERP)
+{
+    if (hop)
+        mem_sys_free(hop);
+    if (hop_buckets)
+        mem_gc_free(interp, hop_buckets);
+
+    hop         = NULL;
+    hop_buckets = NULL;
+}
+
+op_lib_t *
+PARROT_DYNOP_TRANS_INIT(PARROT_INTERP, long init) {
+    /* initialize and return op_lib ptr */
+    if (init == 1) {
+
+        return &trans_op_lib;
+    }
+    /* set op_lib to the passed ptr (in init) */
+    else if (init) {
+
+    }
+    /* deinit - free resources */
+    else {
+        hop_deinit(interp);
+    }
+    return NULL;
+}
+
+
+/*
+ * dynamic lib load function - called once
+ */
+PARROT_DYNEXT_EXPORT PMC*
+Parrot_lib_trans_ops_load(PARROT_INTERP);
+
+PARROT_DYNEXT_EXPORT PMC*
+Parrot_lib_trans_ops_load(PARROT_INTERP)
+
+{
+    PMC *const lib = Parrot_pmc_new(interp, enum_class_ParrotLibrary);
+    ((Parrot_ParrotLibrary_attributes*)PMC_data(lib))->oplib_init = (void *) PARROT_DYNOP_TRANS_INIT;
+    dynop_register(interp, lib);
+    return lib;
+}
+
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ *   buffer-read-only: t
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
@@ -0,0 +1,244 @@
+# ex: set ro: -*- buffer-read-only:t -*-
+# DO NOT EDIT THIS FILE
+# Generated by Parrot::Configure::Compiler from src/dynpmc/Rules.in
+
+# Copyright (C) 2010-2013, Parrot Foundation.
+
+$(DYNEXT_DIR)/dynlexpad$(LOAD_EXT): src/dynpmc/dynlexpad$(O)
+	$(LD)  -o $(DYNEXT_DIR)/dynlexpad$(LOAD_EXT) \
+		src/dynpmc/dynlexpad$(O) $(LINKARGS)
+	$(ADDGENERATED) "$@" "[library]"
+
+src/dynpmc/dynlexpad$(O): \
+    src/dynpmc/dynlexpad.c \
+    $(DYNPMC_H_FILES) \
+    src/dynpmc/pmc_dynlexpad.h
+
+src/dynpmc/pmc_dynlexpad.h \
+src/dynpmc/dynlexpad.c: src/dynpmc/dynlexpad.dump
+	$(PMC2CC) src/dynpmc/dynlexpad.pmc
+	$(ADDGENERATED) "src/dynpmc/pmc_dynlexpad.h" "[devel]" "include"
+
+src/dynpmc/dynlexpad.dump: src/dynpmc/dynlexpad.pmc vtable.dump $(CLASS_O_FILES)
+	$(PMC2CD) src/dynpmc/dynlexpad.pmc
+
+
+
+$(DYNEXT_DIR)/file$(LOAD_EXT): src/dynpmc/file$(O)
+	$(LD)  -o $(DYNEXT_DIR)/file$(LOAD_EXT) \
+		src/dynpmc/file$(O) $(LINKARGS)
+	$(ADDGENERATED) "$@" "[library]"
+
+src/dynpmc/file$(O): \
+    src/dynpmc/file.c \
+    $(DYNPMC_H_FILES) \
+    src/dynpmc/pmc_file.h \
+    include/pmc/pmc_fixedintegerarray.h
+
+src/dynpmc/pmc_file.h \
+src/dynpmc/file.c: src/dynpmc/file.dump
+	$(PMC2CC) src/dynpmc/file.pmc
+	$(ADDGENERATED) "src/dynpmc/pmc_file.h" "[devel]" "include"
+
+src/dynpmc/file.dump: src/dynpmc/file.pmc vtable.dump $(CLASS_O_FILES)
+	$(PMC2CD) src/dynpmc/file.pmc
+
+
+
+$(DYNEXT_DIR)/foo_group$(LOAD_EXT): $(DYNPMC_FOO_OBJS) src/dynpmc/foo_group$(O)
+	$(LD)  -o $(DYNEXT_DIR)/foo_group$(LOAD_EXT) \
+		src/dynpmc/foo_group$(O) $(DYNPMC_FOO_OBJS) $(LINKARGS)
+	$(ADDGENERATED) "$@" "[]"
+
+src/dynpmc/foo_group$(O): \
+    src/dynpmc/pmc_foo2.h \
+    src/dynpmc/pmc_foo.h \
+    src/dynpmc/foo_group.c \
+    $(DYNPMC_H_FILES_MIN)
+
+src/dynpmc/foo_group.c: $(DYNPMC_FOO_OBJS)
+	$(PMC2C) --library foo_group --c $(DYNPMC_FOO)
+	$(MV) foo_group.c src/dynpmc/foo_group.c
+	$(ADDGENERATED) src/dynpmc/foo_group.c "[]"
+	$(MV) foo_group.h src/dynpmc/foo_group.h
+	$(ADDGENERATED) src/dynpmc/foo_group.h "[]" include
+
+src/dynpmc/foo$(O): \
+    src/dynpmc/foo.c \
+    $(DYNPMC_H_FILES) \
+    src/dynpmc/pmc_foo.h \
+    include/pmc/pmc_integer.h \
+    include/pmc/pmc_scalar.h
+
+src/dynpmc/pmc_foo.h \
+src/dynpmc/foo.c: src/dynpmc/foo.dump
+	$(PMC2CC) src/dynpmc/foo.pmc
+	$(ADDGENERATED) "src/dynpmc/pmc_foo.h" "[]" "include"
+
+src/dynpmc/foo.dump: src/dynpmc/foo.pmc vtable.dump $(CLASS_O_FILES)
+	$(PMC2CD) src/dynpmc/foo.pmc
+
+src/dynpmc/foo2$(O): \
+    src/dynpmc/foo2.c \
+    $(DYNPMC_H_FILES) \
+    src/dynpmc/pmc_foo2.h \
+    include/pmc/pmc_integer.h \
+    include/pmc/pmc_scalar.h \
+    src/dynpmc/pmc_foo.h
+
+src/dynpmc/pmc_foo2.h \
+src/dynpmc/foo2.c: src/dynpmc/foo2.dump src/dynpmc/foo.pmc
+	$(PMC2CC) src/dynpmc/foo2.pmc
+	$(ADDGENERATED) "src/dynpmc/pmc_foo2.h" "[]" "include"
+
+src/dynpmc/foo2.dump: src/dynpmc/foo2.pmc src/dynpmc/foo.dump vtable.dump $(CLASS_O_FILES)
+	$(PMC2CD) src/dynpmc/foo2.pmc
+
+
+
+$(DYNEXT_DIR)/gziphandle$(LOAD_EXT): src/dynpmc/gziphandle$(O)
+	$(LD)  -o $(DYNEXT_DIR)/gziphandle$(LOAD_EXT) \
+		src/dynpmc/gziphandle$(O) $(LINKARGS) $(LIB_ZLIB)
+	$(ADDGENERATED) "$@" "[library]"
+
+src/dynpmc/gziphandle$(O): \
+    src/dynpmc/gziphandle.c \
+    $(DYNPMC_H_FILES) \
+    src/dynpmc/pmc_gziphandle.h \
+    include/pmc/pmc_handle.h \
+    include/pmc/pmc_fixedintegerarray.h
+
+src/dynpmc/pmc_gziphandle.h \
+src/dynpmc/gziphandle.c: src/dynpmc/gziphandle.dump
+	$(PMC2CC) src/dynpmc/gziphandle.pmc
+	$(ADDGENERATED) "src/dynpmc/pmc_gziphandle.h" "[devel]" "include"
+
+src/dynpmc/gziphandle.dump: src/dynpmc/gziphandle.pmc vtable.dump $(CLASS_O_FILES)
+	$(PMC2CD) src/dynpmc/gziphandle.pmc
+
+
+
+$(DYNEXT_DIR)/os$(LOAD_EXT): src/dynpmc/osdummy$(O)
+	$(LD)  -o $(DYNEXT_DIR)/os$(LOAD_EXT) \
+		src/dynpmc/osdummy$(O) $(LINKARGS)
+	$(ADDGENERATED) "$@" "[library]"
+
+src/dynpmc/osdummy$(O): \
+    src/dynpmc/osdummy.c \
+    $(DYNPMC_H_FILES) \
+    src/dynpmc/pmc_osdummy.h \
+    include/pmc/pmc_fixedintegerarray.h
+
+src/dynpmc/pmc_osdummy.h \
+src/dynpmc/osdummy.c: src/dynpmc/osdummy.dump
+	$(PMC2CC) src/dynpmc/osdummy.pmc
+
+src/dynpmc/osdummy.dump: src/dynpmc/osdummy.pmc vtable.dump $(CLASS_O_FILES)
+	$(PMC2CD) src/dynpmc/osdummy.pmc
+
+$(DYNEXT_DIR)/pccmethod_test$(LOAD_EXT): src/dynpmc/pccmethod_test$(O)
+	$(LD)  -o $(DYNEXT_DIR)/pccmethod_test$(LOAD_EXT) \
+		src/dynpmc/pccmethod_test$(O) $(LINKARGS)
+	$(ADDGENERATED) "$@" "[]"
+
+src/dynpmc/pccmethod_test$(O): \
+    src/dynpmc/pccmethod_test.c \
+    $(DYNPMC_H_FILES) \
+    src/dynpmc/pmc_pccmethod_test.h \
+    include/pmc/pmc_fixedintegerarray.h
+
+src/dynpmc/pmc_pccmethod_test.h \
+src/dynpmc/pccmethod_test.c: src/dynpmc/pccmethod_test.dump
+	$(PMC2CC) src/dynpmc/pccmethod_test.pmc
+
+src/dynpmc/pccmethod_test.dump: src/dynpmc/pccmethod_test.pmc vtable.dump $(CLASS_O_FILES)
+	$(PMC2CD) src/dynpmc/pccmethod_test.pmc
+
+
+
+$(DYNEXT_DIR)/rotest$(LOAD_EXT): src/dynpmc/rotest$(O)
+	$(LD)  -o $(DYNEXT_DIR)/rotest$(LOAD_EXT) \
+		src/dynpmc/rotest$(O) $(LINKARGS)
+	$(ADDGENERATED) "$@" "[]"
+
+src/dynpmc/rotest$(O): \
+    src/dynpmc/rotest.c \
+    $(DYNPMC_H_FILES) \
+    src/dynpmc/pmc_rotest.h \
+    include/pmc/pmc_fixedintegerarray.h \
+    include/pmc/pmc_integer.h \
+    include/pmc/pmc_scalar.h
+
+src/dynpmc/pmc_rotest.h \
+src/dynpmc/rotest.c: src/dynpmc/rotest.dump
+	$(PMC2CC) src/dynpmc/rotest.pmc
+
+src/dynpmc/rotest.dump: src/dynpmc/rotest.pmc vtable.dump $(CLASS_O_FILES)
+	$(PMC2CD) src/dynpmc/rotest.pmc
+
+
+
+$(DYNEXT_DIR)/rational$(LOAD_EXT): src/dynpmc/rational$(O)
+	$(LD)  -o $(DYNEXT_DIR)/rational$(LOAD_EXT) \
+		src/dynpmc/rational$(O) $(LINKARGS)
+	$(ADDGENERATED) "$@" "[library]"
+
+src/dynpmc/rational$(O): \
+    src/dynpmc/rational.c \
+    $(DYNPMC_H_FILES) \
+    src/dynpmc/pmc_rational.h \
+    include/pmc/pmc_fixedintegerarray.h
+
+src/dynpmc/pmc_rational.h \
+src/dynpmc/rational.c: src/dynpmc/rational.dump
+	$(PMC2CC) src/dynpmc/rational.pmc
+	$(ADDGENERATED) "src/dynpmc/pmc_rational.h" "[devel]" "include"
+
+src/dynpmc/rational.dump: src/dynpmc/rational.pmc vtable.dump $(CLASS_O_FILES)
+	$(PMC2CD) src/dynpmc/rational.pmc
+
+
+
+$(DYNEXT_DIR)/subproxy$(LOAD_EXT): src/dynpmc/subproxy$(O)
+	$(LD)  -o $(DYNEXT_DIR)/subproxy$(LOAD_EXT) \
+		src/dynpmc/subproxy$(O) $(LINKARGS)
+	$(ADDGENERATED) "$@" "[library]"
+
+src/dynpmc/subproxy$(O): \
+    src/dynpmc/subproxy.c \
+    $(DYNPMC_H_FILES) \
+    src/dynpmc/pmc_subproxy.h \
+    include/pmc/pmc_sub.h
+
+src/dynpmc/pmc_subproxy.h \
+src/dynpmc/subproxy.c: src/dynpmc/subproxy.dump
+	$(PMC2CC) src/dynpmc/subproxy.pmc
+	$(ADDGENERATED) "src/dynpmc/pmc_subproxy.h" "[devel]" "include"
+
+src/dynpmc/subproxy.dump: src/dynpmc/subproxy.pmc vtable.dump $(CLASS_O_FILES)
+	$(PMC2CD) src/dynpmc/subproxy.pmc
+
+
+$(DYNEXT_DIR)/select$(LOAD_EXT): src/dynpmc/select$(O)
+	$(LD)  -o $(DYNEXT_DIR)/select$(LOAD_EXT) \
+		src/dynpmc/select$(O) $(LINKARGS)
+	$(ADDGENERATED) "$@" "[library]"
+
+src/dynpmc/select$(O): \
+    src/dynpmc/select.c \
+    $(DYNPMC_H_FILES) \
+    src/dynpmc/pmc_select.h \
+    include/pmc/pmc_sub.h
+
+src/dynpmc/pmc_select.h \
+src/dynpmc/select.c: src/dynpmc/select.dump
+	$(PMC2CC) src/dynpmc/select.pmc
+	$(ADDGENERATED) "src/dynpmc/pmc_select.h" "[devel]" "include"
+
+src/dynpmc/select.dump: src/dynpmc/select.pmc vtable.dump $(CLASS_O_FILES)
+	$(PMC2CD) src/dynpmc/select.pmc
+
+# Local variables:
+#   mode: makefile
+# End:
+# vim: ft=make:
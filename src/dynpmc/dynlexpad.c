@@ -0,0 +1,437 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/dynpmc/dynlexpad.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#define PARROT_IN_EXTENSION
+#define PARROT_DYNPMC_CLASS_LOAD
+#define CONST_STRING(i, s) Parrot_str_new_constant((i), s)
+#define CONST_STRING_GEN(i, s) Parrot_str_new_constant((i), s)
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_dynlexpad.h"
+#include "pmc_default.h"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#undef PARROT_DYNPMC_CLASS_LOAD
+#line 1 "./src/dynpmc/dynlexpad.pmc"
+/*
+Copyright (C) 2005-2011,2014, Parrot Foundation.
+
+=head1 NAME
+
+src/dynpmc/dynlexpad.pmc - DynLexPad PMC
+
+=head1 DESCRIPTION
+
+DynLexPad provides a more dynamic lexpad that allows the addition of
+lexicals at runtime.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+#line 46 "./src/dynpmc/dynlexpad.c"
+static  void  Parrot_DynLexPad_destroy(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_DynLexPad_elements(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_DynLexPad_exists_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *name);
+static  INTVAL  Parrot_DynLexPad_exists_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name);
+static  PMC  * Parrot_DynLexPad_get_iter(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC*  Parrot_DynLexPad_get_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *name);
+static  PMC*  Parrot_DynLexPad_get_pmc_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name);
+static  void  * Parrot_DynLexPad_get_pointer(SHIM_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_DynLexPad_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_DynLexPad_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *lexinfo);
+static  void  Parrot_DynLexPad_mark(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_DynLexPad_set_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *name, PMC *value);
+static  void  Parrot_DynLexPad_set_pmc_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name, PMC *value);
+static  void  Parrot_DynLexPad_set_pointer(PARROT_INTERP, ARGMOD(PMC *_self), void *ctx);
+PARROT_DYNEXT_EXPORT void    Parrot_DynLexPad_class_init(PARROT_INTERP, int, int);
+PARROT_DYNEXT_EXPORT VTABLE* Parrot_DynLexPad_get_vtable_pointer(PARROT_INTERP);
+PARROT_DYNEXT_EXPORT void    Parrot_DynLexPad_ro_class_init(PARROT_INTERP, int, int);
+PARROT_DYNEXT_EXPORT VTABLE* Parrot_DynLexPad_ro_get_vtable_pointer(PARROT_INTERP);
+static  void 
+Parrot_DynLexPad_destroy(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 231 "./src/dynpmc/dynlexpad.pmc"
+
+    if (PARROT_DYNLEXPAD(_self)->hash) {
+        Parrot_hash_destroy(interp, PARROT_DYNLEXPAD(_self)->hash);
+        PARROT_DYNLEXPAD(_self)->hash = NULL;
+    }
+#line 74 "./src/dynpmc/dynlexpad.c"
+}
+static  INTVAL 
+Parrot_DynLexPad_elements(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 116 "./src/dynpmc/dynlexpad.pmc"
+
+    return Parrot_hash_size(interp, PARROT_DYNLEXPAD(_self)->hash);
+#line 82 "./src/dynpmc/dynlexpad.c"
+}
+static  INTVAL 
+Parrot_DynLexPad_exists_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *name)
+{
+#line 134 "./src/dynpmc/dynlexpad.pmc"
+
+    STRING * const s = VTABLE_get_string(interp, name);
+    return VTABLE_exists_keyed_str(interp, _self, s);
+#line 91 "./src/dynpmc/dynlexpad.c"
+}
+static  INTVAL 
+Parrot_DynLexPad_exists_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name)
+{
+#line 139 "./src/dynpmc/dynlexpad.pmc"
+
+    PMC *std_pad;
+    if (Parrot_hash_exists(interp, PARROT_DYNLEXPAD(_self)->hash, name))
+        return 1;
+    std_pad = PARROT_DYNLEXPAD(_self)->init;
+    if (std_pad)
+        return VTABLE_exists_keyed_str(interp, std_pad, name);
+    return 0;
+#line 105 "./src/dynpmc/dynlexpad.c"
+}
+static  PMC  *
+Parrot_DynLexPad_get_iter(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 102 "./src/dynpmc/dynlexpad.pmc"
+
+    return Parrot_pmc_new_init(interp, enum_class_HashIterator, _self);
+#line 113 "./src/dynpmc/dynlexpad.c"
+}
+static  PMC* 
+Parrot_DynLexPad_get_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *name)
+{
+#line 177 "./src/dynpmc/dynlexpad.pmc"
+
+    STRING * const s = VTABLE_get_string(interp, name);
+    return VTABLE_get_pmc_keyed_str(interp, _self, s);
+#line 122 "./src/dynpmc/dynlexpad.c"
+}
+static  PMC* 
+Parrot_DynLexPad_get_pmc_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name)
+{
+#line 161 "./src/dynpmc/dynlexpad.pmc"
+
+    HashBucket * const b = Parrot_hash_get_bucket(interp,
+        PARROT_DYNLEXPAD(_self)->hash, name);
+
+    if (!b) {
+        PMC * const std_pad = PARROT_DYNLEXPAD(_self)->init;
+
+        if (std_pad)
+            return VTABLE_get_pmc_keyed_str(interp, std_pad, name);
+
+        return PMCNULL;
+    }
+
+    return (PMC *)b->value;
+#line 142 "./src/dynpmc/dynlexpad.c"
+}
+static  void  *
+Parrot_DynLexPad_get_pointer(SHIM_INTERP, ARGMOD(PMC *_self))
+{
+#line 87 "./src/dynpmc/dynlexpad.pmc"
+    return PARROT_DYNLEXPAD(_self)->hash;
+#line 149 "./src/dynpmc/dynlexpad.c"
+}
+static  void 
+Parrot_DynLexPad_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 25 "./src/dynpmc/dynlexpad.pmc"
+
+    /**/UNUSED(_self)
+    Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+        "don't create me like this");
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 160 "./src/dynpmc/dynlexpad.c"
+}
+static  void 
+Parrot_DynLexPad_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *lexinfo)
+{
+#line 42 "./src/dynpmc/dynlexpad.pmc"
+
+    Hash *hash;
+
+    Parrot_DynLexPad_attributes * const attrs =
+        (Parrot_DynLexPad_attributes *) PMC_data(_self);
+
+    if (VTABLE_elements(interp, lexinfo)) {
+        attrs->init = Parrot_pmc_new_init(interp, enum_class_LexPad, lexinfo);
+    }
+    else
+        attrs->init = NULL;
+
+    hash             = Parrot_hash_new(interp);
+    attrs->hash      = hash;
+    PObj_custom_mark_destroy_SETALL(_self);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 182 "./src/dynpmc/dynlexpad.c"
+}
+static  void 
+Parrot_DynLexPad_mark(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 247 "./src/dynpmc/dynlexpad.pmc"
+
+    PMC * const std_pad = PARROT_DYNLEXPAD(_self)->init;
+    Parrot_gc_mark_PMC_alive(interp, std_pad);
+    if (PARROT_DYNLEXPAD(_self)->hash)
+        Parrot_hash_mark(interp, PARROT_DYNLEXPAD(_self)->hash);
+#line 193 "./src/dynpmc/dynlexpad.c"
+}
+static  void 
+Parrot_DynLexPad_set_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *name, PMC *value)
+{
+#line 196 "./src/dynpmc/dynlexpad.pmc"
+
+    STRING * const s = VTABLE_get_string(interp, name);
+    VTABLE_set_pmc_keyed_str(interp, _self, s, value);
+#line 202 "./src/dynpmc/dynlexpad.c"
+}
+static  void 
+Parrot_DynLexPad_set_pmc_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name, PMC *value)
+{
+#line 201 "./src/dynpmc/dynlexpad.pmc"
+
+    PMC * const std_pad = PARROT_DYNLEXPAD(_self)->init;
+
+    if (PObj_constant_TEST(_self)) {
+        if (!PObj_constant_TEST((PObj *)name))
+            Parrot_ex_throw_from_c_args(interp, NULL,
+                EXCEPTION_INVALID_OPERATION,
+                "Used non-constant STRING key in constant hash.");
+        if (!PObj_constant_TEST((PObj *)value))
+            Parrot_ex_throw_from_c_args(interp, NULL,
+                EXCEPTION_INVALID_OPERATION,
+                "Used non-constant PMC value in constant hash.");
+    }
+
+    if (std_pad && VTABLE_exists_keyed_str(interp, std_pad, name))
+        VTABLE_set_pmc_keyed_str(interp, std_pad, name, value);
+
+    Parrot_hash_put(interp, PARROT_DYNLEXPAD(_self)->hash, name, value);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 227 "./src/dynpmc/dynlexpad.c"
+}
+static  void 
+Parrot_DynLexPad_set_pointer(PARROT_INTERP, ARGMOD(PMC *_self), void *ctx)
+{
+#line 69 "./src/dynpmc/dynlexpad.pmc"
+
+    PMC * const std_pad = PARROT_DYNLEXPAD(_self)->init;
+    if (std_pad) {
+        VTABLE_set_pointer(interp, std_pad, ctx);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+    }
+#line 239 "./src/dynpmc/dynlexpad.c"
+}
+#include "pmc_default.h"
+
+PARROT_DYNEXT_EXPORT 
+VTABLE *Parrot_DynLexPad_update_vtable(VTABLE *vt) {
+    vt->destroy = Parrot_DynLexPad_destroy;
+    vt->elements = Parrot_DynLexPad_elements;
+    vt->exists_keyed = Parrot_DynLexPad_exists_keyed;
+    vt->exists_keyed_str = Parrot_DynLexPad_exists_keyed_str;
+    vt->get_iter = Parrot_DynLexPad_get_iter;
+    vt->get_pmc_keyed = Parrot_DynLexPad_get_pmc_keyed;
+    vt->get_pmc_keyed_str = Parrot_DynLexPad_get_pmc_keyed_str;
+    vt->get_pointer = Parrot_DynLexPad_get_pointer;
+    vt->init = Parrot_DynLexPad_init;
+    vt->init_pmc = Parrot_DynLexPad_init_pmc;
+    vt->mark = Parrot_DynLexPad_mark;
+    vt->set_pmc_keyed = Parrot_DynLexPad_set_pmc_keyed;
+    vt->set_pmc_keyed_str = Parrot_DynLexPad_set_pmc_keyed_str;
+    vt->set_pointer = Parrot_DynLexPad_set_pointer;
+    vt->attr_size = sizeof(Parrot_DynLexPad_attributes);
+
+    return vt;
+}
+
+
+PARROT_DYNEXT_EXPORT 
+VTABLE *Parrot_DynLexPad_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->destroy = Parrot_DynLexPad_destroy;
+    vt->elements = Parrot_DynLexPad_elements;
+    vt->exists_keyed = Parrot_DynLexPad_exists_keyed;
+    vt->exists_keyed_str = Parrot_DynLexPad_exists_keyed_str;
+    vt->get_iter = Parrot_DynLexPad_get_iter;
+    vt->get_pmc_keyed = Parrot_DynLexPad_get_pmc_keyed;
+    vt->get_pmc_keyed_str = Parrot_DynLexPad_get_pmc_keyed_str;
+    vt->get_pointer = Parrot_DynLexPad_get_pointer;
+    vt->mark = Parrot_DynLexPad_mark;
+    vt->attr_size = sizeof(Parrot_DynLexPad_attributes);
+
+    return vt;
+}
+
+PARROT_DYNEXT_EXPORT 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_DynLexPad_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_DynLexPad_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_DYNEXT_EXPORT 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_DynLexPad_get_vtable_pointer(PARROT_INTERP) {
+    STRING * const type_name = Parrot_str_new_constant(interp, "DynLexPad");
+    const INTVAL type_num  = Parrot_pmc_get_type_str(interp, type_name);
+    return interp->vtables[type_num];
+}
+
+PARROT_DYNEXT_EXPORT 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_DynLexPad_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_DynLexPad_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_DYNEXT_EXPORT 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_DynLexPad_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "DynLexPad"));
+    return mro;
+}
+
+PARROT_DYNEXT_EXPORT 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_DynLexPad_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "DynLexPad")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_DynLexPad_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        ":hash Finit ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_DynLexPad_get_vtable(interp);
+        vt->base_type      = -1;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->base_type    = entry;
+        vt->whoami       = Parrot_str_new_init(interp, "DynLexPad", 9,
+                                       Parrot_ascii_encoding_ptr, PObj_constant_FLAG|PObj_external_FLAG);
+        vt->provides_str = Parrot_str_concat(interp, vt->provides_str,
+            Parrot_str_new_init(interp, "lexpad", 6, Parrot_ascii_encoding_ptr,
+            PObj_constant_FLAG|PObj_external_FLAG));
+
+        vt->isa_hash     = Parrot_DynLexPad_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_DynLexPad_ro_get_vtable(interp);
+            vt_ro->base_type           = -1;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_DynLexPad_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+        }
+    } /* pass */
+} /* Parrot_DynLexPad_class_init */
+
+INTVAL dynpmc_class_DynLexPad;
+
+/*
+ * This load function will be called to do global (once) setup
+ * whatever is needed to get this extension running
+ */
+
+PARROT_DYNEXT_EXPORT Parrot_PMC Parrot_lib_dynlexpad_load(PARROT_INTERP)
+{
+    Parrot_String whoami;
+    Parrot_PMC    pmc;
+    int pass;
+
+    /* create a library PMC */
+    pmc = Parrot_pmc_new(interp, enum_class_ParrotLibrary);
+
+    /* for all PMCs we want to register: */
+    whoami = CONST_STRING_GEN(interp, "DynLexPad");
+    dynpmc_class_DynLexPad = Parrot_pmc_register_new_type(interp, whoami);
+
+    /* do class_init code */
+    for (pass = 0; pass <= 1; ++pass) {
+        Parrot_DynLexPad_class_init(interp, dynpmc_class_DynLexPad, pass);
+    }
+    return pmc;
+}
+
+#line 254 "./src/dynpmc/dynlexpad.pmc"
+
+
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<docs/pdds/pdd20_lexical_vars.pod>, F<src/pmc/lexpad.pmc>,
+F<src/pmc/lexinfo.pmc>.
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
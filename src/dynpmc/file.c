@@ -0,0 +1,578 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/dynpmc/file.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#define PARROT_IN_EXTENSION
+#define PARROT_DYNPMC_CLASS_LOAD
+#define CONST_STRING(i, s) Parrot_str_new_constant((i), s)
+#define CONST_STRING_GEN(i, s) Parrot_str_new_constant((i), s)
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_fixedintegerarray.h"
+#include "pmc_file.h"
+#include "pmc_default.h"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#undef PARROT_DYNPMC_CLASS_LOAD
+#line 1 "./src/dynpmc/file.pmc"
+/*
+Copyright (C) 2001-2011,2014, Parrot Foundation.
+
+=head1 NAME
+
+src/dynpmc/file.pmc - File PMC
+
+=head1 DESCRIPTION
+
+C<File> is a singleton class which provides access to File functions.
+
+=head2 Methods
+
+=over 4
+
+=cut
+
+*/
+
+#ifdef WIN32
+#  include <direct.h>
+#endif
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+
+static PMC *File_PMC;
+#line 56 "./src/dynpmc/file.c"
+static  void  * Parrot_File_get_pointer(SHIM_INTERP, SHIM(PMC *_self));
+static  void  Parrot_File_set_pointer(PARROT_INTERP, ARGMOD(PMC *_self), void *ptr);
+static  void Parrot_File_nci_exists(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_File_nci_is_dir(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_File_nci_is_file(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_File_nci_is_link(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_File_nci_copy(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_File_nci_rename(PARROT_INTERP, ARGMOD(PMC *_self));
+PARROT_DYNEXT_EXPORT void    Parrot_File_class_init(PARROT_INTERP, int, int);
+PARROT_DYNEXT_EXPORT VTABLE* Parrot_File_get_vtable_pointer(PARROT_INTERP);
+static  void  *
+Parrot_File_get_pointer(SHIM_INTERP, SHIM(PMC *_self))
+{
+#line 50 "./src/dynpmc/file.pmc"
+
+    return File_PMC;
+#line 73 "./src/dynpmc/file.c"
+}
+static  void 
+Parrot_File_set_pointer(PARROT_INTERP, ARGMOD(PMC *_self), void *ptr)
+{
+#line 57 "./src/dynpmc/file.pmc"
+
+    /**/UNUSED(interp)
+    /**/UNUSED(_self)
+
+    File_PMC = (PMC *)ptr;
+#line 84 "./src/dynpmc/file.c"
+}
+static  void
+Parrot_File_nci_exists(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* path;
+    
+    const INTVAL arity = 2; /* "PiS" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    path = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 74 "./src/dynpmc/file.pmc"
+
+    const INTVAL res = Parrot_file_lstat_intval(interp, path, STAT_EXISTS);
+    UNUSED(_self)
+
+    #line 111 "./src/dynpmc/file.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)res);
+        
+        return;
+     }
+#line 78 "./src/dynpmc/file.pmc"
+
+#line 119 "./src/dynpmc/file.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_File_nci_is_dir(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* path;
+    
+    const INTVAL arity = 2; /* "PiS" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    path = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 91 "./src/dynpmc/file.pmc"
+
+    const INTVAL res = Parrot_file_lstat_intval(interp, path, STAT_ISDIR);
+    UNUSED(_self)
+
+    #line 153 "./src/dynpmc/file.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)res);
+        
+        return;
+     }
+#line 95 "./src/dynpmc/file.pmc"
+
+#line 161 "./src/dynpmc/file.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_File_nci_is_file(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* path;
+    
+    const INTVAL arity = 2; /* "PiS" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    path = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 108 "./src/dynpmc/file.pmc"
+
+    const INTVAL res = Parrot_file_lstat_intval(interp, path, STAT_ISREG);
+    UNUSED(_self)
+
+    #line 195 "./src/dynpmc/file.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)res);
+        
+        return;
+     }
+#line 112 "./src/dynpmc/file.pmc"
+
+#line 203 "./src/dynpmc/file.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_File_nci_is_link(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* path;
+    
+    const INTVAL arity = 2; /* "PiS" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    path = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 125 "./src/dynpmc/file.pmc"
+
+    const INTVAL res = Parrot_file_lstat_intval(interp, path, STAT_ISLNK);
+    UNUSED(_self)
+
+    #line 237 "./src/dynpmc/file.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)res);
+        
+        return;
+     }
+#line 129 "./src/dynpmc/file.pmc"
+
+#line 245 "./src/dynpmc/file.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_File_nci_copy(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* from;
+    STRING* to;
+    
+    const INTVAL arity = 3; /* "PiSS" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    from = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+    to = VTABLE_get_string_keyed_int(interp, _call_object, 2);
+
+    { /* BEGIN PMETHOD BODY */
+#line 148 "./src/dynpmc/file.pmc"
+
+#define CHUNK_SIZE 1024
+
+    char * const cfrom  = Parrot_str_to_cstring(interp, from);
+    FILE * const source = fopen(cfrom, "rb");
+    UNUSED(_self)
+
+    Parrot_str_free_cstring(cfrom);
+
+    if (source) {
+        char * const cto    = Parrot_str_to_cstring(interp, to);
+        FILE * const target = fopen(cto, "w+b");
+
+        Parrot_str_free_cstring(cto);
+
+        if (target) {
+            while (!feof(source)) {
+                char buf[CHUNK_SIZE];
+                const size_t bytes_read = fread(buf, 1, CHUNK_SIZE, source);
+
+                if (bytes_read) {
+                    const size_t bytes_written = fwrite(buf, 1, bytes_read, target);
+                    if (bytes_read != bytes_written) {
+                        Parrot_ex_throw_from_c_args(interp, NULL,
+                            EXCEPTION_EXTERNAL_ERROR, "Error writing file");
+                        break;
+                    }
+                }
+            }
+            fclose(target);
+        }
+        else {
+            const char * const errmsg = strerror(errno);
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_EXTERNAL_ERROR,
+                errmsg);
+        }
+        fclose(source);
+    }
+    else {
+        const char * const errmsg = strerror(errno);
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_EXTERNAL_ERROR,
+            errmsg);
+    }
+#undef CHUNK_SIZE
+#line 321 "./src/dynpmc/file.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_File_nci_rename(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* from;
+    STRING* to;
+    
+    const INTVAL arity = 3; /* "PiSS" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    from = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+    to = VTABLE_get_string_keyed_int(interp, _call_object, 2);
+
+    { /* BEGIN PMETHOD BODY */
+#line 204 "./src/dynpmc/file.pmc"
+
+    UNUSED(_self)
+    Parrot_file_rename(interp, from, to);
+#line 356 "./src/dynpmc/file.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+#include "pmc_default.h"
+
+PARROT_DYNEXT_EXPORT 
+VTABLE *Parrot_File_update_vtable(VTABLE *vt) {
+    vt->get_pointer = Parrot_File_get_pointer;
+    vt->set_pointer = Parrot_File_set_pointer;
+
+    return vt;
+}
+
+
+PARROT_DYNEXT_EXPORT 
+VTABLE *Parrot_File_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->get_pointer = Parrot_File_get_pointer;
+
+    return vt;
+}
+
+PARROT_DYNEXT_EXPORT 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_File_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_File_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_DYNEXT_EXPORT 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_File_get_vtable_pointer(PARROT_INTERP) {
+    STRING * const type_name = Parrot_str_new_constant(interp, "File");
+    const INTVAL type_num  = Parrot_pmc_get_type_str(interp, type_name);
+    return interp->vtables[type_num];
+}
+
+PARROT_DYNEXT_EXPORT 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_File_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_File_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_DYNEXT_EXPORT 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_File_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "File"));
+    return mro;
+}
+
+PARROT_DYNEXT_EXPORT 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_File_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "File")), PMCNULL);
+    return isa;
+}
+
+static void thispmc_class_init(PARROT_INTERP, int entry)
+{
+    
+        UNUSED(interp)
+        UNUSED(entry)
+    
+        File_PMC = NULL;
+
+}
+void
+Parrot_File_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_File_get_vtable(interp);
+        vt->base_type      = -1;
+        vt->flags          = 0|VTABLE_PMC_IS_SINGLETON;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->base_type    = entry;
+        vt->whoami       = Parrot_str_new_init(interp, "File", 4,
+                                       Parrot_ascii_encoding_ptr, PObj_constant_FLAG|PObj_external_FLAG);
+        vt->provides_str = Parrot_str_concat(interp, vt->provides_str,
+            Parrot_str_new_init(interp, "scalar", 6, Parrot_ascii_encoding_ptr,
+            PObj_constant_FLAG|PObj_external_FLAG));
+
+        vt->isa_hash     = Parrot_File_get_isa(interp, NULL);
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_File_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "exists");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_File_nci_exists),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "is_dir");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_File_nci_is_dir),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "is_file");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_File_nci_is_file),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "is_link");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_File_nci_is_link),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "copy");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_File_nci_copy),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "rename");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_File_nci_rename),
+                method_name, signature);
+        }
+
+        /* class_init */
+        thispmc_class_init(interp, entry);
+
+
+        {
+        }
+    } /* pass */
+} /* Parrot_File_class_init */
+
+INTVAL dynpmc_class_File;
+
+/*
+ * This load function will be called to do global (once) setup
+ * whatever is needed to get this extension running
+ */
+
+PARROT_DYNEXT_EXPORT Parrot_PMC Parrot_lib_file_load(PARROT_INTERP)
+{
+    Parrot_String whoami;
+    Parrot_PMC    pmc;
+    int pass;
+
+    /* create a library PMC */
+    pmc = Parrot_pmc_new(interp, enum_class_ParrotLibrary);
+
+    /* for all PMCs we want to register: */
+    whoami = CONST_STRING_GEN(interp, "File");
+    dynpmc_class_File = Parrot_pmc_register_new_type(interp, whoami);
+
+    /* do class_init code */
+    for (pass = 0; pass <= 1; ++pass) {
+        Parrot_File_class_init(interp, dynpmc_class_File, pass);
+    }
+    return pmc;
+}
+
+#line 207 "./src/dynpmc/file.pmc"
+
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+   stat(2), rename(2)
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
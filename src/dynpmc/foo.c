@@ -0,0 +1,268 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/dynpmc/foo.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#define PARROT_IN_EXTENSION
+#define PARROT_DYNPMC_CLASS_LOAD
+#define CONST_STRING(i, s) Parrot_str_new_constant((i), s)
+#define CONST_STRING_GEN(i, s) Parrot_str_new_constant((i), s)
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_foo.h"
+#include "pmc_integer.h"
+#include "pmc_scalar.h"
+#include "pmc_default.h"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#undef PARROT_DYNPMC_CLASS_LOAD
+#line 1 "./src/dynpmc/foo.pmc"
+/*
+ * Copyright (C) 2003-2008, Parrot Foundation.
+ */
+
+/*
+ * Sample Foo class used to verify dynamic loading and
+ * proper inheritance - for testing only
+ */
+#line 37 "./src/dynpmc/foo.c"
+static  INTVAL  Parrot_Foo_get_integer(SHIM_INTERP, SHIM(PMC *_self));
+static  PMC*  Parrot_Foo_multi_subtract_Integer_PMC(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value), PMC *dest);
+static  PMC*  Parrot_Foo_multi_subtract_DEFAULT_PMC(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value), PMC *dest);
+static  void Parrot_Foo_multi_subtract_Integer_PMC_pcc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Foo_multi_subtract_DEFAULT_PMC_pcc(PARROT_INTERP, ARGMOD(PMC *_self));
+PARROT_DYNEXT_EXPORT void    Parrot_Foo_class_init(PARROT_INTERP, int, int);
+PARROT_DYNEXT_EXPORT VTABLE* Parrot_Foo_get_vtable_pointer(PARROT_INTERP);
+PARROT_DYNEXT_EXPORT void    Parrot_Foo_ro_class_init(PARROT_INTERP, int, int);
+PARROT_DYNEXT_EXPORT VTABLE* Parrot_Foo_ro_get_vtable_pointer(PARROT_INTERP);
+static  INTVAL 
+Parrot_Foo_get_integer(SHIM_INTERP, SHIM(PMC *_self))
+{
+#line 12 "./src/dynpmc/foo.pmc"
+    return 42;
+#line 52 "./src/dynpmc/foo.c"
+}
+static  PMC* 
+Parrot_Foo_multi_subtract_Integer_PMC(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value), PMC *dest)
+{
+#line 18 "./src/dynpmc/foo.pmc"
+    if (!dest)
+        dest = Parrot_pmc_new(interp, _self->vtable->base_type);
+    VTABLE_set_integer_native(interp, dest, 144);
+    return dest;
+#line 62 "./src/dynpmc/foo.c"
+}
+static  PMC* 
+Parrot_Foo_multi_subtract_DEFAULT_PMC(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value), PMC *dest)
+{
+#line 26 "./src/dynpmc/foo.pmc"
+    if (!dest)
+        dest = Parrot_pmc_new(interp, _self->vtable->base_type);
+    VTABLE_set_integer_native(interp, dest, 244);
+    return dest;
+#line 72 "./src/dynpmc/foo.c"
+}
+static  void
+Parrot_Foo_multi_subtract_Integer_PMC_pcc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+PMC *value; PMC *dest;
+PMC*  _result;
+PMC *_call_obj = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+Parrot_pcc_fill_params_from_c_args(interp, _call_obj, "PiPP", &_self, &value, &dest);
+_result = Parrot_Foo_multi_subtract_Integer_PMC(interp, _self, value, dest);
+    Parrot_pcc_set_call_from_c_args(interp, _call_obj, "P", _result);
+}
+static  void
+Parrot_Foo_multi_subtract_DEFAULT_PMC_pcc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+PMC *value; PMC *dest;
+PMC*  _result;
+PMC *_call_obj = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+Parrot_pcc_fill_params_from_c_args(interp, _call_obj, "PiPP", &_self, &value, &dest);
+_result = Parrot_Foo_multi_subtract_DEFAULT_PMC(interp, _self, value, dest);
+    Parrot_pcc_set_call_from_c_args(interp, _call_obj, "P", _result);
+}
+#include "pmc_default.h"
+
+PARROT_DYNEXT_EXPORT 
+VTABLE *Parrot_Foo_update_vtable(VTABLE *vt) {
+    vt->get_integer = Parrot_Foo_get_integer;
+    vt->attr_size = sizeof(Parrot_Foo_attributes);
+
+    return vt;
+}
+
+
+PARROT_DYNEXT_EXPORT 
+VTABLE *Parrot_Foo_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->get_integer = Parrot_Foo_get_integer;
+    vt->attr_size = sizeof(Parrot_Foo_attributes);
+
+    return vt;
+}
+
+PARROT_DYNEXT_EXPORT 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Foo_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_Integer_get_vtable(interp);
+    Parrot_Foo_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_DYNEXT_EXPORT 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Foo_get_vtable_pointer(PARROT_INTERP) {
+    STRING * const type_name = Parrot_str_new_constant(interp, "Foo");
+    const INTVAL type_num  = Parrot_pmc_get_type_str(interp, type_name);
+    return interp->vtables[type_num];
+}
+
+PARROT_DYNEXT_EXPORT 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Foo_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_Integer_ro_get_vtable(interp);
+    Parrot_Foo_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_DYNEXT_EXPORT 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_Foo_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+    mro = Parrot_Integer_get_mro(interp, mro);
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "Foo"));
+    return mro;
+}
+
+PARROT_DYNEXT_EXPORT 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_Foo_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    isa = Parrot_Integer_get_isa(interp, isa);
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "Foo")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_Foo_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "Iiv ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_Foo_get_vtable(interp);
+        vt->base_type      = -1;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->base_type    = entry;
+        vt->whoami       = Parrot_str_new_init(interp, "Foo", 3,
+                                       Parrot_ascii_encoding_ptr, PObj_constant_FLAG|PObj_external_FLAG);
+        vt->provides_str = Parrot_str_concat(interp, vt->provides_str,
+            Parrot_str_new_init(interp, "scalar", 6, Parrot_ascii_encoding_ptr,
+            PObj_constant_FLAG|PObj_external_FLAG));
+
+        vt->isa_hash     = Parrot_Foo_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_Foo_ro_get_vtable(interp);
+            vt_ro->base_type           = -1;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_Foo_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const mfl_0 = CONST_STRING_GEN(interp, "subtract");
+            STRING * const mfl_1 = CONST_STRING_GEN(interp, "Foo,Integer,PMC");
+            STRING * const mfl_2 = CONST_STRING_GEN(interp, "Foo");
+            STRING * const mfl_3 = CONST_STRING_GEN(interp, "Foo,DEFAULT,PMC");
+        PMC *_temp_func;
+_temp_func = Parrot_pmc_new(interp, enum_class_NativePCCMethod);
+VTABLE_set_pointer_keyed_str(interp, _temp_func, CONST_STRING(interp, "->"), (void *)Parrot_Foo_multi_subtract_Integer_PMC_pcc);
+Parrot_mmd_add_multi_from_long_sig(interp, mfl_0, mfl_1, _temp_func);
+
+_temp_func = Parrot_pmc_new(interp, enum_class_NativePCCMethod);
+VTABLE_set_pointer_keyed_str(interp, _temp_func, CONST_STRING(interp, "->"), (void *)Parrot_Foo_multi_subtract_DEFAULT_PMC_pcc);
+Parrot_mmd_add_multi_from_long_sig(interp, mfl_0, mfl_3, _temp_func);
+
+        }
+    } /* pass */
+} /* Parrot_Foo_class_init */
+
+INTVAL dynpmc_class_Foo;
+
+/*
+ * This load function will be called to do global (once) setup
+ * whatever is needed to get this extension running
+ */
+
+PARROT_DYNEXT_EXPORT Parrot_PMC Parrot_lib_foo_load(PARROT_INTERP)
+{
+    Parrot_String whoami;
+    Parrot_PMC    pmc;
+    int pass;
+
+    /* create a library PMC */
+    pmc = Parrot_pmc_new(interp, enum_class_ParrotLibrary);
+
+    /* for all PMCs we want to register: */
+    whoami = CONST_STRING_GEN(interp, "Foo");
+    dynpmc_class_Foo = Parrot_pmc_register_new_type(interp, whoami);
+
+    /* do class_init code */
+    for (pass = 0; pass <= 1; ++pass) {
+        Parrot_Foo_class_init(interp, dynpmc_class_Foo, pass);
+    }
+    return pmc;
+}
+
+#line 32 "./src/dynpmc/foo.pmc"
+
+
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
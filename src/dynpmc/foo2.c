@@ -0,0 +1,214 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/dynpmc/foo2.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#define PARROT_IN_EXTENSION
+#define PARROT_DYNPMC_CLASS_LOAD
+#define CONST_STRING(i, s) Parrot_str_new_constant((i), s)
+#define CONST_STRING_GEN(i, s) Parrot_str_new_constant((i), s)
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_foo2.h"
+#include "pmc_foo.h"
+#include "pmc_integer.h"
+#include "pmc_scalar.h"
+#include "pmc_default.h"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#undef PARROT_DYNPMC_CLASS_LOAD
+#line 1 "./src/dynpmc/foo2.pmc"
+/*
+ * Copyright (C) 2009, Parrot Foundation.
+ */
+
+/*
+ * Sample Foo2 class used to verify dynamic loading and
+ * proper inheritance - for testing only
+ */
+#line 38 "./src/dynpmc/foo2.c"
+static  INTVAL  Parrot_Foo2_get_integer(PARROT_INTERP, ARGMOD(PMC *_self));
+PARROT_DYNEXT_EXPORT void    Parrot_Foo2_class_init(PARROT_INTERP, int, int);
+PARROT_DYNEXT_EXPORT VTABLE* Parrot_Foo2_get_vtable_pointer(PARROT_INTERP);
+PARROT_DYNEXT_EXPORT void    Parrot_Foo2_ro_class_init(PARROT_INTERP, int, int);
+PARROT_DYNEXT_EXPORT VTABLE* Parrot_Foo2_ro_get_vtable_pointer(PARROT_INTERP);
+static  INTVAL 
+Parrot_Foo2_get_integer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 12 "./src/dynpmc/foo2.pmc"
+
+    INTVAL i = Parrot_Foo_get_vtable_pointer(interp)->get_integer(interp, _self);
+    return i + 1;
+#line 51 "./src/dynpmc/foo2.c"
+}
+#include "pmc_default.h"
+
+PARROT_DYNEXT_EXPORT 
+VTABLE *Parrot_Foo2_update_vtable(VTABLE *vt) {
+    vt->get_integer = Parrot_Foo2_get_integer;
+    vt->attr_size = sizeof(Parrot_Foo2_attributes);
+
+    return vt;
+}
+
+
+PARROT_DYNEXT_EXPORT 
+VTABLE *Parrot_Foo2_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->get_integer = Parrot_Foo2_get_integer;
+    vt->attr_size = sizeof(Parrot_Foo2_attributes);
+
+    return vt;
+}
+
+PARROT_DYNEXT_EXPORT 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Foo2_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_Foo_get_vtable(interp);
+    Parrot_Foo2_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_DYNEXT_EXPORT 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Foo2_get_vtable_pointer(PARROT_INTERP) {
+    STRING * const type_name = Parrot_str_new_constant(interp, "Foo2");
+    const INTVAL type_num  = Parrot_pmc_get_type_str(interp, type_name);
+    return interp->vtables[type_num];
+}
+
+PARROT_DYNEXT_EXPORT 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Foo2_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_Foo_ro_get_vtable(interp);
+    Parrot_Foo2_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_DYNEXT_EXPORT 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_Foo2_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+    mro = Parrot_Foo_get_mro(interp, mro);
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "Foo2"));
+    return mro;
+}
+
+PARROT_DYNEXT_EXPORT 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_Foo2_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    isa = Parrot_Foo_get_isa(interp, isa);
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "Foo2")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_Foo2_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "Iiv ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_Foo2_get_vtable(interp);
+        vt->base_type      = -1;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->base_type    = entry;
+        vt->whoami       = Parrot_str_new_init(interp, "Foo2", 4,
+                                       Parrot_ascii_encoding_ptr, PObj_constant_FLAG|PObj_external_FLAG);
+        vt->provides_str = Parrot_str_concat(interp, vt->provides_str,
+            Parrot_str_new_init(interp, "scalar", 6, Parrot_ascii_encoding_ptr,
+            PObj_constant_FLAG|PObj_external_FLAG));
+
+        vt->isa_hash     = Parrot_Foo2_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_Foo2_ro_get_vtable(interp);
+            vt_ro->base_type           = -1;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_Foo2_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+        }
+    } /* pass */
+} /* Parrot_Foo2_class_init */
+
+INTVAL dynpmc_class_Foo2;
+
+/*
+ * This load function will be called to do global (once) setup
+ * whatever is needed to get this extension running
+ */
+
+PARROT_DYNEXT_EXPORT Parrot_PMC Parrot_lib_foo2_load(PARROT_INTERP)
+{
+    Parrot_String whoami;
+    Parrot_PMC    pmc;
+    int pass;
+
+    /* create a library PMC */
+    pmc = Parrot_pmc_new(interp, enum_class_ParrotLibrary);
+
+    /* for all PMCs we want to register: */
+    whoami = CONST_STRING_GEN(interp, "Foo2");
+    dynpmc_class_Foo2 = Parrot_pmc_register_new_type(interp, whoami);
+
+    /* do class_init code */
+    for (pass = 0; pass <= 1; ++pass) {
+        Parrot_Foo2_class_init(interp, dynpmc_class_Foo2, pass);
+    }
+    return pmc;
+}
+
+#line 15 "./src/dynpmc/foo2.pmc"
+
+
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -0,0 +1,47 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from 'various files'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#define PARROT_IN_EXTENSION
+#define CONST_STRING(i, s)     Parrot_str_new_constant(i, s)
+#define CONST_STRING_GEN(i, s) Parrot_str_new_constant(i, s)
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+
+#include "foo_group.h"
+
+/*
+ * This load function will be called to do global (once) setup
+ * whatever is needed to get this extension running.
+ */
+
+PARROT_DYNEXT_EXPORT Parrot_PMC Parrot_lib_foo_group_load(PARROT_INTERP)
+{
+    Parrot_PMC    pmc;
+
+    /* create a library PMC */
+    pmc = Parrot_pmc_new(interp, enum_class_ParrotLibrary);
+
+    /* for all PMCs we want to register: */
+    Parrot_lib_foo_load(interp);
+    Parrot_lib_foo2_load(interp);
+    return pmc;
+}
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
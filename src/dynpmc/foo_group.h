@@ -0,0 +1,29 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from 'various files'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#ifndef PARROT_LIB_FOO_GROUP_H_GUARD
+#define PARROT_LIB_FOO_GROUP_H_GUARD
+
+#include "pmc_foo.h"
+#include "pmc_foo2.h"
+
+PARROT_DYNEXT_EXPORT Parrot_PMC Parrot_lib_foo_group_load(PARROT_INTERP);
+
+#endif /* PARROT_LIB_FOO_GROUP_H_GUARD */
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
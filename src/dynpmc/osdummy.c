@@ -0,0 +1,205 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/dynpmc/osdummy.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#define PARROT_IN_EXTENSION
+#define PARROT_DYNPMC_CLASS_LOAD
+#define CONST_STRING(i, s) Parrot_str_new_constant((i), s)
+#define CONST_STRING_GEN(i, s) Parrot_str_new_constant((i), s)
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_osdummy.h"
+#include "pmc_default.h"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#undef PARROT_DYNPMC_CLASS_LOAD
+#line 1 "./src/dynpmc/osdummy.pmc"
+/*
+Copyright (C) 2001-2012, Parrot Foundation.
+
+=head1 NAME
+
+src/dynpmc/osdummy.pmc - Dummy dynpmc placeholder
+
+=head1 DESCRIPTION
+
+This dynpmc is copied to dynpmc/os. It does nothing, OS is now a builtin.
+
+For backwards compatiblity with existing C<loadlib 'os'> calls.
+
+=cut
+
+*/
+#line 43 "./src/dynpmc/osdummy.c"
+PARROT_DYNEXT_EXPORT void    Parrot_OSdummy_class_init(PARROT_INTERP, int, int);
+PARROT_DYNEXT_EXPORT VTABLE* Parrot_OSdummy_get_vtable_pointer(PARROT_INTERP);
+PARROT_DYNEXT_EXPORT void    Parrot_OSdummy_ro_class_init(PARROT_INTERP, int, int);
+PARROT_DYNEXT_EXPORT VTABLE* Parrot_OSdummy_ro_get_vtable_pointer(PARROT_INTERP);
+#include "pmc_default.h"
+
+PARROT_DYNEXT_EXPORT 
+VTABLE *Parrot_OSdummy_update_vtable(VTABLE *vt) {
+
+    return vt;
+}
+
+
+PARROT_DYNEXT_EXPORT 
+VTABLE *Parrot_OSdummy_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+
+    return vt;
+}
+
+PARROT_DYNEXT_EXPORT 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_OSdummy_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_OSdummy_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_DYNEXT_EXPORT 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_OSdummy_get_vtable_pointer(PARROT_INTERP) {
+    STRING * const type_name = Parrot_str_new_constant(interp, "OSdummy");
+    const INTVAL type_num  = Parrot_pmc_get_type_str(interp, type_name);
+    return interp->vtables[type_num];
+}
+
+PARROT_DYNEXT_EXPORT 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_OSdummy_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_OSdummy_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_DYNEXT_EXPORT 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_OSdummy_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "OSdummy"));
+    return mro;
+}
+
+PARROT_DYNEXT_EXPORT 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_OSdummy_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "OSdummy")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_OSdummy_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_OSdummy_get_vtable(interp);
+        vt->base_type      = -1;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->base_type    = entry;
+        vt->whoami       = Parrot_str_new_init(interp, "OSdummy", 7,
+                                       Parrot_ascii_encoding_ptr, PObj_constant_FLAG|PObj_external_FLAG);
+        vt->provides_str = Parrot_str_concat(interp, vt->provides_str,
+            Parrot_str_new_init(interp, "scalar", 6, Parrot_ascii_encoding_ptr,
+            PObj_constant_FLAG|PObj_external_FLAG));
+
+        vt->isa_hash     = Parrot_OSdummy_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_OSdummy_ro_get_vtable(interp);
+            vt_ro->base_type           = -1;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_OSdummy_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+        }
+    } /* pass */
+} /* Parrot_OSdummy_class_init */
+
+INTVAL dynpmc_class_OSdummy;
+
+/*
+ * This load function will be called to do global (once) setup
+ * whatever is needed to get this extension running
+ */
+
+PARROT_DYNEXT_EXPORT Parrot_PMC Parrot_lib_osdummy_load(PARROT_INTERP)
+{
+    Parrot_String whoami;
+    Parrot_PMC    pmc;
+    int pass;
+
+    /* create a library PMC */
+    pmc = Parrot_pmc_new(interp, enum_class_ParrotLibrary);
+
+    /* for all PMCs we want to register: */
+    whoami = CONST_STRING_GEN(interp, "OSdummy");
+    dynpmc_class_OSdummy = Parrot_pmc_register_new_type(interp, whoami);
+
+    /* do class_init code */
+    for (pass = 0; pass <= 1; ++pass) {
+        Parrot_OSdummy_class_init(interp, dynpmc_class_OSdummy, pass);
+    }
+    return pmc;
+}
+
+#line 18 "./src/dynpmc/osdummy.pmc"
+
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
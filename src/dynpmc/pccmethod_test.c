@@ -0,0 +1,466 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/dynpmc/pccmethod_test.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#define PARROT_IN_EXTENSION
+#define PARROT_DYNPMC_CLASS_LOAD
+#define CONST_STRING(i, s) Parrot_str_new_constant((i), s)
+#define CONST_STRING_GEN(i, s) Parrot_str_new_constant((i), s)
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_fixedintegerarray.h"
+#include "pmc_pccmethod_test.h"
+#include "pmc_default.h"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#undef PARROT_DYNPMC_CLASS_LOAD
+#line 1 "./src/dynpmc/pccmethod_test.pmc"
+/*
+Copyright (C) 2001-2008, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/pmethod_test.pmc
+
+=head1 DESCRIPTION
+
+METHOD_Test PMC
+
+=cut
+
+*/
+#line 42 "./src/dynpmc/pccmethod_test.c"
+static  void Parrot_PCCMETHOD_Test_nci_test_method(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_PCCMETHOD_Test_nci_test_method0(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_PCCMETHOD_Test_nci_test_method1(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_PCCMETHOD_Test_nci_test_method2(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_PCCMETHOD_Test_nci_test_method3(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_PCCMETHOD_Test_nci_test_method4(PARROT_INTERP, ARGMOD(PMC *_self));
+PARROT_DYNEXT_EXPORT void    Parrot_PCCMETHOD_Test_class_init(PARROT_INTERP, int, int);
+PARROT_DYNEXT_EXPORT VTABLE* Parrot_PCCMETHOD_Test_get_vtable_pointer(PARROT_INTERP);
+PARROT_DYNEXT_EXPORT void    Parrot_PCCMETHOD_Test_ro_class_init(PARROT_INTERP, int, int);
+PARROT_DYNEXT_EXPORT VTABLE* Parrot_PCCMETHOD_Test_ro_get_vtable_pointer(PARROT_INTERP);
+static  void
+Parrot_PCCMETHOD_Test_nci_test_method(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 20 "./src/dynpmc/pccmethod_test.pmc"
+
+    UNUSED(_self);
+    Parrot_io_printf(interp, "test_method\n");
+#line 75 "./src/dynpmc/pccmethod_test.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_PCCMETHOD_Test_nci_test_method0(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    INTVAL a1;
+    
+    const INTVAL arity = 2; /* "PiI" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    a1 = VTABLE_get_integer_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 26 "./src/dynpmc/pccmethod_test.pmc"
+
+    UNUSED(_self);
+    Parrot_io_printf(interp, "test_method0\n");
+    Parrot_io_printf(interp, "%d\n", a1);
+#line 109 "./src/dynpmc/pccmethod_test.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_PCCMETHOD_Test_nci_test_method1(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    INTVAL a1;
+    INTVAL a2;
+    INTVAL a3;
+    INTVAL a4;
+    INTVAL a5;
+    INTVAL a6;
+    
+    const INTVAL arity = 7; /* "PiIIIIII" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    a1 = VTABLE_get_integer_keyed_int(interp, _call_object, 1);
+    a2 = VTABLE_get_integer_keyed_int(interp, _call_object, 2);
+    a3 = VTABLE_get_integer_keyed_int(interp, _call_object, 3);
+    a4 = VTABLE_get_integer_keyed_int(interp, _call_object, 4);
+    a5 = VTABLE_get_integer_keyed_int(interp, _call_object, 5);
+    a6 = VTABLE_get_integer_keyed_int(interp, _call_object, 6);
+
+    { /* BEGIN PMETHOD BODY */
+#line 33 "./src/dynpmc/pccmethod_test.pmc"
+
+    UNUSED(_self);
+    Parrot_io_printf(interp, "test_method1\n");
+    Parrot_io_printf(interp, "%d,%d,%d,%d,%d,%d\n", a1, a2, a3, a4, a5, a6);
+#line 153 "./src/dynpmc/pccmethod_test.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_PCCMETHOD_Test_nci_test_method2(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    INTVAL a1;
+    INTVAL a1o;
+    PMC* slurpy_pos;
+    
+    Parrot_pcc_fill_params_from_c_args(interp, _call_object, "PiIoIpPs",
+        &_self, &a1, &a1o, &slurpy_pos);
+
+    { /* BEGIN PMETHOD BODY */
+#line 41 "./src/dynpmc/pccmethod_test.pmc"
+
+    STRING *kevin = CONST_STRING(interp, "KEVIN");
+    UNUSED(_self);
+    Parrot_io_printf(interp, "test_method2\n");
+    Parrot_io_printf(interp, "%d, %d, %Ss %Ss\n", a1, a1o,
+        VTABLE_name(interp, slurpy_pos),
+        VTABLE_get_repr(interp, slurpy_pos));
+
+    #line 186 "./src/dynpmc/pccmethod_test.c"
+    {  /*BEGIN RETURN int 1000, STRING *kevin */
+        Parrot_pcc_set_call_from_c_args(interp, _call_object,
+            "IS", (INTVAL)1000, (STRING*)kevin);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return;
+    }   /*END RETURN int 1000, STRING *kevin */
+#line 49 "./src/dynpmc/pccmethod_test.pmc"
+
+#line 195 "./src/dynpmc/pccmethod_test.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_PCCMETHOD_Test_nci_test_method3(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* _param_name_str_a1name = CONST_STRING_GEN(interp, "a1name");
+    PMC* a1;
+    STRING* _param_name_str_a2name = CONST_STRING_GEN(interp, "a2name");
+    PMC* a2;
+    
+    Parrot_pcc_fill_params_from_c_args(interp, _call_object, "PiSnPSnP",
+        &_self, &_param_name_str_a1name, &a1, &_param_name_str_a2name, &a2);
+
+    { /* BEGIN PMETHOD BODY */
+#line 53 "./src/dynpmc/pccmethod_test.pmc"
+
+    UNUSED(_self);
+    Parrot_io_printf(interp, "test_method3\n");
+    Parrot_io_printf(interp, "%Ps, %Ps\n", a1, a2);
+#line 225 "./src/dynpmc/pccmethod_test.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_PCCMETHOD_Test_nci_test_method4(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    INTVAL george;
+    INTVAL g_f;
+    PMC* slurpy_pos;
+    PMC* slurpy_named;
+    
+    Parrot_pcc_fill_params_from_c_args(interp, _call_object, "PiIoIpPsPns",
+        &_self, &george, &g_f, &slurpy_pos, &slurpy_named);
+
+    { /* BEGIN PMETHOD BODY */
+#line 61 "./src/dynpmc/pccmethod_test.pmc"
+
+    UNUSED(_self);
+    UNUSED(george);
+    UNUSED(g_f);
+    UNUSED(slurpy_pos);
+    UNUSED(slurpy_named);
+    Parrot_io_printf(interp, "test_method4\n");
+#line 258 "./src/dynpmc/pccmethod_test.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+#include "pmc_default.h"
+
+PARROT_DYNEXT_EXPORT 
+VTABLE *Parrot_PCCMETHOD_Test_update_vtable(VTABLE *vt) {
+
+    return vt;
+}
+
+
+PARROT_DYNEXT_EXPORT 
+VTABLE *Parrot_PCCMETHOD_Test_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+
+    return vt;
+}
+
+PARROT_DYNEXT_EXPORT 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_PCCMETHOD_Test_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_PCCMETHOD_Test_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_DYNEXT_EXPORT 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_PCCMETHOD_Test_get_vtable_pointer(PARROT_INTERP) {
+    STRING * const type_name = Parrot_str_new_constant(interp, "PCCMETHOD_Test");
+    const INTVAL type_num  = Parrot_pmc_get_type_str(interp, type_name);
+    return interp->vtables[type_num];
+}
+
+PARROT_DYNEXT_EXPORT 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_PCCMETHOD_Test_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_PCCMETHOD_Test_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_DYNEXT_EXPORT 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_PCCMETHOD_Test_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "PCCMETHOD_Test"));
+    return mro;
+}
+
+PARROT_DYNEXT_EXPORT 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_PCCMETHOD_Test_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "PCCMETHOD_Test")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_PCCMETHOD_Test_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_PCCMETHOD_Test_get_vtable(interp);
+        vt->base_type      = -1;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->base_type    = entry;
+        vt->whoami       = Parrot_str_new_init(interp, "PCCMETHOD_Test", 14,
+                                       Parrot_ascii_encoding_ptr, PObj_constant_FLAG|PObj_external_FLAG);
+        vt->provides_str = Parrot_str_concat(interp, vt->provides_str,
+            Parrot_str_new_init(interp, "hash", 4, Parrot_ascii_encoding_ptr,
+            PObj_constant_FLAG|PObj_external_FLAG));
+
+        vt->isa_hash     = Parrot_PCCMETHOD_Test_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_PCCMETHOD_Test_ro_get_vtable(interp);
+            vt_ro->base_type           = -1;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_PCCMETHOD_Test_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "test_method");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_PCCMETHOD_Test_nci_test_method),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "test_method0");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_PCCMETHOD_Test_nci_test_method0),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "test_method1");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_PCCMETHOD_Test_nci_test_method1),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "test_method2");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_PCCMETHOD_Test_nci_test_method2),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "test_method3");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_PCCMETHOD_Test_nci_test_method3),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "test_method4");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_PCCMETHOD_Test_nci_test_method4),
+                method_name, signature);
+        }
+        {
+        }
+    } /* pass */
+} /* Parrot_PCCMETHOD_Test_class_init */
+
+INTVAL dynpmc_class_PCCMETHOD_Test;
+
+/*
+ * This load function will be called to do global (once) setup
+ * whatever is needed to get this extension running
+ */
+
+PARROT_DYNEXT_EXPORT Parrot_PMC Parrot_lib_pccmethod_test_load(PARROT_INTERP)
+{
+    Parrot_String whoami;
+    Parrot_PMC    pmc;
+    int pass;
+
+    /* create a library PMC */
+    pmc = Parrot_pmc_new(interp, enum_class_ParrotLibrary);
+
+    /* for all PMCs we want to register: */
+    whoami = CONST_STRING_GEN(interp, "PCCMETHOD_Test");
+    dynpmc_class_PCCMETHOD_Test = Parrot_pmc_register_new_type(interp, whoami);
+
+    /* do class_init code */
+    for (pass = 0; pass <= 1; ++pass) {
+        Parrot_PCCMETHOD_Test_class_init(interp, dynpmc_class_PCCMETHOD_Test, pass);
+    }
+    return pmc;
+}
+
+#line 68 "./src/dynpmc/pccmethod_test.pmc"
+
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -0,0 +1,98 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/dynpmc/dynlexpad.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_DYNLEXPAD_H_GUARD
+#define PARROT_PMC_DYNLEXPAD_H_GUARD
+
+#define PARROT_IN_EXTENSION
+PARROT_DYNEXT_EXPORT VTABLE* Parrot_DynLexPad_get_vtable_pointer(PARROT_INTERP);
+PARROT_DYNEXT_EXPORT void    Parrot_DynLexPad_class_init(PARROT_INTERP, int, int);
+PARROT_DYNEXT_EXPORT VTABLE* Parrot_DynLexPad_update_vtable(ARGMOD(VTABLE*));
+PARROT_DYNEXT_EXPORT VTABLE* Parrot_DynLexPad_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_DYNEXT_EXPORT VTABLE* Parrot_DynLexPad_get_vtable(PARROT_INTERP);
+PARROT_DYNEXT_EXPORT VTABLE* Parrot_DynLexPad_ro_get_vtable(PARROT_INTERP);
+PARROT_DYNEXT_EXPORT PMC*    Parrot_DynLexPad_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_DYNEXT_EXPORT Hash*   Parrot_DynLexPad_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* DynLexPad PMC's underlying struct. */
+typedef struct Parrot_DynLexPad_attributes {
+    Hash * hash;
+    PMC  * init;
+} Parrot_DynLexPad_attributes;
+
+/* Macro to access underlying structure of a DynLexPad PMC. */
+#define PARROT_DYNLEXPAD(o) ((Parrot_DynLexPad_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'hash' attribute of DynLexPad PMC. */
+#define GETATTR_DynLexPad_hash(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_DynLexPad_attributes *)PMC_data(pmc))->hash; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'Hash *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_DynLexPad_hash(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'Hash *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_DynLexPad_attributes *)PMC_data(pmc))->hash = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'init' attribute of DynLexPad PMC. */
+#define GETATTR_DynLexPad_init(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_DynLexPad_attributes *)PMC_data(pmc))->init; \
+        } \
+        else { \
+            (dest) = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "init")); \
+        } \
+    } while (0)
+#define SETATTR_DynLexPad_init(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "init"), value); \
+        } \
+        else \
+            ((Parrot_DynLexPad_attributes *)PMC_data(pmc))->init = (value); \
+    } while (0)
+
+
+PARROT_DYNEXT_EXPORT Parrot_PMC Parrot_lib_dynlexpad_load(PARROT_INTERP);
+
+#ifndef PARROT_DYNPMC_CLASS_LOAD
+PARROT_DATA INTVAL dynpmc_class_DynLexPad;
+#endif
+
+#endif /* PARROT_PMC_DYNLEXPAD_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
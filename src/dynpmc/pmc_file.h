@@ -0,0 +1,42 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/dynpmc/file.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_FILE_H_GUARD
+#define PARROT_PMC_FILE_H_GUARD
+
+#define PARROT_IN_EXTENSION
+PARROT_DYNEXT_EXPORT VTABLE* Parrot_File_get_vtable_pointer(PARROT_INTERP);
+PARROT_DYNEXT_EXPORT void    Parrot_File_class_init(PARROT_INTERP, int, int);
+PARROT_DYNEXT_EXPORT VTABLE* Parrot_File_update_vtable(ARGMOD(VTABLE*));
+PARROT_DYNEXT_EXPORT VTABLE* Parrot_File_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_DYNEXT_EXPORT VTABLE* Parrot_File_get_vtable(PARROT_INTERP);
+PARROT_DYNEXT_EXPORT VTABLE* Parrot_File_ro_get_vtable(PARROT_INTERP);
+PARROT_DYNEXT_EXPORT PMC*    Parrot_File_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_DYNEXT_EXPORT Hash*   Parrot_File_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+PARROT_DYNEXT_EXPORT Parrot_PMC Parrot_lib_file_load(PARROT_INTERP);
+
+#ifndef PARROT_DYNPMC_CLASS_LOAD
+PARROT_DATA INTVAL dynpmc_class_File;
+#endif
+
+#endif /* PARROT_PMC_FILE_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
@@ -0,0 +1,75 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/dynpmc/foo2.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_FOO2_H_GUARD
+#define PARROT_PMC_FOO2_H_GUARD
+
+#define PARROT_IN_EXTENSION
+PARROT_DYNEXT_EXPORT VTABLE* Parrot_Foo2_get_vtable_pointer(PARROT_INTERP);
+PARROT_DYNEXT_EXPORT void    Parrot_Foo2_class_init(PARROT_INTERP, int, int);
+PARROT_DYNEXT_EXPORT VTABLE* Parrot_Foo2_update_vtable(ARGMOD(VTABLE*));
+PARROT_DYNEXT_EXPORT VTABLE* Parrot_Foo2_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_DYNEXT_EXPORT VTABLE* Parrot_Foo2_get_vtable(PARROT_INTERP);
+PARROT_DYNEXT_EXPORT VTABLE* Parrot_Foo2_ro_get_vtable(PARROT_INTERP);
+PARROT_DYNEXT_EXPORT PMC*    Parrot_Foo2_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_DYNEXT_EXPORT Hash*   Parrot_Foo2_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* Foo2 PMC's underlying struct. */
+typedef struct Parrot_Foo2_attributes {
+    INTVAL iv;
+} Parrot_Foo2_attributes;
+
+/* Macro to access underlying structure of a Foo2 PMC. */
+#define PARROT_FOO2(o) ((Parrot_Foo2_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'iv' attribute of Foo2 PMC. */
+#define GETATTR_Foo2_iv(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_Foo2_attributes *)PMC_data(pmc))->iv; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "iv")); \
+            (dest) = (PMC_IS_NULL(attr_value) ? (INTVAL) 0: VTABLE_get_integer(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_Foo2_iv(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new_init_int(interp, enum_class_Integer, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "iv"), attr_value); \
+        } \
+        else \
+            ((Parrot_Foo2_attributes *)PMC_data(pmc))->iv = (value); \
+    } while (0)
+
+
+PARROT_DYNEXT_EXPORT Parrot_PMC Parrot_lib_foo2_load(PARROT_INTERP);
+
+#ifndef PARROT_DYNPMC_CLASS_LOAD
+PARROT_DATA INTVAL dynpmc_class_Foo2;
+#endif
+
+#endif /* PARROT_PMC_FOO2_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
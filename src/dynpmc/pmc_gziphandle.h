@@ -0,0 +1,228 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/dynpmc/gziphandle.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+
+#ifndef PARROT_PMC_GZIPHANDLE_H_GUARD
+#define PARROT_PMC_GZIPHANDLE_H_GUARD
+
+#define PARROT_IN_EXTENSION
+#include <zlib.h>
+PARROT_DYNEXT_EXPORT VTABLE* Parrot_GzipHandle_get_vtable_pointer(PARROT_INTERP);
+PARROT_DYNEXT_EXPORT void    Parrot_GzipHandle_class_init(PARROT_INTERP, int, int);
+PARROT_DYNEXT_EXPORT VTABLE* Parrot_GzipHandle_update_vtable(ARGMOD(VTABLE*));
+PARROT_DYNEXT_EXPORT VTABLE* Parrot_GzipHandle_ro_update_vtable(ARGMOD(VTABLE*));
+PARROT_DYNEXT_EXPORT VTABLE* Parrot_GzipHandle_get_vtable(PARROT_INTERP);
+PARROT_DYNEXT_EXPORT VTABLE* Parrot_GzipHandle_ro_get_vtable(PARROT_INTERP);
+PARROT_DYNEXT_EXPORT PMC*    Parrot_GzipHandle_get_mro(PARROT_INTERP, ARGMOD(PMC* mro));
+PARROT_DYNEXT_EXPORT Hash*   Parrot_GzipHandle_get_isa(PARROT_INTERP, ARGMOD_NULLOK(Hash* isa));
+
+/* GzipHandle PMC's underlying struct. */
+typedef struct Parrot_GzipHandle_attributes {
+    PIOHANDLE os_handle;
+    STRING    * record_separator;
+    IO_VTABLE * io_vtable;
+    IO_BUFFER * read_buffer;
+    IO_BUFFER * write_buffer;
+    STRING * encoding;
+    gzFile file;
+} Parrot_GzipHandle_attributes;
+
+/* Macro to access underlying structure of a GzipHandle PMC. */
+#define PARROT_GZIPHANDLE(o) ((Parrot_GzipHandle_attributes *) PMC_data(o))
+
+
+/* Generated macro accessors for 'os_handle' attribute of GzipHandle PMC. */
+#define GETATTR_GzipHandle_os_handle(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_GzipHandle_attributes *)PMC_data(pmc))->os_handle; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'PIOHANDLE' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_GzipHandle_os_handle(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'PIOHANDLE' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_GzipHandle_attributes *)PMC_data(pmc))->os_handle = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'record_separator' attribute of GzipHandle PMC. */
+#define GETATTR_GzipHandle_record_separator(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_GzipHandle_attributes *)PMC_data(pmc))->record_separator; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "record_separator")); \
+            (dest) =  (PMC_IS_NULL(attr_value) ? (STRING *)NULL : VTABLE_get_string(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_GzipHandle_record_separator(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new(interp, enum_class_String); \
+            VTABLE_set_string_native(interp, attr_value, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "record_separator"), attr_value); \
+        } \
+        else \
+            ((Parrot_GzipHandle_attributes *)PMC_data(pmc))->record_separator = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'io_vtable' attribute of GzipHandle PMC. */
+#define GETATTR_GzipHandle_io_vtable(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_GzipHandle_attributes *)PMC_data(pmc))->io_vtable; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'IO_VTABLE *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_GzipHandle_io_vtable(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'IO_VTABLE *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_GzipHandle_attributes *)PMC_data(pmc))->io_vtable = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'read_buffer' attribute of GzipHandle PMC. */
+#define GETATTR_GzipHandle_read_buffer(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_GzipHandle_attributes *)PMC_data(pmc))->read_buffer; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'IO_BUFFER *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_GzipHandle_read_buffer(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'IO_BUFFER *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_GzipHandle_attributes *)PMC_data(pmc))->read_buffer = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'write_buffer' attribute of GzipHandle PMC. */
+#define GETATTR_GzipHandle_write_buffer(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_GzipHandle_attributes *)PMC_data(pmc))->write_buffer; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'IO_BUFFER *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_GzipHandle_write_buffer(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'IO_BUFFER *' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_GzipHandle_attributes *)PMC_data(pmc))->write_buffer = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'encoding' attribute of GzipHandle PMC. */
+#define GETATTR_GzipHandle_encoding(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_GzipHandle_attributes *)PMC_data(pmc))->encoding; \
+        } \
+        else { \
+            PMC * const attr_value = VTABLE_get_attr_str(interp, \
+                              pmc, Parrot_str_new_constant(interp, "encoding")); \
+            (dest) =  (PMC_IS_NULL(attr_value) ? (STRING *)NULL : VTABLE_get_string(interp, attr_value)); \
+        } \
+    } while (0)
+#define SETATTR_GzipHandle_encoding(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            PMC * const attr_value = Parrot_pmc_new(interp, enum_class_String); \
+            VTABLE_set_string_native(interp, attr_value, value); \
+            VTABLE_set_attr_str(interp, pmc, \
+                              Parrot_str_new_constant(interp, "encoding"), attr_value); \
+        } \
+        else \
+            ((Parrot_GzipHandle_attributes *)PMC_data(pmc))->encoding = (value); \
+    } while (0)
+
+
+/* Generated macro accessors for 'file' attribute of GzipHandle PMC. */
+#define GETATTR_GzipHandle_file(interp, pmc, dest) \
+    do { \
+        if (!PObj_is_object_TEST(pmc)) { \
+            (dest) = ((Parrot_GzipHandle_attributes *)PMC_data(pmc))->file; \
+        } \
+        else { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'gzFile' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+    } while (0)
+#define SETATTR_GzipHandle_file(interp, pmc, value) \
+    do { \
+        if (PObj_is_object_TEST(pmc)) { \
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, \
+                "Attributes of type 'gzFile' cannot be " \
+                "subclassed from a high-level PMC."); \
+        } \
+        else \
+            ((Parrot_GzipHandle_attributes *)PMC_data(pmc))->file = (value); \
+    } while (0)
+
+
+PARROT_DYNEXT_EXPORT Parrot_PMC Parrot_lib_gziphandle_load(PARROT_INTERP);
+
+#ifndef PARROT_DYNPMC_CLASS_LOAD
+PARROT_DATA INTVAL dynpmc_class_GzipHandle;
+#endif
+
+#endif /* PARROT_PMC_GZIPHANDLE_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
+
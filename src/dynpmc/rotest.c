@@ -0,0 +1,326 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/dynpmc/rotest.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#define PARROT_IN_EXTENSION
+#define PARROT_DYNPMC_CLASS_LOAD
+#define CONST_STRING(i, s) Parrot_str_new_constant((i), s)
+#define CONST_STRING_GEN(i, s) Parrot_str_new_constant((i), s)
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_fixedintegerarray.h"
+#include "pmc_rotest.h"
+#include "pmc_integer.h"
+#include "pmc_scalar.h"
+#include "pmc_default.h"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#undef PARROT_DYNPMC_CLASS_LOAD
+#line 1 "./src/dynpmc/rotest.pmc"
+/*
+ * Copyright (C) 2006-2012, Parrot Foundation.
+ */
+
+/*
+ * Sample class used to verify read-only variant
+ * generation.  For testing only.
+ */
+#line 38 "./src/dynpmc/rotest.c"
+static  INTVAL  Parrot_ROTest_get_integer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_ROTest_set_integer_native(SHIM_INTERP, SHIM(PMC *_self), SHIM(INTVAL value));
+static  void Parrot_ROTest_nci_reader(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_ROTest_nci_writer(PARROT_INTERP, ARGMOD(PMC *_self));
+PARROT_DYNEXT_EXPORT void    Parrot_ROTest_class_init(PARROT_INTERP, int, int);
+PARROT_DYNEXT_EXPORT VTABLE* Parrot_ROTest_get_vtable_pointer(PARROT_INTERP);
+static  INTVAL Parrot_ROTest_ro_get_integer(PARROT_INTERP, SHIM(PMC *_self));
+PARROT_DYNEXT_EXPORT void    Parrot_ROTest_ro_class_init(PARROT_INTERP, int, int);
+PARROT_DYNEXT_EXPORT VTABLE* Parrot_ROTest_ro_get_vtable_pointer(PARROT_INTERP);
+static  INTVAL 
+Parrot_ROTest_get_integer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 18 "./src/dynpmc/rotest.pmc"
+
+    /**/UNUSED(interp)
+    /**/UNUSED(_self)
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+    return 42;
+#line 57 "./src/dynpmc/rotest.c"
+}
+static  void 
+Parrot_ROTest_set_integer_native(SHIM_INTERP, SHIM(PMC *_self), SHIM(INTVAL value))
+{
+#line 12 "./src/dynpmc/rotest.pmc"
+#line 63 "./src/dynpmc/rotest.c"
+}
+static  void
+Parrot_ROTest_nci_reader(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 24 "./src/dynpmc/rotest.pmc"
+
+    #line 85 "./src/dynpmc/rotest.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)43);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return;
+     }
+#line 25 "./src/dynpmc/rotest.pmc"
+
+#line 93 "./src/dynpmc/rotest.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_ROTest_nci_writer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    INTVAL ignored;
+    
+    const INTVAL arity = 2; /* "PiI" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    ignored = VTABLE_get_integer_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 28 "./src/dynpmc/rotest.pmc"
+
+    UNUSED(ignored);
+    #line 125 "./src/dynpmc/rotest.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)44);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return;
+     }
+#line 30 "./src/dynpmc/rotest.pmc"
+
+#line 133 "./src/dynpmc/rotest.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  INTVAL
+Parrot_ROTest_ro_get_integer(PARROT_INTERP, SHIM(PMC *_self))
+{
+Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_WRITE_TO_CONSTCLASS,
+        "get_integer() in read-only instance of ROTest");
+}
+#include "pmc_default.h"
+
+PARROT_DYNEXT_EXPORT 
+VTABLE *Parrot_ROTest_update_vtable(VTABLE *vt) {
+    vt->get_integer = Parrot_ROTest_get_integer;
+    vt->set_integer_native = Parrot_ROTest_set_integer_native;
+    vt->attr_size = sizeof(Parrot_ROTest_attributes);
+
+    return vt;
+}
+
+
+PARROT_DYNEXT_EXPORT 
+VTABLE *Parrot_ROTest_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->get_integer = Parrot_ROTest_ro_get_integer;
+    vt->set_integer_native = Parrot_ROTest_set_integer_native;
+    vt->attr_size = sizeof(Parrot_ROTest_attributes);
+
+    return vt;
+}
+
+PARROT_DYNEXT_EXPORT 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_ROTest_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_Integer_get_vtable(interp);
+    Parrot_ROTest_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_DYNEXT_EXPORT 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_ROTest_get_vtable_pointer(PARROT_INTERP) {
+    STRING * const type_name = Parrot_str_new_constant(interp, "ROTest");
+    const INTVAL type_num  = Parrot_pmc_get_type_str(interp, type_name);
+    return interp->vtables[type_num];
+}
+
+PARROT_DYNEXT_EXPORT 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_ROTest_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_Integer_ro_get_vtable(interp);
+    Parrot_ROTest_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_DYNEXT_EXPORT 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_ROTest_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+    mro = Parrot_Integer_get_mro(interp, mro);
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "ROTest"));
+    return mro;
+}
+
+PARROT_DYNEXT_EXPORT 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_ROTest_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    isa = Parrot_Integer_get_isa(interp, isa);
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "ROTest")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_ROTest_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "Iiv ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_ROTest_get_vtable(interp);
+        vt->base_type      = -1;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->base_type    = entry;
+        vt->whoami       = Parrot_str_new_init(interp, "ROTest", 6,
+                                       Parrot_ascii_encoding_ptr, PObj_constant_FLAG|PObj_external_FLAG);
+        vt->provides_str = Parrot_str_concat(interp, vt->provides_str,
+            Parrot_str_new_init(interp, "scalar", 6, Parrot_ascii_encoding_ptr,
+            PObj_constant_FLAG|PObj_external_FLAG));
+
+        vt->isa_hash     = Parrot_ROTest_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_ROTest_ro_get_vtable(interp);
+            vt_ro->base_type           = -1;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_ROTest_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "reader");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_ROTest_nci_reader),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "writer");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_ROTest_nci_writer),
+                method_name, signature);
+        }
+        Parrot_interp_mark_method_writes(interp, entry, "writer");
+        {
+        }
+    } /* pass */
+} /* Parrot_ROTest_class_init */
+
+INTVAL dynpmc_class_ROTest;
+
+/*
+ * This load function will be called to do global (once) setup
+ * whatever is needed to get this extension running
+ */
+
+PARROT_DYNEXT_EXPORT Parrot_PMC Parrot_lib_rotest_load(PARROT_INTERP)
+{
+    Parrot_String whoami;
+    Parrot_PMC    pmc;
+    int pass;
+
+    /* create a library PMC */
+    pmc = Parrot_pmc_new(interp, enum_class_ParrotLibrary);
+
+    /* for all PMCs we want to register: */
+    whoami = CONST_STRING_GEN(interp, "ROTest");
+    dynpmc_class_ROTest = Parrot_pmc_register_new_type(interp, whoami);
+
+    /* do class_init code */
+    for (pass = 0; pass <= 1; ++pass) {
+        Parrot_ROTest_class_init(interp, dynpmc_class_ROTest, pass);
+    }
+    return pmc;
+}
+
+#line 31 "./src/dynpmc/rotest.pmc"
+
+
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
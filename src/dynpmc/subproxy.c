@@ -0,0 +1,270 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/dynpmc/subproxy.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#define PARROT_IN_EXTENSION
+#define PARROT_DYNPMC_CLASS_LOAD
+#define CONST_STRING(i, s) Parrot_str_new_constant((i), s)
+#define CONST_STRING_GEN(i, s) Parrot_str_new_constant((i), s)
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_subproxy.h"
+#include "pmc_sub.h"
+#include "pmc_default.h"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#undef PARROT_DYNPMC_CLASS_LOAD
+#line 1 "./src/dynpmc/subproxy.pmc"
+/*
+Copyright (C) 2003-2012, Parrot Foundation.
+ */
+
+/*
+ * Sample SubProxy class
+ *
+ * s. src/dynpmc/main.pasm for usage
+ */
+
+/*
+ * the real class enum is created at load time
+ */
+#define enum_class_SubProxy -1
+#line 42 "./src/dynpmc/subproxy.c"
+static  void  Parrot_SubProxy_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  opcode_t*  Parrot_SubProxy_invoke(PARROT_INTERP, ARGMOD(PMC *_self), void *next);
+static  void  Parrot_SubProxy_set_pmc(SHIM_INTERP, ARGMOD(PMC *_self), PMC *key);
+PARROT_DYNEXT_EXPORT void    Parrot_SubProxy_class_init(PARROT_INTERP, int, int);
+PARROT_DYNEXT_EXPORT VTABLE* Parrot_SubProxy_get_vtable_pointer(PARROT_INTERP);
+PARROT_DYNEXT_EXPORT void    Parrot_SubProxy_ro_class_init(PARROT_INTERP, int, int);
+PARROT_DYNEXT_EXPORT VTABLE* Parrot_SubProxy_ro_get_vtable_pointer(PARROT_INTERP);
+static  void 
+Parrot_SubProxy_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 18 "./src/dynpmc/subproxy.pmc"
+
+    interp->vtables[enum_class_Sub]->init(interp, _self);
+    PObj_get_FLAGS(_self) |= PObj_private0_FLAG;
+#line 57 "./src/dynpmc/subproxy.c"
+}
+static  opcode_t* 
+Parrot_SubProxy_invoke(PARROT_INTERP, ARGMOD(PMC *_self), void *next)
+{
+#line 28 "./src/dynpmc/subproxy.pmc"
+
+    if (PObj_get_FLAGS(_self) & PObj_private0_FLAG) {
+
+        PMC         * const key = PMC_data_typed(_self, PMC *);
+        STRING      *file;
+        PMC         *rsub_pmc, *sub_pmc;
+        Parrot_Sub_attributes  *rsub,     *my_sub;
+
+        if (!key)
+            Parrot_ex_throw_from_c_args(interp, NULL, 1, "SubProxy: no key");
+
+        file = VTABLE_get_string(interp, key);
+        if (!file)
+            Parrot_ex_throw_from_c_args(interp, NULL, 1, "SubProxy: no file");
+
+        sub_pmc = Parrot_key_next(interp, key);
+        if (!sub_pmc)
+            Parrot_ex_throw_from_c_args(interp, NULL, 1, "SubProxy: no sub");
+
+        Parrot_load_bytecode(interp, file);
+        rsub_pmc = VTABLE_get_pmc_keyed(interp,
+                interp->root_namespace, sub_pmc);
+
+        if (!VTABLE_defined(interp, rsub_pmc))
+            Parrot_ex_throw_from_c_args(interp, NULL, 1,
+                "SubProxy: sub not found");
+
+        PObj_get_FLAGS(_self) &= ~PObj_private0_FLAG;
+        PMC_get_sub(interp, _self,     my_sub);
+        PMC_get_sub(interp, rsub_pmc, rsub);
+        my_sub->seg        = rsub->seg;
+        my_sub->start_offs = rsub->start_offs;
+        my_sub->end_offs   = rsub->end_offs;
+    }
+    return interp->vtables[enum_class_Sub]->invoke(interp, _self, next);
+#line 98 "./src/dynpmc/subproxy.c"
+}
+static  void 
+Parrot_SubProxy_set_pmc(SHIM_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 23 "./src/dynpmc/subproxy.pmc"
+    PMC_data(_self) = key;
+#line 105 "./src/dynpmc/subproxy.c"
+}
+#include "pmc_default.h"
+
+PARROT_DYNEXT_EXPORT 
+VTABLE *Parrot_SubProxy_update_vtable(VTABLE *vt) {
+    vt->init = Parrot_SubProxy_init;
+    vt->invoke = Parrot_SubProxy_invoke;
+    vt->set_pmc = Parrot_SubProxy_set_pmc;
+    vt->attr_size = sizeof(Parrot_SubProxy_attributes);
+
+    return vt;
+}
+
+
+PARROT_DYNEXT_EXPORT 
+VTABLE *Parrot_SubProxy_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->invoke = Parrot_SubProxy_invoke;
+    vt->attr_size = sizeof(Parrot_SubProxy_attributes);
+
+    return vt;
+}
+
+PARROT_DYNEXT_EXPORT 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_SubProxy_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_Sub_get_vtable(interp);
+    Parrot_SubProxy_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_DYNEXT_EXPORT 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_SubProxy_get_vtable_pointer(PARROT_INTERP) {
+    STRING * const type_name = Parrot_str_new_constant(interp, "SubProxy");
+    const INTVAL type_num  = Parrot_pmc_get_type_str(interp, type_name);
+    return interp->vtables[type_num];
+}
+
+PARROT_DYNEXT_EXPORT 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_SubProxy_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_Sub_ro_get_vtable(interp);
+    Parrot_SubProxy_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_DYNEXT_EXPORT 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_SubProxy_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+    mro = Parrot_Sub_get_mro(interp, mro);
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "SubProxy"));
+    return mro;
+}
+
+PARROT_DYNEXT_EXPORT 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_SubProxy_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    isa = Parrot_Sub_get_isa(interp, isa);
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "SubProxy")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_SubProxy_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        ":seg :start_offs :end_offs IHLL_id Fnamespace_name Fnamespace_stash Sname Smethod_name Sns_entry_name Ssubid Ivtable_index Fmulti_signature :n_regs_used Flex_info Fouter_sub Fctx :comp_flags :arg_info Fouter_ctx ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_SubProxy_get_vtable(interp);
+        vt->base_type      = -1;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->base_type    = entry;
+        vt->whoami       = Parrot_str_new_init(interp, "SubProxy", 8,
+                                       Parrot_ascii_encoding_ptr, PObj_constant_FLAG|PObj_external_FLAG);
+        vt->provides_str = Parrot_str_concat(interp, vt->provides_str,
+            Parrot_str_new_init(interp, "scalar", 6, Parrot_ascii_encoding_ptr,
+            PObj_constant_FLAG|PObj_external_FLAG));
+
+        vt->isa_hash     = Parrot_SubProxy_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_SubProxy_ro_get_vtable(interp);
+            vt_ro->base_type           = -1;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_SubProxy_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+        }
+    } /* pass */
+} /* Parrot_SubProxy_class_init */
+
+INTVAL dynpmc_class_SubProxy;
+
+/*
+ * This load function will be called to do global (once) setup
+ * whatever is needed to get this extension running
+ */
+
+PARROT_DYNEXT_EXPORT Parrot_PMC Parrot_lib_subproxy_load(PARROT_INTERP)
+{
+    Parrot_String whoami;
+    Parrot_PMC    pmc;
+    int pass;
+
+    /* create a library PMC */
+    pmc = Parrot_pmc_new(interp, enum_class_ParrotLibrary);
+
+    /* for all PMCs we want to register: */
+    whoami = CONST_STRING_GEN(interp, "SubProxy");
+    dynpmc_class_SubProxy = Parrot_pmc_register_new_type(interp, whoami);
+
+    /* do class_init code */
+    for (pass = 0; pass <= 1; ++pass) {
+        Parrot_SubProxy_class_init(interp, dynpmc_class_SubProxy, pass);
+    }
+    return pmc;
+}
+
+#line 63 "./src/dynpmc/subproxy.pmc"
+
+
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -137,14 +137,15 @@ Parrot_api_make_interpreter(Parrot_PMC parent, Parrot_Int flags,
     else {
         interp_raw->api_jmp_buf = &env;
         if (args) {
-            gc_args.stacktop          = args->stacktop
-                                      ? args->stacktop : &alt_stacktop;
-            gc_args.system            = args->gc_system;
-            gc_args.nursery_size      = args->gc_nursery_size;
-            gc_args.dynamic_threshold = args->gc_dynamic_threshold;
-            gc_args.min_threshold     = args->gc_min_threshold;
-            gc_args.debug_flags       = args->debug_flags;
-            gc_args.numthreads        = args->numthreads;
+            gc_args.stacktop           = args->stacktop
+                                       ? args->stacktop : &alt_stacktop;
+            gc_args.system             = args->gc_system;
+            gc_args.nursery_size       = args->gc_nursery_size;
+            gc_args.dynamic_threshold  = args->gc_dynamic_threshold;
+            gc_args.min_threshold      = args->gc_min_threshold;
+            gc_args.evacuate_threshold = args->gc_evacuate_threshold;
+            gc_args.debug_flags        = args->debug_flags;
+            gc_args.numthreads         = args->numthreads;
 
             if (args->hash_seed)
                 interp_raw->hash_seed = args->hash_seed;
@@ -201,10 +202,8 @@ Parrot_api_set_runcore(Parrot_PMC interp_pmc, ARGIN(const char * corename),
             Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, "subprof_hll"));
         else if (STREQ(corename, "subprof_ops"))
             Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, corename));
-#if 0
         else if (STREQ(corename, "exec"))
             Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, corename));
-#endif
         else if (STREQ(corename, "profiling"))
             Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, corename));
         else if (STREQ(corename, "gc_debug"))
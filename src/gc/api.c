@@ -58,6 +58,11 @@ The infinite allocator is not recommended except for debugging.
 The default is currently gc_ms2.c but is expected to move to gc_gms.c
 after RELEASE_3_3_0.
 
+=item F<src/gc/gc_events.c>
+
+This file keeps a log of recent collections, which collectors fill in as they
+run, and optionally traces them to a file and samples allocation sites.
+
 =item F<src/gc/mark_sweep.c>
 
 This file implements some generic utility functions that are commonly needed by
@@ -189,6 +194,8 @@ Parrot_gc_initialize(PARROT_INTERP, ARGIN(Parrot_GC_Init_Args *args))
 
     interp->lo_var_ptr = args->stacktop;
 
+    interp->gc_sys->events.epoch = Parrot_hires_get_time();
+
     interp->gc_sys->sys_type = PARROT_GC_DEFAULT_TYPE;
 
     if (args->system != NULL) {
@@ -396,6 +403,10 @@ void
 Parrot_gc_free_string_header(PARROT_INTERP, ARGMOD(STRING *s))
 {
     ASSERT_ARGS(Parrot_gc_free_string_header)
+
+    if (STRING_interned_TEST(s))
+        Parrot_str_intern_forget(interp, s);
+
     interp->gc_sys->free_string_header(interp, s);
 }
 
@@ -857,6 +868,34 @@ Return the number of memory allocations made since the last collection run.
 
 Returns the number of PMCs that are marked as needing timely destruction.
 
+=item C<size_t Parrot_gc_fixed_size_arenas(PARROT_INTERP)>
+
+Return the number of arenas held by the fixed-size (attribute) allocator.
+
+=item C<size_t Parrot_gc_fixed_size_free_memory(PARROT_INTERP)>
+
+Return the number of bytes inside fixed-size arenas not used by any object.
+High values relative to the arena count mean fragmentation.
+
+=item C<size_t Parrot_gc_total_evacuated(PARROT_INTERP)>
+
+Return the number of objects moved out of sparse fixed-size arenas.
+
+=item C<size_t Parrot_gc_arenas_released(PARROT_INTERP)>
+
+Return the number of fixed-size arenas returned to the system after
+evacuation.
+
+=item C<size_t Parrot_gc_shared_buffers_moved(PARROT_INTERP)>
+
+Return the number of copy-on-write shared buffers which string compaction
+relinked to already moved storage instead of copying.
+
+=item C<UINTVAL Parrot_gc_total_shared(PARROT_INTERP)>
+
+Return the number of bytes string compaction didn't copy because the storage
+was shared.
+
 =cut
 
 */
@@ -933,6 +972,54 @@ Parrot_gc_impatient_pmcs(PARROT_INTERP)
     return interp->gc_sys->get_gc_info(interp, IMPATIENT_PMCS);
 }
 
+PARROT_EXPORT
+size_t
+Parrot_gc_fixed_size_arenas(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_gc_fixed_size_arenas)
+    return interp->gc_sys->get_gc_info(interp, FIXED_SIZE_ARENAS);
+}
+
+PARROT_EXPORT
+size_t
+Parrot_gc_fixed_size_free_memory(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_gc_fixed_size_free_memory)
+    return interp->gc_sys->get_gc_info(interp, FIXED_SIZE_FREE_MEM);
+}
+
+PARROT_EXPORT
+size_t
+Parrot_gc_total_evacuated(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_gc_total_evacuated)
+    return interp->gc_sys->get_gc_info(interp, TOTAL_EVACUATED);
+}
+
+PARROT_EXPORT
+size_t
+Parrot_gc_arenas_released(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_gc_arenas_released)
+    return interp->gc_sys->get_gc_info(interp, ARENAS_RELEASED);
+}
+
+PARROT_EXPORT
+size_t
+Parrot_gc_shared_buffers_moved(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_gc_shared_buffers_moved)
+    return interp->gc_sys->get_gc_info(interp, SHARED_BUFFERS_MOVED);
+}
+
+PARROT_EXPORT
+UINTVAL
+Parrot_gc_total_shared(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_gc_total_shared)
+    return interp->gc_sys->get_gc_info(interp, TOTAL_SHARED);
+}
+
 /*
 
 =item C<void Parrot_block_GC_mark(PARROT_INTERP)>
@@ -35,6 +35,26 @@ PARROT_PURE_FUNCTION
 static size_t arena_size(ARGIN(const Pool_Allocator *self))
         __attribute__nonnull__(1);
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_PURE_FUNCTION
+static int evacuee_cmp_address(ARGIN(const void *a), ARGIN(const void *b))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_PURE_FUNCTION
+static int evacuee_cmp_live(ARGIN(const void *a), ARGIN(const void *b))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static Pool_Allocator_Evacuee * find_evacuee(
+    ARGIN(const Pool_Allocator *pool),
+    ARGIN(const void *ptr))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 PARROT_CANNOT_RETURN_NULL
 static void * get_free_list_item(ARGMOD(Pool_Allocator *pool))
         __attribute__nonnull__(1)
@@ -51,6 +71,26 @@ static void * pool_allocate(PARROT_INTERP, ARGMOD(Pool_Allocator *pool))
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*pool);
 
+static size_t pool_begin_evacuation(PARROT_INTERP,
+    ARGMOD(Pool_Allocator *pool),
+    size_t threshold,
+    ARGIN_NULLOK(const size_t *pins),
+    size_t num_pins)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*pool);
+
+static size_t pool_end_evacuation(PARROT_INTERP,
+    ARGMOD(Pool_Allocator *pool))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*pool);
+
+PARROT_CAN_RETURN_NULL
+static void * pool_evacuate(ARGMOD(Pool_Allocator *pool), ARGIN(void *data))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*pool);
+
 static void pool_free(PARROT_INTERP,
     ARGMOD(Pool_Allocator *pool),
     ARGMOD(void *data))
@@ -74,11 +114,28 @@ static int pool_is_owned(
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+static void release_pool_arena(PARROT_INTERP,
+    ARGMOD(Pool_Allocator *pool),
+    ARGFREE_NOTNULL(Pool_Allocator_Arena *arena))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*pool);
+
 #define ASSERT_ARGS_allocate_new_pool_arena __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pool))
 #define ASSERT_ARGS_arena_size __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_evacuee_cmp_address __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(a) \
+    , PARROT_ASSERT_ARG(b))
+#define ASSERT_ARGS_evacuee_cmp_live __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(a) \
+    , PARROT_ASSERT_ARG(b))
+#define ASSERT_ARGS_find_evacuee __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(pool) \
+    , PARROT_ASSERT_ARG(ptr))
 #define ASSERT_ARGS_get_free_list_item __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(pool))
 #define ASSERT_ARGS_get_newfree_list_item __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -86,6 +143,14 @@ static int pool_is_owned(
 #define ASSERT_ARGS_pool_allocate __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pool))
+#define ASSERT_ARGS_pool_begin_evacuation __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(pool))
+#define ASSERT_ARGS_pool_end_evacuation __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pool))
+#define ASSERT_ARGS_pool_evacuate __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(pool) \
+    , PARROT_ASSERT_ARG(data))
 #define ASSERT_ARGS_pool_free __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(pool) \
     , PARROT_ASSERT_ARG(data))
@@ -95,6 +160,10 @@ static int pool_is_owned(
 #define ASSERT_ARGS_pool_is_owned __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(pool) \
     , PARROT_ASSERT_ARG(ptr))
+#define ASSERT_ARGS_release_pool_arena __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pool) \
+    , PARROT_ASSERT_ARG(arena))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
@@ -128,6 +197,18 @@ Fixed_Allocator *allocator)>
 
 Calculate amount of memory allocated in Fixed_Allocator.
 
+=item C<size_t Parrot_gc_fixed_allocator_free_memory(PARROT_INTERP, const
+Fixed_Allocator *allocator)>
+
+Calculate amount of memory held in arenas of Fixed_Allocator but not used by
+any object. Together with C<Parrot_gc_fixed_allocator_allocated_memory> it
+gives the fragmentation of the allocator.
+
+=item C<size_t Parrot_gc_fixed_allocator_arena_count(PARROT_INTERP, const
+Fixed_Allocator *allocator)>
+
+Count arenas currently held by Fixed_Allocator.
+
 =cut
 
 */
@@ -236,6 +317,145 @@ Parrot_gc_fixed_allocator_allocated_memory(PARROT_INTERP,
     return total;
 }
 
+PARROT_WARN_UNUSED_RESULT
+size_t
+Parrot_gc_fixed_allocator_free_memory(SHIM_INTERP,
+        ARGIN(const Fixed_Allocator *allocator))
+{
+    ASSERT_ARGS(Parrot_gc_fixed_allocator_free_memory)
+    size_t total = 0;
+    size_t i;
+
+    for (i = 0; i < allocator->num_pools; i++) {
+        const Pool_Allocator * const pool = allocator->pools[i];
+        if (pool)
+            total += pool->num_free_objects * pool->object_size;
+    }
+
+    return total;
+}
+
+PARROT_WARN_UNUSED_RESULT
+size_t
+Parrot_gc_fixed_allocator_arena_count(SHIM_INTERP,
+        ARGIN(const Fixed_Allocator *allocator))
+{
+    ASSERT_ARGS(Parrot_gc_fixed_allocator_arena_count)
+    size_t total = 0;
+    size_t i;
+
+    for (i = 0; i < allocator->num_pools; i++) {
+        if (allocator->pools[i])
+            total += allocator->pools[i]->num_arenas;
+    }
+
+    return total;
+}
+
+/*
+
+=back
+
+=head1 FixedAllocator evacuation
+
+Objects allocated from Fixed_Allocator never move on their own. Long-running
+programs accumulate arenas holding only a few live objects which can't be
+returned to the system. Evacuation moves the live objects out of such sparse
+arenas during a full collection and frees the emptied arenas.
+
+Only the collector knows where an object is referenced from, so evacuation is
+driven by it in three steps: C<begin_evacuation> selects the arenas,
+C<evacuate> is called for every relocatable object and C<end_evacuation>
+releases arenas left without live objects. Arenas still holding objects which
+weren't relocated (e.g. ones referenced from the C stack) are kept.
+
+=over 4
+
+=item C<size_t Parrot_gc_fixed_allocator_begin_evacuation(PARROT_INTERP,
+Fixed_Allocator *allocator, size_t threshold, const size_t *pins, size_t
+num_pins)>
+
+Select arenas with occupancy below C<threshold> percent for evacuation. Arenas
+containing any of the C<num_pins> addresses in C<pins> are never selected.
+Only as many arenas are selected as the free space of the remaining arenas can
+absorb, so evacuation never allocates new arenas. Returns the number of
+selected arenas.
+
+=item C<void * Parrot_gc_fixed_allocator_evacuate(PARROT_INTERP, Fixed_Allocator
+*allocator, void *data, size_t size)>
+
+Move object C<data> of C<size> out of an arena being evacuated. Returns the new
+address of the object, or C<data> itself when it doesn't have to (or can't)
+be moved. The caller must update all references to the object.
+
+=item C<size_t Parrot_gc_fixed_allocator_end_evacuation(PARROT_INTERP,
+Fixed_Allocator *allocator)>
+
+Finish evacuation. Emptied arenas are returned to the system, the free objects
+of all others go back to the free lists. Returns the number of released
+arenas.
+
+=cut
+
+*/
+
+size_t
+Parrot_gc_fixed_allocator_begin_evacuation(PARROT_INTERP,
+        ARGMOD(Fixed_Allocator *allocator), size_t threshold,
+        ARGIN_NULLOK(const size_t *pins), size_t num_pins)
+{
+    ASSERT_ARGS(Parrot_gc_fixed_allocator_begin_evacuation)
+    size_t total = 0;
+    size_t i;
+
+    for (i = 0; i < allocator->num_pools; i++) {
+        if (allocator->pools[i])
+            total += pool_begin_evacuation(interp, allocator->pools[i],
+                                           threshold, pins, num_pins);
+    }
+
+    return total;
+}
+
+PARROT_CANNOT_RETURN_NULL
+void *
+Parrot_gc_fixed_allocator_evacuate(SHIM_INTERP,
+        ARGMOD(Fixed_Allocator *allocator),
+        ARGIN(void *data), size_t size)
+{
+    ASSERT_ARGS(Parrot_gc_fixed_allocator_evacuate)
+
+    /* We always align size to 4/8 bytes. */
+    const size_t index = (size - 1) / sizeof (void *);
+
+    if (size && index < allocator->num_pools && allocator->pools[index]) {
+        void * const dest = pool_evacuate(allocator->pools[index], data);
+        if (dest) {
+            ++allocator->num_evacuated;
+            return dest;
+        }
+    }
+
+    return data;
+}
+
+size_t
+Parrot_gc_fixed_allocator_end_evacuation(PARROT_INTERP,
+        ARGMOD(Fixed_Allocator *allocator))
+{
+    ASSERT_ARGS(Parrot_gc_fixed_allocator_end_evacuation)
+    size_t total = 0;
+    size_t i;
+
+    for (i = 0; i < allocator->num_pools; i++) {
+        if (allocator->pools[i])
+            total += pool_end_evacuation(interp, allocator->pools[i]);
+    }
+
+    allocator->num_released_arenas += total;
+    return total;
+}
+
 /*
 
 =back
@@ -311,6 +531,9 @@ Parrot_gc_pool_new(SHIM_INTERP, size_t object_size)
     newpool->newlast           = NULL;
     newpool->num_arenas        = 0;
     newpool->arena_bounds      = (void **)mem_sys_allocate_zeroed(NEXT_ARENA_BOUNDS_SIZE(0));
+    newpool->evacuees          = NULL;
+    newpool->num_evacuees      = 0;
+    newpool->evacuee_free_list = NULL;
 
     return newpool;
 }
@@ -572,6 +795,301 @@ allocate_new_pool_arena(PARROT_INTERP, ARGMOD(Pool_Allocator *pool))
 
 /*
 
+=item C<static size_t pool_begin_evacuation(PARROT_INTERP, Pool_Allocator *pool,
+size_t threshold, const size_t *pins, size_t num_pins)>
+
+=item C<static void * pool_evacuate(Pool_Allocator *pool, void *data)>
+
+=item C<static size_t pool_end_evacuation(PARROT_INTERP, Pool_Allocator *pool)>
+
+Per-pool implementation of evacuation. C<pool_evacuate> returns NULL if
+C<data> stays where it is.
+
+=cut
+
+*/
+
+static size_t
+pool_begin_evacuation(SHIM_INTERP, ARGMOD(Pool_Allocator *pool), size_t threshold,
+        ARGIN_NULLOK(const size_t *pins), size_t num_pins)
+{
+    ASSERT_ARGS(pool_begin_evacuation)
+    Pool_Allocator_Evacuee   *evacuees;
+    Pool_Allocator_Arena     *arena;
+    Pool_Allocator_Free_List *item, *next;
+    const size_t              capacity     = pool->objects_per_alloc;
+    size_t                    outside_free = pool->num_free_objects;
+    size_t                    moved        = 0;
+    size_t                    count        = 0;
+    size_t                    i;
+
+    /* Top arena is still carved by newfree. Never evacuate it. */
+    if (pool->num_arenas < 2)
+        return 0;
+
+    evacuees = mem_internal_allocate_n_zeroed_typed(pool->num_arenas - 1,
+                                                    Pool_Allocator_Evacuee);
+
+    for (arena = pool->top_arena->next; arena; arena = arena->next) {
+        Pool_Allocator_Evacuee * const e = &evacuees[count++];
+        e->arena = arena;
+        e->lo    = (char *)(arena + 1);
+        e->hi    = e->lo + pool->object_size * capacity;
+        e->live  = capacity;
+    }
+
+    pool->evacuees     = evacuees;
+    pool->num_evacuees = count;
+    qsort(evacuees, count, sizeof (Pool_Allocator_Evacuee), evacuee_cmp_address);
+
+    /* Count live objects per arena */
+    for (item = pool->free_list; item; item = item->next) {
+        Pool_Allocator_Evacuee * const e = find_evacuee(pool, item);
+        if (e)
+            --e->live;
+    }
+
+    /* Objects referenced from C stack can't be moved. Treat arena as full */
+    for (i = 0; i < num_pins; i++) {
+        Pool_Allocator_Evacuee * const e = find_evacuee(pool, (void *)pins[i]);
+        if (e)
+            e->live = capacity;
+    }
+
+    /* Take the sparsest arenas first, while their objects still fit into free
+       space of the remaining arenas */
+    qsort(evacuees, count, sizeof (Pool_Allocator_Evacuee), evacuee_cmp_live);
+
+    for (i = 0; i < count; i++) {
+        const size_t live      = evacuees[i].live;
+        const size_t free_objs = capacity - live;
+
+        if (live * 100 >= capacity * threshold)
+            break;
+        if (moved + live > outside_free - free_objs)
+            break;
+
+        outside_free -= free_objs;
+        moved        += live;
+    }
+
+    if (i == 0) {
+        mem_internal_free(evacuees);
+        pool->evacuees     = NULL;
+        pool->num_evacuees = 0;
+        return 0;
+    }
+
+    pool->num_evacuees = count = i;
+    qsort(evacuees, count, sizeof (Pool_Allocator_Evacuee), evacuee_cmp_address);
+
+    /* Move free objects of selected arenas aside so they aren't reused */
+    item            = pool->free_list;
+    pool->free_list = NULL;
+    for (; item; item = next) {
+        next = item->next;
+        if (find_evacuee(pool, item)) {
+            item->next              = pool->evacuee_free_list;
+            pool->evacuee_free_list = item;
+        }
+        else {
+            item->next      = pool->free_list;
+            pool->free_list = item;
+        }
+    }
+
+    return count;
+}
+
+PARROT_CAN_RETURN_NULL
+static void *
+pool_evacuate(ARGMOD(Pool_Allocator *pool), ARGIN(void *data))
+{
+    ASSERT_ARGS(pool_evacuate)
+    Pool_Allocator_Evacuee * const e = find_evacuee(pool, data);
+    Pool_Allocator_Free_List      *item;
+    void                          *dest;
+
+    if (!e)
+        return NULL;
+
+    /* begin_evacuation guarantees enough space. But be paranoid */
+    if (pool->free_list)
+        dest = get_free_list_item(pool);
+    else if (pool->newfree < pool->newlast)
+        dest = get_newfree_list_item(pool);
+    else
+        return NULL;
+
+    memcpy(dest, data, pool->object_size);
+    --e->live;
+
+    item                    = (Pool_Allocator_Free_List *)data;
+    item->next              = pool->evacuee_free_list;
+    pool->evacuee_free_list = item;
+    ++pool->num_free_objects;
+
+    return dest;
+}
+
+static size_t
+pool_end_evacuation(PARROT_INTERP, ARGMOD(Pool_Allocator *pool))
+{
+    ASSERT_ARGS(pool_end_evacuation)
+    Pool_Allocator_Free_List *item, *next;
+    size_t                    released = 0;
+    size_t                    i;
+
+    if (!pool->num_evacuees)
+        return 0;
+
+    /* Return free objects of arenas which survived. Before freeing any arena,
+       we are walking through its memory */
+    for (item = pool->evacuee_free_list; item; item = next) {
+        const Pool_Allocator_Evacuee * const e = find_evacuee(pool, item);
+        next = item->next;
+        if (e->live) {
+            item->next      = pool->free_list;
+            pool->free_list = item;
+        }
+    }
+    pool->evacuee_free_list = NULL;
+
+    for (i = 0; i < pool->num_evacuees; i++) {
+        if (!pool->evacuees[i].live) {
+            release_pool_arena(interp, pool, pool->evacuees[i].arena);
+            ++released;
+        }
+    }
+
+    mem_internal_free(pool->evacuees);
+    pool->evacuees     = NULL;
+    pool->num_evacuees = 0;
+
+    if (released) {
+        int p;
+        pool->lo_arena_ptr = (void *)((size_t)-1);
+        pool->hi_arena_ptr = NULL;
+        for (p = 0; p < pool->num_arenas; p++) {
+            if (pool->lo_arena_ptr > pool->arena_bounds[2 * p])
+                pool->lo_arena_ptr = pool->arena_bounds[2 * p];
+            if (pool->hi_arena_ptr < pool->arena_bounds[2 * p + 1])
+                pool->hi_arena_ptr = pool->arena_bounds[2 * p + 1];
+        }
+    }
+
+    return released;
+}
+
+/*
+
+=item C<static void release_pool_arena(PARROT_INTERP, Pool_Allocator *pool,
+Pool_Allocator_Arena *arena)>
+
+Remove an arena without live objects from pool and free it.
+
+=cut
+
+*/
+
+static void
+release_pool_arena(PARROT_INTERP, ARGMOD(Pool_Allocator *pool),
+        ARGFREE_NOTNULL(Pool_Allocator_Arena *arena))
+{
+    ASSERT_ARGS(release_pool_arena)
+    Pool_Allocator_Arena **prev = &pool->top_arena;
+    void * const           lo   = arena + 1;
+    int                    p;
+
+    while (*prev != arena)
+        prev = &(*prev)->next;
+    *prev = arena->next;
+
+    for (p = 0; p < pool->num_arenas; p++) {
+        if (pool->arena_bounds[2 * p] == lo) {
+            const size_t last = 2 * (pool->num_arenas - 1);
+            pool->arena_bounds[2 * p]     = pool->arena_bounds[last];
+            pool->arena_bounds[2 * p + 1] = pool->arena_bounds[last + 1];
+            break;
+        }
+    }
+    --pool->num_arenas;
+
+    pool->num_free_objects -= pool->objects_per_alloc;
+    interp->gc_sys->stats.memory_allocated -= arena_size(pool);
+
+    mem_sys_free(arena);
+}
+
+/*
+
+=item C<static Pool_Allocator_Evacuee * find_evacuee(const Pool_Allocator *pool,
+const void *ptr)>
+
+Find arena being evacuated which contains C<ptr>. Returns NULL if there is no
+such arena.
+
+=item C<static int evacuee_cmp_address(const void *a, const void *b)>
+
+=item C<static int evacuee_cmp_live(const void *a, const void *b)>
+
+C<qsort> comparators for C<Pool_Allocator_Evacuee>.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static Pool_Allocator_Evacuee *
+find_evacuee(ARGIN(const Pool_Allocator *pool), ARGIN(const void *ptr))
+{
+    ASSERT_ARGS(find_evacuee)
+    const char * const p  = (const char *)ptr;
+    size_t             lo = 0;
+    size_t             hi = pool->num_evacuees;
+
+    while (lo < hi) {
+        const size_t                 mid = lo + (hi - lo) / 2;
+        Pool_Allocator_Evacuee * const e = &pool->evacuees[mid];
+
+        if (p < e->lo)
+            hi = mid;
+        else if (p >= e->hi)
+            lo = mid + 1;
+        else
+            return e;
+    }
+
+    return NULL;
+}
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_PURE_FUNCTION
+static int
+evacuee_cmp_address(ARGIN(const void *a), ARGIN(const void *b))
+{
+    ASSERT_ARGS(evacuee_cmp_address)
+    const char * const x = ((const Pool_Allocator_Evacuee *)a)->lo;
+    const char * const y = ((const Pool_Allocator_Evacuee *)b)->lo;
+
+    return x < y ? -1 : x > y ? 1 : 0;
+}
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_PURE_FUNCTION
+static int
+evacuee_cmp_live(ARGIN(const void *a), ARGIN(const void *b))
+{
+    ASSERT_ARGS(evacuee_cmp_live)
+    const size_t x = ((const Pool_Allocator_Evacuee *)a)->live;
+    const size_t y = ((const Pool_Allocator_Evacuee *)b)->live;
+
+    return x < y ? -1 : x > y ? 1 : 0;
+}
+
+/*
+
 =item C<static size_t arena_size(const Pool_Allocator *self)>
 
 Calculate size of Arena.
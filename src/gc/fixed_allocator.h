@@ -36,6 +36,14 @@ typedef struct Pool_Allocator_Arena {
     char *dummy; /* fix alignment on ia64, mipsel and sparc, similar to gh issue #603 */
 } Pool_Allocator_Arena;
 
+/* Bookkeeping for an arena which is being evacuated during full collection */
+typedef struct Pool_Allocator_Evacuee {
+    Pool_Allocator_Arena *arena;
+    char                 *lo;   /* first object in arena */
+    char                 *hi;   /* end of object space in arena */
+    size_t                live; /* number of objects still living in arena */
+} Pool_Allocator_Evacuee;
+
 typedef struct Pool_Allocator {
     size_t object_size;
     size_t objects_per_alloc;
@@ -53,12 +61,23 @@ typedef struct Pool_Allocator {
     int num_arenas;      /* number of arenas, for keeping track of the
                             size of arena_bounds */
     void **arena_bounds; /* Array of low/high pairs for each arena. */
+
+    /* Arenas selected for evacuation, sorted by address. Only valid between
+       begin_evacuation and end_evacuation. */
+    Pool_Allocator_Evacuee   *evacuees;
+    size_t                    num_evacuees;
+
+    /* Free objects of evacuated arenas. Kept off free_list meanwhile */
+    Pool_Allocator_Free_List *evacuee_free_list;
 } Pool_Allocator;
 
 typedef struct Fixed_Allocator
 {
     Pool_Allocator **pools;
     size_t           num_pools;
+
+    size_t           num_evacuated;       /* objects moved by evacuation */
+    size_t           num_released_arenas; /* arenas returned to the system */
 } Fixed_Allocator;
 
 
@@ -146,6 +165,40 @@ int Parrot_gc_pool_is_owned(PARROT_INTERP,
         FUNC_MODIFIES(*pool)
         FUNC_MODIFIES(*ptr);
 
+PARROT_WARN_UNUSED_RESULT
+size_t Parrot_gc_fixed_allocator_arena_count(PARROT_INTERP,
+    ARGIN(const Fixed_Allocator *allocator))
+        __attribute__nonnull__(2);
+
+size_t Parrot_gc_fixed_allocator_begin_evacuation(PARROT_INTERP,
+    ARGMOD(Fixed_Allocator *allocator),
+    size_t threshold,
+    ARGIN_NULLOK(const size_t *pins),
+    size_t num_pins)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*allocator);
+
+size_t Parrot_gc_fixed_allocator_end_evacuation(PARROT_INTERP,
+    ARGMOD(Fixed_Allocator *allocator))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*allocator);
+
+PARROT_CANNOT_RETURN_NULL
+void * Parrot_gc_fixed_allocator_evacuate(PARROT_INTERP,
+    ARGMOD(Fixed_Allocator *allocator),
+    ARGIN(void *data),
+    size_t size)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*allocator);
+
+PARROT_WARN_UNUSED_RESULT
+size_t Parrot_gc_fixed_allocator_free_memory(PARROT_INTERP,
+    ARGIN(const Fixed_Allocator *allocator))
+        __attribute__nonnull__(2);
+
 PARROT_CAN_RETURN_NULL
 void* Parrot_gc_pool_high_ptr(PARROT_INTERP, ARGIN(Pool_Allocator *pool))
         __attribute__nonnull__(2);
@@ -192,6 +245,24 @@ Pool_Allocator * Parrot_gc_pool_new(PARROT_INTERP, size_t object_size);
 #define ASSERT_ARGS_Parrot_gc_pool_is_owned __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(pool) \
     , PARROT_ASSERT_ARG(ptr))
+#define ASSERT_ARGS_Parrot_gc_fixed_allocator_arena_count \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(allocator))
+#define ASSERT_ARGS_Parrot_gc_fixed_allocator_begin_evacuation \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(allocator))
+#define ASSERT_ARGS_Parrot_gc_fixed_allocator_end_evacuation \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(allocator))
+#define ASSERT_ARGS_Parrot_gc_fixed_allocator_evacuate \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(allocator) \
+    , PARROT_ASSERT_ARG(data))
+#define ASSERT_ARGS_Parrot_gc_fixed_allocator_free_memory \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(allocator))
 #define ASSERT_ARGS_Parrot_gc_pool_high_ptr __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(pool))
 #define ASSERT_ARGS_Parrot_gc_pool_low_ptr __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -0,0 +1,427 @@
+/*
+Copyright (C) 2014, Parrot Foundation.
+
+=head1 NAME
+
+src/gc/gc_events.c - GC event log and allocation site sampling
+
+=head1 DESCRIPTION
+
+The counters in F<src/gc/api.c> only tell how often the GC ran. To tune it,
+one needs to know what each collection did. Collectors report every
+collection with C<Parrot_gc_event_begin> and C<Parrot_gc_event_end> and fill
+in what they know in between: the generation collected, headers freed and
+promoted and the size of the dirty list. The last C<GC_EVENT_LOG_SIZE>
+collections are kept and available through C<interpinfo .INTERPINFO_GC_EVENTS>.
+
+When a trace file is set, with C<PARROT_GC_TRACE> in the environment or with
+C<Parrot_gc_trace_events>, every collection is also written to it as one line:
+
+  gc run=12 gen=1 start=10321554 pause=81233 freed=5120 freed_bytes=163840
+     promoted=310 dirty=42 used=1048576
+
+Times are in nanoseconds; C<start> counts from the initialization of the GC.
+
+Allocation sites can be sampled as well: every Nth new PMC is charged to the
+Sub and pc creating it. Counts are available through
+C<interpinfo .INTERPINFO_GC_ALLOCATION_SITES> and are written to the trace
+file at exit. Sampling is enabled with C<PARROT_GC_ALLOC_SAMPLE> or
+C<Parrot_gc_sample_allocations>.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "parrot/parrot.h"
+#include "parrot/gc_api.h"
+#include "gc_private.h"
+
+#include "gc_events.str"
+
+/* HEADERIZER HFILE: include/parrot/gc_api.h */
+
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+
+/*
+
+=item C<void Parrot_gc_events_init(PARROT_INTERP)>
+
+Starts tracing and allocation site sampling as requested in the environment
+by C<PARROT_GC_TRACE> (the name of the trace file) and
+C<PARROT_GC_ALLOC_SAMPLE> (sample every Nth PMC allocation).
+
+=cut
+
+*/
+
+void
+Parrot_gc_events_init(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_gc_events_init)
+    STRING * const trace_var  = CONST_STRING(interp, "PARROT_GC_TRACE");
+    STRING * const sample_var = CONST_STRING(interp, "PARROT_GC_ALLOC_SAMPLE");
+    STRING * const trace      = Parrot_getenv(interp, trace_var);
+    STRING * const sample     = Parrot_getenv(interp, sample_var);
+
+    if (!STRING_IS_NULL(trace))
+        Parrot_gc_trace_events(interp, trace);
+
+    if (!STRING_IS_NULL(sample))
+        Parrot_gc_sample_allocations(interp, Parrot_str_to_int(interp, sample));
+}
+
+/*
+
+=item C<void Parrot_gc_events_finish(PARROT_INTERP)>
+
+Writes the sampled allocation sites to the trace file, closes it and stops
+sampling.
+
+=cut
+
+*/
+
+void
+Parrot_gc_events_finish(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_gc_events_finish)
+    GC_Event_Log * const log = &interp->gc_sys->events;
+
+    interp->gc_alloc_countdown = 0;
+
+    if (log->trace && log->alloc_sites) {
+        Hash * const sites = (Hash *)VTABLE_get_pointer(interp, log->alloc_sites);
+
+        parrot_hash_iterate(sites,
+            char * const site = Parrot_str_to_cstring(interp,
+                                    (STRING *)_bucket->key);
+            fprintf(log->trace, "alloc count=%ld site=%s\n",
+                (long)VTABLE_get_integer(interp, (PMC *)_bucket->value), site);
+            Parrot_str_free_cstring(site););
+    }
+
+    Parrot_gc_trace_events(interp, NULL);
+
+    if (log->alloc_sites) {
+        Parrot_pmc_gc_unregister(interp, log->alloc_sites);
+        log->alloc_sites = NULL;
+    }
+}
+
+/*
+
+=item C<void Parrot_gc_trace_events(PARROT_INTERP, STRING *filename)>
+
+Writes every following collection to C<filename>, which is truncated. Closes
+the current trace file, if any. Tracing stops if C<filename> is null.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_gc_trace_events(PARROT_INTERP, ARGIN_NULLOK(STRING *filename))
+{
+    ASSERT_ARGS(Parrot_gc_trace_events)
+    GC_Event_Log * const log = &interp->gc_sys->events;
+
+    if (log->trace) {
+        fclose(log->trace);
+        log->trace = NULL;
+    }
+
+    if (!STRING_IS_NULL(filename)) {
+        char * const name  = Parrot_str_to_cstring(interp, filename);
+        FILE * const trace = fopen(name, "w");
+        char        *gc_name;
+
+        Parrot_str_free_cstring(name);
+
+        if (!trace)
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_PIO_ERROR,
+                "unable to open %Ss for writing", filename);
+
+        gc_name = Parrot_str_to_cstring(interp, Parrot_gc_sys_name(interp));
+        fprintf(trace, "version=1 gc=%s\n", gc_name);
+        Parrot_str_free_cstring(gc_name);
+
+        log->trace = trace;
+    }
+}
+
+/*
+
+=item C<void Parrot_gc_sample_allocations(PARROT_INTERP, INTVAL interval)>
+
+Records the allocation site of every C<interval>th new PMC. Sampling stops if
+C<interval> is not positive; sites counted so far are kept.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_gc_sample_allocations(PARROT_INTERP, INTVAL interval)
+{
+    ASSERT_ARGS(Parrot_gc_sample_allocations)
+    GC_Event_Log * const log = &interp->gc_sys->events;
+
+    if (interval <= 0) {
+        log->alloc_sample_interval = 0;
+        interp->gc_alloc_countdown = 0;
+        return;
+    }
+
+    if (!log->alloc_sites) {
+        log->alloc_sites = Parrot_pmc_new(interp, enum_class_Hash);
+        Parrot_pmc_gc_register(interp, log->alloc_sites);
+    }
+
+    log->alloc_sample_interval = interval;
+    interp->gc_alloc_countdown = interval;
+}
+
+/*
+
+=item C<void Parrot_gc_sample_allocation(PARROT_INTERP, PMC *pmc)>
+
+Charges the allocation of C<pmc>, which is not initialized yet, to the Sub
+and pc of the current context. Called through
+C<PARROT_GC_SAMPLE_ALLOCATION> when the sampling countdown expires.
+
+=cut
+
+*/
+
+void
+Parrot_gc_sample_allocation(PARROT_INTERP, ARGIN(PMC *pmc))
+{
+    ASSERT_ARGS(Parrot_gc_sample_allocation)
+    GC_Event_Log * const log = &interp->gc_sys->events;
+    PMC          * const ctx = CURRENT_CONTEXT(interp);
+
+    /* Recording the site allocates PMCs too */
+    interp->gc_alloc_countdown = 0;
+
+    if (log->alloc_sites && ctx && !PMC_IS_NULL(ctx)) {
+        PMC    * const sub  = Parrot_pcc_get_sub(interp, ctx);
+        STRING        *site;
+
+        /* pmc is only referenced from the C stack and not initialized */
+        Parrot_block_GC_mark(interp);
+
+        if (PMC_IS_NULL(sub))
+            site = Parrot_sprintf_c(interp, "%Ss (no sub)", pmc->vtable->whoami);
+        else {
+            STRING * const      unknown = CONST_STRING(interp, "???");
+            Parrot_Context_info info;
+
+            Parrot_sub_context_get_info(interp, ctx, &info);
+
+            site = Parrot_sprintf_c(interp, "%Ss %Ss pc %d (%Ss:%d)",
+                        pmc->vtable->whoami,
+                        info.fullname ? info.fullname : unknown, (int)info.pc,
+                        info.file ? info.file : unknown, (int)info.line);
+        }
+
+        VTABLE_set_integer_keyed_str(interp, log->alloc_sites, site,
+            VTABLE_get_integer_keyed_str(interp, log->alloc_sites, site) + 1);
+
+        Parrot_unblock_GC_mark(interp);
+    }
+
+    interp->gc_alloc_countdown = log->alloc_sample_interval;
+}
+
+/*
+
+=item C<void Parrot_gc_event_begin(PARROT_INTERP, INTVAL generation)>
+
+Called by a collector when it starts a collection of C<generation> (-1 if it
+does not have generations).
+
+=cut
+
+*/
+
+void
+Parrot_gc_event_begin(PARROT_INTERP, INTVAL generation)
+{
+    ASSERT_ARGS(Parrot_gc_event_begin)
+    GC_Event_Log * const log = &interp->gc_sys->events;
+
+    memset(&log->current, 0, sizeof (GC_Event));
+
+    log->current.generation = generation;
+    log->current.start      = Parrot_hires_get_time();
+    log->used_before        = interp->gc_sys->stats.memory_used;
+    log->in_progress        = 1;
+}
+
+/*
+
+=item C<void Parrot_gc_event_end(PARROT_INTERP)>
+
+Called by a collector when it finishes the collection begun with
+C<Parrot_gc_event_begin>. Logs it and writes it to the trace file.
+
+=cut
+
+*/
+
+void
+Parrot_gc_event_end(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_gc_event_end)
+    GC_Event_Log * const log   = &interp->gc_sys->events;
+    GC_Event     * const event = &log->current;
+    const size_t         used  = interp->gc_sys->stats.memory_used;
+
+    if (!log->in_progress)
+        return;
+
+    log->in_progress   = 0;
+    event->run         = interp->gc_sys->stats.gc_mark_runs;
+    event->pause       = Parrot_hires_get_time() - event->start;
+    event->start      -= log->epoch;
+    event->memory_used = used;
+    event->bytes_freed = log->used_before > used ? log->used_before - used : 0;
+
+    log->events[log->count++ % GC_EVENT_LOG_SIZE] = *event;
+
+    if (log->trace)
+        fprintf(log->trace,
+            "gc run=%lu gen=%ld start=%lu pause=%lu freed=%lu freed_bytes=%lu"
+            " promoted=%lu dirty=%lu used=%lu\n",
+            (unsigned long)event->run, (long)event->generation,
+            (unsigned long)event->start, (unsigned long)event->pause,
+            (unsigned long)event->objects_freed, (unsigned long)event->bytes_freed,
+            (unsigned long)event->objects_promoted,
+            (unsigned long)event->dirty_list_size,
+            (unsigned long)event->memory_used);
+}
+
+/*
+
+=item C<PMC * Parrot_gc_event_log(PARROT_INTERP)>
+
+Returns the logged collections, oldest first, as an array of Hashes with the
+keys C<run>, C<generation>, C<start>, C<pause>, C<freed>, C<freed_bytes>,
+C<promoted>, C<dirty> and C<used>.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+PMC *
+Parrot_gc_event_log(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_gc_event_log)
+    GC_Event_Log * const log         = &interp->gc_sys->events;
+    STRING * const       run_key     = CONST_STRING(interp, "run");
+    STRING * const       gen_key     = CONST_STRING(interp, "generation");
+    STRING * const       start_key   = CONST_STRING(interp, "start");
+    STRING * const       pause_key   = CONST_STRING(interp, "pause");
+    STRING * const       freed_key   = CONST_STRING(interp, "freed");
+    STRING * const       bytes_key   = CONST_STRING(interp, "freed_bytes");
+    STRING * const       promote_key = CONST_STRING(interp, "promoted");
+    STRING * const       dirty_key   = CONST_STRING(interp, "dirty");
+    STRING * const       used_key    = CONST_STRING(interp, "used");
+    PMC    * const       result      = Parrot_pmc_new(interp,
+                                            enum_class_ResizablePMCArray);
+    size_t               i;
+
+    /* collections would change the log under our feet */
+    Parrot_block_GC_mark(interp);
+
+    i = log->count > GC_EVENT_LOG_SIZE ? log->count - GC_EVENT_LOG_SIZE : 0;
+
+    for (; i < log->count; ++i) {
+        const GC_Event * const event = &log->events[i % GC_EVENT_LOG_SIZE];
+        PMC            * const hash  = Parrot_pmc_new(interp, enum_class_Hash);
+
+        VTABLE_set_integer_keyed_str(interp, hash, run_key, event->run);
+        VTABLE_set_integer_keyed_str(interp, hash, gen_key, event->generation);
+        VTABLE_set_integer_keyed_str(interp, hash, start_key, event->start);
+        VTABLE_set_integer_keyed_str(interp, hash, pause_key, event->pause);
+        VTABLE_set_integer_keyed_str(interp, hash, freed_key,
+            event->objects_freed);
+        VTABLE_set_integer_keyed_str(interp, hash, bytes_key,
+            event->bytes_freed);
+        VTABLE_set_integer_keyed_str(interp, hash, promote_key,
+            event->objects_promoted);
+        VTABLE_set_integer_keyed_str(interp, hash, dirty_key,
+            event->dirty_list_size);
+        VTABLE_set_integer_keyed_str(interp, hash, used_key,
+            event->memory_used);
+
+        VTABLE_push_pmc(interp, result, hash);
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    return result;
+}
+
+/*
+
+=item C<PMC * Parrot_gc_allocation_sites(PARROT_INTERP)>
+
+Returns a Hash of the allocation sites sampled so far to the number of
+samples taken at each. Sites are named by PMC type, Sub, pc and source
+position, e.g. C<Integer main pc 12 (foo.pir:7)>.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+PMC *
+Parrot_gc_allocation_sites(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_gc_allocation_sites)
+    GC_Event_Log * const log       = &interp->gc_sys->events;
+    const UINTVAL        countdown = interp->gc_alloc_countdown;
+    PMC                 *sites;
+
+    if (!log->alloc_sites)
+        return Parrot_pmc_new(interp, enum_class_Hash);
+
+    /* cloning allocates, which must not add sites while we iterate them */
+    interp->gc_alloc_countdown = 0;
+    sites = VTABLE_clone(interp, log->alloc_sites);
+    interp->gc_alloc_countdown = countdown;
+
+    return sites;
+}
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<src/gc/api.c>, F<src/gc/gc_private.h>, F<docs/dev/profiling.pod>.
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -86,9 +86,14 @@ methods (e.g. pmc2c vtable overrides).
     - Move live objects into generation max(K+1, N)
     - Paint them white.
 
-9. ...
+9. On full collection, if enabled with C<--gc-evacuate-threshold>, move
+attributes of live PMCs out of sparse fixed-size arenas and return emptied
+arenas to the system. Arenas referenced from C stack (found during step 4) are
+pinned.
 
-10. Profit!
+10. ...
+
+11. Profit!
 
 We are not cleaning "dirty_list" after this process to rescan it again on next
 iteration. It allows us to keep track of old-to-new inter-generations
@@ -208,6 +213,18 @@ typedef struct MarkSweep_GC {
 
     UINTVAL locked;               /* is the GC lock already taken? */
 
+    /* Evacuate fixed-size arenas with occupancy below this percentage during
+       full collections. 0 disables evacuation */
+    size_t  evacuate_threshold;
+
+    /* Addresses inside fixed-size arenas found on C stack. Arenas containing
+       them are pinned during evacuation */
+    size_t *pins;
+    size_t  num_pins;
+    size_t  max_pins;
+    size_t  pins_lo;
+    size_t  pins_hi;
+
 } MarkSweep_GC;
 
 /* Callback to destroy PMC or free string storage */
@@ -300,6 +317,12 @@ static size_t gc_gms_count_used_string_memory(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+static void gc_gms_evacuate_attributes(PARROT_INTERP,
+    ARGMOD(MarkSweep_GC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*self);
+
 static void gc_gms_finalize(PARROT_INTERP)
         __attribute__nonnull__(1);
 
@@ -383,6 +406,9 @@ static void gc_gms_mark_str_header(PARROT_INTERP, ARGMOD(STRING *str))
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*str);
 
+static void gc_gms_pin_stack_ptr(PARROT_INTERP, size_t ptr)
+        __attribute__nonnull__(1);
+
 static void gc_gms_pmc_get_youngest_generation(PARROT_INTERP,
     ARGIN(PMC *pmc))
         __attribute__nonnull__(1)
@@ -441,6 +467,11 @@ static void gc_gms_seal_object(PARROT_INTERP, ARGIN(PMC *pmc))
 static size_t gc_gms_select_generation_to_collect(PARROT_INTERP)
         __attribute__nonnull__(1);
 
+static void gc_gms_start_pinning(PARROT_INTERP, ARGMOD(MarkSweep_GC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*self);
+
 static void gc_gms_str_get_youngest_generation(PARROT_INTERP,
     ARGIN(STRING *str))
         __attribute__nonnull__(1)
@@ -526,6 +557,9 @@ static int gen2flags(int gen);
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(list))
+#define ASSERT_ARGS_gc_gms_evacuate_attributes __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
 #define ASSERT_ARGS_gc_gms_finalize __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_gc_gms_free_buffer_header __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -574,6 +608,8 @@ static int gen2flags(int gen);
     , PARROT_ASSERT_ARG(pmc))
 #define ASSERT_ARGS_gc_gms_mark_str_header __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(str))
+#define ASSERT_ARGS_gc_gms_pin_stack_ptr __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_gc_gms_pmc_get_youngest_generation \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
@@ -609,6 +645,9 @@ static int gen2flags(int gen);
 #define ASSERT_ARGS_gc_gms_select_generation_to_collect \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_gms_start_pinning __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
 #define ASSERT_ARGS_gc_gms_str_get_youngest_generation \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
@@ -766,6 +805,16 @@ Parrot_gc_gms_init(PARROT_INTERP, ARGIN(Parrot_GC_Init_Args *args))
 
         self->fixed_size_allocator = Parrot_gc_fixed_allocator_new(interp);
 
+        /*
+         * Evacuation of sparse fixed-size arenas on full collections.
+         * Disabled by default.
+         * --gc-evacuate-threshold=25
+         */
+        if (args->evacuate_threshold > 0)
+            self->evacuate_threshold = args->evacuate_threshold > 100
+                                     ? 100
+                                     : (size_t)args->evacuate_threshold;
+
         /*
          * Collect every nursery_size/100 of system memory.
          *
@@ -793,6 +842,7 @@ gc_gms_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
     ASSERT_ARGS(gc_gms_mark_and_sweep)
     MarkSweep_GC * const self = (MarkSweep_GC *)interp->gc_sys->gc_private;
     int gen = -1;
+    int evacuate;
 
     if (interp->thread_data)
         LOCK(interp->thread_data->interp_lock);
@@ -825,6 +875,16 @@ gc_gms_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
     will be collected. Remember K in C<self->gen_to_collect>.
     */
     self->gen_to_collect = gen = gc_gms_select_generation_to_collect(interp);
+    Parrot_gc_event_begin(interp, gen);
+
+    /*
+    Evacuate fixed-size arenas only on full collections. Other threads may
+    access our objects through Proxy without taking the lock, so don't move
+    anything once threads were started.
+    */
+    evacuate = self->evacuate_threshold
+            && gen == MAX_GENERATIONS - 1
+            && !interp->thread_data;
 
     /*
     3. Move all objects from collections younger K from dirty_list
@@ -843,7 +903,11 @@ gc_gms_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
     */
     if (! Interp_flags_TEST(interp, PARROT_IS_THREAD))
         gc_gms_mark_pmc_header(interp, PMCNULL);
+
+    if (evacuate)
+        gc_gms_start_pinning(interp, self);
     Parrot_gc_trace_root(interp, NULL, GC_TRACE_FULL);
+    interp->gc_sys->pin_stack_ptr = NULL;
 
     if (interp->pdb && interp->pdb->debugger)
         Parrot_gc_trace_root(interp->pdb->debugger, NULL, GC_TRACE_FULL);
@@ -883,6 +947,13 @@ gc_gms_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
     gc_gms_check_sanity(interp);
 #endif
 
+    /*
+    9. On full collection move attributes out of sparse fixed-size arenas
+    and release emptied arenas.
+    */
+    if (evacuate)
+        gc_gms_evacuate_attributes(interp, self);
+
     /* Update some stats */
     interp->gc_sys->stats.header_allocs_since_last_collect  = 0;
     interp->gc_sys->stats.mem_used_last_collect             = 0;
@@ -907,6 +978,10 @@ gc_gms_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
 
     gc_gms_validate_objects(interp);
 
+    interp->gc_sys->events.current.dirty_list_size =
+        Parrot_pa_count_used(interp, self->dirty_list);
+    Parrot_gc_event_end(interp);
+
 DONE:
     if (interp->thread_data)
         UNLOCK(interp->thread_data->interp_lock);
@@ -1106,6 +1181,7 @@ static void
 gc_gms_sweep_pools(PARROT_INTERP, ARGMOD(MarkSweep_GC *self))
 {
     ASSERT_ARGS(gc_gms_sweep_pools)
+    GC_Event * const event = &interp->gc_sys->events.current;
 
     INTVAL i;
 
@@ -1126,6 +1202,7 @@ gc_gms_sweep_pools(PARROT_INTERP, ARGMOD(MarkSweep_GC *self))
 
                 if (move_to_old) {
                     SET_GEN_FLAGS(pmc, i + 1);
+                    ++event->objects_promoted;
 
                     Parrot_pa_remove(interp, self->objects[i], item->ptr);
                     /* If this was freshly allocated object in C stack - move it to dirty list */
@@ -1147,6 +1224,7 @@ gc_gms_sweep_pools(PARROT_INTERP, ARGMOD(MarkSweep_GC *self))
                 GC_DEBUG_DETAIL_FLAGS("GC free ", pmc);
 
                 interp->gc_sys->stats.memory_used -= sizeof (PMC);
+                ++event->objects_freed;
 
                 /* this is manual inlining of Parrot_pmc_destroy() */
                 if (PObj_custom_destroy_TEST(pmc))
@@ -1175,16 +1253,21 @@ gc_gms_sweep_pools(PARROT_INTERP, ARGMOD(MarkSweep_GC *self))
                     Parrot_pa_remove(interp, self->strings[i], item->ptr);
                     item->ptr = Parrot_pa_insert(self->strings[i + 1], item);
                     SET_GEN_FLAGS(str, i + 1);
+                    ++event->objects_promoted;
                 }
             }
 
             else {
+                if (STRING_interned_TEST(str))
+                    Parrot_str_intern_forget(interp, str);
+
                 Parrot_pa_remove(interp, self->strings[i], item->ptr);
                 if (Buffer_bufstart(str) && !PObj_external_TEST(str))
                     Parrot_gc_str_free_buffer_storage(
                         interp, &self->string_gc, (Parrot_Buffer*)str);
 
                 interp->gc_sys->stats.memory_used -= sizeof (STRING);
+                ++event->objects_freed;
 
                 PObj_on_free_list_SET(str);
 
@@ -1194,6 +1277,108 @@ gc_gms_sweep_pools(PARROT_INTERP, ARGMOD(MarkSweep_GC *self))
 
 }
 
+/*
+
+=item C<static void gc_gms_start_pinning(PARROT_INTERP, MarkSweep_GC *self)>
+
+Prepare for collecting pointers into fixed-size arenas during scanning of C
+stack. Attributes referenced from C code can't be moved.
+
+=item C<static void gc_gms_pin_stack_ptr(PARROT_INTERP, size_t ptr)>
+
+Remember C<ptr> found on C stack if it points into fixed-size arenas.
+
+=cut
+
+*/
+
+static void
+gc_gms_start_pinning(PARROT_INTERP, ARGMOD(MarkSweep_GC *self))
+{
+    ASSERT_ARGS(gc_gms_start_pinning)
+    const Fixed_Allocator * const allocator = self->fixed_size_allocator;
+    size_t i;
+
+    self->num_pins = 0;
+    self->pins_lo  = (size_t)-1;
+    self->pins_hi  = 0;
+
+    for (i = 0; i < allocator->num_pools; i++) {
+        Pool_Allocator * const pool = allocator->pools[i];
+        if (pool && pool->num_arenas) {
+            const size_t lo = (size_t)Parrot_gc_pool_low_ptr(interp, pool);
+            const size_t hi = (size_t)Parrot_gc_pool_high_ptr(interp, pool);
+            if (self->pins_lo > lo)
+                self->pins_lo = lo;
+            if (self->pins_hi < hi)
+                self->pins_hi = hi;
+        }
+    }
+
+    interp->gc_sys->pin_stack_ptr = gc_gms_pin_stack_ptr;
+}
+
+static void
+gc_gms_pin_stack_ptr(PARROT_INTERP, size_t ptr)
+{
+    ASSERT_ARGS(gc_gms_pin_stack_ptr)
+    MarkSweep_GC * const self = (MarkSweep_GC *)interp->gc_sys->gc_private;
+
+    if (ptr < self->pins_lo || ptr >= self->pins_hi)
+        return;
+
+    if (self->num_pins == self->max_pins) {
+        self->max_pins = self->max_pins ? self->max_pins * 2 : 256;
+        mem_internal_realloc_n_typed(self->pins, self->max_pins, size_t);
+    }
+
+    self->pins[self->num_pins++] = ptr;
+}
+
+/*
+
+=item C<static void gc_gms_evacuate_attributes(PARROT_INTERP, MarkSweep_GC
+*self)>
+
+Move attributes of live PMCs out of sparse fixed-size arenas and return
+emptied arenas to the system. Only attributes are moved: C<PMC_data> is the
+only reference to them we know about. Arenas holding other fixed-size storage
+or attributes referenced from C stack stay in place.
+
+=cut
+
+*/
+
+static void
+gc_gms_evacuate_attributes(PARROT_INTERP, ARGMOD(MarkSweep_GC *self))
+{
+    ASSERT_ARGS(gc_gms_evacuate_attributes)
+    Fixed_Allocator * const allocator = self->fixed_size_allocator;
+
+    if (Parrot_gc_fixed_allocator_begin_evacuation(interp, allocator,
+            self->evacuate_threshold, self->pins, self->num_pins)) {
+        size_t i;
+
+        for (i = 0; i < MAX_GENERATIONS; i++) {
+            POINTER_ARRAY_ITER(self->objects[i],
+                PMC * const pmc = &((pmc_alloc_struct *)ptr)->pmc;
+                if (pmc->vtable->attr_size && PMC_data(pmc))
+                    PMC_data(pmc) = Parrot_gc_fixed_allocator_evacuate(interp,
+                            allocator, PMC_data(pmc), pmc->vtable->attr_size););
+        }
+
+        POINTER_ARRAY_ITER(self->dirty_list,
+            PMC * const pmc = &((pmc_alloc_struct *)ptr)->pmc;
+            if (pmc->vtable->attr_size && PMC_data(pmc))
+                PMC_data(pmc) = Parrot_gc_fixed_allocator_evacuate(interp,
+                        allocator, PMC_data(pmc), pmc->vtable->attr_size););
+
+        Parrot_gc_fixed_allocator_end_evacuation(interp, allocator);
+    }
+
+    self->num_pins = 0;
+}
+
 
 /*
 
@@ -1429,6 +1614,16 @@ gc_gms_get_gc_info(PARROT_INTERP, Interpinfo_enum which)
 
     if (which == IMPATIENT_PMCS)
         return self->num_early_gc_PMCs;
+    if (which == FIXED_SIZE_ARENAS)
+        return Parrot_gc_fixed_allocator_arena_count(interp,
+                self->fixed_size_allocator);
+    if (which == FIXED_SIZE_FREE_MEM)
+        return Parrot_gc_fixed_allocator_free_memory(interp,
+                self->fixed_size_allocator);
+    if (which == TOTAL_EVACUATED)
+        return self->fixed_size_allocator->num_evacuated;
+    if (which == ARENAS_RELEASED)
+        return self->fixed_size_allocator->num_released_arenas;
     if (which == TOTAL_PMCS) {
         /* It's higher than actual number of allocated PMCs */
         size_t ret = 0;
@@ -1479,6 +1674,7 @@ gc_gms_finalize(PARROT_INTERP)
     Parrot_gc_pool_destroy(interp, self->pmc_allocator);
     Parrot_gc_pool_destroy(interp, self->string_allocator);
     Parrot_gc_fixed_allocator_destroy(interp, self->fixed_size_allocator);
+    mem_internal_free(self->pins);
 }
 
 /*
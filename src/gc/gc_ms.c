@@ -589,6 +589,8 @@ gc_ms_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
     ++mem_pools->gc_mark_block_level;
     mem_pools->lazy_gc = flags & GC_lazy_FLAG;
 
+    Parrot_gc_event_begin(interp, -1);
+
     /* tell the threading system that we're doing GC mark */
     Parrot_gc_run_init(interp, mem_pools);
 
@@ -621,6 +623,8 @@ gc_ms_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
     --mem_pools->gc_mark_block_level;
     interp->gc_sys->stats.mem_used_last_collect = interp->gc_sys->stats.memory_used;
 
+    Parrot_gc_event_end(interp);
+
     return;
 }
 
@@ -1827,6 +1831,10 @@ Parrot_gc_get_info(SHIM_INTERP, Interpinfo_enum which, ARGIN(GC_Statistics *stat
             return stats->mem_allocs_since_last_collect;
         case TOTAL_COPIED:
             return stats->memory_collected;
+        case SHARED_BUFFERS_MOVED:
+            return stats->shared_buffers;
+        case TOTAL_SHARED:
+            return stats->memory_shared;
         case GC_LAZY_MARK_RUNS:
             return stats->gc_lazy_mark_runs;
         default:
@@ -546,6 +546,12 @@ gc_ms2_get_gc_info(PARROT_INTERP, Interpinfo_enum which)
     if (which == ACTIVE_PMCS)
         /* It's higher than actual number of allocated PMCs */
         return Parrot_pa_count_used(interp, self->objects);
+    if (which == FIXED_SIZE_ARENAS)
+        return Parrot_gc_fixed_allocator_arena_count(interp,
+                self->fixed_size_allocator);
+    if (which == FIXED_SIZE_FREE_MEM)
+        return Parrot_gc_fixed_allocator_free_memory(interp,
+                self->fixed_size_allocator);
 
     return Parrot_gc_get_info(interp, which, &interp->gc_sys->stats);
 }
@@ -1057,6 +1063,10 @@ gc_ms2_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
         return;
 
     ++self->gc_mark_block_level;
+
+    if (!(flags & GC_finish_FLAG))
+        Parrot_gc_event_begin(interp, -1);
+
     gc_ms2_mark_live_objects(interp, self, flags);
 
     /* At this point of time new_objects contains only live PMCs */
@@ -1097,6 +1107,8 @@ gc_ms2_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
 
     self->gc_threshold = stats->mem_used_last_collect + threshold;
 
+    Parrot_gc_event_end(interp);
+
     self->gc_mark_block_level--;
     self->num_early_gc_PMCs = 0;
 }
@@ -1161,6 +1173,7 @@ gc_ms2_sweep_pmc_pool(PARROT_INTERP,
             PMC_data(pmc) = NULL;
 
             interp->gc_sys->stats.memory_used -= sizeof (PMC);
+            ++interp->gc_sys->events.current.objects_freed;
 
             PObj_on_free_list_SET(pmc);
             PObj_gc_CLEAR(pmc);
@@ -1228,11 +1241,15 @@ gc_ms2_sweep_string_pool(PARROT_INTERP,
             PObj_live_CLEAR(obj);
 
         else if (!PObj_constant_TEST(obj)) {
+            if (STRING_interned_TEST(obj))
+                Parrot_str_intern_forget(interp, obj);
+
             Parrot_pa_remove(interp, list, STR2PAC(obj)->ptr);
             if (Buffer_bufstart(obj) && !PObj_external_TEST(obj))
                 Parrot_gc_str_free_buffer_storage(interp, &self->string_gc, (Parrot_Buffer*)obj);
 
             interp->gc_sys->stats.memory_used -= sizeof (STRING);
+            ++interp->gc_sys->events.current.objects_freed;
 
             PObj_on_free_list_SET(obj);
 
@@ -182,9 +182,44 @@ typedef struct GC_Statistics {
                                        * the last GC run */
     UINTVAL memory_collected;     /* Total amount of memory copied
                                      during collection */
+    size_t  shared_buffers;       /* Number of COW-shared buffers moved
+                                     during collection without copying */
+    UINTVAL memory_shared;        /* Total amount of memory not copied
+                                     because it was shared */
 
 } GC_Statistics;
 
+/* One collection, as recorded in the GC event log. See src/gc/gc_events.c */
+typedef struct GC_Event {
+    size_t      run;                /* gc_mark_runs counting this one */
+    INTVAL      generation;         /* oldest generation collected, or -1 for
+                                     * collectors without generations */
+    UHUGEINTVAL start;              /* Parrot_hires_get_time() at start */
+    UHUGEINTVAL pause;              /* nanoseconds spent collecting */
+    size_t      objects_freed;      /* PMC and STRING headers freed */
+    size_t      objects_promoted;   /* headers moved to an older generation */
+    size_t      bytes_freed;        /* drop of memory_used */
+    size_t      dirty_list_size;    /* objects on the dirty list afterwards */
+    size_t      memory_used;        /* memory_used afterwards */
+} GC_Event;
+
+/* Number of most recent collections kept in the event log */
+#define GC_EVENT_LOG_SIZE 64
+
+typedef struct GC_Event_Log {
+    GC_Event    current;            /* collection in progress */
+    size_t      used_before;        /* memory_used when it started */
+    int         in_progress;
+
+    GC_Event    events[GC_EVENT_LOG_SIZE];  /* ring of finished collections */
+    size_t      count;              /* number of collections ever logged */
+    UHUGEINTVAL epoch;              /* when the GC was initialized */
+
+    FILE       *trace;              /* trace file, if tracing */
+    PMC        *alloc_sites;        /* Hash of allocation site => count */
+    UINTVAL     alloc_sample_interval;  /* sample every Nth PMC, 0 = never */
+} GC_Event_Log;
+
 /* Callback for live string. Use Parrot_Buffer for now... */
 typedef void (*string_iterator_callback)(PARROT_INTERP, Parrot_Buffer *str, void *data);
 
@@ -258,6 +293,10 @@ typedef struct GC_Subsystem {
     void* (*get_low_pmc_ptr)(PARROT_INTERP);
     void* (*get_high_pmc_ptr)(PARROT_INTERP);
 
+    /* Optional. Called with every word found during scanning of C stack.
+       Used by GC moving objects to pin ones referenced from C code */
+    void (*pin_stack_ptr)(PARROT_INTERP, size_t ptr);
+
     /* Iterate over _live_ strings. Used for string pool compacting */
     void (*iterate_live_strings)(PARROT_INTERP, string_iterator_callback callback, void *data);
 
@@ -267,6 +306,9 @@ typedef struct GC_Subsystem {
     /* Statistic for GC */
     struct GC_Statistics stats;
 
+    /* Per-collection events and allocation sites */
+    struct GC_Event_Log events;
+
     /* Holds system-specific data structures */
     void * gc_private;
 } GC_Subsystem;
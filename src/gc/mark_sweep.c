@@ -346,6 +346,7 @@ Parrot_gc_sweep_pool(PARROT_INTERP,
                     gc_object(interp, mem_pools, pool, b);
 
                 add_free_object(interp, mem_pools, pool, b);
+                ++interp->gc_sys->events.current.objects_freed;
             }
             b = (PObj *)((char *)b + object_size);
         }
@@ -695,6 +696,9 @@ free_buffer(PARROT_INTERP, ARGMOD(Memory_Pools *mem_pools),
 {
     ASSERT_ARGS(free_buffer)
 
+    if (PObj_is_string_TEST(b) && STRING_interned_TEST((STRING *)b))
+        Parrot_str_intern_forget(interp, (STRING *)b);
+
     /* If there is no allocated buffer - bail out */
     if (Buffer_buflen(b) == 0)
         return;
@@ -31,6 +31,12 @@ typedef void (*compact_f) (Interp *, GC_Statistics *stats, Variable_Size_Pool *)
 #define RECLAMATION_FACTOR 0.20
 #define WE_WANT_EVER_GROWING_ALLOCATIONS 0
 
+/* Upper bound of memory copied by single compaction run: this fraction of the
+   pool, but at least this many minimum block sizes. Sparse blocks left over
+   are evacuated by following runs */
+#define COMPACT_STEP_DIVISOR 8
+#define COMPACT_STEP_BLOCKS  4
+
 /* HEADERIZER HFILE: src/gc/gc_private.h */
 
 /* HEADERIZER BEGIN: static */
@@ -56,6 +62,17 @@ static void alloc_new_block(PARROT_INTERP,
         FUNC_MODIFIES(*stats)
         FUNC_MODIFIES(*pool);
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_PURE_FUNCTION
+static int block_cmp_occupancy(ARGIN(const void *a), ARGIN(const void *b))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_PURE_FUNCTION
+static UINTVAL block_live_size(ARGIN(const Memory_Block *block))
+        __attribute__nonnull__(1);
+
 PARROT_CANNOT_RETURN_NULL
 PARROT_WARN_UNUSED_RESULT
 static const char * buffer_location(PARROT_INTERP,
@@ -72,16 +89,31 @@ static void compact_pool(PARROT_INTERP,
         FUNC_MODIFIES(*stats)
         FUNC_MODIFIES(*pool);
 
+static void copy_out_slice(ARGMOD(Memory_Block *pool), ARGMOD(STRING *s))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*pool)
+        FUNC_MODIFIES(*s);
+
 static void debug_print_buf(PARROT_INTERP, ARGIN(const Parrot_Buffer *b))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+static void end_survey(PARROT_INTERP, ARGMOD(Variable_Size_Pool *pool))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*pool);
+
+static void end_survey_callback(PARROT_INTERP,
+    ARGIN(Parrot_Buffer *b),
+    void *data)
+        __attribute__nonnull__(2);
+
 static void free_memory_pool(ARGFREE(Variable_Size_Pool *pool));
 static void free_old_mem_blocks(
      ARGMOD(GC_Statistics *stats),
     ARGMOD(Variable_Size_Pool *pool),
-    ARGMOD(Memory_Block *new_block),
-    UINTVAL total_size)
+    ARGMOD(Memory_Block *new_block))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
         __attribute__nonnull__(3)
@@ -92,6 +124,11 @@ static void free_old_mem_blocks(
 static int is_block_almost_full(ARGIN(const Memory_Block *block))
         __attribute__nonnull__(1);
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_PURE_FUNCTION
+static int is_pinning_slice(ARGIN(const Parrot_Buffer *b))
+        __attribute__nonnull__(1);
+
 PARROT_MALLOC
 PARROT_CANNOT_RETURN_NULL
 static void * mem_allocate(PARROT_INTERP,
@@ -126,9 +163,20 @@ static Variable_Size_Pool * new_memory_pool(
     size_t min_block,
     NULLOK(compact_f compact));
 
-PARROT_CANNOT_RETURN_NULL
-static UINTVAL pad_pool_size(ARGIN(const Variable_Size_Pool *pool))
-        __attribute__nonnull__(1);
+PARROT_WARN_UNUSED_RESULT
+static UINTVAL select_blocks_to_evacuate(ARGMOD(Variable_Size_Pool *pool))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*pool);
+
+static void survey_buffer_callback(PARROT_INTERP,
+    ARGIN(Parrot_Buffer *b),
+    void *data)
+        __attribute__nonnull__(2);
+
+static void survey_pool(PARROT_INTERP, ARGMOD(Variable_Size_Pool *pool))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*pool);
 
 #define ASSERT_ARGS_aligned_mem __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(buffer_unused) \
@@ -138,6 +186,11 @@ static UINTVAL pad_pool_size(ARGIN(const Variable_Size_Pool *pool))
     , PARROT_ASSERT_ARG(stats) \
     , PARROT_ASSERT_ARG(pool) \
     , PARROT_ASSERT_ARG(why))
+#define ASSERT_ARGS_block_cmp_occupancy __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(a) \
+    , PARROT_ASSERT_ARG(b))
+#define ASSERT_ARGS_block_live_size __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(block))
 #define ASSERT_ARGS_buffer_location __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(b))
@@ -145,9 +198,17 @@ static UINTVAL pad_pool_size(ARGIN(const Variable_Size_Pool *pool))
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(stats) \
     , PARROT_ASSERT_ARG(pool))
+#define ASSERT_ARGS_copy_out_slice __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(pool) \
+    , PARROT_ASSERT_ARG(s))
 #define ASSERT_ARGS_debug_print_buf __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(b))
+#define ASSERT_ARGS_end_survey __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pool))
+#define ASSERT_ARGS_end_survey_callback __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(b))
 #define ASSERT_ARGS_free_memory_pool __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS_free_old_mem_blocks __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(stats) \
@@ -155,6 +216,8 @@ static UINTVAL pad_pool_size(ARGIN(const Variable_Size_Pool *pool))
     , PARROT_ASSERT_ARG(new_block))
 #define ASSERT_ARGS_is_block_almost_full __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(block))
+#define ASSERT_ARGS_is_pinning_slice __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(b))
 #define ASSERT_ARGS_mem_allocate __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(stats) \
@@ -168,8 +231,13 @@ static UINTVAL pad_pool_size(ARGIN(const Variable_Size_Pool *pool))
     , PARROT_ASSERT_ARG(pool) \
     , PARROT_ASSERT_ARG(old_buf))
 #define ASSERT_ARGS_new_memory_pool __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
-#define ASSERT_ARGS_pad_pool_size __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+#define ASSERT_ARGS_select_blocks_to_evacuate __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(pool))
+#define ASSERT_ARGS_survey_buffer_callback __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(b))
+#define ASSERT_ARGS_survey_pool __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pool))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
@@ -477,17 +545,22 @@ Parrot_gc_str_free_buffer_storage(SHIM_INTERP,
         /* Update Memory_Block usage */
         if (PObj_is_movable_TESTALL(b)) {
             const INTVAL * const buffer_flags = Buffer_bufflagsptr(b);
+            const size_t         size = ALIGNED_STRING_SIZE(Buffer_buflen(b));
 
-            /* Mask low 2 bits used for flags */
+            /* Mask low bits used for flags */
             Memory_Block * block = Buffer_pool(b);
 
             PARROT_ASSERT(block);
 
-            /* We can have shared buffers. Don't count them (yet) */
+            /* We can have shared buffers. Don't count them (yet), but let
+             * compact_pool know that a survey may find them dead */
             if (!(*buffer_flags & Buffer_shared_FLAG)) {
-                block->freed  += ALIGNED_STRING_SIZE(Buffer_buflen(b));
+                block->freed                     += size;
+                mem_pool->guaranteed_reclaimable += size;
             }
 
+            mem_pool->possibly_reclaimable += size;
+
         }
     }
 
@@ -751,6 +824,16 @@ Variable_Size_Pool *pool)>
 Compact the string buffer pool. Does not perform a GC scan, or mark items
 as being alive in any way.
 
+Only the sparsest blocks are evacuated, up to 1/C<COMPACT_STEP_DIVISOR> of the
+pool per run. Remaining sparse blocks are handled by subsequent runs, so a
+single run doesn't copy the whole pool.
+
+Shared buffers aren't counted as freed when one of their headers dies, so a
+big buffer whose parent string is gone looks alive as long as any slice of
+it is. When enough shared memory may have been let go since the last run,
+C<survey_pool()> measures the live memory of each block, and the small
+slices found in evacuated blocks are copied out of the buffers they pin.
+
 =cut
 
 */
@@ -763,6 +846,7 @@ compact_pool(PARROT_INTERP,
     ASSERT_ARGS(compact_pool)
     UINTVAL       total_size, new_size;
     Memory_Block *new_block;
+    int           surveyed;
 
     /* Bail if we're blocked */
     if (Parrot_is_blocked_GC_sweep(interp))
@@ -773,11 +857,23 @@ compact_pool(PARROT_INTERP,
     /* We're collecting */
     ++stats->gc_collect_runs;
 
-    /* Snag a block big enough for everything */
-    total_size = pad_pool_size(pool);
+    surveyed = pool->possibly_reclaimable - pool->guaranteed_reclaimable
+             > pool->total_allocated * pool->reclaim_factor;
+
+    if (surveyed)
+        survey_pool(interp, pool);
+
+    /* Choose blocks to evacuate and snag a block big enough for them */
+    total_size = select_blocks_to_evacuate(pool);
 
     if (total_size == 0) {
-        free_old_mem_blocks(stats, pool, pool->top_block, total_size);
+        /* Nothing alive in selected blocks. Keep top block for allocations */
+        pool->top_block->evacuate = 0;
+        free_old_mem_blocks(stats, pool, pool->top_block);
+
+        if (surveyed)
+            end_survey(interp, pool);
+
         Parrot_unblock_GC_sweep(interp);
         return;
     }
@@ -798,7 +894,10 @@ compact_pool(PARROT_INTERP,
     stats->memory_collected += new_size;
     stats->memory_used      += new_size;
 
-    free_old_mem_blocks(stats, pool, new_block, total_size);
+    free_old_mem_blocks(stats, pool, new_block);
+
+    if (surveyed)
+        end_survey(interp, pool);
 
     Parrot_unblock_GC_sweep(interp);
 }
@@ -808,7 +907,9 @@ compact_pool(PARROT_INTERP,
 =item C<static void move_buffer_callback(PARROT_INTERP, Parrot_Buffer *b, void
 *data)>
 
-Callback for live STRING/Buffer for compating.
+Callback for live STRING/Buffer for compating. Moves buffers living in
+blocks selected for evacuation. In surveyed blocks, a small slice of a shared
+buffer which hasn't moved yet gets a copy of just its own bytes.
 
 =cut
 
@@ -822,77 +923,236 @@ move_buffer_callback(PARROT_INTERP, ARGIN(Parrot_Buffer *b), ARGIN(void *data))
     if (Buffer_buflen(b) && PObj_is_movable_TESTALL(b)) {
         Memory_Block * const old_block = Buffer_pool(b);
 
-        if (!is_block_almost_full(old_block))
-            move_one_buffer(interp, new_block, b);
+        if (old_block->evacuate) {
+            if (old_block->surveyed && is_pinning_slice(b)
+            && !(*Buffer_bufflagsptr(b) & Buffer_moved_FLAG))
+                copy_out_slice(new_block, (STRING *)b);
+            else
+                move_one_buffer(interp, new_block, b);
+        }
     }
 
 }
 
 /*
 
-=item C<static UINTVAL pad_pool_size(const Variable_Size_Pool *pool)>
+=item C<static int is_pinning_slice(const Parrot_Buffer *b)>
 
-Calculate the size of the new pool. The currently used size equals the total
-size minus the reclaimable size. Add a minimum block to the current amount, so
-we can avoid having to allocate it in the future.
+Returns true if C<b> is a string sharing a buffer which is much bigger than
+the string itself, by the same measure C<Parrot_str_new_slice()> uses to
+decide against sharing.
 
-Returns 0 if all blocks below the top block are almost full. In this case
-compacting is not needed.
+=cut
 
-TODO - Big blocks
+*/
 
-Currently all available blocks are compacted into one new
-block with total_size. This is suboptimal, if the block has
-just one live item from a big allocation.
+PARROT_WARN_UNUSED_RESULT
+PARROT_PURE_FUNCTION
+static int
+is_pinning_slice(ARGIN(const Parrot_Buffer *b))
+{
+    ASSERT_ARGS(is_pinning_slice)
+    const STRING * const s = (const STRING *)b;
+
+    return PObj_is_string_TEST(b)
+        && PObj_is_COWable_TEST(b)
+        && (*Buffer_bufflagsptr(b) & Buffer_shared_FLAG)
+        && s->bufused
+        && STRING_slice_pins(s->bufused, Buffer_buflen(b));
+}
+
+/*
 
-But currently it's unknown if the buffer memory is alive
-as the live bits are in Buffer headers. We have to run the
-compaction loop to check liveness. OTOH if this compaction
-is running through all the buffer headers, there is no
-relation to the block.
+=item C<static void copy_out_slice(Memory_Block *pool, STRING *s)>
 
-Moving the live bit into the buffer thus also solves this
-problem easily.
+Gives the string C<s> a buffer of its own in C<pool>, holding only its
+C<bufused> bytes, so that it no longer keeps its shared buffer alive.
 
 =cut
 
 */
 
-PARROT_CANNOT_RETURN_NULL
+static void
+copy_out_slice(ARGMOD(Memory_Block *pool), ARGMOD(STRING *s))
+{
+    ASSERT_ARGS(copy_out_slice)
+    char * const mem = aligned_mem((Parrot_Buffer *)s, pool->top);
+    const size_t len = ALIGNED_STRING_SIZE(s->bufused) - sizeof (void *);
+
+    memcpy(mem, s->strstart, s->bufused);
+
+    Buffer_bufstart(s) = s->strstart = mem;
+    Buffer_buflen(s)   = len;
+    *Buffer_poolptr(s) = pool;
+
+    pool->top = mem + len;
+}
+
+/*
+
+=item C<static void survey_pool(PARROT_INTERP, Variable_Size_Pool *pool)>
+
+Measures the memory each block of C<pool> would need if it were evacuated,
+walking all live strings and buffers. Unshared buffers count in full. A
+shared buffer counts once, unless a header is a small slice of it: that
+only counts the copy C<copy_out_slice()> would make, so a big buffer kept
+alive by nothing but small slices counts as free. The result replaces the
+C<freed> estimate for choosing blocks, until C<end_survey()>.
+
+=item C<static void survey_buffer_callback(PARROT_INTERP, Parrot_Buffer *b, void
+*data)>
+
+Adds the live size of C<b> to the block it lives in.
+
+=item C<static void end_survey(PARROT_INTERP, Variable_Size_Pool *pool)>
+
+Clears the survey marks left on the buffers and blocks of C<pool>.
+
+=item C<static void end_survey_callback(PARROT_INTERP, Parrot_Buffer *b, void
+*data)>
+
+Clears the survey mark of C<b>.
+
+=cut
+
+*/
+
+static void
+survey_pool(PARROT_INTERP, ARGMOD(Variable_Size_Pool *pool))
+{
+    ASSERT_ARGS(survey_pool)
+    Memory_Block *cur_block;
+
+    for (cur_block = pool->top_block; cur_block; cur_block = cur_block->prev) {
+        cur_block->live     = 0;
+        cur_block->surveyed = 1;
+    }
+
+    interp->gc_sys->iterate_live_strings(interp, survey_buffer_callback, NULL);
+
+    for (cur_block = pool->top_block; cur_block; cur_block = cur_block->prev) {
+        const size_t used = cur_block->size - cur_block->free;
+
+        cur_block->freed = cur_block->live < used ? used - cur_block->live : 0;
+    }
+}
+
+static void
+survey_buffer_callback(SHIM_INTERP, ARGIN(Parrot_Buffer *b), SHIM(void *data))
+{
+    ASSERT_ARGS(survey_buffer_callback)
+
+    if (Buffer_buflen(b) && PObj_is_movable_TESTALL(b)) {
+        Memory_Block * const block = Buffer_pool(b);
+        INTVAL       * const flags = Buffer_bufflagsptr(b);
+
+        if (!PObj_is_COWable_TEST(b) || !(*flags & Buffer_shared_FLAG))
+            block->live += ALIGNED_STRING_SIZE(Buffer_buflen(b));
+        else if (is_pinning_slice(b))
+            block->live += ALIGNED_STRING_SIZE(((STRING *)b)->bufused);
+        else if (!(*flags & Buffer_counted_FLAG)) {
+            *flags      |= Buffer_counted_FLAG;
+            block->live += ALIGNED_STRING_SIZE(Buffer_buflen(b));
+        }
+    }
+}
+
+static void
+end_survey(PARROT_INTERP, ARGMOD(Variable_Size_Pool *pool))
+{
+    ASSERT_ARGS(end_survey)
+    Memory_Block *cur_block;
+
+    interp->gc_sys->iterate_live_strings(interp, end_survey_callback, NULL);
+
+    for (cur_block = pool->top_block; cur_block; cur_block = cur_block->prev)
+        cur_block->surveyed = 0;
+}
+
+static void
+end_survey_callback(SHIM_INTERP, ARGIN(Parrot_Buffer *b), SHIM(void *data))
+{
+    ASSERT_ARGS(end_survey_callback)
+
+    if (Buffer_buflen(b) && PObj_is_movable_TESTALL(b) && PObj_is_COWable_TEST(b))
+        *Buffer_bufflagsptr(b) &= ~Buffer_counted_FLAG;
+}
+
+/*
+
+=item C<static UINTVAL select_blocks_to_evacuate(Variable_Size_Pool *pool)>
+
+Mark blocks to be evacuated by the current compaction run and return the
+amount of live memory in them. Blocks which are almost full are never
+selected. Others are taken in order of increasing occupancy, because the
+sparsest blocks give back most memory for every byte copied, until the step
+size is reached. The top block is
+evacuated together with them, so its unused space moves to the new top block.
+
+Returns 0 if all blocks below the top block are almost full. In this case
+compacting is not needed.
+
+Liveness is estimated from the C<free> and C<freed> accounting. Freed shared
+buffers aren't counted, so the estimate may be too high, never too low.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
 static UINTVAL
-pad_pool_size(ARGIN(const Variable_Size_Pool *pool))
+select_blocks_to_evacuate(ARGMOD(Variable_Size_Pool *pool))
 {
-    ASSERT_ARGS(pad_pool_size)
-    Memory_Block *cur_block = pool->top_block->prev;
+    ASSERT_ARGS(select_blocks_to_evacuate)
+    Memory_Block  *cur_block;
+    Memory_Block **candidates;
+    UINTVAL        step_size  = pool->total_allocated / COMPACT_STEP_DIVISOR;
+    UINTVAL        total_size = 0;
+    size_t         count      = 0;
+    size_t         i;
+
+    for (cur_block = pool->top_block->prev; cur_block; cur_block = cur_block->prev)
+        if (!is_block_almost_full(cur_block))
+            ++count;
 
-    UINTVAL total_size   = 0;
-#if RESOURCE_DEBUG
-    size_t  total_blocks = 1;
-#endif
+    if (count == 0)
+        return 0;
 
-    while (cur_block) {
+    if (step_size < COMPACT_STEP_BLOCKS * pool->minimum_block_size)
+        step_size = COMPACT_STEP_BLOCKS * pool->minimum_block_size;
+
+    candidates = mem_internal_allocate_n_zeroed_typed(count, Memory_Block *);
+
+    count = 0;
+    for (cur_block = pool->top_block->prev; cur_block; cur_block = cur_block->prev)
         if (!is_block_almost_full(cur_block))
-            total_size += cur_block->size - cur_block->freed - cur_block->free;
-        cur_block   = cur_block->prev;
-#if RESOURCE_DEBUG
-        ++total_blocks;
-#endif
+            candidates[count++] = cur_block;
+
+    qsort(candidates, count, sizeof (Memory_Block *), block_cmp_occupancy);
+
+    for (i = 0; i < count; ++i) {
+        const UINTVAL live = block_live_size(candidates[i]);
+
+        /* Always make some progress */
+        if (i > 0 && total_size + live > step_size)
+            break;
+
+        candidates[i]->evacuate  = 1;
+        total_size              += live;
     }
 
-    if (total_size == 0)
-        return 0;
+    mem_internal_free(candidates);
 
     cur_block = pool->top_block;
-    if (!is_block_almost_full(cur_block))
-        total_size += cur_block->size - cur_block->freed - cur_block->free;
+    if (!is_block_almost_full(cur_block)) {
+        cur_block->evacuate  = 1;
+        total_size          += block_live_size(cur_block);
+    }
 
     /* this makes for ever increasing allocations but fewer collect runs */
 #if WE_WANT_EVER_GROWING_ALLOCATIONS
-    total_size += pool->minimum_block_size;
-#endif
-
-#if RESOURCE_DEBUG
-    fprintf(stderr, "Total blocks: %d\n", total_blocks);
+    if (total_size)
+        total_size += pool->minimum_block_size;
 #endif
 
     return total_size;
@@ -900,6 +1160,46 @@ pad_pool_size(ARGIN(const Variable_Size_Pool *pool))
 
 /*
 
+=item C<static UINTVAL block_live_size(const Memory_Block *block)>
+
+Returns the amount of memory in C<block> which may still be in use, or the
+amount a survey found in use.
+
+=item C<static int block_cmp_occupancy(const void *a, const void *b)>
+
+C<qsort> comparator ordering blocks by increasing occupancy.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_PURE_FUNCTION
+static UINTVAL
+block_live_size(ARGIN(const Memory_Block *block))
+{
+    ASSERT_ARGS(block_live_size)
+    return block->surveyed
+         ? block->live
+         : block->size - block->free - block->freed;
+}
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_PURE_FUNCTION
+static int
+block_cmp_occupancy(ARGIN(const void *a), ARGIN(const void *b))
+{
+    ASSERT_ARGS(block_cmp_occupancy)
+    const Memory_Block * const x = *(Memory_Block * const *)a;
+    const Memory_Block * const y = *(Memory_Block * const *)b;
+    const FLOATVAL ox = (FLOATVAL)block_live_size(x) / x->size;
+    const FLOATVAL oy = (FLOATVAL)block_live_size(y) / y->size;
+
+    return ox < oy ? -1 : ox > oy ? 1 : 0;
+}
+
+/*
+
 =item C<static void move_one_buffer(PARROT_INTERP, Memory_Block *pool,
 Parrot_Buffer *old_buf)>
 
@@ -923,8 +1223,6 @@ move_one_buffer(PARROT_INTERP, ARGIN(Memory_Block *pool),
 #if RESOURCE_DEBUG
     if (Buffer_buflen(old_buf) >= RESOURCE_DEBUG_SIZE)
         debug_print_buf(interp, old_buf);
-#else
-    UNUSED(interp);
 #endif
 
     /* we can't perform the math all the time, because
@@ -952,6 +1250,10 @@ move_one_buffer(PARROT_INTERP, ARGIN(Memory_Block *pool),
 
         /* Now make sure we point to where the other guy does */
         Buffer_bufstart(old_buf) = Buffer_bufstart(hdr);
+
+        /* Sharing saved us a copy */
+        ++interp->gc_sys->stats.shared_buffers;
+        interp->gc_sys->stats.memory_shared += Buffer_buflen(old_buf);
     }
     else {
         char * const new_pool_ptr = aligned_mem(old_buf, pool->top);
@@ -990,15 +1292,17 @@ move_one_buffer(PARROT_INTERP, ARGIN(Memory_Block *pool),
 /*
 
 =item C<static void free_old_mem_blocks( GC_Statistics *stats,
-Variable_Size_Pool *pool, Memory_Block *new_block, UINTVAL total_size)>
+Variable_Size_Pool *pool, Memory_Block *new_block)>
 
-The compact_pool operation collects disjointed blocks of memory allocated on a
-given pool's free list into one large block of memory, setting it as the new
-top block for the pool. Once that is done, and all items have been moved into
-the new block of memory, this function iterates through the old blocks and
-frees each one. It also performs the necessary housekeeping to record the
-freed memory blocks. At the end of this function, the pool will have only one
-block of memory on its free list.
+The compact_pool operation moves live buffers out of the blocks selected for
+evacuation into one new block, setting it as the new top block for the pool.
+Once that is done, this function iterates through the old blocks and frees
+the evacuated ones. It also performs the necessary housekeeping to record the
+freed memory blocks.
+
+Only the memory of the freed blocks is taken off the reclaimable counts of
+the pool. Sparse blocks left for a later run still count, so they go on
+triggering surveys and compactions.
 
 =cut
 
@@ -1008,20 +1312,22 @@ static void
 free_old_mem_blocks(
         ARGMOD(GC_Statistics *stats),
         ARGMOD(Variable_Size_Pool *pool),
-        ARGMOD(Memory_Block *new_block),
-        UINTVAL total_size)
+        ARGMOD(Memory_Block *new_block))
 {
     ASSERT_ARGS(free_old_mem_blocks)
     Memory_Block *prev_block = new_block;
     Memory_Block *cur_block  = new_block->prev;
+    size_t        left       = new_block->freed;
+    size_t        reclaimed;
 
     PARROT_ASSERT(new_block == pool->top_block);
 
     while (cur_block) {
         Memory_Block * const next_block = cur_block->prev;
 
-        if (is_block_almost_full(cur_block)) {
+        if (!cur_block->evacuate) {
             /* Skip block */
+            left      += cur_block->freed;
             prev_block = cur_block;
             cur_block  = next_block;
         }
@@ -1029,6 +1335,7 @@ free_old_mem_blocks(
             /* Note that we don't have it any more */
             stats->memory_allocated -= cur_block->size;
             stats->memory_used      -= cur_block->size - cur_block->free;
+            pool->total_allocated   -= cur_block->size;
 
             /* We know the pool body and pool header are a single chunk, so
              * this is enough to get rid of 'em both */
@@ -1037,20 +1344,23 @@ free_old_mem_blocks(
 
             /* Unlink it from list */
             prev_block->prev = next_block;
+            if (next_block)
+                next_block->next = prev_block;
         }
     }
 
     /* Terminate list */
     prev_block->prev = NULL;
 
+    /* After a survey, the blocks left may count more than was guaranteed */
+    reclaimed = pool->guaranteed_reclaimable > left
+              ? pool->guaranteed_reclaimable - left
+              : 0;
 
-    /* ANR: I suspect this should be set to new_block->size, instead of passing
-     * in the raw value of total_size, because alloc_new_block pads the size of
-     * the new block under certain conditions. Leaving it unmodified for now,
-     * so this refactor has no functionality changes, only code cleanups.*/
-    pool->total_allocated        = total_size;
-    pool->guaranteed_reclaimable = 0;
-    pool->possibly_reclaimable   = 0;
+    pool->guaranteed_reclaimable = left;
+    pool->possibly_reclaimable   = pool->possibly_reclaimable > left + reclaimed
+                                 ? pool->possibly_reclaimable - reclaimed
+                                 : left;
 }
 
 /*
@@ -474,6 +474,9 @@ trace_mem_block(PARROT_INTERP,
         if (!ptr)
             continue;
 
+        if (interp->gc_sys->pin_stack_ptr)
+            interp->gc_sys->pin_stack_ptr(interp, ptr);
+
         /* Do a quick approximate range check by bit-masking */
         if ((ptr & mask) == prefix || !prefix) {
             /* Note that what we find via the stack or registers are not
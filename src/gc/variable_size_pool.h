@@ -27,6 +27,14 @@ typedef struct Memory_Block {
 
     /* Amount of freed memory. Used in compact_pool */
     size_t freed;
+
+    /* Block is selected for evacuation by current compact_pool run */
+    int evacuate;
+
+    /* Memory found alive by a survey in the current compact_pool run, and
+     * whether there was one. Replaces the estimate from free and freed */
+    size_t live;
+    int surveyed;
 } Memory_Block;
 
 typedef struct Variable_Size_Pool {
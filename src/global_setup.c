@@ -185,6 +185,7 @@ init_world(PARROT_INTERP)
     PARROT_STATIC_ASSERT(sizeof (INTVAL) == sizeof (opcode_t));
 
     Parrot_platform_init_code();
+    Parrot_oo_init_shapes();
 
     /* Call base vtable class constructor methods */
     Parrot_gbl_setup_2(interp);
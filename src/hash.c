@@ -274,6 +274,10 @@ hash_compare_string(PARROT_INTERP, ARGIN(const void *search_key), ARGIN(const vo
     const STRING * const s1 = (const STRING *)search_key;
     const STRING * const s2 = (const STRING *)bucket_key;
 
+    /* the same STRING, as with interned keys */
+    if (s1 == s2)
+        return 0;
+
     return !STRING_equal(interp, s1, s2);
 }
 
@@ -298,9 +302,11 @@ hash_compare_string_enc(ARGIN(const void *search_key), ARGIN(const void *bucket_
     const STRING * const s1 = (const STRING *)search_key;
     const STRING * const s2 = (const STRING *)bucket_key;
 
+    if (s1 == s2)
+        return 0;
     if (s1->hashval != s2->hashval)
         return 1;
-    if (s1->encoding != s2->encoding)
+    if (s1->encoding != s2->encoding || s1->bufused != s2->bufused)
         return 1;
     else
         return memcmp(s1->strstart, s2->strstart, s1->bufused);
@@ -319,6 +319,14 @@ Parrot_interp_initialize_interpreter(PARROT_INTERP, ARGIN(Parrot_GC_Init_Args *a
     /* initialize built-in runcores */
     Parrot_runcore_init(interp);
 
+    /* GC tracing, allocation site sampling and the sampling profiler
+     * requested in the environment. Thread interpreters are cloned without
+     * coming through here. */
+    if (!interp->parent_interpreter) {
+        Parrot_gc_events_init(interp);
+        Parrot_runcore_sampler_init(interp);
+    }
+
     /* Load the core op func and info tables */
     interp->all_op_libs         = NULL;
     interp->evc_func_table      = NULL;
@@ -448,6 +456,9 @@ Parrot_interp_really_destroy(PARROT_INTERP, SHIM(int exit_code), SHIM(void *arg)
     if (!interp->parent_interpreter)
         Parrot_runcore_destroy(interp);
 
+    /* write allocation sites and close the GC trace */
+    Parrot_gc_events_finish(interp);
+
     /*
      * now all objects that need timely destruction should be finalized
      * so terminate the event loop
@@ -475,6 +486,7 @@ Parrot_interp_really_destroy(PARROT_INTERP, SHIM(int exit_code), SHIM(void *arg)
 
     /* cache structure */
     destroy_object_cache(interp);
+    Parrot_sprintf_destroy_cache(interp);
 
     if (interp->evc_func_table) {
         mem_gc_free(interp, interp->evc_func_table);
@@ -833,6 +845,24 @@ Parrot_interp_info(PARROT_INTERP, INTVAL what)
       case IMPATIENT_PMCS:
         ret = Parrot_gc_impatient_pmcs(interp);
         break;
+      case FIXED_SIZE_ARENAS:
+        ret = Parrot_gc_fixed_size_arenas(interp);
+        break;
+      case FIXED_SIZE_FREE_MEM:
+        ret = Parrot_gc_fixed_size_free_memory(interp);
+        break;
+      case TOTAL_EVACUATED:
+        ret = Parrot_gc_total_evacuated(interp);
+        break;
+      case ARENAS_RELEASED:
+        ret = Parrot_gc_arenas_released(interp);
+        break;
+      case SHARED_BUFFERS_MOVED:
+        ret = Parrot_gc_shared_buffers_moved(interp);
+        break;
+      case TOTAL_SHARED:
+        ret = Parrot_gc_total_shared(interp);
+        break;
       case CURRENT_RUNCORE:
         ret = interp->run_core->id;
         break;
@@ -887,11 +917,14 @@ Parrot_interp_info_p(PARROT_INTERP, INTVAL what)
     switch (what) {
       case CURRENT_CTX:
         result = CURRENT_CONTEXT(interp);
+        CALLSIGNATURE_escaped_SET(result);
         break;
       case CURRENT_SUB:
         result = Parrot_pcc_get_sub(interp, CURRENT_CONTEXT(interp));
         break;
       case CURRENT_CONT:
+        /* the current frame must keep its return continuation */
+        CALLSIGNATURE_escaped_SET(CURRENT_CONTEXT(interp));
         result = Parrot_pcc_get_continuation(interp, CURRENT_CONTEXT(interp));
         break;
       case CURRENT_LEXPAD:
@@ -900,6 +933,12 @@ Parrot_interp_info_p(PARROT_INTERP, INTVAL what)
       case CURRENT_TASK:
         result = Parrot_cx_current_task(interp);
         break;
+      case GC_EVENTS:
+        result = Parrot_gc_event_log(interp);
+        break;
+      case GC_ALLOCATION_SITES:
+        result = Parrot_gc_allocation_sites(interp);
+        break;
       default:        /* or a warning only? */
         Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_UNIMPLEMENTED,
                 "illegal argument in Parrot_interp_info_p");
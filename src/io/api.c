@@ -978,6 +978,59 @@ Parrot_io_readline_s(PARROT_INTERP, ARGMOD(PMC *handle), ARGIN(STRING * terminat
 
 /*
 
+=item C<size_t Parrot_io_read_b(PARROT_INTERP, PMC *handle, char *buffer, size_t
+byte_length)>
+
+Reads up to C<byte_length> bytes from C<handle> into C<buffer>. This is for
+raw input and does not take into account string encodings. Returns the number
+of bytes read, which is less than requested only at end of file.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+size_t
+Parrot_io_read_b(PARROT_INTERP, ARGMOD(PMC *handle), ARGOUT(char *buffer),
+        size_t byte_length)
+{
+    ASSERT_ARGS(Parrot_io_read_b)
+
+    if (PMC_IS_NULL(handle))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_PIO_ERROR,
+            "Attempt to read bytes from a null or invalid PMC");
+
+    if (!byte_length)
+        return 0;
+
+    {
+        const IO_VTABLE * const vtable = IO_GET_VTABLE(interp, handle);
+        IO_BUFFER * const read_buffer = IO_GET_READ_BUFFER(interp, handle);
+        IO_BUFFER * const write_buffer = IO_GET_WRITE_BUFFER(interp, handle);
+        size_t total_read = 0;
+
+        io_verify_is_open_for(interp, handle, vtable, PIO_F_READ);
+        io_sync_buffers_for_read(interp, handle, vtable, read_buffer, write_buffer);
+
+        /* Pipes and sockets may return short reads; keep going until the
+           request is satisfied or the handle runs dry. */
+        while (total_read < byte_length) {
+            const size_t bytes_read = Parrot_io_buffer_read_b(interp, read_buffer,
+                    handle, vtable, buffer + total_read, byte_length - total_read);
+            if (bytes_read == 0) {
+                vtable->set_eof(interp, handle, 1);
+                break;
+            }
+            total_read += bytes_read;
+        }
+        vtable->adv_position(interp, handle, total_read);
+        return total_read;
+    }
+}
+
+/*
+
 =item C<size_t Parrot_io_write_b(PARROT_INTERP, PMC *handle, const void *buffer,
 size_t byte_length)>
 
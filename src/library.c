@@ -21,6 +21,7 @@ dynext files (via C<loadlib>).
 
 #include "parrot/parrot.h"
 #include "parrot/dynext.h"
+#include "pmc/pmc_resizablestringarray.h"
 #include "library.str"
 
 /* HEADERIZER HFILE: include/parrot/library.h */
@@ -35,6 +36,12 @@ static void add_env_paths(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static STRING* check_located_file(PARROT_INTERP, ARGIN(PMC *found))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_CANNOT_RETURN_NULL
 static STRING * cnv_to_win32_filesep(PARROT_INTERP,
@@ -42,6 +49,16 @@ static STRING * cnv_to_win32_filesep(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static PMC* get_located_files(PARROT_INTERP,
+    enum_lib_paths which,
+    ARGIN(PMC *paths),
+    ARGIN(STRING *prefix))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_CANNOT_RETURN_NULL
 static PMC* get_search_paths(PARROT_INTERP, enum_lib_paths which)
@@ -68,6 +85,14 @@ static STRING* path_guarantee_trailing_separator(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+PARROT_WARN_UNUSED_RESULT
+static int same_search_paths(PARROT_INTERP,
+    ARGIN(PMC *paths),
+    ARGIN(PMC *seen))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
 static STRING* try_bytecode_extensions(PARROT_INTERP, ARGIN(STRING* path))
@@ -80,13 +105,30 @@ static STRING* try_load_path(PARROT_INTERP, ARGIN(STRING* path))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static STRING* try_located_candidate(PARROT_INTERP,
+    ARGIN(STRING *full_name),
+    enum_runtime_ft type,
+    ARGIN(PMC *found))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(4);
+
 #define ASSERT_ARGS_add_env_paths __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(libpath) \
     , PARROT_ASSERT_ARG(envstr))
+#define ASSERT_ARGS_check_located_file __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(found))
 #define ASSERT_ARGS_cnv_to_win32_filesep __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(path))
+#define ASSERT_ARGS_get_located_files __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(paths) \
+    , PARROT_ASSERT_ARG(prefix))
 #define ASSERT_ARGS_get_search_paths __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_is_abs_path __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -100,12 +142,20 @@ static STRING* try_load_path(PARROT_INTERP, ARGIN(STRING* path))
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(path))
+#define ASSERT_ARGS_same_search_paths __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(paths) \
+    , PARROT_ASSERT_ARG(seen))
 #define ASSERT_ARGS_try_bytecode_extensions __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(path))
 #define ASSERT_ARGS_try_load_path __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(path))
+#define ASSERT_ARGS_try_located_candidate __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(full_name) \
+    , PARROT_ASSERT_ARG(found))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
@@ -660,6 +710,225 @@ try_bytecode_extensions(PARROT_INTERP, ARGIN(STRING* path))
     return NULL;
 }
 
+/* Slots of the per-search-path entries in the located file cache */
+typedef enum {
+    LIB_CACHE_PATHS,        /* copy of the search paths the files were found in */
+    LIB_CACHE_PREFIX,       /* runtime prefix they were found with */
+    LIB_CACHE_FILES,        /* Hash of requested name -> located file */
+    LIB_CACHE_SIZE
+} lib_cache_slot;
+
+/* Slots of a located file */
+typedef enum {
+    LIB_FOUND_NAMES,        /* name found, then the directories probed before it */
+    LIB_FOUND_MTIMES,       /* modify time of each probed directory, -1 if absent */
+    LIB_FOUND_TYPE,         /* file types it was requested as */
+    LIB_FOUND_SIZE
+} lib_found_slot;
+
+/*
+
+=item C<static int same_search_paths(PARROT_INTERP, PMC *paths, PMC *seen)>
+
+Return whether the search paths C<paths> are still the ones C<seen> was copied
+from. For the usual string arrays that is a single comparison of the string
+pointers: C<seen> keeps the strings it shares with C<paths> alive, so equal
+pointers mean equal paths, and anything that changed an entry put a different
+string there.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+same_search_paths(PARROT_INTERP, ARGIN(PMC *paths), ARGIN(PMC *seen))
+{
+    ASSERT_ARGS(same_search_paths)
+    const INTVAL n = VTABLE_elements(interp, paths);
+    INTVAL       i;
+
+    if (n != VTABLE_elements(interp, seen))
+        return 0;
+
+    if (n && paths->vtable->base_type == enum_class_ResizableStringArray
+    &&       seen->vtable->base_type  == enum_class_ResizableStringArray) {
+        STRING **now  = NULL;
+        STRING **then = NULL;
+
+        GETATTR_ResizableStringArray_str_array(interp, paths, now);
+        GETATTR_ResizableStringArray_str_array(interp, seen,  then);
+
+        return memcmp(now, then, n * sizeof (STRING *)) == 0;
+    }
+
+    for (i = 0; i < n; ++i) {
+        if (!STRING_equal(interp,
+                VTABLE_get_string_keyed_int(interp, paths, i),
+                VTABLE_get_string_keyed_int(interp, seen, i)))
+            return 0;
+    }
+
+    return 1;
+}
+
+/*
+
+=item C<static PMC* get_located_files(PARROT_INTERP, enum_lib_paths which, PMC
+*paths, STRING *prefix)>
+
+Return the Hash of files already located in the search paths C<which>, mapping
+the requested name to the name found. Programs tend to ask for the same
+libraries and include files over and over, and every miss in
+C<Parrot_locate_runtime_file_str> costs several string concatenations and a
+stat per search path and extension.
+
+The cache lives in the C<IGLOBALS_LIB_CACHE> slot and is created on first
+use. C<Parrot_lib_add_path> drops the entry for the paths it changes, and
+C<Parrot_lib_forget_located_files> drops them all when the working directory
+changes. Since the search paths are plain string arrays that code is free to
+modify, each entry also remembers the C<paths> and C<prefix> it was filled
+with and is thrown away as soon as either differs.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static PMC*
+get_located_files(PARROT_INTERP, enum_lib_paths which, ARGIN(PMC *paths),
+        ARGIN(STRING *prefix))
+{
+    ASSERT_ARGS(get_located_files)
+    PMC * const iglobals = interp->iglobals;
+    PMC        *cache    = VTABLE_get_pmc_keyed_int(interp, iglobals,
+                                IGLOBALS_LIB_CACHE);
+    PMC        *entry;
+
+    if (PMC_IS_NULL(cache)) {
+        cache = Parrot_pmc_new_init_int(interp, enum_class_FixedPMCArray,
+                    PARROT_LIB_PATH_SIZE);
+        VTABLE_set_pmc_keyed_int(interp, iglobals, IGLOBALS_LIB_CACHE, cache);
+    }
+
+    entry = VTABLE_get_pmc_keyed_int(interp, cache, which);
+
+    if (PMC_IS_NULL(entry)) {
+        entry = Parrot_pmc_new_init_int(interp, enum_class_FixedPMCArray,
+                    LIB_CACHE_SIZE);
+        VTABLE_set_pmc_keyed_int(interp, cache, which, entry);
+    }
+    else if (same_search_paths(interp, paths,
+                VTABLE_get_pmc_keyed_int(interp, entry, LIB_CACHE_PATHS))
+         &&  STRING_equal(interp, prefix,
+                VTABLE_get_string_keyed_int(interp, entry, LIB_CACHE_PREFIX)))
+        return VTABLE_get_pmc_keyed_int(interp, entry, LIB_CACHE_FILES);
+
+    VTABLE_set_pmc_keyed_int(interp, entry, LIB_CACHE_PATHS,
+            VTABLE_clone(interp, paths));
+    VTABLE_set_string_keyed_int(interp, entry, LIB_CACHE_PREFIX, prefix);
+    VTABLE_set_pmc_keyed_int(interp, entry, LIB_CACHE_FILES,
+            Parrot_pmc_new(interp, enum_class_Hash));
+
+    return VTABLE_get_pmc_keyed_int(interp, entry, LIB_CACHE_FILES);
+}
+
+/*
+
+=item C<static STRING* try_located_candidate(PARROT_INTERP, STRING *full_name,
+enum_runtime_ft type, PMC *found)>
+
+Look for C<full_name> like C<Parrot_locate_runtime_file_str> does and return
+the name found or NULL. Unless the very first name tried exists, the directory
+of C<full_name> had a miss, so it is appended to the probed directories in
+C<found> along with its modify time. Creating a file in there changes that
+time, which is how a cached lookup notices that a better candidate turned up.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static STRING*
+try_located_candidate(PARROT_INTERP, ARGIN(STRING *full_name),
+        enum_runtime_ft type, ARGIN(PMC *found))
+{
+    ASSERT_ARGS(try_located_candidate)
+    STRING * const found_name =
+        (type & PARROT_RUNTIME_FT_DYNEXT)
+            ? try_load_path(interp, full_name)
+            : try_bytecode_extensions(interp, full_name);
+
+    if (!found_name || !STRING_equal(interp, found_name, full_name)) {
+        PMC    * const names  = VTABLE_get_pmc_keyed_int(interp, found,
+                                    LIB_FOUND_NAMES);
+        PMC    * const mtimes = VTABLE_get_pmc_keyed_int(interp, found,
+                                    LIB_FOUND_MTIMES);
+        STRING * const sep    = CONST_STRING(interp, "/");
+        STRING * const here   = CONST_STRING(interp, ".");
+        const INTVAL   len    = STRING_length(full_name);
+        const INTVAL   slash  = len > 1
+                              ? Parrot_str_find_reverse_index(interp,
+                                    full_name, sep, len - 1)
+                              : -1;
+        STRING * const dir    = slash < 0
+                              ? here
+                              : STRING_substr(interp, full_name, 0, slash + 1);
+        const INTVAL   n      = VTABLE_elements(interp, names);
+
+        if (n < 2 || !STRING_equal(interp, dir,
+                VTABLE_get_string_keyed_int(interp, names, n - 1))) {
+            VTABLE_push_string(interp, names, dir);
+            VTABLE_push_integer(interp, mtimes,
+                    Parrot_file_modify_time(interp, dir));
+        }
+    }
+
+    return found_name;
+}
+
+/*
+
+=item C<static STRING* check_located_file(PARROT_INTERP, PMC *found)>
+
+Return the name cached in C<found> if it still exists and no directory probed
+before it has changed since, or NULL otherwise. That takes one stat per
+probed directory and one for the file.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static STRING*
+check_located_file(PARROT_INTERP, ARGIN(PMC *found))
+{
+    ASSERT_ARGS(check_located_file)
+    PMC    * const names  = VTABLE_get_pmc_keyed_int(interp, found,
+                                LIB_FOUND_NAMES);
+    PMC    * const mtimes = VTABLE_get_pmc_keyed_int(interp, found,
+                                LIB_FOUND_MTIMES);
+    STRING * const name   = VTABLE_get_string_keyed_int(interp, names, 0);
+    const INTVAL   n      = VTABLE_elements(interp, mtimes);
+    INTVAL         i;
+
+    for (i = 0; i < n; ++i) {
+        STRING * const dir = VTABLE_get_string_keyed_int(interp, names, i + 1);
+
+        if (Parrot_file_modify_time(interp, dir)
+        !=  VTABLE_get_integer_keyed_int(interp, mtimes, i))
+            return NULL;
+    }
+
+    if (!Parrot_file_stat_intval(interp, name, STAT_EXISTS))
+        return NULL;
+
+    return name;
+}
+
 /*
 
 =item C<void Parrot_lib_add_path(PARROT_INTERP, STRING *path_str, enum_lib_paths
@@ -682,7 +951,13 @@ Parrot_lib_add_path(PARROT_INTERP,
     PMC * const lib_paths = VTABLE_get_pmc_keyed_int(interp, iglobals,
         IGLOBALS_LIB_PATHS);
     PMC * const paths = VTABLE_get_pmc_keyed_int(interp, lib_paths, which);
+    PMC * const cache = VTABLE_get_pmc_keyed_int(interp, iglobals,
+        IGLOBALS_LIB_CACHE);
+
     VTABLE_unshift_string(interp, paths, path_str);
+
+    if (!PMC_IS_NULL(cache))
+        VTABLE_set_pmc_keyed_int(interp, cache, which, PMCNULL);
 }
 
 /*
@@ -709,6 +984,28 @@ Parrot_lib_add_path_from_cstring(PARROT_INTERP,
 
 /*
 
+=item C<void Parrot_lib_forget_located_files(PARROT_INTERP)>
+
+Drop every file located in the search paths so far. Relative search paths
+resolve against the working directory, so anything that changes it should
+call this.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_lib_forget_located_files(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_lib_forget_located_files)
+
+    VTABLE_set_pmc_keyed_int(interp, interp->iglobals, IGLOBALS_LIB_CACHE,
+            PMCNULL);
+}
+
+/*
+
 =item C<STRING* Parrot_locate_runtime_file_str(PARROT_INTERP, STRING *file,
 enum_runtime_ft type)>
 
@@ -717,6 +1014,13 @@ Locate the full path for C<file_name> and the given file type(s).
 The C<enum_runtime_ft type> is one or more of the types defined in
 F<include/parrot/library.h>.
 
+Files found in the search paths are cached; a cached name is only returned
+while it exists and none of the directories searched before it has been
+modified, so a better candidate created later is still picked up. Checking
+that costs one stat per directory searched before the file and one for the
+file itself. Files found relative to the current directory as a last resort
+are never cached.
+
 =cut
 
 */
@@ -729,60 +1033,96 @@ Parrot_locate_runtime_file_str(PARROT_INTERP, ARGIN(STRING *file),
         enum_runtime_ft type)
 {
     ASSERT_ARGS(Parrot_locate_runtime_file_str)
-    STRING *prefix;
-    STRING *full_name;
-    PMC    *paths;
-    INTVAL  i, n;
+    STRING        *prefix;
+    STRING        *full_name;
+    STRING        *found_name = NULL;
+    PMC           *paths;
+    PMC           *located;
+    PMC           *found;
+    INTVAL         i, n;
+    enum_lib_paths which;
 
     /* if this is an absolute path return it as is */
     if (is_abs_path(interp, file))
         return file;
 
     if (type & PARROT_RUNTIME_FT_LANG)
-        paths = get_search_paths(interp, PARROT_LIB_PATH_LANG);
+        which = PARROT_LIB_PATH_LANG;
     else if (type & PARROT_RUNTIME_FT_DYNEXT)
-        paths = get_search_paths(interp, PARROT_LIB_PATH_DYNEXT);
+        which = PARROT_LIB_PATH_DYNEXT;
     else if (type & (PARROT_RUNTIME_FT_PBC | PARROT_RUNTIME_FT_SOURCE))
-        paths = get_search_paths(interp, PARROT_LIB_PATH_LIBRARY);
+        which = PARROT_LIB_PATH_LIBRARY;
     else
-        paths = get_search_paths(interp, PARROT_LIB_PATH_INCLUDE);
+        which = PARROT_LIB_PATH_INCLUDE;
+
+    paths   = get_search_paths(interp, which);
+    prefix  = Parrot_get_runtime_path(interp);
+    located = get_located_files(interp, which, paths, prefix);
+    found   = VTABLE_get_pmc_keyed_str(interp, located, file);
+
+    /* a name asked for as another type gets its own lookup */
+    if (!PMC_IS_NULL(found)
+    &&  VTABLE_get_integer_keyed_int(interp, found, LIB_FOUND_TYPE) == type) {
+        found_name = check_located_file(interp, found);
+
+        if (found_name)
+            return found_name;
+    }
+
+    found = Parrot_pmc_new_init_int(interp, enum_class_FixedPMCArray,
+                LIB_FOUND_SIZE);
+    VTABLE_set_pmc_keyed_int(interp, found, LIB_FOUND_NAMES,
+            Parrot_pmc_new_init_int(interp, enum_class_ResizableStringArray, 1));
+    VTABLE_set_pmc_keyed_int(interp, found, LIB_FOUND_MTIMES,
+            Parrot_pmc_new(interp, enum_class_ResizableIntegerArray));
+    VTABLE_set_integer_keyed_int(interp, found, LIB_FOUND_TYPE, type);
 
-    prefix = Parrot_get_runtime_path(interp);
     n = VTABLE_elements(interp, paths);
 
     for (i = 0; i < n; ++i) {
         STRING * const path = VTABLE_get_string_keyed_int(interp, paths, i);
-        STRING *found_name;
-
-        full_name = path_concat(interp, path, file);
 
-        found_name =
-            (type & PARROT_RUNTIME_FT_DYNEXT)
-                ? try_load_path(interp, full_name)
-                : try_bytecode_extensions(interp, full_name);
+        full_name  = path_concat(interp, path, file);
+        found_name = try_located_candidate(interp, full_name, type, found);
 
         if (found_name)
-            return found_name;
+            break;
 
         if (STRING_length(prefix) && !is_abs_path(interp, path)) {
-            full_name = path_concat(interp, prefix, full_name);
-
-            found_name =
-                (type & PARROT_RUNTIME_FT_DYNEXT)
-                    ? try_load_path(interp, full_name)
-                    : try_bytecode_extensions(interp, full_name);
+            full_name  = path_concat(interp, prefix, full_name);
+            found_name = try_located_candidate(interp, full_name, type, found);
 
             if (found_name)
-                return found_name;
+                break;
         }
     }
 
-    full_name =
-        (type & PARROT_RUNTIME_FT_DYNEXT)
+    if (found_name) {
+        /* a directory changed within the current second may change again
+         * without its modify time showing it */
+        PMC * const  mtimes = VTABLE_get_pmc_keyed_int(interp, found,
+                                LIB_FOUND_MTIMES);
+        const INTVAL now    = Parrot_intval_time();
+
+        n = VTABLE_elements(interp, mtimes);
+
+        for (i = 0; i < n; ++i)
+            if (VTABLE_get_integer_keyed_int(interp, mtimes, i) >= now)
+                break;
+
+        if (i == n) {
+            VTABLE_set_string_keyed_int(interp,
+                VTABLE_get_pmc_keyed_int(interp, found, LIB_FOUND_NAMES),
+                0, found_name);
+            VTABLE_set_pmc_keyed_str(interp, located, file, found);
+        }
+
+        return found_name;
+    }
+
+    return (type & PARROT_RUNTIME_FT_DYNEXT)
             ? try_load_path(interp, file)
             : try_bytecode_extensions(interp, file);
-
-    return full_name;
 }
 
 /*
@@ -0,0 +1,52 @@
+/* ex: set ro:
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically by tools/build/parrot_config_c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+#include <stdio.h>
+#include "parrot/api.h"
+
+int Parrot_set_config_hash(Parrot_PMC interp_pmc);
+const unsigned char * Parrot_get_config_hash_bytes(void);
+int Parrot_get_config_hash_length(void);
+
+static const unsigned char parrot_config[] = {
+    0
+}; /* parrot_config */
+
+PARROT_CONST_FUNCTION
+const unsigned char *
+Parrot_get_config_hash_bytes(void)
+{
+    return parrot_config;
+}
+
+PARROT_CONST_FUNCTION
+int
+Parrot_get_config_hash_length(void)
+{
+    return sizeof(parrot_config);
+}
+
+int
+Parrot_set_config_hash(Parrot_PMC interp_pmc)
+{
+    Parrot_PMC config = NULL;
+    if (sizeof(parrot_config) <= 1)
+        return 1;
+    return Parrot_api_pmc_null(interp_pmc, &config) &&
+           Parrot_api_pmc_deserialize_bytes(interp_pmc, parrot_config, sizeof(parrot_config), &config) &&
+           Parrot_api_set_configuration_hash(interp_pmc, config);
+}
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ *   buffer-read-only: t
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
@@ -19,6 +19,7 @@ Handles class and object manipulation.
 
 #include "parrot/parrot.h"
 #include "parrot/oo_private.h"
+#include "parrot/atomic.h"
 #include "pmc/pmc_class.h"
 #include "pmc/pmc_object.h"
 #include "pmc/pmc_namespace.h"
@@ -48,6 +49,31 @@ static INTVAL fail_if_type_exists(PARROT_INTERP, ARGIN(PMC *name))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+static void fill_attrib_cache_entry(PARROT_INTERP,
+    ARGOUT(PackFile_AttribCacheEntry *entry),
+    ARGIN(PMC *obj),
+    ARGIN(STRING *name))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*entry);
+
+PARROT_CAN_RETURN_NULL
+static PackFile_AttribCacheEntry * get_attrib_cache_entry(PARROT_INTERP,
+    ARGIN(const PMC *obj),
+    ARGIN(STRING * const *name))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+PARROT_CAN_RETURN_NULL
+static Parrot_Object_slot * get_cached_slot(
+    ARGIN_NULLOK(const PackFile_AttribCacheEntry *entry),
+    ARGIN(PMC *obj),
+    INTVAL kind)
+        __attribute__nonnull__(2);
+
 PARROT_INLINE
 PARROT_CANNOT_RETURN_NULL
 PARROT_WARN_UNUSED_RESULT
@@ -70,6 +96,17 @@ static void invalidate_type_caches(PARROT_INTERP, UINTVAL type)
 #define ASSERT_ARGS_fail_if_type_exists __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(name))
+#define ASSERT_ARGS_fill_attrib_cache_entry __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(entry) \
+    , PARROT_ASSERT_ARG(obj) \
+    , PARROT_ASSERT_ARG(name))
+#define ASSERT_ARGS_get_attrib_cache_entry __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(obj) \
+    , PARROT_ASSERT_ARG(name))
+#define ASSERT_ARGS_get_cached_slot __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(obj))
 #define ASSERT_ARGS_get_pmc_proxy __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_invalidate_all_caches __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -319,15 +356,18 @@ Parrot_oo_clone_object(PARROT_INTERP, ARGIN(PMC *pmc), ARGMOD_NULLOK(PMC *dest))
     /* Now clone attributes list.class. */
     cloned_guts               = (Parrot_Object_attributes *) PMC_data(cloned);
     cloned_guts->_class       = obj->_class;
-    cloned_guts->attrib_store = VTABLE_clone(interp, obj->attrib_store);
-    num_attrs                 = VTABLE_elements(interp, cloned_guts->attrib_store);
+    num_attrs                 = obj->num_attribs;
+    Parrot_oo_alloc_attrib_store(interp, cloned, num_attrs, obj->attrib_kinds);
     for (i = 0; i < num_attrs; ++i) {
-        PMC * const to_clone = VTABLE_get_pmc_keyed_int(interp, cloned_guts->attrib_store, i);
-        if (!PMC_IS_NULL(to_clone)) {
-            VTABLE_set_pmc_keyed_int(interp, cloned_guts->attrib_store, i,
-                    VTABLE_clone(interp, to_clone));
+        if (ATTRIB_KIND(obj->attrib_kinds, i) == ATTRIB_KIND_PMC) {
+            PMC * const to_clone = obj->attrib_store[i].pmc;
+            if (!PMC_IS_NULL(to_clone))
+                cloned_guts->attrib_store[i].pmc = VTABLE_clone(interp, to_clone);
         }
+        else
+            cloned_guts->attrib_store[i] = obj->attrib_store[i];
     }
+    PARROT_GC_WRITE_BARRIER(interp, cloned);
 
     /* Some of the attributes may have been the PMCs providing storage for any
      * PMCs we inherited from; also need to clone those. */
@@ -352,6 +392,513 @@ Parrot_oo_clone_object(PARROT_INTERP, ARGIN(PMC *pmc), ARGMOD_NULLOK(PMC *dest))
 
 /*
 
+=item C<void Parrot_oo_alloc_attrib_store(PARROT_INTERP, PMC *obj, INTVAL
+num_attribs, STRING *kinds)>
+
+Gives the Object C<obj> C<num_attribs> attribute slots laid out as C<kinds>
+(see C<attrib_kinds> in F<src/pmc/class.pmc>; NULL means all PMCs). PMC
+slots start as PMCNULL, string slots as STRINGNULL and numeric slots as
+zero. Any slots it had before are freed. The Object's C<destroy> frees the
+slots, so its custom destroy flag must be set.
+
+=cut
+
+*/
+
+void
+Parrot_oo_alloc_attrib_store(PARROT_INTERP, ARGMOD(PMC *obj), INTVAL num_attribs,
+        ARGIN_NULLOK(STRING *kinds))
+{
+    ASSERT_ARGS(Parrot_oo_alloc_attrib_store)
+    Parrot_Object_attributes * const guts = PARROT_OBJECT(obj);
+    INTVAL i;
+
+    if (guts->attrib_store)
+        Parrot_gc_free_fixed_size_storage(interp,
+            guts->num_attribs * sizeof (Parrot_Object_slot), guts->attrib_store);
+
+    guts->attrib_store = num_attribs > 0
+                       ? (Parrot_Object_slot *)Parrot_gc_allocate_fixed_size_storage(
+                            interp, num_attribs * sizeof (Parrot_Object_slot))
+                       : NULL;
+    guts->num_attribs  = num_attribs > 0 ? num_attribs : 0;
+    guts->attrib_kinds = kinds;
+
+    for (i = 0; i < guts->num_attribs; ++i) {
+        switch (ATTRIB_KIND(kinds, i)) {
+          case ATTRIB_KIND_INT:
+            guts->attrib_store[i].ival = 0;
+            break;
+          case ATTRIB_KIND_NUM:
+            guts->attrib_store[i].nval = 0.0;
+            break;
+          case ATTRIB_KIND_STRING:
+            guts->attrib_store[i].str = STRINGNULL;
+            break;
+          default:
+            guts->attrib_store[i].pmc = PMCNULL;
+            break;
+        }
+    }
+}
+
+/*
+
+=item C<PMC * Parrot_oo_get_attrib_slot(PARROT_INTERP, PMC *obj, INTVAL index)>
+
+=item C<void Parrot_oo_set_attrib_slot(PARROT_INTERP, PMC *obj, INTVAL index,
+PMC *value)>
+
+Get or set attribute slot C<index> of Object C<obj> as a PMC. Native slots
+are boxed on the way out and unboxed on the way in; a null PMC stores zero
+or STRINGNULL, and a STRINGNULL slot reads back as PMCNULL. C<index> must be
+a valid slot.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+PMC *
+Parrot_oo_get_attrib_slot(PARROT_INTERP, ARGIN(PMC *obj), INTVAL index)
+{
+    ASSERT_ARGS(Parrot_oo_get_attrib_slot)
+    Parrot_Object_attributes * const guts = PARROT_OBJECT(obj);
+    Parrot_Object_slot       * const slot = &guts->attrib_store[index];
+
+    switch (ATTRIB_KIND(guts->attrib_kinds, index)) {
+      case ATTRIB_KIND_INT:
+        return Parrot_pmc_box_integer(interp, slot->ival);
+      case ATTRIB_KIND_NUM:
+        return Parrot_pmc_box_number(interp, slot->nval);
+      case ATTRIB_KIND_STRING:
+        return STRING_IS_NULL(slot->str)
+             ? PMCNULL
+             : Parrot_pmc_box_string(interp, slot->str);
+      default:
+        return slot->pmc;
+    }
+}
+
+void
+Parrot_oo_set_attrib_slot(PARROT_INTERP, ARGMOD(PMC *obj), INTVAL index,
+        ARGIN_NULLOK(PMC *value))
+{
+    ASSERT_ARGS(Parrot_oo_set_attrib_slot)
+    Parrot_Object_attributes * const guts = PARROT_OBJECT(obj);
+    Parrot_Object_slot       * const slot = &guts->attrib_store[index];
+
+    switch (ATTRIB_KIND(guts->attrib_kinds, index)) {
+      case ATTRIB_KIND_INT:
+        slot->ival = PMC_IS_NULL(value) ? 0 : VTABLE_get_integer(interp, value);
+        break;
+      case ATTRIB_KIND_NUM:
+        slot->nval = PMC_IS_NULL(value) ? 0.0 : VTABLE_get_number(interp, value);
+        break;
+      case ATTRIB_KIND_STRING:
+        slot->str = PMC_IS_NULL(value) ? STRINGNULL : VTABLE_get_string(interp, value);
+        break;
+      default:
+        slot->pmc = value;
+        break;
+    }
+}
+
+/* Last shape handed out. Thread interpreters share constant tables, and with
+ * them the attribute caches, so shapes are numbered for the whole process. */
+static Parrot_atomic_integer last_shape;
+static int                   last_shape_inited;
+
+/*
+
+=item C<void Parrot_oo_init_shapes(void)>
+
+Sets up the process-wide shape counter. Called once, from the first
+interpreter to initialize its world.
+
+=cut
+
+*/
+
+void
+Parrot_oo_init_shapes(void)
+{
+    ASSERT_ARGS(Parrot_oo_init_shapes)
+
+    if (!last_shape_inited) {
+        last_shape_inited = 1;
+        PARROT_ATOMIC_INT_INIT(last_shape);
+        PARROT_ATOMIC_INT_SET(last_shape, 0);
+    }
+}
+
+/*
+
+=item C<UINTVAL Parrot_oo_new_shape(void)>
+
+Returns a number identifying a new attribute layout. A Class takes a new
+shape whenever it rebuilds its attribute index, and every Object of the
+class lays out its attribute slots according to that shape. Shapes are
+never reused, even across threads, so a slot cached for a shape stays valid
+for as long as an object's class still has that shape. Returns 0, meaning
+"do not cache", once the numbers run out.
+
+=cut
+
+*/
+
+UINTVAL
+Parrot_oo_new_shape(void)
+{
+    ASSERT_ARGS(Parrot_oo_new_shape)
+    INTVAL shape;
+
+    PARROT_ATOMIC_INT_INC(shape, last_shape);
+
+    return shape > 0 ? (UINTVAL)shape : 0;
+}
+
+/*
+
+=item C<PMC * Parrot_oo_get_attr_str_cached(PARROT_INTERP, PMC *obj, STRING *
+const *name)>
+
+=item C<void Parrot_oo_set_attr_str_cached(PARROT_INTERP, PMC *obj, STRING *
+const *name, PMC *value)>
+
+Get or set the attribute C<*name> of C<obj>, like C<get_attr_str> and
+C<set_attr_str>. When C<name> points into the string constants of the
+running code, as it does for the C<getattribute> and C<setattribute> ops
+with a constant name, the position of the constant selects an entry in the
+attribute cache of the constant table. Once an entry has seen an Object,
+later Objects with the same class shape go straight to the cached slot,
+without hashing the name or looking for vtable overrides. Any other C<name>
+simply takes the uncached path.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
+PMC *
+Parrot_oo_get_attr_str_cached(PARROT_INTERP, ARGIN(PMC *obj),
+        ARGIN(STRING * const *name))
+{
+    ASSERT_ARGS(Parrot_oo_get_attr_str_cached)
+    PackFile_AttribCacheEntry * const entry = get_attrib_cache_entry(interp, obj, name);
+    Parrot_Object_slot        * const slot  =
+        get_cached_slot(entry, obj, ATTRIB_KIND_PMC);
+    PMC *value;
+
+    if (slot)
+        return slot->pmc;
+
+    value = VTABLE_get_attr_str(interp, obj, *name);
+    if (entry)
+        fill_attrib_cache_entry(interp, entry, obj, *name);
+
+    return value;
+}
+
+PARROT_EXPORT
+void
+Parrot_oo_set_attr_str_cached(PARROT_INTERP, ARGIN(PMC *obj),
+        ARGIN(STRING * const *name), ARGIN_NULLOK(PMC *value))
+{
+    ASSERT_ARGS(Parrot_oo_set_attr_str_cached)
+    PackFile_AttribCacheEntry * const entry = get_attrib_cache_entry(interp, obj, name);
+    Parrot_Object_slot        * const slot  =
+        get_cached_slot(entry, obj, ATTRIB_KIND_PMC);
+
+    if (slot) {
+        PARROT_GC_WRITE_BARRIER(interp, obj);
+        slot->pmc = value;
+        return;
+    }
+
+    VTABLE_set_attr_str(interp, obj, *name, value);
+    if (entry)
+        fill_attrib_cache_entry(interp, entry, obj, *name);
+}
+
+/*
+
+=item C<INTVAL Parrot_oo_get_attr_int_cached(PARROT_INTERP, PMC *obj, STRING *
+const *name)>
+
+=item C<FLOATVAL Parrot_oo_get_attr_num_cached(PARROT_INTERP, PMC *obj, STRING *
+const *name)>
+
+=item C<STRING * Parrot_oo_get_attr_string_cached(PARROT_INTERP, PMC *obj,
+STRING * const *name)>
+
+=item C<void Parrot_oo_set_attr_int_cached(PARROT_INTERP, PMC *obj, STRING *
+const *name, INTVAL value)>
+
+=item C<void Parrot_oo_set_attr_num_cached(PARROT_INTERP, PMC *obj, STRING *
+const *name, FLOATVAL value)>
+
+=item C<void Parrot_oo_set_attr_string_cached(PARROT_INTERP, PMC *obj, STRING *
+const *name, STRING *value)>
+
+Native versions of C<Parrot_oo_get_attr_str_cached> and
+C<Parrot_oo_set_attr_str_cached>. A cached attribute of the matching native
+kind is read or written without boxing. Anything else goes through
+C<get_attr_str> or C<set_attr_str>, boxing or unboxing the value; a null PMC
+reads as zero or STRINGNULL.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+INTVAL
+Parrot_oo_get_attr_int_cached(PARROT_INTERP, ARGIN(PMC *obj),
+        ARGIN(STRING * const *name))
+{
+    ASSERT_ARGS(Parrot_oo_get_attr_int_cached)
+    PackFile_AttribCacheEntry * const entry = get_attrib_cache_entry(interp, obj, name);
+    Parrot_Object_slot        * const slot  =
+        get_cached_slot(entry, obj, ATTRIB_KIND_INT);
+    PMC *value;
+
+    if (slot)
+        return slot->ival;
+
+    value = VTABLE_get_attr_str(interp, obj, *name);
+    if (entry)
+        fill_attrib_cache_entry(interp, entry, obj, *name);
+
+    return PMC_IS_NULL(value) ? 0 : VTABLE_get_integer(interp, value);
+}
+
+PARROT_EXPORT
+FLOATVAL
+Parrot_oo_get_attr_num_cached(PARROT_INTERP, ARGIN(PMC *obj),
+        ARGIN(STRING * const *name))
+{
+    ASSERT_ARGS(Parrot_oo_get_attr_num_cached)
+    PackFile_AttribCacheEntry * const entry = get_attrib_cache_entry(interp, obj, name);
+    Parrot_Object_slot        * const slot  =
+        get_cached_slot(entry, obj, ATTRIB_KIND_NUM);
+    PMC *value;
+
+    if (slot)
+        return slot->nval;
+
+    value = VTABLE_get_attr_str(interp, obj, *name);
+    if (entry)
+        fill_attrib_cache_entry(interp, entry, obj, *name);
+
+    return PMC_IS_NULL(value) ? 0.0 : VTABLE_get_number(interp, value);
+}
+
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
+STRING *
+Parrot_oo_get_attr_string_cached(PARROT_INTERP, ARGIN(PMC *obj),
+        ARGIN(STRING * const *name))
+{
+    ASSERT_ARGS(Parrot_oo_get_attr_string_cached)
+    PackFile_AttribCacheEntry * const entry = get_attrib_cache_entry(interp, obj, name);
+    Parrot_Object_slot        * const slot  =
+        get_cached_slot(entry, obj, ATTRIB_KIND_STRING);
+    PMC *value;
+
+    if (slot)
+        return slot->str;
+
+    value = VTABLE_get_attr_str(interp, obj, *name);
+    if (entry)
+        fill_attrib_cache_entry(interp, entry, obj, *name);
+
+    return PMC_IS_NULL(value) ? STRINGNULL : VTABLE_get_string(interp, value);
+}
+
+PARROT_EXPORT
+void
+Parrot_oo_set_attr_int_cached(PARROT_INTERP, ARGIN(PMC *obj),
+        ARGIN(STRING * const *name), INTVAL value)
+{
+    ASSERT_ARGS(Parrot_oo_set_attr_int_cached)
+    PackFile_AttribCacheEntry * const entry = get_attrib_cache_entry(interp, obj, name);
+    Parrot_Object_slot        * const slot  =
+        get_cached_slot(entry, obj, ATTRIB_KIND_INT);
+
+    if (slot) {
+        slot->ival = value;
+        return;
+    }
+
+    VTABLE_set_attr_str(interp, obj, *name, Parrot_pmc_box_integer(interp, value));
+    if (entry)
+        fill_attrib_cache_entry(interp, entry, obj, *name);
+}
+
+PARROT_EXPORT
+void
+Parrot_oo_set_attr_num_cached(PARROT_INTERP, ARGIN(PMC *obj),
+        ARGIN(STRING * const *name), FLOATVAL value)
+{
+    ASSERT_ARGS(Parrot_oo_set_attr_num_cached)
+    PackFile_AttribCacheEntry * const entry = get_attrib_cache_entry(interp, obj, name);
+    Parrot_Object_slot        * const slot  =
+        get_cached_slot(entry, obj, ATTRIB_KIND_NUM);
+
+    if (slot) {
+        slot->nval = value;
+        return;
+    }
+
+    VTABLE_set_attr_str(interp, obj, *name, Parrot_pmc_box_number(interp, value));
+    if (entry)
+        fill_attrib_cache_entry(interp, entry, obj, *name);
+}
+
+PARROT_EXPORT
+void
+Parrot_oo_set_attr_string_cached(PARROT_INTERP, ARGIN(PMC *obj),
+        ARGIN(STRING * const *name), ARGIN_NULLOK(STRING *value))
+{
+    ASSERT_ARGS(Parrot_oo_set_attr_string_cached)
+    PackFile_AttribCacheEntry * const entry = get_attrib_cache_entry(interp, obj, name);
+    Parrot_Object_slot        * const slot  =
+        get_cached_slot(entry, obj, ATTRIB_KIND_STRING);
+
+    if (slot) {
+        PARROT_GC_WRITE_BARRIER(interp, obj);
+        slot->str = value;
+        return;
+    }
+
+    VTABLE_set_attr_str(interp, obj, *name, STRING_IS_NULL(value)
+            ? PMCNULL
+            : Parrot_pmc_box_string(interp, value));
+    if (entry)
+        fill_attrib_cache_entry(interp, entry, obj, *name);
+}
+
+/*
+
+=item C<static Parrot_Object_slot * get_cached_slot(const
+PackFile_AttribCacheEntry *entry, PMC *obj, INTVAL kind)>
+
+Returns the slot of C<obj> recorded in C<entry>, or NULL if there is no
+entry, it was recorded for another class shape, or the slot is not of the
+given C<kind>.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+static Parrot_Object_slot *
+get_cached_slot(ARGIN_NULLOK(const PackFile_AttribCacheEntry *entry),
+        ARGIN(PMC *obj), INTVAL kind)
+{
+    ASSERT_ARGS(get_cached_slot)
+    Parrot_Object_attributes *guts;
+
+    if (!entry || !entry->shape || entry->kind != kind)
+        return NULL;
+
+    guts = PARROT_OBJECT(obj);
+
+    if (entry->shape != PARROT_CLASS(guts->_class)->shape
+    ||  entry->slot  >= guts->num_attribs)
+        return NULL;
+
+    return &guts->attrib_store[entry->slot];
+}
+
+/*
+
+=item C<static PackFile_AttribCacheEntry * get_attrib_cache_entry(PARROT_INTERP,
+const PMC *obj, STRING * const *name)>
+
+Returns the attribute cache entry for the string constant C<name> points to,
+or NULL if C<obj> is not a plain Object (read-only Objects have their own
+vtable), C<name> is not one of the string
+constants of the current code segment, or C<interp> is a thread: threads share
+constant tables with the interpreter that created them.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+static PackFile_AttribCacheEntry *
+get_attrib_cache_entry(PARROT_INTERP, ARGIN(const PMC *obj), ARGIN(STRING * const *name))
+{
+    ASSERT_ARGS(get_attrib_cache_entry)
+    PackFile_ConstTable *ct;
+    opcode_t             idx;
+
+    if (obj->vtable != interp->vtables[enum_class_Object]
+    ||  PARROT_OBJECT(obj)->_class->vtable->base_type != enum_class_Class
+    ||  Interp_flags_TEST(interp, PARROT_IS_THREAD)
+    ||  !interp->code
+    ||  !(ct = interp->code->const_table)
+    ||  name <  ct->str.constants
+    ||  name >= ct->str.constants + ct->str.const_count)
+        return NULL;
+
+    idx = name - ct->str.constants;
+
+    if (idx >= ct->attrib_cache_size) {
+        ct->attrib_cache = mem_gc_realloc_n_typed_zeroed(interp, ct->attrib_cache,
+                ct->str.const_count, ct->attrib_cache_size, PackFile_AttribCacheEntry);
+        ct->attrib_cache_size = ct->str.const_count;
+    }
+
+    return &ct->attrib_cache[idx];
+}
+
+/*
+
+=item C<static void fill_attrib_cache_entry(PARROT_INTERP,
+PackFile_AttribCacheEntry *entry, PMC *obj, STRING *name)>
+
+Records the slot of attribute C<name> in C<entry> after a successful lookup
+on C<obj>. Nothing is recorded if the class overrides C<get_attr_str> or
+C<set_attr_str>, since those must see every access.
+
+=cut
+
+*/
+
+static void
+fill_attrib_cache_entry(PARROT_INTERP, ARGOUT(PackFile_AttribCacheEntry *entry),
+        ARGIN(PMC *obj), ARGIN(STRING *name))
+{
+    ASSERT_ARGS(fill_attrib_cache_entry)
+    Parrot_Object_attributes * const guts     = PARROT_OBJECT(obj);
+    Parrot_Class_attributes  * const _class   = PARROT_CLASS(guts->_class);
+    STRING                   * const get_attr = CONST_STRING(interp, "get_attr_str");
+    STRING                   * const set_attr = CONST_STRING(interp, "set_attr_str");
+    INTVAL slot;
+
+    if (!_class->shape
+    ||  !PMC_IS_NULL(Parrot_oo_find_vtable_override(interp, guts->_class, get_attr))
+    ||  !PMC_IS_NULL(Parrot_oo_find_vtable_override(interp, guts->_class, set_attr)))
+        return;
+
+    /* A successful lookup leaves the index in the class attribute cache. */
+    if (!VTABLE_exists_keyed_str(interp, _class->attrib_cache, name))
+        return;
+
+    slot = VTABLE_get_integer_keyed_str(interp, _class->attrib_cache, name);
+
+    if (slot >= 0 && slot < guts->num_attribs) {
+        entry->shape = _class->shape;
+        entry->slot  = slot;
+        entry->kind  = ATTRIB_KIND(guts->attrib_kinds, slot);
+    }
+}
+
+/*
+
 =item C<static PMC * get_pmc_proxy(PARROT_INTERP, INTVAL type)>
 
 Get the PMC proxy for a PMC with the given type, creating it if does not exist.
@@ -985,10 +1532,9 @@ Parrot_find_method_direct(PARROT_INTERP, ARGIN(PMC *_class), ARGIN(STRING *metho
 Find a method PMC for a named method, given the class PMC, current
 interp, and name of the method.
 
-This routine should use the current scope's method cache, if there is
-one. If not, it creates a new method cache. Or, rather, it will when
-we've got that bit working. For now it unconditionally goes and looks up
-the name in the global stash.
+Lookups are cached per type for constant method names. Other names are
+looked up in the intern table first, so they use the cache whenever a
+constant with the same name exists, e.g. in loaded bytecode.
 
 =cut
 
@@ -1010,8 +1556,17 @@ Parrot_find_method_with_cache(PARROT_INTERP, ARGIN(PMC *_class), ARGIN(STRING *m
     Meth_cache_entry *e;
     UINTVAL type, bits;
 
-    if (! PObj_constant_TEST(method_name))
-        return Parrot_find_method_direct(interp, _class, method_name);
+    /* The cache is keyed by address, so it needs a string which never
+     * dies; names built at runtime usually have a constant twin interned
+     * from bytecode. */
+    if (! PObj_constant_TEST(method_name)) {
+        STRING * const interned = Parrot_str_find_interned(interp, method_name);
+
+        if (!interned || ! PObj_constant_TEST(interned))
+            return Parrot_find_method_direct(interp, _class, method_name);
+
+        method_name = interned;
+    }
 
     mc   = interp->caches;
     type = _class->vtable->base_type;
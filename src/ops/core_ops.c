@@ -79,13 +79,13 @@ extern op_lib_t core_op_lib;
 
 
 
-INTVAL core_numops = 1130;
+INTVAL core_numops = 1152;
 
 /*
 ** Op Function Table:
 */
 
-static op_func_t core_op_func_table[1130] = {
+static op_func_t core_op_func_table[1152] = {
   Parrot_end,                                        /*      0 */
   Parrot_noop,                                       /*      1 */
   Parrot_check_events,                               /*      2 */
@@ -672,549 +672,571 @@ static op_func_t core_op_func_table[1130] = {
   Parrot_removeattribute_p_sc,                       /*    583 */
   Parrot_getattribute_p_p_s,                         /*    584 */
   Parrot_getattribute_p_p_sc,                        /*    585 */
-  Parrot_getattribute_p_p_p_s,                       /*    586 */
-  Parrot_getattribute_p_p_pc_s,                      /*    587 */
-  Parrot_getattribute_p_p_p_sc,                      /*    588 */
-  Parrot_getattribute_p_p_pc_sc,                     /*    589 */
-  Parrot_setattribute_p_s_p,                         /*    590 */
-  Parrot_setattribute_p_sc_p,                        /*    591 */
-  Parrot_setattribute_p_p_s_p,                       /*    592 */
-  Parrot_setattribute_p_pc_s_p,                      /*    593 */
-  Parrot_setattribute_p_p_sc_p,                      /*    594 */
-  Parrot_setattribute_p_pc_sc_p,                     /*    595 */
-  Parrot_inspect_p_p,                                /*    596 */
-  Parrot_inspect_p_pc,                               /*    597 */
-  Parrot_inspect_p_p_s,                              /*    598 */
-  Parrot_inspect_p_pc_s,                             /*    599 */
-  Parrot_inspect_p_p_sc,                             /*    600 */
-  Parrot_inspect_p_pc_sc,                            /*    601 */
-  Parrot_new_p_s,                                    /*    602 */
-  Parrot_new_p_sc,                                   /*    603 */
-  Parrot_new_p_s_p,                                  /*    604 */
-  Parrot_new_p_sc_p,                                 /*    605 */
-  Parrot_new_p_s_pc,                                 /*    606 */
-  Parrot_new_p_sc_pc,                                /*    607 */
-  Parrot_new_p_p,                                    /*    608 */
-  Parrot_new_p_pc,                                   /*    609 */
-  Parrot_new_p_p_p,                                  /*    610 */
-  Parrot_new_p_pc_p,                                 /*    611 */
-  Parrot_new_p_p_pc,                                 /*    612 */
-  Parrot_new_p_pc_pc,                                /*    613 */
-  Parrot_root_new_p_p,                               /*    614 */
-  Parrot_root_new_p_pc,                              /*    615 */
-  Parrot_root_new_p_p_p,                             /*    616 */
-  Parrot_root_new_p_pc_p,                            /*    617 */
-  Parrot_root_new_p_p_pc,                            /*    618 */
-  Parrot_root_new_p_pc_pc,                           /*    619 */
-  Parrot_typeof_s_p,                                 /*    620 */
-  Parrot_typeof_p_p,                                 /*    621 */
-  Parrot_get_repr_s_p,                               /*    622 */
-  Parrot_find_method_p_p_s,                          /*    623 */
-  Parrot_find_method_p_p_sc,                         /*    624 */
-  Parrot_defined_i_p,                                /*    625 */
-  Parrot_defined_i_p_ki,                             /*    626 */
-  Parrot_defined_i_p_kic,                            /*    627 */
-  Parrot_defined_i_p_k,                              /*    628 */
-  Parrot_defined_i_p_kc,                             /*    629 */
-  Parrot_exists_i_p_ki,                              /*    630 */
-  Parrot_exists_i_p_kic,                             /*    631 */
-  Parrot_exists_i_p_k,                               /*    632 */
-  Parrot_exists_i_p_kc,                              /*    633 */
-  Parrot_delete_p_k,                                 /*    634 */
-  Parrot_delete_p_kc,                                /*    635 */
-  Parrot_delete_p_ki,                                /*    636 */
-  Parrot_delete_p_kic,                               /*    637 */
-  Parrot_elements_i_p,                               /*    638 */
-  Parrot_push_p_i,                                   /*    639 */
-  Parrot_push_p_ic,                                  /*    640 */
-  Parrot_push_p_n,                                   /*    641 */
-  Parrot_push_p_nc,                                  /*    642 */
-  Parrot_push_p_s,                                   /*    643 */
-  Parrot_push_p_sc,                                  /*    644 */
-  Parrot_push_p_p,                                   /*    645 */
-  Parrot_pop_i_p,                                    /*    646 */
-  Parrot_pop_n_p,                                    /*    647 */
-  Parrot_pop_s_p,                                    /*    648 */
-  Parrot_pop_p_p,                                    /*    649 */
-  Parrot_unshift_p_i,                                /*    650 */
-  Parrot_unshift_p_ic,                               /*    651 */
-  Parrot_unshift_p_n,                                /*    652 */
-  Parrot_unshift_p_nc,                               /*    653 */
-  Parrot_unshift_p_s,                                /*    654 */
-  Parrot_unshift_p_sc,                               /*    655 */
-  Parrot_unshift_p_p,                                /*    656 */
-  Parrot_shift_i_p,                                  /*    657 */
-  Parrot_shift_n_p,                                  /*    658 */
-  Parrot_shift_s_p,                                  /*    659 */
-  Parrot_shift_p_p,                                  /*    660 */
-  Parrot_splice_p_p_i_i,                             /*    661 */
-  Parrot_splice_p_p_ic_i,                            /*    662 */
-  Parrot_splice_p_p_i_ic,                            /*    663 */
-  Parrot_splice_p_p_ic_ic,                           /*    664 */
-  Parrot_setprop_p_s_p,                              /*    665 */
-  Parrot_setprop_p_sc_p,                             /*    666 */
-  Parrot_getprop_p_s_p,                              /*    667 */
-  Parrot_getprop_p_sc_p,                             /*    668 */
-  Parrot_getprop_p_p_s,                              /*    669 */
-  Parrot_getprop_p_p_sc,                             /*    670 */
-  Parrot_delprop_p_s,                                /*    671 */
-  Parrot_delprop_p_sc,                               /*    672 */
-  Parrot_prophash_p_p,                               /*    673 */
-  Parrot_freeze_s_p,                                 /*    674 */
-  Parrot_thaw_p_s,                                   /*    675 */
-  Parrot_thaw_p_sc,                                  /*    676 */
-  Parrot_add_multi_s_s_p,                            /*    677 */
-  Parrot_add_multi_sc_s_p,                           /*    678 */
-  Parrot_add_multi_s_sc_p,                           /*    679 */
-  Parrot_add_multi_sc_sc_p,                          /*    680 */
-  Parrot_find_multi_p_s_s,                           /*    681 */
-  Parrot_find_multi_p_sc_s,                          /*    682 */
-  Parrot_find_multi_p_s_sc,                          /*    683 */
-  Parrot_find_multi_p_sc_sc,                         /*    684 */
-  Parrot_register_p,                                 /*    685 */
-  Parrot_unregister_p,                               /*    686 */
-  Parrot_box_p_i,                                    /*    687 */
-  Parrot_box_p_ic,                                   /*    688 */
-  Parrot_box_p_n,                                    /*    689 */
-  Parrot_box_p_nc,                                   /*    690 */
-  Parrot_box_p_s,                                    /*    691 */
-  Parrot_box_p_sc,                                   /*    692 */
-  Parrot_iter_p_p,                                   /*    693 */
-  Parrot_morph_p_p,                                  /*    694 */
-  Parrot_morph_p_pc,                                 /*    695 */
-  Parrot_clone_s_s,                                  /*    696 */
-  Parrot_clone_s_sc,                                 /*    697 */
-  Parrot_set_i_i,                                    /*    698 */
-  Parrot_set_i_ic,                                   /*    699 */
-  Parrot_set_i_n,                                    /*    700 */
-  Parrot_set_i_nc,                                   /*    701 */
-  Parrot_set_i_s,                                    /*    702 */
-  Parrot_set_i_sc,                                   /*    703 */
-  Parrot_set_n_n,                                    /*    704 */
-  Parrot_set_n_nc,                                   /*    705 */
-  Parrot_set_n_i,                                    /*    706 */
-  Parrot_set_n_ic,                                   /*    707 */
-  Parrot_set_n_s,                                    /*    708 */
-  Parrot_set_n_sc,                                   /*    709 */
-  Parrot_set_n_p,                                    /*    710 */
-  Parrot_set_s_p,                                    /*    711 */
-  Parrot_set_s_s,                                    /*    712 */
-  Parrot_set_s_sc,                                   /*    713 */
-  Parrot_set_s_i,                                    /*    714 */
-  Parrot_set_s_ic,                                   /*    715 */
-  Parrot_set_s_n,                                    /*    716 */
-  Parrot_set_s_nc,                                   /*    717 */
-  Parrot_set_p_pc,                                   /*    718 */
-  Parrot_set_p_p,                                    /*    719 */
-  Parrot_set_p_i,                                    /*    720 */
-  Parrot_set_p_ic,                                   /*    721 */
-  Parrot_set_p_n,                                    /*    722 */
-  Parrot_set_p_nc,                                   /*    723 */
-  Parrot_set_p_s,                                    /*    724 */
-  Parrot_set_p_sc,                                   /*    725 */
-  Parrot_set_i_p,                                    /*    726 */
-  Parrot_assign_p_p,                                 /*    727 */
-  Parrot_assign_p_i,                                 /*    728 */
-  Parrot_assign_p_ic,                                /*    729 */
-  Parrot_assign_p_n,                                 /*    730 */
-  Parrot_assign_p_nc,                                /*    731 */
-  Parrot_assign_p_s,                                 /*    732 */
-  Parrot_assign_p_sc,                                /*    733 */
-  Parrot_assign_s_s,                                 /*    734 */
-  Parrot_assign_s_sc,                                /*    735 */
-  Parrot_setref_p_p,                                 /*    736 */
-  Parrot_deref_p_p,                                  /*    737 */
-  Parrot_set_p_ki_i,                                 /*    738 */
-  Parrot_set_p_kic_i,                                /*    739 */
-  Parrot_set_p_ki_ic,                                /*    740 */
-  Parrot_set_p_kic_ic,                               /*    741 */
-  Parrot_set_p_ki_n,                                 /*    742 */
-  Parrot_set_p_kic_n,                                /*    743 */
-  Parrot_set_p_ki_nc,                                /*    744 */
-  Parrot_set_p_kic_nc,                               /*    745 */
-  Parrot_set_p_ki_s,                                 /*    746 */
-  Parrot_set_p_kic_s,                                /*    747 */
-  Parrot_set_p_ki_sc,                                /*    748 */
-  Parrot_set_p_kic_sc,                               /*    749 */
-  Parrot_set_p_ki_p,                                 /*    750 */
-  Parrot_set_p_kic_p,                                /*    751 */
-  Parrot_set_i_p_ki,                                 /*    752 */
-  Parrot_set_i_p_kic,                                /*    753 */
-  Parrot_set_n_p_ki,                                 /*    754 */
-  Parrot_set_n_p_kic,                                /*    755 */
-  Parrot_set_s_p_ki,                                 /*    756 */
-  Parrot_set_s_p_kic,                                /*    757 */
-  Parrot_set_p_p_ki,                                 /*    758 */
-  Parrot_set_p_p_kic,                                /*    759 */
-  Parrot_set_p_k_i,                                  /*    760 */
-  Parrot_set_p_kc_i,                                 /*    761 */
-  Parrot_set_p_k_ic,                                 /*    762 */
-  Parrot_set_p_kc_ic,                                /*    763 */
-  Parrot_set_p_k_n,                                  /*    764 */
-  Parrot_set_p_kc_n,                                 /*    765 */
-  Parrot_set_p_k_nc,                                 /*    766 */
-  Parrot_set_p_kc_nc,                                /*    767 */
-  Parrot_set_p_k_s,                                  /*    768 */
-  Parrot_set_p_kc_s,                                 /*    769 */
-  Parrot_set_p_k_sc,                                 /*    770 */
-  Parrot_set_p_kc_sc,                                /*    771 */
-  Parrot_set_p_k_p,                                  /*    772 */
-  Parrot_set_p_kc_p,                                 /*    773 */
-  Parrot_set_i_p_k,                                  /*    774 */
-  Parrot_set_i_p_kc,                                 /*    775 */
-  Parrot_set_n_p_k,                                  /*    776 */
-  Parrot_set_n_p_kc,                                 /*    777 */
-  Parrot_set_s_p_k,                                  /*    778 */
-  Parrot_set_s_p_kc,                                 /*    779 */
-  Parrot_set_p_p_k,                                  /*    780 */
-  Parrot_set_p_p_kc,                                 /*    781 */
-  Parrot_clone_p_p,                                  /*    782 */
-  Parrot_clone_p_p_p,                                /*    783 */
-  Parrot_clone_p_p_pc,                               /*    784 */
-  Parrot_copy_p_p,                                   /*    785 */
-  Parrot_null_s,                                     /*    786 */
-  Parrot_null_i,                                     /*    787 */
-  Parrot_null_p,                                     /*    788 */
-  Parrot_null_n,                                     /*    789 */
-  Parrot_ord_i_s,                                    /*    790 */
-  Parrot_ord_i_sc,                                   /*    791 */
-  Parrot_ord_i_s_i,                                  /*    792 */
-  Parrot_ord_i_sc_i,                                 /*    793 */
-  Parrot_ord_i_s_ic,                                 /*    794 */
-  Parrot_ord_i_sc_ic,                                /*    795 */
-  Parrot_chr_s_i,                                    /*    796 */
-  Parrot_chr_s_ic,                                   /*    797 */
-  Parrot_chopn_s_s_i,                                /*    798 */
-  Parrot_chopn_s_sc_i,                               /*    799 */
-  Parrot_chopn_s_s_ic,                               /*    800 */
-  Parrot_chopn_s_sc_ic,                              /*    801 */
-  Parrot_concat_p_p,                                 /*    802 */
-  Parrot_concat_p_s,                                 /*    803 */
-  Parrot_concat_p_sc,                                /*    804 */
-  Parrot_concat_s_s_s,                               /*    805 */
-  Parrot_concat_s_sc_s,                              /*    806 */
-  Parrot_concat_s_s_sc,                              /*    807 */
-  Parrot_concat_p_p_s,                               /*    808 */
-  Parrot_concat_p_p_sc,                              /*    809 */
-  Parrot_concat_p_p_p,                               /*    810 */
-  Parrot_repeat_s_s_i,                               /*    811 */
-  Parrot_repeat_s_sc_i,                              /*    812 */
-  Parrot_repeat_s_s_ic,                              /*    813 */
-  Parrot_repeat_s_sc_ic,                             /*    814 */
-  Parrot_repeat_p_p_i,                               /*    815 */
-  Parrot_repeat_p_p_ic,                              /*    816 */
-  Parrot_repeat_p_p_p,                               /*    817 */
-  Parrot_repeat_p_i,                                 /*    818 */
-  Parrot_repeat_p_ic,                                /*    819 */
-  Parrot_repeat_p_p,                                 /*    820 */
-  Parrot_length_i_s,                                 /*    821 */
-  Parrot_length_i_sc,                                /*    822 */
-  Parrot_bytelength_i_s,                             /*    823 */
-  Parrot_bytelength_i_sc,                            /*    824 */
-  Parrot_pin_s,                                      /*    825 */
-  Parrot_unpin_s,                                    /*    826 */
-  Parrot_substr_s_s_i,                               /*    827 */
-  Parrot_substr_s_sc_i,                              /*    828 */
-  Parrot_substr_s_s_ic,                              /*    829 */
-  Parrot_substr_s_sc_ic,                             /*    830 */
-  Parrot_substr_s_s_i_i,                             /*    831 */
-  Parrot_substr_s_sc_i_i,                            /*    832 */
-  Parrot_substr_s_s_ic_i,                            /*    833 */
-  Parrot_substr_s_sc_ic_i,                           /*    834 */
-  Parrot_substr_s_s_i_ic,                            /*    835 */
-  Parrot_substr_s_sc_i_ic,                           /*    836 */
-  Parrot_substr_s_s_ic_ic,                           /*    837 */
-  Parrot_substr_s_sc_ic_ic,                          /*    838 */
-  Parrot_substr_s_p_i_i,                             /*    839 */
-  Parrot_substr_s_p_ic_i,                            /*    840 */
-  Parrot_substr_s_p_i_ic,                            /*    841 */
-  Parrot_substr_s_p_ic_ic,                           /*    842 */
-  Parrot_replace_s_s_i_i_s,                          /*    843 */
-  Parrot_replace_s_sc_i_i_s,                         /*    844 */
-  Parrot_replace_s_s_ic_i_s,                         /*    845 */
-  Parrot_replace_s_sc_ic_i_s,                        /*    846 */
-  Parrot_replace_s_s_i_ic_s,                         /*    847 */
-  Parrot_replace_s_sc_i_ic_s,                        /*    848 */
-  Parrot_replace_s_s_ic_ic_s,                        /*    849 */
-  Parrot_replace_s_sc_ic_ic_s,                       /*    850 */
-  Parrot_replace_s_s_i_i_sc,                         /*    851 */
-  Parrot_replace_s_sc_i_i_sc,                        /*    852 */
-  Parrot_replace_s_s_ic_i_sc,                        /*    853 */
-  Parrot_replace_s_sc_ic_i_sc,                       /*    854 */
-  Parrot_replace_s_s_i_ic_sc,                        /*    855 */
-  Parrot_replace_s_sc_i_ic_sc,                       /*    856 */
-  Parrot_replace_s_s_ic_ic_sc,                       /*    857 */
-  Parrot_replace_s_sc_ic_ic_sc,                      /*    858 */
-  Parrot_index_i_s_s,                                /*    859 */
-  Parrot_index_i_sc_s,                               /*    860 */
-  Parrot_index_i_s_sc,                               /*    861 */
-  Parrot_index_i_sc_sc,                              /*    862 */
-  Parrot_index_i_s_s_i,                              /*    863 */
-  Parrot_index_i_sc_s_i,                             /*    864 */
-  Parrot_index_i_s_sc_i,                             /*    865 */
-  Parrot_index_i_sc_sc_i,                            /*    866 */
-  Parrot_index_i_s_s_ic,                             /*    867 */
-  Parrot_index_i_sc_s_ic,                            /*    868 */
-  Parrot_index_i_s_sc_ic,                            /*    869 */
-  Parrot_index_i_sc_sc_ic,                           /*    870 */
-  Parrot_rindex_i_s_s,                               /*    871 */
-  Parrot_rindex_i_sc_s,                              /*    872 */
-  Parrot_rindex_i_s_sc,                              /*    873 */
-  Parrot_rindex_i_sc_sc,                             /*    874 */
-  Parrot_rindex_i_s_s_i,                             /*    875 */
-  Parrot_rindex_i_sc_s_i,                            /*    876 */
-  Parrot_rindex_i_s_sc_i,                            /*    877 */
-  Parrot_rindex_i_sc_sc_i,                           /*    878 */
-  Parrot_rindex_i_s_s_ic,                            /*    879 */
-  Parrot_rindex_i_sc_s_ic,                           /*    880 */
-  Parrot_rindex_i_s_sc_ic,                           /*    881 */
-  Parrot_rindex_i_sc_sc_ic,                          /*    882 */
-  Parrot_sprintf_s_s_p,                              /*    883 */
-  Parrot_sprintf_s_sc_p,                             /*    884 */
-  Parrot_sprintf_p_p_p,                              /*    885 */
-  Parrot_new_s,                                      /*    886 */
-  Parrot_stringinfo_i_s_i,                           /*    887 */
-  Parrot_stringinfo_i_sc_i,                          /*    888 */
-  Parrot_stringinfo_i_s_ic,                          /*    889 */
-  Parrot_stringinfo_i_sc_ic,                         /*    890 */
-  Parrot_upcase_s_s,                                 /*    891 */
-  Parrot_upcase_s_sc,                                /*    892 */
-  Parrot_downcase_s_s,                               /*    893 */
-  Parrot_downcase_s_sc,                              /*    894 */
-  Parrot_titlecase_s_s,                              /*    895 */
-  Parrot_titlecase_s_sc,                             /*    896 */
-  Parrot_join_s_s_p,                                 /*    897 */
-  Parrot_join_s_sc_p,                                /*    898 */
-  Parrot_split_p_s_s,                                /*    899 */
-  Parrot_split_p_sc_s,                               /*    900 */
-  Parrot_split_p_s_sc,                               /*    901 */
-  Parrot_split_p_sc_sc,                              /*    902 */
-  Parrot_encoding_i_s,                               /*    903 */
-  Parrot_encoding_i_sc,                              /*    904 */
-  Parrot_encodingname_s_i,                           /*    905 */
-  Parrot_encodingname_s_ic,                          /*    906 */
-  Parrot_find_encoding_i_s,                          /*    907 */
-  Parrot_find_encoding_i_sc,                         /*    908 */
-  Parrot_trans_encoding_s_s_i,                       /*    909 */
-  Parrot_trans_encoding_s_sc_i,                      /*    910 */
-  Parrot_trans_encoding_s_s_ic,                      /*    911 */
-  Parrot_trans_encoding_s_sc_ic,                     /*    912 */
-  Parrot_is_cclass_i_i_s_i,                          /*    913 */
-  Parrot_is_cclass_i_ic_s_i,                         /*    914 */
-  Parrot_is_cclass_i_i_sc_i,                         /*    915 */
-  Parrot_is_cclass_i_ic_sc_i,                        /*    916 */
-  Parrot_is_cclass_i_i_s_ic,                         /*    917 */
-  Parrot_is_cclass_i_ic_s_ic,                        /*    918 */
-  Parrot_is_cclass_i_i_sc_ic,                        /*    919 */
-  Parrot_is_cclass_i_ic_sc_ic,                       /*    920 */
-  Parrot_find_cclass_i_i_s_i_i,                      /*    921 */
-  Parrot_find_cclass_i_ic_s_i_i,                     /*    922 */
-  Parrot_find_cclass_i_i_sc_i_i,                     /*    923 */
-  Parrot_find_cclass_i_ic_sc_i_i,                    /*    924 */
-  Parrot_find_cclass_i_i_s_ic_i,                     /*    925 */
-  Parrot_find_cclass_i_ic_s_ic_i,                    /*    926 */
-  Parrot_find_cclass_i_i_sc_ic_i,                    /*    927 */
-  Parrot_find_cclass_i_ic_sc_ic_i,                   /*    928 */
-  Parrot_find_cclass_i_i_s_i_ic,                     /*    929 */
-  Parrot_find_cclass_i_ic_s_i_ic,                    /*    930 */
-  Parrot_find_cclass_i_i_sc_i_ic,                    /*    931 */
-  Parrot_find_cclass_i_ic_sc_i_ic,                   /*    932 */
-  Parrot_find_cclass_i_i_s_ic_ic,                    /*    933 */
-  Parrot_find_cclass_i_ic_s_ic_ic,                   /*    934 */
-  Parrot_find_cclass_i_i_sc_ic_ic,                   /*    935 */
-  Parrot_find_cclass_i_ic_sc_ic_ic,                  /*    936 */
-  Parrot_find_not_cclass_i_i_s_i_i,                  /*    937 */
-  Parrot_find_not_cclass_i_ic_s_i_i,                 /*    938 */
-  Parrot_find_not_cclass_i_i_sc_i_i,                 /*    939 */
-  Parrot_find_not_cclass_i_ic_sc_i_i,                /*    940 */
-  Parrot_find_not_cclass_i_i_s_ic_i,                 /*    941 */
-  Parrot_find_not_cclass_i_ic_s_ic_i,                /*    942 */
-  Parrot_find_not_cclass_i_i_sc_ic_i,                /*    943 */
-  Parrot_find_not_cclass_i_ic_sc_ic_i,               /*    944 */
-  Parrot_find_not_cclass_i_i_s_i_ic,                 /*    945 */
-  Parrot_find_not_cclass_i_ic_s_i_ic,                /*    946 */
-  Parrot_find_not_cclass_i_i_sc_i_ic,                /*    947 */
-  Parrot_find_not_cclass_i_ic_sc_i_ic,               /*    948 */
-  Parrot_find_not_cclass_i_i_s_ic_ic,                /*    949 */
-  Parrot_find_not_cclass_i_ic_s_ic_ic,               /*    950 */
-  Parrot_find_not_cclass_i_i_sc_ic_ic,               /*    951 */
-  Parrot_find_not_cclass_i_ic_sc_ic_ic,              /*    952 */
-  Parrot_escape_s_s,                                 /*    953 */
-  Parrot_compose_s_s,                                /*    954 */
-  Parrot_compose_s_sc,                               /*    955 */
-  Parrot_find_codepoint_i_s,                         /*    956 */
-  Parrot_find_codepoint_i_sc,                        /*    957 */
-  Parrot_spawnw_i_s,                                 /*    958 */
-  Parrot_spawnw_i_sc,                                /*    959 */
-  Parrot_spawnw_i_p,                                 /*    960 */
-  Parrot_err_i,                                      /*    961 */
-  Parrot_err_s,                                      /*    962 */
-  Parrot_err_s_i,                                    /*    963 */
-  Parrot_err_s_ic,                                   /*    964 */
-  Parrot_time_i,                                     /*    965 */
-  Parrot_time_n,                                     /*    966 */
-  Parrot_sleep_i,                                    /*    967 */
-  Parrot_sleep_ic,                                   /*    968 */
-  Parrot_sleep_n,                                    /*    969 */
-  Parrot_sleep_nc,                                   /*    970 */
-  Parrot_store_lex_s_p,                              /*    971 */
-  Parrot_store_lex_sc_p,                             /*    972 */
-  Parrot_store_lex_s_s,                              /*    973 */
-  Parrot_store_lex_sc_s,                             /*    974 */
-  Parrot_store_lex_s_sc,                             /*    975 */
-  Parrot_store_lex_sc_sc,                            /*    976 */
-  Parrot_store_lex_s_i,                              /*    977 */
-  Parrot_store_lex_sc_i,                             /*    978 */
-  Parrot_store_lex_s_ic,                             /*    979 */
-  Parrot_store_lex_sc_ic,                            /*    980 */
-  Parrot_store_lex_s_n,                              /*    981 */
-  Parrot_store_lex_sc_n,                             /*    982 */
-  Parrot_store_lex_s_nc,                             /*    983 */
-  Parrot_store_lex_sc_nc,                            /*    984 */
-  Parrot_store_dynamic_lex_s_p,                      /*    985 */
-  Parrot_store_dynamic_lex_sc_p,                     /*    986 */
-  Parrot_find_lex_p_s,                               /*    987 */
-  Parrot_find_lex_p_sc,                              /*    988 */
-  Parrot_find_lex_s_s,                               /*    989 */
-  Parrot_find_lex_s_sc,                              /*    990 */
-  Parrot_find_lex_i_s,                               /*    991 */
-  Parrot_find_lex_i_sc,                              /*    992 */
-  Parrot_find_lex_n_s,                               /*    993 */
-  Parrot_find_lex_n_sc,                              /*    994 */
-  Parrot_find_dynamic_lex_p_s,                       /*    995 */
-  Parrot_find_dynamic_lex_p_sc,                      /*    996 */
-  Parrot_find_caller_lex_p_s,                        /*    997 */
-  Parrot_find_caller_lex_p_sc,                       /*    998 */
-  Parrot_get_namespace_p,                            /*    999 */
-  Parrot_get_namespace_p_p,                          /*   1000 */
-  Parrot_get_namespace_p_pc,                         /*   1001 */
-  Parrot_get_hll_namespace_p,                        /*   1002 */
-  Parrot_get_hll_namespace_p_p,                      /*   1003 */
-  Parrot_get_hll_namespace_p_pc,                     /*   1004 */
-  Parrot_get_root_namespace_p,                       /*   1005 */
-  Parrot_get_root_namespace_p_p,                     /*   1006 */
-  Parrot_get_root_namespace_p_pc,                    /*   1007 */
-  Parrot_get_global_p_s,                             /*   1008 */
-  Parrot_get_global_p_sc,                            /*   1009 */
-  Parrot_get_global_p_p_s,                           /*   1010 */
-  Parrot_get_global_p_pc_s,                          /*   1011 */
-  Parrot_get_global_p_p_sc,                          /*   1012 */
-  Parrot_get_global_p_pc_sc,                         /*   1013 */
-  Parrot_get_hll_global_p_s,                         /*   1014 */
-  Parrot_get_hll_global_p_sc,                        /*   1015 */
-  Parrot_get_hll_global_p_p_s,                       /*   1016 */
-  Parrot_get_hll_global_p_pc_s,                      /*   1017 */
-  Parrot_get_hll_global_p_p_sc,                      /*   1018 */
-  Parrot_get_hll_global_p_pc_sc,                     /*   1019 */
-  Parrot_get_root_global_p_s,                        /*   1020 */
-  Parrot_get_root_global_p_sc,                       /*   1021 */
-  Parrot_get_root_global_p_p_s,                      /*   1022 */
-  Parrot_get_root_global_p_pc_s,                     /*   1023 */
-  Parrot_get_root_global_p_p_sc,                     /*   1024 */
-  Parrot_get_root_global_p_pc_sc,                    /*   1025 */
-  Parrot_set_global_s_p,                             /*   1026 */
-  Parrot_set_global_sc_p,                            /*   1027 */
-  Parrot_set_global_p_s_p,                           /*   1028 */
-  Parrot_set_global_pc_s_p,                          /*   1029 */
-  Parrot_set_global_p_sc_p,                          /*   1030 */
-  Parrot_set_global_pc_sc_p,                         /*   1031 */
-  Parrot_set_hll_global_s_p,                         /*   1032 */
-  Parrot_set_hll_global_sc_p,                        /*   1033 */
-  Parrot_set_hll_global_p_s_p,                       /*   1034 */
-  Parrot_set_hll_global_pc_s_p,                      /*   1035 */
-  Parrot_set_hll_global_p_sc_p,                      /*   1036 */
-  Parrot_set_hll_global_pc_sc_p,                     /*   1037 */
-  Parrot_set_root_global_s_p,                        /*   1038 */
-  Parrot_set_root_global_sc_p,                       /*   1039 */
-  Parrot_set_root_global_p_s_p,                      /*   1040 */
-  Parrot_set_root_global_pc_s_p,                     /*   1041 */
-  Parrot_set_root_global_p_sc_p,                     /*   1042 */
-  Parrot_set_root_global_pc_sc_p,                    /*   1043 */
-  Parrot_find_name_p_s,                              /*   1044 */
-  Parrot_find_name_p_sc,                             /*   1045 */
-  Parrot_find_sub_not_null_p_s,                      /*   1046 */
-  Parrot_find_sub_not_null_p_sc,                     /*   1047 */
-  Parrot_trap,                                       /*   1048 */
-  Parrot_set_label_p_ic,                             /*   1049 */
-  Parrot_get_label_i_p,                              /*   1050 */
-  Parrot_get_id_i_p,                                 /*   1051 */
-  Parrot_get_id_i_pc,                                /*   1052 */
-  Parrot_fetch_p_p_p_p,                              /*   1053 */
-  Parrot_fetch_p_pc_p_p,                             /*   1054 */
-  Parrot_fetch_p_p_pc_p,                             /*   1055 */
-  Parrot_fetch_p_pc_pc_p,                            /*   1056 */
-  Parrot_fetch_p_p_p_pc,                             /*   1057 */
-  Parrot_fetch_p_pc_p_pc,                            /*   1058 */
-  Parrot_fetch_p_p_pc_pc,                            /*   1059 */
-  Parrot_fetch_p_pc_pc_pc,                           /*   1060 */
-  Parrot_fetch_p_p_i_p,                              /*   1061 */
-  Parrot_fetch_p_pc_i_p,                             /*   1062 */
-  Parrot_fetch_p_p_ic_p,                             /*   1063 */
-  Parrot_fetch_p_pc_ic_p,                            /*   1064 */
-  Parrot_fetch_p_p_i_pc,                             /*   1065 */
-  Parrot_fetch_p_pc_i_pc,                            /*   1066 */
-  Parrot_fetch_p_p_ic_pc,                            /*   1067 */
-  Parrot_fetch_p_pc_ic_pc,                           /*   1068 */
-  Parrot_fetch_p_p_s_p,                              /*   1069 */
-  Parrot_fetch_p_pc_s_p,                             /*   1070 */
-  Parrot_fetch_p_p_sc_p,                             /*   1071 */
-  Parrot_fetch_p_pc_sc_p,                            /*   1072 */
-  Parrot_fetch_p_p_s_pc,                             /*   1073 */
-  Parrot_fetch_p_pc_s_pc,                            /*   1074 */
-  Parrot_fetch_p_p_sc_pc,                            /*   1075 */
-  Parrot_fetch_p_pc_sc_pc,                           /*   1076 */
-  Parrot_vivify_p_p_p_p,                             /*   1077 */
-  Parrot_vivify_p_pc_p_p,                            /*   1078 */
-  Parrot_vivify_p_p_pc_p,                            /*   1079 */
-  Parrot_vivify_p_pc_pc_p,                           /*   1080 */
-  Parrot_vivify_p_p_p_pc,                            /*   1081 */
-  Parrot_vivify_p_pc_p_pc,                           /*   1082 */
-  Parrot_vivify_p_p_pc_pc,                           /*   1083 */
-  Parrot_vivify_p_pc_pc_pc,                          /*   1084 */
-  Parrot_vivify_p_p_i_p,                             /*   1085 */
-  Parrot_vivify_p_pc_i_p,                            /*   1086 */
-  Parrot_vivify_p_p_ic_p,                            /*   1087 */
-  Parrot_vivify_p_pc_ic_p,                           /*   1088 */
-  Parrot_vivify_p_p_i_pc,                            /*   1089 */
-  Parrot_vivify_p_pc_i_pc,                           /*   1090 */
-  Parrot_vivify_p_p_ic_pc,                           /*   1091 */
-  Parrot_vivify_p_pc_ic_pc,                          /*   1092 */
-  Parrot_vivify_p_p_s_p,                             /*   1093 */
-  Parrot_vivify_p_pc_s_p,                            /*   1094 */
-  Parrot_vivify_p_p_sc_p,                            /*   1095 */
-  Parrot_vivify_p_pc_sc_p,                           /*   1096 */
-  Parrot_vivify_p_p_s_pc,                            /*   1097 */
-  Parrot_vivify_p_pc_s_pc,                           /*   1098 */
-  Parrot_vivify_p_p_sc_pc,                           /*   1099 */
-  Parrot_vivify_p_pc_sc_pc,                          /*   1100 */
-  Parrot_new_p_s_i,                                  /*   1101 */
-  Parrot_new_p_sc_i,                                 /*   1102 */
-  Parrot_new_p_s_ic,                                 /*   1103 */
-  Parrot_new_p_sc_ic,                                /*   1104 */
-  Parrot_new_p_p_i,                                  /*   1105 */
-  Parrot_new_p_pc_i,                                 /*   1106 */
-  Parrot_new_p_p_ic,                                 /*   1107 */
-  Parrot_new_p_pc_ic,                                /*   1108 */
-  Parrot_root_new_p_p_i,                             /*   1109 */
-  Parrot_root_new_p_pc_i,                            /*   1110 */
-  Parrot_root_new_p_p_ic,                            /*   1111 */
-  Parrot_root_new_p_pc_ic,                           /*   1112 */
-  Parrot_get_context_p,                              /*   1113 */
-  Parrot_new_call_context_p,                         /*   1114 */
-  Parrot_invokecc_p_p,                               /*   1115 */
-  Parrot_flatten_array_into_p_p_i,                   /*   1116 */
-  Parrot_flatten_array_into_p_p_ic,                  /*   1117 */
-  Parrot_flatten_hash_into_p_p_i,                    /*   1118 */
-  Parrot_flatten_hash_into_p_p_ic,                   /*   1119 */
-  Parrot_slurp_array_from_p_p_i,                     /*   1120 */
-  Parrot_slurp_array_from_p_p_ic,                    /*   1121 */
-  Parrot_receive_p,                                  /*   1122 */
-  Parrot_wait_p,                                     /*   1123 */
-  Parrot_wait_pc,                                    /*   1124 */
-  Parrot_pass,                                       /*   1125 */
-  Parrot_disable_preemption,                         /*   1126 */
-  Parrot_enable_preemption,                          /*   1127 */
-  Parrot_terminate,                                  /*   1128 */
+  Parrot_getattribute_i_p_s,                         /*    586 */
+  Parrot_getattribute_i_p_sc,                        /*    587 */
+  Parrot_getattribute_n_p_s,                         /*    588 */
+  Parrot_getattribute_n_p_sc,                        /*    589 */
+  Parrot_getattribute_s_p_s,                         /*    590 */
+  Parrot_getattribute_s_p_sc,                        /*    591 */
+  Parrot_getattribute_p_p_p_s,                       /*    592 */
+  Parrot_getattribute_p_p_pc_s,                      /*    593 */
+  Parrot_getattribute_p_p_p_sc,                      /*    594 */
+  Parrot_getattribute_p_p_pc_sc,                     /*    595 */
+  Parrot_setattribute_p_s_p,                         /*    596 */
+  Parrot_setattribute_p_sc_p,                        /*    597 */
+  Parrot_setattribute_p_s_i,                         /*    598 */
+  Parrot_setattribute_p_sc_i,                        /*    599 */
+  Parrot_setattribute_p_s_ic,                        /*    600 */
+  Parrot_setattribute_p_sc_ic,                       /*    601 */
+  Parrot_setattribute_p_s_n,                         /*    602 */
+  Parrot_setattribute_p_sc_n,                        /*    603 */
+  Parrot_setattribute_p_s_nc,                        /*    604 */
+  Parrot_setattribute_p_sc_nc,                       /*    605 */
+  Parrot_setattribute_p_s_s,                         /*    606 */
+  Parrot_setattribute_p_sc_s,                        /*    607 */
+  Parrot_setattribute_p_s_sc,                        /*    608 */
+  Parrot_setattribute_p_sc_sc,                       /*    609 */
+  Parrot_setattribute_p_p_s_p,                       /*    610 */
+  Parrot_setattribute_p_pc_s_p,                      /*    611 */
+  Parrot_setattribute_p_p_sc_p,                      /*    612 */
+  Parrot_setattribute_p_pc_sc_p,                     /*    613 */
+  Parrot_inspect_p_p,                                /*    614 */
+  Parrot_inspect_p_pc,                               /*    615 */
+  Parrot_inspect_p_p_s,                              /*    616 */
+  Parrot_inspect_p_pc_s,                             /*    617 */
+  Parrot_inspect_p_p_sc,                             /*    618 */
+  Parrot_inspect_p_pc_sc,                            /*    619 */
+  Parrot_new_p_s,                                    /*    620 */
+  Parrot_new_p_sc,                                   /*    621 */
+  Parrot_new_p_s_p,                                  /*    622 */
+  Parrot_new_p_sc_p,                                 /*    623 */
+  Parrot_new_p_s_pc,                                 /*    624 */
+  Parrot_new_p_sc_pc,                                /*    625 */
+  Parrot_new_p_p,                                    /*    626 */
+  Parrot_new_p_pc,                                   /*    627 */
+  Parrot_new_p_p_p,                                  /*    628 */
+  Parrot_new_p_pc_p,                                 /*    629 */
+  Parrot_new_p_p_pc,                                 /*    630 */
+  Parrot_new_p_pc_pc,                                /*    631 */
+  Parrot_root_new_p_p,                               /*    632 */
+  Parrot_root_new_p_pc,                              /*    633 */
+  Parrot_root_new_p_p_p,                             /*    634 */
+  Parrot_root_new_p_pc_p,                            /*    635 */
+  Parrot_root_new_p_p_pc,                            /*    636 */
+  Parrot_root_new_p_pc_pc,                           /*    637 */
+  Parrot_typeof_s_p,                                 /*    638 */
+  Parrot_typeof_p_p,                                 /*    639 */
+  Parrot_get_repr_s_p,                               /*    640 */
+  Parrot_find_method_p_p_s,                          /*    641 */
+  Parrot_find_method_p_p_sc,                         /*    642 */
+  Parrot_defined_i_p,                                /*    643 */
+  Parrot_defined_i_p_ki,                             /*    644 */
+  Parrot_defined_i_p_kic,                            /*    645 */
+  Parrot_defined_i_p_k,                              /*    646 */
+  Parrot_defined_i_p_kc,                             /*    647 */
+  Parrot_exists_i_p_ki,                              /*    648 */
+  Parrot_exists_i_p_kic,                             /*    649 */
+  Parrot_exists_i_p_k,                               /*    650 */
+  Parrot_exists_i_p_kc,                              /*    651 */
+  Parrot_delete_p_k,                                 /*    652 */
+  Parrot_delete_p_kc,                                /*    653 */
+  Parrot_delete_p_ki,                                /*    654 */
+  Parrot_delete_p_kic,                               /*    655 */
+  Parrot_elements_i_p,                               /*    656 */
+  Parrot_push_p_i,                                   /*    657 */
+  Parrot_push_p_ic,                                  /*    658 */
+  Parrot_push_p_n,                                   /*    659 */
+  Parrot_push_p_nc,                                  /*    660 */
+  Parrot_push_p_s,                                   /*    661 */
+  Parrot_push_p_sc,                                  /*    662 */
+  Parrot_push_p_p,                                   /*    663 */
+  Parrot_pop_i_p,                                    /*    664 */
+  Parrot_pop_n_p,                                    /*    665 */
+  Parrot_pop_s_p,                                    /*    666 */
+  Parrot_pop_p_p,                                    /*    667 */
+  Parrot_unshift_p_i,                                /*    668 */
+  Parrot_unshift_p_ic,                               /*    669 */
+  Parrot_unshift_p_n,                                /*    670 */
+  Parrot_unshift_p_nc,                               /*    671 */
+  Parrot_unshift_p_s,                                /*    672 */
+  Parrot_unshift_p_sc,                               /*    673 */
+  Parrot_unshift_p_p,                                /*    674 */
+  Parrot_shift_i_p,                                  /*    675 */
+  Parrot_shift_n_p,                                  /*    676 */
+  Parrot_shift_s_p,                                  /*    677 */
+  Parrot_shift_p_p,                                  /*    678 */
+  Parrot_splice_p_p_i_i,                             /*    679 */
+  Parrot_splice_p_p_ic_i,                            /*    680 */
+  Parrot_splice_p_p_i_ic,                            /*    681 */
+  Parrot_splice_p_p_ic_ic,                           /*    682 */
+  Parrot_setprop_p_s_p,                              /*    683 */
+  Parrot_setprop_p_sc_p,                             /*    684 */
+  Parrot_getprop_p_s_p,                              /*    685 */
+  Parrot_getprop_p_sc_p,                             /*    686 */
+  Parrot_getprop_p_p_s,                              /*    687 */
+  Parrot_getprop_p_p_sc,                             /*    688 */
+  Parrot_delprop_p_s,                                /*    689 */
+  Parrot_delprop_p_sc,                               /*    690 */
+  Parrot_prophash_p_p,                               /*    691 */
+  Parrot_freeze_s_p,                                 /*    692 */
+  Parrot_thaw_p_s,                                   /*    693 */
+  Parrot_thaw_p_sc,                                  /*    694 */
+  Parrot_add_multi_s_s_p,                            /*    695 */
+  Parrot_add_multi_sc_s_p,                           /*    696 */
+  Parrot_add_multi_s_sc_p,                           /*    697 */
+  Parrot_add_multi_sc_sc_p,                          /*    698 */
+  Parrot_find_multi_p_s_s,                           /*    699 */
+  Parrot_find_multi_p_sc_s,                          /*    700 */
+  Parrot_find_multi_p_s_sc,                          /*    701 */
+  Parrot_find_multi_p_sc_sc,                         /*    702 */
+  Parrot_register_p,                                 /*    703 */
+  Parrot_unregister_p,                               /*    704 */
+  Parrot_box_p_i,                                    /*    705 */
+  Parrot_box_p_ic,                                   /*    706 */
+  Parrot_box_p_n,                                    /*    707 */
+  Parrot_box_p_nc,                                   /*    708 */
+  Parrot_box_p_s,                                    /*    709 */
+  Parrot_box_p_sc,                                   /*    710 */
+  Parrot_iter_p_p,                                   /*    711 */
+  Parrot_morph_p_p,                                  /*    712 */
+  Parrot_morph_p_pc,                                 /*    713 */
+  Parrot_clone_s_s,                                  /*    714 */
+  Parrot_clone_s_sc,                                 /*    715 */
+  Parrot_set_i_i,                                    /*    716 */
+  Parrot_set_i_ic,                                   /*    717 */
+  Parrot_set_i_n,                                    /*    718 */
+  Parrot_set_i_nc,                                   /*    719 */
+  Parrot_set_i_s,                                    /*    720 */
+  Parrot_set_i_sc,                                   /*    721 */
+  Parrot_set_n_n,                                    /*    722 */
+  Parrot_set_n_nc,                                   /*    723 */
+  Parrot_set_n_i,                                    /*    724 */
+  Parrot_set_n_ic,                                   /*    725 */
+  Parrot_set_n_s,                                    /*    726 */
+  Parrot_set_n_sc,                                   /*    727 */
+  Parrot_set_n_p,                                    /*    728 */
+  Parrot_set_s_p,                                    /*    729 */
+  Parrot_set_s_s,                                    /*    730 */
+  Parrot_set_s_sc,                                   /*    731 */
+  Parrot_set_s_i,                                    /*    732 */
+  Parrot_set_s_ic,                                   /*    733 */
+  Parrot_set_s_n,                                    /*    734 */
+  Parrot_set_s_nc,                                   /*    735 */
+  Parrot_set_p_pc,                                   /*    736 */
+  Parrot_set_p_p,                                    /*    737 */
+  Parrot_set_p_i,                                    /*    738 */
+  Parrot_set_p_ic,                                   /*    739 */
+  Parrot_set_p_n,                                    /*    740 */
+  Parrot_set_p_nc,                                   /*    741 */
+  Parrot_set_p_s,                                    /*    742 */
+  Parrot_set_p_sc,                                   /*    743 */
+  Parrot_set_i_p,                                    /*    744 */
+  Parrot_assign_p_p,                                 /*    745 */
+  Parrot_assign_p_i,                                 /*    746 */
+  Parrot_assign_p_ic,                                /*    747 */
+  Parrot_assign_p_n,                                 /*    748 */
+  Parrot_assign_p_nc,                                /*    749 */
+  Parrot_assign_p_s,                                 /*    750 */
+  Parrot_assign_p_sc,                                /*    751 */
+  Parrot_assign_s_s,                                 /*    752 */
+  Parrot_assign_s_sc,                                /*    753 */
+  Parrot_setref_p_p,                                 /*    754 */
+  Parrot_deref_p_p,                                  /*    755 */
+  Parrot_set_p_ki_i,                                 /*    756 */
+  Parrot_set_p_kic_i,                                /*    757 */
+  Parrot_set_p_ki_ic,                                /*    758 */
+  Parrot_set_p_kic_ic,                               /*    759 */
+  Parrot_set_p_ki_n,                                 /*    760 */
+  Parrot_set_p_kic_n,                                /*    761 */
+  Parrot_set_p_ki_nc,                                /*    762 */
+  Parrot_set_p_kic_nc,                               /*    763 */
+  Parrot_set_p_ki_s,                                 /*    764 */
+  Parrot_set_p_kic_s,                                /*    765 */
+  Parrot_set_p_ki_sc,                                /*    766 */
+  Parrot_set_p_kic_sc,                               /*    767 */
+  Parrot_set_p_ki_p,                                 /*    768 */
+  Parrot_set_p_kic_p,                                /*    769 */
+  Parrot_set_i_p_ki,                                 /*    770 */
+  Parrot_set_i_p_kic,                                /*    771 */
+  Parrot_set_n_p_ki,                                 /*    772 */
+  Parrot_set_n_p_kic,                                /*    773 */
+  Parrot_set_s_p_ki,                                 /*    774 */
+  Parrot_set_s_p_kic,                                /*    775 */
+  Parrot_set_p_p_ki,                                 /*    776 */
+  Parrot_set_p_p_kic,                                /*    777 */
+  Parrot_set_p_k_i,                                  /*    778 */
+  Parrot_set_p_kc_i,                                 /*    779 */
+  Parrot_set_p_k_ic,                                 /*    780 */
+  Parrot_set_p_kc_ic,                                /*    781 */
+  Parrot_set_p_k_n,                                  /*    782 */
+  Parrot_set_p_kc_n,                                 /*    783 */
+  Parrot_set_p_k_nc,                                 /*    784 */
+  Parrot_set_p_kc_nc,                                /*    785 */
+  Parrot_set_p_k_s,                                  /*    786 */
+  Parrot_set_p_kc_s,                                 /*    787 */
+  Parrot_set_p_k_sc,                                 /*    788 */
+  Parrot_set_p_kc_sc,                                /*    789 */
+  Parrot_set_p_k_p,                                  /*    790 */
+  Parrot_set_p_kc_p,                                 /*    791 */
+  Parrot_set_i_p_k,                                  /*    792 */
+  Parrot_set_i_p_kc,                                 /*    793 */
+  Parrot_set_n_p_k,                                  /*    794 */
+  Parrot_set_n_p_kc,                                 /*    795 */
+  Parrot_set_s_p_k,                                  /*    796 */
+  Parrot_set_s_p_kc,                                 /*    797 */
+  Parrot_set_p_p_k,                                  /*    798 */
+  Parrot_set_p_p_kc,                                 /*    799 */
+  Parrot_clone_p_p,                                  /*    800 */
+  Parrot_clone_p_p_p,                                /*    801 */
+  Parrot_clone_p_p_pc,                               /*    802 */
+  Parrot_copy_p_p,                                   /*    803 */
+  Parrot_null_s,                                     /*    804 */
+  Parrot_null_i,                                     /*    805 */
+  Parrot_null_p,                                     /*    806 */
+  Parrot_null_n,                                     /*    807 */
+  Parrot_ord_i_s,                                    /*    808 */
+  Parrot_ord_i_sc,                                   /*    809 */
+  Parrot_ord_i_s_i,                                  /*    810 */
+  Parrot_ord_i_sc_i,                                 /*    811 */
+  Parrot_ord_i_s_ic,                                 /*    812 */
+  Parrot_ord_i_sc_ic,                                /*    813 */
+  Parrot_chr_s_i,                                    /*    814 */
+  Parrot_chr_s_ic,                                   /*    815 */
+  Parrot_chopn_s_s_i,                                /*    816 */
+  Parrot_chopn_s_sc_i,                               /*    817 */
+  Parrot_chopn_s_s_ic,                               /*    818 */
+  Parrot_chopn_s_sc_ic,                              /*    819 */
+  Parrot_concat_p_p,                                 /*    820 */
+  Parrot_concat_p_s,                                 /*    821 */
+  Parrot_concat_p_sc,                                /*    822 */
+  Parrot_concat_s_s_s,                               /*    823 */
+  Parrot_concat_s_sc_s,                              /*    824 */
+  Parrot_concat_s_s_sc,                              /*    825 */
+  Parrot_concat_p_p_s,                               /*    826 */
+  Parrot_concat_p_p_sc,                              /*    827 */
+  Parrot_concat_p_p_p,                               /*    828 */
+  Parrot_repeat_s_s_i,                               /*    829 */
+  Parrot_repeat_s_sc_i,                              /*    830 */
+  Parrot_repeat_s_s_ic,                              /*    831 */
+  Parrot_repeat_s_sc_ic,                             /*    832 */
+  Parrot_repeat_p_p_i,                               /*    833 */
+  Parrot_repeat_p_p_ic,                              /*    834 */
+  Parrot_repeat_p_p_p,                               /*    835 */
+  Parrot_repeat_p_i,                                 /*    836 */
+  Parrot_repeat_p_ic,                                /*    837 */
+  Parrot_repeat_p_p,                                 /*    838 */
+  Parrot_length_i_s,                                 /*    839 */
+  Parrot_length_i_sc,                                /*    840 */
+  Parrot_bytelength_i_s,                             /*    841 */
+  Parrot_bytelength_i_sc,                            /*    842 */
+  Parrot_pin_s,                                      /*    843 */
+  Parrot_unpin_s,                                    /*    844 */
+  Parrot_substr_s_s_i,                               /*    845 */
+  Parrot_substr_s_sc_i,                              /*    846 */
+  Parrot_substr_s_s_ic,                              /*    847 */
+  Parrot_substr_s_sc_ic,                             /*    848 */
+  Parrot_substr_s_s_i_i,                             /*    849 */
+  Parrot_substr_s_sc_i_i,                            /*    850 */
+  Parrot_substr_s_s_ic_i,                            /*    851 */
+  Parrot_substr_s_sc_ic_i,                           /*    852 */
+  Parrot_substr_s_s_i_ic,                            /*    853 */
+  Parrot_substr_s_sc_i_ic,                           /*    854 */
+  Parrot_substr_s_s_ic_ic,                           /*    855 */
+  Parrot_substr_s_sc_ic_ic,                          /*    856 */
+  Parrot_substr_s_p_i_i,                             /*    857 */
+  Parrot_substr_s_p_ic_i,                            /*    858 */
+  Parrot_substr_s_p_i_ic,                            /*    859 */
+  Parrot_substr_s_p_ic_ic,                           /*    860 */
+  Parrot_replace_s_s_i_i_s,                          /*    861 */
+  Parrot_replace_s_sc_i_i_s,                         /*    862 */
+  Parrot_replace_s_s_ic_i_s,                         /*    863 */
+  Parrot_replace_s_sc_ic_i_s,                        /*    864 */
+  Parrot_replace_s_s_i_ic_s,                         /*    865 */
+  Parrot_replace_s_sc_i_ic_s,                        /*    866 */
+  Parrot_replace_s_s_ic_ic_s,                        /*    867 */
+  Parrot_replace_s_sc_ic_ic_s,                       /*    868 */
+  Parrot_replace_s_s_i_i_sc,                         /*    869 */
+  Parrot_replace_s_sc_i_i_sc,                        /*    870 */
+  Parrot_replace_s_s_ic_i_sc,                        /*    871 */
+  Parrot_replace_s_sc_ic_i_sc,                       /*    872 */
+  Parrot_replace_s_s_i_ic_sc,                        /*    873 */
+  Parrot_replace_s_sc_i_ic_sc,                       /*    874 */
+  Parrot_replace_s_s_ic_ic_sc,                       /*    875 */
+  Parrot_replace_s_sc_ic_ic_sc,                      /*    876 */
+  Parrot_index_i_s_s,                                /*    877 */
+  Parrot_index_i_sc_s,                               /*    878 */
+  Parrot_index_i_s_sc,                               /*    879 */
+  Parrot_index_i_sc_sc,                              /*    880 */
+  Parrot_index_i_s_s_i,                              /*    881 */
+  Parrot_index_i_sc_s_i,                             /*    882 */
+  Parrot_index_i_s_sc_i,                             /*    883 */
+  Parrot_index_i_sc_sc_i,                            /*    884 */
+  Parrot_index_i_s_s_ic,                             /*    885 */
+  Parrot_index_i_sc_s_ic,                            /*    886 */
+  Parrot_index_i_s_sc_ic,                            /*    887 */
+  Parrot_index_i_sc_sc_ic,                           /*    888 */
+  Parrot_rindex_i_s_s,                               /*    889 */
+  Parrot_rindex_i_sc_s,                              /*    890 */
+  Parrot_rindex_i_s_sc,                              /*    891 */
+  Parrot_rindex_i_sc_sc,                             /*    892 */
+  Parrot_rindex_i_s_s_i,                             /*    893 */
+  Parrot_rindex_i_sc_s_i,                            /*    894 */
+  Parrot_rindex_i_s_sc_i,                            /*    895 */
+  Parrot_rindex_i_sc_sc_i,                           /*    896 */
+  Parrot_rindex_i_s_s_ic,                            /*    897 */
+  Parrot_rindex_i_sc_s_ic,                           /*    898 */
+  Parrot_rindex_i_s_sc_ic,                           /*    899 */
+  Parrot_rindex_i_sc_sc_ic,                          /*    900 */
+  Parrot_sprintf_s_s_p,                              /*    901 */
+  Parrot_sprintf_s_sc_p,                             /*    902 */
+  Parrot_sprintf_p_p_p,                              /*    903 */
+  Parrot_new_s,                                      /*    904 */
+  Parrot_stringinfo_i_s_i,                           /*    905 */
+  Parrot_stringinfo_i_sc_i,                          /*    906 */
+  Parrot_stringinfo_i_s_ic,                          /*    907 */
+  Parrot_stringinfo_i_sc_ic,                         /*    908 */
+  Parrot_upcase_s_s,                                 /*    909 */
+  Parrot_upcase_s_sc,                                /*    910 */
+  Parrot_downcase_s_s,                               /*    911 */
+  Parrot_downcase_s_sc,                              /*    912 */
+  Parrot_titlecase_s_s,                              /*    913 */
+  Parrot_titlecase_s_sc,                             /*    914 */
+  Parrot_join_s_s_p,                                 /*    915 */
+  Parrot_join_s_sc_p,                                /*    916 */
+  Parrot_split_p_s_s,                                /*    917 */
+  Parrot_split_p_sc_s,                               /*    918 */
+  Parrot_split_p_s_sc,                               /*    919 */
+  Parrot_split_p_sc_sc,                              /*    920 */
+  Parrot_encoding_i_s,                               /*    921 */
+  Parrot_encoding_i_sc,                              /*    922 */
+  Parrot_encodingname_s_i,                           /*    923 */
+  Parrot_encodingname_s_ic,                          /*    924 */
+  Parrot_find_encoding_i_s,                          /*    925 */
+  Parrot_find_encoding_i_sc,                         /*    926 */
+  Parrot_trans_encoding_s_s_i,                       /*    927 */
+  Parrot_trans_encoding_s_sc_i,                      /*    928 */
+  Parrot_trans_encoding_s_s_ic,                      /*    929 */
+  Parrot_trans_encoding_s_sc_ic,                     /*    930 */
+  Parrot_is_cclass_i_i_s_i,                          /*    931 */
+  Parrot_is_cclass_i_ic_s_i,                         /*    932 */
+  Parrot_is_cclass_i_i_sc_i,                         /*    933 */
+  Parrot_is_cclass_i_ic_sc_i,                        /*    934 */
+  Parrot_is_cclass_i_i_s_ic,                         /*    935 */
+  Parrot_is_cclass_i_ic_s_ic,                        /*    936 */
+  Parrot_is_cclass_i_i_sc_ic,                        /*    937 */
+  Parrot_is_cclass_i_ic_sc_ic,                       /*    938 */
+  Parrot_find_cclass_i_i_s_i_i,                      /*    939 */
+  Parrot_find_cclass_i_ic_s_i_i,                     /*    940 */
+  Parrot_find_cclass_i_i_sc_i_i,                     /*    941 */
+  Parrot_find_cclass_i_ic_sc_i_i,                    /*    942 */
+  Parrot_find_cclass_i_i_s_ic_i,                     /*    943 */
+  Parrot_find_cclass_i_ic_s_ic_i,                    /*    944 */
+  Parrot_find_cclass_i_i_sc_ic_i,                    /*    945 */
+  Parrot_find_cclass_i_ic_sc_ic_i,                   /*    946 */
+  Parrot_find_cclass_i_i_s_i_ic,                     /*    947 */
+  Parrot_find_cclass_i_ic_s_i_ic,                    /*    948 */
+  Parrot_find_cclass_i_i_sc_i_ic,                    /*    949 */
+  Parrot_find_cclass_i_ic_sc_i_ic,                   /*    950 */
+  Parrot_find_cclass_i_i_s_ic_ic,                    /*    951 */
+  Parrot_find_cclass_i_ic_s_ic_ic,                   /*    952 */
+  Parrot_find_cclass_i_i_sc_ic_ic,                   /*    953 */
+  Parrot_find_cclass_i_ic_sc_ic_ic,                  /*    954 */
+  Parrot_find_not_cclass_i_i_s_i_i,                  /*    955 */
+  Parrot_find_not_cclass_i_ic_s_i_i,                 /*    956 */
+  Parrot_find_not_cclass_i_i_sc_i_i,                 /*    957 */
+  Parrot_find_not_cclass_i_ic_sc_i_i,                /*    958 */
+  Parrot_find_not_cclass_i_i_s_ic_i,                 /*    959 */
+  Parrot_find_not_cclass_i_ic_s_ic_i,                /*    960 */
+  Parrot_find_not_cclass_i_i_sc_ic_i,                /*    961 */
+  Parrot_find_not_cclass_i_ic_sc_ic_i,               /*    962 */
+  Parrot_find_not_cclass_i_i_s_i_ic,                 /*    963 */
+  Parrot_find_not_cclass_i_ic_s_i_ic,                /*    964 */
+  Parrot_find_not_cclass_i_i_sc_i_ic,                /*    965 */
+  Parrot_find_not_cclass_i_ic_sc_i_ic,               /*    966 */
+  Parrot_find_not_cclass_i_i_s_ic_ic,                /*    967 */
+  Parrot_find_not_cclass_i_ic_s_ic_ic,               /*    968 */
+  Parrot_find_not_cclass_i_i_sc_ic_ic,               /*    969 */
+  Parrot_find_not_cclass_i_ic_sc_ic_ic,              /*    970 */
+  Parrot_escape_s_s,                                 /*    971 */
+  Parrot_compose_s_s,                                /*    972 */
+  Parrot_compose_s_sc,                               /*    973 */
+  Parrot_find_codepoint_i_s,                         /*    974 */
+  Parrot_find_codepoint_i_sc,                        /*    975 */
+  Parrot_spawnw_i_s,                                 /*    976 */
+  Parrot_spawnw_i_sc,                                /*    977 */
+  Parrot_spawnw_i_p,                                 /*    978 */
+  Parrot_err_i,                                      /*    979 */
+  Parrot_err_s,                                      /*    980 */
+  Parrot_err_s_i,                                    /*    981 */
+  Parrot_err_s_ic,                                   /*    982 */
+  Parrot_time_i,                                     /*    983 */
+  Parrot_time_n,                                     /*    984 */
+  Parrot_sleep_i,                                    /*    985 */
+  Parrot_sleep_ic,                                   /*    986 */
+  Parrot_sleep_n,                                    /*    987 */
+  Parrot_sleep_nc,                                   /*    988 */
+  Parrot_store_lex_s_p,                              /*    989 */
+  Parrot_store_lex_sc_p,                             /*    990 */
+  Parrot_store_lex_s_s,                              /*    991 */
+  Parrot_store_lex_sc_s,                             /*    992 */
+  Parrot_store_lex_s_sc,                             /*    993 */
+  Parrot_store_lex_sc_sc,                            /*    994 */
+  Parrot_store_lex_s_i,                              /*    995 */
+  Parrot_store_lex_sc_i,                             /*    996 */
+  Parrot_store_lex_s_ic,                             /*    997 */
+  Parrot_store_lex_sc_ic,                            /*    998 */
+  Parrot_store_lex_s_n,                              /*    999 */
+  Parrot_store_lex_sc_n,                             /*   1000 */
+  Parrot_store_lex_s_nc,                             /*   1001 */
+  Parrot_store_lex_sc_nc,                            /*   1002 */
+  Parrot_store_dynamic_lex_s_p,                      /*   1003 */
+  Parrot_store_dynamic_lex_sc_p,                     /*   1004 */
+  Parrot_find_lex_p_s,                               /*   1005 */
+  Parrot_find_lex_p_sc,                              /*   1006 */
+  Parrot_find_lex_s_s,                               /*   1007 */
+  Parrot_find_lex_s_sc,                              /*   1008 */
+  Parrot_find_lex_i_s,                               /*   1009 */
+  Parrot_find_lex_i_sc,                              /*   1010 */
+  Parrot_find_lex_n_s,                               /*   1011 */
+  Parrot_find_lex_n_sc,                              /*   1012 */
+  Parrot_find_dynamic_lex_p_s,                       /*   1013 */
+  Parrot_find_dynamic_lex_p_sc,                      /*   1014 */
+  Parrot_find_caller_lex_p_s,                        /*   1015 */
+  Parrot_find_caller_lex_p_sc,                       /*   1016 */
+  Parrot_get_namespace_p,                            /*   1017 */
+  Parrot_get_namespace_p_p,                          /*   1018 */
+  Parrot_get_namespace_p_pc,                         /*   1019 */
+  Parrot_get_hll_namespace_p,                        /*   1020 */
+  Parrot_get_hll_namespace_p_p,                      /*   1021 */
+  Parrot_get_hll_namespace_p_pc,                     /*   1022 */
+  Parrot_get_root_namespace_p,                       /*   1023 */
+  Parrot_get_root_namespace_p_p,                     /*   1024 */
+  Parrot_get_root_namespace_p_pc,                    /*   1025 */
+  Parrot_get_global_p_s,                             /*   1026 */
+  Parrot_get_global_p_sc,                            /*   1027 */
+  Parrot_get_global_p_p_s,                           /*   1028 */
+  Parrot_get_global_p_pc_s,                          /*   1029 */
+  Parrot_get_global_p_p_sc,                          /*   1030 */
+  Parrot_get_global_p_pc_sc,                         /*   1031 */
+  Parrot_get_hll_global_p_s,                         /*   1032 */
+  Parrot_get_hll_global_p_sc,                        /*   1033 */
+  Parrot_get_hll_global_p_p_s,                       /*   1034 */
+  Parrot_get_hll_global_p_pc_s,                      /*   1035 */
+  Parrot_get_hll_global_p_p_sc,                      /*   1036 */
+  Parrot_get_hll_global_p_pc_sc,                     /*   1037 */
+  Parrot_get_root_global_p_s,                        /*   1038 */
+  Parrot_get_root_global_p_sc,                       /*   1039 */
+  Parrot_get_root_global_p_p_s,                      /*   1040 */
+  Parrot_get_root_global_p_pc_s,                     /*   1041 */
+  Parrot_get_root_global_p_p_sc,                     /*   1042 */
+  Parrot_get_root_global_p_pc_sc,                    /*   1043 */
+  Parrot_set_global_s_p,                             /*   1044 */
+  Parrot_set_global_sc_p,                            /*   1045 */
+  Parrot_set_global_p_s_p,                           /*   1046 */
+  Parrot_set_global_pc_s_p,                          /*   1047 */
+  Parrot_set_global_p_sc_p,                          /*   1048 */
+  Parrot_set_global_pc_sc_p,                         /*   1049 */
+  Parrot_set_hll_global_s_p,                         /*   1050 */
+  Parrot_set_hll_global_sc_p,                        /*   1051 */
+  Parrot_set_hll_global_p_s_p,                       /*   1052 */
+  Parrot_set_hll_global_pc_s_p,                      /*   1053 */
+  Parrot_set_hll_global_p_sc_p,                      /*   1054 */
+  Parrot_set_hll_global_pc_sc_p,                     /*   1055 */
+  Parrot_set_root_global_s_p,                        /*   1056 */
+  Parrot_set_root_global_sc_p,                       /*   1057 */
+  Parrot_set_root_global_p_s_p,                      /*   1058 */
+  Parrot_set_root_global_pc_s_p,                     /*   1059 */
+  Parrot_set_root_global_p_sc_p,                     /*   1060 */
+  Parrot_set_root_global_pc_sc_p,                    /*   1061 */
+  Parrot_find_name_p_s,                              /*   1062 */
+  Parrot_find_name_p_sc,                             /*   1063 */
+  Parrot_find_sub_not_null_p_s,                      /*   1064 */
+  Parrot_find_sub_not_null_p_sc,                     /*   1065 */
+  Parrot_trap,                                       /*   1066 */
+  Parrot_set_label_p_ic,                             /*   1067 */
+  Parrot_get_label_i_p,                              /*   1068 */
+  Parrot_get_id_i_p,                                 /*   1069 */
+  Parrot_get_id_i_pc,                                /*   1070 */
+  Parrot_fetch_p_p_p_p,                              /*   1071 */
+  Parrot_fetch_p_pc_p_p,                             /*   1072 */
+  Parrot_fetch_p_p_pc_p,                             /*   1073 */
+  Parrot_fetch_p_pc_pc_p,                            /*   1074 */
+  Parrot_fetch_p_p_p_pc,                             /*   1075 */
+  Parrot_fetch_p_pc_p_pc,                            /*   1076 */
+  Parrot_fetch_p_p_pc_pc,                            /*   1077 */
+  Parrot_fetch_p_pc_pc_pc,                           /*   1078 */
+  Parrot_fetch_p_p_i_p,                              /*   1079 */
+  Parrot_fetch_p_pc_i_p,                             /*   1080 */
+  Parrot_fetch_p_p_ic_p,                             /*   1081 */
+  Parrot_fetch_p_pc_ic_p,                            /*   1082 */
+  Parrot_fetch_p_p_i_pc,                             /*   1083 */
+  Parrot_fetch_p_pc_i_pc,                            /*   1084 */
+  Parrot_fetch_p_p_ic_pc,                            /*   1085 */
+  Parrot_fetch_p_pc_ic_pc,                           /*   1086 */
+  Parrot_fetch_p_p_s_p,                              /*   1087 */
+  Parrot_fetch_p_pc_s_p,                             /*   1088 */
+  Parrot_fetch_p_p_sc_p,                             /*   1089 */
+  Parrot_fetch_p_pc_sc_p,                            /*   1090 */
+  Parrot_fetch_p_p_s_pc,                             /*   1091 */
+  Parrot_fetch_p_pc_s_pc,                            /*   1092 */
+  Parrot_fetch_p_p_sc_pc,                            /*   1093 */
+  Parrot_fetch_p_pc_sc_pc,                           /*   1094 */
+  Parrot_vivify_p_p_p_p,                             /*   1095 */
+  Parrot_vivify_p_pc_p_p,                            /*   1096 */
+  Parrot_vivify_p_p_pc_p,                            /*   1097 */
+  Parrot_vivify_p_pc_pc_p,                           /*   1098 */
+  Parrot_vivify_p_p_p_pc,                            /*   1099 */
+  Parrot_vivify_p_pc_p_pc,                           /*   1100 */
+  Parrot_vivify_p_p_pc_pc,                           /*   1101 */
+  Parrot_vivify_p_pc_pc_pc,                          /*   1102 */
+  Parrot_vivify_p_p_i_p,                             /*   1103 */
+  Parrot_vivify_p_pc_i_p,                            /*   1104 */
+  Parrot_vivify_p_p_ic_p,                            /*   1105 */
+  Parrot_vivify_p_pc_ic_p,                           /*   1106 */
+  Parrot_vivify_p_p_i_pc,                            /*   1107 */
+  Parrot_vivify_p_pc_i_pc,                           /*   1108 */
+  Parrot_vivify_p_p_ic_pc,                           /*   1109 */
+  Parrot_vivify_p_pc_ic_pc,                          /*   1110 */
+  Parrot_vivify_p_p_s_p,                             /*   1111 */
+  Parrot_vivify_p_pc_s_p,                            /*   1112 */
+  Parrot_vivify_p_p_sc_p,                            /*   1113 */
+  Parrot_vivify_p_pc_sc_p,                           /*   1114 */
+  Parrot_vivify_p_p_s_pc,                            /*   1115 */
+  Parrot_vivify_p_pc_s_pc,                           /*   1116 */
+  Parrot_vivify_p_p_sc_pc,                           /*   1117 */
+  Parrot_vivify_p_pc_sc_pc,                          /*   1118 */
+  Parrot_new_p_s_i,                                  /*   1119 */
+  Parrot_new_p_sc_i,                                 /*   1120 */
+  Parrot_new_p_s_ic,                                 /*   1121 */
+  Parrot_new_p_sc_ic,                                /*   1122 */
+  Parrot_new_p_p_i,                                  /*   1123 */
+  Parrot_new_p_pc_i,                                 /*   1124 */
+  Parrot_new_p_p_ic,                                 /*   1125 */
+  Parrot_new_p_pc_ic,                                /*   1126 */
+  Parrot_root_new_p_p_i,                             /*   1127 */
+  Parrot_root_new_p_pc_i,                            /*   1128 */
+  Parrot_root_new_p_p_ic,                            /*   1129 */
+  Parrot_root_new_p_pc_ic,                           /*   1130 */
+  Parrot_get_context_p,                              /*   1131 */
+  Parrot_new_call_context_p,                         /*   1132 */
+  Parrot_invokecc_p_p,                               /*   1133 */
+  Parrot_flatten_array_into_p_p_i,                   /*   1134 */
+  Parrot_flatten_array_into_p_p_ic,                  /*   1135 */
+  Parrot_flatten_hash_into_p_p_i,                    /*   1136 */
+  Parrot_flatten_hash_into_p_p_ic,                   /*   1137 */
+  Parrot_slurp_array_from_p_p_i,                     /*   1138 */
+  Parrot_slurp_array_from_p_p_ic,                    /*   1139 */
+  Parrot_receive_p,                                  /*   1140 */
+  Parrot_wait_p,                                     /*   1141 */
+  Parrot_wait_pc,                                    /*   1142 */
+  Parrot_pass,                                       /*   1143 */
+  Parrot_disable_preemption,                         /*   1144 */
+  Parrot_enable_preemption,                          /*   1145 */
+  Parrot_green_threads_i,                            /*   1146 */
+  Parrot_green_threads_ic,                           /*   1147 */
+  Parrot_terminate,                                  /*   1148 */
+  Parrot_intern_s_s,                                 /*   1149 */
+  Parrot_intern_s_sc,                                /*   1150 */
 
   NULL /* NULL function pointer */
 };
@@ -1225,7 +1247,7 @@ static op_func_t core_op_func_table[1130] = {
 ** Op Info Table:
 */
 
-static op_info_t core_op_info_table[1130] = {
+static op_info_t core_op_info_table[1152] = {
   { /* 0 */
     "end",
     "end",
@@ -7673,6 +7695,72 @@ static op_info_t core_op_info_table[1130] = {
     &core_op_lib
   },
   { /* 586 */
+    "getattribute",
+    "getattribute_i_p_s",
+    "Parrot_getattribute_i_p_s",
+    0,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_P, PARROT_ARG_S },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 587 */
+    "getattribute",
+    "getattribute_i_p_sc",
+    "Parrot_getattribute_i_p_sc",
+    0,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_P, PARROT_ARG_SC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 588 */
+    "getattribute",
+    "getattribute_n_p_s",
+    "Parrot_getattribute_n_p_s",
+    0,
+    4,
+    { PARROT_ARG_N, PARROT_ARG_P, PARROT_ARG_S },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 589 */
+    "getattribute",
+    "getattribute_n_p_sc",
+    "Parrot_getattribute_n_p_sc",
+    0,
+    4,
+    { PARROT_ARG_N, PARROT_ARG_P, PARROT_ARG_SC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 590 */
+    "getattribute",
+    "getattribute_s_p_s",
+    "Parrot_getattribute_s_p_s",
+    0,
+    4,
+    { PARROT_ARG_S, PARROT_ARG_P, PARROT_ARG_S },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 591 */
+    "getattribute",
+    "getattribute_s_p_sc",
+    "Parrot_getattribute_s_p_sc",
+    0,
+    4,
+    { PARROT_ARG_S, PARROT_ARG_P, PARROT_ARG_SC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 592 */
     "getattribute",
     "getattribute_p_p_p_s",
     "Parrot_getattribute_p_p_p_s",
@@ -7683,7 +7771,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 587 */
+  { /* 593 */
     "getattribute",
     "getattribute_p_p_pc_s",
     "Parrot_getattribute_p_p_pc_s",
@@ -7694,7 +7782,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 588 */
+  { /* 594 */
     "getattribute",
     "getattribute_p_p_p_sc",
     "Parrot_getattribute_p_p_p_sc",
@@ -7705,7 +7793,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 589 */
+  { /* 595 */
     "getattribute",
     "getattribute_p_p_pc_sc",
     "Parrot_getattribute_p_p_pc_sc",
@@ -7716,7 +7804,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 590 */
+  { /* 596 */
     "setattribute",
     "setattribute_p_s_p",
     "Parrot_setattribute_p_s_p",
@@ -7727,7 +7815,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 591 */
+  { /* 597 */
     "setattribute",
     "setattribute_p_sc_p",
     "Parrot_setattribute_p_sc_p",
@@ -7738,7 +7826,139 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 592 */
+  { /* 598 */
+    "setattribute",
+    "setattribute_p_s_i",
+    "Parrot_setattribute_p_s_i",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_S, PARROT_ARG_I },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 599 */
+    "setattribute",
+    "setattribute_p_sc_i",
+    "Parrot_setattribute_p_sc_i",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_SC, PARROT_ARG_I },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 600 */
+    "setattribute",
+    "setattribute_p_s_ic",
+    "Parrot_setattribute_p_s_ic",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_S, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 601 */
+    "setattribute",
+    "setattribute_p_sc_ic",
+    "Parrot_setattribute_p_sc_ic",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_SC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 602 */
+    "setattribute",
+    "setattribute_p_s_n",
+    "Parrot_setattribute_p_s_n",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_S, PARROT_ARG_N },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 603 */
+    "setattribute",
+    "setattribute_p_sc_n",
+    "Parrot_setattribute_p_sc_n",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_SC, PARROT_ARG_N },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 604 */
+    "setattribute",
+    "setattribute_p_s_nc",
+    "Parrot_setattribute_p_s_nc",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_S, PARROT_ARG_NC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 605 */
+    "setattribute",
+    "setattribute_p_sc_nc",
+    "Parrot_setattribute_p_sc_nc",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_SC, PARROT_ARG_NC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 606 */
+    "setattribute",
+    "setattribute_p_s_s",
+    "Parrot_setattribute_p_s_s",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_S, PARROT_ARG_S },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 607 */
+    "setattribute",
+    "setattribute_p_sc_s",
+    "Parrot_setattribute_p_sc_s",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_SC, PARROT_ARG_S },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 608 */
+    "setattribute",
+    "setattribute_p_s_sc",
+    "Parrot_setattribute_p_s_sc",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_S, PARROT_ARG_SC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 609 */
+    "setattribute",
+    "setattribute_p_sc_sc",
+    "Parrot_setattribute_p_sc_sc",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_SC, PARROT_ARG_SC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 610 */
     "setattribute",
     "setattribute_p_p_s_p",
     "Parrot_setattribute_p_p_s_p",
@@ -7749,7 +7969,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 593 */
+  { /* 611 */
     "setattribute",
     "setattribute_p_pc_s_p",
     "Parrot_setattribute_p_pc_s_p",
@@ -7760,7 +7980,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 594 */
+  { /* 612 */
     "setattribute",
     "setattribute_p_p_sc_p",
     "Parrot_setattribute_p_p_sc_p",
@@ -7771,7 +7991,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 595 */
+  { /* 613 */
     "setattribute",
     "setattribute_p_pc_sc_p",
     "Parrot_setattribute_p_pc_sc_p",
@@ -7782,7 +8002,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 596 */
+  { /* 614 */
     "inspect",
     "inspect_p_p",
     "Parrot_inspect_p_p",
@@ -7793,7 +8013,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 597 */
+  { /* 615 */
     "inspect",
     "inspect_p_pc",
     "Parrot_inspect_p_pc",
@@ -7804,7 +8024,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 598 */
+  { /* 616 */
     "inspect",
     "inspect_p_p_s",
     "Parrot_inspect_p_p_s",
@@ -7815,7 +8035,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 599 */
+  { /* 617 */
     "inspect",
     "inspect_p_pc_s",
     "Parrot_inspect_p_pc_s",
@@ -7826,7 +8046,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 600 */
+  { /* 618 */
     "inspect",
     "inspect_p_p_sc",
     "Parrot_inspect_p_p_sc",
@@ -7837,7 +8057,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 601 */
+  { /* 619 */
     "inspect",
     "inspect_p_pc_sc",
     "Parrot_inspect_p_pc_sc",
@@ -7848,7 +8068,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 602 */
+  { /* 620 */
     "new",
     "new_p_s",
     "Parrot_new_p_s",
@@ -7859,7 +8079,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 603 */
+  { /* 621 */
     "new",
     "new_p_sc",
     "Parrot_new_p_sc",
@@ -7870,7 +8090,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 604 */
+  { /* 622 */
     "new",
     "new_p_s_p",
     "Parrot_new_p_s_p",
@@ -7881,7 +8101,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 605 */
+  { /* 623 */
     "new",
     "new_p_sc_p",
     "Parrot_new_p_sc_p",
@@ -7892,7 +8112,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 606 */
+  { /* 624 */
     "new",
     "new_p_s_pc",
     "Parrot_new_p_s_pc",
@@ -7903,7 +8123,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 607 */
+  { /* 625 */
     "new",
     "new_p_sc_pc",
     "Parrot_new_p_sc_pc",
@@ -7914,7 +8134,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 608 */
+  { /* 626 */
     "new",
     "new_p_p",
     "Parrot_new_p_p",
@@ -7925,7 +8145,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 609 */
+  { /* 627 */
     "new",
     "new_p_pc",
     "Parrot_new_p_pc",
@@ -7936,7 +8156,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 610 */
+  { /* 628 */
     "new",
     "new_p_p_p",
     "Parrot_new_p_p_p",
@@ -7947,7 +8167,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 611 */
+  { /* 629 */
     "new",
     "new_p_pc_p",
     "Parrot_new_p_pc_p",
@@ -7958,7 +8178,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 612 */
+  { /* 630 */
     "new",
     "new_p_p_pc",
     "Parrot_new_p_p_pc",
@@ -7969,7 +8189,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 613 */
+  { /* 631 */
     "new",
     "new_p_pc_pc",
     "Parrot_new_p_pc_pc",
@@ -7980,7 +8200,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 614 */
+  { /* 632 */
     "root_new",
     "root_new_p_p",
     "Parrot_root_new_p_p",
@@ -7991,7 +8211,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 615 */
+  { /* 633 */
     "root_new",
     "root_new_p_pc",
     "Parrot_root_new_p_pc",
@@ -8002,7 +8222,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 616 */
+  { /* 634 */
     "root_new",
     "root_new_p_p_p",
     "Parrot_root_new_p_p_p",
@@ -8013,7 +8233,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 617 */
+  { /* 635 */
     "root_new",
     "root_new_p_pc_p",
     "Parrot_root_new_p_pc_p",
@@ -8024,7 +8244,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 618 */
+  { /* 636 */
     "root_new",
     "root_new_p_p_pc",
     "Parrot_root_new_p_p_pc",
@@ -8035,7 +8255,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 619 */
+  { /* 637 */
     "root_new",
     "root_new_p_pc_pc",
     "Parrot_root_new_p_pc_pc",
@@ -8046,7 +8266,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 620 */
+  { /* 638 */
     "typeof",
     "typeof_s_p",
     "Parrot_typeof_s_p",
@@ -8057,7 +8277,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 621 */
+  { /* 639 */
     "typeof",
     "typeof_p_p",
     "Parrot_typeof_p_p",
@@ -8068,7 +8288,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 622 */
+  { /* 640 */
     "get_repr",
     "get_repr_s_p",
     "Parrot_get_repr_s_p",
@@ -8079,7 +8299,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 623 */
+  { /* 641 */
     "find_method",
     "find_method_p_p_s",
     "Parrot_find_method_p_p_s",
@@ -8090,7 +8310,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 624 */
+  { /* 642 */
     "find_method",
     "find_method_p_p_sc",
     "Parrot_find_method_p_p_sc",
@@ -8101,7 +8321,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 625 */
+  { /* 643 */
     "defined",
     "defined_i_p",
     "Parrot_defined_i_p",
@@ -8112,7 +8332,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 626 */
+  { /* 644 */
     "defined",
     "defined_i_p_ki",
     "Parrot_defined_i_p_ki",
@@ -8123,7 +8343,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 627 */
+  { /* 645 */
     "defined",
     "defined_i_p_kic",
     "Parrot_defined_i_p_kic",
@@ -8134,7 +8354,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 628 */
+  { /* 646 */
     "defined",
     "defined_i_p_k",
     "Parrot_defined_i_p_k",
@@ -8145,7 +8365,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 629 */
+  { /* 647 */
     "defined",
     "defined_i_p_kc",
     "Parrot_defined_i_p_kc",
@@ -8156,7 +8376,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 630 */
+  { /* 648 */
     "exists",
     "exists_i_p_ki",
     "Parrot_exists_i_p_ki",
@@ -8167,7 +8387,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 631 */
+  { /* 649 */
     "exists",
     "exists_i_p_kic",
     "Parrot_exists_i_p_kic",
@@ -8178,7 +8398,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 632 */
+  { /* 650 */
     "exists",
     "exists_i_p_k",
     "Parrot_exists_i_p_k",
@@ -8189,7 +8409,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 633 */
+  { /* 651 */
     "exists",
     "exists_i_p_kc",
     "Parrot_exists_i_p_kc",
@@ -8200,7 +8420,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 634 */
+  { /* 652 */
     "delete",
     "delete_p_k",
     "Parrot_delete_p_k",
@@ -8211,7 +8431,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 635 */
+  { /* 653 */
     "delete",
     "delete_p_kc",
     "Parrot_delete_p_kc",
@@ -8222,7 +8442,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 636 */
+  { /* 654 */
     "delete",
     "delete_p_ki",
     "Parrot_delete_p_ki",
@@ -8233,7 +8453,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 637 */
+  { /* 655 */
     "delete",
     "delete_p_kic",
     "Parrot_delete_p_kic",
@@ -8244,7 +8464,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 638 */
+  { /* 656 */
     "elements",
     "elements_i_p",
     "Parrot_elements_i_p",
@@ -8255,7 +8475,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 639 */
+  { /* 657 */
     "push",
     "push_p_i",
     "Parrot_push_p_i",
@@ -8266,7 +8486,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 640 */
+  { /* 658 */
     "push",
     "push_p_ic",
     "Parrot_push_p_ic",
@@ -8277,7 +8497,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 641 */
+  { /* 659 */
     "push",
     "push_p_n",
     "Parrot_push_p_n",
@@ -8288,7 +8508,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 642 */
+  { /* 660 */
     "push",
     "push_p_nc",
     "Parrot_push_p_nc",
@@ -8299,7 +8519,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 643 */
+  { /* 661 */
     "push",
     "push_p_s",
     "Parrot_push_p_s",
@@ -8310,7 +8530,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 644 */
+  { /* 662 */
     "push",
     "push_p_sc",
     "Parrot_push_p_sc",
@@ -8321,7 +8541,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 645 */
+  { /* 663 */
     "push",
     "push_p_p",
     "Parrot_push_p_p",
@@ -8332,7 +8552,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 646 */
+  { /* 664 */
     "pop",
     "pop_i_p",
     "Parrot_pop_i_p",
@@ -8343,7 +8563,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 647 */
+  { /* 665 */
     "pop",
     "pop_n_p",
     "Parrot_pop_n_p",
@@ -8354,7 +8574,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 648 */
+  { /* 666 */
     "pop",
     "pop_s_p",
     "Parrot_pop_s_p",
@@ -8365,7 +8585,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 649 */
+  { /* 667 */
     "pop",
     "pop_p_p",
     "Parrot_pop_p_p",
@@ -8376,7 +8596,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 650 */
+  { /* 668 */
     "unshift",
     "unshift_p_i",
     "Parrot_unshift_p_i",
@@ -8387,7 +8607,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 651 */
+  { /* 669 */
     "unshift",
     "unshift_p_ic",
     "Parrot_unshift_p_ic",
@@ -8398,7 +8618,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 652 */
+  { /* 670 */
     "unshift",
     "unshift_p_n",
     "Parrot_unshift_p_n",
@@ -8409,7 +8629,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 653 */
+  { /* 671 */
     "unshift",
     "unshift_p_nc",
     "Parrot_unshift_p_nc",
@@ -8420,7 +8640,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 654 */
+  { /* 672 */
     "unshift",
     "unshift_p_s",
     "Parrot_unshift_p_s",
@@ -8431,7 +8651,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 655 */
+  { /* 673 */
     "unshift",
     "unshift_p_sc",
     "Parrot_unshift_p_sc",
@@ -8442,7 +8662,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 656 */
+  { /* 674 */
     "unshift",
     "unshift_p_p",
     "Parrot_unshift_p_p",
@@ -8453,7 +8673,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 657 */
+  { /* 675 */
     "shift",
     "shift_i_p",
     "Parrot_shift_i_p",
@@ -8464,7 +8684,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 658 */
+  { /* 676 */
     "shift",
     "shift_n_p",
     "Parrot_shift_n_p",
@@ -8475,7 +8695,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 659 */
+  { /* 677 */
     "shift",
     "shift_s_p",
     "Parrot_shift_s_p",
@@ -8486,7 +8706,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 660 */
+  { /* 678 */
     "shift",
     "shift_p_p",
     "Parrot_shift_p_p",
@@ -8497,7 +8717,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 661 */
+  { /* 679 */
     "splice",
     "splice_p_p_i_i",
     "Parrot_splice_p_p_i_i",
@@ -8508,7 +8728,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 662 */
+  { /* 680 */
     "splice",
     "splice_p_p_ic_i",
     "Parrot_splice_p_p_ic_i",
@@ -8519,7 +8739,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 663 */
+  { /* 681 */
     "splice",
     "splice_p_p_i_ic",
     "Parrot_splice_p_p_i_ic",
@@ -8530,7 +8750,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 664 */
+  { /* 682 */
     "splice",
     "splice_p_p_ic_ic",
     "Parrot_splice_p_p_ic_ic",
@@ -8541,7 +8761,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 665 */
+  { /* 683 */
     "setprop",
     "setprop_p_s_p",
     "Parrot_setprop_p_s_p",
@@ -8552,7 +8772,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 666 */
+  { /* 684 */
     "setprop",
     "setprop_p_sc_p",
     "Parrot_setprop_p_sc_p",
@@ -8563,7 +8783,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 667 */
+  { /* 685 */
     "getprop",
     "getprop_p_s_p",
     "Parrot_getprop_p_s_p",
@@ -8574,7 +8794,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 668 */
+  { /* 686 */
     "getprop",
     "getprop_p_sc_p",
     "Parrot_getprop_p_sc_p",
@@ -8585,7 +8805,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 669 */
+  { /* 687 */
     "getprop",
     "getprop_p_p_s",
     "Parrot_getprop_p_p_s",
@@ -8596,7 +8816,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 670 */
+  { /* 688 */
     "getprop",
     "getprop_p_p_sc",
     "Parrot_getprop_p_p_sc",
@@ -8607,7 +8827,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 671 */
+  { /* 689 */
     "delprop",
     "delprop_p_s",
     "Parrot_delprop_p_s",
@@ -8618,7 +8838,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 672 */
+  { /* 690 */
     "delprop",
     "delprop_p_sc",
     "Parrot_delprop_p_sc",
@@ -8629,7 +8849,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 673 */
+  { /* 691 */
     "prophash",
     "prophash_p_p",
     "Parrot_prophash_p_p",
@@ -8640,7 +8860,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 674 */
+  { /* 692 */
     "freeze",
     "freeze_s_p",
     "Parrot_freeze_s_p",
@@ -8651,7 +8871,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 675 */
+  { /* 693 */
     "thaw",
     "thaw_p_s",
     "Parrot_thaw_p_s",
@@ -8662,7 +8882,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 676 */
+  { /* 694 */
     "thaw",
     "thaw_p_sc",
     "Parrot_thaw_p_sc",
@@ -8673,7 +8893,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 677 */
+  { /* 695 */
     "add_multi",
     "add_multi_s_s_p",
     "Parrot_add_multi_s_s_p",
@@ -8684,7 +8904,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 678 */
+  { /* 696 */
     "add_multi",
     "add_multi_sc_s_p",
     "Parrot_add_multi_sc_s_p",
@@ -8695,7 +8915,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 679 */
+  { /* 697 */
     "add_multi",
     "add_multi_s_sc_p",
     "Parrot_add_multi_s_sc_p",
@@ -8706,7 +8926,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 680 */
+  { /* 698 */
     "add_multi",
     "add_multi_sc_sc_p",
     "Parrot_add_multi_sc_sc_p",
@@ -8717,7 +8937,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 681 */
+  { /* 699 */
     "find_multi",
     "find_multi_p_s_s",
     "Parrot_find_multi_p_s_s",
@@ -8728,7 +8948,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 682 */
+  { /* 700 */
     "find_multi",
     "find_multi_p_sc_s",
     "Parrot_find_multi_p_sc_s",
@@ -8739,7 +8959,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 683 */
+  { /* 701 */
     "find_multi",
     "find_multi_p_s_sc",
     "Parrot_find_multi_p_s_sc",
@@ -8750,7 +8970,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 684 */
+  { /* 702 */
     "find_multi",
     "find_multi_p_sc_sc",
     "Parrot_find_multi_p_sc_sc",
@@ -8761,7 +8981,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 685 */
+  { /* 703 */
     "register",
     "register_p",
     "Parrot_register_p",
@@ -8772,7 +8992,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 686 */
+  { /* 704 */
     "unregister",
     "unregister_p",
     "Parrot_unregister_p",
@@ -8783,7 +9003,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 687 */
+  { /* 705 */
     "box",
     "box_p_i",
     "Parrot_box_p_i",
@@ -8794,7 +9014,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 688 */
+  { /* 706 */
     "box",
     "box_p_ic",
     "Parrot_box_p_ic",
@@ -8805,7 +9025,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 689 */
+  { /* 707 */
     "box",
     "box_p_n",
     "Parrot_box_p_n",
@@ -8816,7 +9036,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 690 */
+  { /* 708 */
     "box",
     "box_p_nc",
     "Parrot_box_p_nc",
@@ -8827,7 +9047,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 691 */
+  { /* 709 */
     "box",
     "box_p_s",
     "Parrot_box_p_s",
@@ -8838,7 +9058,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 692 */
+  { /* 710 */
     "box",
     "box_p_sc",
     "Parrot_box_p_sc",
@@ -8849,7 +9069,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 693 */
+  { /* 711 */
     "iter",
     "iter_p_p",
     "Parrot_iter_p_p",
@@ -8860,7 +9080,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 694 */
+  { /* 712 */
     "morph",
     "morph_p_p",
     "Parrot_morph_p_p",
@@ -8871,7 +9091,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 695 */
+  { /* 713 */
     "morph",
     "morph_p_pc",
     "Parrot_morph_p_pc",
@@ -8882,7 +9102,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 696 */
+  { /* 714 */
     "clone",
     "clone_s_s",
     "Parrot_clone_s_s",
@@ -8893,7 +9113,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 697 */
+  { /* 715 */
     "clone",
     "clone_s_sc",
     "Parrot_clone_s_sc",
@@ -8904,7 +9124,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 698 */
+  { /* 716 */
     "set",
     "set_i_i",
     "Parrot_set_i_i",
@@ -8915,7 +9135,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 699 */
+  { /* 717 */
     "set",
     "set_i_ic",
     "Parrot_set_i_ic",
@@ -8926,7 +9146,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 700 */
+  { /* 718 */
     "set",
     "set_i_n",
     "Parrot_set_i_n",
@@ -8937,7 +9157,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 701 */
+  { /* 719 */
     "set",
     "set_i_nc",
     "Parrot_set_i_nc",
@@ -8948,7 +9168,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 702 */
+  { /* 720 */
     "set",
     "set_i_s",
     "Parrot_set_i_s",
@@ -8959,7 +9179,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 703 */
+  { /* 721 */
     "set",
     "set_i_sc",
     "Parrot_set_i_sc",
@@ -8970,7 +9190,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 704 */
+  { /* 722 */
     "set",
     "set_n_n",
     "Parrot_set_n_n",
@@ -8981,7 +9201,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 705 */
+  { /* 723 */
     "set",
     "set_n_nc",
     "Parrot_set_n_nc",
@@ -8992,7 +9212,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 706 */
+  { /* 724 */
     "set",
     "set_n_i",
     "Parrot_set_n_i",
@@ -9003,7 +9223,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 707 */
+  { /* 725 */
     "set",
     "set_n_ic",
     "Parrot_set_n_ic",
@@ -9014,7 +9234,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 708 */
+  { /* 726 */
     "set",
     "set_n_s",
     "Parrot_set_n_s",
@@ -9025,7 +9245,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 709 */
+  { /* 727 */
     "set",
     "set_n_sc",
     "Parrot_set_n_sc",
@@ -9036,7 +9256,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 710 */
+  { /* 728 */
     "set",
     "set_n_p",
     "Parrot_set_n_p",
@@ -9047,7 +9267,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 711 */
+  { /* 729 */
     "set",
     "set_s_p",
     "Parrot_set_s_p",
@@ -9058,7 +9278,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 712 */
+  { /* 730 */
     "set",
     "set_s_s",
     "Parrot_set_s_s",
@@ -9069,7 +9289,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 713 */
+  { /* 731 */
     "set",
     "set_s_sc",
     "Parrot_set_s_sc",
@@ -9080,7 +9300,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 714 */
+  { /* 732 */
     "set",
     "set_s_i",
     "Parrot_set_s_i",
@@ -9091,7 +9311,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 715 */
+  { /* 733 */
     "set",
     "set_s_ic",
     "Parrot_set_s_ic",
@@ -9102,7 +9322,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 716 */
+  { /* 734 */
     "set",
     "set_s_n",
     "Parrot_set_s_n",
@@ -9113,7 +9333,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 717 */
+  { /* 735 */
     "set",
     "set_s_nc",
     "Parrot_set_s_nc",
@@ -9124,7 +9344,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 718 */
+  { /* 736 */
     "set",
     "set_p_pc",
     "Parrot_set_p_pc",
@@ -9135,7 +9355,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 719 */
+  { /* 737 */
     "set",
     "set_p_p",
     "Parrot_set_p_p",
@@ -9146,7 +9366,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 720 */
+  { /* 738 */
     "set",
     "set_p_i",
     "Parrot_set_p_i",
@@ -9157,7 +9377,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 721 */
+  { /* 739 */
     "set",
     "set_p_ic",
     "Parrot_set_p_ic",
@@ -9168,7 +9388,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 722 */
+  { /* 740 */
     "set",
     "set_p_n",
     "Parrot_set_p_n",
@@ -9179,7 +9399,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 723 */
+  { /* 741 */
     "set",
     "set_p_nc",
     "Parrot_set_p_nc",
@@ -9190,7 +9410,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 724 */
+  { /* 742 */
     "set",
     "set_p_s",
     "Parrot_set_p_s",
@@ -9201,7 +9421,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 725 */
+  { /* 743 */
     "set",
     "set_p_sc",
     "Parrot_set_p_sc",
@@ -9212,7 +9432,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 726 */
+  { /* 744 */
     "set",
     "set_i_p",
     "Parrot_set_i_p",
@@ -9223,7 +9443,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 727 */
+  { /* 745 */
     "assign",
     "assign_p_p",
     "Parrot_assign_p_p",
@@ -9234,7 +9454,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 728 */
+  { /* 746 */
     "assign",
     "assign_p_i",
     "Parrot_assign_p_i",
@@ -9245,7 +9465,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 729 */
+  { /* 747 */
     "assign",
     "assign_p_ic",
     "Parrot_assign_p_ic",
@@ -9256,7 +9476,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 730 */
+  { /* 748 */
     "assign",
     "assign_p_n",
     "Parrot_assign_p_n",
@@ -9267,7 +9487,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 731 */
+  { /* 749 */
     "assign",
     "assign_p_nc",
     "Parrot_assign_p_nc",
@@ -9278,7 +9498,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 732 */
+  { /* 750 */
     "assign",
     "assign_p_s",
     "Parrot_assign_p_s",
@@ -9289,7 +9509,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 733 */
+  { /* 751 */
     "assign",
     "assign_p_sc",
     "Parrot_assign_p_sc",
@@ -9300,7 +9520,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 734 */
+  { /* 752 */
     "assign",
     "assign_s_s",
     "Parrot_assign_s_s",
@@ -9311,7 +9531,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 735 */
+  { /* 753 */
     "assign",
     "assign_s_sc",
     "Parrot_assign_s_sc",
@@ -9322,7 +9542,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 736 */
+  { /* 754 */
     "setref",
     "setref_p_p",
     "Parrot_setref_p_p",
@@ -9333,7 +9553,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 737 */
+  { /* 755 */
     "deref",
     "deref_p_p",
     "Parrot_deref_p_p",
@@ -9344,7 +9564,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 738 */
+  { /* 756 */
     "set",
     "set_p_ki_i",
     "Parrot_set_p_ki_i",
@@ -9355,7 +9575,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 739 */
+  { /* 757 */
     "set",
     "set_p_kic_i",
     "Parrot_set_p_kic_i",
@@ -9366,7 +9586,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 740 */
+  { /* 758 */
     "set",
     "set_p_ki_ic",
     "Parrot_set_p_ki_ic",
@@ -9377,7 +9597,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 741 */
+  { /* 759 */
     "set",
     "set_p_kic_ic",
     "Parrot_set_p_kic_ic",
@@ -9388,7 +9608,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 742 */
+  { /* 760 */
     "set",
     "set_p_ki_n",
     "Parrot_set_p_ki_n",
@@ -9399,7 +9619,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 743 */
+  { /* 761 */
     "set",
     "set_p_kic_n",
     "Parrot_set_p_kic_n",
@@ -9410,7 +9630,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 744 */
+  { /* 762 */
     "set",
     "set_p_ki_nc",
     "Parrot_set_p_ki_nc",
@@ -9421,7 +9641,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 745 */
+  { /* 763 */
     "set",
     "set_p_kic_nc",
     "Parrot_set_p_kic_nc",
@@ -9432,7 +9652,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 746 */
+  { /* 764 */
     "set",
     "set_p_ki_s",
     "Parrot_set_p_ki_s",
@@ -9443,7 +9663,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 747 */
+  { /* 765 */
     "set",
     "set_p_kic_s",
     "Parrot_set_p_kic_s",
@@ -9454,7 +9674,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 748 */
+  { /* 766 */
     "set",
     "set_p_ki_sc",
     "Parrot_set_p_ki_sc",
@@ -9465,7 +9685,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 749 */
+  { /* 767 */
     "set",
     "set_p_kic_sc",
     "Parrot_set_p_kic_sc",
@@ -9476,7 +9696,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 750 */
+  { /* 768 */
     "set",
     "set_p_ki_p",
     "Parrot_set_p_ki_p",
@@ -9487,7 +9707,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 751 */
+  { /* 769 */
     "set",
     "set_p_kic_p",
     "Parrot_set_p_kic_p",
@@ -9498,7 +9718,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 752 */
+  { /* 770 */
     "set",
     "set_i_p_ki",
     "Parrot_set_i_p_ki",
@@ -9509,7 +9729,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 753 */
+  { /* 771 */
     "set",
     "set_i_p_kic",
     "Parrot_set_i_p_kic",
@@ -9520,7 +9740,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 754 */
+  { /* 772 */
     "set",
     "set_n_p_ki",
     "Parrot_set_n_p_ki",
@@ -9531,7 +9751,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 755 */
+  { /* 773 */
     "set",
     "set_n_p_kic",
     "Parrot_set_n_p_kic",
@@ -9542,7 +9762,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 756 */
+  { /* 774 */
     "set",
     "set_s_p_ki",
     "Parrot_set_s_p_ki",
@@ -9553,7 +9773,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 757 */
+  { /* 775 */
     "set",
     "set_s_p_kic",
     "Parrot_set_s_p_kic",
@@ -9564,7 +9784,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 758 */
+  { /* 776 */
     "set",
     "set_p_p_ki",
     "Parrot_set_p_p_ki",
@@ -9575,7 +9795,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 759 */
+  { /* 777 */
     "set",
     "set_p_p_kic",
     "Parrot_set_p_p_kic",
@@ -9586,7 +9806,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 760 */
+  { /* 778 */
     "set",
     "set_p_k_i",
     "Parrot_set_p_k_i",
@@ -9597,7 +9817,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 761 */
+  { /* 779 */
     "set",
     "set_p_kc_i",
     "Parrot_set_p_kc_i",
@@ -9608,7 +9828,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 762 */
+  { /* 780 */
     "set",
     "set_p_k_ic",
     "Parrot_set_p_k_ic",
@@ -9619,7 +9839,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 763 */
+  { /* 781 */
     "set",
     "set_p_kc_ic",
     "Parrot_set_p_kc_ic",
@@ -9630,7 +9850,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 764 */
+  { /* 782 */
     "set",
     "set_p_k_n",
     "Parrot_set_p_k_n",
@@ -9641,7 +9861,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 765 */
+  { /* 783 */
     "set",
     "set_p_kc_n",
     "Parrot_set_p_kc_n",
@@ -9652,7 +9872,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 766 */
+  { /* 784 */
     "set",
     "set_p_k_nc",
     "Parrot_set_p_k_nc",
@@ -9663,7 +9883,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 767 */
+  { /* 785 */
     "set",
     "set_p_kc_nc",
     "Parrot_set_p_kc_nc",
@@ -9674,7 +9894,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 768 */
+  { /* 786 */
     "set",
     "set_p_k_s",
     "Parrot_set_p_k_s",
@@ -9685,7 +9905,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 769 */
+  { /* 787 */
     "set",
     "set_p_kc_s",
     "Parrot_set_p_kc_s",
@@ -9696,7 +9916,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 770 */
+  { /* 788 */
     "set",
     "set_p_k_sc",
     "Parrot_set_p_k_sc",
@@ -9707,7 +9927,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 771 */
+  { /* 789 */
     "set",
     "set_p_kc_sc",
     "Parrot_set_p_kc_sc",
@@ -9718,7 +9938,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 772 */
+  { /* 790 */
     "set",
     "set_p_k_p",
     "Parrot_set_p_k_p",
@@ -9729,7 +9949,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 773 */
+  { /* 791 */
     "set",
     "set_p_kc_p",
     "Parrot_set_p_kc_p",
@@ -9740,7 +9960,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 774 */
+  { /* 792 */
     "set",
     "set_i_p_k",
     "Parrot_set_i_p_k",
@@ -9751,7 +9971,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 775 */
+  { /* 793 */
     "set",
     "set_i_p_kc",
     "Parrot_set_i_p_kc",
@@ -9762,7 +9982,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 776 */
+  { /* 794 */
     "set",
     "set_n_p_k",
     "Parrot_set_n_p_k",
@@ -9773,7 +9993,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 777 */
+  { /* 795 */
     "set",
     "set_n_p_kc",
     "Parrot_set_n_p_kc",
@@ -9784,7 +10004,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 778 */
+  { /* 796 */
     "set",
     "set_s_p_k",
     "Parrot_set_s_p_k",
@@ -9795,7 +10015,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 779 */
+  { /* 797 */
     "set",
     "set_s_p_kc",
     "Parrot_set_s_p_kc",
@@ -9806,7 +10026,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 780 */
+  { /* 798 */
     "set",
     "set_p_p_k",
     "Parrot_set_p_p_k",
@@ -9817,7 +10037,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 781 */
+  { /* 799 */
     "set",
     "set_p_p_kc",
     "Parrot_set_p_p_kc",
@@ -9828,7 +10048,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 782 */
+  { /* 800 */
     "clone",
     "clone_p_p",
     "Parrot_clone_p_p",
@@ -9839,7 +10059,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 783 */
+  { /* 801 */
     "clone",
     "clone_p_p_p",
     "Parrot_clone_p_p_p",
@@ -9850,7 +10070,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 784 */
+  { /* 802 */
     "clone",
     "clone_p_p_pc",
     "Parrot_clone_p_p_pc",
@@ -9861,7 +10081,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 785 */
+  { /* 803 */
     "copy",
     "copy_p_p",
     "Parrot_copy_p_p",
@@ -9872,7 +10092,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 786 */
+  { /* 804 */
     "null",
     "null_s",
     "Parrot_null_s",
@@ -9883,7 +10103,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 787 */
+  { /* 805 */
     "null",
     "null_i",
     "Parrot_null_i",
@@ -9894,7 +10114,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 788 */
+  { /* 806 */
     "null",
     "null_p",
     "Parrot_null_p",
@@ -9905,7 +10125,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 789 */
+  { /* 807 */
     "null",
     "null_n",
     "Parrot_null_n",
@@ -9916,7 +10136,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 790 */
+  { /* 808 */
     "ord",
     "ord_i_s",
     "Parrot_ord_i_s",
@@ -9927,7 +10147,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 791 */
+  { /* 809 */
     "ord",
     "ord_i_sc",
     "Parrot_ord_i_sc",
@@ -9938,7 +10158,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 792 */
+  { /* 810 */
     "ord",
     "ord_i_s_i",
     "Parrot_ord_i_s_i",
@@ -9949,7 +10169,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 793 */
+  { /* 811 */
     "ord",
     "ord_i_sc_i",
     "Parrot_ord_i_sc_i",
@@ -9960,7 +10180,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 794 */
+  { /* 812 */
     "ord",
     "ord_i_s_ic",
     "Parrot_ord_i_s_ic",
@@ -9971,7 +10191,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 795 */
+  { /* 813 */
     "ord",
     "ord_i_sc_ic",
     "Parrot_ord_i_sc_ic",
@@ -9982,7 +10202,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 796 */
+  { /* 814 */
     "chr",
     "chr_s_i",
     "Parrot_chr_s_i",
@@ -9993,7 +10213,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 797 */
+  { /* 815 */
     "chr",
     "chr_s_ic",
     "Parrot_chr_s_ic",
@@ -10004,7 +10224,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 798 */
+  { /* 816 */
     "chopn",
     "chopn_s_s_i",
     "Parrot_chopn_s_s_i",
@@ -10015,7 +10235,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 799 */
+  { /* 817 */
     "chopn",
     "chopn_s_sc_i",
     "Parrot_chopn_s_sc_i",
@@ -10026,7 +10246,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 800 */
+  { /* 818 */
     "chopn",
     "chopn_s_s_ic",
     "Parrot_chopn_s_s_ic",
@@ -10037,7 +10257,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 801 */
+  { /* 819 */
     "chopn",
     "chopn_s_sc_ic",
     "Parrot_chopn_s_sc_ic",
@@ -10048,7 +10268,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 802 */
+  { /* 820 */
     "concat",
     "concat_p_p",
     "Parrot_concat_p_p",
@@ -10059,7 +10279,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 803 */
+  { /* 821 */
     "concat",
     "concat_p_s",
     "Parrot_concat_p_s",
@@ -10070,7 +10290,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 804 */
+  { /* 822 */
     "concat",
     "concat_p_sc",
     "Parrot_concat_p_sc",
@@ -10081,7 +10301,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 805 */
+  { /* 823 */
     "concat",
     "concat_s_s_s",
     "Parrot_concat_s_s_s",
@@ -10092,7 +10312,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 806 */
+  { /* 824 */
     "concat",
     "concat_s_sc_s",
     "Parrot_concat_s_sc_s",
@@ -10103,7 +10323,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 807 */
+  { /* 825 */
     "concat",
     "concat_s_s_sc",
     "Parrot_concat_s_s_sc",
@@ -10114,7 +10334,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 808 */
+  { /* 826 */
     "concat",
     "concat_p_p_s",
     "Parrot_concat_p_p_s",
@@ -10125,7 +10345,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 809 */
+  { /* 827 */
     "concat",
     "concat_p_p_sc",
     "Parrot_concat_p_p_sc",
@@ -10136,7 +10356,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 810 */
+  { /* 828 */
     "concat",
     "concat_p_p_p",
     "Parrot_concat_p_p_p",
@@ -10147,7 +10367,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 811 */
+  { /* 829 */
     "repeat",
     "repeat_s_s_i",
     "Parrot_repeat_s_s_i",
@@ -10158,7 +10378,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 812 */
+  { /* 830 */
     "repeat",
     "repeat_s_sc_i",
     "Parrot_repeat_s_sc_i",
@@ -10169,7 +10389,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 813 */
+  { /* 831 */
     "repeat",
     "repeat_s_s_ic",
     "Parrot_repeat_s_s_ic",
@@ -10180,7 +10400,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 814 */
+  { /* 832 */
     "repeat",
     "repeat_s_sc_ic",
     "Parrot_repeat_s_sc_ic",
@@ -10191,7 +10411,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 815 */
+  { /* 833 */
     "repeat",
     "repeat_p_p_i",
     "Parrot_repeat_p_p_i",
@@ -10202,7 +10422,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 816 */
+  { /* 834 */
     "repeat",
     "repeat_p_p_ic",
     "Parrot_repeat_p_p_ic",
@@ -10213,7 +10433,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 817 */
+  { /* 835 */
     "repeat",
     "repeat_p_p_p",
     "Parrot_repeat_p_p_p",
@@ -10224,7 +10444,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 818 */
+  { /* 836 */
     "repeat",
     "repeat_p_i",
     "Parrot_repeat_p_i",
@@ -10235,7 +10455,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 819 */
+  { /* 837 */
     "repeat",
     "repeat_p_ic",
     "Parrot_repeat_p_ic",
@@ -10246,7 +10466,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 820 */
+  { /* 838 */
     "repeat",
     "repeat_p_p",
     "Parrot_repeat_p_p",
@@ -10257,7 +10477,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 821 */
+  { /* 839 */
     "length",
     "length_i_s",
     "Parrot_length_i_s",
@@ -10268,7 +10488,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 822 */
+  { /* 840 */
     "length",
     "length_i_sc",
     "Parrot_length_i_sc",
@@ -10279,7 +10499,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 823 */
+  { /* 841 */
     "bytelength",
     "bytelength_i_s",
     "Parrot_bytelength_i_s",
@@ -10290,7 +10510,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 824 */
+  { /* 842 */
     "bytelength",
     "bytelength_i_sc",
     "Parrot_bytelength_i_sc",
@@ -10301,7 +10521,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 825 */
+  { /* 843 */
     "pin",
     "pin_s",
     "Parrot_pin_s",
@@ -10312,7 +10532,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 826 */
+  { /* 844 */
     "unpin",
     "unpin_s",
     "Parrot_unpin_s",
@@ -10323,7 +10543,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 827 */
+  { /* 845 */
     "substr",
     "substr_s_s_i",
     "Parrot_substr_s_s_i",
@@ -10334,7 +10554,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 828 */
+  { /* 846 */
     "substr",
     "substr_s_sc_i",
     "Parrot_substr_s_sc_i",
@@ -10345,7 +10565,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 829 */
+  { /* 847 */
     "substr",
     "substr_s_s_ic",
     "Parrot_substr_s_s_ic",
@@ -10356,7 +10576,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 830 */
+  { /* 848 */
     "substr",
     "substr_s_sc_ic",
     "Parrot_substr_s_sc_ic",
@@ -10367,7 +10587,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 831 */
+  { /* 849 */
     "substr",
     "substr_s_s_i_i",
     "Parrot_substr_s_s_i_i",
@@ -10378,7 +10598,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 832 */
+  { /* 850 */
     "substr",
     "substr_s_sc_i_i",
     "Parrot_substr_s_sc_i_i",
@@ -10389,7 +10609,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 833 */
+  { /* 851 */
     "substr",
     "substr_s_s_ic_i",
     "Parrot_substr_s_s_ic_i",
@@ -10400,7 +10620,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 834 */
+  { /* 852 */
     "substr",
     "substr_s_sc_ic_i",
     "Parrot_substr_s_sc_ic_i",
@@ -10411,7 +10631,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 835 */
+  { /* 853 */
     "substr",
     "substr_s_s_i_ic",
     "Parrot_substr_s_s_i_ic",
@@ -10422,7 +10642,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 836 */
+  { /* 854 */
     "substr",
     "substr_s_sc_i_ic",
     "Parrot_substr_s_sc_i_ic",
@@ -10433,7 +10653,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 837 */
+  { /* 855 */
     "substr",
     "substr_s_s_ic_ic",
     "Parrot_substr_s_s_ic_ic",
@@ -10444,7 +10664,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 838 */
+  { /* 856 */
     "substr",
     "substr_s_sc_ic_ic",
     "Parrot_substr_s_sc_ic_ic",
@@ -10455,7 +10675,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 839 */
+  { /* 857 */
     "substr",
     "substr_s_p_i_i",
     "Parrot_substr_s_p_i_i",
@@ -10466,7 +10686,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 840 */
+  { /* 858 */
     "substr",
     "substr_s_p_ic_i",
     "Parrot_substr_s_p_ic_i",
@@ -10477,7 +10697,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 841 */
+  { /* 859 */
     "substr",
     "substr_s_p_i_ic",
     "Parrot_substr_s_p_i_ic",
@@ -10488,7 +10708,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 842 */
+  { /* 860 */
     "substr",
     "substr_s_p_ic_ic",
     "Parrot_substr_s_p_ic_ic",
@@ -10499,7 +10719,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 843 */
+  { /* 861 */
     "replace",
     "replace_s_s_i_i_s",
     "Parrot_replace_s_s_i_i_s",
@@ -10510,7 +10730,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 844 */
+  { /* 862 */
     "replace",
     "replace_s_sc_i_i_s",
     "Parrot_replace_s_sc_i_i_s",
@@ -10521,7 +10741,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 845 */
+  { /* 863 */
     "replace",
     "replace_s_s_ic_i_s",
     "Parrot_replace_s_s_ic_i_s",
@@ -10532,7 +10752,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 846 */
+  { /* 864 */
     "replace",
     "replace_s_sc_ic_i_s",
     "Parrot_replace_s_sc_ic_i_s",
@@ -10543,7 +10763,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 847 */
+  { /* 865 */
     "replace",
     "replace_s_s_i_ic_s",
     "Parrot_replace_s_s_i_ic_s",
@@ -10554,7 +10774,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 848 */
+  { /* 866 */
     "replace",
     "replace_s_sc_i_ic_s",
     "Parrot_replace_s_sc_i_ic_s",
@@ -10565,7 +10785,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 849 */
+  { /* 867 */
     "replace",
     "replace_s_s_ic_ic_s",
     "Parrot_replace_s_s_ic_ic_s",
@@ -10576,7 +10796,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 850 */
+  { /* 868 */
     "replace",
     "replace_s_sc_ic_ic_s",
     "Parrot_replace_s_sc_ic_ic_s",
@@ -10587,7 +10807,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 851 */
+  { /* 869 */
     "replace",
     "replace_s_s_i_i_sc",
     "Parrot_replace_s_s_i_i_sc",
@@ -10598,7 +10818,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 852 */
+  { /* 870 */
     "replace",
     "replace_s_sc_i_i_sc",
     "Parrot_replace_s_sc_i_i_sc",
@@ -10609,7 +10829,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 853 */
+  { /* 871 */
     "replace",
     "replace_s_s_ic_i_sc",
     "Parrot_replace_s_s_ic_i_sc",
@@ -10620,7 +10840,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 854 */
+  { /* 872 */
     "replace",
     "replace_s_sc_ic_i_sc",
     "Parrot_replace_s_sc_ic_i_sc",
@@ -10631,7 +10851,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 855 */
+  { /* 873 */
     "replace",
     "replace_s_s_i_ic_sc",
     "Parrot_replace_s_s_i_ic_sc",
@@ -10642,7 +10862,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 856 */
+  { /* 874 */
     "replace",
     "replace_s_sc_i_ic_sc",
     "Parrot_replace_s_sc_i_ic_sc",
@@ -10653,7 +10873,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 857 */
+  { /* 875 */
     "replace",
     "replace_s_s_ic_ic_sc",
     "Parrot_replace_s_s_ic_ic_sc",
@@ -10664,7 +10884,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 858 */
+  { /* 876 */
     "replace",
     "replace_s_sc_ic_ic_sc",
     "Parrot_replace_s_sc_ic_ic_sc",
@@ -10675,7 +10895,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 859 */
+  { /* 877 */
     "index",
     "index_i_s_s",
     "Parrot_index_i_s_s",
@@ -10686,7 +10906,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 860 */
+  { /* 878 */
     "index",
     "index_i_sc_s",
     "Parrot_index_i_sc_s",
@@ -10697,7 +10917,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 861 */
+  { /* 879 */
     "index",
     "index_i_s_sc",
     "Parrot_index_i_s_sc",
@@ -10708,7 +10928,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 862 */
+  { /* 880 */
     "index",
     "index_i_sc_sc",
     "Parrot_index_i_sc_sc",
@@ -10719,7 +10939,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 863 */
+  { /* 881 */
     "index",
     "index_i_s_s_i",
     "Parrot_index_i_s_s_i",
@@ -10730,7 +10950,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 864 */
+  { /* 882 */
     "index",
     "index_i_sc_s_i",
     "Parrot_index_i_sc_s_i",
@@ -10741,7 +10961,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 865 */
+  { /* 883 */
     "index",
     "index_i_s_sc_i",
     "Parrot_index_i_s_sc_i",
@@ -10752,7 +10972,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 866 */
+  { /* 884 */
     "index",
     "index_i_sc_sc_i",
     "Parrot_index_i_sc_sc_i",
@@ -10763,7 +10983,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 867 */
+  { /* 885 */
     "index",
     "index_i_s_s_ic",
     "Parrot_index_i_s_s_ic",
@@ -10774,7 +10994,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 868 */
+  { /* 886 */
     "index",
     "index_i_sc_s_ic",
     "Parrot_index_i_sc_s_ic",
@@ -10785,7 +11005,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 869 */
+  { /* 887 */
     "index",
     "index_i_s_sc_ic",
     "Parrot_index_i_s_sc_ic",
@@ -10796,7 +11016,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 870 */
+  { /* 888 */
     "index",
     "index_i_sc_sc_ic",
     "Parrot_index_i_sc_sc_ic",
@@ -10807,7 +11027,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 871 */
+  { /* 889 */
     "rindex",
     "rindex_i_s_s",
     "Parrot_rindex_i_s_s",
@@ -10818,7 +11038,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 872 */
+  { /* 890 */
     "rindex",
     "rindex_i_sc_s",
     "Parrot_rindex_i_sc_s",
@@ -10829,7 +11049,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 873 */
+  { /* 891 */
     "rindex",
     "rindex_i_s_sc",
     "Parrot_rindex_i_s_sc",
@@ -10840,7 +11060,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 874 */
+  { /* 892 */
     "rindex",
     "rindex_i_sc_sc",
     "Parrot_rindex_i_sc_sc",
@@ -10851,7 +11071,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 875 */
+  { /* 893 */
     "rindex",
     "rindex_i_s_s_i",
     "Parrot_rindex_i_s_s_i",
@@ -10862,7 +11082,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 876 */
+  { /* 894 */
     "rindex",
     "rindex_i_sc_s_i",
     "Parrot_rindex_i_sc_s_i",
@@ -10873,7 +11093,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 877 */
+  { /* 895 */
     "rindex",
     "rindex_i_s_sc_i",
     "Parrot_rindex_i_s_sc_i",
@@ -10884,7 +11104,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 878 */
+  { /* 896 */
     "rindex",
     "rindex_i_sc_sc_i",
     "Parrot_rindex_i_sc_sc_i",
@@ -10895,7 +11115,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 879 */
+  { /* 897 */
     "rindex",
     "rindex_i_s_s_ic",
     "Parrot_rindex_i_s_s_ic",
@@ -10906,7 +11126,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 880 */
+  { /* 898 */
     "rindex",
     "rindex_i_sc_s_ic",
     "Parrot_rindex_i_sc_s_ic",
@@ -10917,7 +11137,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 881 */
+  { /* 899 */
     "rindex",
     "rindex_i_s_sc_ic",
     "Parrot_rindex_i_s_sc_ic",
@@ -10928,7 +11148,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 882 */
+  { /* 900 */
     "rindex",
     "rindex_i_sc_sc_ic",
     "Parrot_rindex_i_sc_sc_ic",
@@ -10939,7 +11159,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 883 */
+  { /* 901 */
     "sprintf",
     "sprintf_s_s_p",
     "Parrot_sprintf_s_s_p",
@@ -10950,7 +11170,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 884 */
+  { /* 902 */
     "sprintf",
     "sprintf_s_sc_p",
     "Parrot_sprintf_s_sc_p",
@@ -10961,7 +11181,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 885 */
+  { /* 903 */
     "sprintf",
     "sprintf_p_p_p",
     "Parrot_sprintf_p_p_p",
@@ -10972,7 +11192,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 886 */
+  { /* 904 */
     "new",
     "new_s",
     "Parrot_new_s",
@@ -10983,7 +11203,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 887 */
+  { /* 905 */
     "stringinfo",
     "stringinfo_i_s_i",
     "Parrot_stringinfo_i_s_i",
@@ -10994,7 +11214,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 888 */
+  { /* 906 */
     "stringinfo",
     "stringinfo_i_sc_i",
     "Parrot_stringinfo_i_sc_i",
@@ -11005,7 +11225,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 889 */
+  { /* 907 */
     "stringinfo",
     "stringinfo_i_s_ic",
     "Parrot_stringinfo_i_s_ic",
@@ -11016,7 +11236,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 890 */
+  { /* 908 */
     "stringinfo",
     "stringinfo_i_sc_ic",
     "Parrot_stringinfo_i_sc_ic",
@@ -11027,7 +11247,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 891 */
+  { /* 909 */
     "upcase",
     "upcase_s_s",
     "Parrot_upcase_s_s",
@@ -11038,7 +11258,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 892 */
+  { /* 910 */
     "upcase",
     "upcase_s_sc",
     "Parrot_upcase_s_sc",
@@ -11049,7 +11269,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 893 */
+  { /* 911 */
     "downcase",
     "downcase_s_s",
     "Parrot_downcase_s_s",
@@ -11060,7 +11280,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 894 */
+  { /* 912 */
     "downcase",
     "downcase_s_sc",
     "Parrot_downcase_s_sc",
@@ -11071,7 +11291,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 895 */
+  { /* 913 */
     "titlecase",
     "titlecase_s_s",
     "Parrot_titlecase_s_s",
@@ -11082,7 +11302,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 896 */
+  { /* 914 */
     "titlecase",
     "titlecase_s_sc",
     "Parrot_titlecase_s_sc",
@@ -11093,7 +11313,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 897 */
+  { /* 915 */
     "join",
     "join_s_s_p",
     "Parrot_join_s_s_p",
@@ -11104,7 +11324,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 898 */
+  { /* 916 */
     "join",
     "join_s_sc_p",
     "Parrot_join_s_sc_p",
@@ -11115,7 +11335,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 899 */
+  { /* 917 */
     "split",
     "split_p_s_s",
     "Parrot_split_p_s_s",
@@ -11126,7 +11346,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 900 */
+  { /* 918 */
     "split",
     "split_p_sc_s",
     "Parrot_split_p_sc_s",
@@ -11137,7 +11357,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 901 */
+  { /* 919 */
     "split",
     "split_p_s_sc",
     "Parrot_split_p_s_sc",
@@ -11148,7 +11368,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 902 */
+  { /* 920 */
     "split",
     "split_p_sc_sc",
     "Parrot_split_p_sc_sc",
@@ -11159,7 +11379,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 903 */
+  { /* 921 */
     "encoding",
     "encoding_i_s",
     "Parrot_encoding_i_s",
@@ -11170,7 +11390,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 904 */
+  { /* 922 */
     "encoding",
     "encoding_i_sc",
     "Parrot_encoding_i_sc",
@@ -11181,7 +11401,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 905 */
+  { /* 923 */
     "encodingname",
     "encodingname_s_i",
     "Parrot_encodingname_s_i",
@@ -11192,7 +11412,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 906 */
+  { /* 924 */
     "encodingname",
     "encodingname_s_ic",
     "Parrot_encodingname_s_ic",
@@ -11203,7 +11423,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 907 */
+  { /* 925 */
     "find_encoding",
     "find_encoding_i_s",
     "Parrot_find_encoding_i_s",
@@ -11214,7 +11434,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 908 */
+  { /* 926 */
     "find_encoding",
     "find_encoding_i_sc",
     "Parrot_find_encoding_i_sc",
@@ -11225,7 +11445,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 909 */
+  { /* 927 */
     "trans_encoding",
     "trans_encoding_s_s_i",
     "Parrot_trans_encoding_s_s_i",
@@ -11236,7 +11456,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 910 */
+  { /* 928 */
     "trans_encoding",
     "trans_encoding_s_sc_i",
     "Parrot_trans_encoding_s_sc_i",
@@ -11247,7 +11467,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 911 */
+  { /* 929 */
     "trans_encoding",
     "trans_encoding_s_s_ic",
     "Parrot_trans_encoding_s_s_ic",
@@ -11258,7 +11478,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 912 */
+  { /* 930 */
     "trans_encoding",
     "trans_encoding_s_sc_ic",
     "Parrot_trans_encoding_s_sc_ic",
@@ -11269,7 +11489,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 913 */
+  { /* 931 */
     "is_cclass",
     "is_cclass_i_i_s_i",
     "Parrot_is_cclass_i_i_s_i",
@@ -11280,7 +11500,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 914 */
+  { /* 932 */
     "is_cclass",
     "is_cclass_i_ic_s_i",
     "Parrot_is_cclass_i_ic_s_i",
@@ -11291,7 +11511,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 915 */
+  { /* 933 */
     "is_cclass",
     "is_cclass_i_i_sc_i",
     "Parrot_is_cclass_i_i_sc_i",
@@ -11302,7 +11522,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 916 */
+  { /* 934 */
     "is_cclass",
     "is_cclass_i_ic_sc_i",
     "Parrot_is_cclass_i_ic_sc_i",
@@ -11313,7 +11533,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 917 */
+  { /* 935 */
     "is_cclass",
     "is_cclass_i_i_s_ic",
     "Parrot_is_cclass_i_i_s_ic",
@@ -11324,7 +11544,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 918 */
+  { /* 936 */
     "is_cclass",
     "is_cclass_i_ic_s_ic",
     "Parrot_is_cclass_i_ic_s_ic",
@@ -11335,7 +11555,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 919 */
+  { /* 937 */
     "is_cclass",
     "is_cclass_i_i_sc_ic",
     "Parrot_is_cclass_i_i_sc_ic",
@@ -11346,7 +11566,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 920 */
+  { /* 938 */
     "is_cclass",
     "is_cclass_i_ic_sc_ic",
     "Parrot_is_cclass_i_ic_sc_ic",
@@ -11357,7 +11577,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 921 */
+  { /* 939 */
     "find_cclass",
     "find_cclass_i_i_s_i_i",
     "Parrot_find_cclass_i_i_s_i_i",
@@ -11368,7 +11588,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 922 */
+  { /* 940 */
     "find_cclass",
     "find_cclass_i_ic_s_i_i",
     "Parrot_find_cclass_i_ic_s_i_i",
@@ -11379,7 +11599,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 923 */
+  { /* 941 */
     "find_cclass",
     "find_cclass_i_i_sc_i_i",
     "Parrot_find_cclass_i_i_sc_i_i",
@@ -11390,7 +11610,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 924 */
+  { /* 942 */
     "find_cclass",
     "find_cclass_i_ic_sc_i_i",
     "Parrot_find_cclass_i_ic_sc_i_i",
@@ -11401,7 +11621,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 925 */
+  { /* 943 */
     "find_cclass",
     "find_cclass_i_i_s_ic_i",
     "Parrot_find_cclass_i_i_s_ic_i",
@@ -11412,7 +11632,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 926 */
+  { /* 944 */
     "find_cclass",
     "find_cclass_i_ic_s_ic_i",
     "Parrot_find_cclass_i_ic_s_ic_i",
@@ -11423,7 +11643,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 927 */
+  { /* 945 */
     "find_cclass",
     "find_cclass_i_i_sc_ic_i",
     "Parrot_find_cclass_i_i_sc_ic_i",
@@ -11434,7 +11654,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 928 */
+  { /* 946 */
     "find_cclass",
     "find_cclass_i_ic_sc_ic_i",
     "Parrot_find_cclass_i_ic_sc_ic_i",
@@ -11445,7 +11665,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 929 */
+  { /* 947 */
     "find_cclass",
     "find_cclass_i_i_s_i_ic",
     "Parrot_find_cclass_i_i_s_i_ic",
@@ -11456,7 +11676,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 930 */
+  { /* 948 */
     "find_cclass",
     "find_cclass_i_ic_s_i_ic",
     "Parrot_find_cclass_i_ic_s_i_ic",
@@ -11467,7 +11687,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 931 */
+  { /* 949 */
     "find_cclass",
     "find_cclass_i_i_sc_i_ic",
     "Parrot_find_cclass_i_i_sc_i_ic",
@@ -11478,7 +11698,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 932 */
+  { /* 950 */
     "find_cclass",
     "find_cclass_i_ic_sc_i_ic",
     "Parrot_find_cclass_i_ic_sc_i_ic",
@@ -11489,7 +11709,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 933 */
+  { /* 951 */
     "find_cclass",
     "find_cclass_i_i_s_ic_ic",
     "Parrot_find_cclass_i_i_s_ic_ic",
@@ -11500,7 +11720,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 934 */
+  { /* 952 */
     "find_cclass",
     "find_cclass_i_ic_s_ic_ic",
     "Parrot_find_cclass_i_ic_s_ic_ic",
@@ -11511,7 +11731,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 935 */
+  { /* 953 */
     "find_cclass",
     "find_cclass_i_i_sc_ic_ic",
     "Parrot_find_cclass_i_i_sc_ic_ic",
@@ -11522,7 +11742,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 936 */
+  { /* 954 */
     "find_cclass",
     "find_cclass_i_ic_sc_ic_ic",
     "Parrot_find_cclass_i_ic_sc_ic_ic",
@@ -11533,7 +11753,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 937 */
+  { /* 955 */
     "find_not_cclass",
     "find_not_cclass_i_i_s_i_i",
     "Parrot_find_not_cclass_i_i_s_i_i",
@@ -11544,7 +11764,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 938 */
+  { /* 956 */
     "find_not_cclass",
     "find_not_cclass_i_ic_s_i_i",
     "Parrot_find_not_cclass_i_ic_s_i_i",
@@ -11555,7 +11775,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 939 */
+  { /* 957 */
     "find_not_cclass",
     "find_not_cclass_i_i_sc_i_i",
     "Parrot_find_not_cclass_i_i_sc_i_i",
@@ -11566,7 +11786,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 940 */
+  { /* 958 */
     "find_not_cclass",
     "find_not_cclass_i_ic_sc_i_i",
     "Parrot_find_not_cclass_i_ic_sc_i_i",
@@ -11577,7 +11797,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 941 */
+  { /* 959 */
     "find_not_cclass",
     "find_not_cclass_i_i_s_ic_i",
     "Parrot_find_not_cclass_i_i_s_ic_i",
@@ -11588,7 +11808,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 942 */
+  { /* 960 */
     "find_not_cclass",
     "find_not_cclass_i_ic_s_ic_i",
     "Parrot_find_not_cclass_i_ic_s_ic_i",
@@ -11599,7 +11819,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 943 */
+  { /* 961 */
     "find_not_cclass",
     "find_not_cclass_i_i_sc_ic_i",
     "Parrot_find_not_cclass_i_i_sc_ic_i",
@@ -11610,7 +11830,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 944 */
+  { /* 962 */
     "find_not_cclass",
     "find_not_cclass_i_ic_sc_ic_i",
     "Parrot_find_not_cclass_i_ic_sc_ic_i",
@@ -11621,7 +11841,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 945 */
+  { /* 963 */
     "find_not_cclass",
     "find_not_cclass_i_i_s_i_ic",
     "Parrot_find_not_cclass_i_i_s_i_ic",
@@ -11632,7 +11852,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 946 */
+  { /* 964 */
     "find_not_cclass",
     "find_not_cclass_i_ic_s_i_ic",
     "Parrot_find_not_cclass_i_ic_s_i_ic",
@@ -11643,7 +11863,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 947 */
+  { /* 965 */
     "find_not_cclass",
     "find_not_cclass_i_i_sc_i_ic",
     "Parrot_find_not_cclass_i_i_sc_i_ic",
@@ -11654,7 +11874,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 948 */
+  { /* 966 */
     "find_not_cclass",
     "find_not_cclass_i_ic_sc_i_ic",
     "Parrot_find_not_cclass_i_ic_sc_i_ic",
@@ -11665,7 +11885,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 949 */
+  { /* 967 */
     "find_not_cclass",
     "find_not_cclass_i_i_s_ic_ic",
     "Parrot_find_not_cclass_i_i_s_ic_ic",
@@ -11676,7 +11896,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 950 */
+  { /* 968 */
     "find_not_cclass",
     "find_not_cclass_i_ic_s_ic_ic",
     "Parrot_find_not_cclass_i_ic_s_ic_ic",
@@ -11687,7 +11907,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 951 */
+  { /* 969 */
     "find_not_cclass",
     "find_not_cclass_i_i_sc_ic_ic",
     "Parrot_find_not_cclass_i_i_sc_ic_ic",
@@ -11698,7 +11918,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 952 */
+  { /* 970 */
     "find_not_cclass",
     "find_not_cclass_i_ic_sc_ic_ic",
     "Parrot_find_not_cclass_i_ic_sc_ic_ic",
@@ -11709,7 +11929,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 953 */
+  { /* 971 */
     "escape",
     "escape_s_s",
     "Parrot_escape_s_s",
@@ -11720,7 +11940,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 954 */
+  { /* 972 */
     "compose",
     "compose_s_s",
     "Parrot_compose_s_s",
@@ -11731,7 +11951,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 955 */
+  { /* 973 */
     "compose",
     "compose_s_sc",
     "Parrot_compose_s_sc",
@@ -11742,7 +11962,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 956 */
+  { /* 974 */
     "find_codepoint",
     "find_codepoint_i_s",
     "Parrot_find_codepoint_i_s",
@@ -11753,7 +11973,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 957 */
+  { /* 975 */
     "find_codepoint",
     "find_codepoint_i_sc",
     "Parrot_find_codepoint_i_sc",
@@ -11764,7 +11984,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 958 */
+  { /* 976 */
     "spawnw",
     "spawnw_i_s",
     "Parrot_spawnw_i_s",
@@ -11775,7 +11995,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 959 */
+  { /* 977 */
     "spawnw",
     "spawnw_i_sc",
     "Parrot_spawnw_i_sc",
@@ -11786,7 +12006,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 960 */
+  { /* 978 */
     "spawnw",
     "spawnw_i_p",
     "Parrot_spawnw_i_p",
@@ -11797,7 +12017,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 961 */
+  { /* 979 */
     "err",
     "err_i",
     "Parrot_err_i",
@@ -11808,7 +12028,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 962 */
+  { /* 980 */
     "err",
     "err_s",
     "Parrot_err_s",
@@ -11819,7 +12039,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 963 */
+  { /* 981 */
     "err",
     "err_s_i",
     "Parrot_err_s_i",
@@ -11830,7 +12050,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 964 */
+  { /* 982 */
     "err",
     "err_s_ic",
     "Parrot_err_s_ic",
@@ -11841,7 +12061,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 965 */
+  { /* 983 */
     "time",
     "time_i",
     "Parrot_time_i",
@@ -11852,7 +12072,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 966 */
+  { /* 984 */
     "time",
     "time_n",
     "Parrot_time_n",
@@ -11863,7 +12083,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 967 */
+  { /* 985 */
     "sleep",
     "sleep_i",
     "Parrot_sleep_i",
@@ -11874,7 +12094,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 968 */
+  { /* 986 */
     "sleep",
     "sleep_ic",
     "Parrot_sleep_ic",
@@ -11885,7 +12105,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 969 */
+  { /* 987 */
     "sleep",
     "sleep_n",
     "Parrot_sleep_n",
@@ -11896,7 +12116,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 970 */
+  { /* 988 */
     "sleep",
     "sleep_nc",
     "Parrot_sleep_nc",
@@ -11907,7 +12127,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 971 */
+  { /* 989 */
     "store_lex",
     "store_lex_s_p",
     "Parrot_store_lex_s_p",
@@ -11918,7 +12138,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 972 */
+  { /* 990 */
     "store_lex",
     "store_lex_sc_p",
     "Parrot_store_lex_sc_p",
@@ -11929,7 +12149,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 973 */
+  { /* 991 */
     "store_lex",
     "store_lex_s_s",
     "Parrot_store_lex_s_s",
@@ -11940,7 +12160,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 974 */
+  { /* 992 */
     "store_lex",
     "store_lex_sc_s",
     "Parrot_store_lex_sc_s",
@@ -11951,7 +12171,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 975 */
+  { /* 993 */
     "store_lex",
     "store_lex_s_sc",
     "Parrot_store_lex_s_sc",
@@ -11962,7 +12182,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 976 */
+  { /* 994 */
     "store_lex",
     "store_lex_sc_sc",
     "Parrot_store_lex_sc_sc",
@@ -11973,7 +12193,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 977 */
+  { /* 995 */
     "store_lex",
     "store_lex_s_i",
     "Parrot_store_lex_s_i",
@@ -11984,7 +12204,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 978 */
+  { /* 996 */
     "store_lex",
     "store_lex_sc_i",
     "Parrot_store_lex_sc_i",
@@ -11995,7 +12215,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 979 */
+  { /* 997 */
     "store_lex",
     "store_lex_s_ic",
     "Parrot_store_lex_s_ic",
@@ -12006,7 +12226,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 980 */
+  { /* 998 */
     "store_lex",
     "store_lex_sc_ic",
     "Parrot_store_lex_sc_ic",
@@ -12017,7 +12237,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 981 */
+  { /* 999 */
     "store_lex",
     "store_lex_s_n",
     "Parrot_store_lex_s_n",
@@ -12028,7 +12248,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 982 */
+  { /* 1000 */
     "store_lex",
     "store_lex_sc_n",
     "Parrot_store_lex_sc_n",
@@ -12039,7 +12259,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 983 */
+  { /* 1001 */
     "store_lex",
     "store_lex_s_nc",
     "Parrot_store_lex_s_nc",
@@ -12050,7 +12270,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 984 */
+  { /* 1002 */
     "store_lex",
     "store_lex_sc_nc",
     "Parrot_store_lex_sc_nc",
@@ -12061,7 +12281,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 985 */
+  { /* 1003 */
     "store_dynamic_lex",
     "store_dynamic_lex_s_p",
     "Parrot_store_dynamic_lex_s_p",
@@ -12072,7 +12292,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 986 */
+  { /* 1004 */
     "store_dynamic_lex",
     "store_dynamic_lex_sc_p",
     "Parrot_store_dynamic_lex_sc_p",
@@ -12083,7 +12303,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 987 */
+  { /* 1005 */
     "find_lex",
     "find_lex_p_s",
     "Parrot_find_lex_p_s",
@@ -12094,7 +12314,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 988 */
+  { /* 1006 */
     "find_lex",
     "find_lex_p_sc",
     "Parrot_find_lex_p_sc",
@@ -12105,7 +12325,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 989 */
+  { /* 1007 */
     "find_lex",
     "find_lex_s_s",
     "Parrot_find_lex_s_s",
@@ -12116,7 +12336,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 990 */
+  { /* 1008 */
     "find_lex",
     "find_lex_s_sc",
     "Parrot_find_lex_s_sc",
@@ -12127,7 +12347,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 991 */
+  { /* 1009 */
     "find_lex",
     "find_lex_i_s",
     "Parrot_find_lex_i_s",
@@ -12138,7 +12358,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 992 */
+  { /* 1010 */
     "find_lex",
     "find_lex_i_sc",
     "Parrot_find_lex_i_sc",
@@ -12149,7 +12369,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 993 */
+  { /* 1011 */
     "find_lex",
     "find_lex_n_s",
     "Parrot_find_lex_n_s",
@@ -12160,7 +12380,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 994 */
+  { /* 1012 */
     "find_lex",
     "find_lex_n_sc",
     "Parrot_find_lex_n_sc",
@@ -12171,7 +12391,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 995 */
+  { /* 1013 */
     "find_dynamic_lex",
     "find_dynamic_lex_p_s",
     "Parrot_find_dynamic_lex_p_s",
@@ -12182,7 +12402,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 996 */
+  { /* 1014 */
     "find_dynamic_lex",
     "find_dynamic_lex_p_sc",
     "Parrot_find_dynamic_lex_p_sc",
@@ -12193,7 +12413,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 997 */
+  { /* 1015 */
     "find_caller_lex",
     "find_caller_lex_p_s",
     "Parrot_find_caller_lex_p_s",
@@ -12204,7 +12424,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 998 */
+  { /* 1016 */
     "find_caller_lex",
     "find_caller_lex_p_sc",
     "Parrot_find_caller_lex_p_sc",
@@ -12215,7 +12435,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 999 */
+  { /* 1017 */
     "get_namespace",
     "get_namespace_p",
     "Parrot_get_namespace_p",
@@ -12226,7 +12446,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 1000 */
+  { /* 1018 */
     "get_namespace",
     "get_namespace_p_p",
     "Parrot_get_namespace_p_p",
@@ -12237,7 +12457,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1001 */
+  { /* 1019 */
     "get_namespace",
     "get_namespace_p_pc",
     "Parrot_get_namespace_p_pc",
@@ -12248,7 +12468,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1002 */
+  { /* 1020 */
     "get_hll_namespace",
     "get_hll_namespace_p",
     "Parrot_get_hll_namespace_p",
@@ -12259,7 +12479,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 1003 */
+  { /* 1021 */
     "get_hll_namespace",
     "get_hll_namespace_p_p",
     "Parrot_get_hll_namespace_p_p",
@@ -12270,7 +12490,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1004 */
+  { /* 1022 */
     "get_hll_namespace",
     "get_hll_namespace_p_pc",
     "Parrot_get_hll_namespace_p_pc",
@@ -12281,7 +12501,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1005 */
+  { /* 1023 */
     "get_root_namespace",
     "get_root_namespace_p",
     "Parrot_get_root_namespace_p",
@@ -12292,7 +12512,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 1006 */
+  { /* 1024 */
     "get_root_namespace",
     "get_root_namespace_p_p",
     "Parrot_get_root_namespace_p_p",
@@ -12303,7 +12523,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1007 */
+  { /* 1025 */
     "get_root_namespace",
     "get_root_namespace_p_pc",
     "Parrot_get_root_namespace_p_pc",
@@ -12314,7 +12534,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1008 */
+  { /* 1026 */
     "get_global",
     "get_global_p_s",
     "Parrot_get_global_p_s",
@@ -12325,7 +12545,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1009 */
+  { /* 1027 */
     "get_global",
     "get_global_p_sc",
     "Parrot_get_global_p_sc",
@@ -12336,7 +12556,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1010 */
+  { /* 1028 */
     "get_global",
     "get_global_p_p_s",
     "Parrot_get_global_p_p_s",
@@ -12347,7 +12567,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1011 */
+  { /* 1029 */
     "get_global",
     "get_global_p_pc_s",
     "Parrot_get_global_p_pc_s",
@@ -12358,7 +12578,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1012 */
+  { /* 1030 */
     "get_global",
     "get_global_p_p_sc",
     "Parrot_get_global_p_p_sc",
@@ -12369,7 +12589,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1013 */
+  { /* 1031 */
     "get_global",
     "get_global_p_pc_sc",
     "Parrot_get_global_p_pc_sc",
@@ -12380,7 +12600,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1014 */
+  { /* 1032 */
     "get_hll_global",
     "get_hll_global_p_s",
     "Parrot_get_hll_global_p_s",
@@ -12391,7 +12611,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1015 */
+  { /* 1033 */
     "get_hll_global",
     "get_hll_global_p_sc",
     "Parrot_get_hll_global_p_sc",
@@ -12402,7 +12622,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1016 */
+  { /* 1034 */
     "get_hll_global",
     "get_hll_global_p_p_s",
     "Parrot_get_hll_global_p_p_s",
@@ -12413,7 +12633,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1017 */
+  { /* 1035 */
     "get_hll_global",
     "get_hll_global_p_pc_s",
     "Parrot_get_hll_global_p_pc_s",
@@ -12424,7 +12644,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1018 */
+  { /* 1036 */
     "get_hll_global",
     "get_hll_global_p_p_sc",
     "Parrot_get_hll_global_p_p_sc",
@@ -12435,7 +12655,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1019 */
+  { /* 1037 */
     "get_hll_global",
     "get_hll_global_p_pc_sc",
     "Parrot_get_hll_global_p_pc_sc",
@@ -12446,7 +12666,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1020 */
+  { /* 1038 */
     "get_root_global",
     "get_root_global_p_s",
     "Parrot_get_root_global_p_s",
@@ -12457,7 +12677,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1021 */
+  { /* 1039 */
     "get_root_global",
     "get_root_global_p_sc",
     "Parrot_get_root_global_p_sc",
@@ -12468,7 +12688,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1022 */
+  { /* 1040 */
     "get_root_global",
     "get_root_global_p_p_s",
     "Parrot_get_root_global_p_p_s",
@@ -12479,7 +12699,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1023 */
+  { /* 1041 */
     "get_root_global",
     "get_root_global_p_pc_s",
     "Parrot_get_root_global_p_pc_s",
@@ -12490,7 +12710,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1024 */
+  { /* 1042 */
     "get_root_global",
     "get_root_global_p_p_sc",
     "Parrot_get_root_global_p_p_sc",
@@ -12501,7 +12721,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1025 */
+  { /* 1043 */
     "get_root_global",
     "get_root_global_p_pc_sc",
     "Parrot_get_root_global_p_pc_sc",
@@ -12512,7 +12732,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1026 */
+  { /* 1044 */
     "set_global",
     "set_global_s_p",
     "Parrot_set_global_s_p",
@@ -12523,7 +12743,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1027 */
+  { /* 1045 */
     "set_global",
     "set_global_sc_p",
     "Parrot_set_global_sc_p",
@@ -12534,7 +12754,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1028 */
+  { /* 1046 */
     "set_global",
     "set_global_p_s_p",
     "Parrot_set_global_p_s_p",
@@ -12545,7 +12765,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1029 */
+  { /* 1047 */
     "set_global",
     "set_global_pc_s_p",
     "Parrot_set_global_pc_s_p",
@@ -12556,7 +12776,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1030 */
+  { /* 1048 */
     "set_global",
     "set_global_p_sc_p",
     "Parrot_set_global_p_sc_p",
@@ -12567,7 +12787,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1031 */
+  { /* 1049 */
     "set_global",
     "set_global_pc_sc_p",
     "Parrot_set_global_pc_sc_p",
@@ -12578,7 +12798,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1032 */
+  { /* 1050 */
     "set_hll_global",
     "set_hll_global_s_p",
     "Parrot_set_hll_global_s_p",
@@ -12589,7 +12809,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1033 */
+  { /* 1051 */
     "set_hll_global",
     "set_hll_global_sc_p",
     "Parrot_set_hll_global_sc_p",
@@ -12600,7 +12820,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1034 */
+  { /* 1052 */
     "set_hll_global",
     "set_hll_global_p_s_p",
     "Parrot_set_hll_global_p_s_p",
@@ -12611,7 +12831,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1035 */
+  { /* 1053 */
     "set_hll_global",
     "set_hll_global_pc_s_p",
     "Parrot_set_hll_global_pc_s_p",
@@ -12622,7 +12842,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1036 */
+  { /* 1054 */
     "set_hll_global",
     "set_hll_global_p_sc_p",
     "Parrot_set_hll_global_p_sc_p",
@@ -12633,7 +12853,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1037 */
+  { /* 1055 */
     "set_hll_global",
     "set_hll_global_pc_sc_p",
     "Parrot_set_hll_global_pc_sc_p",
@@ -12644,7 +12864,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1038 */
+  { /* 1056 */
     "set_root_global",
     "set_root_global_s_p",
     "Parrot_set_root_global_s_p",
@@ -12655,7 +12875,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1039 */
+  { /* 1057 */
     "set_root_global",
     "set_root_global_sc_p",
     "Parrot_set_root_global_sc_p",
@@ -12666,7 +12886,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1040 */
+  { /* 1058 */
     "set_root_global",
     "set_root_global_p_s_p",
     "Parrot_set_root_global_p_s_p",
@@ -12677,7 +12897,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1041 */
+  { /* 1059 */
     "set_root_global",
     "set_root_global_pc_s_p",
     "Parrot_set_root_global_pc_s_p",
@@ -12688,7 +12908,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1042 */
+  { /* 1060 */
     "set_root_global",
     "set_root_global_p_sc_p",
     "Parrot_set_root_global_p_sc_p",
@@ -12699,7 +12919,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1043 */
+  { /* 1061 */
     "set_root_global",
     "set_root_global_pc_sc_p",
     "Parrot_set_root_global_pc_sc_p",
@@ -12710,7 +12930,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1044 */
+  { /* 1062 */
     "find_name",
     "find_name_p_s",
     "Parrot_find_name_p_s",
@@ -12721,7 +12941,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1045 */
+  { /* 1063 */
     "find_name",
     "find_name_p_sc",
     "Parrot_find_name_p_sc",
@@ -12732,7 +12952,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1046 */
+  { /* 1064 */
     "find_sub_not_null",
     "find_sub_not_null_p_s",
     "Parrot_find_sub_not_null_p_s",
@@ -12743,7 +12963,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1047 */
+  { /* 1065 */
     "find_sub_not_null",
     "find_sub_not_null_p_sc",
     "Parrot_find_sub_not_null_p_sc",
@@ -12754,7 +12974,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1048 */
+  { /* 1066 */
     "trap",
     "trap",
     "Parrot_trap",
@@ -12765,7 +12985,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 1049 */
+  { /* 1067 */
     "set_label",
     "set_label_p_ic",
     "Parrot_set_label_p_ic",
@@ -12776,7 +12996,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 1 },
     &core_op_lib
   },
-  { /* 1050 */
+  { /* 1068 */
     "get_label",
     "get_label_i_p",
     "Parrot_get_label_i_p",
@@ -12787,7 +13007,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1051 */
+  { /* 1069 */
     "get_id",
     "get_id_i_p",
     "Parrot_get_id_i_p",
@@ -12798,7 +13018,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1052 */
+  { /* 1070 */
     "get_id",
     "get_id_i_pc",
     "Parrot_get_id_i_pc",
@@ -12809,7 +13029,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1053 */
+  { /* 1071 */
     "fetch",
     "fetch_p_p_p_p",
     "Parrot_fetch_p_p_p_p",
@@ -12820,7 +13040,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1054 */
+  { /* 1072 */
     "fetch",
     "fetch_p_pc_p_p",
     "Parrot_fetch_p_pc_p_p",
@@ -12831,7 +13051,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1055 */
+  { /* 1073 */
     "fetch",
     "fetch_p_p_pc_p",
     "Parrot_fetch_p_p_pc_p",
@@ -12842,7 +13062,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1056 */
+  { /* 1074 */
     "fetch",
     "fetch_p_pc_pc_p",
     "Parrot_fetch_p_pc_pc_p",
@@ -12853,7 +13073,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1057 */
+  { /* 1075 */
     "fetch",
     "fetch_p_p_p_pc",
     "Parrot_fetch_p_p_p_pc",
@@ -12864,7 +13084,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1058 */
+  { /* 1076 */
     "fetch",
     "fetch_p_pc_p_pc",
     "Parrot_fetch_p_pc_p_pc",
@@ -12875,7 +13095,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1059 */
+  { /* 1077 */
     "fetch",
     "fetch_p_p_pc_pc",
     "Parrot_fetch_p_p_pc_pc",
@@ -12886,7 +13106,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1060 */
+  { /* 1078 */
     "fetch",
     "fetch_p_pc_pc_pc",
     "Parrot_fetch_p_pc_pc_pc",
@@ -12897,7 +13117,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1061 */
+  { /* 1079 */
     "fetch",
     "fetch_p_p_i_p",
     "Parrot_fetch_p_p_i_p",
@@ -12908,7 +13128,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1062 */
+  { /* 1080 */
     "fetch",
     "fetch_p_pc_i_p",
     "Parrot_fetch_p_pc_i_p",
@@ -12919,7 +13139,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1063 */
+  { /* 1081 */
     "fetch",
     "fetch_p_p_ic_p",
     "Parrot_fetch_p_p_ic_p",
@@ -12930,7 +13150,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1064 */
+  { /* 1082 */
     "fetch",
     "fetch_p_pc_ic_p",
     "Parrot_fetch_p_pc_ic_p",
@@ -12941,7 +13161,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1065 */
+  { /* 1083 */
     "fetch",
     "fetch_p_p_i_pc",
     "Parrot_fetch_p_p_i_pc",
@@ -12952,7 +13172,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1066 */
+  { /* 1084 */
     "fetch",
     "fetch_p_pc_i_pc",
     "Parrot_fetch_p_pc_i_pc",
@@ -12963,7 +13183,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1067 */
+  { /* 1085 */
     "fetch",
     "fetch_p_p_ic_pc",
     "Parrot_fetch_p_p_ic_pc",
@@ -12974,7 +13194,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1068 */
+  { /* 1086 */
     "fetch",
     "fetch_p_pc_ic_pc",
     "Parrot_fetch_p_pc_ic_pc",
@@ -12985,7 +13205,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1069 */
+  { /* 1087 */
     "fetch",
     "fetch_p_p_s_p",
     "Parrot_fetch_p_p_s_p",
@@ -12996,7 +13216,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1070 */
+  { /* 1088 */
     "fetch",
     "fetch_p_pc_s_p",
     "Parrot_fetch_p_pc_s_p",
@@ -13007,7 +13227,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1071 */
+  { /* 1089 */
     "fetch",
     "fetch_p_p_sc_p",
     "Parrot_fetch_p_p_sc_p",
@@ -13018,7 +13238,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1072 */
+  { /* 1090 */
     "fetch",
     "fetch_p_pc_sc_p",
     "Parrot_fetch_p_pc_sc_p",
@@ -13029,7 +13249,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1073 */
+  { /* 1091 */
     "fetch",
     "fetch_p_p_s_pc",
     "Parrot_fetch_p_p_s_pc",
@@ -13040,7 +13260,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1074 */
+  { /* 1092 */
     "fetch",
     "fetch_p_pc_s_pc",
     "Parrot_fetch_p_pc_s_pc",
@@ -13051,7 +13271,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1075 */
+  { /* 1093 */
     "fetch",
     "fetch_p_p_sc_pc",
     "Parrot_fetch_p_p_sc_pc",
@@ -13062,7 +13282,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1076 */
+  { /* 1094 */
     "fetch",
     "fetch_p_pc_sc_pc",
     "Parrot_fetch_p_pc_sc_pc",
@@ -13073,7 +13293,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1077 */
+  { /* 1095 */
     "vivify",
     "vivify_p_p_p_p",
     "Parrot_vivify_p_p_p_p",
@@ -13084,7 +13304,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1078 */
+  { /* 1096 */
     "vivify",
     "vivify_p_pc_p_p",
     "Parrot_vivify_p_pc_p_p",
@@ -13095,7 +13315,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1079 */
+  { /* 1097 */
     "vivify",
     "vivify_p_p_pc_p",
     "Parrot_vivify_p_p_pc_p",
@@ -13106,7 +13326,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1080 */
+  { /* 1098 */
     "vivify",
     "vivify_p_pc_pc_p",
     "Parrot_vivify_p_pc_pc_p",
@@ -13117,7 +13337,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1081 */
+  { /* 1099 */
     "vivify",
     "vivify_p_p_p_pc",
     "Parrot_vivify_p_p_p_pc",
@@ -13128,7 +13348,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1082 */
+  { /* 1100 */
     "vivify",
     "vivify_p_pc_p_pc",
     "Parrot_vivify_p_pc_p_pc",
@@ -13139,7 +13359,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1083 */
+  { /* 1101 */
     "vivify",
     "vivify_p_p_pc_pc",
     "Parrot_vivify_p_p_pc_pc",
@@ -13150,7 +13370,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1084 */
+  { /* 1102 */
     "vivify",
     "vivify_p_pc_pc_pc",
     "Parrot_vivify_p_pc_pc_pc",
@@ -13161,7 +13381,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1085 */
+  { /* 1103 */
     "vivify",
     "vivify_p_p_i_p",
     "Parrot_vivify_p_p_i_p",
@@ -13172,7 +13392,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1086 */
+  { /* 1104 */
     "vivify",
     "vivify_p_pc_i_p",
     "Parrot_vivify_p_pc_i_p",
@@ -13183,7 +13403,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1087 */
+  { /* 1105 */
     "vivify",
     "vivify_p_p_ic_p",
     "Parrot_vivify_p_p_ic_p",
@@ -13194,7 +13414,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1088 */
+  { /* 1106 */
     "vivify",
     "vivify_p_pc_ic_p",
     "Parrot_vivify_p_pc_ic_p",
@@ -13205,7 +13425,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1089 */
+  { /* 1107 */
     "vivify",
     "vivify_p_p_i_pc",
     "Parrot_vivify_p_p_i_pc",
@@ -13216,7 +13436,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1090 */
+  { /* 1108 */
     "vivify",
     "vivify_p_pc_i_pc",
     "Parrot_vivify_p_pc_i_pc",
@@ -13227,7 +13447,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1091 */
+  { /* 1109 */
     "vivify",
     "vivify_p_p_ic_pc",
     "Parrot_vivify_p_p_ic_pc",
@@ -13238,7 +13458,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1092 */
+  { /* 1110 */
     "vivify",
     "vivify_p_pc_ic_pc",
     "Parrot_vivify_p_pc_ic_pc",
@@ -13249,7 +13469,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1093 */
+  { /* 1111 */
     "vivify",
     "vivify_p_p_s_p",
     "Parrot_vivify_p_p_s_p",
@@ -13260,7 +13480,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1094 */
+  { /* 1112 */
     "vivify",
     "vivify_p_pc_s_p",
     "Parrot_vivify_p_pc_s_p",
@@ -13271,7 +13491,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1095 */
+  { /* 1113 */
     "vivify",
     "vivify_p_p_sc_p",
     "Parrot_vivify_p_p_sc_p",
@@ -13282,7 +13502,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1096 */
+  { /* 1114 */
     "vivify",
     "vivify_p_pc_sc_p",
     "Parrot_vivify_p_pc_sc_p",
@@ -13293,7 +13513,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1097 */
+  { /* 1115 */
     "vivify",
     "vivify_p_p_s_pc",
     "Parrot_vivify_p_p_s_pc",
@@ -13304,7 +13524,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1098 */
+  { /* 1116 */
     "vivify",
     "vivify_p_pc_s_pc",
     "Parrot_vivify_p_pc_s_pc",
@@ -13315,7 +13535,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1099 */
+  { /* 1117 */
     "vivify",
     "vivify_p_p_sc_pc",
     "Parrot_vivify_p_p_sc_pc",
@@ -13326,7 +13546,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1100 */
+  { /* 1118 */
     "vivify",
     "vivify_p_pc_sc_pc",
     "Parrot_vivify_p_pc_sc_pc",
@@ -13337,7 +13557,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1101 */
+  { /* 1119 */
     "new",
     "new_p_s_i",
     "Parrot_new_p_s_i",
@@ -13348,7 +13568,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1102 */
+  { /* 1120 */
     "new",
     "new_p_sc_i",
     "Parrot_new_p_sc_i",
@@ -13359,7 +13579,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1103 */
+  { /* 1121 */
     "new",
     "new_p_s_ic",
     "Parrot_new_p_s_ic",
@@ -13370,7 +13590,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1104 */
+  { /* 1122 */
     "new",
     "new_p_sc_ic",
     "Parrot_new_p_sc_ic",
@@ -13381,7 +13601,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1105 */
+  { /* 1123 */
     "new",
     "new_p_p_i",
     "Parrot_new_p_p_i",
@@ -13392,7 +13612,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1106 */
+  { /* 1124 */
     "new",
     "new_p_pc_i",
     "Parrot_new_p_pc_i",
@@ -13403,7 +13623,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1107 */
+  { /* 1125 */
     "new",
     "new_p_p_ic",
     "Parrot_new_p_p_ic",
@@ -13414,7 +13634,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1108 */
+  { /* 1126 */
     "new",
     "new_p_pc_ic",
     "Parrot_new_p_pc_ic",
@@ -13425,7 +13645,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1109 */
+  { /* 1127 */
     "root_new",
     "root_new_p_p_i",
     "Parrot_root_new_p_p_i",
@@ -13436,7 +13656,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1110 */
+  { /* 1128 */
     "root_new",
     "root_new_p_pc_i",
     "Parrot_root_new_p_pc_i",
@@ -13447,7 +13667,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1111 */
+  { /* 1129 */
     "root_new",
     "root_new_p_p_ic",
     "Parrot_root_new_p_p_ic",
@@ -13458,7 +13678,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1112 */
+  { /* 1130 */
     "root_new",
     "root_new_p_pc_ic",
     "Parrot_root_new_p_pc_ic",
@@ -13469,7 +13689,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1113 */
+  { /* 1131 */
     "get_context",
     "get_context_p",
     "Parrot_get_context_p",
@@ -13480,7 +13700,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 1114 */
+  { /* 1132 */
     "new_call_context",
     "new_call_context_p",
     "Parrot_new_call_context_p",
@@ -13491,7 +13711,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 1115 */
+  { /* 1133 */
     "invokecc",
     "invokecc_p_p",
     "Parrot_invokecc_p_p",
@@ -13502,7 +13722,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1116 */
+  { /* 1134 */
     "flatten_array_into",
     "flatten_array_into_p_p_i",
     "Parrot_flatten_array_into_p_p_i",
@@ -13513,7 +13733,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1117 */
+  { /* 1135 */
     "flatten_array_into",
     "flatten_array_into_p_p_ic",
     "Parrot_flatten_array_into_p_p_ic",
@@ -13524,7 +13744,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1118 */
+  { /* 1136 */
     "flatten_hash_into",
     "flatten_hash_into_p_p_i",
     "Parrot_flatten_hash_into_p_p_i",
@@ -13535,7 +13755,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1119 */
+  { /* 1137 */
     "flatten_hash_into",
     "flatten_hash_into_p_p_ic",
     "Parrot_flatten_hash_into_p_p_ic",
@@ -13546,7 +13766,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1120 */
+  { /* 1138 */
     "slurp_array_from",
     "slurp_array_from_p_p_i",
     "Parrot_slurp_array_from_p_p_i",
@@ -13557,7 +13777,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1121 */
+  { /* 1139 */
     "slurp_array_from",
     "slurp_array_from_p_p_ic",
     "Parrot_slurp_array_from_p_p_ic",
@@ -13568,7 +13788,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1122 */
+  { /* 1140 */
     "receive",
     "receive_p",
     "Parrot_receive_p",
@@ -13579,7 +13799,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 1123 */
+  { /* 1141 */
     "wait",
     "wait_p",
     "Parrot_wait_p",
@@ -13590,7 +13810,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 1124 */
+  { /* 1142 */
     "wait",
     "wait_pc",
     "Parrot_wait_pc",
@@ -13601,7 +13821,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 1125 */
+  { /* 1143 */
     "pass",
     "pass",
     "Parrot_pass",
@@ -13612,7 +13832,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 1126 */
+  { /* 1144 */
     "disable_preemption",
     "disable_preemption",
     "Parrot_disable_preemption",
@@ -13623,7 +13843,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 1127 */
+  { /* 1145 */
     "enable_preemption",
     "enable_preemption",
     "Parrot_enable_preemption",
@@ -13634,7 +13854,29 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 1128 */
+  { /* 1146 */
+    "green_threads",
+    "green_threads_i",
+    "Parrot_green_threads_i",
+    0,
+    2,
+    { PARROT_ARG_I },
+    { PARROT_ARGDIR_IN },
+    { 0 },
+    &core_op_lib
+  },
+  { /* 1147 */
+    "green_threads",
+    "green_threads_ic",
+    "Parrot_green_threads_ic",
+    0,
+    2,
+    { PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN },
+    { 0 },
+    &core_op_lib
+  },
+  { /* 1148 */
     "terminate",
     "terminate",
     "Parrot_terminate",
@@ -13645,6 +13887,28 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
+  { /* 1149 */
+    "intern",
+    "intern_s_s",
+    "Parrot_intern_s_s",
+    0,
+    3,
+    { PARROT_ARG_S, PARROT_ARG_S },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1150 */
+    "intern",
+    "intern_s_sc",
+    "Parrot_intern_s_sc",
+    0,
+    3,
+    { PARROT_ARG_S, PARROT_ARG_SC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
 
 };
 
@@ -13724,8 +13988,10 @@ Parrot_load_language_sc(opcode_t *cur_opcode, PARROT_INTERP) {
 
 opcode_t *
 Parrot_branch_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    if ((Parrot_cx_check_scheduler(interp, (cur_opcode + IREG(1))) == 0)) {
-        return (opcode_t *)0;
+    opcode_t  * const  dest = Parrot_cx_check_scheduler(interp, (cur_opcode + IREG(1)));
+
+    if ((dest != (cur_opcode + IREG(1)))) {
+        return (opcode_t *)dest;
     }
 
     return cur_opcode + IREG(1);
@@ -13733,8 +13999,10 @@ Parrot_branch_i(opcode_t *cur_opcode, PARROT_INTERP) {
 
 opcode_t *
 Parrot_branch_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    if ((Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(1))) == 0)) {
-        return (opcode_t *)0;
+    opcode_t  * const  dest = Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(1)));
+
+    if ((dest != (cur_opcode + ICONST(1)))) {
+        return (opcode_t *)dest;
     }
 
     return cur_opcode + ICONST(1);
@@ -13816,6 +14084,10 @@ Parrot_jump_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_if_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((IREG(1) != 0)) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(2))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(2)));
+        }
+
         return cur_opcode + ICONST(2);
     }
 
@@ -13825,6 +14097,10 @@ Parrot_if_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_if_n_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((!FLOAT_IS_ZERO(NREG(1)))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(2))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(2)));
+        }
+
         return cur_opcode + ICONST(2);
     }
 
@@ -13834,6 +14110,10 @@ Parrot_if_n_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_if_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if (Parrot_str_boolean(interp, SREG(1))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(2))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(2)));
+        }
+
         return cur_opcode + ICONST(2);
     }
 
@@ -13843,6 +14123,10 @@ Parrot_if_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_if_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if (VTABLE_get_bool(interp, PREG(1))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(2))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(2)));
+        }
+
         return cur_opcode + ICONST(2);
     }
 
@@ -13852,6 +14136,10 @@ Parrot_if_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_unless_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((IREG(1) == 0)) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(2))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(2)));
+        }
+
         return cur_opcode + ICONST(2);
     }
 
@@ -13861,6 +14149,10 @@ Parrot_unless_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_unless_n_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if (FLOAT_IS_ZERO(NREG(1))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(2))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(2)));
+        }
+
         return cur_opcode + ICONST(2);
     }
 
@@ -13870,6 +14162,10 @@ Parrot_unless_n_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_unless_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((!Parrot_str_boolean(interp, SREG(1)))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(2))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(2)));
+        }
+
         return cur_opcode + ICONST(2);
     }
 
@@ -13879,6 +14175,10 @@ Parrot_unless_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_unless_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((!VTABLE_get_bool(interp, PREG(1)))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(2))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(2)));
+        }
+
         return cur_opcode + ICONST(2);
     }
 
@@ -15296,6 +15596,10 @@ Parrot_bxor_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_eq_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((IREG(1) == IREG(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15305,6 +15609,10 @@ Parrot_eq_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_eq_ic_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((ICONST(1) == IREG(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15314,6 +15622,10 @@ Parrot_eq_ic_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_eq_i_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((IREG(1) == ICONST(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15323,6 +15635,10 @@ Parrot_eq_i_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_eq_n_n_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((NREG(1) == NREG(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15332,6 +15648,10 @@ Parrot_eq_n_n_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_eq_nc_n_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((NCONST(1) == NREG(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15341,6 +15661,10 @@ Parrot_eq_nc_n_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_eq_n_nc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((NREG(1) == NCONST(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15350,6 +15674,10 @@ Parrot_eq_n_nc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_eq_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if (STRING_equal(interp, SREG(1), SREG(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15359,6 +15687,10 @@ Parrot_eq_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_eq_sc_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if (STRING_equal(interp, SCONST(1), SREG(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15368,6 +15700,10 @@ Parrot_eq_sc_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_eq_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if (STRING_equal(interp, SREG(1), SCONST(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15377,6 +15713,10 @@ Parrot_eq_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_eq_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if (VTABLE_is_equal(interp, PREG(1), PREG(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15390,6 +15730,10 @@ Parrot_eq_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     VTABLE_set_integer_native(interp, temp, IREG(2));
     if (VTABLE_is_equal(interp, PREG(1), temp)) {
         Parrot_pmc_free_temporary(interp, temp);
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15404,6 +15748,10 @@ Parrot_eq_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     VTABLE_set_integer_native(interp, temp, ICONST(2));
     if (VTABLE_is_equal(interp, PREG(1), temp)) {
         Parrot_pmc_free_temporary(interp, temp);
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15414,6 +15762,10 @@ Parrot_eq_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_eq_p_n_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((VTABLE_get_number(interp, PREG(1)) == NREG(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15423,6 +15775,10 @@ Parrot_eq_p_n_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_eq_p_nc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((VTABLE_get_number(interp, PREG(1)) == NCONST(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15432,6 +15788,10 @@ Parrot_eq_p_nc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_eq_p_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if (STRING_equal(interp, VTABLE_get_string(interp, PREG(1)), SREG(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15441,6 +15801,10 @@ Parrot_eq_p_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_eq_p_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if (STRING_equal(interp, VTABLE_get_string(interp, PREG(1)), SCONST(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15450,6 +15814,10 @@ Parrot_eq_p_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_eq_str_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if (VTABLE_is_equal_string(interp, PREG(1), PREG(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15459,6 +15827,10 @@ Parrot_eq_str_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_eq_num_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if (VTABLE_is_equal_num(interp, PREG(1), PREG(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15468,6 +15840,10 @@ Parrot_eq_num_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_eq_addr_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((SREG(1) == SREG(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15477,6 +15853,10 @@ Parrot_eq_addr_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_eq_addr_sc_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((SCONST(1) == SREG(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15486,6 +15866,10 @@ Parrot_eq_addr_sc_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_eq_addr_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((SREG(1) == SCONST(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15495,6 +15879,10 @@ Parrot_eq_addr_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_eq_addr_sc_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((SCONST(1) == SCONST(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15504,6 +15892,10 @@ Parrot_eq_addr_sc_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_eq_addr_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((PREG(1) == PREG(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15513,6 +15905,10 @@ Parrot_eq_addr_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_ne_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((IREG(1) != IREG(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15522,6 +15918,10 @@ Parrot_ne_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_ne_ic_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((ICONST(1) != IREG(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15531,6 +15931,10 @@ Parrot_ne_ic_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_ne_i_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((IREG(1) != ICONST(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15540,6 +15944,10 @@ Parrot_ne_i_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_ne_n_n_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((NREG(1) != NREG(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15549,6 +15957,10 @@ Parrot_ne_n_n_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_ne_nc_n_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((NCONST(1) != NREG(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15558,6 +15970,10 @@ Parrot_ne_nc_n_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_ne_n_nc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((NREG(1) != NCONST(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15567,6 +15983,10 @@ Parrot_ne_n_nc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_ne_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((!STRING_equal(interp, SREG(1), SREG(2)))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15576,6 +15996,10 @@ Parrot_ne_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_ne_sc_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((!STRING_equal(interp, SCONST(1), SREG(2)))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15585,6 +16009,10 @@ Parrot_ne_sc_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_ne_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((!STRING_equal(interp, SREG(1), SCONST(2)))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15594,6 +16022,10 @@ Parrot_ne_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_ne_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((!VTABLE_is_equal(interp, PREG(1), PREG(2)))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15607,6 +16039,10 @@ Parrot_ne_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     VTABLE_set_integer_native(interp, temp, IREG(2));
     if ((!VTABLE_is_equal(interp, PREG(1), temp))) {
         Parrot_pmc_free_temporary(interp, temp);
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15621,6 +16057,10 @@ Parrot_ne_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     VTABLE_set_integer_native(interp, temp, ICONST(2));
     if ((!VTABLE_is_equal(interp, PREG(1), temp))) {
         Parrot_pmc_free_temporary(interp, temp);
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15631,6 +16071,10 @@ Parrot_ne_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_ne_p_n_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((VTABLE_get_number(interp, PREG(1)) != NREG(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15640,6 +16084,10 @@ Parrot_ne_p_n_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_ne_p_nc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((VTABLE_get_number(interp, PREG(1)) != NCONST(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15649,6 +16097,10 @@ Parrot_ne_p_nc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_ne_p_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((!STRING_equal(interp, VTABLE_get_string(interp, PREG(1)), SREG(2)))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15658,6 +16110,10 @@ Parrot_ne_p_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_ne_p_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((!STRING_equal(interp, VTABLE_get_string(interp, PREG(1)), SCONST(2)))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15667,6 +16123,10 @@ Parrot_ne_p_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_ne_str_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((VTABLE_cmp_string(interp, PREG(1), PREG(2)) != 0)) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15676,6 +16136,10 @@ Parrot_ne_str_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_ne_num_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((VTABLE_cmp_num(interp, PREG(1), PREG(2)) != 0)) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15685,6 +16149,10 @@ Parrot_ne_num_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_ne_addr_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((SREG(1) != SREG(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15694,6 +16162,10 @@ Parrot_ne_addr_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_ne_addr_sc_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((SCONST(1) != SREG(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15703,6 +16175,10 @@ Parrot_ne_addr_sc_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_ne_addr_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((SREG(1) != SCONST(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15712,6 +16188,10 @@ Parrot_ne_addr_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_ne_addr_sc_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((SCONST(1) != SCONST(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15721,6 +16201,10 @@ Parrot_ne_addr_sc_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_ne_addr_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((PREG(1) != PREG(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15730,6 +16214,10 @@ Parrot_ne_addr_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_lt_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((IREG(1) < IREG(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15739,6 +16227,10 @@ Parrot_lt_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_lt_ic_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((ICONST(1) < IREG(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15748,6 +16240,10 @@ Parrot_lt_ic_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_lt_i_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((IREG(1) < ICONST(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15757,6 +16253,10 @@ Parrot_lt_i_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_lt_n_n_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((NREG(1) < NREG(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15766,6 +16266,10 @@ Parrot_lt_n_n_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_lt_nc_n_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((NCONST(1) < NREG(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15775,6 +16279,10 @@ Parrot_lt_nc_n_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_lt_n_nc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((NREG(1) < NCONST(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15784,6 +16292,10 @@ Parrot_lt_n_nc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_lt_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((STRING_compare(interp, SREG(1), SREG(2)) < 0)) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15793,6 +16305,10 @@ Parrot_lt_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_lt_sc_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((STRING_compare(interp, SCONST(1), SREG(2)) < 0)) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15802,6 +16318,10 @@ Parrot_lt_sc_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_lt_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((STRING_compare(interp, SREG(1), SCONST(2)) < 0)) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15811,6 +16331,10 @@ Parrot_lt_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_lt_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((VTABLE_cmp(interp, PREG(1), PREG(2)) < 0)) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15824,6 +16348,10 @@ Parrot_lt_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     VTABLE_set_integer_native(interp, temp, IREG(2));
     if ((VTABLE_cmp(interp, PREG(1), temp) < 0)) {
         Parrot_pmc_free_temporary(interp, temp);
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15838,6 +16366,10 @@ Parrot_lt_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     VTABLE_set_integer_native(interp, temp, ICONST(2));
     if ((VTABLE_cmp(interp, PREG(1), temp) < 0)) {
         Parrot_pmc_free_temporary(interp, temp);
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15848,6 +16380,10 @@ Parrot_lt_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_lt_p_n_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((VTABLE_get_number(interp, PREG(1)) < NREG(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15857,6 +16393,10 @@ Parrot_lt_p_n_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_lt_p_nc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((VTABLE_get_number(interp, PREG(1)) < NCONST(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15866,6 +16406,10 @@ Parrot_lt_p_nc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_lt_p_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SREG(2)) < 0)) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15875,6 +16419,10 @@ Parrot_lt_p_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_lt_p_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SCONST(2)) < 0)) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15884,6 +16432,10 @@ Parrot_lt_p_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_lt_str_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((VTABLE_cmp_string(interp, PREG(1), PREG(2)) < 0)) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15893,6 +16445,10 @@ Parrot_lt_str_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_lt_num_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((VTABLE_cmp_num(interp, PREG(1), PREG(2)) < 0)) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15902,6 +16458,10 @@ Parrot_lt_num_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_le_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((IREG(1) <= IREG(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15911,6 +16471,10 @@ Parrot_le_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_le_ic_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((ICONST(1) <= IREG(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15920,6 +16484,10 @@ Parrot_le_ic_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_le_i_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((IREG(1) <= ICONST(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15929,6 +16497,10 @@ Parrot_le_i_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_le_n_n_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((NREG(1) <= NREG(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15938,6 +16510,10 @@ Parrot_le_n_n_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_le_nc_n_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((NCONST(1) <= NREG(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15947,6 +16523,10 @@ Parrot_le_nc_n_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_le_n_nc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((NREG(1) <= NCONST(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15956,6 +16536,10 @@ Parrot_le_n_nc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_le_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((STRING_compare(interp, SREG(1), SREG(2)) <= 0)) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15965,6 +16549,10 @@ Parrot_le_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_le_sc_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((STRING_compare(interp, SCONST(1), SREG(2)) <= 0)) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15974,6 +16562,10 @@ Parrot_le_sc_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_le_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((STRING_compare(interp, SREG(1), SCONST(2)) <= 0)) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15983,6 +16575,10 @@ Parrot_le_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_le_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((VTABLE_cmp(interp, PREG(1), PREG(2)) <= 0)) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -15996,6 +16592,10 @@ Parrot_le_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     VTABLE_set_integer_native(interp, temp, IREG(2));
     if ((VTABLE_cmp(interp, PREG(1), temp) <= 0)) {
         Parrot_pmc_free_temporary(interp, temp);
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -16010,6 +16610,10 @@ Parrot_le_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     VTABLE_set_integer_native(interp, temp, ICONST(2));
     if ((VTABLE_cmp(interp, PREG(1), temp) <= 0)) {
         Parrot_pmc_free_temporary(interp, temp);
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -16020,6 +16624,10 @@ Parrot_le_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_le_p_n_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((VTABLE_get_number(interp, PREG(1)) <= NREG(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -16029,6 +16637,10 @@ Parrot_le_p_n_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_le_p_nc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((VTABLE_get_number(interp, PREG(1)) <= NCONST(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -16038,6 +16650,10 @@ Parrot_le_p_nc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_le_p_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SREG(2)) <= 0)) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -16047,6 +16663,10 @@ Parrot_le_p_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_le_p_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SCONST(2)) <= 0)) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -16056,6 +16676,10 @@ Parrot_le_p_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_le_str_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((VTABLE_cmp_string(interp, PREG(1), PREG(2)) <= 0)) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -16065,6 +16689,10 @@ Parrot_le_str_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_le_num_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((VTABLE_cmp_num(interp, PREG(1), PREG(2)) <= 0)) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -16074,6 +16702,10 @@ Parrot_le_num_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_gt_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((VTABLE_cmp(interp, PREG(1), PREG(2)) > 0)) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -16087,6 +16719,10 @@ Parrot_gt_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     VTABLE_set_integer_native(interp, temp, IREG(2));
     if ((VTABLE_cmp(interp, PREG(1), temp) > 0)) {
         Parrot_pmc_free_temporary(interp, temp);
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -16101,6 +16737,10 @@ Parrot_gt_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     VTABLE_set_integer_native(interp, temp, ICONST(2));
     if ((VTABLE_cmp(interp, PREG(1), temp) > 0)) {
         Parrot_pmc_free_temporary(interp, temp);
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -16111,6 +16751,10 @@ Parrot_gt_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_gt_p_n_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((VTABLE_get_number(interp, PREG(1)) > NREG(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -16120,6 +16764,10 @@ Parrot_gt_p_n_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_gt_p_nc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((VTABLE_get_number(interp, PREG(1)) > NCONST(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -16129,6 +16777,10 @@ Parrot_gt_p_nc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_gt_p_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SREG(2)) > 0)) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -16138,6 +16790,10 @@ Parrot_gt_p_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_gt_p_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SCONST(2)) > 0)) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -16147,6 +16803,10 @@ Parrot_gt_p_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_gt_str_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((VTABLE_cmp_string(interp, PREG(1), PREG(2)) > 0)) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -16156,6 +16816,10 @@ Parrot_gt_str_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_gt_num_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((VTABLE_cmp_num(interp, PREG(1), PREG(2)) > 0)) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -16165,6 +16829,10 @@ Parrot_gt_num_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_ge_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((VTABLE_cmp(interp, PREG(1), PREG(2)) >= 0)) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -16178,6 +16846,10 @@ Parrot_ge_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     VTABLE_set_integer_native(interp, temp, IREG(2));
     if ((VTABLE_cmp(interp, PREG(1), temp) >= 0)) {
         Parrot_pmc_free_temporary(interp, temp);
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -16192,6 +16864,10 @@ Parrot_ge_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     VTABLE_set_integer_native(interp, temp, ICONST(2));
     if ((VTABLE_cmp(interp, PREG(1), temp) >= 0)) {
         Parrot_pmc_free_temporary(interp, temp);
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -16202,6 +16878,10 @@ Parrot_ge_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_ge_p_n_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((VTABLE_get_number(interp, PREG(1)) >= NREG(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -16211,6 +16891,10 @@ Parrot_ge_p_n_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_ge_p_nc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((VTABLE_get_number(interp, PREG(1)) >= NCONST(2))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -16220,6 +16904,10 @@ Parrot_ge_p_nc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_ge_p_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SREG(2)) >= 0)) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -16229,6 +16917,10 @@ Parrot_ge_p_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_ge_p_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SCONST(2)) >= 0)) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -16238,6 +16930,10 @@ Parrot_ge_p_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_ge_str_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((VTABLE_cmp_string(interp, PREG(1), PREG(2)) >= 0)) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -16247,6 +16943,10 @@ Parrot_ge_str_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_ge_num_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((VTABLE_cmp_num(interp, PREG(1), PREG(2)) >= 0)) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(3))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(3)));
+        }
+
         return cur_opcode + ICONST(3);
     }
 
@@ -16256,6 +16956,10 @@ Parrot_ge_num_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_if_null_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if (PMC_IS_NULL(PREG(1))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(2))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(2)));
+        }
+
         return cur_opcode + ICONST(2);
     }
 
@@ -16265,6 +16969,10 @@ Parrot_if_null_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_if_null_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if (STRING_IS_NULL(SREG(1))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(2))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(2)));
+        }
+
         return cur_opcode + ICONST(2);
     }
 
@@ -16274,6 +16982,10 @@ Parrot_if_null_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_unless_null_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((!PMC_IS_NULL(PREG(1)))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(2))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(2)));
+        }
+
         return cur_opcode + ICONST(2);
     }
 
@@ -16283,6 +16995,10 @@ Parrot_unless_null_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_unless_null_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     if ((!STRING_IS_NULL(SREG(1)))) {
+        if (PARROT_CX_BRANCH_POLLS_QUANTUM(interp, ICONST(2))) {
+            return (opcode_t *)Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(2)));
+        }
+
         return cur_opcode + ICONST(2);
     }
 
@@ -19160,7 +19876,45 @@ Parrot_getattribute_p_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
 
 opcode_t *
 Parrot_getattribute_p_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_attr_str(interp, PREG(2), SCONST(3));
+    PREG(1) = Parrot_oo_get_attr_str_cached(interp, PREG(2), (&SCONST(3)));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_getattribute_i_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_oo_get_attr_int_cached(interp, PREG(2), (&SREG(3)));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_getattribute_i_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_oo_get_attr_int_cached(interp, PREG(2), (&SCONST(3)));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_getattribute_n_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = Parrot_oo_get_attr_num_cached(interp, PREG(2), (&SREG(3)));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_getattribute_n_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = Parrot_oo_get_attr_num_cached(interp, PREG(2), (&SCONST(3)));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_getattribute_s_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_oo_get_attr_string_cached(interp, PREG(2), (&SREG(3)));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_getattribute_s_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_oo_get_attr_string_cached(interp, PREG(2), (&SCONST(3)));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 4;
 }
@@ -19201,7 +19955,79 @@ Parrot_setattribute_p_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
 
 opcode_t *
 Parrot_setattribute_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_attr_str(interp, PREG(1), SCONST(2), PREG(3));
+    Parrot_oo_set_attr_str_cached(interp, PREG(1), (&SCONST(2)), PREG(3));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_setattribute_p_s_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_oo_set_attr_int_cached(interp, PREG(1), (&SREG(2)), IREG(3));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_setattribute_p_sc_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_oo_set_attr_int_cached(interp, PREG(1), (&SCONST(2)), IREG(3));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_setattribute_p_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_oo_set_attr_int_cached(interp, PREG(1), (&SREG(2)), ICONST(3));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_setattribute_p_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_oo_set_attr_int_cached(interp, PREG(1), (&SCONST(2)), ICONST(3));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_setattribute_p_s_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_oo_set_attr_num_cached(interp, PREG(1), (&SREG(2)), NREG(3));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_setattribute_p_sc_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_oo_set_attr_num_cached(interp, PREG(1), (&SCONST(2)), NREG(3));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_setattribute_p_s_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_oo_set_attr_num_cached(interp, PREG(1), (&SREG(2)), NCONST(3));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_setattribute_p_sc_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_oo_set_attr_num_cached(interp, PREG(1), (&SCONST(2)), NCONST(3));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_setattribute_p_s_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_oo_set_attr_string_cached(interp, PREG(1), (&SREG(2)), SREG(3));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_setattribute_p_sc_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_oo_set_attr_string_cached(interp, PREG(1), (&SCONST(2)), SREG(3));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_setattribute_p_s_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_oo_set_attr_string_cached(interp, PREG(1), (&SREG(2)), SCONST(3));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_setattribute_p_sc_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_oo_set_attr_string_cached(interp, PREG(1), (&SCONST(2)), SCONST(3));
     return cur_opcode + 4;
 }
 
@@ -24515,7 +25341,7 @@ Parrot_receive_p(opcode_t *cur_opcode, PARROT_INTERP) {
             UNLOCK(pdata->mailbox_lock);
             {
                 PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-                return (opcode_t *)0;
+                return (opcode_t *)Parrot_cx_switch_task(interp, interp->scheduler);
             }
 
         }
@@ -24542,7 +25368,7 @@ Parrot_receive_p(opcode_t *cur_opcode, PARROT_INTERP) {
             (void)Parrot_cx_stop_task(interp, cur_opcode);
             {
                 PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-                return (opcode_t *)0;
+                return (opcode_t *)Parrot_cx_switch_task(interp, interp->scheduler);
             }
 
         }
@@ -24560,7 +25386,7 @@ Parrot_wait_p(opcode_t *cur_opcode, PARROT_INTERP) {
     PMC  * cur_task;
     Parrot_Task_attributes  * tdata;
 
-    if ((!VTABLE_isa(interp, task, Parrot_str_new_constant(interp, "Task")))) {
+    if (((task->vtable->base_type != enum_class_Task) && (!VTABLE_isa(interp, task, Parrot_str_new_constant(interp, "Task"))))) {
         Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, "Argument to wait op must be a Task.\n");
     }
 
@@ -24579,7 +25405,7 @@ Parrot_wait_p(opcode_t *cur_opcode, PARROT_INTERP) {
 
     VTABLE_push_pmc(interp, tdata->waiters, cur_task);
     UNLOCK(tdata->waiters_lock);
-    return (opcode_t *)0;
+    return (opcode_t *)Parrot_cx_switch_task(interp, interp->scheduler);
     return cur_opcode + 2;
 }
 
@@ -24590,7 +25416,7 @@ Parrot_wait_pc(opcode_t *cur_opcode, PARROT_INTERP) {
     PMC  * cur_task;
     Parrot_Task_attributes  * tdata;
 
-    if ((!VTABLE_isa(interp, task, Parrot_str_new_constant(interp, "Task")))) {
+    if (((task->vtable->base_type != enum_class_Task) && (!VTABLE_isa(interp, task, Parrot_str_new_constant(interp, "Task"))))) {
         Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, "Argument to wait op must be a Task.\n");
     }
 
@@ -24609,7 +25435,7 @@ Parrot_wait_pc(opcode_t *cur_opcode, PARROT_INTERP) {
 
     VTABLE_push_pmc(interp, tdata->waiters, cur_task);
     UNLOCK(tdata->waiters_lock);
-    return (opcode_t *)0;
+    return (opcode_t *)Parrot_cx_switch_task(interp, interp->scheduler);
     return cur_opcode + 2;
 }
 
@@ -24634,6 +25460,18 @@ Parrot_enable_preemption(opcode_t *cur_opcode, PARROT_INTERP) {
     return cur_opcode + 1;
 }
 
+opcode_t *
+Parrot_green_threads_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_cx_set_green_threads(interp, IREG(1));
+    return cur_opcode + 2;
+}
+
+opcode_t *
+Parrot_green_threads_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_cx_set_green_threads(interp, ICONST(1));
+    return cur_opcode + 2;
+}
+
 opcode_t *
 Parrot_terminate(opcode_t *cur_opcode, PARROT_INTERP) {
     UNUSED(interp);
@@ -24642,6 +25480,20 @@ Parrot_terminate(opcode_t *cur_opcode, PARROT_INTERP) {
     return cur_opcode + 1;
 }
 
+opcode_t *
+Parrot_intern_s_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_intern(interp, SREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_intern_s_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_intern(interp, SCONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
+}
+
 
 /*
 ** op lib descriptor:
@@ -24655,7 +25507,7 @@ op_lib_t core_op_lib = {
   0,                                /* flags */
   PARROT_PBC_MAJOR,
   PARROT_PBC_MINOR,
-  1129,             /* op_count */
+  1151,             /* op_count */
   core_op_info_table,       /* op_info_table */
   core_op_func_table,       /* op_func_table */
   get_op          /* op_code() */ 
@@ -30,12 +30,22 @@ format of bytecode.
 #include "api.str"
 #include "pmc/pmc_sub.h"
 #include "pmc/pmc_packfileview.h"
+#include "parrot/oplib/ops.h"
 
 /* HEADERIZER HFILE: include/parrot/packfile.h */
 
 /* HEADERIZER BEGIN: static */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
+PARROT_CANNOT_RETURN_NULL
+static PMC * annotation_value(PARROT_INTERP,
+    ARGIN(PackFile_Annotations *self),
+    ARGIN(PackFile_Annotations_Key *key),
+    opcode_t offset)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
 static void compile_file(PARROT_INTERP, ARGIN(STRING *path), INTVAL is_pasm)
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
@@ -54,6 +64,14 @@ static PackFile_Segment * create_seg(PARROT_INTERP,
         __attribute__nonnull__(5)
         FUNC_MODIFIES(*dir);
 
+PARROT_WARN_UNUSED_RESULT
+static opcode_t debug_op_size(PARROT_INTERP,
+    ARGIN(PackFile_ByteCode *code),
+    ARGIN(opcode_t *pc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
 static PMC* do_1_sub_pragma(PARROT_INTERP,
@@ -161,6 +179,10 @@ static int sub_pragma(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(3);
 
+#define ASSERT_ARGS_annotation_value __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(key))
 #define ASSERT_ARGS_compile_file __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(path))
@@ -169,6 +191,10 @@ static int sub_pragma(PARROT_INTERP,
     , PARROT_ASSERT_ARG(dir) \
     , PARROT_ASSERT_ARG(name) \
     , PARROT_ASSERT_ARG(file_name))
+#define ASSERT_ARGS_debug_op_size __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(code) \
+    , PARROT_ASSERT_ARG(pc))
 #define ASSERT_ARGS_do_1_sub_pragma __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(sub_pmc))
@@ -1844,18 +1870,141 @@ Parrot_debug_pc_to_filename(PARROT_INTERP, ARGIN(const PackFile_Debug *debug),
     /* Look through mappings until we find one that maps the passed
        bytecode offset. */
 
-    int i;
-    for (i = 0; i < debug->num_mappings; ++i) {
-        /* If this is the last mapping or the current position is
-           between this mapping and the next one, return a filename. */
-       if (i + 1 == debug->num_mappings
-       || (debug->mappings[i].offset     <= pc
-       &&  debug->mappings[i + 1].offset >  pc))
-            return debug->code->const_table->str.constants[debug->mappings[i].filename];
+    /* The mappings are sorted by offset, so search for the last one that
+       starts at or before pc. A pc before the first mapping gets the last
+       mapping's filename. */
+    opcode_t lo = 0, hi = debug->num_mappings;
+
+    /* No mappings == no filename. */
+    if (!debug->num_mappings)
+        return CONST_STRING(interp, "(unknown file)");
+
+    while (lo < hi) {
+        const opcode_t mid = lo + (hi - lo) / 2;
+
+        if (debug->mappings[mid].offset <= pc)
+            lo = mid + 1;
+        else
+            hi = mid;
     }
 
-    /* Otherwise, no mappings == no filename. */
-    return CONST_STRING(interp, "(unknown file)");
+    if (lo == 0)
+        lo = debug->num_mappings;
+
+    return debug->code->const_table->str.constants[debug->mappings[lo - 1].filename];
+}
+
+
+/*
+
+=item C<INTVAL Parrot_pf_debug_op_index(PARROT_INTERP, PackFile_Debug *debug,
+opcode_t offset)>
+
+Returns the number of the first op in the code segment of C<debug> that
+starts at or after the code offset C<offset>, which is also the index of its
+line number in C<debug>. Returns -1 if there is no such op or it has no line
+number.
+
+Finding an op number needs the code to be decoded from its start. The start
+offsets of the ops are kept in a table in C<debug>, which is extended only as
+far as the offsets asked for, so code still being written by the compiler is
+never decoded; lookups within the table are binary searches. Threads share
+code segments, so they decode the code each time instead.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+INTVAL
+Parrot_pf_debug_op_index(PARROT_INTERP, ARGMOD(PackFile_Debug *debug), opcode_t offset)
+{
+    ASSERT_ARGS(Parrot_pf_debug_op_index)
+    PackFile_ByteCode * const code = debug->code;
+    size_t                    lo, hi;
+    opcode_t                  next;
+
+    if (Interp_flags_TEST(interp, PARROT_IS_THREAD)) {
+        size_t i;
+
+        for (i = 0, next = 0; (size_t)next < code->base.size; ++i) {
+            if (i >= debug->base.size)
+                return -1;
+            if (next >= offset)
+                return i;
+            next += debug_op_size(interp, code, code->base.data + next);
+        }
+
+        return -1;
+    }
+
+    /* The compiler resizes the line numbers as it adds code. */
+    if (debug->op_offsets_size != debug->base.size) {
+        debug->op_offsets      = mem_gc_realloc_n_typed(interp, debug->op_offsets,
+                                    debug->base.size, opcode_t);
+        debug->op_offsets_size = debug->base.size;
+        if (debug->num_op_offsets > debug->op_offsets_size)
+            debug->num_op_offsets = debug->op_offsets_size;
+    }
+
+    hi = debug->num_op_offsets;
+
+    if (!hi || debug->op_offsets[hi - 1] < offset) {
+        next = hi ? debug->op_offsets[hi - 1]
+                  + debug_op_size(interp, code, code->base.data + debug->op_offsets[hi - 1])
+                  : 0;
+
+        while ((size_t)next < code->base.size
+        &&      debug->num_op_offsets < debug->op_offsets_size) {
+            debug->op_offsets[debug->num_op_offsets++] = next;
+            if (next >= offset)
+                break;
+            next += debug_op_size(interp, code, code->base.data + next);
+        }
+
+        hi = debug->num_op_offsets;
+        if (!hi || debug->op_offsets[hi - 1] < offset)
+            return -1;
+    }
+
+    lo = 0;
+    while (lo < hi) {
+        const size_t mid = lo + (hi - lo) / 2;
+
+        if (debug->op_offsets[mid] < offset)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    return lo;
+}
+
+
+/*
+
+=item C<static opcode_t debug_op_size(PARROT_INTERP, PackFile_ByteCode *code,
+opcode_t *pc)>
+
+Returns the size of the op at C<pc> in C<code>, including any variable
+arguments.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static opcode_t
+debug_op_size(PARROT_INTERP, ARGIN(PackFile_ByteCode *code), ARGIN(opcode_t *pc))
+{
+    ASSERT_ARGS(debug_op_size)
+    const op_info_t * const op_info  = code->op_info_table[*pc];
+    opcode_t                var_args = 0;
+
+    ADD_OP_VAR_PART(interp, code, pc, var_args);
+
+    return op_info->op_count + var_args;
 }
 
 
@@ -2066,55 +2215,71 @@ PackFile_Annotations_lookup(PARROT_INTERP, ARGIN(PackFile_Annotations *self),
         opcode_t offset, ARGIN_NULLOK(STRING *name))
 {
     ASSERT_ARGS(PackFile_Annotations_lookup)
+    STRING ** const constants = self->code->const_table->str.constants;
+    INTVAL i;
 
     if (STRING_IS_NULL(name)) {
         /* find all annotations for this offset */
         PMC * const result = Parrot_pmc_new(interp, enum_class_Hash);
-        INTVAL i;
         for (i = 0; i < self->num_keys; i++) {
-            STRING * const k = self->code->const_table->str.constants[self->keys[i].name];
-            PMC    * const v = PackFile_Annotations_lookup(interp, self, offset, k);
+            PackFile_Annotations_Key * const key = &self->keys[i];
+            PMC * const v = annotation_value(interp, self, key, offset);
             if (!PMC_IS_NULL(v))
-                VTABLE_set_pmc_keyed_str(interp, result, k, v);
+                VTABLE_set_pmc_keyed_str(interp, result, constants[key->name], v);
         }
 
         return result;
     }
 
-    else {
-        PackFile_Annotations_Key *key = NULL;
-        INTVAL i;
-        opcode_t val;
+    /* Names usually come from the same constant table, so try the
+     * pointers before comparing the strings. */
+    for (i = 0; i < self->num_keys; i++)
+        if (constants[self->keys[i].name] == name)
+            return annotation_value(interp, self, &self->keys[i], offset);
 
-        for (i = 0; i < self->num_keys; i++) {
-            STRING * const test_key = self->code->const_table->str.constants[self->keys[i].name];
-            if (STRING_equal(interp, test_key, name)) {
-                key = &self->keys[i];
-                break;
-            }
-        }
+    for (i = 0; i < self->num_keys; i++)
+        if (STRING_equal(interp, constants[self->keys[i].name], name))
+            return annotation_value(interp, self, &self->keys[i], offset);
 
-        if (!key)
-            return PMCNULL; /* no such key */
+    return PMCNULL; /* no such key */
+}
 
-        i = find_pf_ann_idx(self, key, offset);
+/*
 
-        if (i < 0)
-            return PMCNULL; /* no active entry */
+=item C<static PMC * annotation_value(PARROT_INTERP, PackFile_Annotations *self,
+PackFile_Annotations_Key *key, opcode_t offset)>
 
-        val = self->base.data[i * 2 + ANN_ENTRY_VAL];
+Returns the value of annotation C<key> in force at the given bytecode offset,
+or a NULL PMC if there is none.
 
-        switch (key->type) {
-          case PF_ANNOTATION_KEY_TYPE_INT:
-            return Parrot_pmc_box_integer(interp, val);
-          case PF_ANNOTATION_KEY_TYPE_STR:
-            return Parrot_pmc_box_string(interp, self->code->const_table->str.constants[val]);
-          case PF_ANNOTATION_KEY_TYPE_PMC:
-            return self->code->const_table->pmc.constants[val];
-          default:
-            Parrot_warn(interp, PARROT_WARNINGS_ALL_FLAG, "unexpected annotation type found");
-            return PMCNULL;
-        }
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+static PMC *
+annotation_value(PARROT_INTERP, ARGIN(PackFile_Annotations *self),
+        ARGIN(PackFile_Annotations_Key *key), opcode_t offset)
+{
+    ASSERT_ARGS(annotation_value)
+    const INTVAL i = find_pf_ann_idx(self, key, offset);
+    opcode_t     val;
+
+    if (i < 0)
+        return PMCNULL; /* no active entry */
+
+    val = self->base.data[i * 2 + ANN_ENTRY_VAL];
+
+    switch (key->type) {
+      case PF_ANNOTATION_KEY_TYPE_INT:
+        return Parrot_pmc_box_integer(interp, val);
+      case PF_ANNOTATION_KEY_TYPE_STR:
+        return Parrot_pmc_box_string(interp, self->code->const_table->str.constants[val]);
+      case PF_ANNOTATION_KEY_TYPE_PMC:
+        return self->code->const_table->pmc.constants[val];
+      default:
+        Parrot_warn(interp, PARROT_WARNINGS_ALL_FLAG, "unexpected annotation type found");
+        return PMCNULL;
     }
 }
 
@@ -22,7 +22,10 @@ individual action vtable (freeze/thaw) is then called for all todo-PMCs.
 */
 
 #include "parrot/parrot.h"
+#include "parrot/extend.h"
 #include "pmc/pmc_callcontext.h"
+#include "pmc/pmc_imageiofreeze.h"
+#include "pmc/pmc_imageiothaw.h"
 #include "object_serialization.str"
 
 /* when thawing a string longer then this size, we first do a GC run and then
@@ -32,6 +35,25 @@ individual action vtable (freeze/thaw) is then called for all todo-PMCs.
 
 /* HEADERIZER HFILE: include/parrot/pmc_freeze.h */
 
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+PARROT_DOES_NOT_RETURN
+static void thaw_from_handle_catch(PARROT_INTERP,
+    ARGIN_NULLOK(PMC *exception),
+    ARGIN_NULLOK(void *info))
+        __attribute__nonnull__(1);
+
+static void thaw_from_handle_try(PARROT_INTERP, ARGIN_NULLOK(void *info))
+        __attribute__nonnull__(1);
+
+#define ASSERT_ARGS_thaw_from_handle_catch __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_thaw_from_handle_try __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
 /*
 
 =head2 Public Interface
@@ -59,6 +81,38 @@ Parrot_freeze(PARROT_INTERP, ARGIN(PMC *pmc))
 }
 
 
+/*
+
+=item C<void Parrot_freeze_to_handle(PARROT_INTERP, PMC *pmc, PMC *handle,
+INTVAL flags)>
+
+Freezes C<pmc> and writes the image to the IO handle C<handle> as it goes,
+in the compact streaming format, rather than building it in memory first.
+With C<FREEZE_STREAM_TREE> in C<flags> the graph is assumed to be a tree and
+the writer keeps no seen hash; the reader still lists every PMC it thaws.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_freeze_to_handle(PARROT_INTERP, ARGIN(PMC *pmc), ARGMOD(PMC *handle),
+        INTVAL flags)
+{
+    ASSERT_ARGS(Parrot_freeze_to_handle)
+    PMC * const image = Parrot_pmc_new(interp, enum_class_ImageIOFreeze);
+
+    if (PMC_IS_NULL(handle))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_PIO_ERROR,
+            "Cannot freeze to a null handle");
+
+    PARROT_IMAGEIOFREEZE(image)->handle       = handle;
+    PARROT_IMAGEIOFREEZE(image)->stream_flags = flags;
+    VTABLE_set_pmc(interp, image, pmc);
+}
+
+
 /*
 
 =item C<opcode_t * Parrot_freeze_pbc(PARROT_INTERP, PMC *pmc, const
@@ -242,6 +296,49 @@ Parrot_thaw(PARROT_INTERP, ARGIN(STRING *image))
 }
 
 
+/*
+
+=item C<PMC* Parrot_thaw_from_handle(PARROT_INTERP, PMC *handle)>
+
+Thaws a PMC from the streaming image read incrementally from C<handle>, as
+written by C<Parrot_freeze_to_handle>. Only the bytes of the image are
+consumed from the handle.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+PMC*
+Parrot_thaw_from_handle(PARROT_INTERP, ARGMOD(PMC *handle))
+{
+    ASSERT_ARGS(Parrot_thaw_from_handle)
+    PMC * const info = Parrot_pmc_new(interp, enum_class_ImageIOThaw);
+    PMC        *result;
+
+    if (PMC_IS_NULL(handle))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_PIO_ERROR,
+            "Cannot thaw from a null handle");
+
+    /* as in Parrot_thaw, half-thawed PMCs must not be seen by the GC; a
+     * malformed stream throws, so make sure the GC gets unblocked again */
+    Parrot_block_GC_mark(interp);
+    Parrot_block_GC_sweep(interp);
+
+    PARROT_IMAGEIOTHAW(info)->handle = handle;
+    Parrot_ext_try(interp, thaw_from_handle_try, thaw_from_handle_catch, info);
+    result = VTABLE_get_pmc(interp, info);
+
+    Parrot_unblock_GC_mark(interp);
+    Parrot_unblock_GC_sweep(interp);
+
+    return result;
+}
+
+
+
 /*
 
 =item C<PMC* Parrot_thaw_pbc(PARROT_INTERP, PackFile_ConstTable *ct, const
@@ -312,6 +409,57 @@ Parrot_clone(PARROT_INTERP, ARGIN(PMC *pmc))
 }
 
 
+/*
+
+=back
+
+=head2 Internal functions
+
+=over 4
+
+=item C<static void thaw_from_handle_try(PARROT_INTERP, void *info)>
+
+Runs the streaming thaw of the ImageIOThaw C<info>.
+
+=cut
+
+*/
+
+static void
+thaw_from_handle_try(PARROT_INTERP, ARGIN_NULLOK(void *info))
+{
+    ASSERT_ARGS(thaw_from_handle_try)
+    PMC * const image = (PMC *)info;
+
+    VTABLE_set_pmc(interp, image, PARROT_IMAGEIOTHAW(image)->handle);
+}
+
+
+/*
+
+=item C<static void thaw_from_handle_catch(PARROT_INTERP, PMC *exception, void
+*info)>
+
+Unblocks the GC after a failed streaming thaw and passes the exception on.
+
+=cut
+
+*/
+
+PARROT_DOES_NOT_RETURN
+static void
+thaw_from_handle_catch(PARROT_INTERP, ARGIN_NULLOK(PMC *exception),
+        ARGIN_NULLOK(void *info))
+{
+    ASSERT_ARGS(thaw_from_handle_catch)
+    UNUSED(info)
+
+    Parrot_unblock_GC_mark(interp);
+    Parrot_unblock_GC_sweep(interp);
+    Parrot_ex_rethrow_from_c(interp, exception);
+}
+
+
 /*
 
 =back
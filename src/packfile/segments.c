@@ -17,6 +17,7 @@ Functions in this file represent behaviors for different PackFile segments.
 
 #include "parrot/parrot.h"
 #include "pf_private.h"
+#include "parrot/runcore_api.h"
 #include "pmc/pmc_parrotlibrary.h"
 #include "segments.str"
 
@@ -346,6 +347,12 @@ PackFile_ConstTable_clear(PARROT_INTERP, ARGMOD(PackFile_ConstTable *self))
         self->ntags = 0;
     }
 
+    if (self->attrib_cache) {
+        mem_gc_free(interp, self->attrib_cache);
+        self->attrib_cache      = NULL;
+        self->attrib_cache_size = 0;
+    }
+
     return;
 }
 
@@ -409,8 +416,10 @@ PackFile_ConstTable_unpack(PARROT_INTERP, ARGMOD(PackFile_Segment *seg),
     for (i = 0; i < self->num.const_count; i++)
         self->num.constants[i] = PF_fetch_number(pf, &cursor);
 
+    /* Share equal string constants between packfiles */
     for (i = 0; i < self->str.const_count; i++)
-        self->str.constants[i] = PF_fetch_string(interp, pf, &cursor);
+        self->str.constants[i] = Parrot_str_intern(interp,
+                                    PF_fetch_string(interp, pf, &cursor));
 
     for (i = 0; i < self->pmc.const_count; i++)
         self->pmc.constants[i] = PackFile_Constant_unpack_pmc(interp, self, &cursor);
@@ -1720,6 +1729,9 @@ byte_code_destroy(PARROT_INTERP, ARGMOD(PackFile_Segment *self))
     if (byte_code->annotations)
         PackFile_Annotations_destroy(interp, (PackFile_Segment *)byte_code->annotations);
 
+    if (byte_code->exec_code)
+        Parrot_runcore_exec_free_code(interp, byte_code);
+
     byte_code->annotations     = NULL;
     byte_code->const_table     = NULL;
     byte_code->debugs          = NULL;
@@ -2007,6 +2019,11 @@ pf_debug_destroy(PARROT_INTERP, ARGMOD(PackFile_Segment *self))
     mem_gc_free(interp, debug->mappings);
     debug->mappings     = NULL;
     debug->num_mappings = 0;
+
+    mem_gc_free(interp, debug->op_offsets);
+    debug->op_offsets      = NULL;
+    debug->op_offsets_size = 0;
+    debug->num_op_offsets  = 0;
 }
 
 
@@ -0,0 +1,900 @@
+/*
+Copyright (C) 2014, Parrot Foundation.
+
+=head1 NAME
+
+src/parallel.c - Data parallel operations on arrays
+
+=head1 DESCRIPTION
+
+Bulk operations that split an array into chunks and run a Sub over the
+chunks on the thread interpreters at the same time. The array PMCs expose
+them as C<parallel_map>, C<parallel_each>, C<parallel_reduce> and
+C<parallel_sort>.
+
+The interpreter starting a job schedules one Task per worker thread and
+waits. The Task's code is a native function, which gets its own copy of the
+Sub with C<Parrot_thread_create_proxy> and then claims chunks until none
+are left, so a slow chunk doesn't hold up a whole thread's share. Results
+are written straight into the array's storage: only native values are
+written, so no worker ever stores one of its own PMCs into another
+interpreter's heap. PMC elements are handed to the Sub as proxies.
+
+Arrays too small to be worth splitting, and jobs started from a thread or
+with green threads enabled, run on the current interpreter instead.
+
+Only a plain Sub can be copied to a thread, so that's all a job takes.
+Closures and Subs with C<:outer> would reach their outer lexicals through a
+proxy, and MultiSubs, NCI subs, objects and other invokables would arrive as
+proxies that can't be invoked. They are rejected up front, however small the
+array, so a job doesn't work or fail depending on its size.
+
+Reductions reduce each chunk and then the chunk results, in order, so the
+Sub has to be associative. Sorting is a stable merge sort: the chunks are
+sorted in parallel and the sorted runs are merged by the interpreter that
+started the job.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/thread.h"
+#include "parrot/scheduler_private.h"
+#include "pmc/pmc_proxy.h"
+#include "pmc/pmc_sub.h"
+#include "pmc/pmc_task.h"
+
+/* HEADERIZER HFILE: include/parrot/thread.h */
+
+/* Fewest elements a worker gets; smaller arrays aren't split */
+#define PARALLEL_MIN_CHUNK 1024
+
+/* Chunks per worker, for everything but sorting */
+#define PARALLEL_CHUNKS_PER_WORKER 4
+
+/* Runs this short are sorted by insertion before merging */
+#define PARALLEL_INSERTION_RUN 8
+
+typedef enum {
+    PARALLEL_MAP,
+    PARALLEL_EACH,
+    PARALLEL_REDUCE,
+    PARALLEL_SORT
+} parallel_op_enum;
+
+typedef struct Parrot_parallel_job {
+    Parrot_Interp          interp;      /* the interpreter that started the job */
+    parallel_op_enum       op;
+    INTVAL                 type;        /* enum_type_INTVAL, _FLOATVAL or _PMC */
+    size_t                 item_size;
+    char                  *items;       /* the array's storage */
+    char                  *scratch;     /* merge buffer, as big as items */
+    char                  *results;     /* one reduction result per chunk */
+    INTVAL                 size;
+    PMC                   *sub;
+    INTVAL                 chunks;
+    INTVAL                 chunk_size;
+    Parrot_atomic_integer  claimed;     /* chunks claimed by workers so far */
+    INTVAL                 running;     /* workers that haven't finished */
+    char                  *error;       /* message of the first exception */
+    Parrot_mutex           lock;
+    Parrot_cond            done;
+} Parrot_parallel_job;
+
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+static INTVAL parallel_compare(PARROT_INTERP,
+    ARGIN(const Parrot_parallel_job *job),
+    ARGIN(PMC *cmp),
+    ARGIN(const char *a),
+    ARGIN(const char *b))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        __attribute__nonnull__(5);
+
+static void parallel_failed(PARROT_INTERP,
+    ARGIN_NULLOK(PMC *exception),
+    ARGIN_NULLOK(void *data))
+        __attribute__nonnull__(1);
+
+static void parallel_fold(PARROT_INTERP,
+    ARGIN(const Parrot_parallel_job *job),
+    ARGIN(PMC *sub),
+    ARGMOD(char *acc),
+    ARGIN(const char *item))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        __attribute__nonnull__(5)
+        FUNC_MODIFIES(*acc);
+
+static void parallel_job_init(PARROT_INTERP,
+    ARGOUT(Parrot_parallel_job *job),
+    parallel_op_enum op,
+    INTVAL type,
+    ARGIN_NULLOK(void *items),
+    INTVAL size,
+    ARGIN_NULLOK(PMC *sub))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*job);
+
+PARROT_CANNOT_RETURN_NULL
+static PMC * parallel_local(PARROT_INTERP,
+    ARGIN(const Parrot_parallel_job *job),
+    ARGIN_NULLOK(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void parallel_merge(PARROT_INTERP,
+    ARGIN(const Parrot_parallel_job *job),
+    ARGIN(PMC *cmp),
+    ARGIN(const char *src),
+    ARGOUT(char *dest),
+    INTVAL left,
+    INTVAL mid,
+    INTVAL right)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        __attribute__nonnull__(5)
+        FUNC_MODIFIES(*dest);
+
+static void parallel_run(PARROT_INTERP, ARGMOD(Parrot_parallel_job *job))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*job);
+
+static void parallel_run_chunk(PARROT_INTERP,
+    ARGMOD(Parrot_parallel_job *job),
+    ARGIN(PMC *sub),
+    INTVAL chunk)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*job);
+
+static void parallel_sort_run(PARROT_INTERP,
+    ARGIN(const Parrot_parallel_job *job),
+    ARGIN(PMC *cmp),
+    INTVAL from,
+    INTVAL to)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+static void parallel_work(PARROT_INTERP, ARGIN_NULLOK(void *data))
+        __attribute__nonnull__(1);
+
+static void parallel_worker(PARROT_INTERP, PMC *self)
+        __attribute__nonnull__(1);
+
+static INTVAL parallel_workers(PARROT_INTERP, INTVAL size)
+        __attribute__nonnull__(1);
+
+#define ASSERT_ARGS_parallel_compare __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(job) \
+    , PARROT_ASSERT_ARG(cmp) \
+    , PARROT_ASSERT_ARG(a) \
+    , PARROT_ASSERT_ARG(b))
+#define ASSERT_ARGS_parallel_failed __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_parallel_fold __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(job) \
+    , PARROT_ASSERT_ARG(sub) \
+    , PARROT_ASSERT_ARG(acc) \
+    , PARROT_ASSERT_ARG(item))
+#define ASSERT_ARGS_parallel_job_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(job))
+#define ASSERT_ARGS_parallel_local __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(job))
+#define ASSERT_ARGS_parallel_merge __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(job) \
+    , PARROT_ASSERT_ARG(cmp) \
+    , PARROT_ASSERT_ARG(src) \
+    , PARROT_ASSERT_ARG(dest))
+#define ASSERT_ARGS_parallel_run __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(job))
+#define ASSERT_ARGS_parallel_run_chunk __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(job) \
+    , PARROT_ASSERT_ARG(sub))
+#define ASSERT_ARGS_parallel_sort_run __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(job) \
+    , PARROT_ASSERT_ARG(cmp))
+#define ASSERT_ARGS_parallel_work __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_parallel_worker __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_parallel_workers __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+/*
+
+=item C<void Parrot_parallel_map(PARROT_INTERP, INTVAL type, void *items, INTVAL
+size, PMC *sub)>
+
+Replaces each of the C<size> native values of C<type> (C<enum_type_INTVAL>
+or C<enum_type_FLOATVAL>) at C<items> with the result of calling C<sub> on
+it.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_parallel_map(PARROT_INTERP, INTVAL type, ARGMOD_NULLOK(void *items), INTVAL size,
+        ARGIN(PMC *sub))
+{
+    ASSERT_ARGS(Parrot_parallel_map)
+    Parrot_parallel_job job;
+
+    parallel_job_init(interp, &job, PARALLEL_MAP, type, items, size, sub);
+    parallel_run(interp, &job);
+}
+
+/*
+
+=item C<void Parrot_parallel_each(PARROT_INTERP, INTVAL type, void *items,
+INTVAL size, PMC *sub)>
+
+Calls C<sub> on each of the C<size> values of C<type> at C<items>, which
+may also be C<enum_type_PMC>. The array isn't changed.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_parallel_each(PARROT_INTERP, INTVAL type, ARGIN_NULLOK(void *items), INTVAL size,
+        ARGIN(PMC *sub))
+{
+    ASSERT_ARGS(Parrot_parallel_each)
+    Parrot_parallel_job job;
+
+    parallel_job_init(interp, &job, PARALLEL_EACH, type, items, size, sub);
+    parallel_run(interp, &job);
+}
+
+/*
+
+=item C<void Parrot_parallel_reduce(PARROT_INTERP, INTVAL type, void *items,
+INTVAL size, PMC *sub, void *acc, INTVAL has_acc)>
+
+Reduces the C<size> native values of C<type> at C<items> with C<sub>, which
+takes two values and returns one, into C<*acc>. If C<has_acc> is set,
+C<*acc> is the initial value, otherwise the array must not be empty.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_parallel_reduce(PARROT_INTERP, INTVAL type, ARGIN_NULLOK(void *items), INTVAL size,
+        ARGIN(PMC *sub), ARGMOD(void *acc), INTVAL has_acc)
+{
+    ASSERT_ARGS(Parrot_parallel_reduce)
+    Parrot_parallel_job job;
+    INTVAL chunk = 0;
+
+    if (size == 0) {
+        if (!has_acc)
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+                "parallel_reduce: empty array and no initial value");
+        return;
+    }
+
+    parallel_job_init(interp, &job, PARALLEL_REDUCE, type, items, size, sub);
+    parallel_run(interp, &job);
+
+    if (!has_acc) {
+        memcpy(acc, job.results, job.item_size);
+        chunk = 1;
+    }
+    for (; chunk < job.chunks; ++chunk)
+        parallel_fold(interp, &job, sub, (char *)acc, job.results + chunk * job.item_size);
+
+    mem_internal_free(job.results);
+}
+
+/*
+
+=item C<void Parrot_parallel_sort(PARROT_INTERP, INTVAL type, void *items,
+INTVAL size, PMC *cmp)>
+
+Sorts the C<size> values of C<type> at C<items>, which may also be
+C<enum_type_PMC>, in place and stably. C<cmp> returns a negative, zero or
+positive integer like the C<cmp> op; without it values are compared
+natively, or with their C<cmp> vtable.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_parallel_sort(PARROT_INTERP, INTVAL type, ARGMOD_NULLOK(void *items), INTVAL size,
+        ARGIN_NULLOK(PMC *cmp))
+{
+    ASSERT_ARGS(Parrot_parallel_sort)
+    Parrot_parallel_job job;
+    INTVAL width;
+
+    if (size < 2)
+        return;
+
+    parallel_job_init(interp, &job, PARALLEL_SORT, type, items, size, cmp);
+    job.scratch = (char *)mem_internal_allocate(size * job.item_size);
+    parallel_run(interp, &job);
+
+    /* Merge the sorted chunks pairwise until one run is left */
+    for (width = job.chunk_size; width < size; width *= 2) {
+        INTVAL left;
+        char  *swap;
+
+        for (left = 0; left < size; left += 2 * width) {
+            const INTVAL mid   = left + width < size ? left + width : size;
+            const INTVAL right = mid + width < size ? mid + width : size;
+            parallel_merge(interp, &job, job.sub, job.items, job.scratch, left, mid, right);
+        }
+
+        swap        = job.items;
+        job.items   = job.scratch;
+        job.scratch = swap;
+    }
+
+    if (job.items != (char *)items) {
+        memcpy(items, job.items, size * job.item_size);
+        job.scratch = job.items;
+    }
+    mem_internal_free(job.scratch);
+}
+
+/*
+
+=item C<static void parallel_job_init(PARROT_INTERP, Parrot_parallel_job *job,
+parallel_op_enum op, INTVAL type, void *items, INTVAL size, PMC *sub)>
+
+Sets up a job over C<items>. Throws if C<sub> is anything but a Sub without
+an outer context.
+
+=cut
+
+*/
+
+static void
+parallel_job_init(PARROT_INTERP, ARGOUT(Parrot_parallel_job *job), parallel_op_enum op,
+        INTVAL type, ARGIN_NULLOK(void *items), INTVAL size, ARGIN_NULLOK(PMC *sub))
+{
+    ASSERT_ARGS(parallel_job_init)
+
+    memset(job, 0, sizeof (Parrot_parallel_job));
+    job->interp    = interp;
+    job->op        = op;
+    job->type      = type;
+    job->items     = (char *)items;
+    job->size      = size;
+    job->sub       = sub ? sub : PMCNULL;
+
+    if (type == enum_type_INTVAL)
+        job->item_size = sizeof (INTVAL);
+    else if (type == enum_type_FLOATVAL)
+        job->item_size = sizeof (FLOATVAL);
+    else if (type == enum_type_PMC && (op == PARALLEL_EACH || op == PARALLEL_SORT))
+        job->item_size = sizeof (PMC *);
+    else
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "parallel operation not supported on these elements");
+
+    if (PMC_IS_NULL(job->sub))
+        return;
+
+    if (job->sub->vtable->base_type != enum_class_Sub)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "parallel operations need a Sub, not a %Ss",
+            VTABLE_name(interp, job->sub));
+
+    if (!PMC_IS_NULL(PARROT_SUB(job->sub)->outer_ctx))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "parallel operations can't use a closure or a Sub with :outer");
+}
+
+/*
+
+=item C<static INTVAL parallel_workers(PARROT_INTERP, INTVAL size)>
+
+Returns the number of threads a job over C<size> elements should use, or 0
+to run it on the current interpreter.
+
+=cut
+
+*/
+
+static INTVAL
+parallel_workers(PARROT_INTERP, INTVAL size)
+{
+    ASSERT_ARGS(parallel_workers)
+#ifdef PARROT_HAS_THREADS
+    INTVAL workers;
+
+    if (Interp_flags_TEST(interp, PARROT_IS_THREAD)
+    ||  !interp->scheduler
+    ||  SCHEDULER_green_threads_TEST(interp->scheduler))
+        return 0;
+
+    /* the first slot of the threads array is the main interpreter */
+    workers = Parrot_get_num_threads(interp) - 1;
+    if (workers > size / PARALLEL_MIN_CHUNK)
+        workers = size / PARALLEL_MIN_CHUNK;
+
+    return workers > 1 ? workers : 0;
+#else
+    UNUSED(interp);
+    UNUSED(size);
+    return 0;
+#endif
+}
+
+/*
+
+=item C<static void parallel_run(PARROT_INTERP, Parrot_parallel_job *job)>
+
+Splits the job into chunks and runs them, on worker threads if it's worth
+it. Rethrows the first exception thrown by the Sub in any chunk.
+
+=cut
+
+*/
+
+static void
+parallel_run(PARROT_INTERP, ARGMOD(Parrot_parallel_job *job))
+{
+    ASSERT_ARGS(parallel_run)
+    const INTVAL workers = parallel_workers(interp, job->size);
+
+    if (workers == 0) {
+        job->chunks = 1;
+    }
+    else {
+        /* Sorted chunks are merged afterwards on this thread, so sort only
+           in as many chunks as there are workers. */
+        job->chunks = job->op == PARALLEL_SORT
+                    ? workers
+                    : workers * PARALLEL_CHUNKS_PER_WORKER;
+        if (job->chunks > job->size / PARALLEL_MIN_CHUNK)
+            job->chunks = job->size / PARALLEL_MIN_CHUNK;
+    }
+    job->chunk_size = (job->size + job->chunks - 1) / job->chunks;
+    job->chunks     = (job->size + job->chunk_size - 1) / job->chunk_size;
+    if (job->op == PARALLEL_REDUCE)
+        job->results = (char *)mem_internal_allocate(job->chunks * job->item_size);
+
+    PARROT_ATOMIC_INT_INIT(job->claimed);
+    PARROT_ATOMIC_INT_SET(job->claimed, 0);
+    MUTEX_INIT(job->lock);
+    COND_INIT(job->done);
+
+    if (workers == 0)
+        Parrot_ext_try(interp, parallel_work, parallel_failed, job);
+    else {
+        PMC * const code = Parrot_pmc_new(interp, enum_class_NativePCCMethod);
+        PMC * const data = Parrot_pmc_new(interp, enum_class_Pointer);
+        INTVAL i;
+
+        VTABLE_set_pointer_keyed_str(interp, code, Parrot_str_new_constant(interp, "P"),
+                F2DPTR(parallel_worker));
+        VTABLE_set_pointer(interp, data, job);
+        job->running = workers;
+
+        for (i = 0; i < workers; ++i) {
+            PMC * const task = Parrot_pmc_new(interp, enum_class_Task);
+            PARROT_TASK(task)->code = code;
+            PARROT_TASK(task)->data = data;
+            PARROT_GC_WRITE_BARRIER(interp, task);
+            Parrot_cx_schedule_task(interp, task);
+        }
+
+        LOCK(job->lock);
+        while (job->running > 0)
+            COND_WAIT(job->done, job->lock);
+        UNLOCK(job->lock);
+    }
+
+    PARROT_ATOMIC_INT_DESTROY(job->claimed);
+    MUTEX_DESTROY(job->lock);
+    COND_DESTROY(job->done);
+
+    /* Exceptions are rethrown the same way whether the job ran here or on
+       other threads, after freeing what the caller would have freed. */
+    if (job->error) {
+        STRING * const message = Parrot_str_new(interp, job->error, 0);
+        Parrot_str_free_cstring(job->error);
+        if (job->results)
+            mem_internal_free(job->results);
+        if (job->scratch)
+            mem_internal_free(job->scratch);
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "%Ss", message);
+    }
+}
+
+/*
+
+=item C<static void parallel_worker(PARROT_INTERP, PMC *self)>
+
+The code of the Tasks running a job on worker threads. Takes the job from
+the C<Pointer> passed as the Task's data and tells the interpreter waiting
+for it when it's done.
+
+=item C<static void parallel_work(PARROT_INTERP, void *data)>
+
+Claims and runs chunks of the job C<data> until none are left, or until a
+chunk failed. Also runs jobs that aren't split, on the current interpreter.
+
+=item C<static void parallel_failed(PARROT_INTERP, PMC *exception, void *data)>
+
+Records the message of an exception thrown by a chunk of the job C<data>.
+
+=cut
+
+*/
+
+static void
+parallel_worker(PARROT_INTERP, SHIM(PMC *self))
+{
+    ASSERT_ARGS(parallel_worker)
+    PMC * const call_object = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+    Parrot_parallel_job *job;
+    PMC                 *data;
+
+    Parrot_pcc_fill_params_from_c_args(interp, call_object, "P", &data);
+    job = (Parrot_parallel_job *)VTABLE_get_pointer(interp, data);
+
+    Parrot_ext_try(interp, parallel_work, parallel_failed, job);
+
+    LOCK(job->lock);
+    if (--job->running == 0)
+        COND_SIGNAL(job->done);
+    UNLOCK(job->lock);
+}
+
+static void
+parallel_work(PARROT_INTERP, ARGIN_NULLOK(void *data))
+{
+    ASSERT_ARGS(parallel_work)
+    Parrot_parallel_job * const job = (Parrot_parallel_job *)data;
+    PMC * const sub = PMC_IS_NULL(job->sub) || interp == job->interp
+                    ? job->sub
+                    : Parrot_thread_create_proxy(job->interp, interp, job->sub);
+
+    while (!job->error) {
+        INTVAL chunk;
+        PARROT_ATOMIC_INT_INC(chunk, job->claimed);
+        if (chunk > job->chunks)
+            break;
+        parallel_run_chunk(interp, job, sub, chunk - 1);
+    }
+}
+
+static void
+parallel_failed(PARROT_INTERP, ARGIN_NULLOK(PMC *exception), ARGIN_NULLOK(void *data))
+{
+    ASSERT_ARGS(parallel_failed)
+    Parrot_parallel_job * const job = (Parrot_parallel_job *)data;
+    STRING * const message = PMC_IS_NULL(exception)
+                           ? STRINGNULL
+                           : VTABLE_get_string(interp, exception);
+
+    LOCK(job->lock);
+    if (!job->error)
+        job->error = Parrot_str_to_cstring(interp,
+                STRING_IS_NULL(message) ? Parrot_str_new(interp, "parallel job failed", 0)
+                                        : message);
+    UNLOCK(job->lock);
+}
+
+/*
+
+=item C<static void parallel_run_chunk(PARROT_INTERP, Parrot_parallel_job *job,
+PMC *sub, INTVAL chunk)>
+
+Runs one chunk of a job, calling C<sub>, which belongs to C<interp>.
+
+=cut
+
+*/
+
+static void
+parallel_run_chunk(PARROT_INTERP, ARGMOD(Parrot_parallel_job *job), ARGIN(PMC *sub),
+        INTVAL chunk)
+{
+    ASSERT_ARGS(parallel_run_chunk)
+    const INTVAL from = chunk * job->chunk_size;
+    const INTVAL to   = from + job->chunk_size < job->size ? from + job->chunk_size : job->size;
+    INTVAL i;
+
+    switch (job->op) {
+      case PARALLEL_MAP:
+        if (job->type == enum_type_INTVAL) {
+            INTVAL * const items = (INTVAL *)job->items;
+            for (i = from; i < to; ++i)
+                Parrot_ext_call(interp, sub, "I->I", items[i], &items[i]);
+        }
+        else {
+            FLOATVAL * const items = (FLOATVAL *)job->items;
+            for (i = from; i < to; ++i)
+                Parrot_ext_call(interp, sub, "N->N", items[i], &items[i]);
+        }
+        break;
+
+      case PARALLEL_EACH:
+        for (i = from; i < to; ++i) {
+            const char * const item = job->items + i * job->item_size;
+            if (job->type == enum_type_INTVAL)
+                Parrot_ext_call(interp, sub, "I->", *(const INTVAL *)item);
+            else if (job->type == enum_type_FLOATVAL)
+                Parrot_ext_call(interp, sub, "N->", *(const FLOATVAL *)item);
+            else
+                Parrot_ext_call(interp, sub, "P->",
+                        parallel_local(interp, job, *(PMC * const *)item));
+        }
+        break;
+
+      case PARALLEL_REDUCE:
+        {
+            char * const acc = job->results + chunk * job->item_size;
+            memcpy(acc, job->items + from * job->item_size, job->item_size);
+            for (i = from + 1; i < to; ++i)
+                parallel_fold(interp, job, sub, acc, job->items + i * job->item_size);
+        }
+        break;
+
+      case PARALLEL_SORT:
+        parallel_sort_run(interp, job, sub, from, to);
+        break;
+
+      default:
+        break;
+    }
+}
+
+/*
+
+=item C<static PMC * parallel_local(PARROT_INTERP, const Parrot_parallel_job
+*job, PMC *pmc)>
+
+Returns an element of the job's array as C<interp> may use it: the element
+itself on the interpreter that owns it, a proxy anywhere else.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+static PMC *
+parallel_local(PARROT_INTERP, ARGIN(const Parrot_parallel_job *job), ARGIN_NULLOK(PMC *pmc))
+{
+    ASSERT_ARGS(parallel_local)
+
+    if (PMC_IS_NULL(pmc) || interp == job->interp)
+        return pmc ? pmc : PMCNULL;
+
+    return Parrot_thread_maybe_create_proxy(job->interp, interp, pmc);
+}
+
+/*
+
+=item C<static void parallel_fold(PARROT_INTERP, const Parrot_parallel_job *job,
+PMC *sub, char *acc, const char *item)>
+
+Sets C<*acc> to the result of calling C<sub> on C<*acc> and C<*item>.
+
+=cut
+
+*/
+
+static void
+parallel_fold(PARROT_INTERP, ARGIN(const Parrot_parallel_job *job), ARGIN(PMC *sub),
+        ARGMOD(char *acc), ARGIN(const char *item))
+{
+    ASSERT_ARGS(parallel_fold)
+
+    if (job->type == enum_type_INTVAL)
+        Parrot_ext_call(interp, sub, "II->I",
+                *(INTVAL *)acc, *(const INTVAL *)item, (INTVAL *)acc);
+    else
+        Parrot_ext_call(interp, sub, "NN->N",
+                *(FLOATVAL *)acc, *(const FLOATVAL *)item, (FLOATVAL *)acc);
+}
+
+/*
+
+=item C<static INTVAL parallel_compare(PARROT_INTERP, const Parrot_parallel_job
+*job, PMC *cmp, const char *a, const char *b)>
+
+Compares two elements, with C<cmp> if it isn't null.
+
+=cut
+
+*/
+
+static INTVAL
+parallel_compare(PARROT_INTERP, ARGIN(const Parrot_parallel_job *job),
+        ARGIN(PMC *cmp), ARGIN(const char *a), ARGIN(const char *b))
+{
+    ASSERT_ARGS(parallel_compare)
+    INTVAL result = 0;
+
+    switch (job->type) {
+      case enum_type_INTVAL:
+        {
+            const INTVAL x = *(const INTVAL *)a;
+            const INTVAL y = *(const INTVAL *)b;
+            if (PMC_IS_NULL(cmp))
+                return x < y ? -1 : x > y;
+            Parrot_ext_call(interp, cmp, "II->I", x, y, &result);
+        }
+        break;
+      case enum_type_FLOATVAL:
+        {
+            const FLOATVAL x = *(const FLOATVAL *)a;
+            const FLOATVAL y = *(const FLOATVAL *)b;
+            if (PMC_IS_NULL(cmp))
+                return x < y ? -1 : x > y;
+            Parrot_ext_call(interp, cmp, "NN->I", x, y, &result);
+        }
+        break;
+      default:
+        {
+            PMC * const x = *(PMC * const *)a;
+            PMC * const y = *(PMC * const *)b;
+            if (PMC_IS_NULL(cmp))
+                return VTABLE_cmp(interp, x, y);
+            Parrot_ext_call(interp, cmp, "PP->I",
+                    parallel_local(interp, job, x), parallel_local(interp, job, y), &result);
+        }
+        break;
+    }
+
+    return result;
+}
+
+/*
+
+=item C<static void parallel_merge(PARROT_INTERP, const Parrot_parallel_job
+*job, PMC *cmp, const char *src, char *dest, INTVAL left, INTVAL mid, INTVAL
+right)>
+
+Merges the sorted runs C<src[left..mid)> and C<src[mid..right)> into
+C<dest[left..right)>. On ties the left run goes first, which keeps the sort
+stable.
+
+=cut
+
+*/
+
+static void
+parallel_merge(PARROT_INTERP, ARGIN(const Parrot_parallel_job *job), ARGIN(PMC *cmp),
+        ARGIN(const char *src), ARGOUT(char *dest), INTVAL left, INTVAL mid, INTVAL right)
+{
+    ASSERT_ARGS(parallel_merge)
+    const size_t size = job->item_size;
+    INTVAL i = left, j = mid, k = left;
+
+    while (i < mid && j < right) {
+        if (parallel_compare(interp, job, cmp, src + j * size, src + i * size) < 0)
+            memcpy(dest + k++ * size, src + j++ * size, size);
+        else
+            memcpy(dest + k++ * size, src + i++ * size, size);
+    }
+    if (i < mid)
+        memcpy(dest + k * size, src + i * size, (mid - i) * size);
+    else if (j < right)
+        memcpy(dest + k * size, src + j * size, (right - j) * size);
+}
+
+/*
+
+=item C<static void parallel_sort_run(PARROT_INTERP, const Parrot_parallel_job
+*job, PMC *cmp, INTVAL from, INTVAL to)>
+
+Sorts the elements C<[from..to)> in place, using the same part of the job's
+scratch buffer for merging.
+
+=cut
+
+*/
+
+static void
+parallel_sort_run(PARROT_INTERP, ARGIN(const Parrot_parallel_job *job), ARGIN(PMC *cmp),
+        INTVAL from, INTVAL to)
+{
+    ASSERT_ARGS(parallel_sort_run)
+    const size_t size = job->item_size;
+    char  *src  = job->items;
+    char  *dest = job->scratch;
+    INTVAL i, width;
+    union {
+        INTVAL    i;
+        FLOATVAL  n;
+        PMC      *p;
+    } item;
+
+    /* Short runs by insertion */
+    for (i = from; i < to; i += PARALLEL_INSERTION_RUN) {
+        const INTVAL end = i + PARALLEL_INSERTION_RUN < to ? i + PARALLEL_INSERTION_RUN : to;
+        INTVAL j;
+
+        for (j = i + 1; j < end; ++j) {
+            INTVAL k = j;
+            memcpy(&item, src + j * size, size);
+            while (k > i
+            &&     parallel_compare(interp, job, cmp, (char *)&item, src + (k - 1) * size) < 0) {
+                memcpy(src + k * size, src + (k - 1) * size, size);
+                --k;
+            }
+            memcpy(src + k * size, &item, size);
+        }
+    }
+
+    /* then merge them, going back and forth between items and scratch */
+    for (width = PARALLEL_INSERTION_RUN; width < to - from; width *= 2) {
+        char *swap;
+
+        for (i = from; i < to; i += 2 * width) {
+            const INTVAL mid   = i + width < to ? i + width : to;
+            const INTVAL right = mid + width < to ? mid + width : to;
+            parallel_merge(interp, job, cmp, src, dest, i, mid, right);
+        }
+
+        swap = src;
+        src  = dest;
+        dest = swap;
+    }
+
+    if (src != job->items)
+        memcpy(job->items + from * size, src + from * size, (to - from) * size);
+}
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<src/thread.c>, F<src/pmc/fixedintegerarray.pmc>,
+F<src/pmc/fixedfloatarray.pmc>, F<src/pmc/fixedpmcarray.pmc>.
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -0,0 +1,3756 @@
+/* ex: set ro:
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically by tools/build/parrot_config_c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+#include <stdio.h>
+#include "parrot/api.h"
+
+int Parrot_set_config_hash(Parrot_PMC interp_pmc);
+const unsigned char * Parrot_get_config_hash_bytes(void);
+int Parrot_get_config_hash_length(void);
+
+static const unsigned char parrot_config[] = {
+    0xfe, 0x50, 0x42, 0x43, 0x0d, 0x0a, 0x1a, 0x0a, 
+    0x08, 0x00, 0x00, 0x06, 0x09, 0x00, 0x0d, 0x05, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x67, 0x69, 0x74, 0x5f, 0x64, 0x65, 0x73, 0x63, 
+    0x72, 0x69, 0x62, 0x65, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x73, 0x68, 0x61, 0x31, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x39, 0x65, 0x33, 0x62, 0x64, 0x66, 0x38, 0x32, 
+    0x62, 0x37, 0x61, 0x38, 0x32, 0x65, 0x30, 0x39, 
+    0x31, 0x62, 0x34, 0x36, 0x37, 0x31, 0x66, 0x30, 
+    0x32, 0x31, 0x30, 0x32, 0x38, 0x38, 0x34, 0x65, 
+    0x38, 0x66, 0x35, 0x33, 0x63, 0x64, 0x33, 0x32, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2e, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x61, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x61, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x61, 0x72, 0x5f, 0x65, 0x78, 0x74, 0x72, 0x61, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x61, 0x72, 0x5f, 0x6f, 0x75, 0x74, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x61, 0x72, 0x63, 0x68, 0x6e, 0x61, 0x6d, 0x65, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x78, 0x38, 0x36, 0x5f, 0x36, 0x34, 0x2d, 0x6c, 
+    0x69, 0x6e, 0x75, 0x78, 0x2d, 0x67, 0x6e, 0x75, 
+    0x2d, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x2d, 
+    0x6d, 0x75, 0x6c, 0x74, 0x69, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x61, 0x72, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x63, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x61, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x61, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x62, 0x61, 0x63, 0x6b, 0x74, 0x72, 0x61, 0x63, 
+    0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x62, 0x69, 0x67, 0x65, 0x6e, 0x64, 0x69, 0x61, 
+    0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x62, 0x69, 0x6e, 0x64, 0x69, 0x72, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2f, 0x75, 0x73, 0x72, 0x2f, 0x6c, 0x6f, 0x63, 
+    0x61, 0x6c, 0x2f, 0x62, 0x69, 0x6e, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x62, 0x69, 0x73, 0x6f, 0x6e, 0x5f, 0x76, 0x65, 
+    0x72, 0x73, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x00, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x62, 0x6c, 0x69, 0x62, 0x5f, 0x64, 0x69, 0x72, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x62, 0x6c, 0x69, 0x62, 0x2f, 0x6c, 0x69, 0x62, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x62, 0x75, 0x69, 0x6c, 0x64, 0x5f, 0x64, 0x69, 
+    0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2f, 0x72, 0x6f, 0x6f, 0x74, 0x2f, 0x72, 0x65, 
+    0x70, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x62, 0x79, 0x74, 0x65, 0x6f, 0x72, 0x64, 0x65, 
+    0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x63, 0x61, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x24, 0x28, 0x50, 0x45, 0x52, 0x4c, 0x29, 0x20, 
+    0x2d, 0x4d, 0x45, 0x78, 0x74, 0x55, 0x74, 0x69, 
+    0x6c, 0x73, 0x3a, 0x3a, 0x43, 0x6f, 0x6d, 0x6d, 
+    0x61, 0x6e, 0x64, 0x20, 0x2d, 0x65, 0x20, 0x63, 
+    0x61, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x63, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x78, 0x38, 0x36, 0x5f, 0x36, 0x34, 0x2d, 0x6c, 
+    0x69, 0x6e, 0x75, 0x78, 0x2d, 0x67, 0x6e, 0x75, 
+    0x2d, 0x67, 0x63, 0x63, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x63, 0x63, 0x5f, 0x64, 0x65, 0x62, 0x75, 0x67, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x63, 0x63, 0x5f, 0x65, 0x78, 0x65, 0x5f, 0x6f, 
+    0x75, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2d, 0x6f, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x63, 0x63, 0x5f, 0x69, 0x6e, 0x63, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2d, 0x49, 0x2e, 0x2f, 0x69, 0x6e, 0x63, 0x6c, 
+    0x75, 0x64, 0x65, 0x20, 0x2d, 0x49, 0x2e, 0x2f, 
+    0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x2f, 
+    0x70, 0x6d, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x63, 0x63, 0x5f, 0x6c, 0x64, 0x66, 0x6c, 0x61, 
+    0x67, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x63, 0x63, 0x5f, 0x6f, 0x5f, 0x6f, 0x75, 0x74, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2d, 0x6f, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x63, 0x63, 0x5f, 0x73, 0x68, 0x61, 0x72, 0x65, 
+    0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2d, 0x66, 0x50, 0x49, 0x43, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x63, 0x63, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x59, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2d, 0x44, 0x5f, 0x52, 0x45, 0x45, 0x4e, 0x54, 
+    0x52, 0x41, 0x4e, 0x54, 0x20, 0x2d, 0x44, 0x5f, 
+    0x47, 0x4e, 0x55, 0x5f, 0x53, 0x4f, 0x55, 0x52, 
+    0x43, 0x45, 0x20, 0x2d, 0x44, 0x44, 0x45, 0x42, 
+    0x49, 0x41, 0x4e, 0x20, 0x2d, 0x66, 0x77, 0x72, 
+    0x61, 0x70, 0x76, 0x20, 0x20, 0x2d, 0x70, 0x69, 
+    0x70, 0x65, 0x20, 0x2d, 0x49, 0x2f, 0x75, 0x73, 
+    0x72, 0x2f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x2f, 
+    0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 
+    0x2d, 0x44, 0x5f, 0x4c, 0x41, 0x52, 0x47, 0x45, 
+    0x46, 0x49, 0x4c, 0x45, 0x5f, 0x53, 0x4f, 0x55, 
+    0x52, 0x43, 0x45, 0x20, 0x2d, 0x44, 0x5f, 0x46, 
+    0x49, 0x4c, 0x45, 0x5f, 0x4f, 0x46, 0x46, 0x53, 
+    0x45, 0x54, 0x5f, 0x42, 0x49, 0x54, 0x53, 0x3d, 
+    0x36, 0x34, 0x20, 0x2d, 0x44, 0x48, 0x41, 0x53, 
+    0x41, 0x54, 0x54, 0x52, 0x49, 0x42, 0x55, 0x54, 
+    0x45, 0x5f, 0x43, 0x4f, 0x4e, 0x53, 0x54, 0x20, 
+    0x20, 0x2d, 0x44, 0x48, 0x41, 0x53, 0x41, 0x54, 
+    0x54, 0x52, 0x49, 0x42, 0x55, 0x54, 0x45, 0x5f, 
+    0x44, 0x45, 0x50, 0x52, 0x45, 0x43, 0x41, 0x54, 
+    0x45, 0x44, 0x20, 0x20, 0x2d, 0x44, 0x48, 0x41, 
+    0x53, 0x41, 0x54, 0x54, 0x52, 0x49, 0x42, 0x55, 
+    0x54, 0x45, 0x5f, 0x4d, 0x41, 0x4c, 0x4c, 0x4f, 
+    0x43, 0x20, 0x20, 0x2d, 0x44, 0x48, 0x41, 0x53, 
+    0x41, 0x54, 0x54, 0x52, 0x49, 0x42, 0x55, 0x54, 
+    0x45, 0x5f, 0x4e, 0x4f, 0x4e, 0x4e, 0x55, 0x4c, 
+    0x4c, 0x20, 0x20, 0x2d, 0x44, 0x48, 0x41, 0x53, 
+    0x41, 0x54, 0x54, 0x52, 0x49, 0x42, 0x55, 0x54, 
+    0x45, 0x5f, 0x50, 0x55, 0x52, 0x45, 0x20, 0x20, 
+    0x2d, 0x44, 0x48, 0x41, 0x53, 0x41, 0x54, 0x54, 
+    0x52, 0x49, 0x42, 0x55, 0x54, 0x45, 0x5f, 0x55, 
+    0x4e, 0x55, 0x53, 0x45, 0x44, 0x20, 0x20, 0x2d, 
+    0x44, 0x48, 0x41, 0x53, 0x41, 0x54, 0x54, 0x52, 
+    0x49, 0x42, 0x55, 0x54, 0x45, 0x5f, 0x57, 0x41, 
+    0x52, 0x4e, 0x5f, 0x55, 0x4e, 0x55, 0x53, 0x45, 
+    0x44, 0x5f, 0x52, 0x45, 0x53, 0x55, 0x4c, 0x54, 
+    0x20, 0x20, 0x2d, 0x44, 0x48, 0x41, 0x53, 0x41, 
+    0x54, 0x54, 0x52, 0x49, 0x42, 0x55, 0x54, 0x45, 
+    0x5f, 0x48, 0x4f, 0x54, 0x20, 0x20, 0x2d, 0x44, 
+    0x48, 0x41, 0x53, 0x41, 0x54, 0x54, 0x52, 0x49, 
+    0x42, 0x55, 0x54, 0x45, 0x5f, 0x43, 0x4f, 0x4c, 
+    0x44, 0x20, 0x20, 0x2d, 0x44, 0x48, 0x41, 0x53, 
+    0x5f, 0x47, 0x45, 0x54, 0x54, 0x45, 0x58, 0x54, 
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x63, 0x63, 0x77, 0x61, 0x72, 0x6e, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x7a, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2d, 0x66, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x2d, 
+    0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+    0x73, 0x3d, 0x31, 0x36, 0x20, 0x2d, 0x66, 0x75, 
+    0x6e, 0x69, 0x74, 0x2d, 0x61, 0x74, 0x2d, 0x61, 
+    0x2d, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x2d, 0x66, 
+    0x65, 0x78, 0x63, 0x65, 0x73, 0x73, 0x2d, 0x70, 
+    0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e, 
+    0x3d, 0x73, 0x74, 0x61, 0x6e, 0x64, 0x61, 0x72, 
+    0x64, 0x20, 0x2d, 0x6d, 0x61, 0x63, 0x63, 0x75, 
+    0x6d, 0x75, 0x6c, 0x61, 0x74, 0x65, 0x2d, 0x6f, 
+    0x75, 0x74, 0x67, 0x6f, 0x69, 0x6e, 0x67, 0x2d, 
+    0x61, 0x72, 0x67, 0x73, 0x20, 0x2d, 0x57, 0x61, 
+    0x6c, 0x6c, 0x20, 0x2d, 0x57, 0x65, 0x78, 0x74, 
+    0x72, 0x61, 0x20, 0x2d, 0x57, 0x61, 0x67, 0x67, 
+    0x72, 0x65, 0x67, 0x61, 0x74, 0x65, 0x2d, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x2d, 0x57, 
+    0x63, 0x61, 0x73, 0x74, 0x2d, 0x71, 0x75, 0x61, 
+    0x6c, 0x20, 0x2d, 0x57, 0x64, 0x69, 0x73, 0x61, 
+    0x62, 0x6c, 0x65, 0x64, 0x2d, 0x6f, 0x70, 0x74, 
+    0x69, 0x6d, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 
+    0x6e, 0x20, 0x2d, 0x57, 0x64, 0x69, 0x76, 0x2d, 
+    0x62, 0x79, 0x2d, 0x7a, 0x65, 0x72, 0x6f, 0x20, 
+    0x2d, 0x57, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x2d, 
+    0x6c, 0x61, 0x62, 0x65, 0x6c, 0x73, 0x20, 0x2d, 
+    0x57, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x2d, 
+    0x65, 0x78, 0x74, 0x72, 0x61, 0x2d, 0x61, 0x72, 
+    0x67, 0x73, 0x20, 0x2d, 0x57, 0x66, 0x6f, 0x72, 
+    0x6d, 0x61, 0x74, 0x2d, 0x6e, 0x6f, 0x6e, 0x6c, 
+    0x69, 0x74, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x2d, 
+    0x57, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x2d, 
+    0x73, 0x65, 0x63, 0x75, 0x72, 0x69, 0x74, 0x79, 
+    0x20, 0x2d, 0x57, 0x66, 0x6f, 0x72, 0x6d, 0x61, 
+    0x74, 0x2d, 0x79, 0x32, 0x6b, 0x20, 0x2d, 0x57, 
+    0x69, 0x6d, 0x70, 0x6c, 0x69, 0x63, 0x69, 0x74, 
+    0x20, 0x2d, 0x57, 0x69, 0x6d, 0x70, 0x6f, 0x72, 
+    0x74, 0x20, 0x2d, 0x57, 0x69, 0x6e, 0x69, 0x74, 
+    0x2d, 0x73, 0x65, 0x6c, 0x66, 0x20, 0x2d, 0x57, 
+    0x69, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x2d, 
+    0x57, 0x69, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 
+    0x2d, 0x70, 0x63, 0x68, 0x20, 0x2d, 0x57, 0x6a, 
+    0x75, 0x6d, 0x70, 0x2d, 0x6d, 0x69, 0x73, 0x73, 
+    0x65, 0x73, 0x2d, 0x69, 0x6e, 0x69, 0x74, 0x20, 
+    0x2d, 0x57, 0x6c, 0x6f, 0x67, 0x69, 0x63, 0x61, 
+    0x6c, 0x2d, 0x6f, 0x70, 0x20, 0x2d, 0x57, 0x65, 
+    0x72, 0x72, 0x6f, 0x72, 0x3d, 0x6d, 0x69, 0x73, 
+    0x73, 0x69, 0x6e, 0x67, 0x2d, 0x62, 0x72, 0x61, 
+    0x63, 0x65, 0x73, 0x20, 0x2d, 0x57, 0x65, 0x72, 
+    0x72, 0x6f, 0x72, 0x3d, 0x6d, 0x69, 0x73, 0x73, 
+    0x69, 0x6e, 0x67, 0x2d, 0x64, 0x65, 0x63, 0x6c, 
+    0x61, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 
+    0x20, 0x2d, 0x57, 0x6e, 0x6f, 0x2d, 0x6d, 0x69, 
+    0x73, 0x73, 0x69, 0x6e, 0x67, 0x2d, 0x66, 0x6f, 
+    0x72, 0x6d, 0x61, 0x74, 0x2d, 0x61, 0x74, 0x74, 
+    0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x2d, 
+    0x57, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6e, 0x67, 
+    0x2d, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 
+    0x2d, 0x64, 0x69, 0x72, 0x73, 0x20, 0x2d, 0x57, 
+    0x6d, 0x75, 0x6c, 0x74, 0x69, 0x63, 0x68, 0x61, 
+    0x72, 0x20, 0x2d, 0x57, 0x70, 0x61, 0x63, 0x6b, 
+    0x65, 0x64, 0x20, 0x2d, 0x57, 0x70, 0x6f, 0x69, 
+    0x6e, 0x74, 0x65, 0x72, 0x2d, 0x61, 0x72, 0x69, 
+    0x74, 0x68, 0x20, 0x2d, 0x57, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6e, 0x2d, 0x74, 0x79, 0x70, 0x65, 
+    0x20, 0x2d, 0x57, 0x73, 0x65, 0x71, 0x75, 0x65, 
+    0x6e, 0x63, 0x65, 0x2d, 0x70, 0x6f, 0x69, 0x6e, 
+    0x74, 0x20, 0x2d, 0x57, 0x73, 0x69, 0x67, 0x6e, 
+    0x2d, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x72, 0x65, 
+    0x20, 0x2d, 0x57, 0x73, 0x74, 0x72, 0x69, 0x63, 
+    0x74, 0x2d, 0x61, 0x6c, 0x69, 0x61, 0x73, 0x69, 
+    0x6e, 0x67, 0x20, 0x2d, 0x57, 0x73, 0x74, 0x72, 
+    0x69, 0x63, 0x74, 0x2d, 0x61, 0x6c, 0x69, 0x61, 
+    0x73, 0x69, 0x6e, 0x67, 0x3d, 0x32, 0x20, 0x2d, 
+    0x57, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x20, 
+    0x2d, 0x57, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 
+    0x2d, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 
+    0x20, 0x2d, 0x57, 0x65, 0x72, 0x72, 0x6f, 0x72, 
+    0x3d, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x20, 0x2d, 
+    0x57, 0x6e, 0x6f, 0x2d, 0x75, 0x6e, 0x75, 0x73, 
+    0x65, 0x64, 0x20, 0x2d, 0x57, 0x76, 0x61, 0x72, 
+    0x69, 0x61, 0x64, 0x69, 0x63, 0x2d, 0x6d, 0x61, 
+    0x63, 0x72, 0x6f, 0x73, 0x20, 0x2d, 0x57, 0x77, 
+    0x72, 0x69, 0x74, 0x65, 0x2d, 0x73, 0x74, 0x72, 
+    0x69, 0x6e, 0x67, 0x73, 0x20, 0x2d, 0x57, 0x73, 
+    0x74, 0x61, 0x63, 0x6b, 0x2d, 0x75, 0x73, 0x61, 
+    0x67, 0x65, 0x3d, 0x35, 0x30, 0x30, 0x20, 0x2d, 
+    0x57, 0x63, 0x2b, 0x2b, 0x2d, 0x63, 0x6f, 0x6d, 
+    0x70, 0x61, 0x74, 0x20, 0x2d, 0x57, 0x65, 0x72, 
+    0x72, 0x6f, 0x72, 0x3d, 0x64, 0x65, 0x63, 0x6c, 
+    0x61, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2d, 
+    0x61, 0x66, 0x74, 0x65, 0x72, 0x2d, 0x73, 0x74, 
+    0x61, 0x74, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 
+    0x2d, 0x57, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x3d, 
+    0x69, 0x6d, 0x70, 0x6c, 0x69, 0x63, 0x69, 0x74, 
+    0x2d, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 
+    0x6e, 0x2d, 0x64, 0x65, 0x63, 0x6c, 0x61, 0x72, 
+    0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x2d, 0x57, 
+    0x65, 0x72, 0x72, 0x6f, 0x72, 0x3d, 0x6d, 0x69, 
+    0x73, 0x73, 0x69, 0x6e, 0x67, 0x2d, 0x70, 0x72, 
+    0x6f, 0x74, 0x6f, 0x74, 0x79, 0x70, 0x65, 0x73, 
+    0x20, 0x2d, 0x57, 0x65, 0x72, 0x72, 0x6f, 0x72, 
+    0x3d, 0x6e, 0x65, 0x73, 0x74, 0x65, 0x64, 0x2d, 
+    0x65, 0x78, 0x74, 0x65, 0x72, 0x6e, 0x73, 0x20, 
+    0x2d, 0x57, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x3d, 
+    0x6f, 0x6c, 0x64, 0x2d, 0x73, 0x74, 0x79, 0x6c, 
+    0x65, 0x2d, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x69, 
+    0x74, 0x69, 0x6f, 0x6e, 0x20, 0x2d, 0x57, 0x65, 
+    0x72, 0x72, 0x6f, 0x72, 0x3d, 0x73, 0x74, 0x72, 
+    0x69, 0x63, 0x74, 0x2d, 0x70, 0x72, 0x6f, 0x74, 
+    0x6f, 0x74, 0x79, 0x70, 0x65, 0x73, 0x20, 0x2d, 
+    0x66, 0x76, 0x69, 0x73, 0x69, 0x62, 0x69, 0x6c, 
+    0x69, 0x74, 0x79, 0x3d, 0x68, 0x69, 0x64, 0x64, 
+    0x65, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x63, 0x63, 0x77, 0x61, 0x72, 0x6e, 0x3a, 0x3a, 
+    0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x72, 
+    0x73, 0x2f, 0x69, 0x6d, 0x63, 0x63, 0x2f, 0x69, 
+    0x6d, 0x63, 0x6c, 0x65, 0x78, 0x65, 0x72, 0x2e, 
+    0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6b, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2d, 0x66, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x2d, 
+    0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+    0x73, 0x3d, 0x31, 0x36, 0x20, 0x2d, 0x66, 0x75, 
+    0x6e, 0x69, 0x74, 0x2d, 0x61, 0x74, 0x2d, 0x61, 
+    0x2d, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x2d, 0x66, 
+    0x65, 0x78, 0x63, 0x65, 0x73, 0x73, 0x2d, 0x70, 
+    0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e, 
+    0x3d, 0x73, 0x74, 0x61, 0x6e, 0x64, 0x61, 0x72, 
+    0x64, 0x20, 0x2d, 0x6d, 0x61, 0x63, 0x63, 0x75, 
+    0x6d, 0x75, 0x6c, 0x61, 0x74, 0x65, 0x2d, 0x6f, 
+    0x75, 0x74, 0x67, 0x6f, 0x69, 0x6e, 0x67, 0x2d, 
+    0x61, 0x72, 0x67, 0x73, 0x20, 0x2d, 0x57, 0x61, 
+    0x6c, 0x6c, 0x20, 0x2d, 0x57, 0x65, 0x78, 0x74, 
+    0x72, 0x61, 0x20, 0x2d, 0x57, 0x61, 0x67, 0x67, 
+    0x72, 0x65, 0x67, 0x61, 0x74, 0x65, 0x2d, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x2d, 0x57, 
+    0x63, 0x61, 0x73, 0x74, 0x2d, 0x71, 0x75, 0x61, 
+    0x6c, 0x20, 0x2d, 0x57, 0x64, 0x69, 0x73, 0x61, 
+    0x62, 0x6c, 0x65, 0x64, 0x2d, 0x6f, 0x70, 0x74, 
+    0x69, 0x6d, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 
+    0x6e, 0x20, 0x2d, 0x57, 0x64, 0x69, 0x76, 0x2d, 
+    0x62, 0x79, 0x2d, 0x7a, 0x65, 0x72, 0x6f, 0x20, 
+    0x2d, 0x57, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x2d, 
+    0x6c, 0x61, 0x62, 0x65, 0x6c, 0x73, 0x20, 0x2d, 
+    0x57, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x2d, 
+    0x65, 0x78, 0x74, 0x72, 0x61, 0x2d, 0x61, 0x72, 
+    0x67, 0x73, 0x20, 0x2d, 0x57, 0x66, 0x6f, 0x72, 
+    0x6d, 0x61, 0x74, 0x2d, 0x73, 0x65, 0x63, 0x75, 
+    0x72, 0x69, 0x74, 0x79, 0x20, 0x2d, 0x57, 0x66, 
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x2d, 0x79, 0x32, 
+    0x6b, 0x20, 0x2d, 0x57, 0x69, 0x6d, 0x70, 0x6c, 
+    0x69, 0x63, 0x69, 0x74, 0x20, 0x2d, 0x57, 0x69, 
+    0x6d, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x2d, 0x57, 
+    0x69, 0x6e, 0x69, 0x74, 0x2d, 0x73, 0x65, 0x6c, 
+    0x66, 0x20, 0x2d, 0x57, 0x69, 0x6e, 0x6c, 0x69, 
+    0x6e, 0x65, 0x20, 0x2d, 0x57, 0x69, 0x6e, 0x76, 
+    0x61, 0x6c, 0x69, 0x64, 0x2d, 0x70, 0x63, 0x68, 
+    0x20, 0x2d, 0x57, 0x6a, 0x75, 0x6d, 0x70, 0x2d, 
+    0x6d, 0x69, 0x73, 0x73, 0x65, 0x73, 0x2d, 0x69, 
+    0x6e, 0x69, 0x74, 0x20, 0x2d, 0x57, 0x6c, 0x6f, 
+    0x67, 0x69, 0x63, 0x61, 0x6c, 0x2d, 0x6f, 0x70, 
+    0x20, 0x2d, 0x57, 0x65, 0x72, 0x72, 0x6f, 0x72, 
+    0x3d, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6e, 0x67, 
+    0x2d, 0x62, 0x72, 0x61, 0x63, 0x65, 0x73, 0x20, 
+    0x2d, 0x57, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x3d, 
+    0x6d, 0x69, 0x73, 0x73, 0x69, 0x6e, 0x67, 0x2d, 
+    0x64, 0x65, 0x63, 0x6c, 0x61, 0x72, 0x61, 0x74, 
+    0x69, 0x6f, 0x6e, 0x73, 0x20, 0x2d, 0x57, 0x6e, 
+    0x6f, 0x2d, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6e, 
+    0x67, 0x2d, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 
+    0x2d, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 
+    0x74, 0x65, 0x20, 0x2d, 0x57, 0x6d, 0x69, 0x73, 
+    0x73, 0x69, 0x6e, 0x67, 0x2d, 0x69, 0x6e, 0x63, 
+    0x6c, 0x75, 0x64, 0x65, 0x2d, 0x64, 0x69, 0x72, 
+    0x73, 0x20, 0x2d, 0x57, 0x6d, 0x75, 0x6c, 0x74, 
+    0x69, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2d, 0x57, 
+    0x70, 0x61, 0x63, 0x6b, 0x65, 0x64, 0x20, 0x2d, 
+    0x57, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 
+    0x2d, 0x61, 0x72, 0x69, 0x74, 0x68, 0x20, 0x2d, 
+    0x57, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x2d, 
+    0x74, 0x79, 0x70, 0x65, 0x20, 0x2d, 0x57, 0x73, 
+    0x65, 0x71, 0x75, 0x65, 0x6e, 0x63, 0x65, 0x2d, 
+    0x70, 0x6f, 0x69, 0x6e, 0x74, 0x20, 0x2d, 0x57, 
+    0x73, 0x69, 0x67, 0x6e, 0x2d, 0x63, 0x6f, 0x6d, 
+    0x70, 0x61, 0x72, 0x65, 0x20, 0x2d, 0x57, 0x73, 
+    0x74, 0x72, 0x69, 0x63, 0x74, 0x2d, 0x61, 0x6c, 
+    0x69, 0x61, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x2d, 
+    0x57, 0x73, 0x74, 0x72, 0x69, 0x63, 0x74, 0x2d, 
+    0x61, 0x6c, 0x69, 0x61, 0x73, 0x69, 0x6e, 0x67, 
+    0x3d, 0x32, 0x20, 0x2d, 0x57, 0x73, 0x77, 0x69, 
+    0x74, 0x63, 0x68, 0x20, 0x2d, 0x57, 0x65, 0x72, 
+    0x72, 0x6f, 0x72, 0x3d, 0x75, 0x6e, 0x64, 0x65, 
+    0x66, 0x20, 0x2d, 0x57, 0x6e, 0x6f, 0x2d, 0x75, 
+    0x6e, 0x75, 0x73, 0x65, 0x64, 0x20, 0x2d, 0x57, 
+    0x76, 0x61, 0x72, 0x69, 0x61, 0x64, 0x69, 0x63, 
+    0x2d, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x73, 0x20, 
+    0x2d, 0x57, 0x77, 0x72, 0x69, 0x74, 0x65, 0x2d, 
+    0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x73, 0x20, 
+    0x2d, 0x57, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x2d, 
+    0x75, 0x73, 0x61, 0x67, 0x65, 0x3d, 0x35, 0x30, 
+    0x30, 0x20, 0x2d, 0x57, 0x63, 0x2b, 0x2b, 0x2d, 
+    0x63, 0x6f, 0x6d, 0x70, 0x61, 0x74, 0x20, 0x2d, 
+    0x57, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x3d, 0x64, 
+    0x65, 0x63, 0x6c, 0x61, 0x72, 0x61, 0x74, 0x69, 
+    0x6f, 0x6e, 0x2d, 0x61, 0x66, 0x74, 0x65, 0x72, 
+    0x2d, 0x73, 0x74, 0x61, 0x74, 0x65, 0x6d, 0x65, 
+    0x6e, 0x74, 0x20, 0x2d, 0x57, 0x65, 0x72, 0x72, 
+    0x6f, 0x72, 0x3d, 0x69, 0x6d, 0x70, 0x6c, 0x69, 
+    0x63, 0x69, 0x74, 0x2d, 0x66, 0x75, 0x6e, 0x63, 
+    0x74, 0x69, 0x6f, 0x6e, 0x2d, 0x64, 0x65, 0x63, 
+    0x6c, 0x61, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 
+    0x20, 0x2d, 0x57, 0x65, 0x72, 0x72, 0x6f, 0x72, 
+    0x3d, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6e, 0x67, 
+    0x2d, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x74, 0x79, 
+    0x70, 0x65, 0x73, 0x20, 0x2d, 0x57, 0x65, 0x72, 
+    0x72, 0x6f, 0x72, 0x3d, 0x6e, 0x65, 0x73, 0x74, 
+    0x65, 0x64, 0x2d, 0x65, 0x78, 0x74, 0x65, 0x72, 
+    0x6e, 0x73, 0x20, 0x2d, 0x57, 0x65, 0x72, 0x72, 
+    0x6f, 0x72, 0x3d, 0x6f, 0x6c, 0x64, 0x2d, 0x73, 
+    0x74, 0x79, 0x6c, 0x65, 0x2d, 0x64, 0x65, 0x66, 
+    0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
+    0x2d, 0x57, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x3d, 
+    0x73, 0x74, 0x72, 0x69, 0x63, 0x74, 0x2d, 0x70, 
+    0x72, 0x6f, 0x74, 0x6f, 0x74, 0x79, 0x70, 0x65, 
+    0x73, 0x20, 0x2d, 0x66, 0x76, 0x69, 0x73, 0x69, 
+    0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x3d, 0x68, 
+    0x69, 0x64, 0x64, 0x65, 0x6e, 0x20, 0x2d, 0x57, 
+    0x6e, 0x6f, 0x2d, 0x75, 0x6e, 0x75, 0x73, 0x65, 
+    0x64, 0x2d, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 
+    0x74, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x63, 0x63, 0x77, 0x61, 0x72, 0x6e, 0x3a, 0x3a, 
+    0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x72, 
+    0x73, 0x2f, 0x69, 0x6d, 0x63, 0x63, 0x2f, 0x69, 
+    0x6d, 0x63, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 
+    0x2e, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2d, 0x66, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x2d, 
+    0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+    0x73, 0x3d, 0x31, 0x36, 0x20, 0x2d, 0x66, 0x75, 
+    0x6e, 0x69, 0x74, 0x2d, 0x61, 0x74, 0x2d, 0x61, 
+    0x2d, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x2d, 0x66, 
+    0x65, 0x78, 0x63, 0x65, 0x73, 0x73, 0x2d, 0x70, 
+    0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e, 
+    0x3d, 0x73, 0x74, 0x61, 0x6e, 0x64, 0x61, 0x72, 
+    0x64, 0x20, 0x2d, 0x6d, 0x61, 0x63, 0x63, 0x75, 
+    0x6d, 0x75, 0x6c, 0x61, 0x74, 0x65, 0x2d, 0x6f, 
+    0x75, 0x74, 0x67, 0x6f, 0x69, 0x6e, 0x67, 0x2d, 
+    0x61, 0x72, 0x67, 0x73, 0x20, 0x2d, 0x57, 0x61, 
+    0x6c, 0x6c, 0x20, 0x2d, 0x57, 0x65, 0x78, 0x74, 
+    0x72, 0x61, 0x20, 0x2d, 0x57, 0x61, 0x67, 0x67, 
+    0x72, 0x65, 0x67, 0x61, 0x74, 0x65, 0x2d, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x2d, 0x57, 
+    0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 
+    0x2d, 0x6f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, 
+    0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x2d, 0x57, 
+    0x64, 0x69, 0x76, 0x2d, 0x62, 0x79, 0x2d, 0x7a, 
+    0x65, 0x72, 0x6f, 0x20, 0x2d, 0x57, 0x65, 0x6e, 
+    0x64, 0x69, 0x66, 0x2d, 0x6c, 0x61, 0x62, 0x65, 
+    0x6c, 0x73, 0x20, 0x2d, 0x57, 0x66, 0x6f, 0x72, 
+    0x6d, 0x61, 0x74, 0x2d, 0x65, 0x78, 0x74, 0x72, 
+    0x61, 0x2d, 0x61, 0x72, 0x67, 0x73, 0x20, 0x2d, 
+    0x57, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x2d, 
+    0x6e, 0x6f, 0x6e, 0x6c, 0x69, 0x74, 0x65, 0x72, 
+    0x61, 0x6c, 0x20, 0x2d, 0x57, 0x66, 0x6f, 0x72, 
+    0x6d, 0x61, 0x74, 0x2d, 0x73, 0x65, 0x63, 0x75, 
+    0x72, 0x69, 0x74, 0x79, 0x20, 0x2d, 0x57, 0x66, 
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x2d, 0x79, 0x32, 
+    0x6b, 0x20, 0x2d, 0x57, 0x69, 0x6d, 0x70, 0x6c, 
+    0x69, 0x63, 0x69, 0x74, 0x20, 0x2d, 0x57, 0x69, 
+    0x6d, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x2d, 0x57, 
+    0x69, 0x6e, 0x69, 0x74, 0x2d, 0x73, 0x65, 0x6c, 
+    0x66, 0x20, 0x2d, 0x57, 0x69, 0x6e, 0x6c, 0x69, 
+    0x6e, 0x65, 0x20, 0x2d, 0x57, 0x69, 0x6e, 0x76, 
+    0x61, 0x6c, 0x69, 0x64, 0x2d, 0x70, 0x63, 0x68, 
+    0x20, 0x2d, 0x57, 0x6a, 0x75, 0x6d, 0x70, 0x2d, 
+    0x6d, 0x69, 0x73, 0x73, 0x65, 0x73, 0x2d, 0x69, 
+    0x6e, 0x69, 0x74, 0x20, 0x2d, 0x57, 0x6c, 0x6f, 
+    0x67, 0x69, 0x63, 0x61, 0x6c, 0x2d, 0x6f, 0x70, 
+    0x20, 0x2d, 0x57, 0x65, 0x72, 0x72, 0x6f, 0x72, 
+    0x3d, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6e, 0x67, 
+    0x2d, 0x62, 0x72, 0x61, 0x63, 0x65, 0x73, 0x20, 
+    0x2d, 0x57, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x3d, 
+    0x6d, 0x69, 0x73, 0x73, 0x69, 0x6e, 0x67, 0x2d, 
+    0x64, 0x65, 0x63, 0x6c, 0x61, 0x72, 0x61, 0x74, 
+    0x69, 0x6f, 0x6e, 0x73, 0x20, 0x2d, 0x57, 0x6e, 
+    0x6f, 0x2d, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6e, 
+    0x67, 0x2d, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 
+    0x2d, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 
+    0x74, 0x65, 0x20, 0x2d, 0x57, 0x6d, 0x69, 0x73, 
+    0x73, 0x69, 0x6e, 0x67, 0x2d, 0x69, 0x6e, 0x63, 
+    0x6c, 0x75, 0x64, 0x65, 0x2d, 0x64, 0x69, 0x72, 
+    0x73, 0x20, 0x2d, 0x57, 0x6d, 0x75, 0x6c, 0x74, 
+    0x69, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2d, 0x57, 
+    0x70, 0x61, 0x63, 0x6b, 0x65, 0x64, 0x20, 0x2d, 
+    0x57, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 
+    0x2d, 0x61, 0x72, 0x69, 0x74, 0x68, 0x20, 0x2d, 
+    0x57, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x2d, 
+    0x74, 0x79, 0x70, 0x65, 0x20, 0x2d, 0x57, 0x73, 
+    0x65, 0x71, 0x75, 0x65, 0x6e, 0x63, 0x65, 0x2d, 
+    0x70, 0x6f, 0x69, 0x6e, 0x74, 0x20, 0x2d, 0x57, 
+    0x73, 0x69, 0x67, 0x6e, 0x2d, 0x63, 0x6f, 0x6d, 
+    0x70, 0x61, 0x72, 0x65, 0x20, 0x2d, 0x57, 0x73, 
+    0x74, 0x72, 0x69, 0x63, 0x74, 0x2d, 0x61, 0x6c, 
+    0x69, 0x61, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x2d, 
+    0x57, 0x73, 0x74, 0x72, 0x69, 0x63, 0x74, 0x2d, 
+    0x61, 0x6c, 0x69, 0x61, 0x73, 0x69, 0x6e, 0x67, 
+    0x3d, 0x32, 0x20, 0x2d, 0x57, 0x73, 0x77, 0x69, 
+    0x74, 0x63, 0x68, 0x20, 0x2d, 0x57, 0x73, 0x77, 
+    0x69, 0x74, 0x63, 0x68, 0x2d, 0x64, 0x65, 0x66, 
+    0x61, 0x75, 0x6c, 0x74, 0x20, 0x2d, 0x57, 0x65, 
+    0x72, 0x72, 0x6f, 0x72, 0x3d, 0x75, 0x6e, 0x64, 
+    0x65, 0x66, 0x20, 0x2d, 0x57, 0x6e, 0x6f, 0x2d, 
+    0x75, 0x6e, 0x75, 0x73, 0x65, 0x64, 0x20, 0x2d, 
+    0x57, 0x76, 0x61, 0x72, 0x69, 0x61, 0x64, 0x69, 
+    0x63, 0x2d, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x73, 
+    0x20, 0x2d, 0x57, 0x77, 0x72, 0x69, 0x74, 0x65, 
+    0x2d, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x73, 
+    0x20, 0x2d, 0x57, 0x73, 0x74, 0x61, 0x63, 0x6b, 
+    0x2d, 0x75, 0x73, 0x61, 0x67, 0x65, 0x3d, 0x35, 
+    0x30, 0x30, 0x20, 0x2d, 0x57, 0x63, 0x2b, 0x2b, 
+    0x2d, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x74, 0x20, 
+    0x2d, 0x57, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x3d, 
+    0x64, 0x65, 0x63, 0x6c, 0x61, 0x72, 0x61, 0x74, 
+    0x69, 0x6f, 0x6e, 0x2d, 0x61, 0x66, 0x74, 0x65, 
+    0x72, 0x2d, 0x73, 0x74, 0x61, 0x74, 0x65, 0x6d, 
+    0x65, 0x6e, 0x74, 0x20, 0x2d, 0x57, 0x65, 0x72, 
+    0x72, 0x6f, 0x72, 0x3d, 0x69, 0x6d, 0x70, 0x6c, 
+    0x69, 0x63, 0x69, 0x74, 0x2d, 0x66, 0x75, 0x6e, 
+    0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2d, 0x64, 0x65, 
+    0x63, 0x6c, 0x61, 0x72, 0x61, 0x74, 0x69, 0x6f, 
+    0x6e, 0x20, 0x2d, 0x57, 0x65, 0x72, 0x72, 0x6f, 
+    0x72, 0x3d, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6e, 
+    0x67, 0x2d, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x74, 
+    0x79, 0x70, 0x65, 0x73, 0x20, 0x2d, 0x57, 0x65, 
+    0x72, 0x72, 0x6f, 0x72, 0x3d, 0x6e, 0x65, 0x73, 
+    0x74, 0x65, 0x64, 0x2d, 0x65, 0x78, 0x74, 0x65, 
+    0x72, 0x6e, 0x73, 0x20, 0x2d, 0x57, 0x65, 0x72, 
+    0x72, 0x6f, 0x72, 0x3d, 0x6f, 0x6c, 0x64, 0x2d, 
+    0x73, 0x74, 0x79, 0x6c, 0x65, 0x2d, 0x64, 0x65, 
+    0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e, 
+    0x20, 0x2d, 0x57, 0x65, 0x72, 0x72, 0x6f, 0x72, 
+    0x3d, 0x73, 0x74, 0x72, 0x69, 0x63, 0x74, 0x2d, 
+    0x70, 0x72, 0x6f, 0x74, 0x6f, 0x74, 0x79, 0x70, 
+    0x65, 0x73, 0x20, 0x2d, 0x66, 0x76, 0x69, 0x73, 
+    0x69, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x3d, 
+    0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x63, 0x63, 0x77, 0x61, 0x72, 0x6e, 0x3a, 0x3a, 
+    0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x72, 
+    0x73, 0x2f, 0x69, 0x6d, 0x63, 0x63, 0x2f, 0x6f, 
+    0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, 0x65, 0x72, 
+    0x2e, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x66, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2d, 0x66, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x2d, 
+    0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+    0x73, 0x3d, 0x31, 0x36, 0x20, 0x2d, 0x66, 0x75, 
+    0x6e, 0x69, 0x74, 0x2d, 0x61, 0x74, 0x2d, 0x61, 
+    0x2d, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x2d, 0x66, 
+    0x65, 0x78, 0x63, 0x65, 0x73, 0x73, 0x2d, 0x70, 
+    0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e, 
+    0x3d, 0x73, 0x74, 0x61, 0x6e, 0x64, 0x61, 0x72, 
+    0x64, 0x20, 0x2d, 0x6d, 0x61, 0x63, 0x63, 0x75, 
+    0x6d, 0x75, 0x6c, 0x61, 0x74, 0x65, 0x2d, 0x6f, 
+    0x75, 0x74, 0x67, 0x6f, 0x69, 0x6e, 0x67, 0x2d, 
+    0x61, 0x72, 0x67, 0x73, 0x20, 0x2d, 0x57, 0x61, 
+    0x6c, 0x6c, 0x20, 0x2d, 0x57, 0x65, 0x78, 0x74, 
+    0x72, 0x61, 0x20, 0x2d, 0x57, 0x61, 0x67, 0x67, 
+    0x72, 0x65, 0x67, 0x61, 0x74, 0x65, 0x2d, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x2d, 0x57, 
+    0x63, 0x61, 0x73, 0x74, 0x2d, 0x71, 0x75, 0x61, 
+    0x6c, 0x20, 0x2d, 0x57, 0x64, 0x69, 0x73, 0x61, 
+    0x62, 0x6c, 0x65, 0x64, 0x2d, 0x6f, 0x70, 0x74, 
+    0x69, 0x6d, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 
+    0x6e, 0x20, 0x2d, 0x57, 0x64, 0x69, 0x76, 0x2d, 
+    0x62, 0x79, 0x2d, 0x7a, 0x65, 0x72, 0x6f, 0x20, 
+    0x2d, 0x57, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x2d, 
+    0x6c, 0x61, 0x62, 0x65, 0x6c, 0x73, 0x20, 0x2d, 
+    0x57, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x2d, 
+    0x65, 0x78, 0x74, 0x72, 0x61, 0x2d, 0x61, 0x72, 
+    0x67, 0x73, 0x20, 0x2d, 0x57, 0x66, 0x6f, 0x72, 
+    0x6d, 0x61, 0x74, 0x2d, 0x73, 0x65, 0x63, 0x75, 
+    0x72, 0x69, 0x74, 0x79, 0x20, 0x2d, 0x57, 0x66, 
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x2d, 0x79, 0x32, 
+    0x6b, 0x20, 0x2d, 0x57, 0x69, 0x6d, 0x70, 0x6c, 
+    0x69, 0x63, 0x69, 0x74, 0x20, 0x2d, 0x57, 0x69, 
+    0x6d, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x2d, 0x57, 
+    0x69, 0x6e, 0x69, 0x74, 0x2d, 0x73, 0x65, 0x6c, 
+    0x66, 0x20, 0x2d, 0x57, 0x69, 0x6e, 0x6c, 0x69, 
+    0x6e, 0x65, 0x20, 0x2d, 0x57, 0x69, 0x6e, 0x76, 
+    0x61, 0x6c, 0x69, 0x64, 0x2d, 0x70, 0x63, 0x68, 
+    0x20, 0x2d, 0x57, 0x6a, 0x75, 0x6d, 0x70, 0x2d, 
+    0x6d, 0x69, 0x73, 0x73, 0x65, 0x73, 0x2d, 0x69, 
+    0x6e, 0x69, 0x74, 0x20, 0x2d, 0x57, 0x6c, 0x6f, 
+    0x67, 0x69, 0x63, 0x61, 0x6c, 0x2d, 0x6f, 0x70, 
+    0x20, 0x2d, 0x57, 0x65, 0x72, 0x72, 0x6f, 0x72, 
+    0x3d, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6e, 0x67, 
+    0x2d, 0x62, 0x72, 0x61, 0x63, 0x65, 0x73, 0x20, 
+    0x2d, 0x57, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x3d, 
+    0x6d, 0x69, 0x73, 0x73, 0x69, 0x6e, 0x67, 0x2d, 
+    0x64, 0x65, 0x63, 0x6c, 0x61, 0x72, 0x61, 0x74, 
+    0x69, 0x6f, 0x6e, 0x73, 0x20, 0x2d, 0x57, 0x6e, 
+    0x6f, 0x2d, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6e, 
+    0x67, 0x2d, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 
+    0x2d, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 
+    0x74, 0x65, 0x20, 0x2d, 0x57, 0x6d, 0x69, 0x73, 
+    0x73, 0x69, 0x6e, 0x67, 0x2d, 0x69, 0x6e, 0x63, 
+    0x6c, 0x75, 0x64, 0x65, 0x2d, 0x64, 0x69, 0x72, 
+    0x73, 0x20, 0x2d, 0x57, 0x6d, 0x75, 0x6c, 0x74, 
+    0x69, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2d, 0x57, 
+    0x70, 0x61, 0x63, 0x6b, 0x65, 0x64, 0x20, 0x2d, 
+    0x57, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 
+    0x2d, 0x61, 0x72, 0x69, 0x74, 0x68, 0x20, 0x2d, 
+    0x57, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x2d, 
+    0x74, 0x79, 0x70, 0x65, 0x20, 0x2d, 0x57, 0x73, 
+    0x65, 0x71, 0x75, 0x65, 0x6e, 0x63, 0x65, 0x2d, 
+    0x70, 0x6f, 0x69, 0x6e, 0x74, 0x20, 0x2d, 0x57, 
+    0x73, 0x69, 0x67, 0x6e, 0x2d, 0x63, 0x6f, 0x6d, 
+    0x70, 0x61, 0x72, 0x65, 0x20, 0x2d, 0x57, 0x73, 
+    0x74, 0x72, 0x69, 0x63, 0x74, 0x2d, 0x61, 0x6c, 
+    0x69, 0x61, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x2d, 
+    0x57, 0x73, 0x74, 0x72, 0x69, 0x63, 0x74, 0x2d, 
+    0x61, 0x6c, 0x69, 0x61, 0x73, 0x69, 0x6e, 0x67, 
+    0x3d, 0x32, 0x20, 0x2d, 0x57, 0x73, 0x77, 0x69, 
+    0x74, 0x63, 0x68, 0x20, 0x2d, 0x57, 0x73, 0x77, 
+    0x69, 0x74, 0x63, 0x68, 0x2d, 0x64, 0x65, 0x66, 
+    0x61, 0x75, 0x6c, 0x74, 0x20, 0x2d, 0x57, 0x65, 
+    0x72, 0x72, 0x6f, 0x72, 0x3d, 0x75, 0x6e, 0x64, 
+    0x65, 0x66, 0x20, 0x2d, 0x57, 0x6e, 0x6f, 0x2d, 
+    0x75, 0x6e, 0x75, 0x73, 0x65, 0x64, 0x20, 0x2d, 
+    0x57, 0x76, 0x61, 0x72, 0x69, 0x61, 0x64, 0x69, 
+    0x63, 0x2d, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x73, 
+    0x20, 0x2d, 0x57, 0x77, 0x72, 0x69, 0x74, 0x65, 
+    0x2d, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x73, 
+    0x20, 0x2d, 0x57, 0x73, 0x74, 0x61, 0x63, 0x6b, 
+    0x2d, 0x75, 0x73, 0x61, 0x67, 0x65, 0x3d, 0x35, 
+    0x30, 0x30, 0x20, 0x2d, 0x57, 0x63, 0x2b, 0x2b, 
+    0x2d, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x74, 0x20, 
+    0x2d, 0x57, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x3d, 
+    0x64, 0x65, 0x63, 0x6c, 0x61, 0x72, 0x61, 0x74, 
+    0x69, 0x6f, 0x6e, 0x2d, 0x61, 0x66, 0x74, 0x65, 
+    0x72, 0x2d, 0x73, 0x74, 0x61, 0x74, 0x65, 0x6d, 
+    0x65, 0x6e, 0x74, 0x20, 0x2d, 0x57, 0x65, 0x72, 
+    0x72, 0x6f, 0x72, 0x3d, 0x69, 0x6d, 0x70, 0x6c, 
+    0x69, 0x63, 0x69, 0x74, 0x2d, 0x66, 0x75, 0x6e, 
+    0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2d, 0x64, 0x65, 
+    0x63, 0x6c, 0x61, 0x72, 0x61, 0x74, 0x69, 0x6f, 
+    0x6e, 0x20, 0x2d, 0x57, 0x65, 0x72, 0x72, 0x6f, 
+    0x72, 0x3d, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6e, 
+    0x67, 0x2d, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x74, 
+    0x79, 0x70, 0x65, 0x73, 0x20, 0x2d, 0x57, 0x65, 
+    0x72, 0x72, 0x6f, 0x72, 0x3d, 0x6e, 0x65, 0x73, 
+    0x74, 0x65, 0x64, 0x2d, 0x65, 0x78, 0x74, 0x65, 
+    0x72, 0x6e, 0x73, 0x20, 0x2d, 0x57, 0x65, 0x72, 
+    0x72, 0x6f, 0x72, 0x3d, 0x6f, 0x6c, 0x64, 0x2d, 
+    0x73, 0x74, 0x79, 0x6c, 0x65, 0x2d, 0x64, 0x65, 
+    0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e, 
+    0x20, 0x2d, 0x57, 0x65, 0x72, 0x72, 0x6f, 0x72, 
+    0x3d, 0x73, 0x74, 0x72, 0x69, 0x63, 0x74, 0x2d, 
+    0x70, 0x72, 0x6f, 0x74, 0x6f, 0x74, 0x79, 0x70, 
+    0x65, 0x73, 0x20, 0x2d, 0x66, 0x76, 0x69, 0x73, 
+    0x69, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x3d, 
+    0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x63, 0x63, 0x77, 0x61, 0x72, 0x6e, 0x3a, 0x3a, 
+    0x73, 0x72, 0x63, 0x2f, 0x65, 0x78, 0x74, 0x72, 
+    0x61, 0x5f, 0x6e, 0x63, 0x69, 0x5f, 0x74, 0x68, 
+    0x75, 0x6e, 0x6b, 0x73, 0x2e, 0x63, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x7a, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2d, 0x66, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x2d, 
+    0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+    0x73, 0x3d, 0x31, 0x36, 0x20, 0x2d, 0x66, 0x75, 
+    0x6e, 0x69, 0x74, 0x2d, 0x61, 0x74, 0x2d, 0x61, 
+    0x2d, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x2d, 0x66, 
+    0x65, 0x78, 0x63, 0x65, 0x73, 0x73, 0x2d, 0x70, 
+    0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e, 
+    0x3d, 0x73, 0x74, 0x61, 0x6e, 0x64, 0x61, 0x72, 
+    0x64, 0x20, 0x2d, 0x6d, 0x61, 0x63, 0x63, 0x75, 
+    0x6d, 0x75, 0x6c, 0x61, 0x74, 0x65, 0x2d, 0x6f, 
+    0x75, 0x74, 0x67, 0x6f, 0x69, 0x6e, 0x67, 0x2d, 
+    0x61, 0x72, 0x67, 0x73, 0x20, 0x2d, 0x57, 0x61, 
+    0x6c, 0x6c, 0x20, 0x2d, 0x57, 0x65, 0x78, 0x74, 
+    0x72, 0x61, 0x20, 0x2d, 0x57, 0x61, 0x67, 0x67, 
+    0x72, 0x65, 0x67, 0x61, 0x74, 0x65, 0x2d, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x2d, 0x57, 
+    0x63, 0x61, 0x73, 0x74, 0x2d, 0x71, 0x75, 0x61, 
+    0x6c, 0x20, 0x2d, 0x57, 0x64, 0x69, 0x73, 0x61, 
+    0x62, 0x6c, 0x65, 0x64, 0x2d, 0x6f, 0x70, 0x74, 
+    0x69, 0x6d, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 
+    0x6e, 0x20, 0x2d, 0x57, 0x64, 0x69, 0x76, 0x2d, 
+    0x62, 0x79, 0x2d, 0x7a, 0x65, 0x72, 0x6f, 0x20, 
+    0x2d, 0x57, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x2d, 
+    0x6c, 0x61, 0x62, 0x65, 0x6c, 0x73, 0x20, 0x2d, 
+    0x57, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x2d, 
+    0x65, 0x78, 0x74, 0x72, 0x61, 0x2d, 0x61, 0x72, 
+    0x67, 0x73, 0x20, 0x2d, 0x57, 0x66, 0x6f, 0x72, 
+    0x6d, 0x61, 0x74, 0x2d, 0x6e, 0x6f, 0x6e, 0x6c, 
+    0x69, 0x74, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x2d, 
+    0x57, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x2d, 
+    0x73, 0x65, 0x63, 0x75, 0x72, 0x69, 0x74, 0x79, 
+    0x20, 0x2d, 0x57, 0x66, 0x6f, 0x72, 0x6d, 0x61, 
+    0x74, 0x2d, 0x79, 0x32, 0x6b, 0x20, 0x2d, 0x57, 
+    0x69, 0x6d, 0x70, 0x6c, 0x69, 0x63, 0x69, 0x74, 
+    0x20, 0x2d, 0x57, 0x69, 0x6d, 0x70, 0x6f, 0x72, 
+    0x74, 0x20, 0x2d, 0x57, 0x69, 0x6e, 0x69, 0x74, 
+    0x2d, 0x73, 0x65, 0x6c, 0x66, 0x20, 0x2d, 0x57, 
+    0x69, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x2d, 
+    0x57, 0x69, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 
+    0x2d, 0x70, 0x63, 0x68, 0x20, 0x2d, 0x57, 0x6a, 
+    0x75, 0x6d, 0x70, 0x2d, 0x6d, 0x69, 0x73, 0x73, 
+    0x65, 0x73, 0x2d, 0x69, 0x6e, 0x69, 0x74, 0x20, 
+    0x2d, 0x57, 0x6c, 0x6f, 0x67, 0x69, 0x63, 0x61, 
+    0x6c, 0x2d, 0x6f, 0x70, 0x20, 0x2d, 0x57, 0x65, 
+    0x72, 0x72, 0x6f, 0x72, 0x3d, 0x6d, 0x69, 0x73, 
+    0x73, 0x69, 0x6e, 0x67, 0x2d, 0x62, 0x72, 0x61, 
+    0x63, 0x65, 0x73, 0x20, 0x2d, 0x57, 0x65, 0x72, 
+    0x72, 0x6f, 0x72, 0x3d, 0x6d, 0x69, 0x73, 0x73, 
+    0x69, 0x6e, 0x67, 0x2d, 0x64, 0x65, 0x63, 0x6c, 
+    0x61, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 
+    0x20, 0x2d, 0x57, 0x6e, 0x6f, 0x2d, 0x6d, 0x69, 
+    0x73, 0x73, 0x69, 0x6e, 0x67, 0x2d, 0x66, 0x6f, 
+    0x72, 0x6d, 0x61, 0x74, 0x2d, 0x61, 0x74, 0x74, 
+    0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x2d, 
+    0x57, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6e, 0x67, 
+    0x2d, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 
+    0x2d, 0x64, 0x69, 0x72, 0x73, 0x20, 0x2d, 0x57, 
+    0x6d, 0x75, 0x6c, 0x74, 0x69, 0x63, 0x68, 0x61, 
+    0x72, 0x20, 0x2d, 0x57, 0x70, 0x61, 0x63, 0x6b, 
+    0x65, 0x64, 0x20, 0x2d, 0x57, 0x70, 0x6f, 0x69, 
+    0x6e, 0x74, 0x65, 0x72, 0x2d, 0x61, 0x72, 0x69, 
+    0x74, 0x68, 0x20, 0x2d, 0x57, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6e, 0x2d, 0x74, 0x79, 0x70, 0x65, 
+    0x20, 0x2d, 0x57, 0x73, 0x65, 0x71, 0x75, 0x65, 
+    0x6e, 0x63, 0x65, 0x2d, 0x70, 0x6f, 0x69, 0x6e, 
+    0x74, 0x20, 0x2d, 0x57, 0x73, 0x69, 0x67, 0x6e, 
+    0x2d, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x72, 0x65, 
+    0x20, 0x2d, 0x57, 0x73, 0x74, 0x72, 0x69, 0x63, 
+    0x74, 0x2d, 0x61, 0x6c, 0x69, 0x61, 0x73, 0x69, 
+    0x6e, 0x67, 0x20, 0x2d, 0x57, 0x73, 0x74, 0x72, 
+    0x69, 0x63, 0x74, 0x2d, 0x61, 0x6c, 0x69, 0x61, 
+    0x73, 0x69, 0x6e, 0x67, 0x3d, 0x32, 0x20, 0x2d, 
+    0x57, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x20, 
+    0x2d, 0x57, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 
+    0x2d, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 
+    0x20, 0x2d, 0x57, 0x65, 0x72, 0x72, 0x6f, 0x72, 
+    0x3d, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x20, 0x2d, 
+    0x57, 0x6e, 0x6f, 0x2d, 0x75, 0x6e, 0x75, 0x73, 
+    0x65, 0x64, 0x20, 0x2d, 0x57, 0x76, 0x61, 0x72, 
+    0x69, 0x61, 0x64, 0x69, 0x63, 0x2d, 0x6d, 0x61, 
+    0x63, 0x72, 0x6f, 0x73, 0x20, 0x2d, 0x57, 0x77, 
+    0x72, 0x69, 0x74, 0x65, 0x2d, 0x73, 0x74, 0x72, 
+    0x69, 0x6e, 0x67, 0x73, 0x20, 0x2d, 0x57, 0x73, 
+    0x74, 0x61, 0x63, 0x6b, 0x2d, 0x75, 0x73, 0x61, 
+    0x67, 0x65, 0x3d, 0x35, 0x30, 0x30, 0x20, 0x2d, 
+    0x57, 0x63, 0x2b, 0x2b, 0x2d, 0x63, 0x6f, 0x6d, 
+    0x70, 0x61, 0x74, 0x20, 0x2d, 0x57, 0x65, 0x72, 
+    0x72, 0x6f, 0x72, 0x3d, 0x64, 0x65, 0x63, 0x6c, 
+    0x61, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2d, 
+    0x61, 0x66, 0x74, 0x65, 0x72, 0x2d, 0x73, 0x74, 
+    0x61, 0x74, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 
+    0x2d, 0x57, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x3d, 
+    0x69, 0x6d, 0x70, 0x6c, 0x69, 0x63, 0x69, 0x74, 
+    0x2d, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 
+    0x6e, 0x2d, 0x64, 0x65, 0x63, 0x6c, 0x61, 0x72, 
+    0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x2d, 0x57, 
+    0x65, 0x72, 0x72, 0x6f, 0x72, 0x3d, 0x6d, 0x69, 
+    0x73, 0x73, 0x69, 0x6e, 0x67, 0x2d, 0x70, 0x72, 
+    0x6f, 0x74, 0x6f, 0x74, 0x79, 0x70, 0x65, 0x73, 
+    0x20, 0x2d, 0x57, 0x65, 0x72, 0x72, 0x6f, 0x72, 
+    0x3d, 0x6e, 0x65, 0x73, 0x74, 0x65, 0x64, 0x2d, 
+    0x65, 0x78, 0x74, 0x65, 0x72, 0x6e, 0x73, 0x20, 
+    0x2d, 0x57, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x3d, 
+    0x6f, 0x6c, 0x64, 0x2d, 0x73, 0x74, 0x79, 0x6c, 
+    0x65, 0x2d, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x69, 
+    0x74, 0x69, 0x6f, 0x6e, 0x20, 0x2d, 0x57, 0x65, 
+    0x72, 0x72, 0x6f, 0x72, 0x3d, 0x73, 0x74, 0x72, 
+    0x69, 0x63, 0x74, 0x2d, 0x70, 0x72, 0x6f, 0x74, 
+    0x6f, 0x74, 0x79, 0x70, 0x65, 0x73, 0x20, 0x2d, 
+    0x66, 0x76, 0x69, 0x73, 0x69, 0x62, 0x69, 0x6c, 
+    0x69, 0x74, 0x79, 0x3d, 0x68, 0x69, 0x64, 0x64, 
+    0x65, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x63, 0x63, 0x77, 0x61, 0x72, 0x6e, 0x3a, 0x3a, 
+    0x73, 0x72, 0x63, 0x2f, 0x6e, 0x63, 0x69, 0x2f, 
+    0x65, 0x78, 0x74, 0x72, 0x61, 0x5f, 0x74, 0x68, 
+    0x75, 0x6e, 0x6b, 0x73, 0x2e, 0x63, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x7a, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2d, 0x66, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x2d, 
+    0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+    0x73, 0x3d, 0x31, 0x36, 0x20, 0x2d, 0x66, 0x75, 
+    0x6e, 0x69, 0x74, 0x2d, 0x61, 0x74, 0x2d, 0x61, 
+    0x2d, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x2d, 0x66, 
+    0x65, 0x78, 0x63, 0x65, 0x73, 0x73, 0x2d, 0x70, 
+    0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e, 
+    0x3d, 0x73, 0x74, 0x61, 0x6e, 0x64, 0x61, 0x72, 
+    0x64, 0x20, 0x2d, 0x6d, 0x61, 0x63, 0x63, 0x75, 
+    0x6d, 0x75, 0x6c, 0x61, 0x74, 0x65, 0x2d, 0x6f, 
+    0x75, 0x74, 0x67, 0x6f, 0x69, 0x6e, 0x67, 0x2d, 
+    0x61, 0x72, 0x67, 0x73, 0x20, 0x2d, 0x57, 0x61, 
+    0x6c, 0x6c, 0x20, 0x2d, 0x57, 0x65, 0x78, 0x74, 
+    0x72, 0x61, 0x20, 0x2d, 0x57, 0x61, 0x67, 0x67, 
+    0x72, 0x65, 0x67, 0x61, 0x74, 0x65, 0x2d, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x2d, 0x57, 
+    0x63, 0x61, 0x73, 0x74, 0x2d, 0x71, 0x75, 0x61, 
+    0x6c, 0x20, 0x2d, 0x57, 0x64, 0x69, 0x73, 0x61, 
+    0x62, 0x6c, 0x65, 0x64, 0x2d, 0x6f, 0x70, 0x74, 
+    0x69, 0x6d, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 
+    0x6e, 0x20, 0x2d, 0x57, 0x64, 0x69, 0x76, 0x2d, 
+    0x62, 0x79, 0x2d, 0x7a, 0x65, 0x72, 0x6f, 0x20, 
+    0x2d, 0x57, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x2d, 
+    0x6c, 0x61, 0x62, 0x65, 0x6c, 0x73, 0x20, 0x2d, 
+    0x57, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x2d, 
+    0x65, 0x78, 0x74, 0x72, 0x61, 0x2d, 0x61, 0x72, 
+    0x67, 0x73, 0x20, 0x2d, 0x57, 0x66, 0x6f, 0x72, 
+    0x6d, 0x61, 0x74, 0x2d, 0x6e, 0x6f, 0x6e, 0x6c, 
+    0x69, 0x74, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x2d, 
+    0x57, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x2d, 
+    0x73, 0x65, 0x63, 0x75, 0x72, 0x69, 0x74, 0x79, 
+    0x20, 0x2d, 0x57, 0x66, 0x6f, 0x72, 0x6d, 0x61, 
+    0x74, 0x2d, 0x79, 0x32, 0x6b, 0x20, 0x2d, 0x57, 
+    0x69, 0x6d, 0x70, 0x6c, 0x69, 0x63, 0x69, 0x74, 
+    0x20, 0x2d, 0x57, 0x69, 0x6d, 0x70, 0x6f, 0x72, 
+    0x74, 0x20, 0x2d, 0x57, 0x69, 0x6e, 0x69, 0x74, 
+    0x2d, 0x73, 0x65, 0x6c, 0x66, 0x20, 0x2d, 0x57, 
+    0x69, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x2d, 
+    0x57, 0x69, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 
+    0x2d, 0x70, 0x63, 0x68, 0x20, 0x2d, 0x57, 0x6a, 
+    0x75, 0x6d, 0x70, 0x2d, 0x6d, 0x69, 0x73, 0x73, 
+    0x65, 0x73, 0x2d, 0x69, 0x6e, 0x69, 0x74, 0x20, 
+    0x2d, 0x57, 0x6c, 0x6f, 0x67, 0x69, 0x63, 0x61, 
+    0x6c, 0x2d, 0x6f, 0x70, 0x20, 0x2d, 0x57, 0x65, 
+    0x72, 0x72, 0x6f, 0x72, 0x3d, 0x6d, 0x69, 0x73, 
+    0x73, 0x69, 0x6e, 0x67, 0x2d, 0x62, 0x72, 0x61, 
+    0x63, 0x65, 0x73, 0x20, 0x2d, 0x57, 0x65, 0x72, 
+    0x72, 0x6f, 0x72, 0x3d, 0x6d, 0x69, 0x73, 0x73, 
+    0x69, 0x6e, 0x67, 0x2d, 0x64, 0x65, 0x63, 0x6c, 
+    0x61, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 
+    0x20, 0x2d, 0x57, 0x6e, 0x6f, 0x2d, 0x6d, 0x69, 
+    0x73, 0x73, 0x69, 0x6e, 0x67, 0x2d, 0x66, 0x6f, 
+    0x72, 0x6d, 0x61, 0x74, 0x2d, 0x61, 0x74, 0x74, 
+    0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x2d, 
+    0x57, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6e, 0x67, 
+    0x2d, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 
+    0x2d, 0x64, 0x69, 0x72, 0x73, 0x20, 0x2d, 0x57, 
+    0x6d, 0x75, 0x6c, 0x74, 0x69, 0x63, 0x68, 0x61, 
+    0x72, 0x20, 0x2d, 0x57, 0x70, 0x61, 0x63, 0x6b, 
+    0x65, 0x64, 0x20, 0x2d, 0x57, 0x70, 0x6f, 0x69, 
+    0x6e, 0x74, 0x65, 0x72, 0x2d, 0x61, 0x72, 0x69, 
+    0x74, 0x68, 0x20, 0x2d, 0x57, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6e, 0x2d, 0x74, 0x79, 0x70, 0x65, 
+    0x20, 0x2d, 0x57, 0x73, 0x65, 0x71, 0x75, 0x65, 
+    0x6e, 0x63, 0x65, 0x2d, 0x70, 0x6f, 0x69, 0x6e, 
+    0x74, 0x20, 0x2d, 0x57, 0x73, 0x69, 0x67, 0x6e, 
+    0x2d, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x72, 0x65, 
+    0x20, 0x2d, 0x57, 0x73, 0x74, 0x72, 0x69, 0x63, 
+    0x74, 0x2d, 0x61, 0x6c, 0x69, 0x61, 0x73, 0x69, 
+    0x6e, 0x67, 0x20, 0x2d, 0x57, 0x73, 0x74, 0x72, 
+    0x69, 0x63, 0x74, 0x2d, 0x61, 0x6c, 0x69, 0x61, 
+    0x73, 0x69, 0x6e, 0x67, 0x3d, 0x32, 0x20, 0x2d, 
+    0x57, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x20, 
+    0x2d, 0x57, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 
+    0x2d, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 
+    0x20, 0x2d, 0x57, 0x65, 0x72, 0x72, 0x6f, 0x72, 
+    0x3d, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x20, 0x2d, 
+    0x57, 0x6e, 0x6f, 0x2d, 0x75, 0x6e, 0x75, 0x73, 
+    0x65, 0x64, 0x20, 0x2d, 0x57, 0x76, 0x61, 0x72, 
+    0x69, 0x61, 0x64, 0x69, 0x63, 0x2d, 0x6d, 0x61, 
+    0x63, 0x72, 0x6f, 0x73, 0x20, 0x2d, 0x57, 0x77, 
+    0x72, 0x69, 0x74, 0x65, 0x2d, 0x73, 0x74, 0x72, 
+    0x69, 0x6e, 0x67, 0x73, 0x20, 0x2d, 0x57, 0x73, 
+    0x74, 0x61, 0x63, 0x6b, 0x2d, 0x75, 0x73, 0x61, 
+    0x67, 0x65, 0x3d, 0x35, 0x30, 0x30, 0x20, 0x2d, 
+    0x57, 0x63, 0x2b, 0x2b, 0x2d, 0x63, 0x6f, 0x6d, 
+    0x70, 0x61, 0x74, 0x20, 0x2d, 0x57, 0x65, 0x72, 
+    0x72, 0x6f, 0x72, 0x3d, 0x64, 0x65, 0x63, 0x6c, 
+    0x61, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2d, 
+    0x61, 0x66, 0x74, 0x65, 0x72, 0x2d, 0x73, 0x74, 
+    0x61, 0x74, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 
+    0x2d, 0x57, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x3d, 
+    0x69, 0x6d, 0x70, 0x6c, 0x69, 0x63, 0x69, 0x74, 
+    0x2d, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 
+    0x6e, 0x2d, 0x64, 0x65, 0x63, 0x6c, 0x61, 0x72, 
+    0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x2d, 0x57, 
+    0x65, 0x72, 0x72, 0x6f, 0x72, 0x3d, 0x6d, 0x69, 
+    0x73, 0x73, 0x69, 0x6e, 0x67, 0x2d, 0x70, 0x72, 
+    0x6f, 0x74, 0x6f, 0x74, 0x79, 0x70, 0x65, 0x73, 
+    0x20, 0x2d, 0x57, 0x65, 0x72, 0x72, 0x6f, 0x72, 
+    0x3d, 0x6e, 0x65, 0x73, 0x74, 0x65, 0x64, 0x2d, 
+    0x65, 0x78, 0x74, 0x65, 0x72, 0x6e, 0x73, 0x20, 
+    0x2d, 0x57, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x3d, 
+    0x6f, 0x6c, 0x64, 0x2d, 0x73, 0x74, 0x79, 0x6c, 
+    0x65, 0x2d, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x69, 
+    0x74, 0x69, 0x6f, 0x6e, 0x20, 0x2d, 0x57, 0x65, 
+    0x72, 0x72, 0x6f, 0x72, 0x3d, 0x73, 0x74, 0x72, 
+    0x69, 0x63, 0x74, 0x2d, 0x70, 0x72, 0x6f, 0x74, 
+    0x6f, 0x74, 0x79, 0x70, 0x65, 0x73, 0x20, 0x2d, 
+    0x66, 0x76, 0x69, 0x73, 0x69, 0x62, 0x69, 0x6c, 
+    0x69, 0x74, 0x79, 0x3d, 0x68, 0x69, 0x64, 0x64, 
+    0x65, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x63, 0x63, 0x77, 0x61, 0x72, 0x6e, 0x3a, 0x3a, 
+    0x73, 0x72, 0x63, 0x2f, 0x6f, 0x70, 0x73, 0x2f, 
+    0x63, 0x6f, 0x72, 0x65, 0x5f, 0x6f, 0x70, 0x73, 
+    0x2e, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x94, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2d, 0x66, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x2d, 
+    0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+    0x73, 0x3d, 0x31, 0x36, 0x20, 0x2d, 0x66, 0x75, 
+    0x6e, 0x69, 0x74, 0x2d, 0x61, 0x74, 0x2d, 0x61, 
+    0x2d, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x2d, 0x66, 
+    0x65, 0x78, 0x63, 0x65, 0x73, 0x73, 0x2d, 0x70, 
+    0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e, 
+    0x3d, 0x73, 0x74, 0x61, 0x6e, 0x64, 0x61, 0x72, 
+    0x64, 0x20, 0x2d, 0x6d, 0x61, 0x63, 0x63, 0x75, 
+    0x6d, 0x75, 0x6c, 0x61, 0x74, 0x65, 0x2d, 0x6f, 
+    0x75, 0x74, 0x67, 0x6f, 0x69, 0x6e, 0x67, 0x2d, 
+    0x61, 0x72, 0x67, 0x73, 0x20, 0x2d, 0x57, 0x61, 
+    0x6c, 0x6c, 0x20, 0x2d, 0x57, 0x65, 0x78, 0x74, 
+    0x72, 0x61, 0x20, 0x2d, 0x57, 0x61, 0x67, 0x67, 
+    0x72, 0x65, 0x67, 0x61, 0x74, 0x65, 0x2d, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x2d, 0x57, 
+    0x63, 0x61, 0x73, 0x74, 0x2d, 0x71, 0x75, 0x61, 
+    0x6c, 0x20, 0x2d, 0x57, 0x64, 0x69, 0x73, 0x61, 
+    0x62, 0x6c, 0x65, 0x64, 0x2d, 0x6f, 0x70, 0x74, 
+    0x69, 0x6d, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 
+    0x6e, 0x20, 0x2d, 0x57, 0x64, 0x69, 0x76, 0x2d, 
+    0x62, 0x79, 0x2d, 0x7a, 0x65, 0x72, 0x6f, 0x20, 
+    0x2d, 0x57, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x2d, 
+    0x6c, 0x61, 0x62, 0x65, 0x6c, 0x73, 0x20, 0x2d, 
+    0x57, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x2d, 
+    0x65, 0x78, 0x74, 0x72, 0x61, 0x2d, 0x61, 0x72, 
+    0x67, 0x73, 0x20, 0x2d, 0x57, 0x66, 0x6f, 0x72, 
+    0x6d, 0x61, 0x74, 0x2d, 0x6e, 0x6f, 0x6e, 0x6c, 
+    0x69, 0x74, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x2d, 
+    0x57, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x2d, 
+    0x73, 0x65, 0x63, 0x75, 0x72, 0x69, 0x74, 0x79, 
+    0x20, 0x2d, 0x57, 0x66, 0x6f, 0x72, 0x6d, 0x61, 
+    0x74, 0x2d, 0x79, 0x32, 0x6b, 0x20, 0x2d, 0x57, 
+    0x69, 0x6d, 0x70, 0x6c, 0x69, 0x63, 0x69, 0x74, 
+    0x20, 0x2d, 0x57, 0x69, 0x6d, 0x70, 0x6f, 0x72, 
+    0x74, 0x20, 0x2d, 0x57, 0x69, 0x6e, 0x69, 0x74, 
+    0x2d, 0x73, 0x65, 0x6c, 0x66, 0x20, 0x2d, 0x57, 
+    0x69, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x2d, 
+    0x57, 0x69, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 
+    0x2d, 0x70, 0x63, 0x68, 0x20, 0x2d, 0x57, 0x6a, 
+    0x75, 0x6d, 0x70, 0x2d, 0x6d, 0x69, 0x73, 0x73, 
+    0x65, 0x73, 0x2d, 0x69, 0x6e, 0x69, 0x74, 0x20, 
+    0x2d, 0x57, 0x6c, 0x6f, 0x67, 0x69, 0x63, 0x61, 
+    0x6c, 0x2d, 0x6f, 0x70, 0x20, 0x2d, 0x57, 0x65, 
+    0x72, 0x72, 0x6f, 0x72, 0x3d, 0x6d, 0x69, 0x73, 
+    0x73, 0x69, 0x6e, 0x67, 0x2d, 0x62, 0x72, 0x61, 
+    0x63, 0x65, 0x73, 0x20, 0x2d, 0x57, 0x65, 0x72, 
+    0x72, 0x6f, 0x72, 0x3d, 0x6d, 0x69, 0x73, 0x73, 
+    0x69, 0x6e, 0x67, 0x2d, 0x64, 0x65, 0x63, 0x6c, 
+    0x61, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 
+    0x20, 0x2d, 0x57, 0x6e, 0x6f, 0x2d, 0x6d, 0x69, 
+    0x73, 0x73, 0x69, 0x6e, 0x67, 0x2d, 0x66, 0x6f, 
+    0x72, 0x6d, 0x61, 0x74, 0x2d, 0x61, 0x74, 0x74, 
+    0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x2d, 
+    0x57, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6e, 0x67, 
+    0x2d, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 
+    0x2d, 0x64, 0x69, 0x72, 0x73, 0x20, 0x2d, 0x57, 
+    0x6d, 0x75, 0x6c, 0x74, 0x69, 0x63, 0x68, 0x61, 
+    0x72, 0x20, 0x2d, 0x57, 0x70, 0x61, 0x63, 0x6b, 
+    0x65, 0x64, 0x20, 0x2d, 0x57, 0x70, 0x6f, 0x69, 
+    0x6e, 0x74, 0x65, 0x72, 0x2d, 0x61, 0x72, 0x69, 
+    0x74, 0x68, 0x20, 0x2d, 0x57, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6e, 0x2d, 0x74, 0x79, 0x70, 0x65, 
+    0x20, 0x2d, 0x57, 0x73, 0x65, 0x71, 0x75, 0x65, 
+    0x6e, 0x63, 0x65, 0x2d, 0x70, 0x6f, 0x69, 0x6e, 
+    0x74, 0x20, 0x2d, 0x57, 0x73, 0x69, 0x67, 0x6e, 
+    0x2d, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x72, 0x65, 
+    0x20, 0x2d, 0x57, 0x73, 0x74, 0x72, 0x69, 0x63, 
+    0x74, 0x2d, 0x61, 0x6c, 0x69, 0x61, 0x73, 0x69, 
+    0x6e, 0x67, 0x20, 0x2d, 0x57, 0x73, 0x74, 0x72, 
+    0x69, 0x63, 0x74, 0x2d, 0x61, 0x6c, 0x69, 0x61, 
+    0x73, 0x69, 0x6e, 0x67, 0x3d, 0x32, 0x20, 0x2d, 
+    0x57, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x20, 
+    0x2d, 0x57, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 
+    0x2d, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 
+    0x20, 0x2d, 0x57, 0x65, 0x72, 0x72, 0x6f, 0x72, 
+    0x3d, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x20, 0x2d, 
+    0x57, 0x6e, 0x6f, 0x2d, 0x75, 0x6e, 0x75, 0x73, 
+    0x65, 0x64, 0x20, 0x2d, 0x57, 0x76, 0x61, 0x72, 
+    0x69, 0x61, 0x64, 0x69, 0x63, 0x2d, 0x6d, 0x61, 
+    0x63, 0x72, 0x6f, 0x73, 0x20, 0x2d, 0x57, 0x77, 
+    0x72, 0x69, 0x74, 0x65, 0x2d, 0x73, 0x74, 0x72, 
+    0x69, 0x6e, 0x67, 0x73, 0x20, 0x2d, 0x57, 0x73, 
+    0x74, 0x61, 0x63, 0x6b, 0x2d, 0x75, 0x73, 0x61, 
+    0x67, 0x65, 0x3d, 0x35, 0x30, 0x30, 0x20, 0x2d, 
+    0x57, 0x63, 0x2b, 0x2b, 0x2d, 0x63, 0x6f, 0x6d, 
+    0x70, 0x61, 0x74, 0x20, 0x2d, 0x57, 0x65, 0x72, 
+    0x72, 0x6f, 0x72, 0x3d, 0x64, 0x65, 0x63, 0x6c, 
+    0x61, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2d, 
+    0x61, 0x66, 0x74, 0x65, 0x72, 0x2d, 0x73, 0x74, 
+    0x61, 0x74, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 
+    0x2d, 0x57, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x3d, 
+    0x69, 0x6d, 0x70, 0x6c, 0x69, 0x63, 0x69, 0x74, 
+    0x2d, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 
+    0x6e, 0x2d, 0x64, 0x65, 0x63, 0x6c, 0x61, 0x72, 
+    0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x2d, 0x57, 
+    0x65, 0x72, 0x72, 0x6f, 0x72, 0x3d, 0x6d, 0x69, 
+    0x73, 0x73, 0x69, 0x6e, 0x67, 0x2d, 0x70, 0x72, 
+    0x6f, 0x74, 0x6f, 0x74, 0x79, 0x70, 0x65, 0x73, 
+    0x20, 0x2d, 0x57, 0x65, 0x72, 0x72, 0x6f, 0x72, 
+    0x3d, 0x6e, 0x65, 0x73, 0x74, 0x65, 0x64, 0x2d, 
+    0x65, 0x78, 0x74, 0x65, 0x72, 0x6e, 0x73, 0x20, 
+    0x2d, 0x57, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x3d, 
+    0x6f, 0x6c, 0x64, 0x2d, 0x73, 0x74, 0x79, 0x6c, 
+    0x65, 0x2d, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x69, 
+    0x74, 0x69, 0x6f, 0x6e, 0x20, 0x2d, 0x57, 0x65, 
+    0x72, 0x72, 0x6f, 0x72, 0x3d, 0x73, 0x74, 0x72, 
+    0x69, 0x63, 0x74, 0x2d, 0x70, 0x72, 0x6f, 0x74, 
+    0x6f, 0x74, 0x79, 0x70, 0x65, 0x73, 0x20, 0x2d, 
+    0x66, 0x76, 0x69, 0x73, 0x69, 0x62, 0x69, 0x6c, 
+    0x69, 0x74, 0x79, 0x3d, 0x68, 0x69, 0x64, 0x64, 
+    0x65, 0x6e, 0x20, 0x2d, 0x57, 0x6e, 0x6f, 0x2d, 
+    0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x68, 0x65, 
+    0x73, 0x65, 0x73, 0x2d, 0x65, 0x71, 0x75, 0x61, 
+    0x6c, 0x69, 0x74, 0x79, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x63, 0x63, 0x77, 0x61, 0x72, 0x6e, 0x3a, 0x3a, 
+    0x73, 0x72, 0x63, 0x2f, 0x73, 0x70, 0x66, 0x5f, 
+    0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x2e, 0x63, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x66, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2d, 0x66, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x2d, 
+    0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+    0x73, 0x3d, 0x31, 0x36, 0x20, 0x2d, 0x66, 0x75, 
+    0x6e, 0x69, 0x74, 0x2d, 0x61, 0x74, 0x2d, 0x61, 
+    0x2d, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x2d, 0x66, 
+    0x65, 0x78, 0x63, 0x65, 0x73, 0x73, 0x2d, 0x70, 
+    0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e, 
+    0x3d, 0x73, 0x74, 0x61, 0x6e, 0x64, 0x61, 0x72, 
+    0x64, 0x20, 0x2d, 0x6d, 0x61, 0x63, 0x63, 0x75, 
+    0x6d, 0x75, 0x6c, 0x61, 0x74, 0x65, 0x2d, 0x6f, 
+    0x75, 0x74, 0x67, 0x6f, 0x69, 0x6e, 0x67, 0x2d, 
+    0x61, 0x72, 0x67, 0x73, 0x20, 0x2d, 0x57, 0x61, 
+    0x6c, 0x6c, 0x20, 0x2d, 0x57, 0x65, 0x78, 0x74, 
+    0x72, 0x61, 0x20, 0x2d, 0x57, 0x61, 0x67, 0x67, 
+    0x72, 0x65, 0x67, 0x61, 0x74, 0x65, 0x2d, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x2d, 0x57, 
+    0x63, 0x61, 0x73, 0x74, 0x2d, 0x71, 0x75, 0x61, 
+    0x6c, 0x20, 0x2d, 0x57, 0x64, 0x69, 0x73, 0x61, 
+    0x62, 0x6c, 0x65, 0x64, 0x2d, 0x6f, 0x70, 0x74, 
+    0x69, 0x6d, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 
+    0x6e, 0x20, 0x2d, 0x57, 0x64, 0x69, 0x76, 0x2d, 
+    0x62, 0x79, 0x2d, 0x7a, 0x65, 0x72, 0x6f, 0x20, 
+    0x2d, 0x57, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x2d, 
+    0x6c, 0x61, 0x62, 0x65, 0x6c, 0x73, 0x20, 0x2d, 
+    0x57, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x2d, 
+    0x65, 0x78, 0x74, 0x72, 0x61, 0x2d, 0x61, 0x72, 
+    0x67, 0x73, 0x20, 0x2d, 0x57, 0x66, 0x6f, 0x72, 
+    0x6d, 0x61, 0x74, 0x2d, 0x73, 0x65, 0x63, 0x75, 
+    0x72, 0x69, 0x74, 0x79, 0x20, 0x2d, 0x57, 0x66, 
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x2d, 0x79, 0x32, 
+    0x6b, 0x20, 0x2d, 0x57, 0x69, 0x6d, 0x70, 0x6c, 
+    0x69, 0x63, 0x69, 0x74, 0x20, 0x2d, 0x57, 0x69, 
+    0x6d, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x2d, 0x57, 
+    0x69, 0x6e, 0x69, 0x74, 0x2d, 0x73, 0x65, 0x6c, 
+    0x66, 0x20, 0x2d, 0x57, 0x69, 0x6e, 0x6c, 0x69, 
+    0x6e, 0x65, 0x20, 0x2d, 0x57, 0x69, 0x6e, 0x76, 
+    0x61, 0x6c, 0x69, 0x64, 0x2d, 0x70, 0x63, 0x68, 
+    0x20, 0x2d, 0x57, 0x6a, 0x75, 0x6d, 0x70, 0x2d, 
+    0x6d, 0x69, 0x73, 0x73, 0x65, 0x73, 0x2d, 0x69, 
+    0x6e, 0x69, 0x74, 0x20, 0x2d, 0x57, 0x6c, 0x6f, 
+    0x67, 0x69, 0x63, 0x61, 0x6c, 0x2d, 0x6f, 0x70, 
+    0x20, 0x2d, 0x57, 0x65, 0x72, 0x72, 0x6f, 0x72, 
+    0x3d, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6e, 0x67, 
+    0x2d, 0x62, 0x72, 0x61, 0x63, 0x65, 0x73, 0x20, 
+    0x2d, 0x57, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x3d, 
+    0x6d, 0x69, 0x73, 0x73, 0x69, 0x6e, 0x67, 0x2d, 
+    0x64, 0x65, 0x63, 0x6c, 0x61, 0x72, 0x61, 0x74, 
+    0x69, 0x6f, 0x6e, 0x73, 0x20, 0x2d, 0x57, 0x6e, 
+    0x6f, 0x2d, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6e, 
+    0x67, 0x2d, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 
+    0x2d, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 
+    0x74, 0x65, 0x20, 0x2d, 0x57, 0x6d, 0x69, 0x73, 
+    0x73, 0x69, 0x6e, 0x67, 0x2d, 0x69, 0x6e, 0x63, 
+    0x6c, 0x75, 0x64, 0x65, 0x2d, 0x64, 0x69, 0x72, 
+    0x73, 0x20, 0x2d, 0x57, 0x6d, 0x75, 0x6c, 0x74, 
+    0x69, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2d, 0x57, 
+    0x70, 0x61, 0x63, 0x6b, 0x65, 0x64, 0x20, 0x2d, 
+    0x57, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 
+    0x2d, 0x61, 0x72, 0x69, 0x74, 0x68, 0x20, 0x2d, 
+    0x57, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x2d, 
+    0x74, 0x79, 0x70, 0x65, 0x20, 0x2d, 0x57, 0x73, 
+    0x65, 0x71, 0x75, 0x65, 0x6e, 0x63, 0x65, 0x2d, 
+    0x70, 0x6f, 0x69, 0x6e, 0x74, 0x20, 0x2d, 0x57, 
+    0x73, 0x69, 0x67, 0x6e, 0x2d, 0x63, 0x6f, 0x6d, 
+    0x70, 0x61, 0x72, 0x65, 0x20, 0x2d, 0x57, 0x73, 
+    0x74, 0x72, 0x69, 0x63, 0x74, 0x2d, 0x61, 0x6c, 
+    0x69, 0x61, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x2d, 
+    0x57, 0x73, 0x74, 0x72, 0x69, 0x63, 0x74, 0x2d, 
+    0x61, 0x6c, 0x69, 0x61, 0x73, 0x69, 0x6e, 0x67, 
+    0x3d, 0x32, 0x20, 0x2d, 0x57, 0x73, 0x77, 0x69, 
+    0x74, 0x63, 0x68, 0x20, 0x2d, 0x57, 0x73, 0x77, 
+    0x69, 0x74, 0x63, 0x68, 0x2d, 0x64, 0x65, 0x66, 
+    0x61, 0x75, 0x6c, 0x74, 0x20, 0x2d, 0x57, 0x65, 
+    0x72, 0x72, 0x6f, 0x72, 0x3d, 0x75, 0x6e, 0x64, 
+    0x65, 0x66, 0x20, 0x2d, 0x57, 0x6e, 0x6f, 0x2d, 
+    0x75, 0x6e, 0x75, 0x73, 0x65, 0x64, 0x20, 0x2d, 
+    0x57, 0x76, 0x61, 0x72, 0x69, 0x61, 0x64, 0x69, 
+    0x63, 0x2d, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x73, 
+    0x20, 0x2d, 0x57, 0x77, 0x72, 0x69, 0x74, 0x65, 
+    0x2d, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x73, 
+    0x20, 0x2d, 0x57, 0x73, 0x74, 0x61, 0x63, 0x6b, 
+    0x2d, 0x75, 0x73, 0x61, 0x67, 0x65, 0x3d, 0x35, 
+    0x30, 0x30, 0x20, 0x2d, 0x57, 0x63, 0x2b, 0x2b, 
+    0x2d, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x74, 0x20, 
+    0x2d, 0x57, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x3d, 
+    0x64, 0x65, 0x63, 0x6c, 0x61, 0x72, 0x61, 0x74, 
+    0x69, 0x6f, 0x6e, 0x2d, 0x61, 0x66, 0x74, 0x65, 
+    0x72, 0x2d, 0x73, 0x74, 0x61, 0x74, 0x65, 0x6d, 
+    0x65, 0x6e, 0x74, 0x20, 0x2d, 0x57, 0x65, 0x72, 
+    0x72, 0x6f, 0x72, 0x3d, 0x69, 0x6d, 0x70, 0x6c, 
+    0x69, 0x63, 0x69, 0x74, 0x2d, 0x66, 0x75, 0x6e, 
+    0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2d, 0x64, 0x65, 
+    0x63, 0x6c, 0x61, 0x72, 0x61, 0x74, 0x69, 0x6f, 
+    0x6e, 0x20, 0x2d, 0x57, 0x65, 0x72, 0x72, 0x6f, 
+    0x72, 0x3d, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6e, 
+    0x67, 0x2d, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x74, 
+    0x79, 0x70, 0x65, 0x73, 0x20, 0x2d, 0x57, 0x65, 
+    0x72, 0x72, 0x6f, 0x72, 0x3d, 0x6e, 0x65, 0x73, 
+    0x74, 0x65, 0x64, 0x2d, 0x65, 0x78, 0x74, 0x65, 
+    0x72, 0x6e, 0x73, 0x20, 0x2d, 0x57, 0x65, 0x72, 
+    0x72, 0x6f, 0x72, 0x3d, 0x6f, 0x6c, 0x64, 0x2d, 
+    0x73, 0x74, 0x79, 0x6c, 0x65, 0x2d, 0x64, 0x65, 
+    0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e, 
+    0x20, 0x2d, 0x57, 0x65, 0x72, 0x72, 0x6f, 0x72, 
+    0x3d, 0x73, 0x74, 0x72, 0x69, 0x63, 0x74, 0x2d, 
+    0x70, 0x72, 0x6f, 0x74, 0x6f, 0x74, 0x79, 0x70, 
+    0x65, 0x73, 0x20, 0x2d, 0x66, 0x76, 0x69, 0x73, 
+    0x69, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x3d, 
+    0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x63, 0x63, 0x77, 0x61, 0x72, 0x6e, 0x3a, 0x3a, 
+    0x73, 0x72, 0x63, 0x2f, 0x73, 0x74, 0x72, 0x69, 
+    0x6e, 0x67, 0x2f, 0x73, 0x70, 0x66, 0x5f, 0x72, 
+    0x65, 0x6e, 0x64, 0x65, 0x72, 0x2e, 0x63, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x91, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2d, 0x66, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x2d, 
+    0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+    0x73, 0x3d, 0x31, 0x36, 0x20, 0x2d, 0x66, 0x75, 
+    0x6e, 0x69, 0x74, 0x2d, 0x61, 0x74, 0x2d, 0x61, 
+    0x2d, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x2d, 0x66, 
+    0x65, 0x78, 0x63, 0x65, 0x73, 0x73, 0x2d, 0x70, 
+    0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e, 
+    0x3d, 0x73, 0x74, 0x61, 0x6e, 0x64, 0x61, 0x72, 
+    0x64, 0x20, 0x2d, 0x6d, 0x61, 0x63, 0x63, 0x75, 
+    0x6d, 0x75, 0x6c, 0x61, 0x74, 0x65, 0x2d, 0x6f, 
+    0x75, 0x74, 0x67, 0x6f, 0x69, 0x6e, 0x67, 0x2d, 
+    0x61, 0x72, 0x67, 0x73, 0x20, 0x2d, 0x57, 0x61, 
+    0x6c, 0x6c, 0x20, 0x2d, 0x57, 0x65, 0x78, 0x74, 
+    0x72, 0x61, 0x20, 0x2d, 0x57, 0x61, 0x67, 0x67, 
+    0x72, 0x65, 0x67, 0x61, 0x74, 0x65, 0x2d, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x2d, 0x57, 
+    0x63, 0x61, 0x73, 0x74, 0x2d, 0x71, 0x75, 0x61, 
+    0x6c, 0x20, 0x2d, 0x57, 0x64, 0x69, 0x73, 0x61, 
+    0x62, 0x6c, 0x65, 0x64, 0x2d, 0x6f, 0x70, 0x74, 
+    0x69, 0x6d, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 
+    0x6e, 0x20, 0x2d, 0x57, 0x64, 0x69, 0x76, 0x2d, 
+    0x62, 0x79, 0x2d, 0x7a, 0x65, 0x72, 0x6f, 0x20, 
+    0x2d, 0x57, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x2d, 
+    0x6c, 0x61, 0x62, 0x65, 0x6c, 0x73, 0x20, 0x2d, 
+    0x57, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x2d, 
+    0x65, 0x78, 0x74, 0x72, 0x61, 0x2d, 0x61, 0x72, 
+    0x67, 0x73, 0x20, 0x2d, 0x57, 0x66, 0x6f, 0x72, 
+    0x6d, 0x61, 0x74, 0x2d, 0x6e, 0x6f, 0x6e, 0x6c, 
+    0x69, 0x74, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x2d, 
+    0x57, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x2d, 
+    0x73, 0x65, 0x63, 0x75, 0x72, 0x69, 0x74, 0x79, 
+    0x20, 0x2d, 0x57, 0x66, 0x6f, 0x72, 0x6d, 0x61, 
+    0x74, 0x2d, 0x79, 0x32, 0x6b, 0x20, 0x2d, 0x57, 
+    0x69, 0x6d, 0x70, 0x6c, 0x69, 0x63, 0x69, 0x74, 
+    0x20, 0x2d, 0x57, 0x69, 0x6d, 0x70, 0x6f, 0x72, 
+    0x74, 0x20, 0x2d, 0x57, 0x69, 0x6e, 0x69, 0x74, 
+    0x2d, 0x73, 0x65, 0x6c, 0x66, 0x20, 0x2d, 0x57, 
+    0x69, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x2d, 
+    0x57, 0x69, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 
+    0x2d, 0x70, 0x63, 0x68, 0x20, 0x2d, 0x57, 0x6a, 
+    0x75, 0x6d, 0x70, 0x2d, 0x6d, 0x69, 0x73, 0x73, 
+    0x65, 0x73, 0x2d, 0x69, 0x6e, 0x69, 0x74, 0x20, 
+    0x2d, 0x57, 0x6c, 0x6f, 0x67, 0x69, 0x63, 0x61, 
+    0x6c, 0x2d, 0x6f, 0x70, 0x20, 0x2d, 0x57, 0x65, 
+    0x72, 0x72, 0x6f, 0x72, 0x3d, 0x6d, 0x69, 0x73, 
+    0x73, 0x69, 0x6e, 0x67, 0x2d, 0x62, 0x72, 0x61, 
+    0x63, 0x65, 0x73, 0x20, 0x2d, 0x57, 0x65, 0x72, 
+    0x72, 0x6f, 0x72, 0x3d, 0x6d, 0x69, 0x73, 0x73, 
+    0x69, 0x6e, 0x67, 0x2d, 0x64, 0x65, 0x63, 0x6c, 
+    0x61, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 
+    0x20, 0x2d, 0x57, 0x6e, 0x6f, 0x2d, 0x6d, 0x69, 
+    0x73, 0x73, 0x69, 0x6e, 0x67, 0x2d, 0x66, 0x6f, 
+    0x72, 0x6d, 0x61, 0x74, 0x2d, 0x61, 0x74, 0x74, 
+    0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x2d, 
+    0x57, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6e, 0x67, 
+    0x2d, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 
+    0x2d, 0x64, 0x69, 0x72, 0x73, 0x20, 0x2d, 0x57, 
+    0x6d, 0x75, 0x6c, 0x74, 0x69, 0x63, 0x68, 0x61, 
+    0x72, 0x20, 0x2d, 0x57, 0x70, 0x61, 0x63, 0x6b, 
+    0x65, 0x64, 0x20, 0x2d, 0x57, 0x70, 0x6f, 0x69, 
+    0x6e, 0x74, 0x65, 0x72, 0x2d, 0x61, 0x72, 0x69, 
+    0x74, 0x68, 0x20, 0x2d, 0x57, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6e, 0x2d, 0x74, 0x79, 0x70, 0x65, 
+    0x20, 0x2d, 0x57, 0x73, 0x65, 0x71, 0x75, 0x65, 
+    0x6e, 0x63, 0x65, 0x2d, 0x70, 0x6f, 0x69, 0x6e, 
+    0x74, 0x20, 0x2d, 0x57, 0x73, 0x69, 0x67, 0x6e, 
+    0x2d, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x72, 0x65, 
+    0x20, 0x2d, 0x57, 0x73, 0x74, 0x72, 0x69, 0x63, 
+    0x74, 0x2d, 0x61, 0x6c, 0x69, 0x61, 0x73, 0x69, 
+    0x6e, 0x67, 0x20, 0x2d, 0x57, 0x73, 0x74, 0x72, 
+    0x69, 0x63, 0x74, 0x2d, 0x61, 0x6c, 0x69, 0x61, 
+    0x73, 0x69, 0x6e, 0x67, 0x3d, 0x32, 0x20, 0x2d, 
+    0x57, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x20, 
+    0x2d, 0x57, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 
+    0x2d, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 
+    0x20, 0x2d, 0x57, 0x65, 0x72, 0x72, 0x6f, 0x72, 
+    0x3d, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x20, 0x2d, 
+    0x57, 0x6e, 0x6f, 0x2d, 0x75, 0x6e, 0x75, 0x73, 
+    0x65, 0x64, 0x20, 0x2d, 0x57, 0x76, 0x61, 0x72, 
+    0x69, 0x61, 0x64, 0x69, 0x63, 0x2d, 0x6d, 0x61, 
+    0x63, 0x72, 0x6f, 0x73, 0x20, 0x2d, 0x57, 0x77, 
+    0x72, 0x69, 0x74, 0x65, 0x2d, 0x73, 0x74, 0x72, 
+    0x69, 0x6e, 0x67, 0x73, 0x20, 0x2d, 0x57, 0x73, 
+    0x74, 0x61, 0x63, 0x6b, 0x2d, 0x75, 0x73, 0x61, 
+    0x67, 0x65, 0x3d, 0x35, 0x30, 0x30, 0x20, 0x2d, 
+    0x57, 0x63, 0x2b, 0x2b, 0x2d, 0x63, 0x6f, 0x6d, 
+    0x70, 0x61, 0x74, 0x20, 0x2d, 0x57, 0x65, 0x72, 
+    0x72, 0x6f, 0x72, 0x3d, 0x64, 0x65, 0x63, 0x6c, 
+    0x61, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2d, 
+    0x61, 0x66, 0x74, 0x65, 0x72, 0x2d, 0x73, 0x74, 
+    0x61, 0x74, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 
+    0x2d, 0x57, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x3d, 
+    0x69, 0x6d, 0x70, 0x6c, 0x69, 0x63, 0x69, 0x74, 
+    0x2d, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 
+    0x6e, 0x2d, 0x64, 0x65, 0x63, 0x6c, 0x61, 0x72, 
+    0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x2d, 0x57, 
+    0x65, 0x72, 0x72, 0x6f, 0x72, 0x3d, 0x6d, 0x69, 
+    0x73, 0x73, 0x69, 0x6e, 0x67, 0x2d, 0x70, 0x72, 
+    0x6f, 0x74, 0x6f, 0x74, 0x79, 0x70, 0x65, 0x73, 
+    0x20, 0x2d, 0x57, 0x65, 0x72, 0x72, 0x6f, 0x72, 
+    0x3d, 0x6e, 0x65, 0x73, 0x74, 0x65, 0x64, 0x2d, 
+    0x65, 0x78, 0x74, 0x65, 0x72, 0x6e, 0x73, 0x20, 
+    0x2d, 0x57, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x3d, 
+    0x6f, 0x6c, 0x64, 0x2d, 0x73, 0x74, 0x79, 0x6c, 
+    0x65, 0x2d, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x69, 
+    0x74, 0x69, 0x6f, 0x6e, 0x20, 0x2d, 0x57, 0x65, 
+    0x72, 0x72, 0x6f, 0x72, 0x3d, 0x73, 0x74, 0x72, 
+    0x69, 0x63, 0x74, 0x2d, 0x70, 0x72, 0x6f, 0x74, 
+    0x6f, 0x74, 0x79, 0x70, 0x65, 0x73, 0x20, 0x2d, 
+    0x66, 0x76, 0x69, 0x73, 0x69, 0x62, 0x69, 0x6c, 
+    0x69, 0x74, 0x79, 0x3d, 0x68, 0x69, 0x64, 0x64, 
+    0x65, 0x6e, 0x20, 0x2d, 0x57, 0x6e, 0x6f, 0x2d, 
+    0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x2d, 0x6e, 
+    0x6f, 0x6e, 0x6c, 0x69, 0x74, 0x65, 0x72, 0x61, 
+    0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x63, 0x63, 0x77, 0x61, 0x72, 0x6e, 0x3a, 0x3a, 
+    0x73, 0x72, 0x63, 0x2f, 0x73, 0x74, 0x72, 0x69, 
+    0x6e, 0x67, 0x2f, 0x73, 0x70, 0x72, 0x69, 0x6e, 
+    0x74, 0x66, 0x2e, 0x63, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x91, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2d, 0x66, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x2d, 
+    0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+    0x73, 0x3d, 0x31, 0x36, 0x20, 0x2d, 0x66, 0x75, 
+    0x6e, 0x69, 0x74, 0x2d, 0x61, 0x74, 0x2d, 0x61, 
+    0x2d, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x2d, 0x66, 
+    0x65, 0x78, 0x63, 0x65, 0x73, 0x73, 0x2d, 0x70, 
+    0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e, 
+    0x3d, 0x73, 0x74, 0x61, 0x6e, 0x64, 0x61, 0x72, 
+    0x64, 0x20, 0x2d, 0x6d, 0x61, 0x63, 0x63, 0x75, 
+    0x6d, 0x75, 0x6c, 0x61, 0x74, 0x65, 0x2d, 0x6f, 
+    0x75, 0x74, 0x67, 0x6f, 0x69, 0x6e, 0x67, 0x2d, 
+    0x61, 0x72, 0x67, 0x73, 0x20, 0x2d, 0x57, 0x61, 
+    0x6c, 0x6c, 0x20, 0x2d, 0x57, 0x65, 0x78, 0x74, 
+    0x72, 0x61, 0x20, 0x2d, 0x57, 0x61, 0x67, 0x67, 
+    0x72, 0x65, 0x67, 0x61, 0x74, 0x65, 0x2d, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x2d, 0x57, 
+    0x63, 0x61, 0x73, 0x74, 0x2d, 0x71, 0x75, 0x61, 
+    0x6c, 0x20, 0x2d, 0x57, 0x64, 0x69, 0x73, 0x61, 
+    0x62, 0x6c, 0x65, 0x64, 0x2d, 0x6f, 0x70, 0x74, 
+    0x69, 0x6d, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 
+    0x6e, 0x20, 0x2d, 0x57, 0x64, 0x69, 0x76, 0x2d, 
+    0x62, 0x79, 0x2d, 0x7a, 0x65, 0x72, 0x6f, 0x20, 
+    0x2d, 0x57, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x2d, 
+    0x6c, 0x61, 0x62, 0x65, 0x6c, 0x73, 0x20, 0x2d, 
+    0x57, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x2d, 
+    0x65, 0x78, 0x74, 0x72, 0x61, 0x2d, 0x61, 0x72, 
+    0x67, 0x73, 0x20, 0x2d, 0x57, 0x66, 0x6f, 0x72, 
+    0x6d, 0x61, 0x74, 0x2d, 0x6e, 0x6f, 0x6e, 0x6c, 
+    0x69, 0x74, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x2d, 
+    0x57, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x2d, 
+    0x73, 0x65, 0x63, 0x75, 0x72, 0x69, 0x74, 0x79, 
+    0x20, 0x2d, 0x57, 0x66, 0x6f, 0x72, 0x6d, 0x61, 
+    0x74, 0x2d, 0x79, 0x32, 0x6b, 0x20, 0x2d, 0x57, 
+    0x69, 0x6d, 0x70, 0x6c, 0x69, 0x63, 0x69, 0x74, 
+    0x20, 0x2d, 0x57, 0x69, 0x6d, 0x70, 0x6f, 0x72, 
+    0x74, 0x20, 0x2d, 0x57, 0x69, 0x6e, 0x69, 0x74, 
+    0x2d, 0x73, 0x65, 0x6c, 0x66, 0x20, 0x2d, 0x57, 
+    0x69, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x2d, 
+    0x57, 0x69, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 
+    0x2d, 0x70, 0x63, 0x68, 0x20, 0x2d, 0x57, 0x6a, 
+    0x75, 0x6d, 0x70, 0x2d, 0x6d, 0x69, 0x73, 0x73, 
+    0x65, 0x73, 0x2d, 0x69, 0x6e, 0x69, 0x74, 0x20, 
+    0x2d, 0x57, 0x6c, 0x6f, 0x67, 0x69, 0x63, 0x61, 
+    0x6c, 0x2d, 0x6f, 0x70, 0x20, 0x2d, 0x57, 0x65, 
+    0x72, 0x72, 0x6f, 0x72, 0x3d, 0x6d, 0x69, 0x73, 
+    0x73, 0x69, 0x6e, 0x67, 0x2d, 0x62, 0x72, 0x61, 
+    0x63, 0x65, 0x73, 0x20, 0x2d, 0x57, 0x65, 0x72, 
+    0x72, 0x6f, 0x72, 0x3d, 0x6d, 0x69, 0x73, 0x73, 
+    0x69, 0x6e, 0x67, 0x2d, 0x64, 0x65, 0x63, 0x6c, 
+    0x61, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 
+    0x20, 0x2d, 0x57, 0x6e, 0x6f, 0x2d, 0x6d, 0x69, 
+    0x73, 0x73, 0x69, 0x6e, 0x67, 0x2d, 0x66, 0x6f, 
+    0x72, 0x6d, 0x61, 0x74, 0x2d, 0x61, 0x74, 0x74, 
+    0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x2d, 
+    0x57, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6e, 0x67, 
+    0x2d, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 
+    0x2d, 0x64, 0x69, 0x72, 0x73, 0x20, 0x2d, 0x57, 
+    0x6d, 0x75, 0x6c, 0x74, 0x69, 0x63, 0x68, 0x61, 
+    0x72, 0x20, 0x2d, 0x57, 0x70, 0x61, 0x63, 0x6b, 
+    0x65, 0x64, 0x20, 0x2d, 0x57, 0x70, 0x6f, 0x69, 
+    0x6e, 0x74, 0x65, 0x72, 0x2d, 0x61, 0x72, 0x69, 
+    0x74, 0x68, 0x20, 0x2d, 0x57, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6e, 0x2d, 0x74, 0x79, 0x70, 0x65, 
+    0x20, 0x2d, 0x57, 0x73, 0x65, 0x71, 0x75, 0x65, 
+    0x6e, 0x63, 0x65, 0x2d, 0x70, 0x6f, 0x69, 0x6e, 
+    0x74, 0x20, 0x2d, 0x57, 0x73, 0x69, 0x67, 0x6e, 
+    0x2d, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x72, 0x65, 
+    0x20, 0x2d, 0x57, 0x73, 0x74, 0x72, 0x69, 0x63, 
+    0x74, 0x2d, 0x61, 0x6c, 0x69, 0x61, 0x73, 0x69, 
+    0x6e, 0x67, 0x20, 0x2d, 0x57, 0x73, 0x74, 0x72, 
+    0x69, 0x63, 0x74, 0x2d, 0x61, 0x6c, 0x69, 0x61, 
+    0x73, 0x69, 0x6e, 0x67, 0x3d, 0x32, 0x20, 0x2d, 
+    0x57, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x20, 
+    0x2d, 0x57, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 
+    0x2d, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 
+    0x20, 0x2d, 0x57, 0x65, 0x72, 0x72, 0x6f, 0x72, 
+    0x3d, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x20, 0x2d, 
+    0x57, 0x6e, 0x6f, 0x2d, 0x75, 0x6e, 0x75, 0x73, 
+    0x65, 0x64, 0x20, 0x2d, 0x57, 0x76, 0x61, 0x72, 
+    0x69, 0x61, 0x64, 0x69, 0x63, 0x2d, 0x6d, 0x61, 
+    0x63, 0x72, 0x6f, 0x73, 0x20, 0x2d, 0x57, 0x77, 
+    0x72, 0x69, 0x74, 0x65, 0x2d, 0x73, 0x74, 0x72, 
+    0x69, 0x6e, 0x67, 0x73, 0x20, 0x2d, 0x57, 0x73, 
+    0x74, 0x61, 0x63, 0x6b, 0x2d, 0x75, 0x73, 0x61, 
+    0x67, 0x65, 0x3d, 0x35, 0x30, 0x30, 0x20, 0x2d, 
+    0x57, 0x63, 0x2b, 0x2b, 0x2d, 0x63, 0x6f, 0x6d, 
+    0x70, 0x61, 0x74, 0x20, 0x2d, 0x57, 0x65, 0x72, 
+    0x72, 0x6f, 0x72, 0x3d, 0x64, 0x65, 0x63, 0x6c, 
+    0x61, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2d, 
+    0x61, 0x66, 0x74, 0x65, 0x72, 0x2d, 0x73, 0x74, 
+    0x61, 0x74, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 
+    0x2d, 0x57, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x3d, 
+    0x69, 0x6d, 0x70, 0x6c, 0x69, 0x63, 0x69, 0x74, 
+    0x2d, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 
+    0x6e, 0x2d, 0x64, 0x65, 0x63, 0x6c, 0x61, 0x72, 
+    0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x2d, 0x57, 
+    0x65, 0x72, 0x72, 0x6f, 0x72, 0x3d, 0x6d, 0x69, 
+    0x73, 0x73, 0x69, 0x6e, 0x67, 0x2d, 0x70, 0x72, 
+    0x6f, 0x74, 0x6f, 0x74, 0x79, 0x70, 0x65, 0x73, 
+    0x20, 0x2d, 0x57, 0x65, 0x72, 0x72, 0x6f, 0x72, 
+    0x3d, 0x6e, 0x65, 0x73, 0x74, 0x65, 0x64, 0x2d, 
+    0x65, 0x78, 0x74, 0x65, 0x72, 0x6e, 0x73, 0x20, 
+    0x2d, 0x57, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x3d, 
+    0x6f, 0x6c, 0x64, 0x2d, 0x73, 0x74, 0x79, 0x6c, 
+    0x65, 0x2d, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x69, 
+    0x74, 0x69, 0x6f, 0x6e, 0x20, 0x2d, 0x57, 0x65, 
+    0x72, 0x72, 0x6f, 0x72, 0x3d, 0x73, 0x74, 0x72, 
+    0x69, 0x63, 0x74, 0x2d, 0x70, 0x72, 0x6f, 0x74, 
+    0x6f, 0x74, 0x79, 0x70, 0x65, 0x73, 0x20, 0x2d, 
+    0x66, 0x76, 0x69, 0x73, 0x69, 0x62, 0x69, 0x6c, 
+    0x69, 0x74, 0x79, 0x3d, 0x68, 0x69, 0x64, 0x64, 
+    0x65, 0x6e, 0x20, 0x2d, 0x57, 0x6e, 0x6f, 0x2d, 
+    0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x2d, 0x6e, 
+    0x6f, 0x6e, 0x6c, 0x69, 0x74, 0x65, 0x72, 0x61, 
+    0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x63, 0x68, 0x6d, 0x6f, 0x64, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x24, 0x28, 0x50, 0x45, 0x52, 0x4c, 0x29, 0x20, 
+    0x2d, 0x4d, 0x45, 0x78, 0x74, 0x55, 0x74, 0x69, 
+    0x6c, 0x73, 0x3a, 0x3a, 0x43, 0x6f, 0x6d, 0x6d, 
+    0x61, 0x6e, 0x64, 0x20, 0x2d, 0x65, 0x20, 0x63, 
+    0x68, 0x6d, 0x6f, 0x64, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x63, 0x6c, 0x61, 0x6e, 0x67, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x63, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x62, 0x65, 
+    0x73, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x64, 0x61, 
+    0x74, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x4d, 0x6f, 0x6e, 0x20, 0x4f, 0x63, 0x74, 0x20, 
+    0x31, 0x39, 0x20, 0x31, 0x30, 0x3a, 0x31, 0x39, 
+    0x3a, 0x30, 0x39, 0x20, 0x32, 0x30, 0x32, 0x36, 
+    0x20, 0x47, 0x4d, 0x54, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x75, 0x72, 
+    0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x73, 0x74, 
+    0x65, 0x70, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x69, 0x6e, 0x69, 0x74, 0x3a, 0x3a, 0x6d, 0x61, 
+    0x6e, 0x69, 0x66, 0x65, 0x73, 0x74, 0x20, 0x69, 
+    0x6e, 0x69, 0x74, 0x3a, 0x3a, 0x64, 0x65, 0x66, 
+    0x61, 0x75, 0x6c, 0x74, 0x73, 0x20, 0x69, 0x6e, 
+    0x69, 0x74, 0x3a, 0x3a, 0x69, 0x6e, 0x73, 0x74, 
+    0x61, 0x6c, 0x6c, 0x20, 0x69, 0x6e, 0x69, 0x74, 
+    0x3a, 0x3a, 0x68, 0x69, 0x6e, 0x74, 0x73, 0x20, 
+    0x69, 0x6e, 0x74, 0x65, 0x72, 0x3a, 0x3a, 0x70, 
+    0x72, 0x6f, 0x67, 0x73, 0x20, 0x69, 0x6e, 0x74, 
+    0x65, 0x72, 0x3a, 0x3a, 0x6d, 0x61, 0x6b, 0x65, 
+    0x20, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x3a, 0x3a, 
+    0x6c, 0x65, 0x78, 0x20, 0x69, 0x6e, 0x74, 0x65, 
+    0x72, 0x3a, 0x3a, 0x79, 0x61, 0x63, 0x63, 0x20, 
+    0x61, 0x75, 0x74, 0x6f, 0x3a, 0x3a, 0x67, 0x63, 
+    0x63, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x3a, 0x3a, 
+    0x67, 0x6c, 0x69, 0x62, 0x63, 0x20, 0x61, 0x75, 
+    0x74, 0x6f, 0x3a, 0x3a, 0x62, 0x61, 0x63, 0x6b, 
+    0x74, 0x72, 0x61, 0x63, 0x65, 0x20, 0x61, 0x75, 
+    0x74, 0x6f, 0x3a, 0x3a, 0x6d, 0x73, 0x76, 0x63, 
+    0x20, 0x61, 0x75, 0x74, 0x6f, 0x3a, 0x3a, 0x61, 
+    0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 
+    0x73, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x3a, 0x3a, 
+    0x61, 0x72, 0x63, 0x68, 0x20, 0x61, 0x75, 0x74, 
+    0x6f, 0x3a, 0x3a, 0x63, 0x70, 0x75, 0x20, 0x69, 
+    0x6e, 0x69, 0x74, 0x3a, 0x3a, 0x6f, 0x70, 0x74, 
+    0x69, 0x6d, 0x69, 0x7a, 0x65, 0x20, 0x69, 0x6e, 
+    0x74, 0x65, 0x72, 0x3a, 0x3a, 0x73, 0x68, 0x6c, 
+    0x69, 0x62, 0x73, 0x20, 0x69, 0x6e, 0x74, 0x65, 
+    0x72, 0x3a, 0x3a, 0x6c, 0x69, 0x62, 0x70, 0x61, 
+    0x72, 0x72, 0x6f, 0x74, 0x20, 0x69, 0x6e, 0x74, 
+    0x65, 0x72, 0x3a, 0x3a, 0x74, 0x79, 0x70, 0x65, 
+    0x73, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x3a, 0x3a, 
+    0x6f, 0x70, 0x73, 0x20, 0x61, 0x75, 0x74, 0x6f, 
+    0x3a, 0x3a, 0x70, 0x6d, 0x63, 0x20, 0x61, 0x75, 
+    0x74, 0x6f, 0x3a, 0x3a, 0x68, 0x65, 0x61, 0x64, 
+    0x65, 0x72, 0x73, 0x20, 0x61, 0x75, 0x74, 0x6f, 
+    0x3a, 0x3a, 0x73, 0x69, 0x7a, 0x65, 0x73, 0x20, 
+    0x61, 0x75, 0x74, 0x6f, 0x3a, 0x3a, 0x62, 0x79, 
+    0x74, 0x65, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x20, 
+    0x61, 0x75, 0x74, 0x6f, 0x3a, 0x3a, 0x76, 0x61, 
+    0x5f, 0x70, 0x74, 0x72, 0x20, 0x61, 0x75, 0x74, 
+    0x6f, 0x3a, 0x3a, 0x66, 0x6f, 0x72, 0x6d, 0x61, 
+    0x74, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x3a, 0x3a, 
+    0x69, 0x73, 0x72, 0x65, 0x67, 0x20, 0x61, 0x75, 
+    0x74, 0x6f, 0x3a, 0x3a, 0x6c, 0x6c, 0x76, 0x6d, 
+    0x20, 0x61, 0x75, 0x74, 0x6f, 0x3a, 0x3a, 0x69, 
+    0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x61, 0x75, 
+    0x74, 0x6f, 0x3a, 0x3a, 0x67, 0x63, 0x20, 0x61, 
+    0x75, 0x74, 0x6f, 0x3a, 0x3a, 0x6d, 0x65, 0x6d, 
+    0x61, 0x6c, 0x69, 0x67, 0x6e, 0x20, 0x61, 0x75, 
+    0x74, 0x6f, 0x3a, 0x3a, 0x73, 0x69, 0x67, 0x6e, 
+    0x61, 0x6c, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x3a, 
+    0x3a, 0x73, 0x6f, 0x63, 0x6b, 0x6c, 0x65, 0x6e, 
+    0x5f, 0x74, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x3a, 
+    0x3a, 0x73, 0x74, 0x61, 0x74, 0x20, 0x61, 0x75, 
+    0x74, 0x6f, 0x3a, 0x3a, 0x6e, 0x65, 0x67, 0x5f, 
+    0x30, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x3a, 0x3a, 
+    0x65, 0x6e, 0x76, 0x20, 0x61, 0x75, 0x74, 0x6f, 
+    0x3a, 0x3a, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x70, 
+    0x65, 0x63, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x3a, 
+    0x3a, 0x69, 0x6e, 0x66, 0x6e, 0x61, 0x6e, 0x20, 
+    0x61, 0x75, 0x74, 0x6f, 0x3a, 0x3a, 0x74, 0x68, 
+    0x72, 0x65, 0x61, 0x64, 0x20, 0x61, 0x75, 0x74, 
+    0x6f, 0x3a, 0x3a, 0x67, 0x6d, 0x70, 0x20, 0x61, 
+    0x75, 0x74, 0x6f, 0x3a, 0x3a, 0x72, 0x65, 0x61, 
+    0x64, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x61, 0x75, 
+    0x74, 0x6f, 0x3a, 0x3a, 0x70, 0x63, 0x72, 0x65, 
+    0x20, 0x61, 0x75, 0x74, 0x6f, 0x3a, 0x3a, 0x6f, 
+    0x70, 0x65, 0x6e, 0x67, 0x6c, 0x20, 0x61, 0x75, 
+    0x74, 0x6f, 0x3a, 0x3a, 0x7a, 0x6c, 0x69, 0x62, 
+    0x20, 0x61, 0x75, 0x74, 0x6f, 0x3a, 0x3a, 0x67, 
+    0x65, 0x74, 0x74, 0x65, 0x78, 0x74, 0x20, 0x61, 
+    0x75, 0x74, 0x6f, 0x3a, 0x3a, 0x73, 0x6e, 0x70, 
+    0x72, 0x69, 0x6e, 0x74, 0x66, 0x20, 0x61, 0x75, 
+    0x74, 0x6f, 0x3a, 0x3a, 0x6c, 0x61, 0x62, 0x73, 
+    0x20, 0x61, 0x75, 0x74, 0x6f, 0x3a, 0x3a, 0x70, 
+    0x65, 0x72, 0x6c, 0x64, 0x6f, 0x63, 0x20, 0x61, 
+    0x75, 0x74, 0x6f, 0x3a, 0x3a, 0x63, 0x6f, 0x76, 
+    0x65, 0x72, 0x61, 0x67, 0x65, 0x20, 0x61, 0x75, 
+    0x74, 0x6f, 0x3a, 0x3a, 0x70, 0x6f, 0x64, 0x32, 
+    0x6d, 0x61, 0x6e, 0x20, 0x61, 0x75, 0x74, 0x6f, 
+    0x3a, 0x3a, 0x63, 0x74, 0x61, 0x67, 0x73, 0x20, 
+    0x61, 0x75, 0x74, 0x6f, 0x3a, 0x3a, 0x69, 0x63, 
+    0x75, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x3a, 0x3a, 
+    0x6c, 0x69, 0x62, 0x66, 0x66, 0x69, 0x20, 0x61, 
+    0x75, 0x74, 0x6f, 0x3a, 0x3a, 0x69, 0x70, 0x76, 
+    0x36, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x3a, 0x3a, 
+    0x70, 0x6c, 0x61, 0x74, 0x66, 0x6f, 0x72, 0x6d, 
+    0x20, 0x61, 0x75, 0x74, 0x6f, 0x3a, 0x3a, 0x61, 
+    0x6c, 0x69, 0x67, 0x6e, 0x6f, 0x66, 0x20, 0x61, 
+    0x75, 0x74, 0x6f, 0x3a, 0x3a, 0x65, 0x78, 0x70, 
+    0x65, 0x63, 0x74, 0x20, 0x61, 0x75, 0x74, 0x6f, 
+    0x3a, 0x3a, 0x77, 0x61, 0x72, 0x6e, 0x69, 0x6e, 
+    0x67, 0x73, 0x20, 0x67, 0x65, 0x6e, 0x3a, 0x3a, 
+    0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x5f, 0x68, 
+    0x20, 0x67, 0x65, 0x6e, 0x3a, 0x3a, 0x63, 0x6f, 
+    0x72, 0x65, 0x5f, 0x70, 0x6d, 0x63, 0x73, 0x20, 
+    0x67, 0x65, 0x6e, 0x3a, 0x3a, 0x6f, 0x70, 0x65, 
+    0x6e, 0x67, 0x6c, 0x20, 0x67, 0x65, 0x6e, 0x3a, 
+    0x3a, 0x6d, 0x61, 0x6b, 0x65, 0x66, 0x69, 0x6c, 
+    0x65, 0x73, 0x20, 0x67, 0x65, 0x6e, 0x3a, 0x3a, 
+    0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x5f, 0x70, 
+    0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x75, 0x72, 
+    0x65, 0x5f, 0x61, 0x72, 0x67, 0x73, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x75, 0x72, 
+    0x65, 0x5f, 0x74, 0x65, 0x73, 0x74, 0x73, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x74, 0x2f, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 
+    0x75, 0x72, 0x65, 0x2f, 0x2a, 0x2e, 0x74, 0x20, 
+    0x74, 0x2f, 0x73, 0x74, 0x65, 0x70, 0x73, 0x2f, 
+    0x2a, 0x2e, 0x74, 0x20, 0x74, 0x2f, 0x70, 0x6f, 
+    0x73, 0x74, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 
+    0x75, 0x72, 0x65, 0x2f, 0x2a, 0x2e, 0x74, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x75, 0x72, 
+    0x65, 0x64, 0x5f, 0x66, 0x72, 0x6f, 0x6d, 0x5f, 
+    0x66, 0x69, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x63, 0x6f, 0x72, 0x65, 0x5f, 0x74, 0x65, 0x73, 
+    0x74, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x74, 0x2f, 0x73, 0x72, 0x63, 0x2f, 0x2a, 0x2e, 
+    0x74, 0x20, 0x74, 0x2f, 0x73, 0x72, 0x63, 0x2f, 
+    0x65, 0x6d, 0x62, 0x65, 0x64, 0x2f, 0x2a, 0x2e, 
+    0x74, 0x20, 0x74, 0x2f, 0x72, 0x75, 0x6e, 0x2f, 
+    0x2a, 0x2e, 0x74, 0x20, 0x74, 0x2f, 0x70, 0x65, 
+    0x72, 0x6c, 0x2f, 0x2a, 0x2e, 0x74, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x63, 0x6f, 0x76, 0x65, 0x72, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x24, 0x28, 0x50, 0x45, 0x52, 0x4c, 0x29, 0x20, 
+    0x2d, 0x65, 0x20, 0x22, 0x70, 0x72, 0x69, 0x6e, 
+    0x74, 0x20, 0x22, 0x63, 0x6f, 0x76, 0x65, 0x72, 
+    0x20, 0x6e, 0x65, 0x65, 0x64, 0x65, 0x64, 0x20, 
+    0x62, 0x75, 0x74, 0x20, 0x6e, 0x6f, 0x74, 0x20, 
+    0x66, 0x6f, 0x75, 0x6e, 0x64, 0x2e, 0x5c, 0x6e, 
+    0x22, 0x3b, 0x20, 0x65, 0x78, 0x69, 0x74, 0x20, 
+    0x31, 0x3b, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x63, 0x6f, 0x76, 0x65, 0x72, 0x61, 0x67, 0x65, 
+    0x64, 0x69, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2f, 0x72, 0x6f, 0x6f, 0x74, 0x2f, 0x72, 0x65, 
+    0x70, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x63, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x24, 0x28, 0x50, 0x45, 0x52, 0x4c, 0x29, 0x20, 
+    0x2d, 0x4d, 0x45, 0x78, 0x74, 0x55, 0x74, 0x69, 
+    0x6c, 0x73, 0x3a, 0x3a, 0x43, 0x6f, 0x6d, 0x6d, 
+    0x61, 0x6e, 0x64, 0x20, 0x2d, 0x65, 0x20, 0x63, 
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x63, 0x70, 0x75, 0x61, 0x72, 0x63, 0x68, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x61, 0x6d, 0x64, 0x36, 0x34, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x63, 0x70, 0x75, 0x74, 0x79, 0x70, 0x65, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x49, 0x6e, 0x74, 0x65, 0x6c, 0x28, 0x52, 0x29, 
+    0x20, 0x58, 0x65, 0x6f, 0x6e, 0x28, 0x52, 0x29, 
+    0x20, 0x50, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 
+    0x6f, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x63, 0x74, 0x61, 0x67, 0x73, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x63, 0x74, 0x61, 0x67, 0x73, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x63, 0x78, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x63, 0x2b, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x64, 0x61, 0x74, 0x61, 0x64, 0x69, 0x72, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2f, 0x75, 0x73, 0x72, 0x2f, 0x6c, 0x6f, 0x63, 
+    0x61, 0x6c, 0x2f, 0x73, 0x68, 0x61, 0x72, 0x65, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x64, 0x65, 0x62, 0x75, 0x67, 0x67, 0x69, 0x6e, 
+    0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x44, 0x45, 0x56, 0x45, 0x4c, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2d, 0x64, 0x65, 0x76, 0x65, 0x6c, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x64, 0x65, 0x76, 0x65, 0x6c, 0x6f, 0x70, 0x69, 
+    0x6e, 0x67, 0x5f, 0x74, 0x65, 0x73, 0x74, 0x73, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x67, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x74, 0x2f, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 
+    0x73, 0x74, 0x64, 0x2f, 0x63, 0x5f, 0x61, 0x72, 
+    0x67, 0x5f, 0x61, 0x73, 0x73, 0x65, 0x72, 0x74, 
+    0x2e, 0x74, 0x20, 0x74, 0x2f, 0x63, 0x6f, 0x64, 
+    0x69, 0x6e, 0x67, 0x73, 0x74, 0x64, 0x2f, 0x63, 
+    0x5f, 0x63, 0x6f, 0x64, 0x65, 0x5f, 0x63, 0x6f, 
+    0x64, 0x61, 0x2e, 0x74, 0x20, 0x74, 0x2f, 0x63, 
+    0x6f, 0x64, 0x69, 0x6e, 0x67, 0x73, 0x74, 0x64, 
+    0x2f, 0x63, 0x5f, 0x63, 0x70, 0x70, 0x63, 0x6f, 
+    0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2e, 0x74, 
+    0x20, 0x74, 0x2f, 0x63, 0x6f, 0x64, 0x69, 0x6e, 
+    0x67, 0x73, 0x74, 0x64, 0x2f, 0x63, 0x5f, 0x65, 
+    0x6e, 0x75, 0x6d, 0x2e, 0x74, 0x20, 0x74, 0x2f, 
+    0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 0x73, 0x74, 
+    0x64, 0x2f, 0x63, 0x5f, 0x66, 0x75, 0x6e, 0x63, 
+    0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x64, 0x6f, 0x63, 
+    0x73, 0x2e, 0x74, 0x20, 0x74, 0x2f, 0x63, 0x6f, 
+    0x64, 0x69, 0x6e, 0x67, 0x73, 0x74, 0x64, 0x2f, 
+    0x63, 0x5f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 
+    0x5f, 0x67, 0x75, 0x61, 0x72, 0x64, 0x73, 0x2e, 
+    0x74, 0x20, 0x74, 0x2f, 0x63, 0x6f, 0x64, 0x69, 
+    0x6e, 0x67, 0x73, 0x74, 0x64, 0x2f, 0x63, 0x5f, 
+    0x69, 0x6e, 0x64, 0x65, 0x6e, 0x74, 0x2e, 0x74, 
+    0x20, 0x74, 0x2f, 0x63, 0x6f, 0x64, 0x69, 0x6e, 
+    0x67, 0x73, 0x74, 0x64, 0x2f, 0x63, 0x5f, 0x6d, 
+    0x61, 0x63, 0x72, 0x6f, 0x5f, 0x61, 0x72, 0x67, 
+    0x73, 0x2e, 0x74, 0x20, 0x74, 0x2f, 0x63, 0x6f, 
+    0x64, 0x69, 0x6e, 0x67, 0x73, 0x74, 0x64, 0x2f, 
+    0x63, 0x5f, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 
+    0x6f, 0x72, 0x2e, 0x74, 0x20, 0x74, 0x2f, 0x63, 
+    0x6f, 0x64, 0x69, 0x6e, 0x67, 0x73, 0x74, 0x64, 
+    0x2f, 0x63, 0x5f, 0x70, 0x61, 0x72, 0x65, 0x6e, 
+    0x73, 0x2e, 0x74, 0x20, 0x74, 0x2f, 0x63, 0x6f, 
+    0x64, 0x69, 0x6e, 0x67, 0x73, 0x74, 0x64, 0x2f, 
+    0x63, 0x5f, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 
+    0x73, 0x2e, 0x74, 0x20, 0x74, 0x2f, 0x63, 0x6f, 
+    0x64, 0x69, 0x6e, 0x67, 0x73, 0x74, 0x64, 0x2f, 
+    0x63, 0x5f, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 
+    0x2e, 0x74, 0x20, 0x74, 0x2f, 0x63, 0x6f, 0x64, 
+    0x69, 0x6e, 0x67, 0x73, 0x74, 0x64, 0x2f, 0x63, 
+    0x5f, 0x74, 0x6f, 0x64, 0x6f, 0x2e, 0x74, 0x20, 
+    0x74, 0x2f, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 
+    0x73, 0x74, 0x64, 0x2f, 0x63, 0x61, 0x73, 0x65, 
+    0x5f, 0x73, 0x65, 0x6e, 0x73, 0x69, 0x74, 0x69, 
+    0x76, 0x65, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x73, 
+    0x2e, 0x74, 0x20, 0x74, 0x2f, 0x63, 0x6f, 0x64, 
+    0x69, 0x6e, 0x67, 0x73, 0x74, 0x64, 0x2f, 0x63, 
+    0x68, 0x65, 0x63, 0x6b, 0x5f, 0x69, 0x73, 0x78, 
+    0x78, 0x78, 0x2e, 0x74, 0x20, 0x74, 0x2f, 0x63, 
+    0x6f, 0x64, 0x69, 0x6e, 0x67, 0x73, 0x74, 0x64, 
+    0x2f, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x5f, 0x74, 
+    0x6f, 0x78, 0x78, 0x78, 0x2e, 0x74, 0x20, 0x74, 
+    0x2f, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 0x73, 
+    0x74, 0x64, 0x2f, 0x63, 0x6f, 0x70, 0x79, 0x72, 
+    0x69, 0x67, 0x68, 0x74, 0x2e, 0x74, 0x20, 0x74, 
+    0x2f, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 0x73, 
+    0x74, 0x64, 0x2f, 0x63, 0x75, 0x64, 0x64, 0x6c, 
+    0x65, 0x64, 0x5f, 0x65, 0x6c, 0x73, 0x65, 0x2e, 
+    0x74, 0x20, 0x74, 0x2f, 0x63, 0x6f, 0x64, 0x69, 
+    0x6e, 0x67, 0x73, 0x74, 0x64, 0x2f, 0x66, 0x69, 
+    0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x2e, 
+    0x74, 0x20, 0x74, 0x2f, 0x63, 0x6f, 0x64, 0x69, 
+    0x6e, 0x67, 0x73, 0x74, 0x64, 0x2f, 0x67, 0x6d, 
+    0x74, 0x5f, 0x75, 0x74, 0x63, 0x2e, 0x74, 0x20, 
+    0x74, 0x2f, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 
+    0x73, 0x74, 0x64, 0x2f, 0x6c, 0x69, 0x6e, 0x65, 
+    0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x2e, 0x74, 
+    0x20, 0x74, 0x2f, 0x63, 0x6f, 0x64, 0x69, 0x6e, 
+    0x67, 0x73, 0x74, 0x64, 0x2f, 0x6d, 0x61, 0x6b, 
+    0x65, 0x5f, 0x63, 0x6f, 0x64, 0x65, 0x5f, 0x63, 
+    0x6f, 0x64, 0x61, 0x2e, 0x74, 0x20, 0x74, 0x2f, 
+    0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 0x73, 0x74, 
+    0x64, 0x2f, 0x6f, 0x70, 0x63, 0x6f, 0x64, 0x65, 
+    0x5f, 0x64, 0x6f, 0x63, 0x2e, 0x74, 0x20, 0x74, 
+    0x2f, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 0x73, 
+    0x74, 0x64, 0x2f, 0x70, 0x62, 0x63, 0x5f, 0x63, 
+    0x6f, 0x6d, 0x70, 0x61, 0x74, 0x2e, 0x74, 0x20, 
+    0x74, 0x2f, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 
+    0x73, 0x74, 0x64, 0x2f, 0x70, 0x63, 0x63, 0x6d, 
+    0x65, 0x74, 0x68, 0x6f, 0x64, 0x5f, 0x64, 0x65, 
+    0x70, 0x73, 0x2e, 0x74, 0x20, 0x74, 0x2f, 0x63, 
+    0x6f, 0x64, 0x69, 0x6e, 0x67, 0x73, 0x74, 0x64, 
+    0x2f, 0x70, 0x64, 0x64, 0x5f, 0x66, 0x6f, 0x72, 
+    0x6d, 0x61, 0x74, 0x2e, 0x74, 0x20, 0x74, 0x2f, 
+    0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 0x73, 0x74, 
+    0x64, 0x2f, 0x70, 0x65, 0x72, 0x6c, 0x63, 0x72, 
+    0x69, 0x74, 0x69, 0x63, 0x2e, 0x74, 0x20, 0x74, 
+    0x2f, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 0x73, 
+    0x74, 0x64, 0x2f, 0x70, 0x69, 0x72, 0x5f, 0x63, 
+    0x6f, 0x64, 0x65, 0x5f, 0x63, 0x6f, 0x64, 0x61, 
+    0x2e, 0x74, 0x20, 0x74, 0x2f, 0x63, 0x6f, 0x64, 
+    0x69, 0x6e, 0x67, 0x73, 0x74, 0x64, 0x2f, 0x70, 
+    0x6d, 0x63, 0x5f, 0x64, 0x6f, 0x63, 0x73, 0x2e, 
+    0x74, 0x20, 0x74, 0x2f, 0x63, 0x6f, 0x64, 0x69, 
+    0x6e, 0x67, 0x73, 0x74, 0x64, 0x2f, 0x70, 0x6f, 
+    0x64, 0x5f, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x74, 0x20, 
+    0x74, 0x2f, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 
+    0x73, 0x74, 0x64, 0x2f, 0x70, 0x6f, 0x64, 0x5f, 
+    0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2e, 0x74, 
+    0x20, 0x74, 0x2f, 0x63, 0x6f, 0x64, 0x69, 0x6e, 
+    0x67, 0x73, 0x74, 0x64, 0x2f, 0x70, 0x6f, 0x64, 
+    0x5f, 0x74, 0x6f, 0x64, 0x6f, 0x2e, 0x74, 0x20, 
+    0x74, 0x2f, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 
+    0x73, 0x74, 0x64, 0x2f, 0x74, 0x61, 0x62, 0x73, 
+    0x2e, 0x74, 0x20, 0x74, 0x2f, 0x63, 0x6f, 0x64, 
+    0x69, 0x6e, 0x67, 0x73, 0x74, 0x64, 0x2f, 0x74, 
+    0x72, 0x61, 0x69, 0x6c, 0x69, 0x6e, 0x67, 0x5f, 
+    0x73, 0x70, 0x61, 0x63, 0x65, 0x2e, 0x74, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x64, 0x6f, 0x63, 0x64, 0x69, 0x72, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2f, 0x75, 0x73, 0x72, 0x2f, 0x6c, 0x6f, 0x63, 
+    0x61, 0x6c, 0x2f, 0x73, 0x68, 0x61, 0x72, 0x65, 
+    0x2f, 0x64, 0x6f, 0x63, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x73, 0x69, 
+    0x7a, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x64, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x65, 0x6d, 0x62, 0x65, 0x64, 0x2d, 0x63, 0x66, 
+    0x6c, 0x61, 0x67, 0x73, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2d, 0x49, 0x2f, 0x75, 0x73, 0x72, 0x2f, 0x6c, 
+    0x6f, 0x63, 0x61, 0x6c, 0x2f, 0x69, 0x6e, 0x63, 
+    0x6c, 0x75, 0x64, 0x65, 0x2f, 0x70, 0x61, 0x72, 
+    0x72, 0x6f, 0x74, 0x2f, 0x36, 0x2e, 0x39, 0x2e, 
+    0x30, 0x2d, 0x64, 0x65, 0x76, 0x65, 0x6c, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x65, 0x6d, 0x62, 0x65, 0x64, 0x2d, 0x6c, 0x64, 
+    0x66, 0x6c, 0x61, 0x67, 0x73, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2d, 0x4c, 0x2f, 0x75, 0x73, 0x72, 0x2f, 0x6c, 
+    0x6f, 0x63, 0x61, 0x6c, 0x2f, 0x6c, 0x69, 0x62, 
+    0x20, 0x2d, 0x6c, 0x70, 0x61, 0x72, 0x72, 0x6f, 
+    0x74, 0x20, 0x2d, 0x6c, 0x64, 0x6c, 0x20, 0x2d, 
+    0x6c, 0x6d, 0x20, 0x2d, 0x6c, 0x70, 0x74, 0x68, 
+    0x72, 0x65, 0x61, 0x64, 0x20, 0x2d, 0x6c, 0x63, 
+    0x72, 0x79, 0x70, 0x74, 0x20, 0x2d, 0x6c, 0x72, 
+    0x74, 0x20, 0x2d, 0x6c, 0x67, 0x6d, 0x70, 0x20, 
+    0x2d, 0x6c, 0x72, 0x65, 0x61, 0x64, 0x6c, 0x69, 
+    0x6e, 0x65, 0x20, 0x2d, 0x6c, 0x66, 0x66, 0x69, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x65, 0x78, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x65, 0x78, 0x65, 0x63, 0x5f, 0x70, 0x72, 0x65, 
+    0x66, 0x69, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2f, 0x75, 0x73, 0x72, 0x2f, 0x6c, 0x6f, 0x63, 
+    0x61, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x66, 0x6c, 0x65, 0x78, 0x5f, 0x76, 0x65, 0x72, 
+    0x73, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x00, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x5f, 0x74, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x66, 0x6c, 0x6f, 0x61, 0x74, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x66, 0x6c, 0x6f, 0x61, 0x74, 0x38, 0x5f, 0x74, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x66, 0x6c, 0x6f, 0x61, 0x74, 0x73, 0x69, 0x7a, 
+    0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x66, 0x6c, 0x6f, 0x61, 0x74, 0x76, 0x61, 0x6c, 
+    0x66, 0x6d, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x25, 0x2e, 0x31, 0x35, 0x67, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x66, 0x6c, 0x6f, 0x61, 0x74, 0x76, 0x61, 0x6c, 
+    0x6d, 0x61, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x44, 0x42, 0x4c, 0x5f, 0x4d, 0x41, 0x58, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x66, 0x6c, 0x6f, 0x61, 0x74, 0x76, 0x61, 0x6c, 
+    0x6d, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x44, 0x42, 0x4c, 0x5f, 0x4d, 0x49, 0x4e, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x67, 0x2b, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x67, 0x63, 0x5f, 0x66, 0x6c, 0x61, 0x67, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x67, 0x63, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x47, 0x4d, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x67, 0x63, 0x63, 0x76, 0x65, 0x72, 0x73, 0x69, 
+    0x6f, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x32, 0x2e, 0x32, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x67, 0x63, 0x6f, 0x76, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2f, 0x75, 0x73, 0x72, 0x2f, 0x62, 0x69, 0x6e, 
+    0x2f, 0x67, 0x63, 0x6f, 0x76, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x67, 0x63, 0x6f, 0x76, 0x32, 0x70, 0x65, 0x72, 
+    0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x24, 0x28, 0x50, 0x45, 0x52, 0x4c, 0x29, 0x20, 
+    0x2d, 0x65, 0x20, 0x22, 0x70, 0x72, 0x69, 0x6e, 
+    0x74, 0x20, 0x22, 0x67, 0x63, 0x6f, 0x76, 0x32, 
+    0x70, 0x65, 0x72, 0x6c, 0x20, 0x6e, 0x65, 0x65, 
+    0x64, 0x65, 0x64, 0x20, 0x62, 0x75, 0x74, 0x20, 
+    0x6e, 0x6f, 0x74, 0x20, 0x66, 0x6f, 0x75, 0x6e, 
+    0x64, 0x2e, 0x5c, 0x6e, 0x22, 0x3b, 0x20, 0x65, 
+    0x78, 0x69, 0x74, 0x20, 0x31, 0x3b, 0x22, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x67, 0x6c, 0x69, 0x62, 0x63, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x67, 0x6d, 0x61, 0x6b, 0x65, 0x5f, 0x76, 0x65, 
+    0x72, 0x73, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x34, 0x2e, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x67, 0x6d, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x68, 0x61, 0x73, 0x5f, 0x5f, 0x5f, 0x73, 0x69, 
+    0x67, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x72, 
+    0x5f, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x48, 0x41, 0x53, 0x5f, 0x42, 0x53, 0x44, 0x5f, 
+    0x53, 0x54, 0x41, 0x54, 0x5f, 0x45, 0x58, 0x54, 
+    0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x48, 0x41, 0x53, 0x5f, 0x42, 0x55, 0x49, 0x4c, 
+    0x54, 0x49, 0x4e, 0x5f, 0x45, 0x58, 0x50, 0x45, 
+    0x43, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x48, 0x41, 0x53, 0x5f, 0x43, 0x39, 0x39, 0x5f, 
+    0x53, 0x4e, 0x50, 0x52, 0x49, 0x4e, 0x54, 0x46, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x48, 0x41, 0x53, 0x5f, 0x43, 0x4f, 0x4d, 0x50, 
+    0x49, 0x4c, 0x45, 0x52, 0x5f, 0x4f, 0x46, 0x46, 
+    0x53, 0x45, 0x54, 0x4f, 0x46, 0x5f, 0x41, 0x4c, 
+    0x49, 0x47, 0x4e, 0x4f, 0x46, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x48, 0x41, 0x53, 0x5f, 0x43, 0x4f, 0x52, 0x45, 
+    0x5f, 0x4e, 0x43, 0x49, 0x5f, 0x54, 0x48, 0x55, 
+    0x4e, 0x4b, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x68, 0x61, 0x73, 0x5f, 0x63, 0x6f, 0x72, 0x65, 
+    0x5f, 0x6e, 0x63, 0x69, 0x5f, 0x74, 0x68, 0x75, 
+    0x6e, 0x6b, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x68, 0x61, 0x73, 0x5f, 0x63, 0x6f, 0x76, 0x65, 
+    0x72, 0x61, 0x67, 0x65, 0x5f, 0x74, 0x6f, 0x6f, 
+    0x6c, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x68, 0x61, 0x73, 0x5f, 0x64, 0x79, 0x6e, 0x61, 
+    0x6d, 0x69, 0x63, 0x5f, 0x6c, 0x69, 0x6e, 0x6b, 
+    0x69, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x48, 0x41, 0x53, 0x5f, 0x45, 0x58, 0x54, 0x52, 
+    0x41, 0x5f, 0x4e, 0x43, 0x49, 0x5f, 0x54, 0x48, 
+    0x55, 0x4e, 0x4b, 0x53, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x68, 0x61, 0x73, 0x5f, 0x65, 0x78, 0x74, 0x72, 
+    0x61, 0x5f, 0x6e, 0x63, 0x69, 0x5f, 0x74, 0x68, 
+    0x75, 0x6e, 0x6b, 0x73, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x48, 0x41, 0x53, 0x5f, 0x47, 0x45, 0x54, 0x54, 
+    0x45, 0x58, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x48, 0x41, 0x53, 0x5f, 0x47, 0x4c, 0x55, 0x54, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x68, 0x61, 0x73, 0x5f, 0x67, 0x6c, 0x75, 0x74, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x48, 0x41, 0x53, 0x5f, 0x47, 0x4d, 0x50, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x68, 0x61, 0x73, 0x5f, 0x69, 0x63, 0x75, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x48, 0x41, 0x53, 0x5f, 0x49, 0x4e, 0x46, 0x5f, 
+    0x4e, 0x41, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x48, 0x41, 0x53, 0x5f, 0x49, 0x4e, 0x54, 0x36, 
+    0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x48, 0x41, 0x53, 0x5f, 0x49, 0x50, 0x56, 0x36, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x48, 0x41, 0x53, 0x5f, 0x4c, 0x41, 0x42, 0x53, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x48, 0x41, 0x53, 0x5f, 0x4c, 0x49, 0x42, 0x46, 
+    0x46, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x68, 0x61, 0x73, 0x5f, 0x6c, 0x69, 0x62, 0x66, 
+    0x66, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x68, 0x61, 0x73, 0x5f, 0x6c, 0x6c, 0x76, 0x6d, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x48, 0x41, 0x53, 0x5f, 0x4c, 0x4f, 0x4e, 0x47, 
+    0x4c, 0x4f, 0x4e, 0x47, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x68, 0x61, 0x73, 0x5f, 0x6e, 0x65, 0x67, 0x61, 
+    0x74, 0x69, 0x76, 0x65, 0x5f, 0x7a, 0x65, 0x72, 
+    0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x48, 0x41, 0x53, 0x5f, 0x4f, 0x50, 0x45, 0x4e, 
+    0x47, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x68, 0x61, 0x73, 0x5f, 0x6f, 0x70, 0x65, 0x6e, 
+    0x67, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x68, 0x61, 0x73, 0x5f, 0x70, 0x65, 0x72, 0x6c, 
+    0x64, 0x6f, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x68, 0x61, 0x73, 0x5f, 0x70, 0x6f, 0x64, 0x32, 
+    0x6d, 0x61, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x48, 0x41, 0x53, 0x5f, 0x52, 0x45, 0x41, 0x44, 
+    0x4c, 0x49, 0x4e, 0x45, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x68, 0x61, 0x73, 0x5f, 0x73, 0x65, 0x74, 0x69, 
+    0x74, 0x69, 0x6d, 0x65, 0x72, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x68, 0x61, 0x73, 0x5f, 0x73, 0x69, 0x67, 0x5f, 
+    0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x5f, 0x74, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x68, 0x61, 0x73, 0x5f, 0x73, 0x69, 0x67, 0x61, 
+    0x63, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x68, 0x61, 0x73, 0x5f, 0x73, 0x69, 0x67, 0x61, 
+    0x74, 0x6f, 0x6d, 0x69, 0x63, 0x5f, 0x74, 0x00, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x48, 0x41, 0x53, 0x5f, 0x53, 0x4e, 0x50, 0x52, 
+    0x49, 0x4e, 0x54, 0x46, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x68, 0x61, 0x73, 0x5f, 0x73, 0x6f, 0x63, 0x6b, 
+    0x6c, 0x65, 0x6e, 0x5f, 0x74, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x48, 0x41, 0x53, 0x5f, 0x53, 0x54, 0x41, 0x54, 
+    0x5f, 0x41, 0x54, 0x49, 0x4d, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x48, 0x41, 0x53, 0x5f, 0x53, 0x54, 0x41, 0x54, 
+    0x5f, 0x41, 0x54, 0x49, 0x4d, 0x45, 0x53, 0x50, 
+    0x45, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x68, 0x61, 0x73, 0x5f, 0x73, 0x74, 0x61, 0x74, 
+    0x69, 0x63, 0x5f, 0x6c, 0x69, 0x6e, 0x6b, 0x69, 
+    0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x48, 0x41, 0x53, 0x5f, 0x54, 0x48, 0x52, 0x45, 
+    0x41, 0x44, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x48, 0x41, 0x53, 0x5f, 0x54, 0x49, 0x4d, 0x45, 
+    0x53, 0x50, 0x45, 0x43, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x68, 0x61, 0x73, 0x5f, 0x7a, 0x6c, 0x69, 0x62, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x48, 0x41, 0x53, 0x41, 0x54, 0x54, 0x52, 0x49, 
+    0x42, 0x55, 0x54, 0x45, 0x5f, 0x43, 0x4f, 0x4c, 
+    0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x48, 0x41, 0x53, 0x41, 0x54, 0x54, 0x52, 0x49, 
+    0x42, 0x55, 0x54, 0x45, 0x5f, 0x43, 0x4f, 0x4e, 
+    0x53, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x48, 0x41, 0x53, 0x41, 0x54, 0x54, 0x52, 0x49, 
+    0x42, 0x55, 0x54, 0x45, 0x5f, 0x44, 0x45, 0x50, 
+    0x52, 0x45, 0x43, 0x41, 0x54, 0x45, 0x44, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x48, 0x41, 0x53, 0x41, 0x54, 0x54, 0x52, 0x49, 
+    0x42, 0x55, 0x54, 0x45, 0x5f, 0x46, 0x4f, 0x52, 
+    0x4d, 0x41, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x48, 0x41, 0x53, 0x41, 0x54, 0x54, 0x52, 0x49, 
+    0x42, 0x55, 0x54, 0x45, 0x5f, 0x48, 0x4f, 0x54, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x48, 0x41, 0x53, 0x41, 0x54, 0x54, 0x52, 0x49, 
+    0x42, 0x55, 0x54, 0x45, 0x5f, 0x4d, 0x41, 0x4c, 
+    0x4c, 0x4f, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x48, 0x41, 0x53, 0x41, 0x54, 0x54, 0x52, 0x49, 
+    0x42, 0x55, 0x54, 0x45, 0x5f, 0x4e, 0x45, 0x56, 
+    0x45, 0x52, 0x5f, 0x57, 0x4f, 0x52, 0x4b, 0x53, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x48, 0x41, 0x53, 0x41, 0x54, 0x54, 0x52, 0x49, 
+    0x42, 0x55, 0x54, 0x45, 0x5f, 0x4e, 0x4f, 0x4e, 
+    0x4e, 0x55, 0x4c, 0x4c, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x48, 0x41, 0x53, 0x41, 0x54, 0x54, 0x52, 0x49, 
+    0x42, 0x55, 0x54, 0x45, 0x5f, 0x4e, 0x4f, 0x52, 
+    0x45, 0x54, 0x55, 0x52, 0x4e, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x48, 0x41, 0x53, 0x41, 0x54, 0x54, 0x52, 0x49, 
+    0x42, 0x55, 0x54, 0x45, 0x5f, 0x50, 0x55, 0x52, 
+    0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x48, 0x41, 0x53, 0x41, 0x54, 0x54, 0x52, 0x49, 
+    0x42, 0x55, 0x54, 0x45, 0x5f, 0x55, 0x4e, 0x55, 
+    0x53, 0x45, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x48, 0x41, 0x53, 0x41, 0x54, 0x54, 0x52, 0x49, 
+    0x42, 0x55, 0x54, 0x45, 0x5f, 0x57, 0x41, 0x52, 
+    0x4e, 0x5f, 0x55, 0x4e, 0x55, 0x53, 0x45, 0x44, 
+    0x5f, 0x52, 0x45, 0x53, 0x55, 0x4c, 0x54, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x68, 0x61, 0x76, 0x65, 0x5f, 0x63, 0x6f, 0x76, 
+    0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x24, 0x28, 0x50, 0x45, 0x52, 0x4c, 0x29, 0x20, 
+    0x2d, 0x65, 0x20, 0x22, 0x70, 0x72, 0x69, 0x6e, 
+    0x74, 0x20, 0x22, 0x54, 0x68, 0x65, 0x20, 0x66, 
+    0x6f, 0x6c, 0x6c, 0x6f, 0x77, 0x69, 0x6e, 0x67, 
+    0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x73, 0x20, 0x61, 
+    0x72, 0x65, 0x20, 0x6e, 0x65, 0x65, 0x64, 0x65, 
+    0x64, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x63, 0x6f, 
+    0x76, 0x65, 0x72, 0x61, 0x67, 0x65, 0x20, 0x74, 
+    0x65, 0x73, 0x74, 0x69, 0x6e, 0x67, 0x3a, 0x20, 
+    0x63, 0x6f, 0x76, 0x65, 0x72, 0x2c, 0x20, 0x67, 
+    0x63, 0x6f, 0x76, 0x32, 0x70, 0x65, 0x72, 0x6c, 
+    0x5c, 0x6e, 0x22, 0x3b, 0x20, 0x70, 0x72, 0x69, 
+    0x6e, 0x74, 0x20, 0x22, 0x50, 0x6c, 0x65, 0x61, 
+    0x73, 0x65, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x61, 
+    0x6c, 0x6c, 0x20, 0x44, 0x65, 0x76, 0x65, 0x6c, 
+    0x3a, 0x3a, 0x43, 0x6f, 0x76, 0x65, 0x72, 0x2e, 
+    0x5c, 0x6e, 0x22, 0x3b, 0x20, 0x65, 0x78, 0x69, 
+    0x74, 0x20, 0x31, 0x3b, 0x22, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x68, 0x75, 0x67, 0x65, 0x66, 0x6c, 0x6f, 0x61, 
+    0x74, 0x76, 0x61, 0x6c, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x64, 0x6f, 0x75, 
+    0x62, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x68, 0x75, 0x67, 0x65, 0x66, 0x6c, 0x6f, 0x61, 
+    0x74, 0x76, 0x61, 0x6c, 0x73, 0x69, 0x7a, 0x65, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x68, 0x75, 0x67, 0x65, 0x69, 0x6e, 0x74, 0x76, 
+    0x61, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 
+    0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x68, 0x75, 0x67, 0x65, 0x69, 0x6e, 0x74, 0x76, 
+    0x61, 0x6c, 0x73, 0x69, 0x7a, 0x65, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x69, 0x5f, 0x6c, 0x69, 0x62, 0x63, 0x70, 0x75, 
+    0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x69, 0x5f, 0x6e, 0x65, 0x74, 0x69, 0x6e, 0x65, 
+    0x74, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x69, 0x5f, 0x73, 0x65, 0x74, 0x6a, 0x6d, 0x70, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x69, 0x5f, 0x73, 0x69, 0x67, 0x6e, 0x61, 0x6c, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x69, 0x5f, 0x73, 0x79, 0x73, 0x65, 0x78, 0x69, 
+    0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x69, 0x5f, 0x73, 0x79, 0x73, 0x72, 0x65, 0x73, 
+    0x6f, 0x75, 0x72, 0x63, 0x65, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x69, 0x5f, 0x73, 0x79, 0x73, 0x73, 0x6f, 0x63, 
+    0x6b, 0x65, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x69, 0x5f, 0x73, 0x79, 0x73, 0x73, 0x79, 0x73, 
+    0x63, 0x74, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x69, 0x63, 0x75, 0x5f, 0x64, 0x69, 0x72, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x69, 0x63, 0x75, 0x5f, 0x73, 0x68, 0x61, 0x72, 
+    0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x64, 
+    0x69, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2f, 0x75, 0x73, 0x72, 0x2f, 0x6c, 0x6f, 0x63, 
+    0x61, 0x6c, 0x2f, 0x69, 0x6e, 0x63, 0x6c, 0x75, 
+    0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x69, 0x6e, 0x66, 0x6f, 0x64, 0x69, 0x72, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2f, 0x75, 0x73, 0x72, 0x2f, 0x6c, 0x6f, 0x63, 
+    0x61, 0x6c, 0x2f, 0x69, 0x6e, 0x66, 0x6f, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x69, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x69, 0x6e, 0x73, 0x74, 0x5f, 0x6c, 0x69, 0x62, 
+    0x70, 0x61, 0x72, 0x72, 0x6f, 0x74, 0x5f, 0x6c, 
+    0x64, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x69, 0x6e, 0x73, 0x74, 0x5f, 0x6c, 0x69, 0x62, 
+    0x70, 0x61, 0x72, 0x72, 0x6f, 0x74, 0x5f, 0x6c, 
+    0x69, 0x6e, 0x6b, 0x66, 0x6c, 0x61, 0x67, 0x73, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2d, 0x4c, 0x22, 0x2f, 0x75, 0x73, 0x72, 0x2f, 
+    0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x2f, 0x6c, 0x69, 
+    0x62, 0x22, 0x20, 0x2d, 0x6c, 0x70, 0x61, 0x72, 
+    0x72, 0x6f, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x69, 0x6e, 0x74, 0x32, 0x5f, 0x74, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x73, 0x68, 0x6f, 0x72, 0x74, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x69, 0x6e, 0x74, 0x34, 0x5f, 0x74, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x69, 0x6e, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x69, 0x6e, 0x74, 0x38, 0x5f, 0x74, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x69, 0x6e, 0x74, 0x73, 0x69, 0x7a, 0x65, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x69, 0x6e, 0x74, 0x76, 0x61, 0x6c, 0x66, 0x6d, 
+    0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x25, 0x6c, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x69, 0x6e, 0x74, 0x76, 0x61, 0x6c, 0x6d, 0x61, 
+    0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x4c, 0x4f, 0x4e, 0x47, 0x5f, 0x4d, 0x41, 0x58, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x69, 0x6e, 0x74, 0x76, 0x61, 0x6c, 0x6d, 0x69, 
+    0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x4c, 0x4f, 0x4e, 0x47, 0x5f, 0x4d, 0x49, 0x4e, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x69, 0x6e, 0x74, 0x76, 0x61, 0x6c, 0x73, 0x69, 
+    0x7a, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x69, 0x73, 0x72, 0x65, 0x67, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x69, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6c, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x78, 0x38, 0x36, 0x5f, 0x36, 0x34, 0x2d, 0x6c, 
+    0x69, 0x6e, 0x75, 0x78, 0x2d, 0x67, 0x6e, 0x75, 
+    0x2d, 0x67, 0x63, 0x63, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6c, 0x64, 0x5f, 0x64, 0x65, 0x62, 0x75, 0x67, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6c, 0x64, 0x5f, 0x6c, 0x6f, 0x61, 0x64, 0x5f, 
+    0x66, 0x6c, 0x61, 0x67, 0x73, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2d, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x20, 
+    0x2d, 0x4c, 0x2f, 0x75, 0x73, 0x72, 0x2f, 0x6c, 
+    0x6f, 0x63, 0x61, 0x6c, 0x2f, 0x6c, 0x69, 0x62, 
+    0x20, 0x2d, 0x66, 0x73, 0x74, 0x61, 0x63, 0x6b, 
+    0x2d, 0x70, 0x72, 0x6f, 0x74, 0x65, 0x63, 0x74, 
+    0x6f, 0x72, 0x2d, 0x73, 0x74, 0x72, 0x6f, 0x6e, 
+    0x67, 0x20, 0x2d, 0x66, 0x50, 0x49, 0x43, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6c, 0x64, 0x5f, 0x6f, 0x75, 0x74, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2d, 0x6f, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6c, 0x64, 0x5f, 0x73, 0x68, 0x61, 0x72, 0x65, 
+    0x5f, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2d, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x20, 
+    0x2d, 0x4c, 0x2f, 0x75, 0x73, 0x72, 0x2f, 0x6c, 
+    0x6f, 0x63, 0x61, 0x6c, 0x2f, 0x6c, 0x69, 0x62, 
+    0x20, 0x2d, 0x66, 0x73, 0x74, 0x61, 0x63, 0x6b, 
+    0x2d, 0x70, 0x72, 0x6f, 0x74, 0x65, 0x63, 0x74, 
+    0x6f, 0x72, 0x2d, 0x73, 0x74, 0x72, 0x6f, 0x6e, 
+    0x67, 0x20, 0x2d, 0x66, 0x50, 0x49, 0x43, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6c, 0x64, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x20, 0x2d, 0x66, 0x73, 0x74, 0x61, 0x63, 0x6b, 
+    0x2d, 0x70, 0x72, 0x6f, 0x74, 0x65, 0x63, 0x74, 
+    0x6f, 0x72, 0x2d, 0x73, 0x74, 0x72, 0x6f, 0x6e, 
+    0x67, 0x20, 0x2d, 0x4c, 0x2f, 0x75, 0x73, 0x72, 
+    0x2f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x2f, 0x6c, 
+    0x69, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6c, 0x65, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x65, 0x63, 0x68, 0x6f, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6c, 0x69, 0x62, 0x64, 0x69, 0x72, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2f, 0x75, 0x73, 0x72, 0x2f, 0x6c, 0x6f, 0x63, 
+    0x61, 0x6c, 0x2f, 0x6c, 0x69, 0x62, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6c, 0x69, 0x62, 0x65, 0x78, 0x65, 0x63, 0x64, 
+    0x69, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2f, 0x75, 0x73, 0x72, 0x2f, 0x6c, 0x6f, 0x63, 
+    0x61, 0x6c, 0x2f, 0x6c, 0x69, 0x62, 0x65, 0x78, 
+    0x65, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6c, 0x69, 0x62, 0x70, 0x61, 0x72, 0x72, 0x6f, 
+    0x74, 0x5f, 0x66, 0x6f, 0x72, 0x5f, 0x6d, 0x61, 
+    0x6b, 0x65, 0x66, 0x69, 0x6c, 0x65, 0x5f, 0x6f, 
+    0x6e, 0x6c, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x24, 0x28, 0x4c, 0x49, 0x42, 0x50, 0x41, 0x52, 
+    0x52, 0x4f, 0x54, 0x5f, 0x53, 0x48, 0x41, 0x52, 
+    0x45, 0x44, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6c, 0x69, 0x62, 0x70, 0x61, 0x72, 0x72, 0x6f, 
+    0x74, 0x5f, 0x6c, 0x64, 0x66, 0x6c, 0x61, 0x67, 
+    0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6c, 0x69, 0x62, 0x70, 0x61, 0x72, 0x72, 0x6f, 
+    0x74, 0x5f, 0x6c, 0x69, 0x6e, 0x6b, 0x66, 0x6c, 
+    0x61, 0x67, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2d, 0x4c, 0x22, 0x2f, 0x72, 0x6f, 0x6f, 0x74, 
+    0x2f, 0x72, 0x65, 0x70, 0x6f, 0x2f, 0x62, 0x6c, 
+    0x69, 0x62, 0x2f, 0x6c, 0x69, 0x62, 0x22, 0x20, 
+    0x2d, 0x6c, 0x70, 0x61, 0x72, 0x72, 0x6f, 0x74, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6c, 0x69, 0x62, 0x70, 0x61, 0x72, 0x72, 0x6f, 
+    0x74, 0x5f, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6c, 0x69, 0x62, 0x70, 0x61, 0x72, 0x72, 0x6f, 
+    0x74, 0x2e, 0x73, 0x6f, 0x2e, 0x36, 0x2e, 0x39, 
+    0x2e, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6c, 0x69, 0x62, 0x70, 0x61, 0x72, 0x72, 0x6f, 
+    0x74, 0x5f, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 
+    0x5f, 0x61, 0x6c, 0x69, 0x61, 0x73, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6c, 0x69, 0x62, 0x70, 0x61, 0x72, 0x72, 0x6f, 
+    0x74, 0x2e, 0x73, 0x6f, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6c, 0x69, 0x62, 0x70, 0x61, 0x72, 0x72, 0x6f, 
+    0x74, 0x5f, 0x73, 0x6f, 0x6e, 0x61, 0x6d, 0x65, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2d, 0x57, 0x6c, 0x2c, 0x2d, 0x73, 0x6f, 0x6e, 
+    0x61, 0x6d, 0x65, 0x3d, 0x6c, 0x69, 0x62, 0x70, 
+    0x61, 0x72, 0x72, 0x6f, 0x74, 0x2e, 0x73, 0x6f, 
+    0x2e, 0x36, 0x2e, 0x39, 0x2e, 0x30, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6c, 0x69, 0x62, 0x70, 0x61, 0x72, 0x72, 0x6f, 
+    0x74, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6c, 0x69, 0x62, 0x70, 0x61, 0x72, 0x72, 0x6f, 
+    0x74, 0x2e, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x5f, 
+    0x74, 0x65, 0x73, 0x74, 0x73, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x12, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x74, 0x2f, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 
+    0x65, 0x72, 0x73, 0x2f, 0x70, 0x63, 0x74, 0x2f, 
+    0x2a, 0x2e, 0x74, 0x20, 0x74, 0x2f, 0x63, 0x6f, 
+    0x6d, 0x70, 0x69, 0x6c, 0x65, 0x72, 0x73, 0x2f, 
+    0x70, 0x67, 0x65, 0x2f, 0x2a, 0x2e, 0x74, 0x20, 
+    0x74, 0x2f, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 
+    0x65, 0x72, 0x73, 0x2f, 0x70, 0x67, 0x65, 0x2f, 
+    0x70, 0x35, 0x72, 0x65, 0x67, 0x65, 0x78, 0x2f, 
+    0x2a, 0x2e, 0x74, 0x20, 0x74, 0x2f, 0x63, 0x6f, 
+    0x6d, 0x70, 0x69, 0x6c, 0x65, 0x72, 0x73, 0x2f, 
+    0x70, 0x67, 0x65, 0x2f, 0x70, 0x65, 0x72, 0x6c, 
+    0x36, 0x72, 0x65, 0x67, 0x65, 0x78, 0x2f, 0x2a, 
+    0x2e, 0x74, 0x20, 0x74, 0x2f, 0x63, 0x6f, 0x6d, 
+    0x70, 0x69, 0x6c, 0x65, 0x72, 0x73, 0x2f, 0x74, 
+    0x67, 0x65, 0x2f, 0x2a, 0x2e, 0x74, 0x20, 0x74, 
+    0x2f, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 
+    0x72, 0x73, 0x2f, 0x6f, 0x70, 0x73, 0x63, 0x2f, 
+    0x2a, 0x2e, 0x74, 0x20, 0x74, 0x2f, 0x63, 0x6f, 
+    0x6d, 0x70, 0x69, 0x6c, 0x65, 0x72, 0x73, 0x2f, 
+    0x64, 0x61, 0x74, 0x61, 0x5f, 0x6a, 0x73, 0x6f, 
+    0x6e, 0x2f, 0x2a, 0x2e, 0x74, 0x20, 0x65, 0x78, 
+    0x74, 0x2f, 0x6e, 0x71, 0x70, 0x2d, 0x72, 0x78, 
+    0x2f, 0x74, 0x2f, 0x6e, 0x71, 0x70, 0x2f, 0x2a, 
+    0x2e, 0x74, 0x20, 0x74, 0x2f, 0x64, 0x79, 0x6e, 
+    0x6f, 0x70, 0x6c, 0x69, 0x62, 0x73, 0x2f, 0x2a, 
+    0x2e, 0x74, 0x20, 0x74, 0x2f, 0x64, 0x79, 0x6e, 
+    0x70, 0x6d, 0x63, 0x2f, 0x2a, 0x2e, 0x74, 0x20, 
+    0x74, 0x2f, 0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 
+    0x79, 0x2f, 0x2a, 0x2e, 0x74, 0x20, 0x74, 0x2f, 
+    0x65, 0x78, 0x74, 0x2f, 0x77, 0x69, 0x6e, 0x78, 
+    0x65, 0x64, 0x2f, 0x2a, 0x2e, 0x74, 0x20, 0x74, 
+    0x2f, 0x74, 0x6f, 0x6f, 0x6c, 0x73, 0x2f, 0x2a, 
+    0x2e, 0x74, 0x20, 0x74, 0x2f, 0x70, 0x72, 0x6f, 
+    0x66, 0x69, 0x6c, 0x69, 0x6e, 0x67, 0x2f, 0x2a, 
+    0x2e, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6c, 0x69, 0x62, 0x73, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2d, 0x6c, 0x64, 0x6c, 0x20, 0x2d, 0x6c, 0x6d, 
+    0x20, 0x2d, 0x6c, 0x70, 0x74, 0x68, 0x72, 0x65, 
+    0x61, 0x64, 0x20, 0x2d, 0x6c, 0x63, 0x72, 0x79, 
+    0x70, 0x74, 0x20, 0x2d, 0x6c, 0x72, 0x74, 0x20, 
+    0x2d, 0x6c, 0x67, 0x6d, 0x70, 0x20, 0x2d, 0x6c, 
+    0x72, 0x65, 0x61, 0x64, 0x6c, 0x69, 0x6e, 0x65, 
+    0x20, 0x20, 0x2d, 0x6c, 0x66, 0x66, 0x69, 0x20, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6c, 0x69, 0x6e, 0x6b, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x78, 0x38, 0x36, 0x5f, 0x36, 0x34, 0x2d, 0x6c, 
+    0x69, 0x6e, 0x75, 0x78, 0x2d, 0x67, 0x6e, 0x75, 
+    0x2d, 0x67, 0x63, 0x63, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6c, 0x69, 0x6e, 0x6b, 0x5f, 0x64, 0x65, 0x62, 
+    0x75, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6c, 0x69, 0x6e, 0x6b, 0x5f, 0x64, 0x79, 0x6e, 
+    0x61, 0x6d, 0x69, 0x63, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2d, 0x57, 0x6c, 0x2c, 0x2d, 0x45, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6c, 0x69, 0x6e, 0x6b, 0x66, 0x6c, 0x61, 0x67, 
+    0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x20, 0x2d, 0x66, 0x73, 0x74, 0x61, 0x63, 0x6b, 
+    0x2d, 0x70, 0x72, 0x6f, 0x74, 0x65, 0x63, 0x74, 
+    0x6f, 0x72, 0x2d, 0x73, 0x74, 0x72, 0x6f, 0x6e, 
+    0x67, 0x20, 0x2d, 0x4c, 0x2f, 0x75, 0x73, 0x72, 
+    0x2f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x2f, 0x6c, 
+    0x69, 0x62, 0x20, 0x2d, 0x57, 0x6c, 0x2c, 0x2d, 
+    0x45, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6c, 0x6e, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6c, 0x6e, 0x20, 0x2d, 0x73, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6c, 0x6f, 0x61, 0x64, 0x5f, 0x65, 0x78, 0x74, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2e, 0x73, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x73, 0x74, 0x61, 
+    0x74, 0x65, 0x64, 0x69, 0x72, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2f, 0x75, 0x73, 0x72, 0x2f, 0x6c, 0x6f, 0x63, 
+    0x61, 0x6c, 0x2f, 0x76, 0x61, 0x72, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6c, 0x6f, 0x6e, 0x67, 0x64, 0x6f, 0x75, 0x62, 
+    0x6c, 0x65, 0x73, 0x69, 0x7a, 0x65, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6c, 0x6f, 0x6e, 0x67, 0x6c, 0x6f, 0x6e, 0x67, 
+    0x73, 0x69, 0x7a, 0x65, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6c, 0x6f, 0x6e, 0x67, 0x73, 0x69, 0x7a, 0x65, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x4d, 0x41, 0x4a, 0x4f, 0x52, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6d, 0x61, 0x6b, 0x65, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x67, 0x6d, 0x61, 0x6b, 0x65, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6d, 0x61, 0x6b, 0x65, 0x5f, 0x61, 0x6e, 0x64, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x26, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6d, 0x61, 0x6b, 0x65, 0x5f, 0x63, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2b, 0x67, 0x6d, 0x61, 0x6b, 0x65, 0x20, 0x2d, 
+    0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6d, 0x61, 0x6b, 0x65, 0x5f, 0x73, 0x65, 0x74, 
+    0x5f, 0x6d, 0x61, 0x6b, 0x65, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6d, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x5f, 0x68, 
+    0x65, 0x61, 0x64, 0x65, 0x72, 0x00, 0x00, 0x00, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6d, 0x61, 0x6e, 0x64, 0x69, 0x72, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2f, 0x75, 0x73, 0x72, 0x2f, 0x6c, 0x6f, 0x63, 
+    0x61, 0x6c, 0x2f, 0x6d, 0x61, 0x6e, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6d, 0x65, 0x6d, 0x61, 0x6c, 0x69, 0x67, 0x6e, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x70, 0x6f, 0x73, 0x69, 0x78, 0x5f, 0x6d, 0x65, 
+    0x6d, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x4d, 0x49, 0x4e, 0x4f, 0x52, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6d, 0x6b, 0x70, 0x61, 0x74, 0x68, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x24, 0x28, 0x50, 0x45, 0x52, 0x4c, 0x29, 0x20, 
+    0x2d, 0x4d, 0x45, 0x78, 0x74, 0x55, 0x74, 0x69, 
+    0x6c, 0x73, 0x3a, 0x3a, 0x43, 0x6f, 0x6d, 0x6d, 
+    0x61, 0x6e, 0x64, 0x20, 0x2d, 0x65, 0x20, 0x6d, 
+    0x6b, 0x70, 0x61, 0x74, 0x68, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6d, 0x73, 0x76, 0x63, 0x76, 0x65, 0x72, 0x73, 
+    0x69, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6d, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x24, 0x28, 0x50, 0x45, 0x52, 0x4c, 0x29, 0x20, 
+    0x2d, 0x4d, 0x45, 0x78, 0x74, 0x55, 0x74, 0x69, 
+    0x6c, 0x73, 0x3a, 0x3a, 0x43, 0x6f, 0x6d, 0x6d, 
+    0x61, 0x6e, 0x64, 0x20, 0x2d, 0x65, 0x20, 0x6d, 
+    0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6e, 0x63, 0x69, 0x6c, 0x69, 0x62, 0x5f, 0x6c, 
+    0x69, 0x6e, 0x6b, 0x5f, 0x65, 0x78, 0x74, 0x72, 
+    0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6e, 0x65, 0x77, 0x5f, 0x70, 0x65, 0x72, 0x6c, 
+    0x64, 0x6f, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6e, 0x6f, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x73, 
+    0x5f, 0x66, 0x6c, 0x61, 0x67, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6e, 0x6f, 0x69, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x5f, 0x5f, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 
+    0x75, 0x74, 0x65, 0x5f, 0x5f, 0x20, 0x28, 0x28, 
+    0x6e, 0x6f, 0x69, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 
+    0x29, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6e, 0x75, 0x6d, 0x76, 0x61, 0x6c, 0x73, 0x69, 
+    0x7a, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6e, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6e, 0x76, 0x73, 0x69, 0x7a, 0x65, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2e, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6f, 0x6c, 0x64, 0x69, 0x6e, 0x63, 0x6c, 0x75, 
+    0x64, 0x65, 0x64, 0x69, 0x72, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2f, 0x75, 0x73, 0x72, 0x2f, 0x69, 0x6e, 0x63, 
+    0x6c, 0x75, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6f, 0x70, 0x63, 0x6f, 0x64, 0x65, 0x5f, 0x74, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6f, 0x70, 0x63, 0x6f, 0x64, 0x65, 0x73, 0x69, 
+    0x7a, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6f, 0x70, 0x65, 0x6e, 0x67, 0x6c, 0x5f, 0x6c, 
+    0x69, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6f, 0x70, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x73, 0x72, 0x63, 0x2f, 0x6f, 0x70, 0x73, 0x2f, 
+    0x63, 0x6f, 0x72, 0x65, 0x2e, 0x6f, 0x70, 0x73, 
+    0x20, 0x73, 0x72, 0x63, 0x2f, 0x6f, 0x70, 0x73, 
+    0x2f, 0x62, 0x69, 0x74, 0x2e, 0x6f, 0x70, 0x73, 
+    0x20, 0x73, 0x72, 0x63, 0x2f, 0x6f, 0x70, 0x73, 
+    0x2f, 0x63, 0x6d, 0x70, 0x2e, 0x6f, 0x70, 0x73, 
+    0x20, 0x73, 0x72, 0x63, 0x2f, 0x6f, 0x70, 0x73, 
+    0x2f, 0x65, 0x78, 0x70, 0x65, 0x72, 0x69, 0x6d, 
+    0x65, 0x6e, 0x74, 0x61, 0x6c, 0x2e, 0x6f, 0x70, 
+    0x73, 0x20, 0x73, 0x72, 0x63, 0x2f, 0x6f, 0x70, 
+    0x73, 0x2f, 0x69, 0x6f, 0x2e, 0x6f, 0x70, 0x73, 
+    0x20, 0x73, 0x72, 0x63, 0x2f, 0x6f, 0x70, 0x73, 
+    0x2f, 0x6d, 0x61, 0x74, 0x68, 0x2e, 0x6f, 0x70, 
+    0x73, 0x20, 0x73, 0x72, 0x63, 0x2f, 0x6f, 0x70, 
+    0x73, 0x2f, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 
+    0x2e, 0x6f, 0x70, 0x73, 0x20, 0x73, 0x72, 0x63, 
+    0x2f, 0x6f, 0x70, 0x73, 0x2f, 0x70, 0x6d, 0x63, 
+    0x2e, 0x6f, 0x70, 0x73, 0x20, 0x73, 0x72, 0x63, 
+    0x2f, 0x6f, 0x70, 0x73, 0x2f, 0x73, 0x65, 0x74, 
+    0x2e, 0x6f, 0x70, 0x73, 0x20, 0x73, 0x72, 0x63, 
+    0x2f, 0x6f, 0x70, 0x73, 0x2f, 0x73, 0x74, 0x72, 
+    0x69, 0x6e, 0x67, 0x2e, 0x6f, 0x70, 0x73, 0x20, 
+    0x73, 0x72, 0x63, 0x2f, 0x6f, 0x70, 0x73, 0x2f, 
+    0x73, 0x79, 0x73, 0x2e, 0x6f, 0x70, 0x73, 0x20, 
+    0x73, 0x72, 0x63, 0x2f, 0x6f, 0x70, 0x73, 0x2f, 
+    0x76, 0x61, 0x72, 0x2e, 0x6f, 0x70, 0x73, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6f, 0x70, 0x73, 0x32, 0x63, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x70, 0x61, 0x72, 0x72, 0x6f, 0x74, 0x2d, 0x6f, 
+    0x70, 0x73, 0x32, 0x63, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, 0x65, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6f, 0x73, 0x6e, 0x61, 0x6d, 0x65, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6c, 0x69, 0x6e, 0x75, 0x78, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6f, 0x73, 0x76, 0x65, 0x72, 0x73, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x36, 0x2e, 0x31, 0x38, 0x2e, 0x34, 0x34, 0x2d, 
+    0x66, 0x63, 0x2d, 0x76, 0x31, 0x33, 0x39, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x50, 0x41, 0x52, 0x52, 0x4f, 0x54, 0x5f, 0x48, 
+    0x41, 0x53, 0x5f, 0x44, 0x4c, 0x49, 0x4e, 0x46, 
+    0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x70, 0x61, 0x72, 0x72, 0x6f, 0x74, 0x5f, 0x69, 
+    0x73, 0x5f, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x50, 0x41, 0x54, 0x43, 0x48, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x70, 0x65, 0x72, 0x6c, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2f, 0x75, 0x73, 0x72, 0x2f, 0x62, 0x69, 0x6e, 
+    0x2f, 0x70, 0x65, 0x72, 0x6c, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x70, 0x65, 0x72, 0x6c, 0x64, 0x6f, 0x63, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x65, 0x63, 0x68, 0x6f, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x70, 0x6c, 0x61, 0x74, 0x66, 0x6f, 0x72, 0x6d, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x67, 0x65, 0x6e, 0x65, 0x72, 0x69, 0x63, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x70, 0x6c, 0x61, 0x74, 0x66, 0x6f, 0x72, 0x6d, 
+    0x5f, 0x61, 0x73, 0x6d, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x70, 0x6d, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xc7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x2e, 
+    0x70, 0x6d, 0x63, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 
+    0x2e, 0x70, 0x6d, 0x63, 0x20, 0x65, 0x6e, 0x76, 
+    0x2e, 0x70, 0x6d, 0x63, 0x20, 0x6b, 0x65, 0x79, 
+    0x2e, 0x70, 0x6d, 0x63, 0x20, 0x75, 0x6e, 0x6d, 
+    0x61, 0x6e, 0x61, 0x67, 0x65, 0x64, 0x73, 0x74, 
+    0x72, 0x75, 0x63, 0x74, 0x2e, 0x70, 0x6d, 0x63, 
+    0x20, 0x6d, 0x61, 0x6e, 0x61, 0x67, 0x65, 0x64, 
+    0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x2e, 0x70, 
+    0x6d, 0x63, 0x20, 0x65, 0x78, 0x63, 0x65, 0x70, 
+    0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x70, 0x6d, 0x63, 
+    0x20, 0x70, 0x61, 0x72, 0x72, 0x6f, 0x74, 0x6c, 
+    0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x2e, 0x70, 
+    0x6d, 0x63, 0x20, 0x70, 0x61, 0x72, 0x72, 0x6f, 
+    0x74, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x70, 0x72, 
+    0x65, 0x74, 0x65, 0x72, 0x2e, 0x70, 0x6d, 0x63, 
+    0x20, 0x6c, 0x65, 0x78, 0x70, 0x61, 0x64, 0x2e, 
+    0x70, 0x6d, 0x63, 0x20, 0x74, 0x69, 0x6d, 0x65, 
+    0x72, 0x2e, 0x70, 0x6d, 0x63, 0x20, 0x70, 0x6f, 
+    0x69, 0x6e, 0x74, 0x65, 0x72, 0x2e, 0x70, 0x6d, 
+    0x63, 0x20, 0x73, 0x75, 0x62, 0x2e, 0x70, 0x6d, 
+    0x63, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 
+    0x75, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x70, 
+    0x6d, 0x63, 0x20, 0x63, 0x6f, 0x72, 0x6f, 0x75, 
+    0x74, 0x69, 0x6e, 0x65, 0x2e, 0x70, 0x6d, 0x63, 
+    0x20, 0x6e, 0x63, 0x69, 0x2e, 0x70, 0x6d, 0x63, 
+    0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x2e, 0x70, 
+    0x6d, 0x63, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x67, 
+    0x65, 0x72, 0x2e, 0x70, 0x6d, 0x63, 0x20, 0x62, 
+    0x69, 0x67, 0x69, 0x6e, 0x74, 0x2e, 0x70, 0x6d, 
+    0x63, 0x20, 0x62, 0x69, 0x67, 0x6e, 0x75, 0x6d, 
+    0x2e, 0x70, 0x6d, 0x63, 0x20, 0x63, 0x6f, 0x6d, 
+    0x70, 0x6c, 0x65, 0x78, 0x2e, 0x70, 0x6d, 0x63, 
+    0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2e, 
+    0x70, 0x6d, 0x63, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 
+    0x65, 0x61, 0x6e, 0x2e, 0x70, 0x6d, 0x63, 0x20, 
+    0x66, 0x69, 0x78, 0x65, 0x64, 0x69, 0x6e, 0x74, 
+    0x65, 0x67, 0x65, 0x72, 0x61, 0x72, 0x72, 0x61, 
+    0x79, 0x2e, 0x70, 0x6d, 0x63, 0x20, 0x69, 0x74, 
+    0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x2e, 0x70, 
+    0x6d, 0x63, 0x20, 0x66, 0x69, 0x78, 0x65, 0x64, 
+    0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x61, 0x72, 
+    0x72, 0x61, 0x79, 0x2e, 0x70, 0x6d, 0x63, 0x20, 
+    0x68, 0x61, 0x73, 0x68, 0x2e, 0x70, 0x6d, 0x63, 
+    0x20, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x65, 0x64, 
+    0x68, 0x61, 0x73, 0x68, 0x2e, 0x70, 0x6d, 0x63, 
+    0x20, 0x6f, 0x70, 0x6c, 0x69, 0x62, 0x2e, 0x70, 
+    0x6d, 0x63, 0x20, 0x6f, 0x70, 0x63, 0x6f, 0x64, 
+    0x65, 0x2e, 0x70, 0x6d, 0x63, 0x20, 0x63, 0x61, 
+    0x6c, 0x6c, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x78, 
+    0x74, 0x2e, 0x70, 0x6d, 0x63, 0x20, 0x61, 0x64, 
+    0x64, 0x72, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 
+    0x72, 0x79, 0x2e, 0x70, 0x6d, 0x63, 0x20, 0x61, 
+    0x6c, 0x61, 0x72, 0x6d, 0x2e, 0x70, 0x6d, 0x63, 
+    0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x69, 0x74, 
+    0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x2e, 0x70, 
+    0x6d, 0x63, 0x20, 0x62, 0x79, 0x74, 0x65, 0x62, 
+    0x75, 0x66, 0x66, 0x65, 0x72, 0x2e, 0x70, 0x6d, 
+    0x63, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x62, 0x61, 
+    0x63, 0x6b, 0x2e, 0x70, 0x6d, 0x63, 0x20, 0x63, 
+    0x61, 0x70, 0x74, 0x75, 0x72, 0x65, 0x2e, 0x70, 
+    0x6d, 0x63, 0x20, 0x63, 0x68, 0x61, 0x6e, 0x6e, 
+    0x65, 0x6c, 0x2e, 0x70, 0x6d, 0x63, 0x20, 0x63, 
+    0x6c, 0x61, 0x73, 0x73, 0x2e, 0x70, 0x6d, 0x63, 
+    0x20, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x68, 0x61, 
+    0x6e, 0x64, 0x6c, 0x65, 0x72, 0x2e, 0x70, 0x6d, 
+    0x63, 0x20, 0x65, 0x78, 0x63, 0x65, 0x70, 0x74, 
+    0x69, 0x6f, 0x6e, 0x68, 0x61, 0x6e, 0x64, 0x6c, 
+    0x65, 0x72, 0x2e, 0x70, 0x6d, 0x63, 0x20, 0x65, 
+    0x78, 0x70, 0x6f, 0x72, 0x74, 0x65, 0x72, 0x2e, 
+    0x70, 0x6d, 0x63, 0x20, 0x66, 0x69, 0x6c, 0x65, 
+    0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x2e, 0x70, 
+    0x6d, 0x63, 0x20, 0x66, 0x69, 0x78, 0x65, 0x64, 
+    0x62, 0x6f, 0x6f, 0x6c, 0x65, 0x61, 0x6e, 0x61, 
+    0x72, 0x72, 0x61, 0x79, 0x2e, 0x70, 0x6d, 0x63, 
+    0x20, 0x66, 0x69, 0x78, 0x65, 0x64, 0x66, 0x6c, 
+    0x6f, 0x61, 0x74, 0x61, 0x72, 0x72, 0x61, 0x79, 
+    0x2e, 0x70, 0x6d, 0x63, 0x20, 0x66, 0x69, 0x78, 
+    0x65, 0x64, 0x70, 0x6d, 0x63, 0x61, 0x72, 0x72, 
+    0x61, 0x79, 0x2e, 0x70, 0x6d, 0x63, 0x20, 0x68, 
+    0x61, 0x6e, 0x64, 0x6c, 0x65, 0x2e, 0x70, 0x6d, 
+    0x63, 0x20, 0x68, 0x61, 0x73, 0x68, 0x69, 0x74, 
+    0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x2e, 0x70, 
+    0x6d, 0x63, 0x20, 0x68, 0x61, 0x73, 0x68, 0x69, 
+    0x74, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x6b, 
+    0x65, 0x79, 0x2e, 0x70, 0x6d, 0x63, 0x20, 0x69, 
+    0x6d, 0x61, 0x67, 0x65, 0x69, 0x6f, 0x66, 0x72, 
+    0x65, 0x65, 0x7a, 0x65, 0x2e, 0x70, 0x6d, 0x63, 
+    0x20, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x69, 0x6f, 
+    0x73, 0x69, 0x7a, 0x65, 0x2e, 0x70, 0x6d, 0x63, 
+    0x20, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x69, 0x6f, 
+    0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x73, 0x2e, 
+    0x70, 0x6d, 0x63, 0x20, 0x69, 0x6d, 0x61, 0x67, 
+    0x65, 0x69, 0x6f, 0x74, 0x68, 0x61, 0x77, 0x2e, 
+    0x70, 0x6d, 0x63, 0x20, 0x69, 0x6d, 0x63, 0x63, 
+    0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x72, 0x2e, 
+    0x70, 0x6d, 0x63, 0x20, 0x6c, 0x65, 0x78, 0x69, 
+    0x6e, 0x66, 0x6f, 0x2e, 0x70, 0x6d, 0x63, 0x20, 
+    0x6d, 0x61, 0x70, 0x70, 0x65, 0x64, 0x62, 0x79, 
+    0x74, 0x65, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2e, 
+    0x70, 0x6d, 0x63, 0x20, 0x6d, 0x75, 0x6c, 0x74, 
+    0x69, 0x73, 0x75, 0x62, 0x2e, 0x70, 0x6d, 0x63, 
+    0x20, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x70, 0x61, 
+    0x63, 0x65, 0x2e, 0x70, 0x6d, 0x63, 0x20, 0x6e, 
+    0x61, 0x74, 0x69, 0x76, 0x65, 0x70, 0x63, 0x63, 
+    0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x2e, 0x70, 
+    0x6d, 0x63, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 
+    0x74, 0x2e, 0x70, 0x6d, 0x63, 0x20, 0x6f, 0x72, 
+    0x64, 0x65, 0x72, 0x65, 0x64, 0x68, 0x61, 0x73, 
+    0x68, 0x69, 0x74, 0x65, 0x72, 0x61, 0x74, 0x6f, 
+    0x72, 0x2e, 0x70, 0x6d, 0x63, 0x20, 0x6f, 0x73, 
+    0x2e, 0x70, 0x6d, 0x63, 0x20, 0x70, 0x61, 0x63, 
+    0x6b, 0x66, 0x69, 0x6c, 0x65, 0x2e, 0x70, 0x6d, 
+    0x63, 0x20, 0x70, 0x61, 0x63, 0x6b, 0x66, 0x69, 
+    0x6c, 0x65, 0x61, 0x6e, 0x6e, 0x6f, 0x74, 0x61, 
+    0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x70, 0x6d, 0x63, 
+    0x20, 0x70, 0x61, 0x63, 0x6b, 0x66, 0x69, 0x6c, 
+    0x65, 0x61, 0x6e, 0x6e, 0x6f, 0x74, 0x61, 0x74, 
+    0x69, 0x6f, 0x6e, 0x73, 0x2e, 0x70, 0x6d, 0x63, 
+    0x20, 0x70, 0x61, 0x63, 0x6b, 0x66, 0x69, 0x6c, 
+    0x65, 0x62, 0x79, 0x74, 0x65, 0x63, 0x6f, 0x64, 
+    0x65, 0x73, 0x65, 0x67, 0x6d, 0x65, 0x6e, 0x74, 
+    0x2e, 0x70, 0x6d, 0x63, 0x20, 0x70, 0x61, 0x63, 
+    0x6b, 0x66, 0x69, 0x6c, 0x65, 0x63, 0x6f, 0x6e, 
+    0x73, 0x74, 0x61, 0x6e, 0x74, 0x74, 0x61, 0x62, 
+    0x6c, 0x65, 0x2e, 0x70, 0x6d, 0x63, 0x20, 0x70, 
+    0x61, 0x63, 0x6b, 0x66, 0x69, 0x6c, 0x65, 0x64, 
+    0x65, 0x62, 0x75, 0x67, 0x2e, 0x70, 0x6d, 0x63, 
+    0x20, 0x70, 0x61, 0x63, 0x6b, 0x66, 0x69, 0x6c, 
+    0x65, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6f, 
+    0x72, 0x79, 0x2e, 0x70, 0x6d, 0x63, 0x20, 0x70, 
+    0x61, 0x63, 0x6b, 0x66, 0x69, 0x6c, 0x65, 0x6f, 
+    0x70, 0x6d, 0x61, 0x70, 0x2e, 0x70, 0x6d, 0x63, 
+    0x20, 0x70, 0x61, 0x63, 0x6b, 0x66, 0x69, 0x6c, 
+    0x65, 0x72, 0x61, 0x77, 0x73, 0x65, 0x67, 0x6d, 
+    0x65, 0x6e, 0x74, 0x2e, 0x70, 0x6d, 0x63, 0x20, 
+    0x70, 0x61, 0x63, 0x6b, 0x66, 0x69, 0x6c, 0x65, 
+    0x73, 0x65, 0x67, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 
+    0x70, 0x6d, 0x63, 0x20, 0x70, 0x61, 0x63, 0x6b, 
+    0x66, 0x69, 0x6c, 0x65, 0x76, 0x69, 0x65, 0x77, 
+    0x2e, 0x70, 0x6d, 0x63, 0x20, 0x70, 0x6d, 0x63, 
+    0x6c, 0x69, 0x73, 0x74, 0x2e, 0x70, 0x6d, 0x63, 
+    0x20, 0x70, 0x6d, 0x63, 0x70, 0x72, 0x6f, 0x78, 
+    0x79, 0x2e, 0x70, 0x6d, 0x63, 0x20, 0x70, 0x72, 
+    0x6f, 0x78, 0x79, 0x2e, 0x70, 0x6d, 0x63, 0x20, 
+    0x70, 0x74, 0x72, 0x2e, 0x70, 0x6d, 0x63, 0x20, 
+    0x70, 0x74, 0x72, 0x62, 0x75, 0x66, 0x2e, 0x70, 
+    0x6d, 0x63, 0x20, 0x70, 0x74, 0x72, 0x6f, 0x62, 
+    0x6a, 0x2e, 0x70, 0x6d, 0x63, 0x20, 0x72, 0x65, 
+    0x73, 0x69, 0x7a, 0x61, 0x62, 0x6c, 0x65, 0x62, 
+    0x6f, 0x6f, 0x6c, 0x65, 0x61, 0x6e, 0x61, 0x72, 
+    0x72, 0x61, 0x79, 0x2e, 0x70, 0x6d, 0x63, 0x20, 
+    0x72, 0x65, 0x73, 0x69, 0x7a, 0x61, 0x62, 0x6c, 
+    0x65, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x61, 0x72, 
+    0x72, 0x61, 0x79, 0x2e, 0x70, 0x6d, 0x63, 0x20, 
+    0x72, 0x65, 0x73, 0x69, 0x7a, 0x61, 0x62, 0x6c, 
+    0x65, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 
+    0x61, 0x72, 0x72, 0x61, 0x79, 0x2e, 0x70, 0x6d, 
+    0x63, 0x20, 0x72, 0x65, 0x73, 0x69, 0x7a, 0x61, 
+    0x62, 0x6c, 0x65, 0x70, 0x6d, 0x63, 0x61, 0x72, 
+    0x72, 0x61, 0x79, 0x2e, 0x70, 0x6d, 0x63, 0x20, 
+    0x72, 0x65, 0x73, 0x69, 0x7a, 0x61, 0x62, 0x6c, 
+    0x65, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x61, 
+    0x72, 0x72, 0x61, 0x79, 0x2e, 0x70, 0x6d, 0x63, 
+    0x20, 0x72, 0x6f, 0x6c, 0x65, 0x2e, 0x70, 0x6d, 
+    0x63, 0x20, 0x73, 0x63, 0x61, 0x6c, 0x61, 0x72, 
+    0x2e, 0x70, 0x6d, 0x63, 0x20, 0x73, 0x63, 0x68, 
+    0x65, 0x64, 0x75, 0x6c, 0x65, 0x72, 0x2e, 0x70, 
+    0x6d, 0x63, 0x20, 0x73, 0x63, 0x68, 0x65, 0x64, 
+    0x75, 0x6c, 0x65, 0x72, 0x6d, 0x65, 0x73, 0x73, 
+    0x61, 0x67, 0x65, 0x2e, 0x70, 0x6d, 0x63, 0x20, 
+    0x73, 0x6f, 0x63, 0x6b, 0x61, 0x64, 0x64, 0x72, 
+    0x2e, 0x70, 0x6d, 0x63, 0x20, 0x73, 0x6f, 0x63, 
+    0x6b, 0x65, 0x74, 0x2e, 0x70, 0x6d, 0x63, 0x20, 
+    0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x62, 0x75, 
+    0x69, 0x6c, 0x64, 0x65, 0x72, 0x2e, 0x70, 0x6d, 
+    0x63, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 
+    0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x2e, 0x70, 
+    0x6d, 0x63, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 
+    0x67, 0x69, 0x74, 0x65, 0x72, 0x61, 0x74, 0x6f, 
+    0x72, 0x2e, 0x70, 0x6d, 0x63, 0x20, 0x73, 0x74, 
+    0x72, 0x75, 0x63, 0x74, 0x76, 0x69, 0x65, 0x77, 
+    0x2e, 0x70, 0x6d, 0x63, 0x20, 0x74, 0x61, 0x73, 
+    0x6b, 0x2e, 0x70, 0x6d, 0x63, 0x20, 0x75, 0x6e, 
+    0x64, 0x65, 0x66, 0x2e, 0x70, 0x6d, 0x63, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x70, 0x6d, 0x63, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 
+    0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x47, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 
+    0x4e, 0x75, 0x6c, 0x6c, 0x20, 0x45, 0x6e, 0x76, 
+    0x20, 0x4b, 0x65, 0x79, 0x20, 0x55, 0x6e, 0x4d, 
+    0x61, 0x6e, 0x61, 0x67, 0x65, 0x64, 0x53, 0x74, 
+    0x72, 0x75, 0x63, 0x74, 0x20, 0x4d, 0x61, 0x6e, 
+    0x61, 0x67, 0x65, 0x64, 0x53, 0x74, 0x72, 0x75, 
+    0x63, 0x74, 0x20, 0x45, 0x78, 0x63, 0x65, 0x70, 
+    0x74, 0x69, 0x6f, 0x6e, 0x20, 0x50, 0x61, 0x72, 
+    0x72, 0x6f, 0x74, 0x4c, 0x69, 0x62, 0x72, 0x61, 
+    0x72, 0x79, 0x20, 0x50, 0x61, 0x72, 0x72, 0x6f, 
+    0x74, 0x49, 0x6e, 0x74, 0x65, 0x72, 0x70, 0x72, 
+    0x65, 0x74, 0x65, 0x72, 0x20, 0x4c, 0x65, 0x78, 
+    0x50, 0x61, 0x64, 0x20, 0x54, 0x69, 0x6d, 0x65, 
+    0x72, 0x20, 0x50, 0x6f, 0x69, 0x6e, 0x74, 0x65, 
+    0x72, 0x20, 0x53, 0x75, 0x62, 0x20, 0x43, 0x6f, 
+    0x72, 0x6f, 0x75, 0x74, 0x69, 0x6e, 0x65, 0x20, 
+    0x45, 0x76, 0x65, 0x6e, 0x74, 0x48, 0x61, 0x6e, 
+    0x64, 0x6c, 0x65, 0x72, 0x20, 0x43, 0x6f, 0x6e, 
+    0x74, 0x69, 0x6e, 0x75, 0x61, 0x74, 0x69, 0x6f, 
+    0x6e, 0x20, 0x45, 0x78, 0x63, 0x65, 0x70, 0x74, 
+    0x69, 0x6f, 0x6e, 0x48, 0x61, 0x6e, 0x64, 0x6c, 
+    0x65, 0x72, 0x20, 0x4e, 0x43, 0x49, 0x20, 0x42, 
+    0x69, 0x67, 0x49, 0x6e, 0x74, 0x20, 0x42, 0x69, 
+    0x67, 0x4e, 0x75, 0x6d, 0x20, 0x43, 0x6f, 0x6d, 
+    0x70, 0x6c, 0x65, 0x78, 0x20, 0x46, 0x69, 0x78, 
+    0x65, 0x64, 0x49, 0x6e, 0x74, 0x65, 0x67, 0x65, 
+    0x72, 0x41, 0x72, 0x72, 0x61, 0x79, 0x20, 0x52, 
+    0x65, 0x73, 0x69, 0x7a, 0x61, 0x62, 0x6c, 0x65, 
+    0x49, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x41, 
+    0x72, 0x72, 0x61, 0x79, 0x20, 0x49, 0x74, 0x65, 
+    0x72, 0x61, 0x74, 0x6f, 0x72, 0x20, 0x41, 0x72, 
+    0x72, 0x61, 0x79, 0x49, 0x74, 0x65, 0x72, 0x61, 
+    0x74, 0x6f, 0x72, 0x20, 0x48, 0x61, 0x73, 0x68, 
+    0x49, 0x74, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 
+    0x20, 0x4f, 0x72, 0x64, 0x65, 0x72, 0x65, 0x64, 
+    0x48, 0x61, 0x73, 0x68, 0x49, 0x74, 0x65, 0x72, 
+    0x61, 0x74, 0x6f, 0x72, 0x20, 0x53, 0x74, 0x72, 
+    0x69, 0x6e, 0x67, 0x49, 0x74, 0x65, 0x72, 0x61, 
+    0x74, 0x6f, 0x72, 0x20, 0x46, 0x69, 0x78, 0x65, 
+    0x64, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x41, 
+    0x72, 0x72, 0x61, 0x79, 0x20, 0x52, 0x65, 0x73, 
+    0x69, 0x7a, 0x61, 0x62, 0x6c, 0x65, 0x53, 0x74, 
+    0x72, 0x69, 0x6e, 0x67, 0x41, 0x72, 0x72, 0x61, 
+    0x79, 0x20, 0x48, 0x61, 0x73, 0x68, 0x20, 0x4c, 
+    0x65, 0x78, 0x49, 0x6e, 0x66, 0x6f, 0x20, 0x4e, 
+    0x61, 0x6d, 0x65, 0x53, 0x70, 0x61, 0x63, 0x65, 
+    0x20, 0x4f, 0x72, 0x64, 0x65, 0x72, 0x65, 0x64, 
+    0x48, 0x61, 0x73, 0x68, 0x20, 0x4f, 0x70, 0x4c, 
+    0x69, 0x62, 0x20, 0x4f, 0x70, 0x63, 0x6f, 0x64, 
+    0x65, 0x20, 0x43, 0x61, 0x6c, 0x6c, 0x43, 0x6f, 
+    0x6e, 0x74, 0x65, 0x78, 0x74, 0x20, 0x41, 0x64, 
+    0x64, 0x72, 0x52, 0x65, 0x67, 0x69, 0x73, 0x74, 
+    0x72, 0x79, 0x20, 0x41, 0x6c, 0x61, 0x72, 0x6d, 
+    0x20, 0x42, 0x79, 0x74, 0x65, 0x42, 0x75, 0x66, 
+    0x66, 0x65, 0x72, 0x20, 0x43, 0x61, 0x70, 0x74, 
+    0x75, 0x72, 0x65, 0x20, 0x43, 0x68, 0x61, 0x6e, 
+    0x6e, 0x65, 0x6c, 0x20, 0x43, 0x6c, 0x61, 0x73, 
+    0x73, 0x20, 0x50, 0x4d, 0x43, 0x50, 0x72, 0x6f, 
+    0x78, 0x79, 0x20, 0x45, 0x78, 0x70, 0x6f, 0x72, 
+    0x74, 0x65, 0x72, 0x20, 0x46, 0x69, 0x78, 0x65, 
+    0x64, 0x42, 0x6f, 0x6f, 0x6c, 0x65, 0x61, 0x6e, 
+    0x41, 0x72, 0x72, 0x61, 0x79, 0x20, 0x52, 0x65, 
+    0x73, 0x69, 0x7a, 0x61, 0x62, 0x6c, 0x65, 0x42, 
+    0x6f, 0x6f, 0x6c, 0x65, 0x61, 0x6e, 0x41, 0x72, 
+    0x72, 0x61, 0x79, 0x20, 0x46, 0x69, 0x78, 0x65, 
+    0x64, 0x46, 0x6c, 0x6f, 0x61, 0x74, 0x41, 0x72, 
+    0x72, 0x61, 0x79, 0x20, 0x52, 0x65, 0x73, 0x69, 
+    0x7a, 0x61, 0x62, 0x6c, 0x65, 0x46, 0x6c, 0x6f, 
+    0x61, 0x74, 0x41, 0x72, 0x72, 0x61, 0x79, 0x20, 
+    0x46, 0x69, 0x78, 0x65, 0x64, 0x50, 0x4d, 0x43, 
+    0x41, 0x72, 0x72, 0x61, 0x79, 0x20, 0x52, 0x65, 
+    0x73, 0x69, 0x7a, 0x61, 0x62, 0x6c, 0x65, 0x50, 
+    0x4d, 0x43, 0x41, 0x72, 0x72, 0x61, 0x79, 0x20, 
+    0x4d, 0x75, 0x6c, 0x74, 0x69, 0x53, 0x75, 0x62, 
+    0x20, 0x48, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x20, 
+    0x46, 0x69, 0x6c, 0x65, 0x48, 0x61, 0x6e, 0x64, 
+    0x6c, 0x65, 0x20, 0x53, 0x6f, 0x63, 0x6b, 0x65, 
+    0x74, 0x20, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 
+    0x48, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x20, 0x48, 
+    0x61, 0x73, 0x68, 0x49, 0x74, 0x65, 0x72, 0x61, 
+    0x74, 0x6f, 0x72, 0x4b, 0x65, 0x79, 0x20, 0x49, 
+    0x6d, 0x61, 0x67, 0x65, 0x49, 0x4f, 0x46, 0x72, 
+    0x65, 0x65, 0x7a, 0x65, 0x20, 0x49, 0x6d, 0x61, 
+    0x67, 0x65, 0x49, 0x4f, 0x53, 0x69, 0x7a, 0x65, 
+    0x20, 0x49, 0x6d, 0x61, 0x67, 0x65, 0x49, 0x4f, 
+    0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x73, 0x20, 
+    0x49, 0x6d, 0x61, 0x67, 0x65, 0x49, 0x4f, 0x54, 
+    0x68, 0x61, 0x77, 0x20, 0x49, 0x4d, 0x43, 0x43, 
+    0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x72, 0x20, 
+    0x4d, 0x61, 0x70, 0x70, 0x65, 0x64, 0x42, 0x79, 
+    0x74, 0x65, 0x41, 0x72, 0x72, 0x61, 0x79, 0x20, 
+    0x4e, 0x61, 0x74, 0x69, 0x76, 0x65, 0x50, 0x43, 
+    0x43, 0x4d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x20, 
+    0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x20, 0x4f, 
+    0x53, 0x20, 0x50, 0x61, 0x63, 0x6b, 0x66, 0x69, 
+    0x6c, 0x65, 0x20, 0x50, 0x61, 0x63, 0x6b, 0x66, 
+    0x69, 0x6c, 0x65, 0x41, 0x6e, 0x6e, 0x6f, 0x74, 
+    0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x50, 0x61, 
+    0x63, 0x6b, 0x66, 0x69, 0x6c, 0x65, 0x4f, 0x70, 
+    0x4d, 0x61, 0x70, 0x20, 0x50, 0x61, 0x63, 0x6b, 
+    0x66, 0x69, 0x6c, 0x65, 0x53, 0x65, 0x67, 0x6d, 
+    0x65, 0x6e, 0x74, 0x20, 0x50, 0x61, 0x63, 0x6b, 
+    0x66, 0x69, 0x6c, 0x65, 0x41, 0x6e, 0x6e, 0x6f, 
+    0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 
+    0x50, 0x61, 0x63, 0x6b, 0x66, 0x69, 0x6c, 0x65, 
+    0x43, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 
+    0x54, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x50, 0x61, 
+    0x63, 0x6b, 0x66, 0x69, 0x6c, 0x65, 0x44, 0x69, 
+    0x72, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x20, 
+    0x50, 0x61, 0x63, 0x6b, 0x66, 0x69, 0x6c, 0x65, 
+    0x52, 0x61, 0x77, 0x53, 0x65, 0x67, 0x6d, 0x65, 
+    0x6e, 0x74, 0x20, 0x50, 0x61, 0x63, 0x6b, 0x66, 
+    0x69, 0x6c, 0x65, 0x42, 0x79, 0x74, 0x65, 0x63, 
+    0x6f, 0x64, 0x65, 0x53, 0x65, 0x67, 0x6d, 0x65, 
+    0x6e, 0x74, 0x20, 0x50, 0x61, 0x63, 0x6b, 0x66, 
+    0x69, 0x6c, 0x65, 0x44, 0x65, 0x62, 0x75, 0x67, 
+    0x20, 0x50, 0x61, 0x63, 0x6b, 0x66, 0x69, 0x6c, 
+    0x65, 0x56, 0x69, 0x65, 0x77, 0x20, 0x50, 0x4d, 
+    0x43, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x50, 0x72, 
+    0x6f, 0x78, 0x79, 0x20, 0x50, 0x74, 0x72, 0x20, 
+    0x50, 0x74, 0x72, 0x42, 0x75, 0x66, 0x20, 0x50, 
+    0x74, 0x72, 0x4f, 0x62, 0x6a, 0x20, 0x52, 0x6f, 
+    0x6c, 0x65, 0x20, 0x73, 0x63, 0x61, 0x6c, 0x61, 
+    0x72, 0x20, 0x46, 0x6c, 0x6f, 0x61, 0x74, 0x20, 
+    0x49, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x20, 
+    0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x42, 
+    0x6f, 0x6f, 0x6c, 0x65, 0x61, 0x6e, 0x20, 0x53, 
+    0x63, 0x68, 0x65, 0x64, 0x75, 0x6c, 0x65, 0x72, 
+    0x20, 0x53, 0x63, 0x68, 0x65, 0x64, 0x75, 0x6c, 
+    0x65, 0x72, 0x4d, 0x65, 0x73, 0x73, 0x61, 0x67, 
+    0x65, 0x20, 0x53, 0x6f, 0x63, 0x6b, 0x61, 0x64, 
+    0x64, 0x72, 0x20, 0x53, 0x74, 0x72, 0x69, 0x6e, 
+    0x67, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 
+    0x20, 0x53, 0x74, 0x72, 0x75, 0x63, 0x74, 0x56, 
+    0x69, 0x65, 0x77, 0x20, 0x54, 0x61, 0x73, 0x6b, 
+    0x20, 0x43, 0x61, 0x6c, 0x6c, 0x62, 0x61, 0x63, 
+    0x6b, 0x20, 0x55, 0x6e, 0x64, 0x65, 0x66, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x70, 0x6f, 0x64, 0x32, 0x6d, 0x61, 0x6e, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2f, 0x75, 0x73, 0x72, 0x2f, 0x62, 0x69, 0x6e, 
+    0x2f, 0x70, 0x6f, 0x64, 0x32, 0x6d, 0x61, 0x6e, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x50, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2f, 0x72, 0x6f, 0x6f, 0x74, 0x2f, 0x72, 0x65, 
+    0x70, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x70, 0x74, 0x72, 0x63, 0x61, 0x73, 0x74, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 
+    0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x70, 0x74, 0x72, 0x73, 0x69, 0x7a, 0x65, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x72, 0x61, 0x6e, 0x6c, 0x69, 0x62, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x72, 0x65, 0x61, 0x64, 0x6c, 0x69, 0x6e, 0x65, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x72, 0x6d, 0x5f, 0x66, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x24, 0x28, 0x50, 0x45, 0x52, 0x4c, 0x29, 0x20, 
+    0x2d, 0x4d, 0x45, 0x78, 0x74, 0x55, 0x74, 0x69, 
+    0x6c, 0x73, 0x3a, 0x3a, 0x43, 0x6f, 0x6d, 0x6d, 
+    0x61, 0x6e, 0x64, 0x20, 0x2d, 0x65, 0x20, 0x72, 
+    0x6d, 0x5f, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x72, 0x6d, 0x5f, 0x72, 0x66, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x24, 0x28, 0x50, 0x45, 0x52, 0x4c, 0x29, 0x20, 
+    0x2d, 0x4d, 0x45, 0x78, 0x74, 0x55, 0x74, 0x69, 
+    0x6c, 0x73, 0x3a, 0x3a, 0x43, 0x6f, 0x6d, 0x6d, 
+    0x61, 0x6e, 0x64, 0x20, 0x2d, 0x65, 0x20, 0x72, 
+    0x6d, 0x5f, 0x72, 0x66, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x72, 0x70, 0x61, 0x74, 0x68, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2d, 0x57, 0x6c, 0x2c, 0x2d, 0x72, 0x70, 0x61, 
+    0x74, 0x68, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x72, 0x70, 0x61, 0x74, 0x68, 0x5f, 0x62, 0x6c, 
+    0x69, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x22, 0x2d, 0x57, 0x6c, 0x2c, 0x2d, 0x72, 0x70, 
+    0x61, 0x74, 0x68, 0x3d, 0x2f, 0x72, 0x6f, 0x6f, 
+    0x74, 0x2f, 0x72, 0x65, 0x70, 0x6f, 0x2f, 0x62, 
+    0x6c, 0x69, 0x62, 0x2f, 0x6c, 0x69, 0x62, 0x22, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x72, 0x70, 0x61, 0x74, 0x68, 0x5f, 0x6c, 0x69, 
+    0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2d, 0x57, 0x6c, 0x2c, 0x2d, 0x72, 0x70, 0x61, 
+    0x74, 0x68, 0x3d, 0x22, 0x2f, 0x75, 0x73, 0x72, 
+    0x2f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x2f, 0x6c, 
+    0x69, 0x62, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x72, 0x75, 0x6e, 0x63, 0x6f, 0x72, 0x65, 0x5f, 
+    0x74, 0x65, 0x73, 0x74, 0x73, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x74, 0x2f, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 
+    0x65, 0x72, 0x73, 0x2f, 0x69, 0x6d, 0x63, 0x63, 
+    0x2f, 0x2a, 0x2f, 0x2a, 0x2e, 0x74, 0x20, 0x74, 
+    0x2f, 0x6f, 0x70, 0x2f, 0x2a, 0x2e, 0x74, 0x20, 
+    0x74, 0x2f, 0x70, 0x6d, 0x63, 0x2f, 0x2a, 0x2e, 
+    0x74, 0x20, 0x74, 0x2f, 0x6f, 0x6f, 0x2f, 0x2a, 
+    0x2e, 0x74, 0x20, 0x74, 0x2f, 0x70, 0x69, 0x72, 
+    0x2f, 0x2a, 0x2e, 0x74, 0x20, 0x74, 0x2f, 0x6e, 
+    0x61, 0x74, 0x69, 0x76, 0x65, 0x5f, 0x70, 0x62, 
+    0x63, 0x2f, 0x2a, 0x2e, 0x74, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x73, 0x62, 0x69, 0x6e, 0x64, 0x69, 0x72, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2f, 0x75, 0x73, 0x72, 0x2f, 0x6c, 0x6f, 0x63, 
+    0x61, 0x6c, 0x2f, 0x73, 0x62, 0x69, 0x6e, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x73, 0x65, 0x74, 0x65, 0x6e, 0x76, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x73, 0x68, 0x61, 0x72, 0x65, 0x5f, 0x65, 0x78, 
+    0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2e, 0x73, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x73, 0x74, 
+    0x61, 0x74, 0x65, 0x64, 0x69, 0x72, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2f, 0x75, 0x73, 0x72, 0x2f, 0x6c, 0x6f, 0x63, 
+    0x61, 0x6c, 0x2f, 0x63, 0x6f, 0x6d, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x73, 0x68, 0x6f, 0x72, 0x74, 0x73, 0x69, 0x7a, 
+    0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x73, 0x6c, 0x61, 0x73, 0x68, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x73, 0x72, 0x63, 0x64, 0x69, 0x72, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2f, 0x75, 0x73, 0x72, 0x2f, 0x6c, 0x6f, 0x63, 
+    0x61, 0x6c, 0x2f, 0x73, 0x72, 0x63, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x73, 0x79, 0x6d, 0x5f, 0x65, 0x78, 0x70, 0x6f, 
+    0x72, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x5f, 0x5f, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 
+    0x75, 0x74, 0x65, 0x5f, 0x5f, 0x20, 0x28, 0x28, 
+    0x76, 0x69, 0x73, 0x69, 0x62, 0x69, 0x6c, 0x69, 
+    0x74, 0x79, 0x28, 0x22, 0x64, 0x65, 0x66, 0x61, 
+    0x75, 0x6c, 0x74, 0x22, 0x29, 0x29, 0x29, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x73, 0x79, 0x6d, 0x5f, 0x69, 0x6d, 0x70, 0x6f, 
+    0x72, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x73, 0x79, 0x73, 0x63, 0x6f, 0x6e, 0x66, 0x64, 
+    0x69, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2f, 0x75, 0x73, 0x72, 0x2f, 0x6c, 0x6f, 0x63, 
+    0x61, 0x6c, 0x2f, 0x65, 0x74, 0x63, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x74, 0x61, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2f, 0x75, 0x73, 0x72, 0x2f, 0x62, 0x69, 0x6e, 
+    0x2f, 0x74, 0x61, 0x72, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x74, 0x65, 0x6d, 0x70, 0x64, 0x69, 0x72, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2f, 0x74, 0x6d, 0x70, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x74, 0x65, 0x73, 0x74, 0x5f, 0x70, 0x72, 0x6f, 
+    0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x70, 0x61, 0x72, 0x72, 0x6f, 0x74, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x74, 0x6f, 0x75, 0x63, 0x68, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x24, 0x28, 0x50, 0x45, 0x52, 0x4c, 0x29, 0x20, 
+    0x2d, 0x4d, 0x45, 0x78, 0x74, 0x55, 0x74, 0x69, 
+    0x6c, 0x73, 0x3a, 0x3a, 0x43, 0x6f, 0x6d, 0x6d, 
+    0x61, 0x6e, 0x64, 0x20, 0x2d, 0x65, 0x20, 0x74, 
+    0x6f, 0x75, 0x63, 0x68, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x75, 0x69, 0x6e, 0x74, 0x76, 0x61, 0x6c, 0x66, 
+    0x6d, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x25, 0x6c, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x75, 0x6e, 0x73, 0x65, 0x74, 0x65, 0x6e, 0x76, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x76, 0x61, 0x5f, 0x70, 0x74, 0x72, 0x5f, 0x74, 
+    0x79, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x76, 0x65, 0x72, 0x62, 0x6f, 0x73, 0x65, 0x00, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x56, 0x45, 0x52, 0x53, 0x49, 0x4f, 0x4e, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x36, 0x2e, 0x39, 0x2e, 0x30, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x64, 
+    0x69, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2f, 0x70, 0x61, 0x72, 0x72, 0x6f, 0x74, 0x2f, 
+    0x36, 0x2e, 0x39, 0x2e, 0x30, 0x2d, 0x64, 0x65, 
+    0x76, 0x65, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x79, 0x61, 0x63, 0x63, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x65, 0x63, 0x68, 0x6f, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6c, 0x6c, 0x65, 
+    0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    
+}; /* parrot_config */
+
+PARROT_CONST_FUNCTION
+const unsigned char *
+Parrot_get_config_hash_bytes(void)
+{
+    return parrot_config;
+}
+
+PARROT_CONST_FUNCTION
+int
+Parrot_get_config_hash_length(void)
+{
+    return sizeof(parrot_config);
+}
+
+int
+Parrot_set_config_hash(Parrot_PMC interp_pmc)
+{
+    Parrot_PMC config = NULL;
+    if (sizeof(parrot_config) <= 1)
+        return 1;
+    return Parrot_api_pmc_null(interp_pmc, &config) &&
+           Parrot_api_pmc_deserialize_bytes(interp_pmc, parrot_config, sizeof(parrot_config), &config) &&
+           Parrot_api_set_configuration_hash(interp_pmc, config);
+}
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ *   buffer-read-only: t
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
@@ -507,6 +507,29 @@ Parrot_file_stat_intval(PARROT_INTERP, STRING *file, INTVAL thing)
 
 /*
 
+=item C<INTVAL Parrot_file_modify_time(PARROT_INTERP, STRING *file)>
+
+Returns the modify time of file C<file>, or -1 if it cannot be stat'ed. Unlike
+C<Parrot_file_stat_intval> this needs a single call and never throws.
+
+=cut
+
+*/
+
+INTVAL
+Parrot_file_modify_time(PARROT_INTERP, ARGIN(STRING *file))
+{
+    struct stat  statbuf;
+    char * const filename = Parrot_str_to_platform_cstring(interp, file);
+    const int    status = stat(filename, &statbuf);
+
+    Parrot_str_free_cstring(filename);
+
+    return status ? -1 : (INTVAL)statbuf.st_mtime;
+}
+
+/*
+
 =item C<INTVAL Parrot_file_lstat_intval(PARROT_INTERP, STRING *file, INTVAL
 thing)>
 
@@ -549,6 +549,33 @@ Parrot_file_stat_intval(PARROT_INTERP, STRING *file, INTVAL thing)
 
 /*
 
+=item C<INTVAL Parrot_file_modify_time(PARROT_INTERP, STRING *file)>
+
+Returns the modify time of file C<file>, or -1 if it cannot be stat'ed. Unlike
+C<Parrot_file_stat_intval> this needs a single call and never throws.
+
+=cut
+
+*/
+
+INTVAL
+Parrot_file_modify_time(PARROT_INTERP, ARGIN(STRING *file))
+{
+    WIN32_FILE_ATTRIBUTE_DATA attr_data;
+    char * const c_str = Parrot_str_to_encoded_cstring(interp, file,
+                                Parrot_utf16_encoding_ptr);
+    const BOOL   success = GetFileAttributesExW((LPWSTR)c_str,
+                                GetFileExInfoStandard, &attr_data);
+
+    Parrot_str_free_cstring(c_str);
+
+    return success
+         ? file_attribute_intval(interp, &attr_data, STAT_MODIFYTIME)
+         : -1;
+}
+
+/*
+
 =item C<INTVAL Parrot_file_lstat_intval(PARROT_INTERP, STRING *file, INTVAL
 thing)>
 
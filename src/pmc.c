@@ -576,6 +576,8 @@ get_new_pmc_header(PARROT_INTERP, INTVAL base_type, UINTVAL flags)
     if (vtable->attr_size)
         Parrot_gc_allocate_pmc_attributes(interp, newpmc);
 
+    PARROT_GC_SAMPLE_ALLOCATION(interp, newpmc);
+
     return newpmc;
 }
 
@@ -0,0 +1,353 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/alarm.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_alarm.h"
+#include "pmc_default.h"
+#include "alarm.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/alarm.pmc"
+/*
+Copyright (C) 2001-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/alarm.pmc - Alarm PMC
+
+=head1 SYNOPSIS
+
+    .include 'alarm.pasm'
+
+    new P0, 'Alarm'
+    set P0[.PARROT_ALARM_TIME], N_time   # A FLOATVAL
+    set P0[.PARROT_ALARM_SUB],  P_sub    # set handler sub PMC
+    invoke P0                            # schedule the alarm
+
+=head1 DESCRIPTION
+
+Sometime after N_time, P_sub will be called exactly once. Notice that due to
+various factors, the alarm is not guaranteed to execute at N_time, but only
+a short time thereafter. The length of "a short time" is very system dependent.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "parrot/scheduler_private.h"
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+#line 58 "./src/pmc/alarm.c"
+static  PMC  * Parrot_Alarm_clone(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Alarm_freeze(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+static  FLOATVAL  Parrot_Alarm_get_number(SHIM_INTERP, ARGMOD(PMC *_self));
+static  FLOATVAL  Parrot_Alarm_get_number_keyed_int(SHIM_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  PMC  * Parrot_Alarm_get_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  void  Parrot_Alarm_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  opcode_t  * Parrot_Alarm_invoke(PARROT_INTERP, ARGMOD(PMC *_self), void *next);
+static  void  Parrot_Alarm_mark(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Alarm_set_number_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, FLOATVAL value);
+static  void  Parrot_Alarm_set_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, PMC *value);
+static  void  Parrot_Alarm_thaw(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+static  void  Parrot_Alarm_visit(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+void    Parrot_Alarm_class_init(PARROT_INTERP, int, int);
+void    Parrot_Alarm_ro_class_init(PARROT_INTERP, int, int);
+static  PMC  *
+Parrot_Alarm_clone(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 69 "./src/pmc/alarm.pmc"
+
+    PMC * const copy = Parrot_pmc_new(interp, _self->vtable->base_type);
+
+    Parrot_Alarm_attributes * const new_struct = PARROT_ALARM(copy);
+    Parrot_Alarm_attributes * const old_struct = PARROT_ALARM(_self);
+
+    new_struct->alarm_time = old_struct->alarm_time;
+    new_struct->alarm_task = old_struct->alarm_task;
+
+    return copy;
+#line 87 "./src/pmc/alarm.c"
+}
+static  void 
+Parrot_Alarm_freeze(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 206 "./src/pmc/alarm.pmc"
+
+    interp->vtables[enum_class_default]->freeze(interp, _self, info);
+    VTABLE_push_integer(interp, info, VTABLE_elements(interp, _self));
+#line 96 "./src/pmc/alarm.c"
+}
+static  FLOATVAL 
+Parrot_Alarm_get_number(SHIM_INTERP, ARGMOD(PMC *_self))
+{
+#line 133 "./src/pmc/alarm.pmc"
+    return PARROT_ALARM(_self)->alarm_time;
+#line 103 "./src/pmc/alarm.c"
+}
+static  FLOATVAL 
+Parrot_Alarm_get_number_keyed_int(SHIM_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+#line 115 "./src/pmc/alarm.pmc"
+    if (key == PARROT_ALARM_TIME)
+        return PARROT_ALARM(_self)->alarm_time;
+
+    return 0.0;
+#line 113 "./src/pmc/alarm.c"
+}
+static  PMC  *
+Parrot_Alarm_get_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+#line 91 "./src/pmc/alarm.pmc"
+
+    switch (key) {
+        case PARROT_ALARM_TASK:
+            return PARROT_ALARM(_self)->alarm_task;
+        case PARROT_ALARM_TIME: {
+            PMC * const floatval = Parrot_pmc_new(interp, enum_class_Float);
+            VTABLE_set_number_native(interp, floatval, PARROT_ALARM(_self)->alarm_time);
+            return floatval;
+        }
+        default:
+            return PMCNULL;
+    }
+#line 131 "./src/pmc/alarm.c"
+}
+static  void 
+Parrot_Alarm_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 51 "./src/pmc/alarm.pmc"
+
+    Parrot_Alarm_attributes * const data = PARROT_ALARM(_self);
+    data->alarm_time = 0.0;
+    data->alarm_task = PMCNULL;
+
+    PObj_custom_mark_SET(_self);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 144 "./src/pmc/alarm.c"
+}
+static  opcode_t  *
+Parrot_Alarm_invoke(PARROT_INTERP, ARGMOD(PMC *_self), void *next)
+{
+#line 165 "./src/pmc/alarm.pmc"
+
+    Parrot_cx_schedule_alarm(interp, _self);
+    return (opcode_t *)next;
+#line 153 "./src/pmc/alarm.c"
+}
+static  void 
+Parrot_Alarm_mark(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 193 "./src/pmc/alarm.pmc"
+
+    PMC *sub;
+    GETATTR_Alarm_alarm_task(interp, _self, sub);
+    Parrot_gc_mark_PMC_alive(interp, sub);
+#line 163 "./src/pmc/alarm.c"
+}
+static  void 
+Parrot_Alarm_set_number_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, FLOATVAL value)
+{
+#line 180 "./src/pmc/alarm.pmc"
+
+    if (key == PARROT_ALARM_TIME) {
+        SETATTR_Alarm_alarm_time(interp, _self, value);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+    }
+#line 174 "./src/pmc/alarm.c"
+}
+static  void 
+Parrot_Alarm_set_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, PMC *value)
+{
+#line 148 "./src/pmc/alarm.pmc"
+
+    if (key == PARROT_ALARM_TASK) {
+        SETATTR_Alarm_alarm_task(interp, _self, value);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+    }
+#line 185 "./src/pmc/alarm.c"
+}
+static  void 
+Parrot_Alarm_thaw(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 211 "./src/pmc/alarm.pmc"
+
+    interp->vtables[enum_class_default]->thaw(interp, _self, info);
+    VTABLE_set_integer_native(interp, _self, VTABLE_shift_integer(interp, info));
+#line 194 "./src/pmc/alarm.c"
+}
+static  void 
+Parrot_Alarm_visit(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 199 "./src/pmc/alarm.pmc"
+
+    PMC *sub;
+    GETATTR_Alarm_alarm_task(interp, _self, sub);
+    VISIT_PMC(interp, info, sub);
+    interp->vtables[enum_class_default]->visit(interp, _self, info);
+#line 205 "./src/pmc/alarm.c"
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_Alarm_update_vtable(VTABLE *vt) {
+    vt->clone = Parrot_Alarm_clone;
+    vt->freeze = Parrot_Alarm_freeze;
+    vt->get_number = Parrot_Alarm_get_number;
+    vt->get_number_keyed_int = Parrot_Alarm_get_number_keyed_int;
+    vt->get_pmc_keyed_int = Parrot_Alarm_get_pmc_keyed_int;
+    vt->init = Parrot_Alarm_init;
+    vt->invoke = Parrot_Alarm_invoke;
+    vt->mark = Parrot_Alarm_mark;
+    vt->set_number_keyed_int = Parrot_Alarm_set_number_keyed_int;
+    vt->set_pmc_keyed_int = Parrot_Alarm_set_pmc_keyed_int;
+    vt->thaw = Parrot_Alarm_thaw;
+    vt->visit = Parrot_Alarm_visit;
+    vt->attr_size = sizeof(Parrot_Alarm_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_Alarm_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->clone = Parrot_Alarm_clone;
+    vt->freeze = Parrot_Alarm_freeze;
+    vt->get_number = Parrot_Alarm_get_number;
+    vt->get_number_keyed_int = Parrot_Alarm_get_number_keyed_int;
+    vt->get_pmc_keyed_int = Parrot_Alarm_get_pmc_keyed_int;
+    vt->invoke = Parrot_Alarm_invoke;
+    vt->mark = Parrot_Alarm_mark;
+    vt->visit = Parrot_Alarm_visit;
+    vt->attr_size = sizeof(Parrot_Alarm_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Alarm_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_Alarm_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Alarm_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_Alarm_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_Alarm_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "Alarm"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_Alarm_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "Alarm")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_Alarm_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "Falarm_time Falarm_task ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_Alarm_get_vtable(interp);
+        vt->base_type      = enum_class_Alarm;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "Alarm");
+        vt->provides_str = CONST_STRING_GEN(interp, "invokable");
+        vt->isa_hash     = Parrot_Alarm_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_Alarm_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_Alarm;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_Alarm_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+        }
+    } /* pass */
+} /* Parrot_Alarm_class_init */
+
+#line 214 "./src/pmc/alarm.pmc"
+
+
+/*
+
+=back
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
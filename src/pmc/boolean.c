@@ -0,0 +1,351 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/boolean.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_boolean.h"
+#include "pmc_scalar.h"
+#include "pmc_default.h"
+#include "boolean.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/boolean.pmc"
+/*
+Copyright (C) 2001-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/boolean.pmc - Boolean PMC
+
+=head1 DESCRIPTION
+
+This PMC implements a Boolean type with a single true/false value.
+A C<Boolean> does not morph to other types when its value is set; it simply
+changes its value.
+
+This implementation of C<Boolean> inherits from the C<Scalar> PMC.
+Unlike the previous implementation, it does I<not> inherit
+from C<Integer>.
+
+=head2 Functions
+
+=over
+
+=cut
+
+*/
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+
+/* This new Boolean PMC stores its boolean value in a private PObj flag. */
+
+#define boolean_FLAG PObj_private0_FLAG
+
+#define get_boolean_FLAG(pmc) \
+    ((PObj_get_FLAGS(pmc) & boolean_FLAG) != 0)
+
+#define set_boolean_FLAG(pmc, val) \
+     if (val) \
+         PObj_get_FLAGS(pmc) |= boolean_FLAG; \
+     else \
+         PObj_get_FLAGS(pmc) &= ~boolean_FLAG;
+
+#define flip_boolean_FLAG(pmc) \
+     PObj_get_FLAGS(pmc) ^= boolean_FLAG
+#line 68 "./src/pmc/boolean.c"
+static  void  Parrot_Boolean_freeze(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+static  INTVAL  Parrot_Boolean_get_bool(SHIM_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_Boolean_get_integer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  FLOATVAL  Parrot_Boolean_get_number(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING  * Parrot_Boolean_get_string(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Boolean_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Boolean_init_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void  Parrot_Boolean_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  INTVAL  Parrot_Boolean_is_equal(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void  Parrot_Boolean_set_bool(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void  Parrot_Boolean_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void  Parrot_Boolean_set_number_native(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value);
+static  void  Parrot_Boolean_set_string_native(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value);
+static  void  Parrot_Boolean_thaw(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+void    Parrot_Boolean_class_init(PARROT_INTERP, int, int);
+void    Parrot_Boolean_ro_class_init(PARROT_INTERP, int, int);
+static  void 
+Parrot_Boolean_freeze(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 194 "./src/pmc/boolean.pmc"
+
+    interp->vtables[enum_class_default]->freeze(interp, _self, info);
+    VTABLE_push_integer(interp, info, VTABLE_get_bool(interp, _self));
+#line 92 "./src/pmc/boolean.c"
+}
+static  INTVAL 
+Parrot_Boolean_get_bool(SHIM_INTERP, ARGMOD(PMC *_self))
+{
+#line 106 "./src/pmc/boolean.pmc"
+    return get_boolean_FLAG(_self);
+#line 99 "./src/pmc/boolean.c"
+}
+static  INTVAL 
+Parrot_Boolean_get_integer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 111 "./src/pmc/boolean.pmc"
+
+    return VTABLE_get_bool(interp, _self);
+#line 107 "./src/pmc/boolean.c"
+}
+static  FLOATVAL 
+Parrot_Boolean_get_number(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 115 "./src/pmc/boolean.pmc"
+
+    const INTVAL value = VTABLE_get_bool(interp, _self);
+    return (FLOATVAL)value;
+#line 116 "./src/pmc/boolean.c"
+}
+static  STRING  *
+Parrot_Boolean_get_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 120 "./src/pmc/boolean.pmc"
+
+    return Parrot_str_from_int(interp, VTABLE_get_integer(interp, _self));
+#line 124 "./src/pmc/boolean.c"
+}
+static  void 
+Parrot_Boolean_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 71 "./src/pmc/boolean.pmc"
+
+    set_boolean_FLAG(_self, 0);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 133 "./src/pmc/boolean.c"
+}
+static  void 
+Parrot_Boolean_init_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+#line 80 "./src/pmc/boolean.pmc"
+
+    set_boolean_FLAG(_self, value);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 142 "./src/pmc/boolean.c"
+}
+static  void 
+Parrot_Boolean_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 75 "./src/pmc/boolean.pmc"
+
+    const INTVAL v = PMC_IS_NULL(value) ? 0 : VTABLE_get_bool(interp, value);
+    set_boolean_FLAG(_self, v);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 152 "./src/pmc/boolean.c"
+}
+static  INTVAL 
+Parrot_Boolean_is_equal(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 176 "./src/pmc/boolean.pmc"
+
+    return (INTVAL)(get_boolean_FLAG(_self) == VTABLE_get_bool(interp, value));
+#line 160 "./src/pmc/boolean.c"
+}
+static  void 
+Parrot_Boolean_set_bool(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+#line 150 "./src/pmc/boolean.pmc"
+
+    set_boolean_FLAG(_self, value);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 169 "./src/pmc/boolean.c"
+}
+static  void 
+Parrot_Boolean_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+#line 154 "./src/pmc/boolean.pmc"
+
+    VTABLE_set_bool(interp, _self, value);
+#line 177 "./src/pmc/boolean.c"
+}
+static  void 
+Parrot_Boolean_set_number_native(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value)
+{
+#line 158 "./src/pmc/boolean.pmc"
+
+    VTABLE_set_bool(interp, _self, !FLOAT_IS_ZERO(value));
+#line 185 "./src/pmc/boolean.c"
+}
+static  void 
+Parrot_Boolean_set_string_native(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value)
+{
+#line 162 "./src/pmc/boolean.pmc"
+
+    VTABLE_set_bool(interp, _self, Parrot_str_boolean(interp, value));
+#line 193 "./src/pmc/boolean.c"
+}
+static  void 
+Parrot_Boolean_thaw(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 199 "./src/pmc/boolean.pmc"
+
+    interp->vtables[enum_class_default]->thaw(interp, _self, info);
+    VTABLE_set_bool(interp, _self, VTABLE_shift_integer(interp, info));
+#line 202 "./src/pmc/boolean.c"
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_Boolean_update_vtable(VTABLE *vt) {
+    vt->freeze = Parrot_Boolean_freeze;
+    vt->get_bool = Parrot_Boolean_get_bool;
+    vt->get_integer = Parrot_Boolean_get_integer;
+    vt->get_number = Parrot_Boolean_get_number;
+    vt->get_string = Parrot_Boolean_get_string;
+    vt->init = Parrot_Boolean_init;
+    vt->init_int = Parrot_Boolean_init_int;
+    vt->init_pmc = Parrot_Boolean_init_pmc;
+    vt->is_equal = Parrot_Boolean_is_equal;
+    vt->set_bool = Parrot_Boolean_set_bool;
+    vt->set_integer_native = Parrot_Boolean_set_integer_native;
+    vt->set_number_native = Parrot_Boolean_set_number_native;
+    vt->set_string_native = Parrot_Boolean_set_string_native;
+    vt->thaw = Parrot_Boolean_thaw;
+    vt->attr_size = 0;
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_Boolean_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->freeze = Parrot_Boolean_freeze;
+    vt->get_bool = Parrot_Boolean_get_bool;
+    vt->get_integer = Parrot_Boolean_get_integer;
+    vt->get_number = Parrot_Boolean_get_number;
+    vt->get_string = Parrot_Boolean_get_string;
+    vt->is_equal = Parrot_Boolean_is_equal;
+    vt->attr_size = 0;
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Boolean_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_scalar_get_vtable(interp);
+    Parrot_Boolean_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Boolean_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_scalar_ro_get_vtable(interp);
+    Parrot_Boolean_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_Boolean_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+    mro = Parrot_scalar_get_mro(interp, mro);
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "Boolean"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_Boolean_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    isa = Parrot_scalar_get_isa(interp, isa);
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "Boolean")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_Boolean_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_Boolean_get_vtable(interp);
+        vt->base_type      = enum_class_Boolean;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "Boolean");
+        vt->provides_str = CONST_STRING_GEN(interp, "scalar boolean");
+        vt->isa_hash     = Parrot_Boolean_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_Boolean_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_Boolean;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_Boolean_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+        }
+    } /* pass */
+} /* Parrot_Boolean_class_init */
+
+#line 203 "./src/pmc/boolean.pmc"
+
+
+/*
+
+=back
+
+See also the C<Scalar> PMC.
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -0,0 +1,766 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/bytebuffer.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_fixedintegerarray.h"
+#include "pmc_bytebuffer.h"
+#include "pmc_default.h"
+#include "bytebuffer.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/bytebuffer.pmc"
+/*
+Copyright (C) 2010-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/bytebuffer.pmc - ByteBuffer PMC
+
+=head1 DESCRIPTION
+
+C<ByteBuffer> provides a resizable byte buffer with random access to
+individual bytes and conversions from and to parrot strings.
+
+=cut
+
+*/
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static STRING * build_string(PARROT_INTERP,
+    ARGIN_NULLOK(const unsigned char *content),
+    INTVAL size,
+    ARGIN(const STR_VTABLE *encoding))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(4);
+
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static STRING * build_string_from_string(PARROT_INTERP,
+    ARGIN_NULLOK(STRING *from),
+    INTVAL pos,
+    INTVAL size,
+    ARGIN(const STR_VTABLE *encoding))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(5);
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL grow_to(INTVAL position);
+
+#define ASSERT_ARGS_build_string __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(encoding))
+#define ASSERT_ARGS_build_string_from_string __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(encoding))
+#define ASSERT_ARGS_grow_to __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+#line 75 "./src/pmc/bytebuffer.c"
+static  void  Parrot_ByteBuffer_destroy(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_ByteBuffer_elements(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_ByteBuffer_get_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL position);
+static  PMC  * Parrot_ByteBuffer_get_iter(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  * Parrot_ByteBuffer_get_pointer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_ByteBuffer_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_ByteBuffer_init_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL initial_size);
+static  void  Parrot_ByteBuffer_mark(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_ByteBuffer_push_integer(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void  Parrot_ByteBuffer_set_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL position, INTVAL value);
+static  void  Parrot_ByteBuffer_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL set_size);
+static  void  Parrot_ByteBuffer_set_string_native(PARROT_INTERP, ARGMOD(PMC *_self), STRING *new_string);
+static  void Parrot_ByteBuffer_nci_get_string(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_ByteBuffer_nci_get_string_as(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_ByteBuffer_nci_get_chars(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_ByteBuffer_class_init(PARROT_INTERP, int, int);
+void    Parrot_ByteBuffer_ro_class_init(PARROT_INTERP, int, int);
+static  void 
+Parrot_ByteBuffer_destroy(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 108 "./src/pmc/bytebuffer.pmc"
+
+    INTVAL allocated_size;
+    GETATTR_ByteBuffer_allocated_size(interp, _self, allocated_size);
+    if (allocated_size) {
+        unsigned char *content;
+        GETATTR_ByteBuffer_content(interp, _self, content);
+        Parrot_gc_free_memory_chunk(interp, content);
+    }
+#line 105 "./src/pmc/bytebuffer.c"
+}
+static  INTVAL 
+Parrot_ByteBuffer_elements(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 128 "./src/pmc/bytebuffer.pmc"
+
+    INTVAL size;
+    GETATTR_ByteBuffer_size(interp, _self, size);
+    return size;
+#line 115 "./src/pmc/bytebuffer.c"
+}
+static  INTVAL 
+Parrot_ByteBuffer_get_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL position)
+{
+#line 237 "./src/pmc/bytebuffer.pmc"
+
+    INTVAL size;
+    GETATTR_ByteBuffer_size(interp, _self, size);
+    if (position < 0 || position >= size)
+        return 0;
+    else {
+        unsigned char *content;
+        GETATTR_ByteBuffer_content(interp, _self, content);
+        if (content == NULL) {
+            STRING *source;
+            GETATTR_ByteBuffer_source(interp, _self, source);
+            if (STRING_IS_NULL(source))
+                return 0;
+            content = (unsigned char*)source->strstart;
+        }
+        return content[position];
+    }
+#line 138 "./src/pmc/bytebuffer.c"
+}
+static  PMC  *
+Parrot_ByteBuffer_get_iter(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 359 "./src/pmc/bytebuffer.pmc"
+
+    return Parrot_pmc_new_init(interp, enum_class_ArrayIterator, _self);
+#line 146 "./src/pmc/bytebuffer.c"
+}
+static  void  *
+Parrot_ByteBuffer_get_pointer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 337 "./src/pmc/bytebuffer.pmc"
+
+    unsigned char *content;
+    GETATTR_ByteBuffer_content(interp, _self, content);
+    if (content == NULL) {
+        STRING *source;
+        GETATTR_ByteBuffer_source(interp, _self, source);
+        if (! STRING_IS_NULL(source))
+            content = (unsigned char*)source->strstart;
+    }
+    return (void *)content;
+#line 162 "./src/pmc/bytebuffer.c"
+}
+static  void 
+Parrot_ByteBuffer_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 85 "./src/pmc/bytebuffer.pmc"
+
+    PObj_custom_mark_destroy_SETALL(_self);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 171 "./src/pmc/bytebuffer.c"
+}
+static  void 
+Parrot_ByteBuffer_init_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL initial_size)
+{
+#line 89 "./src/pmc/bytebuffer.pmc"
+
+    unsigned char *content;
+    if (initial_size < 0)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_OUT_OF_BOUNDS,
+            _("ByteBuffer: Cannot set buffer size to a negative number (%d)"), initial_size);
+    Parrot_ByteBuffer_init(interp, _self);
+    SETATTR_ByteBuffer_size(interp, _self, initial_size);
+    SETATTR_ByteBuffer_allocated_size(interp, _self, initial_size);
+    content = (unsigned char *)Parrot_gc_allocate_memory_chunk(interp, initial_size);
+    SETATTR_ByteBuffer_content(interp, _self, content);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 188 "./src/pmc/bytebuffer.c"
+}
+static  void 
+Parrot_ByteBuffer_mark(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 101 "./src/pmc/bytebuffer.pmc"
+
+    STRING * source;
+    GETATTR_ByteBuffer_source(interp, _self, source);
+    if (!STRING_IS_NULL(source))
+        Parrot_gc_mark_STRING_alive(interp, source);
+#line 199 "./src/pmc/bytebuffer.c"
+}
+static  void 
+Parrot_ByteBuffer_push_integer(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+#line 320 "./src/pmc/bytebuffer.pmc"
+
+    INTVAL size;
+
+    GETATTR_ByteBuffer_size(interp, _self, size);
+    VTABLE_set_integer_keyed_int(interp, _self, size, value);
+#line 210 "./src/pmc/bytebuffer.c"
+}
+static  void 
+Parrot_ByteBuffer_set_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL position, INTVAL value)
+{
+#line 267 "./src/pmc/bytebuffer.pmc"
+
+    unsigned char *content;
+    INTVAL size, allocated_size;
+    if (position < 0)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "Negative position not allowed");
+
+    GETATTR_ByteBuffer_allocated_size(interp, _self, allocated_size);
+    if (position >= allocated_size) {
+        const INTVAL newsize = grow_to(position);
+        if (allocated_size == 0) {
+            INTVAL copysize = newsize;
+            STRING * source;
+            content = (unsigned char *)Parrot_gc_allocate_memory_chunk(interp, newsize);
+            GETATTR_ByteBuffer_source(interp, _self, source);
+            if (!STRING_IS_NULL(source)) {
+                const INTVAL srclen = Parrot_str_byte_length(interp, source);
+                if (srclen < copysize)
+                    copysize = srclen;
+                memcpy(content, source->strstart, copysize);
+                SETATTR_ByteBuffer_source(interp, _self, STRINGNULL);
+            }
+        }
+        else {
+            GETATTR_ByteBuffer_content(interp, _self, content);
+            content = (unsigned char *)
+                Parrot_gc_reallocate_memory_chunk(interp, content, newsize);
+        }
+
+        SETATTR_ByteBuffer_content(interp, _self, content);
+        SETATTR_ByteBuffer_allocated_size(interp, _self, newsize);
+    }
+    else
+        GETATTR_ByteBuffer_content(interp, _self, content);
+
+    GETATTR_ByteBuffer_size(interp, _self, size);
+    if (position >= size) {
+        size = position + 1;
+        SETATTR_ByteBuffer_size(interp, _self, size);
+    }
+    content[position] = value;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 258 "./src/pmc/bytebuffer.c"
+}
+static  void 
+Parrot_ByteBuffer_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL set_size)
+{
+#line 144 "./src/pmc/bytebuffer.pmc"
+
+    INTVAL size,  allocated_size;
+    unsigned char *content;
+    if (set_size < 0)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_OUT_OF_BOUNDS,
+            "Negative size in ByteBuffer");
+
+    GETATTR_ByteBuffer_allocated_size(interp, _self, allocated_size);
+    if (set_size == 0) {
+        if (allocated_size == 0)
+            SETATTR_ByteBuffer_source(interp, _self, STRINGNULL);
+        else {
+            GETATTR_ByteBuffer_content(interp, _self, content);
+            Parrot_gc_free_memory_chunk(interp, content);
+        }
+        SETATTR_ByteBuffer_allocated_size(interp, _self, 0);
+        SETATTR_ByteBuffer_size(interp, _self, 0);
+        SETATTR_ByteBuffer_content(interp, _self, NULL);
+    }
+    else {
+        GETATTR_ByteBuffer_size(interp, _self, size);
+        /* If reducing size, just change the size value */
+        if (set_size > size) {
+            const INTVAL copysize = set_size < size ? set_size : size;
+            if (allocated_size == 0) {
+                content = (unsigned char *)Parrot_gc_allocate_memory_chunk(interp, set_size);
+                if (size > 0) {
+                    STRING * source;
+                    GETATTR_ByteBuffer_source(interp, _self, source);
+                    memcpy(content, source->strstart, copysize);
+                }
+                SETATTR_ByteBuffer_source(interp, _self, STRINGNULL);
+            }
+            else {
+                GETATTR_ByteBuffer_content(interp, _self, content);
+                content = (unsigned char *)
+                    Parrot_gc_reallocate_memory_chunk(interp, content, set_size);
+            }
+            if (copysize < set_size)
+                memset(content + copysize, '\0', set_size - copysize);
+            SETATTR_ByteBuffer_allocated_size(interp, _self, set_size);
+            SETATTR_ByteBuffer_content(interp, _self, content);
+        }
+        SETATTR_ByteBuffer_size(interp, _self, set_size);
+    }
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 310 "./src/pmc/bytebuffer.c"
+}
+static  void 
+Parrot_ByteBuffer_set_string_native(PARROT_INTERP, ARGMOD(PMC *_self), STRING *new_string)
+{
+#line 201 "./src/pmc/bytebuffer.pmc"
+
+    INTVAL allocated_size;
+    INTVAL new_length;
+    GETATTR_ByteBuffer_allocated_size(interp, _self, allocated_size);
+    new_length = Parrot_str_byte_length(interp, new_string);
+    if (allocated_size) {
+        unsigned char *content;
+        GETATTR_ByteBuffer_content(interp, _self, content);
+        if (allocated_size < new_length) {
+            content = (unsigned char *)Parrot_gc_reallocate_memory_chunk(interp,
+                content, new_length);
+        }
+        memcpy(content, new_string->strstart, new_length);
+        SETATTR_ByteBuffer_content(interp, _self, content);
+    }
+    else {
+        unsigned char * const content = (unsigned char *)
+                        Parrot_gc_allocate_memory_chunk(interp, new_length);
+        memcpy(content, new_string->strstart, new_length);
+        SETATTR_ByteBuffer_content(interp, _self, content);
+    }
+    SETATTR_ByteBuffer_source(interp, _self, new_string);
+    SETATTR_ByteBuffer_size(interp, _self, new_length);
+    SETATTR_ByteBuffer_allocated_size(interp, _self, new_length);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 341 "./src/pmc/bytebuffer.c"
+}
+static  void
+Parrot_ByteBuffer_nci_get_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* encodingname;
+    
+    const INTVAL arity = 2; /* "PiS" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    encodingname = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 379 "./src/pmc/bytebuffer.pmc"
+
+    STRING *result;
+    unsigned char *content;
+    INTVAL size;
+    const STR_VTABLE *encoding = Parrot_find_encoding_by_string(interp, encodingname);
+    GETATTR_ByteBuffer_content(interp, _self, content);
+    GETATTR_ByteBuffer_size(interp, _self, size);
+    if (content == NULL) {
+        STRING *source;
+        GETATTR_ByteBuffer_source(interp, _self, source);
+        result = build_string_from_string(interp, source, 0, size, encoding);
+    }
+    else
+        result = build_string(interp, content, size, encoding);
+    #line 378 "./src/pmc/bytebuffer.c"
+     {
+        VTABLE_set_string_keyed_int(interp, _call_object, 0, (STRING*)result);
+        
+        return;
+     }
+#line 393 "./src/pmc/bytebuffer.pmc"
+
+#line 386 "./src/pmc/bytebuffer.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_ByteBuffer_nci_get_string_as(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* as;
+    
+    const INTVAL arity = 1; /* "PiSo" */
+    const INTVAL arity_opt  = 1;
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count < arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too few arguments: %d passed, %d expected",
+                                    param_count, arity);
+    if (param_count > arity + arity_opt)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too many arguments: %d passed, %d expected",
+                                    param_count, arity + arity_opt);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    if (param_count > 1) {
+        as = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+    }
+    else {
+        as = STRINGNULL;
+    }
+
+    { /* BEGIN PMETHOD BODY */
+#line 407 "./src/pmc/bytebuffer.pmc"
+
+    STRING *result;
+    unsigned char *content;
+    INTVAL size;
+    const STR_VTABLE * const encoding =
+        STRING_IS_NULL(as) ? Parrot_default_encoding_ptr : as->encoding;
+    GETATTR_ByteBuffer_content(interp, _self, content);
+    GETATTR_ByteBuffer_size(interp, _self, size);
+    if (content == NULL) {
+        STRING *source;
+        GETATTR_ByteBuffer_source(interp, _self, source);
+        result = build_string_from_string(interp, source, 0, size, encoding);
+    }
+    else
+        result = build_string(interp, content, size, encoding);
+    #line 442 "./src/pmc/bytebuffer.c"
+     {
+        VTABLE_set_string_keyed_int(interp, _call_object, 0, (STRING*)result);
+        
+        return;
+     }
+#line 422 "./src/pmc/bytebuffer.pmc"
+
+#line 450 "./src/pmc/bytebuffer.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_ByteBuffer_nci_get_chars(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    INTVAL pos;
+    INTVAL length;
+    STRING* encodingname;
+    
+    const INTVAL arity = 4; /* "PiIIS" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    pos = VTABLE_get_integer_keyed_int(interp, _call_object, 1);
+    length = VTABLE_get_integer_keyed_int(interp, _call_object, 2);
+    encodingname = VTABLE_get_string_keyed_int(interp, _call_object, 3);
+
+    { /* BEGIN PMETHOD BODY */
+#line 437 "./src/pmc/bytebuffer.pmc"
+
+    const STR_VTABLE * const encoding = Parrot_find_encoding_by_string(interp, encodingname);
+    STRING           *result;
+    unsigned char    *content;
+    INTVAL            size;
+
+    GETATTR_ByteBuffer_content(interp, _self, content);
+    GETATTR_ByteBuffer_size(interp, _self, size);
+
+    if (pos < 0 || pos > size)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                EXCEPTION_OUT_OF_BOUNDS,
+                "get_chars: index out of bounds");
+
+    if (content == NULL) {
+        STRING *source;
+        GETATTR_ByteBuffer_source(interp, _self, source);
+        if (! STRING_IS_NULL(source))
+            content = (unsigned char*)source->strstart;
+    }
+    result = Parrot_str_extract_chars(interp, (char *)content + pos,
+                size - pos, length, encoding);
+    #line 506 "./src/pmc/bytebuffer.c"
+     {
+        VTABLE_set_string_keyed_int(interp, _call_object, 0, (STRING*)result);
+        
+        return;
+     }
+#line 459 "./src/pmc/bytebuffer.pmc"
+
+#line 514 "./src/pmc/bytebuffer.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_ByteBuffer_update_vtable(VTABLE *vt) {
+    vt->destroy = Parrot_ByteBuffer_destroy;
+    vt->elements = Parrot_ByteBuffer_elements;
+    vt->get_integer_keyed_int = Parrot_ByteBuffer_get_integer_keyed_int;
+    vt->get_iter = Parrot_ByteBuffer_get_iter;
+    vt->get_pointer = Parrot_ByteBuffer_get_pointer;
+    vt->init = Parrot_ByteBuffer_init;
+    vt->init_int = Parrot_ByteBuffer_init_int;
+    vt->mark = Parrot_ByteBuffer_mark;
+    vt->push_integer = Parrot_ByteBuffer_push_integer;
+    vt->set_integer_keyed_int = Parrot_ByteBuffer_set_integer_keyed_int;
+    vt->set_integer_native = Parrot_ByteBuffer_set_integer_native;
+    vt->set_string_native = Parrot_ByteBuffer_set_string_native;
+    vt->attr_size = sizeof(Parrot_ByteBuffer_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_ByteBuffer_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->destroy = Parrot_ByteBuffer_destroy;
+    vt->elements = Parrot_ByteBuffer_elements;
+    vt->get_integer_keyed_int = Parrot_ByteBuffer_get_integer_keyed_int;
+    vt->get_iter = Parrot_ByteBuffer_get_iter;
+    vt->get_pointer = Parrot_ByteBuffer_get_pointer;
+    vt->mark = Parrot_ByteBuffer_mark;
+    vt->attr_size = sizeof(Parrot_ByteBuffer_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_ByteBuffer_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_ByteBuffer_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_ByteBuffer_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_ByteBuffer_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_ByteBuffer_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "ByteBuffer"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_ByteBuffer_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "ByteBuffer")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_ByteBuffer_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "Iallocated_size Isize Ssource :content ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_ByteBuffer_get_vtable(interp);
+        vt->base_type      = enum_class_ByteBuffer;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "ByteBuffer");
+        vt->provides_str = CONST_STRING_GEN(interp, "scalar");
+        vt->isa_hash     = Parrot_ByteBuffer_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_ByteBuffer_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_ByteBuffer;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_ByteBuffer_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "get_string");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_ByteBuffer_nci_get_string),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "get_string_as");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_ByteBuffer_nci_get_string_as),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "get_chars");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_ByteBuffer_nci_get_chars),
+                method_name, signature);
+        }
+        {
+        }
+    } /* pass */
+} /* Parrot_ByteBuffer_class_init */
+
+#line 461 "./src/pmc/bytebuffer.pmc"
+ /* pmclass end */
+
+/*
+
+=back
+
+=head2 Auxiliar functions
+
+=over 4
+
+=item C<static INTVAL grow_to(INTVAL position)>
+
+Calculate new size enough for using position and with some margin to
+decrease the number of reallocations.
+
+=item C<static STRING * build_string(PARROT_INTERP, const unsigned char
+*content, INTVAL size, const STR_VTABLE *encoding)>
+
+Build a string from the buffer content with the encoding specified.
+
+=item C<static STRING * build_string_from_string(PARROT_INTERP, STRING *from,
+INTVAL pos, INTVAL size, const STR_VTABLE *encoding)>
+
+Build a string from part of a string content with the encoding specified.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL
+grow_to(INTVAL position)
+{
+    ASSERT_ARGS(grow_to)
+
+    const UINTVAL blocksize = 2048;
+    const UINTVAL minsize = position + 1;
+    return (INTVAL) (minsize < 64 ? 64 :
+           minsize < 256 ? 256 :
+           minsize < 1024 ? 1024 :
+           ((minsize + blocksize - 1) / blocksize) * blocksize);
+}
+
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static STRING *
+build_string(PARROT_INTERP, ARGIN_NULLOK(const unsigned char *content),
+        INTVAL size, ARGIN(const STR_VTABLE *encoding))
+{
+    ASSERT_ARGS(build_string)
+    if (encoding == NULL)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_ENCODING,
+                "Invalid encoding");
+    else {
+        STRING * const result = Parrot_str_new_init(interp,
+                (const char *)content, size, encoding, 0);
+        return result;
+    }
+}
+
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static STRING *
+build_string_from_string(PARROT_INTERP, ARGIN_NULLOK(STRING *from),
+        INTVAL pos, INTVAL size, ARGIN(const STR_VTABLE *encoding))
+{
+    ASSERT_ARGS(build_string_from_string)
+    STRING *result;
+    if (STRING_IS_NULL(from))
+        result = Parrot_str_new_init(interp, NULL, 0, encoding, 0);
+    else {
+        result = Parrot_str_new_noinit(interp, size);
+        memcpy(result->strstart, from->strstart + pos, size);
+        result->bufused = size;
+        result->encoding = encoding;
+        encoding->scan(interp, result);
+    }
+    return result;
+}
+
+/*
+
+=back
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -0,0 +1,194 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/callback.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_callback.h"
+#include "pmc_task.h"
+#include "pmc_default.h"
+#include "callback.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/callback.pmc"
+/*
+Copyright (C) 2010-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/callback.pmc - Callback PMC
+
+=head1 DESCRIPTION
+
+Callback PMCs are generated by the NCI interface when asynchronous callbacks
+occur and are scheduled as tasks by the task scheduler.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "parrot/scheduler_private.h"
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+#line 49 "./src/pmc/callback.c"
+static  opcode_t  * Parrot_Callback_invoke(PARROT_INTERP, ARGMOD(PMC *_self), void *next);
+void    Parrot_Callback_class_init(PARROT_INTERP, int, int);
+void    Parrot_Callback_ro_class_init(PARROT_INTERP, int, int);
+static  opcode_t  *
+Parrot_Callback_invoke(PARROT_INTERP, ARGMOD(PMC *_self), void *next)
+{
+#line 41 "./src/pmc/callback.pmc"
+
+    Parrot_Callback_attributes *cb_data = PARROT_CALLBACK(_self);
+    PMC *user_data = cb_data->user_data;
+    PMC *ext_data  = cb_data->external_data;
+
+    Parrot_run_callback(interp, user_data, ext_data);
+
+    return (opcode_t*) next;
+#line 65 "./src/pmc/callback.c"
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_Callback_update_vtable(VTABLE *vt) {
+    vt->invoke = Parrot_Callback_invoke;
+    vt->attr_size = sizeof(Parrot_Callback_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_Callback_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->invoke = Parrot_Callback_invoke;
+    vt->attr_size = sizeof(Parrot_Callback_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Callback_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_Task_get_vtable(interp);
+    Parrot_Callback_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Callback_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_Task_ro_get_vtable(interp);
+    Parrot_Callback_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_Callback_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+    mro = Parrot_Task_get_mro(interp, mro);
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "Callback"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_Callback_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    isa = Parrot_Task_get_isa(interp, isa);
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "Callback")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_Callback_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        ":id Fbirthtime :interp Fcode Fdata Ikilled Fmailbox :mailbox_lock Fwaiters :waiters_lock Fshared Fpartner Fuser_data Fexternal_data ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_Callback_get_vtable(interp);
+        vt->base_type      = enum_class_Callback;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "Callback");
+        vt->provides_str = CONST_STRING_GEN(interp, "invokable");
+        vt->isa_hash     = Parrot_Callback_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_Callback_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_Callback;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_Callback_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+        }
+    } /* pass */
+} /* Parrot_Callback_class_init */
+
+#line 49 "./src/pmc/callback.pmc"
+
+
+/*
+
+=back
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
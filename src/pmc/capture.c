@@ -0,0 +1,1226 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/capture.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_fixedintegerarray.h"
+#include "pmc_capture.h"
+#include "pmc_default.h"
+#include "capture.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/capture.pmc"
+/*
+Copyright (C) 2001-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/capture.pmc - Capture PMC
+
+=head1 DESCRIPTION
+
+These are the vtable functions for the Capture PMC.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+
+#define CAPTURE_array_CREATE(i, obj, arr) \
+    do { \
+        GETATTR_Capture_array((i), (obj), (arr)); \
+        if (!(arr)) { \
+            PObj_custom_mark_SET(obj); \
+            (arr) = Parrot_pmc_new((i), enum_class_ResizablePMCArray); \
+            SETATTR_Capture_array((i), (obj), (arr)); \
+            PARROT_GC_WRITE_BARRIER((i), (obj));  \
+        } \
+    } while (0)
+#define CAPTURE_hash_CREATE(i, obj, hsh) \
+    do { \
+        GETATTR_Capture_hash((i), (obj), (hsh)); \
+        if (!(hsh)) { \
+            PObj_custom_mark_SET(obj); \
+            (hsh) = Parrot_pmc_new((i), enum_class_Hash); \
+            SETATTR_Capture_hash((i), (obj), (hsh)); \
+            PARROT_GC_WRITE_BARRIER((i), (obj)); \
+        } \
+    } while (0)
+#line 67 "./src/pmc/capture.c"
+static  PMC  * Parrot_Capture_clone(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_Capture_defined_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  INTVAL  Parrot_Capture_defined_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  INTVAL  Parrot_Capture_defined_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key);
+static  void  Parrot_Capture_delete_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  void  Parrot_Capture_delete_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  void  Parrot_Capture_delete_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key);
+static  INTVAL  Parrot_Capture_elements(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_Capture_exists_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  INTVAL  Parrot_Capture_exists_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  INTVAL  Parrot_Capture_exists_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key);
+static  void  Parrot_Capture_freeze(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+static  INTVAL  Parrot_Capture_get_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  INTVAL  Parrot_Capture_get_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  INTVAL  Parrot_Capture_get_integer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key);
+static  FLOATVAL  Parrot_Capture_get_number_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  FLOATVAL  Parrot_Capture_get_number_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  FLOATVAL  Parrot_Capture_get_number_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key);
+static  PMC  * Parrot_Capture_get_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  PMC  * Parrot_Capture_get_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  PMC  * Parrot_Capture_get_pmc_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key);
+static  STRING  * Parrot_Capture_get_string(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING  * Parrot_Capture_get_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  STRING  * Parrot_Capture_get_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  STRING  * Parrot_Capture_get_string_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key);
+static  void  Parrot_Capture_mark(PARROT_INTERP, ARGMOD(PMC *_self));
+static  FLOATVAL  Parrot_Capture_pop_float(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_Capture_pop_integer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC  * Parrot_Capture_pop_pmc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING  * Parrot_Capture_pop_string(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Capture_push_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value);
+static  void  Parrot_Capture_push_integer(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void  Parrot_Capture_push_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void  Parrot_Capture_push_string(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value);
+static  void  Parrot_Capture_set_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, INTVAL value);
+static  void  Parrot_Capture_set_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, INTVAL value);
+static  void  Parrot_Capture_set_integer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key, INTVAL value);
+static  void  Parrot_Capture_set_number_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, FLOATVAL value);
+static  void  Parrot_Capture_set_number_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, FLOATVAL value);
+static  void  Parrot_Capture_set_number_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key, FLOATVAL value);
+static  void  Parrot_Capture_set_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *capture);
+static  void  Parrot_Capture_set_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, PMC *value);
+static  void  Parrot_Capture_set_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, PMC *value);
+static  void  Parrot_Capture_set_pmc_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key, PMC *value);
+static  void  Parrot_Capture_set_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, STRING *value);
+static  void  Parrot_Capture_set_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, STRING *value);
+static  void  Parrot_Capture_set_string_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key, STRING *value);
+static  FLOATVAL  Parrot_Capture_shift_float(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_Capture_shift_integer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC  * Parrot_Capture_shift_pmc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING  * Parrot_Capture_shift_string(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Capture_thaw(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+static  void  Parrot_Capture_unshift_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value);
+static  void  Parrot_Capture_unshift_integer(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void  Parrot_Capture_unshift_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void  Parrot_Capture_unshift_string(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value);
+static  void Parrot_Capture_nci_list(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Capture_nci_hash(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_Capture_class_init(PARROT_INTERP, int, int);
+void    Parrot_Capture_ro_class_init(PARROT_INTERP, int, int);
+static  PMC  *
+Parrot_Capture_clone(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 59 "./src/pmc/capture.pmc"
+
+    PMC *array, *hash;
+    PMC * const dest = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+    GETATTR_Capture_array(interp, _self, array);
+    GETATTR_Capture_hash(interp, _self, hash);
+    if (!PMC_IS_NULL(array)) {
+        PObj_custom_mark_SET(dest);
+        array = VTABLE_clone(interp, array);
+        SETATTR_Capture_array(interp, dest, array);
+    }
+    if (!PMC_IS_NULL(hash)) {
+        PObj_custom_mark_SET(dest);
+        hash = VTABLE_clone(interp, hash);
+        SETATTR_Capture_hash(interp, dest, hash);
+    }
+
+    /* clone of parts can trigger GC. Explicitely WB dest */
+    PARROT_GC_WRITE_BARRIER(interp, dest);
+
+    return dest;
+#line 152 "./src/pmc/capture.c"
+}
+static  INTVAL 
+Parrot_Capture_defined_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 650 "./src/pmc/capture.pmc"
+
+    PMC *hash;
+
+    GETATTR_Capture_hash(interp, _self, hash);
+
+    if (!hash)
+        return 0;
+
+    return VTABLE_defined_keyed(interp, hash, key);
+#line 167 "./src/pmc/capture.c"
+}
+static  INTVAL 
+Parrot_Capture_defined_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+#line 392 "./src/pmc/capture.pmc"
+
+    PMC *array;
+
+    GETATTR_Capture_array(interp, _self, array);
+
+    if (!array)
+        return 0;
+
+    return VTABLE_defined_keyed_int(interp, array, key);
+#line 182 "./src/pmc/capture.c"
+}
+static  INTVAL 
+Parrot_Capture_defined_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key)
+{
+#line 701 "./src/pmc/capture.pmc"
+
+    PMC *hash;
+
+    GETATTR_Capture_hash(interp, _self, hash);
+
+    if (!hash)
+        return 0;
+    return VTABLE_defined_keyed_str(interp, hash, key);
+#line 196 "./src/pmc/capture.c"
+}
+static  void 
+Parrot_Capture_delete_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 672 "./src/pmc/capture.pmc"
+
+    PMC *hash;
+
+    GETATTR_Capture_hash(interp, _self, hash);
+
+    if (hash) {
+        VTABLE_delete_keyed(interp, hash, key);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+    }
+#line 211 "./src/pmc/capture.c"
+}
+static  void 
+Parrot_Capture_delete_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+#line 414 "./src/pmc/capture.pmc"
+
+    PMC *array;
+
+    GETATTR_Capture_array(interp, _self, array);
+
+    if (array) {
+        VTABLE_delete_keyed_int(interp, array, key);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+    }
+#line 226 "./src/pmc/capture.c"
+}
+static  void 
+Parrot_Capture_delete_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key)
+{
+#line 721 "./src/pmc/capture.pmc"
+
+    PMC *hash;
+
+    GETATTR_Capture_hash(interp, _self, hash);
+
+    if (hash) {
+        VTABLE_delete_keyed_str(interp, hash, key);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+    }
+#line 241 "./src/pmc/capture.c"
+}
+static  INTVAL 
+Parrot_Capture_elements(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 381 "./src/pmc/capture.pmc"
+
+    PMC *array;
+
+    GETATTR_Capture_array(interp, _self, array);
+
+    if (!array)
+        return 0;
+
+    return VTABLE_elements(interp, array);
+#line 256 "./src/pmc/capture.c"
+}
+static  INTVAL 
+Parrot_Capture_exists_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 661 "./src/pmc/capture.pmc"
+
+    PMC *hash;
+
+    GETATTR_Capture_hash(interp, _self, hash);
+
+    if (!hash)
+        return 0;
+
+    return VTABLE_exists_keyed(interp, hash, key);
+#line 271 "./src/pmc/capture.c"
+}
+static  INTVAL 
+Parrot_Capture_exists_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+#line 403 "./src/pmc/capture.pmc"
+
+    PMC *array;
+
+    GETATTR_Capture_array(interp, _self, array);
+
+    if (!array)
+        return 0;
+
+    return VTABLE_exists_keyed_int(interp, array, key);
+#line 286 "./src/pmc/capture.c"
+}
+static  INTVAL 
+Parrot_Capture_exists_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key)
+{
+#line 711 "./src/pmc/capture.pmc"
+
+    PMC *hash;
+
+    GETATTR_Capture_hash(interp, _self, hash);
+
+    if (!hash)
+        return 0;
+    return VTABLE_exists_keyed_str(interp, hash, key);
+#line 300 "./src/pmc/capture.c"
+}
+static  void 
+Parrot_Capture_freeze(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 809 "./src/pmc/capture.pmc"
+
+    PMC *array, *hash;
+    GETATTR_Capture_array(interp, _self, array);
+    GETATTR_Capture_hash(interp, _self, hash);
+
+    VTABLE_push_pmc(interp, info, array);
+    VTABLE_push_pmc(interp, info, hash);
+#line 313 "./src/pmc/capture.c"
+}
+static  INTVAL 
+Parrot_Capture_get_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 496 "./src/pmc/capture.pmc"
+
+    PMC *hash;
+
+    GETATTR_Capture_hash(interp, _self, hash);
+
+    if (!hash)
+        return 0;
+
+    return VTABLE_get_integer_keyed(interp, hash, key);
+#line 328 "./src/pmc/capture.c"
+}
+static  INTVAL 
+Parrot_Capture_get_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+#line 151 "./src/pmc/capture.pmc"
+
+    PMC *array;
+
+    GETATTR_Capture_array(interp, _self, array);
+    if (!array)
+        return 0;
+
+    return VTABLE_get_integer_keyed_int(interp, array, key);
+#line 342 "./src/pmc/capture.c"
+}
+static  INTVAL 
+Parrot_Capture_get_integer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key)
+{
+#line 600 "./src/pmc/capture.pmc"
+
+    PMC *hash;
+
+    GETATTR_Capture_hash(interp, _self, hash);
+
+    if (!hash)
+        return 0;
+
+    return VTABLE_get_integer_keyed_str(interp, hash, key);
+#line 357 "./src/pmc/capture.c"
+}
+static  FLOATVAL 
+Parrot_Capture_get_number_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 485 "./src/pmc/capture.pmc"
+
+    PMC *hash;
+
+    GETATTR_Capture_hash(interp, _self, hash);
+
+    if (!hash)
+        return 0.0;
+
+    return VTABLE_get_number_keyed(interp, hash, key);
+#line 372 "./src/pmc/capture.c"
+}
+static  FLOATVAL 
+Parrot_Capture_get_number_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+#line 141 "./src/pmc/capture.pmc"
+
+    PMC *array;
+
+    GETATTR_Capture_array(interp, _self, array);
+    if (!array)
+        return 0.0;
+
+    return VTABLE_get_number_keyed_int(interp, array, key);
+#line 386 "./src/pmc/capture.c"
+}
+static  FLOATVAL 
+Parrot_Capture_get_number_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key)
+{
+#line 589 "./src/pmc/capture.pmc"
+
+    PMC *hash;
+
+    GETATTR_Capture_hash(interp, _self, hash);
+
+    if (!hash)
+        return 0.0;
+
+    return VTABLE_get_number_keyed_str(interp, hash, key);
+#line 401 "./src/pmc/capture.c"
+}
+static  PMC  *
+Parrot_Capture_get_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 507 "./src/pmc/capture.pmc"
+
+    PMC *hash;
+
+    GETATTR_Capture_hash(interp, _self, hash);
+
+    if (!hash)
+        return PMCNULL;
+
+    return VTABLE_get_pmc_keyed(interp, hash, key);
+#line 416 "./src/pmc/capture.c"
+}
+static  PMC  *
+Parrot_Capture_get_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+#line 161 "./src/pmc/capture.pmc"
+
+    PMC *array;
+
+    GETATTR_Capture_array(interp, _self, array);
+    if (!array)
+        return PMCNULL;
+
+    return VTABLE_get_pmc_keyed_int(interp, array, key);
+#line 430 "./src/pmc/capture.c"
+}
+static  PMC  *
+Parrot_Capture_get_pmc_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key)
+{
+#line 611 "./src/pmc/capture.pmc"
+
+    PMC *hash;
+
+    GETATTR_Capture_hash(interp, _self, hash);
+
+    if (!hash)
+        return PMCNULL;
+
+    return VTABLE_get_pmc_keyed_str(interp, hash, key);
+#line 445 "./src/pmc/capture.c"
+}
+static  STRING  *
+Parrot_Capture_get_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 773 "./src/pmc/capture.pmc"
+
+    const STRING * const classname = VTABLE_name(interp, _self);
+    return Parrot_sprintf_c(interp, "%S[0x%x]", classname, _self);
+#line 454 "./src/pmc/capture.c"
+}
+static  STRING  *
+Parrot_Capture_get_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 518 "./src/pmc/capture.pmc"
+
+    PMC *hash;
+
+    GETATTR_Capture_hash(interp, _self, hash);
+
+    if (!hash)
+        return CONST_STRING(interp, "");
+
+    return VTABLE_get_string_keyed(interp, hash, key);
+#line 469 "./src/pmc/capture.c"
+}
+static  STRING  *
+Parrot_Capture_get_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+#line 171 "./src/pmc/capture.pmc"
+
+    PMC *array;
+
+    GETATTR_Capture_array(interp, _self, array);
+    if (!array)
+        return CONST_STRING(interp, "");
+
+    return VTABLE_get_string_keyed_int(interp, array, key);
+#line 483 "./src/pmc/capture.c"
+}
+static  STRING  *
+Parrot_Capture_get_string_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key)
+{
+#line 622 "./src/pmc/capture.pmc"
+
+    PMC *hash;
+
+    GETATTR_Capture_hash(interp, _self, hash);
+
+    if (!hash)
+        return CONST_STRING(interp, "");
+    return VTABLE_get_string_keyed_str(interp, hash, key);
+#line 497 "./src/pmc/capture.c"
+}
+static  void 
+Parrot_Capture_mark(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 788 "./src/pmc/capture.pmc"
+
+    PMC *array, *hash;
+    GETATTR_Capture_array(interp, _self, array);
+    GETATTR_Capture_hash(interp, _self, hash);
+
+    Parrot_gc_mark_PMC_alive(interp, array);
+    Parrot_gc_mark_PMC_alive(interp, hash);
+#line 510 "./src/pmc/capture.c"
+}
+static  FLOATVAL 
+Parrot_Capture_pop_float(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 289 "./src/pmc/capture.pmc"
+
+    PMC *array;
+    FLOATVAL ret;
+
+    CAPTURE_array_CREATE(interp, _self, array);
+    ret = VTABLE_pop_float(interp, array);
+    #line 522 "./src/pmc/capture.c"
+    return (FLOATVAL)ret;
+#line 295 "./src/pmc/capture.pmc"
+
+#line 526 "./src/pmc/capture.c"
+}
+static  INTVAL 
+Parrot_Capture_pop_integer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 298 "./src/pmc/capture.pmc"
+
+    PMC *array;
+    INTVAL ret;
+
+    CAPTURE_array_CREATE(interp, _self, array);
+    ret = VTABLE_pop_integer(interp, array);
+    #line 538 "./src/pmc/capture.c"
+    return (INTVAL)ret;
+#line 304 "./src/pmc/capture.pmc"
+
+#line 542 "./src/pmc/capture.c"
+}
+static  PMC  *
+Parrot_Capture_pop_pmc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 307 "./src/pmc/capture.pmc"
+
+    PMC *array, *ret;
+
+    CAPTURE_array_CREATE(interp, _self, array);
+    ret = VTABLE_pop_pmc(interp, array);
+    #line 553 "./src/pmc/capture.c"
+    return (PMC*)ret;
+#line 312 "./src/pmc/capture.pmc"
+
+#line 557 "./src/pmc/capture.c"
+}
+static  STRING  *
+Parrot_Capture_pop_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 315 "./src/pmc/capture.pmc"
+
+    PMC *array;
+    STRING *ret;
+
+    CAPTURE_array_CREATE(interp, _self, array);
+    ret = VTABLE_pop_string(interp, array);
+    #line 569 "./src/pmc/capture.c"
+    return (STRING*)ret;
+#line 321 "./src/pmc/capture.pmc"
+
+#line 573 "./src/pmc/capture.c"
+}
+static  void 
+Parrot_Capture_push_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value)
+{
+#line 207 "./src/pmc/capture.pmc"
+
+    PMC *array;
+
+    CAPTURE_array_CREATE(interp, _self, array);
+    VTABLE_push_float(interp, array, value);
+#line 584 "./src/pmc/capture.c"
+}
+static  void 
+Parrot_Capture_push_integer(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+#line 214 "./src/pmc/capture.pmc"
+
+    PMC *array;
+
+    CAPTURE_array_CREATE(interp, _self, array);
+    VTABLE_push_integer(interp, array, value);
+#line 595 "./src/pmc/capture.c"
+}
+static  void 
+Parrot_Capture_push_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 221 "./src/pmc/capture.pmc"
+
+    PMC *array;
+
+    CAPTURE_array_CREATE(interp, _self, array);
+    VTABLE_push_pmc(interp, array, value);
+#line 606 "./src/pmc/capture.c"
+}
+static  void 
+Parrot_Capture_push_string(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value)
+{
+#line 228 "./src/pmc/capture.pmc"
+
+    PMC *array;
+
+    CAPTURE_array_CREATE(interp, _self, array);
+    VTABLE_push_string(interp, array, value);
+#line 617 "./src/pmc/capture.c"
+}
+static  void 
+Parrot_Capture_set_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, INTVAL value)
+{
+#line 448 "./src/pmc/capture.pmc"
+
+    PMC *hash;
+
+    CAPTURE_hash_CREATE(interp, _self, hash);
+    VTABLE_set_integer_keyed(interp, hash, key, value);
+#line 628 "./src/pmc/capture.c"
+}
+static  void 
+Parrot_Capture_set_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, INTVAL value)
+{
+#line 104 "./src/pmc/capture.pmc"
+
+    PMC *array;
+
+    CAPTURE_array_CREATE(interp, _self, array);
+    VTABLE_set_integer_keyed_int(interp, array, key, value);
+#line 639 "./src/pmc/capture.c"
+}
+static  void 
+Parrot_Capture_set_integer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key, INTVAL value)
+{
+#line 552 "./src/pmc/capture.pmc"
+
+    PMC *hash;
+
+    CAPTURE_hash_CREATE(interp, _self, hash);
+    VTABLE_set_integer_keyed_str(interp, hash, key, value);
+#line 650 "./src/pmc/capture.c"
+}
+static  void 
+Parrot_Capture_set_number_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, FLOATVAL value)
+{
+#line 441 "./src/pmc/capture.pmc"
+
+    PMC *hash;
+
+    CAPTURE_hash_CREATE(interp, _self, hash);
+    VTABLE_set_number_keyed(interp, hash, key, value);
+#line 661 "./src/pmc/capture.c"
+}
+static  void 
+Parrot_Capture_set_number_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, FLOATVAL value)
+{
+#line 97 "./src/pmc/capture.pmc"
+
+    PMC *array;
+
+    CAPTURE_array_CREATE(interp, _self, array);
+    VTABLE_set_number_keyed_int(interp, array, key, value);
+#line 672 "./src/pmc/capture.c"
+}
+static  void 
+Parrot_Capture_set_number_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key, FLOATVAL value)
+{
+#line 545 "./src/pmc/capture.pmc"
+
+    PMC *hash;
+
+    CAPTURE_hash_CREATE(interp, _self, hash);
+    VTABLE_set_number_keyed_str(interp, hash, key, value);
+#line 683 "./src/pmc/capture.c"
+}
+static  void 
+Parrot_Capture_set_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *capture)
+{
+#line 743 "./src/pmc/capture.pmc"
+
+    if (PMC_IS_NULL(capture)) {
+        SETATTR_Capture_array(interp, _self, NULL);
+        SETATTR_Capture_hash(interp, _self, NULL);
+    }
+    else if (VTABLE_isa(interp, capture, CONST_STRING(interp, "Capture"))) {
+        PMC *array, *hash;
+        GETATTR_Capture_array(interp, capture, array);
+        GETATTR_Capture_hash(interp, capture, hash);
+        SETATTR_Capture_array(interp, _self, array);
+        SETATTR_Capture_hash(interp, _self, hash);
+        if (!PMC_IS_NULL(array) || !PMC_IS_NULL(hash))
+            PObj_custom_mark_SET(_self);
+    }
+    else
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "Can only set a capture to another capture.");
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 707 "./src/pmc/capture.c"
+}
+static  void 
+Parrot_Capture_set_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, PMC *value)
+{
+#line 455 "./src/pmc/capture.pmc"
+
+    PMC *hash;
+
+    CAPTURE_hash_CREATE(interp, _self, hash);
+    VTABLE_set_pmc_keyed(interp, hash, key, value);
+#line 718 "./src/pmc/capture.c"
+}
+static  void 
+Parrot_Capture_set_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, PMC *value)
+{
+#line 111 "./src/pmc/capture.pmc"
+
+    PMC *array;
+
+    CAPTURE_array_CREATE(interp, _self, array);
+    VTABLE_set_pmc_keyed_int(interp, array, key, value);
+#line 729 "./src/pmc/capture.c"
+}
+static  void 
+Parrot_Capture_set_pmc_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key, PMC *value)
+{
+#line 559 "./src/pmc/capture.pmc"
+
+    PMC *hash;
+
+    CAPTURE_hash_CREATE(interp, _self, hash);
+    VTABLE_set_pmc_keyed_str(interp, hash, key, value);
+#line 740 "./src/pmc/capture.c"
+}
+static  void 
+Parrot_Capture_set_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, STRING *value)
+{
+#line 462 "./src/pmc/capture.pmc"
+
+    PMC *hash;
+
+    CAPTURE_hash_CREATE(interp, _self, hash);
+    VTABLE_set_string_keyed(interp, hash, key, value);
+#line 751 "./src/pmc/capture.c"
+}
+static  void 
+Parrot_Capture_set_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, STRING *value)
+{
+#line 118 "./src/pmc/capture.pmc"
+
+    PMC *array;
+
+    CAPTURE_array_CREATE(interp, _self, array);
+    VTABLE_set_string_keyed_int(interp, array, key, value);
+#line 762 "./src/pmc/capture.c"
+}
+static  void 
+Parrot_Capture_set_string_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key, STRING *value)
+{
+#line 566 "./src/pmc/capture.pmc"
+
+    PMC *hash;
+
+    CAPTURE_hash_CREATE(interp, _self, hash);
+    VTABLE_set_string_keyed_str(interp, hash, key, value);
+#line 773 "./src/pmc/capture.c"
+}
+static  FLOATVAL 
+Parrot_Capture_shift_float(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 324 "./src/pmc/capture.pmc"
+
+    PMC *array;
+    FLOATVAL ret;
+
+    CAPTURE_array_CREATE(interp, _self, array);
+    ret = VTABLE_shift_float(interp, array);
+    #line 785 "./src/pmc/capture.c"
+    return (FLOATVAL)ret;
+#line 330 "./src/pmc/capture.pmc"
+
+#line 789 "./src/pmc/capture.c"
+}
+static  INTVAL 
+Parrot_Capture_shift_integer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 333 "./src/pmc/capture.pmc"
+
+    PMC *array;
+    INTVAL ret;
+
+    CAPTURE_array_CREATE(interp, _self, array);
+    ret = VTABLE_shift_integer(interp, array);
+    #line 801 "./src/pmc/capture.c"
+    return (INTVAL)ret;
+#line 339 "./src/pmc/capture.pmc"
+
+#line 805 "./src/pmc/capture.c"
+}
+static  PMC  *
+Parrot_Capture_shift_pmc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 342 "./src/pmc/capture.pmc"
+
+    PMC *array, *ret;
+
+    CAPTURE_array_CREATE(interp, _self, array);
+    ret = VTABLE_shift_pmc(interp, array);
+    #line 816 "./src/pmc/capture.c"
+    return (PMC*)ret;
+#line 347 "./src/pmc/capture.pmc"
+
+#line 820 "./src/pmc/capture.c"
+}
+static  STRING  *
+Parrot_Capture_shift_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 350 "./src/pmc/capture.pmc"
+
+    PMC *array;
+    STRING *ret;
+
+    CAPTURE_array_CREATE(interp, _self, array);
+    ret = VTABLE_shift_string(interp, array);
+    #line 832 "./src/pmc/capture.c"
+    return (STRING*)ret;
+#line 356 "./src/pmc/capture.pmc"
+
+#line 836 "./src/pmc/capture.c"
+}
+static  void 
+Parrot_Capture_thaw(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 818 "./src/pmc/capture.pmc"
+
+    PMC *tmp = VTABLE_shift_pmc(interp, info);
+    if (!PMC_IS_NULL(tmp)) {
+        SETATTR_Capture_array(interp, _self, tmp);
+        PObj_custom_mark_SET(_self);
+    }
+    tmp = VTABLE_shift_pmc(interp, info);
+    if (!PMC_IS_NULL(tmp)) {
+        SETATTR_Capture_hash(interp, _self, tmp);
+        PObj_custom_mark_SET(_self);
+    }
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 854 "./src/pmc/capture.c"
+}
+static  void 
+Parrot_Capture_unshift_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value)
+{
+#line 235 "./src/pmc/capture.pmc"
+
+    PMC *array;
+
+    CAPTURE_array_CREATE(interp, _self, array);
+    VTABLE_unshift_float(interp, array, value);
+#line 865 "./src/pmc/capture.c"
+}
+static  void 
+Parrot_Capture_unshift_integer(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+#line 242 "./src/pmc/capture.pmc"
+
+    PMC *array;
+
+    CAPTURE_array_CREATE(interp, _self, array);
+    VTABLE_unshift_integer(interp, array, value);
+#line 876 "./src/pmc/capture.c"
+}
+static  void 
+Parrot_Capture_unshift_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 249 "./src/pmc/capture.pmc"
+
+    PMC *array;
+
+    CAPTURE_array_CREATE(interp, _self, array);
+    VTABLE_unshift_pmc(interp, array, value);
+#line 887 "./src/pmc/capture.c"
+}
+static  void 
+Parrot_Capture_unshift_string(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value)
+{
+#line 256 "./src/pmc/capture.pmc"
+
+    PMC *array;
+
+    CAPTURE_array_CREATE(interp, _self, array);
+    VTABLE_unshift_string(interp, array, value);
+#line 898 "./src/pmc/capture.c"
+}
+static  void
+Parrot_Capture_nci_list(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 842 "./src/pmc/capture.pmc"
+
+    PMC *array;
+    PMC *capt;
+
+    /* XXX:  This workaround is for when we get here as
+             part of a subclass of Capture */
+    if (PObj_is_object_TEST(_self)) {
+        PMC    *classobj;
+        PMC    *ns        = interp->root_namespace;
+
+        ns                = Parrot_ns_get_namespace_keyed_str(interp, ns, CONST_STRING(interp, "parrot"));
+        ns                = Parrot_ns_get_namespace_keyed_str(interp, ns, CONST_STRING(interp, "Capture"));
+        classobj          = Parrot_oo_get_class(interp, ns);
+        capt              = VTABLE_get_attr_keyed(interp, _self, classobj, CONST_STRING(interp, "proxy"));
+    }
+    else
+        capt = _self;
+
+    CAPTURE_array_CREATE(interp, capt, array);
+    #line 938 "./src/pmc/capture.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)array);
+        
+        return;
+     }
+#line 861 "./src/pmc/capture.pmc"
+
+#line 946 "./src/pmc/capture.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Capture_nci_hash(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 864 "./src/pmc/capture.pmc"
+
+    PMC *hash;
+    PMC *capt;
+    /* XXX:  This workaround is for when we get here as
+             part of a subclass of Capture */
+    if (PObj_is_object_TEST(_self)) {
+        STRING * const classname = CONST_STRING(interp, "Capture");
+        PMC    * const classobj  = Parrot_oo_get_class_str(interp, classname);
+
+        capt = VTABLE_get_attr_keyed(interp, _self, classobj, CONST_STRING(interp, "proxy"));
+    }
+    else
+        capt = _self;
+
+    CAPTURE_hash_CREATE(interp, capt, hash);
+
+    #line 990 "./src/pmc/capture.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)hash);
+        
+        return;
+     }
+#line 880 "./src/pmc/capture.pmc"
+
+#line 998 "./src/pmc/capture.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_Capture_update_vtable(VTABLE *vt) {
+    vt->clone = Parrot_Capture_clone;
+    vt->defined_keyed = Parrot_Capture_defined_keyed;
+    vt->defined_keyed_int = Parrot_Capture_defined_keyed_int;
+    vt->defined_keyed_str = Parrot_Capture_defined_keyed_str;
+    vt->delete_keyed = Parrot_Capture_delete_keyed;
+    vt->delete_keyed_int = Parrot_Capture_delete_keyed_int;
+    vt->delete_keyed_str = Parrot_Capture_delete_keyed_str;
+    vt->elements = Parrot_Capture_elements;
+    vt->exists_keyed = Parrot_Capture_exists_keyed;
+    vt->exists_keyed_int = Parrot_Capture_exists_keyed_int;
+    vt->exists_keyed_str = Parrot_Capture_exists_keyed_str;
+    vt->freeze = Parrot_Capture_freeze;
+    vt->get_integer_keyed = Parrot_Capture_get_integer_keyed;
+    vt->get_integer_keyed_int = Parrot_Capture_get_integer_keyed_int;
+    vt->get_integer_keyed_str = Parrot_Capture_get_integer_keyed_str;
+    vt->get_number_keyed = Parrot_Capture_get_number_keyed;
+    vt->get_number_keyed_int = Parrot_Capture_get_number_keyed_int;
+    vt->get_number_keyed_str = Parrot_Capture_get_number_keyed_str;
+    vt->get_pmc_keyed = Parrot_Capture_get_pmc_keyed;
+    vt->get_pmc_keyed_int = Parrot_Capture_get_pmc_keyed_int;
+    vt->get_pmc_keyed_str = Parrot_Capture_get_pmc_keyed_str;
+    vt->get_string = Parrot_Capture_get_string;
+    vt->get_string_keyed = Parrot_Capture_get_string_keyed;
+    vt->get_string_keyed_int = Parrot_Capture_get_string_keyed_int;
+    vt->get_string_keyed_str = Parrot_Capture_get_string_keyed_str;
+    vt->mark = Parrot_Capture_mark;
+    vt->pop_float = Parrot_Capture_pop_float;
+    vt->pop_integer = Parrot_Capture_pop_integer;
+    vt->pop_pmc = Parrot_Capture_pop_pmc;
+    vt->pop_string = Parrot_Capture_pop_string;
+    vt->push_float = Parrot_Capture_push_float;
+    vt->push_integer = Parrot_Capture_push_integer;
+    vt->push_pmc = Parrot_Capture_push_pmc;
+    vt->push_string = Parrot_Capture_push_string;
+    vt->set_integer_keyed = Parrot_Capture_set_integer_keyed;
+    vt->set_integer_keyed_int = Parrot_Capture_set_integer_keyed_int;
+    vt->set_integer_keyed_str = Parrot_Capture_set_integer_keyed_str;
+    vt->set_number_keyed = Parrot_Capture_set_number_keyed;
+    vt->set_number_keyed_int = Parrot_Capture_set_number_keyed_int;
+    vt->set_number_keyed_str = Parrot_Capture_set_number_keyed_str;
+    vt->set_pmc = Parrot_Capture_set_pmc;
+    vt->set_pmc_keyed = Parrot_Capture_set_pmc_keyed;
+    vt->set_pmc_keyed_int = Parrot_Capture_set_pmc_keyed_int;
+    vt->set_pmc_keyed_str = Parrot_Capture_set_pmc_keyed_str;
+    vt->set_string_keyed = Parrot_Capture_set_string_keyed;
+    vt->set_string_keyed_int = Parrot_Capture_set_string_keyed_int;
+    vt->set_string_keyed_str = Parrot_Capture_set_string_keyed_str;
+    vt->shift_float = Parrot_Capture_shift_float;
+    vt->shift_integer = Parrot_Capture_shift_integer;
+    vt->shift_pmc = Parrot_Capture_shift_pmc;
+    vt->shift_string = Parrot_Capture_shift_string;
+    vt->thaw = Parrot_Capture_thaw;
+    vt->unshift_float = Parrot_Capture_unshift_float;
+    vt->unshift_integer = Parrot_Capture_unshift_integer;
+    vt->unshift_pmc = Parrot_Capture_unshift_pmc;
+    vt->unshift_string = Parrot_Capture_unshift_string;
+    vt->attr_size = sizeof(Parrot_Capture_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_Capture_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->clone = Parrot_Capture_clone;
+    vt->defined_keyed = Parrot_Capture_defined_keyed;
+    vt->defined_keyed_int = Parrot_Capture_defined_keyed_int;
+    vt->defined_keyed_str = Parrot_Capture_defined_keyed_str;
+    vt->elements = Parrot_Capture_elements;
+    vt->exists_keyed = Parrot_Capture_exists_keyed;
+    vt->exists_keyed_int = Parrot_Capture_exists_keyed_int;
+    vt->exists_keyed_str = Parrot_Capture_exists_keyed_str;
+    vt->freeze = Parrot_Capture_freeze;
+    vt->get_integer_keyed = Parrot_Capture_get_integer_keyed;
+    vt->get_integer_keyed_int = Parrot_Capture_get_integer_keyed_int;
+    vt->get_integer_keyed_str = Parrot_Capture_get_integer_keyed_str;
+    vt->get_number_keyed = Parrot_Capture_get_number_keyed;
+    vt->get_number_keyed_int = Parrot_Capture_get_number_keyed_int;
+    vt->get_number_keyed_str = Parrot_Capture_get_number_keyed_str;
+    vt->get_pmc_keyed = Parrot_Capture_get_pmc_keyed;
+    vt->get_pmc_keyed_int = Parrot_Capture_get_pmc_keyed_int;
+    vt->get_pmc_keyed_str = Parrot_Capture_get_pmc_keyed_str;
+    vt->get_string = Parrot_Capture_get_string;
+    vt->get_string_keyed = Parrot_Capture_get_string_keyed;
+    vt->get_string_keyed_int = Parrot_Capture_get_string_keyed_int;
+    vt->get_string_keyed_str = Parrot_Capture_get_string_keyed_str;
+    vt->mark = Parrot_Capture_mark;
+    vt->attr_size = sizeof(Parrot_Capture_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Capture_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_Capture_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Capture_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_Capture_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_Capture_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "Capture"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_Capture_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "Capture")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_Capture_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "Farray Fhash ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_Capture_get_vtable(interp);
+        vt->base_type      = enum_class_Capture;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "Capture");
+        vt->provides_str = CONST_STRING_GEN(interp, "scalar");
+        vt->isa_hash     = Parrot_Capture_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_Capture_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_Capture;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_Capture_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "list");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Capture_nci_list),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "hash");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Capture_nci_hash),
+                method_name, signature);
+        }
+        {
+        }
+    } /* pass */
+} /* Parrot_Capture_class_init */
+
+#line 882 "./src/pmc/capture.pmc"
+
+
+/*
+
+=back
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
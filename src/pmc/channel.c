@@ -0,0 +1,1284 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/channel.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_fixedintegerarray.h"
+#include "pmc_channel.h"
+#include "pmc_default.h"
+#include "channel.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/channel.pmc"
+/*
+Copyright (C) 2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/channel.pmc - Channel PMC
+
+=head1 DESCRIPTION
+
+A C<Channel> is a bounded, multi-producer multi-consumer message queue for
+passing values between thread interpreters without sharing any PMCs.
+
+The queue itself is a ring of cells with a sequence number each, claimed
+with compare-and-swap on a head and a tail counter, so senders and
+receivers on different threads never take a lock unless the channel is
+full or empty and they have to wait. The C<Channel> PMC is only a handle:
+when a task carries a channel to another thread, that thread gets a handle
+of its own to the same queue instead of a C<Proxy>. Nothing in a C<Channel>
+PMC is written after it is created, so a foreign handle works as well.
+
+Messages never hold references into the sender's heap:
+
+=over 4
+
+=item * integers and floats are copied by value,
+
+=item * constant strings are passed as the STRING header itself, since they
+live as long as their interpreter and are never written to,
+
+=item * other strings are copied once into the message,
+
+=item * C<Integer>, C<Float> and C<String> PMCs are sent as their value,
+
+=item * C<Channel> PMCs are sent as a new handle to their queue,
+
+=item * anything else is frozen on send and thawed by the receiver.
+
+=back
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "parrot/atomic.h"
+
+typedef enum {
+    CHANNEL_MSG_NULL,
+    CHANNEL_MSG_INT,
+    CHANNEL_MSG_NUM,
+    CHANNEL_MSG_CONST_STRING,
+    CHANNEL_MSG_STRING,
+    CHANNEL_MSG_CHANNEL,
+    CHANNEL_MSG_FROZEN
+} channel_message_type;
+
+typedef struct Parrot_Channel_message {
+    channel_message_type  type;
+    union {
+        INTVAL                  i;
+        FLOATVAL                n;
+        STRING                 *s;
+        char                   *bytes;
+        struct Parrot_Channel  *channel;
+    } u;
+    UINTVAL               size;     /* bytes of a copied string or image */
+    const STR_VTABLE     *encoding; /* encoding of a copied string */
+} Parrot_Channel_message;
+
+typedef struct Parrot_Channel_cell {
+    Parrot_atomic_integer   sequence;
+    Parrot_Channel_message  message;
+} Parrot_Channel_cell;
+
+typedef struct Parrot_Channel {
+    Parrot_atomic_integer  refs;     /* handles and queued messages using it */
+    Parrot_atomic_integer  head;     /* next cell to receive from */
+    Parrot_atomic_integer  tail;     /* next cell to send to */
+    Parrot_atomic_integer  waiters;  /* threads blocked in send or receive */
+    INTVAL                 mask;     /* capacity - 1, capacity is a power of 2 */
+    Parrot_mutex           lock;
+    Parrot_cond            ready;
+    Parrot_Channel_cell   *cells;
+} Parrot_Channel;
+
+#define CHANNEL_DEFAULT_CAPACITY 1024
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+static void channel_copy_bytes(
+    ARGOUT(Parrot_Channel_message *msg),
+    ARGIN(const STRING *s))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*msg);
+
+PARROT_WARN_UNUSED_RESULT
+static int channel_dequeue(
+    ARGMOD(Parrot_Channel *ch),
+    ARGOUT(Parrot_Channel_message *msg))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*ch)
+        FUNC_MODIFIES(*msg);
+
+static void channel_discard(ARGMOD(Parrot_Channel_message *msg))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*msg);
+
+PARROT_WARN_UNUSED_RESULT
+static int channel_enqueue(
+    ARGMOD(Parrot_Channel *ch),
+    ARGIN(const Parrot_Channel_message *msg))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*ch);
+
+PARROT_CANNOT_RETURN_NULL
+static Parrot_Channel * channel_new(INTVAL capacity);
+
+static void channel_pack_pmc(PARROT_INTERP,
+    ARGIN_NULLOK(PMC *value),
+    ARGOUT(Parrot_Channel_message *msg))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*msg);
+
+static void channel_pack_string(
+    ARGIN_NULLOK(STRING *s),
+    ARGOUT(Parrot_Channel_message *msg))
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*msg);
+
+static void channel_publish(
+    ARGMOD(Parrot_atomic_integer *sequence),
+    INTVAL from,
+    INTVAL to)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*sequence);
+
+static void channel_receive(
+    ARGMOD(Parrot_Channel *ch),
+    ARGOUT(Parrot_Channel_message *msg))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*ch)
+        FUNC_MODIFIES(*msg);
+
+static void channel_release(ARGMOD(Parrot_Channel *ch))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*ch);
+
+static void channel_retain(ARGMOD(Parrot_Channel *ch))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*ch);
+
+static void channel_send(
+    ARGMOD(Parrot_Channel *ch),
+    ARGIN(const Parrot_Channel_message *msg))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*ch);
+
+PARROT_CANNOT_RETURN_NULL
+static PMC * channel_unpack_pmc(PARROT_INTERP,
+    ARGMOD(Parrot_Channel_message *msg))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*msg);
+
+PARROT_CANNOT_RETURN_NULL
+static STRING * channel_unpack_string(PARROT_INTERP,
+    ARGMOD(Parrot_Channel_message *msg))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*msg);
+
+static void channel_wake(ARGMOD(Parrot_Channel *ch))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*ch);
+
+#define ASSERT_ARGS_channel_copy_bytes __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(msg) \
+    , PARROT_ASSERT_ARG(s))
+#define ASSERT_ARGS_channel_dequeue __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(ch) \
+    , PARROT_ASSERT_ARG(msg))
+#define ASSERT_ARGS_channel_discard __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(msg))
+#define ASSERT_ARGS_channel_enqueue __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(ch) \
+    , PARROT_ASSERT_ARG(msg))
+#define ASSERT_ARGS_channel_new __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_channel_pack_pmc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(msg))
+#define ASSERT_ARGS_channel_pack_string __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(msg))
+#define ASSERT_ARGS_channel_publish __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(sequence))
+#define ASSERT_ARGS_channel_receive __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(ch) \
+    , PARROT_ASSERT_ARG(msg))
+#define ASSERT_ARGS_channel_release __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(ch))
+#define ASSERT_ARGS_channel_retain __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(ch))
+#define ASSERT_ARGS_channel_send __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(ch) \
+    , PARROT_ASSERT_ARG(msg))
+#define ASSERT_ARGS_channel_unpack_pmc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(msg))
+#define ASSERT_ARGS_channel_unpack_string __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(msg))
+#define ASSERT_ARGS_channel_wake __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(ch))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+/*
+
+=item C<static Parrot_Channel * channel_new(INTVAL capacity)>
+
+Allocates a queue with room for at least C<capacity> messages and one
+reference.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+static Parrot_Channel *
+channel_new(INTVAL capacity)
+{
+    ASSERT_ARGS(channel_new)
+    Parrot_Channel * const ch = mem_internal_allocate_zeroed_typed(Parrot_Channel);
+    INTVAL size = 2;
+    INTVAL i;
+
+    while (size < capacity)
+        size <<= 1;
+
+    ch->mask  = size - 1;
+    ch->cells = mem_internal_allocate_n_zeroed_typed(size, Parrot_Channel_cell);
+    for (i = 0; i < size; ++i) {
+        PARROT_ATOMIC_INT_INIT(ch->cells[i].sequence);
+        PARROT_ATOMIC_INT_SET(ch->cells[i].sequence, i);
+    }
+
+    PARROT_ATOMIC_INT_INIT(ch->refs);
+    PARROT_ATOMIC_INT_INIT(ch->head);
+    PARROT_ATOMIC_INT_INIT(ch->tail);
+    PARROT_ATOMIC_INT_INIT(ch->waiters);
+    PARROT_ATOMIC_INT_SET(ch->refs, 1);
+    MUTEX_INIT(ch->lock);
+    COND_INIT(ch->ready);
+
+    return ch;
+}
+
+/*
+
+=item C<static void channel_retain(Parrot_Channel *ch)>
+
+Adds a reference to the queue.
+
+=item C<static void channel_release(Parrot_Channel *ch)>
+
+Drops a reference to the queue and frees it, along with any messages
+nobody received, when it was the last one.
+
+=cut
+
+*/
+
+static void
+channel_retain(ARGMOD(Parrot_Channel *ch))
+{
+    ASSERT_ARGS(channel_retain)
+    INTVAL refs;
+    PARROT_ATOMIC_INT_INC(refs, ch->refs);
+    UNUSED(refs);
+}
+
+static void
+channel_release(ARGMOD(Parrot_Channel *ch))
+{
+    ASSERT_ARGS(channel_release)
+    Parrot_Channel_message msg;
+    INTVAL refs;
+    INTVAL i;
+
+    PARROT_ATOMIC_INT_DEC(refs, ch->refs);
+    if (refs > 0)
+        return;
+
+    while (channel_dequeue(ch, &msg))
+        channel_discard(&msg);
+
+    for (i = 0; i <= ch->mask; ++i)
+        PARROT_ATOMIC_INT_DESTROY(ch->cells[i].sequence);
+    PARROT_ATOMIC_INT_DESTROY(ch->refs);
+    PARROT_ATOMIC_INT_DESTROY(ch->head);
+    PARROT_ATOMIC_INT_DESTROY(ch->tail);
+    PARROT_ATOMIC_INT_DESTROY(ch->waiters);
+    MUTEX_DESTROY(ch->lock);
+    COND_DESTROY(ch->ready);
+
+    mem_internal_free(ch->cells);
+    mem_internal_free(ch);
+}
+
+/*
+
+=item C<static void channel_publish(Parrot_atomic_integer *sequence, INTVAL
+from, INTVAL to)>
+
+Hands a cell over by moving its sequence number on. Only the thread that
+claimed the cell writes its sequence, so this always succeeds; it's a
+compare-and-swap for the barrier, which keeps the message write before it.
+
+=cut
+
+*/
+
+static void
+channel_publish(ARGMOD(Parrot_atomic_integer *sequence), INTVAL from, INTVAL to)
+{
+    ASSERT_ARGS(channel_publish)
+    int done;
+    PARROT_ATOMIC_INT_CAS(done, *sequence, from, to);
+    PARROT_ASSERT(done);
+    UNUSED(done);
+}
+
+/*
+
+=item C<static int channel_enqueue(Parrot_Channel *ch, const
+Parrot_Channel_message *msg)>
+
+Appends a message without blocking. Returns 0 when the channel is full.
+
+=item C<static int channel_dequeue(Parrot_Channel *ch, Parrot_Channel_message
+*msg)>
+
+Takes the oldest message without blocking. Returns 0 when the channel is
+empty.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+channel_enqueue(ARGMOD(Parrot_Channel *ch), ARGIN(const Parrot_Channel_message *msg))
+{
+    ASSERT_ARGS(channel_enqueue)
+    Parrot_Channel_cell *cell;
+    INTVAL pos;
+
+    PARROT_ATOMIC_INT_GET(pos, ch->tail);
+    for (;;) {
+        INTVAL seq;
+        int    claimed;
+
+        cell = &ch->cells[pos & ch->mask];
+        PARROT_ATOMIC_INT_GET(seq, cell->sequence);
+
+        /* The cell is still waiting for a receiver from the last lap */
+        if (seq < pos)
+            return 0;
+
+        if (seq == pos) {
+            PARROT_ATOMIC_INT_CAS(claimed, ch->tail, pos, pos + 1);
+            if (claimed)
+                break;
+        }
+        PARROT_ATOMIC_INT_GET(pos, ch->tail);
+    }
+
+    cell->message = *msg;
+    channel_publish(&cell->sequence, pos, pos + 1);
+    return 1;
+}
+
+PARROT_WARN_UNUSED_RESULT
+static int
+channel_dequeue(ARGMOD(Parrot_Channel *ch), ARGOUT(Parrot_Channel_message *msg))
+{
+    ASSERT_ARGS(channel_dequeue)
+    Parrot_Channel_cell *cell;
+    INTVAL pos;
+
+    PARROT_ATOMIC_INT_GET(pos, ch->head);
+    for (;;) {
+        INTVAL seq;
+        int    claimed;
+
+        cell = &ch->cells[pos & ch->mask];
+        PARROT_ATOMIC_INT_GET(seq, cell->sequence);
+
+        /* Nothing has been sent to this cell yet */
+        if (seq < pos + 1)
+            return 0;
+
+        if (seq == pos + 1) {
+            PARROT_ATOMIC_INT_CAS(claimed, ch->head, pos, pos + 1);
+            if (claimed)
+                break;
+        }
+        PARROT_ATOMIC_INT_GET(pos, ch->head);
+    }
+
+    *msg = cell->message;
+    channel_publish(&cell->sequence, pos + 1, pos + ch->mask + 1);
+    return 1;
+}
+
+/*
+
+=item C<static void channel_wake(Parrot_Channel *ch)>
+
+Wakes any threads waiting for the channel to change after a message went in
+or out.
+
+=item C<static void channel_send(Parrot_Channel *ch, const
+Parrot_Channel_message *msg)>
+
+Appends a message, waiting for room if the channel is full.
+
+=item C<static void channel_receive(Parrot_Channel *ch, Parrot_Channel_message
+*msg)>
+
+Takes the oldest message, waiting for one if the channel is empty.
+
+=cut
+
+*/
+
+static void
+channel_wake(ARGMOD(Parrot_Channel *ch))
+{
+    ASSERT_ARGS(channel_wake)
+    INTVAL waiters;
+
+    PARROT_ATOMIC_INT_GET(waiters, ch->waiters);
+    if (waiters > 0) {
+        LOCK(ch->lock);
+        COND_BROADCAST(ch->ready);
+        UNLOCK(ch->lock);
+    }
+}
+
+static void
+channel_send(ARGMOD(Parrot_Channel *ch), ARGIN(const Parrot_Channel_message *msg))
+{
+    ASSERT_ARGS(channel_send)
+
+    if (!channel_enqueue(ch, msg)) {
+        INTVAL waiters;
+
+        /* Register as a waiter before looking again, so a receiver that
+           makes room after this look will see us and wake us up. */
+        LOCK(ch->lock);
+        PARROT_ATOMIC_INT_INC(waiters, ch->waiters);
+        while (!channel_enqueue(ch, msg))
+            COND_WAIT(ch->ready, ch->lock);
+        PARROT_ATOMIC_INT_DEC(waiters, ch->waiters);
+        UNLOCK(ch->lock);
+    }
+
+    channel_wake(ch);
+}
+
+static void
+channel_receive(ARGMOD(Parrot_Channel *ch), ARGOUT(Parrot_Channel_message *msg))
+{
+    ASSERT_ARGS(channel_receive)
+
+    if (!channel_dequeue(ch, msg)) {
+        INTVAL waiters;
+
+        LOCK(ch->lock);
+        PARROT_ATOMIC_INT_INC(waiters, ch->waiters);
+        while (!channel_dequeue(ch, msg))
+            COND_WAIT(ch->ready, ch->lock);
+        PARROT_ATOMIC_INT_DEC(waiters, ch->waiters);
+        UNLOCK(ch->lock);
+    }
+
+    channel_wake(ch);
+}
+
+/*
+
+=item C<static void channel_copy_bytes(Parrot_Channel_message *msg, const STRING
+*s)>
+
+Copies the contents of C<s> into a buffer owned by the message.
+
+=item C<static void channel_discard(Parrot_Channel_message *msg)>
+
+Frees what a message owns without delivering it.
+
+=cut
+
+*/
+
+static void
+channel_copy_bytes(ARGOUT(Parrot_Channel_message *msg), ARGIN(const STRING *s))
+{
+    ASSERT_ARGS(channel_copy_bytes)
+
+    msg->size     = s->bufused;
+    msg->encoding = s->encoding;
+    msg->u.bytes  = (char *)mem_internal_allocate(s->bufused ? s->bufused : 1);
+    if (s->bufused)
+        memcpy(msg->u.bytes, s->strstart, s->bufused);
+}
+
+static void
+channel_discard(ARGMOD(Parrot_Channel_message *msg))
+{
+    ASSERT_ARGS(channel_discard)
+
+    switch (msg->type) {
+      case CHANNEL_MSG_STRING:
+      case CHANNEL_MSG_FROZEN:
+        mem_internal_free(msg->u.bytes);
+        break;
+      case CHANNEL_MSG_CHANNEL:
+        channel_release(msg->u.channel);
+        break;
+      default:
+        break;
+    }
+    msg->type = CHANNEL_MSG_NULL;
+}
+
+/*
+
+=item C<static void channel_pack_string(STRING *s, Parrot_Channel_message *msg)>
+
+Fills in a message carrying C<s>: constant strings by reference, others as
+a copy of their bytes.
+
+=item C<static void channel_pack_pmc(PARROT_INTERP, PMC *value,
+Parrot_Channel_message *msg)>
+
+Fills in a message carrying C<value>.
+
+=cut
+
+*/
+
+static void
+channel_pack_string(ARGIN_NULLOK(STRING *s), ARGOUT(Parrot_Channel_message *msg))
+{
+    ASSERT_ARGS(channel_pack_string)
+
+    if (STRING_IS_NULL(s))
+        msg->type = CHANNEL_MSG_NULL;
+    else if (PObj_constant_TEST(s)) {
+        msg->type = CHANNEL_MSG_CONST_STRING;
+        msg->u.s  = s;
+    }
+    else {
+        msg->type = CHANNEL_MSG_STRING;
+        channel_copy_bytes(msg, s);
+    }
+}
+
+static void
+channel_pack_pmc(PARROT_INTERP, ARGIN_NULLOK(PMC *value), ARGOUT(Parrot_Channel_message *msg))
+{
+    ASSERT_ARGS(channel_pack_pmc)
+
+    if (PMC_IS_NULL(value)) {
+        msg->type = CHANNEL_MSG_NULL;
+        return;
+    }
+
+    switch (value->vtable->base_type) {
+      case enum_class_Integer:
+        msg->type = CHANNEL_MSG_INT;
+        msg->u.i  = VTABLE_get_integer(interp, value);
+        break;
+      case enum_class_Float:
+        msg->type = CHANNEL_MSG_NUM;
+        msg->u.n  = VTABLE_get_number(interp, value);
+        break;
+      case enum_class_String:
+        channel_pack_string(VTABLE_get_string(interp, value), msg);
+        break;
+      case enum_class_Channel:
+        msg->type      = CHANNEL_MSG_CHANNEL;
+        msg->u.channel = PARROT_CHANNEL(value)->queue;
+        channel_retain(msg->u.channel);
+        break;
+      default:
+        msg->type = CHANNEL_MSG_FROZEN;
+        channel_copy_bytes(msg, Parrot_freeze(interp, value));
+        break;
+    }
+}
+
+/*
+
+=item C<static STRING * channel_unpack_string(PARROT_INTERP,
+Parrot_Channel_message *msg)>
+
+Returns the string a message carries in this interpreter and frees the
+message. Messages that don't carry a string are converted.
+
+=item C<static PMC * channel_unpack_pmc(PARROT_INTERP, Parrot_Channel_message
+*msg)>
+
+Returns the value a message carries as a PMC of this interpreter and frees
+the message.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+static STRING *
+channel_unpack_string(PARROT_INTERP, ARGMOD(Parrot_Channel_message *msg))
+{
+    ASSERT_ARGS(channel_unpack_string)
+    STRING *s;
+
+    switch (msg->type) {
+      case CHANNEL_MSG_NULL:
+        return STRINGNULL;
+      case CHANNEL_MSG_CONST_STRING:
+        return msg->u.s;
+      case CHANNEL_MSG_STRING:
+        s = Parrot_str_new_init(interp, msg->u.bytes, msg->size, msg->encoding, 0);
+        channel_discard(msg);
+        return s;
+      default:
+        return VTABLE_get_string(interp, channel_unpack_pmc(interp, msg));
+    }
+}
+
+PARROT_CANNOT_RETURN_NULL
+static PMC *
+channel_unpack_pmc(PARROT_INTERP, ARGMOD(Parrot_Channel_message *msg))
+{
+    ASSERT_ARGS(channel_unpack_pmc)
+    PMC *value;
+
+    switch (msg->type) {
+      case CHANNEL_MSG_INT:
+        return Parrot_pmc_box_integer(interp, msg->u.i);
+      case CHANNEL_MSG_NUM:
+        return Parrot_pmc_box_number(interp, msg->u.n);
+      case CHANNEL_MSG_CONST_STRING:
+      case CHANNEL_MSG_STRING:
+        return Parrot_pmc_box_string(interp, channel_unpack_string(interp, msg));
+      case CHANNEL_MSG_CHANNEL:
+        /* the message's reference moves to the new handle */
+        value = Parrot_pmc_new_noinit(interp, enum_class_Channel);
+        PObj_custom_destroy_SET(value);
+        PARROT_CHANNEL(value)->queue = msg->u.channel;
+        msg->type = CHANNEL_MSG_NULL;
+        return value;
+      case CHANNEL_MSG_FROZEN:
+        value = Parrot_thaw(interp,
+                Parrot_str_new_init(interp, msg->u.bytes, msg->size,
+                    Parrot_binary_encoding_ptr, 0));
+        channel_discard(msg);
+        return value;
+      default:
+        return PMCNULL;
+    }
+}
+#line 708 "./src/pmc/channel.c"
+static  void  Parrot_Channel_destroy(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_Channel_elements(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_Channel_get_bool(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_Channel_get_integer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Channel_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Channel_init_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL capacity);
+static  void  Parrot_Channel_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *init);
+static  void  Parrot_Channel_push_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value);
+static  void  Parrot_Channel_push_integer(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void  Parrot_Channel_push_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void  Parrot_Channel_push_string(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value);
+static  FLOATVAL  Parrot_Channel_shift_float(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_Channel_shift_integer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC  * Parrot_Channel_shift_pmc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING  * Parrot_Channel_shift_string(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Channel_nci_send(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Channel_nci_receive(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Channel_nci_try_send(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Channel_nci_try_receive(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Channel_nci_capacity(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_Channel_class_init(PARROT_INTERP, int, int);
+void    Parrot_Channel_ro_class_init(PARROT_INTERP, int, int);
+static  void 
+Parrot_Channel_destroy(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 744 "./src/pmc/channel.pmc"
+
+    Parrot_Channel * const ch = PARROT_CHANNEL(_self)->queue;
+    if (ch)
+        channel_release(ch);
+#line 739 "./src/pmc/channel.c"
+}
+static  INTVAL 
+Parrot_Channel_elements(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 767 "./src/pmc/channel.pmc"
+
+    Parrot_Channel * const ch = PARROT_CHANNEL(_self)->queue;
+    INTVAL head, tail;
+
+    PARROT_ATOMIC_INT_GET(head, ch->head);
+    PARROT_ATOMIC_INT_GET(tail, ch->tail);
+    return tail > head ? tail - head : 0;
+#line 752 "./src/pmc/channel.c"
+}
+static  INTVAL 
+Parrot_Channel_get_bool(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 780 "./src/pmc/channel.pmc"
+
+    return Parrot_Channel_elements(interp, _self) > 0;
+#line 760 "./src/pmc/channel.c"
+}
+static  INTVAL 
+Parrot_Channel_get_integer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 776 "./src/pmc/channel.pmc"
+
+    return Parrot_Channel_elements(interp, _self);
+#line 768 "./src/pmc/channel.c"
+}
+static  void 
+Parrot_Channel_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 720 "./src/pmc/channel.pmc"
+
+    Parrot_Channel_init_int(interp, _self, CHANNEL_DEFAULT_CAPACITY);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 777 "./src/pmc/channel.c"
+}
+static  void 
+Parrot_Channel_init_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL capacity)
+{
+#line 724 "./src/pmc/channel.pmc"
+
+    if (capacity < 1)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_OUT_OF_BOUNDS,
+            "Channel: capacity must be positive (%d)", capacity);
+
+    PARROT_CHANNEL(_self)->queue = channel_new(capacity);
+    PObj_custom_destroy_SET(_self);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 791 "./src/pmc/channel.c"
+}
+static  void 
+Parrot_Channel_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *init)
+{
+#line 733 "./src/pmc/channel.pmc"
+
+    if (!PMC_IS_NULL(init) && init->vtable->base_type == enum_class_Channel) {
+        Parrot_Channel * const ch = PARROT_CHANNEL(init)->queue;
+        channel_retain(ch);
+        PARROT_CHANNEL(_self)->queue = ch;
+        PObj_custom_destroy_SET(_self);
+    }
+    else
+        Parrot_Channel_init_int(interp, _self, VTABLE_get_integer(interp, init));
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 807 "./src/pmc/channel.c"
+}
+static  void 
+Parrot_Channel_push_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value)
+{
+#line 807 "./src/pmc/channel.pmc"
+
+    Parrot_Channel_message msg;
+    msg.type = CHANNEL_MSG_NUM;
+    msg.u.n  = value;
+    channel_send(PARROT_CHANNEL(_self)->queue, &msg);
+#line 818 "./src/pmc/channel.c"
+}
+static  void 
+Parrot_Channel_push_integer(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+#line 800 "./src/pmc/channel.pmc"
+
+    Parrot_Channel_message msg;
+    msg.type = CHANNEL_MSG_INT;
+    msg.u.i  = value;
+    channel_send(PARROT_CHANNEL(_self)->queue, &msg);
+#line 829 "./src/pmc/channel.c"
+}
+static  void 
+Parrot_Channel_push_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 820 "./src/pmc/channel.pmc"
+
+    Parrot_Channel_message msg;
+    channel_pack_pmc(interp, value, &msg);
+    channel_send(PARROT_CHANNEL(_self)->queue, &msg);
+#line 839 "./src/pmc/channel.c"
+}
+static  void 
+Parrot_Channel_push_string(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value)
+{
+#line 814 "./src/pmc/channel.pmc"
+
+    Parrot_Channel_message msg;
+    channel_pack_string(value, &msg);
+    channel_send(PARROT_CHANNEL(_self)->queue, &msg);
+#line 849 "./src/pmc/channel.c"
+}
+static  FLOATVAL 
+Parrot_Channel_shift_float(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 851 "./src/pmc/channel.pmc"
+
+    Parrot_Channel_message msg;
+    channel_receive(PARROT_CHANNEL(_self)->queue, &msg);
+    if (msg.type == CHANNEL_MSG_NUM)
+        return msg.u.n;
+    return VTABLE_get_number(interp, channel_unpack_pmc(interp, &msg));
+#line 861 "./src/pmc/channel.c"
+}
+static  INTVAL 
+Parrot_Channel_shift_integer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 843 "./src/pmc/channel.pmc"
+
+    Parrot_Channel_message msg;
+    channel_receive(PARROT_CHANNEL(_self)->queue, &msg);
+    if (msg.type == CHANNEL_MSG_INT)
+        return msg.u.i;
+    return VTABLE_get_integer(interp, channel_unpack_pmc(interp, &msg));
+#line 873 "./src/pmc/channel.c"
+}
+static  PMC  *
+Parrot_Channel_shift_pmc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 865 "./src/pmc/channel.pmc"
+
+    Parrot_Channel_message msg;
+    channel_receive(PARROT_CHANNEL(_self)->queue, &msg);
+    return channel_unpack_pmc(interp, &msg);
+#line 883 "./src/pmc/channel.c"
+}
+static  STRING  *
+Parrot_Channel_shift_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 859 "./src/pmc/channel.pmc"
+
+    Parrot_Channel_message msg;
+    channel_receive(PARROT_CHANNEL(_self)->queue, &msg);
+    return channel_unpack_string(interp, &msg);
+#line 893 "./src/pmc/channel.c"
+}
+static  void
+Parrot_Channel_nci_send(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* message;
+    
+    const INTVAL arity = 2; /* "PiP" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    message = VTABLE_get_pmc_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 903 "./src/pmc/channel.pmc"
+
+    Parrot_Channel_push_pmc(interp, _self, message);
+#line 918 "./src/pmc/channel.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Channel_nci_receive(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 907 "./src/pmc/channel.pmc"
+
+    PMC * const message = Parrot_Channel_shift_pmc(interp, _self);
+    #line 948 "./src/pmc/channel.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)message);
+        
+        return;
+     }
+#line 909 "./src/pmc/channel.pmc"
+
+#line 956 "./src/pmc/channel.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Channel_nci_try_send(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* message;
+    
+    const INTVAL arity = 2; /* "PiP" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    message = VTABLE_get_pmc_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 912 "./src/pmc/channel.pmc"
+
+    Parrot_Channel * const ch = PARROT_CHANNEL(_self)->queue;
+    Parrot_Channel_message msg;
+    INTVAL sent;
+
+    channel_pack_pmc(interp, message, &msg);
+    sent = channel_enqueue(ch, &msg);
+    if (sent)
+        channel_wake(ch);
+    else
+        channel_discard(&msg);
+    #line 997 "./src/pmc/channel.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)sent);
+        
+        return;
+     }
+#line 923 "./src/pmc/channel.pmc"
+
+#line 1005 "./src/pmc/channel.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Channel_nci_try_receive(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 926 "./src/pmc/channel.pmc"
+
+    Parrot_Channel * const ch = PARROT_CHANNEL(_self)->queue;
+    Parrot_Channel_message msg;
+    PMC   *message = PMCNULL;
+    INTVAL received;
+
+    received = channel_dequeue(ch, &msg);
+    if (received) {
+        channel_wake(ch);
+        message = channel_unpack_pmc(interp, &msg);
+    }
+    #line 1044 "./src/pmc/channel.c"
+    {  /*BEGIN RETURN INTVAL received, PMC *message */
+        Parrot_pcc_set_call_from_c_args(interp, _call_object,
+            "IP", (INTVAL)received, (PMC*)message);
+        
+        return;
+    }   /*END RETURN INTVAL received, PMC *message */
+#line 937 "./src/pmc/channel.pmc"
+
+#line 1053 "./src/pmc/channel.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Channel_nci_capacity(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 940 "./src/pmc/channel.pmc"
+
+    const INTVAL capacity = PARROT_CHANNEL(_self)->queue->mask + 1;
+    #line 1083 "./src/pmc/channel.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)capacity);
+        
+        return;
+     }
+#line 942 "./src/pmc/channel.pmc"
+
+#line 1091 "./src/pmc/channel.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_Channel_update_vtable(VTABLE *vt) {
+    vt->destroy = Parrot_Channel_destroy;
+    vt->elements = Parrot_Channel_elements;
+    vt->get_bool = Parrot_Channel_get_bool;
+    vt->get_integer = Parrot_Channel_get_integer;
+    vt->init = Parrot_Channel_init;
+    vt->init_int = Parrot_Channel_init_int;
+    vt->init_pmc = Parrot_Channel_init_pmc;
+    vt->push_float = Parrot_Channel_push_float;
+    vt->push_integer = Parrot_Channel_push_integer;
+    vt->push_pmc = Parrot_Channel_push_pmc;
+    vt->push_string = Parrot_Channel_push_string;
+    vt->shift_float = Parrot_Channel_shift_float;
+    vt->shift_integer = Parrot_Channel_shift_integer;
+    vt->shift_pmc = Parrot_Channel_shift_pmc;
+    vt->shift_string = Parrot_Channel_shift_string;
+    vt->attr_size = sizeof(Parrot_Channel_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_Channel_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->destroy = Parrot_Channel_destroy;
+    vt->elements = Parrot_Channel_elements;
+    vt->get_bool = Parrot_Channel_get_bool;
+    vt->get_integer = Parrot_Channel_get_integer;
+    vt->attr_size = sizeof(Parrot_Channel_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Channel_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_Channel_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Channel_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_Channel_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_Channel_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "Channel"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_Channel_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "Channel")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_Channel_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        ":queue ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_Channel_get_vtable(interp);
+        vt->base_type      = enum_class_Channel;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "Channel");
+        vt->provides_str = CONST_STRING_GEN(interp, "scalar");
+        vt->isa_hash     = Parrot_Channel_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_Channel_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_Channel;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_Channel_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "send");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Channel_nci_send),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "receive");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Channel_nci_receive),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "try_send");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Channel_nci_try_send),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "try_receive");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Channel_nci_try_receive),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "capacity");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Channel_nci_capacity),
+                method_name, signature);
+        }
+        {
+        }
+    } /* pass */
+} /* Parrot_Channel_class_init */
+
+#line 943 "./src/pmc/channel.pmc"
+
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<src/pmc/task.pmc>, F<src/thread.c>, F<docs/pdds/pdd25_concurrency.pod>.
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -0,0 +1,2957 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/class.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_fixedintegerarray.h"
+#include "pmc_class.h"
+#include "pmc_default.h"
+#include "class.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/class.pmc"
+/*
+Copyright (C) 2001-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/class.pmc - Class PMC
+
+=head1 DESCRIPTION
+
+This class implements the Class PMC, as outlined in
+F<docs/pdds/pdd15_objects.pod>.
+
+Class is not derived from any other PMC.
+
+=head2 Structure
+
+The Class PMC structure (C<Parrot_Class>) consists of twelve items:
+
+=over 4
+
+=item C<id>
+
+The type number of the PMC.
+
+=item C<name>
+
+The name of the class -- a STRING.
+An empty STRING is allocated during initialization.
+
+=item C<namespace>
+
+The namespace the class is associated with, if any.
+A Null PMC is allocated during initialization.
+
+=item C<instantiated>
+
+A flag denoting whether this class has been instantiated since last
+modification.  A native integer with value zero is allocated during
+initialization.
+
+=item C<parents>
+
+An array of immediate parent classes.
+An empty ResizablePMCArray PMC is allocated during initialization.
+
+=item C<all_parents>
+
+A cached array of ourself and all parent classes, in method resolution
+order (MRO). A ResizablePMCArray PMC is allocated during initialization,
+and is populated with the current class.
+
+=item C<roles>
+
+An array of the roles this class has been composed from.
+An empty ResizablePMCArray PMC is allocated during initialization.
+
+=item C<methods>
+
+A directory of method names and method bodies this class provides.
+An empty Hash PMC is allocated during initialization.
+
+=item C<vtable_overrides>
+
+A directory of vtable function names and method bodies this class overrides.
+An empty Hash PMC is allocated during initialization.
+
+=item C<attrib_metadata>
+
+A directory of attribute names and attribute metadata this class contains.
+An empty Hash PMC is allocated during initialization.
+
+=item C<attrib_index>
+
+A lookup table for attributes in this class and parents.
+A Null PMC is allocated during initialization.
+
+=item C<attrib_cache>
+
+A cache of visible attribute names to attribute indexes.
+A Null PMC is allocated during initialization.
+
+=item C<attrib_kinds>
+
+The kind of each attribute slot, one C<P>, C<I>, C<N> or C<S> per index in
+C<attrib_index>. An attribute whose C<type> is the string C<int>, C<num> or
+C<string> is stored unboxed in its object. NULL when every slot holds a PMC.
+
+=item C<shape>
+
+Identifies the attribute layout in C<attrib_index>. A new shape is taken
+from C<Parrot_oo_new_shape> whenever the index is rebuilt, so attribute
+slots cached per shape never refer to a stale layout. Zero until the index
+is first built.
+
+=item C<resolve_method>
+
+A list of method names the class provides used for name conflict resolution.
+An empty ResizablePMCArray PMC is allocated during initialization.
+
+=cut
+
+*/
+
+#include "parrot/oo_private.h"
+#include "pmc/pmc_object.h"
+#include "pmc/pmc_namespace.h"
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+static INTVAL attrib_kind(PARROT_INTERP, ARGIN(PMC *attrib))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void build_attrib_index(PARROT_INTERP, ARGIN(PMC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static int cache_class_attribs(PARROT_INTERP,
+    ARGIN(PMC *cur_class),
+    ARGIN(PMC *attrib_index),
+    ARGIN(PMC *cache),
+    ARGOUT(char *kinds),
+    int cur_index)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        __attribute__nonnull__(5)
+        FUNC_MODIFIES(*kinds);
+
+static void calculate_mro(PARROT_INTERP,
+    ARGIN(PMC *SELF),
+    INTVAL num_parents)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void init_class_from_hash(PARROT_INTERP,
+    ARGMOD(PMC *self),
+    ARGIN_NULLOK(PMC *info))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*self);
+
+static void initialize_parents(PARROT_INTERP,
+    ARGIN(PMC *object),
+    ARGIN(PMC *all_parents))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+static void initialize_parents_pmc(PARROT_INTERP,
+    ARGIN(PMC *object),
+    ARGIN(PMC *all_parents),
+    ARGIN(PMC *init))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4);
+
+PARROT_CANNOT_RETURN_NULL
+static STRING * make_class_name(PARROT_INTERP, ARGIN(PMC *SELF))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+#define ASSERT_ARGS_attrib_kind __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(attrib))
+#define ASSERT_ARGS_build_attrib_index __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_cache_class_attribs __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(cur_class) \
+    , PARROT_ASSERT_ARG(attrib_index) \
+    , PARROT_ASSERT_ARG(cache) \
+    , PARROT_ASSERT_ARG(kinds))
+#define ASSERT_ARGS_calculate_mro __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(SELF))
+#define ASSERT_ARGS_init_class_from_hash __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_initialize_parents __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(object) \
+    , PARROT_ASSERT_ARG(all_parents))
+#define ASSERT_ARGS_initialize_parents_pmc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(object) \
+    , PARROT_ASSERT_ARG(all_parents) \
+    , PARROT_ASSERT_ARG(init))
+#define ASSERT_ARGS_make_class_name __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(SELF))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+/*
+
+=item C<static int cache_class_attribs(PARROT_INTERP, PMC *cur_class, PMC
+*attrib_index, PMC *cache, char *kinds, int cur_index)>
+
+Create a cached map of all attributes (including those inherited from parent
+types), where the name of each attribute is mapped to an integer index into
+a storage array. The slot kind of each attribute is written to C<kinds> at
+its index.
+
+=cut
+
+*/
+
+static int
+cache_class_attribs(PARROT_INTERP,
+        ARGIN(PMC *cur_class), ARGIN(PMC *attrib_index),
+        ARGIN(PMC *cache), ARGOUT(char *kinds), int cur_index)
+{
+    ASSERT_ARGS(cache_class_attribs)
+    /* The attribute metadata hash. */
+    Parrot_Class_attributes * const class_info = PARROT_CLASS(cur_class);
+    PMC          * const attribs     = class_info->attrib_metadata;
+    PMC          * const iter        = VTABLE_get_iter(interp, attribs);
+
+    /* Build a string representing the fully qualified class name. */
+    /* Retrieve the fully qualified class name for the class. */
+    STRING       * const fq_class    = VTABLE_get_string(interp, cur_class);
+    PMC          * const class_cache = Parrot_pmc_new(interp, enum_class_Hash);
+    VTABLE_set_pmc_keyed_str(interp, cache, fq_class, class_cache);
+
+    /* Iterate over the attributes. */
+    while (VTABLE_get_bool(interp, iter)) {
+        /* Get attribute. */
+        PMC    * const cur_attrib  = VTABLE_get_pmc_keyed_str(interp,
+                attribs, VTABLE_shift_string(interp, iter));
+
+        /* Get attribute name and append it to the key. */
+        STRING * const name_str    = CONST_STRING(interp, "name");
+        STRING * const attrib_name = VTABLE_get_string_keyed_str(
+            interp, cur_attrib, name_str);
+
+        STRING * const full_key    = Parrot_str_concat(interp, fq_class, attrib_name);
+
+        /* Insert into hash, along with index. */
+        VTABLE_set_integer_keyed_str(interp, attrib_index, full_key, cur_index);
+        VTABLE_set_integer_keyed_str(interp, class_cache, attrib_name, cur_index);
+        kinds[cur_index] = (char)attrib_kind(interp, cur_attrib);
+        ++cur_index;
+    }
+
+    return cur_index;
+}
+
+/*
+
+=item C<static INTVAL attrib_kind(PARROT_INTERP, PMC *attrib)>
+
+Returns the slot kind for the attribute metadata hash C<attrib>. A C<type>
+of C<int>, C<num> or C<string> asks for a native slot; anything else,
+including no type at all, is stored as a PMC.
+
+=cut
+
+*/
+
+static INTVAL
+attrib_kind(PARROT_INTERP, ARGIN(PMC *attrib))
+{
+    ASSERT_ARGS(attrib_kind)
+    STRING * const type_str = CONST_STRING(interp, "type");
+    PMC    * const type     = VTABLE_get_pmc_keyed_str(interp, attrib, type_str);
+
+    if (!PMC_IS_NULL(type) && type->vtable->base_type == enum_class_String) {
+        STRING * const name     = VTABLE_get_string(interp, type);
+        STRING * const int_str  = CONST_STRING(interp, "int");
+        STRING * const num_str  = CONST_STRING(interp, "num");
+        STRING * const str_str  = CONST_STRING(interp, "string");
+
+        if (STRING_equal(interp, name, int_str))
+            return ATTRIB_KIND_INT;
+        if (STRING_equal(interp, name, num_str))
+            return ATTRIB_KIND_NUM;
+        if (STRING_equal(interp, name, str_str))
+            return ATTRIB_KIND_STRING;
+    }
+
+    return ATTRIB_KIND_PMC;
+}
+
+/*
+
+=item C<static void build_attrib_index(PARROT_INTERP, PMC *self)>
+
+This function builds the attribute index (table to map class name and
+attribute name to an index) for the current class.
+
+=cut
+
+*/
+
+static void
+build_attrib_index(PARROT_INTERP, ARGIN(PMC *self))
+{
+    ASSERT_ARGS(build_attrib_index)
+    Parrot_Class_attributes * const _class      = PARROT_CLASS(self);
+    int                  cur_index    = 0;
+    PMC * const          attrib_index = Parrot_pmc_new(interp, enum_class_Hash);
+    PMC * const          cache        = Parrot_pmc_new_init_int(interp,
+                                            enum_class_Hash, enum_type_INTVAL);
+    const int            num_classes  = VTABLE_elements(interp, _class->all_parents);
+    int                  num_attribs  = 0;
+    char                *kinds;
+    int                  i;
+
+    for (i = 0; i < num_classes; ++i) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp,
+                                    _class->all_parents, i);
+
+        if (PObj_is_class_TEST(cur_class))
+            num_attribs += VTABLE_elements(interp,
+                PARROT_CLASS(cur_class)->attrib_metadata);
+    }
+
+    kinds = mem_gc_allocate_n_typed(interp, num_attribs + 1, char);
+
+    /* Go over the list of all parents to construct the attribute index. */
+    for (i = 0; i < num_classes; ++i) {
+       /* Get the class and check that it respects the standard class interface
+        * (if not we don't know how it stores its attributes, so we'll have to
+        * delegate the lookup). */
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp,
+                                    _class->all_parents, i);
+
+        if (PObj_is_class_TEST(cur_class))
+            cur_index = cache_class_attribs(interp, cur_class,
+                attrib_index, cache, kinds, cur_index);
+    }
+
+    /* Store built attribute index and invalidate cache. */
+    _class->attrib_index = attrib_index;
+    _class->attrib_cache = cache;
+    _class->attrib_kinds = NULL;
+
+    for (i = 0; i < cur_index; ++i) {
+        if (kinds[i] != ATTRIB_KIND_PMC) {
+            _class->attrib_kinds = Parrot_str_new(interp, kinds, cur_index);
+            break;
+        }
+    }
+
+    mem_gc_free(interp, kinds);
+    _class->shape        = Parrot_oo_new_shape();
+
+    PARROT_GC_WRITE_BARRIER(interp, self);
+}
+
+/*
+
+=item C<static void init_class_from_hash(PARROT_INTERP, PMC *self, PMC *info)>
+
+Takes a hash and initializes the class based on it.
+
+=cut
+
+*/
+
+static void
+init_class_from_hash(PARROT_INTERP, ARGMOD(PMC *self), ARGIN_NULLOK(PMC *info))
+{
+    ASSERT_ARGS(init_class_from_hash)
+    Parrot_Class_attributes * const _class      = PARROT_CLASS(self);
+    STRING  * const name_str    = CONST_STRING(interp, "name");
+    STRING  * const parents_str = CONST_STRING(interp, "parents");
+    STRING  * const methods_str = CONST_STRING(interp, "methods");
+    STRING  * const roles_str   = CONST_STRING(interp, "roles");
+    STRING  * const attrs_str   = CONST_STRING(interp, "attributes");
+    STRING  * const resolve_method_str = CONST_STRING(interp, "resolve_method");
+    STRING  * const set_class_str = CONST_STRING(interp, "set_class");
+    PMC     *old_ns;
+
+    /* Ensure we actually have some initialization info. */
+    if (PMC_IS_NULL(info))
+        return;
+
+    /* Take a copy of the current namespace the class is attached to. */
+    old_ns = _class->_namespace;
+
+    /* Check if we have a name/namespace. */
+    if (VTABLE_exists_keyed_str(interp, info, name_str)) {
+        STRING *new_name;
+        PMC    *new_namespace;
+        PMC    *name_arg = VTABLE_get_pmc_keyed_str(interp, info, name_str);
+        VTABLE *new_vtable;
+        INTVAL type_num;
+
+        /* If we were passed a namespace PMC, set the namespace attribute
+         * directly. Otherwise, lookup or create the appropriate namespace. */
+        if (name_arg->vtable->base_type == enum_class_NameSpace) {
+            new_namespace = name_arg;
+            name_arg      = Parrot_ns_get_name(interp, new_namespace);
+            VTABLE_shift_string(interp, name_arg);
+        }
+        else {
+            PMC * const hll_ns = VTABLE_get_pmc_keyed_int(interp,
+                    interp->HLL_namespace, Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp)));
+            new_namespace = Parrot_ns_make_namespace_keyed(interp, hll_ns, name_arg);
+        }
+
+        if (PMC_IS_NULL(new_namespace))
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+                "Failed to set namespace for class.");
+
+        /* Set the name of the class to the name of the innermost namespace
+         * associated with the class.  */
+        new_name = VTABLE_get_string(interp, new_namespace);
+
+        if (STRING_IS_NULL(new_name) || STRING_IS_EMPTY(new_name))
+              Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+                "Failed to set name for class.");
+
+        _class->_namespace = new_namespace;
+        _class->name       = new_name;
+
+        /* At this point we know the class isn't anonymous */
+        CLASS_is_anon_CLEAR(self);
+
+        /* Register a type number for the class. */
+        type_num   = Parrot_oo_register_type(interp, name_arg, new_namespace);
+
+        /* Link the type number with the class's vtable. */
+        new_vtable = Parrot_vtbl_clone_vtable(interp, self->vtable);
+
+        new_vtable->base_type         = type_num;
+        new_vtable->pmc_class         = self;
+        new_vtable->whoami            = VTABLE_get_string(interp, self);
+        new_vtable->mro               = _class->all_parents;
+        new_vtable->ro_variant_vtable =
+                Parrot_vtbl_clone_vtable(interp, self->vtable->ro_variant_vtable);
+
+        /* Store the class's vtable in the global table */
+        interp->vtables[type_num]     = new_vtable;
+
+        _class->id                    = type_num;
+    }
+
+    /* If we were attached to a namespace and are now attached to a new one,
+     * need to unset ourselves in the old namespace. */
+    if (!PMC_IS_NULL(old_ns) && _class->_namespace != old_ns)
+        Parrot_pcc_invoke_method_from_c_args(interp, old_ns,
+                                             set_class_str,
+                                             "P->", PMCNULL);
+
+    /* Link namespace to this class, if there is one. */
+    if (!PMC_IS_NULL(_class->_namespace)) {
+        Parrot_pcc_invoke_method_from_c_args(interp, _class->_namespace,
+                                             set_class_str,
+                                             "P->", self);
+    }
+
+    /* Initialize resolve_method. */
+    if (VTABLE_exists_keyed_str(interp, info, resolve_method_str)) {
+        /* Set it. */
+        _class->resolve_method =
+            VTABLE_get_pmc_keyed_str(interp, info, resolve_method_str);
+    }
+
+    /* Initialize parents, if we have any. */
+    if (VTABLE_exists_keyed_str(interp, info, parents_str)) {
+        /* Loop over parents array and add them. */
+        PMC * const parent_list = VTABLE_get_pmc_keyed_str(interp, info,
+            parents_str);
+        const int  parent_count = VTABLE_elements(interp, parent_list);
+        int i;
+
+        for (i = 0; i < parent_count; ++i)
+            VTABLE_add_parent(interp, self,
+                VTABLE_get_pmc_keyed_int(interp, parent_list, i));
+    }
+
+    /* Initialize roles, if we have any. */
+    if (VTABLE_exists_keyed_str(interp, info, roles_str)) {
+        /* Loop over roles array and compose them. */
+        PMC * const role_list  = VTABLE_get_pmc_keyed_str(interp, info,
+            roles_str);
+        const int   role_count = VTABLE_elements(interp, role_list);
+        int i;
+
+        for (i = 0; i < role_count; ++i)
+            VTABLE_add_role(interp, self,
+                VTABLE_get_pmc_keyed_int(interp, role_list, i));
+    }
+
+    /* Initialize attributes, if we have any. */
+    if (VTABLE_exists_keyed_str(interp, info, attrs_str)) {
+        /* Loop over attributes array and add them. */
+        PMC * const attrs_name_list = VTABLE_get_pmc_keyed_str(interp, info,
+                                            attrs_str);
+        const int   attrib_count    = VTABLE_elements(interp, attrs_name_list);
+        int i;
+
+        for (i = 0; i < attrib_count; ++i) {
+            STRING * const attr_name = VTABLE_get_string_keyed_int(interp,
+                attrs_name_list, i);
+            VTABLE_add_attribute(interp, self, attr_name, PMCNULL);
+        }
+    }
+
+    /* Initialize methods. */
+    if (VTABLE_exists_keyed_str(interp, info, methods_str)) {
+        /* Get the methods hash. */
+        PMC * const methods = VTABLE_get_pmc_keyed_str(interp, info,
+            methods_str);
+
+        /* Iterate over the list of methods. */
+        PMC * const iter    = VTABLE_get_iter(interp, methods);
+
+        while (VTABLE_get_bool(interp, iter)) {
+            /* Add the method. */
+            STRING * const method_name = VTABLE_shift_string(interp, iter);
+            PMC    * const method_pmc  = VTABLE_get_pmc_keyed_str(interp,
+                methods, method_name);
+            VTABLE_add_method(interp, self, method_name, method_pmc);
+        }
+    }
+
+    /* Extract any methods from the namespace */
+    Parrot_oo_extract_methods_from_namespace(interp, self, _class->_namespace);
+}
+
+/*
+
+=item C<static void initialize_parents(PARROT_INTERP, PMC *object, PMC
+*all_parents)>
+
+Loop over all parents in the MRO, setting up delegate objects if necessary and
+calling C<init> vtables on them, if necessary.
+
+=cut
+
+*/
+
+static void
+initialize_parents(PARROT_INTERP, ARGIN(PMC *object), ARGIN(PMC *all_parents))
+{
+    ASSERT_ARGS(initialize_parents)
+    INTVAL  parent_index = VTABLE_elements(interp, all_parents) - 1;
+    STRING * const name  = CONST_STRING(interp, "init");
+
+    /* Loop through the parents in reverse MRO order. */
+    for (; parent_index >= 0; --parent_index) {
+        PMC *meth;
+        PMC * const parent = VTABLE_get_pmc_keyed_int(interp,
+            all_parents, parent_index);
+
+        /* PMCProxy parents store an instance to delegate to */
+        if (parent->vtable->base_type == enum_class_PMCProxy) {
+            PMC    *proxy     = VTABLE_instantiate(interp, parent, PMCNULL);
+            STRING *proxy_str = CONST_STRING(interp, "proxy");
+            VTABLE_set_attr_keyed(interp, object, parent, proxy_str, proxy);
+        }
+
+        meth = Parrot_oo_find_vtable_override_for_class(interp, parent, name);
+
+        if (!PMC_IS_NULL(meth)) {
+            /* preserve current_object */
+            Parrot_ext_call(interp, meth, "Pi->", object);
+        }
+    }
+}
+
+/*
+
+=item C<static void initialize_parents_pmc(PARROT_INTERP, PMC *object, PMC
+*all_parents, PMC *init)>
+
+Loop over all parents in the MRO, setting up delegate objects if necessary and
+calling C<init_pmc> vtables on them, if necessary.
+
+=cut
+
+*/
+
+static void
+initialize_parents_pmc(PARROT_INTERP, ARGIN(PMC *object),
+        ARGIN(PMC *all_parents), ARGIN(PMC *init))
+{
+    ASSERT_ARGS(initialize_parents_pmc)
+    INTVAL parent_index = VTABLE_elements(interp, all_parents) - 1;
+    STRING * const name  = CONST_STRING(interp, "init_pmc");
+
+    /* Loop through the parents in reverse MRO order. */
+    for (; parent_index >= 0; --parent_index) {
+        PMC *meth;
+        PMC * const parent = VTABLE_get_pmc_keyed_int(interp,
+            all_parents, parent_index);
+
+        /* PMCProxy parents store an instance to delegate to */
+        if (parent->vtable->base_type == enum_class_PMCProxy) {
+            PMC    * const proxy     = VTABLE_instantiate(interp, parent, init);
+            STRING * const proxy_str = CONST_STRING(interp, "proxy");
+            VTABLE_set_attr_keyed(interp, object, parent, proxy_str, proxy);
+        }
+
+        meth = Parrot_oo_find_vtable_override_for_class(interp, parent, name);
+
+        if (!PMC_IS_NULL(meth))
+            Parrot_ext_call(interp, meth, "PiP->", object, init);
+    }
+}
+
+/*
+
+=item C<static STRING * make_class_name(PARROT_INTERP, PMC *SELF)>
+
+This function makes and caches the name of this class, returning the string
+directly.  C<VTABLE_isa()> uses the name without copying it, for efficiency
+reasons, as it does not modify the STRING.  C<VTABLE_get_string()> makes a
+copy of the STRING, so its callers are free to modify it.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+static STRING *
+make_class_name(PARROT_INTERP, ARGIN(PMC *SELF))
+{
+    ASSERT_ARGS(make_class_name)
+    Parrot_Class_attributes * const  _class    = PARROT_CLASS(SELF);
+    PMC          * const _namespace = _class->_namespace;
+
+    if (!PMC_IS_NULL(_namespace)) {
+        if (_class->fullname)
+            return _class->fullname;
+        else {
+
+            /* Call the 'get_name' method on the class's associated
+             * namespace to retrieve a fully qualified list of names, then
+             * join the list with a semicolon.  */
+            PMC * const names = Parrot_ns_get_name(interp, _namespace);
+
+            if (!PMC_IS_NULL(names))
+                /* remove the HLL namespace name */
+                VTABLE_shift_string(interp, names);
+                PARROT_GC_WRITE_BARRIER(interp, SELF);
+                _class->fullname = Parrot_str_join(interp, CONST_STRING(interp, ";"), names);
+                return _class->fullname;
+        }
+    }
+
+    /* Otherwise, copy the stored string name of the class. */
+    return _class->name;
+}
+
+/*
+
+=item C<static void calculate_mro(PARROT_INTERP, PMC *SELF, INTVAL num_parents)>
+
+Calculates the C3 method resolution order for this class. C3 is the name of an
+algorithm used to calculate the method resolution order (MRO) to use in a
+system with multiple inheritance. For more information see the documentation
+associated with C<Parrot_ComputeMRO_C3>.
+
+=cut
+
+*/
+
+static void
+calculate_mro(PARROT_INTERP, ARGIN(PMC *SELF), INTVAL num_parents)
+{
+    ASSERT_ARGS(calculate_mro)
+    Parrot_Class_attributes  * const _class = PARROT_CLASS(SELF);
+
+    /* SELF is already on the all_parents */
+    if (num_parents == 0)
+        return;
+
+    if (num_parents == 1) {
+        STRING * const ap         = CONST_STRING(interp, "all_parents");
+        PMC    * const parent     = VTABLE_get_pmc_keyed_int(interp,
+                _class->parents, 0);
+        PMC    * const parent_mro = VTABLE_inspect_str(interp, parent, ap);
+        PMC    * const mro        = VTABLE_clone(interp, parent_mro);
+        VTABLE_unshift_pmc(interp, mro, SELF);
+        PARROT_GC_WRITE_BARRIER(interp, SELF);
+        _class->all_parents = mro;
+    }
+    else {
+        PARROT_GC_WRITE_BARRIER(interp, SELF);
+        _class->all_parents = Parrot_ComputeMRO_C3(interp, SELF);
+    }
+
+    if (!CLASS_is_anon_TEST(SELF))
+        interp->vtables[VTABLE_type(interp, SELF)]->mro = _class->all_parents;
+}
+
+/*
+
+=back
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+#line 731 "./src/pmc/class.c"
+static  void  Parrot_Class_add_attribute(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name, PMC *type);
+static  void  Parrot_Class_add_method(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name, PMC *sub);
+static  void  Parrot_Class_add_parent(PARROT_INTERP, ARGMOD(PMC *_self), PMC *parent);
+static  void  Parrot_Class_add_role(PARROT_INTERP, ARGMOD(PMC *_self), PMC *role);
+static  void  Parrot_Class_add_vtable_override(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name, PMC *sub);
+static  PMC  * Parrot_Class_clone(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC  * Parrot_Class_clone_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *args);
+static  void  Parrot_Class_destroy(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_Class_does(PARROT_INTERP, ARGMOD(PMC *_self), STRING *role_name);
+static  INTVAL  Parrot_Class_does_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *role);
+static  void  Parrot_Class_freeze(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+static  INTVAL  Parrot_Class_get_integer(SHIM_INTERP, ARGMOD(PMC *_self));
+static  STRING  * Parrot_Class_get_string(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Class_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Class_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *init_data);
+static  PMC  * Parrot_Class_inspect(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC  * Parrot_Class_inspect_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *what);
+static  PMC  * Parrot_Class_instantiate(PARROT_INTERP, ARGMOD(PMC *_self), PMC *init);
+static  INTVAL  Parrot_Class_is_equal(SHIM_INTERP, ARGMOD(PMC *_self), PMC *p);
+static  INTVAL  Parrot_Class_isa(PARROT_INTERP, ARGMOD(PMC *_self), STRING *classname);
+static  INTVAL  Parrot_Class_isa_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *lookup);
+static  void  Parrot_Class_mark(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Class_remove_attribute(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name);
+static  void  Parrot_Class_remove_method(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name);
+static  void  Parrot_Class_remove_parent(PARROT_INTERP, ARGMOD(PMC *_self), PMC *parent);
+static  void  Parrot_Class_thaw(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+static  void  Parrot_Class_thawfinish(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *info));
+static  INTVAL  Parrot_Class_type(SHIM_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Class_visit(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+static  void Parrot_Class_nci_name(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Class_nci_get_namespace(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Class_nci_resolve_method(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Class_nci_new(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Class_nci_attributes(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Class_nci_add_attribute(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Class_nci_methods(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Class_nci_add_method(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Class_nci_add_vtable_override(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Class_nci_remove_method(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Class_nci_find_method(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Class_nci_parents(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Class_nci_add_parent(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Class_nci_roles(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Class_nci_add_role(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Class_nci_inspect(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Class_nci_isa(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Class_nci_does(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Class_nci_clear_method_cache(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Class_nci_get_method_cache(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_Class_class_init(PARROT_INTERP, int, int);
+void    Parrot_Class_ro_class_init(PARROT_INTERP, int, int);
+static  void 
+Parrot_Class_add_attribute(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name, PMC *type)
+{
+#line 895 "./src/pmc/class.pmc"
+
+    Parrot_Class_attributes * const _class        = PARROT_CLASS(_self);
+    PMC          * const new_attribute = Parrot_pmc_new(interp, enum_class_Hash);
+
+    /* If we've been instantiated already, not allowed. */
+    if (_class->instantiated)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "Modifications to classes are not allowed after instantiation.");
+
+    /* If we already have an attribute of this name, it's an error. */
+    if (VTABLE_exists_keyed_str(interp, _class->attrib_metadata, name))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "Attribute '%Ss' already exists in '%Ss'.", name,
+            VTABLE_get_string(interp, _self));
+
+    /* Set name and type. */
+    VTABLE_set_string_keyed_str(interp, new_attribute, CONST_STRING(interp, "name"), name);
+
+    if (!PMC_IS_NULL(type))
+        VTABLE_set_pmc_keyed_str(interp, new_attribute, CONST_STRING(interp, "type"), type);
+
+    /* Enter the attribute in the attrib_metadata table. */
+    VTABLE_set_pmc_keyed_str(interp, _class->attrib_metadata, name,
+        new_attribute);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 812 "./src/pmc/class.c"
+}
+static  void 
+Parrot_Class_add_method(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name, PMC *sub)
+{
+#line 962 "./src/pmc/class.pmc"
+
+    Parrot_Class_attributes * const _class = PARROT_CLASS(_self);
+    PMC                     * const method =
+             VTABLE_get_pmc_keyed_str(interp, _class->methods, name);
+
+    /* If we have already added a method with this name... */
+    if (!PMC_IS_NULL(method)) {
+        if (method == sub)
+            return;
+
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "A method named '%S' already exists in class '%S'. "
+            "It may have been supplied by a role.",
+            name, VTABLE_get_string(interp, _self));
+    }
+
+    /* Enter it into the table. */
+    VTABLE_set_pmc_keyed_str(interp, _class->methods, name, sub);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 837 "./src/pmc/class.c"
+}
+static  void 
+Parrot_Class_add_parent(PARROT_INTERP, ARGMOD(PMC *_self), PMC *parent)
+{
+#line 1032 "./src/pmc/class.pmc"
+
+    Parrot_Class_attributes * const _class = PARROT_CLASS(_self);
+    int parent_count, index;
+
+    /* If we've been instantiated already, not allowed. */
+    if (_class->instantiated)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+            EXCEPTION_INVALID_OPERATION,
+            "Modifications to classes are not allowed after instantiation.");
+
+    if (PMC_IS_NULL(parent)) {
+        STRING * const me_str = make_class_name(interp, _self);
+        Parrot_ex_throw_from_c_args(interp, NULL,
+            EXCEPTION_UNEXPECTED_NULL, "Parent of '%Ss' is null", me_str);
+    }
+
+    /* Ensure it really is a class. */
+    if (!PObj_is_class_TEST(parent)) {
+        STRING * const pstr = VTABLE_get_string(interp, parent);
+        STRING * me_str = make_class_name(interp, _self);
+        Parrot_ex_throw_from_c_args(interp, NULL,
+            EXCEPTION_INVALID_OPERATION,
+            "Parent '%Ss' of '%Ss' isn't a Class.", pstr, me_str);
+    }
+
+    /* Check is not self */
+    if (parent == _self)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                EXCEPTION_INVALID_OPERATION, "Can't be own parent");
+
+    /* get number of direct parents */
+    parent_count = VTABLE_elements(interp, _class->parents);
+
+    /* iterate over all direct parents, check whether this class already has
+     * the parent being added. */
+    for (index = 0; index < parent_count; ++index) {
+        /* get the next parent */
+        PMC * const current_parent = VTABLE_get_pmc_keyed_int(interp,
+                                  _class->parents, index);
+
+        /* throw an exception if we already have this parent */
+        if (current_parent == parent)
+            Parrot_ex_throw_from_c_args(interp, NULL,
+                EXCEPTION_INVALID_OPERATION,
+                "The class '%S' already has a parent class '%S'. "
+                "It may have been supplied by a role.",
+                VTABLE_get_string(interp, _self),
+                VTABLE_get_string(interp, parent));
+    }
+
+    /* Check that none of the parents is self */
+    parent_count = VTABLE_elements(interp, PARROT_CLASS(parent)->all_parents);
+
+    for (index = 0; index < parent_count; ++index) {
+        /* get the next parent */
+        PMC * const current_parent = VTABLE_get_pmc_keyed_int(interp,
+            PARROT_CLASS(parent)->all_parents, index);
+
+        if (current_parent == _self)
+            Parrot_ex_throw_from_c_args(interp, NULL,
+                EXCEPTION_INVALID_OPERATION,
+                "Loop in class hierarchy: '%S' is an ancestor of '%S'.",
+                VTABLE_get_string(interp, _self),
+                VTABLE_get_string(interp, parent));
+    }
+
+    /* Add to the lists of our immediate parents and all parents. */
+    VTABLE_push_pmc(interp, _class->parents, parent);
+    Parrot_hash_put(interp, _class->isa_cache, (void *)parent, (void *)1);
+    calculate_mro(interp, _self, parent_count + 1);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 914 "./src/pmc/class.c"
+}
+static  void 
+Parrot_Class_add_role(PARROT_INTERP, ARGMOD(PMC *_self), PMC *role)
+{
+#line 1162 "./src/pmc/class.pmc"
+
+    const Parrot_Class_attributes * const _class = PARROT_CLASS(_self);
+
+    /* Do the composition. */
+    Parrot_ComposeRole(interp, role,
+        _class->resolve_method, !PMC_IS_NULL(_class->resolve_method),
+       PMCNULL, 0, _class->methods, _class->roles);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 928 "./src/pmc/class.c"
+}
+static  void 
+Parrot_Class_add_vtable_override(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name, PMC *sub)
+{
+#line 1010 "./src/pmc/class.pmc"
+
+    Parrot_Class_attributes * const _class = PARROT_CLASS(_self);
+
+    /* Check that the name is actually valid as a vtable override */
+    if (Parrot_get_vtable_index(interp, name) == -1)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+            EXCEPTION_METHOD_NOT_FOUND,
+            "'%S' is not a valid vtable function name.", name);
+
+    /* Add it to vtable list. */
+    VTABLE_set_pmc_keyed_str(interp, _class->vtable_overrides, name, sub);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 946 "./src/pmc/class.c"
+}
+static  PMC  *
+Parrot_Class_clone(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 1333 "./src/pmc/class.pmc"
+
+    Parrot_Class_attributes * const _class    = PARROT_CLASS(_self);
+
+    /* Create the new class PMC, of the same type of this one (we may
+     * have been subclassed). */
+    PMC          * const copy      = interp->vtables[enum_class_default]->clone(interp, _self);
+
+    /* Clone parents, roles, methods, attributes and resolve data. We do
+     * not copy name/namespace related stuff (need anonymous clone) or
+     * stuff that gets computed on the first instantiation. */
+
+    Parrot_Class_attributes * const new_class = PARROT_CLASS(copy);
+
+    new_class->name                = CONST_STRING(interp, "");
+    new_class->_namespace          = PMCNULL;
+    new_class->parents             = VTABLE_clone(interp, _class->parents);
+    new_class->roles               = VTABLE_clone(interp, _class->roles);
+    new_class->methods             = VTABLE_clone(interp, _class->methods);
+    new_class->vtable_overrides    = VTABLE_clone(interp,
+                                        _class->vtable_overrides);
+    new_class->parent_overrides    = VTABLE_clone(interp,
+                                        _class->parent_overrides);
+    new_class->attrib_metadata     = VTABLE_clone(interp,
+                                        _class->attrib_metadata);
+    new_class->resolve_method      = VTABLE_clone(interp,
+                                        _class->resolve_method);
+
+    /* Return cloned class. */
+    return copy;
+#line 981 "./src/pmc/class.c"
+}
+static  PMC  *
+Parrot_Class_clone_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *args)
+{
+#line 1377 "./src/pmc/class.pmc"
+
+    /* Do the standard clone. */
+    PMC * const copy = VTABLE_clone(interp, _self);
+
+    init_class_from_hash(interp, copy, args);
+
+    return copy;
+#line 994 "./src/pmc/class.c"
+}
+static  void 
+Parrot_Class_destroy(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 831 "./src/pmc/class.pmc"
+
+    Parrot_Class_attributes * const _class = PARROT_CLASS(_self);
+    Parrot_hash_destroy(interp, _class->isa_cache);
+#line 1003 "./src/pmc/class.c"
+}
+static  INTVAL 
+Parrot_Class_does(PARROT_INTERP, ARGMOD(PMC *_self), STRING *role_name)
+{
+#line 1626 "./src/pmc/class.pmc"
+
+    Parrot_Class_attributes * const _class    = PARROT_CLASS(_self);
+    PMC          * const role_list = _class->roles;
+    INTVAL i, count;
+
+    if (!role_list)
+        return 0;
+
+    count = VTABLE_elements(interp, role_list);
+
+    for (i = 0; i < count; ++i) {
+        PMC * const role = VTABLE_get_pmc_keyed_int(interp, role_list, i);
+
+        if (VTABLE_does(interp, role, role_name))
+            return 1;
+    }
+
+    /* Iterate over all the parents and check if they respond true
+     * for 'does' on the original comparison. */
+    count = VTABLE_elements(interp, _class->parents);
+
+    for (i = 0; i < count; ++i) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp,
+                _class->parents, i);
+
+        if (VTABLE_does(interp, cur_class, role_name))
+            return 1;
+    }
+
+    return VTABLE_isa(interp, _self, role_name);
+#line 1039 "./src/pmc/class.c"
+}
+static  INTVAL 
+Parrot_Class_does_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *role)
+{
+#line 1667 "./src/pmc/class.pmc"
+
+    Parrot_Class_attributes * const _class    = PARROT_CLASS(_self);
+    PMC * const role_list          = _class->roles;
+    INTVAL i, role_count, count;
+
+    if (!role_list)
+        return 0;
+
+    role_count = VTABLE_elements(interp, role_list);
+
+    for (i = 0; i < role_count; ++i) {
+        PMC    * const test_role = VTABLE_get_pmc_keyed_int(interp, role_list, i);
+        if (VTABLE_does_pmc(interp, test_role, role))
+            return 1;
+    }
+
+    /* Iterate over all the parents and check if they respond true
+     * for 'does' on the original comparison. */
+    count = VTABLE_elements(interp, _class->parents);
+
+    for (i = 0; i < count; ++i) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp,
+                _class->parents, i);
+
+        if (VTABLE_does_pmc(interp, cur_class, role))
+            return 1;
+    }
+
+    return VTABLE_isa_pmc(interp, _self, role);
+#line 1074 "./src/pmc/class.c"
+}
+static  void 
+Parrot_Class_freeze(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 1761 "./src/pmc/class.pmc"
+
+    Parrot_Class_attributes * const class_data = PARROT_CLASS(_self);
+    STRING       *serial_namespace = CONST_STRING(interp, "");
+
+    /* 1) freeze class id */
+    VTABLE_push_integer(interp, info, class_data->id);
+
+    /* 2) freeze class name */
+    VTABLE_push_string(interp, info, class_data->name);
+
+    /* 3) serialize namespace name, including HLL */
+    if (!PMC_IS_NULL(class_data->_namespace)) {
+        PMC * const names = Parrot_ns_get_name(interp,
+                class_data->_namespace);
+        if (!PMC_IS_NULL(names))
+            serial_namespace = Parrot_str_join(interp, CONST_STRING(interp, ";"), names);
+    }
+    VTABLE_push_string(interp, info, serial_namespace);
+    /* PARROT_GC_WRITE_BARRIER(interp, info); */
+#line 1099 "./src/pmc/class.c"
+}
+static  INTVAL 
+Parrot_Class_get_integer(SHIM_INTERP, ARGMOD(PMC *_self))
+{
+#line 1844 "./src/pmc/class.pmc"
+    return PARROT_CLASS(_self)->id;
+#line 1106 "./src/pmc/class.c"
+}
+static  STRING  *
+Parrot_Class_get_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 846 "./src/pmc/class.pmc"
+
+    return make_class_name(interp, _self);
+#line 1114 "./src/pmc/class.c"
+}
+static  void 
+Parrot_Class_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 748 "./src/pmc/class.pmc"
+
+    Parrot_Class_attributes * const _class =
+            (Parrot_Class_attributes *) PMC_data(_self);
+
+    /* Set flag for custom GC mark. */
+    PObj_custom_mark_destroy_SETALL(_self);
+
+    /* Set up the object. */
+    _class->name            = CONST_STRING(interp, "");
+    _class->_namespace      = PMCNULL;
+    _class->parents         = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+    _class->all_parents     = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+    _class->roles           = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+    _class->methods         = Parrot_pmc_new(interp, enum_class_Hash);
+    _class->attrib_metadata = Parrot_pmc_new(interp, enum_class_Hash);
+    _class->attrib_index    = PMCNULL;
+    _class->attrib_cache    = PMCNULL;
+    _class->meth_cache      = PMCNULL;
+    _class->resolve_method  = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+
+    _class->vtable_overrides = Parrot_pmc_new(interp, enum_class_Hash);
+    _class->parent_overrides = Parrot_pmc_new(interp, enum_class_Hash);
+
+    _class->isa_cache        = Parrot_hash_create(interp,
+        enum_type_INTVAL, Hash_key_type_PMC_ptr);
+
+
+    /* We put ourself on the all parents list. */
+    VTABLE_push_pmc(interp, _class->all_parents, _self);
+
+    /* We are a class. */
+    PObj_is_class_SET(_self);
+
+    /* By default we're anonymous. */
+    CLASS_is_anon_SET(_self);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 1156 "./src/pmc/class.c"
+}
+static  void 
+Parrot_Class_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *init_data)
+{
+#line 785 "./src/pmc/class.pmc"
+
+    PMC           *arg;
+    const INTVAL   arg_type = VTABLE_type(interp, init_data);
+    STRING * const name_str = CONST_STRING(interp, "name");
+
+    /* Set up the object. */
+    VTABLE_init(interp, _self);
+
+    /* fast attempt to determine init_data type */
+    switch (arg_type) {
+      case enum_class_String:
+      case enum_class_Key:
+      case enum_class_ResizableStringArray:
+      case enum_class_NameSpace:
+        /* set only the name property */
+        arg = Parrot_pmc_new(interp, enum_class_Hash);
+        VTABLE_set_pmc_keyed_str(interp, arg, name_str, init_data);
+        break;
+
+      case enum_class_Hash:
+        arg = init_data;
+        break;
+
+        /* slow attempt to determine init_data type */
+      default:
+        if (VTABLE_isa(interp, init_data, CONST_STRING(interp, "String"))
+         || VTABLE_isa(interp, init_data, CONST_STRING(interp, "Key"))
+         || VTABLE_isa(interp, init_data, CONST_STRING(interp, "ResizableStringArray"))) {
+            /* set only the name property */
+            arg = Parrot_pmc_new(interp, enum_class_Hash);
+            VTABLE_set_pmc_keyed_str(interp, arg, name_str, init_data);
+        }
+
+        if (VTABLE_isa(interp, init_data, CONST_STRING(interp, "Hash")))
+            arg = init_data;
+        else
+            Parrot_ex_throw_from_c_args(interp, NULL,
+                    EXCEPTION_INVALID_OPERATION,
+                        "Invalid class name key in init_pmc for Class");
+        break;
+    }
+
+    /* Initialize the class with the supplied data. */
+    init_class_from_hash(interp, _self, arg);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 1207 "./src/pmc/class.c"
+}
+static  PMC  *
+Parrot_Class_inspect(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 1286 "./src/pmc/class.pmc"
+
+    /* Create a hash, then use inspect_str to get all of the data to
+     * fill it up with. */
+    PMC    * const metadata    = Parrot_pmc_new(interp, enum_class_Hash);
+    STRING * const name_str    = CONST_STRING(interp, "name");
+    STRING * const ns_str      = CONST_STRING(interp, "namespace");
+    STRING * const attrs_str   = CONST_STRING(interp, "attributes");
+    STRING * const meths_str   = CONST_STRING(interp, "methods");
+    STRING * const parents_str = CONST_STRING(interp, "parents");
+    STRING * const roles_str   = CONST_STRING(interp, "roles");
+    STRING * const flags_str   = CONST_STRING(interp, "flags");
+
+    VTABLE_set_pmc_keyed_str(interp, metadata, name_str,
+        VTABLE_inspect_str(interp, _self, name_str));
+
+    VTABLE_set_pmc_keyed_str(interp, metadata, ns_str,
+        VTABLE_inspect_str(interp, _self, ns_str));
+
+    VTABLE_set_pmc_keyed_str(interp, metadata, attrs_str,
+        VTABLE_inspect_str(interp, _self, attrs_str));
+
+    VTABLE_set_pmc_keyed_str(interp, metadata, meths_str,
+        VTABLE_inspect_str(interp, _self, meths_str));
+
+    VTABLE_set_pmc_keyed_str(interp, metadata, parents_str,
+        VTABLE_inspect_str(interp, _self, parents_str));
+
+    VTABLE_set_pmc_keyed_str(interp, metadata, roles_str,
+        VTABLE_inspect_str(interp, _self, roles_str));
+
+    VTABLE_set_pmc_keyed_str(interp, metadata, flags_str,
+        VTABLE_inspect_str(interp, _self, flags_str));
+
+    return metadata;
+#line 1247 "./src/pmc/class.c"
+}
+static  PMC  *
+Parrot_Class_inspect_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *what)
+{
+#line 1211 "./src/pmc/class.pmc"
+
+    Parrot_Class_attributes * const _class = PARROT_CLASS(_self);
+
+    /* What should we return? */
+    PMC *found;
+
+    if (STRING_equal(interp, what, CONST_STRING(interp, "attributes"))) {
+        found = _class->attrib_metadata;
+    }
+    else if (STRING_equal(interp, what, CONST_STRING(interp, "parents"))) {
+        found = _class->parents;
+    }
+    else if (STRING_equal(interp, what, CONST_STRING(interp, "name"))) {
+        found = Parrot_pmc_new(interp, enum_class_String);
+        VTABLE_set_string_native(interp, found, _class->name);
+    }
+    else if (STRING_equal(interp, what, CONST_STRING(interp, "id"))) {
+        found = Parrot_pmc_new_init_int(interp, enum_class_Integer, _class->id);
+    }
+    else if (STRING_equal(interp, what, CONST_STRING(interp, "namespace"))) {
+        /* Should not clone this. */
+        return _class->_namespace;
+    }
+    else if (STRING_equal(interp, what, CONST_STRING(interp, "attrib_index"))) {
+        found = _class->attrib_index;
+    }
+    else if (STRING_equal(interp, what, CONST_STRING(interp, "methods"))) {
+        found = _class->methods;
+    }
+    else if (STRING_equal(interp, what, CONST_STRING(interp, "vtable_overrides"))) {
+        found = _class->vtable_overrides;
+    }
+    else if (STRING_equal(interp, what, CONST_STRING(interp, "all_parents"))) {
+        found = _class->all_parents;
+    }
+    else if (STRING_equal(interp, what, CONST_STRING(interp, "roles"))) {
+        found = _class->roles;
+    }
+    else if (STRING_equal(interp, what, CONST_STRING(interp, "flags"))) {
+        found = Parrot_pmc_new_init_int(interp, enum_class_Integer,
+            (INTVAL)PObj_get_FLAGS(_self));
+    }
+    else
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "Unknown introspection value '%S'", what);
+
+    /* return found value */
+    if (PMC_IS_NULL(found))
+        return PMCNULL;
+
+    if (found->vtable->base_type == enum_class_Hash) {
+        /* for Hash return values, create and return a shallow
+         * clone because the VTABLE_clone does a deep clone */
+        PMC * const hash = Parrot_pmc_new(interp, enum_class_Hash);
+        Hash       *src  = (Hash *)VTABLE_get_pointer(interp, found);
+        Hash       *dest = (Hash *)VTABLE_get_pointer(interp, hash);
+
+        Parrot_hash_clone_prunable(interp, src, dest, 0);
+
+        return hash;
+    }
+
+    return VTABLE_clone(interp, found);
+#line 1316 "./src/pmc/class.c"
+}
+static  PMC  *
+Parrot_Class_instantiate(PARROT_INTERP, ARGMOD(PMC *_self), PMC *init)
+{
+#line 1396 "./src/pmc/class.pmc"
+
+    Parrot_Class_attributes  * const _class = PARROT_CLASS(_self);
+    PMC                      *object;
+
+    /* If we've not been instantiated before... */
+    if (!_class->instantiated) {
+        /* Check that we have all methods listed in resolve list. */
+        const int resolve_count  = VTABLE_elements(interp,
+                                                   _class->resolve_method);
+        const INTVAL cur_hll     = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp));
+        const INTVAL num_parents = VTABLE_elements(interp, _class->parents);
+        INTVAL       mro_length;
+        int          i;
+
+        /* don't use HLL mappings for internal-only data */
+        Parrot_pcc_set_HLL(interp, CURRENT_CONTEXT(interp), 0);
+
+        for (i = 0; i < resolve_count; ++i) {
+            STRING * const check_meth =
+                VTABLE_get_string_keyed_int(interp, _class->resolve_method, i);
+            if (!VTABLE_exists_keyed_str(interp, _class->methods, check_meth))
+                Parrot_ex_throw_from_c_args(interp, NULL,
+                    EXCEPTION_METHOD_NOT_FOUND, "The method '%S' was named "
+                    "in the resolve list, but not supplied", check_meth);
+        }
+
+        /* Build full parents list. */
+        calculate_mro(interp, _self, num_parents);
+        build_attrib_index(interp, _self);
+
+        if (PMC_IS_NULL(_class->attrib_index)) {
+            return PMCNULL;
+        }
+
+        /* See if we have any parents from other universes and if so set a
+         * flag stating so. */
+        mro_length = VTABLE_elements(interp, _class->all_parents);
+
+        for (i = 0; i < mro_length; ++i) {
+            PMC * const class_check = VTABLE_get_pmc_keyed_int(interp,
+                _class->all_parents, i);
+            if (class_check->vtable->base_type != enum_class_Class) {
+                /* Found one; that's enough. */
+                CLASS_has_alien_parents_SET(_self);
+                break;
+            }
+        }
+
+        Parrot_pcc_set_HLL(interp, CURRENT_CONTEXT(interp), cur_hll);
+    }
+
+    /* Set instantiated flag. */
+    _class->instantiated = 1;
+
+    /* Create object. */
+    object = Parrot_pmc_new_noinit(interp, enum_class_Object);
+
+    /* Set custom GC mark and destroy on the object. */
+    PObj_custom_mark_destroy_SETALL(object);
+
+    /* Flag that it is an object */
+    PObj_is_object_SET(object);
+
+    /* Initialize the object's underlying structure, pointing it to this
+     * class. */
+    /* TODO: this has been changed in order to use auto_attrs in the
+     * Object PMC. Needs to be redone in a cleaner way. */
+    {
+        Parrot_Object_attributes * const objattr =
+            PMC_data_typed(object, Parrot_Object_attributes *);
+        objattr->_class       = _self;
+        Parrot_oo_alloc_attrib_store(interp, object,
+                VTABLE_elements(interp, _class->attrib_index),
+                _class->attrib_kinds);
+        PARROT_GC_WRITE_BARRIER(interp, object);
+    }
+
+    if (!PMC_IS_NULL(init)) {
+        /* Initialize attributes with the supplied values. */
+        PMC * const iter = VTABLE_get_iter(interp, init);
+
+        while (VTABLE_get_bool(interp, iter)) {
+            STRING * const name  = VTABLE_shift_string(interp, iter);
+            PMC    * const value = VTABLE_get_pmc_keyed_str(interp, init,
+                                        name);
+
+            /* Set the attribute. */
+            VTABLE_set_attr_str(interp, object, name, value);
+        }
+
+        /* Check for overrides on the init_pmc vtable function */
+        initialize_parents_pmc(interp, object, _class->all_parents, init);
+    }
+    else
+        /* Check for overrides on the init vtable function */
+        initialize_parents(interp, object, _class->all_parents);
+
+    return object;
+#line 1420 "./src/pmc/class.c"
+}
+static  INTVAL 
+Parrot_Class_is_equal(SHIM_INTERP, ARGMOD(PMC *_self), PMC *p)
+{
+#line 1698 "./src/pmc/class.pmc"
+    return p == _self;
+#line 1427 "./src/pmc/class.c"
+}
+static  INTVAL 
+Parrot_Class_isa(PARROT_INTERP, ARGMOD(PMC *_self), STRING *classname)
+{
+#line 1585 "./src/pmc/class.pmc"
+
+    PMC *want_class;
+
+    /* hard-code this one exception right away */
+    if (STRING_equal(interp, classname, CONST_STRING(interp, "Class")))
+        return 1;
+
+    want_class = Parrot_oo_get_class_str(interp, classname);
+
+    if (PMC_IS_NULL(want_class))
+        return 0;
+
+    if (_self == want_class)
+        return 1;
+    else {
+        Parrot_Class_attributes * const _class = PARROT_CLASS(_self);
+
+        const INTVAL num_classes = VTABLE_elements(interp, _class->all_parents);
+        int i;
+
+        for (i = 1; i < num_classes; ++i) {
+            PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp,
+                                        _class->all_parents, i);
+
+            if (VTABLE_is_same(interp, want_class, cur_class))
+                return 1;
+        }
+    }
+
+    return 0;
+#line 1463 "./src/pmc/class.c"
+}
+static  INTVAL 
+Parrot_Class_isa_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *lookup)
+{
+#line 1507 "./src/pmc/class.pmc"
+
+    Parrot_Class_attributes * const _class = PARROT_CLASS(_self);
+    PMC          *classobj;
+    HashBucket   *b;
+    INTVAL        i, num_classes, retval = 0;
+
+    if (PMC_IS_NULL(lookup))
+        return 0;
+
+    if (PObj_is_class_TEST(lookup)) {
+        if (lookup == _self)
+            return 1;
+        else
+            classobj = lookup;
+    }
+    else
+        classobj = Parrot_oo_get_class(interp, lookup);
+
+    if (PMC_IS_NULL(classobj))
+        return 0;
+
+    /* Check if the class object is the same as self's class object */
+    if (VTABLE_is_same(interp, _self, classobj))
+        goto found;
+
+    if (_class->instantiated) {
+        b = Parrot_hash_get_bucket(interp, _class->isa_cache,
+             (void *)classobj);
+        if (b)
+            return (INTVAL)b->value;
+    }
+
+    /* this is effectively what the default PMC's isa_pmc does
+     * ... but this can cheat and avoid COW STRINGs for the classobj
+     * only in these two, very specific and common cases */
+    if (classobj->vtable->base_type == enum_class_Class
+    ||  classobj->vtable->base_type == enum_class_PMCProxy) {
+        STRING *classname = make_class_name(interp, classobj);
+        PARROT_ASSERT(_self->vtable->isa_hash);
+        if (Parrot_hash_exists(interp, _self->vtable->isa_hash, classname))
+            goto found;
+    }
+
+    /* Iterate over all the parents and check if they respond true
+     * for 'isa' on the original comparison. */
+    num_classes = VTABLE_elements(interp, _class->parents);
+
+    for (i = 0; i < num_classes; ++i) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp,
+                _class->parents, i);
+
+        if (VTABLE_isa_pmc(interp, cur_class, lookup))
+            goto found;
+    }
+
+cache_and_return:
+    if (_class->instantiated) {
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        Parrot_hash_put(interp, _class->isa_cache, (void *)classobj,
+             (void *)retval);
+    }
+    return retval;
+
+found:
+    retval = 1;
+    goto cache_and_return;
+#line 1535 "./src/pmc/class.c"
+}
+static  void 
+Parrot_Class_mark(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 860 "./src/pmc/class.pmc"
+
+    Parrot_Class_attributes * const _class = PARROT_CLASS(_self);
+    Parrot_gc_mark_STRING_alive(interp, _class->name);
+    Parrot_gc_mark_STRING_alive(interp, _class->fullname);
+    Parrot_gc_mark_PMC_alive(interp, _class->_namespace);
+    Parrot_gc_mark_PMC_alive(interp, _class->parents);
+    Parrot_gc_mark_PMC_alive(interp, _class->all_parents);
+    Parrot_gc_mark_PMC_alive(interp, _class->roles);
+    Parrot_gc_mark_PMC_alive(interp, _class->methods);
+    Parrot_gc_mark_PMC_alive(interp, _class->vtable_overrides);
+    Parrot_gc_mark_PMC_alive(interp, _class->parent_overrides);
+    Parrot_gc_mark_PMC_alive(interp, _class->attrib_metadata);
+    Parrot_gc_mark_PMC_alive(interp, _class->attrib_index);
+    Parrot_gc_mark_PMC_alive(interp, _class->attrib_cache);
+    Parrot_gc_mark_STRING_alive(interp, _class->attrib_kinds);
+    Parrot_gc_mark_PMC_alive(interp, _class->resolve_method);
+    Parrot_gc_mark_PMC_alive(interp, _class->meth_cache);
+    if (_class->isa_cache)
+        Parrot_hash_mark(interp, _class->isa_cache);
+#line 1560 "./src/pmc/class.c"
+}
+static  void 
+Parrot_Class_remove_attribute(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name)
+{
+#line 933 "./src/pmc/class.pmc"
+
+    Parrot_Class_attributes * const _class        = PARROT_CLASS(_self);
+
+    /* If we've been instantiated already, not allowed. */
+    if (_class->instantiated)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "Modifications to classes are not allowed after instantiation.");
+
+    /* If we don't have an attribute of this name, it's an error. */
+    if (!VTABLE_exists_keyed_str(interp, _class->attrib_metadata, name))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "Attribute '%Ss' cannot be removed, does not exist in '%Ss'.", name,
+            VTABLE_get_string(interp, _self));
+
+    /* Remove the attribute from the attrib_metadata table. */
+    VTABLE_delete_keyed_str(interp, _class->attrib_metadata, name);
+
+    build_attrib_index(interp, _self); /* calls WB */
+#line 1584 "./src/pmc/class.c"
+}
+static  void 
+Parrot_Class_remove_method(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name)
+{
+#line 991 "./src/pmc/class.pmc"
+
+    Parrot_Class_attributes * const _class = PARROT_CLASS(_self);
+    if (VTABLE_exists_keyed_str(interp, _class->methods, name))
+        VTABLE_delete_keyed_str(interp, _class->methods, name);
+    else
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "No method named '%S' to remove in class '%S'.",
+            name, VTABLE_get_string(interp, _self));
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 1599 "./src/pmc/class.c"
+}
+static  void 
+Parrot_Class_remove_parent(PARROT_INTERP, ARGMOD(PMC *_self), PMC *parent)
+{
+#line 1115 "./src/pmc/class.pmc"
+
+    Parrot_Class_attributes * const _class = PARROT_CLASS(_self);
+    int parent_count, index;
+
+    /* If we've been instantiated already, not allowed. */
+    if (_class->instantiated)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+            EXCEPTION_INVALID_OPERATION,
+            "Modifications to classes are not allowed after instantiation.");
+
+    /* Ensure it really is a class. */
+    if (!PObj_is_class_TEST(parent))
+        Parrot_ex_throw_from_c_args(interp, NULL,
+            EXCEPTION_INVALID_OPERATION, "Parent isn't a Class.");
+
+    /* get number of direct parents */
+    parent_count = VTABLE_elements(interp, _class->parents);
+
+    /* iterate over all direct parents, looking for the parent to remove */
+    for (index = 0; index < parent_count; ++index) {
+        /* get the next parent */
+        PMC * const current_parent = VTABLE_get_pmc_keyed_int(interp,
+                                  _class->parents, index);
+        if (current_parent == parent)
+            break;
+    }
+
+    if (index >= parent_count)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+            EXCEPTION_INVALID_OPERATION,
+            "Can't remove_parent: is not a parent.");
+
+    VTABLE_delete_keyed_int(interp, _class->parents, index);
+    Parrot_hash_put(interp, _class->isa_cache, (void *)parent, (void *)0);
+    calculate_mro(interp, _self, parent_count - 1);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 1641 "./src/pmc/class.c"
+}
+static  void 
+Parrot_Class_thaw(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 1792 "./src/pmc/class.pmc"
+
+    /* The class might already exist in the interpreter, so create it as an
+     * anonymous class and later decide whether to link it into the
+     * namespace.  */
+
+    /* 1) thaw class id */
+    const INTVAL id = VTABLE_shift_integer(interp, info);
+
+    /* 2) thaw class name */
+    STRING * const name = VTABLE_shift_string(interp, info);
+
+    /* 3) deserialize namespace name, including HLL */
+    STRING * const serial_namespace = VTABLE_shift_string(interp, info);
+    STRING * const semicolon_str = CONST_STRING(interp, ";");
+    PMC    * const namespace_array =
+        Parrot_str_split(interp, semicolon_str, serial_namespace);
+    PMC *ns = Parrot_ns_get_namespace_keyed(interp,
+            interp->root_namespace, namespace_array);
+
+    /* If the namespace doesn't exist, we create it, and initialize
+     * ourselves in it */
+    if (PMC_IS_NULL(ns)) {
+        ns = Parrot_ns_make_namespace_keyed(interp,
+                interp->root_namespace, namespace_array);
+        VTABLE_init_pmc(interp, _self, ns);
+    }
+    /* If the namespace exists already, we point to it, but otherwise
+     * act as an anonymous class. */
+    else {
+        VTABLE_init(interp, _self);
+        PARROT_CLASS(_self)->_namespace = ns;
+    }
+
+    /* Set the class's short name to the frozen name */
+    PARROT_CLASS(_self)->name = name;
+
+    /* Set the class's id the frozen id */
+    PARROT_CLASS(_self)->id = id;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 1686 "./src/pmc/class.c"
+}
+static  void 
+Parrot_Class_thawfinish(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *info))
+{
+#line 1859 "./src/pmc/class.pmc"
+
+    Parrot_Class_attributes * const _class = PARROT_CLASS(_self);
+
+    /* Recalculate full MRO from thawed parents */
+    _class->all_parents         = Parrot_ComputeMRO_C3(interp, _self);
+    _class->parent_overrides    = Parrot_pmc_new(interp, enum_class_Hash);
+
+    /* Rebuild attribute index from thawed attribute metadata */
+    build_attrib_index(interp, _self); /* calls PARROT_GC_WRITE_BARRIER */
+#line 1701 "./src/pmc/class.c"
+}
+static  INTVAL 
+Parrot_Class_type(SHIM_INTERP, ARGMOD(PMC *_self))
+{
+#line 1713 "./src/pmc/class.pmc"
+
+    Parrot_Class_attributes * const _class = PARROT_CLASS(_self);
+    return _class->id;
+#line 1710 "./src/pmc/class.c"
+}
+static  void 
+Parrot_Class_visit(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 1731 "./src/pmc/class.pmc"
+
+    /* 1) visit the attribute description hash */
+    VISIT_PMC_ATTR(interp, info, _self, Class, attrib_metadata);
+
+    /* 2) visit list of parents */
+    VISIT_PMC_ATTR(interp, info, _self, Class, parents);
+
+    /* 3) visit list of roles */
+    VISIT_PMC_ATTR(interp, info, _self, Class, roles);
+
+    /* 4) visit hash of methods */
+    VISIT_PMC_ATTR(interp, info, _self, Class, methods);
+
+    /* 5) visit hash of vtable overrides */
+    VISIT_PMC_ATTR(interp, info, _self, Class, vtable_overrides);
+
+    /* 6) visit list of resolve methods */
+    VISIT_PMC_ATTR(interp, info, _self, Class, resolve_method);
+#line 1734 "./src/pmc/class.c"
+}
+static  void
+Parrot_Class_nci_name(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* name;
+    INTVAL has_name;
+    
+    const INTVAL arity = 1; /* "PiSoIp" */
+    const INTVAL arity_opt  = 1;
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count < arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too few arguments: %d passed, %d expected",
+                                    param_count, arity);
+    if (param_count > arity + arity_opt)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too many arguments: %d passed, %d expected",
+                                    param_count, arity + arity_opt);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    if (param_count > 1) {
+        name = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+        has_name = 1;
+    }
+    else {
+        name = STRINGNULL;
+        has_name = 0;
+    }
+
+    { /* BEGIN PMETHOD BODY */
+#line 1886 "./src/pmc/class.pmc"
+
+    Parrot_Class_attributes * const _class = PARROT_CLASS(_self);
+    STRING *ret_name;
+
+    if (has_name) {
+        /* We'll build a hash just containing the name, then give this to
+         * init_class_from_hash - saves some code duplication. */
+        PMC    * const naming_hash = Parrot_pmc_new(interp, enum_class_Hash);
+        STRING * const name_str    = CONST_STRING(interp, "name");
+
+        VTABLE_set_string_keyed_str(interp, naming_hash, name_str, name);
+        init_class_from_hash(interp, _self, naming_hash);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+    }
+
+    ret_name = _class->name;
+    #line 1787 "./src/pmc/class.c"
+     {
+        VTABLE_set_string_keyed_int(interp, _call_object, 0, (STRING*)ret_name);
+        
+        return;
+     }
+#line 1902 "./src/pmc/class.pmc"
+
+#line 1795 "./src/pmc/class.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Class_nci_get_namespace(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* _namespace;
+    INTVAL has_name;
+    
+    const INTVAL arity = 1; /* "PiPoIp" */
+    const INTVAL arity_opt  = 1;
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count < arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too few arguments: %d passed, %d expected",
+                                    param_count, arity);
+    if (param_count > arity + arity_opt)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too many arguments: %d passed, %d expected",
+                                    param_count, arity + arity_opt);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    if (param_count > 1) {
+        _namespace = VTABLE_get_pmc_keyed_int(interp, _call_object, 1);
+        has_name = 1;
+    }
+    else {
+        _namespace = PMCNULL;
+        has_name = 0;
+    }
+
+    { /* BEGIN PMETHOD BODY */
+#line 1914 "./src/pmc/class.pmc"
+
+    Parrot_Class_attributes * const _class        = PARROT_CLASS(_self);
+    PMC          * const ret_namespace = _class->_namespace;
+    UNUSED(_namespace);
+    UNUSED(has_name);
+    #line 1844 "./src/pmc/class.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)ret_namespace);
+        
+        return;
+     }
+#line 1919 "./src/pmc/class.pmc"
+
+#line 1852 "./src/pmc/class.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Class_nci_resolve_method(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* resolve_list;
+    INTVAL has_list;
+    
+    const INTVAL arity = 1; /* "PiPoIp" */
+    const INTVAL arity_opt  = 1;
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count < arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too few arguments: %d passed, %d expected",
+                                    param_count, arity);
+    if (param_count > arity + arity_opt)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too many arguments: %d passed, %d expected",
+                                    param_count, arity + arity_opt);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    if (param_count > 1) {
+        resolve_list = VTABLE_get_pmc_keyed_int(interp, _call_object, 1);
+        has_list = 1;
+    }
+    else {
+        resolve_list = PMCNULL;
+        has_list = 0;
+    }
+
+    { /* BEGIN PMETHOD BODY */
+#line 1932 "./src/pmc/class.pmc"
+
+    Parrot_Class_attributes * const _class   = PARROT_CLASS(_self);
+    PMC *ret_list;
+
+    /* Store list. */
+    if (has_list) {
+        _class->resolve_method = resolve_list;
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+    }
+
+    ret_list = _class->resolve_method;
+    #line 1907 "./src/pmc/class.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)ret_list);
+        
+        return;
+     }
+#line 1943 "./src/pmc/class.pmc"
+
+#line 1915 "./src/pmc/class.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Class_nci_new(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* args;
+    
+    Parrot_pcc_fill_params_from_c_args(interp, _call_object, "PiPns",
+        &_self, &args);
+
+    { /* BEGIN PMETHOD BODY */
+#line 1956 "./src/pmc/class.pmc"
+
+    /* Check if any arguments are in the slurpy hash, don't pass an empty
+     * hash to instantiate */
+    PMC * const obj =
+        VTABLE_elements(interp, args) > 0
+            ? VTABLE_instantiate(interp, _self, args)
+            : VTABLE_instantiate(interp, _self, PMCNULL);
+
+    #line 1946 "./src/pmc/class.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)obj);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return;
+     }
+#line 1964 "./src/pmc/class.pmc"
+
+#line 1954 "./src/pmc/class.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Class_nci_attributes(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 1977 "./src/pmc/class.pmc"
+
+    STRING * const attr_str            = CONST_STRING(interp, "attributes");
+    PMC    * const ret_attrib_metadata = _self->vtable->inspect_str(interp, _self, attr_str);
+
+    #line 1986 "./src/pmc/class.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)ret_attrib_metadata);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return;
+     }
+#line 1981 "./src/pmc/class.pmc"
+
+#line 1994 "./src/pmc/class.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Class_nci_add_attribute(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* attribute_name;
+    PMC* attribute_type;
+    INTVAL has_type;
+    
+    const INTVAL arity = 2; /* "PiSPoIp" */
+    const INTVAL arity_opt  = 1;
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count < arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too few arguments: %d passed, %d expected",
+                                    param_count, arity);
+    if (param_count > arity + arity_opt)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too many arguments: %d passed, %d expected",
+                                    param_count, arity + arity_opt);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    attribute_name = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+    if (param_count > 2) {
+        attribute_type = VTABLE_get_pmc_keyed_int(interp, _call_object, 2);
+        has_type = 1;
+    }
+    else {
+        attribute_type = PMCNULL;
+        has_type = 0;
+    }
+
+    { /* BEGIN PMETHOD BODY */
+#line 1994 "./src/pmc/class.pmc"
+
+    PMC * const type = has_type ? attribute_type : PMCNULL;
+    _self->vtable->add_attribute(interp, _self, attribute_name, type);
+#line 2043 "./src/pmc/class.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Class_nci_methods(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 2008 "./src/pmc/class.pmc"
+
+    PMC * const ret_methods = _self->vtable->inspect_str(interp, _self, CONST_STRING(interp, "methods"));
+
+    #line 2074 "./src/pmc/class.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)ret_methods);
+        
+        return;
+     }
+#line 2011 "./src/pmc/class.pmc"
+
+#line 2082 "./src/pmc/class.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Class_nci_add_method(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* name;
+    PMC* sub;
+    
+    const INTVAL arity = 3; /* "PiSP" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    name = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+    sub = VTABLE_get_pmc_keyed_int(interp, _call_object, 2);
+
+    { /* BEGIN PMETHOD BODY */
+#line 2024 "./src/pmc/class.pmc"
+
+    _self->vtable->add_method(interp, _self, name, sub);
+#line 2116 "./src/pmc/class.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Class_nci_add_vtable_override(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* name;
+    PMC* sub;
+    
+    const INTVAL arity = 3; /* "PiSP" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    name = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+    sub = VTABLE_get_pmc_keyed_int(interp, _call_object, 2);
+
+    { /* BEGIN PMETHOD BODY */
+#line 2038 "./src/pmc/class.pmc"
+
+    VTABLE_add_vtable_override(interp, _self, name, sub);
+#line 2150 "./src/pmc/class.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Class_nci_remove_method(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* name;
+    
+    const INTVAL arity = 2; /* "PiS" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    name = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 2051 "./src/pmc/class.pmc"
+
+    VTABLE_remove_method(interp, _self, name);
+#line 2182 "./src/pmc/class.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Class_nci_find_method(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* name;
+    
+    const INTVAL arity = 2; /* "PiS" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    name = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 2065 "./src/pmc/class.pmc"
+
+    Parrot_Class_attributes * const  _class    = PARROT_CLASS(_self);
+    int i;
+
+    /* Walk and search. One day, we'll use the cache first. */
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+
+    for (i = 0; i < num_classes; ++i) {
+        /* Get the class and see if it has the method. */
+        PMC * const cur_class =
+            VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        const Parrot_Class_attributes * const class_info = PARROT_CLASS(cur_class);
+
+        /* Found it! */
+        if (VTABLE_exists_keyed_str(interp, class_info->methods, name)) {
+            PMC * const ret = VTABLE_get_pmc_keyed_str(interp, class_info->methods, name);
+            #line 2228 "./src/pmc/class.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)ret);
+        
+        return;
+     }
+#line 2081 "./src/pmc/class.pmc"
+
+        }
+    }
+
+    #line 2239 "./src/pmc/class.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)PMCNULL);
+        
+        return;
+     }
+#line 2085 "./src/pmc/class.pmc"
+
+#line 2247 "./src/pmc/class.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Class_nci_parents(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 2097 "./src/pmc/class.pmc"
+
+    PMC * const ret_parents = _self->vtable->inspect_str(interp, _self, CONST_STRING(interp, "parents"));
+
+    #line 2278 "./src/pmc/class.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)ret_parents);
+        
+        return;
+     }
+#line 2100 "./src/pmc/class.pmc"
+
+#line 2286 "./src/pmc/class.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Class_nci_add_parent(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* parent;
+    
+    const INTVAL arity = 2; /* "PiP" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    parent = VTABLE_get_pmc_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 2112 "./src/pmc/class.pmc"
+
+    _self->vtable->add_parent(interp, _self, parent);
+#line 2318 "./src/pmc/class.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Class_nci_roles(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 2125 "./src/pmc/class.pmc"
+
+    PMC * const ret_roles = _self->vtable->inspect_str(interp, _self, CONST_STRING(interp, "roles"));
+
+    #line 2349 "./src/pmc/class.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)ret_roles);
+        
+        return;
+     }
+#line 2128 "./src/pmc/class.pmc"
+
+#line 2357 "./src/pmc/class.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Class_nci_add_role(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* role;
+    STRING* _param_name_str_exclude_method = CONST_STRING_GEN(interp, "exclude_method");
+    PMC* exclude_method;
+    INTVAL has_exclude_method;
+    STRING* _param_name_str_alias_method = CONST_STRING_GEN(interp, "alias_method");
+    PMC* alias_method;
+    INTVAL has_alias_method;
+    
+    Parrot_pcc_fill_params_from_c_args(interp, _call_object, "PiPSnPoIpSnPoIp",
+        &_self, &role, &_param_name_str_exclude_method, &exclude_method, &has_exclude_method, &_param_name_str_alias_method, &alias_method, &has_alias_method);
+
+    { /* BEGIN PMETHOD BODY */
+#line 2145 "./src/pmc/class.pmc"
+
+
+    Parrot_Class_attributes * const _class = PARROT_CLASS(_self);
+
+    /* Add everything on the resolve list to the exclude list; if we have
+     * no exclude list, pass along the resolve list in its place if it has
+     * any methods listed in it. */
+    if (!has_exclude_method) {
+        if (VTABLE_elements(interp, _class->resolve_method) != 0) {
+            exclude_method     = _class->resolve_method;
+            has_exclude_method = 1;
+        }
+    }
+    else {
+        const int resolve_count = VTABLE_elements(interp, _class->resolve_method);
+        int i;
+
+        for (i = 0; i < resolve_count; ++i) {
+            STRING * const meth_name = VTABLE_get_string_keyed_int(interp,
+                _class->resolve_method, i);
+            VTABLE_push_string(interp, exclude_method, meth_name);
+        }
+    }
+
+    /* Do the composition. */
+    Parrot_ComposeRole(interp, role, exclude_method, has_exclude_method,
+                       alias_method, has_alias_method,
+                       _class->methods, _class->roles);
+#line 2414 "./src/pmc/class.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Class_nci_inspect(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* what;
+    INTVAL has_what;
+    
+    const INTVAL arity = 1; /* "PiSoIp" */
+    const INTVAL arity_opt  = 1;
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count < arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too few arguments: %d passed, %d expected",
+                                    param_count, arity);
+    if (param_count > arity + arity_opt)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too many arguments: %d passed, %d expected",
+                                    param_count, arity + arity_opt);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    if (param_count > 1) {
+        what = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+        has_what = 1;
+    }
+    else {
+        what = STRINGNULL;
+        has_what = 0;
+    }
+
+    { /* BEGIN PMETHOD BODY */
+#line 2185 "./src/pmc/class.pmc"
+
+    PMC *found;
+
+    /* Just delegate to the appropriate vtable. */
+    if (has_what)
+        found = _self->vtable->inspect_str(interp, _self, what);
+    else
+        found = _self->vtable->inspect(interp, _self);
+
+    #line 2467 "./src/pmc/class.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)found);
+        
+        return;
+     }
+#line 2194 "./src/pmc/class.pmc"
+
+#line 2475 "./src/pmc/class.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Class_nci_isa(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* class_name;
+    
+    const INTVAL arity = 2; /* "PiS" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    class_name = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 2207 "./src/pmc/class.pmc"
+
+    const INTVAL isa = _self->vtable->isa(interp, _self, class_name);
+
+    #line 2508 "./src/pmc/class.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)isa);
+        
+        return;
+     }
+#line 2210 "./src/pmc/class.pmc"
+
+#line 2516 "./src/pmc/class.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Class_nci_does(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* role_name;
+    
+    const INTVAL arity = 2; /* "PiS" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    role_name = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 2223 "./src/pmc/class.pmc"
+
+    const INTVAL does = VTABLE_does(interp, _self, role_name);
+    #line 2548 "./src/pmc/class.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)does);
+        
+        return;
+     }
+#line 2225 "./src/pmc/class.pmc"
+
+#line 2556 "./src/pmc/class.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Class_nci_clear_method_cache(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 2228 "./src/pmc/class.pmc"
+
+    Parrot_Class_attributes * const attrs = PARROT_CLASS(_self);
+    PMC * const cache = attrs->meth_cache;
+    if (cache)
+        attrs->meth_cache = PMCNULL;
+#line 2589 "./src/pmc/class.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Class_nci_get_method_cache(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 2235 "./src/pmc/class.pmc"
+
+    Parrot_Class_attributes * const attrs = PARROT_CLASS(_self);
+    PMC * cache = attrs->meth_cache;
+    if (!cache) {
+        cache = Parrot_pmc_new(interp, enum_class_Hash);
+        attrs->meth_cache = cache;
+    }
+    #line 2624 "./src/pmc/class.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)cache);
+        
+        return;
+     }
+#line 2242 "./src/pmc/class.pmc"
+
+#line 2632 "./src/pmc/class.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_Class_update_vtable(VTABLE *vt) {
+    vt->add_attribute = Parrot_Class_add_attribute;
+    vt->add_method = Parrot_Class_add_method;
+    vt->add_parent = Parrot_Class_add_parent;
+    vt->add_role = Parrot_Class_add_role;
+    vt->add_vtable_override = Parrot_Class_add_vtable_override;
+    vt->clone = Parrot_Class_clone;
+    vt->clone_pmc = Parrot_Class_clone_pmc;
+    vt->destroy = Parrot_Class_destroy;
+    vt->does = Parrot_Class_does;
+    vt->does_pmc = Parrot_Class_does_pmc;
+    vt->freeze = Parrot_Class_freeze;
+    vt->get_integer = Parrot_Class_get_integer;
+    vt->get_string = Parrot_Class_get_string;
+    vt->init = Parrot_Class_init;
+    vt->init_pmc = Parrot_Class_init_pmc;
+    vt->inspect = Parrot_Class_inspect;
+    vt->inspect_str = Parrot_Class_inspect_str;
+    vt->instantiate = Parrot_Class_instantiate;
+    vt->is_equal = Parrot_Class_is_equal;
+    vt->isa = Parrot_Class_isa;
+    vt->isa_pmc = Parrot_Class_isa_pmc;
+    vt->mark = Parrot_Class_mark;
+    vt->remove_attribute = Parrot_Class_remove_attribute;
+    vt->remove_method = Parrot_Class_remove_method;
+    vt->remove_parent = Parrot_Class_remove_parent;
+    vt->thaw = Parrot_Class_thaw;
+    vt->thawfinish = Parrot_Class_thawfinish;
+    vt->type = Parrot_Class_type;
+    vt->visit = Parrot_Class_visit;
+    vt->attr_size = sizeof(Parrot_Class_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_Class_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->clone = Parrot_Class_clone;
+    vt->clone_pmc = Parrot_Class_clone_pmc;
+    vt->destroy = Parrot_Class_destroy;
+    vt->does = Parrot_Class_does;
+    vt->does_pmc = Parrot_Class_does_pmc;
+    vt->freeze = Parrot_Class_freeze;
+    vt->get_integer = Parrot_Class_get_integer;
+    vt->get_string = Parrot_Class_get_string;
+    vt->inspect = Parrot_Class_inspect;
+    vt->inspect_str = Parrot_Class_inspect_str;
+    vt->instantiate = Parrot_Class_instantiate;
+    vt->is_equal = Parrot_Class_is_equal;
+    vt->isa = Parrot_Class_isa;
+    vt->isa_pmc = Parrot_Class_isa_pmc;
+    vt->mark = Parrot_Class_mark;
+    vt->type = Parrot_Class_type;
+    vt->visit = Parrot_Class_visit;
+    vt->attr_size = sizeof(Parrot_Class_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Class_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_Class_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Class_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_Class_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_Class_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "Class"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_Class_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "Class")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_Class_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "Iid Sname Sfullname F_namespace Iinstantiated Fparents Fall_parents Froles Fmethods Fvtable_overrides Fattrib_metadata Fattrib_index Fattrib_cache Sattrib_kinds :shape Fresolve_method Fparent_overrides Fmeth_cache :isa_cache ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_Class_get_vtable(interp);
+        vt->base_type      = enum_class_Class;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "Class");
+        vt->provides_str = CONST_STRING_GEN(interp, "scalar");
+        vt->isa_hash     = Parrot_Class_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_Class_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_Class;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_Class_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "name");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Class_nci_name),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "get_namespace");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Class_nci_get_namespace),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "resolve_method");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Class_nci_resolve_method),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "new");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Class_nci_new),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "attributes");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Class_nci_attributes),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "add_attribute");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Class_nci_add_attribute),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "methods");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Class_nci_methods),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "add_method");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Class_nci_add_method),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "add_vtable_override");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Class_nci_add_vtable_override),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "remove_method");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Class_nci_remove_method),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "find_method");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Class_nci_find_method),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "parents");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Class_nci_parents),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "add_parent");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Class_nci_add_parent),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "roles");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Class_nci_roles),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "add_role");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Class_nci_add_role),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "inspect");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Class_nci_inspect),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "isa");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Class_nci_isa),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "does");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Class_nci_does),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "clear_method_cache");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Class_nci_clear_method_cache),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "get_method_cache");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Class_nci_get_method_cache),
+                method_name, signature);
+        }
+        {
+        }
+    } /* pass */
+} /* Parrot_Class_class_init */
+
+#line 2244 "./src/pmc/class.pmc"
+ /* END pmclass */
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<docs/pdds/pdd15_objects.pod>.
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -0,0 +1,2586 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/default.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_default.h"
+#include "pmc_default.h"
+#include "default.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/default.pmc"
+/*
+Copyright (C) 2001-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/default.pmc - default PMC
+
+=head1 DESCRIPTION
+
+These are the vtable functions for the default PMC class, the abstract
+root class.
+
+All methods which are not defined here get a default implementation
+generated from F<src/vtable.tbl> by F<tools/build/pmc2c.pl>.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+#define INT2KEY(i, k) Parrot_key_new_integer((i), (k))
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static STRING * caller(PARROT_INTERP, ARGIN_NULLOK(PMC *pmc))
+        __attribute__nonnull__(1);
+
+PARROT_DOES_NOT_RETURN
+static void cant_do_method(PARROT_INTERP, ARGIN_NULLOK(PMC *pmc), int index)
+        __attribute__nonnull__(1);
+
+PARROT_DOES_NOT_RETURN
+static void cant_do_write_method(PARROT_INTERP,
+    ARGIN_NULLOK(PMC *pmc),
+    int index)
+        __attribute__nonnull__(1);
+
+#define ASSERT_ARGS_caller __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_cant_do_method __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_cant_do_write_method __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+/*
+
+=item C<static STRING * caller(PARROT_INTERP, PMC *pmc)>
+
+Returns a C string for the name of C<*pmc>.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static STRING *
+caller(PARROT_INTERP, ARGIN_NULLOK(PMC *pmc))
+{
+    ASSERT_ARGS(caller)
+
+    return !PMC_IS_NULL(pmc) && pmc->vtable && pmc->vtable->whoami
+                ? VTABLE_name(interp, pmc)
+                : CONST_STRING(interp, "(null)");
+}
+
+/*
+
+=item C<static void cant_do_method(PARROT_INTERP, PMC *pmc, int index)>
+
+Throws an exception "$methname() not implemented in class '$class'", used by
+all unimplemented messages.
+
+=cut
+
+*/
+
+PARROT_DOES_NOT_RETURN
+static void
+cant_do_method(PARROT_INTERP, ARGIN_NULLOK(PMC *pmc), int index)
+{
+    ASSERT_ARGS(cant_do_method)
+
+    Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_ILL_INHERIT,
+            "%s() not implemented in class '%Ss'",
+            Parrot_get_vtable_name(interp, index),
+            caller(interp, pmc));
+}
+
+
+/*
+
+=item C<static void cant_do_write_method(PARROT_INTERP, PMC *pmc, int index)>
+
+Throws an exception "$methname() on read-only instance of '$class'", used by
+all updating messages on read-only instances.
+
+=cut
+
+*/
+
+PARROT_DOES_NOT_RETURN
+static void
+cant_do_write_method(PARROT_INTERP, ARGIN_NULLOK(PMC *pmc), int index)
+{
+    ASSERT_ARGS(cant_do_write_method)
+
+    Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_WRITE_TO_CONSTCLASS,
+            "%s() in read-only instance of '%Ss'",
+            Parrot_get_vtable_name(interp, index),
+            caller(interp, pmc));
+}
+#line 144 "./src/pmc/default.c"
+static  PMC * Parrot_default_absolute(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *dest));
+static  PMC  * Parrot_default_add(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest);
+static  void  Parrot_default_add_attribute(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *name), SHIM(PMC *type));
+static  PMC  * Parrot_default_add_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest);
+static  PMC  * Parrot_default_add_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest);
+static  void  Parrot_default_add_method(PARROT_INTERP, ARGMOD(PMC *_self), STRING *method_name, PMC *sub_pmc);
+static  void  Parrot_default_add_parent(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *parent));
+static  void Parrot_default_add_role(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *role));
+static  void Parrot_default_add_vtable_override(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *vtable_name), SHIM(PMC *sub_pmc));
+static  void  Parrot_default_assign_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void  Parrot_default_assign_string_native(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value);
+static  PMC*  Parrot_default_clone(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC * Parrot_default_clone_pmc(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *args));
+static  INTVAL  Parrot_default_cmp(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  INTVAL  Parrot_default_cmp_num(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  PMC  * Parrot_default_cmp_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  INTVAL  Parrot_default_cmp_string(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  PMC  * Parrot_default_concatenate(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest);
+static  PMC  * Parrot_default_concatenate_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value, PMC *dest);
+static  void Parrot_default_decrement(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_default_defined(SHIM_INTERP, SHIM(PMC *_self));
+static  INTVAL Parrot_default_defined_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key));
+static  INTVAL  Parrot_default_defined_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  INTVAL Parrot_default_defined_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key));
+static  void Parrot_default_delete_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key));
+static  void  Parrot_default_delete_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  void Parrot_default_delete_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key));
+static  void  Parrot_default_destroy(SHIM_INTERP, SHIM(PMC *_self));
+static  PMC  * Parrot_default_divide(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest);
+static  PMC  * Parrot_default_divide_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest);
+static  PMC  * Parrot_default_divide_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest);
+static  INTVAL  Parrot_default_does(PARROT_INTERP, ARGMOD(PMC *_self), STRING *interface_name);
+static  INTVAL  Parrot_default_does_pmc(SHIM_INTERP, SHIM(PMC *_self), SHIM(PMC *role));
+static  INTVAL Parrot_default_elements(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL Parrot_default_exists_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key));
+static  INTVAL  Parrot_default_exists_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  INTVAL Parrot_default_exists_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key));
+static  PMC  * Parrot_default_find_method(PARROT_INTERP, ARGMOD(PMC *_self), STRING *method_name);
+static  PMC  * Parrot_default_floor_divide(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest);
+static  PMC  * Parrot_default_floor_divide_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest);
+static  PMC  * Parrot_default_floor_divide_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest);
+static  void  Parrot_default_freeze(SHIM_INTERP, SHIM(PMC *_self), SHIM(PMC *info));
+static  PMC  * Parrot_default_get_attr_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key), STRING *name);
+static  PMC * Parrot_default_get_attr_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *idx));
+static  INTVAL Parrot_default_get_bool(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC  * Parrot_default_get_class(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL Parrot_default_get_integer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL Parrot_default_get_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key));
+static  INTVAL  Parrot_default_get_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  INTVAL Parrot_default_get_integer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key));
+static  PMC * Parrot_default_get_iter(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC  * Parrot_default_get_namespace(PARROT_INTERP, ARGMOD(PMC *_self));
+static  FLOATVAL Parrot_default_get_number(PARROT_INTERP, ARGMOD(PMC *_self));
+static  FLOATVAL Parrot_default_get_number_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key));
+static  FLOATVAL  Parrot_default_get_number_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  FLOATVAL Parrot_default_get_number_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key));
+static  PMC * Parrot_default_get_pmc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC * Parrot_default_get_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key));
+static  PMC  * Parrot_default_get_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  PMC * Parrot_default_get_pmc_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key));
+static  void * Parrot_default_get_pointer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void * Parrot_default_get_pointer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key));
+static  void * Parrot_default_get_pointer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL key));
+static  void * Parrot_default_get_pointer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key));
+static  STRING * Parrot_default_get_repr(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING * Parrot_default_get_string(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING * Parrot_default_get_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key));
+static  STRING  * Parrot_default_get_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  STRING * Parrot_default_get_string_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key));
+static  INTVAL  Parrot_default_hashvalue(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_default_i_absolute(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_default_i_add(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void  Parrot_default_i_add_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value);
+static  void  Parrot_default_i_add_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void  Parrot_default_i_concatenate(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void  Parrot_default_i_concatenate_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value);
+static  void  Parrot_default_i_divide(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void  Parrot_default_i_divide_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value);
+static  void  Parrot_default_i_divide_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void  Parrot_default_i_floor_divide(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void  Parrot_default_i_floor_divide_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value);
+static  void  Parrot_default_i_floor_divide_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void  Parrot_default_i_modulus(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void  Parrot_default_i_modulus_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value);
+static  void  Parrot_default_i_modulus_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void  Parrot_default_i_multiply(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void  Parrot_default_i_multiply_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value);
+static  void  Parrot_default_i_multiply_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void Parrot_default_i_neg(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_default_i_repeat(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void  Parrot_default_i_repeat_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void  Parrot_default_i_subtract(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void  Parrot_default_i_subtract_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value);
+static  void  Parrot_default_i_subtract_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void Parrot_default_increment(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_default_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_default_init_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL initvalue);
+static  void  Parrot_default_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *initializer);
+static  PMC  * Parrot_default_inspect(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC  * Parrot_default_inspect_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name);
+static  PMC  * Parrot_default_instantiate(PARROT_INTERP, ARGMOD(PMC *_self), PMC *init);
+static  opcode_t * Parrot_default_invoke(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(void *next));
+static  INTVAL  Parrot_default_is_equal(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  INTVAL  Parrot_default_is_equal_num(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  INTVAL  Parrot_default_is_equal_string(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  INTVAL  Parrot_default_is_same(SHIM_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  INTVAL  Parrot_default_isa(PARROT_INTERP, ARGMOD(PMC *_self), STRING *_class);
+static  INTVAL  Parrot_default_isa_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *lookup);
+static  void  Parrot_default_mark(PARROT_INTERP, SHIM(PMC *_self));
+static  PMC  * Parrot_default_modulus(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest);
+static  PMC  * Parrot_default_modulus_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest);
+static  PMC  * Parrot_default_modulus_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest);
+static  void  Parrot_default_morph(PARROT_INTERP, ARGMOD(PMC *_self), PMC *type);
+static  PMC  * Parrot_default_multiply(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest);
+static  PMC  * Parrot_default_multiply_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest);
+static  PMC  * Parrot_default_multiply_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest);
+static  STRING  * Parrot_default_name(SHIM_INTERP, ARGMOD(PMC *_self));
+static  PMC * Parrot_default_neg(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *dest));
+static  FLOATVAL Parrot_default_pop_float(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL Parrot_default_pop_integer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC * Parrot_default_pop_pmc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING * Parrot_default_pop_string(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_default_push_float(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(FLOATVAL value));
+static  void Parrot_default_push_integer(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL value));
+static  void Parrot_default_push_pmc(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value));
+static  void Parrot_default_push_string(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *value));
+static  void Parrot_default_remove_attribute(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *name));
+static  void Parrot_default_remove_method(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *method_name));
+static  void Parrot_default_remove_parent(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *parent));
+static  void Parrot_default_remove_role(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *role));
+static  void Parrot_default_remove_vtable_override(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *vtable_name));
+static  PMC  * Parrot_default_repeat(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest);
+static  PMC  * Parrot_default_repeat_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest);
+static  void  Parrot_default_set_attr_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key), STRING *name, PMC *value);
+static  void Parrot_default_set_attr_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *idx), SHIM(PMC *value));
+static  void Parrot_default_set_bool(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL value));
+static  void Parrot_default_set_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key), SHIM(INTVAL value));
+static  void  Parrot_default_set_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, INTVAL value);
+static  void Parrot_default_set_integer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key), SHIM(INTVAL value));
+static  void Parrot_default_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL value));
+static  void Parrot_default_set_number_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key), SHIM(FLOATVAL value));
+static  void  Parrot_default_set_number_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, FLOATVAL value);
+static  void Parrot_default_set_number_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key), SHIM(FLOATVAL value));
+static  void Parrot_default_set_number_native(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(FLOATVAL value));
+static  void Parrot_default_set_pmc(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value));
+static  void Parrot_default_set_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key), SHIM(PMC *value));
+static  void  Parrot_default_set_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, PMC *value);
+static  void Parrot_default_set_pmc_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key), SHIM(PMC *value));
+static  void Parrot_default_set_pointer(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(void *value));
+static  void Parrot_default_set_pointer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key), SHIM(void *value));
+static  void Parrot_default_set_pointer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL key), SHIM(void *value));
+static  void Parrot_default_set_pointer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key), SHIM(void *value));
+static  void Parrot_default_set_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key), SHIM(STRING *value));
+static  void  Parrot_default_set_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, STRING *string);
+static  void Parrot_default_set_string_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key), SHIM(STRING *value));
+static  void Parrot_default_set_string_native(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *value));
+static  void Parrot_default_share(PARROT_INTERP, ARGMOD(PMC *_self));
+static  FLOATVAL Parrot_default_shift_float(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL Parrot_default_shift_integer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC * Parrot_default_shift_pmc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING * Parrot_default_shift_string(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_default_splice(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value), SHIM(INTVAL offset), SHIM(INTVAL count));
+static  STRING * Parrot_default_substr(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL offset), SHIM(INTVAL length));
+static  PMC  * Parrot_default_subtract(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest);
+static  PMC  * Parrot_default_subtract_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest);
+static  PMC  * Parrot_default_subtract_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest);
+static  void  Parrot_default_thaw(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *info));
+static  void  Parrot_default_thawfinish(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+static  INTVAL  Parrot_default_type(SHIM_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_default_unshift_float(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(FLOATVAL value));
+static  void Parrot_default_unshift_integer(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL value));
+static  void Parrot_default_unshift_pmc(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value));
+static  void Parrot_default_unshift_string(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *value));
+static  void  Parrot_default_visit(SHIM_INTERP, SHIM(PMC *_self), SHIM(PMC *info));
+void    Parrot_default_class_init(PARROT_INTERP, int, int);
+static  PMC *
+Parrot_default_absolute(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *dest))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_ABSOLUTE);
+}
+static  PMC  *
+Parrot_default_add(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest)
+{
+#line 932 "./src/pmc/default.pmc"
+
+    PMC *result = PMCNULL;
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "add", "PPP->P", _self, value, dest, &result);
+    return result;
+#line 334 "./src/pmc/default.c"
+}
+static  void 
+Parrot_default_add_attribute(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *name), SHIM(PMC *type))
+{
+#line 280 "./src/pmc/default.pmc"
+    /**/UNUSED(_self)
+    Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+        "Cannot add attribute to non-class");
+#line 343 "./src/pmc/default.c"
+}
+static  PMC  *
+Parrot_default_add_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest)
+{
+#line 966 "./src/pmc/default.pmc"
+
+    dest = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+
+    VTABLE_set_number_native(interp, dest,
+            VTABLE_get_number(interp, _self) + value);
+    return dest;
+#line 355 "./src/pmc/default.c"
+}
+static  PMC  *
+Parrot_default_add_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest)
+{
+#line 949 "./src/pmc/default.pmc"
+
+    PMC *result = PMCNULL;
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "add_int", "PIP->P", _self, value, dest, &result);
+    return result;
+#line 366 "./src/pmc/default.c"
+}
+static  void 
+Parrot_default_add_method(PARROT_INTERP, ARGMOD(PMC *_self), STRING *method_name, PMC *sub_pmc)
+{
+#line 325 "./src/pmc/default.pmc"
+
+    VTABLE_set_pmc_keyed_str(interp, _self->vtable->_namespace,
+                             method_name, sub_pmc);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 376 "./src/pmc/default.c"
+}
+static  void 
+Parrot_default_add_parent(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *parent))
+{
+#line 832 "./src/pmc/default.pmc"
+    if (!PObj_is_class_TEST(_self))
+        Parrot_ex_throw_from_c_args(interp, NULL, 1,
+            "Only classes can be subclassed");
+
+    Parrot_ex_throw_from_c_args(interp, NULL, 1,
+            "All classes should override add_parent");
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 389 "./src/pmc/default.c"
+}
+static  void
+Parrot_default_add_role(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *role))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_ADD_ROLE);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_default_add_vtable_override(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *vtable_name), SHIM(PMC *sub_pmc))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_ADD_VTABLE_OVERRIDE);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void 
+Parrot_default_assign_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 422 "./src/pmc/default.pmc"
+
+    STRING * const undef = CONST_STRING(interp, "Undef");
+
+    if (VTABLE_isa(interp, value, undef))
+    {
+        Parrot_pmc_reuse(interp, _self, value->vtable->base_type, 0);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+    }
+    else
+        VTABLE_set_pmc(interp, _self, value);
+#line 417 "./src/pmc/default.c"
+}
+static  void 
+Parrot_default_assign_string_native(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value)
+{
+#line 434 "./src/pmc/default.pmc"
+
+    VTABLE_set_string_native(interp, _self, value);
+#line 425 "./src/pmc/default.c"
+}
+static  PMC* 
+Parrot_default_clone(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 868 "./src/pmc/default.pmc"
+
+    return Parrot_thaw(interp, Parrot_freeze(interp, _self));
+#line 433 "./src/pmc/default.c"
+}
+static  PMC *
+Parrot_default_clone_pmc(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *args))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_CLONE_PMC);
+}
+static  INTVAL 
+Parrot_default_cmp(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 1509 "./src/pmc/default.pmc"
+
+    INTVAL retval;
+
+    /* Don't multidispatch if you've got two pointers to the same PMC. They
+     * are equal. */
+    if (_self == value)
+        return 0;
+
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "cmp", "PP->I", _self, value, &retval);
+
+    return retval;
+#line 456 "./src/pmc/default.c"
+}
+static  INTVAL 
+Parrot_default_cmp_num(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 1533 "./src/pmc/default.pmc"
+
+    INTVAL retval;
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "cmp_num", "PP->I", _self, value, &retval);
+
+    return retval;
+#line 468 "./src/pmc/default.c"
+}
+static  PMC  *
+Parrot_default_cmp_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 1569 "./src/pmc/default.pmc"
+
+    PMC *retval;
+
+    /* Don't multidispatch if you've got two pointers to the same PMC. They
+     * are equal. */
+    if (_self == value)
+        return NULL;
+
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "cmp_pmc", "PP->P", _self, value, &retval);
+
+    return retval;
+#line 486 "./src/pmc/default.c"
+}
+static  INTVAL 
+Parrot_default_cmp_string(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 1551 "./src/pmc/default.pmc"
+
+    INTVAL retval;
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "cmp_string", "PP->I", _self, value, &retval);
+
+    return retval;
+#line 498 "./src/pmc/default.c"
+}
+static  PMC  *
+Parrot_default_concatenate(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest)
+{
+#line 1593 "./src/pmc/default.pmc"
+
+    PMC *result = PMCNULL;
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "concatenate", "PPP->P", _self, value, dest, &result);
+    return result;
+#line 509 "./src/pmc/default.c"
+}
+static  PMC  *
+Parrot_default_concatenate_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value, PMC *dest)
+{
+#line 1610 "./src/pmc/default.pmc"
+
+    PMC *result = PMCNULL;
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "concatenate_str", "PSP->P", _self, value, dest, &result);
+    return result;
+#line 520 "./src/pmc/default.c"
+}
+static  void
+Parrot_default_decrement(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_DECREMENT);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  INTVAL 
+Parrot_default_defined(SHIM_INTERP, SHIM(PMC *_self))
+{
+#line 611 "./src/pmc/default.pmc"
+    return 1;
+#line 533 "./src/pmc/default.c"
+}
+static  INTVAL
+Parrot_default_defined_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_DEFINED_KEYED);
+}
+static  INTVAL 
+Parrot_default_defined_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+#line 628 "./src/pmc/default.pmc"
+
+    PMC *const r_key = INT2KEY(interp, key);
+    return VTABLE_defined_keyed(interp, _self, r_key);
+#line 547 "./src/pmc/default.c"
+}
+static  INTVAL
+Parrot_default_defined_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_DEFINED_KEYED_STR);
+}
+static  void
+Parrot_default_delete_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_DELETE_KEYED);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void 
+Parrot_default_delete_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+#line 643 "./src/pmc/default.pmc"
+
+    PMC *const r_key = INT2KEY(interp, key);
+    VTABLE_delete_keyed(interp, _self, r_key);
+#line 567 "./src/pmc/default.c"
+}
+static  void
+Parrot_default_delete_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_DELETE_KEYED_STR);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void 
+Parrot_default_destroy(SHIM_INTERP, SHIM(PMC *_self))
+{
+#line 192 "./src/pmc/default.pmc"
+#line 579 "./src/pmc/default.c"
+}
+static  PMC  *
+Parrot_default_divide(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest)
+{
+#line 1221 "./src/pmc/default.pmc"
+
+    PMC *result = PMCNULL;
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "divide", "PPP->P", _self, value, dest, &result);
+    return result;
+#line 590 "./src/pmc/default.c"
+}
+static  PMC  *
+Parrot_default_divide_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest)
+{
+#line 1255 "./src/pmc/default.pmc"
+
+    PMC *result = PMCNULL;
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "divide_float", "PNP->P", _self, value, dest, &result);
+    return result;
+#line 601 "./src/pmc/default.c"
+}
+static  PMC  *
+Parrot_default_divide_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest)
+{
+#line 1238 "./src/pmc/default.pmc"
+
+    PMC *result = PMCNULL;
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "divide_int", "PIP->P", _self, value, dest, &result);
+    return result;
+#line 612 "./src/pmc/default.c"
+}
+static  INTVAL 
+Parrot_default_does(PARROT_INTERP, ARGMOD(PMC *_self), STRING *interface_name)
+{
+#line 660 "./src/pmc/default.pmc"
+
+    return Parrot_pmc_type_does(interp, interface_name, _self->vtable->base_type);
+#line 620 "./src/pmc/default.c"
+}
+static  INTVAL 
+Parrot_default_does_pmc(SHIM_INTERP, SHIM(PMC *_self), SHIM(PMC *role))
+{
+#line 674 "./src/pmc/default.pmc"
+    /* No C-level roles yet. */
+    return 0;
+#line 628 "./src/pmc/default.c"
+}
+static  INTVAL
+Parrot_default_elements(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_ELEMENTS);
+}
+static  INTVAL
+Parrot_default_exists_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_EXISTS_KEYED);
+}
+static  INTVAL 
+Parrot_default_exists_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+#line 596 "./src/pmc/default.pmc"
+
+    PMC *const r_key = INT2KEY(interp, key);
+    return VTABLE_exists_keyed(interp, _self, r_key);
+#line 647 "./src/pmc/default.c"
+}
+static  INTVAL
+Parrot_default_exists_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_EXISTS_KEYED_STR);
+}
+static  PMC  *
+Parrot_default_find_method(PARROT_INTERP, ARGMOD(PMC *_self), STRING *method_name)
+{
+#line 321 "./src/pmc/default.pmc"
+
+    return Parrot_find_method_with_cache(interp, _self, method_name);
+#line 660 "./src/pmc/default.c"
+}
+static  PMC  *
+Parrot_default_floor_divide(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest)
+{
+#line 1317 "./src/pmc/default.pmc"
+
+    PMC *result = PMCNULL;
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "floor_divide", "PPP->P", _self, value, dest, &result);
+    return result;
+#line 671 "./src/pmc/default.c"
+}
+static  PMC  *
+Parrot_default_floor_divide_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest)
+{
+#line 1351 "./src/pmc/default.pmc"
+
+    PMC *result = PMCNULL;
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "floor_divide_float", "PNP->P", _self, value, dest, &result);
+    return result;
+#line 682 "./src/pmc/default.c"
+}
+static  PMC  *
+Parrot_default_floor_divide_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest)
+{
+#line 1334 "./src/pmc/default.pmc"
+
+    PMC *result = PMCNULL;
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "floor_divide_int", "PIP->P", _self, value, dest, &result);
+    return result;
+#line 693 "./src/pmc/default.c"
+}
+static  void 
+Parrot_default_freeze(SHIM_INTERP, SHIM(PMC *_self), SHIM(PMC *info))
+{
+#line 882 "./src/pmc/default.pmc"
+    /* default - no action */
+#line 700 "./src/pmc/default.c"
+}
+static  PMC  *
+Parrot_default_get_attr_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key), STRING *name)
+{
+#line 812 "./src/pmc/default.pmc"
+    return VTABLE_get_attr_str(interp, _self, name);
+#line 707 "./src/pmc/default.c"
+}
+static  PMC *
+Parrot_default_get_attr_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *idx))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_GET_ATTR_STR);
+}
+static  INTVAL
+Parrot_default_get_bool(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_GET_BOOL);
+}
+static  PMC  *
+Parrot_default_get_class(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 781 "./src/pmc/default.pmc"
+
+    PMC * const ns     = VTABLE_get_namespace(interp, _self);
+    PMC *_class = PMCNULL;
+
+    if (!PMC_IS_NULL(ns))
+        _class = VTABLE_get_class(interp, ns);
+
+    if (PMC_IS_NULL(_class)) {
+        const INTVAL type      = VTABLE_type(interp, _self);
+        return Parrot_pmc_new_init_int(interp, enum_class_PMCProxy, type);
+    }
+
+    return _class;
+
+#line 737 "./src/pmc/default.c"
+}
+static  INTVAL
+Parrot_default_get_integer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_GET_INTEGER);
+}
+static  INTVAL
+Parrot_default_get_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_GET_INTEGER_KEYED);
+}
+static  INTVAL 
+Parrot_default_get_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+#line 340 "./src/pmc/default.pmc"
+
+    PMC *const r_key = INT2KEY(interp, key);
+    return VTABLE_get_integer_keyed(interp, _self, r_key);
+#line 756 "./src/pmc/default.c"
+}
+static  INTVAL
+Parrot_default_get_integer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_GET_INTEGER_KEYED_STR);
+}
+static  PMC *
+Parrot_default_get_iter(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_GET_ITER);
+}
+static  PMC  *
+Parrot_default_get_namespace(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 307 "./src/pmc/default.pmc"
+
+
+    /* Because singletons are shared between interpreters, we need to make
+     * special effort to use the right namespace for method lookups.
+     * Note that this trick won't work if the singleton inherits from
+     * something else (because the MRO will still be shared).
+     * Having this code here avoids creating a special case for singletons
+     * elsewhere.
+     */
+
+    return interp->vtables[_self->vtable->base_type]->_namespace;
+#line 783 "./src/pmc/default.c"
+}
+static  FLOATVAL
+Parrot_default_get_number(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_GET_NUMBER);
+}
+static  FLOATVAL
+Parrot_default_get_number_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_GET_NUMBER_KEYED);
+}
+static  FLOATVAL 
+Parrot_default_get_number_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+#line 356 "./src/pmc/default.pmc"
+
+    PMC *const r_key = INT2KEY(interp, key);
+    return VTABLE_get_number_keyed(interp, _self, r_key);
+#line 802 "./src/pmc/default.c"
+}
+static  FLOATVAL
+Parrot_default_get_number_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_GET_NUMBER_KEYED_STR);
+}
+static  PMC *
+Parrot_default_get_pmc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_GET_PMC);
+}
+static  PMC *
+Parrot_default_get_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_GET_PMC_KEYED);
+}
+static  PMC  *
+Parrot_default_get_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+#line 389 "./src/pmc/default.pmc"
+
+    PMC *const r_key = INT2KEY(interp, key);
+    return VTABLE_get_pmc_keyed(interp, _self, r_key);
+#line 826 "./src/pmc/default.c"
+}
+static  PMC *
+Parrot_default_get_pmc_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_GET_PMC_KEYED_STR);
+}
+static  void *
+Parrot_default_get_pointer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_GET_POINTER);
+}
+static  void *
+Parrot_default_get_pointer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_GET_POINTER_KEYED);
+}
+static  void *
+Parrot_default_get_pointer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL key))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_GET_POINTER_KEYED_INT);
+}
+static  void *
+Parrot_default_get_pointer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_GET_POINTER_KEYED_STR);
+}
+static  STRING *
+Parrot_default_get_repr(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_GET_REPR);
+}
+static  STRING *
+Parrot_default_get_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_GET_STRING);
+}
+static  STRING *
+Parrot_default_get_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_GET_STRING_KEYED);
+}
+static  STRING  *
+Parrot_default_get_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+#line 373 "./src/pmc/default.pmc"
+
+    PMC *const r_key = INT2KEY(interp, key);
+    return VTABLE_get_string_keyed(interp, _self, r_key);
+#line 875 "./src/pmc/default.c"
+}
+static  STRING *
+Parrot_default_get_string_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_GET_STRING_KEYED_STR);
+}
+static  INTVAL 
+Parrot_default_hashvalue(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 526 "./src/pmc/default.pmc"
+
+    STRING * const s = VTABLE_get_string(interp, _self);
+    return STRING_hash(interp, s, interp->hash_seed);
+#line 889 "./src/pmc/default.c"
+}
+static  void
+Parrot_default_i_absolute(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_I_ABSOLUTE);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void 
+Parrot_default_i_add(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 984 "./src/pmc/default.pmc"
+
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "i_add", "PP", _self, value);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 905 "./src/pmc/default.c"
+}
+static  void 
+Parrot_default_i_add_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value)
+{
+#line 1014 "./src/pmc/default.pmc"
+
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "i_add_float", "PN", _self, value);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 915 "./src/pmc/default.c"
+}
+static  void 
+Parrot_default_i_add_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+#line 999 "./src/pmc/default.pmc"
+
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "i_add_int", "PI", _self, value);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 925 "./src/pmc/default.c"
+}
+static  void 
+Parrot_default_i_concatenate(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 1627 "./src/pmc/default.pmc"
+
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "i_concatenate", "PP", _self, value);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 935 "./src/pmc/default.c"
+}
+static  void 
+Parrot_default_i_concatenate_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value)
+{
+#line 1642 "./src/pmc/default.pmc"
+
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "i_concatenate_str", "PS", _self, value);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 945 "./src/pmc/default.c"
+}
+static  void 
+Parrot_default_i_divide(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 1272 "./src/pmc/default.pmc"
+
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "i_divide", "PP", _self, value);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 955 "./src/pmc/default.c"
+}
+static  void 
+Parrot_default_i_divide_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value)
+{
+#line 1302 "./src/pmc/default.pmc"
+
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "i_divide_float", "PN", _self, value);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 965 "./src/pmc/default.c"
+}
+static  void 
+Parrot_default_i_divide_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+#line 1287 "./src/pmc/default.pmc"
+
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "i_divide_int", "PI", _self, value);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 975 "./src/pmc/default.c"
+}
+static  void 
+Parrot_default_i_floor_divide(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 1368 "./src/pmc/default.pmc"
+
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "i_floor_divide", "PP", _self, value);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 985 "./src/pmc/default.c"
+}
+static  void 
+Parrot_default_i_floor_divide_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value)
+{
+#line 1398 "./src/pmc/default.pmc"
+
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "i_floor_divide_float", "PN", _self, value);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 995 "./src/pmc/default.c"
+}
+static  void 
+Parrot_default_i_floor_divide_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+#line 1383 "./src/pmc/default.pmc"
+
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "i_floor_divide_int", "PI", _self, value);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 1005 "./src/pmc/default.c"
+}
+static  void 
+Parrot_default_i_modulus(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 1464 "./src/pmc/default.pmc"
+
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "i_modulus", "PP", _self, value);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 1015 "./src/pmc/default.c"
+}
+static  void 
+Parrot_default_i_modulus_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value)
+{
+#line 1494 "./src/pmc/default.pmc"
+
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "i_modulus_float", "PN", _self, value);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 1025 "./src/pmc/default.c"
+}
+static  void 
+Parrot_default_i_modulus_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+#line 1479 "./src/pmc/default.pmc"
+
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "i_modulus_int", "PI", _self, value);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 1035 "./src/pmc/default.c"
+}
+static  void 
+Parrot_default_i_multiply(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 1176 "./src/pmc/default.pmc"
+
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "i_multiply", "PP", _self, value);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 1045 "./src/pmc/default.c"
+}
+static  void 
+Parrot_default_i_multiply_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value)
+{
+#line 1206 "./src/pmc/default.pmc"
+
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "i_multiply_float", "PN", _self, value);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 1055 "./src/pmc/default.c"
+}
+static  void 
+Parrot_default_i_multiply_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+#line 1191 "./src/pmc/default.pmc"
+
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "i_multiply_int", "PI", _self, value);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 1065 "./src/pmc/default.c"
+}
+static  void
+Parrot_default_i_neg(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_I_NEG);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void 
+Parrot_default_i_repeat(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 1691 "./src/pmc/default.pmc"
+
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "i_repeat", "PP", _self, value);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 1081 "./src/pmc/default.c"
+}
+static  void 
+Parrot_default_i_repeat_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+#line 1706 "./src/pmc/default.pmc"
+
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "i_repeat_int", "PI", _self, value);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 1091 "./src/pmc/default.c"
+}
+static  void 
+Parrot_default_i_subtract(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 1080 "./src/pmc/default.pmc"
+
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "i_subtract", "PP", _self, value);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 1101 "./src/pmc/default.c"
+}
+static  void 
+Parrot_default_i_subtract_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value)
+{
+#line 1110 "./src/pmc/default.pmc"
+
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "i_subtract_float", "PN", _self, value);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 1111 "./src/pmc/default.c"
+}
+static  void 
+Parrot_default_i_subtract_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+#line 1095 "./src/pmc/default.pmc"
+
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "i_subtract_int", "PI", _self, value);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 1121 "./src/pmc/default.c"
+}
+static  void
+Parrot_default_increment(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_INCREMENT);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void 
+Parrot_default_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 141 "./src/pmc/default.pmc"
+
+    /**/UNUSED(interp)
+    /**/UNUSED(_self)
+#line 1136 "./src/pmc/default.c"
+}
+static  void 
+Parrot_default_init_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL initvalue)
+{
+#line 177 "./src/pmc/default.pmc"
+
+    VTABLE_init(interp, _self);
+    VTABLE_set_integer_native(interp, _self, initvalue);
+#line 1145 "./src/pmc/default.c"
+}
+static  void 
+Parrot_default_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *initializer)
+{
+#line 156 "./src/pmc/default.pmc"
+
+    if (PMC_IS_NULL(initializer))
+        VTABLE_init(interp, _self);
+    else
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_ILL_INHERIT,
+            "init_pmc() not implemented in class '%Ss'",
+            caller(interp, _self));
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 1159 "./src/pmc/default.c"
+}
+static  PMC  *
+Parrot_default_inspect(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 762 "./src/pmc/default.pmc"
+
+    PMC    * const metadata    = Parrot_pmc_new(interp, enum_class_Hash);
+    STRING * const flags_str   = CONST_STRING(interp, "flags");
+
+    VTABLE_set_pmc_keyed_str(interp, metadata, flags_str,
+        VTABLE_inspect_str(interp, _self, flags_str));
+
+    return metadata;
+#line 1173 "./src/pmc/default.c"
+}
+static  PMC  *
+Parrot_default_inspect_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name)
+{
+#line 738 "./src/pmc/default.pmc"
+
+    if (STRING_equal(interp, name, CONST_STRING(interp, "flags"))) {
+        PMC * const found = Parrot_pmc_new_init_int(interp, enum_class_Integer,
+                (INTVAL)PObj_get_FLAGS(_self));
+        return found;
+    }
+    else if (STRING_equal(interp, name, CONST_STRING(interp, "mro"))) {
+        return VTABLE_clone(interp, _self->vtable->mro);
+    }
+    else
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "Unknown introspection value '%S'", name);
+#line 1191 "./src/pmc/default.c"
+}
+static  PMC  *
+Parrot_default_instantiate(PARROT_INTERP, ARGMOD(PMC *_self), PMC *init)
+{
+#line 208 "./src/pmc/default.pmc"
+
+    const INTVAL type = VTABLE_type(interp, _self);
+
+    /* Ensure no looping, as Parrot_pmc_new calls the instantiate vtable entry for
+     * classes. */
+    if (PObj_is_class_TEST(_self))
+        Parrot_ex_throw_from_c_args(interp, NULL, 1,
+                "All high-level classes should override instantiate");
+
+    if (!PMC_IS_NULL(init))
+        return Parrot_pmc_new_init(interp, type, init);
+
+    return Parrot_pmc_new(interp, type);
+#line 1210 "./src/pmc/default.c"
+}
+static  opcode_t *
+Parrot_default_invoke(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(void *next))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_INVOKE);
+}
+static  INTVAL 
+Parrot_default_is_equal(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 541 "./src/pmc/default.pmc"
+
+    INTVAL retval;
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "is_equal", "PP->I", _self, value, &retval);
+
+    return retval;
+#line 1227 "./src/pmc/default.c"
+}
+static  INTVAL 
+Parrot_default_is_equal_num(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 559 "./src/pmc/default.pmc"
+
+    INTVAL retval;
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "is_equal_num", "PP->I", _self, value, &retval);
+
+    return retval;
+#line 1239 "./src/pmc/default.c"
+}
+static  INTVAL 
+Parrot_default_is_equal_string(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 577 "./src/pmc/default.pmc"
+
+    INTVAL retval;
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "is_equal_string", "PP->I", _self, value, &retval);
+
+    return retval;
+#line 1251 "./src/pmc/default.c"
+}
+static  INTVAL 
+Parrot_default_is_same(SHIM_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 405 "./src/pmc/default.pmc"
+    return _self == value;
+#line 1258 "./src/pmc/default.c"
+}
+static  INTVAL 
+Parrot_default_isa(PARROT_INTERP, ARGMOD(PMC *_self), STRING *_class)
+{
+#line 716 "./src/pmc/default.pmc"
+
+    if (_self->vtable->whoami == _class)
+        return 1;
+    else {
+        const Hash * const isa_hash = _self->vtable->isa_hash;
+        if (!isa_hash)
+            return STRING_equal(interp, _self->vtable->whoami, _class);
+
+        return Parrot_hash_exists(interp, isa_hash, (void *)_class);
+    }
+#line 1274 "./src/pmc/default.c"
+}
+static  INTVAL 
+Parrot_default_isa_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *lookup)
+{
+#line 694 "./src/pmc/default.pmc"
+
+    if (PMC_IS_NULL(lookup))
+        return 0;
+    else {
+        Hash   * const isa_hash = _self->vtable->isa_hash;
+        STRING * const pmc_name = VTABLE_get_string(interp, lookup);
+        return Parrot_hash_exists(interp, isa_hash, pmc_name);
+    }
+#line 1288 "./src/pmc/default.c"
+}
+static  void 
+Parrot_default_mark(PARROT_INTERP, SHIM(PMC *_self))
+{
+#line 233 "./src/pmc/default.pmc"
+    PANIC(interp, "custom_mark flag set but no custom mark routine defined");
+#line 1295 "./src/pmc/default.c"
+}
+static  PMC  *
+Parrot_default_modulus(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest)
+{
+#line 1413 "./src/pmc/default.pmc"
+
+    PMC *result = PMCNULL;
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "modulus", "PPP->P", _self, value, dest, &result);
+    return result;
+#line 1306 "./src/pmc/default.c"
+}
+static  PMC  *
+Parrot_default_modulus_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest)
+{
+#line 1447 "./src/pmc/default.pmc"
+
+    PMC *result = PMCNULL;
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "modulus_float", "PNP->P", _self, value, dest, &result);
+    return result;
+#line 1317 "./src/pmc/default.c"
+}
+static  PMC  *
+Parrot_default_modulus_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest)
+{
+#line 1430 "./src/pmc/default.pmc"
+
+    PMC *result = PMCNULL;
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "modulus_int", "PIP->P", _self, value, dest, &result);
+    return result;
+#line 1328 "./src/pmc/default.c"
+}
+static  void 
+Parrot_default_morph(PARROT_INTERP, ARGMOD(PMC *_self), PMC *type)
+{
+#line 448 "./src/pmc/default.pmc"
+
+    Parrot_pmc_reuse(interp, _self, VTABLE_get_integer(interp, type), 0);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 1337 "./src/pmc/default.c"
+}
+static  PMC  *
+Parrot_default_multiply(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest)
+{
+#line 1125 "./src/pmc/default.pmc"
+
+    PMC *result = PMCNULL;
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "multiply", "PPP->P", _self, value, dest, &result);
+    return result;
+#line 1348 "./src/pmc/default.c"
+}
+static  PMC  *
+Parrot_default_multiply_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest)
+{
+#line 1159 "./src/pmc/default.pmc"
+
+    PMC *result = PMCNULL;
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "multiply_float", "PNP->P", _self, value, dest, &result);
+    return result;
+#line 1359 "./src/pmc/default.c"
+}
+static  PMC  *
+Parrot_default_multiply_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest)
+{
+#line 1142 "./src/pmc/default.pmc"
+
+    PMC *result = PMCNULL;
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "multiply_int", "PIP->P", _self, value, dest, &result);
+    return result;
+#line 1370 "./src/pmc/default.c"
+}
+static  STRING  *
+Parrot_default_name(SHIM_INTERP, ARGMOD(PMC *_self))
+{
+#line 263 "./src/pmc/default.pmc"
+    return _self->vtable->whoami;
+#line 1377 "./src/pmc/default.c"
+}
+static  PMC *
+Parrot_default_neg(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *dest))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_NEG);
+}
+static  FLOATVAL
+Parrot_default_pop_float(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_POP_FLOAT);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  INTVAL
+Parrot_default_pop_integer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_POP_INTEGER);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  PMC *
+Parrot_default_pop_pmc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_POP_PMC);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  STRING *
+Parrot_default_pop_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_POP_STRING);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_default_push_float(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(FLOATVAL value))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_PUSH_FLOAT);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_default_push_integer(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL value))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_PUSH_INTEGER);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_default_push_pmc(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_PUSH_PMC);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_default_push_string(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *value))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_PUSH_STRING);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_default_remove_attribute(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *name))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_REMOVE_ATTRIBUTE);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_default_remove_method(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *method_name))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_REMOVE_METHOD);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_default_remove_parent(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *parent))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_REMOVE_PARENT);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_default_remove_role(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *role))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_REMOVE_ROLE);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_default_remove_vtable_override(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *vtable_name))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_REMOVE_VTABLE_OVERRIDE);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  PMC  *
+Parrot_default_repeat(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest)
+{
+#line 1657 "./src/pmc/default.pmc"
+
+    PMC *result = PMCNULL;
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "repeat", "PPP->P", _self, value, dest, &result);
+    return result;
+#line 1471 "./src/pmc/default.c"
+}
+static  PMC  *
+Parrot_default_repeat_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest)
+{
+#line 1674 "./src/pmc/default.pmc"
+
+    PMC *result = PMCNULL;
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "repeat_int", "PIP->P", _self, value, dest, &result);
+    return result;
+#line 1482 "./src/pmc/default.c"
+}
+static  void 
+Parrot_default_set_attr_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key), STRING *name, PMC *value)
+{
+#line 817 "./src/pmc/default.pmc"
+    VTABLE_set_attr_str(interp, _self, name, value);
+#line 1489 "./src/pmc/default.c"
+}
+static  void
+Parrot_default_set_attr_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *idx), SHIM(PMC *value))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_SET_ATTR_STR);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_default_set_bool(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL value))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_SET_BOOL);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_default_set_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key), SHIM(INTVAL value))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_SET_INTEGER_KEYED);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void 
+Parrot_default_set_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, INTVAL value)
+{
+#line 463 "./src/pmc/default.pmc"
+
+    PMC *const r_key = INT2KEY(interp, key);
+    VTABLE_set_integer_keyed(interp, _self, r_key, value);
+#line 1516 "./src/pmc/default.c"
+}
+static  void
+Parrot_default_set_integer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key), SHIM(INTVAL value))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_SET_INTEGER_KEYED_STR);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_default_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL value))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_SET_INTEGER_NATIVE);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_default_set_number_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key), SHIM(FLOATVAL value))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_SET_NUMBER_KEYED);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void 
+Parrot_default_set_number_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, FLOATVAL value)
+{
+#line 479 "./src/pmc/default.pmc"
+
+    PMC *const r_key = INT2KEY(interp, key);
+    VTABLE_set_number_keyed(interp, _self, r_key, value);
+#line 1543 "./src/pmc/default.c"
+}
+static  void
+Parrot_default_set_number_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key), SHIM(FLOATVAL value))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_SET_NUMBER_KEYED_STR);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_default_set_number_native(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(FLOATVAL value))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_SET_NUMBER_NATIVE);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_default_set_pmc(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_SET_PMC);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_default_set_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key), SHIM(PMC *value))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_SET_PMC_KEYED);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void 
+Parrot_default_set_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, PMC *value)
+{
+#line 511 "./src/pmc/default.pmc"
+
+    PMC *const r_key = INT2KEY(interp, key);
+    VTABLE_set_pmc_keyed(interp, _self, r_key, value);
+#line 1576 "./src/pmc/default.c"
+}
+static  void
+Parrot_default_set_pmc_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key), SHIM(PMC *value))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_SET_PMC_KEYED_STR);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_default_set_pointer(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(void *value))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_SET_POINTER);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_default_set_pointer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key), SHIM(void *value))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_SET_POINTER_KEYED);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_default_set_pointer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL key), SHIM(void *value))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_SET_POINTER_KEYED_INT);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_default_set_pointer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key), SHIM(void *value))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_SET_POINTER_KEYED_STR);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_default_set_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key), SHIM(STRING *value))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_SET_STRING_KEYED);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void 
+Parrot_default_set_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, STRING *string)
+{
+#line 495 "./src/pmc/default.pmc"
+
+    PMC *const r_key = INT2KEY(interp, key);
+    VTABLE_set_string_keyed(interp, _self, r_key, string);
+#line 1621 "./src/pmc/default.c"
+}
+static  void
+Parrot_default_set_string_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key), SHIM(STRING *value))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_SET_STRING_KEYED_STR);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_default_set_string_native(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *value))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_SET_STRING_NATIVE);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_default_share(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_SHARE);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  FLOATVAL
+Parrot_default_shift_float(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_SHIFT_FLOAT);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  INTVAL
+Parrot_default_shift_integer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_SHIFT_INTEGER);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  PMC *
+Parrot_default_shift_pmc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_SHIFT_PMC);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  STRING *
+Parrot_default_shift_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_SHIFT_STRING);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_default_splice(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value), SHIM(INTVAL offset), SHIM(INTVAL count))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_SPLICE);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  STRING *
+Parrot_default_substr(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL offset), SHIM(INTVAL length))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_SUBSTR);
+}
+static  PMC  *
+Parrot_default_subtract(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest)
+{
+#line 1029 "./src/pmc/default.pmc"
+
+    PMC *result = PMCNULL;
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "subtract", "PPP->P", _self, value, dest, &result);
+    return result;
+#line 1685 "./src/pmc/default.c"
+}
+static  PMC  *
+Parrot_default_subtract_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest)
+{
+#line 1063 "./src/pmc/default.pmc"
+
+    PMC *result = PMCNULL;
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "subtract_float", "PNP->P", _self, value, dest, &result);
+    return result;
+#line 1696 "./src/pmc/default.c"
+}
+static  PMC  *
+Parrot_default_subtract_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest)
+{
+#line 1046 "./src/pmc/default.pmc"
+
+    PMC *result = PMCNULL;
+    Parrot_mmd_multi_dispatch_from_c_args(interp,
+            "subtract_int", "PIP->P", _self, value, dest, &result);
+    return result;
+#line 1707 "./src/pmc/default.c"
+}
+static  void 
+Parrot_default_thaw(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *info))
+{
+#line 899 "./src/pmc/default.pmc"
+ /* WB in init */
+    /* default - initialize the PMC */
+    VTABLE_init(interp, _self);
+#line 1716 "./src/pmc/default.c"
+}
+static  void 
+Parrot_default_thawfinish(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 915 "./src/pmc/default.pmc"
+
+    /**/UNUSED(interp)
+    /**/UNUSED(_self)
+    UNUSED(info);
+    /* default - no action */
+#line 1727 "./src/pmc/default.c"
+}
+static  INTVAL 
+Parrot_default_type(SHIM_INTERP, ARGMOD(PMC *_self))
+{
+#line 248 "./src/pmc/default.pmc"
+    return _self->vtable->base_type;
+#line 1734 "./src/pmc/default.c"
+}
+static  void
+Parrot_default_unshift_float(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(FLOATVAL value))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_UNSHIFT_FLOAT);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_default_unshift_integer(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL value))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_UNSHIFT_INTEGER);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_default_unshift_pmc(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_UNSHIFT_PMC);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_default_unshift_string(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *value))
+{
+    cant_do_method(interp, _self, PARROT_VTABLE_SLOT_UNSHIFT_STRING);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void 
+Parrot_default_visit(SHIM_INTERP, SHIM(PMC *_self), SHIM(PMC *info))
+{
+#line 852 "./src/pmc/default.pmc"
+#line 1764 "./src/pmc/default.c"
+}
+static  void
+Parrot_default_ro_add_attribute(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *name), SHIM(PMC *type))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_ADD_ATTRIBUTE);
+}
+static  void
+Parrot_default_ro_add_method(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *method_name), SHIM(PMC *sub_pmc))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_ADD_METHOD);
+}
+static  void
+Parrot_default_ro_add_parent(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *parent))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_ADD_PARENT);
+}
+static  void
+Parrot_default_ro_add_role(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *role))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_ADD_ROLE);
+}
+static  void
+Parrot_default_ro_add_vtable_override(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *vtable_name), SHIM(PMC *sub_pmc))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_ADD_VTABLE_OVERRIDE);
+}
+static  void
+Parrot_default_ro_assign_pmc(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_ASSIGN_PMC);
+}
+static  void
+Parrot_default_ro_assign_string_native(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_ASSIGN_STRING_NATIVE);
+}
+static  void
+Parrot_default_ro_decrement(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_DECREMENT);
+}
+static  void
+Parrot_default_ro_delete_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_DELETE_KEYED);
+}
+static  void
+Parrot_default_ro_delete_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL key))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_DELETE_KEYED_INT);
+}
+static  void
+Parrot_default_ro_delete_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_DELETE_KEYED_STR);
+}
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static  PMC *
+Parrot_default_ro_find_method(PARROT_INTERP, ARGMOD(PMC *_self), ARGMOD(STRING *method_name)) {
+    /* Use non-readonly find_method. Current vtable is ro variant. So ro_variant contains non-ro variant */
+    PMC *const method = _self->vtable->ro_variant_vtable->find_method(interp, _self, method_name);
+    if (!PMC_IS_NULL(Parrot_pmc_getprop(interp, method, CONST_STRING_GEN(interp, "write"))))
+        return PMCNULL;
+    else
+        return method;
+}
+static  void
+Parrot_default_ro_i_absolute(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_ABSOLUTE);
+}
+static  void
+Parrot_default_ro_i_add(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_ADD);
+}
+static  void
+Parrot_default_ro_i_add_float(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(FLOATVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_ADD_FLOAT);
+}
+static  void
+Parrot_default_ro_i_add_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_ADD_INT);
+}
+static  void
+Parrot_default_ro_i_concatenate(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_CONCATENATE);
+}
+static  void
+Parrot_default_ro_i_concatenate_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_CONCATENATE_STR);
+}
+static  void
+Parrot_default_ro_i_divide(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_DIVIDE);
+}
+static  void
+Parrot_default_ro_i_divide_float(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(FLOATVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_DIVIDE_FLOAT);
+}
+static  void
+Parrot_default_ro_i_divide_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_DIVIDE_INT);
+}
+static  void
+Parrot_default_ro_i_floor_divide(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_FLOOR_DIVIDE);
+}
+static  void
+Parrot_default_ro_i_floor_divide_float(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(FLOATVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_FLOOR_DIVIDE_FLOAT);
+}
+static  void
+Parrot_default_ro_i_floor_divide_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_FLOOR_DIVIDE_INT);
+}
+static  void
+Parrot_default_ro_i_modulus(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_MODULUS);
+}
+static  void
+Parrot_default_ro_i_modulus_float(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(FLOATVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_MODULUS_FLOAT);
+}
+static  void
+Parrot_default_ro_i_modulus_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_MODULUS_INT);
+}
+static  void
+Parrot_default_ro_i_multiply(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_MULTIPLY);
+}
+static  void
+Parrot_default_ro_i_multiply_float(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(FLOATVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_MULTIPLY_FLOAT);
+}
+static  void
+Parrot_default_ro_i_multiply_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_MULTIPLY_INT);
+}
+static  void
+Parrot_default_ro_i_neg(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_NEG);
+}
+static  void
+Parrot_default_ro_i_repeat(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_REPEAT);
+}
+static  void
+Parrot_default_ro_i_repeat_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_REPEAT_INT);
+}
+static  void
+Parrot_default_ro_i_subtract(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_SUBTRACT);
+}
+static  void
+Parrot_default_ro_i_subtract_float(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(FLOATVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_SUBTRACT_FLOAT);
+}
+static  void
+Parrot_default_ro_i_subtract_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_SUBTRACT_INT);
+}
+static  void
+Parrot_default_ro_increment(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_INCREMENT);
+}
+static  void
+Parrot_default_ro_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_INIT);
+}
+static  void
+Parrot_default_ro_init_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL initializer))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_INIT_INT);
+}
+static  void
+Parrot_default_ro_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *initializer))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_INIT_PMC);
+}
+static  void
+Parrot_default_ro_morph(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *type))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_MORPH);
+}
+static  FLOATVAL
+Parrot_default_ro_pop_float(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_POP_FLOAT);
+}
+static  INTVAL
+Parrot_default_ro_pop_integer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_POP_INTEGER);
+}
+static  PMC *
+Parrot_default_ro_pop_pmc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_POP_PMC);
+}
+static  STRING *
+Parrot_default_ro_pop_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_POP_STRING);
+}
+static  void
+Parrot_default_ro_push_float(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(FLOATVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_PUSH_FLOAT);
+}
+static  void
+Parrot_default_ro_push_integer(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_PUSH_INTEGER);
+}
+static  void
+Parrot_default_ro_push_pmc(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_PUSH_PMC);
+}
+static  void
+Parrot_default_ro_push_string(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_PUSH_STRING);
+}
+static  void
+Parrot_default_ro_remove_attribute(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *name))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_REMOVE_ATTRIBUTE);
+}
+static  void
+Parrot_default_ro_remove_method(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *method_name))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_REMOVE_METHOD);
+}
+static  void
+Parrot_default_ro_remove_parent(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *parent))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_REMOVE_PARENT);
+}
+static  void
+Parrot_default_ro_remove_role(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *role))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_REMOVE_ROLE);
+}
+static  void
+Parrot_default_ro_remove_vtable_override(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *vtable_name))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_REMOVE_VTABLE_OVERRIDE);
+}
+static  void
+Parrot_default_ro_set_attr_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key), SHIM(STRING *idx), SHIM(PMC *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_ATTR_KEYED);
+}
+static  void
+Parrot_default_ro_set_attr_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *idx), SHIM(PMC *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_ATTR_STR);
+}
+static  void
+Parrot_default_ro_set_bool(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_BOOL);
+}
+static  void
+Parrot_default_ro_set_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key), SHIM(INTVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_INTEGER_KEYED);
+}
+static  void
+Parrot_default_ro_set_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL key), SHIM(INTVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_INTEGER_KEYED_INT);
+}
+static  void
+Parrot_default_ro_set_integer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key), SHIM(INTVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_INTEGER_KEYED_STR);
+}
+static  void
+Parrot_default_ro_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_INTEGER_NATIVE);
+}
+static  void
+Parrot_default_ro_set_number_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key), SHIM(FLOATVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_NUMBER_KEYED);
+}
+static  void
+Parrot_default_ro_set_number_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL key), SHIM(FLOATVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_NUMBER_KEYED_INT);
+}
+static  void
+Parrot_default_ro_set_number_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key), SHIM(FLOATVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_NUMBER_KEYED_STR);
+}
+static  void
+Parrot_default_ro_set_number_native(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(FLOATVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_NUMBER_NATIVE);
+}
+static  void
+Parrot_default_ro_set_pmc(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_PMC);
+}
+static  void
+Parrot_default_ro_set_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key), SHIM(PMC *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_PMC_KEYED);
+}
+static  void
+Parrot_default_ro_set_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL key), SHIM(PMC *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_PMC_KEYED_INT);
+}
+static  void
+Parrot_default_ro_set_pmc_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key), SHIM(PMC *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_PMC_KEYED_STR);
+}
+static  void
+Parrot_default_ro_set_pointer(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(void *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_POINTER);
+}
+static  void
+Parrot_default_ro_set_pointer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key), SHIM(void *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_POINTER_KEYED);
+}
+static  void
+Parrot_default_ro_set_pointer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL key), SHIM(void *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_POINTER_KEYED_INT);
+}
+static  void
+Parrot_default_ro_set_pointer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key), SHIM(void *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_POINTER_KEYED_STR);
+}
+static  void
+Parrot_default_ro_set_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key), SHIM(STRING *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_STRING_KEYED);
+}
+static  void
+Parrot_default_ro_set_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL key), SHIM(STRING *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_STRING_KEYED_INT);
+}
+static  void
+Parrot_default_ro_set_string_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key), SHIM(STRING *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_STRING_KEYED_STR);
+}
+static  void
+Parrot_default_ro_set_string_native(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_STRING_NATIVE);
+}
+static  void
+Parrot_default_ro_share(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SHARE);
+}
+static  FLOATVAL
+Parrot_default_ro_shift_float(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SHIFT_FLOAT);
+}
+static  INTVAL
+Parrot_default_ro_shift_integer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SHIFT_INTEGER);
+}
+static  PMC *
+Parrot_default_ro_shift_pmc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SHIFT_PMC);
+}
+static  STRING *
+Parrot_default_ro_shift_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SHIFT_STRING);
+}
+static  void
+Parrot_default_ro_splice(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value), SHIM(INTVAL offset), SHIM(INTVAL count))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SPLICE);
+}
+static  void
+Parrot_default_ro_thaw(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *info))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_THAW);
+}
+static  void
+Parrot_default_ro_thawfinish(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *info))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_THAWFINISH);
+}
+static  void
+Parrot_default_ro_unshift_float(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(FLOATVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_UNSHIFT_FLOAT);
+}
+static  void
+Parrot_default_ro_unshift_integer(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_UNSHIFT_INTEGER);
+}
+static  void
+Parrot_default_ro_unshift_pmc(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_UNSHIFT_PMC);
+}
+static  void
+Parrot_default_ro_unshift_string(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_UNSHIFT_STRING);
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT VTABLE* Parrot_default_get_vtable(PARROT_INTERP) {
+
+    static const char attr_defs [] = "";
+
+    static const VTABLE temp_vtable = {
+        NULL,       /* namespace */
+        enum_class_default, /* base_type */
+        NULL,       /* whoami */
+        0|VTABLE_HAS_READONLY_FLAG, /* flags */
+        NULL,       /* provides_str */
+        NULL,       /* isa_hash */
+        NULL,       /* class */
+        NULL,       /* mro */
+        NULL,       /* attribute_defs */
+        NULL,       /* ro_variant_vtable */
+        Parrot_default_absolute,
+        Parrot_default_add,
+        Parrot_default_add_attribute,
+        Parrot_default_add_float,
+        Parrot_default_add_int,
+        Parrot_default_add_method,
+        Parrot_default_add_parent,
+        Parrot_default_add_role,
+        Parrot_default_add_vtable_override,
+        Parrot_default_assign_pmc,
+        Parrot_default_assign_string_native,
+        Parrot_default_clone,
+        Parrot_default_clone_pmc,
+        Parrot_default_cmp,
+        Parrot_default_cmp_num,
+        Parrot_default_cmp_pmc,
+        Parrot_default_cmp_string,
+        Parrot_default_concatenate,
+        Parrot_default_concatenate_str,
+        Parrot_default_decrement,
+        Parrot_default_defined,
+        Parrot_default_defined_keyed,
+        Parrot_default_defined_keyed_int,
+        Parrot_default_defined_keyed_str,
+        Parrot_default_delete_keyed,
+        Parrot_default_delete_keyed_int,
+        Parrot_default_delete_keyed_str,
+        Parrot_default_destroy,
+        Parrot_default_divide,
+        Parrot_default_divide_float,
+        Parrot_default_divide_int,
+        Parrot_default_does,
+        Parrot_default_does_pmc,
+        Parrot_default_elements,
+        Parrot_default_exists_keyed,
+        Parrot_default_exists_keyed_int,
+        Parrot_default_exists_keyed_str,
+        Parrot_default_find_method,
+        Parrot_default_floor_divide,
+        Parrot_default_floor_divide_float,
+        Parrot_default_floor_divide_int,
+        Parrot_default_freeze,
+        Parrot_default_get_attr_keyed,
+        Parrot_default_get_attr_str,
+        Parrot_default_get_bool,
+        Parrot_default_get_class,
+        Parrot_default_get_integer,
+        Parrot_default_get_integer_keyed,
+        Parrot_default_get_integer_keyed_int,
+        Parrot_default_get_integer_keyed_str,
+        Parrot_default_get_iter,
+        Parrot_default_get_namespace,
+        Parrot_default_get_number,
+        Parrot_default_get_number_keyed,
+        Parrot_default_get_number_keyed_int,
+        Parrot_default_get_number_keyed_str,
+        Parrot_default_get_pmc,
+        Parrot_default_get_pmc_keyed,
+        Parrot_default_get_pmc_keyed_int,
+        Parrot_default_get_pmc_keyed_str,
+        Parrot_default_get_pointer,
+        Parrot_default_get_pointer_keyed,
+        Parrot_default_get_pointer_keyed_int,
+        Parrot_default_get_pointer_keyed_str,
+        Parrot_default_get_repr,
+        Parrot_default_get_string,
+        Parrot_default_get_string_keyed,
+        Parrot_default_get_string_keyed_int,
+        Parrot_default_get_string_keyed_str,
+        Parrot_default_hashvalue,
+        Parrot_default_i_absolute,
+        Parrot_default_i_add,
+        Parrot_default_i_add_float,
+        Parrot_default_i_add_int,
+        Parrot_default_i_concatenate,
+        Parrot_default_i_concatenate_str,
+        Parrot_default_i_divide,
+        Parrot_default_i_divide_float,
+        Parrot_default_i_divide_int,
+        Parrot_default_i_floor_divide,
+        Parrot_default_i_floor_divide_float,
+        Parrot_default_i_floor_divide_int,
+        Parrot_default_i_modulus,
+        Parrot_default_i_modulus_float,
+        Parrot_default_i_modulus_int,
+        Parrot_default_i_multiply,
+        Parrot_default_i_multiply_float,
+        Parrot_default_i_multiply_int,
+        Parrot_default_i_neg,
+        Parrot_default_i_repeat,
+        Parrot_default_i_repeat_int,
+        Parrot_default_i_subtract,
+        Parrot_default_i_subtract_float,
+        Parrot_default_i_subtract_int,
+        Parrot_default_increment,
+        Parrot_default_init,
+        Parrot_default_init_int,
+        Parrot_default_init_pmc,
+        Parrot_default_inspect,
+        Parrot_default_inspect_str,
+        Parrot_default_instantiate,
+        Parrot_default_invoke,
+        Parrot_default_is_equal,
+        Parrot_default_is_equal_num,
+        Parrot_default_is_equal_string,
+        Parrot_default_is_same,
+        Parrot_default_isa,
+        Parrot_default_isa_pmc,
+        Parrot_default_mark,
+        Parrot_default_modulus,
+        Parrot_default_modulus_float,
+        Parrot_default_modulus_int,
+        Parrot_default_morph,
+        Parrot_default_multiply,
+        Parrot_default_multiply_float,
+        Parrot_default_multiply_int,
+        Parrot_default_name,
+        Parrot_default_neg,
+        Parrot_default_pop_float,
+        Parrot_default_pop_integer,
+        Parrot_default_pop_pmc,
+        Parrot_default_pop_string,
+        Parrot_default_push_float,
+        Parrot_default_push_integer,
+        Parrot_default_push_pmc,
+        Parrot_default_push_string,
+        Parrot_default_remove_attribute,
+        Parrot_default_remove_method,
+        Parrot_default_remove_parent,
+        Parrot_default_remove_role,
+        Parrot_default_remove_vtable_override,
+        Parrot_default_repeat,
+        Parrot_default_repeat_int,
+        Parrot_default_set_attr_keyed,
+        Parrot_default_set_attr_str,
+        Parrot_default_set_bool,
+        Parrot_default_set_integer_keyed,
+        Parrot_default_set_integer_keyed_int,
+        Parrot_default_set_integer_keyed_str,
+        Parrot_default_set_integer_native,
+        Parrot_default_set_number_keyed,
+        Parrot_default_set_number_keyed_int,
+        Parrot_default_set_number_keyed_str,
+        Parrot_default_set_number_native,
+        Parrot_default_set_pmc,
+        Parrot_default_set_pmc_keyed,
+        Parrot_default_set_pmc_keyed_int,
+        Parrot_default_set_pmc_keyed_str,
+        Parrot_default_set_pointer,
+        Parrot_default_set_pointer_keyed,
+        Parrot_default_set_pointer_keyed_int,
+        Parrot_default_set_pointer_keyed_str,
+        Parrot_default_set_string_keyed,
+        Parrot_default_set_string_keyed_int,
+        Parrot_default_set_string_keyed_str,
+        Parrot_default_set_string_native,
+        Parrot_default_share,
+        Parrot_default_shift_float,
+        Parrot_default_shift_integer,
+        Parrot_default_shift_pmc,
+        Parrot_default_shift_string,
+        Parrot_default_splice,
+        Parrot_default_substr,
+        Parrot_default_subtract,
+        Parrot_default_subtract_float,
+        Parrot_default_subtract_int,
+        Parrot_default_thaw,
+        Parrot_default_thawfinish,
+        Parrot_default_type,
+        Parrot_default_unshift_float,
+        Parrot_default_unshift_integer,
+        Parrot_default_unshift_pmc,
+        Parrot_default_unshift_string,
+        Parrot_default_visit,
+        0           /* attr size */
+    };
+
+
+    return Parrot_vtbl_clone_vtable(interp, &temp_vtable);
+}
+
+
+PARROT_EXPORT VTABLE* Parrot_default_ro_get_vtable(PARROT_INTERP) {
+
+    VTABLE * const vt = Parrot_default_get_vtable(interp);
+
+    vt->add_attribute = Parrot_default_ro_add_attribute;
+    vt->add_method = Parrot_default_ro_add_method;
+    vt->add_parent = Parrot_default_ro_add_parent;
+    vt->add_role = Parrot_default_ro_add_role;
+    vt->add_vtable_override = Parrot_default_ro_add_vtable_override;
+    vt->assign_pmc = Parrot_default_ro_assign_pmc;
+    vt->assign_string_native = Parrot_default_ro_assign_string_native;
+    vt->decrement = Parrot_default_ro_decrement;
+    vt->delete_keyed = Parrot_default_ro_delete_keyed;
+    vt->delete_keyed_int = Parrot_default_ro_delete_keyed_int;
+    vt->delete_keyed_str = Parrot_default_ro_delete_keyed_str;
+    vt->find_method = Parrot_default_ro_find_method;
+    vt->i_absolute = Parrot_default_ro_i_absolute;
+    vt->i_add = Parrot_default_ro_i_add;
+    vt->i_add_float = Parrot_default_ro_i_add_float;
+    vt->i_add_int = Parrot_default_ro_i_add_int;
+    vt->i_concatenate = Parrot_default_ro_i_concatenate;
+    vt->i_concatenate_str = Parrot_default_ro_i_concatenate_str;
+    vt->i_divide = Parrot_default_ro_i_divide;
+    vt->i_divide_float = Parrot_default_ro_i_divide_float;
+    vt->i_divide_int = Parrot_default_ro_i_divide_int;
+    vt->i_floor_divide = Parrot_default_ro_i_floor_divide;
+    vt->i_floor_divide_float = Parrot_default_ro_i_floor_divide_float;
+    vt->i_floor_divide_int = Parrot_default_ro_i_floor_divide_int;
+    vt->i_modulus = Parrot_default_ro_i_modulus;
+    vt->i_modulus_float = Parrot_default_ro_i_modulus_float;
+    vt->i_modulus_int = Parrot_default_ro_i_modulus_int;
+    vt->i_multiply = Parrot_default_ro_i_multiply;
+    vt->i_multiply_float = Parrot_default_ro_i_multiply_float;
+    vt->i_multiply_int = Parrot_default_ro_i_multiply_int;
+    vt->i_neg = Parrot_default_ro_i_neg;
+    vt->i_repeat = Parrot_default_ro_i_repeat;
+    vt->i_repeat_int = Parrot_default_ro_i_repeat_int;
+    vt->i_subtract = Parrot_default_ro_i_subtract;
+    vt->i_subtract_float = Parrot_default_ro_i_subtract_float;
+    vt->i_subtract_int = Parrot_default_ro_i_subtract_int;
+    vt->increment = Parrot_default_ro_increment;
+    vt->init = Parrot_default_ro_init;
+    vt->init_int = Parrot_default_ro_init_int;
+    vt->init_pmc = Parrot_default_ro_init_pmc;
+    vt->morph = Parrot_default_ro_morph;
+    vt->pop_float = Parrot_default_ro_pop_float;
+    vt->pop_integer = Parrot_default_ro_pop_integer;
+    vt->pop_pmc = Parrot_default_ro_pop_pmc;
+    vt->pop_string = Parrot_default_ro_pop_string;
+    vt->push_float = Parrot_default_ro_push_float;
+    vt->push_integer = Parrot_default_ro_push_integer;
+    vt->push_pmc = Parrot_default_ro_push_pmc;
+    vt->push_string = Parrot_default_ro_push_string;
+    vt->remove_attribute = Parrot_default_ro_remove_attribute;
+    vt->remove_method = Parrot_default_ro_remove_method;
+    vt->remove_parent = Parrot_default_ro_remove_parent;
+    vt->remove_role = Parrot_default_ro_remove_role;
+    vt->remove_vtable_override = Parrot_default_ro_remove_vtable_override;
+    vt->set_attr_keyed = Parrot_default_ro_set_attr_keyed;
+    vt->set_attr_str = Parrot_default_ro_set_attr_str;
+    vt->set_bool = Parrot_default_ro_set_bool;
+    vt->set_integer_keyed = Parrot_default_ro_set_integer_keyed;
+    vt->set_integer_keyed_int = Parrot_default_ro_set_integer_keyed_int;
+    vt->set_integer_keyed_str = Parrot_default_ro_set_integer_keyed_str;
+    vt->set_integer_native = Parrot_default_ro_set_integer_native;
+    vt->set_number_keyed = Parrot_default_ro_set_number_keyed;
+    vt->set_number_keyed_int = Parrot_default_ro_set_number_keyed_int;
+    vt->set_number_keyed_str = Parrot_default_ro_set_number_keyed_str;
+    vt->set_number_native = Parrot_default_ro_set_number_native;
+    vt->set_pmc = Parrot_default_ro_set_pmc;
+    vt->set_pmc_keyed = Parrot_default_ro_set_pmc_keyed;
+    vt->set_pmc_keyed_int = Parrot_default_ro_set_pmc_keyed_int;
+    vt->set_pmc_keyed_str = Parrot_default_ro_set_pmc_keyed_str;
+    vt->set_pointer = Parrot_default_ro_set_pointer;
+    vt->set_pointer_keyed = Parrot_default_ro_set_pointer_keyed;
+    vt->set_pointer_keyed_int = Parrot_default_ro_set_pointer_keyed_int;
+    vt->set_pointer_keyed_str = Parrot_default_ro_set_pointer_keyed_str;
+    vt->set_string_keyed = Parrot_default_ro_set_string_keyed;
+    vt->set_string_keyed_int = Parrot_default_ro_set_string_keyed_int;
+    vt->set_string_keyed_str = Parrot_default_ro_set_string_keyed_str;
+    vt->set_string_native = Parrot_default_ro_set_string_native;
+    vt->share = Parrot_default_ro_share;
+    vt->shift_float = Parrot_default_ro_shift_float;
+    vt->shift_integer = Parrot_default_ro_shift_integer;
+    vt->shift_pmc = Parrot_default_ro_shift_pmc;
+    vt->shift_string = Parrot_default_ro_shift_string;
+    vt->splice = Parrot_default_ro_splice;
+    vt->thaw = Parrot_default_ro_thaw;
+    vt->thawfinish = Parrot_default_ro_thawfinish;
+    vt->unshift_float = Parrot_default_ro_unshift_float;
+    vt->unshift_integer = Parrot_default_ro_unshift_integer;
+    vt->unshift_pmc = Parrot_default_ro_unshift_pmc;
+    vt->unshift_string = Parrot_default_ro_unshift_string;
+
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_default_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "default"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_default_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "default")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_default_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_default_get_vtable(interp);
+        vt->base_type      = enum_class_default;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "default");
+        vt->provides_str = CONST_STRING_GEN(interp, "");
+        vt->isa_hash     = Parrot_default_get_isa(interp, NULL);
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_default_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+        }
+    } /* pass */
+} /* Parrot_default_class_init */
+
+#line 1709 "./src/pmc/default.pmc"
+
+
+/*
+
+=back
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
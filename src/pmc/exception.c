@@ -0,0 +1,1138 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/exception.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_fixedintegerarray.h"
+#include "pmc_exception.h"
+#include "pmc_default.h"
+#include "exception.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/exception.pmc"
+/*
+Copyright (C) 2001-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/exception.pmc - Exception PMC
+
+=head1 DESCRIPTION
+
+This is the exception base class. An exception object has the following
+attributes:
+
+=over 4
+
+=item C<message>
+
+Textual representation of the exception.
+
+=item C<severity>
+
+The severity of the exception, (see F<include/parrot/exceptions.h>,
+F<except_severity.pasm>).
+
+=item C<type>
+
+The type of the exception.
+
+=item C<exit_code>
+
+The exit code of the exception. (Added temporarily, to be removed.)
+
+=item C<handled>
+
+Whether the exception has been handled. Defaults to 0, 1 for handled, -1 for a
+rethrown exception.
+
+=item C<payload>
+
+Additional data for the exception.
+
+=back
+
+When an exception handler is called, the exception object is passed as
+as the first argument, the message as the second argument of the call.
+These arguments can be retrieved with the C<get_results> opcode.
+
+=cut
+
+*/
+
+#include "parrot/exceptions.h"
+#include "pmc/pmc_sub.h"
+
+typedef enum {
+    attr_id,
+    attr_birthtime,
+    attr_message,
+    attr_payload,
+    attr_resume,
+    attr_severity,
+    attr_type,
+    attr_exit_code,
+    attr_backtrace,
+    attr_handled,
+    attr_handler,
+    attr_handler_ctx,
+    attr_handlers_left,
+    attr_thrower,
+    attr_bt_strings,
+    attr_NONE = -1
+} AttrEnum;
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+static AttrEnum getAttrEnum(PARROT_INTERP, ARGIN(const STRING *name))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+#define ASSERT_ARGS_getAttrEnum __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(name))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+#line 109 "./src/pmc/exception.c"
+static  PMC  * Parrot_Exception_clone(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Exception_freeze(PARROT_INTERP, ARGMOD(PMC *_self), PMC *visit);
+static  PMC  * Parrot_Exception_get_attr_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name);
+static  INTVAL  Parrot_Exception_get_bool(SHIM_INTERP, SHIM(PMC *_self));
+static  INTVAL  Parrot_Exception_get_integer(SHIM_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_Exception_get_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  INTVAL  Parrot_Exception_get_integer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key);
+static  PMC  * Parrot_Exception_get_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  void  * Parrot_Exception_get_pointer(SHIM_INTERP, ARGMOD(PMC *_self));
+static  STRING  * Parrot_Exception_get_string(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING  * Parrot_Exception_get_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  void  Parrot_Exception_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Exception_init_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL type);
+static  void  Parrot_Exception_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *values);
+static  INTVAL  Parrot_Exception_is_equal(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void  Parrot_Exception_mark(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Exception_set_attr_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name, PMC *value);
+static  void  Parrot_Exception_set_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, INTVAL value);
+static  void  Parrot_Exception_set_integer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key, INTVAL value);
+static  void  Parrot_Exception_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void  Parrot_Exception_set_number_native(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value);
+static  void  Parrot_Exception_set_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, PMC *value);
+static  void  Parrot_Exception_set_pointer(PARROT_INTERP, ARGMOD(PMC *_self), void *context);
+static  void  Parrot_Exception_set_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, STRING *value);
+static  void  Parrot_Exception_set_string_native(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value);
+static  void  Parrot_Exception_thaw(PARROT_INTERP, ARGMOD(PMC *_self), PMC *visit);
+static  void  Parrot_Exception_visit(PARROT_INTERP, ARGMOD(PMC *_self), PMC *visit);
+static  void Parrot_Exception_nci_annotations(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Exception_nci_backtrace(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Exception_nci_backtrace_strings(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_Exception_class_init(PARROT_INTERP, int, int);
+void    Parrot_Exception_ro_class_init(PARROT_INTERP, int, int);
+static  PMC  *
+Parrot_Exception_clone(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 199 "./src/pmc/exception.pmc"
+
+    PMC * const dest = Parrot_pmc_new(interp, _self->vtable->base_type);
+    INTVAL   id;
+    STRING   *message;
+    PMC      *payload;
+    INTVAL   severity;
+    INTVAL   type;
+    INTVAL   exit_code;
+    PMC      *bt_strings;
+    GETATTR_Exception_id(interp, _self, id);
+    SETATTR_Exception_id(interp, dest, id);
+    GETATTR_Exception_message(interp, _self, message);
+    SETATTR_Exception_message(interp, dest, message);
+    GETATTR_Exception_severity(interp, _self, severity);
+    SETATTR_Exception_severity(interp, dest, severity);
+    GETATTR_Exception_type(interp, _self, type);
+    SETATTR_Exception_type(interp, dest, type);
+    GETATTR_Exception_exit_code(interp, _self, exit_code);
+    SETATTR_Exception_exit_code(interp, dest, exit_code);
+    GETATTR_Exception_bt_strings(interp, _self, bt_strings);
+    if (!PMC_IS_NULL(bt_strings)) {
+        bt_strings = VTABLE_clone(interp, bt_strings);
+        SETATTR_Exception_bt_strings(interp, _self, bt_strings);
+    }
+
+    GETATTR_Exception_payload(interp, _self, payload);
+    if (!PMC_IS_NULL(payload)) {
+        payload = VTABLE_clone(interp, payload);
+        SETATTR_Exception_payload(interp, dest, payload);
+    }
+    return dest;
+#line 177 "./src/pmc/exception.c"
+}
+static  void 
+Parrot_Exception_freeze(PARROT_INTERP, ARGMOD(PMC *_self), PMC *visit)
+{
+#line 253 "./src/pmc/exception.pmc"
+
+    INTVAL type, severity, exit_code;
+    STRING *message;
+
+    GETATTR_Exception_type(interp, _self, type);
+    VTABLE_push_integer(interp, visit, type);
+
+    GETATTR_Exception_severity(interp, _self, severity);
+    VTABLE_push_integer(interp, visit, severity);
+
+    GETATTR_Exception_exit_code(interp, _self, exit_code);
+    VTABLE_push_integer(interp, visit, exit_code);
+
+    GETATTR_Exception_message(interp, _self, message);
+    VTABLE_push_string(interp, visit, message);
+#line 198 "./src/pmc/exception.c"
+}
+static  PMC  *
+Parrot_Exception_get_attr_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name)
+{
+#line 672 "./src/pmc/exception.pmc"
+
+    PMC *value = PMCNULL;
+
+    switch (getAttrEnum(interp, name)) {
+      case attr_type:
+        {
+        INTVAL type;
+        GETATTR_Exception_type(interp, _self, type);
+        value = Parrot_pmc_new_init_int(interp, enum_class_Integer, type);
+        }
+        break;
+      case attr_severity:
+        {
+        INTVAL severity;
+        GETATTR_Exception_severity(interp, _self, severity);
+        value = Parrot_pmc_new_init_int(interp, enum_class_Integer, severity);
+        }
+        break;
+      case attr_exit_code:
+        {
+        INTVAL exit_code;
+        GETATTR_Exception_exit_code(interp, _self, exit_code);
+        value = Parrot_pmc_new_init_int(interp, enum_class_Integer, exit_code);
+        }
+        break;
+      case attr_handled:
+        {
+        INTVAL handled;
+        GETATTR_Exception_handled(interp, _self, handled);
+        value = Parrot_pmc_new_init_int(interp, enum_class_Integer, handled);
+        }
+        break;
+      case attr_message:
+        {
+        STRING * const message = VTABLE_get_string(interp, _self);
+        value = Parrot_pmc_new(interp, enum_class_String);
+        VTABLE_set_string_native(interp, value, message);
+        }
+        break;
+      case attr_birthtime:
+        {
+        FLOATVAL birthtime;
+        GETATTR_Exception_birthtime(interp, _self, birthtime);
+        value = Parrot_pmc_new(interp, enum_class_Float);
+        VTABLE_set_number_native(interp, value, birthtime);
+        }
+        break;
+      case attr_payload:
+        GETATTR_Exception_payload(interp, _self, value);
+        break;
+      case attr_resume:
+        GETATTR_Exception_resume(interp, _self, value);
+        break;
+      case attr_backtrace:
+        GETATTR_Exception_backtrace(interp, _self, value);
+        break;
+      case attr_handler:
+        GETATTR_Exception_handler(interp, _self, value);
+        break;
+      case attr_thrower:
+        GETATTR_Exception_thrower(interp, _self, value);
+        break;
+      case attr_bt_strings:
+        GETATTR_Exception_bt_strings(interp, _self, value);
+        break;
+      case attr_NONE:
+        /* If unknown attribute name, throw an exception. */
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_ATTRIB_NOT_FOUND,
+            "No such attribute '%S'", name);
+      default:
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "Can't get attribute '%S'", name);
+    }
+
+    return value;
+#line 279 "./src/pmc/exception.c"
+}
+static  INTVAL 
+Parrot_Exception_get_bool(SHIM_INTERP, SHIM(PMC *_self))
+{
+#line 319 "./src/pmc/exception.pmc"
+
+    return 1;
+#line 287 "./src/pmc/exception.c"
+}
+static  INTVAL 
+Parrot_Exception_get_integer(SHIM_INTERP, ARGMOD(PMC *_self))
+{
+#line 351 "./src/pmc/exception.pmc"
+
+    const Parrot_Exception_attributes * const exception = PARROT_EXCEPTION(_self);
+    return exception->id;
+#line 296 "./src/pmc/exception.c"
+}
+static  INTVAL 
+Parrot_Exception_get_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 431 "./src/pmc/exception.pmc"
+
+    STRING * const name = VTABLE_get_string(interp, key);
+    return VTABLE_get_integer_keyed_str(interp, _self, name);
+#line 305 "./src/pmc/exception.c"
+}
+static  INTVAL 
+Parrot_Exception_get_integer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key)
+{
+#line 394 "./src/pmc/exception.pmc"
+
+    INTVAL result = 0;
+    switch (getAttrEnum(interp, key)) {
+      case attr_type:
+        GETATTR_Exception_type(interp, _self, result);
+        break;
+      case attr_severity:
+        GETATTR_Exception_severity(interp, _self, result);
+        break;
+      case attr_exit_code:
+        GETATTR_Exception_exit_code(interp, _self, result);
+        break;
+      case attr_handled:
+        GETATTR_Exception_handled(interp, _self, result);
+        break;
+      case attr_handlers_left:
+        GETATTR_Exception_handlers_left(interp, _self, result);
+        break;
+      default:
+        /* If unknown attribute name, throw an exception. */
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_ATTRIB_NOT_FOUND,
+            "No such integer attribute '%S'", key);
+    }
+
+    return result;
+#line 336 "./src/pmc/exception.c"
+}
+static  PMC  *
+Parrot_Exception_get_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 446 "./src/pmc/exception.pmc"
+
+    STRING * const s = VTABLE_get_string(interp, key);
+    return VTABLE_get_attr_str(interp, _self, s);
+#line 345 "./src/pmc/exception.c"
+}
+static  void  *
+Parrot_Exception_get_pointer(SHIM_INTERP, ARGMOD(PMC *_self))
+{
+#line 623 "./src/pmc/exception.pmc"
+
+    const Parrot_Exception_attributes * const core_struct = PARROT_EXCEPTION(_self);
+    return core_struct->handler_ctx;
+#line 354 "./src/pmc/exception.c"
+}
+static  STRING  *
+Parrot_Exception_get_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 333 "./src/pmc/exception.pmc"
+
+    STRING *message;
+    GETATTR_Exception_message(interp, _self, message);
+    if (STRING_IS_NULL(message))
+        message = CONST_STRING(interp, "");
+    return message;
+#line 366 "./src/pmc/exception.c"
+}
+static  STRING  *
+Parrot_Exception_get_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 368 "./src/pmc/exception.pmc"
+
+    STRING * const name = VTABLE_get_string(interp, key);
+    STRING *message;
+
+    if (STRING_equal(interp, name, CONST_STRING(interp, "message"))) {
+        message = VTABLE_get_string(interp, _self);
+    }
+    else {
+        /* If unknown attribute name, throw an exception. */
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_ATTRIB_NOT_FOUND,
+            "No such string attribute '%S'", name);
+    }
+
+    return message;
+#line 386 "./src/pmc/exception.c"
+}
+static  void 
+Parrot_Exception_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 120 "./src/pmc/exception.pmc"
+
+    /* Use custom mark */
+    PObj_custom_mark_SET(_self);
+
+    /* Set default values */
+    SETATTR_Exception_message(interp, _self, STRINGNULL);
+    SETATTR_Exception_payload(interp, _self, PMCNULL);
+    SETATTR_Exception_resume(interp, _self, PMCNULL);
+    SETATTR_Exception_severity(interp, _self, EXCEPT_error);
+    SETATTR_Exception_backtrace(interp, _self, PMCNULL);
+    SETATTR_Exception_handler(interp, _self, PMCNULL);
+    SETATTR_Exception_handler_ctx(interp, _self, PMCNULL);
+    SETATTR_Exception_thrower(interp, _self, PMCNULL);
+    SETATTR_Exception_bt_strings(interp, _self, PMCNULL);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 407 "./src/pmc/exception.c"
+}
+static  void 
+Parrot_Exception_init_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL type)
+{
+#line 146 "./src/pmc/exception.pmc"
+
+    VTABLE_init(interp, _self);
+    SETATTR_Exception_type(interp, _self, type);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 417 "./src/pmc/exception.c"
+}
+static  void 
+Parrot_Exception_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *values)
+{
+#line 161 "./src/pmc/exception.pmc"
+
+    INTVAL severity_val = EXCEPT_error;
+    STRING *message_val = NULL;
+
+    const INTVAL ishash = VTABLE_isa(interp, values, CONST_STRING(interp, "Hash"));
+
+    Parrot_Exception_init(interp, _self);
+
+    if (ishash) {
+        STRING * const severity = CONST_STRING(interp, "severity");
+        STRING * const message  = CONST_STRING(interp, "message");
+        severity_val = VTABLE_get_integer_keyed_str(interp, values, severity);
+        message_val = VTABLE_get_string_keyed_str(interp, values, message);
+    }
+    else
+        message_val  = VTABLE_get_string(interp, values);
+
+    /* Set up the values for the exception object. */
+
+    SETATTR_Exception_severity(interp, _self, severity_val);
+    if (! STRING_IS_NULL(message_val))
+        SETATTR_Exception_message(interp, _self, message_val);
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 447 "./src/pmc/exception.c"
+}
+static  INTVAL 
+Parrot_Exception_is_equal(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 640 "./src/pmc/exception.pmc"
+
+    STRING * const exception_str = CONST_STRING(interp, "Exception");
+
+    if (value->vtable->base_type == _self->vtable->base_type
+    &&  VTABLE_isa(interp, value, exception_str)) {
+        INTVAL self_compare, value_compare;
+        GETATTR_Exception_type(interp, _self, self_compare);
+        GETATTR_Exception_type(interp, value, value_compare);
+        if (self_compare == value_compare) {
+            GETATTR_Exception_severity(interp, _self, self_compare);
+            GETATTR_Exception_severity(interp, value, value_compare);
+            if (self_compare == value_compare) {
+                GETATTR_Exception_exit_code(interp, _self, self_compare);
+                GETATTR_Exception_exit_code(interp, value, value_compare);
+                if (self_compare == value_compare)
+                    return 1;
+            }
+        }
+    }
+
+    return 0;
+#line 474 "./src/pmc/exception.c"
+}
+static  void 
+Parrot_Exception_mark(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 297 "./src/pmc/exception.pmc"
+
+    Parrot_Exception_attributes * const core_struct = PARROT_EXCEPTION(_self);
+    Parrot_gc_mark_STRING_alive(interp, core_struct->message);
+    Parrot_gc_mark_PMC_alive(interp, core_struct->payload);
+    Parrot_gc_mark_PMC_alive(interp, core_struct->resume);
+    Parrot_gc_mark_PMC_alive(interp, core_struct->backtrace);
+    Parrot_gc_mark_PMC_alive(interp, core_struct->handler);
+    Parrot_gc_mark_PMC_alive(interp, core_struct->handler_ctx);
+    Parrot_gc_mark_PMC_alive(interp, core_struct->thrower);
+    Parrot_gc_mark_PMC_alive(interp, core_struct->bt_strings);
+#line 490 "./src/pmc/exception.c"
+}
+static  void 
+Parrot_Exception_set_attr_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name, PMC *value)
+{
+#line 758 "./src/pmc/exception.pmc"
+
+
+    switch (getAttrEnum(interp, name)) {
+      case attr_type:
+        {
+        const INTVAL type = VTABLE_get_integer(interp, value);
+        SETATTR_Exception_type(interp, _self, type);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        }
+        break;
+      case attr_severity:
+        {
+        const INTVAL severity = VTABLE_get_integer(interp, value);
+        SETATTR_Exception_severity(interp, _self, severity);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        }
+        break;
+      case attr_exit_code:
+        {
+        const INTVAL exit_code = VTABLE_get_integer(interp, value);
+        SETATTR_Exception_exit_code(interp, _self, exit_code);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        }
+        break;
+      case attr_handled:
+        {
+        const INTVAL handled = VTABLE_get_integer(interp, value);
+        SETATTR_Exception_handled(interp, _self, handled);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        }
+        break;
+      case attr_message:
+        {
+        STRING * const message = VTABLE_get_string(interp, value);
+        VTABLE_set_string_native(interp, _self, message);
+        }
+        break;
+      case attr_payload:
+        {
+        SETATTR_Exception_payload(interp, _self, value);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        }
+        break;
+      case attr_resume:
+        {
+        SETATTR_Exception_resume(interp, _self, value);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        }
+        break;
+      case attr_backtrace:
+        {
+        SETATTR_Exception_backtrace(interp, _self, value);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        }
+        break;
+      case attr_handler:
+        {
+        SETATTR_Exception_handler(interp, _self, value);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        }
+        break;
+      case attr_thrower:
+        {
+        SETATTR_Exception_thrower(interp, _self, value);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        }
+        break;
+      case attr_bt_strings:
+        {
+        SETATTR_Exception_bt_strings(interp, _self, value);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        }
+        break;
+      case attr_NONE:
+        /* If unknown attribute name, throw an exception. */
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_ATTRIB_NOT_FOUND,
+            "No such attribute '%S'", name);
+      default:
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "Can't set attribute '%S'", name);
+    }
+#line 577 "./src/pmc/exception.c"
+}
+static  void 
+Parrot_Exception_set_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, INTVAL value)
+{
+#line 578 "./src/pmc/exception.pmc"
+
+    STRING * const name = VTABLE_get_string(interp, key);
+    VTABLE_set_integer_keyed_str(interp, _self, name, value);
+#line 586 "./src/pmc/exception.c"
+}
+static  void 
+Parrot_Exception_set_integer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key, INTVAL value)
+{
+#line 529 "./src/pmc/exception.pmc"
+
+    switch (getAttrEnum(interp, key)) {
+      case attr_type:
+        {
+        SETATTR_Exception_type(interp, _self, value);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        }
+        break;
+      case attr_severity:
+        {
+        SETATTR_Exception_severity(interp, _self, value);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        }
+        break;
+      case attr_exit_code:
+        {
+        SETATTR_Exception_exit_code(interp, _self, value);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        }
+        break;
+      case attr_handled:
+        {
+        SETATTR_Exception_handled(interp, _self, value);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        }
+        break;
+      case attr_handlers_left:
+        {
+        SETATTR_Exception_handlers_left(interp, _self, value);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        }
+        break;
+      default:
+        /* If unknown attribute name, throw an exception. */
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_ATTRIB_NOT_FOUND,
+            "No such integer attribute '%S'", key);
+    }
+#line 629 "./src/pmc/exception.c"
+}
+static  void 
+Parrot_Exception_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+#line 477 "./src/pmc/exception.pmc"
+
+    SETATTR_Exception_id(interp, _self, value);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 638 "./src/pmc/exception.c"
+}
+static  void 
+Parrot_Exception_set_number_native(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value)
+{
+#line 491 "./src/pmc/exception.pmc"
+
+    SETATTR_Exception_birthtime(interp, _self, value);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 647 "./src/pmc/exception.c"
+}
+static  void 
+Parrot_Exception_set_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, PMC *value)
+{
+#line 593 "./src/pmc/exception.pmc"
+
+    STRING * const s = VTABLE_get_string(interp, key);
+    VTABLE_set_attr_str(interp, _self, s, value);
+#line 656 "./src/pmc/exception.c"
+}
+static  void 
+Parrot_Exception_set_pointer(PARROT_INTERP, ARGMOD(PMC *_self), void *context)
+{
+#line 608 "./src/pmc/exception.pmc"
+
+    Parrot_Exception_attributes * const core_struct = PARROT_EXCEPTION(_self);
+    core_struct->handler_ctx = (PMC*)context;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 666 "./src/pmc/exception.c"
+}
+static  void 
+Parrot_Exception_set_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, STRING *value)
+{
+#line 506 "./src/pmc/exception.pmc"
+
+    STRING * const name = VTABLE_get_string(interp, key);
+
+    if (STRING_equal(interp, name, CONST_STRING(interp, "message"))) {
+        VTABLE_set_string_native(interp, _self, value);
+    }
+    else {
+        /* If unknown attribute name, throw an exception. */
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_ATTRIB_NOT_FOUND,
+            "No such string attribute '%S'", name);
+    }
+#line 683 "./src/pmc/exception.c"
+}
+static  void 
+Parrot_Exception_set_string_native(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value)
+{
+#line 462 "./src/pmc/exception.pmc"
+
+    SETATTR_Exception_message(interp, _self, value);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 692 "./src/pmc/exception.c"
+}
+static  void 
+Parrot_Exception_thaw(PARROT_INTERP, ARGMOD(PMC *_self), PMC *visit)
+{
+#line 270 "./src/pmc/exception.pmc"
+
+    INTVAL type, severity, exit_code;
+    STRING *message;
+
+    type = VTABLE_shift_integer(interp, visit);
+    SETATTR_Exception_type(interp, _self, type);
+
+    severity = VTABLE_shift_integer(interp, visit);
+    SETATTR_Exception_severity(interp, _self, severity);
+
+    exit_code = VTABLE_shift_integer(interp, visit);
+    SETATTR_Exception_exit_code(interp, _self, exit_code);
+
+    message = VTABLE_shift_string(interp, visit);
+    SETATTR_Exception_message(interp, _self, message);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 714 "./src/pmc/exception.c"
+}
+static  void 
+Parrot_Exception_visit(PARROT_INTERP, ARGMOD(PMC *_self), PMC *visit)
+{
+#line 249 "./src/pmc/exception.pmc"
+
+    VISIT_PMC_ATTR(interp, visit, _self, Exception, payload);
+#line 722 "./src/pmc/exception.c"
+}
+static  void
+Parrot_Exception_nci_annotations(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* name;
+    INTVAL have_name;
+    
+    const INTVAL arity = 1; /* "PiSoIp" */
+    const INTVAL arity_opt  = 1;
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count < arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too few arguments: %d passed, %d expected",
+                                    param_count, arity);
+    if (param_count > arity + arity_opt)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too many arguments: %d passed, %d expected",
+                                    param_count, arity + arity_opt);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    if (param_count > 1) {
+        name = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+        have_name = 1;
+    }
+    else {
+        name = STRINGNULL;
+        have_name = 0;
+    }
+
+    { /* BEGIN PMETHOD BODY */
+#line 853 "./src/pmc/exception.pmc"
+
+    PMC *resume;
+    PMC *result = PMCNULL;
+
+    /* Get resume continuation, to find location we failed at. */
+    GETATTR_Exception_resume(interp, _self, resume);
+    if (!PMC_IS_NULL(resume)) {
+        const Parrot_Continuation_attributes * const cont = PARROT_CONTINUATION(resume);
+        if (cont->seg != NULL && cont->seg->annotations != NULL)
+            result = PackFile_Annotations_lookup(interp, cont->seg->annotations,
+                    cont->address - cont->seg->base.data, name);
+    }
+
+    /* If we didn't have a key specified and we found no annotations to
+     * return, should return an empty hash. */
+    if (!have_name && PMC_IS_NULL(result))
+        result = Parrot_pmc_new(interp, enum_class_Hash);
+
+    #line 777 "./src/pmc/exception.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)result);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return;
+     }
+#line 871 "./src/pmc/exception.pmc"
+
+#line 785 "./src/pmc/exception.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Exception_nci_backtrace(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 897 "./src/pmc/exception.pmc"
+
+    STRING * const meth_backtrace = CONST_STRING(interp, "backtrace");
+    PMC *result = PMCNULL;
+    PMC *resume;
+
+    /* Get starting context, then loop over them. */
+    GETATTR_Exception_resume(interp, _self, resume);
+    if (!PMC_IS_NULL(resume)) {
+        /* We have a resume continuation, so we can get the address from that. */
+        const Parrot_Continuation_attributes * const cont = PARROT_CONTINUATION(resume);
+        Parrot_pcc_invoke_method_from_c_args(interp, cont->to_ctx, meth_backtrace,
+                "P->P", resume, &result);
+    }
+    else {
+        /* Hopefully we have a thrower set - our most epic fail fallback is
+         * to just assume the thrower is the current context. */
+        PMC *cur_ctx;
+        GETATTR_Exception_thrower(interp, _self, cur_ctx);
+        if (PMC_IS_NULL(cur_ctx))
+            cur_ctx = CURRENT_CONTEXT(interp);
+        Parrot_pcc_invoke_method_from_c_args(interp, cur_ctx, meth_backtrace,
+                "->P", &result);
+    }
+
+    #line 837 "./src/pmc/exception.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)result);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return;
+     }
+#line 921 "./src/pmc/exception.pmc"
+
+#line 845 "./src/pmc/exception.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Exception_nci_backtrace_strings(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 924 "./src/pmc/exception.pmc"
+
+    PMC * bt_strings = PMCNULL;
+    STRING * const bt = Parrot_dbg_get_exception_backtrace(interp, _self);
+    GETATTR_Exception_bt_strings(interp, _self, bt_strings);
+    if (PMC_IS_NULL(bt_strings))
+        bt_strings = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+    VTABLE_push_string(interp, bt_strings, bt);
+    #line 880 "./src/pmc/exception.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)bt_strings);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return;
+     }
+#line 931 "./src/pmc/exception.pmc"
+
+#line 888 "./src/pmc/exception.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_Exception_update_vtable(VTABLE *vt) {
+    vt->clone = Parrot_Exception_clone;
+    vt->freeze = Parrot_Exception_freeze;
+    vt->get_attr_str = Parrot_Exception_get_attr_str;
+    vt->get_bool = Parrot_Exception_get_bool;
+    vt->get_integer = Parrot_Exception_get_integer;
+    vt->get_integer_keyed = Parrot_Exception_get_integer_keyed;
+    vt->get_integer_keyed_str = Parrot_Exception_get_integer_keyed_str;
+    vt->get_pmc_keyed = Parrot_Exception_get_pmc_keyed;
+    vt->get_pointer = Parrot_Exception_get_pointer;
+    vt->get_string = Parrot_Exception_get_string;
+    vt->get_string_keyed = Parrot_Exception_get_string_keyed;
+    vt->init = Parrot_Exception_init;
+    vt->init_int = Parrot_Exception_init_int;
+    vt->init_pmc = Parrot_Exception_init_pmc;
+    vt->is_equal = Parrot_Exception_is_equal;
+    vt->mark = Parrot_Exception_mark;
+    vt->set_attr_str = Parrot_Exception_set_attr_str;
+    vt->set_integer_keyed = Parrot_Exception_set_integer_keyed;
+    vt->set_integer_keyed_str = Parrot_Exception_set_integer_keyed_str;
+    vt->set_integer_native = Parrot_Exception_set_integer_native;
+    vt->set_number_native = Parrot_Exception_set_number_native;
+    vt->set_pmc_keyed = Parrot_Exception_set_pmc_keyed;
+    vt->set_pointer = Parrot_Exception_set_pointer;
+    vt->set_string_keyed = Parrot_Exception_set_string_keyed;
+    vt->set_string_native = Parrot_Exception_set_string_native;
+    vt->thaw = Parrot_Exception_thaw;
+    vt->visit = Parrot_Exception_visit;
+    vt->attr_size = sizeof(Parrot_Exception_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_Exception_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->clone = Parrot_Exception_clone;
+    vt->freeze = Parrot_Exception_freeze;
+    vt->get_attr_str = Parrot_Exception_get_attr_str;
+    vt->get_bool = Parrot_Exception_get_bool;
+    vt->get_integer = Parrot_Exception_get_integer;
+    vt->get_integer_keyed = Parrot_Exception_get_integer_keyed;
+    vt->get_integer_keyed_str = Parrot_Exception_get_integer_keyed_str;
+    vt->get_pmc_keyed = Parrot_Exception_get_pmc_keyed;
+    vt->get_pointer = Parrot_Exception_get_pointer;
+    vt->get_string = Parrot_Exception_get_string;
+    vt->get_string_keyed = Parrot_Exception_get_string_keyed;
+    vt->is_equal = Parrot_Exception_is_equal;
+    vt->mark = Parrot_Exception_mark;
+    vt->visit = Parrot_Exception_visit;
+    vt->attr_size = sizeof(Parrot_Exception_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Exception_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_Exception_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Exception_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_Exception_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_Exception_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "Exception"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_Exception_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "Exception")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_Exception_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "Iid Fbirthtime Smessage Fpayload Fresume Iseverity Itype Iexit_code Fbacktrace Ihandled Fhandler Fhandler_ctx Ihandlers_left Fthrower Fbt_strings ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_Exception_get_vtable(interp);
+        vt->base_type      = enum_class_Exception;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "Exception");
+        vt->provides_str = CONST_STRING_GEN(interp, "Exception");
+        vt->isa_hash     = Parrot_Exception_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_Exception_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_Exception;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_Exception_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "annotations");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Exception_nci_annotations),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "backtrace");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Exception_nci_backtrace),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "backtrace_strings");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Exception_nci_backtrace_strings),
+                method_name, signature);
+        }
+        {
+        }
+    } /* pass */
+} /* Parrot_Exception_class_init */
+
+#line 942 "./src/pmc/exception.pmc"
+
+
+/*
+
+=head2 Auxliary functions
+
+=over 4
+
+=item C<static AttrEnum getAttrEnum(PARROT_INTERP, const STRING *name)>
+
+Gets an enumerated value corresponding to the attribute with that name.
+
+=cut
+
+*/
+
+static AttrEnum
+getAttrEnum(PARROT_INTERP, ARGIN(const STRING *name))
+{
+    ASSERT_ARGS(getAttrEnum)
+
+    AttrEnum r;
+    if (STRING_equal(interp, name, CONST_STRING(interp, "birthtime")))
+        r = attr_birthtime;
+    else if (STRING_equal(interp, name, CONST_STRING(interp, "message")))
+        r = attr_message;
+    else if (STRING_equal(interp, name, CONST_STRING(interp, "payload")))
+        r = attr_payload;
+    else if (STRING_equal(interp, name, CONST_STRING(interp, "resume")))
+        r = attr_resume;
+    else if (STRING_equal(interp, name, CONST_STRING(interp, "severity")))
+        r = attr_severity;
+    else if (STRING_equal(interp, name, CONST_STRING(interp, "type")))
+        r = attr_type;
+    else if (STRING_equal(interp, name, CONST_STRING(interp, "exit_code")))
+        r = attr_exit_code;
+    else if (STRING_equal(interp, name, CONST_STRING(interp, "backtrace")))
+        r = attr_backtrace;
+    else if (STRING_equal(interp, name, CONST_STRING(interp, "handled")))
+        r = attr_handled;
+    else if (STRING_equal(interp, name, CONST_STRING(interp, "handler")))
+        r = attr_handler;
+    else if (STRING_equal(interp, name, CONST_STRING(interp, "handler_ctx")))
+        r = attr_handler_ctx;
+    else if (STRING_equal(interp, name, CONST_STRING(interp, "handlers_left")))
+        r = attr_handlers_left;
+    else if (STRING_equal(interp, name, CONST_STRING(interp, "thrower")))
+        r = attr_thrower;
+    else if (STRING_equal(interp, name, CONST_STRING(interp, "bt_strings")))
+        r = attr_bt_strings;
+    else
+        r = attr_NONE;
+    return r;
+}
+
+/*
+
+=back
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -0,0 +1,743 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/exceptionhandler.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_fixedintegerarray.h"
+#include "pmc_exceptionhandler.h"
+#include "pmc_continuation.h"
+#include "pmc_default.h"
+#include "exceptionhandler.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/exceptionhandler.pmc"
+/*
+Copyright (C) 2001-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/exceptionhandler.pmc - ExceptionHandler PMC
+
+=head1 DESCRIPTION
+
+When an exception handler is called, the exception object is passed as
+C<REG_PMC(interp, 5)>, the original contents of this register is in the
+exception object's C<_P5> attribute.
+
+=head2 Methods
+
+=over 4
+
+=cut
+
+*/
+
+#include "parrot/oplib/ops.h"
+#include "pmc/pmc_exception.h"
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+#line 52 "./src/pmc/exceptionhandler.c"
+static  PMC  * Parrot_ExceptionHandler_clone(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC *  Parrot_ExceptionHandler_get_attr_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *attr);
+static  INTVAL  Parrot_ExceptionHandler_get_integer(SHIM_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_ExceptionHandler_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_ExceptionHandler_init_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL handledtype);
+static  void  Parrot_ExceptionHandler_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *handledtype);
+static  opcode_t  * Parrot_ExceptionHandler_invoke(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(void *next));
+static  void  Parrot_ExceptionHandler_mark(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_ExceptionHandler_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void Parrot_ExceptionHandler_nci_can_handle(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_ExceptionHandler_nci_min_severity(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_ExceptionHandler_nci_max_severity(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_ExceptionHandler_nci_handle_types(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_ExceptionHandler_nci_handle_types_except(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_ExceptionHandler_class_init(PARROT_INTERP, int, int);
+void    Parrot_ExceptionHandler_ro_class_init(PARROT_INTERP, int, int);
+static  PMC  *
+Parrot_ExceptionHandler_clone(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 164 "./src/pmc/exceptionhandler.pmc"
+
+    PMC * const result = interp->vtables[enum_class_Continuation]->clone(interp, _self);
+    /* This looks wrong, why wouldn't we want to mark the clone? */
+    PObj_custom_mark_CLEAR(result);
+    return result;
+#line 78 "./src/pmc/exceptionhandler.c"
+}
+static  PMC * 
+Parrot_ExceptionHandler_get_attr_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *attr)
+{
+#line 140 "./src/pmc/exceptionhandler.pmc"
+
+    PMC * val = PMCNULL;
+    INTVAL ival;
+    /*if (STRING_equal(interp, attr, CONST_STRING(interp, "seg")))
+        GETATTR_ExceptionHandler_seg(interp, _self, val);*/
+    if (STRING_equal(interp, attr, CONST_STRING(interp, "to_ctx")))
+        GETATTR_ExceptionHandler_to_ctx(interp, _self, val);
+    else if (STRING_equal(interp, attr, CONST_STRING(interp, "to_call_object")))
+        GETATTR_ExceptionHandler_to_call_object(interp, _self, val);
+    else if (STRING_equal(interp, attr, CONST_STRING(interp, "from_ctx")))
+        GETATTR_ExceptionHandler_from_ctx(interp, _self, val);
+    else if (STRING_equal(interp, attr, CONST_STRING(interp, "runloop_id"))) {
+        GETATTR_ExceptionHandler_runloop_id(interp, _self, ival);
+        val = Parrot_pmc_box_integer(interp, ival);
+    }
+    else if (STRING_equal(interp, attr, CONST_STRING(interp, "invoked"))) {
+        GETATTR_ExceptionHandler_invoked(interp, _self, ival);
+        val = Parrot_pmc_box_integer(interp, ival);
+    }
+    else
+        val = interp->vtables[enum_class_Continuation]->get_attr_str(interp, _self, attr);
+    return val;
+#line 106 "./src/pmc/exceptionhandler.c"
+}
+static  INTVAL 
+Parrot_ExceptionHandler_get_integer(SHIM_INTERP, ARGMOD(PMC *_self))
+{
+#line 195 "./src/pmc/exceptionhandler.pmc"
+    return PARROT_CONTINUATION(_self)->invoked;
+#line 113 "./src/pmc/exceptionhandler.c"
+}
+static  void 
+Parrot_ExceptionHandler_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 46 "./src/pmc/exceptionhandler.pmc"
+
+    interp->vtables[enum_class_Continuation]->init(interp, _self);
+
+    /* an exception handler has no separate context; it's only a snapshot
+     * of an "earlier" context, which is contained in the interpreter's
+     * context - the stacks can only be deeper in the interpreter - so no
+     * mark of context is needed */
+    PObj_custom_mark_SET(_self);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 128 "./src/pmc/exceptionhandler.c"
+}
+static  void 
+Parrot_ExceptionHandler_init_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL handledtype)
+{
+#line 66 "./src/pmc/exceptionhandler.pmc"
+
+    Parrot_ExceptionHandler_attributes * const attrs = PARROT_EXCEPTIONHANDLER(_self);
+    VTABLE_init(interp, _self);
+
+    attrs->handled_types = Parrot_pmc_new_init_int(interp, enum_class_FixedIntegerArray, 1);
+    VTABLE_set_integer_keyed_int(interp, attrs->handled_types, 0, handledtype);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 141 "./src/pmc/exceptionhandler.c"
+}
+static  void 
+Parrot_ExceptionHandler_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *handledtype)
+{
+#line 86 "./src/pmc/exceptionhandler.pmc"
+
+    Parrot_ExceptionHandler_attributes * const attrs = PARROT_EXCEPTIONHANDLER(_self);
+    VTABLE_init(interp, _self);
+    if (handledtype->vtable->base_type == enum_class_Key) {
+        PMC *key;
+        /* check if the key only consists of integers */
+        for (key = handledtype; key; key = Parrot_key_next(interp, key))
+            if ((PObj_get_FLAGS(key) & KEY_type_FLAGS) != KEY_integer_FLAG)
+                break;
+        if (!key) {
+            /* yes, directly use the key */
+            attrs->handled_types = handledtype;
+            return;
+        }
+        /* no, create a RPA from the key */
+        attrs->handled_types = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+        for (key = handledtype; key; key = Parrot_key_next(interp, key))
+            VTABLE_push_integer(interp, attrs->handled_types, Parrot_key_integer(interp, key));
+    }
+    else {
+        INTVAL type = VTABLE_get_integer(interp, handledtype);
+        attrs->handled_types = Parrot_pmc_new_init_int(interp, enum_class_FixedIntegerArray, 1);
+        VTABLE_set_integer_keyed_int(interp, attrs->handled_types, 0, type);
+    }
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 172 "./src/pmc/exceptionhandler.c"
+}
+static  opcode_t  *
+Parrot_ExceptionHandler_invoke(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(void *next))
+{
+#line 212 "./src/pmc/exceptionhandler.pmc"
+    opcode_t    * const pc = PARROT_CONTINUATION(_self)->address;
+
+    Parrot_sub_continuation_check(interp, _self);
+    Parrot_sub_continuation_rewind_environment(interp, _self);
+
+    /* switch code segment if needed */
+    if (interp->code != PARROT_CONTINUATION(_self)->seg)
+        Parrot_switch_to_cs(interp, PARROT_CONTINUATION(_self)->seg, 1);
+
+    return pc;
+#line 188 "./src/pmc/exceptionhandler.c"
+}
+static  void 
+Parrot_ExceptionHandler_mark(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 122 "./src/pmc/exceptionhandler.pmc"
+
+    Parrot_ExceptionHandler_attributes * const attrs =
+        PARROT_EXCEPTIONHANDLER(_self);
+    Parrot_gc_mark_PMC_alive(interp, attrs->handled_types);
+    Parrot_gc_mark_PMC_alive(interp, attrs->handled_types_except);
+    interp->vtables[enum_class_Continuation]->mark(interp, _self);
+#line 200 "./src/pmc/exceptionhandler.c"
+}
+static  void 
+Parrot_ExceptionHandler_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+#line 181 "./src/pmc/exceptionhandler.pmc"
+
+    PARROT_CONTINUATION(_self)->invoked = value;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 209 "./src/pmc/exceptionhandler.c"
+}
+static  void
+Parrot_ExceptionHandler_nci_can_handle(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* exception;
+    
+    const INTVAL arity = 2; /* "PiP" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    exception = VTABLE_get_pmc_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 249 "./src/pmc/exceptionhandler.pmc"
+
+    STRING * const ex_str = CONST_STRING(interp, "Exception");
+
+    /* We handle Exception and anything that claims to implement that role
+       here. Include the base_type check as a sort of optimization */
+    if (exception->vtable->base_type == enum_class_Exception
+    ||  VTABLE_isa(interp, exception, ex_str)) {
+        INTVAL severity;
+        PMC *handled_types;
+        PMC *handled_types_except;
+        INTVAL min_severity, max_severity;
+        GETATTR_ExceptionHandler_max_severity(interp, _self, max_severity);
+        GETATTR_ExceptionHandler_min_severity(interp, _self, min_severity);
+
+        if (exception->vtable->base_type == enum_class_Exception)
+            GETATTR_Exception_severity(interp, exception, severity);
+        else {
+            STRING * const severity_str = CONST_STRING(interp, "severity");
+            severity = VTABLE_get_integer_keyed_str(interp, exception, severity_str);
+        }
+
+        if (severity < min_severity) {
+            #line 254 "./src/pmc/exceptionhandler.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)0);
+        
+        return;
+     }
+#line 271 "./src/pmc/exceptionhandler.pmc"
+
+        }
+        if (max_severity > 0 &&  severity > max_severity) {
+            #line 264 "./src/pmc/exceptionhandler.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)0);
+        
+        return;
+     }
+#line 274 "./src/pmc/exceptionhandler.pmc"
+
+        }
+
+        GETATTR_ExceptionHandler_handled_types(interp, _self, handled_types);
+        if (! PMC_IS_NULL(handled_types)) {
+            INTVAL type;
+
+            if (exception->vtable->base_type == enum_class_Exception)
+                GETATTR_Exception_type(interp, exception, type);
+            else {
+                STRING * const type_str = CONST_STRING(interp, "type");
+                type = VTABLE_get_integer_keyed_str(interp, exception, type_str);
+            }
+            if (handled_types->vtable->base_type == enum_class_Key) {
+                PMC *key = handled_types;
+                for (; key; key = Parrot_key_next(interp, key)) {
+                    const INTVAL handled_type = Parrot_key_integer(interp, key);
+                    if (handled_type == type ||
+                            handled_type == (type | EXCEPTION_TYPE_ALL_MASK))
+                        #line 290 "./src/pmc/exceptionhandler.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)1);
+        
+        return;
+     }
+#line 293 "./src/pmc/exceptionhandler.pmc"
+
+                }
+            }
+            else {
+                const INTVAL elems = VTABLE_elements(interp, handled_types);
+                INTVAL i;
+
+                for (i = 0; i < elems; ++i) {
+                    const INTVAL handled_type =
+                        VTABLE_get_integer_keyed_int(interp, handled_types, i);
+                    if (handled_type == type ||
+                            handled_type == (type | EXCEPTION_TYPE_ALL_MASK))
+                        #line 309 "./src/pmc/exceptionhandler.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)1);
+        
+        return;
+     }
+#line 305 "./src/pmc/exceptionhandler.pmc"
+
+                }
+            }
+
+            #line 320 "./src/pmc/exceptionhandler.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)0);
+        
+        return;
+     }
+#line 309 "./src/pmc/exceptionhandler.pmc"
+
+        }
+        GETATTR_ExceptionHandler_handled_types_except(interp, _self, handled_types_except);
+        if (! PMC_IS_NULL(handled_types_except)) {
+            const INTVAL elems = VTABLE_elements(interp, handled_types_except);
+            INTVAL i, type;
+
+            if (exception->vtable->base_type == enum_class_Exception)
+                GETATTR_Exception_type(interp, exception, type);
+            else {
+                STRING * const type_str = CONST_STRING(interp, "type");
+                type = VTABLE_get_integer_keyed_str(interp, exception, type_str);
+            }
+
+            for (i = 0; i < elems; ++i) {
+                const INTVAL handled_type = VTABLE_get_integer_keyed_int(interp,
+                        handled_types_except, i);
+                if (handled_type == type || handled_type == (type | EXCEPTION_TYPE_ALL_MASK))
+                    #line 345 "./src/pmc/exceptionhandler.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)0);
+        
+        return;
+     }
+#line 327 "./src/pmc/exceptionhandler.pmc"
+
+            }
+        }
+
+        #line 356 "./src/pmc/exceptionhandler.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)1);
+        
+        return;
+     }
+#line 331 "./src/pmc/exceptionhandler.pmc"
+
+    }
+
+    #line 366 "./src/pmc/exceptionhandler.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)0);
+        
+        return;
+     }
+#line 334 "./src/pmc/exceptionhandler.pmc"
+
+#line 374 "./src/pmc/exceptionhandler.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_ExceptionHandler_nci_min_severity(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    INTVAL severity;
+    INTVAL have_severity;
+    
+    const INTVAL arity = 1; /* "PiIoIp" */
+    const INTVAL arity_opt  = 1;
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count < arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too few arguments: %d passed, %d expected",
+                                    param_count, arity);
+    if (param_count > arity + arity_opt)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too many arguments: %d passed, %d expected",
+                                    param_count, arity + arity_opt);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    if (param_count > 1) {
+        severity = VTABLE_get_integer_keyed_int(interp, _call_object, 1);
+        have_severity = 1;
+    }
+    else {
+        severity = 0;
+        have_severity = 0;
+    }
+
+    { /* BEGIN PMETHOD BODY */
+#line 347 "./src/pmc/exceptionhandler.pmc"
+
+    Parrot_ExceptionHandler_attributes * const attrs =
+                PARROT_EXCEPTIONHANDLER(_self);
+
+    if (have_severity) {
+        attrs->min_severity = severity;
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+    }
+    else
+        severity = attrs->min_severity;
+
+    #line 429 "./src/pmc/exceptionhandler.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)severity);
+        
+        return;
+     }
+#line 358 "./src/pmc/exceptionhandler.pmc"
+
+#line 437 "./src/pmc/exceptionhandler.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_ExceptionHandler_nci_max_severity(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    INTVAL severity;
+    INTVAL have_severity;
+    
+    const INTVAL arity = 1; /* "PiIoIp" */
+    const INTVAL arity_opt  = 1;
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count < arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too few arguments: %d passed, %d expected",
+                                    param_count, arity);
+    if (param_count > arity + arity_opt)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too many arguments: %d passed, %d expected",
+                                    param_count, arity + arity_opt);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    if (param_count > 1) {
+        severity = VTABLE_get_integer_keyed_int(interp, _call_object, 1);
+        have_severity = 1;
+    }
+    else {
+        severity = 0;
+        have_severity = 0;
+    }
+
+    { /* BEGIN PMETHOD BODY */
+#line 371 "./src/pmc/exceptionhandler.pmc"
+
+    Parrot_ExceptionHandler_attributes * const attrs =
+                PARROT_EXCEPTIONHANDLER(_self);
+
+    if (have_severity) {
+        attrs->max_severity = severity;
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+    }
+    else
+        severity = attrs->max_severity;
+
+    #line 492 "./src/pmc/exceptionhandler.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)severity);
+        
+        return;
+     }
+#line 382 "./src/pmc/exceptionhandler.pmc"
+
+#line 500 "./src/pmc/exceptionhandler.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_ExceptionHandler_nci_handle_types(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* types;
+    
+    Parrot_pcc_fill_params_from_c_args(interp, _call_object, "PiPs",
+        &_self, &types);
+
+    { /* BEGIN PMETHOD BODY */
+#line 395 "./src/pmc/exceptionhandler.pmc"
+
+    Parrot_ExceptionHandler_attributes * const attrs =
+                PARROT_EXCEPTIONHANDLER(_self);
+    attrs->handled_types =
+        VTABLE_elements(interp, types) > 0
+            ? types
+            : PMCNULL;
+#line 530 "./src/pmc/exceptionhandler.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_ExceptionHandler_nci_handle_types_except(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* types;
+    
+    Parrot_pcc_fill_params_from_c_args(interp, _call_object, "PiPs",
+        &_self, &types);
+
+    { /* BEGIN PMETHOD BODY */
+#line 414 "./src/pmc/exceptionhandler.pmc"
+
+    Parrot_ExceptionHandler_attributes * const attrs =
+                PARROT_EXCEPTIONHANDLER(_self);
+    attrs->handled_types_except =
+        VTABLE_elements(interp, types) > 0
+            ? types
+            : PMCNULL;
+#line 560 "./src/pmc/exceptionhandler.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_ExceptionHandler_update_vtable(VTABLE *vt) {
+    vt->clone = Parrot_ExceptionHandler_clone;
+    vt->get_attr_str = Parrot_ExceptionHandler_get_attr_str;
+    vt->get_integer = Parrot_ExceptionHandler_get_integer;
+    vt->init = Parrot_ExceptionHandler_init;
+    vt->init_int = Parrot_ExceptionHandler_init_int;
+    vt->init_pmc = Parrot_ExceptionHandler_init_pmc;
+    vt->invoke = Parrot_ExceptionHandler_invoke;
+    vt->mark = Parrot_ExceptionHandler_mark;
+    vt->set_integer_native = Parrot_ExceptionHandler_set_integer_native;
+    vt->attr_size = sizeof(Parrot_ExceptionHandler_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_ExceptionHandler_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->clone = Parrot_ExceptionHandler_clone;
+    vt->get_attr_str = Parrot_ExceptionHandler_get_attr_str;
+    vt->get_integer = Parrot_ExceptionHandler_get_integer;
+    vt->invoke = Parrot_ExceptionHandler_invoke;
+    vt->mark = Parrot_ExceptionHandler_mark;
+    vt->attr_size = sizeof(Parrot_ExceptionHandler_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_ExceptionHandler_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_Continuation_get_vtable(interp);
+    Parrot_ExceptionHandler_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_ExceptionHandler_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_Continuation_ro_get_vtable(interp);
+    Parrot_ExceptionHandler_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_ExceptionHandler_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+    mro = Parrot_Continuation_get_mro(interp, mro);
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "ExceptionHandler"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_ExceptionHandler_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    isa = Parrot_Continuation_get_isa(interp, isa);
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "ExceptionHandler")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_ExceptionHandler_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        ":seg :address Fto_ctx Fto_call_object Ffrom_ctx Irunloop_id Iinvoked Fhandled_types Fhandled_types_except Imin_severity Imax_severity ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_ExceptionHandler_get_vtable(interp);
+        vt->base_type      = enum_class_ExceptionHandler;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "ExceptionHandler");
+        vt->provides_str = CONST_STRING_GEN(interp, "invokable");
+        vt->isa_hash     = Parrot_ExceptionHandler_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_ExceptionHandler_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_ExceptionHandler;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_ExceptionHandler_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "can_handle");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_ExceptionHandler_nci_can_handle),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "min_severity");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_ExceptionHandler_nci_min_severity),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "max_severity");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_ExceptionHandler_nci_max_severity),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "handle_types");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_ExceptionHandler_nci_handle_types),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "handle_types_except");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_ExceptionHandler_nci_handle_types_except),
+                method_name, signature);
+        }
+        {
+        }
+    } /* pass */
+} /* Parrot_ExceptionHandler_class_init */
+
+#line 422 "./src/pmc/exceptionhandler.pmc"
+
+
+/*
+
+=back
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
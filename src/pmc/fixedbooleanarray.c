@@ -0,0 +1,690 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/fixedbooleanarray.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_fixedintegerarray.h"
+#include "pmc_fixedbooleanarray.h"
+#include "pmc_default.h"
+#include "fixedbooleanarray.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/fixedbooleanarray.pmc"
+/*
+Copyright (C) 2001-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/fixedbooleanarray.pmc - FixedBooleanArray PMC
+
+=head1 DESCRIPTION
+
+Fixed size array for booleans only.
+
+The C<FixedBooleanArray> PMC implements an array of fixed size, which
+stores booleans.  It uses the C<Boolean> PMC for all conversions.  The
+C<FixedBooleanArray> PMC is extended by the C<ResizableBooleanArray>
+PMC.
+
+=head2 Functions
+
+=over 4
+
+=item C<static UINTVAL get_size_in_bytes(UINTVAL size)>
+
+Auxiliar function to avoid repeating the size evaluation.
+
+=cut
+
+*/
+
+#define BITS_PER_CHAR 8
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+PARROT_INLINE
+PARROT_CONST_FUNCTION
+static UINTVAL get_size_in_bytes(UINTVAL size);
+
+#define ASSERT_ARGS_get_size_in_bytes __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+PARROT_INLINE
+PARROT_CONST_FUNCTION
+static UINTVAL
+get_size_in_bytes(UINTVAL size)
+{
+    ASSERT_ARGS(get_size_in_bytes)
+
+    return (size + BITS_PER_CHAR - 1) / BITS_PER_CHAR;
+}
+#line 75 "./src/pmc/fixedbooleanarray.c"
+static  PMC  * Parrot_FixedBooleanArray_clone(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_FixedBooleanArray_destroy(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_FixedBooleanArray_elements(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_FixedBooleanArray_freeze(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+static  INTVAL  Parrot_FixedBooleanArray_get_bool(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_FixedBooleanArray_get_integer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_FixedBooleanArray_get_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  INTVAL  Parrot_FixedBooleanArray_get_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  PMC  * Parrot_FixedBooleanArray_get_iter(PARROT_INTERP, ARGMOD(PMC *_self));
+static  FLOATVAL  Parrot_FixedBooleanArray_get_number_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  FLOATVAL  Parrot_FixedBooleanArray_get_number_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  PMC  * Parrot_FixedBooleanArray_get_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  PMC  * Parrot_FixedBooleanArray_get_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  STRING  * Parrot_FixedBooleanArray_get_string(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING  * Parrot_FixedBooleanArray_get_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  STRING  * Parrot_FixedBooleanArray_get_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  void  Parrot_FixedBooleanArray_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_FixedBooleanArray_init_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL size);
+static  void  Parrot_FixedBooleanArray_set_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, INTVAL value);
+static  void  Parrot_FixedBooleanArray_set_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, INTVAL value);
+static  void  Parrot_FixedBooleanArray_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL size);
+static  void  Parrot_FixedBooleanArray_set_number_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, FLOATVAL value);
+static  void  Parrot_FixedBooleanArray_set_number_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, FLOATVAL value);
+static  void  Parrot_FixedBooleanArray_set_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, PMC *value);
+static  void  Parrot_FixedBooleanArray_set_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, PMC *src);
+static  void  Parrot_FixedBooleanArray_set_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, STRING *value);
+static  void  Parrot_FixedBooleanArray_set_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, STRING *value);
+static  void  Parrot_FixedBooleanArray_thaw(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+static  void Parrot_FixedBooleanArray_nci_fill(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_FixedBooleanArray_class_init(PARROT_INTERP, int, int);
+void    Parrot_FixedBooleanArray_ro_class_init(PARROT_INTERP, int, int);
+static  PMC  *
+Parrot_FixedBooleanArray_clone(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 131 "./src/pmc/fixedbooleanarray.pmc"
+
+    unsigned char * my_bit_array;
+    UINTVAL         resize_threshold, size;
+    PMC *   const   dest   = Parrot_pmc_new(interp, _self->vtable->base_type);
+
+    GETATTR_FixedBooleanArray_bit_array(interp, _self, my_bit_array);
+    GETATTR_FixedBooleanArray_size(interp, _self, size);
+    GETATTR_FixedBooleanArray_resize_threshold(interp, _self, resize_threshold);
+
+    if (my_bit_array) {
+        unsigned char * clone_bit_array;
+        const size_t size_in_bytes = get_size_in_bytes(resize_threshold);
+
+        SETATTR_FixedBooleanArray_size(interp, dest, size);
+        SETATTR_FixedBooleanArray_resize_threshold(interp, dest, resize_threshold);
+
+        clone_bit_array = mem_gc_allocate_n_typed(interp, size_in_bytes, unsigned char);
+        memcpy(clone_bit_array, my_bit_array, size_in_bytes);
+
+        SETATTR_FixedBooleanArray_bit_array(interp, dest, clone_bit_array);
+    }
+
+    PObj_custom_destroy_SET(dest);
+    return dest;
+#line 135 "./src/pmc/fixedbooleanarray.c"
+}
+static  void 
+Parrot_FixedBooleanArray_destroy(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 114 "./src/pmc/fixedbooleanarray.pmc"
+
+    unsigned char *bit_array;
+    GETATTR_FixedBooleanArray_bit_array(interp, _self, bit_array);
+    if (bit_array)
+        mem_gc_free(interp, bit_array);
+#line 146 "./src/pmc/fixedbooleanarray.c"
+}
+static  INTVAL 
+Parrot_FixedBooleanArray_elements(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 179 "./src/pmc/fixedbooleanarray.pmc"
+
+    UINTVAL size;
+    GETATTR_FixedBooleanArray_size(interp, _self, size);
+    return size;
+#line 156 "./src/pmc/fixedbooleanarray.c"
+}
+static  void 
+Parrot_FixedBooleanArray_freeze(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 555 "./src/pmc/fixedbooleanarray.pmc"
+
+    UINTVAL          size, resize_threshold;
+    unsigned char  * bit_array;
+    STRING   *       s;
+    GETATTR_FixedBooleanArray_size(interp, _self, size);
+    GETATTR_FixedBooleanArray_resize_threshold(interp, _self, resize_threshold);
+    GETATTR_FixedBooleanArray_bit_array(interp, _self, bit_array);
+
+    s = Parrot_str_new_init(interp, (char*)bit_array,
+            (resize_threshold / BITS_PER_CHAR),
+            Parrot_binary_encoding_ptr, 0);
+
+    VTABLE_push_integer(interp, info, size);
+    VTABLE_push_string(interp, info, s);
+#line 176 "./src/pmc/fixedbooleanarray.c"
+}
+static  INTVAL 
+Parrot_FixedBooleanArray_get_bool(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 167 "./src/pmc/fixedbooleanarray.pmc"
+
+    return VTABLE_elements(interp, _self) ? 1 : 0;
+#line 184 "./src/pmc/fixedbooleanarray.c"
+}
+static  INTVAL 
+Parrot_FixedBooleanArray_get_integer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 195 "./src/pmc/fixedbooleanarray.pmc"
+
+    return VTABLE_elements(interp, _self);
+#line 192 "./src/pmc/fixedbooleanarray.c"
+}
+static  INTVAL 
+Parrot_FixedBooleanArray_get_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 232 "./src/pmc/fixedbooleanarray.pmc"
+
+    /* simple int keys only */
+    const INTVAL k = VTABLE_get_integer(interp, key);
+    return VTABLE_get_integer_keyed_int(interp, _self, k);
+#line 202 "./src/pmc/fixedbooleanarray.c"
+}
+static  INTVAL 
+Parrot_FixedBooleanArray_get_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+#line 209 "./src/pmc/fixedbooleanarray.pmc"
+
+    UINTVAL               size;
+    const unsigned char * bit_array;
+    GETATTR_FixedBooleanArray_bit_array(interp, _self, bit_array);
+    GETATTR_FixedBooleanArray_size(interp, _self, size);
+
+    if (key < 0 || (UINTVAL)key >= size)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_OUT_OF_BOUNDS,
+            "FixedBooleanArray: index out of bounds!");
+
+    return (bit_array[key / BITS_PER_CHAR] & (1 << (key % BITS_PER_CHAR))) ? 1 : 0;
+#line 219 "./src/pmc/fixedbooleanarray.c"
+}
+static  PMC  *
+Parrot_FixedBooleanArray_get_iter(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 534 "./src/pmc/fixedbooleanarray.pmc"
+
+    return Parrot_pmc_new_init(interp, enum_class_ArrayIterator, _self);
+#line 227 "./src/pmc/fixedbooleanarray.c"
+}
+static  FLOATVAL 
+Parrot_FixedBooleanArray_get_number_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 264 "./src/pmc/fixedbooleanarray.pmc"
+
+    const INTVAL k = VTABLE_get_integer(interp, key);
+    return VTABLE_get_number_keyed_int(interp, _self, k);
+#line 236 "./src/pmc/fixedbooleanarray.c"
+}
+static  FLOATVAL 
+Parrot_FixedBooleanArray_get_number_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+#line 249 "./src/pmc/fixedbooleanarray.pmc"
+
+    const INTVAL i = VTABLE_get_integer_keyed_int(interp, _self, key);
+    return (FLOATVAL)i;
+#line 245 "./src/pmc/fixedbooleanarray.c"
+}
+static  PMC  *
+Parrot_FixedBooleanArray_get_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 352 "./src/pmc/fixedbooleanarray.pmc"
+
+    const INTVAL k = VTABLE_get_integer(interp, key);
+    return VTABLE_get_pmc_keyed_int(interp, _self, k);
+#line 254 "./src/pmc/fixedbooleanarray.c"
+}
+static  PMC  *
+Parrot_FixedBooleanArray_get_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+#line 337 "./src/pmc/fixedbooleanarray.pmc"
+
+    return Parrot_pmc_new_init_int(interp, enum_class_Boolean,
+            VTABLE_get_integer_keyed_int(interp, _self, key));
+#line 263 "./src/pmc/fixedbooleanarray.c"
+}
+static  STRING  *
+Parrot_FixedBooleanArray_get_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 279 "./src/pmc/fixedbooleanarray.pmc"
+
+    STRING *str   = STRINGNULL;
+    UINTVAL i;
+    const UINTVAL elems = VTABLE_elements(interp, _self);
+
+    const STRING * const zero = CONST_STRING(interp, "0");
+    const STRING * const one  = CONST_STRING(interp, "1");
+
+    for (i = 0; i < elems; ++i) {
+        str = Parrot_str_concat(interp, str,
+            VTABLE_get_integer_keyed_int(interp, _self, (INTVAL)i) ? one : zero);
+    }
+
+    return str;
+
+#line 284 "./src/pmc/fixedbooleanarray.c"
+}
+static  STRING  *
+Parrot_FixedBooleanArray_get_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 321 "./src/pmc/fixedbooleanarray.pmc"
+
+    const INTVAL k = VTABLE_get_integer(interp, key);
+    return VTABLE_get_string_keyed_int(interp, _self, k);
+#line 293 "./src/pmc/fixedbooleanarray.c"
+}
+static  STRING  *
+Parrot_FixedBooleanArray_get_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+#line 306 "./src/pmc/fixedbooleanarray.pmc"
+
+    PMC * const val = VTABLE_get_pmc_keyed_int(interp, _self, key);
+    return VTABLE_get_string(interp, val);
+#line 302 "./src/pmc/fixedbooleanarray.c"
+}
+static  void 
+Parrot_FixedBooleanArray_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 75 "./src/pmc/fixedbooleanarray.pmc"
+
+    PObj_custom_destroy_SET(_self);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 311 "./src/pmc/fixedbooleanarray.c"
+}
+static  void 
+Parrot_FixedBooleanArray_init_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL size)
+{
+#line 89 "./src/pmc/fixedbooleanarray.pmc"
+
+    const size_t size_in_bytes = get_size_in_bytes(size);
+
+    if (size < 0)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_OUT_OF_BOUNDS,
+            _("FixedBooleanArray: Cannot set array size to a negative number (%d)"), size);
+
+    SETATTR_FixedBooleanArray_size(interp, _self, size);
+    SETATTR_FixedBooleanArray_resize_threshold(interp, _self, size_in_bytes * BITS_PER_CHAR);
+    SETATTR_FixedBooleanArray_bit_array(interp, _self, mem_gc_allocate_n_zeroed_typed(interp, size_in_bytes,
+                                                                    unsigned char));
+    PObj_custom_destroy_SET(_self);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 330 "./src/pmc/fixedbooleanarray.c"
+}
+static  void 
+Parrot_FixedBooleanArray_set_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, INTVAL value)
+{
+#line 421 "./src/pmc/fixedbooleanarray.pmc"
+
+    const INTVAL k = VTABLE_get_integer(interp, key);
+    VTABLE_set_integer_keyed_int(interp, _self, k, value);
+#line 339 "./src/pmc/fixedbooleanarray.c"
+}
+static  void 
+Parrot_FixedBooleanArray_set_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, INTVAL value)
+{
+#line 395 "./src/pmc/fixedbooleanarray.pmc"
+
+    UINTVAL size;
+    unsigned char * bit_array;
+    GETATTR_FixedBooleanArray_bit_array(interp, _self, bit_array);
+    GETATTR_FixedBooleanArray_size(interp, _self, size);
+
+    if (key < 0 || (UINTVAL)key >= size)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_OUT_OF_BOUNDS,
+            "FixedBooleanArray: index out of bounds!");
+
+    if (value)
+        bit_array[key/BITS_PER_CHAR] |=  (1 << (key % BITS_PER_CHAR));
+    else
+        bit_array[key/BITS_PER_CHAR] &= ~(1 << (key % BITS_PER_CHAR));
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 360 "./src/pmc/fixedbooleanarray.c"
+}
+static  void 
+Parrot_FixedBooleanArray_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL size)
+{
+#line 367 "./src/pmc/fixedbooleanarray.pmc"
+
+    const size_t size_in_bytes = get_size_in_bytes(size);
+    UINTVAL old_size;
+    unsigned char *bit_array;
+
+    GETATTR_FixedBooleanArray_size(interp, _self, old_size);
+
+    if (old_size || size < 1)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_OUT_OF_BOUNDS,
+            "FixedBooleanArray: Can't resize!");
+
+    SETATTR_FixedBooleanArray_size(interp, _self, size);
+    SETATTR_FixedBooleanArray_resize_threshold(interp, _self, size_in_bytes * BITS_PER_CHAR);
+    bit_array = mem_gc_allocate_n_typed(interp, size_in_bytes, unsigned char);
+    memset(bit_array, 0, size_in_bytes);
+    SETATTR_FixedBooleanArray_bit_array(interp, _self, bit_array);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 383 "./src/pmc/fixedbooleanarray.c"
+}
+static  void 
+Parrot_FixedBooleanArray_set_number_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, FLOATVAL value)
+{
+#line 452 "./src/pmc/fixedbooleanarray.pmc"
+
+    const INTVAL k = VTABLE_get_integer(interp, key);
+    VTABLE_set_number_keyed_int(interp, _self, k, value);
+#line 392 "./src/pmc/fixedbooleanarray.c"
+}
+static  void 
+Parrot_FixedBooleanArray_set_number_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, FLOATVAL value)
+{
+#line 437 "./src/pmc/fixedbooleanarray.pmc"
+
+    VTABLE_set_integer_keyed_int(interp, _self, key, !FLOAT_IS_ZERO(value));
+#line 400 "./src/pmc/fixedbooleanarray.c"
+}
+static  void 
+Parrot_FixedBooleanArray_set_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, PMC *value)
+{
+#line 519 "./src/pmc/fixedbooleanarray.pmc"
+
+    const INTVAL k = VTABLE_get_integer(interp, key);
+    VTABLE_set_pmc_keyed_int(interp, _self, k, value);
+#line 409 "./src/pmc/fixedbooleanarray.c"
+}
+static  void 
+Parrot_FixedBooleanArray_set_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, PMC *src)
+{
+#line 503 "./src/pmc/fixedbooleanarray.pmc"
+
+    const INTVAL tempInt = VTABLE_get_integer(interp, src);
+    VTABLE_set_integer_keyed_int(interp, _self, key, tempInt);
+#line 418 "./src/pmc/fixedbooleanarray.c"
+}
+static  void 
+Parrot_FixedBooleanArray_set_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, STRING *value)
+{
+#line 488 "./src/pmc/fixedbooleanarray.pmc"
+
+    const INTVAL k = VTABLE_get_integer(interp, key);
+    VTABLE_set_string_keyed_int(interp, _self, k, value);
+#line 427 "./src/pmc/fixedbooleanarray.c"
+}
+static  void 
+Parrot_FixedBooleanArray_set_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, STRING *value)
+{
+#line 467 "./src/pmc/fixedbooleanarray.pmc"
+
+    INTVAL tempInt;
+    PMC * const tempPMC = Parrot_pmc_new(interp, enum_class_Boolean);
+
+    VTABLE_set_string_native(interp, tempPMC, value);
+    tempInt = VTABLE_get_integer(interp, tempPMC);
+
+    VTABLE_set_integer_keyed_int(interp, _self, key, tempInt);
+#line 441 "./src/pmc/fixedbooleanarray.c"
+}
+static  void 
+Parrot_FixedBooleanArray_thaw(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 580 "./src/pmc/fixedbooleanarray.pmc"
+
+    interp->vtables[enum_class_default]->thaw(interp, _self, info);
+
+    {
+        const INTVAL    size          = VTABLE_shift_integer(interp, info);
+        STRING * const  s             = VTABLE_shift_string(interp, info);
+        const size_t    size_in_bytes = get_size_in_bytes(size);
+        unsigned char  *bit_array;
+
+        VTABLE_set_integer_native(interp, _self, size);
+
+        if (s->bufused < size_in_bytes)
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_BAD_BUFFER_SIZE,
+                "FixedBooleanArray: invalid buffer size during thaw");
+
+        GETATTR_FixedBooleanArray_bit_array(interp, _self, bit_array);
+        memcpy(bit_array, s->strstart, size_in_bytes);
+    }
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 466 "./src/pmc/fixedbooleanarray.c"
+}
+static  void
+Parrot_FixedBooleanArray_nci_fill(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    INTVAL fill;
+    
+    const INTVAL arity = 2; /* "PiI" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    fill = VTABLE_get_integer_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 617 "./src/pmc/fixedbooleanarray.pmc"
+
+    UINTVAL         size;
+    unsigned char * bit_array;
+    size_t          size_in_bytes;
+
+    GETATTR_FixedBooleanArray_bit_array(interp, _self, bit_array);
+    GETATTR_FixedBooleanArray_size(interp, _self, size);
+    size_in_bytes  = get_size_in_bytes(size);
+
+    if (size_in_bytes)
+        memset(bit_array, fill ? 0xff : 0, size_in_bytes);
+#line 500 "./src/pmc/fixedbooleanarray.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_FixedBooleanArray_update_vtable(VTABLE *vt) {
+    vt->clone = Parrot_FixedBooleanArray_clone;
+    vt->destroy = Parrot_FixedBooleanArray_destroy;
+    vt->elements = Parrot_FixedBooleanArray_elements;
+    vt->freeze = Parrot_FixedBooleanArray_freeze;
+    vt->get_bool = Parrot_FixedBooleanArray_get_bool;
+    vt->get_integer = Parrot_FixedBooleanArray_get_integer;
+    vt->get_integer_keyed = Parrot_FixedBooleanArray_get_integer_keyed;
+    vt->get_integer_keyed_int = Parrot_FixedBooleanArray_get_integer_keyed_int;
+    vt->get_iter = Parrot_FixedBooleanArray_get_iter;
+    vt->get_number_keyed = Parrot_FixedBooleanArray_get_number_keyed;
+    vt->get_number_keyed_int = Parrot_FixedBooleanArray_get_number_keyed_int;
+    vt->get_pmc_keyed = Parrot_FixedBooleanArray_get_pmc_keyed;
+    vt->get_pmc_keyed_int = Parrot_FixedBooleanArray_get_pmc_keyed_int;
+    vt->get_string = Parrot_FixedBooleanArray_get_string;
+    vt->get_string_keyed = Parrot_FixedBooleanArray_get_string_keyed;
+    vt->get_string_keyed_int = Parrot_FixedBooleanArray_get_string_keyed_int;
+    vt->init = Parrot_FixedBooleanArray_init;
+    vt->init_int = Parrot_FixedBooleanArray_init_int;
+    vt->set_integer_keyed = Parrot_FixedBooleanArray_set_integer_keyed;
+    vt->set_integer_keyed_int = Parrot_FixedBooleanArray_set_integer_keyed_int;
+    vt->set_integer_native = Parrot_FixedBooleanArray_set_integer_native;
+    vt->set_number_keyed = Parrot_FixedBooleanArray_set_number_keyed;
+    vt->set_number_keyed_int = Parrot_FixedBooleanArray_set_number_keyed_int;
+    vt->set_pmc_keyed = Parrot_FixedBooleanArray_set_pmc_keyed;
+    vt->set_pmc_keyed_int = Parrot_FixedBooleanArray_set_pmc_keyed_int;
+    vt->set_string_keyed = Parrot_FixedBooleanArray_set_string_keyed;
+    vt->set_string_keyed_int = Parrot_FixedBooleanArray_set_string_keyed_int;
+    vt->thaw = Parrot_FixedBooleanArray_thaw;
+    vt->attr_size = sizeof(Parrot_FixedBooleanArray_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_FixedBooleanArray_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->clone = Parrot_FixedBooleanArray_clone;
+    vt->destroy = Parrot_FixedBooleanArray_destroy;
+    vt->elements = Parrot_FixedBooleanArray_elements;
+    vt->freeze = Parrot_FixedBooleanArray_freeze;
+    vt->get_bool = Parrot_FixedBooleanArray_get_bool;
+    vt->get_integer = Parrot_FixedBooleanArray_get_integer;
+    vt->get_integer_keyed = Parrot_FixedBooleanArray_get_integer_keyed;
+    vt->get_integer_keyed_int = Parrot_FixedBooleanArray_get_integer_keyed_int;
+    vt->get_iter = Parrot_FixedBooleanArray_get_iter;
+    vt->get_number_keyed = Parrot_FixedBooleanArray_get_number_keyed;
+    vt->get_number_keyed_int = Parrot_FixedBooleanArray_get_number_keyed_int;
+    vt->get_pmc_keyed = Parrot_FixedBooleanArray_get_pmc_keyed;
+    vt->get_pmc_keyed_int = Parrot_FixedBooleanArray_get_pmc_keyed_int;
+    vt->get_string = Parrot_FixedBooleanArray_get_string;
+    vt->get_string_keyed = Parrot_FixedBooleanArray_get_string_keyed;
+    vt->get_string_keyed_int = Parrot_FixedBooleanArray_get_string_keyed_int;
+    vt->attr_size = sizeof(Parrot_FixedBooleanArray_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_FixedBooleanArray_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_FixedBooleanArray_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_FixedBooleanArray_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_FixedBooleanArray_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_FixedBooleanArray_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "FixedBooleanArray"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_FixedBooleanArray_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "FixedBooleanArray")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_FixedBooleanArray_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        ":size :resize_threshold :bit_array ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_FixedBooleanArray_get_vtable(interp);
+        vt->base_type      = enum_class_FixedBooleanArray;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "FixedBooleanArray");
+        vt->provides_str = CONST_STRING_GEN(interp, "array");
+        vt->isa_hash     = Parrot_FixedBooleanArray_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_FixedBooleanArray_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_FixedBooleanArray;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_FixedBooleanArray_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "fill");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_FixedBooleanArray_nci_fill),
+                method_name, signature);
+        }
+        {
+        }
+    } /* pass */
+} /* Parrot_FixedBooleanArray_class_init */
+
+#line 628 "./src/pmc/fixedbooleanarray.pmc"
+
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<docs/pdds/pdd17_basic_types.pod>.
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -0,0 +1,900 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/fixedfloatarray.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_fixedintegerarray.h"
+#include "pmc_fixedfloatarray.h"
+#include "pmc_default.h"
+#include "fixedfloatarray.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/fixedfloatarray.pmc"
+/*
+Copyright (C) 2001-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/fixedfloatarray.pmc - FixedFloatArray PMC
+
+=head1 DESCRIPTION
+
+Fixed size array for floating point numbers only.
+
+This class, FixedFloatArray, implements an array of fixed size which
+stores FLOATVALs.  It uses Float PMCs to do all necessary conversions.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+#line 49 "./src/pmc/fixedfloatarray.c"
+static  PMC  * Parrot_FixedFloatArray_clone(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_FixedFloatArray_destroy(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_FixedFloatArray_elements(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_FixedFloatArray_get_bool(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_FixedFloatArray_get_integer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_FixedFloatArray_get_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  INTVAL  Parrot_FixedFloatArray_get_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  PMC  * Parrot_FixedFloatArray_get_iter(PARROT_INTERP, ARGMOD(PMC *_self));
+static  FLOATVAL  Parrot_FixedFloatArray_get_number_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  FLOATVAL  Parrot_FixedFloatArray_get_number_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  PMC  * Parrot_FixedFloatArray_get_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  PMC  * Parrot_FixedFloatArray_get_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  void *  Parrot_FixedFloatArray_get_pointer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING  * Parrot_FixedFloatArray_get_repr(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING  * Parrot_FixedFloatArray_get_string(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING  * Parrot_FixedFloatArray_get_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  STRING  * Parrot_FixedFloatArray_get_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  void  Parrot_FixedFloatArray_init_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL size);
+static  void  Parrot_FixedFloatArray_set_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, INTVAL value);
+static  void  Parrot_FixedFloatArray_set_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, INTVAL value);
+static  void  Parrot_FixedFloatArray_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL new_size);
+static  void  Parrot_FixedFloatArray_set_number_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, FLOATVAL value);
+static  void  Parrot_FixedFloatArray_set_number_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, FLOATVAL value);
+static  void  Parrot_FixedFloatArray_set_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, PMC *value);
+static  void  Parrot_FixedFloatArray_set_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, PMC *src);
+static  void  Parrot_FixedFloatArray_set_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, STRING *value);
+static  void  Parrot_FixedFloatArray_set_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, STRING *value);
+static  void Parrot_FixedFloatArray_nci_sort(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_FixedFloatArray_nci_reverse(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_FixedFloatArray_nci_parallel_map(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_FixedFloatArray_nci_parallel_each(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_FixedFloatArray_nci_parallel_reduce(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_FixedFloatArray_nci_parallel_sort(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_FixedFloatArray_class_init(PARROT_INTERP, int, int);
+void    Parrot_FixedFloatArray_ro_class_init(PARROT_INTERP, int, int);
+static  PMC  *
+Parrot_FixedFloatArray_clone(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 108 "./src/pmc/fixedfloatarray.pmc"
+
+    FLOATVAL *self_float_array;
+    PMC * const dest = Parrot_pmc_new(interp, _self->vtable->base_type);
+    GETATTR_FixedFloatArray_float_array(interp, _self, self_float_array);
+    if (self_float_array) {
+        INTVAL size;
+        GETATTR_FixedFloatArray_size(interp, _self, size);
+        {
+            FLOATVAL * const dest_float_array = mem_gc_allocate_n_typed(interp,
+                    size, FLOATVAL);
+            mem_copy_n_typed(dest_float_array, self_float_array,
+                    size, FLOATVAL);
+            SETATTR_FixedFloatArray_float_array(interp, dest, dest_float_array);
+        }
+        SETATTR_FixedFloatArray_size(interp, dest, size);
+        PObj_custom_destroy_SET(dest);
+    }
+    return dest;
+#line 107 "./src/pmc/fixedfloatarray.c"
+}
+static  void 
+Parrot_FixedFloatArray_destroy(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 72 "./src/pmc/fixedfloatarray.pmc"
+
+    FLOATVAL *float_array;
+    GETATTR_FixedFloatArray_float_array(interp, _self, float_array);
+    if (float_array)
+        mem_gc_free(interp, float_array);
+#line 118 "./src/pmc/fixedfloatarray.c"
+}
+static  INTVAL 
+Parrot_FixedFloatArray_elements(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 165 "./src/pmc/fixedfloatarray.pmc"
+
+    INTVAL size;
+    GETATTR_FixedFloatArray_size(interp, _self, size);
+    return size;
+#line 128 "./src/pmc/fixedfloatarray.c"
+}
+static  INTVAL 
+Parrot_FixedFloatArray_get_bool(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 152 "./src/pmc/fixedfloatarray.pmc"
+
+    const INTVAL size = VTABLE_elements(interp, _self);
+    return (INTVAL)(size != 0);
+#line 137 "./src/pmc/fixedfloatarray.c"
+}
+static  INTVAL 
+Parrot_FixedFloatArray_get_integer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 181 "./src/pmc/fixedfloatarray.pmc"
+
+    return VTABLE_elements(interp, _self);
+#line 145 "./src/pmc/fixedfloatarray.c"
+}
+static  INTVAL 
+Parrot_FixedFloatArray_get_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 211 "./src/pmc/fixedfloatarray.pmc"
+
+    /* simple int keys only */
+    const INTVAL k = VTABLE_get_integer(interp, key);
+    return VTABLE_get_integer_keyed_int(interp, _self, k);
+#line 155 "./src/pmc/fixedfloatarray.c"
+}
+static  INTVAL 
+Parrot_FixedFloatArray_get_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+#line 196 "./src/pmc/fixedfloatarray.pmc"
+
+    const FLOATVAL f = VTABLE_get_number_keyed_int(interp, _self, key);
+    return (INTVAL)f;
+#line 164 "./src/pmc/fixedfloatarray.c"
+}
+static  PMC  *
+Parrot_FixedFloatArray_get_iter(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 138 "./src/pmc/fixedfloatarray.pmc"
+
+    return Parrot_pmc_new_init(interp, enum_class_ArrayIterator, _self);
+#line 172 "./src/pmc/fixedfloatarray.c"
+}
+static  FLOATVAL 
+Parrot_FixedFloatArray_get_number_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 251 "./src/pmc/fixedfloatarray.pmc"
+
+    const INTVAL k = VTABLE_get_integer(interp, key);
+    return VTABLE_get_number_keyed_int(interp, _self, k);
+#line 181 "./src/pmc/fixedfloatarray.c"
+}
+static  FLOATVAL 
+Parrot_FixedFloatArray_get_number_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+#line 228 "./src/pmc/fixedfloatarray.pmc"
+
+    FLOATVAL *float_array;
+    INTVAL    size;
+
+    GETATTR_FixedFloatArray_size(interp, _self, size);
+    if (key < 0 || key >= size)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_OUT_OF_BOUNDS,
+            "FixedFloatArray: index out of bounds!");
+
+    GETATTR_FixedFloatArray_float_array(interp, _self, float_array);
+    return float_array[key];
+#line 198 "./src/pmc/fixedfloatarray.c"
+}
+static  PMC  *
+Parrot_FixedFloatArray_get_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 315 "./src/pmc/fixedfloatarray.pmc"
+
+    const INTVAL k = VTABLE_get_integer(interp, key);
+    return VTABLE_get_pmc_keyed_int(interp, _self, k);
+#line 207 "./src/pmc/fixedfloatarray.c"
+}
+static  PMC  *
+Parrot_FixedFloatArray_get_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+#line 297 "./src/pmc/fixedfloatarray.pmc"
+
+    PMC    * const ret = Parrot_pmc_new(interp, enum_class_Float);
+    const FLOATVAL val = VTABLE_get_number_keyed_int(interp, _self, key);
+
+    VTABLE_set_number_native(interp, ret, val);
+    return ret;
+#line 219 "./src/pmc/fixedfloatarray.c"
+}
+static  void * 
+Parrot_FixedFloatArray_get_pointer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 332 "./src/pmc/fixedfloatarray.pmc"
+
+    FLOATVAL *float_array;
+    GETATTR_FixedFloatArray_float_array(interp, _self, float_array);
+    return float_array;
+#line 229 "./src/pmc/fixedfloatarray.c"
+}
+static  STRING  *
+Parrot_FixedFloatArray_get_repr(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 512 "./src/pmc/fixedfloatarray.pmc"
+
+    STRING *str = CONST_STRING(interp, "[ ");
+    STRING *comma = CONST_STRING(interp, ", ");
+    UINTVAL i;
+    const UINTVAL elems = VTABLE_elements(interp, _self);
+
+    if (elems > 0)
+        str = Parrot_str_concat(interp, str,
+            VTABLE_get_string_keyed_int(interp, _self, 0));
+
+    for (i = 1; i < elems; ++i) {
+        str = Parrot_str_concat(interp, str, comma);
+        str = Parrot_str_concat(interp, str,
+            VTABLE_get_string_keyed_int(interp, _self, (INTVAL)i));
+    }
+
+    str = Parrot_str_concat(interp, str, CONST_STRING(interp, " ]"));
+    return str;
+#line 253 "./src/pmc/fixedfloatarray.c"
+}
+static  STRING  *
+Parrot_FixedFloatArray_get_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 508 "./src/pmc/fixedfloatarray.pmc"
+
+    return Parrot_FixedFloatArray_get_repr(interp, _self);
+#line 261 "./src/pmc/fixedfloatarray.c"
+}
+static  STRING  *
+Parrot_FixedFloatArray_get_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 281 "./src/pmc/fixedfloatarray.pmc"
+
+    const INTVAL k = VTABLE_get_integer(interp, key);
+    return VTABLE_get_string_keyed_int(interp, _self, k);
+#line 270 "./src/pmc/fixedfloatarray.c"
+}
+static  STRING  *
+Parrot_FixedFloatArray_get_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+#line 266 "./src/pmc/fixedfloatarray.pmc"
+
+    PMC * const e = VTABLE_get_pmc_keyed_int(interp, _self, key);
+    return VTABLE_get_string(interp, e);
+#line 279 "./src/pmc/fixedfloatarray.c"
+}
+static  void 
+Parrot_FixedFloatArray_init_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL size)
+{
+#line 89 "./src/pmc/fixedfloatarray.pmc"
+
+    if (size < 0)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_OUT_OF_BOUNDS,
+            _("FixedFloatArray: Cannot set array size to a negative number (%d)"), size);
+    SETATTR_FixedFloatArray_size(interp, _self, size);
+    SETATTR_FixedFloatArray_float_array(interp, _self, mem_gc_allocate_n_typed(interp, size, FLOATVAL));
+    PObj_custom_destroy_SET(_self);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 293 "./src/pmc/fixedfloatarray.c"
+}
+static  void 
+Parrot_FixedFloatArray_set_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, INTVAL value)
+{
+#line 385 "./src/pmc/fixedfloatarray.pmc"
+
+    const INTVAL k = VTABLE_get_integer(interp, key);
+    VTABLE_set_integer_keyed_int(interp, _self, k, value);
+#line 302 "./src/pmc/fixedfloatarray.c"
+}
+static  void 
+Parrot_FixedFloatArray_set_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, INTVAL value)
+{
+#line 371 "./src/pmc/fixedfloatarray.pmc"
+
+    VTABLE_set_number_keyed_int(interp, _self, key, (FLOATVAL)value);
+#line 310 "./src/pmc/fixedfloatarray.c"
+}
+static  void 
+Parrot_FixedFloatArray_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL new_size)
+{
+#line 348 "./src/pmc/fixedfloatarray.pmc"
+
+    INTVAL old_size;
+    GETATTR_FixedFloatArray_size(interp, _self, old_size);
+    if (old_size || new_size < 1)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_OUT_OF_BOUNDS,
+                "FixedFloatArray: Can't resize!");
+
+    SETATTR_FixedFloatArray_size(interp, _self, new_size);
+    SETATTR_FixedFloatArray_float_array(interp, _self,
+            mem_gc_allocate_n_typed(interp, new_size, FLOATVAL));
+    PObj_custom_destroy_SET(_self);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 328 "./src/pmc/fixedfloatarray.c"
+}
+static  void 
+Parrot_FixedFloatArray_set_number_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, FLOATVAL value)
+{
+#line 425 "./src/pmc/fixedfloatarray.pmc"
+
+    const INTVAL k = VTABLE_get_integer(interp, key);
+    VTABLE_set_number_keyed_int(interp, _self, k, value);
+#line 337 "./src/pmc/fixedfloatarray.c"
+}
+static  void 
+Parrot_FixedFloatArray_set_number_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, FLOATVAL value)
+{
+#line 401 "./src/pmc/fixedfloatarray.pmc"
+
+    FLOATVAL *float_array;
+    INTVAL size;
+
+    GETATTR_FixedFloatArray_size(interp, _self, size);
+    if (key < 0 || key >= size)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_OUT_OF_BOUNDS,
+            "FixedFloatArray: index out of bounds!");
+
+    GETATTR_FixedFloatArray_float_array(interp, _self, float_array);
+    float_array[key] = value;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 355 "./src/pmc/fixedfloatarray.c"
+}
+static  void 
+Parrot_FixedFloatArray_set_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, PMC *value)
+{
+#line 491 "./src/pmc/fixedfloatarray.pmc"
+
+    const INTVAL k = VTABLE_get_integer(interp, key);
+    VTABLE_set_pmc_keyed_int(interp, _self, k, value);
+#line 364 "./src/pmc/fixedfloatarray.c"
+}
+static  void 
+Parrot_FixedFloatArray_set_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, PMC *src)
+{
+#line 475 "./src/pmc/fixedfloatarray.pmc"
+
+    const FLOATVAL tempNum = VTABLE_get_number(interp, src);
+    VTABLE_set_number_keyed_int(interp, _self, key, tempNum);
+#line 373 "./src/pmc/fixedfloatarray.c"
+}
+static  void 
+Parrot_FixedFloatArray_set_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, STRING *value)
+{
+#line 460 "./src/pmc/fixedfloatarray.pmc"
+
+    const INTVAL k = VTABLE_get_integer(interp, key);
+    VTABLE_set_string_keyed_int(interp, _self, k, value);
+#line 382 "./src/pmc/fixedfloatarray.c"
+}
+static  void 
+Parrot_FixedFloatArray_set_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, STRING *value)
+{
+#line 440 "./src/pmc/fixedfloatarray.pmc"
+
+    FLOATVAL tempNum;
+    PMC * const tempPMC = Parrot_pmc_new(interp, enum_class_Float);
+
+    VTABLE_set_string_native(interp, tempPMC, value);
+    tempNum = VTABLE_get_number(interp, tempPMC);
+    VTABLE_set_number_keyed_int(interp, _self, key, tempNum);
+#line 395 "./src/pmc/fixedfloatarray.c"
+}
+static  void
+Parrot_FixedFloatArray_nci_sort(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* cmp_func;
+    STRING* _param_name_str_key = CONST_STRING_GEN(interp, "key");
+    PMC* key;
+    
+    Parrot_pcc_fill_params_from_c_args(interp, _call_object, "PiPoSnPo",
+        &_self, &cmp_func, &_param_name_str_key, &key);
+
+    { /* BEGIN PMETHOD BODY */
+#line 48 "./src/pmc/fixedfloatarray.pmc"
+
+    INTVAL size;
+
+    GETATTR_FixedFloatArray_size(interp, _self, size);
+
+    if (size > 1) {
+        FLOATVAL *float_array;
+        GETATTR_FixedFloatArray_float_array(interp, _self, float_array);
+        Parrot_util_sort(interp, enum_type_FLOATVAL, float_array, (UINTVAL)size,
+                cmp_func, key);
+    }
+    #line 424 "./src/pmc/fixedfloatarray.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)_self);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return;
+     }
+#line 59 "./src/pmc/fixedfloatarray.pmc"
+
+#line 432 "./src/pmc/fixedfloatarray.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_FixedFloatArray_nci_reverse(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 542 "./src/pmc/fixedfloatarray.pmc"
+
+    INTVAL n;
+    GETATTR_FixedFloatArray_size(interp, _self, n);
+    if (n > 1) {
+        FLOATVAL val;
+        FLOATVAL *data;
+        INTVAL i;
+
+        GETATTR_FixedFloatArray_float_array(interp, _self, data);
+        for (i = 0; i <= --n; i++) {
+            val = data[i];
+            data[i] = data[n];
+            data[n] = val;
+        }
+    }
+#line 475 "./src/pmc/fixedfloatarray.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_FixedFloatArray_nci_parallel_map(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* sub;
+    
+    const INTVAL arity = 2; /* "PiP" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    sub = VTABLE_get_pmc_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 587 "./src/pmc/fixedfloatarray.pmc"
+
+    FLOATVAL *float_array;
+    INTVAL    size;
+
+    GETATTR_FixedFloatArray_size(interp, _self, size);
+    GETATTR_FixedFloatArray_float_array(interp, _self, float_array);
+    Parrot_parallel_map(interp, enum_type_FLOATVAL, float_array, size, sub);
+    #line 512 "./src/pmc/fixedfloatarray.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)_self);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return;
+     }
+#line 594 "./src/pmc/fixedfloatarray.pmc"
+
+#line 520 "./src/pmc/fixedfloatarray.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_FixedFloatArray_nci_parallel_each(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* sub;
+    
+    const INTVAL arity = 2; /* "PiP" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    sub = VTABLE_get_pmc_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 597 "./src/pmc/fixedfloatarray.pmc"
+
+    FLOATVAL *float_array;
+    INTVAL    size;
+
+    GETATTR_FixedFloatArray_size(interp, _self, size);
+    GETATTR_FixedFloatArray_float_array(interp, _self, float_array);
+    Parrot_parallel_each(interp, enum_type_FLOATVAL, float_array, size, sub);
+#line 557 "./src/pmc/fixedfloatarray.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_FixedFloatArray_nci_parallel_reduce(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* sub;
+    FLOATVAL init;
+    INTVAL has_init;
+    
+    const INTVAL arity = 2; /* "PiPNoIp" */
+    const INTVAL arity_opt  = 1;
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count < arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too few arguments: %d passed, %d expected",
+                                    param_count, arity);
+    if (param_count > arity + arity_opt)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too many arguments: %d passed, %d expected",
+                                    param_count, arity + arity_opt);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    sub = VTABLE_get_pmc_keyed_int(interp, _call_object, 1);
+    if (param_count > 2) {
+        init = VTABLE_get_number_keyed_int(interp, _call_object, 2);
+        has_init = 1;
+    }
+    else {
+        init = 0.0;
+        has_init = 0;
+    }
+
+    { /* BEGIN PMETHOD BODY */
+#line 607 "./src/pmc/fixedfloatarray.pmc"
+
+    FLOATVAL *float_array;
+    INTVAL    size;
+
+    GETATTR_FixedFloatArray_size(interp, _self, size);
+    GETATTR_FixedFloatArray_float_array(interp, _self, float_array);
+    Parrot_parallel_reduce(interp, enum_type_FLOATVAL, float_array, size, sub,
+            &init, has_init);
+    #line 611 "./src/pmc/fixedfloatarray.c"
+     {
+        VTABLE_set_number_keyed_int(interp, _call_object, 0, (FLOATVAL)init);
+        
+        return;
+     }
+#line 615 "./src/pmc/fixedfloatarray.pmc"
+
+#line 619 "./src/pmc/fixedfloatarray.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_FixedFloatArray_nci_parallel_sort(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* cmp_func;
+    
+    const INTVAL arity = 1; /* "PiPo" */
+    const INTVAL arity_opt  = 1;
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count < arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too few arguments: %d passed, %d expected",
+                                    param_count, arity);
+    if (param_count > arity + arity_opt)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too many arguments: %d passed, %d expected",
+                                    param_count, arity + arity_opt);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    if (param_count > 1) {
+        cmp_func = VTABLE_get_pmc_keyed_int(interp, _call_object, 1);
+    }
+    else {
+        cmp_func = PMCNULL;
+    }
+
+    { /* BEGIN PMETHOD BODY */
+#line 618 "./src/pmc/fixedfloatarray.pmc"
+
+    FLOATVAL *float_array;
+    INTVAL    size;
+
+    GETATTR_FixedFloatArray_size(interp, _self, size);
+    GETATTR_FixedFloatArray_float_array(interp, _self, float_array);
+    Parrot_parallel_sort(interp, enum_type_FLOATVAL, float_array, size, cmp_func);
+    #line 667 "./src/pmc/fixedfloatarray.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)_self);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return;
+     }
+#line 625 "./src/pmc/fixedfloatarray.pmc"
+
+#line 675 "./src/pmc/fixedfloatarray.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_FixedFloatArray_update_vtable(VTABLE *vt) {
+    vt->clone = Parrot_FixedFloatArray_clone;
+    vt->destroy = Parrot_FixedFloatArray_destroy;
+    vt->elements = Parrot_FixedFloatArray_elements;
+    vt->get_bool = Parrot_FixedFloatArray_get_bool;
+    vt->get_integer = Parrot_FixedFloatArray_get_integer;
+    vt->get_integer_keyed = Parrot_FixedFloatArray_get_integer_keyed;
+    vt->get_integer_keyed_int = Parrot_FixedFloatArray_get_integer_keyed_int;
+    vt->get_iter = Parrot_FixedFloatArray_get_iter;
+    vt->get_number_keyed = Parrot_FixedFloatArray_get_number_keyed;
+    vt->get_number_keyed_int = Parrot_FixedFloatArray_get_number_keyed_int;
+    vt->get_pmc_keyed = Parrot_FixedFloatArray_get_pmc_keyed;
+    vt->get_pmc_keyed_int = Parrot_FixedFloatArray_get_pmc_keyed_int;
+    vt->get_pointer = Parrot_FixedFloatArray_get_pointer;
+    vt->get_repr = Parrot_FixedFloatArray_get_repr;
+    vt->get_string = Parrot_FixedFloatArray_get_string;
+    vt->get_string_keyed = Parrot_FixedFloatArray_get_string_keyed;
+    vt->get_string_keyed_int = Parrot_FixedFloatArray_get_string_keyed_int;
+    vt->init_int = Parrot_FixedFloatArray_init_int;
+    vt->set_integer_keyed = Parrot_FixedFloatArray_set_integer_keyed;
+    vt->set_integer_keyed_int = Parrot_FixedFloatArray_set_integer_keyed_int;
+    vt->set_integer_native = Parrot_FixedFloatArray_set_integer_native;
+    vt->set_number_keyed = Parrot_FixedFloatArray_set_number_keyed;
+    vt->set_number_keyed_int = Parrot_FixedFloatArray_set_number_keyed_int;
+    vt->set_pmc_keyed = Parrot_FixedFloatArray_set_pmc_keyed;
+    vt->set_pmc_keyed_int = Parrot_FixedFloatArray_set_pmc_keyed_int;
+    vt->set_string_keyed = Parrot_FixedFloatArray_set_string_keyed;
+    vt->set_string_keyed_int = Parrot_FixedFloatArray_set_string_keyed_int;
+    vt->attr_size = sizeof(Parrot_FixedFloatArray_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_FixedFloatArray_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->clone = Parrot_FixedFloatArray_clone;
+    vt->destroy = Parrot_FixedFloatArray_destroy;
+    vt->elements = Parrot_FixedFloatArray_elements;
+    vt->get_bool = Parrot_FixedFloatArray_get_bool;
+    vt->get_integer = Parrot_FixedFloatArray_get_integer;
+    vt->get_integer_keyed = Parrot_FixedFloatArray_get_integer_keyed;
+    vt->get_integer_keyed_int = Parrot_FixedFloatArray_get_integer_keyed_int;
+    vt->get_iter = Parrot_FixedFloatArray_get_iter;
+    vt->get_number_keyed = Parrot_FixedFloatArray_get_number_keyed;
+    vt->get_number_keyed_int = Parrot_FixedFloatArray_get_number_keyed_int;
+    vt->get_pmc_keyed = Parrot_FixedFloatArray_get_pmc_keyed;
+    vt->get_pmc_keyed_int = Parrot_FixedFloatArray_get_pmc_keyed_int;
+    vt->get_pointer = Parrot_FixedFloatArray_get_pointer;
+    vt->get_repr = Parrot_FixedFloatArray_get_repr;
+    vt->get_string = Parrot_FixedFloatArray_get_string;
+    vt->get_string_keyed = Parrot_FixedFloatArray_get_string_keyed;
+    vt->get_string_keyed_int = Parrot_FixedFloatArray_get_string_keyed_int;
+    vt->attr_size = sizeof(Parrot_FixedFloatArray_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_FixedFloatArray_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_FixedFloatArray_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_FixedFloatArray_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_FixedFloatArray_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_FixedFloatArray_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "FixedFloatArray"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_FixedFloatArray_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "FixedFloatArray")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_FixedFloatArray_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "Isize :float_array ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_FixedFloatArray_get_vtable(interp);
+        vt->base_type      = enum_class_FixedFloatArray;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "FixedFloatArray");
+        vt->provides_str = CONST_STRING_GEN(interp, "array");
+        vt->isa_hash     = Parrot_FixedFloatArray_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_FixedFloatArray_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_FixedFloatArray;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_FixedFloatArray_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "sort");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_FixedFloatArray_nci_sort),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "reverse");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_FixedFloatArray_nci_reverse),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "parallel_map");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_FixedFloatArray_nci_parallel_map),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "parallel_each");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_FixedFloatArray_nci_parallel_each),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "parallel_reduce");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_FixedFloatArray_nci_parallel_reduce),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "parallel_sort");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_FixedFloatArray_nci_parallel_sort),
+                method_name, signature);
+        }
+        {
+        }
+    } /* pass */
+} /* Parrot_FixedFloatArray_class_init */
+
+#line 627 "./src/pmc/fixedfloatarray.pmc"
+
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<docs/pdds/pdd17_basic_types.pod>.
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
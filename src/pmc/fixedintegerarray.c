@@ -0,0 +1,1000 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/fixedintegerarray.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_fixedintegerarray.h"
+#include "pmc_fixedintegerarray.h"
+#include "pmc_default.h"
+#include "fixedintegerarray.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/fixedintegerarray.pmc"
+/*
+Copyright (C) 2001-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/fixedintegerarray.pmc - FixedIntegerArray PMC
+
+=head1 DESCRIPTION
+
+Fixed size array for integers only.
+
+This class, FixedIntegerArray, implements an array of fixed size which stores
+INTVALs.  It uses Integer PMCs for all of the conversions.
+
+=cut
+
+*/
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+#line 45 "./src/pmc/fixedintegerarray.c"
+static  PMC  * Parrot_FixedIntegerArray_clone(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_FixedIntegerArray_destroy(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_FixedIntegerArray_elements(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_FixedIntegerArray_freeze(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+static  INTVAL  Parrot_FixedIntegerArray_get_bool(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_FixedIntegerArray_get_integer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_FixedIntegerArray_get_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  INTVAL  Parrot_FixedIntegerArray_get_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  PMC  * Parrot_FixedIntegerArray_get_iter(PARROT_INTERP, ARGMOD(PMC *_self));
+static  FLOATVAL  Parrot_FixedIntegerArray_get_number_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  FLOATVAL  Parrot_FixedIntegerArray_get_number_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  PMC  * Parrot_FixedIntegerArray_get_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  PMC  * Parrot_FixedIntegerArray_get_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  STRING  * Parrot_FixedIntegerArray_get_repr(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING  * Parrot_FixedIntegerArray_get_string(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING  * Parrot_FixedIntegerArray_get_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  STRING  * Parrot_FixedIntegerArray_get_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  INTVAL  Parrot_FixedIntegerArray_hashvalue(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_FixedIntegerArray_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_FixedIntegerArray_init_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL size);
+static  INTVAL  Parrot_FixedIntegerArray_is_equal(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void  Parrot_FixedIntegerArray_set_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, INTVAL value);
+static  void  Parrot_FixedIntegerArray_set_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, INTVAL value);
+static  void  Parrot_FixedIntegerArray_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL size);
+static  void  Parrot_FixedIntegerArray_set_number_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, FLOATVAL value);
+static  void  Parrot_FixedIntegerArray_set_number_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, FLOATVAL value);
+static  void  Parrot_FixedIntegerArray_set_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, PMC *value);
+static  void  Parrot_FixedIntegerArray_set_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, PMC *src);
+static  void  Parrot_FixedIntegerArray_set_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, STRING *value);
+static  void  Parrot_FixedIntegerArray_set_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, STRING *value);
+static  void  Parrot_FixedIntegerArray_thaw(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+static  void Parrot_FixedIntegerArray_nci_sort(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_FixedIntegerArray_nci_reverse(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_FixedIntegerArray_nci_parallel_map(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_FixedIntegerArray_nci_parallel_each(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_FixedIntegerArray_nci_parallel_reduce(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_FixedIntegerArray_nci_parallel_sort(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_FixedIntegerArray_class_init(PARROT_INTERP, int, int);
+void    Parrot_FixedIntegerArray_ro_class_init(PARROT_INTERP, int, int);
+static  PMC  *
+Parrot_FixedIntegerArray_clone(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 94 "./src/pmc/fixedintegerarray.pmc"
+
+    /* a quick hack to create a clone in the constant PMC arena
+     * this is needed for the call signatures
+     *
+     * a better way would be probably to supply a flag to the clone
+     * vtable
+     */
+
+    INTVAL * int_array;
+    PMC    * const dest = Parrot_pmc_new(interp, _self->vtable->base_type);
+
+    GETATTR_FixedIntegerArray_int_array(interp, _self, int_array);
+
+    if (int_array) {
+        INTVAL size;
+        GETATTR_FixedIntegerArray_size(interp, _self, size);
+        {
+            INTVAL * const dest_int_array = mem_gc_allocate_n_typed(interp,
+                    size, INTVAL);
+            mem_copy_n_typed(dest_int_array, int_array,
+                    size, INTVAL);
+            SETATTR_FixedIntegerArray_int_array(interp, dest, dest_int_array);
+        }
+        SETATTR_FixedIntegerArray_size(interp, dest, size);
+        PObj_custom_destroy_SET(dest);
+    }
+
+    #line 116 "./src/pmc/fixedintegerarray.c"
+    return (PMC*)dest;
+#line 121 "./src/pmc/fixedintegerarray.pmc"
+
+#line 120 "./src/pmc/fixedintegerarray.c"
+}
+static  void 
+Parrot_FixedIntegerArray_destroy(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 77 "./src/pmc/fixedintegerarray.pmc"
+
+    INTVAL* int_array;
+    GETATTR_FixedIntegerArray_int_array(interp, _self, int_array);
+    if (int_array)
+        Parrot_gc_free_memory_chunk(interp, int_array);
+#line 131 "./src/pmc/fixedintegerarray.c"
+}
+static  INTVAL 
+Parrot_FixedIntegerArray_elements(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 148 "./src/pmc/fixedintegerarray.pmc"
+
+    INTVAL size;
+    GETATTR_FixedIntegerArray_size(interp, _self, size);
+
+    return size;
+#line 142 "./src/pmc/fixedintegerarray.c"
+}
+static  void 
+Parrot_FixedIntegerArray_freeze(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 581 "./src/pmc/fixedintegerarray.pmc"
+
+    INTVAL   *int_array;
+    INTVAL    i, n;
+
+    interp->vtables[enum_class_default]->freeze(interp, _self, info);
+
+    GETATTR_FixedIntegerArray_size(interp, _self, n);
+    VTABLE_push_integer(interp, info, n);
+    GETATTR_FixedIntegerArray_int_array(interp, _self, int_array);
+
+    for (i = 0; i < n; ++i)
+        VTABLE_push_integer(interp, info, int_array[i]);
+#line 160 "./src/pmc/fixedintegerarray.c"
+}
+static  INTVAL 
+Parrot_FixedIntegerArray_get_bool(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 134 "./src/pmc/fixedintegerarray.pmc"
+
+    INTVAL size;
+    GETATTR_FixedIntegerArray_size(interp, _self, size);
+    return (INTVAL)(size != 0);
+#line 170 "./src/pmc/fixedintegerarray.c"
+}
+static  INTVAL 
+Parrot_FixedIntegerArray_get_integer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 165 "./src/pmc/fixedintegerarray.pmc"
+
+    INTVAL size;
+    /* Big L1 instr fetch miss */
+    GETATTR_FixedIntegerArray_size(interp, _self, size);
+    return size;
+#line 181 "./src/pmc/fixedintegerarray.c"
+}
+static  INTVAL 
+Parrot_FixedIntegerArray_get_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 207 "./src/pmc/fixedintegerarray.pmc"
+
+    /* simple int keys only */
+    const INTVAL k = VTABLE_get_integer(interp, key);
+    return VTABLE_get_integer_keyed_int(interp, _self, k);
+#line 191 "./src/pmc/fixedintegerarray.c"
+}
+static  INTVAL 
+Parrot_FixedIntegerArray_get_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+#line 183 "./src/pmc/fixedintegerarray.pmc"
+
+    INTVAL *int_array;
+    INTVAL  size;
+
+    GETATTR_FixedIntegerArray_size(interp, _self, size);
+
+    if (key < 0 || key >= size)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_OUT_OF_BOUNDS,
+            "FixedIntegerArray: index out of bounds!");
+
+    GETATTR_FixedIntegerArray_int_array(interp, _self, int_array);
+    return int_array[key];
+#line 209 "./src/pmc/fixedintegerarray.c"
+}
+static  PMC  *
+Parrot_FixedIntegerArray_get_iter(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 561 "./src/pmc/fixedintegerarray.pmc"
+
+    return Parrot_pmc_new_init(interp, enum_class_ArrayIterator, _self);
+#line 217 "./src/pmc/fixedintegerarray.c"
+}
+static  FLOATVAL 
+Parrot_FixedIntegerArray_get_number_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 239 "./src/pmc/fixedintegerarray.pmc"
+
+    const INTVAL k = VTABLE_get_integer(interp, key);
+    return VTABLE_get_number_keyed_int(interp, _self, k);
+#line 226 "./src/pmc/fixedintegerarray.c"
+}
+static  FLOATVAL 
+Parrot_FixedIntegerArray_get_number_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+#line 224 "./src/pmc/fixedintegerarray.pmc"
+
+    const INTVAL i = VTABLE_get_integer_keyed_int(interp, _self, key);
+    return (FLOATVAL)i;
+#line 235 "./src/pmc/fixedintegerarray.c"
+}
+static  PMC  *
+Parrot_FixedIntegerArray_get_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 359 "./src/pmc/fixedintegerarray.pmc"
+
+    const INTVAL k = VTABLE_get_integer(interp, key);
+    return VTABLE_get_pmc_keyed_int(interp, _self, k);
+#line 244 "./src/pmc/fixedintegerarray.c"
+}
+static  PMC  *
+Parrot_FixedIntegerArray_get_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+#line 344 "./src/pmc/fixedintegerarray.pmc"
+
+    const INTVAL val = VTABLE_get_integer_keyed_int(interp, _self, key);
+    return Parrot_pmc_new_init_int(interp, enum_class_Integer, val);
+#line 253 "./src/pmc/fixedintegerarray.c"
+}
+static  STRING  *
+Parrot_FixedIntegerArray_get_repr(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 276 "./src/pmc/fixedintegerarray.pmc"
+
+    STRING *res    = CONST_STRING(interp, "[ ");
+    INTVAL  n;
+    INTVAL  j;
+
+    GETATTR_FixedIntegerArray_size(interp, _self, n);
+
+    for (j = 0; j < n; ++j) {
+        PMC * const val = VTABLE_get_pmc_keyed_int(interp, _self, j);
+        res = Parrot_str_concat(interp, res, VTABLE_get_repr(interp, val));
+
+        if (j < n - 1)
+            res = Parrot_str_concat(interp, res, CONST_STRING(interp, ", "));
+    }
+
+    return Parrot_str_concat(interp, res, CONST_STRING(interp, " ]"));
+#line 275 "./src/pmc/fixedintegerarray.c"
+}
+static  STRING  *
+Parrot_FixedIntegerArray_get_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 272 "./src/pmc/fixedintegerarray.pmc"
+
+    return Parrot_FixedIntegerArray_get_repr(interp, _self);
+#line 283 "./src/pmc/fixedintegerarray.c"
+}
+static  STRING  *
+Parrot_FixedIntegerArray_get_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 328 "./src/pmc/fixedintegerarray.pmc"
+
+    const INTVAL k = VTABLE_get_integer(interp, key);
+    return VTABLE_get_string_keyed_int(interp, _self, k);
+#line 292 "./src/pmc/fixedintegerarray.c"
+}
+static  STRING  *
+Parrot_FixedIntegerArray_get_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+#line 254 "./src/pmc/fixedintegerarray.pmc"
+
+    PMC * const temp = VTABLE_get_pmc_keyed_int(interp, _self, key);
+    STRING *result = VTABLE_get_string(interp, temp);
+    #line 301 "./src/pmc/fixedintegerarray.c"
+    return (STRING*)result;
+#line 257 "./src/pmc/fixedintegerarray.pmc"
+
+#line 305 "./src/pmc/fixedintegerarray.c"
+}
+static  INTVAL 
+Parrot_FixedIntegerArray_hashvalue(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 308 "./src/pmc/fixedintegerarray.pmc"
+
+    INTVAL *int_array;
+    INTVAL size;
+    GETATTR_FixedIntegerArray_int_array(interp, _self, int_array);
+    GETATTR_FixedIntegerArray_size(interp, _self, size);
+    return Parrot_hash_buffer((const unsigned char *)int_array,
+                                    size * sizeof (INTVAL), interp->hash_seed);
+#line 318 "./src/pmc/fixedintegerarray.c"
+}
+static  void 
+Parrot_FixedIntegerArray_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 42 "./src/pmc/fixedintegerarray.pmc"
+
+    PObj_custom_destroy_SET(_self);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 327 "./src/pmc/fixedintegerarray.c"
+}
+static  void 
+Parrot_FixedIntegerArray_init_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL size)
+{
+#line 56 "./src/pmc/fixedintegerarray.pmc"
+
+    if (size < 0)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_OUT_OF_BOUNDS,
+            _("FixedIntegerArray: Cannot set array size to a negative number (%d)"), size);
+    if (size > 0) {
+        SETATTR_FixedIntegerArray_size(interp, _self, size);
+        SETATTR_FixedIntegerArray_int_array(interp, _self, mem_gc_allocate_n_typed(interp, size, INTVAL));
+    }
+    PObj_custom_destroy_SET(_self);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 343 "./src/pmc/fixedintegerarray.c"
+}
+static  INTVAL 
+Parrot_FixedIntegerArray_is_equal(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 529 "./src/pmc/fixedintegerarray.pmc"
+
+    INTVAL j, n;
+
+    if (value->vtable->base_type != _self->vtable->base_type)
+        return 0;
+
+    n = VTABLE_elements(interp, _self);
+
+    if (VTABLE_elements(interp, value) != n)
+        return 0;
+
+    for (j = 0; j < n; ++j) {
+        const INTVAL item1 = VTABLE_get_integer_keyed_int(interp, _self, j);
+        const INTVAL item2 = VTABLE_get_integer_keyed_int(interp, value, j);
+
+        if (item1 != item2)
+            return 0;
+    }
+
+    return 1;
+#line 369 "./src/pmc/fixedintegerarray.c"
+}
+static  void 
+Parrot_FixedIntegerArray_set_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, INTVAL value)
+{
+#line 425 "./src/pmc/fixedintegerarray.pmc"
+
+    const INTVAL k = VTABLE_get_integer(interp, key);
+    VTABLE_set_integer_keyed_int(interp, _self, k, value);
+#line 378 "./src/pmc/fixedintegerarray.c"
+}
+static  void 
+Parrot_FixedIntegerArray_set_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, INTVAL value)
+{
+#line 401 "./src/pmc/fixedintegerarray.pmc"
+
+    INTVAL *int_array;
+    INTVAL  size;
+
+    GETATTR_FixedIntegerArray_size(interp, _self, size);
+
+    if (key < 0 || key >= size)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_OUT_OF_BOUNDS,
+            "FixedIntegerArray: index out of bounds!");
+
+    GETATTR_FixedIntegerArray_int_array(interp, _self, int_array);
+    int_array[key] = value;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 397 "./src/pmc/fixedintegerarray.c"
+}
+static  void 
+Parrot_FixedIntegerArray_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL size)
+{
+#line 374 "./src/pmc/fixedintegerarray.pmc"
+
+    INTVAL *int_array;
+    INTVAL  cur_size;
+
+    GETATTR_FixedIntegerArray_size(interp, _self, cur_size);
+
+    if (cur_size || size < 1)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_OUT_OF_BOUNDS,
+            "FixedIntegerArray: Can't resize!");
+
+    SETATTR_FixedIntegerArray_size(interp, _self, size);
+    GETATTR_FixedIntegerArray_int_array(interp, _self, int_array);
+    SETATTR_FixedIntegerArray_int_array(interp, _self,
+            mem_gc_realloc_n_typed(interp, int_array, size, INTVAL));
+    PObj_custom_destroy_SET(_self);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 419 "./src/pmc/fixedintegerarray.c"
+}
+static  void 
+Parrot_FixedIntegerArray_set_number_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, FLOATVAL value)
+{
+#line 454 "./src/pmc/fixedintegerarray.pmc"
+
+    const INTVAL k = VTABLE_get_integer(interp, key);
+    VTABLE_set_number_keyed_int(interp, _self, k, value);
+#line 428 "./src/pmc/fixedintegerarray.c"
+}
+static  void 
+Parrot_FixedIntegerArray_set_number_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, FLOATVAL value)
+{
+#line 440 "./src/pmc/fixedintegerarray.pmc"
+
+    VTABLE_set_integer_keyed_int(interp, _self, key, (INTVAL)value);
+#line 436 "./src/pmc/fixedintegerarray.c"
+}
+static  void 
+Parrot_FixedIntegerArray_set_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, PMC *value)
+{
+#line 514 "./src/pmc/fixedintegerarray.pmc"
+
+    const INTVAL k = VTABLE_get_integer(interp, key);
+    VTABLE_set_pmc_keyed_int(interp, _self, k, value);
+#line 445 "./src/pmc/fixedintegerarray.c"
+}
+static  void 
+Parrot_FixedIntegerArray_set_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, PMC *src)
+{
+#line 499 "./src/pmc/fixedintegerarray.pmc"
+
+    const INTVAL tempInt = VTABLE_get_integer(interp, src);
+    VTABLE_set_integer_keyed_int(interp, _self, key, tempInt);
+#line 454 "./src/pmc/fixedintegerarray.c"
+}
+static  void 
+Parrot_FixedIntegerArray_set_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, STRING *value)
+{
+#line 484 "./src/pmc/fixedintegerarray.pmc"
+
+    const INTVAL k = VTABLE_get_integer(interp, key);
+    VTABLE_set_string_keyed_int(interp, _self, k, value);
+#line 463 "./src/pmc/fixedintegerarray.c"
+}
+static  void 
+Parrot_FixedIntegerArray_set_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, STRING *value)
+{
+#line 469 "./src/pmc/fixedintegerarray.pmc"
+
+    const INTVAL tempInt = Parrot_str_to_int(interp, value);
+    VTABLE_set_integer_keyed_int(interp, _self, key, tempInt);
+#line 472 "./src/pmc/fixedintegerarray.c"
+}
+static  void 
+Parrot_FixedIntegerArray_thaw(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 595 "./src/pmc/fixedintegerarray.pmc"
+
+    const INTVAL n = VTABLE_shift_integer(interp, info);
+    VTABLE_init_int(interp, _self, n);
+    if (n > 0) {
+        INTVAL  i;
+        INTVAL *int_array;
+        GETATTR_FixedIntegerArray_int_array(interp, _self, int_array);
+        for (i = 0; i < n; ++i)
+            int_array[i] = VTABLE_shift_integer(interp, info);
+    }
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 489 "./src/pmc/fixedintegerarray.c"
+}
+static  void
+Parrot_FixedIntegerArray_nci_sort(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* cmp_func;
+    STRING* _param_name_str_key = CONST_STRING_GEN(interp, "key");
+    PMC* key;
+    
+    Parrot_pcc_fill_params_from_c_args(interp, _call_object, "PiPoSnPo",
+        &_self, &cmp_func, &_param_name_str_key, &key);
+
+    { /* BEGIN PMETHOD BODY */
+#line 624 "./src/pmc/fixedintegerarray.pmc"
+
+    INTVAL size;
+
+    GETATTR_FixedIntegerArray_size(interp, _self, size);
+
+    if (size > 1) {
+        INTVAL *int_array;
+        GETATTR_FixedIntegerArray_int_array(interp, _self, int_array);
+        Parrot_util_sort(interp, enum_type_INTVAL, int_array, (UINTVAL)size,
+                cmp_func, key);
+    }
+    #line 518 "./src/pmc/fixedintegerarray.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)_self);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return;
+     }
+#line 635 "./src/pmc/fixedintegerarray.pmc"
+
+#line 526 "./src/pmc/fixedintegerarray.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_FixedIntegerArray_nci_reverse(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 648 "./src/pmc/fixedintegerarray.pmc"
+
+    INTVAL n;
+    GETATTR_FixedIntegerArray_size(interp, _self, n);
+    if (n > 1) {
+        INTVAL val;
+        INTVAL *data;
+        INTVAL i;
+
+        GETATTR_FixedIntegerArray_int_array(interp, _self, data);
+        for (i = 0; i <= --n; i++) {
+            val = data[i];
+            data[i] = data[n];
+            data[n] = val;
+        }
+    }
+#line 569 "./src/pmc/fixedintegerarray.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_FixedIntegerArray_nci_parallel_map(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* sub;
+    
+    const INTVAL arity = 2; /* "PiP" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    sub = VTABLE_get_pmc_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 693 "./src/pmc/fixedintegerarray.pmc"
+
+    INTVAL *int_array;
+    INTVAL  size;
+
+    GETATTR_FixedIntegerArray_size(interp, _self, size);
+    GETATTR_FixedIntegerArray_int_array(interp, _self, int_array);
+    Parrot_parallel_map(interp, enum_type_INTVAL, int_array, size, sub);
+    #line 606 "./src/pmc/fixedintegerarray.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)_self);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return;
+     }
+#line 700 "./src/pmc/fixedintegerarray.pmc"
+
+#line 614 "./src/pmc/fixedintegerarray.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_FixedIntegerArray_nci_parallel_each(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* sub;
+    
+    const INTVAL arity = 2; /* "PiP" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    sub = VTABLE_get_pmc_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 703 "./src/pmc/fixedintegerarray.pmc"
+
+    INTVAL *int_array;
+    INTVAL  size;
+
+    GETATTR_FixedIntegerArray_size(interp, _self, size);
+    GETATTR_FixedIntegerArray_int_array(interp, _self, int_array);
+    Parrot_parallel_each(interp, enum_type_INTVAL, int_array, size, sub);
+#line 651 "./src/pmc/fixedintegerarray.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_FixedIntegerArray_nci_parallel_reduce(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* sub;
+    INTVAL init;
+    INTVAL has_init;
+    
+    const INTVAL arity = 2; /* "PiPIoIp" */
+    const INTVAL arity_opt  = 1;
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count < arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too few arguments: %d passed, %d expected",
+                                    param_count, arity);
+    if (param_count > arity + arity_opt)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too many arguments: %d passed, %d expected",
+                                    param_count, arity + arity_opt);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    sub = VTABLE_get_pmc_keyed_int(interp, _call_object, 1);
+    if (param_count > 2) {
+        init = VTABLE_get_integer_keyed_int(interp, _call_object, 2);
+        has_init = 1;
+    }
+    else {
+        init = 0;
+        has_init = 0;
+    }
+
+    { /* BEGIN PMETHOD BODY */
+#line 713 "./src/pmc/fixedintegerarray.pmc"
+
+    INTVAL *int_array;
+    INTVAL  size;
+
+    GETATTR_FixedIntegerArray_size(interp, _self, size);
+    GETATTR_FixedIntegerArray_int_array(interp, _self, int_array);
+    Parrot_parallel_reduce(interp, enum_type_INTVAL, int_array, size, sub,
+            &init, has_init);
+    #line 705 "./src/pmc/fixedintegerarray.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)init);
+        
+        return;
+     }
+#line 721 "./src/pmc/fixedintegerarray.pmc"
+
+#line 713 "./src/pmc/fixedintegerarray.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_FixedIntegerArray_nci_parallel_sort(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* cmp_func;
+    
+    const INTVAL arity = 1; /* "PiPo" */
+    const INTVAL arity_opt  = 1;
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count < arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too few arguments: %d passed, %d expected",
+                                    param_count, arity);
+    if (param_count > arity + arity_opt)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too many arguments: %d passed, %d expected",
+                                    param_count, arity + arity_opt);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    if (param_count > 1) {
+        cmp_func = VTABLE_get_pmc_keyed_int(interp, _call_object, 1);
+    }
+    else {
+        cmp_func = PMCNULL;
+    }
+
+    { /* BEGIN PMETHOD BODY */
+#line 724 "./src/pmc/fixedintegerarray.pmc"
+
+    INTVAL *int_array;
+    INTVAL  size;
+
+    GETATTR_FixedIntegerArray_size(interp, _self, size);
+    GETATTR_FixedIntegerArray_int_array(interp, _self, int_array);
+    Parrot_parallel_sort(interp, enum_type_INTVAL, int_array, size, cmp_func);
+    #line 761 "./src/pmc/fixedintegerarray.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)_self);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return;
+     }
+#line 731 "./src/pmc/fixedintegerarray.pmc"
+
+#line 769 "./src/pmc/fixedintegerarray.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_FixedIntegerArray_update_vtable(VTABLE *vt) {
+    vt->clone = Parrot_FixedIntegerArray_clone;
+    vt->destroy = Parrot_FixedIntegerArray_destroy;
+    vt->elements = Parrot_FixedIntegerArray_elements;
+    vt->freeze = Parrot_FixedIntegerArray_freeze;
+    vt->get_bool = Parrot_FixedIntegerArray_get_bool;
+    vt->get_integer = Parrot_FixedIntegerArray_get_integer;
+    vt->get_integer_keyed = Parrot_FixedIntegerArray_get_integer_keyed;
+    vt->get_integer_keyed_int = Parrot_FixedIntegerArray_get_integer_keyed_int;
+    vt->get_iter = Parrot_FixedIntegerArray_get_iter;
+    vt->get_number_keyed = Parrot_FixedIntegerArray_get_number_keyed;
+    vt->get_number_keyed_int = Parrot_FixedIntegerArray_get_number_keyed_int;
+    vt->get_pmc_keyed = Parrot_FixedIntegerArray_get_pmc_keyed;
+    vt->get_pmc_keyed_int = Parrot_FixedIntegerArray_get_pmc_keyed_int;
+    vt->get_repr = Parrot_FixedIntegerArray_get_repr;
+    vt->get_string = Parrot_FixedIntegerArray_get_string;
+    vt->get_string_keyed = Parrot_FixedIntegerArray_get_string_keyed;
+    vt->get_string_keyed_int = Parrot_FixedIntegerArray_get_string_keyed_int;
+    vt->hashvalue = Parrot_FixedIntegerArray_hashvalue;
+    vt->init = Parrot_FixedIntegerArray_init;
+    vt->init_int = Parrot_FixedIntegerArray_init_int;
+    vt->is_equal = Parrot_FixedIntegerArray_is_equal;
+    vt->set_integer_keyed = Parrot_FixedIntegerArray_set_integer_keyed;
+    vt->set_integer_keyed_int = Parrot_FixedIntegerArray_set_integer_keyed_int;
+    vt->set_integer_native = Parrot_FixedIntegerArray_set_integer_native;
+    vt->set_number_keyed = Parrot_FixedIntegerArray_set_number_keyed;
+    vt->set_number_keyed_int = Parrot_FixedIntegerArray_set_number_keyed_int;
+    vt->set_pmc_keyed = Parrot_FixedIntegerArray_set_pmc_keyed;
+    vt->set_pmc_keyed_int = Parrot_FixedIntegerArray_set_pmc_keyed_int;
+    vt->set_string_keyed = Parrot_FixedIntegerArray_set_string_keyed;
+    vt->set_string_keyed_int = Parrot_FixedIntegerArray_set_string_keyed_int;
+    vt->thaw = Parrot_FixedIntegerArray_thaw;
+    vt->attr_size = sizeof(Parrot_FixedIntegerArray_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_FixedIntegerArray_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->clone = Parrot_FixedIntegerArray_clone;
+    vt->destroy = Parrot_FixedIntegerArray_destroy;
+    vt->elements = Parrot_FixedIntegerArray_elements;
+    vt->freeze = Parrot_FixedIntegerArray_freeze;
+    vt->get_bool = Parrot_FixedIntegerArray_get_bool;
+    vt->get_integer = Parrot_FixedIntegerArray_get_integer;
+    vt->get_integer_keyed = Parrot_FixedIntegerArray_get_integer_keyed;
+    vt->get_integer_keyed_int = Parrot_FixedIntegerArray_get_integer_keyed_int;
+    vt->get_iter = Parrot_FixedIntegerArray_get_iter;
+    vt->get_number_keyed = Parrot_FixedIntegerArray_get_number_keyed;
+    vt->get_number_keyed_int = Parrot_FixedIntegerArray_get_number_keyed_int;
+    vt->get_pmc_keyed = Parrot_FixedIntegerArray_get_pmc_keyed;
+    vt->get_pmc_keyed_int = Parrot_FixedIntegerArray_get_pmc_keyed_int;
+    vt->get_repr = Parrot_FixedIntegerArray_get_repr;
+    vt->get_string = Parrot_FixedIntegerArray_get_string;
+    vt->get_string_keyed = Parrot_FixedIntegerArray_get_string_keyed;
+    vt->get_string_keyed_int = Parrot_FixedIntegerArray_get_string_keyed_int;
+    vt->hashvalue = Parrot_FixedIntegerArray_hashvalue;
+    vt->is_equal = Parrot_FixedIntegerArray_is_equal;
+    vt->attr_size = sizeof(Parrot_FixedIntegerArray_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_FixedIntegerArray_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_FixedIntegerArray_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_FixedIntegerArray_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_FixedIntegerArray_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_FixedIntegerArray_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "FixedIntegerArray"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_FixedIntegerArray_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "FixedIntegerArray")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_FixedIntegerArray_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "Isize :int_array ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_FixedIntegerArray_get_vtable(interp);
+        vt->base_type      = enum_class_FixedIntegerArray;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "FixedIntegerArray");
+        vt->provides_str = CONST_STRING_GEN(interp, "array");
+        vt->isa_hash     = Parrot_FixedIntegerArray_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_FixedIntegerArray_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_FixedIntegerArray;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_FixedIntegerArray_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "sort");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_FixedIntegerArray_nci_sort),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "reverse");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_FixedIntegerArray_nci_reverse),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "parallel_map");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_FixedIntegerArray_nci_parallel_map),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "parallel_each");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_FixedIntegerArray_nci_parallel_each),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "parallel_reduce");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_FixedIntegerArray_nci_parallel_reduce),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "parallel_sort");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_FixedIntegerArray_nci_parallel_sort),
+                method_name, signature);
+        }
+        {
+        }
+    } /* pass */
+} /* Parrot_FixedIntegerArray_class_init */
+
+#line 733 "./src/pmc/fixedintegerarray.pmc"
+
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<docs/pdds/pdd17_basic_types.pod>.
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -0,0 +1,1013 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/fixedpmcarray.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_fixedintegerarray.h"
+#include "pmc_fixedpmcarray.h"
+#include "pmc_default.h"
+#include "fixedpmcarray.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/fixedpmcarray.pmc"
+/*
+Copyright (C) 2001-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/fixedpmcarray.pmc - FixedPMCArray PMC
+
+=head1 DESCRIPTION
+
+Fixed size array for PMCs only.
+
+This class, FixedPMCArray, implements an array of fixed size which stores PMCs.
+It puts things into Integer, Float, or String PMCs as appropriate.
+
+=head2 Note
+
+The flag C<PObj_private0_FLAG> is used in the C<NameSpace> PMC and should
+never be set for user arrays.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+#define PMC_size(x)  ((Parrot_FixedPMCArray_attributes *)PMC_data(x))->size
+#define PMC_array(x) ((Parrot_FixedPMCArray_attributes *)PMC_data(x))->pmc_array
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+PARROT_DOES_NOT_RETURN
+static void cannot_autovivify_nested(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+#define ASSERT_ARGS_cannot_autovivify_nested __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+#line 66 "./src/pmc/fixedpmcarray.c"
+static  PMC  * Parrot_FixedPMCArray_clone(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_FixedPMCArray_defined_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  void  Parrot_FixedPMCArray_destroy(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_FixedPMCArray_elements(SHIM_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_FixedPMCArray_exists_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  INTVAL  Parrot_FixedPMCArray_exists_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  void  Parrot_FixedPMCArray_freeze(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+static  INTVAL  Parrot_FixedPMCArray_get_bool(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_FixedPMCArray_get_integer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_FixedPMCArray_get_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  INTVAL  Parrot_FixedPMCArray_get_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  PMC  * Parrot_FixedPMCArray_get_iter(PARROT_INTERP, ARGMOD(PMC *_self));
+static  FLOATVAL  Parrot_FixedPMCArray_get_number(PARROT_INTERP, ARGMOD(PMC *_self));
+static  FLOATVAL  Parrot_FixedPMCArray_get_number_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  FLOATVAL  Parrot_FixedPMCArray_get_number_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  PMC  * Parrot_FixedPMCArray_get_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  PMC  * Parrot_FixedPMCArray_get_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  STRING  * Parrot_FixedPMCArray_get_repr(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING  * Parrot_FixedPMCArray_get_string(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING  * Parrot_FixedPMCArray_get_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  STRING  * Parrot_FixedPMCArray_get_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  void  Parrot_FixedPMCArray_init_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL size);
+static  INTVAL  Parrot_FixedPMCArray_is_equal(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void  Parrot_FixedPMCArray_mark(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_FixedPMCArray_set_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, INTVAL value);
+static  void  Parrot_FixedPMCArray_set_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, INTVAL value);
+static  void  Parrot_FixedPMCArray_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL size);
+static  void  Parrot_FixedPMCArray_set_number_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, FLOATVAL value);
+static  void  Parrot_FixedPMCArray_set_number_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, FLOATVAL value);
+static  void  Parrot_FixedPMCArray_set_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, PMC *value);
+static  void  Parrot_FixedPMCArray_set_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, PMC *src);
+static  void  Parrot_FixedPMCArray_set_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, STRING *value);
+static  void  Parrot_FixedPMCArray_set_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, STRING *value);
+static  void  Parrot_FixedPMCArray_splice(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, INTVAL offset, INTVAL count);
+static  void  Parrot_FixedPMCArray_thaw(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+static  void  Parrot_FixedPMCArray_visit(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+static  void Parrot_FixedPMCArray_nci_sort(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_FixedPMCArray_nci_reverse(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_FixedPMCArray_nci_parallel_each(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_FixedPMCArray_nci_parallel_sort(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_FixedPMCArray_class_init(PARROT_INTERP, int, int);
+void    Parrot_FixedPMCArray_ro_class_init(PARROT_INTERP, int, int);
+static  PMC  *
+Parrot_FixedPMCArray_clone(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 179 "./src/pmc/fixedpmcarray.pmc"
+
+    PMC * const dest  = Parrot_pmc_new(interp, _self->vtable->base_type);
+    const INTVAL size = PMC_size(_self);
+
+    if (size) {
+        PMC_size(dest)  = size;
+        PMC_array(dest) = mem_gc_allocate_n_typed(interp, size, PMC *);
+        mem_copy_n_typed(PMC_array(dest), PMC_array(_self), size, PMC *);
+        PObj_custom_mark_destroy_SETALL(dest);
+    }
+
+    return dest;
+#line 125 "./src/pmc/fixedpmcarray.c"
+}
+static  INTVAL 
+Parrot_FixedPMCArray_defined_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+#line 797 "./src/pmc/fixedpmcarray.pmc"
+
+    PMC * const val = VTABLE_get_pmc_keyed_int(interp, _self, key);
+
+    if (PMC_IS_NULL(val))
+        return 0;
+
+    return VTABLE_defined(interp, val);
+#line 138 "./src/pmc/fixedpmcarray.c"
+}
+static  void 
+Parrot_FixedPMCArray_destroy(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 164 "./src/pmc/fixedpmcarray.pmc"
+
+    if (PMC_array(_self))
+        mem_gc_free(interp, PMC_array(_self));
+#line 147 "./src/pmc/fixedpmcarray.c"
+}
+static  INTVAL 
+Parrot_FixedPMCArray_elements(SHIM_INTERP, ARGMOD(PMC *_self))
+{
+#line 216 "./src/pmc/fixedpmcarray.pmc"
+    return PMC_size(_self);
+#line 154 "./src/pmc/fixedpmcarray.c"
+}
+static  INTVAL 
+Parrot_FixedPMCArray_exists_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 715 "./src/pmc/fixedpmcarray.pmc"
+
+    const INTVAL ix = VTABLE_get_integer(interp, key);
+    return VTABLE_exists_keyed_int(interp, _self, ix);
+#line 163 "./src/pmc/fixedpmcarray.c"
+}
+static  INTVAL 
+Parrot_FixedPMCArray_exists_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+#line 705 "./src/pmc/fixedpmcarray.pmc"
+
+    PMC **data;
+    if (key < 0 || key >= PMC_size(_self))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_OUT_OF_BOUNDS,
+            _("FixedPMCArray: index out of bounds!"));
+
+    data = PMC_array(_self);
+    return !PMC_IS_NULL(data[key]);
+#line 177 "./src/pmc/fixedpmcarray.c"
+}
+static  void 
+Parrot_FixedPMCArray_freeze(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 779 "./src/pmc/fixedpmcarray.pmc"
+
+    VTABLE_push_integer(interp, info, VTABLE_elements(interp, _self));
+#line 185 "./src/pmc/fixedpmcarray.c"
+}
+static  INTVAL 
+Parrot_FixedPMCArray_get_bool(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 203 "./src/pmc/fixedpmcarray.pmc"
+
+    const INTVAL size = VTABLE_elements(interp, _self);
+    return (INTVAL)(size != 0);
+#line 194 "./src/pmc/fixedpmcarray.c"
+}
+static  INTVAL 
+Parrot_FixedPMCArray_get_integer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 231 "./src/pmc/fixedpmcarray.pmc"
+
+    return VTABLE_elements(interp, _self);
+#line 202 "./src/pmc/fixedpmcarray.c"
+}
+static  INTVAL 
+Parrot_FixedPMCArray_get_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 314 "./src/pmc/fixedpmcarray.pmc"
+
+    PMC * const tempPMC = VTABLE_get_pmc_keyed(interp, _self, key);
+    return VTABLE_get_integer(interp, tempPMC);
+#line 211 "./src/pmc/fixedpmcarray.c"
+}
+static  INTVAL 
+Parrot_FixedPMCArray_get_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+#line 297 "./src/pmc/fixedpmcarray.pmc"
+
+    PMC * const tempPMC = VTABLE_get_pmc_keyed_int(interp, _self, key);
+    if (PMC_IS_NULL(tempPMC))
+        return 0;
+    return VTABLE_get_integer(interp, tempPMC);
+#line 222 "./src/pmc/fixedpmcarray.c"
+}
+static  PMC  *
+Parrot_FixedPMCArray_get_iter(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 690 "./src/pmc/fixedpmcarray.pmc"
+
+    return Parrot_pmc_new_init(interp, enum_class_ArrayIterator, _self);
+#line 230 "./src/pmc/fixedpmcarray.c"
+}
+static  FLOATVAL 
+Parrot_FixedPMCArray_get_number(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 245 "./src/pmc/fixedpmcarray.pmc"
+
+    const INTVAL e = VTABLE_elements(interp, _self);
+    return (FLOATVAL)e;
+#line 239 "./src/pmc/fixedpmcarray.c"
+}
+static  FLOATVAL 
+Parrot_FixedPMCArray_get_number_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 344 "./src/pmc/fixedpmcarray.pmc"
+
+    PMC * const tempPMC = VTABLE_get_pmc_keyed(interp, _self, key);
+    return VTABLE_get_number(interp, tempPMC);
+#line 248 "./src/pmc/fixedpmcarray.c"
+}
+static  FLOATVAL 
+Parrot_FixedPMCArray_get_number_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+#line 329 "./src/pmc/fixedpmcarray.pmc"
+
+    PMC * const tempPMC = VTABLE_get_pmc_keyed_int(interp, _self, key);
+    return VTABLE_get_number(interp, tempPMC);
+#line 257 "./src/pmc/fixedpmcarray.c"
+}
+static  PMC  *
+Parrot_FixedPMCArray_get_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 414 "./src/pmc/fixedpmcarray.pmc"
+
+    const INTVAL k        = VTABLE_get_integer(interp, key);
+    PMC   * const nextkey = Parrot_key_next(interp, key);
+    PMC   *box;
+
+    if (!nextkey)
+        return VTABLE_get_pmc_keyed_int(interp, _self, k);
+
+    box = VTABLE_get_pmc_keyed_int(interp, _self, k);
+
+    /* TT #1561, return NULL early if we must autovivify. */
+    if (PMC_IS_NULL(box))
+        return PMCNULL;
+
+    return VTABLE_get_pmc_keyed(interp, box, nextkey);
+#line 278 "./src/pmc/fixedpmcarray.c"
+}
+static  PMC  *
+Parrot_FixedPMCArray_get_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+#line 393 "./src/pmc/fixedpmcarray.pmc"
+
+    PMC **data;
+
+    if (key < 0 || key >= PMC_size(_self))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_OUT_OF_BOUNDS,
+            _("FixedPMCArray: index out of bounds!"));
+
+    data = PMC_array(_self);
+    return data[key];
+#line 293 "./src/pmc/fixedpmcarray.c"
+}
+static  STRING  *
+Parrot_FixedPMCArray_get_repr(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 269 "./src/pmc/fixedpmcarray.pmc"
+
+    STRING *res    = CONST_STRING(interp, "(");
+    const INTVAL n = VTABLE_elements(interp, _self);
+    INTVAL  i;
+
+    for (i = 0; i < n; ++i) {
+        PMC * const val = VTABLE_get_pmc_keyed_int(interp, _self, i);
+        if (i > 0)
+            res = Parrot_str_concat(interp, res, CONST_STRING(interp, ", "));
+
+        res = Parrot_str_concat(interp, res, VTABLE_get_repr(interp, val));
+    }
+
+    res = Parrot_str_concat(interp, res, CONST_STRING(interp, ")"));
+
+    return res;
+#line 315 "./src/pmc/fixedpmcarray.c"
+}
+static  STRING  *
+Parrot_FixedPMCArray_get_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 265 "./src/pmc/fixedpmcarray.pmc"
+
+    return Parrot_str_from_int(interp, VTABLE_elements(interp, _self));
+#line 323 "./src/pmc/fixedpmcarray.c"
+}
+static  STRING  *
+Parrot_FixedPMCArray_get_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 378 "./src/pmc/fixedpmcarray.pmc"
+
+    PMC * const tempPMC = VTABLE_get_pmc_keyed(interp, _self, key);
+    return VTABLE_get_string(interp, tempPMC);
+#line 332 "./src/pmc/fixedpmcarray.c"
+}
+static  STRING  *
+Parrot_FixedPMCArray_get_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+#line 359 "./src/pmc/fixedpmcarray.pmc"
+
+    PMC * const retval = VTABLE_get_pmc_keyed_int(interp, _self, key);
+
+    if (PMC_IS_NULL(retval))
+        return CONST_STRING(interp, "");
+
+    return VTABLE_get_string(interp, retval);
+#line 345 "./src/pmc/fixedpmcarray.c"
+}
+static  void 
+Parrot_FixedPMCArray_init_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL size)
+{
+#line 146 "./src/pmc/fixedpmcarray.pmc"
+
+    if (size < 0)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_OUT_OF_BOUNDS,
+                _("FixedPMCArray: Cannot set array size to a negative number (%d)"), size);
+
+    VTABLE_set_integer_native(interp, _self, size);
+#line 357 "./src/pmc/fixedpmcarray.c"
+}
+static  INTVAL 
+Parrot_FixedPMCArray_is_equal(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 650 "./src/pmc/fixedpmcarray.pmc"
+
+    INTVAL j, n;
+
+    if (value->vtable->base_type != _self->vtable->base_type)
+        return 0;
+
+    n = VTABLE_elements(interp, _self);
+
+    if (VTABLE_elements(interp, value) != n)
+        return 0;
+
+    for (j = 0; j < n; ++j) {
+        PMC * const item1 = VTABLE_get_pmc_keyed_int(interp, _self, j);
+        PMC * const item2 = VTABLE_get_pmc_keyed_int(interp, value, j);
+
+        if (item1 == item2)
+            continue;
+
+        if (item1->vtable->base_type == enum_class_Null
+        ||  item2->vtable->base_type == enum_class_Null)
+            return 0;
+
+        if (!VTABLE_is_equal(interp, item1, item2))
+            return 0;
+    }
+
+    return 1;
+#line 390 "./src/pmc/fixedpmcarray.c"
+}
+static  void 
+Parrot_FixedPMCArray_mark(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 816 "./src/pmc/fixedpmcarray.pmc"
+
+    PMC ** const data = PMC_array(_self);
+    if (data) {
+        INTVAL i;
+        for (i = PMC_size(_self) - 1; i >= 0; --i)
+            Parrot_gc_mark_PMC_alive(interp, data[i]);
+    }
+#line 403 "./src/pmc/fixedpmcarray.c"
+}
+static  void 
+Parrot_FixedPMCArray_set_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, INTVAL value)
+{
+#line 494 "./src/pmc/fixedpmcarray.pmc"
+
+    PMC * const val = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp,
+                enum_class_Integer));
+
+    VTABLE_set_integer_native(interp, val, value);
+
+    /* Let set_pmc_keyed worry about multi keys */
+    VTABLE_set_pmc_keyed(interp, _self, key, val);
+#line 417 "./src/pmc/fixedpmcarray.c"
+}
+static  void 
+Parrot_FixedPMCArray_set_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, INTVAL value)
+{
+#line 476 "./src/pmc/fixedpmcarray.pmc"
+
+    PMC * const val = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp,
+                enum_class_Integer));
+
+    VTABLE_set_integer_native(interp, val, value);
+    VTABLE_set_pmc_keyed_int(interp, _self, key, val);
+#line 429 "./src/pmc/fixedpmcarray.c"
+}
+static  void 
+Parrot_FixedPMCArray_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL size)
+{
+#line 442 "./src/pmc/fixedpmcarray.pmc"
+
+    int i;
+    PMC **data;
+
+    if (PMC_size(_self) && size)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_OUT_OF_BOUNDS,
+                _("FixedPMCArray: Can't resize!"));
+    if (!size)
+        return;
+
+    if (size < 0)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_OUT_OF_BOUNDS,
+                _("FixedPMCArray: Cannot set array size to a negative number"));
+
+    PMC_size(_self) = size;
+    data           = mem_gc_allocate_n_typed(interp, size, PMC *);
+
+    for (i = 0; i < size; ++i)
+        data[i] = PMCNULL;
+
+    PObj_custom_mark_destroy_SETALL(_self);
+    PMC_array(_self) = data;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 458 "./src/pmc/fixedpmcarray.c"
+}
+static  void 
+Parrot_FixedPMCArray_set_number_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, FLOATVAL value)
+{
+#line 534 "./src/pmc/fixedpmcarray.pmc"
+
+    const INTVAL k        = VTABLE_get_integer(interp, key);
+    PMC   * const nextkey = Parrot_key_next(interp, key);
+
+    if (nextkey == NULL) {
+        VTABLE_set_number_keyed_int(interp, _self, k, value);
+    }
+    else {
+        PMC * const box = VTABLE_get_pmc_keyed_int(interp, _self, k);
+
+        if (PMC_IS_NULL(box))
+            cannot_autovivify_nested(interp);
+
+        VTABLE_set_number_keyed(interp, box, nextkey, value);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+    }
+#line 480 "./src/pmc/fixedpmcarray.c"
+}
+static  void 
+Parrot_FixedPMCArray_set_number_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, FLOATVAL value)
+{
+#line 515 "./src/pmc/fixedpmcarray.pmc"
+
+    PMC * const val = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp,
+                enum_class_Float));
+
+    VTABLE_set_number_native(interp, val, value);
+    VTABLE_set_pmc_keyed_int(interp, _self, key, val);
+#line 492 "./src/pmc/fixedpmcarray.c"
+}
+static  void 
+Parrot_FixedPMCArray_set_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, PMC *value)
+{
+#line 622 "./src/pmc/fixedpmcarray.pmc"
+
+    const INTVAL k = VTABLE_get_integer(interp, key);
+    PMC * const nextkey = Parrot_key_next(interp, key);
+
+    if (!nextkey) {
+        VTABLE_set_pmc_keyed_int(interp, _self, k, value);
+    }
+    else {
+        PMC * const box = VTABLE_get_pmc_keyed_int(interp, _self, k);
+
+        if (PMC_IS_NULL(box))
+            cannot_autovivify_nested(interp);
+
+        VTABLE_set_pmc_keyed(interp, box, nextkey, value);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+    }
+#line 514 "./src/pmc/fixedpmcarray.c"
+}
+static  void 
+Parrot_FixedPMCArray_set_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, PMC *src)
+{
+#line 601 "./src/pmc/fixedpmcarray.pmc"
+
+    PMC **data;
+
+    if (key < 0 || key >= PMC_size(_self))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_OUT_OF_BOUNDS,
+            _("FixedPMCArray: index out of bounds!"));
+
+    data      = PMC_array(_self);
+    data[key] = src;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 530 "./src/pmc/fixedpmcarray.c"
+}
+static  void 
+Parrot_FixedPMCArray_set_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, STRING *value)
+{
+#line 581 "./src/pmc/fixedpmcarray.pmc"
+
+    PMC * const val = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp,
+                enum_class_String));
+
+    VTABLE_set_string_native(interp, val, value);
+
+    /* Let set_pmc_keyed worry about multi keys */
+    VTABLE_set_pmc_keyed(interp, _self, key, val);
+#line 544 "./src/pmc/fixedpmcarray.c"
+}
+static  void 
+Parrot_FixedPMCArray_set_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, STRING *value)
+{
+#line 562 "./src/pmc/fixedpmcarray.pmc"
+
+    PMC * const val = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp,
+                enum_class_String));
+
+    VTABLE_set_string_native(interp, val, value);
+    VTABLE_set_pmc_keyed_int(interp, _self, key, val);
+#line 556 "./src/pmc/fixedpmcarray.c"
+}
+static  void 
+Parrot_FixedPMCArray_splice(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, INTVAL offset, INTVAL count)
+{
+#line 736 "./src/pmc/fixedpmcarray.pmc"
+
+    if (count + offset > PMC_size(_self))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            _("FixedPMCArray: index out of bounds!"));
+
+    for (count--; count >= 0; --count) {
+        VTABLE_set_pmc_keyed_int(interp, _self, offset + count, value);
+    }
+#line 570 "./src/pmc/fixedpmcarray.c"
+}
+static  void 
+Parrot_FixedPMCArray_thaw(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 783 "./src/pmc/fixedpmcarray.pmc"
+
+    VTABLE_init_int(interp, _self, VTABLE_shift_integer(interp, info));
+#line 578 "./src/pmc/fixedpmcarray.c"
+}
+static  void 
+Parrot_FixedPMCArray_visit(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 767 "./src/pmc/fixedpmcarray.pmc"
+
+    INTVAL  i;
+    const INTVAL n = VTABLE_elements(interp, _self);
+    PMC   **pos    = PMC_array(_self);
+
+    for (i = 0; i < n; ++i, ++pos) {
+        VISIT_PMC(interp, info, *pos);
+    }
+
+    interp->vtables[enum_class_default]->visit(interp, _self, info);
+#line 594 "./src/pmc/fixedpmcarray.c"
+}
+static  void
+Parrot_FixedPMCArray_nci_sort(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* cmp_func;
+    STRING* _param_name_str_key = CONST_STRING_GEN(interp, "key");
+    PMC* key;
+    
+    Parrot_pcc_fill_params_from_c_args(interp, _call_object, "PiPoSnPo",
+        &_self, &cmp_func, &_param_name_str_key, &key);
+
+    { /* BEGIN PMETHOD BODY */
+#line 59 "./src/pmc/fixedpmcarray.pmc"
+
+    const INTVAL n = _self->vtable->elements(interp, _self);
+
+    if (n > 1) {
+        PMC *array = _self;
+
+        /* XXX Workaround for TT #218: sort the array of the proxy */
+        if (PObj_is_object_TEST(_self))
+            array = _self->vtable->get_attr_str(interp, _self, CONST_STRING(interp, "proxy"));
+
+        Parrot_util_sort(interp, enum_type_PMC, PMC_array(array), (UINTVAL)n,
+                cmp_func, key);
+    }
+    #line 625 "./src/pmc/fixedpmcarray.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)_self);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return;
+     }
+#line 72 "./src/pmc/fixedpmcarray.pmc"
+
+#line 633 "./src/pmc/fixedpmcarray.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_FixedPMCArray_nci_reverse(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 85 "./src/pmc/fixedpmcarray.pmc"
+
+    INTVAL n = _self->vtable->elements(interp, _self);
+    if (n > 1) {
+        PMC *val;
+        PMC **data = PMC_array(_self);
+        INTVAL i;
+
+        for (i = 0; i <= --n; i++) {
+            val = data[i];
+            data[i] = data[n];
+            data[n] = val;
+        }
+    }
+#line 674 "./src/pmc/fixedpmcarray.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_FixedPMCArray_nci_parallel_each(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* sub;
+    
+    const INTVAL arity = 2; /* "PiP" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    sub = VTABLE_get_pmc_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 118 "./src/pmc/fixedpmcarray.pmc"
+
+    Parrot_parallel_each(interp, enum_type_PMC, PMC_array(_self),
+            _self->vtable->elements(interp, _self), sub);
+#line 707 "./src/pmc/fixedpmcarray.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_FixedPMCArray_nci_parallel_sort(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* cmp_func;
+    
+    const INTVAL arity = 1; /* "PiPo" */
+    const INTVAL arity_opt  = 1;
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count < arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too few arguments: %d passed, %d expected",
+                                    param_count, arity);
+    if (param_count > arity + arity_opt)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too many arguments: %d passed, %d expected",
+                                    param_count, arity + arity_opt);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    if (param_count > 1) {
+        cmp_func = VTABLE_get_pmc_keyed_int(interp, _call_object, 1);
+    }
+    else {
+        cmp_func = PMCNULL;
+    }
+
+    { /* BEGIN PMETHOD BODY */
+#line 123 "./src/pmc/fixedpmcarray.pmc"
+
+    Parrot_parallel_sort(interp, enum_type_PMC, PMC_array(_self),
+            _self->vtable->elements(interp, _self), cmp_func);
+    #line 751 "./src/pmc/fixedpmcarray.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)_self);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return;
+     }
+#line 126 "./src/pmc/fixedpmcarray.pmc"
+
+#line 759 "./src/pmc/fixedpmcarray.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_FixedPMCArray_update_vtable(VTABLE *vt) {
+    vt->clone = Parrot_FixedPMCArray_clone;
+    vt->defined_keyed_int = Parrot_FixedPMCArray_defined_keyed_int;
+    vt->destroy = Parrot_FixedPMCArray_destroy;
+    vt->elements = Parrot_FixedPMCArray_elements;
+    vt->exists_keyed = Parrot_FixedPMCArray_exists_keyed;
+    vt->exists_keyed_int = Parrot_FixedPMCArray_exists_keyed_int;
+    vt->freeze = Parrot_FixedPMCArray_freeze;
+    vt->get_bool = Parrot_FixedPMCArray_get_bool;
+    vt->get_integer = Parrot_FixedPMCArray_get_integer;
+    vt->get_integer_keyed = Parrot_FixedPMCArray_get_integer_keyed;
+    vt->get_integer_keyed_int = Parrot_FixedPMCArray_get_integer_keyed_int;
+    vt->get_iter = Parrot_FixedPMCArray_get_iter;
+    vt->get_number = Parrot_FixedPMCArray_get_number;
+    vt->get_number_keyed = Parrot_FixedPMCArray_get_number_keyed;
+    vt->get_number_keyed_int = Parrot_FixedPMCArray_get_number_keyed_int;
+    vt->get_pmc_keyed = Parrot_FixedPMCArray_get_pmc_keyed;
+    vt->get_pmc_keyed_int = Parrot_FixedPMCArray_get_pmc_keyed_int;
+    vt->get_repr = Parrot_FixedPMCArray_get_repr;
+    vt->get_string = Parrot_FixedPMCArray_get_string;
+    vt->get_string_keyed = Parrot_FixedPMCArray_get_string_keyed;
+    vt->get_string_keyed_int = Parrot_FixedPMCArray_get_string_keyed_int;
+    vt->init_int = Parrot_FixedPMCArray_init_int;
+    vt->is_equal = Parrot_FixedPMCArray_is_equal;
+    vt->mark = Parrot_FixedPMCArray_mark;
+    vt->set_integer_keyed = Parrot_FixedPMCArray_set_integer_keyed;
+    vt->set_integer_keyed_int = Parrot_FixedPMCArray_set_integer_keyed_int;
+    vt->set_integer_native = Parrot_FixedPMCArray_set_integer_native;
+    vt->set_number_keyed = Parrot_FixedPMCArray_set_number_keyed;
+    vt->set_number_keyed_int = Parrot_FixedPMCArray_set_number_keyed_int;
+    vt->set_pmc_keyed = Parrot_FixedPMCArray_set_pmc_keyed;
+    vt->set_pmc_keyed_int = Parrot_FixedPMCArray_set_pmc_keyed_int;
+    vt->set_string_keyed = Parrot_FixedPMCArray_set_string_keyed;
+    vt->set_string_keyed_int = Parrot_FixedPMCArray_set_string_keyed_int;
+    vt->splice = Parrot_FixedPMCArray_splice;
+    vt->thaw = Parrot_FixedPMCArray_thaw;
+    vt->visit = Parrot_FixedPMCArray_visit;
+    vt->attr_size = sizeof(Parrot_FixedPMCArray_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_FixedPMCArray_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->clone = Parrot_FixedPMCArray_clone;
+    vt->defined_keyed_int = Parrot_FixedPMCArray_defined_keyed_int;
+    vt->destroy = Parrot_FixedPMCArray_destroy;
+    vt->elements = Parrot_FixedPMCArray_elements;
+    vt->exists_keyed = Parrot_FixedPMCArray_exists_keyed;
+    vt->exists_keyed_int = Parrot_FixedPMCArray_exists_keyed_int;
+    vt->freeze = Parrot_FixedPMCArray_freeze;
+    vt->get_bool = Parrot_FixedPMCArray_get_bool;
+    vt->get_integer = Parrot_FixedPMCArray_get_integer;
+    vt->get_integer_keyed = Parrot_FixedPMCArray_get_integer_keyed;
+    vt->get_integer_keyed_int = Parrot_FixedPMCArray_get_integer_keyed_int;
+    vt->get_iter = Parrot_FixedPMCArray_get_iter;
+    vt->get_number = Parrot_FixedPMCArray_get_number;
+    vt->get_number_keyed = Parrot_FixedPMCArray_get_number_keyed;
+    vt->get_number_keyed_int = Parrot_FixedPMCArray_get_number_keyed_int;
+    vt->get_pmc_keyed = Parrot_FixedPMCArray_get_pmc_keyed;
+    vt->get_pmc_keyed_int = Parrot_FixedPMCArray_get_pmc_keyed_int;
+    vt->get_repr = Parrot_FixedPMCArray_get_repr;
+    vt->get_string = Parrot_FixedPMCArray_get_string;
+    vt->get_string_keyed = Parrot_FixedPMCArray_get_string_keyed;
+    vt->get_string_keyed_int = Parrot_FixedPMCArray_get_string_keyed_int;
+    vt->is_equal = Parrot_FixedPMCArray_is_equal;
+    vt->mark = Parrot_FixedPMCArray_mark;
+    vt->visit = Parrot_FixedPMCArray_visit;
+    vt->attr_size = sizeof(Parrot_FixedPMCArray_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_FixedPMCArray_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_FixedPMCArray_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_FixedPMCArray_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_FixedPMCArray_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_FixedPMCArray_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "FixedPMCArray"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_FixedPMCArray_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "FixedPMCArray")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_FixedPMCArray_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "Isize :pmc_array ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_FixedPMCArray_get_vtable(interp);
+        vt->base_type      = enum_class_FixedPMCArray;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "FixedPMCArray");
+        vt->provides_str = CONST_STRING_GEN(interp, "array");
+        vt->isa_hash     = Parrot_FixedPMCArray_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_FixedPMCArray_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_FixedPMCArray;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_FixedPMCArray_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "sort");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_FixedPMCArray_nci_sort),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "reverse");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_FixedPMCArray_nci_reverse),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "parallel_each");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_FixedPMCArray_nci_parallel_each),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "parallel_sort");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_FixedPMCArray_nci_parallel_sort),
+                method_name, signature);
+        }
+        {
+        }
+    } /* pass */
+} /* Parrot_FixedPMCArray_class_init */
+
+#line 825 "./src/pmc/fixedpmcarray.pmc"
+
+
+/*
+
+=back
+
+=head1 Auxiliary functions
+
+=over 4
+
+=item C<static void cannot_autovivify_nested(PARROT_INTERP)>
+
+Throw exception when trying to autovivify nested arrays
+
+=cut
+
+*/
+
+PARROT_DOES_NOT_RETURN
+static void
+cannot_autovivify_nested(PARROT_INTERP)
+{
+    ASSERT_ARGS(cannot_autovivify_nested)
+    Parrot_ex_throw_from_c_args(interp, NULL,
+            EXCEPTION_INVALID_OPERATION,
+            "Cannot autovivify nested arrays");
+}
+
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<docs/pdds/pdd17_basic_types.pod>.
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -0,0 +1,775 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/fixedstringarray.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_fixedintegerarray.h"
+#include "pmc_fixedstringarray.h"
+#include "pmc_default.h"
+#include "fixedstringarray.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/fixedstringarray.pmc"
+/*
+Copyright (C) 2001-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/fixedstringarray.pmc - FixedStringArray PMC
+
+=head1 DESCRIPTION
+
+Fixed size array for strings only.
+
+This class, FixedStringArray, implements an array of fixed size which
+stores Parrot strings.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+#line 49 "./src/pmc/fixedstringarray.c"
+static  PMC  * Parrot_FixedStringArray_clone(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_FixedStringArray_destroy(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_FixedStringArray_elements(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_FixedStringArray_freeze(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+static  INTVAL  Parrot_FixedStringArray_get_bool(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_FixedStringArray_get_integer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_FixedStringArray_get_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  INTVAL  Parrot_FixedStringArray_get_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  PMC  * Parrot_FixedStringArray_get_iter(PARROT_INTERP, ARGMOD(PMC *_self));
+static  FLOATVAL  Parrot_FixedStringArray_get_number(PARROT_INTERP, ARGMOD(PMC *_self));
+static  FLOATVAL  Parrot_FixedStringArray_get_number_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  FLOATVAL  Parrot_FixedStringArray_get_number_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  PMC  * Parrot_FixedStringArray_get_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  PMC  * Parrot_FixedStringArray_get_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  STRING  * Parrot_FixedStringArray_get_repr(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING  * Parrot_FixedStringArray_get_string(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING  * Parrot_FixedStringArray_get_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  STRING  * Parrot_FixedStringArray_get_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  void  Parrot_FixedStringArray_init_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL size);
+static  INTVAL  Parrot_FixedStringArray_is_equal(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void  Parrot_FixedStringArray_mark(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_FixedStringArray_set_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, INTVAL value);
+static  void  Parrot_FixedStringArray_set_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, INTVAL value);
+static  void  Parrot_FixedStringArray_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL new_size);
+static  void  Parrot_FixedStringArray_set_number_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, FLOATVAL value);
+static  void  Parrot_FixedStringArray_set_number_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, FLOATVAL value);
+static  void  Parrot_FixedStringArray_set_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, PMC *value);
+static  void  Parrot_FixedStringArray_set_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, PMC *src);
+static  void  Parrot_FixedStringArray_set_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, STRING *value);
+static  void  Parrot_FixedStringArray_set_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, STRING *value);
+static  void  Parrot_FixedStringArray_thaw(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+static  void Parrot_FixedStringArray_nci_sort(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_FixedStringArray_nci_reverse(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_FixedStringArray_class_init(PARROT_INTERP, int, int);
+void    Parrot_FixedStringArray_ro_class_init(PARROT_INTERP, int, int);
+static  PMC  *
+Parrot_FixedStringArray_clone(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 91 "./src/pmc/fixedstringarray.pmc"
+
+
+    STRING **my_str_array;
+    PMC        *const dest = Parrot_pmc_new(interp, _self->vtable->base_type);
+
+    GETATTR_FixedStringArray_str_array(interp, _self, my_str_array);
+
+    if (my_str_array) {
+        STRING **dest_str_array;
+        INTVAL size;
+        size_t mem_size;
+
+        GETATTR_FixedStringArray_size(interp, _self, size);
+        mem_size = size * sizeof (STRING *);
+
+        dest_str_array = mem_gc_allocate_n_zeroed_typed(interp, size, STRING *);
+        memcpy(dest_str_array, my_str_array, mem_size);
+        SETATTR_FixedStringArray_str_array(interp, dest, dest_str_array);
+        SETATTR_FixedStringArray_size(interp, dest, size);
+
+        PObj_custom_mark_destroy_SETALL(dest);
+    }
+
+    #line 112 "./src/pmc/fixedstringarray.c"
+    return (PMC*)dest;
+#line 114 "./src/pmc/fixedstringarray.pmc"
+
+#line 116 "./src/pmc/fixedstringarray.c"
+}
+static  void 
+Parrot_FixedStringArray_destroy(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 71 "./src/pmc/fixedstringarray.pmc"
+
+
+    STRING **str_array;
+
+    GETATTR_FixedStringArray_str_array(interp, _self, str_array);
+
+    if (str_array)
+        mem_gc_free(interp, str_array);
+#line 130 "./src/pmc/fixedstringarray.c"
+}
+static  INTVAL 
+Parrot_FixedStringArray_elements(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 182 "./src/pmc/fixedstringarray.pmc"
+
+    UINTVAL size;
+    GETATTR_FixedStringArray_size(interp, _self, size);
+    return size;
+#line 140 "./src/pmc/fixedstringarray.c"
+}
+static  void 
+Parrot_FixedStringArray_freeze(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 598 "./src/pmc/fixedstringarray.pmc"
+
+    STRING           **str_array;
+    UINTVAL            size, i;
+
+    GETATTR_FixedStringArray_size(interp, _self, size);
+    GETATTR_FixedStringArray_str_array(interp, _self, str_array);
+    VTABLE_push_integer(interp, info, size);
+
+    for (i = 0; i < size; ++i)
+        VTABLE_push_string(interp, info, str_array[i]);
+#line 156 "./src/pmc/fixedstringarray.c"
+}
+static  INTVAL 
+Parrot_FixedStringArray_get_bool(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 154 "./src/pmc/fixedstringarray.pmc"
+
+    const INTVAL size = VTABLE_elements(interp, _self);
+    return (INTVAL)(size != 0);
+#line 165 "./src/pmc/fixedstringarray.c"
+}
+static  INTVAL 
+Parrot_FixedStringArray_get_integer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 198 "./src/pmc/fixedstringarray.pmc"
+
+    return VTABLE_elements(interp, _self);
+#line 173 "./src/pmc/fixedstringarray.c"
+}
+static  INTVAL 
+Parrot_FixedStringArray_get_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 242 "./src/pmc/fixedstringarray.pmc"
+
+    /* simple int keys only */
+    const INTVAL k = VTABLE_get_integer(interp, key);
+    return VTABLE_get_integer_keyed_int(interp, _self, k);
+#line 183 "./src/pmc/fixedstringarray.c"
+}
+static  INTVAL 
+Parrot_FixedStringArray_get_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+#line 227 "./src/pmc/fixedstringarray.pmc"
+
+    STRING * const element = VTABLE_get_string_keyed_int(interp, _self, key);
+    return Parrot_str_to_int(interp, element);
+#line 192 "./src/pmc/fixedstringarray.c"
+}
+static  PMC  *
+Parrot_FixedStringArray_get_iter(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 168 "./src/pmc/fixedstringarray.pmc"
+
+    return Parrot_pmc_new_init(interp, enum_class_ArrayIterator, _self);
+#line 200 "./src/pmc/fixedstringarray.c"
+}
+static  FLOATVAL 
+Parrot_FixedStringArray_get_number(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 212 "./src/pmc/fixedstringarray.pmc"
+
+    const INTVAL e = VTABLE_elements(interp, _self);
+    return (FLOATVAL)e;
+#line 209 "./src/pmc/fixedstringarray.c"
+}
+static  FLOATVAL 
+Parrot_FixedStringArray_get_number_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 274 "./src/pmc/fixedstringarray.pmc"
+
+    const INTVAL k = VTABLE_get_integer(interp, key);
+    return VTABLE_get_number_keyed_int(interp, _self, k);
+#line 218 "./src/pmc/fixedstringarray.c"
+}
+static  FLOATVAL 
+Parrot_FixedStringArray_get_number_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+#line 259 "./src/pmc/fixedstringarray.pmc"
+
+    STRING * const element = VTABLE_get_string_keyed_int(interp, _self, key);
+    return Parrot_str_to_num(interp, element);
+#line 227 "./src/pmc/fixedstringarray.c"
+}
+static  PMC  *
+Parrot_FixedStringArray_get_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 346 "./src/pmc/fixedstringarray.pmc"
+
+    const INTVAL k = VTABLE_get_integer(interp, key);
+    return VTABLE_get_pmc_keyed_int(interp, _self, k);
+#line 236 "./src/pmc/fixedstringarray.c"
+}
+static  PMC  *
+Parrot_FixedStringArray_get_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+#line 328 "./src/pmc/fixedstringarray.pmc"
+
+    PMC    * const ret = Parrot_pmc_new(interp, enum_class_String);
+    STRING * const val = VTABLE_get_string_keyed_int(interp, _self, key);
+
+    VTABLE_set_string_native(interp, ret, val);
+    return ret;
+#line 248 "./src/pmc/fixedstringarray.c"
+}
+static  STRING  *
+Parrot_FixedStringArray_get_repr(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 525 "./src/pmc/fixedstringarray.pmc"
+
+
+    STRING       *res = CONST_STRING(interp, "[ ");
+    const INTVAL  n   = VTABLE_get_integer(interp, _self);
+    INTVAL        j;
+
+    for (j = 0; j < n; ++j) {
+        STRING * const val = VTABLE_get_string_keyed_int(interp, _self, j);
+        res = Parrot_str_concat(interp, res, CONST_STRING(interp, "\""));
+        res = Parrot_str_concat(interp, res, val);
+        res = Parrot_str_concat(interp, res, CONST_STRING(interp, "\""));
+
+        if (j < n - 1)
+            res = Parrot_str_concat(interp, res, CONST_STRING(interp, ", "));
+    }
+
+    return Parrot_str_concat(interp, res, CONST_STRING(interp, " ]"));
+#line 271 "./src/pmc/fixedstringarray.c"
+}
+static  STRING  *
+Parrot_FixedStringArray_get_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 521 "./src/pmc/fixedstringarray.pmc"
+
+    return Parrot_FixedStringArray_get_repr(interp, _self);
+#line 279 "./src/pmc/fixedstringarray.c"
+}
+static  STRING  *
+Parrot_FixedStringArray_get_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 312 "./src/pmc/fixedstringarray.pmc"
+
+    const INTVAL k = VTABLE_get_integer(interp, key);
+    return VTABLE_get_string_keyed_int(interp, _self, k);
+#line 288 "./src/pmc/fixedstringarray.c"
+}
+static  STRING  *
+Parrot_FixedStringArray_get_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+#line 289 "./src/pmc/fixedstringarray.pmc"
+
+    STRING **str_array;
+    UINTVAL  size;
+
+    GETATTR_FixedStringArray_size(interp, _self, size);
+    if (key < 0 || (UINTVAL)key >= size)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_OUT_OF_BOUNDS,
+            "FixedStringArray: index out of bounds!");
+
+    GETATTR_FixedStringArray_str_array(interp, _self, str_array);
+    return str_array[key];
+#line 305 "./src/pmc/fixedstringarray.c"
+}
+static  void 
+Parrot_FixedStringArray_init_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL size)
+{
+#line 47 "./src/pmc/fixedstringarray.pmc"
+
+    if (size < 0)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_OUT_OF_BOUNDS,
+            _("FixedStringArray: Cannot set array size to a negative number (%d)"), size);
+    if (size) {
+        SETATTR_FixedStringArray_size(interp, _self, size);
+        SETATTR_FixedStringArray_str_array(interp,
+                           _self, mem_gc_allocate_n_zeroed_typed(interp, size, STRING *));
+        PObj_custom_mark_destroy_SETALL(_self);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+    }
+#line 322 "./src/pmc/fixedstringarray.c"
+}
+static  INTVAL 
+Parrot_FixedStringArray_is_equal(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 555 "./src/pmc/fixedstringarray.pmc"
+
+    INTVAL j, n;
+
+    if (value->vtable->base_type != _self->vtable->base_type)
+        return 0;
+
+    n = VTABLE_elements(interp, _self);
+
+    if (VTABLE_elements(interp, value) != n)
+        return 0;
+
+    for (j = 0; j < n; ++j) {
+        STRING * const item1 = VTABLE_get_string_keyed_int(interp, _self, j);
+        STRING * const item2 = VTABLE_get_string_keyed_int(interp, value, j);
+
+        if (item1 == item2)
+            continue;
+
+        if (STRING_IS_NULL(item1) ||  STRING_IS_NULL(item2))
+            return 0;
+
+        if (!STRING_equal(interp, item1, item2))
+            return 0;
+    }
+
+    return 1;
+#line 354 "./src/pmc/fixedstringarray.c"
+}
+static  void 
+Parrot_FixedStringArray_mark(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 127 "./src/pmc/fixedstringarray.pmc"
+
+
+    STRING **str_array;
+    GETATTR_FixedStringArray_str_array(interp, _self, str_array);
+
+    if (str_array) {
+        UINTVAL size, i;
+        GETATTR_FixedStringArray_size(interp, _self, size);
+
+        for (i = 0; i < size; ++i) {
+            Parrot_gc_mark_STRING_alive(interp, str_array[i]);
+        }
+    }
+#line 373 "./src/pmc/fixedstringarray.c"
+}
+static  void 
+Parrot_FixedStringArray_set_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, INTVAL value)
+{
+#line 404 "./src/pmc/fixedstringarray.pmc"
+
+    const INTVAL k = VTABLE_get_integer(interp, key);
+    VTABLE_set_integer_keyed_int(interp, _self, k, value);
+#line 382 "./src/pmc/fixedstringarray.c"
+}
+static  void 
+Parrot_FixedStringArray_set_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, INTVAL value)
+{
+#line 389 "./src/pmc/fixedstringarray.pmc"
+
+    STRING *val = Parrot_str_from_int(interp, value);
+    VTABLE_set_string_keyed_int(interp, _self, key, val);
+#line 391 "./src/pmc/fixedstringarray.c"
+}
+static  void 
+Parrot_FixedStringArray_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL new_size)
+{
+#line 363 "./src/pmc/fixedstringarray.pmc"
+
+
+    UINTVAL  old_size;
+    GETATTR_FixedStringArray_size(interp, _self, old_size);
+
+    if (old_size || new_size < 1)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_OUT_OF_BOUNDS,
+            "FixedStringArray: Can't resize!");
+
+    SETATTR_FixedStringArray_size(interp, _self, new_size);
+    SETATTR_FixedStringArray_str_array(interp, _self,
+            mem_gc_allocate_n_zeroed_typed(interp, new_size, STRING*));
+
+    PObj_custom_mark_destroy_SETALL(_self);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 412 "./src/pmc/fixedstringarray.c"
+}
+static  void 
+Parrot_FixedStringArray_set_number_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, FLOATVAL value)
+{
+#line 436 "./src/pmc/fixedstringarray.pmc"
+
+    const INTVAL k = VTABLE_get_integer(interp, key);
+    VTABLE_set_number_keyed_int(interp, _self, k, value);
+#line 421 "./src/pmc/fixedstringarray.c"
+}
+static  void 
+Parrot_FixedStringArray_set_number_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, FLOATVAL value)
+{
+#line 420 "./src/pmc/fixedstringarray.pmc"
+
+    STRING * const val = Parrot_str_from_num(interp, value);
+    VTABLE_set_string_keyed_int(interp, _self, key, val);
+#line 430 "./src/pmc/fixedstringarray.c"
+}
+static  void 
+Parrot_FixedStringArray_set_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, PMC *value)
+{
+#line 505 "./src/pmc/fixedstringarray.pmc"
+
+    const INTVAL k = VTABLE_get_integer(interp, key);
+    VTABLE_set_pmc_keyed_int(interp, _self, k, value);
+#line 439 "./src/pmc/fixedstringarray.c"
+}
+static  void 
+Parrot_FixedStringArray_set_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, PMC *src)
+{
+#line 489 "./src/pmc/fixedstringarray.pmc"
+
+    STRING * const temp = VTABLE_get_string(interp, src);
+    VTABLE_set_string_keyed_int(interp, _self, key, temp);
+#line 448 "./src/pmc/fixedstringarray.c"
+}
+static  void 
+Parrot_FixedStringArray_set_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, STRING *value)
+{
+#line 474 "./src/pmc/fixedstringarray.pmc"
+
+    const INTVAL k = VTABLE_get_integer(interp, key);
+    VTABLE_set_string_keyed_int(interp, _self, k, value);
+#line 457 "./src/pmc/fixedstringarray.c"
+}
+static  void 
+Parrot_FixedStringArray_set_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, STRING *value)
+{
+#line 451 "./src/pmc/fixedstringarray.pmc"
+
+    STRING **str_array;
+
+    if (key < 0 || key >= VTABLE_elements(interp, _self))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_OUT_OF_BOUNDS,
+            "FixedStringArray: index out of bounds!");
+
+    GETATTR_FixedStringArray_str_array(interp, _self, str_array);
+
+    str_array[key] = value;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 474 "./src/pmc/fixedstringarray.c"
+}
+static  void 
+Parrot_FixedStringArray_thaw(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 619 "./src/pmc/fixedstringarray.pmc"
+
+    const UINTVAL size = VTABLE_shift_integer(interp, info);
+    VTABLE_init_int(interp, _self, size);
+    if (size > 0) {
+        UINTVAL i;
+        STRING **str_array;
+        GETATTR_FixedStringArray_str_array(interp, _self, str_array);
+
+        for (i = 0; i < size; ++i)
+            str_array[i] = VTABLE_shift_string(interp, info);
+    }
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 492 "./src/pmc/fixedstringarray.c"
+}
+static  void
+Parrot_FixedStringArray_nci_sort(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* cmp_func;
+    STRING* _param_name_str_key = CONST_STRING_GEN(interp, "key");
+    PMC* key;
+    
+    Parrot_pcc_fill_params_from_c_args(interp, _call_object, "PiPoSnPo",
+        &_self, &cmp_func, &_param_name_str_key, &key);
+
+    { /* BEGIN PMETHOD BODY */
+#line 643 "./src/pmc/fixedstringarray.pmc"
+
+    UINTVAL size;
+
+    GETATTR_FixedStringArray_size(interp, _self, size);
+
+    if (size > 1) {
+        STRING **str_array;
+        GETATTR_FixedStringArray_str_array(interp, _self, str_array);
+        Parrot_util_sort(interp, enum_type_STRING, str_array, size, cmp_func, key);
+    }
+    #line 520 "./src/pmc/fixedstringarray.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)_self);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return;
+     }
+#line 653 "./src/pmc/fixedstringarray.pmc"
+
+#line 528 "./src/pmc/fixedstringarray.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_FixedStringArray_nci_reverse(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 666 "./src/pmc/fixedstringarray.pmc"
+
+    UINTVAL n;
+    GETATTR_FixedStringArray_size(interp, _self, n);
+    if (n > 1) {
+        STRING *val;
+        STRING **data;
+        UINTVAL i;
+
+        GETATTR_FixedStringArray_str_array(interp, _self, data);
+        for (i = 0; i <= --n; i++) {
+            val = data[i];
+            data[i] = data[n];
+            data[n] = val;
+        }
+    }
+#line 571 "./src/pmc/fixedstringarray.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_FixedStringArray_update_vtable(VTABLE *vt) {
+    vt->clone = Parrot_FixedStringArray_clone;
+    vt->destroy = Parrot_FixedStringArray_destroy;
+    vt->elements = Parrot_FixedStringArray_elements;
+    vt->freeze = Parrot_FixedStringArray_freeze;
+    vt->get_bool = Parrot_FixedStringArray_get_bool;
+    vt->get_integer = Parrot_FixedStringArray_get_integer;
+    vt->get_integer_keyed = Parrot_FixedStringArray_get_integer_keyed;
+    vt->get_integer_keyed_int = Parrot_FixedStringArray_get_integer_keyed_int;
+    vt->get_iter = Parrot_FixedStringArray_get_iter;
+    vt->get_number = Parrot_FixedStringArray_get_number;
+    vt->get_number_keyed = Parrot_FixedStringArray_get_number_keyed;
+    vt->get_number_keyed_int = Parrot_FixedStringArray_get_number_keyed_int;
+    vt->get_pmc_keyed = Parrot_FixedStringArray_get_pmc_keyed;
+    vt->get_pmc_keyed_int = Parrot_FixedStringArray_get_pmc_keyed_int;
+    vt->get_repr = Parrot_FixedStringArray_get_repr;
+    vt->get_string = Parrot_FixedStringArray_get_string;
+    vt->get_string_keyed = Parrot_FixedStringArray_get_string_keyed;
+    vt->get_string_keyed_int = Parrot_FixedStringArray_get_string_keyed_int;
+    vt->init_int = Parrot_FixedStringArray_init_int;
+    vt->is_equal = Parrot_FixedStringArray_is_equal;
+    vt->mark = Parrot_FixedStringArray_mark;
+    vt->set_integer_keyed = Parrot_FixedStringArray_set_integer_keyed;
+    vt->set_integer_keyed_int = Parrot_FixedStringArray_set_integer_keyed_int;
+    vt->set_integer_native = Parrot_FixedStringArray_set_integer_native;
+    vt->set_number_keyed = Parrot_FixedStringArray_set_number_keyed;
+    vt->set_number_keyed_int = Parrot_FixedStringArray_set_number_keyed_int;
+    vt->set_pmc_keyed = Parrot_FixedStringArray_set_pmc_keyed;
+    vt->set_pmc_keyed_int = Parrot_FixedStringArray_set_pmc_keyed_int;
+    vt->set_string_keyed = Parrot_FixedStringArray_set_string_keyed;
+    vt->set_string_keyed_int = Parrot_FixedStringArray_set_string_keyed_int;
+    vt->thaw = Parrot_FixedStringArray_thaw;
+    vt->attr_size = sizeof(Parrot_FixedStringArray_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_FixedStringArray_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->clone = Parrot_FixedStringArray_clone;
+    vt->destroy = Parrot_FixedStringArray_destroy;
+    vt->elements = Parrot_FixedStringArray_elements;
+    vt->freeze = Parrot_FixedStringArray_freeze;
+    vt->get_bool = Parrot_FixedStringArray_get_bool;
+    vt->get_integer = Parrot_FixedStringArray_get_integer;
+    vt->get_integer_keyed = Parrot_FixedStringArray_get_integer_keyed;
+    vt->get_integer_keyed_int = Parrot_FixedStringArray_get_integer_keyed_int;
+    vt->get_iter = Parrot_FixedStringArray_get_iter;
+    vt->get_number = Parrot_FixedStringArray_get_number;
+    vt->get_number_keyed = Parrot_FixedStringArray_get_number_keyed;
+    vt->get_number_keyed_int = Parrot_FixedStringArray_get_number_keyed_int;
+    vt->get_pmc_keyed = Parrot_FixedStringArray_get_pmc_keyed;
+    vt->get_pmc_keyed_int = Parrot_FixedStringArray_get_pmc_keyed_int;
+    vt->get_repr = Parrot_FixedStringArray_get_repr;
+    vt->get_string = Parrot_FixedStringArray_get_string;
+    vt->get_string_keyed = Parrot_FixedStringArray_get_string_keyed;
+    vt->get_string_keyed_int = Parrot_FixedStringArray_get_string_keyed_int;
+    vt->is_equal = Parrot_FixedStringArray_is_equal;
+    vt->mark = Parrot_FixedStringArray_mark;
+    vt->attr_size = sizeof(Parrot_FixedStringArray_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_FixedStringArray_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_FixedStringArray_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_FixedStringArray_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_FixedStringArray_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_FixedStringArray_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "FixedStringArray"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_FixedStringArray_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "FixedStringArray")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_FixedStringArray_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        ":str_array :size ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_FixedStringArray_get_vtable(interp);
+        vt->base_type      = enum_class_FixedStringArray;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "FixedStringArray");
+        vt->provides_str = CONST_STRING_GEN(interp, "array");
+        vt->isa_hash     = Parrot_FixedStringArray_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_FixedStringArray_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_FixedStringArray;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_FixedStringArray_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "sort");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_FixedStringArray_nci_sort),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "reverse");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_FixedStringArray_nci_reverse),
+                method_name, signature);
+        }
+        {
+        }
+    } /* pass */
+} /* Parrot_FixedStringArray_class_init */
+
+#line 682 "./src/pmc/fixedstringarray.pmc"
+
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<docs/pdds/pdd17_basic_types.pod>.
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -0,0 +1,1794 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/float.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_fixedintegerarray.h"
+#include "pmc_float.h"
+#include "pmc_scalar.h"
+#include "pmc_default.h"
+#include "float.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/float.pmc"
+/*
+Copyright (C) 2003-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/float.pmc - Float PMC
+
+=head1 DESCRIPTION
+
+C<Float> PMC extends the abstract C<Scalar> PMC to provide floating-point
+number operations.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+#line 48 "./src/pmc/float.c"
+static  PMC  * Parrot_Float_absolute(PARROT_INTERP, ARGMOD(PMC *_self), PMC *dest);
+static  PMC  * Parrot_Float_clone(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL Parrot_Float_cmp(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  INTVAL Parrot_Float_cmp_num(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void  Parrot_Float_decrement(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Float_freeze(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+static  INTVAL  Parrot_Float_get_bool(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_Float_get_integer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  FLOATVAL  Parrot_Float_get_number(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  * Parrot_Float_get_pointer(SHIM_INTERP, ARGMOD(PMC *_self));
+static  STRING  * Parrot_Float_get_repr(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING  * Parrot_Float_get_string(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Float_i_absolute(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Float_i_neg(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Float_increment(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Float_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL Parrot_Float_is_equal(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  INTVAL Parrot_Float_is_equal_num(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  PMC  * Parrot_Float_neg(PARROT_INTERP, ARGMOD(PMC *_self), PMC *dest);
+static  void  Parrot_Float_set_bool(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void  Parrot_Float_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void  Parrot_Float_set_number_native(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value);
+static  void  Parrot_Float_set_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void  Parrot_Float_set_string_native(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value);
+static  void  Parrot_Float_thaw(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+static  INTVAL  Parrot_Float_multi_is_equal_Float(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  INTVAL  Parrot_Float_multi_is_equal_DEFAULT(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  INTVAL  Parrot_Float_multi_is_equal_num_Float(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  INTVAL  Parrot_Float_multi_is_equal_num_DEFAULT(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  INTVAL  Parrot_Float_multi_cmp_Float(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  INTVAL  Parrot_Float_multi_cmp_DEFAULT(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  INTVAL  Parrot_Float_multi_cmp_num_Float(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  INTVAL  Parrot_Float_multi_cmp_num_DEFAULT(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void Parrot_Float_nci_acos(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Float_nci_acot(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Float_nci_asec(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Float_nci_asin(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Float_nci_atan(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Float_nci_atan2(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Float_nci_cos(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Float_nci_cosh(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Float_nci_cot(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Float_nci_coth(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Float_nci_csc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Float_nci_exp(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Float_nci_ln(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Float_nci_log10(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Float_nci_log2(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Float_nci_sec(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Float_nci_sech(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Float_nci_sin(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Float_nci_sinh(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Float_nci_tan(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Float_nci_tanh(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Float_nci_sqrt(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Float_multi_is_equal_Float_pcc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Float_multi_is_equal_DEFAULT_pcc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Float_multi_is_equal_num_Float_pcc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Float_multi_is_equal_num_DEFAULT_pcc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Float_multi_cmp_Float_pcc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Float_multi_cmp_DEFAULT_pcc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Float_multi_cmp_num_Float_pcc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Float_multi_cmp_num_DEFAULT_pcc(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_Float_class_init(PARROT_INTERP, int, int);
+void    Parrot_Float_ro_class_init(PARROT_INTERP, int, int);
+static  PMC  *
+Parrot_Float_absolute(PARROT_INTERP, ARGMOD(PMC *_self), PMC *dest)
+{
+#line 359 "./src/pmc/float.pmc"
+
+    const FLOATVAL a = fabs(VTABLE_get_number(interp, _self));
+
+    dest = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+
+    VTABLE_set_number_native(interp, dest, a);
+    return dest;
+#line 125 "./src/pmc/float.c"
+}
+static  PMC  *
+Parrot_Float_clone(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 52 "./src/pmc/float.pmc"
+
+    FLOATVAL fv;
+    PMC * const dest = Parrot_pmc_new(interp, _self->vtable->base_type);
+    GETATTR_Float_fv(interp, _self, fv);
+    SETATTR_Float_fv(interp, dest, fv);
+    return dest;
+#line 137 "./src/pmc/float.c"
+}
+static  INTVAL
+Parrot_Float_cmp(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+    INTVAL type = VTABLE_type(interp, value);
+    /* For dynpmc fallback to MMD */
+    if ((type >= enum_class_core_max) || (VTABLE_type(interp, _self) >= enum_class_core_max))
+        type = enum_class_core_max;
+    switch(type) {
+        case enum_class_Float:
+            return Parrot_Float_multi_cmp_Float(interp, _self, value);
+            break;
+        case enum_class_core_max:
+            {
+                INTVAL retval;
+                Parrot_mmd_multi_dispatch_from_c_args(interp, "cmp", "PP->I", _self, value, &retval);
+                return retval;
+            }
+            break;
+        default:
+            return Parrot_Float_multi_cmp_DEFAULT(interp, _self, value);
+            break;
+
+    }
+}
+static  INTVAL
+Parrot_Float_cmp_num(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+    INTVAL type = VTABLE_type(interp, value);
+    /* For dynpmc fallback to MMD */
+    if ((type >= enum_class_core_max) || (VTABLE_type(interp, _self) >= enum_class_core_max))
+        type = enum_class_core_max;
+    switch(type) {
+        case enum_class_Float:
+            return Parrot_Float_multi_cmp_num_Float(interp, _self, value);
+            break;
+        case enum_class_core_max:
+            {
+                INTVAL retval;
+                Parrot_mmd_multi_dispatch_from_c_args(interp, "cmp_num", "PP->I", _self, value, &retval);
+                return retval;
+            }
+            break;
+        default:
+            return Parrot_Float_multi_cmp_num_DEFAULT(interp, _self, value);
+            break;
+
+    }
+}
+static  void 
+Parrot_Float_decrement(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 341 "./src/pmc/float.pmc"
+
+    FLOATVAL fv;
+    GETATTR_Float_fv(interp, _self, fv);
+    --fv;
+    SETATTR_Float_fv(interp, _self, fv);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 197 "./src/pmc/float.c"
+}
+static  void 
+Parrot_Float_freeze(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 382 "./src/pmc/float.pmc"
+
+    interp->vtables[enum_class_default]->freeze(interp, _self, info);
+    VTABLE_push_float(interp, info, VTABLE_get_number(interp, _self));
+#line 206 "./src/pmc/float.c"
+}
+static  INTVAL 
+Parrot_Float_get_bool(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 119 "./src/pmc/float.pmc"
+
+    const FLOATVAL f = VTABLE_get_number(interp, _self);
+    return !FLOAT_IS_ZERO(f);
+#line 215 "./src/pmc/float.c"
+}
+static  INTVAL 
+Parrot_Float_get_integer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 103 "./src/pmc/float.pmc"
+
+    /* two steps avoid casting warnings */
+    const FLOATVAL n = VTABLE_get_number(interp, _self);
+    return (INTVAL) n;
+#line 225 "./src/pmc/float.c"
+}
+static  FLOATVAL 
+Parrot_Float_get_number(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 86 "./src/pmc/float.pmc"
+
+    FLOATVAL fv;
+    GETATTR_Float_fv(interp, _self, fv);
+    return fv;
+#line 235 "./src/pmc/float.c"
+}
+static  void  *
+Parrot_Float_get_pointer(SHIM_INTERP, ARGMOD(PMC *_self))
+{
+#line 71 "./src/pmc/float.pmc"
+    return &(PARROT_FLOAT(_self)->fv);
+#line 242 "./src/pmc/float.c"
+}
+static  STRING  *
+Parrot_Float_get_repr(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 140 "./src/pmc/float.pmc"
+
+    const FLOATVAL val      = VTABLE_get_number(interp, _self);
+    const double d          = fabs((double)val);
+    const char * const sign = val < 0 ? "-" : "";
+    return Parrot_sprintf_c(interp, "%s" FLOATVAL_FMT, sign, d);
+#line 253 "./src/pmc/float.c"
+}
+static  STRING  *
+Parrot_Float_get_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 136 "./src/pmc/float.pmc"
+
+    return Parrot_str_from_num(interp, VTABLE_get_number(interp, _self));
+#line 261 "./src/pmc/float.c"
+}
+static  void 
+Parrot_Float_i_absolute(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 368 "./src/pmc/float.pmc"
+
+    const FLOATVAL a = fabs(VTABLE_get_number(interp, _self));
+    VTABLE_set_number_native(interp, _self, a);
+#line 270 "./src/pmc/float.c"
+}
+static  void 
+Parrot_Float_i_neg(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 237 "./src/pmc/float.pmc"
+
+    const FLOATVAL a = -VTABLE_get_number(interp, _self);
+    VTABLE_set_number_native(interp, _self, a);
+#line 279 "./src/pmc/float.c"
+}
+static  void 
+Parrot_Float_increment(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 324 "./src/pmc/float.pmc"
+
+    FLOATVAL fv;
+    GETATTR_Float_fv(interp, _self, fv);
+    ++fv;
+    SETATTR_Float_fv(interp, _self, fv);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 291 "./src/pmc/float.c"
+}
+static  void 
+Parrot_Float_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 38 "./src/pmc/float.pmc"
+
+    SETATTR_Float_fv(interp, _self, 0.0);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 300 "./src/pmc/float.c"
+}
+static  INTVAL
+Parrot_Float_is_equal(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+    INTVAL type = VTABLE_type(interp, value);
+    /* For dynpmc fallback to MMD */
+    if ((type >= enum_class_core_max) || (VTABLE_type(interp, _self) >= enum_class_core_max))
+        type = enum_class_core_max;
+    switch(type) {
+        case enum_class_Float:
+            return Parrot_Float_multi_is_equal_Float(interp, _self, value);
+            break;
+        case enum_class_core_max:
+            {
+                INTVAL retval;
+                Parrot_mmd_multi_dispatch_from_c_args(interp, "is_equal", "PP->I", _self, value, &retval);
+                return retval;
+            }
+            break;
+        default:
+            return Parrot_Float_multi_is_equal_DEFAULT(interp, _self, value);
+            break;
+
+    }
+}
+static  INTVAL
+Parrot_Float_is_equal_num(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+    INTVAL type = VTABLE_type(interp, value);
+    /* For dynpmc fallback to MMD */
+    if ((type >= enum_class_core_max) || (VTABLE_type(interp, _self) >= enum_class_core_max))
+        type = enum_class_core_max;
+    switch(type) {
+        case enum_class_Float:
+            return Parrot_Float_multi_is_equal_num_Float(interp, _self, value);
+            break;
+        case enum_class_core_max:
+            {
+                INTVAL retval;
+                Parrot_mmd_multi_dispatch_from_c_args(interp, "is_equal_num", "PP->I", _self, value, &retval);
+                return retval;
+            }
+            break;
+        default:
+            return Parrot_Float_multi_is_equal_num_DEFAULT(interp, _self, value);
+            break;
+
+    }
+}
+static  PMC  *
+Parrot_Float_neg(PARROT_INTERP, ARGMOD(PMC *_self), PMC *dest)
+{
+#line 228 "./src/pmc/float.pmc"
+
+    const FLOATVAL a = -VTABLE_get_number(interp, _self);
+
+    dest = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+
+    VTABLE_set_number_native(interp, dest, a);
+    return dest;
+#line 361 "./src/pmc/float.c"
+}
+static  void 
+Parrot_Float_set_bool(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+#line 163 "./src/pmc/float.pmc"
+
+    Parrot_pmc_reuse(interp, _self,
+        Parrot_hll_get_ctx_HLL_type(interp, enum_class_Boolean), 0);
+    VTABLE_set_bool(interp, _self, value);
+#line 371 "./src/pmc/float.c"
+}
+static  void 
+Parrot_Float_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+#line 157 "./src/pmc/float.pmc"
+
+    Parrot_pmc_reuse(interp, _self,
+        Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer), 0);
+    VTABLE_set_integer_native(interp, _self, value);
+#line 381 "./src/pmc/float.c"
+}
+static  void 
+Parrot_Float_set_number_native(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value)
+{
+#line 179 "./src/pmc/float.pmc"
+
+    SETATTR_Float_fv(interp, _self, value);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 390 "./src/pmc/float.c"
+}
+static  void 
+Parrot_Float_set_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 211 "./src/pmc/float.pmc"
+
+    SETATTR_Float_fv(interp, _self, VTABLE_get_number(interp, value));
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 399 "./src/pmc/float.c"
+}
+static  void 
+Parrot_Float_set_string_native(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value)
+{
+#line 195 "./src/pmc/float.pmc"
+
+    Parrot_pmc_reuse(interp, _self,
+        Parrot_hll_get_ctx_HLL_type(interp, enum_class_String), 0);
+    VTABLE_set_string_native(interp, _self, value);
+#line 409 "./src/pmc/float.c"
+}
+static  void 
+Parrot_Float_thaw(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 396 "./src/pmc/float.pmc"
+
+    interp->vtables[enum_class_default]->thaw(interp, _self, info);
+    SETATTR_Float_fv(interp, _self, VTABLE_shift_float(interp, info));
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 419 "./src/pmc/float.c"
+}
+static  INTVAL 
+Parrot_Float_multi_is_equal_Float(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 252 "./src/pmc/float.pmc"
+
+    return (INTVAL)(_self->vtable->get_number(interp, _self) == VTABLE_get_number(interp, value));
+#line 427 "./src/pmc/float.c"
+}
+static  INTVAL 
+Parrot_Float_multi_is_equal_DEFAULT(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 256 "./src/pmc/float.pmc"
+
+    return (INTVAL)(_self->vtable->get_number(interp, _self) == VTABLE_get_number(interp, value));
+#line 435 "./src/pmc/float.c"
+}
+static  INTVAL 
+Parrot_Float_multi_is_equal_num_Float(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 260 "./src/pmc/float.pmc"
+
+    return (INTVAL)(_self->vtable->get_number(interp, _self) == VTABLE_get_number(interp, value));
+#line 443 "./src/pmc/float.c"
+}
+static  INTVAL 
+Parrot_Float_multi_is_equal_num_DEFAULT(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 264 "./src/pmc/float.pmc"
+
+    return (INTVAL)(_self->vtable->get_number(interp, _self) == VTABLE_get_number(interp, value));
+#line 451 "./src/pmc/float.c"
+}
+static  INTVAL 
+Parrot_Float_multi_cmp_Float(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 278 "./src/pmc/float.pmc"
+
+    const FLOATVAL diff = _self->vtable->get_number(interp, _self) - VTABLE_get_number(interp, value);
+    return diff > 0 ? 1 : diff < 0 ? -1 : 0;
+#line 460 "./src/pmc/float.c"
+}
+static  INTVAL 
+Parrot_Float_multi_cmp_DEFAULT(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 283 "./src/pmc/float.pmc"
+
+    const FLOATVAL diff =
+            _self->vtable->get_number(interp, _self) - VTABLE_get_number(interp, value);
+    return diff > 0 ? 1 : diff < 0 ? -1 : 0;
+#line 470 "./src/pmc/float.c"
+}
+static  INTVAL 
+Parrot_Float_multi_cmp_num_Float(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 299 "./src/pmc/float.pmc"
+
+    const FLOATVAL diff = _self->vtable->get_number(interp, _self) - VTABLE_get_number(interp, value);
+    return diff > 0 ? 1 : diff < 0 ? -1 : 0;
+#line 479 "./src/pmc/float.c"
+}
+static  INTVAL 
+Parrot_Float_multi_cmp_num_DEFAULT(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 304 "./src/pmc/float.pmc"
+
+    /* fix an apparent gcc 4.4.x and 4.5.x bug that manifests itself when
+     * using g++ and an optimized build. See TT #1978.
+     */
+    volatile FLOATVAL n1 = _self->vtable->get_number(interp, _self);
+    volatile FLOATVAL n2 = VTABLE_get_number(interp, value);
+    const FLOATVAL diff = n1 - n2;
+    return diff > 0 ? 1 : diff < 0 ? -1 : 0;
+#line 493 "./src/pmc/float.c"
+}
+static  void
+Parrot_Float_nci_acos(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 505 "./src/pmc/float.pmc"
+
+    PMC * const d  = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+    SETATTR_Float_fv(interp, d, acos(_self->vtable->get_number(interp, _self)));
+    #line 517 "./src/pmc/float.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)d);
+        
+        return;
+     }
+#line 508 "./src/pmc/float.pmc"
+
+#line 525 "./src/pmc/float.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Float_nci_acot(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 512 "./src/pmc/float.pmc"
+
+    PMC * const d  = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+    SETATTR_Float_fv(interp, d, atan(1.0 / _self->vtable->get_number(interp, _self)));
+    #line 556 "./src/pmc/float.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)d);
+        
+        return;
+     }
+#line 515 "./src/pmc/float.pmc"
+
+#line 564 "./src/pmc/float.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Float_nci_asec(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 518 "./src/pmc/float.pmc"
+
+    PMC * const d  = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+    SETATTR_Float_fv(interp, d, acos(1.0 / _self->vtable->get_number(interp, _self)));
+    #line 595 "./src/pmc/float.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)d);
+        
+        return;
+     }
+#line 521 "./src/pmc/float.pmc"
+
+#line 603 "./src/pmc/float.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Float_nci_asin(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 524 "./src/pmc/float.pmc"
+
+    PMC * const d  = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+    SETATTR_Float_fv(interp, d, asin(_self->vtable->get_number(interp, _self)));
+    #line 634 "./src/pmc/float.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)d);
+        
+        return;
+     }
+#line 527 "./src/pmc/float.pmc"
+
+#line 642 "./src/pmc/float.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Float_nci_atan(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 530 "./src/pmc/float.pmc"
+
+    PMC * const d  = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+    SETATTR_Float_fv(interp, d, atan(_self->vtable->get_number(interp, _self)));
+    #line 673 "./src/pmc/float.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)d);
+        
+        return;
+     }
+#line 533 "./src/pmc/float.pmc"
+
+#line 681 "./src/pmc/float.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Float_nci_atan2(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* val;
+    
+    const INTVAL arity = 2; /* "PiP" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    val = VTABLE_get_pmc_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 536 "./src/pmc/float.pmc"
+
+    PMC * const d  = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+    SETATTR_Float_fv(interp, d, atan2(_self->vtable->get_number(interp, _self), VTABLE_get_number(interp, val)));
+    #line 714 "./src/pmc/float.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)d);
+        
+        return;
+     }
+#line 539 "./src/pmc/float.pmc"
+
+#line 722 "./src/pmc/float.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Float_nci_cos(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 542 "./src/pmc/float.pmc"
+
+    PMC * const d  = Parrot_pmc_new(interp,
+            Parrot_hll_get_ctx_HLL_type(interp, enum_class_Float));
+    SETATTR_Float_fv(interp, d, cos(_self->vtable->get_number(interp, _self)));
+    #line 754 "./src/pmc/float.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)d);
+        
+        return;
+     }
+#line 546 "./src/pmc/float.pmc"
+
+#line 762 "./src/pmc/float.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Float_nci_cosh(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 549 "./src/pmc/float.pmc"
+
+    PMC * const d  = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+    SETATTR_Float_fv(interp, d, cosh(_self->vtable->get_number(interp, _self)));
+    #line 793 "./src/pmc/float.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)d);
+        
+        return;
+     }
+#line 552 "./src/pmc/float.pmc"
+
+#line 801 "./src/pmc/float.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Float_nci_cot(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 555 "./src/pmc/float.pmc"
+
+    PMC * const d  = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+    SETATTR_Float_fv(interp, d, 1.0 / tan(_self->vtable->get_number(interp, _self)));
+    #line 832 "./src/pmc/float.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)d);
+        
+        return;
+     }
+#line 558 "./src/pmc/float.pmc"
+
+#line 840 "./src/pmc/float.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Float_nci_coth(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 562 "./src/pmc/float.pmc"
+
+    PMC * const d  = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+    SETATTR_Float_fv(interp, d, 1.0 / tanh(_self->vtable->get_number(interp, _self)));
+    #line 871 "./src/pmc/float.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)d);
+        
+        return;
+     }
+#line 565 "./src/pmc/float.pmc"
+
+#line 879 "./src/pmc/float.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Float_nci_csc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 568 "./src/pmc/float.pmc"
+
+    PMC * const d  = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+    SETATTR_Float_fv(interp, d, 1.0 / sin(_self->vtable->get_number(interp, _self)));
+    #line 910 "./src/pmc/float.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)d);
+        
+        return;
+     }
+#line 571 "./src/pmc/float.pmc"
+
+#line 918 "./src/pmc/float.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Float_nci_exp(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 574 "./src/pmc/float.pmc"
+
+    PMC * const d  = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+    SETATTR_Float_fv(interp, d, exp(_self->vtable->get_number(interp, _self)));
+    #line 949 "./src/pmc/float.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)d);
+        
+        return;
+     }
+#line 577 "./src/pmc/float.pmc"
+
+#line 957 "./src/pmc/float.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Float_nci_ln(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 580 "./src/pmc/float.pmc"
+
+    PMC * const d  = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+    SETATTR_Float_fv(interp, d, log(_self->vtable->get_number(interp, _self)));
+    #line 988 "./src/pmc/float.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)d);
+        
+        return;
+     }
+#line 583 "./src/pmc/float.pmc"
+
+#line 996 "./src/pmc/float.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Float_nci_log10(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 586 "./src/pmc/float.pmc"
+
+    PMC * const d  = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+    SETATTR_Float_fv(interp, d, log10(_self->vtable->get_number(interp, _self)));
+    #line 1027 "./src/pmc/float.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)d);
+        
+        return;
+     }
+#line 589 "./src/pmc/float.pmc"
+
+#line 1035 "./src/pmc/float.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Float_nci_log2(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 592 "./src/pmc/float.pmc"
+
+    PMC * const d  = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+    SETATTR_Float_fv(interp, d, log(_self->vtable->get_number(interp, _self)) / log(2.0));
+    #line 1066 "./src/pmc/float.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)d);
+        
+        return;
+     }
+#line 595 "./src/pmc/float.pmc"
+
+#line 1074 "./src/pmc/float.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Float_nci_sec(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 598 "./src/pmc/float.pmc"
+
+    PMC * const d  = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+    SETATTR_Float_fv(interp, d, 1.0 / cos(_self->vtable->get_number(interp, _self)));
+    #line 1105 "./src/pmc/float.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)d);
+        
+        return;
+     }
+#line 601 "./src/pmc/float.pmc"
+
+#line 1113 "./src/pmc/float.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Float_nci_sech(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 604 "./src/pmc/float.pmc"
+
+    PMC * const d  = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+    SETATTR_Float_fv(interp, d, 1.0 / cosh(_self->vtable->get_number(interp, _self)));
+    #line 1144 "./src/pmc/float.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)d);
+        
+        return;
+     }
+#line 607 "./src/pmc/float.pmc"
+
+#line 1152 "./src/pmc/float.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Float_nci_sin(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 610 "./src/pmc/float.pmc"
+
+    PMC * const d  = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+    SETATTR_Float_fv(interp, d, sin(_self->vtable->get_number(interp, _self)));
+    #line 1183 "./src/pmc/float.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)d);
+        
+        return;
+     }
+#line 613 "./src/pmc/float.pmc"
+
+#line 1191 "./src/pmc/float.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Float_nci_sinh(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 616 "./src/pmc/float.pmc"
+
+    PMC * const d  = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+    SETATTR_Float_fv(interp, d, sinh(_self->vtable->get_number(interp, _self)));
+    #line 1222 "./src/pmc/float.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)d);
+        
+        return;
+     }
+#line 619 "./src/pmc/float.pmc"
+
+#line 1230 "./src/pmc/float.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Float_nci_tan(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 622 "./src/pmc/float.pmc"
+
+    PMC * const d  = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+    SETATTR_Float_fv(interp, d, tan(_self->vtable->get_number(interp, _self)));
+    #line 1261 "./src/pmc/float.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)d);
+        
+        return;
+     }
+#line 625 "./src/pmc/float.pmc"
+
+#line 1269 "./src/pmc/float.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Float_nci_tanh(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 628 "./src/pmc/float.pmc"
+
+    PMC * const d  = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+    SETATTR_Float_fv(interp, d, tanh(_self->vtable->get_number(interp, _self)));
+    #line 1300 "./src/pmc/float.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)d);
+        
+        return;
+     }
+#line 631 "./src/pmc/float.pmc"
+
+#line 1308 "./src/pmc/float.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Float_nci_sqrt(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 634 "./src/pmc/float.pmc"
+
+    PMC * const d  = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+    SETATTR_Float_fv(interp, d, sqrt(_self->vtable->get_number(interp, _self)));
+    #line 1339 "./src/pmc/float.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)d);
+        
+        return;
+     }
+#line 637 "./src/pmc/float.pmc"
+
+#line 1347 "./src/pmc/float.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Float_multi_is_equal_Float_pcc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+PMC *value;
+INTVAL  _result;
+PMC *_call_obj = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+Parrot_pcc_fill_params_from_c_args(interp, _call_obj, "PiP", &_self, &value);
+_result = Parrot_Float_multi_is_equal_Float(interp, _self, value);
+    Parrot_pcc_set_call_from_c_args(interp, _call_obj, "I", _result);
+}
+static  void
+Parrot_Float_multi_is_equal_DEFAULT_pcc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+PMC *value;
+INTVAL  _result;
+PMC *_call_obj = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+Parrot_pcc_fill_params_from_c_args(interp, _call_obj, "PiP", &_self, &value);
+_result = Parrot_Float_multi_is_equal_DEFAULT(interp, _self, value);
+    Parrot_pcc_set_call_from_c_args(interp, _call_obj, "I", _result);
+}
+static  void
+Parrot_Float_multi_is_equal_num_Float_pcc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+PMC *value;
+INTVAL  _result;
+PMC *_call_obj = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+Parrot_pcc_fill_params_from_c_args(interp, _call_obj, "PiP", &_self, &value);
+_result = Parrot_Float_multi_is_equal_num_Float(interp, _self, value);
+    Parrot_pcc_set_call_from_c_args(interp, _call_obj, "I", _result);
+}
+static  void
+Parrot_Float_multi_is_equal_num_DEFAULT_pcc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+PMC *value;
+INTVAL  _result;
+PMC *_call_obj = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+Parrot_pcc_fill_params_from_c_args(interp, _call_obj, "PiP", &_self, &value);
+_result = Parrot_Float_multi_is_equal_num_DEFAULT(interp, _self, value);
+    Parrot_pcc_set_call_from_c_args(interp, _call_obj, "I", _result);
+}
+static  void
+Parrot_Float_multi_cmp_Float_pcc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+PMC *value;
+INTVAL  _result;
+PMC *_call_obj = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+Parrot_pcc_fill_params_from_c_args(interp, _call_obj, "PiP", &_self, &value);
+_result = Parrot_Float_multi_cmp_Float(interp, _self, value);
+    Parrot_pcc_set_call_from_c_args(interp, _call_obj, "I", _result);
+}
+static  void
+Parrot_Float_multi_cmp_DEFAULT_pcc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+PMC *value;
+INTVAL  _result;
+PMC *_call_obj = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+Parrot_pcc_fill_params_from_c_args(interp, _call_obj, "PiP", &_self, &value);
+_result = Parrot_Float_multi_cmp_DEFAULT(interp, _self, value);
+    Parrot_pcc_set_call_from_c_args(interp, _call_obj, "I", _result);
+}
+static  void
+Parrot_Float_multi_cmp_num_Float_pcc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+PMC *value;
+INTVAL  _result;
+PMC *_call_obj = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+Parrot_pcc_fill_params_from_c_args(interp, _call_obj, "PiP", &_self, &value);
+_result = Parrot_Float_multi_cmp_num_Float(interp, _self, value);
+    Parrot_pcc_set_call_from_c_args(interp, _call_obj, "I", _result);
+}
+static  void
+Parrot_Float_multi_cmp_num_DEFAULT_pcc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+PMC *value;
+INTVAL  _result;
+PMC *_call_obj = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+Parrot_pcc_fill_params_from_c_args(interp, _call_obj, "PiP", &_self, &value);
+_result = Parrot_Float_multi_cmp_num_DEFAULT(interp, _self, value);
+    Parrot_pcc_set_call_from_c_args(interp, _call_obj, "I", _result);
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_Float_update_vtable(VTABLE *vt) {
+    vt->absolute = Parrot_Float_absolute;
+    vt->clone = Parrot_Float_clone;
+    vt->cmp = Parrot_Float_cmp;
+    vt->cmp_num = Parrot_Float_cmp_num;
+    vt->decrement = Parrot_Float_decrement;
+    vt->freeze = Parrot_Float_freeze;
+    vt->get_bool = Parrot_Float_get_bool;
+    vt->get_integer = Parrot_Float_get_integer;
+    vt->get_number = Parrot_Float_get_number;
+    vt->get_pointer = Parrot_Float_get_pointer;
+    vt->get_repr = Parrot_Float_get_repr;
+    vt->get_string = Parrot_Float_get_string;
+    vt->i_absolute = Parrot_Float_i_absolute;
+    vt->i_neg = Parrot_Float_i_neg;
+    vt->increment = Parrot_Float_increment;
+    vt->init = Parrot_Float_init;
+    vt->is_equal = Parrot_Float_is_equal;
+    vt->is_equal_num = Parrot_Float_is_equal_num;
+    vt->neg = Parrot_Float_neg;
+    vt->set_bool = Parrot_Float_set_bool;
+    vt->set_integer_native = Parrot_Float_set_integer_native;
+    vt->set_number_native = Parrot_Float_set_number_native;
+    vt->set_pmc = Parrot_Float_set_pmc;
+    vt->set_string_native = Parrot_Float_set_string_native;
+    vt->thaw = Parrot_Float_thaw;
+    vt->attr_size = sizeof(Parrot_Float_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_Float_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->absolute = Parrot_Float_absolute;
+    vt->clone = Parrot_Float_clone;
+    vt->cmp = Parrot_Float_cmp;
+    vt->cmp_num = Parrot_Float_cmp_num;
+    vt->freeze = Parrot_Float_freeze;
+    vt->get_bool = Parrot_Float_get_bool;
+    vt->get_integer = Parrot_Float_get_integer;
+    vt->get_number = Parrot_Float_get_number;
+    vt->get_pointer = Parrot_Float_get_pointer;
+    vt->get_repr = Parrot_Float_get_repr;
+    vt->get_string = Parrot_Float_get_string;
+    vt->is_equal = Parrot_Float_is_equal;
+    vt->is_equal_num = Parrot_Float_is_equal_num;
+    vt->neg = Parrot_Float_neg;
+    vt->attr_size = sizeof(Parrot_Float_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Float_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_scalar_get_vtable(interp);
+    Parrot_Float_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Float_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_scalar_ro_get_vtable(interp);
+    Parrot_Float_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_Float_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+    mro = Parrot_scalar_get_mro(interp, mro);
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "Float"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_Float_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    isa = Parrot_scalar_get_isa(interp, isa);
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "Float")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_Float_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "Ffv ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_Float_get_vtable(interp);
+        vt->base_type      = enum_class_Float;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "Float");
+        vt->provides_str = CONST_STRING_GEN(interp, "float scalar");
+        vt->isa_hash     = Parrot_Float_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_Float_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_Float;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_Float_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "acos");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Float_nci_acos),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "acot");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Float_nci_acot),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "asec");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Float_nci_asec),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "asin");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Float_nci_asin),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "atan");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Float_nci_atan),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "atan2");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Float_nci_atan2),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "cos");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Float_nci_cos),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "cosh");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Float_nci_cosh),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "cot");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Float_nci_cot),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "coth");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Float_nci_coth),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "csc");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Float_nci_csc),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "exp");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Float_nci_exp),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "ln");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Float_nci_ln),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "log10");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Float_nci_log10),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "log2");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Float_nci_log2),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "sec");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Float_nci_sec),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "sech");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Float_nci_sech),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "sin");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Float_nci_sin),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "sinh");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Float_nci_sinh),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "tan");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Float_nci_tan),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "tanh");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Float_nci_tanh),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "sqrt");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Float_nci_sqrt),
+                method_name, signature);
+        }
+        {
+            STRING * const mfl_0 = CONST_STRING_GEN(interp, "is_equal");
+            STRING * const mfl_1 = CONST_STRING_GEN(interp, "Float,Float");
+            STRING * const mfl_2 = CONST_STRING_GEN(interp, "Float");
+            STRING * const mfl_3 = CONST_STRING_GEN(interp, "Float,DEFAULT");
+            STRING * const mfl_4 = CONST_STRING_GEN(interp, "is_equal_num");
+            STRING * const mfl_5 = CONST_STRING_GEN(interp, "cmp");
+            STRING * const mfl_6 = CONST_STRING_GEN(interp, "cmp_num");
+        PMC *_temp_func;
+_temp_func = Parrot_pmc_new(interp, enum_class_NativePCCMethod);
+VTABLE_set_pointer_keyed_str(interp, _temp_func, CONST_STRING(interp, "->"), (void *)Parrot_Float_multi_is_equal_Float_pcc);
+Parrot_mmd_add_multi_from_long_sig(interp, mfl_0, mfl_1, _temp_func);
+
+_temp_func = Parrot_pmc_new(interp, enum_class_NativePCCMethod);
+VTABLE_set_pointer_keyed_str(interp, _temp_func, CONST_STRING(interp, "->"), (void *)Parrot_Float_multi_is_equal_DEFAULT_pcc);
+Parrot_mmd_add_multi_from_long_sig(interp, mfl_0, mfl_3, _temp_func);
+
+_temp_func = Parrot_pmc_new(interp, enum_class_NativePCCMethod);
+VTABLE_set_pointer_keyed_str(interp, _temp_func, CONST_STRING(interp, "->"), (void *)Parrot_Float_multi_is_equal_num_Float_pcc);
+Parrot_mmd_add_multi_from_long_sig(interp, mfl_4, mfl_1, _temp_func);
+
+_temp_func = Parrot_pmc_new(interp, enum_class_NativePCCMethod);
+VTABLE_set_pointer_keyed_str(interp, _temp_func, CONST_STRING(interp, "->"), (void *)Parrot_Float_multi_is_equal_num_DEFAULT_pcc);
+Parrot_mmd_add_multi_from_long_sig(interp, mfl_4, mfl_3, _temp_func);
+
+_temp_func = Parrot_pmc_new(interp, enum_class_NativePCCMethod);
+VTABLE_set_pointer_keyed_str(interp, _temp_func, CONST_STRING(interp, "->"), (void *)Parrot_Float_multi_cmp_Float_pcc);
+Parrot_mmd_add_multi_from_long_sig(interp, mfl_5, mfl_1, _temp_func);
+
+_temp_func = Parrot_pmc_new(interp, enum_class_NativePCCMethod);
+VTABLE_set_pointer_keyed_str(interp, _temp_func, CONST_STRING(interp, "->"), (void *)Parrot_Float_multi_cmp_DEFAULT_pcc);
+Parrot_mmd_add_multi_from_long_sig(interp, mfl_5, mfl_3, _temp_func);
+
+_temp_func = Parrot_pmc_new(interp, enum_class_NativePCCMethod);
+VTABLE_set_pointer_keyed_str(interp, _temp_func, CONST_STRING(interp, "->"), (void *)Parrot_Float_multi_cmp_num_Float_pcc);
+Parrot_mmd_add_multi_from_long_sig(interp, mfl_6, mfl_1, _temp_func);
+
+_temp_func = Parrot_pmc_new(interp, enum_class_NativePCCMethod);
+VTABLE_set_pointer_keyed_str(interp, _temp_func, CONST_STRING(interp, "->"), (void *)Parrot_Float_multi_cmp_num_DEFAULT_pcc);
+Parrot_mmd_add_multi_from_long_sig(interp, mfl_6, mfl_3, _temp_func);
+
+        }
+    } /* pass */
+} /* Parrot_Float_class_init */
+
+#line 638 "./src/pmc/float.pmc"
+
+
+/*
+
+=back
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
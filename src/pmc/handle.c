@@ -0,0 +1,776 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/handle.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_fixedintegerarray.h"
+#include "pmc_handle.h"
+#include "pmc_default.h"
+#include "handle.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/handle.pmc"
+/*
+Copyright (C) 2008-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/handle.pmc - Handle PMC
+
+=head1 DESCRIPTION
+
+This is the base-class for all IO-related PMCs.
+
+=head2 Vtable Functions
+
+=over 4
+
+=item C<init>
+
+=item C<init_pmc>
+
+Handle shouldn't be directly instantiated, init and init_pmc throws
+EXCEPTION_INVALID_OPERATION.
+
+=cut
+
+*/
+
+#include "parrot/parrot.h"
+#include "../src/io/io_private.h"
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+#line 56 "./src/pmc/handle.c"
+static  void  * Parrot_Handle_get_pointer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  void  Parrot_Handle_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Handle_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *init));
+static  void  Parrot_Handle_set_pointer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, void *ptr);
+static  void Parrot_Handle_nci_isatty(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Handle_nci_get_fd(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Handle_nci_read(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Handle_nci_readline(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Handle_nci_read_bytes(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Handle_nci_write_bytes(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Handle_nci_record_separator(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Handle_nci_close(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Handle_nci_encoding(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_Handle_class_init(PARROT_INTERP, int, int);
+void    Parrot_Handle_ro_class_init(PARROT_INTERP, int, int);
+static  void  *
+Parrot_Handle_get_pointer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+#line 57 "./src/pmc/handle.pmc"
+
+    void * ptr;
+    switch (key) {
+        case IO_PTR_IDX_VTABLE:
+            GETATTR_Handle_io_vtable(interp, _self, ptr);
+            break;
+        case IO_PTR_IDX_READ_BUFFER:
+            GETATTR_Handle_read_buffer(interp, _self, ptr);
+            break;
+        case IO_PTR_IDX_WRITE_BUFFER:
+            GETATTR_Handle_write_buffer(interp, _self, ptr);
+            break;
+        default:
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_PIO_ERROR,
+                "Handle: Cannot get pointer %d", key);
+    }
+    return ptr;
+#line 93 "./src/pmc/handle.c"
+}
+static  void 
+Parrot_Handle_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 44 "./src/pmc/handle.pmc"
+
+    /**/UNUSED(_self)
+    Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+        "Handle cannot be instantiated directly.");
+#line 103 "./src/pmc/handle.c"
+}
+static  void 
+Parrot_Handle_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *init))
+{
+#line 50 "./src/pmc/handle.pmc"
+    /**/UNUSED(_self)
+    Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+        "Handle cannot be instantiated directly.");
+#line 112 "./src/pmc/handle.c"
+}
+static  void 
+Parrot_Handle_set_pointer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, void *ptr)
+{
+#line 76 "./src/pmc/handle.pmc"
+
+    switch (key) {
+        case IO_PTR_IDX_VTABLE:
+            {
+            SETATTR_Handle_io_vtable(interp, _self, (IO_VTABLE *)ptr);
+            PARROT_GC_WRITE_BARRIER(interp, _self);
+            }
+            break;
+        case IO_PTR_IDX_READ_BUFFER:
+            {
+            SETATTR_Handle_read_buffer(interp, _self, (IO_BUFFER *)ptr);
+            PARROT_GC_WRITE_BARRIER(interp, _self);
+            break;
+            }
+        case IO_PTR_IDX_WRITE_BUFFER:
+            {
+            SETATTR_Handle_write_buffer(interp, _self, (IO_BUFFER *)ptr);
+            PARROT_GC_WRITE_BARRIER(interp, _self);
+            }
+            break;
+        default:
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_PIO_ERROR,
+                "Handle: Cannot set pointer %d", key);
+    }
+#line 142 "./src/pmc/handle.c"
+}
+static  void
+Parrot_Handle_nci_isatty(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 120 "./src/pmc/handle.pmc"
+
+    #line 164 "./src/pmc/handle.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)0);
+        
+        return;
+     }
+#line 121 "./src/pmc/handle.pmc"
+
+#line 172 "./src/pmc/handle.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Handle_nci_get_fd(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 135 "./src/pmc/handle.pmc"
+
+    PIOHANDLE os_handle;
+    INTVAL    fd;
+    GETATTR_Handle_os_handle(interp, _self, os_handle);
+    fd = (INTVAL)os_handle;
+    #line 205 "./src/pmc/handle.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)fd);
+        
+        return;
+     }
+#line 140 "./src/pmc/handle.pmc"
+
+#line 213 "./src/pmc/handle.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Handle_nci_read(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    INTVAL length;
+    
+    const INTVAL arity = 2; /* "PiI" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    length = VTABLE_get_integer_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 154 "./src/pmc/handle.pmc"
+
+    STRING * const string_result = Parrot_io_reads(interp, _self, length);
+    #line 245 "./src/pmc/handle.c"
+     {
+        VTABLE_set_string_keyed_int(interp, _call_object, 0, (STRING*)string_result);
+        
+        return;
+     }
+#line 156 "./src/pmc/handle.pmc"
+
+#line 253 "./src/pmc/handle.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Handle_nci_readline(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* record_separator;
+    INTVAL has_rs;
+    
+    const INTVAL arity = 1; /* "PiSoIp" */
+    const INTVAL arity_opt  = 1;
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count < arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too few arguments: %d passed, %d expected",
+                                    param_count, arity);
+    if (param_count > arity + arity_opt)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too many arguments: %d passed, %d expected",
+                                    param_count, arity + arity_opt);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    if (param_count > 1) {
+        record_separator = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+        has_rs = 1;
+    }
+    else {
+        record_separator = STRINGNULL;
+        has_rs = 0;
+    }
+
+    { /* BEGIN PMETHOD BODY */
+#line 170 "./src/pmc/handle.pmc"
+
+    STRING * string_result;
+    if (!has_rs) {
+        GETATTR_Handle_record_separator(interp, _self, record_separator);
+    }
+    string_result = Parrot_io_readline_s(interp, _self, record_separator);
+    #line 303 "./src/pmc/handle.c"
+     {
+        VTABLE_set_string_keyed_int(interp, _call_object, 0, (STRING*)string_result);
+        
+        return;
+     }
+#line 176 "./src/pmc/handle.pmc"
+
+#line 311 "./src/pmc/handle.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Handle_nci_read_bytes(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    INTVAL length;
+    INTVAL has_length;
+    
+    const INTVAL arity = 1; /* "PiIoIp" */
+    const INTVAL arity_opt  = 1;
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count < arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too few arguments: %d passed, %d expected",
+                                    param_count, arity);
+    if (param_count > arity + arity_opt)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too many arguments: %d passed, %d expected",
+                                    param_count, arity + arity_opt);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    if (param_count > 1) {
+        length = VTABLE_get_integer_keyed_int(interp, _call_object, 1);
+        has_length = 1;
+    }
+    else {
+        length = 0;
+        has_length = 0;
+    }
+
+    { /* BEGIN PMETHOD BODY */
+#line 191 "./src/pmc/handle.pmc"
+
+    PMC * const bb = Parrot_io_read_byte_buffer_pmc(interp, _self, PMCNULL,
+                                   has_length ? length : (signed)PIO_READ_SIZE_ANY);
+    #line 358 "./src/pmc/handle.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)bb);
+        
+        return;
+     }
+#line 194 "./src/pmc/handle.pmc"
+
+#line 366 "./src/pmc/handle.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Handle_nci_write_bytes(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* bytebuffer;
+    INTVAL length;
+    
+    const INTVAL arity = 3; /* "PiPI" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    bytebuffer = VTABLE_get_pmc_keyed_int(interp, _call_object, 1);
+    length = VTABLE_get_integer_keyed_int(interp, _call_object, 2);
+
+    { /* BEGIN PMETHOD BODY */
+#line 197 "./src/pmc/handle.pmc"
+
+    const INTVAL written = Parrot_io_write_byte_buffer_pmc(interp, _self, bytebuffer, length);
+    #line 400 "./src/pmc/handle.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)written);
+        
+        return;
+     }
+#line 199 "./src/pmc/handle.pmc"
+
+#line 408 "./src/pmc/handle.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Handle_nci_record_separator(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* str;
+    INTVAL has_str;
+    
+    const INTVAL arity = 1; /* "PiSoIp" */
+    const INTVAL arity_opt  = 1;
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count < arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too few arguments: %d passed, %d expected",
+                                    param_count, arity);
+    if (param_count > arity + arity_opt)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too many arguments: %d passed, %d expected",
+                                    param_count, arity + arity_opt);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    if (param_count > 1) {
+        str = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+        has_str = 1;
+    }
+    else {
+        str = STRINGNULL;
+        has_str = 0;
+    }
+
+    { /* BEGIN PMETHOD BODY */
+#line 213 "./src/pmc/handle.pmc"
+
+    if (has_str) {
+        if (STRING_IS_NULL(str))
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+                "Record separator may not be null");
+
+        str = Parrot_io_reencode_string_for_handle(interp, _self, str);
+        SETATTR_Handle_record_separator(interp, _self, str);
+    }
+    else {
+        GETATTR_Handle_record_separator(interp, _self, str);
+    }
+
+    #line 465 "./src/pmc/handle.c"
+     {
+        VTABLE_set_string_keyed_int(interp, _call_object, 0, (STRING*)str);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return;
+     }
+#line 226 "./src/pmc/handle.pmc"
+
+#line 473 "./src/pmc/handle.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Handle_nci_close(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 240 "./src/pmc/handle.pmc"
+
+    const INTVAL status = Parrot_io_close(interp, _self, 1);
+    #line 503 "./src/pmc/handle.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)status);
+        
+        return;
+     }
+#line 242 "./src/pmc/handle.pmc"
+
+#line 511 "./src/pmc/handle.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Handle_nci_encoding(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* encoding;
+    INTVAL got_encoding;
+    
+    const INTVAL arity = 1; /* "PiSoIp" */
+    const INTVAL arity_opt  = 1;
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count < arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too few arguments: %d passed, %d expected",
+                                    param_count, arity);
+    if (param_count > arity + arity_opt)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too many arguments: %d passed, %d expected",
+                                    param_count, arity + arity_opt);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    if (param_count > 1) {
+        encoding = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+        got_encoding = 1;
+    }
+    else {
+        encoding = STRINGNULL;
+        got_encoding = 0;
+    }
+
+    { /* BEGIN PMETHOD BODY */
+#line 256 "./src/pmc/handle.pmc"
+
+    if (got_encoding) {
+        STRING * record_separator;
+
+        SETATTR_Handle_encoding(interp, _self, encoding);
+        GETATTR_Handle_record_separator(interp, _self, record_separator);
+        record_separator = Parrot_io_reencode_string_for_handle(interp, _self, record_separator);
+        SETATTR_Handle_record_separator(interp, _self, record_separator);
+    }
+    else {
+        GETATTR_Handle_encoding(interp, _self, encoding);
+    }
+    #line 567 "./src/pmc/handle.c"
+     {
+        VTABLE_set_string_keyed_int(interp, _call_object, 0, (STRING*)encoding);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return;
+     }
+#line 268 "./src/pmc/handle.pmc"
+
+#line 575 "./src/pmc/handle.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_Handle_update_vtable(VTABLE *vt) {
+    vt->get_pointer_keyed_int = Parrot_Handle_get_pointer_keyed_int;
+    vt->init = Parrot_Handle_init;
+    vt->init_pmc = Parrot_Handle_init_pmc;
+    vt->set_pointer_keyed_int = Parrot_Handle_set_pointer_keyed_int;
+    vt->attr_size = 0;
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_Handle_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->get_pointer_keyed_int = Parrot_Handle_get_pointer_keyed_int;
+    vt->attr_size = 0;
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Handle_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_Handle_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Handle_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_Handle_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_Handle_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "Handle"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_Handle_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "Handle")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_Handle_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        ":os_handle Srecord_separator :io_vtable :read_buffer :write_buffer Sencoding ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_Handle_get_vtable(interp);
+        vt->base_type      = enum_class_Handle;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "Handle");
+        vt->provides_str = CONST_STRING_GEN(interp, "Handle");
+        vt->isa_hash     = Parrot_Handle_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_Handle_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_Handle;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_Handle_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "isatty");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Handle_nci_isatty),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "get_fd");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Handle_nci_get_fd),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "read");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Handle_nci_read),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "readline");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Handle_nci_readline),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "read_bytes");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Handle_nci_read_bytes),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "write_bytes");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Handle_nci_write_bytes),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "record_separator");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Handle_nci_record_separator),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "close");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Handle_nci_close),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "encoding");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Handle_nci_encoding),
+                method_name, signature);
+        }
+        {
+        }
+    } /* pass */
+} /* Parrot_Handle_class_init */
+
+#line 269 "./src/pmc/handle.pmc"
+
+
+/*
+
+=back
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
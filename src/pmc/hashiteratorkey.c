@@ -0,0 +1,338 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/hashiteratorkey.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_fixedintegerarray.h"
+#include "pmc_hashiteratorkey.h"
+#include "pmc_default.h"
+#include "hashiteratorkey.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/hashiteratorkey.pmc"
+/*
+Copyright (C) 2001-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/hashiteratorkey.pmc - HashIteratorKey PMC
+
+=head1 DESCRIPTION
+
+Accessor for a single value during hash iteration, a single (key,value) pair.
+
+=head1 Methods
+
+=over 4
+
+=cut
+
+*/
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+#line 46 "./src/pmc/hashiteratorkey.c"
+static  INTVAL  Parrot_HashIteratorKey_get_integer(SHIM_INTERP, SHIM(PMC *_self));
+static  PMC*  Parrot_HashIteratorKey_get_pmc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING*  Parrot_HashIteratorKey_get_string(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_HashIteratorKey_set_pointer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, void *value);
+static  void Parrot_HashIteratorKey_nci_key(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_HashIteratorKey_nci_value(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_HashIteratorKey_class_init(PARROT_INTERP, int, int);
+void    Parrot_HashIteratorKey_ro_class_init(PARROT_INTERP, int, int);
+static  INTVAL 
+Parrot_HashIteratorKey_get_integer(SHIM_INTERP, SHIM(PMC *_self))
+{
+#line 62 "./src/pmc/hashiteratorkey.pmc"
+    return -1;
+#line 60 "./src/pmc/hashiteratorkey.c"
+}
+static  PMC* 
+Parrot_HashIteratorKey_get_pmc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 37 "./src/pmc/hashiteratorkey.pmc"
+
+    Parrot_HashIteratorKey_attributes *attrs =
+            PARROT_HASHITERATORKEY(_self);
+
+    /* TT #1080 & TT #1081 Wallpapering problem with NULL attributes */
+    if (!attrs->parrot_hash || !attrs->bucket)
+        return PMCNULL;
+
+    return Parrot_hash_key_to_pmc(interp, attrs->parrot_hash, attrs->bucket->key);
+#line 75 "./src/pmc/hashiteratorkey.c"
+}
+static  STRING* 
+Parrot_HashIteratorKey_get_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 68 "./src/pmc/hashiteratorkey.pmc"
+
+    const Parrot_HashIteratorKey_attributes * const attrs =
+            PARROT_HASHITERATORKEY(_self);
+
+    /* TT #1080 & TT #1081 Wallpapering problem with NULL attributes */
+    if (!attrs->parrot_hash || !attrs->bucket)
+        return CONST_STRING(interp, "");
+
+    return Parrot_hash_key_to_string(interp, attrs->parrot_hash, attrs->bucket->key);
+#line 90 "./src/pmc/hashiteratorkey.c"
+}
+static  void 
+Parrot_HashIteratorKey_set_pointer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, void *value)
+{
+#line 88 "./src/pmc/hashiteratorkey.pmc"
+
+    Parrot_HashIteratorKey_attributes *attrs =
+            PARROT_HASHITERATORKEY(_self);
+
+    PARROT_ASSERT_MSG(value, "Can't set NULL pointer into HashIteratorKey");
+
+    if (key == 0) {
+        attrs->parrot_hash = (Hash*)value;
+    }
+    else if (key == 1) {
+        attrs->bucket = (HashBucket*)value;
+    }
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 109 "./src/pmc/hashiteratorkey.c"
+}
+static  void
+Parrot_HashIteratorKey_nci_key(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 48 "./src/pmc/hashiteratorkey.pmc"
+
+    PMC * const ret = _self->vtable->get_pmc(interp, _self);
+    #line 132 "./src/pmc/hashiteratorkey.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)ret);
+        
+        return;
+     }
+#line 50 "./src/pmc/hashiteratorkey.pmc"
+
+#line 140 "./src/pmc/hashiteratorkey.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_HashIteratorKey_nci_value(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 53 "./src/pmc/hashiteratorkey.pmc"
+
+    const Parrot_HashIteratorKey_attributes * const attrs =
+            PARROT_HASHITERATORKEY(_self);
+    PMC * const ret =
+        Parrot_hash_value_to_pmc(interp, attrs->parrot_hash, attrs->bucket->value);
+    #line 173 "./src/pmc/hashiteratorkey.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)ret);
+        
+        return;
+     }
+#line 58 "./src/pmc/hashiteratorkey.pmc"
+
+#line 181 "./src/pmc/hashiteratorkey.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_HashIteratorKey_update_vtable(VTABLE *vt) {
+    vt->get_integer = Parrot_HashIteratorKey_get_integer;
+    vt->get_pmc = Parrot_HashIteratorKey_get_pmc;
+    vt->get_string = Parrot_HashIteratorKey_get_string;
+    vt->set_pointer_keyed_int = Parrot_HashIteratorKey_set_pointer_keyed_int;
+    vt->attr_size = sizeof(Parrot_HashIteratorKey_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_HashIteratorKey_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->get_integer = Parrot_HashIteratorKey_get_integer;
+    vt->get_pmc = Parrot_HashIteratorKey_get_pmc;
+    vt->get_string = Parrot_HashIteratorKey_get_string;
+    vt->attr_size = sizeof(Parrot_HashIteratorKey_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_HashIteratorKey_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_HashIteratorKey_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_HashIteratorKey_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_HashIteratorKey_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_HashIteratorKey_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "HashIteratorKey"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_HashIteratorKey_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "HashIteratorKey")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_HashIteratorKey_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        ":parrot_hash :bucket ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_HashIteratorKey_get_vtable(interp);
+        vt->base_type      = enum_class_HashIteratorKey;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "HashIteratorKey");
+        vt->provides_str = CONST_STRING_GEN(interp, "scalar");
+        vt->isa_hash     = Parrot_HashIteratorKey_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_HashIteratorKey_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_HashIteratorKey;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_HashIteratorKey_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "key");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_HashIteratorKey_nci_key),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "value");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_HashIteratorKey_nci_value),
+                method_name, signature);
+        }
+        {
+        }
+    } /* pass */
+} /* Parrot_HashIteratorKey_class_init */
+
+#line 101 "./src/pmc/hashiteratorkey.pmc"
+
+
+/*
+
+=back
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
+
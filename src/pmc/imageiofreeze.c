@@ -0,0 +1,978 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/imageiofreeze.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_imageiofreeze.h"
+#include "pmc_default.h"
+#include "imageiofreeze.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/imageiofreeze.pmc"
+/*
+Copyright (C) 2010-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/imageiofreeze.pmc - ImageIOFreeze PMC
+
+=head1 DESCRIPTION
+
+Freezes other PMCs. Part of the internal serializer.
+
+=head1 FUNCTIONS
+
+=over 4
+
+=cut
+
+*/
+
+#include "parrot/imageio.h"
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+PARROT_INLINE
+static UINTVAL check_seen(PARROT_INTERP, ARGIN(PMC *self), ARGIN(PMC *v))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+static void create_buffer(PARROT_INTERP,
+    ARGIN_NULLOK(PMC *pmc),
+    ARGMOD(PMC *info))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*info);
+
+PARROT_INLINE
+static void ensure_buffer_size(PARROT_INTERP, ARGIN(PMC *io), size_t len)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_INLINE
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static opcode_t * GET_VISIT_CURSOR(ARGIN(const PMC *pmc))
+        __attribute__nonnull__(1);
+
+PARROT_INLINE
+static void INC_VISIT_CURSOR(ARGMOD(PMC *pmc), UINTVAL inc)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*pmc);
+
+PARROT_INLINE
+static void SET_VISIT_CURSOR(ARGMOD(PMC *pmc), ARGIN(const char *cursor))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*pmc);
+
+static void stream_flush(PARROT_INTERP, ARGMOD(PMC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*self);
+
+static void stream_push_string(PARROT_INTERP,
+    ARGMOD(PMC *self),
+    ARGIN_NULLOK(STRING *v))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*self);
+
+PARROT_INLINE
+static void stream_push_varint(PARROT_INTERP, ARGMOD(PMC *self), UINTVAL v)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*self);
+
+PARROT_INLINE
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static unsigned char * stream_reserve(PARROT_INTERP,
+    ARGMOD(PMC *self),
+    size_t len)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*self);
+
+static void stream_start(PARROT_INTERP, ARGMOD(PMC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*self);
+
+PARROT_INLINE
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static unsigned char * stream_store_varint(
+    ARGOUT(unsigned char *cursor),
+    UINTVAL v)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*cursor);
+
+static void stream_write(PARROT_INTERP,
+    ARGIN(PMC *self),
+    ARGIN(const void *buffer),
+    size_t len)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+#define ASSERT_ARGS_check_seen __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(v))
+#define ASSERT_ARGS_create_buffer __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(info))
+#define ASSERT_ARGS_ensure_buffer_size __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(io))
+#define ASSERT_ARGS_GET_VISIT_CURSOR __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(pmc))
+#define ASSERT_ARGS_INC_VISIT_CURSOR __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(pmc))
+#define ASSERT_ARGS_SET_VISIT_CURSOR __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(pmc) \
+    , PARROT_ASSERT_ARG(cursor))
+#define ASSERT_ARGS_stream_flush __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_stream_push_string __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_stream_push_varint __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_stream_reserve __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_stream_start __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_stream_store_varint __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(cursor))
+#define ASSERT_ARGS_stream_write __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(buffer))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+/*
+
+=item C<static opcode_t * GET_VISIT_CURSOR(const PMC *pmc)>
+
+Get the buffer cursor. Buffer relocations are handled.
+
+=cut
+
+*/
+
+PARROT_INLINE
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static opcode_t *
+GET_VISIT_CURSOR(ARGIN(const PMC *pmc))
+{
+    ASSERT_ARGS(GET_VISIT_CURSOR)
+
+    char * const buf = (char *)Buffer_bufstart(PARROT_IMAGEIOFREEZE(pmc)->buffer);
+    const size_t pos = PARROT_IMAGEIOFREEZE(pmc)->pos;
+    return (opcode_t *)(buf + pos);
+}
+
+/*
+
+=item C<static void SET_VISIT_CURSOR(PMC *pmc, const char *cursor)>
+
+Set the buffer cursor. Buffer relocations are handled.
+
+=cut
+
+*/
+
+
+PARROT_INLINE
+static void
+SET_VISIT_CURSOR(ARGMOD(PMC *pmc), ARGIN(const char *cursor))
+{
+    ASSERT_ARGS(SET_VISIT_CURSOR)
+
+    const char * const bufstart  = (const char *)Buffer_bufstart(PARROT_IMAGEIOFREEZE(pmc)->buffer);
+    PARROT_IMAGEIOFREEZE(pmc)->pos = (cursor - bufstart);
+}
+
+/*
+
+=item C<static void INC_VISIT_CURSOR(PMC *pmc, UINTVAL inc)>
+
+Increment the buffer cursor. Buffer relocations are handled.
+
+=cut
+
+*/
+
+
+PARROT_INLINE
+static void
+INC_VISIT_CURSOR(ARGMOD(PMC *pmc), UINTVAL inc)
+{
+    ASSERT_ARGS(INC_VISIT_CURSOR)
+
+    PARROT_IMAGEIOFREEZE(pmc)->pos += inc;
+}
+
+
+/*
+
+=item C<static void create_buffer(PARROT_INTERP, PMC *pmc, PMC *info)>
+
+Allocate the image buffer.
+
+=cut
+
+*/
+
+static void
+create_buffer(PARROT_INTERP, ARGIN_NULLOK(PMC *pmc), ARGMOD(PMC *info))
+{
+    ASSERT_ARGS(create_buffer)
+
+    INTVAL  len;
+
+    if (!PMC_IS_NULL(pmc)) {
+        STRING * const array = CONST_STRING(interp, "array");
+        STRING * const hash  = CONST_STRING(interp, "hash");
+        INTVAL         items = 1;
+
+        if (VTABLE_does(interp, pmc, array) || VTABLE_does(interp, pmc, hash))
+            items += VTABLE_elements(interp, pmc);
+
+        len = items * FREEZE_BYTES_PER_ITEM;
+    }
+    else
+        len = FREEZE_BYTES_PER_ITEM;
+
+    PARROT_IMAGEIOFREEZE(info)->buffer =
+        Parrot_gc_new_bufferlike_header(interp, sizeof (Parrot_Buffer));
+    Parrot_gc_allocate_buffer_storage_aligned(interp,
+        PARROT_IMAGEIOFREEZE(info)->buffer, len);
+    SET_VISIT_CURSOR(info,
+        (const char *)Buffer_bufstart(PARROT_IMAGEIOFREEZE(info)->buffer));
+}
+
+/*
+
+=item C<static void ensure_buffer_size(PARROT_INTERP, PMC *io, size_t len)>
+
+Checks the size of the buffer to see if it can accommodate C<len> more
+bytes. If not, expands the buffer.
+
+=cut
+
+*/
+
+PARROT_INLINE
+static void
+ensure_buffer_size(PARROT_INTERP, ARGIN(PMC *io), size_t len)
+{
+    ASSERT_ARGS(ensure_buffer_size)
+
+    Parrot_Buffer * const buf  = PARROT_IMAGEIOFREEZE(io)->buffer;
+    const size_t used   = PARROT_IMAGEIOFREEZE(io)->pos;
+    const int need_free = Buffer_buflen(buf) - used - len;
+
+    /* grow by factor 1.5 or such */
+    if (need_free <= 16) {
+        size_t new_size = (size_t) (Buffer_buflen(buf) * 1.5);
+
+        if (new_size < Buffer_buflen(buf) - need_free + 512)
+            new_size = Buffer_buflen(buf) - need_free + 512;
+
+        Parrot_gc_reallocate_buffer_storage(interp, buf, new_size);
+        PARROT_ASSERT(Buffer_buflen(buf) - used - len >= 15);
+    }
+
+#ifndef DISABLE_GC_DEBUG
+    Parrot_gc_compact_memory_pool(interp);
+#endif
+}
+
+
+/*
+
+=item C<static UINTVAL check_seen(PARROT_INTERP, PMC *self, PMC *v)>
+
+Check the seen hash to prevent duplicate serialization.
+
+=cut
+
+*/
+
+PARROT_INLINE
+static UINTVAL
+check_seen(PARROT_INTERP, ARGIN(PMC *self), ARGIN(PMC *v))
+{
+    ASSERT_ARGS(check_seen)
+    Hash       * const seen = (Hash *)VTABLE_get_pointer(interp, PARROT_IMAGEIOFREEZE(self)->seen);
+    HashBucket * const b    = Parrot_hash_get_bucket(interp, seen, v);
+    if (b)
+        return (UINTVAL)b->value;
+    else
+        return 0;
+}
+
+/*
+
+=item C<static void stream_write(PARROT_INTERP, PMC *self, const void *buffer,
+size_t len)>
+
+Writes C<len> bytes of a streaming image to the handle, throwing if the
+handle does not take all of them.
+
+=cut
+
+*/
+
+static void
+stream_write(PARROT_INTERP, ARGIN(PMC *self), ARGIN(const void *buffer), size_t len)
+{
+    ASSERT_ARGS(stream_write)
+
+    if (Parrot_io_write_b(interp, PARROT_IMAGEIOFREEZE(self)->handle, buffer, len) != len)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_PIO_ERROR,
+                "Short write while freezing to handle");
+}
+
+/*
+
+=item C<static void stream_flush(PARROT_INTERP, PMC *self)>
+
+Writes the pending chunk of a streaming image to the handle as one frame.
+
+=cut
+
+*/
+
+static void
+stream_flush(PARROT_INTERP, ARGMOD(PMC *self))
+{
+    ASSERT_ARGS(stream_flush)
+    Parrot_ImageIOFreeze_attributes * const attrs = PARROT_IMAGEIOFREEZE(self);
+
+    if (attrs->chunk_pos) {
+        unsigned char  header[FREEZE_STREAM_VARINT_MAX];
+        unsigned char *end = stream_store_varint(header, attrs->chunk_pos);
+
+        stream_write(interp, self, header, end - header);
+        stream_write(interp, self, attrs->chunk, attrs->chunk_pos);
+        attrs->chunk_pos = 0;
+    }
+}
+
+/*
+
+=item C<static unsigned char * stream_reserve(PARROT_INTERP, PMC *self, size_t
+len)>
+
+Makes room for an item of C<len> bytes in the current chunk, flushing the
+chunk first if the item would straddle the frame boundary. Returns the
+write position.
+
+=cut
+
+*/
+
+PARROT_INLINE
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static unsigned char *
+stream_reserve(PARROT_INTERP, ARGMOD(PMC *self), size_t len)
+{
+    ASSERT_ARGS(stream_reserve)
+    Parrot_ImageIOFreeze_attributes * const attrs = PARROT_IMAGEIOFREEZE(self);
+
+    if (attrs->chunk_pos + len > FREEZE_STREAM_FRAME_SIZE)
+        stream_flush(interp, self);
+
+    return attrs->chunk + attrs->chunk_pos;
+}
+
+/*
+
+=item C<static unsigned char * stream_store_varint(unsigned char *cursor,
+UINTVAL v)>
+
+Stores C<v> as a LEB128 varint at C<cursor> and returns the position after
+it. At most C<FREEZE_STREAM_VARINT_MAX> bytes are written.
+
+=cut
+
+*/
+
+PARROT_INLINE
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static unsigned char *
+stream_store_varint(ARGOUT(unsigned char *cursor), UINTVAL v)
+{
+    ASSERT_ARGS(stream_store_varint)
+
+    while (v >= 0x80) {
+        *cursor++ = (unsigned char)(v | 0x80);
+        v >>= 7;
+    }
+    *cursor++ = (unsigned char)v;
+    return cursor;
+}
+
+/*
+
+=item C<static void stream_push_varint(PARROT_INTERP, PMC *self, UINTVAL v)>
+
+Appends the varint C<v> to a streaming image.
+
+=cut
+
+*/
+
+PARROT_INLINE
+static void
+stream_push_varint(PARROT_INTERP, ARGMOD(PMC *self), UINTVAL v)
+{
+    ASSERT_ARGS(stream_push_varint)
+    unsigned char * const start = stream_reserve(interp, self, FREEZE_STREAM_VARINT_MAX);
+
+    PARROT_IMAGEIOFREEZE(self)->chunk_pos += stream_store_varint(start, v) - start;
+}
+
+/*
+
+=item C<static void stream_push_string(PARROT_INTERP, PMC *self, STRING *v)>
+
+Appends the string C<v> to a streaming image. Strings too long for a frame
+are written straight to the handle as a frame of their own.
+
+=cut
+
+*/
+
+static void
+stream_push_string(PARROT_INTERP, ARGMOD(PMC *self), ARGIN_NULLOK(STRING *v))
+{
+    ASSERT_ARGS(stream_push_string)
+    Parrot_ImageIOFreeze_attributes * const attrs = PARROT_IMAGEIOFREEZE(self);
+    UINTVAL tag;
+    size_t  len;
+
+    if (STRING_IS_NULL(v)) {
+        stream_push_varint(interp, self, 0);
+        return;
+    }
+
+    tag = ((UINTVAL)Parrot_encoding_number_of_str(interp, v) << 2)
+        | (PObj_constant_TEST(v) ? 1 : 0)
+        | (PObj_get_FLAGS(v) & PObj_private7_FLAG ? 2 : 0);
+    len = v->bufused;
+
+    stream_push_varint(interp, self, tag + 1);
+    stream_push_varint(interp, self, len);
+
+    if (!len)
+        return;
+
+    if (len <= FREEZE_STREAM_FRAME_SIZE) {
+        memcpy(stream_reserve(interp, self, len), v->strstart, len);
+        attrs->chunk_pos += len;
+    }
+    else {
+        /* Writing may allocate, so keep the string body where it is */
+        const int pinned = !PObj_external_TEST(v);
+        DECL_CONST_CAST;
+
+        stream_flush(interp, self);
+        if (pinned)
+            Parrot_str_pin(interp, PARROT_const_cast(STRING *, v));
+        attrs->chunk_pos = stream_store_varint(attrs->chunk, len) - attrs->chunk;
+        stream_write(interp, self, attrs->chunk, attrs->chunk_pos);
+        stream_write(interp, self, v->strstart, len);
+        attrs->chunk_pos = 0;
+        if (pinned)
+            Parrot_str_unpin(interp, PARROT_const_cast(STRING *, v));
+    }
+}
+
+/*
+
+=item C<static void stream_start(PARROT_INTERP, PMC *self)>
+
+Allocates the chunk buffer and writes the stream header to the handle.
+
+=cut
+
+*/
+
+static void
+stream_start(PARROT_INTERP, ARGMOD(PMC *self))
+{
+    ASSERT_ARGS(stream_start)
+    Parrot_ImageIOFreeze_attributes * const attrs = PARROT_IMAGEIOFREEZE(self);
+    unsigned char header[FREEZE_STREAM_HEADER_BYTES];
+
+    memcpy(header, FREEZE_STREAM_MAGIC, 4);
+    header[4] = FREEZE_STREAM_VERSION;
+    header[5] = (unsigned char)attrs->stream_flags;
+    header[6] = sizeof (FLOATVAL);
+    header[7] = PARROT_BIGENDIAN;
+
+    attrs->chunk     = mem_gc_allocate_n_typed(interp,
+                            FREEZE_STREAM_FRAME_SIZE, unsigned char);
+    attrs->chunk_pos = 0;
+    PObj_custom_destroy_SET(self);
+
+    stream_write(interp, self, header, FREEZE_STREAM_HEADER_BYTES);
+}
+#line 548 "./src/pmc/imageiofreeze.c"
+static  void  Parrot_ImageIOFreeze_destroy(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_ImageIOFreeze_get_integer(SHIM_INTERP, SHIM(PMC *_self));
+static  void  * Parrot_ImageIOFreeze_get_pointer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING  * Parrot_ImageIOFreeze_get_string(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_ImageIOFreeze_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_ImageIOFreeze_mark(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_ImageIOFreeze_push_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL v);
+static  void  Parrot_ImageIOFreeze_push_integer(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL v);
+static  void  Parrot_ImageIOFreeze_push_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *v);
+static  void  Parrot_ImageIOFreeze_push_string(PARROT_INTERP, ARGMOD(PMC *_self), STRING *v);
+static  void  Parrot_ImageIOFreeze_set_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *p);
+static  void  Parrot_ImageIOFreeze_set_pointer(PARROT_INTERP, ARGMOD(PMC *_self), void *value);
+void    Parrot_ImageIOFreeze_class_init(PARROT_INTERP, int, int);
+void    Parrot_ImageIOFreeze_ro_class_init(PARROT_INTERP, int, int);
+static  void 
+Parrot_ImageIOFreeze_destroy(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 584 "./src/pmc/imageiofreeze.pmc"
+
+    /* streaming images have no PackFile */
+    if (PARROT_IMAGEIOFREEZE(_self)->pf) {
+        PackFile_destroy(interp, PARROT_IMAGEIOFREEZE(_self)->pf);
+        PARROT_IMAGEIOFREEZE(_self)->pf = NULL;
+    }
+    if (PARROT_IMAGEIOFREEZE(_self)->chunk) {
+        mem_gc_free(interp, PARROT_IMAGEIOFREEZE(_self)->chunk);
+        PARROT_IMAGEIOFREEZE(_self)->chunk = NULL;
+    }
+#line 577 "./src/pmc/imageiofreeze.c"
+}
+static  INTVAL 
+Parrot_ImageIOFreeze_get_integer(SHIM_INTERP, SHIM(PMC *_self))
+{
+#line 660 "./src/pmc/imageiofreeze.pmc"
+    return VISIT_FREEZE_NORMAL;
+#line 584 "./src/pmc/imageiofreeze.c"
+}
+static  void  *
+Parrot_ImageIOFreeze_get_pointer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 645 "./src/pmc/imageiofreeze.pmc"
+
+    return VTABLE_get_pointer(interp, PARROT_IMAGEIOFREEZE(_self)->seen);
+#line 592 "./src/pmc/imageiofreeze.c"
+}
+static  STRING  *
+Parrot_ImageIOFreeze_get_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 627 "./src/pmc/imageiofreeze.pmc"
+
+    if (!PARROT_IMAGEIOFREEZE(_self)->buffer)
+        return STRINGNULL;
+    return Parrot_str_new_from_buffer(interp,
+                                      PARROT_IMAGEIOFREEZE(_self)->buffer,
+                                      PARROT_IMAGEIOFREEZE(_self)->pos);
+#line 604 "./src/pmc/imageiofreeze.c"
+}
+static  void 
+Parrot_ImageIOFreeze_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 561 "./src/pmc/imageiofreeze.pmc"
+
+    PObj_custom_mark_SET(_self);
+
+    PARROT_IMAGEIOFREEZE(_self)->seen = Parrot_pmc_new(interp, enum_class_Hash);
+    VTABLE_set_pointer(interp, PARROT_IMAGEIOFREEZE(_self)->seen,
+        Parrot_hash_new_intval_hash(interp));
+
+    PARROT_IMAGEIOFREEZE(_self)->todo =
+        Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+
+    PObj_flag_CLEAR(private1, _self);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 622 "./src/pmc/imageiofreeze.c"
+}
+static  void 
+Parrot_ImageIOFreeze_mark(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 606 "./src/pmc/imageiofreeze.pmc"
+
+    PObj * const buffer = (PObj *)(PARROT_IMAGEIOFREEZE(_self)->buffer);
+    if (buffer)
+        Parrot_gc_mark_PObj_alive(interp, buffer);
+    Parrot_gc_mark_PMC_alive(interp, PARROT_IMAGEIOFREEZE(_self)->todo);
+    Parrot_gc_mark_PMC_alive(interp, PARROT_IMAGEIOFREEZE(_self)->seen);
+    Parrot_gc_mark_PMC_alive(interp, PARROT_IMAGEIOFREEZE(_self)->handle);
+#line 635 "./src/pmc/imageiofreeze.c"
+}
+static  void 
+Parrot_ImageIOFreeze_push_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL v)
+{
+#line 700 "./src/pmc/imageiofreeze.pmc"
+
+    if (PARROT_IMAGEIOFREEZE(_self)->handle) {
+        memcpy(stream_reserve(interp, _self, sizeof (FLOATVAL)), &v, sizeof (FLOATVAL));
+        PARROT_IMAGEIOFREEZE(_self)->chunk_pos += sizeof (FLOATVAL);
+    }
+    else {
+        const size_t len = PF_size_number() * sizeof (opcode_t);
+        ensure_buffer_size(interp, _self, len);
+        SET_VISIT_CURSOR(_self,
+            (const char *)PF_store_number(GET_VISIT_CURSOR(_self), &v));
+    }
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 653 "./src/pmc/imageiofreeze.c"
+}
+static  void 
+Parrot_ImageIOFreeze_push_integer(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL v)
+{
+#line 677 "./src/pmc/imageiofreeze.pmc"
+
+    if (PARROT_IMAGEIOFREEZE(_self)->handle) {
+        stream_push_varint(interp, _self, FREEZE_STREAM_ZIGZAG(v));
+    }
+    else {
+        const size_t len = PF_size_integer() * sizeof (opcode_t);
+        ensure_buffer_size(interp, _self, len);
+        SET_VISIT_CURSOR(_self,
+            (const char *)PF_store_integer(GET_VISIT_CURSOR(_self), v));
+    }
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 670 "./src/pmc/imageiofreeze.c"
+}
+static  void 
+Parrot_ImageIOFreeze_push_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *v)
+{
+#line 773 "./src/pmc/imageiofreeze.pmc"
+
+    UINTVAL id;
+
+    if (PARROT_IMAGEIOFREEZE(_self)->handle) {
+        if (PMC_IS_NULL(v))
+            stream_push_varint(interp, _self, 0);
+        else if (!(PARROT_IMAGEIOFREEZE(_self)->stream_flags & FREEZE_STREAM_TREE)
+             && (id = check_seen(interp, _self, v)))
+            stream_push_varint(interp, _self, (id << 1) | 1);
+        else {
+            const INTVAL base_type = PObj_is_object_TEST(v)
+                                ? (INTVAL) enum_class_Object
+                                : v->vtable->base_type;
+
+            if (!(PARROT_IMAGEIOFREEZE(_self)->stream_flags & FREEZE_STREAM_TREE)) {
+                Hash * const seen = (Hash *)VTABLE_get_pointer(interp,
+                                                PARROT_IMAGEIOFREEZE(_self)->seen);
+                id = ++PARROT_IMAGEIOFREEZE(_self)->id;
+                Parrot_hash_put(interp, seen, v, (void *)id);
+            }
+
+            stream_push_varint(interp, _self, (UINTVAL)base_type << 1);
+            VTABLE_push_pmc(interp, PARROT_IMAGEIOFREEZE(_self)->todo, v);
+            PARROT_GC_WRITE_BARRIER(interp, _self);
+        }
+        return;
+    }
+
+    if (PMC_IS_NULL(v))
+        VTABLE_push_integer(interp, _self, PackID_new(0, enum_PackID_seen));
+    else if ((id = check_seen(interp, _self, v)))
+        VTABLE_push_integer(interp, _self, PackID_new(id, enum_PackID_seen));
+    else {
+        INTVAL constno, idx;
+        PackFile_ConstTable * const table = PARROT_IMAGEIOFREEZE(_self)->pf_ct;
+        Hash * const seen = (Hash *)VTABLE_get_pointer(interp,
+                                                PARROT_IMAGEIOFREEZE(_self)->seen);
+
+        id = ++PARROT_IMAGEIOFREEZE(_self)->id;
+
+        if (PObj_flag_TEST(private1, _self)
+        &&  PackFile_ConstTable_rlookup_pmc(interp, table, v, &constno, &idx)) {
+            VTABLE_push_integer(interp, _self, PackID_new(id, enum_PackID_pbc_backref));
+            VTABLE_push_integer(interp, _self, constno);
+            VTABLE_push_integer(interp, _self, idx - 1);
+        }
+        else {
+            const INTVAL base_type = PObj_is_object_TEST(v)
+                                ? (INTVAL) enum_class_Object
+                                : v->vtable->base_type;
+            VTABLE_push_integer(interp, _self, PackID_new(id, enum_PackID_normal));
+            VTABLE_push_integer(interp, _self, base_type);
+            VTABLE_push_pmc(interp, PARROT_IMAGEIOFREEZE(_self)->todo, v);
+            PARROT_GC_WRITE_BARRIER(interp, _self);
+        }
+
+        Parrot_hash_put(interp, seen, v, (void *)id);
+    }
+#line 734 "./src/pmc/imageiofreeze.c"
+}
+static  void 
+Parrot_ImageIOFreeze_push_string(PARROT_INTERP, ARGMOD(PMC *_self), STRING *v)
+{
+#line 724 "./src/pmc/imageiofreeze.pmc"
+
+    if (PARROT_IMAGEIOFREEZE(_self)->handle) {
+        stream_push_string(interp, _self, v);
+        return;
+    }
+
+    if (PObj_flag_TEST(private1, _self)) {
+        /* store a reference to constant table entry of string */
+        PackFile_ConstTable * const table = PARROT_IMAGEIOFREEZE(_self)->pf_ct;
+        const int idx =
+            PackFile_ConstTable_rlookup_str(interp, table, v);
+
+        if (idx >= 0) {
+            Parrot_ImageIOFreeze_push_integer(interp, _self, idx);
+            return;
+        }
+
+        /* XXX handle cases where the PMC has changed after
+         * Parrot_freeze_strings was called eg: :immediate subs */
+        Parrot_ImageIOFreeze_push_integer(interp, _self, -1);
+
+        /* TODO
+         * should really be:
+         * PANIC(interp, "string not previously in constant table "
+         *               "when freezing to packfile"); */
+    }
+
+    {
+        const size_t len = PF_size_string(v) * sizeof (opcode_t);
+        ensure_buffer_size(interp, _self, len);
+        SET_VISIT_CURSOR(_self,
+            (const char *)PF_store_string(GET_VISIT_CURSOR(_self), v));
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+    }
+#line 774 "./src/pmc/imageiofreeze.c"
+}
+static  void 
+Parrot_ImageIOFreeze_set_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *p)
+{
+#line 862 "./src/pmc/imageiofreeze.pmc"
+
+    if (PARROT_IMAGEIOFREEZE(_self)->handle) {
+        stream_start(interp, _self);
+    }
+    else if (PObj_flag_TEST(private1, _self)) {
+        create_buffer(interp, p, _self);
+        PARROT_IMAGEIOFREEZE(_self)->pf = PARROT_IMAGEIOFREEZE(_self)->pf_ct->base.pf;
+    }
+    else {
+        const UINTVAL header_length =
+            GROW_TO_16_BYTE_BOUNDARY(PACKFILE_HEADER_BYTES);
+
+        create_buffer(interp, p, _self);
+        PARROT_IMAGEIOFREEZE(_self)->pf = PackFile_new(interp, 0);
+        PObj_custom_destroy_SET(_self);
+
+        ensure_buffer_size(interp, _self, header_length);
+        memcpy(GET_VISIT_CURSOR(_self),
+            PARROT_IMAGEIOFREEZE(_self)->pf->header, PACKFILE_HEADER_BYTES);
+        INC_VISIT_CURSOR(_self, header_length);
+    }
+
+    Parrot_ImageIOFreeze_push_pmc(interp, _self, p);
+
+    {
+        /* walk the todo list by index: shifting it would move the whole
+         * remaining queue for every PMC frozen */
+        PMC * const todo = PARROT_IMAGEIOFREEZE(_self)->todo;
+        INTVAL i;
+        for (i = 0; i < VTABLE_elements(interp, todo); ++i) {
+            PMC * const current = VTABLE_get_pmc_keyed_int(interp, todo, i);
+            VTABLE_freeze(interp, current, _self);
+            VTABLE_visit(interp,  current, _self);
+            VTABLE_push_pmc(interp, _self, PMC_metadata(current));
+        }
+    }
+
+    if (PARROT_IMAGEIOFREEZE(_self)->handle) {
+        /* flush the last frame and terminate with an empty one */
+        stream_flush(interp, _self);
+        stream_write(interp, _self, "", 1);
+    }
+#line 822 "./src/pmc/imageiofreeze.c"
+}
+static  void 
+Parrot_ImageIOFreeze_set_pointer(PARROT_INTERP, ARGMOD(PMC *_self), void *value)
+{
+#line 844 "./src/pmc/imageiofreeze.pmc"
+
+    PObj_flag_SET(private1, _self);
+    PARROT_IMAGEIOFREEZE(_self)->pf_ct = (PackFile_ConstTable *)value;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 832 "./src/pmc/imageiofreeze.c"
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_ImageIOFreeze_update_vtable(VTABLE *vt) {
+    vt->destroy = Parrot_ImageIOFreeze_destroy;
+    vt->get_integer = Parrot_ImageIOFreeze_get_integer;
+    vt->get_pointer = Parrot_ImageIOFreeze_get_pointer;
+    vt->get_string = Parrot_ImageIOFreeze_get_string;
+    vt->init = Parrot_ImageIOFreeze_init;
+    vt->mark = Parrot_ImageIOFreeze_mark;
+    vt->push_float = Parrot_ImageIOFreeze_push_float;
+    vt->push_integer = Parrot_ImageIOFreeze_push_integer;
+    vt->push_pmc = Parrot_ImageIOFreeze_push_pmc;
+    vt->push_string = Parrot_ImageIOFreeze_push_string;
+    vt->set_pmc = Parrot_ImageIOFreeze_set_pmc;
+    vt->set_pointer = Parrot_ImageIOFreeze_set_pointer;
+    vt->attr_size = sizeof(Parrot_ImageIOFreeze_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_ImageIOFreeze_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->destroy = Parrot_ImageIOFreeze_destroy;
+    vt->get_integer = Parrot_ImageIOFreeze_get_integer;
+    vt->get_pointer = Parrot_ImageIOFreeze_get_pointer;
+    vt->get_string = Parrot_ImageIOFreeze_get_string;
+    vt->mark = Parrot_ImageIOFreeze_mark;
+    vt->attr_size = sizeof(Parrot_ImageIOFreeze_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_ImageIOFreeze_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_ImageIOFreeze_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_ImageIOFreeze_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_ImageIOFreeze_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_ImageIOFreeze_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "ImageIOFreeze"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_ImageIOFreeze_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "ImageIOFreeze")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_ImageIOFreeze_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        ":buffer :pos Fseen Ftodo :id :pf :pf_ct Fhandle Istream_flags :chunk :chunk_pos ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_ImageIOFreeze_get_vtable(interp);
+        vt->base_type      = enum_class_ImageIOFreeze;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "ImageIOFreeze");
+        vt->provides_str = CONST_STRING_GEN(interp, "scalar");
+        vt->isa_hash     = Parrot_ImageIOFreeze_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_ImageIOFreeze_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_ImageIOFreeze;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_ImageIOFreeze_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+        }
+    } /* pass */
+} /* Parrot_ImageIOFreeze_class_init */
+
+#line 904 "./src/pmc/imageiofreeze.pmc"
+
+
+
+/*
+
+=back
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -0,0 +1,414 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/imageiosize.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_imageiosize.h"
+#include "pmc_default.h"
+#include "imageiosize.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/imageiosize.pmc"
+/*
+Copyright (C) 2010-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/imageiosize.pmc - ImageIOSize PMC
+
+=head1 DESCRIPTION
+
+Gets the size of an ImageIO image without the allocation costs.
+Part of the internal serializer.
+
+=head1 STATIC FUNCTIONS
+
+=over 4
+
+=cut
+
+*/
+
+#define GROW_TO_16_BYTE_BOUNDARY(size) ((size) + ((size) % 16 ? 16 - (size) % 16 : 0))
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+PARROT_INLINE
+static int check_seen(PARROT_INTERP,
+    ARGIN(const PMC *self),
+    ARGIN(const PMC *v))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+#define ASSERT_ARGS_check_seen __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(v))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+/*
+
+=item C<static int check_seen(PARROT_INTERP, const PMC *self, const PMC *v)>
+
+Check the seen hash to prevent duplicate serialization.
+
+=cut
+
+*/
+
+
+PARROT_INLINE
+static int
+check_seen(PARROT_INTERP, ARGIN(const PMC *self), ARGIN(const PMC *v))
+{
+    ASSERT_ARGS(check_seen)
+    const Hash * const seen =
+        (Hash *)VTABLE_get_pointer(interp, PARROT_IMAGEIOSIZE(self)->seen);
+    const HashBucket * const b    = Parrot_hash_get_bucket(interp, seen, v);
+    if (b)
+        return 1;
+    else
+        return 0;
+}
+#line 88 "./src/pmc/imageiosize.c"
+static  INTVAL  Parrot_ImageIOSize_get_integer(SHIM_INTERP, SHIM(PMC *_self));
+static  PMC  * Parrot_ImageIOSize_get_pmc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  * Parrot_ImageIOSize_get_pointer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_ImageIOSize_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_ImageIOSize_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *pf_ct);
+static  void  Parrot_ImageIOSize_mark(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_ImageIOSize_push_float(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(FLOATVAL v));
+static  void  Parrot_ImageIOSize_push_integer(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL v));
+static  void  Parrot_ImageIOSize_push_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *v);
+static  void  Parrot_ImageIOSize_push_string(PARROT_INTERP, ARGMOD(PMC *_self), STRING *v);
+static  void  Parrot_ImageIOSize_set_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *p);
+void    Parrot_ImageIOSize_class_init(PARROT_INTERP, int, int);
+void    Parrot_ImageIOSize_ro_class_init(PARROT_INTERP, int, int);
+static  INTVAL 
+Parrot_ImageIOSize_get_integer(SHIM_INTERP, SHIM(PMC *_self))
+{
+#line 173 "./src/pmc/imageiosize.pmc"
+    return VISIT_FREEZE_NORMAL;
+#line 107 "./src/pmc/imageiosize.c"
+}
+static  PMC  *
+Parrot_ImageIOSize_get_pmc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 157 "./src/pmc/imageiosize.pmc"
+
+    PMC * const ret = Parrot_pmc_new_init_int(interp, enum_class_Integer,
+            PARROT_IMAGEIOSIZE(_self)->size);
+    return ret;
+#line 117 "./src/pmc/imageiosize.c"
+}
+static  void  *
+Parrot_ImageIOSize_get_pointer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 294 "./src/pmc/imageiosize.pmc"
+
+    return VTABLE_get_pointer(interp, PARROT_IMAGEIOSIZE(_self)->seen);
+#line 125 "./src/pmc/imageiosize.c"
+}
+static  void 
+Parrot_ImageIOSize_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 94 "./src/pmc/imageiosize.pmc"
+
+    PARROT_IMAGEIOSIZE(_self)->todo  = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+    PARROT_IMAGEIOSIZE(_self)->pf_ct = NULL;
+    PARROT_IMAGEIOSIZE(_self)->size  = 0;
+
+    PARROT_IMAGEIOSIZE(_self)->seen = Parrot_pmc_new(interp, enum_class_Hash);
+    VTABLE_set_pointer(interp, PARROT_IMAGEIOSIZE(_self)->seen,
+        Parrot_hash_new_intval_hash(interp));
+
+    PObj_flag_CLEAR(private1, _self);
+
+    PObj_custom_mark_SET(_self);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 144 "./src/pmc/imageiosize.c"
+}
+static  void 
+Parrot_ImageIOSize_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *pf_ct)
+{
+#line 117 "./src/pmc/imageiosize.pmc"
+
+    PARROT_IMAGEIOSIZE(_self)->todo  = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+    PARROT_IMAGEIOSIZE(_self)->pf_ct =
+        (PackFile_ConstTable *)VTABLE_get_pointer(interp, pf_ct);
+    PARROT_IMAGEIOSIZE(_self)->size  = 0;
+
+    PARROT_IMAGEIOSIZE(_self)->seen = Parrot_pmc_new(interp, enum_class_Hash);
+    VTABLE_set_pointer(interp, PARROT_IMAGEIOSIZE(_self)->seen,
+        Parrot_hash_new_intval_hash(interp));
+
+    PObj_flag_SET(private1, _self);
+
+    PObj_custom_mark_SET(_self);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 164 "./src/pmc/imageiosize.c"
+}
+static  void 
+Parrot_ImageIOSize_mark(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 142 "./src/pmc/imageiosize.pmc"
+
+    Parrot_gc_mark_PMC_alive(interp, PARROT_IMAGEIOSIZE(_self)->todo);
+    Parrot_gc_mark_PMC_alive(interp, PARROT_IMAGEIOSIZE(_self)->seen);
+#line 173 "./src/pmc/imageiosize.c"
+}
+static  void 
+Parrot_ImageIOSize_push_float(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(FLOATVAL v))
+{
+#line 210 "./src/pmc/imageiosize.pmc"
+
+    const size_t len = PF_size_number() * sizeof (opcode_t);
+    PARROT_IMAGEIOSIZE(_self)->size += len;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 183 "./src/pmc/imageiosize.c"
+}
+static  void 
+Parrot_ImageIOSize_push_integer(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL v))
+{
+#line 191 "./src/pmc/imageiosize.pmc"
+
+    const size_t len = PF_size_integer() * sizeof (opcode_t);
+    PARROT_IMAGEIOSIZE(_self)->size += len;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 193 "./src/pmc/imageiosize.c"
+}
+static  void 
+Parrot_ImageIOSize_push_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *v)
+{
+#line 267 "./src/pmc/imageiosize.pmc"
+
+    if (PMC_IS_NULL(v)
+    ||  check_seen(interp, _self, v))
+        VTABLE_push_integer(interp, _self, 0);
+    else {
+        INTVAL cno, idx;
+        PackFile_ConstTable * const ct   = PARROT_IMAGEIOSIZE(_self)->pf_ct;
+        Hash                * const seen = (Hash *)VTABLE_get_pointer(interp,
+                                                PARROT_IMAGEIOSIZE(_self)->seen);
+
+        if (PObj_flag_TEST(private1, _self)
+        &&  PackFile_ConstTable_rlookup_pmc(interp, ct, v, &cno, &idx)) {
+            VTABLE_push_integer(interp, _self, 0);
+            VTABLE_push_integer(interp, _self, cno);
+            VTABLE_push_integer(interp, _self, idx);
+        }
+        else {
+            VTABLE_push_integer(interp, _self, 0);
+            VTABLE_push_integer(interp, _self, v->vtable->base_type);
+            VTABLE_push_pmc(interp, PARROT_IMAGEIOSIZE(_self)->todo, v);
+            PARROT_GC_WRITE_BARRIER(interp, _self);
+        }
+
+        Parrot_hash_put(interp, seen, v, v);
+    }
+#line 224 "./src/pmc/imageiosize.c"
+}
+static  void 
+Parrot_ImageIOSize_push_string(PARROT_INTERP, ARGMOD(PMC *_self), STRING *v)
+{
+#line 227 "./src/pmc/imageiosize.pmc"
+
+    if (PObj_flag_TEST(private1, _self)) {
+        /* store a reference to constant table entry of string */
+        const PackFile_ConstTable * const table = PARROT_IMAGEIOSIZE(_self)->pf_ct;
+        const int idx = PackFile_ConstTable_rlookup_str(interp, table, v);
+
+        if (idx >= 0) {
+            Parrot_ImageIOSize_push_integer(interp, _self, idx);
+            return;
+        }
+
+        /* XXX
+         * handle cases where the PMC has changed after Parrot_freeze_strings was called
+         * eg: :immediate subs
+         */
+        Parrot_ImageIOSize_push_integer(interp, _self, -1);
+        /* TODO
+         * should really be:
+         * PANIC(interp, "string not previously in constant table when freezing to packfile");
+         */
+    }
+
+    {
+        const size_t len = PF_size_string(v) * sizeof (opcode_t);
+        PARROT_IMAGEIOSIZE(_self)->size += len;
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+    }
+#line 257 "./src/pmc/imageiosize.c"
+}
+static  void 
+Parrot_ImageIOSize_set_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *p)
+{
+#line 298 "./src/pmc/imageiosize.pmc"
+
+    if (!PObj_flag_TEST(private1, _self)) {
+        const UINTVAL header_length = GROW_TO_16_BYTE_BOUNDARY(PACKFILE_HEADER_BYTES);
+        PARROT_IMAGEIOSIZE(_self)->size += header_length;
+    }
+
+    Parrot_ImageIOSize_push_pmc(interp, _self, p);
+    {
+        PMC * const todo = PARROT_IMAGEIOSIZE(_self)->todo;
+        while (VTABLE_elements(interp, todo)) {
+            PMC * const current = VTABLE_shift_pmc(interp, todo);
+            VTABLE_freeze(interp, current, _self);
+            VTABLE_visit(interp,  current, _self);
+            VTABLE_push_pmc(interp, _self, PMC_metadata(current));
+        }
+    }
+#line 279 "./src/pmc/imageiosize.c"
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_ImageIOSize_update_vtable(VTABLE *vt) {
+    vt->get_integer = Parrot_ImageIOSize_get_integer;
+    vt->get_pmc = Parrot_ImageIOSize_get_pmc;
+    vt->get_pointer = Parrot_ImageIOSize_get_pointer;
+    vt->init = Parrot_ImageIOSize_init;
+    vt->init_pmc = Parrot_ImageIOSize_init_pmc;
+    vt->mark = Parrot_ImageIOSize_mark;
+    vt->push_float = Parrot_ImageIOSize_push_float;
+    vt->push_integer = Parrot_ImageIOSize_push_integer;
+    vt->push_pmc = Parrot_ImageIOSize_push_pmc;
+    vt->push_string = Parrot_ImageIOSize_push_string;
+    vt->set_pmc = Parrot_ImageIOSize_set_pmc;
+    vt->attr_size = sizeof(Parrot_ImageIOSize_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_ImageIOSize_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->get_integer = Parrot_ImageIOSize_get_integer;
+    vt->get_pmc = Parrot_ImageIOSize_get_pmc;
+    vt->get_pointer = Parrot_ImageIOSize_get_pointer;
+    vt->mark = Parrot_ImageIOSize_mark;
+    vt->attr_size = sizeof(Parrot_ImageIOSize_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_ImageIOSize_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_ImageIOSize_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_ImageIOSize_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_ImageIOSize_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_ImageIOSize_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "ImageIOSize"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_ImageIOSize_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "ImageIOSize")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_ImageIOSize_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "Fseen Ftodo :pf_ct Isize ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_ImageIOSize_get_vtable(interp);
+        vt->base_type      = enum_class_ImageIOSize;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "ImageIOSize");
+        vt->provides_str = CONST_STRING_GEN(interp, "scalar");
+        vt->isa_hash     = Parrot_ImageIOSize_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_ImageIOSize_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_ImageIOSize;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_ImageIOSize_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+        }
+    } /* pass */
+} /* Parrot_ImageIOSize_class_init */
+
+#line 323 "./src/pmc/imageiosize.pmc"
+
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -0,0 +1,286 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/imageiostrings.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_imageiostrings.h"
+#include "pmc_default.h"
+#include "imageiostrings.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/imageiostrings.pmc"
+/*
+Copyright (C) 2010-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/imageiostrings.pmc - ImageIOStrings PMC
+
+=head1 DESCRIPTION
+
+Get a list of strings in an object graph. Used in packfile creation.
+
+=cut
+
+*/
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+#line 41 "./src/pmc/imageiostrings.c"
+static  INTVAL  Parrot_ImageIOStrings_get_integer(SHIM_INTERP, SHIM(PMC *_self));
+static  PMC  * Parrot_ImageIOStrings_get_pmc(SHIM_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_ImageIOStrings_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_ImageIOStrings_mark(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_ImageIOStrings_push_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL v);
+static  void  Parrot_ImageIOStrings_push_integer(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL v);
+static  void  Parrot_ImageIOStrings_push_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *v);
+static  void  Parrot_ImageIOStrings_push_string(PARROT_INTERP, ARGMOD(PMC *_self), STRING *v);
+static  void  Parrot_ImageIOStrings_set_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *p);
+void    Parrot_ImageIOStrings_class_init(PARROT_INTERP, int, int);
+void    Parrot_ImageIOStrings_ro_class_init(PARROT_INTERP, int, int);
+static  INTVAL 
+Parrot_ImageIOStrings_get_integer(SHIM_INTERP, SHIM(PMC *_self))
+{
+#line 96 "./src/pmc/imageiostrings.pmc"
+    return VISIT_FREEZE_NORMAL;
+#line 58 "./src/pmc/imageiostrings.c"
+}
+static  PMC  *
+Parrot_ImageIOStrings_get_pmc(SHIM_INTERP, ARGMOD(PMC *_self))
+{
+#line 81 "./src/pmc/imageiostrings.pmc"
+    return PARROT_IMAGEIOSTRINGS(_self)->list;
+#line 65 "./src/pmc/imageiostrings.c"
+}
+static  void 
+Parrot_ImageIOStrings_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 44 "./src/pmc/imageiostrings.pmc"
+
+    PARROT_IMAGEIOSTRINGS(_self)->todo = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+
+    PARROT_IMAGEIOSTRINGS(_self)->seen = Parrot_pmc_new(interp, enum_class_Hash);
+    VTABLE_set_pointer(interp, PARROT_IMAGEIOSTRINGS(_self)->seen,
+        Parrot_hash_new_intval_hash(interp));
+
+    PARROT_IMAGEIOSTRINGS(_self)->list = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+
+    PObj_custom_mark_SET(_self);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 82 "./src/pmc/imageiostrings.c"
+}
+static  void 
+Parrot_ImageIOStrings_mark(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 65 "./src/pmc/imageiostrings.pmc"
+
+    Parrot_gc_mark_PMC_alive(interp, PARROT_IMAGEIOSTRINGS(_self)->todo);
+    Parrot_gc_mark_PMC_alive(interp, PARROT_IMAGEIOSTRINGS(_self)->seen);
+    Parrot_gc_mark_PMC_alive(interp, PARROT_IMAGEIOSTRINGS(_self)->list);
+#line 92 "./src/pmc/imageiostrings.c"
+}
+static  void 
+Parrot_ImageIOStrings_push_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL v)
+{
+#line 130 "./src/pmc/imageiostrings.pmc"
+
+    /**/UNUSED(interp)
+    /**/UNUSED(_self)
+    UNUSED(v)
+#line 102 "./src/pmc/imageiostrings.c"
+}
+static  void 
+Parrot_ImageIOStrings_push_integer(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL v)
+{
+#line 113 "./src/pmc/imageiostrings.pmc"
+
+    /**/UNUSED(interp)
+    /**/UNUSED(_self)
+    UNUSED(v)
+#line 112 "./src/pmc/imageiostrings.c"
+}
+static  void 
+Parrot_ImageIOStrings_push_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *v)
+{
+#line 161 "./src/pmc/imageiostrings.pmc"
+
+    if (!PMC_IS_NULL(v)) {
+        Hash * const hash    = (Hash *)VTABLE_get_pointer(interp,
+                                            PARROT_IMAGEIOSTRINGS(_self)->seen);
+        HashBucket * const b = Parrot_hash_get_bucket(interp, hash, v);
+        if (!b) {
+            /* not yet seen */
+            Parrot_hash_put(interp, hash, v, v);
+            VTABLE_push_pmc(interp, PARROT_IMAGEIOSTRINGS(_self)->todo, v);
+        }
+        else
+            PARROT_GC_WRITE_BARRIER(interp, _self);
+    }
+#line 131 "./src/pmc/imageiostrings.c"
+}
+static  void 
+Parrot_ImageIOStrings_push_string(PARROT_INTERP, ARGMOD(PMC *_self), STRING *v)
+{
+#line 147 "./src/pmc/imageiostrings.pmc"
+
+    VTABLE_push_string(interp, PARROT_IMAGEIOSTRINGS(_self)->list, v);
+#line 139 "./src/pmc/imageiostrings.c"
+}
+static  void 
+Parrot_ImageIOStrings_set_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *p)
+{
+#line 176 "./src/pmc/imageiostrings.pmc"
+
+    PMC * const todo = PARROT_IMAGEIOSTRINGS(_self)->todo;
+    Parrot_ImageIOStrings_push_pmc(interp, _self, p);
+    while (VTABLE_elements(interp, todo)) {
+        PMC * const current = VTABLE_shift_pmc(interp, todo);
+        VTABLE_freeze(interp, current, _self);
+        VTABLE_visit(interp,  current, _self);
+        VTABLE_push_pmc(interp, _self, PMC_metadata(current));
+    }
+#line 154 "./src/pmc/imageiostrings.c"
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_ImageIOStrings_update_vtable(VTABLE *vt) {
+    vt->get_integer = Parrot_ImageIOStrings_get_integer;
+    vt->get_pmc = Parrot_ImageIOStrings_get_pmc;
+    vt->init = Parrot_ImageIOStrings_init;
+    vt->mark = Parrot_ImageIOStrings_mark;
+    vt->push_float = Parrot_ImageIOStrings_push_float;
+    vt->push_integer = Parrot_ImageIOStrings_push_integer;
+    vt->push_pmc = Parrot_ImageIOStrings_push_pmc;
+    vt->push_string = Parrot_ImageIOStrings_push_string;
+    vt->set_pmc = Parrot_ImageIOStrings_set_pmc;
+    vt->attr_size = sizeof(Parrot_ImageIOStrings_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_ImageIOStrings_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->get_integer = Parrot_ImageIOStrings_get_integer;
+    vt->get_pmc = Parrot_ImageIOStrings_get_pmc;
+    vt->mark = Parrot_ImageIOStrings_mark;
+    vt->attr_size = sizeof(Parrot_ImageIOStrings_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_ImageIOStrings_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_ImageIOStrings_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_ImageIOStrings_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_ImageIOStrings_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_ImageIOStrings_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "ImageIOStrings"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_ImageIOStrings_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "ImageIOStrings")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_ImageIOStrings_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "Fseen Ftodo Flist ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_ImageIOStrings_get_vtable(interp);
+        vt->base_type      = enum_class_ImageIOStrings;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "ImageIOStrings");
+        vt->provides_str = CONST_STRING_GEN(interp, "scalar");
+        vt->isa_hash     = Parrot_ImageIOStrings_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_ImageIOStrings_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_ImageIOStrings;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_ImageIOStrings_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+        }
+    } /* pass */
+} /* Parrot_ImageIOStrings_class_init */
+
+#line 194 "./src/pmc/imageiostrings.pmc"
+
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
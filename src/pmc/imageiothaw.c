@@ -0,0 +1,957 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/imageiothaw.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_imageiothaw.h"
+#include "pmc_default.h"
+#include "imageiothaw.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/imageiothaw.pmc"
+/*
+Copyright (C) 2010-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/imageiothaw.pmc - ImageIOThaw PMC
+
+=head1 DESCRIPTION
+
+Thaws PMCs from packfile images.
+
+=head1 VTABLES
+
+=over 4
+
+=cut
+
+*/
+
+#include "parrot/imageio.h"
+
+#define BYTECODE_SHIFT_OK(interp, pmc) PARROT_ASSERT( \
+    PARROT_IMAGEIOTHAW(pmc)->curs <= (opcode_t *) \
+    (PARROT_IMAGEIOTHAW(pmc)->img->strstart + \
+    Parrot_str_byte_length((interp), PARROT_IMAGEIOTHAW(pmc)->img)))
+
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+PARROT_INLINE
+static size_t stream_item(PARROT_INTERP, ARGMOD(PMC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*self);
+
+static void stream_read(PARROT_INTERP,
+    ARGIN(PMC *self),
+    ARGOUT(void *buffer),
+    size_t len)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*buffer);
+
+static UINTVAL stream_read_frame_length(PARROT_INTERP, ARGIN(PMC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_CANNOT_RETURN_NULL
+static PMC * stream_shift_pmc(PARROT_INTERP, ARGMOD(PMC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*self);
+
+PARROT_CANNOT_RETURN_NULL
+static STRING * stream_shift_string(PARROT_INTERP, ARGMOD(PMC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*self);
+
+PARROT_INLINE
+static UINTVAL stream_shift_varint(PARROT_INTERP, ARGMOD(PMC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*self);
+
+static void stream_start(PARROT_INTERP, ARGMOD(PMC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*self);
+
+static void thawfinish_todo(PARROT_INTERP, ARGIN(PMC *self), INTVAL n)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static INTVAL visit_todo(PARROT_INTERP, ARGMOD(PMC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*self);
+
+#define ASSERT_ARGS_stream_item __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_stream_read __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(buffer))
+#define ASSERT_ARGS_stream_read_frame_length __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_stream_shift_pmc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_stream_shift_string __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_stream_shift_varint __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_stream_start __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_thawfinish_todo __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_visit_todo __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+/*
+
+=item C<static void stream_read(PARROT_INTERP, PMC *self, void *buffer, size_t
+len)>
+
+Reads exactly C<len> bytes of a streaming image from the handle, throwing if
+the stream ends early.
+
+=cut
+
+*/
+
+static void
+stream_read(PARROT_INTERP, ARGIN(PMC *self), ARGOUT(void *buffer), size_t len)
+{
+    ASSERT_ARGS(stream_read)
+
+    if (Parrot_io_read_b(interp, PARROT_IMAGEIOTHAW(self)->handle,
+            (char *)buffer, len) != len)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_MALFORMED_PACKFILE,
+                "Unexpected end of frozen stream");
+}
+
+/*
+
+=item C<static UINTVAL stream_read_frame_length(PARROT_INTERP, PMC *self)>
+
+Reads the varint length of the next frame directly from the handle.
+
+=cut
+
+*/
+
+static UINTVAL
+stream_read_frame_length(PARROT_INTERP, ARGIN(PMC *self))
+{
+    ASSERT_ARGS(stream_read_frame_length)
+    UINTVAL      len   = 0;
+    unsigned int shift = 0;
+    unsigned char byte;
+
+    do {
+        if (shift >= sizeof (UINTVAL) * 8)
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_MALFORMED_PACKFILE,
+                    "Malformed frame length in frozen stream");
+        stream_read(interp, self, &byte, 1);
+        len   |= (UINTVAL)(byte & 0x7f) << shift;
+        shift += 7;
+    } while (byte & 0x80);
+
+    return len;
+}
+
+/*
+
+=item C<static size_t stream_item(PARROT_INTERP, PMC *self)>
+
+Prepares to read the next item of a streaming image: if the current frame is
+used up, the next one is read from the handle. Returns the number of bytes
+left in the frame, which always hold the whole item. A frame that claims
+more bytes than the stream holds throws before the buffer grows much beyond
+what was actually read.
+
+=cut
+
+*/
+
+PARROT_INLINE
+static size_t
+stream_item(PARROT_INTERP, ARGMOD(PMC *self))
+{
+    ASSERT_ARGS(stream_item)
+    Parrot_ImageIOThaw_attributes * const attrs = PARROT_IMAGEIOTHAW(self);
+
+    if (attrs->chunk_pos == attrs->chunk_len) {
+        const UINTVAL len = stream_read_frame_length(interp, self);
+
+        if (!len)
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_MALFORMED_PACKFILE,
+                    "Unexpected end of frozen stream");
+
+        if (len <= attrs->chunk_size)
+            stream_read(interp, self, attrs->chunk, len);
+        else {
+            /* Only frames holding a single long string exceed the default
+             * size. Their length comes straight from the stream, so the
+             * buffer grows only as the bytes actually arrive: a corrupt
+             * length hits the end of the stream long before it could
+             * allocate anything near its claimed size. */
+            size_t have = 0;
+
+            while (have < len) {
+                if (have == attrs->chunk_size) {
+                    const size_t grow = len - have < attrs->chunk_size
+                                      ? len - have : attrs->chunk_size;
+                    attrs->chunk       = mem_gc_realloc_n_typed(interp, attrs->chunk,
+                                            attrs->chunk_size + grow, unsigned char);
+                    attrs->chunk_size += grow;
+                }
+
+                stream_read(interp, self, attrs->chunk + have,
+                        attrs->chunk_size - have);
+                have = attrs->chunk_size;
+            }
+        }
+
+        attrs->chunk_pos = 0;
+        attrs->chunk_len = len;
+    }
+
+    return attrs->chunk_len - attrs->chunk_pos;
+}
+
+/*
+
+=item C<static UINTVAL stream_shift_varint(PARROT_INTERP, PMC *self)>
+
+Retrieves the next varint from a streaming image.
+
+=cut
+
+*/
+
+PARROT_INLINE
+static UINTVAL
+stream_shift_varint(PARROT_INTERP, ARGMOD(PMC *self))
+{
+    ASSERT_ARGS(stream_shift_varint)
+    Parrot_ImageIOThaw_attributes * const attrs = PARROT_IMAGEIOTHAW(self);
+    const size_t         avail = stream_item(interp, self);
+    const unsigned char *cursor = attrs->chunk + attrs->chunk_pos;
+    const unsigned char * const end = cursor + avail;
+    UINTVAL              v     = 0;
+    unsigned int         shift = 0;
+
+    while (cursor < end && shift < sizeof (UINTVAL) * 8) {
+        const unsigned char byte = *cursor++;
+        v |= (UINTVAL)(byte & 0x7f) << shift;
+        if (!(byte & 0x80)) {
+            attrs->chunk_pos = cursor - attrs->chunk;
+            return v;
+        }
+        shift += 7;
+    }
+
+    Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_MALFORMED_PACKFILE,
+            "Malformed varint in frozen stream");
+
+    return 0;
+}
+
+/*
+
+=item C<static STRING * stream_shift_string(PARROT_INTERP, PMC *self)>
+
+Retrieves the next string from a streaming image.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+static STRING *
+stream_shift_string(PARROT_INTERP, ARGMOD(PMC *self))
+{
+    ASSERT_ARGS(stream_shift_string)
+    Parrot_ImageIOThaw_attributes * const attrs = PARROT_IMAGEIOTHAW(self);
+    const STR_VTABLE *encoding;
+    UINTVAL           tag   = stream_shift_varint(interp, self);
+    UINTVAL           flags;
+    UINTVAL           len;
+
+    if (!tag)
+        return STRINGNULL;
+
+    --tag;
+    flags    = (tag & 0x1 ? PObj_constant_FLAG : 0)
+             | (tag & 0x2 ? PObj_private7_FLAG : 0);
+    encoding = Parrot_get_encoding(interp, tag >> 2);
+    if (!encoding)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_UNIMPLEMENTED,
+                "Invalid encoding number '%d' specified", (int)(tag >> 2));
+
+    len = stream_shift_varint(interp, self);
+    if (!len) {
+        if (encoding == CONST_STRING(interp, "")->encoding)
+            return CONST_STRING(interp, "");
+        return Parrot_str_new_init(interp, NULL, 0, encoding, flags);
+    }
+
+    if (stream_item(interp, self) < len)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_MALFORMED_PACKFILE,
+                "Truncated string in frozen stream");
+
+    attrs->chunk_pos += len;
+    return Parrot_str_new_init(interp,
+            (const char *)attrs->chunk + attrs->chunk_pos - len, len, encoding, flags);
+}
+
+/*
+
+=item C<static PMC * stream_shift_pmc(PARROT_INTERP, PMC *self)>
+
+Retrieves the next PMC reference from a streaming image. A new PMC is
+created empty and queued on the todo list; its contents follow later. In tree
+mode references to earlier PMCs are rejected, but every PMC is still queued:
+the list is what pairs each PMC with its contents and what C<thawfinish> runs
+over at the end.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+static PMC *
+stream_shift_pmc(PARROT_INTERP, ARGMOD(PMC *self))
+{
+    ASSERT_ARGS(stream_shift_pmc)
+    PMC * const   seen = PARROT_IMAGEIOTHAW(self)->seen;
+    const UINTVAL tag  = stream_shift_varint(interp, self);
+
+    if (!tag)
+        return PMCNULL;
+
+    if (tag & 1) {
+        const UINTVAL id = tag >> 1;
+
+        if (PARROT_IMAGEIOTHAW(self)->stream_flags & FREEZE_STREAM_TREE
+        ||  id == 0 || id > (UINTVAL)VTABLE_elements(interp, seen))
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_MALFORMED_PACKFILE,
+                    "Invalid PMC reference %d in frozen stream", (int)id);
+
+        return VTABLE_get_pmc_keyed_int(interp, seen, id - 1);
+    }
+    else {
+        const INTVAL type = (INTVAL)(tag >> 1);
+        const INTVAL idx  = VTABLE_elements(interp, seen);
+        PMC         *pmc;
+
+        if (type <= 0 || type > interp->n_vtable_max)
+            Parrot_ex_throw_from_c_args(interp, NULL, 1,
+                    "Unknown PMC type to thaw %d", type);
+
+        pmc = Parrot_pmc_new_noinit(interp, type);
+        VTABLE_push_pmc(interp, seen, pmc);
+        VTABLE_push_integer(interp, PARROT_IMAGEIOTHAW(self)->todo, idx);
+        return pmc;
+    }
+}
+
+/*
+
+=item C<static void stream_start(PARROT_INTERP, PMC *self)>
+
+Reads and checks the header of a streaming image and allocates the frame
+buffer.
+
+=cut
+
+*/
+
+static void
+stream_start(PARROT_INTERP, ARGMOD(PMC *self))
+{
+    ASSERT_ARGS(stream_start)
+    Parrot_ImageIOThaw_attributes * const attrs = PARROT_IMAGEIOTHAW(self);
+    unsigned char header[FREEZE_STREAM_HEADER_BYTES];
+
+    stream_read(interp, self, header, FREEZE_STREAM_HEADER_BYTES);
+
+    if (memcmp(header, FREEZE_STREAM_MAGIC, 4) != 0)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_MALFORMED_PACKFILE,
+                "Not a frozen stream");
+    if (header[4] != FREEZE_STREAM_VERSION)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_MALFORMED_PACKFILE,
+                "Unsupported frozen stream version %d", (int)header[4]);
+    if (header[6] != sizeof (FLOATVAL) || header[7] != PARROT_BIGENDIAN)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_MALFORMED_PACKFILE,
+                "Frozen stream was written on an incompatible platform");
+
+    attrs->stream_flags = header[5];
+    attrs->chunk        = mem_gc_allocate_n_typed(interp,
+                                FREEZE_STREAM_FRAME_SIZE, unsigned char);
+    attrs->chunk_size   = FREEZE_STREAM_FRAME_SIZE;
+    attrs->chunk_pos    = 0;
+    attrs->chunk_len    = 0;
+    PObj_custom_destroy_SET(self);
+}
+
+/*
+
+=item C<static INTVAL visit_todo(PARROT_INTERP, PMC *self)>
+
+Thaws the contents of every PMC on the todo list, which grows as the
+contents refer to new PMCs. Returns the number of PMCs thawed.
+
+=cut
+
+*/
+
+static INTVAL
+visit_todo(PARROT_INTERP, ARGMOD(PMC *self))
+{
+    ASSERT_ARGS(visit_todo)
+    PMC * const seen = PARROT_IMAGEIOTHAW(self)->seen;
+    PMC * const todo = PARROT_IMAGEIOTHAW(self)->todo;
+    INTVAL i;
+
+    for (i = 0; i < VTABLE_elements(interp, todo); i++) {
+        const INTVAL idx = VTABLE_get_integer_keyed_int(interp, todo, i);
+        PMC * const current = VTABLE_get_pmc_keyed_int(interp, seen, idx);
+        if (PMC_IS_NULL(current))
+            Parrot_ex_throw_from_c_args(interp, NULL,
+                    EXCEPTION_MALFORMED_PACKFILE,
+                    "NULL current PMC at %d in thaw",
+                    (int)i);
+
+        VTABLE_thaw(interp,  current, self);
+        VTABLE_visit(interp, current, self);
+        PMC_metadata(current) = VTABLE_shift_pmc(interp, self);
+    }
+
+    return i;
+}
+
+/*
+
+=item C<static void thawfinish_todo(PARROT_INTERP, PMC *self, INTVAL n)>
+
+Calls C<thawfinish> on the first C<n> PMCs of the todo list.
+
+=cut
+
+*/
+
+static void
+thawfinish_todo(PARROT_INTERP, ARGIN(PMC *self), INTVAL n)
+{
+    ASSERT_ARGS(thawfinish_todo)
+    PMC * const seen = PARROT_IMAGEIOTHAW(self)->seen;
+    PMC * const todo = PARROT_IMAGEIOTHAW(self)->todo;
+    INTVAL i;
+
+    for (i = 0; i < n; i++) {
+        const INTVAL idx = VTABLE_get_integer_keyed_int(interp, todo, i);
+        PMC * const current = VTABLE_get_pmc_keyed_int(interp, seen, idx);
+        VTABLE_thawfinish(interp, current, self);
+    }
+}
+#line 485 "./src/pmc/imageiothaw.c"
+static  void  Parrot_ImageIOThaw_destroy(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_ImageIOThaw_get_integer(SHIM_INTERP, SHIM(PMC *_self));
+static  PMC  * Parrot_ImageIOThaw_get_pmc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_ImageIOThaw_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_ImageIOThaw_mark(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_ImageIOThaw_set_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *handle);
+static  void  Parrot_ImageIOThaw_set_pointer(PARROT_INTERP, ARGMOD(PMC *_self), void *value);
+static  void  Parrot_ImageIOThaw_set_string_native(PARROT_INTERP, ARGMOD(PMC *_self), STRING *image);
+static  FLOATVAL  Parrot_ImageIOThaw_shift_float(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_ImageIOThaw_shift_integer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC  * Parrot_ImageIOThaw_shift_pmc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING  * Parrot_ImageIOThaw_shift_string(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_ImageIOThaw_class_init(PARROT_INTERP, int, int);
+void    Parrot_ImageIOThaw_ro_class_init(PARROT_INTERP, int, int);
+static  void 
+Parrot_ImageIOThaw_destroy(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 510 "./src/pmc/imageiothaw.pmc"
+
+    /* streaming images have no PackFile */
+    if (PARROT_IMAGEIOTHAW(_self)->pf) {
+        PackFile_destroy(interp, PARROT_IMAGEIOTHAW(_self)->pf);
+        PARROT_IMAGEIOTHAW(_self)->pf = NULL;
+    }
+    if (PARROT_IMAGEIOTHAW(_self)->chunk) {
+        mem_gc_free(interp, PARROT_IMAGEIOTHAW(_self)->chunk);
+        PARROT_IMAGEIOTHAW(_self)->chunk = NULL;
+    }
+#line 514 "./src/pmc/imageiothaw.c"
+}
+static  INTVAL 
+Parrot_ImageIOThaw_get_integer(SHIM_INTERP, SHIM(PMC *_self))
+{
+#line 660 "./src/pmc/imageiothaw.pmc"
+    return VISIT_THAW_NORMAL;
+#line 521 "./src/pmc/imageiothaw.c"
+}
+static  PMC  *
+Parrot_ImageIOThaw_get_pmc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 642 "./src/pmc/imageiothaw.pmc"
+
+    if (PObj_flag_TEST(private1, _self))
+        return PARROT_IMAGEIOTHAW(_self)->seen;
+    else
+        return VTABLE_get_pmc_keyed_int(interp, (PARROT_IMAGEIOTHAW(_self))->seen, 0);
+#line 532 "./src/pmc/imageiothaw.c"
+}
+static  void 
+Parrot_ImageIOThaw_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 488 "./src/pmc/imageiothaw.pmc"
+
+    PARROT_IMAGEIOTHAW(_self)->seen =
+        Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+    PARROT_IMAGEIOTHAW(_self)->todo =
+        Parrot_pmc_new(interp, enum_class_ResizableIntegerArray);
+
+    PObj_flag_CLEAR(private1, _self);
+
+    PObj_custom_mark_SET(_self);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 548 "./src/pmc/imageiothaw.c"
+}
+static  void 
+Parrot_ImageIOThaw_mark(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 533 "./src/pmc/imageiothaw.pmc"
+
+    Parrot_gc_mark_STRING_alive(interp, PARROT_IMAGEIOTHAW(_self)->img);
+    Parrot_gc_mark_PMC_alive(interp, PARROT_IMAGEIOTHAW(_self)->seen);
+    Parrot_gc_mark_PMC_alive(interp, PARROT_IMAGEIOTHAW(_self)->todo);
+    Parrot_gc_mark_PMC_alive(interp, PARROT_IMAGEIOTHAW(_self)->handle);
+#line 559 "./src/pmc/imageiothaw.c"
+}
+static  void 
+Parrot_ImageIOThaw_set_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *handle)
+{
+#line 611 "./src/pmc/imageiothaw.pmc"
+
+    PARROT_IMAGEIOTHAW(_self)->handle = handle;
+    stream_start(interp, _self);
+
+    Parrot_ImageIOThaw_shift_pmc(interp, _self);
+
+    {
+        const INTVAL n = visit_todo(interp, _self);
+
+        /* we're done reading the image: the last frame must be used up
+         * and followed by the empty terminating frame */
+        if (PARROT_IMAGEIOTHAW(_self)->chunk_pos != PARROT_IMAGEIOTHAW(_self)->chunk_len
+        ||  stream_read_frame_length(interp, _self) != 0)
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_MALFORMED_PACKFILE,
+                    "Trailing data in frozen stream");
+
+        thawfinish_todo(interp, _self, n);
+    }
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 584 "./src/pmc/imageiothaw.c"
+}
+static  void 
+Parrot_ImageIOThaw_set_pointer(PARROT_INTERP, ARGMOD(PMC *_self), void *value)
+{
+#line 677 "./src/pmc/imageiothaw.pmc"
+
+    PObj_flag_SET(private1, _self);
+    PARROT_IMAGEIOTHAW(_self)->pf_ct = (PackFile_ConstTable *)value;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 594 "./src/pmc/imageiothaw.c"
+}
+static  void 
+Parrot_ImageIOThaw_set_string_native(PARROT_INTERP, ARGMOD(PMC *_self), STRING *image)
+{
+#line 551 "./src/pmc/imageiothaw.pmc"
+
+    if (!PObj_external_TEST(image))
+        Parrot_str_pin(interp, image);
+
+    PARROT_IMAGEIOTHAW(_self)->img  = image;
+    PARROT_IMAGEIOTHAW(_self)->curs = (opcode_t *)image->strstart;
+
+    if (PObj_flag_TEST(private1, _self)) {
+        PARROT_IMAGEIOTHAW(_self)->pf = PARROT_IMAGEIOTHAW(_self)->pf_ct->base.pf;
+    }
+    else {
+        const UINTVAL header_length =
+             GROW_TO_16_BYTE_BOUNDARY(PACKFILE_HEADER_BYTES);
+        int unpacked_length;
+
+        PARROT_IMAGEIOTHAW(_self)->pf   = PackFile_new(interp, 0);
+        PObj_custom_destroy_SET(_self);
+
+        PARROT_IMAGEIOTHAW(_self)->pf->options |= PFOPT_PMC_FREEZE_ONLY;
+        unpacked_length = PackFile_unpack(interp, PARROT_IMAGEIOTHAW(_self)->pf,
+                            PARROT_IMAGEIOTHAW(_self)->curs,
+                            Parrot_str_byte_length(interp, image));
+
+        if (unpacked_length)
+            PARROT_IMAGEIOTHAW(_self)->curs += header_length / sizeof (opcode_t*);
+        else
+            Parrot_ex_throw_from_c_args(interp, NULL,
+                    EXCEPTION_INVALID_STRING_REPRESENTATION,
+                    "PackFile header failed during unpack");
+    }
+
+    Parrot_ImageIOThaw_shift_pmc(interp, _self);
+
+    {
+        const INTVAL n = visit_todo(interp, _self);
+
+        /* we're done reading the image */
+        PARROT_ASSERT(image->strstart + Parrot_str_byte_length(interp, image) ==
+                    (char *)PARROT_IMAGEIOTHAW(_self)->curs);
+
+        thawfinish_todo(interp, _self, n);
+    }
+
+    if (!PObj_external_TEST(image))
+        Parrot_str_unpin(interp, image);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 646 "./src/pmc/imageiothaw.c"
+}
+static  FLOATVAL 
+Parrot_ImageIOThaw_shift_float(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 723 "./src/pmc/imageiothaw.pmc"
+
+    if (PARROT_IMAGEIOTHAW(_self)->handle) {
+        FLOATVAL f;
+        if (stream_item(interp, _self) < sizeof (FLOATVAL))
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_MALFORMED_PACKFILE,
+                    "Truncated float in frozen stream");
+        memcpy(&f, PARROT_IMAGEIOTHAW(_self)->chunk + PARROT_IMAGEIOTHAW(_self)->chunk_pos,
+                sizeof (FLOATVAL));
+        PARROT_IMAGEIOTHAW(_self)->chunk_pos += sizeof (FLOATVAL);
+        #line 661 "./src/pmc/imageiothaw.c"
+    return (FLOATVAL)f;
+#line 732 "./src/pmc/imageiothaw.pmc"
+
+    }
+    else {
+        PackFile * const pf  = PARROT_IMAGEIOTHAW(_self)->pf;
+        const opcode_t *curs = PARROT_IMAGEIOTHAW(_self)->curs;
+        const FLOATVAL f     = PF_fetch_number(pf, &curs);
+        DECL_CONST_CAST;
+        PARROT_IMAGEIOTHAW(_self)->curs = PARROT_const_cast(opcode_t *, curs);
+        BYTECODE_SHIFT_OK(interp, _self);
+        #line 673 "./src/pmc/imageiothaw.c"
+    return (FLOATVAL)f;
+#line 741 "./src/pmc/imageiothaw.pmc"
+
+    }
+#line 678 "./src/pmc/imageiothaw.c"
+}
+static  INTVAL 
+Parrot_ImageIOThaw_shift_integer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 693 "./src/pmc/imageiothaw.pmc"
+
+    if (PARROT_IMAGEIOTHAW(_self)->handle) {
+        const UINTVAL u = stream_shift_varint(interp, _self);
+        const INTVAL  i = FREEZE_STREAM_UNZIGZAG(u);
+        #line 688 "./src/pmc/imageiothaw.c"
+    return (INTVAL)i;
+#line 697 "./src/pmc/imageiothaw.pmc"
+
+    }
+    else {
+        /* inlining PF_fetch_integer speeds up PBC thawing measurably */
+        PackFile * const pf = PARROT_IMAGEIOTHAW(_self)->pf;
+        const unsigned char *stream    = (const unsigned char *)PARROT_IMAGEIOTHAW(_self)->curs;
+        const INTVAL         i         = pf->fetch_iv(stream);
+        DECL_CONST_CAST;
+        PARROT_IMAGEIOTHAW(_self)->curs = (opcode_t *)PARROT_const_cast(unsigned char *,
+                                                                stream + pf->header->wordsize);
+        BYTECODE_SHIFT_OK(interp, _self);
+        #line 702 "./src/pmc/imageiothaw.c"
+    return (INTVAL)i;
+#line 708 "./src/pmc/imageiothaw.pmc"
+
+    }
+#line 707 "./src/pmc/imageiothaw.c"
+}
+static  PMC  *
+Parrot_ImageIOThaw_shift_pmc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 802 "./src/pmc/imageiothaw.pmc"
+
+    if (PARROT_IMAGEIOTHAW(_self)->handle) {
+        PMC * const pmc = stream_shift_pmc(interp, _self);
+        #line 716 "./src/pmc/imageiothaw.c"
+    return (PMC*)pmc;
+#line 805 "./src/pmc/imageiothaw.pmc"
+
+    }
+    else {
+        const UINTVAL  n            = VTABLE_shift_integer(interp, _self);
+        const INTVAL   id           = PackID_get_PMCID(n);
+        const int      packid_flags = PackID_get_FLAGS(n);
+
+        PMC           *pmc          = PMCNULL;
+        PMC           *seen         = PARROT_IMAGEIOTHAW(_self)->seen;
+        PMC           *todo         = PARROT_IMAGEIOTHAW(_self)->todo;
+
+        switch (packid_flags) {
+          case enum_PackID_seen:
+            if (id) /* got a non-NULL PMC */
+                pmc = VTABLE_get_pmc_keyed_int(interp, seen, id - 1);
+            break;
+          case enum_PackID_pbc_backref:
+            {
+                PackFile_ConstTable *table   = PARROT_IMAGEIOTHAW(_self)->pf_ct;
+                INTVAL               constno = VTABLE_shift_integer(interp, _self);
+                INTVAL               idx     = VTABLE_shift_integer(interp, _self);
+                PMC                 *olist   = table->pmc.constants[constno];
+                pmc                          = VTABLE_get_pmc_keyed_int(interp, olist, idx);
+                PARROT_ASSERT(id - 1 == VTABLE_elements(interp, seen));
+                VTABLE_set_pmc_keyed_int(interp, seen, id - 1, pmc);
+                break;
+            }
+          case enum_PackID_normal:
+            {
+                const INTVAL type = VTABLE_shift_integer(interp, _self);
+
+                PARROT_ASSERT(id - 1 == VTABLE_elements(interp, seen));
+
+                if (type <= 0 || type > interp->n_vtable_max)
+                    Parrot_ex_throw_from_c_args(interp, NULL, 1,
+                            "Unknown PMC type to thaw %d", type);
+
+                pmc = Parrot_pmc_new_noinit(interp, type);
+
+                VTABLE_set_pmc_keyed_int(interp, seen, id - 1, pmc);
+                VTABLE_push_integer(interp, todo, id - 1);
+            }
+            break;
+          default:
+            Parrot_ex_throw_from_c_args(interp, NULL, 1,
+                    "Unknown PMC id args thaw %d", packid_flags);
+            break;
+        }
+
+        #line 768 "./src/pmc/imageiothaw.c"
+    return (PMC*)pmc;
+#line 854 "./src/pmc/imageiothaw.pmc"
+
+    }
+#line 773 "./src/pmc/imageiothaw.c"
+}
+static  STRING  *
+Parrot_ImageIOThaw_shift_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 756 "./src/pmc/imageiothaw.pmc"
+
+    if (PARROT_IMAGEIOTHAW(_self)->handle) {
+        STRING * const s = stream_shift_string(interp, _self);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return s;
+    }
+
+    if (PObj_flag_TEST(private1, _self)) {
+        const INTVAL i = Parrot_ImageIOThaw_shift_integer(interp, _self);
+        BYTECODE_SHIFT_OK(interp, _self);
+
+        if (i >= 0) {
+            PackFile_ConstTable *table = PARROT_IMAGEIOTHAW(_self)->pf_ct;
+            PARROT_GC_WRITE_BARRIER(interp, _self);
+            return table->str.constants[i];
+        }
+
+        /* XXX
+         * only got here because constant table doesn't contain the string
+         * fallback on inline strings
+         */
+    }
+
+    {
+        PackFile * const pf = PARROT_IMAGEIOTHAW(_self)->pf;
+        const opcode_t *curs           = PARROT_IMAGEIOTHAW(_self)->curs;
+        STRING   *s                    = PF_fetch_string(interp, pf, &curs);
+        DECL_CONST_CAST;
+        PARROT_IMAGEIOTHAW(_self)->curs = PARROT_const_cast(opcode_t *, curs);
+        BYTECODE_SHIFT_OK(interp, _self);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return s;
+    }
+#line 812 "./src/pmc/imageiothaw.c"
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_ImageIOThaw_update_vtable(VTABLE *vt) {
+    vt->destroy = Parrot_ImageIOThaw_destroy;
+    vt->get_integer = Parrot_ImageIOThaw_get_integer;
+    vt->get_pmc = Parrot_ImageIOThaw_get_pmc;
+    vt->init = Parrot_ImageIOThaw_init;
+    vt->mark = Parrot_ImageIOThaw_mark;
+    vt->set_pmc = Parrot_ImageIOThaw_set_pmc;
+    vt->set_pointer = Parrot_ImageIOThaw_set_pointer;
+    vt->set_string_native = Parrot_ImageIOThaw_set_string_native;
+    vt->shift_float = Parrot_ImageIOThaw_shift_float;
+    vt->shift_integer = Parrot_ImageIOThaw_shift_integer;
+    vt->shift_pmc = Parrot_ImageIOThaw_shift_pmc;
+    vt->shift_string = Parrot_ImageIOThaw_shift_string;
+    vt->attr_size = sizeof(Parrot_ImageIOThaw_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_ImageIOThaw_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->destroy = Parrot_ImageIOThaw_destroy;
+    vt->get_integer = Parrot_ImageIOThaw_get_integer;
+    vt->get_pmc = Parrot_ImageIOThaw_get_pmc;
+    vt->mark = Parrot_ImageIOThaw_mark;
+    vt->attr_size = sizeof(Parrot_ImageIOThaw_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_ImageIOThaw_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_ImageIOThaw_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_ImageIOThaw_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_ImageIOThaw_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_ImageIOThaw_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "ImageIOThaw"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_ImageIOThaw_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "ImageIOThaw")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_ImageIOThaw_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "Simg :curs Fseen Ftodo :pf :pf_ct Fhandle Istream_flags :chunk :chunk_pos :chunk_len :chunk_size ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_ImageIOThaw_get_vtable(interp);
+        vt->base_type      = enum_class_ImageIOThaw;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "ImageIOThaw");
+        vt->provides_str = CONST_STRING_GEN(interp, "scalar");
+        vt->isa_hash     = Parrot_ImageIOThaw_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_ImageIOThaw_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_ImageIOThaw;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_ImageIOThaw_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+        }
+    } /* pass */
+} /* Parrot_ImageIOThaw_class_init */
+
+#line 857 "./src/pmc/imageiothaw.pmc"
+
+
+/*
+
+=back
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
+
@@ -0,0 +1,518 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/imccompiler.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_fixedintegerarray.h"
+#include "pmc_imccompiler.h"
+#include "pmc_default.h"
+#include "imccompiler.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/imccompiler.pmc"
+/*
+Copyright (C) 2011-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/imccompiler.pmc - IMCCompiler PMC
+
+=head1 DESCRIPTION
+
+A compiler object to wrap IMCC, the internal PIR and PASM compiler.
+
+=head2 Functions
+
+=cut
+
+*/
+
+#include "imcc/embed.h"
+#include "imcc/yyscanner.h"
+#include "pmc/pmc_sub.h"
+
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+#define BEGIN_IMCC_COMPILE(i) \
+    do { \
+        UINTVAL __regs_used[4] = {3, 3, 3, 3}; \
+        PMC * const __newcontext = Parrot_push_context((i), __regs_used); \
+        PackFile_ByteCode * const __old_bc = (i)->code; \
+        Parrot_block_GC_mark((i)); \
+        Parrot_pcc_set_HLL((i), __newcontext, 0); \
+        Parrot_pcc_set_sub((i), __newcontext, 0); \
+
+#define END_IMCC_COMPILE(i) \
+        Parrot_pop_context((i)); \
+        Parrot_unblock_GC_mark((i)); \
+        (i)->code = __old_bc; \
+    } while (0)
+
+#define ERROR_IMCC_COMPILE(i) \
+    Parrot_pop_context((i)); \
+    Parrot_unblock_GC_mark((i)); \
+    (i)->code = __old_bc; \
+
+/* HEADERIZER HFILE: none */
+#line 72 "./src/pmc/imccompiler.c"
+static  void  Parrot_IMCCompiler_destroy(SHIM_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_IMCCompiler_get_integer(SHIM_INTERP, ARGMOD(PMC *_self));
+static  void  * Parrot_IMCCompiler_get_pointer(SHIM_INTERP, ARGMOD(PMC *_self));
+static  STRING  * Parrot_IMCCompiler_get_string(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_IMCCompiler_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_IMCCompiler_init_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL is_pasm);
+static  void  Parrot_IMCCompiler_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *init);
+static  opcode_t*  Parrot_IMCCompiler_invoke(PARROT_INTERP, ARGMOD(PMC *_self), void *next);
+static  void Parrot_IMCCompiler_nci_compile(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_IMCCompiler_nci_compile_file(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_IMCCompiler_nci_preprocess(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_IMCCompiler_class_init(PARROT_INTERP, int, int);
+void    Parrot_IMCCompiler_ro_class_init(PARROT_INTERP, int, int);
+static  void 
+Parrot_IMCCompiler_destroy(SHIM_INTERP, ARGMOD(PMC *_self))
+{
+#line 139 "./src/pmc/imccompiler.pmc"
+
+    Parrot_IMCCompiler_attributes * const attrs = PARROT_IMCCOMPILER(_self);
+    imcc_destroy((imc_info_t*)(attrs->imcc_info));
+    attrs->imcc_info = NULL;
+#line 94 "./src/pmc/imccompiler.c"
+}
+static  INTVAL 
+Parrot_IMCCompiler_get_integer(SHIM_INTERP, ARGMOD(PMC *_self))
+{
+#line 125 "./src/pmc/imccompiler.pmc"
+
+    const Parrot_IMCCompiler_attributes * const attrs = PARROT_IMCCOMPILER(_self);
+    return attrs->is_pasm;
+#line 103 "./src/pmc/imccompiler.c"
+}
+static  void  *
+Parrot_IMCCompiler_get_pointer(SHIM_INTERP, ARGMOD(PMC *_self))
+{
+#line 119 "./src/pmc/imccompiler.pmc"
+
+    const Parrot_IMCCompiler_attributes * const attrs = PARROT_IMCCOMPILER(_self);
+    return attrs->imcc_info;
+#line 112 "./src/pmc/imccompiler.c"
+}
+static  STRING  *
+Parrot_IMCCompiler_get_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 131 "./src/pmc/imccompiler.pmc"
+
+    const Parrot_IMCCompiler_attributes * const attrs = PARROT_IMCCOMPILER(_self);
+    if (attrs->is_pasm)
+        return CONST_STRING(interp, "PASM");
+    else
+        return CONST_STRING(interp, "PIR");
+#line 124 "./src/pmc/imccompiler.c"
+}
+static  void 
+Parrot_IMCCompiler_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 55 "./src/pmc/imccompiler.pmc"
+
+    /**/UNUSED(_self)
+    Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+        "IMCCompiler: Must initialize with an integer argument 0 (PIR) or 1 (PASM)");
+#line 134 "./src/pmc/imccompiler.c"
+}
+static  void 
+Parrot_IMCCompiler_init_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL is_pasm)
+{
+#line 66 "./src/pmc/imccompiler.pmc"
+
+    Parrot_IMCCompiler_attributes * const attrs = PARROT_IMCCOMPILER(_self);
+    if (is_pasm != 0 && is_pasm != 1)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "IMCCompiler: Must have type 0 (PIR) or 1 (PASM)");
+    attrs->is_pasm = is_pasm;
+    attrs->imcc_info = (void*) imcc_new(interp);
+    attrs->current_eval = 0;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 149 "./src/pmc/imccompiler.c"
+}
+static  void 
+Parrot_IMCCompiler_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *init)
+{
+#line 61 "./src/pmc/imccompiler.pmc"
+
+    const INTVAL type = VTABLE_get_integer(interp, init);
+    VTABLE_init_int(interp, _self, type);
+#line 158 "./src/pmc/imccompiler.c"
+}
+static  opcode_t* 
+Parrot_IMCCompiler_invoke(PARROT_INTERP, ARGMOD(PMC *_self), void *next)
+{
+#line 78 "./src/pmc/imccompiler.pmc"
+
+    Parrot_IMCCompiler_attributes * const attrs = PARROT_IMCCOMPILER(_self);
+    imc_info_t * const imcc = (imc_info_t*) attrs->imcc_info;
+    PMC * const ctx = CURRENT_CONTEXT(interp);
+    PMC * cont = interp->current_cont;
+    PMC * const call_object = Parrot_pcc_get_signature(interp, ctx);
+    PackFile_ByteCode * const cur_code = interp->code;
+    STRING * code = STRINGNULL;
+    PMC * result = PMCNULL;
+    const UINTVAL regs_used[4] = {3, 3, 3, 3};
+    PMC * const newcontext = Parrot_push_context(interp, regs_used);
+
+    Parrot_block_GC_mark(interp);
+    Parrot_pcc_set_sub(interp, newcontext, 0);
+
+    Parrot_pcc_fill_params_from_c_args(interp, call_object, "S", &code);
+    imcc_reset(imcc);
+    result = imcc_compile_string(imcc, code, attrs->is_pasm);
+    if (PMC_IS_NULL(result)) {
+        STRING * const msg   = imcc_last_error_message(imcc);
+        const INTVAL errcode = imcc_last_error_code(imcc);
+        Parrot_unblock_GC_mark(interp);
+        Parrot_ex_throw_from_c_args(interp, NULL, errcode, "%Ss", msg);
+    }
+
+    Parrot_pop_context(interp);
+    Parrot_unblock_GC_mark(interp);
+
+    /* Handle the case where we we've been tailcalled into. See NCI.invoke
+       for more details */
+    if (!PMC_IS_NULL(cont)
+    && (PObj_get_FLAGS(cont) & SUB_FLAG_TAILCALL)) {
+        cont = Parrot_pcc_get_continuation(interp, CURRENT_CONTEXT(interp));
+        next = VTABLE_invoke(interp, cont, next);
+    }
+
+    Parrot_pcc_set_call_from_c_args(interp, call_object, "P", result);
+    interp->code = cur_code;
+    return (opcode_t*)next;
+#line 203 "./src/pmc/imccompiler.c"
+}
+static  void
+Parrot_IMCCompiler_nci_compile(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* source;
+    STRING* path;
+    INTVAL has_path;
+    STRING* _param_name_str_target = CONST_STRING_GEN(interp, "target");
+    STRING* target;
+    INTVAL has_target;
+    STRING* _param_name_str_outer_ctx = CONST_STRING_GEN(interp, "outer_ctx");
+    PMC* outer_ctx;
+    INTVAL has_ctx;
+    
+    Parrot_pcc_fill_params_from_c_args(interp, _call_object, "PiSSoIpSnSoIpSnPoIp",
+        &_self, &source, &path, &has_path, &_param_name_str_target, &target, &has_target, &_param_name_str_outer_ctx, &outer_ctx, &has_ctx);
+
+    { /* BEGIN PMETHOD BODY */
+#line 150 "./src/pmc/imccompiler.pmc"
+
+    Parrot_IMCCompiler_attributes * const attrs = PARROT_IMCCOMPILER(_self);
+    PMC * pf;
+    imc_info_t * const imcc = (imc_info_t*)attrs->imcc_info;
+
+    if (has_target)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "IMCCompiler: compiler does not support the target option");
+
+    BEGIN_IMCC_COMPILE(interp);
+
+    /* TODO: Handle outer_ctx */
+    pf = imcc_compile_string(imcc, source, attrs->is_pasm);
+    if (PMC_IS_NULL(pf)) {
+        STRING * const msg = imcc_last_error_message(imcc);
+        INTVAL code = imcc_last_error_code(imcc);
+        ERROR_IMCC_COMPILE(interp);
+        Parrot_ex_throw_from_c_args(interp, NULL, code, "%Ss", msg);
+    }
+    if (has_path)
+        VTABLE_set_string_native(interp, pf, path);
+
+    END_IMCC_COMPILE(interp);
+
+    #line 251 "./src/pmc/imccompiler.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)pf);
+        
+        return;
+     }
+#line 174 "./src/pmc/imccompiler.pmc"
+
+#line 259 "./src/pmc/imccompiler.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_IMCCompiler_nci_compile_file(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* filename;
+    STRING* path;
+    INTVAL has_path;
+    STRING* _param_name_str_target = CONST_STRING_GEN(interp, "target");
+    STRING* target;
+    INTVAL has_target;
+    STRING* _param_name_str_outer_ctx = CONST_STRING_GEN(interp, "outer_ctx");
+    PMC* outer_ctx;
+    INTVAL has_ctx;
+    
+    Parrot_pcc_fill_params_from_c_args(interp, _call_object, "PiSSoIpSnSoIpSnPoIp",
+        &_self, &filename, &path, &has_path, &_param_name_str_target, &target, &has_target, &_param_name_str_outer_ctx, &outer_ctx, &has_ctx);
+
+    { /* BEGIN PMETHOD BODY */
+#line 181 "./src/pmc/imccompiler.pmc"
+
+    Parrot_IMCCompiler_attributes * const attrs = PARROT_IMCCOMPILER(_self);
+    PMC * pf = PMCNULL;
+    imc_info_t * const imcc = (imc_info_t*)attrs->imcc_info;
+
+    if (has_target)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "IMCCompiler: compiler does not support the target option");
+
+    BEGIN_IMCC_COMPILE(interp);
+
+    /* TODO: Handle outer_ctx */
+    pf = imcc_compile_file(imcc, filename, attrs->is_pasm);
+    if (PMC_IS_NULL(pf)) {
+        STRING * const msg = imcc_last_error_message(imcc);
+        const INTVAL code = imcc_last_error_code(imcc);
+        ERROR_IMCC_COMPILE(interp);
+        Parrot_ex_throw_from_c_args(interp, NULL, code, "%Ss", msg);
+    }
+
+    if (has_path)
+        VTABLE_set_string_native(interp, pf, path);
+
+    END_IMCC_COMPILE(interp);
+
+    #line 315 "./src/pmc/imccompiler.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)pf);
+        
+        return;
+     }
+#line 206 "./src/pmc/imccompiler.pmc"
+
+#line 323 "./src/pmc/imccompiler.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_IMCCompiler_nci_preprocess(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* code;
+    
+    const INTVAL arity = 2; /* "PiS" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    code = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 222 "./src/pmc/imccompiler.pmc"
+
+    const Parrot_IMCCompiler_attributes * const attrs = PARROT_IMCCOMPILER(_self);
+    imc_info_t * const imcc = (imc_info_t*)attrs->imcc_info;
+    imcc_preprocess(imcc, code);
+#line 357 "./src/pmc/imccompiler.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_IMCCompiler_update_vtable(VTABLE *vt) {
+    vt->destroy = Parrot_IMCCompiler_destroy;
+    vt->get_integer = Parrot_IMCCompiler_get_integer;
+    vt->get_pointer = Parrot_IMCCompiler_get_pointer;
+    vt->get_string = Parrot_IMCCompiler_get_string;
+    vt->init = Parrot_IMCCompiler_init;
+    vt->init_int = Parrot_IMCCompiler_init_int;
+    vt->init_pmc = Parrot_IMCCompiler_init_pmc;
+    vt->invoke = Parrot_IMCCompiler_invoke;
+    vt->attr_size = sizeof(Parrot_IMCCompiler_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_IMCCompiler_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->destroy = Parrot_IMCCompiler_destroy;
+    vt->get_integer = Parrot_IMCCompiler_get_integer;
+    vt->get_pointer = Parrot_IMCCompiler_get_pointer;
+    vt->get_string = Parrot_IMCCompiler_get_string;
+    vt->invoke = Parrot_IMCCompiler_invoke;
+    vt->attr_size = sizeof(Parrot_IMCCompiler_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_IMCCompiler_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_IMCCompiler_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_IMCCompiler_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_IMCCompiler_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_IMCCompiler_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "IMCCompiler"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_IMCCompiler_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "IMCCompiler")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_IMCCompiler_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        ":imcc_info Iis_pasm Icurrent_eval ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_IMCCompiler_get_vtable(interp);
+        vt->base_type      = enum_class_IMCCompiler;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "IMCCompiler");
+        vt->provides_str = CONST_STRING_GEN(interp, "HLLCompiler");
+        vt->isa_hash     = Parrot_IMCCompiler_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_IMCCompiler_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_IMCCompiler;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_IMCCompiler_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "compile");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_IMCCompiler_nci_compile),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "compile_file");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_IMCCompiler_nci_compile_file),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "preprocess");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_IMCCompiler_nci_preprocess),
+                method_name, signature);
+        }
+        {
+        }
+    } /* pass */
+} /* Parrot_IMCCompiler_class_init */
+
+#line 246 "./src/pmc/imccompiler.pmc"
+
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -0,0 +1,940 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/key.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_fixedintegerarray.h"
+#include "pmc_key.h"
+#include "pmc_default.h"
+#include "key.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/key.pmc"
+/*
+Copyright (C) 2001-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/key.pmc - Key PMC
+
+=head1 DESCRIPTION
+
+These are the vtable functions for the Key PMC class.
+
+=head2 Methods
+
+=over 4
+
+=cut
+
+*/
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+#line 46 "./src/pmc/key.c"
+static  PMC  * Parrot_Key_clone(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_Key_elements(SHIM_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Key_freeze(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+static  INTVAL  Parrot_Key_get_integer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_Key_get_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL n);
+static  PMC  * Parrot_Key_get_pmc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC  * Parrot_Key_get_pmc_keyed(SHIM_INTERP, SHIM(PMC *_self), PMC *key);
+static  PMC  * Parrot_Key_get_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL n);
+static  STRING*  Parrot_Key_get_repr(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING  * Parrot_Key_get_string(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING  * Parrot_Key_get_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL n);
+static  void  Parrot_Key_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Key_mark(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Key_push_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void  Parrot_Key_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void  Parrot_Key_set_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void  Parrot_Key_set_string_native(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value);
+static  PMC  * Parrot_Key_shift_pmc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Key_thaw(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+static  void  Parrot_Key_thawfinish(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *info));
+static  void Parrot_Key_nci_set_register(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Key_nci_make_register_key(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Key_nci_is_register_reference(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Key_nci_get_register_idx(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Key_nci_get_register_contents(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Key_nci_get_type(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_Key_class_init(PARROT_INTERP, int, int);
+void    Parrot_Key_ro_class_init(PARROT_INTERP, int, int);
+static  PMC  *
+Parrot_Key_clone(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 58 "./src/pmc/key.pmc"
+
+    PMC * const dest = Parrot_pmc_new(interp, _self->vtable->base_type);
+    PMC *dkey        = dest;
+    PMC *key         = _self;
+
+    for (; key ;) {
+        switch (KEY_get_FLAGS(key)) {
+          case KEY_integer_FLAG:
+          case KEY_integer_FLAG | KEY_register_FLAG:
+            Parrot_key_set_integer(interp, dkey, Parrot_key_integer(interp, key));
+            break;
+          case KEY_string_FLAG:
+          case KEY_string_FLAG | KEY_register_FLAG:
+            Parrot_key_set_string(interp, dkey, VTABLE_get_string(interp, key));
+            break;
+          case KEY_pmc_FLAG:
+          case KEY_pmc_FLAG | KEY_register_FLAG:
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_UNIMPLEMENTED,
+                    "Key.clone of pmc is broken - see TT #1683");
+          default:
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+                                        "Key: Unknown Key type %d", KEY_get_FLAGS(_self));
+            break;
+        }
+
+        key = Parrot_key_next(interp, key);
+
+        if (key) {
+            PMC * const p = Parrot_key_new(interp);
+            Parrot_key_append(interp, dkey, p);
+            dkey = p;
+        }
+    }
+
+    return dest;
+#line 114 "./src/pmc/key.c"
+}
+static  INTVAL 
+Parrot_Key_elements(SHIM_INTERP, ARGMOD(PMC *_self))
+{
+#line 410 "./src/pmc/key.pmc"
+
+    INTVAL n = 0;
+    for (; _self; _self = PARROT_KEY(_self)->next_key)
+        n++;
+    return n;
+#line 125 "./src/pmc/key.c"
+}
+static  void 
+Parrot_Key_freeze(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 277 "./src/pmc/key.pmc"
+
+    int size;
+    PMC *k;
+
+    for (size = 0, k = _self; k; size++)
+        GETATTR_Key_next_key(interp, k, k);
+
+    VTABLE_push_integer(interp, info, size);
+
+    for (k = _self; k;) {
+        const INTVAL flags = KEY_get_FLAGS(k);
+        VTABLE_push_integer(interp, info, flags);
+
+        switch (flags) {
+          case KEY_integer_FLAG | KEY_register_FLAG:
+          case KEY_string_FLAG  | KEY_register_FLAG:
+          case KEY_pmc_FLAG     | KEY_register_FLAG:
+          case KEY_integer_FLAG:
+            {
+                INTVAL i;
+                GETATTR_Key_int_key(interp, k, i);
+                VTABLE_push_integer(interp, info, i);
+            }
+            break;
+
+          case KEY_string_FLAG:
+            {
+                STRING *s;
+                GETATTR_Key_str_key(interp, k, s);
+                VTABLE_push_string(interp, info, s);
+            }
+            break;
+
+          default:
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_KEY_NOT_FOUND,
+                    "Unsupported key type in Key.freeze");
+            break;
+        }
+
+        GETATTR_Key_next_key(interp, k, k);
+    }
+#line 172 "./src/pmc/key.c"
+}
+static  INTVAL 
+Parrot_Key_get_integer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 119 "./src/pmc/key.pmc"
+
+    return Parrot_key_integer(interp, _self);
+#line 180 "./src/pmc/key.c"
+}
+static  INTVAL 
+Parrot_Key_get_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL n)
+{
+#line 418 "./src/pmc/key.pmc"
+
+    for (; _self && n; _self = PARROT_KEY(_self)->next_key, n--);
+    if (n)
+        Parrot_ex_throw_from_c_args(interp, NULL, 0, "Key access out of bounds");
+    return Parrot_key_integer(interp, _self);
+#line 191 "./src/pmc/key.c"
+}
+static  PMC  *
+Parrot_Key_get_pmc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 152 "./src/pmc/key.pmc"
+
+    return Parrot_key_pmc(interp, _self);
+#line 199 "./src/pmc/key.c"
+}
+static  PMC  *
+Parrot_Key_get_pmc_keyed(SHIM_INTERP, SHIM(PMC *_self), PMC *key)
+{
+#line 253 "./src/pmc/key.pmc"
+    return key;
+#line 206 "./src/pmc/key.c"
+}
+static  PMC  *
+Parrot_Key_get_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL n)
+{
+#line 432 "./src/pmc/key.pmc"
+
+    for (; _self && n; _self = PARROT_KEY(_self)->next_key, n--);
+    if (n)
+        Parrot_ex_throw_from_c_args(interp, NULL, 0, "Key access out of bounds");
+    return Parrot_key_pmc(interp, _self);
+#line 217 "./src/pmc/key.c"
+}
+static  STRING* 
+Parrot_Key_get_repr(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 377 "./src/pmc/key.pmc"
+
+    return Parrot_key_set_to_string(interp, _self);
+#line 225 "./src/pmc/key.c"
+}
+static  STRING  *
+Parrot_Key_get_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 133 "./src/pmc/key.pmc"
+
+    /* Parrot_key_string() is only useful if this PMC has a key type */
+    if (KEY_get_FLAGS(_self)) {
+        return Parrot_key_string(interp, _self);
+    }
+
+    return CONST_STRING(interp, "");
+#line 238 "./src/pmc/key.c"
+}
+static  STRING  *
+Parrot_Key_get_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL n)
+{
+#line 425 "./src/pmc/key.pmc"
+
+    for (; _self && n; _self = PARROT_KEY(_self)->next_key, n--);
+    if (n)
+        Parrot_ex_throw_from_c_args(interp, NULL, 0, "Key access out of bounds");
+    return Parrot_key_string(interp, _self);
+#line 249 "./src/pmc/key.c"
+}
+static  void 
+Parrot_Key_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 44 "./src/pmc/key.pmc"
+
+    PObj_custom_mark_SET(_self);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 258 "./src/pmc/key.c"
+}
+static  void 
+Parrot_Key_mark(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 105 "./src/pmc/key.pmc"
+
+    Parrot_key_mark(interp, _self);
+#line 266 "./src/pmc/key.c"
+}
+static  void 
+Parrot_Key_push_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 208 "./src/pmc/key.pmc"
+
+    if (value->vtable->base_type != enum_class_Key)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "Can only push another Key onto a Key PMC.");
+
+    Parrot_key_append(interp, _self, value);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 279 "./src/pmc/key.c"
+}
+static  void 
+Parrot_Key_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+#line 164 "./src/pmc/key.pmc"
+
+    Parrot_key_set_integer(interp, _self, value);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 288 "./src/pmc/key.c"
+}
+static  void 
+Parrot_Key_set_pmc(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value))
+{
+#line 191 "./src/pmc/key.pmc"
+
+    /**/UNUSED(_self)
+    Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_UNIMPLEMENTED,
+            "Key.set_pmc is broken - see GH #499");
+#line 298 "./src/pmc/key.c"
+}
+static  void 
+Parrot_Key_set_string_native(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value)
+{
+#line 177 "./src/pmc/key.pmc"
+
+    Parrot_key_set_string(interp, _self, value);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 307 "./src/pmc/key.c"
+}
+static  PMC  *
+Parrot_Key_shift_pmc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 229 "./src/pmc/key.pmc"
+
+    PMC *next_key;
+
+    GETATTR_Key_next_key(interp, _self, next_key);
+
+    return next_key;
+#line 319 "./src/pmc/key.c"
+}
+static  void 
+Parrot_Key_thaw(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 320 "./src/pmc/key.pmc"
+
+    int  size;
+    PMC *k = _self;
+
+    PObj_custom_mark_SET(_self);
+
+    for (size = VTABLE_shift_integer(interp, info); size; size--) {
+        const INTVAL flags  = VTABLE_shift_integer(interp, info) & KEY_type_FLAGS;
+
+        PObj_get_FLAGS(k) |= flags;
+
+        /* get contents */
+        switch (flags) {
+          case KEY_integer_FLAG | KEY_register_FLAG:
+          case KEY_string_FLAG  | KEY_register_FLAG:
+          case KEY_pmc_FLAG     | KEY_register_FLAG:
+          case KEY_integer_FLAG:
+            SETATTR_Key_int_key(interp, k, VTABLE_shift_integer(interp, info));
+            break;
+
+          case KEY_string_FLAG:
+            VTABLE_set_string_native(interp, k, VTABLE_shift_string(interp, info));
+            break;
+
+          default:
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_KEY_NOT_FOUND,
+                    "Unsupported key type in Key.thaw");
+            break;
+        }
+
+        if (size == 1) {
+            SETATTR_Key_next_key(interp, k, NULL);
+        }
+        else {
+            SETATTR_Key_next_key(interp, k, Parrot_pmc_new(interp, enum_class_Key));
+            GETATTR_Key_next_key(interp, k, k);
+        }
+    }
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 364 "./src/pmc/key.c"
+}
+static  void 
+Parrot_Key_thawfinish(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *info))
+{
+#line 360 "./src/pmc/key.pmc"
+    PMC *key = _self;
+
+    while (1) {
+        PMC *next;
+        GETATTR_Key_next_key(interp, key, next);
+
+        if (PMC_IS_NULL(next)) {
+            SETATTR_Key_next_key(interp, key, NULL);
+            break;
+        }
+
+        key = next;
+    }
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 384 "./src/pmc/key.c"
+}
+static  void
+Parrot_Key_nci_set_register(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    INTVAL reg_no;
+    INTVAL reg_type;
+    
+    const INTVAL arity = 3; /* "PiII" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    reg_no = VTABLE_get_integer_keyed_int(interp, _call_object, 1);
+    reg_type = VTABLE_get_integer_keyed_int(interp, _call_object, 2);
+
+    { /* BEGIN PMETHOD BODY */
+#line 390 "./src/pmc/key.pmc"
+
+    Parrot_key_set_register(interp, _self, reg_no, reg_type);
+#line 411 "./src/pmc/key.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Key_nci_make_register_key(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* set;
+    INTVAL idx;
+    
+    const INTVAL arity = 3; /* "PiSI" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    set = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+    idx = VTABLE_get_integer_keyed_int(interp, _call_object, 2);
+
+    { /* BEGIN PMETHOD BODY */
+#line 439 "./src/pmc/key.pmc"
+
+    INTVAL first_char = Parrot_str_indexed(interp, set, 0);
+    KEY_flags key_type;
+    switch (first_char) {
+        case 'S':
+            key_type = KEY_string_FLAG;
+            break;
+        case 'I':
+            key_type = KEY_integer_FLAG;
+            break;
+        case 'P':
+            key_type = KEY_pmc_FLAG;
+            break;
+        default:
+            Parrot_ex_throw_from_c_args(interp, NULL, 0,
+                "Key: Unknown register set %Ss", set);
+    }
+    Parrot_key_set_register(interp, _self, idx, (INTVAL)key_type);
+#line 461 "./src/pmc/key.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Key_nci_is_register_reference(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 459 "./src/pmc/key.pmc"
+
+    INTVAL is_reg_ref = KEY_register_TEST(_self) ? 1 : 0;
+    #line 491 "./src/pmc/key.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)is_reg_ref);
+        
+        return;
+     }
+#line 461 "./src/pmc/key.pmc"
+
+#line 499 "./src/pmc/key.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Key_nci_get_register_idx(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 464 "./src/pmc/key.pmc"
+
+    if (!KEY_register_TEST(_self))
+        Parrot_ex_throw_from_c_args(interp, NULL, 0,
+            "Key: Key is not a register reference");
+    else {
+        const INTVAL idx = Parrot_key_integer(interp, _self);
+        #line 533 "./src/pmc/key.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)idx);
+        
+        return;
+     }
+#line 470 "./src/pmc/key.pmc"
+
+    }
+#line 542 "./src/pmc/key.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Key_nci_get_register_contents(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* ctx;
+    INTVAL has_ctx;
+    
+    const INTVAL arity = 1; /* "PiPoIp" */
+    const INTVAL arity_opt  = 1;
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count < arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too few arguments: %d passed, %d expected",
+                                    param_count, arity);
+    if (param_count > arity + arity_opt)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too many arguments: %d passed, %d expected",
+                                    param_count, arity + arity_opt);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    if (param_count > 1) {
+        ctx = VTABLE_get_pmc_keyed_int(interp, _call_object, 1);
+        has_ctx = 1;
+    }
+    else {
+        ctx = PMCNULL;
+        has_ctx = 0;
+    }
+
+    { /* BEGIN PMETHOD BODY */
+#line 474 "./src/pmc/key.pmc"
+
+    INTVAL int_key;
+    if (!KEY_register_TEST(_self))
+        Parrot_ex_throw_from_c_args(interp, NULL, 0,
+            "Key: Key is not a register reference");
+
+    GETATTR_Key_int_key(interp, _self, int_key);
+    if (!has_ctx || PMC_IS_NULL(ctx)) {
+        switch (KEY_get_FLAGS(_self)) {
+            case KEY_string_FLAG | KEY_register_FLAG: {
+                STRING * const str_val =  REG_STR(interp, int_key);
+                #line 597 "./src/pmc/key.c"
+     {
+        VTABLE_set_string_keyed_int(interp, _call_object, 0, (STRING*)str_val);
+        
+        return;
+     }
+#line 485 "./src/pmc/key.pmc"
+
+            }
+            case KEY_pmc_FLAG | KEY_register_FLAG: {
+                PMC * const pmc_val = REG_PMC(interp, int_key);
+                #line 608 "./src/pmc/key.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)pmc_val);
+        
+        return;
+     }
+#line 489 "./src/pmc/key.pmc"
+
+            }
+            case KEY_integer_FLAG | KEY_register_FLAG: {
+                const INTVAL int_val = REG_INT(interp, int_key);
+                #line 619 "./src/pmc/key.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)int_val);
+        
+        return;
+     }
+#line 493 "./src/pmc/key.pmc"
+
+            }
+            default:
+                Parrot_ex_throw_from_c_args(interp, NULL, 0,
+                    "Key: Unknown Key type %d", KEY_get_FLAGS(_self));
+        }
+    }
+    else {
+        switch (KEY_get_FLAGS(_self)) {
+            case KEY_string_FLAG | KEY_register_FLAG: {
+                STRING * const str_val =  *Parrot_pcc_get_STRING_reg(interp, ctx, int_key);
+                #line 637 "./src/pmc/key.c"
+     {
+        VTABLE_set_string_keyed_int(interp, _call_object, 0, (STRING*)str_val);
+        
+        return;
+     }
+#line 504 "./src/pmc/key.pmc"
+
+            }
+            case KEY_pmc_FLAG | KEY_register_FLAG: {
+                PMC * const pmc_val = *Parrot_pcc_get_PMC_reg(interp, ctx, int_key);
+                #line 648 "./src/pmc/key.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)pmc_val);
+        
+        return;
+     }
+#line 508 "./src/pmc/key.pmc"
+
+            }
+            case KEY_integer_FLAG | KEY_register_FLAG: {
+                const INTVAL int_val = *Parrot_pcc_get_INTVAL_reg(interp, ctx, int_key);
+                #line 659 "./src/pmc/key.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)int_val);
+        
+        return;
+     }
+#line 512 "./src/pmc/key.pmc"
+
+            }
+            default:
+                Parrot_ex_throw_from_c_args(interp, NULL, 0,
+                    "Key: Unknown Key type %d", KEY_get_FLAGS(_self));
+        }
+    }
+
+#line 674 "./src/pmc/key.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Key_nci_get_type(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 523 "./src/pmc/key.pmc"
+
+    INTVAL ret = 0;
+    switch (KEY_get_FLAGS(_self)) {
+#if 0
+        case KEY_integer_FLAG:
+        case KEY_integer_FLAG | KEY_register_FLAG:
+            ret = 0;
+            break;
+#endif
+        case KEY_string_FLAG:
+        case KEY_string_FLAG | KEY_register_FLAG:
+            ret = 1;
+            break;
+        case KEY_pmc_FLAG:
+        case KEY_pmc_FLAG | KEY_register_FLAG:
+            ret = 2;
+            break;
+        default:
+            break;
+    }
+
+    #line 723 "./src/pmc/key.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)ret);
+        
+        return;
+     }
+#line 544 "./src/pmc/key.pmc"
+
+#line 731 "./src/pmc/key.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_Key_update_vtable(VTABLE *vt) {
+    vt->clone = Parrot_Key_clone;
+    vt->elements = Parrot_Key_elements;
+    vt->freeze = Parrot_Key_freeze;
+    vt->get_integer = Parrot_Key_get_integer;
+    vt->get_integer_keyed_int = Parrot_Key_get_integer_keyed_int;
+    vt->get_pmc = Parrot_Key_get_pmc;
+    vt->get_pmc_keyed = Parrot_Key_get_pmc_keyed;
+    vt->get_pmc_keyed_int = Parrot_Key_get_pmc_keyed_int;
+    vt->get_repr = Parrot_Key_get_repr;
+    vt->get_string = Parrot_Key_get_string;
+    vt->get_string_keyed_int = Parrot_Key_get_string_keyed_int;
+    vt->init = Parrot_Key_init;
+    vt->mark = Parrot_Key_mark;
+    vt->push_pmc = Parrot_Key_push_pmc;
+    vt->set_integer_native = Parrot_Key_set_integer_native;
+    vt->set_pmc = Parrot_Key_set_pmc;
+    vt->set_string_native = Parrot_Key_set_string_native;
+    vt->shift_pmc = Parrot_Key_shift_pmc;
+    vt->thaw = Parrot_Key_thaw;
+    vt->thawfinish = Parrot_Key_thawfinish;
+    vt->attr_size = sizeof(Parrot_Key_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_Key_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->clone = Parrot_Key_clone;
+    vt->elements = Parrot_Key_elements;
+    vt->freeze = Parrot_Key_freeze;
+    vt->get_integer = Parrot_Key_get_integer;
+    vt->get_integer_keyed_int = Parrot_Key_get_integer_keyed_int;
+    vt->get_pmc = Parrot_Key_get_pmc;
+    vt->get_pmc_keyed = Parrot_Key_get_pmc_keyed;
+    vt->get_pmc_keyed_int = Parrot_Key_get_pmc_keyed_int;
+    vt->get_repr = Parrot_Key_get_repr;
+    vt->get_string = Parrot_Key_get_string;
+    vt->get_string_keyed_int = Parrot_Key_get_string_keyed_int;
+    vt->mark = Parrot_Key_mark;
+    vt->attr_size = sizeof(Parrot_Key_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Key_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_Key_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Key_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_Key_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_Key_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "Key"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_Key_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "Key")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_Key_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "Fnext_key Iint_key Sstr_key ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_Key_get_vtable(interp);
+        vt->base_type      = enum_class_Key;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "Key");
+        vt->provides_str = CONST_STRING_GEN(interp, "scalar");
+        vt->isa_hash     = Parrot_Key_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_Key_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_Key;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_Key_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "set_register");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Key_nci_set_register),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "make_register_key");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Key_nci_make_register_key),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "is_register_reference");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Key_nci_is_register_reference),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "get_register_idx");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Key_nci_get_register_idx),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "get_register_contents");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Key_nci_get_register_contents),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "get_type");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Key_nci_get_type),
+                method_name, signature);
+        }
+        {
+        }
+    } /* pass */
+} /* Parrot_Key_class_init */
+
+#line 545 "./src/pmc/key.pmc"
+
+
+/*
+
+=back
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
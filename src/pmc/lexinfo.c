@@ -0,0 +1,274 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/lexinfo.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_fixedintegerarray.h"
+#include "pmc_lexinfo.h"
+#include "pmc_hash.h"
+#include "pmc_default.h"
+#include "lexinfo.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/lexinfo.pmc"
+/*
+Copyright (C) 2008-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/lexinfo.pmc - LexInfo PMC
+
+=head1 DESCRIPTION
+
+These are the vtable functions for the lexinfo PMC.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "pmc/pmc_hash.h"
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+
+/*
+ * LexInfo contains a constant Hash with constant string
+ * keys and integer indices
+ */
+#line 54 "./src/pmc/lexinfo.c"
+static  void  Parrot_LexInfo_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_LexInfo_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *sub));
+static  PMC  * Parrot_LexInfo_inspect_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *what);
+static  void Parrot_LexInfo_nci_declare_lex_preg(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_LexInfo_class_init(PARROT_INTERP, int, int);
+void    Parrot_LexInfo_ro_class_init(PARROT_INTERP, int, int);
+static  void 
+Parrot_LexInfo_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 46 "./src/pmc/lexinfo.pmc"
+
+    /* Set value type to INTVAL */
+    VTABLE_init_int(interp, _self, (INTVAL)enum_type_INTVAL);
+#line 68 "./src/pmc/lexinfo.c"
+}
+static  void 
+Parrot_LexInfo_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *sub))
+{
+#line 51 "./src/pmc/lexinfo.pmc"
+    /* Set value type to INTVAL */
+    VTABLE_init_int(interp, _self, (INTVAL)enum_type_INTVAL);
+#line 76 "./src/pmc/lexinfo.c"
+}
+static  PMC  *
+Parrot_LexInfo_inspect_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *what)
+{
+#line 86 "./src/pmc/lexinfo.pmc"
+
+    if (STRING_equal(interp, what, CONST_STRING(interp, "symbols"))) {
+        PMC * const result    = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+        const Hash *hash      = (Hash *)VTABLE_get_pointer(interp, _self);
+
+        parrot_hash_iterate(hash,
+            PARROT_ASSERT(_bucket->key);
+            VTABLE_push_string(interp, result, (STRING *)_bucket->key););
+
+        return result;
+    }
+    else
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "Unknown introspection value '%S'", what);
+#line 96 "./src/pmc/lexinfo.c"
+}
+static  void
+Parrot_LexInfo_nci_declare_lex_preg(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* name;
+    INTVAL preg;
+    
+    const INTVAL arity = 3; /* "PiSI" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    name = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+    preg = VTABLE_get_integer_keyed_int(interp, _call_object, 2);
+
+    { /* BEGIN PMETHOD BODY */
+#line 69 "./src/pmc/lexinfo.pmc"
+
+    VTABLE_set_integer_keyed_str(interp, _self, name,
+        (preg << 2) | REGNO_PMC);
+#line 124 "./src/pmc/lexinfo.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_LexInfo_update_vtable(VTABLE *vt) {
+    vt->init = Parrot_LexInfo_init;
+    vt->init_pmc = Parrot_LexInfo_init_pmc;
+    vt->inspect_str = Parrot_LexInfo_inspect_str;
+    vt->attr_size = sizeof(Parrot_LexInfo_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_LexInfo_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->inspect_str = Parrot_LexInfo_inspect_str;
+    vt->attr_size = sizeof(Parrot_LexInfo_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_LexInfo_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_Hash_get_vtable(interp);
+    Parrot_LexInfo_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_LexInfo_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_Hash_ro_get_vtable(interp);
+    Parrot_LexInfo_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_LexInfo_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+    mro = Parrot_Hash_get_mro(interp, mro);
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "LexInfo"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_LexInfo_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    isa = Parrot_Hash_get_isa(interp, isa);
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "LexInfo")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_LexInfo_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        ":hash ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_LexInfo_get_vtable(interp);
+        vt->base_type      = enum_class_LexInfo;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "LexInfo");
+        vt->provides_str = CONST_STRING_GEN(interp, "hash");
+        vt->isa_hash     = Parrot_LexInfo_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_LexInfo_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_LexInfo;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_LexInfo_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "declare_lex_preg");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_LexInfo_nci_declare_lex_preg),
+                method_name, signature);
+        }
+        {
+        }
+    } /* pass */
+} /* Parrot_LexInfo_class_init */
+
+#line 100 "./src/pmc/lexinfo.pmc"
+
+
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<docs/pdds/pdd20_lexical_vars.pod>, F<src/classes/lexpad.pmc>.
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
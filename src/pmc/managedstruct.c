@@ -0,0 +1,278 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/managedstruct.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_managedstruct.h"
+#include "pmc_unmanagedstruct.h"
+#include "pmc_default.h"
+#include "managedstruct.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/managedstruct.pmc"
+/*
+Copyright (C) 2001-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/managedstruct.pmc - ManagedStruct PMC
+
+=head1 DESCRIPTION
+
+C<ManagedStruct> extends C<UnManagedStruct> to provide a class to hold C
+C<struct> values, a memory-managed C struct, that Parrot is responsible
+for disposing of.
+
+=head2 Methods
+
+=over 4
+
+=cut
+
+*/
+
+typedef void (*custom_free_func_t)(PARROT_INTERP, void *ptr, void *priv);
+typedef PMC * (*custom_clone_func_t)(PARROT_INTERP, PMC *ptr, void *priv);
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+#line 51 "./src/pmc/managedstruct.c"
+static  PMC  * Parrot_ManagedStruct_clone(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_ManagedStruct_destroy(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_ManagedStruct_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_ManagedStruct_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void  Parrot_ManagedStruct_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+void    Parrot_ManagedStruct_class_init(PARROT_INTERP, int, int);
+void    Parrot_ManagedStruct_ro_class_init(PARROT_INTERP, int, int);
+static  PMC  *
+Parrot_ManagedStruct_clone(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 146 "./src/pmc/managedstruct.pmc"
+
+    const custom_clone_func_t clone_func = PARROT_MANAGEDSTRUCT(_self)->custom_clone_func;
+    PMC *dest;
+    if (clone_func) {
+        void * const clone_data = PARROT_MANAGEDSTRUCT(_self)->custom_clone_priv;
+        return clone_func(interp, _self, clone_data);
+    }
+    dest = Parrot_pmc_new_init(interp, _self->vtable->base_type,
+        PARROT_MANAGEDSTRUCT(_self)->init);
+
+    if (PARROT_MANAGEDSTRUCT(_self)->ptr)
+        memmove(PARROT_MANAGEDSTRUCT(dest)->ptr,
+                PARROT_MANAGEDSTRUCT(_self)->ptr,
+                PARROT_MANAGEDSTRUCT(_self)->size);
+
+    return dest;
+#line 79 "./src/pmc/managedstruct.c"
+}
+static  void 
+Parrot_ManagedStruct_destroy(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 84 "./src/pmc/managedstruct.pmc"
+
+    void * const ptr = PARROT_MANAGEDSTRUCT(_self)->ptr;
+    if (ptr) {
+        const custom_free_func_t free_func = PARROT_MANAGEDSTRUCT(_self)->custom_free_func;
+        if (free_func) {
+            void * const free_data = PARROT_MANAGEDSTRUCT(_self)->custom_free_priv;
+            free_func(interp, ptr, free_data);
+        }
+        else {
+            mem_gc_free(interp, ptr);
+        }
+    }
+#line 97 "./src/pmc/managedstruct.c"
+}
+static  void 
+Parrot_ManagedStruct_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 52 "./src/pmc/managedstruct.pmc"
+
+    PObj_custom_destroy_SET(_self);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 106 "./src/pmc/managedstruct.c"
+}
+static  void 
+Parrot_ManagedStruct_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 66 "./src/pmc/managedstruct.pmc"
+
+    VTABLE_init(interp, _self);
+    VTABLE_set_pmc(interp, _self, value);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 116 "./src/pmc/managedstruct.c"
+}
+static  void 
+Parrot_ManagedStruct_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+#line 108 "./src/pmc/managedstruct.pmc"
+
+    Parrot_ManagedStruct_attributes * const attrs = PARROT_MANAGEDSTRUCT(_self);
+
+    if (attrs->ptr && !value) {
+        mem_gc_free(interp, attrs->ptr);
+        attrs->ptr  = NULL;
+        attrs->size = 0;
+    }
+    else if (value && !attrs->ptr) {
+        attrs->ptr  = Parrot_gc_allocate_memory_chunk_with_interior_pointers(
+                interp, (size_t)value);
+        attrs->size = value;
+    }
+    else if (value && attrs->ptr) {
+        if (attrs->size != value) {
+            attrs->ptr =
+                Parrot_gc_reallocate_memory_chunk_with_interior_pointers(interp,
+                    attrs->ptr, (size_t)value, attrs->size);
+            attrs->size = value;
+        }
+    }
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 144 "./src/pmc/managedstruct.c"
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_ManagedStruct_update_vtable(VTABLE *vt) {
+    vt->clone = Parrot_ManagedStruct_clone;
+    vt->destroy = Parrot_ManagedStruct_destroy;
+    vt->init = Parrot_ManagedStruct_init;
+    vt->init_pmc = Parrot_ManagedStruct_init_pmc;
+    vt->set_integer_native = Parrot_ManagedStruct_set_integer_native;
+    vt->attr_size = sizeof(Parrot_ManagedStruct_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_ManagedStruct_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->clone = Parrot_ManagedStruct_clone;
+    vt->destroy = Parrot_ManagedStruct_destroy;
+    vt->attr_size = sizeof(Parrot_ManagedStruct_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_ManagedStruct_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_UnManagedStruct_get_vtable(interp);
+    Parrot_ManagedStruct_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_ManagedStruct_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_UnManagedStruct_ro_get_vtable(interp);
+    Parrot_ManagedStruct_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_ManagedStruct_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+    mro = Parrot_UnManagedStruct_get_mro(interp, mro);
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "ManagedStruct"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_ManagedStruct_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    isa = Parrot_UnManagedStruct_get_isa(interp, isa);
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "ManagedStruct")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_ManagedStruct_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        ":ptr Finit Isize :custom_free_func :custom_free_priv :custom_clone_func :custom_clone_priv ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_ManagedStruct_get_vtable(interp);
+        vt->base_type      = enum_class_ManagedStruct;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "ManagedStruct");
+        vt->provides_str = CONST_STRING_GEN(interp, "scalar");
+        vt->isa_hash     = Parrot_ManagedStruct_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_ManagedStruct_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_ManagedStruct;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_ManagedStruct_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+        }
+    } /* pass */
+} /* Parrot_ManagedStruct_class_init */
+
+#line 163 "./src/pmc/managedstruct.pmc"
+
+
+/*
+
+=back
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
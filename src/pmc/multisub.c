@@ -0,0 +1,270 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/multisub.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_multisub.h"
+#include "pmc_resizablepmcarray.h"
+#include "pmc_fixedpmcarray.h"
+#include "pmc_default.h"
+#include "multisub.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/multisub.pmc"
+/*
+Copyright (C) 2001-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/multisub.pmc - MultiSub PMC
+
+=head1 DESCRIPTION
+
+A container for multi-dispatched subs.
+
+This class inherits from ResizablePMCArray and provides an Array of
+Sub PMCs with the same short name, but different long names.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "pmc/pmc_callcontext.h"
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+static void check_is_valid_sub(PARROT_INTERP, ARGIN(PMC * sub))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+#define ASSERT_ARGS_check_is_valid_sub __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(sub))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+/*
+
+=item C<static void check_is_valid_sub(PARROT_INTERP, PMC * sub)>
+
+TK
+
+=cut
+
+*/
+
+static void
+check_is_valid_sub(PARROT_INTERP, ARGIN(PMC * sub))
+{
+    ASSERT_ARGS(check_is_valid_sub)
+    STRING * const invokable_str = CONST_STRING(interp, "invokable");
+    if (!VTABLE_does(interp, sub, invokable_str))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "attempt to add non-invokable PMC");
+}
+#line 82 "./src/pmc/multisub.c"
+static  STRING *  Parrot_MultiSub_get_string(PARROT_INTERP, ARGMOD(PMC *_self));
+static  opcode_t  * Parrot_MultiSub_invoke(PARROT_INTERP, ARGMOD(PMC *_self), void *next);
+static  void  Parrot_MultiSub_push_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void  Parrot_MultiSub_set_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, PMC *value);
+void    Parrot_MultiSub_class_init(PARROT_INTERP, int, int);
+void    Parrot_MultiSub_ro_class_init(PARROT_INTERP, int, int);
+static  STRING * 
+Parrot_MultiSub_get_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 65 "./src/pmc/multisub.pmc"
+
+    PMC * const sub0    = VTABLE_get_pmc_keyed_int(interp, _self, 0);
+    /*if (PMC_IS_NULL(sub0))
+        return STRINGNULL;*/
+    STRING * const name = VTABLE_get_string(interp, sub0);
+    return name;
+#line 99 "./src/pmc/multisub.c"
+}
+static  opcode_t  *
+Parrot_MultiSub_invoke(PARROT_INTERP, ARGMOD(PMC *_self), void *next)
+{
+#line 83 "./src/pmc/multisub.pmc"
+
+    PMC * const sig_obj = CONTEXT(interp)->current_sig;
+    PMC * const func    = Parrot_mmd_sort_manhattan_by_sig_pmc(interp,
+            _self, sig_obj);
+
+    if (PMC_IS_NULL(func))
+        Parrot_ex_throw_from_c_args(interp, NULL, 1,
+                "No applicable candidates found to dispatch to for '%Ss'",
+                VTABLE_get_string(interp, _self));
+    return VTABLE_invoke(interp, func, next);
+#line 115 "./src/pmc/multisub.c"
+}
+static  void 
+Parrot_MultiSub_push_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 73 "./src/pmc/multisub.pmc"
+
+    check_is_valid_sub(interp, value);
+    interp->vtables[enum_class_ResizablePMCArray]->push_pmc(interp, _self, value);
+#line 124 "./src/pmc/multisub.c"
+}
+static  void 
+Parrot_MultiSub_set_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, PMC *value)
+{
+#line 78 "./src/pmc/multisub.pmc"
+
+    check_is_valid_sub(interp, value);
+    interp->vtables[enum_class_ResizablePMCArray]->set_pmc_keyed_int(interp, _self, key, value);
+#line 133 "./src/pmc/multisub.c"
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_MultiSub_update_vtable(VTABLE *vt) {
+    vt->get_string = Parrot_MultiSub_get_string;
+    vt->invoke = Parrot_MultiSub_invoke;
+    vt->push_pmc = Parrot_MultiSub_push_pmc;
+    vt->set_pmc_keyed_int = Parrot_MultiSub_set_pmc_keyed_int;
+    vt->attr_size = sizeof(Parrot_MultiSub_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_MultiSub_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->get_string = Parrot_MultiSub_get_string;
+    vt->invoke = Parrot_MultiSub_invoke;
+    vt->attr_size = sizeof(Parrot_MultiSub_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_MultiSub_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_ResizablePMCArray_get_vtable(interp);
+    Parrot_MultiSub_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_MultiSub_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_ResizablePMCArray_ro_get_vtable(interp);
+    Parrot_MultiSub_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_MultiSub_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+    mro = Parrot_ResizablePMCArray_get_mro(interp, mro);
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "MultiSub"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_MultiSub_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    isa = Parrot_ResizablePMCArray_get_isa(interp, isa);
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "MultiSub")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_MultiSub_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "Isize :pmc_array Iresize_threshold ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_MultiSub_get_vtable(interp);
+        vt->base_type      = enum_class_MultiSub;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "MultiSub");
+        vt->provides_str = CONST_STRING_GEN(interp, "invokable array");
+        vt->isa_hash     = Parrot_MultiSub_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_MultiSub_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_MultiSub;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_MultiSub_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+        }
+    } /* pass */
+} /* Parrot_MultiSub_class_init */
+
+#line 93 "./src/pmc/multisub.pmc"
+
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<src/multidispatch.c>,
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -0,0 +1,1920 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/namespace.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_fixedintegerarray.h"
+#include "pmc_namespace.h"
+#include "pmc_hash.h"
+#include "pmc_default.h"
+#include "namespace.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/namespace.pmc"
+/*
+Copyright (C) 2005-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/namespace.pmc - NameSpace PMC
+
+=head1 DESCRIPTION
+
+These are the vtable functions for the namespace PMC,
+a container for dynamic and structured variable lookup.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "pmc/pmc_sub.h"
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+static void add_multi_to_namespace(PARROT_INTERP,
+    ARGIN(PMC *SELF),
+    ARGIN(STRING *key),
+    ARGIN_NULLOK(PMC *value))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+static void add_native_to_namespace(PARROT_INTERP,
+    ARGIN(PMC *SELF),
+    ARGIN(STRING *key),
+    ARGIN_NULLOK(PMC *value))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+static void add_to_class(PARROT_INTERP,
+    ARGMOD(Parrot_NameSpace_attributes *nsinfo),
+    ARGMOD_NULLOK(PMC *classobj),
+    ARGIN(STRING *key),
+    ARGIN(PMC *value))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(4)
+        __attribute__nonnull__(5)
+        FUNC_MODIFIES(*nsinfo)
+        FUNC_MODIFIES(*classobj);
+
+PARROT_WARN_UNUSED_RESULT
+static int maybe_add_sub_to_namespace(PARROT_INTERP,
+    ARGIN(PMC *SELF),
+    ARGIN(STRING *key),
+    ARGIN(PMC *value))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4);
+
+PARROT_WARN_UNUSED_RESULT
+static int ns_insert_sub_keyed_str(PARROT_INTERP,
+    ARGIN(PMC *self),
+    ARGIN(STRING *key),
+    ARGIN(PMC *value))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4);
+
+#define ASSERT_ARGS_add_multi_to_namespace __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(SELF) \
+    , PARROT_ASSERT_ARG(key))
+#define ASSERT_ARGS_add_native_to_namespace __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(SELF) \
+    , PARROT_ASSERT_ARG(key))
+#define ASSERT_ARGS_add_to_class __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(nsinfo) \
+    , PARROT_ASSERT_ARG(key) \
+    , PARROT_ASSERT_ARG(value))
+#define ASSERT_ARGS_maybe_add_sub_to_namespace __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(SELF) \
+    , PARROT_ASSERT_ARG(key) \
+    , PARROT_ASSERT_ARG(value))
+#define ASSERT_ARGS_ns_insert_sub_keyed_str __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(key) \
+    , PARROT_ASSERT_ARG(value))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+/*
+
+=item C<static void add_to_class(PARROT_INTERP, Parrot_NameSpace_attributes
+*nsinfo, PMC *classobj, STRING *key, PMC *value)>
+
+Add the method Sub C<value> with name C<key> to the C<classobj>.
+
+=cut
+
+*/
+
+static void
+add_to_class(PARROT_INTERP, ARGMOD(Parrot_NameSpace_attributes *nsinfo),
+        ARGMOD_NULLOK(PMC *classobj), ARGIN(STRING *key), ARGIN(PMC *value))
+{
+    ASSERT_ARGS(add_to_class)
+
+    /* Insert it in class, if there is a class */
+    if (!PMC_IS_NULL(classobj) && PObj_is_class_TEST(classobj))
+        VTABLE_add_method(interp, classobj, key, value);
+
+    /* Otherwise, store it in the namespace for the class to
+     * retrieve later */
+    else {
+        /* If we don't have a place to hang methods, make one. */
+        if (PMC_IS_NULL(nsinfo->methods))
+            nsinfo->methods = Parrot_pmc_new(interp, enum_class_Hash);
+
+        /* Insert it. */
+        VTABLE_set_pmc_keyed_str(interp, nsinfo->methods, key, value);
+    }
+}
+
+/*
+
+=item C<static int ns_insert_sub_keyed_str(PARROT_INTERP, PMC *self, STRING
+*key, PMC *value)>
+
+Add the Sub PMC C<value> to the namespace. If it's a vtable, add it as a
+vtable to the corresponding Class (or store it locally for the Class to fetch
+later). If it's a method, do the same.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+ns_insert_sub_keyed_str(PARROT_INTERP, ARGIN(PMC *self), ARGIN(STRING *key),
+        ARGIN(PMC *value))
+{
+    ASSERT_ARGS(ns_insert_sub_keyed_str)
+
+    Parrot_NameSpace_attributes * const nsinfo   = PARROT_NAMESPACE(self);
+    PMC              *       vtable   = nsinfo->vtable;
+    PMC              * const classobj = VTABLE_get_class(interp, self);
+    STRING           * vtable_key     = STRINGNULL;
+    Parrot_Sub_attributes *sub;
+    INTVAL stored = 0;
+
+    PMC_get_sub(interp, value, sub);
+
+    if (sub->vtable_index != -1) {
+        /* Insert it in class, if there is a class */
+        if (!PMC_IS_NULL(classobj) && PObj_is_class_TEST(classobj)) {
+            const char * const vtable_key_c =
+                Parrot_get_vtable_name(interp, sub->vtable_index);
+            PARROT_ASSERT(vtable_key_c);
+            vtable_key = Parrot_str_new(interp, vtable_key_c,
+                strlen(vtable_key_c));
+            VTABLE_add_vtable_override(interp, classobj, vtable_key, value);
+        }
+
+        /* Otherwise, store it in the namespace for the class to
+         * retrieve later */
+        else {
+            /* If we don't have a place to hang vtables, make one. */
+            if (PMC_IS_NULL(vtable))
+                nsinfo->vtable = vtable = Parrot_pmc_new(interp, enum_class_Hash);
+
+            /* Insert it. */
+            VTABLE_set_pmc_keyed_int(interp, vtable, sub->vtable_index, value);
+        }
+        if (!(sub->comp_flags & SUB_COMP_FLAG_NSENTRY))
+            stored = 1;
+    }
+
+    if (sub->comp_flags & SUB_COMP_FLAG_METHOD) {
+        STRING *method_name = key;
+
+        if (STRING_equal(interp, sub->method_name, CONST_STRING(interp, ""))) {
+            if (sub->vtable_index != -1 && !STRING_IS_NULL(vtable_key)) {
+                method_name = vtable_key;
+            }
+        }
+        else {
+            method_name = sub->method_name;
+        }
+        add_to_class(interp, nsinfo, classobj, method_name, value);
+
+        if (!(sub->comp_flags & SUB_COMP_FLAG_NSENTRY))
+            stored = 1;
+    }
+
+    return stored;
+}
+
+/*
+
+=item C<static int maybe_add_sub_to_namespace(PARROT_INTERP, PMC *SELF, STRING
+*key, PMC *value)>
+
+If the item C<value> is a non-null Sub PMC (but not a subclass), add it to the
+namespace and any associated Class PMC (if it's a method or vtable).
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+maybe_add_sub_to_namespace(PARROT_INTERP, ARGIN(PMC *SELF), ARGIN(STRING *key),
+        ARGIN(PMC *value))
+{
+    ASSERT_ARGS(maybe_add_sub_to_namespace)
+
+    STRING * const sub_str = CONST_STRING(interp, "Sub");
+
+    if (!PMC_IS_NULL(value)
+    &&   VTABLE_isa(interp, value, sub_str)
+    &&   value->vtable->base_type != enum_class_Object)
+        return ns_insert_sub_keyed_str(interp, SELF, key, value);
+
+    return 0;
+}
+
+/*
+
+=item C<static void add_native_to_namespace(PARROT_INTERP, PMC *SELF, STRING
+*key, PMC *value)>
+
+Add an NCI or NativePCCMethod PMC to the namespace. The PMC C<value> must
+be non-null. If it's flagged as a method (usually for NativePCCMethod PMCs)
+add it to the Class as well.
+
+=cut
+
+*/
+
+static void
+add_native_to_namespace(PARROT_INTERP, ARGIN(PMC *SELF), ARGIN(STRING *key),
+        ARGIN_NULLOK(PMC *value))
+{
+    ASSERT_ARGS(add_native_to_namespace)
+
+    if (!PMC_IS_NULL(value)
+    && (value->vtable->base_type == enum_class_NativePCCMethod ||
+        value->vtable->base_type == enum_class_NCI)) {
+        Parrot_NameSpace_attributes * const nsinfo = PARROT_NAMESPACE(SELF);
+        PMC * const classobj = VTABLE_get_class(interp, SELF);
+
+        /* Insert it in class, if there is a class */
+        add_to_class(interp, nsinfo, classobj, key, value);
+    }
+}
+
+/*
+
+=item C<static void add_multi_to_namespace(PARROT_INTERP, PMC *SELF, STRING
+*key, PMC *value)>
+
+If PMC C<value> is a MultiSub, add it to the namespace and possibly the
+associated class.
+
+=cut
+
+*/
+
+static void
+add_multi_to_namespace(PARROT_INTERP, ARGIN(PMC *SELF), ARGIN(STRING *key),
+        ARGIN_NULLOK(PMC *value))
+{
+    ASSERT_ARGS(add_multi_to_namespace)
+
+    STRING * const multi_str = CONST_STRING(interp, "MultiSub");
+
+    if (!PMC_IS_NULL(value)
+    &&   VTABLE_isa(interp, value, multi_str)) {
+
+        /* TT #10; work around that Sub doesn't use PMC ATTRs */
+        if (value->vtable->base_type != enum_class_Object
+        &&  VTABLE_elements(interp, value) > 0) {
+            Parrot_NameSpace_attributes * const nsinfo = PARROT_NAMESPACE(SELF);
+            PMC * const classobj = VTABLE_get_class(interp, SELF);
+
+            /* Extract the first alternate and check if it is a method */
+            PMC * const pmc_sub = VTABLE_get_pmc_keyed_int(interp, value, 0);
+            Parrot_Sub_attributes *sub;
+            PMC_get_sub(interp, pmc_sub, sub);
+
+            if (sub->comp_flags & SUB_COMP_FLAG_METHOD) {
+                STRING * const empty_str   = CONST_STRING(interp, "");
+                STRING *method_name = key;
+                Hash   *hash;
+
+                if (!STRING_equal(interp, sub->method_name, empty_str))
+                    method_name = sub->method_name;
+
+                add_to_class(interp, nsinfo, classobj, method_name, value);
+
+                GETATTR_NameSpace_hash(interp, SELF, hash);
+                PARROT_GC_WRITE_BARRIER(interp, SELF);
+
+                Parrot_hash_put(interp, hash,
+                    Parrot_hash_key_from_string(interp, hash, key),
+                    Parrot_hash_value_from_pmc(interp, hash, value));
+            }
+        }
+    }
+}
+
+
+/*
+ * Typically a named slot contains either another namespace or a
+ * var/sub (not both).
+ * In case that the bucket->value is occupied, a FixedPMCArray is
+ * created, and the items are moved over to that extra storage.
+ * The array is flagged with FPA_is_ns_ext to distinguish it from a
+ * plain array variable.
+ *
+ * This could easily expand to a full-fledged typed namespace if needed.
+ */
+
+typedef enum {
+    NS_slot_ns,
+    NS_slot_var_sub,         /* unspecified ~half-raw slot */
+    NS_max_slots
+} NS_slot_enum;
+
+#define FPA_is_ns_ext PObj_private0_FLAG
+#line 365 "./src/pmc/namespace.c"
+static  PMC  * Parrot_NameSpace_get_class(SHIM_INTERP, ARGMOD(PMC *_self));
+static  PMC  * Parrot_NameSpace_get_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  PMC  * Parrot_NameSpace_get_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  PMC  * Parrot_NameSpace_get_pmc_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key);
+static  void  * Parrot_NameSpace_get_pointer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  void  * Parrot_NameSpace_get_pointer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key);
+static  STRING  * Parrot_NameSpace_get_string(SHIM_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_NameSpace_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC  * Parrot_NameSpace_inspect_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *what);
+static  void  Parrot_NameSpace_mark(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_NameSpace_set_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, PMC *value);
+static  void  Parrot_NameSpace_set_pmc_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key, PMC *value);
+static  void Parrot_NameSpace_nci_make_namespace(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_NameSpace_nci_add_namespace(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_NameSpace_nci_add_sub(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_NameSpace_nci_add_var(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_NameSpace_nci_get_name(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_NameSpace_nci_find_namespace(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_NameSpace_nci_find_sub(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_NameSpace_nci_find_var(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_NameSpace_nci_del_namespace(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_NameSpace_nci_del_sub(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_NameSpace_nci_del_var(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_NameSpace_nci_get_sym(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_NameSpace_nci_export_to(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_NameSpace_nci_get_parent(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_NameSpace_nci_get_class(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_NameSpace_nci_set_class(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_NameSpace_nci_get_associated_methods(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_NameSpace_nci_get_associated_vtable_methods(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_NameSpace_class_init(PARROT_INTERP, int, int);
+void    Parrot_NameSpace_ro_class_init(PARROT_INTERP, int, int);
+static  PMC  *
+Parrot_NameSpace_get_class(SHIM_INTERP, ARGMOD(PMC *_self))
+{
+#line 400 "./src/pmc/namespace.pmc"
+    return PARROT_NAMESPACE(_self)->_class;
+#line 403 "./src/pmc/namespace.c"
+}
+static  PMC  *
+Parrot_NameSpace_get_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 564 "./src/pmc/namespace.pmc"
+
+    PMC *ns = interp->vtables[enum_class_Hash]->get_pmc_keyed(interp, _self, key);
+    /* Is this equivalent?
+    PMC    *ns = interp->vtables[enum_class_Hash]->get_pmc_keyed(interp, _self, key);
+    */
+
+    if (!PMC_IS_NULL(ns))
+        return ns;
+
+    ns = _self;
+
+    if (key->vtable->base_type == enum_class_Key) {
+        STRING * const part = VTABLE_get_string(interp, key);
+        key                 = VTABLE_shift_pmc(interp, key);
+
+        if (!key)
+            return VTABLE_get_pmc_keyed_str(interp, ns, part);
+
+        ns = Parrot_ns_get_namespace_keyed_str(interp, ns, part);
+
+        if (PMC_IS_NULL(ns))
+            return PMCNULL;
+
+        return VTABLE_get_pmc_keyed(interp, ns, key);
+    }
+    else if (VTABLE_does(interp, key, CONST_STRING(interp, "array"))) {
+        const INTVAL elements = VTABLE_elements(interp, key);
+        INTVAL i;
+        for (i = 0; i < elements && !PMC_IS_NULL(ns); ++i) {
+            STRING * const name = VTABLE_get_string_keyed_int(interp, key, i);
+            if (STRING_IS_NULL(name)) {
+                ns = PMCNULL;
+                /* What to do here? Throw an exception or something? */
+                break;
+            }
+            ns = Parrot_ns_get_namespace_keyed_str(interp, ns, name);
+        }
+        return ns;
+    }
+    else {
+        STRING * const name = VTABLE_get_string(interp, key);
+        ns = Parrot_ns_get_namespace_keyed_str(interp, ns, name);
+        return ns;
+    }
+    /* If we get the wrong type, should we throw an exception?
+    Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_GLOBAL_NOT_FOUND,
+        "Invalid namespace key in get_pmc_keyed_str");
+    */
+#line 457 "./src/pmc/namespace.c"
+}
+static  PMC  *
+Parrot_NameSpace_get_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+#line 614 "./src/pmc/namespace.pmc"
+
+    Parrot_NameSpace_attributes * const nsinfo = PARROT_NAMESPACE(_self);
+    PMC              * const vtable = nsinfo->vtable;
+
+    if (PMC_IS_NULL(vtable))
+        return PMCNULL;
+
+    return VTABLE_get_pmc_keyed_int(interp, vtable, key);
+#line 471 "./src/pmc/namespace.c"
+}
+static  PMC  *
+Parrot_NameSpace_get_pmc_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key)
+{
+#line 550 "./src/pmc/namespace.pmc"
+
+    Hash * const hash = (Hash *)VTABLE_get_pointer(interp, _self);
+    PMC *ns = (PMC *)Parrot_hash_get(interp, hash, key);
+
+    if (!ns)
+        return PMCNULL;
+
+    if ((PObj_get_FLAGS(ns) & FPA_is_ns_ext) &&
+            ns->vtable->base_type == enum_class_FixedPMCArray)
+        ns = VTABLE_get_pmc_keyed_int(interp, ns, NS_slot_ns);
+
+    return ns;
+#line 489 "./src/pmc/namespace.c"
+}
+static  void  *
+Parrot_NameSpace_get_pointer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 658 "./src/pmc/namespace.pmc"
+
+    PMC    *ns = _self;
+
+    if (PMC_IS_NULL(key))
+        return PMCNULL;
+
+    switch (key->vtable->base_type) {
+        case enum_class_String:
+            return VTABLE_get_pointer_keyed_str(interp, _self, VTABLE_get_string(interp, key));
+        case enum_class_Key: {
+            /* this loop (and function) could use a rewrite for clarity */
+            while (1) {
+                STRING * const part = VTABLE_get_string(interp, key);
+                key                 = VTABLE_shift_pmc(interp, key);
+
+                if (!key)
+                    return VTABLE_get_pointer_keyed_str(interp, ns, part);
+
+                ns = Parrot_ns_get_namespace_keyed_str(interp, ns, part);
+
+                if (PMC_IS_NULL(ns))
+                    return PMCNULL;
+            }
+        }
+        case enum_class_ResizableStringArray: {
+            const INTVAL elements = VTABLE_elements(interp, key);
+            INTVAL i;
+            for (i = 0; i < elements; ++i)  {
+                STRING * const part = VTABLE_get_string_keyed_int(interp, key, i);
+
+                /* Last entry in the array */
+                if ((i + 1) >= elements)
+                    return VTABLE_get_pointer_keyed_str(interp, ns, part);
+
+                ns = Parrot_ns_get_namespace_keyed_str(interp, ns, part);
+
+                if (PMC_IS_NULL(ns))
+                    return PMCNULL;
+            }
+            return ns;
+        }
+        default:
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_GLOBAL_NOT_FOUND,
+                "Invalid namespace key of type '%S' in get_pointer_keyed",
+                key->vtable->whoami);
+    }
+#line 541 "./src/pmc/namespace.c"
+}
+static  void  *
+Parrot_NameSpace_get_pointer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key)
+{
+#line 642 "./src/pmc/namespace.pmc"
+
+    PMC  *ns;
+    Hash *hash;
+    GETATTR_NameSpace_hash(interp, _self, hash);
+
+    ns = (PMC *)Parrot_hash_get(interp, hash, key);
+
+    if (ns && (PObj_get_FLAGS(ns) & FPA_is_ns_ext)
+        && ns->vtable->base_type == enum_class_FixedPMCArray)
+        ns = VTABLE_get_pmc_keyed_int(interp, ns, NS_slot_var_sub);
+
+    /* Be extra careful about returning PMCNULL */
+    if (!ns) ns = PMCNULL;
+    #line 560 "./src/pmc/namespace.c"
+    return (PMC*)ns;
+#line 655 "./src/pmc/namespace.pmc"
+
+#line 564 "./src/pmc/namespace.c"
+}
+static  STRING  *
+Parrot_NameSpace_get_string(SHIM_INTERP, ARGMOD(PMC *_self))
+{
+#line 716 "./src/pmc/namespace.pmc"
+
+    const Parrot_NameSpace_attributes * const nsinfo = PARROT_NAMESPACE(_self);
+    return nsinfo->name;
+#line 573 "./src/pmc/namespace.c"
+}
+static  void 
+Parrot_NameSpace_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 362 "./src/pmc/namespace.pmc"
+
+    interp->vtables[enum_class_Hash]->init(interp, _self);
+    PARROT_NAMESPACE(_self)->vtable  = PMCNULL;
+    PARROT_NAMESPACE(_self)->methods = PMCNULL;
+    PARROT_NAMESPACE(_self)->_class  = PMCNULL;
+    PObj_custom_mark_SET(_self);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 586 "./src/pmc/namespace.c"
+}
+static  PMC  *
+Parrot_NameSpace_inspect_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *what)
+{
+#line 753 "./src/pmc/namespace.pmc"
+
+    const Parrot_NameSpace_attributes * const nsinfo = PARROT_NAMESPACE(_self);
+    PMC *found;
+
+    if (STRING_equal(interp, what, CONST_STRING(interp, "methods"))) {
+        found = nsinfo->methods;
+    }
+    else if (STRING_equal(interp, what, CONST_STRING(interp, "vtable_overrides"))) {
+        found = nsinfo->vtable;
+    }
+    else if (STRING_equal(interp, what, CONST_STRING(interp, "class"))) {
+        found = nsinfo->_class;
+    }
+    else
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "Unknown introspection value '%S'", what);
+
+    /* return found value */
+    if (PMC_IS_NULL(found))
+        return PMCNULL;
+
+    return found;
+#line 614 "./src/pmc/namespace.c"
+}
+static  void 
+Parrot_NameSpace_mark(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 379 "./src/pmc/namespace.pmc"
+
+    Parrot_NameSpace_attributes * const nsinfo = PARROT_NAMESPACE(_self);
+
+    interp->vtables[enum_class_Hash]->mark(interp, _self);
+    Parrot_gc_mark_PMC_alive(interp, nsinfo->parent);
+    Parrot_gc_mark_PMC_alive(interp, nsinfo->_class);
+    Parrot_gc_mark_PMC_alive(interp, nsinfo->vtable);
+    Parrot_gc_mark_PMC_alive(interp, nsinfo->methods);
+    Parrot_gc_mark_STRING_alive(interp, nsinfo->name);
+#line 629 "./src/pmc/namespace.c"
+}
+static  void 
+Parrot_NameSpace_set_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, PMC *value)
+{
+#line 507 "./src/pmc/namespace.pmc"
+
+    PMC *ns = _self;
+
+    if (key->vtable->base_type == enum_class_String) {
+        VTABLE_set_pmc_keyed_str(interp, _self, VTABLE_get_string(interp, key), value);
+        return;
+    }
+
+    if (key->vtable->base_type == enum_class_Key) {
+        while (1) {
+            STRING * const part = VTABLE_get_string(interp, key);
+            key                 = VTABLE_shift_pmc(interp, key);
+
+            if (!key) {
+                Parrot_ns_set_global(interp, ns, part, value);
+                PARROT_GC_WRITE_BARRIER(interp, _self);
+                return;
+            }
+
+            ns = Parrot_ns_make_namespace_keyed_str(interp, ns, part);
+        }
+    }
+
+    if (key->vtable->base_type == enum_class_ResizableStringArray) {
+        const INTVAL elements = VTABLE_elements(interp, key);
+        INTVAL i;
+        for (i = 0; i < elements; ++i)  {
+            STRING * const part = VTABLE_get_string_keyed_int(interp, key, i);
+
+            if ((i + 1) >= elements) { /* Last entry in the array */
+                Parrot_ns_set_global(interp, ns, part, value);
+                PARROT_GC_WRITE_BARRIER(interp, _self);
+                return;
+            }
+
+            ns = Parrot_ns_make_namespace_keyed_str(interp, ns, part);
+        }
+    }
+
+    Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_GLOBAL_NOT_FOUND,
+        "Invalid namespace key in set_pmc_keyed");
+#line 676 "./src/pmc/namespace.c"
+}
+static  void 
+Parrot_NameSpace_set_pmc_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key, PMC *value)
+{
+#line 438 "./src/pmc/namespace.pmc"
+
+    PMC        *new_tuple = NULL;
+    const int   val_is_NS = PMC_IS_NULL(value)
+                          ? 0
+                          :value->vtable->base_type == enum_class_NameSpace;
+
+    /* don't need this everywhere yet */
+    PMC *old;
+
+    /* If it's a sub... */
+    if (maybe_add_sub_to_namespace(interp, _self, key, value))
+        return;
+
+    /* If it's an native method */
+    add_native_to_namespace(interp, _self, key, value);
+
+    /* If it's a multi-sub and the first in this NS... */
+    add_multi_to_namespace(interp, _self, key, value);
+
+    old = (PMC *)Parrot_hash_get(interp, (Hash *)VTABLE_get_pointer(interp, _self), key);
+
+    if (!old)
+        interp->vtables[enum_class_Hash]->set_pmc_keyed_str(interp, _self, key, value);
+    else {
+        if ((old->vtable->base_type == enum_class_NameSpace) == val_is_NS) {
+            /* simple ns or simple var/sub changed */
+            interp->vtables[enum_class_Hash]->set_pmc_keyed_str(interp, _self, key, value);
+        }
+        else if ((PObj_get_FLAGS(old) & FPA_is_ns_ext) &&
+                old->vtable->base_type == enum_class_FixedPMCArray) {
+            /* we have a tuple extension already */
+            VTABLE_set_pmc_keyed_int(interp, old,
+                    val_is_NS ? NS_slot_ns : NS_slot_var_sub,
+                    value);
+        }
+        else {
+            /* create new tuple */
+            /* for a fully typed namespace, we'd need 3 or 4 */
+            new_tuple = Parrot_pmc_new_init_int(interp,
+                    enum_class_FixedPMCArray, NS_max_slots);
+
+            /* flag it as special */
+            PObj_get_FLAGS(new_tuple) |= FPA_is_ns_ext;
+        }
+    }
+
+    if (val_is_NS) {
+        /* TODO - this hack needs to go */
+        Parrot_NameSpace_attributes * const nsinfo = PARROT_NAMESPACE(value);
+        nsinfo->parent = _self;  /* set parent */
+        nsinfo->name   = key;   /* and name */
+
+        if (new_tuple) {
+            VTABLE_set_pmc_keyed_int(interp, new_tuple, NS_slot_ns, value);
+            VTABLE_set_pmc_keyed_int(interp, new_tuple, NS_slot_var_sub,
+                                     old);
+
+            Parrot_hash_put(interp, (Hash *)VTABLE_get_pointer(interp, _self), key, new_tuple);
+            /* distinction from a plain FPA, which doesn't extend the
+             * namespace storage */
+        }
+    }
+    else if (new_tuple) {
+        VTABLE_set_pmc_keyed_int(interp, new_tuple, NS_slot_ns, old);
+        VTABLE_set_pmc_keyed_int(interp, new_tuple, NS_slot_var_sub, value);
+        Parrot_hash_put(interp, (Hash *)VTABLE_get_pointer(interp, _self), key, new_tuple);
+    }
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 750 "./src/pmc/namespace.c"
+}
+static  void
+Parrot_NameSpace_nci_make_namespace(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* key;
+    
+    const INTVAL arity = 2; /* "PiP" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    key = VTABLE_get_pmc_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 796 "./src/pmc/namespace.pmc"
+
+    PMC *ns = Parrot_ns_get_namespace_keyed(interp, _self, key);
+    if (PMC_IS_NULL(ns)) {
+        ns = Parrot_ns_make_namespace_keyed(interp, _self, key);
+    }
+    #line 778 "./src/pmc/namespace.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)ns);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return;
+     }
+#line 801 "./src/pmc/namespace.pmc"
+
+#line 786 "./src/pmc/namespace.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_NameSpace_nci_add_namespace(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* name;
+    PMC* _namespace;
+    
+    const INTVAL arity = 3; /* "PiSP" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    name = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+    _namespace = VTABLE_get_pmc_keyed_int(interp, _call_object, 2);
+
+    { /* BEGIN PMETHOD BODY */
+#line 815 "./src/pmc/namespace.pmc"
+
+    STRING * const s_ns = CONST_STRING(interp, "NameSpace");
+
+    if (!VTABLE_isa(interp, _namespace, s_ns))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "Invalid type %d in add_namespace()",
+            _namespace->vtable->base_type);
+
+    VTABLE_set_pmc_keyed_str(interp, _self, name, _namespace);
+#line 827 "./src/pmc/namespace.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_NameSpace_nci_add_sub(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* name;
+    PMC* sub;
+    
+    const INTVAL arity = 3; /* "PiSP" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    name = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+    sub = VTABLE_get_pmc_keyed_int(interp, _call_object, 2);
+
+    { /* BEGIN PMETHOD BODY */
+#line 837 "./src/pmc/namespace.pmc"
+
+    STRING * const s_sub      = CONST_STRING(interp, "Sub");
+    STRING * const s_multisub = CONST_STRING(interp, "MultiSub");
+
+    if (!VTABLE_isa(interp, sub, s_sub)
+    &&  !VTABLE_isa(interp, sub, s_multisub))
+        Parrot_ex_throw_from_c_args(interp, NULL,
+            EXCEPTION_INVALID_OPERATION,
+            "Invalid type %d in add_sub()", sub->vtable->base_type);
+
+    VTABLE_set_pmc_keyed_str(interp, _self, name, sub);
+#line 870 "./src/pmc/namespace.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_NameSpace_nci_add_var(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* name;
+    PMC* var;
+    
+    const INTVAL arity = 3; /* "PiSP" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    name = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+    var = VTABLE_get_pmc_keyed_int(interp, _call_object, 2);
+
+    { /* BEGIN PMETHOD BODY */
+#line 860 "./src/pmc/namespace.pmc"
+
+    VTABLE_set_pmc_keyed_str(interp, _self, name, var);
+#line 904 "./src/pmc/namespace.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_NameSpace_nci_get_name(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 877 "./src/pmc/namespace.pmc"
+
+    PMC * const ar = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    INTVAL elements = 0;
+    PMC *ns        = _self;
+
+    while (ns) {
+        Parrot_NameSpace_attributes *nsinfo = PARROT_NAMESPACE(ns);
+        VTABLE_unshift_string(interp, ar, nsinfo->name);
+        ns = nsinfo->parent;
+        ++elements;
+    }
+
+    /* remove the NULL string of the namespace root */
+    if (elements > 0)
+        VTABLE_shift_string(interp, ar);
+
+    #line 948 "./src/pmc/namespace.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)ar);
+        
+        return;
+     }
+#line 893 "./src/pmc/namespace.pmc"
+
+#line 956 "./src/pmc/namespace.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_NameSpace_nci_find_namespace(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* key;
+    
+    const INTVAL arity = 2; /* "PiS" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    key = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 905 "./src/pmc/namespace.pmc"
+
+    STRING * const s_ns = CONST_STRING(interp, "NameSpace");
+    PMC    * const ns   = (PMC *)Parrot_hash_get(interp, (Hash *)_self->vtable->get_pointer(interp, _self),
+                                                 key);
+
+    if (!ns)
+        #line 992 "./src/pmc/namespace.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)PMCNULL);
+        
+        return;
+     }
+#line 911 "./src/pmc/namespace.pmc"
+
+
+    /* it's a NameSpace */
+    if (VTABLE_isa(interp, ns, s_ns))
+        #line 1003 "./src/pmc/namespace.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)ns);
+        
+        return;
+     }
+#line 915 "./src/pmc/namespace.pmc"
+
+
+    #line 1012 "./src/pmc/namespace.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)PMCNULL);
+        
+        return;
+     }
+#line 917 "./src/pmc/namespace.pmc"
+
+#line 1020 "./src/pmc/namespace.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_NameSpace_nci_find_sub(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* key;
+    
+    const INTVAL arity = 2; /* "PiS" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    key = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 930 "./src/pmc/namespace.pmc"
+
+    STRING * const s_sub = CONST_STRING(interp, "Sub");
+    PMC    * const sub   = (PMC *)Parrot_hash_get(interp, (Hash *)_self->vtable->get_pointer(interp, _self),
+                                                  key);
+
+    if (!sub)
+        #line 1056 "./src/pmc/namespace.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)PMCNULL);
+        
+        return;
+     }
+#line 936 "./src/pmc/namespace.pmc"
+
+
+    /* it's a Sub */
+    if (VTABLE_isa(interp, sub, s_sub))
+        #line 1067 "./src/pmc/namespace.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)sub);
+        
+        return;
+     }
+#line 940 "./src/pmc/namespace.pmc"
+
+
+    #line 1076 "./src/pmc/namespace.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)PMCNULL);
+        
+        return;
+     }
+#line 942 "./src/pmc/namespace.pmc"
+
+#line 1084 "./src/pmc/namespace.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_NameSpace_nci_find_var(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* key;
+    
+    const INTVAL arity = 2; /* "PiS" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    key = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 955 "./src/pmc/namespace.pmc"
+
+    PMC * const val = (PMC *)Parrot_hash_get(interp, (Hash *)_self->vtable->get_pointer(interp, _self), key);
+
+    if (!val)
+        #line 1118 "./src/pmc/namespace.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)PMCNULL);
+        
+        return;
+     }
+#line 959 "./src/pmc/namespace.pmc"
+
+
+    #line 1127 "./src/pmc/namespace.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)val);
+        
+        return;
+     }
+#line 961 "./src/pmc/namespace.pmc"
+
+#line 1135 "./src/pmc/namespace.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_NameSpace_nci_del_namespace(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* name;
+    
+    const INTVAL arity = 2; /* "PiS" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    name = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 976 "./src/pmc/namespace.pmc"
+
+    Hash   * const hash = (Hash *)_self->vtable->get_pointer(interp, _self);
+    PMC    * const ns   = (PMC *)Parrot_hash_get(interp, hash, name);
+    STRING * const s_ns = CONST_STRING(interp, "NameSpace");
+
+    if (PMC_IS_NULL(ns))
+        #line 1171 "./src/pmc/namespace.c"
+    {
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return;
+    }
+#line 982 "./src/pmc/namespace.pmc"
+
+
+    if (!VTABLE_isa(interp, ns, s_ns))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "Invalid type %d for '%Ss' in del_namespace()",
+            ns->vtable->base_type, name);
+
+    Parrot_hash_delete(interp, hash, name);
+#line 1185 "./src/pmc/namespace.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_NameSpace_nci_del_sub(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* name;
+    
+    const INTVAL arity = 2; /* "PiS" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    name = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 1004 "./src/pmc/namespace.pmc"
+
+    Hash   * const hash  = (Hash *)_self->vtable->get_pointer(interp, _self);
+    PMC    * const sub   = (PMC *)Parrot_hash_get(interp, hash, name);
+    STRING * const s_sub = CONST_STRING(interp, "Sub");
+
+    if (PMC_IS_NULL(sub))
+        #line 1221 "./src/pmc/namespace.c"
+    {
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return;
+    }
+#line 1010 "./src/pmc/namespace.pmc"
+
+
+    if (!VTABLE_isa(interp, sub, s_sub))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "Invalid type %d for '%Ss' in del_sub()",
+            sub->vtable->base_type, name);
+
+    Parrot_hash_delete(interp, hash, name);
+#line 1235 "./src/pmc/namespace.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_NameSpace_nci_del_var(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* name;
+    
+    const INTVAL arity = 2; /* "PiS" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    name = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 1030 "./src/pmc/namespace.pmc"
+
+    Parrot_hash_delete(interp, (Hash *)_self->vtable->get_pointer(interp, _self), name);
+#line 1267 "./src/pmc/namespace.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_NameSpace_nci_get_sym(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* key;
+    
+    const INTVAL arity = 2; /* "PiS" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    key = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 1045 "./src/pmc/namespace.pmc"
+
+    PMC *ns = (PMC *)Parrot_hash_get(interp, (Hash *)_self->vtable->get_pointer(interp, _self), key);
+
+    if (!ns)
+        #line 1301 "./src/pmc/namespace.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)PMCNULL);
+        
+        return;
+     }
+#line 1049 "./src/pmc/namespace.pmc"
+
+
+    /* it's a NameSpace */
+    if (ns->vtable == _self->vtable)
+        #line 1312 "./src/pmc/namespace.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)PMCNULL);
+        
+        return;
+     }
+#line 1053 "./src/pmc/namespace.pmc"
+
+
+    if ((PObj_get_FLAGS(ns) & FPA_is_ns_ext)
+    &&  ns->vtable->base_type == enum_class_FixedPMCArray)
+        ns = VTABLE_get_pmc_keyed_int(interp, ns, NS_slot_var_sub);
+
+    #line 1325 "./src/pmc/namespace.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)ns);
+        
+        return;
+     }
+#line 1059 "./src/pmc/namespace.pmc"
+
+#line 1333 "./src/pmc/namespace.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_NameSpace_nci_export_to(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* dest;
+    PMC* what;
+    
+    const INTVAL arity = 3; /* "PiPP" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    dest = VTABLE_get_pmc_keyed_int(interp, _call_object, 1);
+    what = VTABLE_get_pmc_keyed_int(interp, _call_object, 2);
+
+    { /* BEGIN PMETHOD BODY */
+#line 1082 "./src/pmc/namespace.pmc"
+
+    STRING * const s_hash  = CONST_STRING(interp, "hash");
+    STRING * const s_array = CONST_STRING(interp, "array");
+
+    if (PMC_IS_NULL(dest))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "destination namespace not specified");
+
+    if (PMC_IS_NULL(what) || !VTABLE_elements(interp, what))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_UNIMPLEMENTED,
+            "exporting default object set not yet implemented");
+
+    /* if "what" does "hash", we extract string key/value pairs,
+     * lookup the object with the name specified in the key,
+     * and export it with the name specified as value. */
+    if (VTABLE_does(interp, what, s_hash)) {
+        PMC * const  iter = VTABLE_get_iter(interp, what);
+        const INTVAL n    = VTABLE_elements(interp, what);
+        INTVAL       i;
+
+        for (i = 0; i < n; ++i) {
+            STRING *dest_name;
+            PMC    *object;
+            STRING * const src_name = VTABLE_shift_string(interp, iter);
+
+            if (STRING_IS_NULL(src_name) || STRING_IS_EMPTY(src_name))
+                Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+                    "source object name not specified");
+
+            if (PMC_IS_NULL(VTABLE_get_pmc_keyed_str(interp, what, src_name))) {
+                dest_name = src_name;
+            }
+            else {
+                dest_name = VTABLE_get_string_keyed_str(interp, what, src_name);
+                if (STRING_IS_NULL(dest_name) || STRING_IS_EMPTY(dest_name))
+                    dest_name = src_name;
+            }
+
+            object = VTABLE_get_pmc_keyed_str(interp, _self, src_name);
+
+            if (PMC_IS_NULL(object))
+                Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_GLOBAL_NOT_FOUND,
+                    "object '%Ss' not found in current namespace", src_name);
+
+            VTABLE_set_pmc_keyed_str(interp, dest, dest_name, object);
+        }
+    }
+    else if (VTABLE_does(interp, what, s_array)) {
+        const INTVAL n = VTABLE_elements(interp, what);
+        INTVAL       i;
+
+        for (i = 0; i < n; ++i) {
+            PMC    *object;
+            STRING * const name = VTABLE_get_string_keyed_int(interp, what, i);
+
+            if (STRING_IS_NULL(name) || STRING_IS_EMPTY(name))
+                Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+                    "object name not specified");
+
+            object = VTABLE_get_pmc_keyed_str(interp, _self, name);
+
+            if (PMC_IS_NULL(object))
+                Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_GLOBAL_NOT_FOUND,
+                    "object '%Ss' not found in current namespace", name);
+
+            VTABLE_set_pmc_keyed_str(interp, dest, name, object);
+        }
+    }
+    else
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "can't handle argument of type %Ss", what->vtable->whoami);
+#line 1436 "./src/pmc/namespace.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_NameSpace_nci_get_parent(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 1165 "./src/pmc/namespace.pmc"
+
+    PMC * const parent = PARROT_NAMESPACE(_self)->parent ?
+                             PARROT_NAMESPACE(_self)->parent : PMCNULL;
+    #line 1467 "./src/pmc/namespace.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)parent);
+        
+        return;
+     }
+#line 1168 "./src/pmc/namespace.pmc"
+
+#line 1475 "./src/pmc/namespace.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_NameSpace_nci_get_class(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 1181 "./src/pmc/namespace.pmc"
+
+    const Parrot_NameSpace_attributes * const nsinfo = PARROT_NAMESPACE(_self);
+    PMC              *ret_class     = nsinfo->_class;
+
+    if (PMC_IS_NULL(ret_class))
+        ret_class = PMCNULL;
+
+    #line 1510 "./src/pmc/namespace.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)ret_class);
+        
+        return;
+     }
+#line 1188 "./src/pmc/namespace.pmc"
+
+#line 1518 "./src/pmc/namespace.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_NameSpace_nci_set_class(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* class_or_role;
+    
+    const INTVAL arity = 2; /* "PiP" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    class_or_role = VTABLE_get_pmc_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 1201 "./src/pmc/namespace.pmc"
+
+    PARROT_ASSERT_INTERP(class_or_role, interp);
+    PARROT_NAMESPACE(_self)->_class = class_or_role;
+#line 1551 "./src/pmc/namespace.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_NameSpace_nci_get_associated_methods(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 1217 "./src/pmc/namespace.pmc"
+
+    Parrot_NameSpace_attributes * const nsinfo  = PARROT_NAMESPACE(_self);
+    PMC              * const ret_methods = nsinfo->methods;
+
+    nsinfo->methods = PMCNULL;
+
+    #line 1585 "./src/pmc/namespace.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)ret_methods);
+        
+        return;
+     }
+#line 1223 "./src/pmc/namespace.pmc"
+
+#line 1593 "./src/pmc/namespace.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_NameSpace_nci_get_associated_vtable_methods(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 1237 "./src/pmc/namespace.pmc"
+
+    Parrot_NameSpace_attributes * const nsinfo      = PARROT_NAMESPACE(_self);
+    PMC              * const ret_methods = nsinfo->vtable;
+
+    nsinfo->vtable = PMCNULL;
+
+    #line 1627 "./src/pmc/namespace.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)ret_methods);
+        
+        return;
+     }
+#line 1243 "./src/pmc/namespace.pmc"
+
+#line 1635 "./src/pmc/namespace.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_NameSpace_update_vtable(VTABLE *vt) {
+    vt->get_class = Parrot_NameSpace_get_class;
+    vt->get_pmc_keyed = Parrot_NameSpace_get_pmc_keyed;
+    vt->get_pmc_keyed_int = Parrot_NameSpace_get_pmc_keyed_int;
+    vt->get_pmc_keyed_str = Parrot_NameSpace_get_pmc_keyed_str;
+    vt->get_pointer_keyed = Parrot_NameSpace_get_pointer_keyed;
+    vt->get_pointer_keyed_str = Parrot_NameSpace_get_pointer_keyed_str;
+    vt->get_string = Parrot_NameSpace_get_string;
+    vt->init = Parrot_NameSpace_init;
+    vt->inspect_str = Parrot_NameSpace_inspect_str;
+    vt->mark = Parrot_NameSpace_mark;
+    vt->set_pmc_keyed = Parrot_NameSpace_set_pmc_keyed;
+    vt->set_pmc_keyed_str = Parrot_NameSpace_set_pmc_keyed_str;
+    vt->attr_size = sizeof(Parrot_NameSpace_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_NameSpace_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->get_class = Parrot_NameSpace_get_class;
+    vt->get_pmc_keyed = Parrot_NameSpace_get_pmc_keyed;
+    vt->get_pmc_keyed_int = Parrot_NameSpace_get_pmc_keyed_int;
+    vt->get_pmc_keyed_str = Parrot_NameSpace_get_pmc_keyed_str;
+    vt->get_pointer_keyed = Parrot_NameSpace_get_pointer_keyed;
+    vt->get_pointer_keyed_str = Parrot_NameSpace_get_pointer_keyed_str;
+    vt->get_string = Parrot_NameSpace_get_string;
+    vt->inspect_str = Parrot_NameSpace_inspect_str;
+    vt->mark = Parrot_NameSpace_mark;
+    vt->attr_size = sizeof(Parrot_NameSpace_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_NameSpace_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_Hash_get_vtable(interp);
+    Parrot_NameSpace_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_NameSpace_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_Hash_ro_get_vtable(interp);
+    Parrot_NameSpace_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_NameSpace_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+    mro = Parrot_Hash_get_mro(interp, mro);
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "NameSpace"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_NameSpace_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    isa = Parrot_Hash_get_isa(interp, isa);
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "NameSpace")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_NameSpace_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        ":hash Sname F_class Fmethods Fvtable Fparent ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_NameSpace_get_vtable(interp);
+        vt->base_type      = enum_class_NameSpace;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "NameSpace");
+        vt->provides_str = CONST_STRING_GEN(interp, "hash");
+        vt->isa_hash     = Parrot_NameSpace_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_NameSpace_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_NameSpace;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_NameSpace_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "make_namespace");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_NameSpace_nci_make_namespace),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "add_namespace");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_NameSpace_nci_add_namespace),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "add_sub");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_NameSpace_nci_add_sub),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "add_var");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_NameSpace_nci_add_var),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "get_name");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_NameSpace_nci_get_name),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "find_namespace");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_NameSpace_nci_find_namespace),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "find_sub");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_NameSpace_nci_find_sub),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "find_var");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_NameSpace_nci_find_var),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "del_namespace");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_NameSpace_nci_del_namespace),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "del_sub");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_NameSpace_nci_del_sub),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "del_var");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_NameSpace_nci_del_var),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "get_sym");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_NameSpace_nci_get_sym),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "export_to");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_NameSpace_nci_export_to),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "get_parent");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_NameSpace_nci_get_parent),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "get_class");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_NameSpace_nci_get_class),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "set_class");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_NameSpace_nci_set_class),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "get_associated_methods");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_NameSpace_nci_get_associated_methods),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "get_associated_vtable_methods");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_NameSpace_nci_get_associated_vtable_methods),
+                method_name, signature);
+        }
+        {
+        }
+    } /* pass */
+} /* Parrot_NameSpace_class_init */
+
+#line 1245 "./src/pmc/namespace.pmc"
+
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<docs/pdds/pdd21_namespaces.pod>
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
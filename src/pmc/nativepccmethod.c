@@ -0,0 +1,363 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/nativepccmethod.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_fixedintegerarray.h"
+#include "pmc_nativepccmethod.h"
+#include "pmc_default.h"
+#include "nativepccmethod.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/nativepccmethod.pmc"
+/*
+Copyright (C) 2010-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/nativepccmethod.pmc - NativePCCMethod PMC
+
+=head1 DESCRIPTION
+
+Container for native functions that handle PCC, the Parrot Calling Convention,
+on their own.
+
+=head2 Methods
+
+=over 4
+
+=cut
+
+*/
+
+/* HEADERIZER HFILE: none */
+#line 45 "./src/pmc/nativepccmethod.c"
+static  PMC  * Parrot_NativePCCMethod_clone(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_NativePCCMethod_defined(SHIM_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_NativePCCMethod_get_bool(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  * Parrot_NativePCCMethod_get_pointer(SHIM_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_NativePCCMethod_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  opcode_t  * Parrot_NativePCCMethod_invoke(PARROT_INTERP, ARGMOD(PMC *_self), void *next);
+static  void  Parrot_NativePCCMethod_mark(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_NativePCCMethod_set_pointer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *sig, void *func);
+static  void Parrot_NativePCCMethod_nci_get_multisig(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_NativePCCMethod_class_init(PARROT_INTERP, int, int);
+void    Parrot_NativePCCMethod_ro_class_init(PARROT_INTERP, int, int);
+static  PMC  *
+Parrot_NativePCCMethod_clone(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 169 "./src/pmc/nativepccmethod.pmc"
+
+    PMC * const ret = Parrot_pmc_new(interp, _self->vtable->base_type);
+    const Parrot_NativePCCMethod_attributes * const self_attrs = PARROT_NATIVEPCCMETHOD(_self);
+    Parrot_NativePCCMethod_attributes * const ret_attrs  = PARROT_NATIVEPCCMETHOD(ret);
+
+    ret_attrs->func               = self_attrs->func;
+    ret_attrs->signature          = self_attrs->signature;
+    ret_attrs->mmd_long_signature = self_attrs->mmd_long_signature;
+    ret_attrs->mmd_multi_sig      = self_attrs->mmd_multi_sig;
+
+    return ret;
+#line 72 "./src/pmc/nativepccmethod.c"
+}
+static  INTVAL 
+Parrot_NativePCCMethod_defined(SHIM_INTERP, ARGMOD(PMC *_self))
+{
+#line 89 "./src/pmc/nativepccmethod.pmc"
+    return !! PARROT_NATIVEPCCMETHOD(_self)->func;
+#line 79 "./src/pmc/nativepccmethod.c"
+}
+static  INTVAL 
+Parrot_NativePCCMethod_get_bool(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 94 "./src/pmc/nativepccmethod.pmc"
+
+    return Parrot_NativePCCMethod_defined(interp, _self);
+#line 87 "./src/pmc/nativepccmethod.c"
+}
+static  void  *
+Parrot_NativePCCMethod_get_pointer(SHIM_INTERP, ARGMOD(PMC *_self))
+{
+#line 67 "./src/pmc/nativepccmethod.pmc"
+    return PARROT_NATIVEPCCMETHOD(_self)->func;
+#line 94 "./src/pmc/nativepccmethod.c"
+}
+static  void 
+Parrot_NativePCCMethod_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 41 "./src/pmc/nativepccmethod.pmc"
+
+    Parrot_NativePCCMethod_attributes * const attrs = PARROT_NATIVEPCCMETHOD(_self);
+
+    attrs->func               = NULL;
+    attrs->signature          = STRINGNULL;
+    attrs->mmd_long_signature = STRINGNULL;
+    attrs->mmd_multi_sig      = PMCNULL;
+
+    PObj_custom_mark_SET(_self);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 110 "./src/pmc/nativepccmethod.c"
+}
+static  opcode_t  *
+Parrot_NativePCCMethod_invoke(PARROT_INTERP, ARGMOD(PMC *_self), void *next)
+{
+#line 108 "./src/pmc/nativepccmethod.pmc"
+
+    void                *func;
+    native_pcc_method_t  fptr;
+
+    GETATTR_NativePCCMethod_func(interp, _self, func);
+    if (!func)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                EXCEPTION_INVALID_OPERATION,
+                "attempt to call NULL native function");
+
+    fptr = (native_pcc_method_t)D2FPTR(func);
+    fptr(interp, _self);
+
+    /*
+     * If this function was tailcalled, the return result
+     * is already passed back to the caller of this frame.
+     * We therefore invoke the return continuation here,
+     * which gets rid of this frame and returns the real
+     * return address.
+     */
+    {
+        PMC *cont = interp->current_cont;
+
+        if (!PMC_IS_NULL(cont)
+        && (PObj_get_FLAGS(cont) & SUB_FLAG_TAILCALL)) {
+            cont = Parrot_pcc_get_continuation(interp, CURRENT_CONTEXT(interp));
+            next = VTABLE_invoke(interp, cont, next);
+        }
+    }
+
+    return (opcode_t *)next;
+#line 147 "./src/pmc/nativepccmethod.c"
+}
+static  void 
+Parrot_NativePCCMethod_mark(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 151 "./src/pmc/nativepccmethod.pmc"
+
+    const Parrot_NativePCCMethod_attributes * const attrs = PARROT_NATIVEPCCMETHOD(_self);
+
+    Parrot_gc_mark_STRING_alive(interp, attrs->signature);
+    Parrot_gc_mark_STRING_alive(interp, attrs->mmd_long_signature);
+    Parrot_gc_mark_PMC_alive(interp,    attrs->mmd_multi_sig);
+#line 159 "./src/pmc/nativepccmethod.c"
+}
+static  void 
+Parrot_NativePCCMethod_set_pointer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *sig, void *func)
+{
+#line 72 "./src/pmc/nativepccmethod.pmc"
+
+    PARROT_NATIVEPCCMETHOD(_self)->signature = sig;
+    PARROT_NATIVEPCCMETHOD(_self)->func = func;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 169 "./src/pmc/nativepccmethod.c"
+}
+static  void
+Parrot_NativePCCMethod_nci_get_multisig(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 192 "./src/pmc/nativepccmethod.pmc"
+
+    PMC *sig;
+    GETATTR_NativePCCMethod_mmd_multi_sig(interp, _self, sig);
+    if (PMC_IS_NULL(sig))
+        sig = PMCNULL;
+    #line 195 "./src/pmc/nativepccmethod.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)sig);
+        
+        return;
+     }
+#line 197 "./src/pmc/nativepccmethod.pmc"
+
+#line 203 "./src/pmc/nativepccmethod.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_NativePCCMethod_update_vtable(VTABLE *vt) {
+    vt->clone = Parrot_NativePCCMethod_clone;
+    vt->defined = Parrot_NativePCCMethod_defined;
+    vt->get_bool = Parrot_NativePCCMethod_get_bool;
+    vt->get_pointer = Parrot_NativePCCMethod_get_pointer;
+    vt->init = Parrot_NativePCCMethod_init;
+    vt->invoke = Parrot_NativePCCMethod_invoke;
+    vt->mark = Parrot_NativePCCMethod_mark;
+    vt->set_pointer_keyed_str = Parrot_NativePCCMethod_set_pointer_keyed_str;
+    vt->attr_size = sizeof(Parrot_NativePCCMethod_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_NativePCCMethod_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->clone = Parrot_NativePCCMethod_clone;
+    vt->defined = Parrot_NativePCCMethod_defined;
+    vt->get_bool = Parrot_NativePCCMethod_get_bool;
+    vt->get_pointer = Parrot_NativePCCMethod_get_pointer;
+    vt->invoke = Parrot_NativePCCMethod_invoke;
+    vt->mark = Parrot_NativePCCMethod_mark;
+    vt->attr_size = sizeof(Parrot_NativePCCMethod_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_NativePCCMethod_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_NativePCCMethod_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_NativePCCMethod_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_NativePCCMethod_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_NativePCCMethod_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "NativePCCMethod"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_NativePCCMethod_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "NativePCCMethod")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_NativePCCMethod_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "Ssignature :func Smmd_long_signature Fmmd_multi_sig ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_NativePCCMethod_get_vtable(interp);
+        vt->base_type      = enum_class_NativePCCMethod;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "NativePCCMethod");
+        vt->provides_str = CONST_STRING_GEN(interp, "invokable");
+        vt->isa_hash     = Parrot_NativePCCMethod_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_NativePCCMethod_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_NativePCCMethod;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_NativePCCMethod_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "get_multisig");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_NativePCCMethod_nci_get_multisig),
+                method_name, signature);
+        }
+        {
+        }
+    } /* pass */
+} /* Parrot_NativePCCMethod_class_init */
+
+#line 198 "./src/pmc/nativepccmethod.pmc"
+
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<docs/pdds/pdd03_calling_conventions.pod>.
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
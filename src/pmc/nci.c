@@ -0,0 +1,535 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/nci.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_fixedintegerarray.h"
+#include "pmc_nci.h"
+#include "pmc_default.h"
+#include "nci.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/nci.pmc"
+/*
+Copyright (C) 2001-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/nci.pmc - NCI PMC
+
+=head1 DESCRIPTION
+
+The vtable functions for the Native Call Interface, to call
+native C functions.
+
+=head2 Methods
+
+=over 4
+
+=cut
+
+*/
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+PARROT_IGNORABLE_RESULT
+static nci_thunk_t /*@alt void@*/
+build_func(PARROT_INTERP,
+    ARGIN(PMC *obj),
+    ARGMOD(Parrot_NCI_attributes *nci))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*nci);
+
+#define ASSERT_ARGS_build_func __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(obj) \
+    , PARROT_ASSERT_ARG(nci))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+/*
+
+=item C<static nci_thunk_t build_func(PARROT_INTERP, PMC *obj,
+Parrot_NCI_attributes *nci)>
+
+Actually build the NCI thunk.
+
+=cut
+
+*/
+
+PARROT_IGNORABLE_RESULT
+static nci_thunk_t
+build_func(PARROT_INTERP, ARGIN(PMC *obj), ARGMOD(Parrot_NCI_attributes *nci))
+{
+    ASSERT_ARGS(build_func)
+
+    Parrot_nci_sig_to_pcc(interp, nci->signature,
+                            &nci->pcc_params_signature,
+                            &nci->pcc_return_signature);
+
+    /* Arity is length of the signature minus one (the return type). */
+    nci->arity       = VTABLE_elements(interp, nci->signature) - 1;
+
+    /* Build call function. */
+    nci->fb_info     = build_call_func(interp, nci->signature);
+    nci->func        = F2DPTR(VTABLE_get_pointer(interp, nci->fb_info));
+    PARROT_GC_WRITE_BARRIER(interp, obj);
+
+    return (nci_thunk_t)nci->func;
+}
+#line 96 "./src/pmc/nci.c"
+static  PMC  * Parrot_NCI_clone(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_NCI_defined(SHIM_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_NCI_get_bool(SHIM_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_NCI_get_integer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  * Parrot_NCI_get_pointer(SHIM_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_NCI_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  opcode_t  * Parrot_NCI_invoke(PARROT_INTERP, ARGMOD(PMC *_self), void *next);
+static  void  Parrot_NCI_mark(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_NCI_set_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, PMC *p);
+static  void  Parrot_NCI_set_pmc_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key, PMC *p);
+static  void  Parrot_NCI_set_pointer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, void *func);
+static  void  Parrot_NCI_set_pointer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key, void *func);
+static  void Parrot_NCI_nci_get_multisig(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_NCI_nci_arity(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_NCI_class_init(PARROT_INTERP, int, int);
+void    Parrot_NCI_ro_class_init(PARROT_INTERP, int, int);
+static  PMC  *
+Parrot_NCI_clone(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 204 "./src/pmc/nci.pmc"
+
+    Parrot_NCI_attributes * const nci_info_self = PARROT_NCI(_self);
+
+    PMC * const ret     = Parrot_pmc_new(interp, _self->vtable->base_type);
+    Parrot_NCI_attributes * const nci_info_ret = PARROT_NCI(ret);
+
+    /* FIXME if data is malloced (JIT/i386!) then we need
+     * the length of data here, to memcpy it. ManagedStruct or Buffer?
+     */
+    nci_info_ret->func                  = nci_info_self->func;
+    nci_info_ret->fb_info               = nci_info_self->fb_info;
+    nci_info_ret->orig_func             = nci_info_self->orig_func;
+    nci_info_ret->signature             = nci_info_self->signature;
+    nci_info_ret->pcc_params_signature  = nci_info_self->pcc_params_signature;
+    nci_info_ret->pcc_return_signature  = nci_info_self->pcc_params_signature;
+    nci_info_ret->arity                 = nci_info_self->arity;
+    PObj_get_FLAGS(ret)                 = PObj_get_FLAGS(_self);
+
+    #line 135 "./src/pmc/nci.c"
+    return (PMC*)ret;
+#line 222 "./src/pmc/nci.pmc"
+
+#line 139 "./src/pmc/nci.c"
+}
+static  INTVAL 
+Parrot_NCI_defined(SHIM_INTERP, ARGMOD(PMC *_self))
+{
+#line 235 "./src/pmc/nci.pmc"
+
+    const Parrot_NCI_attributes * const nci_info = PARROT_NCI(_self);
+    return nci_info->orig_func != NULL;
+#line 148 "./src/pmc/nci.c"
+}
+static  INTVAL 
+Parrot_NCI_get_bool(SHIM_INTERP, ARGMOD(PMC *_self))
+{
+#line 318 "./src/pmc/nci.pmc"
+
+    const Parrot_NCI_attributes * const nci_info = PARROT_NCI(_self);
+    return (0 != (INTVAL)nci_info->orig_func);
+#line 157 "./src/pmc/nci.c"
+}
+static  INTVAL 
+Parrot_NCI_get_integer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 301 "./src/pmc/nci.pmc"
+
+    Parrot_NCI_attributes * const nci_info = PARROT_NCI(_self);
+    if (!nci_info->func)
+        build_func(interp, _self, nci_info);
+    return (INTVAL)nci_info->func;
+#line 168 "./src/pmc/nci.c"
+}
+static  void  *
+Parrot_NCI_get_pointer(SHIM_INTERP, ARGMOD(PMC *_self))
+{
+#line 123 "./src/pmc/nci.pmc"
+    return PARROT_NCI(_self)->orig_func;
+#line 175 "./src/pmc/nci.c"
+}
+static  void 
+Parrot_NCI_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 119 "./src/pmc/nci.pmc"
+
+    PObj_custom_mark_SET(_self);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 184 "./src/pmc/nci.c"
+}
+static  opcode_t  *
+Parrot_NCI_invoke(PARROT_INTERP, ARGMOD(PMC *_self), void *next)
+{
+#line 252 "./src/pmc/nci.pmc"
+
+    Parrot_NCI_attributes * const nci_info = PARROT_NCI(_self);
+    nci_thunk_t                   func;
+    PMC                          *fb_info;
+    PMC                          *cont;
+
+    func = (nci_thunk_t)D2FPTR(nci_info->func);
+
+    if (!func) {
+        /* build the thunk only when necessary */
+        func = build_func(interp, _self, nci_info);
+
+        if (!func)
+            Parrot_ex_throw_from_c_args(interp, NULL,
+                EXCEPTION_INVALID_OPERATION,
+                "attempt to call NULL function");
+    }
+
+    GETATTR_NCI_fb_info(interp, _self, fb_info);
+
+    cont = interp->current_cont;
+    func(interp, _self, fb_info);
+
+    /*
+     * If the NCI function was tailcalled, the return result
+     * is already passed back to the caller of this frame
+     * - see  Parrot_init_ret_nci(). We therefore invoke the
+     * return continuation here, which gets rid of this frame
+     * and returns the real return address
+     */
+    if (!PMC_IS_NULL(cont)
+    && (PObj_get_FLAGS(cont) & SUB_FLAG_TAILCALL)) {
+        cont = Parrot_pcc_get_continuation(interp, CURRENT_CONTEXT(interp));
+        next = VTABLE_invoke(interp, cont, next);
+    }
+
+    return (opcode_t *)next;
+#line 227 "./src/pmc/nci.c"
+}
+static  void 
+Parrot_NCI_mark(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 181 "./src/pmc/nci.pmc"
+
+    Parrot_NCI_attributes * const nci_info = PARROT_NCI(_self);
+    if (nci_info) {
+        Parrot_gc_mark_PMC_alive(interp, nci_info->signature);
+        Parrot_gc_mark_PMC_alive(interp, nci_info->fb_info);
+        Parrot_gc_mark_PMC_alive(interp, nci_info->multi_sig);
+
+        Parrot_gc_mark_STRING_alive(interp, nci_info->long_signature);
+        Parrot_gc_mark_STRING_alive(interp, nci_info->pcc_params_signature);
+        Parrot_gc_mark_STRING_alive(interp, nci_info->pcc_return_signature);
+    }
+#line 244 "./src/pmc/nci.c"
+}
+static  void 
+Parrot_NCI_set_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, PMC *p)
+{
+#line 140 "./src/pmc/nci.pmc"
+
+    Parrot_NCI_set_pointer_keyed(interp, _self, key, VTABLE_get_pointer(interp, p));
+#line 252 "./src/pmc/nci.c"
+}
+static  void 
+Parrot_NCI_set_pmc_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key, PMC *p)
+{
+#line 144 "./src/pmc/nci.pmc"
+
+    Parrot_NCI_set_pointer_keyed_str(interp, _self, key, VTABLE_get_pointer(interp, p));
+#line 260 "./src/pmc/nci.c"
+}
+static  void 
+Parrot_NCI_set_pointer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, void *func)
+{
+#line 162 "./src/pmc/nci.pmc"
+
+    /* Store the original function and signature. */
+    SETATTR_NCI_orig_func(interp, _self, func);
+    SETATTR_NCI_signature(interp, _self, key);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 271 "./src/pmc/nci.c"
+}
+static  void 
+Parrot_NCI_set_pointer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key, void *func)
+{
+#line 168 "./src/pmc/nci.pmc"
+
+    VTABLE_set_pointer_keyed(interp, _self, Parrot_nci_parse_signature(interp, key), func);
+#line 279 "./src/pmc/nci.c"
+}
+static  void
+Parrot_NCI_nci_get_multisig(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 101 "./src/pmc/nci.pmc"
+
+    PMC *sig;
+    GETATTR_NCI_multi_sig(interp, _self, sig);
+    if (PMC_IS_NULL(sig))
+        sig = PMCNULL;
+    #line 305 "./src/pmc/nci.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)sig);
+        
+        return;
+     }
+#line 106 "./src/pmc/nci.pmc"
+
+#line 313 "./src/pmc/nci.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_NCI_nci_arity(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 333 "./src/pmc/nci.pmc"
+
+    Parrot_NCI_attributes * const nci_info = PARROT_NCI(_self);
+
+    if (nci_info) {
+        if (!nci_info->func)
+            build_func(interp, _self, nci_info);
+        if (nci_info->func) {
+            const INTVAL i = nci_info->arity;
+            #line 349 "./src/pmc/nci.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)i);
+        
+        return;
+     }
+#line 341 "./src/pmc/nci.pmc"
+
+        }
+    }
+
+    Parrot_ex_throw_from_c_args(interp, NULL,
+        EXCEPTION_INVALID_OPERATION,
+        "You cannot get the arity of an undefined NCI.");
+#line 363 "./src/pmc/nci.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_NCI_update_vtable(VTABLE *vt) {
+    vt->clone = Parrot_NCI_clone;
+    vt->defined = Parrot_NCI_defined;
+    vt->get_bool = Parrot_NCI_get_bool;
+    vt->get_integer = Parrot_NCI_get_integer;
+    vt->get_pointer = Parrot_NCI_get_pointer;
+    vt->init = Parrot_NCI_init;
+    vt->invoke = Parrot_NCI_invoke;
+    vt->mark = Parrot_NCI_mark;
+    vt->set_pmc_keyed = Parrot_NCI_set_pmc_keyed;
+    vt->set_pmc_keyed_str = Parrot_NCI_set_pmc_keyed_str;
+    vt->set_pointer_keyed = Parrot_NCI_set_pointer_keyed;
+    vt->set_pointer_keyed_str = Parrot_NCI_set_pointer_keyed_str;
+    vt->attr_size = sizeof(Parrot_NCI_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_NCI_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->clone = Parrot_NCI_clone;
+    vt->defined = Parrot_NCI_defined;
+    vt->get_bool = Parrot_NCI_get_bool;
+    vt->get_integer = Parrot_NCI_get_integer;
+    vt->get_pointer = Parrot_NCI_get_pointer;
+    vt->invoke = Parrot_NCI_invoke;
+    vt->mark = Parrot_NCI_mark;
+    vt->attr_size = sizeof(Parrot_NCI_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_NCI_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_NCI_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_NCI_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_NCI_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_NCI_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "NCI"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_NCI_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "NCI")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_NCI_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "Fsignature :func Ffb_info :orig_func Spcc_params_signature Spcc_return_signature Iarity Slong_signature Fmulti_sig ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_NCI_get_vtable(interp);
+        vt->base_type      = enum_class_NCI;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "NCI");
+        vt->provides_str = CONST_STRING_GEN(interp, "invokable");
+        vt->isa_hash     = Parrot_NCI_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_NCI_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_NCI;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_NCI_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "get_multisig");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_NCI_nci_get_multisig),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "arity");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_NCI_nci_arity),
+                method_name, signature);
+        }
+        {
+        }
+    } /* pass */
+} /* Parrot_NCI_class_init */
+
+#line 348 "./src/pmc/nci.pmc"
+
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<docs/pdds/pdd03_calling_conventions.pod>.
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -0,0 +1,1676 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/null.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_null.h"
+#include "pmc_default.h"
+#include "null.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/null.pmc"
+/*
+Copyright (C) 2001-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/null.pmc - Null PMC
+
+=head1 DESCRIPTION
+
+This singleton simply creates a way of catching C<NULL> register accesses without
+really slowing down the bytecode execution.
+
+=cut
+
+*/
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+PARROT_DOES_NOT_RETURN
+static void null_pmc_access(PARROT_INTERP, int index)
+        __attribute__nonnull__(1);
+
+#define ASSERT_ARGS_null_pmc_access __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+#line 51 "./src/pmc/null.c"
+static  PMC * Parrot_Null_absolute(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *dest));
+static  PMC * Parrot_Null_add(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value), SHIM(PMC *dest));
+static  void Parrot_Null_add_attribute(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *name), SHIM(PMC *type));
+static  PMC * Parrot_Null_add_float(PARROT_INTERP, SHIM(PMC *_self), SHIM(FLOATVAL value), SHIM(PMC *dest));
+static  PMC * Parrot_Null_add_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL value), SHIM(PMC *dest));
+static  void Parrot_Null_add_method(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *method_name), SHIM(PMC *sub_pmc));
+static  void Parrot_Null_add_parent(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *parent));
+static  void Parrot_Null_add_role(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *role));
+static  void Parrot_Null_add_vtable_override(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *vtable_name), SHIM(PMC *sub_pmc));
+static  void Parrot_Null_assign_pmc(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value));
+static  void Parrot_Null_assign_string_native(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *value));
+static  PMC * Parrot_Null_clone(PARROT_INTERP, SHIM(PMC *_self));
+static  PMC * Parrot_Null_clone_pmc(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *args));
+static  INTVAL Parrot_Null_cmp(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value));
+static  INTVAL Parrot_Null_cmp_num(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value));
+static  PMC * Parrot_Null_cmp_pmc(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value));
+static  INTVAL Parrot_Null_cmp_string(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value));
+static  PMC * Parrot_Null_concatenate(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value), SHIM(PMC *dest));
+static  PMC * Parrot_Null_concatenate_str(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *value), SHIM(PMC *dest));
+static  void Parrot_Null_decrement(PARROT_INTERP, SHIM(PMC *_self));
+static  INTVAL Parrot_Null_defined(PARROT_INTERP, SHIM(PMC *_self));
+static  INTVAL Parrot_Null_defined_keyed(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *key));
+static  INTVAL Parrot_Null_defined_keyed_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL key));
+static  INTVAL Parrot_Null_defined_keyed_str(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *key));
+static  void Parrot_Null_delete_keyed(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *key));
+static  void Parrot_Null_delete_keyed_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL key));
+static  void Parrot_Null_delete_keyed_str(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *key));
+static  void Parrot_Null_destroy(PARROT_INTERP, SHIM(PMC *_self));
+static  PMC * Parrot_Null_divide(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value), SHIM(PMC *dest));
+static  PMC * Parrot_Null_divide_float(PARROT_INTERP, SHIM(PMC *_self), SHIM(FLOATVAL value), SHIM(PMC *dest));
+static  PMC * Parrot_Null_divide_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL value), SHIM(PMC *dest));
+static  INTVAL  Parrot_Null_does(SHIM_INTERP, SHIM(PMC *_self), SHIM(STRING *what));
+static  INTVAL Parrot_Null_does_pmc(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *role));
+static  INTVAL Parrot_Null_elements(PARROT_INTERP, SHIM(PMC *_self));
+static  INTVAL Parrot_Null_exists_keyed(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *key));
+static  INTVAL Parrot_Null_exists_keyed_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL key));
+static  INTVAL Parrot_Null_exists_keyed_str(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *key));
+static  PMC  * Parrot_Null_find_method(PARROT_INTERP, SHIM(PMC *_self), STRING *method_name);
+static  PMC * Parrot_Null_floor_divide(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value), SHIM(PMC *dest));
+static  PMC * Parrot_Null_floor_divide_float(PARROT_INTERP, SHIM(PMC *_self), SHIM(FLOATVAL value), SHIM(PMC *dest));
+static  PMC * Parrot_Null_floor_divide_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL value), SHIM(PMC *dest));
+static  void Parrot_Null_freeze(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *info));
+static  PMC * Parrot_Null_get_attr_keyed(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *key), SHIM(STRING *idx));
+static  PMC * Parrot_Null_get_attr_str(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *idx));
+static  INTVAL Parrot_Null_get_bool(PARROT_INTERP, SHIM(PMC *_self));
+static  PMC * Parrot_Null_get_class(PARROT_INTERP, SHIM(PMC *_self));
+static  INTVAL Parrot_Null_get_integer(PARROT_INTERP, SHIM(PMC *_self));
+static  INTVAL Parrot_Null_get_integer_keyed(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *key));
+static  INTVAL Parrot_Null_get_integer_keyed_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL key));
+static  INTVAL Parrot_Null_get_integer_keyed_str(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *key));
+static  PMC * Parrot_Null_get_iter(PARROT_INTERP, SHIM(PMC *_self));
+static  PMC * Parrot_Null_get_namespace(PARROT_INTERP, SHIM(PMC *_self));
+static  FLOATVAL Parrot_Null_get_number(PARROT_INTERP, SHIM(PMC *_self));
+static  FLOATVAL Parrot_Null_get_number_keyed(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *key));
+static  FLOATVAL Parrot_Null_get_number_keyed_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL key));
+static  FLOATVAL Parrot_Null_get_number_keyed_str(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *key));
+static  PMC * Parrot_Null_get_pmc(PARROT_INTERP, SHIM(PMC *_self));
+static  PMC * Parrot_Null_get_pmc_keyed(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *key));
+static  PMC * Parrot_Null_get_pmc_keyed_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL key));
+static  PMC * Parrot_Null_get_pmc_keyed_str(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *key));
+static  void  * Parrot_Null_get_pointer(SHIM_INTERP, SHIM(PMC *_self));
+static  void * Parrot_Null_get_pointer_keyed(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *key));
+static  void * Parrot_Null_get_pointer_keyed_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL key));
+static  void * Parrot_Null_get_pointer_keyed_str(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *key));
+static  STRING * Parrot_Null_get_repr(PARROT_INTERP, SHIM(PMC *_self));
+static  STRING * Parrot_Null_get_string(PARROT_INTERP, SHIM(PMC *_self));
+static  STRING * Parrot_Null_get_string_keyed(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *key));
+static  STRING * Parrot_Null_get_string_keyed_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL key));
+static  STRING * Parrot_Null_get_string_keyed_str(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *key));
+static  INTVAL Parrot_Null_hashvalue(PARROT_INTERP, SHIM(PMC *_self));
+static  void Parrot_Null_i_absolute(PARROT_INTERP, SHIM(PMC *_self));
+static  void Parrot_Null_i_add(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value));
+static  void Parrot_Null_i_add_float(PARROT_INTERP, SHIM(PMC *_self), SHIM(FLOATVAL value));
+static  void Parrot_Null_i_add_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL value));
+static  void Parrot_Null_i_concatenate(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value));
+static  void Parrot_Null_i_concatenate_str(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *value));
+static  void Parrot_Null_i_divide(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value));
+static  void Parrot_Null_i_divide_float(PARROT_INTERP, SHIM(PMC *_self), SHIM(FLOATVAL value));
+static  void Parrot_Null_i_divide_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL value));
+static  void Parrot_Null_i_floor_divide(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value));
+static  void Parrot_Null_i_floor_divide_float(PARROT_INTERP, SHIM(PMC *_self), SHIM(FLOATVAL value));
+static  void Parrot_Null_i_floor_divide_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL value));
+static  void Parrot_Null_i_modulus(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value));
+static  void Parrot_Null_i_modulus_float(PARROT_INTERP, SHIM(PMC *_self), SHIM(FLOATVAL value));
+static  void Parrot_Null_i_modulus_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL value));
+static  void Parrot_Null_i_multiply(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value));
+static  void Parrot_Null_i_multiply_float(PARROT_INTERP, SHIM(PMC *_self), SHIM(FLOATVAL value));
+static  void Parrot_Null_i_multiply_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL value));
+static  void Parrot_Null_i_neg(PARROT_INTERP, SHIM(PMC *_self));
+static  void Parrot_Null_i_repeat(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value));
+static  void Parrot_Null_i_repeat_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL value));
+static  void Parrot_Null_i_subtract(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value));
+static  void Parrot_Null_i_subtract_float(PARROT_INTERP, SHIM(PMC *_self), SHIM(FLOATVAL value));
+static  void Parrot_Null_i_subtract_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL value));
+static  void Parrot_Null_increment(PARROT_INTERP, SHIM(PMC *_self));
+static  void  Parrot_Null_init(SHIM_INTERP, SHIM(PMC *_self));
+static  void Parrot_Null_init_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL initializer));
+static  void Parrot_Null_init_pmc(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *initializer));
+static  PMC * Parrot_Null_inspect(PARROT_INTERP, SHIM(PMC *_self));
+static  PMC * Parrot_Null_inspect_str(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *what));
+static  PMC * Parrot_Null_instantiate(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *sig));
+static  opcode_t * Parrot_Null_invoke(PARROT_INTERP, SHIM(PMC *_self), SHIM(void *next));
+static  INTVAL Parrot_Null_is_equal(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value));
+static  INTVAL Parrot_Null_is_equal_num(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value));
+static  INTVAL Parrot_Null_is_equal_string(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value));
+static  INTVAL  Parrot_Null_is_same(SHIM_INTERP, SHIM(PMC *_self), PMC *value);
+static  INTVAL Parrot_Null_isa(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *_class));
+static  INTVAL Parrot_Null_isa_pmc(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *_class));
+static  void Parrot_Null_mark(PARROT_INTERP, SHIM(PMC *_self));
+static  PMC * Parrot_Null_modulus(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value), SHIM(PMC *dest));
+static  PMC * Parrot_Null_modulus_float(PARROT_INTERP, SHIM(PMC *_self), SHIM(FLOATVAL value), SHIM(PMC *dest));
+static  PMC * Parrot_Null_modulus_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL value), SHIM(PMC *dest));
+static  void Parrot_Null_morph(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *type));
+static  PMC * Parrot_Null_multiply(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value), SHIM(PMC *dest));
+static  PMC * Parrot_Null_multiply_float(PARROT_INTERP, SHIM(PMC *_self), SHIM(FLOATVAL value), SHIM(PMC *dest));
+static  PMC * Parrot_Null_multiply_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL value), SHIM(PMC *dest));
+static  STRING * Parrot_Null_name(PARROT_INTERP, SHIM(PMC *_self));
+static  PMC * Parrot_Null_neg(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *dest));
+static  FLOATVAL Parrot_Null_pop_float(PARROT_INTERP, SHIM(PMC *_self));
+static  INTVAL Parrot_Null_pop_integer(PARROT_INTERP, SHIM(PMC *_self));
+static  PMC * Parrot_Null_pop_pmc(PARROT_INTERP, SHIM(PMC *_self));
+static  STRING * Parrot_Null_pop_string(PARROT_INTERP, SHIM(PMC *_self));
+static  void Parrot_Null_push_float(PARROT_INTERP, SHIM(PMC *_self), SHIM(FLOATVAL value));
+static  void Parrot_Null_push_integer(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL value));
+static  void Parrot_Null_push_pmc(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value));
+static  void Parrot_Null_push_string(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *value));
+static  void Parrot_Null_remove_attribute(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *name));
+static  void Parrot_Null_remove_method(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *method_name));
+static  void Parrot_Null_remove_parent(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *parent));
+static  void Parrot_Null_remove_role(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *role));
+static  void Parrot_Null_remove_vtable_override(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *vtable_name));
+static  PMC * Parrot_Null_repeat(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value), SHIM(PMC *dest));
+static  PMC * Parrot_Null_repeat_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL value), SHIM(PMC *dest));
+static  void Parrot_Null_set_attr_keyed(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *key), SHIM(STRING *idx), SHIM(PMC *value));
+static  void Parrot_Null_set_attr_str(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *idx), SHIM(PMC *value));
+static  void Parrot_Null_set_bool(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL value));
+static  void Parrot_Null_set_integer_keyed(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *key), SHIM(INTVAL value));
+static  void Parrot_Null_set_integer_keyed_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL key), SHIM(INTVAL value));
+static  void Parrot_Null_set_integer_keyed_str(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *key), SHIM(INTVAL value));
+static  void Parrot_Null_set_integer_native(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL value));
+static  void Parrot_Null_set_number_keyed(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *key), SHIM(FLOATVAL value));
+static  void Parrot_Null_set_number_keyed_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL key), SHIM(FLOATVAL value));
+static  void Parrot_Null_set_number_keyed_str(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *key), SHIM(FLOATVAL value));
+static  void Parrot_Null_set_number_native(PARROT_INTERP, SHIM(PMC *_self), SHIM(FLOATVAL value));
+static  void Parrot_Null_set_pmc(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value));
+static  void Parrot_Null_set_pmc_keyed(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *key), SHIM(PMC *value));
+static  void Parrot_Null_set_pmc_keyed_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL key), SHIM(PMC *value));
+static  void Parrot_Null_set_pmc_keyed_str(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *key), SHIM(PMC *value));
+static  void  Parrot_Null_set_pointer(SHIM_INTERP, SHIM(PMC *_self), void *p);
+static  void Parrot_Null_set_pointer_keyed(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *key), SHIM(void *value));
+static  void Parrot_Null_set_pointer_keyed_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL key), SHIM(void *value));
+static  void Parrot_Null_set_pointer_keyed_str(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *key), SHIM(void *value));
+static  void Parrot_Null_set_string_keyed(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *key), SHIM(STRING *value));
+static  void Parrot_Null_set_string_keyed_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL key), SHIM(STRING *value));
+static  void Parrot_Null_set_string_keyed_str(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *key), SHIM(STRING *value));
+static  void Parrot_Null_set_string_native(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *value));
+static  void Parrot_Null_share(PARROT_INTERP, SHIM(PMC *_self));
+static  FLOATVAL Parrot_Null_shift_float(PARROT_INTERP, SHIM(PMC *_self));
+static  INTVAL Parrot_Null_shift_integer(PARROT_INTERP, SHIM(PMC *_self));
+static  PMC * Parrot_Null_shift_pmc(PARROT_INTERP, SHIM(PMC *_self));
+static  STRING * Parrot_Null_shift_string(PARROT_INTERP, SHIM(PMC *_self));
+static  void Parrot_Null_splice(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value), SHIM(INTVAL offset), SHIM(INTVAL count));
+static  STRING * Parrot_Null_substr(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL offset), SHIM(INTVAL length));
+static  PMC * Parrot_Null_subtract(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value), SHIM(PMC *dest));
+static  PMC * Parrot_Null_subtract_float(PARROT_INTERP, SHIM(PMC *_self), SHIM(FLOATVAL value), SHIM(PMC *dest));
+static  PMC * Parrot_Null_subtract_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL value), SHIM(PMC *dest));
+static  void Parrot_Null_thaw(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *info));
+static  void Parrot_Null_thawfinish(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *info));
+static  INTVAL Parrot_Null_type(PARROT_INTERP, SHIM(PMC *_self));
+static  void Parrot_Null_unshift_float(PARROT_INTERP, SHIM(PMC *_self), SHIM(FLOATVAL value));
+static  void Parrot_Null_unshift_integer(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL value));
+static  void Parrot_Null_unshift_pmc(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value));
+static  void Parrot_Null_unshift_string(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *value));
+static  void Parrot_Null_visit(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *info));
+void    Parrot_Null_class_init(PARROT_INTERP, int, int);
+static  PMC *
+Parrot_Null_absolute(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *dest))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_ABSOLUTE);
+}
+static  PMC *
+Parrot_Null_add(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value), SHIM(PMC *dest))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_ADD);
+}
+static  void
+Parrot_Null_add_attribute(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *name), SHIM(PMC *type))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_ADD_ATTRIBUTE);
+}
+static  PMC *
+Parrot_Null_add_float(PARROT_INTERP, SHIM(PMC *_self), SHIM(FLOATVAL value), SHIM(PMC *dest))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_ADD_FLOAT);
+}
+static  PMC *
+Parrot_Null_add_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL value), SHIM(PMC *dest))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_ADD_INT);
+}
+static  void
+Parrot_Null_add_method(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *method_name), SHIM(PMC *sub_pmc))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_ADD_METHOD);
+}
+static  void
+Parrot_Null_add_parent(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *parent))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_ADD_PARENT);
+}
+static  void
+Parrot_Null_add_role(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *role))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_ADD_ROLE);
+}
+static  void
+Parrot_Null_add_vtable_override(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *vtable_name), SHIM(PMC *sub_pmc))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_ADD_VTABLE_OVERRIDE);
+}
+static  void
+Parrot_Null_assign_pmc(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_ASSIGN_PMC);
+}
+static  void
+Parrot_Null_assign_string_native(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_ASSIGN_STRING_NATIVE);
+}
+static  PMC *
+Parrot_Null_clone(PARROT_INTERP, SHIM(PMC *_self))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_CLONE);
+}
+static  PMC *
+Parrot_Null_clone_pmc(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *args))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_CLONE_PMC);
+}
+static  INTVAL
+Parrot_Null_cmp(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_CMP);
+}
+static  INTVAL
+Parrot_Null_cmp_num(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_CMP_NUM);
+}
+static  PMC *
+Parrot_Null_cmp_pmc(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_CMP_PMC);
+}
+static  INTVAL
+Parrot_Null_cmp_string(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_CMP_STRING);
+}
+static  PMC *
+Parrot_Null_concatenate(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value), SHIM(PMC *dest))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_CONCATENATE);
+}
+static  PMC *
+Parrot_Null_concatenate_str(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *value), SHIM(PMC *dest))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_CONCATENATE_STR);
+}
+static  void
+Parrot_Null_decrement(PARROT_INTERP, SHIM(PMC *_self))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_DECREMENT);
+}
+static  INTVAL
+Parrot_Null_defined(PARROT_INTERP, SHIM(PMC *_self))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_DEFINED);
+}
+static  INTVAL
+Parrot_Null_defined_keyed(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *key))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_DEFINED_KEYED);
+}
+static  INTVAL
+Parrot_Null_defined_keyed_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL key))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_DEFINED_KEYED_INT);
+}
+static  INTVAL
+Parrot_Null_defined_keyed_str(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *key))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_DEFINED_KEYED_STR);
+}
+static  void
+Parrot_Null_delete_keyed(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *key))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_DELETE_KEYED);
+}
+static  void
+Parrot_Null_delete_keyed_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL key))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_DELETE_KEYED_INT);
+}
+static  void
+Parrot_Null_delete_keyed_str(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *key))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_DELETE_KEYED_STR);
+}
+static  void
+Parrot_Null_destroy(PARROT_INTERP, SHIM(PMC *_self))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_DESTROY);
+}
+static  PMC *
+Parrot_Null_divide(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value), SHIM(PMC *dest))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_DIVIDE);
+}
+static  PMC *
+Parrot_Null_divide_float(PARROT_INTERP, SHIM(PMC *_self), SHIM(FLOATVAL value), SHIM(PMC *dest))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_DIVIDE_FLOAT);
+}
+static  PMC *
+Parrot_Null_divide_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL value), SHIM(PMC *dest))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_DIVIDE_INT);
+}
+static  INTVAL 
+Parrot_Null_does(SHIM_INTERP, SHIM(PMC *_self), SHIM(STRING *what))
+{
+#line 63 "./src/pmc/null.pmc"
+    /* XXX maybe a hack to get TGE running again */
+    return 0;
+#line 419 "./src/pmc/null.c"
+}
+static  INTVAL
+Parrot_Null_does_pmc(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *role))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_DOES_PMC);
+}
+static  INTVAL
+Parrot_Null_elements(PARROT_INTERP, SHIM(PMC *_self))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_ELEMENTS);
+}
+static  INTVAL
+Parrot_Null_exists_keyed(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *key))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_EXISTS_KEYED);
+}
+static  INTVAL
+Parrot_Null_exists_keyed_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL key))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_EXISTS_KEYED_INT);
+}
+static  INTVAL
+Parrot_Null_exists_keyed_str(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *key))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_EXISTS_KEYED_STR);
+}
+static  PMC  *
+Parrot_Null_find_method(PARROT_INTERP, SHIM(PMC *_self), STRING *method_name)
+{
+#line 96 "./src/pmc/null.pmc"
+    Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_NULL_REG_ACCESS,
+            "Null PMC access in find_method('%Ss')",
+            method_name);
+#line 458 "./src/pmc/null.c"
+}
+static  PMC *
+Parrot_Null_floor_divide(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value), SHIM(PMC *dest))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_FLOOR_DIVIDE);
+}
+static  PMC *
+Parrot_Null_floor_divide_float(PARROT_INTERP, SHIM(PMC *_self), SHIM(FLOATVAL value), SHIM(PMC *dest))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_FLOOR_DIVIDE_FLOAT);
+}
+static  PMC *
+Parrot_Null_floor_divide_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL value), SHIM(PMC *dest))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_FLOOR_DIVIDE_INT);
+}
+static  void
+Parrot_Null_freeze(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *info))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_FREEZE);
+}
+static  PMC *
+Parrot_Null_get_attr_keyed(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *key), SHIM(STRING *idx))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_GET_ATTR_KEYED);
+}
+static  PMC *
+Parrot_Null_get_attr_str(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *idx))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_GET_ATTR_STR);
+}
+static  INTVAL
+Parrot_Null_get_bool(PARROT_INTERP, SHIM(PMC *_self))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_GET_BOOL);
+}
+static  PMC *
+Parrot_Null_get_class(PARROT_INTERP, SHIM(PMC *_self))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_GET_CLASS);
+}
+static  INTVAL
+Parrot_Null_get_integer(PARROT_INTERP, SHIM(PMC *_self))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_GET_INTEGER);
+}
+static  INTVAL
+Parrot_Null_get_integer_keyed(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *key))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_GET_INTEGER_KEYED);
+}
+static  INTVAL
+Parrot_Null_get_integer_keyed_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL key))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_GET_INTEGER_KEYED_INT);
+}
+static  INTVAL
+Parrot_Null_get_integer_keyed_str(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *key))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_GET_INTEGER_KEYED_STR);
+}
+static  PMC *
+Parrot_Null_get_iter(PARROT_INTERP, SHIM(PMC *_self))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_GET_ITER);
+}
+static  PMC *
+Parrot_Null_get_namespace(PARROT_INTERP, SHIM(PMC *_self))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_GET_NAMESPACE);
+}
+static  FLOATVAL
+Parrot_Null_get_number(PARROT_INTERP, SHIM(PMC *_self))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_GET_NUMBER);
+}
+static  FLOATVAL
+Parrot_Null_get_number_keyed(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *key))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_GET_NUMBER_KEYED);
+}
+static  FLOATVAL
+Parrot_Null_get_number_keyed_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL key))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_GET_NUMBER_KEYED_INT);
+}
+static  FLOATVAL
+Parrot_Null_get_number_keyed_str(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *key))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_GET_NUMBER_KEYED_STR);
+}
+static  PMC *
+Parrot_Null_get_pmc(PARROT_INTERP, SHIM(PMC *_self))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_GET_PMC);
+}
+static  PMC *
+Parrot_Null_get_pmc_keyed(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *key))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_GET_PMC_KEYED);
+}
+static  PMC *
+Parrot_Null_get_pmc_keyed_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL key))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_GET_PMC_KEYED_INT);
+}
+static  PMC *
+Parrot_Null_get_pmc_keyed_str(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *key))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_GET_PMC_KEYED_STR);
+}
+static  void  *
+Parrot_Null_get_pointer(SHIM_INTERP, SHIM(PMC *_self))
+{
+#line 51 "./src/pmc/null.pmc"
+    return PMCNULL;
+#line 597 "./src/pmc/null.c"
+}
+static  void *
+Parrot_Null_get_pointer_keyed(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *key))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_GET_POINTER_KEYED);
+}
+static  void *
+Parrot_Null_get_pointer_keyed_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL key))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_GET_POINTER_KEYED_INT);
+}
+static  void *
+Parrot_Null_get_pointer_keyed_str(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *key))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_GET_POINTER_KEYED_STR);
+}
+static  STRING *
+Parrot_Null_get_repr(PARROT_INTERP, SHIM(PMC *_self))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_GET_REPR);
+}
+static  STRING *
+Parrot_Null_get_string(PARROT_INTERP, SHIM(PMC *_self))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_GET_STRING);
+}
+static  STRING *
+Parrot_Null_get_string_keyed(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *key))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_GET_STRING_KEYED);
+}
+static  STRING *
+Parrot_Null_get_string_keyed_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL key))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_GET_STRING_KEYED_INT);
+}
+static  STRING *
+Parrot_Null_get_string_keyed_str(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *key))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_GET_STRING_KEYED_STR);
+}
+static  INTVAL
+Parrot_Null_hashvalue(PARROT_INTERP, SHIM(PMC *_self))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_HASHVALUE);
+}
+static  void
+Parrot_Null_i_absolute(PARROT_INTERP, SHIM(PMC *_self))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_I_ABSOLUTE);
+}
+static  void
+Parrot_Null_i_add(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_I_ADD);
+}
+static  void
+Parrot_Null_i_add_float(PARROT_INTERP, SHIM(PMC *_self), SHIM(FLOATVAL value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_I_ADD_FLOAT);
+}
+static  void
+Parrot_Null_i_add_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_I_ADD_INT);
+}
+static  void
+Parrot_Null_i_concatenate(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_I_CONCATENATE);
+}
+static  void
+Parrot_Null_i_concatenate_str(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_I_CONCATENATE_STR);
+}
+static  void
+Parrot_Null_i_divide(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_I_DIVIDE);
+}
+static  void
+Parrot_Null_i_divide_float(PARROT_INTERP, SHIM(PMC *_self), SHIM(FLOATVAL value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_I_DIVIDE_FLOAT);
+}
+static  void
+Parrot_Null_i_divide_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_I_DIVIDE_INT);
+}
+static  void
+Parrot_Null_i_floor_divide(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_I_FLOOR_DIVIDE);
+}
+static  void
+Parrot_Null_i_floor_divide_float(PARROT_INTERP, SHIM(PMC *_self), SHIM(FLOATVAL value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_I_FLOOR_DIVIDE_FLOAT);
+}
+static  void
+Parrot_Null_i_floor_divide_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_I_FLOOR_DIVIDE_INT);
+}
+static  void
+Parrot_Null_i_modulus(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_I_MODULUS);
+}
+static  void
+Parrot_Null_i_modulus_float(PARROT_INTERP, SHIM(PMC *_self), SHIM(FLOATVAL value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_I_MODULUS_FLOAT);
+}
+static  void
+Parrot_Null_i_modulus_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_I_MODULUS_INT);
+}
+static  void
+Parrot_Null_i_multiply(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_I_MULTIPLY);
+}
+static  void
+Parrot_Null_i_multiply_float(PARROT_INTERP, SHIM(PMC *_self), SHIM(FLOATVAL value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_I_MULTIPLY_FLOAT);
+}
+static  void
+Parrot_Null_i_multiply_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_I_MULTIPLY_INT);
+}
+static  void
+Parrot_Null_i_neg(PARROT_INTERP, SHIM(PMC *_self))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_I_NEG);
+}
+static  void
+Parrot_Null_i_repeat(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_I_REPEAT);
+}
+static  void
+Parrot_Null_i_repeat_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_I_REPEAT_INT);
+}
+static  void
+Parrot_Null_i_subtract(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_I_SUBTRACT);
+}
+static  void
+Parrot_Null_i_subtract_float(PARROT_INTERP, SHIM(PMC *_self), SHIM(FLOATVAL value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_I_SUBTRACT_FLOAT);
+}
+static  void
+Parrot_Null_i_subtract_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_I_SUBTRACT_INT);
+}
+static  void
+Parrot_Null_increment(PARROT_INTERP, SHIM(PMC *_self))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_INCREMENT);
+}
+static  void 
+Parrot_Null_init(SHIM_INTERP, SHIM(PMC *_self))
+{
+#line 46 "./src/pmc/null.pmc"
+#line 807 "./src/pmc/null.c"
+}
+static  void
+Parrot_Null_init_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL initializer))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_INIT_INT);
+}
+static  void
+Parrot_Null_init_pmc(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *initializer))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_INIT_PMC);
+}
+static  PMC *
+Parrot_Null_inspect(PARROT_INTERP, SHIM(PMC *_self))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_INSPECT);
+}
+static  PMC *
+Parrot_Null_inspect_str(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *what))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_INSPECT_STR);
+}
+static  PMC *
+Parrot_Null_instantiate(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *sig))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_INSTANTIATE);
+}
+static  opcode_t *
+Parrot_Null_invoke(PARROT_INTERP, SHIM(PMC *_self), SHIM(void *next))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_INVOKE);
+}
+static  INTVAL
+Parrot_Null_is_equal(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_IS_EQUAL);
+}
+static  INTVAL
+Parrot_Null_is_equal_num(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_IS_EQUAL_NUM);
+}
+static  INTVAL
+Parrot_Null_is_equal_string(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_IS_EQUAL_STRING);
+}
+static  INTVAL 
+Parrot_Null_is_same(SHIM_INTERP, SHIM(PMC *_self), PMC *value)
+{
+#line 80 "./src/pmc/null.pmc"
+    return PMC_IS_NULL(value);
+#line 868 "./src/pmc/null.c"
+}
+static  INTVAL
+Parrot_Null_isa(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *_class))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_ISA);
+}
+static  INTVAL
+Parrot_Null_isa_pmc(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *_class))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_ISA_PMC);
+}
+static  void
+Parrot_Null_mark(PARROT_INTERP, SHIM(PMC *_self))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_MARK);
+}
+static  PMC *
+Parrot_Null_modulus(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value), SHIM(PMC *dest))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_MODULUS);
+}
+static  PMC *
+Parrot_Null_modulus_float(PARROT_INTERP, SHIM(PMC *_self), SHIM(FLOATVAL value), SHIM(PMC *dest))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_MODULUS_FLOAT);
+}
+static  PMC *
+Parrot_Null_modulus_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL value), SHIM(PMC *dest))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_MODULUS_INT);
+}
+static  void
+Parrot_Null_morph(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *type))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_MORPH);
+}
+static  PMC *
+Parrot_Null_multiply(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value), SHIM(PMC *dest))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_MULTIPLY);
+}
+static  PMC *
+Parrot_Null_multiply_float(PARROT_INTERP, SHIM(PMC *_self), SHIM(FLOATVAL value), SHIM(PMC *dest))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_MULTIPLY_FLOAT);
+}
+static  PMC *
+Parrot_Null_multiply_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL value), SHIM(PMC *dest))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_MULTIPLY_INT);
+}
+static  STRING *
+Parrot_Null_name(PARROT_INTERP, SHIM(PMC *_self))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_NAME);
+}
+static  PMC *
+Parrot_Null_neg(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *dest))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_NEG);
+}
+static  FLOATVAL
+Parrot_Null_pop_float(PARROT_INTERP, SHIM(PMC *_self))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_POP_FLOAT);
+}
+static  INTVAL
+Parrot_Null_pop_integer(PARROT_INTERP, SHIM(PMC *_self))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_POP_INTEGER);
+}
+static  PMC *
+Parrot_Null_pop_pmc(PARROT_INTERP, SHIM(PMC *_self))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_POP_PMC);
+}
+static  STRING *
+Parrot_Null_pop_string(PARROT_INTERP, SHIM(PMC *_self))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_POP_STRING);
+}
+static  void
+Parrot_Null_push_float(PARROT_INTERP, SHIM(PMC *_self), SHIM(FLOATVAL value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_PUSH_FLOAT);
+}
+static  void
+Parrot_Null_push_integer(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_PUSH_INTEGER);
+}
+static  void
+Parrot_Null_push_pmc(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_PUSH_PMC);
+}
+static  void
+Parrot_Null_push_string(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_PUSH_STRING);
+}
+static  void
+Parrot_Null_remove_attribute(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *name))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_REMOVE_ATTRIBUTE);
+}
+static  void
+Parrot_Null_remove_method(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *method_name))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_REMOVE_METHOD);
+}
+static  void
+Parrot_Null_remove_parent(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *parent))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_REMOVE_PARENT);
+}
+static  void
+Parrot_Null_remove_role(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *role))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_REMOVE_ROLE);
+}
+static  void
+Parrot_Null_remove_vtable_override(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *vtable_name))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_REMOVE_VTABLE_OVERRIDE);
+}
+static  PMC *
+Parrot_Null_repeat(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value), SHIM(PMC *dest))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_REPEAT);
+}
+static  PMC *
+Parrot_Null_repeat_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL value), SHIM(PMC *dest))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_REPEAT_INT);
+}
+static  void
+Parrot_Null_set_attr_keyed(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *key), SHIM(STRING *idx), SHIM(PMC *value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_SET_ATTR_KEYED);
+}
+static  void
+Parrot_Null_set_attr_str(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *idx), SHIM(PMC *value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_SET_ATTR_STR);
+}
+static  void
+Parrot_Null_set_bool(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_SET_BOOL);
+}
+static  void
+Parrot_Null_set_integer_keyed(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *key), SHIM(INTVAL value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_SET_INTEGER_KEYED);
+}
+static  void
+Parrot_Null_set_integer_keyed_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL key), SHIM(INTVAL value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_SET_INTEGER_KEYED_INT);
+}
+static  void
+Parrot_Null_set_integer_keyed_str(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *key), SHIM(INTVAL value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_SET_INTEGER_KEYED_STR);
+}
+static  void
+Parrot_Null_set_integer_native(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_SET_INTEGER_NATIVE);
+}
+static  void
+Parrot_Null_set_number_keyed(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *key), SHIM(FLOATVAL value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_SET_NUMBER_KEYED);
+}
+static  void
+Parrot_Null_set_number_keyed_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL key), SHIM(FLOATVAL value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_SET_NUMBER_KEYED_INT);
+}
+static  void
+Parrot_Null_set_number_keyed_str(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *key), SHIM(FLOATVAL value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_SET_NUMBER_KEYED_STR);
+}
+static  void
+Parrot_Null_set_number_native(PARROT_INTERP, SHIM(PMC *_self), SHIM(FLOATVAL value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_SET_NUMBER_NATIVE);
+}
+static  void
+Parrot_Null_set_pmc(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_SET_PMC);
+}
+static  void
+Parrot_Null_set_pmc_keyed(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *key), SHIM(PMC *value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_SET_PMC_KEYED);
+}
+static  void
+Parrot_Null_set_pmc_keyed_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL key), SHIM(PMC *value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_SET_PMC_KEYED_INT);
+}
+static  void
+Parrot_Null_set_pmc_keyed_str(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *key), SHIM(PMC *value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_SET_PMC_KEYED_STR);
+}
+static  void 
+Parrot_Null_set_pointer(SHIM_INTERP, SHIM(PMC *_self), void *p)
+{
+#line 57 "./src/pmc/null.pmc"
+    PMCNULL = (PMC *)p;
+#line 1127 "./src/pmc/null.c"
+}
+static  void
+Parrot_Null_set_pointer_keyed(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *key), SHIM(void *value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_SET_POINTER_KEYED);
+}
+static  void
+Parrot_Null_set_pointer_keyed_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL key), SHIM(void *value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_SET_POINTER_KEYED_INT);
+}
+static  void
+Parrot_Null_set_pointer_keyed_str(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *key), SHIM(void *value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_SET_POINTER_KEYED_STR);
+}
+static  void
+Parrot_Null_set_string_keyed(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *key), SHIM(STRING *value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_SET_STRING_KEYED);
+}
+static  void
+Parrot_Null_set_string_keyed_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL key), SHIM(STRING *value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_SET_STRING_KEYED_INT);
+}
+static  void
+Parrot_Null_set_string_keyed_str(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *key), SHIM(STRING *value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_SET_STRING_KEYED_STR);
+}
+static  void
+Parrot_Null_set_string_native(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_SET_STRING_NATIVE);
+}
+static  void
+Parrot_Null_share(PARROT_INTERP, SHIM(PMC *_self))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_SHARE);
+}
+static  FLOATVAL
+Parrot_Null_shift_float(PARROT_INTERP, SHIM(PMC *_self))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_SHIFT_FLOAT);
+}
+static  INTVAL
+Parrot_Null_shift_integer(PARROT_INTERP, SHIM(PMC *_self))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_SHIFT_INTEGER);
+}
+static  PMC *
+Parrot_Null_shift_pmc(PARROT_INTERP, SHIM(PMC *_self))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_SHIFT_PMC);
+}
+static  STRING *
+Parrot_Null_shift_string(PARROT_INTERP, SHIM(PMC *_self))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_SHIFT_STRING);
+}
+static  void
+Parrot_Null_splice(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value), SHIM(INTVAL offset), SHIM(INTVAL count))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_SPLICE);
+}
+static  STRING *
+Parrot_Null_substr(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL offset), SHIM(INTVAL length))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_SUBSTR);
+}
+static  PMC *
+Parrot_Null_subtract(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value), SHIM(PMC *dest))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_SUBTRACT);
+}
+static  PMC *
+Parrot_Null_subtract_float(PARROT_INTERP, SHIM(PMC *_self), SHIM(FLOATVAL value), SHIM(PMC *dest))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_SUBTRACT_FLOAT);
+}
+static  PMC *
+Parrot_Null_subtract_int(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL value), SHIM(PMC *dest))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_SUBTRACT_INT);
+}
+static  void
+Parrot_Null_thaw(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *info))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_THAW);
+}
+static  void
+Parrot_Null_thawfinish(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *info))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_THAWFINISH);
+}
+static  INTVAL
+Parrot_Null_type(PARROT_INTERP, SHIM(PMC *_self))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_TYPE);
+}
+static  void
+Parrot_Null_unshift_float(PARROT_INTERP, SHIM(PMC *_self), SHIM(FLOATVAL value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_UNSHIFT_FLOAT);
+}
+static  void
+Parrot_Null_unshift_integer(PARROT_INTERP, SHIM(PMC *_self), SHIM(INTVAL value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_UNSHIFT_INTEGER);
+}
+static  void
+Parrot_Null_unshift_pmc(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_UNSHIFT_PMC);
+}
+static  void
+Parrot_Null_unshift_string(PARROT_INTERP, SHIM(PMC *_self), SHIM(STRING *value))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_UNSHIFT_STRING);
+}
+static  void
+Parrot_Null_visit(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *info))
+{
+
+    null_pmc_access(interp, PARROT_VTABLE_SLOT_VISIT);
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_Null_update_vtable(VTABLE *vt) {
+    vt->absolute = Parrot_Null_absolute;
+    vt->add = Parrot_Null_add;
+    vt->add_attribute = Parrot_Null_add_attribute;
+    vt->add_float = Parrot_Null_add_float;
+    vt->add_int = Parrot_Null_add_int;
+    vt->add_method = Parrot_Null_add_method;
+    vt->add_parent = Parrot_Null_add_parent;
+    vt->add_role = Parrot_Null_add_role;
+    vt->add_vtable_override = Parrot_Null_add_vtable_override;
+    vt->assign_pmc = Parrot_Null_assign_pmc;
+    vt->assign_string_native = Parrot_Null_assign_string_native;
+    vt->clone = Parrot_Null_clone;
+    vt->clone_pmc = Parrot_Null_clone_pmc;
+    vt->cmp = Parrot_Null_cmp;
+    vt->cmp_num = Parrot_Null_cmp_num;
+    vt->cmp_pmc = Parrot_Null_cmp_pmc;
+    vt->cmp_string = Parrot_Null_cmp_string;
+    vt->concatenate = Parrot_Null_concatenate;
+    vt->concatenate_str = Parrot_Null_concatenate_str;
+    vt->decrement = Parrot_Null_decrement;
+    vt->defined = Parrot_Null_defined;
+    vt->defined_keyed = Parrot_Null_defined_keyed;
+    vt->defined_keyed_int = Parrot_Null_defined_keyed_int;
+    vt->defined_keyed_str = Parrot_Null_defined_keyed_str;
+    vt->delete_keyed = Parrot_Null_delete_keyed;
+    vt->delete_keyed_int = Parrot_Null_delete_keyed_int;
+    vt->delete_keyed_str = Parrot_Null_delete_keyed_str;
+    vt->destroy = Parrot_Null_destroy;
+    vt->divide = Parrot_Null_divide;
+    vt->divide_float = Parrot_Null_divide_float;
+    vt->divide_int = Parrot_Null_divide_int;
+    vt->does = Parrot_Null_does;
+    vt->does_pmc = Parrot_Null_does_pmc;
+    vt->elements = Parrot_Null_elements;
+    vt->exists_keyed = Parrot_Null_exists_keyed;
+    vt->exists_keyed_int = Parrot_Null_exists_keyed_int;
+    vt->exists_keyed_str = Parrot_Null_exists_keyed_str;
+    vt->find_method = Parrot_Null_find_method;
+    vt->floor_divide = Parrot_Null_floor_divide;
+    vt->floor_divide_float = Parrot_Null_floor_divide_float;
+    vt->floor_divide_int = Parrot_Null_floor_divide_int;
+    vt->freeze = Parrot_Null_freeze;
+    vt->get_attr_keyed = Parrot_Null_get_attr_keyed;
+    vt->get_attr_str = Parrot_Null_get_attr_str;
+    vt->get_bool = Parrot_Null_get_bool;
+    vt->get_class = Parrot_Null_get_class;
+    vt->get_integer = Parrot_Null_get_integer;
+    vt->get_integer_keyed = Parrot_Null_get_integer_keyed;
+    vt->get_integer_keyed_int = Parrot_Null_get_integer_keyed_int;
+    vt->get_integer_keyed_str = Parrot_Null_get_integer_keyed_str;
+    vt->get_iter = Parrot_Null_get_iter;
+    vt->get_namespace = Parrot_Null_get_namespace;
+    vt->get_number = Parrot_Null_get_number;
+    vt->get_number_keyed = Parrot_Null_get_number_keyed;
+    vt->get_number_keyed_int = Parrot_Null_get_number_keyed_int;
+    vt->get_number_keyed_str = Parrot_Null_get_number_keyed_str;
+    vt->get_pmc = Parrot_Null_get_pmc;
+    vt->get_pmc_keyed = Parrot_Null_get_pmc_keyed;
+    vt->get_pmc_keyed_int = Parrot_Null_get_pmc_keyed_int;
+    vt->get_pmc_keyed_str = Parrot_Null_get_pmc_keyed_str;
+    vt->get_pointer = Parrot_Null_get_pointer;
+    vt->get_pointer_keyed = Parrot_Null_get_pointer_keyed;
+    vt->get_pointer_keyed_int = Parrot_Null_get_pointer_keyed_int;
+    vt->get_pointer_keyed_str = Parrot_Null_get_pointer_keyed_str;
+    vt->get_repr = Parrot_Null_get_repr;
+    vt->get_string = Parrot_Null_get_string;
+    vt->get_string_keyed = Parrot_Null_get_string_keyed;
+    vt->get_string_keyed_int = Parrot_Null_get_string_keyed_int;
+    vt->get_string_keyed_str = Parrot_Null_get_string_keyed_str;
+    vt->hashvalue = Parrot_Null_hashvalue;
+    vt->i_absolute = Parrot_Null_i_absolute;
+    vt->i_add = Parrot_Null_i_add;
+    vt->i_add_float = Parrot_Null_i_add_float;
+    vt->i_add_int = Parrot_Null_i_add_int;
+    vt->i_concatenate = Parrot_Null_i_concatenate;
+    vt->i_concatenate_str = Parrot_Null_i_concatenate_str;
+    vt->i_divide = Parrot_Null_i_divide;
+    vt->i_divide_float = Parrot_Null_i_divide_float;
+    vt->i_divide_int = Parrot_Null_i_divide_int;
+    vt->i_floor_divide = Parrot_Null_i_floor_divide;
+    vt->i_floor_divide_float = Parrot_Null_i_floor_divide_float;
+    vt->i_floor_divide_int = Parrot_Null_i_floor_divide_int;
+    vt->i_modulus = Parrot_Null_i_modulus;
+    vt->i_modulus_float = Parrot_Null_i_modulus_float;
+    vt->i_modulus_int = Parrot_Null_i_modulus_int;
+    vt->i_multiply = Parrot_Null_i_multiply;
+    vt->i_multiply_float = Parrot_Null_i_multiply_float;
+    vt->i_multiply_int = Parrot_Null_i_multiply_int;
+    vt->i_neg = Parrot_Null_i_neg;
+    vt->i_repeat = Parrot_Null_i_repeat;
+    vt->i_repeat_int = Parrot_Null_i_repeat_int;
+    vt->i_subtract = Parrot_Null_i_subtract;
+    vt->i_subtract_float = Parrot_Null_i_subtract_float;
+    vt->i_subtract_int = Parrot_Null_i_subtract_int;
+    vt->increment = Parrot_Null_increment;
+    vt->init = Parrot_Null_init;
+    vt->init_int = Parrot_Null_init_int;
+    vt->init_pmc = Parrot_Null_init_pmc;
+    vt->inspect = Parrot_Null_inspect;
+    vt->inspect_str = Parrot_Null_inspect_str;
+    vt->instantiate = Parrot_Null_instantiate;
+    vt->invoke = Parrot_Null_invoke;
+    vt->is_equal = Parrot_Null_is_equal;
+    vt->is_equal_num = Parrot_Null_is_equal_num;
+    vt->is_equal_string = Parrot_Null_is_equal_string;
+    vt->is_same = Parrot_Null_is_same;
+    vt->isa = Parrot_Null_isa;
+    vt->isa_pmc = Parrot_Null_isa_pmc;
+    vt->mark = Parrot_Null_mark;
+    vt->modulus = Parrot_Null_modulus;
+    vt->modulus_float = Parrot_Null_modulus_float;
+    vt->modulus_int = Parrot_Null_modulus_int;
+    vt->morph = Parrot_Null_morph;
+    vt->multiply = Parrot_Null_multiply;
+    vt->multiply_float = Parrot_Null_multiply_float;
+    vt->multiply_int = Parrot_Null_multiply_int;
+    vt->name = Parrot_Null_name;
+    vt->neg = Parrot_Null_neg;
+    vt->pop_float = Parrot_Null_pop_float;
+    vt->pop_integer = Parrot_Null_pop_integer;
+    vt->pop_pmc = Parrot_Null_pop_pmc;
+    vt->pop_string = Parrot_Null_pop_string;
+    vt->push_float = Parrot_Null_push_float;
+    vt->push_integer = Parrot_Null_push_integer;
+    vt->push_pmc = Parrot_Null_push_pmc;
+    vt->push_string = Parrot_Null_push_string;
+    vt->remove_attribute = Parrot_Null_remove_attribute;
+    vt->remove_method = Parrot_Null_remove_method;
+    vt->remove_parent = Parrot_Null_remove_parent;
+    vt->remove_role = Parrot_Null_remove_role;
+    vt->remove_vtable_override = Parrot_Null_remove_vtable_override;
+    vt->repeat = Parrot_Null_repeat;
+    vt->repeat_int = Parrot_Null_repeat_int;
+    vt->set_attr_keyed = Parrot_Null_set_attr_keyed;
+    vt->set_attr_str = Parrot_Null_set_attr_str;
+    vt->set_bool = Parrot_Null_set_bool;
+    vt->set_integer_keyed = Parrot_Null_set_integer_keyed;
+    vt->set_integer_keyed_int = Parrot_Null_set_integer_keyed_int;
+    vt->set_integer_keyed_str = Parrot_Null_set_integer_keyed_str;
+    vt->set_integer_native = Parrot_Null_set_integer_native;
+    vt->set_number_keyed = Parrot_Null_set_number_keyed;
+    vt->set_number_keyed_int = Parrot_Null_set_number_keyed_int;
+    vt->set_number_keyed_str = Parrot_Null_set_number_keyed_str;
+    vt->set_number_native = Parrot_Null_set_number_native;
+    vt->set_pmc = Parrot_Null_set_pmc;
+    vt->set_pmc_keyed = Parrot_Null_set_pmc_keyed;
+    vt->set_pmc_keyed_int = Parrot_Null_set_pmc_keyed_int;
+    vt->set_pmc_keyed_str = Parrot_Null_set_pmc_keyed_str;
+    vt->set_pointer = Parrot_Null_set_pointer;
+    vt->set_pointer_keyed = Parrot_Null_set_pointer_keyed;
+    vt->set_pointer_keyed_int = Parrot_Null_set_pointer_keyed_int;
+    vt->set_pointer_keyed_str = Parrot_Null_set_pointer_keyed_str;
+    vt->set_string_keyed = Parrot_Null_set_string_keyed;
+    vt->set_string_keyed_int = Parrot_Null_set_string_keyed_int;
+    vt->set_string_keyed_str = Parrot_Null_set_string_keyed_str;
+    vt->set_string_native = Parrot_Null_set_string_native;
+    vt->share = Parrot_Null_share;
+    vt->shift_float = Parrot_Null_shift_float;
+    vt->shift_integer = Parrot_Null_shift_integer;
+    vt->shift_pmc = Parrot_Null_shift_pmc;
+    vt->shift_string = Parrot_Null_shift_string;
+    vt->splice = Parrot_Null_splice;
+    vt->substr = Parrot_Null_substr;
+    vt->subtract = Parrot_Null_subtract;
+    vt->subtract_float = Parrot_Null_subtract_float;
+    vt->subtract_int = Parrot_Null_subtract_int;
+    vt->thaw = Parrot_Null_thaw;
+    vt->thawfinish = Parrot_Null_thawfinish;
+    vt->type = Parrot_Null_type;
+    vt->unshift_float = Parrot_Null_unshift_float;
+    vt->unshift_integer = Parrot_Null_unshift_integer;
+    vt->unshift_pmc = Parrot_Null_unshift_pmc;
+    vt->unshift_string = Parrot_Null_unshift_string;
+    vt->visit = Parrot_Null_visit;
+    vt->attr_size = 0;
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_Null_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->absolute = Parrot_Null_absolute;
+    vt->add = Parrot_Null_add;
+    vt->add_float = Parrot_Null_add_float;
+    vt->add_int = Parrot_Null_add_int;
+    vt->clone = Parrot_Null_clone;
+    vt->clone_pmc = Parrot_Null_clone_pmc;
+    vt->cmp = Parrot_Null_cmp;
+    vt->cmp_num = Parrot_Null_cmp_num;
+    vt->cmp_pmc = Parrot_Null_cmp_pmc;
+    vt->cmp_string = Parrot_Null_cmp_string;
+    vt->concatenate = Parrot_Null_concatenate;
+    vt->concatenate_str = Parrot_Null_concatenate_str;
+    vt->defined = Parrot_Null_defined;
+    vt->defined_keyed = Parrot_Null_defined_keyed;
+    vt->defined_keyed_int = Parrot_Null_defined_keyed_int;
+    vt->defined_keyed_str = Parrot_Null_defined_keyed_str;
+    vt->destroy = Parrot_Null_destroy;
+    vt->divide = Parrot_Null_divide;
+    vt->divide_float = Parrot_Null_divide_float;
+    vt->divide_int = Parrot_Null_divide_int;
+    vt->does = Parrot_Null_does;
+    vt->does_pmc = Parrot_Null_does_pmc;
+    vt->elements = Parrot_Null_elements;
+    vt->exists_keyed = Parrot_Null_exists_keyed;
+    vt->exists_keyed_int = Parrot_Null_exists_keyed_int;
+    vt->exists_keyed_str = Parrot_Null_exists_keyed_str;
+    vt->find_method = Parrot_Null_find_method;
+    vt->floor_divide = Parrot_Null_floor_divide;
+    vt->floor_divide_float = Parrot_Null_floor_divide_float;
+    vt->floor_divide_int = Parrot_Null_floor_divide_int;
+    vt->freeze = Parrot_Null_freeze;
+    vt->get_attr_keyed = Parrot_Null_get_attr_keyed;
+    vt->get_attr_str = Parrot_Null_get_attr_str;
+    vt->get_bool = Parrot_Null_get_bool;
+    vt->get_class = Parrot_Null_get_class;
+    vt->get_integer = Parrot_Null_get_integer;
+    vt->get_integer_keyed = Parrot_Null_get_integer_keyed;
+    vt->get_integer_keyed_int = Parrot_Null_get_integer_keyed_int;
+    vt->get_integer_keyed_str = Parrot_Null_get_integer_keyed_str;
+    vt->get_iter = Parrot_Null_get_iter;
+    vt->get_namespace = Parrot_Null_get_namespace;
+    vt->get_number = Parrot_Null_get_number;
+    vt->get_number_keyed = Parrot_Null_get_number_keyed;
+    vt->get_number_keyed_int = Parrot_Null_get_number_keyed_int;
+    vt->get_number_keyed_str = Parrot_Null_get_number_keyed_str;
+    vt->get_pmc = Parrot_Null_get_pmc;
+    vt->get_pmc_keyed = Parrot_Null_get_pmc_keyed;
+    vt->get_pmc_keyed_int = Parrot_Null_get_pmc_keyed_int;
+    vt->get_pmc_keyed_str = Parrot_Null_get_pmc_keyed_str;
+    vt->get_pointer = Parrot_Null_get_pointer;
+    vt->get_pointer_keyed = Parrot_Null_get_pointer_keyed;
+    vt->get_pointer_keyed_int = Parrot_Null_get_pointer_keyed_int;
+    vt->get_pointer_keyed_str = Parrot_Null_get_pointer_keyed_str;
+    vt->get_repr = Parrot_Null_get_repr;
+    vt->get_string = Parrot_Null_get_string;
+    vt->get_string_keyed = Parrot_Null_get_string_keyed;
+    vt->get_string_keyed_int = Parrot_Null_get_string_keyed_int;
+    vt->get_string_keyed_str = Parrot_Null_get_string_keyed_str;
+    vt->hashvalue = Parrot_Null_hashvalue;
+    vt->inspect = Parrot_Null_inspect;
+    vt->inspect_str = Parrot_Null_inspect_str;
+    vt->instantiate = Parrot_Null_instantiate;
+    vt->invoke = Parrot_Null_invoke;
+    vt->is_equal = Parrot_Null_is_equal;
+    vt->is_equal_num = Parrot_Null_is_equal_num;
+    vt->is_equal_string = Parrot_Null_is_equal_string;
+    vt->is_same = Parrot_Null_is_same;
+    vt->isa = Parrot_Null_isa;
+    vt->isa_pmc = Parrot_Null_isa_pmc;
+    vt->mark = Parrot_Null_mark;
+    vt->modulus = Parrot_Null_modulus;
+    vt->modulus_float = Parrot_Null_modulus_float;
+    vt->modulus_int = Parrot_Null_modulus_int;
+    vt->multiply = Parrot_Null_multiply;
+    vt->multiply_float = Parrot_Null_multiply_float;
+    vt->multiply_int = Parrot_Null_multiply_int;
+    vt->name = Parrot_Null_name;
+    vt->neg = Parrot_Null_neg;
+    vt->repeat = Parrot_Null_repeat;
+    vt->repeat_int = Parrot_Null_repeat_int;
+    vt->substr = Parrot_Null_substr;
+    vt->subtract = Parrot_Null_subtract;
+    vt->subtract_float = Parrot_Null_subtract_float;
+    vt->subtract_int = Parrot_Null_subtract_int;
+    vt->type = Parrot_Null_type;
+    vt->visit = Parrot_Null_visit;
+    vt->attr_size = 0;
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Null_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_Null_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Null_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_Null_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_Null_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "Null"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_Null_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "Null")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_Null_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_Null_get_vtable(interp);
+        vt->base_type      = enum_class_Null;
+        vt->flags          = 0|VTABLE_PMC_IS_SINGLETON;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "Null");
+        vt->provides_str = CONST_STRING_GEN(interp, "scalar");
+        vt->isa_hash     = Parrot_Null_get_isa(interp, NULL);
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_Null_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+        }
+    } /* pass */
+} /* Parrot_Null_class_init */
+
+#line 102 "./src/pmc/null.pmc"
+
+
+/*
+
+=back
+
+=head2 Auxiliary functions
+
+=over 4
+
+=item C<static void null_pmc_access(PARROT_INTERP, int index)>
+
+Throws the Null PMC access exception.
+
+=cut
+
+*/
+
+PARROT_DOES_NOT_RETURN
+static void
+null_pmc_access(PARROT_INTERP, int index)
+{
+    ASSERT_ARGS(null_pmc_access)
+    Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_NULL_REG_ACCESS,
+            "Null PMC access in %s()",
+            Parrot_get_vtable_name(interp, index));
+}
+
+/*
+
+=back
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
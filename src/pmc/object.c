@@ -0,0 +1,5959 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/object.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_object.h"
+#include "pmc_default.h"
+#include "object.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/object.pmc"
+/*
+Copyright (C) 2001-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/object.pmc - Object PMC
+
+=head1 DESCRIPTION
+
+Implements an instance of a class.
+
+TODO: If a vtable override exists, calls the found method via the slow
+Parrot_ext_call, which creates a new interp, task and calls a new runloop.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "parrot/oo_private.h"
+#include "pmc/pmc_class.h"
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+static void cache_method(PARROT_INTERP,
+    ARGIN(PMC *_class),
+    ARGIN(STRING *name),
+    ARGIN(PMC *method))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4);
+
+PARROT_CAN_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static PMC* clone_key_arg(PARROT_INTERP, ARGIN(PMC *key))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static PMC * find_cached(PARROT_INTERP,
+    ARGIN(PMC *_class),
+    ARGIN(STRING *name))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL get_attrib_index(PARROT_INTERP,
+    ARGIN(PMC *self),
+    ARGIN(STRING *name))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL get_attrib_index_keyed(PARROT_INTERP,
+    ARGIN(PMC *self),
+    ARGIN(PMC *key),
+    ARGIN(STRING *name))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4);
+
+#define ASSERT_ARGS_cache_method __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(_class) \
+    , PARROT_ASSERT_ARG(name) \
+    , PARROT_ASSERT_ARG(method))
+#define ASSERT_ARGS_clone_key_arg __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(key))
+#define ASSERT_ARGS_find_cached __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(_class) \
+    , PARROT_ASSERT_ARG(name))
+#define ASSERT_ARGS_get_attrib_index __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(name))
+#define ASSERT_ARGS_get_attrib_index_keyed __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(key) \
+    , PARROT_ASSERT_ARG(name))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+/*
+
+=item C<static INTVAL get_attrib_index(PARROT_INTERP, PMC *self, STRING *name)>
+
+Find the index of an attribute in an object's attribute store and return it.
+Return -1 if the attribute does not exist.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL
+get_attrib_index(PARROT_INTERP, ARGIN(PMC *self), ARGIN(STRING *name))
+{
+    ASSERT_ARGS(get_attrib_index)
+    Parrot_Class_attributes * const _class  = PARROT_CLASS(self);
+    const INTVAL                    cur_hll = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp));
+    INTVAL                          index   = -1;
+    int                             num_classes, i;
+
+    /* First see if we can find it in the cache. */
+    const INTVAL retval  = VTABLE_get_integer_keyed_str(interp,
+                                         _class->attrib_cache, name);
+
+    /* there's a semi-predicate problem with a retval of 0 */
+    if (retval
+    ||  VTABLE_exists_keyed_str(interp, _class->attrib_cache, name))
+        return retval;
+
+    /* No hit. We need to walk up the list of parents to try and find the
+     * attribute. */
+    Parrot_pcc_set_HLL(interp, CURRENT_CONTEXT(interp), 0);
+
+    num_classes = VTABLE_elements(interp, _class->all_parents);
+
+    for (i = 0; i < num_classes; i++) {
+        /* Get the class and its attribute metadata hash. */
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp,
+            _class->all_parents, i);
+
+        /* Build a string representing the fully qualified attribute name. */
+        STRING *fq_name = VTABLE_get_string(interp, cur_class);
+        fq_name         = Parrot_str_concat(interp, fq_name, name);
+
+        /* Look up. */
+        if (VTABLE_exists_keyed_str(interp, _class->attrib_index, fq_name)) {
+            /* Found it. Get value, cache it and we're done. */
+            index = VTABLE_get_integer_keyed_str(interp,
+                _class->attrib_index, fq_name);
+            VTABLE_set_integer_keyed_str(interp, _class->attrib_cache, name,
+                index);
+
+            break;
+        }
+    }
+
+    Parrot_pcc_set_HLL(interp, CURRENT_CONTEXT(interp), cur_hll);
+    return index;
+}
+
+/*
+
+=item C<static INTVAL get_attrib_index_keyed(PARROT_INTERP, PMC *self, PMC *key,
+STRING *name)>
+
+This variation bypasses the cache and finds the index of a particular
+parent's attribute in an object's attribute store and returns it.
+Returns C<-1> if the attribute does not exist.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL
+get_attrib_index_keyed(PARROT_INTERP, ARGIN(PMC *self), ARGIN(PMC *key), ARGIN(STRING *name))
+{
+    ASSERT_ARGS(get_attrib_index_keyed)
+    Parrot_Class_attributes * const _class = PARROT_CLASS(self);
+
+    /* Build a string representing the fully qualified attribute name. */
+    PMC    * const parent_class = Parrot_oo_get_class(interp, key);
+    STRING * const fq_name      = Parrot_str_concat(interp,
+                                VTABLE_get_string(interp, parent_class), name);
+
+    /* Look up. */
+    if (VTABLE_exists_keyed_str(interp, _class->attrib_index, fq_name))
+        return VTABLE_get_integer_keyed_str(interp,
+            _class->attrib_index, fq_name);
+
+    return -1;
+}
+
+/*
+
+=item C<static PMC * find_cached(PARROT_INTERP, PMC *_class, STRING *name)>
+
+Search for a method in a class' method cache, if available.  If no cache is
+available, return PMCNULL.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static PMC *
+find_cached(PARROT_INTERP, ARGIN(PMC *_class), ARGIN(STRING *name))
+{
+    ASSERT_ARGS(find_cached)
+    PMC *cache;
+    GETATTR_Class_meth_cache(interp, _class, cache);
+
+    if (PMC_IS_NULL(cache))
+        return PMCNULL;
+
+    return VTABLE_get_pmc_keyed_str(interp, cache, name);
+}
+
+/*
+
+=item C<static void cache_method(PARROT_INTERP, PMC *_class, STRING *name, PMC
+*method)>
+
+Add a method to a class' method cache.  If no method cache exists, create one.
+
+=cut
+
+*/
+
+static void
+cache_method(PARROT_INTERP, ARGIN(PMC *_class), ARGIN(STRING *name),
+ARGIN(PMC *method))
+{
+    ASSERT_ARGS(cache_method)
+    PMC *cache;
+    GETATTR_Class_meth_cache(interp, _class, cache);
+
+    if (PMC_IS_NULL(cache)) {
+        cache = Parrot_pmc_new(interp, enum_class_Hash);
+        PARROT_GC_WRITE_BARRIER(interp, _class);
+        SETATTR_Class_meth_cache(interp, _class, cache);
+    }
+
+    VTABLE_set_pmc_keyed_str(interp, cache, name, method);
+}
+
+/*
+
+=item C<static PMC* clone_key_arg(PARROT_INTERP, PMC *key)>
+
+Replaces any src registers by their values. Used for C<*_keyed> overrides.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static PMC*
+clone_key_arg(PARROT_INTERP, ARGIN(PMC *key))
+{
+    ASSERT_ARGS(clone_key_arg)
+    PMC *t;
+
+    if (PMC_IS_NULL(key))
+        return key;
+
+    if (key->vtable->base_type != enum_class_Key)
+        return key;
+
+    for (t = key; !PMC_IS_NULL(t); t=Parrot_key_next(interp, t)) {
+        /* register keys have to be cloned */
+        if (PObj_get_FLAGS(key) & KEY_register_FLAG) {
+            return VTABLE_clone(interp, key);
+        }
+    }
+
+    return key;
+}
+#line 299 "./src/pmc/object.c"
+static  PMC * Parrot_Object_absolute(PARROT_INTERP, ARGMOD(PMC *_self), PMC *dest);
+static  PMC * Parrot_Object_add(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest);
+static  void Parrot_Object_add_attribute(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name, PMC *type);
+static  PMC * Parrot_Object_add_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest);
+static  PMC * Parrot_Object_add_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest);
+static  void Parrot_Object_add_method(PARROT_INTERP, ARGMOD(PMC *_self), STRING *method_name, PMC *sub_pmc);
+static  void Parrot_Object_add_parent(PARROT_INTERP, ARGMOD(PMC *_self), PMC *parent);
+static  void Parrot_Object_add_role(PARROT_INTERP, ARGMOD(PMC *_self), PMC *role);
+static  void Parrot_Object_add_vtable_override(PARROT_INTERP, ARGMOD(PMC *_self), STRING *vtable_name, PMC *sub_pmc);
+static  void Parrot_Object_assign_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void Parrot_Object_assign_string_native(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value);
+static  PMC *  Parrot_Object_clone(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC * Parrot_Object_clone_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *args);
+static  INTVAL Parrot_Object_cmp(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  INTVAL Parrot_Object_cmp_num(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  PMC * Parrot_Object_cmp_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  INTVAL Parrot_Object_cmp_string(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  PMC * Parrot_Object_concatenate(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest);
+static  PMC * Parrot_Object_concatenate_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value, PMC *dest);
+static  void Parrot_Object_decrement(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL Parrot_Object_defined(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL Parrot_Object_defined_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  INTVAL Parrot_Object_defined_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  INTVAL Parrot_Object_defined_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key);
+static  void Parrot_Object_delete_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  void Parrot_Object_delete_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  void Parrot_Object_delete_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key);
+static  void  Parrot_Object_destroy(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC * Parrot_Object_divide(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest);
+static  PMC * Parrot_Object_divide_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest);
+static  PMC * Parrot_Object_divide_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest);
+static  INTVAL  Parrot_Object_does(PARROT_INTERP, ARGMOD(PMC *_self), STRING *role_name);
+static  INTVAL  Parrot_Object_does_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *role);
+static  INTVAL Parrot_Object_elements(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL Parrot_Object_exists_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  INTVAL Parrot_Object_exists_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  INTVAL Parrot_Object_exists_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key);
+static  PMC  * Parrot_Object_find_method(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name);
+static  PMC * Parrot_Object_floor_divide(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest);
+static  PMC * Parrot_Object_floor_divide_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest);
+static  PMC * Parrot_Object_floor_divide_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest);
+static  void  Parrot_Object_freeze(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+static  PMC  * Parrot_Object_get_attr_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, STRING *name);
+static  PMC  * Parrot_Object_get_attr_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name);
+static  INTVAL Parrot_Object_get_bool(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC  * Parrot_Object_get_class(SHIM_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_Object_get_integer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL Parrot_Object_get_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  INTVAL Parrot_Object_get_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  INTVAL Parrot_Object_get_integer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key);
+static  PMC * Parrot_Object_get_iter(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC  * Parrot_Object_get_namespace(PARROT_INTERP, ARGMOD(PMC *_self));
+static  FLOATVAL Parrot_Object_get_number(PARROT_INTERP, ARGMOD(PMC *_self));
+static  FLOATVAL Parrot_Object_get_number_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  FLOATVAL Parrot_Object_get_number_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  FLOATVAL Parrot_Object_get_number_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key);
+static  PMC * Parrot_Object_get_pmc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC * Parrot_Object_get_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  PMC * Parrot_Object_get_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  PMC * Parrot_Object_get_pmc_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key);
+static  void * Parrot_Object_get_pointer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void * Parrot_Object_get_pointer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  void * Parrot_Object_get_pointer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  void * Parrot_Object_get_pointer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key);
+static  STRING * Parrot_Object_get_repr(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING * Parrot_Object_get_string(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING * Parrot_Object_get_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  STRING * Parrot_Object_get_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  STRING * Parrot_Object_get_string_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key);
+static  INTVAL Parrot_Object_hashvalue(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Object_i_absolute(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Object_i_add(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void Parrot_Object_i_add_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value);
+static  void Parrot_Object_i_add_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void Parrot_Object_i_concatenate(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void Parrot_Object_i_concatenate_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value);
+static  void Parrot_Object_i_divide(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void Parrot_Object_i_divide_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value);
+static  void Parrot_Object_i_divide_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void Parrot_Object_i_floor_divide(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void Parrot_Object_i_floor_divide_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value);
+static  void Parrot_Object_i_floor_divide_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void Parrot_Object_i_modulus(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void Parrot_Object_i_modulus_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value);
+static  void Parrot_Object_i_modulus_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void Parrot_Object_i_multiply(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void Parrot_Object_i_multiply_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value);
+static  void Parrot_Object_i_multiply_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void Parrot_Object_i_neg(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Object_i_repeat(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void Parrot_Object_i_repeat_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void Parrot_Object_i_subtract(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void Parrot_Object_i_subtract_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value);
+static  void Parrot_Object_i_subtract_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void Parrot_Object_increment(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Object_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Object_init_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL initializer);
+static  void  Parrot_Object_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *from);
+static  PMC * Parrot_Object_inspect(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC * Parrot_Object_inspect_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *what);
+static  PMC * Parrot_Object_instantiate(PARROT_INTERP, ARGMOD(PMC *_self), PMC *sig);
+static  opcode_t *  Parrot_Object_invoke(PARROT_INTERP, ARGMOD(PMC *_self), void *next);
+static  INTVAL Parrot_Object_is_equal(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  INTVAL Parrot_Object_is_equal_num(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  INTVAL Parrot_Object_is_equal_string(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  INTVAL Parrot_Object_is_same(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  INTVAL  Parrot_Object_isa(PARROT_INTERP, ARGMOD(PMC *_self), STRING *classname);
+static  INTVAL  Parrot_Object_isa_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *lookup);
+static  void  Parrot_Object_mark(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC * Parrot_Object_modulus(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest);
+static  PMC * Parrot_Object_modulus_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest);
+static  PMC * Parrot_Object_modulus_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest);
+static  void  Parrot_Object_morph(PARROT_INTERP, ARGMOD(PMC *_self), PMC *type);
+static  PMC * Parrot_Object_multiply(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest);
+static  PMC * Parrot_Object_multiply_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest);
+static  PMC * Parrot_Object_multiply_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest);
+static  STRING  * Parrot_Object_name(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC * Parrot_Object_neg(PARROT_INTERP, ARGMOD(PMC *_self), PMC *dest);
+static  FLOATVAL Parrot_Object_pop_float(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL Parrot_Object_pop_integer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC * Parrot_Object_pop_pmc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING * Parrot_Object_pop_string(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Object_push_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value);
+static  void Parrot_Object_push_integer(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void Parrot_Object_push_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void Parrot_Object_push_string(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value);
+static  void Parrot_Object_remove_attribute(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name);
+static  void Parrot_Object_remove_method(PARROT_INTERP, ARGMOD(PMC *_self), STRING *method_name);
+static  void Parrot_Object_remove_parent(PARROT_INTERP, ARGMOD(PMC *_self), PMC *parent);
+static  void Parrot_Object_remove_role(PARROT_INTERP, ARGMOD(PMC *_self), PMC *role);
+static  void Parrot_Object_remove_vtable_override(PARROT_INTERP, ARGMOD(PMC *_self), STRING *vtable_name);
+static  PMC * Parrot_Object_repeat(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest);
+static  PMC * Parrot_Object_repeat_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest);
+static  void  Parrot_Object_set_attr_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, STRING *name, PMC *value);
+static  void  Parrot_Object_set_attr_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name, PMC *value);
+static  void Parrot_Object_set_bool(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void Parrot_Object_set_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, INTVAL value);
+static  void Parrot_Object_set_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, INTVAL value);
+static  void Parrot_Object_set_integer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key, INTVAL value);
+static  void Parrot_Object_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void Parrot_Object_set_number_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, FLOATVAL value);
+static  void Parrot_Object_set_number_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, FLOATVAL value);
+static  void Parrot_Object_set_number_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key, FLOATVAL value);
+static  void Parrot_Object_set_number_native(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value);
+static  void Parrot_Object_set_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void Parrot_Object_set_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, PMC *value);
+static  void Parrot_Object_set_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, PMC *value);
+static  void Parrot_Object_set_pmc_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key, PMC *value);
+static  void Parrot_Object_set_pointer(PARROT_INTERP, ARGMOD(PMC *_self), void *value);
+static  void Parrot_Object_set_pointer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, void *value);
+static  void Parrot_Object_set_pointer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, void *value);
+static  void Parrot_Object_set_pointer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key, void *value);
+static  void Parrot_Object_set_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, STRING *value);
+static  void Parrot_Object_set_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, STRING *value);
+static  void Parrot_Object_set_string_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key, STRING *value);
+static  void Parrot_Object_set_string_native(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value);
+static  void Parrot_Object_share(PARROT_INTERP, ARGMOD(PMC *_self));
+static  FLOATVAL Parrot_Object_shift_float(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL Parrot_Object_shift_integer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC * Parrot_Object_shift_pmc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING * Parrot_Object_shift_string(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Object_splice(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, INTVAL offset, INTVAL count);
+static  STRING * Parrot_Object_substr(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL offset, INTVAL length);
+static  PMC * Parrot_Object_subtract(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest);
+static  PMC * Parrot_Object_subtract_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest);
+static  PMC * Parrot_Object_subtract_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest);
+static  void  Parrot_Object_thaw(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+static  void  Parrot_Object_thawfinish(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *info));
+static  INTVAL  Parrot_Object_type(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Object_unshift_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value);
+static  void Parrot_Object_unshift_integer(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void Parrot_Object_unshift_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void Parrot_Object_unshift_string(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value);
+static  void  Parrot_Object_visit(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+void    Parrot_Object_class_init(PARROT_INTERP, int, int);
+void    Parrot_Object_ro_class_init(PARROT_INTERP, int, int);
+static  PMC *
+Parrot_Object_absolute(PARROT_INTERP, ARGMOD(PMC *_self), PMC *dest)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "absolute");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            PMC* result = PMCNULL;
+            Parrot_ext_call(interp, meth, "PiP->P", _self, dest, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (PMC*) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (PMC*)VTABLE_absolute(interp, del_object, dest);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (PMC*)interp->vtables[enum_class_default]->absolute(interp, _self, dest);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  PMC *
+Parrot_Object_add(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "add");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            PMC* result = PMCNULL;
+            Parrot_ext_call(interp, meth, "PiPP->P", _self, value, dest, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (PMC*) result;
+        }
+    }
+    return (PMC*)interp->vtables[enum_class_default]->add(interp, _self, value, dest);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  void
+Parrot_Object_add_attribute(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name, PMC *type)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "add_attribute");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiSP->", _self, name, type);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_add_attribute(interp, del_object, name, type);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->add_attribute(interp, _self, name, type);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  PMC *
+Parrot_Object_add_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "add_float");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            PMC* result = PMCNULL;
+            Parrot_ext_call(interp, meth, "PiNP->P", _self, value, dest, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (PMC*) result;
+        }
+    }
+    return (PMC*)interp->vtables[enum_class_default]->add_float(interp, _self, value, dest);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  PMC *
+Parrot_Object_add_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "add_int");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            PMC* result = PMCNULL;
+            Parrot_ext_call(interp, meth, "PiIP->P", _self, value, dest, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (PMC*) result;
+        }
+    }
+    return (PMC*)interp->vtables[enum_class_default]->add_int(interp, _self, value, dest);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  void
+Parrot_Object_add_method(PARROT_INTERP, ARGMOD(PMC *_self), STRING *method_name, PMC *sub_pmc)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "add_method");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiSP->", _self, method_name, sub_pmc);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_add_method(interp, del_object, method_name, sub_pmc);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->add_method(interp, _self, method_name, sub_pmc);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_add_parent(PARROT_INTERP, ARGMOD(PMC *_self), PMC *parent)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "add_parent");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiP->", _self, parent);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_add_parent(interp, del_object, parent);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->add_parent(interp, _self, parent);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_add_role(PARROT_INTERP, ARGMOD(PMC *_self), PMC *role)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "add_role");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiP->", _self, role);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_add_role(interp, del_object, role);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->add_role(interp, _self, role);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_add_vtable_override(PARROT_INTERP, ARGMOD(PMC *_self), STRING *vtable_name, PMC *sub_pmc)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "add_vtable_override");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiSP->", _self, vtable_name, sub_pmc);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_add_vtable_override(interp, del_object, vtable_name, sub_pmc);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->add_vtable_override(interp, _self, vtable_name, sub_pmc);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_assign_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "assign_pmc");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiP->", _self, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_assign_pmc(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->assign_pmc(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_assign_string_native(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "assign_string_native");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiS->", _self, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_assign_string_native(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->assign_string_native(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  PMC * 
+Parrot_Object_clone(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 900 "./src/pmc/object.pmc"
+
+    Parrot_Object_attributes * const obj = PARROT_OBJECT(_self);
+    /* If we have a custom override, invoke it.
+     * If not, use the oo function. */
+    STRING * const meth_name = CONST_STRING(interp, "clone");
+
+    PMC    * const meth      =
+            Parrot_oo_find_vtable_override(interp, obj->_class, meth_name);
+
+    if (!PMC_IS_NULL(meth)) {
+        PMC *result;
+        Parrot_ext_call(interp, meth, "Pi->P", _self, &result);
+        return result;
+    }
+
+    return Parrot_oo_clone_object(interp, _self, NULL);
+#line 810 "./src/pmc/object.c"
+}
+static  PMC *
+Parrot_Object_clone_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *args)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "clone_pmc");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            PMC* result = PMCNULL;
+            Parrot_ext_call(interp, meth, "PiP->P", _self, args, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (PMC*) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (PMC*)VTABLE_clone_pmc(interp, del_object, args);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (PMC*)interp->vtables[enum_class_default]->clone_pmc(interp, _self, args);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  INTVAL
+Parrot_Object_cmp(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "cmp");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            INTVAL result;
+            Parrot_ext_call(interp, meth, "PiP->I", _self, value, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (INTVAL) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (INTVAL)VTABLE_cmp(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (INTVAL)interp->vtables[enum_class_default]->cmp(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  INTVAL
+Parrot_Object_cmp_num(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "cmp_num");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            INTVAL result;
+            Parrot_ext_call(interp, meth, "PiP->I", _self, value, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (INTVAL) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (INTVAL)VTABLE_cmp_num(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (INTVAL)interp->vtables[enum_class_default]->cmp_num(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  PMC *
+Parrot_Object_cmp_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "cmp_pmc");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            PMC* result = PMCNULL;
+            Parrot_ext_call(interp, meth, "PiP->P", _self, value, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (PMC*) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (PMC*)VTABLE_cmp_pmc(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (PMC*)interp->vtables[enum_class_default]->cmp_pmc(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  INTVAL
+Parrot_Object_cmp_string(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "cmp_string");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            INTVAL result;
+            Parrot_ext_call(interp, meth, "PiP->I", _self, value, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (INTVAL) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (INTVAL)VTABLE_cmp_string(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (INTVAL)interp->vtables[enum_class_default]->cmp_string(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  PMC *
+Parrot_Object_concatenate(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "concatenate");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            PMC* result = PMCNULL;
+            Parrot_ext_call(interp, meth, "PiPP->P", _self, value, dest, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (PMC*) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (PMC*)VTABLE_concatenate(interp, del_object, value, dest);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (PMC*)interp->vtables[enum_class_default]->concatenate(interp, _self, value, dest);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  PMC *
+Parrot_Object_concatenate_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value, PMC *dest)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "concatenate_str");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            PMC* result = PMCNULL;
+            Parrot_ext_call(interp, meth, "PiSP->P", _self, value, dest, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (PMC*) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (PMC*)VTABLE_concatenate_str(interp, del_object, value, dest);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (PMC*)interp->vtables[enum_class_default]->concatenate_str(interp, _self, value, dest);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  void
+Parrot_Object_decrement(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "decrement");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "Pi->", _self);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_decrement(interp, del_object);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->decrement(interp, _self);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  INTVAL
+Parrot_Object_defined(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "defined");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            INTVAL result;
+            Parrot_ext_call(interp, meth, "Pi->I", _self, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (INTVAL) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (INTVAL)VTABLE_defined(interp, del_object);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (INTVAL)interp->vtables[enum_class_default]->defined(interp, _self);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  INTVAL
+Parrot_Object_defined_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "defined_keyed");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            INTVAL result;
+            key = clone_key_arg(interp, key);
+            Parrot_ext_call(interp, meth, "PiP->I", _self, key, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (INTVAL) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (INTVAL)VTABLE_defined_keyed(interp, del_object, key);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (INTVAL)interp->vtables[enum_class_default]->defined_keyed(interp, _self, key);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  INTVAL
+Parrot_Object_defined_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "defined_keyed_int");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            INTVAL result;
+            Parrot_ext_call(interp, meth, "PiI->I", _self, key, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (INTVAL) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (INTVAL)VTABLE_defined_keyed_int(interp, del_object, key);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (INTVAL)interp->vtables[enum_class_default]->defined_keyed_int(interp, _self, key);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  INTVAL
+Parrot_Object_defined_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "defined_keyed_str");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            INTVAL result;
+            Parrot_ext_call(interp, meth, "PiS->I", _self, key, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (INTVAL) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (INTVAL)VTABLE_defined_keyed_str(interp, del_object, key);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (INTVAL)interp->vtables[enum_class_default]->defined_keyed_str(interp, _self, key);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  void
+Parrot_Object_delete_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "delete_keyed");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            key = clone_key_arg(interp, key);
+            Parrot_ext_call(interp, meth, "PiP->", _self, key);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_delete_keyed(interp, del_object, key);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->delete_keyed(interp, _self, key);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_delete_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "delete_keyed_int");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiI->", _self, key);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_delete_keyed_int(interp, del_object, key);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->delete_keyed_int(interp, _self, key);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_delete_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "delete_keyed_str");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiS->", _self, key);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_delete_keyed_str(interp, del_object, key);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->delete_keyed_str(interp, _self, key);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void 
+Parrot_Object_destroy(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 330 "./src/pmc/object.pmc"
+
+    Parrot_Object_attributes * const obj = PARROT_OBJECT(_self);
+
+    if (obj && obj->attrib_store) {
+        Parrot_gc_free_fixed_size_storage(interp,
+            obj->num_attribs * sizeof (Parrot_Object_slot), obj->attrib_store);
+        obj->attrib_store = NULL;
+        obj->num_attribs  = 0;
+    }
+#line 1292 "./src/pmc/object.c"
+}
+static  PMC *
+Parrot_Object_divide(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "divide");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            PMC* result = PMCNULL;
+            Parrot_ext_call(interp, meth, "PiPP->P", _self, value, dest, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (PMC*) result;
+        }
+    }
+    return (PMC*)interp->vtables[enum_class_default]->divide(interp, _self, value, dest);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  PMC *
+Parrot_Object_divide_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "divide_float");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            PMC* result = PMCNULL;
+            Parrot_ext_call(interp, meth, "PiNP->P", _self, value, dest, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (PMC*) result;
+        }
+    }
+    return (PMC*)interp->vtables[enum_class_default]->divide_float(interp, _self, value, dest);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  PMC *
+Parrot_Object_divide_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "divide_int");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            PMC* result = PMCNULL;
+            Parrot_ext_call(interp, meth, "PiIP->P", _self, value, dest, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (PMC*) result;
+        }
+    }
+    return (PMC*)interp->vtables[enum_class_default]->divide_int(interp, _self, value, dest);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  INTVAL 
+Parrot_Object_does(PARROT_INTERP, ARGMOD(PMC *_self), STRING *role_name)
+{
+#line 770 "./src/pmc/object.pmc"
+
+    /* If it's a null string, return false */
+    if (!role_name)
+        return 0;
+    else {
+        PMC    * const classobj  = VTABLE_get_class(interp, _self);
+        STRING * const meth_name = CONST_STRING(interp, "does");
+
+        PMC * const method = Parrot_oo_find_vtable_override(interp,
+            classobj, meth_name);
+
+        if (!PMC_IS_NULL(method)) {
+            INTVAL result;
+            Parrot_ext_call(interp, method, "PiS->I", _self, role_name, &result);
+            if (result)
+                return 1;
+        }
+    }
+
+    /* Check the superclass's vtable interface, if any. */
+    if (interp->vtables[enum_class_default]->does(interp, _self, role_name))
+        return 1;
+
+    /* Dispatch to the object's class */
+    return VTABLE_does(interp, VTABLE_get_class(interp, _self), role_name);
+#line 1389 "./src/pmc/object.c"
+}
+static  INTVAL 
+Parrot_Object_does_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *role)
+{
+#line 808 "./src/pmc/object.pmc"
+
+    if (PMC_IS_NULL(role))
+        return 0;
+
+    if (interp->vtables[enum_class_default]->does_pmc(interp, _self, role))
+        return 1;
+
+    /* Dispatch to the object's class */
+    return VTABLE_does_pmc(interp, VTABLE_get_class(interp, _self), role);
+#line 1404 "./src/pmc/object.c"
+}
+static  INTVAL
+Parrot_Object_elements(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "elements");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            INTVAL result;
+            Parrot_ext_call(interp, meth, "Pi->I", _self, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (INTVAL) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (INTVAL)VTABLE_elements(interp, del_object);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (INTVAL)interp->vtables[enum_class_default]->elements(interp, _self);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  INTVAL
+Parrot_Object_exists_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "exists_keyed");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            INTVAL result;
+            key = clone_key_arg(interp, key);
+            Parrot_ext_call(interp, meth, "PiP->I", _self, key, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (INTVAL) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (INTVAL)VTABLE_exists_keyed(interp, del_object, key);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (INTVAL)interp->vtables[enum_class_default]->exists_keyed(interp, _self, key);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  INTVAL
+Parrot_Object_exists_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "exists_keyed_int");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            INTVAL result;
+            Parrot_ext_call(interp, meth, "PiI->I", _self, key, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (INTVAL) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (INTVAL)VTABLE_exists_keyed_int(interp, del_object, key);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (INTVAL)interp->vtables[enum_class_default]->exists_keyed_int(interp, _self, key);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  INTVAL
+Parrot_Object_exists_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "exists_keyed_str");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            INTVAL result;
+            Parrot_ext_call(interp, meth, "PiS->I", _self, key, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (INTVAL) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (INTVAL)VTABLE_exists_keyed_str(interp, del_object, key);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (INTVAL)interp->vtables[enum_class_default]->exists_keyed_str(interp, _self, key);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  PMC  *
+Parrot_Object_find_method(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name)
+{
+#line 540 "./src/pmc/object.pmc"
+
+    Parrot_Object_attributes * const obj    = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class = PARROT_CLASS(obj->_class);
+
+    PMC                             *method =
+             find_cached(interp, obj->_class, name);
+
+    if (!PMC_IS_NULL(method))
+        return method;
+    else {
+        STRING * const find_method = CONST_STRING(interp, "find_method");
+        const int      num_classes = VTABLE_elements(interp,
+                                                  _class->all_parents);
+
+        const int all_in_universe  =
+                        !CLASS_has_alien_parents_TEST(obj->_class);
+        int i;
+
+        for (i = 0; i < num_classes; i++) {
+            /* Get the class. */
+            PMC * const cur_class =
+                VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+
+            const Parrot_Class_attributes * const class_info =
+                    PARROT_CLASS(cur_class);
+
+            /* If there's a vtable override for 'find_method' in the
+             * current class, run that first. */
+
+            method = Parrot_oo_find_vtable_override_for_class(interp,
+                        cur_class, find_method);
+
+            if (!PMC_IS_NULL(method)) {
+                PMC *result = PMCNULL;
+                Parrot_ext_call(interp, method, "PiS->P", _self, name, &result);
+
+                /* break out to the CACHE IF FOUND code */
+                method = result;
+                break;
+            }
+
+            /* If it's from this universe or the class doesn't inherit from
+             * anything outside of it... */
+            if (all_in_universe || VTABLE_isa(interp, cur_class, CONST_STRING(interp, "Class"))) {
+                method = VTABLE_get_pmc_keyed_str(interp,
+                                class_info->methods, name);
+
+                /* Found it! */
+                if (!PMC_IS_NULL(method))
+                    break;
+            }
+            else
+                Parrot_ex_throw_from_c_args(interp, NULL, -1,
+                    "Class %Ss inherits from alien parents.",
+                    class_info->name);
+        }
+
+        if (!PMC_IS_NULL(method))
+            cache_method(interp, obj->_class, name, method);
+
+        return method;
+    }
+#line 1597 "./src/pmc/object.c"
+}
+static  PMC *
+Parrot_Object_floor_divide(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "floor_divide");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            PMC* result = PMCNULL;
+            Parrot_ext_call(interp, meth, "PiPP->P", _self, value, dest, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (PMC*) result;
+        }
+    }
+    return (PMC*)interp->vtables[enum_class_default]->floor_divide(interp, _self, value, dest);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  PMC *
+Parrot_Object_floor_divide_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "floor_divide_float");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            PMC* result = PMCNULL;
+            Parrot_ext_call(interp, meth, "PiNP->P", _self, value, dest, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (PMC*) result;
+        }
+    }
+    return (PMC*)interp->vtables[enum_class_default]->floor_divide_float(interp, _self, value, dest);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  PMC *
+Parrot_Object_floor_divide_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "floor_divide_int");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            PMC* result = PMCNULL;
+            Parrot_ext_call(interp, meth, "PiIP->P", _self, value, dest, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (PMC*) result;
+        }
+    }
+    return (PMC*)interp->vtables[enum_class_default]->floor_divide_int(interp, _self, value, dest);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  void 
+Parrot_Object_freeze(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 961 "./src/pmc/object.pmc"
+
+    Parrot_Object_attributes * const obj   = PARROT_OBJECT(_self);
+    STRING                   * const empty = CONST_STRING(interp, "");
+    INTVAL i;
+
+    /* An empty kinds string means all slots hold PMCs. */
+    VTABLE_push_integer(interp, info, obj->num_attribs);
+    VTABLE_push_string(interp, info, obj->attrib_kinds ? obj->attrib_kinds : empty);
+
+    for (i = 0; i < obj->num_attribs; ++i) {
+        switch (ATTRIB_KIND(obj->attrib_kinds, i)) {
+          case ATTRIB_KIND_INT:
+            VTABLE_push_integer(interp, info, obj->attrib_store[i].ival);
+            break;
+          case ATTRIB_KIND_NUM:
+            VTABLE_push_float(interp, info, obj->attrib_store[i].nval);
+            break;
+          case ATTRIB_KIND_STRING:
+            VTABLE_push_string(interp, info, obj->attrib_store[i].str);
+            break;
+          default:
+            break;
+        }
+    }
+#line 1693 "./src/pmc/object.c"
+}
+static  PMC  *
+Parrot_Object_get_attr_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, STRING *name)
+{
+#line 452 "./src/pmc/object.pmc"
+
+    Parrot_Object_attributes * const obj = PARROT_OBJECT(_self);
+
+    /* Look up the index. */
+    const INTVAL index = get_attrib_index_keyed(interp, obj->_class,
+                                                key, name);
+
+    /* If lookup failed, exception. */
+    if (index == -1 || index >= obj->num_attribs)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+            EXCEPTION_ATTRIB_NOT_FOUND,
+            "No such attribute '%S' in class '%S'", name,
+            VTABLE_get_string(interp, key));
+
+    return Parrot_oo_get_attrib_slot(interp, _self, index);
+#line 1714 "./src/pmc/object.c"
+}
+static  PMC  *
+Parrot_Object_get_attr_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name)
+{
+#line 413 "./src/pmc/object.pmc"
+
+    Parrot_Object_attributes * const obj      = PARROT_OBJECT(_self);
+    STRING                   * const get_attr = CONST_STRING(interp, "get_attr_str");
+
+    INTVAL index;
+
+    /* If there's a vtable override for 'get_attr_str' run that first. */
+
+    PMC * const method = Parrot_oo_find_vtable_override(interp,
+            obj->_class, get_attr);
+
+    if (!PMC_IS_NULL(method)) {
+        PMC *result = PMCNULL;
+        Parrot_ext_call(interp, method, "PiS->P", _self, name, &result);
+        return result;
+    }
+
+    /* Look up the index. */
+    index = get_attrib_index(interp, obj->_class, name);
+
+    /* If lookup failed, exception. */
+    if (index == -1 || index >= obj->num_attribs)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+            EXCEPTION_ATTRIB_NOT_FOUND, "No such attribute '%S'", name);
+
+    return Parrot_oo_get_attrib_slot(interp, _self, index);
+#line 1746 "./src/pmc/object.c"
+}
+static  INTVAL
+Parrot_Object_get_bool(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "get_bool");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            INTVAL result;
+            Parrot_ext_call(interp, meth, "Pi->I", _self, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (INTVAL) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (INTVAL)VTABLE_get_bool(interp, del_object);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (INTVAL)interp->vtables[enum_class_default]->get_bool(interp, _self);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  PMC  *
+Parrot_Object_get_class(SHIM_INTERP, ARGMOD(PMC *_self))
+{
+#line 661 "./src/pmc/object.pmc"
+    return PARROT_OBJECT(_self)->_class;
+#line 1784 "./src/pmc/object.c"
+}
+static  INTVAL 
+Parrot_Object_get_integer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 614 "./src/pmc/object.pmc"
+
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING                   * const meth_name = CONST_STRING(interp, "get_integer");
+
+    /* Walk and search for the vtable. */
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int       i;
+
+    for (i = 0; i < num_classes; i++) {
+        /* Get the class. */
+        PMC * const cur_class =
+            VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp,
+                cur_class, meth_name);
+
+        if (!PMC_IS_NULL(meth)) {
+            INTVAL result;
+            Parrot_ext_call(interp, meth, "Pi->I", _self, &result);
+            return result;
+
+        }
+
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            /* Get the PMC instance and call the vtable function on that. */
+            STRING * const proxy      = CONST_STRING(interp, "proxy");
+            PMC    * const del_object =
+                 VTABLE_get_attr_str(interp, _self, proxy);
+
+            if (!PMC_IS_NULL(del_object))
+                return (INTVAL)VTABLE_get_integer(interp, del_object);
+        }
+    }
+    return interp->vtables[enum_class_default]->get_integer(interp, _self);
+#line 1825 "./src/pmc/object.c"
+}
+static  INTVAL
+Parrot_Object_get_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "get_integer_keyed");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            INTVAL result;
+            key = clone_key_arg(interp, key);
+            Parrot_ext_call(interp, meth, "PiP->I", _self, key, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (INTVAL) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (INTVAL)VTABLE_get_integer_keyed(interp, del_object, key);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (INTVAL)interp->vtables[enum_class_default]->get_integer_keyed(interp, _self, key);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  INTVAL
+Parrot_Object_get_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "get_integer_keyed_int");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            INTVAL result;
+            Parrot_ext_call(interp, meth, "PiI->I", _self, key, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (INTVAL) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (INTVAL)VTABLE_get_integer_keyed_int(interp, del_object, key);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (INTVAL)interp->vtables[enum_class_default]->get_integer_keyed_int(interp, _self, key);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  INTVAL
+Parrot_Object_get_integer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "get_integer_keyed_str");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            INTVAL result;
+            Parrot_ext_call(interp, meth, "PiS->I", _self, key, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (INTVAL) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (INTVAL)VTABLE_get_integer_keyed_str(interp, del_object, key);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (INTVAL)interp->vtables[enum_class_default]->get_integer_keyed_str(interp, _self, key);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  PMC *
+Parrot_Object_get_iter(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "get_iter");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            PMC* result = PMCNULL;
+            Parrot_ext_call(interp, meth, "Pi->P", _self, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (PMC*) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (PMC*)VTABLE_get_iter(interp, del_object);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (PMC*)interp->vtables[enum_class_default]->get_iter(interp, _self);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  PMC  *
+Parrot_Object_get_namespace(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 677 "./src/pmc/object.pmc"
+
+    PMC    * const classobj      = VTABLE_get_class(interp, _self);
+    STRING * const get_namespace = CONST_STRING(interp, "get_namespace");
+
+    /* If there's a vtable override for 'get_namespace' run that instead */
+    PMC    * const method = Parrot_oo_find_vtable_override(interp,
+            classobj, get_namespace);
+
+    if (!PMC_IS_NULL(method)) {
+        PMC *result;
+        Parrot_ext_call(interp, method, "Pi->P", _self, &result);
+        return result;
+    }
+
+   return VTABLE_inspect_str(interp, classobj, CONST_STRING(interp, "namespace"));
+#line 1971 "./src/pmc/object.c"
+}
+static  FLOATVAL
+Parrot_Object_get_number(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "get_number");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            FLOATVAL result;
+            Parrot_ext_call(interp, meth, "Pi->N", _self, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (FLOATVAL) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (FLOATVAL)VTABLE_get_number(interp, del_object);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (FLOATVAL)interp->vtables[enum_class_default]->get_number(interp, _self);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  FLOATVAL
+Parrot_Object_get_number_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "get_number_keyed");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            FLOATVAL result;
+            key = clone_key_arg(interp, key);
+            Parrot_ext_call(interp, meth, "PiP->N", _self, key, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (FLOATVAL) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (FLOATVAL)VTABLE_get_number_keyed(interp, del_object, key);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (FLOATVAL)interp->vtables[enum_class_default]->get_number_keyed(interp, _self, key);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  FLOATVAL
+Parrot_Object_get_number_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "get_number_keyed_int");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            FLOATVAL result;
+            Parrot_ext_call(interp, meth, "PiI->N", _self, key, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (FLOATVAL) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (FLOATVAL)VTABLE_get_number_keyed_int(interp, del_object, key);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (FLOATVAL)interp->vtables[enum_class_default]->get_number_keyed_int(interp, _self, key);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  FLOATVAL
+Parrot_Object_get_number_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "get_number_keyed_str");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            FLOATVAL result;
+            Parrot_ext_call(interp, meth, "PiS->N", _self, key, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (FLOATVAL) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (FLOATVAL)VTABLE_get_number_keyed_str(interp, del_object, key);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (FLOATVAL)interp->vtables[enum_class_default]->get_number_keyed_str(interp, _self, key);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  PMC *
+Parrot_Object_get_pmc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "get_pmc");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            PMC* result = PMCNULL;
+            Parrot_ext_call(interp, meth, "Pi->P", _self, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (PMC*) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (PMC*)VTABLE_get_pmc(interp, del_object);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (PMC*)interp->vtables[enum_class_default]->get_pmc(interp, _self);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  PMC *
+Parrot_Object_get_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "get_pmc_keyed");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            PMC* result = PMCNULL;
+            key = clone_key_arg(interp, key);
+            Parrot_ext_call(interp, meth, "PiP->P", _self, key, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (PMC*) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (PMC*)VTABLE_get_pmc_keyed(interp, del_object, key);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (PMC*)interp->vtables[enum_class_default]->get_pmc_keyed(interp, _self, key);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  PMC *
+Parrot_Object_get_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "get_pmc_keyed_int");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            PMC* result = PMCNULL;
+            Parrot_ext_call(interp, meth, "PiI->P", _self, key, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (PMC*) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (PMC*)VTABLE_get_pmc_keyed_int(interp, del_object, key);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (PMC*)interp->vtables[enum_class_default]->get_pmc_keyed_int(interp, _self, key);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  PMC *
+Parrot_Object_get_pmc_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "get_pmc_keyed_str");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            PMC* result = PMCNULL;
+            Parrot_ext_call(interp, meth, "PiS->P", _self, key, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (PMC*) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (PMC*)VTABLE_get_pmc_keyed_str(interp, del_object, key);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (PMC*)interp->vtables[enum_class_default]->get_pmc_keyed_str(interp, _self, key);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  void *
+Parrot_Object_get_pointer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "get_pointer");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            void* result;
+            Parrot_ext_call(interp, meth, "Pi->V", _self, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (void*) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (void*)VTABLE_get_pointer(interp, del_object);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (void*)interp->vtables[enum_class_default]->get_pointer(interp, _self);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  void *
+Parrot_Object_get_pointer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "get_pointer_keyed");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            void* result;
+            key = clone_key_arg(interp, key);
+            Parrot_ext_call(interp, meth, "PiP->V", _self, key, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (void*) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (void*)VTABLE_get_pointer_keyed(interp, del_object, key);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (void*)interp->vtables[enum_class_default]->get_pointer_keyed(interp, _self, key);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  void *
+Parrot_Object_get_pointer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "get_pointer_keyed_int");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            void* result;
+            Parrot_ext_call(interp, meth, "PiI->V", _self, key, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (void*) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (void*)VTABLE_get_pointer_keyed_int(interp, del_object, key);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (void*)interp->vtables[enum_class_default]->get_pointer_keyed_int(interp, _self, key);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  void *
+Parrot_Object_get_pointer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "get_pointer_keyed_str");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            void* result;
+            Parrot_ext_call(interp, meth, "PiS->V", _self, key, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (void*) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (void*)VTABLE_get_pointer_keyed_str(interp, del_object, key);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (void*)interp->vtables[enum_class_default]->get_pointer_keyed_str(interp, _self, key);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  STRING *
+Parrot_Object_get_repr(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "get_repr");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            STRING* result;
+            Parrot_ext_call(interp, meth, "Pi->S", _self, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (STRING*) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (STRING*)VTABLE_get_repr(interp, del_object);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (STRING*)interp->vtables[enum_class_default]->get_repr(interp, _self);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  STRING *
+Parrot_Object_get_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "get_string");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            STRING* result;
+            Parrot_ext_call(interp, meth, "Pi->S", _self, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (STRING*) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (STRING*)VTABLE_get_string(interp, del_object);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (STRING*)interp->vtables[enum_class_default]->get_string(interp, _self);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  STRING *
+Parrot_Object_get_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "get_string_keyed");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            STRING* result;
+            key = clone_key_arg(interp, key);
+            Parrot_ext_call(interp, meth, "PiP->S", _self, key, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (STRING*) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (STRING*)VTABLE_get_string_keyed(interp, del_object, key);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (STRING*)interp->vtables[enum_class_default]->get_string_keyed(interp, _self, key);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  STRING *
+Parrot_Object_get_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "get_string_keyed_int");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            STRING* result;
+            Parrot_ext_call(interp, meth, "PiI->S", _self, key, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (STRING*) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (STRING*)VTABLE_get_string_keyed_int(interp, del_object, key);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (STRING*)interp->vtables[enum_class_default]->get_string_keyed_int(interp, _self, key);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  STRING *
+Parrot_Object_get_string_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "get_string_keyed_str");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            STRING* result;
+            Parrot_ext_call(interp, meth, "PiS->S", _self, key, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (STRING*) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (STRING*)VTABLE_get_string_keyed_str(interp, del_object, key);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (STRING*)interp->vtables[enum_class_default]->get_string_keyed_str(interp, _self, key);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  INTVAL
+Parrot_Object_hashvalue(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "hashvalue");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            INTVAL result;
+            Parrot_ext_call(interp, meth, "Pi->I", _self, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (INTVAL) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (INTVAL)VTABLE_hashvalue(interp, del_object);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (INTVAL)interp->vtables[enum_class_default]->hashvalue(interp, _self);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  void
+Parrot_Object_i_absolute(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "i_absolute");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "Pi->", _self);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_i_absolute(interp, del_object);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->i_absolute(interp, _self);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_i_add(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "i_add");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiP->", _self, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_i_add(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->i_add(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_i_add_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "i_add_float");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiN->", _self, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_i_add_float(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->i_add_float(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_i_add_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "i_add_int");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiI->", _self, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_i_add_int(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->i_add_int(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_i_concatenate(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "i_concatenate");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiP->", _self, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_i_concatenate(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->i_concatenate(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_i_concatenate_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "i_concatenate_str");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiS->", _self, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_i_concatenate_str(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->i_concatenate_str(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_i_divide(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "i_divide");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiP->", _self, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_i_divide(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->i_divide(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_i_divide_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "i_divide_float");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiN->", _self, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_i_divide_float(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->i_divide_float(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_i_divide_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "i_divide_int");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiI->", _self, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_i_divide_int(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->i_divide_int(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_i_floor_divide(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "i_floor_divide");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiP->", _self, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_i_floor_divide(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->i_floor_divide(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_i_floor_divide_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "i_floor_divide_float");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiN->", _self, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_i_floor_divide_float(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->i_floor_divide_float(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_i_floor_divide_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "i_floor_divide_int");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiI->", _self, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_i_floor_divide_int(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->i_floor_divide_int(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_i_modulus(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "i_modulus");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiP->", _self, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_i_modulus(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->i_modulus(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_i_modulus_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "i_modulus_float");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiN->", _self, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_i_modulus_float(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->i_modulus_float(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_i_modulus_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "i_modulus_int");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiI->", _self, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_i_modulus_int(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->i_modulus_int(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_i_multiply(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "i_multiply");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiP->", _self, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_i_multiply(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->i_multiply(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_i_multiply_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "i_multiply_float");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiN->", _self, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_i_multiply_float(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->i_multiply_float(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_i_multiply_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "i_multiply_int");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiI->", _self, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_i_multiply_int(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->i_multiply_int(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_i_neg(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "i_neg");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "Pi->", _self);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_i_neg(interp, del_object);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->i_neg(interp, _self);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_i_repeat(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "i_repeat");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiP->", _self, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_i_repeat(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->i_repeat(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_i_repeat_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "i_repeat_int");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiI->", _self, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_i_repeat_int(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->i_repeat_int(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_i_subtract(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "i_subtract");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiP->", _self, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_i_subtract(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->i_subtract(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_i_subtract_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "i_subtract_float");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiN->", _self, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_i_subtract_float(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->i_subtract_float(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_i_subtract_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "i_subtract_int");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiI->", _self, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_i_subtract_int(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->i_subtract_int(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_increment(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "increment");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "Pi->", _self);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_increment(interp, del_object);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->increment(interp, _self);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void 
+Parrot_Object_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 296 "./src/pmc/object.pmc"
+
+    /**/UNUSED(_self)
+    Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+        "Object must be created by a class.");
+#line 3318 "./src/pmc/object.c"
+}
+static  void
+Parrot_Object_init_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL initializer)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "init_int");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiI->", _self, initializer);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_init_int(interp, del_object, initializer);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->init_int(interp, _self, initializer);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void 
+Parrot_Object_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *from))
+{
+#line 313 "./src/pmc/object.pmc"
+
+    /**/UNUSED(_self)
+    Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "Object must be created by a class.");
+#line 3359 "./src/pmc/object.c"
+}
+static  PMC *
+Parrot_Object_inspect(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "inspect");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            PMC* result = PMCNULL;
+            Parrot_ext_call(interp, meth, "Pi->P", _self, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (PMC*) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (PMC*)VTABLE_inspect(interp, del_object);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (PMC*)interp->vtables[enum_class_default]->inspect(interp, _self);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  PMC *
+Parrot_Object_inspect_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *what)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "inspect_str");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            PMC* result = PMCNULL;
+            Parrot_ext_call(interp, meth, "PiS->P", _self, what, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (PMC*) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (PMC*)VTABLE_inspect_str(interp, del_object, what);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (PMC*)interp->vtables[enum_class_default]->inspect_str(interp, _self, what);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  PMC *
+Parrot_Object_instantiate(PARROT_INTERP, ARGMOD(PMC *_self), PMC *sig)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "instantiate");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            PMC* result = PMCNULL;
+            Parrot_ext_call(interp, meth, "PiP->P", _self, sig, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (PMC*) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (PMC*)VTABLE_instantiate(interp, del_object, sig);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (PMC*)interp->vtables[enum_class_default]->instantiate(interp, _self, sig);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  opcode_t * 
+Parrot_Object_invoke(PARROT_INTERP, ARGMOD(PMC *_self), void *next)
+{
+#line 830 "./src/pmc/object.pmc"
+
+    Parrot_Object_attributes * const obj    = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class = PARROT_CLASS(obj->_class);
+
+    /* Walk and search for the vtable. */
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+
+    for (i = 0; i < num_classes; i++) {
+        /* Get the class. */
+        STRING * const meth_name = CONST_STRING(interp, "invoke");
+        STRING * const proxy     = CONST_STRING(interp, "proxy");
+        PMC    * const cur_class =
+            VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+
+        PMC    * const meth      =
+            Parrot_oo_find_vtable_override_for_class(interp, cur_class,
+                                                     meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            /* Experimental code. See api.yaml */
+            PMC * const call_sig =
+                Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+
+            if ((VTABLE_elements(interp, call_sig) == 0
+            ||   VTABLE_get_pmc_keyed_int(interp, call_sig, 0) != _self))
+                VTABLE_unshift_pmc(interp, call_sig, _self);
+
+            return VTABLE_invoke(interp, meth, next);
+        }
+
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            /* Get the PMC instance and call the vtable function on that. */
+            PMC * const del_object =
+                VTABLE_get_attr_keyed(interp, _self, cur_class, proxy);
+
+            if (!PMC_IS_NULL(del_object))
+                return VTABLE_invoke(interp, del_object, next);
+        }
+    }
+
+    return (opcode_t *)interp->vtables[enum_class_default]->invoke(interp, _self, next);
+#line 3499 "./src/pmc/object.c"
+}
+static  INTVAL
+Parrot_Object_is_equal(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "is_equal");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            INTVAL result;
+            Parrot_ext_call(interp, meth, "PiP->I", _self, value, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (INTVAL) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (INTVAL)VTABLE_is_equal(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (INTVAL)interp->vtables[enum_class_default]->is_equal(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  INTVAL
+Parrot_Object_is_equal_num(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "is_equal_num");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            INTVAL result;
+            Parrot_ext_call(interp, meth, "PiP->I", _self, value, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (INTVAL) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (INTVAL)VTABLE_is_equal_num(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (INTVAL)interp->vtables[enum_class_default]->is_equal_num(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  INTVAL
+Parrot_Object_is_equal_string(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "is_equal_string");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            INTVAL result;
+            Parrot_ext_call(interp, meth, "PiP->I", _self, value, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (INTVAL) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (INTVAL)VTABLE_is_equal_string(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (INTVAL)interp->vtables[enum_class_default]->is_equal_string(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  INTVAL
+Parrot_Object_is_same(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "is_same");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            INTVAL result;
+            Parrot_ext_call(interp, meth, "PiP->I", _self, value, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (INTVAL) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (INTVAL)VTABLE_is_same(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (INTVAL)interp->vtables[enum_class_default]->is_same(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  INTVAL 
+Parrot_Object_isa(PARROT_INTERP, ARGMOD(PMC *_self), STRING *classname)
+{
+#line 741 "./src/pmc/object.pmc"
+
+    PMC * const classobj = VTABLE_get_class(interp, _self);
+    STRING * const vtable_meth_name = CONST_STRING(interp, "isa");
+    PMC * const method = Parrot_oo_find_vtable_override(interp, classobj,
+            vtable_meth_name);
+
+    if (!PMC_IS_NULL(method)) {
+        INTVAL result = 0;
+        Parrot_ext_call(interp, method, "PiS->I", _self, classname, &result);
+        return result;
+    }
+    else if (_self->vtable->whoami == classname
+            || STRING_equal(interp, _self->vtable->whoami, classname))
+        return 1;
+    else
+        return VTABLE_isa(interp, classobj, classname);
+#line 3645 "./src/pmc/object.c"
+}
+static  INTVAL 
+Parrot_Object_isa_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *lookup)
+{
+#line 705 "./src/pmc/object.pmc"
+
+    PMC * method = PMCNULL;
+
+    if (PMC_IS_NULL(lookup))
+        return 0;
+    else {
+        PMC * const classobj = VTABLE_get_class(interp, _self);
+        STRING * const vtable_meth_name = CONST_STRING(interp, "isa_pmc");
+        method = Parrot_oo_find_vtable_override(interp, classobj,
+            vtable_meth_name);
+    }
+
+    if (!PMC_IS_NULL(method)) {
+        INTVAL result = 0;
+        Parrot_ext_call(interp, method, "PiP->I", _self, lookup, &result);
+        return result;
+    }
+
+    if (interp->vtables[enum_class_default]->isa_pmc(interp, _self, lookup))
+        return 1;
+
+    /* Dispatch isa to the object's class */
+    return VTABLE_isa_pmc(interp, VTABLE_get_class(interp, _self), lookup);
+#line 3674 "./src/pmc/object.c"
+}
+static  void 
+Parrot_Object_mark(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 379 "./src/pmc/object.pmc"
+
+    if (PARROT_OBJECT(_self)) {
+        Parrot_Object_attributes * const obj = PARROT_OBJECT(_self);
+        INTVAL i;
+
+        Parrot_gc_mark_PMC_alive(interp, obj->_class);
+        Parrot_gc_mark_STRING_alive(interp, obj->attrib_kinds);
+
+        for (i = 0; i < obj->num_attribs; ++i) {
+            switch (ATTRIB_KIND(obj->attrib_kinds, i)) {
+              case ATTRIB_KIND_PMC:
+                Parrot_gc_mark_PMC_alive(interp, obj->attrib_store[i].pmc);
+                break;
+              case ATTRIB_KIND_STRING:
+                Parrot_gc_mark_STRING_alive(interp, obj->attrib_store[i].str);
+                break;
+              default:
+                break;
+            }
+        }
+    }
+#line 3701 "./src/pmc/object.c"
+}
+static  PMC *
+Parrot_Object_modulus(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "modulus");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            PMC* result = PMCNULL;
+            Parrot_ext_call(interp, meth, "PiPP->P", _self, value, dest, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (PMC*) result;
+        }
+    }
+    return (PMC*)interp->vtables[enum_class_default]->modulus(interp, _self, value, dest);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  PMC *
+Parrot_Object_modulus_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "modulus_float");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            PMC* result = PMCNULL;
+            Parrot_ext_call(interp, meth, "PiNP->P", _self, value, dest, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (PMC*) result;
+        }
+    }
+    return (PMC*)interp->vtables[enum_class_default]->modulus_float(interp, _self, value, dest);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  PMC *
+Parrot_Object_modulus_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "modulus_int");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            PMC* result = PMCNULL;
+            Parrot_ext_call(interp, meth, "PiIP->P", _self, value, dest, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (PMC*) result;
+        }
+    }
+    return (PMC*)interp->vtables[enum_class_default]->modulus_int(interp, _self, value, dest);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  void 
+Parrot_Object_morph(PARROT_INTERP, ARGMOD(PMC *_self), PMC *type)
+{
+#line 1055 "./src/pmc/object.pmc"
+
+    PMC    * const classobj  = VTABLE_get_class(interp, _self);
+    STRING * const meth_name = CONST_STRING(interp, "morph");
+    /* If there's a vtable override for 'morph' run that instead. */
+    PMC    * const method    =
+         Parrot_oo_find_vtable_override(interp, classobj, meth_name);
+
+    if (!PMC_IS_NULL(method)) {
+        Parrot_ext_call(interp, method, "PiP->", _self, type);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+    }
+    else
+        interp->vtables[enum_class_default]->morph(interp, _self, type);
+#line 3786 "./src/pmc/object.c"
+}
+static  PMC *
+Parrot_Object_multiply(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "multiply");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            PMC* result = PMCNULL;
+            Parrot_ext_call(interp, meth, "PiPP->P", _self, value, dest, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (PMC*) result;
+        }
+    }
+    return (PMC*)interp->vtables[enum_class_default]->multiply(interp, _self, value, dest);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  PMC *
+Parrot_Object_multiply_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "multiply_float");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            PMC* result = PMCNULL;
+            Parrot_ext_call(interp, meth, "PiNP->P", _self, value, dest, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (PMC*) result;
+        }
+    }
+    return (PMC*)interp->vtables[enum_class_default]->multiply_float(interp, _self, value, dest);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  PMC *
+Parrot_Object_multiply_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "multiply_int");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            PMC* result = PMCNULL;
+            Parrot_ext_call(interp, meth, "PiIP->P", _self, value, dest, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (PMC*) result;
+        }
+    }
+    return (PMC*)interp->vtables[enum_class_default]->multiply_int(interp, _self, value, dest);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  STRING  *
+Parrot_Object_name(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 352 "./src/pmc/object.pmc"
+
+    PMC    * const _class     = VTABLE_get_class(interp, _self);
+    STRING * const name       = CONST_STRING(interp, "name");
+
+    /* If there's a vtable override for 'name' run that instead. */
+    PMC * const method = Parrot_oo_find_vtable_override(interp,
+                             _class, name);
+
+    if (!PMC_IS_NULL(method)) {
+        STRING *result = NULL;
+        Parrot_ext_call(interp, method, "Pi->S", _self, &result);
+        return result;
+    }
+    else
+        return VTABLE_get_string(interp, _class);
+#line 3873 "./src/pmc/object.c"
+}
+static  PMC *
+Parrot_Object_neg(PARROT_INTERP, ARGMOD(PMC *_self), PMC *dest)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "neg");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            PMC* result = PMCNULL;
+            Parrot_ext_call(interp, meth, "PiP->P", _self, dest, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (PMC*) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (PMC*)VTABLE_neg(interp, del_object, dest);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (PMC*)interp->vtables[enum_class_default]->neg(interp, _self, dest);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  FLOATVAL
+Parrot_Object_pop_float(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "pop_float");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            FLOATVAL result;
+            Parrot_ext_call(interp, meth, "Pi->N", _self, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (FLOATVAL) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (FLOATVAL)VTABLE_pop_float(interp, del_object);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (FLOATVAL)interp->vtables[enum_class_default]->pop_float(interp, _self);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+    /* need PARROT_GC_WRITE_BARRIER(interp, _self); or uppercase RETURN */
+}
+static  INTVAL
+Parrot_Object_pop_integer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "pop_integer");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            INTVAL result;
+            Parrot_ext_call(interp, meth, "Pi->I", _self, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (INTVAL) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (INTVAL)VTABLE_pop_integer(interp, del_object);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (INTVAL)interp->vtables[enum_class_default]->pop_integer(interp, _self);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+    /* need PARROT_GC_WRITE_BARRIER(interp, _self); or uppercase RETURN */
+}
+static  PMC *
+Parrot_Object_pop_pmc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "pop_pmc");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            PMC* result = PMCNULL;
+            Parrot_ext_call(interp, meth, "Pi->P", _self, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (PMC*) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (PMC*)VTABLE_pop_pmc(interp, del_object);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (PMC*)interp->vtables[enum_class_default]->pop_pmc(interp, _self);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+    /* need PARROT_GC_WRITE_BARRIER(interp, _self); or uppercase RETURN */
+}
+static  STRING *
+Parrot_Object_pop_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "pop_string");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            STRING* result;
+            Parrot_ext_call(interp, meth, "Pi->S", _self, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (STRING*) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (STRING*)VTABLE_pop_string(interp, del_object);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (STRING*)interp->vtables[enum_class_default]->pop_string(interp, _self);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+    /* need PARROT_GC_WRITE_BARRIER(interp, _self); or uppercase RETURN */
+}
+static  void
+Parrot_Object_push_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "push_float");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiN->", _self, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_push_float(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->push_float(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_push_integer(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "push_integer");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiI->", _self, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_push_integer(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->push_integer(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_push_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "push_pmc");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiP->", _self, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_push_pmc(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->push_pmc(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_push_string(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "push_string");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiS->", _self, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_push_string(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->push_string(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_remove_attribute(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "remove_attribute");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiS->", _self, name);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_remove_attribute(interp, del_object, name);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->remove_attribute(interp, _self, name);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_remove_method(PARROT_INTERP, ARGMOD(PMC *_self), STRING *method_name)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "remove_method");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiS->", _self, method_name);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_remove_method(interp, del_object, method_name);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->remove_method(interp, _self, method_name);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_remove_parent(PARROT_INTERP, ARGMOD(PMC *_self), PMC *parent)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "remove_parent");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiP->", _self, parent);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_remove_parent(interp, del_object, parent);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->remove_parent(interp, _self, parent);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_remove_role(PARROT_INTERP, ARGMOD(PMC *_self), PMC *role)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "remove_role");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiP->", _self, role);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_remove_role(interp, del_object, role);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->remove_role(interp, _self, role);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_remove_vtable_override(PARROT_INTERP, ARGMOD(PMC *_self), STRING *vtable_name)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "remove_vtable_override");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiS->", _self, vtable_name);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_remove_vtable_override(interp, del_object, vtable_name);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->remove_vtable_override(interp, _self, vtable_name);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  PMC *
+Parrot_Object_repeat(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "repeat");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            PMC* result = PMCNULL;
+            Parrot_ext_call(interp, meth, "PiPP->P", _self, value, dest, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (PMC*) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (PMC*)VTABLE_repeat(interp, del_object, value, dest);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (PMC*)interp->vtables[enum_class_default]->repeat(interp, _self, value, dest);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  PMC *
+Parrot_Object_repeat_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "repeat_int");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            PMC* result = PMCNULL;
+            Parrot_ext_call(interp, meth, "PiIP->P", _self, value, dest, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (PMC*) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (PMC*)VTABLE_repeat_int(interp, del_object, value, dest);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (PMC*)interp->vtables[enum_class_default]->repeat_int(interp, _self, value, dest);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  void 
+Parrot_Object_set_attr_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, STRING *name, PMC *value)
+{
+#line 515 "./src/pmc/object.pmc"
+
+    Parrot_Object_attributes * const obj  = PARROT_OBJECT(_self);
+    const INTVAL                    index =
+         get_attrib_index_keyed(interp, obj->_class, key, name);
+
+    /* If lookup failed, exception. */
+    if (index == -1 || index >= obj->num_attribs)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+             EXCEPTION_ATTRIB_NOT_FOUND,
+            "No such attribute '%S' in class '%S'", name,
+            VTABLE_get_string(interp, key));
+
+    Parrot_oo_set_attrib_slot(interp, _self, index, value);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 4393 "./src/pmc/object.c"
+}
+static  void 
+Parrot_Object_set_attr_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name, PMC *value)
+{
+#line 480 "./src/pmc/object.pmc"
+
+    Parrot_Object_attributes * const obj              = PARROT_OBJECT(_self);
+    STRING                   * const vtable_meth_name = CONST_STRING(interp, "set_attr_str");
+    INTVAL         index;
+
+    /* If there's a vtable override for 'set_attr_str' run that first. */
+    PMC * const method = Parrot_oo_find_vtable_override(interp,
+            obj->_class, vtable_meth_name);
+
+    if (!PMC_IS_NULL(method)) {
+        Parrot_ext_call(interp, method, "PiSP->", _self, name, value);
+        return;
+    }
+
+    index = get_attrib_index(interp, obj->_class, name);
+
+    /* If lookup failed, exception. */
+    if (index == -1 || index >= obj->num_attribs)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+            EXCEPTION_ATTRIB_NOT_FOUND, "No such attribute '%S'", name);
+
+    Parrot_oo_set_attrib_slot(interp, _self, index, value);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 4422 "./src/pmc/object.c"
+}
+static  void
+Parrot_Object_set_bool(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "set_bool");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiI->", _self, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_set_bool(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->set_bool(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_set_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, INTVAL value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "set_integer_keyed");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            key = clone_key_arg(interp, key);
+            Parrot_ext_call(interp, meth, "PiPI->", _self, key, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_set_integer_keyed(interp, del_object, key, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->set_integer_keyed(interp, _self, key, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_set_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, INTVAL value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "set_integer_keyed_int");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiII->", _self, key, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_set_integer_keyed_int(interp, del_object, key, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->set_integer_keyed_int(interp, _self, key, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_set_integer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key, INTVAL value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "set_integer_keyed_str");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiSI->", _self, key, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_set_integer_keyed_str(interp, del_object, key, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->set_integer_keyed_str(interp, _self, key, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "set_integer_native");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiI->", _self, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_set_integer_native(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->set_integer_native(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_set_number_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, FLOATVAL value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "set_number_keyed");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            key = clone_key_arg(interp, key);
+            Parrot_ext_call(interp, meth, "PiPN->", _self, key, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_set_number_keyed(interp, del_object, key, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->set_number_keyed(interp, _self, key, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_set_number_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, FLOATVAL value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "set_number_keyed_int");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiIN->", _self, key, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_set_number_keyed_int(interp, del_object, key, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->set_number_keyed_int(interp, _self, key, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_set_number_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key, FLOATVAL value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "set_number_keyed_str");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiSN->", _self, key, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_set_number_keyed_str(interp, del_object, key, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->set_number_keyed_str(interp, _self, key, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_set_number_native(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "set_number_native");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiN->", _self, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_set_number_native(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->set_number_native(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_set_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "set_pmc");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiP->", _self, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_set_pmc(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->set_pmc(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_set_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, PMC *value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "set_pmc_keyed");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            key = clone_key_arg(interp, key);
+            Parrot_ext_call(interp, meth, "PiPP->", _self, key, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_set_pmc_keyed(interp, del_object, key, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->set_pmc_keyed(interp, _self, key, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_set_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, PMC *value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "set_pmc_keyed_int");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiIP->", _self, key, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_set_pmc_keyed_int(interp, del_object, key, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->set_pmc_keyed_int(interp, _self, key, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_set_pmc_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key, PMC *value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "set_pmc_keyed_str");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiSP->", _self, key, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_set_pmc_keyed_str(interp, del_object, key, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->set_pmc_keyed_str(interp, _self, key, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_set_pointer(PARROT_INTERP, ARGMOD(PMC *_self), void *value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "set_pointer");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiV->", _self, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_set_pointer(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->set_pointer(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_set_pointer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, void *value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "set_pointer_keyed");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            key = clone_key_arg(interp, key);
+            Parrot_ext_call(interp, meth, "PiPV->", _self, key, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_set_pointer_keyed(interp, del_object, key, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->set_pointer_keyed(interp, _self, key, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_set_pointer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, void *value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "set_pointer_keyed_int");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiIV->", _self, key, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_set_pointer_keyed_int(interp, del_object, key, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->set_pointer_keyed_int(interp, _self, key, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_set_pointer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key, void *value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "set_pointer_keyed_str");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiSV->", _self, key, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_set_pointer_keyed_str(interp, del_object, key, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->set_pointer_keyed_str(interp, _self, key, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_set_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, STRING *value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "set_string_keyed");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            key = clone_key_arg(interp, key);
+            Parrot_ext_call(interp, meth, "PiPS->", _self, key, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_set_string_keyed(interp, del_object, key, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->set_string_keyed(interp, _self, key, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_set_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, STRING *value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "set_string_keyed_int");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiIS->", _self, key, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_set_string_keyed_int(interp, del_object, key, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->set_string_keyed_int(interp, _self, key, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_set_string_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key, STRING *value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "set_string_keyed_str");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiSS->", _self, key, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_set_string_keyed_str(interp, del_object, key, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->set_string_keyed_str(interp, _self, key, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_set_string_native(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "set_string_native");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiS->", _self, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_set_string_native(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->set_string_native(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_share(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "share");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "Pi->", _self);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_share(interp, del_object);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->share(interp, _self);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  FLOATVAL
+Parrot_Object_shift_float(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "shift_float");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            FLOATVAL result;
+            Parrot_ext_call(interp, meth, "Pi->N", _self, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (FLOATVAL) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (FLOATVAL)VTABLE_shift_float(interp, del_object);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (FLOATVAL)interp->vtables[enum_class_default]->shift_float(interp, _self);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+    /* need PARROT_GC_WRITE_BARRIER(interp, _self); or uppercase RETURN */
+}
+static  INTVAL
+Parrot_Object_shift_integer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "shift_integer");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            INTVAL result;
+            Parrot_ext_call(interp, meth, "Pi->I", _self, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (INTVAL) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (INTVAL)VTABLE_shift_integer(interp, del_object);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (INTVAL)interp->vtables[enum_class_default]->shift_integer(interp, _self);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+    /* need PARROT_GC_WRITE_BARRIER(interp, _self); or uppercase RETURN */
+}
+static  PMC *
+Parrot_Object_shift_pmc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "shift_pmc");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            PMC* result = PMCNULL;
+            Parrot_ext_call(interp, meth, "Pi->P", _self, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (PMC*) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (PMC*)VTABLE_shift_pmc(interp, del_object);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (PMC*)interp->vtables[enum_class_default]->shift_pmc(interp, _self);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+    /* need PARROT_GC_WRITE_BARRIER(interp, _self); or uppercase RETURN */
+}
+static  STRING *
+Parrot_Object_shift_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "shift_string");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            STRING* result;
+            Parrot_ext_call(interp, meth, "Pi->S", _self, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (STRING*) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (STRING*)VTABLE_shift_string(interp, del_object);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (STRING*)interp->vtables[enum_class_default]->shift_string(interp, _self);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+    /* need PARROT_GC_WRITE_BARRIER(interp, _self); or uppercase RETURN */
+}
+static  void
+Parrot_Object_splice(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, INTVAL offset, INTVAL count)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "splice");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiPII->", _self, value, offset, count);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_splice(interp, del_object, value, offset, count);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->splice(interp, _self, value, offset, count);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  STRING *
+Parrot_Object_substr(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL offset, INTVAL length)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "substr");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            STRING* result;
+            Parrot_ext_call(interp, meth, "PiII->S", _self, offset, length, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (STRING*) result;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                return (STRING*)VTABLE_substr(interp, del_object, offset, length);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                
+            }
+        }
+    }
+    return (STRING*)interp->vtables[enum_class_default]->substr(interp, _self, offset, length);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  PMC *
+Parrot_Object_subtract(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "subtract");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            PMC* result = PMCNULL;
+            Parrot_ext_call(interp, meth, "PiPP->P", _self, value, dest, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (PMC*) result;
+        }
+    }
+    return (PMC*)interp->vtables[enum_class_default]->subtract(interp, _self, value, dest);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  PMC *
+Parrot_Object_subtract_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "subtract_float");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            PMC* result = PMCNULL;
+            Parrot_ext_call(interp, meth, "PiNP->P", _self, value, dest, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (PMC*) result;
+        }
+    }
+    return (PMC*)interp->vtables[enum_class_default]->subtract_float(interp, _self, value, dest);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  PMC *
+Parrot_Object_subtract_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "subtract_int");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            PMC* result = PMCNULL;
+            Parrot_ext_call(interp, meth, "PiIP->P", _self, value, dest, &result);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return (PMC*) result;
+        }
+    }
+    return (PMC*)interp->vtables[enum_class_default]->subtract_int(interp, _self, value, dest);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    
+}
+static  void 
+Parrot_Object_thaw(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 987 "./src/pmc/object.pmc"
+
+    const INTVAL   num_attribs = VTABLE_shift_integer(interp, info);
+    STRING * const kinds       = VTABLE_shift_string(interp, info);
+    const INTVAL   num_kinds   = (INTVAL)Parrot_str_byte_length(interp, kinds);
+    Parrot_Object_attributes  *obj;
+    INTVAL i;
+
+    if (num_kinds && num_kinds != num_attribs)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_MALFORMED_PACKFILE,
+            "Bad attribute kinds for frozen object");
+
+    /* The slots must be freed even if thawfinish is never reached. */
+    PObj_custom_mark_destroy_SETALL(_self);
+
+    Parrot_oo_alloc_attrib_store(interp, _self, num_attribs,
+        num_kinds ? kinds : NULL);
+
+    obj = PARROT_OBJECT(_self);
+    for (i = 0; i < obj->num_attribs; ++i) {
+        switch (ATTRIB_KIND(obj->attrib_kinds, i)) {
+          case ATTRIB_KIND_INT:
+            obj->attrib_store[i].ival = VTABLE_shift_integer(interp, info);
+            break;
+          case ATTRIB_KIND_NUM:
+            obj->attrib_store[i].nval = VTABLE_shift_float(interp, info);
+            break;
+          case ATTRIB_KIND_STRING:
+            obj->attrib_store[i].str = VTABLE_shift_string(interp, info);
+            break;
+          default:
+            break;
+        }
+    }
+#line 5404 "./src/pmc/object.c"
+}
+static  void 
+Parrot_Object_thawfinish(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *info))
+{
+#line 1033 "./src/pmc/object.pmc"
+    /* Set custom GC mark and destroy on the object. */
+    PObj_custom_mark_SET(_self);
+    PObj_custom_destroy_SET(_self);
+
+    /* Flag that it is an object */
+    PObj_is_object_SET(_self);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 5417 "./src/pmc/object.c"
+}
+static  INTVAL 
+Parrot_Object_type(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 884 "./src/pmc/object.pmc"
+
+    PMC * const _class = VTABLE_get_class(interp, _self);
+    return VTABLE_type(interp, _class);
+#line 5426 "./src/pmc/object.c"
+}
+static  void
+Parrot_Object_unshift_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "unshift_float");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiN->", _self, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_unshift_float(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->unshift_float(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_unshift_integer(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "unshift_integer");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiI->", _self, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_unshift_integer(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->unshift_integer(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_unshift_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "unshift_pmc");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiP->", _self, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_unshift_pmc(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->unshift_pmc(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void
+Parrot_Object_unshift_string(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value)
+{
+    Parrot_Object_attributes * const obj       = PARROT_OBJECT(_self);
+    Parrot_Class_attributes  * const _class    = PARROT_CLASS(obj->_class);
+    STRING        * const meth_name = CONST_STRING_GEN(interp, "unshift_string");
+    const int num_classes = VTABLE_elements(interp, _class->all_parents);
+    int i;
+    for (i = 0; i < num_classes; i++) {
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp, _class->all_parents, i);
+        PMC * const meth = Parrot_oo_find_vtable_override_for_class(interp, cur_class, meth_name);
+        if (!PMC_IS_NULL(meth)) {
+            Parrot_ext_call(interp, meth, "PiS->", _self, value);
+            /* PARROT_GC_WRITE_BARRIER done in ext method call */
+            return;
+        }
+        if (cur_class->vtable->base_type == enum_class_PMCProxy) {
+            STRING * const proxy      = CONST_STRING_GEN(interp, "proxy");
+            PMC    * const del_object = VTABLE_get_attr_str(interp, _self, proxy);
+            if (!PMC_IS_NULL(del_object)) {
+                VTABLE_unshift_string(interp, del_object, value);
+                /* PARROT_GC_WRITE_BARRIER done in method call */
+                return;
+            }
+        }
+    }
+    interp->vtables[enum_class_default]->unshift_string(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER done in super method call */
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void 
+Parrot_Object_visit(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 931 "./src/pmc/object.pmc"
+
+    Parrot_Object_attributes * const obj_data = PARROT_OBJECT(_self);
+    INTVAL i;
+
+    /* 1) visit class */
+    VISIT_PMC(interp, info, obj_data->_class);
+
+    /* 2) visit the PMC attributes; freeze and thaw handle the rest */
+    for (i = 0; i < obj_data->num_attribs; ++i)
+        if (ATTRIB_KIND(obj_data->attrib_kinds, i) == ATTRIB_KIND_PMC)
+            VISIT_PMC(interp, info, obj_data->attrib_store[i].pmc);
+#line 5567 "./src/pmc/object.c"
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_Object_update_vtable(VTABLE *vt) {
+    vt->absolute = Parrot_Object_absolute;
+    vt->add = Parrot_Object_add;
+    vt->add_attribute = Parrot_Object_add_attribute;
+    vt->add_float = Parrot_Object_add_float;
+    vt->add_int = Parrot_Object_add_int;
+    vt->add_method = Parrot_Object_add_method;
+    vt->add_parent = Parrot_Object_add_parent;
+    vt->add_role = Parrot_Object_add_role;
+    vt->add_vtable_override = Parrot_Object_add_vtable_override;
+    vt->assign_pmc = Parrot_Object_assign_pmc;
+    vt->assign_string_native = Parrot_Object_assign_string_native;
+    vt->clone = Parrot_Object_clone;
+    vt->clone_pmc = Parrot_Object_clone_pmc;
+    vt->cmp = Parrot_Object_cmp;
+    vt->cmp_num = Parrot_Object_cmp_num;
+    vt->cmp_pmc = Parrot_Object_cmp_pmc;
+    vt->cmp_string = Parrot_Object_cmp_string;
+    vt->concatenate = Parrot_Object_concatenate;
+    vt->concatenate_str = Parrot_Object_concatenate_str;
+    vt->decrement = Parrot_Object_decrement;
+    vt->defined = Parrot_Object_defined;
+    vt->defined_keyed = Parrot_Object_defined_keyed;
+    vt->defined_keyed_int = Parrot_Object_defined_keyed_int;
+    vt->defined_keyed_str = Parrot_Object_defined_keyed_str;
+    vt->delete_keyed = Parrot_Object_delete_keyed;
+    vt->delete_keyed_int = Parrot_Object_delete_keyed_int;
+    vt->delete_keyed_str = Parrot_Object_delete_keyed_str;
+    vt->destroy = Parrot_Object_destroy;
+    vt->divide = Parrot_Object_divide;
+    vt->divide_float = Parrot_Object_divide_float;
+    vt->divide_int = Parrot_Object_divide_int;
+    vt->does = Parrot_Object_does;
+    vt->does_pmc = Parrot_Object_does_pmc;
+    vt->elements = Parrot_Object_elements;
+    vt->exists_keyed = Parrot_Object_exists_keyed;
+    vt->exists_keyed_int = Parrot_Object_exists_keyed_int;
+    vt->exists_keyed_str = Parrot_Object_exists_keyed_str;
+    vt->find_method = Parrot_Object_find_method;
+    vt->floor_divide = Parrot_Object_floor_divide;
+    vt->floor_divide_float = Parrot_Object_floor_divide_float;
+    vt->floor_divide_int = Parrot_Object_floor_divide_int;
+    vt->freeze = Parrot_Object_freeze;
+    vt->get_attr_keyed = Parrot_Object_get_attr_keyed;
+    vt->get_attr_str = Parrot_Object_get_attr_str;
+    vt->get_bool = Parrot_Object_get_bool;
+    vt->get_class = Parrot_Object_get_class;
+    vt->get_integer = Parrot_Object_get_integer;
+    vt->get_integer_keyed = Parrot_Object_get_integer_keyed;
+    vt->get_integer_keyed_int = Parrot_Object_get_integer_keyed_int;
+    vt->get_integer_keyed_str = Parrot_Object_get_integer_keyed_str;
+    vt->get_iter = Parrot_Object_get_iter;
+    vt->get_namespace = Parrot_Object_get_namespace;
+    vt->get_number = Parrot_Object_get_number;
+    vt->get_number_keyed = Parrot_Object_get_number_keyed;
+    vt->get_number_keyed_int = Parrot_Object_get_number_keyed_int;
+    vt->get_number_keyed_str = Parrot_Object_get_number_keyed_str;
+    vt->get_pmc = Parrot_Object_get_pmc;
+    vt->get_pmc_keyed = Parrot_Object_get_pmc_keyed;
+    vt->get_pmc_keyed_int = Parrot_Object_get_pmc_keyed_int;
+    vt->get_pmc_keyed_str = Parrot_Object_get_pmc_keyed_str;
+    vt->get_pointer = Parrot_Object_get_pointer;
+    vt->get_pointer_keyed = Parrot_Object_get_pointer_keyed;
+    vt->get_pointer_keyed_int = Parrot_Object_get_pointer_keyed_int;
+    vt->get_pointer_keyed_str = Parrot_Object_get_pointer_keyed_str;
+    vt->get_repr = Parrot_Object_get_repr;
+    vt->get_string = Parrot_Object_get_string;
+    vt->get_string_keyed = Parrot_Object_get_string_keyed;
+    vt->get_string_keyed_int = Parrot_Object_get_string_keyed_int;
+    vt->get_string_keyed_str = Parrot_Object_get_string_keyed_str;
+    vt->hashvalue = Parrot_Object_hashvalue;
+    vt->i_absolute = Parrot_Object_i_absolute;
+    vt->i_add = Parrot_Object_i_add;
+    vt->i_add_float = Parrot_Object_i_add_float;
+    vt->i_add_int = Parrot_Object_i_add_int;
+    vt->i_concatenate = Parrot_Object_i_concatenate;
+    vt->i_concatenate_str = Parrot_Object_i_concatenate_str;
+    vt->i_divide = Parrot_Object_i_divide;
+    vt->i_divide_float = Parrot_Object_i_divide_float;
+    vt->i_divide_int = Parrot_Object_i_divide_int;
+    vt->i_floor_divide = Parrot_Object_i_floor_divide;
+    vt->i_floor_divide_float = Parrot_Object_i_floor_divide_float;
+    vt->i_floor_divide_int = Parrot_Object_i_floor_divide_int;
+    vt->i_modulus = Parrot_Object_i_modulus;
+    vt->i_modulus_float = Parrot_Object_i_modulus_float;
+    vt->i_modulus_int = Parrot_Object_i_modulus_int;
+    vt->i_multiply = Parrot_Object_i_multiply;
+    vt->i_multiply_float = Parrot_Object_i_multiply_float;
+    vt->i_multiply_int = Parrot_Object_i_multiply_int;
+    vt->i_neg = Parrot_Object_i_neg;
+    vt->i_repeat = Parrot_Object_i_repeat;
+    vt->i_repeat_int = Parrot_Object_i_repeat_int;
+    vt->i_subtract = Parrot_Object_i_subtract;
+    vt->i_subtract_float = Parrot_Object_i_subtract_float;
+    vt->i_subtract_int = Parrot_Object_i_subtract_int;
+    vt->increment = Parrot_Object_increment;
+    vt->init = Parrot_Object_init;
+    vt->init_int = Parrot_Object_init_int;
+    vt->init_pmc = Parrot_Object_init_pmc;
+    vt->inspect = Parrot_Object_inspect;
+    vt->inspect_str = Parrot_Object_inspect_str;
+    vt->instantiate = Parrot_Object_instantiate;
+    vt->invoke = Parrot_Object_invoke;
+    vt->is_equal = Parrot_Object_is_equal;
+    vt->is_equal_num = Parrot_Object_is_equal_num;
+    vt->is_equal_string = Parrot_Object_is_equal_string;
+    vt->is_same = Parrot_Object_is_same;
+    vt->isa = Parrot_Object_isa;
+    vt->isa_pmc = Parrot_Object_isa_pmc;
+    vt->mark = Parrot_Object_mark;
+    vt->modulus = Parrot_Object_modulus;
+    vt->modulus_float = Parrot_Object_modulus_float;
+    vt->modulus_int = Parrot_Object_modulus_int;
+    vt->morph = Parrot_Object_morph;
+    vt->multiply = Parrot_Object_multiply;
+    vt->multiply_float = Parrot_Object_multiply_float;
+    vt->multiply_int = Parrot_Object_multiply_int;
+    vt->name = Parrot_Object_name;
+    vt->neg = Parrot_Object_neg;
+    vt->pop_float = Parrot_Object_pop_float;
+    vt->pop_integer = Parrot_Object_pop_integer;
+    vt->pop_pmc = Parrot_Object_pop_pmc;
+    vt->pop_string = Parrot_Object_pop_string;
+    vt->push_float = Parrot_Object_push_float;
+    vt->push_integer = Parrot_Object_push_integer;
+    vt->push_pmc = Parrot_Object_push_pmc;
+    vt->push_string = Parrot_Object_push_string;
+    vt->remove_attribute = Parrot_Object_remove_attribute;
+    vt->remove_method = Parrot_Object_remove_method;
+    vt->remove_parent = Parrot_Object_remove_parent;
+    vt->remove_role = Parrot_Object_remove_role;
+    vt->remove_vtable_override = Parrot_Object_remove_vtable_override;
+    vt->repeat = Parrot_Object_repeat;
+    vt->repeat_int = Parrot_Object_repeat_int;
+    vt->set_attr_keyed = Parrot_Object_set_attr_keyed;
+    vt->set_attr_str = Parrot_Object_set_attr_str;
+    vt->set_bool = Parrot_Object_set_bool;
+    vt->set_integer_keyed = Parrot_Object_set_integer_keyed;
+    vt->set_integer_keyed_int = Parrot_Object_set_integer_keyed_int;
+    vt->set_integer_keyed_str = Parrot_Object_set_integer_keyed_str;
+    vt->set_integer_native = Parrot_Object_set_integer_native;
+    vt->set_number_keyed = Parrot_Object_set_number_keyed;
+    vt->set_number_keyed_int = Parrot_Object_set_number_keyed_int;
+    vt->set_number_keyed_str = Parrot_Object_set_number_keyed_str;
+    vt->set_number_native = Parrot_Object_set_number_native;
+    vt->set_pmc = Parrot_Object_set_pmc;
+    vt->set_pmc_keyed = Parrot_Object_set_pmc_keyed;
+    vt->set_pmc_keyed_int = Parrot_Object_set_pmc_keyed_int;
+    vt->set_pmc_keyed_str = Parrot_Object_set_pmc_keyed_str;
+    vt->set_pointer = Parrot_Object_set_pointer;
+    vt->set_pointer_keyed = Parrot_Object_set_pointer_keyed;
+    vt->set_pointer_keyed_int = Parrot_Object_set_pointer_keyed_int;
+    vt->set_pointer_keyed_str = Parrot_Object_set_pointer_keyed_str;
+    vt->set_string_keyed = Parrot_Object_set_string_keyed;
+    vt->set_string_keyed_int = Parrot_Object_set_string_keyed_int;
+    vt->set_string_keyed_str = Parrot_Object_set_string_keyed_str;
+    vt->set_string_native = Parrot_Object_set_string_native;
+    vt->share = Parrot_Object_share;
+    vt->shift_float = Parrot_Object_shift_float;
+    vt->shift_integer = Parrot_Object_shift_integer;
+    vt->shift_pmc = Parrot_Object_shift_pmc;
+    vt->shift_string = Parrot_Object_shift_string;
+    vt->splice = Parrot_Object_splice;
+    vt->substr = Parrot_Object_substr;
+    vt->subtract = Parrot_Object_subtract;
+    vt->subtract_float = Parrot_Object_subtract_float;
+    vt->subtract_int = Parrot_Object_subtract_int;
+    vt->thaw = Parrot_Object_thaw;
+    vt->thawfinish = Parrot_Object_thawfinish;
+    vt->type = Parrot_Object_type;
+    vt->unshift_float = Parrot_Object_unshift_float;
+    vt->unshift_integer = Parrot_Object_unshift_integer;
+    vt->unshift_pmc = Parrot_Object_unshift_pmc;
+    vt->unshift_string = Parrot_Object_unshift_string;
+    vt->visit = Parrot_Object_visit;
+    vt->attr_size = sizeof(Parrot_Object_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_Object_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->absolute = Parrot_Object_absolute;
+    vt->add = Parrot_Object_add;
+    vt->add_float = Parrot_Object_add_float;
+    vt->add_int = Parrot_Object_add_int;
+    vt->clone = Parrot_Object_clone;
+    vt->clone_pmc = Parrot_Object_clone_pmc;
+    vt->cmp = Parrot_Object_cmp;
+    vt->cmp_num = Parrot_Object_cmp_num;
+    vt->cmp_pmc = Parrot_Object_cmp_pmc;
+    vt->cmp_string = Parrot_Object_cmp_string;
+    vt->concatenate = Parrot_Object_concatenate;
+    vt->concatenate_str = Parrot_Object_concatenate_str;
+    vt->defined = Parrot_Object_defined;
+    vt->defined_keyed = Parrot_Object_defined_keyed;
+    vt->defined_keyed_int = Parrot_Object_defined_keyed_int;
+    vt->defined_keyed_str = Parrot_Object_defined_keyed_str;
+    vt->destroy = Parrot_Object_destroy;
+    vt->divide = Parrot_Object_divide;
+    vt->divide_float = Parrot_Object_divide_float;
+    vt->divide_int = Parrot_Object_divide_int;
+    vt->does = Parrot_Object_does;
+    vt->does_pmc = Parrot_Object_does_pmc;
+    vt->elements = Parrot_Object_elements;
+    vt->exists_keyed = Parrot_Object_exists_keyed;
+    vt->exists_keyed_int = Parrot_Object_exists_keyed_int;
+    vt->exists_keyed_str = Parrot_Object_exists_keyed_str;
+    vt->find_method = Parrot_Object_find_method;
+    vt->floor_divide = Parrot_Object_floor_divide;
+    vt->floor_divide_float = Parrot_Object_floor_divide_float;
+    vt->floor_divide_int = Parrot_Object_floor_divide_int;
+    vt->freeze = Parrot_Object_freeze;
+    vt->get_attr_keyed = Parrot_Object_get_attr_keyed;
+    vt->get_attr_str = Parrot_Object_get_attr_str;
+    vt->get_bool = Parrot_Object_get_bool;
+    vt->get_class = Parrot_Object_get_class;
+    vt->get_integer = Parrot_Object_get_integer;
+    vt->get_integer_keyed = Parrot_Object_get_integer_keyed;
+    vt->get_integer_keyed_int = Parrot_Object_get_integer_keyed_int;
+    vt->get_integer_keyed_str = Parrot_Object_get_integer_keyed_str;
+    vt->get_iter = Parrot_Object_get_iter;
+    vt->get_namespace = Parrot_Object_get_namespace;
+    vt->get_number = Parrot_Object_get_number;
+    vt->get_number_keyed = Parrot_Object_get_number_keyed;
+    vt->get_number_keyed_int = Parrot_Object_get_number_keyed_int;
+    vt->get_number_keyed_str = Parrot_Object_get_number_keyed_str;
+    vt->get_pmc = Parrot_Object_get_pmc;
+    vt->get_pmc_keyed = Parrot_Object_get_pmc_keyed;
+    vt->get_pmc_keyed_int = Parrot_Object_get_pmc_keyed_int;
+    vt->get_pmc_keyed_str = Parrot_Object_get_pmc_keyed_str;
+    vt->get_pointer = Parrot_Object_get_pointer;
+    vt->get_pointer_keyed = Parrot_Object_get_pointer_keyed;
+    vt->get_pointer_keyed_int = Parrot_Object_get_pointer_keyed_int;
+    vt->get_pointer_keyed_str = Parrot_Object_get_pointer_keyed_str;
+    vt->get_repr = Parrot_Object_get_repr;
+    vt->get_string = Parrot_Object_get_string;
+    vt->get_string_keyed = Parrot_Object_get_string_keyed;
+    vt->get_string_keyed_int = Parrot_Object_get_string_keyed_int;
+    vt->get_string_keyed_str = Parrot_Object_get_string_keyed_str;
+    vt->hashvalue = Parrot_Object_hashvalue;
+    vt->inspect = Parrot_Object_inspect;
+    vt->inspect_str = Parrot_Object_inspect_str;
+    vt->instantiate = Parrot_Object_instantiate;
+    vt->invoke = Parrot_Object_invoke;
+    vt->is_equal = Parrot_Object_is_equal;
+    vt->is_equal_num = Parrot_Object_is_equal_num;
+    vt->is_equal_string = Parrot_Object_is_equal_string;
+    vt->is_same = Parrot_Object_is_same;
+    vt->isa = Parrot_Object_isa;
+    vt->isa_pmc = Parrot_Object_isa_pmc;
+    vt->mark = Parrot_Object_mark;
+    vt->modulus = Parrot_Object_modulus;
+    vt->modulus_float = Parrot_Object_modulus_float;
+    vt->modulus_int = Parrot_Object_modulus_int;
+    vt->multiply = Parrot_Object_multiply;
+    vt->multiply_float = Parrot_Object_multiply_float;
+    vt->multiply_int = Parrot_Object_multiply_int;
+    vt->name = Parrot_Object_name;
+    vt->neg = Parrot_Object_neg;
+    vt->repeat = Parrot_Object_repeat;
+    vt->repeat_int = Parrot_Object_repeat_int;
+    vt->substr = Parrot_Object_substr;
+    vt->subtract = Parrot_Object_subtract;
+    vt->subtract_float = Parrot_Object_subtract_float;
+    vt->subtract_int = Parrot_Object_subtract_int;
+    vt->type = Parrot_Object_type;
+    vt->visit = Parrot_Object_visit;
+    vt->attr_size = sizeof(Parrot_Object_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Object_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_Object_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Object_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_Object_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_Object_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "Object"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_Object_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "Object")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_Object_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "F_class :attrib_store Inum_attribs Sattrib_kinds ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_Object_get_vtable(interp);
+        vt->base_type      = enum_class_Object;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "Object");
+        vt->provides_str = CONST_STRING_GEN(interp, "scalar");
+        vt->isa_hash     = Parrot_Object_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_Object_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_Object;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_Object_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+        }
+    } /* pass */
+} /* Parrot_Object_class_init */
+
+#line 1068 "./src/pmc/object.pmc"
+
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<docs/pdds/pdd15_objects.pod>.
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
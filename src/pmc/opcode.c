@@ -0,0 +1,492 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/opcode.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_fixedintegerarray.h"
+#include "pmc_opcode.h"
+#include "pmc_default.h"
+#include "opcode.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/opcode.pmc"
+/*
+Copyright (C) 2010-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/opcode.pmc - Opcode PMC
+
+=head1 DESCRIPTION
+
+Contains information on an opcode.  Returned by various functions in the
+C<OpLib> PMC.
+
+=cut
+
+*/
+
+#include "parrot/parrot.h"
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+#line 45 "./src/pmc/opcode.c"
+static  INTVAL  Parrot_Opcode_elements(SHIM_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_Opcode_get_integer(SHIM_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_Opcode_get_integer_keyed_int(SHIM_INTERP, ARGMOD(PMC *_self), INTVAL i);
+static  FLOATVAL  Parrot_Opcode_get_number(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING*  Parrot_Opcode_get_string(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Opcode_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Opcode_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void  Parrot_Opcode_set_pointer(PARROT_INTERP, ARGMOD(PMC *_self), void *i);
+static  void Parrot_Opcode_nci_family_name(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Opcode_nci_jump(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Opcode_nci_dirs(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Opcode_nci_labels(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_Opcode_class_init(PARROT_INTERP, int, int);
+void    Parrot_Opcode_ro_class_init(PARROT_INTERP, int, int);
+static  INTVAL 
+Parrot_Opcode_elements(SHIM_INTERP, ARGMOD(PMC *_self))
+{
+#line 137 "./src/pmc/opcode.pmc"
+
+    const Parrot_Opcode_attributes * const attrs = PARROT_OPCODE(_self);
+    if (!attrs->info)
+        return -1;
+    return attrs->info->op_count - 1;
+#line 69 "./src/pmc/opcode.c"
+}
+static  INTVAL 
+Parrot_Opcode_get_integer(SHIM_INTERP, ARGMOD(PMC *_self))
+{
+#line 78 "./src/pmc/opcode.pmc"
+
+    const Parrot_Opcode_attributes * const attrs = PARROT_OPCODE(_self);
+    if (!attrs->info)
+        return -1;
+    return attrs->op_number;
+#line 80 "./src/pmc/opcode.c"
+}
+static  INTVAL 
+Parrot_Opcode_get_integer_keyed_int(SHIM_INTERP, ARGMOD(PMC *_self), INTVAL i)
+{
+#line 183 "./src/pmc/opcode.pmc"
+
+    const Parrot_Opcode_attributes * const attrs = PARROT_OPCODE(_self);
+    return i < attrs->info->op_count - 1
+           ? (INTVAL)attrs->info->types[i]
+           : -1;
+#line 91 "./src/pmc/opcode.c"
+}
+static  FLOATVAL 
+Parrot_Opcode_get_number(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 86 "./src/pmc/opcode.pmc"
+
+    return Parrot_Opcode_get_integer(interp, _self);
+#line 99 "./src/pmc/opcode.c"
+}
+static  STRING* 
+Parrot_Opcode_get_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 120 "./src/pmc/opcode.pmc"
+
+    Parrot_Opcode_attributes * const attrs = PARROT_OPCODE(_self);
+    const char * const name                = attrs->info->full_name;
+    const INTVAL len                       = strlen(name);
+    return Parrot_str_new(interp, name, len);
+#line 110 "./src/pmc/opcode.c"
+}
+static  void 
+Parrot_Opcode_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 41 "./src/pmc/opcode.pmc"
+
+    /**/UNUSED(_self)
+    Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+        "Opcode must be created from OpLib.");
+#line 120 "./src/pmc/opcode.c"
+}
+static  void 
+Parrot_Opcode_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+#line 102 "./src/pmc/opcode.pmc"
+
+    Parrot_Opcode_attributes * const attrs = PARROT_OPCODE(_self);
+    if (attrs->info)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "Opcode has already been initialized");
+    attrs->op_number = value;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 133 "./src/pmc/opcode.c"
+}
+static  void 
+Parrot_Opcode_set_pointer(PARROT_INTERP, ARGMOD(PMC *_self), void *i)
+{
+#line 58 "./src/pmc/opcode.pmc"
+
+    Parrot_Opcode_attributes * const attrs = PARROT_OPCODE(_self);
+    if (attrs->info)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "Opcode has already been initialized");
+    attrs->info = (op_info_t *)i;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 146 "./src/pmc/opcode.c"
+}
+static  void
+Parrot_Opcode_nci_family_name(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 207 "./src/pmc/opcode.pmc"
+
+    const char * const name = PARROT_OPCODE(_self)->info->name;
+    const INTVAL len = strlen(name);
+    STRING * const result = Parrot_str_new(interp, name, len);
+    #line 171 "./src/pmc/opcode.c"
+     {
+        VTABLE_set_string_keyed_int(interp, _call_object, 0, (STRING*)result);
+        
+        return;
+     }
+#line 211 "./src/pmc/opcode.pmc"
+
+#line 179 "./src/pmc/opcode.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Opcode_nci_jump(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 224 "./src/pmc/opcode.pmc"
+
+    const op_info_t * const info = PARROT_OPCODE(_self)->info;
+    const INTVAL jump = info->jump;
+    #line 210 "./src/pmc/opcode.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)jump);
+        
+        return;
+     }
+#line 227 "./src/pmc/opcode.pmc"
+
+#line 218 "./src/pmc/opcode.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Opcode_nci_dirs(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 252 "./src/pmc/opcode.pmc"
+
+    const op_info_t * const info = PARROT_OPCODE(_self)->info;
+    const INTVAL arg_count = info->op_count - 1;
+    PMC *result;
+    if (arg_count > 0) {
+        INTVAL i;
+        result = Parrot_pmc_new_init_int(interp, enum_class_FixedIntegerArray, arg_count);
+        for (i = 0; i < arg_count; ++i)
+            VTABLE_set_integer_keyed_int(interp, result, i, (INTVAL) info->dirs[i]);
+    }
+    else
+        result = Parrot_pmc_new(interp, enum_class_FixedIntegerArray);
+    #line 258 "./src/pmc/opcode.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)result);
+        
+        return;
+     }
+#line 264 "./src/pmc/opcode.pmc"
+
+#line 266 "./src/pmc/opcode.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Opcode_nci_labels(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 277 "./src/pmc/opcode.pmc"
+
+    const op_info_t * const info = PARROT_OPCODE(_self)->info;
+    PMC * const result = Parrot_pmc_new(interp, enum_class_FixedIntegerArray);
+    const INTVAL arg_count = info->op_count - 1;
+    if (arg_count > 0) {
+        INTVAL i;
+        VTABLE_set_integer_native(interp, result, arg_count);
+        for (i = 0; i < arg_count; ++i)
+            VTABLE_set_integer_keyed_int(interp, result, i, (INTVAL) info->labels[i]);
+    }
+    #line 304 "./src/pmc/opcode.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)result);
+        
+        return;
+     }
+#line 287 "./src/pmc/opcode.pmc"
+
+#line 312 "./src/pmc/opcode.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_Opcode_update_vtable(VTABLE *vt) {
+    vt->elements = Parrot_Opcode_elements;
+    vt->get_integer = Parrot_Opcode_get_integer;
+    vt->get_integer_keyed_int = Parrot_Opcode_get_integer_keyed_int;
+    vt->get_number = Parrot_Opcode_get_number;
+    vt->get_string = Parrot_Opcode_get_string;
+    vt->init = Parrot_Opcode_init;
+    vt->set_integer_native = Parrot_Opcode_set_integer_native;
+    vt->set_pointer = Parrot_Opcode_set_pointer;
+    vt->attr_size = sizeof(Parrot_Opcode_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_Opcode_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->elements = Parrot_Opcode_elements;
+    vt->get_integer = Parrot_Opcode_get_integer;
+    vt->get_integer_keyed_int = Parrot_Opcode_get_integer_keyed_int;
+    vt->get_number = Parrot_Opcode_get_number;
+    vt->get_string = Parrot_Opcode_get_string;
+    vt->attr_size = sizeof(Parrot_Opcode_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Opcode_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_Opcode_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Opcode_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_Opcode_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_Opcode_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "Opcode"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_Opcode_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "Opcode")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_Opcode_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        ":info Iop_number ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_Opcode_get_vtable(interp);
+        vt->base_type      = enum_class_Opcode;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "Opcode");
+        vt->provides_str = CONST_STRING_GEN(interp, "scalar");
+        vt->isa_hash     = Parrot_Opcode_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_Opcode_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_Opcode;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_Opcode_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "family_name");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Opcode_nci_family_name),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "jump");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Opcode_nci_jump),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "dirs");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Opcode_nci_dirs),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "labels");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Opcode_nci_labels),
+                method_name, signature);
+        }
+        {
+        }
+    } /* pass */
+} /* Parrot_Opcode_class_init */
+
+#line 289 "./src/pmc/opcode.pmc"
+
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<src/pmc/oplib.pmc>
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
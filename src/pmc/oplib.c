@@ -0,0 +1,458 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/oplib.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_fixedintegerarray.h"
+#include "pmc_oplib.h"
+#include "pmc_default.h"
+#include "oplib.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/oplib.pmc"
+/*
+Copyright (C) 2010-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/oplib.pmc - OpLib PMC
+
+=head1 DESCRIPTION
+
+The PMC provides introspection on the opcodes contained in a library.
+
+=cut
+
+*/
+
+#include "parrot/parrot.h"
+#include "parrot/oplib/core_ops.h"
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+#line 45 "./src/pmc/oplib.c"
+static  INTVAL  Parrot_OpLib_elements(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_OpLib_get_integer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_OpLib_get_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  INTVAL  Parrot_OpLib_get_integer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name);
+static  PMC*  Parrot_OpLib_get_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  PMC*  Parrot_OpLib_get_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  PMC*  Parrot_OpLib_get_pmc_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name);
+static  void*  Parrot_OpLib_get_pointer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_OpLib_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_OpLib_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *name_pmc);
+static  void Parrot_OpLib_nci_op_family(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_OpLib_nci_version(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_OpLib_class_init(PARROT_INTERP, int, int);
+void    Parrot_OpLib_ro_class_init(PARROT_INTERP, int, int);
+static  INTVAL 
+Parrot_OpLib_elements(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 173 "./src/pmc/oplib.pmc"
+
+    const op_lib_t *oplib;
+    GETATTR_OpLib_oplib(interp, _self, oplib);
+    return oplib->op_count;
+#line 68 "./src/pmc/oplib.c"
+}
+static  INTVAL 
+Parrot_OpLib_get_integer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 179 "./src/pmc/oplib.pmc"
+
+    return Parrot_OpLib_elements(interp, _self);
+#line 76 "./src/pmc/oplib.c"
+}
+static  INTVAL 
+Parrot_OpLib_get_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 116 "./src/pmc/oplib.pmc"
+
+    STRING * const str_key = Parrot_key_string(interp, key);
+    return VTABLE_get_integer_keyed_str(interp, _self, str_key);
+#line 85 "./src/pmc/oplib.c"
+}
+static  INTVAL 
+Parrot_OpLib_get_integer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name)
+{
+#line 104 "./src/pmc/oplib.pmc"
+
+    const op_lib_t *oplib;
+    char * const  cstr = Parrot_str_to_cstring(interp, name);
+    INTVAL        num;
+
+    GETATTR_OpLib_oplib(interp, _self, oplib);
+    num  = oplib->_op_code(interp, cstr, 1);
+
+    Parrot_str_free_cstring(cstr);
+    return num;
+#line 101 "./src/pmc/oplib.c"
+}
+static  PMC* 
+Parrot_OpLib_get_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 129 "./src/pmc/oplib.pmc"
+
+    STRING * const strkey = VTABLE_get_string(interp, key);
+    return VTABLE_get_pmc_keyed_str(interp, _self, strkey);
+#line 110 "./src/pmc/oplib.c"
+}
+static  PMC* 
+Parrot_OpLib_get_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+#line 145 "./src/pmc/oplib.pmc"
+
+    op_lib_t *oplib;
+    GETATTR_OpLib_oplib(interp, _self, oplib);
+    if (value >= oplib->op_count ||
+                 value <  0) {
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_OUT_OF_BOUNDS,
+            "OpLib `%s': Opcode index %d out of bounds", oplib->name, value);
+    }
+    else {
+        PMC * const op = Parrot_pmc_new_noinit(interp, enum_class_Opcode);
+        VTABLE_set_integer_native(interp, op, value);
+        VTABLE_set_pointer(interp, op, &oplib->op_info_table[value]);
+        return op;
+    }
+#line 130 "./src/pmc/oplib.c"
+}
+static  PMC* 
+Parrot_OpLib_get_pmc_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name)
+{
+#line 121 "./src/pmc/oplib.pmc"
+
+    const INTVAL  num = Parrot_OpLib_get_integer_keyed_str(interp, _self, name);
+    if (num == -1)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_OUT_OF_BOUNDS,
+            "Opcode: Opcode %S not found", name);
+    return Parrot_OpLib_get_pmc_keyed_int(interp, _self, num);
+#line 142 "./src/pmc/oplib.c"
+}
+static  void* 
+Parrot_OpLib_get_pointer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 193 "./src/pmc/oplib.pmc"
+
+    op_lib_t *oplib;
+    GETATTR_OpLib_oplib(interp, _self, oplib);
+    return oplib;
+#line 152 "./src/pmc/oplib.c"
+}
+static  void 
+Parrot_OpLib_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 40 "./src/pmc/oplib.pmc"
+
+    /**/UNUSED(_self)
+    Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "OpLib must be initialized with an oplib name");
+#line 162 "./src/pmc/oplib.c"
+}
+static  void 
+Parrot_OpLib_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *name_pmc)
+{
+#line 56 "./src/pmc/oplib.pmc"
+
+    STRING   * const name      = VTABLE_get_string(interp, name_pmc);
+    char     * const name_cstr = Parrot_str_to_cstring(interp, name);
+    op_lib_t *oplib     = NULL;
+
+    if (STREQ(name_cstr, PARROT_CORE_OPLIB_NAME)) {
+        oplib = PARROT_CORE_OPLIB_INIT(interp, 1);
+    }
+    else {
+        int i;
+        for (i = 0; i < interp->n_libs; i++) {
+            if (STREQ(name_cstr, interp->all_op_libs[i]->name)) {
+                oplib = interp->all_op_libs[i];
+                break;
+            }
+        }
+    }
+
+    Parrot_str_free_cstring(name_cstr);
+
+    if (!oplib)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_LIBRARY_NOT_LOADED,
+                "Could not find oplib `%S'", name);
+
+    SETATTR_OpLib_oplib(interp, _self, oplib);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 194 "./src/pmc/oplib.c"
+}
+static  void
+Parrot_OpLib_nci_op_family(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* shortname;
+    
+    const INTVAL arity = 2; /* "PiS" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    shortname = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 216 "./src/pmc/oplib.pmc"
+
+    char * const sname = Parrot_str_to_cstring(interp, shortname);
+    const op_lib_t *oplib;
+    op_info_t *table;
+    PMC *result = PMCNULL;
+    INTVAL i;
+
+    GETATTR_OpLib_oplib(interp, _self, oplib);
+    table = oplib->op_info_table;
+    for (i = 0; i < oplib->op_count; ++i) {
+        if (strcmp(table[i].name, sname) == 0) {
+            if (PMC_IS_NULL(result))
+                result = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+            VTABLE_push_pmc(interp, result, _self->vtable->get_pmc_keyed_int(interp, _self, i));
+        }
+    }
+    Parrot_str_free_cstring(sname);
+    #line 234 "./src/pmc/oplib.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)result);
+        
+        return;
+     }
+#line 233 "./src/pmc/oplib.pmc"
+
+#line 242 "./src/pmc/oplib.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_OpLib_nci_version(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 247 "./src/pmc/oplib.pmc"
+
+    const op_lib_t *oplib;
+    PMC * const version_array = Parrot_pmc_new_init_int(interp,
+            enum_class_FixedIntegerArray, 2);
+    GETATTR_OpLib_oplib(interp, _self, oplib);
+    VTABLE_set_integer_keyed_int(interp, version_array,
+            0, oplib->bc_major_version);
+    VTABLE_set_integer_keyed_int(interp, version_array,
+            1, oplib->bc_minor_version);
+    #line 279 "./src/pmc/oplib.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)version_array);
+        
+        return;
+     }
+#line 256 "./src/pmc/oplib.pmc"
+
+#line 287 "./src/pmc/oplib.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_OpLib_update_vtable(VTABLE *vt) {
+    vt->elements = Parrot_OpLib_elements;
+    vt->get_integer = Parrot_OpLib_get_integer;
+    vt->get_integer_keyed = Parrot_OpLib_get_integer_keyed;
+    vt->get_integer_keyed_str = Parrot_OpLib_get_integer_keyed_str;
+    vt->get_pmc_keyed = Parrot_OpLib_get_pmc_keyed;
+    vt->get_pmc_keyed_int = Parrot_OpLib_get_pmc_keyed_int;
+    vt->get_pmc_keyed_str = Parrot_OpLib_get_pmc_keyed_str;
+    vt->get_pointer = Parrot_OpLib_get_pointer;
+    vt->init = Parrot_OpLib_init;
+    vt->init_pmc = Parrot_OpLib_init_pmc;
+    vt->attr_size = sizeof(Parrot_OpLib_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_OpLib_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->elements = Parrot_OpLib_elements;
+    vt->get_integer = Parrot_OpLib_get_integer;
+    vt->get_integer_keyed = Parrot_OpLib_get_integer_keyed;
+    vt->get_integer_keyed_str = Parrot_OpLib_get_integer_keyed_str;
+    vt->get_pmc_keyed = Parrot_OpLib_get_pmc_keyed;
+    vt->get_pmc_keyed_int = Parrot_OpLib_get_pmc_keyed_int;
+    vt->get_pmc_keyed_str = Parrot_OpLib_get_pmc_keyed_str;
+    vt->get_pointer = Parrot_OpLib_get_pointer;
+    vt->attr_size = sizeof(Parrot_OpLib_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_OpLib_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_OpLib_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_OpLib_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_OpLib_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_OpLib_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "OpLib"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_OpLib_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "OpLib")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_OpLib_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        ":oplib ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_OpLib_get_vtable(interp);
+        vt->base_type      = enum_class_OpLib;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "OpLib");
+        vt->provides_str = CONST_STRING_GEN(interp, "scalar");
+        vt->isa_hash     = Parrot_OpLib_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_OpLib_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_OpLib;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_OpLib_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "op_family");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_OpLib_nci_op_family),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "version");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_OpLib_nci_version),
+                method_name, signature);
+        }
+        {
+        }
+    } /* pass */
+} /* Parrot_OpLib_class_init */
+
+#line 257 "./src/pmc/oplib.pmc"
+
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<src/pmc/opcode.pmc>
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -0,0 +1,359 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/orderedhashiterator.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_orderedhashiterator.h"
+#include "pmc_iterator.h"
+#include "pmc_default.h"
+#include "orderedhashiterator.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/orderedhashiterator.pmc"
+/*
+Copyright (C) 2001-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/orderedhashiterator.pmc - OrderedHashIterator
+
+=head1 DESCRIPTION
+
+Specialized iterator for an OrderedHash PMC.
+
+=head1 METHODS
+
+=over 4
+
+=cut
+
+*/
+
+#include "pmc/pmc_orderedhash.h"
+#include "pmc/pmc_hashiteratorkey.h"
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+#line 49 "./src/pmc/orderedhashiterator.c"
+static  PMC*  Parrot_OrderedHashIterator_clone(SHIM_INTERP, SHIM(PMC *_self));
+static  INTVAL  Parrot_OrderedHashIterator_elements(SHIM_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_OrderedHashIterator_get_bool(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_OrderedHashIterator_get_integer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC*  Parrot_OrderedHashIterator_get_pmc(SHIM_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_OrderedHashIterator_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *hash);
+static  void  Parrot_OrderedHashIterator_mark(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC  * Parrot_OrderedHashIterator_pop_pmc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_OrderedHashIterator_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  PMC  * Parrot_OrderedHashIterator_shift_pmc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING*  Parrot_OrderedHashIterator_shift_string(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_OrderedHashIterator_class_init(PARROT_INTERP, int, int);
+void    Parrot_OrderedHashIterator_ro_class_init(PARROT_INTERP, int, int);
+static  PMC* 
+Parrot_OrderedHashIterator_clone(SHIM_INTERP, SHIM(PMC *_self))
+{
+#line 80 "./src/pmc/orderedhashiterator.pmc"
+    return PMCNULL;
+#line 68 "./src/pmc/orderedhashiterator.c"
+}
+static  INTVAL 
+Parrot_OrderedHashIterator_elements(SHIM_INTERP, ARGMOD(PMC *_self))
+{
+#line 155 "./src/pmc/orderedhashiterator.pmc"
+    return PARROT_ORDEREDHASHITERATOR(_self)->elements;
+#line 75 "./src/pmc/orderedhashiterator.c"
+}
+static  INTVAL 
+Parrot_OrderedHashIterator_get_bool(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 141 "./src/pmc/orderedhashiterator.pmc"
+
+    return Parrot_OrderedHashIterator_elements(interp, _self) > 0;
+#line 83 "./src/pmc/orderedhashiterator.c"
+}
+static  INTVAL 
+Parrot_OrderedHashIterator_get_integer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 160 "./src/pmc/orderedhashiterator.pmc"
+
+    return VTABLE_elements(interp, _self);
+#line 91 "./src/pmc/orderedhashiterator.c"
+}
+static  PMC* 
+Parrot_OrderedHashIterator_get_pmc(SHIM_INTERP, ARGMOD(PMC *_self))
+{
+#line 126 "./src/pmc/orderedhashiterator.pmc"
+    return PARROT_ORDEREDHASHITERATOR(_self)->pmc_hash;
+#line 98 "./src/pmc/orderedhashiterator.c"
+}
+static  void 
+Parrot_OrderedHashIterator_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *hash)
+{
+#line 45 "./src/pmc/orderedhashiterator.pmc"
+
+    Parrot_OrderedHashIterator_attributes * const attrs =
+       (Parrot_OrderedHashIterator_attributes *) PMC_data(_self);
+
+    attrs->pmc_hash         = hash;
+    attrs->pos              = 0;
+    attrs->elements         = VTABLE_elements(interp, hash);
+    attrs->next_entry       = PARROT_ORDEREDHASH(hash)->first;
+    PMC_data(_self)          = attrs;
+
+    PObj_custom_mark_SET(_self);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 116 "./src/pmc/orderedhashiterator.c"
+}
+static  void 
+Parrot_OrderedHashIterator_mark(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 68 "./src/pmc/orderedhashiterator.pmc"
+
+    PMC * const hash = PARROT_ORDEREDHASHITERATOR(_self)->pmc_hash;
+    Parrot_gc_mark_PMC_alive(interp, hash);
+#line 125 "./src/pmc/orderedhashiterator.c"
+}
+static  PMC  *
+Parrot_OrderedHashIterator_pop_pmc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 208 "./src/pmc/orderedhashiterator.pmc"
+
+    Parrot_OrderedHashIterator_attributes * const attrs =
+            PARROT_ORDEREDHASHITERATOR(_self);
+
+    PMC        *ret;
+
+    if (!attrs->elements)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_OUT_OF_BOUNDS,
+            "StopIteration");
+
+    ret               = VTABLE_get_pmc_keyed_int(interp, attrs->next_entry,
+            ORDERED_HASH_ITEM_KEY);
+    attrs->next_entry = VTABLE_get_pmc_keyed_int(interp, attrs->next_entry,
+            ORDERED_HASH_ITEM_PREV);
+    --attrs->pos;
+    --attrs->elements;
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+    return ret;
+#line 150 "./src/pmc/orderedhashiterator.c"
+}
+static  void 
+Parrot_OrderedHashIterator_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+#line 93 "./src/pmc/orderedhashiterator.pmc"
+
+    Parrot_OrderedHashIterator_attributes * const attrs =
+            PARROT_ORDEREDHASHITERATOR(_self);
+
+    /* Restart iterator */
+    attrs->elements = VTABLE_elements(interp, attrs->pmc_hash);
+    switch (value) {
+      case ITERATE_FROM_START:
+      case ITERATE_FROM_START_KEYS:
+        attrs->pos          = 0;
+        attrs->reverse      = 0;
+        attrs->next_entry   = PARROT_ORDEREDHASH(attrs->pmc_hash)->first;
+        break;
+      case ITERATE_FROM_END:
+        attrs->pos          = attrs->elements;
+        attrs->reverse      = 1;
+        attrs->next_entry   = PARROT_ORDEREDHASH(attrs->pmc_hash)->last;
+        break;
+      default:
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+                "HashIterator: unknown iterator type");
+    }
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 179 "./src/pmc/orderedhashiterator.c"
+}
+static  PMC  *
+Parrot_OrderedHashIterator_shift_pmc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 175 "./src/pmc/orderedhashiterator.pmc"
+
+    Parrot_OrderedHashIterator_attributes * const attrs =
+            PARROT_ORDEREDHASHITERATOR(_self);
+
+    PMC        *ret;
+
+    if (!attrs->elements)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_OUT_OF_BOUNDS,
+            "StopIteration");
+
+    /* Get bucket and move to next bucket */
+    ret               = VTABLE_get_pmc_keyed_int(interp, attrs->next_entry,
+            ORDERED_HASH_ITEM_KEY);
+    attrs->next_entry = VTABLE_get_pmc_keyed_int(interp, attrs->next_entry,
+            ORDERED_HASH_ITEM_NEXT);
+    ++attrs->pos;
+    --attrs->elements;
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+    return ret;
+#line 205 "./src/pmc/orderedhashiterator.c"
+}
+static  STRING* 
+Parrot_OrderedHashIterator_shift_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 233 "./src/pmc/orderedhashiterator.pmc"
+
+    PMC * const key = VTABLE_shift_pmc(interp, _self);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+    return VTABLE_get_string(interp, key);
+#line 215 "./src/pmc/orderedhashiterator.c"
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_OrderedHashIterator_update_vtable(VTABLE *vt) {
+    vt->clone = Parrot_OrderedHashIterator_clone;
+    vt->elements = Parrot_OrderedHashIterator_elements;
+    vt->get_bool = Parrot_OrderedHashIterator_get_bool;
+    vt->get_integer = Parrot_OrderedHashIterator_get_integer;
+    vt->get_pmc = Parrot_OrderedHashIterator_get_pmc;
+    vt->init_pmc = Parrot_OrderedHashIterator_init_pmc;
+    vt->mark = Parrot_OrderedHashIterator_mark;
+    vt->pop_pmc = Parrot_OrderedHashIterator_pop_pmc;
+    vt->set_integer_native = Parrot_OrderedHashIterator_set_integer_native;
+    vt->shift_pmc = Parrot_OrderedHashIterator_shift_pmc;
+    vt->shift_string = Parrot_OrderedHashIterator_shift_string;
+    vt->attr_size = sizeof(Parrot_OrderedHashIterator_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_OrderedHashIterator_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->clone = Parrot_OrderedHashIterator_clone;
+    vt->elements = Parrot_OrderedHashIterator_elements;
+    vt->get_bool = Parrot_OrderedHashIterator_get_bool;
+    vt->get_integer = Parrot_OrderedHashIterator_get_integer;
+    vt->get_pmc = Parrot_OrderedHashIterator_get_pmc;
+    vt->mark = Parrot_OrderedHashIterator_mark;
+    vt->attr_size = sizeof(Parrot_OrderedHashIterator_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_OrderedHashIterator_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_Iterator_get_vtable(interp);
+    Parrot_OrderedHashIterator_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_OrderedHashIterator_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_Iterator_ro_get_vtable(interp);
+    Parrot_OrderedHashIterator_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_OrderedHashIterator_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+    mro = Parrot_Iterator_get_mro(interp, mro);
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "OrderedHashIterator"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_OrderedHashIterator_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    isa = Parrot_Iterator_get_isa(interp, isa);
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "OrderedHashIterator")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_OrderedHashIterator_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "Fpmc_hash Fnext_entry Ipos Ielements Ireverse ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_OrderedHashIterator_get_vtable(interp);
+        vt->base_type      = enum_class_OrderedHashIterator;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "OrderedHashIterator");
+        vt->provides_str = CONST_STRING_GEN(interp, "iterator");
+        vt->isa_hash     = Parrot_OrderedHashIterator_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_OrderedHashIterator_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_OrderedHashIterator;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_OrderedHashIterator_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+        }
+    } /* pass */
+} /* Parrot_OrderedHashIterator_class_init */
+
+#line 237 "./src/pmc/orderedhashiterator.pmc"
+
+
+/*
+
+=back
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
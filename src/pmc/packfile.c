@@ -0,0 +1,747 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/packfile.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_fixedintegerarray.h"
+#include "pmc_packfile.h"
+#include "pmc_default.h"
+#include "packfile.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/packfile.pmc"
+/*
+Copyright (C) 2001-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/packfile.pmc - Packfile PMC
+
+=head1 DESCRIPTION
+
+This class implements a Packfile object, as specified in PDD13.  This object is
+the top level parser and serializer for *.pbc files.
+
+=head2 Methods
+
+=over 4
+
+=cut
+
+*/
+
+#include "pmc/pmc_packfiledirectory.h"
+
+typedef enum {
+    attr_wordsize,
+    attr_byteorder,
+    attr_fptype,
+    attr_version_major,
+    attr_version_minor,
+    attr_version_patch,
+    attr_bytecode_major,
+    attr_bytecode_minor,
+    attr_uuid_type,
+    attr_NONE = -1
+} AttrEnumPackfile;
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+static void copy_packfile_header(PARROT_INTERP,
+    ARGMOD(PMC *self),
+    ARGIN(PackFile *pf))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*self);
+
+static AttrEnumPackfile getAttrEnum(PARROT_INTERP,
+    ARGIN(const STRING *name))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+#define ASSERT_ARGS_copy_packfile_header __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(pf))
+#define ASSERT_ARGS_getAttrEnum __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(name))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+/*
+
+=item C<static void copy_packfile_header(PARROT_INTERP, PMC *self, PackFile
+*pf)>
+
+Copy attributes from PackFile* to Packfile PMC.
+
+=cut
+
+*/
+
+static void
+copy_packfile_header(PARROT_INTERP, ARGMOD(PMC *self), ARGIN(PackFile *pf))
+{
+    ASSERT_ARGS(copy_packfile_header)
+
+    Parrot_Packfile_attributes * const attrs = PARROT_PACKFILE(self);
+
+    attrs->wordsize         = pf->header->wordsize;
+    attrs->byteorder        = pf->header->byteorder;
+    attrs->fptype           = pf->header->floattype;
+    attrs->version_major    = pf->header->major;
+    attrs->version_minor    = pf->header->minor;
+    attrs->version_patch    = pf->header->patch;
+    attrs->bytecode_major   = pf->header->bc_major;
+    attrs->bytecode_minor   = pf->header->bc_minor;
+    attrs->uuid_type        = pf->header->uuid_type;
+
+    attrs->uuid = Parrot_str_new(interp, (char*)pf->header->uuid_data,
+            pf->header->uuid_size);
+
+}
+#line 118 "./src/pmc/packfile.c"
+static  INTVAL  Parrot_Packfile_get_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  INTVAL  Parrot_Packfile_get_integer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key);
+static  STRING  * Parrot_Packfile_get_string(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING  * Parrot_Packfile_get_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  STRING  * Parrot_Packfile_get_string_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key);
+static  void  Parrot_Packfile_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Packfile_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *view);
+static  void  Parrot_Packfile_mark(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Packfile_set_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, INTVAL val);
+static  void  Parrot_Packfile_set_integer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key, INTVAL value);
+static  void  Parrot_Packfile_set_pointer(PARROT_INTERP, ARGMOD(PMC *_self), void *ptr);
+static  void  Parrot_Packfile_set_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, STRING *val);
+static  void  Parrot_Packfile_set_string_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key, STRING *value);
+static  void  Parrot_Packfile_set_string_native(PARROT_INTERP, ARGMOD(PMC *_self), STRING *str);
+static  void Parrot_Packfile_nci_pack(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Packfile_nci_unpack(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Packfile_nci_get_directory(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Packfile_nci_view(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_Packfile_class_init(PARROT_INTERP, int, int);
+void    Parrot_Packfile_ro_class_init(PARROT_INTERP, int, int);
+static  INTVAL 
+Parrot_Packfile_get_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 348 "./src/pmc/packfile.pmc"
+
+    STRING * const s = VTABLE_get_string(interp, key);
+    return VTABLE_get_integer_keyed_str(interp, _self, s);
+#line 146 "./src/pmc/packfile.c"
+}
+static  INTVAL 
+Parrot_Packfile_get_integer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key)
+{
+#line 275 "./src/pmc/packfile.pmc"
+
+    const Parrot_Packfile_attributes * const attrs = PARROT_PACKFILE(_self);
+
+    INTVAL result;
+    switch (getAttrEnum(interp, key)) {
+      case attr_wordsize:
+        result = attrs->wordsize;
+        break;
+      case attr_byteorder:
+        result = attrs->byteorder;
+        break;
+      case attr_fptype:
+        result = attrs->fptype;
+        break;
+      case attr_version_major:
+        result = attrs->version_major;
+        break;
+      case attr_version_minor:
+        result = attrs->version_minor;
+        break;
+      case attr_version_patch:
+        result = attrs->version_patch;
+        break;
+      case attr_bytecode_major:
+        result = attrs->bytecode_major;
+        break;
+      case attr_bytecode_minor:
+        result = attrs->bytecode_minor;
+        break;
+      case attr_uuid_type:
+        result = attrs->uuid_type;
+        break;
+      default:
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_KEY_NOT_FOUND,
+                "Packfile: No such integer key \"%Ss\"", key);
+    }
+    return result;
+#line 189 "./src/pmc/packfile.c"
+}
+static  STRING  *
+Parrot_Packfile_get_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 172 "./src/pmc/packfile.pmc"
+
+    STRING *str;
+    const Parrot_Packfile_attributes * const attrs = PARROT_PACKFILE(_self);
+    PackFile                   * const pf =
+            (PackFile*)VTABLE_get_pointer(interp, attrs->directory);
+
+    /* Copy related attributes to header */
+    pf->header->major     = attrs->version_major;
+    pf->header->minor     = attrs->version_minor;
+    pf->header->patch     = attrs->version_patch;
+    pf->header->uuid_type = attrs->uuid_type;
+
+    str = Parrot_pf_serialize(interp, pf);
+
+    PackFile_destroy(interp, pf);
+    return str;
+#line 211 "./src/pmc/packfile.c"
+}
+static  STRING  *
+Parrot_Packfile_get_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 364 "./src/pmc/packfile.pmc"
+
+    STRING * const s = VTABLE_get_string(interp, key);
+    return VTABLE_get_string_keyed_str(interp, _self, s);
+#line 220 "./src/pmc/packfile.c"
+}
+static  STRING  *
+Parrot_Packfile_get_string_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key)
+{
+#line 329 "./src/pmc/packfile.pmc"
+
+    if (STRING_equal(interp, key, CONST_STRING(interp, "uuid")))
+        return PARROT_PACKFILE(_self)->uuid;
+
+    Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_KEY_NOT_FOUND,
+                "Packfile: No such string key \"%Ss\"", key);
+#line 232 "./src/pmc/packfile.c"
+}
+static  void 
+Parrot_Packfile_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 122 "./src/pmc/packfile.pmc"
+
+    Parrot_Packfile_attributes * const attrs =
+            PMC_data_typed(_self, Parrot_Packfile_attributes*);
+    PackFile                   *pf;
+
+    /* copy_packfile_header can trigger GC. Set custom_mark flag early */
+    PObj_custom_mark_SET(_self);
+
+    attrs->uuid     = CONST_STRING(interp, "");
+    attrs->directory = Parrot_pmc_new(interp, enum_class_PackfileDirectory);
+
+    /* Create dummy PackFile and copy default attributes to self */
+    pf = PackFile_new(interp, 0);
+    copy_packfile_header(interp, _self, pf);
+    PackFile_destroy(interp, pf);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 254 "./src/pmc/packfile.c"
+}
+static  void 
+Parrot_Packfile_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *view)
+{
+#line 139 "./src/pmc/packfile.pmc"
+
+    VTABLE_init(interp, _self);
+    VTABLE_set_pointer(interp, _self, VTABLE_get_pointer(interp, view));
+#line 263 "./src/pmc/packfile.c"
+}
+static  void 
+Parrot_Packfile_mark(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 155 "./src/pmc/packfile.pmc"
+
+    Parrot_Packfile_attributes * const attrs = PARROT_PACKFILE(_self);
+
+    Parrot_gc_mark_STRING_alive(interp, attrs->uuid);
+    Parrot_gc_mark_PMC_alive(interp, attrs->directory);
+#line 274 "./src/pmc/packfile.c"
+}
+static  void 
+Parrot_Packfile_set_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, INTVAL val)
+{
+#line 422 "./src/pmc/packfile.pmc"
+
+    STRING * const s = VTABLE_get_string(interp, key);
+    VTABLE_set_integer_keyed_str(interp, _self, s, val);
+#line 283 "./src/pmc/packfile.c"
+}
+static  void 
+Parrot_Packfile_set_integer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key, INTVAL value)
+{
+#line 390 "./src/pmc/packfile.pmc"
+
+    Parrot_Packfile_attributes * const attrs = PARROT_PACKFILE(_self);
+    switch (getAttrEnum(interp, key)) {
+      case attr_version_major:
+        attrs->version_major = value;
+        break;
+      case attr_version_minor:
+        attrs->version_minor = value;
+        break;
+      case attr_version_patch:
+        attrs->version_patch = value;
+        break;
+      case attr_uuid_type:
+        attrs->uuid_type = value;
+        break;
+      default:
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_KEY_NOT_FOUND,
+                "Packfile: No such integer key \"%Ss\"", key);
+    }
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 309 "./src/pmc/packfile.c"
+}
+static  void 
+Parrot_Packfile_set_pointer(PARROT_INTERP, ARGMOD(PMC *_self), void *ptr)
+{
+#line 234 "./src/pmc/packfile.pmc"
+
+    Parrot_Packfile_attributes * const attrs = PARROT_PACKFILE(_self);
+    PackFile * const pf = (PackFile *)ptr;
+    Parrot_block_GC_mark(interp);
+    copy_packfile_header(interp, _self, pf);
+    VTABLE_set_pointer(interp, attrs->directory, &pf->directory);
+    Parrot_unblock_GC_mark(interp);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 323 "./src/pmc/packfile.c"
+}
+static  void 
+Parrot_Packfile_set_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, STRING *val)
+{
+#line 465 "./src/pmc/packfile.pmc"
+
+    STRING * const s = VTABLE_get_string(interp, key);
+    VTABLE_set_string_keyed_str(interp, _self, s, val);
+#line 332 "./src/pmc/packfile.c"
+}
+static  void 
+Parrot_Packfile_set_string_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key, STRING *value)
+{
+#line 444 "./src/pmc/packfile.pmc"
+
+    if (STRING_equal(interp, key, CONST_STRING(interp, "uuid"))) {
+        PARROT_PACKFILE(_self)->uuid = value;
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return;
+    }
+
+    Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_KEY_NOT_FOUND,
+                   "Packfile: No such string key \"%Ss\"", key);
+#line 347 "./src/pmc/packfile.c"
+}
+static  void 
+Parrot_Packfile_set_string_native(PARROT_INTERP, ARGMOD(PMC *_self), STRING *str)
+{
+#line 202 "./src/pmc/packfile.pmc"
+
+    Parrot_Packfile_attributes * const attrs = PARROT_PACKFILE(_self);
+    PackFile * const pf = Parrot_pf_deserialize(interp, str);
+
+    /* Disable GC during copy data into internal structures. */
+    Parrot_block_GC_mark(interp);
+
+    /* Copy values from PackFile header to own attributes */
+    copy_packfile_header(interp, _self, pf);
+    VTABLE_set_pointer(interp, attrs->directory, &pf->directory);
+    Parrot_unblock_GC_mark(interp);
+
+    /* XXX memory leak
+     * Destroying the packfile here frees segments that may still have live references
+     * (eg: sub->seg)
+     * A memory leak is better than an invalid memory access
+     */
+#if 0
+    PackFile_destroy(interp, pf);
+#endif
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 374 "./src/pmc/packfile.c"
+}
+static  void
+Parrot_Packfile_nci_pack(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 481 "./src/pmc/packfile.pmc"
+
+    STRING * const ret = _self->vtable->get_string(interp, _self);
+    #line 397 "./src/pmc/packfile.c"
+     {
+        VTABLE_set_string_keyed_int(interp, _call_object, 0, (STRING*)ret);
+        
+        return;
+     }
+#line 483 "./src/pmc/packfile.pmc"
+
+#line 405 "./src/pmc/packfile.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Packfile_nci_unpack(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* str;
+    
+    const INTVAL arity = 2; /* "PiS" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    str = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 497 "./src/pmc/packfile.pmc"
+
+    _self->vtable->set_string_native(interp, _self, str);
+#line 437 "./src/pmc/packfile.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Packfile_nci_get_directory(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 511 "./src/pmc/packfile.pmc"
+
+    PMC * const dir = PARROT_PACKFILE(_self)->directory;
+    #line 467 "./src/pmc/packfile.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)dir);
+        
+        return;
+     }
+#line 513 "./src/pmc/packfile.pmc"
+
+#line 475 "./src/pmc/packfile.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Packfile_nci_view(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 528 "./src/pmc/packfile.pmc"
+
+    const Parrot_Packfile_attributes * const attrs = PARROT_PACKFILE(_self);
+    PackFile * const pf =
+            (PackFile*)VTABLE_get_pointer(interp, attrs->directory);
+    PMC * const view = Parrot_pf_get_packfile_pmc(interp, pf, STRINGNULL);
+    #line 508 "./src/pmc/packfile.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)view);
+        
+        return;
+     }
+#line 533 "./src/pmc/packfile.pmc"
+
+#line 516 "./src/pmc/packfile.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_Packfile_update_vtable(VTABLE *vt) {
+    vt->get_integer_keyed = Parrot_Packfile_get_integer_keyed;
+    vt->get_integer_keyed_str = Parrot_Packfile_get_integer_keyed_str;
+    vt->get_string = Parrot_Packfile_get_string;
+    vt->get_string_keyed = Parrot_Packfile_get_string_keyed;
+    vt->get_string_keyed_str = Parrot_Packfile_get_string_keyed_str;
+    vt->init = Parrot_Packfile_init;
+    vt->init_pmc = Parrot_Packfile_init_pmc;
+    vt->mark = Parrot_Packfile_mark;
+    vt->set_integer_keyed = Parrot_Packfile_set_integer_keyed;
+    vt->set_integer_keyed_str = Parrot_Packfile_set_integer_keyed_str;
+    vt->set_pointer = Parrot_Packfile_set_pointer;
+    vt->set_string_keyed = Parrot_Packfile_set_string_keyed;
+    vt->set_string_keyed_str = Parrot_Packfile_set_string_keyed_str;
+    vt->set_string_native = Parrot_Packfile_set_string_native;
+    vt->attr_size = sizeof(Parrot_Packfile_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_Packfile_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->get_integer_keyed = Parrot_Packfile_get_integer_keyed;
+    vt->get_integer_keyed_str = Parrot_Packfile_get_integer_keyed_str;
+    vt->get_string = Parrot_Packfile_get_string;
+    vt->get_string_keyed = Parrot_Packfile_get_string_keyed;
+    vt->get_string_keyed_str = Parrot_Packfile_get_string_keyed_str;
+    vt->mark = Parrot_Packfile_mark;
+    vt->attr_size = sizeof(Parrot_Packfile_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Packfile_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_Packfile_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Packfile_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_Packfile_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_Packfile_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "Packfile"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_Packfile_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "Packfile")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_Packfile_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "Iwordsize Ibyteorder Ifptype Iversion_major Iversion_minor Iversion_patch Ibytecode_major Ibytecode_minor Iuuid_type Suuid Fdirectory ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_Packfile_get_vtable(interp);
+        vt->base_type      = enum_class_Packfile;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "Packfile");
+        vt->provides_str = CONST_STRING_GEN(interp, "scalar");
+        vt->isa_hash     = Parrot_Packfile_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_Packfile_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_Packfile;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_Packfile_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "pack");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Packfile_nci_pack),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "unpack");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Packfile_nci_unpack),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "get_directory");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Packfile_nci_get_directory),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "view");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Packfile_nci_view),
+                method_name, signature);
+        }
+        {
+        }
+    } /* pass */
+} /* Parrot_Packfile_class_init */
+
+#line 535 "./src/pmc/packfile.pmc"
+
+
+
+/*
+
+=back
+
+=cut
+
+=head2 Auxliary functions
+
+=over 4
+
+=item C<static AttrEnumPackfile getAttrEnum(PARROT_INTERP, const STRING *name)>
+
+Gets an enumerated value corresponding to the attribute with that name.
+
+=cut
+
+*/
+
+static AttrEnumPackfile
+getAttrEnum(PARROT_INTERP, ARGIN(const STRING *name))
+{
+    ASSERT_ARGS(getAttrEnum)
+
+    AttrEnumPackfile r;
+    if (STRING_equal(interp, name, CONST_STRING(interp, "wordsize")))
+        r = attr_wordsize;
+    else if (STRING_equal(interp, name, CONST_STRING(interp, "byteorder")))
+        r = attr_byteorder;
+    else if (STRING_equal(interp, name, CONST_STRING(interp, "fptype")))
+        r = attr_fptype;
+    else if (STRING_equal(interp, name, CONST_STRING(interp, "version_major")))
+        r = attr_version_major;
+    else if (STRING_equal(interp, name, CONST_STRING(interp, "version_minor")))
+        r = attr_version_minor;
+    else if (STRING_equal(interp, name, CONST_STRING(interp, "version_patch")))
+        r = attr_version_patch;
+    else if (STRING_equal(interp, name, CONST_STRING(interp, "bytecode_major")))
+        r = attr_bytecode_major;
+    else if (STRING_equal(interp, name, CONST_STRING(interp, "bytecode_minor")))
+        r = attr_bytecode_minor;
+    else if (STRING_equal(interp, name, CONST_STRING(interp, "uuid_type")))
+        r = attr_uuid_type;
+    else
+        r = attr_NONE;
+    return r;
+}
+
+/*
+
+=back
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
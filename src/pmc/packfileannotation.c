@@ -0,0 +1,590 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/packfileannotation.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_fixedintegerarray.h"
+#include "pmc_packfileannotation.h"
+#include "pmc_default.h"
+#include "packfileannotation.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/packfileannotation.pmc"
+/*
+Copyright (C) 2001-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/packfileannotation.pmc - PackfileAnnotation PMC
+
+=head1 DESCRIPTION
+
+This class implements a PackfileAnnotation object.  It is an element in the
+PackfileAnnotations segment of the .pbc file.  See PDD13 for a design spec.
+
+=head2 Methods
+
+=over 4
+
+=cut
+
+*/
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+#line 47 "./src/pmc/packfileannotation.c"
+static  INTVAL  Parrot_PackfileAnnotation_get_integer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING *  Parrot_PackfileAnnotation_get_string(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_PackfileAnnotation_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_PackfileAnnotation_mark(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_PackfileAnnotation_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void  Parrot_PackfileAnnotation_set_string_native(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value);
+static  void Parrot_PackfileAnnotation_nci_get_offset(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_PackfileAnnotation_nci_set_offset(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_PackfileAnnotation_nci_get_name(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_PackfileAnnotation_nci_set_name(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_PackfileAnnotation_nci_get_pmc_value(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_PackfileAnnotation_nci_set_pmc_value(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_PackfileAnnotation_nci_get_type(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_PackfileAnnotation_class_init(PARROT_INTERP, int, int);
+void    Parrot_PackfileAnnotation_ro_class_init(PARROT_INTERP, int, int);
+static  INTVAL 
+Parrot_PackfileAnnotation_get_integer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 216 "./src/pmc/packfileannotation.pmc"
+
+    const Parrot_PackfileAnnotation_attributes * const attrs = PARROT_PACKFILEANNOTATION(_self);
+    if (attrs->value_type != PF_ANNOTATION_KEY_TYPE_INT)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "Wrong type of value from annotation");
+    return attrs->int_value;
+#line 73 "./src/pmc/packfileannotation.c"
+}
+static  STRING * 
+Parrot_PackfileAnnotation_get_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 249 "./src/pmc/packfileannotation.pmc"
+
+    Parrot_PackfileAnnotation_attributes * const attrs = PARROT_PACKFILEANNOTATION(_self);
+    if (attrs->value_type != PF_ANNOTATION_KEY_TYPE_STR)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "Wrong type of value from annotation");
+    return attrs->str_value;
+#line 85 "./src/pmc/packfileannotation.c"
+}
+static  void 
+Parrot_PackfileAnnotation_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 44 "./src/pmc/packfileannotation.pmc"
+
+    Parrot_PackfileAnnotation_attributes * const attrs =
+            PMC_data_typed(_self, Parrot_PackfileAnnotation_attributes*);
+
+    PObj_custom_mark_SET(_self);
+    PMC_data(_self) = attrs;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 98 "./src/pmc/packfileannotation.c"
+}
+static  void 
+Parrot_PackfileAnnotation_mark(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 62 "./src/pmc/packfileannotation.pmc"
+
+    const Parrot_PackfileAnnotation_attributes * const attrs =
+            PARROT_PACKFILEANNOTATION(_self);
+
+    Parrot_gc_mark_STRING_alive(interp, attrs->name);
+    Parrot_gc_mark_STRING_alive(interp, attrs->str_value);
+#line 110 "./src/pmc/packfileannotation.c"
+}
+static  void 
+Parrot_PackfileAnnotation_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+#line 234 "./src/pmc/packfileannotation.pmc"
+
+    Parrot_PackfileAnnotation_attributes * const attrs = PARROT_PACKFILEANNOTATION(_self);
+    attrs->value_type = PF_ANNOTATION_KEY_TYPE_INT;
+    attrs->int_value  = value;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 121 "./src/pmc/packfileannotation.c"
+}
+static  void 
+Parrot_PackfileAnnotation_set_string_native(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value)
+{
+#line 267 "./src/pmc/packfileannotation.pmc"
+
+    Parrot_PackfileAnnotation_attributes * const attrs = PARROT_PACKFILEANNOTATION(_self);
+    attrs->value_type = PF_ANNOTATION_KEY_TYPE_STR;
+    attrs->str_value  = value;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 132 "./src/pmc/packfileannotation.c"
+}
+static  void
+Parrot_PackfileAnnotation_nci_get_offset(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 80 "./src/pmc/packfileannotation.pmc"
+
+    const INTVAL offset = PARROT_PACKFILEANNOTATION(_self)->offset;
+    #line 155 "./src/pmc/packfileannotation.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)offset);
+        
+        return;
+     }
+#line 82 "./src/pmc/packfileannotation.pmc"
+
+#line 163 "./src/pmc/packfileannotation.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_PackfileAnnotation_nci_set_offset(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    INTVAL offset;
+    
+    const INTVAL arity = 2; /* "PiI" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    offset = VTABLE_get_integer_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 95 "./src/pmc/packfileannotation.pmc"
+
+    PARROT_PACKFILEANNOTATION(_self)->offset = offset;
+#line 195 "./src/pmc/packfileannotation.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_PackfileAnnotation_nci_get_name(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 109 "./src/pmc/packfileannotation.pmc"
+
+    STRING * const name = PARROT_PACKFILEANNOTATION(_self)->name;
+    #line 225 "./src/pmc/packfileannotation.c"
+     {
+        VTABLE_set_string_keyed_int(interp, _call_object, 0, (STRING*)name);
+        
+        return;
+     }
+#line 111 "./src/pmc/packfileannotation.pmc"
+
+#line 233 "./src/pmc/packfileannotation.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_PackfileAnnotation_nci_set_name(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* name;
+    
+    const INTVAL arity = 2; /* "PiS" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    name = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 124 "./src/pmc/packfileannotation.pmc"
+
+    PARROT_PACKFILEANNOTATION(_self)->name = name;
+#line 265 "./src/pmc/packfileannotation.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_PackfileAnnotation_nci_get_pmc_value(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 138 "./src/pmc/packfileannotation.pmc"
+
+    const Parrot_PackfileAnnotation_attributes * const attrs = PARROT_PACKFILEANNOTATION(_self);
+    if (attrs->value_type != PF_ANNOTATION_KEY_TYPE_PMC)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "Wrong type of value from annotation");
+    #line 298 "./src/pmc/packfileannotation.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)attrs->pmc_value);
+        
+        return;
+     }
+#line 143 "./src/pmc/packfileannotation.pmc"
+
+#line 306 "./src/pmc/packfileannotation.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_PackfileAnnotation_nci_set_pmc_value(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* value;
+    
+    const INTVAL arity = 2; /* "PiP" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    value = VTABLE_get_pmc_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 156 "./src/pmc/packfileannotation.pmc"
+
+    Parrot_PackfileAnnotation_attributes * const attrs = PARROT_PACKFILEANNOTATION(_self);
+    attrs->value_type = PF_ANNOTATION_KEY_TYPE_PMC;
+    attrs->pmc_value  = value;
+#line 340 "./src/pmc/packfileannotation.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_PackfileAnnotation_nci_get_type(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 182 "./src/pmc/packfileannotation.pmc"
+
+    /* These values were chosen to match the type values for opcodes */
+    Parrot_PackfileAnnotation_attributes * const attrs = PARROT_PACKFILEANNOTATION(_self);
+    INTVAL ret;
+
+    switch (attrs->value_type) {
+      case PF_ANNOTATION_KEY_TYPE_INT:
+        ret = 0;
+        break;
+      case PF_ANNOTATION_KEY_TYPE_STR:
+        ret = 1;
+        break;
+      case PF_ANNOTATION_KEY_TYPE_PMC:
+        ret = 2;
+        break;
+      default:
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "Wrong type of value from annotation");
+        break;
+    }
+
+    #line 389 "./src/pmc/packfileannotation.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)ret);
+        
+        return;
+     }
+#line 203 "./src/pmc/packfileannotation.pmc"
+
+#line 397 "./src/pmc/packfileannotation.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_PackfileAnnotation_update_vtable(VTABLE *vt) {
+    vt->get_integer = Parrot_PackfileAnnotation_get_integer;
+    vt->get_string = Parrot_PackfileAnnotation_get_string;
+    vt->init = Parrot_PackfileAnnotation_init;
+    vt->mark = Parrot_PackfileAnnotation_mark;
+    vt->set_integer_native = Parrot_PackfileAnnotation_set_integer_native;
+    vt->set_string_native = Parrot_PackfileAnnotation_set_string_native;
+    vt->attr_size = sizeof(Parrot_PackfileAnnotation_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_PackfileAnnotation_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->get_integer = Parrot_PackfileAnnotation_get_integer;
+    vt->get_string = Parrot_PackfileAnnotation_get_string;
+    vt->mark = Parrot_PackfileAnnotation_mark;
+    vt->attr_size = sizeof(Parrot_PackfileAnnotation_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_PackfileAnnotation_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_PackfileAnnotation_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_PackfileAnnotation_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_PackfileAnnotation_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_PackfileAnnotation_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "PackfileAnnotation"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_PackfileAnnotation_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "PackfileAnnotation")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_PackfileAnnotation_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "Sname Ioffset Ivalue_type Iint_value Sstr_value Fpmc_value ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_PackfileAnnotation_get_vtable(interp);
+        vt->base_type      = enum_class_PackfileAnnotation;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "PackfileAnnotation");
+        vt->provides_str = CONST_STRING_GEN(interp, "scalar");
+        vt->isa_hash     = Parrot_PackfileAnnotation_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_PackfileAnnotation_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_PackfileAnnotation;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_PackfileAnnotation_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "get_offset");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_PackfileAnnotation_nci_get_offset),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "set_offset");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_PackfileAnnotation_nci_set_offset),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "get_name");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_PackfileAnnotation_nci_get_name),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "set_name");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_PackfileAnnotation_nci_set_name),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "get_pmc_value");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_PackfileAnnotation_nci_get_pmc_value),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "set_pmc_value");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_PackfileAnnotation_nci_set_pmc_value),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "get_type");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_PackfileAnnotation_nci_get_type),
+                method_name, signature);
+        }
+        {
+        }
+    } /* pass */
+} /* Parrot_PackfileAnnotation_class_init */
+
+#line 271 "./src/pmc/packfileannotation.pmc"
+
+
+/*
+
+=back
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
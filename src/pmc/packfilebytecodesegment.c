@@ -0,0 +1,433 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/packfilebytecodesegment.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_fixedintegerarray.h"
+#include "pmc_packfilebytecodesegment.h"
+#include "pmc_packfilerawsegment.h"
+#include "pmc_packfilesegment.h"
+#include "pmc_default.h"
+#include "packfilebytecodesegment.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/packfilebytecodesegment.pmc"
+/*
+Copyright (C) 2001-2014, Parrot Foundation.
+
+
+=head1 NAME
+
+src/pmc/packfilebytecodesegment.pmc - PackfileBytecodeSegment PMC
+
+=head1 DESCRIPTION
+
+This class implements a PackfileBytecode class, providing a PMC-based interface
+for bytecode creation and manipulation.
+
+See packfile.pmc for the toplevel Packfile interface; see PDD13 for the design
+spec.
+
+=head2 Methods
+
+=over 4
+
+=cut
+
+*/
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+
+#include "pmc/pmc_packfileopmap.h"
+#line 55 "./src/pmc/packfilebytecodesegment.c"
+static  void  * Parrot_PackfileBytecodeSegment_get_pointer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_PackfileBytecodeSegment_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_PackfileBytecodeSegment_mark(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_PackfileBytecodeSegment_push_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *p);
+static  void  Parrot_PackfileBytecodeSegment_set_pointer(PARROT_INTERP, ARGMOD(PMC *_self), void *pointer);
+static  void Parrot_PackfileBytecodeSegment_nci_main_sub(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_PackfileBytecodeSegment_nci_opmap(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_PackfileBytecodeSegment_class_init(PARROT_INTERP, int, int);
+void    Parrot_PackfileBytecodeSegment_ro_class_init(PARROT_INTERP, int, int);
+static  void  *
+Parrot_PackfileBytecodeSegment_get_pointer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 86 "./src/pmc/packfilebytecodesegment.pmc"
+
+    INTVAL op_count;
+    size_t i;
+
+    PMC    *ops, *op_map;
+
+    PackFile_ByteCode_OpMapping * mapping;
+
+    /* ByteCode to return */
+    PackFile_ByteCode * const bc = mem_gc_allocate_zeroed_typed(interp, PackFile_ByteCode);
+    bc->base.type = PF_BYTEC_SEG;
+
+    /* Create proper ByteCode structure from internal PMCs */
+    GETATTR_PackfileBytecodeSegment_main_sub(interp, _self, bc->main_sub);
+
+    /* Copy ops into ByteCode */
+    GETATTR_PackfileBytecodeSegment_opcodes(interp, _self, ops);
+    bc->base.size = VTABLE_get_integer(interp, ops);
+    bc->base.data = mem_gc_allocate_n_typed(interp, bc->base.size, opcode_t);
+
+    /* Not very efficient... */
+    for (i = 0; i < bc->base.size; ++i) {
+        bc->base.data[i] = VTABLE_get_integer_keyed_int(interp, ops, i);
+    }
+
+    /* Create various dynop mapping related structures */
+    GETATTR_PackfileBytecodeSegment_op_map(interp, _self, op_map);
+    op_count = VTABLE_get_integer(interp, op_map);
+
+    bc->op_count = op_count;
+    bc->op_func_table = mem_gc_allocate_n_zeroed_typed(interp, op_count, op_func_t);
+    /* TODO Fill it */
+
+    bc->op_info_table = mem_gc_allocate_n_zeroed_typed(interp, op_count, op_info_t*);
+    /* TODO Fill it */
+
+    /* Construct mappings */
+    mapping = (PackFile_ByteCode_OpMapping *)VTABLE_get_pointer(interp, op_map);
+    memcpy(&bc->op_mapping, mapping, sizeof (PackFile_ByteCode_OpMapping));
+    /* Don't free "mapping". Caller will do it */
+
+    return bc;
+#line 111 "./src/pmc/packfilebytecodesegment.c"
+}
+static  void 
+Parrot_PackfileBytecodeSegment_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 46 "./src/pmc/packfilebytecodesegment.pmc"
+
+    Parrot_PackfileBytecodeSegment_attributes * const attrs =
+            PARROT_PACKFILEBYTECODESEGMENT(_self);
+
+    PObj_custom_mark_SET(_self);
+
+    attrs->op_map = Parrot_pmc_new(interp, enum_class_PackfileOpMap);
+
+    interp->vtables[enum_class_PackfileRawSegment]->init(interp, _self);
+#line 126 "./src/pmc/packfilebytecodesegment.c"
+}
+static  void 
+Parrot_PackfileBytecodeSegment_mark(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 67 "./src/pmc/packfilebytecodesegment.pmc"
+
+    PMC *tmp;
+
+    GETATTR_PackfileBytecodeSegment_op_map(interp, _self, tmp);
+    Parrot_gc_mark_PMC_alive(interp, tmp);
+
+    interp->vtables[enum_class_PackfileRawSegment]->mark(interp, _self);
+#line 139 "./src/pmc/packfilebytecodesegment.c"
+}
+static  void 
+Parrot_PackfileBytecodeSegment_push_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *p)
+{
+#line 176 "./src/pmc/packfilebytecodesegment.pmc"
+
+
+    const Parrot_PackfileBytecodeSegment_attributes * const attrs =
+        PMC_data_typed(_self, Parrot_PackfileBytecodeSegment_attributes*);
+
+    INTVAL  i, op_num, arr_size;
+
+    if (!VTABLE_does(interp, p, CONST_STRING(interp, "array"))) {
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+                "PMC passed to push_pmc is not array-like");
+    }
+
+    op_num = VTABLE_get_integer_keyed_str(interp, attrs->op_map,
+             VTABLE_get_string_keyed_int(interp, p, 0));
+
+    /* add the things to attrs->ops */
+    VTABLE_push_integer(interp, attrs->opcodes, op_num);
+    arr_size = VTABLE_elements(interp, p);
+
+    for (i = 1; i < arr_size; i++){
+        VTABLE_push_integer(interp, attrs->opcodes,
+                VTABLE_get_integer_keyed_int(interp, p, i));
+    }
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 169 "./src/pmc/packfilebytecodesegment.c"
+}
+static  void 
+Parrot_PackfileBytecodeSegment_set_pointer(PARROT_INTERP, ARGMOD(PMC *_self), void *pointer)
+{
+#line 139 "./src/pmc/packfilebytecodesegment.pmc"
+
+    const PackFile_ByteCode * const pfseg =
+            (const PackFile_ByteCode *)pointer;
+    opcode_t i, j;
+    PMC     *op_map;
+
+    GETATTR_PackfileBytecodeSegment_op_map(interp, _self, op_map);
+
+    /* Recreate OpMapping */
+    for (i = 0; i < pfseg->op_mapping.n_libs; i++) {
+        PackFile_ByteCode_OpMappingEntry entry = pfseg->op_mapping.libs[i];
+        for (j = 0; j < entry.n_ops; j++) {
+            opcode_t lib_op = entry.lib_ops[j];
+            VTABLE_get_integer_keyed_str(interp, op_map,
+                Parrot_str_from_platform_cstring(interp,
+                                                 entry.lib->op_info_table[lib_op].full_name));
+        }
+    }
+
+    /* TODO. Figure out how to generate OpLibs and where to store them */
+
+    interp->vtables[enum_class_PackfileRawSegment]->set_pointer(interp, _self, pointer);
+#line 197 "./src/pmc/packfilebytecodesegment.c"
+}
+static  void
+Parrot_PackfileBytecodeSegment_nci_main_sub(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    INTVAL main_sub;
+    INTVAL got_main;
+    
+    const INTVAL arity = 1; /* "PiIoIp" */
+    const INTVAL arity_opt  = 1;
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count < arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too few arguments: %d passed, %d expected",
+                                    param_count, arity);
+    if (param_count > arity + arity_opt)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too many arguments: %d passed, %d expected",
+                                    param_count, arity + arity_opt);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    if (param_count > 1) {
+        main_sub = VTABLE_get_integer_keyed_int(interp, _call_object, 1);
+        got_main = 1;
+    }
+    else {
+        main_sub = 0;
+        got_main = 0;
+    }
+
+    { /* BEGIN PMETHOD BODY */
+#line 212 "./src/pmc/packfilebytecodesegment.pmc"
+
+    if (got_main) {
+        SETATTR_PackfileBytecodeSegment_main_sub(interp, _self, main_sub);
+    }
+    GETATTR_PackfileBytecodeSegment_main_sub(interp, _self, main_sub);
+    #line 239 "./src/pmc/packfilebytecodesegment.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)main_sub);
+        
+        return;
+     }
+#line 217 "./src/pmc/packfilebytecodesegment.pmc"
+
+#line 247 "./src/pmc/packfilebytecodesegment.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_PackfileBytecodeSegment_nci_opmap(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 230 "./src/pmc/packfilebytecodesegment.pmc"
+
+    PMC *op_map;
+    GETATTR_PackfileBytecodeSegment_op_map(interp, _self, op_map);
+    #line 278 "./src/pmc/packfilebytecodesegment.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)op_map);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return;
+     }
+#line 233 "./src/pmc/packfilebytecodesegment.pmc"
+
+#line 286 "./src/pmc/packfilebytecodesegment.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_PackfileBytecodeSegment_update_vtable(VTABLE *vt) {
+    vt->get_pointer = Parrot_PackfileBytecodeSegment_get_pointer;
+    vt->init = Parrot_PackfileBytecodeSegment_init;
+    vt->mark = Parrot_PackfileBytecodeSegment_mark;
+    vt->push_pmc = Parrot_PackfileBytecodeSegment_push_pmc;
+    vt->set_pointer = Parrot_PackfileBytecodeSegment_set_pointer;
+    vt->attr_size = sizeof(Parrot_PackfileBytecodeSegment_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_PackfileBytecodeSegment_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->get_pointer = Parrot_PackfileBytecodeSegment_get_pointer;
+    vt->mark = Parrot_PackfileBytecodeSegment_mark;
+    vt->attr_size = sizeof(Parrot_PackfileBytecodeSegment_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_PackfileBytecodeSegment_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_PackfileRawSegment_get_vtable(interp);
+    Parrot_PackfileBytecodeSegment_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_PackfileBytecodeSegment_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_PackfileRawSegment_ro_get_vtable(interp);
+    Parrot_PackfileBytecodeSegment_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_PackfileBytecodeSegment_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+    mro = Parrot_PackfileRawSegment_get_mro(interp, mro);
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "PackfileBytecodeSegment"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_PackfileBytecodeSegment_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    isa = Parrot_PackfileRawSegment_get_isa(interp, isa);
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "PackfileBytecodeSegment")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_PackfileBytecodeSegment_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "Fdirectory Itype Fopcodes Fop_map Imain_sub ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_PackfileBytecodeSegment_get_vtable(interp);
+        vt->base_type      = enum_class_PackfileBytecodeSegment;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "PackfileBytecodeSegment");
+        vt->provides_str = CONST_STRING_GEN(interp, "scalar");
+        vt->isa_hash     = Parrot_PackfileBytecodeSegment_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_PackfileBytecodeSegment_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_PackfileBytecodeSegment;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_PackfileBytecodeSegment_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "main_sub");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_PackfileBytecodeSegment_nci_main_sub),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "opmap");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_PackfileBytecodeSegment_nci_opmap),
+                method_name, signature);
+        }
+        {
+        }
+    } /* pass */
+} /* Parrot_PackfileBytecodeSegment_class_init */
+
+#line 243 "./src/pmc/packfilebytecodesegment.pmc"
+
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
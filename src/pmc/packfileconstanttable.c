@@ -0,0 +1,816 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/packfileconstanttable.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_fixedintegerarray.h"
+#include "pmc_packfileconstanttable.h"
+#include "pmc_packfilesegment.h"
+#include "pmc_default.h"
+#include "packfileconstanttable.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/packfileconstanttable.pmc"
+/*
+Copyright (C) 2001-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/packfileconstanttable.pmc - PackfileConstantTable PMC
+
+=head1 DESCRIPTION
+
+This class implements a PackfileConstantTable object, a segment of the .pbc
+data file used for storing constants of various types.  (int, string, PMC)
+
+See packfile.pmc for the toplevel Packfile interface, see packfilesegment.pmc
+for the list of common methods every packfile segment pmc must implement; see
+PDD13 for the design spec.
+
+
+=head2 Methods
+
+=over 4
+
+=cut
+
+*/
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+#line 53 "./src/pmc/packfileconstanttable.c"
+static  FLOATVAL  Parrot_PackfileConstantTable_get_number_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL index);
+static  PMC  * Parrot_PackfileConstantTable_get_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL index);
+static  void  * Parrot_PackfileConstantTable_get_pointer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING  * Parrot_PackfileConstantTable_get_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL index);
+static  void  Parrot_PackfileConstantTable_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_PackfileConstantTable_mark(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_PackfileConstantTable_push_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL val);
+static  void  Parrot_PackfileConstantTable_push_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *val);
+static  void  Parrot_PackfileConstantTable_push_string(PARROT_INTERP, ARGMOD(PMC *_self), STRING *val);
+static  void  Parrot_PackfileConstantTable_set_number_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL index, FLOATVAL value);
+static  void  Parrot_PackfileConstantTable_set_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL index, PMC *value);
+static  void  Parrot_PackfileConstantTable_set_pointer(PARROT_INTERP, ARGMOD(PMC *_self), void *pointer);
+static  void  Parrot_PackfileConstantTable_set_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL index, STRING *value);
+static  void Parrot_PackfileConstantTable_nci_num_count(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_PackfileConstantTable_nci_str_count(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_PackfileConstantTable_nci_pmc_count(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_PackfileConstantTable_nci_set_main(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_PackfileConstantTable_multi_get_or_create_constant_STRING(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value);
+static  INTVAL  Parrot_PackfileConstantTable_multi_get_or_create_constant_FLOATVAL(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value);
+static  INTVAL  Parrot_PackfileConstantTable_multi_get_or_create_constant_PMC(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void Parrot_PackfileConstantTable_nci_type(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_PackfileConstantTable_nci_add_tag_mapping(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_PackfileConstantTable_multi_get_or_create_constant_STRING_pcc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_PackfileConstantTable_multi_get_or_create_constant_FLOATVAL_pcc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_PackfileConstantTable_multi_get_or_create_constant_PMC_pcc(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_PackfileConstantTable_class_init(PARROT_INTERP, int, int);
+void    Parrot_PackfileConstantTable_ro_class_init(PARROT_INTERP, int, int);
+static  FLOATVAL 
+Parrot_PackfileConstantTable_get_number_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL index)
+{
+#line 214 "./src/pmc/packfileconstanttable.pmc"
+
+    return VTABLE_get_number_keyed_int(interp,
+            PARROT_PACKFILECONSTANTTABLE(_self)->num_constants, index);
+#line 88 "./src/pmc/packfileconstanttable.c"
+}
+static  PMC  *
+Parrot_PackfileConstantTable_get_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL index)
+{
+#line 244 "./src/pmc/packfileconstanttable.pmc"
+
+    return VTABLE_get_pmc_keyed_int(interp,
+            PARROT_PACKFILECONSTANTTABLE(_self)->pmc_constants, index);
+#line 97 "./src/pmc/packfileconstanttable.c"
+}
+static  void  *
+Parrot_PackfileConstantTable_get_pointer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 129 "./src/pmc/packfileconstanttable.pmc"
+
+    Parrot_PackfileConstantTable_attributes * const attrs =
+            PARROT_PACKFILECONSTANTTABLE(_self);
+    PackFile_ConstTable * const pftable =
+            mem_gc_allocate_zeroed_typed(interp, PackFile_ConstTable);
+    opcode_t              i;
+    const int tag_elts = VTABLE_elements(interp, attrs->tag_map);
+
+    pftable->base.type = PF_CONST_SEG;
+
+    /* Copy all constanst with respect of type */
+    pftable->num.const_count = VTABLE_get_integer(interp, attrs->num_constants);
+    pftable->str.const_count = VTABLE_get_integer(interp, attrs->str_constants);
+    pftable->pmc.const_count = VTABLE_get_integer(interp, attrs->pmc_constants);
+
+    pftable->num.constants   = mem_gc_allocate_n_typed(interp,
+                                pftable->num.const_count, FLOATVAL);
+    pftable->str.constants   = mem_gc_allocate_n_typed(interp,
+                                pftable->str.const_count, STRING *);
+    pftable->pmc.constants   = mem_gc_allocate_n_typed(interp,
+                                pftable->pmc.const_count, PMC *);
+
+    for (i = 0; i < pftable->num.const_count; i++)
+        pftable->num.constants[i] =
+            VTABLE_get_number_keyed_int(interp, attrs->num_constants, i);
+
+    for (i = 0; i < pftable->str.const_count; i++)
+        pftable->str.constants[i] =
+            VTABLE_get_string_keyed_int(interp, attrs->str_constants, i);
+
+    for (i = 0; i < pftable->pmc.const_count; i++)
+        pftable->pmc.constants[i] =
+            VTABLE_get_pmc_keyed_int(interp, attrs->pmc_constants, i);
+
+    for (i = 0; i < tag_elts; i += 2) {
+        Parrot_pf_tag_constant(interp, pftable,
+            VTABLE_get_integer_keyed_int(interp, attrs->tag_map, i),
+            VTABLE_get_integer_keyed_int(interp, attrs->tag_map, i + 1));
+    }
+
+    return pftable;
+#line 144 "./src/pmc/packfileconstanttable.c"
+}
+static  STRING  *
+Parrot_PackfileConstantTable_get_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL index)
+{
+#line 229 "./src/pmc/packfileconstanttable.pmc"
+
+    return VTABLE_get_string_keyed_int(interp,
+            PARROT_PACKFILECONSTANTTABLE(_self)->str_constants, index);
+#line 153 "./src/pmc/packfileconstanttable.c"
+}
+static  void 
+Parrot_PackfileConstantTable_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 47 "./src/pmc/packfileconstanttable.pmc"
+
+    Parrot_PackfileConstantTable_attributes * const attrs =
+            PMC_data_typed(_self, Parrot_PackfileConstantTable_attributes*);
+
+    attrs->num_constants = Parrot_pmc_new(interp, enum_class_ResizableFloatArray);
+    attrs->str_constants = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    attrs->pmc_constants = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+    attrs->tag_map = Parrot_pmc_new(interp, enum_class_ResizableIntegerArray);
+
+    PObj_custom_mark_SET(_self);
+    PMC_data(_self) = attrs;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 171 "./src/pmc/packfileconstanttable.c"
+}
+static  void 
+Parrot_PackfileConstantTable_mark(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 70 "./src/pmc/packfileconstanttable.pmc"
+
+    Parrot_PackfileConstantTable_attributes * const attrs =
+            PARROT_PACKFILECONSTANTTABLE(_self);
+
+    Parrot_gc_mark_PMC_alive(interp, attrs->num_constants);
+    Parrot_gc_mark_PMC_alive(interp, attrs->str_constants);
+    Parrot_gc_mark_PMC_alive(interp, attrs->pmc_constants);
+    Parrot_gc_mark_PMC_alive(interp, attrs->tag_map);
+
+    interp->vtables[enum_class_PackfileSegment]->mark(interp, _self);
+#line 187 "./src/pmc/packfileconstanttable.c"
+}
+static  void 
+Parrot_PackfileConstantTable_push_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL val)
+{
+#line 299 "./src/pmc/packfileconstanttable.pmc"
+
+    Parrot_PackfileConstantTable_attributes * const attrs =
+            PARROT_PACKFILECONSTANTTABLE(_self);
+    VTABLE_set_number_keyed_int(interp, _self,
+            VTABLE_get_integer(interp, attrs->num_constants),
+            val);
+#line 199 "./src/pmc/packfileconstanttable.c"
+}
+static  void 
+Parrot_PackfileConstantTable_push_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *val)
+{
+#line 315 "./src/pmc/packfileconstanttable.pmc"
+
+    Parrot_PackfileConstantTable_attributes * const attrs =
+            PARROT_PACKFILECONSTANTTABLE(_self);
+    VTABLE_set_pmc_keyed_int(interp, _self,
+            VTABLE_get_integer(interp, attrs->pmc_constants),
+            val);
+#line 211 "./src/pmc/packfileconstanttable.c"
+}
+static  void 
+Parrot_PackfileConstantTable_push_string(PARROT_INTERP, ARGMOD(PMC *_self), STRING *val)
+{
+#line 307 "./src/pmc/packfileconstanttable.pmc"
+
+    Parrot_PackfileConstantTable_attributes * const attrs =
+            PARROT_PACKFILECONSTANTTABLE(_self);
+    VTABLE_set_string_keyed_int(interp, _self,
+            VTABLE_get_integer(interp, attrs->str_constants),
+            val);
+#line 223 "./src/pmc/packfileconstanttable.c"
+}
+static  void 
+Parrot_PackfileConstantTable_set_number_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL index, FLOATVAL value)
+{
+#line 259 "./src/pmc/packfileconstanttable.pmc"
+
+    Parrot_PackfileConstantTable_attributes * const attrs =
+            PARROT_PACKFILECONSTANTTABLE(_self);
+    VTABLE_set_number_keyed_int(interp, attrs->num_constants, index, value);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 234 "./src/pmc/packfileconstanttable.c"
+}
+static  void 
+Parrot_PackfileConstantTable_set_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL index, PMC *value)
+{
+#line 292 "./src/pmc/packfileconstanttable.pmc"
+
+    Parrot_PackfileConstantTable_attributes * const attrs =
+            PARROT_PACKFILECONSTANTTABLE(_self);
+    VTABLE_set_pmc_keyed_int(interp, attrs->pmc_constants,  index, value);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 245 "./src/pmc/packfileconstanttable.c"
+}
+static  void 
+Parrot_PackfileConstantTable_set_pointer(PARROT_INTERP, ARGMOD(PMC *_self), void *pointer)
+{
+#line 93 "./src/pmc/packfileconstanttable.pmc"
+
+    Parrot_PackfileConstantTable_attributes * const attrs =
+            PARROT_PACKFILECONSTANTTABLE(_self);
+    const PackFile_ConstTable * const table =
+            (const PackFile_ConstTable *)(pointer);
+    opcode_t i;
+
+    /* Preallocate required amount of memory */
+    VTABLE_set_integer_native(interp, attrs->num_constants, table->num.const_count);
+    VTABLE_set_integer_native(interp, attrs->str_constants, table->str.const_count);
+    VTABLE_set_integer_native(interp, attrs->pmc_constants, table->pmc.const_count);
+    VTABLE_set_integer_native(interp, attrs->tag_map, table->ntags * 2);
+
+    for (i = 0; i < table->num.const_count; i++)
+        VTABLE_set_number_keyed_int(interp, _self, i, table->num.constants[i]);
+
+    for (i = 0; i < table->str.const_count; i++)
+        VTABLE_set_string_keyed_int(interp, _self, i, table->str.constants[i]);
+
+    for (i = 0; i < table->pmc.const_count; i++)
+        VTABLE_set_pmc_keyed_int(interp, _self, i, table->pmc.constants[i]);
+
+    for (i = 0; i < table->ntags; i++) {
+        const INTVAL ptr = i * 2;
+        VTABLE_set_integer_keyed_int(interp, attrs->tag_map, ptr, table->tag_map[i].tag_idx);
+        VTABLE_set_integer_keyed_int(interp, attrs->tag_map, ptr, table->tag_map[i].const_idx);
+    }
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 279 "./src/pmc/packfileconstanttable.c"
+}
+static  void 
+Parrot_PackfileConstantTable_set_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL index, STRING *value)
+{
+#line 276 "./src/pmc/packfileconstanttable.pmc"
+
+    Parrot_PackfileConstantTable_attributes * const attrs =
+            PARROT_PACKFILECONSTANTTABLE(_self);
+    VTABLE_set_string_keyed_int(interp, attrs->str_constants, index, value);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 290 "./src/pmc/packfileconstanttable.c"
+}
+static  void
+Parrot_PackfileConstantTable_nci_num_count(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 186 "./src/pmc/packfileconstanttable.pmc"
+
+    const INTVAL ret = VTABLE_elements(interp,
+            PARROT_PACKFILECONSTANTTABLE(_self)->num_constants);
+    #line 314 "./src/pmc/packfileconstanttable.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)ret);
+        
+        return;
+     }
+#line 189 "./src/pmc/packfileconstanttable.pmc"
+
+#line 322 "./src/pmc/packfileconstanttable.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_PackfileConstantTable_nci_str_count(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 192 "./src/pmc/packfileconstanttable.pmc"
+
+    const INTVAL ret = VTABLE_elements(interp,
+            PARROT_PACKFILECONSTANTTABLE(_self)->str_constants);
+    #line 353 "./src/pmc/packfileconstanttable.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)ret);
+        
+        return;
+     }
+#line 195 "./src/pmc/packfileconstanttable.pmc"
+
+#line 361 "./src/pmc/packfileconstanttable.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_PackfileConstantTable_nci_pmc_count(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 198 "./src/pmc/packfileconstanttable.pmc"
+
+    const INTVAL ret = VTABLE_elements(interp,
+            PARROT_PACKFILECONSTANTTABLE(_self)->pmc_constants);
+    #line 392 "./src/pmc/packfileconstanttable.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)ret);
+        
+        return;
+     }
+#line 201 "./src/pmc/packfileconstanttable.pmc"
+
+#line 400 "./src/pmc/packfileconstanttable.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_PackfileConstantTable_nci_set_main(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    INTVAL index;
+    
+    const INTVAL arity = 2; /* "PiI" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    index = VTABLE_get_integer_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 337 "./src/pmc/packfileconstanttable.pmc"
+
+    PMC * const mainsub = _self->vtable->get_pmc_keyed_int(interp, _self, index);
+    if (mainsub->vtable->base_type != enum_class_Sub)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+            EXCEPTION_INVALID_OPERATION,
+            "Attempt to set main flag in a non Sub");
+    SUB_FLAG_flag_SET(PF_MAIN, mainsub);
+#line 437 "./src/pmc/packfileconstanttable.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  INTVAL 
+Parrot_PackfileConstantTable_multi_get_or_create_constant_STRING(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value)
+{
+#line 355 "./src/pmc/packfileconstanttable.pmc"
+
+    Parrot_PackfileConstantTable_attributes * const attrs =
+            PARROT_PACKFILECONSTANTTABLE(_self);
+    const INTVAL num = VTABLE_elements(interp, attrs->str_constants);
+    INTVAL  i;
+
+    for (i=0; i < num; ++i) {
+        STRING * const str = VTABLE_get_string_keyed_int(interp, attrs->str_constants, i);
+        if (STRING_equal(interp, value, str))
+            return i;
+    }
+
+    /* Constant not found. Add new one */
+    _self->vtable->set_string_keyed_int(interp, _self, i, value);
+    return i;
+#line 465 "./src/pmc/packfileconstanttable.c"
+}
+static  INTVAL 
+Parrot_PackfileConstantTable_multi_get_or_create_constant_FLOATVAL(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value)
+{
+#line 372 "./src/pmc/packfileconstanttable.pmc"
+
+    Parrot_PackfileConstantTable_attributes * const attrs =
+            PARROT_PACKFILECONSTANTTABLE(_self);
+    const INTVAL num = VTABLE_elements(interp, attrs->num_constants);
+    INTVAL   i;
+
+    for (i=0; i < num; ++i) {
+        const FLOATVAL val = VTABLE_get_number_keyed_int(interp, attrs->num_constants, i);
+        if (FLOAT_IS_ZERO(fabs(val - value)))
+            return i;
+    }
+
+    /* Constant not found. Add new one */
+    _self->vtable->set_number_keyed_int(interp, _self, i, value);
+    return i;
+#line 486 "./src/pmc/packfileconstanttable.c"
+}
+static  INTVAL 
+Parrot_PackfileConstantTable_multi_get_or_create_constant_PMC(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 389 "./src/pmc/packfileconstanttable.pmc"
+
+    Parrot_PackfileConstantTable_attributes * const attrs =
+            PARROT_PACKFILECONSTANTTABLE(_self);
+    const INTVAL   num = VTABLE_elements(interp, attrs->pmc_constants);
+    INTVAL   i;
+
+    for (i=0; i < num; ++i) {
+        PMC * const val = VTABLE_get_pmc_keyed_int(interp, attrs->pmc_constants, i);
+        if (VTABLE_is_equal(interp, value, val))
+            return i;
+    }
+
+    /* Constant not found. Add new one */
+    _self->vtable->set_pmc_keyed_int(interp, _self, i, value);
+    return i;
+#line 507 "./src/pmc/packfileconstanttable.c"
+}
+static  void
+Parrot_PackfileConstantTable_nci_type(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 416 "./src/pmc/packfileconstanttable.pmc"
+
+    #line 529 "./src/pmc/packfileconstanttable.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)PF_CONST_SEG);
+        
+        return;
+     }
+#line 417 "./src/pmc/packfileconstanttable.pmc"
+
+#line 537 "./src/pmc/packfileconstanttable.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_PackfileConstantTable_nci_add_tag_mapping(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    INTVAL pmc_idx;
+    INTVAL str_idx;
+    
+    const INTVAL arity = 3; /* "PiII" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    pmc_idx = VTABLE_get_integer_keyed_int(interp, _call_object, 1);
+    str_idx = VTABLE_get_integer_keyed_int(interp, _call_object, 2);
+
+    { /* BEGIN PMETHOD BODY */
+#line 428 "./src/pmc/packfileconstanttable.pmc"
+
+    Parrot_PackfileConstantTable_attributes * const attrs =
+            PARROT_PACKFILECONSTANTTABLE(_self);
+    INTVAL idx = VTABLE_elements(interp, attrs->tag_map);
+    VTABLE_set_integer_keyed_int(interp, attrs->tag_map, idx, pmc_idx);
+    VTABLE_set_integer_keyed_int(interp, attrs->tag_map, idx, str_idx);
+#line 575 "./src/pmc/packfileconstanttable.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_PackfileConstantTable_multi_get_or_create_constant_STRING_pcc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+STRING *value;
+INTVAL  _result;
+PMC *_call_obj = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+Parrot_pcc_fill_params_from_c_args(interp, _call_obj, "PiS", &_self, &value);
+_result = Parrot_PackfileConstantTable_multi_get_or_create_constant_STRING(interp, _self, value);
+    Parrot_pcc_set_call_from_c_args(interp, _call_obj, "I", _result);
+}
+static  void
+Parrot_PackfileConstantTable_multi_get_or_create_constant_FLOATVAL_pcc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+FLOATVAL value;
+INTVAL  _result;
+PMC *_call_obj = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+Parrot_pcc_fill_params_from_c_args(interp, _call_obj, "PiN", &_self, &value);
+_result = Parrot_PackfileConstantTable_multi_get_or_create_constant_FLOATVAL(interp, _self, value);
+    Parrot_pcc_set_call_from_c_args(interp, _call_obj, "I", _result);
+}
+static  void
+Parrot_PackfileConstantTable_multi_get_or_create_constant_PMC_pcc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+PMC *value;
+INTVAL  _result;
+PMC *_call_obj = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+Parrot_pcc_fill_params_from_c_args(interp, _call_obj, "PiP", &_self, &value);
+_result = Parrot_PackfileConstantTable_multi_get_or_create_constant_PMC(interp, _self, value);
+    Parrot_pcc_set_call_from_c_args(interp, _call_obj, "I", _result);
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_PackfileConstantTable_update_vtable(VTABLE *vt) {
+    vt->get_number_keyed_int = Parrot_PackfileConstantTable_get_number_keyed_int;
+    vt->get_pmc_keyed_int = Parrot_PackfileConstantTable_get_pmc_keyed_int;
+    vt->get_pointer = Parrot_PackfileConstantTable_get_pointer;
+    vt->get_string_keyed_int = Parrot_PackfileConstantTable_get_string_keyed_int;
+    vt->init = Parrot_PackfileConstantTable_init;
+    vt->mark = Parrot_PackfileConstantTable_mark;
+    vt->push_float = Parrot_PackfileConstantTable_push_float;
+    vt->push_pmc = Parrot_PackfileConstantTable_push_pmc;
+    vt->push_string = Parrot_PackfileConstantTable_push_string;
+    vt->set_number_keyed_int = Parrot_PackfileConstantTable_set_number_keyed_int;
+    vt->set_pmc_keyed_int = Parrot_PackfileConstantTable_set_pmc_keyed_int;
+    vt->set_pointer = Parrot_PackfileConstantTable_set_pointer;
+    vt->set_string_keyed_int = Parrot_PackfileConstantTable_set_string_keyed_int;
+    vt->attr_size = sizeof(Parrot_PackfileConstantTable_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_PackfileConstantTable_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->get_number_keyed_int = Parrot_PackfileConstantTable_get_number_keyed_int;
+    vt->get_pmc_keyed_int = Parrot_PackfileConstantTable_get_pmc_keyed_int;
+    vt->get_pointer = Parrot_PackfileConstantTable_get_pointer;
+    vt->get_string_keyed_int = Parrot_PackfileConstantTable_get_string_keyed_int;
+    vt->mark = Parrot_PackfileConstantTable_mark;
+    vt->attr_size = sizeof(Parrot_PackfileConstantTable_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_PackfileConstantTable_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_PackfileSegment_get_vtable(interp);
+    Parrot_PackfileConstantTable_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_PackfileConstantTable_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_PackfileSegment_ro_get_vtable(interp);
+    Parrot_PackfileConstantTable_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_PackfileConstantTable_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+    mro = Parrot_PackfileSegment_get_mro(interp, mro);
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "PackfileConstantTable"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_PackfileConstantTable_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    isa = Parrot_PackfileSegment_get_isa(interp, isa);
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "PackfileConstantTable")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_PackfileConstantTable_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "Fdirectory Fnum_constants Fstr_constants Fpmc_constants Ftag_map ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_PackfileConstantTable_get_vtable(interp);
+        vt->base_type      = enum_class_PackfileConstantTable;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "PackfileConstantTable");
+        vt->provides_str = CONST_STRING_GEN(interp, "scalar");
+        vt->isa_hash     = Parrot_PackfileConstantTable_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_PackfileConstantTable_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_PackfileConstantTable;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_PackfileConstantTable_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "num_count");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_PackfileConstantTable_nci_num_count),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "str_count");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_PackfileConstantTable_nci_str_count),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "pmc_count");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_PackfileConstantTable_nci_pmc_count),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "set_main");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_PackfileConstantTable_nci_set_main),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "type");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_PackfileConstantTable_nci_type),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "add_tag_mapping");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_PackfileConstantTable_nci_add_tag_mapping),
+                method_name, signature);
+        }
+        {
+            STRING * const mfl_0 = CONST_STRING_GEN(interp, "get_or_create_constant");
+            STRING * const mfl_1 = CONST_STRING_GEN(interp, "PackfileConstantTable,STRING");
+            STRING * const mfl_2 = CONST_STRING_GEN(interp, "PackfileConstantTable");
+            STRING * const mfl_3 = CONST_STRING_GEN(interp, "PackfileConstantTable,FLOATVAL");
+            STRING * const mfl_4 = CONST_STRING_GEN(interp, "PackfileConstantTable,PMC");
+        PMC *_temp_func;
+_temp_func = Parrot_pmc_new(interp, enum_class_NativePCCMethod);
+VTABLE_set_pointer_keyed_str(interp, _temp_func, CONST_STRING(interp, "->"), (void *)Parrot_PackfileConstantTable_multi_get_or_create_constant_STRING_pcc);
+Parrot_mmd_add_multi_from_long_sig(interp, mfl_0, mfl_1, _temp_func);
+
+_temp_func = Parrot_pmc_new(interp, enum_class_NativePCCMethod);
+VTABLE_set_pointer_keyed_str(interp, _temp_func, CONST_STRING(interp, "->"), (void *)Parrot_PackfileConstantTable_multi_get_or_create_constant_FLOATVAL_pcc);
+Parrot_mmd_add_multi_from_long_sig(interp, mfl_0, mfl_3, _temp_func);
+
+_temp_func = Parrot_pmc_new(interp, enum_class_NativePCCMethod);
+VTABLE_set_pointer_keyed_str(interp, _temp_func, CONST_STRING(interp, "->"), (void *)Parrot_PackfileConstantTable_multi_get_or_create_constant_PMC_pcc);
+Parrot_mmd_add_multi_from_long_sig(interp, mfl_0, mfl_4, _temp_func);
+
+        }
+    } /* pass */
+} /* Parrot_PackfileConstantTable_class_init */
+
+#line 435 "./src/pmc/packfileconstanttable.pmc"
+
+/*
+
+=back
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -0,0 +1,410 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/packfiledebug.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_fixedintegerarray.h"
+#include "pmc_packfiledebug.h"
+#include "pmc_packfilerawsegment.h"
+#include "pmc_packfilesegment.h"
+#include "pmc_default.h"
+#include "packfiledebug.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/packfiledebug.pmc"
+/*
+Copyright (C) 2001-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/packfiledebug.pmc - PackfileDebug PMC
+
+=head1 DESCRIPTION
+
+This class implements a PackfileDebug object, a segment of the .pbc
+data file used for storing pir debug information.
+
+See packfile.pmc for the toplevel Packfile interface, see packfilesegment.pmc
+for the list of common methods every packfile segment pmc must implement; see
+PDD13 for the design spec.
+
+Initial and experimental version, using some vtables as a quick way of testing.
+
+=head2 Vtable functions
+
+=over 4
+
+=cut
+
+*/
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+#line 55 "./src/pmc/packfiledebug.c"
+static  INTVAL  Parrot_PackfileDebug_elements(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_PackfileDebug_get_integer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_PackfileDebug_get_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL n);
+static  PMC  * Parrot_PackfileDebug_get_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL n);
+static  void  * Parrot_PackfileDebug_get_pointer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING  * Parrot_PackfileDebug_get_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL n);
+static  void  Parrot_PackfileDebug_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_PackfileDebug_mark(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_PackfileDebug_set_pointer(PARROT_INTERP, ARGMOD(PMC *_self), void *pointer);
+static  void Parrot_PackfileDebug_nci_set_directory(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_PackfileDebug_class_init(PARROT_INTERP, int, int);
+void    Parrot_PackfileDebug_ro_class_init(PARROT_INTERP, int, int);
+static  INTVAL 
+Parrot_PackfileDebug_elements(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 160 "./src/pmc/packfiledebug.pmc"
+
+    INTVAL num_mappings;
+    GETATTR_PackfileDebug_num_mappings(interp, _self, num_mappings);
+    return num_mappings;
+#line 76 "./src/pmc/packfiledebug.c"
+}
+static  INTVAL 
+Parrot_PackfileDebug_get_integer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 156 "./src/pmc/packfiledebug.pmc"
+
+    return Parrot_PackfileDebug_elements(interp, _self);
+#line 84 "./src/pmc/packfiledebug.c"
+}
+static  INTVAL 
+Parrot_PackfileDebug_get_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL n)
+{
+#line 188 "./src/pmc/packfiledebug.pmc"
+
+    Parrot_PackfileDebug_attributes * const attrs =
+            PARROT_PACKFILEDEBUG(_self);
+
+    if (n >= attrs->num_mappings)
+        return -1;
+
+    return VTABLE_get_integer_keyed_int(interp, attrs->mapping_offset, n);
+#line 98 "./src/pmc/packfiledebug.c"
+}
+static  PMC  *
+Parrot_PackfileDebug_get_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL n)
+{
+#line 180 "./src/pmc/packfiledebug.pmc"
+
+    INTVAL line = Parrot_PackfileDebug_get_integer_keyed_int(interp, _self, n);
+    if (line < 0)
+        return PMCNULL;
+
+    return Parrot_pmc_new_init_int(interp, enum_class_Integer, line);
+#line 110 "./src/pmc/packfiledebug.c"
+}
+static  void  *
+Parrot_PackfileDebug_get_pointer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 125 "./src/pmc/packfiledebug.pmc"
+
+    PackFile_Debug * const p = (PackFile_Debug *) mem_gc_realloc_n_typed(interp,
+                                                       interp->vtables[enum_class_PackfileRawSegment]->get_pointer(interp, _self), sizeof (PackFile_Debug), char);
+    INTVAL num_mappings;
+    PMC *mapping_offset;
+    PMC *mapping_filename;
+    INTVAL i;
+    GETATTR_PackfileDebug_num_mappings(interp, _self, num_mappings);
+    GETATTR_PackfileDebug_mapping_offset(interp, _self, mapping_offset);
+    GETATTR_PackfileDebug_mapping_filename(interp, _self, mapping_filename);
+    p->num_mappings = num_mappings;
+    p->mappings = mem_gc_allocate_n_typed(interp, num_mappings, PackFile_DebugFilenameMapping);
+    for (i = 0; i < num_mappings; ++i) {
+        p->mappings[i].offset = VTABLE_get_integer_keyed_int(interp, mapping_offset, i);
+        p->mappings[i].filename = VTABLE_get_integer_keyed_int(interp, mapping_filename, i);
+    }
+    return p;
+#line 133 "./src/pmc/packfiledebug.c"
+}
+static  STRING  *
+Parrot_PackfileDebug_get_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL n)
+{
+#line 210 "./src/pmc/packfiledebug.pmc"
+
+    Parrot_PackfileDebug_attributes * const attrs =
+            PARROT_PACKFILEDEBUG(_self);
+    INTVAL filename;
+
+    if (n >= attrs->num_mappings)
+        return STRINGNULL;
+
+    filename = VTABLE_get_integer_keyed_int(interp,
+            attrs->mapping_filename, n);
+
+    if (attrs->const_table != PMCNULL)
+        return VTABLE_get_string_keyed_int(interp,
+                attrs->const_table, filename);
+
+    return Parrot_str_from_int(interp, filename);
+#line 155 "./src/pmc/packfiledebug.c"
+}
+static  void 
+Parrot_PackfileDebug_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 51 "./src/pmc/packfiledebug.pmc"
+
+    interp->vtables[enum_class_PackfileRawSegment]->init(interp, _self);
+    SETATTR_PackfileDebug_type(interp, _self, PF_DEBUG_SEG);
+    Parrot_warn_experimental(interp, "PackfileDebug is experimental");
+
+    /* Don't initialize C<const_table>.  It will be set to NULL by
+     * auto_attrs handling.  And should be set to proper PMC in
+     * set_directory.
+     */
+
+    PObj_custom_mark_SET(_self);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 173 "./src/pmc/packfiledebug.c"
+}
+static  void 
+Parrot_PackfileDebug_mark(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 74 "./src/pmc/packfiledebug.pmc"
+
+    Parrot_PackfileDebug_attributes * const attrs =
+            PARROT_PACKFILEDEBUG(_self);
+
+    Parrot_gc_mark_PMC_alive(interp, attrs->const_table);
+    Parrot_gc_mark_PMC_alive(interp, attrs->mapping_offset);
+    Parrot_gc_mark_PMC_alive(interp, attrs->mapping_filename);
+
+    interp->vtables[enum_class_PackfileRawSegment]->mark(interp, _self);
+#line 188 "./src/pmc/packfiledebug.c"
+}
+static  void 
+Parrot_PackfileDebug_set_pointer(PARROT_INTERP, ARGMOD(PMC *_self), void *pointer)
+{
+#line 96 "./src/pmc/packfiledebug.pmc"
+
+    PackFile_Debug *p = (PackFile_Debug *) pointer;
+    const INTVAL num_mappings = p->num_mappings;
+    PMC * const mapping_offset = Parrot_pmc_new_init_int(interp,
+                                                  enum_class_FixedIntegerArray, num_mappings);
+    PMC * const mapping_filename = Parrot_pmc_new_init_int(interp,
+                                                  enum_class_FixedIntegerArray, num_mappings);
+    INTVAL i;
+
+    interp->vtables[enum_class_PackfileRawSegment]->set_pointer(interp, _self, pointer);
+    for (i = 0; i < num_mappings; ++i) {
+        VTABLE_set_integer_keyed_int(interp, mapping_offset, i, p->mappings[i].offset);
+        VTABLE_set_integer_keyed_int(interp, mapping_filename, i, p->mappings[i].filename);
+    }
+    SETATTR_PackfileDebug_num_mappings(interp, _self, p->num_mappings);
+    SETATTR_PackfileDebug_mapping_offset(interp, _self, mapping_offset);
+    SETATTR_PackfileDebug_mapping_filename(interp, _self, mapping_filename);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 212 "./src/pmc/packfiledebug.c"
+}
+static  void
+Parrot_PackfileDebug_nci_set_directory(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* directory;
+    
+    const INTVAL arity = 2; /* "PiP" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    directory = VTABLE_get_pmc_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 245 "./src/pmc/packfiledebug.pmc"
+
+    Parrot_PackfileDebug_attributes * const attrs =
+            PARROT_PACKFILEDEBUG(_self);
+    STRING * const const_table_str =
+            Parrot_str_new_constant(interp, "PackfileConstantTable");
+    PMC * const iter = VTABLE_get_iter(interp, directory);
+
+    /* This should be SUPER(directory), but that doesn't work. */
+    attrs->directory = directory;
+
+    while (VTABLE_get_bool(interp, iter)) {
+        STRING * const name = VTABLE_shift_string(interp, iter);
+        PMC * const segment = VTABLE_get_pmc_keyed_str(interp, directory, name);
+        if (VTABLE_isa(interp, segment, const_table_str)) {
+            attrs->const_table = segment;
+            break;
+        }
+    }
+#line 253 "./src/pmc/packfiledebug.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_PackfileDebug_update_vtable(VTABLE *vt) {
+    vt->elements = Parrot_PackfileDebug_elements;
+    vt->get_integer = Parrot_PackfileDebug_get_integer;
+    vt->get_integer_keyed_int = Parrot_PackfileDebug_get_integer_keyed_int;
+    vt->get_pmc_keyed_int = Parrot_PackfileDebug_get_pmc_keyed_int;
+    vt->get_pointer = Parrot_PackfileDebug_get_pointer;
+    vt->get_string_keyed_int = Parrot_PackfileDebug_get_string_keyed_int;
+    vt->init = Parrot_PackfileDebug_init;
+    vt->mark = Parrot_PackfileDebug_mark;
+    vt->set_pointer = Parrot_PackfileDebug_set_pointer;
+    vt->attr_size = sizeof(Parrot_PackfileDebug_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_PackfileDebug_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->elements = Parrot_PackfileDebug_elements;
+    vt->get_integer = Parrot_PackfileDebug_get_integer;
+    vt->get_integer_keyed_int = Parrot_PackfileDebug_get_integer_keyed_int;
+    vt->get_pmc_keyed_int = Parrot_PackfileDebug_get_pmc_keyed_int;
+    vt->get_pointer = Parrot_PackfileDebug_get_pointer;
+    vt->get_string_keyed_int = Parrot_PackfileDebug_get_string_keyed_int;
+    vt->mark = Parrot_PackfileDebug_mark;
+    vt->attr_size = sizeof(Parrot_PackfileDebug_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_PackfileDebug_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_PackfileRawSegment_get_vtable(interp);
+    Parrot_PackfileDebug_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_PackfileDebug_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_PackfileRawSegment_ro_get_vtable(interp);
+    Parrot_PackfileDebug_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_PackfileDebug_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+    mro = Parrot_PackfileRawSegment_get_mro(interp, mro);
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "PackfileDebug"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_PackfileDebug_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    isa = Parrot_PackfileRawSegment_get_isa(interp, isa);
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "PackfileDebug")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_PackfileDebug_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "Fdirectory Itype Fopcodes Fconst_table Inum_mappings Fmapping_offset Fmapping_filename ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_PackfileDebug_get_vtable(interp);
+        vt->base_type      = enum_class_PackfileDebug;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "PackfileDebug");
+        vt->provides_str = CONST_STRING_GEN(interp, "scalar");
+        vt->isa_hash     = Parrot_PackfileDebug_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_PackfileDebug_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_PackfileDebug;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_PackfileDebug_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "set_directory");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_PackfileDebug_nci_set_directory),
+                method_name, signature);
+        }
+        {
+        }
+    } /* pass */
+} /* Parrot_PackfileDebug_class_init */
+
+#line 264 "./src/pmc/packfiledebug.pmc"
+
+
+/*
+
+=back
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -0,0 +1,376 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/packfiledirectory.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_packfiledirectory.h"
+#include "pmc_packfilesegment.h"
+#include "pmc_default.h"
+#include "packfiledirectory.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/packfiledirectory.pmc"
+/*
+Copyright (C) 2001-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/packfiledirectory.pmc - PackfileDirectory PMC
+
+=head1 DESCRIPTION
+
+This class implements a PackfileDirectory object, a segment of the .pbc data
+file used for listing the rest of the file's contents.  Essentially this
+segment is a container for all other segments within a Packfile.
+
+See packfile.pmc for the toplevel Packfile interface, see packfilesegment.pmc
+for the list of common methods every packfile segment pmc must implement; see
+PDD13 for the design spec.
+
+
+=head2 Methods
+
+=over 4
+
+=cut
+
+*/
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+#line 53 "./src/pmc/packfiledirectory.c"
+static  void  Parrot_PackfileDirectory_delete_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  INTVAL  Parrot_PackfileDirectory_elements(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC  * Parrot_PackfileDirectory_get_iter(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC  * Parrot_PackfileDirectory_get_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  PMC  * Parrot_PackfileDirectory_get_pmc_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name);
+static  void  * Parrot_PackfileDirectory_get_pointer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_PackfileDirectory_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_PackfileDirectory_mark(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_PackfileDirectory_set_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, PMC *segment);
+static  void  Parrot_PackfileDirectory_set_pmc_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name, PMC *segment);
+static  void  Parrot_PackfileDirectory_set_pointer(PARROT_INTERP, ARGMOD(PMC *_self), void *ptr);
+void    Parrot_PackfileDirectory_class_init(PARROT_INTERP, int, int);
+void    Parrot_PackfileDirectory_ro_class_init(PARROT_INTERP, int, int);
+static  void 
+Parrot_PackfileDirectory_delete_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 268 "./src/pmc/packfiledirectory.pmc"
+
+    VTABLE_delete_keyed(interp,
+        PARROT_PACKFILEDIRECTORY(_self)->hash, key);
+#line 74 "./src/pmc/packfiledirectory.c"
+}
+static  INTVAL 
+Parrot_PackfileDirectory_elements(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 169 "./src/pmc/packfiledirectory.pmc"
+
+    return VTABLE_elements(interp, PARROT_PACKFILEDIRECTORY(_self)->hash);
+#line 82 "./src/pmc/packfiledirectory.c"
+}
+static  PMC  *
+Parrot_PackfileDirectory_get_iter(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 184 "./src/pmc/packfiledirectory.pmc"
+
+    return VTABLE_get_iter(interp, PARROT_PACKFILEDIRECTORY(_self)->hash);
+#line 90 "./src/pmc/packfiledirectory.c"
+}
+static  PMC  *
+Parrot_PackfileDirectory_get_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 214 "./src/pmc/packfiledirectory.pmc"
+
+    STRING * const s_key = VTABLE_get_string(interp, key);
+    return VTABLE_get_pmc_keyed_str(interp,
+            PARROT_PACKFILEDIRECTORY(_self)->hash, s_key);
+#line 100 "./src/pmc/packfiledirectory.c"
+}
+static  PMC  *
+Parrot_PackfileDirectory_get_pmc_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name)
+{
+#line 198 "./src/pmc/packfiledirectory.pmc"
+
+    return VTABLE_get_pmc_keyed_str(interp,
+            PARROT_PACKFILEDIRECTORY(_self)->hash, name);
+#line 109 "./src/pmc/packfiledirectory.c"
+}
+static  void  *
+Parrot_PackfileDirectory_get_pointer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 138 "./src/pmc/packfiledirectory.pmc"
+
+    Parrot_PackfileDirectory_attributes * attrs =
+            PARROT_PACKFILEDIRECTORY(_self);
+    PackFile           * const pf    = PackFile_new(interp, 0); /* dummy PackFile... */
+    PackFile_Directory * const pfdir = &pf->directory;
+    PMC                * const iter  = VTABLE_get_iter(interp, attrs->hash);
+
+    /* Create Segments. Add to Directory with transfering ownership */
+    while (VTABLE_get_bool(interp, iter)) {
+        STRING           * const name  = VTABLE_shift_string(interp, iter);
+        PMC              * const seg   = VTABLE_get_pmc_keyed_str(interp, attrs->hash, name);
+        PackFile_Segment * const pfseg = (PackFile_Segment *)VTABLE_get_pointer(interp, seg);
+
+        pfseg->pf   = pf;
+        pfseg->name = name;
+        PackFile_add_segment(interp, pfdir, pfseg);
+    }
+
+    return pf;
+#line 134 "./src/pmc/packfiledirectory.c"
+}
+static  void 
+Parrot_PackfileDirectory_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 45 "./src/pmc/packfiledirectory.pmc"
+
+    Parrot_PackfileDirectory_attributes * const attrs =
+            PMC_data_typed(_self, Parrot_PackfileDirectory_attributes*);
+
+    attrs->hash = Parrot_pmc_new(interp, enum_class_Hash);
+
+    PObj_custom_mark_SET(_self);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 148 "./src/pmc/packfiledirectory.c"
+}
+static  void 
+Parrot_PackfileDirectory_mark(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 64 "./src/pmc/packfiledirectory.pmc"
+
+    Parrot_PackfileDirectory_attributes * const attrs =
+            PARROT_PACKFILEDIRECTORY(_self);
+
+    Parrot_gc_mark_PMC_alive(interp, attrs->hash);
+
+    interp->vtables[enum_class_PackfileSegment]->mark(interp, _self);
+#line 161 "./src/pmc/packfiledirectory.c"
+}
+static  void 
+Parrot_PackfileDirectory_set_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, PMC *segment)
+{
+#line 253 "./src/pmc/packfiledirectory.pmc"
+
+    STRING * const s_key = VTABLE_get_string(interp, key);
+    VTABLE_set_pmc_keyed_str(interp, _self, s_key, segment);
+#line 170 "./src/pmc/packfiledirectory.c"
+}
+static  void 
+Parrot_PackfileDirectory_set_pmc_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name, PMC *segment)
+{
+#line 234 "./src/pmc/packfiledirectory.pmc"
+
+    Parrot_pcc_invoke_method_from_c_args(interp, segment,
+        Parrot_str_new_constant(interp, "set_directory"),
+        "P->", _self);
+    VTABLE_set_pmc_keyed_str(interp,
+        PARROT_PACKFILEDIRECTORY(_self)->hash, name, segment);
+#line 182 "./src/pmc/packfiledirectory.c"
+}
+static  void 
+Parrot_PackfileDirectory_set_pointer(PARROT_INTERP, ARGMOD(PMC *_self), void *ptr)
+{
+#line 83 "./src/pmc/packfiledirectory.pmc"
+
+    const PackFile_Directory * const pfd = (const PackFile_Directory *)ptr;
+    size_t i;
+
+    interp->vtables[enum_class_PackfileSegment]->set_pointer(interp, _self, ptr);
+
+    /* Iterate over elements and create corresponded PMCs */
+    for (i=0; i < pfd->num_segments; ++i) {
+        PackFile_Segment * const pfseg = pfd->segments[i];
+        int     pmc_type;
+        PMC     *segment;
+        STRING  *name;
+
+        switch (pfseg->type) {
+          case PF_DIR_SEG:
+            pmc_type = enum_class_PackfileDirectory;
+            break;
+          case PF_CONST_SEG:
+            pmc_type = enum_class_PackfileConstantTable;
+            break;
+          case PF_ANNOTATIONS_SEG:
+            pmc_type = enum_class_PackfileAnnotations;
+            break;
+          case PF_DEBUG_SEG:
+            pmc_type = enum_class_PackfileDebug;
+            break;
+          case PF_BYTEC_SEG:
+            pmc_type = enum_class_PackfileBytecodeSegment;
+            break;
+          case PF_UNKNOWN_SEG:
+          default:
+            pmc_type = enum_class_PackfileRawSegment;
+            break;
+        }
+
+        segment = Parrot_pmc_new(interp, pmc_type);
+        name    = pfseg->name;
+        VTABLE_set_pmc_keyed_str(interp, _self, name, segment);
+
+        /* Initialize internal PMC structure */
+        VTABLE_set_pointer(interp, segment, pfseg);
+
+    }
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 232 "./src/pmc/packfiledirectory.c"
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_PackfileDirectory_update_vtable(VTABLE *vt) {
+    vt->delete_keyed = Parrot_PackfileDirectory_delete_keyed;
+    vt->elements = Parrot_PackfileDirectory_elements;
+    vt->get_iter = Parrot_PackfileDirectory_get_iter;
+    vt->get_pmc_keyed = Parrot_PackfileDirectory_get_pmc_keyed;
+    vt->get_pmc_keyed_str = Parrot_PackfileDirectory_get_pmc_keyed_str;
+    vt->get_pointer = Parrot_PackfileDirectory_get_pointer;
+    vt->init = Parrot_PackfileDirectory_init;
+    vt->mark = Parrot_PackfileDirectory_mark;
+    vt->set_pmc_keyed = Parrot_PackfileDirectory_set_pmc_keyed;
+    vt->set_pmc_keyed_str = Parrot_PackfileDirectory_set_pmc_keyed_str;
+    vt->set_pointer = Parrot_PackfileDirectory_set_pointer;
+    vt->attr_size = sizeof(Parrot_PackfileDirectory_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_PackfileDirectory_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->elements = Parrot_PackfileDirectory_elements;
+    vt->get_iter = Parrot_PackfileDirectory_get_iter;
+    vt->get_pmc_keyed = Parrot_PackfileDirectory_get_pmc_keyed;
+    vt->get_pmc_keyed_str = Parrot_PackfileDirectory_get_pmc_keyed_str;
+    vt->get_pointer = Parrot_PackfileDirectory_get_pointer;
+    vt->mark = Parrot_PackfileDirectory_mark;
+    vt->attr_size = sizeof(Parrot_PackfileDirectory_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_PackfileDirectory_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_PackfileSegment_get_vtable(interp);
+    Parrot_PackfileDirectory_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_PackfileDirectory_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_PackfileSegment_ro_get_vtable(interp);
+    Parrot_PackfileDirectory_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_PackfileDirectory_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+    mro = Parrot_PackfileSegment_get_mro(interp, mro);
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "PackfileDirectory"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_PackfileDirectory_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    isa = Parrot_PackfileSegment_get_isa(interp, isa);
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "PackfileDirectory")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_PackfileDirectory_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "Fdirectory Fhash ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_PackfileDirectory_get_vtable(interp);
+        vt->base_type      = enum_class_PackfileDirectory;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "PackfileDirectory");
+        vt->provides_str = CONST_STRING_GEN(interp, "scalar");
+        vt->isa_hash     = Parrot_PackfileDirectory_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_PackfileDirectory_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_PackfileDirectory;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_PackfileDirectory_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+        }
+    } /* pass */
+} /* Parrot_PackfileDirectory_class_init */
+
+#line 273 "./src/pmc/packfiledirectory.pmc"
+
+
+/*
+
+=back
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -0,0 +1,597 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/packfileopmap.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_fixedintegerarray.h"
+#include "pmc_packfileopmap.h"
+#include "pmc_default.h"
+#include "packfileopmap.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/packfileopmap.pmc"
+/*
+Copyright (C) 2001-2011, Parrot Foundation.
+
+
+=head1 NAME
+
+src/pmc/packfileopmap.pmc - PackfileOpMap PMC
+
+=head1 DESCRIPTION
+
+This class implements a PackfileOpMap, which provides a map between op
+numbers in a bytecode segment and the libraries and offsets within those
+libraries that the ops come from.
+
+=head2 Vtable functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "pmc/pmc_parrotlibrary.h"
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+#line 51 "./src/pmc/packfileopmap.c"
+static  INTVAL  Parrot_PackfileOpMap_get_integer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_PackfileOpMap_get_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  INTVAL  Parrot_PackfileOpMap_get_integer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *str_key);
+static  PMC*  Parrot_PackfileOpMap_get_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  PMC*  Parrot_PackfileOpMap_get_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  PMC*  Parrot_PackfileOpMap_get_pmc_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name);
+static  void  * Parrot_PackfileOpMap_get_pointer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING*  Parrot_PackfileOpMap_get_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  void  Parrot_PackfileOpMap_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_PackfileOpMap_mark(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_PackfileOpMap_nci_load_lib(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_PackfileOpMap_nci_oplibs(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_PackfileOpMap_class_init(PARROT_INTERP, int, int);
+void    Parrot_PackfileOpMap_ro_class_init(PARROT_INTERP, int, int);
+static  INTVAL 
+Parrot_PackfileOpMap_get_integer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 234 "./src/pmc/packfileopmap.pmc"
+
+    PMC *ops;
+    GETATTR_PackfileOpMap_ops(interp, _self, ops);
+    return VTABLE_elements(interp, ops);
+#line 74 "./src/pmc/packfileopmap.c"
+}
+static  INTVAL 
+Parrot_PackfileOpMap_get_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 85 "./src/pmc/packfileopmap.pmc"
+
+    STRING *key_str, *oplib_str;
+    PMC    *map_cache, *op_maps, *ops;
+    INTVAL  op_map_count, i;
+
+    GETATTR_PackfileOpMap_map_cache(interp, _self, map_cache);
+
+    if (VTABLE_exists_keyed(interp, map_cache, key)) {
+        return VTABLE_get_integer_keyed(interp, map_cache, key);
+    }
+
+    key_str = Parrot_key_string(interp, key);
+    oplib_str = CONST_STRING(interp, "oplib");
+    GETATTR_PackfileOpMap_op_maps(interp, _self, op_maps);
+    op_map_count = VTABLE_elements(interp, op_maps);
+    for (i = 0; i < op_map_count; i++) {
+
+        PMC *table_ops, *lib_ops;
+        STRING *table_ops_str, *lib_ops_str;
+        INTVAL op_count;
+
+        PMC * const op_map  = VTABLE_get_pmc_keyed_int(interp, op_maps, i);
+        PMC * const oplib   = VTABLE_get_pmc_keyed_str(interp, op_map, oplib_str);
+        const INTVAL op_num = VTABLE_get_integer_keyed(interp, oplib, key);
+
+        /* Not in this oplib */
+        if (op_num == -1) {
+            continue;
+        }
+
+        table_ops_str = CONST_STRING(interp, "table_ops");
+        lib_ops_str   = CONST_STRING(interp, "lib_ops");
+
+        table_ops = VTABLE_get_pmc_keyed_str(interp, op_map, table_ops_str);
+        lib_ops   = VTABLE_get_pmc_keyed_str(interp, op_map, lib_ops_str);
+
+        GETATTR_PackfileOpMap_ops(interp, _self, ops);
+        op_count = VTABLE_elements(interp, ops);
+
+        VTABLE_set_integer_keyed(interp, map_cache, key, op_count);
+        VTABLE_push_integer(interp, table_ops, op_count);
+        VTABLE_push_integer(interp, lib_ops, op_num);
+
+        VTABLE_push_string(interp, ops, key_str);
+
+        return op_count;
+    }
+
+    Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+                    "Couldn't find '%Ss' op.", key_str);
+    return -1;
+#line 131 "./src/pmc/packfileopmap.c"
+}
+static  INTVAL 
+Parrot_PackfileOpMap_get_integer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *str_key)
+{
+#line 138 "./src/pmc/packfileopmap.pmc"
+
+    PMC * const pmc_key = Parrot_key_new_string(interp, str_key);
+    return VTABLE_get_integer_keyed(interp, _self, pmc_key);
+#line 140 "./src/pmc/packfileopmap.c"
+}
+static  PMC* 
+Parrot_PackfileOpMap_get_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 175 "./src/pmc/packfileopmap.pmc"
+
+    return Parrot_PackfileOpMap_get_pmc_keyed_str(interp, _self, Parrot_key_string(interp, key));
+#line 148 "./src/pmc/packfileopmap.c"
+}
+static  PMC* 
+Parrot_PackfileOpMap_get_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+#line 195 "./src/pmc/packfileopmap.pmc"
+
+    return Parrot_pmc_box_string(interp, Parrot_PackfileOpMap_get_string_keyed_int(interp, _self, key));
+#line 156 "./src/pmc/packfileopmap.c"
+}
+static  PMC* 
+Parrot_PackfileOpMap_get_pmc_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name)
+{
+#line 154 "./src/pmc/packfileopmap.pmc"
+
+    PMC    *op_maps;
+    INTVAL  op_map_count, i;
+    STRING * const oplib_str = CONST_STRING(interp, "oplib");
+
+    GETATTR_PackfileOpMap_op_maps(interp, _self, op_maps);
+    op_map_count = VTABLE_elements(interp, op_maps);
+    for (i = 0; i < op_map_count; i++) {
+        PMC * const op_map = VTABLE_get_pmc_keyed_int(interp, op_maps, i);
+        PMC * const oplib  = VTABLE_get_pmc_keyed_str(interp, op_map, oplib_str);
+        PMC * const op     = VTABLE_get_pmc_keyed_str(interp, oplib, name);
+
+        if (!PMC_IS_NULL(op))
+            return op;
+    }
+
+    Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+                    "Couldn't find '%Ss' op.", name);
+    return PMCNULL;
+#line 181 "./src/pmc/packfileopmap.c"
+}
+static  void  *
+Parrot_PackfileOpMap_get_pointer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 303 "./src/pmc/packfileopmap.pmc"
+
+    PMC                         *op_maps;
+    PackFile_ByteCode_OpMapping *m;
+    INTVAL                       i;
+
+    GETATTR_PackfileOpMap_op_maps(interp, _self, op_maps);
+
+    /* Allocate OpMapping. Caller must free results */
+    m = mem_gc_allocate_zeroed_typed(interp, PackFile_ByteCode_OpMapping);
+
+    m->n_libs = VTABLE_get_integer(interp, op_maps);
+    m->libs   = mem_gc_allocate_n_zeroed_typed(interp, m->n_libs,
+                        PackFile_ByteCode_OpMappingEntry);
+
+    /* Fill OpMappingEntry */
+    for (i = 0; i < m->n_libs; i++) {
+        INTVAL j;
+        PackFile_ByteCode_OpMappingEntry *om = &m->libs[i];
+        PMC * const mapping = VTABLE_get_pmc_keyed_int(interp, op_maps, i);
+
+        STRING *tmp;
+        PMC    *oplib, *table_ops, *lib_ops;
+
+        tmp     = CONST_STRING(interp, "oplib");
+        oplib   = VTABLE_get_pmc_keyed_str(interp, mapping, tmp);
+        om->lib = (op_lib_t *)VTABLE_get_pointer(interp, oplib);
+
+        tmp       = CONST_STRING(interp, "table_ops");
+        table_ops = VTABLE_get_pmc_keyed_str(interp, mapping, tmp);
+
+        om->n_ops = VTABLE_get_integer(interp, table_ops);
+
+        om->table_ops = mem_gc_allocate_n_zeroed_typed(interp, om->n_ops, opcode_t);
+        for (j = 0; j < om->n_ops; j++) {
+            om->table_ops[j] = VTABLE_get_integer_keyed_int(interp, table_ops, j);
+        }
+
+        tmp = CONST_STRING(interp, "lib_ops");
+        lib_ops     = VTABLE_get_pmc_keyed_str(interp, mapping, tmp);
+        om->lib_ops = mem_gc_allocate_n_zeroed_typed(interp, om->n_ops, opcode_t);
+        for (j = 0; j < om->n_ops; j++) {
+            om->lib_ops[j] = VTABLE_get_integer_keyed_int(interp, lib_ops, j);
+        }
+
+    }
+
+    return m;
+#line 234 "./src/pmc/packfileopmap.c"
+}
+static  STRING* 
+Parrot_PackfileOpMap_get_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+#line 189 "./src/pmc/packfileopmap.pmc"
+
+    PMC *ops;
+    GETATTR_PackfileOpMap_ops(interp, _self, ops);
+    return VTABLE_get_string_keyed_int(interp, ops, key);
+#line 244 "./src/pmc/packfileopmap.c"
+}
+static  void 
+Parrot_PackfileOpMap_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 45 "./src/pmc/packfileopmap.pmc"
+
+    PMC *core_ops_info, *core_ops_pmc;
+    STRING *oplib_name, *oplib_str, *lib_ops, *table_ops;
+    Parrot_PackfileOpMap_attributes *attrs = PARROT_PACKFILEOPMAP(_self);
+
+    PObj_custom_mark_SET(_self);
+
+    attrs->op_maps    = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+    attrs->map_cache  = Parrot_pmc_new(interp, enum_class_Hash);
+    attrs->ops        = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+
+    core_ops_pmc = Parrot_pmc_new(interp, enum_class_String);
+    VTABLE_set_string_native(interp, core_ops_pmc, CONST_STRING(interp, "core_ops"));
+    lib_ops      = CONST_STRING(interp, "lib_ops");
+    table_ops    = CONST_STRING(interp, "table_ops");
+    oplib_name   = CONST_STRING(interp, "oplib_name");
+    oplib_str    = CONST_STRING(interp, "oplib");
+
+    core_ops_info = Parrot_pmc_new(interp, enum_class_Hash);
+    VTABLE_set_pmc_keyed_str(interp, core_ops_info, oplib_name, core_ops_pmc);
+    VTABLE_set_pmc_keyed_str(interp, core_ops_info, oplib_str,
+            Parrot_pmc_new_init(interp, enum_class_OpLib, core_ops_pmc));
+    VTABLE_set_pmc_keyed_str(interp, core_ops_info, lib_ops,
+            Parrot_pmc_new(interp, enum_class_ResizableIntegerArray));
+    VTABLE_set_pmc_keyed_str(interp, core_ops_info, table_ops,
+            Parrot_pmc_new(interp, enum_class_ResizableIntegerArray));
+    VTABLE_push_pmc(interp, attrs->op_maps, core_ops_info);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 278 "./src/pmc/packfileopmap.c"
+}
+static  void 
+Parrot_PackfileOpMap_mark(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 210 "./src/pmc/packfileopmap.pmc"
+
+    PMC *tmp;
+
+    GETATTR_PackfileOpMap_op_maps(interp, _self, tmp);
+    Parrot_gc_mark_PMC_alive(interp, tmp);
+
+    GETATTR_PackfileOpMap_map_cache(interp, _self, tmp);
+    Parrot_gc_mark_PMC_alive(interp, tmp);
+
+    GETATTR_PackfileOpMap_ops(interp, _self, tmp);
+    Parrot_gc_mark_PMC_alive(interp, tmp);
+#line 295 "./src/pmc/packfileopmap.c"
+}
+static  void
+Parrot_PackfileOpMap_nci_load_lib(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* lib_name;
+    
+    const INTVAL arity = 2; /* "PiS" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    lib_name = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 249 "./src/pmc/packfileopmap.pmc"
+
+    /* check if the library has been loaded */
+    PMC *op_maps, *ops_info, *oplib, *lib_name_pmc;
+    INTVAL i, op_map_count;
+    STRING *oplib_name, *lib_ops, *table_ops, *oplib_str;
+    Parrot_PackfileOpMap_attributes * const attrs =
+            PARROT_PACKFILEOPMAP(_self);
+
+    oplib_name = CONST_STRING(interp, "oplib_name");
+
+    GETATTR_PackfileOpMap_op_maps(interp, _self, op_maps);
+    op_map_count = VTABLE_elements(interp, op_maps);
+
+    for (i = 0; i < op_map_count; i++) {
+        PMC * const map = VTABLE_get_pmc_keyed_int(interp, op_maps, i);
+        if (Parrot_str_equal(interp, lib_name,
+                    VTABLE_get_string_keyed_str(interp, map, oplib_name))) {
+            #line 335 "./src/pmc/packfileopmap.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)1);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return;
+     }
+#line 266 "./src/pmc/packfileopmap.pmc"
+
+        }
+    }
+
+    /* create a new OpLib etc */
+    lib_name_pmc = Parrot_pmc_new(interp, enum_class_String);
+    VTABLE_set_string_native(interp, lib_name_pmc, lib_name);
+    /* OpLib.init will throw exception on failure */
+    oplib = Parrot_pmc_new_init(interp, enum_class_OpLib, lib_name_pmc);
+
+    lib_ops   = CONST_STRING(interp, "lib_ops");
+    table_ops = CONST_STRING(interp, "table_ops");
+    oplib_str = CONST_STRING(interp, "oplib");
+
+    ops_info = Parrot_pmc_new(interp, enum_class_Hash);
+    VTABLE_set_pmc_keyed_str(interp, ops_info, oplib_name, lib_name_pmc);
+    VTABLE_set_pmc_keyed_str(interp, ops_info, oplib_str, oplib);
+    VTABLE_set_pmc_keyed_str(interp, ops_info, lib_ops,
+            Parrot_pmc_new(interp, enum_class_ResizableIntegerArray));
+    VTABLE_set_pmc_keyed_str(interp, ops_info, table_ops,
+            Parrot_pmc_new(interp, enum_class_ResizableIntegerArray));
+    VTABLE_push_pmc(interp, attrs->op_maps, ops_info);
+
+    #line 365 "./src/pmc/packfileopmap.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)1);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return;
+     }
+#line 289 "./src/pmc/packfileopmap.pmc"
+
+#line 373 "./src/pmc/packfileopmap.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_PackfileOpMap_nci_oplibs(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 368 "./src/pmc/packfileopmap.pmc"
+
+    STRING *oplib_str  = CONST_STRING(interp, "oplib");
+    STRING *oplib_name = CONST_STRING(interp, "oplib_name");
+    PMC *op_maps, *result;
+    INTVAL i, size;
+
+    GETATTR_PackfileOpMap_op_maps(interp, _self, op_maps);
+
+    result = Parrot_pmc_new(interp, enum_class_Hash);
+
+    size = VTABLE_elements(interp, op_maps);
+    for (i = 0; i < size; ++i) {
+        PMC * const op_map  = VTABLE_get_pmc_keyed_int(interp, op_maps, i);
+        PMC * const oplib   = VTABLE_get_pmc_keyed_str(interp, op_map, oplib_str);
+        STRING * const name = VTABLE_get_string_keyed_str(interp, op_map, oplib_name);
+
+        VTABLE_set_pmc_keyed_str(interp, result, name, oplib);
+    }
+
+    #line 420 "./src/pmc/packfileopmap.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)result);
+        
+        return;
+     }
+#line 387 "./src/pmc/packfileopmap.pmc"
+
+#line 428 "./src/pmc/packfileopmap.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_PackfileOpMap_update_vtable(VTABLE *vt) {
+    vt->get_integer = Parrot_PackfileOpMap_get_integer;
+    vt->get_integer_keyed = Parrot_PackfileOpMap_get_integer_keyed;
+    vt->get_integer_keyed_str = Parrot_PackfileOpMap_get_integer_keyed_str;
+    vt->get_pmc_keyed = Parrot_PackfileOpMap_get_pmc_keyed;
+    vt->get_pmc_keyed_int = Parrot_PackfileOpMap_get_pmc_keyed_int;
+    vt->get_pmc_keyed_str = Parrot_PackfileOpMap_get_pmc_keyed_str;
+    vt->get_pointer = Parrot_PackfileOpMap_get_pointer;
+    vt->get_string_keyed_int = Parrot_PackfileOpMap_get_string_keyed_int;
+    vt->init = Parrot_PackfileOpMap_init;
+    vt->mark = Parrot_PackfileOpMap_mark;
+    vt->attr_size = sizeof(Parrot_PackfileOpMap_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_PackfileOpMap_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->get_integer = Parrot_PackfileOpMap_get_integer;
+    vt->get_integer_keyed = Parrot_PackfileOpMap_get_integer_keyed;
+    vt->get_integer_keyed_str = Parrot_PackfileOpMap_get_integer_keyed_str;
+    vt->get_pmc_keyed = Parrot_PackfileOpMap_get_pmc_keyed;
+    vt->get_pmc_keyed_int = Parrot_PackfileOpMap_get_pmc_keyed_int;
+    vt->get_pmc_keyed_str = Parrot_PackfileOpMap_get_pmc_keyed_str;
+    vt->get_pointer = Parrot_PackfileOpMap_get_pointer;
+    vt->get_string_keyed_int = Parrot_PackfileOpMap_get_string_keyed_int;
+    vt->mark = Parrot_PackfileOpMap_mark;
+    vt->attr_size = sizeof(Parrot_PackfileOpMap_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_PackfileOpMap_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_PackfileOpMap_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_PackfileOpMap_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_PackfileOpMap_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_PackfileOpMap_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "PackfileOpMap"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_PackfileOpMap_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "PackfileOpMap")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_PackfileOpMap_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "Fop_maps Fmap_cache Fops ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_PackfileOpMap_get_vtable(interp);
+        vt->base_type      = enum_class_PackfileOpMap;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "PackfileOpMap");
+        vt->provides_str = CONST_STRING_GEN(interp, "scalar");
+        vt->isa_hash     = Parrot_PackfileOpMap_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_PackfileOpMap_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_PackfileOpMap;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_PackfileOpMap_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "load_lib");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_PackfileOpMap_nci_load_lib),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "oplibs");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_PackfileOpMap_nci_oplibs),
+                method_name, signature);
+        }
+        {
+        }
+    } /* pass */
+} /* Parrot_PackfileOpMap_class_init */
+
+#line 389 "./src/pmc/packfileopmap.pmc"
+
+
+
+/*
+
+=back
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
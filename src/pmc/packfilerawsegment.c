@@ -0,0 +1,454 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/packfilerawsegment.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_fixedintegerarray.h"
+#include "pmc_packfilerawsegment.h"
+#include "pmc_packfilesegment.h"
+#include "pmc_default.h"
+#include "packfilerawsegment.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/packfilerawsegment.pmc"
+/*
+Copyright (C) 2001-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/packfilerawsegment.pmc - PackfileRawSegment PMC
+
+=head1 DESCRIPTION
+
+This class implements a PackfileRawSegment object, a low level view of a
+segment that just splits it into an array of integers.
+
+See packfile.pmc for the toplevel Packfile interface, see packfilesegment.pmc
+for the list of common methods every packfile segment pmc must implement; see
+PDD13 for the design spec.
+
+
+=head2 Methods
+
+=over 4
+
+=cut
+
+*/
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+#line 53 "./src/pmc/packfilerawsegment.c"
+static  INTVAL  Parrot_PackfileRawSegment_elements(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_PackfileRawSegment_get_integer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_PackfileRawSegment_get_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  FLOATVAL  Parrot_PackfileRawSegment_get_number(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC  * Parrot_PackfileRawSegment_get_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  PMC  * Parrot_PackfileRawSegment_get_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL index);
+static  void  * Parrot_PackfileRawSegment_get_pointer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_PackfileRawSegment_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_PackfileRawSegment_mark(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_PackfileRawSegment_push_integer(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void  Parrot_PackfileRawSegment_push_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void  Parrot_PackfileRawSegment_set_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, INTVAL value);
+static  void  Parrot_PackfileRawSegment_set_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, PMC *value);
+static  void  Parrot_PackfileRawSegment_set_pointer(PARROT_INTERP, ARGMOD(PMC *_self), void *pointer);
+static  void Parrot_PackfileRawSegment_nci_type(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_PackfileRawSegment_class_init(PARROT_INTERP, int, int);
+void    Parrot_PackfileRawSegment_ro_class_init(PARROT_INTERP, int, int);
+static  INTVAL 
+Parrot_PackfileRawSegment_elements(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 144 "./src/pmc/packfilerawsegment.pmc"
+
+    return VTABLE_elements(interp,
+            PARROT_PACKFILERAWSEGMENT(_self)->opcodes);
+#line 78 "./src/pmc/packfilerawsegment.c"
+}
+static  INTVAL 
+Parrot_PackfileRawSegment_get_integer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 149 "./src/pmc/packfilerawsegment.pmc"
+
+    return VTABLE_elements(interp,
+            PARROT_PACKFILERAWSEGMENT(_self)->opcodes);
+#line 87 "./src/pmc/packfilerawsegment.c"
+}
+static  INTVAL 
+Parrot_PackfileRawSegment_get_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+#line 172 "./src/pmc/packfilerawsegment.pmc"
+
+    return VTABLE_get_integer_keyed_int(interp,
+            PARROT_PACKFILERAWSEGMENT(_self)->opcodes, key);
+#line 96 "./src/pmc/packfilerawsegment.c"
+}
+static  FLOATVAL 
+Parrot_PackfileRawSegment_get_number(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 154 "./src/pmc/packfilerawsegment.pmc"
+
+    return VTABLE_elements(interp,
+            PARROT_PACKFILERAWSEGMENT(_self)->opcodes);
+#line 105 "./src/pmc/packfilerawsegment.c"
+}
+static  PMC  *
+Parrot_PackfileRawSegment_get_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 181 "./src/pmc/packfilerawsegment.pmc"
+
+    return Parrot_PackfileRawSegment_get_pmc_keyed_int(interp, _self, VTABLE_get_integer(interp, key));
+#line 113 "./src/pmc/packfilerawsegment.c"
+}
+static  PMC  *
+Parrot_PackfileRawSegment_get_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL index)
+{
+#line 177 "./src/pmc/packfilerawsegment.pmc"
+
+    return Parrot_pmc_box_integer(interp, Parrot_PackfileRawSegment_get_integer_keyed_int(interp, _self, index));
+#line 121 "./src/pmc/packfilerawsegment.c"
+}
+static  void  *
+Parrot_PackfileRawSegment_get_pointer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 116 "./src/pmc/packfilerawsegment.pmc"
+
+    PackFile_Segment * const pfseg =
+            (PackFile_Segment*)mem_gc_allocate_zeroed_typed(interp, PackFile_ByteCode);
+    const Parrot_PackfileRawSegment_attributes * const attrs =
+            PARROT_PACKFILERAWSEGMENT(_self);
+    PMC * const opcodes = attrs->opcodes;
+    size_t i;
+
+    pfseg->type = attrs->type;
+    pfseg->size = VTABLE_get_integer(interp, opcodes);
+    pfseg->data = mem_gc_allocate_n_typed(interp, pfseg->size, opcode_t);
+
+    /* Not very efficient... */
+    for (i = 0; i < pfseg->size; ++i) {
+        pfseg->data[i] = VTABLE_get_integer_keyed_int(interp, opcodes, i);
+    }
+
+    return pfseg;
+#line 145 "./src/pmc/packfilerawsegment.c"
+}
+static  void 
+Parrot_PackfileRawSegment_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 46 "./src/pmc/packfilerawsegment.pmc"
+
+    Parrot_PackfileRawSegment_attributes * const attrs =
+            PMC_data_typed(_self, Parrot_PackfileRawSegment_attributes*);
+
+    attrs->opcodes = Parrot_pmc_new(interp, enum_class_ResizableIntegerArray);
+    attrs->type    = PF_BYTEC_SEG;
+
+    PObj_custom_mark_SET(_self);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 160 "./src/pmc/packfilerawsegment.c"
+}
+static  void 
+Parrot_PackfileRawSegment_mark(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 66 "./src/pmc/packfilerawsegment.pmc"
+
+    Parrot_PackfileRawSegment_attributes * const attrs =
+            PARROT_PACKFILERAWSEGMENT(_self);
+
+    Parrot_gc_mark_PMC_alive(interp, attrs->opcodes);
+
+    interp->vtables[enum_class_PackfileSegment]->mark(interp, _self);
+#line 173 "./src/pmc/packfilerawsegment.c"
+}
+static  void 
+Parrot_PackfileRawSegment_push_integer(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+#line 215 "./src/pmc/packfilerawsegment.pmc"
+
+    VTABLE_push_integer(interp,
+        PARROT_PACKFILERAWSEGMENT(_self)->opcodes, value);
+#line 182 "./src/pmc/packfilerawsegment.c"
+}
+static  void 
+Parrot_PackfileRawSegment_push_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 220 "./src/pmc/packfilerawsegment.pmc"
+
+    VTABLE_push_integer(interp,
+        PARROT_PACKFILERAWSEGMENT(_self)->opcodes,
+            VTABLE_get_integer(interp, value));
+#line 192 "./src/pmc/packfilerawsegment.c"
+}
+static  void 
+Parrot_PackfileRawSegment_set_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key, INTVAL value)
+{
+#line 195 "./src/pmc/packfilerawsegment.pmc"
+
+    VTABLE_set_integer_keyed_int(interp,
+        PARROT_PACKFILERAWSEGMENT(_self)->opcodes, key, value);
+#line 201 "./src/pmc/packfilerawsegment.c"
+}
+static  void 
+Parrot_PackfileRawSegment_set_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, PMC *value)
+{
+#line 200 "./src/pmc/packfilerawsegment.pmc"
+
+    VTABLE_set_integer_keyed_int(interp, _self, VTABLE_get_integer(interp, key),
+        VTABLE_get_integer(interp, value));
+#line 210 "./src/pmc/packfilerawsegment.c"
+}
+static  void 
+Parrot_PackfileRawSegment_set_pointer(PARROT_INTERP, ARGMOD(PMC *_self), void *pointer)
+{
+#line 86 "./src/pmc/packfilerawsegment.pmc"
+
+    const PackFile_Segment * const pfseg =
+            (const PackFile_Segment *)pointer;
+    Parrot_PackfileRawSegment_attributes * const attrs =
+            PARROT_PACKFILERAWSEGMENT(_self);
+    PMC * const opcodes = attrs->opcodes;
+
+    /* Preserve type of unpacked segment */
+    attrs->type = pfseg->type;
+
+    if (pfseg->size) {
+        size_t i;
+
+        /* copy data to own array */
+        VTABLE_set_integer_native(interp, opcodes, pfseg->size);
+        /* Not very efficient... */
+        for (i = 0; i < pfseg->size; ++i) {
+            VTABLE_set_integer_keyed_int(interp, opcodes, i, pfseg->data[i]);
+        }
+    }
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 237 "./src/pmc/packfilerawsegment.c"
+}
+static  void
+Parrot_PackfileRawSegment_nci_type(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    INTVAL type;
+    INTVAL got_type;
+    
+    const INTVAL arity = 1; /* "PiIoIp" */
+    const INTVAL arity_opt  = 1;
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count < arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too few arguments: %d passed, %d expected",
+                                    param_count, arity);
+    if (param_count > arity + arity_opt)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too many arguments: %d passed, %d expected",
+                                    param_count, arity + arity_opt);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    if (param_count > 1) {
+        type = VTABLE_get_integer_keyed_int(interp, _call_object, 1);
+        got_type = 1;
+    }
+    else {
+        type = 0;
+        got_type = 0;
+    }
+
+    { /* BEGIN PMETHOD BODY */
+#line 238 "./src/pmc/packfilerawsegment.pmc"
+
+    Parrot_PackfileRawSegment_attributes * const attrs =
+            PARROT_PACKFILERAWSEGMENT(_self);
+    INTVAL res;
+
+    if (got_type) {
+        attrs->type = type;
+    }
+
+    res = attrs->type;
+    #line 284 "./src/pmc/packfilerawsegment.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)res);
+        
+        return;
+     }
+#line 248 "./src/pmc/packfilerawsegment.pmc"
+
+#line 292 "./src/pmc/packfilerawsegment.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_PackfileRawSegment_update_vtable(VTABLE *vt) {
+    vt->elements = Parrot_PackfileRawSegment_elements;
+    vt->get_integer = Parrot_PackfileRawSegment_get_integer;
+    vt->get_integer_keyed_int = Parrot_PackfileRawSegment_get_integer_keyed_int;
+    vt->get_number = Parrot_PackfileRawSegment_get_number;
+    vt->get_pmc_keyed = Parrot_PackfileRawSegment_get_pmc_keyed;
+    vt->get_pmc_keyed_int = Parrot_PackfileRawSegment_get_pmc_keyed_int;
+    vt->get_pointer = Parrot_PackfileRawSegment_get_pointer;
+    vt->init = Parrot_PackfileRawSegment_init;
+    vt->mark = Parrot_PackfileRawSegment_mark;
+    vt->push_integer = Parrot_PackfileRawSegment_push_integer;
+    vt->push_pmc = Parrot_PackfileRawSegment_push_pmc;
+    vt->set_integer_keyed_int = Parrot_PackfileRawSegment_set_integer_keyed_int;
+    vt->set_pmc_keyed = Parrot_PackfileRawSegment_set_pmc_keyed;
+    vt->set_pointer = Parrot_PackfileRawSegment_set_pointer;
+    vt->attr_size = sizeof(Parrot_PackfileRawSegment_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_PackfileRawSegment_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->elements = Parrot_PackfileRawSegment_elements;
+    vt->get_integer = Parrot_PackfileRawSegment_get_integer;
+    vt->get_integer_keyed_int = Parrot_PackfileRawSegment_get_integer_keyed_int;
+    vt->get_number = Parrot_PackfileRawSegment_get_number;
+    vt->get_pmc_keyed = Parrot_PackfileRawSegment_get_pmc_keyed;
+    vt->get_pmc_keyed_int = Parrot_PackfileRawSegment_get_pmc_keyed_int;
+    vt->get_pointer = Parrot_PackfileRawSegment_get_pointer;
+    vt->mark = Parrot_PackfileRawSegment_mark;
+    vt->attr_size = sizeof(Parrot_PackfileRawSegment_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_PackfileRawSegment_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_PackfileSegment_get_vtable(interp);
+    Parrot_PackfileRawSegment_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_PackfileRawSegment_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_PackfileSegment_ro_get_vtable(interp);
+    Parrot_PackfileRawSegment_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_PackfileRawSegment_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+    mro = Parrot_PackfileSegment_get_mro(interp, mro);
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "PackfileRawSegment"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_PackfileRawSegment_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    isa = Parrot_PackfileSegment_get_isa(interp, isa);
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "PackfileRawSegment")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_PackfileRawSegment_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "Fdirectory Itype Fopcodes ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_PackfileRawSegment_get_vtable(interp);
+        vt->base_type      = enum_class_PackfileRawSegment;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "PackfileRawSegment");
+        vt->provides_str = CONST_STRING_GEN(interp, "scalar");
+        vt->isa_hash     = Parrot_PackfileRawSegment_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_PackfileRawSegment_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_PackfileRawSegment;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_PackfileRawSegment_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "type");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_PackfileRawSegment_nci_type),
+                method_name, signature);
+        }
+        {
+        }
+    } /* pass */
+} /* Parrot_PackfileRawSegment_class_init */
+
+#line 250 "./src/pmc/packfilerawsegment.pmc"
+
+/*
+
+=back
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
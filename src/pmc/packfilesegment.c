@@ -0,0 +1,317 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/packfilesegment.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_fixedintegerarray.h"
+#include "pmc_packfilesegment.h"
+#include "pmc_default.h"
+#include "packfilesegment.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/packfilesegment.pmc"
+/*
+Copyright (C) 2001-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/packfilesegment.pmc - PackfileSegment PMC
+
+=head1 DESCRIPTION
+
+This class implements a PackfileSegment class, an abstract class defining a
+couple of methods which all Packfile segments will implement.  The stub methods
+found here explode when called.
+
+See Packfile PMC for the toplevel Packfile interface; see PDD13 for the design
+spec.
+
+=head2 Methods
+
+=over 4
+
+=cut
+
+*/
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+#line 51 "./src/pmc/packfilesegment.c"
+static  void  * Parrot_PackfileSegment_get_pointer(SHIM_INTERP, SHIM(PMC *_self));
+static  void  Parrot_PackfileSegment_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_PackfileSegment_mark(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_PackfileSegment_set_pointer(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(void *ptr));
+static  void Parrot_PackfileSegment_nci_set_directory(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_PackfileSegment_nci_get_directory(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_PackfileSegment_class_init(PARROT_INTERP, int, int);
+void    Parrot_PackfileSegment_ro_class_init(PARROT_INTERP, int, int);
+static  void  *
+Parrot_PackfileSegment_get_pointer(SHIM_INTERP, SHIM(PMC *_self))
+{
+#line 98 "./src/pmc/packfilesegment.pmc"
+    return NULL;
+#line 65 "./src/pmc/packfilesegment.c"
+}
+static  void 
+Parrot_PackfileSegment_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 46 "./src/pmc/packfilesegment.pmc"
+
+    Parrot_PackfileSegment_attributes * const attrs =
+            PMC_data_typed(_self, Parrot_PackfileSegment_attributes*);
+
+    attrs->directory = PMCNULL;
+
+    PObj_custom_mark_SET(_self);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 79 "./src/pmc/packfilesegment.c"
+}
+static  void 
+Parrot_PackfileSegment_mark(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 65 "./src/pmc/packfilesegment.pmc"
+
+    Parrot_PackfileSegment_attributes * const attrs =
+            PARROT_PACKFILESEGMENT(_self);
+
+    Parrot_gc_mark_PMC_alive(interp, attrs->directory);
+#line 90 "./src/pmc/packfilesegment.c"
+}
+static  void 
+Parrot_PackfileSegment_set_pointer(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(void *ptr))
+{
+#line 83 "./src/pmc/packfilesegment.pmc"
+    /**/UNUSED(_self)
+    /**/UNUSED(interp)
+#line 98 "./src/pmc/packfilesegment.c"
+}
+static  void
+Parrot_PackfileSegment_nci_set_directory(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* directory;
+    
+    const INTVAL arity = 2; /* "PiP" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    directory = VTABLE_get_pmc_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 114 "./src/pmc/packfilesegment.pmc"
+
+    PARROT_PACKFILESEGMENT(_self)->directory = directory;
+#line 123 "./src/pmc/packfilesegment.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_PackfileSegment_nci_get_directory(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 127 "./src/pmc/packfilesegment.pmc"
+
+    PMC * directory = PARROT_PACKFILESEGMENT(_self)->directory;
+    if (!directory)
+        directory = PMCNULL;
+    #line 155 "./src/pmc/packfilesegment.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)directory);
+        
+        return;
+     }
+#line 131 "./src/pmc/packfilesegment.pmc"
+
+#line 163 "./src/pmc/packfilesegment.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_PackfileSegment_update_vtable(VTABLE *vt) {
+    vt->get_pointer = Parrot_PackfileSegment_get_pointer;
+    vt->init = Parrot_PackfileSegment_init;
+    vt->mark = Parrot_PackfileSegment_mark;
+    vt->set_pointer = Parrot_PackfileSegment_set_pointer;
+    vt->attr_size = sizeof(Parrot_PackfileSegment_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_PackfileSegment_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->get_pointer = Parrot_PackfileSegment_get_pointer;
+    vt->mark = Parrot_PackfileSegment_mark;
+    vt->attr_size = sizeof(Parrot_PackfileSegment_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_PackfileSegment_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_PackfileSegment_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_PackfileSegment_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_PackfileSegment_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_PackfileSegment_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "PackfileSegment"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_PackfileSegment_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "PackfileSegment")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_PackfileSegment_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "Fdirectory ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_PackfileSegment_get_vtable(interp);
+        vt->base_type      = enum_class_PackfileSegment;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "PackfileSegment");
+        vt->provides_str = CONST_STRING_GEN(interp, "scalar");
+        vt->isa_hash     = Parrot_PackfileSegment_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_PackfileSegment_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_PackfileSegment;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_PackfileSegment_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "set_directory");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_PackfileSegment_nci_set_directory),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "get_directory");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_PackfileSegment_nci_get_directory),
+                method_name, signature);
+        }
+        {
+        }
+    } /* pass */
+} /* Parrot_PackfileSegment_class_init */
+
+#line 133 "./src/pmc/packfilesegment.pmc"
+
+/*
+
+=back
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
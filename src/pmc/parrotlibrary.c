@@ -0,0 +1,282 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/parrotlibrary.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_parrotlibrary.h"
+#include "pmc_default.h"
+#include "parrotlibrary.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/parrotlibrary.pmc"
+/*
+Copyright (C) 2001-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/parrotlibrary.pmc - ParrotLibrary PMC
+
+=head1 DESCRIPTION
+
+Class for holding info about a dynamic library.
+
+Properties:
+
+    _filename               full path/file of lib
+    _ro                     true after init
+
+All ParrotLibrary PMCs are in interp->iglobals.
+
+When a dynamic library (pmc or ops) is loaded, the load function returns
+a ParrotLibrary PMC.
+
+=head2 Methods
+
+=over 4
+
+=cut
+
+*/
+
+#define PMC_dlhandle(x) ((Parrot_ParrotLibrary_attributes*)PMC_data(x))->dl_handle
+#define PMC_oplib_init(x) ((Parrot_ParrotLibrary_attributes*)PMC_data(x))->oplib_init
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+#line 58 "./src/pmc/parrotlibrary.c"
+static  PMC  * Parrot_ParrotLibrary_clone(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_ParrotLibrary_destroy(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_ParrotLibrary_get_bool(SHIM_INTERP, ARGMOD(PMC *_self));
+static  void  * Parrot_ParrotLibrary_get_pointer(SHIM_INTERP, ARGMOD(PMC *_self));
+static  STRING  * Parrot_ParrotLibrary_get_string(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_ParrotLibrary_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_ParrotLibrary_set_pointer(PARROT_INTERP, ARGMOD(PMC *_self), void *handle);
+void    Parrot_ParrotLibrary_class_init(PARROT_INTERP, int, int);
+void    Parrot_ParrotLibrary_ro_class_init(PARROT_INTERP, int, int);
+static  PMC  *
+Parrot_ParrotLibrary_clone(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 84 "./src/pmc/parrotlibrary.pmc"
+
+    PMC * const dest     = Parrot_pmc_new(interp, _self->vtable->base_type);
+
+    if (PMC_oplib_init(_self))
+        PMC_oplib_init(dest) = PMC_oplib_init(_self);
+
+    if (PMC_dlhandle(_self)) {
+        PMC_dlhandle(dest)   = PMC_dlhandle(_self);
+        PObj_custom_destroy_SET(dest);
+    }
+
+    if (!PMC_IS_NULL(PMC_metadata(_self)))
+        PMC_metadata(dest) = VTABLE_clone(interp, PMC_metadata(_self));
+
+    return dest;
+#line 87 "./src/pmc/parrotlibrary.c"
+}
+static  void 
+Parrot_ParrotLibrary_destroy(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 66 "./src/pmc/parrotlibrary.pmc"
+
+    void *dl_handle = PMC_dlhandle(_self);
+    if (dl_handle)
+        Parrot_dlclose(dl_handle);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 98 "./src/pmc/parrotlibrary.c"
+}
+static  INTVAL 
+Parrot_ParrotLibrary_get_bool(SHIM_INTERP, ARGMOD(PMC *_self))
+{
+#line 111 "./src/pmc/parrotlibrary.pmc"
+    return (PMC_dlhandle(_self) != NULL);
+#line 105 "./src/pmc/parrotlibrary.c"
+}
+static  void  *
+Parrot_ParrotLibrary_get_pointer(SHIM_INTERP, ARGMOD(PMC *_self))
+{
+#line 143 "./src/pmc/parrotlibrary.pmc"
+    return PMC_dlhandle(_self);
+#line 112 "./src/pmc/parrotlibrary.c"
+}
+static  STRING  *
+Parrot_ParrotLibrary_get_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 126 "./src/pmc/parrotlibrary.pmc"
+
+    STRING * const key  = CONST_STRING(interp, "_filename");
+    PMC    * const prop = Parrot_pmc_getprop(interp, _self, key);
+
+    return VTABLE_get_string(interp, prop);
+#line 123 "./src/pmc/parrotlibrary.c"
+}
+static  void 
+Parrot_ParrotLibrary_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 51 "./src/pmc/parrotlibrary.pmc"
+
+    /**/UNUSED(_self)
+    /**/UNUSED(interp)
+#line 132 "./src/pmc/parrotlibrary.c"
+}
+static  void 
+Parrot_ParrotLibrary_set_pointer(PARROT_INTERP, ARGMOD(PMC *_self), void *handle)
+{
+#line 158 "./src/pmc/parrotlibrary.pmc"
+
+    PMC_dlhandle(_self) = handle;
+    PObj_custom_destroy_SET(_self);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 142 "./src/pmc/parrotlibrary.c"
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_ParrotLibrary_update_vtable(VTABLE *vt) {
+    vt->clone = Parrot_ParrotLibrary_clone;
+    vt->destroy = Parrot_ParrotLibrary_destroy;
+    vt->get_bool = Parrot_ParrotLibrary_get_bool;
+    vt->get_pointer = Parrot_ParrotLibrary_get_pointer;
+    vt->get_string = Parrot_ParrotLibrary_get_string;
+    vt->init = Parrot_ParrotLibrary_init;
+    vt->set_pointer = Parrot_ParrotLibrary_set_pointer;
+    vt->attr_size = sizeof(Parrot_ParrotLibrary_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_ParrotLibrary_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->clone = Parrot_ParrotLibrary_clone;
+    vt->destroy = Parrot_ParrotLibrary_destroy;
+    vt->get_bool = Parrot_ParrotLibrary_get_bool;
+    vt->get_pointer = Parrot_ParrotLibrary_get_pointer;
+    vt->get_string = Parrot_ParrotLibrary_get_string;
+    vt->attr_size = sizeof(Parrot_ParrotLibrary_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_ParrotLibrary_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_ParrotLibrary_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_ParrotLibrary_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_ParrotLibrary_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_ParrotLibrary_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "ParrotLibrary"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_ParrotLibrary_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "ParrotLibrary")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_ParrotLibrary_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        ":dl_handle :oplib_init ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_ParrotLibrary_get_vtable(interp);
+        vt->base_type      = enum_class_ParrotLibrary;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "ParrotLibrary");
+        vt->provides_str = CONST_STRING_GEN(interp, "library");
+        vt->isa_hash     = Parrot_ParrotLibrary_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_ParrotLibrary_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_ParrotLibrary;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_ParrotLibrary_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+        }
+    } /* pass */
+} /* Parrot_ParrotLibrary_class_init */
+
+#line 161 "./src/pmc/parrotlibrary.pmc"
+
+
+/*
+
+=back
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
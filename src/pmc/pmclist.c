@@ -0,0 +1,869 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/pmclist.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_fixedintegerarray.h"
+#include "pmc_pmclist.h"
+#include "pmc_default.h"
+#include "pmclist.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/pmclist.pmc"
+/*
+Copyright (C) 2010-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/pmclist.pmc - PMCList PMC
+
+=head1 DESCRIPTION
+
+A doubly linked list of PMCs, for when push, pop, shift, and unshift
+all want to be O(1).
+
+=head2 Vtable Functions
+
+=over 4
+
+=cut
+
+*/
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+PARROT_DOES_NOT_RETURN
+static void throw_pop_empty(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+PARROT_DOES_NOT_RETURN
+static void throw_shift_empty(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+#define ASSERT_ARGS_throw_pop_empty __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_throw_shift_empty __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+
+/* It's a doubly linked list */
+typedef struct PMC_List_Item {
+    PMC *data;
+    struct PMC_List_Item *prev;
+    struct PMC_List_Item *next;
+} PMC_List_Item;
+#line 70 "./src/pmc/pmclist.c"
+static  PMC  * Parrot_PMCList_clone(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_PMCList_destroy(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_PMCList_elements(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_PMCList_freeze(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+static  INTVAL  Parrot_PMCList_get_integer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING  * Parrot_PMCList_get_repr(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING  * Parrot_PMCList_get_string(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_PMCList_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_PMCList_mark(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC  * Parrot_PMCList_pop_pmc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_PMCList_push_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  PMC  * Parrot_PMCList_shift_pmc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_PMCList_thaw(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+static  void  Parrot_PMCList_unshift_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void  Parrot_PMCList_visit(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+static  void Parrot_PMCList_nci_shift(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_PMCList_nci_pop(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_PMCList_nci_unshift(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_PMCList_nci_push(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_PMCList_nci_insert_by_number(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_PMCList_class_init(PARROT_INTERP, int, int);
+void    Parrot_PMCList_ro_class_init(PARROT_INTERP, int, int);
+static  PMC  *
+Parrot_PMCList_clone(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 310 "./src/pmc/pmclist.pmc"
+
+    PMC * const copy = Parrot_pmc_new(interp, _self->vtable->base_type);
+    void* tmp;
+    PMC_List_Item *it;
+
+    GETATTR_PMCList_head(interp, _self, tmp);
+    it = (PMC_List_Item*) tmp;
+
+    while (it != NULL) {
+        VTABLE_push_pmc(interp, copy, it->data);
+        it = it->next;
+    }
+
+    return copy;
+#line 111 "./src/pmc/pmclist.c"
+}
+static  void 
+Parrot_PMCList_destroy(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 82 "./src/pmc/pmclist.pmc"
+
+    void *tmp;
+    PMC_List_Item *aa;
+
+    GETATTR_PMCList_head(interp, _self, tmp);
+    aa = (PMC_List_Item*) tmp;
+
+    while (aa != NULL) {
+        PMC_List_Item * const bb = aa;
+        aa = aa->next;
+        free(bb);
+    }
+#line 129 "./src/pmc/pmclist.c"
+}
+static  INTVAL 
+Parrot_PMCList_elements(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 112 "./src/pmc/pmclist.pmc"
+
+    INTVAL size;
+    GETATTR_PMCList_size(interp, _self, size);
+    return size;
+#line 139 "./src/pmc/pmclist.c"
+}
+static  void 
+Parrot_PMCList_freeze(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 395 "./src/pmc/pmclist.pmc"
+
+    interp->vtables[enum_class_default]->freeze(interp, _self, info);
+    VTABLE_push_integer(interp, info, VTABLE_get_integer(interp, _self));
+#line 148 "./src/pmc/pmclist.c"
+}
+static  INTVAL 
+Parrot_PMCList_get_integer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 106 "./src/pmc/pmclist.pmc"
+
+    INTVAL size;
+    GETATTR_PMCList_size(interp, _self, size);
+    return size;
+#line 158 "./src/pmc/pmclist.c"
+}
+static  STRING  *
+Parrot_PMCList_get_repr(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 338 "./src/pmc/pmclist.pmc"
+
+    PMC_List_Item *it;
+    void* tmp;
+    STRING *res = CONST_STRING(interp, "[ ");
+    STRING * const space = CONST_STRING(interp, " ");
+
+    GETATTR_PMCList_head(interp, _self, tmp);
+    it = (PMC_List_Item*) tmp;
+
+    while (it != NULL) {
+        res = Parrot_str_concat(interp, res, VTABLE_get_repr(interp, it->data));
+        res = Parrot_str_concat(interp, res, space);
+        it = it->next;
+    }
+
+    return Parrot_str_concat(interp, res, CONST_STRING(interp, "]"));
+#line 180 "./src/pmc/pmclist.c"
+}
+static  STRING  *
+Parrot_PMCList_get_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 356 "./src/pmc/pmclist.pmc"
+
+    return VTABLE_get_repr(interp, _self);
+#line 188 "./src/pmc/pmclist.c"
+}
+static  void 
+Parrot_PMCList_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 63 "./src/pmc/pmclist.pmc"
+
+    PObj_custom_mark_SET(_self);
+    PObj_custom_destroy_SET(_self);
+
+    SETATTR_PMCList_head(interp, _self, NULL);
+    SETATTR_PMCList_foot(interp, _self, NULL);
+    SETATTR_PMCList_size(interp, _self, 0);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 202 "./src/pmc/pmclist.c"
+}
+static  void 
+Parrot_PMCList_mark(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 420 "./src/pmc/pmclist.pmc"
+
+    void* tmp;
+    PMC_List_Item *it;
+
+    GETATTR_PMCList_head(interp, _self, tmp);
+    it = (PMC_List_Item*) tmp;
+
+    while (it != NULL) {
+        if (!PObj_is_PMC_TEST(it->data))
+            PANIC(interp, "PMCList: Pointer is not a valid PMC");
+
+        Parrot_gc_mark_PMC_alive(interp, it->data);
+        it = it->next;
+    }
+#line 222 "./src/pmc/pmclist.c"
+}
+static  PMC  *
+Parrot_PMCList_pop_pmc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 219 "./src/pmc/pmclist.pmc"
+
+    INTVAL size;
+    void *tmp;
+    PMC_List_Item *foot;
+    PMC_List_Item *item;
+    PMC *data;
+
+    GETATTR_PMCList_size(interp, _self, size);
+
+    if (0 >= size)
+        throw_pop_empty(interp);
+
+    GETATTR_PMCList_foot(interp, _self, tmp);
+    item = (PMC_List_Item*) tmp;
+
+    data = item->data;
+
+    size -= 1;
+    SETATTR_PMCList_size(interp, _self, size);
+
+    foot = item->prev;
+    SETATTR_PMCList_foot(interp, _self, foot);
+
+    if (foot == NULL) {
+        /* size == 0 */
+        SETATTR_PMCList_head(interp, _self, NULL);
+    }
+    else {
+        foot->next = NULL;
+    }
+
+    if (size == 1) {
+        foot->prev = NULL;
+        SETATTR_PMCList_head(interp, _self, foot);
+    }
+
+    free(item);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    return data;
+#line 268 "./src/pmc/pmclist.c"
+}
+static  void 
+Parrot_PMCList_push_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 180 "./src/pmc/pmclist.pmc"
+
+    INTVAL size;
+    void *tmp;
+    PMC_List_Item *foot;
+    PMC_List_Item *item;
+
+    GETATTR_PMCList_size(interp, _self, size);
+    GETATTR_PMCList_foot(interp, _self, tmp);
+    foot = (PMC_List_Item*) tmp;
+
+    item = (PMC_List_Item*) malloc(sizeof (PMC_List_Item));
+    item->next = NULL;
+    item->prev = foot;
+    item->data = value;
+
+    if (foot)
+        foot->next = item;
+
+    size += 1;
+
+    SETATTR_PMCList_foot(interp, _self, item);
+    SETATTR_PMCList_size(interp, _self, size);
+
+    if (size == 1)
+        SETATTR_PMCList_head(interp, _self, item);
+
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 302 "./src/pmc/pmclist.c"
+}
+static  PMC  *
+Parrot_PMCList_shift_pmc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 128 "./src/pmc/pmclist.pmc"
+
+    INTVAL size;
+    void *tmp;
+    PMC_List_Item *head;
+    PMC_List_Item *item;
+    PMC *data;
+
+    GETATTR_PMCList_size(interp, _self, size);
+
+    if (0 >= size)
+        throw_shift_empty(interp);
+
+    GETATTR_PMCList_head(interp, _self, tmp);
+    item = (PMC_List_Item*) tmp;
+
+    data = item->data;
+
+    size -= 1;
+    SETATTR_PMCList_size(interp, _self, size);
+
+    head = item->next;
+    SETATTR_PMCList_head(interp, _self, head);
+
+    if (head == NULL) {
+        /* size == 0 */
+        SETATTR_PMCList_foot(interp, _self, NULL);
+    }
+    else {
+        head->prev = NULL;
+    }
+
+    if (size == 1) {
+        head->next = NULL;
+        SETATTR_PMCList_foot(interp, _self, head);
+    }
+
+    free(item);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    return data;
+#line 348 "./src/pmc/pmclist.c"
+}
+static  void 
+Parrot_PMCList_thaw(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 400 "./src/pmc/pmclist.pmc"
+
+    int n, i;
+    interp->vtables[enum_class_default]->thaw(interp, _self, info);
+    n = VTABLE_shift_integer(interp, info);
+    SETATTR_PMCList_size(interp, _self, n);
+
+    for (i = 0; i < n; ++i)
+        VTABLE_push_pmc(interp, _self, PMCNULL);
+#line 362 "./src/pmc/pmclist.c"
+}
+static  void 
+Parrot_PMCList_unshift_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 271 "./src/pmc/pmclist.pmc"
+
+    INTVAL size;
+    void *tmp;
+    PMC_List_Item *head;
+    PMC_List_Item *item;
+
+    GETATTR_PMCList_size(interp, _self, size);
+    GETATTR_PMCList_head(interp, _self, tmp);
+    head = (PMC_List_Item*) tmp;
+
+    item = (PMC_List_Item*) malloc(sizeof (PMC_List_Item));
+    item->prev = NULL;
+    item->next = head;
+    item->data = value;
+
+    if (head)
+        head->prev = item;
+
+    size += 1;
+
+    SETATTR_PMCList_head(interp, _self, item);
+    SETATTR_PMCList_size(interp, _self, size);
+
+    if (size == 1)
+        SETATTR_PMCList_foot(interp, _self, item);
+
+    return;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 396 "./src/pmc/pmclist.c"
+}
+static  void 
+Parrot_PMCList_visit(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 381 "./src/pmc/pmclist.pmc"
+
+    void* tmp;
+    PMC_List_Item *it;
+
+    GETATTR_PMCList_head(interp, _self, tmp);
+    it = (PMC_List_Item*) tmp;
+
+    while (it != NULL) {
+        VISIT_PMC(interp, info, it->data);
+        it = it->next;
+    }
+    interp->vtables[enum_class_default]->visit(interp, _self, info);
+#line 414 "./src/pmc/pmclist.c"
+}
+static  void
+Parrot_PMCList_nci_shift(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 450 "./src/pmc/pmclist.pmc"
+
+    PMC * const value = VTABLE_shift_pmc(interp, _self);
+    #line 437 "./src/pmc/pmclist.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)value);
+        
+        return;
+     }
+#line 452 "./src/pmc/pmclist.pmc"
+
+#line 445 "./src/pmc/pmclist.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_PMCList_nci_pop(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 455 "./src/pmc/pmclist.pmc"
+
+    PMC * const value = VTABLE_pop_pmc(interp, _self);
+    #line 475 "./src/pmc/pmclist.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)value);
+        
+        return;
+     }
+#line 457 "./src/pmc/pmclist.pmc"
+
+#line 483 "./src/pmc/pmclist.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_PMCList_nci_unshift(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* value;
+    
+    const INTVAL arity = 2; /* "PiP" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    value = VTABLE_get_pmc_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 472 "./src/pmc/pmclist.pmc"
+
+    VTABLE_unshift_pmc(interp, _self, value);
+#line 515 "./src/pmc/pmclist.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_PMCList_nci_push(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* value;
+    
+    const INTVAL arity = 2; /* "PiP" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    value = VTABLE_get_pmc_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 476 "./src/pmc/pmclist.pmc"
+
+    VTABLE_push_pmc(interp, _self, value);
+#line 547 "./src/pmc/pmclist.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_PMCList_nci_insert_by_number(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* value;
+    
+    const INTVAL arity = 2; /* "PiP" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    value = VTABLE_get_pmc_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 490 "./src/pmc/pmclist.pmc"
+
+    Parrot_pmc_list_insert_by_number(interp, _self, value);
+#line 579 "./src/pmc/pmclist.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_PMCList_update_vtable(VTABLE *vt) {
+    vt->clone = Parrot_PMCList_clone;
+    vt->destroy = Parrot_PMCList_destroy;
+    vt->elements = Parrot_PMCList_elements;
+    vt->freeze = Parrot_PMCList_freeze;
+    vt->get_integer = Parrot_PMCList_get_integer;
+    vt->get_repr = Parrot_PMCList_get_repr;
+    vt->get_string = Parrot_PMCList_get_string;
+    vt->init = Parrot_PMCList_init;
+    vt->mark = Parrot_PMCList_mark;
+    vt->pop_pmc = Parrot_PMCList_pop_pmc;
+    vt->push_pmc = Parrot_PMCList_push_pmc;
+    vt->shift_pmc = Parrot_PMCList_shift_pmc;
+    vt->thaw = Parrot_PMCList_thaw;
+    vt->unshift_pmc = Parrot_PMCList_unshift_pmc;
+    vt->visit = Parrot_PMCList_visit;
+    vt->attr_size = sizeof(Parrot_PMCList_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_PMCList_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->clone = Parrot_PMCList_clone;
+    vt->destroy = Parrot_PMCList_destroy;
+    vt->elements = Parrot_PMCList_elements;
+    vt->freeze = Parrot_PMCList_freeze;
+    vt->get_integer = Parrot_PMCList_get_integer;
+    vt->get_repr = Parrot_PMCList_get_repr;
+    vt->get_string = Parrot_PMCList_get_string;
+    vt->mark = Parrot_PMCList_mark;
+    vt->visit = Parrot_PMCList_visit;
+    vt->attr_size = sizeof(Parrot_PMCList_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_PMCList_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_PMCList_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_PMCList_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_PMCList_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_PMCList_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "PMCList"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_PMCList_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "PMCList")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_PMCList_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        ":head :foot Isize ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_PMCList_get_vtable(interp);
+        vt->base_type      = enum_class_PMCList;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "PMCList");
+        vt->provides_str = CONST_STRING_GEN(interp, "scalar");
+        vt->isa_hash     = Parrot_PMCList_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_PMCList_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_PMCList;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_PMCList_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "shift");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_PMCList_nci_shift),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "pop");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_PMCList_nci_pop),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "unshift");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_PMCList_nci_unshift),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "push");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_PMCList_nci_push),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "insert_by_number");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_PMCList_nci_insert_by_number),
+                method_name, signature);
+        }
+        {
+        }
+    } /* pass */
+} /* Parrot_PMCList_class_init */
+
+#line 493 "./src/pmc/pmclist.pmc"
+
+
+/*
+
+=back
+
+=head2 Auxiliary functions
+
+=over 4
+
+=item C<void Parrot_pmc_list_insert_by_number(PARROT_INTERP, PMC *list, PMC
+*value)>
+
+Insert an item into a sorted list by its num value.
+
+=cut
+
+*/
+
+
+PARROT_EXPORT
+void
+Parrot_pmc_list_insert_by_number(PARROT_INTERP, PMC *list, PMC *value)
+{
+    void *tmp;
+    PMC_List_Item *item;
+    FLOATVAL vkey;
+    int size;
+
+    GETATTR_PMCList_size(interp, list, size);
+    GETATTR_PMCList_head(interp, list, tmp);
+
+    item = (PMC_List_Item*) malloc(sizeof (PMC_List_Item));
+    item->data = value;
+    item->next = (PMC_List_Item*) tmp;
+    item->prev = NULL;
+
+    vkey = VTABLE_get_number(interp, value);
+
+    /* Find the list item to insert before */
+    while (item->next != NULL) {
+        const FLOATVAL ikey = VTABLE_get_number(interp, item->next->data);
+        if (ikey > vkey)
+            break;
+        item->prev = item->next;
+        item->next = item->next->next;
+    }
+
+    if (item->next == NULL) {
+        SETATTR_PMCList_foot(interp, list, item);
+    }
+    else {
+        item->next->prev = item;
+    }
+
+    if (item->prev == NULL) {
+        SETATTR_PMCList_head(interp, list, item);
+    }
+    else {
+        item->prev->next = item;
+    }
+
+    SETATTR_PMCList_size(interp, list, size + 1);
+}
+
+/*
+=item C<static void throw_shift_empty(PARROT_INTERP)>
+
+=item C<static void throw_pop_empty(PARROT_INTERP)>
+
+Throws with the appropiate message.
+
+=cut
+
+*/
+
+PARROT_DOES_NOT_RETURN
+static void
+throw_shift_empty(PARROT_INTERP)
+{
+    ASSERT_ARGS(throw_shift_empty)
+    Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_OUT_OF_BOUNDS,
+            "PMCList: Can't shift from an empty list!");
+}
+
+PARROT_DOES_NOT_RETURN
+static void
+throw_pop_empty(PARROT_INTERP)
+{
+    ASSERT_ARGS(throw_pop_empty)
+    Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_OUT_OF_BOUNDS,
+            "PMCList: Can't pop from an empty list!");
+}
+
+/*
+
+=back
+
+=head1 See also
+
+F<docs/pdds/pdd17_basic_types.pod>.
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
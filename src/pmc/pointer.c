@@ -0,0 +1,300 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/pointer.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_pointer.h"
+#include "pmc_default.h"
+#include "pointer.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/pointer.pmc"
+/*
+Copyright (C) 2001-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/pointer.pmc - Pointer PMC
+
+=head1 DESCRIPTION
+
+These are the vtable functions for the Pointer base class.
+
+The actual pointer is in C<PMC_data>.
+
+=head2 Methods
+
+=over 4
+
+=cut
+
+*/
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+#line 47 "./src/pmc/pointer.c"
+static  PMC  * Parrot_Pointer_clone(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_Pointer_get_bool(SHIM_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_Pointer_get_integer(SHIM_INTERP, ARGMOD(PMC *_self));
+static  FLOATVAL  Parrot_Pointer_get_number(SHIM_INTERP, ARGMOD(PMC *_self));
+static  void  * Parrot_Pointer_get_pointer(SHIM_INTERP, ARGMOD(PMC *_self));
+static  STRING  * Parrot_Pointer_get_repr(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING  * Parrot_Pointer_get_string(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Pointer_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_Pointer_is_same(SHIM_INTERP, ARGMOD(PMC *_self), PMC *pmc2);
+static  void  Parrot_Pointer_mark(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Pointer_set_pointer(PARROT_INTERP, ARGMOD(PMC *_self), void *ptr);
+void    Parrot_Pointer_class_init(PARROT_INTERP, int, int);
+void    Parrot_Pointer_ro_class_init(PARROT_INTERP, int, int);
+static  PMC  *
+Parrot_Pointer_clone(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 72 "./src/pmc/pointer.pmc"
+
+    PMC * const dest = Parrot_pmc_new_noinit(interp, _self->vtable->base_type);
+    PObj_custom_mark_SET(dest);
+    PMC_data(dest) = PMC_data(_self);
+    return dest;
+#line 70 "./src/pmc/pointer.c"
+}
+static  INTVAL 
+Parrot_Pointer_get_bool(SHIM_INTERP, ARGMOD(PMC *_self))
+{
+#line 177 "./src/pmc/pointer.pmc"
+    return (INTVAL)(PMC_data(_self) != NULL);
+#line 77 "./src/pmc/pointer.c"
+}
+static  INTVAL 
+Parrot_Pointer_get_integer(SHIM_INTERP, ARGMOD(PMC *_self))
+{
+#line 118 "./src/pmc/pointer.pmc"
+    return (INTVAL)(PARROT_POINTER(_self)->pointer);
+#line 84 "./src/pmc/pointer.c"
+}
+static  FLOATVAL 
+Parrot_Pointer_get_number(SHIM_INTERP, ARGMOD(PMC *_self))
+{
+#line 133 "./src/pmc/pointer.pmc"
+    return (FLOATVAL)(INTVAL)(PARROT_POINTER(_self)->pointer);
+#line 91 "./src/pmc/pointer.c"
+}
+static  void  *
+Parrot_Pointer_get_pointer(SHIM_INTERP, ARGMOD(PMC *_self))
+{
+#line 103 "./src/pmc/pointer.pmc"
+    return PARROT_POINTER(_self)->pointer;
+#line 98 "./src/pmc/pointer.c"
+}
+static  STRING  *
+Parrot_Pointer_get_repr(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 148 "./src/pmc/pointer.pmc"
+
+    return Parrot_sprintf_c(interp, "Pointer = 0x%p", PARROT_POINTER(_self)->pointer);
+#line 106 "./src/pmc/pointer.c"
+}
+static  STRING  *
+Parrot_Pointer_get_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 163 "./src/pmc/pointer.pmc"
+
+    return Parrot_sprintf_c(interp, "%s", PARROT_POINTER(_self)->pointer);
+#line 114 "./src/pmc/pointer.c"
+}
+static  void 
+Parrot_Pointer_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 40 "./src/pmc/pointer.pmc"
+
+    PObj_custom_mark_SET(_self);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 123 "./src/pmc/pointer.c"
+}
+static  INTVAL 
+Parrot_Pointer_is_same(SHIM_INTERP, ARGMOD(PMC *_self), PMC *pmc2)
+{
+#line 192 "./src/pmc/pointer.pmc"
+    return (INTVAL)(_self->vtable   == pmc2->vtable &&
+                    PARROT_POINTER(_self)->pointer == PARROT_POINTER(pmc2)->pointer);
+#line 131 "./src/pmc/pointer.c"
+}
+static  void 
+Parrot_Pointer_mark(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 54 "./src/pmc/pointer.pmc"
+
+    void (*mark_function)(Interp *, void *) =
+        (void (*)(Interp *, void *))D2FPTR(PARROT_POINTER(_self)->mark_function);
+    void * const data = PARROT_POINTER(_self)->pointer;
+    if (data && mark_function)
+        (*mark_function)(interp, data);
+#line 143 "./src/pmc/pointer.c"
+}
+static  void 
+Parrot_Pointer_set_pointer(PARROT_INTERP, ARGMOD(PMC *_self), void *ptr)
+{
+#line 89 "./src/pmc/pointer.pmc"
+
+    PARROT_POINTER(_self)->pointer = ptr;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 152 "./src/pmc/pointer.c"
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_Pointer_update_vtable(VTABLE *vt) {
+    vt->clone = Parrot_Pointer_clone;
+    vt->get_bool = Parrot_Pointer_get_bool;
+    vt->get_integer = Parrot_Pointer_get_integer;
+    vt->get_number = Parrot_Pointer_get_number;
+    vt->get_pointer = Parrot_Pointer_get_pointer;
+    vt->get_repr = Parrot_Pointer_get_repr;
+    vt->get_string = Parrot_Pointer_get_string;
+    vt->init = Parrot_Pointer_init;
+    vt->is_same = Parrot_Pointer_is_same;
+    vt->mark = Parrot_Pointer_mark;
+    vt->set_pointer = Parrot_Pointer_set_pointer;
+    vt->attr_size = sizeof(Parrot_Pointer_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_Pointer_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->clone = Parrot_Pointer_clone;
+    vt->get_bool = Parrot_Pointer_get_bool;
+    vt->get_integer = Parrot_Pointer_get_integer;
+    vt->get_number = Parrot_Pointer_get_number;
+    vt->get_pointer = Parrot_Pointer_get_pointer;
+    vt->get_repr = Parrot_Pointer_get_repr;
+    vt->get_string = Parrot_Pointer_get_string;
+    vt->is_same = Parrot_Pointer_is_same;
+    vt->mark = Parrot_Pointer_mark;
+    vt->attr_size = sizeof(Parrot_Pointer_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Pointer_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_Pointer_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Pointer_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_Pointer_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_Pointer_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "Pointer"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_Pointer_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "Pointer")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_Pointer_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        ":mark_function :pointer ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_Pointer_get_vtable(interp);
+        vt->base_type      = enum_class_Pointer;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "Pointer");
+        vt->provides_str = CONST_STRING_GEN(interp, "scalar");
+        vt->isa_hash     = Parrot_Pointer_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_Pointer_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_Pointer;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_Pointer_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+        }
+    } /* pass */
+} /* Parrot_Pointer_class_init */
+
+#line 196 "./src/pmc/pointer.pmc"
+
+
+/*
+
+=back
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
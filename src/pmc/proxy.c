@@ -0,0 +1,2637 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/proxy.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_proxy.h"
+#include "pmc_default.h"
+#include "proxy.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/proxy.pmc"
+/*
+Copyright (C) 2011-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/proxy.pmc - Proxy PMC
+
+=head1 DESCRIPTION
+
+Proxy objects are generated automatically and are used to protect objects from
+being written to directly by other threads.
+
+All methods which are not defined here get a default implementation
+generated from F<src/vtable.tbl> by F<tools/build/pmc2c.pl>.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+ */
+
+#include "parrot/parrot.h"
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static STRING * caller(PARROT_INTERP, ARGIN_NULLOK(PMC *pmc))
+        __attribute__nonnull__(1);
+
+PARROT_DOES_NOT_RETURN
+static void cant_do_write_method(PARROT_INTERP,
+    ARGIN_NULLOK(PMC *pmc),
+    int index)
+        __attribute__nonnull__(1);
+
+#define ASSERT_ARGS_caller __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_cant_do_write_method __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+/*
+
+=item C<static STRING * caller(PARROT_INTERP, PMC *pmc)>
+
+Returns a C string for the name of C<*pmc>.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static STRING *
+caller(PARROT_INTERP, ARGIN_NULLOK(PMC *pmc))
+{
+    ASSERT_ARGS(caller)
+
+    return !PMC_IS_NULL(pmc) && pmc->vtable && pmc->vtable->whoami
+                ? VTABLE_name(interp, pmc)
+                : CONST_STRING(interp, "(null)");
+}
+
+/*
+
+=item C<static void cant_do_write_method(PARROT_INTERP, PMC *pmc, int index)>
+
+Throws an exception "$methname() on read-only instance of '$class'", used by
+all updating messages on read-only instances.
+
+=cut
+
+*/
+
+PARROT_DOES_NOT_RETURN
+static void
+cant_do_write_method(PARROT_INTERP, ARGIN_NULLOK(PMC *pmc), int index)
+{
+    ASSERT_ARGS(cant_do_write_method)
+
+    Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_WRITE_TO_CONSTCLASS,
+            "%s() in read-only proxy of '%Ss'",
+            Parrot_get_vtable_name(interp, index),
+            caller(interp, pmc));
+}
+#line 114 "./src/pmc/proxy.c"
+static  PMC * Parrot_Proxy_absolute(PARROT_INTERP, ARGMOD(PMC *_self), PMC *dest);
+static  PMC * Parrot_Proxy_add(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest);
+static  void Parrot_Proxy_add_attribute(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *name), SHIM(PMC *type));
+static  PMC * Parrot_Proxy_add_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest);
+static  PMC * Parrot_Proxy_add_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest);
+static  void Parrot_Proxy_add_method(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *method_name), SHIM(PMC *sub_pmc));
+static  void Parrot_Proxy_add_parent(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *parent));
+static  void Parrot_Proxy_add_role(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *role));
+static  void Parrot_Proxy_add_vtable_override(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *vtable_name), SHIM(PMC *sub_pmc));
+static  void Parrot_Proxy_assign_pmc(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value));
+static  void Parrot_Proxy_assign_string_native(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *value));
+static  PMC * Parrot_Proxy_clone(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC * Parrot_Proxy_clone_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *args);
+static  INTVAL Parrot_Proxy_cmp(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  INTVAL Parrot_Proxy_cmp_num(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  PMC * Parrot_Proxy_cmp_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  INTVAL Parrot_Proxy_cmp_string(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  PMC * Parrot_Proxy_concatenate(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest);
+static  PMC * Parrot_Proxy_concatenate_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value, PMC *dest);
+static  void Parrot_Proxy_decrement(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL Parrot_Proxy_defined(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL Parrot_Proxy_defined_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  INTVAL Parrot_Proxy_defined_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  INTVAL Parrot_Proxy_defined_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key);
+static  void Parrot_Proxy_delete_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key));
+static  void Parrot_Proxy_delete_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL key));
+static  void Parrot_Proxy_delete_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key));
+static  void Parrot_Proxy_destroy(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC * Parrot_Proxy_divide(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest);
+static  PMC * Parrot_Proxy_divide_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest);
+static  PMC * Parrot_Proxy_divide_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest);
+static  INTVAL Parrot_Proxy_does(PARROT_INTERP, ARGMOD(PMC *_self), STRING *role);
+static  INTVAL Parrot_Proxy_does_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *role);
+static  INTVAL Parrot_Proxy_elements(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL Parrot_Proxy_exists_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  INTVAL Parrot_Proxy_exists_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  INTVAL Parrot_Proxy_exists_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key);
+static  PMC  * Parrot_Proxy_find_method(SHIM_INTERP, ARGMOD(PMC *_self), STRING *method_name);
+static  PMC * Parrot_Proxy_floor_divide(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest);
+static  PMC * Parrot_Proxy_floor_divide_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest);
+static  PMC * Parrot_Proxy_floor_divide_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest);
+static  void Parrot_Proxy_freeze(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+static  PMC * Parrot_Proxy_get_attr_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, STRING *idx);
+static  PMC * Parrot_Proxy_get_attr_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *idx);
+static  INTVAL Parrot_Proxy_get_bool(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC * Parrot_Proxy_get_class(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL Parrot_Proxy_get_integer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL Parrot_Proxy_get_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  INTVAL Parrot_Proxy_get_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  INTVAL Parrot_Proxy_get_integer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key);
+static  PMC * Parrot_Proxy_get_iter(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC * Parrot_Proxy_get_namespace(PARROT_INTERP, ARGMOD(PMC *_self));
+static  FLOATVAL Parrot_Proxy_get_number(PARROT_INTERP, ARGMOD(PMC *_self));
+static  FLOATVAL Parrot_Proxy_get_number_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  FLOATVAL Parrot_Proxy_get_number_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  FLOATVAL Parrot_Proxy_get_number_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key);
+static  PMC * Parrot_Proxy_get_pmc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC * Parrot_Proxy_get_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  PMC * Parrot_Proxy_get_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  PMC * Parrot_Proxy_get_pmc_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key);
+static  void * Parrot_Proxy_get_pointer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void * Parrot_Proxy_get_pointer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  void * Parrot_Proxy_get_pointer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  void  * Parrot_Proxy_get_pointer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key);
+static  STRING * Parrot_Proxy_get_repr(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING * Parrot_Proxy_get_string(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING * Parrot_Proxy_get_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  STRING * Parrot_Proxy_get_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key);
+static  STRING * Parrot_Proxy_get_string_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key);
+static  INTVAL Parrot_Proxy_hashvalue(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Proxy_i_absolute(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Proxy_i_add(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value));
+static  void Parrot_Proxy_i_add_float(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(FLOATVAL value));
+static  void Parrot_Proxy_i_add_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL value));
+static  void Parrot_Proxy_i_concatenate(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value));
+static  void Parrot_Proxy_i_concatenate_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *value));
+static  void Parrot_Proxy_i_divide(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value));
+static  void Parrot_Proxy_i_divide_float(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(FLOATVAL value));
+static  void Parrot_Proxy_i_divide_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL value));
+static  void Parrot_Proxy_i_floor_divide(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value));
+static  void Parrot_Proxy_i_floor_divide_float(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(FLOATVAL value));
+static  void Parrot_Proxy_i_floor_divide_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL value));
+static  void Parrot_Proxy_i_modulus(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value));
+static  void Parrot_Proxy_i_modulus_float(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(FLOATVAL value));
+static  void Parrot_Proxy_i_modulus_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL value));
+static  void Parrot_Proxy_i_multiply(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value));
+static  void Parrot_Proxy_i_multiply_float(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(FLOATVAL value));
+static  void Parrot_Proxy_i_multiply_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL value));
+static  void Parrot_Proxy_i_neg(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Proxy_i_repeat(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value));
+static  void Parrot_Proxy_i_repeat_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL value));
+static  void Parrot_Proxy_i_subtract(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value));
+static  void Parrot_Proxy_i_subtract_float(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(FLOATVAL value));
+static  void Parrot_Proxy_i_subtract_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL value));
+static  void Parrot_Proxy_increment(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Proxy_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Proxy_init_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL initializer));
+static  void  Parrot_Proxy_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *target);
+static  PMC * Parrot_Proxy_inspect(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC * Parrot_Proxy_inspect_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *what);
+static  PMC  * Parrot_Proxy_instantiate(PARROT_INTERP, ARGMOD(PMC *_self), PMC *init);
+static  opcode_t * Parrot_Proxy_invoke(PARROT_INTERP, ARGMOD(PMC *_self), void *next);
+static  INTVAL Parrot_Proxy_is_equal(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  INTVAL Parrot_Proxy_is_equal_num(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  INTVAL Parrot_Proxy_is_equal_string(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  INTVAL Parrot_Proxy_is_same(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  INTVAL Parrot_Proxy_isa(PARROT_INTERP, ARGMOD(PMC *_self), STRING *_class);
+static  INTVAL Parrot_Proxy_isa_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *_class);
+static  void  Parrot_Proxy_mark(SHIM_INTERP, SHIM(PMC *_self));
+static  PMC * Parrot_Proxy_modulus(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest);
+static  PMC * Parrot_Proxy_modulus_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest);
+static  PMC * Parrot_Proxy_modulus_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest);
+static  void Parrot_Proxy_morph(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *type));
+static  PMC * Parrot_Proxy_multiply(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest);
+static  PMC * Parrot_Proxy_multiply_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest);
+static  PMC * Parrot_Proxy_multiply_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest);
+static  STRING * Parrot_Proxy_name(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC * Parrot_Proxy_neg(PARROT_INTERP, ARGMOD(PMC *_self), PMC *dest);
+static  FLOATVAL Parrot_Proxy_pop_float(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL Parrot_Proxy_pop_integer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC * Parrot_Proxy_pop_pmc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING * Parrot_Proxy_pop_string(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Proxy_push_float(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(FLOATVAL value));
+static  void Parrot_Proxy_push_integer(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL value));
+static  void Parrot_Proxy_push_pmc(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value));
+static  void Parrot_Proxy_push_string(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *value));
+static  void Parrot_Proxy_remove_attribute(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *name));
+static  void Parrot_Proxy_remove_method(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *method_name));
+static  void Parrot_Proxy_remove_parent(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *parent));
+static  void Parrot_Proxy_remove_role(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *role));
+static  void Parrot_Proxy_remove_vtable_override(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *vtable_name));
+static  PMC * Parrot_Proxy_repeat(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest);
+static  PMC * Parrot_Proxy_repeat_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest);
+static  void Parrot_Proxy_set_attr_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key), SHIM(STRING *idx), SHIM(PMC *value));
+static  void Parrot_Proxy_set_attr_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *idx), SHIM(PMC *value));
+static  void Parrot_Proxy_set_bool(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL value));
+static  void Parrot_Proxy_set_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key), SHIM(INTVAL value));
+static  void Parrot_Proxy_set_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL key), SHIM(INTVAL value));
+static  void Parrot_Proxy_set_integer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key), SHIM(INTVAL value));
+static  void Parrot_Proxy_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL value));
+static  void Parrot_Proxy_set_number_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key), SHIM(FLOATVAL value));
+static  void Parrot_Proxy_set_number_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL key), SHIM(FLOATVAL value));
+static  void Parrot_Proxy_set_number_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key), SHIM(FLOATVAL value));
+static  void Parrot_Proxy_set_number_native(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(FLOATVAL value));
+static  void Parrot_Proxy_set_pmc(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value));
+static  void Parrot_Proxy_set_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key), SHIM(PMC *value));
+static  void Parrot_Proxy_set_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL key), SHIM(PMC *value));
+static  void Parrot_Proxy_set_pmc_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key), SHIM(PMC *value));
+static  void Parrot_Proxy_set_pointer(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(void *value));
+static  void Parrot_Proxy_set_pointer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key), SHIM(void *value));
+static  void Parrot_Proxy_set_pointer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL key), SHIM(void *value));
+static  void Parrot_Proxy_set_pointer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key), SHIM(void *value));
+static  void Parrot_Proxy_set_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key), SHIM(STRING *value));
+static  void Parrot_Proxy_set_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL key), SHIM(STRING *value));
+static  void Parrot_Proxy_set_string_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key), SHIM(STRING *value));
+static  void Parrot_Proxy_set_string_native(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *value));
+static  void Parrot_Proxy_share(PARROT_INTERP, ARGMOD(PMC *_self));
+static  FLOATVAL Parrot_Proxy_shift_float(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL Parrot_Proxy_shift_integer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC * Parrot_Proxy_shift_pmc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING * Parrot_Proxy_shift_string(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Proxy_splice(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value), SHIM(INTVAL offset), SHIM(INTVAL count));
+static  STRING * Parrot_Proxy_substr(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL offset, INTVAL length);
+static  PMC * Parrot_Proxy_subtract(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest);
+static  PMC * Parrot_Proxy_subtract_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest);
+static  PMC * Parrot_Proxy_subtract_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest);
+static  void Parrot_Proxy_thaw(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *info));
+static  void Parrot_Proxy_thawfinish(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *info));
+static  INTVAL Parrot_Proxy_type(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Proxy_unshift_float(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(FLOATVAL value));
+static  void Parrot_Proxy_unshift_integer(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL value));
+static  void Parrot_Proxy_unshift_pmc(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value));
+static  void Parrot_Proxy_unshift_string(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *value));
+static  void Parrot_Proxy_visit(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+void    Parrot_Proxy_class_init(PARROT_INTERP, int, int);
+void    Parrot_Proxy_ro_class_init(PARROT_INTERP, int, int);
+static  PMC *
+Parrot_Proxy_absolute(PARROT_INTERP, ARGMOD(PMC *_self), PMC *dest)
+{
+    PMC * result;
+    PARROT_ASSERT(interp != PARROT_PROXY(_self)->interp);
+
+    /* block the GC to prevent it from finding foreign PMCs on the stack */
+    Parrot_block_GC_mark(interp);
+
+    Interp_flags_SET(interp, PARROT_THR_FLAG_NEW_PMC);
+    result = VTABLE_absolute(interp, PARROT_PROXY(_self)->target, dest);
+    Interp_flags_CLEAR(interp, PARROT_THR_FLAG_NEW_PMC);
+
+    if (! PMC_IS_NULL(result)) {
+        if (PObj_is_new_TEST(result)) {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp == interp);
+#endif
+            PObj_is_new_CLEAR(result);
+        }
+        else {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp != interp);
+#endif
+            result = Parrot_thread_create_proxy(PARROT_PROXY(_self)->interp, interp, result);
+        }
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    return result;
+}
+static  PMC *
+Parrot_Proxy_add(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest)
+{
+    PMC * result;
+    PARROT_ASSERT(interp != PARROT_PROXY(_self)->interp);
+
+    /* block the GC to prevent it from finding foreign PMCs on the stack */
+    Parrot_block_GC_mark(interp);
+
+    Interp_flags_SET(interp, PARROT_THR_FLAG_NEW_PMC);
+    result = VTABLE_add(interp, PARROT_PROXY(_self)->target, value, dest);
+    Interp_flags_CLEAR(interp, PARROT_THR_FLAG_NEW_PMC);
+
+    if (! PMC_IS_NULL(result)) {
+        if (PObj_is_new_TEST(result)) {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp == interp);
+#endif
+            PObj_is_new_CLEAR(result);
+        }
+        else {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp != interp);
+#endif
+            result = Parrot_thread_create_proxy(PARROT_PROXY(_self)->interp, interp, result);
+        }
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    return result;
+}
+static  void
+Parrot_Proxy_add_attribute(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *name), SHIM(PMC *type))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_ADD_ATTRIBUTE);
+}
+static  PMC *
+Parrot_Proxy_add_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest)
+{
+    PMC * result;
+    PARROT_ASSERT(interp != PARROT_PROXY(_self)->interp);
+
+    /* block the GC to prevent it from finding foreign PMCs on the stack */
+    Parrot_block_GC_mark(interp);
+
+    Interp_flags_SET(interp, PARROT_THR_FLAG_NEW_PMC);
+    result = VTABLE_add_float(interp, PARROT_PROXY(_self)->target, value, dest);
+    Interp_flags_CLEAR(interp, PARROT_THR_FLAG_NEW_PMC);
+
+    if (! PMC_IS_NULL(result)) {
+        if (PObj_is_new_TEST(result)) {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp == interp);
+#endif
+            PObj_is_new_CLEAR(result);
+        }
+        else {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp != interp);
+#endif
+            result = Parrot_thread_create_proxy(PARROT_PROXY(_self)->interp, interp, result);
+        }
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    return result;
+}
+static  PMC *
+Parrot_Proxy_add_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest)
+{
+    PMC * result;
+    PARROT_ASSERT(interp != PARROT_PROXY(_self)->interp);
+
+    /* block the GC to prevent it from finding foreign PMCs on the stack */
+    Parrot_block_GC_mark(interp);
+
+    Interp_flags_SET(interp, PARROT_THR_FLAG_NEW_PMC);
+    result = VTABLE_add_int(interp, PARROT_PROXY(_self)->target, value, dest);
+    Interp_flags_CLEAR(interp, PARROT_THR_FLAG_NEW_PMC);
+
+    if (! PMC_IS_NULL(result)) {
+        if (PObj_is_new_TEST(result)) {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp == interp);
+#endif
+            PObj_is_new_CLEAR(result);
+        }
+        else {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp != interp);
+#endif
+            result = Parrot_thread_create_proxy(PARROT_PROXY(_self)->interp, interp, result);
+        }
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    return result;
+}
+static  void
+Parrot_Proxy_add_method(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *method_name), SHIM(PMC *sub_pmc))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_ADD_METHOD);
+}
+static  void
+Parrot_Proxy_add_parent(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *parent))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_ADD_PARENT);
+}
+static  void
+Parrot_Proxy_add_role(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *role))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_ADD_ROLE);
+}
+static  void
+Parrot_Proxy_add_vtable_override(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *vtable_name), SHIM(PMC *sub_pmc))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_ADD_VTABLE_OVERRIDE);
+}
+static  void
+Parrot_Proxy_assign_pmc(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_ASSIGN_PMC);
+}
+static  void
+Parrot_Proxy_assign_string_native(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_ASSIGN_STRING_NATIVE);
+}
+static  PMC *
+Parrot_Proxy_clone(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * result;
+    PARROT_ASSERT(interp != PARROT_PROXY(_self)->interp);
+
+    /* block the GC to prevent it from finding foreign PMCs on the stack */
+    Parrot_block_GC_mark(interp);
+
+    Interp_flags_SET(interp, PARROT_THR_FLAG_NEW_PMC);
+    result = VTABLE_clone(interp, PARROT_PROXY(_self)->target);
+    Interp_flags_CLEAR(interp, PARROT_THR_FLAG_NEW_PMC);
+
+    if (! PMC_IS_NULL(result)) {
+        if (PObj_is_new_TEST(result)) {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp == interp);
+#endif
+            PObj_is_new_CLEAR(result);
+        }
+        else {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp != interp);
+#endif
+            result = Parrot_thread_create_proxy(PARROT_PROXY(_self)->interp, interp, result);
+        }
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    return result;
+}
+static  PMC *
+Parrot_Proxy_clone_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *args)
+{
+    PMC * result;
+    PARROT_ASSERT(interp != PARROT_PROXY(_self)->interp);
+
+    /* block the GC to prevent it from finding foreign PMCs on the stack */
+    Parrot_block_GC_mark(interp);
+
+    Interp_flags_SET(interp, PARROT_THR_FLAG_NEW_PMC);
+    result = VTABLE_clone_pmc(interp, PARROT_PROXY(_self)->target, args);
+    Interp_flags_CLEAR(interp, PARROT_THR_FLAG_NEW_PMC);
+
+    if (! PMC_IS_NULL(result)) {
+        if (PObj_is_new_TEST(result)) {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp == interp);
+#endif
+            PObj_is_new_CLEAR(result);
+        }
+        else {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp != interp);
+#endif
+            result = Parrot_thread_create_proxy(PARROT_PROXY(_self)->interp, interp, result);
+        }
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    return result;
+}
+static  INTVAL
+Parrot_Proxy_cmp(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+    return VTABLE_cmp(interp, PARROT_PROXY(_self)->target, value);
+}
+static  INTVAL
+Parrot_Proxy_cmp_num(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+    return VTABLE_cmp_num(interp, PARROT_PROXY(_self)->target, value);
+}
+static  PMC *
+Parrot_Proxy_cmp_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+    PMC * result;
+    PARROT_ASSERT(interp != PARROT_PROXY(_self)->interp);
+
+    /* block the GC to prevent it from finding foreign PMCs on the stack */
+    Parrot_block_GC_mark(interp);
+
+    Interp_flags_SET(interp, PARROT_THR_FLAG_NEW_PMC);
+    result = VTABLE_cmp_pmc(interp, PARROT_PROXY(_self)->target, value);
+    Interp_flags_CLEAR(interp, PARROT_THR_FLAG_NEW_PMC);
+
+    if (! PMC_IS_NULL(result)) {
+        if (PObj_is_new_TEST(result)) {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp == interp);
+#endif
+            PObj_is_new_CLEAR(result);
+        }
+        else {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp != interp);
+#endif
+            result = Parrot_thread_create_proxy(PARROT_PROXY(_self)->interp, interp, result);
+        }
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    return result;
+}
+static  INTVAL
+Parrot_Proxy_cmp_string(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+    return VTABLE_cmp_string(interp, PARROT_PROXY(_self)->target, value);
+}
+static  PMC *
+Parrot_Proxy_concatenate(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest)
+{
+    PMC * result;
+    PARROT_ASSERT(interp != PARROT_PROXY(_self)->interp);
+
+    /* block the GC to prevent it from finding foreign PMCs on the stack */
+    Parrot_block_GC_mark(interp);
+
+    Interp_flags_SET(interp, PARROT_THR_FLAG_NEW_PMC);
+    result = VTABLE_concatenate(interp, PARROT_PROXY(_self)->target, value, dest);
+    Interp_flags_CLEAR(interp, PARROT_THR_FLAG_NEW_PMC);
+
+    if (! PMC_IS_NULL(result)) {
+        if (PObj_is_new_TEST(result)) {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp == interp);
+#endif
+            PObj_is_new_CLEAR(result);
+        }
+        else {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp != interp);
+#endif
+            result = Parrot_thread_create_proxy(PARROT_PROXY(_self)->interp, interp, result);
+        }
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    return result;
+}
+static  PMC *
+Parrot_Proxy_concatenate_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value, PMC *dest)
+{
+    PMC * result;
+    PARROT_ASSERT(interp != PARROT_PROXY(_self)->interp);
+
+    /* block the GC to prevent it from finding foreign PMCs on the stack */
+    Parrot_block_GC_mark(interp);
+
+    Interp_flags_SET(interp, PARROT_THR_FLAG_NEW_PMC);
+    result = VTABLE_concatenate_str(interp, PARROT_PROXY(_self)->target, value, dest);
+    Interp_flags_CLEAR(interp, PARROT_THR_FLAG_NEW_PMC);
+
+    if (! PMC_IS_NULL(result)) {
+        if (PObj_is_new_TEST(result)) {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp == interp);
+#endif
+            PObj_is_new_CLEAR(result);
+        }
+        else {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp != interp);
+#endif
+            result = Parrot_thread_create_proxy(PARROT_PROXY(_self)->interp, interp, result);
+        }
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    return result;
+}
+static  void
+Parrot_Proxy_decrement(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_DECREMENT);
+}
+static  INTVAL
+Parrot_Proxy_defined(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    return VTABLE_defined(interp, PARROT_PROXY(_self)->target);
+}
+static  INTVAL
+Parrot_Proxy_defined_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+    return VTABLE_defined_keyed(interp, PARROT_PROXY(_self)->target, key);
+}
+static  INTVAL
+Parrot_Proxy_defined_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+    return VTABLE_defined_keyed_int(interp, PARROT_PROXY(_self)->target, key);
+}
+static  INTVAL
+Parrot_Proxy_defined_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key)
+{
+    return VTABLE_defined_keyed_str(interp, PARROT_PROXY(_self)->target, key);
+}
+static  void
+Parrot_Proxy_delete_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_DELETE_KEYED);
+}
+static  void
+Parrot_Proxy_delete_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL key))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_DELETE_KEYED_INT);
+}
+static  void
+Parrot_Proxy_delete_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_DELETE_KEYED_STR);
+}
+static  void
+Parrot_Proxy_destroy(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    VTABLE_destroy(interp, PARROT_PROXY(_self)->target);
+}
+static  PMC *
+Parrot_Proxy_divide(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest)
+{
+    PMC * result;
+    PARROT_ASSERT(interp != PARROT_PROXY(_self)->interp);
+
+    /* block the GC to prevent it from finding foreign PMCs on the stack */
+    Parrot_block_GC_mark(interp);
+
+    Interp_flags_SET(interp, PARROT_THR_FLAG_NEW_PMC);
+    result = VTABLE_divide(interp, PARROT_PROXY(_self)->target, value, dest);
+    Interp_flags_CLEAR(interp, PARROT_THR_FLAG_NEW_PMC);
+
+    if (! PMC_IS_NULL(result)) {
+        if (PObj_is_new_TEST(result)) {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp == interp);
+#endif
+            PObj_is_new_CLEAR(result);
+        }
+        else {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp != interp);
+#endif
+            result = Parrot_thread_create_proxy(PARROT_PROXY(_self)->interp, interp, result);
+        }
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    return result;
+}
+static  PMC *
+Parrot_Proxy_divide_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest)
+{
+    PMC * result;
+    PARROT_ASSERT(interp != PARROT_PROXY(_self)->interp);
+
+    /* block the GC to prevent it from finding foreign PMCs on the stack */
+    Parrot_block_GC_mark(interp);
+
+    Interp_flags_SET(interp, PARROT_THR_FLAG_NEW_PMC);
+    result = VTABLE_divide_float(interp, PARROT_PROXY(_self)->target, value, dest);
+    Interp_flags_CLEAR(interp, PARROT_THR_FLAG_NEW_PMC);
+
+    if (! PMC_IS_NULL(result)) {
+        if (PObj_is_new_TEST(result)) {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp == interp);
+#endif
+            PObj_is_new_CLEAR(result);
+        }
+        else {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp != interp);
+#endif
+            result = Parrot_thread_create_proxy(PARROT_PROXY(_self)->interp, interp, result);
+        }
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    return result;
+}
+static  PMC *
+Parrot_Proxy_divide_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest)
+{
+    PMC * result;
+    PARROT_ASSERT(interp != PARROT_PROXY(_self)->interp);
+
+    /* block the GC to prevent it from finding foreign PMCs on the stack */
+    Parrot_block_GC_mark(interp);
+
+    Interp_flags_SET(interp, PARROT_THR_FLAG_NEW_PMC);
+    result = VTABLE_divide_int(interp, PARROT_PROXY(_self)->target, value, dest);
+    Interp_flags_CLEAR(interp, PARROT_THR_FLAG_NEW_PMC);
+
+    if (! PMC_IS_NULL(result)) {
+        if (PObj_is_new_TEST(result)) {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp == interp);
+#endif
+            PObj_is_new_CLEAR(result);
+        }
+        else {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp != interp);
+#endif
+            result = Parrot_thread_create_proxy(PARROT_PROXY(_self)->interp, interp, result);
+        }
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    return result;
+}
+static  INTVAL
+Parrot_Proxy_does(PARROT_INTERP, ARGMOD(PMC *_self), STRING *role)
+{
+    return VTABLE_does(interp, PARROT_PROXY(_self)->target, role);
+}
+static  INTVAL
+Parrot_Proxy_does_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *role)
+{
+    return VTABLE_does_pmc(interp, PARROT_PROXY(_self)->target, role);
+}
+static  INTVAL
+Parrot_Proxy_elements(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    return VTABLE_elements(interp, PARROT_PROXY(_self)->target);
+}
+static  INTVAL
+Parrot_Proxy_exists_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+    return VTABLE_exists_keyed(interp, PARROT_PROXY(_self)->target, key);
+}
+static  INTVAL
+Parrot_Proxy_exists_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+    return VTABLE_exists_keyed_int(interp, PARROT_PROXY(_self)->target, key);
+}
+static  INTVAL
+Parrot_Proxy_exists_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key)
+{
+    return VTABLE_exists_keyed_str(interp, PARROT_PROXY(_self)->target, key);
+}
+static  PMC  *
+Parrot_Proxy_find_method(SHIM_INTERP, ARGMOD(PMC *_self), STRING *method_name)
+{
+#line 134 "./src/pmc/proxy.pmc"
+    return VTABLE_find_method(PARROT_PROXY(_self)->interp, PARROT_PROXY(_self)->target,
+            method_name);
+#line 806 "./src/pmc/proxy.c"
+}
+static  PMC *
+Parrot_Proxy_floor_divide(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest)
+{
+    PMC * result;
+    PARROT_ASSERT(interp != PARROT_PROXY(_self)->interp);
+
+    /* block the GC to prevent it from finding foreign PMCs on the stack */
+    Parrot_block_GC_mark(interp);
+
+    Interp_flags_SET(interp, PARROT_THR_FLAG_NEW_PMC);
+    result = VTABLE_floor_divide(interp, PARROT_PROXY(_self)->target, value, dest);
+    Interp_flags_CLEAR(interp, PARROT_THR_FLAG_NEW_PMC);
+
+    if (! PMC_IS_NULL(result)) {
+        if (PObj_is_new_TEST(result)) {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp == interp);
+#endif
+            PObj_is_new_CLEAR(result);
+        }
+        else {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp != interp);
+#endif
+            result = Parrot_thread_create_proxy(PARROT_PROXY(_self)->interp, interp, result);
+        }
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    return result;
+}
+static  PMC *
+Parrot_Proxy_floor_divide_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest)
+{
+    PMC * result;
+    PARROT_ASSERT(interp != PARROT_PROXY(_self)->interp);
+
+    /* block the GC to prevent it from finding foreign PMCs on the stack */
+    Parrot_block_GC_mark(interp);
+
+    Interp_flags_SET(interp, PARROT_THR_FLAG_NEW_PMC);
+    result = VTABLE_floor_divide_float(interp, PARROT_PROXY(_self)->target, value, dest);
+    Interp_flags_CLEAR(interp, PARROT_THR_FLAG_NEW_PMC);
+
+    if (! PMC_IS_NULL(result)) {
+        if (PObj_is_new_TEST(result)) {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp == interp);
+#endif
+            PObj_is_new_CLEAR(result);
+        }
+        else {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp != interp);
+#endif
+            result = Parrot_thread_create_proxy(PARROT_PROXY(_self)->interp, interp, result);
+        }
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    return result;
+}
+static  PMC *
+Parrot_Proxy_floor_divide_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest)
+{
+    PMC * result;
+    PARROT_ASSERT(interp != PARROT_PROXY(_self)->interp);
+
+    /* block the GC to prevent it from finding foreign PMCs on the stack */
+    Parrot_block_GC_mark(interp);
+
+    Interp_flags_SET(interp, PARROT_THR_FLAG_NEW_PMC);
+    result = VTABLE_floor_divide_int(interp, PARROT_PROXY(_self)->target, value, dest);
+    Interp_flags_CLEAR(interp, PARROT_THR_FLAG_NEW_PMC);
+
+    if (! PMC_IS_NULL(result)) {
+        if (PObj_is_new_TEST(result)) {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp == interp);
+#endif
+            PObj_is_new_CLEAR(result);
+        }
+        else {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp != interp);
+#endif
+            result = Parrot_thread_create_proxy(PARROT_PROXY(_self)->interp, interp, result);
+        }
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    return result;
+}
+static  void
+Parrot_Proxy_freeze(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+    VTABLE_freeze(interp, PARROT_PROXY(_self)->target, info);
+}
+static  PMC *
+Parrot_Proxy_get_attr_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, STRING *idx)
+{
+    PMC * result;
+    PARROT_ASSERT(interp != PARROT_PROXY(_self)->interp);
+
+    /* block the GC to prevent it from finding foreign PMCs on the stack */
+    Parrot_block_GC_mark(interp);
+
+    Interp_flags_SET(interp, PARROT_THR_FLAG_NEW_PMC);
+    result = VTABLE_get_attr_keyed(interp, PARROT_PROXY(_self)->target, key, idx);
+    Interp_flags_CLEAR(interp, PARROT_THR_FLAG_NEW_PMC);
+
+    if (! PMC_IS_NULL(result)) {
+        if (PObj_is_new_TEST(result)) {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp == interp);
+#endif
+            PObj_is_new_CLEAR(result);
+        }
+        else {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp != interp);
+#endif
+            result = Parrot_thread_create_proxy(PARROT_PROXY(_self)->interp, interp, result);
+        }
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    return result;
+}
+static  PMC *
+Parrot_Proxy_get_attr_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *idx)
+{
+    PMC * result;
+    PARROT_ASSERT(interp != PARROT_PROXY(_self)->interp);
+
+    /* block the GC to prevent it from finding foreign PMCs on the stack */
+    Parrot_block_GC_mark(interp);
+
+    Interp_flags_SET(interp, PARROT_THR_FLAG_NEW_PMC);
+    result = VTABLE_get_attr_str(interp, PARROT_PROXY(_self)->target, idx);
+    Interp_flags_CLEAR(interp, PARROT_THR_FLAG_NEW_PMC);
+
+    if (! PMC_IS_NULL(result)) {
+        if (PObj_is_new_TEST(result)) {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp == interp);
+#endif
+            PObj_is_new_CLEAR(result);
+        }
+        else {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp != interp);
+#endif
+            result = Parrot_thread_create_proxy(PARROT_PROXY(_self)->interp, interp, result);
+        }
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    return result;
+}
+static  INTVAL
+Parrot_Proxy_get_bool(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    return VTABLE_get_bool(interp, PARROT_PROXY(_self)->target);
+}
+static  PMC *
+Parrot_Proxy_get_class(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * result;
+    PARROT_ASSERT(interp != PARROT_PROXY(_self)->interp);
+
+    /* block the GC to prevent it from finding foreign PMCs on the stack */
+    Parrot_block_GC_mark(interp);
+
+    Interp_flags_SET(interp, PARROT_THR_FLAG_NEW_PMC);
+    result = VTABLE_get_class(interp, PARROT_PROXY(_self)->target);
+    Interp_flags_CLEAR(interp, PARROT_THR_FLAG_NEW_PMC);
+
+    if (! PMC_IS_NULL(result)) {
+        if (PObj_is_new_TEST(result)) {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp == interp);
+#endif
+            PObj_is_new_CLEAR(result);
+        }
+        else {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp != interp);
+#endif
+            result = Parrot_thread_create_proxy(PARROT_PROXY(_self)->interp, interp, result);
+        }
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    return result;
+}
+static  INTVAL
+Parrot_Proxy_get_integer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    return VTABLE_get_integer(interp, PARROT_PROXY(_self)->target);
+}
+static  INTVAL
+Parrot_Proxy_get_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+    return VTABLE_get_integer_keyed(interp, PARROT_PROXY(_self)->target, key);
+}
+static  INTVAL
+Parrot_Proxy_get_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+    return VTABLE_get_integer_keyed_int(interp, PARROT_PROXY(_self)->target, key);
+}
+static  INTVAL
+Parrot_Proxy_get_integer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key)
+{
+    return VTABLE_get_integer_keyed_str(interp, PARROT_PROXY(_self)->target, key);
+}
+static  PMC *
+Parrot_Proxy_get_iter(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * result;
+    PARROT_ASSERT(interp != PARROT_PROXY(_self)->interp);
+
+    /* block the GC to prevent it from finding foreign PMCs on the stack */
+    Parrot_block_GC_mark(interp);
+
+    Interp_flags_SET(interp, PARROT_THR_FLAG_NEW_PMC);
+    result = VTABLE_get_iter(interp, PARROT_PROXY(_self)->target);
+    Interp_flags_CLEAR(interp, PARROT_THR_FLAG_NEW_PMC);
+
+    if (! PMC_IS_NULL(result)) {
+        if (PObj_is_new_TEST(result)) {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp == interp);
+#endif
+            PObj_is_new_CLEAR(result);
+        }
+        else {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp != interp);
+#endif
+            result = Parrot_thread_create_proxy(PARROT_PROXY(_self)->interp, interp, result);
+        }
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    return result;
+}
+static  PMC *
+Parrot_Proxy_get_namespace(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * result;
+    PARROT_ASSERT(interp != PARROT_PROXY(_self)->interp);
+
+    /* block the GC to prevent it from finding foreign PMCs on the stack */
+    Parrot_block_GC_mark(interp);
+
+    Interp_flags_SET(interp, PARROT_THR_FLAG_NEW_PMC);
+    result = VTABLE_get_namespace(interp, PARROT_PROXY(_self)->target);
+    Interp_flags_CLEAR(interp, PARROT_THR_FLAG_NEW_PMC);
+
+    if (! PMC_IS_NULL(result)) {
+        if (PObj_is_new_TEST(result)) {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp == interp);
+#endif
+            PObj_is_new_CLEAR(result);
+        }
+        else {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp != interp);
+#endif
+            result = Parrot_thread_create_proxy(PARROT_PROXY(_self)->interp, interp, result);
+        }
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    return result;
+}
+static  FLOATVAL
+Parrot_Proxy_get_number(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    return VTABLE_get_number(interp, PARROT_PROXY(_self)->target);
+}
+static  FLOATVAL
+Parrot_Proxy_get_number_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+    return VTABLE_get_number_keyed(interp, PARROT_PROXY(_self)->target, key);
+}
+static  FLOATVAL
+Parrot_Proxy_get_number_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+    return VTABLE_get_number_keyed_int(interp, PARROT_PROXY(_self)->target, key);
+}
+static  FLOATVAL
+Parrot_Proxy_get_number_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key)
+{
+    return VTABLE_get_number_keyed_str(interp, PARROT_PROXY(_self)->target, key);
+}
+static  PMC *
+Parrot_Proxy_get_pmc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * result;
+    PARROT_ASSERT(interp != PARROT_PROXY(_self)->interp);
+
+    /* block the GC to prevent it from finding foreign PMCs on the stack */
+    Parrot_block_GC_mark(interp);
+
+    Interp_flags_SET(interp, PARROT_THR_FLAG_NEW_PMC);
+    result = VTABLE_get_pmc(interp, PARROT_PROXY(_self)->target);
+    Interp_flags_CLEAR(interp, PARROT_THR_FLAG_NEW_PMC);
+
+    if (! PMC_IS_NULL(result)) {
+        if (PObj_is_new_TEST(result)) {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp == interp);
+#endif
+            PObj_is_new_CLEAR(result);
+        }
+        else {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp != interp);
+#endif
+            result = Parrot_thread_create_proxy(PARROT_PROXY(_self)->interp, interp, result);
+        }
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    return result;
+}
+static  PMC *
+Parrot_Proxy_get_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+    PMC * result;
+    PARROT_ASSERT(interp != PARROT_PROXY(_self)->interp);
+
+    /* block the GC to prevent it from finding foreign PMCs on the stack */
+    Parrot_block_GC_mark(interp);
+
+    Interp_flags_SET(interp, PARROT_THR_FLAG_NEW_PMC);
+    result = VTABLE_get_pmc_keyed(interp, PARROT_PROXY(_self)->target, key);
+    Interp_flags_CLEAR(interp, PARROT_THR_FLAG_NEW_PMC);
+
+    if (! PMC_IS_NULL(result)) {
+        if (PObj_is_new_TEST(result)) {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp == interp);
+#endif
+            PObj_is_new_CLEAR(result);
+        }
+        else {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp != interp);
+#endif
+            result = Parrot_thread_create_proxy(PARROT_PROXY(_self)->interp, interp, result);
+        }
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    return result;
+}
+static  PMC *
+Parrot_Proxy_get_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+    PMC * result;
+    PARROT_ASSERT(interp != PARROT_PROXY(_self)->interp);
+
+    /* block the GC to prevent it from finding foreign PMCs on the stack */
+    Parrot_block_GC_mark(interp);
+
+    Interp_flags_SET(interp, PARROT_THR_FLAG_NEW_PMC);
+    result = VTABLE_get_pmc_keyed_int(interp, PARROT_PROXY(_self)->target, key);
+    Interp_flags_CLEAR(interp, PARROT_THR_FLAG_NEW_PMC);
+
+    if (! PMC_IS_NULL(result)) {
+        if (PObj_is_new_TEST(result)) {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp == interp);
+#endif
+            PObj_is_new_CLEAR(result);
+        }
+        else {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp != interp);
+#endif
+            result = Parrot_thread_create_proxy(PARROT_PROXY(_self)->interp, interp, result);
+        }
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    return result;
+}
+static  PMC *
+Parrot_Proxy_get_pmc_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key)
+{
+    PMC * result;
+    PARROT_ASSERT(interp != PARROT_PROXY(_self)->interp);
+
+    /* block the GC to prevent it from finding foreign PMCs on the stack */
+    Parrot_block_GC_mark(interp);
+
+    Interp_flags_SET(interp, PARROT_THR_FLAG_NEW_PMC);
+    result = VTABLE_get_pmc_keyed_str(interp, PARROT_PROXY(_self)->target, key);
+    Interp_flags_CLEAR(interp, PARROT_THR_FLAG_NEW_PMC);
+
+    if (! PMC_IS_NULL(result)) {
+        if (PObj_is_new_TEST(result)) {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp == interp);
+#endif
+            PObj_is_new_CLEAR(result);
+        }
+        else {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp != interp);
+#endif
+            result = Parrot_thread_create_proxy(PARROT_PROXY(_self)->interp, interp, result);
+        }
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    return result;
+}
+static  void *
+Parrot_Proxy_get_pointer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    return VTABLE_get_pointer(interp, PARROT_PROXY(_self)->target);
+}
+static  void *
+Parrot_Proxy_get_pointer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+    return VTABLE_get_pointer_keyed(interp, PARROT_PROXY(_self)->target, key);
+}
+static  void *
+Parrot_Proxy_get_pointer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+    return VTABLE_get_pointer_keyed_int(interp, PARROT_PROXY(_self)->target, key);
+}
+static  void  *
+Parrot_Proxy_get_pointer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key)
+{
+#line 140 "./src/pmc/proxy.pmc"
+
+    Parrot_Proxy_attributes * const data = PARROT_PROXY(_self);
+    void * result;
+    PARROT_ASSERT(interp != data->interp);
+
+    /* block the GC to prevent it from finding foreign PMCs on the stack */
+    Parrot_block_GC_mark(interp);
+
+    Interp_flags_SET(interp, PARROT_THR_FLAG_NEW_PMC);
+    result = VTABLE_get_pointer_keyed_str(interp, data->target, key);
+    Interp_flags_CLEAR(interp, PARROT_THR_FLAG_NEW_PMC);
+
+    /* workaround for TT #1219, see Parrot_ns_find_namespace_global */
+    if (data->target->vtable->base_type == enum_class_NameSpace) {
+        if (! PMC_IS_NULL((PMC *) result)) {
+            if (PObj_is_new_TEST((PMC*)result)) {
+#ifdef THREAD_DEBUG
+                PARROT_ASSERT(((PMC *)result)->orig_interp == interp);
+#endif
+                abort();
+                PObj_is_new_CLEAR((PMC*)result);
+            }
+            else {
+#ifdef THREAD_DEBUG
+                PARROT_ASSERT(((PMC *)result)->orig_interp != interp);
+#endif
+                result = Parrot_thread_create_proxy(data->interp, interp, (PMC*)result);
+            }
+        }
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    return result;
+#line 1295 "./src/pmc/proxy.c"
+}
+static  STRING *
+Parrot_Proxy_get_repr(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    return VTABLE_get_repr(interp, PARROT_PROXY(_self)->target);
+}
+static  STRING *
+Parrot_Proxy_get_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    return VTABLE_get_string(interp, PARROT_PROXY(_self)->target);
+}
+static  STRING *
+Parrot_Proxy_get_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+    return VTABLE_get_string_keyed(interp, PARROT_PROXY(_self)->target, key);
+}
+static  STRING *
+Parrot_Proxy_get_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL key)
+{
+    return VTABLE_get_string_keyed_int(interp, PARROT_PROXY(_self)->target, key);
+}
+static  STRING *
+Parrot_Proxy_get_string_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *key)
+{
+    return VTABLE_get_string_keyed_str(interp, PARROT_PROXY(_self)->target, key);
+}
+static  INTVAL
+Parrot_Proxy_hashvalue(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    return VTABLE_hashvalue(interp, PARROT_PROXY(_self)->target);
+}
+static  void
+Parrot_Proxy_i_absolute(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_ABSOLUTE);
+}
+static  void
+Parrot_Proxy_i_add(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_ADD);
+}
+static  void
+Parrot_Proxy_i_add_float(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(FLOATVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_ADD_FLOAT);
+}
+static  void
+Parrot_Proxy_i_add_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_ADD_INT);
+}
+static  void
+Parrot_Proxy_i_concatenate(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_CONCATENATE);
+}
+static  void
+Parrot_Proxy_i_concatenate_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_CONCATENATE_STR);
+}
+static  void
+Parrot_Proxy_i_divide(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_DIVIDE);
+}
+static  void
+Parrot_Proxy_i_divide_float(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(FLOATVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_DIVIDE_FLOAT);
+}
+static  void
+Parrot_Proxy_i_divide_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_DIVIDE_INT);
+}
+static  void
+Parrot_Proxy_i_floor_divide(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_FLOOR_DIVIDE);
+}
+static  void
+Parrot_Proxy_i_floor_divide_float(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(FLOATVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_FLOOR_DIVIDE_FLOAT);
+}
+static  void
+Parrot_Proxy_i_floor_divide_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_FLOOR_DIVIDE_INT);
+}
+static  void
+Parrot_Proxy_i_modulus(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_MODULUS);
+}
+static  void
+Parrot_Proxy_i_modulus_float(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(FLOATVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_MODULUS_FLOAT);
+}
+static  void
+Parrot_Proxy_i_modulus_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_MODULUS_INT);
+}
+static  void
+Parrot_Proxy_i_multiply(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_MULTIPLY);
+}
+static  void
+Parrot_Proxy_i_multiply_float(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(FLOATVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_MULTIPLY_FLOAT);
+}
+static  void
+Parrot_Proxy_i_multiply_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_MULTIPLY_INT);
+}
+static  void
+Parrot_Proxy_i_neg(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_NEG);
+}
+static  void
+Parrot_Proxy_i_repeat(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_REPEAT);
+}
+static  void
+Parrot_Proxy_i_repeat_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_REPEAT_INT);
+}
+static  void
+Parrot_Proxy_i_subtract(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_SUBTRACT);
+}
+static  void
+Parrot_Proxy_i_subtract_float(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(FLOATVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_SUBTRACT_FLOAT);
+}
+static  void
+Parrot_Proxy_i_subtract_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_I_SUBTRACT_INT);
+}
+static  void
+Parrot_Proxy_increment(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_INCREMENT);
+}
+static  void 
+Parrot_Proxy_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 97 "./src/pmc/proxy.pmc"
+
+    Parrot_Proxy_attributes * const core_struct = PARROT_PROXY(_self);
+
+    /* Set flags for custom GC mark. */
+    PObj_custom_mark_SET(_self);
+
+    core_struct->target = PMCNULL;
+    core_struct->interp = interp;
+#line 1464 "./src/pmc/proxy.c"
+}
+static  void
+Parrot_Proxy_init_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL initializer))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_INIT_INT);
+}
+static  void 
+Parrot_Proxy_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *target)
+{
+#line 107 "./src/pmc/proxy.pmc"
+
+    Parrot_Proxy_attributes * const core_struct = PARROT_PROXY(_self);
+
+    /* Set flags for custom GC mark. */
+    PObj_custom_mark_SET(_self);
+
+    PARROT_ASSERT(!PMC_IS_NULL(target));
+    PARROT_ASSERT(target->vtable->base_type != enum_class_Proxy);
+    core_struct->target = target;
+    core_struct->interp = interp;
+#line 1485 "./src/pmc/proxy.c"
+}
+static  PMC *
+Parrot_Proxy_inspect(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * result;
+    PARROT_ASSERT(interp != PARROT_PROXY(_self)->interp);
+
+    /* block the GC to prevent it from finding foreign PMCs on the stack */
+    Parrot_block_GC_mark(interp);
+
+    Interp_flags_SET(interp, PARROT_THR_FLAG_NEW_PMC);
+    result = VTABLE_inspect(interp, PARROT_PROXY(_self)->target);
+    Interp_flags_CLEAR(interp, PARROT_THR_FLAG_NEW_PMC);
+
+    if (! PMC_IS_NULL(result)) {
+        if (PObj_is_new_TEST(result)) {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp == interp);
+#endif
+            PObj_is_new_CLEAR(result);
+        }
+        else {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp != interp);
+#endif
+            result = Parrot_thread_create_proxy(PARROT_PROXY(_self)->interp, interp, result);
+        }
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    return result;
+}
+static  PMC *
+Parrot_Proxy_inspect_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *what)
+{
+    PMC * result;
+    PARROT_ASSERT(interp != PARROT_PROXY(_self)->interp);
+
+    /* block the GC to prevent it from finding foreign PMCs on the stack */
+    Parrot_block_GC_mark(interp);
+
+    Interp_flags_SET(interp, PARROT_THR_FLAG_NEW_PMC);
+    result = VTABLE_inspect_str(interp, PARROT_PROXY(_self)->target, what);
+    Interp_flags_CLEAR(interp, PARROT_THR_FLAG_NEW_PMC);
+
+    if (! PMC_IS_NULL(result)) {
+        if (PObj_is_new_TEST(result)) {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp == interp);
+#endif
+            PObj_is_new_CLEAR(result);
+        }
+        else {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp != interp);
+#endif
+            result = Parrot_thread_create_proxy(PARROT_PROXY(_self)->interp, interp, result);
+        }
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    return result;
+}
+static  PMC  *
+Parrot_Proxy_instantiate(PARROT_INTERP, ARGMOD(PMC *_self), PMC *init)
+{
+#line 176 "./src/pmc/proxy.pmc"
+
+    PMC * const _class = PARROT_PROXY(_self)->target;
+    /*TODO will fail if the class has not been instantiated in the main thread before */
+
+    PARROT_ASSERT(_class->vtable->base_type != enum_class_Proxy);
+    return VTABLE_instantiate(interp, _class, init);
+#line 1561 "./src/pmc/proxy.c"
+}
+static  opcode_t *
+Parrot_Proxy_invoke(PARROT_INTERP, ARGMOD(PMC *_self), void *next)
+{
+    return VTABLE_invoke(interp, PARROT_PROXY(_self)->target, next);
+}
+static  INTVAL
+Parrot_Proxy_is_equal(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+    return VTABLE_is_equal(interp, PARROT_PROXY(_self)->target, value);
+}
+static  INTVAL
+Parrot_Proxy_is_equal_num(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+    return VTABLE_is_equal_num(interp, PARROT_PROXY(_self)->target, value);
+}
+static  INTVAL
+Parrot_Proxy_is_equal_string(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+    return VTABLE_is_equal_string(interp, PARROT_PROXY(_self)->target, value);
+}
+static  INTVAL
+Parrot_Proxy_is_same(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+    return VTABLE_is_same(interp, PARROT_PROXY(_self)->target, value);
+}
+static  INTVAL
+Parrot_Proxy_isa(PARROT_INTERP, ARGMOD(PMC *_self), STRING *_class)
+{
+    return VTABLE_isa(interp, PARROT_PROXY(_self)->target, _class);
+}
+static  INTVAL
+Parrot_Proxy_isa_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *_class)
+{
+    return VTABLE_isa_pmc(interp, PARROT_PROXY(_self)->target, _class);
+}
+static  void 
+Parrot_Proxy_mark(SHIM_INTERP, SHIM(PMC *_self))
+{
+#line 128 "./src/pmc/proxy.pmc"
+#line 1602 "./src/pmc/proxy.c"
+}
+static  PMC *
+Parrot_Proxy_modulus(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest)
+{
+    PMC * result;
+    PARROT_ASSERT(interp != PARROT_PROXY(_self)->interp);
+
+    /* block the GC to prevent it from finding foreign PMCs on the stack */
+    Parrot_block_GC_mark(interp);
+
+    Interp_flags_SET(interp, PARROT_THR_FLAG_NEW_PMC);
+    result = VTABLE_modulus(interp, PARROT_PROXY(_self)->target, value, dest);
+    Interp_flags_CLEAR(interp, PARROT_THR_FLAG_NEW_PMC);
+
+    if (! PMC_IS_NULL(result)) {
+        if (PObj_is_new_TEST(result)) {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp == interp);
+#endif
+            PObj_is_new_CLEAR(result);
+        }
+        else {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp != interp);
+#endif
+            result = Parrot_thread_create_proxy(PARROT_PROXY(_self)->interp, interp, result);
+        }
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    return result;
+}
+static  PMC *
+Parrot_Proxy_modulus_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest)
+{
+    PMC * result;
+    PARROT_ASSERT(interp != PARROT_PROXY(_self)->interp);
+
+    /* block the GC to prevent it from finding foreign PMCs on the stack */
+    Parrot_block_GC_mark(interp);
+
+    Interp_flags_SET(interp, PARROT_THR_FLAG_NEW_PMC);
+    result = VTABLE_modulus_float(interp, PARROT_PROXY(_self)->target, value, dest);
+    Interp_flags_CLEAR(interp, PARROT_THR_FLAG_NEW_PMC);
+
+    if (! PMC_IS_NULL(result)) {
+        if (PObj_is_new_TEST(result)) {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp == interp);
+#endif
+            PObj_is_new_CLEAR(result);
+        }
+        else {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp != interp);
+#endif
+            result = Parrot_thread_create_proxy(PARROT_PROXY(_self)->interp, interp, result);
+        }
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    return result;
+}
+static  PMC *
+Parrot_Proxy_modulus_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest)
+{
+    PMC * result;
+    PARROT_ASSERT(interp != PARROT_PROXY(_self)->interp);
+
+    /* block the GC to prevent it from finding foreign PMCs on the stack */
+    Parrot_block_GC_mark(interp);
+
+    Interp_flags_SET(interp, PARROT_THR_FLAG_NEW_PMC);
+    result = VTABLE_modulus_int(interp, PARROT_PROXY(_self)->target, value, dest);
+    Interp_flags_CLEAR(interp, PARROT_THR_FLAG_NEW_PMC);
+
+    if (! PMC_IS_NULL(result)) {
+        if (PObj_is_new_TEST(result)) {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp == interp);
+#endif
+            PObj_is_new_CLEAR(result);
+        }
+        else {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp != interp);
+#endif
+            result = Parrot_thread_create_proxy(PARROT_PROXY(_self)->interp, interp, result);
+        }
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    return result;
+}
+static  void
+Parrot_Proxy_morph(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *type))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_MORPH);
+}
+static  PMC *
+Parrot_Proxy_multiply(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest)
+{
+    PMC * result;
+    PARROT_ASSERT(interp != PARROT_PROXY(_self)->interp);
+
+    /* block the GC to prevent it from finding foreign PMCs on the stack */
+    Parrot_block_GC_mark(interp);
+
+    Interp_flags_SET(interp, PARROT_THR_FLAG_NEW_PMC);
+    result = VTABLE_multiply(interp, PARROT_PROXY(_self)->target, value, dest);
+    Interp_flags_CLEAR(interp, PARROT_THR_FLAG_NEW_PMC);
+
+    if (! PMC_IS_NULL(result)) {
+        if (PObj_is_new_TEST(result)) {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp == interp);
+#endif
+            PObj_is_new_CLEAR(result);
+        }
+        else {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp != interp);
+#endif
+            result = Parrot_thread_create_proxy(PARROT_PROXY(_self)->interp, interp, result);
+        }
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    return result;
+}
+static  PMC *
+Parrot_Proxy_multiply_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest)
+{
+    PMC * result;
+    PARROT_ASSERT(interp != PARROT_PROXY(_self)->interp);
+
+    /* block the GC to prevent it from finding foreign PMCs on the stack */
+    Parrot_block_GC_mark(interp);
+
+    Interp_flags_SET(interp, PARROT_THR_FLAG_NEW_PMC);
+    result = VTABLE_multiply_float(interp, PARROT_PROXY(_self)->target, value, dest);
+    Interp_flags_CLEAR(interp, PARROT_THR_FLAG_NEW_PMC);
+
+    if (! PMC_IS_NULL(result)) {
+        if (PObj_is_new_TEST(result)) {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp == interp);
+#endif
+            PObj_is_new_CLEAR(result);
+        }
+        else {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp != interp);
+#endif
+            result = Parrot_thread_create_proxy(PARROT_PROXY(_self)->interp, interp, result);
+        }
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    return result;
+}
+static  PMC *
+Parrot_Proxy_multiply_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest)
+{
+    PMC * result;
+    PARROT_ASSERT(interp != PARROT_PROXY(_self)->interp);
+
+    /* block the GC to prevent it from finding foreign PMCs on the stack */
+    Parrot_block_GC_mark(interp);
+
+    Interp_flags_SET(interp, PARROT_THR_FLAG_NEW_PMC);
+    result = VTABLE_multiply_int(interp, PARROT_PROXY(_self)->target, value, dest);
+    Interp_flags_CLEAR(interp, PARROT_THR_FLAG_NEW_PMC);
+
+    if (! PMC_IS_NULL(result)) {
+        if (PObj_is_new_TEST(result)) {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp == interp);
+#endif
+            PObj_is_new_CLEAR(result);
+        }
+        else {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp != interp);
+#endif
+            result = Parrot_thread_create_proxy(PARROT_PROXY(_self)->interp, interp, result);
+        }
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    return result;
+}
+static  STRING *
+Parrot_Proxy_name(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    return VTABLE_name(interp, PARROT_PROXY(_self)->target);
+}
+static  PMC *
+Parrot_Proxy_neg(PARROT_INTERP, ARGMOD(PMC *_self), PMC *dest)
+{
+    PMC * result;
+    PARROT_ASSERT(interp != PARROT_PROXY(_self)->interp);
+
+    /* block the GC to prevent it from finding foreign PMCs on the stack */
+    Parrot_block_GC_mark(interp);
+
+    Interp_flags_SET(interp, PARROT_THR_FLAG_NEW_PMC);
+    result = VTABLE_neg(interp, PARROT_PROXY(_self)->target, dest);
+    Interp_flags_CLEAR(interp, PARROT_THR_FLAG_NEW_PMC);
+
+    if (! PMC_IS_NULL(result)) {
+        if (PObj_is_new_TEST(result)) {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp == interp);
+#endif
+            PObj_is_new_CLEAR(result);
+        }
+        else {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp != interp);
+#endif
+            result = Parrot_thread_create_proxy(PARROT_PROXY(_self)->interp, interp, result);
+        }
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    return result;
+}
+static  FLOATVAL
+Parrot_Proxy_pop_float(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_POP_FLOAT);
+}
+static  INTVAL
+Parrot_Proxy_pop_integer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_POP_INTEGER);
+}
+static  PMC *
+Parrot_Proxy_pop_pmc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_POP_PMC);
+}
+static  STRING *
+Parrot_Proxy_pop_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_POP_STRING);
+}
+static  void
+Parrot_Proxy_push_float(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(FLOATVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_PUSH_FLOAT);
+}
+static  void
+Parrot_Proxy_push_integer(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_PUSH_INTEGER);
+}
+static  void
+Parrot_Proxy_push_pmc(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_PUSH_PMC);
+}
+static  void
+Parrot_Proxy_push_string(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_PUSH_STRING);
+}
+static  void
+Parrot_Proxy_remove_attribute(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *name))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_REMOVE_ATTRIBUTE);
+}
+static  void
+Parrot_Proxy_remove_method(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *method_name))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_REMOVE_METHOD);
+}
+static  void
+Parrot_Proxy_remove_parent(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *parent))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_REMOVE_PARENT);
+}
+static  void
+Parrot_Proxy_remove_role(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *role))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_REMOVE_ROLE);
+}
+static  void
+Parrot_Proxy_remove_vtable_override(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *vtable_name))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_REMOVE_VTABLE_OVERRIDE);
+}
+static  PMC *
+Parrot_Proxy_repeat(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest)
+{
+    PMC * result;
+    PARROT_ASSERT(interp != PARROT_PROXY(_self)->interp);
+
+    /* block the GC to prevent it from finding foreign PMCs on the stack */
+    Parrot_block_GC_mark(interp);
+
+    Interp_flags_SET(interp, PARROT_THR_FLAG_NEW_PMC);
+    result = VTABLE_repeat(interp, PARROT_PROXY(_self)->target, value, dest);
+    Interp_flags_CLEAR(interp, PARROT_THR_FLAG_NEW_PMC);
+
+    if (! PMC_IS_NULL(result)) {
+        if (PObj_is_new_TEST(result)) {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp == interp);
+#endif
+            PObj_is_new_CLEAR(result);
+        }
+        else {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp != interp);
+#endif
+            result = Parrot_thread_create_proxy(PARROT_PROXY(_self)->interp, interp, result);
+        }
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    return result;
+}
+static  PMC *
+Parrot_Proxy_repeat_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest)
+{
+    PMC * result;
+    PARROT_ASSERT(interp != PARROT_PROXY(_self)->interp);
+
+    /* block the GC to prevent it from finding foreign PMCs on the stack */
+    Parrot_block_GC_mark(interp);
+
+    Interp_flags_SET(interp, PARROT_THR_FLAG_NEW_PMC);
+    result = VTABLE_repeat_int(interp, PARROT_PROXY(_self)->target, value, dest);
+    Interp_flags_CLEAR(interp, PARROT_THR_FLAG_NEW_PMC);
+
+    if (! PMC_IS_NULL(result)) {
+        if (PObj_is_new_TEST(result)) {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp == interp);
+#endif
+            PObj_is_new_CLEAR(result);
+        }
+        else {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp != interp);
+#endif
+            result = Parrot_thread_create_proxy(PARROT_PROXY(_self)->interp, interp, result);
+        }
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    return result;
+}
+static  void
+Parrot_Proxy_set_attr_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key), SHIM(STRING *idx), SHIM(PMC *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_ATTR_KEYED);
+}
+static  void
+Parrot_Proxy_set_attr_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *idx), SHIM(PMC *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_ATTR_STR);
+}
+static  void
+Parrot_Proxy_set_bool(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_BOOL);
+}
+static  void
+Parrot_Proxy_set_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key), SHIM(INTVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_INTEGER_KEYED);
+}
+static  void
+Parrot_Proxy_set_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL key), SHIM(INTVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_INTEGER_KEYED_INT);
+}
+static  void
+Parrot_Proxy_set_integer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key), SHIM(INTVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_INTEGER_KEYED_STR);
+}
+static  void
+Parrot_Proxy_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_INTEGER_NATIVE);
+}
+static  void
+Parrot_Proxy_set_number_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key), SHIM(FLOATVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_NUMBER_KEYED);
+}
+static  void
+Parrot_Proxy_set_number_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL key), SHIM(FLOATVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_NUMBER_KEYED_INT);
+}
+static  void
+Parrot_Proxy_set_number_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key), SHIM(FLOATVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_NUMBER_KEYED_STR);
+}
+static  void
+Parrot_Proxy_set_number_native(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(FLOATVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_NUMBER_NATIVE);
+}
+static  void
+Parrot_Proxy_set_pmc(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_PMC);
+}
+static  void
+Parrot_Proxy_set_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key), SHIM(PMC *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_PMC_KEYED);
+}
+static  void
+Parrot_Proxy_set_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL key), SHIM(PMC *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_PMC_KEYED_INT);
+}
+static  void
+Parrot_Proxy_set_pmc_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key), SHIM(PMC *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_PMC_KEYED_STR);
+}
+static  void
+Parrot_Proxy_set_pointer(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(void *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_POINTER);
+}
+static  void
+Parrot_Proxy_set_pointer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key), SHIM(void *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_POINTER_KEYED);
+}
+static  void
+Parrot_Proxy_set_pointer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL key), SHIM(void *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_POINTER_KEYED_INT);
+}
+static  void
+Parrot_Proxy_set_pointer_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key), SHIM(void *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_POINTER_KEYED_STR);
+}
+static  void
+Parrot_Proxy_set_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key), SHIM(STRING *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_STRING_KEYED);
+}
+static  void
+Parrot_Proxy_set_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL key), SHIM(STRING *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_STRING_KEYED_INT);
+}
+static  void
+Parrot_Proxy_set_string_keyed_str(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *key), SHIM(STRING *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_STRING_KEYED_STR);
+}
+static  void
+Parrot_Proxy_set_string_native(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SET_STRING_NATIVE);
+}
+static  void
+Parrot_Proxy_share(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SHARE);
+}
+static  FLOATVAL
+Parrot_Proxy_shift_float(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SHIFT_FLOAT);
+}
+static  INTVAL
+Parrot_Proxy_shift_integer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SHIFT_INTEGER);
+}
+static  PMC *
+Parrot_Proxy_shift_pmc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SHIFT_PMC);
+}
+static  STRING *
+Parrot_Proxy_shift_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SHIFT_STRING);
+}
+static  void
+Parrot_Proxy_splice(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value), SHIM(INTVAL offset), SHIM(INTVAL count))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_SPLICE);
+}
+static  STRING *
+Parrot_Proxy_substr(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL offset, INTVAL length)
+{
+    return VTABLE_substr(interp, PARROT_PROXY(_self)->target, offset, length);
+}
+static  PMC *
+Parrot_Proxy_subtract(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest)
+{
+    PMC * result;
+    PARROT_ASSERT(interp != PARROT_PROXY(_self)->interp);
+
+    /* block the GC to prevent it from finding foreign PMCs on the stack */
+    Parrot_block_GC_mark(interp);
+
+    Interp_flags_SET(interp, PARROT_THR_FLAG_NEW_PMC);
+    result = VTABLE_subtract(interp, PARROT_PROXY(_self)->target, value, dest);
+    Interp_flags_CLEAR(interp, PARROT_THR_FLAG_NEW_PMC);
+
+    if (! PMC_IS_NULL(result)) {
+        if (PObj_is_new_TEST(result)) {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp == interp);
+#endif
+            PObj_is_new_CLEAR(result);
+        }
+        else {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp != interp);
+#endif
+            result = Parrot_thread_create_proxy(PARROT_PROXY(_self)->interp, interp, result);
+        }
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    return result;
+}
+static  PMC *
+Parrot_Proxy_subtract_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest)
+{
+    PMC * result;
+    PARROT_ASSERT(interp != PARROT_PROXY(_self)->interp);
+
+    /* block the GC to prevent it from finding foreign PMCs on the stack */
+    Parrot_block_GC_mark(interp);
+
+    Interp_flags_SET(interp, PARROT_THR_FLAG_NEW_PMC);
+    result = VTABLE_subtract_float(interp, PARROT_PROXY(_self)->target, value, dest);
+    Interp_flags_CLEAR(interp, PARROT_THR_FLAG_NEW_PMC);
+
+    if (! PMC_IS_NULL(result)) {
+        if (PObj_is_new_TEST(result)) {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp == interp);
+#endif
+            PObj_is_new_CLEAR(result);
+        }
+        else {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp != interp);
+#endif
+            result = Parrot_thread_create_proxy(PARROT_PROXY(_self)->interp, interp, result);
+        }
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    return result;
+}
+static  PMC *
+Parrot_Proxy_subtract_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest)
+{
+    PMC * result;
+    PARROT_ASSERT(interp != PARROT_PROXY(_self)->interp);
+
+    /* block the GC to prevent it from finding foreign PMCs on the stack */
+    Parrot_block_GC_mark(interp);
+
+    Interp_flags_SET(interp, PARROT_THR_FLAG_NEW_PMC);
+    result = VTABLE_subtract_int(interp, PARROT_PROXY(_self)->target, value, dest);
+    Interp_flags_CLEAR(interp, PARROT_THR_FLAG_NEW_PMC);
+
+    if (! PMC_IS_NULL(result)) {
+        if (PObj_is_new_TEST(result)) {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp == interp);
+#endif
+            PObj_is_new_CLEAR(result);
+        }
+        else {
+#ifdef THREAD_DEBUG
+            PARROT_ASSERT(result->orig_interp != interp);
+#endif
+            result = Parrot_thread_create_proxy(PARROT_PROXY(_self)->interp, interp, result);
+        }
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    return result;
+}
+static  void
+Parrot_Proxy_thaw(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *info))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_THAW);
+}
+static  void
+Parrot_Proxy_thawfinish(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *info))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_THAWFINISH);
+}
+static  INTVAL
+Parrot_Proxy_type(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    return VTABLE_type(interp, PARROT_PROXY(_self)->target);
+}
+static  void
+Parrot_Proxy_unshift_float(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(FLOATVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_UNSHIFT_FLOAT);
+}
+static  void
+Parrot_Proxy_unshift_integer(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(INTVAL value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_UNSHIFT_INTEGER);
+}
+static  void
+Parrot_Proxy_unshift_pmc(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_UNSHIFT_PMC);
+}
+static  void
+Parrot_Proxy_unshift_string(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(STRING *value))
+{
+    cant_do_write_method(interp, _self, PARROT_VTABLE_SLOT_UNSHIFT_STRING);
+}
+static  void
+Parrot_Proxy_visit(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+    VTABLE_visit(interp, PARROT_PROXY(_self)->target, info);
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_Proxy_update_vtable(VTABLE *vt) {
+    vt->absolute = Parrot_Proxy_absolute;
+    vt->add = Parrot_Proxy_add;
+    vt->add_attribute = Parrot_Proxy_add_attribute;
+    vt->add_float = Parrot_Proxy_add_float;
+    vt->add_int = Parrot_Proxy_add_int;
+    vt->add_method = Parrot_Proxy_add_method;
+    vt->add_parent = Parrot_Proxy_add_parent;
+    vt->add_role = Parrot_Proxy_add_role;
+    vt->add_vtable_override = Parrot_Proxy_add_vtable_override;
+    vt->assign_pmc = Parrot_Proxy_assign_pmc;
+    vt->assign_string_native = Parrot_Proxy_assign_string_native;
+    vt->clone = Parrot_Proxy_clone;
+    vt->clone_pmc = Parrot_Proxy_clone_pmc;
+    vt->cmp = Parrot_Proxy_cmp;
+    vt->cmp_num = Parrot_Proxy_cmp_num;
+    vt->cmp_pmc = Parrot_Proxy_cmp_pmc;
+    vt->cmp_string = Parrot_Proxy_cmp_string;
+    vt->concatenate = Parrot_Proxy_concatenate;
+    vt->concatenate_str = Parrot_Proxy_concatenate_str;
+    vt->decrement = Parrot_Proxy_decrement;
+    vt->defined = Parrot_Proxy_defined;
+    vt->defined_keyed = Parrot_Proxy_defined_keyed;
+    vt->defined_keyed_int = Parrot_Proxy_defined_keyed_int;
+    vt->defined_keyed_str = Parrot_Proxy_defined_keyed_str;
+    vt->delete_keyed = Parrot_Proxy_delete_keyed;
+    vt->delete_keyed_int = Parrot_Proxy_delete_keyed_int;
+    vt->delete_keyed_str = Parrot_Proxy_delete_keyed_str;
+    vt->destroy = Parrot_Proxy_destroy;
+    vt->divide = Parrot_Proxy_divide;
+    vt->divide_float = Parrot_Proxy_divide_float;
+    vt->divide_int = Parrot_Proxy_divide_int;
+    vt->does = Parrot_Proxy_does;
+    vt->does_pmc = Parrot_Proxy_does_pmc;
+    vt->elements = Parrot_Proxy_elements;
+    vt->exists_keyed = Parrot_Proxy_exists_keyed;
+    vt->exists_keyed_int = Parrot_Proxy_exists_keyed_int;
+    vt->exists_keyed_str = Parrot_Proxy_exists_keyed_str;
+    vt->find_method = Parrot_Proxy_find_method;
+    vt->floor_divide = Parrot_Proxy_floor_divide;
+    vt->floor_divide_float = Parrot_Proxy_floor_divide_float;
+    vt->floor_divide_int = Parrot_Proxy_floor_divide_int;
+    vt->freeze = Parrot_Proxy_freeze;
+    vt->get_attr_keyed = Parrot_Proxy_get_attr_keyed;
+    vt->get_attr_str = Parrot_Proxy_get_attr_str;
+    vt->get_bool = Parrot_Proxy_get_bool;
+    vt->get_class = Parrot_Proxy_get_class;
+    vt->get_integer = Parrot_Proxy_get_integer;
+    vt->get_integer_keyed = Parrot_Proxy_get_integer_keyed;
+    vt->get_integer_keyed_int = Parrot_Proxy_get_integer_keyed_int;
+    vt->get_integer_keyed_str = Parrot_Proxy_get_integer_keyed_str;
+    vt->get_iter = Parrot_Proxy_get_iter;
+    vt->get_namespace = Parrot_Proxy_get_namespace;
+    vt->get_number = Parrot_Proxy_get_number;
+    vt->get_number_keyed = Parrot_Proxy_get_number_keyed;
+    vt->get_number_keyed_int = Parrot_Proxy_get_number_keyed_int;
+    vt->get_number_keyed_str = Parrot_Proxy_get_number_keyed_str;
+    vt->get_pmc = Parrot_Proxy_get_pmc;
+    vt->get_pmc_keyed = Parrot_Proxy_get_pmc_keyed;
+    vt->get_pmc_keyed_int = Parrot_Proxy_get_pmc_keyed_int;
+    vt->get_pmc_keyed_str = Parrot_Proxy_get_pmc_keyed_str;
+    vt->get_pointer = Parrot_Proxy_get_pointer;
+    vt->get_pointer_keyed = Parrot_Proxy_get_pointer_keyed;
+    vt->get_pointer_keyed_int = Parrot_Proxy_get_pointer_keyed_int;
+    vt->get_pointer_keyed_str = Parrot_Proxy_get_pointer_keyed_str;
+    vt->get_repr = Parrot_Proxy_get_repr;
+    vt->get_string = Parrot_Proxy_get_string;
+    vt->get_string_keyed = Parrot_Proxy_get_string_keyed;
+    vt->get_string_keyed_int = Parrot_Proxy_get_string_keyed_int;
+    vt->get_string_keyed_str = Parrot_Proxy_get_string_keyed_str;
+    vt->hashvalue = Parrot_Proxy_hashvalue;
+    vt->i_absolute = Parrot_Proxy_i_absolute;
+    vt->i_add = Parrot_Proxy_i_add;
+    vt->i_add_float = Parrot_Proxy_i_add_float;
+    vt->i_add_int = Parrot_Proxy_i_add_int;
+    vt->i_concatenate = Parrot_Proxy_i_concatenate;
+    vt->i_concatenate_str = Parrot_Proxy_i_concatenate_str;
+    vt->i_divide = Parrot_Proxy_i_divide;
+    vt->i_divide_float = Parrot_Proxy_i_divide_float;
+    vt->i_divide_int = Parrot_Proxy_i_divide_int;
+    vt->i_floor_divide = Parrot_Proxy_i_floor_divide;
+    vt->i_floor_divide_float = Parrot_Proxy_i_floor_divide_float;
+    vt->i_floor_divide_int = Parrot_Proxy_i_floor_divide_int;
+    vt->i_modulus = Parrot_Proxy_i_modulus;
+    vt->i_modulus_float = Parrot_Proxy_i_modulus_float;
+    vt->i_modulus_int = Parrot_Proxy_i_modulus_int;
+    vt->i_multiply = Parrot_Proxy_i_multiply;
+    vt->i_multiply_float = Parrot_Proxy_i_multiply_float;
+    vt->i_multiply_int = Parrot_Proxy_i_multiply_int;
+    vt->i_neg = Parrot_Proxy_i_neg;
+    vt->i_repeat = Parrot_Proxy_i_repeat;
+    vt->i_repeat_int = Parrot_Proxy_i_repeat_int;
+    vt->i_subtract = Parrot_Proxy_i_subtract;
+    vt->i_subtract_float = Parrot_Proxy_i_subtract_float;
+    vt->i_subtract_int = Parrot_Proxy_i_subtract_int;
+    vt->increment = Parrot_Proxy_increment;
+    vt->init = Parrot_Proxy_init;
+    vt->init_int = Parrot_Proxy_init_int;
+    vt->init_pmc = Parrot_Proxy_init_pmc;
+    vt->inspect = Parrot_Proxy_inspect;
+    vt->inspect_str = Parrot_Proxy_inspect_str;
+    vt->instantiate = Parrot_Proxy_instantiate;
+    vt->invoke = Parrot_Proxy_invoke;
+    vt->is_equal = Parrot_Proxy_is_equal;
+    vt->is_equal_num = Parrot_Proxy_is_equal_num;
+    vt->is_equal_string = Parrot_Proxy_is_equal_string;
+    vt->is_same = Parrot_Proxy_is_same;
+    vt->isa = Parrot_Proxy_isa;
+    vt->isa_pmc = Parrot_Proxy_isa_pmc;
+    vt->mark = Parrot_Proxy_mark;
+    vt->modulus = Parrot_Proxy_modulus;
+    vt->modulus_float = Parrot_Proxy_modulus_float;
+    vt->modulus_int = Parrot_Proxy_modulus_int;
+    vt->morph = Parrot_Proxy_morph;
+    vt->multiply = Parrot_Proxy_multiply;
+    vt->multiply_float = Parrot_Proxy_multiply_float;
+    vt->multiply_int = Parrot_Proxy_multiply_int;
+    vt->name = Parrot_Proxy_name;
+    vt->neg = Parrot_Proxy_neg;
+    vt->pop_float = Parrot_Proxy_pop_float;
+    vt->pop_integer = Parrot_Proxy_pop_integer;
+    vt->pop_pmc = Parrot_Proxy_pop_pmc;
+    vt->pop_string = Parrot_Proxy_pop_string;
+    vt->push_float = Parrot_Proxy_push_float;
+    vt->push_integer = Parrot_Proxy_push_integer;
+    vt->push_pmc = Parrot_Proxy_push_pmc;
+    vt->push_string = Parrot_Proxy_push_string;
+    vt->remove_attribute = Parrot_Proxy_remove_attribute;
+    vt->remove_method = Parrot_Proxy_remove_method;
+    vt->remove_parent = Parrot_Proxy_remove_parent;
+    vt->remove_role = Parrot_Proxy_remove_role;
+    vt->remove_vtable_override = Parrot_Proxy_remove_vtable_override;
+    vt->repeat = Parrot_Proxy_repeat;
+    vt->repeat_int = Parrot_Proxy_repeat_int;
+    vt->set_attr_keyed = Parrot_Proxy_set_attr_keyed;
+    vt->set_attr_str = Parrot_Proxy_set_attr_str;
+    vt->set_bool = Parrot_Proxy_set_bool;
+    vt->set_integer_keyed = Parrot_Proxy_set_integer_keyed;
+    vt->set_integer_keyed_int = Parrot_Proxy_set_integer_keyed_int;
+    vt->set_integer_keyed_str = Parrot_Proxy_set_integer_keyed_str;
+    vt->set_integer_native = Parrot_Proxy_set_integer_native;
+    vt->set_number_keyed = Parrot_Proxy_set_number_keyed;
+    vt->set_number_keyed_int = Parrot_Proxy_set_number_keyed_int;
+    vt->set_number_keyed_str = Parrot_Proxy_set_number_keyed_str;
+    vt->set_number_native = Parrot_Proxy_set_number_native;
+    vt->set_pmc = Parrot_Proxy_set_pmc;
+    vt->set_pmc_keyed = Parrot_Proxy_set_pmc_keyed;
+    vt->set_pmc_keyed_int = Parrot_Proxy_set_pmc_keyed_int;
+    vt->set_pmc_keyed_str = Parrot_Proxy_set_pmc_keyed_str;
+    vt->set_pointer = Parrot_Proxy_set_pointer;
+    vt->set_pointer_keyed = Parrot_Proxy_set_pointer_keyed;
+    vt->set_pointer_keyed_int = Parrot_Proxy_set_pointer_keyed_int;
+    vt->set_pointer_keyed_str = Parrot_Proxy_set_pointer_keyed_str;
+    vt->set_string_keyed = Parrot_Proxy_set_string_keyed;
+    vt->set_string_keyed_int = Parrot_Proxy_set_string_keyed_int;
+    vt->set_string_keyed_str = Parrot_Proxy_set_string_keyed_str;
+    vt->set_string_native = Parrot_Proxy_set_string_native;
+    vt->share = Parrot_Proxy_share;
+    vt->shift_float = Parrot_Proxy_shift_float;
+    vt->shift_integer = Parrot_Proxy_shift_integer;
+    vt->shift_pmc = Parrot_Proxy_shift_pmc;
+    vt->shift_string = Parrot_Proxy_shift_string;
+    vt->splice = Parrot_Proxy_splice;
+    vt->substr = Parrot_Proxy_substr;
+    vt->subtract = Parrot_Proxy_subtract;
+    vt->subtract_float = Parrot_Proxy_subtract_float;
+    vt->subtract_int = Parrot_Proxy_subtract_int;
+    vt->thaw = Parrot_Proxy_thaw;
+    vt->thawfinish = Parrot_Proxy_thawfinish;
+    vt->type = Parrot_Proxy_type;
+    vt->unshift_float = Parrot_Proxy_unshift_float;
+    vt->unshift_integer = Parrot_Proxy_unshift_integer;
+    vt->unshift_pmc = Parrot_Proxy_unshift_pmc;
+    vt->unshift_string = Parrot_Proxy_unshift_string;
+    vt->visit = Parrot_Proxy_visit;
+    vt->attr_size = sizeof(Parrot_Proxy_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_Proxy_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->absolute = Parrot_Proxy_absolute;
+    vt->add = Parrot_Proxy_add;
+    vt->add_float = Parrot_Proxy_add_float;
+    vt->add_int = Parrot_Proxy_add_int;
+    vt->clone = Parrot_Proxy_clone;
+    vt->clone_pmc = Parrot_Proxy_clone_pmc;
+    vt->cmp = Parrot_Proxy_cmp;
+    vt->cmp_num = Parrot_Proxy_cmp_num;
+    vt->cmp_pmc = Parrot_Proxy_cmp_pmc;
+    vt->cmp_string = Parrot_Proxy_cmp_string;
+    vt->concatenate = Parrot_Proxy_concatenate;
+    vt->concatenate_str = Parrot_Proxy_concatenate_str;
+    vt->defined = Parrot_Proxy_defined;
+    vt->defined_keyed = Parrot_Proxy_defined_keyed;
+    vt->defined_keyed_int = Parrot_Proxy_defined_keyed_int;
+    vt->defined_keyed_str = Parrot_Proxy_defined_keyed_str;
+    vt->destroy = Parrot_Proxy_destroy;
+    vt->divide = Parrot_Proxy_divide;
+    vt->divide_float = Parrot_Proxy_divide_float;
+    vt->divide_int = Parrot_Proxy_divide_int;
+    vt->does = Parrot_Proxy_does;
+    vt->does_pmc = Parrot_Proxy_does_pmc;
+    vt->elements = Parrot_Proxy_elements;
+    vt->exists_keyed = Parrot_Proxy_exists_keyed;
+    vt->exists_keyed_int = Parrot_Proxy_exists_keyed_int;
+    vt->exists_keyed_str = Parrot_Proxy_exists_keyed_str;
+    vt->find_method = Parrot_Proxy_find_method;
+    vt->floor_divide = Parrot_Proxy_floor_divide;
+    vt->floor_divide_float = Parrot_Proxy_floor_divide_float;
+    vt->floor_divide_int = Parrot_Proxy_floor_divide_int;
+    vt->freeze = Parrot_Proxy_freeze;
+    vt->get_attr_keyed = Parrot_Proxy_get_attr_keyed;
+    vt->get_attr_str = Parrot_Proxy_get_attr_str;
+    vt->get_bool = Parrot_Proxy_get_bool;
+    vt->get_class = Parrot_Proxy_get_class;
+    vt->get_integer = Parrot_Proxy_get_integer;
+    vt->get_integer_keyed = Parrot_Proxy_get_integer_keyed;
+    vt->get_integer_keyed_int = Parrot_Proxy_get_integer_keyed_int;
+    vt->get_integer_keyed_str = Parrot_Proxy_get_integer_keyed_str;
+    vt->get_iter = Parrot_Proxy_get_iter;
+    vt->get_namespace = Parrot_Proxy_get_namespace;
+    vt->get_number = Parrot_Proxy_get_number;
+    vt->get_number_keyed = Parrot_Proxy_get_number_keyed;
+    vt->get_number_keyed_int = Parrot_Proxy_get_number_keyed_int;
+    vt->get_number_keyed_str = Parrot_Proxy_get_number_keyed_str;
+    vt->get_pmc = Parrot_Proxy_get_pmc;
+    vt->get_pmc_keyed = Parrot_Proxy_get_pmc_keyed;
+    vt->get_pmc_keyed_int = Parrot_Proxy_get_pmc_keyed_int;
+    vt->get_pmc_keyed_str = Parrot_Proxy_get_pmc_keyed_str;
+    vt->get_pointer = Parrot_Proxy_get_pointer;
+    vt->get_pointer_keyed = Parrot_Proxy_get_pointer_keyed;
+    vt->get_pointer_keyed_int = Parrot_Proxy_get_pointer_keyed_int;
+    vt->get_pointer_keyed_str = Parrot_Proxy_get_pointer_keyed_str;
+    vt->get_repr = Parrot_Proxy_get_repr;
+    vt->get_string = Parrot_Proxy_get_string;
+    vt->get_string_keyed = Parrot_Proxy_get_string_keyed;
+    vt->get_string_keyed_int = Parrot_Proxy_get_string_keyed_int;
+    vt->get_string_keyed_str = Parrot_Proxy_get_string_keyed_str;
+    vt->hashvalue = Parrot_Proxy_hashvalue;
+    vt->inspect = Parrot_Proxy_inspect;
+    vt->inspect_str = Parrot_Proxy_inspect_str;
+    vt->instantiate = Parrot_Proxy_instantiate;
+    vt->invoke = Parrot_Proxy_invoke;
+    vt->is_equal = Parrot_Proxy_is_equal;
+    vt->is_equal_num = Parrot_Proxy_is_equal_num;
+    vt->is_equal_string = Parrot_Proxy_is_equal_string;
+    vt->is_same = Parrot_Proxy_is_same;
+    vt->isa = Parrot_Proxy_isa;
+    vt->isa_pmc = Parrot_Proxy_isa_pmc;
+    vt->mark = Parrot_Proxy_mark;
+    vt->modulus = Parrot_Proxy_modulus;
+    vt->modulus_float = Parrot_Proxy_modulus_float;
+    vt->modulus_int = Parrot_Proxy_modulus_int;
+    vt->multiply = Parrot_Proxy_multiply;
+    vt->multiply_float = Parrot_Proxy_multiply_float;
+    vt->multiply_int = Parrot_Proxy_multiply_int;
+    vt->name = Parrot_Proxy_name;
+    vt->neg = Parrot_Proxy_neg;
+    vt->repeat = Parrot_Proxy_repeat;
+    vt->repeat_int = Parrot_Proxy_repeat_int;
+    vt->substr = Parrot_Proxy_substr;
+    vt->subtract = Parrot_Proxy_subtract;
+    vt->subtract_float = Parrot_Proxy_subtract_float;
+    vt->subtract_int = Parrot_Proxy_subtract_int;
+    vt->type = Parrot_Proxy_type;
+    vt->visit = Parrot_Proxy_visit;
+    vt->attr_size = sizeof(Parrot_Proxy_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Proxy_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_Proxy_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Proxy_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_Proxy_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_Proxy_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "Proxy"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_Proxy_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "Proxy")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_Proxy_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "Ftarget :interp ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_Proxy_get_vtable(interp);
+        vt->base_type      = enum_class_Proxy;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "Proxy");
+        vt->provides_str = CONST_STRING_GEN(interp, "scalar");
+        vt->isa_hash     = Parrot_Proxy_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_Proxy_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_Proxy;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_Proxy_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+        }
+    } /* pass */
+} /* Parrot_Proxy_class_init */
+
+#line 182 "./src/pmc/proxy.pmc"
+
+
+/*
+
+=back
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -0,0 +1,210 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/ptrbuf.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_ptrbuf.h"
+#include "pmc_ptr.h"
+#include "pmc_default.h"
+#include "ptrbuf.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/ptrbuf.pmc"
+/*
+Copyright (C) 2011-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/ptrbuf.pmc - PtrBuf PMC
+
+=head1 DESCRIPTION
+
+C<PtrBuf> is a pointer to a buffer. No affordances for memory management have
+been made. It has two things - a pointer and a size.
+
+=head2 VTABLEs
+
+=over 4
+
+=cut
+
+*/
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+#line 47 "./src/pmc/ptrbuf.c"
+static  INTVAL  Parrot_PtrBuf_get_integer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_PtrBuf_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_PtrBuf_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL i);
+void    Parrot_PtrBuf_class_init(PARROT_INTERP, int, int);
+void    Parrot_PtrBuf_ro_class_init(PARROT_INTERP, int, int);
+static  INTVAL 
+Parrot_PtrBuf_get_integer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 54 "./src/pmc/ptrbuf.pmc"
+
+    INTVAL i;
+    GETATTR_PtrBuf_size(interp, _self, i);
+    return i;
+#line 61 "./src/pmc/ptrbuf.c"
+}
+static  void 
+Parrot_PtrBuf_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 38 "./src/pmc/ptrbuf.pmc"
+
+    PTR_FAT_SET(interp, _self);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 70 "./src/pmc/ptrbuf.c"
+}
+static  void 
+Parrot_PtrBuf_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL i)
+{
+#line 60 "./src/pmc/ptrbuf.pmc"
+
+    SETATTR_PtrBuf_size(interp, _self, i);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 79 "./src/pmc/ptrbuf.c"
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_PtrBuf_update_vtable(VTABLE *vt) {
+    vt->get_integer = Parrot_PtrBuf_get_integer;
+    vt->init = Parrot_PtrBuf_init;
+    vt->set_integer_native = Parrot_PtrBuf_set_integer_native;
+    vt->attr_size = sizeof(Parrot_PtrBuf_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_PtrBuf_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->get_integer = Parrot_PtrBuf_get_integer;
+    vt->attr_size = sizeof(Parrot_PtrBuf_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_PtrBuf_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_Ptr_get_vtable(interp);
+    Parrot_PtrBuf_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_PtrBuf_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_Ptr_ro_get_vtable(interp);
+    Parrot_PtrBuf_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_PtrBuf_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+    mro = Parrot_Ptr_get_mro(interp, mro);
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "PtrBuf"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_PtrBuf_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    isa = Parrot_Ptr_get_isa(interp, isa);
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "PtrBuf")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_PtrBuf_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        ":ptr :size ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_PtrBuf_get_vtable(interp);
+        vt->base_type      = enum_class_PtrBuf;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "PtrBuf");
+        vt->provides_str = CONST_STRING_GEN(interp, "scalar");
+        vt->isa_hash     = Parrot_PtrBuf_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_PtrBuf_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_PtrBuf;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_PtrBuf_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+        }
+    } /* pass */
+} /* Parrot_PtrBuf_class_init */
+
+#line 62 "./src/pmc/ptrbuf.pmc"
+
+
+/*
+
+=back
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
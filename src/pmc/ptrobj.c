@@ -0,0 +1,455 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/ptrobj.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_fixedintegerarray.h"
+#include "pmc_ptrobj.h"
+#include "pmc_ptrbuf.h"
+#include "pmc_default.h"
+#include "ptrobj.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/ptrobj.pmc"
+/*
+Copyright (C) 2011-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/ptrobj.pmc - PtrObj PMC
+
+=head1 DESCRIPTION
+
+C<PtrObj> is for object-ish pointers. These augment C<PtrBuf> to afford
+memory management.
+
+=head2 VTABLEs
+
+=over 4
+
+=cut
+
+*/
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+
+#line 49 "./src/pmc/ptrobj.c"
+static  PMC  * Parrot_PtrObj_clone(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_PtrObj_destroy(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_PtrObj_mark(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_PtrObj_nci_clone_func(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_PtrObj_nci_mark_func(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_PtrObj_nci_destroy_func(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_PtrObj_class_init(PARROT_INTERP, int, int);
+void    Parrot_PtrObj_ro_class_init(PARROT_INTERP, int, int);
+static  PMC  *
+Parrot_PtrObj_clone(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 45 "./src/pmc/ptrobj.pmc"
+
+    void                *ptr;
+    ptrobj_clone_func_t  clone;
+    GETATTR_PtrObj_ptr(interp, _self, ptr);
+    GETATTR_PtrObj_clone(interp, _self, clone);
+    if (clone)
+        return clone(interp, _self, ptr);
+    else
+        Parrot_ex_throw_from_c_args(interp, NULL, 0,
+                "clone not implemented for PtrObj %x", ptr);
+#line 72 "./src/pmc/ptrobj.c"
+}
+static  void 
+Parrot_PtrObj_destroy(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 125 "./src/pmc/ptrobj.pmc"
+
+    void                  *ptr;
+    ptrobj_destroy_func_t  destroy;
+    GETATTR_PtrObj_ptr(interp, _self, ptr);
+    GETATTR_PtrObj_destroy(interp, _self, destroy);
+    /* invariant: custom destroy flag only set when a destroy function has been provided */
+    PARROT_ASSERT(destroy);
+    destroy(interp, _self, ptr);
+#line 86 "./src/pmc/ptrobj.c"
+}
+static  void 
+Parrot_PtrObj_mark(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 86 "./src/pmc/ptrobj.pmc"
+
+    void               *ptr;
+    ptrobj_mark_func_t  mark;
+    GETATTR_PtrObj_ptr(interp, _self, ptr);
+    GETATTR_PtrObj_mark(interp, _self, mark);
+    /* invariant: custom mark flag only set when a custom mark function has been provided */
+    PARROT_ASSERT(mark);
+    mark(interp, _self, ptr);
+#line 100 "./src/pmc/ptrobj.c"
+}
+static  void
+Parrot_PtrObj_nci_clone_func(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* func;
+    INTVAL has_func;
+    
+    const INTVAL arity = 1; /* "PiPoIp" */
+    const INTVAL arity_opt  = 1;
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count < arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too few arguments: %d passed, %d expected",
+                                    param_count, arity);
+    if (param_count > arity + arity_opt)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too many arguments: %d passed, %d expected",
+                                    param_count, arity + arity_opt);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    if (param_count > 1) {
+        func = VTABLE_get_pmc_keyed_int(interp, _call_object, 1);
+        has_func = 1;
+    }
+    else {
+        func = PMCNULL;
+        has_func = 0;
+    }
+
+    { /* BEGIN PMETHOD BODY */
+#line 57 "./src/pmc/ptrobj.pmc"
+
+    if (has_func) {
+        void * const f = VTABLE_get_pointer(interp, func);
+        PTROBJ_SET_CLONE(interp, _self, (ptrobj_clone_func_t)f);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        #line 142 "./src/pmc/ptrobj.c"
+    return ;
+#line 62 "./src/pmc/ptrobj.pmc"
+
+    }
+    else {
+        ptrobj_clone_func_t f;
+        GETATTR_PtrObj_clone(interp, _self, f);
+        func = Parrot_pmc_new_init_int(interp, enum_class_Ptr, (INTVAL)f);
+        #line 151 "./src/pmc/ptrobj.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)func);
+        
+        return;
+     }
+#line 68 "./src/pmc/ptrobj.pmc"
+
+    }
+#line 160 "./src/pmc/ptrobj.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_PtrObj_nci_mark_func(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* func;
+    INTVAL has_func;
+    
+    const INTVAL arity = 1; /* "PiPoIp" */
+    const INTVAL arity_opt  = 1;
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count < arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too few arguments: %d passed, %d expected",
+                                    param_count, arity);
+    if (param_count > arity + arity_opt)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too many arguments: %d passed, %d expected",
+                                    param_count, arity + arity_opt);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    if (param_count > 1) {
+        func = VTABLE_get_pmc_keyed_int(interp, _call_object, 1);
+        has_func = 1;
+    }
+    else {
+        func = PMCNULL;
+        has_func = 0;
+    }
+
+    { /* BEGIN PMETHOD BODY */
+#line 96 "./src/pmc/ptrobj.pmc"
+
+    if (has_func) {
+        void * const f = VTABLE_get_pointer(interp, func);
+        PTROBJ_SET_MARK(interp, _self, (ptrobj_mark_func_t)f);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        #line 209 "./src/pmc/ptrobj.c"
+    return ;
+#line 101 "./src/pmc/ptrobj.pmc"
+
+    }
+    else {
+        ptrobj_mark_func_t f;
+        GETATTR_PtrObj_mark(interp, _self, f);
+        func = Parrot_pmc_new_init_int(interp, enum_class_Ptr, (INTVAL)f);
+        #line 218 "./src/pmc/ptrobj.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)func);
+        
+        return;
+     }
+#line 107 "./src/pmc/ptrobj.pmc"
+
+    }
+#line 227 "./src/pmc/ptrobj.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_PtrObj_nci_destroy_func(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* func;
+    INTVAL has_func;
+    
+    const INTVAL arity = 1; /* "PiPoIp" */
+    const INTVAL arity_opt  = 1;
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count < arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too few arguments: %d passed, %d expected",
+                                    param_count, arity);
+    if (param_count > arity + arity_opt)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too many arguments: %d passed, %d expected",
+                                    param_count, arity + arity_opt);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    if (param_count > 1) {
+        func = VTABLE_get_pmc_keyed_int(interp, _call_object, 1);
+        has_func = 1;
+    }
+    else {
+        func = PMCNULL;
+        has_func = 0;
+    }
+
+    { /* BEGIN PMETHOD BODY */
+#line 135 "./src/pmc/ptrobj.pmc"
+
+    if (has_func) {
+        void * const f = VTABLE_get_pointer(interp, func);
+        PTROBJ_SET_DESTROY(interp, _self, (ptrobj_destroy_func_t)f);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        #line 276 "./src/pmc/ptrobj.c"
+    return ;
+#line 140 "./src/pmc/ptrobj.pmc"
+
+    }
+    else {
+        ptrobj_destroy_func_t f;
+        GETATTR_PtrObj_destroy(interp, _self, f);
+        func = Parrot_pmc_new_init_int(interp, enum_class_Ptr, (INTVAL)f);
+        #line 285 "./src/pmc/ptrobj.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)func);
+        
+        return;
+     }
+#line 146 "./src/pmc/ptrobj.pmc"
+
+    }
+#line 294 "./src/pmc/ptrobj.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_PtrObj_update_vtable(VTABLE *vt) {
+    vt->clone = Parrot_PtrObj_clone;
+    vt->destroy = Parrot_PtrObj_destroy;
+    vt->mark = Parrot_PtrObj_mark;
+    vt->attr_size = sizeof(Parrot_PtrObj_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_PtrObj_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->clone = Parrot_PtrObj_clone;
+    vt->destroy = Parrot_PtrObj_destroy;
+    vt->mark = Parrot_PtrObj_mark;
+    vt->attr_size = sizeof(Parrot_PtrObj_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_PtrObj_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_PtrBuf_get_vtable(interp);
+    Parrot_PtrObj_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_PtrObj_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_PtrBuf_ro_get_vtable(interp);
+    Parrot_PtrObj_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_PtrObj_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+    mro = Parrot_PtrBuf_get_mro(interp, mro);
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "PtrObj"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_PtrObj_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    isa = Parrot_PtrBuf_get_isa(interp, isa);
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "PtrObj")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_PtrObj_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        ":ptr :size :clone :mark :destroy ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_PtrObj_get_vtable(interp);
+        vt->base_type      = enum_class_PtrObj;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "PtrObj");
+        vt->provides_str = CONST_STRING_GEN(interp, "scalar");
+        vt->isa_hash     = Parrot_PtrObj_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_PtrObj_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_PtrObj;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_PtrObj_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "clone_func");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_PtrObj_nci_clone_func),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "mark_func");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_PtrObj_nci_mark_func),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "destroy_func");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_PtrObj_nci_destroy_func),
+                method_name, signature);
+        }
+        {
+        }
+    } /* pass */
+} /* Parrot_PtrObj_class_init */
+
+#line 148 "./src/pmc/ptrobj.pmc"
+
+
+/*
+
+=back
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
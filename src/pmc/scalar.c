@@ -0,0 +1,1654 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/scalar.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_scalar.h"
+#include "pmc_default.h"
+#include "scalar.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/scalar.pmc"
+/*
+Copyright (C) 2001-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/scalar.pmc - Scalar PMC
+
+=head1 DESCRIPTION
+
+These are the vtable functions for the abstract base PMC class for scalars.
+
+=head2 Methods
+
+=over 4
+
+=cut
+
+*/
+
+#include "pmc/pmc_bigint.h"
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+#line 47 "./src/pmc/scalar.c"
+static  PMC * Parrot_scalar_add(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest);
+static  PMC  * Parrot_scalar_add_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest);
+static  PMC  * Parrot_scalar_add_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest);
+static  void  Parrot_scalar_assign_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  INTVAL Parrot_scalar_cmp_num(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  INTVAL Parrot_scalar_cmp_string(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  PMC  * Parrot_scalar_concatenate(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest);
+static  PMC  * Parrot_scalar_concatenate_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value, PMC *dest);
+static  INTVAL  Parrot_scalar_defined(SHIM_INTERP, SHIM(PMC *_self));
+static  PMC * Parrot_scalar_divide(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest);
+static  PMC  * Parrot_scalar_divide_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest);
+static  PMC  * Parrot_scalar_divide_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest);
+static  PMC * Parrot_scalar_floor_divide(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest);
+static  PMC  * Parrot_scalar_floor_divide_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest);
+static  PMC  * Parrot_scalar_floor_divide_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest);
+static  void Parrot_scalar_i_add(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void  Parrot_scalar_i_add_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value);
+static  void  Parrot_scalar_i_add_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void  Parrot_scalar_i_concatenate(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void  Parrot_scalar_i_concatenate_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value);
+static  void  Parrot_scalar_i_divide(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void  Parrot_scalar_i_divide_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value);
+static  void  Parrot_scalar_i_divide_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void  Parrot_scalar_i_floor_divide(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void  Parrot_scalar_i_floor_divide_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value);
+static  void  Parrot_scalar_i_floor_divide_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void  Parrot_scalar_i_modulus(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void  Parrot_scalar_i_modulus_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value);
+static  void  Parrot_scalar_i_modulus_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void Parrot_scalar_i_multiply(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void  Parrot_scalar_i_multiply_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value);
+static  void  Parrot_scalar_i_multiply_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void  Parrot_scalar_i_neg(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_scalar_i_repeat(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void  Parrot_scalar_i_repeat_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void Parrot_scalar_i_subtract(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void  Parrot_scalar_i_subtract_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value);
+static  void  Parrot_scalar_i_subtract_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  INTVAL Parrot_scalar_is_equal_num(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  INTVAL Parrot_scalar_is_equal_string(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  PMC * Parrot_scalar_modulus(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest);
+static  PMC  * Parrot_scalar_modulus_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest);
+static  PMC  * Parrot_scalar_modulus_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest);
+static  PMC * Parrot_scalar_multiply(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest);
+static  PMC  * Parrot_scalar_multiply_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest);
+static  PMC  * Parrot_scalar_multiply_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest);
+static  PMC  * Parrot_scalar_neg(PARROT_INTERP, ARGMOD(PMC *_self), PMC *dest);
+static  PMC  * Parrot_scalar_repeat(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest);
+static  PMC  * Parrot_scalar_repeat_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest);
+static  STRING  * Parrot_scalar_substr(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL offset, INTVAL length);
+static  PMC * Parrot_scalar_subtract(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest);
+static  PMC  * Parrot_scalar_subtract_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest);
+static  PMC  * Parrot_scalar_subtract_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest);
+static  PMC  * Parrot_scalar_multi_add_Complex_PMC(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest);
+static  PMC  * Parrot_scalar_multi_add_DEFAULT_PMC(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest);
+static  void  Parrot_scalar_multi_i_add_Complex(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void  Parrot_scalar_multi_i_add_DEFAULT(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  PMC  * Parrot_scalar_multi_subtract_Complex_PMC(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest);
+static  PMC  * Parrot_scalar_multi_subtract_DEFAULT_PMC(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest);
+static  void  Parrot_scalar_multi_i_subtract_Complex(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void  Parrot_scalar_multi_i_subtract_DEFAULT(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  PMC  * Parrot_scalar_multi_multiply_Complex_PMC(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value), SHIM(PMC *dest));
+static  PMC  * Parrot_scalar_multi_multiply_DEFAULT_PMC(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest);
+static  void  Parrot_scalar_multi_i_multiply_Complex(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value));
+static  void  Parrot_scalar_multi_i_multiply_DEFAULT(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  PMC  * Parrot_scalar_multi_divide_PMC_PMC(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest);
+static  PMC  * Parrot_scalar_multi_floor_divide_PMC_PMC(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest);
+static  PMC  * Parrot_scalar_multi_modulus_PMC_PMC(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest);
+static  INTVAL  Parrot_scalar_multi_cmp_num_PMC(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  INTVAL  Parrot_scalar_multi_cmp_string_PMC(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  INTVAL  Parrot_scalar_multi_is_equal_num_PMC(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  INTVAL  Parrot_scalar_multi_is_equal_string_PMC(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void Parrot_scalar_multi_add_Complex_PMC_pcc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_scalar_multi_add_DEFAULT_PMC_pcc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_scalar_multi_i_add_Complex_pcc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_scalar_multi_i_add_DEFAULT_pcc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_scalar_multi_subtract_Complex_PMC_pcc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_scalar_multi_subtract_DEFAULT_PMC_pcc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_scalar_multi_i_subtract_Complex_pcc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_scalar_multi_i_subtract_DEFAULT_pcc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_scalar_multi_multiply_Complex_PMC_pcc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_scalar_multi_multiply_DEFAULT_PMC_pcc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_scalar_multi_i_multiply_Complex_pcc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_scalar_multi_i_multiply_DEFAULT_pcc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_scalar_multi_divide_PMC_PMC_pcc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_scalar_multi_floor_divide_PMC_PMC_pcc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_scalar_multi_modulus_PMC_PMC_pcc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_scalar_multi_cmp_num_PMC_pcc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_scalar_multi_cmp_string_PMC_pcc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_scalar_multi_is_equal_num_PMC_pcc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_scalar_multi_is_equal_string_PMC_pcc(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_scalar_class_init(PARROT_INTERP, int, int);
+void    Parrot_scalar_ro_class_init(PARROT_INTERP, int, int);
+static  PMC *
+Parrot_scalar_add(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest)
+{
+    INTVAL type = VTABLE_type(interp, value);
+    /* For dynpmc fallback to MMD */
+    if ((type >= enum_class_core_max) || (VTABLE_type(interp, _self) >= enum_class_core_max))
+        type = enum_class_core_max;
+    switch(type) {
+        case enum_class_Complex:
+            return Parrot_scalar_multi_add_Complex_PMC(interp, _self, value, dest);
+            break;
+        case enum_class_core_max:
+            {
+                PMC *retval = PMCNULL;
+                Parrot_mmd_multi_dispatch_from_c_args(interp, "add", "PPP->P", _self, value, dest, &retval);
+                return retval;
+            }
+            break;
+        default:
+            return Parrot_scalar_multi_add_DEFAULT_PMC(interp, _self, value, dest);
+            break;
+
+    }
+}
+static  PMC  *
+Parrot_scalar_add_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest)
+{
+#line 148 "./src/pmc/scalar.pmc"
+
+    dest = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+
+    VTABLE_set_number_native(interp, dest,
+            VTABLE_get_number(interp, _self) + value);
+    return dest;
+#line 175 "./src/pmc/scalar.c"
+}
+static  PMC  *
+Parrot_scalar_add_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest)
+{
+#line 140 "./src/pmc/scalar.pmc"
+
+    dest = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+
+    VTABLE_set_number_native(interp, dest,
+            VTABLE_get_number(interp, _self) + (FLOATVAL)value);
+    return dest;
+#line 187 "./src/pmc/scalar.c"
+}
+static  void 
+Parrot_scalar_assign_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 39 "./src/pmc/scalar.pmc"
+
+    const INTVAL self_type = VTABLE_type(interp, _self);
+    const INTVAL val_type  = VTABLE_type(interp, value);
+
+    if (self_type == enum_class_Boolean)
+        /* doesn't morph */
+        Parrot_pmc_reuse(interp, _self, val_type, 0);
+
+    if (val_type == enum_class_Undef) {
+        Parrot_pmc_reuse(interp, _self, val_type, 0);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return;
+    }
+
+    if (VTABLE_isa(interp, value, CONST_STRING(interp, "Undef"))) {
+        Parrot_pmc_reuse(interp, _self, enum_class_Undef, 0);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return;
+    }
+
+    if (VTABLE_isa(interp, value, CONST_STRING(interp, "Integer"))) {
+        const INTVAL v = VTABLE_get_integer(interp, value);
+        VTABLE_set_integer_native(interp, _self, v);
+        /* PARROT_GC_WRITE_BARRIER(interp, _self); */
+        return;
+    }
+
+    if (VTABLE_isa(interp, value, CONST_STRING(interp, "Float"))) {
+        const FLOATVAL v = VTABLE_get_number(interp, value);
+        VTABLE_set_number_native(interp, _self, v);
+        /* PARROT_GC_WRITE_BARRIER(interp, _self); */
+        return;
+    }
+
+    if (VTABLE_isa(interp, value, CONST_STRING(interp, "String"))) {
+        STRING * const v = VTABLE_get_string(interp, value);
+        VTABLE_set_string_native(interp, _self, v);
+        /* PARROT_GC_WRITE_BARRIER(interp, _self); */
+        return;
+    }
+    Parrot_pmc_reuse(interp, _self, val_type, 0);
+    VTABLE_set_pmc(interp, _self, value);
+    /* PARROT_GC_WRITE_BARRIER(interp, _self); */
+#line 236 "./src/pmc/scalar.c"
+}
+static  INTVAL
+Parrot_scalar_cmp_num(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+    INTVAL type = VTABLE_type(interp, value);
+    /* For dynpmc fallback to MMD */
+    if ((type >= enum_class_core_max) || (VTABLE_type(interp, _self) >= enum_class_core_max))
+        type = enum_class_core_max;
+    switch(type) {
+        case enum_class_core_max:
+            {
+                INTVAL retval;
+                Parrot_mmd_multi_dispatch_from_c_args(interp, "cmp_num", "PP->I", _self, value, &retval);
+                return retval;
+            }
+            break;
+        default:
+            return Parrot_scalar_multi_cmp_num_PMC(interp, _self, value);
+            break;
+
+    }
+}
+static  INTVAL
+Parrot_scalar_cmp_string(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+    INTVAL type = VTABLE_type(interp, value);
+    /* For dynpmc fallback to MMD */
+    if ((type >= enum_class_core_max) || (VTABLE_type(interp, _self) >= enum_class_core_max))
+        type = enum_class_core_max;
+    switch(type) {
+        case enum_class_core_max:
+            {
+                INTVAL retval;
+                Parrot_mmd_multi_dispatch_from_c_args(interp, "cmp_string", "PP->I", _self, value, &retval);
+                return retval;
+            }
+            break;
+        default:
+            return Parrot_scalar_multi_cmp_string_PMC(interp, _self, value);
+            break;
+
+    }
+}
+static  PMC  *
+Parrot_scalar_concatenate(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest)
+{
+#line 642 "./src/pmc/scalar.pmc"
+
+    STRING * const s = Parrot_str_concat(interp, VTABLE_get_string(interp, _self),
+        VTABLE_get_string(interp, value));
+
+    dest = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+
+    VTABLE_set_string_native(interp, dest, s);
+    return dest;
+#line 292 "./src/pmc/scalar.c"
+}
+static  PMC  *
+Parrot_scalar_concatenate_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value, PMC *dest)
+{
+#line 652 "./src/pmc/scalar.pmc"
+
+    STRING * const s = Parrot_str_concat(interp,
+        VTABLE_get_string(interp, _self), value);
+
+    dest = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+
+    VTABLE_set_string_native(interp, dest, s);
+    return dest;
+#line 306 "./src/pmc/scalar.c"
+}
+static  INTVAL 
+Parrot_scalar_defined(SHIM_INTERP, SHIM(PMC *_self))
+{
+#line 826 "./src/pmc/scalar.pmc"
+    return 1;
+#line 313 "./src/pmc/scalar.c"
+}
+static  PMC *
+Parrot_scalar_divide(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest)
+{
+    INTVAL type = VTABLE_type(interp, value);
+    /* For dynpmc fallback to MMD */
+    if ((type >= enum_class_core_max) || (VTABLE_type(interp, _self) >= enum_class_core_max))
+        type = enum_class_core_max;
+    switch(type) {
+        case enum_class_core_max:
+            {
+                PMC *retval = PMCNULL;
+                Parrot_mmd_multi_dispatch_from_c_args(interp, "divide", "PPP->P", _self, value, dest, &retval);
+                return retval;
+            }
+            break;
+        default:
+            return Parrot_scalar_multi_divide_PMC_PMC(interp, _self, value, dest);
+            break;
+
+    }
+}
+static  PMC  *
+Parrot_scalar_divide_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest)
+{
+#line 377 "./src/pmc/scalar.pmc"
+
+    if (FLOAT_IS_ZERO(value))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_DIV_BY_ZERO,
+            "float division by zero");
+
+    dest = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+
+    VTABLE_set_number_native(interp, dest, VTABLE_get_number(interp, _self) / value);
+    return dest;
+#line 349 "./src/pmc/scalar.c"
+}
+static  PMC  *
+Parrot_scalar_divide_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest)
+{
+#line 366 "./src/pmc/scalar.pmc"
+
+    if (value == 0)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_DIV_BY_ZERO,
+            "float division by zero");
+
+    dest = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+
+    VTABLE_set_number_native(interp, dest, VTABLE_get_number(interp, _self) / value);
+    return dest;
+#line 364 "./src/pmc/scalar.c"
+}
+static  PMC *
+Parrot_scalar_floor_divide(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest)
+{
+    INTVAL type = VTABLE_type(interp, value);
+    /* For dynpmc fallback to MMD */
+    if ((type >= enum_class_core_max) || (VTABLE_type(interp, _self) >= enum_class_core_max))
+        type = enum_class_core_max;
+    switch(type) {
+        case enum_class_core_max:
+            {
+                PMC *retval = PMCNULL;
+                Parrot_mmd_multi_dispatch_from_c_args(interp, "floor_divide", "PPP->P", _self, value, dest, &retval);
+                return retval;
+            }
+            break;
+        default:
+            return Parrot_scalar_multi_floor_divide_PMC_PMC(interp, _self, value, dest);
+            break;
+
+    }
+}
+static  PMC  *
+Parrot_scalar_floor_divide_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest)
+{
+#line 462 "./src/pmc/scalar.pmc"
+
+    if (FLOAT_IS_ZERO(value))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_DIV_BY_ZERO,
+            "float division by zero");
+
+    dest = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+
+    VTABLE_set_number_native(interp, dest,
+            floor(VTABLE_get_number(interp, _self) / value));
+    return dest;
+#line 401 "./src/pmc/scalar.c"
+}
+static  PMC  *
+Parrot_scalar_floor_divide_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest)
+{
+#line 450 "./src/pmc/scalar.pmc"
+
+    if (value == 0)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_DIV_BY_ZERO,
+            "float division by zero");
+
+    dest = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+
+    VTABLE_set_number_native(interp, dest,
+            floor(VTABLE_get_number(interp, _self) / value));
+    return dest;
+#line 417 "./src/pmc/scalar.c"
+}
+static  void
+Parrot_scalar_i_add(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+    INTVAL type = VTABLE_type(interp, value);
+    /* For dynpmc fallback to MMD */
+    if ((type >= enum_class_core_max) || (VTABLE_type(interp, _self) >= enum_class_core_max))
+        type = enum_class_core_max;
+    switch(type) {
+        case enum_class_Complex:
+            Parrot_scalar_multi_i_add_Complex(interp, _self, value);
+            break;
+        case enum_class_core_max:
+            Parrot_mmd_multi_dispatch_from_c_args(interp, "i_add", "PP->", _self, value);
+            break;
+        default:
+            Parrot_scalar_multi_i_add_DEFAULT(interp, _self, value);
+            break;
+
+    }
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void 
+Parrot_scalar_i_add_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value)
+{
+#line 176 "./src/pmc/scalar.pmc"
+
+    VTABLE_set_number_native(interp, _self,
+        VTABLE_get_number(interp, _self) + value);
+#line 447 "./src/pmc/scalar.c"
+}
+static  void 
+Parrot_scalar_i_add_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+#line 171 "./src/pmc/scalar.pmc"
+
+    VTABLE_set_number_native(interp, _self,
+        VTABLE_get_number(interp, _self) + (FLOATVAL)value);
+#line 456 "./src/pmc/scalar.c"
+}
+static  void 
+Parrot_scalar_i_concatenate(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 662 "./src/pmc/scalar.pmc"
+
+    STRING * const s = VTABLE_get_string(interp, _self);
+    STRING * const v = VTABLE_get_string(interp, value);
+    VTABLE_set_string_native(interp, _self, Parrot_str_concat(interp, s, v));
+#line 466 "./src/pmc/scalar.c"
+}
+static  void 
+Parrot_scalar_i_concatenate_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value)
+{
+#line 668 "./src/pmc/scalar.pmc"
+
+    STRING * const s = VTABLE_get_string(interp, _self);
+    VTABLE_set_string_native(interp, _self, Parrot_str_concat(interp, s, value));
+#line 475 "./src/pmc/scalar.c"
+}
+static  void 
+Parrot_scalar_i_divide(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 388 "./src/pmc/scalar.pmc"
+
+    const FLOATVAL d = VTABLE_get_number(interp, value);
+
+    if (FLOAT_IS_ZERO(d))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_DIV_BY_ZERO,
+            "float division by zero");
+
+    VTABLE_set_number_native(interp, _self, VTABLE_get_number(interp, _self) / d);
+#line 489 "./src/pmc/scalar.c"
+}
+static  void 
+Parrot_scalar_i_divide_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value)
+{
+#line 406 "./src/pmc/scalar.pmc"
+
+    if (FLOAT_IS_ZERO(value))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_DIV_BY_ZERO,
+            "float division by zero");
+
+    VTABLE_set_number_native(interp, _self, VTABLE_get_number(interp, _self) / value);
+#line 501 "./src/pmc/scalar.c"
+}
+static  void 
+Parrot_scalar_i_divide_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+#line 398 "./src/pmc/scalar.pmc"
+
+    if (value == 0)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_DIV_BY_ZERO,
+            "float division by zero");
+
+    VTABLE_set_number_native(interp, _self, VTABLE_get_number(interp, _self) / value);
+#line 513 "./src/pmc/scalar.c"
+}
+static  void 
+Parrot_scalar_i_floor_divide(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 474 "./src/pmc/scalar.pmc"
+
+    const FLOATVAL d = VTABLE_get_number(interp, value);
+
+    if (FLOAT_IS_ZERO(d))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_DIV_BY_ZERO,
+            "float division by zero");
+
+    VTABLE_set_number_native(interp, _self,
+            floor(VTABLE_get_number(interp, _self) / d));
+#line 528 "./src/pmc/scalar.c"
+}
+static  void 
+Parrot_scalar_i_floor_divide_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value)
+{
+#line 494 "./src/pmc/scalar.pmc"
+
+    if (FLOAT_IS_ZERO(value))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_DIV_BY_ZERO,
+            "float division by zero");
+
+    VTABLE_set_number_native(interp, _self,
+            floor(VTABLE_get_number(interp, _self) / value));
+#line 541 "./src/pmc/scalar.c"
+}
+static  void 
+Parrot_scalar_i_floor_divide_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+#line 485 "./src/pmc/scalar.pmc"
+
+    if (value == 0)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_DIV_BY_ZERO,
+            "float division by zero");
+
+    VTABLE_set_number_native(interp, _self,
+            floor(VTABLE_get_number(interp, _self) / value));
+#line 554 "./src/pmc/scalar.c"
+}
+static  void 
+Parrot_scalar_i_modulus(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 564 "./src/pmc/scalar.pmc"
+
+    const FLOATVAL d = VTABLE_get_number(interp, value);
+
+    if (FLOAT_IS_ZERO(d))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_DIV_BY_ZERO,
+            "float modulus by zero");
+
+    VTABLE_set_number_native(interp, _self,
+            Parrot_util_floatval_mod(VTABLE_get_number(interp, _self), d));
+#line 569 "./src/pmc/scalar.c"
+}
+static  void 
+Parrot_scalar_i_modulus_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value)
+{
+#line 584 "./src/pmc/scalar.pmc"
+
+    if (FLOAT_IS_ZERO(value))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_DIV_BY_ZERO,
+            "float modulus by zero");
+
+    VTABLE_set_number_native(interp, _self,
+            Parrot_util_floatval_mod(VTABLE_get_number(interp, _self), value));
+#line 582 "./src/pmc/scalar.c"
+}
+static  void 
+Parrot_scalar_i_modulus_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+#line 575 "./src/pmc/scalar.pmc"
+
+    if (value == 0)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_DIV_BY_ZERO,
+            "float modulus by zero");
+
+    VTABLE_set_number_native(interp, _self,
+            Parrot_util_floatval_mod(VTABLE_get_number(interp, _self), (FLOATVAL)value));
+#line 595 "./src/pmc/scalar.c"
+}
+static  void
+Parrot_scalar_i_multiply(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+    INTVAL type = VTABLE_type(interp, value);
+    /* For dynpmc fallback to MMD */
+    if ((type >= enum_class_core_max) || (VTABLE_type(interp, _self) >= enum_class_core_max))
+        type = enum_class_core_max;
+    switch(type) {
+        case enum_class_Complex:
+            Parrot_scalar_multi_i_multiply_Complex(interp, _self, value);
+            break;
+        case enum_class_core_max:
+            Parrot_mmd_multi_dispatch_from_c_args(interp, "i_multiply", "PP->", _self, value);
+            break;
+        default:
+            Parrot_scalar_multi_i_multiply_DEFAULT(interp, _self, value);
+            break;
+
+    }
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void 
+Parrot_scalar_i_multiply_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value)
+{
+#line 327 "./src/pmc/scalar.pmc"
+
+    VTABLE_set_number_native(interp, _self, VTABLE_get_number(interp, _self) * value);
+#line 624 "./src/pmc/scalar.c"
+}
+static  void 
+Parrot_scalar_i_multiply_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+#line 322 "./src/pmc/scalar.pmc"
+
+    VTABLE_set_number_native(interp, _self,
+        VTABLE_get_number(interp, _self) * (FLOATVAL)value);
+#line 633 "./src/pmc/scalar.c"
+}
+static  void 
+Parrot_scalar_i_neg(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 614 "./src/pmc/scalar.pmc"
+
+    VTABLE_set_integer_native(interp, _self, -VTABLE_get_integer(interp, _self));
+#line 641 "./src/pmc/scalar.c"
+}
+static  void 
+Parrot_scalar_i_repeat(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 714 "./src/pmc/scalar.pmc"
+
+    STRING * const s = VTABLE_get_string(interp, _self);
+    const UINTVAL  n = (UINTVAL)VTABLE_get_integer(interp, value);
+    VTABLE_set_string_native(interp, _self, Parrot_str_repeat(interp, s, n));
+#line 651 "./src/pmc/scalar.c"
+}
+static  void 
+Parrot_scalar_i_repeat_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+#line 720 "./src/pmc/scalar.pmc"
+
+    STRING * const s = VTABLE_get_string(interp, _self);
+    const UINTVAL  n = value;
+    VTABLE_set_string_native(interp, _self, Parrot_str_repeat(interp, s, n));
+#line 661 "./src/pmc/scalar.c"
+}
+static  void
+Parrot_scalar_i_subtract(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+    INTVAL type = VTABLE_type(interp, value);
+    /* For dynpmc fallback to MMD */
+    if ((type >= enum_class_core_max) || (VTABLE_type(interp, _self) >= enum_class_core_max))
+        type = enum_class_core_max;
+    switch(type) {
+        case enum_class_Complex:
+            Parrot_scalar_multi_i_subtract_Complex(interp, _self, value);
+            break;
+        case enum_class_core_max:
+            Parrot_mmd_multi_dispatch_from_c_args(interp, "i_subtract", "PP->", _self, value);
+            break;
+        default:
+            Parrot_scalar_multi_i_subtract_DEFAULT(interp, _self, value);
+            break;
+
+    }
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+}
+static  void 
+Parrot_scalar_i_subtract_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value)
+{
+#line 258 "./src/pmc/scalar.pmc"
+
+    VTABLE_set_number_native(interp, _self,
+        VTABLE_get_number(interp, _self) - value);
+#line 691 "./src/pmc/scalar.c"
+}
+static  void 
+Parrot_scalar_i_subtract_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+#line 253 "./src/pmc/scalar.pmc"
+
+    VTABLE_set_number_native(interp, _self,
+        VTABLE_get_number(interp, _self) - (FLOATVAL)value);
+#line 700 "./src/pmc/scalar.c"
+}
+static  INTVAL
+Parrot_scalar_is_equal_num(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+    INTVAL type = VTABLE_type(interp, value);
+    /* For dynpmc fallback to MMD */
+    if ((type >= enum_class_core_max) || (VTABLE_type(interp, _self) >= enum_class_core_max))
+        type = enum_class_core_max;
+    switch(type) {
+        case enum_class_core_max:
+            {
+                INTVAL retval;
+                Parrot_mmd_multi_dispatch_from_c_args(interp, "is_equal_num", "PP->I", _self, value, &retval);
+                return retval;
+            }
+            break;
+        default:
+            return Parrot_scalar_multi_is_equal_num_PMC(interp, _self, value);
+            break;
+
+    }
+}
+static  INTVAL
+Parrot_scalar_is_equal_string(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+    INTVAL type = VTABLE_type(interp, value);
+    /* For dynpmc fallback to MMD */
+    if ((type >= enum_class_core_max) || (VTABLE_type(interp, _self) >= enum_class_core_max))
+        type = enum_class_core_max;
+    switch(type) {
+        case enum_class_core_max:
+            {
+                INTVAL retval;
+                Parrot_mmd_multi_dispatch_from_c_args(interp, "is_equal_string", "PP->I", _self, value, &retval);
+                return retval;
+            }
+            break;
+        default:
+            return Parrot_scalar_multi_is_equal_string_PMC(interp, _self, value);
+            break;
+
+    }
+}
+static  PMC *
+Parrot_scalar_modulus(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest)
+{
+    INTVAL type = VTABLE_type(interp, value);
+    /* For dynpmc fallback to MMD */
+    if ((type >= enum_class_core_max) || (VTABLE_type(interp, _self) >= enum_class_core_max))
+        type = enum_class_core_max;
+    switch(type) {
+        case enum_class_core_max:
+            {
+                PMC *retval = PMCNULL;
+                Parrot_mmd_multi_dispatch_from_c_args(interp, "modulus", "PPP->P", _self, value, dest, &retval);
+                return retval;
+            }
+            break;
+        default:
+            return Parrot_scalar_multi_modulus_PMC_PMC(interp, _self, value, dest);
+            break;
+
+    }
+}
+static  PMC  *
+Parrot_scalar_modulus_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest)
+{
+#line 552 "./src/pmc/scalar.pmc"
+
+    if (FLOAT_IS_ZERO(value))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_DIV_BY_ZERO,
+            "float modulus by zero");
+
+    dest = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+
+    VTABLE_set_number_native(interp, dest,
+            Parrot_util_floatval_mod(VTABLE_get_number(interp, _self), value));
+    return dest;
+#line 779 "./src/pmc/scalar.c"
+}
+static  PMC  *
+Parrot_scalar_modulus_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest)
+{
+#line 540 "./src/pmc/scalar.pmc"
+
+    if (value == 0)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_DIV_BY_ZERO,
+            "float modulus by zero");
+
+    dest = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+
+    VTABLE_set_number_native(interp, dest,
+            Parrot_util_floatval_mod(VTABLE_get_number(interp, _self), (FLOATVAL)value));
+    return dest;
+#line 795 "./src/pmc/scalar.c"
+}
+static  PMC *
+Parrot_scalar_multiply(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest)
+{
+    INTVAL type = VTABLE_type(interp, value);
+    /* For dynpmc fallback to MMD */
+    if ((type >= enum_class_core_max) || (VTABLE_type(interp, _self) >= enum_class_core_max))
+        type = enum_class_core_max;
+    switch(type) {
+        case enum_class_Complex:
+            return Parrot_scalar_multi_multiply_Complex_PMC(interp, _self, value, dest);
+            break;
+        case enum_class_core_max:
+            {
+                PMC *retval = PMCNULL;
+                Parrot_mmd_multi_dispatch_from_c_args(interp, "multiply", "PPP->P", _self, value, dest, &retval);
+                return retval;
+            }
+            break;
+        default:
+            return Parrot_scalar_multi_multiply_DEFAULT_PMC(interp, _self, value, dest);
+            break;
+
+    }
+}
+static  PMC  *
+Parrot_scalar_multiply_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest)
+{
+#line 301 "./src/pmc/scalar.pmc"
+
+    dest = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+
+    VTABLE_set_number_native(interp, dest,
+        VTABLE_get_number(interp, _self) * value);
+    return dest;
+#line 831 "./src/pmc/scalar.c"
+}
+static  PMC  *
+Parrot_scalar_multiply_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest)
+{
+#line 293 "./src/pmc/scalar.pmc"
+
+    dest = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+
+    VTABLE_set_number_native(interp, dest,
+        VTABLE_get_number(interp, _self) * value);
+    return dest;
+#line 843 "./src/pmc/scalar.c"
+}
+static  PMC  *
+Parrot_scalar_neg(PARROT_INTERP, ARGMOD(PMC *_self), PMC *dest)
+{
+#line 605 "./src/pmc/scalar.pmc"
+
+    const INTVAL a = -VTABLE_get_integer(interp, _self);
+
+    dest = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+
+    VTABLE_set_integer_native(interp, dest, a);
+    return dest;
+#line 856 "./src/pmc/scalar.c"
+}
+static  PMC  *
+Parrot_scalar_repeat(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest)
+{
+#line 691 "./src/pmc/scalar.pmc"
+
+    STRING * const s = VTABLE_get_string(interp, _self);
+    const UINTVAL  n = (UINTVAL)VTABLE_get_integer(interp, value);
+
+    dest = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+
+    VTABLE_set_string_native(interp, dest,
+        Parrot_str_repeat(interp, s, n));
+    return dest;
+#line 871 "./src/pmc/scalar.c"
+}
+static  PMC  *
+Parrot_scalar_repeat_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest)
+{
+#line 702 "./src/pmc/scalar.pmc"
+
+    STRING * const s = VTABLE_get_string(interp, _self);
+    const UINTVAL  n = value;
+
+    dest = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+
+    VTABLE_set_string_native(interp, dest,
+        Parrot_str_repeat(interp, s, n));
+    return dest;
+#line 886 "./src/pmc/scalar.c"
+}
+static  STRING  *
+Parrot_scalar_substr(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL offset, INTVAL length)
+{
+#line 843 "./src/pmc/scalar.pmc"
+
+    return STRING_substr(interp, VTABLE_get_string(interp, _self),
+            offset, length);
+#line 895 "./src/pmc/scalar.c"
+}
+static  PMC *
+Parrot_scalar_subtract(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest)
+{
+    INTVAL type = VTABLE_type(interp, value);
+    /* For dynpmc fallback to MMD */
+    if ((type >= enum_class_core_max) || (VTABLE_type(interp, _self) >= enum_class_core_max))
+        type = enum_class_core_max;
+    switch(type) {
+        case enum_class_Complex:
+            return Parrot_scalar_multi_subtract_Complex_PMC(interp, _self, value, dest);
+            break;
+        case enum_class_core_max:
+            {
+                PMC *retval = PMCNULL;
+                Parrot_mmd_multi_dispatch_from_c_args(interp, "subtract", "PPP->P", _self, value, dest, &retval);
+                return retval;
+            }
+            break;
+        default:
+            return Parrot_scalar_multi_subtract_DEFAULT_PMC(interp, _self, value, dest);
+            break;
+
+    }
+}
+static  PMC  *
+Parrot_scalar_subtract_float(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value, PMC *dest)
+{
+#line 230 "./src/pmc/scalar.pmc"
+
+    dest = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+
+    VTABLE_set_number_native(interp, dest,
+            VTABLE_get_number(interp, _self) - value);
+    return dest;
+#line 931 "./src/pmc/scalar.c"
+}
+static  PMC  *
+Parrot_scalar_subtract_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value, PMC *dest)
+{
+#line 222 "./src/pmc/scalar.pmc"
+
+    dest = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+
+    VTABLE_set_number_native(interp, dest,
+            VTABLE_get_number(interp, _self) - (FLOATVAL)value);
+    return dest;
+#line 943 "./src/pmc/scalar.c"
+}
+static  PMC  *
+Parrot_scalar_multi_add_Complex_PMC(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest)
+{
+#line 121 "./src/pmc/scalar.pmc"
+
+    const FLOATVAL a = _self->vtable->get_number(interp, _self);
+
+    dest = Parrot_pmc_new(interp, VTABLE_type(interp, value));
+    VTABLE_set_number_native(interp, dest,
+            a + VTABLE_get_number_keyed_int(interp, value, 0));
+    VTABLE_set_number_keyed_int(interp, dest, 1,
+            VTABLE_get_number_keyed_int(interp, value, 1));
+    return dest;
+#line 958 "./src/pmc/scalar.c"
+}
+static  PMC  *
+Parrot_scalar_multi_add_DEFAULT_PMC(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest)
+{
+#line 132 "./src/pmc/scalar.pmc"
+
+    dest = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+
+    VTABLE_set_number_native(interp, dest,
+            _self->vtable->get_number(interp, _self) + VTABLE_get_number(interp, value));
+    return dest;
+#line 970 "./src/pmc/scalar.c"
+}
+static  void 
+Parrot_scalar_multi_i_add_Complex(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 156 "./src/pmc/scalar.pmc"
+
+    const FLOATVAL a = _self->vtable->get_number(interp, _self);
+
+    Parrot_pmc_reuse(interp, _self, enum_class_Complex, 0);
+    VTABLE_set_number_native(interp, _self,
+            a + VTABLE_get_number_keyed_int(interp, value, 0));
+    VTABLE_set_number_keyed_int(interp, _self, 1,
+            VTABLE_get_number_keyed_int(interp, value, 1));
+#line 984 "./src/pmc/scalar.c"
+}
+static  void 
+Parrot_scalar_multi_i_add_DEFAULT(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 166 "./src/pmc/scalar.pmc"
+
+    VTABLE_set_number_native(interp, _self,
+        _self->vtable->get_number(interp, _self) + VTABLE_get_number(interp, value));
+#line 993 "./src/pmc/scalar.c"
+}
+static  PMC  *
+Parrot_scalar_multi_subtract_Complex_PMC(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest)
+{
+#line 204 "./src/pmc/scalar.pmc"
+
+    const FLOATVAL a = _self->vtable->get_number(interp, _self);
+    dest = Parrot_pmc_new(interp, VTABLE_type(interp, value));
+
+    VTABLE_set_number_native(interp, dest,
+            a - VTABLE_get_number_keyed_int(interp, value, 0));
+    VTABLE_set_number_keyed_int(interp, dest, 1,
+            -VTABLE_get_number_keyed_int(interp, value, 1));
+    return dest;
+#line 1008 "./src/pmc/scalar.c"
+}
+static  PMC  *
+Parrot_scalar_multi_subtract_DEFAULT_PMC(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest)
+{
+#line 215 "./src/pmc/scalar.pmc"
+
+    dest = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+    VTABLE_set_number_native(interp, dest,
+            _self->vtable->get_number(interp, _self) - VTABLE_get_number(interp, value));
+    return dest;
+#line 1019 "./src/pmc/scalar.c"
+}
+static  void 
+Parrot_scalar_multi_i_subtract_Complex(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 238 "./src/pmc/scalar.pmc"
+
+    const FLOATVAL a = _self->vtable->get_number(interp, _self);
+
+    Parrot_pmc_reuse(interp, _self, enum_class_Complex, 0);
+    VTABLE_set_number_native(interp, _self,
+            a - VTABLE_get_number_keyed_int(interp, value, 0));
+    VTABLE_set_number_keyed_int(interp, _self, 1,
+            -VTABLE_get_number_keyed_int(interp, value, 1));
+#line 1033 "./src/pmc/scalar.c"
+}
+static  void 
+Parrot_scalar_multi_i_subtract_DEFAULT(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 248 "./src/pmc/scalar.pmc"
+
+    VTABLE_set_number_native(interp, _self,
+        _self->vtable->get_number(interp, _self) - VTABLE_get_number(interp, value));
+#line 1042 "./src/pmc/scalar.c"
+}
+static  PMC  *
+Parrot_scalar_multi_multiply_Complex_PMC(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value), SHIM(PMC *dest))
+{
+#line 277 "./src/pmc/scalar.pmc"
+    Parrot_ex_throw_from_c_args(interp, NULL,
+        EXCEPTION_INTERNAL_NOT_IMPLEMENTED, "TODO mul<Float, Complex>");
+#line 1050 "./src/pmc/scalar.c"
+}
+static  PMC  *
+Parrot_scalar_multi_multiply_DEFAULT_PMC(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest)
+{
+#line 285 "./src/pmc/scalar.pmc"
+
+    dest = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+
+    VTABLE_set_number_native(interp, dest,
+        _self->vtable->get_number(interp, _self) * VTABLE_get_number(interp, value));
+    return dest;
+#line 1062 "./src/pmc/scalar.c"
+}
+static  void 
+Parrot_scalar_multi_i_multiply_Complex(PARROT_INTERP, SHIM(PMC *_self), SHIM(PMC *value))
+{
+#line 309 "./src/pmc/scalar.pmc"
+    Parrot_ex_throw_from_c_args(interp, NULL,
+        EXCEPTION_INTERNAL_NOT_IMPLEMENTED,
+        "TODO i_mul<Float, Complex>");
+#line 1071 "./src/pmc/scalar.c"
+}
+static  void 
+Parrot_scalar_multi_i_multiply_DEFAULT(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 317 "./src/pmc/scalar.pmc"
+
+    VTABLE_set_number_native(interp, _self,
+        _self->vtable->get_number(interp, _self) * VTABLE_get_number(interp, value));
+#line 1080 "./src/pmc/scalar.c"
+}
+static  PMC  *
+Parrot_scalar_multi_divide_PMC_PMC(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest)
+{
+#line 353 "./src/pmc/scalar.pmc"
+
+    const FLOATVAL d = VTABLE_get_number(interp, value);
+
+    if (FLOAT_IS_ZERO(d))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_DIV_BY_ZERO,
+            "float division by zero");
+
+    dest = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+
+    VTABLE_set_number_native(interp, dest, _self->vtable->get_number(interp, _self) / d);
+    return dest;
+#line 1097 "./src/pmc/scalar.c"
+}
+static  PMC  *
+Parrot_scalar_multi_floor_divide_PMC_PMC(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest)
+{
+#line 436 "./src/pmc/scalar.pmc"
+
+    FLOATVAL d = VTABLE_get_number(interp, value);
+
+    if (FLOAT_IS_ZERO(d))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_DIV_BY_ZERO,
+            "float division by zero");
+
+    dest = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+    d    = floor(_self->vtable->get_number(interp, _self) / d);
+
+    VTABLE_set_integer_native(interp, dest, (INTVAL)d);
+    return dest;
+#line 1115 "./src/pmc/scalar.c"
+}
+static  PMC  *
+Parrot_scalar_multi_modulus_PMC_PMC(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value, PMC *dest)
+{
+#line 526 "./src/pmc/scalar.pmc"
+
+    const FLOATVAL d = VTABLE_get_number(interp, value);
+
+    if (FLOAT_IS_ZERO(d))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_DIV_BY_ZERO,
+            "float modulus by zero");
+
+    dest = Parrot_pmc_new(interp, VTABLE_type(interp, _self));
+
+    VTABLE_set_number_native(interp, dest,
+            Parrot_util_floatval_mod(_self->vtable->get_number(interp, _self), d));
+    return dest;
+#line 1133 "./src/pmc/scalar.c"
+}
+static  INTVAL 
+Parrot_scalar_multi_cmp_num_PMC(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 745 "./src/pmc/scalar.pmc"
+
+    /* XXX - Floating-point precision errors possible? */
+    const FLOATVAL diff = VTABLE_get_number(interp, value) - _self->vtable->get_number(interp, _self);
+
+    return FLOAT_IS_ZERO(diff) ? 0 : diff < 0.0 ? -1 : 1;
+#line 1144 "./src/pmc/scalar.c"
+}
+static  INTVAL 
+Parrot_scalar_multi_cmp_string_PMC(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 763 "./src/pmc/scalar.pmc"
+
+    return STRING_compare(interp, _self->vtable->get_string(interp, _self),
+        VTABLE_get_string(interp, value));
+#line 1153 "./src/pmc/scalar.c"
+}
+static  INTVAL 
+Parrot_scalar_multi_is_equal_num_PMC(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 795 "./src/pmc/scalar.pmc"
+
+    return (VTABLE_get_number(interp, _self) ==
+            VTABLE_get_number(interp, value));
+#line 1162 "./src/pmc/scalar.c"
+}
+static  INTVAL 
+Parrot_scalar_multi_is_equal_string_PMC(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 810 "./src/pmc/scalar.pmc"
+
+    return (0 != STRING_equal(interp, VTABLE_get_string(interp, _self),
+                                      VTABLE_get_string(interp, value)));
+#line 1171 "./src/pmc/scalar.c"
+}
+static  void
+Parrot_scalar_multi_add_Complex_PMC_pcc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+PMC *value; PMC *dest;
+PMC * _result;
+PMC *_call_obj = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+Parrot_pcc_fill_params_from_c_args(interp, _call_obj, "PiPP", &_self, &value, &dest);
+_result = Parrot_scalar_multi_add_Complex_PMC(interp, _self, value, dest);
+    Parrot_pcc_set_call_from_c_args(interp, _call_obj, "P", _result);
+}
+static  void
+Parrot_scalar_multi_add_DEFAULT_PMC_pcc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+PMC *value; PMC *dest;
+PMC * _result;
+PMC *_call_obj = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+Parrot_pcc_fill_params_from_c_args(interp, _call_obj, "PiPP", &_self, &value, &dest);
+_result = Parrot_scalar_multi_add_DEFAULT_PMC(interp, _self, value, dest);
+    Parrot_pcc_set_call_from_c_args(interp, _call_obj, "P", _result);
+}
+static  void
+Parrot_scalar_multi_i_add_Complex_pcc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+PMC *value;
+PMC *_call_obj = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+Parrot_pcc_fill_params_from_c_args(interp, _call_obj, "PiP", &_self, &value);
+Parrot_scalar_multi_i_add_Complex(interp, _self, value);
+}
+static  void
+Parrot_scalar_multi_i_add_DEFAULT_pcc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+PMC *value;
+PMC *_call_obj = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+Parrot_pcc_fill_params_from_c_args(interp, _call_obj, "PiP", &_self, &value);
+Parrot_scalar_multi_i_add_DEFAULT(interp, _self, value);
+}
+static  void
+Parrot_scalar_multi_subtract_Complex_PMC_pcc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+PMC *value; PMC *dest;
+PMC * _result;
+PMC *_call_obj = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+Parrot_pcc_fill_params_from_c_args(interp, _call_obj, "PiPP", &_self, &value, &dest);
+_result = Parrot_scalar_multi_subtract_Complex_PMC(interp, _self, value, dest);
+    Parrot_pcc_set_call_from_c_args(interp, _call_obj, "P", _result);
+}
+static  void
+Parrot_scalar_multi_subtract_DEFAULT_PMC_pcc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+PMC *value; PMC *dest;
+PMC * _result;
+PMC *_call_obj = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+Parrot_pcc_fill_params_from_c_args(interp, _call_obj, "PiPP", &_self, &value, &dest);
+_result = Parrot_scalar_multi_subtract_DEFAULT_PMC(interp, _self, value, dest);
+    Parrot_pcc_set_call_from_c_args(interp, _call_obj, "P", _result);
+}
+static  void
+Parrot_scalar_multi_i_subtract_Complex_pcc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+PMC *value;
+PMC *_call_obj = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+Parrot_pcc_fill_params_from_c_args(interp, _call_obj, "PiP", &_self, &value);
+Parrot_scalar_multi_i_subtract_Complex(interp, _self, value);
+}
+static  void
+Parrot_scalar_multi_i_subtract_DEFAULT_pcc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+PMC *value;
+PMC *_call_obj = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+Parrot_pcc_fill_params_from_c_args(interp, _call_obj, "PiP", &_self, &value);
+Parrot_scalar_multi_i_subtract_DEFAULT(interp, _self, value);
+}
+static  void
+Parrot_scalar_multi_multiply_Complex_PMC_pcc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+PMC *value; PMC *dest;
+PMC * _result;
+PMC *_call_obj = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+Parrot_pcc_fill_params_from_c_args(interp, _call_obj, "PiPP", &_self, &value, &dest);
+_result = Parrot_scalar_multi_multiply_Complex_PMC(interp, _self, value, dest);
+    Parrot_pcc_set_call_from_c_args(interp, _call_obj, "P", _result);
+}
+static  void
+Parrot_scalar_multi_multiply_DEFAULT_PMC_pcc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+PMC *value; PMC *dest;
+PMC * _result;
+PMC *_call_obj = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+Parrot_pcc_fill_params_from_c_args(interp, _call_obj, "PiPP", &_self, &value, &dest);
+_result = Parrot_scalar_multi_multiply_DEFAULT_PMC(interp, _self, value, dest);
+    Parrot_pcc_set_call_from_c_args(interp, _call_obj, "P", _result);
+}
+static  void
+Parrot_scalar_multi_i_multiply_Complex_pcc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+PMC *value;
+PMC *_call_obj = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+Parrot_pcc_fill_params_from_c_args(interp, _call_obj, "PiP", &_self, &value);
+Parrot_scalar_multi_i_multiply_Complex(interp, _self, value);
+}
+static  void
+Parrot_scalar_multi_i_multiply_DEFAULT_pcc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+PMC *value;
+PMC *_call_obj = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+Parrot_pcc_fill_params_from_c_args(interp, _call_obj, "PiP", &_self, &value);
+Parrot_scalar_multi_i_multiply_DEFAULT(interp, _self, value);
+}
+static  void
+Parrot_scalar_multi_divide_PMC_PMC_pcc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+PMC *value; PMC *dest;
+PMC * _result;
+PMC *_call_obj = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+Parrot_pcc_fill_params_from_c_args(interp, _call_obj, "PiPP", &_self, &value, &dest);
+_result = Parrot_scalar_multi_divide_PMC_PMC(interp, _self, value, dest);
+    Parrot_pcc_set_call_from_c_args(interp, _call_obj, "P", _result);
+}
+static  void
+Parrot_scalar_multi_floor_divide_PMC_PMC_pcc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+PMC *value; PMC *dest;
+PMC * _result;
+PMC *_call_obj = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+Parrot_pcc_fill_params_from_c_args(interp, _call_obj, "PiPP", &_self, &value, &dest);
+_result = Parrot_scalar_multi_floor_divide_PMC_PMC(interp, _self, value, dest);
+    Parrot_pcc_set_call_from_c_args(interp, _call_obj, "P", _result);
+}
+static  void
+Parrot_scalar_multi_modulus_PMC_PMC_pcc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+PMC *value; PMC *dest;
+PMC * _result;
+PMC *_call_obj = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+Parrot_pcc_fill_params_from_c_args(interp, _call_obj, "PiPP", &_self, &value, &dest);
+_result = Parrot_scalar_multi_modulus_PMC_PMC(interp, _self, value, dest);
+    Parrot_pcc_set_call_from_c_args(interp, _call_obj, "P", _result);
+}
+static  void
+Parrot_scalar_multi_cmp_num_PMC_pcc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+PMC *value;
+INTVAL  _result;
+PMC *_call_obj = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+Parrot_pcc_fill_params_from_c_args(interp, _call_obj, "PiP", &_self, &value);
+_result = Parrot_scalar_multi_cmp_num_PMC(interp, _self, value);
+    Parrot_pcc_set_call_from_c_args(interp, _call_obj, "I", _result);
+}
+static  void
+Parrot_scalar_multi_cmp_string_PMC_pcc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+PMC *value;
+INTVAL  _result;
+PMC *_call_obj = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+Parrot_pcc_fill_params_from_c_args(interp, _call_obj, "PiP", &_self, &value);
+_result = Parrot_scalar_multi_cmp_string_PMC(interp, _self, value);
+    Parrot_pcc_set_call_from_c_args(interp, _call_obj, "I", _result);
+}
+static  void
+Parrot_scalar_multi_is_equal_num_PMC_pcc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+PMC *value;
+INTVAL  _result;
+PMC *_call_obj = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+Parrot_pcc_fill_params_from_c_args(interp, _call_obj, "PiP", &_self, &value);
+_result = Parrot_scalar_multi_is_equal_num_PMC(interp, _self, value);
+    Parrot_pcc_set_call_from_c_args(interp, _call_obj, "I", _result);
+}
+static  void
+Parrot_scalar_multi_is_equal_string_PMC_pcc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+PMC *value;
+INTVAL  _result;
+PMC *_call_obj = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+Parrot_pcc_fill_params_from_c_args(interp, _call_obj, "PiP", &_self, &value);
+_result = Parrot_scalar_multi_is_equal_string_PMC(interp, _self, value);
+    Parrot_pcc_set_call_from_c_args(interp, _call_obj, "I", _result);
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_scalar_update_vtable(VTABLE *vt) {
+    vt->add = Parrot_scalar_add;
+    vt->add_float = Parrot_scalar_add_float;
+    vt->add_int = Parrot_scalar_add_int;
+    vt->assign_pmc = Parrot_scalar_assign_pmc;
+    vt->cmp_num = Parrot_scalar_cmp_num;
+    vt->cmp_string = Parrot_scalar_cmp_string;
+    vt->concatenate = Parrot_scalar_concatenate;
+    vt->concatenate_str = Parrot_scalar_concatenate_str;
+    vt->defined = Parrot_scalar_defined;
+    vt->divide = Parrot_scalar_divide;
+    vt->divide_float = Parrot_scalar_divide_float;
+    vt->divide_int = Parrot_scalar_divide_int;
+    vt->floor_divide = Parrot_scalar_floor_divide;
+    vt->floor_divide_float = Parrot_scalar_floor_divide_float;
+    vt->floor_divide_int = Parrot_scalar_floor_divide_int;
+    vt->i_add = Parrot_scalar_i_add;
+    vt->i_add_float = Parrot_scalar_i_add_float;
+    vt->i_add_int = Parrot_scalar_i_add_int;
+    vt->i_concatenate = Parrot_scalar_i_concatenate;
+    vt->i_concatenate_str = Parrot_scalar_i_concatenate_str;
+    vt->i_divide = Parrot_scalar_i_divide;
+    vt->i_divide_float = Parrot_scalar_i_divide_float;
+    vt->i_divide_int = Parrot_scalar_i_divide_int;
+    vt->i_floor_divide = Parrot_scalar_i_floor_divide;
+    vt->i_floor_divide_float = Parrot_scalar_i_floor_divide_float;
+    vt->i_floor_divide_int = Parrot_scalar_i_floor_divide_int;
+    vt->i_modulus = Parrot_scalar_i_modulus;
+    vt->i_modulus_float = Parrot_scalar_i_modulus_float;
+    vt->i_modulus_int = Parrot_scalar_i_modulus_int;
+    vt->i_multiply = Parrot_scalar_i_multiply;
+    vt->i_multiply_float = Parrot_scalar_i_multiply_float;
+    vt->i_multiply_int = Parrot_scalar_i_multiply_int;
+    vt->i_neg = Parrot_scalar_i_neg;
+    vt->i_repeat = Parrot_scalar_i_repeat;
+    vt->i_repeat_int = Parrot_scalar_i_repeat_int;
+    vt->i_subtract = Parrot_scalar_i_subtract;
+    vt->i_subtract_float = Parrot_scalar_i_subtract_float;
+    vt->i_subtract_int = Parrot_scalar_i_subtract_int;
+    vt->is_equal_num = Parrot_scalar_is_equal_num;
+    vt->is_equal_string = Parrot_scalar_is_equal_string;
+    vt->modulus = Parrot_scalar_modulus;
+    vt->modulus_float = Parrot_scalar_modulus_float;
+    vt->modulus_int = Parrot_scalar_modulus_int;
+    vt->multiply = Parrot_scalar_multiply;
+    vt->multiply_float = Parrot_scalar_multiply_float;
+    vt->multiply_int = Parrot_scalar_multiply_int;
+    vt->neg = Parrot_scalar_neg;
+    vt->repeat = Parrot_scalar_repeat;
+    vt->repeat_int = Parrot_scalar_repeat_int;
+    vt->substr = Parrot_scalar_substr;
+    vt->subtract = Parrot_scalar_subtract;
+    vt->subtract_float = Parrot_scalar_subtract_float;
+    vt->subtract_int = Parrot_scalar_subtract_int;
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_scalar_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->add = Parrot_scalar_add;
+    vt->add_float = Parrot_scalar_add_float;
+    vt->add_int = Parrot_scalar_add_int;
+    vt->cmp_num = Parrot_scalar_cmp_num;
+    vt->cmp_string = Parrot_scalar_cmp_string;
+    vt->concatenate = Parrot_scalar_concatenate;
+    vt->concatenate_str = Parrot_scalar_concatenate_str;
+    vt->defined = Parrot_scalar_defined;
+    vt->divide = Parrot_scalar_divide;
+    vt->divide_float = Parrot_scalar_divide_float;
+    vt->divide_int = Parrot_scalar_divide_int;
+    vt->floor_divide = Parrot_scalar_floor_divide;
+    vt->floor_divide_float = Parrot_scalar_floor_divide_float;
+    vt->floor_divide_int = Parrot_scalar_floor_divide_int;
+    vt->is_equal_num = Parrot_scalar_is_equal_num;
+    vt->is_equal_string = Parrot_scalar_is_equal_string;
+    vt->modulus = Parrot_scalar_modulus;
+    vt->modulus_float = Parrot_scalar_modulus_float;
+    vt->modulus_int = Parrot_scalar_modulus_int;
+    vt->multiply = Parrot_scalar_multiply;
+    vt->multiply_float = Parrot_scalar_multiply_float;
+    vt->multiply_int = Parrot_scalar_multiply_int;
+    vt->neg = Parrot_scalar_neg;
+    vt->repeat = Parrot_scalar_repeat;
+    vt->repeat_int = Parrot_scalar_repeat_int;
+    vt->substr = Parrot_scalar_substr;
+    vt->subtract = Parrot_scalar_subtract;
+    vt->subtract_float = Parrot_scalar_subtract_float;
+    vt->subtract_int = Parrot_scalar_subtract_int;
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_scalar_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_scalar_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_scalar_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_scalar_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_scalar_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "scalar"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_scalar_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "scalar")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_scalar_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_scalar_get_vtable(interp);
+        vt->base_type      = enum_class_scalar;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "scalar");
+        vt->provides_str = CONST_STRING_GEN(interp, "scalar");
+        vt->isa_hash     = Parrot_scalar_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_scalar_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_scalar;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_scalar_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const mfl_0 = CONST_STRING_GEN(interp, "add");
+            STRING * const mfl_1 = CONST_STRING_GEN(interp, "scalar,Complex,PMC");
+            STRING * const mfl_2 = CONST_STRING_GEN(interp, "scalar");
+            STRING * const mfl_3 = CONST_STRING_GEN(interp, "scalar,DEFAULT,PMC");
+            STRING * const mfl_4 = CONST_STRING_GEN(interp, "i_add");
+            STRING * const mfl_5 = CONST_STRING_GEN(interp, "scalar,Complex");
+            STRING * const mfl_6 = CONST_STRING_GEN(interp, "scalar,DEFAULT");
+            STRING * const mfl_7 = CONST_STRING_GEN(interp, "subtract");
+            STRING * const mfl_8 = CONST_STRING_GEN(interp, "i_subtract");
+            STRING * const mfl_9 = CONST_STRING_GEN(interp, "multiply");
+            STRING * const mfl_10 = CONST_STRING_GEN(interp, "i_multiply");
+            STRING * const mfl_11 = CONST_STRING_GEN(interp, "divide");
+            STRING * const mfl_12 = CONST_STRING_GEN(interp, "scalar,PMC,PMC");
+            STRING * const mfl_13 = CONST_STRING_GEN(interp, "floor_divide");
+            STRING * const mfl_14 = CONST_STRING_GEN(interp, "modulus");
+            STRING * const mfl_15 = CONST_STRING_GEN(interp, "cmp_num");
+            STRING * const mfl_16 = CONST_STRING_GEN(interp, "scalar,PMC");
+            STRING * const mfl_17 = CONST_STRING_GEN(interp, "cmp_string");
+            STRING * const mfl_18 = CONST_STRING_GEN(interp, "is_equal_num");
+            STRING * const mfl_19 = CONST_STRING_GEN(interp, "is_equal_string");
+        PMC *_temp_func;
+_temp_func = Parrot_pmc_new(interp, enum_class_NativePCCMethod);
+VTABLE_set_pointer_keyed_str(interp, _temp_func, CONST_STRING(interp, "->"), (void *)Parrot_scalar_multi_add_Complex_PMC_pcc);
+Parrot_mmd_add_multi_from_long_sig(interp, mfl_0, mfl_1, _temp_func);
+
+_temp_func = Parrot_pmc_new(interp, enum_class_NativePCCMethod);
+VTABLE_set_pointer_keyed_str(interp, _temp_func, CONST_STRING(interp, "->"), (void *)Parrot_scalar_multi_add_DEFAULT_PMC_pcc);
+Parrot_mmd_add_multi_from_long_sig(interp, mfl_0, mfl_3, _temp_func);
+
+_temp_func = Parrot_pmc_new(interp, enum_class_NativePCCMethod);
+VTABLE_set_pointer_keyed_str(interp, _temp_func, CONST_STRING(interp, "->"), (void *)Parrot_scalar_multi_i_add_Complex_pcc);
+Parrot_mmd_add_multi_from_long_sig(interp, mfl_4, mfl_5, _temp_func);
+
+_temp_func = Parrot_pmc_new(interp, enum_class_NativePCCMethod);
+VTABLE_set_pointer_keyed_str(interp, _temp_func, CONST_STRING(interp, "->"), (void *)Parrot_scalar_multi_i_add_DEFAULT_pcc);
+Parrot_mmd_add_multi_from_long_sig(interp, mfl_4, mfl_6, _temp_func);
+
+_temp_func = Parrot_pmc_new(interp, enum_class_NativePCCMethod);
+VTABLE_set_pointer_keyed_str(interp, _temp_func, CONST_STRING(interp, "->"), (void *)Parrot_scalar_multi_subtract_Complex_PMC_pcc);
+Parrot_mmd_add_multi_from_long_sig(interp, mfl_7, mfl_1, _temp_func);
+
+_temp_func = Parrot_pmc_new(interp, enum_class_NativePCCMethod);
+VTABLE_set_pointer_keyed_str(interp, _temp_func, CONST_STRING(interp, "->"), (void *)Parrot_scalar_multi_subtract_DEFAULT_PMC_pcc);
+Parrot_mmd_add_multi_from_long_sig(interp, mfl_7, mfl_3, _temp_func);
+
+_temp_func = Parrot_pmc_new(interp, enum_class_NativePCCMethod);
+VTABLE_set_pointer_keyed_str(interp, _temp_func, CONST_STRING(interp, "->"), (void *)Parrot_scalar_multi_i_subtract_Complex_pcc);
+Parrot_mmd_add_multi_from_long_sig(interp, mfl_8, mfl_5, _temp_func);
+
+_temp_func = Parrot_pmc_new(interp, enum_class_NativePCCMethod);
+VTABLE_set_pointer_keyed_str(interp, _temp_func, CONST_STRING(interp, "->"), (void *)Parrot_scalar_multi_i_subtract_DEFAULT_pcc);
+Parrot_mmd_add_multi_from_long_sig(interp, mfl_8, mfl_6, _temp_func);
+
+_temp_func = Parrot_pmc_new(interp, enum_class_NativePCCMethod);
+VTABLE_set_pointer_keyed_str(interp, _temp_func, CONST_STRING(interp, "->"), (void *)Parrot_scalar_multi_multiply_Complex_PMC_pcc);
+Parrot_mmd_add_multi_from_long_sig(interp, mfl_9, mfl_1, _temp_func);
+
+_temp_func = Parrot_pmc_new(interp, enum_class_NativePCCMethod);
+VTABLE_set_pointer_keyed_str(interp, _temp_func, CONST_STRING(interp, "->"), (void *)Parrot_scalar_multi_multiply_DEFAULT_PMC_pcc);
+Parrot_mmd_add_multi_from_long_sig(interp, mfl_9, mfl_3, _temp_func);
+
+_temp_func = Parrot_pmc_new(interp, enum_class_NativePCCMethod);
+VTABLE_set_pointer_keyed_str(interp, _temp_func, CONST_STRING(interp, "->"), (void *)Parrot_scalar_multi_i_multiply_Complex_pcc);
+Parrot_mmd_add_multi_from_long_sig(interp, mfl_10, mfl_5, _temp_func);
+
+_temp_func = Parrot_pmc_new(interp, enum_class_NativePCCMethod);
+VTABLE_set_pointer_keyed_str(interp, _temp_func, CONST_STRING(interp, "->"), (void *)Parrot_scalar_multi_i_multiply_DEFAULT_pcc);
+Parrot_mmd_add_multi_from_long_sig(interp, mfl_10, mfl_6, _temp_func);
+
+_temp_func = Parrot_pmc_new(interp, enum_class_NativePCCMethod);
+VTABLE_set_pointer_keyed_str(interp, _temp_func, CONST_STRING(interp, "->"), (void *)Parrot_scalar_multi_divide_PMC_PMC_pcc);
+Parrot_mmd_add_multi_from_long_sig(interp, mfl_11, mfl_12, _temp_func);
+
+_temp_func = Parrot_pmc_new(interp, enum_class_NativePCCMethod);
+VTABLE_set_pointer_keyed_str(interp, _temp_func, CONST_STRING(interp, "->"), (void *)Parrot_scalar_multi_floor_divide_PMC_PMC_pcc);
+Parrot_mmd_add_multi_from_long_sig(interp, mfl_13, mfl_12, _temp_func);
+
+_temp_func = Parrot_pmc_new(interp, enum_class_NativePCCMethod);
+VTABLE_set_pointer_keyed_str(interp, _temp_func, CONST_STRING(interp, "->"), (void *)Parrot_scalar_multi_modulus_PMC_PMC_pcc);
+Parrot_mmd_add_multi_from_long_sig(interp, mfl_14, mfl_12, _temp_func);
+
+_temp_func = Parrot_pmc_new(interp, enum_class_NativePCCMethod);
+VTABLE_set_pointer_keyed_str(interp, _temp_func, CONST_STRING(interp, "->"), (void *)Parrot_scalar_multi_cmp_num_PMC_pcc);
+Parrot_mmd_add_multi_from_long_sig(interp, mfl_15, mfl_16, _temp_func);
+
+_temp_func = Parrot_pmc_new(interp, enum_class_NativePCCMethod);
+VTABLE_set_pointer_keyed_str(interp, _temp_func, CONST_STRING(interp, "->"), (void *)Parrot_scalar_multi_cmp_string_PMC_pcc);
+Parrot_mmd_add_multi_from_long_sig(interp, mfl_17, mfl_16, _temp_func);
+
+_temp_func = Parrot_pmc_new(interp, enum_class_NativePCCMethod);
+VTABLE_set_pointer_keyed_str(interp, _temp_func, CONST_STRING(interp, "->"), (void *)Parrot_scalar_multi_is_equal_num_PMC_pcc);
+Parrot_mmd_add_multi_from_long_sig(interp, mfl_18, mfl_16, _temp_func);
+
+_temp_func = Parrot_pmc_new(interp, enum_class_NativePCCMethod);
+VTABLE_set_pointer_keyed_str(interp, _temp_func, CONST_STRING(interp, "->"), (void *)Parrot_scalar_multi_is_equal_string_PMC_pcc);
+Parrot_mmd_add_multi_from_long_sig(interp, mfl_19, mfl_16, _temp_func);
+
+        }
+    } /* pass */
+} /* Parrot_scalar_class_init */
+
+#line 846 "./src/pmc/scalar.pmc"
+
+
+/*
+
+=back
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -0,0 +1,458 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/scheduler.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_fixedintegerarray.h"
+#include "pmc_scheduler.h"
+#include "pmc_default.h"
+#include "scheduler.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/scheduler.pmc"
+/*
+Copyright (C) 2001-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/scheduler.pmc - Scheduler PMC
+
+=head1 DESCRIPTION
+
+Access to the core concurrency scheduler.
+
+=head2 Vtable Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "parrot/scheduler_private.h"
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+#line 48 "./src/pmc/scheduler.c"
+static  void  Parrot_Scheduler_destroy(SHIM_INTERP, SHIM(PMC *_self));
+static  void  Parrot_Scheduler_freeze(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+static  INTVAL  Parrot_Scheduler_get_integer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Scheduler_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Scheduler_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *data);
+static  void  Parrot_Scheduler_mark(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Scheduler_push_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *task);
+static  PMC  * Parrot_Scheduler_shift_pmc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Scheduler_thaw(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+static  void  Parrot_Scheduler_thawfinish(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *info));
+static  void  Parrot_Scheduler_unshift_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *task);
+static  void  Parrot_Scheduler_visit(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+static  void Parrot_Scheduler_nci_active_tasks(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_Scheduler_class_init(PARROT_INTERP, int, int);
+void    Parrot_Scheduler_ro_class_init(PARROT_INTERP, int, int);
+static  void 
+Parrot_Scheduler_destroy(SHIM_INTERP, SHIM(PMC *_self))
+{
+#line 208 "./src/pmc/scheduler.pmc"
+#line 68 "./src/pmc/scheduler.c"
+}
+static  void 
+Parrot_Scheduler_freeze(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 274 "./src/pmc/scheduler.pmc"
+
+    Parrot_Scheduler_attributes * const core_struct = PARROT_SCHEDULER(_self);
+
+    /* 1) freeze scheduler id */
+    VTABLE_push_integer(interp, info, core_struct->id);
+#line 79 "./src/pmc/scheduler.c"
+}
+static  INTVAL 
+Parrot_Scheduler_get_integer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 187 "./src/pmc/scheduler.pmc"
+
+    Parrot_Scheduler_attributes * const core_struct = PARROT_SCHEDULER(_self);
+    INTVAL elements;
+
+    LOCK(core_struct->task_queue_lock);
+    elements = VTABLE_elements(interp, PARROT_SCHEDULER(_self)->task_queue);
+    UNLOCK(core_struct->task_queue_lock);
+
+    return elements;
+#line 94 "./src/pmc/scheduler.c"
+}
+static  void 
+Parrot_Scheduler_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 52 "./src/pmc/scheduler.pmc"
+
+    Parrot_Scheduler_attributes * const core_struct =
+        (Parrot_Scheduler_attributes *) PMC_data(_self);
+
+    /* Set flags for custom GC mark and destroy. */
+    PObj_custom_mark_SET(_self);
+    PObj_custom_destroy_SET(_self);
+
+    /* Set up the core struct. */
+    core_struct->id            = 0;
+    core_struct->next_task_id  = 0;
+    core_struct->interp        = interp;
+
+    /* TODO: Do we need to eagerly create all these PMCs, or can we create
+       them lazily on demand? */
+    core_struct->handlers      = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+    core_struct->messages      = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+    core_struct->task_queue    = Parrot_pmc_new(interp, enum_class_PMCList);
+    core_struct->foreign_tasks = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+    core_struct->alarms        = Parrot_pmc_new(interp, enum_class_PMCList);
+    core_struct->all_tasks     = Parrot_pmc_new(interp, enum_class_Hash);
+
+    MUTEX_INIT(core_struct->task_queue_lock);
+
+    /* Chandon TODO: Delete from int-keyed hash doesn't like me. */
+    /* VTABLE_set_integer_native(interp, core_struct->all_tasks, Hash_key_type_int); */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 128 "./src/pmc/scheduler.c"
+}
+static  void 
+Parrot_Scheduler_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *data)
+{
+#line 99 "./src/pmc/scheduler.pmc"
+
+    PMC              *elem;
+    Parrot_Scheduler_attributes *core_struct;
+
+    if (!VTABLE_isa(interp, data, CONST_STRING(interp, "Hash")))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "Scheduler initializer must be a Hash");
+
+    VTABLE_init(interp, _self);
+
+    core_struct = PARROT_SCHEDULER(_self);
+    elem        = VTABLE_get_pmc_keyed_str(interp, data, CONST_STRING(interp, "id"));
+
+    if (!PMC_IS_NULL(elem))
+        core_struct->id = VTABLE_get_integer(interp, elem);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 150 "./src/pmc/scheduler.c"
+}
+static  void 
+Parrot_Scheduler_mark(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 223 "./src/pmc/scheduler.pmc"
+
+    if (PARROT_SCHEDULER(_self)) {
+        Parrot_Scheduler_attributes * const core_struct = PARROT_SCHEDULER(_self);
+
+        Parrot_gc_mark_PMC_alive(interp, core_struct->handlers);
+        Parrot_gc_mark_PMC_alive(interp, core_struct->messages);
+        Parrot_gc_mark_PMC_alive(interp, core_struct->task_queue);
+        Parrot_gc_mark_PMC_alive(interp, core_struct->foreign_tasks);
+        Parrot_gc_mark_PMC_alive(interp, core_struct->alarms);
+        Parrot_gc_mark_PMC_alive(interp, core_struct->all_tasks);
+   }
+#line 167 "./src/pmc/scheduler.c"
+}
+static  void 
+Parrot_Scheduler_push_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *task)
+{
+#line 127 "./src/pmc/scheduler.pmc"
+
+    Parrot_Scheduler_attributes * const core_struct = PARROT_SCHEDULER(_self);
+
+    LOCK(core_struct->task_queue_lock);
+    VTABLE_push_pmc(interp, core_struct->task_queue, task);
+    UNLOCK(core_struct->task_queue_lock);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 180 "./src/pmc/scheduler.c"
+}
+static  PMC  *
+Parrot_Scheduler_shift_pmc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 165 "./src/pmc/scheduler.pmc"
+
+    Parrot_Scheduler_attributes * const core_struct = PARROT_SCHEDULER(_self);
+    PMC * task;
+
+    LOCK(core_struct->task_queue_lock);
+    task = VTABLE_shift_pmc(interp, core_struct->task_queue);
+    UNLOCK(core_struct->task_queue_lock);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    return task;
+#line 196 "./src/pmc/scheduler.c"
+}
+static  void 
+Parrot_Scheduler_thaw(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 291 "./src/pmc/scheduler.pmc"
+
+    /* 1. thaw scheduler id */
+    const INTVAL id = VTABLE_shift_integer(interp, info);
+
+    /* Allocate the scheduler's core data struct and set custom flags. */
+    VTABLE_init(interp, _self);
+
+    /* Set the scheduler's id to the frozen id */
+    PARROT_SCHEDULER(_self)->id = id;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 212 "./src/pmc/scheduler.c"
+}
+static  void 
+Parrot_Scheduler_thawfinish(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *info))
+{
+#line 313 "./src/pmc/scheduler.pmc"
+    /**/UNUSED(interp)
+    /**/UNUSED(_self)
+    /* Parrot_cx_refresh_task_list(interp, _self); */
+#line 221 "./src/pmc/scheduler.c"
+}
+static  void 
+Parrot_Scheduler_unshift_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *task)
+{
+#line 146 "./src/pmc/scheduler.pmc"
+
+    Parrot_Scheduler_attributes * const core_struct = PARROT_SCHEDULER(_self);
+
+    LOCK(core_struct->task_queue_lock);
+    VTABLE_unshift_pmc(interp, core_struct->task_queue, task);
+    UNLOCK(core_struct->task_queue_lock);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 234 "./src/pmc/scheduler.c"
+}
+static  void 
+Parrot_Scheduler_visit(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 249 "./src/pmc/scheduler.pmc"
+
+    /* 1) visit task list */
+    VISIT_PMC_ATTR(interp, info, _self, Scheduler, task_queue);
+
+    /* 2) visit the handlers */
+    VISIT_PMC_ATTR(interp, info, _self, Scheduler, handlers);
+
+    /* 3) visit the alarms */
+    VISIT_PMC_ATTR(interp, info, _self, Scheduler, alarms);
+
+    /* 3) visit all tasks */
+    VISIT_PMC_ATTR(interp, info, _self, Scheduler, all_tasks);
+#line 252 "./src/pmc/scheduler.c"
+}
+static  void
+Parrot_Scheduler_nci_active_tasks(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 343 "./src/pmc/scheduler.pmc"
+
+    Parrot_Scheduler_attributes *sdata = PARROT_SCHEDULER(_self);
+    PMC * const tasks = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+    PMC * const iter  = Parrot_pmc_new_init(interp, enum_class_HashIterator, sdata->all_tasks);
+
+    while (!VTABLE_get_bool(interp, iter)) {
+        PMC * const pair = VTABLE_shift_pmc(interp, iter);
+        PMC * task = PMCNULL;
+        STRING * const value = CONST_STRING(interp, "value");
+        Parrot_pcc_invoke_method_from_c_args(interp, pair,
+            value, "->P", &task);
+        VTABLE_push_pmc(interp, tasks, task);
+    }
+
+    #line 287 "./src/pmc/scheduler.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)tasks);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return;
+     }
+#line 357 "./src/pmc/scheduler.pmc"
+
+#line 295 "./src/pmc/scheduler.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_Scheduler_update_vtable(VTABLE *vt) {
+    vt->destroy = Parrot_Scheduler_destroy;
+    vt->freeze = Parrot_Scheduler_freeze;
+    vt->get_integer = Parrot_Scheduler_get_integer;
+    vt->init = Parrot_Scheduler_init;
+    vt->init_pmc = Parrot_Scheduler_init_pmc;
+    vt->mark = Parrot_Scheduler_mark;
+    vt->push_pmc = Parrot_Scheduler_push_pmc;
+    vt->shift_pmc = Parrot_Scheduler_shift_pmc;
+    vt->thaw = Parrot_Scheduler_thaw;
+    vt->thawfinish = Parrot_Scheduler_thawfinish;
+    vt->unshift_pmc = Parrot_Scheduler_unshift_pmc;
+    vt->visit = Parrot_Scheduler_visit;
+    vt->attr_size = sizeof(Parrot_Scheduler_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_Scheduler_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->destroy = Parrot_Scheduler_destroy;
+    vt->freeze = Parrot_Scheduler_freeze;
+    vt->get_integer = Parrot_Scheduler_get_integer;
+    vt->mark = Parrot_Scheduler_mark;
+    vt->visit = Parrot_Scheduler_visit;
+    vt->attr_size = sizeof(Parrot_Scheduler_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Scheduler_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_Scheduler_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Scheduler_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_Scheduler_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_Scheduler_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "Scheduler"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_Scheduler_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "Scheduler")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_Scheduler_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "Iid Fhandlers Fmessages Ftask_queue Fforeign_tasks :task_queue_lock Falarms Fall_tasks :next_task_id :interp ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_Scheduler_get_vtable(interp);
+        vt->base_type      = enum_class_Scheduler;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "Scheduler");
+        vt->provides_str = CONST_STRING_GEN(interp, "scalar");
+        vt->isa_hash     = Parrot_Scheduler_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_Scheduler_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_Scheduler;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_Scheduler_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "active_tasks");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Scheduler_nci_active_tasks),
+                method_name, signature);
+        }
+        {
+        }
+    } /* pass */
+} /* Parrot_Scheduler_class_init */
+
+#line 358 "./src/pmc/scheduler.pmc"
+
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<docs/pdds/pdd25_concurrency.pod>.
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -0,0 +1,345 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/schedulermessage.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_schedulermessage.h"
+#include "pmc_default.h"
+#include "schedulermessage.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/schedulermessage.pmc"
+/*
+Copyright (C) 2001-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/schedulermessage.pmc - SchedulerMessage PMC
+
+=head1 DESCRIPTION
+
+Implements a message passed between concurrent tasks.
+
+=head2 Vtable Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "parrot/scheduler_private.h"
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+#line 47 "./src/pmc/schedulermessage.c"
+static  void  Parrot_SchedulerMessage_freeze(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+static  INTVAL  Parrot_SchedulerMessage_get_integer(SHIM_INTERP, ARGMOD(PMC *_self));
+static  STRING *  Parrot_SchedulerMessage_get_string(SHIM_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_SchedulerMessage_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_SchedulerMessage_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *data);
+static  void  Parrot_SchedulerMessage_mark(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_SchedulerMessage_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void  Parrot_SchedulerMessage_set_string_native(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value);
+static  void  Parrot_SchedulerMessage_thaw(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+static  void  Parrot_SchedulerMessage_visit(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+void    Parrot_SchedulerMessage_class_init(PARROT_INTERP, int, int);
+void    Parrot_SchedulerMessage_ro_class_init(PARROT_INTERP, int, int);
+static  void 
+Parrot_SchedulerMessage_freeze(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 211 "./src/pmc/schedulermessage.pmc"
+
+    Parrot_SchedulerMessage_attributes * const core_struct =
+        PARROT_SCHEDULERMESSAGE(_self);
+
+    /* 1) freeze message id */
+    VTABLE_push_integer(interp, info, core_struct->id);
+
+    /* 2) freeze message type */
+    VTABLE_push_string(interp, info, core_struct->type);
+#line 73 "./src/pmc/schedulermessage.c"
+}
+static  INTVAL 
+Parrot_SchedulerMessage_get_integer(SHIM_INTERP, ARGMOD(PMC *_self))
+{
+#line 115 "./src/pmc/schedulermessage.pmc"
+
+    return PARROT_SCHEDULERMESSAGE(_self)->id;
+#line 81 "./src/pmc/schedulermessage.c"
+}
+static  STRING * 
+Parrot_SchedulerMessage_get_string(SHIM_INTERP, ARGMOD(PMC *_self))
+{
+#line 146 "./src/pmc/schedulermessage.pmc"
+    return PARROT_SCHEDULERMESSAGE(_self)->type;
+#line 88 "./src/pmc/schedulermessage.c"
+}
+static  void 
+Parrot_SchedulerMessage_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 41 "./src/pmc/schedulermessage.pmc"
+
+    Parrot_SchedulerMessage_attributes * const core_struct
+        = (Parrot_SchedulerMessage_attributes *) PMC_data(_self);
+
+    /* Set flags for custom GC mark. */
+    PObj_custom_mark_SET(_self);
+
+    /* Set up the core struct. */
+    core_struct->id   = 0;
+    core_struct->type = CONST_STRING(interp, "");
+    core_struct->data = PMCNULL;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 106 "./src/pmc/schedulermessage.c"
+}
+static  void 
+Parrot_SchedulerMessage_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *data)
+{
+#line 81 "./src/pmc/schedulermessage.pmc"
+
+    PMC                     *elem;
+    Parrot_SchedulerMessage_attributes *core_struct;
+
+    if (! VTABLE_isa(interp, data, CONST_STRING(interp, "Hash")))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "message initializer must be a Hash");
+
+    VTABLE_init(interp, _self);
+    core_struct = PARROT_SCHEDULERMESSAGE(_self);
+
+    elem = VTABLE_get_pmc_keyed_str(interp, data, CONST_STRING(interp, "id"));
+    if (! PMC_IS_NULL(elem))
+        core_struct->id = VTABLE_get_integer(interp, elem);
+
+    elem = VTABLE_get_pmc_keyed_str(interp, data, CONST_STRING(interp, "type"));
+    if (! PMC_IS_NULL(elem))
+        core_struct->type = VTABLE_get_string(interp, elem);
+
+    elem = VTABLE_get_pmc_keyed_str(interp, data, CONST_STRING(interp, "data"));
+    if (! PMC_IS_NULL(elem))
+        core_struct->data = elem;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 135 "./src/pmc/schedulermessage.c"
+}
+static  void 
+Parrot_SchedulerMessage_mark(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 174 "./src/pmc/schedulermessage.pmc"
+
+    if (PARROT_SCHEDULERMESSAGE(_self)) {
+        Parrot_SchedulerMessage_attributes * const core_struct =
+            PARROT_SCHEDULERMESSAGE(_self);
+
+        Parrot_gc_mark_STRING_alive(interp, core_struct->type);
+        Parrot_gc_mark_PMC_alive(interp, core_struct->data);
+    }
+#line 149 "./src/pmc/schedulermessage.c"
+}
+static  void 
+Parrot_SchedulerMessage_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+#line 131 "./src/pmc/schedulermessage.pmc"
+
+    PARROT_SCHEDULERMESSAGE(_self)->id = value;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 158 "./src/pmc/schedulermessage.c"
+}
+static  void 
+Parrot_SchedulerMessage_set_string_native(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value)
+{
+#line 161 "./src/pmc/schedulermessage.pmc"
+
+    PARROT_SCHEDULERMESSAGE(_self)->type = value;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 167 "./src/pmc/schedulermessage.c"
+}
+static  void 
+Parrot_SchedulerMessage_thaw(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 232 "./src/pmc/schedulermessage.pmc"
+
+    /* 1. thaw message id */
+    const INTVAL id = VTABLE_shift_integer(interp, info);
+
+    /* 2. thaw message type */
+    STRING * const type = VTABLE_shift_string(interp, info);
+
+    /* Allocate the message's core data struct and set custom flags. */
+    VTABLE_init(interp, _self);
+
+    /* Set the message's id to the frozen id */
+    PARROT_SCHEDULERMESSAGE(_self)->id = id;
+
+    /* Set the message's type to the frozen type */
+    PARROT_SCHEDULERMESSAGE(_self)->type = type;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 189 "./src/pmc/schedulermessage.c"
+}
+static  void 
+Parrot_SchedulerMessage_visit(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 196 "./src/pmc/schedulermessage.pmc"
+
+    /* visit message data */
+    VISIT_PMC(interp, info, PARROT_SCHEDULERMESSAGE(_self)->data);
+#line 198 "./src/pmc/schedulermessage.c"
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_SchedulerMessage_update_vtable(VTABLE *vt) {
+    vt->freeze = Parrot_SchedulerMessage_freeze;
+    vt->get_integer = Parrot_SchedulerMessage_get_integer;
+    vt->get_string = Parrot_SchedulerMessage_get_string;
+    vt->init = Parrot_SchedulerMessage_init;
+    vt->init_pmc = Parrot_SchedulerMessage_init_pmc;
+    vt->mark = Parrot_SchedulerMessage_mark;
+    vt->set_integer_native = Parrot_SchedulerMessage_set_integer_native;
+    vt->set_string_native = Parrot_SchedulerMessage_set_string_native;
+    vt->thaw = Parrot_SchedulerMessage_thaw;
+    vt->visit = Parrot_SchedulerMessage_visit;
+    vt->attr_size = sizeof(Parrot_SchedulerMessage_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_SchedulerMessage_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->freeze = Parrot_SchedulerMessage_freeze;
+    vt->get_integer = Parrot_SchedulerMessage_get_integer;
+    vt->get_string = Parrot_SchedulerMessage_get_string;
+    vt->mark = Parrot_SchedulerMessage_mark;
+    vt->visit = Parrot_SchedulerMessage_visit;
+    vt->attr_size = sizeof(Parrot_SchedulerMessage_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_SchedulerMessage_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_SchedulerMessage_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_SchedulerMessage_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_SchedulerMessage_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_SchedulerMessage_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "SchedulerMessage"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_SchedulerMessage_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "SchedulerMessage")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_SchedulerMessage_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "Iid Stype Fdata ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_SchedulerMessage_get_vtable(interp);
+        vt->base_type      = enum_class_SchedulerMessage;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "SchedulerMessage");
+        vt->provides_str = CONST_STRING_GEN(interp, "scalar");
+        vt->isa_hash     = Parrot_SchedulerMessage_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_SchedulerMessage_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_SchedulerMessage;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_SchedulerMessage_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+        }
+    } /* pass */
+} /* Parrot_SchedulerMessage_class_init */
+
+#line 248 "./src/pmc/schedulermessage.pmc"
+
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<docs/pdds/pdd25_concurrency.pod>.
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -0,0 +1,315 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/sockaddr.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_sockaddr.h"
+#include "pmc_default.h"
+#include "sockaddr.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/sockaddr.pmc"
+/*
+Copyright (C) 2008-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/sockaddr.pmc - Sockaddr PMC
+
+=head1 DESCRIPTION
+
+The Sockaddr PMC holds a C<sockaddr> struct and saves its length (to
+distinguish C<sockaddr_in> and C<sockaddr_in6>).
+
+=head2 Vtable Functions
+
+These are the vtable functions for the Sockaddr class.
+
+=over 4
+
+=cut
+
+*/
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+#line 48 "./src/pmc/sockaddr.c"
+static  PMC  * Parrot_Sockaddr_clone(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Sockaddr_destroy(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_Sockaddr_get_bool(SHIM_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_Sockaddr_get_integer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_Sockaddr_get_integer_keyed_int(SHIM_INTERP, ARGMOD(PMC *_self), INTVAL what);
+static  void  * Parrot_Sockaddr_get_pointer(SHIM_INTERP, ARGMOD(PMC *_self));
+static  STRING  * Parrot_Sockaddr_get_string(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Sockaddr_init(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_Sockaddr_class_init(PARROT_INTERP, int, int);
+void    Parrot_Sockaddr_ro_class_init(PARROT_INTERP, int, int);
+static  PMC  *
+Parrot_Sockaddr_clone(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 87 "./src/pmc/sockaddr.pmc"
+
+    PMC * const dest = Parrot_pmc_new(interp, _self->vtable->base_type);
+    const Parrot_Sockaddr_attributes * const old_attrs = PARROT_SOCKADDR(_self);
+    Parrot_Sockaddr_attributes * const new_attrs = PARROT_SOCKADDR(dest);
+
+    new_attrs->type     = old_attrs->type;
+    new_attrs->protocol = old_attrs->protocol;
+    new_attrs->len      = old_attrs->len;
+
+    if (old_attrs->len) {
+        new_attrs->pointer = Parrot_gc_allocate_memory_chunk(interp,
+                                old_attrs->len);
+        memcpy(new_attrs->pointer, old_attrs->pointer, old_attrs->len);
+    }
+
+    return dest;
+#line 79 "./src/pmc/sockaddr.c"
+}
+static  void 
+Parrot_Sockaddr_destroy(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 66 "./src/pmc/sockaddr.pmc"
+
+    Parrot_Sockaddr_attributes * const data = PARROT_SOCKADDR(_self);
+
+    if (data) {
+        if (data->pointer)
+            mem_gc_free(interp, data->pointer);
+        data->pointer = NULL;
+    }
+#line 93 "./src/pmc/sockaddr.c"
+}
+static  INTVAL 
+Parrot_Sockaddr_get_bool(SHIM_INTERP, ARGMOD(PMC *_self))
+{
+#line 115 "./src/pmc/sockaddr.pmc"
+
+    const Parrot_Sockaddr_attributes * const data = PARROT_SOCKADDR(_self);
+
+    return data->pointer ? 1 : 0;
+#line 103 "./src/pmc/sockaddr.c"
+}
+static  INTVAL 
+Parrot_Sockaddr_get_integer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 132 "./src/pmc/sockaddr.pmc"
+
+    INTVAL len;
+
+    GETATTR_Sockaddr_len(interp, _self, len);
+    return len;
+#line 114 "./src/pmc/sockaddr.c"
+}
+static  INTVAL 
+Parrot_Sockaddr_get_integer_keyed_int(SHIM_INTERP, ARGMOD(PMC *_self), INTVAL what)
+{
+#line 182 "./src/pmc/sockaddr.pmc"
+
+    const Parrot_Sockaddr_attributes * const data = PARROT_SOCKADDR(_self);
+
+    switch (what) {
+      case 0:
+        return data->family;
+      case 1:
+        return data->type;
+      case 2:
+        return data->protocol;
+      default:
+        return -1;
+    }
+#line 133 "./src/pmc/sockaddr.c"
+}
+static  void  *
+Parrot_Sockaddr_get_pointer(SHIM_INTERP, ARGMOD(PMC *_self))
+{
+#line 149 "./src/pmc/sockaddr.pmc"
+
+    const Parrot_Sockaddr_attributes * const data = PARROT_SOCKADDR(_self);
+    return data->pointer;
+#line 142 "./src/pmc/sockaddr.c"
+}
+static  STRING  *
+Parrot_Sockaddr_get_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 164 "./src/pmc/sockaddr.pmc"
+
+    const Parrot_Sockaddr_attributes * const data = PARROT_SOCKADDR(_self);
+
+    if (!data->pointer)
+        return Parrot_sprintf_c(interp, "(?)");
+
+    return Parrot_io_internal_getnameinfo(interp, data->pointer, data->len);
+#line 155 "./src/pmc/sockaddr.c"
+}
+static  void 
+Parrot_Sockaddr_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 44 "./src/pmc/sockaddr.pmc"
+
+    Parrot_Sockaddr_attributes * const attrs =
+        (Parrot_Sockaddr_attributes *) PMC_data(_self);
+
+    attrs->type     = 0;
+    attrs->protocol = 0;
+    attrs->pointer  = NULL;
+    attrs->len      = 0;
+
+    PObj_custom_destroy_SET(_self);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 172 "./src/pmc/sockaddr.c"
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_Sockaddr_update_vtable(VTABLE *vt) {
+    vt->clone = Parrot_Sockaddr_clone;
+    vt->destroy = Parrot_Sockaddr_destroy;
+    vt->get_bool = Parrot_Sockaddr_get_bool;
+    vt->get_integer = Parrot_Sockaddr_get_integer;
+    vt->get_integer_keyed_int = Parrot_Sockaddr_get_integer_keyed_int;
+    vt->get_pointer = Parrot_Sockaddr_get_pointer;
+    vt->get_string = Parrot_Sockaddr_get_string;
+    vt->init = Parrot_Sockaddr_init;
+    vt->attr_size = sizeof(Parrot_Sockaddr_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_Sockaddr_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->clone = Parrot_Sockaddr_clone;
+    vt->destroy = Parrot_Sockaddr_destroy;
+    vt->get_bool = Parrot_Sockaddr_get_bool;
+    vt->get_integer = Parrot_Sockaddr_get_integer;
+    vt->get_integer_keyed_int = Parrot_Sockaddr_get_integer_keyed_int;
+    vt->get_pointer = Parrot_Sockaddr_get_pointer;
+    vt->get_string = Parrot_Sockaddr_get_string;
+    vt->attr_size = sizeof(Parrot_Sockaddr_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Sockaddr_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_Sockaddr_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Sockaddr_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_Sockaddr_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_Sockaddr_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "Sockaddr"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_Sockaddr_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "Sockaddr")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_Sockaddr_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "Ifamily Itype Iprotocol Ilen :pointer ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_Sockaddr_get_vtable(interp);
+        vt->base_type      = enum_class_Sockaddr;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "Sockaddr");
+        vt->provides_str = CONST_STRING_GEN(interp, "scalar");
+        vt->isa_hash     = Parrot_Sockaddr_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_Sockaddr_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_Sockaddr;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_Sockaddr_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+        }
+    } /* pass */
+} /* Parrot_Sockaddr_class_init */
+
+#line 197 "./src/pmc/sockaddr.pmc"
+
+
+/*
+
+=back
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -0,0 +1,1151 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/socket.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_fixedintegerarray.h"
+#include "pmc_socket.h"
+#include "pmc_handle.h"
+#include "pmc_default.h"
+#include "socket.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/socket.pmc"
+/*
+Copyright (C) 2008-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/socket.pmc - Socket PMC
+
+=head1 DESCRIPTION
+
+The Socket PMC performs abstract network I/O operations.
+
+=head2 Vtable Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "../src/io/io_private.h"
+#include "pmc/pmc_sockaddr.h"
+
+#define CHUNK_SIZE      2048
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+#line 52 "./src/pmc/socket.c"
+static  PMC  * Parrot_Socket_clone(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Socket_destroy(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_Socket_get_bool(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Socket_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Socket_mark(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Socket_nci_socket(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Socket_nci_poll(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Socket_nci_sockaddr(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Socket_nci_getaddrinfo(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Socket_nci_remote_address(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Socket_nci_local_address(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Socket_nci_is_closed(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Socket_nci_getprotobyname(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Socket_nci_connect(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Socket_nci_recv(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Socket_nci_send(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Socket_nci_bind(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Socket_nci_listen(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Socket_nci_accept(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Socket_nci_read(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Socket_nci_readline(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Socket_nci_puts(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_Socket_class_init(PARROT_INTERP, int, int);
+void    Parrot_Socket_ro_class_init(PARROT_INTERP, int, int);
+static  PMC  *
+Parrot_Socket_clone(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 73 "./src/pmc/socket.pmc"
+
+    PMC * const copy = interp->vtables[enum_class_default]->clone(interp, _self);
+    const Parrot_Socket_attributes * const old_struct = PARROT_SOCKET(_self);
+    Parrot_Socket_attributes * const data_struct = PARROT_SOCKET(copy);
+
+    if (!PMC_IS_NULL(old_struct->local))
+        data_struct->local      = VTABLE_clone(interp, old_struct->local);
+    if (!PMC_IS_NULL(old_struct->remote))
+        data_struct->remote     = VTABLE_clone(interp, old_struct->remote);
+
+    return copy;
+#line 92 "./src/pmc/socket.c"
+}
+static  void 
+Parrot_Socket_destroy(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 117 "./src/pmc/socket.pmc"
+
+    /* TODO: Make sure to free the buffers */
+    Parrot_io_close(interp, _self, 1);
+#line 101 "./src/pmc/socket.c"
+}
+static  INTVAL 
+Parrot_Socket_get_bool(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 132 "./src/pmc/socket.pmc"
+
+    return !Parrot_io_is_closed(interp, _self);
+#line 109 "./src/pmc/socket.c"
+}
+static  void 
+Parrot_Socket_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 46 "./src/pmc/socket.pmc"
+
+    Parrot_Socket_attributes * const data_struct =
+            (Parrot_Socket_attributes *) PMC_data(_self);
+
+    data_struct->record_separator = CONST_STRING(interp, "\n");
+    data_struct->local            = PMCNULL;
+    data_struct->remote           = PMCNULL;
+    data_struct->io_vtable = (IO_VTABLE *)Parrot_io_get_vtable(interp, IO_VTABLE_SOCKET, NULL);
+    data_struct->read_buffer      = NULL;
+    data_struct->write_buffer     = NULL;
+    data_struct->encoding         = STRINGNULL;
+
+    Parrot_io_socket_initialize(interp, _self);
+
+    PObj_custom_mark_destroy_SETALL(_self);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 131 "./src/pmc/socket.c"
+}
+static  void 
+Parrot_Socket_mark(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 96 "./src/pmc/socket.pmc"
+
+    Parrot_Socket_attributes * const data = PARROT_SOCKET(_self);
+
+    if (data) {
+        Parrot_gc_mark_PMC_alive(interp, data->local);
+        Parrot_gc_mark_PMC_alive(interp, data->remote);
+        Parrot_gc_mark_STRING_alive(interp, data->encoding);
+        Parrot_gc_mark_STRING_alive(interp, data->record_separator);
+        Parrot_io_buffer_mark(interp, data->read_buffer);
+        Parrot_io_buffer_mark(interp, data->write_buffer);
+    }
+#line 148 "./src/pmc/socket.c"
+}
+static  void
+Parrot_Socket_nci_socket(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    INTVAL fam;
+    INTVAL type;
+    INTVAL proto;
+    
+    const INTVAL arity = 4; /* "PiIII" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    fam = VTABLE_get_integer_keyed_int(interp, _call_object, 1);
+    type = VTABLE_get_integer_keyed_int(interp, _call_object, 2);
+    proto = VTABLE_get_integer_keyed_int(interp, _call_object, 3);
+
+    { /* BEGIN PMETHOD BODY */
+#line 151 "./src/pmc/socket.pmc"
+
+    if (Parrot_io_socket(interp, _self, fam, type, proto)) {
+        #line 177 "./src/pmc/socket.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)_self);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return;
+     }
+#line 153 "./src/pmc/socket.pmc"
+
+    }
+    #line 186 "./src/pmc/socket.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)PMCNULL);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return;
+     }
+#line 155 "./src/pmc/socket.pmc"
+
+#line 194 "./src/pmc/socket.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Socket_nci_poll(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    INTVAL which;
+    INTVAL sec;
+    INTVAL usec;
+    
+    const INTVAL arity = 4; /* "PiIII" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    which = VTABLE_get_integer_keyed_int(interp, _call_object, 1);
+    sec = VTABLE_get_integer_keyed_int(interp, _call_object, 2);
+    usec = VTABLE_get_integer_keyed_int(interp, _call_object, 3);
+
+    { /* BEGIN PMETHOD BODY */
+#line 171 "./src/pmc/socket.pmc"
+
+    const INTVAL poll = Parrot_io_poll(interp, _self, which, sec, usec);
+    #line 230 "./src/pmc/socket.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)poll);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return;
+     }
+#line 173 "./src/pmc/socket.pmc"
+
+#line 238 "./src/pmc/socket.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Socket_nci_sockaddr(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* address;
+    INTVAL port;
+    INTVAL family;
+    
+    const INTVAL arity = 3; /* "PiSIIo" */
+    const INTVAL arity_opt  = 1;
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count < arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too few arguments: %d passed, %d expected",
+                                    param_count, arity);
+    if (param_count > arity + arity_opt)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too many arguments: %d passed, %d expected",
+                                    param_count, arity + arity_opt);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    address = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+    port = VTABLE_get_integer_keyed_int(interp, _call_object, 2);
+    if (param_count > 3) {
+        family = VTABLE_get_integer_keyed_int(interp, _call_object, 3);
+    }
+    else {
+        family = 0;
+    }
+
+    { /* BEGIN PMETHOD BODY */
+#line 188 "./src/pmc/socket.pmc"
+
+    PMC *array;
+    PMC *res;
+
+    if (!family)
+        family = PIO_PF_INET;
+
+    array = Parrot_io_internal_getaddrinfo(interp, address, port, PIO_PROTO_TCP,
+                family, 0);
+
+    if (VTABLE_elements(interp, array))
+        res = VTABLE_get_pmc_keyed_int(interp, array, 0);
+    else
+        res = PMCNULL;
+
+    #line 298 "./src/pmc/socket.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)res);
+        
+        return;
+     }
+#line 203 "./src/pmc/socket.pmc"
+
+#line 306 "./src/pmc/socket.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Socket_nci_getaddrinfo(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* address;
+    INTVAL port;
+    INTVAL protocol;
+    INTVAL family;
+    INTVAL passive;
+    
+    const INTVAL arity = 6; /* "PiSIIII" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    address = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+    port = VTABLE_get_integer_keyed_int(interp, _call_object, 2);
+    protocol = VTABLE_get_integer_keyed_int(interp, _call_object, 3);
+    family = VTABLE_get_integer_keyed_int(interp, _call_object, 4);
+    passive = VTABLE_get_integer_keyed_int(interp, _call_object, 5);
+
+    { /* BEGIN PMETHOD BODY */
+#line 218 "./src/pmc/socket.pmc"
+
+    PMC * const res = Parrot_io_internal_getaddrinfo(interp, address, port, protocol, family,
+                                                     passive);
+    #line 347 "./src/pmc/socket.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)res);
+        
+        return;
+     }
+#line 221 "./src/pmc/socket.pmc"
+
+#line 355 "./src/pmc/socket.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Socket_nci_remote_address(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 233 "./src/pmc/socket.pmc"
+
+    PMC * const res = PARROT_SOCKET(_self)->remote;
+    #line 385 "./src/pmc/socket.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)res);
+        
+        return;
+     }
+#line 235 "./src/pmc/socket.pmc"
+
+#line 393 "./src/pmc/socket.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Socket_nci_local_address(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 247 "./src/pmc/socket.pmc"
+
+    PMC * const res = PARROT_SOCKET(_self)->local;
+    #line 423 "./src/pmc/socket.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)res);
+        
+        return;
+     }
+#line 249 "./src/pmc/socket.pmc"
+
+#line 431 "./src/pmc/socket.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Socket_nci_is_closed(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 263 "./src/pmc/socket.pmc"
+
+    const INTVAL status = !VTABLE_get_bool(interp, _self);
+    #line 461 "./src/pmc/socket.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)status);
+        
+        return;
+     }
+#line 265 "./src/pmc/socket.pmc"
+
+#line 469 "./src/pmc/socket.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Socket_nci_getprotobyname(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* name;
+    
+    const INTVAL arity = 2; /* "PiS" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    name = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 281 "./src/pmc/socket.pmc"
+
+    INTVAL proto = Parrot_io_getprotobyname(interp, name);
+    #line 501 "./src/pmc/socket.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)proto);
+        
+        return;
+     }
+#line 283 "./src/pmc/socket.pmc"
+
+#line 509 "./src/pmc/socket.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Socket_nci_connect(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* address;
+    
+    const INTVAL arity = 2; /* "PiP" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    address = VTABLE_get_pmc_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 303 "./src/pmc/socket.pmc"
+
+    Parrot_io_socket_connect(interp, _self, address);
+    #line 541 "./src/pmc/socket.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)0);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return;
+     }
+#line 305 "./src/pmc/socket.pmc"
+
+#line 549 "./src/pmc/socket.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Socket_nci_recv(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 327 "./src/pmc/socket.pmc"
+
+    STRING * const result = Parrot_io_read_s(interp, _self, PIO_READ_SIZE_ANY);
+    #line 579 "./src/pmc/socket.c"
+     {
+        VTABLE_set_string_keyed_int(interp, _call_object, 0, (STRING*)result);
+        
+        return;
+     }
+#line 329 "./src/pmc/socket.pmc"
+
+#line 587 "./src/pmc/socket.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Socket_nci_send(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* buf;
+    
+    const INTVAL arity = 2; /* "PiS" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    buf = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 346 "./src/pmc/socket.pmc"
+
+    const INTVAL res = Parrot_io_write_s(interp, _self, buf);
+    #line 619 "./src/pmc/socket.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)res);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return;
+     }
+#line 348 "./src/pmc/socket.pmc"
+
+#line 627 "./src/pmc/socket.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Socket_nci_bind(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* host;
+    
+    const INTVAL arity = 2; /* "PiP" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    host = VTABLE_get_pmc_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 369 "./src/pmc/socket.pmc"
+
+    Parrot_io_socket_bind(interp, _self, host);
+    #line 659 "./src/pmc/socket.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)0);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return;
+     }
+#line 371 "./src/pmc/socket.pmc"
+
+#line 667 "./src/pmc/socket.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Socket_nci_listen(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    INTVAL backlog;
+    
+    const INTVAL arity = 2; /* "PiI" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    backlog = VTABLE_get_integer_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 389 "./src/pmc/socket.pmc"
+
+    Parrot_io_socket_listen(interp, _self, backlog);
+    #line 699 "./src/pmc/socket.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)0);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return;
+     }
+#line 391 "./src/pmc/socket.pmc"
+
+#line 707 "./src/pmc/socket.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Socket_nci_accept(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 413 "./src/pmc/socket.pmc"
+
+    PMC * const res = Parrot_io_socket_accept(interp, _self);
+    #line 737 "./src/pmc/socket.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)res);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return;
+     }
+#line 415 "./src/pmc/socket.pmc"
+
+#line 745 "./src/pmc/socket.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Socket_nci_read(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    INTVAL nb;
+    
+    const INTVAL arity = 2; /* "PiI" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    nb = VTABLE_get_integer_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 439 "./src/pmc/socket.pmc"
+
+    STRING *buf;
+
+    if (Parrot_io_is_closed(interp, _self))
+        #line 779 "./src/pmc/socket.c"
+     {
+        VTABLE_set_string_keyed_int(interp, _call_object, 0, (STRING*)STRINGNULL);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return;
+     }
+#line 443 "./src/pmc/socket.pmc"
+
+
+    buf = Parrot_io_read_s(interp, _self, nb);
+
+    #line 790 "./src/pmc/socket.c"
+     {
+        VTABLE_set_string_keyed_int(interp, _call_object, 0, (STRING*)buf);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return;
+     }
+#line 447 "./src/pmc/socket.pmc"
+
+#line 798 "./src/pmc/socket.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Socket_nci_readline(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* delimiter;
+    INTVAL has_delimiter;
+    
+    const INTVAL arity = 1; /* "PiSoIp" */
+    const INTVAL arity_opt  = 1;
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count < arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too few arguments: %d passed, %d expected",
+                                    param_count, arity);
+    if (param_count > arity + arity_opt)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too many arguments: %d passed, %d expected",
+                                    param_count, arity + arity_opt);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    if (param_count > 1) {
+        delimiter = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+        has_delimiter = 1;
+    }
+    else {
+        delimiter = STRINGNULL;
+        has_delimiter = 0;
+    }
+
+    { /* BEGIN PMETHOD BODY */
+#line 463 "./src/pmc/socket.pmc"
+
+
+    if (!has_delimiter)
+        delimiter = PARROT_SOCKET(_self)->record_separator;
+    {
+        STRING *result = Parrot_io_readline_s(interp, _self, delimiter);
+        #line 848 "./src/pmc/socket.c"
+     {
+        VTABLE_set_string_keyed_int(interp, _call_object, 0, (STRING*)result);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return;
+     }
+#line 469 "./src/pmc/socket.pmc"
+
+    }
+#line 857 "./src/pmc/socket.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Socket_nci_puts(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* buf;
+    
+    const INTVAL arity = 2; /* "PiS" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    buf = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 483 "./src/pmc/socket.pmc"
+
+    const INTVAL res = Parrot_io_write_s(interp, _self, buf);
+    #line 889 "./src/pmc/socket.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)res);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return;
+     }
+#line 485 "./src/pmc/socket.pmc"
+
+#line 897 "./src/pmc/socket.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_Socket_update_vtable(VTABLE *vt) {
+    vt->clone = Parrot_Socket_clone;
+    vt->destroy = Parrot_Socket_destroy;
+    vt->get_bool = Parrot_Socket_get_bool;
+    vt->init = Parrot_Socket_init;
+    vt->mark = Parrot_Socket_mark;
+    vt->attr_size = sizeof(Parrot_Socket_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_Socket_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->clone = Parrot_Socket_clone;
+    vt->destroy = Parrot_Socket_destroy;
+    vt->get_bool = Parrot_Socket_get_bool;
+    vt->mark = Parrot_Socket_mark;
+    vt->attr_size = sizeof(Parrot_Socket_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Socket_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_Handle_get_vtable(interp);
+    Parrot_Socket_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Socket_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_Handle_ro_get_vtable(interp);
+    Parrot_Socket_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_Socket_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+    mro = Parrot_Handle_get_mro(interp, mro);
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "Socket"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_Socket_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    isa = Parrot_Handle_get_isa(interp, isa);
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "Socket")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_Socket_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        ":os_handle Srecord_separator :io_vtable :read_buffer :write_buffer Sencoding Flocal Fremote Ifamily Itype Iprotocol ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_Socket_get_vtable(interp);
+        vt->base_type      = enum_class_Socket;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "Socket");
+        vt->provides_str = CONST_STRING_GEN(interp, "socket");
+        vt->isa_hash     = Parrot_Socket_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_Socket_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_Socket;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_Socket_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "socket");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Socket_nci_socket),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "poll");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Socket_nci_poll),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "sockaddr");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Socket_nci_sockaddr),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "getaddrinfo");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Socket_nci_getaddrinfo),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "remote_address");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Socket_nci_remote_address),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "local_address");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Socket_nci_local_address),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "is_closed");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Socket_nci_is_closed),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "getprotobyname");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Socket_nci_getprotobyname),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "connect");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Socket_nci_connect),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "recv");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Socket_nci_recv),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "send");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Socket_nci_send),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "bind");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Socket_nci_bind),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "listen");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Socket_nci_listen),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "accept");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Socket_nci_accept),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "read");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Socket_nci_read),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "readline");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Socket_nci_readline),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "puts");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Socket_nci_puts),
+                method_name, signature);
+        }
+        {
+        }
+    } /* pass */
+} /* Parrot_Socket_class_init */
+
+#line 495 "./src/pmc/socket.pmc"
+ /* end pmclass */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -0,0 +1,1194 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/string.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_fixedintegerarray.h"
+#include "pmc_string.h"
+#include "pmc_scalar.h"
+#include "pmc_default.h"
+#include "string.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/string.pmc"
+/*
+Copyright (C) 2003-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/string.pmc - String PMC
+
+=head1 DESCRIPTION
+
+C<String> extends C<scalar> to provide a string for languages that want a
+C<string> type without going to an S register.  It acts as a wrapper for the
+functions in F<src/string.c>.
+
+=head2 Methods
+
+=over 4
+
+=cut
+
+*/
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+#line 49 "./src/pmc/string.c"
+static  void  Parrot_String_assign_string_native(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value);
+static  PMC  * Parrot_String_clone(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_String_cmp(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  INTVAL  Parrot_String_cmp_num(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  INTVAL  Parrot_String_cmp_string(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  INTVAL  Parrot_String_elements(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_String_exists_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  void  Parrot_String_freeze(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+static  INTVAL  Parrot_String_get_bool(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_String_get_integer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_String_get_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  INTVAL  Parrot_String_get_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL pos);
+static  PMC  * Parrot_String_get_iter(PARROT_INTERP, ARGMOD(PMC *_self));
+static  FLOATVAL  Parrot_String_get_number(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC  * Parrot_String_get_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  PMC  * Parrot_String_get_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL pos);
+static  STRING*  Parrot_String_get_repr(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING  * Parrot_String_get_string(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING  * Parrot_String_get_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key);
+static  STRING  * Parrot_String_get_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL pos);
+static  void  Parrot_String_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_String_is_equal(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  INTVAL  Parrot_String_is_equal_num(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  INTVAL  Parrot_String_is_equal_string(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void  Parrot_String_mark(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_String_set_bool(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void  Parrot_String_set_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, INTVAL value);
+static  void  Parrot_String_set_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL pos, INTVAL value);
+static  void  Parrot_String_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void  Parrot_String_set_number_native(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value);
+static  void  Parrot_String_set_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void  Parrot_String_set_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, PMC *value);
+static  void  Parrot_String_set_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL pos, PMC *value);
+static  void  Parrot_String_set_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, STRING *const value);
+static  void  Parrot_String_set_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL pos, STRING *const value);
+static  void  Parrot_String_set_string_native(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value);
+static  STRING  * Parrot_String_substr(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL offset, INTVAL length);
+static  void  Parrot_String_thaw(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+static  void Parrot_String_nci_replace(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_String_nci_to_int(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_String_nci_trans(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_String_nci_reverse(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_String_nci_is_integer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_String_nci_reverse_index(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_String_nci_unescape(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_String_class_init(PARROT_INTERP, int, int);
+void    Parrot_String_ro_class_init(PARROT_INTERP, int, int);
+static  void 
+Parrot_String_assign_string_native(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value)
+{
+#line 209 "./src/pmc/string.pmc"
+
+    SETATTR_String_str_val(interp, _self, value);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 104 "./src/pmc/string.c"
+}
+static  PMC  *
+Parrot_String_clone(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 72 "./src/pmc/string.pmc"
+
+    PMC * const dest = Parrot_pmc_new(interp, _self->vtable->base_type);
+    VTABLE_set_string_native(interp, dest, VTABLE_get_string(interp, _self));
+    return dest;
+#line 114 "./src/pmc/string.c"
+}
+static  INTVAL 
+Parrot_String_cmp(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 294 "./src/pmc/string.pmc"
+
+    STRING *str_val;
+    STRING * const v = VTABLE_get_string(interp, value);
+    GETATTR_String_str_val(interp, _self, str_val);
+    return STRING_compare(interp, str_val, v);
+#line 125 "./src/pmc/string.c"
+}
+static  INTVAL 
+Parrot_String_cmp_num(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 312 "./src/pmc/string.pmc"
+
+    STRING        *str_val;
+    FLOATVAL       sf;
+    const FLOATVAL vf = VTABLE_get_number(interp, value);
+    GETATTR_String_str_val(interp, _self, str_val);
+    sf = Parrot_str_to_num(interp, str_val);
+
+    if (sf < vf)
+        return (INTVAL)(-1);
+
+    if (sf > vf)
+        return (INTVAL)(1);
+
+    return (INTVAL)(0);
+#line 145 "./src/pmc/string.c"
+}
+static  INTVAL 
+Parrot_String_cmp_string(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 339 "./src/pmc/string.pmc"
+
+    STRING        *str_val;
+    STRING * const v = VTABLE_get_string(interp, value);
+    GETATTR_String_str_val(interp, _self, str_val);
+    return STRING_compare(interp, str_val, v);
+#line 156 "./src/pmc/string.c"
+}
+static  INTVAL 
+Parrot_String_elements(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 569 "./src/pmc/string.pmc"
+
+    STRING *str_val;
+    GETATTR_String_str_val(interp, _self, str_val);
+    return Parrot_str_length(interp, str_val);
+#line 166 "./src/pmc/string.c"
+}
+static  INTVAL 
+Parrot_String_exists_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 373 "./src/pmc/string.pmc"
+
+    STRING      *str_val;
+    INTVAL       n;
+    const INTVAL k = VTABLE_get_integer(interp, key);
+
+    GETATTR_String_str_val(interp, _self, str_val);
+    n = Parrot_str_length(interp, str_val);
+
+    return (INTVAL)((k >= 0 && k < n) || (k < 0 && -k <= n));
+#line 181 "./src/pmc/string.c"
+}
+static  void 
+Parrot_String_freeze(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 594 "./src/pmc/string.pmc"
+
+    STRING *str_val;
+    interp->vtables[enum_class_default]->freeze(interp, _self, info);
+    GETATTR_String_str_val(interp, _self, str_val);
+    VTABLE_push_string(interp, info, str_val);
+#line 192 "./src/pmc/string.c"
+}
+static  INTVAL 
+Parrot_String_get_bool(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 136 "./src/pmc/string.pmc"
+
+    STRING *str_val;
+    GETATTR_String_str_val(interp, _self, str_val);
+    return Parrot_str_boolean(interp, str_val);
+#line 202 "./src/pmc/string.c"
+}
+static  INTVAL 
+Parrot_String_get_integer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 88 "./src/pmc/string.pmc"
+
+    STRING *str_val;
+    GETATTR_String_str_val(interp, _self, str_val);
+    return Parrot_str_to_int(interp, str_val);
+#line 212 "./src/pmc/string.c"
+}
+static  INTVAL 
+Parrot_String_get_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 417 "./src/pmc/string.pmc"
+
+    return VTABLE_get_integer_keyed_int(interp, _self, VTABLE_get_integer(interp, key));
+#line 220 "./src/pmc/string.c"
+}
+static  INTVAL 
+Parrot_String_get_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL pos)
+{
+#line 421 "./src/pmc/string.pmc"
+
+    STRING      *str_val;
+    GETATTR_String_str_val(interp, _self, str_val);
+    return STRING_ord(interp, str_val, pos);
+#line 230 "./src/pmc/string.c"
+}
+static  PMC  *
+Parrot_String_get_iter(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 575 "./src/pmc/string.pmc"
+
+    return Parrot_pmc_new_init(interp, enum_class_StringIterator, _self);
+#line 238 "./src/pmc/string.c"
+}
+static  FLOATVAL 
+Parrot_String_get_number(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 104 "./src/pmc/string.pmc"
+
+    STRING *str_val;
+    GETATTR_String_str_val(interp, _self, str_val);
+    return Parrot_str_to_num(interp, str_val);
+#line 248 "./src/pmc/string.c"
+}
+static  PMC  *
+Parrot_String_get_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 427 "./src/pmc/string.pmc"
+
+    return VTABLE_get_pmc_keyed_int(interp, _self, VTABLE_get_integer(interp, key));
+#line 256 "./src/pmc/string.c"
+}
+static  PMC  *
+Parrot_String_get_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL pos)
+{
+#line 431 "./src/pmc/string.pmc"
+
+    PMC * const dest = Parrot_pmc_new(interp, _self->vtable->base_type);
+    VTABLE_set_string_native(interp, dest, VTABLE_get_string_keyed_int(interp, _self, pos));
+    return dest;
+#line 266 "./src/pmc/string.c"
+}
+static  STRING* 
+Parrot_String_get_repr(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 731 "./src/pmc/string.pmc"
+
+    return VTABLE_get_string(interp, _self);
+#line 274 "./src/pmc/string.c"
+}
+static  STRING  *
+Parrot_String_get_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 120 "./src/pmc/string.pmc"
+
+    STRING *str_val;
+    GETATTR_String_str_val(interp, _self, str_val);
+    return str_val;
+#line 284 "./src/pmc/string.c"
+}
+static  STRING  *
+Parrot_String_get_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key)
+{
+#line 407 "./src/pmc/string.pmc"
+
+    return VTABLE_get_string_keyed_int(interp, _self, VTABLE_get_integer(interp, key));
+#line 292 "./src/pmc/string.c"
+}
+static  STRING  *
+Parrot_String_get_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL pos)
+{
+#line 411 "./src/pmc/string.pmc"
+
+    STRING      *str_val;
+    GETATTR_String_str_val(interp, _self, str_val);
+    return STRING_substr(interp, str_val, pos, 1);
+#line 302 "./src/pmc/string.c"
+}
+static  void 
+Parrot_String_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 39 "./src/pmc/string.pmc"
+
+    STRING * const str_val = STRINGNULL;
+    SETATTR_String_str_val(interp, _self, str_val);
+
+    PObj_custom_mark_SET(_self);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 314 "./src/pmc/string.c"
+}
+static  INTVAL 
+Parrot_String_is_equal(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 237 "./src/pmc/string.pmc"
+
+    STRING *str_val;
+    STRING * const v = VTABLE_get_string(interp, value);
+    GETATTR_String_str_val(interp, _self, str_val);
+    return (INTVAL)(STRING_equal(interp, str_val, v));
+#line 325 "./src/pmc/string.c"
+}
+static  INTVAL 
+Parrot_String_is_equal_num(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 255 "./src/pmc/string.pmc"
+
+    STRING        *str_val;
+    FLOATVAL       sf;
+    const FLOATVAL vf = VTABLE_get_number(interp, value);
+
+    GETATTR_String_str_val(interp, _self, str_val);
+    sf = Parrot_str_to_num(interp, str_val);
+
+    return (INTVAL)(sf == vf);
+#line 340 "./src/pmc/string.c"
+}
+static  INTVAL 
+Parrot_String_is_equal_string(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 276 "./src/pmc/string.pmc"
+
+    STRING *str_val;
+    STRING * const v = VTABLE_get_string(interp, value);
+    GETATTR_String_str_val(interp, _self, str_val);
+    return STRING_equal(interp, str_val, v);
+#line 351 "./src/pmc/string.c"
+}
+static  void 
+Parrot_String_mark(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 56 "./src/pmc/string.pmc"
+
+    STRING *str_val;
+    GETATTR_String_str_val(interp, _self, str_val);
+    Parrot_gc_mark_STRING_alive(interp, str_val);
+#line 361 "./src/pmc/string.c"
+}
+static  void 
+Parrot_String_set_bool(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+#line 158 "./src/pmc/string.pmc"
+
+    VTABLE_set_string_native(interp, _self, Parrot_str_from_int(interp, value));
+#line 369 "./src/pmc/string.c"
+}
+static  void 
+Parrot_String_set_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, INTVAL value)
+{
+#line 449 "./src/pmc/string.pmc"
+
+    VTABLE_set_integer_keyed_int(interp, _self, VTABLE_get_integer(interp, key), value);
+#line 377 "./src/pmc/string.c"
+}
+static  void 
+Parrot_String_set_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL pos, INTVAL value)
+{
+#line 453 "./src/pmc/string.pmc"
+
+    STRING      *str_val;
+    STRING * const c = Parrot_str_chr(interp, (UINTVAL) value);
+    GETATTR_String_str_val(interp, _self, str_val);
+    str_val = Parrot_str_replace(interp, str_val, pos, 1, c);
+    SETATTR_String_str_val(interp, _self, str_val);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 390 "./src/pmc/string.c"
+}
+static  void 
+Parrot_String_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+#line 154 "./src/pmc/string.pmc"
+
+    VTABLE_set_string_native(interp, _self, Parrot_str_from_int(interp, value));
+#line 398 "./src/pmc/string.c"
+}
+static  void 
+Parrot_String_set_number_native(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value)
+{
+#line 172 "./src/pmc/string.pmc"
+
+    VTABLE_set_string_native(interp, _self, Parrot_str_from_num(interp, value));
+#line 406 "./src/pmc/string.c"
+}
+static  void 
+Parrot_String_set_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 223 "./src/pmc/string.pmc"
+
+    VTABLE_set_string_native(interp, _self, VTABLE_get_string(interp, value));
+#line 414 "./src/pmc/string.c"
+}
+static  void 
+Parrot_String_set_pmc_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, PMC *value)
+{
+#line 461 "./src/pmc/string.pmc"
+
+    VTABLE_set_pmc_keyed_int(interp, _self, VTABLE_get_integer(interp, key), value);
+#line 422 "./src/pmc/string.c"
+}
+static  void 
+Parrot_String_set_pmc_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL pos, PMC *value)
+{
+#line 465 "./src/pmc/string.pmc"
+
+    VTABLE_set_string_keyed_int(interp, _self, pos, VTABLE_get_string(interp, value));
+#line 430 "./src/pmc/string.c"
+}
+static  void 
+Parrot_String_set_string_keyed(PARROT_INTERP, ARGMOD(PMC *_self), PMC *key, STRING *const value)
+{
+#line 437 "./src/pmc/string.pmc"
+
+    VTABLE_set_string_keyed_int(interp, _self, VTABLE_get_integer(interp, key), value);
+#line 438 "./src/pmc/string.c"
+}
+static  void 
+Parrot_String_set_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL pos, STRING *const value)
+{
+#line 441 "./src/pmc/string.pmc"
+
+    STRING      *str_val;
+    const INTVAL len = Parrot_str_length(interp, value);
+    GETATTR_String_str_val(interp, _self, str_val);
+    str_val = Parrot_str_replace(interp, str_val, pos, len, value);
+    SETATTR_String_str_val(interp, _self, str_val);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 451 "./src/pmc/string.c"
+}
+static  void 
+Parrot_String_set_string_native(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value)
+{
+#line 187 "./src/pmc/string.pmc"
+
+    if (value == NULL)
+        value = STRINGNULL;
+
+    /* Only allow constant PMCs to embed constant strings */
+    if (PObj_constant_TEST(_self) && !PObj_constant_TEST(value))
+        value = Parrot_str_new_init(interp, value->strstart, value->bufused,
+                                    value->encoding, PObj_constant_FLAG);
+
+    SETATTR_String_str_val(interp, _self, value);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 468 "./src/pmc/string.c"
+}
+static  STRING  *
+Parrot_String_substr(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL offset, INTVAL length)
+{
+#line 356 "./src/pmc/string.pmc"
+
+    STRING *str_val, *ret;
+    GETATTR_String_str_val(interp, _self, str_val);
+    return STRING_substr(interp, str_val, offset, length);
+#line 478 "./src/pmc/string.c"
+}
+static  void 
+Parrot_String_thaw(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 610 "./src/pmc/string.pmc"
+
+    interp->vtables[enum_class_default]->thaw(interp, _self, info);
+    SETATTR_String_str_val(interp, _self, VTABLE_shift_string(interp, info));
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 488 "./src/pmc/string.c"
+}
+static  void
+Parrot_String_nci_replace(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* orig;
+    STRING* _new;
+    
+    const INTVAL arity = 3; /* "PiSS" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    orig = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+    _new = VTABLE_get_string_keyed_int(interp, _call_object, 2);
+
+    { /* BEGIN PMETHOD BODY */
+#line 478 "./src/pmc/string.pmc"
+
+    const INTVAL   old_len = Parrot_str_length(interp, orig);
+    const INTVAL   new_len = Parrot_str_length(interp, _new);
+    STRING       * s       = VTABLE_get_string(interp, _self);
+    INTVAL         i       = 0;
+
+    while (-1 != (i = STRING_index(interp, s, orig, i))) {
+        s = Parrot_str_replace(interp, s, i, old_len, _new);
+        i += new_len;
+    }
+
+    VTABLE_set_string_native(interp, _self, s);
+#line 525 "./src/pmc/string.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_String_nci_to_int(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    INTVAL base;
+    
+    const INTVAL arity = 2; /* "PiI" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    base = VTABLE_get_integer_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 508 "./src/pmc/string.pmc"
+
+    PMC * const result = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp,
+                    enum_class_Integer));
+
+    String_iter   iter;
+    const STRING * const me  = VTABLE_get_string(interp, _self);
+    UINTVAL       i   = 0;
+    size_t        len = STRING_length(me);
+
+    if (base < 2 || base > 36)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+                "invalid conversion to int - bad base %d", base);
+
+    STRING_ITER_INIT(interp, &iter);
+
+    while (iter.charpos < len) {
+        const int c = STRING_iter_get_and_advance(interp, me, &iter);
+        int dig;
+
+        if (isdigit((unsigned char)c))
+            dig = c - '0';
+        else if (c >= 'a' && c <= 'z')
+            dig = c - 'a' + 10;
+        else if (c >= 'A' && c <= 'Z')
+            dig = c - 'A' + 10;
+        else
+            dig = base;
+
+        if (dig >= base)
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+                    "invalid conversion to int - bad char %c", c);
+
+        i = i * base + dig;
+    }
+
+    /* TODO: autopromote to BigInt instead of casting away the high bit */
+    VTABLE_set_integer_native(interp, result, (INTVAL)i);
+    #line 592 "./src/pmc/string.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)result);
+        
+        return;
+     }
+#line 545 "./src/pmc/string.pmc"
+
+#line 600 "./src/pmc/string.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_String_nci_trans(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* src;
+    PMC* table;
+    
+    const INTVAL arity = 3; /* "PiSP" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    src = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+    table = VTABLE_get_pmc_keyed_int(interp, _call_object, 2);
+
+    { /* BEGIN PMETHOD BODY */
+#line 630 "./src/pmc/string.pmc"
+
+    unsigned char *p;
+    INTVAL        *tr_data;
+    INTVAL         i;
+    STRING        *dest;
+
+    const INTVAL len = Parrot_str_length(interp, src);
+
+    if (!len)
+        #line 641 "./src/pmc/string.c"
+     {
+        VTABLE_set_string_keyed_int(interp, _call_object, 0, (STRING*)src);
+        
+        return;
+     }
+#line 639 "./src/pmc/string.pmc"
+
+
+    if (src->encoding != Parrot_ascii_encoding_ptr)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_ENCODING,
+            "Can't translate non-ascii");
+
+    dest = Parrot_str_clone(interp, src);
+    p = (unsigned char *)(dest->strstart);
+    /* TODO verify trans table */
+
+    GETATTR_FixedIntegerArray_int_array(interp, table, tr_data);
+
+    for (i = 0; i < len; ++i, ++p) {
+        const unsigned char ch = (unsigned char)tr_data[*p];
+        if (ch)
+            *p = ch;
+    }
+
+    dest->hashval = 0; /* hash is invalid */
+    #line 667 "./src/pmc/string.c"
+     {
+        VTABLE_set_string_keyed_int(interp, _call_object, 0, (STRING*)dest);
+        
+        return;
+     }
+#line 658 "./src/pmc/string.pmc"
+
+#line 675 "./src/pmc/string.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_String_nci_reverse(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* src;
+    INTVAL got_src;
+    
+    const INTVAL arity = 1; /* "PiSoIp" */
+    const INTVAL arity_opt  = 1;
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count < arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too few arguments: %d passed, %d expected",
+                                    param_count, arity);
+    if (param_count > arity + arity_opt)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too many arguments: %d passed, %d expected",
+                                    param_count, arity + arity_opt);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    if (param_count > 1) {
+        src = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+        got_src = 1;
+    }
+    else {
+        src = STRINGNULL;
+        got_src = 0;
+    }
+
+    { /* BEGIN PMETHOD BODY */
+#line 672 "./src/pmc/string.pmc"
+
+    if (got_src) {
+        SETATTR_String_str_val(interp, _self, Parrot_str_reverse(interp, src));
+    }
+    else {
+        STRING *s;
+        GETATTR_String_str_val(interp, _self, s);
+        SETATTR_String_str_val(interp, _self, Parrot_str_reverse(interp, s));
+    }
+#line 728 "./src/pmc/string.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_String_nci_is_integer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* src;
+    
+    const INTVAL arity = 2; /* "PiS" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    src = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 694 "./src/pmc/string.pmc"
+
+    const INTVAL   len = Parrot_str_length(interp, src);
+
+    if (!len)
+        #line 762 "./src/pmc/string.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)0);
+        
+        return;
+     }
+#line 698 "./src/pmc/string.pmc"
+
+
+    if (STRING_max_bytes_per_codepoint(src) == 1) {
+        const char *p = src->strstart;
+        if (p[0] == '-' || p[0] == '+' || (p[0] >= '0' && p[0] <= '9')) {
+            int i;
+            for (i = 1; i < len; ++i)
+                if (p[i] < '0' || p[i] > '9')
+                    #line 777 "./src/pmc/string.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)0);
+        
+        return;
+     }
+#line 706 "./src/pmc/string.pmc"
+
+
+            #line 786 "./src/pmc/string.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)1);
+        
+        return;
+     }
+#line 708 "./src/pmc/string.pmc"
+
+        }
+        else
+            #line 796 "./src/pmc/string.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)0);
+        
+        return;
+     }
+#line 711 "./src/pmc/string.pmc"
+
+    }
+    else {
+        String_iter iter;
+        UINTVAL c;
+        INTVAL i = 0;
+        STRING_ITER_INIT(interp, &iter);
+        c = STRING_iter_get_and_advance(interp, src, &iter);
+        if ((c == '-' && len < 2) || c < '0' || c > '9')
+                #line 812 "./src/pmc/string.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)0);
+        
+        return;
+     }
+#line 720 "./src/pmc/string.pmc"
+
+        ++i;
+        for (; i < len; ++i) {
+            c = STRING_iter_get_and_advance(interp, src, &iter);
+            if (c < '0' || c > '9')
+                #line 824 "./src/pmc/string.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)0);
+        
+        return;
+     }
+#line 725 "./src/pmc/string.pmc"
+
+        }
+        #line 833 "./src/pmc/string.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)1);
+        
+        return;
+     }
+#line 727 "./src/pmc/string.pmc"
+
+    }
+#line 842 "./src/pmc/string.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_String_nci_reverse_index(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* substring;
+    INTVAL start;
+    INTVAL has_start;
+    
+    const INTVAL arity = 2; /* "PiSIoIp" */
+    const INTVAL arity_opt  = 1;
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count < arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too few arguments: %d passed, %d expected",
+                                    param_count, arity);
+    if (param_count > arity + arity_opt)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too many arguments: %d passed, %d expected",
+                                    param_count, arity + arity_opt);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    substring = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+    if (param_count > 2) {
+        start = VTABLE_get_integer_keyed_int(interp, _call_object, 2);
+        has_start = 1;
+    }
+    else {
+        start = 0;
+        has_start = 0;
+    }
+
+    { /* BEGIN PMETHOD BODY */
+#line 746 "./src/pmc/string.pmc"
+
+    const STRING * const src = VTABLE_get_string(interp, _self);
+    INTVAL         res;
+    UINTVAL        len;
+
+    if (!has_start)
+        start = STRING_length(src);
+    res = Parrot_str_find_reverse_index(interp, src, substring, start);
+    #line 896 "./src/pmc/string.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)res);
+        
+        return;
+     }
+#line 754 "./src/pmc/string.pmc"
+
+#line 904 "./src/pmc/string.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_String_nci_unescape(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* encodingname;
+    
+    const INTVAL arity = 2; /* "PiS" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    encodingname = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 768 "./src/pmc/string.pmc"
+
+    const STR_VTABLE * const encoding = Parrot_find_encoding_by_string(interp, encodingname);
+    STRING * const src = VTABLE_get_string(interp, _self);
+    STRING * const dest = Parrot_str_unescape_string(interp, src,
+            encoding, 0);
+    Parrot_warn_experimental(interp, "Method unescape on String is experimental");
+    #line 940 "./src/pmc/string.c"
+     {
+        VTABLE_set_string_keyed_int(interp, _call_object, 0, (STRING*)dest);
+        
+        return;
+     }
+#line 774 "./src/pmc/string.pmc"
+
+#line 948 "./src/pmc/string.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_String_update_vtable(VTABLE *vt) {
+    vt->assign_string_native = Parrot_String_assign_string_native;
+    vt->clone = Parrot_String_clone;
+    vt->cmp = Parrot_String_cmp;
+    vt->cmp_num = Parrot_String_cmp_num;
+    vt->cmp_string = Parrot_String_cmp_string;
+    vt->elements = Parrot_String_elements;
+    vt->exists_keyed = Parrot_String_exists_keyed;
+    vt->freeze = Parrot_String_freeze;
+    vt->get_bool = Parrot_String_get_bool;
+    vt->get_integer = Parrot_String_get_integer;
+    vt->get_integer_keyed = Parrot_String_get_integer_keyed;
+    vt->get_integer_keyed_int = Parrot_String_get_integer_keyed_int;
+    vt->get_iter = Parrot_String_get_iter;
+    vt->get_number = Parrot_String_get_number;
+    vt->get_pmc_keyed = Parrot_String_get_pmc_keyed;
+    vt->get_pmc_keyed_int = Parrot_String_get_pmc_keyed_int;
+    vt->get_repr = Parrot_String_get_repr;
+    vt->get_string = Parrot_String_get_string;
+    vt->get_string_keyed = Parrot_String_get_string_keyed;
+    vt->get_string_keyed_int = Parrot_String_get_string_keyed_int;
+    vt->init = Parrot_String_init;
+    vt->is_equal = Parrot_String_is_equal;
+    vt->is_equal_num = Parrot_String_is_equal_num;
+    vt->is_equal_string = Parrot_String_is_equal_string;
+    vt->mark = Parrot_String_mark;
+    vt->set_bool = Parrot_String_set_bool;
+    vt->set_integer_keyed = Parrot_String_set_integer_keyed;
+    vt->set_integer_keyed_int = Parrot_String_set_integer_keyed_int;
+    vt->set_integer_native = Parrot_String_set_integer_native;
+    vt->set_number_native = Parrot_String_set_number_native;
+    vt->set_pmc = Parrot_String_set_pmc;
+    vt->set_pmc_keyed = Parrot_String_set_pmc_keyed;
+    vt->set_pmc_keyed_int = Parrot_String_set_pmc_keyed_int;
+    vt->set_string_keyed = Parrot_String_set_string_keyed;
+    vt->set_string_keyed_int = Parrot_String_set_string_keyed_int;
+    vt->set_string_native = Parrot_String_set_string_native;
+    vt->substr = Parrot_String_substr;
+    vt->thaw = Parrot_String_thaw;
+    vt->attr_size = sizeof(Parrot_String_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_String_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->clone = Parrot_String_clone;
+    vt->cmp = Parrot_String_cmp;
+    vt->cmp_num = Parrot_String_cmp_num;
+    vt->cmp_string = Parrot_String_cmp_string;
+    vt->elements = Parrot_String_elements;
+    vt->exists_keyed = Parrot_String_exists_keyed;
+    vt->freeze = Parrot_String_freeze;
+    vt->get_bool = Parrot_String_get_bool;
+    vt->get_integer = Parrot_String_get_integer;
+    vt->get_integer_keyed = Parrot_String_get_integer_keyed;
+    vt->get_integer_keyed_int = Parrot_String_get_integer_keyed_int;
+    vt->get_iter = Parrot_String_get_iter;
+    vt->get_number = Parrot_String_get_number;
+    vt->get_pmc_keyed = Parrot_String_get_pmc_keyed;
+    vt->get_pmc_keyed_int = Parrot_String_get_pmc_keyed_int;
+    vt->get_repr = Parrot_String_get_repr;
+    vt->get_string = Parrot_String_get_string;
+    vt->get_string_keyed = Parrot_String_get_string_keyed;
+    vt->get_string_keyed_int = Parrot_String_get_string_keyed_int;
+    vt->is_equal = Parrot_String_is_equal;
+    vt->is_equal_num = Parrot_String_is_equal_num;
+    vt->is_equal_string = Parrot_String_is_equal_string;
+    vt->mark = Parrot_String_mark;
+    vt->substr = Parrot_String_substr;
+    vt->attr_size = sizeof(Parrot_String_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_String_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_scalar_get_vtable(interp);
+    Parrot_String_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_String_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_scalar_ro_get_vtable(interp);
+    Parrot_String_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_String_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+    mro = Parrot_scalar_get_mro(interp, mro);
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "String"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_String_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    isa = Parrot_scalar_get_isa(interp, isa);
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "String")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_String_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "Sstr_val ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_String_get_vtable(interp);
+        vt->base_type      = enum_class_String;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "String");
+        vt->provides_str = CONST_STRING_GEN(interp, "scalar string");
+        vt->isa_hash     = Parrot_String_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_String_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_String;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_String_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "replace");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_String_nci_replace),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "to_int");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_String_nci_to_int),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "trans");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_String_nci_trans),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "reverse");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_String_nci_reverse),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "is_integer");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_String_nci_is_integer),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "reverse_index");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_String_nci_reverse_index),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "unescape");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_String_nci_unescape),
+                method_name, signature);
+        }
+        {
+        }
+    } /* pass */
+} /* Parrot_String_class_init */
+
+#line 776 "./src/pmc/string.pmc"
+
+
+/*
+
+=back
+
+=cut
+
+*/
+
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
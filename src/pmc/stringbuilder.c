@@ -0,0 +1,1034 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/stringbuilder.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_fixedintegerarray.h"
+#include "pmc_stringbuilder.h"
+#include "pmc_default.h"
+#include "stringbuilder.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/stringbuilder.pmc"
+/*
+Copyright (C) 2010-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/stringbuilder.pmc - StringBuilder PMC
+
+=head1 DESCRIPTION
+
+Helper class to create and manipulate strings, which are outside of
+StringBuilder immutable.
+
+Short strings are copied into a growable buffer. Strings of at least
+C<CHUNK_MIN_BYTES> bytes (or all strings, see C<chunked>) are instead kept
+by reference as chunks, since strings are immutable, and copied only once
+when the result is requested, into a string allocated with its exact size.
+
+=head2 Methods
+
+=over 4
+
+=cut
+
+*/
+
+#include "parrot/string_funcs.h"
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+static int append_chunk(PARROT_INTERP, ARGIN(PMC *self), ARGIN(STRING *s))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CONST_FUNCTION
+static size_t calculate_capacity(PARROT_INTERP, size_t needed);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static const STR_VTABLE * chunk_encoding(PARROT_INTERP,
+    ARGIN(PMC *self),
+    ARGIN(const STRING *s))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+static void convert_encoding(PARROT_INTERP,
+    ARGIN(STR_VTABLE *dest_encoding),
+    ARGMOD(STRING *buffer),
+    size_t size_to_add)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*buffer);
+
+PARROT_CANNOT_RETURN_NULL
+static STRING * materialize(PARROT_INTERP, ARGIN(PMC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static int seal_buffer(PARROT_INTERP, ARGIN(PMC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+#define ASSERT_ARGS_append_chunk __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(s))
+#define ASSERT_ARGS_calculate_capacity __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_chunk_encoding __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(s))
+#define ASSERT_ARGS_convert_encoding __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(dest_encoding) \
+    , PARROT_ASSERT_ARG(buffer))
+#define ASSERT_ARGS_materialize __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_seal_buffer __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+#define INITIAL_STRING_CAPACITY 128
+#define INITIAL_CHUNK_SLOTS     8
+
+/* Strings at least this long are appended by reference */
+#define CHUNK_MIN_BYTES         256
+#line 118 "./src/pmc/stringbuilder.c"
+static  void  Parrot_StringBuilder_destroy(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_StringBuilder_get_integer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING  * Parrot_StringBuilder_get_string(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_StringBuilder_i_concatenate(PARROT_INTERP, ARGMOD(PMC *_self), PMC *p);
+static  void  Parrot_StringBuilder_i_concatenate_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *s);
+static  void  Parrot_StringBuilder_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_StringBuilder_init_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL initial_size);
+static  void  Parrot_StringBuilder_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *ar);
+static  void  Parrot_StringBuilder_mark(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_StringBuilder_push_integer(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void  Parrot_StringBuilder_push_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *p);
+static  void  Parrot_StringBuilder_push_string(PARROT_INTERP, ARGMOD(PMC *_self), STRING *s);
+static  void  Parrot_StringBuilder_set_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *s);
+static  void  Parrot_StringBuilder_set_string_native(PARROT_INTERP, ARGMOD(PMC *_self), STRING *s);
+static  STRING  * Parrot_StringBuilder_substr(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL offset, INTVAL length);
+static  void Parrot_StringBuilder_nci_append_format(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_StringBuilder_nci_get_string_length(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_StringBuilder_nci_chunked(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_StringBuilder_class_init(PARROT_INTERP, int, int);
+void    Parrot_StringBuilder_ro_class_init(PARROT_INTERP, int, int);
+static  void 
+Parrot_StringBuilder_destroy(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 211 "./src/pmc/stringbuilder.pmc"
+
+    if (PMC_data(_self)) {
+        STRING **chunks;
+        GETATTR_StringBuilder_chunks(interp, _self, chunks);
+
+        if (chunks)
+            mem_gc_free(interp, chunks);
+    }
+#line 151 "./src/pmc/stringbuilder.c"
+}
+static  INTVAL 
+Parrot_StringBuilder_get_integer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 432 "./src/pmc/stringbuilder.pmc"
+
+    STRING *buffer;
+    GETATTR_StringBuilder_buffer(interp, _self, buffer);
+    return Buffer_buflen(buffer);
+#line 161 "./src/pmc/stringbuilder.c"
+}
+static  STRING  *
+Parrot_StringBuilder_get_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 232 "./src/pmc/stringbuilder.pmc"
+
+    Parrot_StringBuilder_attributes * const attrs =
+        PARROT_STRINGBUILDER(_self);
+
+    /* We need to build a new string because outside of StringBuilder
+     * strings are immutable. */
+    if (attrs->chunk_count == 0)
+        return Parrot_str_clone(interp, attrs->buffer);
+
+    if (attrs->chunk_count == 1 && attrs->buffer->bufused == 0)
+        return attrs->chunks[0];
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+    return materialize(interp, _self);
+#line 181 "./src/pmc/stringbuilder.c"
+}
+static  void 
+Parrot_StringBuilder_i_concatenate(PARROT_INTERP, ARGMOD(PMC *_self), PMC *p)
+{
+#line 369 "./src/pmc/stringbuilder.pmc"
+
+    Parrot_StringBuilder_push_string(interp, _self, VTABLE_get_string(interp, p));
+#line 189 "./src/pmc/stringbuilder.c"
+}
+static  void 
+Parrot_StringBuilder_i_concatenate_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *s)
+{
+#line 365 "./src/pmc/stringbuilder.pmc"
+
+    Parrot_StringBuilder_push_string(interp, _self, s);
+#line 197 "./src/pmc/stringbuilder.c"
+}
+static  void 
+Parrot_StringBuilder_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 117 "./src/pmc/stringbuilder.pmc"
+
+    Parrot_StringBuilder_init_int(interp, _self, INITIAL_STRING_CAPACITY);
+#line 205 "./src/pmc/stringbuilder.c"
+}
+static  void 
+Parrot_StringBuilder_init_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL initial_size)
+{
+#line 132 "./src/pmc/stringbuilder.pmc"
+
+    STRING * const buffer = Parrot_gc_new_string_header(interp, 0);
+
+    if (initial_size < INITIAL_STRING_CAPACITY)
+        initial_size = INITIAL_STRING_CAPACITY;
+
+    Parrot_gc_allocate_string_storage(interp, buffer, initial_size);
+    buffer->encoding = Parrot_default_encoding_ptr;
+
+    SETATTR_StringBuilder_buffer(interp, _self, buffer);
+    SETATTR_StringBuilder_chunk_threshold(interp, _self, CHUNK_MIN_BYTES);
+
+    PObj_custom_mark_SET(_self);
+    PObj_custom_destroy_SET(_self);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 226 "./src/pmc/stringbuilder.c"
+}
+static  void 
+Parrot_StringBuilder_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *ar)
+{
+#line 159 "./src/pmc/stringbuilder.pmc"
+
+    const INTVAL count = VTABLE_elements(interp, ar);
+
+    if (!count)
+        Parrot_StringBuilder_init_int(interp, _self, INITIAL_STRING_CAPACITY);
+    else {
+        STRING * const first = VTABLE_get_string_keyed_int(interp, ar, 0);
+        const INTVAL   size  = Parrot_str_byte_length(interp, first);
+        INTVAL         i;
+
+        /* it's just an estimate, but estimates help */
+        Parrot_StringBuilder_init_int(interp, _self, size * count);
+        VTABLE_push_string(interp, _self, first);
+
+        for (i = 1; i < count; ++i)
+            VTABLE_push_string(interp, _self, VTABLE_get_string_keyed_int(interp, ar, i));
+    }
+#line 249 "./src/pmc/stringbuilder.c"
+}
+static  void 
+Parrot_StringBuilder_mark(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 188 "./src/pmc/stringbuilder.pmc"
+
+    if (PMC_data(_self)) {
+        Parrot_StringBuilder_attributes * const attrs =
+            PARROT_STRINGBUILDER(_self);
+        INTVAL i;
+
+        Parrot_gc_mark_STRING_alive(interp, attrs->buffer);
+
+        for (i = 0; i < attrs->chunk_count; ++i)
+            Parrot_gc_mark_STRING_alive(interp, attrs->chunks[i]);
+    }
+#line 266 "./src/pmc/stringbuilder.c"
+}
+static  void 
+Parrot_StringBuilder_push_integer(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+#line 327 "./src/pmc/stringbuilder.pmc"
+
+    STRING * s = PARROT_STRINGBUILDER(_self)->buffer;
+    String_iter iter;
+    size_t total_size;
+
+    if (s->encoding != Parrot_utf8_encoding_ptr && value > 0x7F) {
+        if (s->strlen == 0)
+            s->encoding = Parrot_utf8_encoding_ptr;
+        else
+            convert_encoding(interp, Parrot_utf8_encoding_ptr, s, sizeof (INTVAL));
+    }
+
+    total_size = s->bufused + sizeof (INTVAL);
+    if (total_size > s->_buflen) {
+        total_size = calculate_capacity(interp, total_size);
+        Parrot_gc_reallocate_string_storage(interp, s, total_size);
+    }
+
+    STRING_ITER_INIT(interp, &iter);
+    iter.charpos = s->strlen;
+    iter.bytepos = s->bufused;
+    STRING_iter_set_and_advance(interp, s, &iter, value);
+    s->strlen = iter.charpos;
+    s->bufused = iter.bytepos;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 297 "./src/pmc/stringbuilder.c"
+}
+static  void 
+Parrot_StringBuilder_push_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *p)
+{
+#line 373 "./src/pmc/stringbuilder.pmc"
+
+    Parrot_StringBuilder_push_string(interp, _self, VTABLE_get_string(interp, p));
+#line 305 "./src/pmc/stringbuilder.c"
+}
+static  void 
+Parrot_StringBuilder_push_string(PARROT_INTERP, ARGMOD(PMC *_self), STRING *s)
+{
+#line 258 "./src/pmc/stringbuilder.pmc"
+
+    STRING           *buffer;
+    size_t            total_size;
+
+    INTVAL            threshold;
+
+    /* Early return on NULL strings */
+    if (STRING_IS_NULL(s) || s->strlen == 0)
+        return;
+
+    /* Append long strings by reference if the encodings allow it */
+    GETATTR_StringBuilder_chunk_threshold(interp, _self, threshold);
+    if (s->bufused >= (UINTVAL)threshold
+    &&  seal_buffer(interp, _self)
+    &&  append_chunk(interp, _self, s))
+        return;
+
+    GETATTR_StringBuilder_buffer(interp, _self, buffer);
+
+    if (buffer->bufused == 0) {
+        /* Always copy the encoding of the first string. The IO functions
+           assume that the concatenation of utf8 strings doesn't change
+           the encoding. */
+        buffer->encoding = s->encoding;
+    }
+    else {
+        const STR_VTABLE * const enc =
+              buffer->encoding == s->encoding
+            ? buffer->encoding
+            : Parrot_str_rep_compatible(interp, buffer, s);
+
+        if (enc) {
+            buffer->encoding = enc;
+        }
+        else {
+            /* If strings are incompatible - convert them to utf8 */
+
+            if (s->encoding != Parrot_utf8_encoding_ptr)
+                s = Parrot_utf8_encoding_ptr->to_encoding(interp, s);
+
+            if (buffer->encoding != Parrot_utf8_encoding_ptr)
+                convert_encoding(interp, Parrot_utf8_encoding_ptr, buffer, s->bufused);
+        }
+    }
+
+    total_size = buffer->bufused + s->bufused;
+
+    /* Reallocate if necessary */
+    if (total_size > buffer->_buflen) {
+        /* Calculate (possibly new) total size */
+        total_size = calculate_capacity(interp, total_size);
+
+        Parrot_gc_reallocate_string_storage(interp, buffer, total_size);
+        buffer->_buflen = total_size;
+    }
+
+    /* Tack s on the end of buffer */
+    memcpy((char *)buffer->_bufstart + buffer->bufused,
+            s->strstart, s->bufused);
+
+    /* Update buffer */
+    buffer->bufused += s->bufused;
+    buffer->strstart = (char *)buffer->_bufstart;
+    buffer->strlen  += s->strlen;
+    buffer->hashval  = 0; /* hash is invalid */
+
+    PARROT_ASSERT(buffer->bufused <= Buffer_buflen(buffer));
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 379 "./src/pmc/stringbuilder.c"
+}
+static  void 
+Parrot_StringBuilder_set_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *s)
+{
+#line 415 "./src/pmc/stringbuilder.pmc"
+
+    Parrot_StringBuilder_set_string_native(interp, _self, VTABLE_get_string(interp, s));
+#line 387 "./src/pmc/stringbuilder.c"
+}
+static  void 
+Parrot_StringBuilder_set_string_native(PARROT_INTERP, ARGMOD(PMC *_self), STRING *s)
+{
+#line 388 "./src/pmc/stringbuilder.pmc"
+
+    STRING * buffer;
+
+    /* Calculate (possibly new) total size */
+    const size_t total_size = calculate_capacity(interp, s->bufused);
+
+    GETATTR_StringBuilder_buffer(interp, _self, buffer);
+    SETATTR_StringBuilder_chunk_count(interp, _self, 0);
+    SETATTR_StringBuilder_chunk_bytes(interp, _self, 0);
+    SETATTR_StringBuilder_chunk_chars(interp, _self, 0);
+
+    /* Reallocate if necessary */
+    if (total_size > Buffer_buflen(buffer)) {
+        Parrot_gc_reallocate_string_storage(interp, buffer, total_size);
+        buffer->strstart = (char*)buffer->_bufstart;
+    }
+
+    /* Tack s on the buffer */
+    memcpy((void *)((char*)buffer->_bufstart),
+            s->strstart, s->bufused);
+
+    /* Update buffer */
+    buffer->bufused  = s->bufused;
+    buffer->strlen   = Parrot_str_length(interp, s);
+    buffer->encoding = s->encoding;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 419 "./src/pmc/stringbuilder.c"
+}
+static  STRING  *
+Parrot_StringBuilder_substr(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL offset, INTVAL length)
+{
+#line 446 "./src/pmc/stringbuilder.pmc"
+
+    STRING *buffer;
+    INTVAL  chunk_count;
+
+    GETATTR_StringBuilder_chunk_count(interp, _self, chunk_count);
+    if (chunk_count)
+        return STRING_substr(interp, Parrot_StringBuilder_get_string(interp, _self), offset, length);
+
+    GETATTR_StringBuilder_buffer(interp, _self, buffer);
+    /* We must clone here because we cannot reallocate buffer behind the scene... */
+    /* TODO Optimize it to avoid creation of redundant STRING */
+    return Parrot_str_clone(interp,
+            STRING_substr(interp, buffer, offset, length));
+#line 438 "./src/pmc/stringbuilder.c"
+}
+static  void
+Parrot_StringBuilder_nci_append_format(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* fmt;
+    PMC* args;
+    PMC* hash;
+    
+    Parrot_pcc_fill_params_from_c_args(interp, _call_object, "PiSPsPns",
+        &_self, &fmt, &args, &hash);
+
+    { /* BEGIN PMETHOD BODY */
+#line 484 "./src/pmc/stringbuilder.pmc"
+
+    STRING * const percent     = CONST_STRING(interp, "%");
+    STRING * const comma       = CONST_STRING(interp, ",");
+    STRING * const comma_space = CONST_STRING(interp, ", ");
+    PMC    *stringbuilder = _self;
+    INTVAL pos = 0;
+
+    /* Loop over the format string, splitting it into chunks
+     * for the string builder. */
+    while (pos >= 0) {
+        /* Find the next % */
+        const INTVAL percentPos = STRING_index(interp, fmt, percent, pos);
+        STRING *key;
+
+        if (percentPos < 0) {
+            if (pos == 0) {
+                VTABLE_push_string(interp, stringbuilder, fmt);
+            }
+            else {
+                /* remaining string can be added as is. */
+                VTABLE_push_string(interp, stringbuilder,
+                    STRING_substr(interp, fmt, pos,
+                        Parrot_str_length(interp, fmt) -pos));
+                }
+            break;
+        }
+        else {
+            /* slurp up to just before the % sign... */
+            VTABLE_push_string(interp, stringbuilder,
+                STRING_substr(interp, fmt, pos, percentPos - pos));
+            /* skip the % sign */
+            pos = percentPos + 1 ;
+        }
+
+        /* key is always a single character */
+        key = STRING_substr(interp, fmt, pos++, 1);
+
+        if (VTABLE_exists_keyed_str(interp, hash, key)) {
+            VTABLE_push_string(interp, stringbuilder,
+                    VTABLE_get_string_keyed_str(interp, hash, key));
+        }
+        else if (Parrot_str_is_cclass(interp, enum_cclass_numeric, key, 0)) {
+            VTABLE_push_string(interp, stringbuilder,
+                VTABLE_get_string_keyed_int(interp, args,
+                    Parrot_str_to_int(interp, key)));
+        }
+        else if (STRING_equal(interp, key, comma)) {
+            INTVAL num_args = VTABLE_elements(interp, args);
+            INTVAL pos_args;
+
+            for (pos_args = 0; pos_args < num_args; ++pos_args) {
+                if (pos_args > 0)
+                    VTABLE_push_string(interp, stringbuilder, comma_space);
+                VTABLE_push_string(interp, stringbuilder,
+                    VTABLE_get_string_keyed_int(interp, args, pos_args));
+            }
+        }
+        else if (STRING_equal(interp, key, percent)) {
+            VTABLE_push_string(interp, stringbuilder, percent);
+        }
+        else {
+            /* %foo has no special meaning, pass it through unchanged */
+            VTABLE_push_string(interp, stringbuilder,
+                STRING_substr(interp, fmt, pos-2, 2));
+        }
+    }
+
+    #line 523 "./src/pmc/stringbuilder.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)_self);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return;
+     }
+#line 551 "./src/pmc/stringbuilder.pmc"
+
+#line 531 "./src/pmc/stringbuilder.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_StringBuilder_nci_get_string_length(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 564 "./src/pmc/stringbuilder.pmc"
+
+    STRING *buffer;
+    UINTVAL chunk_chars;
+    INTVAL  length;
+    GETATTR_StringBuilder_buffer(interp, _self, buffer);
+    GETATTR_StringBuilder_chunk_chars(interp, _self, chunk_chars);
+    length = chunk_chars + Parrot_str_length(interp, buffer);
+    #line 566 "./src/pmc/stringbuilder.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)length);
+        
+        return;
+     }
+#line 571 "./src/pmc/stringbuilder.pmc"
+
+#line 574 "./src/pmc/stringbuilder.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_StringBuilder_nci_chunked(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    INTVAL min_bytes;
+    INTVAL has_min;
+    
+    const INTVAL arity = 1; /* "PiIoIp" */
+    const INTVAL arity_opt  = 1;
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count < arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too few arguments: %d passed, %d expected",
+                                    param_count, arity);
+    if (param_count > arity + arity_opt)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too many arguments: %d passed, %d expected",
+                                    param_count, arity + arity_opt);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    if (param_count > 1) {
+        min_bytes = VTABLE_get_integer_keyed_int(interp, _call_object, 1);
+        has_min = 1;
+    }
+    else {
+        min_bytes = 0;
+        has_min = 0;
+    }
+
+    { /* BEGIN PMETHOD BODY */
+#line 586 "./src/pmc/stringbuilder.pmc"
+
+    SETATTR_StringBuilder_chunk_threshold(interp, _self, has_min ? min_bytes : 0);
+    #line 620 "./src/pmc/stringbuilder.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)_self);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        return;
+     }
+#line 588 "./src/pmc/stringbuilder.pmc"
+
+#line 628 "./src/pmc/stringbuilder.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_StringBuilder_update_vtable(VTABLE *vt) {
+    vt->destroy = Parrot_StringBuilder_destroy;
+    vt->get_integer = Parrot_StringBuilder_get_integer;
+    vt->get_string = Parrot_StringBuilder_get_string;
+    vt->i_concatenate = Parrot_StringBuilder_i_concatenate;
+    vt->i_concatenate_str = Parrot_StringBuilder_i_concatenate_str;
+    vt->init = Parrot_StringBuilder_init;
+    vt->init_int = Parrot_StringBuilder_init_int;
+    vt->init_pmc = Parrot_StringBuilder_init_pmc;
+    vt->mark = Parrot_StringBuilder_mark;
+    vt->push_integer = Parrot_StringBuilder_push_integer;
+    vt->push_pmc = Parrot_StringBuilder_push_pmc;
+    vt->push_string = Parrot_StringBuilder_push_string;
+    vt->set_pmc = Parrot_StringBuilder_set_pmc;
+    vt->set_string_native = Parrot_StringBuilder_set_string_native;
+    vt->substr = Parrot_StringBuilder_substr;
+    vt->attr_size = sizeof(Parrot_StringBuilder_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_StringBuilder_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->destroy = Parrot_StringBuilder_destroy;
+    vt->get_integer = Parrot_StringBuilder_get_integer;
+    vt->get_string = Parrot_StringBuilder_get_string;
+    vt->mark = Parrot_StringBuilder_mark;
+    vt->substr = Parrot_StringBuilder_substr;
+    vt->attr_size = sizeof(Parrot_StringBuilder_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_StringBuilder_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_StringBuilder_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_StringBuilder_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_StringBuilder_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_StringBuilder_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "StringBuilder"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_StringBuilder_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "StringBuilder")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_StringBuilder_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "Sbuffer :chunks Ichunk_count Ichunk_slots Ichunk_threshold Ichunk_encoding :chunk_bytes :chunk_chars ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_StringBuilder_get_vtable(interp);
+        vt->base_type      = enum_class_StringBuilder;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "StringBuilder");
+        vt->provides_str = CONST_STRING_GEN(interp, "string");
+        vt->isa_hash     = Parrot_StringBuilder_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_StringBuilder_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_StringBuilder;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_StringBuilder_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "append_format");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_StringBuilder_nci_append_format),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "get_string_length");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_StringBuilder_nci_get_string_length),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "chunked");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_StringBuilder_nci_chunked),
+                method_name, signature);
+        }
+        {
+        }
+    } /* pass */
+} /* Parrot_StringBuilder_class_init */
+
+#line 599 "./src/pmc/stringbuilder.pmc"
+
+
+
+/*
+
+=head2 Helper functions.
+
+=over 4
+
+=cut
+
+*/
+
+/*
+
+=item C<static const STR_VTABLE * chunk_encoding(PARROT_INTERP, PMC *self, const
+STRING *s)>
+
+Returns the encoding of the chunks of C<self> followed by C<s>, or NULL if
+the bytes of C<s> can't be appended to them as they are.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static const STR_VTABLE *
+chunk_encoding(PARROT_INTERP, ARGIN(PMC *self), ARGIN(const STRING *s))
+{
+    ASSERT_ARGS(chunk_encoding)
+    Parrot_StringBuilder_attributes * const attrs = PARROT_STRINGBUILDER(self);
+    STRING chunks;
+
+    if (attrs->chunk_count == 0)
+        return s->encoding;
+
+    /* Describe the chunks with a temporary header, which is all
+       Parrot_str_rep_compatible looks at. */
+    chunks._bufstart = NULL;
+    chunks._buflen   = 0;
+    chunks.strstart  = NULL;
+    chunks.bufused   = attrs->chunk_bytes;
+    chunks.strlen    = attrs->chunk_chars;
+    chunks.hashval   = 0;
+    chunks.encoding  = Parrot_get_encoding(interp, attrs->chunk_encoding);
+
+    if (chunks.encoding == s->encoding)
+        return s->encoding;
+
+    return Parrot_str_rep_compatible(interp, &chunks, s);
+}
+
+/*
+
+=item C<static int append_chunk(PARROT_INTERP, PMC *self, STRING *s)>
+
+Appends C<s> to the chunks of C<self> by reference. Returns 0 without
+appending if its encoding is not compatible with the chunks.
+
+=cut
+
+*/
+
+static int
+append_chunk(PARROT_INTERP, ARGIN(PMC *self), ARGIN(STRING *s))
+{
+    ASSERT_ARGS(append_chunk)
+    Parrot_StringBuilder_attributes * const attrs = PARROT_STRINGBUILDER(self);
+    const STR_VTABLE * const enc = chunk_encoding(interp, self, s);
+
+    if (!enc)
+        return 0;
+
+    if (attrs->chunk_count == attrs->chunk_slots) {
+        attrs->chunk_slots = attrs->chunk_slots
+                           ? attrs->chunk_slots * 2
+                           : INITIAL_CHUNK_SLOTS;
+        attrs->chunks      = mem_gc_realloc_n_typed(interp, attrs->chunks,
+                                attrs->chunk_slots, STRING *);
+    }
+
+    attrs->chunks[attrs->chunk_count++] = s;
+    attrs->chunk_encoding               = enc->num;
+    attrs->chunk_bytes                 += s->bufused;
+    attrs->chunk_chars                 += s->strlen;
+
+    return 1;
+}
+
+/*
+
+=item C<static int seal_buffer(PARROT_INTERP, PMC *self)>
+
+Appends a copy of the content of the buffer of C<self> to the chunks, so
+that a chunk can follow it, and empties the buffer, keeping its storage.
+Returns 0 if the buffer can't be appended to the chunks.
+
+=cut
+
+*/
+
+static int
+seal_buffer(PARROT_INTERP, ARGIN(PMC *self))
+{
+    ASSERT_ARGS(seal_buffer)
+    STRING *buffer;
+
+    GETATTR_StringBuilder_buffer(interp, self, buffer);
+
+    if (buffer->bufused == 0)
+        return 1;
+
+    if (!append_chunk(interp, self, Parrot_str_clone(interp, buffer)))
+        return 0;
+
+    buffer->bufused = 0;
+    buffer->strlen  = 0;
+
+    return 1;
+}
+
+/*
+
+=item C<static STRING * materialize(PARROT_INTERP, PMC *self)>
+
+Joins the chunks and the buffer of C<self> into a new string allocated with
+the exact size needed, which then replaces the chunks, and returns it.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+static STRING *
+materialize(PARROT_INTERP, ARGIN(PMC *self))
+{
+    ASSERT_ARGS(materialize)
+    Parrot_StringBuilder_attributes * const attrs = PARROT_STRINGBUILDER(self);
+    STRING * const    buffer = attrs->buffer;
+    const STR_VTABLE *enc    = buffer->bufused
+                             ? chunk_encoding(interp, self, buffer)
+                             : Parrot_get_encoding(interp, attrs->chunk_encoding);
+    const UINTVAL     tail   = enc ? buffer->bufused : 0;
+    STRING           *result;
+    char             *dest;
+    INTVAL            i;
+
+    result = Parrot_str_new_init(interp, NULL, attrs->chunk_bytes + tail,
+                enc ? enc : Parrot_get_encoding(interp, attrs->chunk_encoding),
+                0);
+
+    /* Allocation may have moved the buffers, so read them only now */
+    dest = result->strstart;
+    for (i = 0; i < attrs->chunk_count; ++i) {
+        const STRING * const chunk = attrs->chunks[i];
+        memcpy(dest, chunk->strstart, chunk->bufused);
+        dest += chunk->bufused;
+    }
+
+    memcpy(dest, buffer->strstart, tail);
+    result->bufused = attrs->chunk_bytes + tail;
+    result->strlen  = attrs->chunk_chars + (tail ? buffer->strlen : 0);
+
+    /* The buffer needs converting to another encoding */
+    if (buffer->bufused && !tail)
+        result = Parrot_str_concat(interp, result, buffer);
+
+    attrs->chunks[0]      = result;
+    attrs->chunk_count    = 1;
+    attrs->chunk_encoding = result->encoding->num;
+    attrs->chunk_bytes    = result->bufused;
+    attrs->chunk_chars    = result->strlen;
+    buffer->bufused       = 0;
+    buffer->strlen        = 0;
+
+    return result;
+}
+
+/*
+
+=item C<static size_t calculate_capacity(PARROT_INTERP, size_t needed)>
+
+Calculate capacity for string. We allocate double the amount needed.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CONST_FUNCTION
+static size_t
+calculate_capacity(SHIM_INTERP, size_t needed)
+{
+    ASSERT_ARGS(calculate_capacity)
+
+    needed *= 2;
+    /* round up to 16 */
+    needed  = (needed + 15) & ~15;
+
+    return needed;
+}
+
+/*
+
+=item C<static void convert_encoding(PARROT_INTERP, STR_VTABLE *dest_encoding,
+STRING *buffer, size_t size_to_add)>
+
+Convert buffer content to the encoding specified and increase its size,
+reallocating it if needed.
+
+=back
+
+=cut
+
+*/
+
+static void
+convert_encoding(PARROT_INTERP, ARGIN(STR_VTABLE *dest_encoding),
+        ARGMOD(STRING *buffer), size_t size_to_add)
+{
+    ASSERT_ARGS(convert_encoding)
+    STRING * new_buffer;
+    size_t total_size;
+
+    new_buffer = dest_encoding->to_encoding(interp, buffer);
+    total_size = new_buffer->bufused + size_to_add;
+
+    if (total_size > buffer->_buflen) {
+        /* Reallocate */
+        total_size = calculate_capacity(interp, total_size);
+        Parrot_gc_reallocate_string_storage(interp, buffer, total_size);
+    }
+    buffer->bufused  = new_buffer->bufused;
+    buffer->encoding = new_buffer->encoding;
+
+    memcpy(buffer->strstart, new_buffer->strstart,
+            new_buffer->bufused);
+}
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -0,0 +1,505 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/stringiterator.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_stringiterator.h"
+#include "pmc_iterator.h"
+#include "pmc_default.h"
+#include "stringiterator.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/stringiterator.pmc"
+/*
+Copyright (C) 2001-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/stringiterator.pmc - StringIterator PMC
+
+=head1 DESCRIPTION
+
+Implementation of Iterator for String PMC to treat a string as array as in C
+but honoring the encoding.
+
+=head1 SYNOPSIS
+
+
+=head1 Methods
+
+=over 4
+
+=cut
+
+*/
+
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+#line 51 "./src/pmc/stringiterator.c"
+static  PMC*  Parrot_StringIterator_clone(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_StringIterator_elements(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_StringIterator_get_bool(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_StringIterator_get_integer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_StringIterator_get_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL idx);
+static  PMC  * Parrot_StringIterator_get_pmc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING  * Parrot_StringIterator_get_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL idx);
+static  void  Parrot_StringIterator_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *string);
+static  void  Parrot_StringIterator_mark(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_StringIterator_pop_integer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC  * Parrot_StringIterator_pop_pmc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING  * Parrot_StringIterator_pop_string(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_StringIterator_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  INTVAL  Parrot_StringIterator_shift_integer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC  * Parrot_StringIterator_shift_pmc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING  * Parrot_StringIterator_shift_string(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_StringIterator_class_init(PARROT_INTERP, int, int);
+void    Parrot_StringIterator_ro_class_init(PARROT_INTERP, int, int);
+static  PMC* 
+Parrot_StringIterator_clone(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 78 "./src/pmc/stringiterator.pmc"
+
+    String_iter * const iter    = &PARROT_STRINGITERATOR(_self)->iter;
+    PMC         * const str_pmc = Parrot_pmc_new(interp, enum_class_String);
+    PMC         *clone;
+    String_iter *clone_iter;
+    STRING      *str_val;
+    INTVAL       reverse;
+
+    GETATTR_StringIterator_str_val(interp, _self, str_val);
+    VTABLE_set_string_native(interp, str_pmc, str_val);
+    clone = Parrot_pmc_new_init(interp, enum_class_StringIterator, str_pmc);
+    clone_iter = &PARROT_STRINGITERATOR(clone)->iter;
+    *clone_iter = *iter;
+    GETATTR_StringIterator_reverse(interp, _self, reverse);
+    SETATTR_StringIterator_reverse(interp, clone, reverse);
+
+    return clone;
+#line 91 "./src/pmc/stringiterator.c"
+}
+static  INTVAL 
+Parrot_StringIterator_elements(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 121 "./src/pmc/stringiterator.pmc"
+
+    String_iter * const iter = &PARROT_STRINGITERATOR(_self)->iter;
+    STRING *str_val;
+    INTVAL  reverse;
+
+    GETATTR_StringIterator_str_val(interp, _self, str_val);
+    GETATTR_StringIterator_reverse(interp, _self, reverse);
+
+    if (reverse)
+        return iter->charpos;
+    else
+        return str_val->strlen - iter->charpos;
+#line 109 "./src/pmc/stringiterator.c"
+}
+static  INTVAL 
+Parrot_StringIterator_get_bool(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 107 "./src/pmc/stringiterator.pmc"
+
+    return VTABLE_elements(interp, _self) > 0;
+#line 117 "./src/pmc/stringiterator.c"
+}
+static  INTVAL 
+Parrot_StringIterator_get_integer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 135 "./src/pmc/stringiterator.pmc"
+
+    return VTABLE_elements(interp, _self);
+#line 125 "./src/pmc/stringiterator.c"
+}
+static  INTVAL 
+Parrot_StringIterator_get_integer_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL idx)
+{
+#line 352 "./src/pmc/stringiterator.pmc"
+
+    String_iter * const iter = &PARROT_STRINGITERATOR(_self)->iter;
+    STRING *str_val;
+    const UINTVAL offset = iter->charpos + idx;
+
+    GETATTR_StringIterator_str_val(interp, _self, str_val);
+    if (offset >= str_val->strlen)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_OUT_OF_BOUNDS,
+            "StopIteration");
+
+    return STRING_iter_get(interp, str_val, iter, idx);
+#line 142 "./src/pmc/stringiterator.c"
+}
+static  PMC  *
+Parrot_StringIterator_get_pmc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 182 "./src/pmc/stringiterator.pmc"
+
+    PMC * const string = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(
+        interp, enum_class_String));
+    STRING *str_val;
+
+    GETATTR_StringIterator_str_val(interp, _self, str_val);
+    VTABLE_set_string_native(interp, string, str_val);
+    return string;
+#line 156 "./src/pmc/stringiterator.c"
+}
+static  STRING  *
+Parrot_StringIterator_get_string_keyed_int(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL idx)
+{
+#line 375 "./src/pmc/stringiterator.pmc"
+
+    String_iter iter = PARROT_STRINGITERATOR(_self)->iter;
+    String_iter next_iter;
+    STRING *str_val;
+    const UINTVAL offset = iter.charpos + idx;
+
+    GETATTR_StringIterator_str_val(interp, _self, str_val);
+    if (offset >= str_val->strlen)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_OUT_OF_BOUNDS,
+            "StopIteration");
+
+    if (idx != 0)
+        STRING_iter_skip(interp, str_val, &iter, idx);
+    next_iter = iter;
+    STRING_iter_skip(interp, str_val, &next_iter, 1);
+
+    return Parrot_str_iter_substr(interp, str_val, &iter, &next_iter);
+#line 179 "./src/pmc/stringiterator.c"
+}
+static  void 
+Parrot_StringIterator_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *string)
+{
+#line 43 "./src/pmc/stringiterator.pmc"
+
+    String_iter * const iter    = &PARROT_STRINGITERATOR(_self)->iter;
+    STRING      * const str_val = VTABLE_get_string(interp, string);
+
+    SETATTR_StringIterator_str_val(interp, _self, str_val);
+    STRING_ITER_INIT(interp, iter);
+    SETATTR_StringIterator_reverse(interp, _self, ITERATE_FROM_START);
+
+    PObj_custom_mark_SET(_self);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 195 "./src/pmc/stringiterator.c"
+}
+static  void 
+Parrot_StringIterator_mark(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 64 "./src/pmc/stringiterator.pmc"
+
+    STRING *str_val;
+
+    GETATTR_StringIterator_str_val(interp, _self, str_val);
+    Parrot_gc_mark_STRING_alive(interp, str_val);
+#line 206 "./src/pmc/stringiterator.c"
+}
+static  INTVAL 
+Parrot_StringIterator_pop_integer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 327 "./src/pmc/stringiterator.pmc"
+
+    String_iter * const iter = &PARROT_STRINGITERATOR(_self)->iter;
+    STRING *str_val;
+
+    GETATTR_StringIterator_str_val(interp, _self, str_val);
+    /* Shouldn't this test be (iter->charpos <= 0) ? */
+    if (VTABLE_elements(interp, _self) <= 0)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_OUT_OF_BOUNDS,
+            "StopIteration");
+
+    STRING_iter_skip(interp, str_val, iter, -1);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+    return STRING_iter_get(interp, str_val, iter, 0);
+#line 225 "./src/pmc/stringiterator.c"
+}
+static  PMC  *
+Parrot_StringIterator_pop_pmc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 274 "./src/pmc/stringiterator.pmc"
+
+    String_iter * const iter = &PARROT_STRINGITERATOR(_self)->iter;
+    STRING *str_val, *substr;
+    PMC *ret;
+    const String_iter old_iter = *iter;
+
+    GETATTR_StringIterator_str_val(interp, _self, str_val);
+    /* Shouldn't this test be (iter->charpos <= 0) ? */
+    if (VTABLE_elements(interp, _self) <= 0)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_OUT_OF_BOUNDS,
+            "StopIteration");
+
+    ret = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_String));
+    STRING_iter_skip(interp, str_val, iter, -1);
+    substr = Parrot_str_iter_substr(interp, str_val, iter, &old_iter);
+    VTABLE_set_string_native(interp, ret, substr);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+    return ret;
+#line 249 "./src/pmc/stringiterator.c"
+}
+static  STRING  *
+Parrot_StringIterator_pop_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 302 "./src/pmc/stringiterator.pmc"
+
+    String_iter * const iter = &PARROT_STRINGITERATOR(_self)->iter;
+    STRING *str_val;
+    const String_iter old_iter = *iter;
+
+    GETATTR_StringIterator_str_val(interp, _self, str_val);
+    /* Shouldn't this test be (iter->charpos <= 0) ? */
+    if (VTABLE_elements(interp, _self) <= 0)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_OUT_OF_BOUNDS,
+            "StopIteration");
+
+    STRING_iter_skip(interp, str_val, iter, -1);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+    return Parrot_str_iter_substr(interp, str_val, iter, &old_iter);
+#line 269 "./src/pmc/stringiterator.c"
+}
+static  void 
+Parrot_StringIterator_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+#line 152 "./src/pmc/stringiterator.pmc"
+
+    STRING *str_val;
+    String_iter * const iter = &PARROT_STRINGITERATOR(_self)->iter;
+
+    GETATTR_StringIterator_str_val(interp, _self, str_val);
+    if (value == ITERATE_FROM_START) {
+        SETATTR_StringIterator_reverse(interp, _self, 0);
+        STRING_ITER_INIT(interp, iter);
+    }
+    else if (value == ITERATE_FROM_END) {
+        SETATTR_StringIterator_reverse(interp, _self, 1);
+        iter->bytepos = str_val->bufused;
+        iter->charpos = str_val->strlen;
+    }
+    else {
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+                "Wrong direction for StringIterator");
+    }
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 294 "./src/pmc/stringiterator.c"
+}
+static  INTVAL 
+Parrot_StringIterator_shift_integer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 252 "./src/pmc/stringiterator.pmc"
+
+    String_iter * const iter = &PARROT_STRINGITERATOR(_self)->iter;
+    STRING *str_val;
+
+    GETATTR_StringIterator_str_val(interp, _self, str_val);
+    if (iter->charpos >= str_val->strlen)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_OUT_OF_BOUNDS,
+            "StopIteration");
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+    return STRING_iter_get_and_advance(interp, str_val, iter);
+#line 311 "./src/pmc/stringiterator.c"
+}
+static  PMC  *
+Parrot_StringIterator_shift_pmc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 201 "./src/pmc/stringiterator.pmc"
+
+    String_iter * const iter = &PARROT_STRINGITERATOR(_self)->iter;
+    PMC *ret;
+    STRING *str_val, *substr;
+    const String_iter old_iter = *iter;
+
+    GETATTR_StringIterator_str_val(interp, _self, str_val);
+    if (iter->charpos >= str_val->strlen)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_OUT_OF_BOUNDS,
+            "StopIteration");
+
+    ret = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_String));
+    STRING_iter_skip(interp, str_val, iter, 1);
+    substr = Parrot_str_iter_substr(interp, str_val, &old_iter, iter);
+    VTABLE_set_string_native(interp, ret, substr);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+    return ret;
+#line 334 "./src/pmc/stringiterator.c"
+}
+static  STRING  *
+Parrot_StringIterator_shift_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 228 "./src/pmc/stringiterator.pmc"
+
+    String_iter * const iter = &PARROT_STRINGITERATOR(_self)->iter;
+    STRING *str_val;
+    const String_iter old_iter = *iter;
+
+    GETATTR_StringIterator_str_val(interp, _self, str_val);
+    if (iter->charpos >= str_val->strlen)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_OUT_OF_BOUNDS,
+            "StopIteration");
+
+    STRING_iter_skip(interp, str_val, iter, 1);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+    return Parrot_str_iter_substr(interp, str_val, &old_iter, iter);
+#line 353 "./src/pmc/stringiterator.c"
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_StringIterator_update_vtable(VTABLE *vt) {
+    vt->clone = Parrot_StringIterator_clone;
+    vt->elements = Parrot_StringIterator_elements;
+    vt->get_bool = Parrot_StringIterator_get_bool;
+    vt->get_integer = Parrot_StringIterator_get_integer;
+    vt->get_integer_keyed_int = Parrot_StringIterator_get_integer_keyed_int;
+    vt->get_pmc = Parrot_StringIterator_get_pmc;
+    vt->get_string_keyed_int = Parrot_StringIterator_get_string_keyed_int;
+    vt->init_pmc = Parrot_StringIterator_init_pmc;
+    vt->mark = Parrot_StringIterator_mark;
+    vt->pop_integer = Parrot_StringIterator_pop_integer;
+    vt->pop_pmc = Parrot_StringIterator_pop_pmc;
+    vt->pop_string = Parrot_StringIterator_pop_string;
+    vt->set_integer_native = Parrot_StringIterator_set_integer_native;
+    vt->shift_integer = Parrot_StringIterator_shift_integer;
+    vt->shift_pmc = Parrot_StringIterator_shift_pmc;
+    vt->shift_string = Parrot_StringIterator_shift_string;
+    vt->attr_size = sizeof(Parrot_StringIterator_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_StringIterator_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->clone = Parrot_StringIterator_clone;
+    vt->elements = Parrot_StringIterator_elements;
+    vt->get_bool = Parrot_StringIterator_get_bool;
+    vt->get_integer = Parrot_StringIterator_get_integer;
+    vt->get_integer_keyed_int = Parrot_StringIterator_get_integer_keyed_int;
+    vt->get_pmc = Parrot_StringIterator_get_pmc;
+    vt->get_string_keyed_int = Parrot_StringIterator_get_string_keyed_int;
+    vt->mark = Parrot_StringIterator_mark;
+    vt->attr_size = sizeof(Parrot_StringIterator_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_StringIterator_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_Iterator_get_vtable(interp);
+    Parrot_StringIterator_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_StringIterator_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_Iterator_ro_get_vtable(interp);
+    Parrot_StringIterator_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_StringIterator_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+    mro = Parrot_Iterator_get_mro(interp, mro);
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "StringIterator"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_StringIterator_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    isa = Parrot_Iterator_get_isa(interp, isa);
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "StringIterator")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_StringIterator_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "Sstr_val :iter Ireverse ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_StringIterator_get_vtable(interp);
+        vt->base_type      = enum_class_StringIterator;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "StringIterator");
+        vt->provides_str = CONST_STRING_GEN(interp, "iterator");
+        vt->isa_hash     = Parrot_StringIterator_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_StringIterator_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_StringIterator;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_StringIterator_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+        }
+    } /* pass */
+} /* Parrot_StringIterator_class_init */
+
+#line 392 "./src/pmc/stringiterator.pmc"
+
+
+
+/*
+
+=back
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
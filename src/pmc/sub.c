@@ -0,0 +1,1741 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/sub.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_fixedintegerarray.h"
+#include "pmc_sub.h"
+#include "pmc_default.h"
+#include "sub.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/sub.pmc"
+/*
+Copyright (C) 2001-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/sub.pmc - Sub PMC
+
+=head1 DESCRIPTION
+
+These are the vtable functions for the Sub (subroutine) base class
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "parrot/oplib/ops.h"
+#include "parrot/oplib/core_ops.h"
+#include "sub.str"
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+static void print_sub_name(PARROT_INTERP, ARGIN_NULLOK(PMC *sub))
+        __attribute__nonnull__(1);
+
+#define ASSERT_ARGS_print_sub_name __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+/*
+
+=item C<static void print_sub_name(PARROT_INTERP, PMC *sub)>
+
+static function to print the name of the sub (for tracing/debugging)
+
+=cut
+
+*/
+
+static void
+print_sub_name(PARROT_INTERP, ARGIN_NULLOK(PMC *sub))
+{
+    ASSERT_ARGS(print_sub_name)
+    Interp * const tracer = (interp->pdb && interp->pdb->debugger)
+                          ? interp->pdb->debugger
+                          : interp;
+
+    /* sub was located via globals */
+    Parrot_io_eprintf(tracer, "# Calling sub '%Ss'\n# ",
+        Parrot_sub_full_sub_name(interp, sub));
+
+    print_pbc_location(interp);
+}
+#line 83 "./src/pmc/sub.c"
+static  void  Parrot_Sub_assign_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *other);
+static  PMC  * Parrot_Sub_clone(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_Sub_defined(SHIM_INTERP, SHIM(PMC *_self));
+static  void  Parrot_Sub_destroy(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Sub_freeze(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+static  INTVAL  Parrot_Sub_get_bool(SHIM_INTERP, SHIM(PMC *_self));
+static  INTVAL  Parrot_Sub_get_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key));
+static  void  * Parrot_Sub_get_pointer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  STRING  * Parrot_Sub_get_string(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Sub_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Sub_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *init);
+static  PMC  * Parrot_Sub_inspect(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC  * Parrot_Sub_inspect_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *what);
+static  opcode_t  * Parrot_Sub_invoke(PARROT_INTERP, ARGMOD(PMC *_self), void *next);
+static  INTVAL Parrot_Sub_is_equal(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void  Parrot_Sub_mark(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Sub_set_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *other);
+static  void  Parrot_Sub_set_pointer(PARROT_INTERP, ARGMOD(PMC *_self), void *value);
+static  void  Parrot_Sub_set_string_native(PARROT_INTERP, ARGMOD(PMC *_self), STRING *subname);
+static  void  Parrot_Sub_thaw(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+static  void  Parrot_Sub_visit(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+static  INTVAL  Parrot_Sub_multi_is_equal_PMC(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void Parrot_Sub_nci_start_offs(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Sub_nci_end_offs(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Sub_nci_get_namespace(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Sub_nci___get_regs_used(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Sub_nci_get_lexinfo(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Sub_nci_get_subid(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Sub_nci_get_outer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Sub_nci_set_outer(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Sub_nci_set_outer_ctx(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Sub_nci_get_multisig(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Sub_nci_arity(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Sub_nci_comp_flags(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Sub_nci_pf_flags(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Sub_nci_get_packfile(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Sub_multi_is_equal_PMC_pcc(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_Sub_class_init(PARROT_INTERP, int, int);
+void    Parrot_Sub_ro_class_init(PARROT_INTERP, int, int);
+static  void 
+Parrot_Sub_assign_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *other)
+{
+#line 578 "./src/pmc/sub.pmc"
+
+    /* only handle the case where the other PMC is the same type */
+    if (other->vtable->base_type == _self->vtable->base_type) {
+        Parrot_Sub_attributes *my_sub;
+        Parrot_Sub_attributes *other_sub;
+
+        PMC_get_sub(interp, _self, my_sub);
+        PMC_get_sub(interp, other, other_sub);
+
+        /* copy the sub struct */
+        memmove(my_sub, other_sub, sizeof (Parrot_Sub_attributes));
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+    }
+    else
+        Parrot_ex_throw_from_c_args(interp, NULL,
+            EXCEPTION_INVALID_OPERATION,
+            "Can't assign a non-Sub type to a Sub");
+#line 144 "./src/pmc/sub.c"
+}
+static  PMC  *
+Parrot_Sub_clone(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 541 "./src/pmc/sub.pmc"
+
+    PMC * const ret = Parrot_pmc_new(interp, _self->vtable->base_type);
+
+    Parrot_Sub_attributes *dest_sub;
+    Parrot_Sub_attributes *sub;
+
+    /* XXX Why? */
+    /* we have to mark it ourselves */
+    PObj_custom_mark_destroy_SETALL(ret);
+
+    PMC_get_sub(interp, _self, dest_sub);
+    PMC_get_sub(interp, ret, sub);
+
+    /* first set the sub struct, Parrot_str_copy may cause GC */
+    *sub = *dest_sub;
+
+    /* Be sure not to share arg_info. */
+    dest_sub->arg_info = NULL;
+
+    return ret;
+#line 170 "./src/pmc/sub.c"
+}
+static  INTVAL 
+Parrot_Sub_defined(SHIM_INTERP, SHIM(PMC *_self))
+{
+#line 358 "./src/pmc/sub.pmc"
+    return 1;
+#line 177 "./src/pmc/sub.c"
+}
+static  void 
+Parrot_Sub_destroy(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 254 "./src/pmc/sub.pmc"
+
+    Parrot_Sub_attributes * const sub = PARROT_SUB(_self);
+
+    if (sub && sub->arg_info)
+        mem_gc_free(interp, sub->arg_info);
+#line 188 "./src/pmc/sub.c"
+}
+static  void 
+Parrot_Sub_freeze(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 691 "./src/pmc/sub.pmc"
+
+    Parrot_Sub_attributes *sub;
+    STRING                *hll_name;
+    int i;
+
+    interp->vtables[enum_class_default]->freeze(interp, _self, info);
+    PMC_get_sub(interp, _self, sub);
+    /*
+     * we currently need to write these items:
+     * - start offset in byte-code segment
+     * - end   offset in byte-code segment
+     * - segment TODO ???
+     * - flags  (i.e. :load pragma and such)
+     * - name of the sub's label
+     * - method name
+     * - ns entry name
+     * - namespace
+     * - HLL_id
+     * - multi_signature
+     * - n_regs_used[i]
+     * - lex_info
+     * - vtable_index
+     * - subid
+     */
+
+    VTABLE_push_integer(interp, info, (INTVAL) sub->start_offs);
+    VTABLE_push_integer(interp, info, (INTVAL) sub->end_offs);
+    VTABLE_push_integer(interp, info,
+        (INTVAL)(PObj_get_FLAGS(_self) & SUB_FLAG_PF_MASK));
+
+    VTABLE_push_string(interp, info, sub->name);
+
+    if (!sub->method_name)
+        sub->method_name = CONST_STRING(interp, "");
+    VTABLE_push_string(interp, info, sub->method_name);
+
+    if (!sub->ns_entry_name)
+        sub->ns_entry_name = CONST_STRING(interp, "");
+    VTABLE_push_string(interp, info, sub->ns_entry_name);
+
+    hll_name = Parrot_hll_get_HLL_name(interp, sub->HLL_id);
+    if (!hll_name)
+        hll_name = CONST_STRING(interp, "");
+    VTABLE_push_string(interp, info, hll_name);
+
+    VTABLE_push_integer(interp, info, (INTVAL)sub->comp_flags);
+    VTABLE_push_integer(interp, info, sub->vtable_index);
+
+    for (i = 0; i < 4; ++i)
+        VTABLE_push_integer(interp, info, sub->n_regs_used[i]);
+
+    if (!sub->subid)
+        sub->subid = CONST_STRING(interp, "");
+
+    VTABLE_push_string(interp, info, sub->subid);
+#line 249 "./src/pmc/sub.c"
+}
+static  INTVAL 
+Parrot_Sub_get_bool(SHIM_INTERP, SHIM(PMC *_self))
+{
+#line 364 "./src/pmc/sub.pmc"
+    return 1;
+#line 256 "./src/pmc/sub.c"
+}
+static  INTVAL 
+Parrot_Sub_get_integer_keyed(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(PMC *key))
+{
+#line 337 "./src/pmc/sub.pmc"
+    Parrot_Sub_attributes *sub;
+    PMC_get_sub(interp, _self, sub);
+
+    return (INTVAL) (sub->seg->base.data);
+#line 266 "./src/pmc/sub.c"
+}
+static  void  *
+Parrot_Sub_get_pointer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 318 "./src/pmc/sub.pmc"
+
+    Parrot_Sub_attributes *sub;
+    PMC_get_sub(interp, _self, sub);
+    return sub->seg->base.data + sub->start_offs;
+#line 276 "./src/pmc/sub.c"
+}
+static  STRING  *
+Parrot_Sub_get_string(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 276 "./src/pmc/sub.pmc"
+
+    STRING *name;
+    GETATTR_Sub_name(interp, _self, name);
+    return name;
+#line 286 "./src/pmc/sub.c"
+}
+static  void 
+Parrot_Sub_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 112 "./src/pmc/sub.pmc"
+
+    Parrot_Sub_attributes * const attrs =
+        PMC_data_typed(_self, Parrot_Sub_attributes *);
+
+    attrs->seg             = interp->code;
+    attrs->outer_sub       = PMCNULL;
+    attrs->multi_signature = PMCNULL;
+    attrs->namespace_name  = PMCNULL;
+    attrs->vtable_index    = -1;
+
+    PObj_custom_mark_destroy_SETALL(_self);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 304 "./src/pmc/sub.c"
+}
+static  void 
+Parrot_Sub_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *init)
+{
+#line 137 "./src/pmc/sub.pmc"
+
+    Parrot_Sub_attributes * const attrs =
+        PMC_data_typed(_self, Parrot_Sub_attributes *);
+    STRING *field = CONST_STRING(interp, "start_offs");
+
+    if (VTABLE_exists_keyed_str(interp, init, field))
+        attrs->start_offs = VTABLE_get_integer_keyed_str(interp, init, field);
+
+    field = CONST_STRING(interp, "end_offs");
+    if (VTABLE_exists_keyed_str(interp, init, field))
+        attrs->end_offs = VTABLE_get_integer_keyed_str(interp, init, field);
+
+    field = CONST_STRING(interp, "HLL_id");
+    if (VTABLE_exists_keyed_str(interp, init, field))
+        attrs->HLL_id = VTABLE_get_integer_keyed_str(interp, init, field);
+
+    field = CONST_STRING(interp, "namespace_name");
+    if (VTABLE_exists_keyed_str(interp, init, field))
+        attrs->namespace_name = VTABLE_get_pmc_keyed_str(interp, init, field);
+
+    field = CONST_STRING(interp, "namespace_stash");
+    if (VTABLE_exists_keyed_str(interp, init, field))
+        attrs->namespace_stash = VTABLE_get_pmc_keyed_str(interp, init, field);
+
+    field = CONST_STRING(interp, "name");
+    if (VTABLE_exists_keyed_str(interp, init, field))
+        attrs->name = VTABLE_get_string_keyed_str(interp, init, field);
+
+    field = CONST_STRING(interp, "method_name");
+    if (VTABLE_exists_keyed_str(interp, init, field))
+        attrs->method_name = VTABLE_get_string_keyed_str(interp, init, field);
+
+    field = CONST_STRING(interp, "ns_entry_name");
+    if (VTABLE_exists_keyed_str(interp, init, field))
+        attrs->ns_entry_name = VTABLE_get_string_keyed_str(interp, init, field);
+
+    field = CONST_STRING(interp, "subid");
+    if (VTABLE_exists_keyed_str(interp, init, field))
+        attrs->subid = VTABLE_get_string_keyed_str(interp, init, field);
+
+    field = CONST_STRING(interp, "vtable_index");
+    if (VTABLE_exists_keyed_str(interp, init, field))
+        attrs->vtable_index = VTABLE_get_integer_keyed_str(interp, init, field);
+    else
+        attrs->vtable_index = -1;
+
+    field = CONST_STRING(interp, "multi_signature");
+    if (VTABLE_exists_keyed_str(interp, init, field))
+        attrs->multi_signature = VTABLE_get_pmc_keyed_str(interp, init, field);
+
+    field = CONST_STRING(interp, "lex_info");
+    if (VTABLE_exists_keyed_str(interp, init, field))
+        attrs->lex_info = VTABLE_get_pmc_keyed_str(interp, init, field);
+
+    field = CONST_STRING(interp, "outer_sub");
+    if (VTABLE_exists_keyed_str(interp, init, field))
+        attrs->outer_sub = VTABLE_get_pmc_keyed_str(interp, init, field);
+
+    /* comp_flags is actually UINTVAL */
+    field = CONST_STRING(interp, "comp_flags");
+    if (VTABLE_exists_keyed_str(interp, init, field)) {
+        const UINTVAL flags = (UINTVAL)VTABLE_get_integer_keyed_str(interp, init, field);
+        /* Mask comp flags only */
+        attrs->comp_flags = flags & SUB_COMP_FLAG_MASK;
+    }
+
+    /* In order to create Sub dynamicaly we have to set PObj flags */
+    field = CONST_STRING(interp, "pf_flags");
+    if (VTABLE_exists_keyed_str(interp, init, field)) {
+        const UINTVAL flags = (UINTVAL)VTABLE_get_integer_keyed_str(interp, init, field);
+        /* Mask Sub specific flags only */
+        PObj_get_FLAGS(_self) |= flags & SUB_FLAG_PF_MASK;
+    }
+
+    field = CONST_STRING(interp, "n_regs_used");
+    if (VTABLE_exists_keyed_str(interp, init, field)) {
+        PMC * const tmp = VTABLE_get_pmc_keyed_str(interp, init, field);
+        INTVAL i;
+        for (i = 0; i < 4; ++i)
+            attrs->n_regs_used[i] = VTABLE_get_integer_keyed_int(interp, tmp, i);
+    }
+
+    field = CONST_STRING(interp, "arg_info");
+    if (VTABLE_exists_keyed_str(interp, init, field)) {
+        PMC * const tmp = VTABLE_get_pmc_keyed_str(interp, init, field);
+        /* Allocate structure to store argument information in. */
+        attrs->arg_info = mem_gc_allocate_zeroed_typed(interp,
+                Parrot_sub_arginfo);
+        /*
+        Hash.get_integer_keyed_str return 0 if key doesn't exists.
+        So, don't check existence of key, just use it.
+        NB: Don't split line. CONST_STRING b0rked.
+        */
+        attrs->arg_info->pos_required = VTABLE_get_integer_keyed_str(interp, tmp, CONST_STRING(interp, "pos_required"));
+        attrs->arg_info->pos_optional = VTABLE_get_integer_keyed_str(interp, tmp, CONST_STRING(interp, "pos_optional"));
+        attrs->arg_info->pos_slurpy = VTABLE_get_integer_keyed_str(interp, tmp, CONST_STRING(interp, "pos_slurpy"));
+        attrs->arg_info->named_required = VTABLE_get_integer_keyed_str(interp, tmp, CONST_STRING(interp, "named_required"));
+        attrs->arg_info->named_optional = VTABLE_get_integer_keyed_str(interp, tmp, CONST_STRING(interp, "named_optional"));
+        attrs->arg_info->named_slurpy = VTABLE_get_integer_keyed_str(interp, tmp, CONST_STRING(interp, "named_slurpy"));
+    }
+
+    /* C<ctx> not handled here, and shouldn't be, because of run-time nature.  */
+
+    PObj_custom_mark_destroy_SETALL(_self);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 415 "./src/pmc/sub.c"
+}
+static  PMC  *
+Parrot_Sub_inspect(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 801 "./src/pmc/sub.pmc"
+
+    /* Create a hash, then use inspect_str to get all of its data */
+
+    PMC    * const metadata           = Parrot_pmc_new(interp, enum_class_Hash);
+    STRING * const pos_required_str   = CONST_STRING(interp, "pos_required");
+    STRING * const pos_optional_str   = CONST_STRING(interp, "pos_optional");
+    STRING * const named_required_str = CONST_STRING(interp, "named_required");
+    STRING * const named_optional_str = CONST_STRING(interp, "named_optional");
+    STRING * const pos_slurpy_str     = CONST_STRING(interp, "pos_slurpy");
+    STRING * const named_slurpy_str   = CONST_STRING(interp, "named_slurpy");
+
+    VTABLE_set_pmc_keyed_str(interp, metadata, pos_required_str,
+        VTABLE_inspect_str(interp, _self, pos_required_str));
+
+    VTABLE_set_pmc_keyed_str(interp, metadata, pos_optional_str,
+        VTABLE_inspect_str(interp, _self, pos_optional_str));
+
+    VTABLE_set_pmc_keyed_str(interp, metadata, named_required_str,
+        VTABLE_inspect_str(interp, _self, named_required_str));
+
+    VTABLE_set_pmc_keyed_str(interp, metadata, named_optional_str,
+        VTABLE_inspect_str(interp, _self, named_optional_str));
+
+    VTABLE_set_pmc_keyed_str(interp, metadata, pos_slurpy_str,
+        VTABLE_inspect_str(interp, _self, pos_slurpy_str));
+
+    VTABLE_set_pmc_keyed_str(interp, metadata, named_slurpy_str,
+        VTABLE_inspect_str(interp, _self, named_slurpy_str));
+
+    return metadata;
+#line 451 "./src/pmc/sub.c"
+}
+static  PMC  *
+Parrot_Sub_inspect_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *what)
+{
+#line 873 "./src/pmc/sub.pmc"
+
+    Parrot_Sub_attributes *sub;
+    PMC                   *retval;
+    INTVAL                 count_found = -1;
+
+    PMC_get_sub(interp, _self, sub);
+
+    /* If the argument info hasn't been generated yet, generate it. */
+    if (!sub->arg_info) {
+        /* Get pointer into the bytecode where this sub starts. */
+        const opcode_t *pc = sub->seg->base.data + sub->start_offs;
+        op_lib_t *core_ops = PARROT_GET_CORE_OPLIB(interp);
+
+        /* Allocate structure to store argument information in. */
+        sub->arg_info = mem_gc_allocate_zeroed_typed(interp,
+                Parrot_sub_arginfo);
+
+        /* If the first instruction is a get_params... */
+        if (OPCODE_IS(interp, sub->seg, *pc, core_ops, PARROT_OP_get_params_pc)) {
+            /* Get the signature (the next thing in the bytecode). */
+            PMC * const sig = sub->seg->const_table->pmc.constants[*(++pc)];
+
+            /* Iterate over the signature and compute argument counts. */
+            const INTVAL sig_length = VTABLE_elements(interp, sig);
+            int     i;
+
+            ASSERT_SIG_PMC(sig);
+
+            for (i = 0; i < sig_length; ++i) {
+                int sig_item = VTABLE_get_integer_keyed_int(interp, sig, i);
+                if (PARROT_ARG_SLURPY_ARRAY_ISSET(sig_item)){
+                    if (PARROT_ARG_NAME_ISSET(sig_item))
+                        sub->arg_info->named_slurpy = 1;
+                    else
+                        sub->arg_info->pos_slurpy = 1;
+                }
+                else if (PARROT_ARG_NAME_ISSET(sig_item)) {
+                    ++i;
+                    sig_item = VTABLE_get_integer_keyed_int(interp, sig, i);
+                    if (PARROT_ARG_OPTIONAL_ISSET(sig_item))
+                        ++sub->arg_info->named_optional;
+                    else
+                        ++sub->arg_info->named_required;
+                }
+                else if (!PARROT_ARG_OPT_FLAG_ISSET(sig_item)) {
+                    if (PARROT_ARG_OPTIONAL_ISSET(sig_item))
+                        ++sub->arg_info->pos_optional;
+                    else
+                        ++sub->arg_info->pos_required;
+                }
+            }
+        }
+    }
+
+    /* Return the requested argument information */
+    if (STRING_equal(interp, what, CONST_STRING(interp, "pos_required"))) {
+        count_found = (INTVAL)sub->arg_info->pos_required;
+    }
+    else if (STRING_equal(interp, what, CONST_STRING(interp, "pos_optional"))) {
+        count_found = (INTVAL)sub->arg_info->pos_optional;
+    }
+    else if (STRING_equal(interp, what, CONST_STRING(interp, "pos_slurpy"))) {
+        count_found = (INTVAL)sub->arg_info->pos_slurpy;
+    }
+    else if (STRING_equal(interp, what, CONST_STRING(interp, "named_required"))) {
+        count_found = (INTVAL)sub->arg_info->named_required;
+    }
+    else if (STRING_equal(interp, what, CONST_STRING(interp, "named_optional"))) {
+        count_found = (INTVAL)sub->arg_info->named_optional;
+    }
+    else if (STRING_equal(interp, what, CONST_STRING(interp, "named_slurpy"))) {
+        count_found = (INTVAL)sub->arg_info->named_slurpy;
+    }
+    else
+        Parrot_ex_throw_from_c_args(interp, NULL,
+            EXCEPTION_INVALID_OPERATION,
+            "Unknown introspection value '%S'", what);
+
+    retval = Parrot_pmc_new_init_int(interp, enum_class_Integer, count_found);
+    return retval;
+#line 537 "./src/pmc/sub.c"
+}
+static  opcode_t  *
+Parrot_Sub_invoke(PARROT_INTERP, ARGMOD(PMC *_self), void *next)
+{
+#line 381 "./src/pmc/sub.pmc"
+
+    PMC * const caller_ctx = CURRENT_CONTEXT(interp);
+    PMC *ccont      = interp->current_cont;
+
+    /* plain subroutine call
+     * create new context, place it in interpreter */
+    PMC *context    = Parrot_pcc_get_signature(interp, caller_ctx);
+
+    Parrot_Sub_attributes *sub;
+    opcode_t              *pc;
+
+    PMC_get_sub(interp, _self, sub);
+#ifndef NDEBUG
+    if (Interp_trace_TEST(interp, PARROT_TRACE_SUB_CALL_FLAG))
+        print_sub_name(interp, _self);
+#endif
+    /*
+     * A remark WRT tail calls
+     *
+     * we have:
+     * sub A:
+     *    ...
+     *    B()
+     *    ...
+     * sub B:
+     *    ...
+     *    .return C(...)
+     *
+     * that is the sub B() returns whatever C() returns.
+     *
+     * We are just calling the sub C().
+     * If the private2 flag is set, this code is called by a
+     * tailcall opcode.
+     *
+     * We allocate a new register frame and recycle it
+     * immediately after argument passing.
+     *
+     */
+    pc                   = sub->seg->base.data + sub->start_offs;
+    interp->current_cont = NULL;
+
+    PARROT_ASSERT(!PMC_IS_NULL(ccont));
+
+    if (PMC_IS_NULL(context))
+        context = Parrot_pmc_new(interp, enum_class_CallContext);
+
+    Parrot_pcc_set_context(interp, context);
+    Parrot_pcc_set_caller_ctx(interp, context, caller_ctx);
+
+    /* support callcontext reuse */
+    if (context == caller_ctx)
+        Parrot_pcc_free_registers(interp, context);
+
+    Parrot_pcc_allocate_registers(interp, context, sub->n_regs_used);
+    Parrot_pcc_init_context(interp, context, caller_ctx);
+
+    Parrot_pcc_set_sub(interp, context, _self);
+    Parrot_pcc_set_continuation(interp, context, ccont);
+    Parrot_pcc_set_constants(interp, context, sub->seg->const_table);
+
+    /* check recursion/call depth */
+    if (Parrot_pcc_inc_recursion_depth(interp, context) > interp->recursion_limit)
+        Parrot_ex_throw_from_c_args(interp, next, EXCEPTION_INTERNAL_PANIC,
+                "maximum recursion depth exceeded");
+
+    /* and copy set context variables */
+    PARROT_GC_WRITE_BARRIER(interp, ccont);
+    PARROT_CONTINUATION(ccont)->from_ctx = context;
+
+    /* if this is an outer sub, then we need to set sub->ctx
+     * to the new context */
+    if (PObj_get_FLAGS(_self) & SUB_FLAG_IS_OUTER) {
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+        sub->ctx = context;
+    }
+
+    /* create pad if needed
+     * TODO move this up in front of argument passing
+     *      and factor out common code with coroutine pmc
+     */
+    if (!PMC_IS_NULL(sub->lex_info)) {
+        Parrot_pcc_set_lex_pad(interp, context, Parrot_pmc_new_init(interp,
+                Parrot_hll_get_ctx_HLL_type(interp, enum_class_LexPad),
+                sub->lex_info));
+        VTABLE_set_pointer(interp, Parrot_pcc_get_lex_pad(interp, context), context);
+    }
+
+    /* set outer context */
+    if (!PMC_IS_NULL(sub->outer_ctx)) {
+        PMC * outer_ctx = sub->outer_ctx;
+        if (outer_ctx->vtable->base_type == enum_class_Proxy)
+            outer_ctx = Parrot_pcc_unproxy_context(interp, outer_ctx);
+        Parrot_pcc_set_outer_ctx(interp, context, outer_ctx);
+    }
+    else {
+        /* autoclose */
+        PMC *c       = context;
+        PMC *outer_c = Parrot_pcc_get_outer_ctx(interp, c);
+
+        for (c = context;
+             PMC_IS_NULL(outer_c);
+             c = outer_c, outer_c = Parrot_pcc_get_outer_ctx(interp, c)) {
+
+            PMC *outer_pmc;
+            Parrot_Sub_attributes *current_sub, *outer_sub;
+
+            PMC_get_sub(interp, Parrot_pcc_get_sub(interp, c), current_sub);
+            outer_pmc   = current_sub->outer_sub;
+
+            if (PMC_IS_NULL(outer_pmc))
+                break;
+
+            PMC_get_sub(interp, outer_pmc, outer_sub);
+
+            if (PMC_IS_NULL(outer_sub->ctx)) {
+                PMC * const dummy = Parrot_alloc_context(interp,
+                                            outer_sub->n_regs_used, PMCNULL);
+                Parrot_pcc_set_sub(interp, dummy, outer_pmc);
+
+                if (!PMC_IS_NULL(outer_sub->lex_info)) {
+                    Parrot_pcc_set_lex_pad(interp, dummy,
+                        Parrot_pmc_new_init(interp,
+                            Parrot_hll_get_ctx_HLL_type(interp,
+                                enum_class_LexPad), outer_sub->lex_info));
+
+                    VTABLE_set_pointer(interp,
+                        Parrot_pcc_get_lex_pad(interp, dummy), dummy);
+                }
+
+                if (!PMC_IS_NULL(outer_sub->outer_ctx))
+                    Parrot_pcc_set_outer_ctx(interp, dummy,
+                        outer_sub->outer_ctx);
+
+                PARROT_GC_WRITE_BARRIER(interp, outer_pmc);
+                outer_sub->ctx = dummy;
+            }
+
+            Parrot_pcc_set_outer_ctx(interp, c, outer_sub->ctx);
+            outer_c = outer_sub->ctx;
+        }
+    }
+
+    /* switch code segment if needed */
+    if (interp->code != sub->seg)
+        Parrot_switch_to_cs(interp, sub->seg, 1);
+
+    return pc;
+#line 690 "./src/pmc/sub.c"
+}
+static  INTVAL
+Parrot_Sub_is_equal(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+    INTVAL type = VTABLE_type(interp, value);
+    /* For dynpmc fallback to MMD */
+    if ((type >= enum_class_core_max) || (VTABLE_type(interp, _self) >= enum_class_core_max))
+        type = enum_class_core_max;
+    switch(type) {
+        case enum_class_core_max:
+            {
+                INTVAL retval;
+                Parrot_mmd_multi_dispatch_from_c_args(interp, "is_equal", "PP->I", _self, value, &retval);
+                return retval;
+            }
+            break;
+        default:
+            return Parrot_Sub_multi_is_equal_PMC(interp, _self, value);
+            break;
+
+    }
+}
+static  void 
+Parrot_Sub_mark(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 608 "./src/pmc/sub.pmc"
+
+    Parrot_Sub_attributes * const sub = PARROT_SUB(_self);
+
+    if (!sub)
+        return;
+
+    Parrot_gc_mark_STRING_alive(interp, sub->name);
+    Parrot_gc_mark_STRING_alive(interp, sub->subid);
+    Parrot_gc_mark_STRING_alive(interp, sub->method_name);
+    Parrot_gc_mark_STRING_alive(interp, sub->ns_entry_name);
+
+    Parrot_gc_mark_PMC_alive(interp, sub->ctx);
+    Parrot_gc_mark_PMC_alive(interp, sub->lex_info);
+    Parrot_gc_mark_PMC_alive(interp, sub->outer_ctx);
+    Parrot_gc_mark_PMC_alive(interp, sub->outer_sub);
+    Parrot_gc_mark_PMC_alive(interp, sub->namespace_name);
+    Parrot_gc_mark_PMC_alive(interp, sub->multi_signature);
+    Parrot_gc_mark_PMC_alive(interp, sub->namespace_stash);
+
+    /* XXX
+     * Workaround for things that subclass sub but don't point into packfiles
+     * (eg: EventHandler)
+     * TODO: use inheritance properly to avoid this
+     */
+    if (sub->seg && ! Interp_flags_TEST(interp, PARROT_IS_THREAD))
+        Parrot_gc_mark_PMC_alive(interp, sub->seg->base.pf->view);
+#line 743 "./src/pmc/sub.c"
+}
+static  void 
+Parrot_Sub_set_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *other)
+{
+#line 574 "./src/pmc/sub.pmc"
+
+    VTABLE_assign_pmc(interp, _self, other);
+#line 751 "./src/pmc/sub.c"
+}
+static  void 
+Parrot_Sub_set_pointer(PARROT_INTERP, ARGMOD(PMC *_self), SHIM(void *value))
+{
+#line 300 "./src/pmc/sub.pmc"
+
+    /**/UNUSED(_self)
+    Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+        "Don't set the address of a sub\nuse .const 'Sub' instead");
+#line 761 "./src/pmc/sub.c"
+}
+static  void 
+Parrot_Sub_set_string_native(PARROT_INTERP, ARGMOD(PMC *_self), STRING *subname)
+{
+#line 283 "./src/pmc/sub.pmc"
+
+    SETATTR_Sub_name(interp, _self, subname);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 770 "./src/pmc/sub.c"
+}
+static  void 
+Parrot_Sub_thaw(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 759 "./src/pmc/sub.pmc"
+
+    Parrot_Sub_attributes *sub;
+    INTVAL flags;
+    int    i;
+
+    Parrot_Sub_init(interp, _self);
+
+    PMC_get_sub(interp, _self, sub);
+
+    /* we get relative offsets */
+    sub->start_offs   = (size_t) VTABLE_shift_integer(interp, info);
+    sub->end_offs     = (size_t) VTABLE_shift_integer(interp, info);
+    flags             = VTABLE_shift_integer(interp, info);
+
+    PObj_get_FLAGS(_self) |= flags & SUB_FLAG_PF_MASK;
+
+    sub->name           = VTABLE_shift_string(interp, info);
+    sub->method_name    = VTABLE_shift_string(interp, info);
+    sub->ns_entry_name  = VTABLE_shift_string(interp, info);
+    /* lookup or create HLL */
+    sub->HLL_id         = Parrot_hll_register_HLL(interp,
+        VTABLE_shift_string(interp, info));
+    sub->comp_flags     = VTABLE_shift_integer(interp, info);
+    sub->vtable_index   = VTABLE_shift_integer(interp, info);
+
+    for (i = 0; i < 4; ++i)
+        sub->n_regs_used[i] = VTABLE_shift_integer(interp, info);
+
+    sub->subid        = VTABLE_shift_string(interp, info);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 806 "./src/pmc/sub.c"
+}
+static  void 
+Parrot_Sub_visit(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 672 "./src/pmc/sub.pmc"
+
+    VISIT_PMC_ATTR(interp, info, _self, Sub, namespace_name);
+    VISIT_PMC_ATTR(interp, info, _self, Sub, multi_signature);
+    VISIT_PMC_ATTR(interp, info, _self, Sub, outer_sub);
+
+    /*
+     * XXX visit_pmc_now is wrong, because it breaks
+     *     depth-first visit inside the todo list
+     * TODO change all user visit functions to use
+     *    visit_pmc (the todo renamed visit_pm_later)
+     *
+     * Therefore the hash must be last during visit for now.
+     */
+    VISIT_PMC_ATTR(interp, info, _self, Sub, lex_info);
+
+    interp->vtables[enum_class_default]->visit(interp, _self, info);
+#line 828 "./src/pmc/sub.c"
+}
+static  INTVAL 
+Parrot_Sub_multi_is_equal_PMC(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 646 "./src/pmc/sub.pmc"
+
+    Parrot_Sub_attributes *my_sub, *value_sub;
+
+    PMC_get_sub(interp, _self, my_sub);
+    PMC_get_sub(interp, value, value_sub);
+
+    return _self->vtable         == value->vtable
+    &&     (my_sub)->start_offs == (value_sub)->start_offs
+    &&     (my_sub)->seg        == (value_sub)->seg;
+#line 843 "./src/pmc/sub.c"
+}
+static  void
+Parrot_Sub_nci_start_offs(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 1010 "./src/pmc/sub.pmc"
+
+    Parrot_Sub_attributes  *sub;
+    INTVAL                  start_offs;
+
+    PMC_get_sub(interp, _self, sub);
+    start_offs = sub->start_offs;
+    #line 870 "./src/pmc/sub.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)start_offs);
+        
+        return;
+     }
+#line 1016 "./src/pmc/sub.pmc"
+
+#line 878 "./src/pmc/sub.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Sub_nci_end_offs(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 1020 "./src/pmc/sub.pmc"
+
+    Parrot_Sub_attributes  *sub;
+    INTVAL                  end_offs;
+    PMC_get_sub(interp, _self, sub);
+    end_offs = sub->end_offs;
+    #line 911 "./src/pmc/sub.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)end_offs);
+        
+        return;
+     }
+#line 1025 "./src/pmc/sub.pmc"
+
+#line 919 "./src/pmc/sub.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Sub_nci_get_namespace(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 1029 "./src/pmc/sub.pmc"
+
+    PMC                   *_namespace;
+    Parrot_Sub_attributes *sub;
+
+    PMC_get_sub(interp, _self, sub);
+    /*
+    XXX Rakudo's failing with this code on ASSERT. Why???
+    GETATTR_Sub_namespace_stash(interp, _self, _namespace);
+    PARROT_ASSERT(_namespace == sub->namespace_stash || !"consistency!!!");
+    */
+    _namespace = sub->namespace_stash;
+    #line 958 "./src/pmc/sub.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)_namespace);
+        
+        return;
+     }
+#line 1040 "./src/pmc/sub.pmc"
+
+#line 966 "./src/pmc/sub.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Sub_nci___get_regs_used(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    STRING* reg;
+    
+    const INTVAL arity = 2; /* "PiS" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    reg = VTABLE_get_string_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 1044 "./src/pmc/sub.pmc"
+
+    /* TODO switch to canonical NiSP order
+     * see also imcc/reg_alloc.c */
+    STRING                * const types = CONST_STRING(interp, "INSP");
+    Parrot_Sub_attributes *sub;
+    INTVAL                 regs_used;
+    INTVAL                 kind;
+
+    PMC_get_sub(interp, _self, sub);
+    PARROT_ASSERT(sub->n_regs_used);
+
+    if (!reg || Parrot_str_length(interp, reg) != 1)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+            EXCEPTION_INVALID_OPERATION,
+            "illegal register kind '%Ss'", reg);
+
+    kind = STRING_index(interp, types, reg, 0);
+
+    if (kind == -1)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+           EXCEPTION_INVALID_OPERATION, "illegal register kind '%Ss'", reg);
+
+    regs_used = sub->n_regs_used[kind];
+    #line 1019 "./src/pmc/sub.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)regs_used);
+        
+        return;
+     }
+#line 1067 "./src/pmc/sub.pmc"
+
+#line 1027 "./src/pmc/sub.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Sub_nci_get_lexinfo(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 1071 "./src/pmc/sub.pmc"
+
+    PMC                   *lexinfo;
+    Parrot_Sub_attributes *sub;
+    PMC_get_sub(interp, _self, sub);
+
+    lexinfo = sub->lex_info ? sub->lex_info : PMCNULL;
+
+    #line 1062 "./src/pmc/sub.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)lexinfo);
+        
+        return;
+     }
+#line 1078 "./src/pmc/sub.pmc"
+
+#line 1070 "./src/pmc/sub.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Sub_nci_get_subid(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 1082 "./src/pmc/sub.pmc"
+
+    STRING                *subid;
+    Parrot_Sub_attributes *sub;
+    PMC_get_sub(interp, _self, sub);
+
+    subid = sub->subid ? sub->subid : CONST_STRING(interp, "");
+
+    #line 1105 "./src/pmc/sub.c"
+     {
+        VTABLE_set_string_keyed_int(interp, _call_object, 0, (STRING*)subid);
+        
+        return;
+     }
+#line 1089 "./src/pmc/sub.pmc"
+
+#line 1113 "./src/pmc/sub.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Sub_nci_get_outer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 1093 "./src/pmc/sub.pmc"
+
+    PMC                   *outersub;
+    Parrot_Sub_attributes *sub;
+    PMC_get_sub(interp, _self, sub);
+
+    outersub = sub->outer_sub ? sub->outer_sub : PMCNULL;
+
+    #line 1148 "./src/pmc/sub.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)outersub);
+        
+        return;
+     }
+#line 1100 "./src/pmc/sub.pmc"
+
+#line 1156 "./src/pmc/sub.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Sub_nci_set_outer(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* outer;
+    
+    const INTVAL arity = 2; /* "PiP" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    outer = VTABLE_get_pmc_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 1104 "./src/pmc/sub.pmc"
+
+    /* Set outer sub. */
+    Parrot_Sub_attributes *sub;
+    PMC                   *outer_ctx;
+    PMC_get_sub(interp, _self, sub);
+
+    sub->outer_sub = outer;
+
+    /* Make sure outer flag of that sub is set. */
+    PObj_get_FLAGS(outer) |= SUB_FLAG_IS_OUTER;
+
+    /* Ensure we have lex info. */
+    if (PMC_IS_NULL(sub->lex_info)) {
+        const INTVAL lex_info_id = Parrot_hll_get_ctx_HLL_type(interp,
+                                       enum_class_LexInfo);
+        sub->lex_info = Parrot_pmc_new_init(interp, lex_info_id, _self);
+    }
+
+    /* Clear any existing outer context */
+    sub->outer_ctx = PMCNULL;
+
+    /* If we've got a context around for the outer sub, set it as the
+     * outer context. */
+    outer_ctx = CURRENT_CONTEXT(interp);
+
+    while (!PMC_IS_NULL(outer_ctx)) {
+        if (Parrot_pcc_get_sub(interp, outer_ctx) == outer) {
+            sub->outer_ctx = outer_ctx;
+            break;
+        }
+        outer_ctx = Parrot_pcc_get_caller_ctx(interp, outer_ctx);
+    }
+#line 1218 "./src/pmc/sub.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Sub_nci_set_outer_ctx(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* outer_ctx;
+    
+    const INTVAL arity = 2; /* "PiP" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    outer_ctx = VTABLE_get_pmc_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 1139 "./src/pmc/sub.pmc"
+
+    Parrot_Sub_attributes *sub;
+    PMC_get_sub(interp, _self, sub);
+    sub->outer_ctx = outer_ctx;
+#line 1252 "./src/pmc/sub.c"
+
+    } /* END PMETHOD BODY */
+
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Sub_nci_get_multisig(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 1146 "./src/pmc/sub.pmc"
+
+    PMC                   *multisig;
+    Parrot_Sub_attributes *sub;
+    PMC_get_sub(interp, _self, sub);
+
+    multisig = sub->multi_signature ? sub->multi_signature : PMCNULL;
+
+    #line 1287 "./src/pmc/sub.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)multisig);
+        
+        return;
+     }
+#line 1153 "./src/pmc/sub.pmc"
+
+#line 1295 "./src/pmc/sub.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Sub_nci_arity(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 1157 "./src/pmc/sub.pmc"
+
+    PMC * const pos_required   = VTABLE_inspect_str(interp, _self, CONST_STRING(interp, "pos_required"));
+    PMC * const named_required = VTABLE_inspect_str(interp, _self, CONST_STRING(interp, "named_required"));
+
+    const INTVAL i = VTABLE_get_integer(interp, pos_required)
+                   + VTABLE_get_integer(interp, named_required);
+
+    #line 1330 "./src/pmc/sub.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)i);
+        
+        return;
+     }
+#line 1164 "./src/pmc/sub.pmc"
+
+#line 1338 "./src/pmc/sub.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Sub_nci_comp_flags(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 1183 "./src/pmc/sub.pmc"
+
+    Parrot_Sub_attributes  *sub;
+    INTVAL                  flags;
+
+    PMC_get_sub(interp, _self, sub);
+    flags = sub->comp_flags;
+    #line 1372 "./src/pmc/sub.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)flags);
+        
+        return;
+     }
+#line 1189 "./src/pmc/sub.pmc"
+
+#line 1380 "./src/pmc/sub.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Sub_nci_pf_flags(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 1192 "./src/pmc/sub.pmc"
+
+    /* Only PF specific flags */
+    INTVAL  flags = PObj_get_FLAGS(_self) & SUB_FLAG_PF_MASK;
+    #line 1411 "./src/pmc/sub.c"
+     {
+        VTABLE_set_integer_keyed_int(interp, _call_object, 0, (INTVAL)flags);
+        
+        return;
+     }
+#line 1195 "./src/pmc/sub.pmc"
+
+#line 1419 "./src/pmc/sub.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Sub_nci_get_packfile(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 1198 "./src/pmc/sub.pmc"
+
+    Parrot_Sub_attributes *sub;
+    PMC *view;
+    PMC_get_sub(interp, _self, sub);
+    view = sub->seg->base.pf->view;
+    if (!view)
+        view = PMCNULL;
+    #line 1454 "./src/pmc/sub.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)view);
+        
+        return;
+     }
+#line 1205 "./src/pmc/sub.pmc"
+
+#line 1462 "./src/pmc/sub.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Sub_multi_is_equal_PMC_pcc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+PMC *value;
+INTVAL  _result;
+PMC *_call_obj = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+Parrot_pcc_fill_params_from_c_args(interp, _call_obj, "PiP", &_self, &value);
+_result = Parrot_Sub_multi_is_equal_PMC(interp, _self, value);
+    Parrot_pcc_set_call_from_c_args(interp, _call_obj, "I", _result);
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_Sub_update_vtable(VTABLE *vt) {
+    vt->assign_pmc = Parrot_Sub_assign_pmc;
+    vt->clone = Parrot_Sub_clone;
+    vt->defined = Parrot_Sub_defined;
+    vt->destroy = Parrot_Sub_destroy;
+    vt->freeze = Parrot_Sub_freeze;
+    vt->get_bool = Parrot_Sub_get_bool;
+    vt->get_integer_keyed = Parrot_Sub_get_integer_keyed;
+    vt->get_pointer = Parrot_Sub_get_pointer;
+    vt->get_string = Parrot_Sub_get_string;
+    vt->init = Parrot_Sub_init;
+    vt->init_pmc = Parrot_Sub_init_pmc;
+    vt->inspect = Parrot_Sub_inspect;
+    vt->inspect_str = Parrot_Sub_inspect_str;
+    vt->invoke = Parrot_Sub_invoke;
+    vt->is_equal = Parrot_Sub_is_equal;
+    vt->mark = Parrot_Sub_mark;
+    vt->set_pmc = Parrot_Sub_set_pmc;
+    vt->set_pointer = Parrot_Sub_set_pointer;
+    vt->set_string_native = Parrot_Sub_set_string_native;
+    vt->thaw = Parrot_Sub_thaw;
+    vt->visit = Parrot_Sub_visit;
+    vt->attr_size = sizeof(Parrot_Sub_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_Sub_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->clone = Parrot_Sub_clone;
+    vt->defined = Parrot_Sub_defined;
+    vt->destroy = Parrot_Sub_destroy;
+    vt->freeze = Parrot_Sub_freeze;
+    vt->get_bool = Parrot_Sub_get_bool;
+    vt->get_integer_keyed = Parrot_Sub_get_integer_keyed;
+    vt->get_pointer = Parrot_Sub_get_pointer;
+    vt->get_string = Parrot_Sub_get_string;
+    vt->inspect = Parrot_Sub_inspect;
+    vt->inspect_str = Parrot_Sub_inspect_str;
+    vt->invoke = Parrot_Sub_invoke;
+    vt->is_equal = Parrot_Sub_is_equal;
+    vt->mark = Parrot_Sub_mark;
+    vt->visit = Parrot_Sub_visit;
+    vt->attr_size = sizeof(Parrot_Sub_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Sub_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_Sub_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Sub_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_Sub_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_Sub_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "Sub"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_Sub_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "Sub")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_Sub_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        ":seg :start_offs :end_offs IHLL_id Fnamespace_name Fnamespace_stash Sname Smethod_name Sns_entry_name Ssubid Ivtable_index Fmulti_signature :n_regs_used Flex_info Fouter_sub Fctx :comp_flags :arg_info Fouter_ctx ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_Sub_get_vtable(interp);
+        vt->base_type      = enum_class_Sub;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "Sub");
+        vt->provides_str = CONST_STRING_GEN(interp, "invokable");
+        vt->isa_hash     = Parrot_Sub_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_Sub_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_Sub;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_Sub_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "start_offs");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Sub_nci_start_offs),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "end_offs");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Sub_nci_end_offs),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "get_namespace");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Sub_nci_get_namespace),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "__get_regs_used");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Sub_nci___get_regs_used),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "get_lexinfo");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Sub_nci_get_lexinfo),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "get_subid");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Sub_nci_get_subid),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "get_outer");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Sub_nci_get_outer),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "set_outer");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Sub_nci_set_outer),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "set_outer_ctx");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Sub_nci_set_outer_ctx),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "get_multisig");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Sub_nci_get_multisig),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "arity");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Sub_nci_arity),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "comp_flags");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Sub_nci_comp_flags),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "pf_flags");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Sub_nci_pf_flags),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "get_packfile");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Sub_nci_get_packfile),
+                method_name, signature);
+        }
+        {
+            STRING * const mfl_0 = CONST_STRING_GEN(interp, "is_equal");
+            STRING * const mfl_1 = CONST_STRING_GEN(interp, "Sub,PMC");
+            STRING * const mfl_2 = CONST_STRING_GEN(interp, "Sub");
+        PMC *_temp_func;
+_temp_func = Parrot_pmc_new(interp, enum_class_NativePCCMethod);
+VTABLE_set_pointer_keyed_str(interp, _temp_func, CONST_STRING(interp, "->"), (void *)Parrot_Sub_multi_is_equal_PMC_pcc);
+Parrot_mmd_add_multi_from_long_sig(interp, mfl_0, mfl_1, _temp_func);
+
+        }
+    } /* pass */
+} /* Parrot_Sub_class_init */
+
+#line 1207 "./src/pmc/sub.pmc"
+
+
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -0,0 +1,758 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/task.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_fixedintegerarray.h"
+#include "pmc_task.h"
+#include "pmc_default.h"
+#include "task.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/task.pmc"
+/*
+Copyright (C) 2001-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/task.pmc - Task PMC
+
+=head1 DESCRIPTION
+
+A Task PMC represents a concurrent native thread,
+initialized at startup in a threadpool.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "parrot/scheduler_private.h"
+#include "pmc/pmc_scheduler.h"
+#include "pmc/pmc_proxy.h"
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+#line 51 "./src/pmc/task.c"
+static  PMC  * Parrot_Task_clone(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Task_freeze(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+static  PMC  * Parrot_Task_get_attr_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name);
+static  void  Parrot_Task_init(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Task_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *data);
+static  opcode_t  * Parrot_Task_invoke(PARROT_INTERP, ARGMOD(PMC *_self), void *next);
+static  void  Parrot_Task_mark(PARROT_INTERP, ARGMOD(PMC *_self));
+static  PMC  * Parrot_Task_pop_pmc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void  Parrot_Task_push_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void  Parrot_Task_set_attr_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name, PMC *value);
+static  void  Parrot_Task_thaw(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+static  void  Parrot_Task_thawfinish(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+static  void  Parrot_Task_visit(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info);
+static  void Parrot_Task_nci_send(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Task_nci_code(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Task_nci_data(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Task_nci_kill(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_Task_class_init(PARROT_INTERP, int, int);
+void    Parrot_Task_ro_class_init(PARROT_INTERP, int, int);
+static  PMC  *
+Parrot_Task_clone(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 251 "./src/pmc/task.pmc"
+
+    /* Create the new task PMC, of the same type of this one (we may
+     * have been subclassed). */
+    PMC * const copy  = Parrot_pmc_new(interp, _self->vtable->base_type);
+    Parrot_Task_attributes * const new_struct = PARROT_TASK(copy);
+    const Parrot_Task_attributes * const old_struct = PARROT_TASK(_self);
+
+    new_struct->code   = VTABLE_clone(interp, old_struct->code);
+    new_struct->data   = VTABLE_clone(interp, old_struct->data);
+    new_struct->shared = VTABLE_clone(interp, old_struct->shared);
+
+    return copy;
+#line 87 "./src/pmc/task.c"
+}
+static  void 
+Parrot_Task_freeze(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 397 "./src/pmc/task.pmc"
+
+    const Parrot_Task_attributes * const core_struct = PARROT_TASK(_self);
+
+    VTABLE_push_float(interp, info, core_struct->birthtime);
+#line 97 "./src/pmc/task.c"
+}
+static  PMC  *
+Parrot_Task_get_attr_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name)
+{
+#line 275 "./src/pmc/task.pmc"
+
+    Parrot_Task_attributes * const core_struct = PARROT_TASK(_self);
+    PMC * value = PMCNULL;
+
+    if (Parrot_str_equal(interp, name, CONST_STRING(interp, "birthtime"))) {
+        value = Parrot_pmc_new(interp, enum_class_Float);
+        VTABLE_set_number_native(interp, value, core_struct->birthtime);
+    }
+    else if (Parrot_str_equal(interp, name, CONST_STRING(interp, "code"))) {
+        value = core_struct->code;
+    }
+    else if (Parrot_str_equal(interp, name, CONST_STRING(interp, "data"))) {
+        value = core_struct->data;
+    }
+
+    return value;
+#line 119 "./src/pmc/task.c"
+}
+static  void 
+Parrot_Task_init(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 54 "./src/pmc/task.pmc"
+
+    Parrot_Task_attributes * const core_struct = PARROT_TASK(_self);
+    Parrot_Scheduler_attributes * const sched_data =
+            PARROT_SCHEDULER(interp->scheduler);
+
+    /* Set flags for custom GC mark. */
+    PObj_custom_mark_SET(_self);
+
+    /* Set up the core struct. */
+    core_struct->birthtime = Parrot_floatval_time();
+    core_struct->code      = PMCNULL;
+    core_struct->data      = PMCNULL;
+    core_struct->interp    = interp;
+    core_struct->killed    = 0;
+    core_struct->mailbox   = PMCNULL; /* Created lazily on demand */
+    core_struct->waiters   = PMCNULL; /* Created lazily on demand */
+    core_struct->shared    = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+    core_struct->partner   = NULL; /* Set by Parrot_thread_create_local_task */
+
+    MUTEX_INIT(core_struct->mailbox_lock);
+    MUTEX_INIT(core_struct->waiters_lock);
+
+    /* Assign a unique ID */
+    /* TODO: Fix collisions. */
+    core_struct->id = sched_data->next_task_id;
+    sched_data->next_task_id += 1;
+
+    /* By default, all flags are clear. */
+    TASK_active_CLEAR(_self);
+    TASK_in_preempt_CLEAR(_self);
+    TASK_recv_block_CLEAR(_self);
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 157 "./src/pmc/task.c"
+}
+static  void 
+Parrot_Task_init_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *data)
+{
+#line 113 "./src/pmc/task.pmc"
+
+    Parrot_Task_attributes * const core_struct = PARROT_TASK(_self);
+
+    VTABLE_init(interp, _self);
+
+    if (VTABLE_isa(interp, data, CONST_STRING(interp, "Sub"))) {
+        core_struct->code = data;
+    }
+    else if (VTABLE_isa(interp, data, CONST_STRING(interp, "Hash"))) {
+        PMC * elem = VTABLE_get_pmc_keyed_str(interp, data, CONST_STRING(interp, "birthtime"));
+        if (! PMC_IS_NULL(elem))
+            core_struct->birthtime = VTABLE_get_number(interp, elem);
+
+        elem = VTABLE_get_pmc_keyed_str(interp, data, CONST_STRING(interp, "code"));
+        if (! PMC_IS_NULL(elem))
+            core_struct->code = elem;
+
+        elem = VTABLE_get_pmc_keyed_str(interp, data, CONST_STRING(interp, "data"));
+        if (! PMC_IS_NULL(elem))
+            core_struct->data = elem;
+    }
+    else {
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "Task initializer must be a Hash or Sub");
+    }
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 189 "./src/pmc/task.c"
+}
+static  opcode_t  *
+Parrot_Task_invoke(PARROT_INTERP, ARGMOD(PMC *_self), void *next)
+{
+#line 157 "./src/pmc/task.pmc"
+
+    Parrot_Task_attributes * const self_task = PARROT_TASK(_self);
+    Parrot_Scheduler_attributes * const sdata =
+            PARROT_SCHEDULER(interp->scheduler);
+
+    PMC * const active_tasks = sdata->all_tasks;
+    const int   scheduled    = interp->cur_task == _self;
+    PMC                    *done = _self;
+    Parrot_Task_attributes *task = self_task;
+
+    PARROT_ASSERT(! PMC_IS_NULL(self_task->code));
+
+    /* If a task is pre-empted, this will be set again. */
+    TASK_in_preempt_CLEAR(_self);
+
+    if (! self_task->killed) {
+        const INTVAL current_depth =
+            Parrot_pcc_get_recursion_depth(interp, CURRENT_CONTEXT(interp));
+        /* Add the task to the set of active Tasks */
+        Parrot_cx_activate_task(interp, _self);
+
+        /* Actually run the task */
+        Parrot_ext_call(interp, self_task->code, "P->", self_task->data);
+        /* Restore recursion_depth since Parrot_Sub_invoke increments recursion_depth
+           which would not be decremented anymore if the sub is preempted */
+        Parrot_pcc_set_recursion_depth(interp, CURRENT_CONTEXT(interp), current_depth);
+
+        if (scheduled) {
+            done = interp->cur_task;
+            task = PARROT_TASK(done);
+        }
+    }
+
+    /* Fixed possibly racy read with write in send TASK_recv_block_CLEAR(partner) */
+    if (task->killed || !TASK_in_preempt_TEST(done)) {
+        /* The task is done. */
+        /* Remove it from the set of active Tasks */
+
+        INTVAL i, n = 0;
+        PMC * const task_id = Parrot_pmc_new(interp, enum_class_Integer);
+        VTABLE_set_integer_native(interp, task_id, task->id);
+        TASK_active_CLEAR(done);
+        VTABLE_delete_keyed(interp, active_tasks, task_id);
+        task->killed = 1;
+
+        /* schedule any waiters. */
+        if (!PMC_IS_NULL(task->waiters))
+            n = VTABLE_get_integer(interp, task->waiters);
+
+        for (i = 0; i < n; ++i) {
+            PMC * const wtask = VTABLE_get_pmc_keyed_int(interp, task->waiters, i);
+            Parrot_cx_schedule_task(interp, wtask);
+        }
+
+        if (task->partner) { /* TODO how can we know if the partner's still alive? */
+            Parrot_Task_attributes * const partner_task = PARROT_TASK(task->partner);
+            LOCK(partner_task->waiters_lock);
+
+            if (!PMC_IS_NULL(partner_task->waiters)) {
+                Parrot_block_GC_mark_locked(partner_task->interp);
+                partner_task->killed = 1;
+
+                n = VTABLE_get_integer(interp, partner_task->waiters);
+
+                for (i = 0; i < n; ++i) {
+                    PMC * const wtask =
+                        VTABLE_get_pmc_keyed_int(interp, partner_task->waiters, i);
+                    Parrot_cx_schedule_immediate(partner_task->interp, wtask);
+                }
+                Parrot_unblock_GC_mark_locked(partner_task->interp);
+            }
+            else
+                partner_task->killed = 1;
+
+            UNLOCK(partner_task->waiters_lock);
+
+            /* the partner's interp may be asleep until its foreign tasks end */
+            Parrot_thread_notify_thread(partner_task->interp);
+        }
+    }
+
+    return (opcode_t*) next;
+#line 277 "./src/pmc/task.c"
+}
+static  void 
+Parrot_Task_mark(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 355 "./src/pmc/task.pmc"
+
+    Parrot_Task_attributes * const core_struct = PARROT_TASK(_self);
+    if (core_struct) {
+        Parrot_gc_mark_PMC_alive(interp, core_struct->code);
+        Parrot_gc_mark_PMC_alive(interp, core_struct->data);
+        Parrot_gc_mark_PMC_alive(interp, core_struct->mailbox);
+        Parrot_gc_mark_PMC_alive(interp, core_struct->waiters);
+        Parrot_gc_mark_PMC_alive(interp, core_struct->shared);
+        /* don't mark our partner, since it belongs to another GC */
+    }
+#line 293 "./src/pmc/task.c"
+}
+static  PMC  *
+Parrot_Task_pop_pmc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 341 "./src/pmc/task.pmc"
+
+    PMC *ret = VTABLE_pop_pmc(interp, PARROT_TASK(_self)->shared);
+    #line 301 "./src/pmc/task.c"
+    return (PMC*)ret;
+#line 343 "./src/pmc/task.pmc"
+
+#line 305 "./src/pmc/task.c"
+}
+static  void 
+Parrot_Task_push_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+#line 327 "./src/pmc/task.pmc"
+
+    VTABLE_push_pmc(interp, PARROT_TASK(_self)->shared, value);
+#line 313 "./src/pmc/task.c"
+}
+static  void 
+Parrot_Task_set_attr_str(PARROT_INTERP, ARGMOD(PMC *_self), STRING *name, PMC *value)
+{
+#line 303 "./src/pmc/task.pmc"
+
+    Parrot_Task_attributes * const core_struct = PARROT_TASK(_self);
+
+    if (Parrot_str_equal(interp, name, CONST_STRING(interp, "birthtime"))) {
+        core_struct->birthtime = VTABLE_get_number(interp, value);
+    }
+    else if (Parrot_str_equal(interp, name, CONST_STRING(interp, "code"))) {
+        core_struct->code = value;
+    }
+    else if (STRING_equal(interp, name, CONST_STRING(interp, "data"))) {
+        core_struct->data = value;
+    }
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 332 "./src/pmc/task.c"
+}
+static  void 
+Parrot_Task_thaw(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 413 "./src/pmc/task.pmc"
+
+    const FLOATVAL birthtime = VTABLE_shift_float(interp, info);
+
+    /* Allocate the task's core data struct and set custom flags. */
+    VTABLE_init(interp, _self);
+
+    /* Set the task's birthtime to the frozen birthtime */
+    PARROT_TASK(_self)->birthtime = birthtime;
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+#line 347 "./src/pmc/task.c"
+}
+static  void 
+Parrot_Task_thawfinish(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 433 "./src/pmc/task.pmc"
+
+    /**/UNUSED(interp)
+    /**/UNUSED(_self)
+    UNUSED(info)
+    /* Parrot_Task_attributes * const core_struct = PARROT_TASK(_self); */
+#line 358 "./src/pmc/task.c"
+}
+static  void 
+Parrot_Task_visit(PARROT_INTERP, ARGMOD(PMC *_self), PMC *info)
+{
+#line 379 "./src/pmc/task.pmc"
+
+    /* 1) visit code block */
+    VISIT_PMC_ATTR(interp, info, _self, Task, code);
+    VISIT_PMC_ATTR(interp, info, _self, Task, data);
+    VISIT_PMC_ATTR(interp, info, _self, Task, mailbox);
+    VISIT_PMC_ATTR(interp, info, _self, Task, waiters);
+#line 370 "./src/pmc/task.c"
+}
+static  void
+Parrot_Task_nci_send(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* message;
+    
+    const INTVAL arity = 2; /* "PiP" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    message = VTABLE_get_pmc_keyed_int(interp, _call_object, 1);
+
+    { /* BEGIN PMETHOD BODY */
+#line 456 "./src/pmc/task.pmc"
+
+    Parrot_Task_attributes * const tdata = PARROT_TASK(_self);
+    LOCK(tdata->mailbox_lock);
+    if (PMC_IS_NULL(tdata->mailbox)) {
+        tdata->mailbox = Parrot_pmc_new(interp, enum_class_PMCList);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+    }
+    VTABLE_push_pmc(interp, tdata->mailbox, message);
+    UNLOCK(tdata->mailbox_lock);
+
+    if (tdata->partner) {
+        PMC *                    const partner = tdata->partner;
+        Parrot_Task_attributes * const pdata = PARROT_TASK(partner);
+        LOCK(tdata->mailbox_lock);
+        Parrot_block_GC_mark_locked(pdata->interp);
+        if (TASK_recv_block_TEST(partner)) {
+            /* Was: racy write with read in invoke task->killed || in_preempt */
+            /* TASK_recv_block_CLEAR(partner); */
+            Parrot_cx_schedule_immediate(pdata->interp, partner);
+            TASK_recv_block_CLEAR(partner);
+        }
+        Parrot_unblock_GC_mark_locked(pdata->interp);
+        UNLOCK(tdata->mailbox_lock);
+    }
+    else {
+        if (TASK_recv_block_TEST(_self)) {
+            TASK_recv_block_CLEAR(_self);
+            Parrot_cx_schedule_task(interp, _self);
+        }
+    }
+#line 423 "./src/pmc/task.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Task_nci_code(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* code;
+    INTVAL has_code;
+    
+    const INTVAL arity = 1; /* "PiPoIp" */
+    const INTVAL arity_opt  = 1;
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count < arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too few arguments: %d passed, %d expected",
+                                    param_count, arity);
+    if (param_count > arity + arity_opt)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too many arguments: %d passed, %d expected",
+                                    param_count, arity + arity_opt);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    if (param_count > 1) {
+        code = VTABLE_get_pmc_keyed_int(interp, _call_object, 1);
+        has_code = 1;
+    }
+    else {
+        code = PMCNULL;
+        has_code = 0;
+    }
+
+    { /* BEGIN PMETHOD BODY */
+#line 507 "./src/pmc/task.pmc"
+
+    Parrot_Task_attributes * const tdata = PARROT_TASK(_self);
+    if (has_code) {
+        tdata->code = code;
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+    }
+    code = tdata->code;
+    #line 474 "./src/pmc/task.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)code);
+        
+        return;
+     }
+#line 514 "./src/pmc/task.pmc"
+
+#line 482 "./src/pmc/task.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Task_nci_data(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    PMC* data;
+    INTVAL has_data;
+    
+    const INTVAL arity = 1; /* "PiPoIp" */
+    const INTVAL arity_opt  = 1;
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count < arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too few arguments: %d passed, %d expected",
+                                    param_count, arity);
+    if (param_count > arity + arity_opt)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "too many arguments: %d passed, %d expected",
+                                    param_count, arity + arity_opt);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+    if (param_count > 1) {
+        data = VTABLE_get_pmc_keyed_int(interp, _call_object, 1);
+        has_data = 1;
+    }
+    else {
+        data = PMCNULL;
+        has_data = 0;
+    }
+
+    { /* BEGIN PMETHOD BODY */
+#line 517 "./src/pmc/task.pmc"
+
+    Parrot_Task_attributes * const tdata = PARROT_TASK(_self);
+    if (has_data) {
+        tdata->data = data;
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+    }
+    data = tdata->data;
+    #line 533 "./src/pmc/task.c"
+     {
+        VTABLE_set_pmc_keyed_int(interp, _call_object, 0, (PMC*)data);
+        
+        return;
+     }
+#line 524 "./src/pmc/task.pmc"
+
+#line 541 "./src/pmc/task.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+static  void
+Parrot_Task_nci_kill(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+    PMC * const _ctx         = CURRENT_CONTEXT(interp);
+    PMC * const _call_object = Parrot_pcc_get_signature(interp, _ctx);
+
+    /* BEGIN PARAMS SCOPE */
+    
+    const INTVAL arity = 1; /* "Pi" */
+    INTVAL param_count = VTABLE_elements(interp, _call_object);
+    if (param_count != arity)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                                    EXCEPTION_INVALID_OPERATION,
+                                    "wrong number of arguments: %d passed, %d expected",
+                                    param_count, arity);
+    _self = VTABLE_get_pmc_keyed_int(interp, _call_object, 0);
+
+    { /* BEGIN PMETHOD BODY */
+#line 537 "./src/pmc/task.pmc"
+
+    Parrot_Task_attributes * const tdata = PARROT_TASK(_self);
+    tdata->killed = 1;
+#line 572 "./src/pmc/task.c"
+
+    } /* END PMETHOD BODY */
+
+    
+
+    /* END PARAMS SCOPE */
+    return;
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_Task_update_vtable(VTABLE *vt) {
+    vt->clone = Parrot_Task_clone;
+    vt->freeze = Parrot_Task_freeze;
+    vt->get_attr_str = Parrot_Task_get_attr_str;
+    vt->init = Parrot_Task_init;
+    vt->init_pmc = Parrot_Task_init_pmc;
+    vt->invoke = Parrot_Task_invoke;
+    vt->mark = Parrot_Task_mark;
+    vt->pop_pmc = Parrot_Task_pop_pmc;
+    vt->push_pmc = Parrot_Task_push_pmc;
+    vt->set_attr_str = Parrot_Task_set_attr_str;
+    vt->thaw = Parrot_Task_thaw;
+    vt->thawfinish = Parrot_Task_thawfinish;
+    vt->visit = Parrot_Task_visit;
+    vt->attr_size = sizeof(Parrot_Task_attributes);
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_Task_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->clone = Parrot_Task_clone;
+    vt->freeze = Parrot_Task_freeze;
+    vt->get_attr_str = Parrot_Task_get_attr_str;
+    vt->invoke = Parrot_Task_invoke;
+    vt->mark = Parrot_Task_mark;
+    vt->visit = Parrot_Task_visit;
+    vt->attr_size = sizeof(Parrot_Task_attributes);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Task_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_Task_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Task_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_Task_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_Task_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "Task"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_Task_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "Task")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_Task_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        ":id Fbirthtime :interp Fcode Fdata Ikilled Fmailbox :mailbox_lock Fwaiters :waiters_lock Fshared Fpartner ";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_Task_get_vtable(interp);
+        vt->base_type      = enum_class_Task;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "Task");
+        vt->provides_str = CONST_STRING_GEN(interp, "invokable");
+        vt->isa_hash     = Parrot_Task_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_Task_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_Task;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_Task_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "send");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Task_nci_send),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "code");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Task_nci_code),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "data");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Task_nci_data),
+                method_name, signature);
+        }
+        {
+            STRING * const method_name = CONST_STRING_GEN(interp, "kill");
+            STRING * const signature   = CONST_STRING_GEN(interp, "->");
+            Parrot_interp_register_native_pcc_method_in_ns(interp, entry,
+                F2DPTR(Parrot_Task_nci_kill),
+                method_name, signature);
+        }
+        {
+        }
+    } /* pass */
+} /* Parrot_Task_class_init */
+
+#line 540 "./src/pmc/task.pmc"
+
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<docs/pdds/pdd25_concurrency.pod>.
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
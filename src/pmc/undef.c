@@ -0,0 +1,417 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from './src/pmc/undef.pmc'
+ * by tools/build/pmc2c.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/dynext.h"
+#include "pmc_undef.h"
+#include "pmc_default.h"
+#include "undef.str"
+#include "pmc_continuation.h"
+#include "pmc_callcontext.h"
+#line 1 "./src/pmc/undef.pmc"
+/*
+Copyright (C) 2004-2014, Parrot Foundation.
+
+=head1 NAME
+
+src/pmc/undef.pmc - Undef PMC
+
+=head1 DESCRIPTION
+
+This is Parrot's generic undef type. This PMC has no defined value.
+It returns a numeric value of 0, a boolean of false, and an empty string.
+When assigned a number, integer, or string it morphs to a Number,
+Integer, or String PMC respectively, and when assigned a generic PMC
+it morphs into a PMC of the passed-in type and does a same-type assignment
+from there.
+
+=head2 Methods
+
+=over 4
+
+=cut
+
+*/
+
+#include "pmc/pmc_object.h"
+#define UNDEF_STRING_CLASS enum_class_String
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+#line 53 "./src/pmc/undef.c"
+static  void  Parrot_Undef_assign_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *other);
+static  PMC  * Parrot_Undef_clone(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_Undef_defined(SHIM_INTERP, SHIM(PMC *_self));
+static  INTVAL  Parrot_Undef_get_bool(SHIM_INTERP, SHIM(PMC *_self));
+static  INTVAL  Parrot_Undef_get_integer(SHIM_INTERP, SHIM(PMC *_self));
+static  FLOATVAL  Parrot_Undef_get_number(SHIM_INTERP, SHIM(PMC *_self));
+static  STRING  * Parrot_Undef_get_string(PARROT_INTERP, SHIM(PMC *_self));
+static  INTVAL Parrot_Undef_is_equal(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value);
+static  void  Parrot_Undef_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value);
+static  void  Parrot_Undef_set_number_native(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value);
+static  void  Parrot_Undef_set_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *other);
+static  void  Parrot_Undef_set_string_native(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value);
+static  void  Parrot_Undef_share(PARROT_INTERP, ARGMOD(PMC *_self));
+static  INTVAL  Parrot_Undef_multi_is_equal_Undef(SHIM_INTERP, SHIM(PMC *_self), SHIM(PMC *value));
+static  INTVAL  Parrot_Undef_multi_is_equal_DEFAULT(SHIM_INTERP, SHIM(PMC *_self), SHIM(PMC *value));
+static  void Parrot_Undef_multi_is_equal_Undef_pcc(PARROT_INTERP, ARGMOD(PMC *_self));
+static  void Parrot_Undef_multi_is_equal_DEFAULT_pcc(PARROT_INTERP, ARGMOD(PMC *_self));
+void    Parrot_Undef_class_init(PARROT_INTERP, int, int);
+void    Parrot_Undef_ro_class_init(PARROT_INTERP, int, int);
+static  void 
+Parrot_Undef_assign_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *other)
+{
+#line 87 "./src/pmc/undef.pmc"
+
+    /* don't want to call set_pmc if we're assigning an Undef to an Undef */
+    if (other->vtable->base_type != enum_class_Undef)
+        VTABLE_set_pmc(interp, _self, other);
+#line 81 "./src/pmc/undef.c"
+}
+static  PMC  *
+Parrot_Undef_clone(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 247 "./src/pmc/undef.pmc"
+
+    return Parrot_pmc_new(interp, _self->vtable->base_type);
+#line 89 "./src/pmc/undef.c"
+}
+static  INTVAL 
+Parrot_Undef_defined(SHIM_INTERP, SHIM(PMC *_self))
+{
+#line 120 "./src/pmc/undef.pmc"
+    return 0;
+#line 96 "./src/pmc/undef.c"
+}
+static  INTVAL 
+Parrot_Undef_get_bool(SHIM_INTERP, SHIM(PMC *_self))
+{
+#line 215 "./src/pmc/undef.pmc"
+    return 0;
+#line 103 "./src/pmc/undef.c"
+}
+static  INTVAL 
+Parrot_Undef_get_integer(SHIM_INTERP, SHIM(PMC *_self))
+{
+#line 104 "./src/pmc/undef.pmc"
+    return 0;
+#line 110 "./src/pmc/undef.c"
+}
+static  FLOATVAL 
+Parrot_Undef_get_number(SHIM_INTERP, SHIM(PMC *_self))
+{
+#line 151 "./src/pmc/undef.pmc"
+    return 0.0;
+#line 117 "./src/pmc/undef.c"
+}
+static  STRING  *
+Parrot_Undef_get_string(PARROT_INTERP, SHIM(PMC *_self))
+{
+#line 182 "./src/pmc/undef.pmc"
+    Parrot_warn(interp, PARROT_WARNINGS_UNDEF_FLAG,
+        "Stringifying an Undef PMC");
+
+    return CONST_STRING(interp, "");
+#line 127 "./src/pmc/undef.c"
+}
+static  INTVAL
+Parrot_Undef_is_equal(PARROT_INTERP, ARGMOD(PMC *_self), PMC *value)
+{
+    INTVAL type = VTABLE_type(interp, value);
+    /* For dynpmc fallback to MMD */
+    if ((type >= enum_class_core_max) || (VTABLE_type(interp, _self) >= enum_class_core_max))
+        type = enum_class_core_max;
+    switch(type) {
+        case enum_class_Undef:
+            return Parrot_Undef_multi_is_equal_Undef(interp, _self, value);
+            break;
+        case enum_class_core_max:
+            {
+                INTVAL retval;
+                Parrot_mmd_multi_dispatch_from_c_args(interp, "is_equal", "PP->I", _self, value, &retval);
+                return retval;
+            }
+            break;
+        default:
+            return Parrot_Undef_multi_is_equal_DEFAULT(interp, _self, value);
+            break;
+
+    }
+}
+static  void 
+Parrot_Undef_set_integer_native(PARROT_INTERP, ARGMOD(PMC *_self), INTVAL value)
+{
+#line 136 "./src/pmc/undef.pmc"
+
+    Parrot_pmc_reuse(interp, _self, enum_class_Integer, 0);
+    VTABLE_set_integer_native(interp, _self, value);
+#line 160 "./src/pmc/undef.c"
+}
+static  void 
+Parrot_Undef_set_number_native(PARROT_INTERP, ARGMOD(PMC *_self), FLOATVAL value)
+{
+#line 167 "./src/pmc/undef.pmc"
+
+    Parrot_pmc_reuse(interp, _self, enum_class_Float, 0);
+    VTABLE_set_number_native(interp, _self, value);
+#line 169 "./src/pmc/undef.c"
+}
+static  void 
+Parrot_Undef_set_pmc(PARROT_INTERP, ARGMOD(PMC *_self), PMC *other)
+{
+#line 45 "./src/pmc/undef.pmc"
+
+    if (!PObj_is_object_TEST(other)) {
+        Parrot_pmc_reuse(interp, _self, other->vtable->base_type, 0);
+        VTABLE_set_pmc(interp, _self, other);
+    }
+    else {
+        PMC * const clone   = VTABLE_clone(interp, other);
+        void * const attrs  = PMC_data(clone);
+        PMC * const meta    = PMC_metadata(clone);
+
+        /* now swap memory without leaking it */
+        PMC_data(clone)     = PMC_data(_self);
+        PMC_data(_self)      = attrs;
+        _self->vtable        = clone->vtable;
+
+        /* Restore metadata. */
+        if (!PMC_IS_NULL(meta)) {
+            PMC * const iter = VTABLE_get_iter(interp, meta);
+            while (VTABLE_get_bool(interp, iter)) {
+                STRING * const key = VTABLE_shift_string(interp, iter);
+                PMC * const value  = VTABLE_get_pmc_keyed_str(interp, meta, key);
+                Parrot_pmc_setprop(interp, _self, key, value);
+            }
+        }
+        PMC_data(clone) = NULL;
+
+        PObj_is_object_SET(_self);
+        PARROT_GC_WRITE_BARRIER(interp, _self);
+    }
+#line 204 "./src/pmc/undef.c"
+}
+static  void 
+Parrot_Undef_set_string_native(PARROT_INTERP, ARGMOD(PMC *_self), STRING *value)
+{
+#line 200 "./src/pmc/undef.pmc"
+
+    Parrot_pmc_reuse(interp, _self, enum_class_String, 0);
+    VTABLE_set_string_native(interp, _self, value);
+#line 213 "./src/pmc/undef.c"
+}
+static  void 
+Parrot_Undef_share(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+#line 231 "./src/pmc/undef.pmc"
+
+    /**/UNUSED(_self)
+    /**/UNUSED(interp)
+    /* see src/pmc/integer.pmc */
+#line 223 "./src/pmc/undef.c"
+}
+static  INTVAL 
+Parrot_Undef_multi_is_equal_Undef(SHIM_INTERP, SHIM(PMC *_self), SHIM(PMC *value))
+{
+#line 261 "./src/pmc/undef.pmc"
+    return 1;
+#line 230 "./src/pmc/undef.c"
+}
+static  INTVAL 
+Parrot_Undef_multi_is_equal_DEFAULT(SHIM_INTERP, SHIM(PMC *_self), SHIM(PMC *value))
+{
+#line 268 "./src/pmc/undef.pmc"
+    return 0;
+#line 237 "./src/pmc/undef.c"
+}
+static  void
+Parrot_Undef_multi_is_equal_Undef_pcc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+PMC *value;
+INTVAL  _result;
+PMC *_call_obj = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+Parrot_pcc_fill_params_from_c_args(interp, _call_obj, "PiP", &_self, &value);
+_result = Parrot_Undef_multi_is_equal_Undef(interp, _self, value);
+    Parrot_pcc_set_call_from_c_args(interp, _call_obj, "I", _result);
+}
+static  void
+Parrot_Undef_multi_is_equal_DEFAULT_pcc(PARROT_INTERP, ARGMOD(PMC *_self))
+{
+PMC *value;
+INTVAL  _result;
+PMC *_call_obj = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+Parrot_pcc_fill_params_from_c_args(interp, _call_obj, "PiP", &_self, &value);
+_result = Parrot_Undef_multi_is_equal_DEFAULT(interp, _self, value);
+    Parrot_pcc_set_call_from_c_args(interp, _call_obj, "I", _result);
+}
+#include "pmc_default.h"
+
+PARROT_EXPORT
+VTABLE *Parrot_Undef_update_vtable(VTABLE *vt) {
+    vt->assign_pmc = Parrot_Undef_assign_pmc;
+    vt->clone = Parrot_Undef_clone;
+    vt->defined = Parrot_Undef_defined;
+    vt->get_bool = Parrot_Undef_get_bool;
+    vt->get_integer = Parrot_Undef_get_integer;
+    vt->get_number = Parrot_Undef_get_number;
+    vt->get_string = Parrot_Undef_get_string;
+    vt->is_equal = Parrot_Undef_is_equal;
+    vt->set_integer_native = Parrot_Undef_set_integer_native;
+    vt->set_number_native = Parrot_Undef_set_number_native;
+    vt->set_pmc = Parrot_Undef_set_pmc;
+    vt->set_string_native = Parrot_Undef_set_string_native;
+    vt->share = Parrot_Undef_share;
+
+    return vt;
+}
+
+
+PARROT_EXPORT
+VTABLE *Parrot_Undef_ro_update_vtable(ARGMOD(VTABLE *vt)) {
+    vt->clone = Parrot_Undef_clone;
+    vt->defined = Parrot_Undef_defined;
+    vt->get_bool = Parrot_Undef_get_bool;
+    vt->get_integer = Parrot_Undef_get_integer;
+    vt->get_number = Parrot_Undef_get_number;
+    vt->get_string = Parrot_Undef_get_string;
+    vt->is_equal = Parrot_Undef_is_equal;
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Undef_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_get_vtable(interp);
+    Parrot_Undef_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+VTABLE* Parrot_Undef_ro_get_vtable(PARROT_INTERP) {
+    VTABLE *vt;
+    vt = Parrot_default_ro_get_vtable(interp);
+    Parrot_Undef_ro_update_vtable(vt);
+
+    return vt;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_Undef_get_mro(PARROT_INTERP, ARGMOD(PMC* mro)) {
+    if (PMC_IS_NULL(mro)) {
+        mro = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    }
+
+    VTABLE_unshift_string(interp, mro, CONST_STRING_GEN(interp, "Undef"));
+    return mro;
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash* Parrot_Undef_get_isa(PARROT_INTERP, ARGIN_NULLOK(Hash* isa)) {
+    if (isa == NULL) {
+        isa = Parrot_hash_new(interp);
+    }
+    Parrot_hash_put(interp, isa, (void *)(CONST_STRING_GEN(interp, "Undef")), PMCNULL);
+    return isa;
+}
+
+void
+Parrot_Undef_class_init(PARROT_INTERP, int entry, int pass)
+{
+    static const char attr_defs [] =
+        "";
+    if (pass == 0) {
+        VTABLE * const vt  = Parrot_Undef_get_vtable(interp);
+        vt->base_type      = enum_class_Undef;
+        vt->flags          = 0|VTABLE_HAS_READONLY_FLAG;
+        vt->attribute_defs = attr_defs;
+        interp->vtables[entry] = vt;
+
+        vt->whoami       = CONST_STRING_GEN(interp, "Undef");
+        vt->provides_str = CONST_STRING_GEN(interp, "scalar");
+        vt->isa_hash     = Parrot_Undef_get_isa(interp, NULL);
+        {
+            VTABLE * const vt_ro         = Parrot_Undef_ro_get_vtable(interp);
+            vt_ro->base_type           = enum_class_Undef;
+            vt_ro->flags               = 0|VTABLE_IS_READONLY_FLAG;
+
+            vt_ro->attribute_defs      = attr_defs;
+
+            vt_ro->base_type           = entry;
+            vt_ro->whoami              = vt->whoami;
+            vt_ro->provides_str        = vt->provides_str;
+            vt->ro_variant_vtable     = vt_ro;
+            vt_ro->ro_variant_vtable = vt;
+            vt_ro->isa_hash            = vt->isa_hash;
+        }
+
+    }
+    else { /* pass */
+        {
+            VTABLE * const vt  = interp->vtables[entry];
+
+            vt->mro = Parrot_Undef_get_mro(interp, PMCNULL);
+
+            if (vt->ro_variant_vtable)
+                vt->ro_variant_vtable->mro = vt->mro;
+        }
+
+        /* set up MRO and _namespace */
+        Parrot_pmc_create_mro(interp, entry);
+        {
+            STRING * const mfl_0 = CONST_STRING_GEN(interp, "is_equal");
+            STRING * const mfl_1 = CONST_STRING_GEN(interp, "Undef,Undef");
+            STRING * const mfl_2 = CONST_STRING_GEN(interp, "Undef");
+            STRING * const mfl_3 = CONST_STRING_GEN(interp, "Undef,DEFAULT");
+        PMC *_temp_func;
+_temp_func = Parrot_pmc_new(interp, enum_class_NativePCCMethod);
+VTABLE_set_pointer_keyed_str(interp, _temp_func, CONST_STRING(interp, "->"), (void *)Parrot_Undef_multi_is_equal_Undef_pcc);
+Parrot_mmd_add_multi_from_long_sig(interp, mfl_0, mfl_1, _temp_func);
+
+_temp_func = Parrot_pmc_new(interp, enum_class_NativePCCMethod);
+VTABLE_set_pointer_keyed_str(interp, _temp_func, CONST_STRING(interp, "->"), (void *)Parrot_Undef_multi_is_equal_DEFAULT_pcc);
+Parrot_mmd_add_multi_from_long_sig(interp, mfl_0, mfl_3, _temp_func);
+
+        }
+    } /* pass */
+} /* Parrot_Undef_class_init */
+
+#line 273 "./src/pmc/undef.pmc"
+
+
+/*
+
+=back
+
+=cut
+
+*/
+
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
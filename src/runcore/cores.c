@@ -261,15 +261,6 @@ static opcode_t * runops_debugger_core(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(3);
 
-PARROT_WARN_UNUSED_RESULT
-PARROT_CAN_RETURN_NULL
-static opcode_t * runops_exec_core(PARROT_INTERP,
-    ARGIN(Parrot_runcore_t *runcore),
-    ARGIN(opcode_t *pc))
-        __attribute__nonnull__(1)
-        __attribute__nonnull__(2)
-        __attribute__nonnull__(3);
-
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
 static opcode_t * runops_fast_core(PARROT_INTERP,
@@ -303,10 +294,6 @@ static opcode_t * runops_trace_core(PARROT_INTERP, ARGIN(opcode_t *pc))
 #define ASSERT_ARGS_runops_debugger_core __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pc))
-#define ASSERT_ARGS_runops_exec_core __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
-       PARROT_ASSERT_ARG(interp) \
-    , PARROT_ASSERT_ARG(runcore) \
-    , PARROT_ASSERT_ARG(pc))
 #define ASSERT_ARGS_runops_fast_core __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pc))
@@ -383,34 +370,6 @@ Parrot_runcore_fast_init(PARROT_INTERP)
 }
 
 
-/*
-
-=item C<void Parrot_runcore_exec_init(PARROT_INTERP)>
-
-Registers the exec runcore with Parrot.
-
-=cut
-
-*/
-
-void
-Parrot_runcore_exec_init(PARROT_INTERP)
-{
-    ASSERT_ARGS(Parrot_runcore_exec_init)
-
-    Parrot_runcore_t * const coredata = mem_gc_allocate_zeroed_typed(interp, Parrot_runcore_t);
-    coredata->name             = CONST_STRING(interp, "exec");
-    coredata->id               = PARROT_EXEC_CORE;
-    coredata->opinit           = PARROT_CORE_OPLIB_INIT;
-    coredata->runops           = runops_exec_core;
-    coredata->destroy          = NULL;
-    coredata->prepare_run      = NULL;
-    coredata->flags            = 0;
-
-    Parrot_runcore_register(interp, coredata);
-}
-
-
 /*
 
 =item C<void Parrot_runcore_gc_debug_init(PARROT_INTERP)>
@@ -492,6 +451,10 @@ runops_fast_core(PARROT_INTERP, SHIM(Parrot_runcore_t *runcore), ARGIN(opcode_t
 
     while (pc) {
         Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), pc);
+
+        if (interp->sample_requested)
+            Parrot_runcore_sampler_sample(interp, pc);
+
         DO_OP(pc, interp);
     }
 
@@ -574,6 +537,9 @@ runops_trace_core(PARROT_INTERP, ARGIN(opcode_t *pc))
 
         Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), pc);
 
+        if (interp->sample_requested)
+            Parrot_runcore_sampler_sample(interp, pc);
+
         DO_OP(pc, interp);
         trace_op(interp, code_start, code_end, pc);
 
@@ -625,6 +591,9 @@ runops_slow_core(PARROT_INTERP, SHIM(Parrot_runcore_t *runcore), ARGIN(opcode_t
 
         Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), pc);
 
+        if (interp->sample_requested)
+            Parrot_runcore_sampler_sample(interp, pc);
+
         DO_OP(pc, interp);
     }
 
@@ -752,33 +721,6 @@ get_core_op_lib_init(SHIM_INTERP, ARGIN(Parrot_runcore_t *runcore))
 }
 
 
-/*
-
-=item C<static opcode_t * runops_exec_core(PARROT_INTERP, Parrot_runcore_t
-*runcore, opcode_t *pc)>
-
-Runs the native executable version of the specified opcode.
-Currently disabled.
-
-=cut
-
-*/
-
-PARROT_WARN_UNUSED_RESULT
-PARROT_CAN_RETURN_NULL
-static opcode_t *
-runops_exec_core(PARROT_INTERP, ARGIN(Parrot_runcore_t *runcore), ARGIN(opcode_t *pc))
-{
-    ASSERT_ARGS(runops_exec_core)
-
-    UNUSED(interp);
-    UNUSED(runcore);
-    UNUSED(pc);
-
-    return NULL;
-}
-
-
 /*
 
 =back
@@ -0,0 +1,692 @@
+/*
+Copyright (C) 2014, Parrot Foundation.
+
+=head1 NAME
+
+src/runcore/exec.c - Parrot's native code runcore
+
+=head1 DESCRIPTION
+
+The exec runcore translates each Sub to machine code the first time it runs
+and then executes that instead of dispatching op by op.
+
+The translation is a baseline template JIT: every op becomes a fixed
+template that stores the current pc in the context, calls the op's C
+function (exactly what the fast core would call) and compares the pc it
+returns with the address of the following op. Straight-line code therefore
+runs from template to template without ever going back through a dispatch
+loop. When an op branches, the template jumps to a small dispatch stub which
+looks the new pc up in the table of compiled ops and continues there, or
+leaves native code if the target has not been compiled (yet). The stub also
+leaves native code once the op table has been swapped for event checking, so
+the swap takes effect at the next branch at the latest.
+
+Native code hangs off the C<PackFile_ByteCode> segment it was made from and
+is released together with it. Templates only embed the op functions of the
+segment, so everything an op can do -- invoking Subs, throwing exceptions,
+running nested runloops -- works exactly as in the fast core.
+
+Only x86-64 with the System V calling convention is supported. On any other
+platform, and for code that cannot be attributed to a Sub, the exec core
+interprets ops like the fast core does.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "parrot/runcore_api.h"
+
+#include "parrot/oplib/ops.h"
+#include "parrot/oplib/core_ops.h"
+
+#include "exec.str"
+
+#include "pmc/pmc_sub.h"
+#include "pmc/pmc_callcontext.h"
+
+#include <stddef.h>
+
+#if defined(__x86_64__) && !defined(_WIN32) && defined(PARROT_HAS_HEADER_SYSMMAN)
+#  define EXEC_CORE_NATIVE 1
+#  include <unistd.h>
+#  include <sys/mman.h>
+#  if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#    define MAP_ANONYMOUS MAP_ANON
+#  endif
+#endif
+
+/* HEADERIZER HFILE: include/parrot/runcore_api.h */
+
+/* Enter native code at C<target>, returning the pc it left at. */
+typedef opcode_t * (*exec_enter_fn)(PARROT_INTERP, void *target);
+
+/* An executable mapping holding the templates of one Sub.  The header
+ * lives at the start of the mapping itself. */
+typedef struct exec_chunk {
+    struct exec_chunk *next;
+    size_t             size;        /* bytes mapped */
+} exec_chunk;
+
+struct Parrot_exec_code {
+    opcode_t      *code_start;      /* segment bytecode the entries refer to */
+    size_t         code_size;       /* ... and its size in opcodes */
+    void         **entries;         /* native address of each compiled op */
+    char          *rejected;        /* ops compile_sub already gave up on */
+    exec_chunk    *chunks;          /* all native code of the segment */
+    exec_enter_fn  enter;           /* entry trampoline */
+};
+
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+static int compile_sub(PARROT_INTERP,
+    ARGMOD(Parrot_exec_code *code),
+    ARGIN(PackFile_ByteCode *cs),
+    ARGIN(const opcode_t *pc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*code);
+
+PARROT_CANNOT_RETURN_NULL
+static unsigned char * emit_dispatch(
+    ARGOUT(unsigned char *p),
+    ARGIN(const Parrot_exec_code *code),
+    ARGIN(const PackFile_ByteCode *cs))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*p);
+
+PARROT_CANNOT_RETURN_NULL
+static unsigned char * emit_enter(ARGOUT(unsigned char *p))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*p);
+
+PARROT_CANNOT_RETURN_NULL
+static unsigned char * emit_op(
+    ARGOUT(unsigned char *p),
+    ARGIN(opcode_t *pc),
+    ARGIN(op_func_t func),
+    ARGIN(opcode_t *next),
+    ARGIN(const unsigned char *dispatch))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        __attribute__nonnull__(5)
+        FUNC_MODIFIES(*p);
+
+PARROT_CANNOT_RETURN_NULL
+static unsigned char * emit_u32(ARGOUT(unsigned char *p), UINTVAL value)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*p);
+
+PARROT_CANNOT_RETURN_NULL
+static unsigned char * emit_u64(ARGOUT(unsigned char *p), UINTVAL value)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*p);
+
+PARROT_CAN_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static void * get_entry(
+    ARGIN(const Parrot_exec_code *code),
+    ARGIN(const opcode_t *pc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_CANNOT_RETURN_NULL
+static Parrot_exec_code * get_exec_code(PARROT_INTERP,
+    ARGMOD(PackFile_ByteCode *cs))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*cs);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static opcode_t * runops_exec_core(PARROT_INTERP,
+    Parrot_runcore_t *runcore,
+    ARGIN(opcode_t *pc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(3);
+
+#define ASSERT_ARGS_compile_sub __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(code) \
+    , PARROT_ASSERT_ARG(cs) \
+    , PARROT_ASSERT_ARG(pc))
+#define ASSERT_ARGS_emit_dispatch __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(p) \
+    , PARROT_ASSERT_ARG(code) \
+    , PARROT_ASSERT_ARG(cs))
+#define ASSERT_ARGS_emit_enter __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(p))
+#define ASSERT_ARGS_emit_op __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(p) \
+    , PARROT_ASSERT_ARG(pc) \
+    , PARROT_ASSERT_ARG(func) \
+    , PARROT_ASSERT_ARG(next) \
+    , PARROT_ASSERT_ARG(dispatch))
+#define ASSERT_ARGS_emit_u32 __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(p))
+#define ASSERT_ARGS_emit_u64 __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(p))
+#define ASSERT_ARGS_get_entry __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(code) \
+    , PARROT_ASSERT_ARG(pc))
+#define ASSERT_ARGS_get_exec_code __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(cs))
+#define ASSERT_ARGS_runops_exec_core __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pc))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+/* Size of the templates emitted below, in bytes */
+#define EXEC_CHUNK_HEADER   32
+#define EXEC_ENTER_SIZE      7
+#define EXEC_DISPATCH_SIZE  76
+#define EXEC_OP_SIZE        66
+#define EXEC_TAIL_SIZE       5
+
+#define EMIT_BYTE(p, b) (*(p)++ = (unsigned char)(b))
+
+/*
+
+=item C<static unsigned char * emit_u32(unsigned char *p, UINTVAL value)>
+
+=item C<static unsigned char * emit_u64(unsigned char *p, UINTVAL value)>
+
+Store a little-endian immediate at C<p> and return the address after it.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+static unsigned char *
+emit_u32(ARGOUT(unsigned char *p), UINTVAL value)
+{
+    ASSERT_ARGS(emit_u32)
+    int i;
+
+    for (i = 0; i < 4; ++i, value >>= 8)
+        EMIT_BYTE(p, value & 0xff);
+
+    return p;
+}
+
+PARROT_CANNOT_RETURN_NULL
+static unsigned char *
+emit_u64(ARGOUT(unsigned char *p), UINTVAL value)
+{
+    ASSERT_ARGS(emit_u64)
+    int i;
+
+    for (i = 0; i < 8; ++i, value >>= 8)
+        EMIT_BYTE(p, value & 0xff);
+
+    return p;
+}
+
+/*
+
+=item C<static unsigned char * emit_enter(unsigned char *p)>
+
+Emit the trampoline called from C as C<opcode_t *enter(interp, target)>. It
+keeps the interpreter in the callee-saved C<r12> for all templates and jumps
+to C<target>. The single push also leaves the stack aligned for the calls
+made by the templates.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+static unsigned char *
+emit_enter(ARGOUT(unsigned char *p))
+{
+    ASSERT_ARGS(emit_enter)
+
+    EMIT_BYTE(p, 0x41); EMIT_BYTE(p, 0x54);                     /* push r12     */
+    EMIT_BYTE(p, 0x49); EMIT_BYTE(p, 0x89); EMIT_BYTE(p, 0xfc); /* mov r12, rdi */
+    EMIT_BYTE(p, 0xff); EMIT_BYTE(p, 0xe6);                     /* jmp rsi      */
+
+    return p;
+}
+
+/*
+
+=item C<static unsigned char * emit_dispatch(unsigned char *p, const
+Parrot_exec_code *code, const PackFile_ByteCode *cs)>
+
+Emit the dispatch stub, entered with the next pc in C<rax>. If the pc lies in
+the segment and its op has been compiled, jump there; otherwise return the pc
+to the C caller of the trampoline.
+
+Every branch goes through here, so the stub also returns to C whenever
+event checking has swapped the segment's op table, parking the real one in
+C<save_func_table>. The driver loop then runs the ops through the swapped
+table as the fast core would.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+static unsigned char *
+emit_dispatch(ARGOUT(unsigned char *p), ARGIN(const Parrot_exec_code *code),
+        ARGIN(const PackFile_ByteCode *cs))
+{
+    ASSERT_ARGS(emit_dispatch)
+
+    EMIT_BYTE(p, 0x48); EMIT_BYTE(p, 0x85); EMIT_BYTE(p, 0xc0); /* test rax, rax     */
+    EMIT_BYTE(p, 0x74); EMIT_BYTE(p, 0x44);                     /* jz   leave        */
+    EMIT_BYTE(p, 0x48); EMIT_BYTE(p, 0xb9);                     /* mov  rcx, &save   */
+    p = emit_u64(p, PTR2UINTVAL(&cs->save_func_table));
+    EMIT_BYTE(p, 0x48); EMIT_BYTE(p, 0x83);                     /* cmp  [rcx], 0     */
+    EMIT_BYTE(p, 0x39); EMIT_BYTE(p, 0x00);
+    EMIT_BYTE(p, 0x75); EMIT_BYTE(p, 0x34);                     /* jne  leave        */
+    EMIT_BYTE(p, 0x48); EMIT_BYTE(p, 0xb9);                     /* mov  rcx, start   */
+    p = emit_u64(p, PTR2UINTVAL(code->code_start));
+    EMIT_BYTE(p, 0x48); EMIT_BYTE(p, 0x89); EMIT_BYTE(p, 0xc2); /* mov  rdx, rax     */
+    EMIT_BYTE(p, 0x48); EMIT_BYTE(p, 0x29); EMIT_BYTE(p, 0xca); /* sub  rdx, rcx     */
+    EMIT_BYTE(p, 0x48); EMIT_BYTE(p, 0xb9);                     /* mov  rcx, size    */
+    p = emit_u64(p, (UINTVAL)(code->code_size * sizeof (opcode_t)));
+    EMIT_BYTE(p, 0x48); EMIT_BYTE(p, 0x39); EMIT_BYTE(p, 0xca); /* cmp  rdx, rcx     */
+    EMIT_BYTE(p, 0x73); EMIT_BYTE(p, 0x15);                     /* jae  leave        */
+    EMIT_BYTE(p, 0x48); EMIT_BYTE(p, 0xb9);                     /* mov  rcx, entries */
+    p = emit_u64(p, PTR2UINTVAL(code->entries));
+    EMIT_BYTE(p, 0x48); EMIT_BYTE(p, 0x8b);                     /* mov  rcx, [rcx+rdx] */
+    EMIT_BYTE(p, 0x0c); EMIT_BYTE(p, 0x11);
+    EMIT_BYTE(p, 0x48); EMIT_BYTE(p, 0x85); EMIT_BYTE(p, 0xc9); /* test rcx, rcx     */
+    EMIT_BYTE(p, 0x74); EMIT_BYTE(p, 0x02);                     /* jz   leave        */
+    EMIT_BYTE(p, 0xff); EMIT_BYTE(p, 0xe1);                     /* jmp  rcx          */
+    EMIT_BYTE(p, 0x41); EMIT_BYTE(p, 0x5c);                     /* leave: pop r12    */
+    EMIT_BYTE(p, 0xc3);                                         /* ret               */
+
+    return p;
+}
+
+/*
+
+=item C<static unsigned char * emit_op(unsigned char *p, opcode_t *pc, op_func_t
+func, opcode_t *next, const unsigned char *dispatch)>
+
+Emit the template for the op at C<pc>: record C<pc> in the current context as
+the fast core does, call C<func>, and fall through to the next template if the
+op returned C<next>, or jump to C<dispatch> if it did not.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+static unsigned char *
+emit_op(ARGOUT(unsigned char *p), ARGIN(opcode_t *pc), ARGIN(op_func_t func),
+        ARGIN(opcode_t *next), ARGIN(const unsigned char *dispatch))
+{
+    ASSERT_ARGS(emit_op)
+
+    EMIT_BYTE(p, 0x48); EMIT_BYTE(p, 0xbf);                     /* mov rdi, pc         */
+    p = emit_u64(p, PTR2UINTVAL(pc));
+    EMIT_BYTE(p, 0x49); EMIT_BYTE(p, 0x8b);                     /* mov rax, [r12+ctx]  */
+    EMIT_BYTE(p, 0x84); EMIT_BYTE(p, 0x24);
+    p = emit_u32(p, offsetof(Interp, ctx));
+    EMIT_BYTE(p, 0x48); EMIT_BYTE(p, 0x8b); EMIT_BYTE(p, 0x80); /* mov rax, [rax+data] */
+    p = emit_u32(p, offsetof(PMC, data));
+    EMIT_BYTE(p, 0x48); EMIT_BYTE(p, 0x89); EMIT_BYTE(p, 0xb8); /* mov [rax+pc], rdi   */
+    p = emit_u32(p, offsetof(Parrot_Context, current_pc));
+    EMIT_BYTE(p, 0x4c); EMIT_BYTE(p, 0x89); EMIT_BYTE(p, 0xe6); /* mov rsi, r12        */
+    EMIT_BYTE(p, 0x48); EMIT_BYTE(p, 0xb8);                     /* mov rax, func       */
+    p = emit_u64(p, PTR2UINTVAL(F2DPTR(func)));
+    EMIT_BYTE(p, 0xff); EMIT_BYTE(p, 0xd0);                     /* call rax            */
+    EMIT_BYTE(p, 0x48); EMIT_BYTE(p, 0xb9);                     /* mov rcx, next       */
+    p = emit_u64(p, PTR2UINTVAL(next));
+    EMIT_BYTE(p, 0x48); EMIT_BYTE(p, 0x39); EMIT_BYTE(p, 0xc8); /* cmp rax, rcx        */
+    EMIT_BYTE(p, 0x0f); EMIT_BYTE(p, 0x85);                     /* jne dispatch        */
+    p = emit_u32(p, (UINTVAL)(dispatch - (p + 4)));
+
+    return p;
+}
+
+/*
+
+=item C<static Parrot_exec_code * get_exec_code(PARROT_INTERP, PackFile_ByteCode
+*cs)>
+
+Return the native code record of the segment C<cs>, creating it if needed.
+The record is dropped and started over if the segment's bytecode has moved or
+changed size since it was compiled.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+static Parrot_exec_code *
+get_exec_code(PARROT_INTERP, ARGMOD(PackFile_ByteCode *cs))
+{
+    ASSERT_ARGS(get_exec_code)
+    Parrot_exec_code *code = cs->exec_code;
+
+    if (code
+    && (code->code_start != cs->base.data || code->code_size != cs->base.size)) {
+        Parrot_runcore_exec_free_code(interp, cs);
+        code = NULL;
+    }
+
+    if (!code) {
+        code             = mem_gc_allocate_zeroed_typed(interp, Parrot_exec_code);
+        code->code_start = cs->base.data;
+        code->code_size  = cs->base.size;
+        code->entries    = mem_gc_allocate_n_zeroed_typed(interp,
+                                cs->base.size ? cs->base.size : 1, void *);
+        code->rejected   = mem_gc_allocate_n_zeroed_typed(interp,
+                                cs->base.size ? cs->base.size : 1, char);
+        cs->exec_code    = code;
+    }
+
+    return code;
+}
+
+/*
+
+=item C<static void * get_entry(const Parrot_exec_code *code, const opcode_t
+*pc)>
+
+Return the native address of the op at C<pc>, or NULL if it has none.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static void *
+get_entry(ARGIN(const Parrot_exec_code *code), ARGIN(const opcode_t *pc))
+{
+    ASSERT_ARGS(get_entry)
+
+    if (pc < code->code_start || pc >= code->code_start + code->code_size)
+        return NULL;
+
+    return code->entries[pc - code->code_start];
+}
+
+/*
+
+=item C<static int compile_sub(PARROT_INTERP, Parrot_exec_code *code,
+PackFile_ByteCode *cs, const opcode_t *pc)>
+
+Compile the Sub running in the current context, if C<pc> belongs to it and it
+has not been compiled before. Compilation stops early at anything that does
+not look like an op of this segment; those ops stay with the interpreter.
+Returns 1 if any native code was made.
+
+A pc that did not lead to native code is remembered, so the driver loop does
+not look up and check the current Sub again each time it interprets that op.
+
+=cut
+
+*/
+
+static int
+compile_sub(PARROT_INTERP, ARGMOD(Parrot_exec_code *code),
+        ARGIN(PackFile_ByteCode *cs), ARGIN(const opcode_t *pc))
+{
+    ASSERT_ARGS(compile_sub)
+#ifdef EXEC_CORE_NATIVE
+    PMC * const            sub_pmc = Parrot_pcc_get_sub(interp, CURRENT_CONTEXT(interp));
+    Parrot_Sub_attributes *sub;
+    exec_chunk            *chunk;
+    opcode_t              *start, *end, *op_pc;
+    op_func_t             *func_table;
+    unsigned char         *p, *dispatch;
+    size_t                 n_ops, size, page;
+    void                  *mapping;
+
+    if (pc < code->code_start || pc >= code->code_start + code->code_size
+    ||  code->rejected[pc - code->code_start])
+        return 0;
+
+    /* cleared again only by recompiling the segment */
+    code->rejected[pc - code->code_start] = 1;
+
+    if (PMC_IS_NULL(sub_pmc)
+    || !VTABLE_isa(interp, sub_pmc, CONST_STRING(interp, "Sub")))
+        return 0;
+
+    PMC_get_sub(interp, sub_pmc, sub);
+
+    if (sub->seg != cs || sub->end_offs > code->code_size)
+        return 0;
+
+    start = code->code_start + sub->start_offs;
+    end   = code->code_start + sub->end_offs;
+
+    if (pc < start || pc >= end || code->entries[sub->start_offs])
+        return 0;
+
+    /* count the ops we can translate */
+    for (n_ops = 0, op_pc = start; op_pc < end; ++n_ops) {
+        const opcode_t op = *op_pc;
+        INTVAL         n;
+
+        if (op < 0 || (size_t)op >= cs->op_count)
+            break;
+
+        n = cs->op_info_table[op]->op_count;
+        ADD_OP_VAR_PART(interp, cs, op_pc, n);
+
+        if (n <= 0 || op_pc + n > end)
+            break;
+
+        op_pc += n;
+    }
+
+    if (!n_ops)
+        return 0;
+
+    page = (size_t)sysconf(_SC_PAGESIZE);
+    size = EXEC_CHUNK_HEADER + EXEC_ENTER_SIZE + EXEC_DISPATCH_SIZE
+         + n_ops * EXEC_OP_SIZE + EXEC_TAIL_SIZE;
+    size = (size + page - 1) & ~(page - 1);
+
+    mapping = mmap(NULL, size, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (mapping == MAP_FAILED)
+        return 0;
+
+    chunk        = (exec_chunk *)mapping;
+    chunk->size  = size;
+    chunk->next  = code->chunks;
+
+    p = (unsigned char *)mapping + EXEC_CHUNK_HEADER;
+
+    if (!code->enter)
+        code->enter = (exec_enter_fn)D2FPTR(p);
+
+    p        = emit_enter(p);
+    dispatch = p;
+    p        = emit_dispatch(p, code, cs);
+
+    /* while the scheduler has swapped in its event checking table, the
+     * real op functions are in save_func_table */
+    func_table = cs->save_func_table ? cs->save_func_table : cs->op_func_table;
+
+    for (op_pc = start; n_ops; --n_ops) {
+        const opcode_t op = *op_pc;
+        INTVAL         n  = cs->op_info_table[op]->op_count;
+
+        ADD_OP_VAR_PART(interp, cs, op_pc, n);
+
+        /* the entry goes live only once the chunk is executable, below */
+        code->entries[op_pc - code->code_start] = p;
+        p      = emit_op(p, op_pc, func_table[op], op_pc + n, dispatch);
+        op_pc += n;
+    }
+
+    /* running off the last template continues wherever that op led */
+    EMIT_BYTE(p, 0xe9);                                         /* jmp dispatch */
+    p = emit_u32(p, (UINTVAL)(dispatch - (p + 4)));
+
+    if (mprotect(mapping, size, PROT_READ | PROT_EXEC)) {
+        for (op_pc = start; op_pc < end; ++op_pc)
+            code->entries[op_pc - code->code_start] = NULL;
+        munmap(mapping, size);
+        return 0;
+    }
+
+    code->chunks = chunk;
+    return 1;
+#else
+    UNUSED(interp);
+    UNUSED(code);
+    UNUSED(cs);
+    UNUSED(pc);
+    return 0;
+#endif
+}
+
+/*
+
+=item C<void Parrot_runcore_exec_free_code(PARROT_INTERP, PackFile_ByteCode
+*cs)>
+
+Release the native code compiled from the segment C<cs>, if any.
+
+=cut
+
+*/
+
+void
+Parrot_runcore_exec_free_code(PARROT_INTERP, ARGMOD(PackFile_ByteCode *cs))
+{
+    ASSERT_ARGS(Parrot_runcore_exec_free_code)
+    Parrot_exec_code * const code = cs->exec_code;
+
+    if (!code)
+        return;
+
+#ifdef EXEC_CORE_NATIVE
+    {
+        exec_chunk *chunk = code->chunks;
+
+        while (chunk) {
+            exec_chunk * const next = chunk->next;
+            munmap(chunk, chunk->size);
+            chunk = next;
+        }
+    }
+#endif
+
+    mem_gc_free(interp, code->entries);
+    mem_gc_free(interp, code->rejected);
+    mem_gc_free(interp, code);
+    cs->exec_code = NULL;
+}
+
+/*
+
+=item C<void Parrot_runcore_exec_init(PARROT_INTERP)>
+
+Registers the exec runcore with Parrot.
+
+=cut
+
+*/
+
+void
+Parrot_runcore_exec_init(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_runcore_exec_init)
+
+    Parrot_runcore_t * const coredata = mem_gc_allocate_zeroed_typed(interp, Parrot_runcore_t);
+    coredata->name             = CONST_STRING(interp, "exec");
+    coredata->id               = PARROT_EXEC_CORE;
+    coredata->opinit           = PARROT_CORE_OPLIB_INIT;
+    coredata->runops           = runops_exec_core;
+    coredata->destroy          = NULL;
+    coredata->prepare_run      = NULL;
+    coredata->flags            = 0;
+
+    PARROT_RUNCORE_FUNC_TABLE_SET(coredata);
+
+    Parrot_runcore_register(interp, coredata);
+}
+
+/*
+
+=item C<static opcode_t * runops_exec_core(PARROT_INTERP, Parrot_runcore_t
+*runcore, opcode_t *pc)>
+
+Runs the Parrot operations starting at C<pc> until there are no more
+operations, in native code wherever the current Sub could be compiled and op
+by op everywhere else. While the segment's op table is swapped for event
+checking, all ops run one by one through the swapped table. Samples requested
+by the sampling profiler are taken here, whenever native code returns.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static opcode_t *
+runops_exec_core(PARROT_INTERP, SHIM(Parrot_runcore_t *runcore), ARGIN(opcode_t *pc))
+{
+    ASSERT_ARGS(runops_exec_core)
+
+    while (pc) {
+        PackFile_ByteCode * const cs   = interp->code;
+        Parrot_exec_code  * const code = get_exec_code(interp, cs);
+        void                     *entry = NULL;
+
+        if (interp->sample_requested)
+            Parrot_runcore_sampler_sample(interp, pc);
+
+        /* with the op table swapped, every op has to go through it */
+        if (!cs->save_func_table) {
+            entry = get_entry(code, pc);
+
+            if (!entry && compile_sub(interp, code, cs, pc))
+                entry = get_entry(code, pc);
+        }
+
+        if (entry)
+            pc = (code->enter)(interp, entry);
+        else {
+            Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), pc);
+            DO_OP(pc, interp);
+        }
+    }
+
+    return pc;
+}
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<src/runcore/cores.c>, F<docs/running.pod>.
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -70,7 +70,7 @@ Parrot_runcore_init(PARROT_INTERP)
     Parrot_runcore_fast_init(interp);
 
     Parrot_runcore_subprof_init(interp);
-    /* Parrot_runcore_exec_init(interp); */
+    Parrot_runcore_exec_init(interp);
     Parrot_runcore_gc_debug_init(interp);
     Parrot_runcore_debugger_init(interp);
 
@@ -249,6 +249,8 @@ Parrot_runcore_destroy(PARROT_INTERP)
     size_t            num_cores = interp->num_cores;
     size_t            i;
 
+    Parrot_runcore_sampler_stop(interp);
+
     for (i = 0; i < num_cores; ++i) {
         Parrot_runcore_t * const core = interp->cores[i];
         const runcore_destroy_fn_type destroy = core->destroy;
@@ -0,0 +1,633 @@
+/*
+Copyright (C) 2014, Parrot Foundation.
+
+=head1 NAME
+
+src/runcore/sampler.c - Parrot's sampling profiler
+
+=head1 DESCRIPTION
+
+The sampling profiler periodically records the Parrot call stack of the
+running program. Unlike the profiling and subprof runcores it does not
+instrument anything: the program runs in whatever core it was started with,
+and between samples it runs at full speed.
+
+A timer thread wakes up at the requested frequency and sets the
+C<sample_requested> flag of the sampled interpreter. The fast, slow and exec
+cores test that flag before dispatching each op and call
+C<Parrot_runcore_sampler_sample>, which clears it and walks the context chain.
+Samples are thus only taken at op boundaries, where the interpreter is in a
+consistent state and the GC may run. Time spent inside a long-running op is
+attributed to the op following it, and native code compiled by the exec core
+only reaches a sample point when it returns to the dispatch loop.
+
+The flag belongs to the sampled interpreter alone. Nothing about the code
+segments changes, so thread interpreters running the same code, the compiler
+growing a segment's op table and event checking are all unaffected.
+
+Each sample is one stack of frames, outermost first, named by the full name of
+the Sub and the source file and line of the frame's current op. HLL
+annotations take precedence over PIR debug information. Identical stacks are
+counted together and written at exit in the collapsed format understood by
+flamegraph tools, one line per stack:
+
+  main (foo.pir:12);bar (foo.pir:30) 17
+
+Samples can also be written as they are taken in the format of the profiling
+runcore, for F<tools/dev/pprof2cg.pl>.
+
+The profiler is started when the main interpreter is created with
+C<PARROT_SAMPLING_FILENAME> set in the environment, or by an embedder with
+C<Parrot_runcore_sampler_start>. See F<docs/dev/profiling.pod>.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "parrot/runcore_api.h"
+#include "parrot/thread.h"
+
+#include "sampler.str"
+
+#include "pmc/pmc_sub.h"
+
+/* HEADERIZER HFILE: include/parrot/runcore_api.h */
+
+/* Sampling frequency used when none is given, in Hz.  Not a round number,
+ * so sampling does not run in lockstep with periodic work. */
+#define SAMPLER_DEFAULT_FREQUENCY 99
+
+/* Deepest stack recorded; outer frames beyond it are dropped */
+#define SAMPLER_MAX_DEPTH         256
+
+/* One frame of the stack being sampled */
+typedef struct sample_frame {
+    STRING   *name;     /* full name of the Sub */
+    STRING   *file;     /* source file of the current op */
+    INTVAL    line;     /* ... and its line */
+    PMC      *sub;
+} sample_frame;
+
+typedef struct Parrot_sampler {
+    Interp         *interp;             /* interpreter being sampled */
+    Parrot_thread   thread;             /* timer thread */
+    Parrot_mutex    lock;               /* protects the fields below */
+    Parrot_cond     wakeup;
+    int             running;
+    FLOATVAL        interval;           /* seconds between samples */
+
+    /* only used by the sampled interpreter, at sample points */
+    PMC            *stacks;             /* Hash of collapsed stack => count */
+    STRING         *filename;           /* where to write the stacks */
+    FILE           *pprof_fd;           /* pprof output, if any */
+    sample_frame   *frames;
+    UHUGEINTVAL     last_sample;        /* time of the previous sample */
+    INTVAL          samples;
+} Parrot_sampler;
+
+/* There is at most one sampler per process */
+static Parrot_sampler *sampler = NULL;
+
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+static void record_pprof_cli(PARROT_INTERP, ARGIN(Parrot_sampler *s))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void record_pprof_sample(PARROT_INTERP,
+    ARGIN(Parrot_sampler *s),
+    INTVAL depth,
+    ARGIN(const char *opname),
+    UHUGEINTVAL elapsed)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(4);
+
+static void sample_frame_info(PARROT_INTERP,
+    ARGIN(PMC *ctx),
+    ARGOUT(sample_frame *frame))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*frame);
+
+PARROT_CAN_RETURN_NULL
+static void* sampler_runloop(ARGIN(void *arg))
+        __attribute__nonnull__(1);
+
+static void take_sample(PARROT_INTERP,
+    ARGMOD(Parrot_sampler *s),
+    ARGIN(opcode_t *pc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*s);
+
+static void write_collapsed_stacks(PARROT_INTERP, ARGIN(Parrot_sampler *s))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+#define ASSERT_ARGS_record_pprof_cli __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(s))
+#define ASSERT_ARGS_record_pprof_sample __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(s) \
+    , PARROT_ASSERT_ARG(opname))
+#define ASSERT_ARGS_sample_frame_info __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(ctx) \
+    , PARROT_ASSERT_ARG(frame))
+#define ASSERT_ARGS_sampler_runloop __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(arg))
+#define ASSERT_ARGS_take_sample __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(s) \
+    , PARROT_ASSERT_ARG(pc))
+#define ASSERT_ARGS_write_collapsed_stacks __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(s))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+/*
+
+=item C<void Parrot_runcore_sampler_init(PARROT_INTERP)>
+
+Starts the sampling profiler for C<interp> if C<PARROT_SAMPLING_FILENAME> is
+set. C<PARROT_SAMPLING_FREQUENCY> gives the number of samples per second and
+C<PARROT_SAMPLING_PPROF> the name of a file to write samples to in pprof
+format. Thread interpreters are never sampled.
+
+=cut
+
+*/
+
+void
+Parrot_runcore_sampler_init(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_runcore_sampler_init)
+    STRING * const filename_var  = CONST_STRING(interp, "PARROT_SAMPLING_FILENAME");
+    STRING * const frequency_var = CONST_STRING(interp, "PARROT_SAMPLING_FREQUENCY");
+    STRING * const pprof_var     = CONST_STRING(interp, "PARROT_SAMPLING_PPROF");
+    STRING        *filename, *frequency;
+
+    /* only the main interpreter is sampled */
+    if (interp->parent_interpreter)
+        return;
+
+    filename = Parrot_getenv(interp, filename_var);
+
+    if (STRING_IS_NULL(filename))
+        return;
+
+    frequency = Parrot_getenv(interp, frequency_var);
+
+    Parrot_runcore_sampler_start(interp,
+        STRING_IS_NULL(frequency) ? 0 : Parrot_str_to_int(interp, frequency),
+        filename, Parrot_getenv(interp, pprof_var));
+}
+
+/*
+
+=item C<void Parrot_runcore_sampler_start(PARROT_INTERP, INTVAL frequency,
+STRING *filename, STRING *pprof_filename)>
+
+Starts sampling the call stack of C<interp> C<frequency> times per second, or
+at the default rate if C<frequency> is not positive. Collapsed stacks are
+written to C<filename> when the profiler is stopped; if C<pprof_filename> is
+not null, every sample is also written there in pprof format.
+
+Only one interpreter can be sampled at a time. Without thread support,
+nothing is sampled.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_runcore_sampler_start(PARROT_INTERP, INTVAL frequency,
+        ARGIN(STRING *filename), ARGIN_NULLOK(STRING *pprof_filename))
+{
+    ASSERT_ARGS(Parrot_runcore_sampler_start)
+#ifdef PARROT_HAS_THREADS
+    Parrot_sampler *s;
+
+    if (sampler)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "sampling profiler is already running");
+
+    if (frequency <= 0)
+        frequency = SAMPLER_DEFAULT_FREQUENCY;
+
+    s = mem_gc_allocate_zeroed_typed(interp, Parrot_sampler);
+
+    if (!STRING_IS_NULL(pprof_filename)) {
+        char * const pprof_cstr = Parrot_str_to_cstring(interp, pprof_filename);
+        s->pprof_fd = fopen(pprof_cstr, "w");
+        Parrot_str_free_cstring(pprof_cstr);
+
+        if (!s->pprof_fd) {
+            mem_gc_free(interp, s);
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_PIO_ERROR,
+                "unable to open %Ss for writing", pprof_filename);
+        }
+
+        fprintf(s->pprof_fd, "VERSION:2\n");
+    }
+
+    s->interp          = interp;
+    s->interval        = 1.0 / frequency;
+    s->running         = 1;
+    s->filename        = filename;
+    s->stacks          = Parrot_pmc_new(interp, enum_class_Hash);
+    s->frames          = mem_gc_allocate_n_typed(interp, SAMPLER_MAX_DEPTH,
+                            sample_frame);
+
+    Parrot_pmc_gc_register(interp, s->stacks);
+    Parrot_str_gc_register(interp, s->filename);
+
+    MUTEX_INIT(s->lock);
+    COND_INIT(s->wakeup);
+
+    s->last_sample = Parrot_hires_get_time();
+    sampler        = s;
+
+    THREAD_CREATE_JOINABLE(s->thread, sampler_runloop, s);
+#else
+    UNUSED(interp);
+    UNUSED(frequency);
+    UNUSED(filename);
+    UNUSED(pprof_filename);
+#endif
+}
+
+/*
+
+=item C<void Parrot_runcore_sampler_stop(PARROT_INTERP)>
+
+Stops the sampling profiler and writes the collected stacks to its output
+file. Does nothing if C<interp> is not being sampled.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_runcore_sampler_stop(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_runcore_sampler_stop)
+    Parrot_sampler * const s = sampler;
+    void *unused;
+
+    if (!s || s->interp != interp)
+        return;
+
+    LOCK(s->lock);
+    s->running = 0;
+    COND_SIGNAL(s->wakeup);
+    UNLOCK(s->lock);
+
+    JOIN(s->thread, unused);
+    UNUSED(unused);
+
+    interp->sample_requested = 0;
+    sampler                  = NULL;
+
+    write_collapsed_stacks(interp, s);
+
+    if (s->pprof_fd) {
+        record_pprof_cli(interp, s);
+        fclose(s->pprof_fd);
+    }
+
+    Parrot_pmc_gc_unregister(interp, s->stacks);
+    Parrot_str_gc_unregister(interp, s->filename);
+
+    COND_DESTROY(s->wakeup);
+    MUTEX_DESTROY(s->lock);
+
+    mem_gc_free(interp, s->frames);
+    mem_gc_free(interp, s);
+}
+
+/*
+
+=item C<static void* sampler_runloop(void *arg)>
+
+The timer thread. Every sampling interval, it asks the sampled interpreter
+for a sample at its next op. A request that has not been served yet, because
+the interpreter is blocked or inside a long op, is simply left standing.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+static void*
+sampler_runloop(ARGIN(void *arg))
+{
+    ASSERT_ARGS(sampler_runloop)
+    Parrot_sampler * const s = (Parrot_sampler *)arg;
+
+    LOCK(s->lock);
+
+    while (s->running) {
+        const FLOATVAL   when = Parrot_floatval_time() + s->interval;
+        struct timespec  ts;
+        int              rc   = 0;
+
+        ts.tv_sec  = (time_t)when;
+        ts.tv_nsec = (long)((when - ts.tv_sec) * 1000000000.0);
+
+        while (s->running && rc == 0)
+            COND_TIMED_WAIT(s->wakeup, s->lock, &ts, rc);
+
+        if (s->running)
+            s->interp->sample_requested = 1;
+    }
+
+    UNLOCK(s->lock);
+
+    return NULL;
+}
+
+/*
+
+=item C<void Parrot_runcore_sampler_sample(PARROT_INTERP, opcode_t *pc)>
+
+The sample point, called by the runcores before dispatching the op at C<pc>
+whenever C<interp-E<gt>sample_requested> is set. Clears the request and
+records the call stack of C<interp>.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_runcore_sampler_sample(PARROT_INTERP, ARGIN(opcode_t *pc))
+{
+    ASSERT_ARGS(Parrot_runcore_sampler_sample)
+    Parrot_sampler * const s = sampler;
+
+    interp->sample_requested = 0;
+
+    if (s && s->interp == interp)
+        take_sample(interp, s, pc);
+}
+
+/*
+
+=item C<static void take_sample(PARROT_INTERP, Parrot_sampler *s, opcode_t *pc)>
+
+Records the call stack of C<interp>, which is about to run the op at C<pc>.
+
+=cut
+
+*/
+
+static void
+take_sample(PARROT_INTERP, ARGMOD(Parrot_sampler *s), ARGIN(opcode_t *pc))
+{
+    ASSERT_ARGS(take_sample)
+    STRING * const     frame_sep = CONST_STRING(interp, ";");
+    const UHUGEINTVAL  now       = Parrot_hires_get_time();
+    PMC               *ctx       = CURRENT_CONTEXT(interp);
+    STRING            *stack     = NULL;
+    INTVAL             depth     = 0;
+    INTVAL             i;
+
+    /* the frames are only referenced from C memory until the stack is
+     * stored */
+    Parrot_block_GC_mark(interp);
+
+    Parrot_pcc_set_pc(interp, ctx, pc);
+
+    for (; !PMC_IS_NULL(ctx) && depth < SAMPLER_MAX_DEPTH;
+           ctx = Parrot_pcc_get_caller_ctx(interp, ctx)) {
+        if (PMC_IS_NULL(Parrot_pcc_get_sub(interp, ctx)))
+            continue;
+        sample_frame_info(interp, ctx, &s->frames[depth++]);
+    }
+
+    for (i = depth - 1; i >= 0; --i) {
+        const sample_frame * const frame = &s->frames[i];
+        STRING * const label = Parrot_sprintf_c(interp, "%Ss (%Ss:%d)",
+                                    frame->name, frame->file, (int)frame->line);
+
+        stack = stack ? Parrot_str_concat(interp,
+                            Parrot_str_concat(interp, stack, frame_sep), label)
+                      : label;
+    }
+
+    if (stack) {
+        VTABLE_set_integer_keyed_str(interp, s->stacks, stack,
+            VTABLE_get_integer_keyed_str(interp, s->stacks, stack) + 1);
+
+        if (s->pprof_fd)
+            record_pprof_sample(interp, s, depth,
+                interp->code->op_info_table[*pc]->name, now - s->last_sample);
+
+        ++s->samples;
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    s->last_sample = now;
+}
+
+/*
+
+=item C<static void sample_frame_info(PARROT_INTERP, PMC *ctx, sample_frame
+*frame)>
+
+Fills in C<frame> for the context C<ctx>. Semicolons in the Sub name are
+turned into C<::>, since collapsed stacks use them to separate frames.
+
+=cut
+
+*/
+
+static void
+sample_frame_info(PARROT_INTERP, ARGIN(PMC *ctx), ARGOUT(sample_frame *frame))
+{
+    ASSERT_ARGS(sample_frame_info)
+    STRING * const       semicolon = CONST_STRING(interp, ";");
+    STRING * const       ns_sep    = CONST_STRING(interp, "::");
+    PMC    * const       sub       = Parrot_pcc_get_sub(interp, ctx);
+    Parrot_Context_info  info;
+
+    Parrot_sub_context_get_info(interp, ctx, &info);
+
+    frame->sub  = sub;
+    frame->file = info.file ? info.file : CONST_STRING(interp, "(unknown file)");
+    frame->line = info.line;
+    frame->name = info.fullname ? info.fullname : CONST_STRING(interp, "???");
+
+    if (STRING_index(interp, frame->name, semicolon, 0) >= 0)
+        frame->name = Parrot_str_join(interp, ns_sep,
+                        Parrot_str_split(interp, semicolon, frame->name));
+
+    if (info.pc >= 0 && VTABLE_isa(interp, sub, CONST_STRING(interp, "Sub"))) {
+        PackFile_ByteCode * const seg = PARROT_SUB(sub)->seg;
+
+        if (seg && seg->annotations) {
+            STRING * const file_key = CONST_STRING(interp, "file");
+            STRING * const line_key = CONST_STRING(interp, "line");
+            PMC    * const file     = PackFile_Annotations_lookup(interp,
+                                        seg->annotations, info.pc, file_key);
+            PMC    * const line     = PackFile_Annotations_lookup(interp,
+                                        seg->annotations, info.pc, line_key);
+
+            if (!PMC_IS_NULL(file))
+                frame->file = VTABLE_get_string(interp, file);
+            if (!PMC_IS_NULL(line))
+                frame->line = VTABLE_get_integer(interp, line);
+        }
+    }
+}
+
+/*
+
+=item C<static void record_pprof_sample(PARROT_INTERP, Parrot_sampler *s, INTVAL
+depth, const char *opname, UHUGEINTVAL elapsed)>
+
+Writes the sample just taken to the pprof file, as a chain of context
+switches from the outermost frame down, ending in the op C<opname>, which is
+charged with the C<elapsed> nanoseconds since the previous sample. Each
+sample is closed as a runloop of its own, so F<pprof2cg.pl> starts the next
+one from an empty stack.
+
+=cut
+
+*/
+
+static void
+record_pprof_sample(PARROT_INTERP, ARGIN(Parrot_sampler *s), INTVAL depth,
+        ARGIN(const char *opname), UHUGEINTVAL elapsed)
+{
+    ASSERT_ARGS(record_pprof_sample)
+    INTVAL i;
+
+    for (i = depth - 1; i >= 0; --i) {
+        const sample_frame * const frame = &s->frames[i];
+        char * const name = Parrot_str_to_cstring(interp, frame->name);
+        char * const file = Parrot_str_to_cstring(interp, frame->file);
+
+        /* the depth identifies the context within a sample */
+        fprintf(s->pprof_fd,
+            "CS:{x{ns:%s}x}{x{file:%s}x}{x{sub:%p}x}{x{ctx:0x%lx}x}\n",
+            name, file, (void *)frame->sub, (unsigned long)(depth - i));
+
+        if (i > 0)
+            fprintf(s->pprof_fd, "OP:{x{line:%d}x}{x{time:0}x}{x{op:invoke}x}\n",
+                (int)frame->line);
+        else
+            fprintf(s->pprof_fd, "OP:{x{line:%d}x}{x{time:%lu}x}{x{op:%s}x}\n",
+                (int)frame->line, (unsigned long)elapsed, opname);
+
+        Parrot_str_free_cstring(name);
+        Parrot_str_free_cstring(file);
+    }
+
+    fprintf(s->pprof_fd, "END_OF_RUNLOOP:1\n");
+}
+
+/*
+
+=item C<static void record_pprof_cli(PARROT_INTERP, Parrot_sampler *s)>
+
+Writes the command line of the program to the pprof file.
+
+=cut
+
+*/
+
+static void
+record_pprof_cli(PARROT_INTERP, ARGIN(Parrot_sampler *s))
+{
+    ASSERT_ARGS(record_pprof_cli)
+    PMC * const argv     = VTABLE_get_pmc_keyed_int(interp, interp->iglobals,
+                                IGLOBALS_ARGV_LIST);
+    PMC * const exe_name = VTABLE_get_pmc_keyed_int(interp, interp->iglobals,
+                                IGLOBALS_EXECUTABLE);
+    STRING * const space    = CONST_STRING(interp, " ");
+    STRING        *cli      = CONST_STRING(interp, "parrot");
+    char          *cli_cstr;
+
+    if (!PMC_IS_NULL(exe_name))
+        cli = VTABLE_get_string(interp, exe_name);
+
+    if (!PMC_IS_NULL(argv))
+        cli = Parrot_sprintf_c(interp, "%Ss %Ss", cli,
+                Parrot_str_join(interp, space, argv));
+
+    cli_cstr = Parrot_str_to_cstring(interp, cli);
+    fprintf(s->pprof_fd, "CLI: %s\n", cli_cstr);
+    Parrot_str_free_cstring(cli_cstr);
+}
+
+/*
+
+=item C<static void write_collapsed_stacks(PARROT_INTERP, Parrot_sampler *s)>
+
+Writes every stack sampled, with the number of times it was seen, to the
+output file of the sampler.
+
+=cut
+
+*/
+
+static void
+write_collapsed_stacks(PARROT_INTERP, ARGIN(Parrot_sampler *s))
+{
+    ASSERT_ARGS(write_collapsed_stacks)
+    char * const filename = Parrot_str_to_cstring(interp, s->filename);
+    FILE * const out      = fopen(filename, "w");
+    Hash * const stacks   = (Hash *)VTABLE_get_pointer(interp, s->stacks);
+
+    if (!out) {
+        fprintf(stderr, "SAMPLING PROFILER: unable to open %s for writing\n",
+            filename);
+        Parrot_str_free_cstring(filename);
+        return;
+    }
+
+    parrot_hash_iterate(stacks,
+        char * const stack = Parrot_str_to_cstring(interp,
+                                (STRING *)_bucket->key);
+        fprintf(out, "%s %ld\n", stack,
+            (long)VTABLE_get_integer(interp, (PMC *)_bucket->value));
+        Parrot_str_free_cstring(stack););
+
+    fclose(out);
+    Parrot_str_free_cstring(filename);
+}
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<src/runcore/profiling.c>, F<tools/dev/pprof2cg.pl>,
+F<docs/dev/profiling.pod>.
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -37,11 +37,28 @@ exceptions, async I/O, and concurrent tasks (threads).
 /* HEADERIZER BEGIN: static */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
+PARROT_WARN_UNUSED_RESULT
+static int Parrot_cx_is_task(PARROT_INTERP, ARGIN(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 static int Parrot_cx_preemption_enabled(PARROT_INTERP)
         __attribute__nonnull__(1);
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static PMC * Parrot_cx_task_from_pmc(PARROT_INTERP, ARGIN(PMC *task_or_sub))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+#define ASSERT_ARGS_Parrot_cx_is_task __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmc))
 #define ASSERT_ARGS_Parrot_cx_preemption_enabled __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_cx_task_from_pmc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(task_or_sub))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
@@ -217,7 +234,7 @@ Parrot_cx_next_task(PARROT_INTERP, ARGIN(PMC *scheduler))
 
     interp->cur_task = task;
 
-    if (!VTABLE_isa(interp, task, CONST_STRING(interp, "Task")))
+    if (!Parrot_cx_is_task(interp, task))
         Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
             "Found a non-Task in the task queue.\n");
 
@@ -256,6 +273,12 @@ Parrot_cx_check_scheduler(PARROT_INTERP, ARGIN(opcode_t *next))
         return Parrot_cx_run_scheduler(interp, scheduler, next);
     }
 
+    /* Green threads count their quantum in branches instead of time */
+    if (interp->quantum_ticks && !--interp->quantum_ticks) {
+        SCHEDULER_resched_requested_SET(scheduler);
+        return Parrot_cx_run_scheduler(interp, scheduler, next);
+    }
+
     return next;
 }
 
@@ -293,7 +316,7 @@ Parrot_cx_run_scheduler(PARROT_INTERP, ARGIN(PMC *scheduler), ARGIN(opcode_t *ne
 
     /* Some alarm seems to have fired, but not the scheduler's.
      * Re-set the scheduler alarm */
-    if (Parrot_cx_preemption_enabled(interp))
+    if (Parrot_cx_preemption_enabled(interp) && !SCHEDULER_green_threads_TEST(scheduler))
         Parrot_alarm_set(interp->quantum_done);
 
     return next;
@@ -315,8 +338,8 @@ Parrot_cx_check_quantum(PARROT_INTERP, ARGIN(PMC *scheduler))
     ASSERT_ARGS(Parrot_cx_check_quantum)
 
     /* If we are using preemption, check the current time and possibly
-       schedule the next preemption */
-    if (Parrot_cx_preemption_enabled(interp)) {
+       schedule the next preemption. Green threads use quantum_ticks. */
+    if (Parrot_cx_preemption_enabled(interp) && !SCHEDULER_green_threads_TEST(scheduler)) {
         const FLOATVAL time_now = Parrot_floatval_time();
         if (time_now >= interp->quantum_done)
             SCHEDULER_resched_requested_SET(scheduler);
@@ -345,9 +368,7 @@ Parrot_cx_stop_task(PARROT_INTERP, ARGIN(opcode_t *next))
 
     VTABLE_set_pointer(interp, cont, next);
 
-    /* TODO: This check seems expensive. Do we need to have this active at all
-       times, or can we make this conditional on NDEBUG? */
-    if (PMC_IS_NULL(task) || !VTABLE_isa(interp, task, CONST_STRING(interp, "Task")))
+    if (PMC_IS_NULL(task) || !Parrot_cx_is_task(interp, task))
         Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
             "Attempt to stop invalid interp->current_task.\n");
 
@@ -364,7 +385,8 @@ Parrot_cx_stop_task(PARROT_INTERP, ARGIN(opcode_t *next))
 *next)>
 
 Pre-empt the current task. It goes on the foot of the task queue,
-and then we jump all the way back to the task scheduling loop.
+and then we jump all the way back to the task scheduling loop, or with green
+threads straight to the next task.
 
 =cut
 
@@ -378,7 +400,95 @@ Parrot_cx_preempt_task(PARROT_INTERP, ARGIN(PMC *scheduler), ARGIN(opcode_t *nex
     PMC * const task = Parrot_cx_stop_task(interp, next);
     VTABLE_push_pmc(interp, scheduler, task);
 
-    return (opcode_t*)NULL;
+    return Parrot_cx_switch_task(interp, scheduler);
+}
+
+/*
+
+=item C<opcode_t* Parrot_cx_switch_task(PARROT_INTERP, PMC *scheduler)>
+
+Called by ops that have just stopped the current task. With green threads,
+the task at the head of the queue is resumed or started inside the current
+runloop and the address to continue at is returned.
+
+Returns NULL, which ends the runloop and leaves the choice to
+C<Parrot_cx_outer_runloop>, without green threads, in a nested runloop, when
+the queue is empty, and for killed tasks or subclasses of Task, which need
+the full C<invoke> of their class.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
+opcode_t*
+Parrot_cx_switch_task(PARROT_INTERP, ARGIN(PMC *scheduler))
+{
+    ASSERT_ARGS(Parrot_cx_switch_task)
+    PMC                    *task, *call_object, *ret_cont;
+    Parrot_Task_attributes *tdata;
+
+    if (!SCHEDULER_green_threads_TEST(scheduler)
+    ||   interp->current_runloop_level > 1
+    ||   VTABLE_get_integer(interp, scheduler) == 0)
+        return (opcode_t*)NULL;
+
+    task = VTABLE_shift_pmc(interp, scheduler);
+
+    if (task->vtable->base_type != enum_class_Task || PARROT_TASK(task)->killed) {
+        VTABLE_unshift_pmc(interp, scheduler, task);
+        return (opcode_t*)NULL;
+    }
+
+    tdata            = PARROT_TASK(task);
+    interp->cur_task = task;
+
+    if (VTABLE_get_integer(interp, scheduler) > 0)
+        Parrot_cx_enable_preemption(interp);
+    else
+        Parrot_cx_disable_preemption(interp);
+
+    /* A stopped task carries the Continuation it stopped at */
+    if (TASK_in_preempt_TEST(task)) {
+        TASK_in_preempt_CLEAR(task);
+        return VTABLE_invoke(interp, tdata->code, NULL);
+    }
+
+    /* A new task is called like Parrot_ext_call would, but in this runloop.
+     * Its return continuation has no address, so the runloop ends when the
+     * task does, and the Task invoke that entered the runloop retires it. */
+    call_object = Parrot_pcc_build_call_from_c_args(interp, PMCNULL, "P", tdata->data);
+    ret_cont    = Parrot_pmc_new(interp, enum_class_Continuation);
+
+    Parrot_cx_activate_task(interp, task);
+    Parrot_pcc_set_signature(interp, CURRENT_CONTEXT(interp), call_object);
+    PARROT_CONTINUATION(ret_cont)->from_ctx = call_object;
+    Parrot_pcc_set_continuation(interp, call_object, ret_cont);
+    interp->current_cont = ret_cont;
+
+    return VTABLE_invoke(interp, tdata->code, NULL);
+}
+
+/*
+
+=item C<void Parrot_cx_activate_task(PARROT_INTERP, PMC *task)>
+
+Adds C<task> to the scheduler's set of active tasks when it starts running.
+
+=cut
+
+*/
+
+void
+Parrot_cx_activate_task(PARROT_INTERP, ARGIN(PMC *task))
+{
+    ASSERT_ARGS(Parrot_cx_activate_task)
+    PMC * const task_id = Parrot_pmc_new(interp, enum_class_Integer);
+
+    VTABLE_set_integer_native(interp, task_id, PARROT_TASK(task)->id);
+    VTABLE_set_pmc_keyed(interp, PARROT_SCHEDULER(interp->scheduler)->all_tasks, task_id, task);
+    TASK_active_SET(task);
 }
 
 /*
@@ -419,26 +529,22 @@ void
 Parrot_cx_schedule_task(PARROT_INTERP, ARGIN(PMC *task_or_sub))
 {
     ASSERT_ARGS(Parrot_cx_schedule_task)
-    PMC * task = PMCNULL;
+    PMC * task;
     int index;
 
     if (!interp->scheduler)
         Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
             "Scheduler was not initialized for this interpreter.\n");
 
-    /* TODO: Can we do anything less expensive than an ISA check here? */
-    if (VTABLE_isa(interp, task_or_sub, CONST_STRING(interp, "Task")))
-        task = task_or_sub;
-    else if (VTABLE_isa(interp, task_or_sub, CONST_STRING(interp, "Sub"))) {
-        Parrot_Task_attributes *tdata;
-        task  = Parrot_pmc_new(interp, enum_class_Task);
-        tdata = PARROT_TASK(task);
-        tdata->code = task_or_sub;
-        PARROT_GC_WRITE_BARRIER(interp, task);
+    task = Parrot_cx_task_from_pmc(interp, task_or_sub);
+
+    /* Green threads all run on this thread */
+    if (SCHEDULER_green_threads_TEST(interp->scheduler)) {
+        VTABLE_push_pmc(interp, interp->scheduler, task);
+        if (VTABLE_get_integer(interp, interp->scheduler) == 1)
+            Parrot_cx_enable_preemption(interp);
+        return;
     }
-    else
-        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
-            "Can only schedule Tasks and Subs.\n");
 
 #ifdef PARROT_HAS_THREADS
     /* Search for a thread that is free. If we have a free thread, schedule
@@ -506,21 +612,7 @@ void
 Parrot_cx_schedule_immediate(PARROT_INTERP, ARGIN(PMC *task_or_sub))
 {
     ASSERT_ARGS(Parrot_cx_schedule_immediate)
-    PMC *task;
-
-    /* TODO: Can we do something less expensive than ISA? */
-    if (VTABLE_isa(interp, task_or_sub, CONST_STRING(interp, "Task")))
-        task = task_or_sub;
-    else if (VTABLE_isa(interp, task_or_sub, CONST_STRING(interp, "Sub"))) {
-        Parrot_Task_attributes *tdata;
-        task  = Parrot_pmc_new(interp, enum_class_Task);
-        tdata = PARROT_TASK(task);
-        tdata->code = task_or_sub;
-        PARROT_GC_WRITE_BARRIER(interp, task);
-    }
-    else
-        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
-            "Can only schedule Tasks and Subs.\n");
+    PMC * const task = Parrot_cx_task_from_pmc(interp, task_or_sub);
 
     VTABLE_unshift_pmc(interp, interp->scheduler, task);
     SCHEDULER_wake_requested_SET(interp->scheduler);
@@ -687,7 +779,7 @@ Parrot_cx_schedule_sleep(PARROT_INTERP, FLOATVAL time, ARGIN_NULLOK(opcode_t *ne
     PARROT_GC_WRITE_BARRIER(interp, alarm);
     (void) VTABLE_invoke(interp, alarm, NULL);
 
-    return (opcode_t*) NULL;
+    return Parrot_cx_switch_task(interp, interp->scheduler);
 }
 
 /*
@@ -715,7 +807,11 @@ Parrot_cx_enable_preemption(PARROT_INTERP)
 
     PMC * const scheduler = interp->scheduler;
     SCHEDULER_enable_preemption_SET(scheduler);
-    Parrot_cx_set_scheduler_alarm(interp);
+
+    if (SCHEDULER_green_threads_TEST(scheduler))
+        interp->quantum_ticks = PARROT_TASK_SWITCH_TICKS;
+    else
+        Parrot_cx_set_scheduler_alarm(interp);
 }
 
 /*
@@ -735,6 +831,41 @@ Parrot_cx_disable_preemption(PARROT_INTERP)
 
     PMC * const scheduler = interp->scheduler;
     SCHEDULER_enable_preemption_CLEAR(scheduler);
+    interp->quantum_ticks = 0;
+}
+
+/*
+
+=item C<void Parrot_cx_set_green_threads(PARROT_INTERP, INTVAL enable)>
+
+Turns green threads on or off. Green threads are Tasks that are all run on
+the current thread; switching between them resumes the next task's
+continuation inside the current runloop, and their quantum is a number of
+branches (C<PARROT_TASK_SWITCH_TICKS>) rather than a timer: every C<branch>
+op, and every taken backward conditional branch, so that a task spinning on
+C<if> or C<unless> is preempted too.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_cx_set_green_threads(PARROT_INTERP, INTVAL enable)
+{
+    ASSERT_ARGS(Parrot_cx_set_green_threads)
+
+    PMC * const scheduler = interp->scheduler;
+
+    if (enable)
+        SCHEDULER_green_threads_SET(scheduler);
+    else
+        SCHEDULER_green_threads_CLEAR(scheduler);
+
+    if (Parrot_cx_preemption_enabled(interp))
+        Parrot_cx_enable_preemption(interp);
+    else
+        interp->quantum_ticks = 0;
 }
 
 /*
@@ -758,6 +889,65 @@ Parrot_cx_preemption_enabled(PARROT_INTERP)
 
 /*
 
+=item C<static int Parrot_cx_is_task(PARROT_INTERP, PMC *pmc)>
+
+Checks whether C<pmc> is a Task, looking at its type before asking C<isa>.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+Parrot_cx_is_task(PARROT_INTERP, ARGIN(PMC *pmc))
+{
+    ASSERT_ARGS(Parrot_cx_is_task)
+
+    if (pmc->vtable->base_type == enum_class_Task)
+        return 1;
+
+    return VTABLE_isa(interp, pmc, CONST_STRING(interp, "Task"));
+}
+
+/*
+
+=item C<static PMC * Parrot_cx_task_from_pmc(PARROT_INTERP, PMC *task_or_sub)>
+
+Returns C<task_or_sub> if it is a Task, or a new Task running it if it is a
+Sub.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static PMC *
+Parrot_cx_task_from_pmc(PARROT_INTERP, ARGIN(PMC *task_or_sub))
+{
+    ASSERT_ARGS(Parrot_cx_task_from_pmc)
+    const INTVAL type = task_or_sub->vtable->base_type;
+    PMC         *task;
+
+    if (type == enum_class_Task)
+        return task_or_sub;
+
+    if (type != enum_class_Sub && VTABLE_isa(interp, task_or_sub, CONST_STRING(interp, "Task")))
+        return task_or_sub;
+
+    if (type != enum_class_Sub && !VTABLE_isa(interp, task_or_sub, CONST_STRING(interp, "Sub")))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "Can only schedule Tasks and Subs.\n");
+
+    task = Parrot_pmc_new(interp, enum_class_Task);
+    PARROT_TASK(task)->code = task_or_sub;
+    PARROT_GC_WRITE_BARRIER(interp, task);
+
+    return task;
+}
+
+/*
+
 =back
 
 =head1 SEE ALSO
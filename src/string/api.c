@@ -27,6 +27,8 @@ members, beside setting C<bufstart>/C<buflen> for external strings.
 #include "parrot/parrot.h"
 #include "parrot/events.h"
 #include "private_cstring.h"
+#include "spf_private.h"
+#include "pmc/pmc_stringbuilder.h"
 #include "api.str"
 
 /* for parrot/interpreter.h */
@@ -42,6 +44,28 @@ STRING *STRINGNULL;
 /* HEADERIZER BEGIN: static */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
+PARROT_WARN_UNUSED_RESULT
+static FLOATVAL str_to_num_slow(PARROT_INTERP,
+    ARGIN(const STRING *s),
+    INTVAL digits,
+    INTVAL exponent)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_PURE_FUNCTION
+static UINTVAL string_byte_chars(
+    ARGIN(const STRING *s),
+    UINTVAL from,
+    UINTVAL to)
+        __attribute__nonnull__(1);
+
+PARROT_PURE_FUNCTION
+static int string_byte_searchable(
+    ARGIN(const STRING *src),
+    ARGIN(const STRING *search))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_PURE_FUNCTION
 static INTVAL string_max_bytes(PARROT_INTERP,
@@ -73,6 +97,14 @@ static void throw_illegal_escape_char(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(3);
 
+#define ASSERT_ARGS_str_to_num_slow __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(s))
+#define ASSERT_ARGS_string_byte_chars __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(s))
+#define ASSERT_ARGS_string_byte_searchable __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(src) \
+    , PARROT_ASSERT_ARG(search))
 #define ASSERT_ARGS_string_max_bytes __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(s))
 #define ASSERT_ARGS_string_rep_compatible __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -93,6 +125,9 @@ static void throw_illegal_escape_char(PARROT_INTERP,
 */
 #define HEX_BUF_SIZE 16
 
+/* Parts of a join shorter than this are copied rather than referenced */
+#define JOIN_CHUNK_MIN_BYTES 16
+
 /*
 
 =item C<INTVAL Parrot_str_is_null(PARROT_INTERP, const STRING *s)>
@@ -150,6 +185,11 @@ Parrot_str_init(PARROT_INTERP)
         interp->hash_seed = Parrot_get_entropy(interp);
     }
 
+    /* interned strings are collectable, so each interpreter has its own */
+    interp->intern_hash = Parrot_hash_create(interp,
+                                enum_type_ptr,
+                                Hash_key_type_STRING_enc);
+
     /* initialize the constant string table */
     if (interp->parent_interpreter) {
         interp->const_cstring_table =
@@ -207,6 +247,9 @@ Parrot_str_finish(PARROT_INTERP)
 {
     ASSERT_ARGS(Parrot_str_finish)
 
+    Parrot_hash_destroy(interp, interp->intern_hash);
+    interp->intern_hash = NULL;
+
     /* all are shared between interpreters */
     if (!interp->parent_interpreter) {
         mem_internal_free(interp->const_cstring_table);
@@ -424,6 +467,9 @@ Parrot_str_copy(PARROT_INTERP, ARGIN_NULLOK(const STRING *s))
     /* Clear live flag. It might be set on constant strings */
     PObj_live_CLEAR(d);
 
+    /* Only the original is in the intern table */
+    STRING_interned_CLEAR(d);
+
     /* Set the string copy flag */
     PObj_is_string_copy_SET(d);
 
@@ -652,6 +698,106 @@ Parrot_str_new_constant(PARROT_INTERP, ARGIN(const char *buffer))
 
 /*
 
+=item C<STRING * Parrot_str_intern(PARROT_INTERP, STRING *s)>
+
+Returns the interned string with the same contents and encoding as C<s>,
+entering C<s> in the intern table if there is none yet. Interned strings can
+be compared by address.
+
+The table doesn't keep collectable strings alive: the GC removes them when
+they die. A constant string replaces a collectable one, so that interning a
+constant always returns a constant.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+STRING *
+Parrot_str_intern(PARROT_INTERP, ARGIN(STRING *s))
+{
+    ASSERT_ARGS(Parrot_str_intern)
+    Hash       * const table = interp->intern_hash;
+    HashBucket *bucket;
+
+    if (STRING_IS_NULL(s))
+        return s;
+
+    bucket = Parrot_hash_get_bucket(interp, table, s);
+
+    if (bucket) {
+        STRING * const interned = (STRING *)bucket->value;
+
+        if (PObj_constant_TEST(interned) || !PObj_constant_TEST(s))
+            return interned;
+
+        /* Same contents, so the bucket stays in its chain */
+        STRING_interned_CLEAR(interned);
+        bucket->key   = s;
+        bucket->value = s;
+    }
+    else
+        Parrot_hash_put(interp, table, s, s);
+
+    STRING_interned_SET(s);
+    return s;
+}
+
+/*
+
+=item C<STRING * Parrot_str_find_interned(PARROT_INTERP, const STRING *s)>
+
+Returns the interned string with the same contents and encoding as C<s>, or
+NULL if there is none. Unlike C<Parrot_str_intern> this never adds C<s>.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+STRING *
+Parrot_str_find_interned(PARROT_INTERP, ARGIN(const STRING *s))
+{
+    ASSERT_ARGS(Parrot_str_find_interned)
+    const HashBucket * const bucket =
+        Parrot_hash_get_bucket(interp, interp->intern_hash, s);
+
+    return bucket ? (STRING *)bucket->value : NULL;
+}
+
+/*
+
+=item C<void Parrot_str_intern_forget(PARROT_INTERP, STRING *s)>
+
+Removes the dying string C<s> from the intern table if it is the interned
+one. Called by the GC before freeing strings flagged as interned.
+
+=cut
+
+*/
+
+void
+Parrot_str_intern_forget(PARROT_INTERP, ARGIN(STRING *s))
+{
+    ASSERT_ARGS(Parrot_str_intern_forget)
+    Hash * const table = interp->intern_hash;
+
+    if (table) {
+        const HashBucket * const bucket = Parrot_hash_get_bucket(interp, table, s);
+
+        if (bucket && bucket->value == s)
+            Parrot_hash_delete(interp, table, s);
+    }
+
+    STRING_interned_CLEAR(s);
+}
+
+/*
+
 =item C<STRING * Parrot_str_new_init(PARROT_INTERP, const char *buffer, UINTVAL
 len, const STR_VTABLE *encoding, UINTVAL flags)>
 
@@ -1138,19 +1284,58 @@ Parrot_str_iter_substr(PARROT_INTERP,
     ARGIN(const String_iter *l), ARGIN_NULLOK(const String_iter *r))
 {
     ASSERT_ARGS(Parrot_str_iter_substr)
-    STRING * const dest = Parrot_str_copy(interp, str);
 
-    dest->strstart += l->bytepos;
+    if (r == NULL)
+        return Parrot_str_new_slice(interp, str, l->bytepos,
+                str->bufused - l->bytepos, str->strlen - l->charpos);
+
+    return Parrot_str_new_slice(interp, str, l->bytepos,
+            r->bytepos - l->bytepos, r->charpos - l->charpos);
+}
+
+/*
+
+=item C<STRING * Parrot_str_new_slice(PARROT_INTERP, const STRING *src, UINTVAL
+offset, UINTVAL bytes, UINTVAL chars)>
 
-    if (r == NULL) {
-        dest->bufused = str->bufused - l->bytepos;
-        dest->strlen  = str->strlen  - l->charpos;
+Returns the C<chars> characters in the C<bytes> bytes at byte C<offset> of
+C<src>. The substr implementations all end up here.
+
+A slice which is large relative to the buffer of C<src> shares it, as COW.
+A small slice of a big movable buffer gets a copy of its bytes instead (see
+C<STRING_slice_pins>), so that keeping a token doesn't keep the whole input
+it was parsed from alive.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+STRING *
+Parrot_str_new_slice(PARROT_INTERP, ARGIN(const STRING *src),
+        UINTVAL offset, UINTVAL bytes, UINTVAL chars)
+{
+    ASSERT_ARGS(Parrot_str_new_slice)
+    STRING *dest;
+
+    if (PObj_is_movable_TESTALL(src)
+    &&  STRING_slice_pins(bytes, Buffer_buflen(src))) {
+        dest           = Parrot_gc_new_string_header(interp, 0);
+        dest->encoding = src->encoding;
+        Parrot_gc_allocate_string_storage(interp, dest, bytes);
+
+        /* allocating may have compacted the pool, so find src afterwards */
+        memcpy(dest->strstart, src->strstart + offset, bytes);
     }
     else {
-        dest->bufused = r->bytepos - l->bytepos;
-        dest->strlen  = r->charpos - l->charpos;
+        dest            = Parrot_str_copy(interp, src);
+        dest->strstart += offset;
     }
 
+    dest->bufused = bytes;
+    dest->strlen  = chars;
     dest->hashval = 0;
 
     return dest;
@@ -1158,6 +1343,75 @@ Parrot_str_iter_substr(PARROT_INTERP,
 
 /*
 
+=item C<static int string_byte_searchable(const STRING *src, const STRING
+*search)>
+
+Returns true if C<search> can be looked for in C<src> byte by byte: that
+is, if the two strings spell equal characters with equal bytes, and a byte
+match that starts on a character boundary of C<src> is a character match.
+That holds for any two single byte encodings, for a fixed width or UTF-8
+string and another in the same encoding, and between ASCII and UTF-8.
+
+=cut
+
+*/
+
+PARROT_PURE_FUNCTION
+static int
+string_byte_searchable(ARGIN(const STRING *src), ARGIN(const STRING *search))
+{
+    ASSERT_ARGS(string_byte_searchable)
+    const STR_VTABLE * const enc = src->encoding;
+
+    if (enc == search->encoding)
+        return enc->bytes_per_unit == enc->max_bytes_per_codepoint
+            || enc == Parrot_utf8_encoding_ptr;
+
+    if (enc->max_bytes_per_codepoint == 1
+    &&  STRING_max_bytes_per_codepoint(search) == 1)
+        return 1;
+
+    return (enc == Parrot_utf8_encoding_ptr && search->encoding == Parrot_ascii_encoding_ptr)
+        || (enc == Parrot_ascii_encoding_ptr && search->encoding == Parrot_utf8_encoding_ptr);
+}
+
+/*
+
+=item C<static UINTVAL string_byte_chars(const STRING *s, UINTVAL from, UINTVAL
+to)>
+
+Returns the number of characters between the byte positions C<from> and
+C<to> of C<s>, which is fixed width or UTF-8.  UTF-8 characters are counted
+by their lead bytes, without decoding them.
+
+=cut
+
+*/
+
+PARROT_PURE_FUNCTION
+static UINTVAL
+string_byte_chars(ARGIN(const STRING *s), UINTVAL from, UINTVAL to)
+{
+    ASSERT_ARGS(string_byte_chars)
+    const STR_VTABLE * const   enc = s->encoding;
+    const unsigned char       *p;
+    const unsigned char       *end;
+    UINTVAL                    chars = 0;
+
+    if (enc->bytes_per_unit == enc->max_bytes_per_codepoint)
+        return (to - from) / enc->bytes_per_unit;
+
+    p   = (const unsigned char *)s->strstart + from;
+    end = (const unsigned char *)s->strstart + to;
+
+    while (p < end)
+        chars += (*p++ & 0xC0) != 0x80;
+
+    return chars;
+}
+
+/*
+
 =item C<INTVAL Parrot_str_iter_index(PARROT_INTERP, const STRING *src,
 String_iter *start, String_iter *end, const STRING *search)>
 
@@ -1167,6 +1421,10 @@ beginning of C<search> and String_iter C<end> is set to the character after
 C<search> in C<src>.  Returns the character position where C<search> was found
 or -1 if it wasn't found.
 
+Where the representations allow (see C<string_byte_searchable>) the search
+runs over the bytes with C<Parrot_util_memmem>, and the character position is
+worked out only for the match.
+
 =cut
 
 */
@@ -1187,6 +1445,31 @@ Parrot_str_iter_index(PARROT_INTERP,
         return start->charpos;
     }
 
+    if (string_byte_searchable(src, search)) {
+        const UINTVAL unit = src->encoding->bytes_per_unit;
+        UINTVAL       from = start->bytepos;
+        UINTVAL       pos;
+
+        do {
+            const char * const found = from > src->bufused ? NULL
+                : Parrot_util_memmem(src->strstart + from, src->bufused - from,
+                        search->strstart, search->bufused);
+
+            if (!found)
+                return -1;
+
+            pos  = found - src->strstart;
+            from = pos + 1;
+        } while (pos % unit);
+
+        start->charpos += string_byte_chars(src, start->bytepos, pos);
+        start->bytepos  = pos;
+        end->charpos    = start->charpos + len;
+        end->bytepos    = pos + search->bufused;
+
+        return start->charpos;
+    }
+
     STRING_ITER_INIT(interp, &search_iter);
     c0 = STRING_iter_get_and_advance(interp, search, &search_iter);
     search_start = search_iter;
@@ -1215,6 +1498,91 @@ Parrot_str_iter_index(PARROT_INTERP,
     return -1;
 }
 
+/*
+
+=item C<INTVAL Parrot_str_iter_rindex(PARROT_INTERP, const STRING *src,
+String_iter *start, String_iter *end, const STRING *search)>
+
+Like C<Parrot_str_iter_index>, but finds the last occurrence of C<search> in
+C<src> that begins at or before String_iter C<start>.
+
+=cut
+
+*/
+
+INTVAL
+Parrot_str_iter_rindex(PARROT_INTERP,
+    ARGIN(const STRING *src),
+    ARGMOD(String_iter *start), ARGOUT(String_iter *end),
+    ARGIN(const STRING *search))
+{
+    ASSERT_ARGS(Parrot_str_iter_rindex)
+    String_iter search_iter, search_start;
+    const UINTVAL len = search->strlen;
+    UINTVAL c0;
+
+    if (len == 0) {
+        *end = *start;
+        return start->charpos;
+    }
+
+    if (string_byte_searchable(src, search)) {
+        const UINTVAL unit  = src->encoding->bytes_per_unit;
+        UINTVAL       limit = start->bytepos + search->bufused;
+        UINTVAL       pos;
+
+        if (limit > src->bufused)
+            limit = src->bufused;
+
+        do {
+            const char * const found = Parrot_util_memrmem(src->strstart, limit,
+                    search->strstart, search->bufused);
+
+            if (!found)
+                return -1;
+
+            pos   = found - src->strstart;
+            limit = pos + search->bufused - 1;
+        } while (pos % unit);
+
+        start->charpos -= string_byte_chars(src, pos, start->bytepos);
+        start->bytepos  = pos;
+        end->charpos    = start->charpos + len;
+        end->bytepos    = pos + search->bufused;
+
+        return start->charpos;
+    }
+
+    STRING_ITER_INIT(interp, &search_start);
+    c0 = STRING_iter_get_and_advance(interp, search, &search_start);
+
+    while (1) {
+        UINTVAL c1 = STRING_iter_get(interp, src, start, 0);
+
+        if (c1 == c0) {
+            UINTVAL c2;
+
+            *end = *start;
+            STRING_iter_skip(interp, src, end, 1);
+            search_iter = search_start;
+
+            do {
+                if (search_iter.charpos >= len)
+                    return start->charpos;
+                c1 = STRING_iter_get_and_advance(interp, src, end);
+                c2 = STRING_iter_get_and_advance(interp, search, &search_iter);
+            } while (c1 == c2);
+        }
+
+        if (start->charpos == 0)
+            break;
+
+        STRING_iter_skip(interp, src, start, -1);
+    }
+
+    return -1;
+}
+
 
 /*
 
@@ -1965,12 +2333,30 @@ Parrot_str_to_int(PARROT_INTERP, ARGIN_NULLOK(const STRING *s))
 }
 
 
+/* Most significant digits Parrot_str_to_num accumulates in an integer */
+#define NUM_MAX_DIGITS  19
+
+/* Largest integer mantissa a double holds exactly, 2**53 */
+#define NUM_MAX_EXACT   ((UHUGEINTVAL)1 << 53)
+
+/* Powers of ten a double holds exactly */
+static const double exact_powers_of_ten[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
 /*
 
 =item C<FLOATVAL Parrot_str_to_num(PARROT_INTERP, const STRING *s)>
 
 Converts a numeric Parrot STRING to a floating point number.
 
+The first pass reads the number into an integer mantissa of up to
+C<NUM_MAX_DIGITS> significant digits and a decimal exponent. When the mantissa
+and the power of ten are both exact as doubles, which covers the numbers
+found in most data, one multiplication or division rounds the result
+correctly. Anything else goes to C<str_to_num_slow>.
+
 =cut
 
 */
@@ -1981,19 +2367,14 @@ FLOATVAL
 Parrot_str_to_num(PARROT_INTERP, ARGIN_NULLOK(const STRING *s))
 {
     ASSERT_ARGS(Parrot_str_to_num)
-    FLOATVAL      f         = 0.0;
-    FLOATVAL      mantissa  = 0.0;
-    FLOATVAL      sign      = 1.0; /* -1 for '-' */
-    FLOATVAL      divider   = 0.1;
+    FLOATVAL      f;
+    UHUGEINTVAL   mantissa  = 0;    /* leading significant digits */
+    INTVAL        digits    = 0;    /* significant digits */
+    INTVAL        point     = 0;    /* position of the point after them */
     INTVAL        e         = 0;
     INTVAL        e_sign    = 1; /* -1 for '-' */
-    /* How many digits it's safe to parse */
-    const INTVAL  max_safe  = PARROT_INTVAL_MAX / 10;
-    INTVAL        m         = 0;    /* Integer mantissa */
-    int           m_is_safe = 1;    /* We can use integer mantissa */
-    INTVAL        d         = 0;    /* Integer descriminator */
-    int           d_is_safe = 1;    /* We can use integer mantissa */
-    int           d_length  = 0;
+    INTVAL        exponent;
+    int           negative  = 0;
     int           check_nan = 0;    /* Check for NaN and Inf after main loop */
     String_iter iter;
     number_parse_state state = parse_start;
@@ -2013,13 +2394,16 @@ Parrot_str_to_num(PARROT_INTERP, ARGIN_NULLOK(const STRING *s))
         switch (state) {
           case parse_start:
             if (isdigit((unsigned char)c)) {
-                f = c - '0';
-                m = c - '0';
+                if (c != '0') {
+                    mantissa = c - '0';
+                    digits   = 1;
+                    point    = 1;
+                }
                 state = parse_before_dot;
             }
             else if (c == '-') {
-                sign = -1.0;
-                state = parse_before_dot;
+                negative = 1;
+                state    = parse_before_dot;
             }
             else if (c == '+')
                 state = parse_before_dot;
@@ -2035,29 +2419,18 @@ Parrot_str_to_num(PARROT_INTERP, ARGIN_NULLOK(const STRING *s))
 
           case parse_before_dot:
             if (isdigit((unsigned char)c)) {
-                f = f*10.0 + (c-'0');
-                m = m*10 + (c-'0');
-                /* Integer overflow for mantissa */
-                if (m >= max_safe)
-                    m_is_safe = 0;
+                /* leading zeros are not significant */
+                if (digits || c != '0') {
+                    if (digits < NUM_MAX_DIGITS)
+                        mantissa = mantissa * 10 + (c - '0');
+                    ++digits;
+                    ++point;
+                }
             }
-            else if (c == '.') {
+            else if (c == '.')
                 state = parse_after_dot;
-                /*
-                 * Throw gathered result. Recalculate from integer mantissa
-                 * to preserve precision.
-                 */
-                if (m_is_safe)
-                    f = m;
-                mantissa = f;
-            }
-            else if (c == 'e' || c == 'E') {
+            else if (c == 'e' || c == 'E')
                 state = parse_after_e;
-                /* See comment above */
-                if (m_is_safe)
-                    f = m;
-                mantissa = f;
-            }
             else {
                 check_nan = 1;
                 state     = parse_end;
@@ -2066,12 +2439,13 @@ Parrot_str_to_num(PARROT_INTERP, ARGIN_NULLOK(const STRING *s))
 
           case parse_after_dot:
             if (isdigit((unsigned char)c)) {
-                f += (c-'0') * divider;
-                divider /= 10.0;
-                d = d*10 + (c-'0');
-                if (d >= max_safe)
-                    d_is_safe = 0;
-                ++d_length;
+                if (digits || c != '0') {
+                    if (digits < NUM_MAX_DIGITS)
+                        mantissa = mantissa * 10 + (c - '0');
+                    ++digits;
+                }
+                else
+                    --point;
             }
             else if (c == 'e' || c == 'E')
                 state = parse_after_e;
@@ -2081,7 +2455,7 @@ Parrot_str_to_num(PARROT_INTERP, ARGIN_NULLOK(const STRING *s))
 
           case parse_after_e:
             if (isdigit((unsigned char)c)) {
-                e = e*10 + (c-'0');
+                e = c - '0';
                 state = parse_after_e_sign;
             }
             else if (c == '-') {
@@ -2095,8 +2469,11 @@ Parrot_str_to_num(PARROT_INTERP, ARGIN_NULLOK(const STRING *s))
             break;
 
           case parse_after_e_sign:
-            if (isdigit((unsigned char)c))
-                e = e*10 + (c-'0');
+            if (isdigit((unsigned char)c)) {
+                /* anything this big overflows or underflows anyway */
+                if (e < 100000)
+                    e = e*10 + (c-'0');
+            }
             else
                 state = parse_end;
             break;
@@ -2122,28 +2499,87 @@ Parrot_str_to_num(PARROT_INTERP, ARGIN_NULLOK(const STRING *s))
             return PARROT_FLOATVAL_INF_NEGATIVE;
     }
 
-/* powl() could be used here, but it is an optional POSIX extension that
-   needs to be checked for at Configure-time.
+    /* the value is mantissa * 10 ** exponent, if no digits were dropped */
+    exponent = point - (digits < NUM_MAX_DIGITS ? digits : NUM_MAX_DIGITS)
+             + e_sign * e;
 
-   See https://github.com/parrot/parrot/issues/451 for more details. */
+    if (!mantissa)
+        f = 0.0;
+    else if (digits <= NUM_MAX_DIGITS && mantissa <= NUM_MAX_EXACT
+         &&  exponent >= -22 && exponent <= 22) {
+        if (exponent < 0)
+            f = (FLOATVAL)mantissa / exact_powers_of_ten[-exponent];
+        else
+            f = (FLOATVAL)mantissa * exact_powers_of_ten[exponent];
+    }
+    else
+        f = str_to_num_slow(interp, s, digits, point - digits + e_sign * e);
 
-#  define POW pow
+    return negative ? -f : f;
+}
 
-     if (d && d_is_safe) {
-        f = mantissa + (1.0 * d / POW(10.0, d_length));
-     }
+/*
 
-    if (sign < 0)
-        f = -f;
+=item C<static FLOATVAL str_to_num_slow(PARROT_INTERP, const STRING *s, INTVAL
+digits, INTVAL exponent)>
 
-    if (e) {
-        if (e_sign == 1)
-            f *= POW(10.0, e);
-        else
-            f /= POW(10.0, e);
+Converts the number in C<s> when C<Parrot_str_to_num> cannot do it exactly
+with one operation, by rewriting its C<digits> significant digits as an
+integer times C<10 ** exponent> and handing that to C<strtod()>, which rounds
+correctly. The rewritten form has no decimal point, so the C locale doesn't
+matter. The sign is left to the caller.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static FLOATVAL
+str_to_num_slow(PARROT_INTERP, ARGIN(const STRING *s), INTVAL digits,
+        INTVAL exponent)
+{
+    ASSERT_ARGS(str_to_num_slow)
+    char        local[128];
+    const int   on_heap = digits + 32 > (INTVAL)sizeof (local);
+    char * const buf    = on_heap
+                        ? mem_gc_allocate_n_typed(interp, digits + 32, char)
+                        : local;
+    INTVAL      n       = 0;
+    FLOATVAL    f;
+    String_iter iter;
+    UINTVAL     c;
+
+    /* skip what the first pass did before the digits */
+    STRING_ITER_INIT(interp, &iter);
+    do {
+        c = STRING_iter_get_and_advance(interp, s, &iter);
+    } while (c < 256 && isspace((unsigned char)c));
+
+    if (c == '-' || c == '+')
+        c = STRING_iter_get_and_advance(interp, s, &iter);
+
+    /* the first pass counted the digits, so they are all there */
+    for (;;) {
+        if (isdigit((unsigned char)c) && (n || c != '0')) {
+            buf[n++] = (char)c;
+
+            if (n == digits)
+                break;
+        }
+
+        c = STRING_iter_get_and_advance(interp, s, &iter);
     }
 
-#undef POW
+    sprintf(buf + n, "e" INTVAL_FMT, exponent);
+
+#if NUMVAL_SIZE > DOUBLE_SIZE
+    f = strtold(buf, NULL);
+#else
+    f = strtod(buf, NULL);
+#endif
+
+    if (on_heap)
+        mem_gc_free(interp, buf);
 
     return f;
 }
@@ -2175,7 +2611,8 @@ Parrot_str_from_int(PARROT_INTERP, INTVAL i)
 
 =item C<STRING * Parrot_str_from_num(PARROT_INTERP, FLOATVAL f)>
 
-Returns a Parrot string representation of the specified floating-point value.
+Returns a Parrot string representation of the specified floating-point value,
+formatted with C<FLOATVAL_FMT>.
 
 =cut
 
@@ -2188,10 +2625,7 @@ STRING *
 Parrot_str_from_num(PARROT_INTERP, FLOATVAL f)
 {
     ASSERT_ARGS(Parrot_str_from_num)
-    /* Too damn hard--hand it off to Parrot_sprintf, which'll probably
-       use the system sprintf anyway, but has gigantic buffers that are
-       awfully hard to overflow. */
-    return Parrot_sprintf_c(interp, FLOATVAL_FMT, f);
+    return Parrot_sprintf_number(interp, f);
 }
 
 
@@ -3130,6 +3564,10 @@ Parrot_str_compose(PARROT_INTERP, ARGIN_NULLOK(const STRING *src))
 Joins the elements of the array C<ar> as strings with the string C<j> between
 them, returning the result.
 
+The parts are gathered in a chunked C<StringBuilder>: all but the shortest
+are kept by reference, so the result is allocated once with its exact size
+and each part copied once.
+
 =cut
 
 */
@@ -3141,42 +3579,25 @@ STRING*
 Parrot_str_join(PARROT_INTERP, ARGIN_NULLOK(STRING *j), ARGIN(PMC *ar))
 {
     ASSERT_ARGS(Parrot_str_join)
+    PMC         *sb;
+    const INTVAL count = VTABLE_elements(interp, ar);
+    INTVAL       i;
 
-    if (STRING_IS_NULL(j)) {
-        PMC *sb = Parrot_pmc_new_init(interp, enum_class_StringBuilder, ar);
-        return VTABLE_get_string(interp, sb);
-    }
-    else {
-        PMC      *sb;
-        STRING   *first;
-        const int count = VTABLE_elements(interp, ar);
-        INTVAL    length, j_length;
-        int       i;
-
-        if (count == 0)
-            return Parrot_str_new_noinit(interp, 0);
-
-        first    = VTABLE_get_string_keyed_int(interp, ar, 0);
-        length   = Parrot_str_byte_length(interp, first);
-        j_length = Parrot_str_byte_length(interp, j);
-
-        /* it's an approximation, but it doesn't hurt */
-        sb       = Parrot_pmc_new_init_int(interp, enum_class_StringBuilder,
-                    (length + j_length) * count);
+    if (count == 0)
+        return Parrot_str_new_noinit(interp, 0);
 
-        VTABLE_push_string(interp, sb, first);
+    sb = Parrot_pmc_new(interp, enum_class_StringBuilder);
+    SETATTR_StringBuilder_chunk_threshold(interp, sb, JOIN_CHUNK_MIN_BYTES);
 
-        for (i = 1; i < count; ++i) {
-            STRING *part = VTABLE_get_string_keyed_int(interp, ar, i);
-            if (j_length)
-                VTABLE_push_string(interp, sb, j);
+    for (i = 0; i < count; ++i) {
+        if (i > 0)
+            VTABLE_push_string(interp, sb, j);
 
-            if (part->strlen)
-                VTABLE_push_string(interp, sb, part);
-        }
-
-        return VTABLE_get_string(interp, sb);
+        VTABLE_push_string(interp, sb,
+            VTABLE_get_string_keyed_int(interp, ar, i));
     }
+
+    return VTABLE_get_string(interp, sb);
 }
 
 
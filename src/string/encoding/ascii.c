@@ -244,17 +244,15 @@ static STRING*
 ascii_upcase(PARROT_INTERP, ARGIN(const STRING *src))
 {
     ASSERT_ARGS(ascii_upcase)
-    STRING * const result = Parrot_str_clone(interp, src);
-    const UINTVAL n = src->strlen;
-
-    if (n) {
-        char * const buffer = result->strstart;
-        UINTVAL offset;
+    const UINTVAL  n      = src->bufused;
+    STRING * const result = Parrot_str_new_init(interp, NULL, n,
+                                src->encoding, 0);
 
-        for (offset = 0; offset < n; ++offset) {
-            buffer[offset] = (char)toupper((unsigned char)buffer[offset]);
-        }
-    }
+    if (n)
+        encoding_ascii_case_buf(result->strstart, src->strstart, n,
+            ENCODING_UPCASE);
+    result->bufused = n;
+    result->strlen  = src->strlen;
 
     return result;
 }
@@ -274,17 +272,15 @@ static STRING*
 ascii_downcase(PARROT_INTERP, ARGIN(const STRING *src))
 {
     ASSERT_ARGS(ascii_downcase)
-    STRING       *result = Parrot_str_clone(interp, src);
-    const UINTVAL n      = src->strlen;
+    const UINTVAL  n      = src->bufused;
+    STRING * const result = Parrot_str_new_init(interp, NULL, n,
+                                src->encoding, 0);
 
-    if (n) {
-        char * const buffer = result->strstart;
-        UINTVAL offset;
-
-        for (offset = 0; offset < n; ++offset) {
-            buffer[offset] = (char)tolower((unsigned char)buffer[offset]);
-        }
-    }
+    if (n)
+        encoding_ascii_case_buf(result->strstart, src->strstart, n,
+            ENCODING_DOWNCASE);
+    result->bufused = n;
+    result->strlen  = src->strlen;
 
     return result;
 }
@@ -306,18 +302,18 @@ static STRING*
 ascii_titlecase(PARROT_INTERP, ARGIN(const STRING *src))
 {
     ASSERT_ARGS(ascii_titlecase)
-    STRING       *result = Parrot_str_clone(interp, src);
-    const UINTVAL n      = src->strlen;
+    const UINTVAL  n      = src->bufused;
+    STRING * const result = Parrot_str_new_init(interp, NULL, n,
+                                src->encoding, 0);
 
     if (n) {
-        char * const buffer = result->strstart;
-        UINTVAL offset;
-
-        buffer[0] = (char)toupper((unsigned char)buffer[0]);
-        for (offset = 1; offset < n; ++offset) {
-            buffer[offset] = (char)tolower((unsigned char)buffer[offset]);
-        }
+        encoding_ascii_case_buf(result->strstart, src->strstart, 1,
+            ENCODING_UPCASE);
+        encoding_ascii_case_buf(result->strstart + 1, src->strstart + 1,
+            n - 1, ENCODING_DOWNCASE);
     }
+    result->bufused = n;
+    result->strlen  = src->strlen;
 
     return result;
 }
@@ -0,0 +1,1678 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from 'tools/dev/gen_case_tables.pl'.
+ *
+ * Case mapping tables for the latin1, UTF-8 and UCS-4 encodings,
+ * generated from Unicode 14.0.0.
+ *
+ * Copyright (C) 2014, Parrot Foundation.
+ */
+
+/* HEADERIZER HFILE: none */
+
+
+#include "casetables.h"
+
+const Parrot_case_run Parrot_case_upper_runs[] = {
+    { 0x0061, 0x007A,    -32, 1 },
+    { 0x00B5, 0x00B5,    743, 1 },
+    { 0x00E0, 0x00F6,    -32, 1 },
+    { 0x00F8, 0x00FE,    -32, 1 },
+    { 0x00FF, 0x00FF,    121, 1 },
+    { 0x0101, 0x012F,     -1, 2 },
+    { 0x0131, 0x0131,   -232, 1 },
+    { 0x0133, 0x0137,     -1, 2 },
+    { 0x013A, 0x0148,     -1, 2 },
+    { 0x014B, 0x0177,     -1, 2 },
+    { 0x017A, 0x017E,     -1, 2 },
+    { 0x017F, 0x017F,   -300, 1 },
+    { 0x0180, 0x0180,    195, 1 },
+    { 0x0183, 0x0185,     -1, 2 },
+    { 0x0188, 0x0188,     -1, 1 },
+    { 0x018C, 0x018C,     -1, 1 },
+    { 0x0192, 0x0192,     -1, 1 },
+    { 0x0195, 0x0195,     97, 1 },
+    { 0x0199, 0x0199,     -1, 1 },
+    { 0x019A, 0x019A,    163, 1 },
+    { 0x019E, 0x019E,    130, 1 },
+    { 0x01A1, 0x01A5,     -1, 2 },
+    { 0x01A8, 0x01A8,     -1, 1 },
+    { 0x01AD, 0x01AD,     -1, 1 },
+    { 0x01B0, 0x01B0,     -1, 1 },
+    { 0x01B4, 0x01B6,     -1, 2 },
+    { 0x01B9, 0x01B9,     -1, 1 },
+    { 0x01BD, 0x01BD,     -1, 1 },
+    { 0x01BF, 0x01BF,     56, 1 },
+    { 0x01C5, 0x01C5,     -1, 1 },
+    { 0x01C6, 0x01C6,     -2, 1 },
+    { 0x01C8, 0x01C8,     -1, 1 },
+    { 0x01C9, 0x01C9,     -2, 1 },
+    { 0x01CB, 0x01CB,     -1, 1 },
+    { 0x01CC, 0x01CC,     -2, 1 },
+    { 0x01CE, 0x01DC,     -1, 2 },
+    { 0x01DD, 0x01DD,    -79, 1 },
+    { 0x01DF, 0x01EF,     -1, 2 },
+    { 0x01F2, 0x01F2,     -1, 1 },
+    { 0x01F3, 0x01F3,     -2, 1 },
+    { 0x01F5, 0x01F5,     -1, 1 },
+    { 0x01F9, 0x021F,     -1, 2 },
+    { 0x0223, 0x0233,     -1, 2 },
+    { 0x023C, 0x023C,     -1, 1 },
+    { 0x023F, 0x0240,  10815, 1 },
+    { 0x0242, 0x0242,     -1, 1 },
+    { 0x0247, 0x024F,     -1, 2 },
+    { 0x0250, 0x0250,  10783, 1 },
+    { 0x0251, 0x0251,  10780, 1 },
+    { 0x0252, 0x0252,  10782, 1 },
+    { 0x0253, 0x0253,   -210, 1 },
+    { 0x0254, 0x0254,   -206, 1 },
+    { 0x0256, 0x0257,   -205, 1 },
+    { 0x0259, 0x0259,   -202, 1 },
+    { 0x025B, 0x025B,   -203, 1 },
+    { 0x025C, 0x025C,  42319, 1 },
+    { 0x0260, 0x0260,   -205, 1 },
+    { 0x0261, 0x0261,  42315, 1 },
+    { 0x0263, 0x0263,   -207, 1 },
+    { 0x0265, 0x0265,  42280, 1 },
+    { 0x0266, 0x0266,  42308, 1 },
+    { 0x0268, 0x0268,   -209, 1 },
+    { 0x0269, 0x0269,   -211, 1 },
+    { 0x026A, 0x026A,  42308, 1 },
+    { 0x026B, 0x026B,  10743, 1 },
+    { 0x026C, 0x026C,  42305, 1 },
+    { 0x026F, 0x026F,   -211, 1 },
+    { 0x0271, 0x0271,  10749, 1 },
+    { 0x0272, 0x0272,   -213, 1 },
+    { 0x0275, 0x0275,   -214, 1 },
+    { 0x027D, 0x027D,  10727, 1 },
+    { 0x0280, 0x0280,   -218, 1 },
+    { 0x0282, 0x0282,  42307, 1 },
+    { 0x0283, 0x0283,   -218, 1 },
+    { 0x0287, 0x0287,  42282, 1 },
+    { 0x0288, 0x0288,   -218, 1 },
+    { 0x0289, 0x0289,    -69, 1 },
+    { 0x028A, 0x028B,   -217, 1 },
+    { 0x028C, 0x028C,    -71, 1 },
+    { 0x0292, 0x0292,   -219, 1 },
+    { 0x029D, 0x029D,  42261, 1 },
+    { 0x029E, 0x029E,  42258, 1 },
+    { 0x0345, 0x0345,     84, 1 },
+    { 0x0371, 0x0373,     -1, 2 },
+    { 0x0377, 0x0377,     -1, 1 },
+    { 0x037B, 0x037D,    130, 1 },
+    { 0x03AC, 0x03AC,    -38, 1 },
+    { 0x03AD, 0x03AF,    -37, 1 },
+    { 0x03B1, 0x03C1,    -32, 1 },
+    { 0x03C2, 0x03C2,    -31, 1 },
+    { 0x03C3, 0x03CB,    -32, 1 },
+    { 0x03CC, 0x03CC,    -64, 1 },
+    { 0x03CD, 0x03CE,    -63, 1 },
+    { 0x03D0, 0x03D0,    -62, 1 },
+    { 0x03D1, 0x03D1,    -57, 1 },
+    { 0x03D5, 0x03D5,    -47, 1 },
+    { 0x03D6, 0x03D6,    -54, 1 },
+    { 0x03D7, 0x03D7,     -8, 1 },
+    { 0x03D9, 0x03EF,     -1, 2 },
+    { 0x03F0, 0x03F0,    -86, 1 },
+    { 0x03F1, 0x03F1,    -80, 1 },
+    { 0x03F2, 0x03F2,      7, 1 },
+    { 0x03F3, 0x03F3,   -116, 1 },
+    { 0x03F5, 0x03F5,    -96, 1 },
+    { 0x03F8, 0x03F8,     -1, 1 },
+    { 0x03FB, 0x03FB,     -1, 1 },
+    { 0x0430, 0x044F,    -32, 1 },
+    { 0x0450, 0x045F,    -80, 1 },
+    { 0x0461, 0x0481,     -1, 2 },
+    { 0x048B, 0x04BF,     -1, 2 },
+    { 0x04C2, 0x04CE,     -1, 2 },
+    { 0x04CF, 0x04CF,    -15, 1 },
+    { 0x04D1, 0x052F,     -1, 2 },
+    { 0x0561, 0x0586,    -48, 1 },
+    { 0x10D0, 0x10FA,   3008, 1 },
+    { 0x10FD, 0x10FF,   3008, 1 },
+    { 0x13F8, 0x13FD,     -8, 1 },
+    { 0x1C80, 0x1C80,  -6254, 1 },
+    { 0x1C81, 0x1C81,  -6253, 1 },
+    { 0x1C82, 0x1C82,  -6244, 1 },
+    { 0x1C83, 0x1C84,  -6242, 1 },
+    { 0x1C85, 0x1C85,  -6243, 1 },
+    { 0x1C86, 0x1C86,  -6236, 1 },
+    { 0x1C87, 0x1C87,  -6181, 1 },
+    { 0x1C88, 0x1C88,  35266, 1 },
+    { 0x1D79, 0x1D79,  35332, 1 },
+    { 0x1D7D, 0x1D7D,   3814, 1 },
+    { 0x1D8E, 0x1D8E,  35384, 1 },
+    { 0x1E01, 0x1E95,     -1, 2 },
+    { 0x1E9B, 0x1E9B,    -59, 1 },
+    { 0x1EA1, 0x1EFF,     -1, 2 },
+    { 0x1F00, 0x1F07,      8, 1 },
+    { 0x1F10, 0x1F15,      8, 1 },
+    { 0x1F20, 0x1F27,      8, 1 },
+    { 0x1F30, 0x1F37,      8, 1 },
+    { 0x1F40, 0x1F45,      8, 1 },
+    { 0x1F51, 0x1F57,      8, 2 },
+    { 0x1F60, 0x1F67,      8, 1 },
+    { 0x1F70, 0x1F71,     74, 1 },
+    { 0x1F72, 0x1F75,     86, 1 },
+    { 0x1F76, 0x1F77,    100, 1 },
+    { 0x1F78, 0x1F79,    128, 1 },
+    { 0x1F7A, 0x1F7B,    112, 1 },
+    { 0x1F7C, 0x1F7D,    126, 1 },
+    { 0x1FB0, 0x1FB1,      8, 1 },
+    { 0x1FBE, 0x1FBE,  -7205, 1 },
+    { 0x1FD0, 0x1FD1,      8, 1 },
+    { 0x1FE0, 0x1FE1,      8, 1 },
+    { 0x1FE5, 0x1FE5,      7, 1 },
+    { 0x214E, 0x214E,    -28, 1 },
+    { 0x2170, 0x217F,    -16, 1 },
+    { 0x2184, 0x2184,     -1, 1 },
+    { 0x24D0, 0x24E9,    -26, 1 },
+    { 0x2C30, 0x2C5F,    -48, 1 },
+    { 0x2C61, 0x2C61,     -1, 1 },
+    { 0x2C65, 0x2C65, -10795, 1 },
+    { 0x2C66, 0x2C66, -10792, 1 },
+    { 0x2C68, 0x2C6C,     -1, 2 },
+    { 0x2C73, 0x2C73,     -1, 1 },
+    { 0x2C76, 0x2C76,     -1, 1 },
+    { 0x2C81, 0x2CE3,     -1, 2 },
+    { 0x2CEC, 0x2CEE,     -1, 2 },
+    { 0x2CF3, 0x2CF3,     -1, 1 },
+    { 0x2D00, 0x2D25,  -7264, 1 },
+    { 0x2D27, 0x2D27,  -7264, 1 },
+    { 0x2D2D, 0x2D2D,  -7264, 1 },
+    { 0xA641, 0xA66D,     -1, 2 },
+    { 0xA681, 0xA69B,     -1, 2 },
+    { 0xA723, 0xA72F,     -1, 2 },
+    { 0xA733, 0xA76F,     -1, 2 },
+    { 0xA77A, 0xA77C,     -1, 2 },
+    { 0xA77F, 0xA787,     -1, 2 },
+    { 0xA78C, 0xA78C,     -1, 1 },
+    { 0xA791, 0xA793,     -1, 2 },
+    { 0xA794, 0xA794,     48, 1 },
+    { 0xA797, 0xA7A9,     -1, 2 },
+    { 0xA7B5, 0xA7C3,     -1, 2 },
+    { 0xA7C8, 0xA7CA,     -1, 2 },
+    { 0xA7D1, 0xA7D1,     -1, 1 },
+    { 0xA7D7, 0xA7D9,     -1, 2 },
+    { 0xA7F6, 0xA7F6,     -1, 1 },
+    { 0xAB53, 0xAB53,   -928, 1 },
+    { 0xAB70, 0xABBF, -38864, 1 },
+    { 0xFF41, 0xFF5A,    -32, 1 },
+    { 0x10428, 0x1044F,    -40, 1 },
+    { 0x104D8, 0x104FB,    -40, 1 },
+    { 0x10597, 0x105A1,    -39, 1 },
+    { 0x105A3, 0x105B1,    -39, 1 },
+    { 0x105B3, 0x105B9,    -39, 1 },
+    { 0x105BB, 0x105BC,    -39, 1 },
+    { 0x10CC0, 0x10CF2,    -64, 1 },
+    { 0x118C0, 0x118DF,    -32, 1 },
+    { 0x16E60, 0x16E7F,    -32, 1 },
+    { 0x1E922, 0x1E943,    -34, 1 },
+};
+
+const Parrot_case_full Parrot_case_upper_full[] = {
+    { 0x00DF, { 0x0053, 0x0053, 0x0000 } },
+    { 0x0149, { 0x02BC, 0x004E, 0x0000 } },
+    { 0x01F0, { 0x004A, 0x030C, 0x0000 } },
+    { 0x0390, { 0x0399, 0x0308, 0x0301 } },
+    { 0x03B0, { 0x03A5, 0x0308, 0x0301 } },
+    { 0x0587, { 0x0535, 0x0552, 0x0000 } },
+    { 0x1E96, { 0x0048, 0x0331, 0x0000 } },
+    { 0x1E97, { 0x0054, 0x0308, 0x0000 } },
+    { 0x1E98, { 0x0057, 0x030A, 0x0000 } },
+    { 0x1E99, { 0x0059, 0x030A, 0x0000 } },
+    { 0x1E9A, { 0x0041, 0x02BE, 0x0000 } },
+    { 0x1F50, { 0x03A5, 0x0313, 0x0000 } },
+    { 0x1F52, { 0x03A5, 0x0313, 0x0300 } },
+    { 0x1F54, { 0x03A5, 0x0313, 0x0301 } },
+    { 0x1F56, { 0x03A5, 0x0313, 0x0342 } },
+    { 0x1F80, { 0x1F08, 0x0399, 0x0000 } },
+    { 0x1F81, { 0x1F09, 0x0399, 0x0000 } },
+    { 0x1F82, { 0x1F0A, 0x0399, 0x0000 } },
+    { 0x1F83, { 0x1F0B, 0x0399, 0x0000 } },
+    { 0x1F84, { 0x1F0C, 0x0399, 0x0000 } },
+    { 0x1F85, { 0x1F0D, 0x0399, 0x0000 } },
+    { 0x1F86, { 0x1F0E, 0x0399, 0x0000 } },
+    { 0x1F87, { 0x1F0F, 0x0399, 0x0000 } },
+    { 0x1F88, { 0x1F08, 0x0399, 0x0000 } },
+    { 0x1F89, { 0x1F09, 0x0399, 0x0000 } },
+    { 0x1F8A, { 0x1F0A, 0x0399, 0x0000 } },
+    { 0x1F8B, { 0x1F0B, 0x0399, 0x0000 } },
+    { 0x1F8C, { 0x1F0C, 0x0399, 0x0000 } },
+    { 0x1F8D, { 0x1F0D, 0x0399, 0x0000 } },
+    { 0x1F8E, { 0x1F0E, 0x0399, 0x0000 } },
+    { 0x1F8F, { 0x1F0F, 0x0399, 0x0000 } },
+    { 0x1F90, { 0x1F28, 0x0399, 0x0000 } },
+    { 0x1F91, { 0x1F29, 0x0399, 0x0000 } },
+    { 0x1F92, { 0x1F2A, 0x0399, 0x0000 } },
+    { 0x1F93, { 0x1F2B, 0x0399, 0x0000 } },
+    { 0x1F94, { 0x1F2C, 0x0399, 0x0000 } },
+    { 0x1F95, { 0x1F2D, 0x0399, 0x0000 } },
+    { 0x1F96, { 0x1F2E, 0x0399, 0x0000 } },
+    { 0x1F97, { 0x1F2F, 0x0399, 0x0000 } },
+    { 0x1F98, { 0x1F28, 0x0399, 0x0000 } },
+    { 0x1F99, { 0x1F29, 0x0399, 0x0000 } },
+    { 0x1F9A, { 0x1F2A, 0x0399, 0x0000 } },
+    { 0x1F9B, { 0x1F2B, 0x0399, 0x0000 } },
+    { 0x1F9C, { 0x1F2C, 0x0399, 0x0000 } },
+    { 0x1F9D, { 0x1F2D, 0x0399, 0x0000 } },
+    { 0x1F9E, { 0x1F2E, 0x0399, 0x0000 } },
+    { 0x1F9F, { 0x1F2F, 0x0399, 0x0000 } },
+    { 0x1FA0, { 0x1F68, 0x0399, 0x0000 } },
+    { 0x1FA1, { 0x1F69, 0x0399, 0x0000 } },
+    { 0x1FA2, { 0x1F6A, 0x0399, 0x0000 } },
+    { 0x1FA3, { 0x1F6B, 0x0399, 0x0000 } },
+    { 0x1FA4, { 0x1F6C, 0x0399, 0x0000 } },
+    { 0x1FA5, { 0x1F6D, 0x0399, 0x0000 } },
+    { 0x1FA6, { 0x1F6E, 0x0399, 0x0000 } },
+    { 0x1FA7, { 0x1F6F, 0x0399, 0x0000 } },
+    { 0x1FA8, { 0x1F68, 0x0399, 0x0000 } },
+    { 0x1FA9, { 0x1F69, 0x0399, 0x0000 } },
+    { 0x1FAA, { 0x1F6A, 0x0399, 0x0000 } },
+    { 0x1FAB, { 0x1F6B, 0x0399, 0x0000 } },
+    { 0x1FAC, { 0x1F6C, 0x0399, 0x0000 } },
+    { 0x1FAD, { 0x1F6D, 0x0399, 0x0000 } },
+    { 0x1FAE, { 0x1F6E, 0x0399, 0x0000 } },
+    { 0x1FAF, { 0x1F6F, 0x0399, 0x0000 } },
+    { 0x1FB2, { 0x1FBA, 0x0399, 0x0000 } },
+    { 0x1FB3, { 0x0391, 0x0399, 0x0000 } },
+    { 0x1FB4, { 0x0386, 0x0399, 0x0000 } },
+    { 0x1FB6, { 0x0391, 0x0342, 0x0000 } },
+    { 0x1FB7, { 0x0391, 0x0342, 0x0399 } },
+    { 0x1FBC, { 0x0391, 0x0399, 0x0000 } },
+    { 0x1FC2, { 0x1FCA, 0x0399, 0x0000 } },
+    { 0x1FC3, { 0x0397, 0x0399, 0x0000 } },
+    { 0x1FC4, { 0x0389, 0x0399, 0x0000 } },
+    { 0x1FC6, { 0x0397, 0x0342, 0x0000 } },
+    { 0x1FC7, { 0x0397, 0x0342, 0x0399 } },
+    { 0x1FCC, { 0x0397, 0x0399, 0x0000 } },
+    { 0x1FD2, { 0x0399, 0x0308, 0x0300 } },
+    { 0x1FD3, { 0x0399, 0x0308, 0x0301 } },
+    { 0x1FD6, { 0x0399, 0x0342, 0x0000 } },
+    { 0x1FD7, { 0x0399, 0x0308, 0x0342 } },
+    { 0x1FE2, { 0x03A5, 0x0308, 0x0300 } },
+    { 0x1FE3, { 0x03A5, 0x0308, 0x0301 } },
+    { 0x1FE4, { 0x03A1, 0x0313, 0x0000 } },
+    { 0x1FE6, { 0x03A5, 0x0342, 0x0000 } },
+    { 0x1FE7, { 0x03A5, 0x0308, 0x0342 } },
+    { 0x1FF2, { 0x1FFA, 0x0399, 0x0000 } },
+    { 0x1FF3, { 0x03A9, 0x0399, 0x0000 } },
+    { 0x1FF4, { 0x038F, 0x0399, 0x0000 } },
+    { 0x1FF6, { 0x03A9, 0x0342, 0x0000 } },
+    { 0x1FF7, { 0x03A9, 0x0342, 0x0399 } },
+    { 0x1FFC, { 0x03A9, 0x0399, 0x0000 } },
+    { 0xFB00, { 0x0046, 0x0046, 0x0000 } },
+    { 0xFB01, { 0x0046, 0x0049, 0x0000 } },
+    { 0xFB02, { 0x0046, 0x004C, 0x0000 } },
+    { 0xFB03, { 0x0046, 0x0046, 0x0049 } },
+    { 0xFB04, { 0x0046, 0x0046, 0x004C } },
+    { 0xFB05, { 0x0053, 0x0054, 0x0000 } },
+    { 0xFB06, { 0x0053, 0x0054, 0x0000 } },
+    { 0xFB13, { 0x0544, 0x0546, 0x0000 } },
+    { 0xFB14, { 0x0544, 0x0535, 0x0000 } },
+    { 0xFB15, { 0x0544, 0x053B, 0x0000 } },
+    { 0xFB16, { 0x054E, 0x0546, 0x0000 } },
+    { 0xFB17, { 0x0544, 0x053D, 0x0000 } },
+};
+
+const Parrot_case_run Parrot_case_lower_runs[] = {
+    { 0x0041, 0x005A,     32, 1 },
+    { 0x00C0, 0x00D6,     32, 1 },
+    { 0x00D8, 0x00DE,     32, 1 },
+    { 0x0100, 0x012E,      1, 2 },
+    { 0x0132, 0x0136,      1, 2 },
+    { 0x0139, 0x0147,      1, 2 },
+    { 0x014A, 0x0176,      1, 2 },
+    { 0x0178, 0x0178,   -121, 1 },
+    { 0x0179, 0x017D,      1, 2 },
+    { 0x0181, 0x0181,    210, 1 },
+    { 0x0182, 0x0184,      1, 2 },
+    { 0x0186, 0x0186,    206, 1 },
+    { 0x0187, 0x0187,      1, 1 },
+    { 0x0189, 0x018A,    205, 1 },
+    { 0x018B, 0x018B,      1, 1 },
+    { 0x018E, 0x018E,     79, 1 },
+    { 0x018F, 0x018F,    202, 1 },
+    { 0x0190, 0x0190,    203, 1 },
+    { 0x0191, 0x0191,      1, 1 },
+    { 0x0193, 0x0193,    205, 1 },
+    { 0x0194, 0x0194,    207, 1 },
+    { 0x0196, 0x0196,    211, 1 },
+    { 0x0197, 0x0197,    209, 1 },
+    { 0x0198, 0x0198,      1, 1 },
+    { 0x019C, 0x019C,    211, 1 },
+    { 0x019D, 0x019D,    213, 1 },
+    { 0x019F, 0x019F,    214, 1 },
+    { 0x01A0, 0x01A4,      1, 2 },
+    { 0x01A6, 0x01A6,    218, 1 },
+    { 0x01A7, 0x01A7,      1, 1 },
+    { 0x01A9, 0x01A9,    218, 1 },
+    { 0x01AC, 0x01AC,      1, 1 },
+    { 0x01AE, 0x01AE,    218, 1 },
+    { 0x01AF, 0x01AF,      1, 1 },
+    { 0x01B1, 0x01B2,    217, 1 },
+    { 0x01B3, 0x01B5,      1, 2 },
+    { 0x01B7, 0x01B7,    219, 1 },
+    { 0x01B8, 0x01B8,      1, 1 },
+    { 0x01BC, 0x01BC,      1, 1 },
+    { 0x01C4, 0x01C4,      2, 1 },
+    { 0x01C5, 0x01C5,      1, 1 },
+    { 0x01C7, 0x01C7,      2, 1 },
+    { 0x01C8, 0x01C8,      1, 1 },
+    { 0x01CA, 0x01CA,      2, 1 },
+    { 0x01CB, 0x01DB,      1, 2 },
+    { 0x01DE, 0x01EE,      1, 2 },
+    { 0x01F1, 0x01F1,      2, 1 },
+    { 0x01F2, 0x01F4,      1, 2 },
+    { 0x01F6, 0x01F6,    -97, 1 },
+    { 0x01F7, 0x01F7,    -56, 1 },
+    { 0x01F8, 0x021E,      1, 2 },
+    { 0x0220, 0x0220,   -130, 1 },
+    { 0x0222, 0x0232,      1, 2 },
+    { 0x023A, 0x023A,  10795, 1 },
+    { 0x023B, 0x023B,      1, 1 },
+    { 0x023D, 0x023D,   -163, 1 },
+    { 0x023E, 0x023E,  10792, 1 },
+    { 0x0241, 0x0241,      1, 1 },
+    { 0x0243, 0x0243,   -195, 1 },
+    { 0x0244, 0x0244,     69, 1 },
+    { 0x0245, 0x0245,     71, 1 },
+    { 0x0246, 0x024E,      1, 2 },
+    { 0x0370, 0x0372,      1, 2 },
+    { 0x0376, 0x0376,      1, 1 },
+    { 0x037F, 0x037F,    116, 1 },
+    { 0x0386, 0x0386,     38, 1 },
+    { 0x0388, 0x038A,     37, 1 },
+    { 0x038C, 0x038C,     64, 1 },
+    { 0x038E, 0x038F,     63, 1 },
+    { 0x0391, 0x03A1,     32, 1 },
+    { 0x03A3, 0x03AB,     32, 1 },
+    { 0x03CF, 0x03CF,      8, 1 },
+    { 0x03D8, 0x03EE,      1, 2 },
+    { 0x03F4, 0x03F4,    -60, 1 },
+    { 0x03F7, 0x03F7,      1, 1 },
+    { 0x03F9, 0x03F9,     -7, 1 },
+    { 0x03FA, 0x03FA,      1, 1 },
+    { 0x03FD, 0x03FF,   -130, 1 },
+    { 0x0400, 0x040F,     80, 1 },
+    { 0x0410, 0x042F,     32, 1 },
+    { 0x0460, 0x0480,      1, 2 },
+    { 0x048A, 0x04BE,      1, 2 },
+    { 0x04C0, 0x04C0,     15, 1 },
+    { 0x04C1, 0x04CD,      1, 2 },
+    { 0x04D0, 0x052E,      1, 2 },
+    { 0x0531, 0x0556,     48, 1 },
+    { 0x10A0, 0x10C5,   7264, 1 },
+    { 0x10C7, 0x10C7,   7264, 1 },
+    { 0x10CD, 0x10CD,   7264, 1 },
+    { 0x13A0, 0x13EF,  38864, 1 },
+    { 0x13F0, 0x13F5,      8, 1 },
+    { 0x1C90, 0x1CBA,  -3008, 1 },
+    { 0x1CBD, 0x1CBF,  -3008, 1 },
+    { 0x1E00, 0x1E94,      1, 2 },
+    { 0x1E9E, 0x1E9E,  -7615, 1 },
+    { 0x1EA0, 0x1EFE,      1, 2 },
+    { 0x1F08, 0x1F0F,     -8, 1 },
+    { 0x1F18, 0x1F1D,     -8, 1 },
+    { 0x1F28, 0x1F2F,     -8, 1 },
+    { 0x1F38, 0x1F3F,     -8, 1 },
+    { 0x1F48, 0x1F4D,     -8, 1 },
+    { 0x1F59, 0x1F5F,     -8, 2 },
+    { 0x1F68, 0x1F6F,     -8, 1 },
+    { 0x1F88, 0x1F8F,     -8, 1 },
+    { 0x1F98, 0x1F9F,     -8, 1 },
+    { 0x1FA8, 0x1FAF,     -8, 1 },
+    { 0x1FB8, 0x1FB9,     -8, 1 },
+    { 0x1FBA, 0x1FBB,    -74, 1 },
+    { 0x1FBC, 0x1FBC,     -9, 1 },
+    { 0x1FC8, 0x1FCB,    -86, 1 },
+    { 0x1FCC, 0x1FCC,     -9, 1 },
+    { 0x1FD8, 0x1FD9,     -8, 1 },
+    { 0x1FDA, 0x1FDB,   -100, 1 },
+    { 0x1FE8, 0x1FE9,     -8, 1 },
+    { 0x1FEA, 0x1FEB,   -112, 1 },
+    { 0x1FEC, 0x1FEC,     -7, 1 },
+    { 0x1FF8, 0x1FF9,   -128, 1 },
+    { 0x1FFA, 0x1FFB,   -126, 1 },
+    { 0x1FFC, 0x1FFC,     -9, 1 },
+    { 0x2126, 0x2126,  -7517, 1 },
+    { 0x212A, 0x212A,  -8383, 1 },
+    { 0x212B, 0x212B,  -8262, 1 },
+    { 0x2132, 0x2132,     28, 1 },
+    { 0x2160, 0x216F,     16, 1 },
+    { 0x2183, 0x2183,      1, 1 },
+    { 0x24B6, 0x24CF,     26, 1 },
+    { 0x2C00, 0x2C2F,     48, 1 },
+    { 0x2C60, 0x2C60,      1, 1 },
+    { 0x2C62, 0x2C62, -10743, 1 },
+    { 0x2C63, 0x2C63,  -3814, 1 },
+    { 0x2C64, 0x2C64, -10727, 1 },
+    { 0x2C67, 0x2C6B,      1, 2 },
+    { 0x2C6D, 0x2C6D, -10780, 1 },
+    { 0x2C6E, 0x2C6E, -10749, 1 },
+    { 0x2C6F, 0x2C6F, -10783, 1 },
+    { 0x2C70, 0x2C70, -10782, 1 },
+    { 0x2C72, 0x2C72,      1, 1 },
+    { 0x2C75, 0x2C75,      1, 1 },
+    { 0x2C7E, 0x2C7F, -10815, 1 },
+    { 0x2C80, 0x2CE2,      1, 2 },
+    { 0x2CEB, 0x2CED,      1, 2 },
+    { 0x2CF2, 0x2CF2,      1, 1 },
+    { 0xA640, 0xA66C,      1, 2 },
+    { 0xA680, 0xA69A,      1, 2 },
+    { 0xA722, 0xA72E,      1, 2 },
+    { 0xA732, 0xA76E,      1, 2 },
+    { 0xA779, 0xA77B,      1, 2 },
+    { 0xA77D, 0xA77D, -35332, 1 },
+    { 0xA77E, 0xA786,      1, 2 },
+    { 0xA78B, 0xA78B,      1, 1 },
+    { 0xA78D, 0xA78D, -42280, 1 },
+    { 0xA790, 0xA792,      1, 2 },
+    { 0xA796, 0xA7A8,      1, 2 },
+    { 0xA7AA, 0xA7AA, -42308, 1 },
+    { 0xA7AB, 0xA7AB, -42319, 1 },
+    { 0xA7AC, 0xA7AC, -42315, 1 },
+    { 0xA7AD, 0xA7AD, -42305, 1 },
+    { 0xA7AE, 0xA7AE, -42308, 1 },
+    { 0xA7B0, 0xA7B0, -42258, 1 },
+    { 0xA7B1, 0xA7B1, -42282, 1 },
+    { 0xA7B2, 0xA7B2, -42261, 1 },
+    { 0xA7B3, 0xA7B3,    928, 1 },
+    { 0xA7B4, 0xA7C2,      1, 2 },
+    { 0xA7C4, 0xA7C4,    -48, 1 },
+    { 0xA7C5, 0xA7C5, -42307, 1 },
+    { 0xA7C6, 0xA7C6, -35384, 1 },
+    { 0xA7C7, 0xA7C9,      1, 2 },
+    { 0xA7D0, 0xA7D0,      1, 1 },
+    { 0xA7D6, 0xA7D8,      1, 2 },
+    { 0xA7F5, 0xA7F5,      1, 1 },
+    { 0xFF21, 0xFF3A,     32, 1 },
+    { 0x10400, 0x10427,     40, 1 },
+    { 0x104B0, 0x104D3,     40, 1 },
+    { 0x10570, 0x1057A,     39, 1 },
+    { 0x1057C, 0x1058A,     39, 1 },
+    { 0x1058C, 0x10592,     39, 1 },
+    { 0x10594, 0x10595,     39, 1 },
+    { 0x10C80, 0x10CB2,     64, 1 },
+    { 0x118A0, 0x118BF,     32, 1 },
+    { 0x16E40, 0x16E5F,     32, 1 },
+    { 0x1E900, 0x1E921,     34, 1 },
+};
+
+const Parrot_case_full Parrot_case_lower_full[] = {
+    { 0x0130, { 0x0069, 0x0307, 0x0000 } },
+};
+
+const Parrot_case_run Parrot_case_title_runs[] = {
+    { 0x0061, 0x007A,    -32, 1 },
+    { 0x00B5, 0x00B5,    743, 1 },
+    { 0x00E0, 0x00F6,    -32, 1 },
+    { 0x00F8, 0x00FE,    -32, 1 },
+    { 0x00FF, 0x00FF,    121, 1 },
+    { 0x0101, 0x012F,     -1, 2 },
+    { 0x0131, 0x0131,   -232, 1 },
+    { 0x0133, 0x0137,     -1, 2 },
+    { 0x013A, 0x0148,     -1, 2 },
+    { 0x014B, 0x0177,     -1, 2 },
+    { 0x017A, 0x017E,     -1, 2 },
+    { 0x017F, 0x017F,   -300, 1 },
+    { 0x0180, 0x0180,    195, 1 },
+    { 0x0183, 0x0185,     -1, 2 },
+    { 0x0188, 0x0188,     -1, 1 },
+    { 0x018C, 0x018C,     -1, 1 },
+    { 0x0192, 0x0192,     -1, 1 },
+    { 0x0195, 0x0195,     97, 1 },
+    { 0x0199, 0x0199,     -1, 1 },
+    { 0x019A, 0x019A,    163, 1 },
+    { 0x019E, 0x019E,    130, 1 },
+    { 0x01A1, 0x01A5,     -1, 2 },
+    { 0x01A8, 0x01A8,     -1, 1 },
+    { 0x01AD, 0x01AD,     -1, 1 },
+    { 0x01B0, 0x01B0,     -1, 1 },
+    { 0x01B4, 0x01B6,     -1, 2 },
+    { 0x01B9, 0x01B9,     -1, 1 },
+    { 0x01BD, 0x01BD,     -1, 1 },
+    { 0x01BF, 0x01BF,     56, 1 },
+    { 0x01C4, 0x01C4,      1, 1 },
+    { 0x01C6, 0x01C6,     -1, 1 },
+    { 0x01C7, 0x01C7,      1, 1 },
+    { 0x01C9, 0x01C9,     -1, 1 },
+    { 0x01CA, 0x01CA,      1, 1 },
+    { 0x01CC, 0x01DC,     -1, 2 },
+    { 0x01DD, 0x01DD,    -79, 1 },
+    { 0x01DF, 0x01EF,     -1, 2 },
+    { 0x01F1, 0x01F1,      1, 1 },
+    { 0x01F3, 0x01F5,     -1, 2 },
+    { 0x01F9, 0x021F,     -1, 2 },
+    { 0x0223, 0x0233,     -1, 2 },
+    { 0x023C, 0x023C,     -1, 1 },
+    { 0x023F, 0x0240,  10815, 1 },
+    { 0x0242, 0x0242,     -1, 1 },
+    { 0x0247, 0x024F,     -1, 2 },
+    { 0x0250, 0x0250,  10783, 1 },
+    { 0x0251, 0x0251,  10780, 1 },
+    { 0x0252, 0x0252,  10782, 1 },
+    { 0x0253, 0x0253,   -210, 1 },
+    { 0x0254, 0x0254,   -206, 1 },
+    { 0x0256, 0x0257,   -205, 1 },
+    { 0x0259, 0x0259,   -202, 1 },
+    { 0x025B, 0x025B,   -203, 1 },
+    { 0x025C, 0x025C,  42319, 1 },
+    { 0x0260, 0x0260,   -205, 1 },
+    { 0x0261, 0x0261,  42315, 1 },
+    { 0x0263, 0x0263,   -207, 1 },
+    { 0x0265, 0x0265,  42280, 1 },
+    { 0x0266, 0x0266,  42308, 1 },
+    { 0x0268, 0x0268,   -209, 1 },
+    { 0x0269, 0x0269,   -211, 1 },
+    { 0x026A, 0x026A,  42308, 1 },
+    { 0x026B, 0x026B,  10743, 1 },
+    { 0x026C, 0x026C,  42305, 1 },
+    { 0x026F, 0x026F,   -211, 1 },
+    { 0x0271, 0x0271,  10749, 1 },
+    { 0x0272, 0x0272,   -213, 1 },
+    { 0x0275, 0x0275,   -214, 1 },
+    { 0x027D, 0x027D,  10727, 1 },
+    { 0x0280, 0x0280,   -218, 1 },
+    { 0x0282, 0x0282,  42307, 1 },
+    { 0x0283, 0x0283,   -218, 1 },
+    { 0x0287, 0x0287,  42282, 1 },
+    { 0x0288, 0x0288,   -218, 1 },
+    { 0x0289, 0x0289,    -69, 1 },
+    { 0x028A, 0x028B,   -217, 1 },
+    { 0x028C, 0x028C,    -71, 1 },
+    { 0x0292, 0x0292,   -219, 1 },
+    { 0x029D, 0x029D,  42261, 1 },
+    { 0x029E, 0x029E,  42258, 1 },
+    { 0x0345, 0x0345,     84, 1 },
+    { 0x0371, 0x0373,     -1, 2 },
+    { 0x0377, 0x0377,     -1, 1 },
+    { 0x037B, 0x037D,    130, 1 },
+    { 0x03AC, 0x03AC,    -38, 1 },
+    { 0x03AD, 0x03AF,    -37, 1 },
+    { 0x03B1, 0x03C1,    -32, 1 },
+    { 0x03C2, 0x03C2,    -31, 1 },
+    { 0x03C3, 0x03CB,    -32, 1 },
+    { 0x03CC, 0x03CC,    -64, 1 },
+    { 0x03CD, 0x03CE,    -63, 1 },
+    { 0x03D0, 0x03D0,    -62, 1 },
+    { 0x03D1, 0x03D1,    -57, 1 },
+    { 0x03D5, 0x03D5,    -47, 1 },
+    { 0x03D6, 0x03D6,    -54, 1 },
+    { 0x03D7, 0x03D7,     -8, 1 },
+    { 0x03D9, 0x03EF,     -1, 2 },
+    { 0x03F0, 0x03F0,    -86, 1 },
+    { 0x03F1, 0x03F1,    -80, 1 },
+    { 0x03F2, 0x03F2,      7, 1 },
+    { 0x03F3, 0x03F3,   -116, 1 },
+    { 0x03F5, 0x03F5,    -96, 1 },
+    { 0x03F8, 0x03F8,     -1, 1 },
+    { 0x03FB, 0x03FB,     -1, 1 },
+    { 0x0430, 0x044F,    -32, 1 },
+    { 0x0450, 0x045F,    -80, 1 },
+    { 0x0461, 0x0481,     -1, 2 },
+    { 0x048B, 0x04BF,     -1, 2 },
+    { 0x04C2, 0x04CE,     -1, 2 },
+    { 0x04CF, 0x04CF,    -15, 1 },
+    { 0x04D1, 0x052F,     -1, 2 },
+    { 0x0561, 0x0586,    -48, 1 },
+    { 0x13F8, 0x13FD,     -8, 1 },
+    { 0x1C80, 0x1C80,  -6254, 1 },
+    { 0x1C81, 0x1C81,  -6253, 1 },
+    { 0x1C82, 0x1C82,  -6244, 1 },
+    { 0x1C83, 0x1C84,  -6242, 1 },
+    { 0x1C85, 0x1C85,  -6243, 1 },
+    { 0x1C86, 0x1C86,  -6236, 1 },
+    { 0x1C87, 0x1C87,  -6181, 1 },
+    { 0x1C88, 0x1C88,  35266, 1 },
+    { 0x1D79, 0x1D79,  35332, 1 },
+    { 0x1D7D, 0x1D7D,   3814, 1 },
+    { 0x1D8E, 0x1D8E,  35384, 1 },
+    { 0x1E01, 0x1E95,     -1, 2 },
+    { 0x1E9B, 0x1E9B,    -59, 1 },
+    { 0x1EA1, 0x1EFF,     -1, 2 },
+    { 0x1F00, 0x1F07,      8, 1 },
+    { 0x1F10, 0x1F15,      8, 1 },
+    { 0x1F20, 0x1F27,      8, 1 },
+    { 0x1F30, 0x1F37,      8, 1 },
+    { 0x1F40, 0x1F45,      8, 1 },
+    { 0x1F51, 0x1F57,      8, 2 },
+    { 0x1F60, 0x1F67,      8, 1 },
+    { 0x1F70, 0x1F71,     74, 1 },
+    { 0x1F72, 0x1F75,     86, 1 },
+    { 0x1F76, 0x1F77,    100, 1 },
+    { 0x1F78, 0x1F79,    128, 1 },
+    { 0x1F7A, 0x1F7B,    112, 1 },
+    { 0x1F7C, 0x1F7D,    126, 1 },
+    { 0x1F80, 0x1F87,      8, 1 },
+    { 0x1F90, 0x1F97,      8, 1 },
+    { 0x1FA0, 0x1FA7,      8, 1 },
+    { 0x1FB0, 0x1FB1,      8, 1 },
+    { 0x1FB3, 0x1FB3,      9, 1 },
+    { 0x1FBE, 0x1FBE,  -7205, 1 },
+    { 0x1FC3, 0x1FC3,      9, 1 },
+    { 0x1FD0, 0x1FD1,      8, 1 },
+    { 0x1FE0, 0x1FE1,      8, 1 },
+    { 0x1FE5, 0x1FE5,      7, 1 },
+    { 0x1FF3, 0x1FF3,      9, 1 },
+    { 0x214E, 0x214E,    -28, 1 },
+    { 0x2170, 0x217F,    -16, 1 },
+    { 0x2184, 0x2184,     -1, 1 },
+    { 0x24D0, 0x24E9,    -26, 1 },
+    { 0x2C30, 0x2C5F,    -48, 1 },
+    { 0x2C61, 0x2C61,     -1, 1 },
+    { 0x2C65, 0x2C65, -10795, 1 },
+    { 0x2C66, 0x2C66, -10792, 1 },
+    { 0x2C68, 0x2C6C,     -1, 2 },
+    { 0x2C73, 0x2C73,     -1, 1 },
+    { 0x2C76, 0x2C76,     -1, 1 },
+    { 0x2C81, 0x2CE3,     -1, 2 },
+    { 0x2CEC, 0x2CEE,     -1, 2 },
+    { 0x2CF3, 0x2CF3,     -1, 1 },
+    { 0x2D00, 0x2D25,  -7264, 1 },
+    { 0x2D27, 0x2D27,  -7264, 1 },
+    { 0x2D2D, 0x2D2D,  -7264, 1 },
+    { 0xA641, 0xA66D,     -1, 2 },
+    { 0xA681, 0xA69B,     -1, 2 },
+    { 0xA723, 0xA72F,     -1, 2 },
+    { 0xA733, 0xA76F,     -1, 2 },
+    { 0xA77A, 0xA77C,     -1, 2 },
+    { 0xA77F, 0xA787,     -1, 2 },
+    { 0xA78C, 0xA78C,     -1, 1 },
+    { 0xA791, 0xA793,     -1, 2 },
+    { 0xA794, 0xA794,     48, 1 },
+    { 0xA797, 0xA7A9,     -1, 2 },
+    { 0xA7B5, 0xA7C3,     -1, 2 },
+    { 0xA7C8, 0xA7CA,     -1, 2 },
+    { 0xA7D1, 0xA7D1,     -1, 1 },
+    { 0xA7D7, 0xA7D9,     -1, 2 },
+    { 0xA7F6, 0xA7F6,     -1, 1 },
+    { 0xAB53, 0xAB53,   -928, 1 },
+    { 0xAB70, 0xABBF, -38864, 1 },
+    { 0xFF41, 0xFF5A,    -32, 1 },
+    { 0x10428, 0x1044F,    -40, 1 },
+    { 0x104D8, 0x104FB,    -40, 1 },
+    { 0x10597, 0x105A1,    -39, 1 },
+    { 0x105A3, 0x105B1,    -39, 1 },
+    { 0x105B3, 0x105B9,    -39, 1 },
+    { 0x105BB, 0x105BC,    -39, 1 },
+    { 0x10CC0, 0x10CF2,    -64, 1 },
+    { 0x118C0, 0x118DF,    -32, 1 },
+    { 0x16E60, 0x16E7F,    -32, 1 },
+    { 0x1E922, 0x1E943,    -34, 1 },
+};
+
+const Parrot_case_full Parrot_case_title_full[] = {
+    { 0x00DF, { 0x0053, 0x0073, 0x0000 } },
+    { 0x0149, { 0x02BC, 0x004E, 0x0000 } },
+    { 0x01F0, { 0x004A, 0x030C, 0x0000 } },
+    { 0x0390, { 0x0399, 0x0308, 0x0301 } },
+    { 0x03B0, { 0x03A5, 0x0308, 0x0301 } },
+    { 0x0587, { 0x0535, 0x0582, 0x0000 } },
+    { 0x1E96, { 0x0048, 0x0331, 0x0000 } },
+    { 0x1E97, { 0x0054, 0x0308, 0x0000 } },
+    { 0x1E98, { 0x0057, 0x030A, 0x0000 } },
+    { 0x1E99, { 0x0059, 0x030A, 0x0000 } },
+    { 0x1E9A, { 0x0041, 0x02BE, 0x0000 } },
+    { 0x1F50, { 0x03A5, 0x0313, 0x0000 } },
+    { 0x1F52, { 0x03A5, 0x0313, 0x0300 } },
+    { 0x1F54, { 0x03A5, 0x0313, 0x0301 } },
+    { 0x1F56, { 0x03A5, 0x0313, 0x0342 } },
+    { 0x1FB2, { 0x1FBA, 0x0345, 0x0000 } },
+    { 0x1FB4, { 0x0386, 0x0345, 0x0000 } },
+    { 0x1FB6, { 0x0391, 0x0342, 0x0000 } },
+    { 0x1FB7, { 0x0391, 0x0342, 0x0345 } },
+    { 0x1FC2, { 0x1FCA, 0x0345, 0x0000 } },
+    { 0x1FC4, { 0x0389, 0x0345, 0x0000 } },
+    { 0x1FC6, { 0x0397, 0x0342, 0x0000 } },
+    { 0x1FC7, { 0x0397, 0x0342, 0x0345 } },
+    { 0x1FD2, { 0x0399, 0x0308, 0x0300 } },
+    { 0x1FD3, { 0x0399, 0x0308, 0x0301 } },
+    { 0x1FD6, { 0x0399, 0x0342, 0x0000 } },
+    { 0x1FD7, { 0x0399, 0x0308, 0x0342 } },
+    { 0x1FE2, { 0x03A5, 0x0308, 0x0300 } },
+    { 0x1FE3, { 0x03A5, 0x0308, 0x0301 } },
+    { 0x1FE4, { 0x03A1, 0x0313, 0x0000 } },
+    { 0x1FE6, { 0x03A5, 0x0342, 0x0000 } },
+    { 0x1FE7, { 0x03A5, 0x0308, 0x0342 } },
+    { 0x1FF2, { 0x1FFA, 0x0345, 0x0000 } },
+    { 0x1FF4, { 0x038F, 0x0345, 0x0000 } },
+    { 0x1FF6, { 0x03A9, 0x0342, 0x0000 } },
+    { 0x1FF7, { 0x03A9, 0x0342, 0x0345 } },
+    { 0xFB00, { 0x0046, 0x0066, 0x0000 } },
+    { 0xFB01, { 0x0046, 0x0069, 0x0000 } },
+    { 0xFB02, { 0x0046, 0x006C, 0x0000 } },
+    { 0xFB03, { 0x0046, 0x0066, 0x0069 } },
+    { 0xFB04, { 0x0046, 0x0066, 0x006C } },
+    { 0xFB05, { 0x0053, 0x0074, 0x0000 } },
+    { 0xFB06, { 0x0053, 0x0074, 0x0000 } },
+    { 0xFB13, { 0x0544, 0x0576, 0x0000 } },
+    { 0xFB14, { 0x0544, 0x0565, 0x0000 } },
+    { 0xFB15, { 0x0544, 0x056B, 0x0000 } },
+    { 0xFB16, { 0x054E, 0x0576, 0x0000 } },
+    { 0xFB17, { 0x0544, 0x056D, 0x0000 } },
+};
+
+const Parrot_case_run Parrot_case_word_runs[] = {
+    { 0x0027, 0x0027, 1, 1 },
+    { 0x002E, 0x002E, 1, 1 },
+    { 0x0030, 0x003A, 1, 1 },
+    { 0x0041, 0x005A, 2, 1 },
+    { 0x005E, 0x005E, 1, 1 },
+    { 0x0060, 0x0060, 1, 1 },
+    { 0x0061, 0x007A, 2, 1 },
+    { 0x00A8, 0x00A8, 1, 1 },
+    { 0x00AA, 0x00AA, 2, 1 },
+    { 0x00AD, 0x00AD, 1, 1 },
+    { 0x00AF, 0x00AF, 1, 1 },
+    { 0x00B4, 0x00B4, 1, 1 },
+    { 0x00B5, 0x00B5, 2, 1 },
+    { 0x00B7, 0x00B8, 1, 1 },
+    { 0x00BA, 0x00BA, 2, 1 },
+    { 0x00C0, 0x00D6, 2, 1 },
+    { 0x00D8, 0x00F6, 2, 1 },
+    { 0x00F8, 0x01BA, 2, 1 },
+    { 0x01BB, 0x01BB, 1, 1 },
+    { 0x01BC, 0x01BF, 2, 1 },
+    { 0x01C0, 0x01C3, 1, 1 },
+    { 0x01C4, 0x0293, 2, 1 },
+    { 0x0294, 0x0294, 1, 1 },
+    { 0x0295, 0x02B8, 2, 1 },
+    { 0x02B9, 0x02BF, 1, 1 },
+    { 0x02C0, 0x02C1, 2, 1 },
+    { 0x02C2, 0x02DF, 1, 1 },
+    { 0x02E0, 0x02E4, 2, 1 },
+    { 0x02E5, 0x0344, 1, 1 },
+    { 0x0345, 0x0345, 2, 1 },
+    { 0x0346, 0x036F, 1, 1 },
+    { 0x0370, 0x0373, 2, 1 },
+    { 0x0374, 0x0375, 1, 1 },
+    { 0x0376, 0x0377, 2, 1 },
+    { 0x037A, 0x037D, 2, 1 },
+    { 0x037F, 0x037F, 2, 1 },
+    { 0x0384, 0x0385, 1, 1 },
+    { 0x0386, 0x0386, 2, 1 },
+    { 0x0387, 0x0387, 1, 1 },
+    { 0x0388, 0x038A, 2, 1 },
+    { 0x038C, 0x038C, 2, 1 },
+    { 0x038E, 0x03A1, 2, 1 },
+    { 0x03A3, 0x03F5, 2, 1 },
+    { 0x03F7, 0x0481, 2, 1 },
+    { 0x0483, 0x0489, 1, 1 },
+    { 0x048A, 0x052F, 2, 1 },
+    { 0x0531, 0x0556, 2, 1 },
+    { 0x0559, 0x0559, 1, 1 },
+    { 0x055F, 0x055F, 1, 1 },
+    { 0x0560, 0x0588, 2, 1 },
+    { 0x0591, 0x05BD, 1, 1 },
+    { 0x05BF, 0x05BF, 1, 1 },
+    { 0x05C1, 0x05C2, 1, 1 },
+    { 0x05C4, 0x05C5, 1, 1 },
+    { 0x05C7, 0x05C7, 1, 1 },
+    { 0x05D0, 0x05EA, 1, 1 },
+    { 0x05EF, 0x05F2, 1, 1 },
+    { 0x05F4, 0x05F4, 1, 1 },
+    { 0x0600, 0x0605, 1, 1 },
+    { 0x0610, 0x061A, 1, 1 },
+    { 0x061C, 0x061C, 1, 1 },
+    { 0x0620, 0x0669, 1, 1 },
+    { 0x066E, 0x06D3, 1, 1 },
+    { 0x06D5, 0x06DD, 1, 1 },
+    { 0x06DF, 0x06E8, 1, 1 },
+    { 0x06EA, 0x06FC, 1, 1 },
+    { 0x06FF, 0x06FF, 1, 1 },
+    { 0x070F, 0x074A, 1, 1 },
+    { 0x074D, 0x07B1, 1, 1 },
+    { 0x07C0, 0x07F5, 1, 1 },
+    { 0x07FA, 0x07FA, 1, 1 },
+    { 0x07FD, 0x07FD, 1, 1 },
+    { 0x0800, 0x082D, 1, 1 },
+    { 0x0840, 0x085B, 1, 1 },
+    { 0x0860, 0x086A, 1, 1 },
+    { 0x0870, 0x088E, 1, 1 },
+    { 0x0890, 0x0891, 1, 1 },
+    { 0x0898, 0x0963, 1, 1 },
+    { 0x0966, 0x096F, 1, 1 },
+    { 0x0971, 0x0983, 1, 1 },
+    { 0x0985, 0x098C, 1, 1 },
+    { 0x098F, 0x0990, 1, 1 },
+    { 0x0993, 0x09A8, 1, 1 },
+    { 0x09AA, 0x09B0, 1, 1 },
+    { 0x09B2, 0x09B2, 1, 1 },
+    { 0x09B6, 0x09B9, 1, 1 },
+    { 0x09BC, 0x09C4, 1, 1 },
+    { 0x09C7, 0x09C8, 1, 1 },
+    { 0x09CB, 0x09CE, 1, 1 },
+    { 0x09D7, 0x09D7, 1, 1 },
+    { 0x09DC, 0x09DD, 1, 1 },
+    { 0x09DF, 0x09E3, 1, 1 },
+    { 0x09E6, 0x09F1, 1, 1 },
+    { 0x09FC, 0x09FC, 1, 1 },
+    { 0x09FE, 0x09FE, 1, 1 },
+    { 0x0A01, 0x0A03, 1, 1 },
+    { 0x0A05, 0x0A0A, 1, 1 },
+    { 0x0A0F, 0x0A10, 1, 1 },
+    { 0x0A13, 0x0A28, 1, 1 },
+    { 0x0A2A, 0x0A30, 1, 1 },
+    { 0x0A32, 0x0A33, 1, 1 },
+    { 0x0A35, 0x0A36, 1, 1 },
+    { 0x0A38, 0x0A39, 1, 1 },
+    { 0x0A3C, 0x0A3C, 1, 1 },
+    { 0x0A3E, 0x0A42, 1, 1 },
+    { 0x0A47, 0x0A48, 1, 1 },
+    { 0x0A4B, 0x0A4D, 1, 1 },
+    { 0x0A51, 0x0A51, 1, 1 },
+    { 0x0A59, 0x0A5C, 1, 1 },
+    { 0x0A5E, 0x0A5E, 1, 1 },
+    { 0x0A66, 0x0A75, 1, 1 },
+    { 0x0A81, 0x0A83, 1, 1 },
+    { 0x0A85, 0x0A8D, 1, 1 },
+    { 0x0A8F, 0x0A91, 1, 1 },
+    { 0x0A93, 0x0AA8, 1, 1 },
+    { 0x0AAA, 0x0AB0, 1, 1 },
+    { 0x0AB2, 0x0AB3, 1, 1 },
+    { 0x0AB5, 0x0AB9, 1, 1 },
+    { 0x0ABC, 0x0AC5, 1, 1 },
+    { 0x0AC7, 0x0AC9, 1, 1 },
+    { 0x0ACB, 0x0ACD, 1, 1 },
+    { 0x0AD0, 0x0AD0, 1, 1 },
+    { 0x0AE0, 0x0AE3, 1, 1 },
+    { 0x0AE6, 0x0AEF, 1, 1 },
+    { 0x0AF9, 0x0AFF, 1, 1 },
+    { 0x0B01, 0x0B03, 1, 1 },
+    { 0x0B05, 0x0B0C, 1, 1 },
+    { 0x0B0F, 0x0B10, 1, 1 },
+    { 0x0B13, 0x0B28, 1, 1 },
+    { 0x0B2A, 0x0B30, 1, 1 },
+    { 0x0B32, 0x0B33, 1, 1 },
+    { 0x0B35, 0x0B39, 1, 1 },
+    { 0x0B3C, 0x0B44, 1, 1 },
+    { 0x0B47, 0x0B48, 1, 1 },
+    { 0x0B4B, 0x0B4D, 1, 1 },
+    { 0x0B55, 0x0B57, 1, 1 },
+    { 0x0B5C, 0x0B5D, 1, 1 },
+    { 0x0B5F, 0x0B63, 1, 1 },
+    { 0x0B66, 0x0B6F, 1, 1 },
+    { 0x0B71, 0x0B71, 1, 1 },
+    { 0x0B82, 0x0B83, 1, 1 },
+    { 0x0B85, 0x0B8A, 1, 1 },
+    { 0x0B8E, 0x0B90, 1, 1 },
+    { 0x0B92, 0x0B95, 1, 1 },
+    { 0x0B99, 0x0B9A, 1, 1 },
+    { 0x0B9C, 0x0B9C, 1, 1 },
+    { 0x0B9E, 0x0B9F, 1, 1 },
+    { 0x0BA3, 0x0BA4, 1, 1 },
+    { 0x0BA8, 0x0BAA, 1, 1 },
+    { 0x0BAE, 0x0BB9, 1, 1 },
+    { 0x0BBE, 0x0BC2, 1, 1 },
+    { 0x0BC6, 0x0BC8, 1, 1 },
+    { 0x0BCA, 0x0BCD, 1, 1 },
+    { 0x0BD0, 0x0BD0, 1, 1 },
+    { 0x0BD7, 0x0BD7, 1, 1 },
+    { 0x0BE6, 0x0BEF, 1, 1 },
+    { 0x0C00, 0x0C0C, 1, 1 },
+    { 0x0C0E, 0x0C10, 1, 1 },
+    { 0x0C12, 0x0C28, 1, 1 },
+    { 0x0C2A, 0x0C39, 1, 1 },
+    { 0x0C3C, 0x0C44, 1, 1 },
+    { 0x0C46, 0x0C48, 1, 1 },
+    { 0x0C4A, 0x0C4D, 1, 1 },
+    { 0x0C55, 0x0C56, 1, 1 },
+    { 0x0C58, 0x0C5A, 1, 1 },
+    { 0x0C5D, 0x0C5D, 1, 1 },
+    { 0x0C60, 0x0C63, 1, 1 },
+    { 0x0C66, 0x0C6F, 1, 1 },
+    { 0x0C80, 0x0C83, 1, 1 },
+    { 0x0C85, 0x0C8C, 1, 1 },
+    { 0x0C8E, 0x0C90, 1, 1 },
+    { 0x0C92, 0x0CA8, 1, 1 },
+    { 0x0CAA, 0x0CB3, 1, 1 },
+    { 0x0CB5, 0x0CB9, 1, 1 },
+    { 0x0CBC, 0x0CC4, 1, 1 },
+    { 0x0CC6, 0x0CC8, 1, 1 },
+    { 0x0CCA, 0x0CCD, 1, 1 },
+    { 0x0CD5, 0x0CD6, 1, 1 },
+    { 0x0CDD, 0x0CDE, 1, 1 },
+    { 0x0CE0, 0x0CE3, 1, 1 },
+    { 0x0CE6, 0x0CEF, 1, 1 },
+    { 0x0CF1, 0x0CF2, 1, 1 },
+    { 0x0D00, 0x0D0C, 1, 1 },
+    { 0x0D0E, 0x0D10, 1, 1 },
+    { 0x0D12, 0x0D44, 1, 1 },
+    { 0x0D46, 0x0D48, 1, 1 },
+    { 0x0D4A, 0x0D4E, 1, 1 },
+    { 0x0D54, 0x0D57, 1, 1 },
+    { 0x0D5F, 0x0D63, 1, 1 },
+    { 0x0D66, 0x0D6F, 1, 1 },
+    { 0x0D7A, 0x0D7F, 1, 1 },
+    { 0x0D81, 0x0D83, 1, 1 },
+    { 0x0D85, 0x0D96, 1, 1 },
+    { 0x0D9A, 0x0DB1, 1, 1 },
+    { 0x0DB3, 0x0DBB, 1, 1 },
+    { 0x0DBD, 0x0DBD, 1, 1 },
+    { 0x0DC0, 0x0DC6, 1, 1 },
+    { 0x0DCA, 0x0DCA, 1, 1 },
+    { 0x0DCF, 0x0DD4, 1, 1 },
+    { 0x0DD6, 0x0DD6, 1, 1 },
+    { 0x0DD8, 0x0DDF, 1, 1 },
+    { 0x0DE6, 0x0DEF, 1, 1 },
+    { 0x0DF2, 0x0DF3, 1, 1 },
+    { 0x0E01, 0x0E3A, 1, 1 },
+    { 0x0E40, 0x0E4E, 1, 1 },
+    { 0x0E50, 0x0E59, 1, 1 },
+    { 0x0E81, 0x0E82, 1, 1 },
+    { 0x0E84, 0x0E84, 1, 1 },
+    { 0x0E86, 0x0E8A, 1, 1 },
+    { 0x0E8C, 0x0EA3, 1, 1 },
+    { 0x0EA5, 0x0EA5, 1, 1 },
+    { 0x0EA7, 0x0EBD, 1, 1 },
+    { 0x0EC0, 0x0EC4, 1, 1 },
+    { 0x0EC6, 0x0EC6, 1, 1 },
+    { 0x0EC8, 0x0ECD, 1, 1 },
+    { 0x0ED0, 0x0ED9, 1, 1 },
+    { 0x0EDC, 0x0EDF, 1, 1 },
+    { 0x0F00, 0x0F00, 1, 1 },
+    { 0x0F18, 0x0F19, 1, 1 },
+    { 0x0F20, 0x0F29, 1, 1 },
+    { 0x0F35, 0x0F35, 1, 1 },
+    { 0x0F37, 0x0F37, 1, 1 },
+    { 0x0F39, 0x0F39, 1, 1 },
+    { 0x0F40, 0x0F47, 1, 1 },
+    { 0x0F49, 0x0F6C, 1, 1 },
+    { 0x0F71, 0x0F84, 1, 1 },
+    { 0x0F86, 0x0F97, 1, 1 },
+    { 0x0F99, 0x0FBC, 1, 1 },
+    { 0x0FC6, 0x0FC6, 1, 1 },
+    { 0x1000, 0x1049, 1, 1 },
+    { 0x1050, 0x109D, 1, 1 },
+    { 0x10A0, 0x10C5, 2, 1 },
+    { 0x10C7, 0x10C7, 2, 1 },
+    { 0x10CD, 0x10CD, 2, 1 },
+    { 0x10D0, 0x10FA, 2, 1 },
+    { 0x10FC, 0x10FC, 1, 1 },
+    { 0x10FD, 0x10FF, 2, 1 },
+    { 0x1100, 0x1248, 1, 1 },
+    { 0x124A, 0x124D, 1, 1 },
+    { 0x1250, 0x1256, 1, 1 },
+    { 0x1258, 0x1258, 1, 1 },
+    { 0x125A, 0x125D, 1, 1 },
+    { 0x1260, 0x1288, 1, 1 },
+    { 0x128A, 0x128D, 1, 1 },
+    { 0x1290, 0x12B0, 1, 1 },
+    { 0x12B2, 0x12B5, 1, 1 },
+    { 0x12B8, 0x12BE, 1, 1 },
+    { 0x12C0, 0x12C0, 1, 1 },
+    { 0x12C2, 0x12C5, 1, 1 },
+    { 0x12C8, 0x12D6, 1, 1 },
+    { 0x12D8, 0x1310, 1, 1 },
+    { 0x1312, 0x1315, 1, 1 },
+    { 0x1318, 0x135A, 1, 1 },
+    { 0x135D, 0x135F, 1, 1 },
+    { 0x1380, 0x138F, 1, 1 },
+    { 0x13A0, 0x13F5, 2, 1 },
+    { 0x13F8, 0x13FD, 2, 1 },
+    { 0x1401, 0x166C, 1, 1 },
+    { 0x166F, 0x167F, 1, 1 },
+    { 0x1681, 0x169A, 1, 1 },
+    { 0x16A0, 0x16EA, 1, 1 },
+    { 0x16EE, 0x16F8, 1, 1 },
+    { 0x1700, 0x1714, 1, 1 },
+    { 0x171F, 0x1733, 1, 1 },
+    { 0x1740, 0x1753, 1, 1 },
+    { 0x1760, 0x176C, 1, 1 },
+    { 0x176E, 0x1770, 1, 1 },
+    { 0x1772, 0x1773, 1, 1 },
+    { 0x1780, 0x17D3, 1, 1 },
+    { 0x17D7, 0x17D7, 1, 1 },
+    { 0x17DC, 0x17DD, 1, 1 },
+    { 0x17E0, 0x17E9, 1, 1 },
+    { 0x180B, 0x1819, 1, 1 },
+    { 0x1820, 0x1878, 1, 1 },
+    { 0x1880, 0x18AA, 1, 1 },
+    { 0x18B0, 0x18F5, 1, 1 },
+    { 0x1900, 0x191E, 1, 1 },
+    { 0x1920, 0x192B, 1, 1 },
+    { 0x1930, 0x193B, 1, 1 },
+    { 0x1946, 0x196D, 1, 1 },
+    { 0x1970, 0x1974, 1, 1 },
+    { 0x1980, 0x19AB, 1, 1 },
+    { 0x19B0, 0x19C9, 1, 1 },
+    { 0x19D0, 0x19D9, 1, 1 },
+    { 0x1A00, 0x1A1B, 1, 1 },
+    { 0x1A20, 0x1A5E, 1, 1 },
+    { 0x1A60, 0x1A7C, 1, 1 },
+    { 0x1A7F, 0x1A89, 1, 1 },
+    { 0x1A90, 0x1A99, 1, 1 },
+    { 0x1AA7, 0x1AA7, 1, 1 },
+    { 0x1AB0, 0x1ACE, 1, 1 },
+    { 0x1B00, 0x1B43, 1, 1 },
+    { 0x1B45, 0x1B4C, 1, 1 },
+    { 0x1B50, 0x1B59, 1, 1 },
+    { 0x1B6B, 0x1B73, 1, 1 },
+    { 0x1B80, 0x1BA9, 1, 1 },
+    { 0x1BAB, 0x1BF1, 1, 1 },
+    { 0x1C00, 0x1C37, 1, 1 },
+    { 0x1C40, 0x1C49, 1, 1 },
+    { 0x1C4D, 0x1C7D, 1, 1 },
+    { 0x1C80, 0x1C88, 2, 1 },
+    { 0x1C90, 0x1CBA, 2, 1 },
+    { 0x1CBD, 0x1CBF, 2, 1 },
+    { 0x1CD0, 0x1CD2, 1, 1 },
+    { 0x1CD4, 0x1CE0, 1, 1 },
+    { 0x1CE2, 0x1CF6, 1, 1 },
+    { 0x1CF8, 0x1CFA, 1, 1 },
+    { 0x1D00, 0x1DBF, 2, 1 },
+    { 0x1DC0, 0x1DFF, 1, 1 },
+    { 0x1E00, 0x1F15, 2, 1 },
+    { 0x1F18, 0x1F1D, 2, 1 },
+    { 0x1F20, 0x1F45, 2, 1 },
+    { 0x1F48, 0x1F4D, 2, 1 },
+    { 0x1F50, 0x1F57, 2, 1 },
+    { 0x1F59, 0x1F59, 2, 1 },
+    { 0x1F5B, 0x1F5B, 2, 1 },
+    { 0x1F5D, 0x1F5D, 2, 1 },
+    { 0x1F5F, 0x1F7D, 2, 1 },
+    { 0x1F80, 0x1FB4, 2, 1 },
+    { 0x1FB6, 0x1FBC, 2, 1 },
+    { 0x1FBD, 0x1FBD, 1, 1 },
+    { 0x1FBE, 0x1FBE, 2, 1 },
+    { 0x1FBF, 0x1FC1, 1, 1 },
+    { 0x1FC2, 0x1FC4, 2, 1 },
+    { 0x1FC6, 0x1FCC, 2, 1 },
+    { 0x1FCD, 0x1FCF, 1, 1 },
+    { 0x1FD0, 0x1FD3, 2, 1 },
+    { 0x1FD6, 0x1FDB, 2, 1 },
+    { 0x1FDD, 0x1FDF, 1, 1 },
+    { 0x1FE0, 0x1FEC, 2, 1 },
+    { 0x1FED, 0x1FEF, 1, 1 },
+    { 0x1FF2, 0x1FF4, 2, 1 },
+    { 0x1FF6, 0x1FFC, 2, 1 },
+    { 0x1FFD, 0x1FFE, 1, 1 },
+    { 0x200B, 0x200F, 1, 1 },
+    { 0x2018, 0x2019, 1, 1 },
+    { 0x2024, 0x2024, 1, 1 },
+    { 0x2027, 0x2027, 1, 1 },
+    { 0x202A, 0x202E, 1, 1 },
+    { 0x2060, 0x2064, 1, 1 },
+    { 0x2066, 0x206F, 1, 1 },
+    { 0x2071, 0x2071, 2, 1 },
+    { 0x207F, 0x207F, 2, 1 },
+    { 0x2090, 0x209C, 2, 1 },
+    { 0x20D0, 0x20F0, 1, 1 },
+    { 0x2102, 0x2102, 2, 1 },
+    { 0x2107, 0x2107, 2, 1 },
+    { 0x210A, 0x2113, 2, 1 },
+    { 0x2115, 0x2115, 2, 1 },
+    { 0x2119, 0x211D, 2, 1 },
+    { 0x2124, 0x2124, 2, 1 },
+    { 0x2126, 0x2126, 2, 1 },
+    { 0x2128, 0x2128, 2, 1 },
+    { 0x212A, 0x212D, 2, 1 },
+    { 0x212F, 0x2134, 2, 1 },
+    { 0x2135, 0x2138, 1, 1 },
+    { 0x2139, 0x2139, 2, 1 },
+    { 0x213C, 0x213F, 2, 1 },
+    { 0x2145, 0x2149, 2, 1 },
+    { 0x214E, 0x214E, 2, 1 },
+    { 0x2160, 0x217F, 2, 1 },
+    { 0x2180, 0x2182, 1, 1 },
+    { 0x2183, 0x2184, 2, 1 },
+    { 0x2185, 0x2188, 1, 1 },
+    { 0x24B6, 0x24E9, 2, 1 },
+    { 0x2C00, 0x2CE4, 2, 1 },
+    { 0x2CEB, 0x2CEE, 2, 1 },
+    { 0x2CEF, 0x2CF1, 1, 1 },
+    { 0x2CF2, 0x2CF3, 2, 1 },
+    { 0x2D00, 0x2D25, 2, 1 },
+    { 0x2D27, 0x2D27, 2, 1 },
+    { 0x2D2D, 0x2D2D, 2, 1 },
+    { 0x2D30, 0x2D67, 1, 1 },
+    { 0x2D6F, 0x2D6F, 1, 1 },
+    { 0x2D7F, 0x2D96, 1, 1 },
+    { 0x2DA0, 0x2DA6, 1, 1 },
+    { 0x2DA8, 0x2DAE, 1, 1 },
+    { 0x2DB0, 0x2DB6, 1, 1 },
+    { 0x2DB8, 0x2DBE, 1, 1 },
+    { 0x2DC0, 0x2DC6, 1, 1 },
+    { 0x2DC8, 0x2DCE, 1, 1 },
+    { 0x2DD0, 0x2DD6, 1, 1 },
+    { 0x2DD8, 0x2DDE, 1, 1 },
+    { 0x2DE0, 0x2DFF, 1, 1 },
+    { 0x2E2F, 0x2E2F, 1, 1 },
+    { 0x3005, 0x3007, 1, 1 },
+    { 0x3021, 0x302D, 1, 1 },
+    { 0x3031, 0x3035, 1, 1 },
+    { 0x3038, 0x303C, 1, 1 },
+    { 0x3041, 0x3096, 1, 1 },
+    { 0x3099, 0x309F, 1, 1 },
+    { 0x30A1, 0x30FA, 1, 1 },
+    { 0x30FC, 0x30FF, 1, 1 },
+    { 0x3105, 0x312F, 1, 1 },
+    { 0x3131, 0x318E, 1, 1 },
+    { 0x31A0, 0x31BF, 1, 1 },
+    { 0x31F0, 0x31FF, 1, 1 },
+    { 0x3400, 0x4DBF, 1, 1 },
+    { 0x4E00, 0xA48C, 1, 1 },
+    { 0xA4D0, 0xA4FD, 1, 1 },
+    { 0xA500, 0xA60C, 1, 1 },
+    { 0xA610, 0xA62B, 1, 1 },
+    { 0xA640, 0xA66D, 2, 1 },
+    { 0xA66E, 0xA672, 1, 1 },
+    { 0xA674, 0xA67D, 1, 1 },
+    { 0xA67F, 0xA67F, 1, 1 },
+    { 0xA680, 0xA69D, 2, 1 },
+    { 0xA69E, 0xA6F1, 1, 1 },
+    { 0xA700, 0xA721, 1, 1 },
+    { 0xA722, 0xA787, 2, 1 },
+    { 0xA788, 0xA78A, 1, 1 },
+    { 0xA78B, 0xA78E, 2, 1 },
+    { 0xA78F, 0xA78F, 1, 1 },
+    { 0xA790, 0xA7CA, 2, 1 },
+    { 0xA7D0, 0xA7D1, 2, 1 },
+    { 0xA7D3, 0xA7D3, 2, 1 },
+    { 0xA7D5, 0xA7D9, 2, 1 },
+    { 0xA7F2, 0xA7F4, 1, 1 },
+    { 0xA7F5, 0xA7F6, 2, 1 },
+    { 0xA7F7, 0xA7F7, 1, 1 },
+    { 0xA7F8, 0xA7FA, 2, 1 },
+    { 0xA7FB, 0xA827, 1, 1 },
+    { 0xA82C, 0xA82C, 1, 1 },
+    { 0xA840, 0xA873, 1, 1 },
+    { 0xA880, 0xA8C5, 1, 1 },
+    { 0xA8D0, 0xA8D9, 1, 1 },
+    { 0xA8E0, 0xA8F7, 1, 1 },
+    { 0xA8FB, 0xA8FB, 1, 1 },
+    { 0xA8FD, 0xA92D, 1, 1 },
+    { 0xA930, 0xA952, 1, 1 },
+    { 0xA960, 0xA97C, 1, 1 },
+    { 0xA980, 0xA9BF, 1, 1 },
+    { 0xA9CF, 0xA9D9, 1, 1 },
+    { 0xA9E0, 0xA9FE, 1, 1 },
+    { 0xAA00, 0xAA36, 1, 1 },
+    { 0xAA40, 0xAA4D, 1, 1 },
+    { 0xAA50, 0xAA59, 1, 1 },
+    { 0xAA60, 0xAA76, 1, 1 },
+    { 0xAA7A, 0xAAC2, 1, 1 },
+    { 0xAADB, 0xAADD, 1, 1 },
+    { 0xAAE0, 0xAAEF, 1, 1 },
+    { 0xAAF2, 0xAAF6, 1, 1 },
+    { 0xAB01, 0xAB06, 1, 1 },
+    { 0xAB09, 0xAB0E, 1, 1 },
+    { 0xAB11, 0xAB16, 1, 1 },
+    { 0xAB20, 0xAB26, 1, 1 },
+    { 0xAB28, 0xAB2E, 1, 1 },
+    { 0xAB30, 0xAB5A, 2, 1 },
+    { 0xAB5B, 0xAB5B, 1, 1 },
+    { 0xAB5C, 0xAB68, 2, 1 },
+    { 0xAB69, 0xAB6B, 1, 1 },
+    { 0xAB70, 0xABBF, 2, 1 },
+    { 0xABC0, 0xABEA, 1, 1 },
+    { 0xABED, 0xABED, 1, 1 },
+    { 0xABF0, 0xABF9, 1, 1 },
+    { 0xAC00, 0xD7A3, 1, 1 },
+    { 0xD7B0, 0xD7C6, 1, 1 },
+    { 0xD7CB, 0xD7FB, 1, 1 },
+    { 0xF900, 0xFA6D, 1, 1 },
+    { 0xFA70, 0xFAD9, 1, 1 },
+    { 0xFB00, 0xFB06, 2, 1 },
+    { 0xFB13, 0xFB17, 2, 1 },
+    { 0xFB1D, 0xFB28, 1, 1 },
+    { 0xFB2A, 0xFB36, 1, 1 },
+    { 0xFB38, 0xFB3C, 1, 1 },
+    { 0xFB3E, 0xFB3E, 1, 1 },
+    { 0xFB40, 0xFB41, 1, 1 },
+    { 0xFB43, 0xFB44, 1, 1 },
+    { 0xFB46, 0xFBC2, 1, 1 },
+    { 0xFBD3, 0xFD3D, 1, 1 },
+    { 0xFD50, 0xFD8F, 1, 1 },
+    { 0xFD92, 0xFDC7, 1, 1 },
+    { 0xFDF0, 0xFDFB, 1, 1 },
+    { 0xFE00, 0xFE0F, 1, 1 },
+    { 0xFE13, 0xFE13, 1, 1 },
+    { 0xFE20, 0xFE2F, 1, 1 },
+    { 0xFE52, 0xFE52, 1, 1 },
+    { 0xFE55, 0xFE55, 1, 1 },
+    { 0xFE70, 0xFE74, 1, 1 },
+    { 0xFE76, 0xFEFC, 1, 1 },
+    { 0xFEFF, 0xFEFF, 1, 1 },
+    { 0xFF07, 0xFF07, 1, 1 },
+    { 0xFF0E, 0xFF0E, 1, 1 },
+    { 0xFF10, 0xFF1A, 1, 1 },
+    { 0xFF21, 0xFF3A, 2, 1 },
+    { 0xFF3E, 0xFF3E, 1, 1 },
+    { 0xFF40, 0xFF40, 1, 1 },
+    { 0xFF41, 0xFF5A, 2, 1 },
+    { 0xFF66, 0xFFBE, 1, 1 },
+    { 0xFFC2, 0xFFC7, 1, 1 },
+    { 0xFFCA, 0xFFCF, 1, 1 },
+    { 0xFFD2, 0xFFD7, 1, 1 },
+    { 0xFFDA, 0xFFDC, 1, 1 },
+    { 0xFFE3, 0xFFE3, 1, 1 },
+    { 0xFFF9, 0xFFFB, 1, 1 },
+    { 0x10000, 0x1000B, 1, 1 },
+    { 0x1000D, 0x10026, 1, 1 },
+    { 0x10028, 0x1003A, 1, 1 },
+    { 0x1003C, 0x1003D, 1, 1 },
+    { 0x1003F, 0x1004D, 1, 1 },
+    { 0x10050, 0x1005D, 1, 1 },
+    { 0x10080, 0x100FA, 1, 1 },
+    { 0x10140, 0x10174, 1, 1 },
+    { 0x101FD, 0x101FD, 1, 1 },
+    { 0x10280, 0x1029C, 1, 1 },
+    { 0x102A0, 0x102D0, 1, 1 },
+    { 0x102E0, 0x102E0, 1, 1 },
+    { 0x10300, 0x1031F, 1, 1 },
+    { 0x1032D, 0x1034A, 1, 1 },
+    { 0x10350, 0x1037A, 1, 1 },
+    { 0x10380, 0x1039D, 1, 1 },
+    { 0x103A0, 0x103C3, 1, 1 },
+    { 0x103C8, 0x103CF, 1, 1 },
+    { 0x103D1, 0x103D5, 1, 1 },
+    { 0x10400, 0x1044F, 2, 1 },
+    { 0x10450, 0x1049D, 1, 1 },
+    { 0x104A0, 0x104A9, 1, 1 },
+    { 0x104B0, 0x104D3, 2, 1 },
+    { 0x104D8, 0x104FB, 2, 1 },
+    { 0x10500, 0x10527, 1, 1 },
+    { 0x10530, 0x10563, 1, 1 },
+    { 0x10570, 0x1057A, 2, 1 },
+    { 0x1057C, 0x1058A, 2, 1 },
+    { 0x1058C, 0x10592, 2, 1 },
+    { 0x10594, 0x10595, 2, 1 },
+    { 0x10597, 0x105A1, 2, 1 },
+    { 0x105A3, 0x105B1, 2, 1 },
+    { 0x105B3, 0x105B9, 2, 1 },
+    { 0x105BB, 0x105BC, 2, 1 },
+    { 0x10600, 0x10736, 1, 1 },
+    { 0x10740, 0x10755, 1, 1 },
+    { 0x10760, 0x10767, 1, 1 },
+    { 0x10780, 0x10780, 2, 1 },
+    { 0x10781, 0x10782, 1, 1 },
+    { 0x10783, 0x10785, 2, 1 },
+    { 0x10787, 0x107B0, 2, 1 },
+    { 0x107B2, 0x107BA, 2, 1 },
+    { 0x10800, 0x10805, 1, 1 },
+    { 0x10808, 0x10808, 1, 1 },
+    { 0x1080A, 0x10835, 1, 1 },
+    { 0x10837, 0x10838, 1, 1 },
+    { 0x1083C, 0x1083C, 1, 1 },
+    { 0x1083F, 0x10855, 1, 1 },
+    { 0x10860, 0x10876, 1, 1 },
+    { 0x10880, 0x1089E, 1, 1 },
+    { 0x108E0, 0x108F2, 1, 1 },
+    { 0x108F4, 0x108F5, 1, 1 },
+    { 0x10900, 0x10915, 1, 1 },
+    { 0x10920, 0x10939, 1, 1 },
+    { 0x10980, 0x109B7, 1, 1 },
+    { 0x109BE, 0x109BF, 1, 1 },
+    { 0x10A00, 0x10A03, 1, 1 },
+    { 0x10A05, 0x10A06, 1, 1 },
+    { 0x10A0C, 0x10A13, 1, 1 },
+    { 0x10A15, 0x10A17, 1, 1 },
+    { 0x10A19, 0x10A35, 1, 1 },
+    { 0x10A38, 0x10A3A, 1, 1 },
+    { 0x10A3F, 0x10A3F, 1, 1 },
+    { 0x10A60, 0x10A7C, 1, 1 },
+    { 0x10A80, 0x10A9C, 1, 1 },
+    { 0x10AC0, 0x10AC7, 1, 1 },
+    { 0x10AC9, 0x10AE6, 1, 1 },
+    { 0x10B00, 0x10B35, 1, 1 },
+    { 0x10B40, 0x10B55, 1, 1 },
+    { 0x10B60, 0x10B72, 1, 1 },
+    { 0x10B80, 0x10B91, 1, 1 },
+    { 0x10C00, 0x10C48, 1, 1 },
+    { 0x10C80, 0x10CB2, 2, 1 },
+    { 0x10CC0, 0x10CF2, 2, 1 },
+    { 0x10D00, 0x10D27, 1, 1 },
+    { 0x10D30, 0x10D39, 1, 1 },
+    { 0x10E80, 0x10EA9, 1, 1 },
+    { 0x10EAB, 0x10EAC, 1, 1 },
+    { 0x10EB0, 0x10EB1, 1, 1 },
+    { 0x10F00, 0x10F1C, 1, 1 },
+    { 0x10F27, 0x10F27, 1, 1 },
+    { 0x10F30, 0x10F50, 1, 1 },
+    { 0x10F70, 0x10F85, 1, 1 },
+    { 0x10FB0, 0x10FC4, 1, 1 },
+    { 0x10FE0, 0x10FF6, 1, 1 },
+    { 0x11000, 0x11046, 1, 1 },
+    { 0x11066, 0x11075, 1, 1 },
+    { 0x1107F, 0x110BA, 1, 1 },
+    { 0x110BD, 0x110BD, 1, 1 },
+    { 0x110C2, 0x110C2, 1, 1 },
+    { 0x110CD, 0x110CD, 1, 1 },
+    { 0x110D0, 0x110E8, 1, 1 },
+    { 0x110F0, 0x110F9, 1, 1 },
+    { 0x11100, 0x11134, 1, 1 },
+    { 0x11136, 0x1113F, 1, 1 },
+    { 0x11144, 0x11147, 1, 1 },
+    { 0x11150, 0x11173, 1, 1 },
+    { 0x11176, 0x11176, 1, 1 },
+    { 0x11180, 0x111BF, 1, 1 },
+    { 0x111C1, 0x111C4, 1, 1 },
+    { 0x111C9, 0x111CC, 1, 1 },
+    { 0x111CE, 0x111DA, 1, 1 },
+    { 0x111DC, 0x111DC, 1, 1 },
+    { 0x11200, 0x11211, 1, 1 },
+    { 0x11213, 0x11234, 1, 1 },
+    { 0x11236, 0x11237, 1, 1 },
+    { 0x1123E, 0x1123E, 1, 1 },
+    { 0x11280, 0x11286, 1, 1 },
+    { 0x11288, 0x11288, 1, 1 },
+    { 0x1128A, 0x1128D, 1, 1 },
+    { 0x1128F, 0x1129D, 1, 1 },
+    { 0x1129F, 0x112A8, 1, 1 },
+    { 0x112B0, 0x112EA, 1, 1 },
+    { 0x112F0, 0x112F9, 1, 1 },
+    { 0x11300, 0x11303, 1, 1 },
+    { 0x11305, 0x1130C, 1, 1 },
+    { 0x1130F, 0x11310, 1, 1 },
+    { 0x11313, 0x11328, 1, 1 },
+    { 0x1132A, 0x11330, 1, 1 },
+    { 0x11332, 0x11333, 1, 1 },
+    { 0x11335, 0x11339, 1, 1 },
+    { 0x1133B, 0x11344, 1, 1 },
+    { 0x11347, 0x11348, 1, 1 },
+    { 0x1134B, 0x1134C, 1, 1 },
+    { 0x11350, 0x11350, 1, 1 },
+    { 0x11357, 0x11357, 1, 1 },
+    { 0x1135D, 0x11363, 1, 1 },
+    { 0x11366, 0x1136C, 1, 1 },
+    { 0x11370, 0x11374, 1, 1 },
+    { 0x11400, 0x1144A, 1, 1 },
+    { 0x11450, 0x11459, 1, 1 },
+    { 0x1145E, 0x11461, 1, 1 },
+    { 0x11480, 0x114C5, 1, 1 },
+    { 0x114C7, 0x114C7, 1, 1 },
+    { 0x114D0, 0x114D9, 1, 1 },
+    { 0x11580, 0x115B5, 1, 1 },
+    { 0x115B8, 0x115C0, 1, 1 },
+    { 0x115D8, 0x115DD, 1, 1 },
+    { 0x11600, 0x11640, 1, 1 },
+    { 0x11644, 0x11644, 1, 1 },
+    { 0x11650, 0x11659, 1, 1 },
+    { 0x11680, 0x116B5, 1, 1 },
+    { 0x116B7, 0x116B8, 1, 1 },
+    { 0x116C0, 0x116C9, 1, 1 },
+    { 0x11700, 0x1171A, 1, 1 },
+    { 0x1171D, 0x1172B, 1, 1 },
+    { 0x11730, 0x11739, 1, 1 },
+    { 0x11740, 0x11746, 1, 1 },
+    { 0x11800, 0x1183A, 1, 1 },
+    { 0x118A0, 0x118DF, 2, 1 },
+    { 0x118E0, 0x118E9, 1, 1 },
+    { 0x118FF, 0x11906, 1, 1 },
+    { 0x11909, 0x11909, 1, 1 },
+    { 0x1190C, 0x11913, 1, 1 },
+    { 0x11915, 0x11916, 1, 1 },
+    { 0x11918, 0x11935, 1, 1 },
+    { 0x11937, 0x11938, 1, 1 },
+    { 0x1193B, 0x1193C, 1, 1 },
+    { 0x1193E, 0x11943, 1, 1 },
+    { 0x11950, 0x11959, 1, 1 },
+    { 0x119A0, 0x119A7, 1, 1 },
+    { 0x119AA, 0x119D7, 1, 1 },
+    { 0x119DA, 0x119E1, 1, 1 },
+    { 0x119E3, 0x119E4, 1, 1 },
+    { 0x11A00, 0x11A3E, 1, 1 },
+    { 0x11A47, 0x11A47, 1, 1 },
+    { 0x11A50, 0x11A99, 1, 1 },
+    { 0x11A9D, 0x11A9D, 1, 1 },
+    { 0x11AB0, 0x11AF8, 1, 1 },
+    { 0x11C00, 0x11C08, 1, 1 },
+    { 0x11C0A, 0x11C36, 1, 1 },
+    { 0x11C38, 0x11C40, 1, 1 },
+    { 0x11C50, 0x11C59, 1, 1 },
+    { 0x11C72, 0x11C8F, 1, 1 },
+    { 0x11C92, 0x11CA7, 1, 1 },
+    { 0x11CA9, 0x11CB6, 1, 1 },
+    { 0x11D00, 0x11D06, 1, 1 },
+    { 0x11D08, 0x11D09, 1, 1 },
+    { 0x11D0B, 0x11D36, 1, 1 },
+    { 0x11D3A, 0x11D3A, 1, 1 },
+    { 0x11D3C, 0x11D3D, 1, 1 },
+    { 0x11D3F, 0x11D47, 1, 1 },
+    { 0x11D50, 0x11D59, 1, 1 },
+    { 0x11D60, 0x11D65, 1, 1 },
+    { 0x11D67, 0x11D68, 1, 1 },
+    { 0x11D6A, 0x11D8E, 1, 1 },
+    { 0x11D90, 0x11D91, 1, 1 },
+    { 0x11D93, 0x11D98, 1, 1 },
+    { 0x11DA0, 0x11DA9, 1, 1 },
+    { 0x11EE0, 0x11EF6, 1, 1 },
+    { 0x11FB0, 0x11FB0, 1, 1 },
+    { 0x12000, 0x12399, 1, 1 },
+    { 0x12400, 0x1246E, 1, 1 },
+    { 0x12480, 0x12543, 1, 1 },
+    { 0x12F90, 0x12FF0, 1, 1 },
+    { 0x13000, 0x1342E, 1, 1 },
+    { 0x13430, 0x13438, 1, 1 },
+    { 0x14400, 0x14646, 1, 1 },
+    { 0x16800, 0x16A38, 1, 1 },
+    { 0x16A40, 0x16A5E, 1, 1 },
+    { 0x16A60, 0x16A69, 1, 1 },
+    { 0x16A70, 0x16ABE, 1, 1 },
+    { 0x16AC0, 0x16AC9, 1, 1 },
+    { 0x16AD0, 0x16AED, 1, 1 },
+    { 0x16AF0, 0x16AF4, 1, 1 },
+    { 0x16B00, 0x16B36, 1, 1 },
+    { 0x16B40, 0x16B43, 1, 1 },
+    { 0x16B50, 0x16B59, 1, 1 },
+    { 0x16B63, 0x16B77, 1, 1 },
+    { 0x16B7D, 0x16B8F, 1, 1 },
+    { 0x16E40, 0x16E7F, 2, 1 },
+    { 0x16F00, 0x16F4A, 1, 1 },
+    { 0x16F4F, 0x16F87, 1, 1 },
+    { 0x16F8F, 0x16F9F, 1, 1 },
+    { 0x16FE0, 0x16FE1, 1, 1 },
+    { 0x16FE3, 0x16FE4, 1, 1 },
+    { 0x16FF0, 0x16FF1, 1, 1 },
+    { 0x17000, 0x187F7, 1, 1 },
+    { 0x18800, 0x18CD5, 1, 1 },
+    { 0x18D00, 0x18D08, 1, 1 },
+    { 0x1AFF0, 0x1AFF3, 1, 1 },
+    { 0x1AFF5, 0x1AFFB, 1, 1 },
+    { 0x1AFFD, 0x1AFFE, 1, 1 },
+    { 0x1B000, 0x1B122, 1, 1 },
+    { 0x1B150, 0x1B152, 1, 1 },
+    { 0x1B164, 0x1B167, 1, 1 },
+    { 0x1B170, 0x1B2FB, 1, 1 },
+    { 0x1BC00, 0x1BC6A, 1, 1 },
+    { 0x1BC70, 0x1BC7C, 1, 1 },
+    { 0x1BC80, 0x1BC88, 1, 1 },
+    { 0x1BC90, 0x1BC99, 1, 1 },
+    { 0x1BC9D, 0x1BC9E, 1, 1 },
+    { 0x1BCA0, 0x1BCA3, 1, 1 },
+    { 0x1CF00, 0x1CF2D, 1, 1 },
+    { 0x1CF30, 0x1CF46, 1, 1 },
+    { 0x1D167, 0x1D169, 1, 1 },
+    { 0x1D173, 0x1D182, 1, 1 },
+    { 0x1D185, 0x1D18B, 1, 1 },
+    { 0x1D1AA, 0x1D1AD, 1, 1 },
+    { 0x1D242, 0x1D244, 1, 1 },
+    { 0x1D400, 0x1D454, 2, 1 },
+    { 0x1D456, 0x1D49C, 2, 1 },
+    { 0x1D49E, 0x1D49F, 2, 1 },
+    { 0x1D4A2, 0x1D4A2, 2, 1 },
+    { 0x1D4A5, 0x1D4A6, 2, 1 },
+    { 0x1D4A9, 0x1D4AC, 2, 1 },
+    { 0x1D4AE, 0x1D4B9, 2, 1 },
+    { 0x1D4BB, 0x1D4BB, 2, 1 },
+    { 0x1D4BD, 0x1D4C3, 2, 1 },
+    { 0x1D4C5, 0x1D505, 2, 1 },
+    { 0x1D507, 0x1D50A, 2, 1 },
+    { 0x1D50D, 0x1D514, 2, 1 },
+    { 0x1D516, 0x1D51C, 2, 1 },
+    { 0x1D51E, 0x1D539, 2, 1 },
+    { 0x1D53B, 0x1D53E, 2, 1 },
+    { 0x1D540, 0x1D544, 2, 1 },
+    { 0x1D546, 0x1D546, 2, 1 },
+    { 0x1D54A, 0x1D550, 2, 1 },
+    { 0x1D552, 0x1D6A5, 2, 1 },
+    { 0x1D6A8, 0x1D6C0, 2, 1 },
+    { 0x1D6C2, 0x1D6DA, 2, 1 },
+    { 0x1D6DC, 0x1D6FA, 2, 1 },
+    { 0x1D6FC, 0x1D714, 2, 1 },
+    { 0x1D716, 0x1D734, 2, 1 },
+    { 0x1D736, 0x1D74E, 2, 1 },
+    { 0x1D750, 0x1D76E, 2, 1 },
+    { 0x1D770, 0x1D788, 2, 1 },
+    { 0x1D78A, 0x1D7A8, 2, 1 },
+    { 0x1D7AA, 0x1D7C2, 2, 1 },
+    { 0x1D7C4, 0x1D7CB, 2, 1 },
+    { 0x1D7CE, 0x1D7FF, 1, 1 },
+    { 0x1DA00, 0x1DA36, 1, 1 },
+    { 0x1DA3B, 0x1DA6C, 1, 1 },
+    { 0x1DA75, 0x1DA75, 1, 1 },
+    { 0x1DA84, 0x1DA84, 1, 1 },
+    { 0x1DA9B, 0x1DA9F, 1, 1 },
+    { 0x1DAA1, 0x1DAAF, 1, 1 },
+    { 0x1DF00, 0x1DF09, 2, 1 },
+    { 0x1DF0A, 0x1DF0A, 1, 1 },
+    { 0x1DF0B, 0x1DF1E, 2, 1 },
+    { 0x1E000, 0x1E006, 1, 1 },
+    { 0x1E008, 0x1E018, 1, 1 },
+    { 0x1E01B, 0x1E021, 1, 1 },
+    { 0x1E023, 0x1E024, 1, 1 },
+    { 0x1E026, 0x1E02A, 1, 1 },
+    { 0x1E100, 0x1E12C, 1, 1 },
+    { 0x1E130, 0x1E13D, 1, 1 },
+    { 0x1E140, 0x1E149, 1, 1 },
+    { 0x1E14E, 0x1E14E, 1, 1 },
+    { 0x1E290, 0x1E2AE, 1, 1 },
+    { 0x1E2C0, 0x1E2F9, 1, 1 },
+    { 0x1E7E0, 0x1E7E6, 1, 1 },
+    { 0x1E7E8, 0x1E7EB, 1, 1 },
+    { 0x1E7ED, 0x1E7EE, 1, 1 },
+    { 0x1E7F0, 0x1E7FE, 1, 1 },
+    { 0x1E800, 0x1E8C4, 1, 1 },
+    { 0x1E8D0, 0x1E8D6, 1, 1 },
+    { 0x1E900, 0x1E943, 2, 1 },
+    { 0x1E944, 0x1E94B, 1, 1 },
+    { 0x1E950, 0x1E959, 1, 1 },
+    { 0x1EE00, 0x1EE03, 1, 1 },
+    { 0x1EE05, 0x1EE1F, 1, 1 },
+    { 0x1EE21, 0x1EE22, 1, 1 },
+    { 0x1EE24, 0x1EE24, 1, 1 },
+    { 0x1EE27, 0x1EE27, 1, 1 },
+    { 0x1EE29, 0x1EE32, 1, 1 },
+    { 0x1EE34, 0x1EE37, 1, 1 },
+    { 0x1EE39, 0x1EE39, 1, 1 },
+    { 0x1EE3B, 0x1EE3B, 1, 1 },
+    { 0x1EE42, 0x1EE42, 1, 1 },
+    { 0x1EE47, 0x1EE47, 1, 1 },
+    { 0x1EE49, 0x1EE49, 1, 1 },
+    { 0x1EE4B, 0x1EE4B, 1, 1 },
+    { 0x1EE4D, 0x1EE4F, 1, 1 },
+    { 0x1EE51, 0x1EE52, 1, 1 },
+    { 0x1EE54, 0x1EE54, 1, 1 },
+    { 0x1EE57, 0x1EE57, 1, 1 },
+    { 0x1EE59, 0x1EE59, 1, 1 },
+    { 0x1EE5B, 0x1EE5B, 1, 1 },
+    { 0x1EE5D, 0x1EE5D, 1, 1 },
+    { 0x1EE5F, 0x1EE5F, 1, 1 },
+    { 0x1EE61, 0x1EE62, 1, 1 },
+    { 0x1EE64, 0x1EE64, 1, 1 },
+    { 0x1EE67, 0x1EE6A, 1, 1 },
+    { 0x1EE6C, 0x1EE72, 1, 1 },
+    { 0x1EE74, 0x1EE77, 1, 1 },
+    { 0x1EE79, 0x1EE7C, 1, 1 },
+    { 0x1EE7E, 0x1EE7E, 1, 1 },
+    { 0x1EE80, 0x1EE89, 1, 1 },
+    { 0x1EE8B, 0x1EE9B, 1, 1 },
+    { 0x1EEA1, 0x1EEA3, 1, 1 },
+    { 0x1EEA5, 0x1EEA9, 1, 1 },
+    { 0x1EEAB, 0x1EEBB, 1, 1 },
+    { 0x1F130, 0x1F149, 2, 1 },
+    { 0x1F150, 0x1F169, 2, 1 },
+    { 0x1F170, 0x1F189, 2, 1 },
+    { 0x1F3FB, 0x1F3FF, 1, 1 },
+    { 0x1FBF0, 0x1FBF9, 1, 1 },
+    { 0x20000, 0x2A6DF, 1, 1 },
+    { 0x2A700, 0x2B738, 1, 1 },
+    { 0x2B740, 0x2B81D, 1, 1 },
+    { 0x2B820, 0x2CEA1, 1, 1 },
+    { 0x2CEB0, 0x2EBE0, 1, 1 },
+    { 0x2F800, 0x2FA1D, 1, 1 },
+    { 0x30000, 0x3134A, 1, 1 },
+    { 0xE0001, 0xE0001, 1, 1 },
+    { 0xE0020, 0xE007F, 1, 1 },
+    { 0xE0100, 0xE01EF, 1, 1 },
+};
+
+const unsigned char Parrot_latin1_upper[256] = {
+0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, /* 0-7 */
+0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, /* 8-15 */
+0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, /* 16-23 */
+0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, /* 24-31 */
+0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, /* 32-39 */
+0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, /* 40-47 */
+0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, /* 48-55 */
+0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f, /* 56-63 */
+0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, /* 64-71 */
+0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, /* 72-79 */
+0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, /* 80-87 */
+0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f, /* 88-95 */
+0x60, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, /* 96-103 */
+0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, /* 104-111 */
+0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, /* 112-119 */
+0x58, 0x59, 0x5a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f, /* 120-127 */
+0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, /* 128-135 */
+0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f, /* 136-143 */
+0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, /* 144-151 */
+0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f, /* 152-159 */
+0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, /* 160-167 */
+0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf, /* 168-175 */
+0xb0, 0xb1, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, /* 176-183 */
+0xb8, 0xb9, 0xba, 0xbb, 0xbc, 0xbd, 0xbe, 0xbf, /* 184-191 */
+0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, /* 192-199 */
+0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf, /* 200-207 */
+0xd0, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, /* 208-215 */
+0xd8, 0xd9, 0xda, 0xdb, 0xdc, 0xdd, 0xde, 0xdf, /* 216-223 */
+0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, /* 224-231 */
+0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf, /* 232-239 */
+0xd0, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xf7, /* 240-247 */
+0xd8, 0xd9, 0xda, 0xdb, 0xdc, 0xdd, 0xde, 0xff, /* 248-255 */
+};
+
+const unsigned char Parrot_latin1_lower[256] = {
+0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, /* 0-7 */
+0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, /* 8-15 */
+0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, /* 16-23 */
+0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, /* 24-31 */
+0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, /* 32-39 */
+0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, /* 40-47 */
+0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, /* 48-55 */
+0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f, /* 56-63 */
+0x40, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, /* 64-71 */
+0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, /* 72-79 */
+0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, /* 80-87 */
+0x78, 0x79, 0x7a, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f, /* 88-95 */
+0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, /* 96-103 */
+0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, /* 104-111 */
+0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, /* 112-119 */
+0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f, /* 120-127 */
+0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, /* 128-135 */
+0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f, /* 136-143 */
+0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, /* 144-151 */
+0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f, /* 152-159 */
+0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, /* 160-167 */
+0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf, /* 168-175 */
+0xb0, 0xb1, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, /* 176-183 */
+0xb8, 0xb9, 0xba, 0xbb, 0xbc, 0xbd, 0xbe, 0xbf, /* 184-191 */
+0xe0, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, /* 192-199 */
+0xe8, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef, /* 200-207 */
+0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xd7, /* 208-215 */
+0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xdf, /* 216-223 */
+0xe0, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, /* 224-231 */
+0xe8, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef, /* 232-239 */
+0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, /* 240-247 */
+0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff, /* 248-255 */
+};
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -0,0 +1,59 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from 'tools/dev/gen_case_tables.pl'.
+ *
+ * Case mapping tables for the latin1, UTF-8 and UCS-4 encodings,
+ * generated from Unicode 14.0.0.
+ *
+ * Copyright (C) 2014, Parrot Foundation.
+ */
+
+/* HEADERIZER HFILE: none */
+
+
+#ifndef PARROT_CASE_TABLES_H_GUARD
+#define PARROT_CASE_TABLES_H_GUARD
+#include "parrot/parrot.h"
+
+/* Codepoints first..last (every step'th) map to codepoint + delta. */
+typedef struct Parrot_case_run {
+    Parrot_UInt4 first;
+    Parrot_UInt4 last;
+    Parrot_Int4  delta;
+    Parrot_UInt4 step;
+} Parrot_case_run;
+
+/* Mapping to up to three codepoints, 0 terminated when shorter. */
+typedef struct Parrot_case_full {
+    Parrot_UInt4 codepoint;
+    Parrot_UInt4 mapping[3];
+} Parrot_case_full;
+
+/* In the word runs delta is the class: 2 cased, 1 other word characters. */
+#define PARROT_CASE_WORD_CASED 2
+
+#define PARROT_CASE_UPPER_RUNS 194
+#define PARROT_CASE_UPPER_FULL 102
+#define PARROT_CASE_LOWER_RUNS 181
+#define PARROT_CASE_LOWER_FULL 1
+#define PARROT_CASE_TITLE_RUNS 196
+#define PARROT_CASE_TITLE_FULL 48
+#define PARROT_CASE_WORD_RUNS 843
+
+extern const Parrot_case_run  Parrot_case_upper_runs[];
+extern const Parrot_case_full Parrot_case_upper_full[];
+extern const Parrot_case_run  Parrot_case_lower_runs[];
+extern const Parrot_case_full Parrot_case_lower_full[];
+extern const Parrot_case_run  Parrot_case_title_runs[];
+extern const Parrot_case_full Parrot_case_title_full[];
+extern const Parrot_case_run  Parrot_case_word_runs[];
+extern const unsigned char    Parrot_latin1_upper[256];
+extern const unsigned char    Parrot_latin1_lower[256];
+#endif /* PARROT_CASE_TABLES_H_GUARD */
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -18,6 +18,7 @@ This file implements encoding functions for ISO-8859-1 strings.
 #include "parrot/parrot.h"
 #include "shared.h"
 #include "tables.h"
+#include "casetables.h"
 
 /* HEADERIZER HFILE: none */
 
@@ -39,6 +40,16 @@ static STRING* latin1_downcase_first(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+PARROT_CANNOT_RETURN_NULL
+static STRING * latin1_map_case(PARROT_INTERP,
+    ARGIN(const STRING *src),
+    ARGIN(const unsigned char *first),
+    ARGIN(const unsigned char *rest))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4);
+
 static INTVAL latin1_partial_scan(PARROT_INTERP,
     ARGIN(const char *buf),
     ARGMOD(Parrot_String_Bounds *bounds))
@@ -85,6 +96,11 @@ static STRING* latin1_upcase_first(PARROT_INTERP, ARGIN(const STRING *src))
 #define ASSERT_ARGS_latin1_downcase_first __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(src))
+#define ASSERT_ARGS_latin1_map_case __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(src) \
+    , PARROT_ASSERT_ARG(first) \
+    , PARROT_ASSERT_ARG(rest))
 #define ASSERT_ARGS_latin1_partial_scan __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(buf) \
     , PARROT_ASSERT_ARG(bounds))
@@ -219,6 +235,47 @@ latin1_partial_scan(SHIM_INTERP, ARGIN(const char *buf), ARGMOD(Parrot_String_Bo
 }
 
 
+/*
+
+=item C<static STRING * latin1_map_case(PARROT_INTERP, const STRING *src, const
+unsigned char *first, const unsigned char *rest)>
+
+Returns a copy of C<src> with the first character mapped through the table
+C<first> and the others through C<rest>. The tables come from
+F<src/string/encoding/casetables.c>; characters whose mapping is not in
+latin1, like C<\xff> or C<\xdf>, are left unchanged.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+static STRING *
+latin1_map_case(PARROT_INTERP, ARGIN(const STRING *src),
+        ARGIN(const unsigned char *first), ARGIN(const unsigned char *rest))
+{
+    ASSERT_ARGS(latin1_map_case)
+    const UINTVAL        n      = src->bufused;
+    STRING      * const  result = Parrot_str_new_init(interp, NULL, n,
+                                      src->encoding, 0);
+    /* taken after the allocation, which can move the buffer of src */
+    const unsigned char *s      = (const unsigned char *)src->strstart;
+    unsigned char       *d      = (unsigned char *)result->strstart;
+    UINTVAL              i;
+
+    if (n)
+        d[0] = first[s[0]];
+
+    for (i = 1; i < n; ++i)
+        d[i] = rest[s[i]];
+
+    result->bufused = n;
+    result->strlen  = n;
+
+    return result;
+}
+
+
 /*
 
 =item C<static STRING* latin1_upcase(PARROT_INTERP, const STRING *src)>
@@ -235,24 +292,8 @@ static STRING*
 latin1_upcase(PARROT_INTERP, ARGIN(const STRING *src))
 {
     ASSERT_ARGS(latin1_upcase)
-    unsigned char *buffer;
-    UINTVAL offset;
-    STRING * const result = Parrot_str_clone(interp, src);
-
-    if (result->strlen == 0)
-        return result;
-
-    buffer = (unsigned char *)result->strstart;
-    for (offset = 0; offset < result->strlen; ++offset) {
-        unsigned int c = buffer[offset]; /* XXX use encoding ? */
-        if (c >= 0xe0 && c != 0xf7)
-            c &= ~0x20;
-        else
-            c = toupper((unsigned char)c);
-        buffer[offset] = (unsigned char)c;
-    }
-
-    return result;
+    return latin1_map_case(interp, src, Parrot_latin1_upper,
+            Parrot_latin1_upper);
 }
 
 
@@ -272,24 +313,8 @@ static STRING*
 latin1_downcase(PARROT_INTERP, ARGIN(const STRING *src))
 {
     ASSERT_ARGS(latin1_downcase)
-    unsigned char *buffer;
-    UINTVAL offset;
-    STRING * const result = Parrot_str_clone(interp, src);
-
-    if (result->strlen == 0)
-        return result;
-
-    buffer = (unsigned char *)result->strstart;
-    for (offset = 0; offset < result->strlen; ++offset) {
-        unsigned int c = buffer[offset];
-        if (c >= 0xc0 && c != 0xd7 && c <= 0xde)
-            c |= 0x20;
-        else
-            c = tolower((unsigned char)c);
-        buffer[offset] = (unsigned char)c;
-    }
-
-    return result;
+    return latin1_map_case(interp, src, Parrot_latin1_lower,
+            Parrot_latin1_lower);
 }
 
 
@@ -309,32 +334,8 @@ static STRING*
 latin1_titlecase(PARROT_INTERP, ARGIN(const STRING *src))
 {
     ASSERT_ARGS(latin1_titlecase)
-    unsigned char *buffer;
-    unsigned int   c;
-    UINTVAL        offset;
-    STRING * const result = Parrot_str_clone(interp, src);
-
-    if (result->strlen == 0)
-        return result;
-
-    buffer = (unsigned char *)result->strstart;
-    c = buffer[0];
-    if (c >= 0xe0 && c != 0xf7)
-        c &= ~0x20;
-    else
-        c = toupper((unsigned char)c);
-    buffer[0] = (unsigned char)c;
-
-    for (offset = 1; offset < result->strlen; ++offset) {
-        c = buffer[offset];
-        if (c >= 0xc0 && c != 0xd7 && c <= 0xde)
-            c |= 0x20;
-        else
-            c = tolower((unsigned char)c);
-        buffer[offset] = (unsigned char)c;
-    }
-
-    return result;
+    return latin1_map_case(interp, src, Parrot_latin1_upper,
+            Parrot_latin1_lower);
 }
 
 
@@ -354,20 +355,12 @@ static STRING*
 latin1_upcase_first(PARROT_INTERP, ARGIN(const STRING *src))
 {
     ASSERT_ARGS(latin1_upcase_first)
-    unsigned char *buffer;
-    unsigned int   c;
     STRING * const result = Parrot_str_clone(interp, src);
 
-    if (result->strlen == 0)
-        return result;
-
-    buffer = (unsigned char *)result->strstart;
-    c = buffer[0];
-    if (c >= 0xe0 && c != 0xf7)
-        c &= ~0x20;
-    else
-        c = toupper((unsigned char)c);
-    buffer[0] = (unsigned char)c;
+    if (result->strlen > 0) {
+        unsigned char * const buffer = (unsigned char *)result->strstart;
+        buffer[0] = Parrot_latin1_upper[buffer[0]];
+    }
 
     return result;
 }
@@ -389,20 +382,12 @@ static STRING*
 latin1_downcase_first(PARROT_INTERP, ARGIN(const STRING *src))
 {
     ASSERT_ARGS(latin1_downcase_first)
-    unsigned char *buffer;
-    unsigned int   c;
     STRING * const result = Parrot_str_clone(interp, src);
 
-    if (result->strlen == 0)
-        return result;
-
-    buffer = (unsigned char *)result->strstart;
-    c = buffer[0];
-    if (c >= 0xc0 && c != 0xd7 && c <= 0xde)
-        c &= ~0x20;
-    else
-        c = tolower((unsigned char)c);
-    buffer[0] = (unsigned char)c;
+    if (result->strlen > 0) {
+        unsigned char * const buffer = (unsigned char *)result->strstart;
+        buffer[0] = Parrot_latin1_lower[buffer[0]];
+    }
 
     return result;
 }
@@ -21,7 +21,9 @@ Functions starting with unicode_ work with unicode strings.
 
 #include "parrot/parrot.h"
 #include "tables.h"
+#include "casetables.h"
 #include "shared.h"
+#include "unicode.h"
 
 #if PARROT_HAS_ICU
 #  include <unicode/ucnv.h>
@@ -36,6 +38,21 @@ Functions starting with unicode_ work with unicode strings.
 /* HEADERIZER BEGIN: static */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static const Parrot_case_run * case_find_run(
+    ARGIN(const Parrot_case_run *runs),
+    UINTVAL n,
+    UINTVAL c)
+        __attribute__nonnull__(1);
+
+static UINTVAL case_map_codepoint(
+    UINTVAL c,
+    int mode,
+    ARGOUT(Parrot_UInt4 *out))
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*out);
+
 static size_t convert_case_buf(PARROT_INTERP,
     ARGMOD_NULLOK(char *dest_buf),
     size_t dest_len,
@@ -46,6 +63,21 @@ static size_t convert_case_buf(PARROT_INTERP,
         __attribute__nonnull__(4)
         FUNC_MODIFIES(*dest_buf);
 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static STRING * transcode_fixed_to_utf8(PARROT_INTERP,
+    ARGIN(const STRING *src),
+    UINTVAL width)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static STRING * transcode_utf8_to_utf16(PARROT_INTERP,
+    ARGIN(const STRING *src))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 static int u_iscclass(PARROT_INTERP, UINTVAL codepoint, INTVAL flags)
         __attribute__nonnull__(1);
 
@@ -56,14 +88,34 @@ static STRING* unicode_convert_case(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+PARROT_CANNOT_RETURN_NULL
+static STRING * unicode_native_case(PARROT_INTERP,
+    ARGIN(const STRING *src),
+    int mode)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+#define ASSERT_ARGS_case_find_run __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(runs))
+#define ASSERT_ARGS_case_map_codepoint __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(out))
 #define ASSERT_ARGS_convert_case_buf __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(src_buf))
+#define ASSERT_ARGS_transcode_fixed_to_utf8 __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(src))
+#define ASSERT_ARGS_transcode_utf8_to_utf16 __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(src))
 #define ASSERT_ARGS_u_iscclass __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_unicode_convert_case __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(src))
+#define ASSERT_ARGS_unicode_native_case __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(src))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
@@ -94,6 +146,19 @@ encoding_to_encoding(PARROT_INTERP, ARGIN(const STRING *src),
     if (src->encoding == encoding)
         return Parrot_str_clone(interp, src);
 
+    /* direct loops for the common unicode pairs, without iterators */
+    if (encoding == Parrot_utf8_encoding_ptr) {
+        if (STRING_max_bytes_per_codepoint(src) == 1)
+            return transcode_fixed_to_utf8(interp, src, 1);
+        if (src->encoding == Parrot_ucs2_encoding_ptr)
+            return transcode_fixed_to_utf8(interp, src, 2);
+        if (src->encoding == Parrot_ucs4_encoding_ptr)
+            return transcode_fixed_to_utf8(interp, src, 4);
+    }
+    else if (encoding == Parrot_utf16_encoding_ptr
+         &&  src->encoding == Parrot_utf8_encoding_ptr)
+        return transcode_utf8_to_utf16(interp, src);
+
     src_len          = src->strlen;
     result           = Parrot_gc_new_string_header(interp, 0);
     result->encoding = encoding;
@@ -132,6 +197,163 @@ encoding_to_encoding(PARROT_INTERP, ARGIN(const STRING *src),
 }
 
 
+/*
+
+=item C<static STRING * transcode_fixed_to_utf8(PARROT_INTERP, const STRING
+*src, UINTVAL width)>
+
+Converts C<src>, a string of C<width> bytes per codepoint (one for the single
+byte encodings, two for UCS-2, four for UCS-4), to UTF-8. A first pass sizes
+the result exactly; runs of ASCII are then copied a word at a time.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static STRING *
+transcode_fixed_to_utf8(PARROT_INTERP, ARGIN(const STRING *src), UINTVAL width)
+{
+    ASSERT_ARGS(transcode_fixed_to_utf8)
+    const unsigned char * const s8  = (const unsigned char *)src->strstart;
+    const utf16_t       * const s16 = (const utf16_t *)src->strstart;
+    const Parrot_UInt4  * const s32 = (const Parrot_UInt4 *)src->strstart;
+    const UINTVAL               len = src->strlen;
+    STRING                     *result;
+    utf8_t                     *d;
+    UINTVAL                     bytes = 0;
+    UINTVAL                     i;
+
+    for (i = 0; i < len; ++i) {
+        const UINTVAL c = width == 1 ? s8[i] : width == 2 ? s16[i] : s32[i];
+
+        if (c >= 0x80 && UNICODE_IS_INVALID(c))
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_CHARACTER,
+                    "Invalid character for UTF-8 encoding\n");
+
+        bytes += UNISKIP(c);
+    }
+
+    result = Parrot_str_new_init(interp, NULL, bytes, Parrot_utf8_encoding_ptr, 0);
+    d      = (utf8_t *)result->strstart;
+
+    for (i = 0; i < len;) {
+        UINTVAL c;
+
+        if (width == 1) {
+            const UINTVAL n = encoding_ascii_span(s8 + i, len - i);
+
+            if (n) {
+                memcpy(d, s8 + i, n);
+                d += n;
+                i += n;
+                continue;
+            }
+        }
+
+        c = width == 1 ? s8[i] : width == 2 ? s16[i] : s32[i];
+        ++i;
+
+        if (c < 0x80)
+            *d++ = c;
+        else if (c < 0x800) {
+            d[0] = 0xC0 | (c >> 6);
+            d[1] = 0x80 | (c & UTF8_CONTINUATION_MASK);
+            d   += 2;
+        }
+        else if (c < 0x10000) {
+            d[0] = 0xE0 | (c >> 12);
+            d[1] = 0x80 | ((c >> 6) & UTF8_CONTINUATION_MASK);
+            d[2] = 0x80 | (c & UTF8_CONTINUATION_MASK);
+            d   += 3;
+        }
+        else {
+            d[0] = 0xF0 | (c >> 18);
+            d[1] = 0x80 | ((c >> 12) & UTF8_CONTINUATION_MASK);
+            d[2] = 0x80 | ((c >> 6) & UTF8_CONTINUATION_MASK);
+            d[3] = 0x80 | (c & UTF8_CONTINUATION_MASK);
+            d   += 4;
+        }
+    }
+
+    result->bufused = bytes;
+    result->strlen  = len;
+
+    return result;
+}
+
+
+/*
+
+=item C<static STRING * transcode_utf8_to_utf16(PARROT_INTERP, const STRING
+*src)>
+
+Converts the UTF-8 string C<src> to UTF-16. C<src> was validated when it was
+scanned, so codepoints are decoded straight from the buffer; the result is
+sized by counting the four byte sequences, which need surrogate pairs.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static STRING *
+transcode_utf8_to_utf16(PARROT_INTERP, ARGIN(const STRING *src))
+{
+    ASSERT_ARGS(transcode_utf8_to_utf16)
+    const utf8_t * const s     = (const utf8_t *)src->strstart;
+    const UINTVAL        len   = src->bufused;
+    UINTVAL              units = src->strlen;
+    STRING              *result;
+    utf16_t             *d;
+    UINTVAL              i;
+
+    for (i = 0; i < len; ++i)
+        if (s[i] >= 0xF0)
+            ++units;
+
+    result = Parrot_str_new_init(interp, NULL, units * 2,
+                Parrot_utf16_encoding_ptr, 0);
+    d      = (utf16_t *)result->strstart;
+
+    for (i = 0; i < len;) {
+        UINTVAL c = s[i];
+
+        if (c < 0x80) {
+            *d++ = c;
+            ++i;
+        }
+        else if (c < 0xE0) {
+            *d++ = ((c & 0x1F) << 6) | (s[i + 1] & UTF8_CONTINUATION_MASK);
+            i   += 2;
+        }
+        else if (c < 0xF0) {
+            *d++ = ((c & 0x0F) << 12)
+                 | ((s[i + 1] & UTF8_CONTINUATION_MASK) << 6)
+                 |  (s[i + 2] & UTF8_CONTINUATION_MASK);
+            i   += 3;
+        }
+        else {
+            c = ((c & 0x07) << 18)
+              | ((s[i + 1] & UTF8_CONTINUATION_MASK) << 12)
+              | ((s[i + 2] & UTF8_CONTINUATION_MASK) << 6)
+              |  (s[i + 3] & UTF8_CONTINUATION_MASK);
+            d[0] = UNICODE_HIGH_SURROGATE(c);
+            d[1] = UNICODE_LOW_SURROGATE(c);
+            d   += 2;
+            i   += 4;
+        }
+    }
+
+    result->bufused = units * 2;
+    result->strlen  = src->strlen;
+
+    return result;
+}
+
+
 /*
 
 =item C<INTVAL encoding_equal(PARROT_INTERP, const STRING *lhs, const STRING
@@ -279,9 +501,8 @@ encoding_rindex(PARROT_INTERP, ARGIN(const STRING *src),
         ARGIN(const STRING *search), INTVAL offset)
 {
     ASSERT_ARGS(encoding_rindex)
-    String_iter search_iter, search_start, start;
+    String_iter start, end;
     const UINTVAL len = search->strlen;
-    UINTVAL c0;
     INTVAL  skip;
 
     if (offset < 0
@@ -297,34 +518,7 @@ encoding_rindex(PARROT_INTERP, ARGIN(const STRING *src),
     STRING_ITER_INIT(interp, &start);
     STRING_iter_skip(interp, src, &start, skip);
 
-    STRING_ITER_INIT(interp, &search_start);
-    c0 = STRING_iter_get_and_advance(interp, search, &search_start);
-
-    while (1) {
-        UINTVAL c1 = STRING_iter_get(interp, src, &start, 0);
-
-        if (c1 == c0) {
-            UINTVAL c2;
-            String_iter iter = start;
-
-            STRING_iter_skip(interp, src, &iter, 1);
-            search_iter = search_start;
-
-            do {
-                if (search_iter.charpos >= len)
-                    return start.charpos;
-                c1 = STRING_iter_get_and_advance(interp, src, &iter);
-                c2 = STRING_iter_get_and_advance(interp, search, &search_iter);
-            } while (c1 == c2);
-        }
-
-        if (start.charpos == 0)
-            break;
-
-        STRING_iter_skip(interp, src, &start, -1);
-    }
-
-    return -1;
+    return Parrot_str_iter_rindex(interp, src, &start, &end, search);
 }
 
 
@@ -520,7 +714,6 @@ encoding_substr(PARROT_INTERP, ARGIN(const STRING *src), INTVAL offset, INTVAL l
 {
     ASSERT_ARGS(encoding_substr)
     const UINTVAL  strlen = STRING_length(src);
-    STRING        *return_string;
     String_iter    iter;
     UINTVAL        start;
 
@@ -537,10 +730,8 @@ encoding_substr(PARROT_INTERP, ARGIN(const STRING *src), INTVAL offset, INTVAL l
             "Cannot take substr outside string");
     }
 
-    return_string = Parrot_str_copy(interp, src);
-
     if (offset == 0 && (UINTVAL)length >= strlen)
-        return return_string;
+        return Parrot_str_copy(interp, src);
 
     STRING_ITER_INIT(interp, &iter);
 
@@ -548,21 +739,15 @@ encoding_substr(PARROT_INTERP, ARGIN(const STRING *src), INTVAL offset, INTVAL l
         STRING_iter_skip(interp, src, &iter, offset);
 
     start = iter.bytepos;
-    return_string->strstart += start;
 
-    if ((UINTVAL)length >= strlen - (UINTVAL)offset) {
-        return_string->bufused -= start;
-        return_string->strlen  -= offset;
-    }
-    else {
-        STRING_iter_skip(interp, src, &iter, length);
-        return_string->bufused = iter.bytepos - start;
-        return_string->strlen  = length;
-    }
+    if ((UINTVAL)length >= strlen - (UINTVAL)offset)
+        return Parrot_str_new_slice(interp, src, start,
+                src->bufused - start, strlen - offset);
 
-    return_string->hashval = 0;
+    STRING_iter_skip(interp, src, &iter, length);
 
-    return return_string;
+    return Parrot_str_new_slice(interp, src, start,
+            iter.bytepos - start, length);
 }
 
 
@@ -796,7 +981,9 @@ fixed8_to_encoding(PARROT_INTERP, ARGIN(const STRING *src),
     STRING        *dest;
     const UINTVAL  limit = enc == Parrot_ascii_encoding_ptr ? 0x80 : 0x100;
 
-    if (STRING_max_bytes_per_codepoint(src) == 1) {
+    if (STRING_max_bytes_per_codepoint(src) == 1
+    || (src->encoding == Parrot_utf8_encoding_ptr && src->bufused == src->strlen)) {
+        /* single byte source, or UTF-8 that is all ASCII */
         if (limit < 0x100) {
             const unsigned char * const ptr = (unsigned char *)src->strstart;
             UINTVAL i;
@@ -1076,7 +1263,6 @@ fixed_substr(PARROT_INTERP, ARGIN(const STRING *src), INTVAL offset, INTVAL leng
 {
     ASSERT_ARGS(fixed_substr)
     const UINTVAL  strlen = STRING_length(src);
-    STRING        *return_string;
     UINTVAL        maxlen, bytes_per_codepoint;
 
     if (offset < 0)
@@ -1092,10 +1278,8 @@ fixed_substr(PARROT_INTERP, ARGIN(const STRING *src), INTVAL offset, INTVAL leng
             "Cannot take substr outside string");
     }
 
-    return_string = Parrot_str_copy(interp, src);
-
     if (offset == 0 && (UINTVAL)length >= strlen)
-        return return_string;
+        return Parrot_str_copy(interp, src);
 
     bytes_per_codepoint = src->encoding->max_bytes_per_codepoint;
     maxlen              = strlen - offset;
@@ -1103,12 +1287,8 @@ fixed_substr(PARROT_INTERP, ARGIN(const STRING *src), INTVAL offset, INTVAL leng
     if ((UINTVAL)length > maxlen)
         length = maxlen;
 
-    return_string->strstart += offset * bytes_per_codepoint;
-    return_string->bufused   = length * bytes_per_codepoint;
-    return_string->strlen    = length;
-    return_string->hashval   = 0;
-
-    return return_string;
+    return Parrot_str_new_slice(interp, src, offset * bytes_per_codepoint,
+            length * bytes_per_codepoint, length);
 }
 
 
@@ -1427,10 +1607,6 @@ unicode_compose(PARROT_INTERP, ARGIN(const STRING *src))
 }
 
 
-#define ENCODING_UPCASE     1
-#define ENCODING_DOWNCASE   2
-#define ENCODING_TITLECASE  3
-
 /*
 
 =item C<static size_t convert_case_buf(PARROT_INTERP, char *dest_buf, size_t
@@ -1516,12 +1692,341 @@ convert_case_buf(PARROT_INTERP, ARGMOD_NULLOK(char *dest_buf), size_t dest_len,
 }
 
 
+/*
+
+=item C<void encoding_ascii_case_buf(char *dest, const char *src, UINTVAL len,
+int mode)>
+
+Copies C<len> bytes from C<src> to C<dest>, converting ASCII letters to
+upper case if C<mode> is C<ENCODING_UPCASE> and to lower case otherwise.
+All other bytes, including non-ASCII ones, are copied unchanged, so this
+works on any ASCII-compatible buffer. Whole machine words are converted at
+once: a byte is flagged when its low seven bits lie in the letter range and
+its high bit is clear, and flagged bytes get their 0x20 bit flipped.
+
+C<dest> may be the same buffer as C<src>.
+
+=cut
+
+*/
+
+void
+encoding_ascii_case_buf(ARGOUT(char *dest), ARGIN(const char *src), UINTVAL len,
+        int mode)
+{
+    ASSERT_ARGS(encoding_ascii_case_buf)
+    const UINTVAL  ones     = ~(UINTVAL)0 / 0xFF;
+    const unsigned first    = mode == ENCODING_UPCASE ? 'a' : 'A';
+    const UINTVAL  ge_first = ones * (0x80 - first);
+    const UINTVAL  gt_last  = ones * (0x80 - (first + 25) - 1);
+    UINTVAL        i;
+
+    for (i = 0; i + sizeof (UINTVAL) <= len; i += sizeof (UINTVAL)) {
+        UINTVAL w, low, mask;
+
+        memcpy(&w, src + i, sizeof (UINTVAL));
+        low  = w & ones * 0x7F;
+        mask = (low + ge_first) & ~(low + gt_last) & ~w & ones * 0x80;
+        w   ^= mask >> 2;
+        memcpy(dest + i, &w, sizeof (UINTVAL));
+    }
+
+    for (; i < len; ++i) {
+        const unsigned char c = (unsigned char)src[i];
+        dest[i] = (char)(c - first < 26 ? c ^ 0x20 : c);
+    }
+}
+
+
+/*
+
+=item C<UINTVAL encoding_ascii_span(const unsigned char *s, UINTVAL len)>
+
+Returns the number of leading ASCII bytes in the C<len> bytes at C<s>,
+testing a machine word at a time.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+UINTVAL
+encoding_ascii_span(ARGIN(const unsigned char *s), UINTVAL len)
+{
+    ASSERT_ARGS(encoding_ascii_span)
+    const UINTVAL high = ~(UINTVAL)0 / 0xFF * 0x80;
+    UINTVAL       i;
+
+    for (i = 0; i + sizeof (UINTVAL) <= len; i += sizeof (UINTVAL)) {
+        UINTVAL w;
+
+        memcpy(&w, s + i, sizeof (UINTVAL));
+        if (w & high)
+            break;
+    }
+
+    while (i < len && s[i] < 0x80)
+        ++i;
+
+    return i;
+}
+
+
+/*
+
+=item C<static const Parrot_case_run * case_find_run(const Parrot_case_run
+*runs, UINTVAL n, UINTVAL c)>
+
+Returns the entry of the sorted run table C<runs> of C<n> entries which maps
+codepoint C<c>, or NULL if there is none.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static const Parrot_case_run *
+case_find_run(ARGIN(const Parrot_case_run *runs), UINTVAL n, UINTVAL c)
+{
+    ASSERT_ARGS(case_find_run)
+    UINTVAL lo = 0;
+    UINTVAL hi = n;
+
+    while (lo < hi) {
+        const UINTVAL mid = lo + (hi - lo) / 2;
+
+        if (c < runs[mid].first)
+            hi = mid;
+        else if (c > runs[mid].last)
+            lo = mid + 1;
+        else if ((c - runs[mid].first) % runs[mid].step == 0)
+            return &runs[mid];
+        else
+            return NULL;
+    }
+
+    return NULL;
+}
+
+
+/*
+
+=item C<static UINTVAL case_map_codepoint(UINTVAL c, int mode, Parrot_UInt4
+*out)>
+
+Stores the upper, lower or title case mapping of codepoint C<c> in C<out>
+and returns its length, which is at most 3. Mappings to several codepoints
+take precedence over the simple ones.
+
+=cut
+
+*/
+
+static UINTVAL
+case_map_codepoint(UINTVAL c, int mode, ARGOUT(Parrot_UInt4 *out))
+{
+    ASSERT_ARGS(case_map_codepoint)
+    const Parrot_case_run  *runs, *run;
+    const Parrot_case_full *full;
+    UINTVAL                 n_runs, n_full;
+
+    switch (mode) {
+      case ENCODING_UPCASE:
+        runs   = Parrot_case_upper_runs;
+        n_runs = PARROT_CASE_UPPER_RUNS;
+        full   = Parrot_case_upper_full;
+        n_full = PARROT_CASE_UPPER_FULL;
+        break;
+      case ENCODING_DOWNCASE:
+        runs   = Parrot_case_lower_runs;
+        n_runs = PARROT_CASE_LOWER_RUNS;
+        full   = Parrot_case_lower_full;
+        n_full = PARROT_CASE_LOWER_FULL;
+        break;
+      default:
+        runs   = Parrot_case_title_runs;
+        n_runs = PARROT_CASE_TITLE_RUNS;
+        full   = Parrot_case_title_full;
+        n_full = PARROT_CASE_TITLE_FULL;
+        break;
+    }
+
+    if (c >= full[0].codepoint && c <= full[n_full - 1].codepoint) {
+        UINTVAL lo = 0;
+        UINTVAL hi = n_full;
+
+        while (lo < hi) {
+            const UINTVAL mid = lo + (hi - lo) / 2;
+
+            if (c < full[mid].codepoint)
+                hi = mid;
+            else if (c > full[mid].codepoint)
+                lo = mid + 1;
+            else {
+                UINTVAL n;
+
+                for (n = 0; n < 3 && full[mid].mapping[n]; ++n)
+                    out[n] = full[mid].mapping[n];
+
+                return n;
+            }
+        }
+    }
+
+    run    = case_find_run(runs, n_runs, c);
+    out[0] = run ? (Parrot_UInt4)((INTVAL)c + run->delta) : (Parrot_UInt4)c;
+
+    return 1;
+}
+
+
+/*
+
+=item C<static STRING * unicode_native_case(PARROT_INTERP, const STRING *src,
+int mode)>
+
+Converts the UTF-8 or UCS-4 string C<src> to upper, lower or title case
+with the tables generated into F<src/string/encoding/casetables.c>. The
+result keeps the encoding of C<src>. Runs of ASCII in UTF-8 strings are
+converted a machine word at a time.
+
+Title case upcases the first cased character of each word and downcases the
+rest, where a word is a sequence of letters, digits and case-ignorable
+characters like apostrophes and combining marks.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+static STRING *
+unicode_native_case(PARROT_INTERP, ARGIN(const STRING *src), int mode)
+{
+    ASSERT_ARGS(unicode_native_case)
+    /* the longest mapping is 3 codepoints of at most 4 bytes */
+    const UINTVAL  max_growth = 12;
+    const UINTVAL  len        = src->bufused;
+    const int      is_utf8    = src->encoding == Parrot_utf8_encoding_ptr;
+    STRING * const dest       = Parrot_str_new_init(interp, NULL,
+                                    len + max_growth, src->encoding, 0);
+    UINTVAL        pos        = 0;
+    UINTVAL        used       = 0;
+    UINTVAL        chars      = 0;
+    int            in_cased   = 0;
+
+    while (pos < len) {
+        /* both buffers can move when dest grows */
+        const unsigned char * const s = (const unsigned char *)src->strstart;
+        unsigned char       * const d = (unsigned char *)dest->strstart;
+        Parrot_UInt4                out[3];
+        UINTVAL                     c, n, i;
+
+        if (Buffer_buflen(dest) - used < max_growth) {
+            dest->bufused = used;
+            Parrot_gc_reallocate_string_storage(interp, dest,
+                    2 * Buffer_buflen(dest));
+            continue;
+        }
+
+        if (is_utf8) {
+            if (mode != ENCODING_TITLECASE) {
+                const UINTVAL room = Buffer_buflen(dest) - used;
+
+                n = encoding_ascii_span(s + pos,
+                        len - pos < room ? len - pos : room);
+
+                if (n) {
+                    encoding_ascii_case_buf((char *)d + used,
+                        (const char *)s + pos, n, mode);
+                    pos   += n;
+                    used  += n;
+                    chars += n;
+                    continue;
+                }
+            }
+
+            c = s[pos];
+
+            if (UTF8_IS_START(c)) {
+                const UINTVAL skip = c < 0xE0 ? 2 : c < 0xF0 ? 3 : 4;
+
+                c &= UTF8_START_MASK(skip);
+                for (i = 1; i < skip; ++i)
+                    c = UTF8_ACCUMULATE(c, s[pos + i]);
+
+                pos += skip;
+            }
+            else
+                ++pos;
+        }
+        else {
+            c    = ((const Parrot_UInt4 *)s)[pos / 4];
+            pos += 4;
+        }
+
+        if (mode != ENCODING_TITLECASE)
+            n = case_map_codepoint(c, mode, out);
+        else {
+            const Parrot_case_run * const word =
+                case_find_run(Parrot_case_word_runs, PARROT_CASE_WORD_RUNS, c);
+
+            if (word && word->delta == PARROT_CASE_WORD_CASED) {
+                n = case_map_codepoint(c,
+                        in_cased ? ENCODING_DOWNCASE : ENCODING_TITLECASE, out);
+                in_cased = 1;
+            }
+            else {
+                if (!word)
+                    in_cased = 0;
+
+                out[0] = c;
+                n      = 1;
+            }
+        }
+
+        for (i = 0; i < n; ++i) {
+            const UINTVAL cp = out[i];
+
+            if (!is_utf8) {
+                ((Parrot_UInt4 *)d)[used / 4] = cp;
+                used += 4;
+            }
+            else if (cp < 0x80)
+                d[used++] = (unsigned char)cp;
+            else {
+                const UINTVAL skip = UNISKIP(cp);
+                UINTVAL       rest = cp;
+                UINTVAL       j;
+
+                for (j = skip - 1; j > 0; --j) {
+                    d[used + j] = (unsigned char)((rest & UTF8_CONTINUATION_MASK)
+                                | UTF8_CONTINUATION_MARK);
+                    rest >>= UTF8_ACCUMULATION_SHIFT;
+                }
+
+                d[used] = (unsigned char)(rest | UTF8_START_MARK(skip));
+                used   += skip;
+            }
+        }
+
+        chars += n;
+    }
+
+    dest->bufused = used;
+    dest->strlen  = chars;
+
+    return dest;
+}
+
+
 /*
 
 =item C<static STRING* unicode_convert_case(PARROT_INTERP, const STRING *src,
 int mode)>
 
-Converts the string to upper, lower or title case.
+Converts the string to upper, lower or title case. UTF-8 and UCS-4 strings
+are converted natively by C<unicode_native_case>, the others through UTF-16.
 
 =cut
 
@@ -1535,10 +2040,18 @@ unicode_convert_case(PARROT_INTERP, ARGIN(const STRING *src), int mode)
     STRING *dest;
     size_t  dest_len;
 
+    if (src->encoding == Parrot_utf8_encoding_ptr
+    ||  src->encoding == Parrot_ucs4_encoding_ptr)
+        return unicode_native_case(interp, src, mode);
+
     if (src->encoding != Parrot_utf16_encoding_ptr
     &&  src->encoding != Parrot_ucs2_encoding_ptr)
         src = Parrot_utf16_encoding_ptr->to_encoding(interp, src);
 
+    /* an empty string has no buffer to hand to the case mapper */
+    if (src->bufused == 0)
+        return Parrot_str_new_init(interp, NULL, 0, src->encoding, 0);
+
     /* In-place operation is not safe for old ICU versions */
     dest_len = convert_case_buf(interp, NULL, 0, src->strstart, src->bufused,
                                 mode);
@@ -11,9 +11,27 @@
 #ifndef PARROT_ENCODING_SHARED_H_GUARD
 #define PARROT_ENCODING_SHARED_H_GUARD
 
+/* case conversion modes */
+#define ENCODING_UPCASE     1
+#define ENCODING_DOWNCASE   2
+#define ENCODING_TITLECASE  3
+
 /* HEADERIZER BEGIN: src/string/encoding/shared.c */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
+void encoding_ascii_case_buf(
+    ARGOUT(char *dest),
+    ARGIN(const char *src),
+    UINTVAL len,
+    int mode)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*dest);
+
+PARROT_WARN_UNUSED_RESULT
+UINTVAL encoding_ascii_span(ARGIN(const unsigned char *s), UINTVAL len)
+        __attribute__nonnull__(1);
+
 PARROT_WARN_UNUSED_RESULT
 INTVAL encoding_compare(PARROT_INTERP,
     ARGIN(const STRING *lhs),
@@ -275,6 +293,11 @@ PARROT_CANNOT_RETURN_NULL
 STRING* unicode_upcase_first(PARROT_INTERP, const STRING *src)
         __attribute__nonnull__(1);
 
+#define ASSERT_ARGS_encoding_ascii_case_buf __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(dest) \
+    , PARROT_ASSERT_ARG(src))
+#define ASSERT_ARGS_encoding_ascii_span __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(s))
 #define ASSERT_ARGS_encoding_compare __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(lhs) \
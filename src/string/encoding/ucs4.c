@@ -151,6 +151,39 @@ ucs4_to_encoding(PARROT_INTERP, ARGIN(const STRING *src))
             ptr[i] = s[i];
         }
     }
+    else if (src->encoding == Parrot_utf8_encoding_ptr) {
+        /* already validated by the scan, so decode straight from the buffer */
+        const utf8_t * const s   = (const utf8_t *)src->strstart;
+        const UINTVAL        end = src->bufused;
+        UINTVAL              pos = 0;
+
+        for (i = 0; pos < end; ++i) {
+            const UINTVAL c = s[pos];
+
+            if (c < 0x80) {
+                ptr[i] = c;
+                pos   += 1;
+            }
+            else if (c < 0xE0) {
+                ptr[i] = ((c & 0x1F) << 6)
+                       |  (s[pos + 1] & UTF8_CONTINUATION_MASK);
+                pos   += 2;
+            }
+            else if (c < 0xF0) {
+                ptr[i] = ((c & 0x0F) << 12)
+                       | ((s[pos + 1] & UTF8_CONTINUATION_MASK) << 6)
+                       |  (s[pos + 2] & UTF8_CONTINUATION_MASK);
+                pos   += 3;
+            }
+            else {
+                ptr[i] = ((c & 0x07) << 18)
+                       | ((s[pos + 1] & UTF8_CONTINUATION_MASK) << 12)
+                       | ((s[pos + 2] & UTF8_CONTINUATION_MASK) << 6)
+                       |  (s[pos + 3] & UTF8_CONTINUATION_MASK);
+                pos   += 4;
+            }
+        }
+    }
     else {
         String_iter iter;
 
@@ -250,7 +250,9 @@ utf8_scan(PARROT_INTERP, ARGMOD(STRING *src))
 =item C<static INTVAL utf8_partial_scan(PARROT_INTERP, const char *buf,
 Parrot_String_Bounds *bounds)>
 
-Partial scan of UTF-8 string
+Partial scan of UTF-8 string. Runs of ASCII are validated and counted a
+machine word at a time, stopping short of an ASCII C<delim>; everything else
+is decoded and checked byte by byte.
 
 =cut
 
@@ -274,6 +276,31 @@ utf8_partial_scan(PARROT_INTERP, ARGIN(const char *buf),
         max_chars = len;
 
     for (i = 0; i < len && chars < max_chars; ++i) {
+        if (UNICODE_IS_INVARIANT(p[i])) {
+            UINTVAL n = len - i;
+
+            if (n > (UINTVAL)(max_chars - chars))
+                n = max_chars - chars;
+
+            n = encoding_ascii_span(p + i, n);
+
+            if (delim >= 0 && UNICODE_IS_INVARIANT(delim)) {
+                const utf8_t * const d = (const utf8_t *)memchr(p + i, delim, n);
+
+                if (d)
+                    n = d - (p + i);
+            }
+
+            if (n) {
+                i     += n;
+                chars += n;
+                c      = p[i - 1];
+
+                if (i >= len || chars >= max_chars)
+                    break;
+            }
+        }
+
         c = p[i];
 
         if (UTF8_IS_START(c)) {
@@ -648,8 +675,6 @@ utf8_substr(PARROT_INTERP, ARGIN(const STRING *src), INTVAL offset, INTVAL lengt
 {
     ASSERT_ARGS(utf8_substr)
     const UINTVAL  strlen = STRING_length(src);
-    STRING        *return_string;
-    String_iter    iter;
     UINTVAL        start = 0;
 
     if (offset < 0)
@@ -665,29 +690,18 @@ utf8_substr(PARROT_INTERP, ARGIN(const STRING *src), INTVAL offset, INTVAL lengt
             "Cannot take substr outside string");
     }
 
-    return_string = Parrot_str_copy(interp, src);
-
     if (offset == 0 && (UINTVAL)length >= strlen)
-        return return_string;
-
-    if (offset) {
-        start = utf8_offset((const utf8_t *)return_string->strstart, offset);
-        return_string->strstart += start;
-    }
+        return Parrot_str_copy(interp, src);
 
-    if ((UINTVAL)length >= strlen - (UINTVAL)offset) {
-        return_string->bufused -= start;
-        return_string->strlen  -= offset;
-    }
-    else {
-        UINTVAL end = utf8_offset((const utf8_t *)return_string->strstart, length);
-        return_string->bufused = end;
-        return_string->strlen  = length;
-    }
+    if (offset)
+        start = utf8_offset((const utf8_t *)src->strstart, offset);
 
-    return_string->hashval = 0;
+    if ((UINTVAL)length >= strlen - (UINTVAL)offset)
+        return Parrot_str_new_slice(interp, src, start,
+                src->bufused - start, strlen - offset);
 
-    return return_string;
+    return Parrot_str_new_slice(interp, src, start,
+            utf8_offset((const utf8_t *)src->strstart + start, length), length);
 }
 
 static STR_VTABLE Parrot_utf8_encoding = {
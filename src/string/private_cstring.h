@@ -0,0 +1,858 @@
+/* ex: set ro:
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from 'all_cstring.str'
+ * by tools/build/c2str.pl.
+ *
+ * Any changes made here will be lost!
+ *
+ */
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER STOP */
+
+#ifndef PARROT_SRC_STRING_PRIVATE_CSTRING_H_GUARD
+#define PARROT_SRC_STRING_PRIVATE_CSTRING_H_GUARD
+
+static PARROT_OBSERVER const struct _cstrings {
+    UINTVAL len;
+    PARROT_OBSERVER const char *string;
+} parrot_cstrings[] = {
+    { 0, "" },
+    {0, ""},
+    {3, "NAN"},
+    {3, "INF"},
+    {8, "INFINITY"},
+    {4, "-INF"},
+    {9, "-INFINITY"},
+    {20, "readline_interactive"},
+    {6, "(pdb) "},
+    {8, "debugger"},
+    {7, "thrower"},
+    {6, "resume"},
+    {1, "\n"},
+    {3, "cyg"},
+    {3, "NCI"},
+    {3, "Ops"},
+    {3, "PMC"},
+    {9, "_filename"},
+    {9, "_lib_name"},
+    {5, "_type"},
+    {8, "severity"},
+    {4, "type"},
+    {9, "exit_code"},
+    {36, "No exception handler and no message\n"},
+    {7, "Warning"},
+    {7, "handled"},
+    {16, "ExceptionHandler"},
+    {9, "Exception"},
+    {7, "handler"},
+    {10, "bt_strings"},
+    {14, "\nthrown from:\n"},
+    {6, "parrot"},
+    {3, "Sub"},
+    {9, "invokable"},
+    {5, "array"},
+    {4, "hash"},
+    {12, "_interpreter"},
+    {4, "_sub"},
+    {10, "_signature"},
+    {12, "_synchronous"},
+    {1, "0"},
+    {15, "PARROT_GC_DEBUG"},
+    {5, "write"},
+    {1, "r"},
+    {10, "unbuffered"},
+    {13, "line-buffered"},
+    {13, "full-buffered"},
+    {3, "Key"},
+    {3, " ; "},
+    {1, "'"},
+    {1, "P"},
+    {1, "S"},
+    {1, "I"},
+    {16, "Key type unknown"},
+    {14, "PARROT_INCLUDE"},
+    {14, "PARROT_LIBRARY"},
+    {7, "dynext/"},
+    {13, "PARROT_DYNEXT"},
+    {6, "libdir"},
+    {10, "versiondir"},
+    {9, "build_dir"},
+    {9, "installed"},
+    {11, "dynext_dirs"},
+    {1, "/"},
+    {24, "/runtime/parrot/include/"},
+    {9, "/include/"},
+    {2, "./"},
+    {24, "/runtime/parrot/library/"},
+    {9, "/library/"},
+    {26, "/runtime/parrot/languages/"},
+    {11, "/languages/"},
+    {23, "/runtime/parrot/dynext/"},
+    {8, "/dynext/"},
+    {1, ";"},
+    {1, ":"},
+    {4, ".pbc"},
+    {4, ".pir"},
+    {5, ".pasm"},
+    {14, "PARROT_RUNTIME"},
+    {6, "prefix"},
+    {1, "."},
+    {1, "\\"},
+    {5, "MULTI"},
+    {7, "DEFAULT"},
+    {6, "STRING"},
+    {6, "INTVAL"},
+    {8, "FLOATVAL"},
+    {1, ","},
+    {8, "MultiSub"},
+    {9, "NameSpace"},
+    {6, "String"},
+    {8, "get_name"},
+    {2, " ("},
+    {2, ", "},
+    {1, ")"},
+    {4, "load"},
+    {4, "init"},
+    {14, "(unknown file)"},
+    {4, "_ANN"},
+    {4, "PASM"},
+    {3, "PIR"},
+    {16, "mark_initialized"},
+    {3, "pbc"},
+    {8, "include/"},
+    {8, "library/"},
+    {4, "pasm"},
+    {14, "standard input"},
+    {3, "_ro"},
+    {22, "get_associated_methods"},
+    {29, "get_associated_vtable_methods"},
+    {5, "proxy"},
+    {12, "get_attr_str"},
+    {12, "set_attr_str"},
+    {9, "set_class"},
+    {4, "name"},
+    {5, "class"},
+    {7, "methods"},
+    {7, "parents"},
+    {5, "roles"},
+    {4, "slow"},
+    {4, "fast"},
+    {8, "gc_debug"},
+    {4, "exec"},
+    {9, "profiling"},
+    {23, "PARROT_PROFILING_OUTPUT"},
+    {5, "pprof"},
+    {4, "none"},
+    {1, " "},
+    {25, "PARROT_PROFILING_FILENAME"},
+    {6, "stderr"},
+    {6, "stdout"},
+    {28, "PARROT_PROFILING_ANNOTATIONS"},
+    {33, "PARROT_PROFILING_CANONICAL_OUTPUT"},
+    {24, "PARROT_SAMPLING_FILENAME"},
+    {25, "PARROT_SAMPLING_FREQUENCY"},
+    {21, "PARROT_SAMPLING_PPROF"},
+    {2, "::"},
+    {3, "???"},
+    {4, "file"},
+    {4, "line"},
+    {15, "PARROT_GC_TRACE"},
+    {22, "PARROT_GC_ALLOC_SAMPLE"},
+    {3, "run"},
+    {10, "generation"},
+    {5, "start"},
+    {5, "pause"},
+    {5, "freed"},
+    {11, "freed_bytes"},
+    {8, "promoted"},
+    {5, "dirty"},
+    {4, "used"},
+    {11, "subprof_sub"},
+    {11, "subprof_hll"},
+    {11, "subprof_ops"},
+    {4, "Task"},
+    {11, "add_handler"},
+    {14, "delete_handler"},
+    {14, "count_handlers"},
+    {12, "find_handler"},
+    {13, "handlers_left"},
+    {10, "can_handle"},
+    {1, "+"},
+    {2, "0x"},
+    {2, "0X"},
+    {2, "0b"},
+    {2, "0B"},
+    {6, "(null)"},
+    {12, "unknown file"},
+    {5, "Undef"},
+    {5, "flags"},
+    {3, "mro"},
+    {7, "default"},
+    {4, "Null"},
+    {6, "scalar"},
+    {1, "="},
+    {3, "Env"},
+    {12, "set_register"},
+    {2, "->"},
+    {17, "make_register_key"},
+    {21, "is_register_reference"},
+    {16, "get_register_idx"},
+    {21, "get_register_contents"},
+    {8, "get_type"},
+    {7, "_struct"},
+    {15, "UnManagedStruct"},
+    {9, "as_string"},
+    {13, "ManagedStruct"},
+    {7, "message"},
+    {4, "Hash"},
+    {9, "backtrace"},
+    {11, "annotations"},
+    {17, "backtrace_strings"},
+    {9, "birthtime"},
+    {7, "payload"},
+    {11, "handler_ctx"},
+    {13, "ParrotLibrary"},
+    {7, "library"},
+    {7, "globals"},
+    {8, "packfile"},
+    {5, "outer"},
+    {7, "context"},
+    {3, "sub"},
+    {6, "lexpad"},
+    {9, "namespace"},
+    {12, "continuation"},
+    {17, "ParrotInterpreter"},
+    {15, "recursion_limit"},
+    {6, "run_gc"},
+    {7, "hll_map"},
+    {12, "stdin_handle"},
+    {13, "stdout_handle"},
+    {13, "stderr_handle"},
+    {6, "getpid"},
+    {12, "current_task"},
+    {8, "schedule"},
+    {16, "schedule_proxied"},
+    {8, "is_equal"},
+    {35, "ParrotInterpreter,ParrotInterpreter"},
+    {25, "ParrotInterpreter,DEFAULT"},
+    {6, "LexPad"},
+    {11, "get_lexinfo"},
+    {13, "register_type"},
+    {5, "Timer"},
+    {7, "Pointer"},
+    {10, "start_offs"},
+    {8, "end_offs"},
+    {6, "HLL_id"},
+    {14, "namespace_name"},
+    {15, "namespace_stash"},
+    {11, "method_name"},
+    {13, "ns_entry_name"},
+    {5, "subid"},
+    {12, "vtable_index"},
+    {15, "multi_signature"},
+    {8, "lex_info"},
+    {9, "outer_sub"},
+    {10, "comp_flags"},
+    {8, "pf_flags"},
+    {11, "n_regs_used"},
+    {8, "arg_info"},
+    {12, "pos_required"},
+    {12, "pos_optional"},
+    {10, "pos_slurpy"},
+    {14, "named_required"},
+    {14, "named_optional"},
+    {12, "named_slurpy"},
+    {4, "INSP"},
+    {13, "get_namespace"},
+    {15, "__get_regs_used"},
+    {9, "get_subid"},
+    {9, "get_outer"},
+    {9, "set_outer"},
+    {13, "set_outer_ctx"},
+    {12, "get_multisig"},
+    {5, "arity"},
+    {12, "get_packfile"},
+    {7, "Sub,PMC"},
+    {3, "seg"},
+    {6, "to_ctx"},
+    {14, "to_call_object"},
+    {8, "from_ctx"},
+    {10, "runloop_id"},
+    {7, "invoked"},
+    {12, "Continuation"},
+    {3, "rid"},
+    {6, "caller"},
+    {9, "Coroutine"},
+    {5, "reset"},
+    {9, "autoreset"},
+    {5, "Float"},
+    {12, "scalar float"},
+    {4, "acos"},
+    {4, "acot"},
+    {4, "asec"},
+    {4, "asin"},
+    {4, "atan"},
+    {5, "atan2"},
+    {3, "cos"},
+    {4, "cosh"},
+    {3, "cot"},
+    {4, "coth"},
+    {3, "csc"},
+    {3, "exp"},
+    {2, "ln"},
+    {5, "log10"},
+    {4, "log2"},
+    {3, "sec"},
+    {4, "sech"},
+    {3, "sin"},
+    {4, "sinh"},
+    {3, "tan"},
+    {4, "tanh"},
+    {4, "sqrt"},
+    {11, "Float,Float"},
+    {13, "Float,DEFAULT"},
+    {12, "is_equal_num"},
+    {3, "cmp"},
+    {7, "cmp_num"},
+    {7, "Integer"},
+    {14, "integer scalar"},
+    {11, "get_as_base"},
+    {10, "set_random"},
+    {3, "add"},
+    {19, "Integer,Integer,PMC"},
+    {19, "Integer,Complex,PMC"},
+    {18, "Integer,BigInt,PMC"},
+    {19, "Integer,DEFAULT,PMC"},
+    {5, "i_add"},
+    {15, "Integer,Integer"},
+    {15, "Integer,Complex"},
+    {15, "Integer,DEFAULT"},
+    {8, "subtract"},
+    {10, "i_subtract"},
+    {8, "multiply"},
+    {18, "Integer,String,PMC"},
+    {6, "divide"},
+    {8, "i_divide"},
+    {14, "Integer,BigInt"},
+    {12, "floor_divide"},
+    {14, "i_floor_divide"},
+    {7, "modulus"},
+    {9, "i_modulus"},
+    {14, "Integer,String"},
+    {13, "Integer,Float"},
+    {1, "L"},
+    {5, "0.0.0"},
+    {6, "BigInt"},
+    {7, "version"},
+    {3, "pow"},
+    {17, "BigInt,BigInt,PMC"},
+    {18, "BigInt,Integer,PMC"},
+    {18, "BigInt,DEFAULT,PMC"},
+    {13, "BigInt,BigInt"},
+    {14, "BigInt,Integer"},
+    {14, "BigInt,DEFAULT"},
+    {10, "i_multiply"},
+    {6, "BigNum"},
+    {17, "BigNum,BigNum,PMC"},
+    {18, "BigNum,Integer,PMC"},
+    {18, "BigNum,DEFAULT,PMC"},
+    {13, "BigNum,BigNum"},
+    {14, "BigNum,Integer"},
+    {12, "BigNum,Float"},
+    {14, "BigNum,DEFAULT"},
+    {4, "real"},
+    {4, "imag"},
+    {7, "Complex"},
+    {5, "atanh"},
+    {5, "asinh"},
+    {5, "acosh"},
+    {14, "scalar complex"},
+    {4, "acsc"},
+    {4, "csch"},
+    {5, "acoth"},
+    {5, "acsch"},
+    {5, "asech"},
+    {19, "Complex,Complex,PMC"},
+    {19, "Complex,DEFAULT,PMC"},
+    {15, "Complex,Complex"},
+    {15, "Complex,DEFAULT"},
+    {13, "scalar string"},
+    {7, "replace"},
+    {6, "to_int"},
+    {5, "trans"},
+    {7, "reverse"},
+    {10, "is_integer"},
+    {13, "reverse_index"},
+    {8, "unescape"},
+    {7, "Boolean"},
+    {14, "scalar boolean"},
+    {2, "[ "},
+    {2, " ]"},
+    {3, "key"},
+    {17, "FixedIntegerArray"},
+    {4, "sort"},
+    {12, "parallel_map"},
+    {13, "parallel_each"},
+    {15, "parallel_reduce"},
+    {13, "parallel_sort"},
+    {8, "Iterator"},
+    {8, "iterator"},
+    {4, "next"},
+    {1, "\""},
+    {16, "FixedStringArray"},
+    {1, "{"},
+    {12, "set_key_type"},
+    {12, "get_key_type"},
+    {14, "set_value_type"},
+    {14, "get_value_type"},
+    {6, "update"},
+    {3, "\1%d"},
+    {11, "OrderedHash"},
+    {10, "array hash"},
+    {5, "OpLib"},
+    {9, "op_family"},
+    {6, "Opcode"},
+    {11, "family_name"},
+    {4, "jump"},
+    {4, "dirs"},
+    {6, "labels"},
+    {5, "named"},
+    {9, "arg_flags"},
+    {12, "return_flags"},
+    {10, "caller_ctx"},
+    {7, "lex_pad"},
+    {9, "outer_ctx"},
+    {11, "current_sub"},
+    {12, "current_cont"},
+    {17, "current_namespace"},
+    {8, "handlers"},
+    {11, "current_HLL"},
+    {11, "current_hll"},
+    {1, "N"},
+    {11, "CallContext"},
+    {10, "hash array"},
+    {12, "AddrRegistry"},
+    {5, "Alarm"},
+    {13, "ArrayIterator"},
+    {10, "ByteBuffer"},
+    {10, "get_string"},
+    {13, "get_string_as"},
+    {9, "get_chars"},
+    {8, "Callback"},
+    {7, "Capture"},
+    {4, "list"},
+    {7, "Channel"},
+    {4, "send"},
+    {7, "receive"},
+    {8, "try_send"},
+    {11, "try_receive"},
+    {8, "capacity"},
+    {3, "int"},
+    {3, "num"},
+    {6, "string"},
+    {10, "attributes"},
+    {14, "resolve_method"},
+    {8, "init_pmc"},
+    {11, "all_parents"},
+    {20, "ResizableStringArray"},
+    {2, "id"},
+    {12, "attrib_index"},
+    {16, "vtable_overrides"},
+    {5, "Class"},
+    {14, "exclude_method"},
+    {12, "alias_method"},
+    {3, "new"},
+    {13, "add_attribute"},
+    {10, "add_method"},
+    {19, "add_vtable_override"},
+    {13, "remove_method"},
+    {11, "find_method"},
+    {10, "add_parent"},
+    {8, "add_role"},
+    {7, "inspect"},
+    {3, "isa"},
+    {4, "does"},
+    {18, "clear_method_cache"},
+    {16, "get_method_cache"},
+    {4, "code"},
+    {6, "interp"},
+    {8, "priority"},
+    {5, "event"},
+    {7, "subtype"},
+    {12, "EventHandler"},
+    {12, "min_severity"},
+    {12, "max_severity"},
+    {12, "handle_types"},
+    {19, "handle_types_except"},
+    {11, "destination"},
+    {6, "source"},
+    {9, "export_to"},
+    {8, "Exporter"},
+    {6, "import"},
+    {10, "FileHandle"},
+    {4, "open"},
+    {6, "isatty"},
+    {9, "is_closed"},
+    {7, "readall"},
+    {5, "flush"},
+    {5, "print"},
+    {11, "buffer_type"},
+    {11, "buffer_size"},
+    {4, "mode"},
+    {3, "eof"},
+    {6, "handle"},
+    {11, "exit_status"},
+    {4, "tell"},
+    {4, "seek"},
+    {4, "peek"},
+    {8, "setasync"},
+    {11, "setblocking"},
+    {1, "1"},
+    {17, "FixedBooleanArray"},
+    {4, "fill"},
+    {15, "FixedFloatArray"},
+    {1, "("},
+    {13, "FixedPMCArray"},
+    {6, "Handle"},
+    {6, "get_fd"},
+    {4, "read"},
+    {8, "readline"},
+    {10, "read_bytes"},
+    {11, "write_bytes"},
+    {16, "record_separator"},
+    {5, "close"},
+    {8, "encoding"},
+    {12, "HashIterator"},
+    {15, "HashIteratorKey"},
+    {5, "value"},
+    {13, "ImageIOFreeze"},
+    {11, "ImageIOSize"},
+    {14, "ImageIOStrings"},
+    {11, "ImageIOThaw"},
+    {6, "target"},
+    {11, "IMCCompiler"},
+    {11, "HLLCompiler"},
+    {7, "compile"},
+    {12, "compile_file"},
+    {10, "preprocess"},
+    {7, "symbols"},
+    {7, "LexInfo"},
+    {16, "declare_lex_preg"},
+    {15, "MappedByteArray"},
+    {9, "supported"},
+    {8, "get_utf8"},
+    {15, "invokable array"},
+    {14, "make_namespace"},
+    {13, "add_namespace"},
+    {7, "add_sub"},
+    {7, "add_var"},
+    {14, "find_namespace"},
+    {8, "find_sub"},
+    {8, "find_var"},
+    {13, "del_namespace"},
+    {7, "del_sub"},
+    {7, "del_var"},
+    {7, "get_sym"},
+    {10, "get_parent"},
+    {9, "get_class"},
+    {15, "NativePCCMethod"},
+    {8, "absolute"},
+    {9, "add_float"},
+    {7, "add_int"},
+    {10, "assign_pmc"},
+    {20, "assign_string_native"},
+    {5, "clone"},
+    {9, "clone_pmc"},
+    {7, "cmp_pmc"},
+    {10, "cmp_string"},
+    {11, "concatenate"},
+    {15, "concatenate_str"},
+    {9, "decrement"},
+    {7, "defined"},
+    {13, "defined_keyed"},
+    {17, "defined_keyed_int"},
+    {17, "defined_keyed_str"},
+    {12, "delete_keyed"},
+    {16, "delete_keyed_int"},
+    {16, "delete_keyed_str"},
+    {12, "divide_float"},
+    {10, "divide_int"},
+    {8, "elements"},
+    {12, "exists_keyed"},
+    {16, "exists_keyed_int"},
+    {16, "exists_keyed_str"},
+    {18, "floor_divide_float"},
+    {16, "floor_divide_int"},
+    {8, "get_bool"},
+    {11, "get_integer"},
+    {17, "get_integer_keyed"},
+    {21, "get_integer_keyed_int"},
+    {21, "get_integer_keyed_str"},
+    {8, "get_iter"},
+    {10, "get_number"},
+    {16, "get_number_keyed"},
+    {20, "get_number_keyed_int"},
+    {20, "get_number_keyed_str"},
+    {7, "get_pmc"},
+    {13, "get_pmc_keyed"},
+    {17, "get_pmc_keyed_int"},
+    {17, "get_pmc_keyed_str"},
+    {11, "get_pointer"},
+    {17, "get_pointer_keyed"},
+    {21, "get_pointer_keyed_int"},
+    {21, "get_pointer_keyed_str"},
+    {8, "get_repr"},
+    {16, "get_string_keyed"},
+    {20, "get_string_keyed_int"},
+    {20, "get_string_keyed_str"},
+    {9, "hashvalue"},
+    {10, "i_absolute"},
+    {11, "i_add_float"},
+    {9, "i_add_int"},
+    {13, "i_concatenate"},
+    {17, "i_concatenate_str"},
+    {14, "i_divide_float"},
+    {12, "i_divide_int"},
+    {20, "i_floor_divide_float"},
+    {18, "i_floor_divide_int"},
+    {15, "i_modulus_float"},
+    {13, "i_modulus_int"},
+    {16, "i_multiply_float"},
+    {14, "i_multiply_int"},
+    {5, "i_neg"},
+    {8, "i_repeat"},
+    {12, "i_repeat_int"},
+    {16, "i_subtract_float"},
+    {14, "i_subtract_int"},
+    {9, "increment"},
+    {8, "init_int"},
+    {11, "inspect_str"},
+    {11, "instantiate"},
+    {6, "invoke"},
+    {15, "is_equal_string"},
+    {7, "is_same"},
+    {7, "isa_pmc"},
+    {13, "modulus_float"},
+    {11, "modulus_int"},
+    {5, "morph"},
+    {14, "multiply_float"},
+    {12, "multiply_int"},
+    {3, "neg"},
+    {9, "pop_float"},
+    {11, "pop_integer"},
+    {7, "pop_pmc"},
+    {10, "pop_string"},
+    {10, "push_float"},
+    {12, "push_integer"},
+    {8, "push_pmc"},
+    {11, "push_string"},
+    {16, "remove_attribute"},
+    {13, "remove_parent"},
+    {11, "remove_role"},
+    {22, "remove_vtable_override"},
+    {6, "repeat"},
+    {10, "repeat_int"},
+    {8, "set_bool"},
+    {17, "set_integer_keyed"},
+    {21, "set_integer_keyed_int"},
+    {21, "set_integer_keyed_str"},
+    {18, "set_integer_native"},
+    {16, "set_number_keyed"},
+    {20, "set_number_keyed_int"},
+    {20, "set_number_keyed_str"},
+    {17, "set_number_native"},
+    {7, "set_pmc"},
+    {13, "set_pmc_keyed"},
+    {17, "set_pmc_keyed_int"},
+    {17, "set_pmc_keyed_str"},
+    {11, "set_pointer"},
+    {17, "set_pointer_keyed"},
+    {21, "set_pointer_keyed_int"},
+    {21, "set_pointer_keyed_str"},
+    {16, "set_string_keyed"},
+    {20, "set_string_keyed_int"},
+    {20, "set_string_keyed_str"},
+    {17, "set_string_native"},
+    {5, "share"},
+    {11, "shift_float"},
+    {13, "shift_integer"},
+    {9, "shift_pmc"},
+    {12, "shift_string"},
+    {6, "splice"},
+    {6, "substr"},
+    {14, "subtract_float"},
+    {12, "subtract_int"},
+    {13, "unshift_float"},
+    {15, "unshift_integer"},
+    {11, "unshift_pmc"},
+    {14, "unshift_string"},
+    {6, "Object"},
+    {19, "OrderedHashIterator"},
+    {2, "OS"},
+    {3, "cwd"},
+    {5, "chdir"},
+    {6, "unlink"},
+    {5, "rmdir"},
+    {2, "rm"},
+    {5, "mkdir"},
+    {4, "stat"},
+    {5, "lstat"},
+    {7, "symlink"},
+    {8, "readlink"},
+    {4, "link"},
+    {5, "umask"},
+    {6, "chroot"},
+    {7, "readdir"},
+    {6, "rename"},
+    {5, "chmod"},
+    {11, "get_user_id"},
+    {11, "can_execute"},
+    {8, "can_read"},
+    {9, "can_write"},
+    {6, "exists"},
+    {4, "uuid"},
+    {8, "Packfile"},
+    {4, "pack"},
+    {6, "unpack"},
+    {13, "get_directory"},
+    {4, "view"},
+    {8, "wordsize"},
+    {9, "byteorder"},
+    {6, "fptype"},
+    {13, "version_major"},
+    {13, "version_minor"},
+    {13, "version_patch"},
+    {14, "bytecode_major"},
+    {14, "bytecode_minor"},
+    {9, "uuid_type"},
+    {18, "PackfileAnnotation"},
+    {10, "get_offset"},
+    {10, "set_offset"},
+    {8, "set_name"},
+    {13, "get_pmc_value"},
+    {13, "set_pmc_value"},
+    {19, "PackfileAnnotations"},
+    {13, "set_directory"},
+    {23, "PackfileBytecodeSegment"},
+    {8, "main_sub"},
+    {5, "opmap"},
+    {21, "PackfileConstantTable"},
+    {9, "num_count"},
+    {9, "str_count"},
+    {9, "pmc_count"},
+    {8, "set_main"},
+    {15, "add_tag_mapping"},
+    {22, "get_or_create_constant"},
+    {28, "PackfileConstantTable,STRING"},
+    {30, "PackfileConstantTable,FLOATVAL"},
+    {25, "PackfileConstantTable,PMC"},
+    {13, "PackfileDebug"},
+    {17, "PackfileDirectory"},
+    {5, "oplib"},
+    {9, "table_ops"},
+    {7, "lib_ops"},
+    {8, "core_ops"},
+    {10, "oplib_name"},
+    {13, "PackfileOpMap"},
+    {8, "load_lib"},
+    {6, "oplibs"},
+    {18, "PackfileRawSegment"},
+    {15, "PackfileSegment"},
+    {12, "PackfileView"},
+    {15, "constant_counts"},
+    {11, "subs_by_tag"},
+    {17, "single_sub_by_tag"},
+    {8, "all_subs"},
+    {24, "first_sub_in_const_table"},
+    {8, "all_tags"},
+    {15, "all_tagged_pmcs"},
+    {14, "is_initialized"},
+    {15, "serialized_size"},
+    {9, "serialize"},
+    {11, "deserialize"},
+    {14, "read_from_file"},
+    {13, "write_to_file"},
+    {11, "get_version"},
+    {1, "]"},
+    {7, "PMCList"},
+    {5, "shift"},
+    {3, "pop"},
+    {7, "unshift"},
+    {4, "push"},
+    {16, "insert_by_number"},
+    {8, "PMCProxy"},
+    {5, "Proxy"},
+    {3, "Ptr"},
+    {6, "PtrBuf"},
+    {6, "PtrObj"},
+    {10, "clone_func"},
+    {9, "mark_func"},
+    {12, "destroy_func"},
+    {21, "ResizableBooleanArray"},
+    {19, "ResizableFloatArray"},
+    {21, "ResizableIntegerArray"},
+    {17, "ResizablePMCArray"},
+    {6, "append"},
+    {4, "Role"},
+    {18, "scalar,Complex,PMC"},
+    {18, "scalar,DEFAULT,PMC"},
+    {14, "scalar,Complex"},
+    {14, "scalar,DEFAULT"},
+    {14, "scalar,PMC,PMC"},
+    {10, "scalar,PMC"},
+    {9, "Scheduler"},
+    {12, "active_tasks"},
+    {4, "data"},
+    {16, "SchedulerMessage"},
+    {8, "Sockaddr"},
+    {6, "Socket"},
+    {6, "socket"},
+    {4, "poll"},
+    {8, "sockaddr"},
+    {11, "getaddrinfo"},
+    {14, "remote_address"},
+    {13, "local_address"},
+    {14, "getprotobyname"},
+    {7, "connect"},
+    {4, "recv"},
+    {4, "bind"},
+    {6, "listen"},
+    {6, "accept"},
+    {4, "puts"},
+    {1, "%"},
+    {13, "StringBuilder"},
+    {13, "append_format"},
+    {17, "get_string_length"},
+    {7, "chunked"},
+    {4, "utf8"},
+    {12, "StringHandle"},
+    {14, "StringIterator"},
+    {9, "get_shape"},
+    {6, "buffer"},
+    {10, "StructView"},
+    {4, "size"},
+    {5, "align"},
+    {12, "aligned_size"},
+    {5, "alloc"},
+    {10, "array_offs"},
+    {8, "elt_offs"},
+    {4, "kill"},
+    {11, "Undef,Undef"},
+    {13, "Undef,DEFAULT"},
+    {12, "float scalar"},
+    {14, "scalar integer"},
+    {14, "complex scalar"}
+};
+
+
+#endif /* PARROT_SRC_STRING_PRIVATE_CSTRING_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ *   buffer-read-only: t
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
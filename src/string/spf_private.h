@@ -85,10 +85,17 @@ STRING * Parrot_sprintf_format(PARROT_INTERP,
         __attribute__nonnull__(3)
         FUNC_MODIFIES(*obj);
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+STRING * Parrot_sprintf_number(PARROT_INTERP, FLOATVAL f)
+        __attribute__nonnull__(1);
+
 #define ASSERT_ARGS_Parrot_sprintf_format __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pat) \
     , PARROT_ASSERT_ARG(obj))
+#define ASSERT_ARGS_Parrot_sprintf_number __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: src/string/spf_render.c */
 
@@ -10,6 +10,10 @@ src/spf_render.c - Parrot sprintf
 Implements the main function that drives the C<Parrot_sprintf> family
 and its utility functions.
 
+Patterns are compiled into a list of ops, literal text and conversions, which
+are then rendered against the arguments. The ops of constant patterns are
+cached per interpreter, so a format used over and over is parsed only once.
+
 =head2 Utility Functions
 
 =over 4
@@ -57,6 +61,37 @@ enum {
     FLAG_PREC   = (1<<6)
 };
 
+/* A pattern compiles into a list of ops, ended by an SPF_END op */
+typedef enum {
+    SPF_END = 0,
+    SPF_TEXT,                   /* literal text */
+    SPF_FIELD,                  /* a conversion */
+    SPF_BAD                     /* an invalid conversion, thrown when reached */
+} spf_op_t;
+
+typedef struct SpfOp_tag {
+    spf_op_t  kind;
+    INTVAL    term;             /* conversion character, 0 if none */
+    UINTVAL   start;            /* first character in the pattern */
+    UINTVAL   length;           /* characters in the pattern */
+    STRING   *text;             /* constant literal text of cached ops */
+    SpfInfo   info;             /* flags, size, and width and precision digits */
+    UINTVAL   width_scale;      /* 10 ** width digits following a '*' */
+    INTVAL    width_args;       /* '*'s in the width */
+    INTVAL    prec_arg;         /* precision is a '*' */
+    char      cfmt[32];         /* C format of a float field, if known */
+} SpfOp;
+
+/* Ops first allocated for a pattern being cached, doubled as needed */
+#define SPF_CACHE_OPS       8
+
+/* Ops compiled at a time for patterns that aren't cached; they live on the
+ * C stack, so this is one op and its SPF_END */
+#define SPF_CHUNK_OPS       2
+
+/* Most distinct patterns kept in the format cache */
+#define SPRINTF_CACHE_SIZE  256
+
 /* HEADERIZER HFILE: src/string/spf_private.h */
 
 /* HEADERIZER BEGIN: static */
@@ -69,6 +104,45 @@ static void canonicalize_exponent(
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*tc);
 
+static UINTVAL compile_format(PARROT_INTERP,
+    ARGIN(const STRING *pat),
+    UINTVAL pos,
+    ARGOUT(SpfOp *ops),
+    UINTVAL n)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*ops);
+
+static UINTVAL compile_op(PARROT_INTERP,
+    ARGIN(const STRING *pat),
+    UINTVAL pat_len,
+    UINTVAL pos,
+    ARGOUT(SpfOp *op))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(5)
+        FUNC_MODIFIES(*op);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static const SpfOp * find_format(PARROT_INTERP, ARGIN(const STRING *pat))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static STRING * format_decimal(PARROT_INTERP,
+    ARGIN(const SpfInfo *info),
+    UHUGEINTVAL value,
+    int negative,
+    int is_signed,
+    ARGOUT(char *tc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(6)
+        FUNC_MODIFIES(*tc);
+
 static void gen_sprintf_call(
     ARGOUT(char *out),
     ARGMOD(SpfInfo *info),
@@ -89,6 +163,19 @@ static STRING * handle_flags(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+static void render_format(PARROT_INTERP,
+    ARGIN(const STRING *pat),
+    ARGIN(const SpfOp *op),
+    ARGMOD(SPRINTF_OBJ *obj),
+    ARGMOD(PMC *targ))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        __attribute__nonnull__(5)
+        FUNC_MODIFIES(*obj)
+        FUNC_MODIFIES(*targ);
+
 PARROT_CANNOT_RETURN_NULL
 static void str_concat_w_flags(PARROT_INTERP,
     ARGOUT(PMC * sb),
@@ -105,6 +192,21 @@ static void str_concat_w_flags(PARROT_INTERP,
 #define ASSERT_ARGS_canonicalize_exponent __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(tc) \
     , PARROT_ASSERT_ARG(info))
+#define ASSERT_ARGS_compile_format __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pat) \
+    , PARROT_ASSERT_ARG(ops))
+#define ASSERT_ARGS_compile_op __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pat) \
+    , PARROT_ASSERT_ARG(op))
+#define ASSERT_ARGS_find_format __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pat))
+#define ASSERT_ARGS_format_decimal __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(info) \
+    , PARROT_ASSERT_ARG(tc))
 #define ASSERT_ARGS_gen_sprintf_call __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(out) \
     , PARROT_ASSERT_ARG(info))
@@ -112,6 +214,12 @@ static void str_concat_w_flags(PARROT_INTERP,
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(info) \
     , PARROT_ASSERT_ARG(str))
+#define ASSERT_ARGS_render_format __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pat) \
+    , PARROT_ASSERT_ARG(op) \
+    , PARROT_ASSERT_ARG(obj) \
+    , PARROT_ASSERT_ARG(targ))
 #define ASSERT_ARGS_str_concat_w_flags __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(sb) \
@@ -399,14 +507,71 @@ canonicalize_exponent(ARGMOD(char *tc), ARGIN(const SpfInfo *info))
     }
 }
 
+/*
+
+=item C<STRING * Parrot_sprintf_number(PARROT_INTERP, FLOATVAL f)>
+
+Returns C<f> formatted as C<Parrot_sprintf_c()> formats it with
+C<FLOATVAL_FMT>, without going through a pattern. Integral values of less
+than 15 digits, which C<%.15g> prints as integers, are written out directly.
 
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+STRING *
+Parrot_sprintf_number(PARROT_INTERP, FLOATVAL f)
+{
+    ASSERT_ARGS(Parrot_sprintf_number)
+    const SpfInfo info = { 0, 15, FLAG_PREC, 0, PHASE_DONE };
+    char          tc[64];
+
+    if (PARROT_FLOATVAL_IS_POSINF(f))
+        return cstr2pstr(PARROT_CSTRING_INF_POSITIVE);
+    if (PARROT_FLOATVAL_IS_NEGINF(f))
+        return cstr2pstr(PARROT_CSTRING_INF_NEGATIVE);
+    if (PARROT_FLOATVAL_IS_NAN(f))
+        return cstr2pstr(PARROT_CSTRING_NAN_QUIET);
+
+    if (f > -1e15 && f < 1e15 && f == (FLOATVAL)(HUGEINTVAL)f) {
+        const HUGEINTVAL  i     = (HUGEINTVAL)f;
+        UHUGEINTVAL       value = i < 0 ? -(UHUGEINTVAL)i : (UHUGEINTVAL)i;
+        char * const      end   = tc + sizeof tc;
+        char             *p     = end;
+
+        do {
+            *--p = (char)('0' + value % 10);
+        } while (value /= 10);
+
+        /* -0.0 prints as "-0" too */
+        if (signbit(f))
+            *--p = '-';
+
+        return Parrot_str_new_init(interp, p, end - p,
+                Parrot_ascii_encoding_ptr, 0);
+    }
+
+    /* as for a %.15g field, which FLOATVAL_FMT is */
+#ifdef PARROT_HAS_SNPRINTF
+    snprintf(tc, sizeof tc, "%.15g", (double)f);
+#else
+    sprintf(tc, "%.15g", (double)f);
+#endif
+    canonicalize_exponent(tc, &info);
+
+    return cstr2pstr(tc);
+}
 
 /*
 
-=item C<STRING * Parrot_sprintf_format(PARROT_INTERP, const STRING *pat,
-SPRINTF_OBJ *obj)>
+=item C<static STRING * format_decimal(PARROT_INTERP, const SpfInfo *info,
+UHUGEINTVAL value, int negative, int is_signed, char *tc)>
 
-This is the engine that does all the formatting.
+Formats a C<%d>, C<%i> or C<%u> field of magnitude C<value> the way
+C<snprintf()> would, including its caps on width and precision, building the
+digits in C<tc> instead of going through a C format string.
 
 =cut
 
@@ -414,62 +579,146 @@ This is the engine that does all the formatting.
 
 PARROT_WARN_UNUSED_RESULT
 PARROT_CANNOT_RETURN_NULL
-STRING *
-Parrot_sprintf_format(PARROT_INTERP, ARGIN(const STRING *pat), ARGMOD(SPRINTF_OBJ *obj))
+static STRING *
+format_decimal(PARROT_INTERP, ARGIN(const SpfInfo *info), UHUGEINTVAL value,
+        int negative, int is_signed, ARGOUT(char *tc))
 {
-    ASSERT_ARGS(Parrot_sprintf_format)
-    INTVAL i;
-    INTVAL len     = 0;
-    INTVAL old     = 0;
-    const INTVAL pat_len = (INTVAL)Parrot_str_length(interp, pat);
-    HUGEINTVAL num;
-    HUGEINTVAL sharedint = 0;
-    SpfInfo info = { 0, 0, 0, 0, (PHASE)0 }; /* Storage for flags, etc. */
-    PMC * const targ = Parrot_pmc_new_init_int(interp, enum_class_StringBuilder, pat_len * 2);
-    INTVAL fmt_start_idx;
+    ASSERT_ARGS(format_decimal)
+    char          digits[sizeof (UHUGEINTVAL) * 3];
+    char * const  digits_end = digits + sizeof digits;
+    char         *d          = digits_end;
+    char         *p          = tc;
+    const INTVAL  flags      = info->flags;
+    char          sign       = 0;
+    size_t        zeros      = 0;
+    size_t        pad        = 0;
+    size_t        len;
+
+    /* an explicit zero precision prints no digits for zero */
+    if (value || !(flags & FLAG_PREC) || info->prec)
+        do {
+            *--d = (char)('0' + value % 10);
+        } while (value /= 10);
+
+    if (flags & FLAG_PREC) {
+        const size_t prec = info->prec > PARROT_SPRINTF_MAX_PREC
+                          ? PARROT_SPRINTF_MAX_PREC
+                          : info->prec;
+
+        if (prec > (size_t)(digits_end - d))
+            zeros = prec - (digits_end - d);
+    }
 
-    /* ts is used almost universally as an intermediate target;
-     * tc is used as a temporary buffer by Parrot_str_from_uint and
-     * as a target by gen_sprintf_call.
-     */
-    STRING *substr = NULL;
-    char tc[PARROT_SPRINTF_BUFFER_SIZE];
+    if (negative)
+        sign = '-';
+    else if (is_signed && (flags & FLAG_PLUS))
+        sign = '+';
+    else if (is_signed && (flags & FLAG_SPACE))
+        sign = ' ';
 
-    for (i = 0; i < pat_len; ++i) {
-        /* Check if we have a '%'. If not, increase the len and continue. */
-        if (STRING_ord(interp, pat, i) != '%') {
-            len++;
-            continue;
-        }
+    len = (sign ? 1 : 0) + zeros + (digits_end - d);
 
-        /* We have found a '%'. If we have a len (a number of characters
-           before the '%') take a substring of all those and add it to the
-           buffer */
-        if (len) {
-            substr = STRING_substr(interp, pat, old, len);
-            VTABLE_push_string(interp, targ, substr);
-        }
-        len = 0;    /* Reset the len */
-        old = i;
-        fmt_start_idx = i;
-
-        /* If we have a "%%" pattern, we're just going to output a single
-           '%', so reset the counts and continue. */
-        if (STRING_ord(interp, pat, i + 1) == '%') {
-            /* skip this one, make next the first char
-             * of literal sequence, starting at old */
+    if (flags & FLAG_WIDTH) {
+        const size_t width = info->width > PARROT_SPRINTF_BUFFER_SIZE
+                           ? PARROT_SPRINTF_BUFFER_SIZE
+                           : info->width;
+
+        if (width > len)
+            pad = width - len;
+    }
+
+    /* zero padding goes between the sign and the digits */
+    if (pad && !(flags & (FLAG_MINUS | FLAG_PREC)) && (flags & FLAG_ZERO)) {
+        zeros += pad;
+        pad    = 0;
+    }
+
+    if (!(flags & FLAG_MINUS)) {
+        memset(p, ' ', pad);
+        p += pad;
+    }
+
+    if (sign)
+        *p++ = sign;
+
+    memset(p, '0', zeros);
+    p += zeros;
+    memcpy(p, d, digits_end - d);
+    p += digits_end - d;
+
+    if (flags & FLAG_MINUS) {
+        memset(p, ' ', pad);
+        p += pad;
+    }
+
+    /* snprintf() drops whatever does not fit its buffer */
+    len = p - tc;
+    if (len > PARROT_SPRINTF_BUFFER_SIZE - 1)
+        len = PARROT_SPRINTF_BUFFER_SIZE - 1;
+
+    return Parrot_str_new_init(interp, tc, len, Parrot_ascii_encoding_ptr, 0);
+}
+
+/*
+
+=item C<static UINTVAL compile_op(PARROT_INTERP, const STRING *pat, UINTVAL
+pat_len, UINTVAL pos, SpfOp *op)>
+
+Compiles the piece of C<pat> starting at C<pos> into C<op>, and returns the
+position following it. A piece is either a run of literal text, which for
+C<%%> starts at the second C<%>, or one conversion.
+
+Nothing is fetched and nothing is thrown here: C<*> widths and precisions are
+counted for C<render_format> to fetch, and an invalid conversion becomes an
+C<SPF_BAD> op, reported when reached. That keeps arguments and output in the
+same order as if the pattern were parsed while rendering.
+
+=cut
+
+*/
+
+static UINTVAL
+compile_op(PARROT_INTERP, ARGIN(const STRING *pat), UINTVAL pat_len,
+        UINTVAL pos, ARGOUT(SpfOp *op))
+{
+    ASSERT_ARGS(compile_op)
+    SpfInfo * const info = &op->info;
+    UINTVAL         i    = pos;
+
+    op->term        = 0;
+    op->start       = pos;
+    op->length      = 0;
+    op->text        = NULL;
+    op->width_scale = 1;
+    op->width_args  = 0;
+    op->prec_arg    = 0;
+    op->cfmt[0]     = '\0';
+    SPRINTF_RESET_SPFINFO(*info);
+
+    if (STRING_ord(interp, pat, i) != '%'
+    || (i + 1 < pat_len && STRING_ord(interp, pat, i + 1) == '%')) {
+        /* a "%%" pattern outputs the second '%' as text */
+        if (STRING_ord(interp, pat, i) == '%')
             ++i;
-            ++old;
-            ++len;
-            continue;
-        }
 
-        /* hoo boy, here we go... */
+        op->kind  = SPF_TEXT;
+        op->start = i;
 
-        SPRINTF_RESET_SPFINFO(info);
+        for (++i; i < pat_len && STRING_ord(interp, pat, i) != '%'; ++i)
+            ; /* nothing */
 
-        /* Reset temporaries */
-        tc[0] = '\0';
+        op->length = i - op->start;
+        return i;
+    }
+
+    /* a lone '%' ending the pattern */
+    if (i + 1 == pat_len) {
+        op->kind   = SPF_BAD;
+        op->length = 1;
+        return pat_len;
+    }
+
+    op->kind = SPF_FIELD;
 
 /*  This can be really hard to understand, so I'll try to explain beforehand.
 *  A rough grammar for a printf format is:
@@ -554,412 +803,603 @@ Parrot_sprintf_format(PARROT_INTERP, ARGIN(const STRING *pat), ARGMOD(SPRINTF_OB
 *      supported.
 */
 
-        for (++i; i < pat_len && info.phase != PHASE_DONE; ++i) {
-            const INTVAL ch = STRING_ord(interp, pat, i);
+    for (++i; i < pat_len && info->phase != PHASE_DONE; ++i) {
+        const INTVAL ch = STRING_ord(interp, pat, i);
 
-            switch (info.phase) {
-            /*@fallthrough@ */ case PHASE_FLAGS:
-                switch (ch) {
-                  case '-':
-                    info.flags |= FLAG_MINUS;
-                    continue;
+        switch (info->phase) {
+        /*@fallthrough@ */ case PHASE_FLAGS:
+            switch (ch) {
+              case '-':
+                info->flags |= FLAG_MINUS;
+                continue;
 
-                  case '+':
-                    info.flags |= FLAG_PLUS;
-                    continue;
+              case '+':
+                info->flags |= FLAG_PLUS;
+                continue;
 
-                  case '0':
-                    info.flags |= FLAG_ZERO;
-                    continue;
+              case '0':
+                info->flags |= FLAG_ZERO;
+                continue;
 
-                  case ' ':
-                    info.flags |= FLAG_SPACE;
-                    continue;
+              case ' ':
+                info->flags |= FLAG_SPACE;
+                continue;
 
-                  case '#':
-                    info.flags |= FLAG_SHARP;
-                    continue;
+              case '#':
+                info->flags |= FLAG_SHARP;
+                continue;
 
-                  default:
-                    info.phase = PHASE_WIDTH;
-                }
+              default:
+                info->phase = PHASE_WIDTH;
+            }
 
 
-            /*@fallthrough@ */ case PHASE_WIDTH:
-                switch (ch) {
-                  case '0':
-                  case '1':
-                  case '2':
-                  case '3':
-                  case '4':
-                  case '5':
-                  case '6':
-                  case '7':
-                  case '8':
-                  case '9':
-                    info.flags |= FLAG_WIDTH;
-                    info.width *= 10;
-                    info.width += ch - '0';
-                    continue;
-
-                  case '*':
-                    info.flags |= FLAG_WIDTH;
-                    num = obj->getint(interp, SIZE_XVAL, obj);
-                    if (num < 0) {
-                        info.flags |= FLAG_MINUS;
-                        info.width = -num;
-                    }
-                    else {
-                        info.width = num;
-                    }
-                    continue;
-
-                  case '.':
-                    info.phase = PHASE_PREC;
-                    continue;
-
-                  default:
-                    info.phase = PHASE_PREC;
-                }
+        /*@fallthrough@ */ case PHASE_WIDTH:
+            switch (ch) {
+              case '0':
+              case '1':
+              case '2':
+              case '3':
+              case '4':
+              case '5':
+              case '6':
+              case '7':
+              case '8':
+              case '9':
+                info->flags |= FLAG_WIDTH;
+                info->width *= 10;
+                info->width += ch - '0';
+                op->width_scale *= 10;
+                continue;
+
+              case '*':
+                /* the argument replaces any digits so far */
+                info->flags |= FLAG_WIDTH;
+                info->width     = 0;
+                op->width_scale = 1;
+                ++op->width_args;
+                continue;
+
+              case '.':
+                info->phase = PHASE_PREC;
+                continue;
+
+              default:
+                info->phase = PHASE_PREC;
+            }
+
+
+        /*@fallthrough@ */ case PHASE_PREC:
+            switch (ch) {
+              case '0':
+              case '1':
+              case '2':
+              case '3':
+              case '4':
+              case '5':
+              case '6':
+              case '7':
+              case '8':
+              case '9':
+                info->flags |= FLAG_PREC;
+                info->prec *= 10;
+                info->prec += ch - '0';
+                continue;
+
+              case '*':
+                info->flags |= FLAG_PREC;
+                op->prec_arg = 1;
+                info->phase  = PHASE_TYPE;
+                continue;
+
+              default:
+                info->phase = PHASE_TYPE;
+            }
 
+        /*@fallthrough@ */ case PHASE_TYPE:
+            switch (ch) {
+              case 'h':
+                info->type = SIZE_SHORT;
+                continue;
 
-            /*@fallthrough@ */ case PHASE_PREC:
-                switch (ch) {
-                  case '0':
-                  case '1':
-                  case '2':
-                  case '3':
-                  case '4':
-                  case '5':
-                  case '6':
-                  case '7':
-                  case '8':
-                  case '9':
-                    info.flags |= FLAG_PREC;
-                    info.prec *= 10;
-                    info.prec += ch - '0';
-                    continue;
-
-                  case '*':
-                    info.flags |= FLAG_PREC;
-                    info.prec = (UINTVAL)obj->getint(interp,
-                                             SIZE_XVAL, obj);
-                    info.phase = PHASE_TYPE;
-                    continue;
-
-                  default:
-                    info.phase = PHASE_TYPE;
+              case 'l':
+                info->type = SIZE_LONG;
+                continue;
+
+              case 'L':
+              case 'H':
+                info->type = SIZE_HUGE;
+                continue;
+
+              case 'v':
+                info->type = SIZE_XVAL;
+                continue;
+
+              case 'O':
+                info->type = SIZE_OPCODE;
+                continue;
+
+              case 'P':
+                info->type = SIZE_PMC;
+                continue;
+
+              case 'S':
+                info->type = SIZE_PSTR;
+                continue;
+
+              default:
+                info->phase = PHASE_TERM;
+            }
+
+
+        /*@fallthrough@ */ case PHASE_TERM:
+            switch (ch) {
+              case 'c': case 'o': case 'x': case 'X': case 'b': case 'B':
+              case 'u': case 'd': case 'i': case 'p':
+              case 'e': case 'E': case 'f': case 'g': case 'G':
+              case 'r': case 's':
+                op->term = ch;
+                break;
+
+              default:
+                /* fake the old %P and %S commands */
+                if (info->type == SIZE_PMC || info->type == SIZE_PSTR) {
+                    /* %s will see the SIZE_PMC or SIZE_PSTR and assume
+                     * it was %Ps (or %Ss); the character is left as text */
+                    op->term = 's';
+                    --i;
+                }
+                else {
+                    op->kind = SPF_BAD;
+                    op->term = ch;
                 }
+            }
+
+            info->phase = PHASE_DONE;
+            break;
+
+          case PHASE_DONE:
+          default:
+            break;
+        }
+    }
+
+    op->length = i - op->start;
+
+    /* the C format of a float field is known unless it takes arguments */
+    if (!op->width_args && !op->prec_arg)
+        switch (op->term) {
+          case 'e': case 'E': case 'f': case 'g': case 'G':
+            gen_sprintf_call(op->cfmt, info, op->term);
+            break;
+          default:
+            break;
+        }
+
+    return op->kind == SPF_BAD ? pat_len : i;
+}
+
+/*
+
+=item C<static UINTVAL compile_format(PARROT_INTERP, const STRING *pat, UINTVAL
+pos, SpfOp *ops, UINTVAL n)>
+
+Compiles C<pat> from C<pos> into at most C<n - 1> ops of C<ops>, terminated
+by an C<SPF_END> op, and returns the position where compiling stopped; the
+length of C<pat> when it is done.
+
+=cut
+
+*/
+
+static UINTVAL
+compile_format(PARROT_INTERP, ARGIN(const STRING *pat), UINTVAL pos,
+        ARGOUT(SpfOp *ops), UINTVAL n)
+{
+    ASSERT_ARGS(compile_format)
+    const UINTVAL pat_len = Parrot_str_length(interp, pat);
+    UINTVAL       count   = 0;
+
+    while (pos < pat_len && count < n - 1)
+        pos = compile_op(interp, pat, pat_len, pos, &ops[count++]);
 
-            /*@fallthrough@ */ case PHASE_TYPE:
-                switch (ch) {
-                  case 'h':
-                    info.type = SIZE_SHORT;
-                    continue;
+    ops[count].kind = SPF_END;
+    return pos;
+}
 
-                  case 'l':
-                    info.type = SIZE_LONG;
-                    continue;
+/*
 
-                  case 'L':
-                  case 'H':
-                    info.type = SIZE_HUGE;
-                    continue;
+=item C<static const SpfOp * find_format(PARROT_INTERP, const STRING *pat)>
 
-                  case 'v':
-                    info.type = SIZE_XVAL;
-                    continue;
+Returns the compiled ops of C<pat> from C<interp-E<gt>sprintf_cache>, compiling
+and caching them first if C<pat> is a constant, or has a constant twin in the
+intern table. Formats given in bytecode are constants, so that covers the
+patterns used over and over; cached ops keep their literal text as constant
+strings too, and nothing in the cache needs marking.
 
-                  case 'O':
-                    info.type = SIZE_OPCODE;
-                    continue;
+Returns NULL for other patterns, and for any beyond the first
+C<SPRINTF_CACHE_SIZE>.
 
-                  case 'P':
-                    info.type = SIZE_PMC;
-                    continue;
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static const SpfOp *
+find_format(PARROT_INTERP, ARGIN(const STRING *pat))
+{
+    ASSERT_ARGS(find_format)
+    Hash          *cache = interp->sprintf_cache;
+    const STRING  *key   = pat;
+    SpfOp         *ops;
+    UINTVAL        size  = SPF_CACHE_OPS;
+    UINTVAL        count = 0;
+    UINTVAL        pos   = 0;
+    UINTVAL        pat_len;
+
+    if (cache) {
+        ops = (SpfOp *)Parrot_hash_get(interp, cache, pat);
+
+        if (ops)
+            return ops;
+
+        if (Parrot_hash_size(interp, cache) >= SPRINTF_CACHE_SIZE)
+            return NULL;
+    }
+
+    if (!PObj_constant_TEST(pat)) {
+        key = Parrot_str_find_interned(interp, pat);
+
+        if (!key || !PObj_constant_TEST(key))
+            return NULL;
+    }
+
+    if (!cache)
+        cache = interp->sprintf_cache = Parrot_hash_create(interp,
+                                            enum_type_ptr,
+                                            Hash_key_type_STRING_enc);
+
+    pat_len = Parrot_str_length(interp, key);
+    ops     = mem_gc_allocate_n_typed(interp, size, SpfOp);
+
+    for (;;) {
+        pos = compile_format(interp, key, pos, ops + count, size - count);
+
+        for (; ops[count].kind != SPF_END; ++count) {
+            if (ops[count].kind == SPF_TEXT) {
+                const STRING * const text = STRING_substr(interp, key,
+                        ops[count].start, ops[count].length);
+                ops[count].text = Parrot_str_new_init(interp, text->strstart,
+                        text->bufused, text->encoding, PObj_constant_FLAG);
+            }
+        }
+
+        if (pos >= pat_len)
+            break;
+
+        size *= 2;
+        ops   = mem_gc_realloc_n_typed(interp, ops, size, SpfOp);
+    }
+
+    {
+        DECL_CONST_CAST;
+        Parrot_hash_put(interp, cache, PARROT_const_cast(STRING *, key), ops);
+    }
+
+    return ops;
+}
+
+/*
+
+=item C<static void render_format(PARROT_INTERP, const STRING *pat, const SpfOp
+*op, SPRINTF_OBJ *obj, PMC *targ)>
+
+Renders the compiled ops of C<pat>, up to their C<SPF_END>, into the
+StringBuilder C<targ>, fetching field values from C<obj>.
+
+=cut
+
+*/
+
+static void
+render_format(PARROT_INTERP, ARGIN(const STRING *pat), ARGIN(const SpfOp *op),
+        ARGMOD(SPRINTF_OBJ *obj), ARGMOD(PMC *targ))
+{
+    ASSERT_ARGS(render_format)
+
+    /* tc is used as a temporary buffer by Parrot_str_from_uint and
+     * format_decimal, and as a target of snprintf for floats. */
+    char tc[PARROT_SPRINTF_BUFFER_SIZE];
 
-                  case 'S':
-                    info.type = SIZE_PSTR;
-                    continue;
+    for (; op->kind != SPF_END; ++op) {
+        SpfInfo info;
+        INTVAL  ch;
 
-                  default:
-                    info.phase = PHASE_TERM;
+        if (op->kind == SPF_TEXT) {
+            VTABLE_push_string(interp, targ, op->text
+                ? op->text
+                : STRING_substr(interp, pat, op->start, op->length));
+            continue;
+        }
+
+        if (op->kind == SPF_BAD) {
+            /* fail on a lone trailing '%' as parsing it used to */
+            if (!op->term)
+                (void)STRING_ord(interp, pat, op->start + 1);
+
+            Parrot_ex_throw_from_c_args(interp, NULL,
+                EXCEPTION_INVALID_CHARACTER,
+                "'%c' is not valid in sprintf format sequence '%Ss'",
+                op->term,
+                STRING_substr(interp, pat, op->start, op->length));
+        }
+
+        info = op->info;
+        ch   = op->term;
+
+        if (op->width_args) {
+            UINTVAL width = 0;
+            INTVAL  n;
+
+            for (n = 0; n < op->width_args; ++n) {
+                const HUGEINTVAL num = obj->getint(interp, SIZE_XVAL, obj);
+
+                if (num < 0) {
+                    info.flags |= FLAG_MINUS;
+                    width = -num;
                 }
+                else {
+                    width = num;
+                }
+            }
 
+            info.width = width * op->width_scale + op->info.width;
+        }
 
-            /*@fallthrough@ */ case PHASE_TERM:
-                switch (ch) {
-                    /* INTEGERS */
-                  case 'c':
-                    {
-                        STRING * const ts = Parrot_str_chr(interp,
-                             (UINTVAL)obj->getint(interp, info.type, obj));
-                        str_concat_w_flags(interp, targ, &info, ts, NULL);
-                    }
-                    break;
-
-                  case 'o':
-                    {
-                        const UHUGEINTVAL theuint =
-                            obj->getuint(interp, info.type, obj);
-                        STRING * const ts    =
-                            Parrot_str_from_uint(interp, tc, theuint, 8, 0);
-                        STRING * const prefix = CONST_STRING(interp, "0");
-
-                        /* unsigned conversion - no plus */
-                        info.flags &= ~FLAG_PLUS;
-                        str_concat_w_flags(interp, targ, &info, ts, prefix);
-                    }
-                    break;
-
-                  case 'x':
-                    {
-                        const UHUGEINTVAL theuint =
-                            obj->getuint(interp, info.type, obj);
-                        STRING * const ts         =
-                            Parrot_str_from_uint(interp, tc, theuint, 16, 0);
-                        STRING * const prefix = CONST_STRING(interp, "0x");
-
-                        /* unsigned conversion - no plus */
-                        info.flags &= ~FLAG_PLUS;
-                        str_concat_w_flags(interp, targ, &info, ts, prefix);
-                    }
-                    break;
-
-                  case 'X':
-                    {
-                        STRING * const prefix = CONST_STRING(interp, "0X");
-                        const UHUGEINTVAL theuint =
-                            obj->getuint(interp, info.type, obj);
-                        STRING * ts =
-                            Parrot_str_from_uint(interp, tc, theuint, 16, 0);
-                        ts = Parrot_str_upcase(interp, ts);
-
-                        /* unsigned conversion - no plus */
-                        info.flags &= ~FLAG_PLUS;
-                        str_concat_w_flags(interp, targ, &info, ts, prefix);
-                    }
-                    break;
-
-                  case 'b':
-                    {
-                        STRING * const prefix = CONST_STRING(interp, "0b");
-                        const UHUGEINTVAL theuint =
-                            obj->getuint(interp, info.type, obj);
-                        STRING * const ts =
-                            Parrot_str_from_uint(interp, tc, theuint, 2, 0);
-
-                        /* unsigned conversion - no plus */
-                        info.flags &= ~FLAG_PLUS;
-                        str_concat_w_flags(interp, targ, &info, ts, prefix);
-                    }
-                    break;
-
-                  case 'B':
-                    {
-                        STRING * const prefix = CONST_STRING(interp, "0B");
-                        const HUGEINTVAL theint =
-                            obj->getint(interp, info.type, obj);
-                        STRING * const ts =
-                            Parrot_str_from_int_base(interp, tc, theint, 2);
-
-                        /* unsigned conversion - no plus */
-                        info.flags &= ~FLAG_PLUS;
-                        str_concat_w_flags(interp, targ, &info, ts, prefix);
-                    }
-                    break;
-
-                  case 'u':
-                    {
-                        const UHUGEINTVAL theuint =
-                            obj->getuint(interp, info.type, obj);
-                        sharedint = theuint;
-                    }
-                    goto do_sprintf;
-                  case 'd':
-                  case 'i':
-
-                    /* EVIL: Work around bug in glibc that makes %0lld
-                     * sometimes output an empty string. */
-                    if (!(info.flags & FLAG_WIDTH))
-                        info.flags &= ~FLAG_ZERO;
-
-                    sharedint = obj->getint(interp, info.type, obj);
-                  do_sprintf:
-                    {
-                        STRING *ts;
-                        gen_sprintf_call(tc, &info, ch);
-                        ts = cstr2pstr(tc);
-                        {
-                            char * const tempstr =
-                                Parrot_str_to_cstring(interp, ts);
+        if (op->prec_arg)
+            info.prec = (UINTVAL)obj->getint(interp, SIZE_XVAL, obj);
 
+        switch (ch) {
+            /* INTEGERS */
+          case 'c':
+            {
+                STRING * const ts = Parrot_str_chr(interp,
+                     (UINTVAL)obj->getint(interp, info.type, obj));
+                str_concat_w_flags(interp, targ, &info, ts, NULL);
+            }
+            break;
+
+          case 'o':
+            {
+                const UHUGEINTVAL theuint =
+                    obj->getuint(interp, info.type, obj);
+                STRING * const ts    =
+                    Parrot_str_from_uint(interp, tc, theuint, 8, 0);
+                STRING * const prefix = CONST_STRING(interp, "0");
+
+                /* unsigned conversion - no plus */
+                info.flags &= ~FLAG_PLUS;
+                str_concat_w_flags(interp, targ, &info, ts, prefix);
+            }
+            break;
+
+          case 'x':
+            {
+                const UHUGEINTVAL theuint =
+                    obj->getuint(interp, info.type, obj);
+                STRING * const ts         =
+                    Parrot_str_from_uint(interp, tc, theuint, 16, 0);
+                STRING * const prefix = CONST_STRING(interp, "0x");
+
+                /* unsigned conversion - no plus */
+                info.flags &= ~FLAG_PLUS;
+                str_concat_w_flags(interp, targ, &info, ts, prefix);
+            }
+            break;
+
+          case 'X':
+            {
+                STRING * const prefix = CONST_STRING(interp, "0X");
+                const UHUGEINTVAL theuint =
+                    obj->getuint(interp, info.type, obj);
+                STRING * ts =
+                    Parrot_str_from_uint(interp, tc, theuint, 16, 0);
+                ts = Parrot_str_upcase(interp, ts);
+
+                /* unsigned conversion - no plus */
+                info.flags &= ~FLAG_PLUS;
+                str_concat_w_flags(interp, targ, &info, ts, prefix);
+            }
+            break;
+
+          case 'b':
+            {
+                STRING * const prefix = CONST_STRING(interp, "0b");
+                const UHUGEINTVAL theuint =
+                    obj->getuint(interp, info.type, obj);
+                STRING * const ts =
+                    Parrot_str_from_uint(interp, tc, theuint, 2, 0);
+
+                /* unsigned conversion - no plus */
+                info.flags &= ~FLAG_PLUS;
+                str_concat_w_flags(interp, targ, &info, ts, prefix);
+            }
+            break;
+
+          case 'B':
+            {
+                STRING * const prefix = CONST_STRING(interp, "0B");
+                const HUGEINTVAL theint =
+                    obj->getint(interp, info.type, obj);
+                STRING * const ts =
+                    Parrot_str_from_int_base(interp, tc, theint, 2);
+
+                /* unsigned conversion - no plus */
+                info.flags &= ~FLAG_PLUS;
+                str_concat_w_flags(interp, targ, &info, ts, prefix);
+            }
+            break;
+
+          case 'u':
+            {
+                const UHUGEINTVAL theuint =
+                    obj->getuint(interp, info.type, obj);
+                VTABLE_push_string(interp, targ,
+                    format_decimal(interp, &info, theuint, 0, 0, tc));
+            }
+            break;
+
+          case 'd':
+          case 'i':
+            {
+                const HUGEINTVAL theint = obj->getint(interp, info.type, obj);
+                const UHUGEINTVAL magnitude = theint < 0
+                                            ? -(UHUGEINTVAL)theint
+                                            : (UHUGEINTVAL)theint;
+                VTABLE_push_string(interp, targ,
+                    format_decimal(interp, &info, magnitude, theint < 0, 1, tc));
+            }
+            break;
+
+          case 'p':
+            {
+                STRING * const prefix = CONST_STRING(interp, "0x");
+                const void * const ptr =
+                    obj->getptr(interp, info.type, obj);
+                STRING * const ts = Parrot_str_from_uint(interp, tc,
+                           (UHUGEINTVAL) (size_t) ptr, 16, 0);
+
+                str_concat_w_flags(interp, targ, &info, ts, prefix);
+            }
+            break;
+
+            /* FLOATS - We cheat on these and use snprintf. */
+          case 'e':
+          case 'E':
+          case 'f':
+          case 'g':
+          case 'G':
+            {
+                const HUGEFLOATVAL thefloat =
+                    obj->getfloat(interp, info.type, obj);
+                const char *special = NULL;
+                char        cfmt[32];
+
+                if (op->cfmt[0])
+                    strcpy(cfmt, op->cfmt);
+                else
+                    gen_sprintf_call(cfmt, &info, ch);
+
+                /* check for Inf and NaN values and honor width, but not prec */
+                if (PARROT_FLOATVAL_IS_POSINF(thefloat))
+                    special = PARROT_CSTRING_INF_POSITIVE;
+                else if (PARROT_FLOATVAL_IS_NEGINF(thefloat))
+                    special = PARROT_CSTRING_INF_NEGATIVE;
+                else if (PARROT_FLOATVAL_IS_NAN(thefloat))
+                    special = PARROT_CSTRING_NAN_QUIET;
+
+                /* XXX lost precision if %Hg or whatever */
+
+                /* Apply width to NaN/Inf/-Inf [GH #1100/perl6 RT#116280]
+                   Don't rely on how systems print nan. */
+                if (special) {
 #ifdef PARROT_HAS_SNPRINTF
-                            snprintf(tc, PARROT_SPRINTF_BUFFER_SIZE,
-                                     tempstr, sharedint);
-#else
-                            /* the buffer is 4096, so no problem here */
-                            sprintf(tc, tempstr, sharedint);
-#endif
-                            Parrot_str_free_cstring(tempstr);
-                        }
-                        VTABLE_push_string(interp, targ, cstr2pstr(tc));
-                    }
-                    break;
-
-                  case 'p':
-                    {
-                        STRING * const prefix = CONST_STRING(interp, "0x");
-                        const void * const ptr =
-                            obj->getptr(interp, info.type, obj);
-                        STRING * const ts = Parrot_str_from_uint(interp, tc,
-                                   (UHUGEINTVAL) (size_t) ptr, 16, 0);
-
-                        str_concat_w_flags(interp, targ, &info, ts, prefix);
-                    }
-                    break;
-
-                    /* FLOATS - We cheat on these and use snprintf. */
-                  case 'e':
-                  case 'E':
-                  case 'f':
-                  case 'g':
-                  case 'G':
-                    {
-                        STRING *ts = NULL;
-                        const HUGEFLOATVAL thefloat =
-                            obj->getfloat(interp, info.type, obj);
-                        int is_special = 0;
-
-                        gen_sprintf_call(tc, &info, ch);
-                        /* check for Inf and NaN values and honor width, but not prec */
-                        if (PARROT_FLOATVAL_IS_POSINF(thefloat)) {
-                            ts = cstr2pstr(PARROT_CSTRING_INF_POSITIVE);
-                            is_special++;
-                        }
-                        else if (PARROT_FLOATVAL_IS_NEGINF(thefloat)) {
-                            ts = cstr2pstr(PARROT_CSTRING_INF_NEGATIVE);
-                            is_special++;
-                        }
-                        else if (PARROT_FLOATVAL_IS_NAN(thefloat)) {
-                            ts = cstr2pstr(PARROT_CSTRING_NAN_QUIET);
-                            is_special++;
-                        }
-                        else {
-                            /* turn -0.0 into 0.0 */
-                            ts = cstr2pstr(tc);
-                        }
-
-                        /* XXX lost precision if %Hg or whatever */
-                        {
-                            char * const tempstr =
-                                Parrot_str_to_cstring(interp, ts);
-
-                            /* Apply width to NaN/Inf/-Inf [GH #1100/perl6 RT#116280]
-                               Don't rely on how systems print nan. */
-                            if (is_special && info.width != 0) {
-                                char tc1[16];
-#ifdef PARROT_HAS_SNPRINTF
-                                snprintf(tc1, 16, "%%%ds", info.width);
-                                snprintf(tc, PARROT_SPRINTF_BUFFER_SIZE,
-                                         tc1, tempstr);
+                    snprintf(tc, PARROT_SPRINTF_BUFFER_SIZE,
+                             "%*s", (int)info.width, special);
 #else
-                                sprintf(tc1, "%%%ds", info.width);
-                                sprintf(tc, tc1, tempstr);
+                    sprintf(tc, "%*s", (int)info.width, special);
 #endif
-                            }
-                            else {
+                }
+                else {
 #ifdef PARROT_HAS_SNPRINTF
-                                snprintf(tc, PARROT_SPRINTF_BUFFER_SIZE,
-                                         tempstr, (double)thefloat);
+                    snprintf(tc, PARROT_SPRINTF_BUFFER_SIZE,
+                             cfmt, (double)thefloat);
 #else
-                                /* the buffer is 4096, so no problem here */
-                                sprintf(tc, tempstr, (double)thefloat);
+                    /* the buffer is 4096, so no problem here */
+                    sprintf(tc, cfmt, (double)thefloat);
 #endif
-                            }
-                            Parrot_str_free_cstring(tempstr);
-                        }
-
-                        if (ch == 'e' || ch == 'E' ||
-                            ch == 'g' || ch == 'G')
-                        canonicalize_exponent(tc, &info);
-
-                        VTABLE_push_string(interp, targ, cstr2pstr(tc));
-                    }
-                    break;
-
-                    /* STRINGS */
-                  case 'r':        /* Python repr */
-                    /* XXX the right fix is to add a getrepr entry *
-                     * to SPRINTF_OBJ, but for now, getstring_pmc  *
-                     * is inlined and modified to call get_repr    */
-                    if (obj->getstring == pmc_core.getstring) {
-                        PMC * const tmp = VTABLE_get_pmc_keyed_int(interp,
-                                                ((PMC *)obj->data),
-                                                (obj->index));
-
-                        STRING * const string = VTABLE_get_repr(interp, tmp);
-                        STRING * const ts     = handle_flags(interp, &info,
-                                                             string, 0, NULL);
-                        ++obj->index;
-                        VTABLE_push_string(interp, targ, ts);
-                        break;
-                    }
-
-                  case 's':
-                  CASE_s:
-                    {
-                        STRING * const string = obj->getstring(interp,
-                                                    info.type, obj);
-                        /* XXX Silently ignore? */
-                        if (!STRING_IS_NULL(string)) {
-                            STRING * const ts = handle_flags(interp, &info,
-                                                             string, 0, NULL);
-                            VTABLE_push_string(interp, targ, ts);
-                        }
-                    }
-                    break;
-
-                  default:
-                    /* fake the old %P and %S commands */
-                    if (info.type == SIZE_PMC || info.type == SIZE_PSTR) {
-                        --i;
-                        goto CASE_s;
-                        /* case 's' will see the SIZE_PMC or SIZE_PSTR
-                         * and assume it was %Ps (or %Ss).  Genius,
-                         * no?  */
-                    }
-                    else {
-                        Parrot_ex_throw_from_c_args(interp, NULL,
-                            EXCEPTION_INVALID_CHARACTER,
-                            "'%c' is not valid in sprintf format sequence '%Ss'",
-                            ch,
-                            STRING_substr(interp, pat, fmt_start_idx, i - fmt_start_idx + 1));
-                    }
                 }
 
-                info.phase = PHASE_DONE;
+                if (ch == 'e' || ch == 'E' ||
+                    ch == 'g' || ch == 'G')
+                canonicalize_exponent(tc, &info);
+
+                VTABLE_push_string(interp, targ, cstr2pstr(tc));
+            }
+            break;
+
+            /* STRINGS */
+          case 'r':        /* Python repr */
+            /* XXX the right fix is to add a getrepr entry *
+             * to SPRINTF_OBJ, but for now, getstring_pmc  *
+             * is inlined and modified to call get_repr    */
+            if (obj->getstring == pmc_core.getstring) {
+                PMC * const tmp = VTABLE_get_pmc_keyed_int(interp,
+                                        ((PMC *)obj->data),
+                                        (obj->index));
+
+                STRING * const string = VTABLE_get_repr(interp, tmp);
+                STRING * const ts     = handle_flags(interp, &info,
+                                                     string, 0, NULL);
+                ++obj->index;
+                VTABLE_push_string(interp, targ, ts);
                 break;
+            }
 
-              case PHASE_DONE:
-              default:
-                /* This is the terminating condition of the surrounding
-                 * loop, so we absolutely shouldn't be here. Throw an
-                 * exception and hope this doesn't happen often.
-                 */
-                Parrot_ex_throw_from_c_args(interp, NULL,
-                    EXCEPTION_INVALID_CHARACTER,
-                    "Catastrophic sprintf error. Your input is very bad. "
-                    "Please file a bug report.");
+          case 's':
+            {
+                STRING * const string = obj->getstring(interp,
+                                            info.type, obj);
+                /* XXX Silently ignore? */
+                if (!STRING_IS_NULL(string)) {
+                    STRING * const ts = handle_flags(interp, &info,
+                                                     string, 0, NULL);
+                    VTABLE_push_string(interp, targ, ts);
+                }
             }
-        }
+            break;
 
-        old = i;
-        --i;
+          default:
+            /* the pattern ended within the field */
+            break;
+        }
     }
-    if (len) {
-        substr = STRING_substr(interp, pat, old, len);
-        VTABLE_push_string(interp, targ, substr);
+}
+
+/*
+
+=item C<STRING * Parrot_sprintf_format(PARROT_INTERP, const STRING *pat,
+SPRINTF_OBJ *obj)>
+
+This is the engine that does all the formatting. Cached patterns are
+rendered from their compiled ops; any other is compiled an op at a time into
+a small buffer on the stack, rendering each op before compiling the next.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+STRING *
+Parrot_sprintf_format(PARROT_INTERP, ARGIN(const STRING *pat), ARGMOD(SPRINTF_OBJ *obj))
+{
+    ASSERT_ARGS(Parrot_sprintf_format)
+    const UINTVAL       pat_len = Parrot_str_length(interp, pat);
+    const SpfOp * const format  = find_format(interp, pat);
+    PMC * const targ = Parrot_pmc_new_init_int(interp, enum_class_StringBuilder, pat_len * 2);
+
+    if (format)
+        render_format(interp, pat, format, obj, targ);
+    else {
+        SpfOp   ops[SPF_CHUNK_OPS];
+        UINTVAL pos = 0;
+
+        while (pos < pat_len) {
+            pos = compile_format(interp, pat, pos, ops, SPF_CHUNK_OPS);
+            render_format(interp, pat, ops, obj, targ);
+        }
     }
 
     return VTABLE_get_string(interp, targ);
@@ -245,6 +245,31 @@ Parrot_psprintf(PARROT_INTERP, ARGIN(STRING *pat), ARGOUT(PMC *ary))
 
 /*
 
+=item C<void Parrot_sprintf_destroy_cache(PARROT_INTERP)>
+
+Frees the compiled formats cached by C<Parrot_sprintf_format()> for
+C<interp>. Their keys and literal text are constant strings, which go with
+the constant string pool.
+
+=cut
+
+*/
+
+void
+Parrot_sprintf_destroy_cache(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_sprintf_destroy_cache)
+    Hash * const cache = interp->sprintf_cache;
+
+    if (cache) {
+        parrot_hash_iterate(cache, mem_gc_free(interp, _bucket->value););
+        Parrot_hash_destroy(interp, cache);
+        interp->sprintf_cache = NULL;
+    }
+}
+
+/*
+
 =item C<int Parrot_secret_snprintf(char *buffer, size_t len, const char *format,
 ...)>
 
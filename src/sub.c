@@ -155,29 +155,19 @@ Parrot_sub_context_get_info(PARROT_INTERP, ARGIN(PMC *ctx),
 
     /* determine the current source file/line */
     if (pc) {
-        const size_t offs = info->pc;
-        size_t i, n;
         PackFile_Debug * const debug = sub->seg->debugs;
-        pc = sub->seg->base.data;
+        INTVAL                 i;
 
         if (!debug)
             return 0;
-        for (i = n = 0; n < sub->seg->base.size; ++i) {
-            op_info_t * const op_info = sub->seg->op_info_table[*pc];
-            opcode_t var_args = 0;
-
-            if (i >= debug->base.size)
-                return 0;
-            if (n >= offs) {
-                /* set source line and file */
-                info->line = debug->base.data[i];
-                info->file = Parrot_debug_pc_to_filename(interp, debug, i);
-                break;
-            }
-            ADD_OP_VAR_PART(interp, sub->seg, pc, var_args);
-            n  += op_info->op_count + var_args;
-            pc += op_info->op_count + var_args;
-        }
+
+        i = Parrot_pf_debug_op_index(interp, debug, info->pc);
+        if (i < 0)
+            return 0;
+
+        /* set source line and file */
+        info->line = debug->base.data[i];
+        info->file = Parrot_debug_pc_to_filename(interp, debug, i);
     }
 
     return 1;
@@ -201,39 +191,25 @@ Parrot_sub_get_line_from_pc(PARROT_INTERP, ARGIN_NULLOK(PMC *subpmc), ARGIN_NULL
 {
     ASSERT_ARGS(Parrot_sub_get_line_from_pc)
     Parrot_Sub_attributes *sub;
-    opcode_t              *base_pc, *debug_ops;
-    size_t                 i, op, current_annotation, debug_size, code_size;
+    PackFile_Debug        *debug;
+    INTVAL                 i;
 
     if (!subpmc || !pc)
         return -1;
 
     PMC_get_sub(interp, subpmc, sub);
 
-    debug_ops          = sub->seg->debugs->base.data;
-    debug_size         = sub->seg->debugs->base.size;
-    code_size          = sub->seg->base.size;
-    base_pc            = sub->seg->base.data;
-    current_annotation = pc - base_pc;
+    debug = sub->seg->debugs;
+    if (!debug)
+        return -1;
 
     /* assert pc is in correct segment */
-    PARROT_ASSERT(base_pc <= pc && pc <= base_pc + code_size);
-
-    for (i = op = 0; op < code_size; ++i) {
-        op_info_t * const op_info  = sub->seg->op_info_table[*base_pc];
-        opcode_t          var_args = 0;
-
-        if (i >= debug_size)
-            return -1;
+    PARROT_ASSERT(sub->seg->base.data <= pc
+               && pc <= sub->seg->base.data + sub->seg->base.size);
 
-        if (op >= current_annotation)
-            return debug_ops[i];
-
-        ADD_OP_VAR_PART(interp, sub->seg, base_pc, var_args);
-        op      += op_info->op_count + var_args;
-        base_pc += op_info->op_count + var_args;
-    }
+    i = Parrot_pf_debug_op_index(interp, debug, pc - sub->seg->base.data);
 
-    return -1;
+    return i < 0 ? -1 : debug->base.data[i];
 }
 
 
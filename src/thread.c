@@ -135,7 +135,8 @@ Parrot_thread_run(PARROT_INTERP, ARGMOD(PMC *thread_interp_pmc), SHIM(PMC *sub),
 =item C<PMC* Parrot_thread_create_proxy(PARROT_INTERP, Parrot_Interp const
 thread, PMC *pmc)>
 
-Create a local proxy in the thread interp for the pmc belonging to interp
+Create a local proxy in the thread interp for the pmc belonging to interp.
+A C<Channel> gets a handle of the thread's own to the same queue instead.
 
 =cut
 
@@ -152,6 +153,9 @@ Parrot_thread_create_proxy(PARROT_INTERP, ARGIN(Parrot_Interp const thread), ARG
     if (pmc->vtable->base_type == enum_class_Sub) {
         return Parrot_thread_create_local_sub(interp, thread, pmc);
     }
+    else if (pmc->vtable->base_type == enum_class_Channel) {
+        return Parrot_pmc_new_init(thread, enum_class_Channel, pmc);
+    }
     else {
         PMC * const proxy = Parrot_pmc_new_init(thread, enum_class_Proxy, pmc);
         PARROT_ASSERT(interp != thread);
@@ -230,6 +234,9 @@ Parrot_thread_create_local_task(PARROT_INTERP, ARGIN(Parrot_Interp const thread_
         new_struct->code = PARROT_PROXY(old_struct->code)->target;
         PARROT_ASSERT_INTERP(new_struct->code, interp);
     }
+    else if (old_struct->code->vtable->base_type == enum_class_NativePCCMethod)
+        /* native code has no state to share, see src/parallel.c */
+        new_struct->code = VTABLE_clone(thread_interp, old_struct->code);
     else
         new_struct->code = Parrot_thread_create_local_sub(interp, thread_interp, old_struct->code);
 
@@ -37,6 +37,47 @@ typedef struct parrot_prm_context {
     void *info;
 } parrot_prm_context;
 
+/* NCI comparators of Parrot_util_sort */
+typedef INTVAL (*sort_func_t)(PARROT_INTERP, void *, void *);
+
+/* A value being sorted, or the key computed from it */
+typedef union sort_value {
+    INTVAL    i;
+    FLOATVAL  n;
+    STRING   *s;
+    PMC      *p;
+} sort_value;
+
+/* A Sub called by Parrot_util_sort */
+typedef struct sort_sub {
+    PMC    *sub;
+    PMC    *call_object;    /* CallContext of the previous call, or PMCNULL */
+    INTVAL  reuse;          /* whether the CallContext can be called again */
+} sort_sub;
+
+/* Parrot_util_sort companion data */
+typedef struct sort_state {
+    INTVAL      type;       /* enum_type_* of the compared values */
+    size_t      size;       /* size of the sorted elements */
+    const char *items;      /* items of type, when sorting their indices */
+    sort_value *keys;       /* keys of type, when sorting indices by key */
+    sort_sub    cmp;        /* comparator; its sub is PMCNULL if native */
+    int         by_value;   /* numbers compared in place, natively */
+    char       *scratch;    /* merge buffer, half as big as the elements */
+} sort_state;
+
+/* Runs shorter than this are extended by binary insertion */
+#define SORT_MIN_MERGE 64
+
+/* Enough pending runs for any UINTVAL number of elements */
+#define SORT_MAX_RUNS  85
+
+/* Copies an element, inline in the usual case of word-sized elements */
+#define SORT_COPY(size, dest, src) \
+    (((size) == sizeof (UINTVAL)) \
+        ? memcpy((dest), (src), sizeof (UINTVAL)) \
+        : memcpy((dest), (src), (size)))
+
 /* HEADERIZER HFILE: include/parrot/misc.h */
 /* HEADERIZER BEGIN: static */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
@@ -48,18 +89,173 @@ static long _lrand48(void);
 static long _mrand48(void);
 static long _nrand48(_rand_buf buf);
 static void _srand48(long seed);
-static INTVAL COMPARE(PARROT_INTERP,
-    ARGIN(void *_a),
-    ARGIN(void *_b),
-    ARGIN(PMC *cmp),
-    ARGIN(const char * cmp_signature))
+static void next_rand(_rand_buf X);
+PARROT_CANNOT_RETURN_NULL
+static PMC * sort_call(PARROT_INTERP,
+    ARGMOD(sort_sub *c),
+    INTVAL type,
+    ARGIN(const sort_value *x),
+    ARGIN_NULLOK(const sort_value *y))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*c);
+
+PARROT_INLINE
+static INTVAL sort_compare(PARROT_INTERP,
+    ARGMOD(sort_state *s),
+    ARGIN(const char *a),
+    ARGIN(const char *b))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
         __attribute__nonnull__(3)
         __attribute__nonnull__(4)
-        __attribute__nonnull__(5);
+        FUNC_MODIFIES(*s);
+
+static INTVAL sort_compare_values(PARROT_INTERP,
+    ARGMOD(sort_state *s),
+    ARGIN(const char *a),
+    ARGIN(const char *b))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*s);
+
+static UINTVAL sort_count_run(PARROT_INTERP,
+    ARGMOD(sort_state *s),
+    ARGMOD(char *base),
+    UINTVAL n)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*s)
+        FUNC_MODIFIES(*base);
+
+static void sort_insertion(PARROT_INTERP,
+    ARGMOD(sort_state *s),
+    ARGMOD(char *base),
+    UINTVAL n,
+    UINTVAL sorted)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*s)
+        FUNC_MODIFIES(*base);
+
+static void sort_item(
+    INTVAL type,
+    ARGIN(const char *items),
+    UINTVAL i,
+    ARGOUT(sort_value *v))
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*v);
+
+PARROT_CONST_FUNCTION
+PARROT_WARN_UNUSED_RESULT
+static size_t sort_item_size(INTVAL type);
+
+static INTVAL sort_keys(PARROT_INTERP,
+    ARGIN(PMC *key),
+    INTVAL type,
+    ARGIN(const char *items),
+    UINTVAL n,
+    ARGIN(PMC *holder),
+    ARGOUT(sort_value *keys))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(4)
+        __attribute__nonnull__(6)
+        __attribute__nonnull__(7)
+        FUNC_MODIFIES(*keys);
+
+static UINTVAL sort_lower_bound(PARROT_INTERP,
+    ARGMOD(sort_state *s),
+    ARGIN(const char *base),
+    UINTVAL n,
+    ARGIN(const char *elem))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(5)
+        FUNC_MODIFIES(*s);
+
+static void sort_merge(PARROT_INTERP,
+    ARGMOD(sort_state *s),
+    ARGMOD(char *base),
+    UINTVAL na,
+    UINTVAL nb)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*s)
+        FUNC_MODIFIES(*base);
+
+static void sort_merge_at(PARROT_INTERP,
+    ARGMOD(sort_state *s),
+    ARGMOD(char *base),
+    ARGMOD(UINTVAL *start),
+    ARGMOD(UINTVAL *len),
+    int runs,
+    int k)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        __attribute__nonnull__(5)
+        FUNC_MODIFIES(*s)
+        FUNC_MODIFIES(*base)
+        FUNC_MODIFIES(*start)
+        FUNC_MODIFIES(*len);
+
+static void sort_runs(PARROT_INTERP,
+    ARGMOD(sort_state *s),
+    ARGMOD(char *base),
+    UINTVAL n)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*s)
+        FUNC_MODIFIES(*base);
+
+static void sort_sub_init(PARROT_INTERP,
+    ARGOUT(sort_sub *c),
+    ARGIN_NULLOK(PMC *sub))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*c);
+
+static UINTVAL sort_upper_bound(PARROT_INTERP,
+    ARGMOD(sort_state *s),
+    ARGIN(const char *base),
+    UINTVAL n,
+    ARGIN(const char *elem))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(5)
+        FUNC_MODIFIES(*s);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static const char * two_way_search(
+    ARGIN(const unsigned char *hay),
+    size_t hay_len,
+    ARGIN(const unsigned char *needle),
+    size_t needle_len)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(3);
+
+static size_t two_way_suffix(
+    ARGIN(const unsigned char *needle),
+    size_t needle_len,
+    int reverse,
+    ARGOUT(size_t *period))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*period);
 
-static void next_rand(_rand_buf X);
 #define ASSERT_ARGS__drand48 __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS__erand48 __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS__jrand48 __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
@@ -67,13 +263,72 @@ static void next_rand(_rand_buf X);
 #define ASSERT_ARGS__mrand48 __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS__nrand48 __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS__srand48 __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
-#define ASSERT_ARGS_COMPARE __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
-       PARROT_ASSERT_ARG(interp) \
-    , PARROT_ASSERT_ARG(_a) \
-    , PARROT_ASSERT_ARG(_b) \
-    , PARROT_ASSERT_ARG(cmp) \
-    , PARROT_ASSERT_ARG(cmp_signature))
 #define ASSERT_ARGS_next_rand __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_sort_call __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(c) \
+    , PARROT_ASSERT_ARG(x))
+#define ASSERT_ARGS_sort_compare __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(s) \
+    , PARROT_ASSERT_ARG(a) \
+    , PARROT_ASSERT_ARG(b))
+#define ASSERT_ARGS_sort_compare_values __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(s) \
+    , PARROT_ASSERT_ARG(a) \
+    , PARROT_ASSERT_ARG(b))
+#define ASSERT_ARGS_sort_count_run __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(s) \
+    , PARROT_ASSERT_ARG(base))
+#define ASSERT_ARGS_sort_insertion __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(s) \
+    , PARROT_ASSERT_ARG(base))
+#define ASSERT_ARGS_sort_item __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(items) \
+    , PARROT_ASSERT_ARG(v))
+#define ASSERT_ARGS_sort_item_size __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_sort_keys __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(key) \
+    , PARROT_ASSERT_ARG(items) \
+    , PARROT_ASSERT_ARG(holder) \
+    , PARROT_ASSERT_ARG(keys))
+#define ASSERT_ARGS_sort_lower_bound __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(s) \
+    , PARROT_ASSERT_ARG(base) \
+    , PARROT_ASSERT_ARG(elem))
+#define ASSERT_ARGS_sort_merge __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(s) \
+    , PARROT_ASSERT_ARG(base))
+#define ASSERT_ARGS_sort_merge_at __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(s) \
+    , PARROT_ASSERT_ARG(base) \
+    , PARROT_ASSERT_ARG(start) \
+    , PARROT_ASSERT_ARG(len))
+#define ASSERT_ARGS_sort_runs __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(s) \
+    , PARROT_ASSERT_ARG(base))
+#define ASSERT_ARGS_sort_sub_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(c))
+#define ASSERT_ARGS_sort_upper_bound __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(s) \
+    , PARROT_ASSERT_ARG(base) \
+    , PARROT_ASSERT_ARG(elem))
+#define ASSERT_ARGS_two_way_search __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(hay) \
+    , PARROT_ASSERT_ARG(needle))
+#define ASSERT_ARGS_two_way_suffix __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(needle) \
+    , PARROT_ASSERT_ARG(period))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
@@ -561,6 +816,239 @@ Parrot_util_tm_to_array(PARROT_INTERP, ARGIN(const struct tm *tm))
     return Array;
 }
 
+/* Needles at least this long are searched with Two-Way rather than memchr()
+ * and memcmp(), so that periodic needles can't make the search quadratic */
+#define TWO_WAY_MIN_NEEDLE 16
+
+/*
+
+=item C<static size_t two_way_suffix(const unsigned char *needle, size_t
+needle_len, int reverse, size_t *period)>
+
+Computes the maximal suffix of C<needle> under byte order, or under reverse
+byte order if C<reverse> is true, for the critical factorization of Two-Way.
+Returns the position just before the suffix (C<(size_t)-1> if the suffix is
+the whole needle) and stores the period of the suffix in C<*period>.
+
+=cut
+
+*/
+
+static size_t
+two_way_suffix(ARGIN(const unsigned char *needle), size_t needle_len, int reverse,
+        ARGOUT(size_t *period))
+{
+    ASSERT_ARGS(two_way_suffix)
+    size_t ms = (size_t)-1;     /* wraps to 0 when 1 is added */
+    size_t j  = 0;
+    size_t k  = 1;
+    size_t p  = 1;
+
+    while (j + k < needle_len) {
+        const unsigned char a = needle[ms + k];
+        const unsigned char b = needle[j + k];
+
+        if (a == b) {
+            if (k == p) {
+                j += p;
+                k  = 1;
+            }
+            else
+                ++k;
+        }
+        else if (reverse ? a < b : a > b) {
+            j += k;
+            k  = 1;
+            p  = j - ms;
+        }
+        else {
+            ms = j++;
+            k  = p = 1;
+        }
+    }
+
+    *period = p;
+    return ms;
+}
+
+/*
+
+=item C<static const char * two_way_search(const unsigned char *hay, size_t
+hay_len, const unsigned char *needle, size_t needle_len)>
+
+Crochemore and Perrin's Two-Way search, which runs in linear time and
+constant space whatever the needle.  The needle is split at its critical
+factorization; the right half is compared first, and a mismatch there
+shifts by the number of bytes matched.  For periodic needles the part of
+the window already known to match is remembered across shifts.  Each time
+nothing is remembered, C<memchr> skips ahead to the next byte that can start
+a match, which is where most of the time goes on real text.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static const char *
+two_way_search(ARGIN(const unsigned char *hay), size_t hay_len,
+        ARGIN(const unsigned char *needle), size_t needle_len)
+{
+    ASSERT_ARGS(two_way_search)
+    const unsigned char * const hay_end = hay + hay_len;
+    const unsigned char        *h       = hay;
+    size_t ms, p, ms2, p2, mem0, mem;
+
+    ms  = two_way_suffix(needle, needle_len, 0, &p);
+    ms2 = two_way_suffix(needle, needle_len, 1, &p2);
+
+    if (ms2 + 1 > ms + 1) {
+        ms = ms2;
+        p  = p2;
+    }
+
+    if (memcmp(needle, needle + p, ms + 1) == 0)
+        mem0 = needle_len - p;
+    else {
+        mem0 = 0;
+        p    = (ms + 1 > needle_len - ms - 1 ? ms + 1 : needle_len - ms - 1) + 1;
+    }
+
+    mem = 0;
+
+    while ((size_t)(hay_end - h) >= needle_len) {
+        size_t k;
+
+        if (mem == 0) {
+            h = (const unsigned char *)memchr(h, needle[0],
+                    (size_t)(hay_end - h) - needle_len + 1);
+            if (!h)
+                return NULL;
+        }
+
+        /* right half */
+        for (k = ms + 1 > mem ? ms + 1 : mem; k < needle_len && needle[k] == h[k]; ++k)
+            ;
+
+        if (k < needle_len) {
+            h  += k - ms;
+            mem = 0;
+            continue;
+        }
+
+        /* left half */
+        for (k = ms + 1; k > mem && needle[k - 1] == h[k - 1]; --k)
+            ;
+
+        if (k <= mem)
+            return (const char *)h;
+
+        h  += p;
+        mem = mem0;
+    }
+
+    return NULL;
+}
+
+/*
+
+=item C<const char * Parrot_util_memmem(const char *hay, size_t hay_len, const
+char *needle, size_t needle_len)>
+
+Returns a pointer to the first occurrence of the C<needle_len> bytes at
+C<needle> within the C<hay_len> bytes at C<hay>, or NULL if there is none.
+An empty needle is found at the start.
+
+Short needles are found with C<memchr> on their first byte, which the C
+library vectorizes, and C<memcmp> on the rest.  Long needles use Two-Way.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+PARROT_PURE_FUNCTION
+const char *
+Parrot_util_memmem(ARGIN(const char *hay), size_t hay_len,
+        ARGIN(const char *needle), size_t needle_len)
+{
+    ASSERT_ARGS(Parrot_util_memmem)
+    const char * const hay_end = hay + hay_len;
+    const char        *pos     = hay;
+
+    if (needle_len == 0)
+        return hay;
+
+    if (needle_len > hay_len)
+        return NULL;
+
+    if (needle_len == 1)
+        return (const char *)memchr(hay, *needle, hay_len);
+
+    if (needle_len >= TWO_WAY_MIN_NEEDLE)
+        return two_way_search((const unsigned char *)hay, hay_len,
+                (const unsigned char *)needle, needle_len);
+
+    /* Parrot strings can have NULLs, so strstr() won't work here */
+    while ((pos = (const char *)memchr(pos, *needle,
+                (size_t)(hay_end - pos) - needle_len + 1))) {
+        if (memcmp(pos + 1, needle + 1, needle_len - 1) == 0)
+            return pos;
+
+        if ((size_t)(hay_end - ++pos) < needle_len)
+            break;
+    }
+
+    return NULL;
+}
+
+/*
+
+=item C<const char * Parrot_util_memrmem(const char *hay, size_t hay_len, const
+char *needle, size_t needle_len)>
+
+Like C<Parrot_util_memmem>, but returns the last occurrence.  Candidates are
+tested on their first and last bytes before the rest is compared.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+PARROT_PURE_FUNCTION
+const char *
+Parrot_util_memrmem(ARGIN(const char *hay), size_t hay_len,
+        ARGIN(const char *needle), size_t needle_len)
+{
+    ASSERT_ARGS(Parrot_util_memrmem)
+    size_t i;
+    char   first, last;
+
+    if (needle_len > hay_len)
+        return NULL;
+
+    if (needle_len == 0)
+        return hay + hay_len;
+
+    first = needle[0];
+    last  = needle[needle_len - 1];
+
+    for (i = hay_len - needle_len + 1; i-- > 0;) {
+        const char * const pos = hay + i;
+
+        if (*pos == first
+        &&  pos[needle_len - 1] == last
+        &&  memcmp(pos, needle, needle_len) == 0)
+            return pos;
+    }
+
+    return NULL;
+}
+
 /*
 
 =item C<INTVAL Parrot_util_byte_index(PARROT_INTERP, const STRING *base, const
@@ -584,32 +1072,15 @@ Parrot_util_byte_index(SHIM_INTERP, ARGIN(const STRING *base),
         ARGIN(const STRING *search), UINTVAL start_offset)
 {
     ASSERT_ARGS(Parrot_util_byte_index)
-    const char * const str_start  = base->strstart;
-    const INTVAL       str_len    = base->strlen;
-    const char * const search_str = search->strstart;
-    const INTVAL       search_len = search->strlen;
-    const char        *str_pos    = str_start + start_offset;
-    INTVAL             len_remain = str_len   - start_offset;
-    const char        *search_pos;
-
-    /* find the next position of the first character in the search string
-     * Parrot strings can have NULLs, so strchr() won't work here */
-    while ((search_pos = (const char *)memchr(str_pos, *search_str, len_remain))) {
-        const INTVAL offset = search_pos - str_start;
-
-        /* now look for the entire string */
-        if (memcmp(search_pos, search_str, search_len) == 0)
-            return offset;
+    const char *found;
 
-        /* otherwise loop and memchr() with the rest of the string */
-        len_remain = str_len    - offset;
-        str_pos    = search_pos + 1;
+    if (start_offset > base->bufused)
+        return -1;
 
-        if (len_remain < search_len)
-            return -1;
-    }
+    found = Parrot_util_memmem(base->strstart + start_offset,
+                base->bufused - start_offset, search->strstart, search->bufused);
 
-    return -1;
+    return found ? found - base->strstart : -1;
 }
 
 /*
@@ -634,125 +1105,728 @@ Parrot_util_byte_rindex(SHIM_INTERP, ARGIN(const STRING *base),
         ARGIN(const STRING *search), UINTVAL start_offset)
 {
     ASSERT_ARGS(Parrot_util_byte_rindex)
-    const INTVAL searchlen          = search->strlen;
-    const char * const search_start = (const char *)(search->strstart);
-    UINTVAL max_possible_offset     = (base->strlen - search->strlen);
-    INTVAL current_offset;
-
-    if (start_offset && start_offset < max_possible_offset)
-        max_possible_offset = start_offset;
-
-    for (current_offset = max_possible_offset; current_offset >= 0;
-            current_offset--) {
-        const char * const base_start = (char *)(base->strstart) + current_offset;
-        if (memcmp(base_start, search_start, searchlen) == 0) {
-            return current_offset;
+    size_t      hay_len = base->bufused;
+    const char *found;
+
+    if (start_offset && start_offset + search->bufused < hay_len)
+        hay_len = start_offset + search->bufused;
+
+    found = Parrot_util_memrmem(base->strstart, hay_len,
+                search->strstart, search->bufused);
+
+    return found ? found - base->strstart : -1;
+}
+
+/*
+
+=item C<void Parrot_util_sort(PARROT_INTERP, INTVAL type, void *items, UINTVAL
+n, PMC *cmp, PMC *key)>
+
+Sorts the C<n> values of C<type> at C<items> in place.  C<type> is
+C<enum_type_INTVAL>, C<enum_type_FLOATVAL>, C<enum_type_STRING> or
+C<enum_type_PMC>.
+
+The sort is stable.  It merges the runs already present in the data,
+extending short ones by binary insertion, so sorted or reversed input takes
+a linear number of comparisons.  The only allocations are done up front.
+
+Without C<cmp> values are compared natively: numbers by value, strings with
+C<Parrot_str_compare> and PMCs with their C<cmp> vtable.  An NCI C<cmp> is
+called directly with both values (pointers to them for floats).  Any other
+C<cmp> is invoked with both values and returns a negative, zero or positive
+integer; if nothing can capture its frame, every comparison reuses the
+CallContext of the first.
+
+With C<key> each value is passed once to the C<key> Sub, and the values are
+ordered by the returned keys instead, which C<cmp> then compares.  Keys which
+are all Integer, Float or String PMCs are compared as native values.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_util_sort(PARROT_INTERP, INTVAL type, ARGMOD(void *items), UINTVAL n,
+        ARGIN_NULLOK(PMC *cmp), ARGIN_NULLOK(PMC *key))
+{
+    ASSERT_ARGS(Parrot_util_sort)
+    const size_t item_size = sort_item_size(type);
+    sort_state   s;
+    UINTVAL      i;
+    UINTVAL     *indices = NULL;
+    PMC         *holder  = PMCNULL;
+
+    if (n < 2)
+        return;
+
+    s.type  = type;
+    s.size  = item_size;
+    s.items = NULL;
+    s.keys  = NULL;
+    sort_sub_init(interp, &s.cmp, cmp);
+
+    /* Sort indices rather than GC-able values a Sub may see, so the values
+     * stay in their array, and by key when there are keys. */
+    if (!PMC_IS_NULL(key)
+    ||  type == enum_type_PMC
+    || (type == enum_type_STRING && !PMC_IS_NULL(s.cmp.sub))) {
+        indices = (UINTVAL *)mem_internal_allocate(n * sizeof (UINTVAL));
+        for (i = 0; i < n; ++i)
+            indices[i] = i;
+
+        s.size  = sizeof (UINTVAL);
+        s.items = (const char *)items;
+
+        if (!PMC_IS_NULL(key)) {
+            holder = Parrot_pmc_new_init_int(interp, enum_class_FixedPMCArray, (INTVAL)n);
+            Parrot_pmc_gc_register(interp, holder);
+            s.keys = (sort_value *)mem_internal_allocate(n * sizeof (sort_value));
+            s.type = sort_keys(interp, key, type, s.items, n, holder, s.keys);
         }
     }
 
-    return -1;
+    s.by_value = !s.items && PMC_IS_NULL(s.cmp.sub)
+              && (type == enum_type_INTVAL || type == enum_type_FLOATVAL);
+
+    s.scratch = (char *)mem_internal_allocate((n / 2) * s.size);
+    sort_runs(interp, &s, indices ? (char *)indices : (char *)items, n);
+    mem_internal_free(s.scratch);
+
+    /* Put the items in the order of their sorted indices */
+    if (indices) {
+        char * const dest = (char *)items;
+        char * const copy = (char *)mem_internal_allocate(n * item_size);
+
+        memcpy(copy, items, n * item_size);
+        for (i = 0; i < n; ++i)
+            SORT_COPY(item_size, dest + i * item_size, copy + indices[i] * item_size);
+
+        mem_internal_free(copy);
+        mem_internal_free(indices);
+    }
+
+    if (s.keys) {
+        mem_internal_free(s.keys);
+        Parrot_pmc_gc_unregister(interp, holder);
+    }
 }
 
-typedef INTVAL (*sort_func_t)(PARROT_INTERP, void *, void *);
+/*
+
+=item C<static size_t sort_item_size(INTVAL type)>
+
+Returns the size of a value of C<type>.
+
+=cut
+
+*/
+
+PARROT_CONST_FUNCTION
+PARROT_WARN_UNUSED_RESULT
+static size_t
+sort_item_size(INTVAL type)
+{
+    ASSERT_ARGS(sort_item_size)
+
+    switch (type) {
+      case enum_type_INTVAL:
+        return sizeof (INTVAL);
+      case enum_type_FLOATVAL:
+        return sizeof (FLOATVAL);
+      case enum_type_STRING:
+        return sizeof (STRING *);
+      default:
+        return sizeof (PMC *);
+    }
+}
 
 /*
 
-=item C<static INTVAL COMPARE(PARROT_INTERP, void *_a, void *_b, PMC *cmp, const
-char * cmp_signature)>
+=item C<static void sort_item(INTVAL type, const char *items, UINTVAL i,
+sort_value *v)>
 
-General PMC comparison function. Takes two PMCs. Returns 0 if they are equal,
-returns 1 if C<a> is bigger, and returns -1 if C<b> is bigger.
+Fetches the C<i>th value of C<type> from C<items>.
 
 =cut
 
 */
 
-/* TODO: Macroize COMPARE */
-/* This is an awfully expensive function to call, what with all the */
-/* comparisons that never change. We ought to precompute everything. */
-/* XXX We should be able to guarantee that *a and *b never change via const parameters. */
-static INTVAL
-COMPARE(PARROT_INTERP, ARGIN(void *_a), ARGIN(void *_b),
-        ARGIN(PMC *cmp),
-        ARGIN(const char * cmp_signature))
+static void
+sort_item(INTVAL type, ARGIN(const char *items), UINTVAL i, ARGOUT(sort_value *v))
+{
+    ASSERT_ARGS(sort_item)
+
+    switch (type) {
+      case enum_type_INTVAL:
+        v->i = ((const INTVAL *)items)[i];
+        break;
+      case enum_type_FLOATVAL:
+        v->n = ((const FLOATVAL *)items)[i];
+        break;
+      case enum_type_STRING:
+        v->s = ((STRING * const *)items)[i];
+        break;
+      default:
+        v->p = ((PMC * const *)items)[i];
+        break;
+    }
+}
+
+/*
+
+=item C<static void sort_sub_init(PARROT_INTERP, sort_sub *c, PMC *sub)>
+
+Prepares calling C<sub>, which may be null.
+
+=cut
+
+*/
+
+static void
+sort_sub_init(PARROT_INTERP, ARGOUT(sort_sub *c), ARGIN_NULLOK(PMC *sub))
+{
+    ASSERT_ARGS(sort_sub_init)
+
+    c->sub         = sub ? sub : PMCNULL;
+    c->call_object = PMCNULL;
+    c->reuse       = !PMC_IS_NULL(c->sub) && Parrot_pcc_frame_reusable(interp, c->sub);
+}
+
+/*
+
+=item C<static PMC * sort_call(PARROT_INTERP, sort_sub *c, INTVAL type, const
+sort_value *x, const sort_value *y)>
+
+Calls the Sub of C<c> with C<x>, and C<y> unless it is NULL, both of
+C<type>.  Returns the CallContext holding the results.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+static PMC *
+sort_call(PARROT_INTERP, ARGMOD(sort_sub *c), INTVAL type,
+        ARGIN(const sort_value *x), ARGIN_NULLOK(const sort_value *y))
 {
-    ASSERT_ARGS(COMPARE)
-    INTVAL result = 0;
-    if (PMC_IS_NULL(cmp))
-        return VTABLE_cmp(interp, (PMC *)_a, (PMC *)_b);
+    ASSERT_ARGS(sort_call)
+    PMC * const       ctx     = CURRENT_CONTEXT(interp);
+    PMC * const       old_sig = Parrot_pcc_get_signature(interp, ctx);
+    const sort_value *b       = y ? y : x;
+    PMC              *call_object;
+    PMC              *result;
+
+    /* a frame that let itself out is left alone, and a fresh one is used */
+    if (!PMC_IS_NULL(c->call_object)
+    &&  Parrot_pcc_frame_escaped(interp, c->call_object))
+        c->call_object = PMCNULL;
+
+    switch (type) {
+      case enum_type_INTVAL:
+        call_object = Parrot_pcc_build_call_from_c_args(interp, c->call_object,
+                y ? "II" : "I", x->i, b->i);
+        break;
+      case enum_type_FLOATVAL:
+        call_object = Parrot_pcc_build_call_from_c_args(interp, c->call_object,
+                y ? "NN" : "N", x->n, b->n);
+        break;
+      case enum_type_STRING:
+        call_object = Parrot_pcc_build_call_from_c_args(interp, c->call_object,
+                y ? "SS" : "S", x->s, b->s);
+        break;
+      default:
+        call_object = Parrot_pcc_build_call_from_c_args(interp, c->call_object,
+                y ? "PP" : "P", x->p, b->p);
+        break;
+    }
 
-    if (cmp->vtable->base_type == enum_class_NCI) {
-        const sort_func_t f = (sort_func_t)D2FPTR(PARROT_NCI(cmp)->func);
-        return f(interp, _a, _b);
+    if (c->reuse) {
+        Parrot_pcc_reinvoke_from_sig_object(interp, c->sub, call_object);
+        c->call_object = call_object;
     }
+    else
+        Parrot_pcc_invoke_from_sig_object(interp, c->sub, call_object);
 
-    Parrot_ext_call(interp, cmp, cmp_signature, _a, _b, &result);
+    result = Parrot_pcc_get_signature(interp, ctx);
+    Parrot_pcc_set_signature(interp, ctx, old_sig);
     return result;
 }
 
 /*
 
-=item C<void Parrot_util_quicksort(PARROT_INTERP, void **data, UINTVAL n, PMC
-*cmp, const char * cmp_signature)>
+=item C<static INTVAL sort_keys(PARROT_INTERP, PMC *key, INTVAL type, const char
+*items, UINTVAL n, PMC *holder, sort_value *keys)>
 
-Perform a quicksort on a PMC array.
+Calls C<key> on the C<n> C<items> of C<type>, keeping the results alive in
+C<holder>, and stores them in C<keys>.  Returns the type the keys are
+compared as.
 
-cmp_signature is PCC signature for C<cmp>. E.g. C<II->I> for FIA.
+=cut
+
+*/
+
+static INTVAL
+sort_keys(PARROT_INTERP, ARGIN(PMC *key), INTVAL type, ARGIN(const char *items),
+        UINTVAL n, ARGIN(PMC *holder), ARGOUT(sort_value *keys))
+{
+    ASSERT_ARGS(sort_keys)
+    sort_sub c;
+    INTVAL   key_type = enum_type_PMC;
+    UINTVAL  i;
+
+    sort_sub_init(interp, &c, key);
+
+    for (i = 0; i < n; ++i) {
+        sort_value  v;
+        PMC        *result, *k;
+        INTVAL      t;
+
+        sort_item(type, items, i, &v);
+        result = sort_call(interp, &c, type, &v, NULL);
+        k      = VTABLE_get_pmc_keyed_int(interp, result, 0);
+        VTABLE_set_pmc_keyed_int(interp, holder, (INTVAL)i, k);
+
+        switch (k->vtable->base_type) {
+          case enum_class_Integer:
+            t = enum_type_INTVAL;
+            break;
+          case enum_class_Float:
+            t = enum_type_FLOATVAL;
+            break;
+          case enum_class_String:
+            t = enum_type_STRING;
+            break;
+          default:
+            t = enum_type_PMC;
+            break;
+        }
+
+        /* Mixed integers and floats are compared as floats */
+        if (i == 0)
+            key_type = t;
+        else if (t != key_type)
+            key_type = (t == enum_type_INTVAL || t == enum_type_FLOATVAL)
+                    && (key_type == enum_type_INTVAL || key_type == enum_type_FLOATVAL)
+                     ? enum_type_FLOATVAL : enum_type_PMC;
+    }
+
+    for (i = 0; i < n; ++i) {
+        PMC * const k = VTABLE_get_pmc_keyed_int(interp, holder, (INTVAL)i);
+
+        switch (key_type) {
+          case enum_type_INTVAL:
+            keys[i].i = VTABLE_get_integer(interp, k);
+            break;
+          case enum_type_FLOATVAL:
+            keys[i].n = VTABLE_get_number(interp, k);
+            break;
+          case enum_type_STRING:
+            keys[i].s = VTABLE_get_string(interp, k);
+            break;
+          default:
+            keys[i].p = k;
+            break;
+        }
+    }
+
+    return key_type;
+}
+
+/*
+
+=item C<static INTVAL sort_compare(PARROT_INTERP, sort_state *s, const char *a,
+const char *b)>
+
+Compares the elements C<a> and C<b>.  Numbers sorted by value without a
+comparator are compared here, everything else by C<sort_compare_values>.
 
 =cut
 
 */
 
-void
-Parrot_util_quicksort(PARROT_INTERP, ARGMOD(void **data), UINTVAL n,
-        ARGIN(PMC *cmp),
-        ARGIN(const char * cmp_signature))
-{
-    ASSERT_ARGS(Parrot_util_quicksort)
-    while (n > 1) {
-        UINTVAL i, j, ln, rn;
-        void *temp;
-
-        /* Swap */
-        temp      = data[0];
-        data[0]   = data[n/2];
-        data[n/2] = temp;
-
-        for (i = 0, j = n; ;) {
-            do
-                --j;
-            while (j > 0 && COMPARE(interp, data[j], data[0], cmp, cmp_signature) > 0);
-
-            do
-                ++i;
-            while (i < j && COMPARE(interp, data[i], data[0], cmp, cmp_signature) < 0);
-
-            if (i >= j)
+PARROT_INLINE
+static INTVAL
+sort_compare(PARROT_INTERP, ARGMOD(sort_state *s), ARGIN(const char *a),
+        ARGIN(const char *b))
+{
+    ASSERT_ARGS(sort_compare)
+
+    if (s->by_value) {
+        if (s->type == enum_type_INTVAL) {
+            INTVAL x, y;
+            memcpy(&x, a, sizeof (INTVAL));
+            memcpy(&y, b, sizeof (INTVAL));
+            return x < y ? -1 : x > y;
+        }
+        else {
+            FLOATVAL x, y;
+            memcpy(&x, a, sizeof (FLOATVAL));
+            memcpy(&y, b, sizeof (FLOATVAL));
+            return x < y ? -1 : x > y;
+        }
+    }
+
+    return sort_compare_values(interp, s, a, b);
+}
+
+/*
+
+=item C<static INTVAL sort_compare_values(PARROT_INTERP, sort_state *s, const
+char *a, const char *b)>
+
+Compares the elements C<a> and C<b>, which are values or indices of values.
+
+=cut
+
+*/
+
+static INTVAL
+sort_compare_values(PARROT_INTERP, ARGMOD(sort_state *s), ARGIN(const char *a),
+        ARGIN(const char *b))
+{
+    ASSERT_ARGS(sort_compare_values)
+    sort_value  x, y;
+    PMC        *result;
+
+    if (s->keys) {
+        x = s->keys[*(const UINTVAL *)a];
+        y = s->keys[*(const UINTVAL *)b];
+    }
+    else if (s->items) {
+        sort_item(s->type, s->items, *(const UINTVAL *)a, &x);
+        sort_item(s->type, s->items, *(const UINTVAL *)b, &y);
+    }
+    else {
+        SORT_COPY(s->size, &x, a);
+        SORT_COPY(s->size, &y, b);
+    }
+
+    if (PMC_IS_NULL(s->cmp.sub)) {
+        switch (s->type) {
+          case enum_type_INTVAL:
+            return x.i < y.i ? -1 : x.i > y.i;
+          case enum_type_FLOATVAL:
+            return x.n < y.n ? -1 : x.n > y.n;
+          case enum_type_STRING:
+            return Parrot_str_compare(interp, x.s, y.s);
+          default:
+            return VTABLE_cmp(interp, x.p, y.p);
+        }
+    }
+
+    if (s->cmp.sub->vtable->base_type == enum_class_NCI) {
+        const sort_func_t f = (sort_func_t)D2FPTR(PARROT_NCI(s->cmp.sub)->func);
+
+        switch (s->type) {
+          case enum_type_INTVAL:
+            return f(interp, INTVAL2PTR(void *, x.i), INTVAL2PTR(void *, y.i));
+          case enum_type_FLOATVAL:
+            return f(interp, &x.n, &y.n);
+          case enum_type_STRING:
+            return f(interp, x.s, y.s);
+          default:
+            return f(interp, x.p, y.p);
+        }
+    }
+
+    result = sort_call(interp, &s->cmp, s->type, &x, &y);
+    return VTABLE_get_integer_keyed_int(interp, result, 0);
+}
+
+/*
+
+=item C<static void sort_runs(PARROT_INTERP, sort_state *s, char *base, UINTVAL
+n)>
+
+Sorts the C<n> elements at C<base>: finds the ascending or strictly
+descending runs, extends those shorter than a minimum run length of 32 to 64
+elements by binary insertion, and merges them, keeping the lengths of the
+pending runs growing at least like the Fibonacci numbers from the top of the
+stack down, so merges stay balanced.
+
+=cut
+
+*/
+
+static void
+sort_runs(PARROT_INTERP, ARGMOD(sort_state *s), ARGMOD(char *base), UINTVAL n)
+{
+    ASSERT_ARGS(sort_runs)
+    const size_t    size  = s->size;
+    UINTVAL * const start = (UINTVAL *)mem_internal_allocate(2 * SORT_MAX_RUNS * sizeof (UINTVAL));
+    UINTVAL * const len   = start + SORT_MAX_RUNS;
+    UINTVAL         min_run, lo = 0, remaining = n, r;
+    int             runs  = 0;
+
+    /* n scaled into [SORT_MIN_MERGE / 2, SORT_MIN_MERGE], rounded up, so
+     * n / min_run is a power of two or just below */
+    for (min_run = n, r = 0; min_run >= SORT_MIN_MERGE; min_run >>= 1)
+        r |= min_run & 1;
+    min_run += r;
+
+    while (remaining) {
+        UINTVAL run = sort_count_run(interp, s, base + lo * size, remaining);
+
+        if (run < min_run) {
+            const UINTVAL force = remaining < min_run ? remaining : min_run;
+            sort_insertion(interp, s, base + lo * size, force, run);
+            run = force;
+        }
+
+        start[runs] = lo;
+        len[runs]   = run;
+        ++runs;
+
+        while (runs > 1) {
+            int k = runs - 2;
+
+            if ((k > 0 && len[k - 1] <= len[k] + len[k + 1])
+            ||  (k > 1 && len[k - 2] <= len[k - 1] + len[k])) {
+                if (len[k - 1] < len[k + 1])
+                    --k;
+            }
+            else if (len[k] > len[k + 1])
                 break;
 
-            /* Swap */
-            temp    = data[i];
-            data[i] = data[j];
-            data[j] = temp;
+            sort_merge_at(interp, s, base, start, len, runs--, k);
         }
 
-        /* Swap */
-        temp    = data[j];
-        data[j] = data[0];
-        data[0] = temp;
+        lo        += run;
+        remaining -= run;
+    }
+
+    while (runs > 1) {
+        int k = runs - 2;
 
-        ln = j;
-        rn = n - ++j;
+        if (k > 0 && len[k - 1] < len[k + 1])
+            --k;
+
+        sort_merge_at(interp, s, base, start, len, runs--, k);
+    }
+
+    mem_internal_free(start);
+}
+
+/*
 
-        if (ln < rn) {
-            Parrot_util_quicksort(interp, data, ln, cmp, cmp_signature);
-            data += j;
-            n = rn;
+=item C<static void sort_merge_at(PARROT_INTERP, sort_state *s, char *base,
+UINTVAL *start, UINTVAL *len, int runs, int k)>
+
+Merges the pending runs C<k> and C<k + 1> of the C<runs> at C<start> with
+lengths C<len>.
+
+=cut
+
+*/
+
+static void
+sort_merge_at(PARROT_INTERP, ARGMOD(sort_state *s), ARGMOD(char *base),
+        ARGMOD(UINTVAL *start), ARGMOD(UINTVAL *len), int runs, int k)
+{
+    ASSERT_ARGS(sort_merge_at)
+
+    sort_merge(interp, s, base + start[k] * s->size, len[k], len[k + 1]);
+    len[k] += len[k + 1];
+
+    if (k == runs - 3) {
+        start[k + 1] = start[k + 2];
+        len[k + 1]   = len[k + 2];
+    }
+}
+
+/*
+
+=item C<static UINTVAL sort_count_run(PARROT_INTERP, sort_state *s, char *base,
+UINTVAL n)>
+
+Returns the length of the run at the start of the C<n> elements at C<base>,
+reversing it if it is strictly descending.
+
+=cut
+
+*/
+
+static UINTVAL
+sort_count_run(PARROT_INTERP, ARGMOD(sort_state *s), ARGMOD(char *base), UINTVAL n)
+{
+    ASSERT_ARGS(sort_count_run)
+    const size_t size = s->size;
+    UINTVAL      run  = 2;
+
+    if (n < 2)
+        return n;
+
+    if (sort_compare(interp, s, base + size, base) < 0) {
+        UINTVAL i, j;
+
+        while (run < n && sort_compare(interp, s, base + run * size, base + (run - 1) * size) < 0)
+            ++run;
+
+        for (i = 0, j = run - 1; i < j; ++i, --j) {
+            sort_value t;
+            SORT_COPY(size, &t, base + i * size);
+            SORT_COPY(size, base + i * size, base + j * size);
+            SORT_COPY(size, base + j * size, &t);
         }
-        else {
-            Parrot_util_quicksort(interp, data + j, rn, cmp, cmp_signature);
-            n = ln;
+    }
+    else {
+        while (run < n && sort_compare(interp, s, base + run * size, base + (run - 1) * size) >= 0)
+            ++run;
+    }
+
+    return run;
+}
+
+/*
+
+=item C<static void sort_insertion(PARROT_INTERP, sort_state *s, char *base,
+UINTVAL n, UINTVAL sorted)>
+
+Sorts the C<n> elements at C<base>, of which the first C<sorted> are in
+order, by binary insertion.  Equal elements keep their order.
+
+=cut
+
+*/
+
+static void
+sort_insertion(PARROT_INTERP, ARGMOD(sort_state *s), ARGMOD(char *base), UINTVAL n,
+        UINTVAL sorted)
+{
+    ASSERT_ARGS(sort_insertion)
+    const size_t size = s->size;
+    UINTVAL      i;
+
+    for (i = sorted; i < n; ++i) {
+        sort_value pivot;
+        UINTVAL    pos;
+
+        SORT_COPY(size, &pivot, base + i * size);
+        pos = sort_upper_bound(interp, s, base, i, (const char *)&pivot);
+        memmove(base + (pos + 1) * size, base + pos * size, (i - pos) * size);
+        SORT_COPY(size, base + pos * size, &pivot);
+    }
+}
+
+/*
+
+=item C<static UINTVAL sort_upper_bound(PARROT_INTERP, sort_state *s, const char
+*base, UINTVAL n, const char *elem)>
+
+Returns the number of the sorted C<n> elements at C<base> which are not
+greater than C<elem>.
+
+=cut
+
+*/
+
+static UINTVAL
+sort_upper_bound(PARROT_INTERP, ARGMOD(sort_state *s), ARGIN(const char *base),
+        UINTVAL n, ARGIN(const char *elem))
+{
+    ASSERT_ARGS(sort_upper_bound)
+    UINTVAL lo = 0, hi = n;
+
+    while (lo < hi) {
+        const UINTVAL mid = lo + (hi - lo) / 2;
+        if (sort_compare(interp, s, elem, base + mid * s->size) < 0)
+            hi = mid;
+        else
+            lo = mid + 1;
+    }
+
+    return lo;
+}
+
+/*
+
+=item C<static UINTVAL sort_lower_bound(PARROT_INTERP, sort_state *s, const char
+*base, UINTVAL n, const char *elem)>
+
+Returns the number of the sorted C<n> elements at C<base> which are less than
+C<elem>.
+
+=cut
+
+*/
+
+static UINTVAL
+sort_lower_bound(PARROT_INTERP, ARGMOD(sort_state *s), ARGIN(const char *base),
+        UINTVAL n, ARGIN(const char *elem))
+{
+    ASSERT_ARGS(sort_lower_bound)
+    UINTVAL lo = 0, hi = n;
+
+    while (lo < hi) {
+        const UINTVAL mid = lo + (hi - lo) / 2;
+        if (sort_compare(interp, s, base + mid * s->size, elem) < 0)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    return lo;
+}
+
+/*
+
+=item C<static void sort_merge(PARROT_INTERP, sort_state *s, char *base, UINTVAL
+na, UINTVAL nb)>
+
+Merges the adjacent sorted runs of C<na> and C<nb> elements at C<base>.
+Elements of the first run which are not greater than the start of the second
+and elements of the second which are not less than the end of the first are
+already in place; of the rest, the shorter run is moved to the scratch
+buffer and merged back.  On ties the first run goes first.
+
+=cut
+
+*/
+
+static void
+sort_merge(PARROT_INTERP, ARGMOD(sort_state *s), ARGMOD(char *base), UINTVAL na,
+        UINTVAL nb)
+{
+    ASSERT_ARGS(sort_merge)
+    const size_t size = s->size;
+    char * const tmp  = s->scratch;
+    char        *a    = base;
+    char * const b    = base + na * size;
+    UINTVAL      i, j, k;
+
+    k   = sort_upper_bound(interp, s, a, na, b);
+    a  += k * size;
+    na -= k;
+    if (na == 0)
+        return;
+
+    nb = sort_lower_bound(interp, s, b, nb, a + (na - 1) * size);
+    if (nb == 0)
+        return;
+
+    if (na <= nb) {
+        memcpy(tmp, a, na * size);
+        for (i = 0, j = 0, k = 0; i < na && j < nb; ++k) {
+            if (sort_compare(interp, s, b + j * size, tmp + i * size) < 0)
+                SORT_COPY(size, a + k * size, b + j++ * size);
+            else
+                SORT_COPY(size, a + k * size, tmp + i++ * size);
+        }
+        if (i < na)
+            memcpy(a + k * size, tmp + i * size, (na - i) * size);
+    }
+    else {
+        memcpy(tmp, b, nb * size);
+        for (i = na, j = nb, k = na + nb; i > 0 && j > 0;) {
+            --k;
+            if (sort_compare(interp, s, tmp + (j - 1) * size, a + (i - 1) * size) < 0)
+                SORT_COPY(size, a + k * size, a + --i * size);
+            else
+                SORT_COPY(size, a + k * size, tmp + --j * size);
         }
+        if (j > 0)
+            memcpy(a, tmp, j * size);
     }
 }
 
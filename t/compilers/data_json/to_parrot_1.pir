@@ -0,0 +1,11 @@
+
+.sub test :main
+    load_language 'data_json'
+    load_bytecode 'dumper.pbc'
+
+    .local pmc JSON, eval, result
+    JSON = compreg 'data_json'
+    eval = JSON.'compile'("\"\"")
+    result = eval()
+    _dumper(result, "JSON")
+.end
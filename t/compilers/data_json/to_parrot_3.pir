@@ -0,0 +1,10 @@
+
+.sub test :main
+    load_language 'data_json'
+
+    .local pmc JSON, eval, result
+
+    JSON = compreg 'data_json'
+    eval = JSON.'compile'("a")
+    result = eval()
+.end
@@ -0,0 +1,11 @@
+
+.sub test :main
+    load_language 'data_json'
+    load_bytecode 'dumper.pbc'
+
+    .local pmc JSON, eval, result
+    JSON = compreg 'data_json'
+    eval = JSON.'compile'("[[],[{},{}],{\"str\":true},{\"a\":\"1\",\"b\":{},\"c\":\"2\"},[true],false,{\"e\":[],\"d\":3}]")
+    result = eval()
+    _dumper(result, "JSON")
+.end
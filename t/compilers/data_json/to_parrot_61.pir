@@ -0,0 +1,11 @@
+
+.sub test :main
+    load_language 'data_json'
+    load_bytecode 'dumper.pbc'
+
+    .local pmc JSON, eval, result
+    JSON = compreg 'data_json'
+    eval = JSON.'compile'("[\"\\u0000\",\"\\u00e4\",\"\\u007f\",\"\\u0080\",\"\\u0100\",\"\\u203e\",\"Pl\\u00e4ne\"]")
+    result = eval()
+    _dumper(result, "JSON")
+.end
@@ -0,0 +1,22 @@
+# if the side-effect of set_label/continuation isn't
+# detected this program prints "Hi\nalligator\n"
+
+.sub main :main
+    $P0 = new 'String'
+    $P0 = "Hi\n"
+    $I0 = 2
+lab:
+    print $P0
+    dec $I0
+    unless $I0 goto ex
+    new $P1, 'Continuation'
+    set_label $P1, lab
+    $P2 = find_name "alligator"
+    set_args "0", $P1
+    invokecc $P2
+ex:
+.end
+.sub alligator
+    get_params "0", $P0
+    invokecc $P0
+.end
@@ -0,0 +1,23 @@
+.sub xyz :main
+    .local pmc args
+    args = new 'ResizablePMCArray'
+    push args, "abc"
+    push args, "def"
+    push args, "POPME"
+
+    $S0 = args[-1]
+    if $S0 != "POPME" goto start
+    # P0 used_once falsely deleted [GH #1036]
+    $P0 = pop args
+  start:
+    $I1 = elements args
+    $I0 = 0
+  loop:
+    if $I0 >= $I1 goto end
+    $S0 = args[$I0]
+    print $S0
+    print "\n"
+    inc $I0
+    goto loop
+  end:
+.end
@@ -0,0 +1,4 @@
+.sub main :main
+  $S32 = "ok\n"
+  print $S32
+.end
@@ -0,0 +1,5 @@
+.sub main :main
+  $N32 = 3.8
+  print $N32
+  print "\n"
+.end
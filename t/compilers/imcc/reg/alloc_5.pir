@@ -0,0 +1,5 @@
+.sub main :main
+  $I32 = 123
+  print $I32
+  print "\n"
+.end
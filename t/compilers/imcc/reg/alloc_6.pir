@@ -0,0 +1,5 @@
+.sub main :main
+  $P32 = new 'String'
+  $P32 = "ok\n"
+  print $P32
+.end
@@ -0,0 +1,140 @@
+.sub _main :main
+    .local pmc a0
+	a0 = new 'Integer'
+    .local pmc a1
+	a1 = new 'Integer'
+    .local pmc a2
+	a2 = new 'Integer'
+    .local pmc a3
+	a3 = new 'Integer'
+    .local pmc a4
+	a4 = new 'Integer'
+    .local pmc a5
+	a5 = new 'Integer'
+    .local pmc a6
+	a6 = new 'Integer'
+    .local pmc a7
+	a7 = new 'Integer'
+    .local pmc a8
+	a8 = new 'Integer'
+    .local pmc a9
+	a9 = new 'Integer'
+    .local pmc a10
+	a10 = new 'Integer'
+    .local pmc a11
+	a11 = new 'Integer'
+    .local pmc a12
+	a12 = new 'Integer'
+    .local pmc a13
+	a13 = new 'Integer'
+    .local pmc a14
+	a14 = new 'Integer'
+    .local pmc a15
+	a15 = new 'Integer'
+    .local pmc a16
+	a16 = new 'Integer'
+    .local pmc a17
+	a17 = new 'Integer'
+    a0 = 0
+    a1 = 1
+    a2 = 2
+    a3 = 3
+    a4 = 4
+    a5 = 5
+    a6 = 6
+    a7 = 7
+    a8 = 8
+    a9 = 9
+    a10 = 10
+    a11 = 11
+    a12 = 12
+    a13 = 13
+    a14 = 14
+    a15 = 15
+    a16 = 16
+    a17 = 17
+    _sub(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17)
+    set $I0, a9
+ne $I0, 9, fail
+    set $I0, a10
+ne $I0, 10, fail
+    set $I0, a11
+ne $I0, 11, fail
+    set $I0, a12
+ne $I0, 12, fail
+    set $I0, a13
+ne $I0, 13, fail
+    set $I0, a14
+ne $I0, 14, fail
+    set $I0, a15
+ne $I0, 15, fail
+    set $I0, a16
+ne $I0, 16, fail
+    set $I0, a17
+ne $I0, 17, fail
+    end
+fail:
+    print "failed\n"
+    end
+.end
+.sub _sub
+    .param pmc a0
+    .param pmc a1
+    .param pmc a2
+    .param pmc a3
+    .param pmc a4
+    .param pmc a5
+    .param pmc a6
+    .param pmc a7
+    .param pmc a8
+    .param pmc a9
+    .param pmc a10
+    .param pmc a11
+    .param pmc a12
+    .param pmc a13
+    .param pmc a14
+    .param pmc a15
+    .param pmc a16
+    .param pmc a17
+    set $I0, a0
+ne $I0, 0, fail
+    set $I0, a1
+ne $I0, 1, fail
+    set $I0, a2
+ne $I0, 2, fail
+    set $I0, a3
+ne $I0, 3, fail
+    set $I0, a4
+ne $I0, 4, fail
+    set $I0, a5
+ne $I0, 5, fail
+    set $I0, a6
+ne $I0, 6, fail
+    set $I0, a7
+ne $I0, 7, fail
+    set $I0, a8
+ne $I0, 8, fail
+    set $I0, a9
+ne $I0, 9, fail
+    set $I0, a10
+ne $I0, 10, fail
+    set $I0, a11
+ne $I0, 11, fail
+    set $I0, a12
+ne $I0, 12, fail
+    set $I0, a13
+ne $I0, 13, fail
+    set $I0, a14
+ne $I0, 14, fail
+    set $I0, a15
+ne $I0, 15, fail
+    set $I0, a16
+ne $I0, 16, fail
+    set $I0, a17
+ne $I0, 17, fail
+    print "all params ok\n"
+    .return()
+fail:
+    print "failed\n"
+    end
+.end
@@ -0,0 +1,294 @@
+.sub _main :main
+    .local pmc a0
+	a0 = new 'Integer'
+    .local pmc a1
+	a1 = new 'Integer'
+    .local pmc a2
+	a2 = new 'Integer'
+    .local pmc a3
+	a3 = new 'Integer'
+    .local pmc a4
+	a4 = new 'Integer'
+    .local pmc a5
+	a5 = new 'Integer'
+    .local pmc a6
+	a6 = new 'Integer'
+    .local pmc a7
+	a7 = new 'Integer'
+    .local pmc a8
+	a8 = new 'Integer'
+    .local pmc a9
+	a9 = new 'Integer'
+    .local pmc a10
+	a10 = new 'Integer'
+    .local pmc a11
+	a11 = new 'Integer'
+    .local pmc a12
+	a12 = new 'Integer'
+    .local pmc a13
+	a13 = new 'Integer'
+    .local pmc a14
+	a14 = new 'Integer'
+    .local pmc a15
+	a15 = new 'Integer'
+    .local pmc a16
+	a16 = new 'Integer'
+    .local pmc a17
+	a17 = new 'Integer'
+    .local pmc a18
+	a18 = new 'Integer'
+    .local pmc a19
+	a19 = new 'Integer'
+    .local pmc a20
+	a20 = new 'Integer'
+    .local pmc a21
+	a21 = new 'Integer'
+    .local pmc a22
+	a22 = new 'Integer'
+    .local pmc a23
+	a23 = new 'Integer'
+    .local pmc a24
+	a24 = new 'Integer'
+    .local pmc a25
+	a25 = new 'Integer'
+    .local pmc a26
+	a26 = new 'Integer'
+    .local pmc a27
+	a27 = new 'Integer'
+    .local pmc a28
+	a28 = new 'Integer'
+    .local pmc a29
+	a29 = new 'Integer'
+    .local pmc a30
+	a30 = new 'Integer'
+    .local pmc a31
+	a31 = new 'Integer'
+    .local pmc a32
+	a32 = new 'Integer'
+    .local pmc a33
+	a33 = new 'Integer'
+    .local pmc a34
+	a34 = new 'Integer'
+    .local pmc a35
+	a35 = new 'Integer'
+    .local pmc a36
+	a36 = new 'Integer'
+    .local pmc a37
+	a37 = new 'Integer'
+    .local pmc a38
+	a38 = new 'Integer'
+    .local pmc a39
+	a39 = new 'Integer'
+    a0 = 0
+    a1 = 1
+    a2 = 2
+    a3 = 3
+    a4 = 4
+    a5 = 5
+    a6 = 6
+    a7 = 7
+    a8 = 8
+    a9 = 9
+    a10 = 10
+    a11 = 11
+    a12 = 12
+    a13 = 13
+    a14 = 14
+    a15 = 15
+    a16 = 16
+    a17 = 17
+    a18 = 18
+    a19 = 19
+    a20 = 20
+    a21 = 21
+    a22 = 22
+    a23 = 23
+    a24 = 24
+    a25 = 25
+    a26 = 26
+    a27 = 27
+    a28 = 28
+    a29 = 29
+    a30 = 30
+    a31 = 31
+    a32 = 32
+    a33 = 33
+    a34 = 34
+    a35 = 35
+    a36 = 36
+    a37 = 37
+    a38 = 38
+    a39 = 39
+    _sub(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,a17,a18,a19,a20,a21,a22,a23,a24,a25,a26,a27,a28,a29,a30,a31,a32,a33,a34,a35,a36,a37,a38,a39)
+    set $I0, a20
+ne $I0, 20, fail
+    set $I0, a21
+ne $I0, 21, fail
+    set $I0, a22
+ne $I0, 22, fail
+    set $I0, a23
+ne $I0, 23, fail
+    set $I0, a24
+ne $I0, 24, fail
+    set $I0, a25
+ne $I0, 25, fail
+    set $I0, a26
+ne $I0, 26, fail
+    set $I0, a27
+ne $I0, 27, fail
+    set $I0, a28
+ne $I0, 28, fail
+    set $I0, a29
+ne $I0, 29, fail
+    set $I0, a30
+ne $I0, 30, fail
+    set $I0, a31
+ne $I0, 31, fail
+    set $I0, a32
+ne $I0, 32, fail
+    set $I0, a33
+ne $I0, 33, fail
+    set $I0, a34
+ne $I0, 34, fail
+    set $I0, a35
+ne $I0, 35, fail
+    set $I0, a36
+ne $I0, 36, fail
+    set $I0, a37
+ne $I0, 37, fail
+    set $I0, a38
+ne $I0, 38, fail
+    set $I0, a39
+ne $I0, 39, fail
+    end
+fail:
+    print "failed\n"
+    end
+.end
+.sub _sub
+    .param pmc a0
+    .param pmc a1
+    .param pmc a2
+    .param pmc a3
+    .param pmc a4
+    .param pmc a5
+    .param pmc a6
+    .param pmc a7
+    .param pmc a8
+    .param pmc a9
+    .param pmc a10
+    .param pmc a11
+    .param pmc a12
+    .param pmc a13
+    .param pmc a14
+    .param pmc a15
+    .param pmc a16
+    .param pmc a17
+    .param pmc a18
+    .param pmc a19
+    .param pmc a20
+    .param pmc a21
+    .param pmc a22
+    .param pmc a23
+    .param pmc a24
+    .param pmc a25
+    .param pmc a26
+    .param pmc a27
+    .param pmc a28
+    .param pmc a29
+    .param pmc a30
+    .param pmc a31
+    .param pmc a32
+    .param pmc a33
+    .param pmc a34
+    .param pmc a35
+    .param pmc a36
+    .param pmc a37
+    .param pmc a38
+    .param pmc a39
+    set $I0, a0
+ne $I0, 0, fail
+    set $I0, a1
+ne $I0, 1, fail
+    set $I0, a2
+ne $I0, 2, fail
+    set $I0, a3
+ne $I0, 3, fail
+    set $I0, a4
+ne $I0, 4, fail
+    set $I0, a5
+ne $I0, 5, fail
+    set $I0, a6
+ne $I0, 6, fail
+    set $I0, a7
+ne $I0, 7, fail
+    set $I0, a8
+ne $I0, 8, fail
+    set $I0, a9
+ne $I0, 9, fail
+    set $I0, a10
+ne $I0, 10, fail
+    set $I0, a11
+ne $I0, 11, fail
+    set $I0, a12
+ne $I0, 12, fail
+    set $I0, a13
+ne $I0, 13, fail
+    set $I0, a14
+ne $I0, 14, fail
+    set $I0, a15
+ne $I0, 15, fail
+    set $I0, a16
+ne $I0, 16, fail
+    set $I0, a17
+ne $I0, 17, fail
+    set $I0, a18
+ne $I0, 18, fail
+    set $I0, a19
+ne $I0, 19, fail
+    set $I0, a20
+ne $I0, 20, fail
+    set $I0, a21
+ne $I0, 21, fail
+    set $I0, a22
+ne $I0, 22, fail
+    set $I0, a23
+ne $I0, 23, fail
+    set $I0, a24
+ne $I0, 24, fail
+    set $I0, a25
+ne $I0, 25, fail
+    set $I0, a26
+ne $I0, 26, fail
+    set $I0, a27
+ne $I0, 27, fail
+    set $I0, a28
+ne $I0, 28, fail
+    set $I0, a29
+ne $I0, 29, fail
+    set $I0, a30
+ne $I0, 30, fail
+    set $I0, a31
+ne $I0, 31, fail
+    set $I0, a32
+ne $I0, 32, fail
+    set $I0, a33
+ne $I0, 33, fail
+    set $I0, a34
+ne $I0, 34, fail
+    set $I0, a35
+ne $I0, 35, fail
+    set $I0, a36
+ne $I0, 36, fail
+    set $I0, a37
+ne $I0, 37, fail
+    set $I0, a38
+ne $I0, 38, fail
+    set $I0, a39
+ne $I0, 39, fail
+    print "all params ok\n"
+    .return()
+fail:
+    print "failed\n"
+    end
+.end
@@ -0,0 +1,17 @@
+.sub test :main
+    $I0 = 0
+    if $I0 goto nok1
+    print "ok 1\n"
+nok1:
+    unless $I0 goto ok1
+    print "nok 1\n"
+ok1:
+    null $I0
+    if $I0, nok2
+    print "ok 2\n"
+nok2:
+    unless $I0 goto ok2
+    print "nok 2\n"
+ok2:
+    end
+.end
@@ -0,0 +1,3 @@
+.sub test :main
+    print no_such
+.end
@@ -0,0 +1,6 @@
+.sub test :main
+    branch no_such
+    end
+no_such:
+    print "ok\n"
+.end
@@ -0,0 +1,19 @@
+.sub 'main' :main
+    .lex 'foo', $P0
+    $P1 = box 'ok 1'
+    store_lex 'foo', $P1
+
+    $P2 = find_lex 'foo'
+    say $P2
+
+    .lex 'bar', $P3
+    $P4 = box 'ok 2'
+    store_lex 'bar', $P4
+
+    $P5 = find_lex 'bar'
+    say $P5
+
+    .lex 'foo', $P6
+    $P7 = box 'ok 3'
+    store_lex 'foo', $P7
+.end
@@ -0,0 +1,13 @@
+.sub 'main' :main
+    .lex 'bar\o', $P0        # ok, parsed as "bar\\o"
+    $P1 = box 'ok 1'
+    store_lex 'bar\o', $P1   # ok, parsed as "bar\\o"
+    $P2 = find_lex 'bar\o'
+    say $P2
+
+    .lex "foo\\o", $P3       # wrong, parsed as 'foo\\o'
+    $P1 = box 'ok 2'
+    store_lex "foo\\o", $P1  # Error: Lexical 'foo\o' not found
+    $P2 = find_lex "foo\\o"
+    say $P2
+.end
@@ -0,0 +1,7 @@
+.sub 'main' :main
+    .lex "foo\o", $P4        # ok, parsed as "foo\o" (set_lexical)
+    $P1 = box 'ok 3'
+    store_lex "foo\o", $P1   # old imcc compressed that to "fooo", now error
+    $P2 = find_lex "foo\o"   # ditto
+    say $P2
+.end
@@ -0,0 +1,13 @@
+.sub 'main' :main
+    $S0 = 'bar\o'
+    $P1 = box 'ok 1'
+    set_global $S0, $P1
+    $P2 = get_global 'bar\o'
+    say $P2
+
+    $S1 = "foo\\o"
+    $P1 = box 'ok 2'
+    set_global "foo\\o", $P1   # ok, parsed as 'foo\o'
+    $P2 = get_global "foo\\o"
+    say $P2
+.end
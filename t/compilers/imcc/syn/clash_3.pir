@@ -0,0 +1,9 @@
+.sub test :main
+    $P1 = new 'String'
+    $P1 = "ok 1\n"
+    new $P2, 'String'
+    set $P2, "ok 2\n"
+    print $P1
+    print $P2
+    end
+.end
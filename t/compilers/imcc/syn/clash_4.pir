@@ -0,0 +1,11 @@
+.sub test :main
+    $P1 = new 'String'
+    $P1 = "ok 1\n"
+    $P0 = clone $P1
+    new $P1, 'String'
+    set $P1, "ok 2\n"
+    clone $P2, $P1
+    print $P0
+    print $P2
+    end
+.end
@@ -0,0 +1,11 @@
+.sub test :main
+    $P1 = new 'Hash'
+    $I0 = defined $P1
+    new $P1, 'Hash'
+    defined $I0, $P1
+    print $I0
+    print "\n"
+    print $I0
+    print "\n"
+    end
+.end
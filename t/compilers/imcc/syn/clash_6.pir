@@ -0,0 +1,16 @@
+.sub test :main
+    $P1 = new 'Hash'
+    $P1["a"] = "ok 1\n"
+    $I0 = defined $P1["a"]
+    new $P1, 'Hash'
+    set $P1["a"], "ok 2\n"
+    defined $I0, $P1["a"]
+    defined $I1, $P1["b"]
+    print $I0
+    print "\n"
+    print $I0
+    print "\n"
+    print $I1
+    print "\n"
+    end
+.end
@@ -0,0 +1,10 @@
+.sub test :main
+    .local int set
+    set = 5
+    print set
+    print "\n"
+    inc set
+    print set
+    print "\n"
+    end
+.end
@@ -0,0 +1,16 @@
+.sub test :main
+    null $I0
+    goto set
+set:
+    if $I0, err
+    if $I0 goto err
+    inc $I0
+    unless $I0, err
+    unless $I0 goto err
+    print "ok\n"
+    end
+err:
+    print "nok\n"
+    end
+.end
+
@@ -0,0 +1,5 @@
+.sub test :main
+    $P1 = new INTVAL
+    print "never\n"
+    end
+.end
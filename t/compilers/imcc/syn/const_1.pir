@@ -0,0 +1,14 @@
+
+.sub 'main' :main
+    .globalconst int N = 5
+    _main()
+.end
+
+.sub '_sub1'
+    print N
+    print "\n"
+.end
+
+.sub '_main'
+    _sub1()
+.end
@@ -0,0 +1,9 @@
+.sub 'main' :main
+    $S0 = <<"quotage"
+I want an elephant
+Oh, I want an elephat!
+Oh, woo, elephants, yeah :-O
+quotage
+
+    print $S0
+.end
@@ -0,0 +1,11 @@
+.sub 'main' :main
+    $S0 = ""
+    $I0 = 0
+LOOP:
+    $S0 = concat $S0, <<"end"
+ending
+end
+    inc $I0
+    if $I0 < 5 goto LOOP
+    print $S0
+.end
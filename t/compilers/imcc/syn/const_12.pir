@@ -0,0 +1,17 @@
+.sub 'main' :main
+    $S0 = <<"AnY_w0Rd_ch4rS"
+so much depends
+upon
+
+a red wheel
+barrow
+
+glazed with rain
+water
+
+beside the white
+chickens
+AnY_w0Rd_ch4rS
+
+    print $S0
+.end
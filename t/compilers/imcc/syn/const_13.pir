@@ -0,0 +1,9 @@
+.sub 'main' :main
+    $S0 = <<'Jabberwocky'
+`Twas brillig, and the slithy toves
+  Did gyre and gimble in the wabe;
+All mimsy were the borogoves,
+  And the mome raths outgrabe.
+Jabberwocky
+    print $S0
+.end
@@ -0,0 +1,6 @@
+.sub 'main' :main
+    $S0 = <<'SQ'
+abc\tdef
+SQ
+    print $S0
+.end
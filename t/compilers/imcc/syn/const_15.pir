@@ -0,0 +1,9 @@
+.sub 'main' :main
+    $S0 = <<Jabberwocky
+"Beware the Jabberwock, my son!
+  The jaws that bite, the claws that catch!
+Beware the Jubjub bird, and shun
+  The frumious Bandersnatch!"
+Jabberwocky
+    print $S0
+.end
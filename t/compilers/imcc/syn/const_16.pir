@@ -0,0 +1,10 @@
+.sub 'main' :main
+    $S0 .= <<Jabberwocky
+He took his vorpal sword in hand:
+  Long time the manxome foe he sought --
+So rested he by the Tumtum tree,
+  And stood awhile in thought.
+Jabberwocky
+
+    print $S0
+.end
@@ -0,0 +1,9 @@
+.sub 'main' :main
+    $S0 = <<
+And, as in uffish thought he stood,
+  The Jabberwock, with eyes of flame,
+Came whiffling through the tulgey wood,
+  And burbled as it came!
+
+    print $S0
+.end
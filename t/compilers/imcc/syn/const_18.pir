@@ -0,0 +1,10 @@
+.sub 'main' :main
+    $S0 = << "terminator with spaces"
+One, two! One, two! And through and through
+  The vorpal blade went snicker-snack!
+He left it dead, and with its head
+  He went galumphing back.
+terminator with spaces
+
+    print $S0
+.end
@@ -0,0 +1,10 @@
+.sub 'main' :main
+    $S0 = <<"#non$word-chars."
+'And, has thou slain the Jabberwock?
+  Come to my arms, my beamish boy!
+O frabjous day! Callooh! Callay!'
+  He chortled in his joy.
+#non$word-chars.
+
+    print $S0
+.end
@@ -0,0 +1,15 @@
+.sub 'test' :main
+    .globalconst int N = 5
+    _main()
+.end
+
+.sub '_sub1'
+    .local int x
+    x = 10 + N
+    print x
+    print "\n"
+.end
+
+.sub '_main'
+     _sub1()
+.end
@@ -0,0 +1,9 @@
+.sub 'main' :main
+    $S0 = <<"\0\1\2\3"
+`Twas brillig, and the slithy toves
+  Did gyre and gimble in the wabe;
+All mimsy were the borogoves,
+  And the mome raths outgrabe.
+\0\1\2\3
+    print $S0
+.end
@@ -0,0 +1,18 @@
+.sub 'main' :main
+    $S1 = 'e_e_cummings'
+    $S0 = <<$S1
+l(a
+
+le
+af
+
+fa
+ll
+s)
+
+one
+l
+iness
+e_e_cummings
+    print $S0
+.end
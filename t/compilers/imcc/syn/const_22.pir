@@ -0,0 +1,9 @@
+.sub 'main' :main
+    $S0 = 'parrot'
+    print <<"*<:-O"
+Happy Birthday to you,
+Happy Birthday to you.
+Happy Birthday dear $S0,
+Happy Birthday to you!
+*<:-O
+.end
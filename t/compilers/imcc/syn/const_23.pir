@@ -0,0 +1,7 @@
+.sub 'main' :main
+    $S0 = 'parrot'
+    print <<"END_HERE"
+
+The line above is empty.
+END_HERE
+.end
@@ -0,0 +1,12 @@
+.sub main :main
+    .local string s
+    .local pmc nil
+    bounds 1   # force line nums
+    s = <<"EOT"
+line 1
+line 2
+line 3
+line 4
+EOT
+    print nil  # force err
+.end
@@ -0,0 +1,7 @@
+.sub main :main
+  $S0 = <<"HEREDOC"
+print "hello"
+HEREDOC
+  print $S0
+  end
+.end
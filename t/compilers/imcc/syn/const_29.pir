@@ -0,0 +1,5 @@
+.sub main :main
+    print <<"QUOTES"
+\"anything\"
+QUOTES
+.end
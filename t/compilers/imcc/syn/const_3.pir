@@ -0,0 +1,15 @@
+
+.sub 'call_sub1'
+    'sub1'()
+.end
+
+.sub 'test' :main
+    .globalconst int N = 5
+    'call_sub1'()
+.end
+
+.sub 'sub1'
+    print N
+    print "\n"
+.end
+
@@ -0,0 +1,15 @@
+.sub test :main
+	.local string test
+
+	test = <<"TEST"
+{ \{ \\{
+w \a \\w
+" \" \\"
+{ \{ \\{
+w \a \\w
+" \" \\"
+{ \{ \\{
+w \a \\w
+TEST
+	print test
+.end
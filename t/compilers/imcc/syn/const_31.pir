@@ -0,0 +1,17 @@
+.sub main :main
+    .local string code
+    code = ''
+    emit(code, <<"HERE", 10)
+line 1
+line %d
+line 2
+HERE
+.end
+.sub emit
+    .param string code
+    .param string more
+    .param pmc args  :slurpy
+    $S0 = sprintf more, args
+    code .= $S0
+    print code
+.end
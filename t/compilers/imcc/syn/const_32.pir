@@ -0,0 +1,15 @@
+.sub main :main
+    cat(<<"H1", <<"H2")
+line 1
+line 2
+H1
+line 3
+line 4
+H2
+.end
+.sub cat
+    .param string p1
+    .param string p2
+    p1 .= p2
+    print p1
+.end
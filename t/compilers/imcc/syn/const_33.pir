@@ -0,0 +1,8 @@
+.sub main :main
+    .const int I = 5
+    .local num f
+    f = 2.0
+    f *= I
+    print f
+    print "\n"
+.end
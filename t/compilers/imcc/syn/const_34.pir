@@ -0,0 +1,12 @@
+.const int c = 12
+.sub test :main
+    .local num a
+    a = 96
+    # Uncomment this line, and the c symbol is 'forgotten'
+    a += c
+    print a
+    print "\n"
+    print c
+    print "\n"
+    end
+.end
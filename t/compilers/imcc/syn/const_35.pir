@@ -0,0 +1,6 @@
+.sub 'bus_error'
+    .local string hello
+    hello = "'Allo, 'allo, 'allo."
+    .const string hello = "Hello, Polly."
+    say hello
+.end
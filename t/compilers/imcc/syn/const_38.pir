@@ -0,0 +1,3 @@
+.sub 'invalid'
+   .const 'FixedIntegerArray' $P0 = '(1d)'
+.end
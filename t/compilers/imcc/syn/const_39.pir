@@ -0,0 +1,13 @@
+.sub 'main' :main
+   .const 'FixedIntegerArray' $P0 = ' (0, 1,0b10 , 010, 0x10 ) '
+   $I0 = $P0[0]
+   say $I0
+   $I0 = $P0[1]
+   say $I0
+   $I0 = $P0[2]
+   say $I0
+   $I0 = $P0[3]
+   say $I0
+   $I0 = $P0[4]
+   say $I0
+.end
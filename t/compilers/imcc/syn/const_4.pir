@@ -0,0 +1,24 @@
+.sub 'main' :main
+   .local pmc ar
+   .local pmc ha
+   .local string key1
+   .const string key2 = "key2"
+   .local int idx1
+   .const int idx2 = 2
+   ar = new 'ResizablePMCArray'
+   ar = 3
+   ha = new 'Hash'
+   key1 = "key1"
+   idx1 = 1
+   ha[key1] = idx1
+   ha[key2] = idx2
+   $I0 = ha[key1]
+   $I1 = ha[key2]
+   ar[idx1] = $I0
+   ar[idx2] = $I1
+   $I2 = ar[idx1]
+   $I3 = ar[idx2]
+   print $I2
+   print $I3
+   print "\n"
+.end
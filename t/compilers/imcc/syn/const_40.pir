@@ -0,0 +1,4 @@
+.sub main
+  .const pmc a = "b"
+  .return(a)
+.end
@@ -0,0 +1,4 @@
+.sub baz :immediate :anon
+  .const "Sub" foo = "foo"
+  $P1 = foo."new"()
+.end
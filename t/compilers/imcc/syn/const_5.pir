@@ -0,0 +1,7 @@
+.sub 'main' :main
+   $S0 = "\""
+   print $S0
+   print "\\"
+   $S0 = "\"\\\"\n"
+   print $S0
+.end
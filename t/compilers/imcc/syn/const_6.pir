@@ -0,0 +1,9 @@
+.sub 'main' :main
+    .const 'Sub' $P0 = "foo"
+    print "ok 1\n"
+    $P0()
+    print "ok 3\n"
+.end
+.sub foo
+    print "ok 2\n"
+.end
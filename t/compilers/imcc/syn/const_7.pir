@@ -0,0 +1,9 @@
+.sub 'main' :main
+    .const 'Sub' func = "foo"
+    print "ok 1\n"
+    func()
+    print "ok 3\n"
+.end
+.sub foo
+    print "ok 2\n"
+.end
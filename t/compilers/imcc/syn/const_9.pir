@@ -0,0 +1,10 @@
+.sub 'main' :main
+    .const int i = 2.0
+    print i
+    print "\n"
+    .const num n = 2
+    print n
+    print "\nok\n"
+    .const string s = ascii:"ok 2\n"
+    print s
+.end
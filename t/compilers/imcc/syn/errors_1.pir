@@ -0,0 +1,3 @@
+.sub 'test' :main
+    branch $P0
+.end
@@ -0,0 +1,11 @@
+.sub foo :main
+        $I1 = 2
+        print "foo\n"
+        $I0 +=
+        $I2 = $I0 + $I1
+        $I3 = $1
+        $I1 = 5
+        $I2 = 6
+        print $I2
+        print "\n"
+.end
@@ -0,0 +1,152 @@
+.sub foo :main
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+	$I1 = 2
+	print "foo\n"
+	$I2 = $I0 + $I1 + $I2
+.end
@@ -0,0 +1,6 @@
+.sub main :main
+  .local Array my_string
+  my_string = new String
+  my_string = 'hello'
+  say my_string
+.end
@@ -0,0 +1,4 @@
+.sub main :main
+  .local pmc p
+  .local string p
+.end
@@ -0,0 +1,4 @@
+.loadlib 'nosuch'
+.sub main :main
+    say "WTF"
+.end
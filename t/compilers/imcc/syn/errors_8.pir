@@ -0,0 +1,43 @@
+.sub main :main
+    push_eh _handler
+    'foo'()
+    say "not caught"
+    .return()
+  _handler:
+    .get_results($P0)
+    say "caught in main"
+    pop_eh
+    rethrow $P0
+.end
+
+.sub 'foo'
+    push_eh _handler
+    'bar'()
+    say "not caught"
+    .return()
+  _handler:
+    .get_results($P0)
+    say "caught in foo"
+    pop_eh
+    rethrow $P0
+.end
+
+.sub 'bar'
+    push_eh _handler
+    'baz'()
+    say "not caught"
+    .return()
+  _handler:
+    .get_results($P0)
+    say "caught in bar"
+    pop_eh
+    rethrow $P0
+.end
+
+.sub 'baz'
+    $P1 = new ['Exception']
+    $P1["message"] = "This is an exception"
+    throw $P1
+    say "not caught"
+    .return()
+.end
@@ -12,7 +12,7 @@ use Test::More;
 
 use Parrot::Test::Util 'create_tempfile';
 use Parrot::Config;
-use Parrot::Test tests => 14;
+use Parrot::Test tests => 17;
 
 =head1 NAME
 
@@ -491,6 +491,155 @@ without_slash() called!
 OUT
 }
 unlink(@temp_files);
+
+SKIP:
+{
+    my @dirs = map { File::Spec->catdir( File::Spec->tmpdir(), "imcc_lib_cache_$$\_$_" ) } 1, 2;
+    my @probes;
+
+    for my $i ( 0, 1 ) {
+        mkdir $dirs[$i] or skip( "Cannot create temporary directory $dirs[$i]", 1 );
+        push @probes, File::Spec->catfile( $dirs[$i], 'lib_cache_probe.pasm' );
+
+        open( my $out_fh, '>', $probes[-1] )
+            or skip( "Cannot write temporary file to $probes[-1]", 1 );
+        print {$out_fh} "  .macro_const PROBE @{[ $i + 1 ]}\n";
+    }
+
+    pir_output_is( <<"CODE", <<'OUT', '.include follows search path changes and removed files' );
+  .include 'iglobals.pasm'
+  .include 'libpaths.pasm'
+
+  .sub main :main
+      .local pmc interp, include_paths, os
+      getinterp interp
+      \$P0 = interp[.IGLOBALS_LIB_PATHS]
+      include_paths = \$P0[.PARROT_LIB_PATH_INCLUDE]
+
+      unshift include_paths, '$dirs[0]'
+      probe()
+      probe()
+
+      unshift include_paths, '$dirs[1]'
+      probe()
+
+      os = new ['OS']
+      os.'rm'('$probes[1]')
+      probe()
+  .end
+
+  .sub probe
+      .local pmc pir
+      pir = compreg 'PIR'
+      pir(<<'PIR')
+  .include 'lib_cache_probe.pasm'
+  .sub probed
+      say .PROBE
+  .end
+PIR
+      \$P0 = get_global 'probed'
+      \$P0()
+  .end
+CODE
+1
+1
+2
+1
+OUT
+
+    unlink @probes;
+    rmdir $_ for @dirs;
+}
+
+SKIP:
+{
+    my @dirs = map { File::Spec->catdir( File::Spec->tmpdir(), "imcc_lib_rank_$$\_$_" ) } 1, 2;
+    my @probes = map { File::Spec->catfile( $_, 'lib_cache_probe.pasm' ) } @dirs;
+
+    for my $i ( 0, 1 ) {
+        mkdir $dirs[$i] or skip( "Cannot create temporary directory $dirs[$i]", 2 );
+    }
+
+    open( my $out_fh, '>', $probes[1] )
+        or skip( "Cannot write temporary file to $probes[1]", 2 );
+    print {$out_fh} "  .macro_const PROBE 2\n";
+    close $out_fh;
+
+    # age the directories so the first lookup is cached
+    my $past = time - 60;
+    utime $past, $past, @dirs;
+
+    pir_output_is( <<"CODE", <<'OUT', '.include finds a better candidate created later' );
+  .include 'iglobals.pasm'
+  .include 'libpaths.pasm'
+
+  .sub main :main
+      .local pmc interp, include_paths, fh
+      getinterp interp
+      \$P0 = interp[.IGLOBALS_LIB_PATHS]
+      include_paths = \$P0[.PARROT_LIB_PATH_INCLUDE]
+
+      unshift include_paths, '$dirs[1]/'
+      unshift include_paths, '$dirs[0]/'
+      probe()
+      probe()
+
+      fh = new ['FileHandle']
+      fh.'open'('$probes[0]', 'w')
+      fh.'print'("  .macro_const PROBE 1\\n")
+      fh.'close'()
+      probe()
+  .end
+
+  .sub probe
+      .local pmc pir
+      pir = compreg 'PIR'
+      pir(<<'PIR')
+  .include 'lib_cache_probe.pasm'
+  .sub probed
+      say .PROBE
+  .end
+PIR
+      \$P0 = get_global 'probed'
+      \$P0()
+  .end
+CODE
+2
+2
+1
+OUT
+
+    pir_output_is( <<"CODE", <<'OUT', '.include relative to the current directory follows chdir' );
+  .sub main :main
+      .local pmc os
+      os = new ['OS']
+      os.'chdir'('$dirs[1]')
+      probe()
+      os.'chdir'('$dirs[0]')
+      probe()
+  .end
+
+  .sub probe
+      .local pmc pir
+      pir = compreg 'PIR'
+      pir(<<'PIR')
+  .include 'lib_cache_probe.pasm'
+  .sub probed
+      say .PROBE
+  .end
+PIR
+      \$P0 = get_global 'probed'
+      \$P0()
+  .end
+CODE
+2
+1
+OUT
+
+    unlink @probes;
+    rmdir $_ for @dirs;
+}
+
 $ended_ok = 1;
 
 exit;
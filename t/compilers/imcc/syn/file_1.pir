@@ -0,0 +1,6 @@
+.sub test :main
+    say "before"
+    .include "/tmp/sBA4ah6_P3.pasm"
+    print .BAR
+    say "\nafter"
+.end
@@ -0,0 +1,15 @@
+.sub _sub1 :main
+    print "sub1\n"
+    $P0 = get_global "_sub2"
+    .begin_call
+    .call $P0
+    ret:
+    .end_call
+    print "back\n"
+.end
+
+.sub _sub2
+    print "sub2\n"
+   .begin_return
+   .end_return
+.end
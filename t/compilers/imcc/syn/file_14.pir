@@ -0,0 +1,24 @@
+  .include 'iglobals.pasm'
+  .include 'libpaths.pasm'
+
+  .sub main :main
+      .local pmc interp
+      getinterp interp
+
+      .local pmc lib_paths
+      lib_paths = interp[.IGLOBALS_LIB_PATHS]
+
+      .local pmc include_paths
+      include_paths = lib_paths[.PARROT_LIB_PATH_LIBRARY]
+
+      unshift include_paths, '/tmp'
+      load_bytecode 'with_slash.pir'
+
+      .local pmc dummy
+      dummy = shift include_paths
+      unshift include_paths, '/tmp/'
+      load_bytecode 'without_slash.pir'
+
+      with_slash()
+      without_slash()
+  .end
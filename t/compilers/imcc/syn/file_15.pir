@@ -0,0 +1,33 @@
+  .include 'iglobals.pasm'
+  .include 'libpaths.pasm'
+
+  .sub main :main
+      .local pmc interp, include_paths, os
+      getinterp interp
+      $P0 = interp[.IGLOBALS_LIB_PATHS]
+      include_paths = $P0[.PARROT_LIB_PATH_INCLUDE]
+
+      unshift include_paths, '/tmp/imcc_lib_cache_20039_1'
+      probe()
+      probe()
+
+      unshift include_paths, '/tmp/imcc_lib_cache_20039_2'
+      probe()
+
+      os = new ['OS']
+      os.'rm'('/tmp/imcc_lib_cache_20039_2/lib_cache_probe.pasm')
+      probe()
+  .end
+
+  .sub probe
+      .local pmc pir
+      pir = compreg 'PIR'
+      pir(<<'PIR')
+  .include 'lib_cache_probe.pasm'
+  .sub probed
+      say .PROBE
+  .end
+PIR
+      $P0 = get_global 'probed'
+      $P0()
+  .end
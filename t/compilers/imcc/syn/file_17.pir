@@ -0,0 +1,21 @@
+  .sub main :main
+      .local pmc os
+      os = new ['OS']
+      os.'chdir'('/tmp/imcc_lib_rank_20039_2')
+      probe()
+      os.'chdir'('/tmp/imcc_lib_rank_20039_1')
+      probe()
+  .end
+
+  .sub probe
+      .local pmc pir
+      pir = compreg 'PIR'
+      pir(<<'PIR')
+  .include 'lib_cache_probe.pasm'
+  .sub probed
+      say .PROBE
+  .end
+PIR
+      $P0 = get_global 'probed'
+      $P0()
+  .end
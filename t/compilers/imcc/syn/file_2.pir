@@ -0,0 +1,6 @@
+.sub test :main
+    say "before"
+    .include '/tmp/3tCHGiInt5.pasm'
+    say .BAR
+    say "after"
+.end
@@ -0,0 +1,6 @@
+.sub test :main
+    say "before"
+    .include "/tmp/H_1gG9p7QC.pir"
+    print BAR
+    say "\nafter"
+.end
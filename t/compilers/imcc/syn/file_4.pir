@@ -0,0 +1,6 @@
+.sub test :main
+    say "before"
+    .include "/tmp/SKRChJCo6I.inc"
+    print BAR
+    say "\nafter"
+.end
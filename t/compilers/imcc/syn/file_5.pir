@@ -0,0 +1,15 @@
+.sub test :main
+   .local int x
+   x = 10
+   .const int y = 20
+
+   .local int r
+   .local int s
+   (r, s) = _foo(x,y)
+
+   print "r = "
+   say r
+   print "s = "
+   say s
+.end
+.include "/tmp/gyPoae4Wh7.inc"
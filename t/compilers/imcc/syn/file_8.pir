@@ -0,0 +1,10 @@
+.sub _sub1 :main
+    say "sub1"
+    load_bytecode "/tmp/lR5p0O92_Z.pbc"
+    say "loaded"
+    $P0 = get_global "_sub2"
+    .begin_call
+    .call $P0
+    ret:
+    .end_call
+.end
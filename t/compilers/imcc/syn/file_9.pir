@@ -0,0 +1,11 @@
+.sub _sub1 :main
+    say "sub1"
+    load_bytecode "/tmp/nGzeyiCbrS.pir"
+    say "loaded"
+    $P0 = get_global "_sub2"
+    .begin_call
+    .call $P0
+    ret:
+    .end_call
+    say "back"
+.end
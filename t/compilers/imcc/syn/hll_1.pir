@@ -0,0 +1,24 @@
+
+.HLL 'misc'
+.sub anon :anon :init
+  .local pmc interp
+  .local pmc rpa,rsa
+  interp = getinterp
+  rpa = get_class 'ResizablePMCArray'
+  rsa = get_class 'ResizableStringArray'
+  interp.'hll_map'(rpa,rsa)
+.end
+
+.sub main :main
+  elm('a','b','c')
+.end
+
+.sub elm
+  .param pmc args :slurpy
+
+  $I1 = elements args
+  say $I1
+
+  $S0 = typeof args
+  say $S0
+.end
@@ -0,0 +1,29 @@
+
+.sub setup :anon :immediate
+ $P0 = subclass 'ResizablePMCArray', 'Stack'
+.end
+
+.HLL 'misc'
+.sub anon :anon :init
+  .local pmc interp
+  .local pmc rpa,stack
+  interp = getinterp
+  rpa = get_class 'ResizablePMCArray'
+  stack = get_class 'Stack'
+  interp.'hll_map'(rpa,stack)
+.end
+
+
+.sub main :main
+  elm('a','b','c')
+.end
+
+.sub elm
+  .param pmc args :slurpy
+
+  $I1 = elements args
+  say $I1
+
+  $S0 = typeof args
+  say $S0
+.end
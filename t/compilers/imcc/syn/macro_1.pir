@@ -0,0 +1,8 @@
+.sub test :main
+.macro answer()
+    print    42
+    print    "\n"
+.endm
+    .answer()
+    end
+.end
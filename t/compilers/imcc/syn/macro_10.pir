@@ -0,0 +1,11 @@
+.sub test :main
+.macro answer(A)
+    ne    $I0,42,.$done
+    print    .A
+    print    "\n"
+.label $done:
+.endm
+    set    $I0,42
+    .answer($I0)
+    end
+.end
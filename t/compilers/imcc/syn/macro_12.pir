@@ -0,0 +1,5 @@
+.sub test :main
+.const int FOO = 32
+  print FOO
+  end
+.end
@@ -0,0 +1,5 @@
+.sub test :main
+.const string FOO = "foo"
+  print FOO
+  end
+.end
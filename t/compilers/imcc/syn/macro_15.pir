@@ -0,0 +1,4 @@
+.macro_const theanswer 42
+.sub main :main
+    print .theanswer
+.end
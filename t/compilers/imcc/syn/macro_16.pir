@@ -0,0 +1,4 @@
+.macro_const sayhello "Hello"
+.sub main :main
+    print .sayhello
+.end
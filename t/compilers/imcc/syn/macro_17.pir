@@ -0,0 +1,5 @@
+.macro_const firstreg $S0
+.sub main :main
+    .firstreg = "Hello"
+    print .firstreg
+.end
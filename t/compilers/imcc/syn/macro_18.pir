@@ -0,0 +1,5 @@
+.macro_const pi 3.14
+.sub main :main
+    print .pi
+    print "\n"
+.end
@@ -0,0 +1,8 @@
+.sub test :main
+.macro answer()
+    null  $P1
+    print $P1
+.endm
+    .answer()
+    end
+.end
@@ -0,0 +1,11 @@
+.sub test :main
+.macro newid(ID, CLASS)
+    .local pmc .ID
+    .ID = new .CLASS
+.endm
+    .newid(var, 'Undef')
+    var = 10
+    print var
+    print "\n"
+    end
+.end
@@ -0,0 +1,12 @@
+.sub test :main
+.macro newlex(ID, CLASS)
+    .local pmc .ID
+    .ID = new .CLASS
+    # store_lex -1, .ID , .ID    # how to stringify .ID
+.endm
+    .newlex(var, 'Undef')
+    var = 10
+    print var
+    print "\n"
+    end
+.end
@@ -0,0 +1,8 @@
+.sub test :main
+.macro M(A, B)
+    print .A
+    print .B
+.endm
+    .M("never")
+    end
+.end
@@ -0,0 +1,4 @@
+.sub test :main
+.macro M(
+
+
@@ -0,0 +1,6 @@
+.sub test :main
+.macro M(A, B
+  print .A
+.endm
+  .M(A, B)
+.end
@@ -0,0 +1,7 @@
+.sub test :main
+.macro answer()
+.endm
+    null $P1
+    print $P1
+    end
+.end
@@ -0,0 +1,8 @@
+.sub test :main
+.macro M(A, B)
+    print .A
+    print .B
+.endm
+    .N(1,2)
+    end
+.end
@@ -0,0 +1,7 @@
+.sub test :main
+.macro M()
+    this gives a parse error
+.endm
+    .M()
+    end
+.end
@@ -0,0 +1,7 @@
+.sub test :main
+.macro M(A)
+    .set_arg .A
+.endm
+    .M(a)
+    end
+.end
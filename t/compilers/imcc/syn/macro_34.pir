@@ -0,0 +1,8 @@
+.macro M(A)
+    print .A
+.endm
+.sub test :main
+    $S0 = "foo\n"
+    .M({$S0})
+    end
+.end
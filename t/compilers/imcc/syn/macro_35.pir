@@ -0,0 +1,9 @@
+.macro M(A)
+    .A
+.endm
+.sub test :main
+    $S0 = "foo\n"
+    .M({set $S0, "bar\n"
+    print $S0})
+    end
+.end
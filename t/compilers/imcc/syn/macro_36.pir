@@ -0,0 +1,11 @@
+.macro M(A)
+    .A
+.endm
+.sub test :main
+    .M({foo()})
+    end
+.end
+
+.sub foo
+    print "foo\n"
+.end
@@ -0,0 +1,10 @@
+.sub test :main
+.macro test_label_names()
+    branch .$jump
+    print 'do not print this'
+  .label $jump:
+    print 'print this'
+    print "\n"
+.endm
+    .test_label_names()
+.end
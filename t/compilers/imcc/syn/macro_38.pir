@@ -0,0 +1,6 @@
+.sub test :main
+.macro SpinForever (Count)
+    .label $LOOP: dec .COUNT # ".label $LOOP" defines a local label.
+    branch .$LOOP # Jump to said label.
+.endm
+.end
@@ -0,0 +1,8 @@
+.sub test :main
+    .macro m()
+        .local $iter_loop:
+        print "ok\n"
+    .endm
+
+    .m()
+.end
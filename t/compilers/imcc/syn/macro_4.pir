@@ -0,0 +1,8 @@
+.sub test :main
+.macro answer()
+    null $P1
+.endm
+    .answer()
+    print $P1
+    end
+.end
@@ -0,0 +1,14 @@
+.macro call_sub(L)
+   print "entering macro call_sub\n"
+   .L()
+   print "leaving macro call_sub\n"
+.endm
+
+.sub main :main
+  print_abc()
+  .call_sub(print_abc)
+.end
+
+.sub print_abc
+   print "abc\n"
+.end
@@ -0,0 +1,35 @@
+
+.macro create_inst(inst_name,M)
+    print "entering macro create_inst\n"
+    .inst_name = new 'MyClass'
+    .const 'Sub' c3 = .M
+    setattribute .inst_name, 'MyFuncInMyClass', c3
+    print "leaving macro create_inst\n"
+.endm
+
+.sub main :main
+    say_twice( 'say_twice' )
+
+    .local pmc my_class
+    my_class = newclass 'MyClass'
+    addattribute my_class, 'MyFuncInMyClass'
+
+    .local pmc my_inst_1, my_func_1
+    .create_inst(my_inst_1, "say_twice")
+    my_func_1 = getattribute my_inst_1, 'MyFuncInMyClass'
+    my_func_1('my_func_1')
+
+    .local pmc my_inst_2, my_func_2
+    .create_inst(my_inst_2, "say_twice")
+    my_func_2 = getattribute my_inst_2, 'MyFuncInMyClass'
+    my_func_2('my_func_2')
+.end
+
+.sub say_twice
+   .param string msg
+
+   print msg
+   print ' '
+   print msg
+   print "\n"
+.end
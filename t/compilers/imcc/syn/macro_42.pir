@@ -0,0 +1,16 @@
+.macro While(conditional, code)
+
+.label $beginwhile:
+    unless .conditional goto .$endwhile
+    .code
+  goto .$beginwhile
+.label $endwhile:
+.endm
+
+.sub main :main
+.While($I0 < 3, {
+say $I0
+goto .$endwhile
+inc $I0
+})
+.end
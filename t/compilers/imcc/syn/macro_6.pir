@@ -0,0 +1,9 @@
+.sub test :main
+.macro answer(A)
+    print    42
+.endm
+    set    $I0, 43
+    .answer($I0)
+    print    "\n"
+    end
+.end
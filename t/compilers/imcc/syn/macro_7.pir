@@ -0,0 +1,8 @@
+.sub test :main
+.macro answer(A)
+    print    .A
+.endm
+    .answer(42)
+    print    "\n"
+    end
+.end
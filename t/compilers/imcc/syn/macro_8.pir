@@ -0,0 +1,9 @@
+.sub test :main
+.macro answer(A)
+    print    .A
+.endm
+    set    $I0,42
+    .answer($I0)
+    print    "\n"
+    end
+.end
@@ -0,0 +1,11 @@
+.sub test :main
+.macro answer(A)
+    print    .A
+    print    "\n"
+    inc    .A
+.endm
+    set    $I0,42
+    .answer($I0)
+    .answer($I0)
+    end
+.end
@@ -0,0 +1,21 @@
+.sub test :main
+    .const 'Sub' sub = "_sub"
+    .const int y = 20
+    .begin_call
+    .set_arg 10
+    .set_arg y
+    .call sub
+    .local string z
+    .get_result z
+    .end_call
+    print z
+.end
+.sub _sub
+    .param int a
+    .param int b
+    print a
+    print "\n"
+    print b
+    print "\n"
+    .return ("ok\n")
+.end
@@ -0,0 +1,37 @@
+.sub _main :main
+    .local pmc x, y, z, ar, ar2
+    x = new 'String'
+    x = "first\n"
+    y = new 'String'
+    y = "middle\n"
+    z = new 'String'
+    z = "last\n"
+    ar = new 'ResizablePMCArray'
+    push ar, "ok 1\n"
+    push ar, "ok 2\n"
+    ar2 = new 'ResizablePMCArray'
+    push ar2, "ok 3\n"
+    push ar2, "ok 4\n"
+    push ar2, "ok 5\n"
+    _sub(x, ar :flat, y, ar2 :flat, z)
+.end
+
+.sub _sub
+    .param pmc a
+    .param pmc b
+    .param pmc c
+    .param pmc d
+    .param pmc e
+    .param pmc f
+    .param pmc g
+    .param pmc h
+    print a
+    print b
+    print c
+    print d
+    print e
+    print f
+    print g
+    print h
+.end
+
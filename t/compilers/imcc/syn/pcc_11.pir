@@ -0,0 +1,3 @@
+.sub _main :main
+    print "ok\n"
+.end
@@ -0,0 +1,3 @@
+.sub _main :main :load :postcomp
+    print "ok\n"
+.end
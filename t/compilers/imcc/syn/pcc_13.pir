@@ -0,0 +1,9 @@
+.sub foo :multi() :main
+    print "ok 1\n"
+.end
+.sub f1 :multi(int)
+.end
+.sub f2 :multi(int, float)
+.end
+.sub f3 :multi(Integer, Any, _)
+.end
@@ -0,0 +1,11 @@
+.sub foo :main
+        set $S0, 'ok'
+        print $S0
+        print "\r\n"
+.end
+
+.sub bar :main
+        set $S0, 'not ok'
+        print $S0
+        print "\r\n"
+.end
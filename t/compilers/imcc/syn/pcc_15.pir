@@ -0,0 +1,3 @@
+.sub anon :anon :main
+    print "ok\n"
+.end
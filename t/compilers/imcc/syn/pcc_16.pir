@@ -0,0 +1,16 @@
+.sub main :main
+    .local pmc result
+    result = get_global 'anon'
+    unless null result goto callit
+    result = get_global 'ok'
+  callit:
+    result()
+.end
+
+.sub anon :anon
+    print "not ok\n"
+.end
+
+.sub ok
+    print "ok\n"
+.end
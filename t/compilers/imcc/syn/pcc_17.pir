@@ -0,0 +1,13 @@
+.sub main :main
+    .local pmc result
+    result= get_global 'anon'
+    result()
+.end
+
+.sub anon
+    print "ok\n"
+.end
+
+.sub anon :anon
+    print "not ok\n"
+.end
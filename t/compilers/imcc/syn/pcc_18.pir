@@ -0,0 +1,20 @@
+.sub main :main
+    .local pmc result
+    result= get_global 'anon'
+    unless null result goto callit
+    result = get_global 'ok'
+  callit:
+    result()
+.end
+
+.sub anon :anon
+    print "nok 1\n"
+.end
+
+.sub anon :anon
+    print "nok 2\n"
+.end
+
+.sub ok
+    print "ok\n"
+.end
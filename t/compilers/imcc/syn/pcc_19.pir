@@ -0,0 +1,6 @@
+.sub main :main
+        () = foo()
+.end
+.sub foo
+        print "foo\n"
+.end
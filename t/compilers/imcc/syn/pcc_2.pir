@@ -0,0 +1,15 @@
+.sub test :main
+    .const int y = 20
+    .local string z
+    z = _sub(10, y)
+    print z
+.end
+.sub _sub
+    .param int a
+    .param int b
+    print a
+    print "\n"
+    print b
+    print "\n"
+    .return ("ok\n")
+.end
@@ -0,0 +1,7 @@
+.sub main :main
+        () = foo()
+.end
+.sub foo
+        print "foo\n"
+    .return(1)
+.end
@@ -0,0 +1,8 @@
+.sub main :main
+    'foo'()
+    say "didn't segfault"
+.end
+
+.sub foo
+    
+.end
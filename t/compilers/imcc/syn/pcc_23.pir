@@ -0,0 +1,15 @@
+.sub 'main' :main
+    $P0 = newclass 'Foo'
+    $P1 = new $P0
+    $S0 = utf8:"foo\x{b1}"
+    $P1.$S0(1)
+    $P1.utf8:"foo\x{b1}"(2)
+.end
+
+.namespace ['Foo']
+.sub utf8:"foo\x{b1}" :method
+    .param int count
+    print 'ok '
+    print count
+    say ' - Unicode method names allowed'
+.end
@@ -0,0 +1,21 @@
+.sub main :main
+.local pmc foo
+foo = get_global 'foo'
+
+foo('x' => 1, 'y' => 2)
+foo(1 :named('x'), 2 :named('y'))
+
+.begin_call
+.set_arg 1 :named('x')
+.set_arg 2 :named('y')
+.call foo
+.end_call
+.end
+
+.sub foo
+.param int i :named('y')
+.param int j :named('x')
+say i
+say j
+.end
+
@@ -0,0 +1,10 @@
+.sub main :main
+  $I0 = 'incr'('value'=>3)
+  say $I0
+.end
+
+.sub 'incr'
+  .param int value :named
+  inc value
+  .return(value)
+.end
@@ -0,0 +1,9 @@
+.sub foo :method
+    .param pmc self
+    say self
+.end
+
+.sub main :main
+    $P0 = box 'hello'
+    'foo'($P0)
+.end
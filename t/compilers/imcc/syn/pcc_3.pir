@@ -0,0 +1,13 @@
+.sub main :main
+    "foo"()
+    print "ok\n"
+.end
+
+.sub "foo"
+    print "foo\n"
+    "new"()
+.end
+
+.sub "new"
+    print "new\n"
+.end
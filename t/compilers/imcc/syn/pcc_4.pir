@@ -0,0 +1,13 @@
+.sub test :main
+    .local pmc the_sub
+    the_sub = get_global "_sub"
+    the_sub(10, 20)
+.end
+.sub _sub
+    .param int a
+    .param int b
+    print a
+    print "\n"
+    print b
+    print "\n"
+.end
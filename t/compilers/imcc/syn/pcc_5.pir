@@ -0,0 +1,11 @@
+.sub test :main
+.local int a, b
+  (a, b) = _sub()
+  print a
+  print b
+  print "\n"
+.end
+
+.sub _sub
+.return ( 4,  2 )
+.end
@@ -0,0 +1,20 @@
+.sub test :main
+    .local int count, product, result
+    count = 5
+    product = 1
+    result = _fact(product, count)
+    print result
+    print "\n"
+.end
+
+.sub _fact
+   .param int product
+   .param int count
+   if count > 1 goto recur
+   .return (product)
+recur:
+   product = product * count
+   dec count
+   .tailcall _fact(product, count)
+.end
+
@@ -0,0 +1,30 @@
+.sub test :main
+  .local int i
+  i=5
+  new $P1, 'Continuation'
+  set_label $P1, after_loop
+loop:
+  $I2 = _addtwo($P1, i)
+    print $I2
+    print "\n"
+    goto loop
+ after_loop:
+  .get_results ()
+  print "done in main\n"
+.end
+
+.sub _addtwo
+  .param pmc when_done
+  .param int a
+  .local int i
+  i = 0
+ loop:
+    if i >= 10 goto done
+    $I5 = a+i
+    .yield($I5)
+    i = i + 1
+    goto loop
+ done:
+  print "done in coroutine\n"
+  when_done()
+.end
@@ -0,0 +1,28 @@
+.sub test :main
+  .local int i
+  i=5
+  push_eh after_loop
+loop:
+  $I2 = _addtwo(i)
+    print $I2
+    print "\n"
+    goto loop
+ after_loop:
+  print "done in main\n"
+.end
+
+.sub _addtwo
+  .param int a
+  .local int i
+  i = 0
+ loop:
+    if i >= 10 goto done
+    $I5 = a+i
+    .yield($I5)
+    i = i + 1
+    goto loop
+ done:
+  print "done in coroutine\n"
+  new $P0, 'Exception'
+  throw $P0
+.end
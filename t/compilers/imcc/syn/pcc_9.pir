@@ -0,0 +1,43 @@
+.sub _main :main
+    .local pmc x, y, z, ar, ar2
+    x = new 'String'
+    x = "first\n"
+    y = new 'String'
+    y = "middle\n"
+    z = new 'String'
+    z = "last\n"
+    ar = new 'ResizablePMCArray'
+    push ar, "ok 1\n"
+    push ar, "ok 2\n"
+    ar2 = new 'ResizablePMCArray'
+    push ar2, "ok 3\n"
+    push ar2, "ok 4\n"
+    push ar2, "ok 5\n"
+    .const 'Sub' s = "_sub"
+    .begin_call
+    .set_arg x
+    .set_arg ar :flat
+    .set_arg y
+    .set_arg ar2 :flat
+    .set_arg z
+    .call s
+    .end_call
+.end
+.sub _sub
+    .param pmc a
+    .param pmc b
+    .param pmc c
+    .param pmc d
+    .param pmc e
+    .param pmc f
+    .param pmc g
+    .param pmc h
+    print a
+    print b
+    print c
+    print d
+    print e
+    print f
+    print g
+    print h
+.end
@@ -0,0 +1,6 @@
+.sub test :main
+    print "pass\n"
+    end
+.end
+=head1 Some POD
+This should be ignored, incl. digit 1
@@ -0,0 +1,7 @@
+.sub test :main
+    print "pass\n"
+    end
+.end
+=head1 Some POD
+This should be ignored, incl. number 1.0
+=cut
@@ -0,0 +1,12 @@
+.sub test :main
+     print "pass\n"
+     _x()
+     end
+.end
+
+.sub _x
+=head1 Some POD
+ This should be ignored, incl. digit 1.0
+=cut
+  print "ok\n"
+.end
@@ -0,0 +1,3 @@
+.sub main :main
+    get_results '(0)'
+.end
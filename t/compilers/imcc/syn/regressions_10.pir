@@ -0,0 +1,5 @@
+.sub foo :main
+  .local string a::b
+  a::b = 'HI'
+  say a::b
+.end
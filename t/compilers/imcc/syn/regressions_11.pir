@@ -0,0 +1,7 @@
+ .sub main :main
+    $P0 = box 'hello world'
+    .lex utf8:"$\u03b2\u03bf\u03bf", $P0
+
+    $P1 = find_lex utf8:"$\u03b2\u03bf\u03bf"
+    say $P1
+ .end
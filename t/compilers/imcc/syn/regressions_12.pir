@@ -0,0 +1,10 @@
+ .sub 'main' :main
+    'foo'(1 :named(utf8:"\x{e4}"))
+ .end
+
+ # Perl 6:  sub foo(:$ä) { say "ok $ä"; }
+ .sub 'foo'
+    .param int x :named(utf8:"\x{e4}")
+    print "ok "
+    say x
+ .end
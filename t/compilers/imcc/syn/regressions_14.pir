@@ -0,0 +1,3 @@
+.sub 'foo' :immediate
+  die 'no'
+.end
@@ -0,0 +1,3 @@
+.sub 'main'
+    ($S0) = 'blah'(:pir_only=>1)
+.end
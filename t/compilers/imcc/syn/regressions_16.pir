@@ -0,0 +1,22 @@
+.sub main :main
+push_eh handler
+test()
+## NB: This makes sure the sub call PC is sufficiently
+## different from the exception handler PC.
+print "foo\n"
+print "bar\n"
+.return ()
+handler:
+.local pmc exception
+.local string message
+.get_results (exception, message)
+print "Error: "
+print message
+.end
+
+.sub test
+## Throw an exception.
+$P0 = new 'Exception'
+$P0 = 'oops'
+throw $P0
+.end
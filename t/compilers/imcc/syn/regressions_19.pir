@@ -0,0 +1,10 @@
+
+.sub bar
+  .param pmc foo :optional
+  .param string joe :opt_flag
+  say joe
+.end
+
+.sub main :main
+bar()
+.end
@@ -0,0 +1,15 @@
+.sub fold_by_zero :main
+  push_eh ok1
+    $I1 = 1/0
+  pop_eh
+  print "not "
+ ok1:
+  say "ok 1 - caught div_i_ic_ic exception"
+
+  push_eh ok2
+    $N1 = 1.0/0.0
+  pop_eh
+  print "not "
+ ok2:
+  say "ok 2 - caught div_n_nc_nc exception"
+.end
@@ -0,0 +1,10 @@
+
+.sub bar
+  .param pmc foo :optional
+  .param pmc joe :opt_flag
+  say joe
+.end
+
+.sub main :main
+bar()
+.end
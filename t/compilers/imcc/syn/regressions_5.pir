@@ -0,0 +1,9 @@
+.sub main :main
+  comments(1,2)
+.end
+.sub comments
+  .param pmc a
+  # Testing
+  .param pmc b
+  say 'hello'
+.end
@@ -0,0 +1,7 @@
+.sub foo :main
+  $P0 = new 'Hash'
+  $P1 = $P0['x']
+  unless $P1 goto no
+  print "yes\n"
+no:
+.end
@@ -0,0 +1,6 @@
+.sub foo :main
+  $P0 = new 'String'
+  $P0 = 'HI'
+  $P0.lower()
+  say $P0
+.end
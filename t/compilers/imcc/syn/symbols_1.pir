@@ -0,0 +1,3 @@
+.sub main :main
+    print $S
+.end
@@ -0,0 +1,3 @@
+.sub main :main
+    $I = 5
+.end
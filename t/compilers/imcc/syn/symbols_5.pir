@@ -0,0 +1,5 @@
+.sub main :main
+    .local int object
+    object = 1
+    say object
+.end
@@ -0,0 +1,74 @@
+
+.sub _main :main
+    $P1 = new 'Integer'
+    $P1 = 20
+    $P2 = new 'Integer'
+    $P2 = 3
+    .const 'Sub' f = "_floor"
+    .const 'Sub' c = "_funcall"
+    set_args "0,0,0", f, $P1, $P2
+    invokecc c
+    get_results "0,0", $P3, $P4
+    print "_floor returned "
+    print 2      # TODO argcP
+    print " values, "
+    print $P3
+    print " and "
+    print $P4
+    print ".\n"
+    .const 'Sub' s = "_fib_step"
+    set_args "0,0,0", s, $P1, $P2
+    invokecc c
+    get_results "0,0,0", $P3, $P4, $P5
+    print "_fib_step returned "
+    print 3    # TODO argcP
+    print " values, "
+    print $P3
+    print ", "
+    print $P4
+    print ", and "
+    print $P5
+    print ".\n"
+.end
+
+.sub _funcall
+    .local pmc function
+    .local pmc argv
+    get_params "0,0x20", function, argv
+    print "[doing _funcall]\n"
+    $I33 = defined function
+    if $I33 goto doit
+bad_func:
+    print "_funcall:  Bad function.\n"
+    exit 0
+doit:
+    set_args "0x20", argv
+    tailcall function
+.end
+
+## Return quotient and remainder as two integers.
+.sub _floor
+    .local pmc arg1
+    .local pmc arg2
+    get_params "0,0", arg1, arg2
+    $P1 = new 'Integer'
+    $P1 = arg1 / arg2
+    ## truncate.
+    $I1 = $P1
+    $P1 = $I1
+    $P2 = new 'Integer'
+    $P2 = arg1 % arg2
+    set_returns "0,0", $P1, $P2
+    returncc
+.end
+
+## Return the sum and the two arguments as three integers.
+.sub _fib_step
+    .local pmc arg1
+    .local pmc arg2
+    get_params "0,0", arg1, arg2
+    $P1 = new 'Integer'
+    $P1 = arg1 + arg2
+    set_returns "0,0,0", $P1, arg1, arg2
+    returncc
+.end
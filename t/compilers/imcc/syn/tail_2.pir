@@ -0,0 +1,66 @@
+
+.sub _main :main
+    $P1 = new 'Integer'
+    $P1 = 20
+    $P2 = new 'Integer'
+    $P2 = 3
+    .const 'Sub' f = "_floor"
+    .const 'Sub' s = "_fib_step"
+    ($P3, $P4) = _funcall(f, $P1, $P2)
+    print "_floor returned "
+    print 2
+    print " values, "
+    print $P3
+    print " and "
+    print $P4
+    print ".\n"
+    ($P3, $P4, $P5) = _funcall(s, $P1, $P2)
+    print "_fib_step returned "
+    print 3
+    print " values, "
+    print $P3
+    print ", "
+    print $P4
+    print ", and "
+    print $P5
+    print ".\n"
+.end
+
+.sub _funcall
+    .param pmc function
+    .param pmc argv :slurpy
+
+    print "[doing _funcall]\n"
+    $I33 = defined function
+    unless $I33 goto bad_func
+doit:
+    .tailcall function(argv :flat)
+bad_func:
+    print "_funcall:  Bad function.\n"
+    exit 0
+.end
+
+## Return quotient and remainder as two integers.
+.sub _floor
+    .param pmc arg1
+    .param pmc arg2
+
+    $P1 = new 'Integer'
+    $P1 = arg1 / arg2
+    ## truncate.
+    $I1 = $P1
+    $P1 = $I1
+    $P2 = new 'Integer'
+    $P2 = arg1 % arg2
+    .return($P1, $P2)
+.end
+
+## Return the sum and the two arguments as three integers.
+.sub _fib_step
+    .param pmc arg1
+    .param pmc arg2
+
+    $P1 = new 'Integer'
+    $P1 = arg1 + arg2
+    .return ($P1, arg1,  arg2)
+.end
@@ -0,0 +1,47 @@
+
+.sub _main :main
+
+    $P1 = new 'Integer'
+    $P1 = 20
+    $P2 = new 'Integer'
+    $P2 = 3
+    .const 'Sub' s = "_fib_step"
+    ($P3, $P4, $P5) = _funcall(s, $P1, $P2)
+    print "_fib_step returned "
+    print 3
+    print " values, "
+    print $P3
+    print ", "
+    print $P4
+    print ", and "
+    print $P5
+    print ".\n"
+.end
+
+.sub _funcall
+    .param pmc function
+    .param pmc argv :slurpy
+
+    $I33 = defined function
+    unless $I33 goto bad_func
+doit:
+    ($P35 :slurpy) = function(argv :flat)
+        $I35 = $P35
+        print "[got "
+        print $I35
+        print " results]\n"
+    .return ($P35 :flat)
+bad_func:
+    print "_funcall:  Bad function.\n"
+    exit 0
+.end
+
+## Return the sum and the two arguments as three integers.
+.sub _fib_step
+    .param pmc arg1
+    .param pmc arg2
+
+    $P1 = new 'Integer'
+    $P1 = arg1 + arg2
+    .return ($P1, arg1,  arg2)
+.end
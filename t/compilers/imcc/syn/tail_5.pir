@@ -0,0 +1,13 @@
+.sub main :main
+    $S0 = foo()
+    print $S0
+.end
+
+.sub foo
+    .tailcall bar()
+    print "never\n"
+.end
+
+.sub bar
+    .return ("ok\n")
+.end
@@ -0,0 +1,24 @@
+.sub main :main
+    .local pmc cl, o, n
+    cl = newclass "Foo"
+    addattribute cl, "n"
+    o = new "Foo"
+    n = new 'Integer'
+    n = 2000   # beyond recursion limit of 1000
+    setattribute o, [ "Foo" ], "n", n
+    o."go"()
+    n = getattribute o, [ "Foo" ], "n"
+    print n
+    print "\n"
+.end
+
+.namespace ["Foo"]
+.sub go :method
+    .local pmc n
+    n = getattribute self, [ "Foo" ], "n"
+    dec n
+    unless n goto done
+    .tailcall self."go"()
+done:
+.end
+
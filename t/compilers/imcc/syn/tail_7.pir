@@ -0,0 +1,41 @@
+.sub main :main
+    say "A"
+    $P0 = 'Foo'("C")
+    $S0 = typeof $P0
+    $P9 = $P0.'subs_by_tag'('init')
+    $P8 = $P9[0]
+    $P8()
+    $P0 = $P0.'all_subs'()
+    $P1 = $P0[0]
+    $P1 = 'Bar'($P1, "F")
+    say $P1
+    say "H"
+.end
+
+.sub 'Foo'
+    .param string c
+    say "B"
+    $P0 = compreg "PIR"
+    $S0 = <<'PIRSOURCE'
+    .sub 'Baz' :main
+        .param string f
+        say f
+        .return("G")
+    .end
+
+    .sub 'Fie' :init
+        say "D"
+    .end
+
+PIRSOURCE
+
+    say c
+    .tailcall $P0($S0)
+.end
+
+.sub 'Bar'
+    .param pmc baz
+    .param string f
+    say "E"
+    .tailcall baz(f)
+.end
@@ -0,0 +1,262 @@
+#------------------------------#
+# The compiler mainline code   #
+#------------------------------#
+
+.namespace [ 'TestGrammar'; 'Compiler' ]
+
+.sub 'onload' :anon :load :init
+    load_bytecode 'PCT.pbc'
+.end
+
+.sub 'main' :main
+
+    .local pmc args
+    args = new 'ResizableStringArray'
+    push args, "test_program"
+    push args, "/root/repo/t/compilers/pct/complete_workflow_sample_input.txt"
+
+    $P0 = new ['PCT'; 'HLLCompiler']
+    $P0.'language'('TestGrammar')
+    $P0.'parsegrammar'('TestGrammar::Grammar')
+    $P0.'parseactions'('TestGrammar::Grammar::Actions')
+
+    $P1 = $P0.'command_line'(args)
+
+    .return()
+.end
+
+#------------------------------#
+# The generated parser         #
+#------------------------------#
+
+      .sub '__onload' :load :init
+          .local pmc optable
+          ## namespace TestGrammar::Grammar
+          .local pmc p6meta
+          p6meta = get_root_global ['parrot'], 'P6metaclass'
+          $P0 = p6meta.'get_proto'('TestGrammar::Grammar')
+          unless null $P0 goto onload_250
+          p6meta.'new_class'('TestGrammar::Grammar', 'parent'=>'PCT::Grammar')
+        onload_250:
+          .return ()
+      .end
+
+## <TestGrammar::Grammar::TOP>
+.namespace ["TestGrammar";"Grammar"]
+      .sub "TOP" :method :nsentry 
+          .param pmc adverbs      :slurpy :named
+          .local pmc mob
+          .local string target
+          .local pmc mfrom, mpos
+          .local int cpos, iscont
+          $P0 = get_hll_global ['PGE'], '$!MATCH'
+          (mob, cpos, target, mfrom, mpos, iscont) = $P0.'new'(self, adverbs :flat :named)
+          .local int lastpos
+          lastpos = length target
+          if cpos > lastpos goto fail_rule
+          .local pmc cstack
+          cstack = root_new ['parrot';'ResizableIntegerArray']
+          .local pmc ustack
+          ustack = root_new ['parrot';'ResizablePMCArray']
+          .local int pos, rep, cutmark
+        try_match:
+          if cpos > lastpos goto fail_rule
+          mfrom = cpos
+          pos = cpos
+          cutmark = 0
+          local_branch cstack, R
+          if cutmark <= -2 goto fail_cut
+          inc cpos
+          if iscont goto try_match
+        fail_rule:
+          cutmark = -2
+        fail_cut:
+          mob.'_failcut'(cutmark)
+          .return (mob)
+          goto fail_cut
+        succeed:
+          mpos = pos
+          .return (mob)
+        fail:
+          local_return cstack
+        R:  # alt R244, R245
+          push ustack, pos
+          local_branch cstack, R244
+          pos = pop ustack
+          if cutmark != 0 goto fail
+          goto R245
+
+        R244: # concat
+        R246: # literal
+          $I0 = pos + 6
+          if $I0 > lastpos goto fail
+          $S0 = substr target, pos, 6
+          
+          if $S0 != "thingy" goto fail
+          pos += 6
+          goto R247
+
+        R247: # action
+          $P1 = adverbs['action']
+          if null $P1 goto succeed
+          $I1 = can $P1, "TOP"
+          if $I1 == 0 goto succeed
+          mpos = pos
+          $P1."TOP"(mob, "key_for_thingy")
+          goto succeed
+        R245: # concat
+        R248: # literal
+          $I0 = pos + 5
+          if $I0 > lastpos goto fail
+          $S0 = substr target, pos, 5
+          
+          if $S0 != "stuff" goto fail
+          pos += 5
+          goto R249
+
+        R249: # action
+          $P1 = adverbs['action']
+          if null $P1 goto succeed
+          $I1 = can $P1, "TOP"
+          if $I1 == 0 goto succeed
+          mpos = pos
+          $P1."TOP"(mob, "key_for_stuff")
+          goto succeed
+      .end
+
+
+
+#------------------------------#
+# The generated actions        #
+#------------------------------#
+
+
+.namespace []
+.sub "_block1000"  :anon :subid("10_1792413053.75693")
+.annotate 'file', "/root/repo/t/compilers/pct/A580AxijFt.pm"
+.annotate 'line', 0
+    .const 'Sub' $P1003 = "11_1792413053.75693" 
+    capture_lex $P1003
+.annotate 'line', 1
+    $P0 = find_dynamic_lex "$*CTXSAVE"
+    if null $P0 goto ctxsave_done
+    $I0 = can $P0, "ctxsave"
+    unless $I0 goto ctxsave_done
+    $P0."ctxsave"()
+  ctxsave_done:
+.annotate 'line', 7
+    .const 'Sub' $P1003 = "11_1792413053.75693" 
+    capture_lex $P1003
+    $P101 = $P1003()
+.annotate 'line', 1
+    .return ($P101)
+    .const 'Sub' $P1015 = "14_1792413053.75693" 
+    .return ($P1015)
+.end
+
+
+.namespace []
+.sub "" :load :init :subid("post15") :outer("10_1792413053.75693")
+.annotate 'file', "/root/repo/t/compilers/pct/A580AxijFt.pm"
+.annotate 'line', 0
+    .const 'Sub' $P1001 = "10_1792413053.75693" 
+    .local pmc block
+    set block, $P1001
+    $P1017 = get_root_global ["parrot"], "P6metaclass"
+    $P1017."new_class"("TestGrammar::Grammar::Actions")
+.end
+
+
+.namespace ["TestGrammar";"Grammar";"Actions"]
+.sub "_block1002"  :subid("11_1792413053.75693") :outer("10_1792413053.75693")
+.annotate 'file', "/root/repo/t/compilers/pct/A580AxijFt.pm"
+.annotate 'line', 7
+    .const 'Sub' $P1004 = "12_1792413053.75693" 
+    capture_lex $P1004
+    $P0 = find_dynamic_lex "$*CTXSAVE"
+    if null $P0 goto ctxsave_done
+    $I0 = can $P0, "ctxsave"
+    unless $I0 goto ctxsave_done
+    $P0."ctxsave"()
+  ctxsave_done:
+    .const 'Sub' $P1004 = "12_1792413053.75693" 
+    newclosure $P1010, $P1004
+    .return ($P1010)
+    .const 'Sub' $P1012 = "13_1792413053.75693" 
+    .return ($P1012)
+.end
+
+
+.namespace ["TestGrammar";"Grammar";"Actions"]
+.include "except_types.pasm"
+.sub "TOP"  :subid("12_1792413053.75693") :method :outer("11_1792413053.75693")
+    .param pmc param_1007
+    .param pmc param_1008
+.annotate 'file', "/root/repo/t/compilers/pct/A580AxijFt.pm"
+.annotate 'line', 7
+    new $P1006, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1006, control_1005
+    push_eh $P1006
+    .lex "self", self
+    .lex "$/", param_1007
+    .lex "$key", param_1008
+.annotate 'line', 8
+    new $P100, "Undef"
+    set $P1009, $P100
+    .lex "$past", $P1009
+    get_hll_global $P101, ["PAST"], "Stmts"
+.annotate 'line', 9
+    get_hll_global $P102, ["PAST"], "Op"
+.annotate 'line', 10
+    get_hll_global $P103, ["PAST"], "Val"
+.annotate 'line', 11
+    find_lex $P104, "$/"
+    set $S100, $P104
+    new $P105, 'String'
+    set $P105, $S100
+    concat $P106, $P105, " with key: '"
+    find_lex $P107, "$key"
+    concat $P108, $P106, $P107
+    concat $P109, $P108, "'"
+.annotate 'line', 10
+    $P110 = $P103."new"($P109 :named("value"), "String" :named("returns"))
+    $P111 = $P102."new"($P110, "say" :named("pirop"))
+.annotate 'line', 9
+    $P112 = $P101."new"($P111)
+.annotate 'line', 8
+    store_lex "$past", $P112
+.annotate 'line', 18
+    find_lex $P101, "$/"
+    find_lex $P102, "$past"
+    $P103 = $P101."!make"($P102)
+.annotate 'line', 7
+    .return ($P103)
+  control_1005:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["TestGrammar";"Grammar";"Actions"]
+.sub "_block1011" :load :anon :subid("13_1792413053.75693")
+.annotate 'file', "/root/repo/t/compilers/pct/A580AxijFt.pm"
+.annotate 'line', 7
+    .const '' $P1013 = "11_1792413053.75693" 
+    $P100 = $P1013()
+    .return ($P100)
+.end
+
+
+.namespace []
+.sub "_block1014" :load :anon :subid("14_1792413053.75693")
+.annotate 'file', "/root/repo/t/compilers/pct/A580AxijFt.pm"
+.annotate 'line', 1
+    .const '' $P1016 = "10_1792413053.75693" 
+    $P100 = $P1016()
+    .return ($P100)
+.end
+
+
+
@@ -0,0 +1,364 @@
+#------------------------------#
+# The compiler mainline code   #
+#------------------------------#
+
+.namespace [ 'TestGrammar'; 'Compiler' ]
+
+.sub 'onload' :anon :load :init
+    load_bytecode 'PCT.pbc'
+.end
+
+.sub 'main' :main
+
+    .local pmc args
+    args = new 'ResizableStringArray'
+    push args, "test_program"
+    push args, "/root/repo/t/compilers/pct/complete_workflow_sample_input.txt"
+
+    $P0 = new ['PCT'; 'HLLCompiler']
+    $P0.'language'('TestGrammar')
+    $P0.'parsegrammar'('TestGrammar::Grammar')
+    $P0.'parseactions'('TestGrammar::Grammar::Actions')
+
+    $P1 = $P0.'command_line'(args)
+
+    .return()
+.end
+
+#------------------------------#
+# The generated parser         #
+#------------------------------#
+
+      .sub '__onload' :load :init
+          .local pmc optable
+          ## namespace TestGrammar::Grammar
+          .local pmc p6meta
+          p6meta = get_root_global ['parrot'], 'P6metaclass'
+          $P0 = p6meta.'get_proto'('TestGrammar::Grammar')
+          unless null $P0 goto onload_248
+          p6meta.'new_class'('TestGrammar::Grammar', 'parent'=>'PCT::Grammar')
+        onload_248:
+          .return ()
+      .end
+
+## <TestGrammar::Grammar::TOP>
+.namespace ["TestGrammar";"Grammar"]
+      .sub "TOP" :method :nsentry 
+          .param pmc adverbs      :slurpy :named
+          .local pmc mob
+          .local string target
+          .local pmc mfrom, mpos
+          .local int cpos, iscont
+          $P0 = get_hll_global ['PGE'], '$!MATCH'
+          (mob, cpos, target, mfrom, mpos, iscont) = $P0.'new'(self, adverbs :flat :named)
+          .local int lastpos
+          lastpos = length target
+          if cpos > lastpos goto fail_rule
+          .local pmc cstack
+          cstack = root_new ['parrot';'ResizableIntegerArray']
+          .local pmc captscope, captob
+          captscope = mob
+          .local int pos, rep, cutmark
+        try_match:
+          if cpos > lastpos goto fail_rule
+          mfrom = cpos
+          pos = cpos
+          cutmark = 0
+          local_branch cstack, R
+          if cutmark <= -2 goto fail_cut
+          inc cpos
+          if iscont goto try_match
+        fail_rule:
+          cutmark = -2
+        fail_cut:
+          mob.'_failcut'(cutmark)
+          .return (mob)
+          goto fail_cut
+        succeed:
+          mpos = pos
+          .return (mob)
+        fail:
+          local_return cstack
+        fail_match:
+          cutmark = -3
+          goto fail_cut
+        R: # concat
+        R244: # subrule thingy
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'thingy'
+          if $I0 == 0 goto R244_1
+          $P0 = find_method mob, 'thingy'
+          goto R244_2
+        R244_1:
+          $P0 = find_name 'thingy'
+          unless null $P0 goto R244_2
+          die "Unable to find regex 'thingy'"
+        R244_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'dba'=>"", 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          captscope["thingy"] = captob
+
+          pos = $P1
+          local_branch cstack, R245
+          delete captscope["thingy"]
+
+          goto fail
+        R245: # action
+          $P1 = adverbs['action']
+          if null $P1 goto succeed
+          $I1 = can $P1, "TOP"
+          if $I1 == 0 goto succeed
+          mpos = pos
+          $P1."TOP"(mob)
+          goto succeed
+      .end
+
+## <TestGrammar::Grammar::thingy>
+.namespace ["TestGrammar";"Grammar"]
+      .sub "thingy" :method :nsentry 
+          .param pmc adverbs      :slurpy :named
+          .local pmc mob
+          .local string target
+          .local pmc mfrom, mpos
+          .local int cpos, iscont
+          $P0 = get_hll_global ['PGE'], '$!MATCH'
+          (mob, cpos, target, mfrom, mpos, iscont) = $P0.'new'(self, adverbs :flat :named)
+          .local int lastpos
+          lastpos = length target
+          if cpos > lastpos goto fail_rule
+          .local pmc cstack
+          cstack = root_new ['parrot';'ResizableIntegerArray']
+          .local int pos, rep, cutmark
+        try_match:
+          if cpos > lastpos goto fail_rule
+          mfrom = cpos
+          pos = cpos
+          cutmark = 0
+          local_branch cstack, R
+          if cutmark <= -2 goto fail_cut
+          inc cpos
+          if iscont goto try_match
+        fail_rule:
+          cutmark = -2
+        fail_cut:
+          mob.'_failcut'(cutmark)
+          .return (mob)
+          goto fail_cut
+        succeed:
+          mpos = pos
+          .return (mob)
+        fail:
+          local_return cstack
+        R: # concat
+        R246: # literal
+          $I0 = pos + 6
+          if $I0 > lastpos goto fail
+          $S0 = substr target, pos, 6
+          
+          if $S0 != "thingy" goto fail
+          pos += 6
+          goto R247
+
+        R247: # action
+          $P1 = adverbs['action']
+          if null $P1 goto succeed
+          $I1 = can $P1, "thingy"
+          if $I1 == 0 goto succeed
+          mpos = pos
+          $P1."thingy"(mob)
+          goto succeed
+      .end
+
+
+
+#------------------------------#
+# The generated actions        #
+#------------------------------#
+
+
+.namespace []
+.sub "_block1000"  :anon :subid("10_1792413053.94791")
+.annotate 'file', "/root/repo/t/compilers/pct/1BuehOPQ30.pm"
+.annotate 'line', 0
+    .const 'Sub' $P1003 = "11_1792413053.94791" 
+    capture_lex $P1003
+.annotate 'line', 1
+    $P0 = find_dynamic_lex "$*CTXSAVE"
+    if null $P0 goto ctxsave_done
+    $I0 = can $P0, "ctxsave"
+    unless $I0 goto ctxsave_done
+    $P0."ctxsave"()
+  ctxsave_done:
+.annotate 'line', 7
+    .const 'Sub' $P1003 = "11_1792413053.94791" 
+    capture_lex $P1003
+    $P101 = $P1003()
+.annotate 'line', 1
+    .return ($P101)
+    .const 'Sub' $P1019 = "15_1792413053.94791" 
+    .return ($P1019)
+.end
+
+
+.namespace []
+.sub "" :load :init :subid("post16") :outer("10_1792413053.94791")
+.annotate 'file', "/root/repo/t/compilers/pct/1BuehOPQ30.pm"
+.annotate 'line', 0
+    .const 'Sub' $P1001 = "10_1792413053.94791" 
+    .local pmc block
+    set block, $P1001
+    $P1021 = get_root_global ["parrot"], "P6metaclass"
+    $P1021."new_class"("TestGrammar::Grammar::Actions")
+.end
+
+
+.namespace ["TestGrammar";"Grammar";"Actions"]
+.sub "_block1002"  :subid("11_1792413053.94791") :outer("10_1792413053.94791")
+.annotate 'file', "/root/repo/t/compilers/pct/1BuehOPQ30.pm"
+.annotate 'line', 7
+    .const 'Sub' $P1009 = "13_1792413053.94791" 
+    capture_lex $P1009
+    .const 'Sub' $P1004 = "12_1792413053.94791" 
+    capture_lex $P1004
+    $P0 = find_dynamic_lex "$*CTXSAVE"
+    if null $P0 goto ctxsave_done
+    $I0 = can $P0, "ctxsave"
+    unless $I0 goto ctxsave_done
+    $P0."ctxsave"()
+  ctxsave_done:
+.annotate 'line', 14
+    .const 'Sub' $P1009 = "13_1792413053.94791" 
+    newclosure $P1014, $P1009
+.annotate 'line', 7
+    .return ($P1014)
+    .const 'Sub' $P1016 = "14_1792413053.94791" 
+    .return ($P1016)
+.end
+
+
+.namespace ["TestGrammar";"Grammar";"Actions"]
+.include "except_types.pasm"
+.sub "TOP"  :subid("12_1792413053.94791") :method :outer("11_1792413053.94791")
+    .param pmc param_1007
+.annotate 'file', "/root/repo/t/compilers/pct/1BuehOPQ30.pm"
+.annotate 'line', 7
+    new $P1006, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1006, control_1005
+    push_eh $P1006
+    .lex "self", self
+    .lex "$/", param_1007
+.annotate 'line', 10
+    get_global $P100, "$?MY_OUR_VAR"
+    unless_null $P100, vivify_17
+    new $P100, "Undef"
+    set_global "$?MY_OUR_VAR", $P100
+  vivify_17:
+    new $P101, "String"
+    assign $P101, "was set in method TOP"
+    set_global "$?MY_OUR_VAR", $P101
+.annotate 'line', 11
+    find_lex $P101, "$/"
+    find_lex $P1008, "$/"
+    unless_null $P1008, vivify_18
+    $P1008 = root_new ['parrot';'Hash']
+  vivify_18:
+    set $P102, $P1008["thingy"]
+    unless_null $P102, vivify_19
+    new $P102, "Undef"
+  vivify_19:
+    $P103 = $P102."ast"()
+    $P104 = $P101."!make"($P103)
+.annotate 'line', 7
+    .return ($P104)
+  control_1005:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["TestGrammar";"Grammar";"Actions"]
+.include "except_types.pasm"
+.sub "thingy"  :subid("13_1792413053.94791") :method :outer("11_1792413053.94791")
+    .param pmc param_1012
+.annotate 'file', "/root/repo/t/compilers/pct/1BuehOPQ30.pm"
+.annotate 'line', 14
+    new $P1011, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1011, control_1010
+    push_eh $P1011
+    .lex "self", self
+    .lex "$/", param_1012
+.annotate 'line', 15
+    get_global $P100, "$?MY_OUR_VAR"
+    unless_null $P100, vivify_20
+    new $P100, "Undef"
+    set_global "$?MY_OUR_VAR", $P100
+  vivify_20:
+.annotate 'line', 16
+    new $P101, "Undef"
+    set $P1013, $P101
+    .lex "$past", $P1013
+.annotate 'line', 15
+    new $P102, "String"
+    assign $P102, "was set in method thingy"
+    set_global "$?MY_OUR_VAR", $P102
+.annotate 'line', 16
+    get_hll_global $P102, ["PAST"], "Stmts"
+.annotate 'line', 17
+    get_hll_global $P103, ["PAST"], "Op"
+.annotate 'line', 18
+    get_hll_global $P104, ["PAST"], "Val"
+.annotate 'line', 19
+    new $P105, "String"
+    assign $P105, "our var "
+    get_global $P106, "$?MY_OUR_VAR"
+    concat $P107, $P105, $P106
+.annotate 'line', 18
+    $P108 = $P104."new"($P107 :named("value"), "String" :named("returns"))
+    $P109 = $P103."new"($P108, "say" :named("pirop"))
+.annotate 'line', 17
+    $P110 = $P102."new"($P109)
+.annotate 'line', 16
+    store_lex "$past", $P110
+.annotate 'line', 26
+    find_lex $P102, "$/"
+    find_lex $P103, "$past"
+    $P104 = $P102."!make"($P103)
+.annotate 'line', 14
+    .return ($P104)
+  control_1010:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P102, exception, "payload"
+    .return ($P102)
+.end
+
+
+.namespace ["TestGrammar";"Grammar";"Actions"]
+.sub "_block1015" :load :anon :subid("14_1792413053.94791")
+.annotate 'file', "/root/repo/t/compilers/pct/1BuehOPQ30.pm"
+.annotate 'line', 7
+    .const '' $P1017 = "11_1792413053.94791" 
+    $P100 = $P1017()
+    .return ($P100)
+.end
+
+
+.namespace []
+.sub "_block1018" :load :anon :subid("15_1792413053.94791")
+.annotate 'file', "/root/repo/t/compilers/pct/1BuehOPQ30.pm"
+.annotate 'line', 1
+    .const '' $P1020 = "10_1792413053.94791" 
+    $P100 = $P1020()
+    .return ($P100)
+.end
+
+
+
@@ -0,0 +1,374 @@
+#------------------------------#
+# The compiler mainline code   #
+#------------------------------#
+
+.namespace [ 'TestGrammar'; 'Compiler' ]
+
+.sub 'onload' :anon :load :init
+    load_bytecode 'PCT.pbc'
+.end
+
+.sub 'main' :main
+
+    .local pmc args
+    args = new 'ResizableStringArray'
+    push args, "test_program"
+    push args, "/root/repo/t/compilers/pct/complete_workflow_sample_input.txt"
+
+    $P0 = new ['PCT'; 'HLLCompiler']
+    $P0.'language'('TestGrammar')
+    $P0.'parsegrammar'('TestGrammar::Grammar')
+    $P0.'parseactions'('TestGrammar::Grammar::Actions')
+
+    $P1 = $P0.'command_line'(args)
+
+    .return()
+.end
+
+#------------------------------#
+# The generated parser         #
+#------------------------------#
+
+      .sub '__onload' :load :init
+          .local pmc optable
+          ## namespace TestGrammar::Grammar
+          .local pmc p6meta
+          p6meta = get_root_global ['parrot'], 'P6metaclass'
+          $P0 = p6meta.'get_proto'('TestGrammar::Grammar')
+          unless null $P0 goto onload_248
+          p6meta.'new_class'('TestGrammar::Grammar', 'parent'=>'PCT::Grammar')
+        onload_248:
+          .return ()
+      .end
+
+## <TestGrammar::Grammar::TOP>
+.namespace ["TestGrammar";"Grammar"]
+      .sub "TOP" :method :nsentry 
+          .param pmc adverbs      :slurpy :named
+          .local pmc mob
+          .local string target
+          .local pmc mfrom, mpos
+          .local int cpos, iscont
+          $P0 = get_hll_global ['PGE'], '$!MATCH'
+          (mob, cpos, target, mfrom, mpos, iscont) = $P0.'new'(self, adverbs :flat :named)
+          .local int lastpos
+          lastpos = length target
+          if cpos > lastpos goto fail_rule
+          .local pmc cstack
+          cstack = root_new ['parrot';'ResizableIntegerArray']
+          .local pmc captscope, captob
+          captscope = mob
+          .local int pos, rep, cutmark
+        try_match:
+          if cpos > lastpos goto fail_rule
+          mfrom = cpos
+          pos = cpos
+          cutmark = 0
+          local_branch cstack, R
+          if cutmark <= -2 goto fail_cut
+          inc cpos
+          if iscont goto try_match
+        fail_rule:
+          cutmark = -2
+        fail_cut:
+          mob.'_failcut'(cutmark)
+          .return (mob)
+          goto fail_cut
+        succeed:
+          mpos = pos
+          .return (mob)
+        fail:
+          local_return cstack
+        fail_match:
+          cutmark = -3
+          goto fail_cut
+        R: # concat
+        R244: # subrule thingy
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'thingy'
+          if $I0 == 0 goto R244_1
+          $P0 = find_method mob, 'thingy'
+          goto R244_2
+        R244_1:
+          $P0 = find_name 'thingy'
+          unless null $P0 goto R244_2
+          die "Unable to find regex 'thingy'"
+        R244_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'dba'=>"", 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          captscope["thingy"] = captob
+
+          pos = $P1
+          local_branch cstack, R245
+          delete captscope["thingy"]
+
+          goto fail
+        R245: # action
+          $P1 = adverbs['action']
+          if null $P1 goto succeed
+          $I1 = can $P1, "TOP"
+          if $I1 == 0 goto succeed
+          mpos = pos
+          $P1."TOP"(mob)
+          goto succeed
+      .end
+
+## <TestGrammar::Grammar::thingy>
+.namespace ["TestGrammar";"Grammar"]
+      .sub "thingy" :method :nsentry 
+          .param pmc adverbs      :slurpy :named
+          .local pmc mob
+          .local string target
+          .local pmc mfrom, mpos
+          .local int cpos, iscont
+          $P0 = get_hll_global ['PGE'], '$!MATCH'
+          (mob, cpos, target, mfrom, mpos, iscont) = $P0.'new'(self, adverbs :flat :named)
+          .local int lastpos
+          lastpos = length target
+          if cpos > lastpos goto fail_rule
+          .local pmc cstack
+          cstack = root_new ['parrot';'ResizableIntegerArray']
+          .local int pos, rep, cutmark
+        try_match:
+          if cpos > lastpos goto fail_rule
+          mfrom = cpos
+          pos = cpos
+          cutmark = 0
+          local_branch cstack, R
+          if cutmark <= -2 goto fail_cut
+          inc cpos
+          if iscont goto try_match
+        fail_rule:
+          cutmark = -2
+        fail_cut:
+          mob.'_failcut'(cutmark)
+          .return (mob)
+          goto fail_cut
+        succeed:
+          mpos = pos
+          .return (mob)
+        fail:
+          local_return cstack
+        R: # concat
+        R246: # literal
+          $I0 = pos + 6
+          if $I0 > lastpos goto fail
+          $S0 = substr target, pos, 6
+          
+          if $S0 != "thingy" goto fail
+          pos += 6
+          goto R247
+
+        R247: # action
+          $P1 = adverbs['action']
+          if null $P1 goto succeed
+          $I1 = can $P1, "thingy"
+          if $I1 == 0 goto succeed
+          mpos = pos
+          $P1."thingy"(mob)
+          goto succeed
+      .end
+
+
+
+#------------------------------#
+# The generated actions        #
+#------------------------------#
+
+
+.namespace []
+.sub "_block1000"  :anon :subid("10_1792413054.16033")
+.annotate 'file', "/root/repo/t/compilers/pct/fi5tJOv5jO.pm"
+.annotate 'line', 0
+    .const 'Sub' $P1003 = "11_1792413054.16033" 
+    capture_lex $P1003
+.annotate 'line', 1
+    $P0 = find_dynamic_lex "$*CTXSAVE"
+    if null $P0 goto ctxsave_done
+    $I0 = can $P0, "ctxsave"
+    unless $I0 goto ctxsave_done
+    $P0."ctxsave"()
+  ctxsave_done:
+.annotate 'line', 7
+    .const 'Sub' $P1003 = "11_1792413054.16033" 
+    capture_lex $P1003
+    $P101 = $P1003()
+.annotate 'line', 1
+    .return ($P101)
+    .const 'Sub' $P1021 = "15_1792413054.16033" 
+    .return ($P1021)
+.end
+
+
+.namespace []
+.sub "" :load :init :subid("post16") :outer("10_1792413054.16033")
+.annotate 'file', "/root/repo/t/compilers/pct/fi5tJOv5jO.pm"
+.annotate 'line', 0
+    .const 'Sub' $P1001 = "10_1792413054.16033" 
+    .local pmc block
+    set block, $P1001
+    $P1023 = get_root_global ["parrot"], "P6metaclass"
+    $P1023."new_class"("TestGrammar::Grammar::Actions")
+.end
+
+
+.namespace ["TestGrammar";"Grammar";"Actions"]
+.sub "_block1002"  :subid("11_1792413054.16033") :outer("10_1792413054.16033")
+.annotate 'file', "/root/repo/t/compilers/pct/fi5tJOv5jO.pm"
+.annotate 'line', 7
+    .const 'Sub' $P1012 = "13_1792413054.16033" 
+    capture_lex $P1012
+    .const 'Sub' $P1004 = "12_1792413054.16033" 
+    capture_lex $P1004
+    $P0 = find_dynamic_lex "$*CTXSAVE"
+    if null $P0 goto ctxsave_done
+    $I0 = can $P0, "ctxsave"
+    unless $I0 goto ctxsave_done
+    $P0."ctxsave"()
+  ctxsave_done:
+.annotate 'line', 15
+    .const 'Sub' $P1012 = "13_1792413054.16033" 
+    newclosure $P1016, $P1012
+.annotate 'line', 7
+    .return ($P1016)
+    .const 'Sub' $P1018 = "14_1792413054.16033" 
+    .return ($P1018)
+.end
+
+
+.namespace ["TestGrammar";"Grammar";"Actions"]
+.include "except_types.pasm"
+.sub "TOP"  :subid("12_1792413054.16033") :method :outer("11_1792413054.16033")
+    .param pmc param_1007
+.annotate 'file', "/root/repo/t/compilers/pct/fi5tJOv5jO.pm"
+.annotate 'line', 7
+    new $P1006, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1006, control_1005
+    push_eh $P1006
+    .lex "self", self
+    .lex "$/", param_1007
+.annotate 'line', 8
+    get_global $P100, "$?MY_OUR_VAR"
+    unless_null $P100, vivify_17
+    new $P100, "Undef"
+    set_global "$?MY_OUR_VAR", $P100
+  vivify_17:
+.annotate 'line', 9
+    new $P101, "Undef"
+    set $P1008, $P101
+    .lex "$past", $P1008
+.annotate 'line', 7
+    get_global $P102, "$?MY_OUR_VAR"
+.annotate 'line', 9
+    find_lex $P1009, "$/"
+    unless_null $P1009, vivify_18
+    $P1009 = root_new ['parrot';'Hash']
+  vivify_18:
+    set $P102, $P1009["thingy"]
+    unless_null $P102, vivify_19
+    new $P102, "Undef"
+  vivify_19:
+    $P103 = $P102."ast"()
+    store_lex "$past", $P103
+.annotate 'line', 10
+    find_lex $P1010, "$past"
+    unless_null $P1010, vivify_20
+    $P1010 = root_new ['parrot';'ResizablePMCArray']
+  vivify_20:
+    set $P1011, $P1010[0]
+    unless_null $P1011, vivify_21
+    $P1011 = root_new ['parrot';'ResizablePMCArray']
+  vivify_21:
+    set $P102, $P1011[0]
+    unless_null $P102, vivify_22
+    new $P102, "Undef"
+  vivify_22:
+    new $P103, "String"
+    assign $P103, "our var "
+    get_global $P104, "$?MY_OUR_VAR"
+    concat $P105, $P103, $P104
+    $P102."value"($P105)
+.annotate 'line', 12
+    find_lex $P102, "$/"
+    find_lex $P103, "$past"
+    $P104 = $P102."!make"($P103)
+.annotate 'line', 7
+    .return ($P104)
+  control_1005:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P102, exception, "payload"
+    .return ($P102)
+.end
+
+
+.namespace ["TestGrammar";"Grammar";"Actions"]
+.include "except_types.pasm"
+.sub "thingy"  :subid("13_1792413054.16033") :method :outer("11_1792413054.16033")
+    .param pmc param_1015
+.annotate 'file', "/root/repo/t/compilers/pct/fi5tJOv5jO.pm"
+.annotate 'line', 15
+    new $P1014, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1014, control_1013
+    push_eh $P1014
+    .lex "self", self
+    .lex "$/", param_1015
+.annotate 'line', 16
+    get_global $P100, "$?MY_OUR_VAR"
+    unless_null $P100, vivify_23
+    new $P100, "Undef"
+    set_global "$?MY_OUR_VAR", $P100
+  vivify_23:
+    new $P101, "String"
+    assign $P101, "was passed up"
+    set_global "$?MY_OUR_VAR", $P101
+.annotate 'line', 17
+    find_lex $P101, "$/"
+    get_hll_global $P102, ["PAST"], "Stmts"
+.annotate 'line', 18
+    get_hll_global $P103, ["PAST"], "Op"
+.annotate 'line', 19
+    get_hll_global $P104, ["PAST"], "Val"
+    $P105 = $P104."new"("will be overwritten" :named("value"), "String" :named("returns"))
+    $P106 = $P103."new"($P105, "say" :named("pirop"))
+.annotate 'line', 18
+    $P107 = $P102."new"($P106)
+.annotate 'line', 17
+    $P108 = $P101."!make"($P107)
+.annotate 'line', 15
+    .return ($P108)
+  control_1013:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["TestGrammar";"Grammar";"Actions"]
+.sub "_block1017" :load :anon :subid("14_1792413054.16033")
+.annotate 'file', "/root/repo/t/compilers/pct/fi5tJOv5jO.pm"
+.annotate 'line', 7
+    .const '' $P1019 = "11_1792413054.16033" 
+    $P100 = $P1019()
+    .return ($P100)
+.end
+
+
+.namespace []
+.sub "_block1020" :load :anon :subid("15_1792413054.16033")
+.annotate 'file', "/root/repo/t/compilers/pct/fi5tJOv5jO.pm"
+.annotate 'line', 1
+    .const '' $P1022 = "10_1792413054.16033" 
+    $P100 = $P1022()
+    .return ($P100)
+.end
+
+
+
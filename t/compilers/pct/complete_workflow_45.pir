@@ -0,0 +1,857 @@
+#------------------------------#
+# The compiler mainline code   #
+#------------------------------#
+
+.namespace [ 'TestGrammar'; 'Compiler' ]
+
+.sub 'onload' :anon :load :init
+    load_bytecode 'PCT.pbc'
+.end
+
+.sub 'main' :main
+
+    .local pmc args
+    args = new 'ResizableStringArray'
+    push args, "test_program"
+    push args, "/root/repo/t/compilers/pct/complete_workflow_sample_input.txt"
+
+    $P0 = new ['PCT'; 'HLLCompiler']
+    $P0.'language'('TestGrammar')
+    $P0.'parsegrammar'('TestGrammar::Grammar')
+    $P0.'parseactions'('TestGrammar::Grammar::Actions')
+
+    $P1 = $P0.'command_line'(args)
+
+    .return()
+.end
+
+#------------------------------#
+# The generated parser         #
+#------------------------------#
+
+      .sub '__onload' :load :init
+          .local pmc optable
+          ## namespace TestGrammar::Grammar
+          .local pmc p6meta
+          p6meta = get_root_global ['parrot'], 'P6metaclass'
+          $P0 = p6meta.'get_proto'('TestGrammar::Grammar')
+          unless null $P0 goto onload_259
+          p6meta.'new_class'('TestGrammar::Grammar', 'parent'=>'PCT::Grammar')
+        onload_259:
+          .return ()
+      .end
+
+## <TestGrammar::Grammar::TOP>
+.namespace ["TestGrammar";"Grammar"]
+      .sub "TOP" :method :nsentry 
+          .param pmc adverbs      :slurpy :named
+          .local pmc mob
+          .local string target
+          .local pmc mfrom, mpos
+          .local int cpos, iscont
+          $P0 = get_hll_global ['PGE'], '$!MATCH'
+          (mob, cpos, target, mfrom, mpos, iscont) = $P0.'new'(self, adverbs :flat :named)
+          .local int lastpos
+          lastpos = length target
+          if cpos > lastpos goto fail_rule
+          .local pmc cstack
+          cstack = root_new ['parrot';'ResizableIntegerArray']
+          .local pmc captscope, captob
+          captscope = mob
+          .local int pos, rep, cutmark
+        try_match:
+          if cpos > lastpos goto fail_rule
+          mfrom = cpos
+          pos = cpos
+          cutmark = 0
+          local_branch cstack, R
+          if cutmark <= -2 goto fail_cut
+          inc cpos
+          if iscont goto try_match
+        fail_rule:
+          cutmark = -2
+        fail_cut:
+          mob.'_failcut'(cutmark)
+          .return (mob)
+          goto fail_cut
+        succeed:
+          mpos = pos
+          .return (mob)
+        fail:
+          local_return cstack
+        fail_match:
+          cutmark = -3
+          goto fail_cut
+        R: # concat
+        R244: # subrule scope_a
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'scope_a'
+          if $I0 == 0 goto R244_1
+          $P0 = find_method mob, 'scope_a'
+          goto R244_2
+        R244_1:
+          $P0 = find_name 'scope_a'
+          unless null $P0 goto R244_2
+          die "Unable to find regex 'scope_a'"
+        R244_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'dba'=>"", 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          captscope["scope_a"] = captob
+
+          pos = $P1
+          local_branch cstack, R245
+          delete captscope["scope_a"]
+
+          goto fail
+        R245: # subrule scope_b
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'scope_b'
+          if $I0 == 0 goto R245_1
+          $P0 = find_method mob, 'scope_b'
+          goto R245_2
+        R245_1:
+          $P0 = find_name 'scope_b'
+          unless null $P0 goto R245_2
+          die "Unable to find regex 'scope_b'"
+        R245_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'dba'=>"", 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          captscope["scope_b"] = captob
+
+          pos = $P1
+          local_branch cstack, R246
+          delete captscope["scope_b"]
+
+          goto fail
+        R246: # action
+          $P1 = adverbs['action']
+          if null $P1 goto succeed
+          $I1 = can $P1, "TOP"
+          if $I1 == 0 goto succeed
+          mpos = pos
+          $P1."TOP"(mob)
+          goto succeed
+      .end
+
+## <TestGrammar::Grammar::scope_a>
+.namespace ["TestGrammar";"Grammar"]
+      .sub "scope_a" :method :nsentry 
+          .param pmc adverbs      :slurpy :named
+          .local pmc mob
+          .local string target
+          .local pmc mfrom, mpos
+          .local int cpos, iscont
+          $P0 = get_hll_global ['PGE'], '$!MATCH'
+          (mob, cpos, target, mfrom, mpos, iscont) = $P0.'new'(self, adverbs :flat :named)
+          .local int lastpos
+          lastpos = length target
+          if cpos > lastpos goto fail_rule
+          .local pmc cstack
+          cstack = root_new ['parrot';'ResizableIntegerArray']
+          .local pmc captscope, captob
+          captscope = mob
+          .local int pos, rep, cutmark
+        try_match:
+          if cpos > lastpos goto fail_rule
+          mfrom = cpos
+          pos = cpos
+          cutmark = 0
+          local_branch cstack, R
+          if cutmark <= -2 goto fail_cut
+          inc cpos
+          if iscont goto try_match
+        fail_rule:
+          cutmark = -2
+        fail_cut:
+          mob.'_failcut'(cutmark)
+          .return (mob)
+          goto fail_cut
+        succeed:
+          mpos = pos
+          .return (mob)
+        fail:
+          local_return cstack
+        fail_match:
+          cutmark = -3
+          goto fail_cut
+        R: # concat
+        R247: # subrule INIT_SCOPE_A
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'INIT_SCOPE_A'
+          if $I0 == 0 goto R247_1
+          $P0 = find_method mob, 'INIT_SCOPE_A'
+          goto R247_2
+        R247_1:
+          $P0 = find_name 'INIT_SCOPE_A'
+          unless null $P0 goto R247_2
+          die "Unable to find regex 'INIT_SCOPE_A'"
+        R247_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'dba'=>"", 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          
+          pos = $P1
+          local_branch cstack, R248
+          
+          goto fail
+        R248: # literal
+          $I0 = pos + 3
+          if $I0 > lastpos goto fail
+          $S0 = substr target, pos, 3
+          
+          if $S0 != "<a>" goto fail
+          pos += 3
+          goto R249
+
+        R249: # subrule thingy
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'thingy'
+          if $I0 == 0 goto R249_1
+          $P0 = find_method mob, 'thingy'
+          goto R249_2
+        R249_1:
+          $P0 = find_name 'thingy'
+          unless null $P0 goto R249_2
+          die "Unable to find regex 'thingy'"
+        R249_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'dba'=>"", 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          captscope["thingy"] = captob
+
+          pos = $P1
+          local_branch cstack, R250
+          delete captscope["thingy"]
+
+          goto fail
+        R250: # literal
+          $I0 = pos + 4
+          if $I0 > lastpos goto fail
+          $S0 = substr target, pos, 4
+          
+          if $S0 != "</a>" goto fail
+          pos += 4
+          goto R251
+
+        R251: # action
+          $P1 = adverbs['action']
+          if null $P1 goto succeed
+          $I1 = can $P1, "scope_a"
+          if $I1 == 0 goto succeed
+          mpos = pos
+          $P1."scope_a"(mob)
+          goto succeed
+      .end
+
+## <TestGrammar::Grammar::scope_b>
+.namespace ["TestGrammar";"Grammar"]
+      .sub "scope_b" :method :nsentry 
+          .param pmc adverbs      :slurpy :named
+          .local pmc mob
+          .local string target
+          .local pmc mfrom, mpos
+          .local int cpos, iscont
+          $P0 = get_hll_global ['PGE'], '$!MATCH'
+          (mob, cpos, target, mfrom, mpos, iscont) = $P0.'new'(self, adverbs :flat :named)
+          .local int lastpos
+          lastpos = length target
+          if cpos > lastpos goto fail_rule
+          .local pmc cstack
+          cstack = root_new ['parrot';'ResizableIntegerArray']
+          .local pmc captscope, captob
+          captscope = mob
+          .local int pos, rep, cutmark
+        try_match:
+          if cpos > lastpos goto fail_rule
+          mfrom = cpos
+          pos = cpos
+          cutmark = 0
+          local_branch cstack, R
+          if cutmark <= -2 goto fail_cut
+          inc cpos
+          if iscont goto try_match
+        fail_rule:
+          cutmark = -2
+        fail_cut:
+          mob.'_failcut'(cutmark)
+          .return (mob)
+          goto fail_cut
+        succeed:
+          mpos = pos
+          .return (mob)
+        fail:
+          local_return cstack
+        fail_match:
+          cutmark = -3
+          goto fail_cut
+        R: # concat
+        R252: # subrule INIT_SCOPE_B
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'INIT_SCOPE_B'
+          if $I0 == 0 goto R252_1
+          $P0 = find_method mob, 'INIT_SCOPE_B'
+          goto R252_2
+        R252_1:
+          $P0 = find_name 'INIT_SCOPE_B'
+          unless null $P0 goto R252_2
+          die "Unable to find regex 'INIT_SCOPE_B'"
+        R252_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'dba'=>"", 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          
+          pos = $P1
+          local_branch cstack, R253
+          
+          goto fail
+        R253: # literal
+          $I0 = pos + 3
+          if $I0 > lastpos goto fail
+          $S0 = substr target, pos, 3
+          
+          if $S0 != "<b>" goto fail
+          pos += 3
+          goto R254
+
+        R254: # subrule thingy
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'thingy'
+          if $I0 == 0 goto R254_1
+          $P0 = find_method mob, 'thingy'
+          goto R254_2
+        R254_1:
+          $P0 = find_name 'thingy'
+          unless null $P0 goto R254_2
+          die "Unable to find regex 'thingy'"
+        R254_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'dba'=>"", 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          captscope["thingy"] = captob
+
+          pos = $P1
+          local_branch cstack, R255
+          delete captscope["thingy"]
+
+          goto fail
+        R255: # literal
+          $I0 = pos + 4
+          if $I0 > lastpos goto fail
+          $S0 = substr target, pos, 4
+          
+          if $S0 != "</b>" goto fail
+          pos += 4
+          goto R256
+
+        R256: # action
+          $P1 = adverbs['action']
+          if null $P1 goto succeed
+          $I1 = can $P1, "scope_b"
+          if $I1 == 0 goto succeed
+          mpos = pos
+          $P1."scope_b"(mob)
+          goto succeed
+      .end
+
+## <TestGrammar::Grammar::INIT_SCOPE_A>
+.namespace ["TestGrammar";"Grammar"]
+      .sub "INIT_SCOPE_A" :method :nsentry 
+          .param pmc adverbs      :slurpy :named
+          .local pmc mob
+          .local string target
+          .local pmc mfrom, mpos
+          .local int cpos, iscont
+          $P0 = get_hll_global ['PGE'], '$!MATCH'
+          (mob, cpos, target, mfrom, mpos, iscont) = $P0.'new'(self, adverbs :flat :named)
+          .local int lastpos
+          lastpos = length target
+          if cpos > lastpos goto fail_rule
+          .local pmc cstack
+          cstack = root_new ['parrot';'ResizableIntegerArray']
+          .local int pos, rep, cutmark
+        try_match:
+          if cpos > lastpos goto fail_rule
+          mfrom = cpos
+          pos = cpos
+          cutmark = 0
+          local_branch cstack, R
+          if cutmark <= -2 goto fail_cut
+          inc cpos
+          if iscont goto try_match
+        fail_rule:
+          cutmark = -2
+        fail_cut:
+          mob.'_failcut'(cutmark)
+          .return (mob)
+          goto fail_cut
+        succeed:
+          mpos = pos
+          .return (mob)
+        fail:
+          local_return cstack
+        R: # action
+          $P1 = adverbs['action']
+          if null $P1 goto succeed
+          $I1 = can $P1, "INIT_SCOPE_A"
+          if $I1 == 0 goto succeed
+          mpos = pos
+          $P1."INIT_SCOPE_A"(mob)
+          goto succeed
+      .end
+
+## <TestGrammar::Grammar::INIT_SCOPE_B>
+.namespace ["TestGrammar";"Grammar"]
+      .sub "INIT_SCOPE_B" :method :nsentry 
+          .param pmc adverbs      :slurpy :named
+          .local pmc mob
+          .local string target
+          .local pmc mfrom, mpos
+          .local int cpos, iscont
+          $P0 = get_hll_global ['PGE'], '$!MATCH'
+          (mob, cpos, target, mfrom, mpos, iscont) = $P0.'new'(self, adverbs :flat :named)
+          .local int lastpos
+          lastpos = length target
+          if cpos > lastpos goto fail_rule
+          .local pmc cstack
+          cstack = root_new ['parrot';'ResizableIntegerArray']
+          .local int pos, rep, cutmark
+        try_match:
+          if cpos > lastpos goto fail_rule
+          mfrom = cpos
+          pos = cpos
+          cutmark = 0
+          local_branch cstack, R
+          if cutmark <= -2 goto fail_cut
+          inc cpos
+          if iscont goto try_match
+        fail_rule:
+          cutmark = -2
+        fail_cut:
+          mob.'_failcut'(cutmark)
+          .return (mob)
+          goto fail_cut
+        succeed:
+          mpos = pos
+          .return (mob)
+        fail:
+          local_return cstack
+        R: # action
+          $P1 = adverbs['action']
+          if null $P1 goto succeed
+          $I1 = can $P1, "INIT_SCOPE_B"
+          if $I1 == 0 goto succeed
+          mpos = pos
+          $P1."INIT_SCOPE_B"(mob)
+          goto succeed
+      .end
+
+## <TestGrammar::Grammar::thingy>
+.namespace ["TestGrammar";"Grammar"]
+      .sub "thingy" :method :nsentry 
+          .param pmc adverbs      :slurpy :named
+          .local pmc mob
+          .local string target
+          .local pmc mfrom, mpos
+          .local int cpos, iscont
+          $P0 = get_hll_global ['PGE'], '$!MATCH'
+          (mob, cpos, target, mfrom, mpos, iscont) = $P0.'new'(self, adverbs :flat :named)
+          .local int lastpos
+          lastpos = length target
+          if cpos > lastpos goto fail_rule
+          .local pmc cstack
+          cstack = root_new ['parrot';'ResizableIntegerArray']
+          .local int pos, rep, cutmark
+        try_match:
+          if cpos > lastpos goto fail_rule
+          mfrom = cpos
+          pos = cpos
+          cutmark = 0
+          local_branch cstack, R
+          if cutmark <= -2 goto fail_cut
+          inc cpos
+          if iscont goto try_match
+        fail_rule:
+          cutmark = -2
+        fail_cut:
+          mob.'_failcut'(cutmark)
+          .return (mob)
+          goto fail_cut
+        succeed:
+          mpos = pos
+          .return (mob)
+        fail:
+          local_return cstack
+        R: # concat
+        R257: # literal
+          $I0 = pos + 6
+          if $I0 > lastpos goto fail
+          $S0 = substr target, pos, 6
+          
+          if $S0 != "thingy" goto fail
+          pos += 6
+          goto R258
+
+        R258: # action
+          $P1 = adverbs['action']
+          if null $P1 goto succeed
+          $I1 = can $P1, "thingy"
+          if $I1 == 0 goto succeed
+          mpos = pos
+          $P1."thingy"(mob)
+          goto succeed
+      .end
+
+
+
+#------------------------------#
+# The generated actions        #
+#------------------------------#
+
+
+.namespace []
+.sub "_block1000"  :anon :subid("10_1792413054.36659")
+.annotate 'file', "/root/repo/t/compilers/pct/mwXGbsmnof.pm"
+.annotate 'line', 0
+    .const 'Sub' $P1003 = "11_1792413054.36659" 
+    capture_lex $P1003
+.annotate 'line', 1
+    $P0 = find_dynamic_lex "$*CTXSAVE"
+    if null $P0 goto ctxsave_done
+    $I0 = can $P0, "ctxsave"
+    unless $I0 goto ctxsave_done
+    $P0."ctxsave"()
+  ctxsave_done:
+.annotate 'line', 7
+    .const 'Sub' $P1003 = "11_1792413054.36659" 
+    capture_lex $P1003
+    $P101 = $P1003()
+.annotate 'line', 1
+    .return ($P101)
+    .const 'Sub' $P1038 = "19_1792413054.36659" 
+    .return ($P1038)
+.end
+
+
+.namespace []
+.sub "" :load :init :subid("post20") :outer("10_1792413054.36659")
+.annotate 'file', "/root/repo/t/compilers/pct/mwXGbsmnof.pm"
+.annotate 'line', 0
+    .const 'Sub' $P1001 = "10_1792413054.36659" 
+    .local pmc block
+    set block, $P1001
+    $P1040 = get_root_global ["parrot"], "P6metaclass"
+    $P1040."new_class"("TestGrammar::Grammar::Actions")
+.end
+
+
+.namespace ["TestGrammar";"Grammar";"Actions"]
+.sub "_block1002"  :subid("11_1792413054.36659") :outer("10_1792413054.36659")
+.annotate 'file', "/root/repo/t/compilers/pct/mwXGbsmnof.pm"
+.annotate 'line', 7
+    .const 'Sub' $P1029 = "17_1792413054.36659" 
+    capture_lex $P1029
+    .const 'Sub' $P1025 = "16_1792413054.36659" 
+    capture_lex $P1025
+    .const 'Sub' $P1021 = "15_1792413054.36659" 
+    capture_lex $P1021
+    .const 'Sub' $P1016 = "14_1792413054.36659" 
+    capture_lex $P1016
+    .const 'Sub' $P1011 = "13_1792413054.36659" 
+    capture_lex $P1011
+    .const 'Sub' $P1004 = "12_1792413054.36659" 
+    capture_lex $P1004
+    $P0 = find_dynamic_lex "$*CTXSAVE"
+    if null $P0 goto ctxsave_done
+    $I0 = can $P0, "ctxsave"
+    unless $I0 goto ctxsave_done
+    $P0."ctxsave"()
+  ctxsave_done:
+.annotate 'line', 31
+    .const 'Sub' $P1029 = "17_1792413054.36659" 
+    newclosure $P1033, $P1029
+.annotate 'line', 7
+    .return ($P1033)
+    .const 'Sub' $P1035 = "18_1792413054.36659" 
+    .return ($P1035)
+.end
+
+
+.namespace ["TestGrammar";"Grammar";"Actions"]
+.include "except_types.pasm"
+.sub "TOP"  :subid("12_1792413054.36659") :method :outer("11_1792413054.36659")
+    .param pmc param_1007
+.annotate 'file', "/root/repo/t/compilers/pct/mwXGbsmnof.pm"
+.annotate 'line', 7
+    new $P1006, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1006, control_1005
+    push_eh $P1006
+    .lex "self", self
+    .lex "$/", param_1007
+.annotate 'line', 8
+    new $P100, "Undef"
+    set $P1008, $P100
+    .lex "$past", $P1008
+    get_hll_global $P101, ["PAST"], "Stmts"
+    $P102 = $P101."new"()
+    store_lex "$past", $P102
+.annotate 'line', 9
+    find_lex $P101, "$past"
+    find_lex $P1009, "$/"
+    unless_null $P1009, vivify_21
+    $P1009 = root_new ['parrot';'Hash']
+  vivify_21:
+    set $P102, $P1009["scope_a"]
+    unless_null $P102, vivify_22
+    new $P102, "Undef"
+  vivify_22:
+    $P103 = $P102."ast"()
+    $P101."push"($P103)
+.annotate 'line', 10
+    find_lex $P101, "$past"
+    find_lex $P1010, "$/"
+    unless_null $P1010, vivify_23
+    $P1010 = root_new ['parrot';'Hash']
+  vivify_23:
+    set $P102, $P1010["scope_b"]
+    unless_null $P102, vivify_24
+    new $P102, "Undef"
+  vivify_24:
+    $P103 = $P102."ast"()
+    $P101."push"($P103)
+.annotate 'line', 12
+    find_lex $P101, "$/"
+    find_lex $P102, "$past"
+    $P103 = $P101."!make"($P102)
+.annotate 'line', 7
+    .return ($P103)
+  control_1005:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["TestGrammar";"Grammar";"Actions"]
+.include "except_types.pasm"
+.sub "scope_a"  :subid("13_1792413054.36659") :method :outer("11_1792413054.36659")
+    .param pmc param_1014
+.annotate 'file', "/root/repo/t/compilers/pct/mwXGbsmnof.pm"
+.annotate 'line', 15
+    new $P1013, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1013, control_1012
+    push_eh $P1013
+    .lex "self", self
+    .lex "$/", param_1014
+.annotate 'line', 16
+    find_lex $P100, "$/"
+    find_lex $P1015, "$/"
+    unless_null $P1015, vivify_25
+    $P1015 = root_new ['parrot';'Hash']
+  vivify_25:
+    set $P101, $P1015["thingy"]
+    unless_null $P101, vivify_26
+    new $P101, "Undef"
+  vivify_26:
+    $P102 = $P101."ast"()
+    $P103 = $P100."!make"($P102)
+.annotate 'line', 15
+    .return ($P103)
+  control_1012:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P100, exception, "payload"
+    .return ($P100)
+.end
+
+
+.namespace ["TestGrammar";"Grammar";"Actions"]
+.include "except_types.pasm"
+.sub "scope_b"  :subid("14_1792413054.36659") :method :outer("11_1792413054.36659")
+    .param pmc param_1019
+.annotate 'file', "/root/repo/t/compilers/pct/mwXGbsmnof.pm"
+.annotate 'line', 19
+    new $P1018, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1018, control_1017
+    push_eh $P1018
+    .lex "self", self
+    .lex "$/", param_1019
+.annotate 'line', 20
+    find_lex $P100, "$/"
+    find_lex $P1020, "$/"
+    unless_null $P1020, vivify_27
+    $P1020 = root_new ['parrot';'Hash']
+  vivify_27:
+    set $P101, $P1020["thingy"]
+    unless_null $P101, vivify_28
+    new $P101, "Undef"
+  vivify_28:
+    $P102 = $P101."ast"()
+    $P103 = $P100."!make"($P102)
+.annotate 'line', 19
+    .return ($P103)
+  control_1017:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P100, exception, "payload"
+    .return ($P100)
+.end
+
+
+.namespace ["TestGrammar";"Grammar";"Actions"]
+.include "except_types.pasm"
+.sub "INIT_SCOPE_A"  :subid("15_1792413054.36659") :method :outer("11_1792413054.36659")
+    .param pmc param_1024
+.annotate 'file', "/root/repo/t/compilers/pct/mwXGbsmnof.pm"
+.annotate 'line', 23
+    new $P1023, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1023, control_1022
+    push_eh $P1023
+    .lex "self", self
+    .lex "$/", param_1024
+.annotate 'line', 24
+    get_global $P100, "$?MY_OUR_VAR"
+    unless_null $P100, vivify_29
+    new $P100, "Undef"
+    set_global "$?MY_OUR_VAR", $P100
+  vivify_29:
+    new $P101, "String"
+    assign $P101, "scope a"
+    set_global "$?MY_OUR_VAR", $P101
+.annotate 'line', 23
+    .return ($P101)
+  control_1022:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P102, exception, "payload"
+    .return ($P102)
+.end
+
+
+.namespace ["TestGrammar";"Grammar";"Actions"]
+.include "except_types.pasm"
+.sub "INIT_SCOPE_B"  :subid("16_1792413054.36659") :method :outer("11_1792413054.36659")
+    .param pmc param_1028
+.annotate 'file', "/root/repo/t/compilers/pct/mwXGbsmnof.pm"
+.annotate 'line', 27
+    new $P1027, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1027, control_1026
+    push_eh $P1027
+    .lex "self", self
+    .lex "$/", param_1028
+.annotate 'line', 28
+    get_global $P100, "$?MY_OUR_VAR"
+    unless_null $P100, vivify_30
+    new $P100, "Undef"
+    set_global "$?MY_OUR_VAR", $P100
+  vivify_30:
+    new $P101, "String"
+    assign $P101, "scope b"
+    set_global "$?MY_OUR_VAR", $P101
+.annotate 'line', 27
+    .return ($P101)
+  control_1026:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P102, exception, "payload"
+    .return ($P102)
+.end
+
+
+.namespace ["TestGrammar";"Grammar";"Actions"]
+.include "except_types.pasm"
+.sub "thingy"  :subid("17_1792413054.36659") :method :outer("11_1792413054.36659")
+    .param pmc param_1032
+.annotate 'file', "/root/repo/t/compilers/pct/mwXGbsmnof.pm"
+.annotate 'line', 31
+    new $P1031, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1031, control_1030
+    push_eh $P1031
+    .lex "self", self
+    .lex "$/", param_1032
+.annotate 'line', 32
+    get_global $P100, "$?MY_OUR_VAR"
+    unless_null $P100, vivify_31
+    new $P100, "Undef"
+    set_global "$?MY_OUR_VAR", $P100
+  vivify_31:
+.annotate 'line', 31
+    get_global $P101, "$?MY_OUR_VAR"
+.annotate 'line', 33
+    find_lex $P101, "$/"
+    get_hll_global $P102, ["PAST"], "Op"
+.annotate 'line', 34
+    get_hll_global $P103, ["PAST"], "Val"
+.annotate 'line', 35
+    new $P104, "String"
+    assign $P104, "$?MY_OUR_VAR is in "
+    get_global $P105, "$?MY_OUR_VAR"
+    concat $P106, $P104, $P105
+.annotate 'line', 34
+    $P107 = $P103."new"($P106 :named("value"), "String" :named("returns"))
+    $P108 = $P102."new"($P107, "say" :named("pirop"))
+.annotate 'line', 33
+    $P109 = $P101."!make"($P108)
+.annotate 'line', 31
+    .return ($P109)
+  control_1030:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["TestGrammar";"Grammar";"Actions"]
+.sub "_block1034" :load :anon :subid("18_1792413054.36659")
+.annotate 'file', "/root/repo/t/compilers/pct/mwXGbsmnof.pm"
+.annotate 'line', 7
+    .const '' $P1036 = "11_1792413054.36659" 
+    $P100 = $P1036()
+    .return ($P100)
+.end
+
+
+.namespace []
+.sub "_block1037" :load :anon :subid("19_1792413054.36659")
+.annotate 'file', "/root/repo/t/compilers/pct/mwXGbsmnof.pm"
+.annotate 'line', 1
+    .const '' $P1039 = "10_1792413054.36659" 
+    $P100 = $P1039()
+    .return ($P100)
+.end
+
+
+
@@ -0,0 +1,736 @@
+#------------------------------#
+# The compiler mainline code   #
+#------------------------------#
+
+.namespace [ 'TestGrammar'; 'Compiler' ]
+
+.sub 'onload' :anon :load :init
+    load_bytecode 'PCT.pbc'
+.end
+
+.sub 'main' :main
+
+    .local pmc args
+    args = new 'ResizableStringArray'
+    push args, "test_program"
+    push args, "/root/repo/t/compilers/pct/complete_workflow_sample_input.txt"
+
+    $P0 = new ['PCT'; 'HLLCompiler']
+    $P0.'language'('TestGrammar')
+    $P0.'parsegrammar'('TestGrammar::Grammar')
+    $P0.'parseactions'('TestGrammar::Grammar::Actions')
+
+    $P1 = $P0.'command_line'(args)
+
+    .return()
+.end
+
+#------------------------------#
+# The generated parser         #
+#------------------------------#
+
+      .sub '__onload' :load :init
+          .local pmc optable
+          ## namespace TestGrammar::Grammar
+          .local pmc p6meta
+          p6meta = get_root_global ['parrot'], 'P6metaclass'
+          $P0 = p6meta.'get_proto'('TestGrammar::Grammar')
+          unless null $P0 goto onload_258
+          p6meta.'new_class'('TestGrammar::Grammar', 'parent'=>'PCT::Grammar')
+        onload_258:
+          .return ()
+      .end
+
+## <TestGrammar::Grammar::TOP>
+.namespace ["TestGrammar";"Grammar"]
+      .sub "TOP" :method :nsentry 
+          .param pmc adverbs      :slurpy :named
+          .local pmc mob
+          .local string target
+          .local pmc mfrom, mpos
+          .local int cpos, iscont
+          $P0 = get_hll_global ['PGE'], '$!MATCH'
+          (mob, cpos, target, mfrom, mpos, iscont) = $P0.'new'(self, adverbs :flat :named)
+          .local int lastpos
+          lastpos = length target
+          if cpos > lastpos goto fail_rule
+          .local pmc cstack
+          cstack = root_new ['parrot';'ResizableIntegerArray']
+          .local pmc ustack
+          ustack = root_new ['parrot';'ResizablePMCArray']
+          .local pmc gpad
+          gpad = root_new ['parrot';'ResizablePMCArray']
+          .local pmc captscope, captob
+          captscope = mob
+          .local int pos, rep, cutmark
+        try_match:
+          if cpos > lastpos goto fail_rule
+          mfrom = cpos
+          pos = cpos
+          cutmark = 0
+          local_branch cstack, R
+          if cutmark <= -2 goto fail_cut
+          inc cpos
+          if iscont goto try_match
+        fail_rule:
+          cutmark = -2
+        fail_cut:
+          mob.'_failcut'(cutmark)
+          .return (mob)
+          goto fail_cut
+        succeed:
+          mpos = pos
+          .return (mob)
+        fail:
+          local_return cstack
+        fail_match:
+          cutmark = -3
+          goto fail_cut
+        R: # concat
+        R244:  # quant 1..2147483647 (3) greedy/none
+          push gpad, 0
+          local_branch cstack, R244_repeat
+          $I0 = pop gpad
+          if cutmark != 247 goto fail
+          cutmark = 0
+          goto fail
+        R244_repeat:
+          rep = gpad[-1]
+          ### if rep >= 2147483647 goto R244_1
+          inc rep
+          gpad[-1] = rep
+          push ustack, pos
+          push ustack, rep
+          local_branch cstack, R246
+          rep = pop ustack
+          pos = pop ustack
+          if cutmark != 0 goto fail
+          dec rep
+        R244_1:
+          if rep < 1 goto fail
+          $I0 = pop gpad
+          push ustack, rep
+          local_branch cstack, R245
+          rep = pop ustack
+          push gpad, rep
+          if cutmark != 0 goto fail
+          cutmark = 247
+          goto fail
+
+        R246: # subrule thingy_or_stuff
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'thingy_or_stuff'
+          if $I0 == 0 goto R246_1
+          $P0 = find_method mob, 'thingy_or_stuff'
+          goto R246_2
+        R246_1:
+          $P0 = find_name 'thingy_or_stuff'
+          unless null $P0 goto R246_2
+          die "Unable to find regex 'thingy_or_stuff'"
+        R246_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'dba'=>"", 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          $I0 = defined captscope["thingy_or_stuff"]
+if $I0 goto R246_cgen
+$P0 = root_new ['parrot';'ResizablePMCArray']
+captscope["thingy_or_stuff"] = $P0
+local_branch cstack, R246_cgen
+delete captscope["thingy_or_stuff"]
+goto fail
+R246_cgen:
+
+          $P2 = captscope["thingy_or_stuff"]
+push $P2, captob
+          pos = $P1
+          local_branch cstack, R246_3
+          $P2 = captscope["thingy_or_stuff"]
+$P2 = pop $P2
+          goto fail
+        R246_3:
+          pos = $P1
+          $P1 = getattribute captob, '&!corou'
+          if null $P1 goto R244_repeat
+          push ustack, captob
+          local_branch cstack, R244_repeat
+          captob = pop ustack
+          if cutmark != 0 goto fail
+          captob.'next'()
+          $P1 = getattribute captob, '$.pos'
+          if $P1 >= 0 goto R246_3
+          if $P1 <= -3 goto fail_match
+          goto fail
+
+        R245: # action
+          $P1 = adverbs['action']
+          if null $P1 goto succeed
+          $I1 = can $P1, "TOP"
+          if $I1 == 0 goto succeed
+          mpos = pos
+          $P1."TOP"(mob)
+          goto succeed
+      .end
+
+## <TestGrammar::Grammar::thingy_or_stuff>
+.namespace ["TestGrammar";"Grammar"]
+      .sub "thingy_or_stuff" :method :nsentry 
+          .param pmc adverbs      :slurpy :named
+          .local pmc mob
+          .local string target
+          .local pmc mfrom, mpos
+          .local int cpos, iscont
+          $P0 = get_hll_global ['PGE'], '$!MATCH'
+          (mob, cpos, target, mfrom, mpos, iscont) = $P0.'new'(self, adverbs :flat :named)
+          .local int lastpos
+          lastpos = length target
+          if cpos > lastpos goto fail_rule
+          .local pmc cstack
+          cstack = root_new ['parrot';'ResizableIntegerArray']
+          .local pmc ustack
+          ustack = root_new ['parrot';'ResizablePMCArray']
+          .local pmc captscope, captob
+          captscope = mob
+          .local int pos, rep, cutmark
+        try_match:
+          if cpos > lastpos goto fail_rule
+          mfrom = cpos
+          pos = cpos
+          cutmark = 0
+          local_branch cstack, R
+          if cutmark <= -2 goto fail_cut
+          inc cpos
+          if iscont goto try_match
+        fail_rule:
+          cutmark = -2
+        fail_cut:
+          mob.'_failcut'(cutmark)
+          .return (mob)
+          goto fail_cut
+        succeed:
+          mpos = pos
+          .return (mob)
+        fail:
+          local_return cstack
+        fail_match:
+          cutmark = -3
+          goto fail_cut
+        R:  # alt R248, R249
+          push ustack, pos
+          local_branch cstack, R248
+          pos = pop ustack
+          if cutmark != 0 goto fail
+          goto R249
+
+        R248: # concat
+        R250: # subrule THINGY
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'THINGY'
+          if $I0 == 0 goto R250_1
+          $P0 = find_method mob, 'THINGY'
+          goto R250_2
+        R250_1:
+          $P0 = find_name 'THINGY'
+          unless null $P0 goto R250_2
+          die "Unable to find regex 'THINGY'"
+        R250_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'dba'=>"", 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          captscope["THINGY"] = captob
+
+          pos = $P1
+          local_branch cstack, R251
+          delete captscope["THINGY"]
+
+          goto fail
+        R251: # action
+          $P1 = adverbs['action']
+          if null $P1 goto succeed
+          $I1 = can $P1, "thingy_or_stuff"
+          if $I1 == 0 goto succeed
+          mpos = pos
+          $P1."thingy_or_stuff"(mob, "THINGY")
+          goto succeed
+        R249: # concat
+        R252: # subrule STUFF
+          captob = captscope
+          $P0 = getattribute captob, '$.pos'
+          $P0 = pos
+          $I0 = can mob, 'STUFF'
+          if $I0 == 0 goto R252_1
+          $P0 = find_method mob, 'STUFF'
+          goto R252_2
+        R252_1:
+          $P0 = find_name 'STUFF'
+          unless null $P0 goto R252_2
+          die "Unable to find regex 'STUFF'"
+        R252_2:
+          $P2 = adverbs['action']
+          captob = $P0(captob, 'dba'=>"", 'action'=>$P2)
+          $P1 = getattribute captob, '$.pos'
+          if $P1 <= -3 goto fail_match
+          if $P1 < 0 goto fail
+          
+          captscope["STUFF"] = captob
+
+          pos = $P1
+          local_branch cstack, R253
+          delete captscope["STUFF"]
+
+          goto fail
+        R253: # action
+          $P1 = adverbs['action']
+          if null $P1 goto succeed
+          $I1 = can $P1, "thingy_or_stuff"
+          if $I1 == 0 goto succeed
+          mpos = pos
+          $P1."thingy_or_stuff"(mob, "STUFF")
+          goto succeed
+      .end
+
+## <TestGrammar::Grammar::THINGY>
+.namespace ["TestGrammar";"Grammar"]
+      .sub "THINGY" :method :nsentry 
+          .param pmc adverbs      :slurpy :named
+          .local pmc mob
+          .local string target
+          .local pmc mfrom, mpos
+          .local int cpos, iscont
+          $P0 = get_hll_global ['PGE'], '$!MATCH'
+          (mob, cpos, target, mfrom, mpos, iscont) = $P0.'new'(self, adverbs :flat :named)
+          .local int lastpos
+          lastpos = length target
+          if cpos > lastpos goto fail_rule
+          .local pmc cstack
+          cstack = root_new ['parrot';'ResizableIntegerArray']
+          .local int pos, rep, cutmark
+        try_match:
+          if cpos > lastpos goto fail_rule
+          mfrom = cpos
+          pos = cpos
+          cutmark = 0
+          local_branch cstack, R
+          if cutmark <= -2 goto fail_cut
+          inc cpos
+          if iscont goto try_match
+        fail_rule:
+          cutmark = -2
+        fail_cut:
+          mob.'_failcut'(cutmark)
+          .return (mob)
+          goto fail_cut
+        succeed:
+          mpos = pos
+          .return (mob)
+        fail:
+          local_return cstack
+        R: # concat
+        R254: # literal
+          $I0 = pos + 6
+          if $I0 > lastpos goto fail
+          $S0 = substr target, pos, 6
+          
+          if $S0 != "thingy" goto fail
+          pos += 6
+          goto R255
+
+        R255: # action
+          $P1 = adverbs['action']
+          if null $P1 goto succeed
+          $I1 = can $P1, "THINGY"
+          if $I1 == 0 goto succeed
+          mpos = pos
+          $P1."THINGY"(mob)
+          goto succeed
+      .end
+
+## <TestGrammar::Grammar::STUFF>
+.namespace ["TestGrammar";"Grammar"]
+      .sub "STUFF" :method :nsentry 
+          .param pmc adverbs      :slurpy :named
+          .local pmc mob
+          .local string target
+          .local pmc mfrom, mpos
+          .local int cpos, iscont
+          $P0 = get_hll_global ['PGE'], '$!MATCH'
+          (mob, cpos, target, mfrom, mpos, iscont) = $P0.'new'(self, adverbs :flat :named)
+          .local int lastpos
+          lastpos = length target
+          if cpos > lastpos goto fail_rule
+          .local pmc cstack
+          cstack = root_new ['parrot';'ResizableIntegerArray']
+          .local int pos, rep, cutmark
+        try_match:
+          if cpos > lastpos goto fail_rule
+          mfrom = cpos
+          pos = cpos
+          cutmark = 0
+          local_branch cstack, R
+          if cutmark <= -2 goto fail_cut
+          inc cpos
+          if iscont goto try_match
+        fail_rule:
+          cutmark = -2
+        fail_cut:
+          mob.'_failcut'(cutmark)
+          .return (mob)
+          goto fail_cut
+        succeed:
+          mpos = pos
+          .return (mob)
+        fail:
+          local_return cstack
+        R: # concat
+        R256: # literal
+          $I0 = pos + 5
+          if $I0 > lastpos goto fail
+          $S0 = substr target, pos, 5
+          
+          if $S0 != "stuff" goto fail
+          pos += 5
+          goto R257
+
+        R257: # action
+          $P1 = adverbs['action']
+          if null $P1 goto succeed
+          $I1 = can $P1, "STUFF"
+          if $I1 == 0 goto succeed
+          mpos = pos
+          $P1."STUFF"(mob)
+          goto succeed
+      .end
+
+
+
+#------------------------------#
+# The generated actions        #
+#------------------------------#
+
+
+.namespace []
+.sub "_block1000"  :anon :subid("10_1792413054.62183")
+.annotate 'file', "/root/repo/t/compilers/pct/laLZkyY6VZ.pm"
+.annotate 'line', 0
+    .const 'Sub' $P1003 = "11_1792413054.62183" 
+    capture_lex $P1003
+.annotate 'line', 1
+    $P0 = find_dynamic_lex "$*CTXSAVE"
+    if null $P0 goto ctxsave_done
+    $I0 = can $P0, "ctxsave"
+    unless $I0 goto ctxsave_done
+    $P0."ctxsave"()
+  ctxsave_done:
+.annotate 'line', 7
+    .const 'Sub' $P1003 = "11_1792413054.62183" 
+    capture_lex $P1003
+    $P101 = $P1003()
+.annotate 'line', 1
+    .return ($P101)
+    .const 'Sub' $P1033 = "18_1792413054.62183" 
+    .return ($P1033)
+.end
+
+
+.namespace []
+.sub "" :load :init :subid("post19") :outer("10_1792413054.62183")
+.annotate 'file', "/root/repo/t/compilers/pct/laLZkyY6VZ.pm"
+.annotate 'line', 0
+    .const 'Sub' $P1001 = "10_1792413054.62183" 
+    .local pmc block
+    set block, $P1001
+    $P1035 = get_root_global ["parrot"], "P6metaclass"
+    $P1035."new_class"("TestGrammar::Grammar::Actions")
+.end
+
+
+.namespace ["TestGrammar";"Grammar";"Actions"]
+.sub "_block1002"  :subid("11_1792413054.62183") :outer("10_1792413054.62183")
+.annotate 'file', "/root/repo/t/compilers/pct/laLZkyY6VZ.pm"
+.annotate 'line', 7
+    .const 'Sub' $P1024 = "16_1792413054.62183" 
+    capture_lex $P1024
+    .const 'Sub' $P1020 = "15_1792413054.62183" 
+    capture_lex $P1020
+    .const 'Sub' $P1014 = "14_1792413054.62183" 
+    capture_lex $P1014
+    .const 'Sub' $P1004 = "12_1792413054.62183" 
+    capture_lex $P1004
+    $P0 = find_dynamic_lex "$*CTXSAVE"
+    if null $P0 goto ctxsave_done
+    $I0 = can $P0, "ctxsave"
+    unless $I0 goto ctxsave_done
+    $P0."ctxsave"()
+  ctxsave_done:
+.annotate 'line', 40
+    .const 'Sub' $P1024 = "16_1792413054.62183" 
+    newclosure $P1028, $P1024
+.annotate 'line', 7
+    .return ($P1028)
+    .const 'Sub' $P1030 = "17_1792413054.62183" 
+    .return ($P1030)
+.end
+
+
+.namespace ["TestGrammar";"Grammar";"Actions"]
+.include "except_types.pasm"
+.sub "TOP"  :subid("12_1792413054.62183") :method :outer("11_1792413054.62183")
+    .param pmc param_1007
+.annotate 'file', "/root/repo/t/compilers/pct/laLZkyY6VZ.pm"
+.annotate 'line', 7
+    .const 'Sub' $P1011 = "13_1792413054.62183" 
+    capture_lex $P1011
+    new $P1006, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1006, control_1005
+    push_eh $P1006
+    .lex "self", self
+    .lex "$/", param_1007
+.annotate 'line', 8
+    new $P100, "Undef"
+    set $P1008, $P100
+    .lex "$past", $P1008
+.annotate 'line', 13
+    get_global $P101, "$?MY_OUR_VAR"
+    unless_null $P101, vivify_20
+    new $P101, "Undef"
+    set_global "$?MY_OUR_VAR", $P101
+  vivify_20:
+.annotate 'line', 8
+    get_hll_global $P102, ["PAST"], "Stmts"
+    $P103 = $P102."new"()
+    store_lex "$past", $P103
+.annotate 'line', 9
+    find_lex $P1009, "$/"
+    unless_null $P1009, vivify_21
+    $P1009 = root_new ['parrot';'Hash']
+  vivify_21:
+    set $P103, $P1009["thingy_or_stuff"]
+    unless_null $P103, vivify_22
+    new $P103, "Undef"
+  vivify_22:
+    defined $I100, $P103
+    unless $I100, for_undef_23
+    iter $P102, $P103
+    new $P105, 'ExceptionHandler', [.CONTROL_LOOP_NEXT;.CONTROL_LOOP_REDO;.CONTROL_LOOP_LAST]
+    set_label $P105, loop1013_handler
+    push_eh $P105
+  loop1013_test:
+    unless $P102, loop1013_done
+    shift $P104, $P102
+  loop1013_redo:
+    .const 'Sub' $P1011 = "13_1792413054.62183" 
+    capture_lex $P1011
+    $P1011($P104)
+  loop1013_next:
+    goto loop1013_test
+  loop1013_handler:
+    .local pmc exception 
+    .get_results (exception) 
+    pop_upto_eh exception
+    getattribute $P106, exception, 'type'
+    eq $P106, .CONTROL_LOOP_NEXT, loop1013_next
+    eq $P106, .CONTROL_LOOP_REDO, loop1013_redo
+  loop1013_done:
+    pop_eh 
+  for_undef_23:
+.annotate 'line', 7
+    get_global $P102, "$?MY_OUR_VAR"
+.annotate 'line', 14
+    find_lex $P102, "$past"
+    get_global $P103, "$?MY_OUR_VAR"
+    $P102."unshift"($P103)
+.annotate 'line', 16
+    find_lex $P102, "$/"
+    find_lex $P103, "$past"
+    $P104 = $P102."!make"($P103)
+.annotate 'line', 7
+    .return ($P104)
+  control_1005:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P102, exception, "payload"
+    .return ($P102)
+.end
+
+
+.namespace ["TestGrammar";"Grammar";"Actions"]
+.sub "_block1010"  :anon :subid("13_1792413054.62183") :outer("12_1792413054.62183")
+    .param pmc param_1012
+.annotate 'file', "/root/repo/t/compilers/pct/laLZkyY6VZ.pm"
+.annotate 'line', 9
+    .lex "$_", param_1012
+.annotate 'line', 10
+    find_lex $P105, "$past"
+    find_lex $P106, "$_"
+    $P107 = $P106."ast"()
+    $P108 = $P105."push"($P107)
+.annotate 'line', 9
+    .return ($P108)
+.end
+
+
+.namespace ["TestGrammar";"Grammar";"Actions"]
+.include "except_types.pasm"
+.sub "thingy_or_stuff"  :subid("14_1792413054.62183") :method :outer("11_1792413054.62183")
+    .param pmc param_1017
+    .param pmc param_1018
+.annotate 'file', "/root/repo/t/compilers/pct/laLZkyY6VZ.pm"
+.annotate 'line', 19
+    new $P1016, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1016, control_1015
+    push_eh $P1016
+    .lex "self", self
+    .lex "$/", param_1017
+    .lex "$key", param_1018
+.annotate 'line', 20
+    find_lex $P100, "$/"
+    find_lex $P101, "$key"
+    find_lex $P1019, "$/"
+    unless_null $P1019, vivify_24
+    $P1019 = root_new ['parrot';'Hash']
+  vivify_24:
+    set $P102, $P1019[$P101]
+    unless_null $P102, vivify_25
+    new $P102, "Undef"
+  vivify_25:
+    $P103 = $P102."ast"()
+    $P104 = $P100."!make"($P103)
+.annotate 'line', 19
+    .return ($P104)
+  control_1015:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P100, exception, "payload"
+    .return ($P100)
+.end
+
+
+.namespace ["TestGrammar";"Grammar";"Actions"]
+.include "except_types.pasm"
+.sub "THINGY"  :subid("15_1792413054.62183") :method :outer("11_1792413054.62183")
+    .param pmc param_1023
+.annotate 'file', "/root/repo/t/compilers/pct/laLZkyY6VZ.pm"
+.annotate 'line', 23
+    new $P1022, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1022, control_1021
+    push_eh $P1022
+    .lex "self", self
+    .lex "$/", param_1023
+.annotate 'line', 24
+    get_global $P100, "$?MY_OUR_VAR"
+    unless_null $P100, vivify_26
+    new $P100, "Undef"
+    set_global "$?MY_OUR_VAR", $P100
+  vivify_26:
+    get_hll_global $P101, ["PAST"], "Op"
+.annotate 'line', 25
+    get_hll_global $P102, ["PAST"], "Val"
+    $P103 = $P102."new"("$?MY_OUR_VAR was set in THINGY" :named("value"), "String" :named("returns"))
+    $P104 = $P101."new"($P103, "say" :named("pirop"))
+.annotate 'line', 24
+    set_global "$?MY_OUR_VAR", $P104
+.annotate 'line', 31
+    find_lex $P101, "$/"
+    get_hll_global $P102, ["PAST"], "Op"
+.annotate 'line', 32
+    get_hll_global $P103, ["PAST"], "Val"
+.annotate 'line', 33
+    new $P104, "String"
+    assign $P104, "matched: "
+    find_lex $P105, "$/"
+    set $S100, $P105
+    concat $P106, $P104, $S100
+.annotate 'line', 32
+    $P107 = $P103."new"($P106 :named("value"), "String" :named("returns"))
+    $P108 = $P102."new"($P107, "say" :named("pirop"))
+.annotate 'line', 31
+    $P109 = $P101."!make"($P108)
+.annotate 'line', 23
+    .return ($P109)
+  control_1021:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["TestGrammar";"Grammar";"Actions"]
+.include "except_types.pasm"
+.sub "STUFF"  :subid("16_1792413054.62183") :method :outer("11_1792413054.62183")
+    .param pmc param_1027
+.annotate 'file', "/root/repo/t/compilers/pct/laLZkyY6VZ.pm"
+.annotate 'line', 40
+    new $P1026, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1026, control_1025
+    push_eh $P1026
+    .lex "self", self
+    .lex "$/", param_1027
+.annotate 'line', 41
+    get_global $P100, "$?MY_OUR_VAR"
+    unless_null $P100, vivify_27
+    new $P100, "Undef"
+    set_global "$?MY_OUR_VAR", $P100
+  vivify_27:
+    get_hll_global $P101, ["PAST"], "Op"
+.annotate 'line', 42
+    get_hll_global $P102, ["PAST"], "Val"
+    $P103 = $P102."new"("$?MY_OUR_VAR was set in THINGY" :named("value"), "String" :named("returns"))
+    $P104 = $P101."new"($P103, "say" :named("pirop"))
+.annotate 'line', 41
+    set_global "$?MY_OUR_VAR", $P104
+.annotate 'line', 48
+    find_lex $P101, "$/"
+    get_hll_global $P102, ["PAST"], "Op"
+.annotate 'line', 49
+    get_hll_global $P103, ["PAST"], "Val"
+.annotate 'line', 50
+    new $P104, "String"
+    assign $P104, "matched: "
+    find_lex $P105, "$/"
+    set $S100, $P105
+    concat $P106, $P104, $S100
+.annotate 'line', 49
+    $P107 = $P103."new"($P106 :named("value"), "String" :named("returns"))
+    $P108 = $P102."new"($P107, "say" :named("pirop"))
+.annotate 'line', 48
+    $P109 = $P101."!make"($P108)
+.annotate 'line', 40
+    .return ($P109)
+  control_1025:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["TestGrammar";"Grammar";"Actions"]
+.sub "_block1029" :load :anon :subid("17_1792413054.62183")
+.annotate 'file', "/root/repo/t/compilers/pct/laLZkyY6VZ.pm"
+.annotate 'line', 7
+    .const '' $P1031 = "11_1792413054.62183" 
+    $P100 = $P1031()
+    .return ($P100)
+.end
+
+
+.namespace []
+.sub "_block1032" :load :anon :subid("18_1792413054.62183")
+.annotate 'file', "/root/repo/t/compilers/pct/laLZkyY6VZ.pm"
+.annotate 'line', 1
+    .const '' $P1034 = "10_1792413054.62183" 
+    $P100 = $P1034()
+    .return ($P100)
+.end
+
+
+
@@ -0,0 +1,227 @@
+#------------------------------#
+# The compiler mainline code   #
+#------------------------------#
+
+.namespace [ 'TestGrammar'; 'Compiler' ]
+
+.sub 'onload' :anon :load :init
+    load_bytecode 'PCT.pbc'
+.end
+
+.sub 'main' :main
+
+    .local pmc args
+    args = new 'ResizableStringArray'
+    push args, "test_program"
+    push args, "/root/repo/t/compilers/pct/complete_workflow_sample_input.txt"
+
+    $P0 = new ['PCT'; 'HLLCompiler']
+    $P0.'language'('TestGrammar')
+    $P0.'parsegrammar'('TestGrammar::Grammar')
+    $P0.'parseactions'('TestGrammar::Grammar::Actions')
+
+    $P1 = $P0.'command_line'(args)
+
+    .return()
+.end
+
+#------------------------------#
+# The generated parser         #
+#------------------------------#
+
+      .sub '__onload' :load :init
+          .local pmc optable
+          ## namespace TestGrammar::Grammar
+          .local pmc p6meta
+          p6meta = get_root_global ['parrot'], 'P6metaclass'
+          $P0 = p6meta.'get_proto'('TestGrammar::Grammar')
+          unless null $P0 goto onload_246
+          p6meta.'new_class'('TestGrammar::Grammar', 'parent'=>'PCT::Grammar')
+        onload_246:
+          .return ()
+      .end
+
+## <TestGrammar::Grammar::TOP>
+.namespace ["TestGrammar";"Grammar"]
+      .sub "TOP" :method :nsentry 
+          .param pmc adverbs      :slurpy :named
+          .local pmc mob
+          .local string target
+          .local pmc mfrom, mpos
+          .local int cpos, iscont
+          $P0 = get_hll_global ['PGE'], '$!MATCH'
+          (mob, cpos, target, mfrom, mpos, iscont) = $P0.'new'(self, adverbs :flat :named)
+          .local int lastpos
+          lastpos = length target
+          if cpos > lastpos goto fail_rule
+          .local pmc cstack
+          cstack = root_new ['parrot';'ResizableIntegerArray']
+          .local int pos, rep, cutmark
+        try_match:
+          if cpos > lastpos goto fail_rule
+          mfrom = cpos
+          pos = cpos
+          cutmark = 0
+          local_branch cstack, R
+          if cutmark <= -2 goto fail_cut
+          inc cpos
+          if iscont goto try_match
+        fail_rule:
+          cutmark = -2
+        fail_cut:
+          mob.'_failcut'(cutmark)
+          .return (mob)
+          goto fail_cut
+        succeed:
+          mpos = pos
+          .return (mob)
+        fail:
+          local_return cstack
+        R: # concat
+        R244: # literal
+          $I0 = pos + 6
+          if $I0 > lastpos goto fail
+          $S0 = substr target, pos, 6
+          
+          if $S0 != "thingy" goto fail
+          pos += 6
+          goto R245
+
+        R245: # action
+          $P1 = adverbs['action']
+          if null $P1 goto succeed
+          $I1 = can $P1, "TOP"
+          if $I1 == 0 goto succeed
+          mpos = pos
+          $P1."TOP"(mob)
+          goto succeed
+      .end
+
+
+
+#------------------------------#
+# The generated actions        #
+#------------------------------#
+
+
+.namespace []
+.sub "_block1000"  :anon :subid("10_1792413053.57454")
+.annotate 'file', "/root/repo/t/compilers/pct/71zVLFmftJ.pm"
+.annotate 'line', 0
+    .const 'Sub' $P1003 = "11_1792413053.57454" 
+    capture_lex $P1003
+.annotate 'line', 1
+    $P0 = find_dynamic_lex "$*CTXSAVE"
+    if null $P0 goto ctxsave_done
+    $I0 = can $P0, "ctxsave"
+    unless $I0 goto ctxsave_done
+    $P0."ctxsave"()
+  ctxsave_done:
+.annotate 'line', 7
+    .const 'Sub' $P1003 = "11_1792413053.57454" 
+    capture_lex $P1003
+    $P101 = $P1003()
+.annotate 'line', 1
+    .return ($P101)
+    .const 'Sub' $P1014 = "14_1792413053.57454" 
+    .return ($P1014)
+.end
+
+
+.namespace []
+.sub "" :load :init :subid("post15") :outer("10_1792413053.57454")
+.annotate 'file', "/root/repo/t/compilers/pct/71zVLFmftJ.pm"
+.annotate 'line', 0
+    .const 'Sub' $P1001 = "10_1792413053.57454" 
+    .local pmc block
+    set block, $P1001
+    $P1016 = get_root_global ["parrot"], "P6metaclass"
+    $P1016."new_class"("TestGrammar::Grammar::Actions")
+.end
+
+
+.namespace ["TestGrammar";"Grammar";"Actions"]
+.sub "_block1002"  :subid("11_1792413053.57454") :outer("10_1792413053.57454")
+.annotate 'file', "/root/repo/t/compilers/pct/71zVLFmftJ.pm"
+.annotate 'line', 7
+    .const 'Sub' $P1004 = "12_1792413053.57454" 
+    capture_lex $P1004
+    $P0 = find_dynamic_lex "$*CTXSAVE"
+    if null $P0 goto ctxsave_done
+    $I0 = can $P0, "ctxsave"
+    unless $I0 goto ctxsave_done
+    $P0."ctxsave"()
+  ctxsave_done:
+    .const 'Sub' $P1004 = "12_1792413053.57454" 
+    newclosure $P1009, $P1004
+    .return ($P1009)
+    .const 'Sub' $P1011 = "13_1792413053.57454" 
+    .return ($P1011)
+.end
+
+
+.namespace ["TestGrammar";"Grammar";"Actions"]
+.include "except_types.pasm"
+.sub "TOP"  :subid("12_1792413053.57454") :method :outer("11_1792413053.57454")
+    .param pmc param_1007
+.annotate 'file', "/root/repo/t/compilers/pct/71zVLFmftJ.pm"
+.annotate 'line', 7
+    new $P1006, 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label $P1006, control_1005
+    push_eh $P1006
+    .lex "self", self
+    .lex "$/", param_1007
+.annotate 'line', 8
+    new $P100, "Undef"
+    set $P1008, $P100
+    .lex "$past", $P1008
+    get_hll_global $P101, ["PAST"], "Stmts"
+.annotate 'line', 9
+    get_hll_global $P102, ["PAST"], "Op"
+.annotate 'line', 10
+    get_hll_global $P103, ["PAST"], "Val"
+.annotate 'line', 11
+    find_lex $P104, "$/"
+    set $S100, $P104
+.annotate 'line', 10
+    $P105 = $P103."new"($S100 :named("value"), "String" :named("returns"))
+    $P106 = $P102."new"($P105, "say" :named("pirop"))
+.annotate 'line', 9
+    $P107 = $P101."new"($P106)
+.annotate 'line', 8
+    store_lex "$past", $P107
+.annotate 'line', 18
+    find_lex $P101, "$/"
+    find_lex $P102, "$past"
+    $P103 = $P101."!make"($P102)
+.annotate 'line', 7
+    .return ($P103)
+  control_1005:
+    .local pmc exception 
+    .get_results (exception) 
+    getattribute $P101, exception, "payload"
+    .return ($P101)
+.end
+
+
+.namespace ["TestGrammar";"Grammar";"Actions"]
+.sub "_block1010" :load :anon :subid("13_1792413053.57454")
+.annotate 'file', "/root/repo/t/compilers/pct/71zVLFmftJ.pm"
+.annotate 'line', 7
+    .const '' $P1012 = "11_1792413053.57454" 
+    $P100 = $P1012()
+    .return ($P100)
+.end
+
+
+.namespace []
+.sub "_block1013" :load :anon :subid("14_1792413053.57454")
+.annotate 'file', "/root/repo/t/compilers/pct/71zVLFmftJ.pm"
+.annotate 'line', 1
+    .const '' $P1015 = "10_1792413053.57454" 
+    $P100 = $P1015()
+    .return ($P100)
+.end
+
+
+
@@ -0,0 +1,9 @@
+.sub _main :main
+    load_bytecode 'PCT.pbc'
+    load_bytecode 'dumper.pbc'
+    .local pmc node
+    node = new ['PAST';'Block']
+    node.'blocktype'('declaration')
+    "_dumper"(node, "ast")
+    .return ()
+.end
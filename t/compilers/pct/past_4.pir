@@ -0,0 +1,16 @@
+.sub _main :main
+    load_bytecode 'PCT.pbc'
+    load_bytecode 'dumper.pbc'
+    .local pmc node
+    .local pmc node2
+    node = new ['PAST';'Op']
+    node2 = new ['PAST';'Op']
+    node.'init'('name' => 'foo')
+    node2.'init'('name' => 'bar')
+    node.'push'(node2)
+
+    $P1 = node.'name'()
+    say $P1
+    "_dumper"(node, "ast")
+    .return ()
+.end
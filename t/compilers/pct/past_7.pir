@@ -0,0 +1,14 @@
+.sub _main :main
+    load_bytecode 'PCT.pbc'
+    load_bytecode 'dumper.pbc'
+    .local pmc node
+    node = new ['PAST';'Val']
+    node.'value'(1)
+    node.'returns'('Integer')
+    $P1 = node.'value'()
+    say $P1
+    $P1 = node.'returns'()
+    say $P1
+    "_dumper"(node, "ast")
+    .return ()
+.end
@@ -0,0 +1,11 @@
+.sub _main :main
+    load_bytecode 'PCT.pbc'
+    load_bytecode 'dumper.pbc'
+    .local pmc node
+    node = new ['PAST';'Var']
+    node.'scope'('foo')
+    node.'viviself'('baz')
+    node.'lvalue'('buz')
+    "_dumper"(node, "ast")
+    .return ()
+.end
@@ -0,0 +1,12 @@
+.sub _main :main
+    load_bytecode 'PCT.pbc'
+    load_bytecode 'dumper.pbc'
+    .local pmc node
+    node = new ['PAST';'Op']
+    node.'pasttype'('pirop')
+    node.'pirop'('add')
+    node.'lvalue'('foo')
+    node.'inline'('%r = add %0, %1')
+    "_dumper"(node, "ast")
+    .return ()
+.end
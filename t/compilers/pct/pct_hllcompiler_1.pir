@@ -0,0 +1,22 @@
+
+.sub _main :main
+    load_bytecode 'PCT/HLLCompiler.pbc'
+    $P0 = new ['PCT';'HLLCompiler']
+
+    # parse_name method
+    $P1 = $P0.'parse_name'('None::Module')
+    $S1 = $P1[0]
+    say $S1
+    $S1 = $P1[1]
+    say $S1
+
+    $P0.'parsegrammar'('None::Parser')
+    $S1 = $P0.'parsegrammar'()
+    say $S1
+
+    $P0.'astgrammar'('None::Grammar')
+    $S1 = $P0.'astgrammar'()
+    say $S1
+
+    end
+.end
@@ -0,0 +1,76 @@
+
+.namespace [ 'NoneParser' ]
+
+.sub 'TOP'
+    .param string source
+    .param pmc options         :slurpy :named
+    .return (source)
+.end
+
+.namespace [ 'NoneBuilder' ]
+
+.sub 'init' :anon :load :init
+    load_bytecode 'P6object.pbc'
+    $P0 = get_hll_global 'P6metaclass'
+    $P1 = $P0.'new_class'('NoneBuilder', 'attr' => 'text')
+.end
+
+.sub 'get' :method
+    .param string stage
+
+    $P0 = new ['PAST';'Op']
+    $P0.'pasttype'('inline')
+    $P0.'inline'("print %0\nprint \"\\n\"")
+
+    $P2 = getattribute self, "text"
+    $P1 = new ['PAST';'Val']
+    $P1.'value'($P2)
+
+    $P0.'push'($P1)
+
+    .return ($P0)
+.end
+
+.sub 'text' :method
+    .param pmc word
+    setattribute self, 'text', word
+.end
+
+.namespace [ 'NoneGrammar' ]
+
+.sub 'init' :anon :load :init
+    load_bytecode 'P6object.pbc'
+    $P0 = get_hll_global 'P6metaclass'
+    $P1 = $P0.'new_class'('NoneGrammar')
+.end
+
+.sub 'apply' :method
+    .param pmc source
+
+    $P0 = new 'NoneBuilder'
+    $P0.'text'(source)
+
+    .return ($P0)
+.end
+
+.namespace [ 'None';'Compiler' ]
+
+.sub _main :main
+    load_bytecode 'PCT.pbc'
+
+    $P0 = new ['PCT';'HLLCompiler']
+    $P0.'language'('None')
+    $P0.'parsegrammar'('NoneParser')
+    $P0.'astgrammar'('NoneGrammar')
+
+    .local pmc args
+    args = new 'ResizableStringArray'
+    push args, "command"
+    push args, "-e"
+    push args, "thingy"
+    $P1 = $P0.'command_line'(args)
+
+    .return()
+.end
+
+
@@ -0,0 +1,12 @@
+.sub _main :main
+    load_bytecode 'PCT/HLLCompiler.pbc'
+
+    .local pmc hllcompiler
+    hllcompiler = new ['PCT';'HLLCompiler']
+
+    $P0 = getattribute hllcompiler, "@stages"
+    $S0 = join " ", $P0
+    say $S0
+    .return()
+.end
+
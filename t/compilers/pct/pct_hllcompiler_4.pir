@@ -0,0 +1,18 @@
+.sub _main :main
+    load_bytecode 'PCT/HLLCompiler.pbc'
+
+    .local pmc hllcompiler
+    hllcompiler = new ['PCT';'HLLCompiler']
+
+    hllcompiler.'removestage'('parse')
+    hllcompiler.'addstage'('foo')
+    hllcompiler.'addstage'('bar', 'before' => 'evalpmc')
+    hllcompiler.'addstage'('optimize', 'after' => 'past')
+    hllcompiler.'addstage'('optimize', 'after' => 'post')
+    hllcompiler.'addstage'('peel', 'after' => 'optimize')
+    $P0 = getattribute hllcompiler, "@stages"
+    $S0 = join " ", $P0
+    say $S0
+    .return()
+.end
+
@@ -0,0 +1,32 @@
+.namespace []
+
+.sub main :main
+    load_bytecode 'PCT.pbc'
+    .local pmc h, source, dest
+    h = new ['PCT';'HLLCompiler']
+
+    $P0 = new 'NameSpace'
+    set_hll_global ['Omg'], 'Lol', $P0
+
+    source = get_hll_namespace ['Foo';'Bar']
+    dest = get_hll_namespace ['Omg';'Lol']
+
+    h.'EXPORTALL'(source,dest)
+
+    $P0 = get_hll_global ['Omg';'Lol'], 'hi'
+    $P0()
+    $P0 = get_hll_global ['Omg';'Lol'], 'lol'
+    $P0()
+.end
+
+.namespace ['Foo';'Bar';'EXPORT';'ALL']
+
+.sub 'lol'
+    say 'omgwtf!'
+.end
+
+.sub 'hi'
+    say 'hello world!'
+.end
+
+
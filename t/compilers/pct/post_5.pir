@@ -0,0 +1,11 @@
+.sub _main :main
+    load_bytecode 'PCT.pbc'
+    load_bytecode 'dumper.pbc'
+    .local pmc node
+    node = new ['POST';'Op']
+    node.'pirop'('add')
+    node.'result'('$P1')
+    node.'inline'('%r=1')
+    "_dumper"(node, "ost")
+    .return ()
+.end
@@ -0,0 +1,9 @@
+.sub _main :main
+    load_bytecode 'PCT.pbc'
+    load_bytecode 'dumper.pbc'
+    .local pmc node
+    node = new ['POST';'Label']
+    node.'name'('labeler')
+    "_dumper"(node, "ost")
+    .return ()
+.end
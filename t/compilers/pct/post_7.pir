@@ -0,0 +1,21 @@
+.sub _main :main
+    load_bytecode 'PCT.pbc'
+    load_bytecode 'dumper.pbc'
+    .local pmc node
+    node = new ['POST';'Sub']
+    node.'name'('foo')
+    $P0 = new ['ResizablePMCArray']
+    push $P0, "_"
+    push $P0, "Foo"
+    $P1 = new ['ResizableStringArray']
+    push $P1, "Bar"
+    push $P1, "Baz"
+    push $P0, $P1
+    node.'multi'($P0)
+
+    .local pmc compiler
+    compiler = new ['POST';'Compiler']
+    $S0 = compiler.'to_pir'(node)
+    say $S0
+    .return ()
+.end
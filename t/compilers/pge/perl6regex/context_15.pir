@@ -0,0 +1,30 @@
+.sub 'main' :main
+    load_bytecode "PGE.pbc"
+    load_bytecode "dumper.pbc"
+    load_bytecode "PGE/Dumper.pbc"
+    load_bytecode "PGE/Glob.pbc"
+    load_bytecode "PGE/Text.pbc"
+    .local string target, pattern
+    .local pmc perl6regex, rulesub, pir, match
+    perl6regex = compreg 'PGE::Perl6Regex'
+    null match
+    null rulesub
+        rulesub = perl6regex('$<A>:=(.)(b)$<C>:=(c)')
+        match = rulesub('abc')
+        .local string res
+        res = match['A']
+        print res
+        $P0 = match[0]
+        res = $P0
+        print res
+        res = match['C']
+        print res
+        goto END
+    goto OK
+NOK:
+    print "not "
+OK:
+    print "ok"
+END:
+        print "\n"
+.end
@@ -0,0 +1,44 @@
+.sub 'main' :main
+    load_bytecode "PGE.pbc"
+    load_bytecode "dumper.pbc"
+    load_bytecode "PGE/Dumper.pbc"
+    load_bytecode "PGE/Glob.pbc"
+    load_bytecode "PGE/Text.pbc"
+    .local string target, pattern
+    .local pmc perl6regex, rulesub, pir, match
+    perl6regex = compreg 'PGE::Perl6Regex'
+    null match
+    null rulesub
+        rulesub = perl6regex('(a)(b)(c)')
+        match = rulesub('abc')
+
+        .local int isa_match
+
+        $S0 = match
+        print $S0
+        print "\n"
+
+        isa_match = isa match, ['PGE';'Match']
+        if isa_match goto OK1
+        print "not "
+OK1:print "ok 1\n"
+
+        $P0 = match[1]
+
+        $S0 = $P0
+        print $S0
+        print "\n"
+
+        isa_match = isa $P0, ['PGE';'Match']
+        if isa_match goto OK2
+        print "not "
+OK2:print "ok 2\n"
+        goto END
+    goto OK
+NOK:
+    print "not "
+OK:
+    print "ok"
+END:
+        print "\n"
+.end
@@ -0,0 +1,7 @@
+.sub 'main' :main
+        load_bytecode 'PGE.pbc'
+        goto OK
+NOK:print "not "
+OK: print "ok"
+END:print "\n"
+.end
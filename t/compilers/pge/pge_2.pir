@@ -0,0 +1,8 @@
+.sub 'main' :main
+        load_bytecode 'PGE.pbc'
+        load_bytecode 'PGE.pbc'
+        goto OK
+NOK:print "not "
+OK: print "ok"
+END:print "\n"
+.end
@@ -0,0 +1,9 @@
+.sub 'main' :main
+        load_bytecode 'PGE.pbc'
+        .local pmc sub
+        sub = get_global ['PGE::Match'], 'before'
+        goto OK
+NOK:print "not "
+OK: print "ok"
+END:print "\n"
+.end
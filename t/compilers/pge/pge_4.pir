@@ -0,0 +1,8 @@
+.sub 'main' :main
+        load_bytecode 'PGE.pbc'
+        $P0 = compreg 'PGE::Perl6Regex'
+        goto OK
+NOK:print "not "
+OK: print "ok"
+END:print "\n"
+.end
@@ -0,0 +1,8 @@
+.sub 'main' :main
+        load_bytecode 'PGE.pbc'
+        $P0 = compreg 'PGE::Glob'
+        goto OK
+NOK:print "not "
+OK: print "ok"
+END:print "\n"
+.end
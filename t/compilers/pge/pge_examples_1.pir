@@ -0,0 +1,24 @@
+
+.sub 'test' :main
+  load_bytecode "PGE.pbc"
+
+  .local pmc p6rule
+  p6rule = compreg "PGE::Perl6Regex"
+
+  .local pmc rulesub_a, rulesub_b
+  rulesub_a  = p6rule( "a" )
+  rulesub_b  = p6rule( "^(<[b]>)" )
+
+  .local string input_string
+  input_string    = "_____________________________________________________________________"
+
+  rulesub_b( input_string )
+
+  print "ok1\n"
+  # end
+
+  rulesub_a( input_string )
+  print "ok2\n"
+
+.end
+
@@ -0,0 +1,54 @@
+
+# Grok fasta files, which usually contain DNA, RNA or protein sequences.
+# http://en.wikipedia.org/wiki/FASTA_format
+
+.sub "example" :main
+    load_bytecode 'PGE.pbc'
+    load_bytecode 'PGE/Perl6Grammar.pbc'
+
+    .local string fasta_grammar
+    fasta_grammar = <<'END_FASTA_GRAMMAR'
+grammar Bio::Fasta;
+
+regex databank    { <Bio::Fasta::entry>+ }
+regex entry       { <Bio::Fasta::desc_line> \n <Bio::Fasta::sequence> }
+regex desc_line   { <Bio::Fasta::start_entry> <Bio::Fasta::id> \s+ <Bio::Fasta::desc> }
+regex start_entry { \> }
+regex id          { (\S+) }
+regex desc        { (\N*) }
+regex sequence    { (<-[>]>*) }
+
+END_FASTA_GRAMMAR
+
+    .local string fasta
+    fasta = <<'END_FASTA'
+>gi|5524211|gb|AAD44166.1| cytochrome b [Elephas maximus maximus]
+LCLYTHIGRNIYYGSYLYSETWNTGIMLLLITMATAFMGYVLPWGQMSFWGATVITNLFSAIPYIGTNLV
+EWIWGGFSVDKATLNRFFAFHFILPFTMVALAGVHLTFLHETGSNNPLGLTSDSDKIPFHPYYTIKDFLG
+LLILILLLLLLALLSPDMLGDPDNHMPADPLNTPLHIKPEWYFLFAYAILRSVPNKLGGVLALFLSIVIL
+GLMPFLHTSKHRSMMLRPLSQALFWTLTMDLLTLTWIGSQPVEYPYTIIGQMASILYFSIILAFLPIAGX
+IENY
+>poly_a teasing the parser with DNA
+aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa
+END_FASTA
+
+    .local pmc p6grammar
+    p6grammar = compreg "PGE::Perl6Grammar"
+    .local pmc code
+    ( code ) = p6grammar.'compile'(fasta_grammar, 'target'=>'PIR')
+    $P0 = compreg 'PIR'
+    $P1 = $P0(code)
+    $P1 = $P1.'first_sub_in_const_table'()
+    $P1()
+    # print code
+
+    .local pmc fasta_rule
+    fasta_rule = get_global ['Bio';'Fasta'], "databank"
+    .local pmc match
+    ( match ) = fasta_rule( fasta )
+
+    # TODO: Extract named or positional captures
+    print match
+
+.end
+
@@ -0,0 +1,26 @@
+
+        .sub _PGE_Test :main
+            .local pmc glob_compile
+            load_bytecode "PGE.pbc"
+            load_bytecode "PGE/Glob.pbc"
+            load_bytecode "PGE/Text.pbc"
+            glob_compile = compreg "PGE::Glob"
+
+            .local string target
+            .local string pattern
+            .local pmc rulesub
+            .local pmc match
+            .local pmc code
+            .local pmc exp
+            target = unicode:"ana"
+            pattern = "?n?*"
+            rulesub = glob_compile.'compile'(pattern)
+            match = rulesub(target)
+            unless match goto match_fail
+          match_success:
+            print "matched"
+            goto match_end
+          match_fail:
+            print "failed"
+          match_end:
+        .end
@@ -0,0 +1,78 @@
+
+.sub _main :main
+  load_bytecode "PGE.pbc"
+  load_bytecode "PGE/Glob.pbc"
+
+  .local pmc rule, globc
+  globc = compreg "PGE::Glob"
+  rule = globc.'compile'("{app,bet,cod}a")
+
+  $P1 = rule("appa")
+  if $P1 goto ok1
+  print "not "
+ok1:
+  print "ok1\n"
+
+  $P1 = rule("coda")
+  if $P1 goto ok2
+  print "not "
+ok2:
+  print "ok2\n"
+
+  $P1 = rule("beta")
+  if $P1 goto ok3
+  print "not "
+ok3:
+  print "ok3\n"
+
+  $P1 = rule("bet")
+  unless $P1 goto ok4
+  print "not "
+ok4:
+  print "ok4\n"
+
+  $P1 = rule("alfa")
+  unless $P1 goto ok5
+  print "not "
+ok5:
+  print "ok5\n"
+
+  rule = globc.'compile'("*{1,two,three}")
+
+  $P1 = rule("1")
+  if $P1 goto ok6
+  print "not "
+ok6:
+  print "ok6\n"
+
+  $P1 = rule("ptwo")
+  if $P1 goto ok7
+  print "not "
+ok7:
+  print "ok7\n"
+
+  $P1 = rule("al")
+  unless $P1 goto ok8
+  print "not "
+ok8:
+  print "ok8\n"
+
+  $P1 = rule("three")
+  if $P1 goto ok9
+  print "not "
+ok9:
+  print "ok9\n"
+
+  $P1 = rule("twop")
+  unless $P1 goto ok10
+  print "not "
+ok10:
+  print "ok10\n"
+
+  $P1 = rule("1atwo")
+  if $P1 goto ok11
+  print "not "
+ok11:
+  print "ok11\n"
+
+.end
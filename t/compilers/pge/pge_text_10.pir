@@ -0,0 +1,30 @@
+
+        .sub _PGE_Test :main
+            .local pmc p6rule_compile
+            load_bytecode "PGE.pbc"
+            load_bytecode "PGE/Dumper.pir"
+            load_bytecode "PGE/Text.pir"
+            load_bytecode "PGE/Util.pir"
+            p6rule_compile = compreg "PGE::Perl6Regex"
+
+            .local string target
+            .local string pattern
+            .local pmc rulesub
+            .local pmc match
+            target = "{ balanced nested [ with ] and ( is } okay"
+            pattern = "^<PGE::Text::bracketed: {}[]\"`>"
+            rulesub = p6rule_compile(pattern)
+            if_null rulesub, rule_fail
+            match = rulesub(target)
+            unless match goto match_fail
+          match_success:
+            print "matched"
+            
+            goto end
+          match_fail:
+            print "failed"
+            goto end
+          rule_fail:
+            print "rule error"
+          end:
+        .end
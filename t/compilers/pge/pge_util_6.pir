@@ -0,0 +1,16 @@
+
+.sub main :main
+  load_bytecode 'PGE.pbc'
+  load_bytecode 'PGE/Util.pbc'
+
+  .local pmc split, p6rule, regex
+  split  = get_global ['PGE';'Util'], 'split'
+  p6rule = compreg 'PGE::Perl6Regex'
+  regex  = p6rule('\:')
+
+  $P0 = split(regex, "Foo::Bar")
+  $S0 = join "\n", $P0
+  print $S0
+  print "\n"
+.end
+
@@ -0,0 +1,11 @@
+.sub main :main
+    load_bytecode 'PGE.pbc'
+    load_bytecode 'dumper.pbc'
+    load_bytecode 'PGE/Dumper.pbc'
+
+    $P0 = compreg 'PGE::P5Regex'
+    $P1 = $P0('aabb*')
+    $P2 = $P1('fooaabbbar')
+
+    _dumper($P2)
+.end
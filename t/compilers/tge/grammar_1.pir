@@ -0,0 +1,41 @@
+
+.sub _main :main
+    load_bytecode 'TGE.pbc'
+
+    # Compile a grammar from the source
+    .local pmc grammar
+    $P1 = new ['TGE';'Compiler']
+    grammar = $P1.'compile'(<<'GRAMMAR')
+    transform min (Leaf) :language('PIR') {
+        $P1 = getattribute node, "value"
+       .return ($P1)
+    }
+GRAMMAR
+    $S1 = typeof grammar
+    say $S1
+
+    # Add the grammar keyword and recompile
+    grammar = $P1.'compile'(<<'GRAMMAR')
+    grammar TreeMin is TGE;Grammar;
+    transform min (Leaf) :language('PIR') {
+        $P1 = getattribute node, "value"
+       .return ($P1)
+    }
+GRAMMAR
+    $S1 = typeof grammar
+    say $S1
+
+    # Add a POD comment and recompile
+    .local string source
+    source = "=head NAME\n\n TreeMin2\n\n=cut\n\n"
+    source .= <<'GRAMMAR'
+    grammar TreeMin2 is TGE;Grammar;
+    transform min (Leaf) :language('PIR') {
+        $P1 = getattribute node, "value"
+       .return ($P1)
+    }
+GRAMMAR
+    grammar = $P1.'compile'(source)
+    $S1 = typeof grammar
+    say $S1
+.end
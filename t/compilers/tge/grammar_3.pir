@@ -0,0 +1,40 @@
+
+.sub _main :main
+    load_bytecode 'TGE.pbc'
+
+    # Load the grammar in a string
+    .local string source
+    source = <<'GRAMMAR'
+    grammar TreeMin is TGE;Grammar;
+
+    transform tiddlywinks (ROOT) :language('PIR') {
+        say 'in tiddlywinks'
+        tree.'get'('twister', node, 'pingpong')
+        tree.'get'('twister', node, 'pongpong')
+    }
+    transform twister (pingpong) :language('PIR') {
+        say 'in first twister'
+    }
+    transform twister (pongpong) :language('PIR') {
+        say 'in second twister'
+    }
+GRAMMAR
+
+
+    .local pmc testing
+    testing = new 'Hash'
+
+    # Compile a grammar from the source
+    .local pmc grammar
+    $P1 = new ['TGE';'Compiler']
+    grammar = $P1.'compile'(source)
+
+    # Apply the grammar to the test tree
+    .local pmc AGI
+    AGI = grammar.'apply'(testing)
+
+    # Retrieve the value of a top level attribute
+    $P4 = AGI.'get'('tiddlywinks')
+    end
+.end
+
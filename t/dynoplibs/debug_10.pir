@@ -0,0 +1,13 @@
+.sub main :main
+    rec(91)
+.end
+.sub rec
+    .param int i
+    if i == 0 goto END
+    dec i
+    rec(i)
+    .return()
+END:
+    $P0 = null
+    $P0()
+.end
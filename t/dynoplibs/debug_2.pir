@@ -0,0 +1,10 @@
+.loadlib 'debug_ops'
+.sub main :main
+    debug_init
+    $I0 = 1
+    $S0 = "foo"
+    $N0 = 3.1
+    $P0 = new ['String']
+    $P0 = "bar"
+    debug_print
+.end
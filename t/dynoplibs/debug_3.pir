@@ -0,0 +1,11 @@
+.loadlib 'debug_ops'
+.sub main :main
+    push_eh eh
+    debug_print
+    goto finally
+eh:
+    .get_results($P0)
+    say $P0
+finally:
+    pop_eh
+.end
@@ -0,0 +1,6 @@
+.loadlib 'debug_ops'
+.sub main :main
+    debug_init
+    backtrace
+    say "ok"
+.end
@@ -0,0 +1,26 @@
+.sub main :main
+    print "ok 1\n"
+    a()
+    print "not ok 10\n"
+.end
+.sub a
+    print "ok 2\n"
+    b()
+    print "not ok 9\n"
+.end
+.sub b
+    print "ok 3\n"
+    c()
+    print "not ok 8\n"
+.end
+.sub c
+    print "ok 4\n"
+    d()
+    print "not ok 7\n"
+.end
+.sub d
+    print "ok 5\n"
+    $P0 = null
+    $P0()
+    print "not ok 6\n"
+.end
@@ -0,0 +1,13 @@
+.namespace ["Test1"]
+.sub main :main
+    print "ok 1\n"
+    foo()
+    print "not ok 5\n"
+.end
+.sub foo
+    print "ok 2\n"
+    $P0 = new 'Integer'
+    print "ok 3\n"
+    $P0."nosuchmethod"()
+    print "not ok 4\n"
+.end
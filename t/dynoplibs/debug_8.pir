@@ -0,0 +1,12 @@
+.namespace ["Test2"]
+.sub main :main
+    print "ok 1\n"
+    foo()
+    print "not ok 3\n"
+.end
+.sub foo :lex
+    print "ok 2\n"
+    $I1 = 0
+    div $I2, $I2, 0
+    print "not ok 3\n"
+.end
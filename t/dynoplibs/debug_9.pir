@@ -0,0 +1,3 @@
+.sub main :main
+    main()
+.end
@@ -20,7 +20,7 @@ Tests various io opcodes.
 .sub 'main' :main
     .include 'test_more.pir'
 
-    plan(59)
+    plan(74)
 
     read_on_null()
     test_bad_open()
@@ -37,6 +37,7 @@ Tests various io opcodes.
     printerr_tests()
     stat_tests()
     stdout_tests()
+    freeze_to_thaw_from()
 
     # must come after (these don't use test_more)
     open_pipe_for_writing()
@@ -426,6 +427,132 @@ CODE
     is( $I1, 16, 'read_s_p_i' )
 .end
 
+.sub 'freeze_to_thaw_from'
+    .local pmc data, shared, list, sh, copy, tree
+    shared = new ['ResizablePMCArray']
+    push shared, 'shared'
+
+    list = new ['ResizablePMCArray']
+    push list, -5
+    push list, 1234567890123
+    push list, 2.5
+    push list, utf8:"M\x{fc}nchen"
+    push list, shared
+    push list, shared
+
+    $S0 = repeat 'x', 20000
+    data = new ['Hash']
+    data['list'] = list
+    data['big']  = $S0
+
+    sh = new ['StringHandle']
+    sh.'encoding'('binary')
+    sh.'open'('freeze_stream', 'w')
+    freeze_to sh, data
+    freeze_to sh, data, 1
+    print sh, 'tail'
+    sh.'close'()
+
+    sh.'open'('freeze_stream', 'r')
+    copy = thaw_from sh
+    tree = thaw_from sh
+    $S1 = sh.'readall'()
+    is($S1, 'tail', 'thaw_from consumes exactly one image')
+
+    $P0 = copy['list']
+    $I0 = $P0[0]
+    is($I0, -5, 'freeze_to negative integer')
+    $I0 = $P0[1]
+    is($I0, 1234567890123, 'freeze_to large integer')
+    $N0 = $P0[2]
+    is($N0, 2.5, 'freeze_to float')
+    $S1 = $P0[3]
+    is($S1, utf8:"M\x{fc}nchen", 'freeze_to non-ascii string')
+    $S1 = copy['big']
+    is($S1, $S0, 'freeze_to string longer than a frame')
+    $P1 = $P0[4]
+    $P2 = $P0[5]
+    $S1 = $P1[0]
+    is($S1, 'shared', 'freeze_to nested aggregate')
+    $I0 = issame $P1, $P2
+    ok($I0, 'freeze_to keeps shared references')
+
+    $P0 = tree['list']
+    $I0 = $P0[1]
+    is($I0, 1234567890123, 'freeze_to tree mode integer')
+    $S1 = tree['big']
+    is($S1, $S0, 'freeze_to tree mode long string')
+    $P1 = $P0[4]
+    $P2 = $P0[5]
+    $S1 = $P2[0]
+    is($S1, 'shared', 'freeze_to tree mode nested aggregate')
+    $I0 = issame $P1, $P2
+    nok($I0, 'freeze_to tree mode duplicates shared references')
+
+    sh = new ['StringHandle']
+    sh.'encoding'('binary')
+    sh.'open'('freeze_stream', 'w')
+    print sh, 'not a frozen stream'
+    sh.'close'()
+    sh.'open'('freeze_stream', 'r')
+    push_eh bad_magic
+    copy = thaw_from sh
+    ok(0, 'thaw_from rejects garbage')
+    goto bad_magic_done
+  bad_magic:
+    .get_results($P0)
+    $S1 = $P0['message']
+    is($S1, 'Not a frozen stream', 'thaw_from rejects garbage')
+  bad_magic_done:
+    pop_eh
+
+    sh = new ['StringHandle']
+    sh.'encoding'('binary')
+    sh.'open'('freeze_stream', 'w')
+    freeze_to sh, data
+    sh.'close'()
+    sh.'open'('freeze_stream', 'r')
+    $S0 = sh.'readall'()
+    $S1 = substr $S0, 0, 40
+    sh = new ['StringHandle']
+    sh.'encoding'('binary')
+    sh.'open'('freeze_stream', 'w')
+    print sh, $S1
+    sh.'close'()
+    sh.'open'('freeze_stream', 'r')
+    push_eh truncated
+    copy = thaw_from sh
+    ok(0, 'thaw_from rejects a truncated image')
+    goto truncated_done
+  truncated:
+    .get_results($P0)
+    $S1 = $P0['message']
+    is($S1, 'Unexpected end of frozen stream', 'thaw_from rejects a truncated image')
+  truncated_done:
+    pop_eh
+
+    # a valid header followed by a frame claiming about 2**49 bytes
+    $S1 = substr $S0, 0, 8
+    $S2 = binary:"\xff\xff\xff\xff\xff\xff\xff\x00oversized"
+    $S1 = concat $S1, $S2
+    sh = new ['StringHandle']
+    sh.'encoding'('binary')
+    sh.'open'('freeze_stream', 'w')
+    print sh, $S1
+    sh.'close'()
+    sh.'open'('freeze_stream', 'r')
+    push_eh oversized
+    copy = thaw_from sh
+    ok(0, 'thaw_from rejects an oversized frame')
+    goto oversized_done
+  oversized:
+    .get_results($P0)
+    $S1 = $P0['message']
+    is($S1, 'Unexpected end of frozen stream', 'thaw_from rejects an oversized frame')
+  oversized_done:
+    pop_eh
+.end
+
 .sub 'read_on_null'
     .const string description = "read on null PMC throws exception"
     push_eh eh
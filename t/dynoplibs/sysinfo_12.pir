@@ -0,0 +1,9 @@
+.loadlib 'sys_ops'
+.include 'sysinfo.pasm'
+.sub main :main
+    $S0 = sysinfo .SYSINFO_CPU_TYPE
+    print $S0
+    $I1 = .SYSINFO_CPU_TYPE
+    $S1 = sysinfo $I1
+    print $S1
+.end
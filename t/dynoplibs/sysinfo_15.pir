@@ -0,0 +1,14 @@
+.loadlib 'sys_ops'
+.include 'sysinfo.pasm'
+.sub main :main
+    $I0 = sysinfo .SYSINFO_PARROT_INTMIN
+    say $I0
+    $I0 = sysinfo .SYSINFO_PARROT_INTMAX
+    say $I0
+    $I1 = .SYSINFO_PARROT_INTMIN
+    $I0 = sysinfo $I1
+    say $I0
+    $I1 = .SYSINFO_PARROT_INTMAX
+    $I0 = sysinfo $I1
+    say $I0
+.end
@@ -0,0 +1,12 @@
+.loadlib 'sys_ops'
+.include 'sysinfo.pasm'
+.sub 'main' :main
+    # assumes 2's compliment integer math
+    .include 'test_more.pir'
+    .local int min, max
+    max = sysinfo .SYSINFO_PARROT_INTMAX
+    neg max
+    min = sysinfo .SYSINFO_PARROT_INTMIN
+    inc min
+    is(max, min)
+.end
@@ -0,0 +1,8 @@
+.loadlib 'sys_ops'
+.sub 'main' :main
+    $I0 = sysinfo -1
+    say $I0
+
+    $I1 = sysinfo $I0
+    say $I1
+.end
@@ -0,0 +1,9 @@
+.loadlib 'sys_ops'
+.include 'sysinfo.pasm'
+.sub main :main
+    $I0 = sysinfo .SYSINFO_PARROT_POINTERSIZE
+    print $I0
+    $I3 = .SYSINFO_PARROT_POINTERSIZE
+    $I2 = sysinfo $I3
+    print $I2
+.end
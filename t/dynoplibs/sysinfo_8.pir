@@ -0,0 +1,9 @@
+.loadlib 'sys_ops'
+.include 'sysinfo.pasm'
+.sub main :main
+    $S0 = sysinfo .SYSINFO_PARROT_OS
+    print $S0
+    $I1 = .SYSINFO_PARROT_OS
+    $S1 = sysinfo $I1
+    print $S1
+.end
@@ -0,0 +1,9 @@
+.sub main :main
+    .local pmc lib
+    lib = loadlib "dynlexpad"
+    unless lib goto not_loaded
+    print "ok\n"
+    end
+not_loaded:
+    print "not loaded\n"
+.end
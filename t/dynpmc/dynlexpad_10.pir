@@ -0,0 +1,31 @@
+.loadlib "dynlexpad"
+
+.HLL "Some"
+.sub load :anon :init
+  .local pmc interp, lexpad, dynlexpad
+  interp = getinterp
+  lexpad = get_class 'LexPad'
+  dynlexpad = get_class 'DynLexPad'
+  interp.'hll_map'(lexpad, dynlexpad)
+.end
+
+.sub 'test' :main
+    foo()
+.end
+
+.sub foo
+    .lex 'a', $P0
+    $P0 = new 'String'
+    store_lex 'a', $P0
+
+    $P1 = getinterp
+    $P2 = $P1['lexpad']
+
+    $P3 = new ['String']
+    $P3 = "q"
+    $I0 = exists $P2[$P3]
+    say $I0
+
+    $I1 = exists $P2['a']
+    say $I1
+.end
@@ -0,0 +1,58 @@
+.loadlib "dynlexpad"
+
+.HLL "Some"
+.sub load :anon :init
+  .local pmc interp, lexpad, dynlexpad
+  interp = getinterp
+  lexpad = get_class 'LexPad'
+  dynlexpad = get_class 'DynLexPad'
+  interp.'hll_map'(lexpad, dynlexpad)
+.end
+
+
+.loadlib 'dynlexpad'
+.sub 'onload' :immediate
+    .local pmc interp
+    interp = getinterp
+
+    .local pmc core
+    core = get_class 'LexPad'
+    .local pmc hll
+    hll = get_class 'DynLexPad'
+    interp.'hll_map'(core,hll)
+.end
+
+.sub 'test' :main
+
+    .local pmc str1,str2,str3
+
+    str1 = box 'pants'
+    str2 = box 'shorts'
+    str3 = box 'skirt'
+
+    .lex 'a', str1
+    .lex 'b', str2
+    .lex 'c', str3
+
+    store_lex 'a', str1
+    store_lex 'b', str2
+    store_lex 'c', str3
+
+    .local pmc interp
+    interp = getinterp
+
+    .local pmc dlp
+    dlp    = interp['lexpad']
+
+    .local pmc iterator
+    iterator = iter dlp
+iter_loop:
+    unless iterator goto iter_done
+    .local pmc key
+    key = shift iterator
+    .local pmc value
+    value = dlp[key]
+    say value
+    goto iter_loop
+iter_done:
+.end
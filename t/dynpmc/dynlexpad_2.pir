@@ -0,0 +1,5 @@
+.sub main :main
+    .local pmc lib
+    lib = loadlib "dynlexpad"
+    $P0 = new ['DynLexPad']
+.end
@@ -0,0 +1,26 @@
+.loadlib "dynlexpad"
+
+.HLL "Some"
+.sub load :anon :init
+  .local pmc interp, lexpad, dynlexpad
+  interp = getinterp
+  lexpad = get_class 'LexPad'
+  dynlexpad = get_class 'DynLexPad'
+  interp.'hll_map'(lexpad, dynlexpad)
+.end
+
+# see loadlib
+.sub 'test' :main
+    foo()
+.end
+.sub foo :lex
+    $P1 = new 'Integer'
+    $P1 = 13013
+    store_lex 'a', $P1
+    print "ok 1\n"
+    $P2 = find_lex 'a'
+    print "ok 2\n"
+    print $P2
+    print "\n"
+    end
+.end
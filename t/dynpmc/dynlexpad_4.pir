@@ -0,0 +1,35 @@
+.loadlib "dynlexpad"
+
+.HLL "Some"
+.sub load :anon :init
+  .local pmc interp, lexpad, dynlexpad
+  interp = getinterp
+  lexpad = get_class 'LexPad'
+  dynlexpad = get_class 'DynLexPad'
+  interp.'hll_map'(lexpad, dynlexpad)
+.end
+
+.sub 'test' :main
+    foo()
+.end
+.sub foo :lex
+    $P1 = new 'Integer'
+    $P1 = 13013
+    store_lex 'a', $P1
+    $P2 = find_lex 'a'
+    print $P2
+    print "\n"
+    .const 'Sub' bar_sub = "bar"
+    $P0 = newclosure bar_sub
+    $P0()
+.end
+.sub bar :outer(foo)
+    .const 'Sub' baz_sub = "baz"
+    $P0 = newclosure baz_sub
+    $P0()
+.end
+.sub baz :lex :outer(bar)
+    $P1 = find_lex 'a'
+    print $P1
+    print "\n"
+.end
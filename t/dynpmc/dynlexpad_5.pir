@@ -0,0 +1,49 @@
+.loadlib "dynlexpad"
+
+.HLL "Some"
+.sub load :anon :init
+  .local pmc interp, lexpad, dynlexpad
+  interp = getinterp
+  lexpad = get_class 'LexPad'
+  dynlexpad = get_class 'DynLexPad'
+  interp.'hll_map'(lexpad, dynlexpad)
+.end
+
+.sub 'test' :main
+    foo()
+.end
+.sub foo :lex
+    $P1 = new 'Integer'
+    $P1 = 13013
+    store_lex 'a', $P1
+    $P2 = find_lex 'a'
+    print $P2
+    print "\n"
+    .const 'Sub' bar_sub = "bar"
+    $P0 = newclosure bar_sub
+    $P0()
+    # check the upvar
+    $P2 = find_lex 'b'
+    print $P2
+    print "\n"
+.end
+.sub bar :outer(foo)
+    .const 'Sub' baz_sub = "baz"
+    $P0 = newclosure baz_sub
+    $P0()
+.end
+.sub baz :lex :outer(bar)
+    $P1 = find_lex 'a'
+    print $P1
+    print "\n"
+    # upvar 2 'b', 55
+    .local pmc pad, interp
+    interp = getinterp
+    pad = interp["lexpad"; 2]
+    $P2 = new 'Integer'
+    $P2 = 55
+    pad['b'] = $P2
+    .return()
+err:
+    print "outer not found\n"
+.end
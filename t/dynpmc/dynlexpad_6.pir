@@ -0,0 +1,32 @@
+.loadlib "dynlexpad"
+
+.HLL "Some"
+.sub load :anon :init
+  .local pmc interp, lexpad, dynlexpad
+  interp = getinterp
+  lexpad = get_class 'LexPad'
+  dynlexpad = get_class 'DynLexPad'
+  interp.'hll_map'(lexpad, dynlexpad)
+.end
+
+.sub 'test' :main
+    foo()
+    bar()
+.end
+.sub foo :lex
+    .local pmc pad, interp
+    interp = getinterp
+    pad = interp["lexpad"]
+    $S0 = typeof pad
+    print $S0
+    print "\n"
+.end
+.HLL "parrot"
+.sub bar :lex
+    .local pmc pad, interp
+    interp = getinterp
+    pad = interp["lexpad"]
+    $S0 = typeof pad
+    print $S0
+    print "\n"
+.end
@@ -0,0 +1,33 @@
+.loadlib "dynlexpad"
+
+.HLL "Some"
+.sub load :anon :init
+  .local pmc interp, lexpad, dynlexpad
+  interp = getinterp
+  lexpad = get_class 'LexPad'
+  dynlexpad = get_class 'DynLexPad'
+  interp.'hll_map'(lexpad, dynlexpad)
+.end
+
+.sub 'test' :main
+    foo()
+.end
+
+.sub foo
+    .lex 'a', $P0               # static lexical
+    $P0 = new 'String'
+    $P0 = "ok 1"
+    $P1 = find_lex 'a'
+    say $P1
+
+    $P2 = new 'String'
+    $P2 = "ok 2"
+    store_lex 'a', $P2
+    say $P0                   # sic!
+
+    $P3 = new 'String'
+    $P3 = "ok 3"
+    store_lex 'b', $P3          # and a dynamic one
+    $P4 = find_lex 'b'
+    say $P4
+.end
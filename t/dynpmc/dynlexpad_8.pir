@@ -0,0 +1,26 @@
+.loadlib "dynlexpad"
+
+.HLL "Some"
+.sub load :anon :init
+  .local pmc interp, lexpad, dynlexpad
+  interp = getinterp
+  lexpad = get_class 'LexPad'
+  dynlexpad = get_class 'DynLexPad'
+  interp.'hll_map'(lexpad, dynlexpad)
+.end
+
+.sub 'test' :main
+    foo()
+.end
+
+.sub foo
+    .lex 'a', $P0               # static lexical
+    $P0 = new 'String'
+    store_lex 'a', $P0          # and a dynamic one
+
+    $P1 = getinterp
+    $P2 = $P1['lexpad']
+
+    $I0 = elements $P2
+    say $I0
+.end
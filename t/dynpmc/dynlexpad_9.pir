@@ -0,0 +1,31 @@
+.loadlib "dynlexpad"
+
+.HLL "Some"
+.sub load :anon :init
+  .local pmc interp, lexpad, dynlexpad
+  interp = getinterp
+  lexpad = get_class 'LexPad'
+  dynlexpad = get_class 'DynLexPad'
+  interp.'hll_map'(lexpad, dynlexpad)
+.end
+
+.sub 'test' :main
+    foo()
+.end
+
+.sub meh
+.end
+
+.sub foo
+    $P0 = get_global "meh"
+    $P1 = new ['LexInfo'], $P0
+    $P2 = new ['DynLexPad'], $P1
+
+    $P3 = $P2['a']
+    $I0 = isnull $P3
+    say $I0
+
+    null $P2
+    sweep 1
+    say "ok"
+.end
@@ -0,0 +1,15 @@
+.sub main :main
+        $P0 = loadlib 'file'
+        $P1 = new ['File']
+
+        #make a filename that's long enough to cause lstat to fail
+        $I0 = 1000
+loop:
+        $S0 = concat $S0, "1234567890"
+        $I0 = $I0 - 1
+        if $I0 goto loop
+
+        $I1 = $P1."is_dir"($S0)
+
+        end
+.end
@@ -0,0 +1,25 @@
+.sub main :main
+        $P0 = loadlib 'file'
+        $P1 = new ['File']
+
+        $S1 = '/tmp/OG6il6wbJb/xpto'
+        $I1 = $P1."is_file"($S1)
+        $I1 = !$I1
+
+        if $I1 goto ok1
+        print "not "
+
+ok1:
+        print "ok 1\n"
+
+        $S1 = '/tmp/OG6il6wbJb/xpto/otpx'
+        $I1 = $P1."is_file"($S1)
+
+        if $I1 goto ok2
+        print "not "
+
+ok2:
+        print "ok 2\n"
+
+        end
+.end
@@ -0,0 +1,24 @@
+.sub main :main
+       $S1 = '/tmp/OG6il6wbJb/xpto/otpx'
+       $S2 = '/tmp/OG6il6wbJb/xpto/otpxcopy'
+
+       $P0 = loadlib 'file'
+       $P1 = new ['File']
+       $P2 = new ['OS']
+
+       $P1."copy"($S1,$S2)
+       print "ok\n"
+
+       $P3 = $P2."stat"($S1)
+       $P4 = $P2."stat"($S2)
+
+       $I1 = $P3[7]
+       $I2 = $P4[7]
+
+       if $I1 == $I2 goto ok
+       print "not "
+ok:
+       print "ok\n"
+
+       end
+.end
@@ -0,0 +1,29 @@
+.sub main :main
+       $P0 = loadlib 'file'
+       $P1 = new ['File']
+       $I1 = $P1.'exists'( '/tmp/OG6il6wbJb/xpto/otpxcopy' )
+
+       if $I1 goto file_exists
+       print "not "
+
+  file_exists:
+       print "ok 1 - file exists\n"
+
+       $I1 = $P1.'exists'( '/tmp/OG6il6wbJb/xpto' )
+
+       if $I1 goto dir_exists
+       print "not "
+
+  dir_exists:
+       print "ok 2 - directory exists\n"
+
+       $I1 = $P1.'exists'( '/tmp/OG6il6wbJb/xpto/not a file' )
+
+       if $I1 == 0 goto file_does_not_exist
+       print "not "
+
+  file_does_not_exist:
+       print "ok 3 - file does not exist\n"
+
+       end
+.end
@@ -0,0 +1,5 @@
+.sub main :main
+  $P0 = loadlib 'pccmethod_test'
+  $P1 = new 'PCCMETHOD_Test'
+  $P1.'test_method3'( 'a1name' => 10, 'a2name' => 20 )
+.end
@@ -0,0 +1,16 @@
+.sub main :main
+  $P0 = loadlib 'pccmethod_test'
+  $P1 = new 'PCCMETHOD_Test'
+  $P1.'test_method0'(1)
+  $P1.'test_method1'(1, 2, 3, 4, 5, 6)
+  $P1.'test_method2'()
+  $P1.'test_method2'(1)
+  $P1.'test_method2'(1,2)
+  $P1.'test_method2'(1,2,3)
+  ($P2,$P3) = $P1.'test_method2'(101)
+  print "BACK - "
+  print $P2
+  print " - "
+  print $P3
+  print " -\n"
+.end
@@ -0,0 +1,36 @@
+.include "except_types.pasm"
+.sub make_readonly
+    .param pmc arg
+    .local pmc one
+    one = new 'Integer'
+    one = 1
+    setprop arg, '_ro', one
+.end
+
+.sub make_writable
+    .param pmc arg
+    .local pmc zero
+    zero = new 'Integer'
+    zero = 0
+    setprop arg, '_ro', zero
+.end
+.loadlib 'rotest'
+.sub main :main
+    .local pmc value, eh
+    value = new 'ROTest'
+    eh = new 'ExceptionHandler'
+    eh.'handle_types'(.EXCEPTION_WRITE_TO_CONSTCLASS, .EXCEPTION_METHOD_NOT_FOUND)
+    set_label eh, eh_label
+
+    #READONLYTEST
+    push_eh eh
+    $I0 = value
+    pop_eh
+    say "reached end"
+    end
+
+eh_label:
+    .get_results($P0)
+    say "RO or method not found exception caught"
+    end
+.end
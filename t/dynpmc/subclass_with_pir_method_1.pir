@@ -0,0 +1,18 @@
+.loadlib  'perl_group'
+.sub main :main
+  new $P0, 'PerlString'
+  $P0.'perl_printhi'()
+  get_class $P2, 'PerlString'
+  subclass $P0, $P2, 'NewPerlString'
+  $P0.'perl_printhi'()
+  new $P1, 'NewPerlString'
+  $P1.'perl_printhi'()
+.end
+
+.HLL 'Perl'
+.loadlib 'perl_group'
+.namespace ['PerlString']
+.sub 'perl_printhi' :method
+    print "HI from PerlString\n"
+.end
+
@@ -0,0 +1,19 @@
+
+.sub test :main
+    load_bytecode "dumper.pbc"
+    .local pmc array
+
+    new array, 'ResizablePMCArray'
+    push array, 0
+    push array, 1
+    push array, 2
+    push array, 3
+    push array, 4
+    push array, 5
+    push array, 6
+    push array, 7
+    push array, 8
+    push array, 9
+
+    _dumper( array, "array" )
+.end
@@ -0,0 +1,48 @@
+
+.sub test :main
+    load_bytecode "dumper.pbc"
+    .local pmc temp
+    .local pmc array
+
+    newclass temp, "TestClass"
+
+    new array, 'ResizablePMCArray'
+    temp = new "TestClass"
+    push array, temp
+    $P0 = get_class 'TestClass'
+    temp = new $P0
+    push array, temp
+
+    _dumper( array )
+.end
+
+.namespace ["TestClass"]
+
+.sub __dump :method
+    .param pmc dumper
+    .param string dname
+    .local string subindent
+    .local string indent
+    .local string name
+
+    (subindent, indent) = dumper."newIndent"()
+    print "{\n"
+
+    print subindent
+    print "this is\n"
+
+    print subindent
+    print "_"
+    typeof name, self
+    print name
+    print "::__dump\n"
+
+    print indent
+    print "}"
+
+    dumper."deleteIndent"()
+
+    .begin_return
+    .end_return
+.end
+.namespace []
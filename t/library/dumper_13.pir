@@ -0,0 +1,24 @@
+
+.sub test :main
+    load_bytecode "dumper.pbc"
+    .local pmc array
+    .local pmc temp
+
+    new array, 'ResizablePMCArray'
+
+    push array, 0
+    push array, "0"
+
+    null temp
+    push array, temp
+
+    new temp, 'Integer'
+    set temp, 0
+    push array, temp
+
+    new temp, 'String'
+    set temp, "0"
+    push array, temp
+
+    _dumper( array, "array" )
+.end
@@ -0,0 +1,22 @@
+
+.sub _test :main
+    load_bytecode "dumper.pbc"
+    .local pmc array
+    array = new 'ResizablePMCArray'
+
+    .local pmc pmc_string, pmc_perl_string
+    .local string string_1
+
+    pmc_string = new 'String'
+    pmc_string = "This is a String PMC"
+    push array, pmc_string
+
+    pmc_perl_string = new 'String'
+    pmc_perl_string = "This is a String PMC"
+    push array, pmc_perl_string
+
+    string_1 = "This is a String"
+    push array, string_1
+
+    _dumper( array, "array of various strings" )
+.end
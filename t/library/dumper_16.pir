@@ -0,0 +1,9 @@
+
+.sub test :main
+    load_bytecode "dumper.pbc"
+    .local pmc int1
+
+    new int1, 'Integer'
+    int1 = 12345
+    _dumper( int1, "Int:" )
+.end
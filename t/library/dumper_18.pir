@@ -0,0 +1,9 @@
+.sub test :main
+    load_bytecode "dumper.pbc"
+    .local pmc array
+
+    new array, 'ResizablePMCArray'
+    push array, 12345
+    push array, "hello"
+    _dumper( array, "array:" )
+.end
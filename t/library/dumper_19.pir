@@ -0,0 +1,9 @@
+.sub test :main
+    load_bytecode "dumper.pbc"
+    .local pmc array
+
+    new array, 'ResizableStringArray'
+    push array, "hello"
+    push array, "world"
+    _dumper( array, "array:" )
+.end
@@ -0,0 +1,9 @@
+.sub test :main
+    load_bytecode "dumper.pbc"
+    .local pmc array
+
+    new array, 'ResizableFloatArray'
+    push array, 123.45
+    push array, 67.89
+    _dumper( array, "array:" )
+.end
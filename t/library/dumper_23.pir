@@ -0,0 +1,10 @@
+.sub test :main
+    load_bytecode "dumper.pbc"
+    .local pmc array
+
+    new array, 'FixedStringArray'
+    array = 2
+    array[0] = "hello"
+    array[1] = "world"
+    _dumper( array, "array:" )
+.end
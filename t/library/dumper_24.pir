@@ -0,0 +1,10 @@
+.sub test :main
+    load_bytecode "dumper.pbc"
+    .local pmc array
+
+    new array, 'FixedIntegerArray'
+    array = 2
+    array[0] = 12345
+    array[1] = 67890
+    _dumper( array, "array:" )
+.end
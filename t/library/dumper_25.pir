@@ -0,0 +1,10 @@
+.sub test :main
+    load_bytecode "dumper.pbc"
+    .local pmc array
+
+    new array, 'FixedFloatArray'
+    array = 2
+    array[0] = 123.45
+    array[1] = 67.89
+    _dumper( array, "array:" )
+.end
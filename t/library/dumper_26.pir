@@ -0,0 +1,27 @@
+.sub main :main
+    load_bytecode "dumper.pbc"
+    .local pmc o, cl
+    cl = subclass 'ResizablePMCArray', 'bar'
+    o = new cl
+    _dumper(o)
+.end
+
+.namespace ["bar"]
+.sub init :vtable :method
+    .local pmc ar
+    ar = getattribute self, ['ResizablePMCArray'], 'proxy'
+    push ar, 1
+    push ar, 2
+.end
+
+.sub __dump :method
+    .param pmc dumper
+    .param string label
+    print " __value => {\n"
+    .local pmc ar
+    ar = getattribute self, ['ResizablePMCArray'], 'proxy'
+    dumper.'dump'('attr', ar)
+    print "\n}"
+.end
+.namespace []
+
@@ -0,0 +1,17 @@
+
+.sub test :main
+    load_bytecode "dumper.pbc"
+    .local pmc array
+
+    new array, 'ResizablePMCArray'
+    push array, "alpha"
+    push array, "bravo"
+    push array, "charlie"
+    push array, "delta"
+    push array, "echo"
+    push array, "foxtrot"
+    push array, "golf"
+    push array, "hotel"
+
+    _dumper( array, "strings" )
+.end
@@ -0,0 +1,21 @@
+
+.sub test :main
+    load_bytecode "dumper.pbc"
+    .local pmc str
+    .local pmc array
+
+    new array, 'ResizablePMCArray'
+    push array, "test1"
+    push array, "test2"
+
+    new str, 'String'
+    set str, "value1"
+    setprop array, "key1", str
+
+    new str, 'String'
+    set str, "value2"
+    setprop array, "key2", str
+
+    _dumper( array )
+
+.end
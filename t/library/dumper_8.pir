@@ -0,0 +1,33 @@
+
+.sub test :main
+    load_bytecode "dumper.pbc"
+    .local pmc hash1
+    .local pmc hash2
+    .local pmc array1
+    .local pmc array2
+    .local string name
+    .local string indent
+
+    new hash1, 'Hash'
+    new hash2, 'Hash'
+    new array1, 'ResizablePMCArray'
+    new array2, 'ResizablePMCArray'
+
+    set hash1["hash2"], hash2
+    set hash2["array"], array1
+    set hash1["test1"], "test1"
+    set hash2["test2"], "test2"
+    push array1, 1
+    push array1, array2
+    push array2, "test"
+    setprop hash1, "array2", array2
+    name = "hash"
+    indent = "|  "
+    _dumper( hash1, name, indent )
+    _dumper( hash1, name, indent )
+    print "name = '"
+    print name
+    print "'\nindent = '"
+    print indent
+    print "'\n"
+.end
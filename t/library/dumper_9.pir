@@ -0,0 +1,11 @@
+
+.sub test :main
+    load_bytecode "dumper.pbc"
+    .local pmc hash
+
+    new hash, 'Hash'
+
+    set hash["hello"], "world"
+    setprop hash, "backref", hash
+    _dumper( hash )
+.end
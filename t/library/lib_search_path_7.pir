@@ -0,0 +1,3 @@
+.sub main :main
+  load_bytecode 't/pir/testlib/loadtest.pbc'
+.end
@@ -0,0 +1,14 @@
+
+.sub _main :main
+    print "loading 'Combiner'...\n"
+    load_bytecode 'Stream/Combiner.pbc'
+    print "loaded\n"
+
+    $P0 = new ['Stream'; 'Combiner']
+
+    $S0 = typeof $P0
+    print "class name: '"
+    print $S0
+    print "'\ndone\n"
+    end
+.end
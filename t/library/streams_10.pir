@@ -0,0 +1,59 @@
+
+.sub _main :main
+    .local pmc stream
+
+    load_bytecode 'Stream/Sub.pbc'
+    load_bytecode 'Stream/Replay.pbc'
+
+    $P0 = new ['Stream'; 'Sub']
+    # set the stream's source sub      #'
+    .const 'Sub' temp = "_hello"
+    assign $P0, temp
+
+    stream = new ['Stream'; 'Replay']
+    assign stream, $P0
+
+    $S0 = stream."read_bytes"( 3 )
+    print "1: ["
+    print $S0
+    print "]\n"
+
+    stream = clone stream
+    $P0    = clone stream
+
+    $S0    = stream."read_bytes"( 4 )
+    print "2: ["
+    print $S0
+    print "] = "
+
+    $S0 = $P0."read_bytes"( 4 )
+    print "3: ["
+    print $S0
+    print "]\n"
+
+    $S0 = stream."read"()
+    print "4: ["
+    print $S0
+    print "]\n"
+
+    print "# _hello ends now:\n"
+    $S0 = stream."read_bytes"( 100 )
+    print "5: ["
+    print $S0
+    print "]\n"
+
+    print "done\n"
+    sweep 1
+    collect
+    print "finished\n"
+    end
+.end
+
+.sub _hello :method
+    print "_hello start!\n"
+    self."write"( "hello" )
+    self."write"( "world!" )
+    self."write"( "parrot" )
+    self."write"( "is cool" )
+    print "_hello end!\n"
+.end
@@ -0,0 +1,75 @@
+
+.sub _main :main
+    .local pmc counter
+    .local pmc text
+    .local pmc combined
+
+    load_bytecode 'Stream/Base.pbc'
+    load_bytecode 'Stream/Combiner.pbc'
+    load_bytecode 'Stream/Sub.pbc'
+
+    # create the counter stream
+    counter = new ['Stream'; 'Sub']
+    .const 'Sub' ct = "_counter"
+    assign counter, ct
+
+    # create the text stream
+    text = new ['Stream'; 'Sub']
+    # set its source
+    .const 'Sub' src = "_text"
+    assign text, src
+
+    # create a combiner stream
+    combined = new ['Stream'; 'Combiner']
+    # add the streams
+    assign combined, counter
+    assign combined, text
+
+    # specify our own combiner sub
+    .const 'Sub' cb = "_combiner"
+    combined."combiner"( cb )
+
+    # dump the combined stream
+    combined."dump"()
+
+    print "done\n"
+    sweep 1
+    collect
+    print "finished\n"
+    end
+.end
+
+.sub _counter
+    .param pmc stream
+    .local int i
+    .local string str
+
+    i = 0
+LOOP:
+    inc i
+    str = i
+    stream."write"( str )
+    branch LOOP
+.end
+
+.sub _text
+    .param pmc stream
+
+    stream."write"( "hello" )
+    stream."write"( "world!" )
+    stream."write"( "parrot" )
+    stream."write"( "is cool" )
+.end
+
+.sub _combiner
+    .param pmc strings
+    .local string str
+    .local string ret
+
+    ret = strings[0]
+    ret = concat ret, " "
+    str = strings[1]
+    ret = concat ret, str
+
+    .return(ret)
+.end
@@ -0,0 +1,47 @@
+
+.sub _main :main
+    .local pmc stream
+
+    load_bytecode 'Stream/Base.pbc'
+    load_bytecode 'Stream/Coroutine.pbc'
+
+    # create the coroutine stream
+    stream = new ['Stream'; 'Coroutine']
+
+    # set the stream's source coroutine #'
+    .const 'Sub' temp = "_coro"
+    assign stream, temp
+    #stream."source"( temp )
+
+    # dump the stream
+    stream."dump"()
+
+    print "done\n"
+    sweep 1
+    collect
+    print "finished\n"
+    end
+.end
+
+.sub _coro
+    .param pmc stream
+    .local int i
+    .local string str
+
+    i = 0
+LOOP:
+    str = i
+
+    .yield(str)
+
+    inc i
+    if i < 10 goto LOOP
+
+    # the stream is automatically closed if you return a null string
+    # you can also close it explicitly with
+    # stream."close"()
+    # in which case it doesn't matter what you are returning.
+
+    null str
+    .return(str)
+.end
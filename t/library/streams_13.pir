@@ -0,0 +1,59 @@
+
+.sub _main :main
+    .local pmc file
+    .local pmc lines
+    .local pmc counter
+    .local pmc combiner
+    .local string name
+
+    name = "t/library/perlhistory.txt"
+
+    load_bytecode 'Stream/ParrotIO.pbc'
+    load_bytecode 'Stream/Lines.pbc'
+    load_bytecode 'Stream/Sub.pbc'
+    load_bytecode 'Stream/Combiner.pbc'
+
+    # create a file stream
+    file = new ['Stream'; 'ParrotIO']
+    file."open"( name, 'r' )
+
+    # process it one line per read
+    lines = new ['Stream'; 'Lines']
+    assign lines, file
+
+    # endless counter
+    counter = new ['Stream'; 'Sub']
+    .const 'Sub' temp = "_counter"
+    assign counter, temp
+
+    # combine the counter and the file's lines   #'
+    combiner = new ['Stream'; 'Combiner']
+    assign combiner, counter
+    assign combiner, lines
+
+    # dump the stream
+    combiner."dump"()
+
+    print "done\n"
+    sweep 1
+    collect
+    print "finished\n"
+    end
+.end
+
+.sub _counter
+    .param pmc stream
+    .local int i
+    .local string str
+    .local pmc array
+
+    i = 0
+    array = new 'ResizablePMCArray'
+
+LOOP:
+    inc i
+    array[0] = i
+    sprintf str, "%5d ", array
+    stream."write"( str )
+    branch LOOP
+.end
@@ -0,0 +1,68 @@
+
+.sub _main :main
+    .local pmc stream
+    .local pmc filter
+
+    load_bytecode 'Stream/Sub.pbc'
+    load_bytecode 'Stream/Filter.pbc'
+
+    # create the counter stream
+    stream = new ['Stream'; 'Sub']
+    # assign its source
+    .const 'Sub' temp = "_counter"
+    assign stream, temp
+
+    # create the filter stream
+    filter = new ['Stream'; 'Filter']
+    # assign its source
+    assign filter, stream
+    # set the filter sub
+    .const 'Sub' ft = "_filter"
+    filter."filter"( ft )
+
+    # dump the stream
+    filter."dump"()
+
+    print "done\n"
+    sweep 1
+    collect
+    print "finished\n"
+    end
+.end
+
+.sub _counter
+    .param pmc stream
+    .local string str
+    .local int i
+
+    i = 0
+
+LOOP:
+    str = i
+    stream."write"( str )
+
+    inc i
+    if i < 10 goto LOOP
+.end
+
+.sub _filter
+    .param string str
+    .local string tmp
+    .local int i
+
+    i = str
+
+    # skip 4 * 2
+    if i == 4 goto SKIP
+
+    mul i, 2
+    set tmp, i
+    str = concat str, " * 2 = "
+    str = concat str, tmp
+
+    .return(str)
+
+SKIP:
+    null str
+    .return(str)
+.end
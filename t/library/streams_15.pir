@@ -0,0 +1,78 @@
+
+.sub _main :main
+    .local pmc stream
+
+    load_bytecode 'Stream/Sub.pbc'
+
+    stream = new ['Stream'; 'Sub']
+
+    .const 'Sub' temp = "_counter"
+    assign stream, temp
+
+    # dump the stream
+    stream."dump"()
+
+    print "done\n"
+    sweep 1
+    collect
+    print "finished\n"
+    end
+.end
+
+.sub _counter :method
+    .local string str
+    .local int i
+
+    i = 0
+
+LOOP:
+    str = i
+
+    self."write"( str )
+
+    # include another stream after '4'
+    if i != 4 goto SKIP
+    .local pmc temp
+
+    temp = new ['Stream'; 'Sub']
+
+    .const 'Sub' func = "_included"
+    assign temp, func
+
+    # include it
+    self."include"( temp )
+SKIP:
+
+    inc i
+    if i < 10 goto LOOP
+.end
+
+.sub _included :method
+    .local pmc temp
+
+    self."write"( "hello" )
+
+    # create another stream
+    temp = new ['Stream'; 'Sub']
+    .const 'Sub' func = "_counter2"
+    assign temp, func
+
+    # include it
+    self."include"( temp )
+
+    self."write"( "world" )
+.end
+
+.sub _counter2 :method
+    .local string str
+
+    str = 'A'
+LOOP:
+    self."write"( str )
+
+    ord $I0, str
+    inc $I0
+    chr str, $I0
+
+    if str != "G" goto LOOP
+.end
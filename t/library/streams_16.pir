@@ -0,0 +1,34 @@
+
+.sub _main :main
+    .local pmc stream
+    .local pmc lines
+
+    load_bytecode 'Stream/Sub.pbc'
+    load_bytecode 'Stream/Lines.pbc'
+
+    # create a text stream
+    stream = new ['Stream'; 'Sub']
+    # set the source
+    .const 'Sub' temp = "_text"
+    assign stream, temp
+
+    # create a lines stream
+    lines = new ['Stream'; 'Lines']
+    # set the source
+    assign lines, stream
+
+    # dump the stream
+    lines."dump"()
+
+    print "done\n"
+    sweep 1
+    collect
+    print "finished\n"
+    end
+.end
+
+.sub _text :method
+    self."write"( "this\nis a\n" )
+    self."write"( "Stream::Lines\ntest" )
+    self."write"( "case\nhello world" )
+.end
@@ -0,0 +1,25 @@
+
+.sub _main :main
+    .local pmc stream
+    .local pmc temp
+
+    load_bytecode 'Stream/ParrotIO.pbc'
+
+    # create the ParrotIO stream
+    stream = new ['Stream'; 'ParrotIO']
+
+    # open this file
+    stream."open"( "t/library/perlhistory.txt", 'r' )
+
+    # you can specify a custom block size with
+    # stream."blockSize"( 10 )
+
+    # dump the stream
+    stream."dump"()
+
+    print "done\n"
+    sweep 1
+    collect
+    print "finished\n"
+    end
+.end
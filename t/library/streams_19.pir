@@ -0,0 +1,39 @@
+
+.sub _main :main
+    .local pmc stream
+
+    load_bytecode 'Stream/Base.pbc'
+    load_bytecode 'Stream/Sub.pbc'
+
+    stream = new ['Stream'; 'Sub']
+
+    .const 'Sub' temp = "_counter"
+    assign stream, temp
+
+    # dump the stream
+    stream."dump"()
+
+    print "done\n"
+    sweep 1
+    collect
+    print "finished\n"
+    end
+.end
+
+.sub _counter :method
+    .local string str
+    .local int i
+
+    i = 0
+
+LOOP:
+    # streams are using strings,
+    # so we have to convert the number into a string
+    str = i
+
+    # write the string
+    self."write"( str )
+
+    inc i
+    if i < 10 goto LOOP
+.end
@@ -0,0 +1,14 @@
+
+.sub _main :main
+    print "loading 'Coroutine'...\n"
+    load_bytecode 'Stream/Coroutine.pbc'
+    print "loaded\n"
+
+    $P0 = new ['Stream'; 'Coroutine']
+
+    $S0 = typeof $P0
+    print "class name: '"
+    print $S0
+    print "'\ndone\n"
+    end
+.end
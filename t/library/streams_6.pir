@@ -0,0 +1,14 @@
+
+.sub _main :main
+    print "loading 'Replay'...\n"
+    load_bytecode 'Stream/Replay.pbc'
+    print "loaded\n"
+
+    $P0 = new ['Stream'; 'Replay']
+
+    $S0 = typeof $P0
+    print "class name: '"
+    print $S0
+    print "'\ndone\n"
+    end
+.end
@@ -0,0 +1,14 @@
+
+.sub _main :main
+    print "loading 'Sub'...\n"
+    load_bytecode 'Stream/Sub.pbc'
+    print "loaded\n"
+
+    $P0 = new ['Stream'; 'Sub']
+
+    $S0 = typeof $P0
+    print "class name: '"
+    print $S0
+    print "'\ndone\n"
+    end
+.end
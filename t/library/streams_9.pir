@@ -0,0 +1,33 @@
+
+.sub _main :main
+    .local pmc stream
+
+    load_bytecode 'Stream/Sub.pbc'
+
+    stream = new ['Stream'; 'Sub']
+
+    # set the stream's source sub   #'
+    .const 'Sub' temp = "_hello"
+    assign stream, temp
+
+    # dump the stream
+    stream."dump"()
+    # read again to see if read returns null
+    $S0 = stream."read"()
+    if_null $S0, OK
+    print "error: read returned '"
+    print $S0
+    print "' instead of (null)\n"
+OK:
+    print "done\n"
+    sweep 1
+    collect
+    print "finished\n"
+    end
+.end
+.sub _hello :method
+    self."write"( "hello" )
+    self."write"( "world!" )
+    self."write"( "parrot" )
+    self."write"( "is cool" )
+.end
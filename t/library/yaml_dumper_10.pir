@@ -0,0 +1,14 @@
+
+.sub test :main
+    load_bytecode "yaml_dumper.pbc"
+    .local pmc hash
+    .local pmc prop
+
+    new hash, 'Hash'
+
+    set hash["hello"], "world"
+    setprop hash, "self", hash
+    prophash prop, hash
+    setprop hash, "self", prop
+    yaml( hash )
+.end
@@ -0,0 +1,25 @@
+
+.sub test :main
+    load_bytecode "yaml_dumper.pbc"
+    .local pmc array
+    .local pmc hash1
+    .local pmc hash2
+    .local pmc prop
+
+    new array, 'ResizablePMCArray'
+    new hash1, 'Hash'
+    new hash2, 'Hash'
+
+    set hash1["hello1"], "world1"
+    set hash2["hello2"], "world2"
+    setprop hash1, "das leben", hash2
+    prophash prop, hash1
+    set prop["das leben"], "ist schoen"
+    setprop hash2, "hash1prop", prop
+    push array, hash1
+    push array, hash2
+    push array, prop
+    prophash prop, hash2
+    push array, prop
+    yaml( array )
+.end
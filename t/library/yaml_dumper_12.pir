@@ -0,0 +1,48 @@
+
+.sub test :main
+    load_bytecode "yaml_dumper.pbc"
+    .local pmc temp
+    .local pmc array
+
+    newclass temp, "TestClass"
+
+    new array, 'ResizablePMCArray'
+    temp = new "TestClass"
+    push array, temp
+    $P0 = get_class 'TestClass'
+    temp = new $P0
+    push array, temp
+
+    yaml( array )
+.end
+
+.namespace ["TestClass"]
+
+.sub __yaml :method
+    .param pmc dumper
+    .param string dname
+    .local string subindent
+    .local string indent
+    .local string name
+
+    (subindent, indent) = dumper."newIndent"()
+    print "{\n"
+
+    print subindent
+    print "this is\n"
+
+    print subindent
+    print "_"
+    typeof name, self
+    print name
+    print "::__yaml,\n"
+
+    print indent
+    print "}"
+
+    dumper."deleteIndent"()
+
+    .begin_return
+    .end_return
+.end
+.namespace []
@@ -0,0 +1,58 @@
+
+.sub test :main
+    load_bytecode "yaml_dumper.pbc"
+    .local pmc hash1
+    .local pmc hash2
+    .local pmc hash3
+    .local pmc array1
+
+    new hash1, 'Hash'
+    new hash2, 'Hash'
+    new hash3, 'Hash'
+    new array1, 'ResizablePMCArray'
+
+    yaml( hash1,"hash1" )
+
+    $S0 = "hello"
+    $S1 = "world"
+    set hash1[$S0], $S1
+
+    yaml( hash1,"hash1" )
+
+    $S0 = "hello2"
+    $S1 = "world2"
+    set hash1[$S0], $S1
+
+    yaml( hash1,"hash1" )
+
+    $S0 = "hash2"
+    set hash1[$S0], hash2
+
+    yaml( hash1,"hash1" )
+
+    $S0 = "hello3"
+    $S1 = "world3"
+    set hash2[$S0], $S1
+
+    yaml( hash1,"hash1" )
+
+    $S0 = "name"
+    $S1 = "parrot"
+    set hash3[$S0], $S1
+    $S0 = "is"
+    $S1 = "cool"
+    set hash3[$S0], $S1
+
+    array1 = 5
+    array1[0] = "this"
+    array1[1] = "is"
+    array1[2] = "a"
+    array1[3] = "test"
+    array1[4] = hash3
+
+    $S0 = "array1"
+    set hash2[$S0], array1
+
+    yaml( hash1,"hash1" )
+
+.end
@@ -0,0 +1,9 @@
+
+.sub test :main
+    load_bytecode "yaml_dumper.pbc"
+    .local pmc int1
+
+    new int1, 'Integer'
+    int1 = 12345
+    yaml( int1, "Int" )
+.end
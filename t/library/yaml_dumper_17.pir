@@ -0,0 +1,9 @@
+
+.sub test :main
+    load_bytecode "yaml_dumper.pbc"
+    .local pmc float1
+
+    new float1, 'Float'
+    float1 = 12345.678
+    yaml( float1, "Float" )
+.end
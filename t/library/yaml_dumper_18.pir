@@ -0,0 +1,9 @@
+.sub test :main
+    load_bytecode "yaml_dumper.pbc"
+    .local pmc array
+
+    new array, 'ResizablePMCArray'
+    push array, 12345
+    push array, "hello"
+    yaml( array, "array" )
+.end
@@ -0,0 +1,9 @@
+.sub test :main
+    load_bytecode "yaml_dumper.pbc"
+    .local pmc array
+
+    new array, 'ResizableStringArray'
+    push array, "hello"
+    push array, "world"
+    yaml( array, "array:" )
+.end
@@ -0,0 +1,9 @@
+.sub test :main
+    load_bytecode "yaml_dumper.pbc"
+    .local pmc array
+
+    new array, 'ResizableIntegerArray'
+    push array, 12345
+    push array, 67890
+    yaml( array, "array:" )
+.end
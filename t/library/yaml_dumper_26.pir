@@ -0,0 +1,27 @@
+.sub main :main
+    load_bytecode "yaml_dumper.pbc"
+    .local pmc o, cl
+    cl = subclass 'ResizablePMCArray', 'bar'
+    o = new cl
+    yaml(o)
+.end
+
+.namespace ["bar"]
+.sub init :vtable :method
+    .local pmc ar
+    ar = getattribute self, ['ResizablePMCArray'], 'proxy'
+    push ar, 1
+    push ar, 2
+.end
+
+.sub __yaml :method
+    .param pmc dumper
+    .param string label
+    print " {\n"
+    .local pmc ar
+    ar = getattribute self, ['ResizablePMCArray'], 'proxy'
+    dumper.'yaml'('attr', ar)
+    print "\n}"
+.end
+.namespace []
+
@@ -0,0 +1,17 @@
+
+.sub test :main
+    load_bytecode "yaml_dumper.pbc"
+    .local pmc array
+
+    new array, 'ResizablePMCArray'
+    push array, "charlie"
+    push array, "hotel"
+    push array, "alpha"
+    push array, "delta"
+    push array, "foxtrot"
+    push array, "golf"
+    push array, "bravo"
+    push array, "echo"
+
+    yaml( array, "strings" )
+.end
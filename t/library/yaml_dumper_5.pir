@@ -0,0 +1,29 @@
+
+.sub test :main
+    load_bytecode "yaml_dumper.pbc"
+    .local pmc array
+
+    new array, 'ResizablePMCArray'
+    push array, 0.1
+    push array, "charlie"
+    push array, 2
+    push array, "hotel"
+    push array, 5
+    push array, "alpha"
+    push array, 0.2
+    push array, "delta"
+    push array, 4
+    push array, "foxtrot"
+    push array, 0.5
+    push array, 0.4
+    push array, 1
+    push array, "golf"
+    push array, 0.3
+    push array, 3
+    push array, "bravo"
+    push array, 0.0
+    push array, 0
+    push array, "echo"
+
+    yaml( array, "array" )
+.end
@@ -0,0 +1,59 @@
+
+.sub test :main
+    load_bytecode "yaml_dumper.pbc"
+    .local pmc hash1
+    .local pmc hash2
+    .local pmc hash3
+    .local pmc array1
+    .local pmc array2
+
+    new hash1, 'Hash'
+    new hash2, 'Hash'
+    new hash3, 'Hash'
+    new array1, 'ResizablePMCArray'
+    new array2, 'ResizablePMCArray'
+
+    yaml( hash1,"hash1" )
+
+    $S0 = "hello"
+    $S1 = "world"
+    set hash1[$S0], $S1
+
+    yaml( hash1,"hash1" )
+
+    $S0 = "hello2"
+    $S1 = "world2"
+    set hash1[$S0], $S1
+
+    yaml( hash1,"hash1" )
+
+    $S0 = "hash2"
+    set hash1[$S0], hash2
+
+    yaml( hash1,"hash1" )
+
+    $S0 = "hello3"
+    $S1 = "world3"
+    set hash2[$S0], $S1
+
+    yaml( hash1,"hash1" )
+
+    $S0 = "name"
+    $S1 = "parrot"
+    set hash3[$S0], $S1
+    $S0 = "is"
+    $S1 = "cool"
+    set hash3[$S0], $S1
+
+    push array1, "this"
+    push array1, "is"
+    push array1, "a"
+    push array1, "test"
+    push array1, hash3
+
+    $S0 = "array1"
+    set hash2[$S0], array1
+
+    yaml( hash1,"hash1" )
+
+.end
@@ -0,0 +1,11 @@
+
+.sub test :main
+    load_bytecode "yaml_dumper.pbc"
+    .local pmc hash
+
+    new hash, 'Hash'
+
+    set hash["hello"], "world"
+    setprop hash, "backref", hash
+    yaml( hash )
+.end
@@ -11,16 +11,20 @@ t/oo/attributes.t - Test OO attributes
 
 =head1 DESCRIPTION
 
-Tests OO features related to adding and removing attributes.
+Tests OO features related to adding and removing attributes, attribute
+access through the slot cache of constant attribute names, and attributes
+stored as native values.
 
 =cut
 
 .sub main :main
     .include 'test_more.pir'
 
-    plan(3)
+    plan(20)
 
     remove_1()
+    cached_slots()
+    native_slots()
 .end
 
 .sub remove_1
@@ -71,6 +75,136 @@ Tests OO features related to adding and removing attributes.
 
 .end
 
+.sub cached_slots
+    .local pmc first, second, sub, over, obj
+    first = newclass 'CacheFirst'
+    addattribute first, 'name'
+    second = newclass 'CacheSecond'
+    addattribute second, 'pad'
+    addattribute second, 'name'
+    sub = subclass first, 'CacheSub'
+    addattribute sub, 'extra'
+    over = subclass first, 'CacheOverride'
+
+    # every access below goes through the same two call sites
+    obj = new first
+    set_name(obj, 'first')
+    $S0 = get_name(obj)
+    is($S0, 'first', 'cached slot for one class')
+
+    obj = new second
+    set_name(obj, 'second')
+    $S0 = get_name(obj)
+    is($S0, 'second', 'same site, other class with another slot')
+    $P0 = getattribute obj, 'pad'
+    $I0 = isnull $P0
+    ok($I0, 'other slots untouched')
+
+    obj = new sub
+    set_name(obj, 'sub')
+    $S0 = get_name(obj)
+    is($S0, 'sub', 'same site, inherited attribute')
+
+    obj = new over
+    set_name(obj, 'over')
+    $S0 = get_name(obj)
+    is($S0, 'overridden', 'same site, get_attr_str override still called')
+
+    obj = new first
+    set_name(obj, 'frozen')
+    $S1 = freeze obj
+    obj = thaw $S1
+    $S0 = get_name(obj)
+    is($S0, 'frozen', 'same site, thawed object')
+.end
+
+.sub native_slots
+    .local pmc class, obj, copy
+    class = newclass 'Native'
+    class.'add_attribute'('count', 'int')
+    class.'add_attribute'('ratio', 'num')
+    class.'add_attribute'('label', 'string')
+    addattribute class, 'other'
+    obj = new class
+
+    $I0 = getattribute obj, 'count'
+    is($I0, 0, 'int attribute starts at 0')
+    $P0 = getattribute obj, 'label'
+    $I0 = isnull $P0
+    ok($I0, 'string attribute starts null')
+
+    setattribute obj, 'count', 41
+    $I0 = getattribute obj, 'count'
+    inc $I0
+    setattribute obj, 'count', $I0
+    $I0 = getattribute obj, 'count'
+    is($I0, 42, 'int attribute set and get')
+
+    setattribute obj, 'ratio', 0.5
+    $N0 = getattribute obj, 'ratio'
+    is($N0, 0.5, 'num attribute set and get')
+
+    $S1 = 'label'
+    setattribute obj, $S1, 'tag'
+    $S0 = getattribute obj, 'label'
+    is($S0, 'tag', 'string attribute, name in a register')
+
+    $P0 = getattribute obj, 'count'
+    $S0 = typeof $P0
+    is($S0, 'Integer', 'native attribute boxed for the PMC op')
+    $P0 = box 7
+    setattribute obj, 'count', $P0
+    $I0 = getattribute obj, 'count'
+    is($I0, 7, 'native attribute unboxed from the PMC op')
+
+    $P0 = box 3
+    setattribute obj, 'other', $P0
+    $I0 = getattribute obj, 'other'
+    is($I0, 3, 'int op on a PMC attribute')
+
+    copy = clone obj
+    setattribute obj, 'count', 8
+    $I0 = getattribute copy, 'count'
+    is($I0, 7, 'clone copies native attributes')
+
+    $S0 = freeze obj
+    copy = thaw $S0
+    $I0 = getattribute copy, 'count'
+    $N0 = getattribute copy, 'ratio'
+    $S0 = getattribute copy, 'label'
+    $S0 = $S0 . ':'
+    $S1 = $N0
+    $S0 = $S0 . $S1
+    $S1 = $I0
+    $S0 = $S0 . ':'
+    $S0 = $S0 . $S1
+    is($S0, 'tag:0.5:8', 'freeze and thaw keep native attributes')
+    $I0 = getattribute copy, 'other'
+    is($I0, 3, 'freeze and thaw keep PMC attributes')
+.end
+
+.sub get_name
+    .param pmc obj
+    $P0 = getattribute obj, 'name'
+    $S0 = $P0
+    .return ($S0)
+.end
+
+.sub set_name
+    .param pmc obj
+    .param string value
+    $P0 = box value
+    setattribute obj, 'name', $P0
+.end
+
+.namespace ['CacheOverride']
+
+.sub 'get_attr_str' :vtable
+    .param string name
+    $P0 = box 'overridden'
+    .return ($P0)
+.end
+
 # Local Variables:
 #   mode: pir
 #   fill-column: 100
@@ -0,0 +1,28 @@
+.sub main :main
+    .local pmc type
+    newclass type, 'Parent'
+
+    .local pmc obj, exception
+    .local string message
+    message = 'no error'
+    push_eh handler
+        obj = new 'Parent'
+        print 'not '
+    pop_eh
+    goto finally
+
+  handler:
+    .get_results(exception)
+    finalize exception
+    pop_eh
+    message = exception
+
+  finally:
+    print "ok #"
+    say message
+.end
+
+.namespace ['Parent']
+.sub 'init' :vtable
+    die 'test exception from init vtable'
+.end
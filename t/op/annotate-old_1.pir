@@ -0,0 +1,8 @@
+.sub main :main
+    # Not using test more, just a quick way to pick a function
+    .include 'test_more.pir'
+    .annotate 'file', 'foobar'
+    .annotate 'line', 42
+    # Call with too many positional arguments
+    ok(0,0,0,0,0)
+.end
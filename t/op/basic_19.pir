@@ -0,0 +1,7 @@
+
+.sub _main :main
+     .const string OK = "ok\n"
+     print OK
+     end
+.end
+
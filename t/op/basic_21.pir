@@ -0,0 +1,6 @@
+.sub _main :main
+     .const string OK = "ok\n"
+     print OK
+     end
+.end
+
@@ -0,0 +1,6 @@
+.sub _main :main
+     .const string OK = "ok 1\n"
+     print OK
+     end
+.end
+
@@ -0,0 +1,7 @@
+
+.sub _main :main
+    print "ok\n"
+    end
+.end
+
+#.namespace
\ No newline at end of file
@@ -0,0 +1,3 @@
+.sub main
+       print "Parrot fl\ies"
+.end
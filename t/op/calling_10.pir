@@ -0,0 +1,12 @@
+.sub main :main
+    $P0 = new 'String'
+    $P0 = "hello\n"
+    find_name $P1, "foo"
+    # set_args and invoke must be adjacent
+    set_args "0", $P0
+    invokecc $P1
+.end
+.sub foo
+    get_params "0", $P0
+    print $P0
+.end
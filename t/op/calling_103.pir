@@ -0,0 +1,7 @@
+.sub main :main
+    foo($P0)
+.end
+
+.sub foo
+    .param int arg
+.end
@@ -0,0 +1,20 @@
+.sub main :main
+    $P0 = new 'String'
+    $P0 = "hello"
+    find_name $P1, "foo"
+    # set_args and invoke must be adjacent
+    set_args "0,0,0", $P0, 42, "bar"
+    invokecc $P1
+.end
+.sub foo
+    get_params "0x20", $P0
+    $S0 = $P0[0]
+    print $S0
+    print ' '
+    $S0 = $P0[1]
+    print $S0
+    print ' '
+    $S0 = $P0[2]
+    print $S0
+    print "\n"
+.end
@@ -0,0 +1,23 @@
+.sub main :main
+        foo( 101, 0.77, 'seven and seven is' )
+.end
+
+.sub foo
+        .param pmc some_int
+        .param pmc some_float
+        .param pmc some_string
+
+        $S0 = typeof some_int
+        print $S0
+        print "\n"
+
+        $S0 = typeof some_float
+        print $S0
+        print "\n"
+
+        $S0 = typeof some_string
+        print $S0
+        print "\n"
+
+        .return()
+.end
@@ -0,0 +1,26 @@
+.sub main :main
+    $P0 = new 'String'
+    $P0 = "hello"
+    $P1 = new 'Integer'
+    $P1 = 42
+    $P2 = new 'String'
+    $P2 = "again"
+    $P3 = new 'Float'
+    $P3 = 47.11
+    find_name $P10, "foo"
+    # set_args and invoke must be adjacent
+    set_args "0,0,0,0", $P0, $P1, $P2, $P3
+    invokecc $P10
+.end
+.sub foo
+    get_params "0,0,0,0", $P0, $I0, $S0, $N0
+    print $P0
+    print ' '
+    print $I0
+    print ' '
+    print $S0
+    print ' '
+    print $N0
+    print "\n"
+    returncc
+.end
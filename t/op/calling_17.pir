@@ -0,0 +1,8 @@
+.sub main :main
+    .include "errors.pasm"
+    errorson .PARROT_ERRORS_PARAM_COUNT_FLAG
+    foo(5)
+.end
+.sub foo
+    print "nada"
+.end
@@ -0,0 +1,12 @@
+.macro no_params
+    get_params '()'
+.endm
+.sub main :main
+    .include "errors.pasm"
+    errorson .PARROT_ERRORS_PARAM_COUNT_FLAG
+    foo(5)
+.end
+.sub foo
+    .no_params
+    print "nada"
+.end
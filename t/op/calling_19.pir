@@ -0,0 +1,13 @@
+.sub main :main
+    .include "errors.pasm"
+    errorson .PARROT_ERRORS_PARAM_COUNT_FLAG
+    $P0 = new 'String'
+    $P0 = "hello\n"
+    find_name $P1, "foo"
+    set_args "0,0", $P0, 77
+    invokecc $P1
+.end
+.sub foo
+    get_params "0", $P0
+    print $P0
+.end
@@ -0,0 +1,23 @@
+.sub main :main
+    .include "errors.pasm"
+    errorson .PARROT_ERRORS_PARAM_COUNT_FLAG
+    $P0 = new 'String'
+    $P0 = "hello\n"
+    find_name $P1, "foo"
+    set_args "0,0", $P0, 77
+    invokecc $P1
+.end
+.sub foo
+    push_eh arg_handler
+    get_params "0", $P0
+    print $P0
+    print "never\n"
+arg_handler:
+    get_results "0", $P1
+    $S0 = $P1
+    print "caught: "
+    print $S0
+#    $S1 = typeof $P1
+#    print "\nexception type: "
+#    print $S1
+.end
@@ -0,0 +1,17 @@
+.sub main :main
+    .include "errors.pasm"
+    errorson .PARROT_ERRORS_PARAM_COUNT_FLAG
+    $P0 = new 'String'
+    $P0 = "hello\n"
+    find_name $P1, "foo"
+    set_args "0", $P0
+    invokecc $P1
+.end
+.sub foo
+    get_params "0,0x80,0x100", $P0, $P1, $I0
+    print $P0
+    if_null $P1, ok
+    print "not "
+ok:
+    print "ok\n"
+.end
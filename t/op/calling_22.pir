@@ -0,0 +1,19 @@
+.sub main :main
+    .include "errors.pasm"
+    errorson .PARROT_ERRORS_PARAM_COUNT_FLAG
+    .local pmc ar
+    ar = new 'ResizableIntegerArray'
+    push ar, 1
+    push ar, 2
+    push ar, 3
+    push ar, 4
+    foo(ar :flat)
+    print "never\n"
+.end
+.sub foo
+    .param int i
+    .param int j     :optional
+    .param int got_j :opt_flag
+    .param int k     :optional
+    .param int got_k :opt_flag
+.end
@@ -0,0 +1,17 @@
+.sub main :main
+    .const 'Sub' f = "foo"
+    print "main\n"
+    invokecc f
+    get_results "0", $S0
+    print $S0
+.end
+.sub foo
+    .const 'Sub' b = "bar"
+    print "foo\n"
+    tailcall b
+.end
+.sub bar
+    print "bar\n"
+    set_returns "0", "bar_ret\n"
+    returncc
+.end
@@ -0,0 +1,20 @@
+.sub main :main
+    .const 'Sub' f = "foo"
+    print "main\n"
+    invokecc f
+    get_results "0", $S0
+    print $S0
+.end
+.sub foo
+    .const 'Sub' b = "bar"
+    print "foo\n"
+    set_args "0", "from_foo\n"
+    tailcall b
+.end
+.sub bar
+    get_params "0", $S0
+    print "bar\n"
+    print $S0
+    set_returns "0", "bar_ret\n"
+    returncc
+.end
@@ -0,0 +1,14 @@
+.sub main :main
+    $P0 = new 'String'
+    $P0 = "hello\n"
+    find_name $P1, "foo"
+    set_args "0x0", $P0
+    invokecc $P1
+.end
+.sub foo
+    get_params "0x80, 0x100", $P1, $I0
+    unless_null $P1, ok
+    print "not "
+ok:
+    print "ok\n"
+.end
@@ -0,0 +1,15 @@
+.sub main :main
+    $I0 = 77
+    foo(42, $I0)
+    print "back\n"
+.end
+
+.sub foo
+    get_params "0, 0", $I16, $I17
+    print $I16
+    print "\n"
+    print $I17
+    print "\n"
+    set_returns ""
+    returncc
+.end
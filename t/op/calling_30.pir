@@ -0,0 +1,20 @@
+.sub main :main
+    .local string s
+    s  = ".sub foo\n"
+    s .= ".param int i\n"
+    s .= ".param int j\n"
+    s .= "print i\n"
+    s .= "print ' '\n"
+    s .= "print j\n"
+    s .= "print \"\\n\"\n"
+    s .= ".return(99)\n"
+    s .= ".end\n"
+    .local pmc comp
+    comp = compreg "PIR"
+    $P0 = comp(s)
+    $I0 = 77
+    $I0 = foo(42, $I0)
+    print $I0
+    print "\n"
+.end
+
@@ -0,0 +1,17 @@
+.sub main :main
+    .const 'Sub' f = "foo"
+    print "main\n"
+    $S0 = f()
+    print $S0
+.end
+.sub foo
+    .const 'Sub' b = "bar"
+    print "foo\n"
+    .tailcall b("from_foo\n")
+.end
+.sub bar
+    .param string s
+    print "bar\n"
+    print s
+    .return ("bar_ret\n")
+.end
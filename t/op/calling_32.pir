@@ -0,0 +1,32 @@
+.sub main :main
+    foo_int(42, "42", 42.20)
+    foo_float(42, "42", 42.20)
+    foo_string(42, "42", 42.20)
+.end
+.sub foo_int
+    get_params "0,0,0", $I0, $I1, $I2
+    print $I0
+    print ' '
+    print $I1
+    print ' '
+    print $I2
+    print "\n"
+.end
+.sub foo_float
+    get_params "0,0,0", $N0, $N1, $N2
+    print $N0
+    print ' '
+    print $N1
+    print ' '
+    print $N2
+    print "\n"
+.end
+.sub foo_string
+    get_params "0,0,0", $S0, $S1, $S2
+    print $S0
+    print ' '
+    print $S1
+    print ' '
+    print $S2
+    print "\n"
+.end
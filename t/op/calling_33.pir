@@ -0,0 +1,11 @@
+.const int MYCONST = -2
+.sub main :main
+    $P0 = new 'String'
+    "foo"(MYCONST)
+.end
+.sub "foo"
+    .param string str1 :optional
+    .param int has_s   :opt_flag
+    print str1
+    print "\n"
+.end
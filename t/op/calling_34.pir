@@ -0,0 +1,16 @@
+.sub main :main
+    $P0 = new 'String'
+    $P0 = "hello\n"
+    foo($P0)
+    foo()
+.end
+.sub foo
+    .param pmc p1  :optional
+    .param int i1  :opt_flag
+
+    if_null p1, skip
+    print p1
+skip:
+    print i1
+    print "\n"
+.end
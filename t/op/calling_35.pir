@@ -0,0 +1,33 @@
+.sub main :main
+    $P0 = new 'String'
+    $P0 = "ok 1\n"
+    foo($P0, "ok 2\n", "ok 3\n")
+.end
+.sub foo
+    .param pmc p1  :optional
+    .param int i1  :opt_flag
+    .param pmc p2  :optional
+    .param int i2  :opt_flag
+    .param pmc p3  :optional
+    .param int i3  :opt_flag
+    .param pmc p4  :optional
+    .param int i4  :opt_flag
+
+    print p1
+    print p2
+    print p3
+    if_null p4, ok
+    print "not "
+ok:
+    print "ok 4\n"
+    print i1
+    print ' '
+    print i2
+    print ' '
+    print i3
+    print ' '
+    print i4
+    print "\n"
+.end
+
+
@@ -0,0 +1,16 @@
+.sub main :main
+    .local pmc f
+    $I0 = 99
+    f = get_global "foo"
+    .begin_call
+    .call f
+    .get_result   $P0 :optional
+    .get_result   $I0 :opt_flag
+    .end_call
+    unless $I0,  ex
+    print "not "
+ex:
+    print "ok 1\n"
+.end
+.sub foo
+.end
@@ -0,0 +1,32 @@
+.sub main :main
+    .local pmc a, b
+    a = new 'Integer'
+    a = 1
+    b = new 'Integer'
+    b = 2
+    .local pmc c, d
+    (c, d) = foo(a, b)
+    eq_addr a, c, ok1
+    print "not "
+ok1:
+    print "ok 1\n"
+    eq_addr b, d, ok2
+    print "not "
+ok2:
+    print "ok 2\n"
+.end
+
+.sub foo
+    .param pmc a
+    .param pmc b
+    $P0 = new 'Integer'
+    $P0 = 3
+    .tailcall bar($P0, a, b)
+.end
+
+.sub bar
+    .param pmc x
+    .param pmc a
+    .param pmc b
+    .return (a, b)
+.end
@@ -0,0 +1,28 @@
+.sub main :main
+    .local pmc cl, o, f
+    cl = newclass "Foo"
+    o = new "Foo"
+    o."bar"("ok 1\n")
+    f = get_global ["Foo"], "bar"
+    f(o, "ok 2\n")
+    o."baz"("ok 3\n")
+    f = get_global ["Foo"], "baz"
+    f(o, "ok 4\n")
+.end
+.namespace ["Foo"]
+.sub bar :method :nsentry('bar')
+    .param string s
+    print self
+    print " "
+    print s
+.end
+.sub baz :method :nsentry('baz')
+    .param string s
+    print self
+    print " "
+    print s
+.end
+.sub get_string :vtable :method
+    $S0 = typeof self
+    .return ($S0)
+.end
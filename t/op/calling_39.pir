@@ -0,0 +1,25 @@
+.sub main :main
+    .local pmc cl, o, f
+    cl = newclass "Foo"
+    o = new "Foo"
+    $S0 = o
+    print $S0
+    $S1 = o[2]
+    print $S1
+    print $S0
+.end
+.namespace ["Foo"]
+.sub get_string :vtable :method
+    $S0 = typeof self
+    print $S0
+    print " "
+    .return ("ok 1\n")
+.end
+.sub get_string_keyed_int :vtable :method
+    .param int key
+    $S0 = "ok "
+    $S1 = key
+    $S0 .= $S1
+    $S0 .= "\n"
+    .return ($S0)
+.end
@@ -0,0 +1,19 @@
+.sub main :main
+    .local pmc cl, o, f
+    cl = newclass "Foo"
+    o = new "Foo"
+    $S0 = foo(o)
+    print $S0
+.end
+.sub foo
+    .param pmc arg
+    .return (arg) # force conversion to string
+.end
+.namespace ["Foo"]
+.sub get_string :vtable :method
+    $S0 = typeof self
+    print $S0
+    print " "
+    .return ("ok 1\n")
+.end
+
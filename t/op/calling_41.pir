@@ -0,0 +1,20 @@
+.sub main :main
+    $P0 = new 'String'
+    $P0 = "ok 1\n"
+    $P1 = new 'String'
+    $P1 = "ok 2\n"
+    $P0 = foo($P0, $P1)
+    print $P0
+.end
+.sub foo
+    .param pmc p :slurpy
+    .tailcall bar(p)
+.end
+.sub bar
+    .param pmc p
+    .local pmc q
+    q = p[0]
+    print q
+    q = p[1]
+    .return (q)
+.end
@@ -0,0 +1,12 @@
+.sub _fn1
+        .param pmc rest_arg :slurpy
+        print "[in _fn1]\n"
+        print rest_arg
+        print "\n"
+.end
+.sub main :main
+        $P34 = new 'ResizablePMCArray'
+        $P34 = 0
+        ## normal flattening direct call, non-slurpy returns
+        $P35 = _fn1($P34 :flat)
+.end
@@ -0,0 +1,29 @@
+.sub _fn1
+    .param int arg1
+    .param int arg2
+    .param int arg3
+    .param int arg4
+    print arg1
+    print ' '
+    print arg2
+    print ' '
+    print arg3
+    print ' '
+    print arg4
+    print "\n"
+.end
+.sub main :main
+    .include "errors.pasm"
+    errorson .PARROT_ERRORS_PARAM_COUNT_FLAG
+    $P30 = new 'Integer'
+    $P30 = 2
+    $P31 = new 'Integer'
+    $P31 = 3
+    $P34 = new 'ResizablePMCArray'
+    $P34 = 4
+    $P34[0] = $P30
+    $P34[1] = $P31
+    $P34[2] = $P30
+    $P34[3] = $P31
+    $P35 = _fn1(1, $P34 :flat)
+.end
@@ -0,0 +1,11 @@
+.sub _fn1
+    .param pmc one
+    .param pmc two
+    .param pmc opt        :optional
+    .param int have_opt   :opt_flag
+.end
+.sub main :main
+    .include "errors.pasm"
+    errorson .PARROT_ERRORS_PARAM_COUNT_FLAG
+    $P35 = _fn1(1, 2, 3, 4)
+.end
@@ -0,0 +1,13 @@
+.sub main :main
+    .local pmc s
+    s = new 'String'
+    $I0 = s."is_integer"(22)
+    say $I0
+    $I1 = foo(s)
+    say $I1
+.end
+.sub foo
+    .param pmc s
+    $I0 = s."is_integer"(22)
+    .return ($I0)
+.end
@@ -0,0 +1,14 @@
+.sub main :main
+    $P0 = eval("print \"Foo!\\n\"")
+    $P0 = $P0.'first_sub_in_const_table'()
+    $P0()
+    end
+.end
+
+.sub eval
+    .param string code
+    code = ".sub main :main :anon\n" . code
+    code = code . "\n.end\n"
+    $P0 = compreg "PIR"
+    .tailcall $P0(code)
+.end
@@ -0,0 +1,23 @@
+.sub main :main
+    .local string s
+    .local pmc outer
+    s =  ".namespace [ \"XYZ\" ]\n"
+    s .= ".sub outer\n"
+    s .= "    .param int n\n"
+    s .= "    $I0 = n % 1000\n"
+    s .= "    if $I0 goto end\n"
+    s .= "    print n\n"
+    s .= "    print \"\\n\"\n"
+    s .= "  end:\n"
+    s .= ".end\n"
+    $P0 = compreg "PIR"
+    $P0(s)
+    outer = get_global ["XYZ"], "outer"
+    $I1 = 0
+  loop:
+    inc $I1
+    if $I1 > 10000 goto end
+    outer($I1)
+    goto loop
+  end:
+.end
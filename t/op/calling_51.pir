@@ -0,0 +1,17 @@
+.sub main :main
+    ($I0, $I1) = foo()
+    print $I0
+    print $I1
+    print "\n"
+.end
+.sub foo
+    .const 'Sub' b = "bar"
+    $I0 = 10
+    $I1 = 20
+    set_args "0,0", $I1, $I0
+    tailcall b
+.end
+.sub bar
+    get_params "0,0", $I0, $I1
+    .return ($I0, $I1)
+.end
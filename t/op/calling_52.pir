@@ -0,0 +1,25 @@
+.sub main :main
+    foo()
+    print "ok\n"
+.end
+.sub foo
+    .const 'Sub' b = "bar"
+    .tailcall b(10, 20)
+.end
+.sub bar
+    .param int a
+    .param int b
+    .param int c :optional
+    .param int has_c :opt_flag
+    print a
+    print ' '
+    print b
+    print ' '
+    unless has_c goto no_c
+    print c
+    goto got_c
+no_c:
+    print 'no'
+got_c:
+    print "\n"
+.end
@@ -0,0 +1,31 @@
+.sub main :main
+    foo()
+    print "ok\n"
+.end
+
+.sub foo
+    .local pmc cl, o
+    cl = newclass "MyClass"
+    o = new "MyClass"
+    $S0 = "key"
+    $I0 = 3
+    o[$S0;$I0] = 42
+.end
+
+.namespace ["MyClass"]
+
+# key arguments in register have to be expanded into their
+# values because in the called sub frame the original refered
+# registers just don't exist              #' for vim
+
+.sub set_integer_keyed :vtable :method
+    .param pmc key
+    .param int val
+    print key             # print first key
+    print ' '
+    key = shift key       # get next key
+    print key
+    print ' '
+    print val
+    print "\n"
+.end
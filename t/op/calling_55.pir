@@ -0,0 +1,19 @@
+.sub main :main
+    test()
+    $P0 = new 'FixedIntegerArray'
+    set_result_info $P0
+    $P0 = 1
+    $I0 = test()
+    $P0 = new 'FixedIntegerArray'
+    $P0 = 3
+    set_result_info $P0
+    ($I1, $I2, $I3) = test()
+.end
+
+.sub test
+    $P0 = result_info
+    $I0 = elements $P0
+    print $I0
+    print "\n"
+    .return (0)
+.end
@@ -0,0 +1,25 @@
+.sub main :main
+    $S0 = <<"TESTSUB"
+.sub test
+    $P0 = result_info
+    $I0 = elements $P0
+    print $I0
+    print "\\n"
+.end
+TESTSUB
+    $P0 = compreg "PIR"
+    $P1 = $P0($S0)
+    $P0 = new 'FixedIntegerArray'
+    set_result_info $P0
+    test()
+
+    $P0 = new 'FixedIntegerArray'
+    $P0 = 1
+    set_result_info $P0
+    $I0 = test()
+
+    $P0 = new 'FixedIntegerArray'
+    $P0 = 3
+    set_result_info $P0
+    ($I1, $I2, $I3) = test()
+.end
@@ -0,0 +1,10 @@
+.sub main :main
+   ($P0 :slurpy) = foo()
+   $S0 = $P0[0]
+   print $S0
+   $S0 = $P0[1]
+   print $S0
+.end
+.sub foo
+   .return("ok 1\n", "ok 2\n")
+.end
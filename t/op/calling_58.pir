@@ -0,0 +1,12 @@
+.sub main :main
+   ($S0 :optional, $I1 :opt_flag) = foo()
+   unless $I1 goto no_ret
+   print "ok 1\n"
+   print $S0
+   end
+no_ret:
+   print "not ok 1\n"
+.end
+.sub foo
+   .return("ok 2\n")
+.end
@@ -0,0 +1,11 @@
+.sub main :main
+   ($S0 :optional, $I1 :opt_flag) = foo()
+   if $I1 goto has_ret
+   print "ok 1\n"
+   end
+has_ret:
+   print "not ok 1\n"
+.end
+.sub foo
+   .return()
+.end
@@ -0,0 +1,20 @@
+.sub main :main
+    .local string result
+    result = foo("ok 1\n")
+    print result
+.end
+
+.sub foo
+    .param string s
+    .local pmc cc
+    .include 'interpinfo.pasm'
+    cc = interpinfo .INTERPINFO_CURRENT_CONT
+    bar(cc, s)
+.end
+
+.sub bar
+    .param pmc cc
+    .param string s
+    print s
+    cc("ok 2\n")
+.end
@@ -0,0 +1,18 @@
+.sub main :main
+    .local string result
+    result = "not ok 2\n"
+    .local pmc cont
+    cont = new 'Continuation'
+    set_label cont, cont_dest
+    bar(cont, "ok 1\n")
+    print "oops\n"
+cont_dest:
+    print "ok 2\n"
+.end
+
+.sub bar
+    .param pmc cc
+    .param string s
+    print s
+    .tailcall cc()
+.end
@@ -0,0 +1,55 @@
+## regression test for newclosure followed by tailcall, which used to recycle
+## the context too soon.  it looks awful because (a) the original version was
+## produced by a compiler, and (b) in order to detect regression, we must force
+## parrot to reuse the context, which seems to requires having other calls that
+## use particular numbers of registers (and probably a fair amount of luck).
+.sub _main :main
+        ## debug 0x80
+        .lex "MAIN-CONT", $P41
+        $I42 = 10
+        $P41 = new 'Continuation'
+        set_label $P41, L2
+        goto L3
+L2:
+        get_results '0', $P45
+        print "got "
+        print $P45
+        print ".\n"
+        .return ()
+L3:
+        .const 'Sub' $P49 = "___internal_main_test_"
+        newclosure $P48, $P49
+        .tailcall _try_it($I42, $P48)
+.end
+
+.sub ___internal_main_test_ :outer('_main')
+        .param pmc arg1
+        print "[in test]\n"
+        find_lex $P41, "MAIN-CONT"
+        $P55 = new "Undef"
+        if arg1 != 3 goto L3
+        $P58 = arg1
+        $P59 = arg1
+        $P57 = mul $P58, $P59
+        set_args '(0)', $P57
+        tailcall $P41
+L3:
+        print "not "
+        print arg1
+        print "\n"
+.end
+
+
+# TODO -O1 error
+.sub _try_it
+        .param int n
+        .param pmc closure
+        $P42 = new "Undef"
+        $P42 = 0
+        goto L4
+L2:
+        closure($P42)
+        $P42 = $P42 + 1
+L4:
+        if $P42 < n goto L2
+.end
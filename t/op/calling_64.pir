@@ -0,0 +1,20 @@
+.sub main :main
+    .local string s
+    .local pmc cl, o
+    cl = newclass "Foo"
+    s = <<"END_PIR"
+.namespace ['Foo']
+.sub get_integer_keyed_int :vtable :method
+    .param int i
+    i += 5
+    .return(i)
+.end
+END_PIR
+    .local pmc comp
+    comp = compreg "PIR"
+    $P0 = comp(s)
+    o = new 'Foo'
+    $I0 = o[12]
+    print $I0
+    print "\n"
+.end
@@ -0,0 +1,11 @@
+.sub main :main
+        _write_thing(3, 4, 5)
+.end
+.sub _write_thing
+        .param pmc arg1 :optional
+        .param pmc rest_arg :slurpy
+        print arg1
+        print ' '
+        print rest_arg
+        print "\n"
+.end
@@ -0,0 +1,16 @@
+.sub main :main
+        foo( 10 :named("b"), 20 :named("a"))
+        print "ok\n"
+        end
+.end
+
+.sub foo
+        .param int c :named("a")
+        .param int d :named("b")
+
+        print d
+        print ' '
+        print c
+        print "\n"
+        .return()
+.end
@@ -0,0 +1,22 @@
+.sub main :main
+        ($I0 :named("b"), $I1 :named("a")) = foo( 10 :named("b"), 20 :named("a"))
+        print $I0
+        print ' '
+        print $I1
+        print "\n"
+        print "ok\n"
+
+        end
+.end
+
+.sub foo
+        .param int c :named("a")
+        .param int d :named("b")
+
+        print d
+        print ' '
+        print c
+        print "\n"
+
+        .return ( 10 :named("a"), 20 :named("b"))
+.end
@@ -0,0 +1,18 @@
+.sub main :main
+        foo ('a'=>20,'b'=>10)
+        print "ok\n"
+
+        end
+.end
+
+.sub foo
+        .param int c :named("a")
+        .param int d :named("b")
+
+        print d
+        print ' '
+        print c
+        print "\n"
+
+        .return ()
+.end
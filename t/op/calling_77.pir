@@ -0,0 +1,13 @@
+.sub main :main
+        foo ('a'=>20,'b'=>10)
+        print "ok\n"
+.end
+
+.sub foo
+        .param int d :named('b')
+        .param int c :named('a') :optional
+        print d
+        print ' '
+        print c
+        print "\n"
+.end
@@ -0,0 +1,19 @@
+.sub main :main
+        foo ('a'=>20,'b'=>10)
+        print "ok\n"
+.end
+
+.sub foo
+        .param int d :named('b') :optional
+        .param int has_d :opt_flag
+        .param int c :named('a') :optional
+        .param int has_c :opt_flag
+        print d
+        print ' '
+        print has_d
+        print ' '
+        print c
+        print ' '
+        print has_c
+        print "\n"
+.end
@@ -0,0 +1,19 @@
+.sub main :main
+        .local pmc h
+        h = new 'Hash'
+        h['a'] = 20
+        h['b'] = 10
+        foo( h :named :flat )
+        print "ok\n"
+        end
+.end
+
+.sub foo
+        .param pmc h :named :slurpy
+        $I0 = h['a']
+        $I1 = h['b']
+        print $I0
+        print ' '
+        print $I1
+        print "\n"
+.end
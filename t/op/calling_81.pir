@@ -0,0 +1,10 @@
+.sub main :main
+        foo( "b" => 10, "a" => 20)
+        print "never\n"
+        end
+.end
+
+.sub foo
+        .param int  c :named("foo") :named("bar")
+        .param int "b" => d
+.end
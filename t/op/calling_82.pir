@@ -0,0 +1,11 @@
+.sub main :main
+        print 1
+        foo(1)
+        foo(2)
+        foo()
+        print "\n"
+.end
+.sub foo
+        .param int var :optional
+        print var
+.end
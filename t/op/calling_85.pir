@@ -0,0 +1,15 @@
+.sub main :main
+    .include "errors.pasm"
+    errorson .PARROT_ERRORS_PARAM_COUNT_FLAG
+        foo ('a'=>10, 'b'=>20, 'c'=>30)
+        print "ok\n"
+.end
+
+.sub foo
+        .param int d :named('b')
+        .param int c :named('a')
+        print d
+        print ' '
+        print c
+        print "\n"
+.end
@@ -0,0 +1,18 @@
+.sub main :main
+    foo(0, 'abc' => 1)
+    foo('abc' => 2)
+    $P0 = new 'ResizablePMCArray'
+    push $P0, 1
+    foo($P0 :flat, 'abc' => 3)
+    $P0 = new 'ResizablePMCArray'
+    foo($P0 :flat, 'abc' => 4)
+.end
+
+.sub foo
+        .param pmc array :slurpy
+        .param pmc hash :slurpy :named
+        print "ok "
+        $P0 = hash['abc']
+        print $P0
+        print "\n"
+.end
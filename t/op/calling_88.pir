@@ -0,0 +1,21 @@
+.sub main :main
+    $P0 = new 'Hash'
+    $P0['a'] = 11
+    $P0['b'] = 22
+    $P0['c'] = 33
+    foo(0, 1, $P0 :flat :named)
+.end
+
+.sub foo
+    .param pmc array :slurpy
+    .param pmc hash :slurpy :named
+    $I0 = elements array
+    print $I0
+    print "\n"
+    $P0 = hash['a']
+    say $P0
+    $P0 = hash['b']
+    say $P0
+    $P0 = hash['c']
+    say $P0
+.end
@@ -0,0 +1,19 @@
+.sub main :main
+  .local string s, r
+  .local pmc arr
+
+  say "get"
+  s = s_get()
+  r = substr s, 0, 1
+  print "'"
+  print r
+  print "'"
+  say " done"
+.end
+
+.sub s_get
+  .local pmc arr
+  arr = new ["ResizableStringArray"]
+  # push arr, "xy"
+  .return(arr :flat )
+.end
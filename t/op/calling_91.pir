@@ -0,0 +1,8 @@
+.sub 'main' :main
+    'foo'('abc', 'def'=>1, 'ghi', 'jkl'=>1)
+.end
+
+.sub 'foo'
+    .param string name
+    .param pmc args :slurpy :named
+.end
@@ -0,0 +1,17 @@
+.sub 'main' :main
+        .local pmc args
+        args = new 'Hash'
+        args['foo'] = 1
+        args['bar'] = 2
+
+        bar_only( args :flat :named )
+.end
+
+.sub 'bar_only'
+        .param string bar  :named( 'bar' )
+        .param pmc    args :named :slurpy
+
+        print "Have bar: "
+        print bar
+        print "\n"
+.end
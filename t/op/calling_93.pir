@@ -0,0 +1,33 @@
+.sub main :main
+    $P0 = create_closure_and_run_it()
+.end
+
+.sub create_closure_and_run_it
+    $P0 = new "Integer"
+    $P0 = 3
+    .lex "val", $P0
+    $P2 = get_global "myclosure"
+    $P1 = newclosure $P2
+    # There is a closure depending on our current context, so this shouldn't
+    # free it.
+    .tailcall $P1()
+.end
+
+.sub myclosure :outer(create_closure_and_run_it)
+    $P1 = find_lex "val"
+    say $P1
+    donothing()
+    $P1 = find_lex "val"
+    say $P1
+    .return ()
+.end
+
+.sub donothing
+    $P0 = new "Integer"
+    $P0 = 5
+    # This creates a new binding that is not accessible by the
+    # caller (myclosure)
+    .lex "val", $P0
+    null $P2
+    null $P1
+.end
@@ -0,0 +1,22 @@
+.sub main :main
+    foo(0, 'abc' => 1)
+    foo('abc' => 2)
+    $P0 = new 'ResizablePMCArray'
+    push $P0, 1
+    foo($P0 :flat, 'abc' => 3)
+    $P0 = new 'ResizablePMCArray'
+    foo($P0 :flat, 'abc' => 4)
+    $P0 = new 'Hash'
+    $P0['abc'] = 5
+    foo($P0 :named :flat)
+.end
+
+.sub foo
+        .param pmc val     :optional
+        .param int has_val :opt_flag
+        .param pmc hash    :slurpy :named
+        print "ok "
+        $P0 = hash['abc']
+        print $P0
+        print "\n"
+.end
@@ -0,0 +1,6 @@
+.sub main :main
+  foo(1)
+.end
+
+.sub foo
+.end
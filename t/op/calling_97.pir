@@ -0,0 +1,18 @@
+.sub 'main' :main
+    $S0 = 'foo'
+    example('foo' => 42)              # normal named parameter
+    example( $S0  => 42)              # parameter named by non-const register
+    just_a_string( $S0, 'foo' => 42 ) # nameyness should not stick on register
+.end
+
+.sub 'example'
+    .param pmc foo :named('foo')
+    say foo
+.end
+
+.sub 'just_a_string'
+    .param pmc bar
+    .param int baz :named( 'foo' )
+    say bar
+    say baz
+.end
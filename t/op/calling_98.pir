@@ -0,0 +1,18 @@
+.sub 'main' :main
+    $P0   = new ['Undef']
+    ($P0) = foo()
+    unless null $P0 goto L1
+    $S0 = "PMCNULL"
+    goto L2
+  L1:
+    $S0   = typeof $P0
+  L2:
+    say $S0
+.end
+
+.sub 'foo'
+    .param pmc arg :slurpy
+    $S0 = typeof arg
+    say $S0
+    .return (arg :flat)
+.end
@@ -0,0 +1,18 @@
+.sub 'test' :main
+    .include 'errors.pasm'
+    errorson .PARROT_ERRORS_PARAM_COUNT_FLAG
+    errorson .PARROT_ERRORS_RESULT_COUNT_FLAG
+
+
+
+
+    () = 'args0_results0__params0_returns0'()
+    print "ok\n"
+.end
+
+.sub 'args0_results0__params0_returns0'
+    get_params '()'
+
+
+    .return()
+.end
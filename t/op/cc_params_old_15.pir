@@ -0,0 +1,21 @@
+.sub 'test' :main
+    .include 'errors.pasm'
+    errorson .PARROT_ERRORS_PARAM_COUNT_FLAG
+    errorson .PARROT_ERRORS_RESULT_COUNT_FLAG
+
+    .local int arg1
+    arg1 = 0
+
+
+
+    () = 'args1_results0__params2_returns0'(arg1)
+    print "ok\n"
+.end
+
+.sub 'args1_results0__params2_returns0'
+    .param int param1
+    .param int param2
+
+
+    .return()
+.end
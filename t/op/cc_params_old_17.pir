@@ -0,0 +1,20 @@
+.sub 'test' :main
+    .include 'errors.pasm'
+    errorson .PARROT_ERRORS_PARAM_COUNT_FLAG
+    errorson .PARROT_ERRORS_RESULT_COUNT_FLAG
+
+    .local int arg1
+    arg1 = 0
+
+    .local int result1
+
+    (result1) = 'args1_results1__params0_returns0'(arg1)
+    print "ok\n"
+.end
+
+.sub 'args1_results1__params0_returns0'
+    get_params '()'
+
+
+    .return()
+.end
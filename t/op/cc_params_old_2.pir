@@ -0,0 +1,20 @@
+.sub 'test' :main
+    .include 'errors.pasm'
+    errorson .PARROT_ERRORS_PARAM_COUNT_FLAG
+    errorson .PARROT_ERRORS_RESULT_COUNT_FLAG
+
+
+
+
+    () = 'args0_results0__params0_returns1'()
+    print "ok\n"
+.end
+
+.sub 'args0_results0__params0_returns1'
+    get_params '()'
+    .local int return1
+    return1 = 0
+
+
+    .return(return1)
+.end
@@ -0,0 +1,23 @@
+.sub 'test' :main
+    .include 'errors.pasm'
+    errorson .PARROT_ERRORS_PARAM_COUNT_FLAG
+    errorson .PARROT_ERRORS_RESULT_COUNT_FLAG
+
+    .local int arg1
+    arg1 = 0
+
+    .local int result1
+
+    (result1) = 'args1_results1__params2_returns1'(arg1)
+    print "ok\n"
+.end
+
+.sub 'args1_results1__params2_returns1'
+    .param int param1
+    .param int param2
+    .local int return1
+    return1 = 0
+
+
+    .return(return1)
+.end
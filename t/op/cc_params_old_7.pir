@@ -0,0 +1,21 @@
+.sub 'test' :main
+    .include 'errors.pasm'
+    errorson .PARROT_ERRORS_PARAM_COUNT_FLAG
+    errorson .PARROT_ERRORS_RESULT_COUNT_FLAG
+
+
+    .local int result1
+
+    (result1) = 'args0_results1__params0_returns2'()
+    print "ok\n"
+.end
+
+.sub 'args0_results1__params0_returns2'
+    get_params '()'
+    .local int return1, return2
+    return1 = 0
+    return2 = 1
+
+
+    .return(return1, return2)
+.end
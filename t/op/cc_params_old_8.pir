@@ -0,0 +1,18 @@
+.sub 'test' :main
+    .include 'errors.pasm'
+    errorson .PARROT_ERRORS_PARAM_COUNT_FLAG
+    errorson .PARROT_ERRORS_RESULT_COUNT_FLAG
+
+
+    .local int result1
+
+    (result1) = 'args0_results1__params1_returns0'()
+    print "ok\n"
+.end
+
+.sub 'args0_results1__params1_returns0'
+    .param int param1
+
+
+    .return()
+.end
@@ -0,0 +1,9 @@
+.sub 'main' :main
+    () =  'foo'('abc')
+    say 'ok'
+.end
+
+.sub 'foo'
+.param pmc abc
+
+.end
@@ -0,0 +1,9 @@
+.sub 'main' :main
+    () =  'foo'()
+    say 'ok'
+.end
+
+.sub 'foo'
+.param pmc abc :named('x')
+
+.end
@@ -0,0 +1,9 @@
+.sub 'main' :main
+    () =  'foo'('abc', 'def')
+    say 'ok'
+.end
+
+.sub 'foo'
+.param pmc abc :slurpy
+
+.end
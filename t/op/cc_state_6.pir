@@ -0,0 +1,9 @@
+.sub 'main' :main
+    () =  'foo'(123)
+    say 'ok'
+.end
+
+.sub 'foo'
+.param pmc x :named('x')
+
+.end
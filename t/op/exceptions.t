@@ -5,7 +5,7 @@ use strict;
 use warnings;
 use lib qw( . lib ../lib ../../lib );
 use Test::More;
-use Parrot::Test tests => 32,
+use Parrot::Test tests => 33,
     qw[run_command slurp_file];
 use Parrot::Test::Util 'create_tempfile';
 
@@ -500,6 +500,31 @@ something broke
 current inst/
 OUTPUT
 
+pir_output_like( <<'CODE', <<'OUTPUT', 'backtrace lines, later pc first' );
+.sub main :main
+    goto later
+  earlier:
+    boom()
+    end
+  later:
+    boom()
+    goto earlier
+.end
+
+.sub boom
+    $P0 = new 'Exception'
+    push_eh handler
+    throw $P0
+  handler:
+    .get_results($P0)
+    $P1 = $P0.'backtrace_strings'()
+    $S0 = $P1[0]
+    say $S0
+.end
+CODE
+/called from Sub 'main' pc \d+ \(.*:7\).*called from Sub 'main' pc \d+ \(.*:4\)/s
+OUTPUT
+
 pir_error_output_like( <<'CODE', <<'OUTPUT', 'die_s' );
 .sub main :main
     die 'We are dying str!'
@@ -0,0 +1,4 @@
+.sub main :main
+    pop_eh
+    print "no exceptions.\n"
+.end
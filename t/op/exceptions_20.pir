@@ -0,0 +1,23 @@
+.sub main :main
+    .local pmc outer, cont
+    push_eh handler
+    test1()
+    print "skipped.\n"
+    goto done
+handler:
+    .local pmc exception
+    .get_results (exception)
+    $S0 = exception
+    print "Error: "
+    print $S0
+    print "\n"
+done:
+    print "done.\n"
+.end
+.sub test1
+    .local pmc exit
+    print "[in test1]\n"
+    ## pop_eh is illegal here, and signals an exception.
+    pop_eh
+    print "[cleared]\n"
+.end
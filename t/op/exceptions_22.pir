@@ -0,0 +1,6 @@
+.sub main :main
+    print "main\n"
+    $P0 = new 'Exception'
+    throw $P0
+    .return()
+.end
@@ -0,0 +1,20 @@
+.sub main :main
+    .local pmc a
+    .lex 'a', a
+    a = new 'Integer'
+    a = 42
+    push_eh handler
+    exit 0
+handler:
+    .const 'Sub' $P0 = 'exit_handler'
+    capture_lex $P0
+    .tailcall $P0()
+.end
+
+.sub exit_handler :outer(main)
+    say "at_exit"
+    .local pmc a
+    a = find_lex 'a'
+    print 'a = '
+    say a
+.end
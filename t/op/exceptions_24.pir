@@ -0,0 +1,21 @@
+## This tests that error handlers are out of scope when invoked (necessary for
+## rethrow) when the error is signalled in another sub.
+.sub main :main
+    push_eh handler
+    broken()
+    print "not reached.\n"
+handler:
+    .local pmc exception
+    .get_results (exception)
+    $S0 = exception
+    print "in handler.\n"
+    print $S0
+    print "\n"
+    rethrow exception
+.end
+
+.sub broken
+    $P0 = new 'Exception'
+    $P0 = "something broke"
+    throw $P0
+.end
@@ -0,0 +1,20 @@
+.sub main :main
+    goto later
+  earlier:
+    boom()
+    end
+  later:
+    boom()
+    goto earlier
+.end
+
+.sub boom
+    $P0 = new 'Exception'
+    push_eh handler
+    throw $P0
+  handler:
+    .get_results($P0)
+    $P1 = $P0.'backtrace_strings'()
+    $S0 = $P1[0]
+    say $S0
+.end
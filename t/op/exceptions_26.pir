@@ -0,0 +1,3 @@
+.sub main :main
+    die 'We are dying str!'
+.end
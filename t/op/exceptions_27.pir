@@ -0,0 +1,6 @@
+.sub main :main
+    .local pmc msg
+    msg = new 'String'
+    msg = 'We are dying pmc!'
+    die msg
+.end
@@ -0,0 +1,21 @@
+.sub main :main
+    print "before calling setup_foo\n"
+    setup_foo()
+    print "after calling setup_foo\n"
+    end
+.end
+
+.sub setup_foo
+    print "in setup_foo\n"
+    newclass $P0, "Foo"
+    push_eh handler
+    newclass $P0, "Foo"
+    pop_eh
+resume:
+    print "running more code\n"
+    .return()
+handler:
+    print "in handler\n"
+    goto resume
+.end
+
@@ -0,0 +1,19 @@
+.sub main :main
+    print "before calling setup_foo\n"
+    setup_foo()
+    print "after calling setup_foo\n"
+    end
+.end
+
+.sub setup_foo
+    print "in setup_foo\n"
+    newclass $P0, "Foo"
+    push_eh handler
+    newclass $P0, "Foo"
+    pop_eh
+resume:
+    print "never reached\n"
+handler:
+    print "in handler\n"
+    .return()
+.end
@@ -0,0 +1,51 @@
+# This test is a simplified version of PGE's grammar creation code.
+
+.sub main :main
+    $P1 = newclass 'FirstClass'
+    $P1 = newclass 'MakerClass'
+
+    $P0 = new 'String'
+    $P0 = 'Foo'
+    $P1 = newclass $P0
+
+    print "before compile\n"
+    compile($P0)
+    print "after compile\n"
+    end
+.end
+
+.sub compile
+    .param string classname
+    print "in compile subroutine\n"
+    $P0 = new 'FirstClass'
+    $P1 = $P0.'compile'(classname)
+    print "returned from handler\nException message: "
+    print $P1
+.end
+
+.namespace [ "FirstClass" ]
+.sub 'compile' :method
+    .param pmc name
+    print "in compile method\n"
+    $P1 = new 'String'
+    $P1 = "no exception\n"
+  make_grammar:
+    push_eh handler
+    $P0 = new 'MakerClass'
+    $P0.'make'(name)
+    pop_eh
+    .return($P1)
+  handler:
+    get_results "0", $P2
+    print "in handler\n"
+  .return ($P2)
+.end
+
+.namespace [ "MakerClass" ]
+.sub 'make' :method
+    .param pmc name
+    print "in make method\n"
+    $P0 = newclass name
+    print "after newclass, never reached\n"
+.end
+
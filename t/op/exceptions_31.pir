@@ -0,0 +1,17 @@
+.sub main :main
+    push_eh _handler
+    new $P1, 'Exception'
+    say 'Before throwing'
+    throw $P1
+    say 'After throwing'
+    end
+_handler:
+    .local pmc e
+    .local string s
+    .local pmc c
+    .get_results (e)
+    s = e
+    say 'In the exception handler'
+    c = e['resume']
+    c()
+.end
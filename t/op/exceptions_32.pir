@@ -0,0 +1,22 @@
+.sub main :main
+    push_eh catcher
+    'foo'()
+    pop_eh
+    say 'ok 4'
+    .return ()
+  catcher:
+    .get_results ($P0)
+    $P1 = $P0['resume']
+    say 'in the handler'
+    $P1()
+.end
+
+.sub 'foo'
+    say 'ok 1'
+    $P0 = new 'Exception'
+    throw $P0
+    say 'ok 2'
+    $P0 = new 'Exception'
+    throw $P0
+    say 'ok 3'
+.end
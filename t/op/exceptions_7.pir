@@ -0,0 +1,21 @@
+.sub main :main
+    print "main\n"
+    push_eh _handler
+    new $P1, 'Exception'
+    set $P1, "just pining"
+    throw $P1
+    print "not reached\n"
+    end
+_handler:
+    .local pmc e
+    .local string s
+    .get_results (e)
+    s = e
+    print "caught it\n"
+    typeof $S1, e
+    print $S1
+    print "\n"
+    print s
+    print "\n"
+    null $P5
+.end
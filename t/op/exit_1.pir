@@ -0,0 +1,3 @@
+.sub main :main
+    exit 0
+.end
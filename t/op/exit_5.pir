@@ -0,0 +1,3 @@
+.sub main :main
+    $S0 = "cheese"
+.end
@@ -0,0 +1,11 @@
+.sub main :main
+    $P0 = new ['ExceptionHandler']
+    set_label $P0, catcher
+    $P0.'handle_types'(2)
+    push_eh $P0
+    exit 2
+  catcher:
+    # we shouldn't arrive here
+    pop_eh
+    exit 10
+.end
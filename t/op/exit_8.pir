@@ -0,0 +1,3 @@
+.sub main :main
+    exit 3
+.end
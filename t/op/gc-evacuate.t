@@ -0,0 +1,107 @@
+#!./parrot --gc-evacuate-threshold=50
+# Copyright (C) 2014, Parrot Foundation.
+
+=head1 NAME
+
+t/op/gc-evacuate.t - test evacuation of sparse fixed-size arenas
+
+=head1 SYNOPSIS
+
+    % prove t/op/gc-evacuate.t
+
+=head1 DESCRIPTION
+
+Allocates lots of PMCs with attributes, keeps only a few of them alive and
+forces a full collection. Checks that sparse arenas were returned to the
+system and that moved attributes kept their values.
+
+=cut
+
+.include 'interpinfo.pasm'
+
+.sub _main :main
+    .include 'test_more.pir'
+
+    $S0 = interpinfo .INTERPINFO_GC_SYS_NAME
+    if $S0 != "gms" goto not_gms
+
+    plan(5)
+    test_evacuation()
+    goto test_end
+
+  not_gms:
+    skip_all("Evacuation is implemented in GMS only")
+  test_end:
+.end
+
+.sub test_evacuation
+    .local pmc all, kept
+    .local int i, arenas_before, arenas_after, free_before, free_after
+
+    all = new ['ResizablePMCArray']
+    i = 0
+  fill:
+    $P0 = box i
+    push all, $P0
+    inc i
+    if i < 200000 goto fill
+
+    # Keep every 100th object alive
+    kept = new ['ResizablePMCArray']
+    i = 0
+  keep:
+    $P0 = all[i]
+    push kept, $P0
+    i += 100
+    if i < 200000 goto keep
+    null all
+
+    # A minor collection frees the dead objects but leaves the arenas sparse
+    sweep 1
+    arenas_before = interpinfo .INTERPINFO_FIXED_SIZE_ARENAS
+    free_before   = interpinfo .INTERPINFO_FIXED_SIZE_FREE_MEM
+
+    # Only every 1000th collection is a full one
+    i = 1
+  collect:
+    sweep 1
+    inc i
+    if i <= 1000 goto collect
+
+    arenas_after = interpinfo .INTERPINFO_FIXED_SIZE_ARENAS
+    free_after   = interpinfo .INTERPINFO_FIXED_SIZE_FREE_MEM
+
+    $I0 = isgt arenas_before, arenas_after
+    ok($I0, "number of fixed-size arenas decreased")
+
+    $I0 = interpinfo .INTERPINFO_TOTAL_EVACUATED
+    ok($I0, "attributes were evacuated")
+
+    $I0 = interpinfo .INTERPINFO_ARENAS_RELEASED
+    ok($I0, "arenas were released")
+
+    # Most of the free slots went back to the system with their arenas
+    free_after *= 2
+    $I0 = isgt free_before, free_after
+    ok($I0, "free memory in fixed-size arenas more than halved")
+
+    .local int bad
+    bad = 0
+    i = 0
+  check:
+    $P0 = kept[i]
+    $I0 = $P0
+    $I1 = i * 100
+    if $I0 == $I1 goto next
+    inc bad
+  next:
+    inc i
+    if i < 2000 goto check
+    is(bad, 0, "evacuated objects kept their values")
+.end
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
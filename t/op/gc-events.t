@@ -0,0 +1,146 @@
+#!perl
+# Copyright (C) 2014, Parrot Foundation.
+
+use strict;
+use warnings;
+use lib qw( . lib ../lib ../../lib );
+
+use Test::More;
+use Parrot::Test tests => 7;
+use File::Temp 0.13 qw/tempfile/;
+
+=head1 NAME
+
+t/op/gc-events.t - GC event log, trace file and allocation site sampling
+
+=head1 SYNOPSIS
+
+    % prove t/op/gc-events.t
+
+=head1 DESCRIPTION
+
+Tests C<interpinfo .INTERPINFO_GC_EVENTS> and
+C<.INTERPINFO_GC_ALLOCATION_SITES>, and the trace file written when
+C<PARROT_GC_TRACE> is set.
+
+=cut
+
+my $collections = <<'CODE';
+.include 'interpinfo.pasm'
+.sub main :main
+    $S0 = interpinfo .INTERPINFO_GC_SYS_NAME
+    if $S0 != 'inf' goto collect
+    say 'no collections'
+    end
+  collect:
+    $I0 = 0
+  loop:
+    $P0 = new ['ResizablePMCArray']
+    $P0 = 1000
+    sweep 1
+    inc $I0
+    if $I0 < 100 goto loop
+
+    $P0 = interpinfo .INTERPINFO_GC_EVENTS
+    $I0 = elements $P0
+    say $I0
+
+    $P1 = $P0[-1]
+    $I0 = $P1['run']
+    $I1 = interpinfo .INTERPINFO_GC_MARK_RUNS
+    $I2 = iseq $I0, $I1
+    say $I2
+
+    $P2 = $P0[-2]
+    $I3 = $P2['run']
+    $I3 = $I0 - $I3
+    say $I3
+
+    $I0 = $P1['pause']
+    $I0 = isgt $I0, 0
+    say $I0
+
+    $I0 = $P1['used']
+    $I0 = isgt $I0, 0
+    say $I0
+
+    $P3 = interpinfo .INTERPINFO_GC_ALLOCATION_SITES
+    $I0 = elements $P3
+    say $I0
+.end
+CODE
+
+pir_output_like( $collections, <<'OUTPUT', 'the last collections are logged' );
+/^(?:no collections|64
+1
+1
+1
+1
+0)
+$/
+OUTPUT
+
+my $sites = <<'CODE';
+.include 'interpinfo.pasm'
+.sub main :main
+    $I0 = 0
+  loop:
+    $P0 = new ['Float']
+    inc $I0
+    if $I0 < 10000 goto loop
+
+    $P0 = interpinfo .INTERPINFO_GC_ALLOCATION_SITES
+    $P1 = iter $P0
+  next:
+    unless $P1 goto done
+    $S0 = shift $P1
+    $I0 = index $S0, 'Float main pc '
+    if $I0 != 0 goto next
+    $I0 = $P0[$S0]
+    $I0 = isge $I0, 900
+    say $I0
+  done:
+.end
+CODE
+
+{
+    local $ENV{PARROT_GC_ALLOC_SAMPLE} = 10;
+    pir_output_is( $sites, <<'OUTPUT', 'allocation sites are sampled' );
+1
+OUTPUT
+}
+
+SKIP: {
+    my ( undef, $trace ) = tempfile( SUFFIX => '.trace', UNLINK => 1 );
+
+    {
+        local $ENV{PARROT_GC_TRACE}        = $trace;
+        local $ENV{PARROT_GC_ALLOC_SAMPLE} = 10;
+        pir_output_like( $collections, <<'OUTPUT', 'program runs with a GC trace' );
+/^(?:no collections|64\n)/
+OUTPUT
+    }
+
+    open my $fh, '<', $trace or die "can't read $trace: $!";
+    my @lines = <$fh>;
+    close $fh;
+
+    like( shift @lines, qr/^version=1 gc=\w+$/, 'trace starts with a header' );
+
+    my @gc = grep { /^gc / } @lines;
+    skip 'no collections with this GC', 3 unless @gc;
+
+    my $line = join ' ', map { "$_=-?\\d+" }
+        qw/run gen start pause freed freed_bytes promoted dirty used/;
+    is( scalar( grep { !/^gc $line$/ } @gc ), 0, 'one line per collection' );
+    cmp_ok( scalar(@gc), '>=', 100, 'every collection is traced' );
+    ok( scalar( grep { /^alloc count=\d+ site=ResizablePMCArray main pc \d+ \(.*:\d+\)$/ } @lines ),
+        'allocation sites are written at exit' );
+}
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4:
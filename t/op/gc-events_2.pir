@@ -0,0 +1,20 @@
+.include 'interpinfo.pasm'
+.sub main :main
+    $I0 = 0
+  loop:
+    $P0 = new ['Float']
+    inc $I0
+    if $I0 < 10000 goto loop
+
+    $P0 = interpinfo .INTERPINFO_GC_ALLOCATION_SITES
+    $P1 = iter $P0
+  next:
+    unless $P1 goto done
+    $S0 = shift $P1
+    $I0 = index $S0, 'Float main pc '
+    if $I0 != 0 goto next
+    $I0 = $P0[$S0]
+    $I0 = isge $I0, 900
+    say $I0
+  done:
+.end
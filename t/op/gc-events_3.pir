@@ -0,0 +1,42 @@
+.include 'interpinfo.pasm'
+.sub main :main
+    $S0 = interpinfo .INTERPINFO_GC_SYS_NAME
+    if $S0 != 'inf' goto collect
+    say 'no collections'
+    end
+  collect:
+    $I0 = 0
+  loop:
+    $P0 = new ['ResizablePMCArray']
+    $P0 = 1000
+    sweep 1
+    inc $I0
+    if $I0 < 100 goto loop
+
+    $P0 = interpinfo .INTERPINFO_GC_EVENTS
+    $I0 = elements $P0
+    say $I0
+
+    $P1 = $P0[-1]
+    $I0 = $P1['run']
+    $I1 = interpinfo .INTERPINFO_GC_MARK_RUNS
+    $I2 = iseq $I0, $I1
+    say $I2
+
+    $P2 = $P0[-2]
+    $I3 = $P2['run']
+    $I3 = $I0 - $I3
+    say $I3
+
+    $I0 = $P1['pause']
+    $I0 = isgt $I0, 0
+    say $I0
+
+    $I0 = $P1['used']
+    $I0 = isgt $I0, 0
+    say $I0
+
+    $P3 = interpinfo .INTERPINFO_GC_ALLOCATION_SITES
+    $I0 = elements $P3
+    say $I0
+.end
@@ -44,6 +44,8 @@ Note that this test will fail for --gc=inf
     collect_toggle()
     collect_toggle_nested()
     "stats"()
+    compact_shared_strings()
+    compact_pinned_buffers()
   start_inf_tests:
     vanishing_singleton_PMC()
     vanishing_ret_continuation()
@@ -167,6 +169,86 @@ Note that this test will fail for --gc=inf
     ok($I2, "Number of total PMCs is greater than active")
 .end
 
+.sub compact_shared_strings
+    .local pmc keep
+    keep = new ['ResizableStringArray']
+    $I0 = 0
+  loop:
+    $S0 = repeat 'z', 200
+    $S1 = $I0
+    $S0 .= $S1
+    $I1 = $I0 % 4
+    if $I1 goto next
+    push keep, $S0
+    # substr shares buffer with original string
+    $S2 = substr $S0, 100
+    push keep, $S2
+  next:
+    inc $I0
+    if $I0 < 20000 goto loop
+
+    $I1 = interpinfo .INTERPINFO_TOTAL_COPIED
+    $I2 = interpinfo .INTERPINFO_SHARED_BUFFERS_MOVED
+    $I3 = interpinfo .INTERPINFO_TOTAL_SHARED
+    sweep 1
+    collect
+    $I4 = interpinfo .INTERPINFO_TOTAL_COPIED
+    $I5 = interpinfo .INTERPINFO_SHARED_BUFFERS_MOVED
+    $I6 = interpinfo .INTERPINFO_TOTAL_SHARED
+
+    $I0 = $I4 > $I1
+    ok($I0, "compaction copied strings")
+    $I0 = $I5 > $I2
+    ok($I0, "compaction kept shared buffers shared")
+    $I0 = $I6 > $I3
+    ok($I0, "memory of shared buffers isn't copied")
+
+    $S0 = keep[0]
+    $S0 = substr $S0, 200
+    is($S0, '0', "compacted string intact")
+    $S0 = keep[9999]
+    $S1 = repeat 'z', 100
+    $S1 .= '19996'
+    is($S0, $S1, "compacted shared string intact")
+.end
+
+.sub compact_pinned_buffers
+    .local pmc keep
+    .local int i, round
+    keep = new ['ResizableStringArray']
+    round = 0
+  rounds:
+    $S0 = repeat 'abcdefghij', 400000
+    i = 0
+  tokens:
+    # small slices of a big string get their own buffer
+    $S1 = substr $S0, i, 7
+    push keep, $S1
+    i += 400000
+    if i < 4000000 goto tokens
+    # big slices share it, and die with it
+    $S2 = substr $S0, 0, 1000000
+    $S3 = substr $S0, 1000000
+    null $S0
+    null $S2
+    null $S3
+    inc round
+    if round < 20 goto rounds
+
+    sweep 1
+    collect
+    sweep 1
+    collect
+    $I0 = interpinfo .INTERPINFO_TOTAL_MEM_ALLOC
+    $I0 = $I0 < 20000000
+    ok($I0, "slices don't keep dead strings alive")
+
+    $I0 = elements keep
+    is($I0, 200, "all slices kept")
+    $S0 = keep[199]
+    is($S0, 'abcdefg', "slice intact after compaction")
+.end
+
 .sub vanishing_singleton_PMC
     $P16 = new 'Env'
     $P16['Foo'] = 'bar'
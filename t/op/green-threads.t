@@ -0,0 +1,203 @@
+#!./parrot
+# Copyright (C) 2014, Parrot Foundation.
+
+=head1 NAME
+
+t/op/green-threads.t - Tasks run as green threads
+
+=head1 SYNOPSIS
+
+    % prove t/op/green-threads.t
+
+=head1 DESCRIPTION
+
+Tests the C<green_threads> op: Tasks that run on the current thread and are
+switched inside the current runloop.
+
+=cut
+
+.sub main :main
+    .include 'test_more.pir'
+    plan(8)
+    green_threads 1
+
+    many_tasks()
+    interleave()
+    preempt()
+    preempt_conditional()
+    wait_for_task()
+    sleep_in_task()
+    exception_in_task()
+.end
+
+.sub many_tasks
+    $P0 = new 'Integer'
+    set_global 'count', $P0
+    $P1 = new 'ResizablePMCArray'
+    $I0 = 0
+  spawn:
+    $P2 = get_global 'count_up'
+    $P3 = new 'Task', $P2
+    schedule $P3
+    push $P1, $P3
+    inc $I0
+    if $I0 < 1000 goto spawn
+
+  wait_all:
+    $P3 = pop $P1
+    wait $P3
+    if $P1 goto wait_all
+
+    $P0 = get_global 'count'
+    is($P0, 1000, 'a thousand green threads ran')
+.end
+
+.sub count_up
+    $P0 = get_global 'count'
+    inc $P0
+.end
+
+.sub interleave
+    $P0 = new 'StringBuilder'
+    set_global 'trace', $P0
+    $P1 = get_global 'writer'
+    $P2 = new 'Task', $P1
+    $P3 = box 'a'
+    setattribute $P2, 'data', $P3
+    schedule $P2
+    $P4 = new 'Task', $P1
+    $P3 = box 'b'
+    setattribute $P4, 'data', $P3
+    schedule $P4
+    wait $P2
+    wait $P4
+    $S0 = $P0
+    is($S0, 'ababab', 'pass switches between green threads')
+.end
+
+.sub writer
+    .param pmc letter
+    $P0 = get_global 'trace'
+    $I0 = 0
+  loop:
+    $S0 = letter
+    push $P0, $S0
+    pass
+    inc $I0
+    if $I0 < 3 goto loop
+.end
+
+.sub preempt
+    $P0 = new 'Integer'
+    set_global 'flag', $P0
+    $P1 = get_global 'spin'
+    $P2 = new 'Task', $P1
+    schedule $P2
+    $P1 = get_global 'set_flag'
+    $P3 = new 'Task', $P1
+    schedule $P3
+    wait $P2
+    ok(1, 'a spinning green thread is preempted')
+.end
+
+.sub spin
+    $P0 = get_global 'flag'
+  loop:
+    if $P0 goto done
+    goto loop
+  done:
+.end
+
+.sub set_flag
+    $P0 = get_global 'flag'
+    $P0 = 1
+.end
+
+.sub preempt_conditional
+    $P0 = new 'Integer'
+    set_global 'cond_flag', $P0
+    $P1 = get_global 'spin_unless'
+    $P2 = new 'Task', $P1
+    schedule $P2
+    $P1 = get_global 'set_cond_flag'
+    $P3 = new 'Task', $P1
+    schedule $P3
+    wait $P2
+    ok(1, 'a green thread spinning on a conditional branch is preempted')
+.end
+
+.sub spin_unless
+    $P0 = get_global 'cond_flag'
+  loop:
+    $I0 = $P0
+    unless $I0 goto loop
+.end
+
+.sub set_cond_flag
+    $P0 = get_global 'cond_flag'
+    $P0 = 1
+.end
+
+.sub wait_for_task
+    $P0 = get_global 'answer'
+    $P1 = new 'Task', $P0
+    schedule $P1
+    wait $P1
+    $P2 = get_global 'result'
+    is($P2, 42, 'wait returns after the green thread is done')
+.end
+
+.sub answer
+    $P0 = box 42
+    set_global 'result', $P0
+.end
+
+.sub sleep_in_task
+    $P0 = get_global 'sleeper'
+    $P1 = new 'Task', $P0
+    schedule $P1
+    wait $P1
+    $P2 = get_global 'slept'
+    is($P2, 1, 'a green thread can sleep')
+.end
+
+.sub sleeper
+    sleep 0.01
+    $P0 = box 1
+    set_global 'slept', $P0
+.end
+
+.sub exception_in_task
+    $P0 = get_global 'thrower'
+    $P1 = new 'Task', $P0
+    schedule $P1
+    wait $P1
+    $P2 = get_global 'caught'
+    is($P2, 'oops', 'exceptions are handled inside a green thread')
+    $P0 = get_global 'count_up'
+    $P1 = new 'Task', $P0
+    schedule $P1
+    wait $P1
+    $P0 = get_global 'count'
+    is($P0, 1001, 'the scheduler keeps running after it')
+.end
+
+.sub thrower
+    push_eh handler
+    die 'oops'
+    $P0 = box 'not caught'
+    set_global 'caught', $P0
+    .return ()
+  handler:
+    .get_results ($P1)
+    pop_eh
+    $S0 = $P1['message']
+    $P0 = box $S0
+    set_global 'caught', $P0
+.end
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
@@ -0,0 +1,15 @@
+.sub 'test' :main
+    .local string actual
+    .local pmc test_interp
+               test_interp = new 'ParrotInterpreter'
+
+    print "uno\n"
+    runinterp test_interp, pasm
+    print "dos\n"
+    goto pasm_end
+
+  pasm:
+    noop
+    end
+  pasm_end:
+.end
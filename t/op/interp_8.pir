@@ -0,0 +1,20 @@
+.include 'interpinfo.pasm'
+.include 'interpcores.pasm'
+
+.sub 'test' :main
+    $I0 = interpinfo .INTERPINFO_CURRENT_RUNCORE
+    if $I0 == .PARROT_FUNCTION_CORE   goto ok1
+    if $I0 == .PARROT_FAST_CORE       goto ok1
+    if $I0 == .PARROT_EXEC_CORE       goto ok1
+    if $I0 == .PARROT_GC_DEBUG_CORE   goto ok1
+    print 'not '
+  ok1:
+    say 'ok 1'
+
+    $P0 = getinterp
+    $I1 = $P0[.INTERPINFO_CURRENT_RUNCORE]
+    if $I0 == $I1 goto ok2
+    print 'not '
+  ok2:
+    say 'ok 2'
+.end
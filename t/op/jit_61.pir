@@ -0,0 +1,27 @@
+# on x86 the shift count is always in %cl
+.sub main :main
+    .local int i
+    i = 2
+    $I0 = 'shr'(i, i, i, i, 32)
+    print $I0
+    print "\n"
+.end
+.sub 'shr'
+    .param int i
+    .param int j
+    .param int k
+    .param int l
+    .param int m
+    i = i + 1  # force shown reg alloc on x86
+    i = i + 1
+    i = i + 1
+    i = i + 1  # edi
+    j = j + 1
+    j = j + 1
+    j = j + 1  # esi
+    k = k + 1
+    k = k + 1  # edx
+    m = m + 32 # ecx
+    m >>= l    # opt_shift_rm (count l in memory)
+    .return (m)
+.end
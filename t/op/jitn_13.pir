@@ -0,0 +1,19 @@
+.sub _main :main
+    .local num n
+    .local int i
+
+    n = 1.4
+    i = n
+    print i
+
+    n = 2.5
+    i = n
+    print i
+
+    n = 3.6
+    i = n
+    print i
+
+    print "\n"
+    end
+.end
@@ -0,0 +1,11 @@
+.sub main :main
+    .local pmc pad, interp
+    interp = getinterp
+    pad = interp["lexpad"]
+    if null pad goto ok
+    print "pad not NULL\n"
+    end
+ok:
+    print "ok\n"
+    end
+.end
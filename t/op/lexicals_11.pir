@@ -0,0 +1,14 @@
+.sub main :main
+     coro()
+.end
+.sub coro
+    .local pmc pad, interp
+    interp = getinterp
+    pad = interp["lexpad"]
+    if null pad goto ok
+    print "pad not NULL\n"
+    .yield()
+ok:
+    print "ok\n"
+    .yield()
+.end
@@ -0,0 +1,17 @@
+.sub main :main
+    .local pmc pad, interp
+    interp = getinterp
+    pad = interp["lexpad"]
+    .lex '$a', $P0
+    unless null pad goto ok
+    print "pad is NULL\n"
+    end
+ok:
+    print "ok\n"
+    $P1 = new 'Integer'
+    $P1 = 13013
+    pad['$a'] = $P1
+    print $P0
+    print "\n"
+    end
+.end
@@ -0,0 +1,22 @@
+.sub main :main
+    .lex '$a', $P0
+    .lex '$b', $P2
+    .local pmc pad, interp
+    interp = getinterp
+    pad = interp["lexpad"]
+    unless null pad goto ok
+    print "pad is NULL\n"
+    end
+ok:
+    print "ok\n"
+    $P1 = new 'Integer'
+    $P1 = 13013
+    pad['$a'] = $P1
+    print $P0
+    print "\n"
+    $P1 = 42
+    pad['$b'] = $P1
+    print $P2
+    print "\n"
+    end
+.end
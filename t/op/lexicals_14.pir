@@ -0,0 +1,9 @@
+.sub main :main
+    .lex '$a', $P0
+    $P1 = new 'Integer'
+    $P1 = 13013
+    store_lex '$a', $P1
+    print $P0
+    print "\n"
+    end
+.end
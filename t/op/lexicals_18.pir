@@ -0,0 +1,5 @@
+.sub main :main
+    print "ok\n"
+.end
+.sub foo :outer('main')
+.end
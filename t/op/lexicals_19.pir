@@ -0,0 +1,8 @@
+.sub main :main
+    .local pmc a
+    .lex "$a", a
+    print "ok\n"
+    end
+.end
+.sub foo :outer(main)
+.end
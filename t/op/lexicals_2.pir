@@ -0,0 +1,4 @@
+.sub main :main
+    .lex "$a", $P0
+    print "ok\n"
+.end
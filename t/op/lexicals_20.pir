@@ -0,0 +1,5 @@
+.sub main
+    print "ok\n"
+.end
+.sub foo :outer(oops)
+.end
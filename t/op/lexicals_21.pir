@@ -0,0 +1,16 @@
+.sub main :main
+    .lex '$a', $P0
+    .local pmc pad, interp, info
+    interp = getinterp
+    pad = interp["lexpad"]
+    unless null pad goto ok
+    print "pad is NULL\n"
+    end
+ok:
+    print "ok\n"
+    info = pad.'get_lexinfo'()
+    typeof $S0, info
+    print $S0
+    print "\n"
+    end
+.end
@@ -0,0 +1,21 @@
+.sub main :main
+    foo()
+    print "ok\n"
+.end
+.sub foo :lex
+    .local pmc pad, interp, info
+    interp = getinterp
+    pad = interp["lexpad"]
+    unless null pad goto ok
+    print "pad is NULL\n"
+    end
+ok:
+    print "ok\n"
+    typeof $S0, pad
+    print $S0
+    print "\n"
+    info = pad.'get_lexinfo'()
+    typeof $S0, info
+    print $S0
+    print "\n"
+.end
@@ -0,0 +1,10 @@
+.sub 'main' :main
+    foo()
+.end
+.sub foo :outer('main')
+    .include "interpinfo.pasm"
+    interpinfo $P1, .INTERPINFO_CURRENT_SUB
+    $P2 = $P1."get_outer"()
+    print $P2
+    print "\n"
+.end
@@ -0,0 +1,16 @@
+.sub 'main' :main
+    foo()
+.end
+.sub foo  :outer('main')
+    bar()
+.end
+.sub bar   :outer('foo')
+    .include "interpinfo.pasm"
+    interpinfo $P1, .INTERPINFO_CURRENT_SUB
+    $P2 = $P1."get_outer"()
+    print $P2
+    print "\n"
+    $P3 = $P2."get_outer"()
+    print $P3
+    print "\n"
+.end
@@ -0,0 +1,34 @@
+.sub 'main' :main
+    .const 'Sub' foo = "foo"
+    .local pmc foo_cl
+    .lex "a", $P0
+    foo_cl = newclosure foo
+    foo_cl()
+    print $P0
+.end
+.sub foo  :outer('main')
+    .const 'Sub' bar = "bar"
+    .local pmc bar_cl
+    bar_cl = newclosure bar
+    bar_cl()
+.end
+.sub bar   :outer('foo')
+    .local pmc sub, interp, pad
+    interp = getinterp
+    sub = interp["outer"]
+    print sub
+    print "\n"
+    sub = interp["outer"; "sub"]
+    print sub
+    print "\n"
+    sub = interp["outer"; 2]
+    print sub
+    print "\n"
+    sub = interp["outer"; "sub"; 2]
+    print sub
+    print "\n"
+    $P0 = new 'String'
+    $P0 = "I messed with your var\n"
+    pad = interp["outer"; "lexpad"; 2]
+    pad['a'] = $P0
+.end
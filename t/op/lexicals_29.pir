@@ -0,0 +1,49 @@
+# Leo's version of xyzzy original by particle, p5 by chip     #'
+
+.sub main :main
+    .local pmc f,g
+    f = xyzzy(42)
+    $P0 = f()
+    $P0 = f()
+    $P0 = f()
+    g = xyzzy(13013)
+    $P0 = g()
+    $P0 = f()
+.end
+
+.sub xyzzy
+    .param int i
+    .local pmc f
+    f = plugh(i)
+    .return (f)
+.end
+
+.sub plugh
+    .param int i
+    .local pmc f
+    f = foo(i)
+    .return (f)
+.end
+
+.sub foo
+    .param int i
+    .lex 'a', $P0
+    $P1 = new 'Integer'
+    $P1 = i
+    store_lex 'a', $P1
+    print "foo: "
+    print $P0
+    print "\n"
+    .const 'Sub' closure = 'bar'
+    $P2 = newclosure closure
+    .return($P2)
+.end
+
+.sub bar :anon :outer(foo)
+    $P0 = find_lex 'a'
+    inc $P0
+    store_lex 'a', $P0
+    print "bar: "
+    print $P0
+    print "\n"
+.end
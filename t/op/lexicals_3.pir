@@ -0,0 +1,5 @@
+.sub main :main
+    .lex '$a', $P0
+    null $P0
+    print "ok\n"
+.end
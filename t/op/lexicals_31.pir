@@ -0,0 +1,22 @@
+
+# p6 example from pmichaud
+# { my $x = 5;  { print $x; my $x = 4; print $x; } }
+
+## According to S04 this is an error
+
+.sub main :main
+    .lex '$x', $P0
+    $P0 = new 'Integer'
+    $P0 = 5
+    anon_1()
+.end
+
+.sub anon_1 :anon :outer(main)
+    # anon closure
+    $P0 = find_lex '$x'
+    print $P0
+    .lex '$x', $P1
+    $P1 = new 'Integer'
+    $P1 = 4
+    print $P1
+.end
@@ -0,0 +1,17 @@
+.sub "main" :main
+    .lex 'a', $P0
+    foo()
+.end
+.sub foo  :outer('main')
+    .lex 'b', $P0
+    bar()
+.end
+.sub bar   :outer('foo')
+    .lex 'c', $P0
+    $P2 = find_lex 'no_such'
+    if null $P2 goto ok
+    print "Undefined name not NULL\n"
+    end
+ok:
+    print "ok\n"
+.end
@@ -0,0 +1,10 @@
+.sub main :main
+    .lex 'a', $P0
+    $P1 = new 'String'
+    $P1 = "ok\n"
+    store_lex 'a', $P1
+    $P2 = find_name 'a'
+    print $P0
+    print $P1
+    print $P2
+.end
@@ -0,0 +1,14 @@
+.sub main :main
+    .lex 'a', $P0
+    .lex 'b', $P0
+    .lex 'c', $P0
+    $P1 = new 'String'
+    $P1 = "ok\n"
+    store_lex 'a', $P1
+    $P2 = find_name 'b'
+    print $P0
+    print $P1
+    print $P2
+    $P3 = find_lex 'c'
+    print $P3
+.end
@@ -0,0 +1,26 @@
+# my $x;
+# sub f{$x++}
+# f()
+# print "$x\n"
+.sub '&main' :main :anon
+    .local pmc sx
+    .lex '$x', sx
+    sx = new 'Integer'
+    sx = 33
+    '&f'()
+    print sx    # no find_lex needed - 'sx' is defined here
+    print "\n"
+
+    '&f'()
+    print sx
+    print "\n"
+
+    '&f'()
+    print sx
+    print "\n"
+.end
+
+.sub '&f' :outer('&main')
+    $P0 = find_lex '$x'           # find_lex needed
+    inc $P0
+.end
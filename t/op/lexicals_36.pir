@@ -0,0 +1,33 @@
+# my $x;
+# sub f{$x++}
+# sub g{f();f()}
+# g()
+# print "$x\n"
+.sub '&main' :main :anon
+    .local pmc sx
+    .lex '$x', sx
+    sx = new 'Integer'
+    sx = -32
+    '&g'()
+    print sx
+    print "\n"
+
+    '&g'()
+    print sx
+    print "\n"
+
+    '&g'()
+    print sx
+    print "\n"
+
+.end
+
+.sub '&f' :outer('&main')
+    $P0 = find_lex '$x'
+    inc $P0
+.end
+
+.sub '&g' :outer('&main') # :outer not needed - no find_lex
+    '&f'()
+    '&f'()
+.end
@@ -0,0 +1,31 @@
+#     sub f ($x) {
+#         sub g ($y) { $x + $y }; g($x);
+#     }
+#     f(10); # 20
+#     g(100); # 110
+.sub '&f'
+    .param pmc x
+    .lex '$x', x
+    $P0 = '&g'(x)
+    .return ($P0)
+.end
+
+.sub '&g' :outer('&f')
+    .param pmc y
+    .lex '$y', y
+    .local pmc x
+    x = find_lex '$x'
+    $P0 = add x, y
+    .return ($P0)
+.end
+
+.sub '&main' :main :anon
+    $P0 = '&f'(10)
+    print $P0
+    print "\n"
+    $P0 = '&g'(100)
+    print $P0
+    print "\n"
+.end
+
+
@@ -0,0 +1,19 @@
+#     sub f ($x) {
+#         sub g () { print $x };
+#     }
+#     g();
+.sub '&f'
+    .param pmc x
+    .lex '$x', x
+.end
+
+.sub '&g' :outer('&f')
+    .local pmc x
+    x = find_lex '$x'
+    print x
+.end
+
+.sub '&main' :main :anon
+    '&g'()
+    print "never\n"
+.end
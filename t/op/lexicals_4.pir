@@ -0,0 +1,5 @@
+.sub main :main
+    .local pmc a
+    .lex "$a", a
+    print "ok\n"
+.end
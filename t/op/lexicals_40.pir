@@ -0,0 +1,23 @@
+#     sub f ($x) {
+#         sub g () { print "$x\n" };
+#     }
+#     f(10);
+#     f(20);
+#     g();
+.sub '&f'
+    .param pmc x
+    .lex '$x', x
+.end
+
+.sub '&g' :outer('&f')
+    .local pmc x
+    x = find_lex '$x'
+    print x
+    print "\n"
+.end
+
+.sub '&main' :main :anon
+    '&f'(10)
+    '&f'(20)
+    '&g'()
+.end
@@ -0,0 +1,10 @@
+.sub main :main
+    .lex '$x', 42
+    get_outer()
+.end
+
+.sub 'get_outer' :outer('main')
+    .lex '$x', 13
+    $P0 = find_lex '$x', 1
+    say $P0
+.end
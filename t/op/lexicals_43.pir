@@ -0,0 +1,35 @@
+.sub 'main' :main
+    .local pmc x
+    x = 'foo'()
+    x('world')
+.end
+
+.sub 'foo' :outer('main')
+    .local pmc a, bar
+    a = new 'String'
+    a = 'hello '
+    .lex '$a', a
+    $P0 = get_global 'bar'
+    bar = newclosure $P0
+    .return (bar)
+.end
+
+.sub 'bar' :outer('foo')
+    .param pmc b
+    .lex '$b', b
+    .const 'Sub' $P0 = 'bar_inner'
+    capture_lex $P0
+    .local pmc a
+    a = find_lex '$a'
+    print a
+    say b
+    'bar_inner'()
+.end
+
+.sub 'bar_inner' :outer('bar')
+    .local pmc a, b
+    a = find_lex '$a'
+    b = find_lex '$b'
+    print a
+    say b
+.end
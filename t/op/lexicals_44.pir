@@ -0,0 +1,23 @@
+.sub 'main' :main
+    foo('try 1')
+    foo('try 2')
+    foo('try 3')
+.end
+
+.sub 'foo' :subid('foo')
+    .param pmc x
+    .lex '$x', x
+    print "outer foo "
+    say x
+    'inner'()
+.end
+
+.sub 'inner' :outer('foo')
+    .local pmc x
+    x = find_lex '$x'
+    print "inner foo "
+    say x
+    $P0 = new 'String'
+    $P0 = 'BOGUS!'
+    store_lex '$x', $P0
+.end
@@ -0,0 +1,29 @@
+.sub main :main
+    rpwi(0)
+.end
+
+.sub rpwi
+    .param int recursive_p
+    unless recursive_p goto do_lex
+    print "rpwi:  recursive case\n"
+    .return ()
+do_lex:
+    .lex "(SAVED *SHARP-EQUAL-ALIST*)", $P40
+    $P40 = new 'Integer'
+    $P40 = 99
+    .const 'Sub' $P80 = "(:INTERNAL rpwi 0)"
+    newclosure $P81, $P80
+    ## $P81 = clone $P80
+    ## pushaction $P81
+    print "rpwi:  lex case\n"
+    rpwi(1)
+    $P81()
+.end
+
+.sub "(:INTERNAL rpwi 0)" :anon :outer('rpwi')
+    print "[restoring *SHARP-EQUAL-ALIST*]\n"
+    find_lex $P40, "(SAVED *SHARP-EQUAL-ALIST*)"
+    print "[got "
+    print $P40
+    print "]\n"
+.end
@@ -0,0 +1,86 @@
+.sub 'main' :main
+    $P0 = new 'ResizablePMCArray'
+    push $P0, 'a'
+    $P1 = new 'ResizablePMCArray'
+    $P2 = new 'ResizablePMCArray'
+    push $P2, 'simple'
+    push $P1, $P2
+    push $P1, 'test'
+    $P3 = new 'ResizablePMCArray'
+    push $P3, 'for'
+    push $P3, 'a'
+    push $P3, 'simple'
+    push $P1, $P3
+    push $P0, $P1
+    push $P0, 'script'
+    'dump_thing'($P0, '# ')
+.end
+
+.sub 'dump_thing'
+    .param pmc thing
+    .param pmc prefix
+    .lex '$thing', thing
+    .lex '$prefix', prefix
+
+    $P0 = get_hll_global 'anon_1'
+    $P1 = newclosure $P0
+    .lex '$recur', $P1
+
+    $P2 = find_lex '$thing'
+    $I0 = isa $P2, 'ResizablePMCArray'
+    unless $I0 goto not_ResizablePMCArray
+
+    $P3 = find_lex '$prefix'
+    print $P3
+    print "[\n"
+    $P4 = get_hll_global 'anon_2'
+    $P5 = newclosure $P4
+    $P6 = find_lex '$thing'
+    'map'($P5, $P6)
+    $P7 = find_lex '$prefix'
+    print $P7
+    print "]\n"
+    goto end_if
+
+  not_ResizablePMCArray:
+    $P8 = find_lex '$prefix'
+    print $P8
+    $P9 = find_lex '$thing'
+    print $P9
+    print "\n"
+  end_if:
+.end
+
+.sub 'anon_1' :outer('dump_thing')
+    .param pmc subthing
+    .lex '$subthing', subthing
+    $P0 = find_lex '$subthing'
+    $P1 = find_lex '$prefix'
+    $P2 = new 'String'
+    $P2 = concat $P1, '    '
+   'dump_thing'($P0, $P2)
+.end
+
+.sub 'anon_2' :outer('dump_thing')
+    .param pmc topic
+    .lex "$_", topic
+    $P0 = find_lex '$recur'
+    $P1 = find_lex '$_'
+    $P0($P1)
+.end
+
+.sub 'map'
+    .param pmc block
+    .param pmc array
+    .local pmc result, it
+    result = new 'ResizablePMCArray'
+    it = iter array
+    loop:
+    unless it goto loop_end
+    $P0 = shift it
+    $P0 = block($P0)
+    push result, $P0
+    goto loop
+    loop_end:
+    .return (result)
+.end
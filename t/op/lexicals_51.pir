@@ -0,0 +1,14 @@
+.sub main :main
+    'il'()
+.end
+.sub 'il'
+    .lex '$i', $I0
+    store_lex '$i', 42
+    $I1 = find_lex '$i'
+    say $I1
+    'il_fetch'()
+.end
+.sub 'il_fetch' :outer('il')
+    $I0 = find_lex '$i'
+    say $I0
+.end
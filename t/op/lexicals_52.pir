@@ -0,0 +1,14 @@
+.sub main :main
+    'nl'()
+.end
+.sub 'nl'
+    .lex '$n', $N0
+    store_lex '$n', 6.9
+    $N1 = find_lex '$n'
+    say $N1
+    'nl_fetch'()
+.end
+.sub 'nl_fetch' :outer('nl')
+    $N0 = find_lex '$n'
+    say $N0
+.end
@@ -0,0 +1,14 @@
+.sub main :main
+    'sl'()
+.end
+.sub 'sl'
+    .lex '$s', $S0
+    store_lex '$s', 'Staropramen'
+    $S1 = find_lex '$s'
+    say $S1
+    'sl_fetch'()
+.end
+.sub 'sl_fetch' :outer('sl')
+    $S0 = find_lex '$s'
+    say $S0
+.end
@@ -0,0 +1,24 @@
+.sub main :main
+    .lex 'i', $I0
+    .lex 'n', $N0
+    .lex 's', $S0
+    .lex 'p', $P0
+
+    store_lex 'i', 101
+    store_lex 'n', 4.2
+    store_lex 's', 'Starobrno'
+    $P1 = box 'Pilsner Urquell'
+    store_lex 'p', $P1
+
+    'czech'()
+.end
+.sub 'czech' :outer('main')
+    $I0 = find_lex 'i'
+    say $I0
+    $N0 = find_lex 'n'
+    say $N0
+    $S0 = find_lex 's'
+    say $S0
+    $P0 = find_lex 'p'
+    say $P0
+.end
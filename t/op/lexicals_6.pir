@@ -0,0 +1,11 @@
+.sub main :main
+    .local pmc ab, a, b
+    .lex '$a', ab
+    .lex '$b', ab
+    ab = new 'String'
+    ab = "ok\n"
+    a = find_lex '$a'
+    print a
+    b = find_lex '$b'
+    print b
+.end
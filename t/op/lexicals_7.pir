@@ -0,0 +1,12 @@
+.sub main :main
+    .lex 'a', $P0
+    store_lex 'a', $P0
+    $P0 = find_lex 'a'
+    print "ok\n"
+.include 'interpinfo.pasm'
+    load_bytecode 'pcore.pbc'      # TODO autoload/preload
+    interpinfo $P1, .INTERPINFO_CURRENT_SUB
+    $P2 = $P1.'get_lexinfo'()
+    $P2 = $P1.'get_lexenv'()
+    print "ok\n"
+.end
@@ -0,0 +1,12 @@
+.sub main :main
+    .lex '$a', $P0
+    .lex '$b', $P9
+.include "interpinfo.pasm"
+    interpinfo $P1, .INTERPINFO_CURRENT_SUB
+    $P2 = $P1.'get_lexinfo'()
+    $S0 = typeof $P2
+    print $S0
+    print ' '
+    $I0 = elements $P2
+    say $I0
+.end
@@ -0,0 +1,10 @@
+.sub main :main
+.include "interpinfo.pasm"
+    interpinfo $P1, .INTERPINFO_CURRENT_SUB
+    $P2 = $P1.'get_lexinfo'()
+    if null $P2 goto ok
+    print "LexInfo not NULL\n"
+    end
+ok:
+    print "ok\n"
+.end
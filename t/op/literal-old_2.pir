@@ -0,0 +1,10 @@
+.sub test :main
+        print 0x2A
+        print "\n"
+        print 0X2A
+        print "\n"
+        print 0b101010
+        print "\n"
+        print 0B101010
+        print "\n"
+.end
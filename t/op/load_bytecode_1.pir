@@ -0,0 +1,3 @@
+.sub main :main
+    load_bytecode $S0
+.end
@@ -0,0 +1,3 @@
+.sub main :main
+        load_bytecode 'no_file_by_this_name'
+.end
@@ -0,0 +1,3 @@
+.sub main :main
+    say "string literal"
+.end
@@ -0,0 +1,3 @@
+.sub main :main
+    say 42
+.end
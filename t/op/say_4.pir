@@ -0,0 +1,4 @@
+.sub main :main
+    $S5 = "string register"
+    say $S5
+.end
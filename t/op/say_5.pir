@@ -0,0 +1,4 @@
+.sub main :main
+    $I4 = 10
+    say $I4
+.end
@@ -0,0 +1,4 @@
+.sub main :main
+    $N2 = 1.414
+    say $N2
+.end
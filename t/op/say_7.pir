@@ -0,0 +1,6 @@
+.sub main :main
+    $N0 = 3.14159
+    say $N0
+    print $N0
+    print "\n"
+.end
@@ -0,0 +1,4 @@
+.sub main :main
+    null $P0
+    say $P0
+.end
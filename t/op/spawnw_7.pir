@@ -0,0 +1,23 @@
+.sub test :main
+        .local pmc args
+
+        $S0 = "exit length(qq{"
+        $I0 = 0
+loop:
+        if $I0 >= 1000 goto end
+        $S0 = concat $S0, "A"
+        inc $I0
+        branch loop
+end:
+        $S0 = concat $S0, "}) / 100"
+        new args, 'ResizablePMCArray'
+        push args, '/usr/bin/perl'
+        push args, "-e"
+        push args, $S0
+        $I0 = spawnw args
+        shr $I1, $I0, 8
+        print   "return code: "
+        print   $I1
+        print   "\n"
+        end
+.end
@@ -19,7 +19,7 @@ Executes sprintf tests.
 .sub main :main
     .include 'test_more.pir'
 
-    plan(9)
+    plan(14)
 
     positive_length()
     negative_length()
@@ -30,6 +30,10 @@ Executes sprintf tests.
     string__minus_flag()
     float_length_and_prec()
     float_neg_length_and_prec()
+    decimal_flags()
+    repeated_pattern()
+    runtime_pattern()
+    invalid_conversion_repeated()
 
 .end
 
@@ -116,6 +120,80 @@ Executes sprintf tests.
 .end
 
 
+.sub decimal_flags
+  $P0 = new 'ResizablePMCArray'
+  push $P0,0
+  push $P0,-42
+  push $P0,42
+  push $P0,42
+  push $P0,7
+  $S0 = sprintf '<%+.0d|%05d|%-6u|% .4i|%+5.3d>', $P0
+  is( $S0, '<+|-0042|42    | 0042| +007>', 'decimal flags' )
+.end
+
+.sub repeated_pattern
+  .local string out
+  $I0 = 0
+  out = ''
+  $P0 = new 'ResizablePMCArray'
+  push $P0,0
+  push $P0,'x'
+  push $P0,0
+loop:
+  $P0[0] = $I0
+  $P0[2] = $I0
+  $S0 = sprintf '%d=%s%%%x;', $P0
+  out .= $S0
+  inc $I0
+  if $I0 < 12 goto loop
+  is( out, '0=x%0;1=x%1;2=x%2;3=x%3;4=x%4;5=x%5;6=x%6;7=x%7;8=x%8;9=x%9;10=x%a;11=x%b;', 'repeated pattern' )
+.end
+
+.sub runtime_pattern
+  .local string pat
+  $P0 = new 'ResizablePMCArray'
+  pat = ''
+  $I0 = 0
+loop:
+  pat .= '<%d>%%'
+  push $P0,$I0
+  inc $I0
+  if $I0 < 10 goto loop
+  $S0 = sprintf pat, $P0
+  is( $S0, '<0>%<1>%<2>%<3>%<4>%<5>%<6>%<7>%<8>%<9>%', 'pattern built at runtime' )
+.end
+
+.sub invalid_conversion_repeated
+  .local string msg
+  $P0 = new 'ResizablePMCArray'
+  push $P0,1
+  $I0 = 0
+  msg = ''
+loop:
+  push_eh handler
+  $S0 = sprintf '%d %5q', $P0
+  pop_eh
+  goto next
+handler:
+  .get_results($P1)
+  pop_eh
+  $S1 = $P1
+  msg .= $S1
+  msg .= ';'
+next:
+  inc $I0
+  if $I0 < 2 goto loop
+  $S2 = "'q' is not valid in sprintf format sequence '%5q';"
+  $S2 = repeat $S2, 2
+  is( msg, $S2, 'invalid conversion' )
+  throws_substring(<<'CODE', 'past end of string', 'lone trailing percent')
+    .sub main
+        $P0 = new 'ResizablePMCArray'
+        $S0 = sprintf 'abc%', $P0
+    .end
+CODE
+.end
+
 
 # Local Variables:
 #   mode: pir
@@ -149,6 +149,7 @@ Tests Parrot string registers and operations.
     corner_cases_of_numification()
     non_canonical_nan_and_inf()
     split_hll_mapped()
+    test_intern()
     # END_OF_TESTS
     join_get_string_returns_a_null_string()
 
@@ -1124,6 +1125,24 @@ WHILE:
     set $S0, "16foo"
     set $N0, $S0
     is( $N0, "16", '16foo to num' )
+
+    string_to_num_exact("9007199254740993", "9007199254740992")
+    string_to_num_exact("3.0744657e-46", "3.0744657e-46")
+    string_to_num_exact("579.6096057566703384916362055841718615", "579.60960575667036")
+    string_to_num_exact("2.2250738585072011e-308", "2.2250738585072009e-308")
+    string_to_num_exact("123456789012345678901234567890", "1.2345678901234568e+29")
+    string_to_num_exact("-0.00000000000000000000000000000000000000001e41", "-1")
+.end
+
+.sub string_to_num_exact
+    .param string s
+    .param string expected
+    $N0 = s
+    $P0 = new 'ResizablePMCArray'
+    push $P0, $N0
+    $S0 = sprintf "%.17g", $P0
+    $S1 = concat s, ' to num rounds correctly'
+    is( $S0, expected, $S1 )
 .end
 
 .sub concat_or_substr_cow
@@ -1846,6 +1865,40 @@ null2:
     is( $N0, "-Inf", 'Non canonical nan and inf' )
 .end
 
+.sub test_intern
+    .local string a, b, c
+    a = "intern"
+    a = concat a, "ed key"
+    b = "interned"
+    b = concat b, " key"
+    $I0 = issame a, b
+    is( $I0, 0, 'equal strings built at runtime are distinct' )
+
+    c = intern a
+    $I0 = issame c, a
+    is( $I0, 1, 'intern enters a new string' )
+    c = intern b
+    $I0 = issame c, a
+    is( $I0, 1, 'intern returns the interned string' )
+
+    a = "x"
+    a = concat a, "yz"
+    c = intern a
+    $I0 = issame c, "xyz"
+    is( $I0, 1, 'intern prefers the constant' )
+
+    c = utf8:"xyz"
+    c = intern c
+    $I0 = encoding c
+    $S0 = encodingname $I0
+    is( $S0, 'utf8', 'intern keeps the encoding' )
+
+    null a
+    c = intern a
+    $I0 = isnull c
+    is( $I0, 1, 'intern of a null string' )
+.end
+
 .HLL 'foohll'
 .sub split_hll_mapped
     .include 'test_more.pir'
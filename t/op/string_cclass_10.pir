@@ -0,0 +1,15 @@
+.sub main :main
+.include "cclass.pasm"
+   .local int result, char, len, i
+   .local string s
+   s = utf8:"abc   def"
+   len = length s
+   result = find_cclass .CCLASS_WHITESPACE, s, 0, len
+   print len
+   print ' '
+   print result
+   result = find_not_cclass .CCLASS_WHITESPACE, s, 3, len
+   print ' '
+   print result
+   print "\n"
+.end
@@ -0,0 +1,24 @@
+.include "cclass.pasm"
+.sub main :main
+    $S0 = iso-8859-1:"test_func(1)"
+    test( .CCLASS_WORD, $S0 )
+
+    $S0 = iso-8859-1:"ab\nC_X34.\0 \t!"
+    test( .CCLASS_NUMERIC, $S0 )
+    test( .CCLASS_LOWERCASE, $S0 )
+    test( .CCLASS_PUNCTUATION, $S0 )
+.end
+.sub test
+    .param int flags
+    .param string str
+    $I0 = 0
+    $I2 = length str
+loop:
+    $I1 = find_not_cclass flags, str, $I0, 100
+    print $I1
+    print ";"
+    inc $I0
+    if $I0 <= $I2 goto loop
+end:
+    print "\n"
+.end
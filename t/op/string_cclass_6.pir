@@ -0,0 +1,42 @@
+.include "cclass.pasm"
+.sub main :main
+    $S1 = iso-8859-1:"ab\nC_X34.\0 \t!"
+    test1( $S1 )
+.end
+.sub test1
+    .param string str
+    test2( str, .CCLASS_UPPERCASE)
+    test2( str, .CCLASS_LOWERCASE)
+    test2( str, .CCLASS_ALPHABETIC)
+    test2( str, .CCLASS_NUMERIC)
+    test2( str, .CCLASS_HEXADECIMAL)
+    test2( str, .CCLASS_WHITESPACE)
+    test2( str, .CCLASS_PRINTING)
+    test2( str, .CCLASS_GRAPHICAL)
+    test2( str, .CCLASS_BLANK)
+    test2( str, .CCLASS_CONTROL)
+    test2( str, .CCLASS_PUNCTUATION)
+    test2( str, .CCLASS_ALPHANUMERIC)
+    test2( str, .CCLASS_NEWLINE)
+    test2( str, .CCLASS_WORD)
+
+    $I0 = .CCLASS_NEWLINE|.CCLASS_WHITESPACE
+    test2( str, $I0)
+    $I0 = .CCLASS_WHITESPACE|.CCLASS_LOWERCASE
+    test2( str, $I0)
+    $I0 = .CCLASS_UPPERCASE|.CCLASS_PUNCTUATION
+    test2( str, $I0)
+.end
+.sub test2
+    .param string str
+    .param int code
+
+    $I1 = length str
+    set $I0, 0
+loop:
+    $I2 = is_cclass code, str, $I0
+    print $I2
+    inc $I0
+    if $I0 <= $I1 goto loop
+    print "\n"
+.end
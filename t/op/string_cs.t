@@ -5,7 +5,7 @@ use strict;
 use warnings;
 use lib qw( . lib ../lib ../../lib );
 use Test::More;
-use Parrot::Test tests => 58;
+use Parrot::Test tests => 64;
 use Parrot::Config;
 
 =head1 NAME
@@ -771,10 +771,76 @@ CODE
 6
 OUTPUT
 
-SKIP: {
-    skip( 'no ICU lib', 10 ) unless $PConfig{has_icu};
+pir_output_is( <<'CODE', <<"OUTPUT", "utf8 index, rindex and split after multibyte characters" );
+.sub main :main
+    $S0 = utf8:"\x{e9}t\x{e9} \x{4e2d}\x{6587} \x{e9}t\x{e9}"
+    $S1 = utf8:"\x{e9}t"
+    $I0 = index $S0, $S1
+    print $I0
+    $I0 = index $S0, $S1, 1
+    print $I0
+    $I0 = index $S0, ascii:" "
+    print $I0
+    $P0 = new ['String']
+    $P0 = $S0
+    $I0 = $P0.'reverse_index'($S1, 9)
+    print $I0
+    $I0 = $P0.'reverse_index'($S1, 6)
+    print $I0
+    $P1 = split ascii:" ", $S0
+    $I0 = elements $P1
+    print $I0
+    $S2 = $P1[1]
+    $I0 = length $S2
+    print $I0
+    print "\n"
+.end
+CODE
+0737032
+OUTPUT
 
-    pir_output_is( <<'CODE', <<"OUTPUT", "unicode downcase" );
+pir_output_is( <<'CODE', <<"OUTPUT", "ucs2 index only matches whole characters" );
+.sub main :main
+    $S0 = ucs2:"\u0100\u0101\u0100\u0101"
+    $S1 = ucs2:"\u0101"
+    $I0 = index $S0, $S1
+    print $I0
+    $P0 = new ['String']
+    $P0 = $S0
+    $I0 = $P0.'reverse_index'($S1, 2)
+    print $I0
+    $S1 = ucs2:"\u0101\u0001"
+    $I0 = index $S0, $S1
+    print $I0
+    print "\n"
+.end
+CODE
+11-1
+OUTPUT
+
+pir_output_is( <<'CODE', <<"OUTPUT", "index and split with a long periodic needle" );
+.sub main :main
+    $S0 = repeat utf8:"a\x{e9}", 40
+    $S1 = repeat utf8:"a\x{e9}", 12
+    $S2 = concat $S0, utf8:"b"
+    $S0 = concat $S0, $S2
+    $S1 = concat $S1, utf8:"b"
+    $I0 = index $S0, $S1
+    print $I0
+    print " "
+    $P0 = split $S1, $S0
+    $S3 = $P0[1]
+    $I0 = elements $P0
+    print $I0
+    $I0 = length $S3
+    print $I0
+    print "\n"
+.end
+CODE
+136 20
+OUTPUT
+
+pir_output_is( <<'CODE', <<"OUTPUT", "unicode downcase" );
 .sub main :main
     set $S0, iso-8859-1:"TTSCH"
     find_encoding $I0, "utf8"
@@ -790,7 +856,7 @@ CODE
 t\xc3\xb6tsch
 OUTPUT
 
-    pasm_output_is( <<'CODE', <<"OUTPUT", "unicode downcase, trans_encoding_s_s_i" );
+pasm_output_is( <<'CODE', <<"OUTPUT", "unicode downcase, trans_encoding_s_s_i" );
     .pcc_sub :main main:
     set S0, iso-8859-1:"TTSCH"
     find_encoding I0, "utf8"
@@ -805,7 +871,7 @@ CODE
 t\xf6tsch
 OUTPUT
 
-    pasm_output_is( <<'CODE', <<"OUTPUT", "unicode downcase - transencoding" );
+pasm_output_is( <<'CODE', <<"OUTPUT", "unicode downcase - transencoding" );
     .pcc_sub :main main:
     set S0, iso-8859-1:"TTSCH"
     find_encoding I0, "utf8"
@@ -820,7 +886,7 @@ CODE
 t\xc3\xb6tsch
 OUTPUT
 
-    pir_output_is( <<'CODE', <<"OUTPUT", "unicode upcase" );
+pir_output_is( <<'CODE', <<"OUTPUT", "unicode upcase" );
 .sub main :main
     set $S0, iso-8859-1:"ttsch"
     find_encoding $I0, "utf8"
@@ -836,7 +902,7 @@ CODE
 T\x{c3}\x{96}TSCH
 OUTPUT
 
-    pir_output_is( <<'CODE', <<"OUTPUT", "unicode upcase to combined char" );
+pir_output_is( <<'CODE', <<"OUTPUT", "unicode upcase to combined char" );
 .sub main :main
     set $S1, utf8:"hacek j \u01f0"
     upcase $S1, $S1
@@ -854,7 +920,7 @@ HACEK J J\xcc\x8c
 10
 OUTPUT
 
-    pir_output_is( <<'CODE', <<"OUTPUT", "unicode titlecase to combined char" );
+pir_output_is( <<'CODE', <<"OUTPUT", "unicode titlecase to combined char" );
 .sub main :main
     set $S1, utf8:"hacek j \u01f0"
     titlecase $S1, $S1
@@ -872,7 +938,7 @@ Hacek J J\xcc\x8c
 10
 OUTPUT
 
-    pir_output_is( <<'CODE', <<"OUTPUT", "unicode downcase to combined char" );
+pir_output_is( <<'CODE', <<"OUTPUT", "unicode downcase to combined char" );
 .sub main :main
     set $S1, utf8:"I WITH DOT ABOVE \u0130"
     downcase $S1, $S1
@@ -890,23 +956,23 @@ i with dot above i\xcc\x87
 19
 OUTPUT
 
-    # charset/unicode.c
-    #
-    # 106         dest_len = u_strToUpper(src->strstart, dest_len,
-    # (gdb) p src_len
-    # $17 = 7
-    # (gdb) p dest_len
-    # $18 = 7
-    # (gdb) x /8h src->strstart
-    # 0x844fb60:      0x005f  0x005f  0x005f  0x01f0  0x0031  0x0032  0x0033  0x0000
-    # (gdb) n
-    # 110         src->bufused = dest_len * sizeof(UChar);
-    # (gdb) p dest_len
-    # $19 = 8
-    # (gdb) x /8h src->strstart
-    # 0x844fb60:      0x005f  0x005f  0x005f  0x004a  0x030c  0x0031  0x0032  0x0000
-
-    pir_output_is( <<'CODE', <<"OUTPUT", "unicode upcase to combined char 3.2 bug?" );
+# charset/unicode.c
+#
+# 106         dest_len = u_strToUpper(src->strstart, dest_len,
+# (gdb) p src_len
+# $17 = 7
+# (gdb) p dest_len
+# $18 = 7
+# (gdb) x /8h src->strstart
+# 0x844fb60:      0x005f  0x005f  0x005f  0x01f0  0x0031  0x0032  0x0033  0x0000
+# (gdb) n
+# 110         src->bufused = dest_len * sizeof(UChar);
+# (gdb) p dest_len
+# $19 = 8
+# (gdb) x /8h src->strstart
+# 0x844fb60:      0x005f  0x005f  0x005f  0x004a  0x030c  0x0031  0x0032  0x0000
+
+pir_output_is( <<'CODE', <<"OUTPUT", "unicode upcase to combined char 3.2 bug?" );
 .sub main :main
     set $S1, utf8:"___\u01f0123"
     upcase $S1, $S1
@@ -920,7 +986,7 @@ CODE
 ___J\xcc\x8c123
 OUTPUT
 
-    pir_output_is( <<'CODE', <<"OUTPUT", "unicode titlecase" );
+pir_output_is( <<'CODE', <<"OUTPUT", "unicode titlecase" );
 .sub main :main
     set $S0, iso-8859-1:"ttsch leo"
     find_encoding $I0, "utf8"
@@ -936,6 +1002,143 @@ CODE
 T\x{c3}\x{b6}tsch Leo
 OUTPUT
 
+pir_output_is( <<'CODE', <<"OUTPUT", "case mapping keeps the utf8, ucs4 and latin1 encodings" );
+.sub main :main
+    $P0 = getstdout
+    $P0.'encoding'("utf8")
+    $S0 = utf8:"stra\u00dfe \u03b1\u03b2 dz"
+    $S1 = upcase $S0
+    show($S1)
+    $S1 = downcase $S1
+    show($S1)
+    $S1 = titlecase $S0
+    show($S1)
+    $I0 = find_encoding "ucs4"
+    $S0 = trans_encoding $S0, $I0
+    $S1 = upcase $S0
+    show($S1)
+    $S1 = titlecase $S0
+    show($S1)
+    $S0 = iso-8859-1:"\xff\xe9t\xe9"
+    $S1 = upcase $S0
+    show($S1)
+.end
+
+.sub show
+    .param string s
+    $I0 = encoding s
+    $S0 = encodingname $I0
+    $I1 = length s
+    $I0 = find_encoding "utf8"
+    s = trans_encoding s, $I0
+    print s
+    print " "
+    print $S0
+    print " "
+    say $I1
+.end
+CODE
+STRASSE \xce\x91\xce\x92 DZ utf8 13
+strasse \xce\xb1\xce\xb2 dz utf8 13
+Stra\xc3\x9fe \xce\x91\xce\xb2 Dz utf8 12
+STRASSE \xce\x91\xce\x92 DZ ucs4 13
+Stra\xc3\x9fe \xce\x91\xce\xb2 Dz ucs4 12
+\xc3\xbf\xc3\x89T\xc3\x89 iso-8859-1 4
+OUTPUT
+
+pir_output_is( <<'CODE', <<"OUTPUT", "case mapping of empty strings" );
+.sub main :main
+    show(ascii:"")
+    show(iso-8859-1:"")
+    show(utf8:"")
+    $I0 = find_encoding "ucs4"
+    $S0 = trans_encoding "", $I0
+    show($S0)
+    $I0 = find_encoding "ucs2"
+    $S0 = trans_encoding "", $I0
+    show($S0)
+.end
+
+.sub show
+    .param string s
+    $I0 = encoding s
+    $S0 = encodingname $I0
+    print $S0
+    $S1 = upcase s
+    $I0 = length $S1
+    print " "
+    print $I0
+    $S1 = downcase s
+    $I0 = length $S1
+    print " "
+    print $I0
+    $S1 = titlecase s
+    $I0 = length $S1
+    print " "
+    say $I0
+.end
+CODE
+ascii 0 0 0
+iso-8859-1 0 0 0
+utf8 0 0 0
+ucs4 0 0 0
+ucs2 0 0 0
+OUTPUT
+
+pir_output_is( <<'CODE', <<"OUTPUT", "case mapping of zero-length substrings" );
+.sub main :main
+    show(ascii:"abc")
+    show(iso-8859-1:"\xe9t\xe9")
+    show(utf8:"stra\u00dfe \u01f0")
+    $I0 = find_encoding "ucs4"
+    $S0 = trans_encoding utf8:"\u03b1\u03b2", $I0
+    show($S0)
+    $I0 = find_encoding "ucs2"
+    $S0 = trans_encoding utf8:"\u03b1\u03b2", $I0
+    show($S0)
+.end
+
+# empty slices from the middle and the end of s, and s chopped to nothing
+.sub show
+    .param string s
+    .local int len
+    len = length s
+    $I0 = encoding s
+    $S0 = encodingname $I0
+    print $S0
+    $S1 = substr s, 1, 0
+    map_case($S1)
+    $S1 = substr s, len, 0
+    map_case($S1)
+    $S1 = chopn s, len
+    map_case($S1)
+    $I0 = length s
+    print " "
+    say $I0
+.end
+
+.sub map_case
+    .param string s
+    $S1 = upcase s
+    $S2 = downcase s
+    $S3 = titlecase s
+    $S0 = concat $S1, $S2
+    $S0 = concat $S0, $S3
+    $I0 = length $S0
+    print " "
+    print $I0
+.end
+CODE
+ascii 0 0 0 3
+iso-8859-1 0 0 0 3
+utf8 0 0 0 8
+ucs4 0 0 0 2
+ucs2 0 0 0 2
+OUTPUT
+
+SKIP: {
+    skip( 'no ICU lib', 1 ) unless $PConfig{has_icu};
+
     pir_output_is( <<'CODE', <<OUTPUT, "compose combined char" );
 .sub main :main
     set $S1, utf8:"___\u01f0___"
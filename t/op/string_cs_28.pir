@@ -0,0 +1,4 @@
+.sub main :main
+    $S0 = utf8:"\"]\nif I3 == "
+    print "ok 1\n"
+.end
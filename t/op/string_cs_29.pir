@@ -0,0 +1,10 @@
+.sub main :main
+    $P0 = new 'Integer'
+    $P0 = 42
+    set_global ['Foo'], utf8:"Bar", $P0
+    print "ok 1\n"
+    $P1 = get_global ['Foo'], "Bar"
+    print "ok 2\n"
+    print $P1
+    print "\n"
+.end
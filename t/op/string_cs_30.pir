@@ -0,0 +1,11 @@
+.sub main :main
+    .local string s, t, u
+    s = "abcd"
+    t = utf8:"efg\n"
+    u = s . t
+    print u
+    s = utf8:"abcd"
+    t = "efg\n"
+    u = s . t
+    print u
+.end
@@ -0,0 +1,23 @@
+.sub main :main
+    $S0 = utf8:"\x{e9}t\x{e9} \x{4e2d}\x{6587} \x{e9}t\x{e9}"
+    $S1 = utf8:"\x{e9}t"
+    $I0 = index $S0, $S1
+    print $I0
+    $I0 = index $S0, $S1, 1
+    print $I0
+    $I0 = index $S0, ascii:" "
+    print $I0
+    $P0 = new ['String']
+    $P0 = $S0
+    $I0 = $P0.'reverse_index'($S1, 9)
+    print $I0
+    $I0 = $P0.'reverse_index'($S1, 6)
+    print $I0
+    $P1 = split ascii:" ", $S0
+    $I0 = elements $P1
+    print $I0
+    $S2 = $P1[1]
+    $I0 = length $S2
+    print $I0
+    print "\n"
+.end
@@ -0,0 +1,14 @@
+.sub main :main
+    $S0 = ucs2:"\u0100\u0101\u0100\u0101"
+    $S1 = ucs2:"\u0101"
+    $I0 = index $S0, $S1
+    print $I0
+    $P0 = new ['String']
+    $P0 = $S0
+    $I0 = $P0.'reverse_index'($S1, 2)
+    print $I0
+    $S1 = ucs2:"\u0101\u0001"
+    $I0 = index $S0, $S1
+    print $I0
+    print "\n"
+.end
@@ -0,0 +1,17 @@
+.sub main :main
+    $S0 = repeat utf8:"a\x{e9}", 40
+    $S1 = repeat utf8:"a\x{e9}", 12
+    $S2 = concat $S0, utf8:"b"
+    $S0 = concat $S0, $S2
+    $S1 = concat $S1, utf8:"b"
+    $I0 = index $S0, $S1
+    print $I0
+    print " "
+    $P0 = split $S1, $S0
+    $S3 = $P0[1]
+    $I0 = elements $P0
+    print $I0
+    $I0 = length $S3
+    print $I0
+    print "\n"
+.end
@@ -0,0 +1,12 @@
+.sub main :main
+    set $S1, utf8:"hacek j \u01f0"
+    upcase $S1, $S1
+    getstdout $P0          # need to convert back to utf8
+    $P0.'encoding'("utf8") # set utf8 output
+    print $S1
+    print "\n"
+    length $I0, $S1
+    print $I0
+    print "\n"
+    end
+.end
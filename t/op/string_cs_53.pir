@@ -0,0 +1,9 @@
+.sub main :main
+    set $S1, utf8:"___\u01f0123"
+    upcase $S1, $S1
+    getstdout $P0          # need to convert back to utf8
+    $P0.'encoding'("utf8") # set utf8 output
+    print $S1
+    print "\n"
+    end
+.end
@@ -0,0 +1,11 @@
+.sub main :main
+    set $S0, iso-8859-1:"ttsch leo"
+    find_encoding $I0, "utf8"
+    trans_encoding $S1, $S0, $I0
+    titlecase $S1, $S1
+    getstdout $P0          # need to convert back to utf8
+    $P0.'encoding'("utf8") # set utf8 output
+    print $S1
+    print "\n"
+    end
+.end
@@ -0,0 +1,34 @@
+.sub main :main
+    $P0 = getstdout
+    $P0.'encoding'("utf8")
+    $S0 = utf8:"stra\u00dfe \u03b1\u03b2 dz"
+    $S1 = upcase $S0
+    show($S1)
+    $S1 = downcase $S1
+    show($S1)
+    $S1 = titlecase $S0
+    show($S1)
+    $I0 = find_encoding "ucs4"
+    $S0 = trans_encoding $S0, $I0
+    $S1 = upcase $S0
+    show($S1)
+    $S1 = titlecase $S0
+    show($S1)
+    $S0 = iso-8859-1:"\xff\xe9t\xe9"
+    $S1 = upcase $S0
+    show($S1)
+.end
+
+.sub show
+    .param string s
+    $I0 = encoding s
+    $S0 = encodingname $I0
+    $I1 = length s
+    $I0 = find_encoding "utf8"
+    s = trans_encoding s, $I0
+    print s
+    print " "
+    print $S0
+    print " "
+    say $I1
+.end
@@ -0,0 +1,30 @@
+.sub main :main
+    show(ascii:"")
+    show(iso-8859-1:"")
+    show(utf8:"")
+    $I0 = find_encoding "ucs4"
+    $S0 = trans_encoding "", $I0
+    show($S0)
+    $I0 = find_encoding "ucs2"
+    $S0 = trans_encoding "", $I0
+    show($S0)
+.end
+
+.sub show
+    .param string s
+    $I0 = encoding s
+    $S0 = encodingname $I0
+    print $S0
+    $S1 = upcase s
+    $I0 = length $S1
+    print " "
+    print $I0
+    $S1 = downcase s
+    $I0 = length $S1
+    print " "
+    print $I0
+    $S1 = titlecase s
+    $I0 = length $S1
+    print " "
+    say $I0
+.end
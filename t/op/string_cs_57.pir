@@ -0,0 +1,42 @@
+.sub main :main
+    show(ascii:"abc")
+    show(iso-8859-1:"\xe9t\xe9")
+    show(utf8:"stra\u00dfe \u01f0")
+    $I0 = find_encoding "ucs4"
+    $S0 = trans_encoding utf8:"\u03b1\u03b2", $I0
+    show($S0)
+    $I0 = find_encoding "ucs2"
+    $S0 = trans_encoding utf8:"\u03b1\u03b2", $I0
+    show($S0)
+.end
+
+# empty slices from the middle and the end of s, and s chopped to nothing
+.sub show
+    .param string s
+    .local int len
+    len = length s
+    $I0 = encoding s
+    $S0 = encodingname $I0
+    print $S0
+    $S1 = substr s, 1, 0
+    map_case($S1)
+    $S1 = substr s, len, 0
+    map_case($S1)
+    $S1 = chopn s, len
+    map_case($S1)
+    $I0 = length s
+    print " "
+    say $I0
+.end
+
+.sub map_case
+    .param string s
+    $S1 = upcase s
+    $S2 = downcase s
+    $S3 = titlecase s
+    $S0 = concat $S1, $S2
+    $S0 = concat $S0, $S3
+    $I0 = length $S0
+    print " "
+    print $I0
+.end
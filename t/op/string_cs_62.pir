@@ -0,0 +1,5 @@
+.sub 'main' :main
+    $S0 = utf8:"x/\u0445\u0440\u0435\u043d\u044c_09-10.txt"
+    $S1 = escape $S0
+    say $S1
+.end
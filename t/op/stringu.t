@@ -5,7 +5,7 @@ use strict;
 use warnings;
 use lib qw( . lib ../lib ../../lib );
 use Test::More;
-use Parrot::Test tests => 50;
+use Parrot::Test tests => 52;
 use Parrot::Config;
 
 =head1 NAME
@@ -1268,6 +1268,90 @@ CODE
 6
 OUTPUT
 
+pir_output_is(<<'CODE',<<'OUTPUT', 'transcode utf8 to and from utf16, ucs4 and latin1');
+.sub main :main
+    .local string s, t
+    $I8  = find_encoding 'utf8'
+    $I16 = find_encoding 'utf16'
+    $I32 = find_encoding 'ucs4'
+    $I1  = find_encoding 'iso-8859-1'
+
+    s = repeat "abcdefgh", 3
+    $S0 = unicode:"\x{e9}\x{4e2d}\x{1f600}z"
+    s .= $S0
+    t = trans_encoding s, $I16
+    $I0 = length t
+    $I2 = bytelength t
+    print $I0
+    print ' '
+    say $I2
+    $S1 = substr t, 26, 1
+    $I0 = ord $S1
+    say $I0
+    t = trans_encoding s, $I32
+    $I2 = bytelength t
+    say $I2
+    t = trans_encoding t, $I8
+    $I0 = iseq t, s
+    say $I0
+
+    $S0 = chr 0xff
+    t = repeat "xyzxyzxyz", 2
+    t .= $S0
+    t = trans_encoding t, $I1
+    t = trans_encoding t, $I8
+    $I0 = length t
+    $I2 = bytelength t
+    print $I0
+    print ' '
+    say $I2
+    $I0 = ord t, 18
+    say $I0
+.end
+CODE
+28 58
+128512
+112
+1
+19 20
+255
+OUTPUT
+
+pir_output_is(<<'CODE',<<'OUTPUT', 'validate utf8 after long ascii runs');
+.sub main :main
+    .local pmc bb
+    .local string s
+    bb = new ['ByteBuffer']
+    $S0 = repeat "abcdefghijklmnopqrstuvwxyz", 2
+    bb = $S0
+    bb[52] = 0xc3
+    bb[53] = 0xa9
+    s = bb.'get_string'('utf8')
+    $I0 = length s
+    say $I0
+    bb[53] = 0x41
+    push_eh malformed
+    s = bb.'get_string'('utf8')
+    say 'not reached'
+  malformed:
+    pop_eh
+    bb[52] = 0xe0
+    bb[53] = 0x80
+    bb[54] = 0x80
+    push_eh overlong
+    s = bb.'get_string'('utf8')
+    say 'not reached'
+  overlong:
+    .get_results($P0)
+    pop_eh
+    $S0 = $P0
+    print $S0
+.end
+CODE
+53
+Overlong form in UTF-8 string
+OUTPUT
+
 # Local Variables:
 #   mode: cperl
 #   cperl-indent-level: 4
@@ -0,0 +1,13 @@
+.sub main
+    $S1 = utf8:"\x{a2}"
+    say $S1
+
+    concat $S1, unicode:"\x{a2}", unicode:"\x{a2}"
+    say $S1
+
+    concat $S2, unicode:"\x{a2}", "c"
+    say $S2
+
+    concat $S3, unicode:"\x{62}", unicode:"\x{62}"
+    say $S3
+.end
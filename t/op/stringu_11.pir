@@ -0,0 +1,16 @@
+.sub main :main
+    $P0 = getinterp
+    $P1 = $P0.'stdout_handle'()
+    $P1.'encoding'("utf8")
+    set $S0, "ok 1\cJ"
+    print $S0
+    set $S0, "ok 2\012"
+    print $S0
+    set $S0, "ok 3\12"
+    print $S0
+    set $S0, "ok 4\x0a"
+    print $S0
+    set $S0, "ok 5\xa"
+    print $S0
+    end
+.end
@@ -0,0 +1,9 @@
+.sub main :main
+    $P0 = getinterp
+    $P1 = $P0.'stdout_handle'()
+    $P1.'encoding'("utf8")
+    chr $S0, 0x212B
+    print $S0
+    print "\n"
+    end
+.end
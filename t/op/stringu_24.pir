@@ -0,0 +1,16 @@
+.sub main :main
+    .local string str
+    .local string rest
+
+    str = utf8:".xyz"
+    rest = substr str, 1
+    print rest
+    print "\n"
+
+    str = utf8:".xyz"
+    $S99 = downcase str
+    rest = substr str, 1
+    print rest
+    print "\n"
+
+.end
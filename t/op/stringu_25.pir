@@ -0,0 +1,8 @@
+.sub main :main
+    .local string str
+    .local string rest
+    str = utf8:".XYZ"
+    $S0 = downcase str
+    print $S0
+    print "\n"
+.end
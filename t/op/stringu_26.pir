@@ -0,0 +1,11 @@
+.sub main :main
+    .local string s, t
+    .local int i
+    s = iso-8859-1:"Ttsch"
+    i = find_encoding "utf8"
+    s = trans_encoding s, i
+    t = upcase s
+    escape t, t
+    print t
+    print "\n"
+.end
@@ -0,0 +1,23 @@
+.sub main :main
+    .include 'cclass.pasm'
+    .local string s
+    s = utf8:" \t\u207babc\n\u2000\u2009"
+    $I9 = length s
+    $I0 = is_cclass .CCLASS_ANY, s, 0
+    print $I0
+    $I0 = is_cclass .CCLASS_ANY, s, 1
+    print $I0
+    $I0 = is_cclass .CCLASS_ANY, s, 2
+    print $I0
+    $I0 = is_cclass .CCLASS_ANY, s, $I9
+    print $I0
+    $I0 = find_not_cclass .CCLASS_ANY, s, 0, $I9
+    print $I0
+    $I0 = find_not_cclass .CCLASS_ANY, s, $I0, $I9
+    print $I0
+    $I0 = find_cclass .CCLASS_ANY, s, $I0, $I9
+    print $I0
+    $I0 = find_cclass .CCLASS_ANY, s, 2, $I9
+    print $I0
+    print "\n"
+.end
@@ -0,0 +1,21 @@
+.sub main :main
+    .include 'cclass.pasm'
+    .local string s
+    s = utf8:"01\u207bxyz\u0660\u17e1\u19d9"
+    $I9 = length s
+    $I0 = is_cclass .CCLASS_NUMERIC, s, 0
+    print $I0
+    $I0 = is_cclass .CCLASS_NUMERIC, s, 1
+    print $I0
+    $I0 = is_cclass .CCLASS_NUMERIC, s, 2
+    print $I0
+    $I0 = find_not_cclass .CCLASS_NUMERIC, s, 0, $I9
+    print $I0
+    $I0 = find_not_cclass .CCLASS_NUMERIC, s, $I0, $I9
+    print $I0
+    $I0 = find_cclass .CCLASS_NUMERIC, s, $I0, $I9
+    print $I0
+    $I0 = find_not_cclass .CCLASS_NUMERIC, s, $I0, $I9
+    print $I0
+    print "\n"
+.end
@@ -0,0 +1,19 @@
+.sub main :main
+    $S0 = utf8:"A"
+    $S1 = ascii:"B"
+    $S2 = concat $S0, $S1
+    print $S2
+    print "\n"
+
+    $S0 = utf8:"A"
+    $S1 = utf8:"B"
+    $S2 = concat $S0, $S1
+    print $S2
+    print "\n"
+
+    $S0 = utf8:"A"
+    $S1 = iso-8859-1:"B"
+    $S2 = concat $S0, $S1
+    print $S2
+    print "\n"
+.end
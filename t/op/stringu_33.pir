@@ -0,0 +1,9 @@
+.sub main :main
+     $S0 = "140"
+     $I0 = $S0
+     say $I0
+     $I0 = find_encoding 'ucs2'
+     $S0 = trans_encoding $S0, $I0
+     $I0 = $S0
+     say $I0
+.end
@@ -0,0 +1,9 @@
+.sub main :main
+     $S0 = "140"
+     $N0 = $S0
+     say $N0
+     $I0 = find_encoding 'ucs2'
+     $S0 = trans_encoding $S0, $I0
+     $N0 = $S0
+     say $N0
+.end
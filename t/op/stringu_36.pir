@@ -0,0 +1,19 @@
+.sub 'main' :main
+
+    $S1 = chr 0xe5
+    $S2 = chr 0x263b
+
+    $S0 = utf8:"\u00e5\u263b"
+    $S3 = concat $S1, $S2
+    if $S0 == $S3 goto equal_1
+    print "not "
+  equal_1:
+    say "equal"
+
+    $S0 = utf8:"\u263b\u00e5"
+    $S3 = concat $S2, $S1
+    if $S0 == $S3 goto equal_2
+    print "not "
+  equal_2:
+    say "equal"
+.end
@@ -0,0 +1,9 @@
+.sub 'main' :main
+    new $P0, 'ResizablePMCArray'
+    push $P0, ascii:"a"
+    push $P0, utf8:"\x{e1}" # a acute
+    push $P0, iso-8859-1:"\x{e1}" # a acute
+    join $S0, "", $P0
+    $I0 = length $S0
+    say $I0
+.end
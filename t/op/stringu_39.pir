@@ -0,0 +1,51 @@
+.sub 'main' :main
+    # malformed strings
+    'test_chars'(binary:"\x41\x80\x41")
+    'test_chars'(binary:"\x41\xBF\x41")
+    'test_chars'(binary:"\x41\xC1\xBF")
+    'test_chars'(binary:"\x41\xC2\x41")
+    'test_chars'(binary:"\x41\xF5\xA1\xA2\xA3")
+    'test_chars'(binary:"\x41\xFE\x41")
+
+    # unaligned end
+    'test_chars'(binary:"\xC2")
+    'test_chars'(binary:"\xF4")
+    'test_chars'(binary:"\xE1\x80")
+    'test_chars'(binary:"\xF2\xAB")
+    'test_chars'(binary:"\xF1\x80\x80")
+
+    # overlong forms
+    'test_chars'(binary:"\xE0\x9F\xBF")         # 0x07FF
+    'test_chars'(binary:"\xF0\x8F\xBF\xBD")     # 0xFFFD
+
+    # invalid chars
+    'test_chars'(binary:"\xED\xA0\x80")         # 0xD800
+    'test_chars'(binary:"\xED\xBF\xBF")         # 0xDFFF
+    'test_chars'(binary:"\xEF\xB7\x90")         # 0xFDD0
+    'test_chars'(binary:"\xEF\xB7\xAF")         # 0xFDEF
+    'test_chars'(binary:"\xEF\xBF\xBE")         # 0xFFFE
+    'test_chars'(binary:"\xEF\xBF\xBF")         # 0xFFFF
+    'test_chars'(binary:"\xF0\x9F\xBF\xBE")     # 0x1FFFE
+    'test_chars'(binary:"\xF4\x8F\xBF\xBF")     # 0x10FFFF
+    'test_chars'(binary:"\xF4\x90\x80\x80")     # 0x110000
+.end
+
+.sub 'test_chars'
+    .param string chars
+    .local pmc eh, ex, bb
+    bb = new 'ByteBuffer'
+    bb = chars
+    eh = new 'ExceptionHandler'
+    set_label eh, handler
+    push_eh eh
+    chars = bb.'get_string'('utf8')
+    say 'valid'
+    goto end
+  handler:
+    .local pmc ex
+    .get_results (ex)
+    $S0 = ex['message']
+    print $S0
+  end:
+    pop_eh
+.end
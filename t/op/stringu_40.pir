@@ -0,0 +1,26 @@
+.sub 'main' :main
+    'test_chars'(binary:"\xC2\x80")
+    'test_chars'(binary:"\xE0\xA0\x80")
+    'test_chars'(binary:"\xED\x9F\xBF")
+    'test_chars'(binary:"\xEE\x80\x80")
+    'test_chars'(binary:"\xEF\xB7\x8F")
+    'test_chars'(binary:"\xEF\xB7\xB0")
+    'test_chars'(binary:"\xEF\xBF\xBD")
+    'test_chars'(binary:"\xF0\x90\x80\x80")
+    'test_chars'(binary:"\xF0\x9F\xBF\xBD")
+    'test_chars'(binary:"\xF0\xA0\x80\x80")
+    'test_chars'(binary:"\xF4\x8F\xBF\xBD")
+.end
+
+.sub 'test_chars'
+    .param string chars
+    .local pmc bb
+    bb = new 'ByteBuffer'
+    bb = chars
+    chars = bb.'get_string'('utf8')
+    $I0 = ord chars
+    $P0 = new 'FixedIntegerArray', 1
+    $P0[0] = $I0
+    $S0 = sprintf '0x%X', $P0
+    say $S0
+.end
@@ -0,0 +1,39 @@
+.sub 'main' :main
+    'test_chars'(binary:"\x41\x42\x43")
+    'test_chars'(binary:"\x00\xD8")
+    'test_chars'(binary:"\xFF\xDF")
+    'test_chars'(binary:"\x00\xD8\x41\x00")
+    'test_chars'(binary:"\x00\xD9\xFF\xDA")
+    'test_chars'(binary:"\xFF\xDB\x00\xD8")
+    'test_chars'(binary:"\x00\xDC\xFF\xD8")
+    'test_chars'(binary:"\xFF\xDD\x00\xDE")
+    'test_chars'(binary:"\xFF\xDF\x41\x00")
+    'test_chars'(binary:"\xD0\xFD")
+    'test_chars'(binary:"\xEF\xFD")
+    'test_chars'(binary:"\xFE\xFF")
+    'test_chars'(binary:"\xFF\xFF")
+    'test_chars'(binary:"\x00\xD8\x00\xDC")
+    'test_chars'(binary:"\x12\xD9\x34\xDE")
+    'test_chars'(binary:"\xFF\xDB\xFD\xDF")
+
+.end
+
+.sub 'test_chars'
+    .param string chars
+    .local pmc eh, ex, bb
+    bb = new 'ByteBuffer'
+    bb = chars
+    eh = new 'ExceptionHandler'
+    set_label eh, handler
+    push_eh eh
+    chars = bb.'get_string'('ucs2')
+    say 'valid'
+    goto end
+  handler:
+    .local pmc ex
+    .get_results (ex)
+    $S0 = ex['message']
+    print $S0
+  end:
+    pop_eh
+.end
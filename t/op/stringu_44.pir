@@ -0,0 +1,22 @@
+.sub 'main' :main
+    'test_chars'(binary:"\x41\x00")
+    'test_chars'(binary:"\xFF\xD7")
+    'test_chars'(binary:"\x00\xE0")
+    'test_chars'(binary:"\xCF\xFD")
+    'test_chars'(binary:"\xF0\xFD")
+    'test_chars'(binary:"\xFD\xFF")
+
+.end
+
+.sub 'test_chars'
+    .param string chars
+    .local pmc bb
+    bb = new 'ByteBuffer'
+    bb = chars
+    chars = bb.'get_string'('ucs2')
+    $I0 = ord chars
+    $P0 = new 'FixedIntegerArray', 1
+    $P0[0] = $I0
+    $S0 = sprintf '0x%X', $P0
+    say $S0
+.end
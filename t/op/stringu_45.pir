@@ -0,0 +1,48 @@
+.sub 'main' :main
+    'test_chars'(binary:"\x00\x00\x00")
+    'test_chars'(binary:"\x00\x00\x00\x00\x00")
+    'test_chars'(binary:"\x00\x00\x00\x00\x00\x00")
+    'test_chars'(binary:"\x00\xD8\x00\x00")
+    'test_chars'(binary:"\xFF\xDF\x00\x00")
+    'test_chars'(binary:"\xD0\xFD\x00\x00")
+    'test_chars'(binary:"\xEF\xFD\x00\x00")
+    'test_chars'(binary:"\xFE\xFF\x00\x00")
+    'test_chars'(binary:"\xFF\xFF\x00\x00")
+    'test_chars'(binary:"\xFE\xFF\x01\x00")
+    'test_chars'(binary:"\xFF\xFF\x02\x00")
+    'test_chars'(binary:"\xFE\xFF\x10\x00")
+    'test_chars'(binary:"\xFF\xFF\x10\x00")
+    'test_chars'(binary:"\x00\x00\x11\x00")
+    'test_chars'(binary:"\x78\x56\x34\x12")
+    'test_chars'(binary:"\xFF\xFF\xFF\xFF")
+
+.end
+
+.sub 'test_chars'
+    .param string chars
+    .local pmc eh, ex, bb
+    .local string aux
+    aux = escape chars
+    bb = new 'ByteBuffer'
+    bb = chars
+    eh = new 'ExceptionHandler'
+    set_label eh, handler
+    push_eh eh
+    chars = bb.'get_string'('ucs4')
+    pop_eh
+    # Print some useful info in case of unexpectedly legal
+    print aux
+    print " - "
+    aux = escape chars
+    print aux
+    print " : "
+    say 'valid'
+    goto end
+  handler:
+    .local pmc ex
+    .get_results (ex)
+    $S0 = ex['message']
+    print $S0
+    pop_eh
+  end:
+.end
@@ -0,0 +1,28 @@
+.sub 'main' :main
+    'test_chars'(binary:"\x41\x00\x00\x00")
+    'test_chars'(binary:"\xFF\xD7\x00\x00")
+    'test_chars'(binary:"\x00\xE0\x00\x00")
+    'test_chars'(binary:"\xCF\xFD\x00\x00")
+    'test_chars'(binary:"\xF0\xFD\x00\x00")
+    'test_chars'(binary:"\xFD\xFF\x00\x00")
+    'test_chars'(binary:"\x00\x00\x01\x00")
+    'test_chars'(binary:"\xFD\xFF\x01\x00")
+    'test_chars'(binary:"\x00\x00\x02\x00")
+    'test_chars'(binary:"\xFD\xFF\x07\x00")
+    'test_chars'(binary:"\x00\x00\x0B\x00")
+    'test_chars'(binary:"\xFD\xFF\x10\x00")
+
+.end
+
+.sub 'test_chars'
+    .param string chars
+    .local pmc bb
+    bb = new 'ByteBuffer'
+    bb = chars
+    chars = bb.'get_string'('ucs4')
+    $I0 = ord chars
+    $P0 = new 'FixedIntegerArray', 1
+    $P0[0] = $I0
+    $S0 = sprintf '0x%X', $P0
+    say $S0
+.end
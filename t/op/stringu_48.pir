@@ -0,0 +1,22 @@
+.sub 'main' :main
+    'test_name'('LINE FEED (LF)')
+    'test_name'('CARRIAGE RETURN (CR)')
+    'test_name'('NULL')
+    'test_name'('NEXT LINE (NEL)')
+    'test_name'('CHARACTER TABULATION')
+.end
+
+.sub 'test_name'
+    .param string chars
+    $I0 = find_codepoint chars
+    if $I0 == -1 goto fail
+
+    .const string cpf = "0x%04x"
+    $P0 = new 'FixedIntegerArray', 1
+    $P0[0] = $I0
+    $S0 = sprintf cpf, $P0
+    say $S0
+    .return ()
+  fail:
+    say -1
+.end
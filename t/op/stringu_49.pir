@@ -0,0 +1,21 @@
+.sub 'main' :main
+    test(utf8:"a\uBABEb c\uBEEFd")
+    test(utf16:"a\uBABEb c\uBEEFd")
+    test(ucs2:"a\uBABEb c\uBEEFd")
+    test(ucs4:"a\uBABEb c\uBEEFd")
+.end
+
+.sub 'test'
+    .param string str
+    .local int c
+
+    c = ord str, -2
+    say c
+
+    push_eh handler
+    c = ord str, 100
+    print "not "
+handler:
+    say "ok"
+    pop_eh
+.end
@@ -0,0 +1,31 @@
+.sub main :main
+    $S0 = unicode:"mäöüØ€p"
+    $P0 = new 'ResizablePMCArray'
+    push $P0, $S0
+    $S1 = sprintf unicode:"[%20s]", $P0
+    $I0 = length $S1
+    say $I0
+
+    $S0 = unicode:"ä"
+    $P0 = new 'ResizablePMCArray'
+    push $P0, $S0
+    $S1 = sprintf unicode:"[%4s]", $P0
+    $I0 = length $S1
+    say $I0
+
+    # this works correctly
+    $S0 = unicode:"ä"
+    $P0 = new 'ResizablePMCArray'
+    push $P0, $S0
+    $S1 = sprintf unicode:"[%1s]", $P0
+    $I0 = length $S1
+    say $I0
+
+    # this works correctly
+    $S0 = unicode:"a"
+    $P0 = new 'ResizablePMCArray'
+    push $P0, $S0
+    $S1 = sprintf unicode:"[%4s]", $P0
+    $I0 = length $S1
+    say $I0
+.end
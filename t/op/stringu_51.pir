@@ -0,0 +1,39 @@
+.sub main :main
+    .local string s, t
+    $I8  = find_encoding 'utf8'
+    $I16 = find_encoding 'utf16'
+    $I32 = find_encoding 'ucs4'
+    $I1  = find_encoding 'iso-8859-1'
+
+    s = repeat "abcdefgh", 3
+    $S0 = unicode:"\x{e9}\x{4e2d}\x{1f600}z"
+    s .= $S0
+    t = trans_encoding s, $I16
+    $I0 = length t
+    $I2 = bytelength t
+    print $I0
+    print ' '
+    say $I2
+    $S1 = substr t, 26, 1
+    $I0 = ord $S1
+    say $I0
+    t = trans_encoding s, $I32
+    $I2 = bytelength t
+    say $I2
+    t = trans_encoding t, $I8
+    $I0 = iseq t, s
+    say $I0
+
+    $S0 = chr 0xff
+    t = repeat "xyzxyzxyz", 2
+    t .= $S0
+    t = trans_encoding t, $I1
+    t = trans_encoding t, $I8
+    $I0 = length t
+    $I2 = bytelength t
+    print $I0
+    print ' '
+    say $I2
+    $I0 = ord t, 18
+    say $I0
+.end
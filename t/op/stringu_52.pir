@@ -0,0 +1,29 @@
+.sub main :main
+    .local pmc bb
+    .local string s
+    bb = new ['ByteBuffer']
+    $S0 = repeat "abcdefghijklmnopqrstuvwxyz", 2
+    bb = $S0
+    bb[52] = 0xc3
+    bb[53] = 0xa9
+    s = bb.'get_string'('utf8')
+    $I0 = length s
+    say $I0
+    bb[53] = 0x41
+    push_eh malformed
+    s = bb.'get_string'('utf8')
+    say 'not reached'
+  malformed:
+    pop_eh
+    bb[52] = 0xe0
+    bb[53] = 0x80
+    bb[54] = 0x80
+    push_eh overlong
+    s = bb.'get_string'('utf8')
+    say 'not reached'
+  overlong:
+    .get_results($P0)
+    pop_eh
+    $S0 = $P0
+    print $S0
+.end
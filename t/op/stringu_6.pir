@@ -0,0 +1,9 @@
+.sub main :main
+    $P0 = getinterp
+    $P1 = $P0.'stdout_handle'()
+    $P1.'encoding'("utf8")
+    set $S0, utf8:"aaaaaa\u212b-aaaaaa"
+    print $S0
+    print "\n"
+    end
+.end
@@ -0,0 +1,12 @@
+.sub main :main
+    $P0 = getinterp
+    $P1 = $P0.'stdout_handle'()
+    $P1.'encoding'("utf8")
+    set $S0, utf8:"aaaaaa\x{212b}-bbbbbb\x{1d400}-cccccc"
+    print $S0
+    print "\n"
+    length $I0, $S0
+    print $I0
+    print "\n"
+    end
+.end
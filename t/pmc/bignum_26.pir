@@ -0,0 +1,29 @@
+.include 'fp_equality.pasm'
+.sub main :main
+    $P0 = new ['BigNum']
+    $P1 = new ['Integer']
+    $P0 = 5
+    $P1 = 3
+    $P0 = $P0.'pow'($P1)
+    $N0 = $P0
+    .fp_eq($N0, 125.0, OK1)
+    print "not "
+OK1:say "ok 1"
+
+    $P0 = 2
+    $P1 = -1
+    $P0 = $P0.'pow'($P1)
+    $N0 = $P0
+    .fp_eq($N0, 0.5, OK2)
+    print "not "
+OK2:say "ok 2"
+
+    $P0 = 2456347674
+    $P1 = 0
+    $P0 = $P0.'pow'($P1)
+    $N0 = $P0
+    .fp_eq($N0, 1, OK3)
+    print "not "
+OK3:say "ok 3"
+.end
+
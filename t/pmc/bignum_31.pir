@@ -0,0 +1,17 @@
+.sub _main :main
+    $P0 = new ['BigNum']
+    set $P0, "1000000000000000000000.123"
+    $P1 = new ['BigNum']
+    ## divide by a zero BigInt
+    $P2 = new ['BigInt']
+    set $P2, 0
+    push_eh OK
+    $P1 = $P0 % $P2
+    say "fail"
+    pop_eh
+OK:
+    get_results '0', $P0
+    $S0 = $P0
+    say "ok"
+    say $S0
+.end
@@ -0,0 +1,11 @@
+
+.sub _main :main
+    .local pmc pmc1
+    pmc1 = new ['BigNum']
+    .local int bool1
+    does bool1, pmc1, "scalar"
+    say bool1
+    does bool1, pmc1, "no_interface"
+    say bool1
+    end
+.end
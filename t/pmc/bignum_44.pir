@@ -0,0 +1,10 @@
+.sub main :main
+    .local pmc b
+    b = new ['BigNum']
+    b = 1e10
+    if b <= 4 goto nok
+    say "ok"
+    end
+nok:
+    say "nok"
+.end
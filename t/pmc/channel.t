@@ -0,0 +1,172 @@
+#!./parrot
+# Copyright (C) 2014, Parrot Foundation.
+
+=head1 NAME
+
+t/pmc/channel.t - Channel
+
+=head1 SYNOPSIS
+
+    % prove t/pmc/channel.t
+
+=head1 DESCRIPTION
+
+Tests the C<Channel> PMC, on one thread and between threads.
+
+=cut
+
+.sub main :main
+    .include 'test_more.pir'
+    plan(20)
+
+    test_create()               # 3 tests
+    test_values()               # 7 tests
+    test_frozen()               # 2 tests
+    test_try()                  # 5 tests
+    test_channel_in_channel()   # 1 test
+    test_threads()              # 2 tests
+.end
+
+.sub test_create
+    $P0 = new ['Channel']
+    $I0 = $P0.'capacity'()
+    is($I0, 1024, 'default capacity')
+
+    $P0 = new ['Channel'], 100
+    $I0 = $P0.'capacity'()
+    is($I0, 128, 'capacity is rounded up to a power of two')
+
+    push_eh bad_capacity
+    $P0 = new ['Channel'], 0
+    pop_eh
+    ok(0, 'capacity must be positive')
+    .return()
+  bad_capacity:
+    pop_eh
+    ok(1, 'capacity must be positive')
+.end
+
+.sub test_values
+    .local pmc ch
+    ch = new ['Channel']
+    push ch, 42
+    push ch, 1.5
+    push ch, 'constant'
+    $S0 = 'built'
+    $S0 .= ' string'
+    push ch, $S0
+    $P0 = box 7
+    push ch, $P0
+    is(ch, 5, 'elements counts waiting messages')
+
+    $I0 = shift ch
+    is($I0, 42, 'integer')
+    $N0 = shift ch
+    is($N0, 1.5, 'float')
+    $S1 = shift ch
+    is($S1, 'constant', 'constant string')
+    $S1 = shift ch
+    is($S1, 'built string', 'string')
+    $P1 = shift ch
+    $S1 = typeof $P1
+    is($S1, 'Integer', 'Integer PMC arrives as an Integer')
+    nok(ch, 'channel is empty')
+.end
+
+.sub test_frozen
+    .local pmc ch
+    ch = new ['Channel']
+    $P0 = new ['Hash']
+    $P0['a'] = 1
+    $P0['b'] = 'two'
+    ch.'send'($P0)
+    $P0['a'] = 100
+
+    $P1 = ch.'receive'()
+    $I0 = $P1['a']
+    is($I0, 1, 'frozen payload is a snapshot')
+    $S0 = $P1['b']
+    is($S0, 'two', 'frozen payload keeps its contents')
+.end
+
+.sub test_try
+    .local pmc ch
+    ch = new ['Channel'], 2
+    $I0 = ch.'try_send'(1)
+    $I1 = ch.'try_send'(2)
+    $I2 = ch.'try_send'(3)
+    $I0 += $I1
+    is($I0, 2, 'try_send succeeds while there is room')
+    is($I2, 0, 'try_send fails when the channel is full')
+
+    ($I0, $P0) = ch.'try_receive'()
+    is($P0, 1, 'try_receive returns the oldest message')
+    ($I0, $P0) = ch.'try_receive'()
+    ($I0, $P0) = ch.'try_receive'()
+    is($I0, 0, 'try_receive fails when the channel is empty')
+    $I0 = isnull $P0
+    ok($I0, 'and returns a null PMC')
+.end
+
+.sub test_channel_in_channel
+    .local pmc ch, reply
+    ch = new ['Channel']
+    reply = new ['Channel']
+    push ch, reply
+    $P0 = shift ch
+    push $P0, 'pong'
+    $S0 = shift reply
+    is($S0, 'pong', 'a channel sent through a channel shares its queue')
+.end
+
+.sub test_threads
+    .local pmc ch, results, task
+    ch = new ['Channel'], 16
+    results = new ['Channel'], 16
+
+    $P1 = get_global 'summer'
+    task = new ['Task']
+    setattribute task, 'code', $P1
+    setattribute task, 'data', ch
+    push task, results
+    schedule task
+
+    $I0 = 1
+  send:
+    push ch, $I0
+    inc $I0
+    if $I0 <= 10000 goto send
+    push ch, 'done'
+
+    $I1 = shift results
+    is($I1, 50005000, 'messages cross threads in order and without loss')
+    $S0 = shift results
+    is($S0, 'summed', 'strings cross threads')
+    wait task
+.end
+
+.sub summer
+    .param pmc ch
+    .local pmc interp, results
+    .local int sum
+    interp = getinterp
+    $P0 = interp.'current_task'()
+    results = pop $P0
+    sum = 0
+  receive:
+    $P0 = shift ch
+    $S0 = typeof $P0
+    if $S0 != 'Integer' goto done
+    $I0 = $P0
+    sum += $I0
+    goto receive
+  done:
+    push results, sum
+    push results, 'summed'
+.end
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
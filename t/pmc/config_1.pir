@@ -0,0 +1,9 @@
+.sub main :main
+    .include "iglobals.pasm"
+    .local pmc config_hash, interp
+    interp = getinterp
+    config_hash = interp[.IGLOBALS_CONFIG_HASH]
+    typeof $S0, config_hash
+    print $S0
+    print "\n"
+.end
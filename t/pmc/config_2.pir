@@ -0,0 +1,14 @@
+.sub main :main
+    load_bytecode "config.pbc"
+    .include "iglobals.pasm"
+    .local pmc config_hash, interp, cfg
+    interp = getinterp
+    config_hash = interp[.IGLOBALS_CONFIG_HASH]
+    $S0 = config_hash["prefix"]
+    cfg = _config()
+    $S1 = cfg['osname']
+    if $S1 != 'MSWin32' goto sayit
+    $S0 = downcase $S0
+  sayit:
+    print $S0
+.end
@@ -0,0 +1,6 @@
+.sub main :main
+    load_bytecode "config.pir"
+    print "ok 1\n"
+    load_bytecode "config.pbc"
+    print "ok 2\n"
+.end
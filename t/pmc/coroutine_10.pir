@@ -0,0 +1,13 @@
+
+.sub _main :main
+    .local pmc pmc1
+    pmc1 = new ['Coroutine']
+    .local int bool1
+    does bool1, pmc1, "invokable"
+    print bool1
+    print "\n"
+    does bool1, pmc1, "no_interface"
+    print bool1
+    print "\n"
+    end
+.end
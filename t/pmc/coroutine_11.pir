@@ -0,0 +1,34 @@
+
+.sub main :main
+    .local int z
+    .const 'Sub' corou = "_coroufn"
+    corou("from main")
+    z = 0
+  loop:
+    unless z < 4 goto end
+    met(corou)
+    inc z
+    goto loop
+  end:
+.end
+
+.sub met
+    .param pmc corou
+    corou()
+.end
+
+.sub _coroufn
+    .param string x
+    .local int j
+    print "coroutine: first call "
+    print x
+    print "\n"
+    j = 0
+  coroufn_1:
+    inc j
+    print "yield #"
+    print j
+    print "\n"
+    .yield()
+    goto coroufn_1
+.end
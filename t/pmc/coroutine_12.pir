@@ -0,0 +1,16 @@
+.sub 'main' :main
+    coro(1)
+    coro(2)
+    coro(3)
+.end
+.sub coro
+    .param int x
+    .local int y
+    y = 0
+  loop:
+    say x
+    .yield(x)
+    .param int y
+    x += y
+    if y >= 0 goto loop
+.end
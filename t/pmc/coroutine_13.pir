@@ -0,0 +1,14 @@
+.sub 'MyCoro'
+    .yield(1)
+    .yield(2)
+    .return(4)
+.end
+
+.sub 'main' :main
+    $I0 = MyCoro()
+    say $I0
+    $I0 = MyCoro()
+    say $I0
+    $I0 = MyCoro()
+    say $I0
+.end
@@ -0,0 +1,21 @@
+.sub 'MyCoro'
+    .yield(1)      # 2. ff y=1=>0
+    .yield(2)      # 4. ff y=1=>0
+    .return(4)     # 6. returncc !ff
+.end
+
+.sub 'main' :main
+    $I0 = MyCoro() # 1. setup first ctx
+    print $I0
+    $I0 = MyCoro() # 3. !ff y=>1
+    print $I0
+    $I0 = MyCoro() # 5. !ff y=>1
+    print $I0
+
+    push_eh ehandler
+    $I0 = MyCoro() # 7. ff (y=0) => Cannot resume dead coroutine
+    print $I0
+
+    ehandler:
+    pop_eh
+.end
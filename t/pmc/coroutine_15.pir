@@ -0,0 +1,37 @@
+.sub 'main' :main
+    .const 'Sub' $P99 = 'coro'
+
+    .local pmc three, four, five
+    three = clone $P99
+    four  = clone $P99
+    five  = clone $P99
+
+    three(3)
+    four(4)
+    five(5)
+
+    three(1)
+    push_eh ehandler
+    three(2)
+
+    restart:
+    four(1)
+
+    ehandler:
+    pop_eh
+    goto restart
+.end
+
+.sub '' :anon :subid('coro')
+    .param int x
+    print x
+    print '.0-'
+    .yield (x)
+
+    print x
+    print '.1-'
+    .yield (x)
+
+    print x
+    print '.done-'
+.end
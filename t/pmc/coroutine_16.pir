@@ -0,0 +1,18 @@
+.sub 'main' :main
+    .const 'Coroutine' $P99 = 'MyCoro'
+    $I0 = MyCoro()
+    say $I0
+    $I0 = MyCoro()
+    say $I0
+
+    $P99.'reset'()
+    $I0 = MyCoro()
+    say $I0
+    $I0 = MyCoro()
+    say $I0
+.end
+.sub 'MyCoro'
+    .yield(1)
+    .yield(2)
+    .return(3)
+.end
@@ -0,0 +1,17 @@
+.sub 'main' :main
+    .const 'Coroutine' $P99 = 'MyCoro'
+    $P99.'autoreset'()
+    $I0 = MyCoro()
+    say $I0
+    $I0 = MyCoro()
+    say $I0
+    $I0 = MyCoro()
+    say $I0
+    $I0 = MyCoro()
+    say $I0
+.end
+.sub 'MyCoro'
+    .yield(1)
+    .yield(2)
+    .return(3)
+.end
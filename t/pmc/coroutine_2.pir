@@ -0,0 +1,42 @@
+
+.sub __main__ :main
+    .local pmc return
+    .local pmc counter
+    .const 'Sub' itr = "_iterator"
+
+    .local pmc zero
+    zero = new ['Integer']
+    zero = 0
+
+    return = new ['Continuation']
+    set_label return, return_here
+    loop:
+        .begin_call
+            .call itr, return
+            .get_result counter
+        .end_call
+
+        print counter
+        print " "
+
+        zero = 0
+        print zero
+        print "\n"
+    goto loop
+return_here:
+    .get_results ()
+    end
+.end
+
+.sub _iterator
+    .local pmc x
+    x = new ['Integer']
+    x = 0
+    iloop:
+        .begin_yield
+        .set_yield x
+        .end_yield
+        x = x + 1
+    if x <= 10 goto iloop
+    returncc
+.end
@@ -0,0 +1,16 @@
+
+.sub main :main
+    .local pmc c
+    c = get_global "coro"
+    typeof $S0, c
+    print $S0
+.end
+.sub coro
+    .local pmc x
+    x = new ['Integer']
+    x = 0
+    iloop:
+        .yield (x)
+        x = x + 1
+    if x <= 4 goto iloop
+.end
@@ -0,0 +1,24 @@
+
+.sub main :main
+    .local pmc c
+    c = get_global "coro"
+loop:
+    .begin_call
+    .call c
+    .get_result   $P0 :optional
+    .get_result   $I0 :opt_flag
+    .end_call
+    unless $I0,  ex
+    print $P0
+    goto loop
+ex:
+.end
+.sub coro
+    .local pmc x
+    x = new ['Integer']
+    x = 0
+    iloop:
+        .yield (x)
+        x = x + 1
+    if x <= 4 goto iloop
+.end
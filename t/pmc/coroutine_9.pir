@@ -0,0 +1,17 @@
+.sub main :main
+    .local pmc c
+    c = get_global "coro"
+loop:
+    $P0 = c()
+    print $P0
+    goto loop
+.end
+.sub coro
+    .local pmc x
+    x = new ['Integer']
+    x = 0
+    iloop:
+        .yield (x)
+        x = x + 1
+    if x <= 4 goto iloop
+.end
@@ -0,0 +1,27 @@
+.sub main :main
+        $P0 = get_hll_global ['Foo'], 'load'
+        $P0()
+        $P0 = new ['Foo']
+        push_eh catch
+        $S0 = $P0
+        pop_eh
+        say "huh?"
+        .return()
+
+catch:
+        .get_results($P1)
+        say "caught"
+	finalize $P1
+        .return()
+.end
+
+.namespace ['Foo']
+
+.sub load
+    $P0 = newclass 'Foo'
+.end
+
+.sub get_string :vtable :method
+    $P0 = new ['Exception']
+    throw $P0
+.end
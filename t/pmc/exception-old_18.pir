@@ -0,0 +1,23 @@
+## This tests that error handlers are out of scope when invoked (necessary for
+## rethrow) when the error is signalled in another sub.
+.sub main :main
+    push_eh handler
+    broken()
+    print "not reached.\n"
+handler:
+    .local pmc exception
+    .get_results (exception)
+    $S0 = exception
+    print "in handler.\n"
+    print $S0
+    print "\n"
+    #rethrow exception
+.end
+
+.sub broken
+    $P0 = new ['Exception']
+    new $P2, ['String']
+    set $P2, "something broke"
+    setattribute $P0, "message", $P2
+    throw $P0
+.end
@@ -0,0 +1,52 @@
+## This test creates a continuation in a inner sub and re-invokes it later.  The
+## re-invocation signals an error, which is caught by an intermediate sub.
+## Returning from the "test" sub the second time failed in r28794; invoking
+## parrot with "-D80" shows clearly that the "test" context was being recycled
+## prematurely.  For some reason, it is necessary to signal the error in order
+## to expose the bug.
+## See also -O2 t/pmc/exception-old_19.pir regression [GH #1044]
+## cont = test() contains a push_eh, and the subsequent pop_eh at cont() changes
+## the value of the constant redux from 0 back to 1. So constant propagation for
+## redux=0 cannot delete "if redux goto done" and the done branch.
+.sub main :main
+    .local int redux
+    .local pmc cont
+    ## debug 0x80
+    redux = 0
+    print "calling test\n"
+    cont = test()
+    print "back from test\n"
+    if redux goto done
+    redux = 1
+    print "calling cont\n"
+    cont()
+    print "never.\n"
+done:
+    print "done.\n"
+.end
+.sub test
+    ## Push a handler around the foo() call.
+    push_eh handle_errs
+    print "  calling foo\n"
+    .local pmc cont
+    cont = foo()
+    print "  returning from test.\n"
+    .return (cont)
+handle_errs:
+    pop_eh
+    print "  test:  caught error\n"
+    .return (cont)
+.end
+.sub foo
+    ## Take a continuation.
+    .local pmc cont
+    cont = new ['Continuation']
+    set_label cont, over_there
+    print "    returning from foo\n"
+    .return (cont)
+over_there:
+    print "    got over there.\n"
+    .local pmc ex
+    ex = new ['Exception']
+    throw ex
+.end
@@ -0,0 +1,14 @@
+.sub main :main
+  .local pmc ex, exr
+  .local pmc msg, msgr
+  msg = new ['String']
+  msg = 'Message'
+  ex = new ['Exception'], msg
+  push_eh handler
+  throw ex
+  say 'Never here'
+handler:
+  .get_results(exr)
+  msgr = exr['message']
+  say msgr
+.end
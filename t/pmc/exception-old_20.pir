@@ -0,0 +1,16 @@
+.sub main :main
+    push_eh try
+    failure()
+    pop_eh
+    exit 0
+  try:
+    .get_results($P0)
+    pop_eh
+    $S1 = $P0['backtrace']
+    $S1 .= "\n"
+    say $S1
+.end
+
+.sub failure
+    die 'what'
+.end
@@ -0,0 +1,30 @@
+.sub main :main
+    $I0 = count_eh
+    if $I0 == 0 goto right_number1
+        print "not "
+    right_number1:
+    print "ok 1\n"
+    push_eh _handler1
+    push_eh _handler2
+    print "ok 2\n"
+    $I1 = count_eh
+    if $I1 == 2 goto right_number2
+        print "not "
+    right_number2:
+    print "ok 3\n"
+    pop_eh
+    pop_eh
+    print "ok 4\n"
+    $I2 = count_eh
+    if $I2 == 0 goto right_number3
+        print "not "
+    right_number3:
+    print "ok 5\n"
+    end
+_handler1:
+    print "first handler\n"
+    end
+_handler2:
+    print "second handler\n"
+    end
+.end
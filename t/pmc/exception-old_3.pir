@@ -0,0 +1,14 @@
+.sub main :main
+  .local pmc ex, exr
+  .local pmc h, msgr
+  h = new ['Hash']
+  h['message'] = 'Message'
+  ex = new ['Exception'], h
+  push_eh handler
+  throw ex
+  say 'Never here'
+handler:
+  .get_results(exr)
+  msgr = exr['message']
+  say msgr
+.end
@@ -0,0 +1,23 @@
+.sub main :main
+    print "main\n"
+    push_eh _handler
+    $P1 = new ['Exception']
+    $P2 = new ['String']
+    set $P2, "just pining"
+    setattribute $P1, 'message', $P2
+    throw $P1
+    print "not reached\n"
+    end
+_handler:
+    .local pmc e
+    .local string s
+    .get_results (e)
+    s = e
+    print "caught it\n"
+    typeof $S1, e
+    print $S1
+    print "\n"
+    print s
+    print "\n"
+    null $P5
+.end
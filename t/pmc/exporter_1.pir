@@ -0,0 +1,14 @@
+.sub 'test' :main
+    $P0 = new ['Exporter']
+    say "ok 1 - $P0 = new ['Exporter']"
+
+    # Most uses of export are short-lived, so use a explicit sweep
+    # here to ensure coverage of the mark vtable.
+    sweep 1
+
+    $I0 = isa $P0, 'Exporter'
+    if $I0 goto ok_2
+    print 'not '
+  ok_2:
+    say "ok 2 - isa $P0, 'Exporter'"
+.end
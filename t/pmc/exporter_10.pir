@@ -0,0 +1,12 @@
+.sub 'test' :main
+    load_bytecode 'Test/More.pbc'
+    .local pmc exporter, src
+
+    src      = get_namespace [ 'Test'; 'More' ]
+
+    exporter = new ['Exporter']
+    exporter.'source'( src )
+    exporter.'import'( 'plan ok' :named('globals') )
+    plan(1)
+    ok(1)
+.end
@@ -0,0 +1,14 @@
+.sub 'test' :main
+    load_bytecode 'Test/More.pbc'
+    .local pmc exporter, src, globals
+
+    src     = get_namespace [ 'Test'; 'More' ]
+    globals = new ['ResizableStringArray']
+    push globals, 'ok'
+    push globals, 'plan'
+
+    exporter = new ['Exporter']
+    exporter.'import'( src :named('source'), globals :named('globals') )
+    plan(1)
+    ok(1)
+.end
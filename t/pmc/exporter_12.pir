@@ -0,0 +1,15 @@
+.sub 'test' :main
+    load_bytecode 'Test/More.pbc'
+    .local pmc exporter, src, globals, nul
+
+    nul     = new ['Null']
+    src     = get_namespace [ 'Test'; 'More' ]
+    globals = new ['Hash']
+    globals['ok'] = nul
+    globals['plan'] = ''
+
+    exporter = new ['Exporter']
+    exporter.'import'( src :named('source'), globals :named('globals') )
+    plan(1)
+    ok(1)
+.end
@@ -0,0 +1,14 @@
+.sub 'test' :main
+    load_bytecode 'Test/More.pbc'
+    .local pmc exporter, src, globals
+
+    src     = get_namespace [ 'Test'; 'More' ]
+    globals = new ['Hash']
+    globals['plan'] = 'consilium'
+    globals['ok'] = 'rectus'
+
+    exporter = new ['Exporter']
+    exporter.'import'( src :named('source'), globals :named('globals') )
+    consilium(1)
+    rectus(1)
+.end
@@ -0,0 +1,22 @@
+.sub 'test' :main
+    load_bytecode 'Test/More.pbc'
+    .local pmc exporter, src, dest, globals
+
+    src     = get_namespace [ 'Test'; 'More' ]
+    dest    = get_namespace ['foo']
+    globals = new ['ResizableStringArray']
+    push globals, 'ok'
+    push globals, 'plan'
+
+    exporter = new ['Exporter']
+    exporter.'import'( src :named('source'), dest :named('destination'), globals :named('globals') )
+
+    $P0 = get_global ['foo'], 'bar'
+    $P0()
+.end
+
+.namespace ['foo']
+.sub 'bar'
+    plan(1)
+    ok(1)
+.end
@@ -0,0 +1,44 @@
+.sub 'test' :main
+    $P0 = new ['Exporter']
+    $P1 = $P0.'source'()
+    if null $P1 goto ok_1
+    print 'not '
+  ok_1:
+    say 'ok 1 - source() returns PMCNULL upon Exporter init'
+
+    # get a NameSpace PMC for testing
+    # GH #591 replace with make_namespace, when implemented
+    .local pmc ns
+    ns = get_namespace ['Eponymous']
+
+    $P0.'source'(ns)
+    $P1 = $P0.'source'()
+    if $P1 == 'Eponymous' goto ok_2
+    print 'not '
+  ok_2:
+    say 'ok 2 - source() with args sets source namespace'
+
+    $P1 = clone ns
+
+    push_eh ok_3
+    $P0.'source'(ns, $P1)
+    pop_eh
+
+    print 'not '
+  ok_3:
+    say 'ok 3 - source() with too many args fails'
+
+    push_eh ok_4
+    $P0.'source'('foo')
+    pop_eh
+    print 'not '
+
+  ok_4:
+    say 'ok 4 - source() with non-namespace arg throws exception'
+.end
+
+
+# GH #591 replace with make_namespace, when implemented
+.namespace ['Eponymous']
+.sub 'Eponymous' :anon
+.end
@@ -0,0 +1,50 @@
+.sub 'test' :main
+    $P0 = new ['Exporter']
+    $P1 = $P0.'destination'()
+    unless null $P1 goto ok_1
+    print 'not '
+  ok_1:
+    say 'ok 1 - destination() with no args returns destination namespace'
+
+    $P99 = get_namespace
+    if $P1 == $P99 goto ok_2
+    print 'not '
+  ok_2:
+    say 'ok 2 - ...which is current namespace at first'
+
+    # get a NameSpace PMC for testing
+    # GH #591 replace with make_namespace, when implemented
+    .local pmc ns
+    ns = get_namespace ['Eponymous']
+
+    $P0.'destination'(ns)
+    $P1 = $P0.'destination'()
+    if $P1 == 'Eponymous' goto ok_3
+    print 'not '
+  ok_3:
+    say 'ok 3 - destination() with args sets destination namespace'
+
+    $P1 = clone ns
+
+    push_eh ok_4
+    $P0.'destination'(ns, $P1)
+    pop_eh
+
+    print 'not '
+  ok_4:
+    say 'ok 4 - destination() with too many args fails'
+
+    push_eh ok_5
+    $P0.'destination'('foo')
+    pop_eh
+    print 'not '
+
+  ok_5:
+    say 'ok 5 - destination() with non-namespace arg throws exception'
+.end
+
+
+# GH #591 replace with make_namespace, when implemented
+.namespace ['Eponymous']
+.sub 'Eponymous' :anon
+.end
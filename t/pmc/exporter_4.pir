@@ -0,0 +1,16 @@
+.include 'except_types.pasm'
+.sub 'test' :main
+    $P0 = new ['Exporter']
+    $P1 = new ['Undef']
+    push_eh catch
+    $P2 = $P0.'globals'($P1)
+    say 'not thrown'
+    goto end
+  catch:
+    .get_results($P3)
+    $I0 = $P3['type']
+    $I1 = iseq $I0, .EXCEPTION_INVALID_OPERATION
+    print 'Exception type is as expected: '
+    say $I1
+  end:
+.end
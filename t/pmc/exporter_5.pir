@@ -0,0 +1,91 @@
+.sub 'test' :main
+    $P0 = new ['Exporter']
+
+    $P1 = $P0.'globals'()
+    $I0 = isnull $P1
+    if $I0 goto ok_1
+    print 'not '
+  ok_1:
+    say 'ok 1 - globals() returns PMCNULL upon Exporter init'
+
+    # create an array to store globals in
+    $P99 = new ['ResizableStringArray']
+
+    $P0.'globals'($P99)
+    $P1 = $P0.'globals'()
+    $I0 = isnull $P1
+    if $I0 goto ok_2
+    print 'not '
+  ok_2:
+    say 'ok 2 - globals() with empty array arg sets PMCNULL'
+
+    push $P99, 'Alex'
+    push $P99, 'Prince'
+
+    $P0.'globals'($P99)
+    $P1 = $P0.'globals'()
+    $I0 = does $P1, 'hash'
+    $I99 = $P99
+    $I1 = $P1
+    unless $I0 == 1 goto nok_3
+    unless $I1 == $I99 goto nok_3
+    unless $I1 == 2 goto ok_3
+    $I0 = exists $P1['Prince']
+    unless $I0 goto nok_3
+    $I0 = exists $P1['Alex']
+    goto ok_3
+  nok_3:
+    print 'not '
+  ok_3:
+    say 'ok 3 - globals() with array arg sets globals hash (hash with two keys)'
+
+    # create a hash to store globals in
+    $P99 = new ['Hash']
+
+    $P0.'globals'($P99)
+    $P1 = $P0.'globals'()
+    $I0 = isnull $P1
+    if $I0 goto ok_4
+    print 'not '
+  ok_4:
+    say 'ok 4 - globals() with empty hash arg sets PMCNULL'
+
+    $P99['Prince'] = ''
+    $P99['Alex'] = ''
+
+    $P0.'globals'($P99)
+    $P1 = $P0.'globals'()
+    $I99 = $P99
+    $I1 = $P1
+    unless $I1 == $I99 goto nok_5
+    unless $I1 == 2 goto nok_5
+    $I0 = exists $P1['Prince']
+    unless $I0 goto nok_5
+    $I0 = exists $P1['Alex']
+    unless $I0 goto nok_5
+    goto ok_5
+  nok_5:
+    print 'not '
+  ok_5:
+    say 'ok 5 - globals() with hash arg sets globals hash (hash with two keys)'
+
+
+    $P98 = clone $P99
+
+    push_eh ok_6
+    $P0.'globals'($P99, $P98)
+    pop_eh
+
+    print 'not '
+  ok_6:
+    say 'ok 6 - globals() with too many args fails'
+
+    null $P99
+    $P0.'globals'($P99)
+    $P1 = $P0.'globals'()
+    $I0 = isnull $P1
+    mul $I0, 7
+    print 'ok '
+    print $I0
+    say ' - globals() with null arg sets null'
+.end
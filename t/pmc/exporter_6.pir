@@ -0,0 +1,7 @@
+.sub 'test' :main
+    $P0 = new ['Exporter']
+
+    $P0.'import'()
+    say 'ok 1 - import() with no args throws an exception'
+
+.end
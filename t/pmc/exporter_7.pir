@@ -0,0 +1,19 @@
+.include 'except_types.pasm'
+.sub 'test' :main
+    load_bytecode 'Test/More.pbc'
+    .local pmc exporter, src, dest, excep
+    exporter = new ['Exporter']
+    src = get_namespace [ 'Test'; 'More' ]
+    null dest
+    push_eh catch
+    exporter.'import'(src :named('source'), dest :named('destination'), 'plan ok' :named('globals') )
+    say 'not thrown'
+    goto end
+  catch:
+    .get_results(excep)
+    $I0 = excep['type']
+    $I1 = iseq $I0, .EXCEPTION_INVALID_OPERATION
+    print 'Exception type is as expected: '
+    say $I1
+  end:
+.end
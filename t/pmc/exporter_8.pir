@@ -0,0 +1,20 @@
+.sub 'test' :main
+    .local pmc exporter, src
+
+    src      = get_namespace
+
+    exporter = new ['Exporter']
+    exporter.'import'( src :named('source'), src :named('destination'), 'plan ok' :named('globals') )
+    plan(1)
+    ok(1)
+.end
+
+.sub 'plan'
+    .param int one
+    say '1..1'
+.end
+
+.sub 'ok'
+    .param int one
+    say 'ok 1'
+.end
@@ -0,0 +1,11 @@
+.sub 'test' :main
+    load_bytecode 'Test/More.pbc'
+    .local pmc exporter, src
+
+    src      = get_namespace [ 'Test'; 'More' ]
+
+    exporter = new ['Exporter']
+    exporter.'import'( src :named('source'), 'plan ok' :named('globals') )
+    plan(1)
+    ok(1)
+.end
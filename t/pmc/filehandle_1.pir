@@ -0,0 +1,4 @@
+.sub 'test' :main
+    $P0 = new ['FileHandle']
+    say "ok 1 - $P0 = new ['FileHandle']"
+.end
@@ -0,0 +1,39 @@
+.sub 'test' :main
+    load_bytecode 'String/Utils.pbc'
+    .local pmc chomp
+               chomp = get_global ['String';'Utils'], 'chomp'
+    .local string test_line
+    .local pmc filehandle
+    .local int counter
+    filehandle = new ['FileHandle']
+    filehandle.'open'('/tmp/SqjErccdXE')
+
+    counter = 0
+  read_loop:
+    inc counter
+    # read in the file one line at a time...
+    $I0 = filehandle.'eof'()
+    if $I0 goto end_read_loop
+
+    test_line = filehandle.'readline'()
+    if test_line == "" goto end_read_loop
+    test_line = chomp( test_line )
+    $I1 = test_line
+    if $I1 == counter goto read_loop
+      print "not "
+## the following lines provide more extensive debugging
+## output on a readline failure
+#      print counter
+#      print " = "
+#      print $I1
+#      print "\n"
+#      counter = $I1
+#      goto read_loop
+
+  end_read_loop:
+    if counter > 1 goto read_something
+      print "not "
+  read_something:
+    say 'ok 1 - read 10,000 lines'
+    filehandle.'close'()
+.end
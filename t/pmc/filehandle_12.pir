@@ -0,0 +1,24 @@
+.sub 'test' :main
+    $P0 = new ['FileHandle']
+
+    $S99 = 'abc'
+    $P0.'record_separator'($S99)
+    $S0 = $P0.'record_separator'()
+    if $S0 == $S99 goto ok_2
+    print 'not '
+  ok_2:
+    say 'ok 1 - $P0.record_separator("abc")'
+
+    $P0.'open'('/tmp/SqjErccdXE', 'rw')
+    $P0.'print'(123)
+    $S0 = $P0.'record_separator'()
+    $P0.'print'($S0)
+    $P0.'print'(456)
+
+    $P0.'seek'(0, 0)
+    $S0 = $P0.'readline'()
+    if $S0 == '123abc' goto ok_3
+    print 'not '
+  ok_3:
+    say 'ok 2 - $P0.record_separator() # .readline works as expected'
+.end
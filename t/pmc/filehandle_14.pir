@@ -0,0 +1,35 @@
+.sub 'test' :main
+    $P0 = new ['FileHandle']
+
+    $P0.'buffer_type'('full-buffered')
+    $P0.'buffer_size'(42)
+    say 'ok 1 - $P0.buffer_size(42)     # set buffer size'
+
+    $I0 = $P0.'buffer_size'()
+
+    # The set buffer size is a minimum, the I/O subsystem may scale it upward
+    # to a round block, so test that the buffer size is equal or greater than
+    # the set size.
+    if $I0 >= 42 goto ok_2
+    print 'not '
+  ok_2:
+    say 'ok 2 - $I0 = $P0.buffer_size() # get buffer size'
+
+    $P0.'open'('/tmp/D3OHPQO0_t', 'w')
+
+    $P0.'print'(1234567890)
+    $P0.'close'()
+
+    $P1 = new ['FileHandle']
+    $P1.'open'('/tmp/D3OHPQO0_t')
+
+    $S0 = $P1.'readline'()
+
+    if $S0 == '1234567890' goto ok_3
+    print 'not '
+  ok_3:
+    say 'ok 3 - $S0 = $P0.readline()    # buffer flushed'
+
+    $P1.'close'()
+
+.end
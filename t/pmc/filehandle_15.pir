@@ -0,0 +1,11 @@
+.sub 'test' :main
+    $P0 = new ['FileHandle']
+
+    $P0.'encoding'('utf8')
+    $S0 = $P0.'encoding'()
+    if $S0 == 'utf8' goto ok_1
+    print 'not '
+  ok_1:
+    say 'ok 1 - $S0 = $P1.encoding() # utf8'
+
+.end
@@ -0,0 +1,43 @@
+.sub 'test' :main
+    $P0 = new ['FileHandle']
+    $P0.'encoding'('utf8')
+
+    $P0.'open'('/tmp/HqT5ZUXM3k', 'w')
+
+    $P0.'print'(1234567890)
+    $P0.'print'("\n")
+    $S0 = iso-8859-1:"TÖTSCH"
+    $P0.'print'($S0)
+    $P0.'close'()
+
+    $P1 = new ['FileHandle']
+    $P1.'encoding'('utf8')
+
+    $P1.'open'('/tmp/HqT5ZUXM3k')
+
+    .local string line
+    line = $P1.'readline'()
+    if line == "1234567890\n" goto ok_1
+print line
+    print 'not '
+  ok_1:
+    say 'ok 1 - $S1 = $P1.readline() # read with utf8 encoding on'
+
+    line = $P1.'readline'()
+    if line == $S0 goto ok_2
+print line
+    print 'not '
+  ok_2:
+    say 'ok 2 - $S2 = $P1.readline() # read iso-8859-1 string'
+
+    $P1.'close'()
+
+    $I1 = encoding line
+    $S2 = encodingname $I1
+    if $S2 == 'utf8' goto ok_3
+    print $S2
+    print 'not '
+  ok_3:
+    say 'ok 3 # utf8 encoding'
+
+.end
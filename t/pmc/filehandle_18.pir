@@ -0,0 +1,21 @@
+.sub main :main
+    .local pmc fh,fh_clone
+    .local string line1, line2
+
+    fh = new ['FileHandle']
+    fh.'open'('README.pod')
+
+    line1 = fh.'readline'()
+
+    fh_clone = clone fh
+    line2 = fh_clone.'readline'()
+
+    $I0 = line1 == line2
+    say $I0
+
+    fh_clone.'seek'(0, 0)
+    line2 = fh_clone.'readline'()
+
+    $I0 = line1 == line2
+    say $I0
+.end
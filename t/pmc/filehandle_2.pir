@@ -0,0 +1,55 @@
+.sub 'test' :main
+    .local int i
+    $P1 = new ['FileHandle']
+    $P1.'open'('README.pod')
+    say 'ok 1 - $P1.open($S1)'
+
+    $P1.'close'()
+    say 'ok 2 - $P1.close()'
+
+    $P3 = new ['FileHandle']
+    $P3.'open'('/tmp/G39mAabm4E', 'rw')
+    say 'ok 3 - $P3.open($S1, $S2) # rw mode'
+    $P3.'close'()
+
+    $P3.'open'()
+    say 'ok 4 - $P3.open()         # reopening'
+    $P3.'close'()
+
+  test_5:
+    $P5 = new ['FileHandle']
+    push_eh eh_bad_file_1
+    $P5.'open'('bad.file')
+    pop_eh
+
+  test_6:
+    $P6 = new ['FileHandle']
+    push_eh eh_bad_file_2
+    $P6.'open'('bad.file', 'r')
+    pop_eh
+
+  test_7:
+    $P7 = new ['FileHandle']
+    $P7.'open'('/tmp/G39mAabm4E', 'w')
+    say 'ok 7 - $P7.open($S1, $S2) # new file, write mode succeeds'
+
+    i = $P7.'is_closed'()
+    print 'is_closed: '
+    say i
+    $P7.'close'()
+    i = $P7.'is_closed'()
+    print 'is_closed after close: '
+    say i
+
+    goto end
+
+  eh_bad_file_1:
+    say 'ok 5 - $P5.open($S1)      # with bad file'
+    goto test_6
+
+  eh_bad_file_2:
+    say "ok 6 - $P6.open($S1, $S2) # with bad file"
+    goto test_7
+
+  end:
+.end
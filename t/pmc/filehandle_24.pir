@@ -0,0 +1,13 @@
+.sub 'main' :main
+    .local pmc ifh
+    ifh = new ['FileHandle']
+    ifh.'encoding'('utf8')
+    ifh.'open'('/tmp/A9eEIZhlYd')
+
+    $S0 = ifh.'readall'()
+
+    $I0 = encoding $S0
+    $S1 = encodingname $I0
+
+    say $S1
+.end
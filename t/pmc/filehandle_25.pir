@@ -0,0 +1,40 @@
+.include 'iglobals.pasm'
+.sub 'main' :main
+    .local pmc pipe, conf, interp
+    .local string cmd
+
+    interp = getinterp
+    conf = interp[.IGLOBALS_CONFIG_HASH]
+
+    cmd = '"'
+
+    .local string aux
+    aux = conf['build_dir']
+    cmd .= aux
+    aux = conf['slash']
+    cmd .= aux
+    aux = conf['test_prog']
+    cmd .= aux
+    aux = conf['exe']
+    cmd .= aux
+    cmd .= '"'
+
+    pipe = new ['FileHandle']
+    pipe.'open'(cmd, "rp")
+    pipe.'readall'()
+    pipe.'close'()
+    print "expect 0 exit status: "
+    $I0 = pipe.'exit_status'()
+    say $I0
+
+    cmd .= ' --this_is_not_a_valid_option'
+    pipe = new ['FileHandle']
+    pipe.'open'(cmd, "rp")
+    pipe.'readall'()
+    pipe.'close'()
+    print "expect 1 exit status: "
+    $I0 = pipe.'exit_status'()
+    $I0 = $I0 != 0
+    say $I0
+
+.end
@@ -0,0 +1,5 @@
+.sub test :main
+    new $P0, ['FileHandle']
+    $N0 = $P0.'get_fd'()
+    say $N0
+.end
@@ -0,0 +1,23 @@
+.sub test :main
+    .local pmc fh
+    .local string str
+    .local int pos
+
+    fh = new 'FileHandle'
+    fh.'open'('/tmp/A9eEIZhlYd', 'rw')
+
+    fh.'print'('abcdefghijklmno')
+    fh.'seek'(0, 0)
+
+    fh.'read'(5)
+    fh.'print'('#####')
+
+    pos = fh.'tell'()
+    say pos
+
+    fh.'seek'(0, 0)
+    str = fh.'readall'()
+    say str
+
+    fh.'close'()
+.end
@@ -0,0 +1,55 @@
+.include 'except_types.pasm'
+
+.sub main :main
+    .local pmc fh, eh
+    .local int i
+    i = 1
+    eh = new['ExceptionHandler']
+    eh = .EXCEPTION_PIO_ERROR
+    set_label eh, catchnoname
+    push_eh eh
+    fh = new['FileHandle']
+    # Open without filename
+    fh.'open'()
+    i = 0
+    goto reportnoname
+  catchnoname:
+    finalize eh
+  reportnoname:
+    say i
+
+    i = 0
+    set_label eh, catchreopen
+    fh.'open'('README.pod')
+    i = 1
+    # Open already opened
+    fh.'open'('README.pod')
+    i = 0
+    goto reportreopen
+  catchreopen:
+    finalize eh
+  reportreopen:
+    say i
+
+    i = 0
+    set_label eh, catchother
+    fh.'open'('noREADME.pod')
+    goto reportother
+  catchother:
+    i = 1
+    finalize eh
+  reportother:
+    say i
+
+    i = 0
+    set_label eh, catchdir
+    fh.'open'('t')
+    goto reportdir
+  catchdir:
+    i = 1
+    finalize eh
+  reportdir:
+    say i
+
+    pop_eh
+.end
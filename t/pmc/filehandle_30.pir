@@ -0,0 +1,43 @@
+.sub test :main
+    .local pmc fh
+    .local string str
+    .local int pos, i
+
+    fh = new 'FileHandle'
+    fh.'open'('/tmp/A9eEIZhlYd', 'rw')
+
+    i = 0
+  print_loop:
+    fh.'print'('abc123')
+    inc i
+    if i < 5000 goto print_loop
+
+    fh.'seek'(1, -24000)
+
+    i = 0
+  read_loop:
+    str = fh.'read'(3)
+    if str == 'abc' goto read_ok
+    print 'not '
+    goto read_done
+  read_ok:
+    fh.'seek'(1, 3)
+    inc i
+    if i < 4000 goto read_loop
+  read_done:
+    say 'ok 1 - read/seek 3 bytes'
+
+    str = fh.'read'(3)
+    if str == '' goto eof_ok
+    print 'not '
+  eof_ok:
+    say 'ok 2 - read/seek eof'
+
+    pos = fh.'tell'()
+    if pos == 30000 goto tell_ok
+    print 'not '
+  tell_ok:
+    say 'ok 3 - read/seek tell'
+
+    fh.'close'()
+.end
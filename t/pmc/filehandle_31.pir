@@ -0,0 +1,61 @@
+.sub test :main
+    .local pmc fh
+    .local string str, line
+    .local int pos, i
+
+    fh = new 'FileHandle'
+    fh.'open'('/tmp/A9eEIZhlYd', 'rw')
+
+    # set a buffer size of 6000 and utf8 encoding
+    fh.'buffer_size'(6000)
+    fh.'encoding'('utf8')
+
+    # write 599 lines, 5990 bytes
+    i = 0
+  print_loop:
+    fh.'print'("123456789\n")
+    inc i
+    if i < 599 goto print_loop
+
+    # now write a final line with a utf8 character that will be split
+    # across buffers
+    line = utf8:"123456789\x{2022}"
+    fh.'print'(line)
+
+    str = read_600_lines(fh)
+    i = iseq str, line
+    say i
+
+    str = fh.'readline'()
+    i = length str
+    say i
+
+    # test it again with a different setting
+
+    fh.'seek'(1, -12)
+    line = utf8:"12345678\x{2022}#############\n"
+    fh.'print'(line)
+    fh.'print'("####\n###########\n")
+
+    str = read_600_lines(fh)
+    i = iseq str, line
+    say i
+
+    fh.'close'()
+.end
+
+.sub read_600_lines
+    .param pmc fh
+    .local int i
+    .local string str
+
+    fh.'seek'(0, 0)
+
+    i = 0
+  read_loop:
+    str = fh.'readline'()
+    inc i
+    if i < 600 goto read_loop
+
+    .return (str)
+.end
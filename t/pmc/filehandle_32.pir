@@ -0,0 +1,10 @@
+.const string temp_file = '%s'
+.sub main :main
+    $P0 = getinterp
+    $P1 = $P0.'stdout_handle'()
+
+    $P2 = new ['ByteBuffer']
+    $P2 = "This is a test"
+    $P1.'write_bytes'($P2, 9)
+.end
+
@@ -0,0 +1,10 @@
+.const string temp_file = '%s'
+.sub main :main
+    $P0 = new ['FileHandle']
+    $P0.'open'('README.pod')
+
+    $P1 = $P0.'read_bytes'(15) # bytes
+    $S0 = $P1.'get_string_as'('ascii')
+    say $S0
+.end
+
@@ -0,0 +1,8 @@
+.sub main :main
+    $P0 = new ['FileHandle']
+    $P0.'open'('README.pod')
+    $P0.'readline'()
+    $S0 = $P0.'readall'()
+    $I0 = index $S0, "\0"
+    say $I0
+.end
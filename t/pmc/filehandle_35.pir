@@ -0,0 +1,7 @@
+.sub main :main
+    $P0 = new ['Env']
+    $P0['AAAA'] = 'ZZZZZZ'
+    $P1 = new ['FileHandle']
+    $P1.'open'("echo $AAAA", "wp")
+    $P1.'close'()
+.end
@@ -0,0 +1,12 @@
+.sub 'test' :main
+    .local pmc fh
+    .local int i
+    fh = new ['FileHandle']
+    i = fh.'isatty'()
+    print i
+    say ' unopened FileHandle is not a tty'
+    fh.'open'('README.pod')
+    i = fh.'isatty'()
+    print i
+    say ' regular file is not a tty'
+.end
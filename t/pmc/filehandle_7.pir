@@ -0,0 +1,21 @@
+.sub 'test' :main
+    .local pmc fh, bb
+
+    fh = new ['FileHandle']
+    fh.'open'('README.pod')
+
+    bb = fh.'read_bytes'(15)
+    $S0 = bb.'get_string'('ascii')
+    if $S0 == '# Copyright (C)' goto ok_1
+    print 'not '
+  ok_1:
+    say 'ok 1 - read_bytes'
+
+    bb = fh.'read_bytes'(12)  # throw away bytes
+    bb = fh.'read_bytes'(17)  # bytes
+    $S0 = bb.'get_string'('utf8')
+    if $S0 == 'Parrot Foundation' goto ok_2
+    print 'not '
+  ok_2:
+    say 'ok 2 - read_bytes # again on same stream'
+.end
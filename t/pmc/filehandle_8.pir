@@ -0,0 +1,37 @@
+.sub 'test' :main
+
+    $P0 = new ['FileHandle']
+    $P0.'open'('/tmp/G39mAabm4E', 'w')
+
+    $P0.'print'(123)
+    say 'ok 1 - $P0.print($I1)'
+    $P0.'print'(456.789)
+    say 'ok 2 - $P0.print($N1)'
+    $P0.'print'("squawk\n")
+    say 'ok 3 - $P0.print($S1)'
+    $P1 = new ['Integer']
+    $P1 = 42
+    $P0.'print'($P1)
+    say 'ok 4 - $P0.print($P1)'
+
+    $P0.'close'()
+
+    $P1 = new ['FileHandle']
+    $P1.'open'('/tmp/G39mAabm4E', 'r')
+
+    $S0 = $P1.'read'(3) # bytes
+    if $S0 == "123" goto ok_5
+    print 'not '
+  ok_5:
+    say 'ok 5 - read integer back from file'
+
+    $S0 = $P1.'read'(16) # bytes
+    if $S0 == "456.789squawk\n42" goto ok_6
+    say $S0
+
+    print 'not '
+  ok_6:
+    say 'ok 6 - read string back from file'
+
+    $P1.'close'()
+.end
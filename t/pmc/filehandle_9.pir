@@ -0,0 +1,29 @@
+.sub 'test' :main
+    load_bytecode 'String/Utils.pbc'
+    .local pmc chomp
+               chomp = get_global ['String';'Utils'], 'chomp'
+
+    $P0 = new ['FileHandle']
+    $P0.'open'('/tmp/Kl96AeIhK0', 'w')
+    $P0.'print'("foobarbaz\n42")
+    $P0.'close'()
+
+    $P1 = new ['FileHandle']
+    $P1.'open'('/tmp/Kl96AeIhK0')
+
+    $S0 = $P1.'readline'()
+    $S0 = chomp( $S0 )
+    if $S0 == 'foobarbaz' goto ok_1
+    print 'not '
+  ok_1:
+    say 'ok 1 - $S0 = $P1.readline()'
+
+    $S0 = $P1.'readline'()
+    $S0 = chomp( $S0 )
+    if $S0 == '42' goto ok_2
+    print 'not '
+  ok_2:
+    say 'ok 2 - $S0 = $P1.readline() # again on same stream'
+
+    $P1.'close'()
+.end
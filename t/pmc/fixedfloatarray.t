@@ -19,7 +19,7 @@ out-of-bounds test. Checks INT and PMC keys.
 .sub main :main
     .include 'fp_equality.pasm'
     .include 'test_more.pir'
-    plan(36)
+    plan(43)
 
     array_size_tests()
     element_set_tests()
@@ -33,6 +33,7 @@ out-of-bounds test. Checks INT and PMC keys.
     test_invalid_init_tt1509()
     test_get_string()
     test_sort()
+    test_parallel()
 .end
 
 .sub test_sort
@@ -50,6 +51,49 @@ out-of-bounds test. Checks INT and PMC keys.
     is($I2,5,'sort works')
     $I3 = $P0[3]
     is($I3,10,'sort works')
+
+    $P1 = get_global 'reverse_cmp'
+    $P0.'sort'($P1)
+    $S0 = join ' ', $P0
+    is($S0, '10 5 3 1', 'sort with a cmp function')
+
+    $P0[0] = -4.5
+    $P0[1] = 2.5
+    $P0[2] = -1.5
+    $P0[3] = 3.5
+    $P1 = get_global 'absolute'
+    $P0.'sort'('key' => $P1)
+    $S0 = join ' ', $P0
+    is($S0, '-1.5 2.5 3.5 -4.5', 'sort by key')
+
+    $P0[0] = 1.5
+    $P0[1] = -2.5
+    $P0[2] = 1.25
+    $P0[3] = 0.5
+    $P1 = get_global 'int_part'
+    $P0.'sort'('key' => $P1)
+    $S0 = join ' ', $P0
+    is($S0, '-2.5 1.5 1.25 0.5', 'sort by integer key is stable')
+.end
+
+.sub reverse_cmp
+    .param num a
+    .param num b
+    $I0 = cmp b, a
+    .return ($I0)
+.end
+
+.sub absolute
+    .param num a
+    $N0 = abs a
+    .return ($N0)
+.end
+
+.sub int_part
+    .param num a
+    $I0 = a
+    $I0 = $I0 / 2
+    .return ($I0)
 .end
 
 .sub array_size_tests
@@ -302,6 +346,48 @@ CODE
     is($S0, '[ -1.5, 0, 3.14 ]', 'has string representation')
 .end
 
+.sub test_parallel
+    .local pmc array
+    .local int i
+    array = new ['FixedFloatArray'], 4000
+    i = 0
+  fill:
+    $I0 = i * 2003
+    $I0 %= 4000
+    $N0 = $I0
+    $N0 /= 4
+    array[i] = $N0
+    inc i
+    if i < 4000 goto fill
+
+    $P0 = get_global 'halve'
+    array.'parallel_map'($P0)
+    $P0 = get_global 'add'
+    $N0 = array.'parallel_reduce'($P0)
+    is($N0, 999750.0, 'parallel_map and parallel_reduce')
+    $N0 = array.'parallel_reduce'($P0, 0.5)
+    is($N0, 999750.5, 'parallel_reduce with an initial value')
+
+    array.'parallel_sort'()
+    $N0 = array[1]
+    $N1 = array[3999]
+    is($N0, 0.125, 'parallel_sort, second element')
+    is($N1, 499.875, 'parallel_sort, last element')
+.end
+
+.sub halve
+    .param num n
+    n /= 2
+    .return (n)
+.end
+
+.sub add
+    .param num a
+    .param num b
+    $N0 = a + b
+    .return ($N0)
+.end
+
 # Local Variables:
 #   mode: pir
 #   fill-column: 100
@@ -34,6 +34,14 @@ out-of-bounds test. Checks INT and PMC keys.
     test_new_style_init()
     test_invalid_init_tt1509()
     test_custom_cmp()
+    test_sort_key()
+    test_sort_runs()
+    test_sort_escaping_cmp()
+    test_parallel_map()
+    test_parallel_reduce()
+    test_parallel_sort()
+    test_parallel_error()
+    test_parallel_invokables()
 
     done_testing()
 .end
@@ -326,7 +334,349 @@ CODE
     .return ($I0)
 .end
 
+.sub test_sort_key
+    .local pmc array, key
+    array = new ['FixedIntegerArray'], 8
+    array[0] = 5
+    array[1] = 3
+    array[2] = 9
+    array[3] = 4
+    array[4] = 0
+    array[5] = 7
+    array[6] = 6
+    array[7] = 1
+    key = get_global 'mod3'
+    array.'sort'('key' => key)
+    $S0 = join ' ', array
+    is($S0, '3 9 0 6 4 7 1 5', 'sort by key keeps equal keys in order')
+
+    $P0 = get_global 'reverse_cmp'
+    array.'sort'($P0, 'key' => key)
+    $S0 = join ' ', array
+    is($S0, '5 4 7 1 3 9 0 6', 'sort by key with a cmp function on the keys')
+.end
+
+.sub mod3
+    .param int i
+    $I0 = mod i, 3
+    .return ($I0)
+.end
+
+.sub reverse_cmp
+    .param int a
+    .param int b
+    $I0 = cmp b, a
+    .return ($I0)
+.end
+
+.sub test_sort_runs
+    .local pmc array, cmp_fun, count
+    .local int i, prev, sorted
+    array = new ['FixedIntegerArray'], 1000
+    i = 0
+  fill:
+    $I0 = 1000 - i
+    array[i] = $I0
+    inc i
+    if i < 1000 goto fill
+
+    count = new ['Integer']
+    set_global 'compares', count
+    cmp_fun = get_global 'counting_cmp'
+    array.'sort'(cmp_fun)
+
+    sorted = 1
+    prev = array[0]
+    i = 1
+  check:
+    $I0 = array[i]
+    if $I0 > prev goto next
+    sorted = 0
+  next:
+    prev = $I0
+    inc i
+    if i < 1000 goto check
+    ok(sorted, 'sort reversed input with a cmp function')
+
+    $I0 = count
+    $I1 = islt $I0, 1000
+    ok($I1, 'sorting a reversed run takes one comparison per element')
+.end
+
+.sub counting_cmp
+    .param int a
+    .param int b
+    $P0 = get_global 'compares'
+    inc $P0
+    $I0 = cmp a, b
+    .return ($I0)
+.end
+
+.sub test_sort_escaping_cmp
+    .local pmc array, seen
+    array = new ['FixedIntegerArray'], 6
+    array[0] = 4
+    array[1] = 1
+    array[2] = 5
+    array[3] = 2
+    array[4] = 6
+    array[5] = 3
+
+    seen = new ['ResizablePMCArray']
+    set_global 'seen', seen
+    $P0 = get_global 'capturing_cmp'
+    array.'sort'($P0)
+    $S0 = join ' ', array
+    is($S0, '1 2 3 4 5 6', 'sort with a cmp function capturing its continuation')
+
+    .local int i, n, shared
+    n = elements seen
+    shared = 0
+    i = 1
+  next_cont:
+    if i >= n goto conts_done
+    $P1 = seen[i]
+    $I0 = i - 1
+    $P2 = seen[$I0]
+    $I0 = issame $P1, $P2
+    shared += $I0
+    inc i
+    goto next_cont
+  conts_done:
+    is(shared, 0, '... gets a new return continuation for every call')
+
+    seen = new ['ResizableIntegerArray']
+    set_global 'seen', seen
+    $P0 = get_global 'handler_cmp'
+    array.'sort'($P0)
+    $S0 = join ' ', array
+    is($S0, '6 5 4 3 2 1', 'sort with a cmp function leaving a handler installed')
+    $S0 = join ' ', seen
+    $S0 = substr $S0, 0, 5
+    is($S0, '0 0 0', '... starts every call without handlers')
+.end
+
+.sub capturing_cmp
+    .param int a
+    .param int b
+    .include 'interpinfo.pasm'
+    $P0 = interpinfo .INTERPINFO_CURRENT_CONT
+    $P1 = get_global 'seen'
+    push $P1, $P0
+    $I0 = cmp a, b
+    .return ($I0)
+.end
+
+.sub handler_cmp
+    .param int a
+    .param int b
+    $P1 = get_global 'seen'
+    $I0 = count_eh
+    push $P1, $I0
+    push_eh never
+    $I0 = cmp b, a
+    .return ($I0)
+  never:
+    .return (0)
+.end
+
+.sub fill_parallel
+    .param int n
+    .local pmc array
+    array = new ['FixedIntegerArray'], n
+    $I0 = 0
+  loop:
+    array[$I0] = $I0
+    inc $I0
+    if $I0 < n goto loop
+    .return (array)
+.end
+
+.sub test_parallel_map
+    .local pmc array
+    array = fill_parallel(5000)
+    $P0 = get_global 'double'
+    $P1 = array.'parallel_map'($P0)
+    $I0 = issame array, $P1
+    ok($I0, 'parallel_map returns the array')
+    $I0 = array[0]
+    $I1 = array[2500]
+    $I2 = array[4999]
+    is($I0, 0, 'parallel_map first element')
+    is($I1, 5000, 'parallel_map middle element')
+    is($I2, 9998, 'parallel_map last element')
+
+    array = fill_parallel(10)
+    array.'parallel_map'($P0)
+    $S0 = join ' ', array
+    is($S0, '0 2 4 6 8 10 12 14 16 18', 'parallel_map on a small array')
+.end
+
+.sub double
+    .param int i
+    i *= 2
+    .return (i)
+.end
+
+.sub test_parallel_reduce
+    .local pmc array, add
+    add = get_global 'add'
+    array = fill_parallel(5000)
+    $I0 = array.'parallel_reduce'(add)
+    is($I0, 12497500, 'parallel_reduce')
+    $I0 = array.'parallel_reduce'(add, 1000)
+    is($I0, 12498500, 'parallel_reduce with an initial value')
+
+    array = new ['FixedIntegerArray']
+    $I0 = array.'parallel_reduce'(add, 7)
+    is($I0, 7, 'parallel_reduce of an empty array is the initial value')
+.end
+
+.sub add
+    .param int a
+    .param int b
+    $I0 = a + b
+    .return ($I0)
+.end
+
+.sub test_parallel_sort
+    .local pmc array
+    .local int i, prev, cur
+    array = new ['FixedIntegerArray'], 5000
+    i = 0
+  fill:
+    $I0 = i * 7919
+    $I0 %= 5000
+    array[i] = $I0
+    inc i
+    if i < 5000 goto fill
+
+    array.'parallel_sort'()
+    i = 1
+    prev = array[0]
+  check:
+    cur = array[i]
+    if cur != i goto unsorted
+    inc i
+    if i < 5000 goto check
+  unsorted:
+    is(i, 5000, 'parallel_sort')
+    is(prev, 0, 'parallel_sort keeps the smallest element first')
+
+    $P0 = get_global 'descending'
+    array.'parallel_sort'($P0)
+    $I0 = array[0]
+    $I1 = array[4999]
+    is($I0, 4999, 'parallel_sort with a custom cmp function, first')
+    is($I1, 0, 'parallel_sort with a custom cmp function, last')
+.end
+
+.sub descending
+    .param int a
+    .param int b
+    $I0 = cmp b, a
+    .return ($I0)
+.end
+
+.sub test_parallel_error
+    .local pmc array
+    array = fill_parallel(5000)
+    $P0 = get_global 'fail_at'
+    push_eh caught
+    array.'parallel_each'($P0)
+    pop_eh
+    ok(0, 'an exception in parallel_each reaches the caller')
+    .return ()
+  caught:
+    .get_results ($P1)
+    pop_eh
+    $S0 = $P1['message']
+    is($S0, 'failed at 4321', 'an exception in parallel_each reaches the caller')
+.end
+
+.sub fail_at
+    .param int i
+    if i != 4321 goto ok
+    $S0 = i
+    $S0 = concat 'failed at ', $S0
+    die $S0
+  ok:
+.end
+
+.sub test_parallel_invokables
+    .local pmc array, code
+    array = fill_parallel(10)
+
+    code = get_global 'scaled'
+    code = newclosure code
+    $S0 = "parallel operations can't use a closure or a Sub with :outer"
+    parallel_rejects(array, code, $S0, 'a closure')
+
+    code = get_global 'twice'
+    parallel_rejects(array, code, 'parallel operations need a Sub, not a MultiSub', 'a MultiSub')
+
+    code = get_global 'counting'
+    parallel_rejects(array, code, 'parallel operations need a Sub, not a Coroutine', 'a Coroutine')
+
+    $P0 = newclass 'ParallelInvokable'
+    code = new $P0
+    $S0 = 'parallel operations need a Sub, not a ParallelInvokable'
+    parallel_rejects(array, code, $S0, 'an invokable object')
+
+    $S0 = join ' ', array
+    is($S0, '0 1 2 3 4 5 6 7 8 9', '... and the array is untouched')
+.end
+
+.sub parallel_rejects
+    .param pmc array
+    .param pmc code
+    .param string message
+    .param string desc
+    desc = concat 'parallel_map rejects ', desc
+    push_eh caught
+    array.'parallel_map'(code)
+    pop_eh
+    ok(0, desc)
+    .return ()
+  caught:
+    .get_results ($P0)
+    pop_eh
+    $S0 = $P0['message']
+    is($S0, message, desc)
+.end
+
+.sub scale_by
+    .lex '$by', $P0
+    $P0 = box 3
+.end
+
+.sub scaled :outer('scale_by')
+    .param int i
+    $P0 = find_lex '$by'
+    $I0 = $P0
+    i *= $I0
+    .return (i)
+.end
+
+.sub twice :multi(int)
+    .param int i
+    i *= 2
+    .return (i)
+.end
+
+.sub counting
+    .param int i
+    .yield (i)
+.end
+
+.namespace ['ParallelInvokable']
+
+.sub invoke :vtable
+    .param int i
+    .return (i)
+.end
 
+.namespace []
 
 # Local Variables:
 #   mode: pir
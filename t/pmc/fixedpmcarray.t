@@ -20,7 +20,7 @@ out-of-bounds test. Checks INT and PMC keys.
 
 .sub main :main
     .include 'test_more.pir'
-    plan(86)
+    plan(89)
     test_setting_array_size()
     test_resize_exception()
     test_truthiness()
@@ -85,6 +85,92 @@ out-of-bounds test. Checks INT and PMC keys.
      cmp_fun = get_global "cmp_fun"
      sort_ar()
      sort_ar(cmp_fun)
+     sort_stable()
+.end
+
+.sub sort_stable
+    .local pmc array, cmp_fun, pair
+    .local int i
+    array = new ['FixedPMCArray'], 6
+    i = 0
+  fill:
+    pair = new ['FixedIntegerArray'], 2
+    $I0 = mod i, 2
+    pair[0] = $I0
+    pair[1] = i
+    array[i] = pair
+    inc i
+    if i < 6 goto fill
+
+    cmp_fun = get_global 'cmp_first'
+    array.'sort'(cmp_fun)
+    $S0 = ''
+    i = 0
+  join_pairs:
+    pair = array[i]
+    $S1 = pair[1]
+    $S0 .= $S1
+    inc i
+    if i < 6 goto join_pairs
+    is($S0, '024135', 'sort with a cmp function is stable')
+
+    $P0 = get_global 'make_cmp'
+    cmp_fun = $P0(-1)
+    array.'sort'(cmp_fun)
+    $S0 = ''
+    i = 0
+  join_closure:
+    pair = array[i]
+    $S1 = pair[1]
+    $S0 .= $S1
+    inc i
+    if i < 6 goto join_closure
+    is($S0, '135024', 'sort with a closure')
+
+    array = new ['ResizablePMCArray']
+    push array, 'pear'
+    push array, 'fig'
+    push array, 'apple'
+    push array, 'kiwi'
+    $P0 = get_global 'str_length'
+    array.'sort'('key' => $P0)
+    $S0 = join ' ', array
+    is($S0, 'fig pear kiwi apple', 'sort by key')
+.end
+
+.sub cmp_first
+    .param pmc a
+    .param pmc b
+    $I0 = a[0]
+    $I1 = b[0]
+    $I2 = cmp $I0, $I1
+    .return ($I2)
+.end
+
+.sub make_cmp
+    .param int direction
+    .lex '$direction', $P0
+    $P0 = box direction
+    .const 'Sub' cmp_closure = 'cmp_closure'
+    $P1 = newclosure cmp_closure
+    .return ($P1)
+.end
+
+.sub cmp_closure :outer('make_cmp')
+    .param pmc a
+    .param pmc b
+    $P0 = find_lex '$direction'
+    $I0 = $P0
+    $P1 = get_global 'cmp_first'
+    $I1 = $P1(a, b)
+    $I1 *= $I0
+    .return ($I1)
+.end
+
+.sub str_length
+    .param string s
+    $I0 = length s
+    .return ($I0)
 .end
 
 # this is used by test_sort
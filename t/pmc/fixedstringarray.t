@@ -18,7 +18,7 @@ out-of-bounds test. Checks INT and PMC keys.
 
 .sub 'main' :main
     .include 'test_more.pir'
-    plan(50)
+    plan(53)
 
     test_set_size()
     test_reset_size()
@@ -39,6 +39,43 @@ out-of-bounds test. Checks INT and PMC keys.
     test_new_style_init()
     test_invalid_init_tt1509()
     test_gc()
+    test_sort()
+.end
+
+.sub 'test_sort'
+    .local pmc array
+    array = new ['FixedStringArray'], 5
+    array[0] = 'pear'
+    array[1] = 'fig'
+    array[2] = 'apple'
+    array[3] = 'kiwi'
+    array[4] = 'banana'
+    array.'sort'()
+    $S0 = join ' ', array
+    is($S0, 'apple banana fig kiwi pear', 'sort')
+
+    $P0 = get_global 'by_length'
+    array.'sort'('key' => $P0)
+    $S0 = join ' ', array
+    is($S0, 'fig kiwi pear apple banana', 'sort by key')
+
+    $P0 = get_global 'reverse_cmp'
+    array.'sort'($P0)
+    $S0 = join ' ', array
+    is($S0, 'pear kiwi fig banana apple', 'sort with a cmp function')
+.end
+
+.sub 'by_length'
+    .param string s
+    $I0 = length s
+    .return ($I0)
+.end
+
+.sub 'reverse_cmp'
+    .param string a
+    .param string b
+    $I0 = cmp b, a
+    .return ($I0)
 .end
 
 .sub 'test_set_size'
@@ -0,0 +1,21 @@
+.const string fpmc = "temp.fpmc"
+.sub 'main' :main
+    $P0 = new ['FileHandle']
+    $P0.'open'(fpmc, 'rb')
+    if $P0 goto ok1
+
+    $P0 = getinterp
+    $P1 = $P0.'stderr_handle'()
+    $P1.'print'("couldn't open fpmc for reading")
+    exit 1
+
+ok1:
+    $S3 = $P0.'readall'()
+    $P0.'close'()
+    print "ok 1\n"
+    $P4 = thaw $S3
+    print "ok 2\n"
+    $S10 = $P4
+    print $S10
+    print "\n"
+.end
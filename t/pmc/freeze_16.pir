@@ -0,0 +1,16 @@
+.const string fpmc = 'temp.fpmc'
+.sub 'main' :main
+    $P10 = newclass "Foo"
+    addattribute $P10, ".aa"
+    $S10 = $P10
+    print $S10
+    print "\n"
+    $S11 = freeze $P10
+    print "ok 1\n"
+
+    $P0 = new ['FileHandle']
+    $P0.'open'(fpmc, 'w')
+    $P0.'print'($S11)
+    $P0.'close'()
+    print "ok 2\n"
+.end
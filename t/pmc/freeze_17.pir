@@ -0,0 +1,35 @@
+.const string fpmc = "temp.fpmc"
+.sub 'main' :main
+    $P0 = new ['FileHandle']
+    $P0.'open'(fpmc, 'rb')
+    if $P0 goto ok1
+
+    $P0 = getinterp
+    $P1 = $P0.'stderr_handle'()
+    $P1.'print'("couldn't open fpmc for reading\n")
+    exit 1
+
+ok1:
+    $S3 = $P0.'readall'()
+    $P0.'close'()
+    print "ok 1\n"
+
+    $P4 = thaw $S3
+    print "ok 2\n"
+
+    $S10 = $P4
+    print $S10
+    print "\n"
+
+    $P5 = new $S10
+    print "ok 3\n"
+
+    $P6 = new ['String']
+    $P6 = "ok 5\n"
+
+    setattribute $P5, '.aa', $P6
+    print "ok 4\n"
+
+    $P7 = getattribute $P5, '.aa'
+    print $P7
+.end
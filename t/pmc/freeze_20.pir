@@ -0,0 +1,36 @@
+.const string fpmc = 'temp.fpmc'
+.sub 'main' :main
+    $P0 = new ['FileHandle']
+    $P0.'open'(fpmc, 'rb')
+    if $P0 goto ok1
+
+    $P0 = getinterp
+    $P1 = $P0.'stderr_handle'()
+    $P1.'print'("open failed\n")
+
+ok1:
+    $S3 = $P0.'readall'()
+    $P0.'close'()
+
+    $P5 = thaw $S3
+    print "ok 2\n"
+    $S10 = typeof $P5
+    print $S10
+    print "\n"
+
+    print "ok 3\n"
+    $P6 = new ['String']
+    $P6 = "ok 5\n"
+    setattribute $P5, ["Foo"], ".aa", $P6
+
+    $P6 = new ['String']
+    $P6 = "ok 6\n"
+    setattribute $P5, ["Foo"], ".bb", $P6
+
+    print "ok 4\n"
+    $P7 = getattribute $P5, ".aa"
+    print $P7
+
+    $P7 = getattribute $P5, ".bb"
+    print $P7
+.end
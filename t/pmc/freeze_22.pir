@@ -0,0 +1,47 @@
+.sub test :main
+    .local pmc original_arr, thawed_arr
+    .local string frozen_arr
+    original_arr = new ['ResizableBooleanArray']
+    set original_arr, 666
+    original_arr[555] = 777
+
+    # Dump some data before freezing
+    print "Before freezing:\n"
+    typeof $S10, original_arr   # type
+    print $S10
+    print "\n"
+    set $I12, original_arr  # elements
+    print $I12
+    print "\n"
+    $I12 = original_arr[554]
+    print $I12
+    print "\n"
+    $I12 = original_arr[555]
+    print $I12
+    print "\n"
+    $I12 = original_arr[556]
+    print $I12
+    print "\n"
+
+    frozen_arr = freeze original_arr
+    thawed_arr = thaw frozen_arr
+
+    # Dump the same data after freeze/thaw
+    print "\nAfter freeze/thaw:\n"
+    typeof $S10, thawed_arr # type
+    print $S10
+    print "\n"
+    set $I12, thawed_arr    # elements
+    print $I12
+    print "\n"
+    $I12 = thawed_arr[554]
+    print $I12
+    print "\n"
+    $I12 = thawed_arr[555]
+    print $I12
+    print "\n"
+    $I12 = thawed_arr[556]
+    print $I12
+    print "\n"
+
+.end
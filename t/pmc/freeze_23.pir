@@ -0,0 +1,48 @@
+.sub test :main
+    .local pmc original_arr, thawed_arr
+    .local string frozen_arr
+    original_arr = new ['ResizablePMCArray']
+    original_arr[0] = 1
+    original_arr[1] = 2.72
+    original_arr[2] = "three.14"
+
+    # Dump some data before freezing
+    print "Before freezing:\n"
+    typeof $S10, original_arr    # type
+    print $S10
+    print "\n"
+    set $I12, original_arr   # elements
+    print $I12
+    print "\n"
+    $I12 = original_arr[0]
+    print $I12
+    print "\n"
+    $N12 = original_arr[1]
+    print $N12
+    print "\n"
+    $S12 = original_arr[2]
+    print $S12
+    print "\n"
+
+    frozen_arr = freeze original_arr
+    thawed_arr = thaw frozen_arr
+
+    # Dump the same data after freeze/thaw
+    print "\nAfter freeze/thaw:\n"
+    typeof $S10, thawed_arr  # type
+    print $S10
+    print "\n"
+    set $I12, thawed_arr # elements
+    print $I12
+    print "\n"
+    $I12 = thawed_arr[0]
+    print $I12
+    print "\n"
+    $N12 = thawed_arr[1]
+    print $N12
+    print "\n"
+    $S12 = thawed_arr[2]
+    print $S12
+    print "\n"
+
+.end
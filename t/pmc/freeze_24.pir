@@ -0,0 +1,17 @@
+.sub main :main
+    .local pmc cl, o
+    cl = newclass 'Conure'
+    addattribute cl, 'temperature'
+    o = new ['Conure']
+    $S0 = freeze o
+    $P1 = thaw $S0
+    $P2 = getattribute $P1, 'temperature'
+    say $P2
+.end
+
+.namespace ['Conure']
+.sub init :method :vtable
+    $P0 = new ['Integer']
+    $P0 = 37
+    setattribute self, 'temperature', $P0
+.end
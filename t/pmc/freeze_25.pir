@@ -0,0 +1,51 @@
+.sub main :main
+    .local pmc cl, o
+    #cl = subclass 'Hash', 'OPTable'
+    cl = newclass 'OPTable'
+    addattribute cl, '%!key'
+    addattribute cl, '%!klen'
+    addattribute cl, '&!ws'
+    o = new ['OPTable']
+    o."init"()
+    o."test"()
+    $S0 = freeze o
+    $P1 = thaw $S0
+    $P1."test"()
+.end
+
+.namespace [ "OPTable" ]
+
+.sub "init" :method :vtable
+    .local pmc keytable, klentable
+    keytable = new ['Hash']
+    klentable = new ['Hash']
+    setattribute self, '%!key', keytable
+    setattribute self, '%!klen', klentable
+.end
+
+.sub "init" :method
+    .local pmc keytable, klentable
+    keytable = getattribute self, '%!key'
+    keytable['bar'] = 1
+    keytable['foobar'] = 2
+    klentable = getattribute self, '%!klen'
+    klentable['bar'] = 3
+    klentable['foobar'] = 6
+.end
+
+.sub "test" :method
+    .local pmc keytable, klentable
+    keytable = getattribute self, "%!key"
+    $I0 = keytable['bar']
+    print $I0
+    print ' '
+    $I0 = keytable['foobar']
+    print $I0
+    print ' '
+    klentable = getattribute self, "%!klen"
+    $I0 = klentable['bar']
+    print $I0
+    print ' '
+    $I0 = klentable['foobar']
+    say $I0
+.end
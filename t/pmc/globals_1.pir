@@ -0,0 +1,11 @@
+.sub main :main
+   .local pmc ns, o
+   ns = get_global "Foo"
+   o = ns["f"]
+   o()
+.end
+
+.namespace ["Foo"]
+.sub f
+    print "ok\n"
+.end
@@ -0,0 +1,11 @@
+.sub main :main
+    .local pmc f, x
+    f = get_global "f"
+    set_global ["Foo"], "x", f
+    x = get_global ["Foo"], "x"
+    x()
+.end
+
+.sub f
+    print "ok\n"
+.end
@@ -0,0 +1,11 @@
+.sub main :main
+   .local pmc ns, o
+   ns = get_hll_namespace ["Foo"; "Bar"]
+   o = ns["f"]
+   o()
+.end
+
+.namespace ["Foo" ; "Bar"]
+.sub f
+    print "ok\n"
+.end
@@ -0,0 +1,17 @@
+.namespace ['Foo'; 'Bar']
+.sub test
+  print "ok\n"
+  .return()
+.end
+
+.namespace []
+.sub main :main
+  $P0 = split "::", "Foo::Bar::test"
+  $S0 = pop $P0
+
+  $P1 = get_hll_namespace $P0
+  $P1 = $P1[$S0]
+
+  $P1()
+  end
+.end
@@ -0,0 +1,28 @@
+.sub main :main
+    new $P0, ['FileHandle']
+
+    push_eh _readline_handler
+    $S0 = $P0.'readline'()
+    print "not "
+
+_readline_handler:
+        print "ok 1\n"
+        pop_eh
+
+    push_eh _read_handler
+    $S0 = $P0.'read'(1)
+    print "not "
+
+_read_handler:
+        print "ok 2\n"
+        pop_eh
+
+    push_eh _print_handler
+    print $P0, "kill me now\n"
+    print "not "
+
+_print_handler:
+        print "ok 3\n"
+        pop_eh
+
+.end
@@ -0,0 +1,16 @@
+.sub 'main' :main
+   set $I0, 0
+   set $I1, 10000
+
+   new $P0, ['FileHandle']
+   $P0.'open'("/tmp/G0dCxHGDHa", 'w')
+
+PRINT:
+   ge $I0, $I1, END
+   print $P0, "words\n"
+   inc $I0
+   branch PRINT
+
+END:
+   $P0.'close'()
+.end
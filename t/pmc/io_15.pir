@@ -0,0 +1,35 @@
+.const string temp_file = '/tmp/G0dCxHGDHa'
+
+.sub main :main
+    $P0 = new ['FileHandle']
+    $P0.'open'(temp_file, 'w')
+
+#   set buffer type
+    $P0.'buffer_type'('unbuffered')
+
+#   get buffer type
+    $S0 = $P0.'buffer_type'()
+    print $S0
+    print "\n"
+
+    print $P0, "Howdy World\n"
+
+    $P0.'close'()
+
+    $P0 = new ['FileHandle']
+    $P0.'open'(temp_file, 'r')
+
+#   set buffer type
+    $P0.'buffer_type'('unbuffered')
+
+#   get buffer type
+    $S0 = $P0.'buffer_type'()
+    print $S0
+    print "\n"
+
+    $S0 = $P0.'read'(50)
+    print $S0
+
+    $P0.'close'()
+    end
+.end
@@ -0,0 +1,57 @@
+.const string temp_file = '/tmp/G0dCxHGDHa'
+
+.sub main :main
+    .local string filename
+    filename = temp_file
+    $P1 = new ['FileHandle']
+    $P1.'open'(filename, 'w')
+    .local int count, max, nltest
+    count = 0
+    max = 10000
+  LOOP:
+    if count > max goto DONE
+    $S1 = count
+    $S1 = concat $S1, " "
+    print $P1, $S1
+    inc count
+    nltest = mod count, 20
+    if nltest goto LOOP
+    print $P1, "\n"
+    goto LOOP
+  DONE:
+    print $P1, "\n"
+    $P1.'close'()
+
+  PART_2:
+    $P1 = new ['FileHandle']
+    $P1.'open'(filename)
+    $I0 = 0
+  LINE:
+    $S1 = $P1.'readline'()
+    unless $S1 goto SUCCESS
+    $S1 = chopn $S1, 1
+
+  NEXT_NR:
+    $I1 = length $S1
+    if $I1 <= 1 goto LINE
+    $S2 = ""
+  SPLIT:
+    $S3 = substr $S1, 0, 1
+    $S1 = replace $S1, 0, 1, ""
+    if $S3 == " " goto GOT_NR
+    $S2 = concat $S2, $S3
+    goto SPLIT
+  GOT_NR:
+    $I1 = $S2
+    if $I0 != $I1 goto FAILED
+    inc $I0
+    goto NEXT_NR
+
+  FAILED:
+    say "Failed"
+    goto EXIT
+  SUCCESS:
+    say "Successful"
+  EXIT:
+    end
+.end
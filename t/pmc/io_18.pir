@@ -0,0 +1,20 @@
+.sub main :main
+    $P99 = getinterp
+    $P0  = $P99.'stdin_handle'()
+    $I0  = $P0.'get_fd'()
+    # I0 is 0 on Unix and non-Null on stdio and win32
+    print "ok 1\n"
+
+    $P1 = $P99.'stdout_handle'()
+    $I1 = $P1.'get_fd'()
+    if $I1, OK_2
+    print "not "
+OK_2:
+    say "ok 2"
+    $P2 = $P99.'stderr_handle'()
+    $I2 = $P2.'get_fd'()
+    if $I2, OK_3
+    print "not "
+OK_3:
+    say "ok 3"
+.end
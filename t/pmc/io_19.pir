@@ -0,0 +1,10 @@
+.sub main :main
+    $P0 = getinterp
+    $P2 = $P0.'stdout_handle'()
+    can $I0, $P2, "print"
+    if $I0, ok1
+    print "not "
+ok1:   print "ok 1\n"
+    set_args "0,0", $P2, "ok 2\n"
+    callmethodcc $P2, "print"
+.end
@@ -0,0 +1,13 @@
+.sub main :main
+   .local string s
+   s = "ok 2\n"
+   .local pmc io
+   $P0 = getinterp
+   io = $P0.'stdout_handle'()
+   $I0 = can io, "print"
+   if $I0 goto ok1
+   print "not "
+ok1:   print "ok 1\n"
+   io."print"(s)
+.end
+
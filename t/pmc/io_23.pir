@@ -0,0 +1,11 @@
+.const string temp_file = '/tmp/G0dCxHGDHa'
+.sub 'main' :main
+    $P0 = new ['FileHandle']
+
+    $P0.'open'(temp_file, 'r')
+    $S0 = $P0.'readline'()
+    print $S0
+    $I0 = $P0.'tell'()
+    say $I0
+    $P0.'close'()
+.end
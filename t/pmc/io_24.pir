@@ -0,0 +1,7 @@
+.const string temp_file = '/tmp/G0dCxHGDHa'
+.sub main :main
+    $P0 = new ['FileHandle']
+    $P0.'open'(temp_file, 'w')
+    $P0.'seek'(-1, 0)
+    say "error!"
+.end
@@ -0,0 +1,22 @@
+.sub _main :main
+    # Write something into a file
+    .local pmc out
+    out = new ['FileHandle']
+    out.'open'("/tmp/G0dCxHGDHa", 'w')
+    print out, "0123456789\n"
+    out.'close'()
+
+    # read file contents back in
+    .local pmc in
+    in = new ['FileHandle']
+    in.'open'("/tmp/G0dCxHGDHa", 'r')
+    .local string from_file
+    from_file = in.'read'(20)
+
+    # Extract part of the read in file
+    .local string head_from_file
+    head_from_file = substr from_file, 0, 5
+    say head_from_file
+
+    end
+.end
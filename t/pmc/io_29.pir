@@ -0,0 +1,33 @@
+
+.sub _main :main
+    # Write something into a file
+    .local pmc out
+    out = new ['FileHandle']
+    out.'open'("/tmp/G0dCxHGDHa", 'w')
+    print out, "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ\n"
+    out.'close'()
+
+    .local pmc in
+    .local string line
+    in = new ['FileHandle']
+    in.'open'('/tmp/G0dCxHGDHa', 'r')
+    line = in.'read'(50000)
+    in.'close'()
+
+    .local string sub_1
+    sub_1 = ''
+    .local string sub_2
+    sub_2 = ''
+    .local string sub_3
+    sub_3 = ''
+    substr sub_1, line, 0, 3
+    substr sub_2, line, 3, 3
+    line = replace line, 0, 6, ''
+    print "line: "
+    print line
+    print "sub_1: "
+    say sub_1
+    print "sub_2: "
+    say sub_2
+  end
+.end
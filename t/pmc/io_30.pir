@@ -0,0 +1,21 @@
+.const string temp_file = '/tmp/l4aOb6kpx5'
+.sub main :main
+    .local pmc pio
+    pio = new ['FileHandle']
+    pio.'open'(temp_file, 'r')
+    pio.'encoding'("utf8")
+    $S0 = pio.'read'(2)
+    say $S0
+    $S1 = pio.'read'(6)
+    say $S1
+    $S0 .= $S1
+    $S1 = pio.'read'(1024) # read the rest of the file (much shorter than 1K)
+    $S0 .= $S1
+    pio.'close'()
+
+    $I1 = encoding $S0
+    $S2 = encodingname $I1
+    say $S2
+
+    print $S0
+.end
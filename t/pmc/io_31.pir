@@ -0,0 +1,31 @@
+.const string temp_file = '/tmp/l4aOb6kpx5'
+.sub main :main
+    .local pmc pio
+
+    pio = new ['FileHandle']
+    pio.'open'(temp_file, 'w')
+    pio.'encoding'("utf16")
+    pio.'print'(utf8:"abc \x{1d004} def")
+    $I0 = pio.'tell'()
+    say $I0
+    pio.'close'()
+
+    pio.'open'(temp_file, 'r')
+    pio.'encoding'("utf16")
+    $S0 = pio.'read'(5)
+    $I0 = iseq $S0, ucs4:"abc \x{1d004}"
+    say $I0
+    $S1 = pio.'read'(1)
+    $I0 = iseq $S1, ' '
+    say $I0
+    $S0 .= $S1
+    $S1 = pio.'read'(1024) # read the rest of the file (much shorter than 1K)
+    $S0 .= $S1
+    $I0 = iseq $S0, ucs4:"abc \x{1d004} def"
+    say $I0
+    pio.'close'()
+
+    $I1 = encoding $S0
+    $S2 = encodingname $I1
+    say $S2
+.end
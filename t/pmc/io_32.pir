@@ -0,0 +1,18 @@
+.sub main :main
+    $S0 = <<"EOS"
+line 1
+line 2
+line 3
+EOS
+    .local pmc pio, cl
+    pio = new ['FileHandle']
+    pio.'open'("/tmp/l4aOb6kpx5", 'w')
+    print pio, $S0
+    pio.'close'()
+    cl = new ['FileHandle']
+    $S1 = cl.'readall'('/tmp/l4aOb6kpx5')
+    if $S0 == $S1 goto ok
+    print "not "
+ok:
+    say "ok"
+.end
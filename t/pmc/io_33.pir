@@ -0,0 +1,20 @@
+.sub main :main
+    $S0 = <<"EOS"
+line 1
+line 2
+line 3
+EOS
+    .local pmc pio, pio2
+    pio = new ['FileHandle']
+    pio.'open'("/tmp/l4aOb6kpx5", 'w')
+    print pio, $S0
+    pio.'close'()
+
+    pio2 = new ['FileHandle']
+    pio2.'open'("/tmp/l4aOb6kpx5", 'r')
+    $S1 = pio2.'readall'()
+    if $S0 == $S1 goto ok
+    print "not "
+ok:
+    say "ok"
+.end
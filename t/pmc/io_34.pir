@@ -0,0 +1,40 @@
+.sub main :main
+    .local int i, len
+    .local string str, c
+    .local pmc pio
+
+    getstdout $P0
+    $P0.'encoding'('ascii')
+
+    str = 'a'
+    c = chr 0x1d001
+    i = 0
+loop:
+    str .= c
+    inc i
+    if i < 8000 goto loop
+    str .= "\nline 2\n"
+
+    pio = new ['FileHandle']
+    pio.'open'("/tmp/l4aOb6kpx5", 'w')
+    pio.'encoding'('utf16')
+    print pio, str
+    len = pio.'tell'()
+    say len
+    pio.'close'()
+
+    pio = new ['FileHandle']
+    pio.'open'("/tmp/l4aOb6kpx5", 'r')
+    pio.'encoding'('utf16')
+
+    str = pio.'readline'()
+    len = length str
+    say len
+    i = ord str, 5678
+    say i
+
+    str = pio.'readline'()
+    print str
+
+    pio.'close'()
+.end
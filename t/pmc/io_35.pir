@@ -0,0 +1,13 @@
+.const string temp_file = '/tmp/_onsCBS2jg'
+.sub 'main' :main
+    $P0 = new ['FileHandle']
+
+    $P0.'open'(temp_file, 'r')
+  loop_top:
+    $S0 = $P0.'readline'('TEST')
+    unless $S0 goto loop_bottom
+    say $S0
+    goto loop_top
+  loop_bottom:
+    $P0.'close'()
+.end
@@ -0,0 +1,8 @@
+.const string temp_file = '/tmp/G0dCxHGDHa'
+.sub 'main' :main
+    $P1 = new ['FileHandle']
+    $P1.'open'(temp_file, "w")
+    $P1.'print'("Hello, World!\n")
+    $P1.'close'()
+    say "done"
+.end
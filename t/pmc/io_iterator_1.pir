@@ -0,0 +1,5 @@
+.sub 'test' :main
+    $P99 = 1 # GH #633 replace with io object
+    $P0 = iter $P99
+    say "ok 1 - $P0 = iter $P1"
+.end
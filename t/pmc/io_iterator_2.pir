@@ -0,0 +1,13 @@
+.sub 'test' :main
+    $P99 = 1 # GH #633 replace with io object
+    $P0 = iter $P99
+
+    $S0 = shift $P0
+
+    if $S0 == 'abc' goto ok_1
+    print 'not '
+  ok_1:
+    say 'ok 1 - $S0 = shift $P1 # success'
+
+    # GH #549  test more return values, including end of file
+.end
@@ -0,0 +1,39 @@
+.sub 'test' :main
+    $P99 = 1 # GH #633 replace with io object
+    $P0 = iter $P99
+
+    # empty i/o object
+    unless $P0 goto ok_1
+    print 'not '
+  ok_1:
+    say 'ok 1 - $P0 # empty i/o object returns false'
+
+    # GH #633 setup i/o object with two lines
+    if $P0 got ok_2
+    print 'not '
+  ok_2:
+    say 'ok 2 - $P0 # i/o object with data returns true
+
+    $S0 = shift $P0
+    $I0 = length $S0
+    unless $I0 goto nok_3
+    if $P0 goto ok_3
+
+  nok_3:
+    print 'not '
+  ok_3:
+    say 'ok 3 - $P0 # i/o object with more data returns true'
+
+    $S0 = shift $P0
+    $I0 = length $S0
+    unless $I0 goto nok_4
+    unless $P0 goto ok_4
+
+  nok_4:
+    print 'not '
+  ok_4:
+    say 'ok 4 - $P0 # i/o object with no more data returns false'
+
+    if $P0 goto ok_1
+    print 'not '
+.end
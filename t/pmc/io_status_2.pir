@@ -0,0 +1,22 @@
+.sub 'test' :main
+    $P0 = new ['Status']
+
+    # TODO test more return values
+    # TODO figure out how to set the values to make testing possible
+    $I0 = $P0
+
+    if $I0 == 1 goto ok_1
+    print 'not '
+  ok_1:
+    say 'ok 1 - $I0 = $P1 # success'
+
+    if $I0 == 0 goto ok_2
+    print 'not '
+  ok_2:
+    say 'ok 2 - $I0 = $P1 # still running'
+
+    if $I0 == -1 goto ok_3
+    print 'not '
+  ok_3:
+    say 'ok 3 - $I0 = $P1 # failure
+.end
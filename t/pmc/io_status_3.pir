@@ -0,0 +1,20 @@
+.sub 'test' :main
+    $P0 = new ['Status']
+
+    # TODO figure out how to set the values to make testing possible
+
+    if $P0 goto ok_1
+    print 'not '
+  ok_1:
+    say 'ok 1 - $P0 # success'
+
+    if $P0 goto ok_2
+    print 'not '
+  ok_2:
+    say 'ok 2 - $P0 # still running'
+
+    unless $P0 goto ok_3
+    print 'not '
+  ok_3:
+    say 'ok 3 - $P0 # failure
+.end
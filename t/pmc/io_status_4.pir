@@ -0,0 +1,25 @@
+.sub 'test' :main
+    $P0 = new ['Status']
+
+    # TODO test all return values
+    # TODO figure out how to set the values to make testing possible
+
+    $P1 = $P0.return()
+
+    if $P1 goto ok_1
+    print 'not '
+  ok_1:
+    say 'ok 1 - $P0 = $P1.return() # success'
+
+    # TODO test return value is expected value
+
+    if null $P1 goto ok_2
+    print 'not '
+  ok_2:
+    say 'ok 2 - $P0 = $P1.return() # still running'
+
+    if null $P1 goto ok_3
+    print 'not '
+  ok_3:
+    say 'ok 3 - $P0 = $P1.return() # no return value
+.end
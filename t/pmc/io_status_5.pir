@@ -0,0 +1,42 @@
+.sub 'test' :main
+    $P0 = new ['Status']
+
+    # TODO test all error values
+    # TODO figure out how to set the values to make testing possible
+
+    $P1 = $P0.error()
+
+    if null $P1 goto ok_1
+    print 'not '
+  ok_1:
+    say 'ok 1 - $P0 = $P1.error() # success'
+
+    $P1 = $P0.error() # need still running here
+
+    if null $P1 goto ok_2
+    print 'not '
+  ok_2:
+    say 'ok 2 - $P0 = $P1.error() # still running'
+
+    $P1 = $P0.error() # need real error here
+
+    unless null $P1 goto ok_3
+    print 'not '
+  ok_3:
+    say 'ok 3 - $P0 = $P1.error() # got an error'
+
+    $I0 = isa $P1, 'Exception'
+    if $I0 goto ok_4
+    print 'not '
+  ok_4:
+    say 'ok 4 - $P0 = $P1.error() # error isa Exception'
+
+    # TODO test error value is expected value
+
+    $P1 = $P0.error() # need no error here
+
+    if null $P1 goto ok_5
+    print 'not '
+  ok_5:
+    say 'ok 5 - $P0 = $P1.error() # no error
+.end
@@ -0,0 +1,31 @@
+.sub 'test' :main
+    $P0 = new ['Status']
+
+    # TODO figure out how to set the values to make testing possible
+
+    push_eh eh_no_error
+    $P0.throw()
+    pop_eh eh_no_error
+
+    say 'ok 1 - $P0.throw() # no error'
+
+  test_2:
+    $P0 = new ['Status'] # need error here
+
+    push_eh eh_error
+    $P0.throw()
+    pop_eh
+
+    say 'not ok 2 - $P0.throw() # error'
+
+    goto end
+
+  eh_no_error:
+    say 'not ok 1 - $P0.throw() # no error'
+    goto test_2
+
+  eh_error:
+    say 'ok 2 - $P0.throw() # error'
+
+  end:
+.end
@@ -0,0 +1,24 @@
+
+.include "iterator.pasm"
+.sub _main :main
+    .local pmc string_1
+    string_1 = new ['String']
+    string_1 = "abcd\x65\x66\x67"
+    print string_1
+    print "\n"
+
+    .local pmc iter_1
+    iter_1 = iter string_1
+    iter_1 = .ITERATE_FROM_START
+
+    .local int code_point_1
+ITER_LOOP:
+    unless iter_1 goto ITER_END
+    shift code_point_1, iter_1
+    print code_point_1
+    print "\n"
+    branch ITER_LOOP
+ITER_END:
+    print "reached end\n"
+    end
+.end
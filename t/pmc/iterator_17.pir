@@ -0,0 +1,41 @@
+
+.include "iterator.pasm"
+.sub _main :main
+    .local pmc string_1
+    string_1 = new ['String']
+    string_1 = "abcd\x65\x66\x67"
+    print 'String new: '
+    print string_1
+    print "\n"
+
+    .local pmc iter_1
+    iter_1 = iter string_1
+    iter_1 = .ITERATE_FROM_START
+
+    .local int    code_point_1
+    .local num  code_point_2
+    .local string code_point_3
+    .local pmc    code_point_4
+
+    print 'Iterator shift_integer: '
+    shift code_point_1, iter_1
+    print code_point_1
+    print "\n"
+
+    print 'Iterator get_integer_keyed_int 2: '
+    code_point_1 = iter_1[2]
+    print code_point_1
+    print "\n"
+
+    print 'Iterator get_integer_keyed_int 0: '
+    code_point_1 = iter_1[0]
+    print code_point_1
+    print "\n"
+
+    print 'Iterator get_integer_keyed_int -1: '
+    code_point_1 = iter_1[-1]
+    print code_point_1
+    print "\n"
+
+    end
+.end
@@ -0,0 +1,91 @@
+
+.include "iterator.pasm"
+.sub _main :main
+    .local pmc array_1
+    array_1 = new ['ResizablePMCArray']
+    push array_1, 'a'
+    push array_1, 'b'
+    push array_1, 'c'
+    push array_1, 'd'
+    push array_1, 'e'
+    push array_1, 'f'
+    push array_1, '7'
+    push array_1, '-8.8'
+
+    print 'ResizablePMCArray get_string: '
+    print array_1
+    print "\n"
+
+    .local pmc iter_1
+    iter_1 = iter array_1
+    iter_1 = .ITERATE_FROM_START
+
+    .local string elem_1
+
+    print 'Iterator shift_string: '
+    shift elem_1, iter_1
+    print elem_1
+    print "\n"
+
+    print 'Iterator get_string_keyed_int 2: '
+    elem_1 = iter_1[2]
+    print elem_1
+    print "\n"
+
+    print 'Iterator get_string_keyed_int -1: '
+    elem_1 = iter_1[-1]
+    print elem_1
+    print "\n"
+
+    print 'Iterator get_string_keyed_int 0: '
+    elem_1 = iter_1[0]
+    print elem_1
+    print "\n"
+
+    print 'Iterator get_pmc_keyed_int 3: '
+    .local pmc elem_2
+    elem_2 = iter_1[3]
+    print elem_2
+    print "\n"
+
+    .local int flag
+
+    print 'Iterator exists_keyed_int 3: '
+    flag = exists iter_1[3]
+    print flag
+    print "\n"
+
+    print 'Iterator exists_keyed_int 28: '
+    flag = exists iter_1[28]
+    print flag
+    print "\n"
+
+
+    print 'Iterator defined_keyed_int 3: '
+    flag = defined iter_1[3]
+    print flag
+    print "\n"
+
+    print 'Iterator defined_keyed_int -1278: '
+    flag = defined iter_1[-1278]
+    print flag
+    print "\n"
+
+    .local pmc iter_2
+    iter_2 = iter array_1
+    iter_2 = .ITERATE_FROM_END
+
+    print 'Iterator shift_float: '
+    .local num felem_2
+    pop felem_2, iter_2
+    print felem_2
+    print "\n"
+
+    print 'Iterator get_integer: '
+    .local int elem_3
+    elem_3 = iter_2[-1]
+    print elem_3
+    print "\n"
+
+    end
+.end
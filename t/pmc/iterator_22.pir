@@ -0,0 +1,41 @@
+.sub main :main
+    .local pmc h, it, ar
+    .local string k
+    .local int i,v
+
+    h = new ['Hash']
+    i = 0
+lp1:
+    $I0 = i + 65
+    k = chr $I0
+    h[k] = i
+    inc i
+    if i < 10 goto lp1
+
+    it = iter h
+    ar = new ['ResizablePMCArray']
+    i = 20
+lp2:
+    unless it goto ex
+    k = shift it
+    v = h[k]
+    push ar, v
+    if i == 29 goto no_add
+    $I0 = i + 65
+    k = chr $I0
+    h[k] = i
+    inc i
+no_add:
+    goto lp2
+ex:
+    ar."sort"()
+    i = elements ar
+lp3:
+    dec i
+    v = ar[i]
+    print v
+    print "_"
+    if i goto lp3
+    print "\n"
+.end
+# or some such output
@@ -0,0 +1,15 @@
+.sub main :main
+    .local pmc ar, it
+    ar= new ['ResizablePMCArray']
+    push ar, 'pi'
+    push ar, 3
+    push ar, 6.28
+
+    it = iter ar
+lp: unless it, ex
+    $P0 = shift it
+    print $P0
+    print "\n"
+    branch lp
+ex:
+.end
@@ -0,0 +1,7 @@
+.sub main :main
+    .local pmc ar, i1, i2
+    ar = new ['ResizableIntegerArray']
+    push ar, 17
+    i1 = iter ar
+    clone i2, i1
+.end
@@ -0,0 +1,28 @@
+.sub main :main
+    .local pmc ar, i1, i2
+    ar = new ['ResizableIntegerArray']
+    push ar, 17
+    push ar, 42
+
+    i1 = iter ar
+    clone i2, i1
+
+    .local pmc temp
+
+    shift temp, i1
+    unless temp == 17 goto fail
+
+    shift temp, i1
+    unless temp == 42 goto fail
+
+    shift temp, i2
+    unless temp == 17 goto fail
+
+    shift temp, i2
+    unless temp == 42 goto fail
+
+    say "ok"
+    end
+fail:
+    say "not ok"
+.end
@@ -0,0 +1,23 @@
+.sub main :main
+    .local pmc ar, i1, i2
+    .local pmc temp
+    ar = new ['ResizableIntegerArray']
+    push ar, 1
+    push ar, 2
+    i1 = iter ar
+
+    shift temp, i1
+    unless temp == 1 goto fail
+
+    clone i2, i1
+    shift temp, i1
+    unless temp == 2 goto fail
+
+    shift temp, i2
+    unless temp == 2 goto fail
+
+    say "ok"
+    end
+fail:
+    say "not ok"
+.end
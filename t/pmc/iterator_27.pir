@@ -0,0 +1,25 @@
+.sub main :main
+    .local pmc ar, i1, i2
+    .local pmc temp
+    temp = new ['Integer']
+    ar   = new ['ResizableIntegerArray']
+    push ar, 1
+    i1 = iter ar
+
+    # i1 and i2 now "point" to the same element of the same array.
+    clone i2, i1
+
+    # Modify the array ...
+    temp = 17
+    i1   = temp
+
+    # Now read back the modified value ...
+    shift temp, i2
+
+    unless temp == 17 goto fail
+
+    say "ok"
+    end
+fail:
+    say "not ok"
+.end
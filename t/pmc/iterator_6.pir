@@ -0,0 +1,20 @@
+.sub _main :main
+    .local pmc str, str2, iterate
+    str = new ['String']
+    str = '0hey'
+    iterate = iter str
+
+    str2 = iterate.'next'()
+    eq str2, '0', OK1
+    print "not "
+OK1:print "ok 1 - next returns first character\n"
+
+    eq str, '0hey', OK2
+    print "not "
+OK2:print "ok 2 - does not touch input\n"
+
+    str2 = iterate.'next'()
+    eq str2, 'h', OK3
+    print "not "
+OK3:print "ok 3 - next returns second character\n"
+.end
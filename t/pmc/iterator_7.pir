@@ -0,0 +1,21 @@
+
+.sub _main :main
+    .local pmc myiter, inst
+    myiter = subclass 'Iterator', 'MyIter'
+    #myiter = newclass 'MyIter'
+    inst = new ['MyIter']
+
+    push_eh THROWN
+    inst = 1
+    print "not "
+THROWN:
+    pop_eh
+    print "ok\n"
+.end
+
+.namespace ["MyIter"]
+.sub init :vtable
+    print "init\n"
+    .return()
+.end
+
@@ -0,0 +1,18 @@
+## Compare this to the previous example.
+.sub foo :multi(_, Float)
+    .param pmc first
+    .param pmc second
+    print "(_, Float) method:  "
+    print first
+    print ', '
+    print second
+    print "\n"
+.end
+.sub main :main
+    $P0 = new ['Float']
+    $P0 = 9.5
+    foo(1, $P0)
+    $P1 = new ['Integer']
+    $P1 = 3
+    foo(1, $P1)
+.end
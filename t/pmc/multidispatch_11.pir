@@ -0,0 +1,20 @@
+.sub main :main
+    p("ok 1\n")
+    p("-twice", "ok 2\n")
+.end
+
+.sub p :multi(string)
+    .param string s
+    print s
+.end
+
+.sub p :multi(string, string)
+    .param string opt
+    .param string s
+    if opt != '-twice' goto no_twice
+    print s
+    print s
+    .return()
+no_twice:
+    print s
+.end
@@ -0,0 +1,15 @@
+.sub main :main
+    p("ok 1\n")
+    p(42)
+.end
+
+.sub p :multi(string)
+    .param string s
+    print s
+.end
+
+.sub p :multi(int)
+    .param int i
+    print i
+    print "\n"
+.end
@@ -0,0 +1,32 @@
+.sub main :main
+    $P0 = new ['String']
+    $P0 = "ok 1\n"
+    p($P0)
+
+    .local pmc pstring
+    pstring = subclass 'String', 'PString'
+    $P1 = new ['PString']
+    $P1 = "ok 2\n"
+    p($P1)
+
+    $P0 = subclass "PString", "Xstring"
+    $P0 = new ['Xstring']
+    $P0 = "ok 3\n"
+    $P1 = subclass "String", "Ystring"
+    $P1 = new ['Ystring']
+    $P1 = "ok 4\n"
+    p($P0)
+    p($P1)
+.end
+
+.sub p :multi("String")
+    .param pmc p
+    print "String "
+    print p
+.end
+
+.sub p :multi("PString")
+    .param pmc p
+    print "PSt "
+    print p
+.end
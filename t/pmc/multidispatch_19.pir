@@ -0,0 +1,44 @@
+
+.sub main :main
+    $P0 = new ['String']
+    $P0 = "ok 1\n"
+    $P1 = new ['PerlInt']
+    $P1 = "ok 2\n"
+    p($P0)
+    p($P1)
+    $P0 = new ['PerlInt']
+    $P0 = 42
+    p($P0)
+    $P0 = new ['PerlInt']
+    $P0 = 43
+    q($P0)
+.end
+
+.namespace []
+
+.sub p :multi(String)
+    .param pmc p
+    print "String "
+    print p
+.end
+
+.sub p :multi(PString)
+    .param pmc p
+    print "PSt "
+    print p
+.end
+
+.sub p :multi(_)
+    .param pmc p
+    print "Any    "
+    print p
+    print "\n"
+.end
+
+.sub q :multi(pmc)
+    .param pmc p
+    print "Any    "
+    print p
+    print "\n"
+.end
+
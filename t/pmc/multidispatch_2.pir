@@ -0,0 +1,27 @@
+
+.sub _main :main
+    .local pmc add
+    add = get_global "add"
+    add_multi "add", "Integer,Integer,Integer", add
+
+    $P0 = new ['Integer']
+    $P1 = new ['Integer']
+    $P2 = new ['Integer']
+    $P1 = 1
+    $P2 = 1
+    $P0 = $P1 + $P2
+    print $P0
+    print "\n"
+.end
+
+.sub add
+    .param pmc left
+    .param pmc right
+    .param pmc lhs
+    $I0 = left
+    $I1 = right
+    $I2 = $I0 + $I1
+    inc $I2
+    lhs = $I2
+    .return (lhs)
+.end
@@ -0,0 +1,13 @@
+.sub main :main
+    .local pmc d, l, r, a
+    d = new ['Integer']
+    l = new ['Integer']
+    r = new ['Float']
+    l = 3
+    r = 39.42
+    a = get_root_global ["MULTI"], "add"
+    d = a(l, r, d)
+    print d
+    print "\n"
+    end
+.end
@@ -0,0 +1,11 @@
+.sub main :main
+    .local pmc d, l, r
+    l = new ['Integer']
+    r = new ['Integer']
+    l = 3
+    r = 39
+    d = l."add"(r, d)
+    print d
+    print "\n"
+    end
+.end
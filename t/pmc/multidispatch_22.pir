@@ -0,0 +1,12 @@
+.sub main :main
+    .local pmc d, l, r
+    .local pmc pint
+    pint = subclass 'Integer', 'PInt'
+    l = new ['PInt']
+    r = new ['PInt']
+    l = 3
+    r = 39
+    d = l."add"(r, d)
+    print d
+    print "\n"
+.end
@@ -0,0 +1,19 @@
+.sub main :main
+    .local pmc d, l, r, m
+    d = new ['Integer']
+    l = new ['Integer']
+    r = new ['Float']
+    l = 3
+    r = 39.42
+    m = get_global ['scalar'], "add"
+    d = m(r, l, d)
+    print d
+    print "\n"
+    r = new ['Integer']
+    r = 39
+    m = get_global ['Integer'], "add"
+    d = m(r, l, d)
+    print d
+    print "\n"
+    end
+.end
@@ -0,0 +1,21 @@
+.sub main :main
+    .local pmc d, l, r, cl
+    cl = subclass "Integer", "AInt"
+    d = new ['AInt']
+    l = new ['AInt']
+    r = new ['AInt']
+    l = 4
+    r = 38
+    print l
+    print "\n"
+    print r
+    print "\n"
+    # dispatches to Parrot_Integer_add_Integer
+    add d, l, r
+    print d
+    print "\n"
+    add l, r
+    print l
+    print "\n"
+.end
+
@@ -0,0 +1,23 @@
+.sub main :main
+    $P0 = subclass "Integer", "AInt"
+    $P0 = new ['AInt']
+    $P1 = new ['Integer']
+    set $P0, 6
+    set $P1, 2
+
+    $P2 = add  $P0, $P1
+    print $P2
+    print "\n"
+.end
+.namespace ["AInt"]
+.sub add :multi(AInt, Integer, PMC)
+    .param pmc l
+    .param pmc r
+    .param pmc d
+    print l
+    print r
+    print "\n"
+    d = new ['Integer']
+    d = 2
+    .return(d)
+.end
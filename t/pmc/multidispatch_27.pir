@@ -0,0 +1,11 @@
+.sub main :main
+    load_bytecode "/tmp/4JJnfZgnWk.pir"
+    $P0 = subclass "Integer", "AInt"
+    $P0 = new ['AInt']
+    $P1 = new ['Integer']
+    set $P0, 6
+    set $P1, 2
+
+    $P2 = add $P0, $P1
+    say $P2
+.end
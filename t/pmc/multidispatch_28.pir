@@ -0,0 +1,31 @@
+.namespace ['Foo']
+
+.sub bar :method :multi(Foo, string)
+    .param string arg
+    print "string\n"
+.end
+
+.sub bar :method :multi(Foo, pmc)
+    .param pmc arg
+    print "PMC\n"
+.end
+
+.sub bar :method :multi(Foo)
+    print "nothing\n"
+.end
+
+.namespace []
+
+.sub main :main
+    newclass $P0, 'Foo'
+
+    $P0 = new ['Foo']
+
+    $P0.'bar'('Bar!')
+
+    $P1 = new ['String']
+    $P1 = "Bar!"
+    $P0.'bar'($P1)
+
+    $P0.'bar'()
+.end
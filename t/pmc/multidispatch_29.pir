@@ -0,0 +1,51 @@
+.sub main :main
+    .local pmc d, l, r, cl
+    cl = newclass "AInt"
+    addattribute cl, ".i"
+    d = new ['AInt']
+    l = new ['AInt']
+    r = new ['AInt']
+    .local pmc func
+    .local string typ
+    func = find_multi "add", "Float,Float,PMC"
+    $S0 = typeof l
+    typ = $S0 . ","
+    typ .= $S0
+    typ .= ","
+    typ .= $S0
+    add_multi "add", typ, func
+    l = 4
+    r = 38
+    print l
+    print "\n"
+    print r
+    print "\n"
+    add d, l, r
+    print d
+    print "\n"
+.end
+.namespace ["AInt"]
+.sub init :vtable :method
+    $P0 = new ['Integer']
+    setattribute self, ".i", $P0
+.end
+.sub set_integer_native :vtable :method
+    .param int i
+    $P0 = getattribute self, ".i"
+    $P0 = i
+.end
+.sub set_number_native :vtable :method
+    .param num f
+    $P0 = getattribute self, ".i"
+    $P0 = f
+.end
+.sub get_string :vtable :method
+    $P0 = getattribute self, ".i"
+    $S0 = $P0
+    .return ($S0)
+.end
+.sub get_number :vtable :method
+    $P0 = getattribute self, ".i"
+    $N0 = $P0
+    .return ($N0)
+.end
@@ -0,0 +1,23 @@
+
+.sub _main :main
+    .local pmc divide
+    divide = get_global "Integer_divide_Integer"
+    add_multi "divide", "Integer,Integer,Integer", divide
+
+    $P0 = new ['Integer']
+    $P1 = new ['Integer']
+    $P2 = new ['Integer']
+    $P1 = 10
+    $P2 = 3
+    $P0 = $P1 / $P2
+    print $P0
+    print "\n"
+.end
+
+.sub Integer_divide_Integer
+    .param pmc left
+    .param pmc right
+    .param pmc lhs
+    lhs = 42
+    .return(lhs)
+.end
@@ -0,0 +1,14 @@
+.sub main :main
+    $P0 = find_name "foo"
+    $S0 = typeof $P0
+    print $S0
+    print "\n"
+.end
+.sub foo :method :multi(string)
+    .param pmc x
+    print "  foo\n"
+.end
+.sub foo :method :multi(pmc)
+    .param pmc x
+    print "  foo\n"
+.end
@@ -0,0 +1,12 @@
+.sub main :main
+    foo('xx')
+    foo()
+    foo('xx')
+.end
+.sub foo :multi(string)
+    .param pmc x
+    print "foo string\n"
+.end
+.sub foo :multi()
+    print "foo\n"
+.end
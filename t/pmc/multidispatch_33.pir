@@ -0,0 +1,22 @@
+.HLL 'Perl6'
+.sub main :main
+    $P0 = new ['Integer']
+    $P0 = 3
+    $P9 = 'foo'($P0)
+
+    $P0 = new ['ResizablePMCArray']
+    push $P0, 4
+    $P1 = new ['String']
+    $P1 = 'hello'
+    $P9 = 'foo'($P0, $P1)
+.end
+
+.sub 'foo' :multi(Integer)
+    print "foo(Integer)\n"
+    .return (0)
+.end
+
+.sub 'foo' :multi(ResizablePMCArray, _)
+    print "foo(ResizablePMCArray,_)\n"
+    .return (0)
+.end
@@ -0,0 +1,28 @@
+# see also 'rt #39173
+.sub main :main
+    .local pmc int_pmc
+    int_pmc = new ['Integer']
+    int_pmc = 3
+
+    .local pmc args
+    args = new ['ResizablePMCArray']
+    push args, int_pmc
+    'foo'( args :flat )
+
+    .local pmc string_pmc
+    string_pmc = new ['String']
+    string_pmc = 'hello'
+
+    args = new ['ResizablePMCArray']
+    push args, string_pmc
+    'foo'( args :flat )
+    end
+.end
+
+.sub 'foo' :multi(Integer)
+    print "foo(Integer)\n"
+.end
+
+.sub 'foo' :multi(String)
+    print "foo(String)\n"
+.end
@@ -0,0 +1,15 @@
+.sub main :main
+    .local pmc class
+    newclass class, [ 'Some'; 'Class' ]
+
+    .local pmc instance
+    instance = new [ 'Some'; 'Class' ]
+
+    .local string name
+    name = typeof instance
+
+    print "Type: "
+    print name
+    print "\n"
+    end
+.end
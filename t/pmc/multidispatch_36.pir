@@ -0,0 +1,18 @@
+.sub main :main
+    .local pmc class
+    newclass class, [ 'Some'; 'Class' ]
+
+    .local pmc instance
+    instance = new [ 'Some'; 'Class' ]
+
+    foo( instance )
+    end
+.end
+
+.sub 'foo' :multi( [ 'Some'; 'Class' ])
+    print "Called multi for class\n"
+.end
+
+.sub 'foo' :multi(_)
+    print "Called wrong multi\n"
+.end
@@ -0,0 +1,15 @@
+.sub utf8:"\u7777" :multi(string)
+  .param pmc arg
+  print 'String:'
+  say arg
+.end
+.sub utf8:"\u7777" :multi(int)
+  .param pmc arg
+  print 'Int:'
+  say arg
+.end
+
+.sub main :main
+  utf8:"\u7777"('what')
+  utf8:"\u7777"(23)
+.end
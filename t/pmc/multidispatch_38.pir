@@ -0,0 +1,22 @@
+.sub box_me_up :multi(string)
+    .param string first
+    .param pmc    second
+
+    .local string promoted_type
+    promoted_type = typeof second
+    print "BMU autobox type: "
+    print promoted_type
+    print "\n"
+.end
+
+.sub box_me_up :multi()
+    print "BMU no autobox, so sad\n"
+.end
+
+.sub box_me_up :multi(int, int)
+    print "BMU inty, so bad\n"
+.end
+
+.sub main :main
+    box_me_up( 'foo', 'bar' )
+.end
@@ -0,0 +1,22 @@
+.sub main :main
+  .local pmc asub
+  asub = get_global 'main'
+
+  foo('world', asub) # should call :multi(_, Sub)
+.end
+
+.sub foo :multi(_, Sub)
+  .param pmc x
+  .param pmc y
+  print x
+  print " "
+  say ":multi(_, Sub)"
+.end
+
+.sub foo :multi(Integer, Sub)
+  .param int x
+  .param pmc y
+  print x
+  print " "
+  say ":multi(int, Sub)"
+.end
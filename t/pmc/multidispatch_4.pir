@@ -0,0 +1,22 @@
+
+.sub _main :main
+    .local pmc comp
+    comp = get_global "Float_cmp_Integer"
+    add_multi "cmp", "Float,Integer", comp
+
+    $P1 = new ['Float']
+    $P2 = new ['Integer']
+    $P1 = 47.11
+    $P2 = 47
+    $I0 = cmp $P1, $P2   # XXX cmp calls cmp_num
+    print $I0
+    print "\n"
+.end
+
+.sub Float_cmp_Integer
+    .param pmc left
+    .param pmc right
+    .begin_return
+    .set_return -42
+    .end_return
+.end
@@ -0,0 +1,37 @@
+.sub main :main
+    $P0 = new ['Integer']
+    $P0 = 3
+    'foo'($P0)
+    'foo'(2)
+    'foo'("1")
+    $P0 = new ['String']
+    $P0 = "0"
+    'foo'($P0)
+    $P0 = new ['Hash']
+    'foo'($P0)
+.end
+
+.sub 'foo' :multi(Integer)
+    .param pmc i
+    print "foo(Integer)\n"
+.end
+
+.sub 'foo' :multi(_)
+    .param pmc i
+    print "foo(_)\n"
+.end
+
+.sub 'foo' :multi(int)
+    .param int i
+    print "foo(int)\n"
+.end
+
+.sub 'foo' :multi(String)
+    .param pmc i
+    print "foo(String)\n"
+.end
+
+.sub 'foo' :multi(string)
+    .param string i
+    print "foo(string)\n"
+.end
@@ -0,0 +1,11 @@
+
+.sub main :main
+    null $P0
+    foo($P0)
+.end
+.sub foo :multi(String)
+    say "string"
+.end
+.sub foo :multi(_)
+    say "any"
+.end
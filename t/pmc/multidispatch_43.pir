@@ -0,0 +1,29 @@
+
+.sub 'main' :main
+    foo('Hello')
+    foo('Goodbye', 2)
+    foo(1)
+    foo(100, 200)
+.end
+
+.sub foo :multi(string)
+    .param string s
+    .param int    i      :optional
+    .param int    have_i :opt_flag
+
+    say s
+    unless have_i goto done
+    say i
+  done:
+.end
+
+.sub foo :multi(int)
+    .param int x
+    .param int i      :optional
+    .param int have_i :opt_flag
+
+    say x
+    unless have_i goto done
+    say i
+  done:
+.end
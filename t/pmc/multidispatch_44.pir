@@ -0,0 +1,42 @@
+
+.sub 'main' :main
+    foo('Hello')
+    foo('Goodbye', 2)
+    foo(1)
+    foo(100, 200)
+    foo(77.7)
+    foo(77.7, 88.8)
+.end
+
+.sub foo :multi(String)
+    .param pmc s
+    .param pmc i      :optional
+    .param int have_i :opt_flag
+
+    say s
+    unless have_i goto done
+    say i
+  done:
+.end
+
+.sub foo :multi(Integer)
+    .param pmc x
+    .param pmc i      :optional
+    .param int have_i :opt_flag
+
+    say x
+    unless have_i goto done
+    say i
+  done:
+.end
+
+.sub foo :multi(Float)
+    .param pmc x
+    .param pmc i      :optional
+    .param int have_i :opt_flag
+
+    say x
+    unless have_i goto done
+    say i
+  done:
+.end
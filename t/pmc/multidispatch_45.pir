@@ -0,0 +1,51 @@
+
+.sub 'main' :main
+    foo('Hello', 'Hi')
+    foo('Goodbye', 'Ta ta', 2)
+    foo(1, 2)
+    foo(100, 200, 400)
+    foo(77.7, 88.8)
+    foo(77.7, 88.8, 99.9)
+.end
+
+.sub foo :multi(String, String)
+    .param pmc x
+    .param pmc y
+    .param pmc i      :optional
+    .param int have_i :opt_flag
+
+    print x
+    print y
+    unless have_i goto done
+    print i
+  done:
+    say ''
+.end
+
+.sub foo :multi(Integer, Integer)
+    .param pmc x
+    .param pmc y
+    .param pmc i      :optional
+    .param int have_i :opt_flag
+
+    print x
+    print y
+    unless have_i goto done
+    print i
+  done:
+    say ''
+.end
+
+.sub foo :multi(Float, Float)
+    .param pmc x
+    .param pmc y
+    .param pmc i      :optional
+    .param int have_i :opt_flag
+
+    print x
+    print y
+    unless have_i goto done
+    print i
+  done:
+    say ''
+.end
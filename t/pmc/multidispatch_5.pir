@@ -0,0 +1,22 @@
+
+.sub _main :main
+    .local pmc comp
+    comp = get_global "Float_cmp_Integer"
+    add_multi "cmp_num", "Float,Integer", comp
+    $P0 = find_multi "cmp_num", "Float,Integer"
+    if_null $P0, nok
+    print "ok 1\n"
+    ne_addr $P0, comp, nok
+    print "ok 2\n"
+    end
+nok:
+    print "not ok\n"
+.end
+
+.sub Float_cmp_Integer
+    .param pmc left
+    .param pmc right
+    .begin_return
+    .set_return -42
+    .end_return
+.end
@@ -0,0 +1,28 @@
+
+.sub _main :main
+    .local pmc comp
+    comp = get_global "Float_cmp_Integer"
+    add_multi "cmp_num", "Float,Integer", comp
+    $P0 = find_multi "cmp_num", "Float,Integer"
+    if_null $P0, nok
+    print "ok 1\n"
+    ne_addr $P0, comp, nok
+    print "ok 2\n"
+    $P1 = new ['Float']
+    $P2 = new ['Integer']
+    $P1 = 47.11
+    $P2 = 47
+    $I0 = $P0($P1, $P2)
+    print $I0
+    print "\n"
+    end
+nok:
+    print "not ok\n"
+.end
+.sub Float_cmp_Integer
+    .param pmc left
+    .param pmc right
+    .begin_return
+    .set_return -42
+    .end_return
+.end
@@ -0,0 +1,14 @@
+.sub _main :main
+    .local pmc divide
+    load_bytecode "/tmp/DUzv_BB4J0.pir"
+    divide = get_global "Integer_divide_Integer"
+    add_multi "divide", "Integer,Integer,Integer", divide
+
+    $P0 = new ['Integer']
+    $P1 = new ['Integer']
+    $P2 = new ['Integer']
+    $P1 = 10
+    $P2 = 3
+    $P0 = $P1 / $P2
+    say $P0
+.end
@@ -0,0 +1,31 @@
+
+.sub main :main
+    .local pmc F, B, f, b, m, s
+    newclass F, "Foo"
+    f = new ['Foo']
+    newclass B, "Bar"
+    b = new ['Bar']
+    # create a multi the hard way
+    ## m = new MultiSub
+    ## s = get_global "Foo", "foo"
+    ## push m, s
+    ## s = get_global "Bar", "foo"
+    ## push m, s
+    ## set_global "foo", m
+    print "calling foo(f, b)\n"
+    foo(f, b)
+    print "calling foo(b, f)\n"
+    foo(b, f)
+.end
+
+.sub foo :multi(Foo, Bar)
+    .param pmc x
+    .param pmc y
+    print "  Foo::foo\n"
+.end
+
+.sub foo :multi(Bar, Foo)
+    .param pmc x
+    .param pmc y
+    print "  Bar::foo\n"
+.end
@@ -0,0 +1,4 @@
+.sub main :main
+    load_bytecode "temp_a.pbc"
+    print "ok 3\n"
+.end
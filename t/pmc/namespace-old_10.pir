@@ -0,0 +1,10 @@
+.sub main :main
+    .local pmc ns
+    ns = get_hll_namespace ['Foo']
+    ns = ns.'get_parent'()
+    print ns
+    print "\n"
+.end
+.namespace ['Foo']
+.sub dummy
+.end
@@ -0,0 +1,14 @@
+.namespace ['']
+
+.sub print_ok
+  print "ok\n"
+  .return()
+.end
+
+.namespace ['foo']
+
+.sub main :main
+  $P0 = get_hll_global [''], 'print_ok'
+  $P0()
+  end
+.end
@@ -0,0 +1,16 @@
+.namespace []
+
+.sub print_ok
+  print "ok\n"
+  .return()
+.end
+
+.namespace ['foo']
+
+.sub main :main
+  $P0 = new ['ResizablePMCArray']
+  $P0 = 0
+  $P0 = get_hll_global $P0, 'print_ok'
+  $P0()
+  end
+.end
@@ -0,0 +1,16 @@
+.namespace ['']
+
+.sub print_ok
+  print "ok\n"
+  .return()
+.end
+
+.namespace ['foo']
+
+.sub main :main
+  $P1 = new ['ResizableStringArray']
+  $P1[0] = ''
+  $P1 = get_hll_global $P1, 'print_ok'
+  $P1()
+  end
+.end
@@ -0,0 +1,13 @@
+.sub main :main
+    .local pmc f
+    f = get_hll_global ['Foo'], 'dummy'
+    f()
+.end
+.namespace ['Foo']
+.sub dummy
+    .local pmc interp, ns_caller
+    interp = getinterp
+    ns_caller = interp['namespace'; 1]
+    print ns_caller
+    print "\n"
+.end
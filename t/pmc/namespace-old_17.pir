@@ -0,0 +1,9 @@
+.sub main :main
+    .local pmc root_ns
+    root_ns = get_root_namespace
+    .local int is_defined
+    is_defined = defined root_ns
+    unless is_defined goto NO_NAMESPACE_FOUND
+        print "Found root namespace.\n"
+    NO_NAMESPACE_FOUND:
+.end
@@ -0,0 +1,12 @@
+.sub main :main
+    .local pmc foo_ns
+    foo_ns = get_root_namespace [ "foo" ]
+    .local int is_defined
+    is_defined = defined foo_ns
+    unless is_defined goto NO_NAMESPACE_FOUND
+        print "Found root namespace 'foo'.\n"
+    NO_NAMESPACE_FOUND:
+.end
+.HLL 'Foo'
+.sub dummy
+.end
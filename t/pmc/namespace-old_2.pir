@@ -0,0 +1,20 @@
+# initial storage of _tcl global variable...
+
+.HLL '_Tcl'
+
+.sub huh
+  $P0 = new ['Integer']
+  $P0 = 3.14
+  set_global '$variable', $P0
+.end
+
+# start running HLL language
+.HLL 'Tcl'
+
+.sub foo :main
+  huh()
+  $P1 = get_root_namespace ['_tcl']
+  $P2 = $P1['$variable']
+  print $P2
+  print "\n"
+.end
@@ -0,0 +1,11 @@
+.sub main :main
+    .local pmc foo_ns
+    foo_ns = get_root_namespace [ "Foo" ]
+    .local int is_defined
+    is_defined = defined foo_ns
+    if is_defined goto NAMESPACE_FOUND
+        print "Didn't find root namespace 'Foo'.\n"
+    NAMESPACE_FOUND:
+.end
+
+.namespace [ "NotFoo" ]
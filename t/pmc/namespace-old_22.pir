@@ -0,0 +1,61 @@
+.sub create_nested_key
+    .param string name
+    .param pmc other_names :slurpy
+
+    .local pmc key
+    key = new ['Key']
+    key = name
+
+    .local int elem
+    elem = other_names
+
+    if elem goto nested
+    .return( key )
+
+  nested:
+    .local pmc tail
+    tail = create_nested_key(other_names :flat)
+    push key, tail
+
+    .return( key )
+.end
+
+
+.sub main :main
+    .local pmc root_ns
+    root_ns = get_namespace
+
+    .local pmc child_ns
+    child_ns = new ['NameSpace']
+    root_ns.'add_namespace'( 'Nested', child_ns )
+
+    .local pmc grandchild_ns
+    grandchild_ns = new ['NameSpace']
+    child_ns.'add_namespace'( 'Grandkid', grandchild_ns )
+
+    .local pmc great_grandchild_ns
+    great_grandchild_ns = new ['NameSpace']
+    grandchild_ns.'add_namespace'( 'Greatgrandkid', great_grandchild_ns )
+
+    .local pmc parent
+    parent = great_grandchild_ns.'get_parent'()
+    print_ns_name( parent )
+
+    parent = parent.'get_parent'()
+    print_ns_name( parent )
+
+    parent = parent.'get_parent'()
+    print_ns_name( parent )
+.end
+
+.sub print_ns_name
+    .param pmc namespace
+
+    .local pmc ns
+    ns = namespace.'get_name'()
+
+    .local string ns_name
+    ns_name = join ';', ns
+    print ns_name
+    print "\n"
+.end
@@ -0,0 +1,28 @@
+.sub main :main
+    .local pmc ns_child
+    ns_child = subclass 'NameSpace', 'NSChild'
+
+    .local pmc child
+    child = new ['NSChild']
+
+    .local pmc root_ns
+    root_ns = get_namespace
+
+    root_ns.'add_namespace'( 'Really nested', child )
+
+    .local pmc not_a_ns
+    not_a_ns = new ['Integer']
+
+    push_eh _invalid_ns
+    root_ns.'add_namespace'( 'Nested', not_a_ns )
+    end
+
+_invalid_ns:
+    .local pmc exception
+    .local string message
+    .get_results( exception )
+
+    message = exception
+    print message
+    print "\n"
+.end
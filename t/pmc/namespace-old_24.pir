@@ -0,0 +1,70 @@
+.sub create_nested_key
+    .param string name
+    .param pmc other_names :slurpy
+
+    .local pmc key
+    key = new ['Key']
+    key = name
+
+    .local int elem
+    elem = other_names
+
+    if elem goto nested
+    .return( key )
+
+  nested:
+    .local pmc tail
+    tail = create_nested_key(other_names :flat)
+    push key, tail
+
+    .return( key )
+.end
+
+
+.sub 'main' :main
+    .local pmc report_ns
+    report_ns = get_global 'report_namespace'
+
+    .local pmc key
+    key = create_nested_key( 'Parent' )
+
+    .local pmc parent_ns
+    parent_ns = get_namespace key
+    parent_ns.'add_sub'( 'report_ns', report_ns )
+
+    key = create_nested_key( 'Parent', 'Child' )
+
+    .local pmc child_ns
+    child_ns = get_namespace key
+    child_ns.'add_sub'( 'report_ns', report_ns )
+
+    .local pmc report_namespace
+    report_namespace = get_global [ 'Parent' ], 'report_ns'
+    report_namespace()
+
+    report_namespace = get_global [ 'Parent'; 'Child' ], 'report_ns'
+    report_namespace()
+.end
+
+.sub 'report_namespace'
+    .local pmc namespace
+    namespace = get_namespace
+
+    .local pmc ns
+    ns = namespace.'get_name'()
+
+    .local string ns_name
+    ns_name = join ';', ns
+    print ns_name
+    print "\n"
+.end
+
+.namespace [ 'Parent' ]
+
+.sub dummy
+.end
+
+.namespace [ 'Parent'; 'Child' ]
+
+.sub dummy
+.end
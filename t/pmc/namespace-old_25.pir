@@ -0,0 +1,33 @@
+.sub main :main
+    .local pmc s_child
+    s_child = subclass 'Sub', 'SubChild'
+
+    .local pmc child
+    child = new ['SubChild']
+
+    .local pmc root_ns
+    root_ns = get_namespace
+
+    root_ns.'add_sub'( 'child', child )
+    print "Added sub child\n"
+
+    child = new ['Coroutine']
+    root_ns.'add_sub'( 'coroutine', child )
+    print "Added coroutine\n"
+
+    .local pmc not_a_sub
+    not_a_sub = new ['Integer']
+
+    push_eh _invalid_sub
+    root_ns.'add_sub'( 'Nested', not_a_sub )
+    end
+
+_invalid_sub:
+    .local pmc exception
+    .local string message
+    .get_results( exception )
+
+    message = exception
+    print message
+    print "\n"
+.end
@@ -0,0 +1,66 @@
+.sub create_nested_key
+    .param string name
+    .param pmc other_names :slurpy
+
+    .local pmc key
+    key = new ['Key']
+    key = name
+
+    .local int elem
+    elem = other_names
+
+    if elem goto nested
+    .return( key )
+
+  nested:
+    .local pmc tail
+    tail = create_nested_key(other_names :flat)
+    push key, tail
+
+    .return( key )
+.end
+
+
+.sub 'main' :main
+    .local pmc foo
+    foo = new ['String']
+    foo = 'Foo'
+
+    .local pmc bar
+    bar = new ['String']
+    bar = 'Bar'
+
+    .local pmc key
+    key = create_nested_key( 'Parent' )
+
+    .local pmc parent_ns
+    parent_ns = get_namespace key
+    parent_ns.'add_var'( 'foo', foo )
+
+    key = create_nested_key( 'Parent', 'Child' )
+
+    .local pmc child_ns
+    child_ns = get_namespace key
+    child_ns.'add_var'( 'bar', bar )
+
+    .local pmc my_var
+    my_var = get_global [ 'Parent' ], 'foo'
+    print "Foo: "
+    print my_var
+    print "\n"
+
+    my_var = get_global [ 'Parent'; 'Child' ], 'bar'
+    print "Bar: "
+    print my_var
+    print "\n"
+.end
+
+.namespace [ 'Parent' ]
+
+.sub dummy
+.end
+
+.namespace [ 'Parent'; 'Child' ]
+
+.sub dummy
+.end
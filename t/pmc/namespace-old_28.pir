@@ -0,0 +1,31 @@
+.sub dummy
+.end
+
+.sub main :main
+    .local pmc not_a_ns
+    not_a_ns = new ['ResizablePMCArray']
+
+    set_global 'Not_A_NS', not_a_ns
+
+    .local pmc root_ns
+    root_ns = get_namespace
+    delete_namespace( root_ns, 'dummy' )
+    delete_namespace( root_ns, 'Not_A_NS' )
+.end
+
+.sub delete_namespace
+    .param pmc    root_ns
+    .param string name
+    push_eh _invalid_ns
+    root_ns.'del_namespace'( name )
+
+_invalid_ns:
+    .local pmc exception
+    .local string message
+    .get_results( exception )
+
+    message = exception
+    print message
+    print "\n"
+    .return()
+.end
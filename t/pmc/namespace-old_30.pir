@@ -0,0 +1,22 @@
+.sub main :main
+    .local pmc not_a_ns
+    not_a_ns = new ['ResizablePMCArray']
+
+    set_global 'Not_A_Sub', not_a_ns
+
+    .local pmc root_ns
+    root_ns = get_namespace
+
+    push_eh _invalid_sub
+    root_ns.'del_sub'( 'Not_A_Sub' )
+
+_invalid_sub:
+    .local pmc exception
+    .local string message
+    .get_results( exception )
+
+    message = exception
+    print message
+    print "\n"
+    .return()
+.end
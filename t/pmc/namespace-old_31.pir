@@ -0,0 +1,47 @@
+.sub 'main' :main
+    .local pmc foo
+    foo = new ['String']
+    foo = 'Foo'
+
+    .local pmc bar
+    bar = new ['String']
+    bar = 'Bar'
+
+    set_global [ 'Parent' ],          'Foo', foo
+    set_global [ 'Parent'; 'Child' ], 'Bar', bar
+
+    .local pmc root_ns
+    root_ns = get_namespace
+
+    .local pmc parent_ns
+    parent_ns = root_ns.'find_namespace'( 'Parent' )
+    parent_ns.'del_var'( 'Foo' )
+
+    .local pmc child_ns
+    child_ns = parent_ns.'find_namespace'( 'Child' )
+    child_ns.'del_var'( 'Bar' )
+
+    .local pmc my_var
+    my_var = get_global [ 'Parent' ], 'Foo'
+    if_null my_var, TEST_CHILD_VAR
+    print "Parent Foo exists: "
+    print my_var
+    print "\n"
+
+  TEST_CHILD_VAR:
+    my_var = get_global [ 'Parent'; 'Child' ], 'Bar'
+    if_null my_var, ALL_DONE
+    print "Child Bar exists: "
+    print my_var
+    print "\n"
+
+  ALL_DONE:
+.end
+
+.namespace [ 'Parent' ]
+
+.sub dummy
+.end
+
+.namespace [ 'Parent'; 'Child' ]
+
@@ -0,0 +1,12 @@
+.sub 'main' :main
+    $P0 = newclass 'Override'
+    $P1 = new ['Override']
+    $P2 = find_method $P1, 'foo'
+.end
+
+.namespace [ 'Override' ]
+
+.sub 'find_method' :vtable
+    .param string method
+    say "Finding method"
+.end
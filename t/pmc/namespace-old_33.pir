@@ -0,0 +1,25 @@
+.sub main :main
+     $P0 = new ['String']
+     $P0 = "Ook...BANG!\n"
+     set_root_global [ "DUMMY"; "X"; "Y" ], "Explosion", $P0
+
+     $P1 = new ['Integer']
+     $P1 = 0
+     set_root_global [ "DUMMY"; "X"; "Y" ], "T0", $P0
+
+     .local pmc dummy_x_y_ns, it, res
+     dummy_x_y_ns = get_root_namespace [ "DUMMY"; "X"; "Y" ]
+     it   = iter dummy_x_y_ns
+     res  = new ['ResizablePMCArray']
+loop:
+     unless it goto loop_end
+     $S0 = shift it
+     push res, $S0
+     goto loop
+loop_end:
+
+     res.'sort'()
+     $S0 = join ' ', res
+     say $S0
+
+.end
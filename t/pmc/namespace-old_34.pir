@@ -0,0 +1,5 @@
+.sub 'main' :main
+    $P1 = new ['NameSpace']
+    set_args '(0)', $P1
+    tailcallmethod $P1, 'bob'
+.end
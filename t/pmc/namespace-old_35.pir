@@ -0,0 +1,27 @@
+.namespace [ 'bar' ]
+
+.sub 'main' :main
+    .local pmc res
+    res = new ['ResizablePMCArray']
+
+    $P0 = get_namespace
+    say $P0
+    $I0 = elements $P0
+    say $I0
+    $P1 = iter $P0
+  L1:
+    unless $P1 goto L2
+    $P2 = shift $P1
+    $S0 = $P2
+    push res, $S0
+    goto L1
+  L2:
+    res.'sort'()
+    $S0 = join "\n", res
+    say $S0
+    say 'OK'
+.end
+
+.sub 'foo'
+    say 'foo'
+.end
@@ -0,0 +1,11 @@
+.HLL 'cromulent'
+
+.sub what :main
+   load_bytecode 'temp_a.pir'
+  .local pmc var
+   var = get_root_namespace
+   var = var['eek']
+   var = var['bark']
+
+    var()
+.end
@@ -0,0 +1,15 @@
+.HLL 'bork'
+.namespace []
+
+.sub a :immediate
+  $P1 = new ['String']
+  $P1 = "ok\n"
+  set_global ['sub_namespace'], "eek", $P1
+.end
+
+.namespace [ 'sub_namespace' ]
+
+.sub whee :main
+ $P1 = get_global 'eek'
+ print $P1
+.end
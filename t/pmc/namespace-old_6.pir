@@ -0,0 +1,17 @@
+.HLL 'A'
+.sub main :main
+    a_foo()
+    load_bytecode "temp_b.pir"
+    .local pmc nsr, nsa, nsb, ar
+    ar = new ['ResizableStringArray']
+    push ar, "b_foo"
+    nsr = get_root_namespace
+    nsa = nsr['a']
+    nsb = nsr['b']
+    nsb."export_to"(nsa, ar)
+    b_foo()
+.end
+
+.sub a_foo
+    print "a_foo\n"
+.end
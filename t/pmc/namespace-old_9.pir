@@ -0,0 +1,18 @@
+.HLL 'A'
+.sub main :main
+    a_foo()
+    load_bytecode "temp_b.pir"
+    .local pmc nsr, nsa, nsb, ar
+    ar = new ['Hash']
+    ar["b_foo"] = "c_foo"
+    nsr = get_root_namespace
+    nsa = nsr['a']
+    nsb = nsr['b']
+    nsb."export_to"(nsa, ar)
+    c_foo()
+    b_foo()
+.end
+
+.sub a_foo
+    print "a_foo\n"
+.end
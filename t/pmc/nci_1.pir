@@ -0,0 +1,18 @@
+.sub test :main
+  .local pmc libnci_test
+  .local int lib_defined
+  libnci_test = loadlib "no_such_library"
+  lib_defined = defined libnci_test
+  if lib_defined goto LIB_DEFINED
+  branch LIB_UNDEFINED
+
+LIB_DEFINED:
+  print "defined\n"
+  branch LIB_END
+
+LIB_UNDEFINED:
+  print "undefined\n"
+  branch LIB_END
+
+LIB_END:
+.end
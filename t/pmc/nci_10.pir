@@ -0,0 +1,29 @@
+.include "datatypes.pasm"
+
+.sub test :main
+
+    # load library
+    .local pmc libnci_test
+    libnci_test = loadlib "libnci_test"
+    unless libnci_test goto NOT_LOADED
+    print "libnci_test was successfully loaded\n"
+
+    # calling a function in libnci_test
+    .local pmc nci_p
+    dlfunc nci_p, libnci_test, "nci_p", "p"
+    .local pmc nci_p_out
+    ( nci_p_out ) = nci_p( )
+
+    # the contained structure pointer
+    .local pmc nci_p_out_decl
+    nci_p_out_decl = new ['ResizablePMCArray']
+    push nci_p_out_decl, .DATATYPE_INT
+    push nci_p_out_decl, 0
+    push nci_p_out_decl, 0
+    assign nci_p_out, nci_p_out_decl
+
+    $I2 = nci_p_out[0]
+    print $I2
+    print "\n"
+NOT_LOADED:
+.end
@@ -0,0 +1,19 @@
+.include "datatypes.pasm"
+
+.sub test :main
+
+  # load library
+  .local pmc libnci_test
+  libnci_test = loadlib "libnci_test"
+  unless libnci_test goto NOT_LOADED
+  print "libnci_test was successfully loaded\n"
+
+  # calling a function in libnci_test
+  .local pmc nci_s
+  dlfunc nci_s, libnci_test, "nci_s", "s"
+  .local int nci_s_out
+  ( nci_s_out ) = nci_s( )
+  print nci_s_out
+  print "\n"
+NOT_LOADED:
+.end
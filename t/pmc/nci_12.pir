@@ -0,0 +1,49 @@
+.include "datatypes.pasm"
+
+.sub test :main
+
+    # load libnci_test.so
+    .local string library_name
+    library_name = 'libnci_test'
+    .local pmc libnci_test
+    libnci_test = loadlib library_name
+    unless libnci_test goto NOT_LOADED
+    print library_name
+    print " was successfully loaded\n"
+
+    # address of nci_dlvar_int
+    .local pmc nci_dlvar_int
+    nci_dlvar_int = dlvar libnci_test, "nci_dlvar_int"
+
+    # the contained structure pointer
+    .local pmc nci_dlvar_int_decl
+    nci_dlvar_int_decl = new ['ResizablePMCArray']
+    push nci_dlvar_int_decl, .DATATYPE_INT
+    push nci_dlvar_int_decl, 0
+    push nci_dlvar_int_decl, 0
+    assign nci_dlvar_int, nci_dlvar_int_decl
+
+    $I2 = nci_dlvar_int[0]
+    print $I2
+    print "\n"
+
+    .local pmc nci_v
+    nci_v = dlfunc libnci_test, "nci_v", "v"
+    nci_v()
+    $I1 = nci_dlvar_int[0]
+    print $I1
+    print "\n"
+    nci_v()
+    $I1 = nci_dlvar_int[0]
+    print $I1
+    print "\n"
+    nci_v()
+    $I1 = nci_dlvar_int[0]
+    print $I1
+    print "\n"
+    nci_v()
+    $I1 = nci_dlvar_int[0]
+    print $I1
+    print "\n"
+NOT_LOADED:
+.end
@@ -0,0 +1,29 @@
+.include "datatypes.pasm"
+
+.sub test :main
+
+    # load libnci_test.so
+    .local string library_name
+    library_name = 'libnci_test'
+    .local pmc libnci_test
+    libnci_test = loadlib library_name
+    unless libnci_test goto NOT_LOADED
+    print library_name
+    say " was successfully loaded"
+
+    # address of nci_dlvar_int
+    .local pmc nci_dlvar_int
+    nci_dlvar_int = dlvar libnci_test, "nci_dlvar_int"
+
+    .local pmc nci_pv
+    nci_pv = dlfunc libnci_test, "nci_pv", "pv"
+    $P0 = nci_pv()
+    unless nci_dlvar_int goto NOT_LOADED
+    say "nci_dlvar_int is a ptr"
+    unless $P0 goto NOT_LOADED
+    say "nci_pv returned non-NULL ptr"
+    if $P0 != nci_dlvar_int goto NOT_LOADED
+    say "nci_pv same ptr as nci_dlvar_int"
+
+NOT_LOADED:
+.end
@@ -0,0 +1,16 @@
+.sub test :main
+    .local string library_name
+    library_name = 'libnci_test'
+    .local pmc libnci_test
+    libnci_test = loadlib  library_name
+    unless libnci_test goto NOT_LOADED
+    print library_name
+    print " was successfully loaded\n"
+    .local pmc twice
+    twice = dlfunc libnci_test, "nci_dd", "dd"
+    .local num r
+    r = twice( -4.128 )
+    print r
+NOT_LOADED:
+    print "\n"
+.end
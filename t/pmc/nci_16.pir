@@ -0,0 +1,19 @@
+.sub test :main
+    .local string library_name
+    library_name = 'libnci_test'
+    .local pmc libnci_test
+    libnci_test = loadlib  library_name
+    unless libnci_test goto NOT_LOADED
+        .local string filename_with_path
+        filename_with_path = libnci_test
+        # depending on the platform, 'filename' has path info or not
+        .local int start_of_filename
+        start_of_filename = index filename_with_path, 'libnci_test'
+        if start_of_filename == -1 goto NOT_LOADED
+            .local string filename
+            filename = substr filename_with_path, start_of_filename
+            print filename
+            print " was successfully loaded"
+    NOT_LOADED:
+    print "\n"
+.end
@@ -0,0 +1,27 @@
+.sub test :main
+  .local pmc libnci_test
+  .local pmc func
+  .local int func_defined
+  libnci_test = loadlib "libnci_test"
+  unless libnci_test goto NOT_LOADED
+  print "libnci_test was successfully loaded\n"
+
+  func = dlfunc libnci_test, "no_such_function", "v"
+  func_defined = defined func
+  if func_defined goto FUNC_DEFINED
+  branch FUNC_UNDEFINED
+
+FUNC_DEFINED:
+  print "defined\n"
+  branch FUNC_END
+
+FUNC_UNDEFINED:
+  print "undefined\n"
+  branch FUNC_END
+
+NOT_LOADED:
+  print "Could not load libnci_test\n"
+  branch FUNC_END
+
+FUNC_END:
+.end
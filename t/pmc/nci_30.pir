@@ -0,0 +1,29 @@
+.include "datatypes.pasm"
+.sub main :main
+    .local pmc struct_ptr
+    $P1      = loadlib "libnci_test"
+    $P0      = dlfunc $P1, "nci_pi", "pi"
+    struct_ptr = $P0(5) # this test function returns a struct { int (*f)(char *) }
+
+    .local pmc sv
+    sv = new [ 'StructView' ], [ .DATATYPE_STRUCT; 1; .DATATYPE_PTR ]
+    .local pmc func_ptr
+    func_ptr = sv[struct_ptr; 0]
+
+    .local pmc func
+    func = new ['NCI']
+    func[ .DATATYPE_INT; .DATATYPE_PTR; .DATATYPE_PTR ] = func_ptr
+    # func["ipP"] = func_ptr
+
+    .local pmc str_to_cstr, free_cstr
+    $P1 = null
+    str_to_cstr = dlfunc $P1, "Parrot_str_to_cstring", 'ppS'
+    free_cstr   = dlfunc $P1, "Parrot_str_free_cstring", 'vp'
+
+    $P1 = getinterp
+    $S0 = "hello call_back"
+    $P2 = str_to_cstr($P1, $S0)
+    $I5 = func($P1, $P2)
+    free_cstr($P2)
+    say $I5
+.end
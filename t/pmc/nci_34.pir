@@ -0,0 +1,31 @@
+
+.include "datatypes.pasm"
+
+.sub test :main
+
+  # load library
+  .local pmc libnci_test
+  libnci_test = loadlib "libnci_test"
+  unless libnci_test goto NOT_LOADED
+  print "libnci_test was successfully loaded\n"
+
+  # calling a function in libnci_test
+  .local pmc nci_pi
+  dlfunc nci_pi, libnci_test, "nci_pi", "pi"
+  .local pmc nci_pi_out
+  ( nci_pi_out ) = nci_pi( 9 )
+
+  # the contained structure pointer
+  .local pmc nci_pi_out_decl
+  nci_pi_out_decl = new ['ResizablePMCArray']
+  push nci_pi_out_decl, .DATATYPE_INT
+  push nci_pi_out_decl, 0
+  push nci_pi_out_decl, 0
+
+  # attach struct initializer
+  assign nci_pi_out, nci_pi_out_decl
+  set $I0, nci_pi_out[0]
+  print $I0
+NOT_LOADED:
+  print "\n"
+.end
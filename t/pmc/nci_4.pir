@@ -0,0 +1,15 @@
+.sub test :main
+    .local string library_name
+    library_name = 'libnci_test'
+    .local pmc libnci_test
+    libnci_test = loadlib library_name
+    unless libnci_test goto NOT_LOADED
+    print "libnci_test was successfully loaded\n"
+    .local pmc func
+    func = dlfunc libnci_test, "nci_dd", "dd"
+    .local int def
+    def = defined func
+    print def
+NOT_LOADED:
+    print "\n"
+.end
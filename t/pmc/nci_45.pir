@@ -0,0 +1,78 @@
+
+
+.include "datatypes.pasm"
+
+.sub test :main
+
+    # this flag will be set by the callback function
+    .local pmc cb_done
+    cb_done = new ['Integer']
+    cb_done = 0
+    set_global "cb_done", cb_done
+
+    # prepare user data
+    .local pmc user_data
+    user_data = new ['Integer']
+    user_data = 42
+
+    # A Sub that can be given to the library
+    # this callback function will eventually by called by the library
+    .const 'Sub' cb = "_call_back"
+    .local pmc cb_wrapped
+    cb_wrapped = new_callback cb, user_data, "vUp"  # Z in pdd16
+    print "created a callback sub\n"
+
+    # now call the external sub, that takes a callback and user data
+    .local pmc libnci_test
+    libnci_test = loadlib "libnci_test"
+    .local pmc nci_cb_D3
+    nci_cb_D3 = dlfunc libnci_test, "nci_cb_D3", "vpP"
+    print "loaded a function that takes a callback\n"
+    nci_cb_D3( cb_wrapped, user_data )
+
+    # callback will be called at any time
+    # so spin a bit
+    .local int sleep_cnt
+    sleep_cnt = 0
+LOOP:
+    sleep_cnt += 1
+    #sleep 0.01
+    .local pmc callback_has_run
+    callback_has_run = get_global "cb_done"
+    if callback_has_run goto FINISHED
+    if sleep_cnt > 10000 goto ERROR
+    goto LOOP
+FINISHED:
+    print "the callback has run\n"
+    end
+ERROR:
+    print "the callback didnt run\n"
+    end
+.end
+
+.sub _call_back
+.param pmc u
+.param pmc s
+  print "in callback\n"
+  print "user data: "
+  print u
+  print "\n"
+
+  # s is a UnManagedStruct PMC containing a pointer to an integer
+  new $P2, ['ResizablePMCArray']
+  push $P2, .DATATYPE_INT
+  push $P2, 0
+  push $P2, 0
+  assign s, $P2
+
+  # print referenced integer in libnci_test.so
+  $I17 = s[0]
+  print "external data: "
+  print $I17
+  print "\n"
+
+  get_global $P12, "cb_done"
+  inc $P12
+  returncc
+.end
+
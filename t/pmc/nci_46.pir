@@ -0,0 +1,89 @@
+
+
+.include "datatypes.pasm"
+
+.sub test :main
+
+    # turn off JIT or special core - no events yet
+    bounds 1
+    # prepare user data
+    .local pmc user_data
+    user_data = new ['Integer']
+    user_data = 42
+
+    # load libnci_test
+    .local pmc libnci_test
+    libnci_test = loadlib "libnci_test"
+
+    # reset int_cb_D4 to 1
+    .local pmc int_cb_D4
+    int_cb_D4 = dlvar libnci_test, "int_cb_D4"
+    .local pmc int_cb_D4_decl
+    int_cb_D4_decl = new ['ResizablePMCArray']
+    push int_cb_D4_decl, .DATATYPE_INT
+    push int_cb_D4_decl, 0
+    push int_cb_D4_decl, 0
+    assign int_cb_D4, int_cb_D4_decl
+    int_cb_D4[0] = 1
+
+    # A Sub that can be given to the library
+    # this callback function will eventually by called by the library
+    .const 'Sub' cb = "_call_back"
+    .local pmc cb_wrapped
+    cb_wrapped = new_callback cb, user_data, "vUp"  # Z in pdd16
+    print "created a callback sub\n"
+
+    # now call the external sub, that takes a callback and user data
+    .local pmc nci_cb_D4
+    nci_cb_D4 = dlfunc libnci_test, "nci_cb_D4", "vpP"
+    print "loaded a function that takes a callback\n"
+    # This test might fail if we ever implement preemption of NCI calls
+    # since callbacks could start running before the 10 increments are done
+    nci_cb_D4( cb_wrapped, user_data )
+
+    # Wait till all async callbacks are done
+    .local int current
+wait:
+    # Give the scheduler a point to interrupt this Task
+    # and switch to the asynchronous callback Task
+    pass
+
+    # Usually a single pass will be enough, but on a loaded system preemption
+    # can interrupt an async callback and we would start the next test too
+    # early
+    current = int_cb_D4[0]
+    if current < 1000000000 goto wait
+
+    # reset int_cb_D4 to 1
+    int_cb_D4[0] = 1
+
+    .local pmc synchronous
+    synchronous = new ['Integer']
+    synchronous = 1
+    setprop user_data, "_synchronous", synchronous
+    print "marked callback as synchronous\n"
+    nci_cb_D4( cb_wrapped, user_data )
+
+    end
+.end
+
+.sub _call_back
+.param pmc u
+.param pmc s
+  # s is a UnManagedStruct PMC containing a pointer to an integer
+  new $P2, ['ResizablePMCArray']
+  push $P2, .DATATYPE_INT
+  push $P2, 0
+  push $P2, 0
+  assign s, $P2
+
+  print "external data: "
+  $I17 = s[0]
+  print $I17
+  print "\n"
+  $I17 = $I17 * 10
+  s[0] = $I17
+
+  returncc
+.end
+
@@ -0,0 +1,31 @@
+.sub test :main
+    .local string library_name
+    library_name = 'libnci_test'
+    .local pmc libnci_test
+    libnci_test = loadlib library_name
+    unless libnci_test goto NOT_LOADED
+    print "libnci_test was successfully loaded\n"
+
+    $P0 = dlfunc libnci_test, "nci_dd", "dd"
+
+    $I0 = get_addr $P0
+    $I1 = $P0
+
+    $P1 = clone $P0
+
+    $I2 = get_addr $P1
+    $I3 = $P1
+
+    $I4 = $I0 == $I2
+    print $I4
+    print "\n"
+
+    $I4 = $I1 == $I3
+    print $I4
+    print "\n"
+
+    $I0 = istrue $P0
+    print $I0
+NOT_LOADED:
+    print "\n"
+.end
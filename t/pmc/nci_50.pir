@@ -0,0 +1,45 @@
+
+.include "datatypes.pasm"
+
+.sub test :main
+
+  # load library
+  .local pmc libnci_test
+  libnci_test = loadlib "libnci_test"
+  unless libnci_test goto NOT_LOADED
+  print "libnci_test was successfully loaded\n"
+
+  # calling a function in libnci_test
+  .local pmc multiply
+  multiply = dlfunc libnci_test, "nci_pii", "pii"
+  .local pmc product_pointer
+  ( product_pointer ) = multiply( -5, 11111 )
+
+  # the contained structure pointer
+  .local pmc product_pointer_decl
+  product_pointer_decl = new ['ResizablePMCArray']
+  push product_pointer_decl, .DATATYPE_INT
+  push product_pointer_decl, 0
+  push product_pointer_decl, 0
+  assign product_pointer, product_pointer_decl
+
+  # check result of multiplication
+  .local int product
+  product = product_pointer[0]
+  print product
+  print "\n"
+
+  # Write back into libnci_test and check it
+  product_pointer[0] = 333
+  product = 4444
+  print product
+  print "\n"
+  .local pmc nci_i
+  dlfunc nci_i, libnci_test, "nci_i", "i"
+  ( product ) = nci_i()
+  print product
+  print "\n"
+
+NOT_LOADED:
+  end
+.end
@@ -0,0 +1,24 @@
+
+.include "datatypes.pasm"
+
+.sub test :main
+
+    # load libnci_test.so
+    .local string library_name
+    library_name = 'libnci_test'
+    .local pmc libnci_test
+    libnci_test = loadlib library_name
+    unless libnci_test goto NOT_LOADED
+    print library_name
+    print " was successfully loaded\n"
+
+    # address of nci_dlvar_int
+    .local pmc non_existing
+    non_existing = dlfunc libnci_test, "non_existing", "iiii"
+    .local int is_defined
+    is_defined = defined non_existing
+    if is_defined goto IS_DEFINED
+    print "'non_existing' is not defined\n"
+IS_DEFINED:
+NOT_LOADED:
+.end
@@ -0,0 +1,15 @@
+.sub test :main
+    .local pmc pmc1
+    pmc1 = new ['ParrotLibrary']
+    .local int bool1
+    does bool1, pmc1, "scalar"
+    print bool1
+    print "\n"
+    does bool1, pmc1, "library"
+    print bool1
+    print "\n"
+    does bool1, pmc1, "no_interface"
+    print bool1
+    print "\n"
+    end
+.end
@@ -0,0 +1,14 @@
+.sub test :main
+    .local string library_name
+    library_name = 'libnci_test'
+    .local pmc libnci_test
+    libnci_test = loadlib  library_name
+    .local pmc twice
+    twice = dlfunc libnci_test, "nci_dd", "dd"
+    .local pmc f, g
+    f = new ['Integer']
+    f = 21
+    g = twice( f )
+    print g
+    print "\n"
+.end
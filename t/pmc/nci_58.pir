@@ -0,0 +1,21 @@
+.sub test :main
+    .local string library_name
+    library_name = 'libnci_test'
+    .local pmc libnci_test
+    libnci_test = loadlib  library_name
+
+    .local pmc nci_c
+    nci_c = dlfunc libnci_test, "nci_c", "c"
+    $I0 = nci_c.'arity'()
+    say $I0
+
+    .local pmc multiply
+    multiply = dlfunc libnci_test, "nci_pii", "pii"
+    $I0 = multiply.'arity'()
+    say $I0
+
+    .local pmc nci_iiii
+    nci_iiii = dlfunc libnci_test, "nci_iiii", "iiii"
+    $I0 = nci_iiii.'arity'()
+    say $I0
+.end
@@ -0,0 +1,19 @@
+.include "datatypes.pasm"
+
+.sub test :main
+
+  # load library
+  .local pmc libnci_test
+  libnci_test = loadlib "libnci_test"
+  unless libnci_test goto NOT_LOADED
+  print "libnci_test was successfully loaded\n"
+
+  # calling a function in libnci_test
+  .local pmc nci_c
+  dlfunc nci_c, libnci_test, "nci_c", "c"
+  .local int nci_c_out
+  ( nci_c_out ) = nci_c( )
+  print nci_c_out
+  print "\n"
+NOT_LOADED:
+.end
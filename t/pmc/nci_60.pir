@@ -0,0 +1,19 @@
+.sub test :main
+    .local string library_name
+    library_name = 'libnci_test'
+    .local pmc libnci_test
+    libnci_test = loadlib  library_name
+
+    .local pmc nci_tt
+    nci_tt = dlfunc libnci_test, "nci_tt", "pp"
+    .local string s, r
+    .local pmc arg, result
+    # Note: the nci_tt function does not need a zero terminated string,
+    # just uses the two first characters.
+    s = "AB"
+    arg = new ["ByteBuffer"]
+    arg = s
+    result = nci_tt(arg)
+    r = result.'as_string'("ascii")
+    say r
+.end
@@ -0,0 +1,20 @@
+.sub test :main
+    .local string library_name
+    library_name = 'libnci_test'
+    .local pmc libnci_test
+    libnci_test = loadlib library_name
+
+    .local pmc nci_cstring_cstring
+    nci_cstring_cstring = dlfunc libnci_test, "nci_cstring_cstring", "pp"
+    .local string s, r
+    .local int l
+    .local pmc arg, result
+    s = "Hello, world!"
+    l = bytelength s
+    arg = new ["ByteBuffer"]
+    arg = s
+    arg[l] = 0
+    result = nci_cstring_cstring(arg)
+    r = result.'as_string'("ascii")
+    say r
+.end
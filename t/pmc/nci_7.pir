@@ -0,0 +1,50 @@
+.include "datatypes.pasm"
+
+.sub test :main
+
+    # load libnci_test.so
+    .local string library_name
+    library_name = 'libnci_test'
+    .local pmc libnci_test
+    libnci_test = loadlib library_name
+    unless libnci_test goto NOT_LOADED
+    print library_name
+    print " was successfully loaded\n"
+
+    # address of nci_dlvar_double
+    .local pmc nci_dlvar_double
+    nci_dlvar_double = dlvar libnci_test, "nci_dlvar_double"
+
+    # the contained structure pointer
+    .local pmc nci_dlvar_double_decl
+    nci_dlvar_double_decl = new ['ResizablePMCArray']
+    push nci_dlvar_double_decl, .DATATYPE_DOUBLE
+    push nci_dlvar_double_decl, 0
+    push nci_dlvar_double_decl, 0
+    assign nci_dlvar_double, nci_dlvar_double_decl
+
+    $N2 = nci_dlvar_double[0]
+    print $N2
+    print "\n"
+
+    .local pmc nci_d
+    nci_d = dlfunc libnci_test, "nci_d", "d"
+    .local num nci_d_out
+    ( nci_d_out ) = nci_d( )
+    print nci_d_out
+    print "\n"
+    ( nci_d_out ) = nci_d( )
+    print nci_d_out
+    print "\n"
+    ( nci_d_out ) = nci_d( )
+    print nci_d_out
+    print "\n"
+    ( nci_d_out ) = nci_d( )
+    print nci_d_out
+    print "\n"
+    ( nci_d_out ) = nci_d( )
+    print nci_d_out
+    print "\n"
+
+NOT_LOADED:
+.end
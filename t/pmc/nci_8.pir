@@ -0,0 +1,50 @@
+.include "datatypes.pasm"
+
+.sub test :main
+
+    # load libnci_test.so
+    .local string library_name
+    library_name = 'libnci_test'
+    .local pmc libnci_test
+    libnci_test = loadlib library_name
+    unless libnci_test goto NOT_LOADED
+    print library_name
+    print " was successfully loaded\n"
+
+    # address of nci_dlvar_float
+    .local pmc nci_dlvar_float
+    nci_dlvar_float = dlvar libnci_test, "nci_dlvar_float"
+
+    # the contained structure pointer
+    .local pmc nci_dlvar_float_decl
+    nci_dlvar_float_decl = new ['ResizablePMCArray']
+    push nci_dlvar_float_decl, .DATATYPE_FLOAT
+    push nci_dlvar_float_decl, 0
+    push nci_dlvar_float_decl, 0
+    assign nci_dlvar_float, nci_dlvar_float_decl
+
+    $N2 = nci_dlvar_float[0]
+    print $N2
+    print "\n"
+
+    .local pmc nci_f
+    nci_f = dlfunc libnci_test, "nci_f", "f"
+    .local num nci_f_out
+    ( nci_f_out ) = nci_f( )
+    print nci_f_out
+    print "\n"
+    ( nci_f_out ) = nci_f( )
+    print nci_f_out
+    print "\n"
+    ( nci_f_out ) = nci_f( )
+    print nci_f_out
+    print "\n"
+    ( nci_f_out ) = nci_f( )
+    print nci_f_out
+    print "\n"
+    ( nci_f_out ) = nci_f( )
+    print nci_f_out
+    print "\n"
+
+NOT_LOADED:
+.end
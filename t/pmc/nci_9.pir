@@ -0,0 +1,19 @@
+.include "datatypes.pasm"
+
+.sub test :main
+
+  # load library
+  .local pmc libnci_test
+  libnci_test = loadlib "libnci_test"
+  unless libnci_test goto NOT_LOADED
+  print "libnci_test was successfully loaded\n"
+
+  # calling a function in libnci_test
+  .local pmc nci_l
+  dlfunc nci_l, libnci_test, "nci_l", "l"
+  .local int nci_l_out
+  ( nci_l_out ) = nci_l( )
+  print nci_l_out
+  print "\n"
+NOT_LOADED:
+.end
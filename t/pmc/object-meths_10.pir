@@ -0,0 +1,36 @@
+.sub 'main' :main
+    newclass $P1, "Foo"
+    subclass $P2, $P1, "Bar"
+    subclass $P3, $P2, "Baz"
+    new $P3, ['Baz']
+    new $P3, ['Bar']
+    _sub()
+    say "done"
+    end
+.end
+
+.namespace ["Foo"]
+
+.sub 'init' :vtable :method
+    say "foo_init"
+    typeof $S0, self
+    say $S0
+.end
+
+.namespace ["Bar"]
+
+.sub 'init' :vtable :method
+    say "bar_init"
+.end
+
+.namespace ["Baz"]
+
+.sub 'init' :vtable :method
+    say "baz_init"
+.end
+
+.namespace [] # main again
+
+.sub '_sub'
+    say "in sub"
+.end
@@ -0,0 +1,46 @@
+
+.sub _main :main
+    .local pmc A
+    .local pmc B
+
+    newclass A, "A"
+    newclass B, "B"
+
+    new A, ['A']
+    new B, ['B']
+
+    setprop A, "B", B
+
+    A."foo"()
+    B."foo"()
+
+    end
+.end
+
+.namespace ["A"]
+
+.sub foo :method
+    .local pmc B
+
+    print "A::foo\n"
+    getprop B, self, "B"
+
+    self."blah"()
+    B."blah"()
+    self."blah"()
+
+.end
+
+.sub blah :method
+    print "A::blah\n"
+.end
+
+.namespace ["B"]
+
+.sub foo :method
+    print "B::foo\n"
+.end
+
+.sub blah :method
+    print "B::blah\n"
+.end
@@ -0,0 +1,47 @@
+
+.sub _main :main
+    .local pmc A
+    .local pmc B
+
+    newclass A, "A"
+    newclass B, "B"
+
+    new A, ['A']
+    new B, ['B']
+
+    .local pmc r
+    r = A."foo"(B)
+    r."foo"()
+
+    end
+.end
+
+.namespace ["A"]
+
+.sub foo :method
+    .param pmc B
+
+    print "A::foo\n"
+
+    self."blah"()
+    B."blah"()
+    self."blah"()
+    .begin_return
+    .set_return B
+    .end_return
+
+.end
+
+.sub blah :method
+    print "A::blah\n"
+.end
+
+.namespace ["B"]
+
+.sub foo :method
+    print "B::foo\n"
+.end
+
+.sub blah :method
+    print "B::blah\n"
+.end
@@ -0,0 +1,17 @@
+.sub main :main
+    $P3 = newclass "Foo"
+    $P2 = new $P3
+
+    $P0 = find_method $P2, 'meth'
+    say 'main'
+    $P2.$P0()
+    say 'back'
+    $I0 = defined $P0
+    say $I0
+    end
+.end
+
+.namespace ["Foo"]
+.sub meth :method
+    say 'in meth'
+.end
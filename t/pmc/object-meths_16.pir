@@ -0,0 +1,10 @@
+.sub main :main
+  $P0 = new [ 'String' ]
+  $P0 = 'AbC'
+
+  $P1 = find_method $P0, 'reverse'
+  $P2 = $P0.$P1()
+  say $P2
+  $I0 = defined $P1
+  say $I0
+.end
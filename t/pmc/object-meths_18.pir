@@ -0,0 +1,104 @@
+#
+# A   B A   E
+#  \ /   \ /
+#   C     D
+#    \   /
+#     \ /
+#      F
+.sub 'main' :main
+    newclass $P1, "A"
+    newclass $P2, "B"
+    subclass $P3, $P1, "C"
+    addparent $P3, $P2
+
+    subclass $P4, $P1, "D"
+    newclass $P5, "E"
+    addparent $P4, $P5
+
+    subclass $P6, $P3, "F"
+    addparent $P6, $P4
+
+    print "F isa D "
+    isa $I0, $P6, "D"
+    say $I0
+    print "D isa F "
+    isa $I0, $P4, "F"
+    say $I0
+    print "F isa C "
+    isa $I0, $P6, "C"
+    say $I0
+    print "C isa F "
+    isa $I0, $P3, "F"
+    say $I0
+    print "F isa E "
+    isa $I0, $P6, "E"
+    say $I0
+    print "E isa F "
+    isa $I0, $P5, "F"
+    say $I0
+    print "F isa A "
+    isa $I0, $P6, "A"
+    say $I0
+    print "A isa F "
+    isa $I0, $P1, "F"
+    say $I0
+    print "F isa B "
+    isa $I0, $P6, "B"
+    say $I0
+    print "B isa F "
+    isa $I0, $P2, "F"
+    say $I0
+
+    print "C isa A "
+    isa $I0, $P3, "A"
+    say $I0
+    print "A isa C "
+    isa $I0, $P1, "C"
+    say $I0
+    print "D isa A "
+    isa $I0, $P4, "A"
+    say $I0
+    print "A isa D "
+    isa $I0, $P1, "D"
+    say $I0
+
+    say "new F"
+    new $P16, ['F']
+    say "done"
+.end
+
+.namespace ["A"]
+
+.sub 'init' :vtable :method
+    say "A init"
+.end
+
+.namespace ["B"]
+
+.sub 'init' :vtable :method
+    say "B init"
+.end
+
+.namespace ["C"]
+
+.sub 'init' :vtable :method
+    say "C init"
+.end
+
+.namespace ["D"]
+
+.sub 'init' :vtable :method
+    say "D init"
+.end
+
+.namespace ["E"]
+
+.sub 'init' :vtable :method
+    say "E init"
+.end
+
+.namespace ["F"]
+
+.sub 'init' :vtable :method
+    say "F init"
+.end
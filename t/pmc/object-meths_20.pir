@@ -0,0 +1,21 @@
+
+.namespace ["A"]
+.sub foo :method
+    .param int i
+
+    .begin_return
+    .end_return
+.end
+
+.namespace ["B"]
+.sub foo :method
+    .param int i
+
+    .begin_return
+    .end_return
+.end
+
+.namespace []
+.sub _main :main
+    print "ok\n"
+.end
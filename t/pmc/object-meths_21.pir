@@ -0,0 +1,23 @@
+
+.sub _main :main
+    newclass $P0, "Foo"
+
+    new $P1, ['Foo']
+
+    $I1 = $P1["foo"]
+
+    $S0 = "foo"
+    $I1 = $P1[$S0]
+
+    end
+.end
+
+.namespace ["Foo"]
+
+.sub get_integer_keyed :vtable :method
+    .param pmc key
+    print "Key = "
+    print key
+    print "\n"
+    .return(0)
+.end
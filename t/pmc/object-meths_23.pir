@@ -0,0 +1,17 @@
+.sub main :main
+    .local pmc o, cl
+    newclass cl, "Foo"
+    subclass cl, cl, "Bar"
+    o = new ['Bar']
+    print o
+    $P0 = get_global "ok2"
+    cl.'add_vtable_override'('get_string', $P0)
+    print o
+.end
+.sub ok2
+    .return("ok 2\n")
+.end
+.namespace [ "Foo" ]
+.sub get_string :vtable :method
+    .return("ok 1\n")
+.end
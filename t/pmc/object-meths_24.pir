@@ -0,0 +1,19 @@
+.sub main :main
+    $P2 = newclass "Foo"
+    $S0 = "meth"
+    print "main\n"
+    $P3 = new $P2
+    $P3.$S0()
+    print "back\n"
+    end
+.end
+
+.namespace ["Foo"]
+.sub meth :method
+    print "in meth\n"
+    getinterp $P0
+    $P1 = $P0["sub"]
+    print $P1
+    print "\n"
+    .return ()
+.end
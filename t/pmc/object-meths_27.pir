@@ -0,0 +1,16 @@
+.sub main :main
+    .local pmc cl, o
+    cl = subclass "String", "MyString"
+    o = new ['MyString']
+    o = "foo"
+    print o
+    print "\n"
+.end
+
+.namespace ["MyString"]
+.sub set_string_native :vtable :method
+    .param string s
+    $P0 = getattribute self, ["String"], 'proxy'
+    s .= s
+    $P0 = s
+.end
@@ -0,0 +1,64 @@
+.sub main :main
+    .local pmc cl, o
+    cl = newclass "MyClass"
+    o = new ['MyClass']
+    $I0 = 5
+    $S0 = "foo"
+    o[$I0] = 42
+    o[$S0] = 42
+    delete o[$I0]
+    delete o[$S0]
+    $I1 = defined o[$I0]
+    $I1 = defined o[$S0]
+    $I1 = exists o[$I0]
+    $I1 = exists o[$S0]
+.end
+
+.namespace ["MyClass"]
+
+.sub set_integer_keyed_int :vtable :method
+    .param int key
+    .param int val
+    print "ikey\n"
+.end
+
+.sub set_integer_keyed :vtable :method
+    .param string key
+    .param int val
+    print "skey\n"
+.end
+
+.sub delete_keyed_int :vtable :method
+    .param int key
+    print "del_ikey\n"
+.end
+
+.sub delete_keyed :vtable :method
+    .param string key
+    print "del_skey\n"
+.end
+
+.sub defined_keyed_int :vtable :method
+    .param int key
+    print "def_ikey\n"
+    .return (0)
+.end
+
+.sub defined_keyed :vtable :method
+    .param string key
+    print "def_skey\n"
+    .return (0)
+.end
+
+.sub exists_keyed_int :vtable :method
+    .param int key
+    print "exists_ikey\n"
+    .return (0)
+.end
+
+.sub exists_keyed :vtable :method
+    .param string key
+    print "exists_skey\n"
+    .return (0)
+.end
+
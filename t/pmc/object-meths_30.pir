@@ -0,0 +1,22 @@
+.sub main :main
+    .local pmc cl, o
+    cl = subclass "ResizablePMCArray", "MyClass"
+    o = new ['MyClass']
+    $I0 = 5
+    o[$I0] = 42
+    $I1 = o[$I0]
+    print $I1
+    print "\n"
+.end
+
+.namespace ["MyClass"]
+
+.sub get_integer_keyed_int :vtable :method
+    .param int key
+    print "ikey\n"
+    .local pmc ar
+    ar = getattribute self, ["ResizablePMCArray"], "proxy"
+    $I0 = ar[key]
+    .return ($I0)
+.end
+
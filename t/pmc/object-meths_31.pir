@@ -0,0 +1,12 @@
+.sub main :main
+    .local pmc c
+    c = newclass ['whatever']
+    .const 'Sub' foo = "whatever_foo"
+    addmethod c, "foo", foo
+    $P0 = new ['whatever']
+    $P0.'foo'()
+.end
+
+.sub whatever_foo :anon :method
+    print "Foo!\n"
+.end
@@ -0,0 +1,9 @@
+.sub main :main
+    .local pmc cl, o
+    cl = subclass 'Integer', 'MyInt'
+    o = new ['MyInt']
+    o = 10
+    $S0 = o.'get_as_base'(16)
+    print $S0
+    print "\n"
+.end
@@ -0,0 +1,19 @@
+.sub main :main
+    .local pmc cl, o
+    cl = newclass 'MyClass'
+    o = new ['MyClass']
+    $P0 = new ['String']
+    o = new ['MyClass'], $P0
+.end
+
+.namespace ['MyClass']
+
+.sub init :method :vtable
+    .param pmc initializer :optional
+    print "init was called\n"
+.end
+
+.sub init_pmc :method :vtable
+    .param pmc initializer
+    print "init_pmc was called\n"
+.end
@@ -0,0 +1,20 @@
+.sub main :main
+    .local pmc cl, o
+    cl = newclass 'MyClass'
+    o = new ['MyClass']
+    o.'foo'()
+.end
+
+.namespace ['MyClass']
+
+.sub find_method :method :vtable
+    .param string methodname
+    print "find_method was called\n"
+    $P0 = get_hll_global ["MyClass"], methodname
+    .return($P0)
+.end
+
+.sub foo
+  print "foo was called\n"
+.end
+
@@ -0,0 +1,21 @@
+.sub main :main
+    .local pmc cl, o
+    cl = newclass 'MyClass'
+    o = new ['MyClass']
+    $P2 = new ['String']
+    $P2 = "blue"
+    setattribute o, "blue", $P2
+    $P1 = getattribute o, "blue"
+.end
+
+.namespace ['MyClass']
+
+.sub get_attr_str :method :vtable
+    .param string attrname
+    print "get_attr_str was called\n"
+.end
+.sub set_attr_str :method :vtable
+    .param string attrname
+    .param pmc val
+    print "set_attr_str was called\n"
+.end
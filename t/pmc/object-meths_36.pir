@@ -0,0 +1,11 @@
+.namespace [ 'Foo' ]
+
+.sub 'blah' :method
+.end
+
+.namespace []
+
+.sub main :main
+    $P1 = get_hll_global 'Foo'
+    $P0 = $P1.'new'()
+.end
@@ -0,0 +1,15 @@
+.namespace [ 'Foo' ]
+
+.sub 'isa' :vtable("isa") :method
+    .param string role
+    .return(1)
+.end
+
+.namespace []
+
+.sub main :main
+    $P0 = newclass "Foo"
+    $P1 = new $P0
+    $I0 = isa $P1, "no_role_i_ever_heard_of"
+    say $I0
+.end
@@ -0,0 +1,16 @@
+.namespace [ 'Foo' ]
+
+.sub 'isa_pmc' :vtable("isa_pmc") :method
+    .param string role
+    .return(1)
+.end
+
+.namespace []
+
+.sub main :main
+    $P0 = newclass "Foo"
+    $P1 = new $P0
+    $P2 = box "no_role_i_ever_heard_of"
+    $I0 = isa $P1, $P2
+    say $I0
+.end
@@ -0,0 +1,16 @@
+.sub main :main
+    $P2 = newclass "Foo"
+    $P3 = new $P2
+    set $S0, "meth"
+
+    print "main\n"
+    $P3.'meth'()
+    print "back\n"
+    end
+.end
+
+.namespace ["Foo"]
+.sub meth :method
+    print "in meth\n"
+    .return ()
+.end
@@ -0,0 +1,13 @@
+.sub main :main
+    $P2 = newclass "Foo"
+
+    $P3 = new ['Sub']
+    # Add a method to the class manually
+    $P2.'add_method'("meth", $P3)
+
+    # Classes only report 'can' for class methods, not instance methods
+    can $I0, $P2, "meth"
+    print $I0
+    print "\n"
+    end
+.end
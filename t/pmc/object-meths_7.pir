@@ -0,0 +1,16 @@
+.sub main :main
+    $P2 = newclass "Foo"
+    $P4 = new ['Foo']
+
+    $P3 = new ['Sub']
+    # Add a method to the class manually
+    $P2.'add_method'("meth", $P3)
+
+    can $I0, $P4, "meth"
+    print $I0
+    print "\n"
+    can $I0, $P4, "no_such_meth"
+    print $I0
+    print "\n"
+    end
+.end
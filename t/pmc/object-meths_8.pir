@@ -0,0 +1,11 @@
+.sub main :main
+    $P1 = newclass "Foo"
+    new $P3, ['Foo']
+    print "ok 2\n"
+    end
+.end
+
+.namespace ["Foo"]
+.sub init :method :vtable
+    print "ok 1\n"
+.end
@@ -0,0 +1,23 @@
+.sub 'main' :main
+    newclass $P1, "Foo"
+    addattribute $P1, ".i"
+    new $P3, ['Foo']
+    say "ok 2"
+    say $P3
+    end
+.end
+
+.namespace ["Foo"]
+
+.sub 'init' :vtable :method
+    say "ok 1"
+    new $P10, ['Integer']
+    set $P10, 42
+    setattribute self, ".i", $P10
+    .return()
+.end
+
+.sub 'get_string' :vtable :method
+    getattribute $P10, self, ".i"
+    .return( $P10 )
+.end
@@ -0,0 +1,33 @@
+#
+# A   B A   E
+#  \ /   \ /
+#   C     D
+#    \   /
+#     \ /
+#      F
+.sub main :main
+    .local pmc A, B, C, D, E, F, mro, p, it
+    newclass A, "A"
+    newclass B, "B"
+    subclass C, A, "C"
+    addparent C, B
+
+    subclass D, A, "D"
+    newclass E, "E"
+    addparent D, E
+
+    subclass F, C, "F"
+    addparent F, D
+    mro = F.'inspect'('all_parents')
+    it = iter mro
+    it = 0
+loop:
+    unless it goto ex
+    p = shift it
+    $S0 = p
+    print $S0
+    print ' '
+    goto loop
+ex:
+    say 'G'
+.end
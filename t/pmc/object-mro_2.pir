@@ -0,0 +1,64 @@
+#
+# example take from: http://www.python.org/2.3/mro.html
+#
+# class O: pass
+# class F(O): pass
+# class E(O): pass
+# class D(O): pass
+# class C(D,F): pass
+# class B(D,E): pass
+# class A(B,C): pass
+#
+#                           6
+#                          ---
+# Level 3                 | O |                  (more general)
+#                       /  ---  \
+#                      /    |    \                      |
+#                     /     |     \                     |
+#                    /      |      \                    |
+#                   ---    ---    ---                   |
+# Level 2        3 | D | 4| E |  | F | 5                |
+#                   ---    ---    ---                   |
+#                    \  \ _ /       |                   |
+#                     \    / \ _    |                   |
+#                      \  /      \  |                   |
+#                       ---      ---                    |
+# Level 1            1 | B |    | C | 2                 |
+#                       ---      ---                    |
+#                         \      /                      |
+#                          \    /                      \ /
+#                            ---
+# Level 0                 0 | A |                (more specialized)
+#                            ---
+#
+.sub main :main
+    .local pmc A, B, C, D, E, F, O
+    newclass O, "O"
+    subclass F, O, "F"
+    subclass E, O, "E"
+    subclass D, O, "D"
+
+    subclass C, D, "C"
+    addparent C, F
+
+    subclass B, D, "B"
+    addparent B, E
+
+    subclass A, B, "A"
+    addparent A, C
+
+    .local pmc mro, it, p
+
+    mro = A.'inspect'('all_parents')
+    it = iter mro
+    it = 0
+loop:
+    unless it goto ex
+    p = shift it
+    $S0 = p
+    print $S0
+    print ' '
+    goto loop
+ex:
+    say 'G'
+.end
@@ -0,0 +1,32 @@
+#
+#    C
+#   / \
+#  /   \
+# A     B
+#  \   /
+#   \ /
+#    D
+#
+.sub main :main
+    .local pmc A, B, C, D
+    newclass C, "C"
+    subclass A, C, "A"
+    subclass B, C, "B"
+    subclass D, A, "D"
+    addparent D, B
+
+    .local pmc mro, it, p
+
+    mro = D.'inspect'('all_parents')
+    it = iter mro
+    it = 0
+loop:
+    unless it goto ex
+    p = shift it
+    $S0 = p
+    print $S0
+    print ' '
+    goto loop
+ex:
+    say 'G'
+.end
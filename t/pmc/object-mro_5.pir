@@ -0,0 +1,54 @@
+#
+#        TestObject
+#            ^
+#            |
+#         LifeForm
+#          ^    ^
+#         /      \
+#    Sentient    BiPedal
+#       ^          ^
+#       |          |
+#  Intelligent  Humanoid
+#        ^        ^
+#         \      /
+#          Vulcan
+#
+# example taken from: L<http://gauss.gwydiondylan.org/books/drm/drm_50.html>
+#
+#  define class <sentient> (<life-form>) end class;
+#  define class <bipedal> (<life-form>) end class;
+#  define class <intelligent> (<sentient>) end class;
+#  define class <humanoid> (<bipedal>) end class;
+#  define class <vulcan> (<intelligent>, <humanoid>) end class;
+#
+.sub main :main
+    .local pmc TestObject, LifeForm, Sentient, BiPedal, Intelligent, Humanoid, Vulcan
+
+    newclass TestObject, "TestObject"
+
+    subclass LifeForm, TestObject, "LifeForm"
+
+    subclass Sentient, LifeForm, "Sentient"
+    subclass Intelligent, Sentient, "Intelligent"
+
+    subclass BiPedal, LifeForm, "BiPedal"
+    subclass Humanoid, BiPedal, "Humanoid"
+
+    subclass Vulcan, Intelligent, "Vulcan"
+    addparent Vulcan, Humanoid
+
+    .local pmc mro, it, p
+
+    mro = Vulcan.'inspect'('all_parents')
+    it = iter mro
+    it = 0
+loop:
+    unless it goto ex
+    p = shift it
+    $S0 = p
+    print $S0
+    print ' '
+    goto loop
+ex:
+    say 'R'
+.end
@@ -0,0 +1,30 @@
+#
+# example take from: http://www.python.org/2.3/mro.html
+#
+# "Serious order disagreement" # From Guido
+# class O: pass
+# class X(O): pass
+# class Y(O): pass
+# class A(X,Y): pass
+# class B(Y,X): pass
+# try:
+#     class Z(A,B): pass # creates Z(A,B) in Python 2.2
+# except TypeError:
+#     pass # Z(A,B) cannot be created in Python 2.3
+#
+.sub main :main
+    .local pmc O, X, Y, A, B, Z
+
+    newclass O, "O"
+    subclass X, O, "X"
+    subclass Y, O, "Y"
+
+    subclass A, X, "A"
+    addparent A, Y
+
+    subclass B, Y, "B"
+    addparent B, X
+
+    subclass Z, A, "Z"
+    addparent Z, B
+.end
@@ -0,0 +1,16 @@
+
+.sub _main :main
+    .local pmc hash1
+    hash1 = new ['OrderedHash']
+    .local pmc val_in
+    val_in = new ['String']
+    val_in = "U"
+    hash1["X"] = val_in
+
+    .local pmc val_out
+    val_out = hash1['X']
+    print val_out
+    print "\n"
+
+    end
+.end
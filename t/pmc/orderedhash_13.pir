@@ -0,0 +1,13 @@
+
+.sub _main :main
+    .local pmc hash1
+    hash1 = new ['OrderedHash']
+    hash1["X"] = 14
+
+    .local pmc val_out
+    val_out = hash1['X']
+    print val_out
+    print "\n"
+
+    end
+.end
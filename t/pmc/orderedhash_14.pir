@@ -0,0 +1,15 @@
+
+.sub _main :main
+    .local pmc hash1
+    hash1 = new ['OrderedHash']
+    .local string val1
+    val1 = 'U'
+    set hash1["X"], val1
+
+    .local pmc val_out
+    val_out = hash1['X']
+    print val_out
+    print "\n"
+
+    end
+.end
@@ -0,0 +1,16 @@
+
+.sub _main :main
+    .local pmc hash1
+    hash1 = new ['OrderedHash']
+    .local string key1
+    key1 = 'X'
+
+    hash1[key1] = '15'
+
+    .local pmc val_out
+    val_out = hash1[key1]
+    print val_out
+    print "\n"
+
+    end
+.end
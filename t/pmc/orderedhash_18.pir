@@ -0,0 +1,27 @@
+
+.sub _main :main
+    .local pmc hash1
+    hash1 = new ['OrderedHash']
+
+    .local int hash_size
+    hash_size = hash1
+    print hash_size
+    print "\n"
+
+    hash1['X'] = 'U'
+    hash_size = hash1
+    print hash_size
+    print "\n"
+
+    hash1['Y'] = 'V'
+    hash_size = hash1
+    print hash_size
+    print "\n"
+
+    hash1['size'] = hash_size
+    hash_size = hash1
+    print hash_size
+    print "\n"
+
+    end
+.end
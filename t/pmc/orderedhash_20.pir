@@ -0,0 +1,14 @@
+
+.sub _main :main
+    .local pmc hash1
+    hash1 = new ['OrderedHash']
+
+    $S0 = 'hello'
+    hash1[0] = $S0
+
+    $S1 = hash1[0]
+
+    print $S1
+    print "\n"
+    end
+.end
@@ -0,0 +1,14 @@
+
+.sub _main :main
+    .local pmc hash1
+    hash1 = new ['OrderedHash']
+
+    $N0 = 35.5
+    hash1[0] = $N0
+
+    $N1 = hash1[0]
+
+    print $N1
+    print "\n"
+    end
+.end
@@ -0,0 +1,31 @@
+
+.sub _main :main
+    .local pmc hash1
+    hash1 = new ['OrderedHash']
+
+    push hash1, 999 # hash[0]
+    push hash1, 1   # hash[1]
+    push hash1, 999 # hash[2]
+
+    .local pmc integer0, integer2
+    integer0 = new ['Integer']
+    integer0 = 0
+
+    hash1[-4] = integer0 # modify hash[0] to 0
+
+    integer2 = new ['Integer']
+    integer2 = 2
+
+    hash1[-1] = integer2 # modify hash[2] to 2
+
+    $P0 = hash1[-4]
+    print $P0
+    $P0 = hash1[0]
+    print $P0
+    $P0 = hash1[1]
+    print $P0
+    $P0 = hash1[2]
+    print $P0
+    print "\n"
+    end
+.end
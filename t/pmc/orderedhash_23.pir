@@ -0,0 +1,17 @@
+
+.sub _main :main
+    .local pmc hash1
+    hash1 = new ['OrderedHash']
+
+    hash1["one"] = 2
+    hash1["two"] = 5
+    hash1["three"] = 7
+
+    delete hash1["three"]
+
+    $I0 = elements hash1
+
+    print $I0
+    print "\n"
+    end
+.end
@@ -0,0 +1,15 @@
+
+.sub _main :main
+    .local pmc hash1
+    hash1 = new ['OrderedHash']
+
+    $N0 = 21.5
+    hash1[0] = $N0
+
+    push hash1, 72.2
+    $N0 = hash1[1]
+
+    print $N0
+    print "\n"
+    end
+.end
@@ -0,0 +1,16 @@
+
+.sub _main :main
+    .local pmc hash1
+    hash1 = new ['OrderedHash']
+
+    .local pmc integer1
+    integer1 = new ['Integer']
+    integer1 = 5
+
+    hash1[integer1] = "hello"
+    $S0 = hash1[integer1]
+
+    print $S0
+    print "\n"
+    end
+.end
@@ -0,0 +1,14 @@
+
+.sub _main :main
+    .local pmc hash1
+    hash1 = new ['OrderedHash']
+
+    push hash1, 5
+    push hash1, "alpha"
+
+    $N0 = hash1
+
+    print $N0
+    print "\n"
+    end
+.end
@@ -0,0 +1,7 @@
+.sub main :main
+        $P0 = new ['OS']
+        $S1 = $P0."cwd"()
+        print $S1
+        print "\n"
+        end
+.end
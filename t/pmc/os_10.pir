@@ -0,0 +1,11 @@
+.sub main :main
+        $P1 = new ['OS']
+        $S1 = "xpto"
+        $P2 = $P1."stat"($S1)
+
+        $S1 = repeat "0x%08x\n", 13
+        $S2 = sprintf $S1, $P2
+        print $S2
+done:
+        end
+.end
@@ -0,0 +1,4 @@
+.sub main :main
+        $P1 = new ['OS']
+        $P2 = $P1."stat"("non-existent something")
+.end
@@ -0,0 +1,10 @@
+.sub main :main
+    $P1 = new ['OS']
+    $P2 = $P1.'readdir'('docs')
+
+    $S0 = join ' ', $P2
+    $I0 = find_encoding 'ascii'
+    $S0 = trans_encoding $S0, $I0
+    print $S0
+    print "\n"
+.end
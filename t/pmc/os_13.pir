@@ -0,0 +1,8 @@
+.sub main :main
+    $P1 = new ['OS']
+    $P2 = $P1.'readdir'('silly-dir-with-silly-names')
+
+    $S0 = join ' ', $P2
+    print $S0
+    print "\n"
+.end
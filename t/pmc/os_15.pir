@@ -0,0 +1,5 @@
+.sub main :main
+    $P1 = new ['OS']
+    $P1.'rename'('____some_test_file', '___some_other_file')
+    say "ok"
+.end
@@ -0,0 +1,4 @@
+.sub main :main
+    $P1 = new ['OS']
+    $P1.'rename'('some silly non-existent file name', 'arglblargl')
+.end
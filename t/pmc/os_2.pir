@@ -0,0 +1,7 @@
+    .sub main :main
+            $P0 = new ['OS']
+
+            $P0.'chdir'('test-bad-cwd')
+            $P0.'rm'('../test-bad-cwd')
+            $S0 = $P0.'cwd'()
+    .end
@@ -0,0 +1,13 @@
+.sub main :main
+        $P1 = new ['OS']
+
+        $S1 = "xpto"
+        $S2 = "MANIFEST"
+        $P1."symlink"($S2, $S1)
+
+        print "ok\n"
+
+        $P1."symlink"($S1, $S2)
+
+        end
+.end
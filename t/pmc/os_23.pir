@@ -0,0 +1,6 @@
+.sub main :main
+        $P1 = new ['OS']
+        $S1 = $P1."readlink"("xpto")
+        say $S1
+        end
+.end
@@ -0,0 +1,11 @@
+.sub main :main
+        $P1 = new ['OS']
+
+        $S1 = "xpto"
+        $S2 = "myconfig"
+        $P1."link"($S2, $S1)
+
+        print "ok\n"
+
+        end
+.end
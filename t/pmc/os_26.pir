@@ -0,0 +1,34 @@
+.sub main :main
+    .local pmc os
+    .local string xpto, tools
+    os    = new ['OS']
+    xpto  = "xpto"
+    tools = "tools"
+
+    push_eh no_root_perms
+    os."link"(tools, xpto)
+    pop_eh
+
+    .local pmc statvals
+    statvals = os.'stat'(tools)
+
+    # nlink
+    .local int nlink
+    nlink = statvals[3]
+
+    gt nlink, 7, is_okay
+    end
+
+  no_root_perms:
+    .local pmc e
+    .local string message
+    .get_results( e )
+    pop_eh
+    message = e['message']
+    say message
+    end
+
+  is_okay:
+    say "ok"
+    end
+.end
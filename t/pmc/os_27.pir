@@ -0,0 +1,9 @@
+.sub main :main
+        $P1 = new ['OS']
+
+        $I0 = $P1.'umask'(0)
+        say $I0
+        $I1 = $P1.'umask'($I0)
+        say $I1
+        end
+.end
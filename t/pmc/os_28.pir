@@ -0,0 +1,10 @@
+.sub main :main
+        $P1 = new ['OS']
+
+        $P1.'chdir'('my-super-chroot')
+        $P1.'chroot'('.')
+        $S0 = $P1.'cwd'()
+        say $S0
+
+        $P1.'chroot'('loop')
+.end
@@ -0,0 +1,8 @@
+.sub main :main
+    $P1 = new ['OS']
+
+    $I0 = $P1."get_user_id"()
+    print $I0
+
+    end
+.end
@@ -0,0 +1,8 @@
+    .sub main :main
+            $P1 = new ['OS']
+
+            $P1."chmod"("test_f_c", 420)
+            say "ok"
+
+            end
+    .end
@@ -0,0 +1,8 @@
+    .sub main :main
+            $P1 = new ['OS']
+
+            $P1."chmod"("this is another non-existent directory", 420)
+            say "ok"
+
+            end
+    .end
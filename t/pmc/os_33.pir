@@ -0,0 +1,8 @@
+.sub main :main
+    $P1 = new ['OS']
+
+    $I0 = $P1."can_read"("README")
+    say $I0
+
+    end
+.end
@@ -0,0 +1,11 @@
+.sub main :main
+        $P1 = new ['OS']
+
+        $I0 = $P1."can_write"("test_f_a")
+        say $I0
+
+        $I1 = $P1."can_write"("test_f_b")
+        say $I1
+
+        end
+.end
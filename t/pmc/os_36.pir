@@ -0,0 +1,7 @@
+.sub main :main
+        $P0 = loadlib 'os'
+        $P1 = new 'OS'
+        $S1 = $P1."cwd"()
+        print "ok\n"
+        end
+.end
@@ -0,0 +1,6 @@
+.sub main :main
+        $P1 = new ['OS']
+
+        $S1 = repeat "-!", 10
+        $P1."chdir"($S1)
+.end
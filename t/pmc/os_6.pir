@@ -0,0 +1,5 @@
+.sub main :main
+        $P1 = new ['OS']
+
+        $P1."mkdir"(".", 0)
+.end
@@ -0,0 +1,10 @@
+.sub main :main
+        $P1 = new ['OS']
+
+        $S1 = "xpto"
+        $P1."rm"($S1)
+
+        print "ok\n"
+
+        end
+.end
@@ -0,0 +1,24 @@
+.sub main :main
+        $P1 = new ['OS']
+
+        push_eh eh1
+        $P1."rm"('test-bad-rm')
+        say "failed"
+        goto finally1
+eh1:
+        .get_results($P2)
+        say $P2
+finally1:
+        pop_eh
+
+        $P1."chdir"("..")
+        push_eh eh2
+        $P1."rm"('non-existent-directory')
+        say "failed"
+        goto finally2
+eh2:
+        .get_results($P2)
+        say $P2
+finally2:
+        pop_eh
+.end
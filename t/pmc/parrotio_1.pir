@@ -0,0 +1,4 @@
+.sub 'test' :main
+    new $P0, ['FileHandle']
+    say "ok 1 - $P0 = new ['FileHandle']"
+.end
@@ -0,0 +1,35 @@
+.sub 'test' :main
+    $P0 = new ['FileHandle']
+    $P0.open('README.pod')
+    say 'ok 1 - $P0.open($S1)'
+
+    $P0.close()
+    say 'ok 2 - $P0.close()'
+
+    $P0.open('README.pod', 'rw')
+    say 'ok 3 - $P0.open($S1, $S2) # rw mode'
+
+    $P0.close()
+    $P0.open()
+    say 'ok 4 - $P0.open()'
+
+    push_eh eh_bad_file_1
+    $P0.open('bad_file')
+    pop_eh
+
+  test_5:
+    push_eh eh_bad_file_2
+    $P0.open('bad_file', 'r')
+    pop_eh
+
+  test_6:
+    $P0.open('new_file', 'w')
+    say 'ok 6 - $P0.open($S1, $S2) # new file, write mode succeeds'
+
+    goto end
+
+  bad_file_1:
+    say 'ok 5 - $P0.open($S1)      # with bad file'
+    goto test_5
+  end:
+.end
@@ -0,0 +1,4 @@
+.sub 'test' :main
+    new $P0, ['Object']
+    print "ok 1\n"
+.end
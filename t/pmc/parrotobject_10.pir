@@ -0,0 +1,17 @@
+.namespace ['Foo']
+
+.sub invoke :vtable
+  .param int a
+  print a
+  print "\n"
+  inc a
+  .return(a)
+.end
+
+.sub main :main
+  $P0 = newclass "Foo"
+  $P1 = new ['Foo']
+  $I0 = $P1($P1, 2) # pass the object it"self"
+  print $I0
+  print "\n"
+.end
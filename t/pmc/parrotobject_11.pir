@@ -0,0 +1,12 @@
+.namespace ['Foo']
+
+.sub invoke :vtable
+  .param pmc a
+  say 'hi'
+.end
+
+.sub main :main
+    $P0 = newclass "Foo"
+    $P1 = new ['Foo']
+    $P1()
+.end
@@ -0,0 +1,14 @@
+.sub main :main
+   $P0 = newclass [ "Test" ]
+   $P1 = new [ "Test" ]
+   $I1 = $P1[11]
+   print $I1
+   print "\n"
+.end
+
+.namespace [ "Test" ]
+
+.sub get_integer_keyed_int :method :vtable
+   .param int key
+   .return(42)
+.end
@@ -0,0 +1,14 @@
+.sub main :main
+    $P0 = newclass [ "Test" ]
+    $P1 = new [ "Test" ]
+    $S1 = $P1[11]
+    print $S1
+    print "\n"
+.end
+
+.namespace [ "Test" ]
+
+.sub monkey :method :vtable("get_string_keyed_int")
+    .param int key
+    .return("monkey")
+.end
@@ -0,0 +1,6 @@
+.namespace [ "Test" ]
+
+.sub monkey :method :vtable("not_in_the_vtable")
+    .param int key
+    .return("monkey")
+.end
@@ -0,0 +1,11 @@
+.sub main :main
+   $P0 = newclass [ "Test" ]
+   $P1 = new [ "Test" ]
+   print "ok\n"
+.end
+
+.namespace [ "Test" ]
+
+.sub init :method :vtable
+   print "init\n"
+.end
@@ -0,0 +1,16 @@
+.sub main :main
+   $P0 = newclass [ "Test" ]
+   $P1 = newclass [ "Test2" ]
+   addparent $P1, $P0
+   $P2 = new [ "Test2" ]
+   $P3 = clone $P2
+   print "ok\n"
+.end
+
+.namespace [ "Test" ]
+
+.sub clone :method :vtable
+   print "cloned\n"
+.end
+
+.namespace [ "Test2" ]
@@ -0,0 +1,26 @@
+.sub main :main
+    $P0 = subclass 'Hash', 'Foo'
+    $P0 = subclass 'Hash', 'Bar'
+
+    $P1 = new ['Foo']
+    $S1 = $P1
+    say $S1
+
+    $P1 = new ['Bar']
+    $S1 = $P1
+    say $S1
+.end
+
+
+.namespace [ 'Foo' ]
+
+.sub 'get_string' :vtable :method
+    .return('Foo::get_string')
+.end
+
+
+.namespace [ 'Bar' ]
+
+.sub 'get_string' :vtable :method
+    .return('Bar::get_string')
+.end
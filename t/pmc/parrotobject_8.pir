@@ -0,0 +1,18 @@
+.sub main :main
+    $P1 = new ['ResizablePMCArray']
+    push $P1, 3
+    $P2 = new ['ResizablePMCArray']
+    assign $P2, $P1
+    $I0 = elements $P2
+    print $I0
+    print "\n"
+
+    $P99 = subclass 'ResizablePMCArray', 'Perl6List'
+    $P1 = new 'Perl6List'
+    push $P1, 3
+    $P2 = new 'Perl6List'
+    assign $P2, $P1
+    $I0 = elements $P2
+    print $I0
+    print "\n"
+.end
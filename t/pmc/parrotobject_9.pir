@@ -0,0 +1,13 @@
+.namespace ['Foo']
+
+.sub invoke :vtable
+say "you invoked me!"
+.return()
+.end
+
+.sub main :main
+$P0 = newclass "Foo"
+$P1 = new ['Foo']
+$P1($P1)   # pass the object it"self"
+say "got here"
+.end
@@ -0,0 +1,5 @@
+.sub main :main
+    say "starting"
+    new $P0, ['Integer']
+    say "ending"
+.end
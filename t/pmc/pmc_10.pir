@@ -0,0 +1,10 @@
+.sub main :main
+    print "ok 1\n"
+    .const 'Sub' $P0 = "foo"
+    invokecc $P0
+    print "ok 3\n"
+.end
+.sub foo
+    print "ok 2\n"
+    returncc
+.end
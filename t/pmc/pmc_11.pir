@@ -0,0 +1,4 @@
+.sub main :main
+    .const 'Integer' i = "42"
+    say i
+.end
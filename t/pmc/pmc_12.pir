@@ -0,0 +1,4 @@
+.sub main :main
+    .const 'Float' j = "4.2"
+    say j
+.end
@@ -0,0 +1,4 @@
+.sub main :main
+    .const 'Integer' $P0 = "42"
+    say $P0
+.end
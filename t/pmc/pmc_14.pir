@@ -0,0 +1,20 @@
+.sub main :main
+    new $P0, ['Integer']
+    set $P0, 2
+    new $P1, ['Undef']
+    or $P2, $P0, $P1
+    eq_addr $P2, $P0, ok1
+    print "not "
+ok1:
+    print "ok 1\n"
+    and $P2, $P0, $P1
+    eq_addr $P2, $P1, ok2
+    print "not "
+ok2:
+    print "ok 2\n"
+    xor $P2, $P0, $P1
+    eq_addr $P2, $P0, ok3
+    print "not "
+ok3:
+    print "ok 3\n"
+.end
@@ -0,0 +1,10 @@
+.sub main :main
+    new $P3, ['Integer']
+    set $P3, "42"
+    typeof $S0, $P3
+    print $S0
+    print "\n"
+    set $I0, $P3
+    print $I0
+    print "\n"
+.end
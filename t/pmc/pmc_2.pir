@@ -0,0 +1,8 @@
+.sub main :main
+    new $P0, ['Integer']
+    typeof $S0, $P0
+    eq     $S0, "Integer", OK_1
+    print  "not "
+OK_1:
+    print  "ok 1\n"
+.end
@@ -0,0 +1,397 @@
+.sub main :main
+    new $P10, ['Hash']
+    new $P11, ['Hash']
+ new $P0, 'EventHandler'
+
+ set $S1, "EventHandler"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'PackfileDebug'
+
+ set $S1, "PackfileDebug"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'ParrotLibrary'
+
+ set $S1, "ParrotLibrary"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'Complex'
+
+ set $S1, "Complex"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'PackfileAnnotations'
+
+ set $S1, "PackfileAnnotations"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'ImageIOThaw'
+
+ set $S1, "ImageIOThaw"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'Exception'
+
+ set $S1, "Exception"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'PackfileDirectory'
+
+ set $S1, "PackfileDirectory"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'OrderedHash'
+
+ set $S1, "OrderedHash"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'FixedStringArray'
+
+ set $S1, "FixedStringArray"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'AddrRegistry'
+
+ set $S1, "AddrRegistry"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'ResizableIntegerArray'
+
+ set $S1, "ResizableIntegerArray"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'ManagedStruct'
+
+ set $S1, "ManagedStruct"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'HashIteratorKey'
+
+ set $S1, "HashIteratorKey"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'MappedByteArray'
+
+ set $S1, "MappedByteArray"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'BigNum'
+
+ set $S1, "BigNum"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'ExceptionHandler'
+
+ set $S1, "ExceptionHandler"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'PackfileOpMap'
+
+ set $S1, "PackfileOpMap"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'PackfileConstantTable'
+
+ set $S1, "PackfileConstantTable"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'NCI'
+
+ set $S1, "NCI"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'PMCList'
+
+ set $S1, "PMCList"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'StringBuilder'
+
+ set $S1, "StringBuilder"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'Sub'
+
+ set $S1, "Sub"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'NativePCCMethod'
+
+ set $S1, "NativePCCMethod"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'Coroutine'
+
+ set $S1, "Coroutine"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'PackfileView'
+
+ set $S1, "PackfileView"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'MultiSub'
+
+ set $S1, "MultiSub"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'scalar'
+
+ set $S1, "scalar"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'ImageIOFreeze'
+
+ set $S1, "ImageIOFreeze"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'PackfileAnnotation'
+
+ set $S1, "PackfileAnnotation"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'FixedPMCArray'
+
+ set $S1, "FixedPMCArray"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'NameSpace'
+
+ set $S1, "NameSpace"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'String'
+
+ set $S1, "String"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'FixedIntegerArray'
+
+ set $S1, "FixedIntegerArray"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'FixedFloatArray'
+
+ set $S1, "FixedFloatArray"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'Exporter'
+
+ set $S1, "Exporter"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'Capture'
+
+ set $S1, "Capture"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'ResizablePMCArray'
+
+ set $S1, "ResizablePMCArray"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'ParrotInterpreter'
+
+ set $S1, "ParrotInterpreter"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'Scheduler'
+
+ set $S1, "Scheduler"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'ResizableFloatArray'
+
+ set $S1, "ResizableFloatArray"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'ResizableBooleanArray'
+
+ set $S1, "ResizableBooleanArray"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'StringHandle'
+
+ set $S1, "StringHandle"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'Alarm'
+
+ set $S1, "Alarm"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'OS'
+
+ set $S1, "OS"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'Channel'
+
+ set $S1, "Channel"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'Sockaddr'
+
+ set $S1, "Sockaddr"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'ByteBuffer'
+
+ set $S1, "ByteBuffer"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'Pointer'
+
+ set $S1, "Pointer"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'PtrObj'
+
+ set $S1, "PtrObj"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'Timer'
+
+ set $S1, "Timer"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'SchedulerMessage'
+
+ set $S1, "SchedulerMessage"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'CallContext'
+
+ set $S1, "CallContext"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'Callback'
+
+ set $S1, "Callback"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'Role'
+
+ set $S1, "Role"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'ResizableStringArray'
+
+ set $S1, "ResizableStringArray"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'Boolean'
+
+ set $S1, "Boolean"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'Key'
+
+ set $S1, "Key"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'Hash'
+
+ set $S1, "Hash"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'ImageIOStrings'
+
+ set $S1, "ImageIOStrings"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'PackfileBytecodeSegment'
+
+ set $S1, "PackfileBytecodeSegment"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'Socket'
+
+ set $S1, "Socket"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'Integer'
+
+ set $S1, "Integer"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'UnManagedStruct'
+
+ set $S1, "UnManagedStruct"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'PackfileRawSegment'
+
+ set $S1, "PackfileRawSegment"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'Float'
+
+ set $S1, "Float"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'FileHandle'
+
+ set $S1, "FileHandle"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'FixedBooleanArray'
+
+ set $S1, "FixedBooleanArray"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'Continuation'
+
+ set $S1, "Continuation"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'ImageIOSize'
+
+ set $S1, "ImageIOSize"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'PackfileSegment'
+
+ set $S1, "PackfileSegment"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'Undef'
+
+ set $S1, "Undef"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'PtrBuf'
+
+ set $S1, "PtrBuf"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'Env'
+
+ set $S1, "Env"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'Ptr'
+
+ set $S1, "Ptr"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'Packfile'
+
+ set $S1, "Packfile"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+ new $P0, 'Task'
+
+ set $S1, "Task"
+    typeof $S0, $P0
+    ne $S0, $S1, L_BadName
+
+    say "All names ok."
+    end
+L_BadName:
+    print $S1
+    print " PMCs have incorrect name \""
+    print $S0
+    print "\"\n"
+.end
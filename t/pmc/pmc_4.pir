@@ -0,0 +1,4 @@
+.sub main :main
+    new $P1, ['Integer']
+    find_method $P0, $P1, "no_such_meth"
+.end
@@ -0,0 +1,11 @@
+.sub main :main
+      new $P0, ['Integer']
+      new $P1, ['Integer']
+      ne_addr $P0, $P1, OK1
+      print "not "
+OK1:  print "ok 1\n"
+      eq_addr $P0, $P1, BAD2
+      branch OK2
+BAD2: print "not "
+OK2:  print "ok 2\n"
+.end
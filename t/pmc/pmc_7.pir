@@ -0,0 +1,11 @@
+.sub main :main
+      null $P0
+      if_null $P0, OK1
+      print "not "
+OK1:  print "ok 1\n"
+      new $P0, ['Integer']
+      if_null $P0, BAD2
+      branch OK2
+BAD2: print "not "
+OK2:  print "ok 2\n"
+.end
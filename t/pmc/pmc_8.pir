@@ -0,0 +1,7 @@
+.sub main :main
+    new $P0, ['Env']
+    new $P1, ['Env']
+    eq_addr $P0, $P1, ok
+    print "not the same "
+ok: print "ok\n"
+.end
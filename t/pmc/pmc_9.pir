@@ -0,0 +1,14 @@
+.sub main :main
+    new $P0, ['Undef']
+    new $P1, ['Undef']
+    set $P1, $P0
+    issame $I0, $P0, $P1
+    print $I0
+    isntsame $I0, $P0, $P1
+    print $I0
+    new $P2, ['Undef']
+    issame $I0, $P0, $P2
+    print $I0
+    isntsame $I0, $P0, $P2
+    say $I0
+.end
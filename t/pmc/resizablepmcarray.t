@@ -22,7 +22,7 @@ out-of-bounds test. Checks INT and PMC keys.
     .include 'fp_equality.pasm'
     .include 'test_more.pir'
 
-    plan(151)
+    plan(154)
 
     init_tests()
     resize_tests()
@@ -61,6 +61,8 @@ out-of-bounds test. Checks INT and PMC keys.
     test_assign_self()
     test_assign_non_array()
     method_reverse()
+    method_parallel_sort()
+    method_parallel_each()
 .end
 
 .sub init_negative
@@ -1215,6 +1217,85 @@ CODE
     is($S0, "43156", "method_reverse - five elements second reverse")
 .end
 
+.sub method_parallel_sort
+    .local pmc array, cmp_fun
+    .local int i, prev, cur
+    array = new ['ResizablePMCArray']
+    i = 0
+  fill:
+    $I0 = i * 37
+    $I0 %= 10
+    $I0 *= 10000
+    $I0 += i
+    $P0 = box $I0
+    push array, $P0
+    inc i
+    if i < 3000 goto fill
+
+    cmp_fun = get_global 'cmp_by_key'
+    array.'parallel_sort'(cmp_fun)
+    i = 1
+    prev = array[0]
+  check:
+    cur = array[i]
+    if cur <= prev goto unstable
+    prev = cur
+    inc i
+    if i < 3000 goto check
+  unstable:
+    is(i, 3000, 'parallel_sort is stable')
+
+    array.'reverse'()
+    array.'parallel_sort'()
+    $I0 = array[0]
+    $I1 = array[2999]
+    $I0 = $I0 < $I1
+    ok($I0, 'parallel_sort without a cmp function')
+.end
+
+.sub cmp_by_key
+    .param pmc a
+    .param pmc b
+    $I0 = a
+    $I1 = b
+    $I0 /= 10000
+    $I1 /= 10000
+    $I0 = cmp $I0, $I1
+    .return ($I0)
+.end
+
+.sub method_parallel_each
+    .local pmc array
+    array = new ['ResizablePMCArray']
+    $I0 = 0
+  fill:
+    $S0 = $I0
+    push array, $S0
+    inc $I0
+    if $I0 < 3000 goto fill
+
+    $P0 = get_global 'fail_on_2999'
+    push_eh caught
+    array.'parallel_each'($P0)
+    pop_eh
+    ok(0, 'parallel_each calls sub with each element')
+    .return ()
+  caught:
+    .get_results ($P1)
+    pop_eh
+    $S0 = $P1['message']
+    is($S0, 'reached 2999', 'parallel_each calls sub with each element')
+.end
+
+.sub fail_on_2999
+    .param pmc elem
+    $S0 = elem
+    if $S0 != '2999' goto ok
+    $S0 = concat 'reached ', $S0
+    die $S0
+  ok:
+.end
+
 
 # don't forget to change the test plan
 
@@ -38,6 +38,8 @@ Tests the C<StringBuilder> PMC.
 
     test_unicode_conversion_tt1665()
     test_encodings()
+    test_chunks()
+    test_chunked_encodings()
 
     done_testing()
 
@@ -365,6 +367,71 @@ CODE
     is( $S0, utf8:"fooäöüБДЖbar", 'push strings with different encodings' )
 .end
 
+.sub 'test_chunks'
+    .local pmc sb
+    .local string long
+    sb   = new ["StringBuilder"]
+    long = repeat "x", 1000
+
+    push sb, "foo"
+    push sb, long
+    push sb, "bar"
+    push sb, long
+
+    $S0 = concat "foo", long
+    $S0 = concat $S0, "bar"
+    $S0 = concat $S0, long
+    $S1 = sb
+    is( $S1, $S0, 'long strings are appended by reference' )
+
+    $I0 = sb.'get_string_length'()
+    is( $I0, 2006, '... and counted in the length' )
+
+    $S2 = substr sb, 1000, 6
+    is( $S2, 'xxxbar', '... and in substr' )
+
+    $S2 = sb
+    $I0 = issame $S1, $S2
+    ok( $I0, '... and joined only once' )
+
+    push sb, "baz"
+    $S2 = sb
+    $S0 = concat $S0, "baz"
+    is( $S2, $S0, '... even when more strings follow' )
+
+    sb = "new"
+    $S0 = sb
+    is( $S0, 'new', 'set_string drops the chunks' )
+
+    sb = new ["StringBuilder"]
+    $P0 = sb.'chunked'()
+    $I0 = issame $P0, sb
+    ok( $I0, 'chunked returns the builder' )
+    push sb, "a"
+    push sb, "b"
+    push sb, "c"
+    $S0 = sb
+    is( $S0, 'abc', 'chunked appends short strings by reference' )
+.end
+
+.sub 'test_chunked_encodings'
+    .local pmc sb
+    sb = new ["StringBuilder"]
+    sb.'chunked'()
+
+    push sb, "foo"
+    push sb, iso-8859-1:"\x{E4}\x{F6}\x{FC}"
+    push sb, utf8:"\x{411}\x{414}"
+    push sb, binary:"bar"
+    push sb, utf8:"\x{416}"
+
+    $S0 = sb
+    $S1 = utf8:"foo\x{e4}\x{f6}\x{fc}\x{411}\x{414}bar\x{416}"
+    is( $S0, $S1, 'chunks with different encodings' )
+    $I0 = length $S0
+    is( $I0, 12, '... have the right length' )
+.end
+
 # Local Variables:
 #   mode: pir
 #   fill-column: 100
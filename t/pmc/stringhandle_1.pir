@@ -0,0 +1,4 @@
+.sub 'test' :main
+    new $P0, ['StringHandle']
+    say "ok 1 - $P0 = new ['StringHandle']"
+.end
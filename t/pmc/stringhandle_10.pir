@@ -0,0 +1,28 @@
+.sub 'test' :main
+    load_bytecode 'String/Utils.pbc'
+    .local pmc chomp
+               chomp = get_global ['String';'Utils'], 'chomp'
+
+    $P0 = new ['StringHandle']
+    $P0.'open'('temp_file', 'w')
+    $P0.'print'("foobarbaz\n42")
+    $P0.'close'()
+
+    $P0.'open'('temp_file')
+
+    $S0 = $P0.'readline'()
+    $S0 = chomp( $S0 )
+    if $S0 == 'foobarbaz' goto ok_1
+    print 'not '
+  ok_1:
+    say 'ok 1 - $S0 = $P0.readline()'
+
+    $S0 = $P0.'readline'()
+    $S0 = chomp( $S0 )
+    if $S0 == '42' goto ok_2
+    print 'not '
+  ok_2:
+    say 'ok 2 - $S0 = $P0.readline() # again on same stream'
+
+    $P0.'close'()
+.end
@@ -0,0 +1,53 @@
+.sub 'test' :main
+    load_bytecode 'String/Utils.pbc'
+    .local pmc chomp
+               chomp = get_global ['String';'Utils'], 'chomp'
+    .local string test_line
+    .local pmc stringhandle
+    .local int counter
+    stringhandle = new ['StringHandle']
+
+    stringhandle.'open'('temp_file', 'w')
+
+    counter = 0
+  write_loop:
+    inc counter
+    if counter > 10000 goto end_write_loop
+
+    stringhandle.'print'(counter)
+    stringhandle.'print'("\n")
+
+    goto write_loop
+  end_write_loop:
+    stringhandle.'close'()
+    stringhandle.'open'('temp_file')
+
+    counter = 0
+  read_loop:
+    inc counter
+    # read in the file one line at a time...
+    $I0 = stringhandle.'eof'()
+    if $I0 goto end_read_loop
+
+    test_line = stringhandle.'readline'()
+    if test_line == "" goto end_read_loop
+    test_line = chomp( test_line )
+    $I1 = test_line
+    if $I1 == counter goto read_loop
+      print "not "
+## the following lines provide more extensive debugging
+## output on a readline failure
+#      print counter
+#      print " = "
+#      print $I1
+#      print "\n"
+#      counter = $I1
+#      goto read_loop
+
+  end_read_loop:
+    if counter > 9000 goto read_something
+      print "not "
+  read_something:
+    say 'ok 1 - read 10,000 lines'
+    stringhandle.'close'()
+.end
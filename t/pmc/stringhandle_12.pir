@@ -0,0 +1,28 @@
+.sub 'test' :main
+    $P0 = new ['StringHandle']
+
+    $S0 = $P0.'record_separator'()
+    if $S0 == "\n" goto ok_1
+    print 'not '
+  ok_1:
+    say 'ok 1 - $S0 = $P1.record_separator() # default'
+
+    $S99 = 'abc'
+    $P0.'record_separator'($S99)
+    $S0 = $P0.'record_separator'()
+    if $S0 == $S99 goto ok_2
+    print 'not '
+  ok_2:
+    say 'ok 2 - $P0.record_separator($S1)'
+
+    $P0.'print'(123)
+    $S0 = $P0.'record_separator'()
+    $P0.'print'($S0)
+    $P0.'print'(456)
+
+    $S0 = $P0.'readline'()
+    if $S0 == '123abc' goto ok_3
+    print 'not '
+  ok_3:
+    say 'ok 3 - $P0.record_separator() # .readline works as expected'
+.end
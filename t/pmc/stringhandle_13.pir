@@ -0,0 +1,25 @@
+.sub 'test' :main
+    $P0 = new ['StringHandle']
+
+    $P0.'buffer_type'('unbuffered')
+    $S0 = $P0.'buffer_type'()
+    if $S0 == 'unbuffered' goto ok_1
+    print 'not '
+  ok_1:
+    say 'ok 1 - $S0 = $P1.buffer_type() # unbuffered'
+
+    $P0.'buffer_type'('line-buffered')
+    $S0 = $P0.'buffer_type'()
+    if $S0 == 'line-buffered' goto ok_2
+    print 'not '
+  ok_2:
+    say 'ok 2 - $S0 = $P1.buffer_type() # line-buffered'
+
+    $P0.'buffer_type'('full-buffered')
+    $S0 = $P0.'buffer_type'()
+    if $S0 == 'full-buffered' goto ok_3
+    print 'not '
+  ok_3:
+    say 'ok 3 - $S0 = $P1.buffer_type() # full-buffered'
+
+.end
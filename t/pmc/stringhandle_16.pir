@@ -0,0 +1,33 @@
+.sub 'test' :main
+    $P0 = new ['StringHandle']
+    $P0.'encoding'('utf8')
+
+    $P0.'open'('temp_file', 'w')
+
+    $P0.'print'(1234567890)
+    $P0.'print'("\n")
+    $S0 = iso-8859-1:"TÖTSCH"
+    $I9 = find_encoding "utf8"
+    $S9 = trans_encoding $S0, $I9
+    $P0.'print'($S0)
+    $P0.'close'()
+
+    $P0.'open'('temp_file')
+
+    $S1 = $P0.'readline'()
+    if $S1 == "1234567890\n" goto ok_1
+
+    print 'not '
+  ok_1:
+    say 'ok 1 - $S1 = $P0.readline() # read with utf8 encoding on'
+
+    $S2 = $P0.'readline'()
+    if $S2 == $S9 goto ok_2
+
+    print 'not '
+  ok_2:
+    say 'ok 2 - $S2 = $P0.readline() # read iso-8859-1 string'
+
+    $P0.'close'()
+
+.end
@@ -0,0 +1,14 @@
+.sub 'test' :main
+    $P0 = new ['StringHandle']
+
+    $P0.'open'('README.pod')
+    $S0 = $P0.'mode'()
+
+    if $S0 == 'r' goto ok_1
+    print 'not '
+  ok_1:
+    say 'ok 1 - $S0 = $P0.mode() # get read mode'
+
+    $P0.'close'()
+
+.end
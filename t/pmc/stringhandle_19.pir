@@ -0,0 +1,14 @@
+.sub main :main
+    .local pmc sh
+    .local string s
+    sh = new ['StringHandle']
+    sh.'open'('mockname', 'r')
+    # Open sets content to an empty string, flush resets is to null
+    # and that is the case we are testing here.
+    # Also, ensures coverage of the flush method.
+    sh.'flush'()
+    s = sh.'readall'()
+    print '['
+    print s
+    say ']'
+.end
@@ -0,0 +1,26 @@
+.sub 'test' :main
+    $P1 = new ['StringHandle']
+    $P1.'open'('README.pod')
+    say 'ok 1 - $P1.open($S1)'
+
+    $P1.'close'()
+    say 'ok 2 - $P1.close()'
+
+    $P3 = new ['StringHandle']
+    $P3.'open'('temp_file', 'rw')
+    say 'ok 3 - $P3.open($S1, $S2) # rw mode'
+    $P3.'close'()
+
+    $P3.'open'()
+    say 'ok 4 - $P3.open()         # reopening'
+    $P3.'close'()
+
+  test_7:
+    $P7 = new ['StringHandle']
+    $P7.'open'('temp_file', 'w')
+    say 'ok 7 - $P7.open($S1, $S2) # new file, write mode succeeds'
+
+    goto end
+
+  end:
+.end
@@ -0,0 +1,19 @@
+.sub main :main
+    $S0 = <<"EOS"
+line 1
+line 2
+line 3
+EOS
+    .local pmc pio, pio2
+    pio = new ['StringHandle']
+    pio.'open'("temp_file", "w")
+    pio.'print'($S0)
+    pio.'close'()
+
+    pio.'open'("temp_file", "r")
+    $S1 = pio.'readall'()
+    if $S0 == $S1 goto ok
+    print "not "
+ok:
+    say "ok"
+.end
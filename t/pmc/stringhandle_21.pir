@@ -0,0 +1,10 @@
+.sub main :main
+    .local pmc sh
+    .local int i
+    sh = new ['StringHandle']
+    i = sh.'is_closed'()
+    say i
+    sh.'open'("foo", "w")
+    i = sh.'is_closed'()
+    say i
+.end
@@ -0,0 +1,8 @@
+.sub main :main
+    .local pmc sh
+    .local int i
+    sh = new ['StringHandle']
+
+    i = sh.'isatty'()
+    say i
+.end
@@ -0,0 +1,12 @@
+.sub 'main' :main
+    .local pmc ifh
+    ifh = new ['StringHandle']
+    ifh.'encoding'('utf8')
+
+    $S0 = ifh.'readall'('temp_file')
+
+    $I0 = encoding $S0
+    $S1 = encodingname $I0
+
+    say $S1
+.end
@@ -0,0 +1,5 @@
+.sub 'main' :main
+    $P0 = new ['StringHandle']
+    $P1 = clone $P0
+    say "ok"
+.end
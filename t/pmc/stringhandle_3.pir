@@ -0,0 +1,19 @@
+.sub test :main
+    .local pmc sh
+    .local int b
+    sh = new ['StringHandle']
+    b = 0
+    unless sh goto b_false
+    b = 1
+  b_false:
+    say b
+    sh.'open'('mockname', 'w')
+    sh.'print'('Some content')
+    sh.'close'()
+    sh.'open'()
+    b = 0
+    unless sh goto b_true
+    b = 1
+  b_true:
+    say b
+.end
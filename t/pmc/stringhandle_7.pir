@@ -0,0 +1,22 @@
+.sub 'test' :main
+    $P0 = new ['StringHandle']
+    $P0.'open'('README.pod', 'w')
+
+    print $P0, "# Copyright (C) 2001-2012, Parrot Foundation."
+    $P0.'close'()
+
+    $P0.'open'('README.pod')
+
+    $S0 = $P0.'read'(15) # bytes
+    if $S0 == '# Copyright (C)' goto ok_1
+    print 'not '
+  ok_1:
+    say 'ok 1 - $S0 = $P1.read($I2)'
+
+    $S0 = $P0.'read'(12)  # throw away bytes
+    $S0 = $P0.'read'(17)  # bytes
+    if $S0 == 'Parrot Foundation' goto ok_2
+    print 'not '
+  ok_2:
+    say 'ok 2 - $S0 = $P1.read($I2) # again on same stream'
+.end
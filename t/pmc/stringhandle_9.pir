@@ -0,0 +1,32 @@
+.include 'except_types.pasm'
+.sub 'test' :main
+    .local pmc sh, eh
+    .local int result
+    sh = new ['StringHandle']
+    eh = new ['ExceptionHandler']
+    eh.'handle_types'(.EXCEPTION_PIO_ERROR)
+    push_eh eh
+
+    # print to SH not opened
+    result = 0
+    set_label eh, handle1
+    sh.'print'('something')
+    result = 1
+    goto done1
+handle1:
+    finalize eh
+done1:
+    say result
+
+    # print to SH opened for reading
+    result = 0
+    set_label eh, handle2
+    sh.'open'('mockname', 'r')
+    sh.'print'('something')
+    result = 1
+    goto done2
+handle2:
+    finalize eh
+done2:
+    say result
+.end
@@ -0,0 +1,4 @@
+.sub a :main
+  .param int op1
+  .param int op2
+.end
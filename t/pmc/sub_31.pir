@@ -0,0 +1,10 @@
+.sub _main :main
+.include "warnings.pasm"
+    _f1()
+    $P0 = new ['Undef']
+    print $P0
+    print "ok\n"
+.end
+.sub _f1
+    warningson .PARROT_WARNINGS_UNDEF_FLAG
+.end
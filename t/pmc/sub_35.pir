@@ -0,0 +1,41 @@
+.sub main :main
+.include "interpinfo.pasm"
+    # this test will fail when run with -Oc
+    # as the call chain is cut down with tail calls
+    foo()
+
+    $P0 = get_hll_global ["Bar"], "foo"
+    $P0()
+    print "ok\n"
+.end
+.sub foo
+    print "main foo\n"
+    $P0 = get_hll_global ["Bar"], "bar"
+    $P0()
+.end
+.namespace ["Bar"]
+.sub bar
+    print "Bar bar\n"
+    $P1 = getinterp
+    $P0 = $P1["sub"]
+    print "subname: "
+    print $P0
+    print "\n"
+    foo()
+.end
+.sub foo
+    print "Bar foo\n"
+    $P1 = getinterp
+    $I0 = 0
+    push_eh tb_end
+tb_loop:
+    $P0 = $P1["sub"; $I0]
+    print "caller "
+    print $I0
+    print " "
+    print $P0
+    print "\n"
+    inc $I0
+    goto tb_loop
+tb_end:
+.end
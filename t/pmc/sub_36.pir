@@ -0,0 +1,6 @@
+.sub optc :immediate :postcomp
+    print "initial\n"
+.end
+.sub _main :main
+    say "main"
+.end
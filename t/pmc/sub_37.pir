@@ -0,0 +1,21 @@
+.sub main :main
+    "foo"()
+    print "ok\n"
+    $P0 = get_global "new"
+    $I0 = defined $P0
+    print $I0
+    print "\n"
+    $P0 = get_global "foo"
+    unless null $P0 goto foo
+    print "nofoo\n"
+  foo:
+.end
+
+.sub "foo" :anon
+    print "foo\n"
+    "new"()
+.end
+
+.sub "new"
+    print "new\n"
+.end
@@ -0,0 +1,9 @@
+.sub main :main
+    say "main 1"
+    load_bytecode "/tmp/tSeNe38Uxa.pir"
+    load_bytecode "/tmp/K03spIPfQ1.pir"
+    say "main 2"
+    load_bytecode "/tmp/tSeNe38Uxa.pbc" # these have to be ignored
+    load_bytecode "/tmp/K03spIPfQ1.pbc"
+    say "main 3"
+.end
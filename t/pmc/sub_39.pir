@@ -0,0 +1,14 @@
+.sub make_phi :immediate :anon
+    $N0 = sqrt 5
+    $N0 += 1
+    $N0 /= 2
+    $P0 = new ['Float']
+    $P0 = $N0
+    .return ($P0)
+.end
+
+.sub main :main
+    .const 'Sub' phi = "make_phi"
+    print phi
+    print "\n"
+.end
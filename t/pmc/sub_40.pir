@@ -0,0 +1,17 @@
+.sub make_obj :immediate :anon
+    .local pmc cl, o
+    cl = newclass "Foo"
+    addattribute cl, 'x'
+    o = new ['Foo']
+    $P0 = new ['String']
+    $P0 = "ok 1\n"
+    setattribute o, 'x', $P0
+    .return (o)
+.end
+
+.sub main :main
+    .const 'Sub' o = "make_obj"
+    $P0 = getattribute o, 'x'
+    print $P0
+.end
+
@@ -0,0 +1,15 @@
+.sub main :main
+    .local pmc m
+    .include "interpinfo.pasm"
+    m = interpinfo .INTERPINFO_CURRENT_SUB
+    $I0 = m."__get_regs_used"('N')
+    print $I0
+    $I0 = m."__get_regs_used"('I')
+    print $I0
+    $I0 = m."__get_regs_used"('S')
+    print $I0
+    $I0 = m."__get_regs_used"('P')
+    print $I0
+    print "\n"
+.end
+
@@ -0,0 +1,24 @@
+.sub main :main
+    foo()
+.end
+.sub foo
+    .local pmc m
+    .include "interpinfo.pasm"
+    m = interpinfo .INTERPINFO_CURRENT_SUB
+    set $N0, 1.0
+    set $N7, 1.0
+    add $N7, $N7, $N0
+    set $I9, 1
+    add $I10, $I9, $I9
+    $I0 = m."__get_regs_used"('N')
+    print $I0
+    $I0 = m."__get_regs_used"('I')
+    print $I0
+    $I0 = m."__get_regs_used"('S')
+    print $I0
+    $I0 = m."__get_regs_used"('P')
+    print $I0
+    print "\n"
+.end
+
+
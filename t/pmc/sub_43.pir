@@ -0,0 +1,9 @@
+.sub 'test' :main
+.include "warnings.pasm"
+    warningson .PARROT_WARNINGS_UNDEF_FLAG
+    _f1()
+.end
+.sub _f1
+    $P0 = new ['Undef']
+    print $P0
+.end
@@ -0,0 +1,10 @@
+.sub 'test' :main
+.include "warnings.pasm"
+    _f1()
+    $P0 = new ['Undef']
+    print $P0
+    say "ok"
+.end
+.sub _f1
+    warningson .PARROT_WARNINGS_UNDEF_FLAG
+.end
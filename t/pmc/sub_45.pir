@@ -0,0 +1,17 @@
+.sub 'test' :main
+.include "warnings.pasm"
+    _f1()
+    $P0 = new ['Undef']
+    say "back"
+    print $P0
+    say "ok"
+.end
+.sub _f1
+    warningson .PARROT_WARNINGS_UNDEF_FLAG
+    _f2()
+    $P0 = new ['Undef']
+    print $P0
+.end
+.sub _f2
+    warningsoff .PARROT_WARNINGS_UNDEF_FLAG
+.end
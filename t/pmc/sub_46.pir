@@ -0,0 +1,15 @@
+.sub main :main
+    say 'main'
+.end
+.sub pc :postcomp
+    say 'pc'
+.end
+.sub im :immediate
+    say 'im'
+.end
+.sub pc2 :postcomp
+    say 'pc2'
+.end
+.sub im2 :immediate
+    say 'im2'
+.end
@@ -0,0 +1,3 @@
+.sub utf8:"\u7777" :main
+   print "ok\n"
+.end
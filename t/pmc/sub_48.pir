@@ -0,0 +1,7 @@
+.sub utf8:"\u7777"
+    print "ok\n"
+.end
+
+.sub test :main
+    utf8:"\u7777"()
+.end
@@ -0,0 +1,8 @@
+.sub utf8:"\u7777"
+    print "ok\n"
+.end
+
+.sub test :main
+    $P1 = find_name utf8:"\u7777"
+    $P1()
+.end
@@ -0,0 +1,12 @@
+.sub utf8:"\u7777"
+    print "ok\n"
+.end
+
+.sub test :main
+    # utf8:"\u7777" ends up as a string nicode:"\u7777
+    # (or it did, in r12860)
+    $P1 = find_name 'nicode:"\u7777'
+    unless null $P1 goto bad
+    print "not found\n"
+  bad:
+.end
@@ -0,0 +1,8 @@
+.sub main :main
+    .const 'Sub' s = utf8:"\u7777"
+    s()
+.end
+
+.sub utf8:"\u7777"
+   print "ok\n"
+.end
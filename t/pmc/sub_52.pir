@@ -0,0 +1,3 @@
+.sub '\u2193' :main
+    say 'ok'
+.end
@@ -0,0 +1,4 @@
+.sub main :main
+    null $P0
+    $P0()
+.end
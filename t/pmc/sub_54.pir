@@ -0,0 +1,7 @@
+.sub a :init
+    print "in inited\n"
+.end
+
+.sub main :main
+    say "main"
+.end
@@ -0,0 +1,9 @@
+.sub a :main
+  $P0 = get_global 'ok'
+
+  $P1 = new ['String']
+  assign $P0, $P1
+.end
+
+.sub ok
+.end
@@ -0,0 +1,13 @@
+.sub main :main
+    $P0 = get_global 'ok'
+
+    # Make sure destroy is exercised
+    null $P0
+    sweep 1
+
+    say "ok"
+.end
+
+.sub ok
+    say "nothing"
+.end
@@ -0,0 +1,12 @@
+.sub main :main
+    $P0 = get_global 'ok'
+
+    $P1 = new ['Undef']
+    assign $P1, $P0
+
+    $P1()
+.end
+
+.sub ok :outer('main')
+    say "ok"
+.end
@@ -0,0 +1,18 @@
+.sub main :main
+    $P0 = get_global 'main'
+    $P0 = $P0.'get_namespace'()
+    $P0 = $P0.'get_name'()
+    $S0 = join ';', $P0
+    say $S0
+
+    $P0 = get_global ['Foo'; 'Bar'], 'foo'
+    $P0 = $P0.'get_namespace'()
+    $P0 = $P0.'get_name'()
+    $S0 = join ';', $P0
+    say $S0
+.end
+
+.namespace ['Foo'; 'Bar']
+.sub foo
+    noop
+.end
@@ -0,0 +1,68 @@
+.sub main :main
+    $P0 = get_global 'none'
+    $I0 = $P0.'arity'()
+    say $I0
+
+    $P0 = get_global 'one'
+    $I0 = $P0.'arity'()
+    say $I0
+
+    $P0 = get_global 'four'
+    $I0 = $P0.'arity'()
+    say $I0
+
+    $P0 = get_global 'all_slurpy'
+    $I0 = $P0.'arity'()
+    say $I0
+
+    $P0 = get_global 'some_optional'
+    $I0 = $P0.'arity'()
+    say $I0
+
+    $P0 = get_global 'some_named'
+    $I0 = $P0.'arity'()
+    say $I0
+
+    $P0 = get_global 'allsorts'
+    $I0 = $P0.'arity'()
+    say $I0
+.end
+
+.sub none
+.end
+
+.sub one
+    .param int a
+.end
+
+.sub four
+    .param int a
+    .param pmc b
+    .param string c
+    .param num d
+.end
+
+.sub all_slurpy
+    .param pmc s :slurpy
+.end
+
+.sub some_optional
+    .param int a
+    .param int b :optional
+    .param int bo :opt_flag
+    .param int c
+.end
+
+.sub some_named
+    .param int b
+    .param int a :named('a')
+    .param int c :named('c')
+.end
+
+.sub allsorts
+    .param int c
+    .param int b :optional
+    .param int bo :opt_flag
+    .param pmc s :slurpy
+    .param int a :named('a')
+.end
@@ -0,0 +1,18 @@
+.sub main :main
+    $P0 = get_hll_global "example_outer"
+    $P1 = get_hll_global "example_inner"
+    $P1.'set_outer'($P0)
+    $P0()
+    $P1()
+.end
+
+.sub example_outer
+    .lex "Foo", $P0
+    $P0 = new ['String']
+    $P0 = 'I can has outer?'
+.end
+
+.sub example_inner
+    $P0 = find_lex "Foo"
+    say $P0
+.end
@@ -0,0 +1,25 @@
+.sub main :main
+    'example_outer'()
+.end
+
+.sub 'example_outer'
+    .lex "Foo", $P0
+    $P0 = new ['String']
+    $P0 = 'I can has outer from eval?'
+
+    $S1 = <<'PIR'
+.sub example_inner
+    $P0 = find_lex "Foo"
+    say $P0
+.end
+PIR
+    $P1 = compreg 'PIR'
+    $P1 = $P1($S1)
+
+    $P3 = new 'ParrotInterpreter'
+    $P3 = $P3['sub']
+    $P2 = $P1.'main_sub'()
+    $P2.'set_outer'($P3)
+
+    $P2()
+.end
@@ -0,0 +1,35 @@
+.sub 'main' :main
+    $P0 = get_hll_global ['ABC'], 'outer'
+    $P0('ABC lex')
+
+    $P0 = get_hll_global ['DEF'], 'outer'
+    $P0('DEF lex')
+.end
+
+.namespace ['ABC']
+.sub 'outer' :subid('abc_outer')
+    .param pmc x
+    .lex '$abc', x
+    say 'ABC::outer'
+    'inner'()
+.end
+
+.sub 'inner' :outer('abc_outer')
+    say 'ABC::inner'
+    $P0 = find_lex '$abc'
+    say $P0
+.end
+
+.namespace ['DEF']
+.sub 'outer' :subid('def_outer')
+    .param pmc x
+    .lex '$def', x
+    say 'DEF::outer'
+    'inner'()
+.end
+
+.sub 'inner' :outer('def_outer')
+    say 'DEF::inner'
+    $P0 = find_lex '$def'
+    say $P0
+.end
@@ -0,0 +1,16 @@
+.sub 'main' :main
+    'foo'()
+    'bar'()
+.end
+
+.sub 'foo'
+    new $P0, ['String']
+    assign $P0, "abc"
+    say $P0
+.end
+
+.sub 'bar'  :subid("abc")
+    new $P0, ['String']
+    assign $P0, "abc"
+    say $P0
+.end
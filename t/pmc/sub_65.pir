@@ -0,0 +1,5 @@
+.sub 'main' :main
+    $P0 = new ['Sub']
+    assign $P0, $P0
+    say 'no segfault'
+.end
@@ -0,0 +1,5 @@
+.sub 'main' :main
+    $P0 = new ['Sub']
+    $S0 = $P0
+    say 'ok'
+.end
@@ -0,0 +1,14 @@
+.sub 'main' :main
+    $P0 = get_global 'original'
+    $P0()
+
+    $P0 = 'new_name'
+    $S0 = $P0
+    say $S0
+
+    $P0()
+.end
+
+.sub 'original'
+    say 'inside'
+.end
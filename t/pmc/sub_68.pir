@@ -0,0 +1,15 @@
+.sub 'main' :main
+    $P0 = get_global 'original'
+    $P0()
+
+    $I0 = $P0[0]
+
+    if $I0, ok
+
+  ok:
+    say 'ok'
+.end
+
+.sub 'original'
+    say 'inside'
+.end
@@ -0,0 +1,26 @@
+.sub 'comptest' :main
+    $S0 = <<'PIR'
+.sub 'MAIN' :main
+    say 'MAIN'
+    .return ()
+.end
+.namespace ['XYZ']
+.sub 'BEGIN' :init
+    say 'XYZ::BEGIN'
+    .return ()
+.end
+.sub 'foo' :outer('BEGIN')
+    say 'XYZ::foo'
+    .return ()
+.end
+PIR
+    $P0 = compreg 'PIR'
+    say "got compiler"
+    $P1 = $P0($S0)
+    $P2 = $P1.'single_sub_by_tag'('init')
+    $P2()
+    say "compiled"
+    $P1 = $P1.'main_sub'()
+    $P1()
+    say "lived"
+.end
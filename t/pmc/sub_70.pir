@@ -0,0 +1,25 @@
+.sub 'main' :main
+    .const 'Sub' foo = 'foo'
+    $S0 = foo.'get_subid'()
+    say $S0
+
+    $P0 = get_global 'bar'
+    $S0 = $P0.'get_subid'()
+    say $S0
+
+    $P0 = get_global 'baz'
+    $S0 = $P0.'get_subid'()
+    say $S0
+.end
+
+.sub '' :subid('foo')
+    say 'foo'
+.end
+
+.sub 'bar'
+    say 'bar'
+.end
+
+.sub 'baz' :subid('bazsubid')
+    say 'baz'
+.end
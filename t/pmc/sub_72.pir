@@ -0,0 +1,6 @@
+.sub 'main' :main
+    $P0 = new ['Sub']
+
+    $I0 = $P0.'comp_flags'()
+    say $I0
+.end
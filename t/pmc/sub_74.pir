@@ -0,0 +1,92 @@
+.sub 'main' :main
+    .local pmc init, s, regs, arg_info
+
+    init = new ['Hash']
+    init['start_offs']     = 42
+    init['end_offs']       = 115200
+    init['HLL_id']         = 0
+    init['namespace_name'] = ''
+    init['namespace_stash'] = ''
+    init['name']           = 'foo'
+    init['method_name']    = 'bar'
+    init['ns_entry_name']  = 'ns_entry_name'
+    init['subid']          = 'subid'
+    init['vtable_index']   = -1
+    init['multi_signature'] = ''
+    init['lex_info']       = ''
+    init['outer_sub']      = ''
+    init['comp_flags']     = 0
+    init['pf_flags']       = 0
+
+
+    regs = new ['FixedIntegerArray']
+    regs = 4
+    regs[0] = 1
+    regs[1] = 2
+    regs[2] = 6
+    regs[3] = 24
+    init['n_regs_used'] = regs
+
+    arg_info = new ['Hash']
+    arg_info['pos_required']    = 1
+    arg_info['pos_optional']    = 1
+    arg_info['pos_slurpy']      = 2
+    arg_info['named_required']  = 3
+    arg_info['named_optional']  = 5
+    arg_info['named_slurpy']    = 8
+    init['arg_info'] = arg_info
+
+    s = new ['Sub'], init
+
+    $I0 = s.'start_offs'()
+    print 'start_offs '
+    say $I0
+
+    print 'end_offs '
+    $I0 = s.'end_offs'()
+    say $I0
+
+    # Check n_regs_used
+    $I0 = s.'__get_regs_used'('I')
+    print 'I regs '
+    say $I0
+
+    $I0 = s.'__get_regs_used'('N')
+    print 'N regs '
+    say $I0
+
+    $I0 = s.'__get_regs_used'('S')
+    print 'S regs '
+    say $I0
+
+    $I0 = s.'__get_regs_used'('P')
+    print 'P regs '
+    say $I0
+
+    # Check arg_info
+    $P0 = inspect s, 'pos_required'
+    print 'pos_required '
+    say $P0
+
+    $P0 = inspect s, 'pos_optional'
+    print 'pos_optional '
+    say $P0
+
+    $P0 = inspect s, 'pos_slurpy'
+    print 'pos_slurpy '
+    say $P0
+
+    $P0 = inspect s, 'named_required'
+    print 'named_required '
+    say $P0
+
+    $P0 = inspect s, 'named_optional'
+    print 'named_optional '
+    say $P0
+
+    $P0 = inspect s, 'named_slurpy'
+    print 'named_slurpy '
+    say $P0
+
+    # We need more tests for other fields. And more accessors obviously.
+.end
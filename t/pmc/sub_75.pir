@@ -0,0 +1,5 @@
+.sub 'main' :main
+    $P0 = new ['Sub']
+
+    $P1 = inspect $P0, 'foo_bar'
+.end
@@ -0,0 +1,6 @@
+.sub 'main' :main
+    $P0 = new ['Sub']
+
+    $P1 = inspect $P0
+    say $P1
+.end
@@ -0,0 +1,33 @@
+.sub 'main' :main
+    $P0 = get_global 'foo'
+
+    $P1 = inspect $P0
+
+    print 'pos_required '
+    $S0 = $P1['pos_required']
+    say $S0
+
+    print 'pos_optional '
+    $S0 = $P1['pos_optional']
+    say $S0
+
+    print 'pos_slurpy '
+    $S0 = $P1['pos_slurpy']
+    say $S0
+
+    print 'named_required '
+    $S0 = $P1['named_required']
+    say $S0
+
+    print 'named_optional '
+    $S0 = $P1['named_optional']
+    say $S0
+
+    print 'named_slurpy '
+    $S0 = $P1['named_slurpy']
+    say $S0
+.end
+
+.sub foo
+    say 'bar'
+.end
@@ -0,0 +1,10 @@
+.sub 'main' :main
+    .const 'Sub' $P0 = "main"
+
+    $I0 = does $P0, 'scalar'
+    say $I0 # Sub does not scalar
+    $I0 = does $P0, 'invokable'
+    say $I0 # Sub does invokable
+    $I0 = does $P0, 'no_interface'
+    say $I0 # Sub does not no_interface
+.end
@@ -0,0 +1,8 @@
+.sub main :main
+    $S0 = '/tmp/k_c5HsWa5N.pasm'
+    load_bytecode $S0
+    _sub1()
+    $S0 = '/tmp/E667Ir25x0.pbc'
+    load_bytecode $S0
+    _sub2()
+.end
@@ -0,0 +1,25 @@
+
+.sub _test :main
+     .local pmc O
+     O = new ['FileHandle']
+     O.'open'("/tmp/DSh8VYIfyp.pir", 'w')
+     print O, ".sub _main :main\n"
+     print O, "	say \"Hello, World!\"\n"
+     print O, ".end\n"
+     O.'close'()
+     load_bytecode 'config.pbc'
+    .local pmc conf_hash
+    conf_hash = _config()
+    .local string slash
+    slash = conf_hash["slash"]
+    .local string parrot
+    parrot = conf_hash["test_prog"]
+    .local string cmd
+    cmd = '.'
+    cmd .= slash
+    cmd .= parrot
+    cmd .= " /tmp/DSh8VYIfyp.pir"
+    spawnw $I0, cmd
+    say $I0
+.end
+
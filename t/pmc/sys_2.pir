@@ -0,0 +1,13 @@
+.sub _test :main
+     load_bytecode 'config.pbc'
+    .local pmc conf_hash
+    conf_hash = _config()
+    push_eh is_ro
+    conf_hash['foo'] = 'bar'
+    pop_eh
+    goto end
+is_ro:
+    say 'hash is read-only'
+end:
+.end
+
@@ -0,0 +1,146 @@
+#!perl
+# Copyright (C) 2014, Parrot Foundation.
+
+=head1 NAME
+
+t/profiling/sampling.t - test the sampling profiler
+
+=head1 SYNOPSIS
+
+    % prove t/profiling/sampling.t
+
+=head1 DESCRIPTION
+
+Runs a busy program with C<PARROT_SAMPLING_FILENAME> set and checks the
+collapsed stacks and pprof output of the sampling profiler. Also runs a
+program that schedules a task while it is being sampled.
+
+=cut
+
+use strict;
+use warnings;
+use lib qw( lib . ../lib ../../lib );
+
+use Test::More;
+use Parrot::Config;
+use Parrot::Test tests => 9;
+use File::Temp 0.13 qw/tempfile/;
+
+my $PARROT = ".$PConfig{slash}$PConfig{test_prog}";
+
+SKIP: {
+    skip 'sampling profiler needs threads', 9 unless $PConfig{HAS_THREADS};
+
+    my ( $pir_fh, $pir_file ) = tempfile( SUFFIX => '.pir', UNLINK => 1 );
+    print $pir_fh <<'END_PIR';
+.namespace ['Sampled']
+
+.sub 'busy'
+    .param int n
+    .local num x
+    x = 0.0
+  loop:
+    x += 1.5
+    dec n
+    if n goto loop
+    .return (x)
+.end
+
+.namespace []
+
+.sub 'main' :main
+    $P0 = get_hll_global ['Sampled'], 'busy'
+    $N0 = $P0(5000000)
+    say 'done'
+.end
+END_PIR
+    close $pir_fh;
+
+    my ( undef, $folded ) = tempfile( SUFFIX => '.folded', UNLINK => 1 );
+    my ( undef, $pprof )  = tempfile( SUFFIX => '.pprof',  UNLINK => 1 );
+
+    local $ENV{PARROT_SAMPLING_FILENAME}  = $folded;
+    local $ENV{PARROT_SAMPLING_FREQUENCY} = 997;
+    local $ENV{PARROT_SAMPLING_PPROF}     = $pprof;
+
+    is( `"$PARROT" "$pir_file"`, "done\n", 'program runs normally when sampled' );
+
+    open my $fh, '<', $folded or die "can't read $folded: $!";
+    my @stacks = <$fh>;
+    close $fh;
+
+    ok( @stacks, 'collapsed stacks were written' );
+    is( scalar( grep { !/^\S.* \d+$/ } @stacks ), 0, 'every line is a stack and a count' );
+    ok( scalar( grep { /(?:^|;)main \([^;]+\);\S*Sampled::busy \(/ } @stacks ),
+        'busy is sampled inside main' );
+
+    open $fh, '<', $pprof or die "can't read $pprof: $!";
+    my @pprof = <$fh>;
+    close $fh;
+
+    is( $pprof[0], "VERSION:2\n", 'pprof output has a version' );
+    ok( scalar( grep { /^CS:\{x\{ns:\S*Sampled::busy\}x\}/ } @pprof ),
+        'pprof output has context switches into busy' );
+    like( $pprof[-1], qr/^CLI: /, 'pprof output ends with the command line' );
+}
+
+SKIP: {
+    skip 'sampling profiler needs threads', 2 unless $PConfig{HAS_THREADS};
+
+    my ( $pir_fh, $pir_file ) = tempfile( SUFFIX => '.pir', UNLINK => 1 );
+    print $pir_fh <<'END_PIR';
+.namespace ['Sampled']
+
+.sub 'busy'
+    .param int n
+    .local num x
+    x = 0.0
+  loop:
+    x += 1.5
+    dec n
+    if n goto loop
+    .return (x)
+.end
+
+.sub 'task'
+    $P0 = get_hll_global ['Sampled'], 'busy'
+    $N0 = $P0(1000000)
+    say 'task done'
+.end
+
+.namespace []
+
+.sub 'main' :main
+    $P0 = get_hll_global ['Sampled'], 'task'
+    $P1 = new 'Task', $P0
+    schedule $P1
+    wait $P1
+    $P0 = get_hll_global ['Sampled'], 'busy'
+    $N0 = $P0(5000000)
+    say 'done'
+.end
+END_PIR
+    close $pir_fh;
+
+    my ( undef, $folded ) = tempfile( SUFFIX => '.folded', UNLINK => 1 );
+
+    local $ENV{PARROT_SAMPLING_FILENAME}  = $folded;
+    local $ENV{PARROT_SAMPLING_FREQUENCY} = 997;
+    delete local $ENV{PARROT_SAMPLING_PPROF};
+
+    is( `"$PARROT" "$pir_file" 2>&1`, "task done\ndone\n", 'tasks can be scheduled while sampling' );
+
+    open my $fh, '<', $folded or die "can't read $folded: $!";
+    my @stacks = <$fh>;
+    close $fh;
+
+    ok( scalar( grep { /(?:^|;)main \([^;]+\);\S*Sampled::busy \(/ } @stacks ),
+        'sampling goes on after the task ran' );
+}
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4:
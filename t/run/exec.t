@@ -0,0 +1,207 @@
+#!perl
+# Copyright (C) 2014, Parrot Foundation.
+
+=head1 NAME
+
+t/run/exec.t - test the exec runcore
+
+=head1 SYNOPSIS
+
+    % prove t/run/exec.t
+
+=head1 DESCRIPTION
+
+Runs programs with C<-R exec> and checks that Subs compiled to native code
+behave as they do in the fast core: calls and returns, every kind of branch,
+code that is interpreted op by op, and leaving native code once event
+checking has swapped the op table.
+
+=cut
+
+use strict;
+use warnings;
+use lib qw( lib . ../lib ../../lib );
+
+use Test::More;
+use Parrot::Config;
+use Parrot::Test tests => 5;
+use File::Temp 0.13 qw/tempfile/;
+
+my $PARROT = ".$PConfig{slash}$PConfig{test_prog}";
+
+SKIP: {
+    skip 'the exec core makes native code only on x86-64 with mmap', 5
+        unless $PConfig{cpuarch} =~ /^(?:amd64|x86_64)$/
+            && $^O ne 'MSWin32'
+            && $PConfig{i_sysmman};
+
+    is( run_exec(<<'END_PIR'), "6765\n5000050000\n", 'Subs run as native code' );
+.sub 'main' :main
+    $I0 = 'fib'(20)
+    say $I0
+    $I0 = 'sum'(100000)
+    say $I0
+.end
+
+.sub 'fib'
+    .param int n
+    if n >= 2 goto recurse
+    .return (n)
+  recurse:
+    $I0 = n - 1
+    $I1 = 'fib'($I0)
+    $I0 = n - 2
+    $I2 = 'fib'($I0)
+    $I0 = $I1 + $I2
+    .return ($I0)
+.end
+
+.sub 'sum'
+    .param int n
+    .local int total
+    total = 0
+  loop:
+    total += n
+    dec n
+    if n > 0 goto loop
+    .return (total)
+.end
+END_PIR
+
+    is( run_exec(<<'END_PIR'), <<'END_OUT', 'branches dispatch between native ops' );
+.sub 'main' :main
+    .local int i, j, count
+    count = 0
+    i = 0
+  outer:
+    j = 0
+  inner:
+    inc count
+    inc j
+    unless j < 3 goto next
+    goto inner
+  next:
+    inc i
+    eq i, 4, done
+    branch outer
+  done:
+    say count
+
+    $P0 = new 'ResizableIntegerArray'
+    local_branch $P0, twice
+    local_branch $P0, twice
+    goto thrown
+  twice:
+    say 'local branch'
+    local_return $P0
+
+  thrown:
+    push_eh handler
+    die 'boom'
+    say 'not reached'
+  handler:
+    .get_results ($P1)
+    pop_eh
+    $S0 = $P1['message']
+    say $S0
+
+    $P2 = get_global 'counter'
+  resume:
+    $I0 = $P2()
+    say $I0
+    if $I0 < 3 goto resume
+.end
+
+.sub 'counter'
+    $I0 = 1
+  loop:
+    .yield ($I0)
+    inc $I0
+    goto loop
+.end
+END_PIR
+12
+local branch
+local branch
+boom
+1
+2
+3
+END_OUT
+
+    is( run_exec(<<'END_PIR'), "7\n10\nafter eval\n", 'Subs from other segments and nested runloops' );
+.sub 'main' :main
+    $P0 = compreg 'PIR'
+    $P1 = $P0(<<'CODE')
+.sub 'seven'
+    $I0 = 0
+  loop:
+    inc $I0
+    if $I0 < 7 goto loop
+    .return ($I0)
+.end
+CODE
+    $P2 = get_global 'seven'
+    $I0 = $P2()
+    say $I0
+
+    $P3 = newclass 'Counted'
+    $P4 = new 'Counted'
+    $I0 = elements $P4
+    say $I0
+    say 'after eval'
+.end
+
+.namespace ['Counted']
+
+.sub 'elements' :vtable
+    $I0 = 0
+  loop:
+    inc $I0
+    if $I0 < 10 goto loop
+    .return ($I0)
+.end
+END_PIR
+
+    my $swap = <<'END_PIR';
+.sub 'main' :main
+    .local pmc enable
+    $P0 = null
+    enable = dlfunc $P0, 'Parrot_runcore_enable_event_checking', 'vp'
+    $P1 = getinterp
+    $I0 = 0
+  loop:
+    inc $I0
+    if $I0 < 1000 goto loop
+    say 'swapping'
+    enable($P1)
+    $I1 = 0
+  again:
+    inc $I1
+    if $I1 < 3 goto again
+    say 'still native'
+.end
+END_PIR
+
+    my $out = run_exec( $swap, '2>&1' );
+    like( $out, qr/^swapping\ncheck_events__ opcode doesn't do anything useful/,
+        'native code is left at the next branch once the op table is swapped' );
+    unlike( $out, qr/still native/, '... and the ops run through the swapped table' );
+}
+
+sub run_exec {
+    my ( $pir, $redir ) = @_;
+    my ( $pir_fh, $pir_file ) = tempfile( SUFFIX => '.pir', UNLINK => 1 );
+    print $pir_fh $pir;
+    close $pir_fh;
+
+    $redir = '' unless defined $redir;
+    return scalar `"$PARROT" -R exec "$pir_file" $redir`;
+}
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4:
@@ -21,7 +21,7 @@ use lib qw( lib . ../lib ../../lib );
 
 use Test::More;
 use Parrot::Config;
-use Parrot::Test tests => 40;
+use Parrot::Test tests => 43;
 use File::Temp 0.13 qw/tempfile/;
 use File::Spec;
 
@@ -78,7 +78,8 @@ is( `"$PARROT" --trace "$first_pir_file" "$second_pir_file" $redir`,
 my $cmd;
 
 ## this test assumes these cores work on all platforms (a safe assumption)
-for my $val (qw/ slow fast bounds trace /) {
+## exec falls back to interpreting where it cannot generate native code
+for my $val (qw/ slow fast bounds trace exec /) {
     for my $opt ( '-R ', '--runcore ', '--runcore=' ) {
         $cmd = qq{"$PARROT" $opt$val "$second_pir_file" $redir};
         is( qx{$cmd}, "second\n", "<$opt$val> option)" ) or diag $cmd;
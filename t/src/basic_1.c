@@ -0,0 +1,9 @@
+    #include <stdio.h>
+    #include <stdlib.h>
+
+    int
+    main(int argc, const char* argv[])
+    {
+        printf("Hello, World!\n");
+        exit(0);
+    }
@@ -0,0 +1,31 @@
+#line 92 "t/src/embed/api.t"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "parrot/api.h"
+
+int main(int argc, const char **argv)
+{
+    char * c_outstr = NULL;
+    Parrot_Init_Args *initargs = NULL;
+    Parrot_PMC interpmc = NULL;
+    Parrot_PMC apmc = NULL;
+    Parrot_PMC bpmc = NULL;
+    Parrot_String s_teststr = NULL, s_outstr = NULL;
+    int a;
+
+    GET_INIT_STRUCT(initargs);
+    Parrot_api_make_interpreter(NULL, 0, initargs, &interpmc);
+
+    Parrot_api_string_import_ascii(interpmc, "PIR", &s_teststr);
+    Parrot_api_load_language(interpmc, s_teststr);
+
+    Parrot_api_get_compiler(interpmc, s_teststr, &apmc);
+    Parrot_api_set_compiler(interpmc, s_teststr, apmc);
+    Parrot_api_get_compiler(interpmc, s_teststr, &bpmc);
+
+    printf ("%s\n", apmc == bpmc ? "True" : "False!");
+    puts("Done");
+    return 0;
+}
@@ -0,0 +1,39 @@
+#line 138 "t/src/embed/api.t"
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "parrot/api.h"
+#include "imcc/api.h"
+
+int main(void) {
+    Parrot_PMC interp;
+    Parrot_PMC bytecode;
+    Parrot_PMC pir_compiler;
+    Parrot_String pbc_s;
+    Parrot_String filename;
+    Parrot_Int length;
+    char * pbc_c;
+    FILE * file;
+
+    Parrot_api_make_interpreter(NULL, 0, NULL, &interp);
+
+    /* Step 1: Take the PIR, and compile it to PBC. Write to file */
+    imcc_get_pir_compreg_api(interp, 1, &pir_compiler);
+    Parrot_api_string_import(interp, "/tmp/hue_b29i5F.pir", &filename);
+    Parrot_api_toggle_gc(interp, 0);
+    imcc_compile_file_api(interp, pir_compiler, filename, &bytecode);
+
+    Parrot_api_serialize_bytecode_pmc(interp, bytecode, &pbc_s);
+    Parrot_api_toggle_gc(interp, 1);
+    Parrot_api_string_export_ascii(interp, pbc_s, &pbc_c);
+    Parrot_api_string_byte_length(interp, pbc_s, &length);
+    file = fopen("/tmp/HesmyCnTHi.pir", "w");
+    fwrite(pbc_c, length, 1, file);
+    fclose(file);
+
+    /* Step 2: Now load in the PIR and execute it */
+    Parrot_api_string_import(interp, "/tmp/HesmyCnTHi.pir", &filename);
+    Parrot_api_load_bytecode_file(interp, filename, &bytecode);
+    Parrot_api_run_bytecode(interp, bytecode, NULL);
+    return 0;
+}
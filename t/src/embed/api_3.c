@@ -0,0 +1,15 @@
+#line 196 "t/src/embed/api.t"
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "parrot/api.h"
+#include "imcc/api.h"
+
+int main(void) {
+    Parrot_PMC interp;
+
+    Parrot_api_make_interpreter(NULL, 0, NULL, &interp);
+    /* This should throw an exception */
+    Parrot_api_set_runcore(interp, "junk", 0);
+    return 0;
+}
@@ -0,0 +1,26 @@
+#line 214 "t/src/embed/api.t"
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "parrot/api.h"
+#include "imcc/api.h"
+
+int main(void) {
+    Parrot_PMC interp;
+
+    Parrot_String callcontext_s;
+    Parrot_PMC callcontext_sp;
+    Parrot_PMC callcontext_class;
+    Parrot_PMC callcontext;
+
+    Parrot_api_make_interpreter(NULL, 0, NULL, &interp);
+
+    Parrot_api_string_import_ascii(interp, "CallContext", &callcontext_s);
+    Parrot_api_pmc_box_string(interp, callcontext_s, &callcontext_sp);
+    Parrot_api_pmc_get_class(interp, callcontext_sp, &callcontext_class);
+    Parrot_api_pmc_new_from_class(interp, callcontext_class, NULL, &callcontext);
+
+    Parrot_api_reset_call_signature(interp, callcontext);
+
+    return 0;
+}
@@ -0,0 +1,25 @@
+#line 243 "t/src/embed/api.t"
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "parrot/api.h"
+#include "imcc/api.h"
+
+#define PARROT_PROFILE_FLAG 0x08
+
+int main(void) {
+    Parrot_PMC interp;
+    Parrot_PMC pir_compiler;
+
+    Parrot_api_make_interpreter(NULL, 0, NULL, &interp);
+
+    Parrot_api_debug_flag(interp, 0x01, 0);
+
+    Parrot_api_flag(interp, PARROT_PROFILE_FLAG, 0);
+    Parrot_api_flag(interp, PARROT_PROFILE_FLAG, 1);
+
+    Parrot_api_set_runcore(interp, "gcdebug", 0);
+    Parrot_api_set_runcore(interp, "exec", 0);
+
+    return 0;
+}
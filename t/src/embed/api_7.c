@@ -0,0 +1,25 @@
+#line 302 "t/src/embed/api.t"
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "parrot/api.h"
+#include "imcc/api.h"
+
+int main(void) {
+    Parrot_Int wrap1, wrap2, unwrap, size;
+    Parrot_PMC interp;
+    Parrot_PMC pir_compiler;
+    Parrot_PMC ptr;
+    char *p;
+
+    Parrot_api_make_interpreter(NULL, 0, NULL, &interp);
+
+    imcc_get_pir_compreg_api(interp, 1, &pir_compiler);
+
+    wrap1 = Parrot_api_wrap_pointer(interp, pir_compiler, 0, &ptr);
+
+    wrap2 = Parrot_api_wrap_pointer(interp, pir_compiler, 1, &ptr);
+
+    unwrap = Parrot_api_unwrap_pointer(interp, pir_compiler, (void**) &p, &size);
+    return 0;
+}
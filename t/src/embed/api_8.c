@@ -0,0 +1,54 @@
+#line 330 "t/src/embed/api.t"
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "parrot/api.h"
+#include "imcc/api.h"
+
+int main(void) {
+    Parrot_PMC interp;
+    Parrot_PMC bytecode;
+    Parrot_PMC pir_compiler;
+    Parrot_String filename;
+    int i;
+    Parrot_String signature_s;
+    Parrot_String callcontext_s, myobject_s, mymethod_s;
+    Parrot_PMC callcontext_sp, myobject_sp;
+    Parrot_PMC callcontext_class, myobject_class;
+    Parrot_PMC callcontext, myobject, mymethod;
+
+    Parrot_api_make_interpreter(NULL, 0, NULL, &interp);
+    Parrot_api_set_runcore(interp, "gcdebug", 0);
+    Parrot_api_string_import(interp, "/tmp/2PvXTV_wkQ.pir", &filename);
+    Parrot_api_toggle_gc(interp, 0);
+    imcc_get_pir_compreg_api(interp, 1, &pir_compiler);
+    imcc_compile_file_api(interp, pir_compiler, filename, &bytecode);
+    Parrot_api_run_bytecode(interp, bytecode, NULL);
+
+    Parrot_api_set_warnings(interp, 0);
+    Parrot_api_add_library_search_path(interp, ".");
+    Parrot_api_add_dynext_search_path(interp, ".");
+
+    Parrot_api_string_import_ascii(interp, "Pi->", &signature_s);
+
+    Parrot_api_string_import_ascii(interp, "CallContext", &callcontext_s);
+    Parrot_api_pmc_box_string(interp, callcontext_s, &callcontext_sp);
+    Parrot_api_pmc_get_class(interp, callcontext_sp, &callcontext_class);
+    Parrot_api_pmc_new_from_class(interp, callcontext_class, NULL, &callcontext);
+
+    Parrot_api_string_import_ascii(interp, "MyObject", &myobject_s);
+    Parrot_api_pmc_box_string(interp, myobject_s, &myobject_sp);
+    Parrot_api_pmc_get_class(interp, myobject_sp, &myobject_class);
+    Parrot_api_pmc_new_from_class(interp, myobject_class, NULL, &myobject);
+
+    Parrot_api_string_import_ascii(interp, "MyMethod", &mymethod_s);
+    Parrot_api_pmc_find_method(interp, myobject, mymethod_s, &mymethod);
+
+    for (i = 0; i < 5; i++) {
+        Parrot_api_pmc_set_string(interp, callcontext, signature_s);
+        Parrot_api_pmc_set_keyed_int(interp, callcontext, 0, myobject);
+        Parrot_api_pmc_invoke(interp, mymethod, callcontext);
+        Parrot_api_reset_call_signature(interp, callcontext);
+    }
+    return 0;
+}
@@ -0,0 +1,40 @@
+
+#include <parrot/api.h>
+#include <stdio.h>
+
+int main(int argc, char* argv[])
+{
+    Parrot_Init_Args *initargs = NULL;
+    Parrot_PMC interpmc = NULL;
+    Parrot_PMC p_pmc = NULL;
+    Parrot_String s_teststr = NULL, s_outstr = NULL;
+    Parrot_PMC p_keyedstr = NULL;
+    Parrot_PMC p_idx = NULL;
+    char * c_out = NULL;
+
+    GET_INIT_STRUCT(initargs);
+    Parrot_api_make_interpreter(NULL, 0, initargs, &interpmc);
+
+    Parrot_api_string_import_ascii(interpmc, "I am a string.", &s_teststr);
+    Parrot_api_pmc_box_string(interpmc, s_teststr, &p_pmc);
+
+    Parrot_api_pmc_box_integer(interpmc, 2, &p_idx);
+
+    Parrot_api_pmc_get_keyed(interpmc, p_pmc, p_idx, &p_keyedstr);
+    Parrot_api_pmc_get_string(interpmc, p_keyedstr, &s_outstr);
+    Parrot_api_string_export_ascii(interpmc, s_outstr, &c_out);
+    printf("%s\n", c_out);
+
+
+    Parrot_api_string_import_ascii(interpmc, "n", &s_teststr);
+    Parrot_api_pmc_set_string(interpmc, p_keyedstr, s_teststr);
+    Parrot_api_pmc_set_integer(interpmc, p_idx, 3);
+
+    Parrot_api_pmc_set_keyed(interpmc, p_pmc, p_idx, p_keyedstr);
+    Parrot_api_pmc_get_string(interpmc, p_pmc, &s_outstr);
+    Parrot_api_string_export_ascii(interpmc, s_outstr, &c_out);
+    printf("%s\n", c_out);
+
+    return 0;
+}
+
@@ -0,0 +1,40 @@
+
+#include <parrot/api.h>
+#include <stdio.h>
+
+int main(int argc, char* argv[])
+{
+    Parrot_Init_Args *initargs = NULL;
+    Parrot_PMC interpmc = NULL;
+    Parrot_String s_str, s_str2;
+    Parrot_PMC p_key, p_class, p_pmc;
+    const char* string_class[] = { "String" };
+    const char* float_class[] = { "Float" };
+    char *c_out;
+
+    GET_INIT_STRUCT(initargs);
+    Parrot_api_make_interpreter(NULL, 0, initargs, &interpmc);
+
+    Parrot_api_pmc_wrap_string_array(interpmc, 1, string_class, &p_key);
+
+    Parrot_api_pmc_get_class(interpmc, p_key, &p_class);
+    Parrot_api_pmc_new_from_class(interpmc, p_class, NULL, &p_pmc);
+
+    Parrot_api_string_import_ascii(interpmc, "This is a string!", &s_str);
+    Parrot_api_pmc_set_string(interpmc, p_pmc, s_str);
+    Parrot_api_pmc_get_string(interpmc, p_pmc, &s_str2);
+    Parrot_api_string_export_ascii(interpmc, s_str2, &c_out);
+    printf("%s\n", c_out);
+
+    Parrot_api_pmc_wrap_string_array(interpmc, 1, float_class, &p_key);
+
+    Parrot_api_pmc_get_class(interpmc, p_key, &p_class);
+    Parrot_api_pmc_new_from_class(interpmc, p_class, NULL, &p_pmc);
+
+    Parrot_api_pmc_set_float(interpmc, p_pmc, 3.1415);
+    Parrot_api_pmc_get_string(interpmc, p_pmc, &s_str2);
+    Parrot_api_string_export_ascii(interpmc, s_str2, &c_out);
+    printf("%s\n", c_out);
+
+    return 0;
+}
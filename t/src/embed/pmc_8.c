@@ -0,0 +1,35 @@
+
+#include "parrot/api.h"
+#include <stdio.h>
+
+int main(int argc, char* argv[])
+{
+    char * c_outstr = NULL;
+    Parrot_Init_Args *initargs = NULL;
+    Parrot_PMC interpmc = NULL;
+    Parrot_PMC p_str = NULL, p_keyedstr = NULL, p_str_thawed = NULL;
+    Parrot_String s_teststr = NULL, s_outstr = NULL, s_frozen = NULL;
+    Parrot_Int len;
+
+    GET_INIT_STRUCT(initargs);
+    Parrot_api_make_interpreter(NULL, 0, initargs, &interpmc);
+
+    Parrot_api_string_import_ascii(interpmc, "I am a string.", &s_teststr);
+    Parrot_api_pmc_box_string(interpmc, s_teststr, &p_str);
+
+    Parrot_api_pmc_serialize(interpmc, p_str, &s_frozen);
+    Parrot_api_string_byte_length(interpmc, s_frozen, &len);
+    Parrot_api_string_export_ascii(interpmc, s_frozen, &c_outstr);
+    Parrot_api_pmc_deserialize_bytes(interpmc, (const unsigned char *)c_outstr, len, &p_str_thawed);
+
+    Parrot_api_pmc_get_string(interpmc, p_str_thawed, &s_outstr);
+    Parrot_api_string_export_ascii(interpmc, s_outstr, &c_outstr);
+    printf("Frozen and thawed: %s\n", c_outstr);
+
+    Parrot_api_pmc_get_string(interpmc, p_str, &s_outstr);
+    Parrot_api_string_export_ascii(interpmc, s_outstr, &c_outstr);
+    printf("%s\n", c_outstr);
+
+    return 0;
+}
+
@@ -0,0 +1,89 @@
+#line 42 "t/src/embed.t"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/extend_vtable.h"
+#include "imcc/api.h"
+
+static void fail(const char *msg);
+static Parrot_String createstring(Parrot_Interp interp, const char * value);
+static Parrot_Interp new_interp();
+
+static void fail(const char *msg)
+{
+    fprintf(stderr, "failed: %s\n", msg);
+    exit(EXIT_FAILURE);
+}
+
+static Parrot_String createstring(Parrot_Interp interp, const char * value)
+{
+    return Parrot_new_string(interp, value, strlen(value), (const char*)NULL, 0);
+}
+
+static Parrot_Interp new_interp()
+{
+    Parrot_Interp interp = Parrot_interp_new(NULL);
+    if (!interp)
+        fail("Cannot create parrot interpreter");
+    return interp;
+
+}
+
+#line 426 "t/src/embed.t"
+
+int main(void)
+{
+    Parrot_Interp interp;
+    Parrot_PMC code, rootns, parrotns, sub, result;
+    Parrot_String compiler, errstr, parrotname, subname, msg;
+    Parrot_PMC res1, res2;
+
+    /* Create the interpreter */
+    interp = Parrot_interp_new(NULL);
+    if (! interp)
+        fail("Cannot create parrot interpreter");
+
+    /* Compile pir code */
+    compiler = createstring(interp, "PIR");
+    code = Parrot_compile_string(interp, compiler,
+".sub main :main\n"
+"  say 'Must not be seen!'\n"
+"\n"
+".end\n"
+"\n"
+".sub hello\n"
+"  .param string s\n"
+"  .local pmc foo\n"
+"  foo = new 'ResizablePMCArray', 2\n"
+"  foo[0] = 42.0\n"
+"  foo[1] = 314.0\n"
+"  .return(foo)\n"
+"\n"
+".end\n"
+"\n",
+        &errstr
+    );
+
+    /* Get parrot namespace */
+    rootns = Parrot_get_root_namespace(interp);
+    parrotname = createstring(interp, "parrot");
+    parrotns = Parrot_PMC_get_pmc_keyed_str(interp, rootns,  parrotname);
+    /* Get the sub */
+    subname = createstring(interp, "hello");
+    sub = Parrot_PMC_get_pmc_keyed_str(interp, parrotns,  subname);
+
+    /* Execute it */
+    msg = createstring(interp, "Hello, ");
+    Parrot_ext_call(interp, sub, "S->P", msg, &result);
+
+    res2 = Parrot_PMC_pop_pmc(interp, result);
+    res1 = Parrot_PMC_pop_pmc(interp, result);
+
+    Parrot_printf(interp, "%.1Pf is the answer and pi*100 = %.1Pf\n",
+        res1, res2);
+
+    Parrot_interp_destroy(interp);
+    return 0;
+}
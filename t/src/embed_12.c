@@ -0,0 +1,84 @@
+#line 42 "t/src/embed.t"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/extend_vtable.h"
+#include "imcc/api.h"
+
+static void fail(const char *msg);
+static Parrot_String createstring(Parrot_Interp interp, const char * value);
+static Parrot_Interp new_interp();
+
+static void fail(const char *msg)
+{
+    fprintf(stderr, "failed: %s\n", msg);
+    exit(EXIT_FAILURE);
+}
+
+static Parrot_String createstring(Parrot_Interp interp, const char * value)
+{
+    return Parrot_new_string(interp, value, strlen(value), (const char*)NULL, 0);
+}
+
+static Parrot_Interp new_interp()
+{
+    Parrot_Interp interp = Parrot_interp_new(NULL);
+    if (!interp)
+        fail("Cannot create parrot interpreter");
+    return interp;
+
+}
+
+#line 544 "t/src/embed.t"
+
+void hello(Parrot_Interp interp);
+
+void hello(Parrot_Interp interp)
+{
+    Parrot_printf(interp, "Hello from C\n");
+}
+
+int main(void)
+{
+    Parrot_Interp interp;
+    Parrot_String compiler, pir_compiler;
+    Parrot_String errstr;
+    Parrot_PMC code;
+    Parrot_PMC rootns;
+    Parrot_String parrotname;
+    Parrot_PMC parrotns;
+    Parrot_String helloname;
+    void *discard;
+
+    /* Create the interpreter */
+    interp = Parrot_interp_new(NULL);
+    if (! interp)
+        fail("Cannot create parrot interpreter");
+
+
+    /* Compile pir */
+    compiler = createstring(interp, "PIR");
+    code = Parrot_compile_string(interp, compiler,
+".sub externcall :main\n"
+"  hello()\n"
+"\n"
+".end\n"
+"\n",
+        &errstr
+    );
+
+    /* Create extern sub and insert in parrot namespace */
+    rootns = Parrot_get_root_namespace(interp);
+    parrotname = createstring(interp, "parrot");
+    parrotns = Parrot_PMC_get_pmc_keyed_str(interp, rootns, parrotname);
+    helloname = createstring(interp, "hello");
+    Parrot_PMC_set_pmc_keyed_str(interp, parrotns, helloname, hellosub);
+
+    /* Call it */
+    Parrot_ext_call(interp, code, "->");
+
+    Parrot_interp_destroy(interp);
+    return 0;
+}
@@ -0,0 +1,33 @@
+#line 114 "t/src/embed.t"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "parrot/parrot.h"
+
+void fail(const char *msg);
+
+void fail(const char *msg)
+{
+    fprintf(stderr, "failed: %s\n", msg);
+    exit(EXIT_FAILURE);
+}
+
+int main(int argc, const char **argv)
+{
+    Parrot_Interp interp1, interp2;
+    interp1 = Parrot_interp_new(NULL);
+    if (!interp1)
+        fail("Cannot create 1st parrot interpreter");
+
+    interp2 = Parrot_interp_new(NULL);
+
+    if (!interp2)
+        fail("Cannot create 2nd parrot interpreter");
+
+    puts("Done");
+    Parrot_interp_destroy(interp1);
+    Parrot_interp_destroy(interp2);
+    puts("Really done");
+    return 0;
+}
@@ -0,0 +1,52 @@
+#line 42 "t/src/embed.t"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/extend_vtable.h"
+#include "imcc/api.h"
+
+static void fail(const char *msg);
+static Parrot_String createstring(Parrot_Interp interp, const char * value);
+static Parrot_Interp new_interp();
+
+static void fail(const char *msg)
+{
+    fprintf(stderr, "failed: %s\n", msg);
+    exit(EXIT_FAILURE);
+}
+
+static Parrot_String createstring(Parrot_Interp interp, const char * value)
+{
+    return Parrot_new_string(interp, value, strlen(value), (const char*)NULL, 0);
+}
+
+static Parrot_Interp new_interp()
+{
+    Parrot_Interp interp = Parrot_interp_new(NULL);
+    if (!interp)
+        fail("Cannot create parrot interpreter");
+    return interp;
+
+}
+
+#line 152 "t/src/embed.t"
+
+int main(int argc, const char **argv)
+{
+    Parrot_Interp interp;
+    Parrot_String err, lang;
+    Parrot_PMC func_pmc;
+    char *str;
+
+    interp = Parrot_interp_new(NULL);
+    if (! interp)
+        fail("Cannot create parrot interpreter");
+    lang = createstring(interp, "PIR");
+
+    func_pmc = Parrot_compile_string(interp, lang, ".sub foo\n copy\n.end", &err);
+    Parrot_printf(interp, "%Ss\n", err);
+    Parrot_interp_destroy(interp);
+    return 0;
+}
@@ -0,0 +1,62 @@
+#line 42 "t/src/embed.t"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/extend_vtable.h"
+#include "imcc/api.h"
+
+static void fail(const char *msg);
+static Parrot_String createstring(Parrot_Interp interp, const char * value);
+static Parrot_Interp new_interp();
+
+static void fail(const char *msg)
+{
+    fprintf(stderr, "failed: %s\n", msg);
+    exit(EXIT_FAILURE);
+}
+
+static Parrot_String createstring(Parrot_Interp interp, const char * value)
+{
+    return Parrot_new_string(interp, value, strlen(value), (const char*)NULL, 0);
+}
+
+static Parrot_Interp new_interp()
+{
+    Parrot_Interp interp = Parrot_interp_new(NULL);
+    if (!interp)
+        fail("Cannot create parrot interpreter");
+    return interp;
+
+}
+
+#line 225 "t/src/embed.t"
+
+int main(void)
+{
+    Parrot_Interp interp;
+    Parrot_String compiler, errstr;
+    Parrot_PMC code;
+
+    /* Create the interpreter and show a message using parrot io */
+    interp = Parrot_interp_new(NULL);
+    if (! interp)
+        fail("Cannot create parrot interpreter");
+    Parrot_printf(interp, "Hello, parrot\n");
+
+    /* Compile and execute a pir sub */
+    compiler = createstring(interp, "PIR");
+    code = Parrot_compile_string(interp, compiler,
+".sub main :main\n"
+"  say 'Hello, pir'\n"
+"\n"
+".end\n"
+"\n",
+        &errstr
+    );
+    Parrot_ext_call(interp, code, "->");
+
+    Parrot_interp_destroy(interp);
+    return 0;
+}
@@ -0,0 +1,35 @@
+#include <stdio.h>
+#include <parrot/parrot.h>
+
+void
+ex1(PARROT_INTERP, int x, void*p)
+{
+    printf("ex1\n");
+}
+
+void
+ex2(PARROT_INTERP, int x, void*p)
+{
+    printf("ex2\n");
+}
+
+void
+ex3(PARROT_INTERP, int x, void*p)
+{
+    Parrot_io_printf(interp, "ex3\n");
+}
+
+int
+main(int argc, char* argv[])
+{
+    Interp *interp;
+
+    interp = Parrot_interp_new(NULL);
+    if (interp) {
+        Parrot_x_on_exit(interp, ex1, 0);
+        Parrot_x_on_exit(interp, ex2, 0);
+        Parrot_x_on_exit(interp, ex3, 0);
+        Parrot_x_exit(interp, 0);
+    }
+    exit(0);
+}
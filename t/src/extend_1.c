@@ -0,0 +1,17 @@
+#include <stdio.h>
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+
+int
+main(int argc, const char *argv[])
+{
+    Parrot_Interp interp  = Parrot_interp_new(NULL);
+    Parrot_PMC    pmcnull;
+
+    /* Interpreter set-up */
+    if (interp) {
+        pmcnull  = Parrot_pmc_null();
+        Parrot_interp_destroy(interp);
+    }
+    return 0;
+}
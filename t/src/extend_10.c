@@ -0,0 +1,28 @@
+
+#include <stdio.h>
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+
+int
+main(int argc, const char *argv[])
+{
+    Parrot_Interp interp = Parrot_interp_new(NULL);
+    Parrot_Int    type;
+    Parrot_String value, new_value;
+    Parrot_PMC    testpmc;
+
+    /* Interpreter set-up */
+    if (interp) {
+        type    = Parrot_pmc_get_type_str(interp, Parrot_str_new(interp, "String", 0));
+        testpmc = Parrot_pmc_new(interp, type);
+
+        value     = Parrot_str_new(interp, "Pumpking", 8/*, "iso-8859-1", 0*/);
+        Parrot_PMC_set_string_native(interp, testpmc, value);
+        new_value = Parrot_PMC_get_string(interp, testpmc);
+
+        Parrot_eprintf(interp, "%S\n", new_value);
+
+        Parrot_interp_destroy(interp);
+    }
+    return 0;
+}
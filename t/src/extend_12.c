@@ -0,0 +1,41 @@
+
+#include <parrot/parrot.h>
+#include <parrot/extend.h>
+
+/* also both the test PASM and the_test() print to stderr
+ * so that buffering in PIO is not an issue */
+
+int
+main(int argc, const char *argv[])
+{
+    Parrot_Interp interp = Parrot_interp_new(NULL);
+    if (interp) {
+        Parrot_String   temp_pbc_str = Parrot_str_new(interp, "/tmp/ZItIm9sMFg.pbc", 0);
+        PackFile * pf   = Parrot_pf_read_pbc_file(interp, temp_pbc_str);
+        Parrot_String   name = Parrot_str_new_constant(interp, "_sub1");
+        PMC            *sub, *arg;
+        Parrot_PMC      pbc  = Parrot_pf_get_packfile_pmc(interp, pf, STRINGNULL);
+
+        Parrot_pf_set_current_packfile(interp, pbc);
+        sub = Parrot_ns_find_current_namespace_global(interp, name);
+        Parrot_ext_call(interp, sub, "->");
+        Parrot_eprintf(interp, "back\n");
+
+        /* win32 seems to buffer stderr ? */
+        Parrot_io_flush_handle(interp, Parrot_io_STDERR(interp));
+
+        name = Parrot_str_new_constant(interp, "_sub2");
+        sub  = Parrot_ns_find_current_namespace_global(interp, name);
+        arg  = Parrot_pmc_new(interp, enum_class_String);
+
+        Parrot_PMC_set_string_native(interp, arg,
+                     Parrot_str_new(interp, "hello ", 0));
+
+        Parrot_ext_call(interp, sub, "P->", arg);
+        Parrot_eprintf(interp, "back\n");
+
+        Parrot_interp_destroy(interp);
+    }
+    return 0;
+}
+
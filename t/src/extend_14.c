@@ -0,0 +1,40 @@
+
+#include <parrot/parrot.h>
+#include <parrot/extend.h>
+
+/* also both the test PASM and the_test() print to stderr
+ * so that buffering in PIO is not an issue */
+
+int
+main(int argc, const char *argv[])
+{
+    Parrot_Interp interp = Parrot_interp_new(NULL);
+    if (interp) {
+        Parrot_String   temp_pbc_str = Parrot_str_new(interp, "/tmp/BNL8PEtmBi.pbc", 0);
+        PackFile* pf   = Parrot_pf_read_pbc_file(interp, temp_pbc_str);
+        Parrot_String   name = Parrot_str_new_constant(interp, "_sub1");
+        PMC            *sub;
+        Parrot_runloop  jump_point;
+        Parrot_PMC      pbc  = Parrot_pf_get_packfile_pmc(interp, pf, STRINGNULL);
+
+        Parrot_pf_set_current_packfile(interp, pbc);
+        sub = Parrot_ns_find_current_namespace_global(interp, name);
+
+        if (setjmp(jump_point.resume)) {
+            Parrot_eprintf(interp, "caught\n");
+        }
+        else {
+            /* pretend the EH was pushed by the sub call. */
+            interp->current_runloop_id++;
+
+            Parrot_ex_add_c_handler(interp, &jump_point);
+            Parrot_ext_call(interp, sub, "->");
+        }
+
+        Parrot_eprintf(interp, "back\n");
+
+        Parrot_interp_destroy(interp);
+    }
+    return 0;
+}
+
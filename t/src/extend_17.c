@@ -0,0 +1,24 @@
+#include <parrot/parrot.h>
+#include <parrot/extend.h>
+
+int
+main(int argc, const char *argv[])
+{
+    Parrot_Int      result;
+    Parrot_PMC      sub, pbc;
+    PackFile* pf;
+    Parrot_Interp   interp = Parrot_interp_new(NULL);
+
+    if (interp) {
+        Parrot_String   temp_pbc_str = Parrot_str_new(interp, "/tmp/BNL8PEtmBi.pbc", 0);
+        pf   = Parrot_pf_read_pbc_file(interp, temp_pbc_str);
+        pbc  = Parrot_pf_get_packfile_pmc(interp, pf, STRINGNULL);
+        Parrot_pf_set_current_packfile(interp, pbc);
+
+        sub      = Parrot_ns_find_current_namespace_global( interp, Parrot_str_new_constant( interp, "add" ) );
+        Parrot_ext_call(interp, sub, "II->I", 100, 200, &result);
+        printf( "Result is %d.\n", result );
+        Parrot_interp_destroy(interp);
+    }
+    return 0;
+}
@@ -0,0 +1,46 @@
+
+#include <stdio.h>
+#include "parrot/parrot.h"
+
+/* this is Parrot_x_exit without the exit()
+ * it will call Parrot_interp_really_destroy() as an exit handler
+ */
+void interp_cleanup(Parrot_Interp, int);
+
+void interp_cleanup(PARROT_INTERP, int status)
+{
+    handler_node_t *node = interp->exit_handler_list;
+
+    Parrot_block_GC_mark(interp);
+    Parrot_block_GC_sweep(interp);
+
+    while (node) {
+        handler_node_t * const next = node->next;
+        (node->function)(interp, status, node->arg);
+        mem_sys_free(node);
+        node = next;
+    }
+}
+
+int
+main(int argc, const char *argv[])
+{
+    Parrot_Interp interp;
+    int i, niter = 2;
+
+    for (i = 1; i <= niter; i++) {
+        printf("Starting interp %d\n", i);
+        fflush(stdout);
+        interp = Parrot_interp_new(NULL);
+        if (interp) {
+            Parrot_interp_set_flag(interp, PARROT_DESTROY_FLAG);
+
+            printf("Destroying interp %d\n", i);
+            fflush(stdout);
+            interp_cleanup(interp, 0);
+        }
+    }
+
+    return 0;
+}
+
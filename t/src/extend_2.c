@@ -0,0 +1,21 @@
+#include <stdio.h>
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+
+int
+main(int argc, const char *argv[])
+{
+    Parrot_Interp interp  = Parrot_interp_new(NULL);
+    Parrot_PMC    ns;
+
+    /* Interpreter set-up */
+    if (interp) {
+        ns  = Parrot_ns_get_root_namespace(interp);
+        Parrot_pmc_gc_register(interp, ns);
+        Parrot_pmc_gc_unregister(interp, ns);
+
+        Parrot_printf(interp,"%P\n", ns);
+        Parrot_interp_destroy(interp);
+    }
+    return 0;
+}
@@ -0,0 +1,19 @@
+#include <stdio.h>
+// This is to get Parrot_io_STDOUT, is there a better way?
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+
+int
+main(int argc, const char *argv[])
+{
+    Parrot_PMC pio;
+    Parrot_Interp interp  = Parrot_interp_new(NULL);
+    pio = Parrot_io_STDOUT(interp);
+
+    /* Interpreter set-up */
+    if (interp) {
+        Parrot_fprintf(interp, pio,"42\n");
+    }
+    return 0;
+}
+
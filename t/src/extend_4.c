@@ -0,0 +1,12 @@
+#include <stdio.h>
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+
+int
+main(int argc, const char *argv[])
+{
+    Parrot_printf(NULL,"42\n");
+    Parrot_eprintf(NULL,"42\n");
+    return 0;
+}
+
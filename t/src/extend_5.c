@@ -0,0 +1,22 @@
+
+#include <stdio.h>
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/misc.h"
+
+int
+main(int argc, const char *argv[])
+{
+    Parrot_Interp interp = Parrot_interp_new(NULL);
+    Parrot_String output, output2;
+
+    /* Interpreter set-up */
+    if (interp) {
+        output = Parrot_str_new(interp, "Test", 4/*, "iso-8859-1", 0*/);
+        Parrot_eprintf(interp, "%S\n", output);
+
+        Parrot_interp_destroy(interp);
+    }
+    return 0;
+}
+
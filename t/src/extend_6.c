@@ -0,0 +1,25 @@
+
+#include <stdio.h>
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+
+int
+main(int argc, const char *argv[])
+{
+    Parrot_Interp interp = Parrot_interp_new(NULL);
+    Parrot_String output, output2;
+
+    /* Interpreter set-up */
+    if (interp) {
+        output = Parrot_str_new(interp, "Test_reg_unreg", 14/*, "iso-8859-1", 0*/);
+
+        Parrot_str_gc_register(interp, output);
+        Parrot_str_gc_unregister(interp, output);
+
+        Parrot_eprintf(interp, "%S\n", output);
+
+        Parrot_interp_destroy(interp);
+    }
+    return 0;
+}
+
@@ -0,0 +1,27 @@
+
+#include <stdio.h>
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+
+int
+main(int argc, const char *argv[])
+{
+    Parrot_Interp interp = Parrot_interp_new(NULL);
+    Parrot_Int    value  = 101010;
+    Parrot_PMC    testpmc;
+    Parrot_Int    type, new_value;
+
+    /* Interpreter set-up */
+    if (interp) {
+        type    = Parrot_pmc_get_type_str(interp, Parrot_str_new(interp, "Integer", 0));
+        testpmc = Parrot_pmc_new(interp, type);
+
+        Parrot_PMC_set_integer_native(interp, testpmc, value);
+        new_value = Parrot_PMC_get_integer(interp, testpmc);
+
+        printf("%ld\n", (long)new_value);
+
+        Parrot_interp_destroy(interp);
+    }
+    return 0;
+}
@@ -0,0 +1,28 @@
+
+#include <stdio.h>
+#include "parrot/parrot.h"
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+
+int
+main(int argc, const char *argv[])
+{
+    Parrot_Interp interp = Parrot_interp_new(NULL);
+
+    /* Interpreter set-up */
+    if (interp) {
+        Parrot_Int type  = Parrot_pmc_get_type_str(interp, Parrot_str_new(interp, "ResizablePMCArray", 0));
+        Parrot_PMC array = Parrot_pmc_new(interp, type);
+        Parrot_Int value = 12345;
+        Parrot_Int key   = 10;
+        Parrot_Int new_value;
+
+        Parrot_PMC_set_integer_keyed_int(interp, array, key, value);
+
+        new_value = Parrot_PMC_get_integer_keyed_int(interp, array, key);
+
+        printf("%ld\n", (long)new_value);
+        Parrot_interp_destroy(interp);
+    }
+    return 0;
+}
@@ -0,0 +1,28 @@
+
+#include <stdio.h>
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+
+int
+main(int argc, const char *argv[])
+{
+    Parrot_Interp interp = Parrot_interp_new(NULL);
+    Parrot_Float  value  = 3.1415927;
+    Parrot_Int    type;
+    Parrot_Float  new_value;
+    Parrot_PMC    testpmc;
+
+    /* Interpreter set-up */
+    if (interp) {
+        type    = Parrot_pmc_get_type_str(interp, Parrot_str_new(interp, "Float", 0));
+        testpmc = Parrot_pmc_new(interp, type);
+
+        Parrot_PMC_set_number_native(interp, testpmc, value);
+        new_value = Parrot_PMC_get_number(interp, testpmc);
+
+        printf("%.7f\n", (double)new_value);
+
+        Parrot_interp_destroy(interp);
+    }
+    return 0;
+}
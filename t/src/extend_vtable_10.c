@@ -0,0 +1,114 @@
+#line 43 "t/src/extend_vtable.t"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/extend_vtable.h"
+
+static void fail(const char *msg);
+static Parrot_String createstring(Parrot_Interp interp, const char * value);
+static Parrot_Interp new_interp();
+static void handler(Parrot_Interp interp, Parrot_PMC exception, void *unused);
+
+static void fail(const char *msg)
+{
+    fprintf(stderr, "failed: %s\n", msg);
+    exit(EXIT_FAILURE);
+}
+
+static Parrot_String createstring(Parrot_Interp interp, const char * value)
+{
+    return Parrot_str_new(interp, value, strlen(value)/*, (const char*)NULL, 0*/);
+}
+
+static Parrot_Interp new_interp()
+{
+    Parrot_Interp interp = Parrot_interp_new(NULL);
+    if (!interp)
+        fail("Cannot create parrot interpreter");
+    return interp;
+
+}
+static void handler(Parrot_Interp interp, Parrot_PMC exception, void *unused)
+{
+    Parrot_printf(interp, "Failed!\n");
+    if (exception) {
+        Parrot_String key;
+        Parrot_Int type;
+        Parrot_Int severity;
+        Parrot_String message;
+
+        key = createstring(interp, "type");
+        type = Parrot_PMC_get_integer_keyed_str(interp, exception, key);
+        key = createstring(interp, "severity");
+        severity = Parrot_PMC_get_integer_keyed_str(interp, exception, key);
+        message = Parrot_PMC_get_string(interp, exception);
+        Parrot_printf(interp, "Exception is: type %d severity %d message '%Ss'\n",
+                type, severity, message);
+    }
+}
+
+#define NOT_NULL(pmc)  (!((pmc) == PMCNULL || (pmc) == NULL))
+
+void dotest(Parrot_Interp interp, void *unused)
+{
+    Parrot_PMC pmc, pmc2, pmc3, pmc_string, pmc_string2, pmc_string3;
+    Parrot_PMC pmc_float, pmc_float2;
+    Parrot_PMC rpa, rpa2, fpa, hash, hash_iter, continuation, continuation2;
+    Parrot_PMC key_int, key_str, hashkey, ns, object, klass;
+    Parrot_Int type, value, integer, integer2;
+    Parrot_Float number, number2;
+    Parrot_String string, string2;
+
+    type         = Parrot_PMC_typenum(interp, "Integer");
+    continuation = Parrot_pmc_new(interp, Parrot_PMC_typenum(interp, "Continuation"));
+    continuation2= Parrot_pmc_new(interp, Parrot_PMC_typenum(interp, "Continuation"));
+    rpa          = Parrot_pmc_new(interp, Parrot_PMC_typenum(interp, "ResizablePMCArray"));
+    rpa2         = Parrot_pmc_new(interp, Parrot_PMC_typenum(interp, "ResizablePMCArray"));
+    fpa          = Parrot_pmc_new(interp, Parrot_PMC_typenum(interp, "FixedPMCArray"));
+    hash         = Parrot_pmc_new(interp, Parrot_PMC_typenum(interp, "Hash"));
+    ns           = Parrot_pmc_new(interp, Parrot_PMC_typenum(interp, "Namespace"));
+    pmc          = Parrot_pmc_new(interp, type);
+    pmc2         = Parrot_pmc_new(interp, type);
+    pmc3         = Parrot_pmc_new(interp, type);
+    key_int      = Parrot_pmc_new(interp, Parrot_PMC_typenum(interp, "Key"));
+    type         = Parrot_PMC_typenum(interp, "Class");
+    klass        = Parrot_pmc_new(interp, type);
+
+    Parrot_PMC_set_integer_native(interp, key_int, 42);
+
+    Parrot_PMC_push_pmc(interp, rpa2, continuation);
+
+    pmc_string  = Parrot_pmc_new(interp, Parrot_PMC_typenum(interp,"String"));
+    pmc_string2 = Parrot_pmc_new(interp, Parrot_PMC_typenum(interp,"String"));
+    pmc_string3 = Parrot_pmc_new(interp, Parrot_PMC_typenum(interp,"String"));
+    pmc_float   = Parrot_pmc_new(interp, Parrot_PMC_typenum(interp,"Float"));
+    pmc_float2  = Parrot_pmc_new(interp, Parrot_PMC_typenum(interp,"Float"));
+
+    string  = createstring(interp,"Object");
+    Parrot_PMC_assign_string_native(interp, pmc_string, string);
+
+    object       = Parrot_oo_new_class_pmc(interp, pmc_string);
+
+
+#line 169 "t/src/extend_vtable.t"
+    string  = createstring(interp, "BAR");
+    Parrot_PMC_assign_string_native(interp, pmc_string, string);
+
+    pmc_string = Parrot_PMC_repeat_int(interp, pmc_string, 3, pmc_string);
+    string = Parrot_PMC_name(interp, pmc_string);
+    Parrot_printf(interp, "%S\n%P\n", string, pmc_string);
+
+
+    Parrot_interp_destroy(interp);
+    printf("Done!\n");
+}
+
+int main(void)
+{
+    Parrot_Interp interp;
+    interp = new_interp();
+    Parrot_ext_try(interp, &dotest, &handler, NULL);
+    return 0;
+}
@@ -0,0 +1,31 @@
+#line 74 "t/src/misc.t"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "parrot/parrot.h"
+#include "parrot/misc.h"
+
+void fail(const char *msg);
+
+void fail(const char *msg)
+{
+    fprintf(stderr, "failed: %s\n", msg);
+    exit(EXIT_FAILURE);
+}
+
+int main(int argc, const char **argv)
+{
+    Parrot_Interp interp;
+    char buf[] = "unchanged";
+    interp = Parrot_interp_new(NULL);
+    if (! interp)
+        fail("Cannot create parrot interpreter");
+    Parrot_snprintf(interp, buf, 0, "");
+
+    if (strcmp(buf, "unchanged") == 0) puts("Done");
+    else fail(buf);
+
+    Parrot_interp_destroy(interp);
+    return 0;
+}
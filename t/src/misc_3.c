@@ -0,0 +1,26 @@
+#line 109 "t/src/misc.t"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "parrot/misc.h"
+
+void fail(const char *msg);
+
+void fail(const char *msg)
+{
+    fprintf(stderr, "failed: %s\n", msg);
+    exit(EXIT_FAILURE);
+}
+
+int main(int argc, const char **argv)
+{
+    char buf[10];
+    /*
+    int res = Parrot_secret_snprintf(buf, 10, "12345678901234567890");
+    if (res == 20) puts("Done");
+    else fail("snprintf len mismatch");
+    */
+    printf("THE FAILZ");
+    return 0;
+}
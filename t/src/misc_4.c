@@ -0,0 +1,16 @@
+#line 139 "t/src/misc.t"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "parrot/parrot.h"
+
+int main(int argc, const char **argv)
+{
+    PMC pmc;
+    pmc.flags = 0;
+    /* It should compile */
+    PARROT_GC_WRITE_BARRIER(NULL, &pmc);
+    printf("Done\n");
+    return 0;
+}
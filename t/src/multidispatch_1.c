@@ -0,0 +1,54 @@
+#line 42 "t/src/multidispatch.t"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "parrot/parrot.h"
+#include "pmc/pmc_nci.h"
+
+static void show(Parrot_Interp interp, const char *long_sig);
+
+static void
+show(Parrot_Interp interp, const char *long_sig)
+{
+    PMC * const sub = Parrot_pmc_new(interp, enum_class_NCI);
+    PMC        *multi_sig;
+    INTVAL      i, n;
+
+    Parrot_mmd_add_multi_from_long_sig(interp,
+        Parrot_str_new_constant(interp, "mmd_test"),
+        Parrot_str_new_constant(interp, long_sig), sub);
+
+    GETATTR_NCI_multi_sig(interp, sub, multi_sig);
+    n = VTABLE_elements(interp, multi_sig);
+
+    printf("'%s': %d", long_sig, (int)n);
+
+    for (i = 0; i < n; ++i) {
+        const INTVAL type = VTABLE_get_integer_keyed_int(interp, multi_sig, i);
+        char * const name = Parrot_str_to_cstring(interp,
+                                interp->vtables[type]->whoami);
+        printf(" %s", name);
+        Parrot_str_free_cstring(name);
+    }
+
+    printf("\n");
+}
+
+int main(int argc, const char **argv)
+{
+    Parrot_Interp interp = Parrot_interp_new(NULL);
+
+    if (!interp) {
+        fprintf(stderr, "Cannot create parrot interpreter\n");
+        return EXIT_FAILURE;
+    }
+
+    show(interp, "");
+    show(interp, "Integer");
+    show(interp, "Integer,Float");
+    show(interp, "Float,String,Integer");
+
+    Parrot_interp_destroy(interp);
+    return 0;
+}
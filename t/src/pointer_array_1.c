@@ -0,0 +1,52 @@
+
+#include <parrot/parrot.h>
+#include <parrot/pointer_array.h>
+#include <stdio.h>
+
+int main(int argc, char* argv[])
+{
+    Interp *interp = Parrot_interp_new(NULL);
+    Parrot_Pointer_Array *pa = Parrot_pa_new(interp);
+    int i, count;
+    void *pi, *pj;
+
+    if (!pa) {
+        printf("Fail to create new PA");
+        return EXIT_FAILURE;
+    }
+
+    printf("ok 1\n");
+
+    /* Push first pointer */
+    pi = Parrot_pa_insert(pa, &i);
+
+    if (pa->total_chunks != 1) {
+        printf("Fail to allocate 1 chunk");
+        return EXIT_FAILURE;
+    }
+    printf("ok 2\n");
+
+    if (pa->current_chunk != 0) {
+        printf("current_chunk is wrong");
+        return EXIT_FAILURE;
+    }
+    printf("ok 3\n");
+
+    /* Insert many pointers */
+    for (count = CELL_PER_CHUNK * 2; count; count--) {
+        pi = Parrot_pa_insert(pa, &i);
+    }
+    if (pa->total_chunks < 2) {
+        printf("Fail to allocate more chunks");
+        return EXIT_FAILURE;
+    }
+    printf("ok 4\n");
+
+    if (pa->current_chunk != pa->total_chunks - 1) {
+        printf("current_chunk is wrong");
+        return EXIT_FAILURE;
+    }
+    printf("ok 5\n");
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,105 @@
+
+#include <parrot/parrot.h>
+#include <parrot/pointer_array.h>
+#include <stdio.h>
+
+int main(int argc, char* argv[])
+{
+    Interp *interp = Parrot_interp_new(NULL);
+    Parrot_Pointer_Array *pa = Parrot_pa_new(interp);
+    int i, j, k, count = 0;
+    void *pi, *pj, *pk;
+
+    /* Push first pointer */
+    pi = Parrot_pa_insert(pa, &i);
+    pj = Parrot_pa_insert(pa, &j);
+    pk = Parrot_pa_insert(pa, &k);
+
+    POINTER_ARRAY_ITER(pa,
+        if (ptr == &i)
+            ++count;
+        else if (ptr == &j)
+            ++count;
+        else if (ptr == &k)
+            ++count;
+        else {
+            printf("Unknown pointer! %p - %p %p %p", ptr, pi, pj, pk);
+            return EXIT_FAILURE;
+        }
+    );
+
+    printf("ok 1\n");
+
+    if (count != 3) {
+        printf("Didn't iterate all pointers %d", count);
+        return EXIT_FAILURE;
+    }
+    printf("ok 2\n");
+
+    Parrot_pa_remove(interp, pa, pi);
+    POINTER_ARRAY_ITER(pa,
+        if (ptr == &j)
+            ++count;
+        else if (ptr == &k)
+            ++count;
+        else {
+            printf("Unknown pointer! %p - %p %p %p", ptr, pi, pj, pk);
+            return EXIT_FAILURE;
+        }
+    );
+    if (count != 5) {
+        printf("Didn't iterate all pointers %d", count);
+        return EXIT_FAILURE;
+    }
+    printf("ok 3\n");
+
+
+    Parrot_pa_remove(interp, pa, pk);
+    POINTER_ARRAY_ITER(pa,
+        if (ptr == &j)
+            ++count;
+        else {
+            printf("Unknown pointer! %p - %p %p %p", ptr, pi, pj, pk);
+            return EXIT_FAILURE;
+        }
+    );
+    if (count != 6) {
+        printf("Didn't iterate all pointers %d", count);
+        return EXIT_FAILURE;
+    }
+    printf("ok 4\n");
+
+    /* Push stuff back. Twice. */
+    pi = Parrot_pa_insert(pa, &i);
+    pi = Parrot_pa_insert(pa, &i);
+    pk = Parrot_pa_insert(pa, &k);
+    pk = Parrot_pa_insert(pa, &k);
+    POINTER_ARRAY_ITER(pa,
+        if (ptr == &i)
+            ++count;
+        else if (ptr == &j)
+            ++count;
+        else if (ptr == &k)
+            ++count;
+        else {
+            printf("Unknown pointer! %p - %p %p %p", ptr, pi, pj, pk);
+            return EXIT_FAILURE;
+        }
+    );
+
+    printf("ok 5\n");
+
+    if (count != 11) {
+        printf("Didn't iterate all pointers %d", count);
+        return EXIT_FAILURE;
+    }
+    printf("ok 6\n");
+
+    /* Final check - we should have 5 allocated cells */
+    if (pa->chunks[0]->next_free != 5)
+        printf("Wrong number of used cells: %d", pa->chunks[0]->next_free);
+
+    printf("ok 7\n");
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,16 @@
+
+#include <parrot/parrot.h>
+
+int
+main(int argc, const char* argv[])
+{
+    Parrot_Interp interp = Parrot_interp_new(NULL);
+    int error_val;
+
+    if (interp) {
+        print_pbc_location(interp);
+
+        Parrot_interp_destroy(interp);
+    }
+    return 0;
+}
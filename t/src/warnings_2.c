@@ -0,0 +1,38 @@
+
+#include <parrot/parrot.h>
+
+int
+main(int argc, const char* argv[])
+{
+    Parrot_Interp interp = Parrot_interp_new(NULL);
+    int error_val;
+
+    if (interp) {
+        PARROT_WARNINGS_on(interp, PARROT_WARNINGS_ALL_FLAG);
+
+        error_val = Parrot_warn(interp, PARROT_WARNINGS_ALL_FLAG, "all");
+        Parrot_io_eprintf(interp, "%d\n", error_val);
+
+        /* warnings are on, this should return an error */
+        error_val = Parrot_warn(interp, PARROT_WARNINGS_NONE_FLAG, "none");
+        Parrot_io_eprintf(interp, "%d\n", error_val);
+
+        error_val = Parrot_warn(interp, PARROT_WARNINGS_UNDEF_FLAG, "undef");
+        Parrot_io_eprintf(interp, "%d\n", error_val);
+
+        error_val = Parrot_warn(interp, PARROT_WARNINGS_IO_FLAG, "io");
+        Parrot_io_eprintf(interp, "%d\n", error_val);
+
+        error_val = Parrot_warn(interp, PARROT_WARNINGS_PLATFORM_FLAG, "platform");
+        Parrot_io_eprintf(interp, "%d\n", error_val);
+
+        error_val = Parrot_warn(interp, PARROT_WARNINGS_DYNEXT_FLAG, "dynext");
+        Parrot_io_eprintf(interp, "%d\n", error_val);
+
+        error_val = Parrot_warn(interp, 0, "eek"); /* should return error */
+        Parrot_io_eprintf(interp, "%d\n", error_val);
+
+        Parrot_interp_destroy(interp);
+   }
+   return 0;
+}
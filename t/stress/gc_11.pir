@@ -0,0 +1,20 @@
+.sub 'main' :main
+    .param pmc args
+
+    $I0 = 0
+    .local int N
+    N = args[1]
+    if N <= 0 goto loop
+      N = 10000
+
+  loop:
+    unless $I0 < N goto done
+    'no-op'()
+    inc $I0
+    goto loop
+  done:
+.end
+
+.sub 'no-op'
+    noop
+.end
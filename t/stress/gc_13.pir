@@ -0,0 +1,5 @@
+.sub 'main' :main
+    print "starting\n"
+    $P0 = new ['Integer']
+    print "ending\n"
+.end
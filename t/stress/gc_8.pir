@@ -0,0 +1,25 @@
+.sub 'main' :main
+    .const 'Sub' $P99 = 'coro'
+    .local pmc three, four, five
+    three = clone $P99
+    four  = clone $P99
+    five  = clone $P99
+    three(3)
+    four(4)
+    five(5)
+    three(1)
+    push_eh ehandler
+    three(2)
+    four(1)
+    goto end
+
+    ehandler:
+      pop_eh
+    end:
+.end
+
+.sub '' :anon :subid('coro')
+    .param int x
+    .yield (x)
+    .yield (x)
+.end
@@ -0,0 +1,35 @@
+.sub test :main
+    load_bytecode "dumper.pbc"
+    load_bytecode 'Test/More.pbc'
+    load_bytecode 'MIME/Base64.pbc'
+    load_bytecode 'PGE.pbc'
+    load_bytecode 'PGE/Util.pbc'
+    load_language 'data_json'
+
+   .local pmc json
+    json = compreg 'data_json'
+
+    .local pmc encode_decode_tests, decode_tests
+    encode_decode_tests = json.'compile'( <<'END_JSON' )
+[ ["Hello, World!\n","SGVsbG8sIFdvcmxkIQo="],
+  ["aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa",
+  "YWFhYWFhYWFhYWFhYWFhYWFhYWFhYWFhYWFhYWFhYWFhYWFhYWFhYWFhYWFhYWFhYWFhYWFhYWFh\nYWFhYWFhYWFhYWFhYWFhYWFhYWFhYWFhYWFhYWFhYWFhYWFhYWFhYWFhYQ=="]
+]
+END_JSON
+
+    .local pmc enc_sub
+    enc_sub = get_global [ "MIME"; "Base64" ], 'encode_base64'
+    .local pmc is
+    is   = get_hll_global [ 'Test'; 'More' ], 'is'
+    .local pmc test_iterator, test_case
+    encode_decode_tests = encode_decode_tests()
+    test_iterator = iter encode_decode_tests
+
+    .local string plain, base64, result
+    test_case   = shift test_iterator
+    plain       = shift test_case
+    base64      = shift test_case
+    result = enc_sub( plain )
+    is( result, base64 )
+
+.end
@@ -0,0 +1,268 @@
+#! perl
+use strict;
+use warnings;
+use feature 'unicode_strings';
+use File::Spec;
+use Unicode::UCD ();
+
+=head1 NAME
+
+tools/dev/gen_case_tables.pl -- generate Unicode case mapping tables
+
+=head1 SYNOPSIS
+
+        perl tools/dev/gen_case_tables.pl
+
+=head1 DESCRIPTION
+
+Generate the case mapping tables used by the native upcase, downcase and
+titlecase of the latin1, UTF-8 and UCS-4 encodings, from the Unicode
+character database of the running perl.
+
+Simple one-to-one mappings are stored as runs of codepoints sharing the
+same offset, with a step of 1 or 2 for alternating upper/lower pairs.
+Mappings to more than one codepoint (e.g. C<ß> to C<SS>) are stored in a
+separate table which takes precedence.  The word table classifies
+codepoints for titlecasing.
+
+=cut
+
+my $charset_dir = File::Spec->catdir(qw/ src string encoding /);
+my $ucd_version = Unicode::UCD::UnicodeVersion();
+
+my $coda = <<'EOF';
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
+EOF
+
+my $header = <<"HEADER";
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from '$0'.
+ *
+ * Case mapping tables for the latin1, UTF-8 and UCS-4 encodings,
+ * generated from Unicode $ucd_version.
+ *
+ * Copyright (C) 2014, Parrot Foundation.
+ */
+
+/* HEADERIZER HFILE: none */
+
+HEADER
+
+my %mapping = (
+    upper => sub { uc $_[0] },
+    lower => sub { lc $_[0] },
+    title => sub { ucfirst $_[0] },
+);
+
+=over
+
+=item B<codepoints>()
+
+All Unicode scalar values.
+
+=cut
+
+sub codepoints {
+    return ( 0 .. 0xD7FF, 0xE000 .. 0x10FFFF );
+}
+
+=item B<case_tables>( $name )
+
+Returns the simple mapping runs and the full mappings for the case
+C<$name>.
+
+=cut
+
+sub case_tables {
+    my ($name) = @_;
+    my $map    = $mapping{$name};
+    my ( @runs, @full );
+
+    for my $c ( codepoints() ) {
+        my $m = $map->( chr $c );
+        next if $m eq chr $c;
+
+        if ( length $m > 1 ) {
+            die "mapping of $c too long\n" if length $m > 3;
+            push @full, [ $c, map { ord } split //, $m ];
+            next;
+        }
+
+        my $delta = ord($m) - $c;
+        my $run   = $runs[-1];
+        if ( $run && $run->{delta} == $delta
+            && ( $run->{step}
+                ? $c - $run->{last} == $run->{step}
+                : ( $c - $run->{last} == 1 || $c - $run->{last} == 2 ) ) )
+        {
+            $run->{step} ||= $c - $run->{last};
+            $run->{last} = $c;
+            next;
+        }
+
+        push @runs, { first => $c, last => $c, delta => $delta, step => 0 };
+    }
+
+    return ( \@runs, \@full );
+}
+
+=item B<word_runs>()
+
+Returns the runs of codepoints which continue a word (2 for cased
+characters, 1 for other letters, digits and case-ignorable characters).
+
+=cut
+
+sub word_runs {
+    my @runs;
+
+    for my $c ( codepoints() ) {
+        my $chr   = chr $c;
+        my $class = $chr =~ /\p{Cased}/                        ? 2
+                  : $chr =~ /[\p{Alnum}\p{Case_Ignorable}]/    ? 1
+                  :                                              0;
+        next unless $class;
+
+        my $run = $runs[-1];
+        if ( $run && $run->[1] == $c - 1 && $run->[2] == $class ) {
+            $run->[1] = $c;
+            next;
+        }
+
+        push @runs, [ $c, $c, $class ];
+    }
+
+    return \@runs;
+}
+
+=item B<latin1_table>( $name )
+
+Create a 256 entry table for the case C<$name>; characters whose mapping
+is not a single latin1 character map to themselves.
+
+=back
+
+=cut
+
+sub latin1_table {
+    my ($name) = @_;
+    my $map    = $mapping{$name};
+    my $len    = 8;
+
+    print "const unsigned char Parrot_latin1_${name}[256] = {\n";
+    foreach my $char ( 0 .. 255 ) {
+        my $m = $map->( chr $char );
+        $m = ( length $m == 1 && ord $m < 256 ) ? ord $m : $char;
+        printf "0x%.2x, ", $m;
+        print "/* @{[$char-$len+1]}-$char */\n" if $char % $len == $len - 1;
+    }
+    print "};\n\n";
+}
+
+my ( %runs, %full );
+for my $name (qw/ upper lower title /) {
+    print STDERR "creating table: '$name'\n";
+    ( $runs{$name}, $full{$name} ) = case_tables($name);
+}
+my $word = word_runs();
+
+#
+# create 'src/string/encoding/casetables.c'
+#
+###########################################################################
+my $c_file = File::Spec->catfile( $charset_dir, 'casetables.c' );
+open STDOUT, '>', $c_file
+    or die "can not open '$c_file': $!\n";
+print <<"END";
+$header
+#include "casetables.h"
+
+END
+
+for my $name (qw/ upper lower title /) {
+    print "const Parrot_case_run Parrot_case_${name}_runs[] = {\n";
+    printf "    { 0x%.4X, 0x%.4X, %6d, %d },\n",
+        $_->{first}, $_->{last}, $_->{delta}, $_->{step} || 1
+        for @{ $runs{$name} };
+    print "};\n\n";
+
+    print "const Parrot_case_full Parrot_case_${name}_full[] = {\n";
+    for my $f ( @{ $full{$name} } ) {
+        my ( $c, @m ) = @$f;
+        push @m, 0 while @m < 3;
+        printf "    { 0x%.4X, { 0x%.4X, 0x%.4X, 0x%.4X } },\n", $c, @m;
+    }
+    print "};\n\n";
+}
+
+print "const Parrot_case_run Parrot_case_word_runs[] = {\n";
+printf "    { 0x%.4X, 0x%.4X, %d, 1 },\n", @$_ for @$word;
+print "};\n\n";
+
+latin1_table($_) for qw/ upper lower /;
+print $coda;
+close STDOUT;
+
+#
+# create 'src/string/encoding/casetables.h'
+#
+###########################################################################
+my $h_file = File::Spec->catfile( $charset_dir, 'casetables.h' );
+open STDOUT, '>', $h_file
+    or die "can not open '$h_file': $!\n";
+print <<"END";
+$header
+#ifndef PARROT_CASE_TABLES_H_GUARD
+#define PARROT_CASE_TABLES_H_GUARD
+#include "parrot/parrot.h"
+
+/* Codepoints first..last (every step'th) map to codepoint + delta. */
+typedef struct Parrot_case_run {
+    Parrot_UInt4 first;
+    Parrot_UInt4 last;
+    Parrot_Int4  delta;
+    Parrot_UInt4 step;
+} Parrot_case_run;
+
+/* Mapping to up to three codepoints, 0 terminated when shorter. */
+typedef struct Parrot_case_full {
+    Parrot_UInt4 codepoint;
+    Parrot_UInt4 mapping[3];
+} Parrot_case_full;
+
+/* In the word runs delta is the class: 2 cased, 1 other word characters. */
+#define PARROT_CASE_WORD_CASED 2
+
+END
+
+for my $name (qw/ upper lower title /) {
+    my $uc = uc $name;
+    printf "#define PARROT_CASE_%s_RUNS %d\n", $uc, scalar @{ $runs{$name} };
+    printf "#define PARROT_CASE_%s_FULL %d\n", $uc, scalar @{ $full{$name} };
+}
+printf "#define PARROT_CASE_WORD_RUNS %d\n\n", scalar @$word;
+
+for my $name (qw/ upper lower title /) {
+    print "extern const Parrot_case_run  Parrot_case_${name}_runs[];\n";
+    print "extern const Parrot_case_full Parrot_case_${name}_full[];\n";
+}
+print "extern const Parrot_case_run  Parrot_case_word_runs[];\n";
+print "extern const unsigned char    Parrot_latin1_upper[256];\n";
+print "extern const unsigned char    Parrot_latin1_lower[256];\n";
+print "#endif /* PARROT_CASE_TABLES_H_GUARD */\n";
+print $coda;
+close STDOUT;
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4:
@@ -0,0 +1,611 @@
+# THIS IS A GENERATED FILE! DO NOT EDIT!
+# Compiled with Winxed 1.9.1
+# Source file: tools/dev/pbc_to_exe.winxed
+# Begin generated code
+
+.sub initial_load_bytecode :anon :load :init
+    load_bytecode "Getopt/Obj.pbc"
+    load_bytecode "config.pbc"
+.end
+
+# end libs
+.namespace [ ]
+
+.sub 'main' :main
+        .param pmc __ARG_1
+.const 'Sub' WSubId_1 = "WSubId_1"
+.const 'Sub' WSubId_2 = "WSubId_2"
+.const 'Sub' WSubId_3 = "WSubId_3"
+.const 'Sub' WSubId_4 = "WSubId_4"
+.const 'Sub' WSubId_5 = "WSubId_5"
+.const 'Sub' WSubId_6 = "WSubId_6"
+.const 'Sub' WSubId_7 = "WSubId_7"
+.const 'Sub' WSubId_8 = "WSubId_8"
+.const 'Sub' WSubId_9 = "WSubId_9"
+    ($S1, $S2, $S3, $S4, $S5, $S6, $P1) = WSubId_1(__ARG_1)
+
+    ne $S1, "", __label_1
+    root_new $P3, ['parrot';'Exception']
+    $P3['message'] = "cannot read infile"
+    throw $P3
+  __label_1: # endif
+    root_new $P2, ["parrot";"FileHandle"]
+    $P2."open"($S2,'w')
+    if $P2 goto __label_2
+    root_new $P3, ['parrot';'Exception']
+    $P3['message'] = "cannot write outfile"
+    throw $P3
+  __label_2: # endif
+    $P2.'print'("#include <stdio.h>\n#include <stdlib.h>\n#include <string.h>\n#ifndef _WIN32\n#  include <unistd.h> /* for readlink() */\n#endif\n#ifdef __APPLE__\n#  include <mach-o/dyld.h> /* for _NSGetExecutablePath() */\n#endif\n#ifdef __FreeBSD__\n#  include <sys/sysctl.h>\n#endif\n#include \"parrot/api.h\"\n\nint Parrot_set_config_hash(Parrot_PMC interp_pmc);\nstatic void show_last_error_and_exit(Parrot_PMC interp);\nstatic void print_parrot_string(Parrot_PMC interp, FILE *vector, Parrot_String str, int newline);\nstatic void setup_pir_compregs(Parrot_PMC interp);\nstatic PMC * get_class_pmc(Parrot_PMC interp, const char *name);\nstatic void get_imcc_compiler_pmc(Parrot_PMC interp, Parrot_PMC class_pmc, Parrot_Int is_pasm);\n\n#define TRACE 0\n\n")
+    $P3 = WSubId_2()
+    null $S7
+    if_null $P3, __label_3
+    set $S7, $P3
+  __label_3:
+    if $S7 == "gcc" goto __label_6
+    if $S7 == "msvc" goto __label_7
+    goto __label_4
+  __label_6: # case
+    WSubId_3($S1, $P2)
+    goto __label_5 # break
+  __label_7: # case
+    WSubId_4($S1, $P2)
+    goto __label_5 # break
+  __label_4: # default
+    WSubId_5($S1, $P2)
+  __label_5: # switch end
+    WSubId_6($P2, "RUNCORE", $S5)
+    WSubId_6($P2, "GCCORE", $S6)
+    $P2.'print'("        int main(int argc, const char *argv[])\n        {\n            PMC                 *interp;\n            PMC                 *pbc;\n            PMC                 *argsarray;\n            const unsigned char *program_code_addr;\n            Parrot_Init_Args    *initargs;\n\n            static char         execname[1024];\n            size_t execname_size = sizeof(execname);\n            memset(execname, 0, execname_size);\n#if defined(__APPLE__)\n            if (_NSGetExecutablePath(execname, (unsigned int*)&execname_size) != 0)\n                memcpy(execname, argv[0], strlen(argv[0]));\n#elif defined(sun) || defined(__sun)\n            const char *_execname = getexecname();\n            if (_execname)\n                memcpy(execname, _execname, strlen(_execname));\n            else\n                memcpy(execname, argv[0], strlen(argv[0]));\n#elif defined(__FreeBSD__)\n            int mib[4];\n            mib[0] = CTL_KERN;\n            mib[1] = KERN_PROC;\n            mib[2] = KERN_PROC_PATHNAME;\n            mib[3] = -1;\n            sysctl(mib, 4, execname, &execname_size, NULL, 0);\n#elif defined(__NetBSD__)\n            if (readlink(\"/proc/curproc/exe\", execname, execname_size-1) <= 0)\n                memcpy(execname, argv[0], strlen(argv[0]));\n#elif defined(__DragonFly__)\n            if (readlink(\"/proc/curproc/file\", execname, execname_size-1) <= 0)\n                memcpy(execname, argv[0], strlen(argv[0]));\n#elif defined(_WIN32)\n            if (GetModuleFileName(NULL, execname, (DWORD)execname_size) == 0)\n                memcpy(execname, argv[0], strlen(argv[0]));\n#elif defined(__unix__) || defined(__linux__)\n            if (readlink(\"/proc/self/exe\", execname, execname_size-1) <= 0)\n                memcpy(execname, argv[0], strlen(argv[0]));\n#else\n            memcpy(execname, argv[0], strlen(argv[0]));\n#endif\n\n            GET_INIT_STRUCT(initargs);\n\n            initargs->gc_system = GCCORE;\n\n            program_code_addr = get_program_code();\n\n            if (!program_code_addr)\n                exit(EXIT_FAILURE);\n\n            if (!(Parrot_api_make_interpreter(NULL, 0, initargs, &interp) &&\n                  Parrot_set_config_hash(interp) &&\n                  Parrot_api_set_executable_name(interp, execname) &&\n                  Parrot_api_set_runcore(interp, RUNCORE, TRACE))) {\n                fprintf(stderr, \"PARROT VM: Could not initialize new interpreter\\n\");\n                show_last_error_and_exit(interp);\n            }\n\n            setup_pir_compregs(interp);\n\n            if (!Parrot_api_pmc_wrap_string_array(interp, argc, argv, &argsarray)) {\n                fprintf(stderr, \"PARROT VM: Could not build args array\");\n                show_last_error_and_exit(interp);\n            }\n\n            if (!Parrot_api_load_bytecode_bytes(interp,\n                                                program_code_addr,\n                                                (Parrot_Int) bytecode_size,\n                                                &pbc)) {\n                fprintf(stderr, \"PARROT VM: Could not load bytecode\\n\");\n                show_last_error_and_exit(interp);\n            }\n\n            if (!Parrot_api_run_bytecode(interp, pbc, argsarray)) {\n                show_last_error_and_exit(interp);\n            }\n\n            if (!Parrot_api_destroy_interpreter(interp)) {\n                fprintf(stderr, \"PARROT VM: Could not destroy interpreter\\n\");\n                show_last_error_and_exit(interp);\n            }\n\n            exit(EXIT_SUCCESS);\n        }\n\n        static void\n        show_last_error_and_exit(Parrot_PMC interp)\n        {\n            Parrot_String errmsg, backtrace;\n            Parrot_Int exit_code, is_error;\n            Parrot_PMC exception;\n\n            if (!Parrot_api_get_result(interp, &is_error, &exception, &exit_code, &errmsg))\n                exit(EXIT_FAILURE);\n\n            if (is_error) {\n                if (!Parrot_api_get_exception_backtrace(interp, exception, &backtrace))\n                    exit(EXIT_FAILURE);\n                print_parrot_string(interp, stderr, errmsg, 1);\n                print_parrot_string(interp, stderr, backtrace, 0);\n            }\n\n            exit(exit_code);\n        }\n\n        static void\n        print_parrot_string(Parrot_PMC interp, FILE *vector, Parrot_String str, int newline)\n        {\n            char *msg_raw;\n\n            if (!str)\n                return;\n\n            if (!Parrot_api_string_export_ascii(interp, str, &msg_raw))\n                show_last_error_and_exit(interp);\n\n            if (msg_raw) {\n                fprintf(vector, \"%s%s\", msg_raw, newline ? \"\\n\" : \"\");\n\n                if (!Parrot_api_string_free_exported_ascii(interp, msg_raw))\n                    show_last_error_and_exit(interp);\n            }\n        }\n\n        static void\n        setup_pir_compregs(Parrot_PMC interp)\n        {\n            Parrot_PMC class_pmc = get_class_pmc(interp, \"IMCCompiler\");\n            get_imcc_compiler_pmc(interp, class_pmc, 0);\n            get_imcc_compiler_pmc(interp, class_pmc, 1);\n        }\n\n        PARROT_CANNOT_RETURN_NULL\n        static PMC *\n        get_class_pmc(Parrot_PMC interp, ARGIN(const char *name))\n        {\n            Parrot_String name_s = NULL;\n            Parrot_PMC name_pmc = NULL;\n            Parrot_PMC class_pmc = NULL;\n            if (!(Parrot_api_string_import_ascii(interp, name, &name_s) &&\n                  Parrot_api_pmc_box_string(interp, name_s, &name_pmc) &&\n                  Parrot_api_pmc_get_class(interp, name_pmc, &class_pmc)))\n                show_last_error_and_exit(interp);\n            return class_pmc;\n        }\n\n        PARROT_CANNOT_RETURN_NULL\n        static void\n        get_imcc_compiler_pmc(Parrot_PMC interp, Parrot_PMC class_pmc, Parrot_Int is_pasm)\n        {\n            Parrot_PMC is_pasm_pmc = NULL;\n            Parrot_PMC compiler_pmc = NULL;\n            const char * const name = is_pasm ? \"PASM\" : \"PIR\";\n            Parrot_String name_s = NULL;\n\n            if (!Parrot_api_pmc_box_integer(interp, is_pasm, &is_pasm_pmc))\n                show_last_error_and_exit(interp);\n            if (!Parrot_api_pmc_new_from_class(interp, class_pmc, is_pasm_pmc, &compiler_pmc))\n                show_last_error_and_exit(interp);\n            if (!(Parrot_api_string_import_ascii(interp, name, &name_s) &&\n                  Parrot_api_set_compiler(interp, name_s, compiler_pmc)))\n                show_last_error_and_exit(interp);\n        }\n\n")
+    $P3 = $P2.'close'()
+    set $I1, $P3
+    unless $I1 goto __label_8
+    root_new $P3, ['parrot';'Exception']
+    $P3['message'] = "cannot close outfile"
+    throw $P3
+  __label_8: # endif
+    eq $S7, 'msvc', __label_10
+    set $S8, ''
+    goto __label_9
+  __label_10:
+    $P3 = WSubId_7($S1, '.RES')
+    set $S8, $P3
+  __label_9:
+    WSubId_8($S2, $S3, $P1)
+    WSubId_9($S3, $S4, $S8, $P1)
+
+.end # main
+
+
+.sub 'print_define' :subid('WSubId_6')
+        .param pmc __ARG_1
+        .param pmc __ARG_2 :slurpy
+    $S1 = __ARG_2[1]
+    unless_null $S1, __label_1
+    sprintf $S1, "#define %s NULL\n", __ARG_2
+    goto __label_2
+  __label_1: # else
+    sprintf $S1, "#define %s \"%s\"\n", __ARG_2
+  __label_2: # endif
+    __ARG_1.'print'($S1)
+
+.end # print_define
+
+
+.sub 'handle_args' :subid('WSubId_1')
+        .param pmc __ARG_1
+.const 'Sub' WSubId_10 = "WSubId_10"
+    $P1 = '_config'()
+    $S1 = $P1['o']
+    $S2 = $P1['exe']
+    new $P2, [ 'Getopt'; 'Obj' ]
+    push $P2, 'install|i'
+    push $P2, 'runcore|R:s'
+    push $P2, 'output|o:s'
+    push $P2, 'verbose|v'
+    push $P2, 'help|h'
+    push $P2, 'gc:s'
+    __ARG_1.'shift'()
+    $P3 = $P2.'get_options'(__ARG_1)
+    $I1 = $P3['help']
+    $I2 = $P3['verbose']
+    $I3 = $P3['install']
+    $S3 = $P3['runcore']
+    $S4 = $P3['output']
+    $S5 = $P3['gc']
+    ne $S5, "", __label_1
+    null $S5
+  __label_1: # endif
+    unless $I1 goto __label_2
+    getstderr $P4
+    $P4.'print'("pbc_to_exe [options] <file>\n  Options:\n    -h --help\n    -i --install\n    -v --verbose\n    -R --runcore=slow|fast\n    -o --output=FILE\n       --gc=ms2|gms\n")
+    exit 0
+  __label_2: # endif
+    $P4 = __ARG_1.'shift'()
+    null $S6
+    if_null $P4, __label_3
+    set $S6, $P4
+  __label_3:
+    substr $S14, $S6, -4, 4
+    downcase $S7, $S14
+    eq $S7, '.pbc', __label_4
+    root_new $P4, ['parrot';'Exception']
+    $P4['message'] = "input pbc file name does not end in '.pbc'"
+    throw $P4
+  __label_4: # endif
+    null $S8
+    null $S9
+    null $S10
+    eq $S4, '', __label_5
+    length $I4, $S2
+    neg $I5, $I4
+    substr $S14, $S4, $I5, $I4
+    downcase $S11, $S14
+    downcase $S12, $S2
+    eq $S11, $S12, __label_7
+    concat $S14, "output executable name does not end in '", $S2
+    concat $S14, $S14, "'"
+    root_new $P4, ['parrot';'Exception']
+    $P4['message'] = $S14
+    throw $P4
+  __label_7: # endif
+    neg $I5, $I4
+    replace $S4, $S4, $I5, $I4, ''
+    concat $S14, $S4, '.c'
+    set $S8, $S14
+    concat $S14, $S4, $S1
+    set $S9, $S14
+    concat $S14, $S4, $S2
+    set $S10, $S14
+    goto __label_6
+  __label_5: # else
+    replace $S4, $S6, -4, 4, ''
+    concat $S14, $S4, '.c'
+    set $S8, $S14
+    concat $S14, $S4, $S1
+    set $S9, $S14
+    concat $S14, $S4, $S2
+    set $S10, $S14
+    unless $I3 goto __label_8
+    $P4 = WSubId_10($S10)
+    set $S10, $P4
+  __label_8: # endif
+  __label_6: # endif
+    null $S13
+    if $S3 == 'slow' goto __label_11
+    if $S3 == 'fast' goto __label_12
+    if $S3 == '' goto __label_13
+    goto __label_9
+  __label_11: # case
+    set $S13, 'slow'
+    goto __label_10 # break
+  __label_12: # case
+  __label_13: # case
+    set $S13, 'fast'
+    goto __label_10 # break
+  __label_9: # default
+    concat $S15, "Unsupported runcore: '", $S3
+    concat $S15, $S15, "'"
+    root_new $P4, ['parrot';'Exception']
+    $P4['message'] = $S15
+    throw $P4
+  __label_10: # switch end
+    .return($S6, $S8, $S9, $S10, $S13, $S5, $P3)
+
+.end # handle_args
+
+
+.sub 'determine_code_type' :subid('WSubId_2')
+    $P1 = '_config'()
+    $S1 = $P1['gccversion']
+    eq $S1, '', __label_1
+    .return('gcc')
+  __label_1: # endif
+    $S2 = $P1['cc']
+    $S3 = $P1['osname']
+    ne $S3, 'MSWin32', __label_2
+    ne $S2, 'cl', __label_2
+    .return('msvc')
+  __label_2: # endif
+    .return('default')
+
+.end # determine_code_type
+
+
+.sub 'spawnw_cmd' :subid('WSubId_12')
+        .param string __ARG_1
+    null $I1
+    spawnw $I1, __ARG_1
+    .return($I1)
+
+.end # spawnw_cmd
+
+
+.sub 'generate_code' :subid('WSubId_5')
+        .param string __ARG_1
+        .param pmc __ARG_2
+    root_new $P1, ["parrot";"FileHandle"]
+    $P1."open"(__ARG_1,'rb')
+    if $P1 goto __label_1
+    root_new $P2, ['parrot';'Exception']
+    $P2['message'] = "cannot open infile"
+    throw $P2
+  __label_1: # endif
+    __ARG_2.'print'("const Parrot_UInt1 program_code[] = {")
+    null $I1
+  __label_3: # Infinite loop
+    $P2 = $P1.'read'(16384)
+    null $S1
+    if_null $P2, __label_4
+    set $S1, $P2
+  __label_4:
+    length $I2, $S1
+    gt $I2, 0, __label_5
+    goto __label_2 # break
+  __label_5: # endif
+    null $I3
+  __label_8: # for condition
+    ge $I3, $I2, __label_7
+    ord $I4, $S1, $I3
+    set $S2, $I4
+    __ARG_2.'print'($S2)
+    __ARG_2.'print'(',')
+    inc $I1
+    mod $I4, $I1, 32
+    if $I4 goto __label_9
+    __ARG_2.'print'("\n")
+  __label_9: # endif
+  __label_6: # for iteration
+    inc $I3
+    goto __label_8
+  __label_7: # for end
+    goto __label_3
+  __label_2: # Infinite loop end
+    $P1.'close'()
+    __ARG_2.'print'("\n};\n\nconst size_t bytecode_size = ")
+    __ARG_2.'print'($I1)
+    __ARG_2.'print'(";\n")
+    __ARG_2.'print'("        const unsigned char * get_program_code(void)\n        {\n            return program_code;\n        }\n")
+
+.end # generate_code
+
+
+.sub 'generate_encoding_table' :subid('WSubId_11')
+    new $P1, ['FixedIntegerArray'], 1
+    new $P2, ['FixedStringArray'], 256
+    null $I1
+  __label_3: # for condition
+    ge $I1, 256, __label_2
+    $P1[0] = $I1
+    sprintf $S1, '\%o', $P1
+    $P2[$I1] = $S1
+  __label_1: # for iteration
+    inc $I1
+    goto __label_3
+  __label_2: # for end
+    .return($P2)
+
+.end # generate_encoding_table
+
+
+.sub 'generate_code_gcc' :subid('WSubId_3')
+        .param string __ARG_1
+        .param pmc __ARG_2
+.const 'Sub' WSubId_11 = "WSubId_11"
+    root_new $P1, ["parrot";"FileHandle"]
+    $P1."open"(__ARG_1,'rb')
+    if $P1 goto __label_1
+    root_new $P3, ['parrot';'Exception']
+    $P3['message'] = "cannot open infile"
+    throw $P3
+  __label_1: # endif
+    $P2 = WSubId_11()
+    __ARG_2.'print'("const unsigned char program_code[] =\n\"")
+    null $I1
+  __label_3: # Infinite loop
+    $P3 = $P1.'read'(16384)
+    null $S1
+    if_null $P3, __label_4
+    set $S1, $P3
+  __label_4:
+    length $I2, $S1
+    gt $I2, 0, __label_5
+    goto __label_2 # break
+  __label_5: # endif
+    null $I3
+  __label_8: # for condition
+    ge $I3, $I2, __label_7
+    ord $I4, $S1, $I3
+    $S2 = $P2[$I4]
+    __ARG_2.'print'($S2)
+    inc $I1
+    mod $I4, $I1, 32
+    if $I4 goto __label_9
+    __ARG_2.'print'("\"\n\"")
+  __label_9: # endif
+  __label_6: # for iteration
+    inc $I3
+    goto __label_8
+  __label_7: # for end
+    goto __label_3
+  __label_2: # Infinite loop end
+    $P1.'close'()
+    __ARG_2.'print'("\"\n;\n\nconst size_t bytecode_size = ")
+    __ARG_2.'print'($I1)
+    __ARG_2.'print'(";\n")
+    __ARG_2.'print'("        const unsigned char * get_program_code(void)\n        {\n            return program_code;\n        }\n")
+
+.end # generate_code_gcc
+
+
+.sub 'replace_pbc_extension' :subid('WSubId_7')
+        .param string __ARG_1
+        .param string __ARG_2
+    substr $S4, __ARG_1, -4
+    downcase $S1, $S4
+    eq $S1, '.pbc', __label_1
+    root_new $P1, ['parrot';'Exception']
+    $P1['message'] = "input pbc file name does not end in '.pbc'"
+    throw $P1
+  __label_1: # endif
+    replace $S2, __ARG_1, -4, 4, ''
+    substr $S3, $S2, 0
+    eq __ARG_2, '', __label_2
+    substr $S4, __ARG_2, 0, 1
+    eq $S4, '.', __label_3
+    concat $S3, $S3, '.'
+  __label_3: # endif
+    concat $S3, $S3, __ARG_2
+  __label_2: # endif
+    .return($S3)
+
+.end # replace_pbc_extension
+
+
+.sub 'generate_code_msvc' :subid('WSubId_4')
+        .param string __ARG_1
+        .param pmc __ARG_2
+.const 'Sub' WSubId_7 = "WSubId_7"
+.const 'Sub' WSubId_12 = "WSubId_12"
+    $P4 = WSubId_7(__ARG_1, '.rc')
+    null $S1
+    if_null $P4, __label_1
+    set $S1, $P4
+  __label_1:
+    $P4 = WSubId_7(__ARG_1, '.res')
+    null $S2
+    if_null $P4, __label_2
+    set $S2, $P4
+  __label_2:
+    set $S3, "#define RESOURCE_NAME_ID_WHOLE_PBC 333\n#define RESOURCE_TYPE_ID_WHOLE_PBC 444\n"
+    concat $S4, $S3, 'RESOURCE_NAME_ID_WHOLE_PBC RESOURCE_TYPE_ID_WHOLE_PBC "'
+    concat $S4, $S4, __ARG_1
+    concat $S4, $S4, "\"\n"
+    root_new $P1, ["parrot";"FileHandle"]
+    $P1."open"($S1,'w')
+    if $P1 goto __label_3
+    root_new $P4, ['parrot';'Exception']
+    $P4['message'] = "cannot open .rc file"
+    throw $P4
+  __label_3: # endif
+    $P1.'print'($S4)
+    $P4 = $P1.'close'()
+    set $I3, $P4
+    unless $I3 goto __label_4
+    root_new $P5, ['parrot';'Exception']
+    $P5['message'] = "cannot close .rc file"
+    throw $P5
+  __label_4: # endif
+    new $P2, [ 'OS' ]
+    $P3 = $P2.'stat'(__ARG_1)
+    $I1 = $P3[7]
+    __ARG_2.'print'("#include <windows.h>\n")
+    __ARG_2.'print'($S3)
+    __ARG_2.'print'("const unsigned int bytecode_size = ")
+    __ARG_2.'print'($I1)
+    __ARG_2.'print'(";\n")
+    __ARG_2.'print'("        const unsigned char * get_program_code(void)\n        {\n            HRSRC   hResource;\n            DWORD   size;\n            HGLOBAL hPBC;\n            LPVOID  actual_pointer_to_pbc_in_memory;\n\n            hResource = FindResource(\n                NULL,\n                MAKEINTRESOURCE(RESOURCE_NAME_ID_WHOLE_PBC),\n                MAKEINTRESOURCE(RESOURCE_TYPE_ID_WHOLE_PBC)\n            );\n            if (!hResource)\n                return NULL;\n\n            size = SizeofResource( NULL, hResource );\n            if (size != bytecode_size)\n                return NULL;\n\n            hPBC = LoadResource( NULL, hResource );\n            if (!hPBC)\n                return NULL;\n\n            actual_pointer_to_pbc_in_memory = LockResource( hPBC );\n            if (!actual_pointer_to_pbc_in_memory)\n                return NULL;\n\n            return actual_pointer_to_pbc_in_memory;\n        }\n")
+    concat $S5, 'rc ', $S1
+    say $S5
+    $P4 = WSubId_12($S5)
+    set $I2, $P4
+    unless $I2 goto __label_5
+    root_new $P4, ['parrot';'Exception']
+    $P4['message'] = "RC command failed"
+    throw $P4
+  __label_5: # endif
+
+.end # generate_code_msvc
+
+
+.sub 'compile_file' :subid('WSubId_8')
+        .param string __ARG_1
+        .param string __ARG_2
+        .param pmc __ARG_3
+.const 'Sub' WSubId_12 = "WSubId_12"
+    $I1 = __ARG_3['verbose']
+    $I2 = __ARG_3['install']
+    $P1 = '_config'()
+    $S1 = $P1['cc']
+    $S2 = $P1['ccflags']
+    $S3 = $P1['optimize']
+    $S4 = $P1['cc_o_out']
+    $S5 = $P1['osname']
+    $S6 = $P1['build_dir']
+    $S7 = $P1['slash']
+    $S8 = $P1['installed']
+    $S9 = $P1['includedir']
+    $S10 = $P1['versiondir']
+    eq $S8, "1", __label_2
+    concat $S14, $S6, $S7
+    concat $S14, $S14, 'include'
+    set $S11, $S14
+    goto __label_1
+  __label_2:
+    concat $S15, $S9, $S10
+    set $S11, $S15
+  __label_1:
+    set $S12, '"'
+    concat $S13, $S1, ' '
+    concat $S13, $S13, $S4
+    concat $S13, $S13, __ARG_2
+    concat $S13, $S13, ' -I'
+    concat $S13, $S13, $S12
+    concat $S13, $S13, $S11
+    concat $S13, $S13, $S12
+    concat $S13, $S13, ' '
+    concat $S13, $S13, $S2
+    concat $S13, $S13, ' '
+    concat $S13, $S13, $S3
+    concat $S13, $S13, ' -c '
+    concat $S13, $S13, __ARG_1
+    unless $I1 goto __label_3
+    say $S13
+  __label_3: # endif
+    $P2 = WSubId_12($S13)
+    set $I3, $P2
+    unless $I3 goto __label_4
+    root_new $P2, ['parrot';'Exception']
+    $P2['message'] = "compilation failed"
+    throw $P2
+  __label_4: # endif
+    unless $I1 goto __label_5
+    print "Compiled: "
+    say __ARG_2
+  __label_5: # endif
+    .return()
+
+.end # compile_file
+
+
+.sub 'link_file' :subid('WSubId_9')
+        .param string __ARG_1
+        .param string __ARG_2
+        .param string __ARG_3
+        .param pmc __ARG_4
+.const 'Sub' WSubId_12 = "WSubId_12"
+    $I1 = __ARG_4['verbose']
+    $I2 = __ARG_4['install']
+    $P1 = '_config'()
+    $S1 = $P1['cc']
+    $S2 = $P1['link']
+    $S3 = $P1['link_dynamic']
+    $S4 = $P1['linkflags']
+    $S5 = $P1['ld_out']
+    $S6 = $P1['libparrot_linkflags']
+    $S7 = $P1['libs']
+    $S8 = $P1['o']
+    $S9 = $P1['rpath_blib']
+    $S10 = $P1['osname']
+    $S11 = $P1['build_dir']
+    $S12 = $P1['slash']
+    $S13 = $P1['icu_shared']
+    $S14 = $P1['installed']
+    $S15 = $P1['libdir']
+    $S16 = $P1['versiondir']
+    $S17 = $P1['optimize']
+    set $S18, '"'
+    set $S19, $S18
+    eq $S14, '1', __label_1
+    concat $S19, $S19, $S11
+    concat $S19, $S19, $S12
+    concat $S19, $S19, 'src'
+    concat $S19, $S19, $S12
+    if $I2 goto __label_3
+    concat $S19, $S19, 'parrot_config'
+    goto __label_4
+  __label_3: # else
+    concat $S19, $S19, 'install_config'
+    $S9 = $P1['rpath_lib']
+  __label_4: # endif
+    goto __label_2
+  __label_1: # else
+    $S9 = $P1['rpath_lib']
+    $S6 = $P1['inst_libparrot_linkflags']
+    concat $S19, $S19, $S15
+    concat $S19, $S19, $S16
+    concat $S19, $S19, $S12
+    concat $S19, $S19, 'parrot_config'
+  __label_2: # endif
+    concat $S19, $S19, $S8
+    concat $S19, $S19, $S18
+    concat $S2, $S2, ' '
+    concat $S2, $S2, $S5
+    concat $S2, $S2, __ARG_2
+    concat $S2, $S2, ' '
+    concat $S2, $S2, $S18
+    concat $S2, $S2, __ARG_1
+    concat $S2, $S2, $S18
+    eq __ARG_3, '', __label_5
+    concat $S2, $S2, ' '
+    concat $S2, $S2, $S18
+    concat $S2, $S2, __ARG_3
+    concat $S2, $S2, $S18
+  __label_5: # endif
+    concat $S2, $S2, ' '
+    concat $S2, $S2, $S19
+    concat $S2, $S2, ' '
+    concat $S2, $S2, $S9
+    concat $S2, $S2, ' '
+    concat $S2, $S2, $S6
+    concat $S2, $S2, ' '
+    concat $S2, $S2, $S3
+    concat $S2, $S2, ' '
+    concat $S2, $S2, $S4
+    concat $S2, $S2, ' '
+    concat $S2, $S2, $S7
+    concat $S2, $S2, ' '
+    concat $S2, $S2, $S13
+    unless $I1 goto __label_6
+    say $S2
+  __label_6: # endif
+    $P4 = WSubId_12($S2)
+    set $I3, $P4
+    unless $I3 goto __label_7
+    root_new $P4, ['parrot';'Exception']
+    $P4['message'] = "linking failed"
+    throw $P4
+  __label_7: # endif
+    loadlib $P1, 'file'
+    new $P2, [ 'File' ]
+    concat $S20, __ARG_2, '.manifest'
+    $P3 = $P2.'exists'($S20)
+    set $I5, $P3
+    unless $I5 goto __label_8
+    concat $S21, 'mt.exe -nologo -manifest ', $S20
+    concat $S21, $S21, ' -outputresource:'
+    concat $S21, $S21, __ARG_2
+    concat $S21, $S21, ';1'
+    unless $I1 goto __label_9
+    say $S21
+  __label_9: # endif
+    $P4 = WSubId_12($S21)
+    set $I4, $P4
+    unless $I4 goto __label_10
+    root_new $P4, ['parrot';'Exception']
+    $P4['message'] = 'manifest embedding failed'
+    throw $P4
+  __label_10: # endif
+  __label_8: # endif
+    unless $I1 goto __label_11
+    print "Linked: "
+    say __ARG_2
+  __label_11: # endif
+    .return()
+
+.end # link_file
+
+
+.sub 'prepend_installable' :subid('WSubId_10')
+        .param string __ARG_1
+    split $P1, '/', __ARG_1
+    __ARG_1 = $P1[-1]
+    concat $S1, 'installable_', __ARG_1
+    set __ARG_1, $S1
+    $P1[-1] = __ARG_1
+    join __ARG_1, '/', $P1
+    .return(__ARG_1)
+
+.end # prepend_installable
+
+# End generated code